@@ -80,6 +80,17 @@ if(PLATFORM_WIN32)
                     "\"$<TARGET_FILE_DIR:${TARGET_NAME}>\"")
         endif()
 
+        if(D3D12_SUPPORTED AND DILIGENT_DIRECT_STORAGE_DLL_PATHS)
+            foreach(DLL ${DILIGENT_DIRECT_STORAGE_DLL_PATHS})
+                if(EXISTS "${DLL}")
+                    add_custom_command(TARGET ${TARGET_NAME} POST_BUILD
+                        COMMAND ${CMAKE_COMMAND} -E copy_if_different
+                            "${DLL}"
+                            "\"$<TARGET_FILE_DIR:${TARGET_NAME}>\"")
+                endif()
+            endforeach(DLL)
+        endif()
+
         if(arg_DXC_REQUIRED AND VULKAN_SUPPORTED AND EXISTS "${DILIGENT_DXCOMPILER_FOR_SPIRV_PATH}")
             add_custom_command(TARGET ${TARGET_NAME} POST_BUILD
                 COMMAND ${CMAKE_COMMAND} -E copy_if_different
@@ -239,6 +250,11 @@ function(set_common_target_properties TARGET)
             # Strip debug info from WebAssembly binary. Without this option, the toolchain crashes on CI.
             target_link_options(${TARGET} PRIVATE "SHELL: -gseparate-dwarf -g0")
         endif()
+        if((TARGET_TYPE STREQUAL EXECUTABLE) AND DILIGENT_EMSCRIPTEN_OFFSCREEN_CANVAS)
+            # Allow canvases to be transferred to pthread workers as OffscreenCanvas so that WebGL
+            # and WebGPU devices can be created and used off the main browser thread.
+            target_link_options(${TARGET} PRIVATE "-pthread" "-sOFFSCREENCANVAS_SUPPORT=1" "-sOFFSCREEN_FRAMEBUFFER=1")
+        endif()
     endif()
 
     if(COMMAND custom_post_configure_target)
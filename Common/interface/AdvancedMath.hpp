@@ -629,6 +629,39 @@ inline BoxVisibility GetBoxVisibility(const ViewFrustumExt&      ViewFrustumExt,
     return BoxVisibility::Intersecting;
 }
 
+struct IThreadPool;
+
+/// Tests the visibility of multiple axis-aligned bounding boxes stored as structure of arrays.
+
+/// \param [in]  Frustum       - View frustum to test the boxes against.
+/// \param [in]  MinX          - Array of Count box minimum X coordinates.
+/// \param [in]  MinY          - Array of Count box minimum Y coordinates.
+/// \param [in]  MinZ          - Array of Count box minimum Z coordinates.
+/// \param [in]  MaxX          - Array of Count box maximum X coordinates.
+/// \param [in]  MaxY          - Array of Count box maximum Y coordinates.
+/// \param [in]  MaxZ          - Array of Count box maximum Z coordinates.
+/// \param [in]  Count         - The number of boxes.
+/// \param [out] OutVisibility - Array of Count values that receives the BoxVisibility of every box
+///                              cast to Uint8.
+/// \param [in]  PlaneFlags    - Frustum planes to test the boxes against.
+/// \param [in]  pThreadPool   - Optional thread pool. If not null, the boxes are split into ranges
+///                              that are processed in parallel by the pool and the calling thread.
+///
+/// The results are the same as returned by GetBoxVisibility(const ViewFrustumExt&, const BoundBox&, FRUSTUM_PLANE_FLAGS)
+/// for every box. The boxes are processed with AVX2, SSE or NEON instructions when they are available.
+/// The arrays do not need to be aligned.
+void GetBoxesVisibility(const ViewFrustumExt& Frustum,
+                        const float*          MinX,
+                        const float*          MinY,
+                        const float*          MinZ,
+                        const float*          MaxX,
+                        const float*          MaxY,
+                        const float*          MaxZ,
+                        size_t                Count,
+                        Uint8*                OutVisibility,
+                        FRUSTUM_PLANE_FLAGS   PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                        IThreadPool*          pThreadPool = nullptr);
+
 inline float GetPointToBoxDistanceSqr(const BoundBox& BB, const float3& Pos)
 {
     VERIFY_EXPR(BB.Max.x >= BB.Min.x &&
@@ -866,6 +899,79 @@ inline float IntersectRayTriangle(const float3& V0,
 }
 
 
+/// Intersects a packet of rays with the 3D box.
+
+/// \param [in]  RayOrigins    - Array of NumRays ray origins.
+/// \param [in]  RayDirections - Array of NumRays ray directions.
+/// \param [in]  NumRays       - The number of rays, must not exceed 32.
+/// \param [in]  BoxMin        - Box minimum corner.
+/// \param [in]  BoxMax        - Box maximum corner.
+/// \param [out] EnterDist     - Optional array of NumRays values that receives the distances
+///                              to the box entry points.
+/// \param [out] ExitDist      - Optional array of NumRays values that receives the distances
+///                              to the box exit points.
+/// \return      A bit mask where bit i is set if ray i intersects the box.
+///
+/// The results are the same as returned by IntersectRayBox3D() for every ray.
+/// The rays are processed in groups of 8 (AVX2) or 4 (SSE, NEON).
+Uint32 IntersectRayPacketBox3D(const float3* RayOrigins,
+                               const float3* RayDirections,
+                               Uint32        NumRays,
+                               const float3& BoxMin,
+                               const float3& BoxMax,
+                               float*        EnterDist = nullptr,
+                               float*        ExitDist  = nullptr);
+
+/// Intersects a packet of rays with the axis-aligned bounding box, see IntersectRayPacketBox3D().
+inline Uint32 IntersectRayPacketAABB(const float3*   RayOrigins,
+                                     const float3*   RayDirections,
+                                     Uint32          NumRays,
+                                     const BoundBox& AABB,
+                                     float*          EnterDist = nullptr,
+                                     float*          ExitDist  = nullptr)
+{
+    return IntersectRayPacketBox3D(RayOrigins, RayDirections, NumRays, AABB.Min, AABB.Max, EnterDist, ExitDist);
+}
+
+/// Intersects a packet of rays with the triangle.
+
+/// \param [in]  V0, V1, V2     - Triangle vertices.
+/// \param [in]  RayOrigins     - Array of NumRays ray origins.
+/// \param [in]  RayDirections  - Array of NumRays ray directions.
+/// \param [in]  NumRays        - The number of rays.
+/// \param [out] OutDist        - Array of NumRays values that receives the distance along every ray
+///                               to the intersection point, see IntersectRayTriangle().
+/// \param [in]  CullBackFace   - Whether to ignore the intersections with the back face.
+void IntersectRayPacketTriangle(const float3& V0,
+                                const float3& V1,
+                                const float3& V2,
+                                const float3* RayOrigins,
+                                const float3* RayDirections,
+                                Uint32        NumRays,
+                                float*        OutDist,
+                                bool          CullBackFace = false);
+
+/// Intersects a ray with multiple triangles and finds the closest intersection in front of the ray origin.
+
+/// \param [in]     RayOrigin     - Ray origin.
+/// \param [in]     RayDirection  - Ray direction.
+/// \param [in]     TriangleVerts - Array of 3 * NumTriangles triangle vertices.
+/// \param [in]     NumTriangles  - The number of triangles.
+/// \param [in,out] HitDist       - On input, the maximum distance to consider.
+///                                 On output, the distance to the closest intersection, if one was found.
+/// \param [in]     CullBackFace  - Whether to ignore the intersections with the back faces.
+/// \return         The index of the closest intersected triangle with the distance in the range [0, HitDist),
+///                 or ~0u if there is no such triangle.
+///
+/// The triangles are processed in groups of 8 (AVX2) or 4 (SSE, NEON).
+Uint32 IntersectRayTriangles(const float3& RayOrigin,
+                             const float3& RayDirection,
+                             const float3* TriangleVerts,
+                             Uint32        NumTriangles,
+                             float&        HitDist,
+                             bool          CullBackFace = false);
+
+
 /// Traces a 2D line through the square cell grid and enumerates all cells the line touches.
 
 /// \tparam TCallback - Type of the callback function.
@@ -49,4 +49,86 @@ void GetArray2DMinMaxValue(const float* pData,
                            float&       MinValue,
                            float&       MaxValue);
 
+/// Computes the sum of all values in a 2D floating-point array.
+
+/// \param[in] pData          - A pointer to the array data.
+/// \param[in] StrideInFloats - Row stride in 32-bit floats.
+/// \param[in] Width          - 2D array width.
+/// \param[in] Height         - 2D array height.
+/// \return                     The sum of all values accumulated in double precision.
+double GetArray2DSum(const float* pData,
+                     size_t       StrideInFloats,
+                     Uint32       Width,
+                     Uint32       Height);
+
+/// Computes the histogram of a 2D floating-point array.
+
+/// \param[in]  pData          - A pointer to the array data.
+/// \param[in]  StrideInFloats - Row stride in 32-bit floats.
+/// \param[in]  Width          - 2D array width.
+/// \param[in]  Height         - 2D array height.
+/// \param[in]  RangeMin       - The lower bound of the first bin.
+/// \param[in]  RangeMax       - The upper bound of the last bin.
+/// \param[in]  NumBins        - The number of bins.
+/// \param[out] pBins          - A pointer to the array of NumBins counters.
+///
+/// \remarks   The range [RangeMin, RangeMax] is split into NumBins equal bins.
+///            Values outside of the range are counted in the first or the last bin.
+///            The counters are overwritten.
+void ComputeArray2DHistogram(const float* pData,
+                             size_t       StrideInFloats,
+                             Uint32       Width,
+                             Uint32       Height,
+                             float        RangeMin,
+                             float        RangeMax,
+                             Uint32       NumBins,
+                             Uint32*      pBins);
+
+/// Computes the minimum and the maximum value in every tile of a 2D floating-point array.
+
+/// \param[in]  pData             - A pointer to the array data.
+/// \param[in]  StrideInFloats    - Row stride in 32-bit floats.
+/// \param[in]  Width             - 2D array width.
+/// \param[in]  Height            - 2D array height.
+/// \param[in]  TileSize          - Tile size. Tiles at the right and bottom edges may be smaller.
+/// \param[out] pMinValues        - Tile minimum values, a (Width + TileSize - 1) / TileSize by
+///                                 (Height + TileSize - 1) / TileSize array.
+/// \param[out] pMaxValues        - Tile maximum values, an array of the same size.
+/// \param[in]  DstStrideInFloats - Row stride of the destination arrays in 32-bit floats.
+///
+/// \remarks   Together with ComputeArray2DMinMaxMip(), this function is intended for building
+///            the min/max pyramid of a height map.
+void GetArray2DTileMinMaxValues(const float* pData,
+                                size_t       StrideInFloats,
+                                Uint32       Width,
+                                Uint32       Height,
+                                Uint32       TileSize,
+                                float*       pMinValues,
+                                float*       pMaxValues,
+                                size_t       DstStrideInFloats);
+
+/// Computes the next level of the min/max pyramid by reducing every 2x2 block of
+/// the fine level.
+
+/// \param[in]  pFineMin        - Minimum values of the fine level.
+/// \param[in]  pFineMax        - Maximum values of the fine level.
+/// \param[in]  FineStride      - Row stride of the fine level arrays in 32-bit floats.
+/// \param[in]  FineWidth       - Fine level width.
+/// \param[in]  FineHeight      - Fine level height.
+/// \param[out] pCoarseMin      - Minimum values of the coarse level, a (FineWidth + 1) / 2 by
+///                               (FineHeight + 1) / 2 array.
+/// \param[out] pCoarseMax      - Maximum values of the coarse level.
+/// \param[in]  CoarseStride    - Row stride of the coarse level arrays in 32-bit floats.
+///
+/// \remarks   When the fine level size is odd, the last coarse column or row covers a single
+///            fine column or row.
+void ComputeArray2DMinMaxMip(const float* pFineMin,
+                             const float* pFineMax,
+                             size_t       FineStride,
+                             Uint32       FineWidth,
+                             Uint32       FineHeight,
+                             float*       pCoarseMin,
+                             float*       pCoarseMax,
+                             size_t       CoarseStride);
+
 } // namespace Diligent
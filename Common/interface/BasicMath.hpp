@@ -54,6 +54,23 @@
 
 #include "HashUtils.hpp"
 
+// When DILIGENT_MATH_SIMD is defined, float4, float4x4 and QuaternionF operations use SSE (x86/x64)
+// or NEON (AArch64) intrinsics. The scalar templates remain the reference implementation and are
+// used for all other types and on other architectures.
+#if DILIGENT_MATH_SIMD
+#    if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#        include <xmmintrin.h>
+#        define DILIGENT_MATH_SIMD_SSE 1
+#    elif defined(__aarch64__) || defined(_M_ARM64)
+#        include <arm_neon.h>
+#        define DILIGENT_MATH_SIMD_NEON 1
+#    endif
+#endif
+
+#if DILIGENT_MATH_SIMD_SSE || DILIGENT_MATH_SIMD_NEON
+#    define DILIGENT_MATH_SIMD_ENABLED 1
+#endif
+
 #ifdef _MSC_VER
 #    pragma warning(push)
 #    pragma warning(disable : 4201) // nonstandard extension used: nameless struct/union
@@ -2317,6 +2334,238 @@ using int4x4 = Matrix4x4<Int32>;
 using int3x3 = Matrix3x3<Int32>;
 using int2x2 = Matrix2x2<Int32>;
 
+
+#if DILIGENT_MATH_SIMD_ENABLED
+
+// SIMD specializations of float4 and float4x4 operations.
+// Note that unlike the scalar templates, these functions are not constexpr.
+// All operations except for Inverse() produce bit-exact results as the scalar code.
+namespace MathSIMD
+{
+
+#    if DILIGENT_MATH_SIMD_SSE
+
+using f32x4 = __m128;
+
+// clang-format off
+inline f32x4 Load (const float* p)                  { return _mm_loadu_ps(p); }
+inline void  Store(float* p, f32x4 v)               { _mm_storeu_ps(p, v); }
+inline f32x4 Set  (float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+inline f32x4 Splat(float s)                         { return _mm_set1_ps(s); }
+inline f32x4 Add  (f32x4 a, f32x4 b)                { return _mm_add_ps(a, b); }
+inline f32x4 Sub  (f32x4 a, f32x4 b)                { return _mm_sub_ps(a, b); }
+inline f32x4 Mul  (f32x4 a, f32x4 b)                { return _mm_mul_ps(a, b); }
+inline f32x4 Div  (f32x4 a, f32x4 b)                { return _mm_div_ps(a, b); }
+// clang-format on
+
+inline void Transpose(f32x4& r0, f32x4& r1, f32x4& r2, f32x4& r3)
+{
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+}
+
+#    elif DILIGENT_MATH_SIMD_NEON
+
+using f32x4 = float32x4_t;
+
+// clang-format off
+inline f32x4 Load (const float* p)                  { return vld1q_f32(p); }
+inline void  Store(float* p, f32x4 v)               { vst1q_f32(p, v); }
+inline f32x4 Set  (float x, float y, float z, float w) { const float v[] = {x, y, z, w}; return vld1q_f32(v); }
+inline f32x4 Splat(float s)                         { return vdupq_n_f32(s); }
+inline f32x4 Add  (f32x4 a, f32x4 b)                { return vaddq_f32(a, b); }
+inline f32x4 Sub  (f32x4 a, f32x4 b)                { return vsubq_f32(a, b); }
+inline f32x4 Mul  (f32x4 a, f32x4 b)                { return vmulq_f32(a, b); }
+inline f32x4 Div  (f32x4 a, f32x4 b)                { return vdivq_f32(a, b); }
+// clang-format on
+
+inline void Transpose(f32x4& r0, f32x4& r1, f32x4& r2, f32x4& r3)
+{
+    const float32x4x2_t t01 = vtrnq_f32(r0, r1); // {a0 b0 a2 b2}, {a1 b1 a3 b3}
+    const float32x4x2_t t23 = vtrnq_f32(r2, r3); // {c0 d0 c2 d2}, {c1 d1 c3 d3}
+
+    r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+
+#    endif
+
+// Returns a * b + c. Intentionally does not use fused multiply-add to match the scalar results.
+inline f32x4 MulAdd(f32x4 a, f32x4 b, f32x4 c)
+{
+    return Add(Mul(a, b), c);
+}
+
+// Returns s.x * r0 + s.y * r1 + s.z * r2 + s.w * r3
+inline f32x4 LinearCombination(const float* s, f32x4 r0, f32x4 r1, f32x4 r2, f32x4 r3)
+{
+    f32x4 res = Mul(Splat(s[0]), r0);
+    res       = MulAdd(Splat(s[1]), r1, res);
+    res       = MulAdd(Splat(s[2]), r2, res);
+    res       = MulAdd(Splat(s[3]), r3, res);
+    return res;
+}
+
+inline f32x4 Load(const Vector4<float>& v)
+{
+    return Load(v.Data());
+}
+
+inline Vector4<float> ToVector4(f32x4 v)
+{
+    Vector4<float> res;
+    Store(res.Data(), v);
+    return res;
+}
+
+} // namespace MathSIMD
+
+template <>
+inline Vector4<float> Vector4<float>::operator+(const Vector4<float>& right) const
+{
+    return MathSIMD::ToVector4(MathSIMD::Add(MathSIMD::Load(*this), MathSIMD::Load(right)));
+}
+
+template <>
+inline Vector4<float> Vector4<float>::operator-(const Vector4<float>& right) const
+{
+    return MathSIMD::ToVector4(MathSIMD::Sub(MathSIMD::Load(*this), MathSIMD::Load(right)));
+}
+
+template <>
+inline Vector4<float> Vector4<float>::operator*(const Vector4<float>& right) const
+{
+    return MathSIMD::ToVector4(MathSIMD::Mul(MathSIMD::Load(*this), MathSIMD::Load(right)));
+}
+
+template <>
+inline Vector4<float> Vector4<float>::operator*(float s) const
+{
+    return MathSIMD::ToVector4(MathSIMD::Mul(MathSIMD::Load(*this), MathSIMD::Splat(s)));
+}
+
+template <>
+inline Vector4<float> Vector4<float>::operator/(const Vector4<float>& right) const
+{
+    return MathSIMD::ToVector4(MathSIMD::Div(MathSIMD::Load(*this), MathSIMD::Load(right)));
+}
+
+template <>
+inline Vector4<float> Vector4<float>::operator*(const Matrix4x4<float>& m) const
+{
+    using namespace MathSIMD;
+    return ToVector4(LinearCombination(Data(), Load(m.m[0]), Load(m.m[1]), Load(m.m[2]), Load(m.m[3])));
+}
+
+template <>
+inline Vector4<float> operator*(const Matrix4x4<float>& m, const Vector4<float>& v)
+{
+    using namespace MathSIMD;
+
+    f32x4 c0 = Load(m.m[0]);
+    f32x4 c1 = Load(m.m[1]);
+    f32x4 c2 = Load(m.m[2]);
+    f32x4 c3 = Load(m.m[3]);
+    Transpose(c0, c1, c2, c3);
+    return ToVector4(LinearCombination(v.Data(), c0, c1, c2, c3));
+}
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Mul(const Matrix4x4<float>& m1, const Matrix4x4<float>& m2)
+{
+    using namespace MathSIMD;
+
+    const f32x4 r0 = Load(m2.m[0]);
+    const f32x4 r1 = Load(m2.m[1]);
+    const f32x4 r2 = Load(m2.m[2]);
+    const f32x4 r3 = Load(m2.m[3]);
+
+    Matrix4x4<float> mOut;
+    for (int i = 0; i < 4; ++i)
+        Store(mOut.m[i], LinearCombination(m1.m[i], r0, r1, r2, r3));
+    return mOut;
+}
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Transpose() const
+{
+    using namespace MathSIMD;
+
+    f32x4 r0 = Load(m[0]);
+    f32x4 r1 = Load(m[1]);
+    f32x4 r2 = Load(m[2]);
+    f32x4 r3 = Load(m[3]);
+    MathSIMD::Transpose(r0, r1, r2, r3);
+
+    Matrix4x4<float> mOut;
+    Store(mOut.m[0], r0);
+    Store(mOut.m[1], r1);
+    Store(mOut.m[2], r2);
+    Store(mOut.m[3], r3);
+    return mOut;
+}
+
+// Computes the inverse using the expansion by 2x2 minors of the top and bottom row pairs,
+// which takes considerably fewer operations than the cofactor expansion used by the scalar code.
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Inverse() const
+{
+    using namespace MathSIMD;
+
+    const float s0 = _11 * _22 - _21 * _12;
+    const float s1 = _11 * _23 - _21 * _13;
+    const float s2 = _11 * _24 - _21 * _14;
+    const float s3 = _12 * _23 - _22 * _13;
+    const float s4 = _12 * _24 - _22 * _14;
+    const float s5 = _13 * _24 - _23 * _14;
+
+    const float c0 = _31 * _42 - _41 * _32;
+    const float c1 = _31 * _43 - _41 * _33;
+    const float c2 = _31 * _44 - _41 * _34;
+    const float c3 = _32 * _43 - _42 * _33;
+    const float c4 = _32 * _44 - _42 * _34;
+    const float c5 = _33 * _44 - _43 * _34;
+
+    const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+    // clang-format off
+    const f32x4 V0 = Set(_21, -_11, _41, -_31);
+    const f32x4 V1 = Set(_22, -_12, _42, -_32);
+    const f32x4 V2 = Set(_23, -_13, _43, -_33);
+    const f32x4 V3 = Set(_24, -_14, _44, -_34);
+
+    const f32x4 C0 = Set(c0, c0, s0, s0);
+    const f32x4 C1 = Set(c1, c1, s1, s1);
+    const f32x4 C2 = Set(c2, c2, s2, s2);
+    const f32x4 C3 = Set(c3, c3, s3, s3);
+    const f32x4 C4 = Set(c4, c4, s4, s4);
+    const f32x4 C5 = Set(c5, c5, s5, s5);
+    // clang-format on
+
+    const f32x4 InvDet = Splat(1.f / det);
+
+    // MathSIMD::Mul must be qualified as Matrix4x4::Mul hides it
+    const auto Mad = [](f32x4 a0, f32x4 b0, f32x4 a1, f32x4 b1, f32x4 a2, f32x4 b2, f32x4 Scale) {
+        return MathSIMD::Mul(MulAdd(a2, b2, MulAdd(a1, b1, MathSIMD::Mul(a0, b0))), Scale);
+    };
+
+    const f32x4 NegV0 = Sub(Splat(0.f), V0);
+    const f32x4 NegV1 = Sub(Splat(0.f), V1);
+    const f32x4 NegV2 = Sub(Splat(0.f), V2);
+    const f32x4 NegV3 = Sub(Splat(0.f), V3);
+
+    Matrix4x4<float> inv;
+    Store(inv.m[0], Mad(V1, C5, NegV2, C4, V3, C3, InvDet));
+    Store(inv.m[1], Mad(NegV0, C5, V2, C2, NegV3, C1, InvDet));
+    Store(inv.m[2], Mad(V0, C4, NegV1, C2, V3, C0, InvDet));
+    Store(inv.m[3], Mad(NegV0, C3, V1, C1, NegV2, C0, InvDet));
+
+    return inv;
+}
+
+#endif
+
 template <typename T = float>
 struct Quaternion
 {
@@ -2438,6 +2687,26 @@ struct Quaternion
 using QuaternionF = Quaternion<float>;
 using QuaternionD = Quaternion<double>;
 
+#if DILIGENT_MATH_SIMD_ENABLED
+template <>
+inline Quaternion<float> Quaternion<float>::Mul(const Quaternion<float>& q1, const Quaternion<float>& q2)
+{
+    using namespace MathSIMD;
+
+    const Vector4<float>& a = q1.q;
+    const Vector4<float>& b = q2.q;
+
+    // clang-format off
+    f32x4 res = MathSIMD::Mul(Splat(a.x), Set(+b.w, -b.z, +b.y, -b.x));
+    res = MulAdd(Splat(a.y), Set(+b.z, +b.w, -b.x, -b.y), res);
+    res = MulAdd(Splat(a.z), Set(-b.y, +b.x, +b.w, -b.z), res);
+    res = MulAdd(Splat(a.w), Load(b), res);
+    // clang-format on
+
+    return Quaternion<float>{ToVector4(res)};
+}
+#endif
+
 template <typename T>
 constexpr inline Quaternion<T> operator*(const Quaternion<T>& q1, const Quaternion<T>& q2)
 {
@@ -0,0 +1,391 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// C++20 coroutine support: the Diligent::CoTask coroutine type and awaitables for the thread pool.
+
+// The engine is built with C++14/17, so this header is only active when the application
+// itself is compiled with C++20 coroutine support. Otherwise, DILIGENT_COROUTINES_SUPPORTED
+// is 0 and the header is empty.
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__has_include)
+#    if __has_include(<coroutine>)
+#        define DILIGENT_COROUTINES_SUPPORTED 1
+#    endif
+#endif
+
+#ifndef DILIGENT_COROUTINES_SUPPORTED
+#    define DILIGENT_COROUTINES_SUPPORTED 0
+#endif
+
+#if DILIGENT_COROUTINES_SUPPORTED
+
+#    include <coroutine>
+#    include <exception>
+#    include <optional>
+#    include <utility>
+
+#    include "../../Primitives/interface/Errors.hpp"
+#    include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+/// Resumes the coroutine in the thread pool, or on the calling thread if the pool is null.
+inline void ResumeCoroutine(std::coroutine_handle<> Handle, IThreadPool* pThreadPool, float fPriority = 0)
+{
+    if (pThreadPool == nullptr)
+    {
+        Handle.resume();
+        return;
+    }
+
+    EnqueueAsyncWork(
+        pThreadPool,
+        [Handle](Uint32 /*ThreadId*/) {
+            Handle.resume();
+            return ASYNC_TASK_STATUS_COMPLETE;
+        },
+        fPriority);
+}
+
+
+template <typename T>
+class CoTask;
+
+template <typename T>
+class CoTaskPromiseBase
+{
+public:
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename PromiseType>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> Handle) const noexcept
+        {
+            // Continue the awaiting coroutine without growing the stack
+            std::coroutine_handle<> Continuation = Handle.promise().m_Continuation;
+            return Continuation ? Continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    void unhandled_exception() noexcept { m_Exception = std::current_exception(); }
+
+protected:
+    template <typename>
+    friend class CoTask;
+
+    void RethrowIfFailed() const
+    {
+        if (m_Exception)
+            std::rethrow_exception(m_Exception);
+    }
+
+    std::coroutine_handle<> m_Continuation;
+    std::exception_ptr      m_Exception;
+};
+
+template <typename T>
+class CoTaskPromise : public CoTaskPromiseBase<T>
+{
+public:
+    template <typename ValueType>
+    void return_value(ValueType&& Value)
+    {
+        m_Value.emplace(std::forward<ValueType>(Value));
+    }
+
+    T GetResult()
+    {
+        this->RethrowIfFailed();
+        return std::move(*m_Value);
+    }
+
+private:
+    std::optional<T> m_Value;
+};
+
+template <>
+class CoTaskPromise<void> : public CoTaskPromiseBase<void>
+{
+public:
+    void return_void() const noexcept {}
+
+    void GetResult() const
+    {
+        RethrowIfFailed();
+    }
+};
+
+
+/// Lazily started coroutine that produces a value of type T.
+
+/// The coroutine starts when it is awaited with co_await, and the awaiting coroutine is resumed
+/// on the thread that completes it. Exceptions are propagated to the awaiting coroutine.
+/// To start a coroutine from a regular function, use StartDetached().
+///
+///     CoTask<void> LoadModel(IRenderDevice* pDevice, IThreadPool* pThreadPool)
+///     {
+///         co_await ResumeOn(pThreadPool);
+///         // Load the data on the worker thread
+///         co_await WhenFenceReached(pDevice, pFence, UploadFenceValue, pThreadPool);
+///         // The upload is complete
+///     }
+template <typename T = void>
+class CoTask
+{
+public:
+    struct promise_type : CoTaskPromise<T>
+    {
+        CoTask get_return_object() noexcept
+        {
+            return CoTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+    };
+
+    CoTask() noexcept = default;
+
+    CoTask(CoTask&& Other) noexcept :
+        m_Handle{std::exchange(Other.m_Handle, nullptr)}
+    {}
+
+    CoTask& operator=(CoTask&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            if (m_Handle)
+                m_Handle.destroy();
+            m_Handle = std::exchange(Other.m_Handle, nullptr);
+        }
+        return *this;
+    }
+
+    // clang-format off
+    CoTask           (const CoTask&) = delete;
+    CoTask& operator=(const CoTask&) = delete;
+    // clang-format on
+
+    ~CoTask()
+    {
+        if (m_Handle)
+            m_Handle.destroy();
+    }
+
+    bool IsValid() const noexcept { return static_cast<bool>(m_Handle); }
+
+    bool await_ready() const noexcept
+    {
+        return !m_Handle || m_Handle.done();
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> Awaiting) noexcept
+    {
+        m_Handle.promise().m_Continuation = Awaiting;
+        // Start the coroutine
+        return m_Handle;
+    }
+
+    T await_resume()
+    {
+        VERIFY(m_Handle, "Awaiting an empty coroutine");
+        return m_Handle.promise().GetResult();
+    }
+
+private:
+    explicit CoTask(std::coroutine_handle<promise_type> Handle) noexcept :
+        m_Handle{Handle}
+    {}
+
+    std::coroutine_handle<promise_type> m_Handle;
+};
+
+
+class DetachedCoroutine
+{
+public:
+    struct promise_type
+    {
+        DetachedCoroutine get_return_object() const noexcept { return {}; }
+
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        // The frame is destroyed when the coroutine completes
+        std::suspend_never final_suspend() const noexcept { return {}; }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() const noexcept
+        {
+            LOG_ERROR_MESSAGE("Unhandled exception in a detached coroutine");
+        }
+    };
+};
+
+inline DetachedCoroutine StartDetachedImpl(CoTask<void> Task)
+{
+    co_await Task;
+}
+
+/// Starts the coroutine on the calling thread and returns when it suspends for the first time.
+/// The coroutine frame is destroyed when it completes. Unhandled exceptions are logged.
+inline void StartDetached(CoTask<void> Task)
+{
+    StartDetachedImpl(std::move(Task));
+}
+
+
+/// Awaitable that resumes the coroutine in the thread pool, see ResumeOn().
+class ThreadPoolAwaiter
+{
+public:
+    ThreadPoolAwaiter(IThreadPool* pThreadPool, float fPriority) noexcept :
+        m_pThreadPool{pThreadPool},
+        m_fPriority{fPriority}
+    {}
+
+    bool await_ready() const noexcept { return m_pThreadPool == nullptr; }
+    void await_suspend(std::coroutine_handle<> Handle) const { ResumeCoroutine(Handle, m_pThreadPool, m_fPriority); }
+    void await_resume() const noexcept {}
+
+private:
+    IThreadPool* const m_pThreadPool;
+    const float        m_fPriority;
+};
+
+/// Moves the coroutine to a worker thread of the pool.
+
+/// If pThreadPool is null, the coroutine continues on the calling thread.
+/// The pool must not be destroyed while coroutines are waiting to be resumed.
+inline ThreadPoolAwaiter ResumeOn(IThreadPool* pThreadPool, float fPriority = 0)
+{
+    return ThreadPoolAwaiter{pThreadPool, fPriority};
+}
+
+
+/// Awaitable that resumes the coroutine when the async task is finished, see WhenComplete().
+class AsyncTaskAwaiter
+{
+public:
+    AsyncTaskAwaiter(IAsyncTask* pTask, IThreadPool* pThreadPool) noexcept :
+        m_pTask{pTask},
+        m_pThreadPool{pThreadPool}
+    {
+        DEV_CHECK_ERR(pThreadPool != nullptr, "Thread pool must not be null");
+    }
+
+    bool await_ready() const noexcept { return !m_pTask || m_pTask->IsFinished(); }
+
+    void await_suspend(std::coroutine_handle<> Handle)
+    {
+        // The thread pool starts the continuation once the task is finished
+        IAsyncTask* pTask = m_pTask;
+        EnqueueAsyncWork(m_pThreadPool, &pTask, 1,
+                         [Handle](Uint32 /*ThreadId*/) {
+                             Handle.resume();
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+
+    /// Returns ASYNC_TASK_STATUS_COMPLETE or ASYNC_TASK_STATUS_CANCELLED.
+    ASYNC_TASK_STATUS await_resume() const noexcept
+    {
+        return m_pTask ? m_pTask->GetStatus() : ASYNC_TASK_STATUS_UNKNOWN;
+    }
+
+private:
+    RefCntAutoPtr<IAsyncTask> m_pTask;
+    IThreadPool* const        m_pThreadPool;
+};
+
+/// Suspends the coroutine until the task is complete or cancelled and resumes it in the thread pool.
+
+/// This is the coroutine counterpart of the prerequisites of IThreadPool::EnqueueTask().
+inline AsyncTaskAwaiter WhenComplete(IAsyncTask* pTask, IThreadPool* pThreadPool)
+{
+    return AsyncTaskAwaiter{pTask, pThreadPool};
+}
+
+
+/// Awaitable that resumes the coroutine when the condition is true, see ResumeWhen().
+template <typename ConditionType>
+class ConditionAwaiter
+{
+public:
+    ConditionAwaiter(IThreadPool* pThreadPool, ConditionType&& Condition, float fPriority) :
+        m_pThreadPool{pThreadPool},
+        m_Condition{std::move(Condition)},
+        m_fPriority{fPriority}
+    {
+        DEV_CHECK_ERR(pThreadPool != nullptr, "Thread pool must not be null");
+    }
+
+    bool await_ready() { return m_Condition(); }
+
+    void await_suspend(std::coroutine_handle<> Handle)
+    {
+        EnqueueAsyncWork(
+            m_pThreadPool,
+            [this, Handle](Uint32 /*ThreadId*/) {
+                // Returning NOT_STARTED makes the pool reschedule the task
+                if (!m_Condition())
+                    return ASYNC_TASK_STATUS_NOT_STARTED;
+
+                Handle.resume();
+                return ASYNC_TASK_STATUS_COMPLETE;
+            },
+            m_fPriority);
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    IThreadPool* const  m_pThreadPool;
+    ConditionType       m_Condition;
+    const float         m_fPriority;
+};
+
+/// Suspends the coroutine until the condition returns true and resumes it in the thread pool.
+
+/// The condition is checked by a thread pool task that is rescheduled until the condition is met,
+/// so it must be thread-safe and cheap. This is intended for objects that do not provide
+/// completion notifications, such as pipeline states that are compiled asynchronously.
+template <typename ConditionType>
+ConditionAwaiter<ConditionType> ResumeWhen(IThreadPool* pThreadPool, ConditionType Condition, float fPriority = 0)
+{
+    return ConditionAwaiter<ConditionType>{pThreadPool, std::move(Condition), fPriority};
+}
+
+} // namespace Diligent
+
+#endif // DILIGENT_COROUTINES_SUPPORTED
@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::CountingMemoryAllocator class
+
+#include <array>
+#include <atomic>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+
+namespace Diligent
+{
+
+/// Memory allocator that forwards allocations to another allocator and accounts them
+/// for a memory category, see Diligent::MemoryCategoryStats.
+
+/// Every allocation is prefixed with a small header that stores its size, so that
+/// Free() can update the statistics. The counters are atomic and always enabled.
+/// If the parent allocator is provided, its statistics are updated as well, which
+/// allows aggregating per-device statistics into the global ones.
+class CountingMemoryAllocator final : public IMemoryAllocator
+{
+public:
+    /// \param [in] pAllocator - Allocator to forward allocations to.
+    ///                          If null, the engine raw allocator (see GetRawAllocator()) is used.
+    /// \param [in] pParent    - Optional parent allocator whose statistics are also updated.
+    CountingMemoryAllocator(IMemoryAllocator* pAllocator, CountingMemoryAllocator* pParent = nullptr) noexcept;
+
+    // clang-format off
+    CountingMemoryAllocator           (const CountingMemoryAllocator&) = delete;
+    CountingMemoryAllocator           (CountingMemoryAllocator&&)      = delete;
+    CountingMemoryAllocator& operator=(const CountingMemoryAllocator&) = delete;
+    CountingMemoryAllocator& operator=(CountingMemoryAllocator&&)      = delete;
+    // clang-format on
+
+    /// Allocates block of memory
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory
+    virtual void Free(void* Ptr) override final;
+
+    /// Allocates block of memory with specified alignment
+    virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory allocated with AllocateAligned
+    virtual void FreeAligned(void* Ptr) override final;
+
+    /// Returns the statistics of the allocations made through this allocator and all its children
+    MemoryCategoryStats GetStats() const;
+
+    /// Returns the global allocator of the given category that forwards allocations to the engine raw allocator
+    static CountingMemoryAllocator& GetGlobalAllocator(MEMORY_CATEGORY Category);
+
+private:
+    IMemoryAllocator& GetAllocator() const;
+
+    void OnAllocate(size_t Size);
+    void OnFree(size_t Size);
+
+    IMemoryAllocator* const        m_pAllocator;
+    CountingMemoryAllocator* const m_pParent;
+
+    std::atomic<Uint64> m_LiveBytes{0};
+    std::atomic<Uint64> m_PeakBytes{0};
+    std::atomic<Uint64> m_LiveAllocations{0};
+    std::atomic<Uint64> m_TotalAllocations{0};
+    std::atomic<Uint64> m_TotalAllocatedBytes{0};
+};
+
+/// Counting allocators for all memory categories that forward allocations to the same allocator
+/// and aggregate their statistics into the global allocators of the respective categories.
+class CategoryMemoryAllocators
+{
+public:
+    explicit CategoryMemoryAllocators(IMemoryAllocator& Allocator) noexcept;
+
+    CountingMemoryAllocator& operator[](MEMORY_CATEGORY Category)
+    {
+        return m_Allocators[Category];
+    }
+
+    const CountingMemoryAllocator& operator[](MEMORY_CATEGORY Category) const
+    {
+        return m_Allocators[Category];
+    }
+
+private:
+    std::array<CountingMemoryAllocator, MEMORY_CATEGORY_COUNT> m_Allocators;
+};
+
+} // namespace Diligent
@@ -43,6 +43,13 @@ IMemoryAllocator& GetRawAllocator();
 
 IMemoryAllocator& GetStringAllocator();
 
+/// Returns raw memory allocator that accounts allocations for the given memory category.
+/// Memory must be released through the same allocator it was allocated with.
+IMemoryAllocator& GetRawAllocator(MEMORY_CATEGORY Category);
+
+/// Returns global statistics of the given memory category that include allocations of all render devices
+MemoryCategoryStats GetMemoryCategoryStats(MEMORY_CATEGORY Category);
+
 #define ALLOCATE_RAW(Allocator, Desc, Size)    (Allocator).Allocate(Size, Desc, __FILE__, __LINE__)
 #define ALLOCATE(Allocator, Desc, Type, Count) reinterpret_cast<Type*>(ALLOCATE_RAW(Allocator, Desc, sizeof(Type) * (Count)))
 #define FREE(Allocator, Ptr)                   Allocator.Free(Ptr)
@@ -248,4 +248,55 @@ DstType FilterTexture2DBilinearClampUC(Uint32         Width,
     return FilterTexture2DBilinear<SrcType, DstType, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP, false>(Width, Height, pData, Stride, u, v);
 }
 
+/// Samples 2D texture using bilinear filter at multiple locations.
+///
+/// \tparam SrcType           - Source pixel type.
+/// \tparam DstType           - Destination type.
+/// \tparam AddressModeU      - U coordinate address mode.
+/// \tparam AddressModeV      - V coordinate address mode.
+/// \tparam IsNormalizedCoord - Whether sample coordinates are normalized.
+///
+/// \param [in]  Width        - Texture width.
+/// \param [in]  Height       - Texture height.
+/// \param [in]  pData        - Pointer to the texture data.
+/// \param [in]  Stride       - Data stride, in pixels.
+/// \param [in]  pUVs         - Array of NumSamples sample coordinates.
+/// \param [out] pDst         - Array of NumSamples filtered texture samples.
+/// \param [in]  NumSamples   - The number of samples.
+template <typename SrcType,
+          typename DstType,
+          TEXTURE_ADDRESS_MODE AddressModeU,
+          TEXTURE_ADDRESS_MODE AddressModeV,
+          bool                 IsNormalizedCoord>
+void FilterTexture2DBilinear(Uint32         Width,
+                             Uint32         Height,
+                             const SrcType* pData,
+                             size_t         Stride,
+                             const float2*  pUVs,
+                             DstType*       pDst,
+                             size_t         NumSamples)
+{
+    for (size_t i = 0; i < NumSamples; ++i)
+    {
+        pDst[i] = FilterTexture2DBilinear<SrcType, DstType, AddressModeU, AddressModeV, IsNormalizedCoord>(Width, Height, pData, Stride, pUVs[i].x, pUVs[i].y);
+    }
+}
+
+/// Samples 2D texture at multiple locations using bilinear filter with CLAMP texture address mode
+/// and normalized texture coordinates.
+///
+/// The sample indices and weights are computed for four samples at a time using SSE or NEON.
+/// The results match FilterTexture2DBilinearClamp<SrcType, float>() up to rounding.
+void FilterTexture2DBilinearClamp(Uint32 Width, Uint32 Height, const Uint8* pData, size_t Stride, const float2* pUVs, float* pDst, size_t NumSamples);
+void FilterTexture2DBilinearClamp(Uint32 Width, Uint32 Height, const Uint16* pData, size_t Stride, const float2* pUVs, float* pDst, size_t NumSamples);
+void FilterTexture2DBilinearClamp(Uint32 Width, Uint32 Height, const float* pData, size_t Stride, const float2* pUVs, float* pDst, size_t NumSamples);
+
+/// Samples 2D texture at multiple locations using bilinear filter with CLAMP texture address mode
+/// and unnormalized texture coordinates.
+///
+/// See FilterTexture2DBilinearClamp().
+void FilterTexture2DBilinearClampUC(Uint32 Width, Uint32 Height, const Uint8* pData, size_t Stride, const float2* pUVs, float* pDst, size_t NumSamples);
+void FilterTexture2DBilinearClampUC(Uint32 Width, Uint32 Height, const Uint16* pData, size_t Stride, const float2* pUVs, float* pDst, size_t NumSamples);
+void FilterTexture2DBilinearClampUC(Uint32 Width, Uint32 Height, const float* pData, size_t Stride, const float2* pUVs, float* pDst, size_t NumSamples);
+
 } // namespace Diligent
@@ -44,10 +44,21 @@ namespace Diligent
 {
 
 /// Memory allocator that allocates memory in a fixed-size chunks
+///
+/// \remarks   By default, every allocation and deallocation is serialized on a mutex.
+///            When ThreadCacheSize is not zero, every thread that uses the allocator gets
+///            its own cache (magazine) of up to ThreadCacheSize free blocks. Allocate() and Free()
+///            then only access the calling thread's cache, and the mutex is taken once per
+///            ThreadCacheSize / 2 operations to move a batch of blocks between the cache
+///            and the shared page pool.
+///            Blocks freed by a thread are returned to that thread's cache, regardless of
+///            which thread allocated them.
+///            Caches of the threads that have exited are returned to the page pool the next time
+///            any thread refills or flushes its cache. The allocator destructor returns all caches.
 class FixedBlockMemoryAllocator final : public IMemoryAllocator
 {
 public:
-    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator, size_t BlockSize, Uint32 NumBlocksInPage);
+    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator, size_t BlockSize, Uint32 NumBlocksInPage, Uint32 ThreadCacheSize = 0);
     ~FixedBlockMemoryAllocator();
 
     /// Allocates block of memory
@@ -62,6 +73,38 @@ public:
     /// Releases memory allocated with AllocateAligned
     virtual void FreeAligned(void* Ptr) override final;
 
+    /// Allocator statistics
+    struct Statistics
+    {
+        /// Size of one block, in bytes.
+        size_t BlockSize = 0;
+
+        /// The number of blocks in one page.
+        Uint32 NumBlocksInPage = 0;
+
+        /// The number of memory pages allocated from the raw allocator.
+        size_t NumPages = 0;
+
+        /// The number of blocks currently used by the application.
+        size_t NumAllocatedBlocks = 0;
+
+        /// The number of free blocks currently held in thread caches.
+        size_t NumCachedBlocks = 0;
+
+        /// The maximum number of blocks that have been simultaneously taken from
+        /// the pages, including the blocks held in thread caches.
+        size_t PeakNumBlocks = 0;
+
+        /// The number of threads that have a cache in this allocator.
+        size_t NumThreadCaches = 0;
+    };
+
+    /// Returns the allocator statistics.
+    ///
+    /// \remarks   The statistics are gathered while other threads may be allocating
+    ///            or releasing memory, and are thus only approximate in this case.
+    Statistics GetStatistics() const;
+
 private:
     // clang-format off
     FixedBlockMemoryAllocator             (const FixedBlockMemoryAllocator&) = delete;
@@ -72,6 +115,18 @@ private:
 
     void CreateNewPage();
 
+    // The following methods must be called with m_Mutex locked
+    void* AllocateFromPages();
+    void  FreeToPages(void* Ptr);
+    void  ReclaimOrphanedThreadCaches();
+
+    struct ThreadCache;
+    struct ThreadCacheList;
+
+    ThreadCache& GetThreadCache();
+    void         RefillThreadCache(ThreadCache& Cache);
+    void         FlushThreadCache(ThreadCache& Cache, size_t NumBlocks);
+
     // Memory page class is based on the fixed-size memory pool described in "Fast Efficient Fixed-Size Memory Pool"
     // by Ben Kenwright
     class MemoryPage
@@ -117,11 +172,23 @@ private:
     using AddrToPageIdMapElem = std::pair<void* const, size_t>;
     std::unordered_map<void*, size_t, std::hash<void*>, std::equal_to<void*>, STDAllocatorRawMem<AddrToPageIdMapElem>> m_AddrToPageId;
 
-    std::mutex m_Mutex;
+    // Caches of all threads that have used the allocator. The caches are shared with
+    // the thread-local cache lists, so that either side can outlive the other.
+    std::vector<std::shared_ptr<ThreadCache>> m_ThreadCaches;
+
+    // The maximum number of blocks simultaneously taken from the pages
+    size_t m_PeakNumBlocks = 0;
+
+    mutable std::mutex m_Mutex;
 
     IMemoryAllocator& m_RawMemoryAllocator;
     const size_t      m_BlockSize;
     const Uint32      m_NumBlocksInPage;
+    const Uint32      m_ThreadCacheSize;
+
+    // Unique allocator ID that is used to find the thread's cache.
+    // Unlike the allocator address, the ID is never reused.
+    const Uint64 m_Id;
 };
 
 IMemoryAllocator& GetRawAllocator();
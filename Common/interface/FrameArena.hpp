@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::FrameArena class
+
+#include <vector>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "DynamicLinearAllocator.hpp"
+#include "STDAllocator.hpp"
+
+namespace Diligent
+{
+
+/// Per-thread arena for temporary allocations that do not outlive the current frame.
+
+/// Every thread has its own arena that is built on top of DynamicLinearAllocator.
+/// The arena is accessed through FrameArena::Scope objects:
+///
+///     FrameArena::Scope Arena;
+///     FrameArena::Vector<VkSparseMemoryBind> Binds{Arena.MakeAllocator<VkSparseMemoryBind>()};
+///
+/// Memory is never released to the raw allocator by Free(). Instead, all memory of the arena is
+/// recycled at once when the outermost scope on the thread is entered after FrameArena::FinishFrame()
+/// has been called. Device contexts call FinishFrame() from IDeviceContext::FinishFrame().
+///
+/// \remarks    Memory allocated from the arena must not be accessed after the scope it was allocated in
+///             has been exited and the frame has been finished.
+///             The arena is not thread-safe and must only be used through a scope created by the same thread.
+class FrameArena final : public IMemoryAllocator
+{
+public:
+    template <typename T>
+    using Allocator = STDAllocator<T, FrameArena>;
+
+    template <typename T>
+    using Vector = std::vector<T, Allocator<T>>;
+
+    /// Provides access to the calling thread's arena.
+    class Scope
+    {
+    public:
+        Scope();
+        ~Scope();
+
+        // clang-format off
+        Scope           (const Scope&) = delete;
+        Scope           (Scope&&)      = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&)      = delete;
+        // clang-format on
+
+        FrameArena& GetArena() const { return m_Arena; }
+        operator FrameArena&() const { return m_Arena; }
+
+        template <typename T>
+        Allocator<T> MakeAllocator() const
+        {
+            return Allocator<T>{m_Arena, "FrameArena allocation", __FILE__, __LINE__};
+        }
+
+    private:
+        FrameArena& m_Arena;
+    };
+
+    /// Marks the end of the frame. All thread arenas will be recycled when
+    /// their outermost scope is entered next time.
+    static void FinishFrame();
+
+    /// Allocates block of memory from the arena
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Does nothing - memory is recycled when the frame is finished
+    virtual void Free(void* Ptr) override final {}
+
+    /// Allocates block of memory with specified alignment from the arena
+    virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Does nothing - memory is recycled when the frame is finished
+    virtual void FreeAligned(void* Ptr) override final {}
+
+    /// Returns the number of memory blocks allocated by the arena
+    size_t GetBlockCount() const { return m_Allocator.GetBlockCount(); }
+
+private:
+    FrameArena();
+
+    // clang-format off
+    FrameArena           (const FrameArena&) = delete;
+    FrameArena           (FrameArena&&)      = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+    FrameArena& operator=(FrameArena&&)      = delete;
+    // clang-format on
+
+    static FrameArena& GetThreadArena();
+
+    void EnterScope();
+    void ExitScope();
+
+    DynamicLinearAllocator m_Allocator;
+
+    // The number of scopes currently alive on the thread
+    Uint32 m_ScopeDepth = 0;
+
+    // The global frame ID at the time the arena was last recycled
+    Uint64 m_FrameId = 0;
+};
+
+} // namespace Diligent
@@ -837,7 +837,9 @@ struct HashCombiner<HasherType, SubpassDesc> : HashCombinerBase<HasherType>
         if (Subpass.pShadingRateAttachment)
             this->m_Hasher(*Subpass.pShadingRateAttachment);
 
-        ASSERT_SIZEOF64(Subpass, 72, "Did you add new members to SubpassDesc? Please handle them here.");
+        this->m_Hasher(Subpass.ViewMask);
+
+        ASSERT_SIZEOF64(Subpass, 80, "Did you add new members to SubpassDesc? Please handle them here.");
     }
 };
 
@@ -1127,6 +1129,25 @@ struct HashCombiner<HasherType, Version> : HashCombinerBase<HasherType>
 };
 
 
+template <typename HasherType>
+struct HashCombiner<HasherType, SpecializationConstant> : HashCombinerBase<HasherType>
+{
+    HashCombiner(HasherType& Hasher) :
+        HashCombinerBase<HasherType>{Hasher}
+    {}
+
+    void operator()(const SpecializationConstant& Const) const
+    {
+        this->m_Hasher(
+            Const.Name,
+            Const.ShaderStages,
+            Const.Size);
+        if (Const.pData != nullptr)
+            this->m_Hasher.UpdateRaw(Const.pData, Const.Size);
+        ASSERT_SIZEOF64(Const, 24, "Did you add new members to SpecializationConstant? Please handle them here.");
+    }
+};
+
 template <typename HasherType>
 struct HashCombiner<HasherType, PipelineStateCreateInfo> : HashCombinerBase<HasherType>
 {
@@ -1154,6 +1175,13 @@ struct HashCombiner<HasherType, PipelineStateCreateInfo> : HashCombinerBase<Hash
         {
             VERIFY_EXPR(CI.ResourceSignaturesCount == 0);
         }
+
+        this->m_Hasher(CI.NumSpecializationConstants);
+        if (CI.pSpecializationConstants != nullptr)
+        {
+            for (size_t i = 0; i < CI.NumSpecializationConstants; ++i)
+                this->m_Hasher(CI.pSpecializationConstants[i]);
+        }
     }
 };
 
@@ -1405,6 +1433,7 @@ DEFINE_HASH(Diligent::PipelineStateDesc);
 DEFINE_HASH(Diligent::PipelineResourceSignatureDesc);
 DEFINE_HASH(Diligent::ShaderDesc);
 DEFINE_HASH(Diligent::Version);
+DEFINE_HASH(Diligent::SpecializationConstant);
 DEFINE_HASH(Diligent::PipelineStateCreateInfo);
 DEFINE_HASH(Diligent::GraphicsPipelineStateCreateInfo);
 DEFINE_HASH(Diligent::ComputePipelineStateCreateInfo);
@@ -30,6 +30,7 @@
 /// Image processing tools
 
 #include "../../Primitives/interface/BasicTypes.h"
+#include "ThreadPool.h"
 
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
@@ -100,6 +101,20 @@ struct ComputeImageDifferenceAttribs
 
     /// Scale factor for the difference image
     float Scale DEFAULT_INITIALIZER(1.f);
+
+    /// If not zero, the function stops comparing the images as soon as the number of pixels
+    /// that differ above the threshold reaches this value.
+
+    /// This mode is intended for pass/fail comparisons. When the function stops early,
+    /// the image difference information and the difference image only cover the rows that
+    /// have been processed. Rows are the unit of work, so the reported number of pixels
+    /// above the threshold may exceed this value.
+    Uint32 EarlyExitPixelCount DEFAULT_INITIALIZER(0);
+
+    /// An optional thread pool to compare the image rows in parallel.
+
+    /// If null, the images are compared on the calling thread.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
 };
 typedef struct ComputeImageDifferenceAttribs ComputeImageDifferenceAttribs;
 
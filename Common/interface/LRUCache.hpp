@@ -19,6 +19,7 @@
 
 #include <unordered_map>
 #include <deque>
+#include <array>
 #include <mutex>
 #include <memory>
 #include <algorithm>
@@ -349,4 +350,85 @@ private:
     std::atomic<size_t> m_MaxSize{0};
 };
 
+
+/// A thread-safe LRU cache that is split into NumShards independent shards.
+
+/// Every key is assigned to one of the shards based on its hash. Each shard is a
+/// separate LRUCache with its own mutex and LRU queue, so concurrent requests for
+/// keys that map to different shards never contend. The maximum cache size is evenly
+/// split between the shards, and the least-recently used items are evicted per shard.
+///
+/// The interface and the data initialization guarantees are the same as in LRUCache.
+template <typename KeyType, typename DataType, typename KeyHasher = std::hash<KeyType>, size_t NumShards = 16>
+class ShardedLRUCache
+{
+public:
+    static_assert(NumShards > 0, "The number of shards must be greater than zero");
+
+    ShardedLRUCache() noexcept
+    {}
+
+    explicit ShardedLRUCache(size_t MaxSize) noexcept
+    {
+        SetMaxSize(MaxSize);
+    }
+
+    /// Finds the data in the cache and returns it. If the data is not found, it is atomically created
+    /// using the provided initializer. See LRUCache::Get().
+    template <typename InitDataType>
+    DataType Get(const KeyType& Key,
+                 InitDataType&& InitData // May throw
+                 ) noexcept(false)
+    {
+        return GetShard(Key).Get(Key, std::forward<InitDataType>(InitData));
+    }
+
+    /// Sets the maximum cache size.
+
+    /// The size is evenly split between the shards, so every shard may hold at
+    /// most (MaxSize + NumShards - 1) / NumShards units.
+    void SetMaxSize(size_t MaxSize)
+    {
+        const size_t MaxShardSize = MaxSize / NumShards + (MaxSize % NumShards != 0 ? 1 : 0);
+        for (Shard& S : m_Shards)
+            S.Cache.SetMaxSize(MaxShardSize);
+    }
+
+    /// Returns the current cache size, which is the total size of all shards.
+    size_t GetCurrSize() const
+    {
+        size_t CurrSize = 0;
+        for (const Shard& S : m_Shards)
+            CurrSize += S.Cache.GetCurrSize();
+        return CurrSize;
+    }
+
+    /// Returns the number of shards.
+    static constexpr size_t GetNumShards()
+    {
+        return NumShards;
+    }
+
+private:
+    using CacheType = LRUCache<KeyType, DataType, KeyHasher>;
+
+    CacheType& GetShard(const KeyType& Key)
+    {
+        // Shuffle the hash bits so that the shard index does not correlate with
+        // the bucket index in the shard's hash map, and that trivial hashes
+        // (e.g. std::hash<int>) are spread evenly.
+        const Uint64 Hash = static_cast<Uint64>(m_Hasher(Key)) * Uint64{0x9E3779B97F4A7C15};
+        return m_Shards[static_cast<size_t>(Hash >> 32) % NumShards].Cache;
+    }
+
+    // Put every shard on its own cache line to avoid false sharing of the mutexes
+    struct alignas(64) Shard
+    {
+        CacheType Cache;
+    };
+    std::array<Shard, NumShards> m_Shards;
+
+    KeyHasher m_Hasher;
+};
+
 } // namespace Diligent
@@ -0,0 +1,96 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// LZ4 block compression utilities
+
+#include <vector>
+#include <utility>
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// The maximum size of the dictionary that can be referenced by LZ4 compressed data.
+static constexpr size_t LZ4MaxDictionarySize = 65536;
+
+/// Returns the maximum size of the compressed data for the given source data size.
+size_t LZ4GetMaxCompressedSize(size_t SrcSize);
+
+/// Compresses the data using the LZ4 block format.
+
+/// \param [in]  pSrc        - Pointer to the source data.
+/// \param [in]  SrcSize     - Source data size, in bytes.
+/// \param [out] pDst        - Pointer to the destination buffer.
+/// \param [in]  DstCapacity - Destination buffer size, in bytes.
+/// \param [in]  pDict       - Optional dictionary that will be used to find matches.
+///                            Only the last LZ4MaxDictionarySize bytes of the dictionary are used.
+/// \param [in]  DictSize    - Dictionary size, in bytes.
+///
+/// \return     The size of the compressed data, or zero if the data did not fit into the destination buffer.
+///
+/// \remarks    The same dictionary must be provided to LZ4DecompressBlock() to decompress the data.
+size_t LZ4CompressBlock(const void* pSrc,
+                        size_t      SrcSize,
+                        void*       pDst,
+                        size_t      DstCapacity,
+                        const void* pDict    = nullptr,
+                        size_t      DictSize = 0);
+
+/// Decompresses the data compressed with LZ4CompressBlock().
+
+/// \param [in]  pSrc     - Pointer to the compressed data.
+/// \param [in]  SrcSize  - Compressed data size, in bytes.
+/// \param [out] pDst     - Pointer to the destination buffer.
+/// \param [in]  DstSize  - The size of the decompressed data, in bytes.
+/// \param [in]  pDict    - Dictionary that was used to compress the data.
+/// \param [in]  DictSize - Dictionary size, in bytes.
+///
+/// \return     true if exactly DstSize bytes were decompressed, and false if the
+///             compressed data is invalid.
+bool LZ4DecompressBlock(const void* pSrc,
+                        size_t      SrcSize,
+                        void*       pDst,
+                        size_t      DstSize,
+                        const void* pDict    = nullptr,
+                        size_t      DictSize = 0);
+
+/// Builds a dictionary for LZ4CompressBlock() from the sample data.
+
+/// \param [in] Samples     - Array of sample data pointers and sizes.
+/// \param [in] MaxDictSize - The maximum dictionary size. The value is clamped to LZ4MaxDictionarySize.
+///
+/// \return     The dictionary data. The dictionary is composed of the data segments that occur in
+///             the largest number of samples. The most common segments are placed at the end of
+///             the dictionary.
+std::vector<Uint8> LZ4TrainDictionary(const std::vector<std::pair<const void*, size_t>>& Samples,
+                                      size_t                                             MaxDictSize = LZ4MaxDictionarySize);
+
+} // namespace Diligent
@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::LargePageMemoryAllocator class
+
+#include <mutex>
+#include <unordered_map>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+
+namespace Diligent
+{
+
+/// Large page memory allocator create info
+struct LargePageMemoryAllocatorCreateInfo
+{
+    /// Allocations of this size and larger are served directly from virtual memory.
+    /// Smaller allocations are forwarded to the fallback allocator.
+    size_t MinVirtualAllocationSize = size_t{64} << 10;
+
+    /// Whether to back virtual memory allocations with large pages when they are available.
+    bool UseLargePages = true;
+
+    /// NUMA node (see CPUProcessorInfo::NUMANode) to place the memory on.
+    /// ~0u places every allocation on the node of the calling thread.
+    Uint32 NUMANode = ~0u;
+
+    /// Allocator for small allocations and for allocations with alignment
+    /// greater than the page size. If null, DefaultRawMemoryAllocator is used.
+    IMemoryAllocator* pFallbackAllocator = nullptr;
+};
+
+/// Raw memory allocator that backs large allocations with large pages and NUMA-local memory.
+
+/// The allocator may be installed as the engine raw allocator through IEngineFactory::SetMemoryAllocator,
+/// or passed to DynamicLinearAllocator and FixedBlockMemoryAllocator, whose blocks and pages
+/// are then allocated from large pages. When NUMANode is ~0u, memory is placed on the node of the
+/// thread that makes the allocation, so that per-session allocations made by a render thread
+/// stay local to that thread.
+///
+/// \remarks    Large pages require the huge page pool to be configured on Linux
+///             and the SeLockMemoryPrivilege on Windows. If they are not available,
+///             the allocator silently falls back to normal pages.
+class LargePageMemoryAllocator final : public IMemoryAllocator
+{
+public:
+    explicit LargePageMemoryAllocator(const LargePageMemoryAllocatorCreateInfo& CI = {});
+    ~LargePageMemoryAllocator();
+
+    // clang-format off
+    LargePageMemoryAllocator           (const LargePageMemoryAllocator&) = delete;
+    LargePageMemoryAllocator           (LargePageMemoryAllocator&&)      = delete;
+    LargePageMemoryAllocator& operator=(const LargePageMemoryAllocator&) = delete;
+    LargePageMemoryAllocator& operator=(LargePageMemoryAllocator&&)      = delete;
+    // clang-format on
+
+    /// Allocates block of memory
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory
+    virtual void Free(void* Ptr) override final;
+
+    /// Allocates block of memory with specified alignment
+    virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory allocated with AllocateAligned
+    virtual void FreeAligned(void* Ptr) override final;
+
+    /// Returns the total size of the memory that is currently backed by large pages
+    size_t GetLargePageMemorySize() const;
+
+    /// Returns the total size of the memory that is currently allocated from virtual memory
+    size_t GetVirtualMemorySize() const;
+
+private:
+    void* AllocateVirtual(size_t Size);
+    bool  FreeVirtual(void* Ptr);
+
+    struct VirtualAllocation
+    {
+        size_t Size       = 0;
+        bool   LargePages = false;
+    };
+
+    const size_t      m_MinVirtualAllocationSize;
+    const size_t      m_LargePageSize;
+    const Uint32      m_NUMANode;
+    IMemoryAllocator& m_FallbackAllocator;
+
+    mutable std::mutex                           m_Mtx;
+    std::unordered_map<void*, VirtualAllocation> m_VirtualAllocations;
+    size_t                                       m_VirtualMemorySize   = 0;
+    size_t                                       m_LargePageMemorySize = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Implementation of the MappedFileStream class
+
+#include <memory>
+
+#include "../../Primitives/interface/FileStream.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "../../Platforms/interface/FileSystem.hpp"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Read-only file stream backed by a memory-mapped file
+
+/// The file is mapped with mmap on POSIX platforms, MapViewOfFile on Win32, and
+/// AAsset_getBuffer for Android assets. Use GetDataBlob() to access the file contents
+/// without copying, e.g. to load a device object archive:
+///
+///     auto pStream = MappedFileStream::Create("Archive.bin");
+///     pDearchiver->LoadArchive(pStream->GetDataBlob(), ContentVersion, /*MakeCopy = */ false);
+class MappedFileStream final : public ObjectBase<IFileStream>
+{
+public:
+    typedef ObjectBase<IFileStream> TBase;
+
+    /// Maps the file and creates the stream. Returns null if the file could not be mapped.
+    static RefCntAutoPtr<MappedFileStream> Create(const Char* Path);
+
+    MappedFileStream(IReferenceCounters*           pRefCounters,
+                     std::unique_ptr<MappedFile>&& pMappedFile);
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
+
+    /// Reads data from the stream
+    virtual void DILIGENT_CALL_TYPE ReadBlob(IDataBlob* pData) override final;
+
+    /// Reads data from the stream
+    virtual bool DILIGENT_CALL_TYPE Read(void* Data, size_t Size) override final;
+
+    /// Writing is not supported by memory-mapped streams
+    virtual bool DILIGENT_CALL_TYPE Write(const void* Data, size_t Size) override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetPos() override final;
+
+    virtual bool DILIGENT_CALL_TYPE SetPos(size_t Offset, int Origin) override final;
+
+    virtual bool DILIGENT_CALL_TYPE IsValid() override final;
+
+    /// Returns the pointer to the mapped file data
+    const void* GetData() const { return m_pMappedFile->GetData(); }
+
+    /// Returns a read-only data blob that references the mapped file data.
+    /// The blob keeps the stream, and thus the mapping, alive.
+    RefCntAutoPtr<IDataBlob> GetDataBlob();
+
+private:
+    std::unique_ptr<MappedFile> m_pMappedFile;
+    size_t                      m_CurrentOffset = 0;
+};
+
+} // namespace Diligent
@@ -18,7 +18,9 @@
 #pragma once
 
 #include <unordered_map>
+#include <array>
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
 #include <algorithm>
 #include <atomic>
@@ -107,13 +109,21 @@ auto _IsWeakPtrExpired(std::weak_ptr<T>& pWeakPtr)
 ///
 /// It is guaranteed, that the Object will only be initialized once, even if multiple threads call Get() simultaneously.
 ///
+/// The registry is split into NumShards independent shards selected by the key hash. Each shard is protected
+/// by its own shared mutex. Looking up an object that exists and is alive only takes the shared lock, so
+/// concurrent lookups never block each other. The exclusive lock is only taken when an object is inserted,
+/// or when expired entries are removed.
+///
 template <typename KeyType,
           typename StrongPtrType,
           typename KeyHasher = std::hash<KeyType>,
-          typename KeyEqual  = std::equal_to<KeyType>>
+          typename KeyEqual  = std::equal_to<KeyType>,
+          size_t NumShards   = 1>
 class ObjectsRegistry
 {
 public:
+    static_assert(NumShards > 0, "The number of shards must be greater than zero");
+
     using WeakPtrType = typename _StrongPtrHelper<StrongPtrType>::WeakPtrType;
 
     explicit ObjectsRegistry(Uint32 NumRequestsToPurge = 1024) noexcept :
@@ -140,16 +150,22 @@ public:
                       CreateObjectType&& CreateObject // May throw
                       ) noexcept(false)
     {
+        Shard& S = GetShard(Key);
+
+        // Fast path: the object exists and is alive
+        if (StrongPtrType pObject = FindAlive(S, Key))
+            return pObject;
+
         // Get the Object wrapper. Since this is a shared pointer, it may not be destroyed
         // while we keep one, even if it is popped from the registry by another thread.
         std::shared_ptr<ObjectWrapper> pObjectWrpr;
         {
-            std::lock_guard<std::mutex> Guard{m_CacheMtx};
+            std::unique_lock<std::shared_timed_mutex> Guard{S.Mtx};
 
-            auto it = m_Cache.find(Key);
-            if (it == m_Cache.end())
+            auto it = S.Cache.find(Key);
+            if (it == S.Cache.end())
             {
-                it = m_Cache.emplace(Key, std::make_shared<ObjectWrapper>()).first;
+                it = S.Cache.emplace(Key, std::make_shared<ObjectWrapper>()).first;
             }
             pObjectWrpr = it->second;
         }
@@ -161,20 +177,24 @@ public:
         }
         catch (...)
         {
-            std::lock_guard<std::mutex> Guard{m_CacheMtx};
+            std::unique_lock<std::shared_timed_mutex> Guard{S.Mtx};
 
-            auto it = m_Cache.find(Key);
-            if (it != m_Cache.end())
+            auto it = S.Cache.find(Key);
+            if (it != S.Cache.end())
             {
-                pObject = it->second->Lock();
-                if (pObject)
+                // NB: the object may be being created by another thread that holds the wrapper lock.
+                //     In this case, the entry must be kept in the registry.
+                if (it->second->TryLock(pObject))
                 {
-                    // The object was created by another thread while we were waiting for the lock
-                    return pObject;
-                }
-                else
-                {
-                    m_Cache.erase(it);
+                    if (pObject)
+                    {
+                        // The object was created by another thread while we were waiting for the lock
+                        return pObject;
+                    }
+                    else
+                    {
+                        S.Cache.erase(it);
+                    }
                 }
             }
 
@@ -182,31 +202,30 @@ public:
         }
 
         {
-            std::lock_guard<std::mutex> Guard{m_CacheMtx};
+            std::unique_lock<std::shared_timed_mutex> Guard{S.Mtx};
 
-            auto it = m_Cache.find(Key);
+            auto it = S.Cache.find(Key);
             if (pObject)
             {
-                if (it == m_Cache.end())
+                if (it == S.Cache.end())
                 {
                     // The wrapper was removed from the cache by another thread while we were waiting
                     // for the lock - add it back.
-                    m_Cache.emplace(Key, pObjectWrpr);
+                    S.Cache.emplace(Key, pObjectWrpr);
                 }
             }
             else
             {
-                if (it != m_Cache.end())
+                if (it != S.Cache.end())
                 {
-                    pObject = it->second->Lock();
                     // Note that the object may have been created by another thread while we were waiting for the lock
-                    if (!pObject)
-                        m_Cache.erase(it);
+                    if (it->second->TryLock(pObject) && !pObject)
+                        S.Cache.erase(it);
                 }
             }
 
-            if (m_NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurge)
-                PurgeUnguarded();
+            if (S.NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurge)
+                PurgeUnguarded(S);
         }
 
         return pObject;
@@ -221,20 +240,28 @@ public:
     /// or empty pointer otherwise.
     StrongPtrType Get(const KeyType& Key)
     {
-        std::lock_guard<std::mutex> Guard{m_CacheMtx};
+        Shard& S = GetShard(Key);
+
+        // Fast path: the object exists and is alive
+        if (StrongPtrType pObject = FindAlive(S, Key))
+            return pObject;
 
-        if (m_NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurge)
-            PurgeUnguarded();
+        std::unique_lock<std::shared_timed_mutex> Guard{S.Mtx};
 
-        auto it = m_Cache.find(Key);
-        if (it != m_Cache.end())
+        if (S.NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurge)
+            PurgeUnguarded(S);
+
+        auto it = S.Cache.find(Key);
+        if (it != S.Cache.end())
         {
-            auto pObject = it->second->Lock();
-            if (!pObject)
+            StrongPtrType pObject;
+            // If the object is being created by another thread, TryLock() fails and
+            // the entry is kept in the registry.
+            if (it->second->TryLock(pObject) && !pObject)
             {
                 // Note that we may remove the entry from the cache while another thread is creating the object.
                 // This is OK as it will be added back to the cache.
-                m_Cache.erase(it);
+                S.Cache.erase(it);
             }
 
             return pObject;
@@ -246,20 +273,27 @@ public:
     /// Removes all expired pointers from the cache
     void Purge()
     {
-        std::lock_guard<std::mutex> Guard{m_CacheMtx};
-        PurgeUnguarded();
+        for (Shard& S : m_Shards)
+        {
+            std::unique_lock<std::shared_timed_mutex> Guard{S.Mtx};
+            PurgeUnguarded(S);
+        }
     }
 
     /// Processes each element in the cache with the specified handler.
     template <typename HandlerType>
     void ProcessElements(HandlerType&& Handler)
     {
-        std::lock_guard<std::mutex> Guard{m_CacheMtx};
-        for (auto& Entry : m_Cache)
+        for (Shard& S : m_Shards)
         {
-            if (auto pObject = Entry.second->Lock())
+            std::shared_lock<std::shared_timed_mutex> Guard{S.Mtx};
+            for (auto& Entry : S.Cache)
             {
-                Handler(Entry.first, *pObject);
+                StrongPtrType pObject;
+                if (Entry.second->TryLock(pObject) && pObject)
+                {
+                    Handler(Entry.first, *pObject);
+                }
             }
         }
     }
@@ -267,9 +301,12 @@ public:
     /// Removes all objects from the cache.
     void Clear()
     {
-        std::lock_guard<std::mutex> Guard{m_CacheMtx};
-        m_Cache.clear();
-        m_NumRequestsSinceLastPurge.store(0);
+        for (Shard& S : m_Shards)
+        {
+            std::unique_lock<std::shared_timed_mutex> Guard{S.Mtx};
+            S.Cache.clear();
+            S.NumRequestsSinceLastPurge.store(0);
+        }
     }
 
 private:
@@ -281,7 +318,12 @@ private:
         {
             StrongPtrType pObject;
 
-            std::lock_guard<std::mutex> Guard{m_CreateObjectMtx};
+            // Only take the exclusive lock if the object needs to be created, so that
+            // TryLock() fails only when the object is actually being created.
+            if (TryLock(pObject) && pObject)
+                return pObject;
+
+            std::unique_lock<std::shared_timed_mutex> Guard{m_Mtx};
             pObject = _LockWeakPtr(m_wpObject);
             if (!pObject)
             {
@@ -292,28 +334,75 @@ private:
             return pObject;
         }
 
-        StrongPtrType Lock()
+        /// Attempts to obtain a strong reference to the object.
+        /// Returns false if the object is currently being created by another thread.
+        bool TryLock(StrongPtrType& pObject)
         {
-            return _LockWeakPtr(m_wpObject);
+            WeakPtrType wpObject;
+            {
+                std::shared_lock<std::shared_timed_mutex> Guard{m_Mtx, std::try_to_lock};
+                if (!Guard.owns_lock())
+                    return false;
+
+                // NB: locking RefCntWeakPtr modifies it if the object has expired, so
+                //     make a copy to allow multiple threads to lock the pointer at the same time.
+                wpObject = m_wpObject;
+            }
+            pObject = _LockWeakPtr(wpObject);
+            return true;
         }
 
         bool IsExpired()
         {
-            return _IsWeakPtrExpired(m_wpObject);
+            std::shared_lock<std::shared_timed_mutex> Guard{m_Mtx, std::try_to_lock};
+            // If the lock can't be acquired, the object is being created
+            return Guard.owns_lock() && _IsWeakPtrExpired(m_wpObject);
         }
 
     private:
-        std::mutex  m_CreateObjectMtx;
-        WeakPtrType m_wpObject;
+        std::shared_timed_mutex m_Mtx;
+        WeakPtrType             m_wpObject;
+    };
+
+    using CacheType = std::unordered_map<KeyType, std::shared_ptr<ObjectWrapper>, KeyHasher, KeyEqual>;
+
+    // Only pad the shards to the cache line size when there are multiple shards, so that
+    // a single-shard registry does not require over-aligned allocation of its owner.
+    struct alignas(NumShards > 1 ? 64 : alignof(std::shared_timed_mutex)) Shard
+    {
+        std::shared_timed_mutex Mtx;
+        CacheType               Cache;
+
+        std::atomic<Uint32> NumRequestsSinceLastPurge{0};
     };
 
-    void PurgeUnguarded()
+    Shard& GetShard(const KeyType& Key)
+    {
+        // Shuffle the hash bits to decorrelate the shard index from the bucket index in the shard's map
+        const Uint64 Hash = static_cast<Uint64>(KeyHasher{}(Key)) * Uint64{0x9E3779B97F4A7C15};
+        return m_Shards[static_cast<size_t>(Hash >> 32) % NumShards];
+    }
+
+    StrongPtrType FindAlive(Shard& S, const KeyType& Key)
     {
-        for (auto it = m_Cache.begin(); it != m_Cache.end();)
+        std::shared_lock<std::shared_timed_mutex> Guard{S.Mtx};
+
+        auto it = S.Cache.find(Key);
+        if (it == S.Cache.end())
+            return {};
+
+        StrongPtrType pObject;
+        it->second->TryLock(pObject);
+        return pObject;
+    }
+
+    void PurgeUnguarded(Shard& S)
+    {
+        for (auto it = S.Cache.begin(); it != S.Cache.end();)
         {
             if (it->second->IsExpired())
             {
-                it = m_Cache.erase(it);
+                it = S.Cache.erase(it);
             }
             else
             {
@@ -321,18 +410,13 @@ private:
             }
         }
 
-        m_NumRequestsSinceLastPurge.store(0);
+        S.NumRequestsSinceLastPurge.store(0);
     }
 
 private:
-    using CacheType = std::unordered_map<KeyType, std::shared_ptr<ObjectWrapper>, KeyHasher, KeyEqual>;
-
     const Uint32 m_NumRequestsToPurge;
 
-    std::atomic<Uint32> m_NumRequestsSinceLastPurge{0};
-
-    std::mutex m_CacheMtx;
-    CacheType  m_Cache;
+    std::array<Shard, NumShards> m_Shards;
 };
 
 } // namespace Diligent
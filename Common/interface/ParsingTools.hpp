@@ -34,6 +34,7 @@
 #include <limits>
 #include <vector>
 #include <algorithm>
+#include <utility>
 
 #include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/FlagEnum.h"
@@ -458,6 +459,30 @@ IteratorType ParseInteger(const IteratorType& Start, const IteratorType& End, Va
     return Pos;
 }
 
+/// Splits string into chunks using the custom function to skip comments and delimiters.
+///
+/// \param [in] Start          - start of the string to split.
+/// \param [in] End            - end of the string to split.
+/// \param [in] Handler        - user-provided handler to call for each chunk.
+/// \param [in] SkipDelimiters - function that skips comments and delimiters, see SkipDelimitersAndComments.
+///                              It is called with the current position and the end of the string and must
+///                              return the position of the first non-comment non-delimiter character.
+template <typename IteratorType, typename HandlerType, typename SkipDelimitersFuncType>
+void SplitString(const IteratorType& Start, const IteratorType& End, HandlerType&& Handler, SkipDelimitersFuncType&& SkipDelimiters) noexcept(false)
+{
+    auto Pos = Start;
+    while (Pos != End)
+    {
+        auto DelimStart = Pos;
+        Pos             = SkipDelimiters(Pos, End); // May throw
+        auto OrigPos    = Pos;
+        if (!Handler(DelimStart, Pos))
+            break;
+        VERIFY(Pos == End || OrigPos != Pos, "Position has not been updated by the handler.");
+    }
+}
+
+
 /// Splits string into chunks separated by comments and delimiters.
 ///
 /// \param [in] Start   - start of the string to split.
@@ -477,16 +502,9 @@ IteratorType ParseInteger(const IteratorType& Start, const IteratorType& End, Va
 template <typename IteratorType, typename HandlerType>
 void SplitString(const IteratorType& Start, const IteratorType& End, HandlerType&& Handler) noexcept(false)
 {
-    auto Pos = Start;
-    while (Pos != End)
-    {
-        auto DelimStart = Pos;
-        Pos             = SkipDelimitersAndComments(Pos, End); // May throw
-        auto OrigPos    = Pos;
-        if (!Handler(DelimStart, Pos))
-            break;
-        VERIFY(Pos == End || OrigPos != Pos, "Position has not been updated by the handler.");
-    }
+    SplitString(Start, End, std::forward<HandlerType>(Handler), [](const IteratorType& Pos, const IteratorType& StrEnd) {
+        return SkipDelimitersAndComments(Pos, StrEnd);
+    });
 }
 
 
@@ -565,14 +583,17 @@ std::string GetContext(const IteratorType& Start, const IteratorType& End, Itera
 }
 
 
-/// Tokenizes the given string using the C-language syntax
+/// Tokenizes the given string using the C-language syntax and the custom
+/// function to skip comments and delimiters.
 
-/// \param [in] SourceStart  - start of the source string.
-/// \param [in] SourceEnd    - end of the source string.
-/// \param [in] CreateToken  - a handler called every time a new token should
-///                            be created.
-/// \param [in] GetTokenType - a function that should return the token type
-///                            for the given literal.
+/// \param [in] SourceStart    - start of the source string.
+/// \param [in] SourceEnd      - end of the source string.
+/// \param [in] CreateToken    - a handler called every time a new token should
+///                              be created.
+/// \param [in] GetTokenType   - a function that should return the token type
+///                              for the given literal.
+/// \param [in] SkipDelimiters - a function that skips comments and delimiters,
+///                              see SplitString.
 /// \return     Tokenized representation of the source string
 ///
 /// \remarks    In case of a parsing error, the function throws std::runtime_error.
@@ -580,11 +601,13 @@ template <typename TokenClass,
           typename ContainerType,
           typename IteratorType,
           typename CreateTokenFuncType,
-          typename GetTokenTypeFunctType>
-ContainerType Tokenize(const IteratorType&   SourceStart,
-                       const IteratorType&   SourceEnd,
-                       CreateTokenFuncType   CreateToken,
-                       GetTokenTypeFunctType GetTokenType) noexcept(false)
+          typename GetTokenTypeFunctType,
+          typename SkipDelimitersFuncType>
+ContainerType Tokenize(const IteratorType&    SourceStart,
+                       const IteratorType&    SourceEnd,
+                       CreateTokenFuncType    CreateToken,
+                       GetTokenTypeFunctType  GetTokenType,
+                       SkipDelimitersFuncType SkipDelimiters) noexcept(false)
 {
     using TokenType = typename TokenClass::TokenType;
 
@@ -797,8 +820,8 @@ ContainerType Tokenize(const IteratorType&   SourceStart,
 
             Tokens.push_back(CreateToken(Type, DelimStart, DelimEnd, LiteralStart, LiteralEnd));
             return Pos != SourceEnd;
-        } //
-        );
+        },
+        SkipDelimiters);
 #undef SINGLE_CHAR_TOKEN
     }
     catch (const std::pair<IteratorType, const char*>& ErrInfo)
@@ -811,6 +834,33 @@ ContainerType Tokenize(const IteratorType&   SourceStart,
     return Tokens;
 }
 
+/// Tokenizes the given string using the C-language syntax
+
+/// \param [in] SourceStart  - start of the source string.
+/// \param [in] SourceEnd    - end of the source string.
+/// \param [in] CreateToken  - a handler called every time a new token should
+///                            be created.
+/// \param [in] GetTokenType - a function that should return the token type
+///                            for the given literal.
+/// \return     Tokenized representation of the source string
+///
+/// \remarks    In case of a parsing error, the function throws std::runtime_error.
+template <typename TokenClass,
+          typename ContainerType,
+          typename IteratorType,
+          typename CreateTokenFuncType,
+          typename GetTokenTypeFunctType>
+ContainerType Tokenize(const IteratorType&   SourceStart,
+                       const IteratorType&   SourceEnd,
+                       CreateTokenFuncType   CreateToken,
+                       GetTokenTypeFunctType GetTokenType) noexcept(false)
+{
+    return Tokenize<TokenClass, ContainerType>(SourceStart, SourceEnd, std::move(CreateToken), std::move(GetTokenType),
+                                               [](const IteratorType& Pos, const IteratorType& End) {
+                                                   return SkipDelimitersAndComments(Pos, End);
+                                               });
+}
+
 template <typename TokenClass>
 std::ostream& WriteToken(std::ostream& stream, const TokenClass& Token)
 {
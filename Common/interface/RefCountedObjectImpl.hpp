@@ -32,6 +32,10 @@
 
 #include <stdlib.h>
 #include <atomic>
+#include <mutex>
+#ifdef DILIGENT_DEBUG
+#    include <thread>
+#endif
 
 #include "../../Primitives/interface/Object.h"
 #include "../../Primitives/interface/MemoryAllocator.h"
@@ -42,6 +46,39 @@
 namespace Diligent
 {
 
+/// Reference counting mode of an object
+enum class RefCountingMode : Uint8
+{
+    /// Reference counters are updated with atomic operations, and
+    /// references to the object may be added and released by any thread.
+    Atomic,
+
+    /// Reference counters are updated with plain loads and stores, and weak
+    /// reference bookkeeping does not take the lock. All strong and weak
+    /// references to the object must be added and released by the same thread.
+    /// This mode is intended for short-lived objects that never leave the thread
+    /// they were created in.
+    SingleThreaded
+};
+
+/// Defines the reference counting mode of objects of the given type.
+///
+/// Specialize this template to use single-threaded reference counting for a type:
+///
+///     template <>
+///     struct RefCountingModeTraits<MyTransientObject>
+///     {
+///         static constexpr RefCountingMode Mode = RefCountingMode::SingleThreaded;
+///     };
+///
+/// The mode is selected when the object is created by MakeNewRCObj. Objects that
+/// share reference counters with their owner use the owner's mode.
+template <typename ObjectType>
+struct RefCountingModeTraits
+{
+    static constexpr RefCountingMode Mode = RefCountingMode::Atomic;
+};
+
 // This class controls the lifetime of a refcounted object
 // NB: RefCountersImpl can't be final, see https://github.com/DiligentGraphics/DiligentCore/issues/704.
 class RefCountersImpl : public IReferenceCounters
@@ -51,7 +88,7 @@ public:
     {
         VERIFY(m_ObjectState.load() == ObjectState::Alive, "Attempting to increment strong reference counter for a destroyed or not initialized object!");
         VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
-        return m_NumStrongReferences.fetch_add(+1) + 1;
+        return UpdateCounter(m_NumStrongReferences, +1);
     }
 
     template <class TPreObjectDestroy>
@@ -61,7 +98,7 @@ public:
         VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
 
         // Decrement strong reference counter without acquiring the lock.
-        const ReferenceCounterValueType RefCount = m_NumStrongReferences.fetch_add(-1) - 1;
+        const ReferenceCounterValueType RefCount = UpdateCounter(m_NumStrongReferences, -1);
         VERIFY(RefCount >= 0, "Inconsistent call to ReleaseStrongRef()");
         if (RefCount == 0)
         {
@@ -79,19 +116,19 @@ public:
 
     inline virtual ReferenceCounterValueType AddWeakRef() override final
     {
-        return m_NumWeakReferences.fetch_add(+1) + 1;
+        return UpdateCounter(m_NumWeakReferences, +1);
     }
 
     inline virtual ReferenceCounterValueType ReleaseWeakRef() override final
     {
         // The method must be serialized!
-        std::unique_lock<Threading::SpinLock> Guard{m_Lock};
+        std::unique_lock<Threading::SpinLock> Guard = LockIfAtomic();
 
         // It is essentially important to check the number of weak references
         // while holding the lock. Otherwise reference counters object
         // may be destroyed twice if ReleaseStrongRef() is executed by other
         // thread.
-        const ReferenceCounterValueType NumWeakReferences = m_NumWeakReferences.fetch_add(-1) - 1;
+        const ReferenceCounterValueType NumWeakReferences = UpdateCounter(m_NumWeakReferences, -1);
         VERIFY(NumWeakReferences >= 0, "Inconsistent call to ReleaseWeakRef()");
 
         // There are two special case when we must not destroy the ref counters object even
@@ -149,7 +186,8 @@ public:
             // We can safely unlock it and destroy.
             // If we do not unlock it, this->m_LockFlag will expire,
             // which will cause Lock.~LockHelper() to crash.
-            Guard.unlock();
+            if (Guard.owns_lock())
+                Guard.unlock();
             SelfDestroy();
         }
         return NumWeakReferences;
@@ -176,9 +214,9 @@ public:
         //    Destroy the object               |                                   | -Return reference to the soon
         //                                     |                                   |  to expire object
         //
-        Threading::SpinLockGuard Guard{m_Lock};
+        std::unique_lock<Threading::SpinLock> Guard = LockIfAtomic();
 
-        const ReferenceCounterValueType StrongRefCnt = m_NumStrongReferences.fetch_add(+1) + 1;
+        const ReferenceCounterValueType StrongRefCnt = UpdateCounter(m_NumStrongReferences, +1);
 
         // Checking if m_ObjectState == ObjectState::Alive only is not reliable:
         //
@@ -203,7 +241,7 @@ public:
             ObjectWrapperBase* pWrapper = reinterpret_cast<ObjectWrapperBase*>(m_ObjectWrapperBuffer);
             pWrapper->QueryInterface(IID_Unknown, ppObject);
         }
-        m_NumStrongReferences.fetch_add(-1);
+        UpdateCounter(m_NumStrongReferences, -1);
     }
 
     inline virtual ReferenceCounterValueType GetNumStrongRefs() const override final
@@ -220,8 +258,30 @@ private:
     template <typename AllocatorType, typename ObjectType>
     friend class MakeNewRCObj;
 
-    RefCountersImpl() noexcept
+    explicit RefCountersImpl(RefCountingMode Mode) noexcept :
+        m_Mode{Mode}
+    {
+    }
+
+    ReferenceCounterValueType UpdateCounter(std::atomic<ReferenceCounterValueType>& Counter, ReferenceCounterValueType Delta)
+    {
+        if (m_Mode == RefCountingMode::SingleThreaded)
+        {
+            VERIFY(m_dbgOwnerThreadId == std::this_thread::get_id(),
+                   "Object with single-threaded reference counting is referenced from a thread other than the one it was created in");
+            // Relaxed load and store compile to plain memory accesses without the bus lock
+            const ReferenceCounterValueType NewValue = Counter.load(std::memory_order_relaxed) + Delta;
+            Counter.store(NewValue, std::memory_order_relaxed);
+            return NewValue;
+        }
+        return Counter.fetch_add(Delta) + Delta;
+    }
+
+    std::unique_lock<Threading::SpinLock> LockIfAtomic()
     {
+        return m_Mode == RefCountingMode::Atomic ?
+            std::unique_lock<Threading::SpinLock>{m_Lock} :
+            std::unique_lock<Threading::SpinLock>{m_Lock, std::defer_lock};
     }
 
     class ObjectWrapperBase
@@ -363,7 +423,7 @@ private:
 #endif
 
         // Acquire the lock.
-        std::unique_lock<Threading::SpinLock> Guard{m_Lock};
+        std::unique_lock<Threading::SpinLock> Guard = LockIfAtomic();
 
         // QueryObject() first acquires the lock, and only then increments and
         // decrements the ref counter. If it reads 1 after incrementing the counter,
@@ -437,7 +497,8 @@ private:
             // We must explicitly unlock the object now to avoid deadlocks. Also,
             // if this is deleted, this->m_LockFlag will expire, which will cause
             // Lock.~LockHelper() to crash
-            Guard.unlock();
+            if (Guard.owns_lock())
+                Guard.unlock();
 
             // Destroy referenced object
             pWrapper->DestroyObject();
@@ -486,6 +547,12 @@ private:
 
     Threading::SpinLock m_Lock;
 
+    const RefCountingMode m_Mode;
+
+#ifdef DILIGENT_DEBUG
+    const std::thread::id m_dbgOwnerThreadId = std::this_thread::get_id();
+#endif
+
     enum class ObjectState : Int32
     {
         NotInitialized,
@@ -657,7 +724,7 @@ public:
         {
             // Constructor of RefCountersImpl class is private and only accessible
             // by methods of MakeNewRCObj
-            pNewRefCounters = new RefCountersImpl{};
+            pNewRefCounters = new RefCountersImpl{RefCountingModeTraits<ObjectType>::Mode};
             pRefCounters    = pNewRefCounters;
         }
         ObjectType* pObj = nullptr;
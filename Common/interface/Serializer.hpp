@@ -30,6 +30,8 @@
 #include <array>
 #include <cstring>
 #include <atomic>
+#include <vector>
+#include <algorithm>
 
 #include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/MemoryAllocator.h"
@@ -141,7 +143,11 @@ enum class SerializerMode
 {
     Read,
     Write,
-    Measure
+    Measure,
+
+    /// Writes the data to memory chunks allocated from the DynamicLinearAllocator, which
+    /// removes the need for the Measure pass. Use GetData() to get the contiguous data.
+    WriteGrowable
 };
 
 
@@ -163,7 +169,7 @@ public:
     template <typename T>
     using TReadOnly = typename std::enable_if_t<Mode == SerializerMode::Read, const T*>;
 
-    using TPointer = typename std::conditional_t<Mode == SerializerMode::Write, Uint8*, const Uint8*>;
+    using TPointer = typename std::conditional_t<Mode == SerializerMode::Write || Mode == SerializerMode::WriteGrowable, Uint8*, const Uint8*>;
 
     template <typename T>
     using ConstQual = typename std::conditional_t<Mode == SerializerMode::Read, T, const T>;
@@ -189,6 +195,20 @@ public:
         static_assert(Mode == SerializerMode::Read || Mode == SerializerMode::Write, "Only Read or Write mode is supported");
     }
 
+    /// Creates a serializer in WriteGrowable mode.
+
+    /// \param [in] ChunkAllocator - Allocator to allocate memory chunks from. The allocator must
+    ///                              outlive the serializer. It may be reused with Discard() to
+    ///                              avoid allocating memory every time.
+    /// \param [in] ChunkSize      - The minimum size of the first chunk. The size of each
+    ///                              subsequent chunk is doubled.
+    explicit Serializer(DynamicLinearAllocator& ChunkAllocator, size_t ChunkSize = 1024) :
+        m_pChunkAllocator{&ChunkAllocator},
+        m_NextChunkSize{ChunkSize}
+    {
+        static_assert(Mode == SerializerMode::WriteGrowable, "Only WriteGrowable mode is supported");
+    }
+
     template <typename T>
     TEnable<T> Serialize(ConstQual<T>& Value)
     {
@@ -236,6 +256,16 @@ public:
                            ElemPtrType&            Elements,
                            CountType&              Count);
 
+    /// Serializes an array of trivially serializable elements.
+    ///
+    /// Unlike SerializeArrayRaw, the elements are stored with SerializeBytes aligned
+    /// to the element alignment, so that in Read mode Elements points directly
+    /// into the source data and no allocator is required.
+    /// The two methods produce different data and are not interchangeable.
+    template <typename ElemPtrType, typename CountType>
+    bool SerializeArrayView(ElemPtrType& Elements,
+                            CountType&   Count);
+
     template <typename T>
     TReadOnly<T> Cast()
     {
@@ -265,7 +295,7 @@ public:
     size_t GetSize() const
     {
         VERIFY_EXPR(m_Ptr >= m_Start);
-        return m_Ptr - m_Start;
+        return m_PrevChunksSize + (m_Ptr - m_Start);
     }
 
     size_t GetRemainingSize() const
@@ -290,6 +320,24 @@ public:
         return SerializedData{GetSize(), Allocator};
     }
 
+    /// Copies the data written in WriteGrowable mode to a contiguous memory block.
+    SerializedData GetData(IMemoryAllocator& Allocator) const
+    {
+        static_assert(Mode == SerializerMode::WriteGrowable, "This method is only allowed in WriteGrowable mode");
+        SerializedData Data{GetSize(), Allocator};
+
+        Uint8* pDst = Data.Ptr<Uint8>();
+        for (const Chunk& PrevChunk : m_PrevChunks)
+        {
+            std::memcpy(pDst, PrevChunk.pData, PrevChunk.Size);
+            pDst += PrevChunk.Size;
+        }
+        if (m_Ptr != m_Start)
+            std::memcpy(pDst, m_Start, m_Ptr - m_Start);
+
+        return Data;
+    }
+
     static constexpr SerializerMode GetMode() { return Mode; }
 
 private:
@@ -304,11 +352,26 @@ private:
         m_Ptr += AlignShift;
     }
 
+    // WriteGrowable mode: makes a new chunk with at least MinSize bytes the current one
+    void AddChunk(size_t MinSize);
+
 private:
-    TPointer const m_Start = nullptr;
-    TPointer const m_End   = nullptr;
+    // In WriteGrowable mode, these pointers refer to the current chunk
+    TPointer m_Start = nullptr;
+    TPointer m_End   = nullptr;
 
     TPointer m_Ptr = nullptr;
+
+    // WriteGrowable mode only
+    struct Chunk
+    {
+        const Uint8* pData;
+        size_t       Size;
+    };
+    std::vector<Chunk>      m_PrevChunks;
+    size_t                  m_PrevChunksSize  = 0;
+    DynamicLinearAllocator* m_pChunkAllocator = nullptr;
+    size_t                  m_NextChunkSize   = 0;
 };
 
 #define CHECK_REMAINING_SIZE(Size, ...) \
@@ -352,6 +415,57 @@ bool Serializer<SerializerMode::Measure>::Copy(T* pData, size_t Size)
     return true;
 }
 
+template <>
+inline void Serializer<SerializerMode::WriteGrowable>::AddChunk(size_t MinSize)
+{
+    VERIFY_EXPR(m_pChunkAllocator != nullptr);
+    if (m_Ptr != m_Start)
+    {
+        m_PrevChunks.push_back({m_Start, static_cast<size_t>(m_Ptr - m_Start)});
+        m_PrevChunksSize += m_Ptr - m_Start;
+    }
+
+    const size_t ChunkSize = std::max(MinSize, m_NextChunkSize);
+    m_NextChunkSize *= 2;
+
+    m_Start = static_cast<Uint8*>(m_pChunkAllocator->Allocate(ChunkSize, 1));
+    m_End   = m_Start + ChunkSize;
+    m_Ptr   = m_Start;
+}
+
+template <>
+template <typename T>
+bool Serializer<SerializerMode::WriteGrowable>::Copy(T* pData, size_t Size)
+{
+    static_assert(IsAlignedBaseClass<T>::Value, "There is unused space at the end of the structure that may be filled with garbage. Use padding to zero-initialize this space and avoid nasty issues.");
+    if (Size == 0)
+        return true;
+
+    if (m_Ptr + Size > m_End)
+    {
+        // The data is never split between chunks
+        AddChunk(Size);
+    }
+    std::memcpy(m_Ptr, pData, Size);
+    m_Ptr += Size;
+    return true;
+}
+
+template <>
+inline void Serializer<SerializerMode::WriteGrowable>::AlignOffset(size_t Alignment)
+{
+    const size_t Size       = GetSize();
+    const size_t AlignShift = AlignUp(Size, Alignment) - Size;
+    if (AlignShift == 0)
+        return;
+
+    if (m_Ptr + AlignShift > m_End)
+        AddChunk(AlignShift);
+    // Padding must be zero-initialized to keep the data deterministic
+    std::memset(m_Ptr, 0, AlignShift);
+    m_Ptr += AlignShift;
+}
+
 template <>
 template <typename T>
 typename Serializer<SerializerMode::Read>::TEnableStr<T> Serializer<SerializerMode::Read>::Serialize(CharPtr Str)
@@ -368,11 +482,11 @@ typename Serializer<SerializerMode::Read>::TEnableStr<T> Serializer<SerializerMo
     return true;
 }
 
-template <SerializerMode Mode> // Write or Measure
+template <SerializerMode Mode> // Write, Measure or WriteGrowable
 template <typename T>
 typename Serializer<Mode>::template TEnableStr<T> Serializer<Mode>::Serialize(CharPtr Str)
 {
-    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure, "Unexpected mode");
+    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure || Mode == SerializerMode::WriteGrowable, "Unexpected mode");
     const Uint32 LenWithNull = static_cast<Uint32>((Str != nullptr && Str[0] != '\0') ? strlen(Str) + 1 : 0);
     if (!Serialize<Uint32>(LenWithNull))
         return false;
@@ -400,10 +514,10 @@ inline bool Serializer<SerializerMode::Read>::SerializeBytes(VoidPtr pBytes, Con
     return true;
 }
 
-template <SerializerMode Mode> // Write or Measure
+template <SerializerMode Mode> // Write, Measure or WriteGrowable
 inline bool Serializer<Mode>::SerializeBytes(VoidPtr pBytes, ConstQual<size_t>& Size, size_t Alignment)
 {
-    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure, "Unexpected mode");
+    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure || Mode == SerializerMode::WriteGrowable, "Unexpected mode");
     if (!Serialize<Uint32>(static_cast<Uint32>(Size)))
         return false;
     AlignOffset(Alignment);
@@ -434,6 +548,12 @@ inline bool Serializer<SerializerMode::Measure>::Serialize(const SerializedData&
     return SerializeBytes(Data.Ptr(), Data.Size());
 }
 
+template <>
+inline bool Serializer<SerializerMode::WriteGrowable>::Serialize(const SerializedData& Data)
+{
+    return SerializeBytes(Data.Ptr(), Data.Size());
+}
+
 
 template <SerializerMode Mode>
 template <typename ElemPtrType, typename CountType, typename ArrayElemSerializerType>
@@ -495,6 +615,44 @@ bool Serializer<Mode>::SerializeArrayRaw(DynamicLinearAllocator* Allocator,
                           });
 }
 
+
+template <SerializerMode Mode> // Write, Measure or WriteGrowable
+template <typename ElemPtrType, typename CountType>
+bool Serializer<Mode>::SerializeArrayView(ElemPtrType& Elements,
+                                          CountType&   Count)
+{
+    using ElemType = std::remove_const_t<std::remove_pointer_t<RawType<ElemPtrType>>>;
+    static_assert(IsTriviallySerializable<ElemType>::value, "Only arrays of trivially serializable elements are supported");
+    VERIFY_EXPR((Elements != nullptr) == (Count != 0));
+
+    return SerializeBytes(Elements, static_cast<size_t>(Count) * sizeof(ElemType), alignof(ElemType));
+}
+
+template <>
+template <typename ElemPtrType, typename CountType>
+bool Serializer<SerializerMode::Read>::SerializeArrayView(ElemPtrType& Elements,
+                                                          CountType&   Count)
+{
+    using ElemType = std::remove_const_t<std::remove_pointer_t<RawType<ElemPtrType>>>;
+    static_assert(IsTriviallySerializable<ElemType>::value, "Only arrays of trivially serializable elements are supported");
+
+    size_t      Size  = 0;
+    const void* pData = nullptr;
+    if (!SerializeBytes(pData, Size, alignof(ElemType)))
+        return false;
+
+    if (Size % sizeof(ElemType) != 0)
+    {
+        UNEXPECTED("Array size (", Size, ") is not a multiple of the element size (", sizeof(ElemType), ")");
+        return false;
+    }
+    VERIFY(reinterpret_cast<size_t>(pData) % alignof(ElemType) == 0, "The source data is not properly aligned");
+
+    Count    = static_cast<CountType>(Size / sizeof(ElemType));
+    Elements = Count != 0 ? static_cast<const ElemType*>(pData) : nullptr;
+    return true;
+}
+
 #undef CHECK_REMAINING_SIZE
 
 } // namespace Diligent
@@ -31,6 +31,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <cstdint>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -38,6 +39,12 @@ namespace Threading
 {
 
 /// Spin lock implementation
+
+/// The lock spins for a short time with exponential backoff, testing the state with plain
+/// loads to avoid generating cache misses (test-and-test-and-set), and then parks the thread
+/// on the lock state with PlatformMisc::WaitOnAddress() (futex on Linux and Android,
+/// WaitOnAddress on Windows), so that contended threads do not burn cores when
+/// the system is oversubscribed.
 class SpinLock
 {
 public:
@@ -53,15 +60,10 @@ public:
 
     void lock() noexcept
     {
-        while (true)
-        {
-            // Assume that lock is free on the first try.
-            const bool WasLocked = m_IsLocked.exchange(true, std::memory_order_acquire);
-            if (!WasLocked)
-                return; // The lock was not acquired when this thread performed the exchange
-
-            Wait();
-        }
+        // Assume that lock is free on the first try.
+        std::uint32_t Expected = Unlocked;
+        if (!m_State.compare_exchange_strong(Expected, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            LockContended();
     }
 
     bool try_lock() noexcept
@@ -71,28 +73,36 @@ public:
         if (is_locked())
             return false;
 
-        const bool WasLocked = m_IsLocked.exchange(true, std::memory_order_acquire);
-        return !WasLocked;
+        std::uint32_t Expected = Unlocked;
+        return m_State.compare_exchange_strong(Expected, Locked, std::memory_order_acquire, std::memory_order_relaxed);
     }
 
     void unlock() noexcept
     {
         VERIFY(is_locked(), "Attempting to unlock a spin lock that is not locked. This is a strong indication of a flawed logic.");
-        m_IsLocked.store(false, std::memory_order_release);
+        if (m_State.exchange(Unlocked, std::memory_order_release) == LockedWithWaiters)
+            WakeWaiter();
     }
 
     bool is_locked() const noexcept
     {
         // Use relaxed load as we only want to check the value.
         // To impose ordering, lock()/try_lock() must be used.
-        return m_IsLocked.load(std::memory_order_relaxed);
+        return m_State.load(std::memory_order_relaxed) != Unlocked;
     }
 
 private:
-    void Wait() noexcept;
+    void LockContended() noexcept;
+    void WakeWaiter() noexcept;
 
 private:
-    std::atomic<bool> m_IsLocked{false};
+    enum : std::uint32_t
+    {
+        Unlocked          = 0,
+        Locked            = 1,
+        LockedWithWaiters = 2
+    };
+    std::atomic<std::uint32_t> m_State{Unlocked};
 };
 
 using SpinLockGuard = std::lock_guard<SpinLock>;
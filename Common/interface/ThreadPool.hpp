@@ -31,10 +31,13 @@
 
 #include "ThreadPool.h"
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <thread>
+#include <vector>
 
+#include "../../Primitives/interface/FlagEnum.h"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
 #include "ObjectBase.hpp"
@@ -43,6 +46,28 @@
 namespace Diligent
 {
 
+/// Flags that control how the thread pool places its worker threads on the CPU cores,
+/// see ThreadPoolCreateInfo::PlacementFlags.
+enum THREAD_PLACEMENT_FLAGS : Uint32
+{
+    /// Worker threads are not pinned and may run on any logical processor.
+    THREAD_PLACEMENT_FLAG_NONE = 0u,
+
+    /// Pin every worker thread to a single logical processor of its own physical core,
+    /// so that workers never share a core through SMT. If there are more worker threads
+    /// than eligible cores, the cores are reused in round-robin fashion.
+    THREAD_PLACEMENT_FLAG_ONE_PER_PHYSICAL_CORE = 1u << 0u,
+
+    /// On hybrid CPUs, keep worker threads off the efficiency cores.
+    THREAD_PLACEMENT_FLAG_PERFORMANCE_CORES = 1u << 1u,
+
+    /// Keep worker threads off the physical core that the thread calling CreateThreadPool
+    /// is running on, including its SMT siblings. This is intended for pools created by
+    /// the render thread, which should be pinned to its core beforehand.
+    THREAD_PLACEMENT_FLAG_EXCLUDE_CALLING_CORE = 1u << 2u,
+};
+DEFINE_FLAG_ENUM_OPERATORS(THREAD_PLACEMENT_FLAGS)
+
 /// Thread pool create information
 struct ThreadPoolCreateInfo
 {
@@ -61,10 +86,45 @@ struct ThreadPoolCreateInfo
     /// An optional function that will be called by the thread pool from
     /// the worker thread before the worker thread exits.
     std::function<void(Uint32)> OnThreadExiting = nullptr;
+
+    /// Whether to use the work-stealing scheduler.
+
+    /// By default, all tasks are kept in a single priority queue protected by a mutex.
+    /// When work stealing is enabled, every worker thread has its own queue, where
+    /// tasks are grouped into buckets by their priority. Tasks enqueued from a worker
+    /// thread go to its own queue, while tasks enqueued by other threads are distributed
+    /// between the queues in round-robin fashion. A thread that runs out of tasks steals
+    /// them from other queues without blocking on queues that are in use.
+    ///
+    /// The worker thread always takes the highest-priority task available across all
+    /// queues at the moment of the check, but the strict priority order is not guaranteed
+    /// when tasks are enqueued or stolen concurrently.
+    ///
+    /// \note  When the pool is created with zero threads, a single queue is used.
+    ///        IThreadPool::ProcessTask() maps the thread ID to the queue index as
+    ///        ThreadId % max(NumThreads, 1).
+    bool EnableWorkStealing = false;
+
+    /// Worker thread placement flags, see THREAD_PLACEMENT_FLAGS.
+
+    /// The placement is applied by the worker thread before OnThreadStarted is called.
+    /// Use GetThreadPlacementProcessors() to find the number of worker threads
+    /// that matches the placement.
+    ///
+    /// \note  Apple platforms do not support thread affinity, and the flags are ignored.
+    THREAD_PLACEMENT_FLAGS PlacementFlags = THREAD_PLACEMENT_FLAG_NONE;
 };
 
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI);
 
+/// Returns the OS indices of the logical processors eligible for worker threads with the given placement flags.
+
+/// When THREAD_PLACEMENT_FLAG_ONE_PER_PHYSICAL_CORE is set, the list contains one logical processor
+/// per physical core, and its size is the recommended number of worker threads.
+/// The function must be called from the same thread that creates the pool when
+/// THREAD_PLACEMENT_FLAG_EXCLUDE_CALLING_CORE is used.
+std::vector<Uint32> GetThreadPlacementProcessors(THREAD_PLACEMENT_FLAGS Flags);
+
 /// Pins the worker thread to one of the allowed cores.
 ///
 /// \param ThreadId         - The thread ID.
@@ -226,4 +286,183 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+/// Returns a function that executes the handler in the thread pool.
+
+/// \param [in] pThreadPool - Thread pool to execute the handler in.
+/// \param [in] Handler     - Handler to execute. The return value is ignored.
+/// \param [in] fPriority   - Task priority.
+///
+/// When the returned function is called, its arguments are copied and the handler
+/// is enqueued as a task that receives the copies. This is intended for callbacks
+/// that are called from threads that must not be blocked, for example AsyncFile
+/// completion callbacks:
+///
+///     pFile->Read(Requests.data(), NumRequests,
+///                 MakeThreadPoolCallback(pThreadPool,
+///                                        [](const AsyncFileReadRequest& Req, size_t BytesRead, bool Success) {
+///                                            // Process the data
+///                                        }));
+template <typename HanlderType>
+auto MakeThreadPoolCallback(IThreadPool* pThreadPool,
+                            HanlderType  Handler,
+                            float        fPriority = 0)
+{
+    RefCntAutoPtr<IThreadPool> pPool{pThreadPool};
+    return [pPool, Handler, fPriority](const auto&... Args) {
+        EnqueueAsyncWork(
+            pPool,
+            [Handler, Args...](Uint32 ThreadId) mutable {
+                Handler(Args...);
+                return ASYNC_TASK_STATUS_COMPLETE;
+            },
+            fPriority);
+    };
+}
+
+
+/// Calls Fn(i) for every i in the range [Begin, End) using the thread pool.
+
+/// \param [in] pThreadPool - Thread pool to use. If null, all items are processed by the calling thread.
+/// \param [in] Begin       - The first index of the range.
+/// \param [in] End         - The index past the last index of the range.
+/// \param [in] Grain       - The number of consecutive items processed by one thread at a time.
+/// \param [in] Fn          - The function to call for every item. The function is called
+///                           concurrently from multiple threads and must be thread-safe.
+///
+/// The range is split into chunks of Grain items that are taken by the threads
+/// from a shared atomic counter. Only a small number of helper tasks, bounded by the
+/// number of hardware threads, is enqueued into the pool regardless of the range size.
+/// The calling thread processes chunks as well, and the function returns when all items
+/// are processed. Helper tasks that have not started by that time are removed from the pool.
+///
+/// Since the calling thread always participates, it is safe to call the function from
+/// the worker thread of the same pool.
+template <typename FnType>
+void ParallelFor(IThreadPool* pThreadPool,
+                 Uint32       Begin,
+                 Uint32       End,
+                 Uint32       Grain,
+                 FnType&&     Fn)
+{
+    if (Begin >= End)
+        return;
+
+    Grain = std::max(Grain, 1u);
+
+    const Uint32 NumItems  = End - Begin;
+    const Uint32 NumChunks = NumItems / Grain + (NumItems % Grain != 0 ? 1 : 0);
+
+    std::atomic<Uint32> NextChunk{0};
+
+    auto ProcessChunks = [&]() {
+        for (Uint32 Chunk = NextChunk.fetch_add(1); Chunk < NumChunks; Chunk = NextChunk.fetch_add(1))
+        {
+            const Uint32 ChunkBegin = Begin + Chunk * Grain;
+            const Uint32 ChunkEnd   = ChunkBegin + std::min(Grain, End - ChunkBegin);
+            for (Uint32 i = ChunkBegin; i < ChunkEnd; ++i)
+                Fn(i);
+        }
+    };
+
+    if (pThreadPool == nullptr || NumChunks == 1)
+    {
+        ProcessChunks();
+        return;
+    }
+
+    const Uint32 NumHelpers = std::min(NumChunks - 1, std::max(std::thread::hardware_concurrency(), 1u));
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Helpers(NumHelpers);
+    for (RefCntAutoPtr<IAsyncTask>& pHelper : Helpers)
+    {
+        pHelper = EnqueueAsyncWork(pThreadPool,
+                                   [&ProcessChunks](Uint32 ThreadId) //
+                                   {
+                                       ProcessChunks();
+                                       return ASYNC_TASK_STATUS_COMPLETE;
+                                   });
+    }
+
+    // The calling thread helps out
+    ProcessChunks();
+
+    // All chunks have been taken at this point. Remove helpers that have not
+    // started and wait for the ones that are still processing their last chunk.
+    for (RefCntAutoPtr<IAsyncTask>& pHelper : Helpers)
+    {
+        if (!pThreadPool->RemoveTask(pHelper))
+            pHelper->WaitForCompletion();
+    }
+}
+
+
+/// Static task graph.
+
+/// The graph is built once by adding tasks and dependencies between them, and
+/// can then be executed any number of times. Tasks are stored in a contiguous
+/// array owned by the graph, and no IAsyncTask objects are created per task.
+/// Instead, a small number of helper tasks take ready tasks from a lock-free list,
+/// and the thread that calls Execute() processes tasks as well.
+///
+/// \remarks   The graph must not be modified or executed by multiple threads
+///            at the same time.
+class TaskGraph
+{
+public:
+    using TaskFunctionType = std::function<void()>;
+
+    TaskGraph() = default;
+
+    // clang-format off
+    TaskGraph           (const TaskGraph&) = delete;
+    TaskGraph           (TaskGraph&&)      = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+    TaskGraph& operator=(TaskGraph&&)      = delete;
+    // clang-format on
+
+    /// Adds a task to the graph and returns its index.
+    Uint32 AddTask(TaskFunctionType Func);
+
+    /// Makes the task Dependent start only after the task Prerequisite is complete.
+    void AddDependency(Uint32 Prerequisite, Uint32 Dependent);
+
+    /// Runs all tasks in the graph and waits until they are complete.
+
+    /// \param [in] pThreadPool - Thread pool to use. If null, all tasks are run by the calling thread.
+    ///
+    /// \note  The dependencies must not form cycles.
+    void Execute(IThreadPool* pThreadPool);
+
+    /// Removes all tasks from the graph.
+    void Clear();
+
+    /// Returns the number of tasks in the graph.
+    Uint32 GetTaskCount() const
+    {
+        return static_cast<Uint32>(m_Tasks.size());
+    }
+
+private:
+    bool PopReadyTask(Uint32& TaskIdx);
+    void PushReadyTask(Uint32 TaskIdx);
+    void ProcessReadyTasks();
+
+private:
+    struct TaskInfo
+    {
+        TaskFunctionType    Func;
+        std::vector<Uint32> Dependents;
+        Uint32              NumPrerequisites = 0;
+    };
+    std::vector<TaskInfo> m_Tasks;
+
+    // Execution state that is reused between Execute() calls
+    std::vector<std::atomic<Uint32>> m_PendingPrerequisites;
+    std::vector<std::atomic<Uint32>> m_ReadyList;
+
+    std::atomic<Uint32> m_ReadyListWriteIdx{0};
+    std::atomic<Uint32> m_ReadyListReadIdx{0};
+    std::atomic<Uint32> m_NumCompletedTasks{0};
+};
+
 } // namespace Diligent
@@ -27,23 +27,25 @@
 
 #pragma once
 
-#include <mutex>
-#include <condition_variable>
 #include <atomic>
+#include <cstdint>
 
+#include "../../Platforms/interface/PlatformMisc.hpp"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "SpinLock.hpp"
 
 namespace Threading
 {
 
+/// Signal that threads can wait for.
+
+/// Waiting threads are parked on the signaled value with PlatformMisc::WaitOnAddress()
+/// (futex on Linux and Android, WaitOnAddress on Windows). The bookkeeping of the awaken
+/// threads is protected by a spin lock, which is only held for a few instructions.
 class Signal
 {
 public:
-    Signal()
-    {
-        m_SignaledValue.store(0);
-        m_NumThreadsAwaken.store(0);
-    }
+    Signal() noexcept {}
 
     // clang-format off
     Signal           (const Signal&) = delete;
@@ -52,28 +54,21 @@ public:
     Signal& operator=(Signal&&)      = delete;
     // clang-format on
 
-    // http://en.cppreference.com/w/cpp/thread/condition_variable
     void Trigger(bool NotifyAll = false, int SignalValue = 1)
     {
         VERIFY(SignalValue != 0, "Signal value must not be zero");
 
-        //  The thread that intends to modify the variable has to
-        //  * acquire a std::mutex (typically via std::lock_guard)
-        //  * perform the modification while the lock is held
-        //  * execute notify_one or notify_all on the std::condition_variable (the lock does not need to be held for notification)
         {
-            // std::condition_variable works only with std::unique_lock<std::mutex>
-            std::lock_guard<std::mutex> Lock{m_Mutex};
-            VERIFY(SignalValue != 0, "Signal value must not be 0");
+            SpinLockGuard Guard{m_Lock};
             VERIFY(m_SignaledValue.load() == 0 && m_NumThreadsAwaken.load() == 0, "Not all threads have been awaken since the signal was triggered last time, or the signal has not been reset");
-            m_SignaledValue.store(SignalValue);
+            m_SignaledValue.store(static_cast<std::uint32_t>(SignalValue));
         }
-        // Unlocking is done before notifying, to avoid waking up the waiting
-        // thread only to block again (see notify_one for details)
+        // The value must be modified before the waiters are woken up.
+        // A thread that starts waiting after the value has been set returns immediately.
         if (NotifyAll)
-            m_CondVar.notify_all();
+            Diligent::PlatformMisc::WakeByAddressAll(&m_SignaledValue);
         else
-            m_CondVar.notify_one();
+            Diligent::PlatformMisc::WakeByAddressSingle(&m_SignaledValue);
     }
 
     // WARNING!
@@ -84,41 +79,40 @@ public:
 
     int Wait(bool AutoReset = false, int NumThreadsWaiting = 0)
     {
-        //  Any thread that intends to wait on std::condition_variable has to
-        //  * acquire a std::unique_lock<std::mutex>, on the SAME MUTEX as used to protect the shared variable
-        //  * execute wait, wait_for, or wait_until. The wait operations atomically release the mutex
-        //    and suspend the execution of the thread.
-        //  * When the condition variable is notified, a timeout expires, or a spurious wakeup occurs,
-        //    the thread is awakened, and the mutex is atomically reacquired:
-        //    - The thread should then check the condition and resume waiting if the wake-up was spurious.
-        std::unique_lock<std::mutex> Lock(m_Mutex);
-        // It is safe to check m_SignaledValue since we are holding
-        // the mutex
-        if (m_SignaledValue.load() == 0)
+        while (true)
         {
-            m_CondVar.wait(Lock, [&] { return m_SignaledValue.load() != 0; });
-        }
-        int SignaledValue = m_SignaledValue.load();
-        // Update the number of threads awaken while holding the mutex
-        const int NumThreadsAwaken = m_NumThreadsAwaken.fetch_add(1) + 1;
-        // fetch_add returns the original value immediately preceding the addition.
-        if (AutoReset)
-        {
-            VERIFY(NumThreadsWaiting > 0, "Number of waiting threads must not be 0 when auto resetting the signal");
-            // Reset the signal while holding the mutex. If Trigger() is executed by another
-            // thread, it will wait until we release the mutex
-            if (NumThreadsAwaken == NumThreadsWaiting)
             {
-                m_SignaledValue.store(0);
-                m_NumThreadsAwaken.store(0);
+                // Reading the value, updating the number of threads awaken and resetting
+                // the signal must be atomic with respect to other waiting threads.
+                SpinLockGuard Guard{m_Lock};
+
+                const int SignaledValue = static_cast<int>(m_SignaledValue.load());
+                if (SignaledValue != 0)
+                {
+                    // fetch_add returns the original value immediately preceding the addition.
+                    const int NumThreadsAwaken = m_NumThreadsAwaken.fetch_add(1) + 1;
+                    if (AutoReset)
+                    {
+                        VERIFY(NumThreadsWaiting > 0, "Number of waiting threads must not be 0 when auto resetting the signal");
+                        if (NumThreadsAwaken == NumThreadsWaiting)
+                        {
+                            m_SignaledValue.store(0);
+                            m_NumThreadsAwaken.store(0);
+                        }
+                    }
+                    return SignaledValue;
+                }
             }
+
+            // Returns immediately if the signal has been triggered after the check above,
+            // and may also return spuriously.
+            Diligent::PlatformMisc::WaitOnAddress(&m_SignaledValue, 0);
         }
-        return SignaledValue;
     }
 
     void Reset()
     {
-        std::lock_guard<std::mutex> Lock{m_Mutex};
+        SpinLockGuard Guard{m_Lock};
         m_SignaledValue.store(0);
         m_NumThreadsAwaken.store(0);
     }
@@ -126,10 +120,9 @@ public:
     bool IsTriggered() const { return m_SignaledValue.load() != 0; }
 
 private:
-    std::mutex              m_Mutex;
-    std::condition_variable m_CondVar;
-    std::atomic_int         m_SignaledValue{0};
-    std::atomic_int         m_NumThreadsAwaken{0};
+    SpinLock                   m_Lock;
+    std::atomic<std::uint32_t> m_SignaledValue{0};
+    std::atomic_int            m_NumThreadsAwaken{0};
 };
 
 } // namespace Threading
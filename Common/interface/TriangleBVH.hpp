@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Bounding volume hierarchy over triangle soups.
+
+#include <vector>
+
+#include "AdvancedMath.hpp"
+
+namespace Diligent
+{
+
+/// Bounding volume hierarchy over a triangle soup that accelerates ray casts.
+
+/// The hierarchy is a binary tree built with the binned surface area heuristic.
+/// Triangles of every leaf are stored contiguously and are tested against the ray
+/// with IntersectRayTriangles().
+class TriangleBVH
+{
+public:
+    static constexpr Uint32 InvalidTriangle = ~0u;
+
+    /// Builds the hierarchy.
+
+    /// \param [in] pVertices    - Triangle vertices, three per triangle.
+    /// \param [in] NumTriangles - The number of triangles.
+    /// \param [in] MaxLeafSize  - The maximum number of triangles in a leaf node.
+    ///
+    /// The vertices are copied, so the array does not need to be kept alive.
+    void Build(const float3* pVertices, Uint32 NumTriangles, Uint32 MaxLeafSize = 8);
+
+    /// Ray cast result.
+    struct HitInfo
+    {
+        /// The distance along the ray to the hit point, measured in units of the ray direction length.
+        float Distance = FLT_MAX;
+
+        /// The index of the hit triangle in the original triangle soup, or InvalidTriangle.
+        Uint32 Triangle = InvalidTriangle;
+
+        explicit operator bool() const
+        {
+            return Triangle != InvalidTriangle;
+        }
+    };
+
+    /// Finds the closest triangle intersected by the ray at a distance in the range [0, MaxDistance).
+    HitInfo CastRay(const float3& RayOrigin,
+                    const float3& RayDirection,
+                    float         MaxDistance  = FLT_MAX,
+                    bool          CullBackFace = false) const;
+
+    void Clear();
+
+    bool IsEmpty() const
+    {
+        return m_Nodes.empty();
+    }
+
+    /// Returns the bounding box of all triangles.
+    BoundBox GetBounds() const
+    {
+        return !m_Nodes.empty() ? BoundBox{m_Nodes[0].Min, m_Nodes[0].Max} : BoundBox{};
+    }
+
+    Uint32 GetNodeCount() const
+    {
+        return static_cast<Uint32>(m_Nodes.size());
+    }
+
+    Uint32 GetTriangleCount() const
+    {
+        return static_cast<Uint32>(m_TriangleIds.size());
+    }
+
+private:
+    struct Node
+    {
+        float3 Min;
+        // For leaf nodes, the index of the first triangle.
+        // For inner nodes, the index of the left child. The right child immediately follows it.
+        Uint32 FirstIdx = 0;
+        float3 Max;
+        // The number of triangles in the leaf node, or zero for inner nodes.
+        Uint32 NumTriangles = 0;
+    };
+
+    // The maximum tree depth that is guaranteed by the builder
+    static constexpr Uint32 MaxDepth = 80;
+
+    std::vector<Node> m_Nodes;
+
+    // Triangle vertices in the leaf order
+    std::vector<float3> m_Vertices;
+
+    // Original indices of triangles in the leaf order
+    std::vector<Uint32> m_TriangleIds;
+};
+
+} // namespace Diligent
@@ -0,0 +1,631 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "AdvancedMath.hpp"
+
+#include <algorithm>
+
+#include "Intrinsics.hpp"
+#include "ThreadPool.hpp"
+
+#if !DILIGENT_AVX2_ENABLED && (defined(__aarch64__) || defined(_M_ARM64))
+#    include <arm_neon.h>
+#    define DILIGENT_ADVANCED_MATH_NEON 1
+#elif !DILIGENT_AVX2_ENABLED && DILIGENT_AVX2_SUPPORTED && (defined(_MSC_VER) || defined(__SSE__))
+#    define DILIGENT_ADVANCED_MATH_SSE 1
+#endif
+
+#if DILIGENT_AVX2_ENABLED || DILIGENT_ADVANCED_MATH_SSE || DILIGENT_ADVANCED_MATH_NEON
+#    define DILIGENT_ADVANCED_MATH_SIMD 1
+#endif
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Frustum planes and the frustum bounding box in the form used by the box visibility kernels
+struct FrustumCullingData
+{
+    struct Plane
+    {
+        float Nx, Ny, Nz;
+        float AbsNx, AbsNy, AbsNz;
+        float Distance;
+    };
+    Plane  Planes[ViewFrustum::NUM_PLANES];
+    Uint32 NumPlanes = 0;
+
+    // When the full frustum is tested, the box that is intersecting the planes is invisible if it is
+    // entirely on the other side of any plane of the frustum bounding box. This is equivalent to the
+    // frustum corners test performed by GetBoxVisibility().
+    bool   TestFrustumCorners = false;
+    float3 FrustumMin;
+    float3 FrustumMax;
+
+    FrustumCullingData(const ViewFrustumExt& Frustum, FRUSTUM_PLANE_FLAGS PlaneFlags)
+    {
+        for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+        {
+            if ((PlaneFlags & (1 << plane_idx)) == 0)
+                continue;
+
+            const Plane3D& SrcPlane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+
+            Plane& DstPlane   = Planes[NumPlanes++];
+            DstPlane.Nx       = SrcPlane.Normal.x;
+            DstPlane.Ny       = SrcPlane.Normal.y;
+            DstPlane.Nz       = SrcPlane.Normal.z;
+            DstPlane.AbsNx    = std::abs(SrcPlane.Normal.x);
+            DstPlane.AbsNy    = std::abs(SrcPlane.Normal.y);
+            DstPlane.AbsNz    = std::abs(SrcPlane.Normal.z);
+            DstPlane.Distance = SrcPlane.Distance;
+        }
+
+        TestFrustumCorners = (PlaneFlags & FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) == FRUSTUM_PLANE_FLAG_FULL_FRUSTUM;
+        FrustumMin         = Frustum.FrustumCorners[0];
+        FrustumMax         = Frustum.FrustumCorners[0];
+        for (const float3& Corner : Frustum.FrustumCorners)
+        {
+            FrustumMin = (min)(FrustumMin, Corner);
+            FrustumMax = (max)(FrustumMax, Corner);
+        }
+    }
+};
+
+struct BoxesSoA
+{
+    const float* MinX;
+    const float* MinY;
+    const float* MinZ;
+    const float* MaxX;
+    const float* MaxY;
+    const float* MaxZ;
+};
+
+inline Uint8 GetBoxVisibilityGeneric(const FrustumCullingData& Data, const BoxesSoA& Boxes, size_t i)
+{
+    const float SumX = Boxes.MaxX[i] + Boxes.MinX[i];
+    const float SumY = Boxes.MaxY[i] + Boxes.MinY[i];
+    const float SumZ = Boxes.MaxZ[i] + Boxes.MinZ[i];
+    const float ExtX = Boxes.MaxX[i] - Boxes.MinX[i];
+    const float ExtY = Boxes.MaxY[i] - Boxes.MinY[i];
+    const float ExtZ = Boxes.MaxZ[i] - Boxes.MinZ[i];
+
+    bool AllInside = true;
+    for (Uint32 p = 0; p < Data.NumPlanes; ++p)
+    {
+        const FrustumCullingData::Plane& Plane = Data.Planes[p];
+
+        // Same computations as in GetBoxVisibilityAgainstPlane()
+        const float DistanceToCenter = (SumX * Plane.Nx + SumY * Plane.Ny + SumZ * Plane.Nz) * 0.5f + Plane.Distance;
+        const float ProjHalfLen      = (ExtX * Plane.AbsNx + ExtY * Plane.AbsNy + ExtZ * Plane.AbsNz) * 0.5f;
+        if (DistanceToCenter < -ProjHalfLen)
+            return static_cast<Uint8>(BoxVisibility::Invisible);
+        AllInside = AllInside && (DistanceToCenter > ProjHalfLen);
+    }
+    if (AllInside)
+        return static_cast<Uint8>(BoxVisibility::FullyVisible);
+
+    if (Data.TestFrustumCorners &&
+        (Data.FrustumMax.x <= Boxes.MinX[i] || Data.FrustumMax.y <= Boxes.MinY[i] || Data.FrustumMax.z <= Boxes.MinZ[i] ||
+         Data.FrustumMin.x >= Boxes.MaxX[i] || Data.FrustumMin.y >= Boxes.MaxY[i] || Data.FrustumMin.z >= Boxes.MaxZ[i]))
+        return static_cast<Uint8>(BoxVisibility::Invisible);
+
+    return static_cast<Uint8>(BoxVisibility::Intersecting);
+}
+
+#if DILIGENT_AVX2_ENABLED
+
+struct SIMD_AVX2
+{
+    static constexpr size_t Width = 8;
+
+    using Vec = __m256;
+
+    // clang-format off
+    static Vec Load (const float* p)       { return _mm256_loadu_ps(p); }
+    static Vec Splat(float s)              { return _mm256_set1_ps(s); }
+    static Vec Add  (Vec a, Vec b)         { return _mm256_add_ps(a, b); }
+    static Vec Sub  (Vec a, Vec b)         { return _mm256_sub_ps(a, b); }
+    static Vec Mul  (Vec a, Vec b)         { return _mm256_mul_ps(a, b); }
+    static Vec Div  (Vec a, Vec b)         { return _mm256_div_ps(a, b); }
+    static Vec Min  (Vec a, Vec b)         { return _mm256_min_ps(a, b); }
+    static Vec Max  (Vec a, Vec b)         { return _mm256_max_ps(a, b); }
+    static Vec Abs  (Vec a)                { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a); }
+    static Vec Neg  (Vec a)                { return _mm256_sub_ps(_mm256_setzero_ps(), a); }
+    static Vec Lt   (Vec a, Vec b)         { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Vec Gt   (Vec a, Vec b)         { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static Vec Le   (Vec a, Vec b)         { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static Vec Ge   (Vec a, Vec b)         { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static Vec Or   (Vec a, Vec b)         { return _mm256_or_ps(a, b); }
+    static Vec And  (Vec a, Vec b)         { return _mm256_and_ps(a, b); }
+    static Vec Select(Vec m, Vec a, Vec b) { return _mm256_blendv_ps(b, a, m); }
+    static void Store(float* p, Vec v)     { _mm256_storeu_ps(p, v); }
+    static Vec False()                     { return _mm256_setzero_ps(); }
+    static Vec True ()                     { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+    static Uint32 MoveMask(Vec m)          { return static_cast<Uint32>(_mm256_movemask_ps(m)); }
+    // clang-format on
+};
+using SIMD = SIMD_AVX2;
+
+#elif DILIGENT_ADVANCED_MATH_SSE
+
+struct SIMD_SSE
+{
+    static constexpr size_t Width = 4;
+
+    using Vec = __m128;
+
+    // clang-format off
+    static Vec Load (const float* p)       { return _mm_loadu_ps(p); }
+    static Vec Splat(float s)              { return _mm_set1_ps(s); }
+    static Vec Add  (Vec a, Vec b)         { return _mm_add_ps(a, b); }
+    static Vec Sub  (Vec a, Vec b)         { return _mm_sub_ps(a, b); }
+    static Vec Mul  (Vec a, Vec b)         { return _mm_mul_ps(a, b); }
+    static Vec Div  (Vec a, Vec b)         { return _mm_div_ps(a, b); }
+    static Vec Min  (Vec a, Vec b)         { return _mm_min_ps(a, b); }
+    static Vec Max  (Vec a, Vec b)         { return _mm_max_ps(a, b); }
+    static Vec Abs  (Vec a)                { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+    static Vec Neg  (Vec a)                { return _mm_sub_ps(_mm_setzero_ps(), a); }
+    static Vec Lt   (Vec a, Vec b)         { return _mm_cmplt_ps(a, b); }
+    static Vec Gt   (Vec a, Vec b)         { return _mm_cmpgt_ps(a, b); }
+    static Vec Le   (Vec a, Vec b)         { return _mm_cmple_ps(a, b); }
+    static Vec Ge   (Vec a, Vec b)         { return _mm_cmpge_ps(a, b); }
+    static Vec Or   (Vec a, Vec b)         { return _mm_or_ps(a, b); }
+    static Vec And  (Vec a, Vec b)         { return _mm_and_ps(a, b); }
+    static Vec Select(Vec m, Vec a, Vec b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    static void Store(float* p, Vec v)     { _mm_storeu_ps(p, v); }
+    static Vec False()                     { return _mm_setzero_ps(); }
+    static Vec True ()                     { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+    static Uint32 MoveMask(Vec m)          { return static_cast<Uint32>(_mm_movemask_ps(m)); }
+    // clang-format on
+};
+using SIMD = SIMD_SSE;
+
+#elif DILIGENT_ADVANCED_MATH_NEON
+
+struct SIMD_NEON
+{
+    static constexpr size_t Width = 4;
+
+    using Vec = float32x4_t;
+
+    // clang-format off
+    static Vec Load (const float* p)       { return vld1q_f32(p); }
+    static Vec Splat(float s)              { return vdupq_n_f32(s); }
+    static Vec Add  (Vec a, Vec b)         { return vaddq_f32(a, b); }
+    static Vec Sub  (Vec a, Vec b)         { return vsubq_f32(a, b); }
+    static Vec Mul  (Vec a, Vec b)         { return vmulq_f32(a, b); }
+    static Vec Div  (Vec a, Vec b)         { return vdivq_f32(a, b); }
+    static Vec Min  (Vec a, Vec b)         { return vminq_f32(a, b); }
+    static Vec Max  (Vec a, Vec b)         { return vmaxq_f32(a, b); }
+    static Vec Abs  (Vec a)                { return vabsq_f32(a); }
+    static Vec Neg  (Vec a)                { return vnegq_f32(a); }
+    static Vec Lt   (Vec a, Vec b)         { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+    static Vec Gt   (Vec a, Vec b)         { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+    static Vec Le   (Vec a, Vec b)         { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+    static Vec Ge   (Vec a, Vec b)         { return vreinterpretq_f32_u32(vcgeq_f32(a, b)); }
+    static Vec Or   (Vec a, Vec b)         { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+    static Vec And  (Vec a, Vec b)         { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+    static Vec Select(Vec m, Vec a, Vec b) { return vbslq_f32(vreinterpretq_u32_f32(m), a, b); }
+    static void Store(float* p, Vec v)     { vst1q_f32(p, v); }
+    static Vec False()                     { return vreinterpretq_f32_u32(vdupq_n_u32(0)); }
+    static Vec True ()                     { return vreinterpretq_f32_u32(vdupq_n_u32(~0u)); }
+    // clang-format on
+
+    static Uint32 MoveMask(Vec m)
+    {
+        const uint32x4_t Bits = vandq_u32(vreinterpretq_u32_f32(m), uint32x4_t{1, 2, 4, 8});
+        return vaddvq_u32(Bits);
+    }
+};
+using SIMD = SIMD_NEON;
+
+#endif
+
+#if DILIGENT_ADVANCED_MATH_SIMD
+
+// Processes boxes [Begin, End) in groups of SIMD::Width and returns the index of the first box that was not processed
+size_t GetBoxesVisibilitySIMD(const FrustumCullingData& Data, const BoxesSoA& Boxes, size_t Begin, size_t End, Uint8* OutVisibility)
+{
+    using Vec = SIMD::Vec;
+
+    const Vec Half = SIMD::Splat(0.5f);
+
+    size_t i = Begin;
+    for (; i + SIMD::Width <= End; i += SIMD::Width)
+    {
+        const Vec MinX = SIMD::Load(Boxes.MinX + i);
+        const Vec MinY = SIMD::Load(Boxes.MinY + i);
+        const Vec MinZ = SIMD::Load(Boxes.MinZ + i);
+        const Vec MaxX = SIMD::Load(Boxes.MaxX + i);
+        const Vec MaxY = SIMD::Load(Boxes.MaxY + i);
+        const Vec MaxZ = SIMD::Load(Boxes.MaxZ + i);
+
+        const Vec SumX = SIMD::Add(MaxX, MinX);
+        const Vec SumY = SIMD::Add(MaxY, MinY);
+        const Vec SumZ = SIMD::Add(MaxZ, MinZ);
+        const Vec ExtX = SIMD::Sub(MaxX, MinX);
+        const Vec ExtY = SIMD::Sub(MaxY, MinY);
+        const Vec ExtZ = SIMD::Sub(MaxZ, MinZ);
+
+        Vec Invisible = SIMD::False();
+        Vec AllInside = SIMD::True();
+        for (Uint32 p = 0; p < Data.NumPlanes; ++p)
+        {
+            const FrustumCullingData::Plane& Plane = Data.Planes[p];
+
+            // The order of operations matches GetBoxVisibilityAgainstPlane()
+            Vec DistanceToCenter = SIMD::Mul(SumX, SIMD::Splat(Plane.Nx));
+            DistanceToCenter     = SIMD::Add(DistanceToCenter, SIMD::Mul(SumY, SIMD::Splat(Plane.Ny)));
+            DistanceToCenter     = SIMD::Add(DistanceToCenter, SIMD::Mul(SumZ, SIMD::Splat(Plane.Nz)));
+            DistanceToCenter     = SIMD::Add(SIMD::Mul(DistanceToCenter, Half), SIMD::Splat(Plane.Distance));
+
+            Vec ProjHalfLen = SIMD::Mul(ExtX, SIMD::Splat(Plane.AbsNx));
+            ProjHalfLen     = SIMD::Add(ProjHalfLen, SIMD::Mul(ExtY, SIMD::Splat(Plane.AbsNy)));
+            ProjHalfLen     = SIMD::Add(ProjHalfLen, SIMD::Mul(ExtZ, SIMD::Splat(Plane.AbsNz)));
+            ProjHalfLen     = SIMD::Mul(ProjHalfLen, Half);
+
+            Invisible = SIMD::Or(Invisible, SIMD::Lt(DistanceToCenter, SIMD::Neg(ProjHalfLen)));
+            AllInside = SIMD::And(AllInside, SIMD::Gt(DistanceToCenter, ProjHalfLen));
+        }
+
+        if (Data.TestFrustumCorners)
+        {
+            Vec Outside = SIMD::Le(SIMD::Splat(Data.FrustumMax.x), MinX);
+            Outside     = SIMD::Or(Outside, SIMD::Le(SIMD::Splat(Data.FrustumMax.y), MinY));
+            Outside     = SIMD::Or(Outside, SIMD::Le(SIMD::Splat(Data.FrustumMax.z), MinZ));
+            Outside     = SIMD::Or(Outside, SIMD::Ge(SIMD::Splat(Data.FrustumMin.x), MaxX));
+            Outside     = SIMD::Or(Outside, SIMD::Ge(SIMD::Splat(Data.FrustumMin.y), MaxY));
+            Outside     = SIMD::Or(Outside, SIMD::Ge(SIMD::Splat(Data.FrustumMin.z), MaxZ));
+            Invisible   = SIMD::Or(Invisible, Outside);
+        }
+
+        const Uint32 InvisibleMask = SIMD::MoveMask(Invisible);
+        const Uint32 AllInsideMask = SIMD::MoveMask(AllInside);
+        for (size_t lane = 0; lane < SIMD::Width; ++lane)
+        {
+            const BoxVisibility Visibility = (InvisibleMask & (1u << lane)) ?
+                BoxVisibility::Invisible :
+                ((AllInsideMask & (1u << lane)) ? BoxVisibility::FullyVisible : BoxVisibility::Intersecting);
+
+            OutVisibility[i + lane] = static_cast<Uint8>(Visibility);
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+void GetBoxesVisibilityRange(const FrustumCullingData& Data, const BoxesSoA& Boxes, size_t Begin, size_t End, Uint8* OutVisibility)
+{
+    size_t i = Begin;
+#if DILIGENT_ADVANCED_MATH_SIMD
+    i = GetBoxesVisibilitySIMD(Data, Boxes, Begin, End, OutVisibility);
+#endif
+    for (; i < End; ++i)
+        OutVisibility[i] = GetBoxVisibilityGeneric(Data, Boxes, i);
+}
+
+#if DILIGENT_ADVANCED_MATH_SIMD
+
+struct Vec3SIMD
+{
+    SIMD::Vec x, y, z;
+};
+
+// Loads Count (<= SIMD::Width) values located Stride floats apart. The remaining lanes are set to zero.
+SIMD::Vec LoadStrided(const float* p, size_t Stride, size_t Count)
+{
+    float Values[SIMD::Width] = {};
+    for (size_t i = 0; i < Count; ++i)
+        Values[i] = p[i * Stride];
+    return SIMD::Load(Values);
+}
+
+Vec3SIMD LoadStrided(const float3* p, size_t Stride, size_t Count)
+{
+    const float* pFloats = &p->x;
+    return {
+        LoadStrided(pFloats + 0, Stride * 3, Count),
+        LoadStrided(pFloats + 1, Stride * 3, Count),
+        LoadStrided(pFloats + 2, Stride * 3, Count),
+    };
+}
+
+Vec3SIMD Splat(const float3& v)
+{
+    return {SIMD::Splat(v.x), SIMD::Splat(v.y), SIMD::Splat(v.z)};
+}
+
+Vec3SIMD Sub(const Vec3SIMD& a, const Vec3SIMD& b)
+{
+    return {SIMD::Sub(a.x, b.x), SIMD::Sub(a.y, b.y), SIMD::Sub(a.z, b.z)};
+}
+
+SIMD::Vec Dot(const Vec3SIMD& a, const Vec3SIMD& b)
+{
+    return SIMD::Add(SIMD::Add(SIMD::Mul(a.x, b.x), SIMD::Mul(a.y, b.y)), SIMD::Mul(a.z, b.z));
+}
+
+Vec3SIMD Cross(const Vec3SIMD& a, const Vec3SIMD& b)
+{
+    return {
+        SIMD::Sub(SIMD::Mul(a.y, b.z), SIMD::Mul(a.z, b.y)),
+        SIMD::Sub(SIMD::Mul(a.z, b.x), SIMD::Mul(a.x, b.z)),
+        SIMD::Sub(SIMD::Mul(a.x, b.y), SIMD::Mul(a.y, b.x)),
+    };
+}
+
+// Performs the same computations as IntersectRayTriangle() for SIMD::Width ray-triangle pairs
+SIMD::Vec IntersectRayTriangleSIMD(const Vec3SIMD& V0,
+                                   const Vec3SIMD& V1,
+                                   const Vec3SIMD& V2,
+                                   const Vec3SIMD& RayOrigin,
+                                   const Vec3SIMD& RayDirection,
+                                   bool            CullBackFace)
+{
+    const Vec3SIMD V0_V1 = Sub(V1, V0);
+    const Vec3SIMD V0_V2 = Sub(V2, V0);
+
+    const Vec3SIMD  PVec = Cross(RayDirection, V0_V2);
+    const SIMD::Vec Det  = Dot(V0_V1, PVec);
+
+    static constexpr float Epsilon = 1e-10f;
+
+    SIMD::Vec Valid = SIMD::Gt(Det, SIMD::Splat(Epsilon));
+    if (!CullBackFace)
+        Valid = SIMD::Or(Valid, SIMD::Lt(Det, SIMD::Splat(-Epsilon)));
+
+    const Vec3SIMD V0_RO = Sub(RayOrigin, V0);
+
+    const SIMD::Vec u = SIMD::Div(Dot(V0_RO, PVec), Det);
+    Valid             = SIMD::And(Valid, SIMD::And(SIMD::Ge(u, SIMD::Splat(0.f)), SIMD::Le(u, SIMD::Splat(1.f))));
+
+    const Vec3SIMD QVec = Cross(V0_RO, V0_V1);
+
+    const SIMD::Vec v = SIMD::Div(Dot(RayDirection, QVec), Det);
+    Valid             = SIMD::And(Valid, SIMD::And(SIMD::Ge(v, SIMD::Splat(0.f)), SIMD::Le(SIMD::Add(u, v), SIMD::Splat(1.f))));
+
+    const SIMD::Vec t = SIMD::Div(Dot(V0_V2, QVec), Det);
+    return SIMD::Select(Valid, t, SIMD::Splat(+FLT_MAX));
+}
+
+// Performs the same computations as IntersectRayBox3D() for SIMD::Width rays and returns the hit mask
+SIMD::Vec IntersectRayBoxSIMD(const Vec3SIMD& RayOrigin,
+                              const Vec3SIMD& RayDirection,
+                              const float3&   BoxMin,
+                              const float3&   BoxMax,
+                              SIMD::Vec&      EnterDist,
+                              SIMD::Vec&      ExitDist)
+{
+    static constexpr float Epsilon = 1e-20f;
+
+    auto IntersectSlab = [](SIMD::Vec Origin, SIMD::Vec Direction, float SlabMin, float SlabMax, SIMD::Vec& t_near, SIMD::Vec& t_far) {
+        const SIMD::Vec Valid = SIMD::Gt(SIMD::Abs(Direction), SIMD::Splat(Epsilon));
+        const SIMD::Vec t_min = SIMD::Select(Valid, SIMD::Div(SIMD::Sub(SIMD::Splat(SlabMin), Origin), Direction), SIMD::Splat(+FLT_MAX));
+        const SIMD::Vec t_max = SIMD::Select(Valid, SIMD::Div(SIMD::Sub(SIMD::Splat(SlabMax), Origin), Direction), SIMD::Splat(-FLT_MAX));
+
+        t_near = SIMD::Min(t_min, t_max);
+        t_far  = SIMD::Max(t_min, t_max);
+    };
+
+    SIMD::Vec NearX, FarX, NearY, FarY, NearZ, FarZ;
+    IntersectSlab(RayOrigin.x, RayDirection.x, BoxMin.x, BoxMax.x, NearX, FarX);
+    IntersectSlab(RayOrigin.y, RayDirection.y, BoxMin.y, BoxMax.y, NearY, FarY);
+    IntersectSlab(RayOrigin.z, RayDirection.z, BoxMin.z, BoxMax.z, NearZ, FarZ);
+
+    EnterDist = SIMD::Max(NearX, SIMD::Max(NearY, NearZ));
+    ExitDist  = SIMD::Min(FarX, SIMD::Min(FarY, FarZ));
+
+    return SIMD::And(SIMD::Ge(ExitDist, SIMD::Splat(0.f)), SIMD::Le(EnterDist, ExitDist));
+}
+
+#endif
+
+} // namespace
+
+void GetBoxesVisibility(const ViewFrustumExt& Frustum,
+                        const float*          MinX,
+                        const float*          MinY,
+                        const float*          MinZ,
+                        const float*          MaxX,
+                        const float*          MaxY,
+                        const float*          MaxZ,
+                        size_t                Count,
+                        Uint8*                OutVisibility,
+                        FRUSTUM_PLANE_FLAGS   PlaneFlags,
+                        IThreadPool*          pThreadPool)
+{
+    if (Count == 0)
+        return;
+
+    DEV_CHECK_ERR(MinX != nullptr && MinY != nullptr && MinZ != nullptr && MaxX != nullptr && MaxY != nullptr && MaxZ != nullptr,
+                  "Box coordinate arrays must not be null");
+    DEV_CHECK_ERR(OutVisibility != nullptr, "Output visibility array must not be null");
+
+    const FrustumCullingData Data{Frustum, PlaneFlags};
+    const BoxesSoA           Boxes{MinX, MinY, MinZ, MaxX, MaxY, MaxZ};
+
+    // The number of boxes processed by one thread at a time
+    constexpr size_t RangeSize = 16384;
+    if (pThreadPool == nullptr || Count <= RangeSize)
+    {
+        GetBoxesVisibilityRange(Data, Boxes, 0, Count, OutVisibility);
+        return;
+    }
+
+    const Uint32 NumRanges = static_cast<Uint32>((Count + RangeSize - 1) / RangeSize);
+    ParallelFor(pThreadPool, 0, NumRanges, 1,
+                [&](Uint32 Range) {
+                    const size_t Begin = size_t{Range} * RangeSize;
+                    const size_t End   = std::min(Begin + RangeSize, Count);
+                    GetBoxesVisibilityRange(Data, Boxes, Begin, End, OutVisibility);
+                });
+}
+
+
+Uint32 IntersectRayPacketBox3D(const float3* RayOrigins,
+                               const float3* RayDirections,
+                               Uint32        NumRays,
+                               const float3& BoxMin,
+                               const float3& BoxMax,
+                               float*        EnterDist,
+                               float*        ExitDist)
+{
+    DEV_CHECK_ERR(NumRays <= 32, "The number of rays (", NumRays, ") exceeds 32");
+    DEV_CHECK_ERR(RayOrigins != nullptr && RayDirections != nullptr, "Ray origins and directions must not be null");
+
+    Uint32 HitMask = 0;
+#if DILIGENT_ADVANCED_MATH_SIMD
+    for (Uint32 i = 0; i < NumRays; i += SIMD::Width)
+    {
+        const size_t Count = std::min(size_t{NumRays - i}, SIMD::Width);
+
+        SIMD::Vec       Enter, Exit;
+        const SIMD::Vec Hit = IntersectRayBoxSIMD(LoadStrided(RayOrigins + i, 1, Count), LoadStrided(RayDirections + i, 1, Count),
+                                                  BoxMin, BoxMax, Enter, Exit);
+
+        float EnterValues[SIMD::Width];
+        float ExitValues[SIMD::Width];
+        SIMD::Store(EnterValues, Enter);
+        SIMD::Store(ExitValues, Exit);
+        for (size_t ray = 0; ray < Count; ++ray)
+        {
+            if (EnterDist != nullptr)
+                EnterDist[i + ray] = EnterValues[ray];
+            if (ExitDist != nullptr)
+                ExitDist[i + ray] = ExitValues[ray];
+        }
+
+        const Uint32 LaneMask = (1u << Count) - 1u;
+        HitMask |= (SIMD::MoveMask(Hit) & LaneMask) << i;
+    }
+#else
+    for (Uint32 ray = 0; ray < NumRays; ++ray)
+    {
+        float Enter = 0, Exit = 0;
+        if (IntersectRayBox3D(RayOrigins[ray], RayDirections[ray], BoxMin, BoxMax, Enter, Exit))
+            HitMask |= 1u << ray;
+        if (EnterDist != nullptr)
+            EnterDist[ray] = Enter;
+        if (ExitDist != nullptr)
+            ExitDist[ray] = Exit;
+    }
+#endif
+
+    return HitMask;
+}
+
+void IntersectRayPacketTriangle(const float3& V0,
+                                const float3& V1,
+                                const float3& V2,
+                                const float3* RayOrigins,
+                                const float3* RayDirections,
+                                Uint32        NumRays,
+                                float*        OutDist,
+                                bool          CullBackFace)
+{
+    DEV_CHECK_ERR(RayOrigins != nullptr && RayDirections != nullptr, "Ray origins and directions must not be null");
+    DEV_CHECK_ERR(OutDist != nullptr, "Output distance array must not be null");
+
+#if DILIGENT_ADVANCED_MATH_SIMD
+    const Vec3SIMD Tri0 = Splat(V0);
+    const Vec3SIMD Tri1 = Splat(V1);
+    const Vec3SIMD Tri2 = Splat(V2);
+    for (Uint32 i = 0; i < NumRays; i += SIMD::Width)
+    {
+        const size_t Count = std::min(size_t{NumRays - i}, SIMD::Width);
+
+        const SIMD::Vec t = IntersectRayTriangleSIMD(Tri0, Tri1, Tri2,
+                                                     LoadStrided(RayOrigins + i, 1, Count), LoadStrided(RayDirections + i, 1, Count),
+                                                     CullBackFace);
+
+        float Values[SIMD::Width];
+        SIMD::Store(Values, t);
+        for (size_t ray = 0; ray < Count; ++ray)
+            OutDist[i + ray] = Values[ray];
+    }
+#else
+    for (Uint32 ray = 0; ray < NumRays; ++ray)
+        OutDist[ray] = IntersectRayTriangle(V0, V1, V2, RayOrigins[ray], RayDirections[ray], CullBackFace);
+#endif
+}
+
+Uint32 IntersectRayTriangles(const float3& RayOrigin,
+                             const float3& RayDirection,
+                             const float3* TriangleVerts,
+                             Uint32        NumTriangles,
+                             float&        HitDist,
+                             bool          CullBackFace)
+{
+    DEV_CHECK_ERR(TriangleVerts != nullptr || NumTriangles == 0, "Triangle vertices must not be null");
+
+    Uint32 HitTriangle = ~0u;
+#if DILIGENT_ADVANCED_MATH_SIMD
+    const Vec3SIMD Origin    = Splat(RayOrigin);
+    const Vec3SIMD Direction = Splat(RayDirection);
+    for (Uint32 i = 0; i < NumTriangles; i += SIMD::Width)
+    {
+        const size_t  Count = std::min(size_t{NumTriangles - i}, SIMD::Width);
+        const float3* pTri  = TriangleVerts + size_t{i} * 3;
+
+        const SIMD::Vec t = IntersectRayTriangleSIMD(LoadStrided(pTri + 0, 3, Count), LoadStrided(pTri + 1, 3, Count), LoadStrided(pTri + 2, 3, Count),
+                                                     Origin, Direction, CullBackFace);
+
+        float Values[SIMD::Width];
+        SIMD::Store(Values, t);
+        for (size_t tri = 0; tri < Count; ++tri)
+        {
+            if (Values[tri] >= 0 && Values[tri] < HitDist)
+            {
+                HitDist     = Values[tri];
+                HitTriangle = i + static_cast<Uint32>(tri);
+            }
+        }
+    }
+#else
+    for (Uint32 tri = 0; tri < NumTriangles; ++tri)
+    {
+        const float3* pTri = TriangleVerts + size_t{tri} * 3;
+
+        const float t = IntersectRayTriangle(pTri[0], pTri[1], pTri[2], RayOrigin, RayDirection, CullBackFace);
+        if (t >= 0 && t < HitDist)
+        {
+            HitDist     = t;
+            HitTriangle = tri;
+        }
+    }
+#endif
+
+    return HitTriangle;
+}
+
+} // namespace Diligent
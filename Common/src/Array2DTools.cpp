@@ -27,17 +27,115 @@
 #include "Array2DTools.hpp"
 
 #include <algorithm>
+#include <vector>
 
 #include "Intrinsics.hpp"
 #include "DebugUtilities.hpp"
 #include "Align.hpp"
 
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_ARRAY2D_NEON 1
+#elif DILIGENT_AVX2_SUPPORTED && (defined(_MSC_VER) || defined(__SSE2__))
+#    define DILIGENT_ARRAY2D_SSE 1
+#endif
+
+#if DILIGENT_ARRAY2D_NEON || DILIGENT_ARRAY2D_SSE
+#    define DILIGENT_ARRAY2D_SIMD 1
+#endif
+
 namespace Diligent
 {
 
 namespace
 {
 
+#if DILIGENT_ARRAY2D_SSE
+using Float4 = __m128;
+
+// clang-format off
+inline Float4 Load4(const float* p)           { return _mm_loadu_ps(p); }
+inline void   Store4(float* p, Float4 v)      { _mm_storeu_ps(p, v); }
+inline Float4 Min4(Float4 a, Float4 b)        { return _mm_min_ps(a, b); }
+inline Float4 Max4(Float4 a, Float4 b)        { return _mm_max_ps(a, b); }
+// (min(a0, a1), min(a2, a3), min(b0, b1), min(b2, b3))
+inline Float4 PairMin4(Float4 a, Float4 b)    { return _mm_min_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))); }
+inline Float4 PairMax4(Float4 a, Float4 b)    { return _mm_max_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))); }
+// clang-format on
+
+inline float HorizontalMin4(Float4 v)
+{
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(v);
+}
+
+inline float HorizontalMax4(Float4 v)
+{
+    v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(v);
+}
+#elif DILIGENT_ARRAY2D_NEON
+using Float4 = float32x4_t;
+
+// clang-format off
+inline Float4 Load4(const float* p)           { return vld1q_f32(p); }
+inline void   Store4(float* p, Float4 v)      { vst1q_f32(p, v); }
+inline Float4 Min4(Float4 a, Float4 b)        { return vminq_f32(a, b); }
+inline Float4 Max4(Float4 a, Float4 b)        { return vmaxq_f32(a, b); }
+inline Float4 PairMin4(Float4 a, Float4 b)    { return vpminq_f32(a, b); }
+inline Float4 PairMax4(Float4 a, Float4 b)    { return vpmaxq_f32(a, b); }
+inline float  HorizontalMin4(Float4 v)        { return vminvq_f32(v); }
+inline float  HorizontalMax4(Float4 v)        { return vmaxvq_f32(v); }
+// clang-format on
+#endif
+
+// Updates MinValue and MaxValue with the values of the row.
+inline void GetRowMinMaxValue(const float* pRow, Uint32 Width, float& MinValue, float& MaxValue)
+{
+    Uint32 x = 0;
+#if DILIGENT_ARRAY2D_SIMD
+    if (Width >= 4)
+    {
+        Float4 Min = Load4(pRow);
+        Float4 Max = Min;
+        for (x = 4; x + 4 <= Width; x += 4)
+        {
+            const Float4 Val = Load4(pRow + x);
+            Min              = Min4(Min, Val);
+            Max              = Max4(Max, Val);
+        }
+        MinValue = std::min(MinValue, HorizontalMin4(Min));
+        MaxValue = std::max(MaxValue, HorizontalMax4(Max));
+    }
+#endif
+    for (; x < Width; ++x)
+    {
+        MinValue = std::min(MinValue, pRow[x]);
+        MaxValue = std::max(MaxValue, pRow[x]);
+    }
+}
+
+// Computes per-column minimum and maximum of two pairs of rows.
+inline void ColumnMinMax(const float* pMin0, const float* pMax0, const float* pMin1, const float* pMax1, Uint32 Width, float* pMin, float* pMax)
+{
+    Uint32 x = 0;
+#if DILIGENT_ARRAY2D_SIMD
+    for (; x + 4 <= Width; x += 4)
+    {
+        Store4(pMin + x, Min4(Load4(pMin0 + x), Load4(pMin1 + x)));
+        Store4(pMax + x, Max4(Load4(pMax0 + x), Load4(pMax1 + x)));
+    }
+#endif
+    for (; x < Width; ++x)
+    {
+        pMin[x] = std::min(pMin0[x], pMin1[x]);
+        pMax[x] = std::max(pMax0[x], pMax1[x]);
+    }
+}
+
+
 void GetArray2DMinMaxValueGeneric(const float* pData,
                                   size_t       StrideInFloats,
                                   Uint32       Width,
@@ -47,13 +145,7 @@ void GetArray2DMinMaxValueGeneric(const float* pData,
 {
     for (size_t row = 0; row < Height; ++row)
     {
-        const float* pRowStart = pData + row * StrideInFloats;
-        const float* pRowEnd   = pRowStart + Width;
-        for (const float* ptr = pRowStart; ptr < pRowEnd; ++ptr)
-        {
-            MinValue = std::min(MinValue, *ptr);
-            MaxValue = std::max(MaxValue, *ptr);
-        }
+        GetRowMinMaxValue(pData + row * StrideInFloats, Width, MinValue, MaxValue);
     }
 }
 
@@ -152,4 +244,254 @@ void GetArray2DMinMaxValue(const float* pData,
     GetArray2DMinMaxValueGeneric(pData, StrideInFloats, Width, Height, MinValue, MaxValue);
 }
 
+double GetArray2DSum(const float* pData,
+                     size_t       StrideInFloats,
+                     Uint32       Width,
+                     Uint32       Height)
+{
+    if (Width == 0 || Height == 0)
+        return 0;
+
+    DEV_CHECK_ERR(pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(Height == 1 || StrideInFloats >= Width, "Row stride (", StrideInFloats, ") must be at least ", Width);
+
+    double Sum = 0;
+#if DILIGENT_ARRAY2D_SSE
+    __m128d Sum01 = _mm_setzero_pd();
+    __m128d Sum23 = _mm_setzero_pd();
+#elif DILIGENT_ARRAY2D_NEON
+    float64x2_t Sum01 = vdupq_n_f64(0);
+    float64x2_t Sum23 = vdupq_n_f64(0);
+#endif
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRow = pData + row * StrideInFloats;
+
+        Uint32 x = 0;
+#if DILIGENT_ARRAY2D_SSE
+        for (; x + 4 <= Width; x += 4)
+        {
+            const __m128 Val = _mm_loadu_ps(pRow + x);
+            Sum01            = _mm_add_pd(Sum01, _mm_cvtps_pd(Val));
+            Sum23            = _mm_add_pd(Sum23, _mm_cvtps_pd(_mm_movehl_ps(Val, Val)));
+        }
+#elif DILIGENT_ARRAY2D_NEON
+        for (; x + 4 <= Width; x += 4)
+        {
+            const float32x4_t Val = vld1q_f32(pRow + x);
+            Sum01                 = vaddq_f64(Sum01, vcvt_f64_f32(vget_low_f32(Val)));
+            Sum23                 = vaddq_f64(Sum23, vcvt_high_f64_f32(Val));
+        }
+#endif
+        for (; x < Width; ++x)
+            Sum += pRow[x];
+    }
+
+#if DILIGENT_ARRAY2D_SSE
+    Sum01 = _mm_add_pd(Sum01, Sum23);
+    Sum += _mm_cvtsd_f64(_mm_add_sd(Sum01, _mm_unpackhi_pd(Sum01, Sum01)));
+#elif DILIGENT_ARRAY2D_NEON
+    Sum += vaddvq_f64(vaddq_f64(Sum01, Sum23));
+#endif
+
+    return Sum;
+}
+
+void ComputeArray2DHistogram(const float* pData,
+                             size_t       StrideInFloats,
+                             Uint32       Width,
+                             Uint32       Height,
+                             float        RangeMin,
+                             float        RangeMax,
+                             Uint32       NumBins,
+                             Uint32*      pBins)
+{
+    if (NumBins == 0)
+        return;
+
+    DEV_CHECK_ERR(pBins != nullptr, "Bins pointer must not be null");
+    DEV_CHECK_ERR(RangeMax > RangeMin, "Invalid histogram range [", RangeMin, ", ", RangeMax, "]");
+    std::fill(pBins, pBins + NumBins, 0u);
+
+    if (Width == 0 || Height == 0)
+        return;
+
+    DEV_CHECK_ERR(pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(Height == 1 || StrideInFloats >= Width, "Row stride (", StrideInFloats, ") must be at least ", Width);
+
+    const float Scale  = static_cast<float>(NumBins) / (RangeMax - RangeMin);
+    const float MaxBin = static_cast<float>(NumBins - 1);
+
+    // Use four sets of counters so that equal bins of adjacent values
+    // do not serialize on the same memory location.
+    std::vector<Uint32> Counters(size_t{NumBins} * 4);
+    Uint32*             pCounters[4] = {
+        &Counters[0],
+        &Counters[NumBins],
+        &Counters[NumBins * 2],
+        &Counters[NumBins * 3],
+    };
+
+#if DILIGENT_ARRAY2D_SIMD
+    alignas(16) Int32 Idx[4];
+#    if DILIGENT_ARRAY2D_SSE
+    const __m128 mmRangeMin = _mm_set1_ps(RangeMin);
+    const __m128 mmScale    = _mm_set1_ps(Scale);
+    const __m128 mmMaxBin   = _mm_set1_ps(MaxBin);
+#    else
+    const float32x4_t mmRangeMin = vdupq_n_f32(RangeMin);
+    const float32x4_t mmScale    = vdupq_n_f32(Scale);
+    const float32x4_t mmMaxBin   = vdupq_n_f32(MaxBin);
+#    endif
+#endif
+
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRow = pData + row * StrideInFloats;
+
+        Uint32 x = 0;
+#if DILIGENT_ARRAY2D_SIMD
+        for (; x + 4 <= Width; x += 4)
+        {
+#    if DILIGENT_ARRAY2D_SSE
+            __m128 Bin = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(pRow + x), mmRangeMin), mmScale);
+            // Bin is the first operand so that NaN values go to the first bin
+            Bin = _mm_min_ps(_mm_max_ps(Bin, _mm_setzero_ps()), mmMaxBin);
+            _mm_store_si128(reinterpret_cast<__m128i*>(Idx), _mm_cvttps_epi32(Bin));
+#    else
+            float32x4_t Bin = vmulq_f32(vsubq_f32(vld1q_f32(pRow + x), mmRangeMin), mmScale);
+            // vmaxnmq returns the number when the other operand is NaN
+            Bin = vminq_f32(vmaxnmq_f32(Bin, vdupq_n_f32(0)), mmMaxBin);
+            vst1q_s32(Idx, vcvtq_s32_f32(Bin));
+#    endif
+            ++pCounters[0][Idx[0]];
+            ++pCounters[1][Idx[1]];
+            ++pCounters[2][Idx[2]];
+            ++pCounters[3][Idx[3]];
+        }
+#endif
+        for (; x < Width; ++x)
+        {
+            float Bin = (pRow[x] - RangeMin) * Scale;
+            Bin       = Bin > 0 ? Bin : 0;
+            Bin       = Bin < MaxBin ? Bin : MaxBin;
+            ++pCounters[0][static_cast<Uint32>(Bin)];
+        }
+    }
+
+    for (Uint32 i = 0; i < NumBins; ++i)
+        pBins[i] = pCounters[0][i] + pCounters[1][i] + pCounters[2][i] + pCounters[3][i];
+}
+
+void GetArray2DTileMinMaxValues(const float* pData,
+                                size_t       StrideInFloats,
+                                Uint32       Width,
+                                Uint32       Height,
+                                Uint32       TileSize,
+                                float*       pMinValues,
+                                float*       pMaxValues,
+                                size_t       DstStrideInFloats)
+{
+    if (Width == 0 || Height == 0)
+        return;
+
+    DEV_CHECK_ERR(pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(pMinValues != nullptr && pMaxValues != nullptr, "Destination pointers must not be null");
+    DEV_CHECK_ERR(TileSize > 0, "Tile size must not be zero");
+    DEV_CHECK_ERR(Height == 1 || StrideInFloats >= Width, "Row stride (", StrideInFloats, ") must be at least ", Width);
+
+    const Uint32 NumTilesX = (Width + TileSize - 1) / TileSize;
+    const Uint32 NumTilesY = (Height + TileSize - 1) / TileSize;
+    DEV_CHECK_ERR(NumTilesY == 1 || DstStrideInFloats >= NumTilesX, "Destination row stride (", DstStrideInFloats, ") must be at least ", NumTilesX);
+
+    // Per-column min/max of the rows in the current tile row
+    std::vector<float> ColumnMin(Width);
+    std::vector<float> ColumnMax(Width);
+    for (Uint32 ty = 0; ty < NumTilesY; ++ty)
+    {
+        const Uint32 StartRow = ty * TileSize;
+        const Uint32 EndRow   = std::min(StartRow + TileSize, Height);
+
+        const float* pFirstRow = pData + StartRow * StrideInFloats;
+        std::copy(pFirstRow, pFirstRow + Width, ColumnMin.begin());
+        std::copy(pFirstRow, pFirstRow + Width, ColumnMax.begin());
+        for (Uint32 row = StartRow + 1; row < EndRow; ++row)
+        {
+            const float* pRow = pData + row * StrideInFloats;
+            ColumnMinMax(ColumnMin.data(), ColumnMax.data(), pRow, pRow, Width, ColumnMin.data(), ColumnMax.data());
+        }
+
+        float* pDstMin = pMinValues + ty * DstStrideInFloats;
+        float* pDstMax = pMaxValues + ty * DstStrideInFloats;
+        for (Uint32 tx = 0; tx < NumTilesX; ++tx)
+        {
+            const Uint32 StartCol = tx * TileSize;
+            const Uint32 TileW    = std::min(TileSize, Width - StartCol);
+
+            float MinValue = ColumnMin[StartCol];
+            float MaxOfMin = MinValue;
+            GetRowMinMaxValue(&ColumnMin[StartCol], TileW, MinValue, MaxOfMin);
+
+            float MaxValue = ColumnMax[StartCol];
+            float MinOfMax = MaxValue;
+            GetRowMinMaxValue(&ColumnMax[StartCol], TileW, MinOfMax, MaxValue);
+
+            pDstMin[tx] = MinValue;
+            pDstMax[tx] = MaxValue;
+        }
+    }
+}
+
+void ComputeArray2DMinMaxMip(const float* pFineMin,
+                             const float* pFineMax,
+                             size_t       FineStride,
+                             Uint32       FineWidth,
+                             Uint32       FineHeight,
+                             float*       pCoarseMin,
+                             float*       pCoarseMax,
+                             size_t       CoarseStride)
+{
+    if (FineWidth == 0 || FineHeight == 0)
+        return;
+
+    DEV_CHECK_ERR(pFineMin != nullptr && pFineMax != nullptr, "Fine level pointers must not be null");
+    DEV_CHECK_ERR(pCoarseMin != nullptr && pCoarseMax != nullptr, "Coarse level pointers must not be null");
+
+    const Uint32 CoarseWidth  = (FineWidth + 1) / 2;
+    const Uint32 CoarseHeight = (FineHeight + 1) / 2;
+    DEV_CHECK_ERR(FineHeight == 1 || FineStride >= FineWidth, "Fine level row stride (", FineStride, ") must be at least ", FineWidth);
+    DEV_CHECK_ERR(CoarseHeight == 1 || CoarseStride >= CoarseWidth, "Coarse level row stride (", CoarseStride, ") must be at least ", CoarseWidth);
+
+    std::vector<float> RowMin(FineWidth);
+    std::vector<float> RowMax(FineWidth);
+    for (Uint32 y = 0; y < CoarseHeight; ++y)
+    {
+        const size_t Row0 = size_t{y} * 2;
+        const size_t Row1 = std::min(Row0 + 1, size_t{FineHeight} - 1);
+        ColumnMinMax(pFineMin + Row0 * FineStride, pFineMax + Row0 * FineStride,
+                     pFineMin + Row1 * FineStride, pFineMax + Row1 * FineStride,
+                     FineWidth, RowMin.data(), RowMax.data());
+
+        float* pDstMin = pCoarseMin + y * CoarseStride;
+        float* pDstMax = pCoarseMax + y * CoarseStride;
+
+        Uint32 x = 0;
+#if DILIGENT_ARRAY2D_SIMD
+        // Every iteration reduces 8 fine columns to 4 coarse ones
+        for (; (x + 4) * 2 <= FineWidth; x += 4)
+        {
+            Store4(pDstMin + x, PairMin4(Load4(&RowMin[x * 2]), Load4(&RowMin[x * 2 + 4])));
+            Store4(pDstMax + x, PairMax4(Load4(&RowMax[x * 2]), Load4(&RowMax[x * 2 + 4])));
+        }
+#endif
+        for (; x < CoarseWidth; ++x)
+        {
+            const Uint32 Col0 = x * 2;
+            const Uint32 Col1 = std::min(Col0 + 1, FineWidth - 1);
+            pDstMin[x]        = std::min(RowMin[Col0], RowMin[Col1]);
+            pDstMax[x]        = std::max(RowMax[Col0], RowMax[Col1]);
+        }
+    }
+}
+
 } // namespace Diligent
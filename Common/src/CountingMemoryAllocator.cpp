@@ -0,0 +1,201 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "CountingMemoryAllocator.hpp"
+
+#include <algorithm>
+
+#include "EngineMemory.h"
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// The header is placed right before the pointer returned to the caller.
+struct AllocationHeader
+{
+    size_t Size;
+    size_t Offset; // Offset from the start of the underlying allocation
+};
+static constexpr size_t MinHeaderSize = 16;
+static_assert(sizeof(AllocationHeader) <= MinHeaderSize, "Allocation header does not fit into the minimal header size");
+
+void* WriteHeader(void* pRawPtr, size_t Size, size_t HeaderSize)
+{
+    void* Ptr = reinterpret_cast<Uint8*>(pRawPtr) + HeaderSize;
+
+    AllocationHeader& Header = reinterpret_cast<AllocationHeader*>(Ptr)[-1];
+    Header.Size              = Size;
+    Header.Offset            = HeaderSize;
+    return Ptr;
+}
+
+const AllocationHeader& ReadHeader(void* Ptr)
+{
+    return reinterpret_cast<const AllocationHeader*>(Ptr)[-1];
+}
+
+} // namespace
+
+CountingMemoryAllocator::CountingMemoryAllocator(IMemoryAllocator* pAllocator, CountingMemoryAllocator* pParent) noexcept :
+    m_pAllocator{pAllocator},
+    m_pParent{pParent}
+{
+}
+
+IMemoryAllocator& CountingMemoryAllocator::GetAllocator() const
+{
+    return m_pAllocator != nullptr ? *m_pAllocator : GetRawAllocator();
+}
+
+void CountingMemoryAllocator::OnAllocate(size_t Size)
+{
+    const Uint64 LiveBytes = m_LiveBytes.fetch_add(Size, std::memory_order_relaxed) + Size;
+    m_LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+    m_TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+    m_TotalAllocatedBytes.fetch_add(Size, std::memory_order_relaxed);
+
+    Uint64 PeakBytes = m_PeakBytes.load(std::memory_order_relaxed);
+    while (LiveBytes > PeakBytes && !m_PeakBytes.compare_exchange_weak(PeakBytes, LiveBytes, std::memory_order_relaxed))
+    {
+    }
+
+    if (m_pParent != nullptr)
+        m_pParent->OnAllocate(Size);
+}
+
+void CountingMemoryAllocator::OnFree(size_t Size)
+{
+    VERIFY(m_LiveBytes.load(std::memory_order_relaxed) >= Size, "Releasing more memory than has been allocated");
+    m_LiveBytes.fetch_sub(Size, std::memory_order_relaxed);
+    m_LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+    if (m_pParent != nullptr)
+        m_pParent->OnFree(Size);
+}
+
+void* CountingMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    void* pRawPtr = GetAllocator().Allocate(Size + MinHeaderSize, dbgDescription, dbgFileName, dbgLineNumber);
+    if (pRawPtr == nullptr)
+        return nullptr;
+
+    OnAllocate(Size);
+    return WriteHeader(pRawPtr, Size, MinHeaderSize);
+}
+
+void CountingMemoryAllocator::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    const AllocationHeader& Header = ReadHeader(Ptr);
+    VERIFY(Header.Offset == MinHeaderSize, "Memory must be released by the allocator it was allocated with");
+    OnFree(Header.Size);
+    GetAllocator().Free(reinterpret_cast<Uint8*>(Ptr) - Header.Offset);
+}
+
+void* CountingMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of 2");
+
+    // Keep the returned pointer aligned by making the header a multiple of the alignment
+    const size_t HeaderSize = (std::max)(Alignment, MinHeaderSize);
+
+    void* pRawPtr = GetAllocator().AllocateAligned(Size + HeaderSize, Alignment, dbgDescription, dbgFileName, dbgLineNumber);
+    if (pRawPtr == nullptr)
+        return nullptr;
+
+    OnAllocate(Size);
+    return WriteHeader(pRawPtr, Size, HeaderSize);
+}
+
+void CountingMemoryAllocator::FreeAligned(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    const AllocationHeader& Header = ReadHeader(Ptr);
+    OnFree(Header.Size);
+    GetAllocator().FreeAligned(reinterpret_cast<Uint8*>(Ptr) - Header.Offset);
+}
+
+MemoryCategoryStats CountingMemoryAllocator::GetStats() const
+{
+    MemoryCategoryStats Stats;
+    Stats.LiveBytes           = m_LiveBytes.load(std::memory_order_relaxed);
+    Stats.PeakBytes           = m_PeakBytes.load(std::memory_order_relaxed);
+    Stats.LiveAllocations     = m_LiveAllocations.load(std::memory_order_relaxed);
+    Stats.TotalAllocations    = m_TotalAllocations.load(std::memory_order_relaxed);
+    Stats.TotalAllocatedBytes = m_TotalAllocatedBytes.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+CountingMemoryAllocator& CountingMemoryAllocator::GetGlobalAllocator(MEMORY_CATEGORY Category)
+{
+    static_assert(MEMORY_CATEGORY_COUNT == 5, "Please update the initializer list below to handle the new memory category");
+    static std::array<CountingMemoryAllocator, MEMORY_CATEGORY_COUNT> GlobalAllocators{{
+        {nullptr},
+        {nullptr},
+        {nullptr},
+        {nullptr},
+        {nullptr},
+    }};
+    VERIFY_EXPR(Category < MEMORY_CATEGORY_COUNT);
+    return GlobalAllocators[Category];
+}
+
+CategoryMemoryAllocators::CategoryMemoryAllocators(IMemoryAllocator& Allocator) noexcept :
+    // clang-format off
+    m_Allocators
+    {{
+        {&Allocator, &CountingMemoryAllocator::GetGlobalAllocator(MEMORY_CATEGORY_DEVICE_OBJECTS)},
+        {&Allocator, &CountingMemoryAllocator::GetGlobalAllocator(MEMORY_CATEGORY_SHADER_CACHE)},
+        {&Allocator, &CountingMemoryAllocator::GetGlobalAllocator(MEMORY_CATEGORY_SRB_CACHE)},
+        {&Allocator, &CountingMemoryAllocator::GetGlobalAllocator(MEMORY_CATEGORY_STAGING)},
+        {&Allocator, &CountingMemoryAllocator::GetGlobalAllocator(MEMORY_CATEGORY_ARCHIVE)},
+    }}
+// clang-format on
+{
+    static_assert(MEMORY_CATEGORY_COUNT == 5, "Please update the initializer list above to handle the new memory category");
+}
+
+IMemoryAllocator& GetRawAllocator(MEMORY_CATEGORY Category)
+{
+    return CountingMemoryAllocator::GetGlobalAllocator(Category);
+}
+
+MemoryCategoryStats GetMemoryCategoryStats(MEMORY_CATEGORY Category)
+{
+    return CountingMemoryAllocator::GetGlobalAllocator(Category).GetStats();
+}
+
+} // namespace Diligent
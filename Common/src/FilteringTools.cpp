@@ -0,0 +1,202 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "FilteringTools.hpp"
+
+#include "Intrinsics.hpp"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_FILTERING_TOOLS_NEON 1
+#elif DILIGENT_AVX2_SUPPORTED && (defined(_MSC_VER) || defined(__SSE2__))
+#    define DILIGENT_FILTERING_TOOLS_SSE 1
+#endif
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Fetches the four bilinear footprint texels of four samples.
+template <typename SrcType>
+void FetchBilinearSamples4(const SrcType* pData,
+                           size_t         Stride,
+                           const Int32    U0[4],
+                           const Int32    U1[4],
+                           const Int32    V0[4],
+                           const Int32    V1[4],
+                           float          S00[4],
+                           float          S10[4],
+                           float          S01[4],
+                           float          S11[4])
+{
+    for (size_t i = 0; i < 4; ++i)
+    {
+        const SrcType* pRow0 = pData + static_cast<size_t>(V0[i]) * Stride;
+        const SrcType* pRow1 = pData + static_cast<size_t>(V1[i]) * Stride;
+
+        S00[i] = static_cast<float>(pRow0[U0[i]]);
+        S10[i] = static_cast<float>(pRow0[U1[i]]);
+        S01[i] = static_cast<float>(pRow1[U0[i]]);
+        S11[i] = static_cast<float>(pRow1[U1[i]]);
+    }
+}
+
+#if DILIGENT_FILTERING_TOOLS_SSE
+
+// SIMD version of GetLinearTexFilterSampleInfo<TEXTURE_ADDRESS_CLAMP, IsNormalizedCoord>() for four coordinates.
+template <bool IsNormalizedCoord>
+__m128 GetLinearTexFilterSampleInfoClamp4(Uint32 Width, __m128 u, Int32 i0[4], Int32 i1[4])
+{
+    const __m128 fWidth = _mm_set1_ps(static_cast<float>(Width));
+
+    __m128 x = IsNormalizedCoord ? _mm_mul_ps(u, fWidth) : u;
+    // Coordinates outside of [-1, Width + 1] produce the same clamped indices, and
+    // limiting the range keeps the integer conversion below well-defined (NaN becomes -1).
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-1.f)), _mm_add_ps(fWidth, _mm_set1_ps(1.f)));
+
+    const __m128 xc = _mm_sub_ps(x, _mm_set1_ps(0.5f));
+    // Floor: truncate and subtract one from negative non-integer values
+    const __m128 xt = _mm_cvtepi32_ps(_mm_cvttps_epi32(xc));
+    const __m128 x0 = _mm_sub_ps(xt, _mm_and_ps(_mm_cmpgt_ps(xt, xc), _mm_set1_ps(1.f)));
+
+    const __m128 MaxIdx = _mm_set1_ps(static_cast<float>(Width - 1));
+    const __m128 Zero   = _mm_setzero_ps();
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(i0), _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(x0, Zero), MaxIdx)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(i1), _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(x0, _mm_set1_ps(1.f)), Zero), MaxIdx)));
+
+    return _mm_sub_ps(xc, x0);
+}
+
+inline __m128 Lerp4(__m128 Left, __m128 Right, __m128 w)
+{
+    return _mm_add_ps(_mm_mul_ps(Left, _mm_sub_ps(_mm_set1_ps(1.f), w)), _mm_mul_ps(Right, w));
+}
+
+#elif DILIGENT_FILTERING_TOOLS_NEON
+
+template <bool IsNormalizedCoord>
+float32x4_t GetLinearTexFilterSampleInfoClamp4(Uint32 Width, float32x4_t u, Int32 i0[4], Int32 i1[4])
+{
+    const float32x4_t fWidth = vdupq_n_f32(static_cast<float>(Width));
+
+    float32x4_t x = IsNormalizedCoord ? vmulq_f32(u, fWidth) : u;
+    // vmaxnmq returns the number when one operand is NaN
+    x = vminq_f32(vmaxnmq_f32(x, vdupq_n_f32(-1.f)), vaddq_f32(fWidth, vdupq_n_f32(1.f)));
+
+    const float32x4_t xc = vsubq_f32(x, vdupq_n_f32(0.5f));
+    const float32x4_t x0 = vrndmq_f32(xc);
+
+    const float32x4_t MaxIdx = vdupq_n_f32(static_cast<float>(Width - 1));
+    const float32x4_t Zero   = vdupq_n_f32(0.f);
+    vst1q_s32(i0, vcvtq_s32_f32(vminq_f32(vmaxq_f32(x0, Zero), MaxIdx)));
+    vst1q_s32(i1, vcvtq_s32_f32(vminq_f32(vmaxq_f32(vaddq_f32(x0, vdupq_n_f32(1.f)), Zero), MaxIdx)));
+
+    return vsubq_f32(xc, x0);
+}
+
+inline float32x4_t Lerp4(float32x4_t Left, float32x4_t Right, float32x4_t w)
+{
+    return vaddq_f32(vmulq_f32(Left, vsubq_f32(vdupq_n_f32(1.f), w)), vmulq_f32(Right, w));
+}
+
+#endif
+
+template <typename SrcType, bool IsNormalizedCoord>
+void FilterTexture2DBilinearClampBatch(Uint32         Width,
+                                       Uint32         Height,
+                                       const SrcType* pData,
+                                       size_t         Stride,
+                                       const float2*  pUVs,
+                                       float*         pDst,
+                                       size_t         NumSamples)
+{
+    VERIFY_EXPR(Width > 0 && Height > 0 && pData != nullptr);
+    VERIFY_EXPR(NumSamples == 0 || (pUVs != nullptr && pDst != nullptr));
+
+    size_t i = 0;
+#if DILIGENT_FILTERING_TOOLS_SSE || DILIGENT_FILTERING_TOOLS_NEON
+    alignas(16) Int32 U0[4], U1[4], V0[4], V1[4];
+    alignas(16) float S00[4], S10[4], S01[4], S11[4];
+    for (; i + 4 <= NumSamples; i += 4)
+    {
+#    if DILIGENT_FILTERING_TOOLS_SSE
+        // De-interleave (u0, v0, u1, v1), (u2, v2, u3, v3)
+        const __m128 UV01 = _mm_loadu_ps(&pUVs[i].x);
+        const __m128 UV23 = _mm_loadu_ps(&pUVs[i + 2].x);
+        const __m128 u    = _mm_shuffle_ps(UV01, UV23, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 v    = _mm_shuffle_ps(UV01, UV23, _MM_SHUFFLE(3, 1, 3, 1));
+
+        const __m128 wu = GetLinearTexFilterSampleInfoClamp4<IsNormalizedCoord>(Width, u, U0, U1);
+        const __m128 wv = GetLinearTexFilterSampleInfoClamp4<IsNormalizedCoord>(Height, v, V0, V1);
+
+        FetchBilinearSamples4(pData, Stride, U0, U1, V0, V1, S00, S10, S01, S11);
+
+        const __m128 Top    = Lerp4(_mm_load_ps(S00), _mm_load_ps(S10), wu);
+        const __m128 Bottom = Lerp4(_mm_load_ps(S01), _mm_load_ps(S11), wu);
+        _mm_storeu_ps(pDst + i, Lerp4(Top, Bottom, wv));
+#    else
+        const float32x4x2_t UV = vld2q_f32(&pUVs[i].x);
+
+        const float32x4_t wu = GetLinearTexFilterSampleInfoClamp4<IsNormalizedCoord>(Width, UV.val[0], U0, U1);
+        const float32x4_t wv = GetLinearTexFilterSampleInfoClamp4<IsNormalizedCoord>(Height, UV.val[1], V0, V1);
+
+        FetchBilinearSamples4(pData, Stride, U0, U1, V0, V1, S00, S10, S01, S11);
+
+        const float32x4_t Top    = Lerp4(vld1q_f32(S00), vld1q_f32(S10), wu);
+        const float32x4_t Bottom = Lerp4(vld1q_f32(S01), vld1q_f32(S11), wu);
+        vst1q_f32(pDst + i, Lerp4(Top, Bottom, wv));
+#    endif
+    }
+#endif
+
+    for (; i < NumSamples; ++i)
+    {
+        pDst[i] = FilterTexture2DBilinear<SrcType, float, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP, IsNormalizedCoord>(Width, Height, pData, Stride, pUVs[i].x, pUVs[i].y);
+    }
+}
+
+} // namespace
+
+#define DEFINE_FILTER_TEXTURE_2D_BILINEAR_CLAMP_BATCH(SrcType)                                                                                                \
+    void FilterTexture2DBilinearClamp(Uint32 Width, Uint32 Height, const SrcType* pData, size_t Stride, const float2* pUVs, float* pDst, size_t NumSamples)   \
+    {                                                                                                                                                         \
+        FilterTexture2DBilinearClampBatch<SrcType, true>(Width, Height, pData, Stride, pUVs, pDst, NumSamples);                                               \
+    }                                                                                                                                                         \
+    void FilterTexture2DBilinearClampUC(Uint32 Width, Uint32 Height, const SrcType* pData, size_t Stride, const float2* pUVs, float* pDst, size_t NumSamples) \
+    {                                                                                                                                                         \
+        FilterTexture2DBilinearClampBatch<SrcType, false>(Width, Height, pData, Stride, pUVs, pDst, NumSamples);                                              \
+    }
+
+DEFINE_FILTER_TEXTURE_2D_BILINEAR_CLAMP_BATCH(Uint8)
+DEFINE_FILTER_TEXTURE_2D_BILINEAR_CLAMP_BATCH(Uint16)
+DEFINE_FILTER_TEXTURE_2D_BILINEAR_CLAMP_BATCH(float)
+
+#undef DEFINE_FILTER_TEXTURE_2D_BILINEAR_CLAMP_BATCH
+
+} // namespace Diligent
@@ -27,6 +27,7 @@
 
 #include "pch.h"
 #include <algorithm>
+#include <atomic>
 #include "FixedBlockMemoryAllocator.hpp"
 #include "Align.hpp"
 
@@ -164,21 +165,83 @@ void FixedBlockMemoryAllocator::MemoryPage::DeAllocate(void* p)
 }
 
 
+// Free blocks cached by one thread.
+// The cache is only accessed by the thread that owns it, with the exception of
+// the allocator destructor and orphaned caches (whose thread has exited).
+struct alignas(64) FixedBlockMemoryAllocator::ThreadCache
+{
+    std::vector<void*> Blocks;
+
+    // Mirrors Blocks.size() for statistics
+    std::atomic<size_t> NumBlocks{0};
+
+    // Set by the thread-local cache list when the thread exits
+    std::atomic<bool> Orphaned{false};
+
+    // Set by the allocator when it is destroyed
+    std::atomic<bool> Detached{false};
+};
+
+// Caches of all allocators that the thread has used
+struct FixedBlockMemoryAllocator::ThreadCacheList
+{
+    struct Entry
+    {
+        Uint64                       AllocatorId = 0;
+        std::shared_ptr<ThreadCache> pCache;
+    };
+    std::vector<Entry> Entries;
+
+    ~ThreadCacheList()
+    {
+        for (Entry& E : Entries)
+            E.pCache->Orphaned.store(true, std::memory_order_release);
+    }
+
+    ThreadCache* Find(Uint64 AllocatorId) const
+    {
+        for (const Entry& E : Entries)
+        {
+            if (E.AllocatorId == AllocatorId)
+                return E.pCache.get();
+        }
+        return nullptr;
+    }
+
+    void RemoveDetached()
+    {
+        Entries.erase(std::remove_if(Entries.begin(), Entries.end(),
+                                     [](const Entry& E) {
+                                         return E.pCache->Detached.load(std::memory_order_acquire);
+                                     }),
+                      Entries.end());
+    }
+};
+
 static size_t AdjustBlockSize(size_t BlockSize)
 {
     return AlignUp(BlockSize, sizeof(void*));
 }
 
+static Uint64 GetNextAllocatorId()
+{
+    static std::atomic<Uint64> NextId{0};
+    return NextId.fetch_add(1, std::memory_order_relaxed);
+}
+
 FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator,
                                                      size_t            BlockSize,
-                                                     Uint32            NumBlocksInPage) :
+                                                     Uint32            NumBlocksInPage,
+                                                     Uint32            ThreadCacheSize) :
     // clang-format off
     m_PagePool          (STD_ALLOCATOR_RAW_MEM(MemoryPage, RawMemoryAllocator, "Allocator for vector<MemoryPage>")),
     m_AvailablePages    (STD_ALLOCATOR_RAW_MEM(size_t, RawMemoryAllocator, "Allocator for unordered_set<size_t>") ),
     m_AddrToPageId      (STD_ALLOCATOR_RAW_MEM(AddrToPageIdMapElem, RawMemoryAllocator, "Allocator for unordered_map<void*, size_t>")),
     m_RawMemoryAllocator{RawMemoryAllocator        },
     m_BlockSize         {AdjustBlockSize(BlockSize)},
-    m_NumBlocksInPage   {NumBlocksInPage           }
+    m_NumBlocksInPage   {NumBlocksInPage           },
+    m_ThreadCacheSize   {ThreadCacheSize           },
+    m_Id                {GetNextAllocatorId()      }
 // clang-format on
 {
     // Allocate one page
@@ -190,6 +253,21 @@ FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemory
 
 FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
 {
+    {
+        std::lock_guard<std::mutex> LockGuard{m_Mutex};
+        // Return blocks from all thread caches to the pages.
+        // The threads that are still alive will remove the caches from their lists.
+        for (std::shared_ptr<ThreadCache>& pCache : m_ThreadCaches)
+        {
+            for (void* Ptr : pCache->Blocks)
+                FreeToPages(Ptr);
+            pCache->Blocks.clear();
+            pCache->NumBlocks.store(0, std::memory_order_relaxed);
+            pCache->Detached.store(true, std::memory_order_release);
+        }
+        m_ThreadCaches.clear();
+    }
+
 #ifdef DILIGENT_DEBUG
     for (size_t p = 0; p < m_PagePool.size(); ++p)
     {
@@ -207,15 +285,8 @@ void FixedBlockMemoryAllocator::CreateNewPage()
     m_AddrToPageId.reserve(m_PagePool.size() * m_NumBlocksInPage);
 }
 
-void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+void* FixedBlockMemoryAllocator::AllocateFromPages()
 {
-    VERIFY_EXPR(Size > 0);
-
-    Size = AdjustBlockSize(Size);
-    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
-
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-
     if (m_AvailablePages.empty())
     {
         CreateNewPage();
@@ -229,14 +300,14 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     {
         m_AvailablePages.erase(m_AvailablePages.begin());
     }
+    m_PeakNumBlocks = std::max(m_PeakNumBlocks, m_AddrToPageId.size());
 
     return Ptr;
 }
 
-void FixedBlockMemoryAllocator::Free(void* Ptr)
+void FixedBlockMemoryAllocator::FreeToPages(void* Ptr)
 {
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-    auto                        PageIdIt = m_AddrToPageId.find(Ptr);
+    auto PageIdIt = m_AddrToPageId.find(Ptr);
     if (PageIdIt != m_AddrToPageId.end())
     {
         size_t PageId = PageIdIt->second;
@@ -259,6 +330,146 @@ void FixedBlockMemoryAllocator::Free(void* Ptr)
     }
 }
 
+void FixedBlockMemoryAllocator::ReclaimOrphanedThreadCaches()
+{
+    for (size_t i = 0; i < m_ThreadCaches.size();)
+    {
+        ThreadCache& Cache = *m_ThreadCaches[i];
+        if (Cache.Orphaned.load(std::memory_order_acquire))
+        {
+            // The thread has exited, so nobody else can access the cache
+            for (void* Ptr : Cache.Blocks)
+                FreeToPages(Ptr);
+            Cache.Blocks.clear();
+            Cache.NumBlocks.store(0, std::memory_order_relaxed);
+
+            m_ThreadCaches[i] = std::move(m_ThreadCaches.back());
+            m_ThreadCaches.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+FixedBlockMemoryAllocator::ThreadCache& FixedBlockMemoryAllocator::GetThreadCache()
+{
+    static thread_local ThreadCacheList tl_Caches;
+
+    if (ThreadCache* pCache = tl_Caches.Find(m_Id))
+        return *pCache;
+
+    // This is the first time the thread uses the allocator.
+    // Remove the caches of the allocators that have been destroyed.
+    tl_Caches.RemoveDetached();
+
+    std::shared_ptr<ThreadCache> pCache = std::make_shared<ThreadCache>();
+    pCache->Blocks.reserve(m_ThreadCacheSize);
+    {
+        std::lock_guard<std::mutex> LockGuard{m_Mutex};
+        m_ThreadCaches.push_back(pCache);
+    }
+    tl_Caches.Entries.push_back({m_Id, pCache});
+
+    return *pCache;
+}
+
+void FixedBlockMemoryAllocator::RefillThreadCache(ThreadCache& Cache)
+{
+    VERIFY_EXPR(Cache.Blocks.empty());
+    const size_t NumBlocks = std::max(m_ThreadCacheSize / 2u, 1u);
+
+    std::lock_guard<std::mutex> LockGuard{m_Mutex};
+    ReclaimOrphanedThreadCaches();
+    for (size_t i = 0; i < NumBlocks; ++i)
+        Cache.Blocks.push_back(AllocateFromPages());
+}
+
+void FixedBlockMemoryAllocator::FlushThreadCache(ThreadCache& Cache, size_t NumBlocks)
+{
+    VERIFY_EXPR(NumBlocks <= Cache.Blocks.size());
+
+    {
+        std::lock_guard<std::mutex> LockGuard{m_Mutex};
+        ReclaimOrphanedThreadCaches();
+        // Return the least recently freed blocks
+        for (size_t i = 0; i < NumBlocks; ++i)
+            FreeToPages(Cache.Blocks[i]);
+    }
+    Cache.Blocks.erase(Cache.Blocks.begin(), Cache.Blocks.begin() + NumBlocks);
+    Cache.NumBlocks.store(Cache.Blocks.size(), std::memory_order_relaxed);
+}
+
+void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0);
+
+    Size = AdjustBlockSize(Size);
+    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
+
+    if (m_ThreadCacheSize == 0)
+    {
+        std::lock_guard<std::mutex> LockGuard{m_Mutex};
+        return AllocateFromPages();
+    }
+
+    ThreadCache& Cache = GetThreadCache();
+    if (Cache.Blocks.empty())
+        RefillThreadCache(Cache);
+
+    void* Ptr = Cache.Blocks.back();
+    Cache.Blocks.pop_back();
+    Cache.NumBlocks.store(Cache.Blocks.size(), std::memory_order_relaxed);
+    FillWithDebugPattern(Ptr, MemoryPage::AllocatedBlockMemPattern, m_BlockSize);
+
+    return Ptr;
+}
+
+void FixedBlockMemoryAllocator::Free(void* Ptr)
+{
+    if (m_ThreadCacheSize == 0)
+    {
+        std::lock_guard<std::mutex> LockGuard{m_Mutex};
+        FreeToPages(Ptr);
+        return;
+    }
+
+#ifdef DILIGENT_DEBUG
+    {
+        std::lock_guard<std::mutex> LockGuard{m_Mutex};
+        VERIFY(m_AddrToPageId.find(Ptr) != m_AddrToPageId.end(), "Address not found in the allocations list - the block was not allocated by this allocator");
+    }
+#endif
+
+    ThreadCache& Cache = GetThreadCache();
+    if (Cache.Blocks.size() >= m_ThreadCacheSize)
+        FlushThreadCache(Cache, std::max(m_ThreadCacheSize / 2u, 1u));
+
+    FillWithDebugPattern(Ptr, MemoryPage::DeallocatedBlockMemPattern, m_BlockSize);
+    Cache.Blocks.push_back(Ptr);
+    Cache.NumBlocks.store(Cache.Blocks.size(), std::memory_order_relaxed);
+}
+
+FixedBlockMemoryAllocator::Statistics FixedBlockMemoryAllocator::GetStatistics() const
+{
+    std::lock_guard<std::mutex> LockGuard{m_Mutex};
+
+    Statistics Stats;
+    Stats.BlockSize       = m_BlockSize;
+    Stats.NumBlocksInPage = m_NumBlocksInPage;
+    Stats.NumPages        = m_PagePool.size();
+    Stats.PeakNumBlocks   = m_PeakNumBlocks;
+    Stats.NumThreadCaches = m_ThreadCaches.size();
+    for (const std::shared_ptr<ThreadCache>& pCache : m_ThreadCaches)
+        Stats.NumCachedBlocks += pCache->NumBlocks.load(std::memory_order_relaxed);
+    // Cached block counts are updated without the lock and may be slightly off
+    Stats.NumCachedBlocks    = std::min(Stats.NumCachedBlocks, m_AddrToPageId.size());
+    Stats.NumAllocatedBlocks = m_AddrToPageId.size() - Stats.NumCachedBlocks;
+
+    return Stats;
+}
+
 void* FixedBlockMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
 {
     VERIFY(Alignment <= sizeof(void*), "Alignment (", Alignment, ") exceeds the default alignment (", sizeof(void*), ")");
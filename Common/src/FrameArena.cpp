@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "FrameArena.hpp"
+
+#include <atomic>
+
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+// Incremented every time a frame is finished by any device context
+static std::atomic<Uint64> g_FrameId{0};
+
+FrameArena::FrameArena() :
+    // Thread arenas may be destroyed at thread exit after the engine allocator has been
+    // released, so always use the default allocator for the arena pages.
+    m_Allocator{DefaultRawMemoryAllocator::GetAllocator(), 64 << 10},
+    m_FrameId{g_FrameId.load(std::memory_order_relaxed)}
+{
+}
+
+FrameArena& FrameArena::GetThreadArena()
+{
+    static thread_local FrameArena tl_Arena;
+    return tl_Arena;
+}
+
+void FrameArena::FinishFrame()
+{
+    g_FrameId.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FrameArena::EnterScope()
+{
+    if (m_ScopeDepth == 0)
+    {
+        const Uint64 FrameId = g_FrameId.load(std::memory_order_relaxed);
+        if (FrameId != m_FrameId)
+        {
+            // No allocations made by this thread are referenced at this point
+            m_Allocator.Discard();
+            m_FrameId = FrameId;
+        }
+    }
+    ++m_ScopeDepth;
+}
+
+void FrameArena::ExitScope()
+{
+    VERIFY(m_ScopeDepth > 0, "Unbalanced frame arena scope");
+    --m_ScopeDepth;
+}
+
+void* FrameArena::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    return AllocateAligned(Size, sizeof(void*), dbgDescription, dbgFileName, dbgLineNumber);
+}
+
+void* FrameArena::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    DEV_CHECK_ERR(m_ScopeDepth > 0, "Frame arena memory must only be allocated within a FrameArena::Scope");
+    DEV_CHECK_ERR(this == &GetThreadArena(), "Frame arena must only be used by the thread that owns it");
+    return m_Allocator.Allocate(Size, Alignment);
+}
+
+FrameArena::Scope::Scope() :
+    m_Arena{FrameArena::GetThreadArena()}
+{
+    m_Arena.EnterScope();
+}
+
+FrameArena::Scope::~Scope()
+{
+    m_Arena.ExitScope();
+}
+
+} // namespace Diligent
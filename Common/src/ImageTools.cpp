@@ -24,16 +24,211 @@
  *  of the possibility of such damages.
  */
 
+
 #include "ImageTools.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 
 #include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_IMAGE_TOOLS_NEON 1
+#elif DILIGENT_AVX2_SUPPORTED && (defined(_MSC_VER) || defined(__SSE2__))
+#    define DILIGENT_IMAGE_TOOLS_SSE 1
+#endif
 
 namespace Diligent
 {
 
+namespace
+{
+
+struct ImageDiffStats
+{
+    Uint32 NumDiffPixels               = 0;
+    Uint32 NumDiffPixelsAboveThreshold = 0;
+    Uint32 MaxDiff                     = 0;
+    Uint64 SumDiff                     = 0;
+    Uint64 SumSqDiff                   = 0;
+
+    void AddPixel(Uint32 PixelDiff, Uint32 Threshold)
+    {
+        if (PixelDiff == 0)
+            return;
+
+        ++NumDiffPixels;
+        SumDiff += PixelDiff;
+        SumSqDiff += PixelDiff * PixelDiff;
+        MaxDiff = std::max(MaxDiff, PixelDiff);
+        if (PixelDiff > Threshold)
+            ++NumDiffPixelsAboveThreshold;
+    }
+};
+
+// Per-lane 32-bit accumulators of the SIMD kernels are flushed after this many pixels
+// to avoid overflowing the sum of squared differences (255^2 * 65536 / 4 < 2^32).
+constexpr Uint32 SIMDFlushInterval = 65536;
+
+#if DILIGENT_IMAGE_TOOLS_SSE
+
+// Compares 4-channel rows and returns the number of processed pixels.
+// The remaining pixels are processed by the scalar code.
+Uint32 ComputeRowDifferenceRGBA8(const Uint8* pRow1, const Uint8* pRow2, Uint8* pDiffRow, Uint32 Width, Uint32 Threshold, ImageDiffStats& Stats)
+{
+    const __m128i Zero    = _mm_setzero_si128();
+    const __m128i LowByte = _mm_set1_epi32(0xFF);
+    const __m128i ThreshV = _mm_set1_epi32(static_cast<int>(std::min(Threshold, Uint32{255})));
+    Uint32        col     = 0;
+    while (col + 4 <= Width)
+    {
+        __m128i SumAcc   = Zero;
+        __m128i SqAcc    = Zero;
+        __m128i DiffAcc  = Zero;
+        __m128i AboveAcc = Zero;
+        __m128i MaxAcc   = Zero;
+
+        const Uint32 End = std::min(Width, col + SIMDFlushInterval) & ~3u;
+        for (; col < End; col += 4)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow1 + col * 4));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow2 + col * 4));
+
+            // Absolute channel differences
+            const __m128i ad = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+            if (pDiffRow != nullptr)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDiffRow + col * 4), ad);
+
+            // Maximum channel difference of every pixel in the low byte of the 32-bit lane
+            __m128i m = _mm_max_epu8(ad, _mm_srli_epi32(ad, 8));
+            m         = _mm_max_epu8(m, _mm_srli_epi32(m, 16));
+            m         = _mm_and_si128(m, LowByte);
+
+            SumAcc   = _mm_add_epi64(SumAcc, _mm_sad_epu8(m, Zero));
+            SqAcc    = _mm_add_epi32(SqAcc, _mm_madd_epi16(m, m));
+            DiffAcc  = _mm_sub_epi32(DiffAcc, _mm_cmpgt_epi32(m, Zero));
+            AboveAcc = _mm_sub_epi32(AboveAcc, _mm_cmpgt_epi32(m, ThreshV));
+            MaxAcc   = _mm_max_epu8(MaxAcc, m);
+        }
+
+        alignas(16) Uint32 Sq[4], Diff[4], Above[4], Max[4];
+        alignas(16) Uint64 Sum[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(Sum), SumAcc);
+        _mm_store_si128(reinterpret_cast<__m128i*>(Sq), SqAcc);
+        _mm_store_si128(reinterpret_cast<__m128i*>(Diff), DiffAcc);
+        _mm_store_si128(reinterpret_cast<__m128i*>(Above), AboveAcc);
+        _mm_store_si128(reinterpret_cast<__m128i*>(Max), MaxAcc);
+
+        Stats.SumDiff += Sum[0] + Sum[1];
+        Stats.SumSqDiff += Uint64{Sq[0]} + Uint64{Sq[1]} + Uint64{Sq[2]} + Uint64{Sq[3]};
+        Stats.NumDiffPixels += Diff[0] + Diff[1] + Diff[2] + Diff[3];
+        Stats.NumDiffPixelsAboveThreshold += Above[0] + Above[1] + Above[2] + Above[3];
+        Stats.MaxDiff = std::max({Stats.MaxDiff, Max[0], Max[1], Max[2], Max[3]});
+    }
+    return col;
+}
+
+#elif DILIGENT_IMAGE_TOOLS_NEON
+
+Uint32 ComputeRowDifferenceRGBA8(const Uint8* pRow1, const Uint8* pRow2, Uint8* pDiffRow, Uint32 Width, Uint32 Threshold, ImageDiffStats& Stats)
+{
+    const uint32x4_t Zero    = vdupq_n_u32(0);
+    const uint32x4_t LowByte = vdupq_n_u32(0xFF);
+    const uint32x4_t ThreshV = vdupq_n_u32(std::min(Threshold, Uint32{255}));
+    Uint32           col     = 0;
+    while (col + 4 <= Width)
+    {
+        uint32x4_t SumAcc   = Zero;
+        uint32x4_t SqAcc    = Zero;
+        uint32x4_t DiffAcc  = Zero;
+        uint32x4_t AboveAcc = Zero;
+        uint32x4_t MaxAcc   = Zero;
+
+        const Uint32 End = std::min(Width, col + SIMDFlushInterval) & ~3u;
+        for (; col < End; col += 4)
+        {
+            // Absolute channel differences
+            const uint8x16_t ad = vabdq_u8(vld1q_u8(pRow1 + col * 4), vld1q_u8(pRow2 + col * 4));
+            if (pDiffRow != nullptr)
+                vst1q_u8(pDiffRow + col * 4, ad);
+
+            // Maximum channel difference of every pixel in the low byte of the 32-bit lane
+            uint8x16_t m8 = vmaxq_u8(ad, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(ad), 8)));
+            m8            = vmaxq_u8(m8, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(m8), 16)));
+
+            const uint32x4_t m = vandq_u32(vreinterpretq_u32_u8(m8), LowByte);
+
+            SumAcc   = vaddq_u32(SumAcc, m);
+            SqAcc    = vmlaq_u32(SqAcc, m, m);
+            DiffAcc  = vsubq_u32(DiffAcc, vcgtq_u32(m, Zero));
+            AboveAcc = vsubq_u32(AboveAcc, vcgtq_u32(m, ThreshV));
+            MaxAcc   = vmaxq_u32(MaxAcc, m);
+        }
+
+        Stats.SumDiff += vaddvq_u32(SumAcc);
+        Stats.SumSqDiff += vaddlvq_u32(SqAcc);
+        Stats.NumDiffPixels += vaddvq_u32(DiffAcc);
+        Stats.NumDiffPixelsAboveThreshold += vaddvq_u32(AboveAcc);
+        Stats.MaxDiff = std::max(Stats.MaxDiff, vmaxvq_u32(MaxAcc));
+    }
+    return col;
+}
+
+#endif
+
+void ComputeRowDifference(const ComputeImageDifferenceAttribs& Attribs,
+                          Uint32                               NumSrcChannels,
+                          Uint32                               NumDiffChannels,
+                          Uint32                               row,
+                          ImageDiffStats&                      Stats)
+{
+    const Uint8* pRow1    = reinterpret_cast<const Uint8*>(Attribs.pImage1) + size_t{row} * Attribs.Stride1;
+    const Uint8* pRow2    = reinterpret_cast<const Uint8*>(Attribs.pImage2) + size_t{row} * Attribs.Stride2;
+    Uint8*       pDiffRow = Attribs.pDiffImage != nullptr ? reinterpret_cast<Uint8*>(Attribs.pDiffImage) + size_t{row} * Attribs.DiffStride : nullptr;
+
+    Uint32 col = 0;
+#if DILIGENT_IMAGE_TOOLS_SSE || DILIGENT_IMAGE_TOOLS_NEON
+    if (Attribs.NumChannels1 == 4 && Attribs.NumChannels2 == 4 &&
+        (pDiffRow == nullptr || (NumDiffChannels == 4 && Attribs.Scale == 1.f)))
+    {
+        col = ComputeRowDifferenceRGBA8(pRow1, pRow2, pDiffRow, Attribs.Width, Attribs.Threshold, Stats);
+    }
+#endif
+
+    for (; col < Attribs.Width; ++col)
+    {
+        Uint32 PixelDiff = 0;
+        for (Uint32 ch = 0; ch < NumSrcChannels; ++ch)
+        {
+            const Uint32 ChannelDiff = static_cast<Uint32>(
+                std::abs(static_cast<int>(pRow1[col * Attribs.NumChannels1 + ch]) -
+                         static_cast<int>(pRow2[col * Attribs.NumChannels2 + ch])));
+            PixelDiff = std::max(PixelDiff, ChannelDiff);
+
+            if (pDiffRow != nullptr && ch < NumDiffChannels)
+            {
+                pDiffRow[col * NumDiffChannels + ch] = static_cast<Uint8>(std::min(ChannelDiff * Attribs.Scale, 255.f));
+            }
+        }
+
+        if (pDiffRow != nullptr)
+        {
+            for (Uint32 ch = NumSrcChannels; ch < NumDiffChannels; ++ch)
+            {
+                pDiffRow[col * NumDiffChannels + ch] = ch == 3 ? 255 : 0;
+            }
+        }
+
+        Stats.AddPixel(PixelDiff, Attribs.Threshold);
+    }
+}
+
+} // namespace
+
 void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
                             ImageDiffInfo&                       Diff)
 {
@@ -79,55 +274,41 @@ void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
         }
     }
 
-    for (Uint32 row = 0; row < Attribs.Height; ++row)
-    {
-        const Uint8* pRow1    = reinterpret_cast<const Uint8*>(Attribs.pImage1) + row * Attribs.Stride1;
-        const Uint8* pRow2    = reinterpret_cast<const Uint8*>(Attribs.pImage2) + row * Attribs.Stride2;
-        Uint8*       pDiffRow = Attribs.pDiffImage != nullptr ? reinterpret_cast<Uint8*>(Attribs.pDiffImage) + row * Attribs.DiffStride : nullptr;
+    std::atomic<Uint32> NumDiffPixels{0};
+    std::atomic<Uint32> NumDiffPixelsAboveThreshold{0};
+    std::atomic<Uint32> MaxDiff{0};
+    std::atomic<Uint64> SumDiff{0};
+    std::atomic<Uint64> SumSqDiff{0};
 
-        for (Uint32 col = 0; col < Attribs.Width; ++col)
-        {
-            Uint32 PixelDiff = 0;
-            for (Uint32 ch = 0; ch < NumSrcChannels; ++ch)
-            {
-                const Uint32 ChannelDiff = static_cast<Uint32>(
-                    std::abs(static_cast<int>(pRow1[col * Attribs.NumChannels1 + ch]) -
-                             static_cast<int>(pRow2[col * Attribs.NumChannels2 + ch])));
-                PixelDiff = std::max(PixelDiff, ChannelDiff);
-
-                if (pDiffRow != nullptr && ch < NumDiffChannels)
-                {
-                    pDiffRow[col * NumDiffChannels + ch] = static_cast<Uint8>(std::min(ChannelDiff * Attribs.Scale, 255.f));
-                }
-            }
+    // Process at least 64K pixels per thread pool task
+    const Uint32 RowsPerTask = std::max(65536u / std::max(Attribs.Width, 1u), 1u);
+    ParallelFor(Attribs.pThreadPool, 0, Attribs.Height, RowsPerTask, [&](Uint32 row) {
+        if (Attribs.EarlyExitPixelCount != 0 && NumDiffPixelsAboveThreshold.load(std::memory_order_relaxed) >= Attribs.EarlyExitPixelCount)
+            return;
 
-            if (pDiffRow != nullptr)
-            {
-                for (Uint32 ch = NumSrcChannels; ch < NumDiffChannels; ++ch)
-                {
-                    pDiffRow[col * NumDiffChannels + ch] = ch == 3 ? 255 : 0;
-                }
-            }
+        ImageDiffStats RowStats;
+        ComputeRowDifference(Attribs, NumSrcChannels, NumDiffChannels, row, RowStats);
+        if (RowStats.NumDiffPixels == 0)
+            return;
 
-            if (PixelDiff != 0)
-            {
-                ++Diff.NumDiffPixels;
-                Diff.AvgDiff += static_cast<float>(PixelDiff);
-                Diff.RmsDiff += static_cast<float>(PixelDiff * PixelDiff);
-                Diff.MaxDiff = std::max(Diff.MaxDiff, PixelDiff);
-
-                if (PixelDiff > Attribs.Threshold)
-                {
-                    ++Diff.NumDiffPixelsAboveThreshold;
-                }
-            }
+        NumDiffPixels.fetch_add(RowStats.NumDiffPixels, std::memory_order_relaxed);
+        NumDiffPixelsAboveThreshold.fetch_add(RowStats.NumDiffPixelsAboveThreshold, std::memory_order_relaxed);
+        SumDiff.fetch_add(RowStats.SumDiff, std::memory_order_relaxed);
+        SumSqDiff.fetch_add(RowStats.SumSqDiff, std::memory_order_relaxed);
+
+        Uint32 CurrMaxDiff = MaxDiff.load(std::memory_order_relaxed);
+        while (CurrMaxDiff < RowStats.MaxDiff && !MaxDiff.compare_exchange_weak(CurrMaxDiff, RowStats.MaxDiff, std::memory_order_relaxed))
+        {
         }
-    }
+    });
 
+    Diff.NumDiffPixels               = NumDiffPixels.load();
+    Diff.NumDiffPixelsAboveThreshold = NumDiffPixelsAboveThreshold.load();
+    Diff.MaxDiff                     = MaxDiff.load();
     if (Diff.NumDiffPixels > 0)
     {
-        Diff.AvgDiff /= static_cast<float>(Diff.NumDiffPixels);
-        Diff.RmsDiff = std::sqrt(Diff.RmsDiff / static_cast<float>(Diff.NumDiffPixels));
+        Diff.AvgDiff = static_cast<float>(static_cast<double>(SumDiff.load()) / Diff.NumDiffPixels);
+        Diff.RmsDiff = static_cast<float>(std::sqrt(static_cast<double>(SumSqDiff.load()) / Diff.NumDiffPixels));
     }
 }
 
@@ -0,0 +1,455 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "LZ4Compression.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <queue>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+// LZ4 block format:
+//
+//   | Sequence 1 | Sequence 2 | ... | Last sequence |
+//
+//   | Sequence | = | Token | Literal length ext | Literals | Offset | Match length ext |
+//
+// Token high 4 bits contain the literal length, low 4 bits contain the match length minus 4.
+// Value 15 indicates that the length continues in the following bytes: every byte is added
+// to the length until a byte other than 255 is encountered.
+// Offset is a 16-bit little-endian distance back to the match start.
+// The last sequence only contains literals.
+
+namespace
+{
+
+constexpr size_t MinMatch     = 4;
+constexpr size_t LastLiterals = 5;  // The last 5 bytes are always literals
+constexpr size_t MFLimit      = 12; // The last match must start at least 12 bytes before the end of the block
+constexpr size_t MaxOffset    = 65535;
+constexpr Uint32 HashLog      = 16;
+
+inline Uint32 Read32(const Uint8* p)
+{
+    Uint32 Val;
+    memcpy(&Val, p, sizeof(Val));
+    return Val;
+}
+
+inline Uint64 Read64(const Uint8* p)
+{
+    Uint64 Val;
+    memcpy(&Val, p, sizeof(Val));
+    return Val;
+}
+
+inline Uint32 HashSequence(Uint32 Sequence)
+{
+    return (Sequence * 2654435761u) >> (32 - HashLog);
+}
+
+inline Uint8* WriteLength(Uint8* pDst, size_t Length)
+{
+    for (; Length >= 255; Length -= 255)
+        *pDst++ = 255;
+    *pDst++ = static_cast<Uint8>(Length);
+    return pDst;
+}
+
+inline bool ReadLength(const Uint8*& pSrc, const Uint8* pSrcEnd, size_t& Length)
+{
+    Uint8 Byte = 0;
+    do
+    {
+        if (pSrc >= pSrcEnd)
+            return false;
+        Byte = *pSrc++;
+        Length += Byte;
+    } while (Byte == 255);
+    return true;
+}
+
+// Returns the number of bytes required to encode a sequence, not including the literals
+inline size_t GetSequenceOverhead(size_t LiteralLength, size_t MatchLength)
+{
+    // Token + offset
+    size_t Size = 1 + 2;
+    if (LiteralLength >= 15)
+        Size += (LiteralLength - 15) / 255 + 1;
+    if (MatchLength >= 15 + MinMatch)
+        Size += (MatchLength - MinMatch - 15) / 255 + 1;
+    return Size;
+}
+
+} // namespace
+
+size_t LZ4GetMaxCompressedSize(size_t SrcSize)
+{
+    return SrcSize + SrcSize / 255 + 16;
+}
+
+size_t LZ4CompressBlock(const void* pSrc,
+                        size_t      SrcSize,
+                        void*       pDst,
+                        size_t      DstCapacity,
+                        const void* pDict,
+                        size_t      DictSize)
+{
+    DEV_CHECK_ERR(pSrc != nullptr || SrcSize == 0, "Source data must not be null");
+    DEV_CHECK_ERR(pDst != nullptr || DstCapacity == 0, "Destination buffer must not be null");
+    if (pDict == nullptr)
+        DictSize = 0;
+
+    // Only the last 64KB of the dictionary can be referenced.
+    if (DictSize > LZ4MaxDictionarySize)
+    {
+        pDict = static_cast<const Uint8*>(pDict) + (DictSize - LZ4MaxDictionarySize);
+        DictSize = LZ4MaxDictionarySize;
+    }
+
+    // Matches may span the dictionary and the source data, so place them in one window.
+    std::vector<Uint8> Window(DictSize + SrcSize);
+    if (DictSize > 0)
+        memcpy(Window.data(), pDict, DictSize);
+    if (SrcSize > 0)
+        memcpy(Window.data() + DictSize, pSrc, SrcSize);
+
+    const Uint8* const pBase     = Window.data();
+    const size_t       SrcStart  = DictSize;
+    const size_t       SrcEnd    = DictSize + SrcSize;
+    Uint8*             pOut      = static_cast<Uint8*>(pDst);
+    Uint8* const       pOutEnd   = pOut + DstCapacity;
+    size_t             Anchor    = SrcStart;
+    size_t             Pos       = SrcStart;
+    const size_t       MatchEnd  = SrcEnd >= LastLiterals ? SrcEnd - LastLiterals : 0;
+    const size_t       MatchLast = SrcEnd >= MFLimit ? SrcEnd - MFLimit : 0;
+
+    // Hash table stores positions + 1; zero indicates an empty slot.
+    std::vector<Uint32> HashTable(size_t{1} << HashLog);
+    for (size_t i = 0; i + MinMatch <= DictSize; ++i)
+        HashTable[HashSequence(Read32(pBase + i))] = static_cast<Uint32>(i + 1);
+
+    if (SrcSize > MFLimit)
+    {
+        while (Pos <= MatchLast)
+        {
+            const Uint32 Sequence = Read32(pBase + Pos);
+            const Uint32 Hash     = HashSequence(Sequence);
+            const size_t Ref      = size_t{HashTable[Hash]};
+            HashTable[Hash]       = static_cast<Uint32>(Pos + 1);
+
+            if (Ref == 0 || Pos - (Ref - 1) > MaxOffset || Read32(pBase + Ref - 1) != Sequence)
+            {
+                ++Pos;
+                continue;
+            }
+
+            size_t MatchPos = Ref - 1;
+            size_t Start    = Pos;
+
+            // Extend the match backwards
+            while (Start > Anchor && MatchPos > 0 && pBase[Start - 1] == pBase[MatchPos - 1])
+            {
+                --Start;
+                --MatchPos;
+            }
+
+            // Extend the match forward
+            size_t MatchLength = MinMatch + (Pos - Start);
+            while (Start + MatchLength < MatchEnd && pBase[MatchPos + MatchLength] == pBase[Start + MatchLength])
+                ++MatchLength;
+
+            const size_t LiteralLength = Start - Anchor;
+            if (static_cast<size_t>(pOutEnd - pOut) < LiteralLength + GetSequenceOverhead(LiteralLength, MatchLength))
+                return 0;
+
+            Uint8* pToken = pOut++;
+            *pToken       = static_cast<Uint8>(std::min(LiteralLength, size_t{15}) << 4);
+            if (LiteralLength >= 15)
+                pOut = WriteLength(pOut, LiteralLength - 15);
+            memcpy(pOut, pBase + Anchor, LiteralLength);
+            pOut += LiteralLength;
+
+            const size_t Offset = Start - MatchPos;
+            *pOut++             = static_cast<Uint8>(Offset & 0xFF);
+            *pOut++             = static_cast<Uint8>(Offset >> 8);
+
+            *pToken |= static_cast<Uint8>(std::min(MatchLength - MinMatch, size_t{15}));
+            if (MatchLength - MinMatch >= 15)
+                pOut = WriteLength(pOut, MatchLength - MinMatch - 15);
+
+            Pos    = Start + MatchLength;
+            Anchor = Pos;
+
+            // Add the position inside the match to improve the ratio of the following matches
+            if (Pos - 2 <= MatchLast)
+                HashTable[HashSequence(Read32(pBase + Pos - 2))] = static_cast<Uint32>(Pos - 2 + 1);
+        }
+    }
+
+    // Last literals
+    const size_t LiteralLength = SrcEnd - Anchor;
+    const size_t LastOverhead  = 1 + (LiteralLength >= 15 ? (LiteralLength - 15) / 255 + 1 : 0);
+    if (static_cast<size_t>(pOutEnd - pOut) < LiteralLength + LastOverhead)
+        return 0;
+
+    *pOut++ = static_cast<Uint8>(std::min(LiteralLength, size_t{15}) << 4);
+    if (LiteralLength >= 15)
+        pOut = WriteLength(pOut, LiteralLength - 15);
+    if (LiteralLength > 0)
+        memcpy(pOut, pBase + Anchor, LiteralLength);
+    pOut += LiteralLength;
+
+    return pOut - static_cast<Uint8*>(pDst);
+}
+
+bool LZ4DecompressBlock(const void* pSrc,
+                        size_t      SrcSize,
+                        void*       pDst,
+                        size_t      DstSize,
+                        const void* pDict,
+                        size_t      DictSize)
+{
+    if (pSrc == nullptr || SrcSize == 0)
+        return false;
+    if (pDst == nullptr && DstSize != 0)
+        return false;
+    if (pDict == nullptr)
+        DictSize = 0;
+
+    const Uint8*       pIn     = static_cast<const Uint8*>(pSrc);
+    const Uint8* const pInEnd  = pIn + SrcSize;
+    Uint8* const       pStart  = static_cast<Uint8*>(pDst);
+    Uint8*             pOut    = pStart;
+    Uint8* const       pOutEnd = pStart + DstSize;
+    const Uint8* const pDictEnd = static_cast<const Uint8*>(pDict) + DictSize;
+
+    for (;;)
+    {
+        if (pIn >= pInEnd)
+            return false;
+
+        const Uint8 Token = *pIn++;
+
+        size_t LiteralLength = Token >> 4;
+        if (LiteralLength == 15 && !ReadLength(pIn, pInEnd, LiteralLength))
+            return false;
+
+        if (LiteralLength > static_cast<size_t>(pInEnd - pIn) || LiteralLength > static_cast<size_t>(pOutEnd - pOut))
+            return false;
+        if (LiteralLength > 0)
+            memcpy(pOut, pIn, LiteralLength);
+        pIn += LiteralLength;
+        pOut += LiteralLength;
+
+        if (pIn == pInEnd)
+        {
+            // The last sequence has no match
+            break;
+        }
+
+        if (pInEnd - pIn < 2)
+            return false;
+        const size_t Offset = size_t{pIn[0]} | (size_t{pIn[1]} << 8);
+        pIn += 2;
+        if (Offset == 0)
+            return false;
+
+        size_t MatchLength = Token & 0x0F;
+        if (MatchLength == 15 && !ReadLength(pIn, pInEnd, MatchLength))
+            return false;
+        MatchLength += MinMatch;
+
+        if (MatchLength > static_cast<size_t>(pOutEnd - pOut))
+            return false;
+
+        const size_t NumDecoded = pOut - pStart;
+        if (Offset > NumDecoded)
+        {
+            // The match starts in the dictionary
+            const size_t DictOffset = Offset - NumDecoded;
+            if (DictOffset > DictSize)
+                return false;
+
+            const size_t NumDictBytes = std::min(DictOffset, MatchLength);
+            memcpy(pOut, pDictEnd - DictOffset, NumDictBytes);
+            pOut += NumDictBytes;
+            MatchLength -= NumDictBytes;
+
+            // The rest of the match continues from the start of the decoded data
+            const Uint8* pMatch = pStart;
+            while (MatchLength-- > 0)
+                *pOut++ = *pMatch++;
+        }
+        else
+        {
+            // Matches may overlap with the data being written, so copy byte by byte.
+            const Uint8* pMatch = pOut - Offset;
+            if (Offset >= MatchLength)
+            {
+                memcpy(pOut, pMatch, MatchLength);
+                pOut += MatchLength;
+            }
+            else
+            {
+                while (MatchLength-- > 0)
+                    *pOut++ = *pMatch++;
+            }
+        }
+    }
+
+    return pOut == pOutEnd;
+}
+
+
+std::vector<Uint8> LZ4TrainDictionary(const std::vector<std::pair<const void*, size_t>>& Samples,
+                                      size_t                                             MaxDictSize)
+{
+    // The dictionary is built from segments of the sample data. Segment score is the number of
+    // samples that contain the segment's 8-byte sequences (d-mers), so that the segments that
+    // are common to many samples are selected. Once a segment is selected, its d-mers no longer contribute
+    // to the score of other segments.
+    constexpr size_t DmerSize          = 8;
+    constexpr size_t SegmentSize       = 256;
+    constexpr size_t SegmentStep       = SegmentSize / 2;
+    constexpr Uint32 DmerHashLog       = 20;
+    constexpr size_t DmerHashTableSize = size_t{1} << DmerHashLog;
+
+    MaxDictSize = std::min(MaxDictSize, LZ4MaxDictionarySize);
+    if (MaxDictSize == 0 || Samples.empty())
+        return {};
+
+    auto HashDmer = [](const Uint8* p) {
+        return static_cast<Uint32>((Read64(p) * 0x9E3779B185EBCA87ull) >> (64 - DmerHashLog));
+    };
+
+    // The number of samples that contain each d-mer
+    std::vector<Uint32> DmerFreq(DmerHashTableSize);
+    // Stamps that are used to count each d-mer only once per sample or segment
+    std::vector<Uint32> DmerStamp(DmerHashTableSize, ~0u);
+    Uint32              Stamp = 0;
+
+    for (const auto& Sample : Samples)
+    {
+        const Uint8* pData = static_cast<const Uint8*>(Sample.first);
+        for (size_t i = 0; i + DmerSize <= Sample.second; ++i)
+        {
+            const Uint32 Hash = HashDmer(pData + i);
+            if (DmerStamp[Hash] != Stamp)
+            {
+                DmerStamp[Hash] = Stamp;
+                ++DmerFreq[Hash];
+            }
+        }
+        ++Stamp;
+    }
+
+    struct Segment
+    {
+        Uint64       Score;
+        const Uint8* pData;
+        size_t       Size;
+
+        bool operator<(const Segment& Rhs) const
+        {
+            return Score < Rhs.Score;
+        }
+    };
+
+    auto ComputeScore = [&](const Uint8* pData, size_t Size) {
+        Uint64 Score = 0;
+        for (size_t i = 0; i + DmerSize <= Size; ++i)
+        {
+            const Uint32 Hash = HashDmer(pData + i);
+            if (DmerStamp[Hash] != Stamp)
+            {
+                DmerStamp[Hash] = Stamp;
+                // D-mers that occur in a single sample do not help compress other samples
+                if (DmerFreq[Hash] > 1)
+                    Score += DmerFreq[Hash];
+            }
+        }
+        ++Stamp;
+        return Score;
+    };
+
+    std::priority_queue<Segment> Candidates;
+    for (const auto& Sample : Samples)
+    {
+        const Uint8* pData = static_cast<const Uint8*>(Sample.first);
+        for (size_t Offset = 0; Offset + DmerSize <= Sample.second; Offset += SegmentStep)
+        {
+            const size_t Size  = std::min(SegmentSize, Sample.second - Offset);
+            const Uint64 Score = ComputeScore(pData + Offset, Size);
+            if (Score > 0)
+                Candidates.push({Score, pData + Offset, Size});
+        }
+    }
+
+    std::vector<Segment> SelectedSegments;
+    SelectedSegments.reserve(MaxDictSize / SegmentStep + 1);
+
+    size_t DictSize = 0;
+    while (!Candidates.empty() && DictSize < MaxDictSize)
+    {
+        Segment Seg = Candidates.top();
+        Candidates.pop();
+
+        // Scores of the remaining segments may have decreased since they were computed
+        Seg.Score = ComputeScore(Seg.pData, Seg.Size);
+        if (Seg.Score == 0)
+            continue;
+        if (!Candidates.empty() && Seg.Score < Candidates.top().Score)
+        {
+            Candidates.push(Seg);
+            continue;
+        }
+
+        Seg.Size = std::min(Seg.Size, MaxDictSize - DictSize);
+        DictSize += Seg.Size;
+        SelectedSegments.push_back(Seg);
+
+        // D-mers of the selected segment are now covered by the dictionary
+        for (size_t i = 0; i + DmerSize <= Seg.Size; ++i)
+            DmerFreq[HashDmer(Seg.pData + i)] = 0;
+    }
+
+    // Place the best segments at the end of the dictionary, closest to the compressed data
+    std::vector<Uint8> Dict;
+    Dict.reserve(DictSize);
+    for (auto it = SelectedSegments.rbegin(); it != SelectedSegments.rend(); ++it)
+        Dict.insert(Dict.end(), it->pData, it->pData + it->Size);
+
+    return Dict;
+}
+
+} // namespace Diligent
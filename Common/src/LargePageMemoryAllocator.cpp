@@ -0,0 +1,184 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "LargePageMemoryAllocator.hpp"
+
+#include "DefaultRawMemoryAllocator.hpp"
+#include "PlatformMisc.hpp"
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+#include <algorithm>
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr size_t VirtualPageSize = 4096;
+
+Uint32 GetCurrentNUMANode()
+{
+    const CPUTopology&      Topology = PlatformMisc::GetCPUTopology();
+    const CPUProcessorInfo* pProc    = Topology.GetProcessor(PlatformMisc::GetCurrentProcessorIndex());
+    return pProc != nullptr ? pProc->NUMANode : CPUProcessorInfo::InvalidId;
+}
+
+} // namespace
+
+LargePageMemoryAllocator::LargePageMemoryAllocator(const LargePageMemoryAllocatorCreateInfo& CI) :
+    // clang-format off
+    m_MinVirtualAllocationSize{(std::max)(CI.MinVirtualAllocationSize, VirtualPageSize)},
+    m_LargePageSize           {CI.UseLargePages ? PlatformMisc::GetLargePageSize() : 0},
+    m_NUMANode                {CI.NUMANode},
+    m_FallbackAllocator       {CI.pFallbackAllocator != nullptr ? *CI.pFallbackAllocator : DefaultRawMemoryAllocator::GetAllocator()}
+// clang-format on
+{
+}
+
+LargePageMemoryAllocator::~LargePageMemoryAllocator()
+{
+    DEV_CHECK_ERR(m_VirtualAllocations.empty(), m_VirtualAllocations.size(), " virtual memory allocation(s) have not been released");
+    for (const auto& it : m_VirtualAllocations)
+        PlatformMisc::FreeVirtualMemory(it.first, it.second.Size);
+}
+
+void* LargePageMemoryAllocator::AllocateVirtual(size_t Size)
+{
+    const Uint32 NUMANode = m_NUMANode != ~0u ? m_NUMANode : GetCurrentNUMANode();
+
+    VirtualAllocation Allocation;
+    void*             Ptr = nullptr;
+    // Only use large pages when at least one full page is requested - otherwise most of the page is wasted.
+    if (m_LargePageSize != 0 && Size >= m_LargePageSize)
+    {
+        Allocation.Size       = AlignUp(Size, m_LargePageSize);
+        Allocation.LargePages = true;
+        Ptr                   = PlatformMisc::AllocateVirtualMemory(Allocation.Size, VIRTUAL_MEMORY_FLAG_LARGE_PAGES, NUMANode);
+    }
+
+    if (Ptr == nullptr)
+    {
+        // Large pages may be exhausted at any time - fall back to normal pages.
+        Allocation.Size       = AlignUp(Size, VirtualPageSize);
+        Allocation.LargePages = false;
+        Ptr                   = PlatformMisc::AllocateVirtualMemory(Allocation.Size, VIRTUAL_MEMORY_FLAG_NONE, NUMANode);
+    }
+
+    if (Ptr == nullptr)
+        return nullptr;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_VirtualAllocations.emplace(Ptr, Allocation);
+    m_VirtualMemorySize += Allocation.Size;
+    if (Allocation.LargePages)
+        m_LargePageMemorySize += Allocation.Size;
+
+    return Ptr;
+}
+
+bool LargePageMemoryAllocator::FreeVirtual(void* Ptr)
+{
+    // Virtual memory allocations are always page-aligned, so there is no need
+    // to take the lock for the majority of small allocations.
+    if ((reinterpret_cast<uintptr_t>(Ptr) & (VirtualPageSize - 1)) != 0)
+        return false;
+
+    VirtualAllocation Allocation;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_VirtualAllocations.find(Ptr);
+        if (it == m_VirtualAllocations.end())
+            return false;
+
+        Allocation = it->second;
+        m_VirtualAllocations.erase(it);
+        m_VirtualMemorySize -= Allocation.Size;
+        if (Allocation.LargePages)
+            m_LargePageMemorySize -= Allocation.Size;
+    }
+
+    PlatformMisc::FreeVirtualMemory(Ptr, Allocation.Size);
+    return true;
+}
+
+void* LargePageMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0);
+    if (Size >= m_MinVirtualAllocationSize)
+    {
+        if (void* Ptr = AllocateVirtual(Size))
+            return Ptr;
+    }
+    return m_FallbackAllocator.Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+}
+
+void LargePageMemoryAllocator::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    if (!FreeVirtual(Ptr))
+        m_FallbackAllocator.Free(Ptr);
+}
+
+void* LargePageMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0 && Alignment > 0);
+    VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of 2");
+    if (Size >= m_MinVirtualAllocationSize && Alignment <= VirtualPageSize)
+    {
+        if (void* Ptr = AllocateVirtual(Size))
+            return Ptr;
+    }
+    return m_FallbackAllocator.AllocateAligned(Size, Alignment, dbgDescription, dbgFileName, dbgLineNumber);
+}
+
+void LargePageMemoryAllocator::FreeAligned(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    if (!FreeVirtual(Ptr))
+        m_FallbackAllocator.FreeAligned(Ptr);
+}
+
+size_t LargePageMemoryAllocator::GetLargePageMemorySize() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return m_LargePageMemorySize;
+}
+
+size_t LargePageMemoryAllocator::GetVirtualMemorySize() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return m_VirtualMemorySize;
+}
+
+} // namespace Diligent
@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "MappedFileStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "ProxyDataBlob.hpp"
+
+namespace Diligent
+{
+
+RefCntAutoPtr<MappedFileStream> MappedFileStream::Create(const Char* Path)
+{
+    if (Path == nullptr || Path[0] == '\0')
+    {
+        DEV_ERROR("Path must not be null or empty");
+        return {};
+    }
+
+    std::unique_ptr<MappedFile> pMappedFile = FileSystem::MapFile(Path);
+    if (!pMappedFile)
+    {
+        LOG_ERROR_MESSAGE("Failed to map file '", Path, "'");
+        return {};
+    }
+
+    return RefCntAutoPtr<MappedFileStream>{MakeNewRCObj<MappedFileStream>()(std::move(pMappedFile))};
+}
+
+MappedFileStream::MappedFileStream(IReferenceCounters*           pRefCounters,
+                                   std::unique_ptr<MappedFile>&& pMappedFile) :
+    TBase{pRefCounters},
+    m_pMappedFile{std::move(pMappedFile)}
+{
+    VERIFY_EXPR(m_pMappedFile);
+}
+
+IMPLEMENT_QUERY_INTERFACE(MappedFileStream, IID_FileStream, TBase)
+
+bool MappedFileStream::Read(void* Data, size_t Size)
+{
+    const size_t FileSize = m_pMappedFile->GetSize();
+    if (m_CurrentOffset >= FileSize)
+        return Size == 0;
+
+    const size_t BytesToRead = std::min(FileSize - m_CurrentOffset, Size);
+    memcpy(Data, static_cast<const Uint8*>(m_pMappedFile->GetData()) + m_CurrentOffset, BytesToRead);
+    m_CurrentOffset += BytesToRead;
+    return Size == BytesToRead;
+}
+
+void MappedFileStream::ReadBlob(IDataBlob* pData)
+{
+    const size_t FileSize  = m_pMappedFile->GetSize();
+    const size_t BytesLeft = m_CurrentOffset < FileSize ? FileSize - m_CurrentOffset : 0;
+    pData->Resize(BytesLeft);
+    if (BytesLeft > 0)
+    {
+        bool res = Read(pData->GetDataPtr(), BytesLeft);
+        VERIFY_EXPR(res);
+        (void)res;
+    }
+}
+
+bool MappedFileStream::Write(const void* Data, size_t Size)
+{
+    DEV_ERROR("Memory-mapped file streams are read-only");
+    return false;
+}
+
+bool MappedFileStream::IsValid()
+{
+    return m_pMappedFile != nullptr;
+}
+
+size_t MappedFileStream::GetSize()
+{
+    return m_pMappedFile->GetSize();
+}
+
+size_t MappedFileStream::GetPos()
+{
+    return m_CurrentOffset;
+}
+
+bool MappedFileStream::SetPos(size_t Offset, int Origin)
+{
+    switch (static_cast<FilePosOrigin>(Origin))
+    {
+        case FilePosOrigin::Start:
+            m_CurrentOffset = Offset;
+            break;
+
+        case FilePosOrigin::Curr:
+            m_CurrentOffset += Offset;
+            break;
+
+        case FilePosOrigin::End:
+            m_CurrentOffset = m_pMappedFile->GetSize() + Offset;
+            break;
+    }
+
+    return true;
+}
+
+RefCntAutoPtr<IDataBlob> MappedFileStream::GetDataBlob()
+{
+    return RefCntAutoPtr<IDataBlob>{ProxyDataBlob::Create(m_pMappedFile->GetData(), m_pMappedFile->GetSize(), this)};
+}
+
+} // namespace Diligent
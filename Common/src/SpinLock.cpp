@@ -26,7 +26,9 @@
 
 #include "SpinLock.hpp"
 
-#include <thread>
+#include <algorithm>
+
+#include "PlatformMisc.hpp"
 
 #if defined(_MSC_VER) && ((_M_IX86_FP >= 2) || defined(_M_X64))
 #    include <emmintrin.h>
@@ -42,21 +44,41 @@
 namespace Threading
 {
 
-void SpinLock::Wait() noexcept
+void SpinLock::LockContended() noexcept
 {
-    // Wait for the lock to be released without generating cache misses.
-    constexpr size_t NumAttemptsToYield = 64;
-    for (size_t Attempt = 0; Attempt < NumAttemptsToYield; ++Attempt)
-    {
-        if (!is_locked())
-            return;
+    // Spin for a while with exponential backoff. The budget is a few thousand cycles,
+    // which covers typical short critical sections without parking the thread.
+    constexpr std::uint32_t NumSpinIterations = 12;
+    constexpr std::uint32_t MaxPauseCount     = 64;
 
+    std::uint32_t PauseCount = 1;
+    for (std::uint32_t Iteration = 0; Iteration < NumSpinIterations; ++Iteration)
+    {
         // Issue X86 PAUSE or ARM YIELD instruction to reduce contention
         // between hyper-threads.
-        PAUSE();
+        for (std::uint32_t i = 0; i < PauseCount; ++i)
+            PAUSE();
+        PauseCount = std::min(PauseCount * 2, MaxPauseCount);
+
+        // Wait for the lock to be released without generating cache misses.
+        if (m_State.load(std::memory_order_relaxed) != Unlocked)
+            continue;
+
+        std::uint32_t Expected = Unlocked;
+        if (m_State.compare_exchange_weak(Expected, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            return;
     }
 
-    std::this_thread::yield();
+    // Park the thread. The state is set to LockedWithWaiters so that unlock() wakes up one waiter.
+    // When the thread acquires the lock here, it does not know whether there are other waiters,
+    // so it conservatively keeps the LockedWithWaiters state.
+    while (m_State.exchange(LockedWithWaiters, std::memory_order_acquire) != Unlocked)
+        Diligent::PlatformMisc::WaitOnAddress(&m_State, LockedWithWaiters);
+}
+
+void SpinLock::WakeWaiter() noexcept
+{
+    Diligent::PlatformMisc::WakeByAddressSingle(&m_State);
 }
 
 } // namespace Threading
@@ -30,11 +30,13 @@
 #include <mutex>
 #include <thread>
 #include <map>
+#include <deque>
 #include <vector>
 #include <condition_variable>
 #include <cfloat>
 
 #include "PlatformMisc.hpp"
+#include "SpinLock.hpp"
 
 namespace Diligent
 {
@@ -43,6 +45,129 @@ AsyncTaskBase::~AsyncTaskBase()
 {
 }
 
+namespace
+{
+
+struct QueuedTaskInfo
+{
+    RefCntAutoPtr<IAsyncTask>              pTask;
+    std::vector<RefCntWeakPtr<IAsyncTask>> Prerequisites;
+
+    QueuedTaskInfo() = default;
+
+    QueuedTaskInfo(IAsyncTask*  _pTask,
+                   IAsyncTask** ppPrerequisites,
+                   Uint32       NumPrerequisites) :
+        pTask{_pTask}
+    {
+        if (ppPrerequisites != nullptr && NumPrerequisites > 0)
+        {
+            Prerequisites.reserve(NumPrerequisites);
+            float MinPrereqPriority = +FLT_MAX;
+            for (Uint32 i = 0; i < NumPrerequisites; ++i)
+            {
+                if (ppPrerequisites[i] != nullptr)
+                {
+                    Prerequisites.emplace_back(ppPrerequisites[i]);
+                    MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
+                }
+            }
+            if (pTask->GetPriority() > MinPrereqPriority)
+            {
+                pTask->SetPriority(MinPrereqPriority);
+            }
+        }
+    }
+
+    // Runs the task if all its prerequisites are met.
+    // Returns true if the task is finished, and false if it needs to be re-enqueued.
+    // In the latter case, the task priority is lowered to the minimum priority of
+    // unfinished prerequisites.
+    bool Run(Uint32 ThreadId)
+    {
+        // Check prerequisites
+        bool  PrerequisitesMet  = true;
+        float MinPrereqPriority = +FLT_MAX;
+        for (auto& pPrereq : Prerequisites)
+        {
+            if (auto pPrereqTask = pPrereq.Lock())
+            {
+                if (!pPrereqTask->IsFinished())
+                {
+                    PrerequisitesMet  = false;
+                    MinPrereqPriority = std::min(MinPrereqPriority, pPrereqTask->GetPriority());
+                }
+            }
+        }
+
+        bool TaskFinished = false;
+        if (PrerequisitesMet)
+        {
+            pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+            ASYNC_TASK_STATUS ReturnStatus = pTask->Run(ThreadId);
+            // NB: It is essential to set the task status after the Run() method returns.
+            //     This way if the GetStatus() method returns any value other than ASYNC_TASK_STATUS_RUNNING,
+            //     it is guaranteed that the task is not executed by any thread.
+            pTask->SetStatus(ReturnStatus);
+            TaskFinished = pTask->IsFinished();
+            DEV_CHECK_ERR((TaskFinished || pTask->GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED),
+                          "Finished tasks must be in COMPLETE, CANCELLED or NOT_STARTED state");
+        }
+
+        if (!TaskFinished)
+        {
+            // If prerequisites are not met or the task requested to be re-run,
+            // re-enqueue the task with the minimum prerequisite priority
+            if (pTask->GetPriority() > MinPrereqPriority)
+                pTask->SetPriority(MinPrereqPriority);
+        }
+
+        return TaskFinished;
+    }
+};
+
+void StartWorkerThreads(IThreadPool&                ThreadPool,
+                        const ThreadPoolCreateInfo& PoolCI,
+                        std::vector<std::thread>&   WorkerThreads)
+{
+    // Must be resolved in the calling thread for THREAD_PLACEMENT_FLAG_EXCLUDE_CALLING_CORE
+    const std::vector<Uint32> PlacementProcessors = PoolCI.PlacementFlags != THREAD_PLACEMENT_FLAG_NONE ?
+        GetThreadPlacementProcessors(PoolCI.PlacementFlags) :
+        std::vector<Uint32>{};
+
+    WorkerThreads.reserve(PoolCI.NumThreads);
+    for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
+    {
+        std::vector<Uint32> WorkerProcessors;
+        if (!PlacementProcessors.empty())
+        {
+            if (PoolCI.PlacementFlags & THREAD_PLACEMENT_FLAG_ONE_PER_PHYSICAL_CORE)
+                WorkerProcessors.push_back(PlacementProcessors[i % PlacementProcessors.size()]);
+            else
+                WorkerProcessors = PlacementProcessors;
+        }
+
+        WorkerThreads.emplace_back(
+            [&ThreadPool, PoolCI, i, WorkerProcessors = std::move(WorkerProcessors)] //
+            {
+                if (!WorkerProcessors.empty() && !PlatformMisc::SetCurrentThreadProcessors(WorkerProcessors))
+                    LOG_WARNING_MESSAGE_ONCE("Failed to apply the thread placement to the thread pool worker threads");
+
+                if (PoolCI.OnThreadStarted)
+                    PoolCI.OnThreadStarted(i);
+
+                while (ThreadPool.ProcessTask(i, /*WaitForTask =*/true))
+                {
+                }
+
+                if (PoolCI.OnThreadExiting)
+                    PoolCI.OnThreadExiting(i);
+            });
+    }
+}
+
+} // namespace
+
 class ThreadPoolImpl final : public ObjectBase<IThreadPool>
 {
 public:
@@ -52,23 +177,7 @@ public:
                    const ThreadPoolCreateInfo& PoolCI) :
         TBase{pRefCounters}
     {
-        m_WorkerThreads.reserve(PoolCI.NumThreads);
-        for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
-        {
-            m_WorkerThreads.emplace_back(
-                [this, PoolCI, i] //
-                {
-                    if (PoolCI.OnThreadStarted)
-                        PoolCI.OnThreadStarted(i);
-
-                    while (ProcessTask(i, /*WaitForTask =*/true))
-                    {
-                    }
-
-                    if (PoolCI.OnThreadExiting)
-                        PoolCI.OnThreadExiting(i);
-                });
-        }
+        StartWorkerThreads(*this, PoolCI, m_WorkerThreads);
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ThreadPool, TBase)
@@ -112,34 +221,7 @@ public:
 
         if (TaskInfo.pTask)
         {
-            // Check prerequisites
-            bool  PrerequisitesMet  = true;
-            float MinPrereqPriority = +FLT_MAX;
-            for (auto& pPrereq : TaskInfo.Prerequisites)
-            {
-                if (auto pPrereqTask = pPrereq.Lock())
-                {
-                    if (!pPrereqTask->IsFinished())
-                    {
-                        PrerequisitesMet  = false;
-                        MinPrereqPriority = std::min(MinPrereqPriority, pPrereqTask->GetPriority());
-                    }
-                }
-            }
-
-            bool TaskFinished = false;
-            if (PrerequisitesMet)
-            {
-                TaskInfo.pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
-                ASYNC_TASK_STATUS ReturnStatus = TaskInfo.pTask->Run(ThreadId);
-                // NB: It is essential to set the task status after the Run() method returns.
-                //     This way if the GetStatus() method returns any value other than ASYNC_TASK_STATUS_RUNNING,
-                //     it is guaranteed that the task is not executed by any thread.
-                TaskInfo.pTask->SetStatus(ReturnStatus);
-                TaskFinished = TaskInfo.pTask->IsFinished();
-                DEV_CHECK_ERR((TaskFinished || TaskInfo.pTask->GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED),
-                              "Finished tasks must be in COMPLETE, CANCELLED or NOT_STARTED state");
-            }
+            const bool TaskFinished = TaskInfo.Run(ThreadId);
 
             {
                 std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
@@ -155,10 +237,6 @@ public:
                 }
                 else
                 {
-                    // If prerequisites are not met or the task requested to be re-run,
-                    // re-enqueue the task with the minimum prerequisite priority
-                    if (TaskInfo.pTask->GetPriority() > MinPrereqPriority)
-                        TaskInfo.pTask->SetPriority(MinPrereqPriority);
                     m_TasksQueue.emplace(TaskInfo.pTask->GetPriority(), std::move(TaskInfo));
                 }
             }
@@ -184,26 +262,7 @@ public:
             std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
             DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
 
-            QueuedTaskInfo TaskInfo;
-            TaskInfo.pTask = pTask;
-            if (ppPrerequisites != nullptr && NumPrerequisites > 0)
-            {
-                TaskInfo.Prerequisites.reserve(NumPrerequisites);
-                float MinPrereqPriority = +FLT_MAX;
-                for (Uint32 i = 0; i < NumPrerequisites; ++i)
-                {
-                    if (ppPrerequisites[i] != nullptr)
-                    {
-                        TaskInfo.Prerequisites.emplace_back(ppPrerequisites[i]);
-                        MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
-                    }
-                }
-                if (pTask->GetPriority() > MinPrereqPriority)
-                {
-                    TaskInfo.pTask->SetPriority(MinPrereqPriority);
-                }
-            }
-
+            QueuedTaskInfo TaskInfo{pTask, ppPrerequisites, NumPrerequisites};
             m_TasksQueue.emplace(pTask->GetPriority(), std::move(TaskInfo));
         }
         m_NextTaskCond.notify_one();
@@ -329,11 +388,6 @@ public:
 private:
     std::vector<std::thread> m_WorkerThreads;
 
-    struct QueuedTaskInfo
-    {
-        RefCntAutoPtr<IAsyncTask>              pTask;
-        std::vector<RefCntWeakPtr<IAsyncTask>> Prerequisites;
-    };
     // Priority queue
     std::mutex                                                m_TasksQueueMtx;
     std::multimap<float, QueuedTaskInfo, std::greater<float>> m_TasksQueue;
@@ -347,11 +401,657 @@ private:
     std::atomic<int> m_NumRunningTasks{0};
 };
 
+// Thread pool implementation that uses one task queue per worker thread.
+// Each queue is protected by its own spin lock, so that threads that enqueue
+// and process tasks do not contend on a single mutex. A worker that runs out
+// of tasks steals them from other queues. Thieves never block on a busy queue
+// and skip it instead.
+class WorkStealingThreadPoolImpl final : public ObjectBase<IThreadPool>
+{
+public:
+    using TBase = ObjectBase<IThreadPool>;
+
+    WorkStealingThreadPoolImpl(IReferenceCounters*         pRefCounters,
+                               const ThreadPoolCreateInfo& PoolCI) :
+        TBase{pRefCounters},
+        m_Queues(std::max(PoolCI.NumThreads, size_t{1}))
+    {
+        StartWorkerThreads(*this, PoolCI, m_WorkerThreads);
+    }
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ThreadPool, TBase)
+
+    virtual bool DILIGENT_CALL_TYPE ProcessTask(Uint32 ThreadId, bool WaitForTask) override final
+    {
+        const Uint32 QueueIdx = ThreadId % static_cast<Uint32>(m_Queues.size());
+
+        QueuedTaskInfo TaskInfo;
+        if (!PopTask(QueueIdx, TaskInfo))
+        {
+            if (WaitForTask)
+            {
+                // NB: the idle worker counter must be incremented before the predicate
+                //     is checked. EnqueueTask() increments the queued task counter first
+                //     and then checks the idle worker counter, so that either this thread
+                //     sees the new task, or EnqueueTask() sees this thread and wakes it up.
+                m_NumIdleWorkers.fetch_add(1);
+                while (true)
+                {
+                    // The wake-up epoch must be read before the predicate is checked, so that
+                    // if a task is enqueued after the check, the epoch differs and the wait
+                    // returns immediately.
+                    const Uint32 WakeEpoch = m_WakeEpoch.load();
+                    if (m_Stop.load() || m_NumQueuedTasks.load() > 0)
+                        break;
+                    PlatformMisc::WaitOnAddress(&m_WakeEpoch, WakeEpoch);
+                }
+                m_NumIdleWorkers.fetch_add(-1);
+            }
+
+            if (m_Stop.load() && m_NumQueuedTasks.load() == 0)
+                return false;
+
+            // The task may have been taken by another thread, in which case
+            // the caller will call ProcessTask() again.
+            if (!PopTask(QueueIdx, TaskInfo))
+                return true;
+        }
+
+        // Tasks enqueued by the running task will be placed into the same queue
+        const void* const pPrevPool = tl_pCurrentPool;
+        const Uint32      PrevQueue = tl_CurrentQueue;
+        tl_pCurrentPool             = this;
+        tl_CurrentQueue             = QueueIdx;
+
+        const bool TaskFinished = TaskInfo.Run(ThreadId);
+
+        tl_pCurrentPool = pPrevPool;
+        tl_CurrentQueue = PrevQueue;
+
+        if (!TaskFinished)
+        {
+            // NB: the task must be re-enqueued before the running task counter is decremented,
+            //     otherwise WaitForAllTasks() may miss the task.
+            PushTask(QueueIdx, std::move(TaskInfo));
+        }
+
+        // NB: the re-enqueued task may have already been picked up and completed by another
+        //     thread, so the check must be performed even if this task is not finished.
+        const int NumRunningTasks = m_NumRunningTasks.fetch_add(-1) - 1;
+        if (NumRunningTasks == 0 && m_NumQueuedTasks.load() == 0)
+        {
+            {
+                // Make sure that the thread waiting in WaitForAllTasks() either sees the
+                // updated counters or is already waiting for the condition variable.
+                std::unique_lock<std::mutex> lock{m_TasksFinishedMtx};
+            }
+            m_TasksFinishedCond.notify_all();
+        }
+
+        return true;
+    }
+
+    virtual void DILIGENT_CALL_TYPE EnqueueTask(IAsyncTask*  pTask,
+                                                IAsyncTask** ppPrerequisites,
+                                                Uint32       NumPrerequisites) override final
+    {
+        VERIFY_EXPR(pTask != nullptr);
+        if (pTask == nullptr)
+            return;
+
+        DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
+
+        // Tasks enqueued from the worker thread go to its own queue.
+        // Other threads distribute tasks between the queues in round-robin fashion.
+        const Uint32 QueueIdx = tl_pCurrentPool == this ?
+            tl_CurrentQueue :
+            m_NextQueue.fetch_add(1, std::memory_order_relaxed) % static_cast<Uint32>(m_Queues.size());
+
+        PushTask(QueueIdx, QueuedTaskInfo{pTask, ppPrerequisites, NumPrerequisites});
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitForAllTasks() override final
+    {
+        std::unique_lock<std::mutex> lock{m_TasksFinishedMtx};
+        m_TasksFinishedCond.wait(lock,
+                                 [this] //
+                                 {
+                                     return m_NumQueuedTasks.load() == 0 && m_NumRunningTasks.load() == 0;
+                                 } //
+        );
+    }
+
+    virtual void DILIGENT_CALL_TYPE StopThreads() override final
+    {
+        m_Stop.store(true);
+        WakeIdleWorkers(/*WakeAll = */ true);
+        for (std::thread& worker : m_WorkerThreads)
+            worker.join();
+
+        m_WorkerThreads.clear();
+    }
+
+    virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
+    {
+        for (WorkerQueue& Queue : m_Queues)
+        {
+            Threading::SpinLockGuard Guard{Queue.Lock};
+
+            QueuedTaskInfo TaskInfo;
+            if (Queue.Extract(pTask, TaskInfo))
+            {
+                m_NumQueuedTasks.fetch_add(-1);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    virtual bool DILIGENT_CALL_TYPE ReprioritizeTask(IAsyncTask* pTask) override final
+    {
+        for (WorkerQueue& Queue : m_Queues)
+        {
+            Threading::SpinLockGuard Guard{Queue.Lock};
+
+            QueuedTaskInfo TaskInfo;
+            if (Queue.Extract(pTask, TaskInfo))
+            {
+                Queue.Push(std::move(TaskInfo));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    virtual void DILIGENT_CALL_TYPE ReprioritizeAllTasks() override final
+    {
+        std::vector<QueuedTaskInfo> ReprioritizationList;
+        for (WorkerQueue& Queue : m_Queues)
+        {
+            Threading::SpinLockGuard Guard{Queue.Lock};
+
+            Queue.ExtractReprioritized(ReprioritizationList);
+            for (QueuedTaskInfo& TaskInfo : ReprioritizationList)
+                Queue.Push(std::move(TaskInfo));
+
+            ReprioritizationList.clear();
+        }
+    }
+
+    Uint32 DILIGENT_CALL_TYPE GetQueueSize() override final
+    {
+        return static_cast<Uint32>(std::max(m_NumQueuedTasks.load(), 0));
+    }
+
+    virtual Uint32 DILIGENT_CALL_TYPE GetRunningTaskCount() const override final
+    {
+        return m_NumRunningTasks.load();
+    }
+
+    ~WorkStealingThreadPoolImpl()
+    {
+        StopThreads();
+        VERIFY_EXPR(m_NumQueuedTasks.load() == 0);
+        VERIFY_EXPR(m_NumRunningTasks.load() == 0);
+    }
+
+private:
+    struct PriorityBucket
+    {
+        float                      Priority = 0;
+        std::deque<QueuedTaskInfo> Tasks;
+    };
+
+    // Per-worker task queue. All methods must be called while holding the lock.
+    struct alignas(64) WorkerQueue
+    {
+        Threading::SpinLock Lock;
+
+        // Priority buckets sorted by descending priority.
+        // Tasks within the same bucket are processed in FIFO order.
+        // All buckets are non-empty except for the last remaining one, which is
+        // kept to avoid reallocating the deque when the queue is drained and refilled.
+        std::vector<PriorityBucket> Buckets;
+
+        // These members are read without the lock to find the best queue to take the task from.
+        std::atomic<Uint32> NumTasks{0};
+        std::atomic<float>  TopPriority{-FLT_MAX};
+
+        void Push(QueuedTaskInfo&& TaskInfo)
+        {
+            const float Priority = TaskInfo.pTask->GetPriority();
+
+            auto it = std::lower_bound(Buckets.begin(), Buckets.end(), Priority,
+                                       [](const PriorityBucket& Bucket, float Prio) {
+                                           return Bucket.Priority > Prio;
+                                       });
+            if (it == Buckets.end() || it->Priority != Priority)
+            {
+                if (Buckets.size() == 1 && Buckets.front().Tasks.empty())
+                {
+                    // Reuse the empty bucket
+                    it           = Buckets.begin();
+                    it->Priority = Priority;
+                }
+                else
+                {
+                    it           = Buckets.emplace(it);
+                    it->Priority = Priority;
+                }
+            }
+            it->Tasks.emplace_back(std::move(TaskInfo));
+
+            NumTasks.store(NumTasks.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            UpdateTopPriority();
+        }
+
+        bool Pop(QueuedTaskInfo& TaskInfo)
+        {
+            if (NumTasks.load(std::memory_order_relaxed) == 0)
+                return false;
+
+            VERIFY_EXPR(!Buckets.empty() && !Buckets.front().Tasks.empty());
+            TaskInfo = std::move(Buckets.front().Tasks.front());
+            Buckets.front().Tasks.pop_front();
+            OnTaskRemoved(Buckets.begin());
+            return true;
+        }
+
+        bool Extract(IAsyncTask* pTask, QueuedTaskInfo& TaskInfo)
+        {
+            for (auto bucket_it = Buckets.begin(); bucket_it != Buckets.end(); ++bucket_it)
+            {
+                auto& Tasks   = bucket_it->Tasks;
+                auto  task_it = std::find_if(Tasks.begin(), Tasks.end(),
+                                             [pTask](const QueuedTaskInfo& Info) {
+                                                 return Info.pTask == pTask;
+                                             });
+                if (task_it != Tasks.end())
+                {
+                    TaskInfo = std::move(*task_it);
+                    Tasks.erase(task_it);
+                    OnTaskRemoved(bucket_it);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Extracts all tasks whose priority does not match the priority of their bucket
+        void ExtractReprioritized(std::vector<QueuedTaskInfo>& TaskList)
+        {
+            for (auto bucket_it = Buckets.begin(); bucket_it != Buckets.end();)
+            {
+                auto& Tasks = bucket_it->Tasks;
+                for (auto task_it = Tasks.begin(); task_it != Tasks.end();)
+                {
+                    if (task_it->pTask->GetPriority() != bucket_it->Priority)
+                    {
+                        TaskList.emplace_back(std::move(*task_it));
+                        task_it = Tasks.erase(task_it);
+                    }
+                    else
+                    {
+                        ++task_it;
+                    }
+                }
+
+                if (Tasks.empty() && Buckets.size() > 1)
+                    bucket_it = Buckets.erase(bucket_it);
+                else
+                    ++bucket_it;
+            }
+
+            NumTasks.store(NumTasks.load(std::memory_order_relaxed) - static_cast<Uint32>(TaskList.size()), std::memory_order_relaxed);
+            UpdateTopPriority();
+        }
+
+    private:
+        void OnTaskRemoved(std::vector<PriorityBucket>::iterator bucket_it)
+        {
+            if (bucket_it->Tasks.empty() && Buckets.size() > 1)
+                Buckets.erase(bucket_it);
+
+            VERIFY_EXPR(NumTasks.load(std::memory_order_relaxed) > 0);
+            NumTasks.store(NumTasks.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+            UpdateTopPriority();
+        }
+
+        void UpdateTopPriority()
+        {
+            TopPriority.store(!Buckets.empty() ? Buckets.front().Priority : -FLT_MAX, std::memory_order_relaxed);
+        }
+    };
+
+
+    void PushTask(Uint32 QueueIdx, QueuedTaskInfo&& TaskInfo)
+    {
+        {
+            WorkerQueue&             Queue = m_Queues[QueueIdx];
+            Threading::SpinLockGuard Guard{Queue.Lock};
+            Queue.Push(std::move(TaskInfo));
+            // NB: the counter must be updated under the queue lock so that it
+            //     never becomes negative when the task is popped by another thread.
+            m_NumQueuedTasks.fetch_add(1);
+        }
+
+        if (m_NumIdleWorkers.load() > 0)
+            WakeIdleWorkers(/*WakeAll = */ false);
+    }
+
+    void WakeIdleWorkers(bool WakeAll)
+    {
+        // Changing the epoch makes the worker that is about to go to sleep
+        // return from WaitOnAddress() immediately.
+        m_WakeEpoch.fetch_add(1);
+        if (WakeAll)
+            PlatformMisc::WakeByAddressAll(&m_WakeEpoch);
+        else
+            PlatformMisc::WakeByAddressSingle(&m_WakeEpoch);
+    }
+
+    bool PopTaskFromQueue(WorkerQueue& Queue, QueuedTaskInfo& TaskInfo)
+    {
+        if (!Queue.Pop(TaskInfo))
+            return false;
+
+        // NB: we must increment the running task counter before decrementing the
+        //     queued task counter, otherwise WaitForAllTasks() may miss the task.
+        m_NumRunningTasks.fetch_add(1);
+        m_NumQueuedTasks.fetch_add(-1);
+        return true;
+    }
+
+    bool PopTask(Uint32 OwnQueueIdx, QueuedTaskInfo& TaskInfo)
+    {
+        const Uint32 NumQueues = static_cast<Uint32>(m_Queues.size());
+
+        // Find the queue with the highest-priority task without taking any locks.
+        // The own queue is preferred when priorities are equal.
+        Uint32 BestQueueIdx = ~0u;
+        float  BestPriority = -FLT_MAX;
+        for (Uint32 i = 0; i < NumQueues; ++i)
+        {
+            const Uint32 QueueIdx = (OwnQueueIdx + i) % NumQueues;
+            WorkerQueue& Queue    = m_Queues[QueueIdx];
+            if (Queue.NumTasks.load(std::memory_order_relaxed) == 0)
+                continue;
+
+            const float Priority = Queue.TopPriority.load(std::memory_order_relaxed);
+            if (BestQueueIdx == ~0u || Priority > BestPriority)
+            {
+                BestQueueIdx = QueueIdx;
+                BestPriority = Priority;
+            }
+        }
+
+        if (BestQueueIdx == ~0u)
+            return false;
+
+        if (BestQueueIdx == OwnQueueIdx)
+        {
+            Threading::SpinLockGuard Guard{m_Queues[OwnQueueIdx].Lock};
+            if (PopTaskFromQueue(m_Queues[OwnQueueIdx], TaskInfo))
+                return true;
+        }
+        else
+        {
+            WorkerQueue& Victim = m_Queues[BestQueueIdx];
+            if (Victim.Lock.try_lock())
+            {
+                const bool Stolen = PopTaskFromQueue(Victim, TaskInfo);
+                Victim.Lock.unlock();
+                if (Stolen)
+                    return true;
+            }
+        }
+
+        // The best queue was either busy or has been emptied by another thread.
+        // Fall back to the own queue and then try to steal from any other queue.
+        if (m_Queues[OwnQueueIdx].NumTasks.load(std::memory_order_relaxed) > 0)
+        {
+            Threading::SpinLockGuard Guard{m_Queues[OwnQueueIdx].Lock};
+            if (PopTaskFromQueue(m_Queues[OwnQueueIdx], TaskInfo))
+                return true;
+        }
+
+        for (Uint32 i = 1; i < NumQueues; ++i)
+        {
+            WorkerQueue& Victim = m_Queues[(OwnQueueIdx + i) % NumQueues];
+            if (Victim.NumTasks.load(std::memory_order_relaxed) == 0 || !Victim.Lock.try_lock())
+                continue;
+
+            const bool Stolen = PopTaskFromQueue(Victim, TaskInfo);
+            Victim.Lock.unlock();
+            if (Stolen)
+                return true;
+        }
+
+        return false;
+    }
+
+private:
+    // The pool and the queue of the task that is being run by the current thread
+    static thread_local const void* tl_pCurrentPool;
+    static thread_local Uint32      tl_CurrentQueue;
+
+    std::vector<std::thread> m_WorkerThreads;
+    std::vector<WorkerQueue> m_Queues;
+    std::atomic<Uint32>      m_NextQueue{0};
+
+    // Idle workers are parked on the wake-up epoch that is incremented when tasks are enqueued
+    std::atomic<Uint32> m_WakeEpoch{0};
+
+    std::mutex              m_TasksFinishedMtx;
+    std::condition_variable m_TasksFinishedCond{};
+    std::atomic<bool>       m_Stop{false};
+
+    std::atomic<int> m_NumQueuedTasks{0};
+    std::atomic<int> m_NumRunningTasks{0};
+    std::atomic<int> m_NumIdleWorkers{0};
+};
+
+thread_local const void* WorkStealingThreadPoolImpl::tl_pCurrentPool = nullptr;
+thread_local Uint32      WorkStealingThreadPoolImpl::tl_CurrentQueue = 0;
+
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI)
 {
+    if (ThreadPoolCI.EnableWorkStealing)
+        return RefCntAutoPtr<WorkStealingThreadPoolImpl>{MakeNewRCObj<WorkStealingThreadPoolImpl>()(ThreadPoolCI)};
+
     return RefCntAutoPtr<ThreadPoolImpl>{MakeNewRCObj<ThreadPoolImpl>()(ThreadPoolCI)};
 }
 
+Uint32 TaskGraph::AddTask(TaskFunctionType Func)
+{
+    VERIFY_EXPR(Func);
+    m_Tasks.emplace_back();
+    m_Tasks.back().Func = std::move(Func);
+    return static_cast<Uint32>(m_Tasks.size() - 1);
+}
+
+void TaskGraph::AddDependency(Uint32 Prerequisite, Uint32 Dependent)
+{
+    DEV_CHECK_ERR(Prerequisite < m_Tasks.size(), "Prerequisite task index (", Prerequisite, ") is out of range");
+    DEV_CHECK_ERR(Dependent < m_Tasks.size(), "Dependent task index (", Dependent, ") is out of range");
+    DEV_CHECK_ERR(Prerequisite != Dependent, "A task can't depend on itself");
+
+    m_Tasks[Prerequisite].Dependents.push_back(Dependent);
+    ++m_Tasks[Dependent].NumPrerequisites;
+}
+
+void TaskGraph::Clear()
+{
+    m_Tasks.clear();
+}
+
+void TaskGraph::PushReadyTask(Uint32 TaskIdx)
+{
+    const Uint32 Slot = m_ReadyListWriteIdx.fetch_add(1);
+    VERIFY_EXPR(Slot < m_ReadyList.size());
+    m_ReadyList[Slot].store(TaskIdx, std::memory_order_release);
+}
+
+bool TaskGraph::PopReadyTask(Uint32& TaskIdx)
+{
+    Uint32 Slot = m_ReadyListReadIdx.load();
+    while (Slot < m_ReadyListWriteIdx.load())
+    {
+        if (m_ReadyListReadIdx.compare_exchange_weak(Slot, Slot + 1))
+        {
+            // The slot has been reserved by PushReadyTask(), but the task index may not have been written yet
+            while ((TaskIdx = m_ReadyList[Slot].load(std::memory_order_acquire)) == ~0u)
+                std::this_thread::yield();
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskGraph::ProcessReadyTasks()
+{
+    Uint32 TaskIdx = 0;
+    while (PopReadyTask(TaskIdx))
+    {
+        const TaskInfo& Task = m_Tasks[TaskIdx];
+        Task.Func();
+        for (Uint32 DependentIdx : Task.Dependents)
+        {
+            if (m_PendingPrerequisites[DependentIdx].fetch_add(-1) == 1)
+                PushReadyTask(DependentIdx);
+        }
+        // NB: the counter must be incremented after the dependents are made ready,
+        //     so that Execute() does not return before they are processed.
+        m_NumCompletedTasks.fetch_add(1);
+    }
+}
+
+void TaskGraph::Execute(IThreadPool* pThreadPool)
+{
+    const Uint32 NumTasks = GetTaskCount();
+    if (NumTasks == 0)
+        return;
+
+    if (m_PendingPrerequisites.size() != NumTasks)
+    {
+        m_PendingPrerequisites = std::vector<std::atomic<Uint32>>(NumTasks);
+        m_ReadyList            = std::vector<std::atomic<Uint32>>(NumTasks);
+    }
+
+    m_ReadyListWriteIdx.store(0);
+    m_ReadyListReadIdx.store(0);
+    m_NumCompletedTasks.store(0);
+    for (Uint32 i = 0; i < NumTasks; ++i)
+        m_ReadyList[i].store(~0u);
+
+    for (Uint32 i = 0; i < NumTasks; ++i)
+    {
+        m_PendingPrerequisites[i].store(m_Tasks[i].NumPrerequisites);
+        if (m_Tasks[i].NumPrerequisites == 0)
+            PushReadyTask(i);
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        // Check that the graph has no cycles using Kahn's algorithm
+        std::vector<Uint32> NumPrereqs(NumTasks);
+        std::vector<Uint32> Ready;
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            NumPrereqs[i] = m_Tasks[i].NumPrerequisites;
+            if (NumPrereqs[i] == 0)
+                Ready.push_back(i);
+        }
+        Uint32 NumVisited = 0;
+        while (!Ready.empty())
+        {
+            const Uint32 TaskIdx = Ready.back();
+            Ready.pop_back();
+            ++NumVisited;
+            for (Uint32 DependentIdx : m_Tasks[TaskIdx].Dependents)
+            {
+                if (--NumPrereqs[DependentIdx] == 0)
+                    Ready.push_back(DependentIdx);
+            }
+        }
+        if (NumVisited != NumTasks)
+        {
+            DEV_ERROR("Task graph contains cycles");
+            return;
+        }
+    }
+#endif
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Helpers;
+    if (pThreadPool != nullptr && NumTasks > 1)
+    {
+        const Uint32 NumHelpers = std::min(NumTasks - 1, std::max(std::thread::hardware_concurrency(), 1u));
+        Helpers.resize(NumHelpers);
+        for (RefCntAutoPtr<IAsyncTask>& pHelper : Helpers)
+        {
+            pHelper = EnqueueAsyncWork(pThreadPool,
+                                       [this](Uint32 ThreadId) //
+                                       {
+                                           // Helpers exit when no tasks are ready. The thread that
+                                           // completes the prerequisites processes the dependents.
+                                           ProcessReadyTasks();
+                                           return ASYNC_TASK_STATUS_COMPLETE;
+                                       });
+        }
+    }
+
+    // The calling thread helps out and waits until all tasks are complete
+    while (true)
+    {
+        ProcessReadyTasks();
+        if (m_NumCompletedTasks.load() == NumTasks)
+            break;
+        std::this_thread::yield();
+    }
+
+    for (RefCntAutoPtr<IAsyncTask>& pHelper : Helpers)
+    {
+        if (!pThreadPool->RemoveTask(pHelper))
+            pHelper->WaitForCompletion();
+    }
+}
+
+std::vector<Uint32> GetThreadPlacementProcessors(THREAD_PLACEMENT_FLAGS Flags)
+{
+    const CPUTopology& Topology = PlatformMisc::GetCPUTopology();
+
+    Uint32 ExcludedCore = CPUProcessorInfo::InvalidId;
+    if (Flags & THREAD_PLACEMENT_FLAG_EXCLUDE_CALLING_CORE)
+    {
+        if (const CPUProcessorInfo* pCallingProc = Topology.GetProcessor(PlatformMisc::GetCurrentProcessorIndex()))
+            ExcludedCore = pCallingProc->CoreId;
+    }
+
+    std::vector<bool>   CoreUsed(Topology.NumPhysicalCores);
+    std::vector<Uint32> Processors;
+    for (const CPUProcessorInfo& Proc : Topology.Processors)
+    {
+        if (Proc.CoreId == ExcludedCore)
+            continue;
+
+        if ((Flags & THREAD_PLACEMENT_FLAG_PERFORMANCE_CORES) && Proc.CoreType == CPUCoreType::Efficiency)
+            continue;
+
+        if (Flags & THREAD_PLACEMENT_FLAG_ONE_PER_PHYSICAL_CORE)
+        {
+            if (CoreUsed[Proc.CoreId])
+                continue;
+            CoreUsed[Proc.CoreId] = true;
+        }
+
+        Processors.push_back(Proc.Index);
+    }
+
+    return Processors;
+}
+
 Uint64 PinWorkerThread(Uint32 ThreadId, Uint64 AllowedCoresMask)
 {
     if (AllowedCoresMask == 0)
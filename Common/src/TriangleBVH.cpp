@@ -0,0 +1,321 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "TriangleBVH.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+struct Bounds
+{
+    float3 Min{+FLT_MAX, +FLT_MAX, +FLT_MAX};
+    float3 Max{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+
+    void Grow(const float3& Point)
+    {
+        Min = (min)(Min, Point);
+        Max = (max)(Max, Point);
+    }
+
+    void Grow(const Bounds& Other)
+    {
+        Min = (min)(Min, Other.Min);
+        Max = (max)(Max, Other.Max);
+    }
+
+    float HalfArea() const
+    {
+        const float3 Size = Max - Min;
+        return Size.x * Size.y + Size.y * Size.z + Size.z * Size.x;
+    }
+};
+
+// The number of bins used to evaluate the surface area heuristic
+constexpr Uint32 NumSAHBins = 16;
+
+// Below this depth, the builder switches from SAH splits to median splits that halve the number of
+// triangles on every level. Since the number of triangles is a 32-bit value, this limits the tree
+// depth to MaxSAHDepth + 32.
+constexpr Uint32 MaxSAHDepth = 48;
+
+} // namespace
+
+void TriangleBVH::Clear()
+{
+    m_Nodes.clear();
+    m_Vertices.clear();
+    m_TriangleIds.clear();
+}
+
+void TriangleBVH::Build(const float3* pVertices, Uint32 NumTriangles, Uint32 MaxLeafSize)
+{
+    static_assert(MaxSAHDepth + 32 <= MaxDepth, "Maximum depth is too small");
+
+    Clear();
+    if (NumTriangles == 0)
+        return;
+
+    DEV_CHECK_ERR(pVertices != nullptr, "Triangle vertices must not be null");
+    MaxLeafSize = std::max(MaxLeafSize, 1u);
+
+    std::vector<Bounds> TriBounds(NumTriangles);
+    std::vector<float3> Centroids(NumTriangles);
+    for (Uint32 tri = 0; tri < NumTriangles; ++tri)
+    {
+        const float3* pTri = pVertices + size_t{tri} * 3;
+        for (Uint32 v = 0; v < 3; ++v)
+            TriBounds[tri].Grow(pTri[v]);
+        Centroids[tri] = (TriBounds[tri].Min + TriBounds[tri].Max) * 0.5f;
+    }
+
+    m_TriangleIds.resize(NumTriangles);
+    std::iota(m_TriangleIds.begin(), m_TriangleIds.end(), 0u);
+
+    struct BuildTask
+    {
+        Uint32 NodeIdx;
+        Uint32 Begin;
+        Uint32 End;
+        Uint32 Depth;
+    };
+    std::vector<BuildTask> Tasks{{0, 0, NumTriangles, 0}};
+
+    m_Nodes.reserve(size_t{NumTriangles} / MaxLeafSize * 2 + 1);
+    m_Nodes.emplace_back();
+    while (!Tasks.empty())
+    {
+        const BuildTask Task = Tasks.back();
+        Tasks.pop_back();
+
+        Bounds NodeBounds;
+        Bounds CentroidBounds;
+        for (Uint32 i = Task.Begin; i < Task.End; ++i)
+        {
+            NodeBounds.Grow(TriBounds[m_TriangleIds[i]]);
+            CentroidBounds.Grow(Centroids[m_TriangleIds[i]]);
+        }
+
+        m_Nodes[Task.NodeIdx].Min = NodeBounds.Min;
+        m_Nodes[Task.NodeIdx].Max = NodeBounds.Max;
+
+        const Uint32 NumNodeTriangles = Task.End - Task.Begin;
+        if (NumNodeTriangles <= MaxLeafSize)
+        {
+            m_Nodes[Task.NodeIdx].FirstIdx     = Task.Begin;
+            m_Nodes[Task.NodeIdx].NumTriangles = NumNodeTriangles;
+            continue;
+        }
+
+        // Split along the axis with the largest centroid extent
+        const float3 CentroidExtent = CentroidBounds.Max - CentroidBounds.Min;
+
+        const int Axis = (CentroidExtent.x >= CentroidExtent.y && CentroidExtent.x >= CentroidExtent.z) ?
+            0 :
+            (CentroidExtent.y >= CentroidExtent.z ? 1 : 2);
+
+        Uint32 Mid = Task.Begin;
+        if (CentroidExtent[Axis] > 0 && Task.Depth < MaxSAHDepth)
+        {
+            const float AxisMin = CentroidBounds.Min[Axis];
+            const float BinScale = static_cast<float>(NumSAHBins) / CentroidExtent[Axis];
+
+            auto GetBin = [&](Uint32 TriIdx) {
+                const Uint32 Bin = static_cast<Uint32>((Centroids[TriIdx][Axis] - AxisMin) * BinScale);
+                return std::min(Bin, NumSAHBins - 1);
+            };
+
+            std::array<Bounds, NumSAHBins> BinBounds;
+            std::array<Uint32, NumSAHBins> BinCounts{};
+            for (Uint32 i = Task.Begin; i < Task.End; ++i)
+            {
+                const Uint32 Bin = GetBin(m_TriangleIds[i]);
+                BinBounds[Bin].Grow(TriBounds[m_TriangleIds[i]]);
+                ++BinCounts[Bin];
+            }
+
+            // Cost of the split after bin i is LeftCount * LeftArea + RightCount * RightArea
+            std::array<float, NumSAHBins - 1> LeftCost{};
+            {
+                Bounds LeftBounds;
+                Uint32 LeftCount = 0;
+                for (Uint32 i = 0; i < NumSAHBins - 1; ++i)
+                {
+                    LeftBounds.Grow(BinBounds[i]);
+                    LeftCount += BinCounts[i];
+                    LeftCost[i] = LeftCount > 0 ? LeftBounds.HalfArea() * static_cast<float>(LeftCount) : 0;
+                }
+            }
+
+            float  BestCost  = FLT_MAX;
+            Uint32 BestSplit = NumSAHBins;
+            {
+                Bounds RightBounds;
+                Uint32 RightCount = 0;
+                for (Uint32 i = NumSAHBins - 1; i > 0; --i)
+                {
+                    RightBounds.Grow(BinBounds[i]);
+                    RightCount += BinCounts[i];
+                    if (RightCount == 0 || RightCount == NumNodeTriangles)
+                        continue;
+
+                    const float Cost = LeftCost[i - 1] + RightBounds.HalfArea() * static_cast<float>(RightCount);
+                    if (Cost < BestCost)
+                    {
+                        BestCost  = Cost;
+                        BestSplit = i - 1;
+                    }
+                }
+            }
+
+            if (BestSplit < NumSAHBins)
+            {
+                auto MidIt = std::partition(m_TriangleIds.begin() + Task.Begin, m_TriangleIds.begin() + Task.End,
+                                            [&](Uint32 TriIdx) { return GetBin(TriIdx) <= BestSplit; });
+                Mid        = static_cast<Uint32>(MidIt - m_TriangleIds.begin());
+            }
+        }
+
+        if (Mid == Task.Begin || Mid == Task.End)
+        {
+            // Either SAH is not used or all centroids fall into the same bin: split in the middle
+            Mid = Task.Begin + NumNodeTriangles / 2;
+            std::nth_element(m_TriangleIds.begin() + Task.Begin, m_TriangleIds.begin() + Mid, m_TriangleIds.begin() + Task.End,
+                             [&](Uint32 Tri0, Uint32 Tri1) { return Centroids[Tri0][Axis] < Centroids[Tri1][Axis]; });
+        }
+
+        const Uint32 LeftChild = static_cast<Uint32>(m_Nodes.size());
+
+        m_Nodes[Task.NodeIdx].FirstIdx     = LeftChild;
+        m_Nodes[Task.NodeIdx].NumTriangles = 0;
+        m_Nodes.emplace_back();
+        m_Nodes.emplace_back();
+
+        Tasks.push_back({LeftChild + 1, Mid, Task.End, Task.Depth + 1});
+        Tasks.push_back({LeftChild, Task.Begin, Mid, Task.Depth + 1});
+    }
+
+    m_Vertices.resize(size_t{NumTriangles} * 3);
+    for (Uint32 i = 0; i < NumTriangles; ++i)
+    {
+        const float3* pSrcTri = pVertices + size_t{m_TriangleIds[i]} * 3;
+        std::copy(pSrcTri, pSrcTri + 3, m_Vertices.begin() + size_t{i} * 3);
+    }
+}
+
+TriangleBVH::HitInfo TriangleBVH::CastRay(const float3& RayOrigin,
+                                          const float3& RayDirection,
+                                          float         MaxDistance,
+                                          bool          CullBackFace) const
+{
+    HitInfo Hit;
+    if (m_Nodes.empty())
+        return Hit;
+
+    // Replace zero direction components with a tiny value to avoid NaNs in the slab test
+    float3 InvDir;
+    for (int i = 0; i < 3; ++i)
+    {
+        static constexpr float Epsilon = 1e-20f;
+
+        const float Dir = RayDirection[i];
+        InvDir[i]       = 1.f / (std::abs(Dir) > Epsilon ? Dir : (Dir >= 0 ? Epsilon : -Epsilon));
+    }
+
+    float HitDist = MaxDistance;
+
+    auto IntersectNode = [&](const Node& N, float& EnterDist) {
+        const float3 t0 = (N.Min - RayOrigin) * InvDir;
+        const float3 t1 = (N.Max - RayOrigin) * InvDir;
+        const float3 t_min = (min)(t0, t1);
+        const float3 t_max = (max)(t0, t1);
+
+        EnterDist = (max)(t_min.x, t_min.y, t_min.z, 0.f);
+
+        const float ExitDist = (min)(t_max.x, t_max.y, t_max.z);
+        return EnterDist <= ExitDist && EnterDist < HitDist;
+    };
+
+    float RootEnterDist = 0;
+    if (!IntersectNode(m_Nodes[0], RootEnterDist))
+        return Hit;
+
+    // Every processed inner node replaces itself with at most two children,
+    // so the stack never holds more than MaxDepth + 1 nodes.
+    Uint32 Stack[MaxDepth + 1];
+    Uint32 StackSize = 0;
+
+    Stack[StackSize++] = 0;
+    while (StackSize > 0)
+    {
+        const Node& N = m_Nodes[Stack[--StackSize]];
+        if (N.NumTriangles > 0)
+        {
+            const Uint32 LeafTri = IntersectRayTriangles(RayOrigin, RayDirection, &m_Vertices[size_t{N.FirstIdx} * 3], N.NumTriangles, HitDist, CullBackFace);
+            if (LeafTri != InvalidTriangle)
+                Hit.Triangle = m_TriangleIds[N.FirstIdx + LeafTri];
+            continue;
+        }
+
+        float        LeftEnterDist = 0, RightEnterDist = 0;
+        const Uint32 LeftChild  = N.FirstIdx;
+        const Uint32 RightChild = N.FirstIdx + 1;
+        const bool   HitLeft    = IntersectNode(m_Nodes[LeftChild], LeftEnterDist);
+        const bool   HitRight   = IntersectNode(m_Nodes[RightChild], RightEnterDist);
+        if (HitLeft && HitRight)
+        {
+            // Process the closer child first
+            const bool LeftIsCloser = LeftEnterDist <= RightEnterDist;
+            Stack[StackSize++]      = LeftIsCloser ? RightChild : LeftChild;
+            Stack[StackSize++]      = LeftIsCloser ? LeftChild : RightChild;
+        }
+        else if (HitLeft)
+        {
+            Stack[StackSize++] = LeftChild;
+        }
+        else if (HitRight)
+        {
+            Stack[StackSize++] = RightChild;
+        }
+        VERIFY_EXPR(StackSize <= _countof(Stack));
+    }
+
+    if (Hit.Triangle != InvalidTriangle)
+        Hit.Distance = HitDist;
+
+    return Hit;
+}
+
+} // namespace Diligent
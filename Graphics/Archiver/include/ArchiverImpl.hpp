@@ -74,6 +74,9 @@ public:
     /// Implementation of IArchiver::AddPipelineState().
     virtual Bool DILIGENT_CALL_TYPE AddPipelineState(IPipelineState* pPSO) override final;
 
+    /// Implementation of IArchiver::AddPipelineStates().
+    virtual Bool DILIGENT_CALL_TYPE AddPipelineStates(IPipelineState* const* ppPSOs, Uint32 NumPSOs) override final;
+
     /// Implementation of IArchiver::AddPipelineResourceSignature().
     virtual Bool DILIGENT_CALL_TYPE AddPipelineResourceSignature(IPipelineResourceSignature* pSignature) override final;
 
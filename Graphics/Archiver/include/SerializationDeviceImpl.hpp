@@ -30,6 +30,7 @@
 #include <memory>
 #include <string>
 #include <array>
+#include <unordered_map>
 
 #include "ArchiverFactory.h"
 
@@ -37,6 +38,8 @@
 #include "ObjectBase.hpp"
 #include "DXCompiler.hpp"
 #include "RenderDeviceBase.hpp"
+#include "DeviceObjectArchive.hpp"
+#include "DeviceObjectDigest.hpp"
 
 namespace Diligent
 {
@@ -71,6 +74,8 @@ public:
     UNSUPPORTED_METHOD(void, CreateSBT,         const ShaderBindingTableDesc& Desc, IShaderBindingTable** ppSBT)
     UNSUPPORTED_METHOD(void, CreatePipelineResourceSignature, const PipelineResourceSignatureDesc& Desc, IPipelineResourceSignature** ppSignature)
     UNSUPPORTED_METHOD(void, CreateDeviceMemory,       const DeviceMemoryCreateInfo&       CreateInfo, IDeviceMemory**       ppMemory)
+    UNSUPPORTED_METHOD(void, CreatePlacedTexture, const TextureDesc& Desc, IDeviceMemory* pMemory, Uint64 MemoryOffset, ITexture** ppTexture)
+    UNSUPPORTED_METHOD(void, CreatePlacedBuffer,  const BufferDesc&  Desc, IDeviceMemory* pMemory, Uint64 MemoryOffset, IBuffer**  ppBuffer)
     UNSUPPORTED_METHOD(void, CreatePipelineStateCache, const PipelineStateCacheCreateInfo& CreateInfo, IPipelineStateCache** ppPSOCache)
     UNSUPPORTED_METHOD(void, CreateDeferredContext, IDeviceContext** ppContext)
     UNSUPPORTED_METHOD(void, IdleGPU)
@@ -82,6 +87,8 @@ public:
                                                      IRenderPass**         ppRenderPass) override final;
 
     UNSUPPORTED_CONST_METHOD(SparseTextureFormatInfo, GetSparseTextureFormatInfo, TEXTURE_FORMAT TexFormat, RESOURCE_DIMENSION Dimension, Uint32 SampleCount)
+    UNSUPPORTED_CONST_METHOD(ResourceMemoryRequirements, GetTextureMemoryRequirements, const TextureDesc& Desc)
+    UNSUPPORTED_CONST_METHOD(ResourceMemoryRequirements, GetBufferMemoryRequirements,  const BufferDesc&  Desc)
 
     /// Implementation of ISerializationDevice::CreateShader().
     virtual void DILIGENT_CALL_TYPE CreateShader(const ShaderCreateInfo&  ShaderCI,
@@ -178,6 +185,14 @@ public:
         return m_RenderDevices[Type];
     }
 
+    /// Finds the shader compiled from the source with the given digest in the donor archive.
+    /// If the shader is found, initializes ShaderCI with the archived create info, sets its name to Name,
+    /// and returns the serialized shader data that ShaderCI references. Otherwise, returns empty data.
+    SerializedData GetDonorShader(DeviceObjectArchive::DeviceType Type,
+                                  const DeviceObjectDigest&       SourceDigest,
+                                  const char*                     Name,
+                                  ShaderCreateInfo&               ShaderCI) const;
+
 protected:
     static PipelineResourceBinding ResDescToPipelineResBinding(const PipelineResourceDesc& ResDesc, SHADER_TYPE Stages, Uint32 Register, Uint32 Space);
 
@@ -196,6 +211,8 @@ private:
     static void GetPipelineResourceBindingsWebGPU(const PipelineResourceBindingAttribs& Attribs,
                                                   std::vector<PipelineResourceBinding>& ResourceBindings);
 
+    void InitDonorArchive(const IDataBlob* pArchive);
+
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final
     {
         UNSUPPORTED("TestTextureFormat is not supported by serialization device");
@@ -215,6 +232,10 @@ private:
     std::vector<PipelineResourceBinding> m_ResourceBindings;
 
     std::array<RefCntAutoPtr<IRenderDevice>, RENDER_DEVICE_TYPE_COUNT> m_RenderDevices;
+
+    // Archive from a previous build and the names of its standalone shaders, by source digest
+    std::unique_ptr<DeviceObjectArchive>                                             m_pDonorArchive;
+    std::unordered_map<DeviceObjectDigest, std::string, DeviceObjectDigest::Hasher> m_DonorShaders;
 };
 
 } // namespace Diligent
@@ -73,6 +73,7 @@ public:
     UNSUPPORTED_CONST_METHOD(const GraphicsPipelineDesc&,   GetGraphicsPipelineDesc)
     UNSUPPORTED_CONST_METHOD(const RayTracingPipelineDesc&, GetRayTracingPipelineDesc)
     UNSUPPORTED_CONST_METHOD(const TilePipelineDesc&,       GetTilePipelineDesc)
+    UNSUPPORTED_CONST_METHOD(const PipelineStateCompileStats&, GetCompileStats)
 
     UNSUPPORTED_METHOD      (void,   BindStaticResources,    SHADER_TYPE ShaderStages, IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
     UNSUPPORTED_CONST_METHOD(Uint32, GetStaticVariableCount, SHADER_TYPE ShaderType)
@@ -81,6 +82,7 @@ public:
     UNSUPPORTED_METHOD      (IShaderResourceVariable*, GetStaticVariableByIndex, SHADER_TYPE ShaderType, Uint32 Index)
 
     UNSUPPORTED_METHOD      (void, CreateShaderResourceBinding,  IShaderResourceBinding** ppShaderResourceBinding, bool InitStaticResources)
+    UNSUPPORTED_METHOD      (void, CreateShaderResourceBindings, Uint32 NumSRBs, IShaderResourceBinding** ppSRBs, bool InitStaticResources)
     UNSUPPORTED_CONST_METHOD(void, InitializeStaticSRBResources, IShaderResourceBinding* pShaderResourceBinding)
     UNSUPPORTED_CONST_METHOD(void, CopyStaticResources,          IPipelineState* pPSO)
     UNSUPPORTED_CONST_METHOD(bool, IsCompatibleWith,             const IPipelineState* pPSO)
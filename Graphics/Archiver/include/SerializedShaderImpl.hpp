@@ -35,6 +35,7 @@
 #include "STDAllocator.hpp"
 #include "Serializer.hpp"
 #include "DeviceObjectArchive.hpp"
+#include "DeviceObjectDigest.hpp"
 
 namespace Diligent
 {
@@ -96,7 +97,9 @@ public:
         return static_cast<CompiledShaderType*>(m_Shaders[static_cast<size_t>(Type)].get());
     }
 
-    SerializedData GetCommonData() const { return SerializedData{}; }
+    // For standalone shaders, common data is the source digest that identifies
+    // the shader in donor archives, see SerializationDeviceCreateInfo::pDonorArchive.
+    SerializedData GetCommonData() const;
     SerializedData GetDeviceData(DeviceType Type) const;
 
     const ShaderCreateInfo& GetCreateInfo() const
@@ -106,6 +109,8 @@ public:
 
     static SerializedData SerializeCreateInfo(const ShaderCreateInfo& CI);
 
+    static bool ReadSourceDigest(const SerializedData& CommonData, DeviceObjectDigest& SourceDigest);
+
     bool operator==(const SerializedShaderImpl& Rhs) const noexcept;
     bool operator!=(const SerializedShaderImpl& Rhs) const noexcept
     {
@@ -118,6 +123,10 @@ private:
     SerializationDeviceImpl* m_pDevice;
     ShaderCreateInfoWrapper  m_CreateInfo;
 
+    // Digest of the create info with all includes expanded
+    DeviceObjectDigest m_SourceDigest;
+    bool               m_HasSourceDigest = false;
+
     std::array<std::unique_ptr<CompiledShader>, static_cast<size_t>(DeviceType::Count)> m_Shaders;
 
     template <typename ShaderType, typename... ArgTypes>
@@ -85,6 +85,20 @@ DILIGENT_TYPED_ENUM(ARCHIVE_DEVICE_DATA_FLAGS, Uint32)
 DEFINE_FLAG_ENUM_OPERATORS(ARCHIVE_DEVICE_DATA_FLAGS)
 
 
+/// Archive shader data compression mode
+DILIGENT_TYPED_ENUM(ARCHIVE_COMPRESSION_MODE, Uint32)
+{
+    /// Shader data is not compressed.
+    ARCHIVE_COMPRESSION_MODE_NONE = 0u,
+
+    /// Shader data is compressed with LZ4 using a dictionary trained
+    /// over all shaders of the same device type.
+    ARCHIVE_COMPRESSION_MODE_LZ4,
+
+    ARCHIVE_COMPRESSION_MODE_COUNT
+};
+
+
 /// Render state object archiver interface
 DILIGENT_BEGIN_INTERFACE(IArchiver, IObject)
 {
@@ -144,6 +158,24 @@ DILIGENT_BEGIN_INTERFACE(IArchiver, IObject)
     VIRTUAL Bool METHOD(AddPipelineState)(THIS_
                                           IPipelineState* pPSO) PURE;
 
+    /// Adds multiple pipeline states to the archive.
+
+    /// \param [in] ppPSOs  - an array of NumPSOs pointers to the pipeline states to add to the archive.
+    /// \param [in] NumPSOs - the number of elements in the ppPSOs array.
+    ///
+    /// \return     `true` if all pipeline states were added successfully, and `false` otherwise.
+    ///
+    /// \note
+    ///     The method is equivalent to calling AddPipelineState() for every pipeline state in the array,
+    ///     but acquires the archiver lock only once. It does not wait for the pipelines to finish compiling,
+    ///     so a large number of pipelines created with the PSO_CREATE_FLAG_ASYNCHRONOUS flag can be compiled
+    ///     in parallel by the serialization device thread pool and added in one call.
+    ///
+    ///     The method is thread-safe and may be called from multiple threads simultaneously.
+    VIRTUAL Bool METHOD(AddPipelineStates)(THIS_
+                                           IPipelineState* const* ppPSOs,
+                                           Uint32                 NumPSOs) PURE;
+
 
     /// Adds a pipeline resource signature to the archive.
 
@@ -206,6 +238,7 @@ DILIGENT_END_INTERFACE
 #    define IArchiver_SerializeToStream(This, ...)            CALL_IFACE_METHOD(Archiver, SerializeToStream,            This, __VA_ARGS__)
 #    define IArchiver_AddShader(This, ...)                    CALL_IFACE_METHOD(Archiver, AddShader,                    This, __VA_ARGS__)
 #    define IArchiver_AddPipelineState(This, ...)             CALL_IFACE_METHOD(Archiver, AddPipelineState,             This, __VA_ARGS__)
+#    define IArchiver_AddPipelineStates(This, ...)            CALL_IFACE_METHOD(Archiver, AddPipelineStates,            This, __VA_ARGS__)
 #    define IArchiver_AddPipelineResourceSignature(This, ...) CALL_IFACE_METHOD(Archiver, AddPipelineResourceSignature, This, __VA_ARGS__)
 #    define IArchiver_GetShader(This, ...)                    CALL_IFACE_METHOD(Archiver, GetShader,                    This, __VA_ARGS__)
 #    define IArchiver_GetPipelineState(This, ...)             CALL_IFACE_METHOD(Archiver, GetPipelineState,             This, __VA_ARGS__)
@@ -227,6 +227,9 @@ struct SerializationDeviceCreateInfo
     SerializationDeviceMtlInfo Metal;
 
     /// An optional thread pool for asynchronous shader and pipeline state compilation.
+
+    /// When the thread pool is available, shaders that target multiple devices are compiled
+    /// for all devices in parallel, even if SHADER_COMPILE_FLAG_ASYNCHRONOUS flag is not set.
     IThreadPool* pAsyncShaderCompilationThreadPool DEFAULT_INITIALIZER(nullptr);
 
     /// The maximum number of threads that can be used to compile shaders.
@@ -240,6 +243,19 @@ struct SerializationDeviceCreateInfo
     /// thread pool is used instead.
     Uint32 NumAsyncShaderCompilationThreads DEFAULT_INITIALIZER(0);
 
+    /// An optional archive produced by a previous build that is used as a source of compiled shaders.
+
+    /// When a shader is created, the device looks for a standalone shader in the donor archive
+    /// that was compiled from the same create info (the name is ignored; files and includes are
+    /// compared by their contents). If such a shader is found, its Direct3D11, Direct3D12, Vulkan
+    /// and WebGPU byte code is reused instead of compiling the shader again. Pipelines that use
+    /// this shader are then patched from the reused byte code.
+    ///
+    /// \note  Only shaders added to the donor archive with IArchiver::AddShader() can be reused.
+    ///        The donor archive must have been produced by a serialization device with the same
+    ///        compiler settings, since the settings are not part of the shader digest.
+    const IDataBlob* pDonorArchive DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     SerializationDeviceCreateInfo() noexcept
     {
@@ -323,6 +339,22 @@ DILIGENT_BEGIN_INTERFACE(IArchiverFactory, IObject)
                                        IDataBlob**      ppDstArchive) CONST PURE;
 
 
+    /// Compresses the shader data in the archive and writes a new archive to the stream.
+
+    /// \param [in]  pSrcArchive  - Source archive.
+    /// \param [in]  Mode         - Compression mode. If the mode is ARCHIVE_COMPRESSION_MODE_NONE,
+    ///                             the shader data will be decompressed.
+    /// \param [out] ppDstArchive - Memory address where a pointer to the new archive will be written.
+    /// \return     `true` if the archive was successfully compressed, and `false` otherwise.
+    ///
+    /// \remarks    Compressed shaders are decompressed by the dearchiver when they are unpacked.
+    ///             Shaders that don't benefit from compression are stored uncompressed.
+    VIRTUAL Bool METHOD(CompressArchive)(THIS_
+                                         const IDataBlob*         pSrcArchive,
+                                         ARCHIVE_COMPRESSION_MODE Mode,
+                                         IDataBlob**              ppDstArchive) CONST PURE;
+
+
     /// Prints archive content for debugging and validation.
     VIRTUAL Bool METHOD(PrintArchiveContent)(THIS_
                                              const IDataBlob* pArchive) CONST PURE;
@@ -365,6 +397,7 @@ DILIGENT_END_INTERFACE
 #    define IArchiverFactory_RemoveDeviceData(This, ...)                        CALL_IFACE_METHOD(ArchiverFactory, RemoveDeviceData,                       This, __VA_ARGS__)
 #    define IArchiverFactory_AppendDeviceData(This, ...)                        CALL_IFACE_METHOD(ArchiverFactory, AppendDeviceData,                       This, __VA_ARGS__)
 #    define IArchiverFactory_MergeArchives(This, ...)                           CALL_IFACE_METHOD(ArchiverFactory, MergeArchives,                          This, __VA_ARGS__)
+#    define IArchiverFactory_CompressArchive(This, ...)                         CALL_IFACE_METHOD(ArchiverFactory, CompressArchive,                        This, __VA_ARGS__)
 #    define IArchiverFactory_PrintArchiveContent(This, ...)                     CALL_IFACE_METHOD(ArchiverFactory, PrintArchiveContent,                    This, __VA_ARGS__)
 #    define IArchiverFactory_SetMessageCallback(This, ...)                      CALL_IFACE_METHOD(ArchiverFactory, SetMessageCallback,                     This, __VA_ARGS__)
 #    define IArchiverFactory_SetBreakOnError(This, ...)                         CALL_IFACE_METHOD(ArchiverFactory, SetBreakOnError,                        This, __VA_ARGS__)
@@ -137,6 +137,11 @@ public:
         Uint32           NumSrcArchives,
         IDataBlob**      ppDstArchive) const override final;
 
+    virtual Bool DILIGENT_CALL_TYPE CompressArchive(
+        const IDataBlob*         pSrcArchive,
+        ARCHIVE_COMPRESSION_MODE Mode,
+        IDataBlob**              ppDstArchive) const override final;
+
     virtual Bool DILIGENT_CALL_TYPE PrintArchiveContent(const IDataBlob* pArchive) const override final;
 
     virtual void DILIGENT_CALL_TYPE SetMessageCallback(DebugMessageCallbackType MessageCallback) const override final;
@@ -326,6 +331,51 @@ Bool ArchiverFactoryImpl::MergeArchives(
     }
 }
 
+Bool ArchiverFactoryImpl::CompressArchive(const IDataBlob*         pSrcArchive,
+                                          ARCHIVE_COMPRESSION_MODE Mode,
+                                          IDataBlob**              ppDstArchive) const
+{
+    if (pSrcArchive == nullptr)
+    {
+        DEV_ERROR("pSrcArchive must not be null");
+        return false;
+    }
+    if (ppDstArchive == nullptr)
+    {
+        DEV_ERROR("ppDstArchive must not be null");
+        return false;
+    }
+    DEV_CHECK_ERR(*ppDstArchive == nullptr, "*ppDstArchive must be null");
+
+    static_assert(ARCHIVE_COMPRESSION_MODE_COUNT == 2, "Please handle the new compression mode below");
+    DeviceObjectArchive::ShaderCompression Compression = DeviceObjectArchive::ShaderCompression::None;
+    switch (Mode)
+    {
+        case ARCHIVE_COMPRESSION_MODE_NONE:
+            Compression = DeviceObjectArchive::ShaderCompression::None;
+            break;
+
+        case ARCHIVE_COMPRESSION_MODE_LZ4:
+            Compression = DeviceObjectArchive::ShaderCompression::LZ4;
+            break;
+
+        default:
+            DEV_ERROR("Unknown archive compression mode: ", Uint32{Mode});
+            return false;
+    }
+
+    try
+    {
+        const DeviceObjectArchive ObjectArchive{DeviceObjectArchive::CreateInfo{pSrcArchive}};
+        ObjectArchive.Serialize(ppDstArchive, Compression);
+        return *ppDstArchive != nullptr;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
 Bool ArchiverFactoryImpl::PrintArchiveContent(const IDataBlob* pArchive) const
 {
     try
@@ -28,12 +28,124 @@
 #include "Archiver_Inc.hpp"
 
 #include <vector>
+#include <string>
 
 #include "PSOSerializer.hpp"
+#include "DeviceObjectDigest.hpp"
 
 namespace Diligent
 {
 
+namespace
+{
+
+// Deduplicates device shader byte code by a 128-bit digest of the shader contents.
+// Pipeline shaders are referenced by index and their names are only used for debugging,
+// so names are not included in the digest and byte-identical shaders with different names
+// share the same archive entry. Standalone shaders are unpacked by name, so they only reuse
+// entries with the same name.
+class ShaderDeduplicator
+{
+public:
+    using DeviceType = DeviceObjectArchive::DeviceType;
+
+    Uint32 AddPipelineShader(DeviceType Type, std::vector<SerializedData>& DstShaders, const SerializedData& Data)
+    {
+        // NB: since the Archive object is temporary, we do not need to copy the data
+        return AddShader(Type, DstShaders, SerializedData{Data.Ptr(), Data.Size()}, /*IsStandalone = */ false);
+    }
+
+    Uint32 AddStandaloneShader(DeviceType Type, std::vector<SerializedData>& DstShaders, SerializedData&& Data)
+    {
+        return AddShader(Type, DstShaders, std::move(Data), /*IsStandalone = */ true);
+    }
+
+    void LogStatistics() const
+    {
+        size_t NumReferences = 0;
+        size_t NumUnique     = 0;
+        size_t BytesSaved    = 0;
+        for (const DeviceShaders& Shaders : m_Devices)
+        {
+            NumReferences += Shaders.NumReferences;
+            NumUnique += Shaders.Names.size();
+            BytesSaved += Shaders.BytesSaved;
+        }
+
+        if (NumReferences != NumUnique)
+        {
+            LOG_INFO_MESSAGE("Archiver: ", NumReferences, " device shaders were deduplicated into ", NumUnique,
+                             " unique shaders, saving ", BytesSaved, " bytes.");
+        }
+    }
+
+private:
+    struct DeviceShaders
+    {
+        std::unordered_map<DeviceObjectDigest, Uint32, DeviceObjectDigest::Hasher> DigestToIdx;
+
+        // Shader names, for every archive entry
+        std::vector<std::string> Names;
+
+        Uint32 NumReferences = 0;
+        size_t BytesSaved    = 0;
+    };
+
+    Uint32 AddShader(DeviceType Type, std::vector<SerializedData>& DstShaders, SerializedData&& Data, bool IsStandalone)
+    {
+        VERIFY_EXPR(Data);
+        DeviceShaders& Shaders = m_Devices[static_cast<size_t>(Type)];
+        VERIFY(Shaders.Names.size() == DstShaders.size(), "All shaders must be added through the deduplicator");
+        ++Shaders.NumReferences;
+
+        ShaderCreateInfo ShaderCI;
+        {
+            Serializer<SerializerMode::Read> Ser{Data};
+            if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(Ser, ShaderCI))
+            {
+                UNEXPECTED("Failed to deserialize shader create info");
+                return AddEntry(Shaders, DstShaders, std::move(Data), "");
+            }
+        }
+
+        DeviceObjectDigest Digest;
+        if (!ComputeDeviceObjectDigest(ShaderCI, Digest))
+            return AddEntry(Shaders, DstShaders, std::move(Data), ShaderCI.Desc.Name);
+
+        auto it = Shaders.DigestToIdx.find(Digest);
+        if (it != Shaders.DigestToIdx.end())
+        {
+            const Uint32 Idx = it->second;
+            if (!IsStandalone || Shaders.Names[Idx] == (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""))
+            {
+                Shaders.BytesSaved += Data.Size();
+                return Idx;
+            }
+            // Standalone shader with the same contents, but a different name needs its own entry.
+            // The digest keeps referring to the first entry.
+            return AddEntry(Shaders, DstShaders, std::move(Data), ShaderCI.Desc.Name);
+        }
+
+        const Uint32 Idx = AddEntry(Shaders, DstShaders, std::move(Data), ShaderCI.Desc.Name);
+        Shaders.DigestToIdx.emplace(Digest, Idx);
+        return Idx;
+    }
+
+    Uint32 AddEntry(DeviceShaders& Shaders, std::vector<SerializedData>& DstShaders, SerializedData&& Data, const char* Name)
+    {
+        const Uint32 Idx = StaticCast<Uint32>(DstShaders.size());
+        // Copy the name before the data is moved
+        Shaders.Names.emplace_back(Name != nullptr ? Name : "");
+        DstShaders.emplace_back(std::move(Data));
+        return Idx;
+    }
+
+private:
+    std::array<DeviceShaders, static_cast<size_t>(DeviceType::Count)> m_Devices;
+};
+
+} // namespace
+
 static DeviceObjectArchive::ResourceType PipelineTypeToArchiveResourceType(PIPELINE_TYPE PipelineType)
 {
     using ResourceType = DeviceObjectArchive::ResourceType;
@@ -77,8 +189,7 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
 
     DeviceObjectArchive Archive{ContentVersion};
 
-    // A hash map that maps shader byte code to the index in the archive, for each device type
-    std::array<std::unordered_map<size_t, Uint32>, static_cast<size_t>(DeviceType::Count)> BytecodeHashToIdx;
+    ShaderDeduplicator Shaders;
 
     // Add pipelines and patched shaders
     for (const auto& pso_it : m_Pipelines)
@@ -131,14 +242,7 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
             for (const SerializedPipelineStateImpl::Data::ShaderInfo& SrcShader : SrcShaders)
             {
                 VERIFY_EXPR(SrcShader.Data);
-
-                auto it_inserted = BytecodeHashToIdx[device_type].emplace(SrcShader.Hash, StaticCast<Uint32>(DstShaders.size()));
-                if (it_inserted.second)
-                {
-                    // New byte code - add it
-                    DstShaders.emplace_back(SrcShader.Data.Ptr(), SrcShader.Data.Size());
-                }
-                ShaderIndices.emplace_back(it_inserted.first->second);
+                ShaderIndices.emplace_back(Shaders.AddPipelineShader(static_cast<DeviceType>(device_type), DstShaders, SrcShader.Data));
             }
 
             DeviceObjectArchive::ShaderIndexArray Indices{ShaderIndices.data(), StaticCast<Uint32>(ShaderIndices.size())};
@@ -213,14 +317,8 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
             if (!DeviceData)
                 continue;
 
-            auto& DstShaders  = Archive.GetDeviceShaders(static_cast<DeviceType>(device_type));
-            auto  it_inserted = BytecodeHashToIdx[device_type].emplace(DeviceData.GetHash(), StaticCast<Uint32>(DstShaders.size()));
-            if (it_inserted.second)
-            {
-                // New byte code
-                DstShaders.emplace_back(std::move(DeviceData));
-            }
-            const Uint32 Index = it_inserted.first->second;
+            auto&        DstShaders = Archive.GetDeviceShaders(static_cast<DeviceType>(device_type));
+            const Uint32 Index      = Shaders.AddStandaloneShader(static_cast<DeviceType>(device_type), DstShaders, std::move(DeviceData));
 
             // For shaders, device-specific data is the serialized shader bytecode index
             SerializedData& SerializedIndex = DstData.DeviceSpecific[device_type];
@@ -235,6 +333,8 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
         }
     }
 
+    Shaders.LogStatistics();
+
     Archive.Serialize(ppBlob);
 
     return *ppBlob != nullptr;
@@ -318,31 +418,70 @@ Bool ArchiverImpl::AddPipelineState(IPipelineState* pPSO)
     if (pPSO == nullptr)
         return false;
 
-    RefCntAutoPtr<SerializedPipelineStateImpl> pSerializedPSO{pPSO, IID_SerializedPipelineState};
-    if (!pSerializedPSO)
+    return AddPipelineStates(&pPSO, 1);
+}
+
+Bool ArchiverImpl::AddPipelineStates(IPipelineState* const* ppPSOs, Uint32 NumPSOs)
+{
+    if (NumPSOs == 0)
+        return true;
+
+    if (ppPSOs == nullptr)
     {
-        UNEXPECTED("Pipeline state '", pPSO->GetDesc().Name, "' was not created by a serialization device.");
+        DEV_ERROR("ppPSOs must not be null when NumPSOs (", NumPSOs, ") is not zero");
         return false;
     }
 
-    const PipelineStateDesc& Desc = pSerializedPSO->GetDesc();
-    const char*              Name = Desc.Name;
-    // Mesh pipelines are serialized as graphics pipelines
-    const ResourceType ArchiveResType = PipelineTypeToArchiveResourceType(Desc.PipelineType);
+    bool Res = true;
 
+    std::vector<RefCntAutoPtr<SerializedPipelineStateImpl>> SerializedPSOs;
+    SerializedPSOs.reserve(NumPSOs);
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        IPipelineState* pPSO = ppPSOs[i];
+        if (pPSO == nullptr)
+        {
+            Res = false;
+            continue;
+        }
+
+        RefCntAutoPtr<SerializedPipelineStateImpl> pSerializedPSO{pPSO, IID_SerializedPipelineState};
+        if (!pSerializedPSO)
+        {
+            UNEXPECTED("Pipeline state '", pPSO->GetDesc().Name, "' was not created by a serialization device.");
+            Res = false;
+            continue;
+        }
+
+        SerializedPSOs.emplace_back(std::move(pSerializedPSO));
+    }
+
+    std::vector<IRenderPass*> RenderPasses;
     {
         std::lock_guard<std::mutex> Guard{m_PipelinesMtx};
 
-        auto it_inserted = m_Pipelines.emplace(NamedResourceKey{ArchiveResType, Name, true}, pSerializedPSO);
-        if (!it_inserted.second)
+        for (const RefCntAutoPtr<SerializedPipelineStateImpl>& pSerializedPSO : SerializedPSOs)
         {
-            LOG_ERROR_MESSAGE("Pipeline state with name '", Name, "' is already present in the archive. All pipelines of the same type must have unique names.");
-            return false;
+            const PipelineStateDesc& Desc = pSerializedPSO->GetDesc();
+            const char*              Name = Desc.Name;
+            // Mesh pipelines are serialized as graphics pipelines
+            const ResourceType ArchiveResType = PipelineTypeToArchiveResourceType(Desc.PipelineType);
+
+            auto it_inserted = m_Pipelines.emplace(NamedResourceKey{ArchiveResType, Name, true}, pSerializedPSO);
+            if (!it_inserted.second)
+            {
+                LOG_ERROR_MESSAGE("Pipeline state with name '", Name, "' is already present in the archive. All pipelines of the same type must have unique names.");
+                Res = false;
+                continue;
+            }
+
+            if (IRenderPass* pRenderPass = pSerializedPSO->GetRenderPass())
+                RenderPasses.push_back(pRenderPass);
         }
     }
 
-    bool Res = true;
-    if (IRenderPass* pRenderPass = pSerializedPSO->GetRenderPass())
+    // Render passes are added outside of the pipelines lock
+    for (IRenderPass* pRenderPass : RenderPasses)
     {
         if (!AddRenderPass(pRenderPass))
             Res = false;
@@ -66,11 +66,24 @@ struct CompiledShaderD3D11 final : SerializedShaderImpl::CompiledShader
     {
         const IDataBlob* pBytecode = ShaderD3D11.GetD3DBytecode();
 
-        ShaderCI.Source       = nullptr;
-        ShaderCI.FilePath     = nullptr;
-        ShaderCI.Macros       = {};
-        ShaderCI.ByteCode     = pBytecode->GetConstDataPtr();
-        ShaderCI.ByteCodeSize = pBytecode->GetSize();
+        ShaderCI.Source   = nullptr;
+        ShaderCI.FilePath = nullptr;
+        ShaderCI.Macros   = {};
+
+        SerializedData ArchiveData;
+        if (const std::shared_ptr<const ShaderResourcesD3D11>& pResources = ShaderD3D11.GetShaderResources())
+        {
+            // Store the reflection along with the bytecode so that the shader can be created without reflecting it
+            ArchiveData           = D3DShaderArchiveData::Pack(pBytecode, *pResources);
+            ShaderCI.ByteCode     = ArchiveData.Ptr();
+            ShaderCI.ByteCodeSize = ArchiveData.Size();
+        }
+        else
+        {
+            // Shader was created without reflection
+            ShaderCI.ByteCode     = pBytecode->GetConstDataPtr();
+            ShaderCI.ByteCodeSize = pBytecode->GetSize();
+        }
         return SerializedShaderImpl::SerializeCreateInfo(ShaderCI);
     }
 
@@ -193,14 +206,25 @@ void SerializedPipelineStateImpl::PatchShadersD3D11(const CreateInfoType& Create
     VERIFY_EXPR(m_Data.Shaders[static_cast<size_t>(DeviceType::Direct3D11)].empty());
     for (size_t i = 0; i < ShadersD3D11.size(); ++i)
     {
-        const IDataBlob* pBytecode = ShaderBytecode[i];
-        ShaderCreateInfo ShaderCI  = ShaderStages[i].pSerialized->GetCreateInfo();
+        IDataBlob*        pBytecode = ShaderBytecode[i];
+        const ShaderDesc& ShDesc    = ShadersD3D11[i]->GetDesc();
+        ShaderCreateInfo  ShaderCI  = ShaderStages[i].pSerialized->GetCreateInfo();
+
+        // Resource bindings in the patched bytecode differ from the original shader's reflection,
+        // so reflect the patched bytecode here rather than when the archive is loaded.
+        const ShaderResourcesD3D11 PatchedResources{
+            pBytecode,
+            ShDesc,
+            ShDesc.UseCombinedTextureSamplers ? ShDesc.CombinedSamplerSuffix : nullptr,
+            false, // LoadConstantBufferReflection
+        };
+        const SerializedData ArchiveData = D3DShaderArchiveData::Pack(pBytecode, PatchedResources);
 
         ShaderCI.Source       = nullptr;
         ShaderCI.FilePath     = nullptr;
         ShaderCI.Macros       = {};
-        ShaderCI.ByteCode     = pBytecode->GetConstDataPtr();
-        ShaderCI.ByteCodeSize = pBytecode->GetSize();
+        ShaderCI.ByteCode     = ArchiveData.Ptr();
+        ShaderCI.ByteCodeSize = ArchiveData.Size();
         SerializeShaderCreateInfo(DeviceType::Direct3D11, ShaderCI);
     }
     VERIFY_EXPR(m_Data.Shaders[static_cast<size_t>(DeviceType::Direct3D11)].size() == ShadersD3D11.size());
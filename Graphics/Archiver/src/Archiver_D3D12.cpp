@@ -55,11 +55,24 @@ struct CompiledShaderD3D12 final : SerializedShaderImpl::CompiledShader
     {
         const IDataBlob* pBytecode = ShaderD3D12.GetD3DBytecode();
 
-        ShaderCI.Source       = nullptr;
-        ShaderCI.FilePath     = nullptr;
-        ShaderCI.Macros       = {};
-        ShaderCI.ByteCode     = pBytecode->GetConstDataPtr();
-        ShaderCI.ByteCodeSize = pBytecode->GetSize();
+        ShaderCI.Source   = nullptr;
+        ShaderCI.FilePath = nullptr;
+        ShaderCI.Macros   = {};
+
+        SerializedData ArchiveData;
+        if (const std::shared_ptr<const ShaderResourcesD3D12>& pResources = ShaderD3D12.GetShaderResources())
+        {
+            // Store the reflection along with the bytecode so that the shader can be created without reflecting it
+            ArchiveData           = D3DShaderArchiveData::Pack(pBytecode, *pResources);
+            ShaderCI.ByteCode     = ArchiveData.Ptr();
+            ShaderCI.ByteCodeSize = ArchiveData.Size();
+        }
+        else
+        {
+            // Shader was created without reflection
+            ShaderCI.ByteCode     = pBytecode->GetConstDataPtr();
+            ShaderCI.ByteCodeSize = pBytecode->GetSize();
+        }
         return SerializedShaderImpl::SerializeCreateInfo(ShaderCI);
     }
 
@@ -165,14 +178,26 @@ void SerializedPipelineStateImpl::PatchShadersD3D12(const CreateInfoType& Create
         const PipelineStateD3D12Impl::ShaderStageInfo& Stage = ShaderStagesD3D12[j];
         for (size_t i = 0; i < Stage.Count(); ++i)
         {
-            const IDataBlob* pBytecode = Stage.ByteCodes[i];
-            ShaderCreateInfo ShaderCI  = ShaderStages[j].Serialized[i]->GetCreateInfo();
+            IDataBlob*        pBytecode = Stage.ByteCodes[i];
+            const ShaderDesc& ShDesc    = Stage.Shaders[i]->GetDesc();
+            ShaderCreateInfo  ShaderCI  = ShaderStages[j].Serialized[i]->GetCreateInfo();
+
+            // Resource bindings in the patched bytecode differ from the original shader's reflection,
+            // so reflect the patched bytecode here rather than when the archive is loaded.
+            const ShaderResourcesD3D12 PatchedResources{
+                pBytecode,
+                ShDesc,
+                ShDesc.UseCombinedTextureSamplers ? ShDesc.CombinedSamplerSuffix : nullptr,
+                m_pSerializationDevice->GetD3D12Properties().pDxCompiler,
+                false, // LoadConstantBufferReflection
+            };
+            const SerializedData ArchiveData = D3DShaderArchiveData::Pack(pBytecode, PatchedResources);
 
             ShaderCI.Source       = nullptr;
             ShaderCI.FilePath     = nullptr;
             ShaderCI.Macros       = {};
-            ShaderCI.ByteCode     = pBytecode->GetConstDataPtr();
-            ShaderCI.ByteCodeSize = pBytecode->GetSize();
+            ShaderCI.ByteCode     = ArchiveData.Ptr();
+            ShaderCI.ByteCodeSize = ArchiveData.Size();
             SerializeShaderCreateInfo(DeviceType::Direct3D12, ShaderCI);
         }
     }
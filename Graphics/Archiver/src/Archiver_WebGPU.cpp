@@ -36,6 +36,7 @@
 #include "DeviceObjectArchiveWebGPU.hpp"
 #include "SerializedPipelineStateImpl.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "WGSLShaderResources.hpp"
 
 namespace Diligent
 {
@@ -43,6 +44,49 @@ namespace Diligent
 namespace
 {
 
+// Serializes WGSL along with the shader resource reflection, so that the shader
+// can be created at run time without parsing WGSL (see ShaderWebGPUImpl::Initialize()).
+SerializedData SerializeWGSLArchiveData(const std::string& WGSL, const WGSLShaderResources& Resources)
+{
+    std::vector<WGSLShaderArchiveData::Resource> ArchivedResources(Resources.GetTotalResources());
+    for (Uint32 i = 0; i < Resources.GetTotalResources(); ++i)
+    {
+        const WGSLShaderResourceAttribs&  Src = Resources.GetResource(i);
+        WGSLShaderArchiveData::Resource& Dst = ArchivedResources[i];
+
+        Dst.Name             = Src.Name;
+        Dst.BufferStaticSize = Src.BufferStaticSize;
+        Dst.ArraySize        = Src.ArraySize;
+        Dst.BindGroup        = Src.BindGroup;
+        Dst.BindIndex        = Src.BindIndex;
+        Dst.Format           = static_cast<Uint16>(Src.Format);
+        Dst.Type             = static_cast<Uint8>(Src.Type);
+        Dst.ResourceDim      = Src.ResourceDim;
+        Dst.SampleType       = static_cast<Uint8>(Src.SampleType);
+    }
+
+    WGSLShaderArchiveData ArchiveData;
+    ArchiveData.WGSL         = WGSL.c_str();
+    ArchiveData.EntryPoint   = Resources.GetEntryPoint();
+    ArchiveData.pResources   = !ArchivedResources.empty() ? ArchivedResources.data() : nullptr;
+    ArchiveData.NumResources = StaticCast<Uint32>(ArchivedResources.size());
+
+    SerializedData ShaderData;
+    {
+        Serializer<SerializerMode::Measure> Ser;
+        ShaderSerializerWebGPU<SerializerMode::Measure>::SerializeArchiveData(Ser, ArchiveData, nullptr);
+        ShaderData = Ser.AllocateData(GetRawAllocator());
+    }
+
+    {
+        Serializer<SerializerMode::Write> Ser{ShaderData};
+        ShaderSerializerWebGPU<SerializerMode::Write>::SerializeArchiveData(Ser, ArchiveData, nullptr);
+        VERIFY_EXPR(Ser.IsEnded());
+    }
+
+    return ShaderData;
+}
+
 struct CompiledShaderWebGPU final : SerializedShaderImpl::CompiledShader
 {
     ShaderWebGPUImpl ShaderWebGPU;
@@ -58,12 +102,27 @@ struct CompiledShaderWebGPU final : SerializedShaderImpl::CompiledShader
     {
         const std::string& WGSL = ShaderWebGPU.GetWGSL();
 
-        ShaderCI.Source         = WGSL.c_str();
-        ShaderCI.SourceLength   = WGSL.length();
         ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_WGSL;
         ShaderCI.FilePath       = nullptr;
         ShaderCI.Macros         = {};
-        ShaderCI.ByteCode       = nullptr;
+
+        SerializedData WGSLData;
+        if (const std::shared_ptr<const WGSLShaderResources>& pResources = ShaderWebGPU.GetShaderResources())
+        {
+            WGSLData = SerializeWGSLArchiveData(WGSL, *pResources);
+
+            ShaderCI.Source       = nullptr;
+            ShaderCI.SourceLength = 0;
+            ShaderCI.ByteCode     = WGSLData.Ptr();
+            ShaderCI.ByteCodeSize = WGSLData.Size();
+        }
+        else
+        {
+            // Shader was created without reflection
+            ShaderCI.Source       = WGSL.c_str();
+            ShaderCI.SourceLength = WGSL.length();
+            ShaderCI.ByteCode     = nullptr;
+        }
         return SerializedShaderImpl::SerializeCreateInfo(ShaderCI);
     }
 
@@ -197,16 +256,38 @@ void SerializedPipelineStateImpl::PatchShadersWebGPU(const CreateInfoType& Creat
     VERIFY_EXPR(m_Data.Shaders[static_cast<size_t>(DeviceType::WebGPU)].empty());
     for (size_t i = 0; i < ShaderStagesWebGPU.size(); ++i)
     {
-        const std::string& WGSL     = ShaderStagesWebGPU[i].GetWGSL();
-        ShaderCreateInfo   ShaderCI = ShaderStages[i].pSerialized->GetCreateInfo();
-
-        ShaderCI.Source         = WGSL.c_str();
-        ShaderCI.SourceLength   = WGSL.length();
+        const std::string&      WGSL     = ShaderStagesWebGPU[i].GetWGSL();
+        const ShaderWebGPUImpl* pShader  = ShaderStagesWebGPU[i].pShader;
+        ShaderCreateInfo        ShaderCI = ShaderStages[i].pSerialized->GetCreateInfo();
+
+        // Resource bindings in the patched WGSL differ from the original shader's reflection,
+        // so reflect the patched source here rather than when the archive is loaded.
+        SHADER_SOURCE_LANGUAGE SourceLanguage = ParseShaderSourceLanguageDefinition(WGSL);
+        if (SourceLanguage == SHADER_SOURCE_LANGUAGE_DEFAULT)
+            SourceLanguage = SHADER_SOURCE_LANGUAGE_WGSL;
+
+        const ShaderDesc&         ShDesc = pShader->GetDesc();
+        const WGSLShaderResources PatchedResources{
+            GetRawAllocator(),
+            WGSL,
+            SourceLanguage,
+            ShDesc.Name,
+            ShDesc.UseCombinedTextureSamplers ? ShDesc.CombinedSamplerSuffix : nullptr,
+            pShader->GetEntryPoint(),
+            pShader->GetEmulatedArrayIndexSuffix(),
+            false, // LoadUniformBufferReflection
+            nullptr,
+        };
+        const SerializedData WGSLData = SerializeWGSLArchiveData(WGSL, PatchedResources);
+
+        ShaderCI.Source         = nullptr;
+        ShaderCI.SourceLength   = 0;
         ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_WGSL;
-        ShaderCI.EntryPoint     = ShaderStagesWebGPU[i].pShader->GetEntryPoint();
+        ShaderCI.EntryPoint     = pShader->GetEntryPoint();
         ShaderCI.FilePath       = nullptr;
         ShaderCI.Macros         = {};
-        ShaderCI.ByteCode       = nullptr;
+        ShaderCI.ByteCode       = WGSLData.Ptr();
+        ShaderCI.ByteCodeSize   = WGSLData.Size();
         SerializeShaderCreateInfo(DeviceType::WebGPU, ShaderCI);
     }
 }
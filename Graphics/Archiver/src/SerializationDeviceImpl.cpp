@@ -32,6 +32,7 @@
 #include "SerializedResourceSignatureImpl.hpp"
 #include "SerializedPipelineStateImpl.hpp"
 #include "EngineMemory.h"
+#include "PSOSerializer.hpp"
 
 namespace Diligent
 {
@@ -146,6 +147,85 @@ SerializationDeviceImpl::SerializationDeviceImpl(IReferenceCounters* pRefCounter
     }
 
     InitShaderCompilationThreadPool(CreateInfo.pAsyncShaderCompilationThreadPool, CreateInfo.NumAsyncShaderCompilationThreads);
+
+    if (CreateInfo.pDonorArchive != nullptr)
+        InitDonorArchive(CreateInfo.pDonorArchive);
+}
+
+void SerializationDeviceImpl::InitDonorArchive(const IDataBlob* pArchive)
+{
+    try
+    {
+        DeviceObjectArchive::CreateInfo ArchiveCI;
+        ArchiveCI.pData = pArchive;
+        m_pDonorArchive = std::make_unique<DeviceObjectArchive>(ArchiveCI);
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to load the donor archive. All shaders will be compiled from scratch.");
+        return;
+    }
+
+    m_pDonorArchive->ProcessResources(
+        [this](DeviceObjectArchive::ResourceType Type, const char* Name, const DeviceObjectArchive::ResourceData& Data) {
+            if (Type != DeviceObjectArchive::ResourceType::StandaloneShader)
+                return;
+
+            // Archives produced before source digests were added have no common data for shaders
+            DeviceObjectDigest SourceDigest;
+            if (SerializedShaderImpl::ReadSourceDigest(Data.Common, SourceDigest))
+                m_DonorShaders.emplace(SourceDigest, Name);
+        });
+
+    if (m_DonorShaders.empty())
+        LOG_WARNING_MESSAGE("The donor archive contains no reusable shaders. Only shaders added with IArchiver::AddShader() can be reused.");
+}
+
+SerializedData SerializationDeviceImpl::GetDonorShader(DeviceObjectArchive::DeviceType Type,
+                                                       const DeviceObjectDigest&       SourceDigest,
+                                                       const char*                     Name,
+                                                       ShaderCreateInfo&               ShaderCI) const
+{
+    using DeviceType = DeviceObjectArchive::DeviceType;
+
+    if (!m_pDonorArchive)
+        return {};
+
+    // OpenGL shaders are archived as source that is processed again when the shader is created,
+    // and Metal shaders use a device-specific format, so they are always compiled from scratch.
+    if (Type != DeviceType::Direct3D11 && Type != DeviceType::Direct3D12 && Type != DeviceType::Vulkan && Type != DeviceType::WebGPU)
+        return {};
+
+    auto it = m_DonorShaders.find(SourceDigest);
+    if (it == m_DonorShaders.end())
+        return {};
+
+    const SerializedData ShaderIdxData = m_pDonorArchive->GetDeviceSpecificData(DeviceObjectArchive::ResourceType::StandaloneShader, it->second.c_str(), Type);
+    if (!ShaderIdxData)
+        return {}; // The shader was not archived for this device
+
+    Uint32 Idx = 0;
+    {
+        Serializer<SerializerMode::Read> Ser{ShaderIdxData};
+        if (!Ser(Idx))
+            return {};
+    }
+
+    SerializedData ShaderData = m_pDonorArchive->GetSerializedShader(Type, Idx);
+    if (!ShaderData)
+        return {};
+
+    {
+        Serializer<SerializerMode::Read> Ser{ShaderData};
+        if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(Ser, ShaderCI))
+        {
+            LOG_ERROR_MESSAGE("Failed to deserialize shader '", it->second, "' from the donor archive.");
+            return {};
+        }
+    }
+    ShaderCI.Desc.Name = Name;
+
+    return ShaderData;
 }
 
 SerializationDeviceImpl::~SerializationDeviceImpl()
@@ -288,15 +288,13 @@ void SerializedPipelineStateImpl::Initialize(const PSOCreateInfoType&        Cre
         };
 
         {
-            Serializer<SerializerMode::Measure> Ser;
-            SerializePsoCI(Ser);
-            m_Data.Common = Ser.AllocateData(GetRawAllocator());
-        }
+            // Serialize in a single pass: the create info may have many members and strings,
+            // so running the Measure pass first is more expensive than the final copy.
+            DynamicLinearAllocator ChunkAllocator{GetRawAllocator()};
 
-        {
-            Serializer<SerializerMode::Write> Ser{m_Data.Common};
+            Serializer<SerializerMode::WriteGrowable> Ser{ChunkAllocator};
             SerializePsoCI(Ser);
-            VERIFY_EXPR(Ser.IsEnded());
+            m_Data.Common = Ser.GetData(GetRawAllocator());
         }
     }
 
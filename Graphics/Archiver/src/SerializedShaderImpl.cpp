@@ -34,12 +34,47 @@
 #include "PlatformMisc.hpp"
 #include "BasicMath.hpp"
 #include "PSOSerializer.hpp"
+#include "ShaderToolsCommon.hpp"
 
 namespace Diligent
 {
 
+DeviceObjectArchive::DeviceType ArchiveDeviceDataFlagToArchiveDeviceType(ARCHIVE_DEVICE_DATA_FLAGS DataTypeFlag);
+
 const INTERFACE_ID SerializedShaderImpl::IID_InternalImpl;
 
+namespace
+{
+
+// Computes the digest of the shader create info with all includes expanded,
+// so that shaders loaded from files are identified by their contents.
+bool ComputeShaderSourceDigest(const ShaderCreateInfo& ShaderCI, DeviceObjectDigest& Digest)
+{
+    if (ShaderCI.FilePath == nullptr && ShaderCI.pShaderSourceStreamFactory == nullptr)
+        return ComputeDeviceObjectDigest(ShaderCI, Digest);
+
+    ShaderCreateInfo UnrolledCI = ShaderCI;
+
+    UnrolledCI.FilePath                   = nullptr;
+    UnrolledCI.pShaderSourceStreamFactory = nullptr;
+    if (ShaderCI.ByteCode != nullptr)
+        return ComputeDeviceObjectDigest(UnrolledCI, Digest);
+
+    try
+    {
+        const std::string Source = UnrollShaderIncludes(ShaderCI);
+        UnrolledCI.Source        = Source.c_str();
+        UnrolledCI.SourceLength  = Source.length();
+        return ComputeDeviceObjectDigest(UnrolledCI, Digest);
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+} // namespace
+
 SerializedShaderImpl::SerializedShaderImpl(IReferenceCounters*      pRefCounters,
                                            SerializationDeviceImpl* pDevice,
                                            const ShaderCreateInfo&  ShaderCI,
@@ -64,7 +99,8 @@ SerializedShaderImpl::SerializedShaderImpl(IReferenceCounters*      pRefCounters
         LOG_ERROR_AND_THROW("Serialized shader must not contain SHADER_COMPILE_FLAG_SKIP_REFLECTION flag");
     }
 
-    m_CreateInfo = ShaderCreateInfoWrapper{ShaderCI, GetRawAllocator()};
+    m_CreateInfo      = ShaderCreateInfoWrapper{ShaderCI, GetRawAllocator()};
+    m_HasSourceDigest = ComputeShaderSourceDigest(ShaderCI, m_SourceDigest);
 
     if ((DeviceFlags & ARCHIVE_DEVICE_DATA_FLAG_GL) != 0 && (DeviceFlags & ARCHIVE_DEVICE_DATA_FLAG_GLES) != 0)
     {
@@ -72,48 +108,68 @@ SerializedShaderImpl::SerializedShaderImpl(IReferenceCounters*      pRefCounters
         DeviceFlags &= ~ARCHIVE_DEVICE_DATA_FLAG_GLES;
     }
 
+    // When the shader targets multiple devices, compile all device-specific variants in parallel
+    // using the shader compilation thread pool, and wait for them at the end of the constructor.
+    // Compiler output can't be collected from concurrent compilations, so this is disabled when it is requested.
+    const bool CompileInParallel =
+        (ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) == 0 &&
+        ppCompilerOutput == nullptr &&
+        m_pDevice->GetShaderCompilationThreadPool() != nullptr &&
+        !IsPowerOfTwo(DeviceFlags);
+
+    ShaderCreateInfo DeviceShaderCI = ShaderCI;
+    if (CompileInParallel)
+        DeviceShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+
     while (DeviceFlags != ARCHIVE_DEVICE_DATA_FLAG_NONE)
     {
         const ARCHIVE_DEVICE_DATA_FLAGS Flag = ExtractLSB(DeviceFlags);
 
+        // If the donor archive contains the shader compiled from the same source, reuse its byte code
+        SerializedData   DonorShaderData;
+        ShaderCreateInfo DonorShaderCI;
+        if (m_HasSourceDigest)
+            DonorShaderData = m_pDevice->GetDonorShader(ArchiveDeviceDataFlagToArchiveDeviceType(Flag), m_SourceDigest, ShaderCI.Desc.Name, DonorShaderCI);
+        const ShaderCreateInfo& DevShaderCI = DonorShaderData ? DonorShaderCI : DeviceShaderCI;
+
         static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == 1 << 7, "Please update the switch below to handle the new device data type");
         switch (Flag)
         {
 #if D3D11_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
-                CreateShaderD3D11(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderD3D11(pRefCounters, DevShaderCI, ppCompilerOutput);
                 break;
 #endif
 
 #if D3D12_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
-                CreateShaderD3D12(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderD3D12(pRefCounters, DevShaderCI, ppCompilerOutput);
                 break;
 #endif
 
 #if GL_SUPPORTED || GLES_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_GL:
             case ARCHIVE_DEVICE_DATA_FLAG_GLES:
-                CreateShaderGL(pRefCounters, ShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_GL ? RENDER_DEVICE_TYPE_GL : RENDER_DEVICE_TYPE_GLES, ppCompilerOutput);
+                CreateShaderGL(pRefCounters, DevShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_GL ? RENDER_DEVICE_TYPE_GL : RENDER_DEVICE_TYPE_GLES, ppCompilerOutput);
                 break;
 #endif
 
 #if VULKAN_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
-                CreateShaderVk(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderVk(pRefCounters, DevShaderCI, ppCompilerOutput);
                 break;
 #endif
 
 #if METAL_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
             case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
-                CreateShaderMtl(pRefCounters, ShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS ? DeviceType::Metal_MacOS : DeviceType::Metal_iOS, ppCompilerOutput);
+                CreateShaderMtl(pRefCounters, DevShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS ? DeviceType::Metal_MacOS : DeviceType::Metal_iOS, ppCompilerOutput);
                 break;
 #endif
 
 #if WEBGPU_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_WEBGPU:
-                CreateShaderWebGPU(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderWebGPU(pRefCounters, DevShaderCI, ppCompilerOutput);
                 break;
 #endif
 
@@ -126,6 +182,11 @@ SerializedShaderImpl::SerializedShaderImpl(IReferenceCounters*      pRefCounters
                 break;
         }
     }
+
+    if (CompileInParallel && GetStatus(/*WaitForCompletion = */ true) == SHADER_STATUS_FAILED)
+    {
+        LOG_ERROR_AND_THROW("Failed to compile shader '", ShaderCI.Desc.Name, "' for one or more devices");
+    }
 }
 
 SerializedShaderImpl::~SerializedShaderImpl()
@@ -173,6 +234,35 @@ SerializedData SerializedShaderImpl::SerializeCreateInfo(const ShaderCreateInfo&
     return ShaderData;
 }
 
+SerializedData SerializedShaderImpl::GetCommonData() const
+{
+    if (!m_HasSourceDigest)
+        return {};
+
+    auto SerializeDigest = [this](auto& Ser) {
+        Ser(m_SourceDigest.LowPart, m_SourceDigest.HighPart);
+    };
+
+    Serializer<SerializerMode::Measure> MeasureSer;
+    SerializeDigest(MeasureSer);
+    SerializedData CommonData = MeasureSer.AllocateData(GetRawAllocator());
+
+    Serializer<SerializerMode::Write> Ser{CommonData};
+    SerializeDigest(Ser);
+    VERIFY_EXPR(Ser.IsEnded());
+
+    return CommonData;
+}
+
+bool SerializedShaderImpl::ReadSourceDigest(const SerializedData& CommonData, DeviceObjectDigest& SourceDigest)
+{
+    if (!CommonData)
+        return false;
+
+    Serializer<SerializerMode::Read> Ser{CommonData};
+    return Ser(SourceDigest.LowPart, SourceDigest.HighPart) && Ser.IsEnded();
+}
+
 SerializedData SerializedShaderImpl::GetDeviceData(DeviceType Type) const
 {
     DEV_CHECK_ERR(!IsCompiling(), "Device data is not available until compilation is complete. Use GetStatus() to check the shader status.");
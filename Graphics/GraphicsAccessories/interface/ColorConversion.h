@@ -93,6 +93,41 @@ inline float FastGammaToLinear(float x)
 }
 
 
+/// Converts an array of 8-bit gamma color values to linear color space
+
+/// \param [in]  pSrc  - Gamma color values in the range [0, 255].
+/// \param [out] pDst  - Linear color values in the range [0, 1].
+/// \param [in]  Count - The number of values to convert.
+///
+/// The conversion uses a lookup table and produces the same results as GammaToLinear(Uint8).
+void GammaToLinear(const Uint8* pSrc, float* pDst, size_t Count);
+
+
+/// Converts an array of linear color values to 8-bit gamma color space
+
+/// \param [in]  pSrc  - Linear color values. Values outside of the [0, 1] range are clamped.
+/// \param [out] pDst  - Gamma color values in the range [0, 255].
+/// \param [in]  Count - The number of values to convert.
+///
+/// The linear value is quantized to 12 bits and converted using a lookup table.
+/// The result differs from the correctly rounded LinearToGamma(x) * 255 by at most 1.
+void LinearToGamma(const float* pSrc, Uint8* pDst, size_t Count);
+
+
+/// Converts an array of gamma color values to linear color space using fast approximation
+
+/// The function uses SIMD instructions when available and produces the same
+/// results as FastGammaToLinear(float). \p pSrc and \p pDst may be equal.
+void FastGammaToLinear(const float* pSrc, float* pDst, size_t Count);
+
+
+/// Converts an array of linear color values to gamma color space using fast approximation
+
+/// The function uses SIMD instructions when available and produces the same
+/// results as FastLinearToGamma(float). \p pSrc and \p pDst may be equal.
+void FastLinearToGamma(const float* pSrc, float* pDst, size_t Count);
+
+
 /// Converts RGB color from linear to gamma color space
 
 /// \param RGB - Linear color value in the range [0, 1]
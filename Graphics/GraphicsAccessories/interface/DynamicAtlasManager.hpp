@@ -33,6 +33,7 @@
 
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 #include "../../../Primitives/interface/BasicTypes.h"
 #include "../../../Common/interface/HashUtils.hpp"
@@ -47,11 +48,31 @@ namespace Diligent
 /// Region structure, which contains the x and y coordinates of the top-left
 /// corner, as well as the width and height of the region.
 ///
+/// The manager supports two packing modes, see DynamicAtlasManager::PackingMode.
+///
 /// \warning The class is not thread-safe. All operations on the atlas must be
 ///          must be protected by a mutex or other synchronization mechanism.
 class DynamicAtlasManager
 {
 public:
+    /// Packing algorithm used by the atlas manager.
+    enum class PackingMode : Uint8
+    {
+        /// Free space is kept as a tree of rectangles that are split on allocation
+        /// and merged back when regions are freed. Allocations use the best-fit strategy.
+        Guillotine,
+
+        /// Regions are placed at the lowest position on top of the skyline - the upper
+        /// envelope of the allocated regions. Allocation time depends on the number of
+        /// skyline segments rather than on the number of regions, which makes this mode
+        /// well suited for append-heavy workloads such as glyphs and thumbnails.
+        ///
+        /// Freed regions that are not on the skyline are kept in a list of free rectangles
+        /// that are reused by subsequent allocations. The skyline is reset when the atlas
+        /// becomes empty.
+        Skyline
+    };
+
     /// Structure representing a rectangular region in the atlas.
     struct Region
     {
@@ -114,7 +135,7 @@ public:
         };
     };
 
-    DynamicAtlasManager(Uint32 Width, Uint32 Height);
+    DynamicAtlasManager(Uint32 Width, Uint32 Height, PackingMode Mode = PackingMode::Guillotine);
     ~DynamicAtlasManager();
 
     // clang-format off
@@ -135,6 +156,20 @@ public:
     Region Allocate(Uint32 Width, Uint32 Height);
 
 
+    /// Allocates multiple rectangular regions in the atlas.
+
+    /// \param [in, out] pRegions   - Array of regions. On input, the width and height of every
+    ///                               region specify the requested size. On output, the array
+    ///                               contains the allocated regions.
+    /// \param [in]      NumRegions - Number of regions in the array.
+    /// \return                       The number of regions that were allocated.
+    ///
+    /// The requests are processed in the order of decreasing height and width, which
+    /// improves the atlas occupancy compared to allocating the regions one by one in
+    /// arbitrary order. Regions that could not be allocated are set to empty regions.
+    Uint32 AllocateBatch(Region* pRegions, Uint32 NumRegions);
+
+
     /// Frees a previously allocated region in the atlas.
 
     /// \param R - The region to free.
@@ -142,12 +177,21 @@ public:
 
 
     /// Returns the number of free regions in the atlas.
+
+    /// In skyline mode, this is the number of free rectangles plus the number
+    /// of skyline segments that do not reach the top of the atlas.
     Uint32 GetFreeRegionCount() const
     {
+        if (m_Mode == PackingMode::Skyline)
+            return GetSkylineFreeRegionCount();
+
         VERIFY_EXPR(m_FreeRegionsByWidth.size() == m_FreeRegionsByHeight.size());
         return static_cast<Uint32>(m_FreeRegionsByWidth.size());
     }
 
+    /// Returns the packing mode.
+    PackingMode GetPackingMode() const { return m_Mode; }
+
     /// Returns the atlas width.
     Uint32 GetWidth() const { return m_Width; }
 
@@ -204,10 +248,22 @@ private:
     void DbgVerifyConsistency() const;
     struct Node;
     void DbgRecursiveVerifyConsistency(const Node& N, Uint32& Area) const;
+    void DbgVerifySkyline() const;
 #endif
 
-    const Uint32 m_Width;
-    const Uint32 m_Height;
+    Region AllocateSkyline(Uint32 Width, Uint32 Height);
+    void   FreeSkyline(Region&& R);
+    Region AllocateFromSkylineFreeRects(Uint32 Width, Uint32 Height);
+    bool   FitSkyline(size_t Segment, Uint32 Width, Uint32 Height, Uint32& y) const;
+    void   AddSkylineLevel(size_t Segment, const Region& R);
+    bool   LowerSkyline(const Region& R);
+    void   MergeSkyline();
+    void   ResetSkyline();
+    Uint32 GetSkylineFreeRegionCount() const;
+
+    const Uint32      m_Width;
+    const Uint32      m_Height;
+    const PackingMode m_Mode;
 
     Uint64 m_TotalFreeArea = 0;
 
@@ -258,7 +314,8 @@ private:
         Uint32                  NumChildren = 0;
         std::unique_ptr<Node[]> Children;
     };
-    std::unique_ptr<Node> m_Root{new Node};
+    // The root of the region tree (guillotine mode only)
+    std::unique_ptr<Node> m_Root;
 
     void RegisterNode(Node& N);
     void UnregisterNode(const Node& N);
@@ -267,8 +324,20 @@ private:
     std::map<Region, Node*, WidthFirstCompare> m_FreeRegionsByWidth;
     // Free regions ordered by height->width->y->x
     std::map<Region, Node*, HeightFirstCompare> m_FreeRegionsByHeight;
-    // Allocated regions
+    // Allocated regions. In skyline mode, node pointers are null.
     std::unordered_map<Region, Node*, Region::Hasher> m_AllocatedRegions;
+
+    // Horizontal segment of the skyline
+    struct SkylineSegment
+    {
+        Uint32 x     = 0;
+        Uint32 y     = 0;
+        Uint32 width = 0;
+    };
+    // Skyline segments ordered by x (skyline mode only)
+    std::vector<SkylineSegment> m_Skyline;
+    // Freed regions below the skyline (skyline mode only)
+    std::vector<Region> m_SkylineFreeRects;
 };
 
 } // namespace Diligent
@@ -170,12 +170,238 @@ inline Uint32 GetValueSize(VALUE_TYPE Val)
 /// Returns the string representing the specified value type
 const Char* GetValueTypeString(VALUE_TYPE Val);
 
+/// Texture format attributes indexed by TEXTURE_FORMAT, see GetTextureFormatAttribs().
+
+/// The table is a static member of a class template so that it can be defined in the header
+/// while having a single instance in the program.
+template <typename Dummy = void>
+struct TextureFormatAttribsTable
+{
+    static constexpr TextureFormatAttribs Attribs[] =
+    {
+        // clang-format off
+#define DILIGENT_TEX_FORMAT_ATTRIBS(TexFmt, ComponentSize, NumComponents, ComponentType, IsTypeless, BlockWidth, BlockHeight) \
+        TextureFormatAttribs{#TexFmt, TexFmt, ComponentSize, NumComponents, ComponentType, IsTypeless, BlockWidth, BlockHeight}
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_UNKNOWN,                 0, 0, COMPONENT_TYPE_UNDEFINED, false, 0,0),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA32_TYPELESS,         4, 4, COMPONENT_TYPE_UNDEFINED,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA32_FLOAT,            4, 4, COMPONENT_TYPE_FLOAT,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA32_UINT,             4, 4, COMPONENT_TYPE_UINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA32_SINT,             4, 4, COMPONENT_TYPE_SINT,      false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGB32_TYPELESS,          4, 3, COMPONENT_TYPE_UNDEFINED,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGB32_FLOAT,             4, 3, COMPONENT_TYPE_FLOAT,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGB32_UINT,              4, 3, COMPONENT_TYPE_UINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGB32_SINT,              4, 3, COMPONENT_TYPE_SINT,      false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA16_TYPELESS,         2, 4, COMPONENT_TYPE_UNDEFINED,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA16_FLOAT,            2, 4, COMPONENT_TYPE_FLOAT,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA16_UNORM,            2, 4, COMPONENT_TYPE_UNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA16_UINT,             2, 4, COMPONENT_TYPE_UINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA16_SNORM,            2, 4, COMPONENT_TYPE_SNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA16_SINT,             2, 4, COMPONENT_TYPE_SINT,      false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG32_TYPELESS,           4, 2, COMPONENT_TYPE_UNDEFINED,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG32_FLOAT,              4, 2, COMPONENT_TYPE_FLOAT,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG32_UINT,               4, 2, COMPONENT_TYPE_UINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG32_SINT,               4, 2, COMPONENT_TYPE_SINT,      false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R32G8X24_TYPELESS,       4, 2, COMPONENT_TYPE_DEPTH_STENCIL,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_D32_FLOAT_S8X24_UINT,    4, 2, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R32_FLOAT_X8X24_TYPELESS,4, 2, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_X32_TYPELESS_G8X24_UINT, 4, 2, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGB10A2_TYPELESS,        4, 1, COMPONENT_TYPE_COMPOUND,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGB10A2_UNORM,           4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGB10A2_UINT,            4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R11G11B10_FLOAT,         4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA8_TYPELESS,          1, 4, COMPONENT_TYPE_UNDEFINED,   true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA8_UNORM,             1, 4, COMPONENT_TYPE_UNORM,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA8_UNORM_SRGB,        1, 4, COMPONENT_TYPE_UNORM_SRGB, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA8_UINT,              1, 4, COMPONENT_TYPE_UINT,       false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA8_SNORM,             1, 4, COMPONENT_TYPE_SNORM,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGBA8_SINT,              1, 4, COMPONENT_TYPE_SINT,       false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG16_TYPELESS,           2, 2, COMPONENT_TYPE_UNDEFINED,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG16_FLOAT,              2, 2, COMPONENT_TYPE_FLOAT,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG16_UNORM,              2, 2, COMPONENT_TYPE_UNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG16_UINT,               2, 2, COMPONENT_TYPE_UINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG16_SNORM,              2, 2, COMPONENT_TYPE_SNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG16_SINT,               2, 2, COMPONENT_TYPE_SINT,      false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R32_TYPELESS,            4, 1, COMPONENT_TYPE_UNDEFINED,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_D32_FLOAT,               4, 1, COMPONENT_TYPE_DEPTH,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R32_FLOAT,               4, 1, COMPONENT_TYPE_FLOAT,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R32_UINT,                4, 1, COMPONENT_TYPE_UINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R32_SINT,                4, 1, COMPONENT_TYPE_SINT,      false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R24G8_TYPELESS,          4, 1, COMPONENT_TYPE_DEPTH_STENCIL,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_D24_UNORM_S8_UINT,       4, 1, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R24_UNORM_X8_TYPELESS,   4, 1, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_X24_TYPELESS_G8_UINT,    4, 1, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG8_TYPELESS,            1, 2, COMPONENT_TYPE_UNDEFINED,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG8_UNORM,               1, 2, COMPONENT_TYPE_UNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG8_UINT,                1, 2, COMPONENT_TYPE_UINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG8_SNORM,               1, 2, COMPONENT_TYPE_SNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG8_SINT,                1, 2, COMPONENT_TYPE_SINT,      false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R16_TYPELESS,            2, 1, COMPONENT_TYPE_UNDEFINED,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R16_FLOAT,               2, 1, COMPONENT_TYPE_FLOAT,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_D16_UNORM,               2, 1, COMPONENT_TYPE_DEPTH,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R16_UNORM,               2, 1, COMPONENT_TYPE_UNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R16_UINT,                2, 1, COMPONENT_TYPE_UINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R16_SNORM,               2, 1, COMPONENT_TYPE_SNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R16_SINT,                2, 1, COMPONENT_TYPE_SINT,      false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R8_TYPELESS,             1, 1, COMPONENT_TYPE_UNDEFINED,  true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R8_UNORM,                1, 1, COMPONENT_TYPE_UNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R8_UINT,                 1, 1, COMPONENT_TYPE_UINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R8_SNORM,                1, 1, COMPONENT_TYPE_SNORM,     false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R8_SINT,                 1, 1, COMPONENT_TYPE_SINT,      false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_A8_UNORM,                1, 1, COMPONENT_TYPE_UNORM,     false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R1_UNORM,                1, 1, COMPONENT_TYPE_UNORM,    false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RGB9E5_SHAREDEXP,        4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_RG8_B8G8_UNORM,          1, 4, COMPONENT_TYPE_UNORM,    false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_G8R8_G8B8_UNORM,         1, 4, COMPONENT_TYPE_UNORM,    false, 1,1),
+
+        // http://www.g-truc.net/post-0335.html
+        // http://renderingpipeline.com/2012/07/texture-compression/
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC1_TYPELESS,            8,  3, COMPONENT_TYPE_COMPRESSED,  true, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC1_UNORM,               8,  3, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC1_UNORM_SRGB,          8,  3, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC2_TYPELESS,            16, 4, COMPONENT_TYPE_COMPRESSED,  true, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC2_UNORM,               16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC2_UNORM_SRGB,          16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC3_TYPELESS,            16, 4, COMPONENT_TYPE_COMPRESSED,  true, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC3_UNORM,               16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC3_UNORM_SRGB,          16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC4_TYPELESS,            8,  1, COMPONENT_TYPE_COMPRESSED,  true, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC4_UNORM,               8,  1, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC4_SNORM,               8,  1, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC5_TYPELESS,            16, 2, COMPONENT_TYPE_COMPRESSED,  true, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC5_UNORM,               16, 2, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC5_SNORM,               16, 2, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_B5G6R5_UNORM,            2, 1, COMPONENT_TYPE_COMPOUND, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_B5G5R5A1_UNORM,          2, 1, COMPONENT_TYPE_COMPOUND, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BGRA8_UNORM,             1, 4, COMPONENT_TYPE_UNORM,    false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BGRX8_UNORM,             1, 4, COMPONENT_TYPE_UNORM,    false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_R10G10B10_XR_BIAS_A2_UNORM,  4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BGRA8_TYPELESS,          1, 4, COMPONENT_TYPE_UNDEFINED,     true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BGRA8_UNORM_SRGB,        1, 4, COMPONENT_TYPE_UNORM_SRGB,   false, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BGRX8_TYPELESS,          1, 4, COMPONENT_TYPE_UNDEFINED,     true, 1,1),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BGRX8_UNORM_SRGB,        1, 4, COMPONENT_TYPE_UNORM_SRGB,   false, 1,1),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC6H_TYPELESS,           16, 3, COMPONENT_TYPE_COMPRESSED,  true, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC6H_UF16,               16, 3, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC6H_SF16,               16, 3, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC7_TYPELESS,            16, 4, COMPONENT_TYPE_COMPRESSED,  true, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC7_UNORM,               16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_BC7_UNORM_SRGB,          16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_ETC2_RGB8_UNORM,         8,  3, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_ETC2_RGB8_UNORM_SRGB,    8,  3, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_ETC2_RGB8A1_UNORM,       8,  4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_ETC2_RGB8A1_UNORM_SRGB,  8,  4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_ETC2_RGBA8_UNORM,        16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+        DILIGENT_TEX_FORMAT_ATTRIBS(TEX_FORMAT_ETC2_RGBA8_UNORM_SRGB,   16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4),
+#undef DILIGENT_TEX_FORMAT_ATTRIBS
+        // clang-format on
+    };
+};
+
+template <typename Dummy>
+constexpr TextureFormatAttribs TextureFormatAttribsTable<Dummy>::Attribs[];
+
+static_assert(_countof(TextureFormatAttribsTable<>::Attribs) == TEX_FORMAT_NUM_FORMATS, "Not all texture formats initialized.");
+
+/// Returns true if every element of a table indexed by texture format has its Format member
+/// equal to its index. Used to validate compile-time format tables.
+template <typename ElementType, size_t NumElements>
+constexpr bool IsTextureFormatTableOrdered(const ElementType (&Table)[NumElements], size_t Idx = 0)
+{
+    return Idx == NumElements || (Table[Idx].Format == static_cast<TEXTURE_FORMAT>(Idx) && IsTextureFormatTableOrdered(Table, Idx + 1));
+}
+static_assert(IsTextureFormatTableOrdered(TextureFormatAttribsTable<>::Attribs), "Texture format attributes table is not in the TEXTURE_FORMAT order");
+
 /// Returns invariant texture format attributes, see TextureFormatAttribs for details.
 
 /// \param [in] Format - Texture format which attributes are requested for.
 /// \return Constant reference to the TextureFormatAttribs structure containing
 ///         format attributes.
-const TextureFormatAttribs& GetTextureFormatAttribs(TEXTURE_FORMAT Format);
+inline const TextureFormatAttribs& GetTextureFormatAttribs(TEXTURE_FORMAT Format)
+{
+    if (Format >= TEX_FORMAT_UNKNOWN && Format < TEX_FORMAT_NUM_FORMATS)
+        return TextureFormatAttribsTable<>::Attribs[Format];
+
+    UNEXPECTED("Texture format (", int{Format}, ") is out of allowed range [0, ", int{TEX_FORMAT_NUM_FORMATS} - 1, "]");
+    return TextureFormatAttribsTable<>::Attribs[TEX_FORMAT_UNKNOWN];
+}
+
+/// Returns the texel size of a non-compressed format, or the compressed block size of
+/// a block-compressed format, in bytes. Can be evaluated at compile time.
+constexpr Uint32 GetTextureFormatElementSize(TEXTURE_FORMAT Format)
+{
+    return Format < TEX_FORMAT_NUM_FORMATS ?
+        Uint32{TextureFormatAttribsTable<>::Attribs[Format].ComponentSize} *
+            (TextureFormatAttribsTable<>::Attribs[Format].ComponentType != COMPONENT_TYPE_COMPRESSED ? Uint32{TextureFormatAttribsTable<>::Attribs[Format].NumComponents} : 1u) :
+        0;
+}
+
+/// Returns the number of components of the texture format. Can be evaluated at compile time.
+constexpr Uint32 GetTextureFormatComponentCount(TEXTURE_FORMAT Format)
+{
+    return Format < TEX_FORMAT_NUM_FORMATS ? TextureFormatAttribsTable<>::Attribs[Format].NumComponents : 0;
+}
+
+/// Returns the compression block width of the texture format, or 1 for non-compressed formats.
+/// Can be evaluated at compile time.
+constexpr Uint32 GetTextureFormatBlockWidth(TEXTURE_FORMAT Format)
+{
+    return Format < TEX_FORMAT_NUM_FORMATS ? TextureFormatAttribsTable<>::Attribs[Format].BlockWidth : 0;
+}
+
+/// Returns the compression block height of the texture format, or 1 for non-compressed formats.
+/// Can be evaluated at compile time.
+constexpr Uint32 GetTextureFormatBlockHeight(TEXTURE_FORMAT Format)
+{
+    return Format < TEX_FORMAT_NUM_FORMATS ? TextureFormatAttribsTable<>::Attribs[Format].BlockHeight : 0;
+}
+
+/// Returns the texture bind flags that are compatible with the texture format.
+
+/// Compressed formats may only be used as shader resources, depth formats may not be used as
+/// render targets or unordered access views, and color formats may not be used as depth-stencil
+/// buffers unless they are typeless formats that have a depth view format. The function does
+/// not account for device capabilities, which must be queried through IRenderDevice::GetTextureFormatInfoExt().
+/// Can be evaluated at compile time.
+constexpr BIND_FLAGS GetTextureFormatCompatibleBindFlags(TEXTURE_FORMAT Format)
+{
+    // clang-format off
+    return (Format == TEX_FORMAT_UNKNOWN || Format >= TEX_FORMAT_NUM_FORMATS) ?
+            BIND_NONE :
+        TextureFormatAttribsTable<>::Attribs[Format].ComponentType == COMPONENT_TYPE_COMPRESSED ?
+            BIND_SHADER_RESOURCE :
+        TextureFormatAttribsTable<>::Attribs[Format].IsDepthStencil() ?
+            BIND_SHADER_RESOURCE | BIND_DEPTH_STENCIL | BIND_INPUT_ATTACHMENT :
+        BIND_SHADER_RESOURCE | BIND_RENDER_TARGET | BIND_UNORDERED_ACCESS | BIND_INPUT_ATTACHMENT |
+            ((Format == TEX_FORMAT_R16_TYPELESS || Format == TEX_FORMAT_R32_TYPELESS) ? BIND_DEPTH_STENCIL : BIND_NONE) |
+            ((Format == TEX_FORMAT_R8_TYPELESS  || Format == TEX_FORMAT_R8_UINT ||
+              Format == TEX_FORMAT_RG8_TYPELESS || Format == TEX_FORMAT_RG8_UNORM) ? BIND_SHADING_RATE : BIND_NONE);
+    // clang-format on
+}
+
+/// Returns true if all bind flags in BindFlags are compatible with the texture format,
+/// see GetTextureFormatCompatibleBindFlags(). Can be evaluated at compile time.
+constexpr bool IsTextureFormatCompatibleWithBindFlags(TEXTURE_FORMAT Format, BIND_FLAGS BindFlags)
+{
+    return (BindFlags & ~GetTextureFormatCompatibleBindFlags(Format)) == 0;
+}
 
 /// Converts value type to component type.
 
@@ -798,6 +1024,58 @@ void CopyTextureSubresource(const TextureSubResData& SrcSubres,
                             Uint64                   DstDepthStride);
 
 
+/// Attributes of the ConvertTextureSubresource function.
+struct ConvertTextureSubresourceAttribs
+{
+    /// Source subresource data. The data must be in CPU memory.
+    TextureSubResData SrcSubres;
+
+    /// The number of 8-bit components in the source texel, from 1 to 4.
+    Uint32 SrcComponentCount = 4;
+
+    /// The width of the region to copy, in texels.
+    Uint32 Width = 0;
+
+    /// The number of rows to copy.
+    Uint32 NumRows = 0;
+
+    /// The number of depth slices to copy.
+    Uint32 NumDepthSlices = 1;
+
+    /// Pointer to the destination subresource data.
+    void* pDstData = nullptr;
+
+    /// Destination row stride, in bytes.
+    Uint64 DstRowStride = 0;
+
+    /// Destination depth stride, in bytes.
+    Uint64 DstDepthStride = 0;
+
+    /// The number of 8-bit components in the destination texel, from 1 to 4.
+    Uint32 DstComponentCount = 4;
+
+    /// Defines the source of every destination component.
+    ///
+    /// The identity swizzle of the component `c` selects the source component `c`.
+    /// Components that are missing in the source texel read as 0 for R, G and B, and
+    /// as 255 for A. For example, RGB8 -> RGBA8 expansion uses the identity mapping,
+    /// while RGBA8 <-> BGRA8 conversion uses `{B, G, R, A}`.
+    TextureComponentMapping Swizzle;
+
+    /// An optional thread pool to process the rows in parallel.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Copies texture subresource data on the CPU converting the texel layout.
+
+/// The function handles component count changes (e.g. RGB8 -> RGBA8) and component
+/// swizzles (e.g. RGBA8 -> BGRA8) of textures with 8-bit components. Rows are converted
+/// with SSSE3 or NEON shuffles when available and are distributed between the thread pool
+/// workers if the pool is provided. When no conversion is required, the function is
+/// equivalent to CopyTextureSubresource().
+void ConvertTextureSubresource(const ConvertTextureSubresourceAttribs& Attribs);
+
+
 inline String GetShaderResourcePrintName(const char* Name, Uint32 ArraySize, Uint32 ArrayIndex)
 {
     VERIFY(ArrayIndex < ArraySize, "Array index is out of range");
@@ -35,7 +35,10 @@
 
 #include <mutex>
 #include <deque>
+#include <vector>
 #include <atomic>
+#include <new>
+#include <utility>
 
 #include "../../../Primitives/interface/MemoryAllocator.h"
 #include "../../../Common/interface/STDAllocator.hpp"
@@ -220,6 +223,11 @@ private:
 ///   the command list
 /// * Resources are removed and actually destroyed from the queue when fence is signaled and the queue is purged
 ///
+/// SafeReleaseResource() and DiscardResource() may be called from any thread and never block: the
+/// resources are pushed into lock-free intrusive lists that are drained into the stale objects queue
+/// and the release queue by DiscardStaleResources(), Purge() and ExtractCompletedResources(), which
+/// are called by the thread that submits the command lists.
+///
 /// \tparam ResourceWrapperType -  Type of the resource wrapper used by the release queue.
 template <typename ResourceWrapperType>
 class ResourceReleaseQueue
@@ -227,6 +235,7 @@ class ResourceReleaseQueue
 public:
     // clang-format off
     ResourceReleaseQueue(IMemoryAllocator& Allocator) :
+        m_Allocator     {Allocator},
         m_ReleaseQueue  (STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>")),
         m_StaleResources(STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>"))
     {}
@@ -234,6 +243,8 @@ public:
 
     ~ResourceReleaseQueue()
     {
+        DrainPendingResources(m_PendingStaleResources, m_NumPendingStaleResources, m_StaleResources);
+        DrainPendingResources(m_PendingDiscardedResources, m_NumPendingDiscardedResources, m_ReleaseQueue);
         DEV_CHECK_ERR(m_StaleResources.empty(), "Not all stale objects were destroyed");
         DEV_CHECK_ERR(m_ReleaseQueue.empty(), "Release queue is not empty");
     }
@@ -264,8 +275,7 @@ public:
     /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
     void SafeReleaseResource(ResourceWrapperType&& Wrapper, Uint64 NextCommandListNumber)
     {
-        std::lock_guard<std::mutex> LockGuard(m_StaleObjectsMutex);
-        m_StaleResources.emplace_back(NextCommandListNumber, std::move(Wrapper));
+        PushPendingResource(m_PendingStaleResources, m_NumPendingStaleResources, NextCommandListNumber, std::move(Wrapper));
     }
 
     /// Moves a copy of the resource wrapper to the stale resources queue
@@ -274,8 +284,7 @@ public:
     /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
     void SafeReleaseResource(const ResourceWrapperType& Wrapper, Uint64 NextCommandListNumber)
     {
-        std::lock_guard<std::mutex> LockGuard(m_StaleObjectsMutex);
-        m_StaleResources.emplace_back(NextCommandListNumber, Wrapper);
+        PushPendingResource(m_PendingStaleResources, m_NumPendingStaleResources, NextCommandListNumber, Wrapper);
     }
 
     /// Adds a resource directly to the release queue
@@ -294,8 +303,7 @@ public:
     /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
     void DiscardResource(ResourceWrapperType&& Wrapper, Uint64 FenceValue)
     {
-        std::lock_guard<std::mutex> ReleaseQueueLock(m_ReleaseQueueMutex);
-        m_ReleaseQueue.emplace_back(FenceValue, std::move(Wrapper));
+        PushPendingResource(m_PendingDiscardedResources, m_NumPendingDiscardedResources, FenceValue, std::move(Wrapper));
     }
 
     /// Adds a copy of the resource wrapper directly to the release queue
@@ -304,8 +312,7 @@ public:
     /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
     void DiscardResource(const ResourceWrapperType& Wrapper, Uint64 FenceValue)
     {
-        std::lock_guard<std::mutex> ReleaseQueueLock(m_ReleaseQueueMutex);
-        m_ReleaseQueue.emplace_back(FenceValue, Wrapper);
+        PushPendingResource(m_PendingDiscardedResources, m_NumPendingDiscardedResources, FenceValue, Wrapper);
     }
 
     /// Adds multiple resources directly to the release queue
@@ -316,7 +323,9 @@ public:
     void DiscardResources(Uint64 FenceValue, IteratorType Iterator)
     {
         std::lock_guard<std::mutex> ReleaseQueueLock(m_ReleaseQueueMutex);
-        ResourceType                Resource;
+        DrainPendingResources(m_PendingDiscardedResources, m_NumPendingDiscardedResources, m_ReleaseQueue);
+
+        ResourceType Resource;
         while (Iterator(Resource))
         {
             m_ReleaseQueue.emplace_back(FenceValue, CreateWrapper(std::move(Resource), 1));
@@ -337,6 +346,10 @@ public:
         // was executed
         std::lock_guard<std::mutex> StaleObjectsLock(m_StaleObjectsMutex);
         std::lock_guard<std::mutex> ReleaseQueueLock(m_ReleaseQueueMutex);
+        DrainPendingResources(m_PendingStaleResources, m_NumPendingStaleResources, m_StaleResources);
+        // Resources discarded directly were used by the command lists submitted earlier,
+        // so they must precede the stale resources moved to the release queue.
+        DrainPendingResources(m_PendingDiscardedResources, m_NumPendingDiscardedResources, m_ReleaseQueue);
         while (!m_StaleResources.empty())
         {
             ReleaseQueueElemType& FirstStaleObj = m_StaleResources.front();
@@ -351,45 +364,158 @@ public:
     }
 
 
-    /// Removes all objects from the release queue whose fence value is
+    /// Removes objects from the release queue whose fence value is
     /// less than or equal to CompletedFenceValue
 
     /// \param [in] CompletedFenceValue  -  Value of the fence that has been completed by the GPU
-    void Purge(Uint64 CompletedFenceValue)
+    /// \param [in] MaxCount             -  Maximum number of objects to release.
+    ///
+    /// \return    The number of released objects.
+    size_t Purge(Uint64 CompletedFenceValue, size_t MaxCount = ~size_t{0})
     {
         std::lock_guard<std::mutex> LockGuard(m_ReleaseQueueMutex);
+        DrainPendingResources(m_PendingDiscardedResources, m_NumPendingDiscardedResources, m_ReleaseQueue);
 
         // Release all objects whose associated fence value is at most CompletedFenceValue
         // See http://diligentgraphics.com/diligent-engine/architecture/d3d12/managing-resource-lifetimes/
-        while (!m_ReleaseQueue.empty())
+        size_t NumReleased = 0;
+        while (!m_ReleaseQueue.empty() && NumReleased < MaxCount)
         {
             ReleaseQueueElemType& FirstObj = m_ReleaseQueue.front();
             if (FirstObj.first <= CompletedFenceValue)
+            {
                 m_ReleaseQueue.pop_front();
+                ++NumReleased;
+            }
             else
                 break;
         }
+        return NumReleased;
+    }
+
+    /// Moves objects whose fence value is less than or equal to CompletedFenceValue
+    /// from the release queue to the Resources vector
+
+    /// \param [in]  CompletedFenceValue - Value of the fence that has been completed by the GPU
+    /// \param [out] Resources           - Vector the resources are appended to. The resources
+    ///                                    are destroyed when the vector elements are destroyed,
+    ///                                    which may happen on any thread.
+    /// \param [in]  MaxCount            - Maximum number of objects to move.
+    ///
+    /// \return    The number of moved objects.
+    ///
+    /// \remarks   Unlike Purge(), this method does not destroy the resources while holding
+    ///            the release queue lock.
+    template <typename AllocatorType>
+    size_t ExtractCompletedResources(Uint64 CompletedFenceValue, std::vector<ResourceWrapperType, AllocatorType>& Resources, size_t MaxCount = ~size_t{0})
+    {
+        std::lock_guard<std::mutex> LockGuard(m_ReleaseQueueMutex);
+        DrainPendingResources(m_PendingDiscardedResources, m_NumPendingDiscardedResources, m_ReleaseQueue);
+
+        size_t NumExtracted = 0;
+        while (!m_ReleaseQueue.empty() && NumExtracted < MaxCount)
+        {
+            ReleaseQueueElemType& FirstObj = m_ReleaseQueue.front();
+            if (FirstObj.first <= CompletedFenceValue)
+            {
+                Resources.emplace_back(std::move(FirstObj.second));
+                m_ReleaseQueue.pop_front();
+                ++NumExtracted;
+            }
+            else
+                break;
+        }
+        return NumExtracted;
     }
 
     /// Returns the number of stale resources
     size_t GetStaleResourceCount() const
     {
-        return m_StaleResources.size();
+        return m_StaleResources.size() + m_NumPendingStaleResources.load(std::memory_order_relaxed);
     }
 
     /// Returns the number of resources pending release
     size_t GetPendingReleaseResourceCount() const
     {
-        return m_ReleaseQueue.size();
+        return m_ReleaseQueue.size() + m_NumPendingDiscardedResources.load(std::memory_order_relaxed);
     }
 
 private:
+    // Node of the intrusive multi-producer single-consumer list
+    struct PendingResource
+    {
+        template <typename WrapperArgType>
+        PendingResource(Uint64 _Value, WrapperArgType&& _Wrapper) :
+            Value{_Value},
+            Wrapper{std::forward<WrapperArgType>(_Wrapper)}
+        {}
+
+        const Uint64        Value;
+        ResourceWrapperType Wrapper;
+        PendingResource*    pNext = nullptr;
+    };
+
+    template <typename WrapperArgType>
+    void PushPendingResource(std::atomic<PendingResource*>& Head, std::atomic<size_t>& Count, Uint64 Value, WrapperArgType&& Wrapper)
+    {
+        void* pRawMem = m_Allocator.Allocate(sizeof(PendingResource), "Pending release queue resource", __FILE__, __LINE__);
+
+        PendingResource* pNode = new (pRawMem) PendingResource{Value, std::forward<WrapperArgType>(Wrapper)};
+        // Increment the counter first so that the resource is never missing from the counts
+        Count.fetch_add(1, std::memory_order_relaxed);
+
+        pNode->pNext = Head.load(std::memory_order_relaxed);
+        while (!Head.compare_exchange_weak(pNode->pNext, pNode, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // Moves all pending resources to the queue. The queue's mutex must be locked by the caller.
+    template <typename QueueType>
+    void DrainPendingResources(std::atomic<PendingResource*>& Head, std::atomic<size_t>& Count, QueueType& Queue)
+    {
+        PendingResource* pNode = Head.exchange(nullptr, std::memory_order_acquire);
+        if (pNode == nullptr)
+            return;
+
+        // The list is in the reverse order of pushes
+        PendingResource* pFirst = nullptr;
+        while (pNode != nullptr)
+        {
+            PendingResource* pNext = pNode->pNext;
+            pNode->pNext           = pFirst;
+            pFirst                 = pNode;
+            pNode                  = pNext;
+        }
+
+        size_t NumDrained = 0;
+        while (pFirst != nullptr)
+        {
+            PendingResource* pNext = pFirst->pNext;
+            Queue.emplace_back(pFirst->Value, std::move(pFirst->Wrapper));
+            pFirst->~PendingResource();
+            m_Allocator.Free(pFirst);
+            pFirst = pNext;
+            ++NumDrained;
+        }
+        Count.fetch_sub(NumDrained, std::memory_order_relaxed);
+    }
+
+    IMemoryAllocator& m_Allocator;
+
     std::mutex m_ReleaseQueueMutex;
     using ReleaseQueueElemType = std::pair<Uint64, ResourceWrapperType>;
     std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_ReleaseQueue;
 
     std::mutex                                                                 m_StaleObjectsMutex;
     std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_StaleResources;
+
+    // Resources released by SafeReleaseResource() and DiscardResource() that have not yet
+    // been moved to m_StaleResources and m_ReleaseQueue, respectively
+    std::atomic<PendingResource*> m_PendingStaleResources{nullptr};
+    std::atomic<PendingResource*> m_PendingDiscardedResources{nullptr};
+    std::atomic<size_t>           m_NumPendingStaleResources{0};
+    std::atomic<size_t>           m_NumPendingDiscardedResources{0};
 };
 
 } // namespace Diligent
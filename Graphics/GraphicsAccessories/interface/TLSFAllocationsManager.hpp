@@ -0,0 +1,653 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+// Helper class that handles free memory block management using the two-level segregated fit algorithm
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "../../../Primitives/interface/MemoryAllocator.h"
+#include "../../../Platforms/interface/PlatformMisc.hpp"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../../Common/interface/Align.hpp"
+#include "../../../Common/interface/STDAllocator.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+
+namespace Diligent
+{
+
+// The class is a drop-in replacement for VariableSizeAllocationsManager that implements the two-level
+// segregated fit (TLSF) algorithm. Like VariableSizeAllocationsManager, it keeps track of free blocks only
+// and does not record allocation sizes.
+//
+// Free blocks are distributed between bins. The first level splits the sizes into power-of-two ranges,
+// and the second level splits every range into SLIndexCount equal sub-ranges:
+//
+//   FL        |            [64, 128)           |             [128, 256)             |
+//   SL        | 64 | 68 | 72 |  ...  | 120 | 124 | 128 | 136 | 144 |  ...  | 240 | 248 |
+//
+// Every bin keeps a doubly-linked list of free blocks. A bit in the first-level bitmap and in the
+// second-level bitmap of that level is set when the bin is not empty, so that the bin whose blocks are
+// all large enough to satisfy a request is found with two bit scans. Neighbors of the block being
+// released are found through two open-addressing hash tables that map start and end offsets of the
+// free blocks to block descriptors. As a result, Allocate() and Free() take constant time.
+// Block descriptors are kept in a pool that only grows, so there are no heap allocations per block.
+//
+// Unlike VariableSizeAllocationsManager, which uses the best-fit strategy, the class uses the good-fit
+// strategy: the block that is selected for allocation may be larger than the smallest suitable block.
+class TLSFAllocationsManager
+{
+public:
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using Allocation = VariableSizeAllocationsManager::Allocation;
+    using CreateInfo = VariableSizeAllocationsManager::CreateInfo;
+
+    static constexpr Uint32 SLIndexCountLog2 = 4;
+    static constexpr Uint32 SLIndexCount     = 1u << SLIndexCountLog2;
+    static constexpr Uint32 FLIndexCount     = sizeof(OffsetType) * 8 - SLIndexCountLog2 + 1;
+
+private:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    struct FreeBlock
+    {
+        OffsetType Offset = 0;
+        OffsetType Size   = 0;
+
+        // Links in the bin list
+        Uint32 PrevFree = InvalidIndex;
+        // Link in the bin list or in the list of unused descriptors
+        Uint32 NextFree = InvalidIndex;
+    };
+
+    // Open-addressing hash table with linear probing that maps block offsets to block indices
+    class OffsetToBlockMap
+    {
+    public:
+        OffsetToBlockMap(IMemoryAllocator& Allocator, const char* Description) :
+            m_Slots{STD_ALLOCATOR_RAW_MEM(Slot, Allocator, Description)}
+        {}
+
+        Uint32 Find(OffsetType Key) const
+        {
+            if (m_Slots.empty())
+                return InvalidIndex;
+
+            const size_t Mask = m_Slots.size() - 1;
+            for (size_t Idx = GetHomeSlot(Key);; Idx = (Idx + 1) & Mask)
+            {
+                const Slot& S = m_Slots[Idx];
+                if (S.Key == Key)
+                    return S.Value;
+                if (S.Key == EmptyKey)
+                    return InvalidIndex;
+            }
+        }
+
+        void Insert(OffsetType Key, Uint32 Value)
+        {
+            VERIFY_EXPR(Key != EmptyKey);
+            if ((m_Count + 1) * 2 > m_Slots.size())
+                Grow();
+
+            const size_t Mask = m_Slots.size() - 1;
+
+            size_t Idx = GetHomeSlot(Key);
+            while (m_Slots[Idx].Key != EmptyKey)
+            {
+                VERIFY(m_Slots[Idx].Key != Key, "Key ", Key, " is already in the table");
+                Idx = (Idx + 1) & Mask;
+            }
+            m_Slots[Idx] = {Key, Value};
+            ++m_Count;
+        }
+
+        void Erase(OffsetType Key)
+        {
+            VERIFY_EXPR(!m_Slots.empty());
+            const size_t Mask = m_Slots.size() - 1;
+
+            size_t Idx = GetHomeSlot(Key);
+            while (m_Slots[Idx].Key != Key)
+            {
+                VERIFY(m_Slots[Idx].Key != EmptyKey, "Key ", Key, " is not found in the table");
+                Idx = (Idx + 1) & Mask;
+            }
+
+            // Shift back the following elements of the probe sequence to keep lookups correct without tombstones
+            for (size_t Next = (Idx + 1) & Mask; m_Slots[Next].Key != EmptyKey; Next = (Next + 1) & Mask)
+            {
+                const size_t Home = GetHomeSlot(m_Slots[Next].Key);
+                // The element can be moved to the hole if its home slot does not lie cyclically in (Idx, Next]
+                const bool CanMove = (Idx <= Next) ?
+                    (Home <= Idx || Home > Next) :
+                    (Home <= Idx && Home > Next);
+                if (CanMove)
+                {
+                    m_Slots[Idx] = m_Slots[Next];
+                    Idx          = Next;
+                }
+            }
+            m_Slots[Idx] = Slot{};
+            --m_Count;
+        }
+
+        size_t GetSize() const
+        {
+            return m_Count;
+        }
+
+    private:
+        static constexpr OffsetType EmptyKey = Allocation::InvalidOffset;
+
+        struct Slot
+        {
+            OffsetType Key   = EmptyKey;
+            Uint32     Value = InvalidIndex;
+        };
+
+        size_t GetHomeSlot(OffsetType Key) const
+        {
+            // Fibonacci hashing
+            return static_cast<size_t>((Uint64{Key} * Uint64{0x9E3779B97F4A7C15}) >> m_Shift);
+        }
+
+        void Grow()
+        {
+            const size_t NewCapacity = std::max(m_Slots.size() * 2, size_t{16});
+
+            std::vector<Slot, STDAllocatorRawMem<Slot>> OldSlots(NewCapacity, Slot{}, m_Slots.get_allocator());
+            std::swap(OldSlots, m_Slots);
+            m_Shift = 64 - PlatformMisc::GetMSB(Uint64{NewCapacity});
+            m_Count = 0;
+
+            for (const Slot& S : OldSlots)
+            {
+                if (S.Key != EmptyKey)
+                    Insert(S.Key, S.Value);
+            }
+        }
+
+        std::vector<Slot, STDAllocatorRawMem<Slot>> m_Slots;
+
+        size_t m_Count = 0;
+        Uint32 m_Shift = 64;
+    };
+
+public:
+    explicit TLSFAllocationsManager(const CreateInfo& CI)
+        // clang-format off
+        : m_Blocks       {STD_ALLOCATOR_RAW_MEM(FreeBlock, CI.Allocator, "Allocator for vector<FreeBlock>")}
+        , m_BlockByStart {CI.Allocator, "Allocator for TLSF block-by-start-offset hash table"}
+        , m_BlockByEnd   {CI.Allocator, "Allocator for TLSF block-by-end-offset hash table"}
+        , m_MaxSize      {CI.MaxSize}
+        , m_FreeSize     {CI.MaxSize}
+#ifdef DILIGENT_DEBUG
+        , m_DbgDisableDebugValidation{CI.DbgDisableDebugValidation}
+#endif
+    // clang-format on
+    {
+        ResetBins();
+
+        // Insert single maximum-size block
+        if (m_MaxSize > 0)
+            AddBlock(0, m_MaxSize);
+        ResetCurrAlignment();
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyList();
+#endif
+    }
+
+    TLSFAllocationsManager(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+        TLSFAllocationsManager{CreateInfo{Allocator, MaxSize}}
+    {}
+
+    ~TLSFAllocationsManager()
+    {
+#ifdef DILIGENT_DEBUG
+        if (m_NumFreeBlocks != 0)
+        {
+            VERIFY(m_NumFreeBlocks == 1, "Single free block is expected");
+            const Uint32 HeadIdx = m_BlockByStart.Find(0);
+            VERIFY(HeadIdx != InvalidIndex, "Head chunk offset is expected to be 0");
+            if (HeadIdx != InvalidIndex)
+                VERIFY(m_Blocks[HeadIdx].Size == m_MaxSize, "Head chunk size is expected to be ", m_MaxSize);
+        }
+#endif
+    }
+
+    // clang-format off
+    TLSFAllocationsManager(TLSFAllocationsManager&& rhs) noexcept
+        : m_Blocks          {std::move(rhs.m_Blocks)      }
+        , m_BlockByStart    {std::move(rhs.m_BlockByStart)}
+        , m_BlockByEnd      {std::move(rhs.m_BlockByEnd)  }
+        , m_FirstUnusedBlock{rhs.m_FirstUnusedBlock}
+        , m_NumFreeBlocks   {rhs.m_NumFreeBlocks   }
+        , m_FLBitmap        {rhs.m_FLBitmap        }
+        , m_MaxSize         {rhs.m_MaxSize         }
+        , m_FreeSize        {rhs.m_FreeSize        }
+        , m_CurrAlignment   {rhs.m_CurrAlignment   }
+#ifdef DILIGENT_DEBUG
+        , m_DbgDisableDebugValidation{rhs.m_DbgDisableDebugValidation}
+#endif
+    {
+        // clang-format on
+        std::copy(std::begin(rhs.m_SLBitmaps), std::end(rhs.m_SLBitmaps), std::begin(m_SLBitmaps));
+        std::copy(&rhs.m_BinHeads[0][0], &rhs.m_BinHeads[0][0] + FLIndexCount * SLIndexCount, &m_BinHeads[0][0]);
+
+        rhs.ResetBins();
+        rhs.m_FirstUnusedBlock = InvalidIndex;
+        rhs.m_NumFreeBlocks    = 0;
+        rhs.m_MaxSize          = 0;
+        rhs.m_FreeSize         = 0;
+        rhs.m_CurrAlignment    = 0;
+    }
+
+    // clang-format off
+    TLSFAllocationsManager& operator = (      TLSFAllocationsManager&&) = delete;
+    TLSFAllocationsManager             (const TLSFAllocationsManager&)  = delete;
+    TLSFAllocationsManager& operator = (const TLSFAllocationsManager&)  = delete;
+    // clang-format on
+
+    Allocation Allocate(OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = AlignUp(Size, Alignment);
+        if (m_FreeSize < Size)
+            return Allocation::InvalidAllocation();
+
+        // All free blocks are m_CurrAlignment-aligned, see VariableSizeAllocationsManager
+        const OffsetType AlignmentReserve = (Alignment > m_CurrAlignment) ? Alignment - m_CurrAlignment : 0;
+
+        const Uint32 BlockIdx = FindFreeBlock(Size + AlignmentReserve);
+        if (BlockIdx == InvalidIndex)
+            return Allocation::InvalidAllocation();
+
+        //     Block.Offset
+        //        |                                  |
+        //        |<-----------Block.Size----------->|
+        //        |<------Size------>|<---NewSize--->|
+        //        |                  |
+        //      Offset              NewOffset
+        //
+        const OffsetType Offset    = m_Blocks[BlockIdx].Offset;
+        const OffsetType BlockSize = m_Blocks[BlockIdx].Size;
+        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
+        const OffsetType AlignedOffset = AlignUp(Offset, Alignment);
+        const OffsetType AdjustedSize  = Size + (AlignedOffset - Offset);
+        VERIFY_EXPR(AdjustedSize <= BlockSize);
+
+        RemoveBlock(BlockIdx);
+        if (BlockSize > AdjustedSize)
+            AddBlock(Offset + AdjustedSize, BlockSize - AdjustedSize);
+
+        m_FreeSize -= AdjustedSize;
+
+        if ((Size & (m_CurrAlignment - 1)) != 0)
+        {
+            if (IsPowerOfTwo(Size))
+            {
+                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
+                m_CurrAlignment = Size;
+            }
+            else
+            {
+                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
+            }
+        }
+
+#ifdef DILIGENT_DEBUG
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+        return Allocation{Offset, AdjustedSize};
+    }
+
+    void Free(Allocation&& allocation)
+    {
+        VERIFY_EXPR(allocation.IsValid());
+        Free(allocation.UnalignedOffset, allocation.Size);
+        allocation = Allocation{};
+    }
+
+    void Free(OffsetType Offset, OffsetType Size)
+    {
+        VERIFY_EXPR(Offset != Allocation::InvalidOffset && Offset + Size <= m_MaxSize);
+        VERIFY(m_BlockByStart.Find(Offset) == InvalidIndex, "Block at offset ", Offset, " is already free");
+
+        OffsetType NewOffset = Offset;
+        OffsetType NewSize   = Size;
+
+        //   PrevBlock.Offset           Offset            NextBlock.Offset
+        //     |                          |                    |
+        //     |<-----PrevBlock.Size----->|<------Size-------->|<-----NextBlock.Size----->|
+        //
+        const Uint32 PrevBlockIdx = m_BlockByEnd.Find(Offset);
+        if (PrevBlockIdx != InvalidIndex)
+        {
+            NewOffset = m_Blocks[PrevBlockIdx].Offset;
+            NewSize += m_Blocks[PrevBlockIdx].Size;
+            RemoveBlock(PrevBlockIdx);
+        }
+
+        const Uint32 NextBlockIdx = m_BlockByStart.Find(Offset + Size);
+        if (NextBlockIdx != InvalidIndex)
+        {
+            NewSize += m_Blocks[NextBlockIdx].Size;
+            RemoveBlock(NextBlockIdx);
+        }
+
+        AddBlock(NewOffset, NewSize);
+
+        m_FreeSize += Size;
+        if (IsEmpty())
+        {
+            // Reset current alignment
+            VERIFY_EXPR(GetNumFreeBlocks() == 1);
+            ResetCurrAlignment();
+        }
+
+#ifdef DILIGENT_DEBUG
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+    }
+
+    // clang-format off
+    bool IsFull() const{ return m_FreeSize==0; };
+    bool IsEmpty()const{ return m_FreeSize==m_MaxSize; };
+    OffsetType GetMaxSize() const{return m_MaxSize;}
+    OffsetType GetFreeSize()const{return m_FreeSize;}
+    OffsetType GetUsedSize()const{return m_MaxSize - m_FreeSize;}
+    // clang-format on
+
+    size_t GetNumFreeBlocks() const
+    {
+        return m_NumFreeBlocks;
+    }
+
+    OffsetType GetMaxFreeBlockSize() const
+    {
+        if (m_FLBitmap == 0)
+            return 0;
+
+        // The largest block is in the highest non-empty bin
+        const Uint32 FL = PlatformMisc::GetMSB(m_FLBitmap);
+        const Uint32 SL = PlatformMisc::GetMSB(m_SLBitmaps[FL]);
+
+        OffsetType MaxSize = 0;
+        for (Uint32 Idx = m_BinHeads[FL][SL]; Idx != InvalidIndex; Idx = m_Blocks[Idx].NextFree)
+            MaxSize = std::max(MaxSize, m_Blocks[Idx].Size);
+        return MaxSize;
+    }
+
+    void Extend(size_t ExtraSize)
+    {
+        OffsetType NewBlockOffset = m_MaxSize;
+        OffsetType NewBlockSize   = ExtraSize;
+
+        const Uint32 LastBlockIdx = m_BlockByEnd.Find(m_MaxSize);
+        if (LastBlockIdx != InvalidIndex)
+        {
+            // Extend the last block
+            NewBlockOffset = m_Blocks[LastBlockIdx].Offset;
+            NewBlockSize += m_Blocks[LastBlockIdx].Size;
+            RemoveBlock(LastBlockIdx);
+        }
+
+        if (NewBlockSize > 0)
+            AddBlock(NewBlockOffset, NewBlockSize);
+
+        m_MaxSize += ExtraSize;
+        m_FreeSize += ExtraSize;
+
+#ifdef DILIGENT_DEBUG
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+    }
+
+private:
+    static void MapSize(OffsetType Size, Uint32& FL, Uint32& SL)
+    {
+        if (Size < SLIndexCount)
+        {
+            // Small blocks are linearly distributed between the bins of the first level
+            FL = 0;
+            SL = static_cast<Uint32>(Size);
+        }
+        else
+        {
+            const Uint32 MSB = PlatformMisc::GetMSB(Uint64{Size});
+
+            FL = MSB - SLIndexCountLog2 + 1;
+            SL = static_cast<Uint32>(Size >> (MSB - SLIndexCountLog2)) ^ SLIndexCount;
+        }
+        VERIFY_EXPR(FL < FLIndexCount && SL < SLIndexCount);
+    }
+
+    Uint32 FindFreeBlock(OffsetType RequiredSize) const
+    {
+        // Round the size up to the next bin boundary so that every block
+        // in the bin found by the bitmap search is large enough.
+        OffsetType RoundedSize = RequiredSize;
+        if (RequiredSize >= SLIndexCount)
+            RoundedSize += (OffsetType{1} << (PlatformMisc::GetMSB(Uint64{RequiredSize}) - SLIndexCountLog2)) - 1;
+
+        if (RoundedSize >= RequiredSize) // Check for overflow
+        {
+            Uint32 FL = 0, SL = 0;
+            MapSize(RoundedSize, FL, SL);
+
+            Uint32 SLMap = m_SLBitmaps[FL] & (~0u << SL);
+            if (SLMap == 0)
+            {
+                const Uint64 FLMap = (FL + 1 < FLIndexCount) ? m_FLBitmap & (~Uint64{0} << (FL + 1)) : 0;
+                if (FLMap != 0)
+                {
+                    FL    = PlatformMisc::GetLSB(FLMap);
+                    SLMap = m_SLBitmaps[FL];
+                    VERIFY_EXPR(SLMap != 0);
+                }
+            }
+
+            if (SLMap != 0)
+            {
+                SL = PlatformMisc::GetLSB(SLMap);
+                VERIFY_EXPR(m_BinHeads[FL][SL] != InvalidIndex);
+                return m_BinHeads[FL][SL];
+            }
+        }
+
+        // The bin that RequiredSize maps to is skipped by the search above,
+        // but some of its blocks may still be large enough.
+        Uint32 FL = 0, SL = 0;
+        MapSize(RequiredSize, FL, SL);
+        for (Uint32 Idx = m_BinHeads[FL][SL]; Idx != InvalidIndex; Idx = m_Blocks[Idx].NextFree)
+        {
+            if (m_Blocks[Idx].Size >= RequiredSize)
+                return Idx;
+        }
+
+        return InvalidIndex;
+    }
+
+    void AddBlock(OffsetType Offset, OffsetType Size)
+    {
+        VERIFY_EXPR(Size > 0);
+
+        Uint32 BlockIdx = m_FirstUnusedBlock;
+        if (BlockIdx != InvalidIndex)
+        {
+            m_FirstUnusedBlock = m_Blocks[BlockIdx].NextFree;
+        }
+        else
+        {
+            BlockIdx = static_cast<Uint32>(m_Blocks.size());
+            m_Blocks.emplace_back();
+        }
+
+        Uint32 FL = 0, SL = 0;
+        MapSize(Size, FL, SL);
+
+        FreeBlock& Block = m_Blocks[BlockIdx];
+        Block.Offset     = Offset;
+        Block.Size       = Size;
+        Block.PrevFree   = InvalidIndex;
+        Block.NextFree   = m_BinHeads[FL][SL];
+        if (Block.NextFree != InvalidIndex)
+            m_Blocks[Block.NextFree].PrevFree = BlockIdx;
+        m_BinHeads[FL][SL] = BlockIdx;
+
+        m_FLBitmap |= Uint64{1} << FL;
+        m_SLBitmaps[FL] |= 1u << SL;
+
+        m_BlockByStart.Insert(Offset, BlockIdx);
+        m_BlockByEnd.Insert(Offset + Size, BlockIdx);
+        ++m_NumFreeBlocks;
+    }
+
+    void RemoveBlock(Uint32 BlockIdx)
+    {
+        FreeBlock& Block = m_Blocks[BlockIdx];
+
+        Uint32 FL = 0, SL = 0;
+        MapSize(Block.Size, FL, SL);
+
+        if (Block.PrevFree != InvalidIndex)
+        {
+            m_Blocks[Block.PrevFree].NextFree = Block.NextFree;
+        }
+        else
+        {
+            VERIFY_EXPR(m_BinHeads[FL][SL] == BlockIdx);
+            m_BinHeads[FL][SL] = Block.NextFree;
+            if (Block.NextFree == InvalidIndex)
+            {
+                m_SLBitmaps[FL] &= ~(1u << SL);
+                if (m_SLBitmaps[FL] == 0)
+                    m_FLBitmap &= ~(Uint64{1} << FL);
+            }
+        }
+        if (Block.NextFree != InvalidIndex)
+            m_Blocks[Block.NextFree].PrevFree = Block.PrevFree;
+
+        m_BlockByStart.Erase(Block.Offset);
+        m_BlockByEnd.Erase(Block.Offset + Block.Size);
+        --m_NumFreeBlocks;
+
+        Block              = FreeBlock{};
+        Block.NextFree     = m_FirstUnusedBlock;
+        m_FirstUnusedBlock = BlockIdx;
+    }
+
+    void ResetBins()
+    {
+        m_FLBitmap = 0;
+        std::fill(std::begin(m_SLBitmaps), std::end(m_SLBitmaps), 0u);
+        std::fill(&m_BinHeads[0][0], &m_BinHeads[0][0] + FLIndexCount * SLIndexCount, Uint32{InvalidIndex});
+    }
+
+    void ResetCurrAlignment()
+    {
+        for (m_CurrAlignment = 1; m_CurrAlignment * 2 <= m_MaxSize; m_CurrAlignment *= 2)
+        {}
+    }
+
+#ifdef DILIGENT_DEBUG
+    void DbgVerifyList()
+    {
+        OffsetType TotalFreeSize = 0;
+        size_t     NumBlocks     = 0;
+
+        VERIFY_EXPR(IsPowerOfTwo(m_CurrAlignment));
+        for (Uint32 FL = 0; FL < FLIndexCount; ++FL)
+        {
+            VERIFY(((m_FLBitmap & (Uint64{1} << FL)) != 0) == (m_SLBitmaps[FL] != 0), "First-level bitmap is inconsistent with the second-level bitmap");
+            for (Uint32 SL = 0; SL < SLIndexCount; ++SL)
+            {
+                const Uint32 HeadIdx = m_BinHeads[FL][SL];
+                VERIFY(((m_SLBitmaps[FL] & (1u << SL)) != 0) == (HeadIdx != InvalidIndex), "Second-level bitmap is inconsistent with the bin list");
+
+                Uint32 PrevIdx = InvalidIndex;
+                for (Uint32 Idx = HeadIdx; Idx != InvalidIndex; Idx = m_Blocks[Idx].NextFree)
+                {
+                    const FreeBlock& Block = m_Blocks[Idx];
+                    VERIFY_EXPR(Block.PrevFree == PrevIdx);
+                    VERIFY_EXPR(Block.Size > 0 && Block.Offset + Block.Size <= m_MaxSize);
+
+                    Uint32 BlockFL = 0, BlockSL = 0;
+                    MapSize(Block.Size, BlockFL, BlockSL);
+                    VERIFY(BlockFL == FL && BlockSL == SL, "Block of size ", Block.Size, " is in the wrong bin");
+
+                    VERIFY((Block.Offset & (m_CurrAlignment - 1)) == 0, "Block offset (", Block.Offset, ") is not ", m_CurrAlignment, "-aligned");
+                    if (Block.Offset + Block.Size < m_MaxSize)
+                        VERIFY((Block.Size & (m_CurrAlignment - 1)) == 0, "All block sizes except for the last one must be ", m_CurrAlignment, "-aligned");
+
+                    VERIFY_EXPR(m_BlockByStart.Find(Block.Offset) == Idx);
+                    VERIFY_EXPR(m_BlockByEnd.Find(Block.Offset + Block.Size) == Idx);
+                    VERIFY(m_BlockByEnd.Find(Block.Offset) == InvalidIndex, "Unmerged adjacent blocks detected");
+
+                    TotalFreeSize += Block.Size;
+                    ++NumBlocks;
+                    PrevIdx = Idx;
+                }
+            }
+        }
+
+        VERIFY_EXPR(NumBlocks == m_NumFreeBlocks);
+        VERIFY_EXPR(m_BlockByStart.GetSize() == NumBlocks && m_BlockByEnd.GetSize() == NumBlocks);
+        VERIFY_EXPR(TotalFreeSize == m_FreeSize);
+    }
+#endif
+
+    std::vector<FreeBlock, STDAllocatorRawMem<FreeBlock>> m_Blocks;
+
+    OffsetToBlockMap m_BlockByStart;
+    OffsetToBlockMap m_BlockByEnd;
+
+    Uint32 m_FirstUnusedBlock = InvalidIndex;
+    size_t m_NumFreeBlocks    = 0;
+
+    Uint64 m_FLBitmap = 0;
+    Uint32 m_SLBitmaps[FLIndexCount];
+    Uint32 m_BinHeads[FLIndexCount][SLIndexCount];
+
+    OffsetType m_MaxSize       = 0;
+    OffsetType m_FreeSize      = 0;
+    OffsetType m_CurrAlignment = 0;
+#ifdef DILIGENT_DEBUG
+    bool m_DbgDisableDebugValidation = false;
+#endif
+    // When adding new members, do not forget to update move ctor
+};
+
+} // namespace Diligent
@@ -223,49 +223,42 @@ public:
         VERIFY_EXPR(Size + AlignmentReserve <= SmallestBlockIt->second.Size);
         VERIFY_EXPR(SmallestBlockIt->second.Size == SmallestBlockItIt->first);
 
-        //     SmallestBlockIt.Offset
-        //        |                                  |
-        //        |<------SmallestBlockIt.Size------>|
-        //        |<------Size------>|<---NewSize--->|
-        //        |                  |
-        //      Offset              NewOffset
-        //
-        OffsetType Offset = SmallestBlockIt->first;
-        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
-        OffsetType AlignedOffset = AlignUp(Offset, Alignment);
-        OffsetType AdjustedSize  = Size + (AlignedOffset - Offset);
-        VERIFY_EXPR(AdjustedSize <= Size + AlignmentReserve);
-        OffsetType NewOffset = Offset + AdjustedSize;
-        OffsetType NewSize   = SmallestBlockIt->second.Size - AdjustedSize;
         VERIFY_EXPR(SmallestBlockItIt == SmallestBlockIt->second.OrderBySizeIt);
-        m_FreeBlocksBySize.erase(SmallestBlockItIt);
-        m_FreeBlocksByOffset.erase(SmallestBlockIt);
-        if (NewSize > 0)
-        {
-            AddNewBlock(NewOffset, NewSize);
-        }
+        return AllocateFromBlock(SmallestBlockIt, Size, Alignment);
+    }
 
-        m_FreeSize -= AdjustedSize;
+    /// Allocates the block with the lowest offset that ends at or before MaxEndOffset.
 
-        if ((Size & (m_CurrAlignment - 1)) != 0)
+    /// Unlike Allocate(), which uses the best-fit strategy, this method uses the first-fit
+    /// strategy ordered by offset and is intended for moving existing allocations towards
+    /// the beginning of the space (e.g. when defragmenting). The complexity is linear in
+    /// the number of free blocks.
+    Allocation AllocateBelow(OffsetType Size, OffsetType Alignment, OffsetType MaxEndOffset)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = AlignUp(Size, Alignment);
+        if (m_FreeSize < Size)
+            return Allocation::InvalidAllocation();
+
+        for (auto BlockIt = m_FreeBlocksByOffset.begin(); BlockIt != m_FreeBlocksByOffset.end(); ++BlockIt)
         {
-            if (IsPowerOfTwo(Size))
-            {
-                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
-                m_CurrAlignment = Size;
-            }
-            else
-            {
-                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
-            }
+            const OffsetType Offset        = BlockIt->first;
+            const OffsetType AlignedOffset = AlignUp(Offset, Alignment);
+            if (AlignedOffset + Size > MaxEndOffset)
+                break;
+
+            if (AlignedOffset + Size <= Offset + BlockIt->second.Size)
+                return AllocateFromBlock(BlockIt, Size, Alignment);
         }
 
-#ifdef DILIGENT_DEBUG
-        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
-        if (!m_DbgDisableDebugValidation)
-            DbgVerifyList();
-#endif
-        return Allocation{Offset, AdjustedSize};
+        return Allocation::InvalidAllocation();
+    }
+
+    /// Returns the offset of the first free block, or GetMaxSize() if there are no free blocks.
+    OffsetType GetFirstFreeBlockOffset() const
+    {
+        return !m_FreeBlocksByOffset.empty() ? m_FreeBlocksByOffset.begin()->first : m_MaxSize;
     }
 
     void Free(Allocation&& allocation)
@@ -429,6 +422,52 @@ public:
     }
 
 private:
+    Allocation AllocateFromBlock(TFreeBlocksByOffsetMap::iterator BlockIt, OffsetType Size, OffsetType Alignment)
+    {
+        //     BlockIt.Offset
+        //        |                                  |
+        //        |<----------BlockIt.Size---------->|
+        //        |<------Size------>|<---NewSize--->|
+        //        |                  |
+        //      Offset              NewOffset
+        //
+        OffsetType Offset = BlockIt->first;
+        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
+        OffsetType AlignedOffset = AlignUp(Offset, Alignment);
+        OffsetType AdjustedSize  = Size + (AlignedOffset - Offset);
+        VERIFY_EXPR(AdjustedSize <= BlockIt->second.Size);
+        OffsetType NewOffset = Offset + AdjustedSize;
+        OffsetType NewSize   = BlockIt->second.Size - AdjustedSize;
+        m_FreeBlocksBySize.erase(BlockIt->second.OrderBySizeIt);
+        m_FreeBlocksByOffset.erase(BlockIt);
+        if (NewSize > 0)
+        {
+            AddNewBlock(NewOffset, NewSize);
+        }
+
+        m_FreeSize -= AdjustedSize;
+
+        if ((Size & (m_CurrAlignment - 1)) != 0)
+        {
+            if (IsPowerOfTwo(Size))
+            {
+                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
+                m_CurrAlignment = Size;
+            }
+            else
+            {
+                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
+            }
+        }
+
+#ifdef DILIGENT_DEBUG
+        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+        return Allocation{Offset, AdjustedSize};
+    }
+
     void AddNewBlock(OffsetType Offset, OffsetType Size)
     {
         auto NewBlockIt = m_FreeBlocksByOffset.emplace(Offset, Size);
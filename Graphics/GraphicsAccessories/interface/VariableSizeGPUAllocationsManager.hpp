@@ -32,14 +32,20 @@
 
 #include <deque>
 #include "VariableSizeAllocationsManager.hpp"
+#include "TLSFAllocationsManager.hpp"
 
 namespace Diligent
 {
 
 // Class extends basic variable-size memory block allocator by deferring deallocation
-// of freed blocks until the corresponding frame is completed
-class VariableSizeGPUAllocationsManager : public VariableSizeAllocationsManager
+// of freed blocks until the corresponding frame is completed.
+// AllocationsManagerType is either VariableSizeAllocationsManager or TLSFAllocationsManager.
+template <typename AllocationsManagerType>
+class VariableSizeGPUAllocationsManagerT : public AllocationsManagerType
 {
+public:
+    using OffsetType = typename AllocationsManagerType::OffsetType;
+
 private:
     struct StaleAllocationAttribs
     {
@@ -52,20 +58,20 @@ private:
     };
 
 public:
-    VariableSizeGPUAllocationsManager(OffsetType MaxSize, IMemoryAllocator& Allocator) :
-        VariableSizeAllocationsManager{MaxSize, Allocator},
+    VariableSizeGPUAllocationsManagerT(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+        AllocationsManagerType{MaxSize, Allocator},
         m_StaleAllocations{0, StaleAllocationAttribs(0, 0, 0), STD_ALLOCATOR_RAW_MEM(StaleAllocationAttribs, Allocator, "Allocator for deque<StaleAllocationAttribs>")}
     {}
 
-    ~VariableSizeGPUAllocationsManager()
+    ~VariableSizeGPUAllocationsManagerT()
     {
         VERIFY(m_StaleAllocations.empty(), "Not all stale allocations released");
         VERIFY(m_StaleAllocationsSize == 0, "Not all stale allocations released");
     }
 
     // = default causes compiler error when instantiating std::vector::emplace_back() in Visual Studio 2015 (Version 14.0.23107.0 D14REL)
-    VariableSizeGPUAllocationsManager(VariableSizeGPUAllocationsManager&& rhs) noexcept :
-        VariableSizeAllocationsManager(std::move(rhs)),
+    VariableSizeGPUAllocationsManagerT(VariableSizeGPUAllocationsManagerT&& rhs) noexcept :
+        AllocationsManagerType(std::move(rhs)),
         m_StaleAllocations(std::move(rhs.m_StaleAllocations)),
         m_StaleAllocationsSize(rhs.m_StaleAllocationsSize)
     {
@@ -73,9 +79,9 @@ public:
     }
 
     // clang-format off
-	VariableSizeGPUAllocationsManager& operator = (VariableSizeGPUAllocationsManager&& rhs) = delete;
-    VariableSizeGPUAllocationsManager(const VariableSizeGPUAllocationsManager&) = delete;
-    VariableSizeGPUAllocationsManager& operator = (const VariableSizeGPUAllocationsManager&) = delete;
+	VariableSizeGPUAllocationsManagerT& operator = (VariableSizeGPUAllocationsManagerT&& rhs) = delete;
+    VariableSizeGPUAllocationsManagerT(const VariableSizeGPUAllocationsManagerT&) = delete;
+    VariableSizeGPUAllocationsManagerT& operator = (const VariableSizeGPUAllocationsManagerT&) = delete;
     // clang-format on
 
     void Free(VariableSizeAllocationsManager::Allocation&& allocation, Uint64 FenceValue)
@@ -102,7 +108,7 @@ public:
         while (!m_StaleAllocations.empty() && m_StaleAllocations.front().FenceValue <= LastCompletedFenceValue)
         {
             StaleAllocationAttribs& OldestAllocation = m_StaleAllocations.front();
-            VariableSizeAllocationsManager::Free(OldestAllocation.Offset, OldestAllocation.Size);
+            AllocationsManagerType::Free(OldestAllocation.Offset, OldestAllocation.Size);
             m_StaleAllocationsSize -= OldestAllocation.Size;
             m_StaleAllocations.pop_front();
         }
@@ -114,4 +120,8 @@ private:
     std::deque<StaleAllocationAttribs, STDAllocatorRawMem<StaleAllocationAttribs>> m_StaleAllocations;
     size_t                                                                         m_StaleAllocationsSize = 0;
 };
+
+using VariableSizeGPUAllocationsManager = VariableSizeGPUAllocationsManagerT<VariableSizeAllocationsManager>;
+using TLSFGPUAllocationsManager         = VariableSizeGPUAllocationsManagerT<TLSFAllocationsManager>;
+
 } // namespace Diligent
@@ -28,6 +28,14 @@
 #include <array>
 #include <algorithm>
 #include "ColorConversion.h"
+#include "Intrinsics.hpp"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_COLOR_CONVERSION_NEON 1
+#elif DILIGENT_AVX2_SUPPORTED && (defined(_MSC_VER) || defined(__SSE2__))
+#    define DILIGENT_COLOR_CONVERSION_SSE 1
+#endif
 
 namespace Diligent
 {
@@ -77,6 +85,44 @@ private:
     };
 };
 
+// Maps linear value quantized to 12 bits to the 8-bit gamma value
+class QuantizedLinearToGammaMap
+{
+public:
+    static constexpr Uint32 Size = 4096;
+
+    Uint8 operator[](float x) const
+    {
+        // Clamping is essential as the value is used to index the table
+        x = std::max(std::min(x, 1.f), 0.f);
+        return m_ToGamma[static_cast<size_t>(x * static_cast<float>(Size - 1) + 0.5f)];
+    }
+
+    Uint8 GetValue(size_t Idx) const
+    {
+        return m_ToGamma[Idx];
+    }
+
+private:
+    const std::array<Uint8, Size> m_ToGamma{
+        []() {
+            std::array<Uint8, Size> ToGamma;
+            for (Uint32 i = 0; i < ToGamma.size(); ++i)
+            {
+                const float Gamma = LinearToGamma(static_cast<float>(i) / static_cast<float>(Size - 1));
+                ToGamma[i]        = static_cast<Uint8>(std::min(Gamma * 255.f + 0.5f, 255.f));
+            }
+            return ToGamma;
+        }(),
+    };
+};
+
+const GammaToLinearMap& GetGammaToLinearMap()
+{
+    static const GammaToLinearMap map;
+    return map;
+}
+
 } // namespace
 
 float LinearToGamma(Uint8 x)
@@ -87,8 +133,122 @@ float LinearToGamma(Uint8 x)
 
 float GammaToLinear(Uint8 x)
 {
-    static const GammaToLinearMap map;
-    return map[x];
+    return GetGammaToLinearMap()[x];
+}
+
+void GammaToLinear(const Uint8* pSrc, float* pDst, size_t Count)
+{
+    const GammaToLinearMap& map = GetGammaToLinearMap();
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = map[pSrc[i]];
+}
+
+void LinearToGamma(const float* pSrc, Uint8* pDst, size_t Count)
+{
+    static const QuantizedLinearToGammaMap map;
+
+    size_t i = 0;
+#if DILIGENT_COLOR_CONVERSION_SSE
+    {
+        // Compute the table indices four at a time
+        const __m128 Zero  = _mm_setzero_ps();
+        const __m128 One   = _mm_set1_ps(1.f);
+        const __m128 Scale = _mm_set1_ps(static_cast<float>(QuantizedLinearToGammaMap::Size - 1));
+        const __m128 Half  = _mm_set1_ps(0.5f);
+        for (; i + 4 <= Count; i += 4)
+        {
+            const __m128 x = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(pSrc + i), One), Zero);
+
+            alignas(16) Int32 Idx[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(Idx), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(x, Scale), Half)));
+            pDst[i + 0] = map.GetValue(Idx[0]);
+            pDst[i + 1] = map.GetValue(Idx[1]);
+            pDst[i + 2] = map.GetValue(Idx[2]);
+            pDst[i + 3] = map.GetValue(Idx[3]);
+        }
+    }
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = map[pSrc[i]];
+}
+
+// The SIMD implementations below must evaluate the expressions in the same
+// order as the scalar functions in ColorConversion.h to produce identical results.
+
+void FastGammaToLinear(const float* pSrc, float* pDst, size_t Count)
+{
+    size_t i = 0;
+#if DILIGENT_COLOR_CONVERSION_SSE
+    {
+        const __m128 a = _mm_set1_ps(0.305306011f);
+        const __m128 b = _mm_set1_ps(0.682171111f);
+        const __m128 c = _mm_set1_ps(0.012522878f);
+        for (; i + 4 <= Count; i += 4)
+        {
+            const __m128 x = _mm_loadu_ps(pSrc + i);
+            _mm_storeu_ps(pDst + i, _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(x, a), b)), c)));
+        }
+    }
+#elif DILIGENT_COLOR_CONVERSION_NEON
+    {
+        const float32x4_t a = vdupq_n_f32(0.305306011f);
+        const float32x4_t b = vdupq_n_f32(0.682171111f);
+        const float32x4_t c = vdupq_n_f32(0.012522878f);
+        for (; i + 4 <= Count; i += 4)
+        {
+            const float32x4_t x = vld1q_f32(pSrc + i);
+            vst1q_f32(pDst + i, vmulq_f32(x, vaddq_f32(vmulq_f32(x, vaddq_f32(vmulq_f32(x, a), b)), c)));
+        }
+    }
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = FastGammaToLinear(pSrc[i]);
+}
+
+void FastLinearToGamma(const float* pSrc, float* pDst, size_t Count)
+{
+    size_t i = 0;
+#if DILIGENT_COLOR_CONVERSION_SSE
+    {
+        const __m128 LinearThreshold = _mm_set1_ps(0.0031308f);
+        const __m128 LinearScale     = _mm_set1_ps(12.92f);
+        const __m128 Offset          = _mm_set1_ps(0.00228f);
+        const __m128 SqrtScale       = _mm_set1_ps(1.13005f);
+        const __m128 LinearTerm      = _mm_set1_ps(0.13448f);
+        const __m128 Bias            = _mm_set1_ps(0.005719f);
+        const __m128 AbsMask         = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        for (; i + 4 <= Count; i += 4)
+        {
+            const __m128 x      = _mm_loadu_ps(pSrc + i);
+            const __m128 Linear = _mm_mul_ps(LinearScale, x);
+            const __m128 Curve  = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(SqrtScale, _mm_sqrt_ps(_mm_and_ps(_mm_sub_ps(x, Offset), AbsMask))),
+                                                        _mm_mul_ps(LinearTerm, x)),
+                                             Bias);
+            const __m128 IsLinear = _mm_cmplt_ps(x, LinearThreshold);
+            _mm_storeu_ps(pDst + i, _mm_or_ps(_mm_and_ps(IsLinear, Linear), _mm_andnot_ps(IsLinear, Curve)));
+        }
+    }
+#elif DILIGENT_COLOR_CONVERSION_NEON
+    {
+        const float32x4_t LinearThreshold = vdupq_n_f32(0.0031308f);
+        const float32x4_t LinearScale     = vdupq_n_f32(12.92f);
+        const float32x4_t Offset          = vdupq_n_f32(0.00228f);
+        const float32x4_t SqrtScale       = vdupq_n_f32(1.13005f);
+        const float32x4_t LinearTerm      = vdupq_n_f32(0.13448f);
+        const float32x4_t Bias            = vdupq_n_f32(0.005719f);
+        for (; i + 4 <= Count; i += 4)
+        {
+            const float32x4_t x      = vld1q_f32(pSrc + i);
+            const float32x4_t Linear = vmulq_f32(LinearScale, x);
+            const float32x4_t Curve  = vaddq_f32(vsubq_f32(vmulq_f32(SqrtScale, vsqrtq_f32(vabsq_f32(vsubq_f32(x, Offset)))),
+                                                           vmulq_f32(LinearTerm, x)),
+                                                 Bias);
+            vst1q_f32(pDst + i, vbslq_f32(vcltq_f32(x, LinearThreshold), Linear, Curve));
+        }
+    }
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = FastLinearToGamma(pSrc[i]);
 }
 
 } // namespace Diligent
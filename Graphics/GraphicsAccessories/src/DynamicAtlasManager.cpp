@@ -28,6 +28,8 @@
 #include "DynamicAtlasManager.hpp"
 
 #include <climits>
+#include <algorithm>
+#include <numeric>
 
 #include "AdvancedMath.hpp"
 
@@ -110,19 +112,36 @@ void DynamicAtlasManager::Node::MergeChildren()
 }
 
 
-DynamicAtlasManager::DynamicAtlasManager(Uint32 Width, Uint32 Height) :
+DynamicAtlasManager::DynamicAtlasManager(Uint32 Width, Uint32 Height, PackingMode Mode) :
     m_Width{Width},
     m_Height{Height},
+    m_Mode{Mode},
     m_TotalFreeArea{Uint64{Width} * Uint64{Height}}
 {
-    m_Root->R = Region{0, 0, Width, Height};
-    RegisterNode(*m_Root);
+    if (m_Mode == PackingMode::Skyline)
+    {
+        ResetSkyline();
+    }
+    else
+    {
+        m_Root.reset(new Node);
+        m_Root->R = Region{0, 0, Width, Height};
+        RegisterNode(*m_Root);
+    }
 }
 
 
 DynamicAtlasManager::~DynamicAtlasManager()
 {
-    if (m_Root)
+    if (m_Mode == PackingMode::Skyline)
+    {
+#if DILIGENT_DEBUG
+        if (!m_Skyline.empty())
+            DbgVerifySkyline();
+#endif
+        DEV_CHECK_ERR(m_AllocatedRegions.empty(), "There must be no allocated regions");
+    }
+    else if (m_Root)
     {
 #if DILIGENT_DEBUG
         DbgVerifyConsistency();
@@ -184,6 +203,9 @@ void DynamicAtlasManager::UnregisterNode(const Node& N)
 
 DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 Height)
 {
+    if (m_Mode == PackingMode::Skyline)
+        return AllocateSkyline(Width, Height);
+
     auto it_w = m_FreeRegionsByWidth.lower_bound(Region{0, 0, Width, 0});
     while (it_w != m_FreeRegionsByWidth.end() && it_w->first.height < Height)
         ++it_w;
@@ -333,6 +355,12 @@ void DynamicAtlasManager::Free(Region&& R)
     DbgVerifyRegion(R);
 #endif
 
+    if (m_Mode == PackingMode::Skyline)
+    {
+        FreeSkyline(std::move(R));
+        return;
+    }
+
     auto node_it = m_AllocatedRegions.find(R);
     if (node_it == m_AllocatedRegions.end())
     {
@@ -370,6 +398,336 @@ void DynamicAtlasManager::Free(Region&& R)
 }
 
 
+Uint32 DynamicAtlasManager::AllocateBatch(Region* pRegions, Uint32 NumRegions)
+{
+    if (pRegions == nullptr || NumRegions == 0)
+        return 0;
+
+    // Allocating larger regions first reduces fragmentation
+    std::vector<Uint32> Order(NumRegions);
+    std::iota(Order.begin(), Order.end(), 0u);
+    std::sort(Order.begin(), Order.end(),
+              [pRegions](Uint32 i0, Uint32 i1) {
+                  const Region& R0 = pRegions[i0];
+                  const Region& R1 = pRegions[i1];
+                  if (R0.height != R1.height)
+                      return R0.height > R1.height;
+                  if (R0.width != R1.width)
+                      return R0.width > R1.width;
+                  return i0 < i1;
+              });
+
+    Uint32 NumAllocated = 0;
+    for (Uint32 i : Order)
+    {
+        Region& R = pRegions[i];
+        R         = !R.IsEmpty() ? Allocate(R.width, R.height) : Region{};
+        if (!R.IsEmpty())
+            ++NumAllocated;
+    }
+
+    return NumAllocated;
+}
+
+
+void DynamicAtlasManager::ResetSkyline()
+{
+    m_Skyline.clear();
+    m_Skyline.push_back({0, 0, m_Width});
+    m_SkylineFreeRects.clear();
+}
+
+
+Uint32 DynamicAtlasManager::GetSkylineFreeRegionCount() const
+{
+    Uint32 Count = static_cast<Uint32>(m_SkylineFreeRects.size());
+    for (const SkylineSegment& Seg : m_Skyline)
+    {
+        if (Seg.y < m_Height)
+            ++Count;
+    }
+    return Count;
+}
+
+
+bool DynamicAtlasManager::FitSkyline(size_t Segment, Uint32 Width, Uint32 Height, Uint32& y) const
+{
+    const Uint32 x = m_Skyline[Segment].x;
+    if (x + Width > m_Width)
+        return false;
+
+    // The region rests on the highest segment it spans
+    y = 0;
+    for (Uint32 WidthLeft = Width; WidthLeft > 0; ++Segment)
+    {
+        VERIFY_EXPR(Segment < m_Skyline.size());
+        const SkylineSegment& Seg = m_Skyline[Segment];
+
+        y = std::max(y, Seg.y);
+        if (y + Height > m_Height)
+            return false;
+
+        WidthLeft -= std::min(WidthLeft, Seg.width);
+    }
+
+    return true;
+}
+
+
+void DynamicAtlasManager::AddSkylineLevel(size_t Segment, const Region& R)
+{
+    VERIFY_EXPR(m_Skyline[Segment].x == R.x);
+    m_Skyline.insert(m_Skyline.begin() + Segment, SkylineSegment{R.x, R.y + R.height, R.width});
+
+    // Shrink or remove the segments covered by the new one
+    const Uint32 Right = R.x + R.width;
+    for (size_t i = Segment + 1; i < m_Skyline.size();)
+    {
+        SkylineSegment& Seg = m_Skyline[i];
+        if (Seg.x >= Right)
+            break;
+
+        const Uint32 SegRight = Seg.x + Seg.width;
+        if (SegRight <= Right)
+        {
+            m_Skyline.erase(m_Skyline.begin() + i);
+        }
+        else
+        {
+            Seg.x     = Right;
+            Seg.width = SegRight - Right;
+            break;
+        }
+    }
+
+    MergeSkyline();
+}
+
+
+bool DynamicAtlasManager::LowerSkyline(const Region& R)
+{
+    //      ______            ______
+    //     |      |__        |      |__
+    //   __|  R   |  |  ->  _|      |  |
+    //  |  |______|  |     | |______|  |
+    //
+    // The region can be removed from the skyline only if it is the topmost
+    // region in every column it spans.
+    const Uint32 Top   = R.y + R.height;
+    const Uint32 Right = R.x + R.width;
+
+    // Find the segment that contains the left edge of the region
+    size_t First = std::upper_bound(m_Skyline.begin(), m_Skyline.end(), R.x,
+                                    [](Uint32 x, const SkylineSegment& Seg) {
+                                        return x < Seg.x;
+                                    }) -
+        m_Skyline.begin();
+    VERIFY_EXPR(First > 0);
+    --First;
+
+    for (size_t i = First; i < m_Skyline.size() && m_Skyline[i].x < Right; ++i)
+    {
+        if (m_Skyline[i].y != Top)
+            return false;
+    }
+
+    // Split the first and the last segments at the region boundaries
+    if (m_Skyline[First].x < R.x)
+    {
+        SkylineSegment& Seg = m_Skyline[First];
+
+        const SkylineSegment LeftSeg{Seg.x, Seg.y, R.x - Seg.x};
+        Seg.x = R.x;
+        Seg.width -= LeftSeg.width;
+        m_Skyline.insert(m_Skyline.begin() + First, LeftSeg);
+        ++First;
+    }
+
+    size_t Last = First;
+    while (Last < m_Skyline.size() && m_Skyline[Last].x < Right)
+        ++Last;
+    VERIFY_EXPR(Last > First);
+
+    {
+        SkylineSegment& Seg      = m_Skyline[Last - 1];
+        const Uint32    SegRight = Seg.x + Seg.width;
+        if (SegRight > Right)
+        {
+            const SkylineSegment RightSeg{Right, Seg.y, SegRight - Right};
+            Seg.width = Right - Seg.x;
+            m_Skyline.insert(m_Skyline.begin() + Last, RightSeg);
+        }
+    }
+
+    for (size_t i = First; i < Last; ++i)
+        m_Skyline[i].y = R.y;
+
+    MergeSkyline();
+
+    return true;
+}
+
+
+void DynamicAtlasManager::MergeSkyline()
+{
+    size_t Dst = 0;
+    for (size_t Src = 1; Src < m_Skyline.size(); ++Src)
+    {
+        if (m_Skyline[Src].y == m_Skyline[Dst].y)
+            m_Skyline[Dst].width += m_Skyline[Src].width;
+        else
+            m_Skyline[++Dst] = m_Skyline[Src];
+    }
+    m_Skyline.resize(Dst + 1);
+}
+
+
+DynamicAtlasManager::Region DynamicAtlasManager::AllocateFromSkylineFreeRects(Uint32 Width, Uint32 Height)
+{
+    // Best area fit
+    size_t BestRect = m_SkylineFreeRects.size();
+    Uint64 BestArea = ~Uint64{0};
+    for (size_t i = 0; i < m_SkylineFreeRects.size(); ++i)
+    {
+        const Region& F = m_SkylineFreeRects[i];
+        if (F.width < Width || F.height < Height)
+            continue;
+
+        const Uint64 Area = Uint64{F.width} * Uint64{F.height};
+        if (Area < BestArea)
+        {
+            BestRect = i;
+            BestArea = Area;
+        }
+    }
+    if (BestRect == m_SkylineFreeRects.size())
+        return Region{};
+
+    const Region F = m_SkylineFreeRects[BestRect];
+    m_SkylineFreeRects[BestRect] = m_SkylineFreeRects.back();
+    m_SkylineFreeRects.pop_back();
+
+    // Split the remaining space along the longer leftover side
+    Region RightRect, TopRect;
+    if (F.width - Width > F.height - Height)
+    {
+        //   ______________
+        //  |   T  |       |
+        //  |______|  Rgt  |
+        //  |   R  |       |
+        //  |______|_______|
+        //
+        RightRect = Region{F.x + Width, F.y, F.width - Width, F.height};
+        TopRect   = Region{F.x, F.y + Height, Width, F.height - Height};
+    }
+    else
+    {
+        //   ______________
+        //  |       T      |
+        //  |______________|
+        //  |   R  |  Rgt  |
+        //  |______|_______|
+        //
+        RightRect = Region{F.x + Width, F.y, F.width - Width, Height};
+        TopRect   = Region{F.x, F.y + Height, F.width, F.height - Height};
+    }
+    if (!RightRect.IsEmpty())
+        m_SkylineFreeRects.push_back(RightRect);
+    if (!TopRect.IsEmpty())
+        m_SkylineFreeRects.push_back(TopRect);
+
+    return Region{F.x, F.y, Width, Height};
+}
+
+
+DynamicAtlasManager::Region DynamicAtlasManager::AllocateSkyline(Uint32 Width, Uint32 Height)
+{
+    if (Width == 0 || Height == 0 || Width > m_Width || Height > m_Height)
+        return Region{};
+
+    Region R = AllocateFromSkylineFreeRects(Width, Height);
+    if (R.IsEmpty())
+    {
+        // Find the position with the lowest top edge. Ties are resolved in favor of the leftmost position.
+        size_t BestSegment = m_Skyline.size();
+        Uint32 BestY       = 0;
+        for (size_t i = 0; i < m_Skyline.size(); ++i)
+        {
+            Uint32 y = 0;
+            if (FitSkyline(i, Width, Height, y) && (BestSegment == m_Skyline.size() || y < BestY))
+            {
+                BestSegment = i;
+                BestY       = y;
+            }
+        }
+        if (BestSegment == m_Skyline.size())
+            return Region{};
+
+        R = Region{m_Skyline[BestSegment].x, BestY, Width, Height};
+        AddSkylineLevel(BestSegment, R);
+    }
+
+    VERIFY_EXPR(m_AllocatedRegions.find(R) == m_AllocatedRegions.end());
+    m_AllocatedRegions.emplace(R, nullptr);
+
+    VERIFY_EXPR(m_TotalFreeArea >= Uint64{R.width} * Uint64{R.height});
+    m_TotalFreeArea -= Uint64{R.width} * Uint64{R.height};
+
+#if DILIGENT_DEBUG
+    DbgVerifySkyline();
+#endif
+
+    return R;
+}
+
+
+void DynamicAtlasManager::FreeSkyline(Region&& R)
+{
+    auto it = m_AllocatedRegions.find(R);
+    if (it == m_AllocatedRegions.end())
+    {
+        UNEXPECTED("Unable to find region [", R.x, ", ", R.x + R.width, ") x [", R.y, ", ", R.y + R.height, ") among allocated regions. Have you ever allocated it?");
+        return;
+    }
+    m_AllocatedRegions.erase(it);
+
+    m_TotalFreeArea += Uint64{R.width} * Uint64{R.height};
+
+    if (m_AllocatedRegions.empty())
+    {
+        ResetSkyline();
+    }
+    else if (LowerSkyline(R))
+    {
+        // Lowering the skyline may expose free rectangles that are now on top of it
+        for (bool Lowered = true; Lowered;)
+        {
+            Lowered = false;
+            for (size_t i = 0; i < m_SkylineFreeRects.size(); ++i)
+            {
+                if (LowerSkyline(m_SkylineFreeRects[i]))
+                {
+                    m_SkylineFreeRects[i] = m_SkylineFreeRects.back();
+                    m_SkylineFreeRects.pop_back();
+                    Lowered = true;
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        m_SkylineFreeRects.push_back(R);
+    }
+
+#if DILIGENT_DEBUG
+    DbgVerifySkyline();
+#endif
+
+    R = InvalidRegion;
+}
+
+
 #if DILIGENT_DEBUG
 
 void DynamicAtlasManager::DbgVerifyRegion(const Region& R) const
@@ -417,6 +775,37 @@ void DynamicAtlasManager::DbgRecursiveVerifyConsistency(const Node& N, Uint32& A
     }
 }
 
+void DynamicAtlasManager::DbgVerifySkyline() const
+{
+    VERIFY_EXPR(!m_Skyline.empty());
+
+    Uint32 x = 0;
+    for (size_t i = 0; i < m_Skyline.size(); ++i)
+    {
+        const SkylineSegment& Seg = m_Skyline[i];
+        VERIFY(Seg.x == x, "Skyline segments are not contiguous");
+        VERIFY(Seg.width > 0, "Skyline segment must not be empty");
+        VERIFY(Seg.y <= m_Height, "Skyline segment is above the atlas");
+        VERIFY(i == 0 || m_Skyline[i - 1].y != Seg.y, "Adjacent skyline segments at the same level must be merged");
+        x += Seg.width;
+    }
+    VERIFY(x == m_Width, "Skyline does not cover the entire atlas width");
+
+    Uint64 AllocatedArea = 0;
+    for (const auto& it : m_AllocatedRegions)
+    {
+        const Region& R = it.first;
+        DbgVerifyRegion(R);
+        AllocatedArea += Uint64{R.width} * Uint64{R.height};
+    }
+    VERIFY_EXPR(AllocatedArea + m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height});
+
+    for (const Region& F : m_SkylineFreeRects)
+    {
+        DbgVerifyRegion(F);
+    }
+}
+
 void DynamicAtlasManager::DbgVerifyConsistency() const
 {
     VERIFY_EXPR(m_FreeRegionsByWidth.size() == m_FreeRegionsByHeight.size());
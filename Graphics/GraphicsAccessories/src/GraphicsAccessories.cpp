@@ -35,6 +35,19 @@
 #include "Cast.hpp"
 #include "StringTools.hpp"
 #include "HashUtils.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_TEXEL_CONVERSION_NEON 1
+#elif DILIGENT_AVX2_SUPPORTED && (defined(__SSSE3__) || defined(__AVX__))
+#    define DILIGENT_TEXEL_CONVERSION_SSSE3 1
+#endif
+
+#if DILIGENT_TEXEL_CONVERSION_NEON || DILIGENT_TEXEL_CONVERSION_SSSE3
+#    define DILIGENT_TEXEL_CONVERSION_SIMD 1
+#endif
 
 namespace Diligent
 {
@@ -281,174 +294,6 @@ TEXTURE_FORMAT GetDefaultTextureViewFormat(TEXTURE_FORMAT TextureFormat, TEXTURE
     return FmtConverter.GetViewFormat(TextureFormat, ViewType, BindFlags);
 }
 
-const TextureFormatAttribs& GetTextureFormatAttribs(TEXTURE_FORMAT Format)
-{
-    struct FormatToTextureFormatAttribsMap
-    {
-        FormatToTextureFormatAttribsMap()
-        {
-            // clang-format off
-#define INIT_TEX_FORMAT_INFO(TexFmt, ComponentSize, NumComponents, ComponentType, IsTypeless, BlockWidth, BlockHeight) \
-            FmtAttribs[ TexFmt ] = TextureFormatAttribs{#TexFmt, TexFmt, ComponentSize, NumComponents, ComponentType, IsTypeless, BlockWidth, BlockHeight};
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA32_TYPELESS,         4, 4, COMPONENT_TYPE_UNDEFINED,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA32_FLOAT,            4, 4, COMPONENT_TYPE_FLOAT,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA32_UINT,             4, 4, COMPONENT_TYPE_UINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA32_SINT,             4, 4, COMPONENT_TYPE_SINT,      false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGB32_TYPELESS,          4, 3, COMPONENT_TYPE_UNDEFINED,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGB32_FLOAT,             4, 3, COMPONENT_TYPE_FLOAT,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGB32_UINT,              4, 3, COMPONENT_TYPE_UINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGB32_SINT,              4, 3, COMPONENT_TYPE_SINT,      false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA16_TYPELESS,         2, 4, COMPONENT_TYPE_UNDEFINED,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA16_FLOAT,            2, 4, COMPONENT_TYPE_FLOAT,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA16_UNORM,            2, 4, COMPONENT_TYPE_UNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA16_UINT,             2, 4, COMPONENT_TYPE_UINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA16_SNORM,            2, 4, COMPONENT_TYPE_SNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA16_SINT,             2, 4, COMPONENT_TYPE_SINT,      false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG32_TYPELESS,           4, 2, COMPONENT_TYPE_UNDEFINED,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG32_FLOAT,              4, 2, COMPONENT_TYPE_FLOAT,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG32_UINT,               4, 2, COMPONENT_TYPE_UINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG32_SINT,               4, 2, COMPONENT_TYPE_SINT,      false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R32G8X24_TYPELESS,       4, 2, COMPONENT_TYPE_DEPTH_STENCIL,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_D32_FLOAT_S8X24_UINT,    4, 2, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R32_FLOAT_X8X24_TYPELESS,4, 2, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_X32_TYPELESS_G8X24_UINT, 4, 2, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGB10A2_TYPELESS,        4, 1, COMPONENT_TYPE_COMPOUND,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGB10A2_UNORM,           4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGB10A2_UINT,            4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R11G11B10_FLOAT,         4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA8_TYPELESS,          1, 4, COMPONENT_TYPE_UNDEFINED,   true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA8_UNORM,             1, 4, COMPONENT_TYPE_UNORM,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA8_UNORM_SRGB,        1, 4, COMPONENT_TYPE_UNORM_SRGB, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA8_UINT,              1, 4, COMPONENT_TYPE_UINT,       false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA8_SNORM,             1, 4, COMPONENT_TYPE_SNORM,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGBA8_SINT,              1, 4, COMPONENT_TYPE_SINT,       false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG16_TYPELESS,           2, 2, COMPONENT_TYPE_UNDEFINED,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG16_FLOAT,              2, 2, COMPONENT_TYPE_FLOAT,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG16_UNORM,              2, 2, COMPONENT_TYPE_UNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG16_UINT,               2, 2, COMPONENT_TYPE_UINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG16_SNORM,              2, 2, COMPONENT_TYPE_SNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG16_SINT,               2, 2, COMPONENT_TYPE_SINT,      false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R32_TYPELESS,            4, 1, COMPONENT_TYPE_UNDEFINED,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_D32_FLOAT,               4, 1, COMPONENT_TYPE_DEPTH,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R32_FLOAT,               4, 1, COMPONENT_TYPE_FLOAT,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R32_UINT,                4, 1, COMPONENT_TYPE_UINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R32_SINT,                4, 1, COMPONENT_TYPE_SINT,      false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R24G8_TYPELESS,          4, 1, COMPONENT_TYPE_DEPTH_STENCIL,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_D24_UNORM_S8_UINT,       4, 1, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R24_UNORM_X8_TYPELESS,   4, 1, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_X24_TYPELESS_G8_UINT,    4, 1, COMPONENT_TYPE_DEPTH_STENCIL, false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG8_TYPELESS,            1, 2, COMPONENT_TYPE_UNDEFINED,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG8_UNORM,               1, 2, COMPONENT_TYPE_UNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG8_UINT,                1, 2, COMPONENT_TYPE_UINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG8_SNORM,               1, 2, COMPONENT_TYPE_SNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG8_SINT,                1, 2, COMPONENT_TYPE_SINT,      false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R16_TYPELESS,            2, 1, COMPONENT_TYPE_UNDEFINED,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R16_FLOAT,               2, 1, COMPONENT_TYPE_FLOAT,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_D16_UNORM,               2, 1, COMPONENT_TYPE_DEPTH,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R16_UNORM,               2, 1, COMPONENT_TYPE_UNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R16_UINT,                2, 1, COMPONENT_TYPE_UINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R16_SNORM,               2, 1, COMPONENT_TYPE_SNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R16_SINT,                2, 1, COMPONENT_TYPE_SINT,      false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R8_TYPELESS,             1, 1, COMPONENT_TYPE_UNDEFINED,  true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R8_UNORM,                1, 1, COMPONENT_TYPE_UNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R8_UINT,                 1, 1, COMPONENT_TYPE_UINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R8_SNORM,                1, 1, COMPONENT_TYPE_SNORM,     false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R8_SINT,                 1, 1, COMPONENT_TYPE_SINT,      false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_A8_UNORM,                1, 1, COMPONENT_TYPE_UNORM,     false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R1_UNORM,                1, 1, COMPONENT_TYPE_UNORM,    false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RGB9E5_SHAREDEXP,        4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_RG8_B8G8_UNORM,          1, 4, COMPONENT_TYPE_UNORM,    false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_G8R8_G8B8_UNORM,         1, 4, COMPONENT_TYPE_UNORM,    false, 1,1);
-
-            // http://www.g-truc.net/post-0335.html
-            // http://renderingpipeline.com/2012/07/texture-compression/
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC1_TYPELESS,            8,  3, COMPONENT_TYPE_COMPRESSED,  true, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC1_UNORM,               8,  3, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC1_UNORM_SRGB,          8,  3, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC2_TYPELESS,            16, 4, COMPONENT_TYPE_COMPRESSED,  true, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC2_UNORM,               16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC2_UNORM_SRGB,          16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC3_TYPELESS,            16, 4, COMPONENT_TYPE_COMPRESSED,  true, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC3_UNORM,               16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC3_UNORM_SRGB,          16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC4_TYPELESS,            8,  1, COMPONENT_TYPE_COMPRESSED,  true, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC4_UNORM,               8,  1, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC4_SNORM,               8,  1, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC5_TYPELESS,            16, 2, COMPONENT_TYPE_COMPRESSED,  true, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC5_UNORM,               16, 2, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC5_SNORM,               16, 2, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_B5G6R5_UNORM,            2, 1, COMPONENT_TYPE_COMPOUND, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_B5G5R5A1_UNORM,          2, 1, COMPONENT_TYPE_COMPOUND, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BGRA8_UNORM,             1, 4, COMPONENT_TYPE_UNORM,    false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BGRX8_UNORM,             1, 4, COMPONENT_TYPE_UNORM,    false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_R10G10B10_XR_BIAS_A2_UNORM,  4, 1, COMPONENT_TYPE_COMPOUND, false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BGRA8_TYPELESS,          1, 4, COMPONENT_TYPE_UNDEFINED,     true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BGRA8_UNORM_SRGB,        1, 4, COMPONENT_TYPE_UNORM_SRGB,   false, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BGRX8_TYPELESS,          1, 4, COMPONENT_TYPE_UNDEFINED,     true, 1,1);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BGRX8_UNORM_SRGB,        1, 4, COMPONENT_TYPE_UNORM_SRGB,   false, 1,1);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC6H_TYPELESS,           16, 3, COMPONENT_TYPE_COMPRESSED,  true, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC6H_UF16,               16, 3, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC6H_SF16,               16, 3, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC7_TYPELESS,            16, 4, COMPONENT_TYPE_COMPRESSED,  true, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC7_UNORM,               16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_BC7_UNORM_SRGB,          16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_ETC2_RGB8_UNORM,         8,  3, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_ETC2_RGB8_UNORM_SRGB,    8,  3, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_ETC2_RGB8A1_UNORM,       8,  4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_ETC2_RGB8A1_UNORM_SRGB,  8,  4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_ETC2_RGBA8_UNORM,        16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-            INIT_TEX_FORMAT_INFO(TEX_FORMAT_ETC2_RGBA8_UNORM_SRGB,   16, 4, COMPONENT_TYPE_COMPRESSED, false, 4,4);
-#undef  INIT_TEX_FORMAT_INFO
-            // clang-format on
-            static_assert(TEX_FORMAT_NUM_FORMATS == 106, "Not all texture formats initialized.");
-
-#ifdef DILIGENT_DEBUG
-            for (Uint32 Fmt = TEX_FORMAT_UNKNOWN; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
-                VERIFY(FmtAttribs[Fmt].Format == static_cast<TEXTURE_FORMAT>(Fmt), "Uninitialized format");
-#endif
-        }
-
-        const TextureFormatAttribs& operator[](TEXTURE_FORMAT Format) const
-        {
-            if (Format >= TEX_FORMAT_UNKNOWN && Format < TEX_FORMAT_NUM_FORMATS)
-            {
-                const TextureFormatAttribs& Attribs = FmtAttribs[Format];
-                VERIFY(Attribs.Format == Format, "Unexpected format");
-                return Attribs;
-            }
-            else
-            {
-                UNEXPECTED("Texture format (", int{Format}, ") is out of allowed range [0, ", int{TEX_FORMAT_NUM_FORMATS} - 1, "]");
-                return FmtAttribs[0];
-            }
-        }
-
-    private:
-        std::array<TextureFormatAttribs, TEX_FORMAT_NUM_FORMATS> FmtAttribs{};
-    };
-
-    static const FormatToTextureFormatAttribsMap FormatToTexFormatAttribs;
-    return FormatToTexFormatAttribs[Format];
-}
-
 COMPONENT_TYPE ValueTypeToComponentType(VALUE_TYPE ValType, bool IsNormalized, bool IsSRGB)
 {
     static_assert(VT_NUM_TYPES == 10, "Please handle the new value type below");
@@ -1637,7 +1482,7 @@ String GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAGS Flags, bool GetFul
 
         PIPELINE_RESOURCE_FLAGS Flag = ExtractLSB(Flags);
 
-        static_assert(PIPELINE_RESOURCE_FLAG_LAST == (1u << 4), "Please update the switch below to handle the new pipeline resource flag.");
+        static_assert(PIPELINE_RESOURCE_FLAG_LAST == (1u << 5), "Please update the switch below to handle the new pipeline resource flag.");
         switch (Flag)
         {
             case PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS:
@@ -1660,6 +1505,10 @@ String GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAGS Flags, bool GetFul
                 Str.append(GetFullName ? "PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT" : "GENERAL_INPUT_ATTACHMENT");
                 break;
 
+            case PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS:
+                Str.append(GetFullName ? "PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS" : "INLINE_CONSTANTS");
+                break;
+
             default:
                 UNEXPECTED("Unexpected pipeline resource flag");
         }
@@ -1808,7 +1657,7 @@ PIPELINE_RESOURCE_FLAGS GetValidPipelineResourceFlags(SHADER_RESOURCE_TYPE Resou
     switch (ResourceType)
     {
         case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
-            return PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS | PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY;
+            return PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS | PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY | PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS;
 
         case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
             return PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER | PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY;
@@ -2473,10 +2322,30 @@ void CopyTextureSubresource(const TextureSubResData& SrcSubres,
     VERIFY_EXPR(pDstData != nullptr);
     VERIFY(SrcSubres.Stride >= RowSize, "Source data row stride (", SrcSubres.Stride, ") is smaller than the row size (", RowSize, ")");
     VERIFY(DstRowStride >= RowSize, "Dst data row stride (", DstRowStride, ") is smaller than the row size (", RowSize, ")");
+
+    const Uint8* pSrc = static_cast<const Uint8*>(SrcSubres.pData);
+    Uint8*       pDst = static_cast<Uint8*>(pDstData);
+
+    if (SrcSubres.Stride == RowSize && DstRowStride == RowSize)
+    {
+        // Rows are tightly packed in both buffers - copy whole slices at once.
+        const Uint64 SliceSize = RowSize * NumRows;
+        if (NumDepthSlices == 1 || (SrcSubres.DepthStride == SliceSize && DstDepthStride == SliceSize))
+        {
+            memcpy(pDst, pSrc, StaticCast<size_t>(SliceSize * NumDepthSlices));
+        }
+        else
+        {
+            for (Uint32 z = 0; z < NumDepthSlices; ++z)
+                memcpy(pDst + DstDepthStride * z, pSrc + SrcSubres.DepthStride * z, StaticCast<size_t>(SliceSize));
+        }
+        return;
+    }
+
     for (Uint32 z = 0; z < NumDepthSlices; ++z)
     {
-        const Uint8* pSrcSlice = reinterpret_cast<const Uint8*>(SrcSubres.pData) + SrcSubres.DepthStride * z;
-        Uint8*       pDstSlice = reinterpret_cast<Uint8*>(pDstData) + DstDepthStride * z;
+        const Uint8* pSrcSlice = pSrc + SrcSubres.DepthStride * z;
+        Uint8*       pDstSlice = pDst + DstDepthStride * z;
 
         for (Uint32 y = 0; y < NumRows; ++y)
         {
@@ -2487,6 +2356,169 @@ void CopyTextureSubresource(const TextureSubResData& SrcSubres,
     }
 }
 
+namespace
+{
+
+// Source of the destination component in ConvertTextureSubresource
+enum CONVERT_SRC : Int32
+{
+    CONVERT_SRC_ZERO = -1,
+    CONVERT_SRC_ONE  = -2
+};
+
+struct TexelConversion
+{
+    Uint32               SrcCount = 0;
+    Uint32               DstCount = 0;
+    std::array<Int32, 4> SrcIdx   = {};
+};
+
+void ConvertRowScalar(const TexelConversion& Conv, const Uint8* pSrc, Uint8* pDst, Uint32 XStart, Uint32 Width)
+{
+    for (Uint32 x = XStart; x < Width; ++x)
+    {
+        const Uint8* pSrcTexel = pSrc + x * Conv.SrcCount;
+        Uint8*       pDstTexel = pDst + x * Conv.DstCount;
+        for (Uint32 c = 0; c < Conv.DstCount; ++c)
+        {
+            const Int32 Idx = Conv.SrcIdx[c];
+            pDstTexel[c]    = Idx >= 0 ? pSrcTexel[Idx] : (Idx == CONVERT_SRC_ONE ? Uint8{255} : Uint8{0});
+        }
+    }
+}
+
+#if DILIGENT_TEXEL_CONVERSION_SIMD
+// Builds the byte shuffle that converts four texels, and the mask that sets constant-one components.
+void GetTexelShuffle(const TexelConversion& Conv, Uint8 Shuffle[16], Uint8 OneMask[16])
+{
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint32 t = i / Conv.DstCount;
+        const Uint32 c = i % Conv.DstCount;
+
+        const Int32 Idx = t < 4 ? Conv.SrcIdx[c] : CONVERT_SRC_ZERO;
+        Shuffle[i]      = Idx >= 0 ? static_cast<Uint8>(t * Conv.SrcCount + Idx) : Uint8{0x80};
+        OneMask[i]      = Idx == CONVERT_SRC_ONE ? Uint8{0xFF} : Uint8{0};
+    }
+}
+
+// Converts four texels per iteration with 16-byte loads and stores. The bytes written past
+// the four texels belong to the same row and are overwritten by the following iterations.
+// Returns the number of texels processed.
+Uint32 ConvertRowSIMD(const TexelConversion& Conv, const Uint8 Shuffle[16], const Uint8 OneMask[16], const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    const Uint32 MinCount = std::min(Conv.SrcCount, Conv.DstCount);
+
+    Uint32 x = 0;
+#    if DILIGENT_TEXEL_CONVERSION_SSSE3
+    const __m128i ShuffleMask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Shuffle));
+    const __m128i OneBits     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(OneMask));
+    for (; (Width - x) * MinCount >= 16; x += 4)
+    {
+        const __m128i Src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x * Conv.SrcCount));
+        const __m128i Dst = _mm_or_si128(_mm_shuffle_epi8(Src, ShuffleMask), OneBits);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x * Conv.DstCount), Dst);
+    }
+#    elif DILIGENT_TEXEL_CONVERSION_NEON
+    const uint8x16_t ShuffleMask = vld1q_u8(Shuffle);
+    const uint8x16_t OneBits     = vld1q_u8(OneMask);
+    for (; (Width - x) * MinCount >= 16; x += 4)
+    {
+        const uint8x16_t Src = vld1q_u8(pSrc + x * Conv.SrcCount);
+        vst1q_u8(pDst + x * Conv.DstCount, vorrq_u8(vqtbl1q_u8(Src, ShuffleMask), OneBits));
+    }
+#    endif
+    return x;
+}
+#endif
+
+} // namespace
+
+void ConvertTextureSubresource(const ConvertTextureSubresourceAttribs& Attribs)
+{
+    const TextureSubResData& SrcSubres = Attribs.SrcSubres;
+    VERIFY_EXPR(SrcSubres.pSrcBuffer == nullptr && SrcSubres.pData != nullptr);
+    VERIFY_EXPR(Attribs.pDstData != nullptr);
+    DEV_CHECK_ERR(Attribs.SrcComponentCount >= 1 && Attribs.SrcComponentCount <= 4, "Source component count (", Attribs.SrcComponentCount, ") must be between 1 and 4");
+    DEV_CHECK_ERR(Attribs.DstComponentCount >= 1 && Attribs.DstComponentCount <= 4, "Destination component count (", Attribs.DstComponentCount, ") must be between 1 and 4");
+
+    TexelConversion Conv;
+    Conv.SrcCount = Attribs.SrcComponentCount;
+    Conv.DstCount = Attribs.DstComponentCount;
+
+    bool IsIdentity = Conv.SrcCount == Conv.DstCount;
+    for (Uint32 c = 0; c < Conv.DstCount; ++c)
+    {
+        Int32 Idx = CONVERT_SRC_ZERO;
+        switch (Attribs.Swizzle[c])
+        {
+            // clang-format off
+            case TEXTURE_COMPONENT_SWIZZLE_IDENTITY: Idx = static_cast<Int32>(c); break;
+            case TEXTURE_COMPONENT_SWIZZLE_ZERO:     Idx = CONVERT_SRC_ZERO;      break;
+            case TEXTURE_COMPONENT_SWIZZLE_ONE:      Idx = CONVERT_SRC_ONE;       break;
+            case TEXTURE_COMPONENT_SWIZZLE_R:        Idx = 0;                     break;
+            case TEXTURE_COMPONENT_SWIZZLE_G:        Idx = 1;                     break;
+            case TEXTURE_COMPONENT_SWIZZLE_B:        Idx = 2;                     break;
+            case TEXTURE_COMPONENT_SWIZZLE_A:        Idx = 3;                     break;
+            // clang-format on
+            default:
+                UNEXPECTED("Unexpected texture component swizzle");
+        }
+        if (Idx >= static_cast<Int32>(Conv.SrcCount))
+        {
+            // Missing components read as 0, alpha reads as 1
+            Idx = Idx == 3 ? CONVERT_SRC_ONE : CONVERT_SRC_ZERO;
+        }
+        Conv.SrcIdx[c] = Idx;
+        IsIdentity     = IsIdentity && Idx == static_cast<Int32>(c);
+    }
+
+    const Uint64 SrcRowSize = Uint64{Attribs.Width} * Conv.SrcCount;
+    const Uint64 DstRowSize = Uint64{Attribs.Width} * Conv.DstCount;
+    VERIFY(SrcSubres.Stride >= SrcRowSize, "Source data row stride (", SrcSubres.Stride, ") is smaller than the row size (", SrcRowSize, ")");
+    VERIFY(Attribs.DstRowStride >= DstRowSize, "Dst data row stride (", Attribs.DstRowStride, ") is smaller than the row size (", DstRowSize, ")");
+
+    if (IsIdentity && Attribs.pThreadPool == nullptr)
+    {
+        CopyTextureSubresource(SrcSubres, Attribs.NumRows, Attribs.NumDepthSlices, SrcRowSize, Attribs.pDstData, Attribs.DstRowStride, Attribs.DstDepthStride);
+        return;
+    }
+
+#if DILIGENT_TEXEL_CONVERSION_SIMD
+    Uint8 Shuffle[16];
+    Uint8 OneMask[16];
+    GetTexelShuffle(Conv, Shuffle, OneMask);
+#endif
+
+    const Uint8* pSrc = static_cast<const Uint8*>(SrcSubres.pData);
+    Uint8*       pDst = static_cast<Uint8*>(Attribs.pDstData);
+
+    const Uint32 TotalRows = Attribs.NumRows * Attribs.NumDepthSlices;
+    // Give every task about 256 KB of destination data
+    constexpr Uint64 MinBytesPerTask = 256 << 10;
+    const Uint32     RowsPerTask     = static_cast<Uint32>(std::max(MinBytesPerTask / std::max(DstRowSize, Uint64{1}), Uint64{1}));
+
+    ParallelFor(Attribs.pThreadPool, 0, TotalRows, RowsPerTask,
+                [&](Uint32 Row) {
+                    const Uint32 z = Row / Attribs.NumRows;
+                    const Uint32 y = Row % Attribs.NumRows;
+
+                    const Uint8* pSrcRow = pSrc + SrcSubres.DepthStride * z + SrcSubres.Stride * y;
+                    Uint8*       pDstRow = pDst + Attribs.DstDepthStride * z + Attribs.DstRowStride * y;
+                    if (IsIdentity)
+                    {
+                        memcpy(pDstRow, pSrcRow, StaticCast<size_t>(DstRowSize));
+                        return;
+                    }
+
+                    Uint32 x = 0;
+#if DILIGENT_TEXEL_CONVERSION_SIMD
+                    x = ConvertRowSIMD(Conv, Shuffle, OneMask, pSrcRow, pDstRow, Attribs.Width);
+#endif
+                    ConvertRowScalar(Conv, pSrcRow, pDstRow, x, Attribs.Width);
+                });
+}
+
 String GetCommandQueueTypeString(COMMAND_QUEUE_TYPE Type)
 {
     static_assert(COMMAND_QUEUE_TYPE_MAX_BIT == 0x7, "Please update the code below to handle the new command queue type");
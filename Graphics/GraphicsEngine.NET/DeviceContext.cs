@@ -38,7 +38,7 @@ public partial class IDeviceContext
         return MemoryMarshal.Cast<byte, T>(data);
     }
 
-    public unsafe void SetVertexBuffers(uint startSlot, IBuffer[] buffers, ulong[] offsets, ResourceStateTransitionMode stateTransitionMode, SetVertexBuffersFlags flags = SetVertexBuffersFlags.None)
+    public unsafe void SetVertexBuffers(uint startSlot, ReadOnlySpan<IBuffer> buffers, ReadOnlySpan<ulong> offsets, ResourceStateTransitionMode stateTransitionMode, SetVertexBuffersFlags flags = SetVertexBuffersFlags.None)
     {
         var ppBuffers = stackalloc IntPtr[buffers.Length];
         for (var i = 0; i < buffers.Length; i++)
@@ -46,30 +46,84 @@ public partial class IDeviceContext
 
         fixed (ulong* pOffsets = offsets)
             SetVertexBuffers(startSlot, (uint)buffers.Length, ppBuffers, pOffsets, stateTransitionMode, flags);
+    }
+
+    public void SetVertexBuffers(uint startSlot, IBuffer[] buffers, ulong[] offsets, ResourceStateTransitionMode stateTransitionMode, SetVertexBuffersFlags flags = SetVertexBuffersFlags.None)
+    {
+        SetVertexBuffers(startSlot, new ReadOnlySpan<IBuffer>(buffers), new ReadOnlySpan<ulong>(offsets), stateTransitionMode, flags);
         GC.KeepAlive(buffers);
     }
 
-    public unsafe void SetRenderTargets(ITextureView[] renderTargetViews, ITextureView depthStencilView, ResourceStateTransitionMode mode)
+    public unsafe void SetVertexBuffer(uint slot, IBuffer buffer, ulong offset, ResourceStateTransitionMode stateTransitionMode, SetVertexBuffersFlags flags = SetVertexBuffersFlags.None)
+    {
+        var pBuffer = buffer?.NativePointer ?? IntPtr.Zero;
+        SetVertexBuffers(slot, 1, &pBuffer, &offset, stateTransitionMode, flags);
+        GC.KeepAlive(buffer);
+    }
+
+    public unsafe void SetRenderTargets(ReadOnlySpan<ITextureView> renderTargetViews, ITextureView depthStencilView, ResourceStateTransitionMode mode)
     {
-        var ppRTVs = stackalloc IntPtr[renderTargetViews?.Length ?? 0];
-        for (var i = 0; i < renderTargetViews?.Length; i++)
+        var ppRTVs = stackalloc IntPtr[renderTargetViews.Length];
+        for (var i = 0; i < renderTargetViews.Length; i++)
             ppRTVs[i] = renderTargetViews[i]?.NativePointer ?? IntPtr.Zero;
-        SetRenderTargets((uint)(renderTargetViews?.Length ?? 0), ppRTVs, depthStencilView, mode);
+        SetRenderTargets((uint)renderTargetViews.Length, ppRTVs, depthStencilView, mode);
+    }
+
+    public void SetRenderTargets(ITextureView[] renderTargetViews, ITextureView depthStencilView, ResourceStateTransitionMode mode)
+    {
+        SetRenderTargets(new ReadOnlySpan<ITextureView>(renderTargetViews), depthStencilView, mode);
         GC.KeepAlive(renderTargetViews);
     }
 
+    public unsafe void SetViewports(ReadOnlySpan<Viewport> viewports, uint width, uint height)
+    {
+        fixed (Viewport* pViewports = viewports)
+            SetViewports((uint)viewports.Length, pViewports, width, height);
+    }
+
+    public void SetViewports(Viewport[] viewports, uint width, uint height)
+    {
+        SetViewports(new ReadOnlySpan<Viewport>(viewports), width, height);
+    }
+
+    public unsafe void SetScissorRects(ReadOnlySpan<Rect> rects, uint width, uint height)
+    {
+        fixed (Rect* pRects = rects)
+            SetScissorRects((uint)rects.Length, pRects, width, height);
+    }
+
+    public void SetScissorRects(Rect[] rects, uint width, uint height)
+    {
+        SetScissorRects(new ReadOnlySpan<Rect>(rects), width, height);
+    }
+
     public unsafe void UpdateBuffer<T>(IBuffer buffer, ulong offset, ReadOnlySpan<T> data, ResourceStateTransitionMode stateTransitionMode) where T : unmanaged
     {
         fixed (T* dataPtr = data)
             UpdateBuffer(buffer, offset, (ulong)(Unsafe.SizeOf<T>() * data.Length), new(dataPtr), stateTransitionMode);
     }
 
-    public unsafe void ExecuteCommandLists(ICommandList[] commandLists)
+    public void UpdateBuffer<T>(IBuffer buffer, ulong offset, T[] data, ResourceStateTransitionMode stateTransitionMode) where T : unmanaged
+    {
+        UpdateBuffer(buffer, offset, new ReadOnlySpan<T>(data), stateTransitionMode);
+    }
+
+    public void UpdateBuffer<T>(IBuffer buffer, ulong offset, in T data, ResourceStateTransitionMode stateTransitionMode) where T : unmanaged
+    {
+        UpdateBuffer(buffer, offset, MemoryMarshal.CreateReadOnlySpan(ref Unsafe.AsRef(in data), 1), stateTransitionMode);
+    }
+
+    public unsafe void ExecuteCommandLists(ReadOnlySpan<ICommandList> commandLists)
     {
         var ppCmdLists = stackalloc IntPtr[commandLists.Length];
         for (var i = 0; i < commandLists.Length; i++)
             ppCmdLists[i] = commandLists[i].NativePointer;
         ExecuteCommandLists((uint)commandLists.Length, ppCmdLists);
+    }
+
+    public void ExecuteCommandLists(ICommandList[] commandLists)
+    {
+        ExecuteCommandLists(new ReadOnlySpan<ICommandList>(commandLists));
         GC.KeepAlive(commandLists);
     }
 }
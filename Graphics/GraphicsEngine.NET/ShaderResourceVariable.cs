@@ -25,18 +25,41 @@
  */
 
 using System;
+using System.Collections.Generic;
 
 namespace Diligent;
 
 public partial class IShaderResourceVariable
 {
-    public unsafe void SetArray(IDeviceObject[] objects, uint firstElement, SetShaderResourceFlags flags)
+    public unsafe void SetArray(ReadOnlySpan<IDeviceObject> objects, uint firstElement, SetShaderResourceFlags flags)
     {
         var ppObjects = stackalloc IntPtr[objects.Length];
         for (var i = 0; i < objects.Length; i++)
             ppObjects[i] = objects[i].NativePointer;
 
         SetArray(ppObjects, firstElement, (uint)objects.Length, flags);
+    }
+
+    public void SetArray(IDeviceObject[] objects, uint firstElement, SetShaderResourceFlags flags)
+    {
+        SetArray(new ReadOnlySpan<IDeviceObject>(objects), firstElement, flags);
         GC.KeepAlive(objects);
     }
 }
+
+internal sealed class ShaderResourceVariableCache
+{
+    private readonly Dictionary<(ShaderType, string), IShaderResourceVariable> m_Variables = new();
+
+    public bool TryGetValue(ShaderType shaderType, string name, out IShaderResourceVariable variable)
+    {
+        lock (m_Variables)
+            return m_Variables.TryGetValue((shaderType, name), out variable);
+    }
+
+    public void Add(ShaderType shaderType, string name, IShaderResourceVariable variable)
+    {
+        lock (m_Variables)
+            m_Variables[(shaderType, name)] = variable;
+    }
+}
@@ -68,7 +68,8 @@ public:
                     DeviceContextImplType* pDeferredCtx,
                     bool                   bIsDeviceInternal = false) :
         TDeviceObjectBase{pRefCounters, pDevice, CommandListDesc{}, bIsDeviceInternal},
-        m_QueueId{pDeferredCtx->GetDesc().QueueId}
+        m_QueueId{pDeferredCtx->GetDesc().QueueId},
+        m_Flags{pDeferredCtx->GetCommandListFlags()}
     {
         VERIFY_EXPR(pDeferredCtx->GetDesc().IsDeferred);
     }
@@ -82,10 +83,17 @@ public:
         return m_QueueId;
     }
 
+    /// Returns true if the command list was recorded with COMMAND_LIST_FLAG_REUSABLE flag.
+    bool IsReusable() const
+    {
+        return (m_Flags & COMMAND_LIST_FLAG_REUSABLE) != 0;
+    }
+
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_CommandList, TDeviceObjectBase)
 
 private:
-    const Uint8 m_QueueId;
+    const Uint8              m_QueueId;
+    const COMMAND_LIST_FLAGS m_Flags;
 };
 
 } // namespace Diligent
@@ -37,6 +37,7 @@
 #include "Dearchiver.h"
 #include "RenderDevice.h"
 #include "Shader.h"
+#include "ThreadPool.h"
 
 #include "ObjectBase.hpp"
 #include "EngineMemory.h"
@@ -55,10 +56,7 @@ class DearchiverBase : public ObjectBase<IDearchiver>
 public:
     using TObjectBase = ObjectBase<IDearchiver>;
 
-    DearchiverBase(IReferenceCounters* pRefCounters, const DearchiverCreateInfo& CI) noexcept :
-        TObjectBase{pRefCounters}
-    {
-    }
+    DearchiverBase(IReferenceCounters* pRefCounters, const DearchiverCreateInfo& CI) noexcept;
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_Dearchiver, TObjectBase)
 
@@ -73,6 +71,11 @@ public:
     virtual void DILIGENT_CALL_TYPE UnpackPipelineState(const PipelineStateUnpackInfo& DeArchiveInfo,
                                                         IPipelineState**               ppPSO) override final;
 
+    /// Implementation of IDearchiver::UnpackPipelineStates().
+    virtual void DILIGENT_CALL_TYPE UnpackPipelineStates(const PipelineStateUnpackInfo* pUnpackInfos,
+                                                         Uint32                         NumPSOs,
+                                                         IPipelineState**               ppPSOs) override final;
+
     /// Implementation of IDearchiver::UnpackResourceSignature().
     virtual void DILIGENT_CALL_TYPE UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo,
                                                             IPipelineResourceSignature**       ppSignature) override final;
@@ -207,18 +210,50 @@ private:
                           PSOData<CreateInfoType>& PSO,
                           IRenderDevice*           pDevice);
 
+    // Returns the shader with index Idx from the archive's shader cache, or unpacks it
+    // and adds to the cache.
+    RefCntAutoPtr<IShader> UnpackArchivedShader(ArchiveData&   Archive,
+                                                DeviceType     DevType,
+                                                Uint32         Idx,
+                                                bool           SkipReflection,
+                                                IRenderDevice* pDevice);
+
+    static bool ReadPSOShaderIndices(const DeviceObjectArchive& ObjArchive,
+                                     ResourceType               ResType,
+                                     const char*                Name,
+                                     DeviceType                 DevType,
+                                     std::vector<Uint32>&       Indices);
+
+    // Finds the archive that contains the pipeline and loads the pipeline's common data.
+    template <typename CreateInfoType>
+    ArchiveData* LoadPSOData(const PipelineStateUnpackInfo& UnpackInfo, PSOData<CreateInfoType>& PSO);
+
+    // Unpacks the objects used by the pipeline and creates the pipeline state.
+    template <typename CreateInfoType>
+    void CreatePipelineState(ArchiveData&                   Archive,
+                             PSOData<CreateInfoType>&       PSO,
+                             const PipelineStateUnpackInfo& UnpackInfo,
+                             IPipelineState**               ppPSO);
+
     template <typename CreateInfoType>
     void UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO);
 
+    template <typename CreateInfoType>
+    void UnpackPipelineStatesImpl(const PipelineStateUnpackInfo* pUnpackInfos,
+                                  const std::vector<Uint32>&     PSOIndices,
+                                  IPipelineState**               ppPSOs);
+
     ArchiveData* FindArchive(ResourceType ResType, const char* ResName);
 
 private:
-    // Resource type and name -> archive index that contains this resource.
-    // Names must be unique for each resource type.
     using NamedResourceKey = DeviceObjectArchive::NamedResourceKey;
-    std::unordered_map<NamedResourceKey, size_t, NamedResourceKey::Hasher> m_ResNameToArchiveIdx;
 
+    // Loaded archives. Resources are looked up in the order the archives were loaded.
+    // Names must be unique for each resource type.
     std::vector<ArchiveData> m_Archives;
+
+    // Thread pool that is used to unpack pipeline states in parallel
+    RefCntAutoPtr<IThreadPool> m_pThreadPool;
 };
 
 
@@ -238,18 +273,13 @@ RefCntAutoPtr<IPipelineResourceSignature> DearchiverBase::UnpackResourceSignatur
     }
 
     // Find the archive that contains this signature
-    auto archive_idx_it = m_ResNameToArchiveIdx.find(NamedResourceKey{PRSData::ArchiveResType, DeArchiveInfo.Name});
-    if (archive_idx_it == m_ResNameToArchiveIdx.end())
+    const ArchiveData* pArchiveData = FindArchive(PRSData::ArchiveResType, DeArchiveInfo.Name);
+    if (pArchiveData == nullptr)
         return {};
 
-    const auto& pObjArchive = m_Archives[archive_idx_it->second].pObjArchive;
-    if (!pObjArchive)
-    {
-        UNEXPECTED("Null object archives should never be added to the list. This is a bug.");
-        return {};
-    }
+    const auto& pObjArchive = pArchiveData->pObjArchive;
 
-    PRSData PRS{GetRawAllocator()};
+    PRSData PRS{GetRawAllocator(MEMORY_CATEGORY_ARCHIVE)};
     if (!pObjArchive->LoadResourceCommonData(PRSData::ArchiveResType, DeArchiveInfo.Name, PRS))
         return {};
 
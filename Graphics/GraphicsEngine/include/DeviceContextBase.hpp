@@ -31,9 +31,11 @@
 /// Implementation of the Diligent::DeviceContextBase template class and related structures
 
 #include <unordered_map>
+#include <unordered_set>
 #include <array>
 #include <functional>
 #include <vector>
+#include <chrono>
 
 #include "PrivateConstants.h"
 #include "DeviceContext.h"
@@ -45,10 +47,13 @@
 #include "Cast.hpp"
 #include "GraphicsAccessories.hpp"
 #include "TextureBase.hpp"
+#include "PipelineStateBase.hpp"
 #include "IndexWrapper.hpp"
 #include "BasicMath.hpp"
 #include "PlatformMisc.hpp"
 #include "Align.hpp"
+#include "FrameArena.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
@@ -67,6 +72,7 @@ bool VerifyDispatchComputeIndirectAttribs(const DispatchComputeIndirectAttribs&
 
 bool VerifyDrawMeshAttribs(const MeshShaderProperties& MeshShaderProps, const DrawMeshAttribs& Attribs);
 bool VerifyDrawMeshIndirectAttribs(const DrawMeshIndirectAttribs& Attribs, Uint32 IndirectCmdStride);
+bool VerifyExecuteIndirectCommandsAttribs(const ExecuteIndirectCommandsAttribs& Attribs, const IPipelineState* pPipeline, bool IndexBufferBound);
 
 bool VerifyResolveTextureSubresourceAttribs(const ResolveTextureSubresourceAttribs& ResolveAttribs,
                                             const TextureDesc&                      SrcTexDesc,
@@ -84,6 +90,10 @@ bool VerifyStateTransitionDesc(const IRenderDevice*       pDevice,
 
 bool VerifyBuildBLASAttribs(const BuildBLASAttribs& Attribs, const IRenderDevice* pDevice);
 bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingProperties& RTProps);
+
+// Returns true if the TLAS build described by Attribs must update the existing acceleration structure,
+// and false if it must build it from scratch (see BuildTLASAttribs::RebuildThreshold).
+bool IsTLASUpdate(const BuildTLASAttribs& Attribs);
 bool VerifyCopyBLASAttribs(const IRenderDevice* pDevice, const CopyBLASAttribs& Attribs);
 bool VerifyCopyTLASAttribs(const CopyTLASAttribs& Attribs);
 bool VerifyWriteBLASCompactedSizeAttribs(const IRenderDevice* pDevice, const WriteBLASCompactedSizeAttribs& Attribs);
@@ -188,12 +198,15 @@ public:
 
     /// Base implementation of IDeviceContext::SetVertexBuffers(); validates parameters and
     /// caches references to the buffers.
-    inline virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
-                                                            Uint32                         NumBuffersSet,
-                                                            IBuffer* const*                ppBuffers,
-                                                            const Uint64*                  pOffsets,
-                                                            RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
-                                                            SET_VERTEX_BUFFERS_FLAGS       Flags) override = 0;
+    ///
+    /// \return    true if the vertex streams have changed, and false if the call was redundant.
+    inline bool SetVertexBuffers(Uint32                         StartSlot,
+                                 Uint32                         NumBuffersSet,
+                                 IBuffer* const*                ppBuffers,
+                                 const Uint64*                  pOffsets,
+                                 RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                 SET_VERTEX_BUFFERS_FLAGS       Flags,
+                                 int);
 
     inline virtual void DILIGENT_CALL_TYPE InvalidateState() override = 0;
 
@@ -202,16 +215,23 @@ public:
                                       RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
                                       int);
 
-    /// Base implementation of IDeviceContext::SetIndexBuffer(); caches the strong reference to the index buffer
-    inline virtual void DILIGENT_CALL_TYPE SetIndexBuffer(IBuffer*                       pIndexBuffer,
-                                                          Uint64                         ByteOffset,
-                                                          RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override = 0;
+    /// Base implementation of IDeviceContext::SetIndexBuffer(); caches the strong reference to the index buffer.
+    ///
+    /// \return    true if the index buffer or the offset has changed, and false if the call was redundant.
+    inline bool SetIndexBuffer(IBuffer*                       pIndexBuffer,
+                               Uint64                         ByteOffset,
+                               RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                               int);
 
-    /// Caches the viewports
-    inline void SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32& RTWidth, Uint32& RTHeight);
+    /// Caches the viewports.
+    ///
+    /// \return    true if the viewports or the render target size have changed, and false if the call was redundant.
+    inline bool SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32& RTWidth, Uint32& RTHeight);
 
-    /// Caches the scissor rects
-    inline void SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32& RTWidth, Uint32& RTHeight);
+    /// Caches the scissor rects.
+    ///
+    /// \return    true if the scissor rects or the render target size have changed, and false if the call was redundant.
+    inline bool SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32& RTWidth, Uint32& RTHeight);
 
     virtual void DILIGENT_CALL_TYPE BeginRenderPass(const BeginRenderPassAttribs& Attribs) override = 0;
 
@@ -270,7 +290,7 @@ public:
                                                             Uint32    MipLevel,
                                                             Uint32    ArraySlice) override = 0;
 
-    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView) override = 0;
+    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags) override = 0;
 
     virtual void DILIGENT_CALL_TYPE ResolveTextureSubresource(ITexture*                               pSrcTexture,
                                                               ITexture*                               pDstTexture,
@@ -307,7 +327,11 @@ public:
 
     virtual void DILIGENT_CALL_TYPE ClearStats() override final
     {
-        m_Stats = {};
+        // GPU frame time is updated asynchronously and is not a per-frame accumulator
+        const Uint64 GPUFrameTime = m_Stats.GPUFrameTime;
+
+        m_Stats              = {};
+        m_Stats.GPUFrameTime = GPUFrameTime;
     }
 
     virtual const DeviceContextStats& DILIGENT_CALL_TYPE GetStats() const override final
@@ -349,7 +373,36 @@ public:
         return IsDeferred() ? m_DstImmediateContextId : GetContextId();
     }
 
+    // Returns the flags of the command list being recorded by the deferred context.
+    COMMAND_LIST_FLAGS GetCommandListFlags() const { return m_CommandListFlags; }
+
 protected:
+    /// Adds the CPU time elapsed during the lifetime of the object to the given counter
+    class ScopedCPUTimer
+    {
+    public:
+        explicit ScopedCPUTimer(Uint64& Counter) noexcept :
+            m_Counter{Counter},
+            m_Start{std::chrono::steady_clock::now()}
+        {}
+
+        ~ScopedCPUTimer()
+        {
+            m_Counter += static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Start).count());
+        }
+
+        // clang-format off
+        ScopedCPUTimer           (const ScopedCPUTimer&)  = delete;
+        ScopedCPUTimer           (      ScopedCPUTimer&&) = delete;
+        ScopedCPUTimer& operator=(const ScopedCPUTimer&)  = delete;
+        ScopedCPUTimer& operator=(      ScopedCPUTimer&&) = delete;
+        // clang-format on
+
+    private:
+        Uint64&                                     m_Counter;
+        const std::chrono::steady_clock::time_point m_Start;
+    };
+
     /// Committed shader resources for each resource signature
     struct CommittedShaderResources
     {
@@ -465,7 +518,16 @@ protected:
 
     inline bool SetStencilRef(Uint32 StencilRef, int Dummy);
 
-    inline bool SetPipelineState(IPipelineState* pPipelineState, const INTERFACE_ID& IID_PSOImpl);
+    /// Update m_DynamicStates. Return true if the state has changed and false otherwise.
+    inline bool SetCullMode(CULL_MODE CullMode, int Dummy);
+    inline bool SetDepthState(Bool DepthEnable, Bool DepthWriteEnable, COMPARISON_FUNCTION DepthFunc, int Dummy);
+    inline bool SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology, int Dummy);
+
+    /// If pOldPipeline is not null, the previously bound pipeline is moved into it when the
+    /// pipeline changes, so that the caller can inspect it without extra reference counting.
+    inline bool SetPipelineState(IPipelineState*                       pPipelineState,
+                                 const INTERFACE_ID&                   IID_PSOImpl,
+                                 RefCntAutoPtr<PipelineStateImplType>* pOldPipeline = nullptr);
 
     /// Clears all cached resources
     inline void ClearStateCache();
@@ -483,16 +545,31 @@ protected:
 
     void ClearRenderTarget(ITextureView* pView);
 
+    void InvalidateRenderTargets(Uint32 RenderTargetMask, bool InvalidateDepthStencil);
+
     void BeginQuery(IQuery* pQuery, int);
 
     void EndQuery(IQuery* pQuery, int);
 
+    void BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index, int);
+    void EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index, int);
+    void ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs, int);
+
     void EnqueueSignal(IFence* pFence, Uint64 Value, int);
     void DeviceWaitForFence(IFence* pFence, Uint64 Value, int);
 
+    /// Writes the GPU timestamp for the new frame and reads back the timestamps of the previous frames.
+    /// Immediate contexts call this method at the beginning of Flush(), before the commands are submitted.
+    void UpdateGPUFrameTimer();
+
     void EndFrame()
     {
+        m_GPUFrameTimer.NewFrame = true;
         ++m_FrameNumber;
+        // Temporary allocations made by the engine during this frame may now be recycled
+        FrameArena::FinishFrame();
+        if (!IsDeferred())
+            m_pDevice->ProcessFenceCompletionCallbacks();
     }
 
     void PrepareCommittedResources(CommittedShaderResources& Resources, Uint32& DvpCompatibleSRBCount);
@@ -503,12 +580,13 @@ protected:
         return m_DstImmediateContextId != INVALID_CONTEXT_ID;
     }
 
-    void Begin(DeviceContextIndex ImmediateContextId, COMMAND_QUEUE_TYPE QueueType)
+    void Begin(DeviceContextIndex ImmediateContextId, COMMAND_QUEUE_TYPE QueueType, COMMAND_LIST_FLAGS Flags)
     {
         DEV_CHECK_ERR(IsDeferred(), "Begin() is only allowed for deferred contexts.");
         DEV_CHECK_ERR(!IsRecordingDeferredCommands(), "This context is already recording commands. Call FinishCommandList() before beginning new recording.");
         m_DstImmediateContextId = static_cast<Uint8>(ImmediateContextId);
         VERIFY_EXPR(m_DstImmediateContextId == ImmediateContextId);
+        m_CommandListFlags = Flags;
 
         // Set command queue type while commands are being recorded
         m_Desc.QueueType = QueueType;
@@ -521,6 +599,7 @@ protected:
         DEV_CHECK_ERR(IsDeferred(), "FinishCommandList() is only allowed for deferred contexts.");
         DEV_CHECK_ERR(IsRecordingDeferredCommands(), "This context is not recording commands. Call Begin() before finishing the recording.");
         m_DstImmediateContextId = INVALID_CONTEXT_ID;
+        m_CommandListFlags      = COMMAND_LIST_FLAG_NONE;
         m_Desc.QueueType        = COMMAND_QUEUE_TYPE_UNKNOWN;
         for (size_t i = 0; i < _countof(m_Desc.TextureCopyGranularity); ++i)
             m_Desc.TextureCopyGranularity[i] = 0;
@@ -542,6 +621,10 @@ protected:
     void DvpVerifySRBCompatibility(
         CommittedShaderResources&                                 Resources,
         std::function<PipelineResourceSignatureImplType*(Uint32)> CustomGetSignature = nullptr) const;
+
+    // Returns true if the resources committed for the current draw or dispatch command
+    // must be validated, see EngineCreateInfo::CommandValidationMode.
+    bool DvpIsCommandValidationRequired(const CommittedShaderResources& Resources);
 #else
     // clang-format off
     void DvpVerifyDispatchTileArguments(const DispatchTileAttribs& Attribs) const {}
@@ -559,6 +642,7 @@ protected:
     void DrawIndexed(const DrawIndexedAttribs& Attribs, int);
     void DrawIndirect(const DrawIndirectAttribs& Attribs, int);
     void DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs, int);
+    void ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs, int);
     void DrawMesh(const DrawMeshAttribs& Attribs, int);
     void DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs, int);
     void MultiDraw(const MultiDrawAttribs& Attribs, int);
@@ -619,15 +703,25 @@ protected:
     /// Current blend factors
     Float32 m_BlendFactors[4] = {-1, -1, -1, -1};
 
+    /// Current extended dynamic states. They are reset to the values from the pipeline
+    /// description every time a pipeline with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE is bound.
+    ExtendedDynamicStates m_DynamicStates;
+
     /// Current viewports
     Viewport m_Viewports[MAX_VIEWPORTS];
     /// Number of current viewports
     Uint32 m_NumViewports = 0;
+    /// Render target size the current viewports were set for
+    Uint32 m_ViewportsRTWidth  = 0;
+    Uint32 m_ViewportsRTHeight = 0;
 
     /// Current scissor rects
     Rect m_ScissorRects[MAX_VIEWPORTS];
     /// Number of current scissor rects
     Uint32 m_NumScissorRects = 0;
+    /// Render target size the current scissor rects were set for
+    Uint32 m_ScissorRTWidth  = 0;
+    Uint32 m_ScissorRTHeight = 0;
 
     /// Vector of strong references to the bound render targets.
     /// Use final texture view implementation type to avoid virtual calls to AddRef()/Release()
@@ -679,8 +773,33 @@ protected:
     // will be submitted.
     DeviceContextIndex m_DstImmediateContextId{INVALID_CONTEXT_ID};
 
+    // For deferred contexts in recording state only, the flags
+    // of the command list being recorded.
+    COMMAND_LIST_FLAGS m_CommandListFlags = COMMAND_LIST_FLAG_NONE;
+
     DeviceContextStats m_Stats;
 
+    // Ring of timestamp queries that measure GPU frame time, see UpdateGPUFrameTimer()
+    struct GPUFrameTimer
+    {
+        static constexpr Uint32 NumQueries = 4;
+
+        std::array<RefCntAutoPtr<IQuery>, NumQueries> Queries;
+        // Frame number at which each query was ended
+        std::array<Uint64, NumQueries> QueryFrames{};
+
+        Uint32 NextQuery  = 0;
+        Uint32 NumPending = 0;
+
+        // Counter and frame number of the last timestamp that was read back
+        Uint64 LastCounter = 0;
+        Uint64 LastFrame   = ~Uint64{0};
+
+        bool NewFrame = true;
+        bool Disabled = false;
+    };
+    GPUFrameTimer m_GPUFrameTimer;
+
     std::vector<Uint8> m_ScratchSpace;
 
 #ifdef DILIGENT_DEBUG
@@ -695,6 +814,10 @@ protected:
 #ifdef DILIGENT_DEVELOPMENT
     int    m_DvpDebugGroupCount         = 0;
     size_t m_DvpRenderTargetFormatsHash = 0;
+
+    // Hashes of the PSO and resource cache combinations that have been validated,
+    // see COMMAND_VALIDATION_MODE_FIRST_USE
+    std::unordered_set<size_t> m_DvpValidatedBindings;
 #endif
 };
 
@@ -711,13 +834,14 @@ protected:
     } while (false)
 
 template <typename ImplementationTraits>
-inline void DeviceContextBase<ImplementationTraits>::SetVertexBuffers(
+inline bool DeviceContextBase<ImplementationTraits>::SetVertexBuffers(
     Uint32                         StartSlot,
     Uint32                         NumBuffersSet,
     IBuffer* const*                ppBuffers,
     const Uint64*                  pOffsets,
     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
-    SET_VERTEX_BUFFERS_FLAGS       Flags)
+    SET_VERTEX_BUFFERS_FLAGS       Flags,
+    int)
 {
     DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "SetVertexBuffers");
 
@@ -731,6 +855,31 @@ inline void DeviceContextBase<ImplementationTraits>::SetVertexBuffers(
                   "Resource state transitions are not allowed inside a render pass and may result in an undefined behavior. "
                   "Do not use RESOURCE_STATE_TRANSITION_MODE_TRANSITION or end the render pass first.");
 
+    // Filter out redundant calls that do not change the vertex streams
+    {
+        bool IsRedundant = true;
+        if (Flags & SET_VERTEX_BUFFERS_FLAG_RESET)
+        {
+            // All slots that are not being set must already be empty.
+            // Note that the last stream is never null, see below.
+            IsRedundant = m_NumVertexStreams <= StartSlot + NumBuffersSet;
+            for (Uint32 s = 0; s < StartSlot && IsRedundant; ++s)
+                IsRedundant = !m_VertexStreams[s].pBuffer;
+        }
+        for (Uint32 Buff = 0; Buff < NumBuffersSet && IsRedundant; ++Buff)
+        {
+            const VertexStreamInfo<BufferImplType>& CurrStream{m_VertexStreams[StartSlot + Buff]};
+
+            IBuffer* const pBuffer = ppBuffers ? ppBuffers[Buff] : nullptr;
+            IsRedundant            = (CurrStream.pBuffer.RawPtr() == pBuffer) && (pBuffer == nullptr || CurrStream.Offset == (pOffsets ? pOffsets[Buff] : 0));
+        }
+        if (IsRedundant)
+        {
+            ++m_Stats.RedundantCommandCounters.SetVertexBuffers;
+            return false;
+        }
+    }
+
     if (Flags & SET_VERTEX_BUFFERS_FLAG_RESET)
     {
         // Reset only these buffer slots that are not being set.
@@ -764,12 +913,14 @@ inline void DeviceContextBase<ImplementationTraits>::SetVertexBuffers(
         m_VertexStreams[m_NumVertexStreams--] = VertexStreamInfo<BufferImplType>{};
 
     ++m_Stats.CommandCounters.SetVertexBuffers;
+    return true;
 }
 
 template <typename ImplementationTraits>
 inline bool DeviceContextBase<ImplementationTraits>::SetPipelineState(
-    IPipelineState*     pPipelineState,
-    const INTERFACE_ID& IID_PSOImpl)
+    IPipelineState*                       pPipelineState,
+    const INTERFACE_ID&                   IID_PSOImpl,
+    RefCntAutoPtr<PipelineStateImplType>* pOldPipeline)
 {
     if (pPipelineState == nullptr)
     {
@@ -782,20 +933,40 @@ inline bool DeviceContextBase<ImplementationTraits>::SetPipelineState(
     DEV_CHECK_ERR((pPipelineState->GetDesc().ImmediateContextMask & (Uint64{1} << GetExecutionCtxId())) != 0,
                   "PSO '", pPipelineState->GetDesc().Name, "' can't be used in device context '", m_Desc.Name, "'.");
 
-    // Check that the PSO is ready before querying the implementation.
-    DEV_CHECK_ERR(pPipelineState->GetStatus() == PIPELINE_STATE_STATUS_READY, "PSO '", pPipelineState->GetDesc().Name,
-                  "' is not ready. Use GetStatus() to check the pipeline status.");
+    if (m_pPipelineState != nullptr && static_cast<IPipelineState*>(m_pPipelineState.RawPtr()) == pPipelineState)
+    {
+        // Fast path: the same implementation object is bound again, so there is
+        // no need to query the implementation and touch the reference counters.
+        ++m_Stats.RedundantCommandCounters.SetPipelineState;
+        return false;
+    }
 
     // Note that pPipelineStateImpl may not be the same as pPipelineState (for example, if pPipelineState
-    // is a reloadable pipeline).
+    // is a reloadable pipeline, or an async pipeline that is replaced by its fallback while compiling).
+    // Proxy pipelines do not provide the implementation until it is ready, so the status of the
+    // implementation is checked rather than the status of pPipelineState.
     RefCntAutoPtr<PipelineStateImplType> pPipelineStateImpl{pPipelineState, IID_PSOImpl};
-    VERIFY(pPipelineStateImpl != nullptr, "Unknown pipeline state object implementation");
+    if (!pPipelineStateImpl)
+    {
+        DEV_ERROR("PSO '", pPipelineState->GetDesc().Name, "' is not ready. Use GetStatus() to check the pipeline status.");
+        return false;
+    }
+    DEV_CHECK_ERR(pPipelineStateImpl->GetStatus() == PIPELINE_STATE_STATUS_READY, "PSO '", pPipelineState->GetDesc().Name,
+                  "' is not ready. Use GetStatus() to check the pipeline status.");
     if (PipelineStateImplType::IsSameObject(m_pPipelineState, pPipelineStateImpl))
+    {
+        ++m_Stats.RedundantCommandCounters.SetPipelineState;
         return false;
+    }
 
+    if (pOldPipeline != nullptr)
+        *pOldPipeline = std::move(m_pPipelineState);
     m_pPipelineState = std::move(pPipelineStateImpl);
     ++m_Stats.CommandCounters.SetPipelineState;
 
+    if (m_pPipelineState->HasExtendedDynamicState())
+        m_DynamicStates = ExtendedDynamicStates{m_pPipelineState->GetGraphicsPipelineDesc()};
+
     return true;
 }
 
@@ -813,6 +984,10 @@ inline void DeviceContextBase<ImplementationTraits>::CommitShaderResources(
     DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "pShaderResourceBinding must not be null");
 
     ++m_Stats.CommandCounters.CommitShaderResources;
+
+    // Backends without native inline constants emulate them with dynamic uniform buffers
+    if (ImplementationTraits::DeviceType != RENDER_DEVICE_TYPE_D3D12 && pShaderResourceBinding != nullptr)
+        ClassPtrCast<ShaderResourceBindingImplType>(pShaderResourceBinding)->UpdateInlineConstantBuffers(this);
 }
 
 template <typename ImplementationTraits>
@@ -824,11 +999,18 @@ inline void DeviceContextBase<ImplementationTraits>::InvalidateState()
 }
 
 template <typename ImplementationTraits>
-inline void DeviceContextBase<ImplementationTraits>::SetIndexBuffer(
+inline bool DeviceContextBase<ImplementationTraits>::SetIndexBuffer(
     IBuffer*                       pIndexBuffer,
     Uint64                         ByteOffset,
-    RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+    RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+    int)
 {
+    if (m_pIndexBuffer.RawPtr() == pIndexBuffer && m_IndexDataStartOffset == ByteOffset)
+    {
+        ++m_Stats.RedundantCommandCounters.SetIndexBuffer;
+        return false;
+    }
+
     m_pIndexBuffer         = ClassPtrCast<BufferImplType>(pIndexBuffer);
     m_IndexDataStartOffset = ByteOffset;
 
@@ -848,6 +1030,7 @@ inline void DeviceContextBase<ImplementationTraits>::SetIndexBuffer(
 #endif
 
     ++m_Stats.CommandCounters.SetIndexBuffer;
+    return true;
 }
 
 
@@ -884,6 +1067,8 @@ inline bool DeviceContextBase<ImplementationTraits>::SetBlendFactors(const float
     }
     if (FactorsDiffer)
         ++m_Stats.CommandCounters.SetBlendFactors;
+    else
+        ++m_Stats.RedundantCommandCounters.SetBlendFactors;
 
     return FactorsDiffer;
 }
@@ -899,11 +1084,74 @@ inline bool DeviceContextBase<ImplementationTraits>::SetStencilRef(Uint32 Stenci
         ++m_Stats.CommandCounters.SetStencilRef;
         return true;
     }
+    ++m_Stats.RedundantCommandCounters.SetStencilRef;
     return false;
 }
 
+#define DVP_CHECK_EXTENDED_DYNAMIC_STATE(Name)                                                                                      \
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, Name);                                                          \
+    DEV_CHECK_ERR(m_pDevice->GetDeviceInfo().Features.ExtendedDynamicState, "IDeviceContext::", Name,                               \
+                  ": ExtendedDynamicState feature must be enabled");                                                                \
+    DEV_CHECK_ERR(m_pPipelineState && m_pPipelineState->HasExtendedDynamicState(), "IDeviceContext::", Name,                        \
+                  ": the bound pipeline must have been created with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag. Note that the state " \
+                  "is reset to the value from the pipeline description when the pipeline is bound.")
+
 template <typename ImplementationTraits>
-inline void DeviceContextBase<ImplementationTraits>::SetViewports(
+inline bool DeviceContextBase<ImplementationTraits>::SetCullMode(CULL_MODE CullMode, int)
+{
+    DVP_CHECK_EXTENDED_DYNAMIC_STATE("SetCullMode");
+    DEV_CHECK_ERR(CullMode > CULL_MODE_UNDEFINED && CullMode < CULL_MODE_NUM_MODES, "IDeviceContext::SetCullMode: invalid cull mode");
+
+    if (m_DynamicStates.CullMode == CullMode)
+        return false;
+
+    m_DynamicStates.CullMode = CullMode;
+    return true;
+}
+
+template <typename ImplementationTraits>
+inline bool DeviceContextBase<ImplementationTraits>::SetDepthState(Bool DepthEnable, Bool DepthWriteEnable, COMPARISON_FUNCTION DepthFunc, int)
+{
+    DVP_CHECK_EXTENDED_DYNAMIC_STATE("SetDepthState");
+    DEV_CHECK_ERR(!DepthEnable || (DepthFunc > COMPARISON_FUNC_UNKNOWN && DepthFunc < COMPARISON_FUNC_NUM_FUNCTIONS),
+                  "IDeviceContext::SetDepthState: invalid depth function");
+
+    // Depth writes are disabled when depth test is disabled, see CorrectDepthStencilDesc()
+    const ExtendedDynamicStates& Curr = m_DynamicStates;
+    if (Curr.DepthEnable == (DepthEnable != False) && Curr.DepthWriteEnable == (DepthWriteEnable != False) && Curr.DepthFunc == DepthFunc)
+        return false;
+
+    m_DynamicStates.DepthEnable      = DepthEnable != False;
+    m_DynamicStates.DepthWriteEnable = DepthWriteEnable != False;
+    m_DynamicStates.DepthFunc        = DepthFunc;
+    return true;
+}
+
+template <typename ImplementationTraits>
+inline bool DeviceContextBase<ImplementationTraits>::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology, int)
+{
+    DVP_CHECK_EXTENDED_DYNAMIC_STATE("SetPrimitiveTopology");
+#ifdef DILIGENT_DEVELOPMENT
+    if (m_pPipelineState)
+    {
+        const PRIMITIVE_TOPOLOGY PSOTopology = m_pPipelineState->GetGraphicsPipelineDesc().PrimitiveTopology;
+        DEV_CHECK_ERR(IsDynamicTopologyCompatible(Topology, PSOTopology),
+                      "IDeviceContext::SetPrimitiveTopology: topology ", Uint32{Topology}, " is not compatible with the pipeline topology ",
+                      Uint32{PSOTopology}, ". The topologies must be of the same class (points, lines, triangles or patches with the same number of control points).");
+    }
+#endif
+
+    if (m_DynamicStates.Topology == Topology)
+        return false;
+
+    m_DynamicStates.Topology = Topology;
+    return true;
+}
+
+#undef DVP_CHECK_EXTENDED_DYNAMIC_STATE
+
+template <typename ImplementationTraits>
+inline bool DeviceContextBase<ImplementationTraits>::SetViewports(
     Uint32          NumViewports,
     const Viewport* pViewports,
     Uint32&         RTWidth,
@@ -923,16 +1171,28 @@ inline void DeviceContextBase<ImplementationTraits>::SetViewports(
     }
 
     DEV_CHECK_ERR(NumViewports < MAX_VIEWPORTS, "Number of viewports (", NumViewports, ") exceeds the limit (", MAX_VIEWPORTS, ")");
-    m_NumViewports = (std::min)(MAX_VIEWPORTS, NumViewports);
+    NumViewports = (std::min)(MAX_VIEWPORTS, NumViewports);
 
     Viewport DefaultVP{RTWidth, RTHeight};
     // If no viewports are specified, use default viewport
-    if (m_NumViewports == 1 && pViewports == nullptr)
+    if (NumViewports == 1 && pViewports == nullptr)
     {
         pViewports = &DefaultVP;
     }
     DEV_CHECK_ERR(pViewports != nullptr, "pViewports must not be null");
 
+    // Viewports are transformed using the render target size in some backends (e.g. OpenGL),
+    // so the size must match too.
+    if (m_NumViewports == NumViewports && m_ViewportsRTWidth == RTWidth && m_ViewportsRTHeight == RTHeight &&
+        std::equal(pViewports, pViewports + NumViewports, m_Viewports))
+    {
+        ++m_Stats.RedundantCommandCounters.SetViewports;
+        return false;
+    }
+
+    m_NumViewports      = NumViewports;
+    m_ViewportsRTWidth  = RTWidth;
+    m_ViewportsRTHeight = RTHeight;
     for (Uint32 vp = 0; vp < m_NumViewports; ++vp)
     {
         m_Viewports[vp] = pViewports[vp];
@@ -942,6 +1202,7 @@ inline void DeviceContextBase<ImplementationTraits>::SetViewports(
     }
 
     ++m_Stats.CommandCounters.SetViewports;
+    return true;
 }
 
 template <typename ImplementationTraits>
@@ -956,7 +1217,7 @@ inline void DeviceContextBase<ImplementationTraits>::GetViewports(Uint32& NumVie
 }
 
 template <typename ImplementationTraits>
-inline void DeviceContextBase<ImplementationTraits>::SetScissorRects(
+inline bool DeviceContextBase<ImplementationTraits>::SetScissorRects(
     Uint32      NumRects,
     const Rect* pRects,
     Uint32&     RTWidth,
@@ -976,8 +1237,18 @@ inline void DeviceContextBase<ImplementationTraits>::SetScissorRects(
     }
 
     DEV_CHECK_ERR(NumRects < MAX_VIEWPORTS, "Number of scissor rects (", NumRects, ") exceeds the limit (", MAX_VIEWPORTS, ")");
-    m_NumScissorRects = (std::min)(MAX_VIEWPORTS, NumRects);
+    NumRects = (std::min)(MAX_VIEWPORTS, NumRects);
+
+    if (m_NumScissorRects == NumRects && m_ScissorRTWidth == RTWidth && m_ScissorRTHeight == RTHeight &&
+        std::equal(pRects, pRects + NumRects, m_ScissorRects))
+    {
+        ++m_Stats.RedundantCommandCounters.SetScissorRects;
+        return false;
+    }
 
+    m_NumScissorRects = NumRects;
+    m_ScissorRTWidth  = RTWidth;
+    m_ScissorRTHeight = RTHeight;
     for (Uint32 sr = 0; sr < m_NumScissorRects; ++sr)
     {
         m_ScissorRects[sr] = pRects[sr];
@@ -986,6 +1257,7 @@ inline void DeviceContextBase<ImplementationTraits>::SetScissorRects(
     }
 
     ++m_Stats.CommandCounters.SetScissorRects;
+    return true;
 }
 
 template <typename ImplementationTraits>
@@ -1336,13 +1608,19 @@ inline void DeviceContextBase<ImplementationTraits>::ClearStateCache()
     for (int i = 0; i < 4; ++i)
         m_BlendFactors[i] = -1;
 
+    m_DynamicStates = ExtendedDynamicStates{};
+
     for (Uint32 vp = 0; vp < m_NumViewports; ++vp)
         m_Viewports[vp] = Viewport();
-    m_NumViewports = 0;
+    m_NumViewports      = 0;
+    m_ViewportsRTWidth  = 0;
+    m_ViewportsRTHeight = 0;
 
     for (Uint32 sr = 0; sr < m_NumScissorRects; ++sr)
         m_ScissorRects[sr] = Rect();
     m_NumScissorRects = 0;
+    m_ScissorRTWidth  = 0;
+    m_ScissorRTHeight = 0;
 
     ResetRenderTargets();
 
@@ -1665,6 +1943,94 @@ inline void DeviceContextBase<ImplementationTraits>::ClearRenderTarget(ITextureV
     ++m_Stats.CommandCounters.ClearRenderTarget;
 }
 
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::InvalidateRenderTargets(Uint32 RenderTargetMask, bool InvalidateDepthStencil)
+{
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "InvalidateRenderTargets");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr,
+                  "InvalidateRenderTargets command must not be called inside an explicit render pass. "
+                  "Use attachment load and store operations of the render pass instead.");
+
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        DEV_CHECK_ERR((RenderTargetMask >> m_NumBoundRenderTargets) == 0,
+                      "Render target mask (0x", std::hex, RenderTargetMask, ") references slots that are not bound to the context. "
+                      "The number of bound render targets is ", std::dec, m_NumBoundRenderTargets, ".");
+        for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+        {
+            if ((RenderTargetMask & (1u << rt)) != 0 && m_pBoundRenderTargets[rt] == nullptr)
+                LOG_WARNING_MESSAGE("Render target slot ", rt, " is invalidated, but no render target is bound to this slot.");
+        }
+        if (InvalidateDepthStencil && m_pBoundDepthStencil == nullptr)
+            LOG_WARNING_MESSAGE("Depth-stencil buffer is invalidated, but no depth-stencil view is bound to the context.");
+    }
+#endif
+}
+
+template <typename ImplementationTraits>
+void DeviceContextBase<ImplementationTraits>::UpdateGPUFrameTimer()
+{
+    GPUFrameTimer& Timer = m_GPUFrameTimer;
+    if (!Timer.NewFrame || Timer.Disabled)
+        return;
+    Timer.NewFrame = false;
+
+    if (Timer.Queries[0] == nullptr)
+    {
+        if (IsDeferred() || m_pDevice->GetDeviceInfo().Features.TimestampQueries == DEVICE_FEATURE_STATE_DISABLED)
+        {
+            Timer.Disabled = true;
+            return;
+        }
+
+        for (RefCntAutoPtr<IQuery>& pQuery : Timer.Queries)
+        {
+            QueryDesc Desc;
+            Desc.Name = "Internal GPU frame timer";
+            Desc.Type = QUERY_TYPE_TIMESTAMP;
+            m_pDevice->CreateQuery(Desc, &pQuery);
+            if (!pQuery)
+            {
+                LOG_WARNING_MESSAGE("Failed to create GPU frame timer query. GPU frame time will not be reported by context '", m_Desc.Name, "'.");
+                Timer.Disabled = true;
+                return;
+            }
+        }
+    }
+
+    // Read available timestamps without waiting. The GPU executes commands in order, so the
+    // queries are polled from the oldest one and the first one that is not ready stops the loop.
+    while (Timer.NumPending > 0)
+    {
+        const Uint32 Idx = (Timer.NextQuery + GPUFrameTimer::NumQueries - Timer.NumPending) % GPUFrameTimer::NumQueries;
+
+        QueryDataTimestamp Data;
+        if (!Timer.Queries[Idx]->GetData(&Data, sizeof(Data)))
+            break;
+
+        const bool IsValid = Data.Frequency != 0;
+        if (IsValid && Timer.LastFrame + 1 == Timer.QueryFrames[Idx] && Data.Counter > Timer.LastCounter)
+        {
+            m_Stats.GPUFrameTime = static_cast<Uint64>(static_cast<double>(Data.Counter - Timer.LastCounter) * 1e9 / static_cast<double>(Data.Frequency));
+        }
+        Timer.LastCounter = Data.Counter;
+        Timer.LastFrame   = IsValid ? Timer.QueryFrames[Idx] : ~Uint64{0};
+        --Timer.NumPending;
+    }
+
+    if (Timer.NumPending == GPUFrameTimer::NumQueries)
+    {
+        // The GPU lags behind by more than NumQueries frames - drop the oldest timestamp
+        --Timer.NumPending;
+        Timer.LastFrame = ~Uint64{0};
+    }
+
+    static_cast<DeviceContextImplType*>(this)->EndQuery(Timer.Queries[Timer.NextQuery]);
+    Timer.QueryFrames[Timer.NextQuery] = m_FrameNumber;
+    Timer.NextQuery                    = (Timer.NextQuery + 1) % GPUFrameTimer::NumQueries;
+    ++Timer.NumPending;
+}
+
 template <typename ImplementationTraits>
 inline void DeviceContextBase<ImplementationTraits>::BeginQuery(IQuery* pQuery, int)
 {
@@ -1673,6 +2039,7 @@ inline void DeviceContextBase<ImplementationTraits>::BeginQuery(IQuery* pQuery,
     const QUERY_TYPE QueryType = pQuery->GetDesc().Type;
     DEV_CHECK_ERR(QueryType != QUERY_TYPE_TIMESTAMP,
                   "BeginQuery() is disabled for timestamp queries. Call EndQuery() to set the timestamp.");
+    DEV_CHECK_ERR((m_CommandListFlags & COMMAND_LIST_FLAG_REUSABLE) == 0, "Queries are not allowed in reusable command lists.");
 
     const COMMAND_QUEUE_TYPE QueueType = QueryType == QUERY_TYPE_DURATION ? COMMAND_QUEUE_TYPE_TRANSFER : COMMAND_QUEUE_TYPE_GRAPHICS;
     DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(QueueType, "BeginQuery for query type ", GetQueryTypeString(QueryType));
@@ -1694,6 +2061,59 @@ inline void DeviceContextBase<ImplementationTraits>::EndQuery(IQuery* pQuery, in
     ClassPtrCast<QueryImplType>(pQuery)->OnEndQuery(static_cast<DeviceContextImplType*>(this));
 }
 
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index, int)
+{
+    DEV_CHECK_ERR(pQueryPool != nullptr, "IDeviceContext::BeginPoolQuery: pQueryPool must not be null");
+
+    const QueryPoolDesc& PoolDesc = pQueryPool->GetDesc();
+    DEV_CHECK_ERR(Index < PoolDesc.QueryCount, "IDeviceContext::BeginPoolQuery: query index (", Index,
+                  ") is out of range for pool '", PoolDesc.Name, "' with ", PoolDesc.QueryCount, " queries");
+    DEV_CHECK_ERR(PoolDesc.Type != QUERY_TYPE_TIMESTAMP,
+                  "BeginPoolQuery() is disabled for timestamp queries. Call EndPoolQuery() to set the timestamp.");
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "BeginPoolQuery for query type ", GetQueryTypeString(PoolDesc.Type));
+
+    ++m_Stats.CommandCounters.BeginQuery;
+}
+
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index, int)
+{
+    DEV_CHECK_ERR(pQueryPool != nullptr, "IDeviceContext::EndPoolQuery: pQueryPool must not be null");
+
+    const QueryPoolDesc& PoolDesc = pQueryPool->GetDesc();
+    DEV_CHECK_ERR(Index < PoolDesc.QueryCount, "IDeviceContext::EndPoolQuery: query index (", Index,
+                  ") is out of range for pool '", PoolDesc.Name, "' with ", PoolDesc.QueryCount, " queries");
+
+    const COMMAND_QUEUE_TYPE QueueType = PoolDesc.Type == QUERY_TYPE_TIMESTAMP ? COMMAND_QUEUE_TYPE_COMPUTE : COMMAND_QUEUE_TYPE_GRAPHICS;
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(QueueType, "EndPoolQuery for query type ", GetQueryTypeString(PoolDesc.Type));
+}
+
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs, int)
+{
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_COMPUTE, "ResolvePoolQueries");
+    DEV_CHECK_ERR(Attribs.pQueryPool != nullptr, "IDeviceContext::ResolvePoolQueries: pQueryPool must not be null");
+    DEV_CHECK_ERR(Attribs.pDstBuffer != nullptr, "IDeviceContext::ResolvePoolQueries: pDstBuffer must not be null");
+    DEV_CHECK_ERR(Attribs.QueryCount > 0, "IDeviceContext::ResolvePoolQueries: QueryCount must not be zero");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "IDeviceContext::ResolvePoolQueries: command must be performed outside of render pass");
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        const QueryPoolDesc& PoolDesc = Attribs.pQueryPool->GetDesc();
+        const BufferDesc&    BuffDesc = Attribs.pDstBuffer->GetDesc();
+        DEV_CHECK_ERR(Uint64{Attribs.FirstQuery} + Attribs.QueryCount <= PoolDesc.QueryCount,
+                      "IDeviceContext::ResolvePoolQueries: queries [", Attribs.FirstQuery, ", ", Uint64{Attribs.FirstQuery} + Attribs.QueryCount,
+                      ") are out of range for pool '", PoolDesc.Name, "' with ", PoolDesc.QueryCount, " queries");
+        DEV_CHECK_ERR(Attribs.DstOffset % 8 == 0, "IDeviceContext::ResolvePoolQueries: DstOffset (", Attribs.DstOffset, ") must be a multiple of 8");
+        DEV_CHECK_ERR(Attribs.DstOffset + Uint64{Attribs.QueryCount} * sizeof(Uint64) <= BuffDesc.Size,
+                      "IDeviceContext::ResolvePoolQueries: resolving ", Attribs.QueryCount, " queries at offset ", Attribs.DstOffset,
+                      " overflows buffer '", BuffDesc.Name, "' of size ", BuffDesc.Size);
+        DEV_CHECK_ERR(BuffDesc.Usage == USAGE_DEFAULT || BuffDesc.Usage == USAGE_STAGING,
+                      "IDeviceContext::ResolvePoolQueries: destination buffer '", BuffDesc.Name, "' must be a default or staging buffer");
+    }
+#endif
+}
+
 template <typename ImplementationTraits>
 inline void DeviceContextBase<ImplementationTraits>::EnqueueSignal(IFence* pFence, Uint64 Value, int)
 {
@@ -1720,6 +2140,7 @@ inline void DeviceContextBase<ImplementationTraits>::UpdateBuffer(
     DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_TRANSFER, "UpdateBuffer");
     DEV_CHECK_ERR(pBuffer != nullptr, "Buffer must not be null");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "UpdateBuffer command must be used outside of render pass.");
+    DEV_CHECK_ERR((m_CommandListFlags & COMMAND_LIST_FLAG_REUSABLE) == 0, "UpdateBuffer command is not allowed in reusable command lists.");
 #ifdef DILIGENT_DEVELOPMENT
     {
         const BufferDesc& BuffDesc = ClassPtrCast<BufferImplType>(pBuffer)->GetDesc();
@@ -1766,6 +2187,7 @@ inline void DeviceContextBase<ImplementationTraits>::MapBuffer(
     PVoid&    pMappedData)
 {
     DEV_CHECK_ERR(pBuffer, "pBuffer must not be null");
+    DEV_CHECK_ERR((m_CommandListFlags & COMMAND_LIST_FLAG_REUSABLE) == 0, "Buffers must not be mapped in reusable command lists.");
 
     const BufferDesc& BuffDesc = pBuffer->GetDesc();
 
@@ -1846,6 +2268,7 @@ inline void DeviceContextBase<ImplementationTraits>::UpdateTexture(
     DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_TRANSFER, "UpdateTexture");
     DEV_CHECK_ERR(pTexture != nullptr, "pTexture must not be null");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "UpdateTexture command must be used outside of render pass.");
+    DEV_CHECK_ERR((m_CommandListFlags & COMMAND_LIST_FLAG_REUSABLE) == 0, "UpdateTexture command is not allowed in reusable command lists.");
 
     ValidateUpdateTextureParams(pTexture->GetDesc(), MipLevel, Slice, DstBox, SubresData);
     ++m_Stats.CommandCounters.UpdateTexture;
@@ -1874,6 +2297,7 @@ inline void DeviceContextBase<ImplementationTraits>::MapTextureSubresource(
     MappedTextureSubresource& MappedData)
 {
     DEV_CHECK_ERR(pTexture, "pTexture must not be null");
+    DEV_CHECK_ERR((m_CommandListFlags & COMMAND_LIST_FLAG_REUSABLE) == 0, "Textures must not be mapped in reusable command lists.");
     ValidateMapTextureParams(pTexture->GetDesc(), MipLevel, ArraySlice, MapType, MapFlags, pMapRegion);
     ++m_Stats.CommandCounters.MapTextureSubresource;
 }
@@ -1890,7 +2314,7 @@ inline void DeviceContextBase<ImplementationTraits>::UnmapTextureSubresource(
 }
 
 template <typename ImplementationTraits>
-inline void DeviceContextBase<ImplementationTraits>::GenerateMips(ITextureView* pTexView)
+inline void DeviceContextBase<ImplementationTraits>::GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags)
 {
     DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "GenerateMips");
     DEV_CHECK_ERR(pTexView != nullptr, "pTexView must not be null");
@@ -2387,6 +2811,35 @@ inline void DeviceContextBase<ImplementationTraits>::DrawIndexedIndirect(const D
     ++m_Stats.CommandCounters.DrawIndexedIndirect;
 }
 
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs, int)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Attribs.Flags & DRAW_FLAG_VERIFY_DRAW_ATTRIBS) != 0)
+    {
+        DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "ExecuteIndirectCommands");
+
+        DEV_CHECK_ERR(Attribs.pCounterBuffer == nullptr || (m_pDevice->GetAdapterInfo().DrawCommand.CapFlags & DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER) != 0,
+                      "ExecuteIndirectCommands command arguments are invalid: counter buffer requires DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER capability");
+
+        DEV_CHECK_ERR(m_pPipelineState, "ExecuteIndirectCommands command arguments are invalid: no pipeline state is bound.");
+
+        DEV_CHECK_ERR(m_pPipelineState->GetDesc().PipelineType == PIPELINE_TYPE_GRAPHICS,
+                      "ExecuteIndirectCommands command arguments are invalid: pipeline state '",
+                      m_pPipelineState->GetDesc().Name, "' is not a graphics pipeline.");
+
+        DEV_CHECK_ERR(m_pActiveRenderPass == nullptr ||
+                          (Attribs.ArgsBufferStateTransitionMode != RESOURCE_STATE_TRANSITION_MODE_TRANSITION &&
+                           Attribs.CounterBufferStateTransitionMode != RESOURCE_STATE_TRANSITION_MODE_TRANSITION),
+                      "Resource state transitions are not allowed inside a render pass and may result in an undefined behavior. "
+                      "Do not use RESOURCE_STATE_TRANSITION_MODE_TRANSITION or end the render pass first.");
+
+        DEV_CHECK_ERR(VerifyExecuteIndirectCommandsAttribs(Attribs, m_pPipelineState, m_pIndexBuffer != nullptr), "ExecuteIndirectCommandsAttribs are invalid");
+    }
+#endif
+    ++m_Stats.CommandCounters.DrawIndexedIndirect;
+}
+
 template <typename ImplementationTraits>
 inline void DeviceContextBase<ImplementationTraits>::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs, int)
 {
@@ -2724,6 +3177,45 @@ void DeviceContextBase<ImplementationTraits>::DvpVerifySRBCompatibility(
                       m_pPipelineState->GetDesc().Name, "'.");
     }
 }
+
+template <typename ImplementationTraits>
+bool DeviceContextBase<ImplementationTraits>::DvpIsCommandValidationRequired(const CommittedShaderResources& Resources)
+{
+    switch (m_pDevice->GetCommandValidationMode())
+    {
+        case COMMAND_VALIDATION_MODE_FULL:
+            return true;
+
+        case COMMAND_VALIDATION_MODE_SAMPLED:
+            return (m_FrameNumber % m_pDevice->GetCommandValidationInterval()) == 0;
+
+        case COMMAND_VALIDATION_MODE_FIRST_USE:
+        {
+            if (!m_pPipelineState)
+                return true;
+
+            size_t Hash = ComputeHash(m_pPipelineState->GetUniqueID());
+            const Uint32 SignCount = m_pPipelineState->GetResourceSignatureCount();
+            for (Uint32 i = 0; i < SignCount; ++i)
+            {
+                // Missing SRBs are hashed too, so that the error is reported once for every PSO
+                const ShaderResourceCacheImplType* pCache = Resources.ResourceCaches[i];
+                HashCombine(Hash, pCache != nullptr ? pCache->DvpGetUniqueID() : 0);
+            }
+
+            // Hash collisions may only result in a skipped validation.
+            // Keep the memory bounded for applications that create SRBs every frame.
+            constexpr size_t MaxValidatedBindings = size_t{1} << 16;
+            if (m_DvpValidatedBindings.size() >= MaxValidatedBindings)
+                m_DvpValidatedBindings.clear();
+            return m_DvpValidatedBindings.insert(Hash).second;
+        }
+
+        default:
+            UNEXPECTED("Unexpected command validation mode");
+            return true;
+    }
+}
 #endif // DILIGENT_DEVELOPMENT
 
 #undef DVP_CHECK_QUEUE_TYPE_COMPATIBILITY
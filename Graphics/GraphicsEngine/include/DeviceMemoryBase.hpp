@@ -69,6 +69,10 @@ public:
 
         ValidateDeviceMemoryDesc(this->m_Desc, this->GetDevice());
 
+        if (this->m_Desc.Type == DEVICE_MEMORY_TYPE_PLACED && MemCI.InitialSize != this->m_Desc.PageSize)
+            LOG_ERROR_AND_THROW("Placed device memory is allocated as a single page: InitialSize (", MemCI.InitialSize,
+                                ") must be equal to PageSize (", this->m_Desc.PageSize, ")");
+
         Uint64 DeviceQueuesMask = this->GetDevice()->GetCommandQueueMask();
         DEV_CHECK_ERR((this->m_Desc.ImmediateContextMask & DeviceQueuesMask) != 0,
                       "No bits in the immediate context mask (0x", std::hex, this->m_Desc.ImmediateContextMask,
@@ -32,6 +32,7 @@
 #include <array>
 #include <vector>
 #include <unordered_map>
+#include <functional>
 
 #include "GraphicsTypes.h"
 #include "FileStream.h"
@@ -44,11 +45,21 @@
 
 // Device object archive structure:
 //
-// | Header |  Resource Data  |  Shader Data  |
+// | Header | Resource Index | Shader Index | Resource Names | Resource Data | Shader Data |
+//
+//     | Resource Index | = | NumResources | Entry1 | Entry2 | ... | EntryN |
+//
+//         | EntryI | = | Type | Name Length | Name Offset | Data Offset | Data Size |
+//
+//     | Shader Index | = | OpenGL shader index | D3D11 shader index | ... | Metal-iOS shader index |
+//
+//         | Device shader index | = | NumShaders | Entry1 | Entry2 | ... | EntryN | Compression | Dictionary |
+//
+//             | EntryI | = | Data Offset | Data Size | Uncompressed Size |
 //
 //     |  Resource Data  | = | Res1 | Res2 | ... | ResN |
 //
-//         | ResI | = | Type | Name | Common Data |  OpenGL data | D3D11 data | ...  | Metal-iOS data |
+//         | ResI | = | Common Data |  OpenGL data | D3D11 data | ...  | Metal-iOS data |
 //
 //     |  Shader Data  | =  |  OpenGL shaders | D3D11 shaders | ...  | Metal-iOS shaders |
 //
@@ -56,24 +67,35 @@
 // - Magic number
 // - Archive version
 // - API version
-
-// Resource data contains an array of resources. Each resource contains:
+//
+// Resource index contains one fixed-size entry for every resource. Entries are sorted
+// by resource type and name, so that a resource can be found with a binary search.
+// Each entry contains:
 // - Type (Signature, Graphics Pipeline, Render Pass, etc.)
-// - Name
+// - Offset and length of the null-terminated resource name
+// - Offset and size of the resource data
+//
+// Shader index contains the offset and size of every shader for each device type.
+// Shader data may be compressed with LZ4 using the dictionary that is stored after the
+// device's shader index. Shaders with zero uncompressed size are stored as is.
+//
+// Resource data contains the following data for each resource:
 // - Common data (e.g. a resource description)
 // - Device-specific data (e.g. shader indices)
 //
-// Shader data contains an array of shaders for each device type
+// When an archive is loaded from a data blob, only the index is validated.
+// Resources and shaders are decoded on demand directly from the archive data.
+// Compressed shaders are decompressed every time they are requested.
 //
 //
 // For pipelines, device-specific data is the array of shader indices in the
 // archive's shader array, e.g.:
 //
-// | PsoX | = |   Type   |   Name   |   Common Data   |   OpenGL data   |    D3D11 data   | ...
-//              Graphics   "My PSO"    <Description>        {0, 1}             {1, 2}
-//                                                                  ____________|  |
-//                                                                 |               |
-//                                                                 V               V
+// | PsoX | = |   Common Data   |   OpenGL data   |    D3D11 data   | ...
+//               <Description>        {0, 1}             {1, 2}
+//                                         ____________|  |
+//                                        |               |
+//                                        V               V
 // | GL Shader 0 | GL Shader 1 |  ... | D3D11 Shader 0 | D3D11 Shader 1 | D3D11 Shader 2 | ...
 
 namespace Diligent
@@ -128,7 +150,7 @@ public:
     };
 
     static constexpr Uint32 HeaderMagicNumber = 0xDE00000A;
-    static constexpr Uint32 ArchiveVersion    = 8;
+    static constexpr Uint32 ArchiveVersion    = 14;
 
     struct ArchiveHeader
     {
@@ -141,6 +163,32 @@ public:
         const char* GitHash        = nullptr;
     };
 
+    // Resource index entry. All offsets are relative to the start of the archive.
+    struct ResourceIndexEntry
+    {
+        ResourceType Type       = ResourceType::Undefined;
+        Uint32       NameLength = 0; // Not including the terminating null character
+        Uint64       NameOffset = 0;
+        Uint64       DataOffset = 0;
+        Uint64       DataSize   = 0;
+    };
+
+    // Shader index entry. The offset is relative to the start of the archive.
+    struct ShaderIndexEntry
+    {
+        Uint64 DataOffset       = 0;
+        Uint64 DataSize         = 0;
+        Uint64 UncompressedSize = 0; // Zero if the shader data is not compressed
+    };
+
+    // Shader data compression mode.
+    enum class ShaderCompression : Uint32
+    {
+        None = 0,
+        LZ4,
+        Count
+    };
+
     struct ResourceData
     {
         // Device-agnostic data (e.g. description)
@@ -228,6 +276,9 @@ public:
 public:
     struct CreateInfo
     {
+        /// Archive data. When MakeCopy is false, the archive keeps a reference to the blob
+        /// and reads directly from it, so a memory-mapped blob (see MappedFileStream::GetDataBlob())
+        /// is consumed without copying.
         const IDataBlob* pData          = nullptr;
         Uint32           ContentVersion = ~0u;
         bool             MakeCopy       = false;
@@ -243,8 +294,8 @@ public:
     void Merge(const DeviceObjectArchive& Src) noexcept(false);
 
     bool Deserialize(const CreateInfo& CI) noexcept;
-    void Serialize(IFileStream* pStream) const;
-    void Serialize(IDataBlob** ppDataBlob) const;
+    void Serialize(IFileStream* pStream, ShaderCompression Compression = ShaderCompression::None) const;
+    void Serialize(IDataBlob** ppDataBlob, ShaderCompression Compression = ShaderCompression::None) const;
 
     std::string ToString() const;
 
@@ -253,62 +304,100 @@ public:
                                 const char*      Name,
                                 ReourceDataType& ResData) const
     {
-        auto it = m_NamedResources.find(NamedResourceKey{Type, Name});
-        if (it == m_NamedResources.end())
+        ResourceData Data;
+
+        const char* ArchivedName = FindResource(Type, Name, Data);
+        if (ArchivedName == nullptr)
         {
             LOG_ERROR_MESSAGE("Resource '", Name, "' is not present in the archive");
             return false;
         }
-        VERIFY_EXPR(SafeStrEqual(Name, it->first.GetName()));
-        // Use string copy from the map
-        Name = it->first.GetName();
+        VERIFY_EXPR(SafeStrEqual(Name, ArchivedName));
+        // Use string from the archive
+        Name = ArchivedName;
 
-        Serializer<SerializerMode::Read> Ser{it->second.Common};
+        Serializer<SerializerMode::Read> Ser{Data.Common};
 
         auto Res = ResData.Deserialize(Name, Ser);
         VERIFY_EXPR(Ser.IsEnded());
         return Res;
     }
 
-    const SerializedData& GetDeviceSpecificData(ResourceType Type,
-                                                const char*  Name,
-                                                DeviceType   DevType) const noexcept;
+    /// Finds the resource with the given type and name.
+    /// If the resource is found, returns the pointer to the resource name
+    /// stored in the archive and initializes Data with references to the resource data.
+    /// Otherwise, returns null.
+    const char* FindResource(ResourceType  Type,
+                             const char*   Name,
+                             ResourceData& Data) const noexcept;
+
+    bool HasResource(ResourceType Type, const char* Name) const noexcept;
+
+    /// Calls Handler for every resource in the archive.
+    void ProcessResources(const std::function<void(ResourceType, const char*, const ResourceData&)>& Handler) const;
 
-    ResourceData& GetResourceData(ResourceType Type, const char* Name) noexcept
+    SerializedData GetDeviceSpecificData(ResourceType Type,
+                                         const char*  Name,
+                                         DeviceType   DevType) const noexcept;
+
+    ResourceData& GetResourceData(ResourceType Type, const char* Name) noexcept(false)
     {
+        DecodeIndex();
         constexpr bool MakeCopy = true;
         return m_NamedResources[NamedResourceKey{Type, Name, MakeCopy}];
     }
 
-    auto& GetDeviceShaders(DeviceType Type) noexcept
+    auto& GetDeviceShaders(DeviceType Type) noexcept(false)
     {
+        DecodeIndex();
         return m_DeviceShaders[static_cast<size_t>(Type)];
     }
 
-    const SerializedData& GetSerializedShader(DeviceType Type, size_t Idx) const noexcept
-    {
-        const auto& DeviceShaders = m_DeviceShaders[static_cast<size_t>(Type)];
-        if (Idx < DeviceShaders.size())
-            return DeviceShaders[Idx];
+    size_t GetNumShaders(DeviceType Type) const noexcept;
 
-        static const SerializedData NullData;
-        return NullData;
-    }
-
-    const auto& GetNamedResources() const
-    {
-        return m_NamedResources;
-    }
+    /// Returns the serialized shader data. If the shader is compressed in the archive,
+    /// the returned object owns the decompressed data.
+    SerializedData GetSerializedShader(DeviceType Type, size_t Idx) const noexcept;
 
     void Clear() noexcept;
 
 private:
-    // Named resources
+    // Decodes all resources and shaders from the archive index into
+    // m_NamedResources and m_DeviceShaders so that they can be modified.
+    void DecodeIndex() noexcept(false);
+
+    ResourceIndexEntry GetResourceIndexEntry(size_t Idx) const noexcept;
+    ShaderIndexEntry   GetShaderIndexEntry(DeviceType Type, size_t Idx) const noexcept;
+
+    // Reads the shader data from the archive index and decompresses it, if necessary.
+    SerializedData ReadIndexedShader(DeviceType Type, size_t Idx) const noexcept;
+
+    // Named resources that are not in the archive index
     std::unordered_map<NamedResourceKey, ResourceData, NamedResourceKey::Hasher> m_NamedResources;
 
-    // Shaders
+    // Shaders that are not in the archive index
     std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)> m_DeviceShaders;
 
+    // Index of the archive loaded from the data blob.
+    // Resources and shaders are decoded from the archive data on demand.
+    // Index entries may not be properly aligned and are accessed through GetResourceIndexEntry()
+    // and GetShaderIndexEntry().
+    struct ArchiveIndex
+    {
+        const Uint8* pArchiveData = nullptr;
+        size_t       ArchiveSize  = 0;
+
+        const Uint8* pResources   = nullptr;
+        size_t       NumResources = 0;
+
+        std::array<const Uint8*, static_cast<size_t>(DeviceType::Count)> pShaders{};
+        std::array<size_t, static_cast<size_t>(DeviceType::Count)>       NumShaders{};
+
+        std::array<const Uint8*, static_cast<size_t>(DeviceType::Count)> pShaderDicts{};
+        std::array<size_t, static_cast<size_t>(DeviceType::Count)>       ShaderDictSizes{};
+    };
+    ArchiveIndex m_Index;
+
     // Strong reference to the original data blob.
     // Resources will not make copies and reference this data.
     RefCntAutoPtr<IDataBlob> m_pArchiveData;
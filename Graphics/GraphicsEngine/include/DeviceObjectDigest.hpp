@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of 128-bit digests of device object create infos used for object deduplication
+
+#include <functional>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../interface/Shader.h"
+#include "../interface/PipelineState.h"
+#include "../interface/PipelineResourceSignature.h"
+
+namespace Diligent
+{
+
+/// 128-bit digest of a device object create info.
+struct DeviceObjectDigest
+{
+    Uint64 LowPart  = 0;
+    Uint64 HighPart = 0;
+
+    constexpr bool operator==(const DeviceObjectDigest& RHS) const noexcept
+    {
+        return LowPart == RHS.LowPart && HighPart == RHS.HighPart;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const DeviceObjectDigest& Digest) const noexcept
+        {
+            return static_cast<size_t>(Digest.LowPart ^ (Digest.HighPart * 0x9E3779B97F4A7C15ull));
+        }
+    };
+};
+
+/// Computes the digest of the shader create info.
+
+/// \return     false if the shader can't be deduplicated, e.g. when the source is loaded
+///             through a shader source stream factory whose contents are not known to the device.
+///
+/// Object names are not included in the digest.
+bool ComputeDeviceObjectDigest(const ShaderCreateInfo& ShaderCI, DeviceObjectDigest& Digest) noexcept;
+
+/// Computes the digest of the pipeline state create info.
+
+/// Shaders, resource signatures and render passes are identified by their unique IDs,
+/// so pipelines that use equal, but distinct objects are not deduplicated.
+bool ComputeDeviceObjectDigest(const GraphicsPipelineStateCreateInfo& PSOCreateInfo, DeviceObjectDigest& Digest) noexcept;
+bool ComputeDeviceObjectDigest(const ComputePipelineStateCreateInfo& PSOCreateInfo, DeviceObjectDigest& Digest) noexcept;
+bool ComputeDeviceObjectDigest(const RayTracingPipelineStateCreateInfo& PSOCreateInfo, DeviceObjectDigest& Digest) noexcept;
+bool ComputeDeviceObjectDigest(const TilePipelineStateCreateInfo& PSOCreateInfo, DeviceObjectDigest& Digest) noexcept;
+
+/// Graphics pipeline state subsets that can be compiled independently and linked
+/// into a complete pipeline (see VK_EXT_graphics_pipeline_library).
+enum GRAPHICS_PIPELINE_SUBSET : Uint8
+{
+    GRAPHICS_PIPELINE_SUBSET_VERTEX_INPUT = 0,
+    GRAPHICS_PIPELINE_SUBSET_PRE_RASTERIZATION,
+    GRAPHICS_PIPELINE_SUBSET_FRAGMENT_SHADER,
+    GRAPHICS_PIPELINE_SUBSET_FRAGMENT_OUTPUT,
+    GRAPHICS_PIPELINE_SUBSET_COUNT
+};
+
+/// Computes the digest of the graphics pipeline state subset.
+
+/// Only the members that affect the subset are included, so pipelines that e.g. share
+/// the vertex shader and the rasterizer state have the same pre-rasterization digest.
+bool ComputeDeviceObjectDigest(const GraphicsPipelineStateCreateInfo& PSOCreateInfo, GRAPHICS_PIPELINE_SUBSET Subset, DeviceObjectDigest& Digest) noexcept;
+
+/// Computes the digest of the pipeline resource signature description.
+bool ComputeDeviceObjectDigest(const PipelineResourceSignatureDesc& Desc, DeviceObjectDigest& Digest) noexcept;
+
+} // namespace Diligent
@@ -40,6 +40,8 @@
 #include "RefCntAutoPtr.hpp"
 #include "PlatformDebug.hpp"
 
+#include <chrono>
+
 namespace Diligent
 {
 
@@ -48,6 +50,24 @@ const APIInfo& GetAPIInfo();
 /// Validates engine create info EngineCI and throws an exception in case of an error.
 void VerifyEngineCreateInfo(const EngineCreateInfo& EngineCI, const GraphicsAdapterInfo& AdapterInfo) noexcept(false);
 
+/// Measures the duration of consecutive device initialization stages, see Diligent::RenderDeviceStartupTimes.
+class StartupStageTimer
+{
+public:
+    /// Returns the time in nanoseconds elapsed since the previous call or since the timer was created.
+    Uint64 Lap()
+    {
+        const std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+
+        const Uint64 Elapsed = static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Now - m_LastLap).count());
+        m_LastLap            = Now;
+        return Elapsed;
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_LastLap = std::chrono::steady_clock::now();
+};
+
 /// Template class implementing base functionality of the engine factory
 
 /// \tparam BaseInterface - Base interface that this class will inherit
@@ -127,6 +147,22 @@ public:
         SetRawAllocator(pAllocator);
     }
 
+    virtual void DILIGENT_CALL_TYPE GetMemoryCategoryStats(MEMORY_CATEGORY Category, MemoryCategoryStats& Stats) const override final
+    {
+        if (Category >= MEMORY_CATEGORY_COUNT)
+        {
+            DEV_ERROR("Invalid memory category (", Uint32{Category}, ")");
+            Stats = {};
+            return;
+        }
+        Stats = Diligent::GetMemoryCategoryStats(Category);
+    }
+
+    virtual void DILIGENT_CALL_TYPE SetTraceSink(ITraceSink* pSink) const override final
+    {
+        Diligent::SetTraceSink(pSink);
+    }
+
 protected:
     template <typename DearchiverImplType>
     void CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
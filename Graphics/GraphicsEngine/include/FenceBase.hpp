@@ -61,7 +61,16 @@ public:
     ///							   must not keep a strong reference to the device.
     FenceBase(IReferenceCounters* pRefCounters, RenderDeviceImplType* pDevice, const FenceDesc& Desc, bool bIsDeviceInternal = false) :
         TDeviceObjectBase{pRefCounters, pDevice, Desc, bIsDeviceInternal}
-    {}
+    {
+        if ((this->m_Desc.MiscFlags & MISC_FENCE_FLAG_EXPORTABLE) != 0)
+        {
+            const DeviceFeatures& Features = pDevice->GetFeatures();
+            if (!Features.ExternalMemory || !Features.NativeFence)
+                LOG_ERROR_AND_THROW("Fence '", this->m_Desc.Name, "': MISC_FENCE_FLAG_EXPORTABLE requires ExternalMemory and NativeFence features.");
+            if (this->m_Desc.Type != FENCE_TYPE_GENERAL)
+                LOG_ERROR_AND_THROW("Fence '", this->m_Desc.Name, "': exportable fences must be FENCE_TYPE_GENERAL.");
+        }
+    }
 
     ~FenceBase()
     {
@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::FenceCompletionScheduler class
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#include "RenderDevice.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Executes callbacks when fences reach the requested values, see IRenderDevice::EnqueueFenceCompletionCallback().
+
+/// When the scheduler is created with a worker thread, the thread waits for the pending fences
+/// and executes the callbacks as soon as the fences complete. Backends with native multi-object
+/// waits override WaitForAny() and WakeUp(); the default implementation polls the fences.
+/// Fences that may only be accessed by the immediate context (Direct3D11, OpenGL, WebGPU) use the
+/// scheduler without the thread, and the immediate contexts call ProcessCompleted() at the end of each frame.
+class FenceCompletionScheduler
+{
+public:
+    explicit FenceCompletionScheduler(bool UseWorkerThread) noexcept;
+    virtual ~FenceCompletionScheduler();
+
+    // clang-format off
+    FenceCompletionScheduler           (const FenceCompletionScheduler&)  = delete;
+    FenceCompletionScheduler           (      FenceCompletionScheduler&&) = delete;
+    FenceCompletionScheduler& operator=(const FenceCompletionScheduler&)  = delete;
+    FenceCompletionScheduler& operator=(      FenceCompletionScheduler&&) = delete;
+    // clang-format on
+
+    /// Adds the callback that will be executed when the fence reaches the value.
+    /// The scheduler keeps a strong reference to the fence until the callback is executed.
+    void Enqueue(IFence* pFence, Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData);
+
+    /// Executes the callbacks whose fences have completed.
+    /// Must only be used when the scheduler does not have a worker thread.
+    void ProcessCompleted();
+
+    bool HasWorkerThread() const { return m_UseWorkerThread; }
+
+protected:
+    struct FenceWaitInfo
+    {
+        IFence* pFence = nullptr;
+        Uint64  Value  = 0;
+    };
+
+    /// Blocks the worker thread until at least one of the fences reaches its value or WakeUp() is called.
+    /// Spurious returns are allowed. The default implementation waits for the polling interval.
+    virtual void WaitForAny(const std::vector<FenceWaitInfo>& Fences);
+
+    /// Interrupts WaitForAny() or makes the next call return immediately.
+    virtual void WakeUp();
+
+    /// Stops the worker thread. Derived classes that override WaitForAny() must call this method
+    /// in their destructors before they release the objects used by the wait.
+    void StopWorkerThread();
+
+private:
+    struct PendingCallback
+    {
+        RefCntAutoPtr<IFence>       pFence;
+        Uint64                      Value     = 0;
+        FenceCompletionCallbackType Callback  = nullptr;
+        void*                       pUserData = nullptr;
+    };
+
+    void WorkerThreadProc();
+
+    // Moves the callbacks whose fences have completed to Completed and, if pWaitList is not null,
+    // writes the smallest pending value of every fence to it. m_Mtx must be locked.
+    void ExtractCompleted(std::vector<PendingCallback>& Completed, std::vector<FenceWaitInfo>* pWaitList);
+
+    // Executes and releases the callbacks in Completed.
+    static void RunCallbacks(std::vector<PendingCallback>& Completed);
+
+    const bool m_UseWorkerThread;
+
+    std::mutex                   m_Mtx;
+    std::condition_variable      m_CondVar;
+    std::vector<PendingCallback> m_Pending;
+    std::vector<FenceWaitInfo>   m_CompletedValues;
+    bool                         m_WakeUpRequested = false;
+    bool                         m_Stop            = false;
+
+    std::thread m_WorkerThread;
+};
+
+} // namespace Diligent
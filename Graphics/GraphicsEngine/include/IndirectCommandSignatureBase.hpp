@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Implementation of Diligent::IndirectCommandSignatureBase template class
+
+#include <vector>
+#include <string>
+
+#include "IndirectCommandSignature.h"
+#include "DeviceObjectBase.hpp"
+#include "GraphicsTypes.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Returns the size of the indirect command argument in the arguments buffer, in bytes.
+inline Uint32 GetIndirectCommandArgumentSize(INDIRECT_COMMAND_ARGUMENT_TYPE Type)
+{
+    static_assert(INDIRECT_COMMAND_ARGUMENT_TYPE_COUNT == 6, "Please handle the new argument type below");
+    switch (Type)
+    {
+        // clang-format off
+        case INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW:            return sizeof(Uint32) * 4;
+        case INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW_INDEXED:    return sizeof(Uint32) * 5;
+        case INDIRECT_COMMAND_ARGUMENT_TYPE_CONSTANT_BUFFER: return sizeof(Uint64);
+        case INDIRECT_COMMAND_ARGUMENT_TYPE_VERTEX_BUFFER:   return sizeof(Uint64) + sizeof(Uint32) * 2;
+        case INDIRECT_COMMAND_ARGUMENT_TYPE_INDEX_BUFFER:    return sizeof(Uint64) + sizeof(Uint32) * 2;
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected indirect command argument type");
+            return 0;
+    }
+}
+
+/// Template class implementing base functionality of the indirect command signature object
+
+/// \tparam RenderDeviceImplType - Render device implementation type (RenderDeviceD3D12Impl, RenderDeviceVkImpl, etc.).
+template <typename RenderDeviceImplType>
+class IndirectCommandSignatureBase : public DeviceObjectBase<IIndirectCommandSignature, RenderDeviceImplType, IndirectCommandSignatureDesc>
+{
+public:
+    using TDeviceObjectBase = DeviceObjectBase<IIndirectCommandSignature, RenderDeviceImplType, IndirectCommandSignatureDesc>;
+
+    /// \param pRefCounters - Reference counters object that controls the lifetime of this signature.
+    /// \param pDevice      - Pointer to the device.
+    /// \param Desc         - Indirect command signature description.
+    IndirectCommandSignatureBase(IReferenceCounters*                 pRefCounters,
+                                 RenderDeviceImplType*               pDevice,
+                                 const IndirectCommandSignatureDesc& Desc) :
+        TDeviceObjectBase{pRefCounters, pDevice, Desc},
+        m_pPipeline{Desc.pPipeline}
+    {
+#define LOG_SIGNATURE_ERROR_AND_THROW(...) LOG_ERROR_AND_THROW("Description of indirect command signature '", (Desc.Name ? Desc.Name : ""), "' is invalid: ", ##__VA_ARGS__)
+
+        if ((this->GetDevice()->GetAdapterInfo().DrawCommand.CapFlags & DRAW_COMMAND_CAP_FLAG_INDIRECT_COMMAND_SIGNATURE) == 0)
+            LOG_ERROR_AND_THROW("Indirect command signatures are not supported by this device");
+
+        if (Desc.NumArguments == 0 || Desc.pArguments == nullptr)
+            LOG_SIGNATURE_ERROR_AND_THROW("the signature must contain at least one argument");
+
+        m_Arguments.assign(Desc.pArguments, Desc.pArguments + Desc.NumArguments);
+        m_ArgumentNames.resize(Desc.NumArguments);
+
+        Uint32 VBSlotMask = 0;
+        Uint32 Offset     = 0;
+        for (Uint32 i = 0; i < Desc.NumArguments; ++i)
+        {
+            IndirectCommandArgumentDesc& Arg = m_Arguments[i];
+            switch (Arg.Type)
+            {
+                case INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW:
+                case INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW_INDEXED:
+                    if (i != Desc.NumArguments - 1)
+                        LOG_SIGNATURE_ERROR_AND_THROW("draw argument must be the last argument of the signature");
+                    m_DrawArgumentType = Arg.Type;
+                    m_DrawArgsOffset   = Offset;
+                    break;
+
+                case INDIRECT_COMMAND_ARGUMENT_TYPE_CONSTANT_BUFFER:
+                    if (Arg.Name == nullptr || Arg.Name[0] == '\0')
+                        LOG_SIGNATURE_ERROR_AND_THROW("constant buffer argument ", i, " must specify the variable name");
+                    if (Arg.ShaderStages == SHADER_TYPE_UNKNOWN)
+                        LOG_SIGNATURE_ERROR_AND_THROW("constant buffer argument ", i, " ('", Arg.Name, "') must specify shader stages");
+                    if (Desc.pPipeline == nullptr)
+                        LOG_SIGNATURE_ERROR_AND_THROW("pPipeline must not be null when the signature contains constant buffer arguments");
+                    m_ArgumentNames[i]       = Arg.Name;
+                    Arg.Name                 = m_ArgumentNames[i].c_str();
+                    m_ChangesConstantBuffers = true;
+                    break;
+
+                case INDIRECT_COMMAND_ARGUMENT_TYPE_VERTEX_BUFFER:
+                    if (Arg.Slot >= MAX_BUFFER_SLOTS)
+                        LOG_SIGNATURE_ERROR_AND_THROW("vertex buffer slot (", Arg.Slot, ") of argument ", i, " exceeds the maximum allowed value (", MAX_BUFFER_SLOTS - 1, ")");
+                    if ((VBSlotMask & (1u << Arg.Slot)) != 0)
+                        LOG_SIGNATURE_ERROR_AND_THROW("vertex buffer slot ", Arg.Slot, " is used by more than one argument");
+                    VBSlotMask |= 1u << Arg.Slot;
+                    m_ChangesInputBuffers = true;
+                    break;
+
+                case INDIRECT_COMMAND_ARGUMENT_TYPE_INDEX_BUFFER:
+                    if (m_HasIndexBufferArgument)
+                        LOG_SIGNATURE_ERROR_AND_THROW("the signature must not contain more than one index buffer argument");
+                    m_HasIndexBufferArgument = true;
+                    m_ChangesInputBuffers    = true;
+                    break;
+
+                default:
+                    LOG_SIGNATURE_ERROR_AND_THROW("argument ", i, " has invalid type");
+            }
+            Offset += GetIndirectCommandArgumentSize(Arg.Type);
+        }
+
+        if (m_DrawArgumentType == INDIRECT_COMMAND_ARGUMENT_TYPE_UNDEFINED)
+            LOG_SIGNATURE_ERROR_AND_THROW("the last argument must be a draw argument");
+        if (m_HasIndexBufferArgument && m_DrawArgumentType != INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW_INDEXED)
+            LOG_SIGNATURE_ERROR_AND_THROW("index buffer argument can only be used with indexed draw argument");
+
+        if (Desc.pPipeline != nullptr && Desc.pPipeline->GetDesc().PipelineType != PIPELINE_TYPE_GRAPHICS)
+            LOG_SIGNATURE_ERROR_AND_THROW("pipeline '", Desc.pPipeline->GetDesc().Name, "' is not a graphics pipeline");
+
+        if (Desc.ByteStride == 0)
+        {
+            this->m_Desc.ByteStride = Offset;
+        }
+        else
+        {
+            if (Desc.ByteStride % 4 != 0)
+                LOG_SIGNATURE_ERROR_AND_THROW("ByteStride (", Desc.ByteStride, ") must be a multiple of 4");
+            if (Desc.ByteStride < Offset)
+                LOG_SIGNATURE_ERROR_AND_THROW("ByteStride (", Desc.ByteStride, ") is smaller than the size of the command arguments (", Offset, ")");
+        }
+
+#undef LOG_SIGNATURE_ERROR_AND_THROW
+
+        this->m_Desc.pArguments = m_Arguments.data();
+    }
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IndirectCommandSignature, TDeviceObjectBase)
+
+    /// Implementation of IIndirectCommandSignature::GetCommandStride().
+    virtual Uint32 DILIGENT_CALL_TYPE GetCommandStride() const override final
+    {
+        return this->m_Desc.ByteStride;
+    }
+
+    /// Returns the type of the draw argument of the signature.
+    INDIRECT_COMMAND_ARGUMENT_TYPE GetDrawArgumentType() const { return m_DrawArgumentType; }
+
+    /// Returns the offset of the draw arguments from the beginning of the command, in bytes.
+    Uint32 GetDrawArgsOffset() const { return m_DrawArgsOffset; }
+
+    /// Returns true if the signature contains an index buffer argument.
+    bool HasIndexBufferArgument() const { return m_HasIndexBufferArgument; }
+
+    /// Returns true if the signature contains vertex or index buffer arguments.
+    bool ChangesInputBuffers() const { return m_ChangesInputBuffers; }
+
+    /// Returns true if the signature contains constant buffer arguments.
+    bool ChangesConstantBuffers() const { return m_ChangesConstantBuffers; }
+
+protected:
+    // The pipeline must be kept alive as the signature may reference its root signature
+    RefCntAutoPtr<IPipelineState> m_pPipeline;
+
+    std::vector<IndirectCommandArgumentDesc> m_Arguments;
+    std::vector<std::string>                 m_ArgumentNames;
+
+    INDIRECT_COMMAND_ARGUMENT_TYPE m_DrawArgumentType       = INDIRECT_COMMAND_ARGUMENT_TYPE_UNDEFINED;
+    Uint32                         m_DrawArgsOffset         = 0;
+    bool                           m_HasIndexBufferArgument = false;
+    bool                           m_ChangesInputBuffers    = false;
+    bool                           m_ChangesConstantBuffers = false;
+};
+
+} // namespace Diligent
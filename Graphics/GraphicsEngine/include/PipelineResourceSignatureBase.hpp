@@ -43,9 +43,11 @@
 #include "DeviceObjectBase.hpp"
 #include "RenderDeviceBase.hpp"
 #include "FixedLinearAllocator.hpp"
+#include "ResourceNameRegistry.hpp"
 #include "BasicMath.hpp"
 #include "StringTools.hpp"
 #include "PlatformMisc.hpp"
+#include "Align.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "ShaderResourceCacheCommon.hpp"
 #include "HashUtils.hpp"
@@ -318,6 +320,23 @@ private:
     // NB: when adding new members, don't forget to update move ctor!
 };
 
+/// Attributes of a resource with PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS flag.
+struct InlineConstantsAttribs
+{
+    /// Index of the resource in m_Desc.Resources[].
+    Uint32 ResIndex = 0;
+
+    /// Offset of the first constant in the inline constant storage of the SRB resource cache.
+    Uint32 Offset = 0;
+
+    /// The number of 32-bit constants.
+    Uint32 NumConstants = 0;
+
+    /// Dynamic uniform buffer that emulates inline constants in backends that do
+    /// not support them natively (null in Direct3D12 or when there is no device).
+    RefCntAutoPtr<IBuffer> pBuffer;
+};
+
 /// Template class implementing base functionality of the pipeline resource signature object.
 
 /// \tparam EngineImplTraits - Engine implementation type traits.
@@ -371,7 +390,7 @@ public:
                                   bool                                 bIsDeviceInternal = false) :
         TDeviceObjectBase{pRefCounters, pDevice, Desc, bIsDeviceInternal},
         m_ShaderStages{ShaderStages},
-        m_SRBMemAllocator{GetRawAllocator()}
+        m_SRBMemAllocator{GetSRBCacheRawAllocator(pDevice)}
     {
         // Don't read from m_Desc until it was allocated and copied in CopyPipelineResourceSignatureDesc()
         this->m_Desc.Resources             = nullptr;
@@ -419,7 +438,7 @@ public:
         m_StaticResShaderStages{InternalData.StaticResShaderStages},
         m_PipelineType         {InternalData.PipelineType},
         m_StaticResStageIndex  {InternalData.StaticResStageIndex},
-        m_SRBMemAllocator      {GetRawAllocator()}
+        m_SRBMemAllocator      {GetSRBCacheRawAllocator(pDevice)}
     // clang-format on
     {
         // Don't read from m_Desc until it was allocated and copied in CopyPipelineResourceSignatureDesc()
@@ -539,6 +558,35 @@ public:
         pResBindingImpl->QueryInterface(IID_ShaderResourceBinding, reinterpret_cast<IObject**>(ppShaderResourceBinding));
     }
 
+    /// Implementation of IPipelineResourceSignature::CreateShaderResourceBindings.
+    virtual void DILIGENT_CALL_TYPE CreateShaderResourceBindings(Uint32                   NumSRBs,
+                                                                 IShaderResourceBinding** ppSRBs,
+                                                                 bool                     InitStaticResources) override final
+    {
+        if (NumSRBs == 0)
+            return;
+
+        if (ppSRBs == nullptr)
+        {
+            DEV_ERROR("ppSRBs must not be null");
+            return;
+        }
+
+        PipelineResourceSignatureImplType* pThisImpl{static_cast<PipelineResourceSignatureImplType*>(this)};
+        FixedBlockMemoryAllocator&         SRBAllocator{pThisImpl->GetDevice()->GetSRBAllocator()};
+        // Create all objects in one go so that SRBs and their resource caches occupy
+        // consecutive blocks of the fixed-block allocators.
+        for (Uint32 i = 0; i < NumSRBs; ++i)
+        {
+            DEV_CHECK_ERR(ppSRBs[i] == nullptr, "Overwriting existing shader resource binding pointer at index ", i, " may cause memory leaks.");
+
+            ShaderResourceBindingImplType* pResBindingImpl{NEW_RC_OBJ(SRBAllocator, "ShaderResourceBinding instance", ShaderResourceBindingImplType)(pThisImpl)};
+            if (InitStaticResources)
+                pThisImpl->InitializeStaticSRBResources(pResBindingImpl);
+            pResBindingImpl->QueryInterface(IID_ShaderResourceBinding, reinterpret_cast<IObject**>(ppSRBs + i));
+        }
+    }
+
     /// Implementation of IPipelineResourceSignature::InitializeStaticSRBResources.
     virtual void DILIGENT_CALL_TYPE InitializeStaticSRBResources(IShaderResourceBinding* pSRB) const override final
     {
@@ -708,6 +756,36 @@ public:
         return m_pResourceAttribs[ResIndex];
     }
 
+    // Returns the ID of the resource name interned in ResourceNameRegistry
+    Uint32 GetResourceNameId(Uint32 ResIndex) const
+    {
+        VERIFY_EXPR(ResIndex < this->m_Desc.NumResources);
+        return m_pResourceNameIds[ResIndex];
+    }
+
+    Uint32 GetInlineConstantsCount() const { return m_NumInlineConstantResources; }
+
+    const InlineConstantsAttribs& GetInlineConstantsAttribs(Uint32 Index) const
+    {
+        VERIFY_EXPR(Index < m_NumInlineConstantResources);
+        return m_pInlineConstants[Index];
+    }
+
+    // Returns the attributes of the inline constants resource with the given index in m_Desc.Resources[].
+    const InlineConstantsAttribs& GetInlineConstantsAttribsByResIndex(Uint32 ResIndex) const
+    {
+        for (Uint32 i = 0; i < m_NumInlineConstantResources; ++i)
+        {
+            if (m_pInlineConstants[i].ResIndex == ResIndex)
+                return m_pInlineConstants[i];
+        }
+        UNEXPECTED("Resource ", ResIndex, " is not an inline constants resource");
+        return m_pInlineConstants[0];
+    }
+
+    // Returns the total number of 32-bit inline constants in all resources of this signature.
+    Uint32 GetTotalInlineConstantCount() const { return m_TotalInlineConstantCount; }
+
     const ImmutableSamplerAttribsType& GetImmutableSamplerAttribs(Uint32 SampIndex) const
     {
         VERIFY_EXPR(SampIndex < this->m_Desc.NumImmutableSamplers);
@@ -737,6 +815,16 @@ public:
         return m_SRBMemAllocator;
     }
 
+private:
+    // Serialization signatures are created without a device
+    static IMemoryAllocator& GetSRBCacheRawAllocator(RenderDeviceImplType* pDevice)
+    {
+        return pDevice != nullptr ?
+            pDevice->GetCategoryAllocator(MEMORY_CATEGORY_SRB_CACHE) :
+            GetRawAllocator(MEMORY_CATEGORY_SRB_CACHE);
+    }
+
+public:
     // Processes resources with the allowed variable types in the allowed shader stages
     // and calls user-provided handler for each resource.
     template <typename HandlerType>
@@ -805,6 +893,7 @@ protected:
         ReserveSpaceForPipelineResourceSignatureDesc(Allocator, Desc);
 
         Allocator.AddSpace<PipelineResourceAttribsType>(Desc.NumResources);
+        Allocator.AddSpace<Uint32>(Desc.NumResources);
 
         const Uint32 NumStaticResStages = GetNumStaticResStages();
         if (NumStaticResStages > 0)
@@ -819,6 +908,13 @@ protected:
             Allocator.AddSpace<RefCntAutoPtr<SamplerImplType>>(Desc.NumImmutableSamplers);
         }
 
+        for (Uint32 i = 0; i < Desc.NumResources; ++i)
+        {
+            if ((Desc.Resources[i].Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0)
+                ++m_NumInlineConstantResources;
+        }
+        Allocator.AddSpace<InlineConstantsAttribs>(m_NumInlineConstantResources);
+
         Allocator.Reserve();
         // The memory is now owned by PipelineResourceSignatureBase and will be freed by Destruct().
         m_pRawMemory = decltype(m_pRawMemory){Allocator.ReleaseOwnership(), STDDeleterRawMem<void>{RawAllocator}};
@@ -842,6 +938,14 @@ protected:
             AllocResourceAttribs(Allocator) :
             Allocator.Allocate<PipelineResourceAttribsType>(Desc.NumResources);
 
+        // Intern resource names so that resources can be bound from resource mappings without string hashing
+        m_pResourceNameIds = Allocator.Allocate<Uint32>(Desc.NumResources);
+        {
+            ResourceNameRegistry& NameRegistry = ResourceNameRegistry::Get();
+            for (Uint32 i = 0; i < Desc.NumResources; ++i)
+                m_pResourceNameIds[i] = NameRegistry.Intern(this->m_Desc.Resources[i].Name);
+        }
+
         if (NumStaticResStages > 0)
         {
             m_pStaticResCache = Allocator.Construct<ShaderResourceCacheImplType>(ResourceCacheContentType::Signature);
@@ -870,6 +974,9 @@ protected:
             }
         }
 
+        if (m_NumInlineConstantResources > 0)
+            InitInlineConstants(Allocator);
+
         InitResourceLayout();
 
         PipelineResourceSignatureImplType* const pThisImpl = static_cast<PipelineResourceSignatureImplType*>(this);
@@ -1004,6 +1111,7 @@ protected:
 
         static_assert(std::is_trivially_destructible<PipelineResourceAttribsType>::value, "Destructors for m_pResourceAttribs[] are required");
         m_pResourceAttribs = nullptr;
+        m_pResourceNameIds = nullptr;
         static_assert(std::is_trivially_destructible<ImmutableSamplerAttribsType>::value, "Destructors for m_pImmutableSamplerAttribs[] are required");
         m_pImmutableSamplerAttribs = nullptr;
 
@@ -1013,6 +1121,13 @@ protected:
                 m_pImmutableSamplers[i].~RefCntAutoPtr<SamplerImplType>();
         }
 
+        if (m_pInlineConstants != nullptr)
+        {
+            for (Uint32 i = 0; i < m_NumInlineConstantResources; ++i)
+                m_pInlineConstants[i].~InlineConstantsAttribs();
+            m_pInlineConstants = nullptr;
+        }
+
         m_pRawMemory.reset();
 
 #if DILIGENT_DEBUG
@@ -1020,6 +1135,48 @@ protected:
 #endif
     }
 
+    void InitInlineConstants(FixedLinearAllocator& Allocator)
+    {
+        m_pInlineConstants = Allocator.ConstructArray<InlineConstantsAttribs>(m_NumInlineConstantResources);
+
+        // Direct3D12 sets inline constants directly in the root signature; other backends
+        // bind an internal dynamic uniform buffer that is updated when the SRB is committed.
+        constexpr bool EmulateInlineConstants = EngineImplTraits::DeviceType != RENDER_DEVICE_TYPE_D3D12;
+
+        Uint32 InlineCBIdx = 0;
+        for (Uint32 i = 0; i < this->m_Desc.NumResources; ++i)
+        {
+            const PipelineResourceDesc& ResDesc = this->m_Desc.Resources[i];
+            if ((ResDesc.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) == 0)
+                continue;
+
+            VERIFY(ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_STATIC,
+                   "Static inline constants are not allowed. This error should've been caught by ValidatePipelineResourceSignatureDesc().");
+
+            InlineConstantsAttribs& InlineCB = m_pInlineConstants[InlineCBIdx++];
+            InlineCB.ResIndex                = i;
+            InlineCB.Offset                  = m_TotalInlineConstantCount;
+            InlineCB.NumConstants            = ResDesc.ArraySize;
+            m_TotalInlineConstantCount += ResDesc.ArraySize;
+
+            if (EmulateInlineConstants && this->HasDevice())
+            {
+                const std::string BuffName = std::string{"Inline constants '"} + ResDesc.Name + "' of signature '" + this->m_Desc.Name + "'";
+
+                BufferDesc CBDesc;
+                CBDesc.Name           = BuffName.c_str();
+                CBDesc.Size           = AlignUp(Uint64{ResDesc.ArraySize} * sizeof(Uint32), Uint64{16});
+                CBDesc.Usage          = USAGE_DYNAMIC;
+                CBDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+                CBDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+                this->GetDevice()->CreateBuffer(CBDesc, nullptr, &InlineCB.pBuffer);
+                if (!InlineCB.pBuffer)
+                    LOG_ERROR_AND_THROW("Failed to create the buffer for inline constants '", ResDesc.Name, "'.");
+            }
+        }
+        VERIFY_EXPR(InlineCBIdx == m_NumInlineConstantResources);
+    }
+
     // Finds a sampler that is assigned to texture Tex, when combined texture samplers are used.
     // Returns an index of the sampler in m_Desc.Resources array, or InvalidSamplerValue if there is
     // no such sampler, or if combined samplers are not used.
@@ -1067,6 +1224,9 @@ protected:
     // Pipeline resource attributes
     PipelineResourceAttribsType* m_pResourceAttribs = nullptr; // [m_Desc.NumResources]
 
+    // Resource name IDs interned in ResourceNameRegistry
+    Uint32* m_pResourceNameIds = nullptr; // [m_Desc.NumResources]
+
     // Immutable sampler attributes
     ImmutableSamplerAttribsType* m_pImmutableSamplerAttribs = nullptr; // [m_Desc.NumImmutableSamplers]
 
@@ -1079,6 +1239,11 @@ protected:
     // Static variables manager for every shader stage
     ShaderVariableManagerImplType* m_StaticVarsMgrs = nullptr; // [GetNumStaticResStages()]
 
+    InlineConstantsAttribs* m_pInlineConstants = nullptr; // [m_NumInlineConstantResources]
+
+    Uint32 m_NumInlineConstantResources = 0;
+    Uint32 m_TotalInlineConstantCount   = 0;
+
     size_t m_Hash = 0;
 
     // Resource offsets (e.g. index of the first resource), for each variable type.
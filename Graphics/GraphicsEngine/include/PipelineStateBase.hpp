@@ -48,6 +48,7 @@
 #include "RefCntAutoPtr.hpp"
 #include "AsyncInitializer.hpp"
 #include "GraphicsTypesX.hpp"
+#include "Timer.hpp"
 
 namespace Diligent
 {
@@ -77,6 +78,79 @@ struct PSOCreateInternalInfo
     PSO_CREATE_INTERNAL_FLAGS Flags = PSO_CREATE_INTERNAL_FLAG_NONE;
 };
 
+/// Graphics states that are dynamic in pipelines created with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE.
+struct ExtendedDynamicStates
+{
+    CULL_MODE           CullMode         = CULL_MODE_BACK;
+    COMPARISON_FUNCTION DepthFunc        = COMPARISON_FUNC_LESS;
+    PRIMITIVE_TOPOLOGY  Topology         = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    bool                DepthEnable      = true;
+    bool                DepthWriteEnable = true;
+
+    constexpr ExtendedDynamicStates() noexcept {}
+
+    /// Initializes the states from the pipeline description.
+    explicit ExtendedDynamicStates(const GraphicsPipelineDesc& Desc) noexcept :
+        CullMode{Desc.RasterizerDesc.CullMode},
+        DepthFunc{Desc.DepthStencilDesc.DepthFunc},
+        Topology{Desc.PrimitiveTopology},
+        DepthEnable{Desc.DepthStencilDesc.DepthEnable},
+        DepthWriteEnable{Desc.DepthStencilDesc.DepthWriteEnable}
+    {}
+
+    constexpr bool operator==(const ExtendedDynamicStates& RHS) const noexcept
+    {
+        return (CullMode == RHS.CullMode &&
+                DepthFunc == RHS.DepthFunc &&
+                Topology == RHS.Topology &&
+                DepthEnable == RHS.DepthEnable &&
+                DepthWriteEnable == RHS.DepthWriteEnable);
+    }
+    constexpr bool operator!=(const ExtendedDynamicStates& RHS) const noexcept
+    {
+        return !(*this == RHS);
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const ExtendedDynamicStates& States) const noexcept
+        {
+            return ComputeHash(States.CullMode, States.DepthFunc, States.Topology, States.DepthEnable, States.DepthWriteEnable);
+        }
+    };
+};
+
+/// Returns true if the topologies are of the same class (points, lines, triangles, or patches
+/// with the same number of control points), so that one can dynamically replace the other.
+inline bool IsDynamicTopologyCompatible(PRIMITIVE_TOPOLOGY Topology1, PRIMITIVE_TOPOLOGY Topology2) noexcept
+{
+    auto GetTopologyClass = [](PRIMITIVE_TOPOLOGY Topology) -> Uint32 {
+        static_assert(PRIMITIVE_TOPOLOGY_NUM_TOPOLOGIES == 42, "Please update the switch below to handle the new primitive topology");
+        switch (Topology)
+        {
+            case PRIMITIVE_TOPOLOGY_POINT_LIST:
+                return 0;
+
+            case PRIMITIVE_TOPOLOGY_LINE_LIST:
+            case PRIMITIVE_TOPOLOGY_LINE_STRIP:
+            case PRIMITIVE_TOPOLOGY_LINE_LIST_ADJ:
+            case PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ:
+                return 1;
+
+            case PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+            case PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+            case PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_ADJ:
+            case PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ:
+                return 2;
+
+            default:
+                // Every patch list is its own class
+                return 3 + static_cast<Uint32>(Topology);
+        }
+    };
+    return Topology1 != PRIMITIVE_TOPOLOGY_UNDEFINED && GetTopologyClass(Topology1) == GetTopologyClass(Topology2);
+}
+
 template <typename PSOCreateInfoType>
 void ValidatePSOCreateInfo(const IRenderDevice*     pDevice,
                            const PSOCreateInfoType& CreateInfo) noexcept(false);
@@ -526,6 +600,12 @@ public:
         return m_pGraphicsPipelineData->Desc;
     }
 
+    /// Returns true if the pipeline was created with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE.
+    bool HasExtendedDynamicState() const
+    {
+        return this->m_Desc.IsAnyGraphicsPipeline() && m_pGraphicsPipelineData != nullptr && m_pGraphicsPipelineData->HasExtendedDynamicState;
+    }
+
     virtual const RayTracingPipelineDesc& DILIGENT_CALL_TYPE GetRayTracingPipelineDesc() const override final
     {
         CheckPipelineReady();
@@ -591,6 +671,31 @@ public:
         return this->GetResourceSignature(0)->CreateShaderResourceBinding(ppShaderResourceBinding, InitStaticResources);
     }
 
+    virtual void DILIGENT_CALL_TYPE CreateShaderResourceBindings(Uint32                   NumSRBs,
+                                                                 IShaderResourceBinding** ppSRBs,
+                                                                 bool                     InitStaticResources) override final
+    {
+        if (NumSRBs == 0)
+            return;
+
+        if (ppSRBs == nullptr)
+        {
+            DEV_ERROR("ppSRBs must not be null");
+            return;
+        }
+
+        CheckPipelineReady();
+
+        if (!m_UsingImplicitSignature)
+        {
+            LOG_ERROR_MESSAGE("IPipelineState::CreateShaderResourceBindings is not allowed for pipelines that use explicit "
+                              "resource signatures. Use IPipelineResourceSignature::CreateShaderResourceBindings instead.");
+            return;
+        }
+
+        return this->GetResourceSignature(0)->CreateShaderResourceBindings(NumSRBs, ppSRBs, InitStaticResources);
+    }
+
     virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetStaticVariableByName(SHADER_TYPE ShaderType,
                                                                                 const Char* Name) override final
     {
@@ -769,6 +874,12 @@ public:
         return m_Status.load();
     }
 
+    /// Implementation of IPipelineState::GetCompileStats().
+    virtual const PipelineStateCompileStats& DILIGENT_CALL_TYPE GetCompileStats() const override final
+    {
+        return m_CompileStats;
+    }
+
     SHADER_TYPE GetActiveShaderStages() const
     {
         return m_ActiveShaderStages;
@@ -907,7 +1018,7 @@ protected:
 #endif
                     try
                     {
-                        pThisImpl->InitializePipeline(CreateInfo);
+                        pThisImpl->InitializePipelineAndRecordStats(CreateInfo);
                         pThisImpl->m_Status.store(PIPELINE_STATE_STATUS_READY);
                     }
                     catch (...)
@@ -923,7 +1034,7 @@ protected:
         {
             try
             {
-                pThisImpl->InitializePipeline(CreateInfo);
+                InitializePipelineAndRecordStats(CreateInfo);
                 m_Status.store(PIPELINE_STATE_STATUS_READY);
             }
             catch (...)
@@ -934,6 +1045,36 @@ protected:
         }
     }
 
+    template <typename PSOCreateInfoType>
+    void InitializePipelineAndRecordStats(const PSOCreateInfoType& CreateInfo)
+    {
+        Timer InitTimer;
+        static_cast<PipelineStateImplType*>(this)->InitializePipeline(CreateInfo);
+        if (!m_CompileStatsSet)
+        {
+            // The backend does not time the pipeline object creation, so use the total initialization time.
+            SetCompileStats(PIPELINE_CACHE_STATUS_UNKNOWN, static_cast<Uint64>(InitTimer.GetElapsedTime() * 1e+6));
+        }
+    }
+
+    /// Sets the compile statistics of the pipeline and adds them to the device-wide statistics.
+    /// Must be called by the backend from InitializePipeline() at most once.
+    void SetCompileStats(PIPELINE_CACHE_STATUS                  CacheStatus,
+                         Uint64                                 Duration,
+                         std::vector<PipelineStageCompileStats> Stages = {})
+    {
+        VERIFY(!m_CompileStatsSet, "Compile statistics have already been set");
+        m_StageCompileStats = std::move(Stages);
+
+        m_CompileStats.Duration    = Duration;
+        m_CompileStats.CacheStatus = CacheStatus;
+        m_CompileStats.NumStages   = static_cast<Uint32>(m_StageCompileStats.size());
+        m_CompileStats.pStages     = !m_StageCompileStats.empty() ? m_StageCompileStats.data() : nullptr;
+        m_CompileStatsSet          = true;
+
+        this->m_pDevice->RecordPipelineCompileStats(m_CompileStats);
+    }
+
     template <typename ShaderImplType, typename PSOCreateInfoType, typename TShaderStages>
     void ExtractShaders(const PSOCreateInfoType& PSOCreateInfo,
                         TShaderStages&           ShaderStages,
@@ -958,6 +1099,8 @@ protected:
         GraphicsPipeline = CreateInfo.GraphicsPipeline;
         CorrectGraphicsPipelineDesc(GraphicsPipeline, this->GetDevice()->GetDeviceInfo().Features);
 
+        this->m_pGraphicsPipelineData->HasExtendedDynamicState = (CreateInfo.Flags & PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE) != 0;
+
         CopyResourceLayout(CreateInfo.PSODesc.ResourceLayout, this->m_Desc.ResourceLayout, MemPool);
         CopyResourceSignatures(CreateInfo, MemPool);
 
@@ -1314,6 +1457,11 @@ protected:
 
     std::atomic<PIPELINE_STATE_STATUS> m_Status{PIPELINE_STATE_STATUS_UNINITIALIZED};
 
+    /// Pipeline compile statistics, see SetCompileStats().
+    PipelineStateCompileStats              m_CompileStats;
+    std::vector<PipelineStageCompileStats> m_StageCompileStats;
+    bool                                   m_CompileStatsSet = false;
+
     /// The number of signatures in m_Signatures array.
     /// Note that this is not necessarily the same as the number of signatures
     /// that were used to create the pipeline, because signatures are arranged
@@ -1333,6 +1481,9 @@ protected:
         Uint32* pStrides        = nullptr;
         Uint8   BufferSlotsUsed = 0;
 
+        /// Whether the pipeline was created with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE
+        bool HasExtendedDynamicState = false;
+
 #ifdef DILIGENT_DEVELOPMENT
         size_t dvpRenderTargetFormatsHash = 0;
 #endif
@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Implementation of Diligent::QueryPoolBase template class
+
+#include "QueryPool.h"
+#include "DeviceObjectBase.hpp"
+#include "GraphicsTypes.h"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+/// Template class implementing base functionality of the query pool object
+
+/// \tparam RenderDeviceImplType - Render device implementation type (RenderDeviceD3D12Impl, RenderDeviceVkImpl, etc.).
+template <typename RenderDeviceImplType>
+class QueryPoolBase : public DeviceObjectBase<IQueryPool, RenderDeviceImplType, QueryPoolDesc>
+{
+public:
+    using TDeviceObjectBase = DeviceObjectBase<IQueryPool, RenderDeviceImplType, QueryPoolDesc>;
+
+    /// \param pRefCounters - Reference counters object that controls the lifetime of this query pool.
+    /// \param pDevice      - Pointer to the device.
+    /// \param Desc         - Query pool description.
+    QueryPoolBase(IReferenceCounters*   pRefCounters,
+                  RenderDeviceImplType* pDevice,
+                  const QueryPoolDesc&  Desc) :
+        TDeviceObjectBase{pRefCounters, pDevice, Desc}
+    {
+        const DeviceFeatures& Features = this->GetDevice()->GetFeatures();
+        switch (Desc.Type)
+        {
+            case QUERY_TYPE_OCCLUSION:
+                if (!Features.OcclusionQueries)
+                    LOG_ERROR_AND_THROW("Occlusion queries are not supported by this device");
+                break;
+
+            case QUERY_TYPE_BINARY_OCCLUSION:
+                if (!Features.BinaryOcclusionQueries)
+                    LOG_ERROR_AND_THROW("Binary occlusion queries are not supported by this device");
+                break;
+
+            case QUERY_TYPE_TIMESTAMP:
+                if (!Features.TimestampQueries)
+                    LOG_ERROR_AND_THROW("Timestamp queries are not supported by this device");
+                break;
+
+            default:
+                LOG_ERROR_AND_THROW(GetQueryTypeString(Desc.Type), " queries can't be allocated from a query pool");
+        }
+
+        if (Desc.QueryCount == 0)
+            LOG_ERROR_AND_THROW("Query count must not be zero");
+    }
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_QueryPool, TDeviceObjectBase)
+};
+
+} // namespace Diligent
@@ -0,0 +1,387 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::RecordingDeviceContext and Diligent::RecordedCommandList classes
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+#include "DeviceContext.h"
+#include "CommandList.h"
+#include "RenderDevice.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "DynamicLinearAllocator.hpp"
+#include "UniqueIdentifier.hpp"
+
+namespace Diligent
+{
+
+// {5F0C2D4B-7A1E-4B93-9E62-3C8D1A7F40B5}
+static constexpr INTERFACE_ID IID_RecordedCommandList =
+    {0x5f0c2d4b, 0x7a1e, 0x4b93, {0x9e, 0x62, 0x3c, 0x8d, 0x1a, 0x7f, 0x40, 0xb5}};
+
+/// Command list recorded by RecordingDeviceContext.
+
+/// Commands are stored as a compact stream of POD records. Objects referenced by the commands
+/// are kept alive by the command list, and all data passed by pointer (render target arrays,
+/// clear values, buffer and texture update data, etc.) is copied into the list at record time,
+/// so that replaying the list only dereferences the pointers stored in the stream.
+class RecordedCommandList final : public ObjectBase<ICommandList>
+{
+public:
+    using TBase = ObjectBase<ICommandList>;
+
+    RecordedCommandList(IReferenceCounters*                     pRefCounters,
+                        Uint32                                  ImmediateContextId,
+                        std::vector<Uint8>&&                    Commands,
+                        std::unique_ptr<DynamicLinearAllocator> pData,
+                        std::vector<RefCntAutoPtr<IObject>>&&   Objects) noexcept;
+
+    ~RecordedCommandList();
+
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_RecordedCommandList, IID_CommandList, TBase)
+
+    virtual const DeviceObjectAttribs& DILIGENT_CALL_TYPE GetDesc() const override final { return m_Desc; }
+
+    virtual Int32 DILIGENT_CALL_TYPE GetUniqueID() const override final { return m_UniqueId.GetID(); }
+
+    virtual void DILIGENT_CALL_TYPE SetUserData(IObject* pUserData) override final { m_pUserData = pUserData; }
+
+    virtual IObject* DILIGENT_CALL_TYPE GetUserData() const override final { return m_pUserData; }
+
+    /// Replays the recorded commands in the immediate context.
+
+    /// The context state is invalidated before and after the replay, so the list
+    /// neither depends on nor leaks any state, which matches the semantics of native
+    /// command lists. Consecutive redundant state changes (pipeline state, shader resources,
+    /// vertex and index buffers, viewports, scissor rects, stencil reference and blend factors)
+    /// are filtered out during the replay.
+    void Execute(IDeviceContext* pContext) const;
+
+    Uint32 GetImmediateContextId() const { return m_ImmediateContextId; }
+
+    size_t GetCommandStreamSize() const { return m_Commands.size(); }
+
+private:
+    const DeviceObjectAttribs m_Desc;
+    const Uint32              m_ImmediateContextId;
+
+    const std::vector<Uint8>                      m_Commands;
+    const std::unique_ptr<DynamicLinearAllocator> m_pData;
+    const std::vector<RefCntAutoPtr<IObject>>     m_Objects;
+
+    UniqueIdHelper<RecordedCommandList> m_UniqueId;
+    RefCntAutoPtr<IObject>              m_pUserData;
+};
+
+/// Deferred context that records commands into a RecordedCommandList.
+
+/// The context is used by backends that have no native deferred contexts (OpenGL) or whose
+/// driver does not support command lists natively (Direct3D11), see IRenderDevice::CreateDeferredContext().
+/// Commands may be recorded on any thread and are replayed by the immediate context in
+/// IDeviceContext::ExecuteCommandLists().
+///
+/// The context does not touch the graphics API, and it does not validate the commands: the
+/// validation is performed by the immediate context when the list is replayed. Operations that
+/// require immediate access to the device (fences, queries readback, texture mapping, ray tracing,
+/// sparse resources, etc.) are not supported. Buffers may only be mapped with MAP_WRITE and
+/// MAP_FLAG_DISCARD; the data is written into the list and uploaded during the replay.
+///
+/// \remarks    Shader resource bindings are referenced, not copied. Variables of an SRB must not
+///             be changed after the SRB has been committed until the command list is executed.
+class RecordingDeviceContext final : public ObjectBase<IDeviceContext>
+{
+public:
+    using TBase = ObjectBase<IDeviceContext>;
+
+    RecordingDeviceContext(IReferenceCounters*      pRefCounters,
+                           IRenderDevice*           pDevice,
+                           const DeviceContextDesc& Desc);
+
+    ~RecordingDeviceContext();
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DeviceContext, TBase)
+
+    virtual const DeviceContextDesc& DILIGENT_CALL_TYPE GetDesc() const override final { return m_Desc; }
+
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
+
+    virtual void DILIGENT_CALL_TYPE TransitionShaderResources(IShaderResourceBinding* pShaderResourceBinding) override final;
+
+    virtual void DILIGENT_CALL_TYPE CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
+                                                          RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetStencilRef(Uint32 StencilRef) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetDepthState(Bool DepthEnable, Bool DepthWriteEnable, COMPARISON_FUNCTION DepthFunc) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
+                                                     Uint32                         NumBuffersSet,
+                                                     IBuffer* const*                ppBuffers,
+                                                     const Uint64*                  pOffsets,
+                                                     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                                     SET_VERTEX_BUFFERS_FLAGS       Flags) override final;
+
+    virtual void DILIGENT_CALL_TYPE InvalidateState() override final;
+
+    virtual void DILIGENT_CALL_TYPE SetIndexBuffer(IBuffer*                       pIndexBuffer,
+                                                   Uint64                         ByteOffset,
+                                                   RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetViewports(Uint32          NumViewports,
+                                                 const Viewport* pViewports,
+                                                 Uint32          RTWidth,
+                                                 Uint32          RTHeight) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetScissorRects(Uint32      NumRects,
+                                                    const Rect* pRects,
+                                                    Uint32      RTWidth,
+                                                    Uint32      RTHeight) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetRenderTargets(Uint32                         NumRenderTargets,
+                                                     ITextureView*                  ppRenderTargets[],
+                                                     ITextureView*                  pDepthStencil,
+                                                     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE BeginRenderPass(const BeginRenderPassAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE NextSubpass() override final;
+
+    virtual void DILIGENT_CALL_TYPE EndRenderPass() override final;
+
+    virtual void DILIGENT_CALL_TYPE Draw(const DrawAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE DrawIndexed(const DrawIndexedAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE DrawIndirect(const DrawIndirectAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE DrawMesh(const DrawMeshAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE MultiDraw(const MultiDrawAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE DispatchCompute(const DispatchComputeAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE DispatchTile(const DispatchTileAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE GetTileSize(Uint32& TileSizeX, Uint32& TileSizeY) override final;
+
+    virtual void DILIGENT_CALL_TYPE ClearDepthStencil(ITextureView*                  pView,
+                                                      CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                                      float                          fDepth,
+                                                      Uint8                          Stencil,
+                                                      RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    virtual void DILIGENT_CALL_TYPE ClearRenderTarget(ITextureView*                  pView,
+                                                      const void*                    RGBA,
+                                                      RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    virtual void DILIGENT_CALL_TYPE InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil) override final;
+
+    virtual void DILIGENT_CALL_TYPE FinishCommandList(ICommandList** ppCommandList) override final;
+
+    virtual void DILIGENT_CALL_TYPE ExecuteCommandLists(Uint32               NumCommandLists,
+                                                        ICommandList* const* ppCommandLists) override final;
+
+    virtual void DILIGENT_CALL_TYPE EnqueueSignal(IFence* pFence, Uint64 Value) override final;
+
+    virtual void DILIGENT_CALL_TYPE DeviceWaitForFence(IFence* pFence, Uint64 Value) override final;
+
+    virtual void DILIGENT_CALL_TYPE WaitForIdle() override final;
+
+    virtual void DILIGENT_CALL_TYPE BeginQuery(IQuery* pQuery) override final;
+
+    virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
+
+    virtual void DILIGENT_CALL_TYPE BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    virtual void DILIGENT_CALL_TYPE EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    virtual void DILIGENT_CALL_TYPE ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE Flush() override final;
+
+    virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
+                                                 Uint64                         Offset,
+                                                 Uint64                         Size,
+                                                 const void*                    pData,
+                                                 RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    virtual void DILIGENT_CALL_TYPE CopyBuffer(IBuffer*                       pSrcBuffer,
+                                               Uint64                         SrcOffset,
+                                               RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                               IBuffer*                       pDstBuffer,
+                                               Uint64                         DstOffset,
+                                               Uint64                         Size,
+                                               RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) override final;
+
+    virtual void DILIGENT_CALL_TYPE MapBuffer(IBuffer*  pBuffer,
+                                              MAP_TYPE  MapType,
+                                              MAP_FLAGS MapFlags,
+                                              PVoid&    pMappedData) override final;
+
+    virtual void DILIGENT_CALL_TYPE UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType) override final;
+
+    virtual void DILIGENT_CALL_TYPE UpdateTexture(ITexture*                      pTexture,
+                                                  Uint32                         MipLevel,
+                                                  Uint32                         Slice,
+                                                  const Box&                     DstBox,
+                                                  const TextureSubResData&       SubresData,
+                                                  RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                                  RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode) override final;
+
+    virtual void DILIGENT_CALL_TYPE CopyTexture(const CopyTextureAttribs& CopyAttribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE MapTextureSubresource(ITexture*                 pTexture,
+                                                          Uint32                    MipLevel,
+                                                          Uint32                    ArraySlice,
+                                                          MAP_TYPE                  MapType,
+                                                          MAP_FLAGS                 MapFlags,
+                                                          const Box*                pMapRegion,
+                                                          MappedTextureSubresource& MappedData) override final;
+
+    virtual void DILIGENT_CALL_TYPE UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice) override final;
+
+    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTextureView, GENERATE_MIPS_FLAGS Flags) override final;
+
+    virtual void DILIGENT_CALL_TYPE FinishFrame() override final;
+
+    virtual Uint64 DILIGENT_CALL_TYPE GetFrameNumber() const override final { return m_FrameNumber; }
+
+    virtual void DILIGENT_CALL_TYPE TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers) override final;
+
+    virtual void DILIGENT_CALL_TYPE ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                              ITexture*                               pDstTexture,
+                                                              const ResolveTextureSubresourceAttribs& ResolveAttribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE BuildBLAS(const BuildBLASAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE BuildTLAS(const BuildTLASAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE CopyBLAS(const CopyBLASAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE CopyTLAS(const CopyTLASAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE TraceRays(const TraceRaysAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetUserData(IObject* pUserData) override final { m_pUserData = pUserData; }
+
+    virtual IObject* DILIGENT_CALL_TYPE GetUserData() const override final { return m_pUserData; }
+
+    virtual void DILIGENT_CALL_TYPE BeginDebugGroup(const Char* Name, const float* pColor) override final;
+
+    virtual void DILIGENT_CALL_TYPE EndDebugGroup() override final;
+
+    virtual void DILIGENT_CALL_TYPE InsertDebugLabel(const Char* Label, const float* pColor) override final;
+
+    virtual ICommandQueue* DILIGENT_CALL_TYPE LockCommandQueue() override final;
+
+    virtual void DILIGENT_CALL_TYPE UnlockCommandQueue() override final;
+
+    virtual void DILIGENT_CALL_TYPE SetShadingRate(SHADING_RATE          BaseRate,
+                                                   SHADING_RATE_COMBINER PrimitiveCombiner,
+                                                   SHADING_RATE_COMBINER TextureCombiner) override final;
+
+    virtual void DILIGENT_CALL_TYPE BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs) override final;
+
+    /// Statistics are collected by the immediate context when the command list is replayed.
+    virtual void DILIGENT_CALL_TYPE ClearStats() override final { m_Stats = {}; }
+
+    virtual const DeviceContextStats& DILIGENT_CALL_TYPE GetStats() const override final { return m_Stats; }
+
+private:
+    template <typename CmdType>
+    void Record(const CmdType& Cmd);
+
+    template <typename ObjectType>
+    ObjectType* KeepAlive(ObjectType* pObject);
+
+    template <typename T>
+    const T* CopyArray(const T* pSrc, size_t Count);
+
+    void ResetRecording();
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const std::string m_Name;
+    DeviceContextDesc m_Desc;
+
+    Uint32 m_ImmediateContextId = ~0u;
+    Uint64 m_FrameNumber        = 0;
+
+    std::vector<Uint8>                      m_Commands;
+    std::unique_ptr<DynamicLinearAllocator> m_pData;
+    std::vector<RefCntAutoPtr<IObject>>     m_Objects;
+    std::unordered_set<IObject*>            m_ObjectSet;
+
+    struct MappedBufferInfo
+    {
+        IBuffer* pBuffer = nullptr;
+        void*    pData   = nullptr;
+        Uint64   Size    = 0;
+    };
+    std::vector<MappedBufferInfo> m_MappedBuffers;
+
+    RefCntAutoPtr<IObject> m_pUserData;
+    DeviceContextStats     m_Stats;
+};
+
+} // namespace Diligent
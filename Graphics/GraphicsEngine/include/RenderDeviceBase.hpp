@@ -30,11 +30,13 @@
 /// \file
 /// Implementation of the Diligent::RenderDeviceBase template class and related structures
 
+#include <algorithm>
 #include <atomic>
 #include <thread>
 #include <vector>
 #include <unordered_set>
 #include <mutex>
+#include <memory>
 
 #include "RenderDevice.h"
 #include "DeviceObjectBase.hpp"
@@ -42,16 +44,21 @@
 #include "ResourceMappingImpl.hpp"
 #include "ObjectsRegistry.hpp"
 #include "HashUtils.hpp"
+#include "DeviceObjectDigest.hpp"
 #include "ObjectBase.hpp"
 #include "DeviceContext.h"
 #include "SwapChain.h"
 #include "GraphicsAccessories.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
+#include "CountingMemoryAllocator.hpp"
 #include "EngineMemory.h"
 #include "STDAllocator.hpp"
 #include "IndexWrapper.hpp"
 #include "ThreadPool.hpp"
 #include "SpinLock.hpp"
+#include "Trace.hpp"
+#include "FenceCompletionScheduler.hpp"
+#include "RecordingDeviceContext.hpp"
 
 namespace Diligent
 {
@@ -137,31 +144,35 @@ public:
         TObjectBase           {pRefCounters},
         m_pEngineFactory      {pEngineFactory},
         m_ValidationFlags     {EngineCI.ValidationFlags},
+        m_CmdValidationMode   {EngineCI.CommandValidationMode},
+        m_CmdValidationPeriod {(std::max)(EngineCI.CommandValidationInterval, 1u)},
         m_AdapterInfo         {AdapterInfo},
+        m_EnableObjectDedup   {EngineCI.EnableObjectDeduplication != False},
         m_TextureFormatsInfo  (TEX_FORMAT_NUM_FORMATS, TextureFormatInfoExt(), STD_ALLOCATOR_RAW_MEM(TextureFormatInfoExt, RawMemAllocator, "Allocator for vector<TextureFormatInfoExt>")),
         m_TexFmtInfoInitFlags (TEX_FORMAT_NUM_FORMATS, false, STD_ALLOCATOR_RAW_MEM(bool, RawMemAllocator, "Allocator for vector<bool>")),
         m_wpImmediateContexts ((std::max)(1u, EngineCI.NumImmediateContexts), RefCntWeakPtr<DeviceContextImplType>(), STD_ALLOCATOR_RAW_MEM(RefCntWeakPtr<DeviceContextImplType>, RawMemAllocator, "Allocator for vector<RefCntWeakPtr<DeviceContextImplType>>")),
         m_wpDeferredContexts  (EngineCI.NumDeferredContexts, RefCntWeakPtr<DeviceContextImplType>(), STD_ALLOCATOR_RAW_MEM(RefCntWeakPtr<DeviceContextImplType>, RawMemAllocator, "Allocator for vector<RefCntWeakPtr<DeviceContextImplType>>")),
         m_RawMemAllocator     {RawMemAllocator},
-        m_TexObjAllocator     {RawMemAllocator, sizeof(TextureImplType),                   16},
-        m_TexViewObjAllocator {RawMemAllocator, sizeof(TextureViewImplType),               32},
-        m_BufObjAllocator     {RawMemAllocator, sizeof(BufferImplType),                    16},
-        m_BuffViewObjAllocator{RawMemAllocator, sizeof(BufferViewImplType),                32},
-        m_ShaderObjAllocator  {RawMemAllocator, sizeof(ShaderImplType),                    16},
-        m_SamplerObjAllocator {RawMemAllocator, sizeof(SamplerImplType),                   32},
-        m_PSOAllocator        {RawMemAllocator, sizeof(PipelineStateImplType),             16},
-        m_SRBAllocator        {RawMemAllocator, sizeof(ShaderResourceBindingImplType),     64},
-        m_ResMappingAllocator {RawMemAllocator, sizeof(ResourceMappingImpl),                8},
-        m_FenceAllocator      {RawMemAllocator, sizeof(FenceImplType),                     16},
-        m_QueryAllocator      {RawMemAllocator, sizeof(QueryImplType),                     16},
-        m_RenderPassAllocator {RawMemAllocator, sizeof(RenderPassImplType),                16},
-        m_FramebufferAllocator{RawMemAllocator, sizeof(FramebufferImplType),               16},
-        m_BLASAllocator       {RawMemAllocator, sizeof(BottomLevelASImplType),              8},
-        m_TLASAllocator       {RawMemAllocator, sizeof(TopLevelASImplType),                 8},
-        m_SBTAllocator        {RawMemAllocator, sizeof(ShaderBindingTableImplType),         8},
-        m_PipeResSignAllocator{RawMemAllocator, sizeof(PipelineResourceSignatureImplType), 16},
-        m_MemObjAllocator     {RawMemAllocator, sizeof(DeviceMemoryImplType),              16},
-        m_PSOCacheAllocator   {RawMemAllocator, sizeof(PipelineStateCacheImplType),         4}
+        m_CategoryAllocators  {RawMemAllocator},
+        m_TexObjAllocator     {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(TextureImplType),                   16, DeviceObjectThreadCacheSize},
+        m_TexViewObjAllocator {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(TextureViewImplType),               32, DeviceObjectThreadCacheSize},
+        m_BufObjAllocator     {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(BufferImplType),                    16, DeviceObjectThreadCacheSize},
+        m_BuffViewObjAllocator{m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(BufferViewImplType),                32, DeviceObjectThreadCacheSize},
+        m_ShaderObjAllocator  {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(ShaderImplType),                    16},
+        m_SamplerObjAllocator {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(SamplerImplType),                   32},
+        m_PSOAllocator        {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(PipelineStateImplType),             16},
+        m_SRBAllocator        {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(ShaderResourceBindingImplType),     64, DeviceObjectThreadCacheSize},
+        m_ResMappingAllocator {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(ResourceMappingImpl),                8},
+        m_FenceAllocator      {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(FenceImplType),                     16},
+        m_QueryAllocator      {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(QueryImplType),                     16},
+        m_RenderPassAllocator {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(RenderPassImplType),                16},
+        m_FramebufferAllocator{m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(FramebufferImplType),               16},
+        m_BLASAllocator       {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(BottomLevelASImplType),              8},
+        m_TLASAllocator       {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(TopLevelASImplType),                 8},
+        m_SBTAllocator        {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(ShaderBindingTableImplType),         8},
+        m_PipeResSignAllocator{m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(PipelineResourceSignatureImplType), 16},
+        m_MemObjAllocator     {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(DeviceMemoryImplType),              16},
+        m_PSOCacheAllocator   {m_CategoryAllocators[MEMORY_CATEGORY_DEVICE_OBJECTS], sizeof(PipelineStateCacheImplType),         4}
     // clang-format on
     {
         // Initialize texture format info
@@ -340,8 +351,94 @@ public:
     FixedBlockMemoryAllocator& GetBuffViewObjAllocator() { return m_BuffViewObjAllocator; }
     FixedBlockMemoryAllocator& GetSRBAllocator() { return m_SRBAllocator; }
 
+    /// Returns the raw memory allocator that accounts allocations for the given memory category.
+    /// Memory must be released through the same allocator it was allocated with.
+    IMemoryAllocator& GetCategoryAllocator(MEMORY_CATEGORY Category) { return m_CategoryAllocators[Category]; }
+
+    /// Implementation of IRenderDevice::GetMemoryCategoryStats().
+    virtual void DILIGENT_CALL_TYPE GetMemoryCategoryStats(MEMORY_CATEGORY Category, MemoryCategoryStats& Stats) const override final
+    {
+        if (Category >= MEMORY_CATEGORY_COUNT)
+        {
+            DEV_ERROR("Invalid memory category (", Uint32{Category}, ")");
+            Stats = {};
+            return;
+        }
+        Stats = m_CategoryAllocators[Category].GetStats();
+    }
+
+    /// Implementation of IRenderDevice::GetStartupTimes().
+    virtual const RenderDeviceStartupTimes& DILIGENT_CALL_TYPE GetStartupTimes() const override final
+    {
+        return m_StartupTimes;
+    }
+
+    /// Called by the engine factory when the device and the contexts have been created.
+    void SetStartupTimes(const RenderDeviceStartupTimes& StartupTimes) { m_StartupTimes = StartupTimes; }
+
+    /// Implementation of IRenderDevice::GetPipelineCompileStats().
+    virtual void DILIGENT_CALL_TYPE GetPipelineCompileStats(DevicePipelineCompileStats& Stats) const override final
+    {
+        Stats.NumPipelines   = m_PipelineCompileStats.NumPipelines.load();
+        Stats.NumCacheHits   = m_PipelineCompileStats.NumCacheHits.load();
+        Stats.NumCacheMisses = m_PipelineCompileStats.NumCacheMisses.load();
+        Stats.TotalDuration  = m_PipelineCompileStats.TotalDuration.load();
+        Stats.MaxDuration    = m_PipelineCompileStats.MaxDuration.load();
+    }
+
+    /// Adds the pipeline compile statistics to the device-wide statistics.
+    /// Called by the pipeline states, possibly from multiple threads.
+    void RecordPipelineCompileStats(const PipelineStateCompileStats& Stats)
+    {
+        m_PipelineCompileStats.NumPipelines.fetch_add(1);
+        if (Stats.CacheStatus == PIPELINE_CACHE_STATUS_HIT)
+            m_PipelineCompileStats.NumCacheHits.fetch_add(1);
+        else if (Stats.CacheStatus == PIPELINE_CACHE_STATUS_MISS)
+            m_PipelineCompileStats.NumCacheMisses.fetch_add(1);
+        m_PipelineCompileStats.TotalDuration.fetch_add(Stats.Duration);
+
+        Uint64 MaxDuration = m_PipelineCompileStats.MaxDuration.load();
+        while (Stats.Duration > MaxDuration && !m_PipelineCompileStats.MaxDuration.compare_exchange_weak(MaxDuration, Stats.Duration))
+        {
+        }
+    }
+
+    /// Implementation of IRenderDevice::EnqueueFenceCompletionCallback().
+    virtual void DILIGENT_CALL_TYPE EnqueueFenceCompletionCallback(IFence*                     pFence,
+                                                                   Uint64                      Value,
+                                                                   FenceCompletionCallbackType Callback,
+                                                                   void*                       pUserData) override final
+    {
+        DEV_CHECK_ERR(pFence != nullptr, "Fence must not be null");
+        DEV_CHECK_ERR(Callback != nullptr, "Callback must not be null");
+        if (pFence == nullptr || Callback == nullptr)
+            return;
+
+        std::lock_guard<std::mutex> Guard{m_FenceCompletionSchedulerMtx};
+        if (!m_pFenceCompletionScheduler)
+            m_pFenceCompletionScheduler = CreateFenceCompletionScheduler();
+        m_pFenceCompletionScheduler->Enqueue(pFence, Value, Callback, pUserData);
+    }
+
+    /// Executes the fence completion callbacks when the scheduler does not have a worker thread.
+    /// Called by the immediate contexts at the end of each frame.
+    void ProcessFenceCompletionCallbacks()
+    {
+        FenceCompletionScheduler* pScheduler = nullptr;
+        {
+            std::lock_guard<std::mutex> Guard{m_FenceCompletionSchedulerMtx};
+            pScheduler = m_pFenceCompletionScheduler.get();
+        }
+        // The scheduler is only destroyed with the device
+        if (pScheduler != nullptr && !pScheduler->HasWorkerThread())
+            pScheduler->ProcessCompleted();
+    }
+
     VALIDATION_FLAGS GetValidationFlags() const { return m_ValidationFlags; }
 
+    COMMAND_VALIDATION_MODE GetCommandValidationMode() const { return m_CmdValidationMode; }
+    Uint32                  GetCommandValidationInterval() const { return m_CmdValidationPeriod; }
+
     // Convenience function
     const DeviceFeatures& GetFeatures() const
     {
@@ -358,6 +455,70 @@ public:
         return m_pShaderCompilationThreadPool;
     }
 
+    /// Implementation of IRenderDevice::CreateShaders().
+    virtual void DILIGENT_CALL_TYPE CreateShaders(const ShaderCreateInfo* pShaderCIs,
+                                                  Uint32                  NumShaders,
+                                                  IShader**               ppShaders) override final
+    {
+        if (NumShaders == 0)
+            return;
+
+        DEV_CHECK_ERR(pShaderCIs != nullptr, "pShaderCIs must not be null");
+        DEV_CHECK_ERR(ppShaders != nullptr, "ppShaders must not be null");
+        if (pShaderCIs == nullptr || ppShaders == nullptr)
+            return;
+
+        // Submit the shaders that are expected to take longest first so that the short ones
+        // fill the gaps at the end and all compilation threads finish at about the same time.
+        // Source length is the only estimate available without preprocessing. Shaders loaded
+        // from files are assumed to be the most expensive, and precompiled bytecode is the cheapest.
+        const auto EstimateCompileCost = [](const ShaderCreateInfo& CI) -> size_t {
+            if (CI.ByteCode != nullptr)
+                return 0;
+            if (CI.Source != nullptr)
+                return CI.SourceLength != 0 ? CI.SourceLength : strlen(CI.Source);
+            return SIZE_MAX;
+        };
+
+        std::vector<Uint32> Order(NumShaders);
+        for (Uint32 i = 0; i < NumShaders; ++i)
+            Order[i] = i;
+        if (m_pShaderCompilationThreadPool)
+        {
+            std::stable_sort(Order.begin(), Order.end(), [&](Uint32 i0, Uint32 i1) {
+                return EstimateCompileCost(pShaderCIs[i0]) > EstimateCompileCost(pShaderCIs[i1]);
+            });
+        }
+
+        for (Uint32 i : Order)
+        {
+            DEV_CHECK_ERR(ppShaders[i] == nullptr, "Overwriting reference to existing object may cause memory leaks");
+            ShaderCreateInfo ShaderCI = pShaderCIs[i];
+            if (m_pShaderCompilationThreadPool)
+                ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+            // Call through IRenderDevice, since derived interfaces (e.g. ISerializationDevice) may hide this overload
+            static_cast<IRenderDevice*>(this)->CreateShader(ShaderCI, &ppShaders[i], nullptr);
+        }
+
+        if (!m_pShaderCompilationThreadPool)
+            return;
+
+        // Shaders that were requested synchronously must be ready when the method returns,
+        // and a failed compilation must produce null as it does in CreateShader().
+        for (Uint32 i : Order)
+        {
+            if ((pShaderCIs[i].CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) != 0 || ppShaders[i] == nullptr)
+                continue;
+
+            if (ppShaders[i]->GetStatus(/*WaitForCompletion = */ true) != SHADER_STATUS_READY)
+            {
+                LOG_ERROR_MESSAGE("Failed to create shader '", (pShaderCIs[i].Desc.Name != nullptr ? pShaderCIs[i].Desc.Name : ""), "'");
+                ppShaders[i]->Release();
+                ppShaders[i] = nullptr;
+            }
+        }
+    }
+
     Uint32 AllocateDynamicBufferId()
     {
         Threading::SpinLockGuard Guard{m_RecycledDynamicBufferIdsLock};
@@ -388,6 +549,22 @@ public:
 protected:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) = 0;
 
+    /// Creates the scheduler that executes the fence completion callbacks. By default, the callbacks
+    /// are executed by the immediate contexts, as fences may not be thread-safe. Backends with thread-safe
+    /// fences override this method to return a scheduler with a worker thread.
+    virtual std::unique_ptr<FenceCompletionScheduler> CreateFenceCompletionScheduler()
+    {
+        return std::make_unique<FenceCompletionScheduler>(/*UseWorkerThread = */ false);
+    }
+
+    /// Stops the fence completion worker thread. Backends whose scheduler uses native
+    /// objects must call this method before they destroy the native device.
+    void DestroyFenceCompletionScheduler()
+    {
+        std::lock_guard<std::mutex> Guard{m_FenceCompletionSchedulerMtx};
+        m_pFenceCompletionScheduler.reset();
+    }
+
     void InitShaderCompilationThreadPool(IThreadPool* pShaderCompilationThreadPool, Uint32 NumThreads)
     {
         if (!m_DeviceInfo.Features.AsyncShaderCompilation)
@@ -411,6 +588,9 @@ protected:
             {
                 ThreadPoolCI.NumThreads = (std::min)(NumThreads, (std::max)(NumCores * 4, 128u));
             }
+            // Shader compilation tasks are enqueued from many threads at once,
+            // so use per-thread queues to avoid contention on a single lock.
+            ThreadPoolCI.EnableWorkStealing = true;
             m_pShaderCompilationThreadPool = CreateThreadPool(ThreadPoolCI);
         }
     }
@@ -472,11 +652,21 @@ protected:
     template <typename PSOCreateInfoType, typename... ExtraArgsType>
     void CreatePipelineStateImpl(IPipelineState** ppPipelineState, const PSOCreateInfoType& PSOCreateInfo, const ExtraArgsType&... ExtraArgs)
     {
+        DILIGENT_TRACE_SCOPE("CreatePipelineState");
+
         CreateDeviceObject("Pipeline State", PSOCreateInfo.PSODesc, ppPipelineState,
                            [&]() //
                            {
-                               PipelineStateImplType* pPipelineStateImpl = NEW_RC_OBJ(m_PSOAllocator, "Pipeline State instance", PipelineStateImplType)(static_cast<RenderDeviceImplType*>(this), PSOCreateInfo, ExtraArgs...);
-                               pPipelineStateImpl->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
+                               auto CreatePSO = [&]() {
+                                   return RefCntAutoPtr<IPipelineState>{NEW_RC_OBJ(m_PSOAllocator, "Pipeline State instance", PipelineStateImplType)(static_cast<RenderDeviceImplType*>(this), PSOCreateInfo, ExtraArgs...)};
+                               };
+
+                               DeviceObjectDigest            Digest;
+                               RefCntAutoPtr<IPipelineState> pPSO = m_EnableObjectDedup && ComputeDeviceObjectDigest(PSOCreateInfo, Digest) ?
+                                   m_PSORegistry.Get(Digest, CreatePSO) :
+                                   CreatePSO();
+
+                               *ppPipelineState = pPSO.Detach();
                            });
     }
 
@@ -510,11 +700,33 @@ protected:
         CreateDeviceObject("Shader", ShaderCI.Desc, ppShader,
                            [&]() //
                            {
-                               ShaderImplType* pShaderImpl = NEW_RC_OBJ(m_ShaderObjAllocator, "Shader instance", ShaderImplType)(static_cast<RenderDeviceImplType*>(this), ShaderCI, ExtraArgs...);
-                               pShaderImpl->QueryInterface(IID_Shader, reinterpret_cast<IObject**>(ppShader));
+                               auto CreateShader = [&]() {
+                                   return RefCntAutoPtr<IShader>{NEW_RC_OBJ(m_ShaderObjAllocator, "Shader instance", ShaderImplType)(static_cast<RenderDeviceImplType*>(this), ShaderCI, ExtraArgs...)};
+                               };
+
+                               DeviceObjectDigest     Digest;
+                               RefCntAutoPtr<IShader> pShader = m_EnableObjectDedup && CanDeduplicateShader(0, ExtraArgs...) && ComputeDeviceObjectDigest(ShaderCI, Digest) ?
+                                   m_ShadersRegistry.Get(Digest, CreateShader) :
+                                   CreateShader();
+
+                               *ppShader = pShader.Detach();
                            });
     }
 
+    // Compiler output can't be returned for an existing shader, so shaders are only
+    // deduplicated when the backend-specific create info shows that it was not requested.
+    template <typename ShaderImplCreateInfoType, typename... RestArgsType>
+    static auto CanDeduplicateShader(int, const ShaderImplCreateInfoType& ShaderImplCI, const RestArgsType&...) -> decltype(ShaderImplCI.ppCompilerOutput == nullptr)
+    {
+        return ShaderImplCI.ppCompilerOutput == nullptr;
+    }
+
+    template <typename... ArgsType>
+    static bool CanDeduplicateShader(long, const ArgsType&...)
+    {
+        return false;
+    }
+
     template <typename... ExtraArgsType>
     void CreateSamplerImpl(ISampler** ppSampler, const SamplerDesc& SamplerDesc, const ExtraArgsType&... ExtraArgs)
     {
@@ -612,11 +824,32 @@ protected:
         CreateDeviceObject("Pipeline Resource Signature", Desc, ppSignature,
                            [&]() //
                            {
-                               PipelineResourceSignatureImplType* pPRSImpl = NEW_RC_OBJ(m_PipeResSignAllocator, "PipelineResourceSignature instance", PipelineResourceSignatureImplType)(static_cast<RenderDeviceImplType*>(this), Desc, ExtraArgs...);
-                               pPRSImpl->QueryInterface(IID_PipelineResourceSignature, reinterpret_cast<IObject**>(ppSignature));
+                               auto CreateSignature = [&]() {
+                                   return RefCntAutoPtr<IPipelineResourceSignature>{NEW_RC_OBJ(m_PipeResSignAllocator, "PipelineResourceSignature instance", PipelineResourceSignatureImplType)(static_cast<RenderDeviceImplType*>(this), Desc, ExtraArgs...)};
+                               };
+
+                               DeviceObjectDigest                        Digest;
+                               RefCntAutoPtr<IPipelineResourceSignature> pSignature = m_EnableObjectDedup && CanDeduplicateSignature(ExtraArgs...) && ComputeDeviceObjectDigest(Desc, Digest) ?
+                                   m_SignaturesRegistry.Get(Digest, CreateSignature) :
+                                   CreateSignature();
+
+                               *ppSignature = pSignature.Detach();
                            });
     }
 
+    // Only signatures created through the public API are deduplicated.
+    // Internal and deserialized signatures carry additional state.
+    static bool CanDeduplicateSignature(SHADER_TYPE ShaderStages, bool IsDeviceInternal)
+    {
+        return ShaderStages == SHADER_TYPE_UNKNOWN && !IsDeviceInternal;
+    }
+
+    template <typename... ArgsType>
+    static bool CanDeduplicateSignature(const ArgsType&...)
+    {
+        return false;
+    }
+
     template <typename... ExtraArgsType>
     void CreateDeviceMemoryImpl(IDeviceMemory** ppMemory, const DeviceMemoryCreateInfo& MemCI, const ExtraArgsType&... ExtraArgs)
     {
@@ -678,17 +911,62 @@ protected:
         }
     }
 
+    /// Creates a deferred context that records commands into a command stream
+    /// replayed by the immediate context, see RecordingDeviceContext.
+    void CreateRecordingDeferredContext(IDeviceContext** ppContext)
+    {
+        const Uint32      CtxIndex  = m_NumRecordingContexts.fetch_add(1);
+        const Uint32      ContextId = static_cast<Uint32>(GetNumImmediateContexts()) + CtxIndex;
+        const std::string CtxName   = std::string{"Recording context "} + std::to_string(CtxIndex);
+        DeviceContextDesc Desc{
+            CtxName.c_str(),
+            COMMAND_QUEUE_TYPE_UNKNOWN,
+            true, // IsDeferred
+            static_cast<Uint8>(std::min(ContextId, Uint32{0xFF})),
+        };
+
+        CreateDeviceObject("Device context", Desc, ppContext,
+                           [&]() //
+                           {
+                               RecordingDeviceContext* pCtx = NEW_RC_OBJ(GetRawAllocator(), "RecordingDeviceContext instance", RecordingDeviceContext)(this, Desc);
+                               pCtx->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContext));
+                           });
+    }
+
 protected:
     RefCntAutoPtr<IEngineFactory> m_pEngineFactory;
 
-    const VALIDATION_FLAGS m_ValidationFlags;
-    GraphicsAdapterInfo    m_AdapterInfo;
-    RenderDeviceInfo       m_DeviceInfo;
+    const VALIDATION_FLAGS        m_ValidationFlags;
+    const COMMAND_VALIDATION_MODE m_CmdValidationMode;
+    const Uint32                  m_CmdValidationPeriod;
+    GraphicsAdapterInfo           m_AdapterInfo;
+    RenderDeviceInfo              m_DeviceInfo;
+    RenderDeviceStartupTimes      m_StartupTimes;
+
+    struct
+    {
+        std::atomic<Uint32> NumPipelines{0};
+        std::atomic<Uint32> NumCacheHits{0};
+        std::atomic<Uint32> NumCacheMisses{0};
+        std::atomic<Uint64> TotalDuration{0};
+        std::atomic<Uint64> MaxDuration{0};
+    } m_PipelineCompileStats;
 
     // All state object registries hold raw pointers.
     // This is safe because every object unregisters itself
     // when it is deleted.
     ObjectsRegistry<SamplerDesc, RefCntAutoPtr<ISampler>>                       m_SamplersRegistry; ///< Sampler state registry
+
+    /// Whether identical shader, pipeline state and resource signature creation
+    /// requests return the existing object, see EngineCreateInfo::EnableObjectDeduplication.
+    const bool m_EnableObjectDedup;
+
+    template <typename ObjectType>
+    using DedupRegistry = ObjectsRegistry<DeviceObjectDigest, RefCntAutoPtr<ObjectType>, DeviceObjectDigest::Hasher>;
+
+    DedupRegistry<IShader>                    m_ShadersRegistry;
+    DedupRegistry<IPipelineState>             m_PSORegistry;
+    DedupRegistry<IPipelineResourceSignature> m_SignaturesRegistry;
     std::vector<TextureFormatInfoExt, STDAllocatorRawMem<TextureFormatInfoExt>> m_TextureFormatsInfo;
     std::vector<bool, STDAllocatorRawMem<bool>>                                 m_TexFmtInfoInitFlags;
 
@@ -700,7 +978,15 @@ protected:
     mutable std::mutex                                                                                          m_DeferredCtxMtx;
     std::vector<RefCntWeakPtr<DeviceContextImplType>, STDAllocatorRawMem<RefCntWeakPtr<DeviceContextImplType>>> m_wpDeferredContexts;
 
+    /// The number of recording deferred contexts created by the device.
+    std::atomic<Uint32> m_NumRecordingContexts{0};
+
+    /// The number of free blocks each thread caches in the allocators of the objects
+    /// that are frequently created and destroyed from worker threads.
+    static constexpr Uint32 DeviceObjectThreadCacheSize = 16;
+
     IMemoryAllocator&         m_RawMemAllocator;      ///< Raw memory allocator
+    CategoryMemoryAllocators  m_CategoryAllocators;   ///< Raw memory allocators that account allocations per memory category
     FixedBlockMemoryAllocator m_TexObjAllocator;      ///< Allocator for texture objects
     FixedBlockMemoryAllocator m_TexViewObjAllocator;  ///< Allocator for texture view objects
     FixedBlockMemoryAllocator m_BufObjAllocator;      ///< Allocator for buffer objects
@@ -723,6 +1009,9 @@ protected:
 
     RefCntAutoPtr<IThreadPool> m_pShaderCompilationThreadPool;
 
+    std::mutex                                m_FenceCompletionSchedulerMtx;
+    std::unique_ptr<FenceCompletionScheduler> m_pFenceCompletionScheduler;
+
     std::atomic<UniqueIdentifier> m_UniqueId{0};
 
     // Dynamic buffer Ids are used by device contexts to index dynamic allocations
@@ -30,13 +30,18 @@
 /// \file
 /// Declaration of the Diligent::ResourceMappingImpl class
 
+#include <array>
+#include <atomic>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "ResourceMapping.h"
 #include "ObjectBase.hpp"
 #include "HashUtils.hpp"
 #include "STDAllocator.hpp"
 #include "RefCntAutoPtr.hpp"
+#include "ResourceNameRegistry.hpp"
 
 namespace Diligent
 {
@@ -49,16 +54,21 @@ class ResourceMappingImpl : public ObjectBase<IResourceMapping>
 public:
     typedef ObjectBase<IResourceMapping> TObjectBase;
 
+    // {6C1AC6C1-5B8B-4E0A-9A57-0E3E7B3F5C21}
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x6c1ac6c1, 0x5b8b, 0x4e0a, {0x9a, 0x57, 0xe, 0x3e, 0x7b, 0x3f, 0x5c, 0x21}};
+
     /// \param pRefCounters - reference counters object that controls the lifetime of this resource mapping
     /// \param RawMemAllocator - raw memory allocator that is used by the m_HashTable member
     ResourceMappingImpl(IReferenceCounters* pRefCounters, IMemoryAllocator& RawMemAllocator) :
         TObjectBase{pRefCounters},
-        m_HashTable{STD_ALLOCATOR_RAW_MEM(HashTableElem, RawMemAllocator, "Allocator for unordered_map<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>")}
+        m_HashTable{STD_ALLOCATOR_RAW_MEM(HashTableElem, RawMemAllocator, "Allocator for unordered_map<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>")},
+        m_pNameRegistry{&ResourceNameRegistry::Get()}
     {}
 
     ~ResourceMappingImpl();
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ResourceMapping, TObjectBase)
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_ResourceMapping, IID_InternalImpl, TObjectBase)
 
     /// Implementation of IResourceMapping::AddResource()
     virtual void DILIGENT_CALL_TYPE AddResource(const Char*    Name,
@@ -82,6 +92,29 @@ public:
     /// Returns number of resources in the resource mapping.
     virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
 
+    /// Finds the resource by its name ID interned in ResourceNameRegistry.
+
+    /// The lookup does not hash the name and does not take the lock. If the ID was interned
+    /// by a registry of another module or exceeds the capacity of the ID table, the method
+    /// falls back to the name lookup.
+    /// As with GetResource(), the returned pointer is only valid while the resource is not
+    /// replaced or removed from the mapping.
+    IDeviceObject* GetResourceById(Uint32 NameId, const Char* Name, Uint32 ArrayIndex)
+    {
+        if (NameId >= MaxNameIds || m_pNameRegistry != &ResourceNameRegistry::Get())
+            return GetResource(Name, ArrayIndex);
+
+        const NameIdPage* pPage = m_NameIdPages[NameId / NameIdPageSize].load(std::memory_order_acquire);
+        if (pPage == nullptr)
+            return nullptr;
+
+        const ResourceArray* pArray = pPage->Arrays[NameId % NameIdPageSize].load(std::memory_order_acquire);
+        if (pArray == nullptr || ArrayIndex >= pArray->Size)
+            return nullptr;
+
+        return pArray->Objects[ArrayIndex].load(std::memory_order_acquire);
+    }
+
 private:
     struct ResMappingHashKey : public HashMapStringKey
     {
@@ -122,6 +155,9 @@ private:
         const Uint32 ArrayIndex;
     };
 
+    // Sets the element of the name ID table. Must be called while holding the lock.
+    void SetNameIdTableElement(Uint32 NameId, Uint32 ArrayIndex, IDeviceObject* pObject);
+
     Threading::SpinLock m_Lock;
 
     using HashTableElem = std::pair<const ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>;
@@ -131,6 +167,38 @@ private:
                        std::equal_to<ResMappingHashKey>,
                        STDAllocatorRawMem<HashTableElem>>
         m_HashTable;
+
+    // Name ID table mirrors m_HashTable with raw pointers so that the resources can be
+    // found by interned name IDs without the lock. The table only grows: pages and
+    // arrays are published atomically, and arrays that are replaced by larger ones
+    // are retired and kept alive until the mapping is destroyed.
+    struct ResourceArray
+    {
+        explicit ResourceArray(Uint32 _Size) :
+            Size{_Size},
+            Objects{new std::atomic<IDeviceObject*>[_Size]{}}
+        {}
+
+        const Uint32                                    Size;
+        std::unique_ptr<std::atomic<IDeviceObject*>[]> Objects;
+    };
+
+    static constexpr Uint32 NameIdPageSize = 256;
+    static constexpr Uint32 MaxNameIdPages = 256;
+    static constexpr Uint32 MaxNameIds     = NameIdPageSize * MaxNameIdPages;
+
+    struct NameIdPage
+    {
+        std::atomic<ResourceArray*> Arrays[NameIdPageSize] = {};
+    };
+
+    std::array<std::atomic<NameIdPage*>, MaxNameIdPages> m_NameIdPages = {};
+
+    std::vector<std::unique_ptr<NameIdPage>>    m_OwnedPages;
+    std::vector<std::unique_ptr<ResourceArray>> m_OwnedArrays;
+
+    // Registry that interned the names in the name ID table
+    const ResourceNameRegistry* const m_pNameRegistry;
 };
 
 } // namespace Diligent
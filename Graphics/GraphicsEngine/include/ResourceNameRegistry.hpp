@@ -0,0 +1,71 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::ResourceNameRegistry class
+
+#include <mutex>
+#include <unordered_map>
+
+#include "BasicTypes.h"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+/// Interns shader resource names into stable integer IDs.
+
+/// The registry is shared by all pipeline resource signatures and resource mappings
+/// created in the same module. Pipeline resource signatures intern the names of their
+/// resources when they are created, and resource mappings intern the names of the resources
+/// that are added to them, so that binding resources from a mapping does not require hashing
+/// and comparing strings. IDs are never released.
+class ResourceNameRegistry
+{
+public:
+    static constexpr Uint32 InvalidId = ~Uint32{0};
+
+    /// Returns the registry instance of the current module.
+    static ResourceNameRegistry& Get();
+
+    /// Returns the ID of the name, registering the name if necessary.
+    Uint32 Intern(const Char* Name);
+
+    /// Returns the ID of the name, or InvalidId if the name has never been registered.
+    Uint32 Find(const Char* Name) const;
+
+private:
+    ResourceNameRegistry() = default;
+
+    mutable std::mutex m_Mtx;
+
+    std::unordered_map<HashMapStringKey, Uint32, HashMapStringKey::Hasher> m_Ids;
+};
+
+} // namespace Diligent
@@ -32,9 +32,11 @@
 
 #include <array>
 #include <functional>
+#include <cstring>
 
 #include "PrivateConstants.h"
 #include "ShaderResourceBinding.h"
+#include "DeviceContext.h"
 #include "ObjectBase.hpp"
 #include "GraphicsTypes.h"
 #include "Constants.h"
@@ -123,6 +125,9 @@ public:
                 const SHADER_RESOURCE_VARIABLE_TYPE VarTypes[] = {SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC};
                 m_pShaderVarMgrs[MgrInd].Initialize(*pPRS, VarDataAllocator, VarTypes, _countof(VarTypes), ShaderType);
             }
+
+            if (pPRS->GetInlineConstantsCount() > 0)
+                InitializeInlineConstants();
         }
         catch (...)
         {
@@ -266,10 +271,108 @@ public:
         return StaleVarTypes;
     }
 
+    /// Implementation of IShaderResourceBinding::SetVariables().
+    virtual void DILIGENT_CALL_TYPE SetVariables(const ShaderResourceVariableUpdate* pUpdates,
+                                                 Uint32                              NumUpdates) override final
+    {
+        DEV_CHECK_ERR(pUpdates != nullptr || NumUpdates == 0, "pUpdates must not be null");
+
+        const PIPELINE_TYPE PipelineType = GetPipelineType();
+
+        // Updates are typically grouped by shader stage, so cache the last variable manager
+        SHADER_TYPE                    MgrShaderType = SHADER_TYPE_UNKNOWN;
+        ShaderVariableManagerImplType* pMgr          = nullptr;
+        for (Uint32 i = 0; i < NumUpdates; ++i)
+        {
+            const ShaderResourceVariableUpdate& Update = pUpdates[i];
+            if (Update.ShaderType != MgrShaderType || pMgr == nullptr)
+            {
+                MgrShaderType = Update.ShaderType;
+                pMgr          = nullptr;
+                if (IsConsistentShaderType(Update.ShaderType, PipelineType))
+                {
+                    const int MgrInd = m_ActiveShaderStageIndex[GetShaderTypePipelineIndex(Update.ShaderType, PipelineType)];
+                    if (MgrInd >= 0)
+                    {
+                        VERIFY_EXPR(static_cast<Uint32>(MgrInd) < GetNumShaders());
+                        pMgr = &m_pShaderVarMgrs[MgrInd];
+                    }
+                }
+            }
+
+            auto* pVar = pMgr != nullptr ?
+                (Update.Name != nullptr ? pMgr->GetVariable(Update.Name) : pMgr->GetVariable(Update.VariableIndex)) :
+                nullptr;
+            if (pVar == nullptr)
+            {
+                if (Update.Name != nullptr)
+                {
+                    DEV_ERROR("Update ", i, ": unable to find mutable/dynamic variable '", Update.Name, "' in shader stage ",
+                              GetShaderTypeLiteralName(Update.ShaderType), " of pipeline resource signature '", m_pPRS->GetDesc().Name, "'.");
+                }
+                else
+                {
+                    DEV_ERROR("Update ", i, ": unable to find mutable/dynamic variable at index ", Update.VariableIndex, " in shader stage ",
+                              GetShaderTypeLiteralName(Update.ShaderType), " of pipeline resource signature '", m_pPRS->GetDesc().Name, "'.");
+                }
+                continue;
+            }
+
+            DEV_CHECK_ERR(Update.ppObjects != nullptr || Update.NumElements == 0, "Update ", i, ": ppObjects must not be null");
+            if (Update.BufferOffset != 0 || Update.BufferRangeSize != 0)
+            {
+                DEV_CHECK_ERR(Update.NumElements == 1, "Update ", i, ": buffer range may only be set for a single element");
+                pVar->SetBufferRange(Update.ppObjects[0], Update.BufferOffset, Update.BufferRangeSize, Update.FirstElement, Update.Flags);
+            }
+            else
+            {
+                pVar->SetArray(Update.ppObjects, Update.FirstElement, Update.NumElements, Update.Flags);
+            }
+        }
+    }
+
     ShaderResourceCacheImplType&       GetResourceCache() { return m_ShaderResourceCache; }
     const ShaderResourceCacheImplType& GetResourceCache() const { return m_ShaderResourceCache; }
 
+    /// Writes inline constants to the buffers that emulate them in backends without native support.
+    void UpdateInlineConstantBuffers(IDeviceContext* pContext)
+    {
+        for (Uint32 i = 0; i < m_pPRS->GetInlineConstantsCount(); ++i)
+        {
+            const auto& InlineCB = m_pPRS->GetInlineConstantsAttribs(i);
+            if (!InlineCB.pBuffer)
+                continue;
+
+            void* pMappedData = nullptr;
+            pContext->MapBuffer(InlineCB.pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pMappedData);
+            if (pMappedData == nullptr)
+                continue;
+            memcpy(pMappedData, m_ShaderResourceCache.GetInlineConstants(InlineCB.Offset), InlineCB.NumConstants * sizeof(Uint32));
+            pContext->UnmapBuffer(InlineCB.pBuffer, MAP_WRITE);
+        }
+    }
+
 private:
+    void InitializeInlineConstants()
+    {
+        m_ShaderResourceCache.InitializeInlineConstants(m_pPRS->GetTotalInlineConstantCount());
+
+        for (Uint32 i = 0; i < m_pPRS->GetInlineConstantsCount(); ++i)
+        {
+            const auto& InlineCB = m_pPRS->GetInlineConstantsAttribs(i);
+            if (!InlineCB.pBuffer)
+                continue;
+
+            // Bind the emulation buffer once; all stages share the same cache slot.
+            const PipelineResourceDesc& ResDesc      = m_pPRS->GetResourceDesc(InlineCB.ResIndex);
+            SHADER_TYPE                 ShaderStages = ResDesc.ShaderStages;
+            if (IShaderResourceVariable* pVar = GetVariableByName(ExtractLSB(ShaderStages), ResDesc.Name))
+                pVar->Set(InlineCB.pBuffer, SET_SHADER_RESOURCE_FLAG_NONE);
+            else
+                UNEXPECTED("Failed to find inline constants variable '", ResDesc.Name, "'");
+        }
+    }
+
     void Destruct()
     {
         if (m_pShaderVarMgrs != nullptr)
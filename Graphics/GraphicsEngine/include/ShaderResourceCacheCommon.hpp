@@ -31,8 +31,12 @@
 /// Definition of the common share resource cache constants
 
 #include <atomic>
+#include <vector>
+#include <cstring>
 
 #include "BasicTypes.h"
+#include "DebugUtilities.hpp"
+#include "UniqueIdentifier.hpp"
 
 namespace Diligent
 {
@@ -50,11 +54,41 @@ enum class ResourceCacheContentType : Uint8
 class ShaderResourceCacheBase
 {
 public:
+    /// Allocates storage for the inline constants of all resources in the signature.
+    void InitializeInlineConstants(Uint32 TotalConstantCount)
+    {
+        VERIFY(m_InlineConstants.empty(), "Inline constants have already been initialized");
+        m_InlineConstants.resize(TotalConstantCount);
+    }
+
+    /// Copies NumConstants 32-bit values to the inline constant storage starting at Offset.
+    void SetInlineConstants(Uint32 Offset, const void* pConstants, Uint32 NumConstants)
+    {
+        VERIFY_EXPR(size_t{Offset} + NumConstants <= m_InlineConstants.size());
+        if (NumConstants == 0)
+            return;
+        memcpy(&m_InlineConstants[Offset], pConstants, NumConstants * sizeof(Uint32));
+        UpdateRevision();
+    }
+
+    const Uint32* GetInlineConstants(Uint32 Offset) const
+    {
+        VERIFY_EXPR(Offset < m_InlineConstants.size());
+        return &m_InlineConstants[Offset];
+    }
+
 #ifdef DILIGENT_DEVELOPMENT
     uint32_t DvpGetRevision() const
     {
         return m_DvpRevision.load();
     }
+
+    /// Returns the identifier that is unique for every cache, unlike the cache address
+    /// that may be reused after the cache is destroyed.
+    UniqueIdentifier DvpGetUniqueID() const
+    {
+        return m_DvpUniqueId.GetID();
+    }
 #endif
 
 protected:
@@ -65,8 +99,18 @@ protected:
 #endif
     }
 
+    // CPU-side copy of the inline constants, for SRB caches only
+    std::vector<Uint32> m_InlineConstants;
+
+    // False when the state transition loop found that no resource in the cache requires state
+    // transitions, e.g. all textures are in constant state (see MISC_TEXTURE_FLAG_CONSTANT_STATE).
+    // The flag is reset when any resource is bound.
+    bool m_StateTransitionsRequired = true;
+
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<uint32_t> m_DvpRevision{0};
+
+    UniqueIdHelper<ShaderResourceCacheBase> m_DvpUniqueId;
 #endif
 };
 
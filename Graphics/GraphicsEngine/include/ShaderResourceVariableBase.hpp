@@ -34,10 +34,12 @@
 
 #include "ShaderResourceVariable.h"
 #include "PipelineState.h"
+#include "Buffer.h"
 #include "StringTools.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ShaderResourceCacheCommon.hpp"
 #include "RefCntAutoPtr.hpp"
+#include "ResourceMappingImpl.hpp"
 #include "EngineMemory.h"
 
 namespace Diligent
@@ -626,6 +628,36 @@ std::string GetShaderGroupName(const ShaderVectorType& Shaders)
     return Name;
 }
 
+/// Finds the resources of a shader variable in a resource mapping.
+
+/// If the mapping is implemented by ResourceMappingImpl, the resources are found
+/// by the name ID interned by the pipeline resource signature, which avoids hashing
+/// the name and locking the mapping for every array element.
+class ResourceMappingLookup
+{
+public:
+    ResourceMappingLookup(IResourceMapping* pResourceMapping, Uint32 NameId, const Char* Name) :
+        m_pResourceMapping{pResourceMapping},
+        m_pMappingImpl{pResourceMapping, ResourceMappingImpl::IID_InternalImpl},
+        m_NameId{NameId},
+        m_Name{Name}
+    {}
+
+    IDeviceObject* operator()(Uint32 ArrayIndex) const
+    {
+        VERIFY_EXPR(m_pResourceMapping != nullptr);
+        return m_pMappingImpl ?
+            m_pMappingImpl->GetResourceById(m_NameId, m_Name, ArrayIndex) :
+            m_pResourceMapping->GetResource(m_Name, ArrayIndex);
+    }
+
+private:
+    IResourceMapping* const                  m_pResourceMapping;
+    const RefCntAutoPtr<ResourceMappingImpl> m_pMappingImpl;
+    const Uint32                             m_NameId;
+    const Char* const                        m_Name;
+};
+
 /// Base implementation of a shader variable
 template <typename ThisImplType,
           typename VarManagerType,
@@ -668,6 +700,9 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
     virtual void DILIGENT_CALL_TYPE Set(IDeviceObject* pObject, SET_SHADER_RESOURCE_FLAGS Flags) override final
     {
+        // The only object that may be bound to inline constants is the internal buffer that emulates them
+        DEV_CHECK_ERR(!IsInlineConstants() || pObject == m_ParentManager.GetInlineConstantsBuffer(m_ResIndex),
+                      "Resources can't be bound to inline constants variable '", GetDesc().Name, "'. Use SetInlineConstants() instead.");
         static_cast<ThisImplType*>(this)->BindResource(BindResourceInfo{pObject, Flags});
     }
 
@@ -678,6 +713,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
     {
         const PipelineResourceDesc& Desc = GetDesc();
 
+        DEV_CHECK_ERR(!IsInlineConstants(), "SetArray() is not allowed for inline constants variable '", Desc.Name, "'. Use SetInlineConstants() instead.");
         DEV_CHECK_ERR(FirstElement + NumElements <= Desc.ArraySize,
                       "SetArray arguments are invalid for '", Desc.Name, "' variable: specified element range (", FirstElement, " .. ",
                       FirstElement + NumElements - 1, ") is out of array bounds 0 .. ", Desc.ArraySize - 1);
@@ -693,6 +729,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
                                                    SET_SHADER_RESOURCE_FLAGS Flags) override
     {
         DEV_CHECK_ERR(GetDesc().ResourceType == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, "SetBufferRange() is only allowed for constant buffers.");
+        DEV_CHECK_ERR(!IsInlineConstants(), "SetBufferRange() is not allowed for inline constants variable '", GetDesc().Name, "'.");
         static_cast<ThisImplType*>(this)->BindResource(BindResourceInfo{ArrayIndex, pObject, Flags, Offset, Size});
     }
 
@@ -706,12 +743,33 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
                           "SetBufferOffset() is not only allowed for variables created with PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS flag.");
             DEV_CHECK_ERR(Desc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_STATIC,
                           "SetBufferOffset() is not allowed for static variables.");
+            DEV_CHECK_ERR(!IsInlineConstants(), "SetBufferOffset() is not allowed for inline constants variable '", Desc.Name, "'.");
         }
 #endif
 
         static_cast<ThisImplType*>(this)->SetDynamicOffset(ArrayIndex, Offset);
     }
 
+    virtual void DILIGENT_CALL_TYPE SetInlineConstants(const void* pConstants,
+                                                       Uint32      FirstConstant,
+                                                       Uint32      NumConstants) override final
+    {
+#ifdef DILIGENT_DEVELOPMENT
+        {
+            const PipelineResourceDesc& Desc = GetDesc();
+            DEV_CHECK_ERR(IsInlineConstants(), "SetInlineConstants() is only allowed for variables created with PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS flag, "
+                                               "but variable '",
+                          Desc.Name, "' does not have this flag.");
+            DEV_CHECK_ERR(pConstants != nullptr || NumConstants == 0, "pConstants must not be null");
+            DEV_CHECK_ERR(FirstConstant + NumConstants <= Desc.ArraySize,
+                          "SetInlineConstants arguments are invalid for '", Desc.Name, "' variable: specified constant range (", FirstConstant, " .. ",
+                          FirstConstant + NumConstants - 1, ") is out of bounds 0 .. ", Desc.ArraySize - 1);
+        }
+#endif
+
+        m_ParentManager.SetInlineConstants(m_ResIndex, pConstants, FirstConstant, NumConstants);
+    }
+
 
     virtual SHADER_RESOURCE_VARIABLE_TYPE DILIGENT_CALL_TYPE GetType() const override final
     {
@@ -740,12 +798,17 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
         if ((Flags & (1u << ResDesc.VarType)) == 0)
             return;
 
+        // Inline constants are not bound from resource mappings
+        if (IsInlineConstants())
+            return;
+
+        ResourceMappingLookup Lookup{pResourceMapping, m_ParentManager.GetResourceNameId(m_ResIndex), ResDesc.Name};
         for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
         {
             if ((Flags & BIND_SHADER_RESOURCES_KEEP_EXISTING) != 0 && pThis->Get(ArrInd) != nullptr)
                 continue;
 
-            if (IDeviceObject* pObj = pResourceMapping->GetResource(ResDesc.Name, ArrInd))
+            if (IDeviceObject* pObj = Lookup(ArrInd))
             {
                 const SET_SHADER_RESOURCE_FLAGS SetResFlags = (Flags & BIND_SHADER_RESOURCES_ALLOW_OVERWRITE) != 0 ?
                     SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE :
@@ -777,6 +840,10 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
         if ((StaleVarTypes & VarTypeFlag) != 0)
             return; // This variable type is already stale
 
+        if (IsInlineConstants())
+            return; // Inline constants are not bound from resource mappings
+
+        ResourceMappingLookup Lookup{pResourceMapping, m_ParentManager.GetResourceNameId(m_ResIndex), ResDesc.Name};
         for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
         {
             const IDeviceObject* const pBoundObj = pThis->Get(ArrInd);
@@ -791,7 +858,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
             if (pResourceMapping != nullptr)
             {
-                if (IDeviceObject* pObj = pResourceMapping->GetResource(ResDesc.Name, ArrInd))
+                if (IDeviceObject* pObj = Lookup(ArrInd))
                 {
                     if (pObj != pBoundObj)
                     {
@@ -805,6 +872,8 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
     const PipelineResourceDesc& GetDesc() const { return m_ParentManager.GetResourceDesc(m_ResIndex); }
 
+    bool IsInlineConstants() const { return (GetDesc().Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0; }
+
 protected:
     // Variable manager that owns this variable
     VarManagerType& m_ParentManager;
@@ -832,6 +901,31 @@ protected:
         VERIFY(m_pVariables == nullptr, "Destroy() has not been called. The shader variable memory will leak.");
     }
 
+public:
+    // Returns the ID of the resource name interned by the pipeline resource signature
+    Uint32 GetResourceNameId(Uint32 ResIndex) const
+    {
+        VERIFY_EXPR(m_pSignature != nullptr);
+        return m_pSignature->GetResourceNameId(ResIndex);
+    }
+
+    // Copies inline constants of the resource to the resource cache
+    void SetInlineConstants(Uint32 ResIndex, const void* pConstants, Uint32 FirstConstant, Uint32 NumConstants)
+    {
+        VERIFY_EXPR(m_pSignature != nullptr);
+        const auto& InlineCB = m_pSignature->GetInlineConstantsAttribsByResIndex(ResIndex);
+        m_ResourceCache.SetInlineConstants(InlineCB.Offset + FirstConstant, pConstants, NumConstants);
+    }
+
+    // Returns the buffer that emulates inline constants of the resource, or null if they are natively supported
+    IBuffer* GetInlineConstantsBuffer(Uint32 ResIndex) const
+    {
+        VERIFY_EXPR(m_pSignature != nullptr);
+        return m_pSignature->GetInlineConstantsAttribsByResIndex(ResIndex).pBuffer;
+    }
+
+protected:
+
     void Initialize(const PipelineResourceSignatureType& Signature, IMemoryAllocator& Allocator, size_t Size)
     {
         VERIFY_EXPR(m_pSignature == nullptr);
@@ -32,6 +32,8 @@
 
 #include <memory>
 #include <array>
+#include <mutex>
+#include <unordered_map>
 
 #include "Texture.h"
 #include "GraphicsTypes.h"
@@ -40,6 +42,7 @@
 #include "STDAllocator.hpp"
 #include "FormatString.hpp"
 #include "PlatformMisc.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
@@ -160,11 +163,15 @@ public:
         else
             UNEXPECTED("Unexpected texture view type.");
 
-        CreateViewInternal(ViewDesc, ppView, false);
+        if (this->m_Desc.MiscFlags & MISC_TEXTURE_FLAG_CACHE_VIEWS)
+            CreateCachedView(ViewDesc, ppView);
+        else
+            CreateViewInternal(ViewDesc, ppView, false);
     }
 
     ~TextureBase()
     {
+        DestroyCachedViews();
         DestroyDefaultViews();
     }
 
@@ -293,6 +300,9 @@ public:
 
     virtual void DILIGENT_CALL_TYPE SetState(RESOURCE_STATE State) override final
     {
+        DEV_CHECK_ERR(!IsInConstantState() || State == RESOURCE_STATE_SHADER_RESOURCE,
+                      "The state of texture '", this->m_Desc.Name, "' created with MISC_TEXTURE_FLAG_CONSTANT_STATE flag can't be changed to ",
+                      GetResourceStateString(State), " after it has been transitioned to RESOURCE_STATE_SHADER_RESOURCE.");
         this->m_State = State;
     }
 
@@ -306,6 +316,13 @@ public:
         return this->m_State != RESOURCE_STATE_UNKNOWN;
     }
 
+    /// Returns true if the texture was created with MISC_TEXTURE_FLAG_CONSTANT_STATE flag and has reached
+    /// RESOURCE_STATE_SHADER_RESOURCE state. The state of such texture never changes and requires no transitions.
+    bool IsInConstantState() const
+    {
+        return (this->m_Desc.MiscFlags & MISC_TEXTURE_FLAG_CONSTANT_STATE) != 0 && this->m_State == RESOURCE_STATE_SHADER_RESOURCE;
+    }
+
     bool CheckState(RESOURCE_STATE State) const
     {
         VERIFY((State & (State - 1)) == 0, "Single state is expected");
@@ -369,6 +386,50 @@ protected:
         m_pDefaultViews = nullptr;
     }
 
+    // Returns the cached view with the same description, or creates a new one. Similar to
+    // default views, cached views share the reference counters with the texture.
+    void CreateCachedView(const TextureViewDesc& ViewDesc, ITextureView** ppView)
+    {
+        VERIFY(ppView != nullptr, "View pointer address is null");
+        VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+        std::lock_guard<std::mutex> Guard{m_CachedViewsMtx};
+
+        auto it = m_CachedViews.find(ViewDesc);
+        if (it == m_CachedViews.end())
+        {
+            TextureViewImplType* pView = nullptr;
+            CreateViewInternal(ViewDesc, reinterpret_cast<ITextureView**>(&pView), true);
+            if (pView == nullptr)
+                return;
+
+            TextureViewDesc Key = ViewDesc;
+            // The name is ignored by the comparison and the hash, and may not outlive this call
+            Key.Name = nullptr;
+            it       = m_CachedViews.emplace(Key, pView).first;
+        }
+
+        *ppView = it->second;
+        (*ppView)->AddRef();
+    }
+
+    void DestroyCachedViews()
+    {
+        if (m_CachedViews.empty())
+            return;
+
+        TexViewObjAllocatorType& TexViewAllocator = this->GetDevice()->GetTexViewObjAllocator();
+        VERIFY(&TexViewAllocator == &m_dbgTexViewObjAllocator, "Texture view allocator does not match allocator provided during texture initialization");
+
+        for (auto& it : m_CachedViews)
+        {
+            TextureViewImplType* pView = it.second;
+            pView->~TextureViewImplType();
+            TexViewAllocator.Free(pView);
+        }
+        m_CachedViews.clear();
+    }
+
     /// Pure virtual function that is implemented in every backend.
     virtual void CreateViewInternal(const struct TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView) = 0;
 
@@ -411,6 +472,10 @@ protected:
     RESOURCE_STATE m_State = RESOURCE_STATE_UNKNOWN;
 
     std::unique_ptr<SparseTextureProperties> m_pSparseProps;
+
+    // Views created by CreateView() when MISC_TEXTURE_FLAG_CACHE_VIEWS flag is set
+    std::mutex                                                m_CachedViewsMtx;
+    std::unordered_map<TextureViewDesc, TextureViewImplType*> m_CachedViews;
 };
 
 } // namespace Diligent
@@ -220,6 +220,58 @@ public:
         return true;
     }
 
+    // Updates the instances that changed since the previous build (see TLAS_INSTANCE_UPLOAD_MODE_DIRTY).
+    // Instance indices and, unless the binding mode is user-defined, hit group indices are preserved.
+    bool UpdateDirtyInstances(const TLASBuildInstanceData* pInstances,
+                              const Uint32                 DirtyInstanceCount) noexcept
+    {
+#ifdef DILIGENT_DEVELOPMENT
+        bool Changed = false;
+#endif
+        for (Uint32 i = 0; i < DirtyInstanceCount; ++i)
+        {
+            const TLASBuildInstanceData& Inst = pInstances[i];
+            auto                         Iter = this->m_Instances.find(Inst.InstanceName);
+
+            if (Iter == this->m_Instances.end())
+            {
+                UNEXPECTED("Failed to find instance with name '", Inst.InstanceName, "' in instances from the previous build");
+                return false;
+            }
+
+            InstanceDesc&                        Desc      = Iter->second;
+            const Uint32                         PrevIndex = Desc.ContributionToHitGroupIndex;
+            RefCntAutoPtr<BottomLevelASImplType> pPrevBLAS = Desc.pBLAS;
+
+            Desc.pBLAS = ClassPtrCast<BottomLevelASImplType>(Inst.pBLAS);
+            if (this->m_BuildInfo.BindingMode == HIT_GROUP_BINDING_MODE_USER_DEFINED)
+            {
+                Desc.ContributionToHitGroupIndex = Inst.ContributionToHitGroupIndex;
+            }
+            else if (this->m_BuildInfo.BindingMode == HIT_GROUP_BINDING_MODE_PER_GEOMETRY)
+            {
+                DEV_CHECK_ERR(pPrevBLAS == nullptr || pPrevBLAS->GetActualGeometryCount() == Desc.pBLAS->GetActualGeometryCount(),
+                              "The new BLAS of instance '", Inst.InstanceName, "' has ", Desc.pBLAS->GetActualGeometryCount(),
+                              " geometries, while the previous one has ", pPrevBLAS->GetActualGeometryCount(),
+                              ". Hit group indices are preserved for dirty instances, so the geometry count must not change.");
+            }
+
+#ifdef DILIGENT_DEVELOPMENT
+            Changed         = Changed || (pPrevBLAS != Desc.pBLAS);
+            Changed         = Changed || (PrevIndex != Desc.ContributionToHitGroupIndex);
+            Desc.dvpVersion = Desc.pBLAS->DvpGetVersion();
+#else
+            (void)PrevIndex;
+#endif
+        }
+
+#ifdef DILIGENT_DEVELOPMENT
+        if (Changed)
+            this->m_DvpVersion.fetch_add(1);
+#endif
+        return true;
+    }
+
     void CopyInstanceData(const TopLevelASBase& Src) noexcept
     {
         ClearInstanceData();
@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of the XXH3-based hasher for engine structures
+
+#include <cstring>
+#include <type_traits>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Common/interface/HashUtils.hpp"
+
+namespace Diligent
+{
+
+/// Computes the 64-bit XXH3 hash of the data using the given seed.
+Uint64 ComputeXXH3Hash(const void* pData, size_t Size, Uint64 Seed = 0) noexcept;
+
+/// Hasher that is compatible with HashCombiner and feeds the data to XXH3.
+
+/// Fundamental values, enums and strings are packed into an internal buffer that is hashed
+/// with a single XXH3 call when it is full or when the hash is requested. Large raw spans
+/// are hashed directly. This is considerably faster than DefaultHasher, which combines
+/// the hash of every member with HashCombine(), for large structures such as
+/// GraphicsPipelineDesc or RenderPassDesc and for long arrays of POD values.
+///
+/// \note   The hash is not stable across different versions of the engine and
+///         must not be serialized.
+class XXH3Hasher
+{
+public:
+    template <typename T>
+    typename std::enable_if<std::is_fundamental<T>::value || std::is_enum<T>::value>::type Update(const T& Val) noexcept
+    {
+        Append(&Val, sizeof(Val));
+    }
+
+    // Pointers and API handles are hashed by value, while strings are hashed by contents
+    template <typename T>
+    typename std::enable_if<std::is_pointer<T>::value>::type Update(const T& Ptr) noexcept
+    {
+        Append(&Ptr, sizeof(Ptr));
+    }
+
+    void Update(const Char* Str) noexcept
+    {
+        // Distinguish null and empty strings
+        const Uint64 Len = Str != nullptr ? strlen(Str) + 1 : 0;
+        Update(Len);
+        UpdateRaw(Str, static_cast<size_t>(Len));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value>::type Update(const T& Val) noexcept
+    {
+        HashCombiner<XXH3Hasher, T> Combiner{*this};
+        Combiner(Val);
+    }
+
+    template <typename FirstArgType, typename SecondArgType, typename... RestArgsType>
+    void Update(const FirstArgType& FirstArg, const SecondArgType& SecondArg, const RestArgsType&... RestArgs) noexcept
+    {
+        Update(FirstArg);
+        Update(SecondArg, RestArgs...);
+    }
+
+    template <typename... ArgsType>
+    void operator()(const ArgsType&... Args) noexcept
+    {
+        Update(Args...);
+    }
+
+    /// Hashes a contiguous span of POD values with a single call.
+    template <typename T>
+    void UpdateSpan(const T* pData, size_t Count) noexcept
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be hashed as raw spans");
+        UpdateRaw(pData, sizeof(T) * Count);
+    }
+
+    void UpdateRaw(const void* pData, uint64_t Size) noexcept
+    {
+        if (Size <= sizeof(m_Buffer) - m_BufferSize)
+        {
+            Append(pData, static_cast<size_t>(Size));
+        }
+        else if (Size != 0)
+        {
+            Flush();
+            m_Seed = ComputeXXH3Hash(pData, static_cast<size_t>(Size), m_Seed);
+        }
+    }
+
+    size_t Get() noexcept
+    {
+        Flush();
+        return static_cast<size_t>(m_Seed);
+    }
+
+private:
+    void Append(const void* pData, size_t Size) noexcept
+    {
+        if (m_BufferSize + Size > sizeof(m_Buffer))
+            Flush();
+        memcpy(m_Buffer + m_BufferSize, pData, Size);
+        m_BufferSize += Size;
+    }
+
+    void Flush() noexcept
+    {
+        if (m_BufferSize != 0)
+        {
+            m_Seed       = ComputeXXH3Hash(m_Buffer, m_BufferSize, m_Seed);
+            m_BufferSize = 0;
+        }
+    }
+
+private:
+    Uint64 m_Seed       = 0;
+    size_t m_BufferSize = 0;
+    Uint8  m_Buffer[256];
+};
+
+/// Aggregate hasher that can be used with std::unordered_map and std::unordered_set
+/// in place of StdHasher when the keys are large.
+template <typename Type>
+struct XXH3StdHasher
+{
+    size_t operator()(const Type& Val) const noexcept
+    {
+        XXH3Hasher Hasher;
+        Hasher(Val);
+        return Hasher.Get();
+    }
+};
+
+} // namespace Diligent
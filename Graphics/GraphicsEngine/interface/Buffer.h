@@ -79,6 +79,15 @@ DILIGENT_TYPED_ENUM(MISC_BUFFER_FLAGS, Uint8)
     /// For a sparse buffer, allow binding the same memory region in different buffer ranges
     /// or in different sparse buffers.
     MISC_BUFFER_FLAG_SPARSE_ALIASING = 1u << 0,
+
+    /// The buffer memory may be exported to other APIs or processes
+    /// (e.g. video encoders or CUDA) without copying.
+
+    /// \remarks   Requires the ExternalMemory device feature and USAGE_DEFAULT.
+    ///            The buffer is always placed in its own memory allocation. Use
+    ///            IBufferVk::ExportMemoryHandle() or IBufferD3D12::CreateSharedHandle()
+    ///            to obtain the handle.
+    MISC_BUFFER_FLAG_EXPORTABLE      = 1u << 1,
 };
 DEFINE_FLAG_ENUM_OPERATORS(MISC_BUFFER_FLAGS)
 
@@ -272,6 +272,33 @@ DILIGENT_BEGIN_INTERFACE(IDearchiver, IObject)
                                              const PipelineStateUnpackInfo REF UnpackInfo,
                                              IPipelineState**                  ppPSO) PURE;
 
+    /// Unpacks multiple pipeline state objects from the device object archive.
+
+    /// \param [in]  pUnpackInfos - An array of NumPSOs pipeline state unpack info structures,
+    ///                             see Diligent::PipelineStateUnpackInfo.
+    /// \param [in]  NumPSOs      - The number of pipeline states to unpack.
+    /// \param [out] ppPSOs       - An array of NumPSOs memory locations where pointers to the
+    ///                             unpacked pipeline state objects will be stored.
+    ///                             The function calls AddRef() for every PSO, so that each
+    ///                             object will have one reference. If a PSO fails to
+    ///                             unpack, null is written to its location.
+    ///
+    /// \remarks  Resource signatures, render passes and shaders that are shared by
+    ///           multiple pipelines are unpacked only once. If the dearchiver was created
+    ///           with a thread pool (see DearchiverCreateInfo::pThreadPool), deserialization
+    ///           and object creation are performed in parallel by the pool's threads.
+    ///
+    ///           Pipeline states are created with the PSO_CREATE_FLAG_ASYNCHRONOUS flag, so
+    ///           if the device supports asynchronous shader compilation, an application
+    ///           should use IPipelineState::GetStatus() to check when a pipeline is ready.
+    ///           The flag can be reset by the ModifyPipelineStateCreateInfo callback.
+    ///
+    /// \note   This method is thread-safe.
+    VIRTUAL void METHOD(UnpackPipelineStates)(THIS_
+                                              const PipelineStateUnpackInfo* pUnpackInfos,
+                                              Uint32                         NumPSOs,
+                                              IPipelineState**               ppPSOs) PURE;
+
     /// Unpacks resource signature from the device object archive.
 
     /// \param [in]  UnpackInfo  - Resource signature unpack info, see Diligent::ResourceSignatureUnpackInfo.
@@ -329,6 +356,7 @@ DILIGENT_END_INTERFACE
 #    define IDearchiver_LoadArchive(This, ...)             CALL_IFACE_METHOD(Dearchiver, LoadArchive,             This, __VA_ARGS__)
 #    define IDearchiver_UnpackShader(This, ...)            CALL_IFACE_METHOD(Dearchiver, UnpackShader,            This, __VA_ARGS__)
 #    define IDearchiver_UnpackPipelineState(This, ...)     CALL_IFACE_METHOD(Dearchiver, UnpackPipelineState,     This, __VA_ARGS__)
+#    define IDearchiver_UnpackPipelineStates(This, ...)    CALL_IFACE_METHOD(Dearchiver, UnpackPipelineStates,    This, __VA_ARGS__)
 #    define IDearchiver_UnpackResourceSignature(This, ...) CALL_IFACE_METHOD(Dearchiver, UnpackResourceSignature, This, __VA_ARGS__)
 #    define IDearchiver_UnpackRenderPass(This, ...)        CALL_IFACE_METHOD(Dearchiver, UnpackRenderPass,        This, __VA_ARGS__)
 #    define IDearchiver_Store(This, ...)                   CALL_IFACE_METHOD(Dearchiver, Store,                   This, __VA_ARGS__)
@@ -49,6 +49,8 @@
 #include "PipelineState.h"
 #include "Fence.h"
 #include "Query.h"
+#include "QueryPool.h"
+#include "IndirectCommandSignature.h"
 #include "RenderPass.h"
 #include "Framebuffer.h"
 #include "CommandList.h"
@@ -537,6 +539,81 @@ struct DrawIndexedIndirectAttribs
 typedef struct DrawIndexedIndirectAttribs DrawIndexedIndirectAttribs;
 
 
+/// Defines the attributes of the indirect commands execution.
+
+/// This structure is used by IDeviceContext::ExecuteIndirectCommands().
+struct ExecuteIndirectCommandsAttribs
+{
+    /// Indirect command signature that defines the layout of the commands.
+    IIndirectCommandSignature* pSignature DEFAULT_INITIALIZER(nullptr);
+
+    /// A pointer to the buffer, from which the command arguments will be read.
+
+    /// The arguments of command N are read at the offset
+    ///
+    ///     ArgsOffset + N * pSignature->GetCommandStride()
+    IBuffer* pArgsBuffer            DEFAULT_INITIALIZER(nullptr);
+
+    /// Offset from the beginning of the arguments buffer to the first command.
+    Uint64 ArgsOffset               DEFAULT_INITIALIZER(0);
+
+    /// The number of commands to execute.
+
+    /// When `pCounterBuffer` is not null, this member
+    /// defines the maximum number of commands that will be executed.
+    Uint32 MaxCommandCount          DEFAULT_INITIALIZER(1);
+
+    /// The type of the elements in the index buffer bound to the context.
+
+    /// Only used when the signature contains indexed draw argument, but
+    /// no index buffer argument. Allowed values: `VT_UINT16` and `VT_UINT32`.
+    VALUE_TYPE IndexType            DEFAULT_INITIALIZER(VT_UNDEFINED);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS Flags                DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+    /// State transition mode for the arguments buffer.
+    RESOURCE_STATE_TRANSITION_MODE ArgsBufferStateTransitionMode DEFAULT_INITIALIZER(RESOURCE_STATE_TRANSITION_MODE_NONE);
+
+    /// A pointer to the optional buffer, from which Uint32 value with the command count will be read.
+    IBuffer* pCounterBuffer         DEFAULT_INITIALIZER(nullptr);
+
+    /// When `pCounterBuffer` is not null, offset from the beginning of the counter buffer to the
+    /// location of the command counter.
+    Uint64 CounterOffset            DEFAULT_INITIALIZER(0);
+
+    /// When counter buffer is not null, state transition mode for the count buffer.
+    RESOURCE_STATE_TRANSITION_MODE CounterBufferStateTransitionMode DEFAULT_INITIALIZER(RESOURCE_STATE_TRANSITION_MODE_NONE);
+
+#if DILIGENT_CPP_INTERFACE
+    /// Initializes the structure members with default values
+    constexpr ExecuteIndirectCommandsAttribs() noexcept {}
+
+    /// Initializes the structure members with user-specified values.
+    constexpr ExecuteIndirectCommandsAttribs(IIndirectCommandSignature*     _pSignature,
+                                             IBuffer*                       _pArgsBuffer,
+                                             Uint32                         _MaxCommandCount,
+                                             DRAW_FLAGS                     _Flags                       = ExecuteIndirectCommandsAttribs{}.Flags,
+                                             Uint64                         _ArgsOffset                  = ExecuteIndirectCommandsAttribs{}.ArgsOffset,
+                                             RESOURCE_STATE_TRANSITION_MODE _ArgsBufferTransitionMode    = ExecuteIndirectCommandsAttribs{}.ArgsBufferStateTransitionMode,
+                                             IBuffer*                       _pCounterBuffer              = ExecuteIndirectCommandsAttribs{}.pCounterBuffer,
+                                             Uint64                         _CounterOffset               = ExecuteIndirectCommandsAttribs{}.CounterOffset,
+                                             RESOURCE_STATE_TRANSITION_MODE _CounterBufferTransitionMode = ExecuteIndirectCommandsAttribs{}.CounterBufferStateTransitionMode) noexcept :
+        pSignature                      {_pSignature                 },
+        pArgsBuffer                     {_pArgsBuffer                },
+        ArgsOffset                      {_ArgsOffset                 },
+        MaxCommandCount                 {_MaxCommandCount            },
+        Flags                           {_Flags                      },
+        ArgsBufferStateTransitionMode   {_ArgsBufferTransitionMode   },
+        pCounterBuffer                  {_pCounterBuffer             },
+        CounterOffset                   {_CounterOffset              },
+        CounterBufferStateTransitionMode{_CounterBufferTransitionMode}
+    {}
+#endif
+};
+typedef struct ExecuteIndirectCommandsAttribs ExecuteIndirectCommandsAttribs;
+
+
 /// Defines the mesh draw command attributes.
 
 /// This structure is used by IDeviceContext::DrawMesh().
@@ -973,6 +1050,53 @@ DILIGENT_TYPED_ENUM(SET_VERTEX_BUFFERS_FLAGS, Uint8)
 DEFINE_FLAG_ENUM_OPERATORS(SET_VERTEX_BUFFERS_FLAGS)
 
 
+/// Defines allowed flags for IDeviceContext::Begin() function.
+DILIGENT_TYPED_ENUM(COMMAND_LIST_FLAGS, Uint8)
+{
+    /// No flags. The command list is consumed when it is executed.
+    COMMAND_LIST_FLAG_NONE     = 0x00,
+
+    /// The command list may be executed any number of times.
+
+    /// A reusable command list is not consumed by IDeviceContext::ExecuteCommandLists().
+    /// It is destroyed when the last reference to it is released, after the GPU has
+    /// finished executing it.
+    ///
+    /// \remarks    A reusable command list records references to GPU memory and must not
+    ///             use memory that is only valid for the current frame:
+    ///             - Dynamic buffers must not be mapped or bound in the list.
+    ///             - IDeviceContext::UpdateBuffer() and IDeviceContext::UpdateTexture() must not be used.
+    ///             - Shader resource bindings must not contain dynamic variables or dynamic buffers.
+    ///             - Queries must not be used.
+    ///
+    ///             Resources must be transitioned to the required states before the list is executed,
+    ///             and the list must use Diligent::RESOURCE_STATE_TRANSITION_MODE_VERIFY or
+    ///             Diligent::RESOURCE_STATE_TRANSITION_MODE_NONE.
+    ///
+    ///             In Vulkan, the command buffer is recorded with VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT,
+    ///             so the list may be executed again while the previous execution is still pending.
+    COMMAND_LIST_FLAG_REUSABLE = 0x01
+};
+DEFINE_FLAG_ENUM_OPERATORS(COMMAND_LIST_FLAGS)
+
+
+/// Defines allowed flags for IDeviceContext::GenerateMips() function.
+DILIGENT_TYPED_ENUM(GENERATE_MIPS_FLAGS, Uint8)
+{
+    /// No extra options.
+    GENERATE_MIPS_FLAG_NONE        = 0x00,
+
+    /// Generate the whole mip chain with a single-pass compute downsampler, if the backend supports it.
+
+    /// The single-pass downsampler produces up to 12 mip levels in one dispatch: every thread group
+    /// reduces a 64x64 source tile in group-shared memory, and the last group to finish, identified
+    /// with a global atomic counter, computes the remaining levels.
+    /// Backends that do not implement the single-pass downsampler ignore this flag.
+    GENERATE_MIPS_FLAG_SINGLE_PASS = 0x01
+};
+DEFINE_FLAG_ENUM_OPERATORS(GENERATE_MIPS_FLAGS)
+
+
 /// Describes the viewport.
 
 /// This structure is used by IDeviceContext::SetViewports().
@@ -1617,6 +1741,37 @@ typedef struct TLASBuildInstanceData TLASBuildInstanceData;
 static DILIGENT_CONSTEXPR Uint32 TLAS_INSTANCE_DATA_SIZE = DILIGENT_TLAS_INSTANCE_DATA_SIZE;
 
 
+/// Defines how IDeviceContext::BuildTLAS() writes the instance data to the instance buffer.
+DILIGENT_TYPED_ENUM(TLAS_INSTANCE_UPLOAD_MODE, Uint8)
+{
+    /// BuildTLASAttribs::pInstances contains all instances, and all of them
+    /// are uploaded to the instance buffer.
+    TLAS_INSTANCE_UPLOAD_MODE_ALL = 0,
+
+    /// BuildTLASAttribs::pInstances contains only the instances that changed since the previous build
+    /// (see BuildTLASAttribs::DirtyInstanceCount), and only their data is uploaded.
+    /// Contiguous instance indices are copied with one command.
+    ///
+    /// The TLAS must have been built before with the same instances, and the instance buffer region
+    /// must still contain the data of the previous build.
+    /// Instances can't be added or removed. To disable an instance, set its mask to zero.
+    TLAS_INSTANCE_UPLOAD_MODE_DIRTY,
+
+    /// The instance buffer already contains the instance data, for example written by a compute shader,
+    /// and nothing is uploaded.
+    ///
+    /// The data must use the native layout (`D3D12_RAYTRACING_INSTANCE_DESC` or `VkAccelerationStructureInstanceKHR`).
+    /// Hit group indices must match ITopLevelAS::GetInstanceDesc(), and BLAS addresses can be queried
+    /// with `IBottomLevelASD3D12::GetD3D12BLAS()->GetGPUVirtualAddress()` or IBottomLevelASVk::GetVkDeviceAddress().
+    ///
+    /// If BuildTLASAttribs::pInstances is not null, it defines the instance names, BLASes and hit group indices
+    /// as in Diligent::TLAS_INSTANCE_UPLOAD_MODE_ALL mode. Otherwise, the instances of the previous build are used.
+    TLAS_INSTANCE_UPLOAD_MODE_GPU,
+
+    TLAS_INSTANCE_UPLOAD_MODE_COUNT
+};
+
+
 /// This structure is used by IDeviceContext::BuildTLAS().
 struct BuildTLASAttribs
 {
@@ -1636,6 +1791,9 @@ struct BuildTLASAttribs
     /// If `Update` is `true`:
     ///     - Any instance data can be changed.
     ///     - To disable an instance set TLASBuildInstanceData::Mask to zero or set empty TLASBuildInstanceData::BLAS to pBLAS.
+    ///
+    /// If `InstanceUploadMode` is Diligent::TLAS_INSTANCE_UPLOAD_MODE_DIRTY, the array contains
+    /// `DirtyInstanceCount` elements. If it is Diligent::TLAS_INSTANCE_UPLOAD_MODE_GPU, the pointer may be null.
     TLASBuildInstanceData const*    pInstances                    DEFAULT_INITIALIZER(nullptr);
 
     /// The number of instances.
@@ -1707,6 +1865,27 @@ struct BuildTLASAttribs
     /// \note
     ///     An update will be faster than building an acceleration structure from scratch.
     Bool                            Update                        DEFAULT_INITIALIZER(False);
+
+    /// Instance data upload mode, see Diligent::TLAS_INSTANCE_UPLOAD_MODE.
+    TLAS_INSTANCE_UPLOAD_MODE       InstanceUploadMode            DEFAULT_INITIALIZER(TLAS_INSTANCE_UPLOAD_MODE_ALL);
+
+    /// The number of elements in `pInstances` when `InstanceUploadMode` is Diligent::TLAS_INSTANCE_UPLOAD_MODE_DIRTY.
+
+    /// Every instance must be listed at most once.
+    /// `HitGroupStride`, `BaseContributionToHitGroupIndex` and `BindingMode` must be the same as in the previous build.
+    /// Unless `BindingMode` is Diligent::HIT_GROUP_BINDING_MODE_USER_DEFINED, the instances keep their hit group indices,
+    /// so a new BLAS must have the same number of geometries as the one it replaces.
+    Uint32                          DirtyInstanceCount            DEFAULT_INITIALIZER(0);
+
+    /// The fraction of changed instances above which the TLAS is rebuilt rather than updated.
+
+    /// Updating a TLAS is faster than building it, but the quality of the acceleration structure degrades
+    /// as instances move. If `Update` is `true` and `InstanceUploadMode` is Diligent::TLAS_INSTANCE_UPLOAD_MODE_DIRTY,
+    /// the TLAS is built from scratch when `DirtyInstanceCount` exceeds `InstanceCount * RebuildThreshold`.
+    /// In this case, the scratch buffer must be large enough to build the TLAS (see ITopLevelAS::GetScratchBufferSizes()).
+    ///
+    /// The default value of 1 means that the TLAS is always updated.
+    Float32                         RebuildThreshold              DEFAULT_INITIALIZER(1.f);
 };
 typedef struct BuildTLASAttribs BuildTLASAttribs;
 
@@ -2174,6 +2353,55 @@ struct BindSparseResourceMemoryAttribs
 };
 typedef struct BindSparseResourceMemoryAttribs BindSparseResourceMemoryAttribs;
 
+
+/// This structure is used by IDeviceContext::ResolvePoolQueries().
+struct ResolvePoolQueriesAttribs
+{
+    /// Query pool whose queries will be resolved.
+    IQueryPool*                    pQueryPool              DEFAULT_INITIALIZER(nullptr);
+
+    /// The index of the first query to resolve.
+    Uint32                         FirstQuery              DEFAULT_INITIALIZER(0);
+
+    /// The number of queries to resolve.
+    Uint32                         QueryCount              DEFAULT_INITIALIZER(0);
+
+    /// The destination buffer.
+
+    /// The results are written as tightly packed 64-bit values, one per query:
+    ///  - Occlusion query: the number of samples that passed the depth and stencil tests.
+    ///  - Binary occlusion query: zero if no samples passed, and a non-zero value otherwise.
+    ///  - Timestamp query: GPU counter value. The counter frequency is the same as
+    ///    QueryDataTimestamp::Frequency reported by timestamp queries in the same context.
+    IBuffer*                       pDstBuffer              DEFAULT_INITIALIZER(nullptr);
+
+    /// Offset from the beginning of the destination buffer, in bytes. Must be a multiple of 8.
+    Uint64                         DstOffset               DEFAULT_INITIALIZER(0);
+
+    /// Destination buffer state transition mode (see Diligent::RESOURCE_STATE_TRANSITION_MODE).
+    RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode DEFAULT_INITIALIZER(RESOURCE_STATE_TRANSITION_MODE_NONE);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr ResolvePoolQueriesAttribs() noexcept {}
+
+    constexpr ResolvePoolQueriesAttribs(IQueryPool*                    _pQueryPool,
+                                        Uint32                         _FirstQuery,
+                                        Uint32                         _QueryCount,
+                                        IBuffer*                       _pDstBuffer,
+                                        Uint64                         _DstOffset               = ResolvePoolQueriesAttribs{}.DstOffset,
+                                        RESOURCE_STATE_TRANSITION_MODE _DstBufferTransitionMode = ResolvePoolQueriesAttribs{}.DstBufferTransitionMode) noexcept :
+        pQueryPool             {_pQueryPool             },
+        FirstQuery             {_FirstQuery             },
+        QueryCount             {_QueryCount             },
+        pDstBuffer             {_pDstBuffer             },
+        DstOffset              {_DstOffset              },
+        DstBufferTransitionMode{_DstBufferTransitionMode}
+    {
+    }
+#endif
+};
+typedef struct ResolvePoolQueriesAttribs ResolvePoolQueriesAttribs;
+
 /// Special constant for all remaining mipmap levels.
 #define DILIGENT_REMAINING_MIP_LEVELS 0xFFFFFFFFU
 
@@ -2204,7 +2432,8 @@ DILIGENT_TYPED_ENUM(STATE_TRANSITION_FLAGS, Uint8)
     STATE_TRANSITION_FLAG_DISCARD_CONTENT = 1u << 1,
 
     /// Indicates state transition between aliased resources that share the same memory.
-    /// Currently it is only supported for sparse resources that were created with aliasing flag.
+    /// It is supported for sparse resources that were created with aliasing flag, and for
+    /// placed resources (see IRenderDevice::CreatePlacedTexture() and IRenderDevice::CreatePlacedBuffer()).
     STATE_TRANSITION_FLAG_ALIASING        = 1u << 2
 };
 DEFINE_FLAG_ENUM_OPERATORS(STATE_TRANSITION_FLAGS);
@@ -2477,6 +2706,51 @@ struct DeviceContextCommandCounters
 };
 typedef struct DeviceContextCommandCounters DeviceContextCommandCounters;
 
+/// Counters of redundant state-setting commands.
+
+/// A command is redundant when it does not change the state of the context,
+/// for example when the same viewports are set again. Redundant commands are
+/// filtered out by the context and are not forwarded to the graphics API.
+/// They are not included into Diligent::DeviceContextCommandCounters.
+struct DeviceContextRedundantCommandCounters
+{
+    /// The number of redundant SetPipelineState calls.
+    Uint32 SetPipelineState DEFAULT_INITIALIZER(0);
+
+    /// The number of redundant SetVertexBuffers calls.
+    Uint32 SetVertexBuffers DEFAULT_INITIALIZER(0);
+
+    /// The number of redundant SetIndexBuffer calls.
+    Uint32 SetIndexBuffer DEFAULT_INITIALIZER(0);
+
+    /// The number of redundant SetBlendFactors calls.
+    Uint32 SetBlendFactors DEFAULT_INITIALIZER(0);
+
+    /// The number of redundant SetStencilRef calls.
+    Uint32 SetStencilRef DEFAULT_INITIALIZER(0);
+
+    /// The number of redundant SetViewports calls.
+    Uint32 SetViewports DEFAULT_INITIALIZER(0);
+
+    /// The number of redundant SetScissorRects calls.
+    Uint32 SetScissorRects DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextRedundantCommandCounters DeviceContextRedundantCommandCounters;
+
+/// CPU time spent by the device context in different groups of operations, in nanoseconds.
+struct DeviceContextCPUTimes
+{
+    /// Time spent in CommitShaderResources.
+    Uint64 Commit DEFAULT_INITIALIZER(0);
+
+    /// Time spent in TransitionResourceStates and TransitionShaderResources.
+    Uint64 Barrier DEFAULT_INITIALIZER(0);
+
+    /// Time spent submitting commands to the queue (Flush, ExecuteCommandLists).
+    Uint64 Submit DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextCPUTimes DeviceContextCPUTimes;
+
 /// Device context statistics.
 struct DeviceContextStats
 {
@@ -2486,6 +2760,54 @@ struct DeviceContextStats
     /// Command counters, see Diligent::DeviceContextCommandCounters.
     DeviceContextCommandCounters CommandCounters DEFAULT_INITIALIZER({});
 
+    /// Redundant command counters, see Diligent::DeviceContextRedundantCommandCounters.
+    DeviceContextRedundantCommandCounters RedundantCommandCounters DEFAULT_INITIALIZER({});
+
+    /// The total number of pipeline barrier batches flushed to the command buffer.
+
+    /// \remarks   Resource state transitions are accumulated and flushed as a single
+    ///            barrier right before the next command that depends on them.
+    ///            Currently, only the Vulkan backend reports this value.
+    Uint32 BarrierBatches DEFAULT_INITIALIZER(0);
+
+    /// CPU time spent inside the context, see Diligent::DeviceContextCPUTimes.
+    DeviceContextCPUTimes CPUTimes DEFAULT_INITIALIZER({});
+
+    /// GPU time of the most recent frame whose timing data is available, in nanoseconds.
+
+    /// \remarks   The time is the difference between a pair of internal timestamps written
+    ///            at the first flush of two consecutive frames, and becomes available
+    ///            a few frames later. It is only reported by immediate contexts when
+    ///            Diligent::DeviceFeatures::TimestampQueries is enabled, and is zero otherwise.
+    ///            Unlike other members, this value is not reset by ClearStats().
+    Uint64 GPUFrameTime DEFAULT_INITIALIZER(0);
+
+    /// The number of command batches submitted to the queue.
+    Uint32 QueueSubmits DEFAULT_INITIALIZER(0);
+
+    /// The number of descriptor allocations made from the context's dynamic descriptor allocators.
+
+    /// \remarks   In Direct3D12, this is the number of GPU-visible descriptor ranges;
+    ///            in Vulkan, the number of dynamic descriptor sets. Other backends report zero.
+    Uint32 DescriptorAllocations DEFAULT_INITIALIZER(0);
+
+    /// The number of bytes allocated from the context's dynamic upload heap.
+
+    /// \remarks   Only Direct3D12 and Vulkan backends report this value.
+    Uint64 DynamicUploadBytes DEFAULT_INITIALIZER(0);
+
+    /// The number of master blocks the context's dynamic heap requested from the global dynamic memory manager.
+
+    /// \remarks   Every request locks the manager that is shared by all contexts.
+    ///            Only Vulkan backend reports this value.
+    Uint32 DynamicMasterBlockAllocations DEFAULT_INITIALIZER(0);
+
+    /// The number of master blocks the context's dynamic heap reused from its own cache
+    /// of blocks released in previous frames, without locking the global dynamic memory manager.
+
+    /// \remarks   Only Vulkan backend reports this value.
+    Uint32 DynamicMasterBlockCacheHits DEFAULT_INITIALIZER(0);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr Uint32 GetTotalTriangleCount() const noexcept
     {
@@ -2535,11 +2857,13 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
     /// \param [in] ImmediateContextId - the ID of the immediate context where commands from this
     ///                                  deferred context will be executed,
     ///                                  see Diligent::DeviceContextDesc::ContextId.
+    /// \param [in] Flags              - Command list flags, see Diligent::COMMAND_LIST_FLAGS.
     ///
     /// \warning Command list recorded by the context must not be submitted to any other immediate context
     ///          other than one identified by ImmediateContextId.
     VIRTUAL void METHOD(Begin)(THIS_
-                               Uint32 ImmediateContextId) PURE;
+                               Uint32             ImmediateContextId,
+                               COMMAND_LIST_FLAGS Flags DEFAULT_VALUE(COMMAND_LIST_FLAG_NONE)) PURE;
 
     /// Sets the pipeline state.
 
@@ -2628,6 +2952,49 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                          const float* pBlendFactors DEFAULT_VALUE(nullptr)) PURE;
 
 
+    /// Sets the cull mode for the bound pipeline.
+
+    /// \param [in] CullMode - Cull mode, see Diligent::CULL_MODE.
+    ///
+    /// The bound pipeline must have been created with the Diligent::PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag.
+    /// The value overrides RasterizerStateDesc::CullMode until the next pipeline is bound.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(SetCullMode)(THIS_
+                                     CULL_MODE CullMode) PURE;
+
+
+    /// Sets the depth test state for the bound pipeline.
+
+    /// \param [in] DepthEnable      - Whether to enable the depth test.
+    /// \param [in] DepthWriteEnable - Whether to enable writes to the depth buffer.
+    /// \param [in] DepthFunc        - Depth comparison function, see Diligent::COMPARISON_FUNCTION.
+    ///
+    /// The bound pipeline must have been created with the Diligent::PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag.
+    /// The values override DepthStencilStateDesc::DepthEnable, DepthStencilStateDesc::DepthWriteEnable
+    /// and DepthStencilStateDesc::DepthFunc until the next pipeline is bound.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(SetDepthState)(THIS_
+                                       Bool                DepthEnable,
+                                       Bool                DepthWriteEnable,
+                                       COMPARISON_FUNCTION DepthFunc) PURE;
+
+
+    /// Sets the primitive topology for the bound pipeline.
+
+    /// \param [in] Topology - Primitive topology, see Diligent::PRIMITIVE_TOPOLOGY.
+    ///
+    /// The bound pipeline must have been created with the Diligent::PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag.
+    /// The topology must be of the same class (points, lines, triangles or patches with the same
+    /// number of control points) as GraphicsPipelineDesc::PrimitiveTopology of the pipeline, and it
+    /// overrides the pipeline topology until the next pipeline is bound.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(SetPrimitiveTopology)(THIS_
+                                              PRIMITIVE_TOPOLOGY Topology) PURE;
+
+
     /// Binds vertex buffers to the pipeline.
 
     /// \param [in] StartSlot           - The first input slot for binding. The first vertex buffer is
@@ -2925,6 +3292,30 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                              const DrawIndexedIndirectAttribs REF Attribs) PURE;
 
 
+    /// Executes GPU-generated commands whose layout is defined by an indirect command signature.
+
+    /// \param [in] Attribs - Structure describing the command attributes, see Diligent::ExecuteIndirectCommandsAttribs for details.
+    ///
+    /// Every command may change constant buffers and vertex and index buffers before issuing
+    /// its draw, as defined by the signature (see Diligent::IndirectCommandSignatureDesc).
+    /// The changes made by a command persist for the following commands in the same call.
+    /// After the method returns, the resources and vertex and index buffers bound to the context
+    /// are restored for the following draw commands.
+    ///
+    /// If `Attribs.pCounterBuffer` is not null, the number of commands to execute will be the lesser
+    /// of the value read from the buffer at `Attribs.CounterOffset` and `Attribs.MaxCommandCount`.
+    ///
+    /// The application is responsible for transitioning the buffers referenced by the command
+    /// arguments to the required states (constant buffer, vertex buffer or index buffer).
+    ///
+    /// \remarks  Indirect command signatures are only supported in Direct3D12 backend,
+    ///           see Diligent::DRAW_COMMAND_CAP_FLAG_INDIRECT_COMMAND_SIGNATURE.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(ExecuteIndirectCommands)(THIS_
+                                                 const ExecuteIndirectCommandsAttribs REF Attribs) PURE;
+
+
     /// Executes a mesh draw command.
 
     /// \param [in] Attribs - Draw command attributes, see Diligent::DrawMeshAttribs for details.
@@ -3107,6 +3498,35 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                            RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) PURE;
 
 
+    /// Informs the engine that the contents of the bound render targets are no longer needed.
+
+    /// \param [in] RenderTargetMask       - Bit mask of the render target slots to invalidate. Bit i
+    ///                                      corresponds to the render target bound to slot i.
+    /// \param [in] InvalidateDepthStencil - Whether to invalidate the bound depth-stencil view.
+    ///
+    /// The contents of the invalidated attachments become undefined. The method lets tile-based
+    /// GPUs skip loading or storing the attachment memory:
+    ///   - In Vulkan, if the method is called before the implicit render pass for the bound
+    ///     targets begins, the pass uses Diligent::ATTACHMENT_LOAD_OP_DISCARD for the invalidated
+    ///     attachments. Store operations are defined when the render pass begins and are
+    ///     not affected.
+    ///   - In OpenGL, the method calls glInvalidateFramebuffer, if it is available.
+    ///   - In Direct3D11 and Direct3D12, the method discards the attachment views.
+    ///   - In WebGPU, the method has no effect.
+    ///
+    /// Similarly, in Vulkan and WebGPU backends, ClearRenderTarget() and ClearDepthStencil() calls
+    /// for bound attachments issued before the implicit render pass begins are performed
+    /// by the render pass load operations.
+    ///
+    /// \note The method must not be called inside an explicit render pass. Use the attachment
+    ///       load and store operations of the render pass instead.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(InvalidateRenderTargets)(THIS_
+                                                 Uint32 RenderTargetMask,
+                                                 Bool   InvalidateDepthStencil) PURE;
+
+
     /// Finishes recording commands and generates a command list.
 
     /// \param [out] ppCommandList - Memory location where pointer to the recorded command list will be written.
@@ -3118,7 +3538,9 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
 
     /// \param [in] NumCommandLists - The number of command lists to execute.
     /// \param [in] ppCommandLists  - Pointer to the array of NumCommandLists command lists to execute.
-    /// \remarks After a command list is executed, it is no longer valid and must be released.
+    /// \remarks After a command list is executed, it is no longer valid and must be released,
+    ///          unless it was recorded with Diligent::COMMAND_LIST_FLAG_REUSABLE flag.
+    ///          A reusable command list may be executed again in this or any of the following frames.
     VIRTUAL void METHOD(ExecuteCommandLists)(THIS_
                                              Uint32               NumCommandLists,
                                              ICommandList* const* ppCommandLists) PURE;
@@ -3224,6 +3646,56 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                   IQuery* pQuery) PURE;
 
 
+    /// Marks the beginning of a query from a query pool.
+
+    /// \param [in] pQueryPool - A pointer to a query pool object.
+    /// \param [in] Index      - Index of the query in the pool.
+    ///
+    /// This method must not be called for timestamp queries.
+    /// Like with IDeviceContext::BeginQuery(), queries of the same type must not overlap,
+    /// and a query must either begin and end inside the same render pass, or
+    /// both begin and end outside of a render pass.
+    ///
+    /// The application is responsible for not reusing a query until all commands
+    /// that resolve its previous result have been recorded.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(BeginPoolQuery)(THIS_
+                                        IQueryPool* pQueryPool,
+                                        Uint32      Index) PURE;
+
+
+    /// Marks the end of a query from a query pool.
+
+    /// \param [in] pQueryPool - A pointer to a query pool object.
+    /// \param [in] Index      - Index of the query in the pool.
+    ///
+    /// For timestamp queries, the method writes the timestamp.
+    ///
+    /// \remarks Supported contexts: graphics for occlusion queries; graphics and compute for timestamp queries.
+    VIRTUAL void METHOD(EndPoolQuery)(THIS_
+                                      IQueryPool* pQueryPool,
+                                      Uint32      Index) PURE;
+
+
+    /// Resolves the results of a range of pool queries into a buffer with a single command.
+
+    /// \param [in] Attribs - Command attributes, see Diligent::ResolvePoolQueriesAttribs.
+    ///
+    /// All queries in the range must have been ended in this context. The destination buffer
+    /// is written on the GPU, so the results can be used by subsequent commands (e.g. by GPU-driven
+    /// culling shaders) without CPU round trips, or copied to a staging buffer for readback.
+    /// The method ends the current render pass.
+    ///
+    /// Direct3D12 backend executes a single ResolveQueryData() command.
+    /// Vulkan backend executes vkCmdCopyQueryPoolResults() and then resets the queries
+    /// in the range, so that they can be used again.
+    ///
+    /// \remarks Supported contexts: graphics, compute.
+    VIRTUAL void METHOD(ResolvePoolQueries)(THIS_
+                                            const ResolvePoolQueriesAttribs REF Attribs) PURE;
+
+
     /// Submits all pending commands in the context for execution to the command queue.
 
     /// Only immediate contexts can be flushed.
@@ -3377,12 +3849,14 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
     /// Generates a mipmap chain.
 
     /// \param [in] pTextureView - Texture view to generate mip maps for.
+    /// \param [in] Flags        - Mip generation flags, see Diligent::GENERATE_MIPS_FLAGS.
     /// \remarks This function can only be called for a shader resource view.
     ///          The texture must be created with Diligent::MISC_TEXTURE_FLAG_GENERATE_MIPS flag.
     ///
     /// \remarks Supported contexts: graphics.
     VIRTUAL void METHOD(GenerateMips)(THIS_
-                                      ITextureView* pTextureView) PURE;
+                                      ITextureView*       pTextureView,
+                                      GENERATE_MIPS_FLAGS Flags DEFAULT_VALUE(GENERATE_MIPS_FLAG_NONE)) PURE;
 
 
     /// Finishes the current frame and releases dynamic resources allocated by the context.
@@ -3738,6 +4212,9 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_CommitShaderResources(This, ...)         CALL_IFACE_METHOD(DeviceContext, CommitShaderResources,     This, __VA_ARGS__)
 #    define IDeviceContext_SetStencilRef(This, ...)                 CALL_IFACE_METHOD(DeviceContext, SetStencilRef,             This, __VA_ARGS__)
 #    define IDeviceContext_SetBlendFactors(This, ...)               CALL_IFACE_METHOD(DeviceContext, SetBlendFactors,           This, __VA_ARGS__)
+#    define IDeviceContext_SetCullMode(This, ...)                   CALL_IFACE_METHOD(DeviceContext, SetCullMode,               This, __VA_ARGS__)
+#    define IDeviceContext_SetDepthState(This, ...)                 CALL_IFACE_METHOD(DeviceContext, SetDepthState,             This, __VA_ARGS__)
+#    define IDeviceContext_SetPrimitiveTopology(This, ...)          CALL_IFACE_METHOD(DeviceContext, SetPrimitiveTopology,      This, __VA_ARGS__)
 #    define IDeviceContext_SetVertexBuffers(This, ...)              CALL_IFACE_METHOD(DeviceContext, SetVertexBuffers,          This, __VA_ARGS__)
 #    define IDeviceContext_InvalidateState(This)                    CALL_IFACE_METHOD(DeviceContext, InvalidateState,           This)
 #    define IDeviceContext_SetIndexBuffer(This, ...)                CALL_IFACE_METHOD(DeviceContext, SetIndexBuffer,            This, __VA_ARGS__)
@@ -3752,6 +4229,7 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_DrawIndexed(This, ...)                   CALL_IFACE_METHOD(DeviceContext, DrawIndexed,               This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndirect(This, ...)                  CALL_IFACE_METHOD(DeviceContext, DrawIndirect,              This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndexedIndirect(This, ...)           CALL_IFACE_METHOD(DeviceContext, DrawIndexedIndirect,       This, __VA_ARGS__)
+#    define IDeviceContext_ExecuteIndirectCommands(This, ...)       CALL_IFACE_METHOD(DeviceContext, ExecuteIndirectCommands,   This, __VA_ARGS__)
 #    define IDeviceContext_DrawMesh(This, ...)                      CALL_IFACE_METHOD(DeviceContext, DrawMesh,                  This, __VA_ARGS__)
 #    define IDeviceContext_DrawMeshIndirect(This, ...)              CALL_IFACE_METHOD(DeviceContext, DrawMeshIndirect,          This, __VA_ARGS__)
 #    define IDeviceContext_DispatchCompute(This, ...)               CALL_IFACE_METHOD(DeviceContext, DispatchCompute,           This, __VA_ARGS__)
@@ -3760,6 +4238,7 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_GetTileSize(This, ...)                   CALL_IFACE_METHOD(DeviceContext, GetTileSize,               This, __VA_ARGS__)
 #    define IDeviceContext_ClearDepthStencil(This, ...)             CALL_IFACE_METHOD(DeviceContext, ClearDepthStencil,         This, __VA_ARGS__)
 #    define IDeviceContext_ClearRenderTarget(This, ...)             CALL_IFACE_METHOD(DeviceContext, ClearRenderTarget,         This, __VA_ARGS__)
+#    define IDeviceContext_InvalidateRenderTargets(This, ...)       CALL_IFACE_METHOD(DeviceContext, InvalidateRenderTargets,   This, __VA_ARGS__)
 #    define IDeviceContext_FinishCommandList(This, ...)             CALL_IFACE_METHOD(DeviceContext, FinishCommandList,         This, __VA_ARGS__)
 #    define IDeviceContext_ExecuteCommandLists(This, ...)           CALL_IFACE_METHOD(DeviceContext, ExecuteCommandLists,       This, __VA_ARGS__)
 #    define IDeviceContext_EnqueueSignal(This, ...)                 CALL_IFACE_METHOD(DeviceContext, EnqueueSignal,             This, __VA_ARGS__)
@@ -3767,6 +4246,9 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_WaitForIdle(This)                        CALL_IFACE_METHOD(DeviceContext, WaitForIdle,               This)
 #    define IDeviceContext_BeginQuery(This, ...)                    CALL_IFACE_METHOD(DeviceContext, BeginQuery,                This, __VA_ARGS__)
 #    define IDeviceContext_EndQuery(This, ...)                      CALL_IFACE_METHOD(DeviceContext, EndQuery,                  This, __VA_ARGS__)
+#    define IDeviceContext_BeginPoolQuery(This, ...)                CALL_IFACE_METHOD(DeviceContext, BeginPoolQuery,            This, __VA_ARGS__)
+#    define IDeviceContext_EndPoolQuery(This, ...)                  CALL_IFACE_METHOD(DeviceContext, EndPoolQuery,              This, __VA_ARGS__)
+#    define IDeviceContext_ResolvePoolQueries(This, ...)            CALL_IFACE_METHOD(DeviceContext, ResolvePoolQueries,        This, __VA_ARGS__)
 #    define IDeviceContext_Flush(This)                              CALL_IFACE_METHOD(DeviceContext, Flush,                     This)
 #    define IDeviceContext_UpdateBuffer(This, ...)                  CALL_IFACE_METHOD(DeviceContext, UpdateBuffer,              This, __VA_ARGS__)
 #    define IDeviceContext_CopyBuffer(This, ...)                    CALL_IFACE_METHOD(DeviceContext, CopyBuffer,                This, __VA_ARGS__)
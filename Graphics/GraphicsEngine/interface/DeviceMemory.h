@@ -49,6 +49,20 @@ DILIGENT_TYPED_ENUM(DEVICE_MEMORY_TYPE, Uint8)
 
     /// Indicates that memory will be used for sparse resources.
     DEVICE_MEMORY_TYPE_SPARSE    = 1,
+
+    /// Indicates that memory will be used for placed resources.
+
+    /// Placed resources are regular (non-sparse) textures and buffers that are
+    /// created at the given offset in the memory object, see IRenderDevice::CreatePlacedTexture()
+    /// and IRenderDevice::CreatePlacedBuffer(). Multiple placed resources may alias the same
+    /// memory range as long as their usage is separated by aliasing barriers
+    /// (see Diligent::STATE_TRANSITION_FLAG_ALIASING).
+    ///
+    /// The memory is allocated as a single page, so DeviceMemoryDesc::PageSize
+    /// must be equal to DeviceMemoryCreateInfo::InitialSize.
+    ///
+    /// Placed memory is only supported when AdapterMemoryInfo::PlacedResources is true.
+    DEVICE_MEMORY_TYPE_PLACED    = 2,
 };
 
 /// Device memory description
@@ -101,8 +115,11 @@ struct DeviceMemoryCreateInfo
     /// An array of `NumResources` resources that this memory must be compatible with.
 
     /// For sparse memory, only Diligent::USAGE_SPARSE buffer and texture resources are allowed.
+    /// For placed memory, only non-sparse resources are allowed.
     /// 
-    /// Vulkan backend requires at least one resource to be provided.
+    /// Vulkan backend requires at least one resource to be provided for sparse memory.
+    /// For placed memory the list is optional, and the first device-local memory type
+    /// is used when it is empty.
     ///
     /// In Direct3D12, the list of resources is optional on D3D12_RESOURCE_HEAP_TIER_2-hardware
     /// and above, but is required on D3D12_RESOURCE_HEAP_TIER_1-hardware
@@ -116,6 +133,19 @@ struct DeviceMemoryCreateInfo
 };
 typedef struct DeviceMemoryCreateInfo DeviceMemoryCreateInfo;
 
+
+/// Memory requirements of a placed resource, see IRenderDevice::GetTextureMemoryRequirements()
+/// and IRenderDevice::GetBufferMemoryRequirements().
+struct ResourceMemoryRequirements
+{
+    /// The size of the memory range that the resource occupies, in bytes.
+    Uint64 Size      DEFAULT_INITIALIZER(0);
+
+    /// The required alignment of the resource offset in the device memory, in bytes.
+    Uint64 Alignment DEFAULT_INITIALIZER(0);
+};
+typedef struct ResourceMemoryRequirements ResourceMemoryRequirements;
+
 // clang-format on
 
 #define DILIGENT_INTERFACE_NAME IDeviceMemory
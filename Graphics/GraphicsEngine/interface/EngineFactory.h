@@ -34,6 +34,7 @@
 #include "../../../Primitives/interface/DebugOutput.h"
 #include "../../../Primitives/interface/DataBlob.h"
 #include "../../../Primitives/interface/MemoryAllocator.h"
+#include "../../../Primitives/interface/TraceSink.h"
 #include "GraphicsTypes.h"
 
 
@@ -64,7 +65,10 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_EngineFactory =
 /// Dearchiver create information
 struct DearchiverCreateInfo
 {
-    void* pDummy DEFAULT_INITIALIZER(nullptr);
+    /// An optional thread pool that the dearchiver will use to unpack
+    /// pipeline states in parallel, see IDearchiver::UnpackPipelineStates().
+    /// If null, all objects are unpacked by the calling thread.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
 };
 typedef struct DearchiverCreateInfo DearchiverCreateInfo;
 
@@ -161,6 +165,31 @@ DILIGENT_BEGIN_INTERFACE(IEngineFactory, IObject)
     VIRTUAL void METHOD(SetMemoryAllocator)(THIS_
                                             IMemoryAllocator* pAllocator) CONST PURE;
 
+    /// Returns CPU memory statistics of the given memory category.
+
+    /// \param [in]  Category - Memory category, see Diligent::MEMORY_CATEGORY.
+    /// \param [out] Stats    - Memory category statistics, see Diligent::MemoryCategoryStats.
+    ///
+    /// The statistics are global for the execution unit and include allocations
+    /// of all render devices as well as of the objects that do not belong to any
+    /// device, such as device object archives.
+    VIRTUAL void METHOD(GetMemoryCategoryStats)(THIS_
+                                                MEMORY_CATEGORY         Category,
+                                                MemoryCategoryStats REF Stats) CONST PURE;
+
+    /// Sets the sink that receives engine CPU trace events.
+
+    /// \param [in] pSink - Pointer to the trace sink, or null to disable tracing.
+    ///
+    /// Like the message callback, the sink is a global setting that applies to the
+    /// entire execution unit that contains the engine implementation.
+    /// The sink object must remain valid until it is reset or all engine objects are destroyed.
+    ///
+    /// \remarks  The engine must not be built with DILIGENT_NO_TRACE CMake option,
+    ///           which removes the trace instrumentation.
+    VIRTUAL void METHOD(SetTraceSink)(THIS_
+                                      ITraceSink* pSink) CONST PURE;
+
 #if PLATFORM_ANDROID
     /// On Android platform, it is necessary to initialize the file system before
     /// CreateDefaultShaderSourceStreamFactory() method can be called.
@@ -195,6 +224,8 @@ DILIGENT_END_INTERFACE
 #    define IEngineFactory_SetMessageCallback(This, ...)                     CALL_IFACE_METHOD(EngineFactory, SetMessageCallback,                     This, __VA_ARGS__)
 #    define IEngineFactory_SetBreakOnError(This, ...)                        CALL_IFACE_METHOD(EngineFactory, SetBreakOnError,                        This, __VA_ARGS__)
 #    define IEngineFactory_SetMemoryAllocator(This, ...)                     CALL_IFACE_METHOD(EngineFactory, SetMemoryAllocator,                     This, __VA_ARGS__)
+#    define IEngineFactory_GetMemoryCategoryStats(This, ...)                 CALL_IFACE_METHOD(EngineFactory, GetMemoryCategoryStats,                 This, __VA_ARGS__)
+#    define IEngineFactory_SetTraceSink(This, ...)                           CALL_IFACE_METHOD(EngineFactory, SetTraceSink,                           This, __VA_ARGS__)
 // clang-format on
 
 #endif
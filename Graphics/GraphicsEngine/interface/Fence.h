@@ -63,11 +63,32 @@ DILIGENT_TYPED_ENUM(FENCE_TYPE, Uint8)
     FENCE_TYPE_LAST = FENCE_TYPE_GENERAL
 };
 
+/// Miscellaneous fence flags
+
+/// This enumeration is used by FenceDesc structure.
+DILIGENT_TYPED_ENUM(MISC_FENCE_FLAGS, Uint8)
+{
+    /// No special flags are set.
+    MISC_FENCE_FLAG_NONE       = 0,
+
+    /// The fence may be exported to other APIs or processes to synchronize
+    /// access to exported resource memory (see Diligent::MISC_TEXTURE_FLAG_EXPORTABLE).
+
+    /// \remarks   Requires the ExternalMemory and NativeFence device features and FENCE_TYPE_GENERAL.
+    ///            Use IFenceVk::ExportSemaphoreHandle() or IFenceD3D12::CreateSharedHandle()
+    ///            to obtain the handle.
+    MISC_FENCE_FLAG_EXPORTABLE = 1u << 0,
+};
+DEFINE_FLAG_ENUM_OPERATORS(MISC_FENCE_FLAGS)
+
 /// Fence description
 struct FenceDesc DILIGENT_DERIVE(DeviceObjectAttribs)
 
     /// Fence type, see Diligent::FENCE_TYPE.
     FENCE_TYPE Type DEFAULT_INITIALIZER(FENCE_TYPE_CPU_WAIT_ONLY);
+
+    /// Miscellaneous flags, see Diligent::MISC_FENCE_FLAGS for details.
+    MISC_FENCE_FLAGS MiscFlags DEFAULT_INITIALIZER(MISC_FENCE_FLAG_NONE);
 };
 typedef struct FenceDesc FenceDesc;
 
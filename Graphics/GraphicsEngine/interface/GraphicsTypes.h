@@ -278,7 +278,9 @@ DILIGENT_TYPED_ENUM(MAP_FLAGS, Uint8)
     /// using the same resource completes. Map returns null pointer if the resource
     /// is still in use.\n
     /// D3D11 counterpart:  D3D11_MAP_FLAG_DO_NOT_WAIT
-    /// \note OpenGL does not have corresponding flag, so a buffer will always be mapped
+    /// \note OpenGL does not have corresponding flag. The flag is only respected when a staging
+    ///       buffer or texture is mapped for reading: map returns null pointer if the GPU has not finished
+    ///       copying data to the resource yet. In all other cases the resource will always be mapped.
     MAP_FLAG_DO_NOT_WAIT  = 0x001,
 
     /// Previous contents of the resource will be undefined. This flag is only compatible with MAP_WRITE\n
@@ -1440,6 +1442,26 @@ DILIGENT_TYPED_ENUM(SWAP_CHAIN_USAGE_FLAGS, Uint32)
 DEFINE_FLAG_ENUM_OPERATORS(SWAP_CHAIN_USAGE_FLAGS)
 
 
+/// Swap chain latency mode.
+DILIGENT_TYPED_ENUM(SWAP_CHAIN_LATENCY_MODE, Uint8)
+{
+    /// The swap chain maximizes throughput: the CPU may queue up to the maximum frame
+    /// latency frames (see ISwapChain::SetMaximumFrameLatency), and Present()
+    /// waits for the queue to drain right before presenting the frame.
+    SWAP_CHAIN_LATENCY_MODE_DEFAULT = 0,
+
+    /// The swap chain minimizes input-to-photon latency: the maximum frame latency defaults to 1,
+    /// and Present() waits for the queue to drain after presenting the frame, so that the
+    /// application samples input for the next frame as late as possible.
+    ///
+    /// \remarks   In Vulkan, the swap chain waits for the frame to be displayed when
+    ///             VK_KHR_present_wait is supported, and for the GPU to finish the frame otherwise.
+    SWAP_CHAIN_LATENCY_MODE_LOW,
+
+    SWAP_CHAIN_LATENCY_MODE_COUNT
+};
+
+
 /// The transform applied to the image content prior to presentation.
 DILIGENT_TYPED_ENUM(SURFACE_TRANSFORM, Uint32)
 {
@@ -1517,6 +1539,10 @@ struct SwapChainDesc
     /// for the primary swap chain, the engine releases stale resources.
     Bool  IsPrimary                     DEFAULT_INITIALIZER(true);
 
+    /// Swap chain latency mode, see Diligent::SWAP_CHAIN_LATENCY_MODE.
+    /// This member is ignored by OpenGL, Metal and WebGPU backends.
+    SWAP_CHAIN_LATENCY_MODE LatencyMode DEFAULT_INITIALIZER(SWAP_CHAIN_LATENCY_MODE_DEFAULT);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr SwapChainDesc() noexcept
     {
@@ -1851,11 +1877,49 @@ struct DeviceFeatures
     /// asynchronously in a separate thread without blocking the main thread. An application
     /// can query the shader status using the IShader::GetStatus() method and the pipeline
     /// state status using the IPipelineState::GetStatus() method.
+    ///
+    /// In OpenGL backend, the feature requires GL_KHR_parallel_shader_compile or
+    /// GL_ARB_parallel_shader_compile extension. Shaders and programs are compiled and linked
+    /// by the driver threads, and their status is polled with GL_COMPLETION_STATUS_KHR.
     DEVICE_FEATURE_STATE AsyncShaderCompilation DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
     /// Indicates if device supports formatted buffers.
     DEVICE_FEATURE_STATE FormattedBuffers       DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates if device supports pipeline specialization constants, see Diligent::SpecializationConstant.
+
+    /// Specialization constants are natively supported in Vulkan.
+    DEVICE_FEATURE_STATE SpecializationConstants DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates if device supports dynamic cull mode, depth state and primitive topology,
+    /// see Diligent::PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE.
+
+    /// Vulkan uses VK_EXT_extended_dynamic_state. Direct3D12 sets the primitive topology
+    /// natively and emulates the remaining states with internal pipeline variants.
+    DEVICE_FEATURE_STATE ExtendedDynamicState    DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates if device supports CPU-writable device-local memory for the dynamic heap.
+
+    /// On discrete GPUs this requires resizable BAR: Vulkan exposes it as a DEVICE_LOCAL | HOST_VISIBLE
+    /// memory type, Direct3D12 as D3D12_HEAP_TYPE_GPU_UPLOAD. When the feature is enabled, the dynamic heap
+    /// (and so dynamic buffers and per-frame constants) is placed in video memory within the budget given by
+    /// EngineVkCreateInfo::GPUUploadMemoryBudget or EngineD3D12CreateInfo::GPUUploadMemoryBudget.
+    DEVICE_FEATURE_STATE GPUUploadMemory         DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates if device supports multiview rendering, see Diligent::SubpassDesc::ViewMask.
+
+    /// Vulkan uses VK_KHR_multiview, Direct3D12 uses view instancing (up to 4 views),
+    /// OpenGL uses GL_OVR_multiview2 (contiguous view masks only).
+    DEVICE_FEATURE_STATE Multiview               DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates if device supports exporting resource memory and fences to other APIs and processes,
+    /// see Diligent::MISC_TEXTURE_FLAG_EXPORTABLE, Diligent::MISC_BUFFER_FLAG_EXPORTABLE and
+    /// Diligent::MISC_FENCE_FLAG_EXPORTABLE.
+
+    /// Vulkan uses VK_KHR_external_memory_fd and VK_KHR_external_semaphore_fd (or their Win32 counterparts),
+    /// Direct3D12 uses NT shared handles.
+    DEVICE_FEATURE_STATE ExternalMemory          DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeatures() noexcept {}
 
@@ -1906,11 +1970,16 @@ struct DeviceFeatures
 	Handler(TextureSubresourceViews)		   \
 	Handler(NativeMultiDraw)                   \
     Handler(AsyncShaderCompilation)			   \
-	Handler(FormattedBuffers)
+	Handler(FormattedBuffers)                  \
+    Handler(SpecializationConstants)           \
+    Handler(ExtendedDynamicState)              \
+    Handler(GPUUploadMemory)                   \
+    Handler(Multiview)                         \
+    Handler(ExternalMemory)
 
     explicit constexpr DeviceFeatures(DEVICE_FEATURE_STATE State) noexcept
     {
-        static_assert(sizeof(*this) == 47, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_DEVICE_FEATURES.");
+        static_assert(sizeof(*this) == 52, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_DEVICE_FEATURES.");
     #define INIT_FEATURE(Feature) Feature = State;
         ENUMERATE_DEVICE_FEATURES(INIT_FEATURE)
     #undef INIT_FEATURE
@@ -2587,6 +2656,34 @@ DILIGENT_TYPED_ENUM(VALIDATION_FLAGS, Uint32)
 DEFINE_FLAG_ENUM_OPERATORS(VALIDATION_FLAGS)
 
 
+/// Validation mode of the shader resources committed for draw and dispatch commands.
+
+/// The mode only has effect in Debug/Development builds, where the engine verifies that
+/// the shader resource bindings are compatible with the pipeline state and that all
+/// resources required by the shaders are bound and are in the correct states.
+DILIGENT_TYPED_ENUM(COMMAND_VALIDATION_MODE, Uint8)
+{
+    /// The resources are validated for every draw and dispatch command
+    /// after the shader resources are committed.
+    COMMAND_VALIDATION_MODE_FULL = 0,
+
+    /// The resources are validated only in every Nth frame, where N is
+    /// EngineCreateInfo::CommandValidationInterval. All commands of the
+    /// sampled frame are validated, so that no command is skipped
+    /// systematically when the frames are recorded in the same order.
+    COMMAND_VALIDATION_MODE_SAMPLED,
+
+    /// The resources are validated only the first time every combination of the
+    /// pipeline state and the shader resource bindings is used by the context.
+    ///
+    /// \note  Resources that are changed in a binding after it was first used
+    ///        with the pipeline state are not validated.
+    COMMAND_VALIDATION_MODE_FIRST_USE,
+
+    COMMAND_VALIDATION_MODE_COUNT
+};
+
+
 /// Command queue type
 DILIGENT_TYPED_ENUM(COMMAND_QUEUE_TYPE, Uint8)
 {
@@ -2679,6 +2776,13 @@ struct AdapterMemoryInfo
     /// Supported access types for the unified memory.
     CPU_ACCESS_FLAGS UnifiedMemoryCPUAccess DEFAULT_INITIALIZER(CPU_ACCESS_NONE);
 
+    /// Indicates if device supports placed resources.
+
+    /// Placed resources are created in a memory object of Diligent::DEVICE_MEMORY_TYPE_PLACED type,
+    /// see IRenderDevice::CreatePlacedTexture() and IRenderDevice::CreatePlacedBuffer().
+    /// In Direct3D12, placed resources require D3D12_RESOURCE_HEAP_TIER_2 hardware.
+    Bool PlacedResources DEFAULT_INITIALIZER(False);
+
     /// Indicates if device supports color and depth attachments in on-chip memory.
 
     /// If supported, it will be combination of the following flags: Diligent::BIND_RENDER_TARGET,
@@ -2699,6 +2803,7 @@ struct AdapterMemoryInfo
                UnifiedMemory              == RHS.UnifiedMemory          &&
                MaxMemoryAllocation        == RHS.MaxMemoryAllocation    &&
                UnifiedMemoryCPUAccess     == RHS.UnifiedMemoryCPUAccess &&
+               PlacedResources            == RHS.PlacedResources        &&
                MemorylessTextureBindFlags == RHS.MemorylessTextureBindFlags;
     }
 #endif
@@ -3044,7 +3149,14 @@ DILIGENT_TYPED_ENUM(DRAW_COMMAND_CAP_FLAGS, Uint16)
     /// Indicates that IDeviceContext::DrawIndirect() and IDeviceContext::DrawIndexedIndirect()
     /// commands may take non-null counter buffer. If this flag is not set, the number
     /// of draw commands must be specified through the command attributes.
-    DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER = 1u << 4
+    ///
+    /// \note  In Direct3D11, the counter buffer is emulated on the GPU: a compute shader
+    ///        disables the draws beyond the count, and the maximum number of draws is issued.
+    DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER = 1u << 4,
+
+    /// Indicates that device supports indirect command signatures (see Diligent::IIndirectCommandSignature)
+    /// and IDeviceContext::ExecuteIndirectCommands() command.
+    DRAW_COMMAND_CAP_FLAG_INDIRECT_COMMAND_SIGNATURE   = 1u << 5
 };
 DEFINE_FLAG_ENUM_OPERATORS(DRAW_COMMAND_CAP_FLAGS);
 
@@ -3517,6 +3629,33 @@ struct EngineCreateInfo
     /// Validation options, see Diligent::VALIDATION_FLAGS.
     VALIDATION_FLAGS    ValidationFlags             DEFAULT_INITIALIZER(VALIDATION_FLAG_NONE);
 
+    /// Validation mode of the shader resources committed for draw and dispatch commands,
+    /// see Diligent::COMMAND_VALIDATION_MODE.
+
+    /// The sampled and first-use modes reduce the CPU overhead of Development builds,
+    /// so that they run close to the speed of release builds while still detecting
+    /// most resource binding errors.
+    COMMAND_VALIDATION_MODE CommandValidationMode   DEFAULT_INITIALIZER(COMMAND_VALIDATION_MODE_FULL);
+
+    /// When CommandValidationMode is COMMAND_VALIDATION_MODE_SAMPLED, the interval, in frames,
+    /// between the frames whose commands are validated. Zero is treated as one.
+    Uint32              CommandValidationInterval   DEFAULT_INITIALIZER(16);
+
+    /// Whether to deduplicate identical shader, pipeline state and pipeline resource signature creation requests.
+
+    /// When enabled, the device computes a 128-bit digest of every create info and, if an object
+    /// with the same digest is alive, returns that object instead of creating a new one.
+    /// Object names are not part of the digest. Shaders, signatures and render passes referenced
+    /// by pipeline states are identified by their unique IDs.
+    ///
+    /// Shaders whose source is loaded through a shader source stream factory, and shaders created
+    /// with a non-null compiler output pointer are never deduplicated.
+    ///
+    /// \note   Deduplicated pipeline states and signatures share their static resource variables.
+    ///
+    /// Samplers are always deduplicated, regardless of this option.
+    Bool                EnableObjectDeduplication   DEFAULT_INITIALIZER(False);
+
     /// An optional thread pool for asynchronous shader and pipeline state compilation.
     ///
     /// When AsyncShaderCompilation device feature is enabled, the engine will use
@@ -3537,11 +3676,42 @@ struct EngineCreateInfo
     /// thread pool is used instead.
     /// 
     /// In OpenGL backend, the thread pool is not used and the value is passed to glMaxShaderCompilerThreadsKHR()
-    /// function.
+    /// (or glMaxShaderCompilerThreadsARB()) function.
     Uint32 NumAsyncShaderCompilationThreads DEFAULT_INITIALIZER(0xFFFFFFFFu);
 
+    /// The maximum number of stale resources that IRenderDevice::ReleaseStaleResources() destroys
+    /// (or hands over to the release thread, see AsyncStaleResourceRelease) in a single call.
+
+    /// Resources that exceed the budget are kept in the release queue until the next call.
+    /// Zero means no limit.
+    ///
+    /// \note  The budget is only used by Direct3D12 and Vulkan backends and is ignored
+    ///        when the release is forced.
+    Uint32 MaxStaleResourcesPerRelease DEFAULT_INITIALIZER(0);
+
+    /// The time budget, in microseconds, that IRenderDevice::ReleaseStaleResources() may spend
+    /// destroying stale resources in a single call.
+
+    /// The time is checked after every small batch of resources, so the budget may be slightly exceeded.
+    /// Zero means no limit. The budget is ignored when AsyncStaleResourceRelease is enabled
+    /// as the resources are then destroyed by the release thread.
+    ///
+    /// \note  The budget is only used by Direct3D12 and Vulkan backends and is ignored
+    ///        when the release is forced.
+    Uint32 StaleResourceReleaseTimeBudget DEFAULT_INITIALIZER(0);
+
+    /// Whether to destroy stale resources on a background thread.
+
+    /// When enabled, IRenderDevice::ReleaseStaleResources() moves the resources whose
+    /// fence has completed to a dedicated release thread that destroys them, so that
+    /// releasing a large number of objects (e.g. after a level unload) does not stall the
+    /// calling thread. Forced release waits for the release thread to finish.
+    ///
+    /// \note  The option is only used by Direct3D12 and Vulkan backends.
+    Bool AsyncStaleResourceRelease DEFAULT_INITIALIZER(False);
+
     // The structure must be 8-byte aligned
-    Uint32 Padding DEFAULT_INITIALIZER(0);
+    Bool Padding[3] DEFAULT_INITIALIZER({});
 
     /// An optional pointer to the OpenXR attributes, must be set if OpenXR is used.
     /// See Diligent::OpenXRAttribs.
@@ -3584,6 +3754,24 @@ DILIGENT_TYPED_ENUM(WEBGL_POWER_PREFERENCE, Uint8)
 	WEBGL_POWER_PREFERENCE_HIGH_PERFORMANCE
 };
 
+/// WebGL context proxying mode.
+
+/// Determines how a WebGL context created on a pthread worker is handled, see
+/// WebGLContextAttribs::ProxyContextToMainThread.
+DILIGENT_TYPED_ENUM(WEBGL_CONTEXT_PROXY_MODE, Uint8)
+{
+    /// The context is never proxied. When the context is created on a pthread worker,
+    /// the canvas must have been transferred to the worker as an OffscreenCanvas.
+	WEBGL_CONTEXT_PROXY_MODE_DISALLOW = 0,
+
+    /// The context is created on the worker if the browser supports OffscreenCanvas,
+    /// and is proxied to the main browser thread otherwise.
+	WEBGL_CONTEXT_PROXY_MODE_FALLBACK,
+
+    /// The context is always proxied to the main browser thread.
+	WEBGL_CONTEXT_PROXY_MODE_ALWAYS
+};
+
 /// WebGL context attributes.
 ///
 /// \remarks    This struct is used to set the members of the EmscriptenWebGLContextAttributes
@@ -3617,6 +3805,34 @@ struct WebGLContextAttribs
     ///
     /// \remarks    This corresponds to the powerPreference member of the EmscriptenWebGLContextAttributes struct.
     WEBGL_POWER_PREFERENCE PowerPreference DEFAULT_INITIALIZER(WEBGL_POWER_PREFERENCE_DEFAULT);
+
+    /// Specifies whether the context may be proxied to the main browser thread when it is
+    /// created on a pthread worker.
+    ///
+    /// To render on a worker without proxying, transfer the canvas to the worker thread with
+    /// emscripten_pthread_attr_settransferredcanvases() and create the device on that thread.
+    /// The application must be linked with `-sOFFSCREENCANVAS_SUPPORT=1`, see the
+    /// DILIGENT_EMSCRIPTEN_OFFSCREEN_CANVAS CMake option. Proxied contexts additionally
+    /// require RenderViaOffscreenBackBuffer.
+    ///
+    /// \remarks    This corresponds to the proxyContextToMainThread member of the EmscriptenWebGLContextAttributes struct.
+    WEBGL_CONTEXT_PROXY_MODE ProxyContextToMainThread DEFAULT_INITIALIZER(WEBGL_CONTEXT_PROXY_MODE_DISALLOW);
+
+    /// If true, the context renders to an offscreen framebuffer that is copied to the canvas
+    /// when the frame is committed.
+    ///
+    /// \remarks    This corresponds to the renderViaOffscreenBackBuffer member of the EmscriptenWebGLContextAttributes struct.
+    Bool RenderViaOffscreenBackBuffer DEFAULT_INITIALIZER(false);
+
+    /// If true, the frame is only presented when ISwapChain::Present() is called, which commits
+    /// it with emscripten_webgl_commit_frame(). Otherwise, the browser presents the frame
+    /// when the thread that owns the context returns to its event loop.
+    ///
+    /// Explicit swap control is only supported for contexts created on a pthread worker from an
+    /// OffscreenCanvas, or for contexts that render via an offscreen back buffer.
+    ///
+    /// \remarks    This corresponds to the explicitSwapControl member of the EmscriptenWebGLContextAttributes struct.
+    Bool ExplicitSwapControl DEFAULT_INITIALIZER(false);
 };
 typedef struct WebGLContextAttribs WebGLContextAttribs;
 #endif
@@ -3650,6 +3866,41 @@ struct EngineGLCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// * On Linux this affects the `DRI_PRIME` environment variable that is used by Mesa drivers that support PRIME.
     ADAPTER_TYPE PreferredAdapterType DEFAULT_INITIALIZER(ADAPTER_TYPE_UNKNOWN);
 
+    /// Size of the dynamic uniform ring page, in bytes.
+
+    /// The immediate context suballocates `USAGE_DYNAMIC` buffers that are only bound as uniform
+    /// buffers from large pages every time they are mapped, and binds them with glBindBufferRange.
+    /// When the device supports persistently mapped buffers (OpenGL 4.4 or GL_ARB_buffer_storage),
+    /// the pages stay mapped, which avoids glMapBufferRange calls and buffer orphaning in the driver.
+    /// Otherwise (e.g. on WebGL and GLES), updates are staged in CPU memory and all data written
+    /// between two draw or dispatch commands is uploaded with a single glBufferSubData call.
+    /// Set this value to 0 to map every dynamic buffer through its own buffer object.
+    Uint32 DynamicUniformRingPageSize DEFAULT_INITIALIZER(1 << 20);
+
+    /// The number of worker contexts that share objects with the main context.
+
+    /// When this value is not zero, the engine creates a pool of shared GL contexts
+    /// (WGL, GLX or EGL, depending on the platform). IRenderDevice::CreateBuffer() and
+    /// IRenderDevice::CreateTexture() called by a thread that has no current GL context
+    /// then create the object in one of the worker contexts, and wait until the GPU has
+    /// processed the initial data before returning. If all worker contexts are in use,
+    /// the call waits until one is released.
+    ///
+    /// \note Worker contexts are only supported on Windows, Linux and Android.
+    Uint32 NumWorkerContexts DEFAULT_INITIALIZER(0);
+
+    /// Whether to create a headless context that does not require a window or a display server.
+
+    /// When this flag is set, the engine enumerates GPUs through EGL_EXT_device_enumeration,
+    /// creates an EGL display on the device selected by EngineCreateInfo::AdapterId
+    /// (EGL_EXT_platform_device) and makes a surfaceless context current. The Window
+    /// member is ignored. IEngineFactoryOpenGL::CreateDeviceAndSwapChainGL() does not create
+    /// a swap chain in this mode: ppSwapChain may be null, and the application should use
+    /// CreateOffScreenSwapChain() from GraphicsTools to render to a texture.
+    ///
+    /// \note Headless contexts are only supported on Linux and require EGL_KHR_surfaceless_context.
+    Bool Headless DEFAULT_INITIALIZER(false);
+
 #if PLATFORM_WEB
     /// WebGL context attributes.
     WebGLContextAttribs WebGLAttribs;
@@ -3691,6 +3942,16 @@ struct EngineD3D11CreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// Direct3D11-specific validation options, see Diligent::D3D11_VALIDATION_FLAGS.
     D3D11_VALIDATION_FLAGS D3D11ValidationFlags DEFAULT_INITIALIZER(D3D11_VALIDATION_FLAG_NONE);
 
+    /// Size of the dynamic constant ring page, in bytes.
+
+    /// When the device supports constant buffer offsets and D3D11_MAP_WRITE_NO_OVERWRITE
+    /// for dynamic constant buffers (Direct3D11.1), the immediate context suballocates
+    /// `USAGE_DYNAMIC` buffers that are only bound as uniform buffers from large pages every
+    /// time they are mapped, and binds them with first-constant offsets. This avoids
+    /// renaming of the individual buffers by the driver.
+    /// Set this value to 0 to map every dynamic buffer with D3D11_MAP_WRITE_DISCARD.
+    Uint32 DynamicConstantRingPageSize DEFAULT_INITIALIZER(1 << 20);
+
 #if DILIGENT_CPP_INTERFACE
     EngineD3D11CreateInfo() noexcept :
         EngineD3D11CreateInfo{EngineCreateInfo{}}
@@ -3874,6 +4135,49 @@ struct EngineD3D12CreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// By default, the engine will search for "dxcompiler.dll".
     const Char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
 
+    /// Directory where the DirectX Shader Compiler keeps compiled shader bytecode between runs.
+
+    /// When this member is not null, every shader compiled with DXC is stored in this directory
+    /// under a digest of its source code with all includes, macros, entry point, target profile,
+    /// compiler arguments and compiler version. A subsequent compilation with the same digest
+    /// loads the bytecode from the file and does not invoke the compiler.
+    /// The directory is created if it does not exist.
+    const Char* pDxCompilerCachePath DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to use enhanced barriers (ID3D12GraphicsCommandList7::Barrier) for resource state
+    /// transitions when they are supported by the runtime and the driver.
+
+    /// Enhanced barriers use precise synchronization scopes and access types derived from the
+    /// resource states, and transition texture subresource ranges with a single barrier.
+    /// Split barriers and aliasing barriers always use legacy resource barriers.
+    /// The option is ignored if enhanced barriers are not supported.
+    Bool EnableEnhancedBarriers DEFAULT_INITIALIZER(False);
+
+    /// Whether to enable residency management for committed resources.
+
+    /// When residency management is enabled, the engine tracks the last frame in which every committed
+    /// buffer and texture was referenced by a command list. When the local video memory usage exceeds
+    /// the budget reported by IDXGIAdapter3::QueryVideoMemoryInfo, the engine evicts resources that are
+    /// no longer used by the GPU, starting with the ones with the lowest residency priority (see
+    /// IBufferD3D12::SetResidencyPriority() and ITextureD3D12::SetResidencyPriority()) and the least recently
+    /// used ones. Evicted resources are made resident again when they are referenced by a command list.
+    ///
+    /// The budget is checked once per frame by IRenderDevice::ReleaseStaleResources(), which
+    /// is called by ISwapChain::Present() for the primary swap chain.
+    ///
+    /// 
+    /// \remarks    Resources that the application references only in native D3D12 commands (recorded through
+    ///             IDeviceContextD3D12::GetD3D12CommandList()) are not tracked. The application must prevent
+    ///             their eviction by setting their residency priority to D3D12_RESIDENCY_PRIORITY_MAXIMUM.
+    Bool EnableResidencyManagement DEFAULT_INITIALIZER(False);
+
+    /// The maximum total size of the dynamic heap pages that are placed in D3D12_HEAP_TYPE_GPU_UPLOAD
+    /// memory when the GPUUploadMemory device feature is enabled.
+
+    /// Dynamic pages are created in the GPU upload heap until this budget is exhausted;
+    /// the remaining pages are created in the regular upload heap.
+    Uint32 GPUUploadMemoryBudget DEFAULT_INITIALIZER(64 << 20);
+
 #if DILIGENT_CPP_INTERFACE
     EngineD3D12CreateInfo() noexcept :
         EngineD3D12CreateInfo{EngineCreateInfo{}}
@@ -3971,17 +4275,36 @@ struct DeviceFeaturesVk
     /// If the extension is not supported, the texture is initialized on the device.
     DEVICE_FEATURE_STATE HostImageCopy DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates whether the device supports VK_EXT_descriptor_buffer extension.
+
+    /// When the extension is enabled, shader resource bindings do not use descriptor pools.
+    /// Descriptors are written directly into the dynamic heap buffer that is bound as
+    /// a descriptor buffer.
+    /// If the extension is not supported, descriptor sets are allocated from descriptor pools.
+    DEVICE_FEATURE_STATE DescriptorBuffer DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates whether the device supports VK_EXT_shader_object extension.
+
+    /// When the extension is enabled, graphics pipelines that do not use explicit render passes
+    /// do not create Vulkan pipeline objects. Instead, every shader stage is compiled into
+    /// a shader object, and all pipeline states are set dynamically when the pipeline is bound.
+    /// The feature requires DynamicRendering.
+    /// If the extension is not supported, monolithic Vulkan pipelines are used.
+    DEVICE_FEATURE_STATE ShaderObject DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
 
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeaturesVk() noexcept {}
 
 #define ENUMERATE_VK_DEVICE_FEATURES(Handler) \
     Handler(DynamicRendering) \
-    Handler(HostImageCopy)
+    Handler(HostImageCopy)    \
+    Handler(DescriptorBuffer) \
+    Handler(ShaderObject)
 
     explicit constexpr DeviceFeaturesVk(DEVICE_FEATURE_STATE State) noexcept
     {
-        static_assert(sizeof(*this) == 2, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
+        static_assert(sizeof(*this) == 4, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
     #define INIT_FEATURE(Feature) Feature = State;
         ENUMERATE_VK_DEVICE_FEATURES(INIT_FEATURE)
     #undef INIT_FEATURE
@@ -4092,6 +4415,18 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// pages when resources are released.
     Uint32 HostVisibleMemoryReserveSize     DEFAULT_INITIALIZER(256 << 20);
 
+    /// Percentage of the memory heap budget that the engine may use, in the [0, 100] range.
+
+    /// When VK_EXT_memory_budget extension is supported, the engine checks the heap budget
+    /// reported by the driver before allocating a new memory page. If the new page would
+    /// exceed the limit, the engine first releases all free pages in the heap, including the
+    /// reserved ones (see DeviceLocalMemoryReserveSize and HostVisibleMemoryReserveSize).
+    /// If the budget is still exceeded, a warning is printed to the log and the allocation proceeds.
+    ///
+    /// Zero disables the budget check.
+    /// Use IRenderDeviceVk::GetMemoryHeapUsage() to query the current heap usage.
+    Uint32 MemoryBudgetUsageLimit           DEFAULT_INITIALIZER(100);
+
     /// Page size of the upload heap that is allocated by immediate/deferred
     /// contexts from the global memory manager to perform lock-free dynamic
     /// suballocations.
@@ -4189,6 +4524,17 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// features when compiling shaders from HLSL.
     const Char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
 
+    /// Directory where the DirectX Shader Compiler keeps compiled SPIR-V between runs,
+    /// see EngineD3D12CreateInfo::pDxCompilerCachePath.
+    const Char* pDxCompilerCachePath DEFAULT_INITIALIZER(nullptr);
+
+    /// The maximum size of device-local host-visible memory that the engine may use for the dynamic heap
+    /// when the GPUUploadMemory device feature is enabled.
+
+    /// The dynamic heap is allocated from device-local host-visible memory only if DynamicHeapSize
+    /// does not exceed this budget. Otherwise, it is allocated from host memory.
+    Uint32 GPUUploadMemoryBudget DEFAULT_INITIALIZER(64 << 20);
+
 #if DILIGENT_CPP_INTERFACE
     EngineVkCreateInfo() noexcept :
         EngineVkCreateInfo{EngineCreateInfo{}}
@@ -4247,6 +4593,12 @@ struct EngineMtlCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 typedef struct EngineMtlCreateInfo EngineMtlCreateInfo;
 
 /// Attributes of the WebGPU-based engine implementation
+
+/// \remarks    On the Web, the device, its contexts and swap chains may be created on a pthread worker
+///             that owns an OffscreenCanvas transferred from the main browser thread. WebGPU objects
+///             are bound to the thread that created the device and must only be used on that thread.
+///             Queue callbacks (e.g. fence completion) are delivered on that thread when it returns
+///             to its event loop, so the worker should run its frame loop with emscripten_set_main_loop().
 struct EngineWebGPUCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 
     /// Upload heap page size.
@@ -4255,6 +4607,16 @@ struct EngineWebGPUCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// IDeviceContext::UpdateTexture(), or to map dynamic textures.
     Uint32 UploadHeapPageSize  DEFAULT_INITIALIZER(8 << 20);
 
+    /// Whether to write upload data directly to mapped upload heap pages.
+
+    /// By default, upload data is staged in CPU memory and is written to the GPU buffer
+    /// with wgpuQueueWriteBuffer(), which requires an extra copy. When this member is true,
+    /// upload heap pages are MAP_WRITE buffers that are written in place and are mapped again
+    /// with wgpuBufferMapAsync() once the GPU has finished reading them. This typically reduces
+    /// the upload bandwidth on native implementations, but may require more memory as pages
+    /// can only be reused after the map operation completes.
+    Bool UseMappedUploadPages  DEFAULT_INITIALIZER(False);
+
     /// The size of the dynamic heap (the buffer that is used to suballocate memory for dynamic resources).
 
     /// The dynamic heap is used to allocate memory for dynamic
@@ -4884,16 +5246,21 @@ DILIGENT_TYPED_ENUM(STATE_TRANSITION_TYPE, Uint8)
     /// Perform state transition immediately.
     STATE_TRANSITION_TYPE_IMMEDIATE = 0,
 
-    /// Begin split barrier. This mode only has effect in Direct3D12 backend, and corresponds to
+    /// Begin split barrier. In Direct3D12 backend, this mode corresponds to
     /// [D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY](https://docs.microsoft.com/en-us/windows/desktop/api/d3d12/ne-d3d12-d3d12_resource_barrier_flags)
     /// flag. See https://docs.microsoft.com/en-us/windows/desktop/direct3d12/using-resource-barriers-to-synchronize-resource-states-in-direct3d-12#split-barriers.
+    /// In Vulkan backend, the begin-split barrier signals an event that the matching end-split
+    /// barrier waits for (except for transfer queues).
     /// In other backends, begin-split barriers are ignored.
     STATE_TRANSITION_TYPE_BEGIN,
 
-    /// End split barrier. This mode only has effect in Direct3D12 backend, and corresponds to
+    /// End split barrier. In Direct3D12 backend, this mode corresponds to
     /// [D3D12_RESOURCE_BARRIER_FLAG_END_ONLY](https://docs.microsoft.com/en-us/windows/desktop/api/d3d12/ne-d3d12-d3d12_resource_barrier_flags)
     /// flag. See https://docs.microsoft.com/en-us/windows/desktop/direct3d12/using-resource-barriers-to-synchronize-resource-states-in-direct3d-12#split-barriers.
-    /// In other backends, this mode is similar to STATE_TRANSITION_TYPE_IMMEDIATE.
+    /// In Vulkan backend, the end-split barrier waits for the event signaled by the begin-split barrier
+    /// with the same resource, subresource range and new state, and performs the transition.
+    /// If there is no matching begin-split barrier, and in other backends, this mode is similar
+    /// to STATE_TRANSITION_TYPE_IMMEDIATE.
     STATE_TRANSITION_TYPE_END
 };
 
@@ -1230,6 +1230,8 @@ struct PipelineStateCreateInfoX : CreateInfoType
             AddSignature(CI.ppResourceSignatures[i]);
         if (CI.pPSOCache != nullptr)
             SetPipelineStateCache(CI.pPSOCache);
+        for (size_t i = 0; i < CI.NumSpecializationConstants; ++i)
+            AddSpecializationConstant(CI.pSpecializationConstants[i]);
         this->PSODesc.ResourceLayout = ResourceLayout;
         this->pInternalData          = InternalData.get();
     }
@@ -1350,6 +1352,42 @@ struct PipelineStateCreateInfoX : CreateInfoType
         return static_cast<DerivedType&>(*this);
     }
 
+    DerivedType& AddSpecializationConstant(const SpecializationConstant& Const)
+    {
+        SpecConstants.push_back(Const);
+        SpecializationConstant& DstConst = SpecConstants.back();
+        if (Const.Name != nullptr)
+            DstConst.Name = StringPool.emplace(Const.Name).first->c_str();
+        if (Const.pData != nullptr)
+        {
+            const Uint8* pSrcData = static_cast<const Uint8*>(Const.pData);
+            SpecConstantsData.emplace_back(pSrcData, pSrcData + Const.Size);
+            DstConst.pData = SpecConstantsData.back().data();
+        }
+
+        this->pSpecializationConstants   = SpecConstants.data();
+        this->NumSpecializationConstants = static_cast<Uint32>(SpecConstants.size());
+
+        return static_cast<DerivedType&>(*this);
+    }
+
+    template <typename... ArgsType>
+    DerivedType& AddSpecializationConstant(ArgsType&&... args)
+    {
+        const SpecializationConstant Const{std::forward<ArgsType>(args)...};
+        return AddSpecializationConstant(Const);
+    }
+
+    DerivedType& ClearSpecializationConstants()
+    {
+        SpecConstants.clear();
+        SpecConstantsData.clear();
+        this->pSpecializationConstants   = nullptr;
+        this->NumSpecializationConstants = 0;
+
+        return static_cast<DerivedType&>(*this);
+    }
+
 protected:
     DerivedType& SetShader(IShader*& pDstShader, IShader* pShader)
     {
@@ -1382,6 +1420,8 @@ protected:
     std::unordered_set<std::string>           StringPool;
     std::vector<RefCntAutoPtr<IDeviceObject>> Objects;
     std::vector<IPipelineResourceSignature*>  Signatures;
+    std::vector<SpecializationConstant>       SpecConstants;
+    std::vector<std::vector<Uint8>>           SpecConstantsData;
     std::unique_ptr<Uint8[]>                  InternalData;
 };
 
@@ -2182,6 +2222,11 @@ public:
         return CreateDeviceObject<IQuery>("query", Desc.Name, &IRenderDevice::CreateQuery, Desc);
     }
 
+    RefCntAutoPtr<IIndirectCommandSignature> CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc) const noexcept(!ThrowOnError)
+    {
+        return CreateDeviceObject<IIndirectCommandSignature>("indirect command signature", Desc.Name, &IRenderDevice::CreateIndirectCommandSignature, Desc);
+    }
+
     RefCntAutoPtr<IRenderPass> CreateRenderPass(const RenderPassDesc& Desc) const noexcept(!ThrowOnError)
     {
         return CreateDeviceObject<IRenderPass>("render pass", Desc.Name, &IRenderDevice::CreateRenderPass, Desc);
@@ -2217,6 +2262,16 @@ public:
         return CreateDeviceObject<IDeviceMemory>("device memory", CreateInfo.Desc.Name, &IRenderDevice::CreateDeviceMemory, CreateInfo);
     }
 
+    RefCntAutoPtr<ITexture> CreatePlacedTexture(const TextureDesc& TexDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset) const noexcept(!ThrowOnError)
+    {
+        return CreateDeviceObject<ITexture>("placed texture", TexDesc.Name, &IRenderDevice::CreatePlacedTexture, TexDesc, pMemory, MemoryOffset);
+    }
+
+    RefCntAutoPtr<IBuffer> CreatePlacedBuffer(const BufferDesc& BuffDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset) const noexcept(!ThrowOnError)
+    {
+        return CreateDeviceObject<IBuffer>("placed buffer", BuffDesc.Name, &IRenderDevice::CreatePlacedBuffer, BuffDesc, pMemory, MemoryOffset);
+    }
+
     RefCntAutoPtr<IPipelineStateCache> CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo) const noexcept(!ThrowOnError)
     {
         return CreateDeviceObject<IPipelineStateCache>("PSO cache", CreateInfo.Desc.Name, &IRenderDevice::CreatePipelineStateCache, CreateInfo);
@@ -2249,6 +2304,16 @@ public:
         return m_pDevice->GetSparseTextureFormatInfo(TexFormat, Dimension, SampleCount);
     }
 
+    ResourceMemoryRequirements GetTextureMemoryRequirements(const TextureDesc& TexDesc) const noexcept
+    {
+        return m_pDevice->GetTextureMemoryRequirements(TexDesc);
+    }
+
+    ResourceMemoryRequirements GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const noexcept
+    {
+        return m_pDevice->GetBufferMemoryRequirements(BuffDesc);
+    }
+
     void ReleaseStaleResources(bool ForceRelease = false) const noexcept
     {
         return m_pDevice->ReleaseStaleResources(ForceRelease);
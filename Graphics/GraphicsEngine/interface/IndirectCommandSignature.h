@@ -0,0 +1,222 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::IIndirectCommandSignature interface and related data structures
+
+#include "DeviceObject.h"
+#include "GraphicsTypes.h"
+#include "PipelineState.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {92E67461-DAC2-439C-AA3C-819221443B20}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_IndirectCommandSignature =
+    {0x92e67461, 0xdac2, 0x439c, {0xaa, 0x3c, 0x81, 0x92, 0x21, 0x44, 0x3b, 0x20}};
+
+// clang-format off
+
+/// Indirect command argument type.
+DILIGENT_TYPED_ENUM(INDIRECT_COMMAND_ARGUMENT_TYPE, Uint8)
+{
+    /// Undefined argument type.
+    INDIRECT_COMMAND_ARGUMENT_TYPE_UNDEFINED = 0,
+
+    /// Non-indexed draw command. The argument layout is the same as the one
+    /// used by IDeviceContext::DrawIndirect():
+    ///
+    ///     Uint32 NumVertices;
+    ///     Uint32 NumInstances;
+    ///     Uint32 StartVertexLocation;
+    ///     Uint32 FirstInstanceLocation;
+    INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW,
+
+    /// Indexed draw command. The argument layout is the same as the one
+    /// used by IDeviceContext::DrawIndexedIndirect():
+    ///
+    ///     Uint32 NumIndices;
+    ///     Uint32 NumInstances;
+    ///     Uint32 FirstIndexLocation;
+    ///     Uint32 BaseVertex;
+    ///     Uint32 FirstInstanceLocation;
+    INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW_INDEXED,
+
+    /// Changes the constant buffer bound to the shader variable identified by
+    /// IndirectCommandArgumentDesc::Name. The argument is the 64-bit GPU virtual
+    /// address of the buffer data:
+    ///
+    ///     Uint64 BufferAddress;
+    ///
+    /// \note   The variable must be a non-array constant buffer that is not labeled with
+    ///         Diligent::PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS flag, so that it is bound
+    ///         as a root view (in Direct3D12).
+    INDIRECT_COMMAND_ARGUMENT_TYPE_CONSTANT_BUFFER,
+
+    /// Changes the vertex buffer in the slot given by IndirectCommandArgumentDesc::Slot.
+    /// The argument layout is:
+    ///
+    ///     Uint64 BufferAddress; // GPU virtual address of the first vertex
+    ///     Uint32 SizeInBytes;
+    ///     Uint32 StrideInBytes;
+    INDIRECT_COMMAND_ARGUMENT_TYPE_VERTEX_BUFFER,
+
+    /// Changes the index buffer. The argument layout is:
+    ///
+    ///     Uint64 BufferAddress; // GPU virtual address of the first index
+    ///     Uint32 SizeInBytes;
+    ///     Uint32 Format;        // Native index format
+    ///
+    /// \note   In Direct3D12, Format is DXGI_FORMAT_R16_UINT (57) or DXGI_FORMAT_R32_UINT (42).
+    INDIRECT_COMMAND_ARGUMENT_TYPE_INDEX_BUFFER,
+
+    INDIRECT_COMMAND_ARGUMENT_TYPE_COUNT
+};
+
+
+/// Indirect command argument description.
+struct IndirectCommandArgumentDesc
+{
+    /// Argument type, see Diligent::INDIRECT_COMMAND_ARGUMENT_TYPE.
+    INDIRECT_COMMAND_ARGUMENT_TYPE Type DEFAULT_INITIALIZER(INDIRECT_COMMAND_ARGUMENT_TYPE_UNDEFINED);
+
+    /// For Diligent::INDIRECT_COMMAND_ARGUMENT_TYPE_VERTEX_BUFFER, the vertex buffer slot.
+    Uint32 Slot DEFAULT_INITIALIZER(0);
+
+    /// For Diligent::INDIRECT_COMMAND_ARGUMENT_TYPE_CONSTANT_BUFFER, shader stages
+    /// in which the constant buffer variable is defined.
+    SHADER_TYPE ShaderStages DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// For Diligent::INDIRECT_COMMAND_ARGUMENT_TYPE_CONSTANT_BUFFER, the name of the
+    /// constant buffer variable in the pipeline resource layout.
+    const Char* Name DEFAULT_INITIALIZER(nullptr);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr IndirectCommandArgumentDesc() noexcept {}
+
+    explicit constexpr IndirectCommandArgumentDesc(INDIRECT_COMMAND_ARGUMENT_TYPE _Type,
+                                                   Uint32                         _Slot         = IndirectCommandArgumentDesc{}.Slot,
+                                                   SHADER_TYPE                    _ShaderStages = IndirectCommandArgumentDesc{}.ShaderStages,
+                                                   const Char*                    _Name         = IndirectCommandArgumentDesc{}.Name) noexcept :
+        Type        {_Type        },
+        Slot        {_Slot        },
+        ShaderStages{_ShaderStages},
+        Name        {_Name        }
+    {}
+#endif
+};
+typedef struct IndirectCommandArgumentDesc IndirectCommandArgumentDesc;
+
+
+/// Indirect command signature description.
+struct IndirectCommandSignatureDesc DILIGENT_DERIVE(DeviceObjectAttribs)
+
+    /// A pointer to the array of NumArguments argument descriptions.
+
+    /// Arguments are tightly packed in the command in the order they are listed.
+    /// The array must contain exactly one draw argument (Diligent::INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW
+    /// or Diligent::INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW_INDEXED), which must be the last one.
+    const IndirectCommandArgumentDesc* pArguments DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of elements in pArguments array.
+    Uint32 NumArguments DEFAULT_INITIALIZER(0);
+
+    /// The byte stride between successive commands in the arguments buffer.
+
+    /// Must be a multiple of 4. If zero, the tightly packed size of the command
+    /// arguments is used.
+    Uint32 ByteStride DEFAULT_INITIALIZER(0);
+
+    /// The graphics pipeline whose resource layout is used to resolve constant buffer arguments.
+
+    /// Must not be null if the signature contains Diligent::INDIRECT_COMMAND_ARGUMENT_TYPE_CONSTANT_BUFFER
+    /// arguments. In this case, the signature can only be used when this pipeline is bound.
+    IPipelineState* pPipeline DEFAULT_INITIALIZER(nullptr);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr IndirectCommandSignatureDesc() noexcept {}
+
+    constexpr IndirectCommandSignatureDesc(const IndirectCommandArgumentDesc* _pArguments,
+                                           Uint32                             _NumArguments,
+                                           Uint32                             _ByteStride = IndirectCommandSignatureDesc{}.ByteStride,
+                                           IPipelineState*                    _pPipeline  = IndirectCommandSignatureDesc{}.pPipeline) noexcept :
+        pArguments  {_pArguments  },
+        NumArguments{_NumArguments},
+        ByteStride  {_ByteStride  },
+        pPipeline   {_pPipeline   }
+    {}
+#endif
+};
+typedef struct IndirectCommandSignatureDesc IndirectCommandSignatureDesc;
+
+#define DILIGENT_INTERFACE_NAME IIndirectCommandSignature
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IIndirectCommandSignatureInclusiveMethods \
+    IDeviceObjectInclusiveMethods;                \
+    IIndirectCommandSignatureMethods IndirectCommandSignature
+
+/// Indirect command signature interface.
+
+/// An indirect command signature defines the layout of GPU-generated commands executed by
+/// IDeviceContext::ExecuteIndirectCommands(). In addition to the draw arguments, every command
+/// may change constant buffers and vertex and index buffers, which allows moving a whole
+/// submission loop onto the GPU.
+///
+/// Buffer arguments are GPU virtual addresses. In Direct3D12, the address of a buffer is given
+/// by the GetGPUVirtualAddress() method of the resource returned by IBufferD3D12::GetD3D12Buffer().
+///
+/// \remarks    Indirect command signatures are only supported in Direct3D12 backend,
+///             see Diligent::DRAW_COMMAND_CAP_FLAG_INDIRECT_COMMAND_SIGNATURE.
+DILIGENT_BEGIN_INTERFACE(IIndirectCommandSignature, IDeviceObject)
+{
+#if DILIGENT_CPP_INTERFACE
+    /// Returns the indirect command signature description used to create the object.
+    virtual const IndirectCommandSignatureDesc& DILIGENT_CALL_TYPE GetDesc() const override = 0;
+#endif
+
+    /// Returns the size of a single command in the arguments buffer, in bytes.
+    VIRTUAL Uint32 METHOD(GetCommandStride)(THIS) CONST PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define IIndirectCommandSignature_GetDesc(This) (const struct IndirectCommandSignatureDesc*)IDeviceObject_GetDesc(This)
+
+#    define IIndirectCommandSignature_GetCommandStride(This) CALL_IFACE_METHOD(IndirectCommandSignature, GetCommandStride, This)
+
+// clang-format on
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
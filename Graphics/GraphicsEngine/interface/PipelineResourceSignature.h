@@ -129,7 +129,21 @@ DILIGENT_TYPED_ENUM(PIPELINE_RESOURCE_FLAGS, Uint8)
     /// \note This flag is only valid in Vulkan.
     PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT = 1u << 4,
 
-    PIPELINE_RESOURCE_FLAG_LAST               = PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT
+    /// Indicates that the constant buffer is set directly with 32-bit values through
+    /// IShaderResourceVariable::SetInlineConstants() rather than by binding a buffer.
+    /// Applies to SHADER_RESOURCE_TYPE_CONSTANT_BUFFER resources only and may not be
+    /// combined with other flags or used with static variables.
+    ///
+    /// When this flag is set, PipelineResourceDesc::ArraySize specifies the number of
+    /// 32-bit constants (up to MAX_INLINE_CONSTANTS) rather than the array size,
+    /// and the shader must declare a single (non-array) constant buffer.
+    ///
+    /// \note In Direct3D12 backend, inline constants are set as root constants.
+    ///       Other backends emulate them with an internal dynamic uniform buffer
+    ///       that is updated when the SRB is committed.
+    PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS   = 1u << 5,
+
+    PIPELINE_RESOURCE_FLAG_LAST               = PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS
 };
 DEFINE_FLAG_ENUM_OPERATORS(PIPELINE_RESOURCE_FLAGS);
 
@@ -269,6 +283,9 @@ struct PipelineResourceDesc
     SHADER_TYPE                    ShaderStages  DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
 
     /// Resource array size (must be 1 for non-array resources).
+
+    /// For resources with PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS flag,
+    /// this member specifies the number of 32-bit constants.
     Uint32                         ArraySize     DEFAULT_INITIALIZER(1);
 
     /// Resource type, see Diligent::SHADER_RESOURCE_TYPE.
@@ -334,6 +351,12 @@ struct PipelineResourceDesc
     {
         return !(*this == Rhs);
     }
+
+    /// Returns the number of shader array elements; inline constants are always a single constant buffer.
+    constexpr Uint32 GetArraySize() const noexcept
+    {
+        return (Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0 ? 1 : ArraySize;
+    }
 #endif
 };
 typedef struct PipelineResourceDesc PipelineResourceDesc;
@@ -468,6 +491,24 @@ DILIGENT_BEGIN_INTERFACE(IPipelineResourceSignature, IDeviceObject)
                                                      Bool                     InitStaticResources DEFAULT_VALUE(false)) PURE;
 
 
+    /// Creates multiple shader resource binding objects at once.
+
+    /// \param [in]  NumSRBs                - The number of shader resource binding objects to create.
+    /// \param [out] ppSRBs                 - Array of NumSRBs memory locations where pointers to the new
+    ///                                       shader resource binding objects are written.
+    /// \param [in]  InitStaticResources    - If set to true, the method will initialize static resources in
+    ///                                       all created objects.
+    ///
+    /// \remarks   The method is equivalent to calling IPipelineResourceSignature::CreateShaderResourceBinding()
+    ///            NumSRBs times, but the objects and their resource caches are allocated back-to-back,
+    ///            which reduces the allocation overhead and improves memory locality when many SRBs
+    ///            are created for the same signature (e.g. one per object in a scene).
+    VIRTUAL void METHOD(CreateShaderResourceBindings)(THIS_
+                                                      Uint32                   NumSRBs,
+                                                      IShaderResourceBinding** ppSRBs,
+                                                      Bool                     InitStaticResources DEFAULT_VALUE(false)) PURE;
+
+
     /// Binds static resources for the specified shader stages in the pipeline resource signature.
 
     /// \param [in] ShaderStages     - Flags that specify shader stages, for which resources will be bound.
@@ -583,6 +624,7 @@ DILIGENT_END_INTERFACE
 #    define IPipelineResourceSignature_GetDesc(This) (const struct PipelineResourceSignatureDesc*)IDeviceObject_GetDesc(This)
 
 #    define IPipelineResourceSignature_CreateShaderResourceBinding(This, ...)  CALL_IFACE_METHOD(PipelineResourceSignature, CreateShaderResourceBinding, This, __VA_ARGS__)
+#    define IPipelineResourceSignature_CreateShaderResourceBindings(This, ...) CALL_IFACE_METHOD(PipelineResourceSignature, CreateShaderResourceBindings,This, __VA_ARGS__)
 #    define IPipelineResourceSignature_BindStaticResources(This, ...)          CALL_IFACE_METHOD(PipelineResourceSignature, BindStaticResources,         This, __VA_ARGS__)
 #    define IPipelineResourceSignature_GetStaticVariableByName(This, ...)      CALL_IFACE_METHOD(PipelineResourceSignature, GetStaticVariableByName,     This, __VA_ARGS__)
 #    define IPipelineResourceSignature_GetStaticVariableByIndex(This, ...)     CALL_IFACE_METHOD(PipelineResourceSignature, GetStaticVariableByIndex,    This, __VA_ARGS__)
@@ -690,11 +690,109 @@ DILIGENT_TYPED_ENUM(PSO_CREATE_FLAGS, Uint32)
     /// the flag is ignored and the pipeline is created synchronously.
     PSO_CREATE_FLAG_ASYNCHRONOUS                      = 1u << 3u,
 
-    PSO_CREATE_FLAG_LAST = PSO_CREATE_FLAG_ASYNCHRONOUS
+    /// Optimize pipeline shaders in the background.
+
+    /// When this flag is set, the pipeline is created from the shader byte code as is,
+    /// and SPIR-V performance optimization passes are run by the shader compilation thread pool.
+    /// When the optimization is complete, the pipeline transparently switches to the optimized
+    /// version. This reduces the pipeline creation time while still providing optimized shaders
+    /// in the steady state.
+    /// The flag is only supported for graphics and compute pipelines in Vulkan backend, and
+    /// is ignored if the device does not support asynchronous shader compilation.
+    PSO_CREATE_FLAG_BACKGROUND_OPTIMIZATION           = 1u << 4u,
+
+    /// Make the cull mode, depth state and primitive topology dynamic.
+
+    /// When a pipeline created with this flag is bound, the values from
+    /// RasterizerStateDesc::CullMode, DepthStencilStateDesc::DepthEnable,
+    /// DepthStencilStateDesc::DepthWriteEnable, DepthStencilStateDesc::DepthFunc and
+    /// GraphicsPipelineDesc::PrimitiveTopology are used as initial values that can then be
+    /// overridden by IDeviceContext::SetCullMode(), IDeviceContext::SetDepthState() and
+    /// IDeviceContext::SetPrimitiveTopology() without creating a separate pipeline
+    /// for every combination.
+    /// The flag is only allowed for PIPELINE_TYPE_GRAPHICS pipelines and requires
+    /// the ExtendedDynamicState device feature.
+    PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE            = 1u << 5u,
+
+    PSO_CREATE_FLAG_LAST = PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE
 };
 DEFINE_FLAG_ENUM_OPERATORS(PSO_CREATE_FLAGS);
 
 
+/// Specialization constant description.
+
+/// Specialization constants are set when the pipeline is created and allow
+/// using a single shader byte code for multiple shader variants instead of
+/// compiling a separate shader for every combination of macros.
+///
+/// In Vulkan, specialization constants are declared in GLSL as
+/// `layout(constant_id = N) const int Name = DefaultValue;` and in HLSL as
+/// `[[vk::constant_id(N)]] const int Name = DefaultValue;`. The constants are matched
+/// by name with the constants declared in the shader.
+/// Constants that are not specified keep their default values.
+///
+/// \remarks   Specialization constants are supported only when the
+///             DeviceFeatures::SpecializationConstants feature is enabled.
+///             On devices that do not support them, use shader macros
+///             to define the same values at shader compile time.
+struct SpecializationConstant
+{
+    /// Constant name.
+    const Char* Name         DEFAULT_INITIALIZER(nullptr);
+
+    /// Shader stages that this constant applies to.
+    SHADER_TYPE ShaderStages DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// Size of the constant data, in bytes.
+
+    /// The size must match the size of the constant type in the shader.
+    /// Boolean constants use 4-byte values.
+    Uint32      Size         DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the constant data.
+    const void* pData        DEFAULT_INITIALIZER(nullptr);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr SpecializationConstant() noexcept {}
+
+    constexpr SpecializationConstant(const Char* _Name,
+                                     SHADER_TYPE _ShaderStages,
+                                     Uint32      _Size,
+                                     const void* _pData) noexcept :
+        Name        {_Name        },
+        ShaderStages{_ShaderStages},
+        Size        {_Size        },
+        pData       {_pData       }
+    {}
+
+    /// Comparison operator tests if two structures are equivalent
+
+    /// \param [in] RHS - reference to the structure to perform comparison with
+    /// \return
+    /// - True if all members of the two structures are equal.
+    /// - False otherwise.
+    bool operator==(const SpecializationConstant& RHS) const noexcept
+    {
+        if (ShaderStages != RHS.ShaderStages ||
+            Size         != RHS.Size         ||
+            !SafeStrEqual(Name, RHS.Name))
+            return false;
+
+        if (pData == RHS.pData)
+            return true;
+
+        return pData != nullptr && RHS.pData != nullptr && memcmp(pData, RHS.pData, Size) == 0;
+    }
+
+    bool operator!=(const SpecializationConstant& RHS) const noexcept
+    {
+        return !(*this == RHS);
+    }
+#endif
+};
+typedef struct SpecializationConstant SpecializationConstant;
+
+
 /// Pipeline state creation attributes
 struct PipelineStateCreateInfo
 {
@@ -725,6 +823,13 @@ struct PipelineStateCreateInfo
     /// is added to the cache.
     IPipelineStateCache* pPSOCache DEFAULT_INITIALIZER(nullptr);
 
+    /// The number of elements in `pSpecializationConstants` array.
+    Uint32 NumSpecializationConstants DEFAULT_INITIALIZER(0);
+
+    /// An array of `NumSpecializationConstants` specialization constants,
+    /// see Diligent::SpecializationConstant.
+    const SpecializationConstant* pSpecializationConstants DEFAULT_INITIALIZER(nullptr);
+
     /// For internal use only. Must always be `null`.
     void* pInternalData DEFAULT_INITIALIZER(nullptr);
 
@@ -766,6 +871,21 @@ struct PipelineStateCreateInfo
             }
         }
 
+        if (NumSpecializationConstants != RHS.NumSpecializationConstants)
+            return false;
+
+        if (pSpecializationConstants != RHS.pSpecializationConstants)
+        {
+            if ((pSpecializationConstants == nullptr) != (RHS.pSpecializationConstants == nullptr))
+                return false;
+
+            for (Uint32 i = 0; i < NumSpecializationConstants; ++i)
+            {
+                if (pSpecializationConstants[i] != RHS.pSpecializationConstants[i])
+                    return false;
+            }
+        }
+
         // Ignore PSO cache and pInternalData
 
         return true;
@@ -1061,6 +1181,56 @@ DILIGENT_TYPED_ENUM(PIPELINE_STATE_STATUS, Uint32)
 };
 
 
+/// Pipeline cache status reported by the driver for the pipeline or a pipeline stage.
+DILIGENT_TYPED_ENUM(PIPELINE_CACHE_STATUS, Uint8)
+{
+    /// The cache status is not known, e.g. because the backend
+    /// does not provide pipeline creation feedback.
+    PIPELINE_CACHE_STATUS_UNKNOWN = 0,
+
+    /// The pipeline or the stage was compiled.
+    PIPELINE_CACHE_STATUS_MISS,
+
+    /// The pipeline or the stage was found in the pipeline state cache
+    /// and was not compiled.
+    PIPELINE_CACHE_STATUS_HIT
+};
+
+
+/// Compile statistics of a single pipeline stage.
+struct PipelineStageCompileStats
+{
+    /// Shader stage type.
+    SHADER_TYPE ShaderType DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// Stage cache status, see Diligent::PIPELINE_CACHE_STATUS.
+    PIPELINE_CACHE_STATUS CacheStatus DEFAULT_INITIALIZER(PIPELINE_CACHE_STATUS_UNKNOWN);
+
+    /// Time spent by the driver to create the stage, in microseconds.
+    Uint64 Duration DEFAULT_INITIALIZER(0);
+};
+typedef struct PipelineStageCompileStats PipelineStageCompileStats;
+
+
+/// Pipeline state compile statistics.
+struct PipelineStateCompileStats
+{
+    /// Time spent to create the backend pipeline object, in microseconds.
+    Uint64 Duration DEFAULT_INITIALIZER(0);
+
+    /// Pipeline cache status, see Diligent::PIPELINE_CACHE_STATUS.
+    PIPELINE_CACHE_STATUS CacheStatus DEFAULT_INITIALIZER(PIPELINE_CACHE_STATUS_UNKNOWN);
+
+    /// The number of elements in pStages array.
+    Uint32 NumStages DEFAULT_INITIALIZER(0);
+
+    /// Per-stage statistics. Only available when the backend provides
+    /// per-stage creation feedback (Vulkan with VK_EXT_pipeline_creation_feedback).
+    const PipelineStageCompileStats* pStages DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct PipelineStateCompileStats PipelineStateCompileStats;
+
+
 // {06084AE5-6A71-4FE8-84B9-395DD489A28C}
 static DILIGENT_CONSTEXPR struct INTERFACE_ID IID_PipelineState =
     {0x6084ae5, 0x6a71, 0x4fe8, {0x84, 0xb9, 0x39, 0x5d, 0xd4, 0x89, 0xa2, 0x8c}};
@@ -1187,6 +1357,23 @@ DILIGENT_BEGIN_INTERFACE(IPipelineState, IDeviceObject)
                                                      Bool                     InitStaticResources DEFAULT_VALUE(false)) PURE;
 
 
+    /// Creates multiple shader resource binding objects at once.
+
+    /// \param [in]  NumSRBs                - The number of shader resource binding objects to create.
+    /// \param [out] ppSRBs                 - Array of NumSRBs memory locations where pointers to the new
+    ///                                       shader resource binding objects are written.
+    /// \param [in]  InitStaticResources    - If set to true, the method will initialize static resources in
+    ///                                       all created objects.
+    ///
+    /// Same as for IPipelineState::CreateShaderResourceBinding(), this method is only allowed for
+    /// pipelines that use implicit resource signature. See
+    /// IPipelineResourceSignature::CreateShaderResourceBindings() for details.
+    VIRTUAL void METHOD(CreateShaderResourceBindings)(THIS_
+                                                      Uint32                   NumSRBs,
+                                                      IShaderResourceBinding** ppSRBs,
+                                                      Bool                     InitStaticResources DEFAULT_VALUE(false)) PURE;
+
+
 
     /// Initializes static resources in the shader binding object.
 
@@ -1276,6 +1463,13 @@ DILIGENT_BEGIN_INTERFACE(IPipelineState, IDeviceObject)
     /// \return     The pipeline state status.
     VIRTUAL PIPELINE_STATE_STATUS METHOD(GetStatus)(THIS_
                                                     bool WaitForCompletion DEFAULT_VALUE(false)) PURE;
+
+    /// Returns the pipeline state compile statistics, see Diligent::PipelineStateCompileStats.
+
+    /// \remarks   The statistics are only available after the pipeline state
+    ///             status becomes Diligent::PIPELINE_STATE_STATUS_READY.
+    ///             The pointers in the structure are valid as long as the pipeline state is alive.
+    VIRTUAL const PipelineStateCompileStats REF METHOD(GetCompileStats)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -1295,12 +1489,14 @@ DILIGENT_END_INTERFACE
 #    define IPipelineState_GetStaticVariableByName(This, ...)      CALL_IFACE_METHOD(PipelineState, GetStaticVariableByName,      This, __VA_ARGS__)
 #    define IPipelineState_GetStaticVariableByIndex(This, ...)     CALL_IFACE_METHOD(PipelineState, GetStaticVariableByIndex,     This, __VA_ARGS__)
 #    define IPipelineState_CreateShaderResourceBinding(This, ...)  CALL_IFACE_METHOD(PipelineState, CreateShaderResourceBinding,  This, __VA_ARGS__)
+#    define IPipelineState_CreateShaderResourceBindings(This, ...) CALL_IFACE_METHOD(PipelineState, CreateShaderResourceBindings, This, __VA_ARGS__)
 #    define IPipelineState_InitializeStaticSRBResources(This, ...) CALL_IFACE_METHOD(PipelineState, InitializeStaticSRBResources, This, __VA_ARGS__)
 #    define IPipelineState_CopyStaticResources(This, ...)          CALL_IFACE_METHOD(PipelineState, CopyStaticResources,          This, __VA_ARGS__)
 #    define IPipelineState_IsCompatibleWith(This, ...)             CALL_IFACE_METHOD(PipelineState, IsCompatibleWith,             This, __VA_ARGS__)
 #    define IPipelineState_GetResourceSignatureCount(This)         CALL_IFACE_METHOD(PipelineState, GetResourceSignatureCount,    This)
 #    define IPipelineState_GetResourceSignature(This, ...)         CALL_IFACE_METHOD(PipelineState, GetResourceSignature,         This, __VA_ARGS__)
 #    define IPipelineState_GetStatus(This, ...)                    CALL_IFACE_METHOD(PipelineState, GetStatus,                    This, __VA_ARGS__)
+#    define IPipelineState_GetCompileStats(This)                   CALL_IFACE_METHOD(PipelineState, GetCompileStats,              This)
 
 // clang-format on
 
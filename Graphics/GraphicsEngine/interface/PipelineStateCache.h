@@ -73,6 +73,9 @@ struct PipelineStateCacheDesc DILIGENT_DERIVE(DeviceObjectAttribs)
     ///
     /// Vulkan PSO cache depends on the GPU device, driver version and other parameters,
     /// so the cache must be generated and used on the same device.
+    ///
+    /// OpenGL PSO cache contains linked program binaries that are only valid for the same
+    /// GPU and driver version. Data created by a different driver is ignored.
     PSO_CACHE_MODE Mode DEFAULT_INITIALIZER(PSO_CACHE_MODE_LOAD_STORE);
 
     /// PSO cache flags, see Diligent::PSO_CACHE_FLAGS.
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::IQueryPool interface and related data structures
+
+#include "DeviceObject.h"
+#include "GraphicsTypes.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {3DBC6F69-263A-4E62-8666-619D13EE46E9}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_QueryPool =
+    {0x3dbc6f69, 0x263a, 0x4e62, {0x86, 0x66, 0x61, 0x9d, 0x13, 0xee, 0x46, 0xe9}};
+
+// clang-format off
+
+/// Query pool description.
+struct QueryPoolDesc DILIGENT_DERIVE(DeviceObjectAttribs)
+
+    /// Query type, see Diligent::QUERY_TYPE.
+
+    /// Only Diligent::QUERY_TYPE_OCCLUSION, Diligent::QUERY_TYPE_BINARY_OCCLUSION and
+    /// Diligent::QUERY_TYPE_TIMESTAMP queries can be allocated from a pool.
+    enum QUERY_TYPE Type DEFAULT_INITIALIZER(QUERY_TYPE_UNDEFINED);
+
+    /// The number of queries in the pool.
+    Uint32 QueryCount DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr QueryPoolDesc() noexcept {}
+
+    explicit constexpr QueryPoolDesc(QUERY_TYPE _Type,
+                                     Uint32     _QueryCount) noexcept :
+        Type      {_Type      },
+        QueryCount{_QueryCount}
+    {}
+#endif
+};
+typedef struct QueryPoolDesc QueryPoolDesc;
+
+// clang-format on
+
+#if DILIGENT_CPP_INTERFACE
+
+/// Query pool interface.
+
+/// A query pool holds a range of queries of the same type that are addressed by index
+/// (see IDeviceContext::BeginPoolQuery() and IDeviceContext::EndPoolQuery()).
+/// Unlike IQuery objects, pool queries are not read back individually: the results of a
+/// range of queries are resolved with a single IDeviceContext::ResolvePoolQueries() command
+/// into a GPU buffer that can be consumed by shaders or copied to a staging buffer for readback.
+///
+/// \remarks    Query pools are only supported in Direct3D12 and Vulkan backends.
+class IQueryPool : public IDeviceObject
+{
+public:
+    /// Returns the query pool description used to create the object.
+    virtual const QueryPoolDesc& DILIGENT_CALL_TYPE GetDesc() const override = 0;
+};
+
+#else
+
+struct IQueryPool;
+
+//  C requires that a struct or union has at least one member
+//struct IQueryPoolMethods
+//{
+//};
+
+struct IQueryPoolVtbl
+{
+    struct IObjectMethods       Object;
+    struct IDeviceObjectMethods DeviceObject;
+    //struct IQueryPoolMethods  QueryPool;
+};
+
+typedef struct IQueryPool
+{
+    struct IQueryPoolVtbl* pVtbl;
+} IQueryPool;
+
+#    define IQueryPool_GetDesc(This) (const struct QueryPoolDesc*)IDeviceObject_GetDesc(This)
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
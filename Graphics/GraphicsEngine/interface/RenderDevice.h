@@ -46,6 +46,8 @@
 #include "PipelineStateCache.h"
 #include "Fence.h"
 #include "Query.h"
+#include "QueryPool.h"
+#include "IndirectCommandSignature.h"
 #include "RenderPass.h"
 #include "Framebuffer.h"
 #include "BottomLevelAS.h"
@@ -61,6 +63,58 @@
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
+/// Time spent in different stages of the render device initialization, in nanoseconds.
+
+/// \remarks  Currently, only Direct3D12 and Vulkan backends report startup times.
+///           Stages that are not applicable to the backend, or that were performed
+///           by the application (e.g. when attaching to an existing native device), are zero.
+struct RenderDeviceStartupTimes
+{
+    /// Total time spent creating the device and the contexts.
+    Uint64 Total DEFAULT_INITIALIZER(0);
+
+    /// Time spent creating the graphics API instance (VkInstance, DXGI factory).
+    Uint64 Instance DEFAULT_INITIALIZER(0);
+
+    /// Time spent enumerating the adapters and querying the properties of the selected one.
+    Uint64 AdapterSelection DEFAULT_INITIALIZER(0);
+
+    /// Time spent creating the native logical device and command queues.
+    Uint64 NativeDevice DEFAULT_INITIALIZER(0);
+
+    /// Time spent initializing the render device object: memory managers,
+    /// descriptor pools and heaps, query managers, etc.
+    Uint64 RenderDevice DEFAULT_INITIALIZER(0);
+
+    /// Time spent creating the immediate and deferred contexts.
+    Uint64 Contexts DEFAULT_INITIALIZER(0);
+};
+typedef struct RenderDeviceStartupTimes RenderDeviceStartupTimes;
+
+/// Pipeline state compile statistics of all pipelines created by the render device,
+/// see IRenderDevice::GetPipelineCompileStats().
+struct DevicePipelineCompileStats
+{
+    /// The number of pipeline states that have been created.
+    Uint32 NumPipelines DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline states that were found in the pipeline state cache.
+    Uint32 NumCacheHits DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline states that were compiled.
+    Uint32 NumCacheMisses DEFAULT_INITIALIZER(0);
+
+    /// Total time spent creating the backend pipeline objects, in microseconds.
+    Uint64 TotalDuration DEFAULT_INITIALIZER(0);
+
+    /// The longest time spent creating a single backend pipeline object, in microseconds.
+    Uint64 MaxDuration DEFAULT_INITIALIZER(0);
+};
+typedef struct DevicePipelineCompileStats DevicePipelineCompileStats;
+
+/// Callback function that is executed when a fence reaches the value, see IRenderDevice::EnqueueFenceCompletionCallback().
+typedef void(DILIGENT_CALL_TYPE* FenceCompletionCallbackType)(IFence* pFence, Uint64 Value, void* pUserData);
+
 // {F0E9B607-AE33-4B2B-B1AF-A8B2C3104022}
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDevice =
     {0xf0e9b607, 0xae33, 0x4b2b, {0xb1, 0xaf, 0xa8, 0xb2, 0xc3, 0x10, 0x40, 0x22}};
@@ -117,6 +171,27 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
                                       IShader**                  ppShader,
                                       IDataBlob**                ppCompilerOutput DEFAULT_VALUE(nullptr)) PURE;
 
+    /// Creates a batch of shader objects
+
+    /// \param [in]  pShaderCIs - Pointer to the array of NumShaders shader create infos,
+    ///                           see Diligent::ShaderCreateInfo for details.
+    /// \param [in]  NumShaders - The number of shaders to create.
+    /// \param [out] ppShaders  - Pointer to the array of NumShaders memory locations where pointers
+    ///                           to the shader interfaces will be written. ppShaders[i] receives
+    ///                           the shader created from pShaderCIs[i], or null if it could not be created.
+    ///                           The function calls AddRef() for every created shader.
+    ///
+    /// If the device has a shader compilation thread pool, all shaders are compiled on it in parallel,
+    /// with the shaders that are expected to take longest submitted first.
+    /// Shaders that do not have SHADER_COMPILE_FLAG_ASYNCHRONOUS flag set are
+    /// fully compiled when the method returns, same as with IRenderDevice::CreateShader().
+    /// Shaders that have the flag set may still be compiling; use IShader::GetStatus() to check.
+    /// Without a thread pool, the shaders are created one by one.
+    VIRTUAL void METHOD(CreateShaders)(THIS_
+                                       const ShaderCreateInfo* pShaderCIs,
+                                       Uint32                  NumShaders,
+                                       IShader**               ppShaders) PURE;
+
     /// Creates a new texture object
 
     /// \param [in] TexDesc - Texture description, see Diligent::TextureDesc for details.
@@ -244,6 +319,35 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
                                      IQuery**            ppQuery) PURE;
 
 
+    /// Creates a new query pool object
+
+    /// \param [in]  Desc        - Query pool description, see Diligent::QueryPoolDesc for details.
+    /// \param [out] ppQueryPool - Address of the memory location where a pointer to the
+    ///                            query pool interface will be written.
+    ///                            The function calls AddRef(), so that the new object will have
+    ///                            one reference.
+    ///
+    /// \remarks    Query pools are only supported in Direct3D12 and Vulkan backends.
+    VIRTUAL void METHOD(CreateQueryPool)(THIS_
+                                         const QueryPoolDesc REF Desc,
+                                         IQueryPool**            ppQueryPool) PURE;
+
+
+    /// Creates a new indirect command signature object
+
+    /// \param [in]  Desc         - Indirect command signature description, see Diligent::IndirectCommandSignatureDesc for details.
+    /// \param [out] ppSignature  - Address of the memory location where a pointer to the
+    ///                             indirect command signature interface will be written.
+    ///                             The function calls AddRef(), so that the new object will have
+    ///                             one reference.
+    ///
+    /// \remarks    Indirect command signatures are only supported in Direct3D12 backend,
+    ///             see Diligent::DRAW_COMMAND_CAP_FLAG_INDIRECT_COMMAND_SIGNATURE.
+    VIRTUAL void METHOD(CreateIndirectCommandSignature)(THIS_
+                                                        const IndirectCommandSignatureDesc REF Desc,
+                                                        IIndirectCommandSignature**            ppSignature) PURE;
+
+
     /// Creates a render pass object
 
     /// \param [in]  Desc         - Render pass description, see Diligent::RenderPassDesc for details.
@@ -328,6 +432,53 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
                                             IDeviceMemory**                  ppMemory) PURE;
 
 
+    /// Creates a texture at the given offset in a placed device memory object.
+
+    /// \param [in]  TexDesc      - Texture description, see Diligent::TextureDesc for details.
+    ///                            Usage must be Diligent::USAGE_DEFAULT.
+    /// \param [in]  pMemory      - Device memory object created with Diligent::DEVICE_MEMORY_TYPE_PLACED type.
+    /// \param [in]  MemoryOffset - Offset in the memory object, in bytes. The offset must be a multiple
+    ///                            of the alignment returned by GetTextureMemoryRequirements(), and the
+    ///                            texture must fit into the memory object.
+    /// \param [out] ppTexture    - Address of the memory location where a pointer to the
+    ///                            texture interface will be written.
+    ///                            The function calls AddRef(), so that the new object will have
+    ///                            one reference.
+    ///
+    /// \remarks   The texture keeps a strong reference to the memory object.
+    ///            Placed resources that overlap in memory alias each other: before a resource
+    ///            is used after another resource that shares its memory, an aliasing barrier must
+    ///            be issued (see Diligent::STATE_TRANSITION_FLAG_ALIASING), and the contents
+    ///            of the resource are undefined.
+    ///
+    ///            Placed resources are only supported when AdapterMemoryInfo::PlacedResources is true.
+    VIRTUAL void METHOD(CreatePlacedTexture)(THIS_
+                                             const TextureDesc REF TexDesc,
+                                             IDeviceMemory*        pMemory,
+                                             Uint64                MemoryOffset,
+                                             ITexture**            ppTexture) PURE;
+
+
+    /// Creates a buffer at the given offset in a placed device memory object.
+
+    /// \param [in]  BuffDesc     - Buffer description, see Diligent::BufferDesc for details.
+    ///                            Usage must be Diligent::USAGE_DEFAULT.
+    /// \param [in]  pMemory      - Device memory object created with Diligent::DEVICE_MEMORY_TYPE_PLACED type.
+    /// \param [in]  MemoryOffset - Offset in the memory object, in bytes. The offset must be a multiple
+    ///                            of the alignment returned by GetBufferMemoryRequirements().
+    /// \param [out] ppBuffer     - Address of the memory location where a pointer to the
+    ///                            buffer interface will be written.
+    ///                            The function calls AddRef(), so that the new object will have
+    ///                            one reference.
+    ///
+    /// \remarks   See remarks for CreatePlacedTexture().
+    VIRTUAL void METHOD(CreatePlacedBuffer)(THIS_
+                                            const BufferDesc REF BuffDesc,
+                                            IDeviceMemory*       pMemory,
+                                            Uint64               MemoryOffset,
+                                            IBuffer**            ppBuffer) PURE;
+
+
     /// Creates a pipeline state cache object.
 
     /// \param [in]  CreateInfo - Pipeline state cache create info, see Diligent::PiplineStateCacheCreateInfo for details.
@@ -348,7 +499,12 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
     /// \param [out] ppContext - Address of the memory location where a pointer to the
     ///                          deferred context interface will be written.
     /// 
-    /// \remarks    Deferred contexts are not supported in OpenGL and WebGPU backends.
+    /// \remarks    Deferred contexts are not supported in WebGPU backend.
+    ///             In OpenGL backend, and in Direct3D11 backend when the driver does not support
+    ///             command lists natively, deferred contexts record the commands into a command
+    ///             stream that is replayed by the immediate context in IDeviceContext::ExecuteCommandLists().
+    ///             Such contexts do not support fences, texture mapping, ray tracing and sparse resources,
+    ///             and buffers may only be mapped with MAP_WRITE and MAP_FLAG_DISCARD.
     VIRTUAL void METHOD(CreateDeferredContext)(THIS_
                                                IDeviceContext** ppContext) PURE;
 
@@ -393,8 +549,26 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
                                                                        RESOURCE_DIMENSION Dimension,
                                                                        Uint32             SampleCount) CONST PURE;
 
+
+    /// Returns the memory requirements of a placed texture with the given description.
+
+    /// If placed resources are not supported, the method returns zero size and alignment.
+    VIRTUAL ResourceMemoryRequirements METHOD(GetTextureMemoryRequirements)(THIS_
+                                                                            const TextureDesc REF TexDesc) CONST PURE;
+
+    /// Returns the memory requirements of a placed buffer with the given description.
+
+    /// If placed resources are not supported, the method returns zero size and alignment.
+    VIRTUAL ResourceMemoryRequirements METHOD(GetBufferMemoryRequirements)(THIS_
+                                                                           const BufferDesc REF BuffDesc) CONST PURE;
+
     /// Purges device release queues and releases all stale resources.
     /// This method is automatically called by ISwapChain::Present() of the primary swap chain.
+    ///
+    /// The number of resources released by a single call and the time spent releasing them
+    /// may be limited by EngineCreateInfo::MaxStaleResourcesPerRelease and
+    /// EngineCreateInfo::StaleResourceReleaseTimeBudget. If EngineCreateInfo::AsyncStaleResourceRelease
+    /// is enabled, the resources are destroyed by a background thread.
     /// \param [in]  ForceRelease - Forces release of all objects. Use this option with
     ///                             great care only if you are sure the resources are not
     ///                             in use by the GPU (such as when the device has just been idled).
@@ -426,6 +600,62 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
     /// so an application must not call Release().
     VIRTUAL IThreadPool* METHOD(GetShaderCompilationThreadPool)(THIS) CONST PURE;
 
+
+    /// Returns CPU memory statistics of the given memory category for this device.
+
+    /// \param [in]  Category - Memory category, see Diligent::MEMORY_CATEGORY.
+    /// \param [out] Stats    - Memory category statistics, see Diligent::MemoryCategoryStats.
+    ///
+    /// \remarks  The statistics only include allocations made by this device and its objects.
+    ///           Use IEngineFactory::GetMemoryCategoryStats() to get the statistics of all devices.
+    ///           GPU memory usage is reported by backend-specific interfaces, see
+    ///           IRenderDeviceVk::GetMemoryHeapUsage() and IRenderDeviceD3D12::GetMemoryUsage().
+    VIRTUAL void METHOD(GetMemoryCategoryStats)(THIS_
+                                                MEMORY_CATEGORY         Category,
+                                                MemoryCategoryStats REF Stats) CONST PURE;
+
+
+    /// Returns the time spent in different stages of the device initialization,
+    /// see Diligent::RenderDeviceStartupTimes.
+    VIRTUAL const RenderDeviceStartupTimes REF METHOD(GetStartupTimes)(THIS) CONST PURE;
+
+
+    /// Returns the compile statistics of all pipeline states created by this device,
+    /// see Diligent::DevicePipelineCompileStats.
+
+    /// \remarks  The statistics of individual pipelines are returned by IPipelineState::GetCompileStats().
+    ///           Pipelines whose cache status is not known are counted in neither
+    ///           NumCacheHits nor NumCacheMisses.
+    VIRTUAL void METHOD(GetPipelineCompileStats)(THIS_
+                                                 DevicePipelineCompileStats REF Stats) CONST PURE;
+
+
+    /// Enqueues the callback that will be executed when the fence reaches the value.
+
+    /// \param [in] pFence    - Fence to wait for.
+    /// \param [in] Value     - Value the fence must reach.
+    /// \param [in] Callback  - Callback function, see Diligent::FenceCompletionCallbackType.
+    /// \param [in] pUserData - User data that is passed to the callback.
+    ///
+    /// \remarks  The device keeps a strong reference to the fence until the callback is executed,
+    ///           so the fence must eventually reach the value for the device to be released.
+    ///
+    ///           In Direct3D12 and Vulkan backends, callbacks are executed by a worker thread
+    ///           that waits for all pending fences at once (SetEventOnMultipleFenceCompletion,
+    ///           vkWaitSemaphores), so the callbacks must be thread-safe and should return quickly.
+    ///           In Vulkan, native waits require DeviceFeatures::NativeFence; otherwise the thread
+    ///           polls the fences.
+    ///
+    ///           In Direct3D11, OpenGL and WebGPU backends, fences may only be accessed by the immediate
+    ///           context, and callbacks are executed by IDeviceContext::FinishFrame() of the immediate context.
+    ///
+    ///           Callbacks may enqueue new callbacks.
+    VIRTUAL void METHOD(EnqueueFenceCompletionCallback)(THIS_
+                                                        IFence*                     pFence,
+                                                        Uint64                      Value,
+                                                        FenceCompletionCallbackType Callback,
+                                                        void*                       pUserData) PURE;
+
 #if DILIGENT_CPP_INTERFACE
     /// Overloaded alias for CreateGraphicsPipelineState.
     void CreatePipelineState(const GraphicsPipelineStateCreateInfo& CI, IPipelineState** ppPipelineState)
@@ -458,6 +688,7 @@ DILIGENT_END_INTERFACE
 // clang-format off
 #    define IRenderDevice_CreateBuffer(This, ...)                    CALL_IFACE_METHOD(RenderDevice, CreateBuffer,                    This, __VA_ARGS__)
 #    define IRenderDevice_CreateShader(This, ...)                    CALL_IFACE_METHOD(RenderDevice, CreateShader,                    This, __VA_ARGS__)
+#    define IRenderDevice_CreateShaders(This, ...)                   CALL_IFACE_METHOD(RenderDevice, CreateShaders,                   This, __VA_ARGS__)
 #    define IRenderDevice_CreateTexture(This, ...)                   CALL_IFACE_METHOD(RenderDevice, CreateTexture,                   This, __VA_ARGS__)
 #    define IRenderDevice_CreateSampler(This, ...)                   CALL_IFACE_METHOD(RenderDevice, CreateSampler,                   This, __VA_ARGS__)
 #    define IRenderDevice_CreateResourceMapping(This, ...)           CALL_IFACE_METHOD(RenderDevice, CreateResourceMapping,           This, __VA_ARGS__)
@@ -466,6 +697,8 @@ DILIGENT_END_INTERFACE
 #    define IRenderDevice_CreateRayTracingPipelineState(This, ...)   CALL_IFACE_METHOD(RenderDevice, CreateRayTracingPipelineState,   This, __VA_ARGS__)
 #    define IRenderDevice_CreateFence(This, ...)                     CALL_IFACE_METHOD(RenderDevice, CreateFence,                     This, __VA_ARGS__)
 #    define IRenderDevice_CreateQuery(This, ...)                     CALL_IFACE_METHOD(RenderDevice, CreateQuery,                     This, __VA_ARGS__)
+#    define IRenderDevice_CreateQueryPool(This, ...)                 CALL_IFACE_METHOD(RenderDevice, CreateQueryPool,                 This, __VA_ARGS__)
+#    define IRenderDevice_CreateIndirectCommandSignature(This, ...)  CALL_IFACE_METHOD(RenderDevice, CreateIndirectCommandSignature,  This, __VA_ARGS__)
 #    define IRenderDevice_CreateRenderPass(This, ...)                CALL_IFACE_METHOD(RenderDevice, CreateRenderPass,                This, __VA_ARGS__)
 #    define IRenderDevice_CreateFramebuffer(This, ...)               CALL_IFACE_METHOD(RenderDevice, CreateFramebuffer,               This, __VA_ARGS__)
 #    define IRenderDevice_CreateBLAS(This, ...)                      CALL_IFACE_METHOD(RenderDevice, CreateBLAS,                      This, __VA_ARGS__)
@@ -473,6 +706,8 @@ DILIGENT_END_INTERFACE
 #    define IRenderDevice_CreateSBT(This, ...)                       CALL_IFACE_METHOD(RenderDevice, CreateSBT,                       This, __VA_ARGS__)
 #    define IRenderDevice_CreatePipelineResourceSignature(This, ...) CALL_IFACE_METHOD(RenderDevice, CreatePipelineResourceSignature, This, __VA_ARGS__)
 #    define IRenderDevice_CreateDeviceMemory(This, ...)              CALL_IFACE_METHOD(RenderDevice, CreateDeviceMemory,              This, __VA_ARGS__)
+#    define IRenderDevice_CreatePlacedTexture(This, ...)             CALL_IFACE_METHOD(RenderDevice, CreatePlacedTexture,             This, __VA_ARGS__)
+#    define IRenderDevice_CreatePlacedBuffer(This, ...)              CALL_IFACE_METHOD(RenderDevice, CreatePlacedBuffer,              This, __VA_ARGS__)
 #    define IRenderDevice_CreatePipelineStateCache(This, ...)        CALL_IFACE_METHOD(RenderDevice, CreatePipelineStateCache,        This, __VA_ARGS__)
 #    define IRenderDevice_CreateDeferredContext(This, ...)           CALL_IFACE_METHOD(RenderDevice, CreateDeferredContext,           This, __VA_ARGS__)
 #    define IRenderDevice_GetAdapterInfo(This)                       CALL_IFACE_METHOD(RenderDevice, GetAdapterInfo,                  This)
@@ -480,10 +715,16 @@ DILIGENT_END_INTERFACE
 #    define IRenderDevice_GetTextureFormatInfo(This, ...)            CALL_IFACE_METHOD(RenderDevice, GetTextureFormatInfo,            This, __VA_ARGS__)
 #    define IRenderDevice_GetTextureFormatInfoExt(This, ...)         CALL_IFACE_METHOD(RenderDevice, GetTextureFormatInfoExt,         This, __VA_ARGS__)
 #    define IRenderDevice_GetSparseTextureFormatInfo(This, ...)      CALL_IFACE_METHOD(RenderDevice, GetSparseTextureFormatInfo,      This, __VA_ARGS__)
+#    define IRenderDevice_GetTextureMemoryRequirements(This, ...)    CALL_IFACE_METHOD(RenderDevice, GetTextureMemoryRequirements,    This, __VA_ARGS__)
+#    define IRenderDevice_GetBufferMemoryRequirements(This, ...)     CALL_IFACE_METHOD(RenderDevice, GetBufferMemoryRequirements,     This, __VA_ARGS__)
 #    define IRenderDevice_ReleaseStaleResources(This, ...)           CALL_IFACE_METHOD(RenderDevice, ReleaseStaleResources,           This, __VA_ARGS__)
 #    define IRenderDevice_IdleGPU(This)                              CALL_IFACE_METHOD(RenderDevice, IdleGPU,                         This)
 #    define IRenderDevice_GetEngineFactory(This)                     CALL_IFACE_METHOD(RenderDevice, GetEngineFactory,                This)
 #    define IRenderDevice_GetShaderCompilationThreadPool(This)       CALL_IFACE_METHOD(RenderDevice, GetShaderCompilationThreadPool,  This)
+#    define IRenderDevice_GetMemoryCategoryStats(This, ...)          CALL_IFACE_METHOD(RenderDevice, GetMemoryCategoryStats,          This, __VA_ARGS__)
+#    define IRenderDevice_GetStartupTimes(This)                      CALL_IFACE_METHOD(RenderDevice, GetStartupTimes,                 This)
+#    define IRenderDevice_GetPipelineCompileStats(This, ...)         CALL_IFACE_METHOD(RenderDevice, GetPipelineCompileStats,         This, __VA_ARGS__)
+#    define IRenderDevice_EnqueueFenceCompletionCallback(This, ...)  CALL_IFACE_METHOD(RenderDevice, EnqueueFenceCompletionCallback,  This, __VA_ARGS__)
 // clang-format on
 
 #endif
@@ -289,6 +289,16 @@ struct SubpassDesc
     /// Pointer to the shading rate attachment, see Diligent::ShadingRateAttachment.
     const ShadingRateAttachment* pShadingRateAttachment     DEFAULT_INITIALIZER(nullptr);
 
+    /// Multiview view mask.
+
+    /// If `ViewMask` is not zero, the subpass is rendered once for every bit set in the mask,
+    /// and bit `i` selects array slice `i` of every attachment view.
+    /// The view index is available in the shader as `SV_ViewID` (HLSL) or `gl_ViewIndex` (GLSL).
+    /// Either all subpasses of the render pass must use a non-zero view mask, or none.
+    ///
+    /// Requires DeviceFeatures::Multiview.
+    Uint32                      ViewMask                    DEFAULT_INITIALIZER(0);
+
 #if DILIGENT_CPP_INTERFACE
     /// Tests if two structures are equivalent
 
@@ -300,7 +310,8 @@ struct SubpassDesc
     {
         if (InputAttachmentCount        != RHS.InputAttachmentCount ||
             RenderTargetAttachmentCount != RHS.RenderTargetAttachmentCount ||
-            PreserveAttachmentCount     != RHS.PreserveAttachmentCount)
+            PreserveAttachmentCount     != RHS.PreserveAttachmentCount ||
+            ViewMask                    != RHS.ViewMask)
             return false;
 
         for(Uint32 i=0; i < InputAttachmentCount; ++i)
@@ -45,6 +45,78 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_ShaderResourceBinding =
     {0x61f8774, 0x9a09, 0x48e8, {0x84, 0x11, 0xb5, 0xbd, 0x20, 0x56, 0x1, 0x4}};
 
 
+/// Describes a single variable update performed by IShaderResourceBinding::SetVariables().
+struct ShaderResourceVariableUpdate
+{
+    /// Shader stage of the variable. Must be one of Diligent::SHADER_TYPE.
+    SHADER_TYPE ShaderType DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// Variable name. If null, the variable is looked up by VariableIndex,
+    /// which is considerably faster.
+    const Char* Name DEFAULT_INITIALIZER(nullptr);
+
+    /// Variable index in the shader stage, see IShaderResourceBinding::GetVariableByIndex().
+    /// Ignored if Name is not null.
+    Uint32 VariableIndex DEFAULT_INITIALIZER(0);
+
+    /// The first array element to update.
+    Uint32 FirstElement DEFAULT_INITIALIZER(0);
+
+    /// The number of array elements to update.
+    Uint32 NumElements DEFAULT_INITIALIZER(1);
+
+    /// Pointer to the array of NumElements objects to bind. Elements may be null.
+    IDeviceObject* const* ppObjects DEFAULT_INITIALIZER(nullptr);
+
+    /// For constant buffers, the buffer range offset, see IShaderResourceVariable::SetBufferRange().
+    /// Buffer range may only be set when NumElements is 1.
+    Uint64 BufferOffset DEFAULT_INITIALIZER(0);
+
+    /// For constant buffers, the buffer range size. If both BufferOffset and BufferRangeSize
+    /// are 0, the whole buffer is bound.
+    Uint64 BufferRangeSize DEFAULT_INITIALIZER(0);
+
+    /// Flags, see Diligent::SET_SHADER_RESOURCE_FLAGS.
+    SET_SHADER_RESOURCE_FLAGS Flags DEFAULT_INITIALIZER(SET_SHADER_RESOURCE_FLAG_NONE);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr ShaderResourceVariableUpdate() noexcept
+    {}
+
+    /// Initializes the structure to update the variable identified by its index.
+    constexpr ShaderResourceVariableUpdate(SHADER_TYPE               _ShaderType,
+                                           Uint32                    _VariableIndex,
+                                           IDeviceObject* const*     _ppObjects,
+                                           Uint32                    _FirstElement = 0,
+                                           Uint32                    _NumElements  = 1,
+                                           SET_SHADER_RESOURCE_FLAGS _Flags        = SET_SHADER_RESOURCE_FLAG_NONE) noexcept :
+        ShaderType{_ShaderType},
+        VariableIndex{_VariableIndex},
+        FirstElement{_FirstElement},
+        NumElements{_NumElements},
+        ppObjects{_ppObjects},
+        Flags{_Flags}
+    {}
+
+    /// Initializes the structure to update the variable identified by its name.
+    constexpr ShaderResourceVariableUpdate(SHADER_TYPE               _ShaderType,
+                                           const Char*               _Name,
+                                           IDeviceObject* const*     _ppObjects,
+                                           Uint32                    _FirstElement = 0,
+                                           Uint32                    _NumElements  = 1,
+                                           SET_SHADER_RESOURCE_FLAGS _Flags        = SET_SHADER_RESOURCE_FLAG_NONE) noexcept :
+        ShaderType{_ShaderType},
+        Name{_Name},
+        FirstElement{_FirstElement},
+        NumElements{_NumElements},
+        ppObjects{_ppObjects},
+        Flags{_Flags}
+    {}
+#endif
+};
+typedef struct ShaderResourceVariableUpdate ShaderResourceVariableUpdate;
+
+
 #define DILIGENT_INTERFACE_NAME IShaderResourceBinding
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -154,6 +226,24 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
 
     /// Returns true if static resources have been initialized in this SRB.
     VIRTUAL Bool METHOD(StaticResourcesInitialized)(THIS) CONST PURE;
+
+
+    /// Updates multiple variables at once.
+
+    /// \param [in] pUpdates   - Array of NumUpdates variable updates, see Diligent::ShaderResourceVariableUpdate.
+    /// \param [in] NumUpdates - The number of updates.
+    ///
+    /// The method has the same effect as looking up every variable and calling
+    /// IShaderResourceVariable::SetArray() or IShaderResourceVariable::SetBufferRange(),
+    /// but resolves the variables directly in the SRB without going through the
+    /// variable interfaces. Grouping updates of the same shader stage together and
+    /// identifying variables by index gives the best performance.
+    ///
+    /// Updates are applied in order. Invalid updates are skipped and reported in
+    /// development builds.
+    VIRTUAL void METHOD(SetVariables)(THIS_
+                                      const ShaderResourceVariableUpdate* pUpdates,
+                                      Uint32                              NumUpdates) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -170,6 +260,7 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceBinding_GetVariableCount(This, ...)        CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableCount,             This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByIndex(This, ...)      CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByIndex,           This, __VA_ARGS__)
 #    define IShaderResourceBinding_StaticResourcesInitialized(This)   CALL_IFACE_METHOD(ShaderResourceBinding, StaticResourcesInitialized,   This)
+#    define IShaderResourceBinding_SetVariables(This, ...)            CALL_IFACE_METHOD(ShaderResourceBinding, SetVariables,                 This, __VA_ARGS__)
 
 // clang-format on
 
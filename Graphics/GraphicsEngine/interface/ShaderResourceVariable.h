@@ -269,6 +269,26 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceVariable, IObject)
     ///                          non-array variables.
     VIRTUAL IDeviceObject* METHOD(Get)(THIS_
                                        Uint32 ArrayIndex DEFAULT_VALUE(0)) CONST PURE;
+
+
+    /// Sets the values of the inline constants.
+
+    /// \param [in] pConstants    - pointer to the array of 32-bit constant values.
+    /// \param [in] FirstConstant - index of the first 32-bit constant to set.
+    /// \param [in] NumConstants  - the number of 32-bit constants to set.
+    ///
+    /// This method is only allowed for variables created with
+    /// Diligent::PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS flag. FirstConstant + NumConstants
+    /// must not exceed the number of constants given by PipelineResourceDesc::ArraySize.
+    ///
+    /// The values are copied to the SRB, and the SRB must be committed with
+    /// IDeviceContext::CommitShaderResources() for the new values to take effect.
+    /// No dynamic memory is allocated: in Direct3D12 backend, the constants are set directly in the
+    /// root signature, while other backends write them to an internal dynamic uniform buffer.
+    VIRTUAL void METHOD(SetInlineConstants)(THIS_
+                                            const void* pConstants,
+                                            Uint32      FirstConstant,
+                                            Uint32      NumConstants) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -278,14 +298,15 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IShaderResourceVariable_Set(This, ...)             CALL_IFACE_METHOD(ShaderResourceVariable, Set,             This, __VA_ARGS__)
-#    define IShaderResourceVariable_SetArray(This, ...)        CALL_IFACE_METHOD(ShaderResourceVariable, SetArray,        This, __VA_ARGS__)
-#    define IShaderResourceVariable_SetBufferRange(This, ...)  CALL_IFACE_METHOD(ShaderResourceVariable, SetBufferRange,  This, __VA_ARGS__)
-#    define IShaderResourceVariable_SetBufferOffset(This, ...) CALL_IFACE_METHOD(ShaderResourceVariable, SetBufferOffset, This, __VA_ARGS__)
-#    define IShaderResourceVariable_GetType(This)              CALL_IFACE_METHOD(ShaderResourceVariable, GetType,         This)
-#    define IShaderResourceVariable_GetResourceDesc(This, ...) CALL_IFACE_METHOD(ShaderResourceVariable, GetResourceDesc, This, __VA_ARGS__)
-#    define IShaderResourceVariable_GetIndex(This)             CALL_IFACE_METHOD(ShaderResourceVariable, GetIndex,        This)
-#    define IShaderResourceVariable_Get(This, ...)             CALL_IFACE_METHOD(ShaderResourceVariable, Get,             This, __VA_ARGS__)
+#    define IShaderResourceVariable_Set(This, ...)                CALL_IFACE_METHOD(ShaderResourceVariable, Set,                This, __VA_ARGS__)
+#    define IShaderResourceVariable_SetArray(This, ...)           CALL_IFACE_METHOD(ShaderResourceVariable, SetArray,           This, __VA_ARGS__)
+#    define IShaderResourceVariable_SetBufferRange(This, ...)     CALL_IFACE_METHOD(ShaderResourceVariable, SetBufferRange,     This, __VA_ARGS__)
+#    define IShaderResourceVariable_SetBufferOffset(This, ...)    CALL_IFACE_METHOD(ShaderResourceVariable, SetBufferOffset,    This, __VA_ARGS__)
+#    define IShaderResourceVariable_GetType(This)                 CALL_IFACE_METHOD(ShaderResourceVariable, GetType,            This)
+#    define IShaderResourceVariable_GetResourceDesc(This, ...)    CALL_IFACE_METHOD(ShaderResourceVariable, GetResourceDesc,    This, __VA_ARGS__)
+#    define IShaderResourceVariable_GetIndex(This)                CALL_IFACE_METHOD(ShaderResourceVariable, GetIndex,           This)
+#    define IShaderResourceVariable_Get(This, ...)                CALL_IFACE_METHOD(ShaderResourceVariable, Get,                This, __VA_ARGS__)
+#    define IShaderResourceVariable_SetInlineConstants(This, ...) CALL_IFACE_METHOD(ShaderResourceVariable, SetInlineConstants, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -91,8 +91,9 @@ DILIGENT_BEGIN_INTERFACE(ISwapChain, IObject)
 
     /// Sets the maximum number of frames that the swap chain is allowed to queue for rendering.
 
-    /// This value is only relevant for D3D11 and D3D12 backends and ignored for others.
-    /// By default it matches the number of buffers in the swap chain. For example, for a 2-buffer
+    /// This value is only relevant for D3D11, D3D12 and Vulkan backends and ignored for others.
+    /// By default it matches the number of buffers in the swap chain, or is 1 when
+    /// the swap chain uses Diligent::SWAP_CHAIN_LATENCY_MODE_LOW. For example, for a 2-buffer
     /// swap chain, the CPU can enqueue frames 0 and 1, but Present command of frame 2
     /// will block until frame 0 is presented. If in the example above the maximum frame latency is set
     /// to 1, then Present command of frame 1 will block until Present of frame 0 is complete.
@@ -73,7 +73,36 @@ DILIGENT_TYPED_ENUM(MISC_TEXTURE_FLAGS, Uint8)
     /// Requires SHADING_RATE_CAP_FLAG_SUBSAMPLED_RENDER_TARGET capability.
     /// 
     /// \note  Copy operations are not supported for subsampled textures.
-    MISC_TEXTURE_FLAG_SUBSAMPLED      = 1u << 3
+    MISC_TEXTURE_FLAG_SUBSAMPLED      = 1u << 3,
+
+    /// The texture memory may be exported to other APIs or processes
+    /// (e.g. video encoders or CUDA) without copying.
+
+    /// \remarks   Requires the ExternalMemory device feature. The texture is always placed
+    ///            in its own memory allocation. Use ITextureVk::ExportMemoryHandle() or
+    ///            ITextureD3D12::CreateSharedHandle() to obtain the handle.
+    MISC_TEXTURE_FLAG_EXPORTABLE      = 1u << 4,
+
+    /// ITexture::CreateView() returns the same view object for identical view descriptions
+    /// instead of creating a new view every time.
+
+    /// \remarks   Cached views are owned by the texture and are destroyed together with it.
+    ///            View descriptions are compared ignoring the name, so a cached view keeps
+    ///            the name it was first created with. Use this flag for textures whose views
+    ///            are recreated frequently, e.g. every frame.
+    MISC_TEXTURE_FLAG_CACHE_VIEWS     = 1u << 5,
+
+    /// Once the texture is transitioned to RESOURCE_STATE_SHADER_RESOURCE state, its state never changes.
+
+    /// \remarks   The flag is intended for textures that are initialized once and only sampled after that.
+    ///            When the texture reaches RESOURCE_STATE_SHADER_RESOURCE state (e.g. when it is first committed
+    ///            after the initial data upload), the state is locked, and the texture is skipped by the state
+    ///            transition and verification loops in IDeviceContext::CommitShaderResources() and
+    ///            IDeviceContext::TransitionShaderResources(). Any operation that requires a different state,
+    ///            such as a copy or an update, is an error after that.
+    ///            The texture must use BIND_SHADER_RESOURCE as the only bind flag and USAGE_IMMUTABLE or
+    ///            USAGE_DEFAULT usage.
+    MISC_TEXTURE_FLAG_CONSTANT_STATE  = 1u << 6
 };
 DEFINE_FLAG_ENUM_OPERATORS(MISC_TEXTURE_FLAGS)
 
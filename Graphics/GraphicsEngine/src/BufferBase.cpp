@@ -145,6 +145,12 @@ void ValidateBufferDesc(const BufferDesc& Desc, const IRenderDevice* pDevice) no
     }
 
 
+    if ((Desc.MiscFlags & MISC_BUFFER_FLAG_EXPORTABLE) != 0)
+    {
+        VERIFY_BUFFER(Features.ExternalMemory, "MISC_BUFFER_FLAG_EXPORTABLE flag requires ExternalMemory feature.");
+        VERIFY_BUFFER(Desc.Usage == USAGE_DEFAULT, "exportable buffers require USAGE_DEFAULT.");
+    }
+
     if (Desc.Usage == USAGE_DYNAMIC && PlatformMisc::CountOneBits(Desc.ImmediateContextMask) > 1)
     {
         bool NeedsBackingResource = (Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0 || Desc.Mode == BUFFER_MODE_FORMATTED;
@@ -25,8 +25,15 @@
  */
 
 #include "DearchiverBase.hpp"
+
+#include <set>
+#include <tuple>
+
+#include "EngineFactory.h"
 #include "PipelineStateBase.hpp"
 #include "PSOSerializer.hpp"
+#include "ThreadPool.hpp"
+#include "Trace.hpp"
 
 namespace Diligent
 {
@@ -94,6 +101,12 @@ bool VerifShaderUnpackInfo(const ShaderUnpackInfo& DeArchiveInfo, IShader** ppSh
 } // namespace
 
 
+DearchiverBase::DearchiverBase(IReferenceCounters* pRefCounters, const DearchiverCreateInfo& CI) noexcept :
+    TObjectBase{pRefCounters},
+    m_pThreadPool{CI.pThreadPool}
+{
+}
+
 DearchiverBase::DeviceType DearchiverBase::GetArchiveDeviceType(const IRenderDevice* pDevice)
 {
     VERIFY_EXPR(pDevice != nullptr);
@@ -404,19 +417,17 @@ void DearchiverBase::PSOData<RayTracingPipelineStateCreateInfo>::CreatePipeline(
     pDevice->CreateRayTracingPipelineState(CreateInfo, ppPSO);
 }
 
-template <typename CreateInfoType>
-bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
-                                      PSOData<CreateInfoType>& PSO,
-                                      IRenderDevice*           pDevice)
+bool DearchiverBase::ReadPSOShaderIndices(const DeviceObjectArchive& ObjArchive,
+                                          ResourceType               ResType,
+                                          const char*                Name,
+                                          DeviceType                 DevType,
+                                          std::vector<Uint32>&       Indices)
 {
-    const auto& pObjArchive = Archive.pObjArchive;
-    VERIFY_EXPR(pObjArchive);
-    const DeviceType      DevType       = GetArchiveDeviceType(pDevice);
-    const SerializedData& ShaderIdxData = pObjArchive->GetDeviceSpecificData(PSO.ArchiveResType, PSO.CreateInfo.PSODesc.Name, DevType);
+    const SerializedData& ShaderIdxData = ObjArchive.GetDeviceSpecificData(ResType, Name, DevType);
     if (!ShaderIdxData)
         return false;
 
-    DynamicLinearAllocator Allocator{GetRawAllocator()};
+    DynamicLinearAllocator Allocator{GetRawAllocator(MEMORY_CATEGORY_ARCHIVE)};
 
     DeviceObjectArchive::ShaderIndexArray ShaderIndices;
     {
@@ -429,57 +440,93 @@ bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
         VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
     }
 
-    ShaderCacheData& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
-
-    PSO.Shaders.resize(ShaderIndices.Count);
-    for (Uint32 i = 0; i < ShaderIndices.Count; ++i)
-    {
-        RefCntAutoPtr<IShader>& pShader{PSO.Shaders[i]};
+    Indices.assign(ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count);
+    return true;
+}
 
-        const Uint32 Idx = ShaderIndices.pIndices[i];
+RefCntAutoPtr<IShader> DearchiverBase::UnpackArchivedShader(ArchiveData&   Archive,
+                                                            DeviceType     DevType,
+                                                            Uint32         Idx,
+                                                            bool           SkipReflection,
+                                                            IRenderDevice* pDevice)
+{
+    const auto& pObjArchive = Archive.pObjArchive;
+    VERIFY_EXPR(pObjArchive);
 
+    ShaderCacheData& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
+    {
+        std::unique_lock<std::mutex> ReadLock{ShaderCache.Mtx};
+        if (Idx < ShaderCache.Shaders.size())
         {
-            std::unique_lock<std::mutex> ReadLock{ShaderCache.Mtx};
-            if (Idx < ShaderCache.Shaders.size())
-            {
-                // Try to get cached shader
-                pShader = ShaderCache.Shaders[Idx];
-                if (pShader)
-                    continue;
-            }
+            // Try to get cached shader
+            if (RefCntAutoPtr<IShader> pShader = ShaderCache.Shaders[Idx])
+                return pShader;
         }
+    }
 
-        const SerializedData& SerializedShader = pObjArchive->GetSerializedShader(DevType, Idx);
-        if (!SerializedShader)
-            return false;
+    // Compressed shaders are decompressed here, so that multiple threads
+    // may decompress different shaders in parallel.
+    const SerializedData& SerializedShader = pObjArchive->GetSerializedShader(DevType, Idx);
+    if (!SerializedShader)
+        return {};
 
+    RefCntAutoPtr<IShader> pShader;
+    {
+        ShaderCreateInfo ShaderCI;
         {
-            ShaderCreateInfo ShaderCI;
+            Serializer<SerializerMode::Read> ShaderSer{SerializedShader};
+            if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(ShaderSer, ShaderCI))
             {
-                Serializer<SerializerMode::Read> ShaderSer{SerializedShader};
-                if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(ShaderSer, ShaderCI))
-                {
-                    LOG_ERROR_MESSAGE("Failed to deserialize shader create info. Archive file may be corrupted or invalid.");
-                    return false;
-                }
-                VERIFY_EXPR(ShaderSer.IsEnded());
+                LOG_ERROR_MESSAGE("Failed to deserialize shader create info. Archive file may be corrupted or invalid.");
+                return {};
             }
+            VERIFY_EXPR(ShaderSer.IsEnded());
+        }
 
-            if ((PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0)
-                ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_SKIP_REFLECTION;
+        if (SkipReflection)
+            ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_SKIP_REFLECTION;
 
-            pShader = UnpackShader(ShaderCI, pDevice);
-            if (!pShader)
-                return false;
-        }
+        pShader = UnpackShader(ShaderCI, pDevice);
+        if (!pShader)
+            return {};
+    }
 
-        // Add to the cache
-        {
-            std::unique_lock<std::mutex> WriteLock{ShaderCache.Mtx};
-            if (Idx >= ShaderCache.Shaders.size())
-                ShaderCache.Shaders.resize(size_t{Idx} + 1);
+    // Add to the cache
+    {
+        std::unique_lock<std::mutex> WriteLock{ShaderCache.Mtx};
+        if (Idx >= ShaderCache.Shaders.size())
+            ShaderCache.Shaders.resize(size_t{Idx} + 1);
+
+        // Another thread may have unpacked the same shader in the meantime
+        if (ShaderCache.Shaders[Idx])
+            pShader = ShaderCache.Shaders[Idx];
+        else
             ShaderCache.Shaders[Idx] = pShader;
-        }
+    }
+
+    return pShader;
+}
+
+template <typename CreateInfoType>
+bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
+                                      PSOData<CreateInfoType>& PSO,
+                                      IRenderDevice*           pDevice)
+{
+    VERIFY_EXPR(Archive.pObjArchive);
+    const DeviceType DevType = GetArchiveDeviceType(pDevice);
+
+    std::vector<Uint32> ShaderIndices;
+    if (!ReadPSOShaderIndices(*Archive.pObjArchive, PSO.ArchiveResType, PSO.CreateInfo.PSODesc.Name, DevType, ShaderIndices))
+        return false;
+
+    const bool SkipReflection = (PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0;
+
+    PSO.Shaders.resize(ShaderIndices.size());
+    for (size_t i = 0; i < ShaderIndices.size(); ++i)
+    {
+        PSO.Shaders[i] = UnpackArchivedShader(Archive, DevType, ShaderIndices[i], SkipReflection, pDevice);
+        if (!PSO.Shaders[i])
+            return false;
     }
 
     return true;
@@ -490,18 +537,21 @@ DearchiverBase::ArchiveData* DearchiverBase::FindArchive(ResourceType ResType, c
     VERIFY_EXPR(ResType != ResourceType::Undefined);
     VERIFY_EXPR(ResName != nullptr);
 
-    const auto archive_idx_it = m_ResNameToArchiveIdx.find(NamedResourceKey{ResType, ResName});
-    if (archive_idx_it == m_ResNameToArchiveIdx.end())
-        return nullptr;
-
-    ArchiveData& Archive = m_Archives[archive_idx_it->second];
-    if (!Archive.pObjArchive)
+    // Archive indices are sorted, so the lookup does not require any
+    // preprocessing when an archive is loaded.
+    for (ArchiveData& Archive : m_Archives)
     {
-        UNEXPECTED("Null object archives should never be added to the list. This is a bug.");
-        return nullptr;
+        if (!Archive.pObjArchive)
+        {
+            UNEXPECTED("Null object archives should never be added to the list. This is a bug.");
+            continue;
+        }
+
+        if (Archive.pObjArchive->HasResource(ResType, ResName))
+            return &Archive;
     }
 
-    return &Archive;
+    return nullptr;
 }
 
 template <typename PSOCreateInfoType>
@@ -590,30 +640,18 @@ static bool ModifyPipelineStateCreateInfo(PSOCreateInfoType&             CreateI
 }
 
 template <typename CreateInfoType>
-void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
-                                             IPipelineState**               ppPSO)
+DearchiverBase::ArchiveData* DearchiverBase::LoadPSOData(const PipelineStateUnpackInfo& UnpackInfo,
+                                                         PSOData<CreateInfoType>&       PSO)
 {
-    VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
-
     constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
 
-    // Do not cache modified PSOs
-    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
-    {
-        // Since PSO names must be unique (for each PSO type), we use a single cache for all
-        // loaded archives.
-        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
-            return;
-    }
-
     // Find the archive that contains this PSO
     ArchiveData* pArchiveData = FindArchive(ResType, UnpackInfo.Name);
     if (pArchiveData == nullptr)
-        return;
+        return nullptr;
 
-    PSOData<CreateInfoType> PSO{GetRawAllocator()};
     if (!pArchiveData->pObjArchive->LoadResourceCommonData(ResType, UnpackInfo.Name, PSO))
-        return;
+        return nullptr;
 
 #ifdef DILIGENT_DEVELOPMENT
     if (UnpackInfo.pDevice->GetDeviceInfo().IsD3DDevice())
@@ -624,13 +662,22 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
     }
 #endif
 
+    return pArchiveData;
+}
+
+template <typename CreateInfoType>
+void DearchiverBase::CreatePipelineState(ArchiveData&                   Archive,
+                                         PSOData<CreateInfoType>&       PSO,
+                                         const PipelineStateUnpackInfo& UnpackInfo,
+                                         IPipelineState**               ppPSO)
+{
     if (!UnpackPSORenderPass(PSO, UnpackInfo.pDevice))
         return;
 
     if (!UnpackPSOSignatures(PSO, UnpackInfo.pDevice))
         return;
 
-    if (!UnpackPSOShaders(*pArchiveData, PSO, UnpackInfo.pDevice))
+    if (!UnpackPSOShaders(Archive, PSO, UnpackInfo.pDevice))
         return;
 
     PSO.AssignShaders();
@@ -644,8 +691,177 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
 
     PSO.CreatePipeline(UnpackInfo.pDevice, ppPSO);
 
+    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr && *ppPSO != nullptr)
+        m_Cache.PSO.Set(PSO.ArchiveResType, UnpackInfo.Name, *ppPSO);
+}
+
+template <typename CreateInfoType>
+void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
+                                             IPipelineState**               ppPSO)
+{
+    DILIGENT_TRACE_SCOPE("UnpackPipelineState");
+
+    VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
+
+    constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
+
+    // Do not cache modified PSOs
     if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
-        m_Cache.PSO.Set(ResType, UnpackInfo.Name, *ppPSO);
+    {
+        // Since PSO names must be unique (for each PSO type), we use a single cache for all
+        // loaded archives.
+        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
+            return;
+    }
+
+    PSOData<CreateInfoType> PSO{GetRawAllocator(MEMORY_CATEGORY_ARCHIVE)};
+
+    ArchiveData* pArchiveData = LoadPSOData(UnpackInfo, PSO);
+    if (pArchiveData == nullptr)
+        return;
+
+    CreatePipelineState(*pArchiveData, PSO, UnpackInfo, ppPSO);
+}
+
+template <typename CreateInfoType>
+void DearchiverBase::UnpackPipelineStatesImpl(const PipelineStateUnpackInfo* pUnpackInfos,
+                                              const std::vector<Uint32>&     PSOIndices,
+                                              IPipelineState**               ppPSOs)
+{
+    DILIGENT_TRACE_SCOPE("UnpackPipelineStates");
+
+    constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
+
+    struct PSOItem
+    {
+        const Uint32 Idx;
+
+        ArchiveData*                             pArchiveData = nullptr;
+        std::unique_ptr<PSOData<CreateInfoType>> pData;
+        std::vector<Uint32>                      ShaderIndices;
+    };
+    std::vector<PSOItem> Items;
+    Items.reserve(PSOIndices.size());
+
+    // Pipelines that are requested multiple times are only unpacked once.
+    // Modified pipelines are never shared.
+    std::unordered_map<std::string, Uint32>   ItemByName;
+    std::vector<std::pair<Uint32, Uint32>>    Duplicates; // {PSO index, Item index}
+    for (Uint32 Idx : PSOIndices)
+    {
+        const PipelineStateUnpackInfo& UnpackInfo = pUnpackInfos[Idx];
+        if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
+        {
+            if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, &ppPSOs[Idx]))
+                continue;
+
+            auto it_inserted = ItemByName.emplace(UnpackInfo.Name, static_cast<Uint32>(Items.size()));
+            if (!it_inserted.second)
+            {
+                Duplicates.emplace_back(Idx, it_inserted.first->second);
+                continue;
+            }
+        }
+        Items.push_back({Idx});
+    }
+
+    // Deserialize pipeline data
+    ParallelFor(m_pThreadPool, 0, static_cast<Uint32>(Items.size()), 1,
+                [&](Uint32 i) {
+                    PSOItem&                       Item       = Items[i];
+                    const PipelineStateUnpackInfo& UnpackInfo = pUnpackInfos[Item.Idx];
+
+                    Item.pData        = std::make_unique<PSOData<CreateInfoType>>(GetRawAllocator(MEMORY_CATEGORY_ARCHIVE));
+                    Item.pArchiveData = LoadPSOData(UnpackInfo, *Item.pData);
+                    if (Item.pArchiveData == nullptr ||
+                        !ReadPSOShaderIndices(*Item.pArchiveData->pObjArchive, ResType, UnpackInfo.Name,
+                                              GetArchiveDeviceType(UnpackInfo.pDevice), Item.ShaderIndices))
+                    {
+                        Item.pData.reset();
+                    }
+                });
+
+    // Collect unique render passes, explicit resource signatures and shaders used by the pipelines.
+    std::vector<std::function<RefCntAutoPtr<IDeviceObject>()>> UnpackObjects;
+    {
+        std::unordered_set<std::string>                           RenderPasses;
+        std::unordered_set<std::string>                           Signatures;
+        std::set<std::tuple<ArchiveData*, DeviceType, Uint32>>    Shaders;
+        for (PSOItem& Item : Items)
+        {
+            if (!Item.pData)
+                continue;
+
+            const PSOData<CreateInfoType>& PSO     = *Item.pData;
+            IRenderDevice* const           pDevice = pUnpackInfos[Item.Idx].pDevice;
+
+            if (PSO.RenderPassName != nullptr && *PSO.RenderPassName != '\0' && RenderPasses.emplace(PSO.RenderPassName).second)
+            {
+                UnpackObjects.emplace_back([this, pDevice, Name = PSO.RenderPassName]() {
+                    RefCntAutoPtr<IRenderPass> pRenderPass;
+                    UnpackRenderPass(RenderPassUnpackInfo{pDevice, Name}, &pRenderPass);
+                    return RefCntAutoPtr<IDeviceObject>{pRenderPass};
+                });
+            }
+
+            // Implicit signatures are not shared between pipelines
+            if ((PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_IMPLICIT_SIGNATURE0) == 0)
+            {
+                for (Uint32 i = 0; i < PSO.CreateInfo.ResourceSignaturesCount; ++i)
+                {
+                    const char* Name = PSO.PRSNames[i];
+                    if (Name == nullptr || !Signatures.emplace(Name).second)
+                        continue;
+
+                    ResourceSignatureUnpackInfo UnpackInfo{pDevice, Name};
+                    UnpackInfo.SRBAllocationGranularity = PSO.CreateInfo.PSODesc.SRBAllocationGranularity;
+                    UnpackObjects.emplace_back([this, UnpackInfo]() {
+                        return RefCntAutoPtr<IDeviceObject>{UnpackResourceSignature(UnpackInfo, /*IsImplicit = */ false)};
+                    });
+                }
+            }
+
+            const DeviceType DevType        = GetArchiveDeviceType(pDevice);
+            const bool       SkipReflection = (PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0;
+            for (Uint32 ShaderIdx : Item.ShaderIndices)
+            {
+                if (!Shaders.emplace(Item.pArchiveData, DevType, ShaderIdx).second)
+                    continue;
+
+                ArchiveData* pArchiveData = Item.pArchiveData;
+                UnpackObjects.emplace_back([this, pArchiveData, DevType, ShaderIdx, SkipReflection, pDevice]() {
+                    return RefCntAutoPtr<IDeviceObject>{UnpackArchivedShader(*pArchiveData, DevType, ShaderIdx, SkipReflection, pDevice)};
+                });
+            }
+        }
+    }
+
+    // Unpack shared objects. Signature and render pass caches only keep weak references,
+    // so the objects must be kept alive until all pipelines are created.
+    std::vector<RefCntAutoPtr<IDeviceObject>> Objects(UnpackObjects.size());
+    ParallelFor(m_pThreadPool, 0, static_cast<Uint32>(UnpackObjects.size()), 1,
+                [&](Uint32 i) {
+                    Objects[i] = UnpackObjects[i]();
+                });
+
+    // Create pipelines. All shared objects are now found in the caches.
+    ParallelFor(m_pThreadPool, 0, static_cast<Uint32>(Items.size()), 1,
+                [&](Uint32 i) {
+                    PSOItem& Item = Items[i];
+                    if (!Item.pData)
+                        return;
+
+                    Item.pData->CreateInfo.Flags |= PSO_CREATE_FLAG_ASYNCHRONOUS;
+                    CreatePipelineState(*Item.pArchiveData, *Item.pData, pUnpackInfos[Item.Idx], &ppPSOs[Item.Idx]);
+                });
+
+    for (const auto& Duplicate : Duplicates)
+    {
+        IPipelineState* pPSO = ppPSOs[Items[Duplicate.second].Idx];
+        if (pPSO != nullptr)
+            pPSO->AddRef();
+        ppPSOs[Duplicate.first] = pPSO;
+    }
 }
 
 bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVersion, bool MakeCopy)
@@ -666,30 +882,26 @@ bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVe
     if (!pObjArchive->Deserialize(DeviceObjectArchive::CreateInfo{pArchiveData, ContentVersion, MakeCopy}))
         return false;
 
-    const size_t ArchiveIdx = m_Archives.size();
-
-    const auto& ArchiveResources = pObjArchive->GetNamedResources();
-    for (const auto& it : ArchiveResources)
+#ifdef DILIGENT_DEVELOPMENT
+    // Resources are looked up in the archives in the order the archives were loaded,
+    // so a resource in this archive is hidden by the resource with the same name in
+    // a previously loaded archive.
+    if (!m_Archives.empty())
     {
-        const ResourceType ResType      = it.first.GetType();
-        const char*        ResName      = it.first.GetName();
-        constexpr bool     MakeNameCopy = true;
-
-        const auto it_inserted = m_ResNameToArchiveIdx.emplace(NamedResourceKey{ResType, ResName, MakeNameCopy}, ArchiveIdx);
-        if (!it_inserted.second)
-        {
-            const auto& OtherArchiveResources = m_Archives[it_inserted.first->second].pObjArchive->GetNamedResources();
-            const auto  it_other              = OtherArchiveResources.find(NamedResourceKey{ResType, ResName});
-
-            const bool IsDuplicate =
-                (it_other != OtherArchiveResources.end()) &&
-                (it.second == it_other->second);
-            if (!IsDuplicate)
+        pObjArchive->ProcessResources([this](ResourceType ResType, const char* ResName, const DeviceObjectArchive::ResourceData& ResData) {
+            for (const ArchiveData& Archive : m_Archives)
             {
-                LOG_ERROR_MESSAGE("Resource with name '", ResName, "' already exists in the archive.");
+                DeviceObjectArchive::ResourceData OtherResData;
+                if (Archive.pObjArchive->FindResource(ResType, ResName, OtherResData) != nullptr)
+                {
+                    if (ResData != OtherResData)
+                        LOG_ERROR_MESSAGE("Resource with name '", ResName, "' already exists in the archive.");
+                    break;
+                }
             }
-        }
+        });
     }
+#endif
 
     m_Archives.emplace_back(std::move(pObjArchive));
 
@@ -729,6 +941,68 @@ void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackIn
     }
 }
 
+void DearchiverBase::UnpackPipelineStates(const PipelineStateUnpackInfo* pUnpackInfos,
+                                          Uint32                         NumPSOs,
+                                          IPipelineState**               ppPSOs)
+{
+    if (NumPSOs == 0)
+        return;
+
+    if (pUnpackInfos == nullptr || ppPSOs == nullptr)
+    {
+        DEV_ERROR("pUnpackInfos and ppPSOs must not be null");
+        return;
+    }
+
+    // Pipelines of each type are unpacked together
+    enum PSO_GROUP
+    {
+        PSO_GROUP_GRAPHICS,
+        PSO_GROUP_COMPUTE,
+        PSO_GROUP_RAY_TRACING,
+        PSO_GROUP_TILE,
+        PSO_GROUP_COUNT
+    };
+    std::array<std::vector<Uint32>, PSO_GROUP_COUNT> PSOIndices;
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        const PipelineStateUnpackInfo& UnpackInfo = pUnpackInfos[i];
+        if (!VerifyPipelineStateUnpackInfo(UnpackInfo, &ppPSOs[i]))
+            continue;
+
+        ppPSOs[i] = nullptr;
+
+        switch (UnpackInfo.PipelineType)
+        {
+            case PIPELINE_TYPE_GRAPHICS:
+            case PIPELINE_TYPE_MESH:
+                PSOIndices[PSO_GROUP_GRAPHICS].push_back(i);
+                break;
+
+            case PIPELINE_TYPE_COMPUTE:
+                PSOIndices[PSO_GROUP_COMPUTE].push_back(i);
+                break;
+
+            case PIPELINE_TYPE_RAY_TRACING:
+                PSOIndices[PSO_GROUP_RAY_TRACING].push_back(i);
+                break;
+
+            case PIPELINE_TYPE_TILE:
+                PSOIndices[PSO_GROUP_TILE].push_back(i);
+                break;
+
+            case PIPELINE_TYPE_INVALID:
+            default:
+                LOG_ERROR_MESSAGE("Unsupported pipeline type");
+        }
+    }
+
+    UnpackPipelineStatesImpl<GraphicsPipelineStateCreateInfo>(pUnpackInfos, PSOIndices[PSO_GROUP_GRAPHICS], ppPSOs);
+    UnpackPipelineStatesImpl<ComputePipelineStateCreateInfo>(pUnpackInfos, PSOIndices[PSO_GROUP_COMPUTE], ppPSOs);
+    UnpackPipelineStatesImpl<RayTracingPipelineStateCreateInfo>(pUnpackInfos, PSOIndices[PSO_GROUP_RAY_TRACING], ppPSOs);
+    UnpackPipelineStatesImpl<TilePipelineStateCreateInfo>(pUnpackInfos, PSOIndices[PSO_GROUP_TILE], ppPSOs);
+}
+
 static bool ModifyShaderDesc(ShaderDesc&             Desc,
                              const ShaderUnpackInfo& UnpackInfo)
 {
@@ -751,6 +1025,8 @@ static bool ModifyShaderDesc(ShaderDesc&             Desc,
 void DearchiverBase::UnpackShader(const ShaderUnpackInfo& UnpackInfo,
                                   IShader**               ppShader)
 {
+    DILIGENT_TRACE_SCOPE("UnpackShader");
+
     if (!VerifShaderUnpackInfo(UnpackInfo, ppShader))
         return;
 
@@ -810,6 +1086,8 @@ void DearchiverBase::UnpackShader(const ShaderUnpackInfo& UnpackInfo,
 void DearchiverBase::UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo,
                                              IPipelineResourceSignature**       ppSignature)
 {
+    DILIGENT_TRACE_SCOPE("UnpackResourceSignature");
+
     if (!VerifyResourceSignatureUnpackInfo(DeArchiveInfo, ppSignature))
         return;
 
@@ -822,6 +1100,8 @@ void DearchiverBase::UnpackResourceSignature(const ResourceSignatureUnpackInfo&
 
 void DearchiverBase::UnpackRenderPass(const RenderPassUnpackInfo& UnpackInfo, IRenderPass** ppRP)
 {
+    DILIGENT_TRACE_SCOPE("UnpackRenderPass");
+
     if (!VerifyRenderPassUnpackInfo(UnpackInfo, ppRP))
         return;
 
@@ -845,7 +1125,7 @@ void DearchiverBase::UnpackRenderPass(const RenderPassUnpackInfo& UnpackInfo, IR
     const auto& pObjArchive = pArchiveData->pObjArchive;
     VERIFY_EXPR(pObjArchive);
 
-    RPData RP{GetRawAllocator()};
+    RPData RP{GetRawAllocator(MEMORY_CATEGORY_ARCHIVE)};
     if (!pArchiveData->pObjArchive->LoadResourceCommonData(RPData::ArchiveResType, UnpackInfo.Name, RP))
         return;
 
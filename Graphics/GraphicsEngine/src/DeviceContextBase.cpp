@@ -215,6 +215,62 @@ bool VerifyDrawMeshIndirectAttribs(const DrawMeshIndirectAttribs& Attribs, Uint3
     return true;
 }
 
+bool VerifyExecuteIndirectCommandsAttribs(const ExecuteIndirectCommandsAttribs& Attribs, const IPipelineState* pPipeline, bool IndexBufferBound)
+{
+    const IBuffer* pArgsBuffer    = Attribs.pArgsBuffer;
+    const IBuffer* pCounterBuffer = Attribs.pCounterBuffer;
+
+#define CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS(Expr, ...) CHECK_PARAMETER(Expr, "Execute indirect commands attribs are invalid: ", __VA_ARGS__)
+
+    CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS(Attribs.pSignature != nullptr, "indirect command signature must not be null.");
+    CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS(pArgsBuffer != nullptr, "indirect arguments buffer must not be null.");
+
+    const IndirectCommandSignatureDesc& SignDesc = Attribs.pSignature->GetDesc();
+    CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS(SignDesc.pPipeline == nullptr || SignDesc.pPipeline == pPipeline,
+                                            "indirect command signature '", SignDesc.Name, "' was created for pipeline '", SignDesc.pPipeline->GetDesc().Name,
+                                            "', but pipeline '", pPipeline->GetDesc().Name, "' is currently bound.");
+
+    bool HasIndexBufferArg = false;
+    for (Uint32 i = 0; i < SignDesc.NumArguments; ++i)
+    {
+        const INDIRECT_COMMAND_ARGUMENT_TYPE ArgType = SignDesc.pArguments[i].Type;
+        if (ArgType == INDIRECT_COMMAND_ARGUMENT_TYPE_INDEX_BUFFER)
+        {
+            HasIndexBufferArg = true;
+        }
+        else if (ArgType == INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW_INDEXED && !HasIndexBufferArg)
+        {
+            CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS(IndexBufferBound, "indirect command signature '", SignDesc.Name,
+                                                    "' contains indexed draw argument, but no index buffer argument, and no index buffer is bound.");
+            CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS(Attribs.IndexType == VT_UINT16 || Attribs.IndexType == VT_UINT32,
+                                                    "IndexType (", GetValueTypeString(Attribs.IndexType), ") must be VT_UINT16 or VT_UINT32.");
+        }
+    }
+
+    const BufferDesc& ArgsBuffDesc = pArgsBuffer->GetDesc();
+    CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS((ArgsBuffDesc.BindFlags & BIND_INDIRECT_DRAW_ARGS) != 0,
+                                            "indirect arguments buffer '", ArgsBuffDesc.Name, "' was not created with BIND_INDIRECT_DRAW_ARGS flag.");
+    CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS(Attribs.ArgsOffset % 4 == 0, "ArgsOffset (", Attribs.ArgsOffset, ") must be a multiple of 4.");
+
+    const Uint64 ReqArgsBufSize = Attribs.ArgsOffset + Uint64{Attribs.pSignature->GetCommandStride()} * Uint64{Attribs.MaxCommandCount};
+    CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS(ReqArgsBufSize <= ArgsBuffDesc.Size, "invalid ArgsOffset (", Attribs.ArgsOffset,
+                                            ") or indirect arguments buffer '", ArgsBuffDesc.Name, "' size must be at least ", ReqArgsBufSize, " bytes");
+
+    if (pCounterBuffer != nullptr)
+    {
+        const BufferDesc& CntBuffDesc = pCounterBuffer->GetDesc();
+        CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS((CntBuffDesc.BindFlags & BIND_INDIRECT_DRAW_ARGS) != 0, "indirect counter buffer '",
+                                                CntBuffDesc.Name, "' was not created with BIND_INDIRECT_DRAW_ARGS flag.");
+        const Uint64 ReqCountBufSize = Attribs.CounterOffset + sizeof(Uint32);
+        CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS(ReqCountBufSize <= CntBuffDesc.Size, "invalid CounterOffset (", Attribs.CounterOffset,
+                                                ") or counter buffer '", CntBuffDesc.Name, "' size must be at least ", ReqCountBufSize, " bytes");
+    }
+
+#undef CHECK_EXECUTE_INDIRECT_COMMANDS_ATTRIBS
+
+    return true;
+}
+
 bool VerifyMultiDrawAttribs(const MultiDrawAttribs& Attribs)
 {
     DEV_CHECK_ERR(Attribs.DrawCount == 0 || Attribs.pDrawItems != nullptr, "DrawCount is ", Attribs.DrawCount, ", but pDrawItems is null.");
@@ -421,7 +477,11 @@ static bool VerifyAliasingBarrierDesc(const StateTransitionDesc& Barrier)
 {
     VERIFY_EXPR(Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING);
 
-    auto VerifySparseAliasedResource = [](IDeviceObject* pResource) //
+    // Placed resources (see IRenderDevice::CreatePlacedTexture()) are USAGE_DEFAULT resources
+    // that may alias each other without any special flags.
+    bool AllSparse = true;
+
+    auto VerifyAliasedResource = [&AllSparse](IDeviceObject* pResource) //
     {
         if (pResource == nullptr)
             return RESOURCE_DIM_UNDEFINED;
@@ -429,10 +489,12 @@ static bool VerifyAliasingBarrierDesc(const StateTransitionDesc& Barrier)
         if (RefCntAutoPtr<ITexture> pTexture{pResource, IID_Texture})
         {
             const TextureDesc& TexDesc = pTexture->GetDesc();
-            DEV_CHECK_ERR(TexDesc.Usage == USAGE_SPARSE,
-                          "Texture '", TexDesc.Name, "' used in an aliasing barrier is not a sparse resource");
-            DEV_CHECK_ERR((TexDesc.MiscFlags & MISC_TEXTURE_FLAG_SPARSE_ALIASING) != 0,
+            DEV_CHECK_ERR(TexDesc.Usage == USAGE_SPARSE || TexDesc.Usage == USAGE_DEFAULT,
+                          "Texture '", TexDesc.Name, "' used in an aliasing barrier is neither a sparse nor a placed resource");
+            DEV_CHECK_ERR(TexDesc.Usage != USAGE_SPARSE || (TexDesc.MiscFlags & MISC_TEXTURE_FLAG_SPARSE_ALIASING) != 0,
                           "Texture '", TexDesc.Name, "' used in an aliasing barrier was not created with MISC_TEXTURE_FLAG_SPARSE_ALIASING flag");
+            if (TexDesc.Usage != USAGE_SPARSE)
+                AllSparse = false;
 
             return TexDesc.Type;
         }
@@ -440,10 +502,12 @@ static bool VerifyAliasingBarrierDesc(const StateTransitionDesc& Barrier)
         {
             const BufferDesc& BuffDesc = pBuffer->GetDesc();
 
-            DEV_CHECK_ERR(BuffDesc.Usage == USAGE_SPARSE,
-                          "Buffer '", BuffDesc.Name, "' used in an aliasing barrier is not a sparse resource");
-            DEV_CHECK_ERR((BuffDesc.MiscFlags & MISC_BUFFER_FLAG_SPARSE_ALIASING) != 0,
+            DEV_CHECK_ERR(BuffDesc.Usage == USAGE_SPARSE || BuffDesc.Usage == USAGE_DEFAULT,
+                          "Buffer '", BuffDesc.Name, "' used in an aliasing barrier is neither a sparse nor a placed resource");
+            DEV_CHECK_ERR(BuffDesc.Usage != USAGE_SPARSE || (BuffDesc.MiscFlags & MISC_BUFFER_FLAG_SPARSE_ALIASING) != 0,
                           "Buffer '", BuffDesc.Name, "' used in an aliasing barrier was not created with MISC_BUFFER_FLAG_SPARSE_ALIASING flag");
+            if (BuffDesc.Usage != USAGE_SPARSE)
+                AllSparse = false;
 
             return RESOURCE_DIM_BUFFER;
         }
@@ -454,9 +518,9 @@ static bool VerifyAliasingBarrierDesc(const StateTransitionDesc& Barrier)
         }
     };
 
-    RESOURCE_DIMENSION BeforeDim = VerifySparseAliasedResource(Barrier.pResourceBefore);
-    RESOURCE_DIMENSION AfterDim  = VerifySparseAliasedResource(Barrier.pResource);
-    if (BeforeDim != RESOURCE_DIM_UNDEFINED && AfterDim != RESOURCE_DIM_UNDEFINED)
+    RESOURCE_DIMENSION BeforeDim = VerifyAliasedResource(Barrier.pResourceBefore);
+    RESOURCE_DIMENSION AfterDim  = VerifyAliasedResource(Barrier.pResource);
+    if (AllSparse && BeforeDim != RESOURCE_DIM_UNDEFINED && AfterDim != RESOURCE_DIM_UNDEFINED)
     {
         CHECK_STATE_TRANSITION_DESC((BeforeDim == RESOURCE_DIM_BUFFER) == (AfterDim == RESOURCE_DIM_BUFFER),
                                     "Both before- and after-resources must either be buffers or textures. "
@@ -506,6 +570,8 @@ bool VerifyStateTransitionDesc(const IRenderDevice*       pDevice,
                                     "the state of texture '", TexDesc.Name,
                                     "' is unknown to the engine and is not explicitly specified in the barrier.");
         CHECK_STATE_TRANSITION_DESC(VerifyResourceStates(OldState, true), "invalid old state specified for texture '", TexDesc.Name, "'.");
+        CHECK_STATE_TRANSITION_DESC((TexDesc.MiscFlags & MISC_TEXTURE_FLAG_CONSTANT_STATE) == 0 || pTexture->GetState() != RESOURCE_STATE_SHADER_RESOURCE || Barrier.NewState == RESOURCE_STATE_SHADER_RESOURCE,
+                                    "texture '", TexDesc.Name, "' was created with MISC_TEXTURE_FLAG_CONSTANT_STATE flag and can't be transitioned out of RESOURCE_STATE_SHADER_RESOURCE state.");
 
         CHECK_STATE_TRANSITION_DESC(Barrier.FirstMipLevel < TexDesc.MipLevels, "first mip level (", Barrier.FirstMipLevel,
                                     ") specified by the barrier is out of range. Texture '",
@@ -810,8 +876,30 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
 
     CHECK_BUILD_TLAS_ATTRIBS(Attribs.pTLAS != nullptr, "pTLAS must not be null.");
     CHECK_BUILD_TLAS_ATTRIBS(Attribs.pScratchBuffer != nullptr, "pScratchBuffer must not be null.");
-    CHECK_BUILD_TLAS_ATTRIBS(Attribs.pInstances != nullptr, "pInstances must not be null.");
     CHECK_BUILD_TLAS_ATTRIBS(Attribs.pInstanceBuffer != nullptr, "pInstanceBuffer must not be null.");
+    CHECK_BUILD_TLAS_ATTRIBS(Attribs.InstanceUploadMode < TLAS_INSTANCE_UPLOAD_MODE_COUNT, "InstanceUploadMode (", Uint32{Attribs.InstanceUploadMode}, ") is invalid.");
+
+    static_assert(TLAS_INSTANCE_UPLOAD_MODE_COUNT == 3, "Please handle the new instance upload mode below");
+    switch (Attribs.InstanceUploadMode)
+    {
+        case TLAS_INSTANCE_UPLOAD_MODE_ALL:
+            CHECK_BUILD_TLAS_ATTRIBS(Attribs.pInstances != nullptr, "pInstances must not be null.");
+            break;
+
+        case TLAS_INSTANCE_UPLOAD_MODE_DIRTY:
+            CHECK_BUILD_TLAS_ATTRIBS(Attribs.pInstances != nullptr || Attribs.DirtyInstanceCount == 0,
+                                     "pInstances must not be null when DirtyInstanceCount is not zero.");
+            CHECK_BUILD_TLAS_ATTRIBS(Attribs.DirtyInstanceCount <= Attribs.InstanceCount,
+                                     "DirtyInstanceCount (", Attribs.DirtyInstanceCount, ") must not exceed InstanceCount (", Attribs.InstanceCount, ").");
+            CHECK_BUILD_TLAS_ATTRIBS(Attribs.RebuildThreshold >= 0, "RebuildThreshold (", Attribs.RebuildThreshold, ") must not be negative.");
+            break;
+
+        case TLAS_INSTANCE_UPLOAD_MODE_GPU:
+            break;
+
+        default:
+            UNEXPECTED("Unexpected instance upload mode");
+    }
 
     CHECK_BUILD_TLAS_ATTRIBS(Attribs.BindingMode == HIT_GROUP_BINDING_MODE_USER_DEFINED || Attribs.HitGroupStride != 0,
                              "HitGroupStride must be greater than 0 if BindingMode is not HIT_GROUP_BINDING_MODE_USER_DEFINED.");
@@ -832,12 +920,32 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
                                  "Update is true, but InstanceCount (", Attribs.InstanceCount, ") does not match the previous value (", PrevInstanceCount, ").");
     }
 
+    // Instances of the previous build are reused when only the changed instances are provided, or when the instance table is not provided at all
+    const bool ReuseInstances =
+        (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_DIRTY) ||
+        (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_GPU && Attribs.pInstances == nullptr);
+    if (ReuseInstances)
+    {
+        const TLASBuildInfo& PrevBuildInfo = Attribs.pTLAS->GetBuildInfo();
+        CHECK_BUILD_TLAS_ATTRIBS(PrevBuildInfo.InstanceCount == Attribs.InstanceCount,
+                                 "InstanceCount (", Attribs.InstanceCount, ") does not match the number of instances in the previous build (", PrevBuildInfo.InstanceCount,
+                                 "). Instances of the previous build can only be reused when the instance count is the same.");
+        CHECK_BUILD_TLAS_ATTRIBS(PrevBuildInfo.BindingMode == Attribs.BindingMode &&
+                                     PrevBuildInfo.HitGroupStride == Attribs.HitGroupStride &&
+                                     PrevBuildInfo.FirstContributionToHitGroupIndex == Attribs.BaseContributionToHitGroupIndex,
+                                 "BindingMode, HitGroupStride and BaseContributionToHitGroupIndex must be the same as in the previous build when instances of the previous build are reused.");
+    }
+
     const BufferDesc& InstDesc          = Attribs.pInstanceBuffer->GetDesc();
     const size_t      InstDataSize      = size_t{Attribs.InstanceCount} * size_t{TLAS_INSTANCE_DATA_SIZE};
     Uint32            AutoOffsetCounter = 0;
 
+    Uint32 NumInstances = Attribs.pInstances != nullptr ? Attribs.InstanceCount : 0;
+    if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_DIRTY)
+        NumInstances = Attribs.DirtyInstanceCount;
+
     // Calculate instance data size
-    for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
+    for (Uint32 i = 0; i < NumInstances; ++i)
     {
         constexpr Uint32             BitMask = (1u << 24) - 1;
         const TLASBuildInstanceData& Inst    = Attribs.pInstances[i];
@@ -856,6 +964,12 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
             const TLASInstanceDesc IDesc = Attribs.pTLAS->GetInstanceDesc(Inst.InstanceName);
             CHECK_BUILD_TLAS_ATTRIBS(IDesc.InstanceIndex != INVALID_INDEX, "Update is true, but pInstances[", i, "].InstanceName does not exists.");
         }
+        else if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_DIRTY)
+        {
+            const TLASInstanceDesc IDesc = Attribs.pTLAS->GetInstanceDesc(Inst.InstanceName);
+            CHECK_BUILD_TLAS_ATTRIBS(IDesc.InstanceIndex != INVALID_INDEX, "InstanceUploadMode is TLAS_INSTANCE_UPLOAD_MODE_DIRTY, but pInstances[", i,
+                                     "].InstanceName does not exist in the previous build.");
+        }
 
         if (Inst.ContributionToHitGroupIndex == TLAS_INSTANCE_OFFSET_AUTO)
             ++AutoOffsetCounter;
@@ -866,7 +980,7 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
                                  "if BindingMode is not HIT_GROUP_BINDING_MODE_USER_DEFINED.");
     }
 
-    CHECK_BUILD_TLAS_ATTRIBS(AutoOffsetCounter == 0 || AutoOffsetCounter == Attribs.InstanceCount,
+    CHECK_BUILD_TLAS_ATTRIBS(AutoOffsetCounter == 0 || AutoOffsetCounter == NumInstances,
                              "all pInstances[i].ContributionToHitGroupIndex must be TLAS_INSTANCE_OFFSET_AUTO, or none of them should.");
 
     CHECK_BUILD_TLAS_ATTRIBS(Attribs.InstanceBufferOffset <= InstDesc.Size,
@@ -892,7 +1006,7 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
                              "ScratchBufferOffset (", Attribs.ScratchBufferOffset, ") must be aligned by ", RTProps.ScratchBufferAlignment,
                              " (RayTracingProperties::ScratchBufferAlignment).");
 
-    if (Attribs.Update)
+    if (IsTLASUpdate(Attribs))
     {
         CHECK_BUILD_TLAS_ATTRIBS(ScratchDesc.Size - Attribs.ScratchBufferOffset >= Attribs.pTLAS->GetScratchBufferSizes().Update,
                                  "pScratchBuffer size is too small, use pTLAS->GetScratchBufferSizes().Update to get the required size for scratch buffer.");
@@ -910,6 +1024,18 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
     return true;
 }
 
+bool IsTLASUpdate(const BuildTLASAttribs& Attribs)
+{
+    if (!Attribs.Update)
+        return false;
+
+    if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_DIRTY &&
+        static_cast<double>(Attribs.DirtyInstanceCount) > static_cast<double>(Attribs.InstanceCount) * Attribs.RebuildThreshold)
+        return false;
+
+    return true;
+}
+
 
 bool VerifyCopyBLASAttribs(const IRenderDevice* pDevice, const CopyBLASAttribs& Attribs)
 {
@@ -28,11 +28,13 @@
 
 #include <algorithm>
 #include <sstream>
+#include <cstring>
 
 #include "Shader.h"
 #include "EngineMemory.h"
 #include "DataBlobImpl.hpp"
 #include "PSOSerializer.hpp"
+#include "LZ4Compression.hpp"
 
 namespace Diligent
 {
@@ -106,42 +108,94 @@ struct ArchiveSerializer
         return true;
     }
 
-    bool SerializeShaders(ConstQual<ShadersVector>& Shaders) const;
+    // Pads the data with zeros to align the current offset
+    bool AlignOffset(size_t Alignment) const
+    {
+        static_assert(Mode == SerializerMode::Measure || Mode == SerializerMode::Write, "Measure or Write mode is expected.");
+
+        static constexpr Uint8 Padding[16] = {};
+
+        const size_t Offset      = Ser.GetSize();
+        const size_t PaddingSize = AlignUp(Offset, Alignment) - Offset;
+        VERIFY_EXPR(PaddingSize <= sizeof(Padding));
+        return Ser.CopyBytes(Padding, PaddingSize);
+    }
 };
 
-template <SerializerMode Mode>
-bool ArchiveSerializer<Mode>::SerializeShaders(ConstQual<ShadersVector>& Shaders) const
+// Resource data alignment. Resource data is deserialized by a separate serializer, so
+// its start must be aligned to make the alignment of the data inside the same as in the archive.
+constexpr size_t ResourceDataAlignment = 8;
+
+static_assert(sizeof(DeviceObjectArchive::ResourceIndexEntry) == 32, "Please update the archive version if the index entry layout changes");
+static_assert(sizeof(DeviceObjectArchive::ShaderIndexEntry) == 24, "Please update the archive version if the index entry layout changes");
+
+// Compares resources by type and name. Archive index entries are sorted in this order.
+int CompareResources(DeviceObjectArchive::ResourceType Type1, const char* Name1,
+                     DeviceObjectArchive::ResourceType Type2, const char* Name2)
 {
-    static_assert(Mode == SerializerMode::Measure || Mode == SerializerMode::Write, "Measure or Write mode is expected.");
+    if (Type1 != Type2)
+        return Type1 < Type2 ? -1 : +1;
 
-    Uint32 NumShaders = static_cast<Uint32>(Shaders.size());
-    if (!Ser(NumShaders))
-        return false;
+    return strcmp(Name1, Name2);
+}
 
-    for (const auto& Shader : Shaders)
-    {
-        if (!Ser.Serialize(Shader))
-            return false;
-    }
+bool IsValidRange(Uint64 Offset, Uint64 Size, size_t ArchiveSize)
+{
+    return Offset <= ArchiveSize && Size <= ArchiveSize - Offset;
+}
 
-    return true;
+SerializedData MakeDataReference(const SerializedData& Data)
+{
+    return SerializedData{Data.Ptr(), Data.Size()};
 }
 
-template <>
-bool ArchiveSerializer<SerializerMode::Read>::SerializeShaders(ShadersVector& Shaders) const
+DeviceObjectArchive::ResourceData MakeDataReference(const DeviceObjectArchive::ResourceData& Data)
 {
-    Uint32 NumShaders = 0;
-    if (!Ser(NumShaders))
-        return false;
+    DeviceObjectArchive::ResourceData Ref;
+    Ref.Common = MakeDataReference(Data.Common);
+    for (size_t i = 0; i < Data.DeviceSpecific.size(); ++i)
+        Ref.DeviceSpecific[i] = MakeDataReference(Data.DeviceSpecific[i]);
+    return Ref;
+}
 
-    Shaders.resize(NumShaders);
-    for (auto& Shader : Shaders)
+// Compresses the shaders with LZ4 and returns the total size of the compressed data.
+// Shaders that can't be compressed are left as is, and their uncompressed size is set to zero.
+size_t CompressShaders(const std::vector<SerializedData>&                  Shaders,
+                       const std::vector<Uint8>&                           Dict,
+                       std::vector<SerializedData>&                        CompressedShaders,
+                       std::vector<DeviceObjectArchive::ShaderIndexEntry>& ShaderIndex)
+{
+    VERIFY_EXPR(Shaders.size() == ShaderIndex.size());
+
+    CompressedShaders.clear();
+    CompressedShaders.reserve(Shaders.size());
+
+    size_t             TotalSize = Dict.size();
+    std::vector<Uint8> Buffer;
+    for (size_t i = 0; i < Shaders.size(); ++i)
     {
-        if (!Ser.Serialize(Shader))
-            return false;
+        const SerializedData& Shader = Shaders[i];
+
+        Buffer.resize(LZ4GetMaxCompressedSize(Shader.Size()));
+        const size_t CompressedSize = Shader ?
+            LZ4CompressBlock(Shader.Ptr(), Shader.Size(), Buffer.data(), Buffer.size(), Dict.data(), Dict.size()) :
+            0;
+        if (CompressedSize == 0 || CompressedSize >= Shader.Size())
+        {
+            CompressedShaders.emplace_back(MakeDataReference(Shader));
+            ShaderIndex[i].UncompressedSize = 0;
+        }
+        else
+        {
+            SerializedData CompressedShader{CompressedSize, GetRawAllocator(MEMORY_CATEGORY_ARCHIVE)};
+            memcpy(CompressedShader.Ptr(), Buffer.data(), CompressedSize);
+            CompressedShaders.emplace_back(std::move(CompressedShader));
+            ShaderIndex[i].UncompressedSize = Shader.Size();
+        }
+        TotalSize += CompressedShaders.back().Size();
     }
 
-    return true;
+    return TotalSize;
 }
 
 } // namespace
@@ -155,6 +209,7 @@ void DeviceObjectArchive::Clear() noexcept
 {
     m_NamedResources.clear();
     m_DeviceShaders = {};
+    m_Index         = {};
     m_pArchiveData.Release();
     m_ContentVersion = 0;
 }
@@ -181,10 +236,13 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
         DataBlobImpl::MakeCopy(CI.pData) :
         const_cast<IDataBlob*>(CI.pData); // Need to remove const for AddRef/Release
 
+    const Uint8* pArchiveData = static_cast<const Uint8*>(m_pArchiveData->GetConstDataPtr());
+    const size_t ArchiveSize  = m_pArchiveData->GetSize();
+
     Serializer<SerializerMode::Read> Reader{
         SerializedData{
-            const_cast<void*>(CI.pData->GetConstDataPtr()),
-            CI.pData->GetSize(),
+            const_cast<Uint8*>(pArchiveData),
+            ArchiveSize,
         },
     };
     ArchiveSerializer<SerializerMode::Read> ArchiveReader{Reader};
@@ -210,33 +268,266 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
 
     CHECK_ARCHIVE(ArchiveReader.Ser(Header.GitHash), "Failed to read Git Hash.");
 
-    Uint32 NumResources = 0;
-    CHECK_ARCHIVE(Reader(NumResources), "Failed to read the number of named resources in the device object archive.");
+    m_Index.pArchiveData = pArchiveData;
+    m_Index.ArchiveSize  = ArchiveSize;
 
-    for (Uint32 res = 0; res < NumResources; ++res)
+    // Read the resource index
     {
-        const char*  Name    = nullptr;
-        ResourceType ResType = ResourceType::Undefined;
-        CHECK_ARCHIVE(Reader(ResType, Name), "Failed to read the type and name of resource ", res, "/", NumResources, '.');
-        VERIFY_EXPR(Name != nullptr);
-
-        // No need to make the name copy as we keep the source data blob alive.
-        constexpr bool MakeNameCopy = false;
-        ResourceData&  ResData      = m_NamedResources[NamedResourceKey{ResType, Name, MakeNameCopy}];
+        Uint32      NumResources = 0;
+        const void* pIndex       = nullptr;
+        size_t      IndexSize    = 0;
+        CHECK_ARCHIVE(Reader(NumResources), "Failed to read the number of named resources in the device object archive.");
+        CHECK_ARCHIVE(Reader.SerializeBytes(pIndex, IndexSize), "Failed to read the resource index.");
+        CHECK_ARCHIVE(IndexSize == size_t{NumResources} * sizeof(ResourceIndexEntry), "Invalid resource index size.");
+
+        m_Index.pResources   = static_cast<const Uint8*>(pIndex);
+        m_Index.NumResources = NumResources;
+    }
 
-        CHECK_ARCHIVE(ArchiveReader.SerializeResourceData(ResData), "Failed to read data of resource '", Name, "'.");
+    // Read shader indices
+    for (size_t dev = 0; dev < static_cast<size_t>(DeviceType::Count); ++dev)
+    {
+        Uint32      NumShaders = 0;
+        const void* pIndex     = nullptr;
+        size_t      IndexSize  = 0;
+        CHECK_ARCHIVE(Reader(NumShaders), "Failed to read the number of shaders in the device object archive.");
+        CHECK_ARCHIVE(Reader.SerializeBytes(pIndex, IndexSize), "Failed to read the shader index.");
+        CHECK_ARCHIVE(IndexSize == size_t{NumShaders} * sizeof(ShaderIndexEntry), "Invalid shader index size.");
+
+        ShaderCompression Compression = ShaderCompression::None;
+        const void*       pDict       = nullptr;
+        size_t            DictSize    = 0;
+        CHECK_ARCHIVE(Reader(Compression), "Failed to read the shader compression mode.");
+        CHECK_ARCHIVE(Compression < ShaderCompression::Count, "Invalid shader compression mode: ", static_cast<Uint32>(Compression), '.');
+        CHECK_ARCHIVE(Reader.SerializeBytes(pDict, DictSize), "Failed to read the shader compression dictionary.");
+        CHECK_ARCHIVE(Compression == ShaderCompression::LZ4 || DictSize == 0, "Shader compression dictionary is not expected when shaders are not compressed.");
+
+        m_Index.pShaders[dev]        = static_cast<const Uint8*>(pIndex);
+        m_Index.NumShaders[dev]      = NumShaders;
+        m_Index.pShaderDicts[dev]    = static_cast<const Uint8*>(pDict);
+        m_Index.ShaderDictSizes[dev] = Compression == ShaderCompression::LZ4 ? DictSize : 0;
+
+        for (size_t i = 0; i < NumShaders; ++i)
+        {
+            const ShaderIndexEntry Entry = GetShaderIndexEntry(static_cast<DeviceType>(dev), i);
+            CHECK_ARCHIVE(IsValidRange(Entry.DataOffset, Entry.DataSize, ArchiveSize), "Invalid data range of shader ", i, " for device type ", dev, '.');
+            // LZ4 can't compress the data more than 255 times
+            CHECK_ARCHIVE(Entry.UncompressedSize == 0 || (Compression == ShaderCompression::LZ4 && Entry.UncompressedSize / 256 <= Entry.DataSize),
+                          "Invalid uncompressed size of shader ", i, " for device type ", dev, '.');
+        }
     }
 
-    for (std::vector<SerializedData>& Shaders : m_DeviceShaders)
+    // Validate index entries so that resources and shaders can later be decoded without range checks.
+    // Resource and shader data are not accessed here.
+    for (size_t res = 0; res < m_Index.NumResources; ++res)
     {
-        CHECK_ARCHIVE(ArchiveReader.SerializeShaders(Shaders), "Failed to read shader data from the device object archive.");
+        const ResourceIndexEntry Entry = GetResourceIndexEntry(res);
+        CHECK_ARCHIVE(Entry.Type > ResourceType::Undefined && Entry.Type < ResourceType::Count, "Invalid type of resource ", res, "/", m_Index.NumResources, '.');
+        CHECK_ARCHIVE(IsValidRange(Entry.NameOffset, Uint64{Entry.NameLength} + 1, ArchiveSize) && pArchiveData[Entry.NameOffset + Entry.NameLength] == '\0',
+                      "Invalid name of resource ", res, "/", m_Index.NumResources, '.');
+        CHECK_ARCHIVE(IsValidRange(Entry.DataOffset, Entry.DataSize, ArchiveSize) && (Entry.DataOffset % ResourceDataAlignment) == 0,
+                      "Invalid data range of resource ", res, "/", m_Index.NumResources, '.');
+#ifdef DILIGENT_DEBUG
+        if (res > 0)
+        {
+            const ResourceIndexEntry PrevEntry = GetResourceIndexEntry(res - 1);
+            VERIFY(CompareResources(PrevEntry.Type, reinterpret_cast<const char*>(pArchiveData + PrevEntry.NameOffset),
+                                    Entry.Type, reinterpret_cast<const char*>(pArchiveData + Entry.NameOffset)) < 0,
+                   "Resource index entries are not sorted");
+        }
+#endif
     }
 #undef CHECK_ARCHIVE
 
     return true;
 }
 
-void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
+DeviceObjectArchive::ResourceIndexEntry DeviceObjectArchive::GetResourceIndexEntry(size_t Idx) const noexcept
+{
+    VERIFY_EXPR(Idx < m_Index.NumResources);
+    ResourceIndexEntry Entry;
+    memcpy(&Entry, m_Index.pResources + Idx * sizeof(ResourceIndexEntry), sizeof(ResourceIndexEntry));
+    return Entry;
+}
+
+DeviceObjectArchive::ShaderIndexEntry DeviceObjectArchive::GetShaderIndexEntry(DeviceType Type, size_t Idx) const noexcept
+{
+    VERIFY_EXPR(Idx < m_Index.NumShaders[static_cast<size_t>(Type)]);
+    ShaderIndexEntry Entry;
+    memcpy(&Entry, m_Index.pShaders[static_cast<size_t>(Type)] + Idx * sizeof(ShaderIndexEntry), sizeof(ShaderIndexEntry));
+    return Entry;
+}
+
+const char* DeviceObjectArchive::FindResource(ResourceType  Type,
+                                              const char*   Name,
+                                              ResourceData& Data) const noexcept
+{
+    VERIFY_EXPR(Name != nullptr);
+
+    // The archive either has the index or decoded resources, but never both
+    if (!m_NamedResources.empty())
+    {
+        auto it = m_NamedResources.find(NamedResourceKey{Type, Name});
+        if (it == m_NamedResources.end())
+            return nullptr;
+
+        Data = MakeDataReference(it->second);
+        return it->first.GetName();
+    }
+
+    // Binary search in the archive index
+    size_t First = 0;
+    size_t Last  = m_Index.NumResources;
+    while (First < Last)
+    {
+        const size_t             Mid   = First + (Last - First) / 2;
+        const ResourceIndexEntry Entry = GetResourceIndexEntry(Mid);
+
+        const char* EntryName = reinterpret_cast<const char*>(m_Index.pArchiveData + Entry.NameOffset);
+
+        const int Cmp = CompareResources(Entry.Type, EntryName, Type, Name);
+        if (Cmp < 0)
+        {
+            First = Mid + 1;
+        }
+        else if (Cmp > 0)
+        {
+            Last = Mid;
+        }
+        else
+        {
+            Serializer<SerializerMode::Read> Reader{
+                SerializedData{
+                    const_cast<Uint8*>(m_Index.pArchiveData + Entry.DataOffset),
+                    static_cast<size_t>(Entry.DataSize),
+                },
+            };
+            if (!ArchiveSerializer<SerializerMode::Read>{Reader}.SerializeResourceData(Data))
+            {
+                LOG_ERROR_MESSAGE("Failed to read data of resource '", EntryName, "'. Archive file may be corrupted or invalid.");
+                Data = {};
+                return nullptr;
+            }
+            return EntryName;
+        }
+    }
+
+    return nullptr;
+}
+
+bool DeviceObjectArchive::HasResource(ResourceType Type, const char* Name) const noexcept
+{
+    ResourceData Data;
+    return FindResource(Type, Name, Data) != nullptr;
+}
+
+void DeviceObjectArchive::ProcessResources(const std::function<void(ResourceType, const char*, const ResourceData&)>& Handler) const
+{
+    for (const auto& it : m_NamedResources)
+        Handler(it.first.GetType(), it.first.GetName(), it.second);
+
+    for (size_t res = 0; res < m_Index.NumResources; ++res)
+    {
+        const ResourceIndexEntry Entry = GetResourceIndexEntry(res);
+        const char*              Name  = reinterpret_cast<const char*>(m_Index.pArchiveData + Entry.NameOffset);
+
+        ResourceData                     Data;
+        Serializer<SerializerMode::Read> Reader{
+            SerializedData{
+                const_cast<Uint8*>(m_Index.pArchiveData + Entry.DataOffset),
+                static_cast<size_t>(Entry.DataSize),
+            },
+        };
+        if (!ArchiveSerializer<SerializerMode::Read>{Reader}.SerializeResourceData(Data))
+            LOG_ERROR_AND_THROW("Failed to read data of resource '", Name, "'. Archive file may be corrupted or invalid.");
+
+        Handler(Entry.Type, Name, Data);
+    }
+}
+
+size_t DeviceObjectArchive::GetNumShaders(DeviceType Type) const noexcept
+{
+    // The archive either has the index or decoded shaders, so one of the counts is always zero
+    return m_DeviceShaders[static_cast<size_t>(Type)].size() + m_Index.NumShaders[static_cast<size_t>(Type)];
+}
+
+SerializedData DeviceObjectArchive::GetSerializedShader(DeviceType Type, size_t Idx) const noexcept
+{
+    // The archive either has the index or decoded shaders, but never both
+    const auto& DeviceShaders = m_DeviceShaders[static_cast<size_t>(Type)];
+    if (Idx < DeviceShaders.size())
+        return MakeDataReference(DeviceShaders[Idx]);
+
+    if (Idx < m_Index.NumShaders[static_cast<size_t>(Type)])
+        return ReadIndexedShader(Type, Idx);
+
+    return {};
+}
+
+SerializedData DeviceObjectArchive::ReadIndexedShader(DeviceType Type, size_t Idx) const noexcept
+{
+    const ShaderIndexEntry Entry = GetShaderIndexEntry(Type, Idx);
+    if (Entry.DataSize == 0)
+        return {};
+
+    const Uint8* pData = m_Index.pArchiveData + Entry.DataOffset;
+    if (Entry.UncompressedSize == 0)
+        return SerializedData{const_cast<Uint8*>(pData), static_cast<size_t>(Entry.DataSize)};
+
+    SerializedData Shader{static_cast<size_t>(Entry.UncompressedSize), GetRawAllocator(MEMORY_CATEGORY_ARCHIVE)};
+    if (!LZ4DecompressBlock(pData, static_cast<size_t>(Entry.DataSize), Shader.Ptr(), Shader.Size(),
+                            m_Index.pShaderDicts[static_cast<size_t>(Type)], m_Index.ShaderDictSizes[static_cast<size_t>(Type)]))
+    {
+        LOG_ERROR_MESSAGE("Failed to decompress shader ", Idx, ". Archive file may be corrupted or invalid.");
+        return {};
+    }
+
+    return Shader;
+}
+
+void DeviceObjectArchive::DecodeIndex() noexcept(false)
+{
+    if (m_Index.pArchiveData == nullptr)
+        return;
+
+    VERIFY(m_NamedResources.empty(), "The archive must not have decoded resources when the index is present");
+    for (size_t res = 0; res < m_Index.NumResources; ++res)
+    {
+        const ResourceIndexEntry Entry = GetResourceIndexEntry(res);
+        const char*              Name  = reinterpret_cast<const char*>(m_Index.pArchiveData + Entry.NameOffset);
+
+        // No need to make the name copy as we keep the source data blob alive.
+        constexpr bool MakeNameCopy = false;
+        ResourceData&  ResData      = m_NamedResources[NamedResourceKey{Entry.Type, Name, MakeNameCopy}];
+
+        Serializer<SerializerMode::Read> Reader{
+            SerializedData{
+                const_cast<Uint8*>(m_Index.pArchiveData + Entry.DataOffset),
+                static_cast<size_t>(Entry.DataSize),
+            },
+        };
+        if (!ArchiveSerializer<SerializerMode::Read>{Reader}.SerializeResourceData(ResData))
+            LOG_ERROR_AND_THROW("Failed to read data of resource '", Name, "'. Archive file may be corrupted or invalid.");
+    }
+
+    for (size_t dev = 0; dev < m_DeviceShaders.size(); ++dev)
+    {
+        std::vector<SerializedData>& Shaders = m_DeviceShaders[dev];
+        VERIFY(Shaders.empty(), "The archive must not have decoded shaders when the index is present");
+        Shaders.reserve(m_Index.NumShaders[dev]);
+        for (size_t i = 0; i < m_Index.NumShaders[dev]; ++i)
+        {
+            SerializedData Shader = ReadIndexedShader(static_cast<DeviceType>(dev), i);
+            if (!Shader && GetShaderIndexEntry(static_cast<DeviceType>(dev), i).DataSize > 0)
+                LOG_ERROR_AND_THROW("Failed to read shader ", i, " for device type ", dev, ". Archive file may be corrupted or invalid.");
+            Shaders.emplace_back(std::move(Shader));
+        }
+    }
+
+    m_Index = {};
+}
+
+void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob, ShaderCompression Compression) const
 {
     if (ppDataBlob == nullptr)
     {
@@ -245,36 +536,153 @@ void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
     }
     DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
 
-    auto SerializeThis = [this](auto& Ser) {
+    struct ResourceInfo
+    {
+        ResourceType Type;
+        const char*  Name;
+        ResourceData Data;
+    };
+    std::vector<ResourceInfo> Resources;
+    ProcessResources([&Resources](ResourceType Type, const char* Name, const ResourceData& Data) {
+        Resources.push_back({Type, Name, MakeDataReference(Data)});
+    });
+    std::sort(Resources.begin(), Resources.end(),
+              [](const ResourceInfo& Res1, const ResourceInfo& Res2) {
+                  return CompareResources(Res1.Type, Res1.Name, Res2.Type, Res2.Name) < 0;
+              });
+
+    // Index entries are initialized in Measure mode and verified in Write mode.
+    std::vector<ResourceIndexEntry> ResourceIndex(Resources.size());
+
+    std::array<std::vector<ShaderIndexEntry>, static_cast<size_t>(DeviceType::Count)> ShaderIndex;
+    // Shader data to write. Decompressed shaders are owned, other shaders reference the archive data.
+    std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)>   Shaders;
+    std::array<ShaderCompression, static_cast<size_t>(DeviceType::Count)>             ShaderCompressions{};
+    std::array<std::vector<Uint8>, static_cast<size_t>(DeviceType::Count)>            ShaderDicts;
+    for (size_t dev = 0; dev < ShaderIndex.size(); ++dev)
+    {
+        const DeviceType DevType    = static_cast<DeviceType>(dev);
+        const size_t     NumShaders = GetNumShaders(DevType);
+        ShaderIndex[dev].resize(NumShaders);
+        Shaders[dev].reserve(NumShaders);
+        for (size_t i = 0; i < NumShaders; ++i)
+            Shaders[dev].emplace_back(GetSerializedShader(DevType, i));
+
+        if (Compression != ShaderCompression::LZ4 || NumShaders == 0)
+            continue;
+
+        // Train the dictionary over all shaders of this device type
+        std::vector<std::pair<const void*, size_t>> Samples;
+        Samples.reserve(NumShaders);
+        for (const SerializedData& Shader : Shaders[dev])
+        {
+            if (Shader)
+                Samples.emplace_back(Shader.Ptr(), Shader.Size());
+        }
+        std::vector<Uint8> Dict = LZ4TrainDictionary(Samples);
+
+        size_t RawSize = 0;
+        for (const SerializedData& Shader : Shaders[dev])
+            RawSize += Shader.Size();
+
+        // The dictionary is stored in the archive, so it only pays off when there are enough shaders.
+        // Compress without the dictionary as well and use whichever is smaller.
+        std::vector<SerializedData>   CompressedShaders;
+        std::vector<ShaderIndexEntry> CompressedIndex(NumShaders);
+        size_t                        CompressedSize = CompressShaders(Shaders[dev], Dict, CompressedShaders, CompressedIndex);
+        if (!Dict.empty())
+        {
+            std::vector<SerializedData>   CompressedShadersNoDict;
+            std::vector<ShaderIndexEntry> CompressedIndexNoDict(NumShaders);
+            const size_t                  CompressedSizeNoDict = CompressShaders(Shaders[dev], {}, CompressedShadersNoDict, CompressedIndexNoDict);
+            if (CompressedSizeNoDict <= CompressedSize)
+            {
+                Dict.clear();
+                CompressedShaders = std::move(CompressedShadersNoDict);
+                CompressedIndex   = std::move(CompressedIndexNoDict);
+                CompressedSize    = CompressedSizeNoDict;
+            }
+        }
+
+        if (CompressedSize < RawSize)
+        {
+            Shaders[dev]            = std::move(CompressedShaders);
+            ShaderIndex[dev]        = std::move(CompressedIndex);
+            ShaderCompressions[dev] = ShaderCompression::LZ4;
+            ShaderDicts[dev]        = std::move(Dict);
+        }
+    }
+
+    auto SerializeThis = [&](auto& Ser) {
         constexpr auto SerMode    = std::remove_reference<decltype(Ser)>::type::GetMode();
         const auto     ArchiveSer = ArchiveSerializer<SerMode>{Ser};
 
+        auto SetIndexValue = [](Uint64& IndexValue, size_t Value) {
+            if (SerMode == SerializerMode::Measure)
+                IndexValue = Value;
+            else
+                VERIFY(IndexValue == Value, "Index value does not match the value computed in Measure mode");
+        };
+
         ArchiveHeader Header;
         Header.ContentVersion = m_ContentVersion;
 
         auto res = ArchiveSer.SerializeHeader(Header);
         VERIFY(res, "Failed to serialize header");
 
-        Uint32 NumResources = StaticCast<Uint32>(m_NamedResources.size());
-        res                 = Ser(NumResources);
-        VERIFY(res, "Failed to serialize the number of resources");
+        Uint32 NumResources = StaticCast<Uint32>(ResourceIndex.size());
+        res                 = Ser(NumResources) && Ser.SerializeBytes(ResourceIndex.data(), ResourceIndex.size() * sizeof(ResourceIndexEntry));
+        VERIFY(res, "Failed to serialize the resource index");
+
+        for (size_t dev = 0; dev < ShaderIndex.size(); ++dev)
+        {
+            Uint32 NumShaders = StaticCast<Uint32>(ShaderIndex[dev].size());
+            res               = Ser(NumShaders) && Ser.SerializeBytes(ShaderIndex[dev].data(), ShaderIndex[dev].size() * sizeof(ShaderIndexEntry));
+            VERIFY(res, "Failed to serialize the shader index");
+
+            res = Ser(ShaderCompressions[dev]) && Ser.SerializeBytes(ShaderDicts[dev].data(), ShaderDicts[dev].size());
+            VERIFY(res, "Failed to serialize the shader compression dictionary");
+        }
+
+        for (size_t i = 0; i < Resources.size(); ++i)
+        {
+            const char* Name       = Resources[i].Name;
+            const auto  NameLength = strlen(Name);
+
+            ResourceIndex[i].Type       = Resources[i].Type;
+            ResourceIndex[i].NameLength = StaticCast<Uint32>(NameLength);
+            SetIndexValue(ResourceIndex[i].NameOffset, Ser.GetSize());
 
-        for (const auto& res_it : m_NamedResources)
+            res = Ser.CopyBytes(Name, NameLength + 1);
+            VERIFY(res, "Failed to serialize resource name");
+        }
+
+        for (size_t i = 0; i < Resources.size(); ++i)
         {
-            const char*        Name    = res_it.first.GetName();
-            const ResourceType ResType = res_it.first.GetType();
+            res = ArchiveSer.AlignOffset(ResourceDataAlignment);
+            VERIFY(res, "Failed to align resource data");
 
-            res = Ser(ResType, Name);
-            VERIFY(res, "Failed to serialize resource type and name");
+            const size_t DataOffset = Ser.GetSize();
+            SetIndexValue(ResourceIndex[i].DataOffset, DataOffset);
 
-            res = ArchiveSer.SerializeResourceData(res_it.second);
+            res = ArchiveSer.SerializeResourceData(Resources[i].Data);
             VERIFY(res, "Failed to serialize resource data");
+
+            SetIndexValue(ResourceIndex[i].DataSize, Ser.GetSize() - DataOffset);
         }
 
-        for (const std::vector<SerializedData>& Shaders : m_DeviceShaders)
+        for (size_t dev = 0; dev < ShaderIndex.size(); ++dev)
         {
-            res = ArchiveSer.SerializeShaders(Shaders);
-            VERIFY(res, "Failed to serialize shaders");
+            for (size_t i = 0; i < ShaderIndex[dev].size(); ++i)
+            {
+                const SerializedData& Shader = Shaders[dev][i];
+
+                res = Ser.Serialize(Shader);
+                VERIFY(res, "Failed to serialize shader");
+
+                SetIndexValue(ShaderIndex[dev][i].DataOffset, Ser.GetSize() - Shader.Size());
+                SetIndexValue(ShaderIndex[dev][i].DataSize, Shader.Size());
+            }
         }
     };
 
@@ -348,19 +756,20 @@ DeviceObjectArchive::DeviceObjectArchive(const CreateInfo& CI) noexcept(false)
     }
 }
 
-const SerializedData& DeviceObjectArchive::GetDeviceSpecificData(ResourceType Type,
-                                                                 const char*  Name,
-                                                                 DeviceType   DevType) const noexcept
+SerializedData DeviceObjectArchive::GetDeviceSpecificData(ResourceType Type,
+                                                          const char*  Name,
+                                                          DeviceType   DevType) const noexcept
 {
-    auto it = m_NamedResources.find(NamedResourceKey{Type, Name});
-    if (it == m_NamedResources.end())
+    ResourceData Data;
+
+    const char* ArchivedName = FindResource(Type, Name, Data);
+    if (ArchivedName == nullptr)
     {
         LOG_ERROR_MESSAGE("Resource '", Name, "' is not present in the archive");
-        static const SerializedData NullData;
-        return NullData;
+        return {};
     }
-    VERIFY_EXPR(SafeStrEqual(Name, it->first.GetName()));
-    return it->second.DeviceSpecific[static_cast<size_t>(DevType)];
+    VERIFY_EXPR(SafeStrEqual(Name, ArchivedName));
+    return std::move(Data.DeviceSpecific[static_cast<size_t>(DevType)]);
 }
 
 std::string DeviceObjectArchive::ToString() const
@@ -400,27 +809,26 @@ std::string DeviceObjectArchive::ToString() const
     //       Direct3D12  504 bytes
     //       Vulkan      881 bytes
     {
-        std::array<std::vector<std::reference_wrapper<const decltype(m_NamedResources)::value_type>>, static_cast<size_t>(ResourceType::Count)> ResourcesByType;
-        for (const auto& it : m_NamedResources)
-        {
-            ResourcesByType[static_cast<size_t>(it.first.GetType())].emplace_back(it);
-        }
+        std::array<std::vector<std::pair<const char*, ResourceData>>, static_cast<size_t>(ResourceType::Count)> ResourcesByType;
+        ProcessResources([&ResourcesByType](ResourceType Type, const char* Name, const ResourceData& Data) {
+            ResourcesByType[static_cast<size_t>(Type)].emplace_back(Name, MakeDataReference(Data));
+        });
 
-        for (const auto& Resources : ResourcesByType)
+        for (size_t res_type = 0; res_type < ResourcesByType.size(); ++res_type)
         {
+            const auto& Resources = ResourcesByType[res_type];
             if (Resources.empty())
                 continue;
 
-            const ResourceType ResType = Resources.front().get().first.GetType();
+            const ResourceType ResType = static_cast<ResourceType>(res_type);
             Output << SeparatorLine
                    << ResourceTypeToString(ResType) << " (" << Resources.size() << ")\n";
             // ------------------
             // Resource Signatures (1)
 
-            for (const auto& res_ref : Resources)
+            for (const auto& it : Resources)
             {
-                const auto& it = res_ref.get();
-                Output << Ident1 << it.first.GetName() << '\n';
+                Output << Ident1 << it.first << '\n';
                 // ..Test PRS
 
                 const ResourceData& Res = it.second;
@@ -467,9 +875,9 @@ std::string DeviceObjectArchive::ToString() const
     //       [1] 'Test PS' 7380 bytes
     {
         bool HasShaders = false;
-        for (const std::vector<SerializedData>& Shaders : m_DeviceShaders)
+        for (Uint32 dev = 0; dev < static_cast<Uint32>(DeviceType::Count); ++dev)
         {
-            if (!Shaders.empty())
+            if (GetNumShaders(static_cast<DeviceType>(dev)) > 0)
                 HasShaders = true;
         }
 
@@ -480,11 +888,14 @@ std::string DeviceObjectArchive::ToString() const
             // ------------------
             // Compiled Shaders
 
-            for (Uint32 dev = 0; dev < m_DeviceShaders.size(); ++dev)
+            for (Uint32 dev = 0; dev < static_cast<Uint32>(DeviceType::Count); ++dev)
             {
-                const std::vector<SerializedData>& Shaders = m_DeviceShaders[dev];
+                std::vector<SerializedData> Shaders(GetNumShaders(static_cast<DeviceType>(dev)));
                 if (Shaders.empty())
                     continue;
+                for (size_t i = 0; i < Shaders.size(); ++i)
+                    Shaders[i] = GetSerializedShader(static_cast<DeviceType>(dev), i);
+
                 Output << Ident1 << ArchiveDeviceTypeToString(dev) << '(' << Shaders.size() << ")\n";
                 // ..OpenGL(2)
 
@@ -525,6 +936,8 @@ std::string DeviceObjectArchive::ToString() const
 
 void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 {
+    DecodeIndex();
+
     for (auto& res_it : m_NamedResources)
         res_it.second.DeviceSpecific[static_cast<size_t>(Dev)] = {};
 
@@ -533,28 +946,31 @@ void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 
 void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false)
 {
-    IMemoryAllocator& Allocator = GetRawAllocator();
+    DecodeIndex();
+
+    IMemoryAllocator& Allocator = GetRawAllocator(MEMORY_CATEGORY_ARCHIVE);
     for (auto& dst_res_it : m_NamedResources)
     {
         SerializedData& DstData = dst_res_it.second.DeviceSpecific[static_cast<size_t>(Dev)];
         // Clear dst device data to make sure we don't have invalid shader indices
         DstData = {};
 
-        auto src_res_it = Src.m_NamedResources.find(dst_res_it.first);
-        if (src_res_it == Src.m_NamedResources.end())
+        ResourceData SrcResData;
+        if (Src.FindResource(dst_res_it.first.GetType(), dst_res_it.first.GetName(), SrcResData) == nullptr)
             continue;
 
-        const SerializedData& SrcData{src_res_it->second.DeviceSpecific[static_cast<size_t>(Dev)]};
+        const SerializedData& SrcData{SrcResData.DeviceSpecific[static_cast<size_t>(Dev)]};
         // Always copy src data even if it is empty
         DstData = SrcData.MakeCopy(Allocator);
     }
 
     // Copy all shaders to make sure PSO shader indices are correct
-    const auto& SrcShaders = Src.m_DeviceShaders[static_cast<size_t>(Dev)];
-    auto&       DstShaders = m_DeviceShaders[static_cast<size_t>(Dev)];
+    const size_t NumSrcShaders = Src.GetNumShaders(Dev);
+    auto&        DstShaders    = m_DeviceShaders[static_cast<size_t>(Dev)];
     DstShaders.clear();
-    for (const SerializedData& SrcShader : SrcShaders)
-        DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+    DstShaders.reserve(NumSrcShaders);
+    for (size_t i = 0; i < NumSrcShaders; ++i)
+        DstShaders.emplace_back(Src.GetSerializedShader(Dev, i).MakeCopy(Allocator));
 }
 
 void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
@@ -564,37 +980,36 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
 
     static_assert(static_cast<size_t>(ResourceType::Count) == 8, "Did you add a new resource type? You may need to handle it here.");
 
-    IMemoryAllocator&      Allocator = GetRawAllocator();
+    DecodeIndex();
+
+    IMemoryAllocator&      Allocator = GetRawAllocator(MEMORY_CATEGORY_ARCHIVE);
     DynamicLinearAllocator DynAllocator{Allocator, 512};
 
     // Copy shaders
     std::array<Uint32, static_cast<size_t>(DeviceType::Count)> ShaderBaseIndices{};
     for (size_t i = 0; i < m_DeviceShaders.size(); ++i)
     {
-        const auto& SrcShaders = Src.m_DeviceShaders[i];
-        auto&       DstShaders = m_DeviceShaders[i];
-        ShaderBaseIndices[i]   = static_cast<Uint32>(DstShaders.size());
-        if (SrcShaders.empty())
+        const DeviceType DevType       = static_cast<DeviceType>(i);
+        const size_t     NumSrcShaders = Src.GetNumShaders(DevType);
+        auto&            DstShaders    = m_DeviceShaders[i];
+        ShaderBaseIndices[i]           = static_cast<Uint32>(DstShaders.size());
+        if (NumSrcShaders == 0)
             continue;
-        DstShaders.reserve(DstShaders.size() + SrcShaders.size());
-        for (const SerializedData& SrcShader : SrcShaders)
-            DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+        DstShaders.reserve(DstShaders.size() + NumSrcShaders);
+        for (size_t j = 0; j < NumSrcShaders; ++j)
+            DstShaders.emplace_back(Src.GetSerializedShader(DevType, j).MakeCopy(Allocator));
     }
 
     // Copy named resources
-    for (auto& src_res_it : Src.m_NamedResources)
-    {
-        const ResourceType ResType = src_res_it.first.GetType();
-        const char*        ResName = src_res_it.first.GetName();
-
-        auto it_inserted = m_NamedResources.emplace(NamedResourceKey{ResType, ResName, /*CopyName = */ true}, src_res_it.second.MakeCopy(Allocator));
+    Src.ProcessResources([&](ResourceType ResType, const char* ResName, const ResourceData& SrcResData) {
+        auto it_inserted = m_NamedResources.emplace(NamedResourceKey{ResType, ResName, /*CopyName = */ true}, SrcResData.MakeCopy(Allocator));
         if (!it_inserted.second)
         {
             // Silently skip duplicate resources
-            if (it_inserted.first->second != src_res_it.second)
+            if (it_inserted.first->second != SrcResData)
                 LOG_WARNING_MESSAGE("Failed to copy resource '", ResName, "': resource with the same name already exists.");
 
-            continue;
+            return;
         }
 
         const auto IsStandaloneShader = (ResType == ResourceType::StandaloneShader);
@@ -661,14 +1076,14 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
                 }
             }
         }
-    }
+    });
 }
 
-void DeviceObjectArchive::Serialize(IFileStream* pStream) const
+void DeviceObjectArchive::Serialize(IFileStream* pStream, ShaderCompression Compression) const
 {
     DEV_CHECK_ERR(pStream != nullptr, "File stream must not be null");
     RefCntAutoPtr<IDataBlob> pDataBlob;
-    Serialize(&pDataBlob);
+    Serialize(&pDataBlob, Compression);
     VERIFY_EXPR(pDataBlob);
     pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
 }
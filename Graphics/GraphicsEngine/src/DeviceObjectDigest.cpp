@@ -0,0 +1,321 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "DeviceObjectDigest.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+#include "xxhash.h"
+
+#include "HashUtils.hpp"
+#include "DebugUtilities.hpp"
+#include "DeviceObject.h"
+
+namespace Diligent
+{
+
+namespace
+{
+
+class DigestHasher
+{
+public:
+    DigestHasher() :
+        m_State{XXH3_createState()}
+    {
+        VERIFY_EXPR(m_State != nullptr);
+        XXH3_128bits_reset(m_State);
+    }
+
+    ~DigestHasher()
+    {
+        XXH3_freeState(m_State);
+    }
+
+    // clang-format off
+    DigestHasher           (const DigestHasher&) = delete;
+    DigestHasher& operator=(const DigestHasher&) = delete;
+    // clang-format on
+
+    void UpdateRaw(const void* pData, size_t Size) noexcept
+    {
+        if (Size != 0)
+            XXH3_128bits_update(m_State, pData, Size);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_fundamental<T>::value || std::is_enum<T>::value>::type Update(const T& Val) noexcept
+    {
+        UpdateRaw(&Val, sizeof(Val));
+    }
+
+    void Update(const Char* Str) noexcept
+    {
+        // Distinguish null and empty strings
+        const Uint64 Len = Str != nullptr ? strlen(Str) + 1 : 0;
+        Update(Len);
+        UpdateRaw(Str, static_cast<size_t>(Len));
+    }
+
+    void Update(const IDeviceObject* pObject) noexcept
+    {
+        // Objects are identified by their unique IDs, which are never reused by the device
+        Update(pObject != nullptr ? pObject->GetUniqueID() : Int32{-1});
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value>::type Update(const T& Val) noexcept
+    {
+        HashCombiner<DigestHasher, T> Combiner{*this};
+        Combiner(Val);
+    }
+
+    template <typename FirstArgType, typename SecondArgType, typename... RestArgsType>
+    void Update(const FirstArgType& FirstArg, const SecondArgType& SecondArg, const RestArgsType&... RestArgs) noexcept
+    {
+        Update(FirstArg);
+        Update(SecondArg, RestArgs...);
+    }
+
+    template <typename... ArgsType>
+    void operator()(const ArgsType&... Args) noexcept
+    {
+        Update(Args...);
+    }
+
+    DeviceObjectDigest Digest() noexcept
+    {
+        const XXH128_hash_t Hash = XXH3_128bits_digest(m_State);
+        return {Hash.low64, Hash.high64};
+    }
+
+private:
+    XXH3_state_t* m_State = nullptr;
+};
+
+void HashPipelineStateCreateInfo(DigestHasher& Hasher, const PipelineStateCreateInfo& CI)
+{
+    // Ignore PSODesc.Name and pPSOCache
+    Hasher(CI.PSODesc, CI.Flags, CI.ResourceSignaturesCount);
+    for (Uint32 i = 0; i < CI.ResourceSignaturesCount; ++i)
+        Hasher.Update(CI.ppResourceSignatures[i]);
+    Hasher(CI.NumSpecializationConstants);
+    for (Uint32 i = 0; i < CI.NumSpecializationConstants; ++i)
+        Hasher(CI.pSpecializationConstants[i]);
+}
+
+} // namespace
+
+bool ComputeDeviceObjectDigest(const ShaderCreateInfo& ShaderCI, DeviceObjectDigest& Digest) noexcept
+{
+    // The contents of files and includes loaded through the stream factory are unknown
+    if (ShaderCI.FilePath != nullptr || ShaderCI.pShaderSourceStreamFactory != nullptr)
+        return false;
+
+    ASSERT_SIZEOF64(ShaderCI, 152, "Did you add new members to ShaderCreateInfo? Please handle them here.");
+
+    DigestHasher Hasher;
+    Hasher(ShaderCI.Desc,
+           ShaderCI.EntryPoint,
+           ShaderCI.SourceLanguage,
+           ShaderCI.ShaderCompiler,
+           ShaderCI.HLSLVersion,
+           ShaderCI.GLSLVersion,
+           ShaderCI.GLESSLVersion,
+           ShaderCI.MSLVersion,
+           ShaderCI.CompileFlags,
+           ShaderCI.LoadConstantBufferReflection,
+           ShaderCI.GLSLExtensions,
+           ShaderCI.WebGPUEmulatedArrayIndexSuffix);
+
+    if (ShaderCI.Source != nullptr)
+    {
+        const size_t SourceLength = ShaderCI.SourceLength != 0 ? ShaderCI.SourceLength : strlen(ShaderCI.Source);
+        Hasher(Uint32{0}, Uint64{SourceLength});
+        Hasher.UpdateRaw(ShaderCI.Source, SourceLength);
+    }
+    else if (ShaderCI.ByteCode != nullptr)
+    {
+        Hasher(Uint32{1}, Uint64{ShaderCI.ByteCodeSize});
+        Hasher.UpdateRaw(ShaderCI.ByteCode, ShaderCI.ByteCodeSize);
+    }
+    else
+    {
+        return false;
+    }
+
+    Hasher(ShaderCI.Macros.Count);
+    for (Uint32 i = 0; i < ShaderCI.Macros.Count; ++i)
+        Hasher(ShaderCI.Macros[i].Name, ShaderCI.Macros[i].Definition);
+
+    Digest = Hasher.Digest();
+    return true;
+}
+
+bool ComputeDeviceObjectDigest(const GraphicsPipelineStateCreateInfo& PSOCreateInfo, DeviceObjectDigest& Digest) noexcept
+{
+    DigestHasher Hasher;
+    HashPipelineStateCreateInfo(Hasher, PSOCreateInfo);
+    // GraphicsPipelineDesc is hashed with the render pass description, so also hash the render pass identity
+    Hasher(PSOCreateInfo.GraphicsPipeline, PSOCreateInfo.GraphicsPipeline.pRenderPass);
+    Hasher(PSOCreateInfo.pVS, PSOCreateInfo.pPS, PSOCreateInfo.pDS, PSOCreateInfo.pHS, PSOCreateInfo.pGS, PSOCreateInfo.pAS, PSOCreateInfo.pMS);
+    Digest = Hasher.Digest();
+    return true;
+}
+
+bool ComputeDeviceObjectDigest(const ComputePipelineStateCreateInfo& PSOCreateInfo, DeviceObjectDigest& Digest) noexcept
+{
+    DigestHasher Hasher;
+    HashPipelineStateCreateInfo(Hasher, PSOCreateInfo);
+    Hasher(PSOCreateInfo.pCS);
+    Digest = Hasher.Digest();
+    return true;
+}
+
+bool ComputeDeviceObjectDigest(const RayTracingPipelineStateCreateInfo& PSOCreateInfo, DeviceObjectDigest& Digest) noexcept
+{
+    DigestHasher Hasher;
+    HashPipelineStateCreateInfo(Hasher, PSOCreateInfo);
+    Hasher(PSOCreateInfo.RayTracingPipeline,
+           PSOCreateInfo.GeneralShaderCount,
+           PSOCreateInfo.TriangleHitShaderCount,
+           PSOCreateInfo.ProceduralHitShaderCount,
+           PSOCreateInfo.pShaderRecordName,
+           PSOCreateInfo.MaxAttributeSize,
+           PSOCreateInfo.MaxPayloadSize);
+
+    for (Uint32 i = 0; i < PSOCreateInfo.GeneralShaderCount; ++i)
+    {
+        const RayTracingGeneralShaderGroup& Group = PSOCreateInfo.pGeneralShaders[i];
+        Hasher(Group.Name, Group.pShader);
+    }
+    for (Uint32 i = 0; i < PSOCreateInfo.TriangleHitShaderCount; ++i)
+    {
+        const RayTracingTriangleHitShaderGroup& Group = PSOCreateInfo.pTriangleHitShaders[i];
+        Hasher(Group.Name, Group.pClosestHitShader, Group.pAnyHitShader);
+    }
+    for (Uint32 i = 0; i < PSOCreateInfo.ProceduralHitShaderCount; ++i)
+    {
+        const RayTracingProceduralHitShaderGroup& Group = PSOCreateInfo.pProceduralHitShaders[i];
+        Hasher(Group.Name, Group.pIntersectionShader, Group.pClosestHitShader, Group.pAnyHitShader);
+    }
+
+    Digest = Hasher.Digest();
+    return true;
+}
+
+bool ComputeDeviceObjectDigest(const TilePipelineStateCreateInfo& PSOCreateInfo, DeviceObjectDigest& Digest) noexcept
+{
+    DigestHasher Hasher;
+    HashPipelineStateCreateInfo(Hasher, PSOCreateInfo);
+    Hasher(PSOCreateInfo.TilePipeline, PSOCreateInfo.pTS);
+    Digest = Hasher.Digest();
+    return true;
+}
+
+bool ComputeDeviceObjectDigest(const GraphicsPipelineStateCreateInfo& PSOCreateInfo, GRAPHICS_PIPELINE_SUBSET Subset, DeviceObjectDigest& Digest) noexcept
+{
+    const GraphicsPipelineDesc& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    DigestHasher Hasher;
+    // Dynamic states must be declared by every library
+    Hasher(Subset, PSOCreateInfo.PSODesc.PipelineType, PSOCreateInfo.Flags & PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE);
+
+    // Shader byte code is remapped to the pipeline layout, so the shader subsets also
+    // depend on the resource signatures.
+    const auto HashShaderLayout = [&]() {
+        Hasher(PSOCreateInfo.ResourceSignaturesCount);
+        for (Uint32 i = 0; i < PSOCreateInfo.ResourceSignaturesCount; ++i)
+            Hasher.Update(PSOCreateInfo.ppResourceSignatures[i]);
+        if (PSOCreateInfo.ResourceSignaturesCount == 0)
+        {
+            // The implicit signature is defined by the resource layout and the resources of all shaders
+            Hasher(PSOCreateInfo.PSODesc.ResourceLayout, PSOCreateInfo.PSODesc.SRBAllocationGranularity);
+            Hasher(PSOCreateInfo.pVS, PSOCreateInfo.pPS, PSOCreateInfo.pDS, PSOCreateInfo.pHS, PSOCreateInfo.pGS, PSOCreateInfo.pAS, PSOCreateInfo.pMS);
+        }
+        Hasher(PSOCreateInfo.NumSpecializationConstants);
+        for (Uint32 i = 0; i < PSOCreateInfo.NumSpecializationConstants; ++i)
+            Hasher(PSOCreateInfo.pSpecializationConstants[i]);
+    };
+
+    // All subsets but the vertex input must be compatible with the render pass
+    const auto HashRenderPass = [&]() {
+        Hasher(GraphicsPipeline.pRenderPass,
+               GraphicsPipeline.SubpassIndex,
+               GraphicsPipeline.NumRenderTargets,
+               GraphicsPipeline.DSVFormat,
+               GraphicsPipeline.ReadOnlyDSV,
+               GraphicsPipeline.SmplDesc,
+               GraphicsPipeline.ShadingRateFlags);
+        for (Uint32 rt = 0; rt < GraphicsPipeline.NumRenderTargets; ++rt)
+            Hasher(GraphicsPipeline.RTVFormats[rt]);
+    };
+
+    switch (Subset)
+    {
+        case GRAPHICS_PIPELINE_SUBSET_VERTEX_INPUT:
+            Hasher(GraphicsPipeline.InputLayout, GraphicsPipeline.PrimitiveTopology);
+            break;
+
+        case GRAPHICS_PIPELINE_SUBSET_PRE_RASTERIZATION:
+            HashShaderLayout();
+            HashRenderPass();
+            Hasher(PSOCreateInfo.pVS, PSOCreateInfo.pHS, PSOCreateInfo.pDS, PSOCreateInfo.pGS, PSOCreateInfo.pAS, PSOCreateInfo.pMS);
+            Hasher(GraphicsPipeline.RasterizerDesc, GraphicsPipeline.NumViewports, GraphicsPipeline.PrimitiveTopology);
+            break;
+
+        case GRAPHICS_PIPELINE_SUBSET_FRAGMENT_SHADER:
+            HashShaderLayout();
+            HashRenderPass();
+            Hasher(PSOCreateInfo.pPS);
+            Hasher(GraphicsPipeline.DepthStencilDesc, GraphicsPipeline.SampleMask);
+            break;
+
+        case GRAPHICS_PIPELINE_SUBSET_FRAGMENT_OUTPUT:
+            HashRenderPass();
+            Hasher(GraphicsPipeline.BlendDesc, GraphicsPipeline.SampleMask);
+            break;
+
+        default:
+            UNEXPECTED("Unexpected graphics pipeline subset");
+            return false;
+    }
+
+    Digest = Hasher.Digest();
+    return true;
+}
+
+bool ComputeDeviceObjectDigest(const PipelineResourceSignatureDesc& Desc, DeviceObjectDigest& Digest) noexcept
+{
+    DigestHasher Hasher;
+    Hasher(Desc);
+    Digest = Hasher.Digest();
+    return true;
+}
+
+} // namespace Diligent
@@ -0,0 +1,202 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "FenceCompletionScheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+FenceCompletionScheduler::FenceCompletionScheduler(bool UseWorkerThread) noexcept :
+    m_UseWorkerThread{UseWorkerThread}
+{
+}
+
+FenceCompletionScheduler::~FenceCompletionScheduler()
+{
+    StopWorkerThread();
+}
+
+void FenceCompletionScheduler::Enqueue(IFence* pFence, Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData)
+{
+    VERIFY_EXPR(pFence != nullptr && Callback != nullptr);
+
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        DEV_CHECK_ERR(!m_Stop, "The scheduler is being destroyed");
+
+        PendingCallback Pending;
+        Pending.pFence    = pFence;
+        Pending.Value     = Value;
+        Pending.Callback  = Callback;
+        Pending.pUserData = pUserData;
+        m_Pending.emplace_back(std::move(Pending));
+
+        // The thread is started on first use as it calls virtual methods that are
+        // not available while the scheduler is being constructed.
+        if (m_UseWorkerThread && !m_WorkerThread.joinable() && !m_Stop)
+            m_WorkerThread = std::thread{&FenceCompletionScheduler::WorkerThreadProc, this};
+    }
+
+    if (m_UseWorkerThread)
+    {
+        // The new fence may not be in the set the worker thread is currently waiting for
+        m_CondVar.notify_one();
+        WakeUp();
+    }
+}
+
+void FenceCompletionScheduler::ProcessCompleted()
+{
+    VERIFY(!m_UseWorkerThread, "Callbacks are executed by the worker thread");
+
+    std::vector<PendingCallback> Completed;
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        if (m_Pending.empty())
+            return;
+        ExtractCompleted(Completed, nullptr);
+    }
+    RunCallbacks(Completed);
+}
+
+void FenceCompletionScheduler::WaitForAny(const std::vector<FenceWaitInfo>& /*Fences*/)
+{
+    static constexpr std::chrono::milliseconds PollingInterval{1};
+
+    std::unique_lock<std::mutex> Lock{m_Mtx};
+    m_CondVar.wait_for(Lock, PollingInterval, [this]() { return m_WakeUpRequested || m_Stop; });
+    m_WakeUpRequested = false;
+}
+
+void FenceCompletionScheduler::WakeUp()
+{
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        m_WakeUpRequested = true;
+    }
+    m_CondVar.notify_one();
+}
+
+void FenceCompletionScheduler::StopWorkerThread()
+{
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        if (!m_WorkerThread.joinable())
+            return;
+        m_Stop = true;
+    }
+
+    m_CondVar.notify_one();
+    WakeUp();
+    m_WorkerThread.join();
+}
+
+void FenceCompletionScheduler::WorkerThreadProc()
+{
+    std::vector<PendingCallback> Completed;
+    std::vector<FenceWaitInfo>   WaitList;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> Lock{m_Mtx};
+            m_CondVar.wait(Lock, [this]() { return m_Stop || !m_Pending.empty(); });
+            if (m_Stop)
+                break;
+
+            ExtractCompleted(Completed, &WaitList);
+        }
+
+        RunCallbacks(Completed);
+
+        // Fences in the wait list are kept alive by the pending callbacks that
+        // only this thread removes.
+        if (!WaitList.empty())
+            WaitForAny(WaitList);
+    }
+}
+
+void FenceCompletionScheduler::ExtractCompleted(std::vector<PendingCallback>& Completed, std::vector<FenceWaitInfo>* pWaitList)
+{
+    // Query the completed value of every fence only once
+    m_CompletedValues.clear();
+    for (const PendingCallback& Pending : m_Pending)
+    {
+        const auto it = std::find_if(m_CompletedValues.begin(), m_CompletedValues.end(),
+                                     [&Pending](const FenceWaitInfo& Info) { return Info.pFence == Pending.pFence; });
+        if (it == m_CompletedValues.end())
+            m_CompletedValues.push_back({Pending.pFence, Pending.pFence->GetCompletedValue()});
+    }
+
+    if (pWaitList != nullptr)
+        pWaitList->clear();
+
+    // Keep the remaining callbacks in the order they were enqueued
+    size_t NumPending = 0;
+    for (size_t i = 0; i < m_Pending.size(); ++i)
+    {
+        PendingCallback& Pending = m_Pending[i];
+
+        const auto CompletedIt = std::find_if(m_CompletedValues.begin(), m_CompletedValues.end(),
+                                              [&Pending](const FenceWaitInfo& Info) { return Info.pFence == Pending.pFence; });
+        VERIFY_EXPR(CompletedIt != m_CompletedValues.end());
+        if (CompletedIt->Value >= Pending.Value)
+        {
+            Completed.emplace_back(std::move(Pending));
+            continue;
+        }
+
+        if (pWaitList != nullptr)
+        {
+            const auto WaitIt = std::find_if(pWaitList->begin(), pWaitList->end(),
+                                             [&Pending](const FenceWaitInfo& Info) { return Info.pFence == Pending.pFence; });
+            if (WaitIt != pWaitList->end())
+                WaitIt->Value = std::min(WaitIt->Value, Pending.Value);
+            else
+                pWaitList->push_back({Pending.pFence, Pending.Value});
+        }
+
+        if (NumPending != i)
+            m_Pending[NumPending] = std::move(Pending);
+        ++NumPending;
+    }
+    m_Pending.resize(NumPending);
+}
+
+void FenceCompletionScheduler::RunCallbacks(std::vector<PendingCallback>& Completed)
+{
+    for (PendingCallback& Pending : Completed)
+        Pending.Callback(Pending.pFence, Pending.Value, Pending.pUserData);
+    // Release the fences
+    Completed.clear();
+}
+
+} // namespace Diligent
@@ -27,6 +27,7 @@
 
 #include "FramebufferBase.hpp"
 #include "GraphicsAccessories.hpp"
+#include "PlatformMisc.hpp"
 
 namespace Diligent
 {
@@ -71,6 +72,10 @@ void ValidateFramebufferDesc(const FramebufferDesc& Desc, IRenderDevice* pDevice
 
     const bool IsMetal = pDevice->GetDeviceInfo().IsMetalDevice();
 
+    Uint32 CombinedViewMask = 0;
+    for (Uint32 subpass = 0; subpass < RPDesc.SubpassCount; ++subpass)
+        CombinedViewMask |= RPDesc.pSubpasses[subpass].ViewMask;
+
     for (Uint32 i = 0; i < RPDesc.AttachmentCount; ++i)
     {
         if (Desc.ppAttachments[i] == nullptr)
@@ -110,6 +115,15 @@ void ValidateFramebufferDesc(const FramebufferDesc& Desc, IRenderDevice* pDevice
                                             ") defined by the render pass for the same attachment.");
         }
 
+        // If the render pass uses multiview, each attachment must have a layer count
+        // greater than the index of the most significant bit set in any of the view masks.
+        // https://registry.khronos.org/vulkan/specs/1.3-extensions/html/vkspec.html#VUID-VkFramebufferCreateInfo-renderPass-04536
+        if (CombinedViewMask != 0 && ViewDesc.ViewType != TEXTURE_VIEW_SHADING_RATE && ViewDesc.NumArraySlices <= PlatformMisc::GetMSB(CombinedViewMask))
+        {
+            LOG_FRAMEBUFFER_ERROR_AND_THROW("attachment ", i, " has ", ViewDesc.NumArraySlices, " array slice(s), but the render pass view masks use ",
+                                            PlatformMisc::GetMSB(CombinedViewMask) + 1, " views.");
+        }
+
         if ((TexDesc.MiscFlags & MISC_TEXTURE_FLAG_MEMORYLESS) != 0)
         {
             const bool HasStencilComponent = GetTextureFormatAttribs(AttDesc.Format).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL;
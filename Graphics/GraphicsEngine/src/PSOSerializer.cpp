@@ -135,8 +135,23 @@ bool PSOSerializer<Mode>::SerializeCreateInfo(
             return false;
     }
 
+    if (!Ser.SerializeArray(Allocator, CreateInfo.pSpecializationConstants, CreateInfo.NumSpecializationConstants,
+                            [](Serializer<Mode>&                 Ser,
+                               ConstQual<SpecializationConstant>& Const) //
+                            {
+                                if (!Ser(Const.Name,
+                                         Const.ShaderStages,
+                                         Const.Size))
+                                    return false;
+
+                                size_t DataSize = Const.Size;
+                                return Ser.SerializeBytes(Const.pData, DataSize) && DataSize == Const.Size;
+                            }))
+        return false;
+
     ASSERT_SIZEOF64(ShaderResourceVariableDesc, 16, "Did you add a new member to ShaderResourceVariableDesc? Please add serialization here.");
-    ASSERT_SIZEOF64(PipelineStateCreateInfo, 96, "Did you add a new member to PipelineStateCreateInfo? Please add serialization here.");
+    ASSERT_SIZEOF64(SpecializationConstant, 24, "Did you add a new member to SpecializationConstant? Please add serialization here.");
+    ASSERT_SIZEOF64(PipelineStateCreateInfo, 112, "Did you add a new member to PipelineStateCreateInfo? Please add serialization here.");
 
     return true;
 }
@@ -193,7 +208,7 @@ bool PSOSerializer<Mode>::SerializeCreateInfo(
 
     // Skip NodeMask
 
-    ASSERT_SIZEOF64(GraphicsPipelineStateCreateInfo, 344, "Did you add a new member to GraphicsPipelineStateCreateInfo? Please add serialization here.");
+    ASSERT_SIZEOF64(GraphicsPipelineStateCreateInfo, 360, "Did you add a new member to GraphicsPipelineStateCreateInfo? Please add serialization here.");
     ASSERT_SIZEOF64(LayoutElement, 40, "Did you add a new member to LayoutElement? Please add serialization here.");
 }
 
@@ -206,7 +221,7 @@ bool PSOSerializer<Mode>::SerializeCreateInfo(
 {
     return SerializeCreateInfo(Ser, static_cast<ConstQual<PipelineStateCreateInfo>&>(CreateInfo), PRSNames, Allocator);
 
-    ASSERT_SIZEOF64(ComputePipelineStateCreateInfo, 104, "Did you add a new member to ComputePipelineStateCreateInfo? Please add serialization here.");
+    ASSERT_SIZEOF64(ComputePipelineStateCreateInfo, 120, "Did you add a new member to ComputePipelineStateCreateInfo? Please add serialization here.");
 }
 
 template <SerializerMode Mode>
@@ -224,7 +239,7 @@ bool PSOSerializer<Mode>::SerializeCreateInfo(
                CreateInfo.TilePipeline.SampleCount,
                CreateInfo.TilePipeline.RTVFormats);
 
-    ASSERT_SIZEOF64(TilePipelineStateCreateInfo, 128, "Did you add a new member to TilePipelineStateCreateInfo? Please add serialization here.");
+    ASSERT_SIZEOF64(TilePipelineStateCreateInfo, 144, "Did you add a new member to TilePipelineStateCreateInfo? Please add serialization here.");
 }
 
 template <SerializerMode Mode>
@@ -336,7 +351,7 @@ bool PSOSerializer<Mode>::SerializeCreateInfo(
                            });
     return res;
 
-    ASSERT_SIZEOF64(RayTracingPipelineStateCreateInfo, 168, "Did you add a new member to RayTracingPipelineStateCreateInfo? Please add serialization here.");
+    ASSERT_SIZEOF64(RayTracingPipelineStateCreateInfo, 184, "Did you add a new member to RayTracingPipelineStateCreateInfo? Please add serialization here.");
     ASSERT_SIZEOF64(RayTracingGeneralShaderGroup, 16, "Did you add a new member to RayTracingGeneralShaderGroup? Please add serialization here.");
     ASSERT_SIZEOF64(RayTracingTriangleHitShaderGroup, 24, "Did you add a new member to RayTracingTriangleHitShaderGroup? Please add serialization here.");
     ASSERT_SIZEOF64(RayTracingProceduralHitShaderGroup, 32, "Did you add a new member to RayTracingProceduralHitShaderGroup? Please add serialization here.");
@@ -399,6 +414,9 @@ bool RPSerializer<Mode>::SerializeDesc(
                                                        }))
                                    return false;
 
+                               if (!Ser(Subpass.ViewMask))
+                                   return false;
+
                                Uint32 ShadingRateAttachCount = Subpass.pShadingRateAttachment != nullptr ? 1 : 0;
                                return Ser.SerializeArray(Allocator, Subpass.pShadingRateAttachment, ShadingRateAttachCount,
                                                          [](Serializer<Mode>&                 Ser,
@@ -426,7 +444,7 @@ bool RPSerializer<Mode>::SerializeDesc(
     return res;
 
     ASSERT_SIZEOF64(RenderPassDesc, 56, "Did you add a new member to RenderPassDesc? Please add serialization here.");
-    ASSERT_SIZEOF64(SubpassDesc, 72, "Did you add a new member to SubpassDesc? Please add serialization here.");
+    ASSERT_SIZEOF64(SubpassDesc, 80, "Did you add a new member to SubpassDesc? Please add serialization here.");
     ASSERT_SIZEOF(RenderPassAttachmentDesc, 16, "Did you add a new member to RenderPassAttachmentDesc? Please add serialization here.");
     ASSERT_SIZEOF(SubpassDependencyDesc, 24, "Did you add a new member to SubpassDependencyDesc? Please add serialization here.");
     ASSERT_SIZEOF(ShadingRateAttachment, 16, "Did you add a new member to ShadingRateAttachment? Please add serialization here.");
@@ -517,17 +535,21 @@ bool ShaderSerializer<Mode>::SerializeCI(Serializer<Mode>&            Ser,
 template struct PSOSerializer<SerializerMode::Read>;
 template struct PSOSerializer<SerializerMode::Write>;
 template struct PSOSerializer<SerializerMode::Measure>;
+template struct PSOSerializer<SerializerMode::WriteGrowable>;
 
 template struct PRSSerializer<SerializerMode::Read>;
 template struct PRSSerializer<SerializerMode::Write>;
 template struct PRSSerializer<SerializerMode::Measure>;
+template struct PRSSerializer<SerializerMode::WriteGrowable>;
 
 template struct RPSerializer<SerializerMode::Read>;
 template struct RPSerializer<SerializerMode::Write>;
 template struct RPSerializer<SerializerMode::Measure>;
+template struct RPSerializer<SerializerMode::WriteGrowable>;
 
 template struct ShaderSerializer<SerializerMode::Read>;
 template struct ShaderSerializer<SerializerMode::Write>;
 template struct ShaderSerializer<SerializerMode::Measure>;
+template struct ShaderSerializer<SerializerMode::WriteGrowable>;
 
 } // namespace Diligent
@@ -148,6 +148,26 @@ void ValidatePipelineResourceSignatureDesc(const PipelineResourceSignatureDesc&
             LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].Flags contain GENERAL_INPUT_ATTACHMENT which is only valid in Vulkan");
         }
 
+        if ((Res.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0)
+        {
+            if (Res.Flags != PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS)
+            {
+                LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].Flags (", GetPipelineResourceFlagsString(Res.Flags),
+                                        ") are invalid: INLINE_CONSTANTS flag may not be combined with any other flag.");
+            }
+
+            if (Res.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+            {
+                LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "] ('", Res.Name, "') uses INLINE_CONSTANTS flag, which is not allowed for static variables.");
+            }
+
+            if (Res.ArraySize > MAX_INLINE_CONSTANTS)
+            {
+                LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].ArraySize (", Res.ArraySize, ") exceeds the maximum number of inline constants (",
+                                        MAX_INLINE_CONSTANTS, ").");
+            }
+        }
+
         Resources.emplace(Res.Name, Res);
 
         // NB: when creating immutable sampler array, we have to define the sampler as both resource and
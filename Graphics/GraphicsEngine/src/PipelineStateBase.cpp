@@ -205,6 +205,61 @@ void CorrectRasterizerStateDesc(GraphicsPipelineDesc& GraphicsPipeline, const De
     }
 }
 
+void ValidateSpecializationConstants(const PipelineStateCreateInfo& CreateInfo,
+                                     const IRenderDevice*           pDevice) noexcept(false)
+{
+    const PipelineStateDesc& PSODesc = CreateInfo.PSODesc;
+
+    if (CreateInfo.NumSpecializationConstants == 0)
+        return;
+
+    if (!pDevice->GetDeviceInfo().Features.SpecializationConstants)
+        LOG_PSO_ERROR_AND_THROW("Specialization constants are used, but SpecializationConstants device feature is not enabled.");
+
+    if (CreateInfo.pSpecializationConstants == nullptr)
+        LOG_PSO_ERROR_AND_THROW("pSpecializationConstants is null, but NumSpecializationConstants (", CreateInfo.NumSpecializationConstants, ") is not zero.");
+
+    std::unordered_multimap<HashMapStringKey, SHADER_TYPE> AllConstants;
+    for (Uint32 i = 0; i < CreateInfo.NumSpecializationConstants; ++i)
+    {
+        const SpecializationConstant& Const = CreateInfo.pSpecializationConstants[i];
+        if (Const.Name == nullptr || Const.Name[0] == '\0')
+            LOG_PSO_ERROR_AND_THROW("pSpecializationConstants[", i, "].Name must not be null or empty.");
+
+        if (Const.ShaderStages == SHADER_TYPE_UNKNOWN)
+            LOG_PSO_ERROR_AND_THROW("pSpecializationConstants[", i, "].ShaderStages must not be SHADER_TYPE_UNKNOWN.");
+
+        if (Const.Size == 0)
+            LOG_PSO_ERROR_AND_THROW("pSpecializationConstants[", i, "].Size must not be zero.");
+
+        if (Const.pData == nullptr)
+            LOG_PSO_ERROR_AND_THROW("pSpecializationConstants[", i, "].pData must not be null.");
+
+        auto range = AllConstants.equal_range(Const.Name);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if ((it->second & Const.ShaderStages) != 0)
+            {
+                LOG_PSO_ERROR_AND_THROW("Specialization constant '", Const.Name, "' is defined more than once in the same shader stage.");
+            }
+        }
+        AllConstants.emplace(Const.Name, Const.ShaderStages);
+    }
+}
+
+void ValidatePSOCreateFlags(const PipelineStateCreateInfo& CreateInfo,
+                            const DeviceFeatures&          Features) noexcept(false)
+{
+    const PipelineStateDesc& PSODesc = CreateInfo.PSODesc;
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE) != 0)
+    {
+        if (PSODesc.PipelineType != PIPELINE_TYPE_GRAPHICS)
+            LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag is only allowed for graphics pipelines.");
+        if (!Features.ExtendedDynamicState)
+            LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag is used, but ExtendedDynamicState device feature is not enabled.");
+    }
+}
+
 void ValidatePipelineResourceSignatures(const PipelineStateCreateInfo& CreateInfo,
                                         const IRenderDevice*           pDevice) noexcept(false)
 {
@@ -560,6 +615,8 @@ void ValidateGraphicsPipelineCreateInfo(const GraphicsPipelineStateCreateInfo& C
         LOG_PSO_ERROR_AND_THROW("Pipeline type must be GRAPHICS or MESH.");
 
     ValidatePipelineResourceSignatures(CreateInfo, pDevice);
+    ValidateSpecializationConstants(CreateInfo, pDevice);
+    ValidatePSOCreateFlags(CreateInfo, pDevice->GetDeviceInfo().Features);
 
     const GraphicsPipelineDesc& GraphicsPipeline = CreateInfo.GraphicsPipeline;
 
@@ -682,6 +739,8 @@ void ValidateComputePipelineCreateInfo(const ComputePipelineStateCreateInfo& Cre
         LOG_PSO_ERROR_AND_THROW("Pipeline type must be COMPUTE.");
 
     ValidatePipelineResourceSignatures(CreateInfo, pDevice);
+    ValidateSpecializationConstants(CreateInfo, pDevice);
+    ValidatePSOCreateFlags(CreateInfo, pDevice->GetDeviceInfo().Features);
     ValidatePipelineResourceLayoutDesc(PSODesc, Features);
 
     if (CreateInfo.pCS == nullptr)
@@ -703,6 +762,8 @@ void ValidateRayTracingPipelineCreateInfo(const IRenderDevice*
         LOG_PSO_ERROR_AND_THROW("Standalone ray tracing shaders are not supported");
 
     ValidatePipelineResourceSignatures(CreateInfo, pDevice);
+    ValidateSpecializationConstants(CreateInfo, pDevice);
+    ValidatePSOCreateFlags(CreateInfo, pDevice->GetDeviceInfo().Features);
     ValidatePipelineResourceLayoutDesc(PSODesc, DeviceInfo.Features);
 
     if (DeviceInfo.Type == RENDER_DEVICE_TYPE_D3D12)
@@ -791,6 +852,8 @@ void ValidateTilePipelineCreateInfo(const TilePipelineStateCreateInfo& CreateInf
         LOG_PSO_ERROR_AND_THROW("Pipeline type must be TILE.");
 
     ValidatePipelineResourceSignatures(CreateInfo, pDevice);
+    ValidateSpecializationConstants(CreateInfo, pDevice);
+    ValidatePSOCreateFlags(CreateInfo, pDevice->GetDeviceInfo().Features);
     ValidatePipelineResourceLayoutDesc(PSODesc, Features);
 
     if (CreateInfo.pTS == nullptr)
@@ -0,0 +1,1246 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "RecordingDeviceContext.hpp"
+
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+#include "Buffer.h"
+#include "Texture.h"
+#include "PipelineState.h"
+#include "GraphicsAccessories.hpp"
+#include "DebugUtilities.hpp"
+#include "Cast.hpp"
+#include "EngineMemory.h"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+enum class RECORDED_CMD : Uint32
+{
+    SetPipelineState,
+    TransitionShaderResources,
+    CommitShaderResources,
+    SetStencilRef,
+    SetBlendFactors,
+    SetCullMode,
+    SetDepthState,
+    SetPrimitiveTopology,
+    SetVertexBuffers,
+    InvalidateState,
+    SetIndexBuffer,
+    SetViewports,
+    SetScissorRects,
+    SetRenderTargets,
+    BeginRenderPass,
+    NextSubpass,
+    EndRenderPass,
+    Draw,
+    DrawIndexed,
+    DrawIndirect,
+    DrawIndexedIndirect,
+    DrawMesh,
+    DrawMeshIndirect,
+    MultiDraw,
+    MultiDrawIndexed,
+    DispatchCompute,
+    DispatchComputeIndirect,
+    ClearDepthStencil,
+    ClearRenderTarget,
+    InvalidateRenderTargets,
+    BeginQuery,
+    EndQuery,
+    BeginPoolQuery,
+    EndPoolQuery,
+    ResolvePoolQueries,
+    UpdateBuffer,
+    CopyBuffer,
+    WriteMappedBuffer,
+    UpdateTexture,
+    CopyTexture,
+    GenerateMips,
+    TransitionResourceStates,
+    ResolveTextureSubresource,
+    BeginDebugGroup,
+    EndDebugGroup,
+    InsertDebugLabel,
+    SetShadingRate,
+};
+
+// Every command in the stream starts with the header followed by the command
+// structure. Both are padded to the stream alignment.
+struct RecordedCmdHeader
+{
+    RECORDED_CMD Id;
+    Uint32       Size;
+};
+
+constexpr size_t CmdStreamAlignment = 8;
+static_assert(sizeof(RecordedCmdHeader) % CmdStreamAlignment == 0, "Header size must be a multiple of the stream alignment");
+
+// clang-format off
+#define DEFINE_RECORDED_CMD(Name) static constexpr RECORDED_CMD Id = RECORDED_CMD::Name
+
+struct SetPipelineStateCmd          { DEFINE_RECORDED_CMD(SetPipelineState);          IPipelineState* pPSO; };
+struct TransitionShaderResourcesCmd { DEFINE_RECORDED_CMD(TransitionShaderResources); IShaderResourceBinding* pSRB; };
+struct CommitShaderResourcesCmd     { DEFINE_RECORDED_CMD(CommitShaderResources);     IShaderResourceBinding* pSRB; RESOURCE_STATE_TRANSITION_MODE Mode; };
+struct SetStencilRefCmd             { DEFINE_RECORDED_CMD(SetStencilRef);             Uint32 StencilRef; };
+struct SetBlendFactorsCmd           { DEFINE_RECORDED_CMD(SetBlendFactors);           float Factors[4]; bool IsDefault; };
+struct SetCullModeCmd               { DEFINE_RECORDED_CMD(SetCullMode);               CULL_MODE CullMode; };
+struct SetDepthStateCmd             { DEFINE_RECORDED_CMD(SetDepthState);             Bool DepthEnable; Bool DepthWriteEnable; COMPARISON_FUNCTION DepthFunc; };
+struct SetPrimitiveTopologyCmd      { DEFINE_RECORDED_CMD(SetPrimitiveTopology);      PRIMITIVE_TOPOLOGY Topology; };
+struct SetVertexBuffersCmd          { DEFINE_RECORDED_CMD(SetVertexBuffers);          Uint32 StartSlot; Uint32 NumBuffers; IBuffer* const* ppBuffers; const Uint64* pOffsets; RESOURCE_STATE_TRANSITION_MODE Mode; SET_VERTEX_BUFFERS_FLAGS Flags; };
+struct InvalidateStateCmd           { DEFINE_RECORDED_CMD(InvalidateState); };
+struct SetIndexBufferCmd            { DEFINE_RECORDED_CMD(SetIndexBuffer);            IBuffer* pBuffer; Uint64 Offset; RESOURCE_STATE_TRANSITION_MODE Mode; };
+struct SetViewportsCmd              { DEFINE_RECORDED_CMD(SetViewports);              Uint32 NumViewports; Uint32 RTWidth; Uint32 RTHeight; const Viewport* pViewports; };
+struct SetScissorRectsCmd           { DEFINE_RECORDED_CMD(SetScissorRects);           Uint32 NumRects; Uint32 RTWidth; Uint32 RTHeight; const Rect* pRects; };
+struct SetRenderTargetsCmd          { DEFINE_RECORDED_CMD(SetRenderTargets);          SetRenderTargetsAttribs Attribs; };
+struct BeginRenderPassCmd           { DEFINE_RECORDED_CMD(BeginRenderPass);           BeginRenderPassAttribs Attribs; };
+struct NextSubpassCmd               { DEFINE_RECORDED_CMD(NextSubpass); };
+struct EndRenderPassCmd             { DEFINE_RECORDED_CMD(EndRenderPass); };
+struct DrawCmd                      { DEFINE_RECORDED_CMD(Draw);                      DrawAttribs Attribs; };
+struct DrawIndexedCmd               { DEFINE_RECORDED_CMD(DrawIndexed);               DrawIndexedAttribs Attribs; };
+struct DrawIndirectCmd              { DEFINE_RECORDED_CMD(DrawIndirect);              DrawIndirectAttribs Attribs; };
+struct DrawIndexedIndirectCmd       { DEFINE_RECORDED_CMD(DrawIndexedIndirect);       DrawIndexedIndirectAttribs Attribs; };
+struct DrawMeshCmd                  { DEFINE_RECORDED_CMD(DrawMesh);                  DrawMeshAttribs Attribs; };
+struct DrawMeshIndirectCmd          { DEFINE_RECORDED_CMD(DrawMeshIndirect);          DrawMeshIndirectAttribs Attribs; };
+struct MultiDrawCmd                 { DEFINE_RECORDED_CMD(MultiDraw);                 MultiDrawAttribs Attribs; };
+struct MultiDrawIndexedCmd          { DEFINE_RECORDED_CMD(MultiDrawIndexed);          MultiDrawIndexedAttribs Attribs; };
+struct DispatchComputeCmd           { DEFINE_RECORDED_CMD(DispatchCompute);           DispatchComputeAttribs Attribs; };
+struct DispatchComputeIndirectCmd   { DEFINE_RECORDED_CMD(DispatchComputeIndirect);   DispatchComputeIndirectAttribs Attribs; };
+struct ClearDepthStencilCmd         { DEFINE_RECORDED_CMD(ClearDepthStencil);         ITextureView* pView; CLEAR_DEPTH_STENCIL_FLAGS Flags; float Depth; Uint8 Stencil; RESOURCE_STATE_TRANSITION_MODE Mode; };
+struct ClearRenderTargetCmd         { DEFINE_RECORDED_CMD(ClearRenderTarget);         ITextureView* pView; Uint8 RGBA[16]; bool HasRGBA; RESOURCE_STATE_TRANSITION_MODE Mode; };
+struct InvalidateRenderTargetsCmd   { DEFINE_RECORDED_CMD(InvalidateRenderTargets);   Uint32 RenderTargetMask; bool InvalidateDepthStencil; };
+struct BeginQueryCmd                { DEFINE_RECORDED_CMD(BeginQuery);                IQuery* pQuery; };
+struct EndQueryCmd                  { DEFINE_RECORDED_CMD(EndQuery);                  IQuery* pQuery; };
+struct BeginPoolQueryCmd            { DEFINE_RECORDED_CMD(BeginPoolQuery);            IQueryPool* pQueryPool; Uint32 Index; };
+struct EndPoolQueryCmd              { DEFINE_RECORDED_CMD(EndPoolQuery);              IQueryPool* pQueryPool; Uint32 Index; };
+struct ResolvePoolQueriesCmd        { DEFINE_RECORDED_CMD(ResolvePoolQueries);        ResolvePoolQueriesAttribs Attribs; };
+struct UpdateBufferCmd              { DEFINE_RECORDED_CMD(UpdateBuffer);              IBuffer* pBuffer; Uint64 Offset; Uint64 Size; const void* pData; RESOURCE_STATE_TRANSITION_MODE Mode; };
+struct CopyBufferCmd                { DEFINE_RECORDED_CMD(CopyBuffer);                IBuffer* pSrcBuffer; Uint64 SrcOffset; RESOURCE_STATE_TRANSITION_MODE SrcMode; IBuffer* pDstBuffer; Uint64 DstOffset; Uint64 Size; RESOURCE_STATE_TRANSITION_MODE DstMode; };
+struct WriteMappedBufferCmd         { DEFINE_RECORDED_CMD(WriteMappedBuffer);         IBuffer* pBuffer; const void* pData; Uint64 Size; };
+struct UpdateTextureCmd             { DEFINE_RECORDED_CMD(UpdateTexture);             ITexture* pTexture; Uint32 MipLevel; Uint32 Slice; Box DstBox; TextureSubResData SubresData; RESOURCE_STATE_TRANSITION_MODE SrcBufferMode; RESOURCE_STATE_TRANSITION_MODE TextureMode; };
+struct CopyTextureCmd               { DEFINE_RECORDED_CMD(CopyTexture);               CopyTextureAttribs Attribs; };
+struct GenerateMipsCmd              { DEFINE_RECORDED_CMD(GenerateMips);              ITextureView* pView; GENERATE_MIPS_FLAGS Flags; };
+struct TransitionResourceStatesCmd  { DEFINE_RECORDED_CMD(TransitionResourceStates);  Uint32 BarrierCount; const StateTransitionDesc* pBarriers; };
+struct ResolveTextureSubresourceCmd { DEFINE_RECORDED_CMD(ResolveTextureSubresource); ITexture* pSrcTexture; ITexture* pDstTexture; ResolveTextureSubresourceAttribs Attribs; };
+struct BeginDebugGroupCmd           { DEFINE_RECORDED_CMD(BeginDebugGroup);           const Char* Name; float Color[4]; bool HasColor; };
+struct EndDebugGroupCmd             { DEFINE_RECORDED_CMD(EndDebugGroup); };
+struct InsertDebugLabelCmd          { DEFINE_RECORDED_CMD(InsertDebugLabel);          const Char* Label; float Color[4]; bool HasColor; };
+struct SetShadingRateCmd            { DEFINE_RECORDED_CMD(SetShadingRate);            SHADING_RATE BaseRate; SHADING_RATE_COMBINER PrimitiveCombiner; SHADING_RATE_COMBINER TextureCombiner; };
+
+#undef DEFINE_RECORDED_CMD
+// clang-format on
+
+// Tracks the state set during the replay to skip redundant commands.
+// Only identical consecutive state changes are skipped, and the cache is reset by every
+// command that may change resource states or bindings (render targets, copies, clears, etc.),
+// so that the immediate context always sees the same effective state as without filtering.
+struct ReplayStateCache
+{
+    IPipelineState*                pPSO           = nullptr;
+    IShaderResourceBinding*        pSRB           = nullptr;
+    RESOURCE_STATE_TRANSITION_MODE SRBMode        = RESOURCE_STATE_TRANSITION_MODE_NONE;
+    const SetIndexBufferCmd*       pIndexBuffer   = nullptr;
+    const SetVertexBuffersCmd*     pVertexBuffers = nullptr;
+    const SetViewportsCmd*         pViewports     = nullptr;
+    const SetScissorRectsCmd*      pScissorRects  = nullptr;
+    const SetStencilRefCmd*        pStencilRef    = nullptr;
+    const SetBlendFactorsCmd*      pBlendFactors  = nullptr;
+
+    void Reset()
+    {
+        *this = ReplayStateCache{};
+    }
+
+    bool IsRedundant(const SetVertexBuffersCmd& Cmd) const
+    {
+        if (pVertexBuffers == nullptr ||
+            pVertexBuffers->StartSlot != Cmd.StartSlot ||
+            pVertexBuffers->NumBuffers != Cmd.NumBuffers ||
+            pVertexBuffers->Mode != Cmd.Mode ||
+            pVertexBuffers->Flags != Cmd.Flags)
+            return false;
+
+        return std::equal(Cmd.ppBuffers, Cmd.ppBuffers + Cmd.NumBuffers, pVertexBuffers->ppBuffers) &&
+            std::equal(Cmd.pOffsets, Cmd.pOffsets + Cmd.NumBuffers, pVertexBuffers->pOffsets);
+    }
+
+    bool IsRedundant(const SetIndexBufferCmd& Cmd) const
+    {
+        return (pIndexBuffer != nullptr &&
+                pIndexBuffer->pBuffer == Cmd.pBuffer &&
+                pIndexBuffer->Offset == Cmd.Offset &&
+                pIndexBuffer->Mode == Cmd.Mode);
+    }
+
+    bool IsRedundant(const SetViewportsCmd& Cmd) const
+    {
+        return (pViewports != nullptr &&
+                pViewports->NumViewports == Cmd.NumViewports &&
+                pViewports->RTWidth == Cmd.RTWidth &&
+                pViewports->RTHeight == Cmd.RTHeight &&
+                std::equal(Cmd.pViewports, Cmd.pViewports + Cmd.NumViewports, pViewports->pViewports));
+    }
+
+    bool IsRedundant(const SetScissorRectsCmd& Cmd) const
+    {
+        return (pScissorRects != nullptr &&
+                pScissorRects->NumRects == Cmd.NumRects &&
+                pScissorRects->RTWidth == Cmd.RTWidth &&
+                pScissorRects->RTHeight == Cmd.RTHeight &&
+                std::equal(Cmd.pRects, Cmd.pRects + Cmd.NumRects, pScissorRects->pRects));
+    }
+
+    bool IsRedundant(const SetStencilRefCmd& Cmd) const
+    {
+        return pStencilRef != nullptr && pStencilRef->StencilRef == Cmd.StencilRef;
+    }
+
+    bool IsRedundant(const SetBlendFactorsCmd& Cmd) const
+    {
+        return (pBlendFactors != nullptr &&
+                pBlendFactors->IsDefault == Cmd.IsDefault &&
+                (Cmd.IsDefault || std::equal(Cmd.Factors, Cmd.Factors + 4, pBlendFactors->Factors)));
+    }
+};
+
+template <typename CmdType>
+const CmdType& GetCmd(const Uint8* pHeader)
+{
+    return *reinterpret_cast<const CmdType*>(pHeader + sizeof(RecordedCmdHeader));
+}
+
+} // namespace
+
+
+RecordedCommandList::RecordedCommandList(IReferenceCounters*                     pRefCounters,
+                                         Uint32                                  ImmediateContextId,
+                                         std::vector<Uint8>&&                    Commands,
+                                         std::unique_ptr<DynamicLinearAllocator> pData,
+                                         std::vector<RefCntAutoPtr<IObject>>&&   Objects) noexcept :
+    TBase{pRefCounters},
+    m_Desc{"Recorded command list"},
+    m_ImmediateContextId{ImmediateContextId},
+    m_Commands{std::move(Commands)},
+    m_pData{std::move(pData)},
+    m_Objects{std::move(Objects)}
+{
+}
+
+RecordedCommandList::~RecordedCommandList()
+{
+}
+
+void RecordedCommandList::Execute(IDeviceContext* pCtx) const
+{
+    VERIFY_EXPR(pCtx != nullptr);
+    DEV_CHECK_ERR(!pCtx->GetDesc().IsDeferred, "Recorded command lists can only be executed by immediate contexts");
+    DEV_CHECK_ERR(m_ImmediateContextId == ~0u || pCtx->GetDesc().ContextId == m_ImmediateContextId,
+                  "The command list was recorded for immediate context ", m_ImmediateContextId,
+                  ", but is being executed by immediate context ", Uint32{pCtx->GetDesc().ContextId});
+
+    // Command lists do not inherit the state of the immediate context
+    pCtx->InvalidateState();
+
+    ReplayStateCache Cache;
+
+    const Uint8* pCurr = m_Commands.data();
+    const Uint8* pEnd  = pCurr + m_Commands.size();
+    while (pCurr < pEnd)
+    {
+        const RecordedCmdHeader& Header = *reinterpret_cast<const RecordedCmdHeader*>(pCurr);
+        VERIFY(Header.Size >= sizeof(RecordedCmdHeader) && pCurr + Header.Size <= pEnd, "Corrupted command stream");
+
+        switch (Header.Id)
+        {
+            case RECORDED_CMD::SetPipelineState:
+            {
+                const SetPipelineStateCmd& Cmd = GetCmd<SetPipelineStateCmd>(pCurr);
+                if (Cmd.pPSO != Cache.pPSO)
+                {
+                    pCtx->SetPipelineState(Cmd.pPSO);
+                    Cache.pPSO = Cmd.pPSO;
+                }
+                break;
+            }
+
+            case RECORDED_CMD::TransitionShaderResources:
+                pCtx->TransitionShaderResources(GetCmd<TransitionShaderResourcesCmd>(pCurr).pSRB);
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::CommitShaderResources:
+            {
+                const CommitShaderResourcesCmd& Cmd = GetCmd<CommitShaderResourcesCmd>(pCurr);
+                if (Cmd.pSRB != Cache.pSRB || Cmd.Mode != Cache.SRBMode)
+                {
+                    pCtx->CommitShaderResources(Cmd.pSRB, Cmd.Mode);
+                    Cache.pSRB    = Cmd.pSRB;
+                    Cache.SRBMode = Cmd.Mode;
+                }
+                break;
+            }
+
+            case RECORDED_CMD::SetStencilRef:
+            {
+                const SetStencilRefCmd& Cmd = GetCmd<SetStencilRefCmd>(pCurr);
+                if (!Cache.IsRedundant(Cmd))
+                {
+                    pCtx->SetStencilRef(Cmd.StencilRef);
+                    Cache.pStencilRef = &Cmd;
+                }
+                break;
+            }
+
+            case RECORDED_CMD::SetBlendFactors:
+            {
+                const SetBlendFactorsCmd& Cmd = GetCmd<SetBlendFactorsCmd>(pCurr);
+                if (!Cache.IsRedundant(Cmd))
+                {
+                    pCtx->SetBlendFactors(Cmd.IsDefault ? nullptr : Cmd.Factors);
+                    Cache.pBlendFactors = &Cmd;
+                }
+                break;
+            }
+
+            case RECORDED_CMD::SetCullMode:
+                pCtx->SetCullMode(GetCmd<SetCullModeCmd>(pCurr).CullMode);
+                break;
+
+            case RECORDED_CMD::SetDepthState:
+            {
+                const SetDepthStateCmd& Cmd = GetCmd<SetDepthStateCmd>(pCurr);
+                pCtx->SetDepthState(Cmd.DepthEnable, Cmd.DepthWriteEnable, Cmd.DepthFunc);
+                break;
+            }
+
+            case RECORDED_CMD::SetPrimitiveTopology:
+                pCtx->SetPrimitiveTopology(GetCmd<SetPrimitiveTopologyCmd>(pCurr).Topology);
+                break;
+
+            case RECORDED_CMD::SetVertexBuffers:
+            {
+                const SetVertexBuffersCmd& Cmd = GetCmd<SetVertexBuffersCmd>(pCurr);
+                if (!Cache.IsRedundant(Cmd))
+                {
+                    pCtx->SetVertexBuffers(Cmd.StartSlot, Cmd.NumBuffers, Cmd.ppBuffers, Cmd.pOffsets, Cmd.Mode, Cmd.Flags);
+                    Cache.pVertexBuffers = &Cmd;
+                }
+                break;
+            }
+
+            case RECORDED_CMD::InvalidateState:
+                pCtx->InvalidateState();
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::SetIndexBuffer:
+            {
+                const SetIndexBufferCmd& Cmd = GetCmd<SetIndexBufferCmd>(pCurr);
+                if (!Cache.IsRedundant(Cmd))
+                {
+                    pCtx->SetIndexBuffer(Cmd.pBuffer, Cmd.Offset, Cmd.Mode);
+                    Cache.pIndexBuffer = &Cmd;
+                }
+                break;
+            }
+
+            case RECORDED_CMD::SetViewports:
+            {
+                const SetViewportsCmd& Cmd = GetCmd<SetViewportsCmd>(pCurr);
+                if (!Cache.IsRedundant(Cmd))
+                {
+                    pCtx->SetViewports(Cmd.NumViewports, Cmd.pViewports, Cmd.RTWidth, Cmd.RTHeight);
+                    Cache.pViewports = &Cmd;
+                }
+                break;
+            }
+
+            case RECORDED_CMD::SetScissorRects:
+            {
+                const SetScissorRectsCmd& Cmd = GetCmd<SetScissorRectsCmd>(pCurr);
+                if (!Cache.IsRedundant(Cmd))
+                {
+                    pCtx->SetScissorRects(Cmd.NumRects, Cmd.pRects, Cmd.RTWidth, Cmd.RTHeight);
+                    Cache.pScissorRects = &Cmd;
+                }
+                break;
+            }
+
+            case RECORDED_CMD::SetRenderTargets:
+                pCtx->SetRenderTargetsExt(GetCmd<SetRenderTargetsCmd>(pCurr).Attribs);
+                // Setting render targets resets viewports and may unbind shader resources
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::BeginRenderPass:
+                pCtx->BeginRenderPass(GetCmd<BeginRenderPassCmd>(pCurr).Attribs);
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::NextSubpass:
+                pCtx->NextSubpass();
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::EndRenderPass:
+                pCtx->EndRenderPass();
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::Draw:
+                pCtx->Draw(GetCmd<DrawCmd>(pCurr).Attribs);
+                break;
+
+            case RECORDED_CMD::DrawIndexed:
+                pCtx->DrawIndexed(GetCmd<DrawIndexedCmd>(pCurr).Attribs);
+                break;
+
+            case RECORDED_CMD::DrawIndirect:
+                pCtx->DrawIndirect(GetCmd<DrawIndirectCmd>(pCurr).Attribs);
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::DrawIndexedIndirect:
+                pCtx->DrawIndexedIndirect(GetCmd<DrawIndexedIndirectCmd>(pCurr).Attribs);
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::DrawMesh:
+                pCtx->DrawMesh(GetCmd<DrawMeshCmd>(pCurr).Attribs);
+                break;
+
+            case RECORDED_CMD::DrawMeshIndirect:
+                pCtx->DrawMeshIndirect(GetCmd<DrawMeshIndirectCmd>(pCurr).Attribs);
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::MultiDraw:
+                pCtx->MultiDraw(GetCmd<MultiDrawCmd>(pCurr).Attribs);
+                break;
+
+            case RECORDED_CMD::MultiDrawIndexed:
+                pCtx->MultiDrawIndexed(GetCmd<MultiDrawIndexedCmd>(pCurr).Attribs);
+                break;
+
+            case RECORDED_CMD::DispatchCompute:
+                pCtx->DispatchCompute(GetCmd<DispatchComputeCmd>(pCurr).Attribs);
+                break;
+
+            case RECORDED_CMD::DispatchComputeIndirect:
+                pCtx->DispatchComputeIndirect(GetCmd<DispatchComputeIndirectCmd>(pCurr).Attribs);
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::ClearDepthStencil:
+            {
+                const ClearDepthStencilCmd& Cmd = GetCmd<ClearDepthStencilCmd>(pCurr);
+                pCtx->ClearDepthStencil(Cmd.pView, Cmd.Flags, Cmd.Depth, Cmd.Stencil, Cmd.Mode);
+                Cache.Reset();
+                break;
+            }
+
+            case RECORDED_CMD::ClearRenderTarget:
+            {
+                const ClearRenderTargetCmd& Cmd = GetCmd<ClearRenderTargetCmd>(pCurr);
+                pCtx->ClearRenderTarget(Cmd.pView, Cmd.HasRGBA ? Cmd.RGBA : nullptr, Cmd.Mode);
+                Cache.Reset();
+                break;
+            }
+
+            case RECORDED_CMD::InvalidateRenderTargets:
+            {
+                const InvalidateRenderTargetsCmd& Cmd = GetCmd<InvalidateRenderTargetsCmd>(pCurr);
+                pCtx->InvalidateRenderTargets(Cmd.RenderTargetMask, Cmd.InvalidateDepthStencil);
+                break;
+            }
+
+            case RECORDED_CMD::BeginQuery:
+                pCtx->BeginQuery(GetCmd<BeginQueryCmd>(pCurr).pQuery);
+                break;
+
+            case RECORDED_CMD::EndQuery:
+                pCtx->EndQuery(GetCmd<EndQueryCmd>(pCurr).pQuery);
+                break;
+
+            case RECORDED_CMD::BeginPoolQuery:
+            {
+                const BeginPoolQueryCmd& Cmd = GetCmd<BeginPoolQueryCmd>(pCurr);
+                pCtx->BeginPoolQuery(Cmd.pQueryPool, Cmd.Index);
+                break;
+            }
+
+            case RECORDED_CMD::EndPoolQuery:
+            {
+                const EndPoolQueryCmd& Cmd = GetCmd<EndPoolQueryCmd>(pCurr);
+                pCtx->EndPoolQuery(Cmd.pQueryPool, Cmd.Index);
+                break;
+            }
+
+            case RECORDED_CMD::ResolvePoolQueries:
+                pCtx->ResolvePoolQueries(GetCmd<ResolvePoolQueriesCmd>(pCurr).Attribs);
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::UpdateBuffer:
+            {
+                const UpdateBufferCmd& Cmd = GetCmd<UpdateBufferCmd>(pCurr);
+                pCtx->UpdateBuffer(Cmd.pBuffer, Cmd.Offset, Cmd.Size, Cmd.pData, Cmd.Mode);
+                Cache.Reset();
+                break;
+            }
+
+            case RECORDED_CMD::CopyBuffer:
+            {
+                const CopyBufferCmd& Cmd = GetCmd<CopyBufferCmd>(pCurr);
+                pCtx->CopyBuffer(Cmd.pSrcBuffer, Cmd.SrcOffset, Cmd.SrcMode, Cmd.pDstBuffer, Cmd.DstOffset, Cmd.Size, Cmd.DstMode);
+                Cache.Reset();
+                break;
+            }
+
+            case RECORDED_CMD::WriteMappedBuffer:
+            {
+                // Discarding a dynamic buffer does not affect its bindings, so the cache is not reset
+                const WriteMappedBufferCmd& Cmd = GetCmd<WriteMappedBufferCmd>(pCurr);
+
+                PVoid pMappedData = nullptr;
+                pCtx->MapBuffer(Cmd.pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pMappedData);
+                if (pMappedData != nullptr)
+                {
+                    std::memcpy(pMappedData, Cmd.pData, static_cast<size_t>(Cmd.Size));
+                    pCtx->UnmapBuffer(Cmd.pBuffer, MAP_WRITE);
+                }
+                break;
+            }
+
+            case RECORDED_CMD::UpdateTexture:
+            {
+                const UpdateTextureCmd& Cmd = GetCmd<UpdateTextureCmd>(pCurr);
+                pCtx->UpdateTexture(Cmd.pTexture, Cmd.MipLevel, Cmd.Slice, Cmd.DstBox, Cmd.SubresData, Cmd.SrcBufferMode, Cmd.TextureMode);
+                Cache.Reset();
+                break;
+            }
+
+            case RECORDED_CMD::CopyTexture:
+                pCtx->CopyTexture(GetCmd<CopyTextureCmd>(pCurr).Attribs);
+                Cache.Reset();
+                break;
+
+            case RECORDED_CMD::GenerateMips:
+            {
+                const GenerateMipsCmd& Cmd = GetCmd<GenerateMipsCmd>(pCurr);
+                pCtx->GenerateMips(Cmd.pView, Cmd.Flags);
+                Cache.Reset();
+                break;
+            }
+
+            case RECORDED_CMD::TransitionResourceStates:
+            {
+                const TransitionResourceStatesCmd& Cmd = GetCmd<TransitionResourceStatesCmd>(pCurr);
+                pCtx->TransitionResourceStates(Cmd.BarrierCount, Cmd.pBarriers);
+                Cache.Reset();
+                break;
+            }
+
+            case RECORDED_CMD::ResolveTextureSubresource:
+            {
+                const ResolveTextureSubresourceCmd& Cmd = GetCmd<ResolveTextureSubresourceCmd>(pCurr);
+                pCtx->ResolveTextureSubresource(Cmd.pSrcTexture, Cmd.pDstTexture, Cmd.Attribs);
+                Cache.Reset();
+                break;
+            }
+
+            case RECORDED_CMD::BeginDebugGroup:
+            {
+                const BeginDebugGroupCmd& Cmd = GetCmd<BeginDebugGroupCmd>(pCurr);
+                pCtx->BeginDebugGroup(Cmd.Name, Cmd.HasColor ? Cmd.Color : nullptr);
+                break;
+            }
+
+            case RECORDED_CMD::EndDebugGroup:
+                pCtx->EndDebugGroup();
+                break;
+
+            case RECORDED_CMD::InsertDebugLabel:
+            {
+                const InsertDebugLabelCmd& Cmd = GetCmd<InsertDebugLabelCmd>(pCurr);
+                pCtx->InsertDebugLabel(Cmd.Label, Cmd.HasColor ? Cmd.Color : nullptr);
+                break;
+            }
+
+            case RECORDED_CMD::SetShadingRate:
+            {
+                const SetShadingRateCmd& Cmd = GetCmd<SetShadingRateCmd>(pCurr);
+                pCtx->SetShadingRate(Cmd.BaseRate, Cmd.PrimitiveCombiner, Cmd.TextureCombiner);
+                break;
+            }
+
+            default:
+                UNEXPECTED("Unexpected recorded command");
+        }
+
+        pCurr += Header.Size;
+    }
+
+    // Same as native command lists, the immediate context is left in the default state
+    pCtx->InvalidateState();
+}
+
+
+
+RecordingDeviceContext::RecordingDeviceContext(IReferenceCounters*      pRefCounters,
+                                               IRenderDevice*           pDevice,
+                                               const DeviceContextDesc& Desc) :
+    TBase{pRefCounters},
+    m_pDevice{pDevice},
+    m_Name{Desc.Name != nullptr ? Desc.Name : "Recording context"},
+    m_Desc{Desc}
+{
+    VERIFY_EXPR(Desc.IsDeferred);
+    m_Desc.Name = m_Name.c_str();
+    ResetRecording();
+}
+
+RecordingDeviceContext::~RecordingDeviceContext()
+{
+}
+
+void RecordingDeviceContext::ResetRecording()
+{
+    m_Commands.clear();
+    m_pData = std::make_unique<DynamicLinearAllocator>(GetRawAllocator(), 4 << 10);
+    m_Objects.clear();
+    m_ObjectSet.clear();
+    m_MappedBuffers.clear();
+}
+
+template <typename CmdType>
+void RecordingDeviceContext::Record(const CmdType& Cmd)
+{
+    static_assert(std::is_trivially_copyable<CmdType>::value, "Recorded commands must be trivially copyable");
+    static_assert(alignof(CmdType) <= CmdStreamAlignment, "Command alignment exceeds the stream alignment");
+
+    const size_t Offset  = m_Commands.size();
+    const size_t CmdSize = sizeof(RecordedCmdHeader) + AlignUp(sizeof(CmdType), CmdStreamAlignment);
+    m_Commands.resize(Offset + CmdSize);
+
+    const RecordedCmdHeader Header{CmdType::Id, static_cast<Uint32>(CmdSize)};
+    std::memcpy(&m_Commands[Offset], &Header, sizeof(Header));
+    std::memcpy(&m_Commands[Offset + sizeof(Header)], &Cmd, sizeof(Cmd));
+}
+
+template <typename ObjectType>
+ObjectType* RecordingDeviceContext::KeepAlive(ObjectType* pObject)
+{
+    if (pObject != nullptr && m_ObjectSet.insert(pObject).second)
+        m_Objects.emplace_back(pObject);
+    return pObject;
+}
+
+template <typename T>
+const T* RecordingDeviceContext::CopyArray(const T* pSrc, size_t Count)
+{
+    return (pSrc != nullptr && Count > 0) ? m_pData->CopyArray(pSrc, Count) : nullptr;
+}
+
+void RecordingDeviceContext::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
+{
+    DEV_CHECK_ERR(m_Commands.empty(), "Recording context already contains commands. Call FinishCommandList() before beginning a new command list.");
+    m_ImmediateContextId = ImmediateContextId;
+}
+
+void RecordingDeviceContext::SetPipelineState(IPipelineState* pPipelineState)
+{
+    DEV_CHECK_ERR(pPipelineState != nullptr, "Pipeline state must not be null");
+    Record(SetPipelineStateCmd{KeepAlive(pPipelineState)});
+}
+
+void RecordingDeviceContext::TransitionShaderResources(IShaderResourceBinding* pShaderResourceBinding)
+{
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "Shader resource binding must not be null");
+    Record(TransitionShaderResourcesCmd{KeepAlive(pShaderResourceBinding)});
+}
+
+void RecordingDeviceContext::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "Shader resource binding must not be null");
+    Record(CommitShaderResourcesCmd{KeepAlive(pShaderResourceBinding), StateTransitionMode});
+}
+
+void RecordingDeviceContext::SetStencilRef(Uint32 StencilRef)
+{
+    Record(SetStencilRefCmd{StencilRef});
+}
+
+void RecordingDeviceContext::SetBlendFactors(const float* pBlendFactors)
+{
+    SetBlendFactorsCmd Cmd{};
+    Cmd.IsDefault = pBlendFactors == nullptr;
+    if (pBlendFactors != nullptr)
+        std::copy(pBlendFactors, pBlendFactors + 4, Cmd.Factors);
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::SetCullMode(CULL_MODE CullMode)
+{
+    Record(SetCullModeCmd{CullMode});
+}
+
+void RecordingDeviceContext::SetDepthState(Bool DepthEnable, Bool DepthWriteEnable, COMPARISON_FUNCTION DepthFunc)
+{
+    Record(SetDepthStateCmd{DepthEnable, DepthWriteEnable, DepthFunc});
+}
+
+void RecordingDeviceContext::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    Record(SetPrimitiveTopologyCmd{Topology});
+}
+
+void RecordingDeviceContext::SetVertexBuffers(Uint32                         StartSlot,
+                                              Uint32                         NumBuffersSet,
+                                              IBuffer* const*                ppBuffers,
+                                              const Uint64*                  pOffsets,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                              SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    DEV_CHECK_ERR(StartSlot + NumBuffersSet <= MAX_BUFFER_SLOTS, "Too many vertex buffer slots are being set");
+
+    SetVertexBuffersCmd Cmd{StartSlot, NumBuffersSet, nullptr, nullptr, StateTransitionMode, Flags};
+    if (NumBuffersSet > 0)
+    {
+        DEV_CHECK_ERR(ppBuffers != nullptr, "ppBuffers must not be null when NumBuffersSet is not zero");
+
+        IBuffer** ppBuffersCopy = m_pData->Allocate<IBuffer*>(NumBuffersSet);
+        Uint64*   pOffsetsCopy  = m_pData->Allocate<Uint64>(NumBuffersSet);
+        for (Uint32 i = 0; i < NumBuffersSet; ++i)
+        {
+            ppBuffersCopy[i] = KeepAlive(ppBuffers[i]);
+            pOffsetsCopy[i]  = pOffsets != nullptr ? pOffsets[i] : 0;
+        }
+        Cmd.ppBuffers = ppBuffersCopy;
+        Cmd.pOffsets  = pOffsetsCopy;
+    }
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::InvalidateState()
+{
+    Record(InvalidateStateCmd{});
+}
+
+void RecordingDeviceContext::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    Record(SetIndexBufferCmd{KeepAlive(pIndexBuffer), ByteOffset, StateTransitionMode});
+}
+
+void RecordingDeviceContext::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
+{
+    DEV_CHECK_ERR(NumViewports <= MAX_VIEWPORTS, "Too many viewports are being set");
+    Record(SetViewportsCmd{NumViewports, RTWidth, RTHeight, CopyArray(pViewports, NumViewports)});
+}
+
+void RecordingDeviceContext::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    DEV_CHECK_ERR(NumRects <= MAX_VIEWPORTS, "Too many scissor rects are being set");
+    Record(SetScissorRectsCmd{NumRects, RTWidth, RTHeight, CopyArray(pRects, NumRects)});
+}
+
+void RecordingDeviceContext::SetRenderTargets(Uint32                         NumRenderTargets,
+                                              ITextureView*                  ppRenderTargets[],
+                                              ITextureView*                  pDepthStencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    SetRenderTargetsExt({NumRenderTargets, ppRenderTargets, pDepthStencil, StateTransitionMode});
+}
+
+void RecordingDeviceContext::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.NumRenderTargets <= MAX_RENDER_TARGETS, "Too many render targets are being set");
+
+    SetRenderTargetsCmd Cmd{Attribs};
+    if (Attribs.NumRenderTargets > 0)
+    {
+        DEV_CHECK_ERR(Attribs.ppRenderTargets != nullptr, "ppRenderTargets must not be null when NumRenderTargets is not zero");
+
+        Cmd.Attribs.ppRenderTargets = m_pData->Allocate<ITextureView*>(Attribs.NumRenderTargets);
+        for (Uint32 i = 0; i < Attribs.NumRenderTargets; ++i)
+            Cmd.Attribs.ppRenderTargets[i] = KeepAlive(Attribs.ppRenderTargets[i]);
+    }
+    KeepAlive(Attribs.pDepthStencil);
+    KeepAlive(Attribs.pShadingRateMap);
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    BeginRenderPassCmd Cmd{Attribs};
+    KeepAlive(Attribs.pRenderPass);
+    KeepAlive(Attribs.pFramebuffer);
+    if (Attribs.ClearValueCount > 0 && Attribs.pClearValues != nullptr)
+        Cmd.Attribs.pClearValues = m_pData->CopyArray(Attribs.pClearValues, Attribs.ClearValueCount);
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::NextSubpass()
+{
+    Record(NextSubpassCmd{});
+}
+
+void RecordingDeviceContext::EndRenderPass()
+{
+    Record(EndRenderPassCmd{});
+}
+
+void RecordingDeviceContext::Draw(const DrawAttribs& Attribs)
+{
+    Record(DrawCmd{Attribs});
+}
+
+void RecordingDeviceContext::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    Record(DrawIndexedCmd{Attribs});
+}
+
+void RecordingDeviceContext::DrawIndirect(const DrawIndirectAttribs& Attribs)
+{
+    KeepAlive(Attribs.pAttribsBuffer);
+    KeepAlive(Attribs.pCounterBuffer);
+    Record(DrawIndirectCmd{Attribs});
+}
+
+void RecordingDeviceContext::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
+{
+    KeepAlive(Attribs.pAttribsBuffer);
+    KeepAlive(Attribs.pCounterBuffer);
+    Record(DrawIndexedIndirectCmd{Attribs});
+}
+
+void RecordingDeviceContext::ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs)
+{
+    DEV_ERROR("ExecuteIndirectCommands is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    Record(DrawMeshCmd{Attribs});
+}
+
+void RecordingDeviceContext::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
+{
+    KeepAlive(Attribs.pAttribsBuffer);
+    KeepAlive(Attribs.pCounterBuffer);
+    Record(DrawMeshIndirectCmd{Attribs});
+}
+
+void RecordingDeviceContext::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    MultiDrawCmd Cmd{Attribs};
+    Cmd.Attribs.pDrawItems = CopyArray(Attribs.pDrawItems, Attribs.DrawCount);
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    MultiDrawIndexedCmd Cmd{Attribs};
+    Cmd.Attribs.pDrawItems = CopyArray(Attribs.pDrawItems, Attribs.DrawCount);
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    Record(DispatchComputeCmd{Attribs});
+}
+
+void RecordingDeviceContext::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
+{
+    KeepAlive(Attribs.pAttribsBuffer);
+    Record(DispatchComputeIndirectCmd{Attribs});
+}
+
+void RecordingDeviceContext::DispatchTile(const DispatchTileAttribs& Attribs)
+{
+    UNSUPPORTED("DispatchTile is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::GetTileSize(Uint32& TileSizeX, Uint32& TileSizeY)
+{
+    UNSUPPORTED("GetTileSize is not supported by recording contexts");
+    TileSizeX = 0;
+    TileSizeY = 0;
+}
+
+void RecordingDeviceContext::ClearDepthStencil(ITextureView*                  pView,
+                                               CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                               float                          fDepth,
+                                               Uint8                          Stencil,
+                                               RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    Record(ClearDepthStencilCmd{KeepAlive(pView), ClearFlags, fDepth, Stencil, StateTransitionMode});
+}
+
+void RecordingDeviceContext::ClearRenderTarget(ITextureView* pView, const void* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    ClearRenderTargetCmd Cmd{};
+    Cmd.pView   = KeepAlive(pView);
+    Cmd.HasRGBA = RGBA != nullptr;
+    Cmd.Mode    = StateTransitionMode;
+    // RGBA always points to four 32-bit components
+    if (RGBA != nullptr)
+        std::memcpy(Cmd.RGBA, RGBA, sizeof(Cmd.RGBA));
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil)
+{
+    Record(InvalidateRenderTargetsCmd{RenderTargetMask, InvalidateDepthStencil != False});
+}
+
+void RecordingDeviceContext::FinishCommandList(ICommandList** ppCommandList)
+{
+    DEV_CHECK_ERR(ppCommandList != nullptr, "ppCommandList must not be null");
+    DEV_CHECK_ERR(m_MappedBuffers.empty(), "All mapped buffers must be unmapped before the command list is finished");
+
+    RecordedCommandList* pCmdList = NEW_RC_OBJ(GetRawAllocator(), "RecordedCommandList instance", RecordedCommandList)(
+        m_ImmediateContextId, std::move(m_Commands), std::move(m_pData), std::move(m_Objects));
+    pCmdList->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
+
+    ResetRecording();
+    m_ImmediateContextId = ~0u;
+}
+
+void RecordingDeviceContext::ExecuteCommandLists(Uint32 NumCommandLists, ICommandList* const* ppCommandLists)
+{
+    DEV_ERROR("Only immediate contexts can execute command lists");
+}
+
+void RecordingDeviceContext::EnqueueSignal(IFence* pFence, Uint64 Value)
+{
+    DEV_ERROR("Fences can only be signaled by immediate contexts");
+}
+
+void RecordingDeviceContext::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    DEV_ERROR("Fences can only be waited for by immediate contexts");
+}
+
+void RecordingDeviceContext::WaitForIdle()
+{
+    DEV_ERROR("Only immediate contexts can be idled");
+}
+
+void RecordingDeviceContext::BeginQuery(IQuery* pQuery)
+{
+    Record(BeginQueryCmd{KeepAlive(pQuery)});
+}
+
+void RecordingDeviceContext::EndQuery(IQuery* pQuery)
+{
+    Record(EndQueryCmd{KeepAlive(pQuery)});
+}
+
+void RecordingDeviceContext::BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    Record(BeginPoolQueryCmd{KeepAlive(pQueryPool), Index});
+}
+
+void RecordingDeviceContext::EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    Record(EndPoolQueryCmd{KeepAlive(pQueryPool), Index});
+}
+
+void RecordingDeviceContext::ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs)
+{
+    KeepAlive(Attribs.pQueryPool);
+    KeepAlive(Attribs.pDstBuffer);
+    Record(ResolvePoolQueriesCmd{Attribs});
+}
+
+void RecordingDeviceContext::Flush()
+{
+    DEV_ERROR("Flush() should only be called for immediate contexts");
+}
+
+void RecordingDeviceContext::UpdateBuffer(IBuffer*                       pBuffer,
+                                          Uint64                         Offset,
+                                          Uint64                         Size,
+                                          const void*                    pData,
+                                          RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    DEV_CHECK_ERR(pData != nullptr || Size == 0, "pData must not be null");
+
+    void* pDataCopy = nullptr;
+    if (Size > 0)
+    {
+        pDataCopy = m_pData->Allocate(StaticCast<size_t>(Size), 16);
+        std::memcpy(pDataCopy, pData, StaticCast<size_t>(Size));
+    }
+    Record(UpdateBufferCmd{KeepAlive(pBuffer), Offset, Size, pDataCopy, StateTransitionMode});
+}
+
+void RecordingDeviceContext::CopyBuffer(IBuffer*                       pSrcBuffer,
+                                        Uint64                         SrcOffset,
+                                        RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                        IBuffer*                       pDstBuffer,
+                                        Uint64                         DstOffset,
+                                        Uint64                         Size,
+                                        RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    Record(CopyBufferCmd{KeepAlive(pSrcBuffer), SrcOffset, SrcBufferTransitionMode, KeepAlive(pDstBuffer), DstOffset, Size, DstBufferTransitionMode});
+}
+
+void RecordingDeviceContext::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
+{
+    pMappedData = nullptr;
+    DEV_CHECK_ERR(pBuffer != nullptr, "Buffer must not be null");
+    if (MapType != MAP_WRITE || (MapFlags & MAP_FLAG_DISCARD) == 0)
+    {
+        DEV_ERROR("Recording contexts only support mapping buffers with MAP_WRITE and MAP_FLAG_DISCARD");
+        return;
+    }
+
+    const Uint64 Size = pBuffer->GetDesc().Size;
+
+    // The data is written into the command list and uploaded into the buffer during the replay.
+    MappedBufferInfo MappedBuffer;
+    MappedBuffer.pBuffer = KeepAlive(pBuffer);
+    MappedBuffer.pData   = m_pData->Allocate(StaticCast<size_t>(Size), 16);
+    MappedBuffer.Size    = Size;
+    m_MappedBuffers.push_back(MappedBuffer);
+
+    pMappedData = MappedBuffer.pData;
+}
+
+void RecordingDeviceContext::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
+{
+    auto it = std::find_if(m_MappedBuffers.begin(), m_MappedBuffers.end(),
+                           [pBuffer](const MappedBufferInfo& Info) { return Info.pBuffer == pBuffer; });
+    if (it == m_MappedBuffers.end())
+    {
+        DEV_ERROR("Buffer '", (pBuffer != nullptr ? pBuffer->GetDesc().Name : "<null>"), "' is not mapped");
+        return;
+    }
+
+    Record(WriteMappedBufferCmd{it->pBuffer, it->pData, it->Size});
+    m_MappedBuffers.erase(it);
+}
+
+void RecordingDeviceContext::UpdateTexture(ITexture*                      pTexture,
+                                           Uint32                         MipLevel,
+                                           Uint32                         Slice,
+                                           const Box&                     DstBox,
+                                           const TextureSubResData&       SubresData,
+                                           RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                           RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode)
+{
+    DEV_CHECK_ERR(pTexture != nullptr, "Texture must not be null");
+
+    UpdateTextureCmd Cmd{KeepAlive(pTexture), MipLevel, Slice, DstBox, SubresData, SrcBufferTransitionMode, TextureTransitionMode};
+    if (SubresData.pSrcBuffer != nullptr)
+    {
+        KeepAlive(SubresData.pSrcBuffer);
+    }
+    else if (SubresData.pData != nullptr)
+    {
+        const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(pTexture->GetDesc().Format);
+
+        const bool   IsCompressed = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED;
+        const Uint32 BlockWidth   = IsCompressed ? FmtAttribs.BlockWidth : 1;
+        const Uint32 BlockHeight  = IsCompressed ? FmtAttribs.BlockHeight : 1;
+        const Uint64 RowSize      = Uint64{(DstBox.Width() + BlockWidth - 1) / BlockWidth} * FmtAttribs.GetElementSize();
+        const Uint32 NumRows      = (DstBox.Height() + BlockHeight - 1) / BlockHeight;
+        const Uint32 Depth        = std::max(DstBox.Depth(), 1u);
+
+        // Copy exactly the memory range that the immediate context will read
+        const Uint64 DataSize = (NumRows > 0 && RowSize > 0) ?
+            SubresData.DepthStride * (Depth - 1) + SubresData.Stride * (NumRows - 1) + RowSize :
+            0;
+        if (DataSize > 0)
+        {
+            void* pDataCopy = m_pData->Allocate(StaticCast<size_t>(DataSize), 16);
+            std::memcpy(pDataCopy, SubresData.pData, StaticCast<size_t>(DataSize));
+            Cmd.SubresData.pData = pDataCopy;
+        }
+    }
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    CopyTextureCmd Cmd{CopyAttribs};
+    KeepAlive(CopyAttribs.pSrcTexture);
+    KeepAlive(CopyAttribs.pDstTexture);
+    Cmd.Attribs.pSrcBox = CopyArray(CopyAttribs.pSrcBox, 1);
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::MapTextureSubresource(ITexture*                 pTexture,
+                                                   Uint32                    MipLevel,
+                                                   Uint32                    ArraySlice,
+                                                   MAP_TYPE                  MapType,
+                                                   MAP_FLAGS                 MapFlags,
+                                                   const Box*                pMapRegion,
+                                                   MappedTextureSubresource& MappedData)
+{
+    DEV_ERROR("Recording contexts do not support mapping textures. Use UpdateTexture() instead.");
+    MappedData = MappedTextureSubresource{};
+}
+
+void RecordingDeviceContext::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
+{
+    DEV_ERROR("Recording contexts do not support mapping textures");
+}
+
+void RecordingDeviceContext::GenerateMips(ITextureView* pTextureView, GENERATE_MIPS_FLAGS Flags)
+{
+    Record(GenerateMipsCmd{KeepAlive(pTextureView), Flags});
+}
+
+void RecordingDeviceContext::FinishFrame()
+{
+    ++m_FrameNumber;
+}
+
+void RecordingDeviceContext::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
+{
+    if (BarrierCount == 0)
+        return;
+    DEV_CHECK_ERR(pResourceBarriers != nullptr, "pResourceBarriers must not be null when BarrierCount is not zero");
+
+    for (Uint32 i = 0; i < BarrierCount; ++i)
+    {
+        KeepAlive(pResourceBarriers[i].pResourceBefore);
+        KeepAlive(pResourceBarriers[i].pResource);
+    }
+    Record(TransitionResourceStatesCmd{BarrierCount, m_pData->CopyArray(pResourceBarriers, BarrierCount)});
+}
+
+void RecordingDeviceContext::ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                       ITexture*                               pDstTexture,
+                                                       const ResolveTextureSubresourceAttribs& ResolveAttribs)
+{
+    Record(ResolveTextureSubresourceCmd{KeepAlive(pSrcTexture), KeepAlive(pDstTexture), ResolveAttribs});
+}
+
+void RecordingDeviceContext::BuildBLAS(const BuildBLASAttribs& Attribs)
+{
+    UNSUPPORTED("Ray tracing is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::BuildTLAS(const BuildTLASAttribs& Attribs)
+{
+    UNSUPPORTED("Ray tracing is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::CopyBLAS(const CopyBLASAttribs& Attribs)
+{
+    UNSUPPORTED("Ray tracing is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::CopyTLAS(const CopyTLASAttribs& Attribs)
+{
+    UNSUPPORTED("Ray tracing is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("Ray tracing is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("Ray tracing is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::TraceRays(const TraceRaysAttribs& Attribs)
+{
+    UNSUPPORTED("Ray tracing is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("Ray tracing is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs)
+{
+    UNSUPPORTED("Ray tracing is not supported by recording contexts");
+}
+
+void RecordingDeviceContext::BeginDebugGroup(const Char* Name, const float* pColor)
+{
+    BeginDebugGroupCmd Cmd{};
+    Cmd.Name     = m_pData->CopyString(Name != nullptr ? Name : "");
+    Cmd.HasColor = pColor != nullptr;
+    if (pColor != nullptr)
+        std::copy(pColor, pColor + 4, Cmd.Color);
+    Record(Cmd);
+}
+
+void RecordingDeviceContext::EndDebugGroup()
+{
+    Record(EndDebugGroupCmd{});
+}
+
+void RecordingDeviceContext::InsertDebugLabel(const Char* Label, const float* pColor)
+{
+    InsertDebugLabelCmd Cmd{};
+    Cmd.Label    = m_pData->CopyString(Label != nullptr ? Label : "");
+    Cmd.HasColor = pColor != nullptr;
+    if (pColor != nullptr)
+        std::copy(pColor, pColor + 4, Cmd.Color);
+    Record(Cmd);
+}
+
+ICommandQueue* RecordingDeviceContext::LockCommandQueue()
+{
+    DEV_ERROR("Recording contexts do not have command queues");
+    return nullptr;
+}
+
+void RecordingDeviceContext::UnlockCommandQueue()
+{
+    DEV_ERROR("Recording contexts do not have command queues");
+}
+
+void RecordingDeviceContext::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_COMBINER PrimitiveCombiner, SHADING_RATE_COMBINER TextureCombiner)
+{
+    Record(SetShadingRateCmd{BaseRate, PrimitiveCombiner, TextureCombiner});
+}
+
+void RecordingDeviceContext::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
+{
+    UNSUPPORTED("Sparse resources are not supported by recording contexts");
+}
+
+} // namespace Diligent
@@ -120,9 +120,14 @@ DeviceFeatures EnableDeviceFeatures(const DeviceFeatures& SupportedFeatures,
     ENABLE_FEATURE(NativeMultiDraw,                   "Native multi-draw commands are");
     ENABLE_FEATURE(AsyncShaderCompilation,            "Async shader compilation is");
     ENABLE_FEATURE(FormattedBuffers,                  "Formatted buffers are");
+    ENABLE_FEATURE(SpecializationConstants,           "Specialization constants are");
+    ENABLE_FEATURE(ExtendedDynamicState,              "Extended dynamic state is");
+    ENABLE_FEATURE(GPUUploadMemory,                   "GPU upload memory is");
+    ENABLE_FEATURE(Multiview,                         "Multiview is");
+    ENABLE_FEATURE(ExternalMemory,                    "External memory is");
     // clang-format on
 
-    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeatures, 52, "Did you add a new feature to DeviceFeatures? Please handle its status here (if necessary).");
 
     return EnabledFeatures;
 }
@@ -134,8 +139,10 @@ DeviceFeaturesVk EnableDeviceFeaturesVk(const DeviceFeaturesVk& SupportedFeature
 
     ENABLE_FEATURE(DynamicRendering, "VK_KHR_dynamic_rendering is");
     ENABLE_FEATURE(HostImageCopy, "VK_EXT_host_image_copy is");
+    ENABLE_FEATURE(DescriptorBuffer, "VK_EXT_descriptor_buffer is");
+    ENABLE_FEATURE(ShaderObject, "VK_EXT_shader_object is");
 
-    ASSERT_SIZEOF(DeviceFeaturesVk, 2, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeaturesVk, 4, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
 
     return EnabledFeatures;
 }
@@ -404,6 +404,40 @@ void ValidateRenderPassDesc(const RenderPassDesc&      Desc,
                 }
             }
         }
+
+        if ((Subpass.ViewMask != 0) != (Desc.pSubpasses[0].ViewMask != 0))
+        {
+            LOG_RENDER_PASS_ERROR_AND_THROW("subpass ", subpass, (Subpass.ViewMask != 0 ? " uses" : " does not use"), " a view mask, while subpass 0",
+                                            (Subpass.ViewMask != 0 ? " does not" : " does"), ". Either all subpasses must use multiview or none.");
+        }
+
+        if (Subpass.ViewMask != 0)
+        {
+            if (!Features.Multiview)
+                LOG_RENDER_PASS_ERROR_AND_THROW("subpass ", subpass, " uses a view mask, but Multiview device feature is not enabled");
+
+            if (DeviceInfo.Type == RENDER_DEVICE_TYPE_D3D12 && Subpass.ViewMask >= (1u << 4u))
+            {
+                // D3D12_MAX_VIEW_INSTANCE_COUNT
+                LOG_RENDER_PASS_ERROR_AND_THROW("view mask ", Subpass.ViewMask, " of subpass ", subpass,
+                                                " uses views beyond 3. Direct3D12 view instancing supports at most 4 views.");
+            }
+
+            if (DeviceInfo.IsGLDevice() && (Subpass.ViewMask & (Subpass.ViewMask + 1)) != 0)
+            {
+                // glFramebufferTextureMultiviewOVR only takes a contiguous range of views, and gl_ViewID_OVR
+                // is counted from the first view. Requiring the range to start at 0 keeps view indices
+                // consistent with other backends.
+                LOG_RENDER_PASS_ERROR_AND_THROW("view mask ", Subpass.ViewMask, " of subpass ", subpass,
+                                                " is not supported in OpenGL: the mask must be a contiguous range of bits starting from bit 0.");
+            }
+
+            if (DeviceInfo.IsGLDevice() && Subpass.pResolveAttachments != nullptr)
+            {
+                // Resolve is performed with glBlitFramebuffer that only copies the first layer
+                LOG_RENDER_PASS_ERROR_AND_THROW("subpass ", subpass, " uses a view mask and resolve attachments, which is not supported in OpenGL.");
+            }
+        }
     }
 
     if (pShadingRateAttachment != nullptr && (SRProps.CapFlags & SHADING_RATE_CAP_FLAG_SAME_TEXTURE_FOR_WHOLE_RENDERPASS) != SHADING_RATE_CAP_FLAG_NONE)
@@ -26,6 +26,9 @@
  */
 
 #include "ResourceMappingImpl.hpp"
+
+#include <algorithm>
+
 #include "DeviceObjectBase.hpp"
 
 namespace Diligent
@@ -40,6 +43,8 @@ void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex,
     if (Name == nullptr || *Name == 0)
         return;
 
+    const Uint32 NameId = ResourceNameRegistry::Get().Intern(Name);
+
     Threading::SpinLockGuard Guard{m_Lock};
     for (Uint32 Elem = 0; Elem < NumElements; ++Elem)
     {
@@ -60,6 +65,7 @@ void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex,
             }
             Elems.first->second = pObject;
         }
+        SetNameIdTableElement(NameId, StartIndex + Elem, pObject);
     }
 }
 
@@ -73,10 +79,13 @@ void ResourceMappingImpl::RemoveResourceByName(const Char* Name, Uint32 ArrayInd
     if (*Name == 0)
         return;
 
+    const Uint32 NameId = ResourceNameRegistry::Get().Find(Name);
+
     Threading::SpinLockGuard Guard{m_Lock};
     // Remove object with the given name
     // Name will be implicitly converted to HashMapStringKey without making a copy
-    m_HashTable.erase(ResMappingHashKey{Name, false, ArrayIndex});
+    if (m_HashTable.erase(ResMappingHashKey{Name, false, ArrayIndex}) != 0)
+        SetNameIdTableElement(NameId, ArrayIndex, nullptr);
 }
 
 IDeviceObject* ResourceMappingImpl::GetResource(const Char* Name, Uint32 ArrayIndex)
@@ -99,4 +108,47 @@ size_t ResourceMappingImpl::GetSize()
     return m_HashTable.size();
 }
 
+void ResourceMappingImpl::SetNameIdTableElement(Uint32 NameId, Uint32 ArrayIndex, IDeviceObject* pObject)
+{
+    if (NameId >= MaxNameIds)
+        return; // GetResourceById() falls back to the name lookup
+
+    std::atomic<NameIdPage*>& PageSlot = m_NameIdPages[NameId / NameIdPageSize];
+
+    NameIdPage* pPage = PageSlot.load(std::memory_order_relaxed);
+    if (pPage == nullptr)
+    {
+        if (pObject == nullptr)
+            return;
+        m_OwnedPages.emplace_back(new NameIdPage{});
+        pPage = m_OwnedPages.back().get();
+        PageSlot.store(pPage, std::memory_order_release);
+    }
+
+    std::atomic<ResourceArray*>& ArraySlot = pPage->Arrays[NameId % NameIdPageSize];
+
+    ResourceArray* pArray = ArraySlot.load(std::memory_order_relaxed);
+    if (pArray == nullptr || ArrayIndex >= pArray->Size)
+    {
+        if (pObject == nullptr)
+            return;
+
+        // Grow the array geometrically to limit the number of retired arrays
+        const Uint32 NewSize = std::max(ArrayIndex + 1, pArray != nullptr ? pArray->Size * 2 : 1u);
+
+        m_OwnedArrays.emplace_back(new ResourceArray{NewSize});
+        ResourceArray* pNewArray = m_OwnedArrays.back().get();
+        if (pArray != nullptr)
+        {
+            for (Uint32 i = 0; i < pArray->Size; ++i)
+                pNewArray->Objects[i].store(pArray->Objects[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        // The old array stays alive in m_OwnedArrays as readers may still access it
+        ArraySlot.store(pNewArray, std::memory_order_release);
+        pArray = pNewArray;
+    }
+
+    pArray->Objects[ArrayIndex].store(pObject, std::memory_order_release);
+}
+
 } // namespace Diligent
@@ -164,6 +164,30 @@ void ValidateTextureDesc(const TextureDesc& Desc, const IRenderDevice* pDevice)
             LOG_TEXTURE_ERROR_AND_THROW("Memoryless attachment is not compatible with mipmap generation.");
     }
 
+    if (Desc.MiscFlags & MISC_TEXTURE_FLAG_EXPORTABLE)
+    {
+        if (!DeviceInfo.Features.ExternalMemory)
+            LOG_TEXTURE_ERROR_AND_THROW("Exportable textures require ExternalMemory feature.");
+
+        if (Desc.Usage != USAGE_DEFAULT)
+            LOG_TEXTURE_ERROR_AND_THROW("Exportable textures require USAGE_DEFAULT.");
+
+        if (Desc.MiscFlags & MISC_TEXTURE_FLAG_MEMORYLESS)
+            LOG_TEXTURE_ERROR_AND_THROW("Memoryless textures can't be exported.");
+    }
+
+    if (Desc.MiscFlags & MISC_TEXTURE_FLAG_CONSTANT_STATE)
+    {
+        if (Desc.BindFlags != BIND_SHADER_RESOURCE)
+            LOG_TEXTURE_ERROR_AND_THROW("Textures with constant state must use BIND_SHADER_RESOURCE as the only bind flag.");
+
+        if (Desc.Usage != USAGE_IMMUTABLE && Desc.Usage != USAGE_DEFAULT)
+            LOG_TEXTURE_ERROR_AND_THROW("Textures with constant state require USAGE_IMMUTABLE or USAGE_DEFAULT.");
+
+        if (Desc.MiscFlags & MISC_TEXTURE_FLAG_GENERATE_MIPS)
+            LOG_TEXTURE_ERROR_AND_THROW("MISC_TEXTURE_FLAG_CONSTANT_STATE is not compatible with mipmap generation.");
+    }
+
     if (Desc.Usage == USAGE_STAGING)
     {
         if (Desc.BindFlags != 0)
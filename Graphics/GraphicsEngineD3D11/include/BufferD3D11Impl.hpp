@@ -35,6 +35,7 @@
 #include "EngineD3D11ImplTraits.hpp"
 #include "BufferBase.hpp"
 #include "ResourceD3D11Base.hpp"
+#include "DynamicConstantRingD3D11.hpp"
 
 namespace Diligent
 {
@@ -87,6 +88,15 @@ public:
             m_State = RESOURCE_STATE_UNDEFINED;
     }
 
+    /// Returns true if the buffer memory is suballocated from the dynamic constant ring
+    /// when the buffer is mapped in the immediate context (see Diligent::DynamicConstantRingD3D11).
+    bool UsesDynamicConstantRing() const { return m_UsesDynamicConstantRing; }
+
+    /// Returns the current dynamic constant ring allocation of the buffer in the immediate context.
+    /// The allocation is empty if the buffer has not been mapped yet, in which case its
+    /// contents are stored in the d3d11 buffer object.
+    const DynamicConstantRingD3D11::Allocation& GetDynamicConstantRingAllocation() const { return m_DynamicConstantRingAlloc; }
+
 private:
     virtual void CreateViewInternal(const struct BufferViewDesc& ViewDesc, IBufferView** ppView, bool bIsDefaultView) override;
 
@@ -95,6 +105,10 @@ private:
 
     friend class DeviceContextD3D11Impl;
     CComPtr<ID3D11Buffer> m_pd3d11Buffer; ///< D3D11 buffer object
+
+    bool m_UsesDynamicConstantRing = false;
+
+    DynamicConstantRingD3D11::Allocation m_DynamicConstantRingAlloc;
 };
 
 } // namespace Diligent
@@ -41,6 +41,8 @@
 #include "FramebufferD3D11Impl.hpp"
 #include "RenderPassD3D11Impl.hpp"
 #include "DisjointQueryPool.hpp"
+#include "DrawIndirectCountEmulatorD3D11.hpp"
+#include "DynamicConstantRingD3D11.hpp"
 #include "BottomLevelASBase.hpp"
 #include "TopLevelASBase.hpp"
 #include "ShaderResourceBindingD3D11Impl.hpp"
@@ -61,7 +63,7 @@ public:
     virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
 
     /// Implementation of IDeviceContext::Begin() in Direct3D11 backend.
-    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::SetPipelineState() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
@@ -79,6 +81,17 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetCullMode() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode) override final;
+
+    /// Implementation of IDeviceContext::SetDepthState() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE SetDepthState(Bool                DepthEnable,
+                                                  Bool                DepthWriteEnable,
+                                                  COMPARISON_FUNCTION DepthFunc) override final;
+
+    /// Implementation of IDeviceContext::SetPrimitiveTopology() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -127,6 +140,8 @@ public:
     virtual void DILIGENT_CALL_TYPE DrawIndirect(const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::ExecuteIndirectCommands() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawMesh() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE DrawMesh(const DrawMeshAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawMeshIndirect() in Direct3D11 backend.
@@ -151,6 +166,9 @@ public:
     /// Implementation of IDeviceContext::ClearRenderTarget() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE ClearRenderTarget(ITextureView* pView, const void* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateRenderTargets() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                                  Uint64                         Offset,
@@ -198,7 +216,7 @@ public:
     virtual void DILIGENT_CALL_TYPE UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice) override final;
 
     /// Implementation of IDeviceContext::GenerateMips() in Direct3D11 backend.
-    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTextureView) override final;
+    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTextureView, GENERATE_MIPS_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::FinishFrame() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE FinishFrame() override final;
@@ -233,6 +251,15 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::BeginPoolQuery() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::EndPoolQuery() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::ResolvePoolQueries() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs) override final;
+
     /// Implementation of IDeviceContext::Flush() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -352,6 +379,17 @@ private:
     /// Prepares for an indexed draw command
     __forceinline void PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType);
 
+    /// Replaces the indirect draw arguments with the arguments of MaxDrawCount draws, of which
+    /// only the draws with indices less than the value in the counter buffer are not empty.
+    /// Returns false if there is nothing to draw or the emulation failed.
+    bool EmulateIndirectDrawCount(IBuffer*       pCounterBuffer,
+                                  Uint64         CounterOffset,
+                                  Uint32         MaxDrawCount,
+                                  Uint32         ArgsSize,
+                                  ID3D11Buffer*& pd3d11ArgsBuff,
+                                  Uint64&        DrawArgsOffset,
+                                  Uint32&        DrawArgsStride);
+
     /// Performs operations required to begin current subpass (e.g. bind render targets)
     void BeginSubpass();
     /// Ends current subpass
@@ -435,6 +473,9 @@ private:
     void BindDynamicCBs(const ShaderResourceCacheD3D11&    ResourceCache,
                         const D3D11ShaderResourceCounters& BaseBindings);
 
+    // Sets constant buffers, SRVs and samplers marked in m_PendingBinds in the device context
+    void CommitPendingBindings();
+
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources();
 #endif
@@ -460,6 +501,22 @@ private:
 
     TCommittedResources m_CommittedRes;
 
+    /// Constant buffer, SRV and sampler slots that were modified by BindCacheResources() and
+    /// BindDynamicCBs(), but have not been set in the device context yet.
+    /// All SRBs are processed first, and then every stage is set with the minimal number of
+    /// calls covering only the modified slots (see CommitPendingBindings()).
+    struct PendingBindings
+    {
+        // clang-format off
+        ShaderResourceCacheD3D11::DirtySlotMask CBs     [NumShaderTypes];
+        ShaderResourceCacheD3D11::DirtySlotMask SRVs    [NumShaderTypes];
+        ShaderResourceCacheD3D11::DirtySlotMask Samplers[NumShaderTypes];
+        // clang-format on
+
+        // Stages that have at least one modified slot
+        SHADER_TYPE Stages = SHADER_TYPE_UNKNOWN;
+    } m_PendingBinds;
+
     /// An array of D3D11 vertex buffers committed to D3D device context.
     /// There is no need to keep strong references because D3D11 device context
     /// already does. Buffers cannot be destroyed while bound to the context.
@@ -504,6 +561,13 @@ private:
     DisjointQueryPool                                        m_DisjointQueryPool;
     std::shared_ptr<DisjointQueryPool::DisjointQueryWrapper> m_ActiveDisjointQuery;
 
+    /// Dynamic constant ring used to suballocate USAGE_DYNAMIC uniform buffers.
+    /// Only the immediate context has the ring; it is null if the ring is disabled.
+    std::unique_ptr<DynamicConstantRingD3D11> m_pDynamicConstantRing;
+
+    /// Emulates indirect draws with a counter buffer
+    DrawIndirectCountEmulatorD3D11 m_DrawIndirectCountEmulator;
+
     std::vector<OptimizedClearValue> m_AttachmentClearValues;
 
 #ifdef DILIGENT_DEVELOPMENT
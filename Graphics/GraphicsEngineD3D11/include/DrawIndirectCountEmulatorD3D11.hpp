@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::DrawIndirectCountEmulatorD3D11 class
+
+#include <atlbase.h>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Emulates indirect draws with a counter buffer, which Direct3D11 does not support natively.
+
+/// The draw arguments and the draw count are copied into an internal buffer, and a compute
+/// shader sets the instance count of every draw whose index is not less than the draw count
+/// to zero. The context then issues the maximum number of indirect draws from the internal
+/// buffer, and the draws beyond the count do nothing. The GPU never waits for the CPU and
+/// the count is never read back.
+class DrawIndirectCountEmulatorD3D11 final
+{
+public:
+    explicit DrawIndirectCountEmulatorD3D11(ID3D11Device* pd3d11Device) noexcept;
+
+    // clang-format off
+    DrawIndirectCountEmulatorD3D11           (const DrawIndirectCountEmulatorD3D11&) = delete;
+    DrawIndirectCountEmulatorD3D11           (DrawIndirectCountEmulatorD3D11&&)      = delete;
+    DrawIndirectCountEmulatorD3D11& operator=(const DrawIndirectCountEmulatorD3D11&) = delete;
+    DrawIndirectCountEmulatorD3D11& operator=(DrawIndirectCountEmulatorD3D11&&)      = delete;
+    // clang-format on
+
+    /// Prepares the arguments of MaxDrawCount draws, of which only the first *pCounter draws are not empty.
+
+    /// \param [in]  pd3d11Ctx          - Context to record the commands.
+    /// \param [in]  pd3d11ArgsBuff     - Buffer that contains the draw arguments.
+    /// \param [in]  ArgsOffset         - Offset of the first draw arguments.
+    /// \param [in]  ArgsStride         - Stride between the draw arguments.
+    /// \param [in]  ArgsSize           - Size of the draw arguments of one draw.
+    /// \param [in]  MaxDrawCount       - Maximum number of draws.
+    /// \param [in]  pd3d11CounterBuff  - Buffer that contains the draw count.
+    /// \param [in]  CounterOffset      - Offset of the draw count.
+    /// \param [out] EmulatedArgsOffset - Offset of the first draw arguments in the returned buffer.
+    ///
+    /// \return     The buffer to take the draw arguments from, or null if the emulation failed.
+    ///
+    /// \remarks    The compute shader, constant buffer and UAV in slot 0 of the compute stage
+    ///             are restored after the dispatch.
+    ID3D11Buffer* PrepareArgs(ID3D11DeviceContext1* pd3d11Ctx,
+                              ID3D11Buffer*         pd3d11ArgsBuff,
+                              Uint64                ArgsOffset,
+                              Uint32                ArgsStride,
+                              Uint32                ArgsSize,
+                              Uint32                MaxDrawCount,
+                              ID3D11Buffer*         pd3d11CounterBuff,
+                              Uint64                CounterOffset,
+                              Uint32&               EmulatedArgsOffset);
+
+private:
+    bool Initialize();
+    bool ReserveArgsBuffer(Uint32 Size);
+
+private:
+    CComPtr<ID3D11Device> m_pd3d11Device;
+
+    CComPtr<ID3D11ComputeShader> m_pd3d11CS;
+    CComPtr<ID3D11Buffer>        m_pd3d11ConstantBuffer;
+
+    // The draw count is stored at offset 0, and the arguments start at offset ArgsStartOffset
+    CComPtr<ID3D11Buffer>              m_pd3d11ArgsBuffer;
+    CComPtr<ID3D11UnorderedAccessView> m_pd3d11ArgsUAV;
+    Uint32                             m_ArgsBufferSize = 0;
+
+    bool m_InitializationFailed = false;
+};
+
+} // namespace Diligent
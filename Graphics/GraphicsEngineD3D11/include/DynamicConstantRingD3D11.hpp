@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::DynamicConstantRingD3D11 class
+
+#include <memory>
+#include <vector>
+#include <atlbase.h>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Ring of large dynamic constant buffers that USAGE_DYNAMIC uniform buffers are suballocated from
+/// when they are mapped in the immediate context.
+
+/// Every map of a dynamic buffer with D3D11_MAP_WRITE_DISCARD makes the driver rename the buffer memory.
+/// Instead, the ring maps its pages with D3D11_MAP_WRITE_NO_OVERWRITE and hands out consecutive ranges
+/// that are bound with *SetConstantBuffers1() first-constant offsets. A page is mapped with
+/// D3D11_MAP_WRITE_DISCARD only when the ring starts writing to it from the beginning, so the driver
+/// renames memory once per page instead of once per buffer update.
+///
+/// Allocations keep their page alive: a page is only reused when no buffer references it anymore,
+/// so the data of a buffer that has not been mapped again stays valid.
+///
+/// \note This requires D3D11_FEATURE_DATA_D3D11_OPTIONS::ConstantBufferOffsetting and
+///       D3D11_FEATURE_DATA_D3D11_OPTIONS::MapNoOverwriteOnDynamicConstantBuffer.
+class DynamicConstantRingD3D11 final
+{
+public:
+    struct Page
+    {
+        CComPtr<ID3D11Buffer> pd3d11Buffer;
+        Uint32                Size = 0;
+    };
+
+    struct Allocation
+    {
+        std::shared_ptr<Page> pPage;
+        Uint32                Offset = 0;
+
+        explicit operator bool() const
+        {
+            return pPage != nullptr;
+        }
+    };
+
+    /// Required alignment of the allocation offsets.
+
+    /// Offsets passed to *SetConstantBuffers1() are measured in shader constants (16 bytes)
+    /// and must be a multiple of 16 constants.
+    static constexpr Uint32 OffsetAlignment = 256;
+
+    DynamicConstantRingD3D11(ID3D11Device* pd3d11Device, Uint32 PageSize) noexcept;
+    ~DynamicConstantRingD3D11();
+
+    // clang-format off
+    DynamicConstantRingD3D11           (const DynamicConstantRingD3D11&)  = delete;
+    DynamicConstantRingD3D11           (      DynamicConstantRingD3D11&&) = delete;
+    DynamicConstantRingD3D11& operator=(const DynamicConstantRingD3D11&)  = delete;
+    DynamicConstantRingD3D11& operator=(      DynamicConstantRingD3D11&&) = delete;
+    // clang-format on
+
+    /// Releases the previous allocation, allocates Size bytes from the ring and maps them for writing.
+    /// Returns the pointer to the mapped memory, or null if the allocation failed, in which case
+    /// Alloc is left empty.
+    void* Allocate(ID3D11DeviceContext* pd3d11Ctx, Uint32 Size, Allocation& Alloc);
+
+    /// Maps the existing allocation again without discarding its contents.
+    void* Remap(ID3D11DeviceContext* pd3d11Ctx, const Allocation& Alloc);
+
+    /// Unmaps the page of the allocation.
+    void Unmap(ID3D11DeviceContext* pd3d11Ctx, const Allocation& Alloc);
+
+private:
+    std::shared_ptr<Page> FindOrCreatePage(Uint32 RequiredSize);
+
+    void* MapPage(ID3D11DeviceContext* pd3d11Ctx, const Allocation& Alloc, D3D11_MAP MapType);
+
+    CComPtr<ID3D11Device> m_pd3d11Device;
+
+    const Uint32 m_PageSize;
+
+    std::vector<std::shared_ptr<Page>> m_Pages;
+
+    std::shared_ptr<Page> m_pCurrPage;
+    Uint32                m_CurrOffset = 0;
+};
+
+} // namespace Diligent
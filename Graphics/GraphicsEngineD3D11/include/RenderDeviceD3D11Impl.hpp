@@ -91,6 +91,13 @@ public:
     virtual void DILIGENT_CALL_TYPE CreateQuery(const QueryDesc& Desc,
                                                 IQuery**         ppQuery) override final;
 
+    /// Implementation of IRenderDevice::CreateQueryPool() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool) override final;
+
+    /// Implementation of IRenderDevice::CreateIndirectCommandSignature() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc,
+                                                                   IIndirectCommandSignature**         ppSignature) override final;
+
     /// Implementation of IRenderDevice::CreateRenderPass() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE CreateRenderPass(const RenderPassDesc& Desc,
                                                      IRenderPass**         ppRenderPass) override final;
@@ -128,6 +135,18 @@ public:
     virtual void DILIGENT_CALL_TYPE CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
                                                        IDeviceMemory**               ppMemory) override final;
 
+    /// Implementation of IRenderDevice::CreatePlacedTexture() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE CreatePlacedTexture(const TextureDesc& TexDesc,
+                                                        IDeviceMemory*     pMemory,
+                                                        Uint64             MemoryOffset,
+                                                        ITexture**         ppTexture) override final;
+
+    /// Implementation of IRenderDevice::CreatePlacedBuffer() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE CreatePlacedBuffer(const BufferDesc& BuffDesc,
+                                                       IDeviceMemory*    pMemory,
+                                                       Uint64            MemoryOffset,
+                                                       IBuffer**         ppBuffer) override final;
+
     /// Implementation of IRenderDevice::CreatePipelineStateCache() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                              IPipelineStateCache**               ppPSOCache) override final;
@@ -167,6 +186,12 @@ public:
                                                                                   RESOURCE_DIMENSION Dimension,
                                                                                   Uint32             SampleCount) const override final;
 
+    /// Implementation of IRenderDevice::GetTextureMemoryRequirements() in Direct3D11 backend.
+    virtual ResourceMemoryRequirements DILIGENT_CALL_TYPE GetTextureMemoryRequirements(const TextureDesc& TexDesc) const override final;
+
+    /// Implementation of IRenderDevice::GetBufferMemoryRequirements() in Direct3D11 backend.
+    virtual ResourceMemoryRequirements DILIGENT_CALL_TYPE GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const override final;
+
     size_t GetCommandQueueCount() const { return 1; }
     Uint64 GetCommandQueueMask() const { return Uint64{1}; }
 
@@ -196,6 +221,9 @@ public:
     struct Properties
     {
         D3D11_VALIDATION_FLAGS D3D11ValidationFlags = D3D11_VALIDATION_FLAG_NONE;
+
+        /// Dynamic constant ring page size, or 0 if the ring is disabled or not supported by the device.
+        Uint32 DynamicConstantRingPageSize = 0;
     };
 
     const Properties& GetProperties() const { return m_Properties; }
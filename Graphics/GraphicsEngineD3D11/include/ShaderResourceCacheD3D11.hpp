@@ -45,6 +45,7 @@
 #include "SamplerD3D11Impl.hpp"
 
 #include "Align.hpp"
+#include "PlatformMisc.hpp"
 
 namespace Diligent
 {
@@ -138,6 +139,33 @@ public:
             return pBuff && RangeSize != 0 && RangeSize < pBuff->GetDesc().Size;
         }
 
+        // Returns true if the binding of the constant buffer may change without updating the cache,
+        // i.e. the buffer allows setting dynamic offset or it is suballocated from the dynamic
+        // constant ring every time it is mapped (see BufferD3D11Impl::UsesDynamicConstantRing()).
+        bool IsDynamic() const
+        {
+            return AllowsDynamicOffset() || (pBuff && pBuff->UsesDynamicConstantRing());
+        }
+
+        // Returns the d3d11 buffer to bind and the first constant to bind it with.
+        // If UseDynamicConstantRing is true and the buffer has been suballocated from the
+        // dynamic constant ring, returns the ring page instead of pd3d11Buff.
+        __forceinline ID3D11Buffer* GetD3D11Binding(ID3D11Buffer* pd3d11Buff, bool UseDynamicConstantRing, UINT& FirstConstant) const
+        {
+            Uint32 Offset = BaseOffset + DynamicOffset;
+            if (UseDynamicConstantRing && pBuff && pBuff->UsesDynamicConstantRing())
+            {
+                if (const DynamicConstantRingD3D11::Allocation& Alloc = pBuff->GetDynamicConstantRingAllocation())
+                {
+                    Offset += Alloc.Offset;
+                    pd3d11Buff = Alloc.pPage->pd3d11Buffer;
+                }
+            }
+            // Offsets in Direct3D11 are measured in float4 constants.
+            FirstConstant = Offset / 16u;
+            return pd3d11Buff;
+        }
+
         // Returns ID3D11Buffer
         template <D3D11_RESOURCE_RANGE ResRange>
         typename CachedResourceTraits<ResRange>::D3D11ResourceType* GetD3D11Resource();
@@ -343,22 +371,82 @@ public:
         }
     };
 
+    /// Bit mask of committed slots whose bindings changed and need to be set in the device context.
+    struct DirtySlotMask
+    {
+        static constexpr UINT NumSlots = D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT;
+        static constexpr UINT NumWords = (NumSlots + 63) / 64;
+
+        Uint64 Bits[NumWords] = {};
+
+        void Set(UINT Slot)
+        {
+            VERIFY_EXPR(Slot < NumSlots);
+            Bits[Slot / 64] |= Uint64{1} << (Slot % 64);
+        }
+
+        /// Calls Handler(StartSlot, NumSlots) for every contiguous range of dirty slots
+        /// and clears the mask.
+        template <typename HandlerType>
+        void ProcessRanges(HandlerType&& Handler)
+        {
+            UINT Slot = 0;
+            while (Slot < NumSlots)
+            {
+                // Find the first dirty slot
+                UINT   w    = Slot / 64;
+                Uint64 Word = Bits[w] & (~Uint64{0} << (Slot % 64));
+                if (Word == 0)
+                {
+                    Slot = (w + 1) * 64;
+                    continue;
+                }
+                const UINT Start = w * 64 + PlatformMisc::GetLSB(Word);
+
+                // Find the first clean slot after it
+                Slot = Start;
+                while (Slot < NumSlots)
+                {
+                    w    = Slot / 64;
+                    Word = ~Bits[w] & (~Uint64{0} << (Slot % 64));
+                    if (Word != 0)
+                    {
+                        Slot = w * 64 + PlatformMisc::GetLSB(Word);
+                        break;
+                    }
+                    Slot = (w + 1) * 64;
+                }
+                if (Slot > NumSlots)
+                    Slot = NumSlots;
+
+                Handler(Start, Slot - Start);
+            }
+
+            for (UINT w = 0; w < NumWords; ++w)
+                Bits[w] = 0;
+        }
+    };
+
     template <D3D11_RESOURCE_RANGE Range>
     inline MinMaxSlot BindResources(Uint32                                                   ShaderInd,
                                     typename CachedResourceTraits<Range>::D3D11ResourceType* CommittedD3D11Resources[],
-                                    const D3D11ShaderResourceCounters&                       BaseBindings) const;
+                                    const D3D11ShaderResourceCounters&                       BaseBindings,
+                                    DirtySlotMask*                                           pDirtySlots = nullptr) const;
 
     template <D3D11_RESOURCE_RANGE Range>
     inline MinMaxSlot BindResourceViews(Uint32                                                   ShaderInd,
                                         typename CachedResourceTraits<Range>::D3D11ResourceType* CommittedD3D11Views[],
                                         ID3D11Resource*                                          CommittedD3D11Resources[],
-                                        const D3D11ShaderResourceCounters&                       BaseBindings) const;
+                                        const D3D11ShaderResourceCounters&                       BaseBindings,
+                                        DirtySlotMask*                                           pDirtySlots = nullptr) const;
 
     inline MinMaxSlot BindCBs(Uint32                             ShaderInd,
                               ID3D11Buffer*                      CommittedD3D11Resources[],
                               UINT                               FirstConstants[],
                               UINT                               NumConstants[],
-                              const D3D11ShaderResourceCounters& BaseBindings) const;
+                              const D3D11ShaderResourceCounters& BaseBindings,
+                              bool                               UseDynamicConstantRing,
+                              DirtySlotMask*                     pDirtySlots = nullptr) const;
 
     template <typename BindHandlerType>
     inline void BindDynamicCBs(Uint32                             ShaderInd,
@@ -366,6 +454,7 @@ public:
                                UINT                               FirstConstants[],
                                UINT                               NumConstants[],
                                const D3D11ShaderResourceCounters& BaseBindings,
+                               bool                               UseDynamicConstantRing,
                                BindHandlerType&&                  BindHandler) const;
 
     enum class StateTransitionMode
@@ -474,7 +563,8 @@ private:
     // Indicates which slots may contain constant buffers with dynamic offsets
     std::array<Uint16, NumShaderTypes> m_DynamicCBSlotsMask{};
 
-    // Indicates which slots actually contain constant buffers with dynamic offsets
+    // Indicates which slots actually contain dynamic constant buffers that need to be rebound
+    // before every draw command (see CachedCB::IsDynamic())
     std::array<Uint16, NumShaderTypes> m_DynamicCBOffsetsMask{};
     static_assert(sizeof(m_DynamicCBOffsetsMask[0]) * 8 >= D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, "Not enough bits for all dynamic buffer slots");
 
@@ -567,7 +657,8 @@ template <D3D11_RESOURCE_RANGE Range>
 inline ShaderResourceCacheD3D11::MinMaxSlot ShaderResourceCacheD3D11::BindResources(
     Uint32                                                   ShaderInd,
     typename CachedResourceTraits<Range>::D3D11ResourceType* CommittedD3D11Resources[],
-    const D3D11ShaderResourceCounters&                       BaseBindings) const
+    const D3D11ShaderResourceCounters&                       BaseBindings,
+    DirtySlotMask*                                           pDirtySlots) const
 {
     const Uint32 ResCount    = GetResourceCount<Range>(ShaderInd);
     const auto   ResArrays   = GetConstResourceArrays<Range>(ShaderInd);
@@ -578,7 +669,11 @@ inline ShaderResourceCacheD3D11::MinMaxSlot ShaderResourceCacheD3D11::BindResour
     {
         const Uint32 Slot = BaseBinding + res;
         if (CommittedD3D11Resources[Slot] != ResArrays.second[res])
+        {
             Slots.Add(Slot);
+            if (pDirtySlots != nullptr)
+                pDirtySlots->Set(Slot);
+        }
 
         // Note that a resource is allowed to be null if it is not used by the PSO.
         // Resources actually used by the PSO will be validated by PipelineStateD3D11Impl::DvpVerifySRBResources and
@@ -596,7 +691,8 @@ inline ShaderResourceCacheD3D11::MinMaxSlot ShaderResourceCacheD3D11::BindResour
     Uint32                                                   ShaderInd,
     typename CachedResourceTraits<Range>::D3D11ResourceType* CommittedD3D11Views[],
     ID3D11Resource*                                          CommittedD3D11Resources[],
-    const D3D11ShaderResourceCounters&                       BaseBindings) const
+    const D3D11ShaderResourceCounters&                       BaseBindings,
+    DirtySlotMask*                                           pDirtySlots) const
 {
     const Uint32 ResCount    = GetResourceCount<Range>(ShaderInd);
     const auto   ResArrays   = GetConstResourceArrays<Range>(ShaderInd);
@@ -607,7 +703,11 @@ inline ShaderResourceCacheD3D11::MinMaxSlot ShaderResourceCacheD3D11::BindResour
     {
         const Uint32 Slot = BaseBinding + res;
         if (CommittedD3D11Views[Slot] != ResArrays.second[res])
+        {
             Slots.Add(Slot);
+            if (pDirtySlots != nullptr)
+                pDirtySlots->Set(Slot);
+        }
 
         // Note that a resource is allowed to be null if it is not used by the PSO.
         // Resources actually used by the PSO will be validated by PipelineStateD3D11Impl::DvpVerifySRBResources and
@@ -625,7 +725,9 @@ inline ShaderResourceCacheD3D11::MinMaxSlot ShaderResourceCacheD3D11::BindCBs(
     ID3D11Buffer*                      CommittedD3D11Resources[],
     UINT                               FirstConstants[],
     UINT                               NumConstants[],
-    const D3D11ShaderResourceCounters& BaseBindings) const
+    const D3D11ShaderResourceCounters& BaseBindings,
+    bool                               UseDynamicConstantRing,
+    DirtySlotMask*                     pDirtySlots) const
 {
     constexpr D3D11_RESOURCE_RANGE Range = D3D11_RESOURCE_RANGE_CBV;
 
@@ -636,10 +738,9 @@ inline ShaderResourceCacheD3D11::MinMaxSlot ShaderResourceCacheD3D11::BindCBs(
     MinMaxSlot Slots;
     for (Uint32 res = 0; res < ResCount; ++res)
     {
-        const Uint32        Slot     = BaseBinding + res;
-        ID3D11Buffer* const pd3d11CB = ResArrays.second[res];
-        // Offsets in Direct3D11 are measure in float4 constants.
-        const UINT FirstCBConstant = StaticCast<UINT>((ResArrays.first[res].BaseOffset + ResArrays.first[res].DynamicOffset) / 16u);
+        const Uint32        Slot            = BaseBinding + res;
+        UINT                FirstCBConstant = 0;
+        ID3D11Buffer* const pd3d11CB        = ResArrays.first[res].GetD3D11Binding(ResArrays.second[res], UseDynamicConstantRing, FirstCBConstant);
         // The number of constants must be a multiple of 16 constants. It is OK if it is past the end of the buffer.
         const UINT NumCBConstants = StaticCast<UINT>(AlignUp(ResArrays.first[res].RangeSize / 16u, 16u));
         // clang-format off
@@ -649,6 +750,8 @@ inline ShaderResourceCacheD3D11::MinMaxSlot ShaderResourceCacheD3D11::BindCBs(
         // clang-format on
         {
             Slots.Add(Slot);
+            if (pDirtySlots != nullptr)
+                pDirtySlots->Set(Slot);
         }
 
         // Note that a constant buffer is allowed to be null if it is not used by the PSO.
@@ -669,6 +772,7 @@ inline void ShaderResourceCacheD3D11::BindDynamicCBs(Uint32
                                                      UINT                               FirstConstants[],
                                                      UINT                               NumConstants[],
                                                      const D3D11ShaderResourceCounters& BaseBindings,
+                                                     bool                               UseDynamicConstantRing,
                                                      BindHandlerType&&                  BindHandler) const
 {
     constexpr D3D11_RESOURCE_RANGE Range = D3D11_RESOURCE_RANGE_CBV;
@@ -683,10 +787,9 @@ inline void ShaderResourceCacheD3D11::BindDynamicCBs(Uint32
 
         const Uint32    Slot = BaseBinding + Binding;
         const CachedCB& CB   = ResArrays.first[Binding];
-        VERIFY_EXPR(CB.AllowsDynamicOffset() && (m_DynamicCBSlotsMask[ShaderInd] & CBBit) != 0);
-        ID3D11Buffer* const pd3d11CB = ResArrays.second[Binding];
-        // Offsets in Direct3D11 are measure in float4 constants.
-        const UINT FirstCBConstant = StaticCast<UINT>((CB.BaseOffset + CB.DynamicOffset) / 16u);
+        VERIFY_EXPR(CB.IsDynamic() && (m_DynamicCBSlotsMask[ShaderInd] & CBBit) != 0);
+        UINT                FirstCBConstant = 0;
+        ID3D11Buffer* const pd3d11CB        = CB.GetD3D11Binding(ResArrays.second[Binding], UseDynamicConstantRing, FirstCBConstant);
         // The number of constants must be a multiple of 16 constants. It is OK if it is past the end of the buffer.
         const UINT NumCBConstants = StaticCast<UINT>(AlignUp(CB.RangeSize / 16u, 16u));
         // clang-format off
@@ -736,7 +839,7 @@ inline void ShaderResourceCacheD3D11::UpdateDynamicCBOffsetFlag<D3D11_RESOURCE_R
     {
         // Only set the flag for those slots that allow dynamic buffers
         // (i.e. the variable was not created with NO_DYNAMIC_BUFFERS flag).
-        if (CB.AllowsDynamicOffset())
+        if (CB.IsDynamic())
             m_DynamicCBOffsetsMask[ShaderInd] |= BufferBit;
         else
             m_DynamicCBOffsetsMask[ShaderInd] &= ~BufferBit;
@@ -39,11 +39,13 @@ namespace Diligent
 class ShaderResourcesD3D11 : public ShaderResources
 {
 public:
-    // Loads shader resources from the compiled shader bytecode
-    ShaderResourcesD3D11(const IDataBlob*  pShaderBytecode,
-                         const ShaderDesc& ShdrDesc,
-                         const char*       CombinedSamplerSuffix,
-                         bool              LoadConstantBufferReflection);
+    // Loads shader resources from the compiled shader bytecode or, if pArchiveData is not null,
+    // from the reflection stored in the device object archive.
+    ShaderResourcesD3D11(const IDataBlob*            pShaderBytecode,
+                         const ShaderDesc&           ShdrDesc,
+                         const char*                 CombinedSamplerSuffix,
+                         bool                        LoadConstantBufferReflection,
+                         const D3DShaderArchiveData* pArchiveData = nullptr);
     ~ShaderResourcesD3D11();
 
     // clang-format off
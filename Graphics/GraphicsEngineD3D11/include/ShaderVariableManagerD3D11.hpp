@@ -78,6 +78,10 @@ public:
     const PipelineResourceDesc& GetResourceDesc(Uint32 Index) const;
     const ResourceAttribs&      GetResourceAttribs(Uint32 Index) const;
 
+    using TBase::GetResourceNameId;
+    using TBase::SetInlineConstants;
+    using TBase::GetInlineConstantsBuffer;
+
 
     template <typename ThisImplType, D3D11_RESOURCE_RANGE ResRange>
     struct ShaderVariableD3D11Base : ShaderVariableBase<ThisImplType, ShaderVariableManagerD3D11, IShaderResourceVariableD3D>
@@ -133,6 +133,12 @@ BufferD3D11Impl::BufferD3D11Impl(IReferenceCounters*        pRefCounters,
 
     // The memory is always coherent in Direct3D11
     m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
+
+    // Only suballocate buffers that are never accessed through other views,
+    // as SRVs/UAVs and vertex/index bindings would reference the d3d11 buffer object.
+    m_UsesDynamicConstantRing = (m_Desc.Usage == USAGE_DYNAMIC &&
+                                 m_Desc.BindFlags == BIND_UNIFORM_BUFFER &&
+                                 pRenderDeviceD3D11->GetProperties().DynamicConstantRingPageSize != 0);
 }
 
 static BufferDesc BuffDescFromD3D11Buffer(ID3D11Buffer* pd3d11Buffer, BufferDesc BuffDesc)
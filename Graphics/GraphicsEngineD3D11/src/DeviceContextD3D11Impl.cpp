@@ -43,6 +43,8 @@
 #include "QueryD3D11Impl.hpp"
 #include "DeviceMemoryD3D11Impl.hpp"
 #include "D3D11TileMappingHelper.hpp"
+#include "Trace.hpp"
+#include "RecordingDeviceContext.hpp"
 
 namespace Diligent
 {
@@ -62,18 +64,27 @@ DeviceContextD3D11Impl::DeviceContextD3D11Impl(IReferenceCounters*      pRefCoun
 #ifdef DILIGENT_DEVELOPMENT
     m_D3D11ValidationFlags{pDevice->GetProperties().D3D11ValidationFlags},
 #endif
-    m_CmdListAllocator    {GetRawAllocator(), sizeof(CommandListD3D11Impl), 64}
+    m_CmdListAllocator    {GetRawAllocator(), sizeof(CommandListD3D11Impl), 64},
+    m_DrawIndirectCountEmulator{pDevice->GetD3D11Device()}
 // clang-format on
 {
+    // Deferred contexts must map dynamic buffers with D3D11_MAP_WRITE_DISCARD before using them
+    // in every command list, so they always use the buffers' own d3d11 objects.
+    const Uint32 RingPageSize = pDevice->GetProperties().DynamicConstantRingPageSize;
+    if (!Desc.IsDeferred && RingPageSize != 0)
+    {
+        m_pDynamicConstantRing = std::make_unique<DynamicConstantRingD3D11>(pDevice->GetD3D11Device(), RingPageSize);
+    }
 }
 
 IMPLEMENT_QUERY_INTERFACE(DeviceContextD3D11Impl, IID_DeviceContextD3D11, TDeviceContextBase)
 
 
-void DeviceContextD3D11Impl::Begin(Uint32 ImmediateContextId)
+void DeviceContextD3D11Impl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
 {
     DEV_CHECK_ERR(ImmediateContextId == 0, "Direct3D11 supports only one immediate context");
-    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+    // Direct3D11 command lists may be executed any number of times, so reusable lists need no special handling
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS, Flags);
 }
 
 void DeviceContextD3D11Impl::SetPipelineState(IPipelineState* pPipelineState)
@@ -205,6 +216,8 @@ void DeviceContextD3D11Impl::TransitionShaderResources(IShaderResourceBinding* p
         return;
     }
 
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Barrier};
+
     ShaderResourceBindingD3D11Impl* pShaderResBindingD3D11 = ClassPtrCast<ShaderResourceBindingD3D11Impl>(pShaderResourceBinding);
     ShaderResourceCacheD3D11&       ResourceCache          = pShaderResBindingD3D11->GetResourceCache();
 
@@ -213,6 +226,9 @@ void DeviceContextD3D11Impl::TransitionShaderResources(IShaderResourceBinding* p
 
 void DeviceContextD3D11Impl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_TRACE_SCOPE("CommitShaderResources");
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Commit};
+
     DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
 
     ShaderResourceBindingD3D11Impl* const pShaderResBindingD3D11 = ClassPtrCast<ShaderResourceBindingD3D11Impl>(pShaderResourceBinding);
@@ -252,56 +268,32 @@ void DeviceContextD3D11Impl::BindCacheResources(const ShaderResourceCacheD3D11&
             ID3D11Buffer** d3d11CBs       = m_CommittedRes.d3d11CBs[ShaderInd];
             UINT*          FirstConstants = m_CommittedRes.CBFirstConstants[ShaderInd];
             UINT*          NumConstants   = m_CommittedRes.CBNumConstants[ShaderInd];
-            if (ShaderResourceCacheD3D11::MinMaxSlot Slots = ResourceCache.BindCBs(ShaderInd, d3d11CBs, FirstConstants, NumConstants, BaseBindings))
+            if (ShaderResourceCacheD3D11::MinMaxSlot Slots = ResourceCache.BindCBs(ShaderInd, d3d11CBs, FirstConstants, NumConstants, BaseBindings, m_pDynamicConstantRing != nullptr, &m_PendingBinds.CBs[ShaderInd]))
             {
-                auto SetCB1Method = SetCB1Methods[ShaderInd];
-                (m_pd3d11DeviceContext->*SetCB1Method)(Slots.MinSlot, Slots.MaxSlot - Slots.MinSlot + 1,
-                                                       d3d11CBs + Slots.MinSlot,
-                                                       FirstConstants + Slots.MinSlot,
-                                                       NumConstants + Slots.MinSlot);
+                m_PendingBinds.Stages |= ShaderType;
                 m_CommittedRes.NumCBs[ShaderInd] = std::max(m_CommittedRes.NumCBs[ShaderInd], static_cast<Uint8>(Slots.MaxSlot + 1));
             }
-#ifdef DILIGENT_DEVELOPMENT
-            if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
-            {
-                DvpVerifyCommittedCBs(ShaderType);
-            }
-#endif
         }
 
         if (ResourceCache.GetSRVCount(ShaderInd) > 0)
         {
             ID3D11ShaderResourceView** d3d11SRVs   = m_CommittedRes.d3d11SRVs[ShaderInd];
             ID3D11Resource**           d3d11SRVRes = m_CommittedRes.d3d11SRVResources[ShaderInd];
-            if (ShaderResourceCacheD3D11::MinMaxSlot Slots = ResourceCache.BindResourceViews<D3D11_RESOURCE_RANGE_SRV>(ShaderInd, d3d11SRVs, d3d11SRVRes, BaseBindings))
+            if (ShaderResourceCacheD3D11::MinMaxSlot Slots = ResourceCache.BindResourceViews<D3D11_RESOURCE_RANGE_SRV>(ShaderInd, d3d11SRVs, d3d11SRVRes, BaseBindings, &m_PendingBinds.SRVs[ShaderInd]))
             {
-                auto SetSRVMethod = SetSRVMethods[ShaderInd];
-                (m_pd3d11DeviceContext->*SetSRVMethod)(Slots.MinSlot, Slots.MaxSlot - Slots.MinSlot + 1, d3d11SRVs + Slots.MinSlot);
+                m_PendingBinds.Stages |= ShaderType;
                 m_CommittedRes.NumSRVs[ShaderInd] = std::max(m_CommittedRes.NumSRVs[ShaderInd], static_cast<Uint8>(Slots.MaxSlot + 1));
             }
-#ifdef DILIGENT_DEVELOPMENT
-            if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
-            {
-                DvpVerifyCommittedSRVs(ShaderType);
-            }
-#endif
         }
 
         if (ResourceCache.GetSamplerCount(ShaderInd) > 0)
         {
             ID3D11SamplerState** d3d11Samplers = m_CommittedRes.d3d11Samplers[ShaderInd];
-            if (ShaderResourceCacheD3D11::MinMaxSlot Slots = ResourceCache.BindResources<D3D11_RESOURCE_RANGE_SAMPLER>(ShaderInd, d3d11Samplers, BaseBindings))
+            if (ShaderResourceCacheD3D11::MinMaxSlot Slots = ResourceCache.BindResources<D3D11_RESOURCE_RANGE_SAMPLER>(ShaderInd, d3d11Samplers, BaseBindings, &m_PendingBinds.Samplers[ShaderInd]))
             {
-                auto SetSamplerMethod = SetSamplerMethods[ShaderInd];
-                (m_pd3d11DeviceContext->*SetSamplerMethod)(Slots.MinSlot, Slots.MaxSlot - Slots.MinSlot + 1, d3d11Samplers + Slots.MinSlot);
+                m_PendingBinds.Stages |= ShaderType;
                 m_CommittedRes.NumSamplers[ShaderInd] = std::max(m_CommittedRes.NumSamplers[ShaderInd], static_cast<Uint8>(Slots.MaxSlot + 1));
             }
-#ifdef DILIGENT_DEVELOPMENT
-            if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
-            {
-                DvpVerifyCommittedSamplers(ShaderType);
-            }
-#endif
         }
 
         if (ResourceCache.GetUAVCount(ShaderInd) > 0)
@@ -407,22 +399,58 @@ void DeviceContextD3D11Impl::BindDynamicCBs(const ShaderResourceCacheD3D11&    R
         ID3D11Buffer** d3d11CBs       = m_CommittedRes.d3d11CBs[ShaderInd];
         UINT*          FirstConstants = m_CommittedRes.CBFirstConstants[ShaderInd];
         UINT*          NumConstants   = m_CommittedRes.CBNumConstants[ShaderInd];
-        auto           SetCB1Method   = SetCB1Methods[ShaderInd];
 
-        ResourceCache.BindDynamicCBs(ShaderInd, d3d11CBs, FirstConstants, NumConstants, BaseBindings,
+        ResourceCache.BindDynamicCBs(ShaderInd, d3d11CBs, FirstConstants, NumConstants, BaseBindings, m_pDynamicConstantRing != nullptr,
                                      [&](Uint32 Slot) //
                                      {
-                                         (m_pd3d11DeviceContext->*SetCB1Method)(Slot, 1, d3d11CBs + Slot, FirstConstants + Slot, NumConstants + Slot);
+                                         m_PendingBinds.CBs[ShaderInd].Set(Slot);
+                                         m_PendingBinds.Stages |= GetShaderTypeFromIndex(ShaderInd);
                                      });
+    }
+}
+
+void DeviceContextD3D11Impl::CommitPendingBindings()
+{
+    for (SHADER_TYPE Stages = m_PendingBinds.Stages; Stages != SHADER_TYPE_UNKNOWN;)
+    {
+        const Int32 ShaderInd = ExtractFirstShaderStageIndex(Stages);
+
+        ID3D11Buffer** d3d11CBs       = m_CommittedRes.d3d11CBs[ShaderInd];
+        UINT*          FirstConstants = m_CommittedRes.CBFirstConstants[ShaderInd];
+        UINT*          NumConstants   = m_CommittedRes.CBNumConstants[ShaderInd];
+        auto           SetCB1Method   = SetCB1Methods[ShaderInd];
+        m_PendingBinds.CBs[ShaderInd].ProcessRanges(
+            [&](UINT StartSlot, UINT NumSlots) //
+            {
+                (m_pd3d11DeviceContext->*SetCB1Method)(StartSlot, NumSlots, d3d11CBs + StartSlot, FirstConstants + StartSlot, NumConstants + StartSlot);
+            });
+
+        ID3D11ShaderResourceView** d3d11SRVs    = m_CommittedRes.d3d11SRVs[ShaderInd];
+        auto                       SetSRVMethod = SetSRVMethods[ShaderInd];
+        m_PendingBinds.SRVs[ShaderInd].ProcessRanges(
+            [&](UINT StartSlot, UINT NumSlots) //
+            {
+                (m_pd3d11DeviceContext->*SetSRVMethod)(StartSlot, NumSlots, d3d11SRVs + StartSlot);
+            });
+
+        ID3D11SamplerState** d3d11Samplers    = m_CommittedRes.d3d11Samplers[ShaderInd];
+        auto                 SetSamplerMethod = SetSamplerMethods[ShaderInd];
+        m_PendingBinds.Samplers[ShaderInd].ProcessRanges(
+            [&](UINT StartSlot, UINT NumSlots) //
+            {
+                (m_pd3d11DeviceContext->*SetSamplerMethod)(StartSlot, NumSlots, d3d11Samplers + StartSlot);
+            });
+    }
+    m_PendingBinds.Stages = SHADER_TYPE_UNKNOWN;
 
 #ifdef DILIGENT_DEVELOPMENT
-        if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
-        {
-            const SHADER_TYPE ShaderType = GetShaderTypeFromIndex(ShaderInd);
-            DvpVerifyCommittedCBs(ShaderType);
-        }
-#endif
+    if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
+    {
+        DvpVerifyCommittedCBs(m_BindInfo.ActiveStages);
+        DvpVerifyCommittedSRVs(m_BindInfo.ActiveStages);
+        DvpVerifyCommittedSamplers(m_BindInfo.ActiveStages);
     }
+#endif
 }
 
 
@@ -459,7 +487,8 @@ void DeviceContextD3D11Impl::BindShaderResources(Uint32 BindSRBMask)
         }
         else
         {
-            // Bind constant buffers with dynamic offsets. In Direct3D11 only those buffers are counted as dynamic.
+            // Bind constant buffers with dynamic offsets and buffers suballocated from the dynamic constant ring.
+            // In Direct3D11 only those buffers are counted as dynamic.
             VERIFY((m_BindInfo.DynamicSRBMask & SignBit) != 0,
                    "When bit in StaleSRBMask is not set, the same bit in DynamicSRBMask must be set. Check GetCommitMask().");
             DEV_CHECK_ERR(pResourceCache->HasDynamicResources(),
@@ -474,6 +503,10 @@ void DeviceContextD3D11Impl::BindShaderResources(Uint32 BindSRBMask)
         }
     }
 
+    // Set all constant buffers, SRVs and samplers changed by the SRBs above
+    // using the smallest number of contiguous slot ranges.
+    CommitPendingBindings();
+
     if (PsUavBindMode == PixelShaderUAVBindMode::Clear)
     {
         // Check if SRBs that are not in the BindSRBMask contain UAVs.
@@ -548,6 +581,9 @@ void DeviceContextD3D11Impl::DvpValidateCommittedShaderResources()
     if (m_BindInfo.ResourcesValidated)
         return;
 
+    if (!DvpIsCommandValidationRequired(m_BindInfo))
+        return;
+
     DvpVerifySRBCompatibility(m_BindInfo);
 
     m_pPipelineState->DvpVerifySRBResources(m_BindInfo.ResourceCaches, m_BindInfo.BaseBindings);
@@ -823,12 +859,19 @@ void DeviceContextD3D11Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Att
 void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
     TDeviceContextBase::DrawIndirect(Attribs, 0);
-    DEV_CHECK_ERR(Attribs.pCounterBuffer == nullptr, "Direct3D11 does not support indirect counter buffer");
-
-    PrepareForDraw(Attribs.Flags);
 
     BufferD3D11Impl* pIndirectDrawAttribsD3D11 = ClassPtrCast<BufferD3D11Impl>(Attribs.pAttribsBuffer);
     ID3D11Buffer*    pd3d11ArgsBuff            = pIndirectDrawAttribsD3D11->m_pd3d11Buffer;
+    Uint64           DrawArgsOffset            = Attribs.DrawArgsOffset;
+    Uint32           DrawArgsStride            = Attribs.DrawArgsStride;
+    if (Attribs.pCounterBuffer != nullptr)
+    {
+        if (!EmulateIndirectDrawCount(Attribs.pCounterBuffer, Attribs.CounterOffset, Attribs.DrawCount,
+                                      sizeof(D3D11_DRAW_INSTANCED_INDIRECT_ARGS), pd3d11ArgsBuff, DrawArgsOffset, DrawArgsStride))
+            return;
+    }
+
+    PrepareForDraw(Attribs.Flags);
 
     bool NativeMultiDrawExecuted = false;
     if (Attribs.DrawCount > 1)
@@ -840,8 +883,8 @@ void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
                 NvAPI_D3D11_MultiDrawInstancedIndirect(m_pd3d11DeviceContext,
                                                        Attribs.DrawCount,
                                                        pd3d11ArgsBuff,
-                                                       StaticCast<UINT>(Attribs.DrawArgsOffset),
-                                                       Attribs.DrawArgsStride) == NVAPI_OK;
+                                                       StaticCast<UINT>(DrawArgsOffset),
+                                                       DrawArgsStride) == NVAPI_OK;
         }
 #endif
     }
@@ -850,7 +893,7 @@ void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
     {
         for (Uint32 draw = 0; draw < Attribs.DrawCount; ++draw)
         {
-            const Uint64 ArgsOffset = Attribs.DrawArgsOffset + Uint64{draw} * Uint64{Attribs.DrawArgsStride};
+            const Uint64 ArgsOffset = DrawArgsOffset + Uint64{draw} * Uint64{DrawArgsStride};
             m_pd3d11DeviceContext->DrawInstancedIndirect(pd3d11ArgsBuff, StaticCast<UINT>(ArgsOffset));
         }
     }
@@ -860,12 +903,19 @@ void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 void DeviceContextD3D11Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
     TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
-    DEV_CHECK_ERR(Attribs.pCounterBuffer == nullptr, "Direct3D11 does not support indirect counter buffer");
-
-    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
 
     BufferD3D11Impl* pIndirectDrawAttribsD3D11 = ClassPtrCast<BufferD3D11Impl>(Attribs.pAttribsBuffer);
     ID3D11Buffer*    pd3d11ArgsBuff            = pIndirectDrawAttribsD3D11->m_pd3d11Buffer;
+    Uint64           DrawArgsOffset            = Attribs.DrawArgsOffset;
+    Uint32           DrawArgsStride            = Attribs.DrawArgsStride;
+    if (Attribs.pCounterBuffer != nullptr)
+    {
+        if (!EmulateIndirectDrawCount(Attribs.pCounterBuffer, Attribs.CounterOffset, Attribs.DrawCount,
+                                      sizeof(D3D11_DRAW_INDEXED_INSTANCED_INDIRECT_ARGS), pd3d11ArgsBuff, DrawArgsOffset, DrawArgsStride))
+            return;
+    }
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
 
     bool NativeMultiDrawExecuted = false;
     if (Attribs.DrawCount >= 1)
@@ -877,8 +927,8 @@ void DeviceContextD3D11Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttrib
                 NvAPI_D3D11_MultiDrawIndexedInstancedIndirect(m_pd3d11DeviceContext,
                                                               Attribs.DrawCount,
                                                               pd3d11ArgsBuff,
-                                                              StaticCast<UINT>(Attribs.DrawArgsOffset),
-                                                              Attribs.DrawArgsStride) == NVAPI_OK;
+                                                              StaticCast<UINT>(DrawArgsOffset),
+                                                              DrawArgsStride) == NVAPI_OK;
         }
 #endif
     }
@@ -887,12 +937,43 @@ void DeviceContextD3D11Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttrib
     {
         for (Uint32 draw = 0; draw < Attribs.DrawCount; ++draw)
         {
-            const Uint64 ArgsOffset = Attribs.DrawArgsOffset + Uint64{draw} * Uint64{Attribs.DrawArgsStride};
+            const Uint64 ArgsOffset = DrawArgsOffset + Uint64{draw} * Uint64{DrawArgsStride};
             m_pd3d11DeviceContext->DrawIndexedInstancedIndirect(pd3d11ArgsBuff, StaticCast<UINT>(ArgsOffset));
         }
     }
 }
 
+void DeviceContextD3D11Impl::ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs)
+{
+    UNSUPPORTED("ExecuteIndirectCommands is not supported in DirectX 11");
+}
+
+bool DeviceContextD3D11Impl::EmulateIndirectDrawCount(IBuffer*       pCounterBuffer,
+                                                      Uint64         CounterOffset,
+                                                      Uint32         MaxDrawCount,
+                                                      Uint32         ArgsSize,
+                                                      ID3D11Buffer*& pd3d11ArgsBuff,
+                                                      Uint64&        DrawArgsOffset,
+                                                      Uint32&        DrawArgsStride)
+{
+    if (MaxDrawCount == 0)
+        return false;
+
+    BufferD3D11Impl* pCounterBufferD3D11 = ClassPtrCast<BufferD3D11Impl>(pCounterBuffer);
+
+    Uint32        EmulatedArgsOffset = 0;
+    ID3D11Buffer* pd3d11EmulatedArgs = m_DrawIndirectCountEmulator.PrepareArgs(m_pd3d11DeviceContext, pd3d11ArgsBuff, DrawArgsOffset, DrawArgsStride, ArgsSize,
+                                                                               MaxDrawCount, pCounterBufferD3D11->m_pd3d11Buffer, CounterOffset, EmulatedArgsOffset);
+    if (pd3d11EmulatedArgs == nullptr)
+        return false;
+
+    pd3d11ArgsBuff = pd3d11EmulatedArgs;
+    DrawArgsOffset = EmulatedArgsOffset;
+    if (MaxDrawCount == 1)
+        DrawArgsStride = ArgsSize;
+    return true;
+}
+
 void DeviceContextD3D11Impl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
     UNSUPPORTED("DrawMesh is not supported in DirectX 11");
@@ -1013,10 +1094,30 @@ void DeviceContextD3D11Impl::ClearRenderTarget(ITextureView* pView, const void*
     m_pd3d11DeviceContext->ClearRenderTargetView(pd3d11RTV, static_cast<const float*>(RGBA));
 }
 
+void DeviceContextD3D11Impl::InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil)
+{
+    TDeviceContextBase::InvalidateRenderTargets(RenderTargetMask, InvalidateDepthStencil);
+
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        if ((RenderTargetMask & (1u << rt)) != 0 && m_pBoundRenderTargets[rt])
+            m_pd3d11DeviceContext->DiscardView(m_pBoundRenderTargets[rt]->GetD3D11View());
+    }
+
+    if (InvalidateDepthStencil && m_pBoundDepthStencil)
+        m_pd3d11DeviceContext->DiscardView(m_pBoundDepthStencil->GetD3D11View());
+}
+
 void DeviceContextD3D11Impl::Flush()
 {
+    DILIGENT_TRACE_SCOPE("Flush");
+
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
+    UpdateGPUFrameTimer();
+
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Submit};
     m_pd3d11DeviceContext->Flush();
+    ++m_Stats.QueueSubmits;
 }
 
 void DeviceContextD3D11Impl::UpdateBuffer(IBuffer*                       pBuffer,
@@ -1053,6 +1154,17 @@ void DeviceContextD3D11Impl::CopyBuffer(IBuffer*                       pSrcBuffe
     BufferD3D11Impl* pSrcBufferD3D11Impl = ClassPtrCast<BufferD3D11Impl>(pSrcBuffer);
     BufferD3D11Impl* pDstBufferD3D11Impl = ClassPtrCast<BufferD3D11Impl>(pDstBuffer);
 
+    ID3D11Buffer* pd3d11SrcBuffer = pSrcBufferD3D11Impl->m_pd3d11Buffer;
+    if (m_pDynamicConstantRing && pSrcBufferD3D11Impl->UsesDynamicConstantRing())
+    {
+        // The contents of the buffer are in the ring page if the buffer has been mapped
+        if (const DynamicConstantRingD3D11::Allocation& Alloc = pSrcBufferD3D11Impl->GetDynamicConstantRingAllocation())
+        {
+            pd3d11SrcBuffer = Alloc.pPage->pd3d11Buffer;
+            SrcOffset += Alloc.Offset;
+        }
+    }
+
     D3D11_BOX SrcBox;
     SrcBox.left   = StaticCast<UINT>(SrcOffset);
     SrcBox.right  = StaticCast<UINT>(SrcOffset + Size);
@@ -1060,7 +1172,7 @@ void DeviceContextD3D11Impl::CopyBuffer(IBuffer*                       pSrcBuffe
     SrcBox.bottom = 1;
     SrcBox.front  = 0;
     SrcBox.back   = 1;
-    m_pd3d11DeviceContext->CopySubresourceRegion(pDstBufferD3D11Impl->m_pd3d11Buffer, 0, StaticCast<UINT>(DstOffset), 0, 0, pSrcBufferD3D11Impl->m_pd3d11Buffer, 0, &SrcBox);
+    m_pd3d11DeviceContext->CopySubresourceRegion(pDstBufferD3D11Impl->m_pd3d11Buffer, 0, StaticCast<UINT>(DstOffset), 0, 0, pd3d11SrcBuffer, 0, &SrcBox);
 }
 
 
@@ -1068,9 +1180,28 @@ void DeviceContextD3D11Impl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_F
 {
     TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
 
-    BufferD3D11Impl* pBufferD3D11  = ClassPtrCast<BufferD3D11Impl>(pBuffer);
-    D3D11_MAP        d3d11MapType  = static_cast<D3D11_MAP>(0);
-    UINT             d3d11MapFlags = 0;
+    BufferD3D11Impl* pBufferD3D11 = ClassPtrCast<BufferD3D11Impl>(pBuffer);
+    if (m_pDynamicConstantRing && MapType == MAP_WRITE && pBufferD3D11->UsesDynamicConstantRing())
+    {
+        DynamicConstantRingD3D11::Allocation& Alloc = pBufferD3D11->m_DynamicConstantRingAlloc;
+        if ((MapFlags & MAP_FLAG_NO_OVERWRITE) != 0)
+        {
+            // Keep writing to the current allocation. If the buffer has not been suballocated yet,
+            // its contents are in the d3d11 buffer object, which is mapped below.
+            if (Alloc)
+                pMappedData = m_pDynamicConstantRing->Remap(m_pd3d11DeviceContext, Alloc);
+        }
+        else
+        {
+            pMappedData = m_pDynamicConstantRing->Allocate(m_pd3d11DeviceContext, StaticCast<Uint32>(pBufferD3D11->GetDesc().Size), Alloc);
+        }
+
+        if (Alloc)
+            return;
+    }
+
+    D3D11_MAP d3d11MapType  = static_cast<D3D11_MAP>(0);
+    UINT      d3d11MapFlags = 0;
     MapParamsToD3D11MapParams(MapType, MapFlags, d3d11MapType, d3d11MapFlags);
 
     D3D11_MAPPED_SUBRESOURCE MappedBuff;
@@ -1087,6 +1218,15 @@ void DeviceContextD3D11Impl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
 {
     TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
     BufferD3D11Impl* pBufferD3D11 = ClassPtrCast<BufferD3D11Impl>(pBuffer);
+    if (m_pDynamicConstantRing && MapType == MAP_WRITE && pBufferD3D11->UsesDynamicConstantRing())
+    {
+        // MapBuffer() only maps the d3d11 buffer object if the buffer has no ring allocation
+        if (const DynamicConstantRingD3D11::Allocation& Alloc = pBufferD3D11->GetDynamicConstantRingAllocation())
+        {
+            m_pDynamicConstantRing->Unmap(m_pd3d11DeviceContext, Alloc);
+            return;
+        }
+    }
     m_pd3d11DeviceContext->Unmap(pBufferD3D11->m_pd3d11Buffer, 0);
 }
 
@@ -1203,9 +1343,9 @@ void DeviceContextD3D11Impl::UnmapTextureSubresource(ITexture* pTexture, Uint32
     m_pd3d11DeviceContext->Unmap(pTexD3D11->GetD3D11Texture(), Subresource);
 }
 
-void DeviceContextD3D11Impl::GenerateMips(ITextureView* pTextureView)
+void DeviceContextD3D11Impl::GenerateMips(ITextureView* pTextureView, GENERATE_MIPS_FLAGS Flags)
 {
-    TDeviceContextBase::GenerateMips(pTextureView);
+    TDeviceContextBase::GenerateMips(pTextureView, Flags);
     TextureViewD3D11Impl&     TexViewD3D11 = *ClassPtrCast<TextureViewD3D11Impl>(pTextureView);
     ID3D11ShaderResourceView* pd3d11SRV    = static_cast<ID3D11ShaderResourceView*>(TexViewD3D11.GetD3D11View());
     m_pd3d11DeviceContext->GenerateMips(pd3d11SRV);
@@ -1230,7 +1370,7 @@ void DeviceContextD3D11Impl::SetVertexBuffers(Uint32                         Sta
                                               RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
                                               SET_VERTEX_BUFFERS_FLAGS       Flags)
 {
-    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+    const bool StreamsChanged = TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags, 0);
     for (Uint32 Slot = 0; Slot < m_NumVertexStreams; ++Slot)
     {
         VertexStreamInfo<BufferD3D11Impl>& CurrStream = m_VertexStreams[Slot];
@@ -1257,12 +1397,13 @@ void DeviceContextD3D11Impl::SetVertexBuffers(Uint32                         Sta
         }
     }
 
-    m_bCommittedD3D11VBsUpToDate = false;
+    if (StreamsChanged)
+        m_bCommittedD3D11VBsUpToDate = false;
 }
 
 void DeviceContextD3D11Impl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
-    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+    const bool IndexBufferChanged = TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode, 0);
 
     if (m_pIndexBuffer)
     {
@@ -1286,13 +1427,15 @@ void DeviceContextD3D11Impl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOf
 #endif
     }
 
-    m_bCommittedD3D11IBUpToDate = false;
+    if (IndexBufferChanged)
+        m_bCommittedD3D11IBUpToDate = false;
 }
 
 void DeviceContextD3D11Impl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
 {
     static_assert(MAX_VIEWPORTS >= D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE, "MaxViewports constant must be greater than D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE");
-    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+    if (!TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight))
+        return;
 
     D3D11_VIEWPORT d3d11Viewports[MAX_VIEWPORTS];
     VERIFY(NumViewports == m_NumViewports, "Unexpected number of viewports");
@@ -1313,7 +1456,8 @@ void DeviceContextD3D11Impl::SetViewports(Uint32 NumViewports, const Viewport* p
 void DeviceContextD3D11Impl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
 {
     static_assert(MAX_VIEWPORTS >= D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE, "MaxViewports constant must be greater than D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE");
-    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+    if (!TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight))
+        return;
 
     D3D11_RECT d3d11ScissorRects[MAX_VIEWPORTS];
     VERIFY(NumRects == m_NumScissorRects, "Unexpected number of scissor rects");
@@ -1957,6 +2101,12 @@ void DeviceContextD3D11Impl::ExecuteCommandLists(Uint32               NumCommand
 
     for (Uint32 i = 0; i < NumCommandLists; ++i)
     {
+        if (RefCntAutoPtr<RecordedCommandList> pRecordedCmdList{ppCommandLists[i], IID_RecordedCommandList})
+        {
+            pRecordedCmdList->Execute(this);
+            continue;
+        }
+
         CommandListD3D11Impl* pCmdListD3D11 = ClassPtrCast<CommandListD3D11Impl>(ppCommandLists[i]);
         ID3D11CommandList*    pd3d11CmdList = pCmdListD3D11->GetD3D11CommandList();
         m_pd3d11DeviceContext->ExecuteCommandList(pd3d11CmdList,
@@ -2077,6 +2227,21 @@ void DeviceContextD3D11Impl::EndQuery(IQuery* pQuery)
     m_pd3d11DeviceContext->End(pQueryD3D11Impl->GetD3D11Query(QueryType == QUERY_TYPE_DURATION ? 1 : 0));
 }
 
+void DeviceContextD3D11Impl::BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    UNSUPPORTED("BeginPoolQuery is not supported in DirectX 11");
+}
+
+void DeviceContextD3D11Impl::EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    UNSUPPORTED("EndPoolQuery is not supported in DirectX 11");
+}
+
+void DeviceContextD3D11Impl::ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs)
+{
+    UNSUPPORTED("ResolvePoolQueries is not supported in DirectX 11");
+}
+
 void DeviceContextD3D11Impl::ClearStateCache()
 {
     TDeviceContextBase::ClearStateCache();
@@ -2207,6 +2372,8 @@ void DeviceContextD3D11Impl::TransitionResourceStates(Uint32 BarrierCount, const
 {
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
 
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Barrier};
+
     for (Uint32 i = 0; i < BarrierCount; ++i)
     {
         const StateTransitionDesc& Barrier = pResourceBarriers[i];
@@ -2423,6 +2590,21 @@ void DeviceContextD3D11Impl::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_
     UNSUPPORTED("SetShadingRate is not supported in DirectX 11");
 }
 
+void DeviceContextD3D11Impl::SetCullMode(CULL_MODE CullMode)
+{
+    UNSUPPORTED("SetCullMode is not supported in DirectX 11");
+}
+
+void DeviceContextD3D11Impl::SetDepthState(Bool DepthEnable, Bool DepthWriteEnable, COMPARISON_FUNCTION DepthFunc)
+{
+    UNSUPPORTED("SetDepthState is not supported in DirectX 11");
+}
+
+void DeviceContextD3D11Impl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    UNSUPPORTED("SetPrimitiveTopology is not supported in DirectX 11");
+}
+
 void DeviceContextD3D11Impl::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
 {
     TDeviceContextBase::BindSparseResourceMemory(Attribs, 0);
@@ -0,0 +1,261 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include <d3dcompiler.h>
+
+#include "DrawIndirectCountEmulatorD3D11.hpp"
+
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// The draw count is copied to offset 0 of the arguments buffer, and the draw arguments
+// are copied starting at offset ArgsStartOffset. InstanceCount is the second dword in
+// both D3D11_DRAW_INSTANCED_INDIRECT_ARGS and D3D11_DRAW_INDEXED_INSTANCED_INDIRECT_ARGS.
+constexpr Uint32 ArgsStartOffset     = 16;
+constexpr Uint32 InstanceCountOffset = 4;
+constexpr Uint32 ThreadGroupSize     = 64;
+
+constexpr char EmulationCS[] = R"(
+cbuffer cbEmulationAttribs : register(b0)
+{
+    uint g_MaxDrawCount;
+    uint g_ArgsStride;
+    uint g_ArgsStartOffset;
+    uint g_InstanceCountOffset;
+}
+
+RWByteAddressBuffer g_Args : register(u0);
+
+[numthreads(64, 1, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    uint DrawCount = g_Args.Load(0);
+    if (DTid.x < g_MaxDrawCount && DTid.x >= DrawCount)
+        g_Args.Store(g_ArgsStartOffset + DTid.x * g_ArgsStride + g_InstanceCountOffset, 0);
+}
+)";
+
+struct EmulationAttribs
+{
+    Uint32 MaxDrawCount;
+    Uint32 ArgsStride;
+    Uint32 ArgsStartOffset;
+    Uint32 InstanceCountOffset;
+};
+static_assert(sizeof(EmulationAttribs) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+} // namespace
+
+DrawIndirectCountEmulatorD3D11::DrawIndirectCountEmulatorD3D11(ID3D11Device* pd3d11Device) noexcept :
+    m_pd3d11Device{pd3d11Device}
+{
+}
+
+bool DrawIndirectCountEmulatorD3D11::Initialize()
+{
+    if (m_pd3d11CS)
+        return true;
+    if (m_InitializationFailed)
+        return false;
+
+    // Do not try again if anything below fails
+    m_InitializationFailed = true;
+
+    CComPtr<ID3DBlob> pByteCode;
+    CComPtr<ID3DBlob> pErrors;
+
+    HRESULT hr = D3DCompile(EmulationCS, sizeof(EmulationCS) - 1, "DrawIndirectCountEmulation", nullptr, nullptr, "main", "cs_5_0",
+                            D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, &pByteCode, &pErrors);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to compile indirect draw count emulation shader: ",
+                          (pErrors ? static_cast<const char*>(pErrors->GetBufferPointer()) : "unknown error"));
+        return false;
+    }
+
+    hr = m_pd3d11Device->CreateComputeShader(pByteCode->GetBufferPointer(), pByteCode->GetBufferSize(), nullptr, &m_pd3d11CS);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create indirect draw count emulation shader");
+        return false;
+    }
+
+    D3D11_BUFFER_DESC CBDesc{};
+    CBDesc.ByteWidth      = sizeof(EmulationAttribs);
+    CBDesc.Usage          = D3D11_USAGE_DYNAMIC;
+    CBDesc.BindFlags      = D3D11_BIND_CONSTANT_BUFFER;
+    CBDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    hr = m_pd3d11Device->CreateBuffer(&CBDesc, nullptr, &m_pd3d11ConstantBuffer);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create indirect draw count emulation constant buffer");
+        m_pd3d11CS.Release();
+        return false;
+    }
+
+    m_InitializationFailed = false;
+    return true;
+}
+
+bool DrawIndirectCountEmulatorD3D11::ReserveArgsBuffer(Uint32 Size)
+{
+    if (m_ArgsBufferSize >= Size)
+        return true;
+
+    // Grow the buffer geometrically to avoid recreating it for every new maximum draw count
+    const Uint32 NewSize = AlignUp(std::max(Size, m_ArgsBufferSize * 2), 256u);
+
+    m_pd3d11ArgsUAV.Release();
+    m_pd3d11ArgsBuffer.Release();
+    m_ArgsBufferSize = 0;
+
+    D3D11_BUFFER_DESC BuffDesc{};
+    BuffDesc.ByteWidth = NewSize;
+    BuffDesc.Usage     = D3D11_USAGE_DEFAULT;
+    BuffDesc.BindFlags = D3D11_BIND_UNORDERED_ACCESS;
+    BuffDesc.MiscFlags = D3D11_RESOURCE_MISC_DRAWINDIRECT_ARGS | D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+
+    HRESULT hr = m_pd3d11Device->CreateBuffer(&BuffDesc, nullptr, &m_pd3d11ArgsBuffer);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create indirect draw count emulation arguments buffer");
+        return false;
+    }
+
+    D3D11_UNORDERED_ACCESS_VIEW_DESC UAVDesc{};
+    UAVDesc.Format              = DXGI_FORMAT_R32_TYPELESS;
+    UAVDesc.ViewDimension       = D3D11_UAV_DIMENSION_BUFFER;
+    UAVDesc.Buffer.FirstElement = 0;
+    UAVDesc.Buffer.NumElements  = NewSize / 4;
+    UAVDesc.Buffer.Flags        = D3D11_BUFFER_UAV_FLAG_RAW;
+
+    hr = m_pd3d11Device->CreateUnorderedAccessView(m_pd3d11ArgsBuffer, &UAVDesc, &m_pd3d11ArgsUAV);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create indirect draw count emulation arguments buffer UAV");
+        m_pd3d11ArgsBuffer.Release();
+        return false;
+    }
+
+    m_ArgsBufferSize = NewSize;
+    return true;
+}
+
+ID3D11Buffer* DrawIndirectCountEmulatorD3D11::PrepareArgs(ID3D11DeviceContext1* pd3d11Ctx,
+                                                          ID3D11Buffer*         pd3d11ArgsBuff,
+                                                          Uint64                ArgsOffset,
+                                                          Uint32                ArgsStride,
+                                                          Uint32                ArgsSize,
+                                                          Uint32                MaxDrawCount,
+                                                          ID3D11Buffer*         pd3d11CounterBuff,
+                                                          Uint64                CounterOffset,
+                                                          Uint32&               EmulatedArgsOffset)
+{
+    VERIFY_EXPR(MaxDrawCount > 0);
+    if (MaxDrawCount == 1)
+        ArgsStride = ArgsSize;
+    VERIFY(ArgsStride % 4 == 0, "Draw arguments stride must be a multiple of 4");
+
+    const Uint32 ArgsRegionSize = (MaxDrawCount - 1) * ArgsStride + ArgsSize;
+    if (!Initialize() || !ReserveArgsBuffer(ArgsStartOffset + ArgsRegionSize))
+        return nullptr;
+
+    {
+        D3D11_BOX SrcBox{};
+        SrcBox.left   = StaticCast<UINT>(CounterOffset);
+        SrcBox.right  = StaticCast<UINT>(CounterOffset + sizeof(Uint32));
+        SrcBox.bottom = 1;
+        SrcBox.back   = 1;
+        pd3d11Ctx->CopySubresourceRegion(m_pd3d11ArgsBuffer, 0, 0, 0, 0, pd3d11CounterBuff, 0, &SrcBox);
+
+        SrcBox.left  = StaticCast<UINT>(ArgsOffset);
+        SrcBox.right = StaticCast<UINT>(ArgsOffset + ArgsRegionSize);
+        pd3d11Ctx->CopySubresourceRegion(m_pd3d11ArgsBuffer, 0, ArgsStartOffset, 0, 0, pd3d11ArgsBuff, 0, &SrcBox);
+    }
+
+    {
+        D3D11_MAPPED_SUBRESOURCE MappedData{};
+        if (FAILED(pd3d11Ctx->Map(m_pd3d11ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedData)))
+        {
+            LOG_ERROR_MESSAGE("Failed to map indirect draw count emulation constant buffer");
+            return nullptr;
+        }
+        EmulationAttribs& Attribs   = *static_cast<EmulationAttribs*>(MappedData.pData);
+        Attribs.MaxDrawCount        = MaxDrawCount;
+        Attribs.ArgsStride          = ArgsStride;
+        Attribs.ArgsStartOffset     = ArgsStartOffset;
+        Attribs.InstanceCountOffset = InstanceCountOffset;
+        pd3d11Ctx->Unmap(m_pd3d11ConstantBuffer, 0);
+    }
+
+    // Save the compute stage state that the dispatch overwrites, so that
+    // the context's cached bindings remain valid.
+    CComPtr<ID3D11ComputeShader>       pPrevCS;
+    CComPtr<ID3D11Buffer>              pPrevCB;
+    CComPtr<ID3D11UnorderedAccessView> pPrevUAV;
+
+    UINT PrevFirstConstant = 0;
+    UINT PrevNumConstants  = 0;
+    pd3d11Ctx->CSGetShader(&pPrevCS, nullptr, nullptr);
+    pd3d11Ctx->CSGetConstantBuffers1(0, 1, &pPrevCB, &PrevFirstConstant, &PrevNumConstants);
+    pd3d11Ctx->CSGetUnorderedAccessViews(0, 1, &pPrevUAV);
+
+    {
+        ID3D11Buffer*              pd3d11CBs[]  = {m_pd3d11ConstantBuffer};
+        ID3D11UnorderedAccessView* pd3d11UAVs[] = {m_pd3d11ArgsUAV};
+        pd3d11Ctx->CSSetShader(m_pd3d11CS, nullptr, 0);
+        pd3d11Ctx->CSSetConstantBuffers(0, 1, pd3d11CBs);
+        pd3d11Ctx->CSSetUnorderedAccessViews(0, 1, pd3d11UAVs, nullptr);
+        pd3d11Ctx->Dispatch((MaxDrawCount + ThreadGroupSize - 1) / ThreadGroupSize, 1, 1);
+    }
+
+    {
+        ID3D11Buffer*              pd3d11CBs[]  = {pPrevCB};
+        ID3D11UnorderedAccessView* pd3d11UAVs[] = {pPrevUAV};
+
+        const UINT KeepCounters[] = {~0u};
+        pd3d11Ctx->CSSetShader(pPrevCS, nullptr, 0);
+        if (pPrevCB != nullptr && PrevFirstConstant != 0)
+            pd3d11Ctx->CSSetConstantBuffers1(0, 1, pd3d11CBs, &PrevFirstConstant, &PrevNumConstants);
+        else
+            pd3d11Ctx->CSSetConstantBuffers(0, 1, pd3d11CBs);
+        pd3d11Ctx->CSSetUnorderedAccessViews(0, 1, pd3d11UAVs, KeepCounters);
+    }
+
+    EmulatedArgsOffset = ArgsStartOffset;
+    return m_pd3d11ArgsBuffer;
+}
+
+} // namespace Diligent
@@ -0,0 +1,147 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "DynamicConstantRingD3D11.hpp"
+
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+#include "FormatString.hpp"
+
+namespace Diligent
+{
+
+DynamicConstantRingD3D11::DynamicConstantRingD3D11(ID3D11Device* pd3d11Device, Uint32 PageSize) noexcept :
+    m_pd3d11Device{pd3d11Device},
+    m_PageSize{AlignUp(PageSize, OffsetAlignment)}
+{
+}
+
+DynamicConstantRingD3D11::~DynamicConstantRingD3D11()
+{
+    Uint64 TotalSize = 0;
+    for (const std::shared_ptr<Page>& pPage : m_Pages)
+        TotalSize += pPage->Size;
+
+    LOG_INFO_MESSAGE("Dynamic constant ring: created ", m_Pages.size(), (m_Pages.size() == 1 ? " page" : " pages"),
+                     " (", FormatMemorySize(TotalSize), ")");
+}
+
+std::shared_ptr<DynamicConstantRingD3D11::Page> DynamicConstantRingD3D11::FindOrCreatePage(Uint32 RequiredSize)
+{
+    // A page that is only referenced by the ring is not used by any buffer and can be
+    // reused. Mapping it with D3D11_MAP_WRITE_DISCARD gives the ring new memory while the
+    // GPU may still be reading the old contents.
+    for (const std::shared_ptr<Page>& pPage : m_Pages)
+    {
+        if (pPage.use_count() == 1 && pPage->Size >= RequiredSize)
+            return pPage;
+    }
+
+    std::shared_ptr<Page> pPage = std::make_shared<Page>();
+    pPage->Size                 = std::max(m_PageSize, RequiredSize);
+
+    D3D11_BUFFER_DESC d3d11BuffDesc{};
+    d3d11BuffDesc.ByteWidth      = pPage->Size;
+    d3d11BuffDesc.Usage          = D3D11_USAGE_DYNAMIC;
+    d3d11BuffDesc.BindFlags      = D3D11_BIND_CONSTANT_BUFFER;
+    d3d11BuffDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    HRESULT hr = m_pd3d11Device->CreateBuffer(&d3d11BuffDesc, nullptr, &pPage->pd3d11Buffer);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create dynamic constant ring page of size ", FormatMemorySize(pPage->Size));
+        return {};
+    }
+
+    static constexpr char PageName[] = "Dynamic constant ring page";
+    pPage->pd3d11Buffer->SetPrivateData(WKPDID_D3DDebugObjectName, static_cast<UINT>(sizeof(PageName) - 1), PageName);
+
+    m_Pages.emplace_back(pPage);
+    return pPage;
+}
+
+void* DynamicConstantRingD3D11::MapPage(ID3D11DeviceContext* pd3d11Ctx, const Allocation& Alloc, D3D11_MAP MapType)
+{
+    VERIFY_EXPR(Alloc);
+
+    D3D11_MAPPED_SUBRESOURCE MappedData{};
+
+    HRESULT hr = pd3d11Ctx->Map(Alloc.pPage->pd3d11Buffer, 0, MapType, 0, &MappedData);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to map dynamic constant ring page");
+        return nullptr;
+    }
+
+    return static_cast<Uint8*>(MappedData.pData) + Alloc.Offset;
+}
+
+void* DynamicConstantRingD3D11::Allocate(ID3D11DeviceContext* pd3d11Ctx, Uint32 Size, Allocation& Alloc)
+{
+    // Release the previous allocation first so that its page can be reused
+    Alloc = {};
+
+    const Uint32 AlignedSize = AlignUp(Size, OffsetAlignment);
+
+    D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (!m_pCurrPage || m_CurrOffset + AlignedSize > m_pCurrPage->Size)
+    {
+        m_pCurrPage.reset();
+        m_pCurrPage  = FindOrCreatePage(AlignedSize);
+        m_CurrOffset = 0;
+        if (!m_pCurrPage)
+            return nullptr;
+
+        // The page is written from the beginning: discard its previous contents
+        MapType = D3D11_MAP_WRITE_DISCARD;
+    }
+
+    Alloc.pPage  = m_pCurrPage;
+    Alloc.Offset = m_CurrOffset;
+    m_CurrOffset += AlignedSize;
+
+    void* pData = MapPage(pd3d11Ctx, Alloc, MapType);
+    if (pData == nullptr)
+        Alloc = {};
+
+    return pData;
+}
+
+void* DynamicConstantRingD3D11::Remap(ID3D11DeviceContext* pd3d11Ctx, const Allocation& Alloc)
+{
+    return MapPage(pd3d11Ctx, Alloc, D3D11_MAP_WRITE_NO_OVERWRITE);
+}
+
+void DynamicConstantRingD3D11::Unmap(ID3D11DeviceContext* pd3d11Ctx, const Allocation& Alloc)
+{
+    VERIFY_EXPR(Alloc);
+    pd3d11Ctx->Unmap(Alloc.pPage->pd3d11Buffer, 0);
+}
+
+} // namespace Diligent
@@ -560,6 +560,11 @@ GraphicsAdapterInfo EngineFactoryD3D11Impl::GetGraphicsAdapterInfo(void*
         {
             DrawCommandProps.CapFlags |= DRAW_COMMAND_CAP_FLAG_NATIVE_MULTI_DRAW_INDIRECT;
         }
+        if (pd3d11Device->GetFeatureLevel() >= D3D_FEATURE_LEVEL_11_0)
+        {
+            // Counter buffer is emulated with a compute shader, see DrawIndirectCountEmulatorD3D11
+            DrawCommandProps.CapFlags |= DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER;
+        }
         ASSERT_SIZEOF(DrawCommandProps, 12, "Did you add a new member to DrawCommandProperties? Please initialize it here.");
     }
 
@@ -150,7 +150,7 @@ void PipelineResourceSignatureD3D11Impl::CreateLayout(const bool IsSerialized)
                 // Set the immutable sampler array size to match the resource array size
                 ImmutableSamplerAttribsD3D11& DstImtblSampAttribs = m_pImmutableSamplerAttribs[SrcImmutableSamplerInd];
                 // One immutable sampler may be used by different arrays in different shader stages - use the maximum array size
-                DstImtblSampAttribs.ArraySize = std::max(DstImtblSampAttribs.ArraySize, ResDesc.ArraySize);
+                DstImtblSampAttribs.ArraySize = std::max(DstImtblSampAttribs.ArraySize, ResDesc.GetArraySize());
             }
         }
     }
@@ -198,7 +198,7 @@ void PipelineResourceSignatureD3D11Impl::CreateLayout(const bool IsSerialized)
         {
             const D3D11_RESOURCE_RANGE Range = ShaderResourceTypeToRange(ResDesc.ResourceType);
 
-            AllocBindPoints(m_ResourceCounters, BindPoints, ResDesc.ShaderStages, ResDesc.ArraySize, Range);
+            AllocBindPoints(m_ResourceCounters, BindPoints, ResDesc.ShaderStages, ResDesc.GetArraySize(), Range);
             if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
             {
                 // Since resources in the static cache are indexed by the same bindings, we need to
@@ -219,7 +219,7 @@ void PipelineResourceSignatureD3D11Impl::CreateLayout(const bool IsSerialized)
                 {
                     const Int32  ShaderInd = ExtractFirstShaderStageIndex(ShaderStages);
                     const Uint16 BindPoint = Uint16{BindPoints[ShaderInd]};
-                    for (Uint32 elem = 0; elem < ResDesc.ArraySize; ++elem)
+                    for (Uint32 elem = 0; elem < ResDesc.GetArraySize(); ++elem)
                     {
                         VERIFY_EXPR(BindPoint + elem < Uint32{sizeof(m_DynamicCBSlotsMask[0]) * 8});
                         m_DynamicCBSlotsMask[ShaderInd] |= 1u << (BindPoint + elem);
@@ -289,7 +289,7 @@ void PipelineResourceSignatureD3D11Impl::CopyStaticResources(ShaderResourceCache
         switch (ShaderResourceTypeToRange(ResDesc.ResourceType))
         {
             case D3D11_RESOURCE_RANGE_CBV:
-                for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                 {
                     if (!DstResourceCache.CopyResource<D3D11_RESOURCE_RANGE_CBV>(SrcResourceCache, ResAttr.BindPoints + ArrInd))
                     {
@@ -299,7 +299,7 @@ void PipelineResourceSignatureD3D11Impl::CopyStaticResources(ShaderResourceCache
                 }
                 break;
             case D3D11_RESOURCE_RANGE_SRV:
-                for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                 {
                     if (!DstResourceCache.CopyResource<D3D11_RESOURCE_RANGE_SRV>(SrcResourceCache, ResAttr.BindPoints + ArrInd))
                     {
@@ -311,7 +311,7 @@ void PipelineResourceSignatureD3D11Impl::CopyStaticResources(ShaderResourceCache
             case D3D11_RESOURCE_RANGE_SAMPLER:
                 if (!ResAttr.IsImmutableSamplerAssigned())
                 {
-                    for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                    for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                     {
                         if (!DstResourceCache.CopyResource<D3D11_RESOURCE_RANGE_SAMPLER>(SrcResourceCache, ResAttr.BindPoints + ArrInd))
                         {
@@ -323,7 +323,7 @@ void PipelineResourceSignatureD3D11Impl::CopyStaticResources(ShaderResourceCache
 #ifdef DILIGENT_DEBUG
                 else if (DstCacheType == ResourceCacheContentType::SRB)
                 {
-                    for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                    for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                     {
                         VERIFY(DstResourceCache.IsResourceBound<D3D11_RESOURCE_RANGE_SAMPLER>(ResAttr.BindPoints + ArrInd),
                                "Immutable samplers must have been initialized by InitSRBResourceCache(). Null sampler is a bug.");
@@ -332,7 +332,7 @@ void PipelineResourceSignatureD3D11Impl::CopyStaticResources(ShaderResourceCache
 #endif
                 break;
             case D3D11_RESOURCE_RANGE_UAV:
-                for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                 {
                     if (!DstResourceCache.CopyResource<D3D11_RESOURCE_RANGE_UAV>(SrcResourceCache, ResAttr.BindPoints + ArrInd))
                     {
@@ -390,7 +390,7 @@ void PipelineResourceSignatureD3D11Impl::UpdateShaderResourceBindingMap(Resource
                 {
                     Uint32{BaseBindings[Range][ShaderInd]} + Uint32{ResAttr.BindPoints[ShaderInd]},
                     0u, // register space is not supported
-                    ResDesc.ArraySize,
+                    ResDesc.GetArraySize(),
                     ResDesc.ResourceType //
                 };
             bool IsUnique = ResourceMap.emplace(HashMapStringKey{ResDesc.Name}, BindInfo).second;
@@ -457,7 +457,7 @@ bool PipelineResourceSignatureD3D11Impl::DvpValidateCommittedResource(const D3DS
     const PipelineResourceAttribsD3D11& ResAttr = m_pResourceAttribs[ResIndex];
     VERIFY(strcmp(ResDesc.Name, D3DAttribs.Name) == 0, "Inconsistent resource names");
 
-    VERIFY_EXPR(D3DAttribs.BindCount <= ResDesc.ArraySize);
+    VERIFY_EXPR(D3DAttribs.BindCount <= ResDesc.GetArraySize());
 
     bool BindingsOK = true;
     switch (ShaderResourceTypeToRange(ResDesc.ResourceType))
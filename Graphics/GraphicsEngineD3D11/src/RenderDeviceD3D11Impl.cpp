@@ -59,6 +59,26 @@ class TopLevelASD3D11Impl
 class ShaderBindingTableD3D11Impl
 {};
 
+static Uint32 GetDynamicConstantRingPageSize(ID3D11Device* pd3d11Device, const EngineD3D11CreateInfo& EngineCI)
+{
+    if (EngineCI.DynamicConstantRingPageSize == 0)
+        return 0;
+
+    // Suballocated constant buffers are bound with first-constant offsets and
+    // their pages are mapped with D3D11_MAP_WRITE_NO_OVERWRITE.
+    D3D11_FEATURE_DATA_D3D11_OPTIONS d3d11Options{};
+    if (FAILED(pd3d11Device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &d3d11Options, sizeof(d3d11Options))) ||
+        !d3d11Options.ConstantBufferOffsetting ||
+        !d3d11Options.MapNoOverwriteOnDynamicConstantBuffer)
+    {
+        LOG_INFO_MESSAGE("Dynamic constant ring is disabled as the device does not support constant buffer offsets "
+                         "or D3D11_MAP_WRITE_NO_OVERWRITE for dynamic constant buffers");
+        return 0;
+    }
+
+    return EngineCI.DynamicConstantRingPageSize;
+}
+
 RenderDeviceD3D11Impl::RenderDeviceD3D11Impl(IReferenceCounters*          pRefCounters,
                                              IMemoryAllocator&            RawMemAllocator,
                                              IEngineFactory*              pEngineFactory,
@@ -77,6 +97,7 @@ RenderDeviceD3D11Impl::RenderDeviceD3D11Impl(IReferenceCounters*          pRefCo
     m_Properties
     {
         EngineCI.D3D11ValidationFlags,
+        GetDynamicConstantRingPageSize(pd3d11Device, EngineCI),
     },
     m_pd3d11Device{pd3d11Device}
 // clang-format on
@@ -326,6 +347,18 @@ void RenderDeviceD3D11Impl::CreateQuery(const QueryDesc& Desc, IQuery** ppQuery)
     CreateQueryImpl(ppQuery, Desc);
 }
 
+void RenderDeviceD3D11Impl::CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool)
+{
+    UNSUPPORTED("CreateQueryPool is not supported in DirectX 11");
+    *ppQueryPool = nullptr;
+}
+
+void RenderDeviceD3D11Impl::CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc, IIndirectCommandSignature** ppSignature)
+{
+    UNSUPPORTED("CreateIndirectCommandSignature is not supported in DirectX 11");
+    *ppSignature = nullptr;
+}
+
 void RenderDeviceD3D11Impl::CreateRenderPass(const RenderPassDesc& Desc, IRenderPass** ppRenderPass)
 {
     CreateRenderPassImpl(ppRenderPass, Desc);
@@ -383,6 +416,18 @@ void RenderDeviceD3D11Impl::CreateDeviceMemory(const DeviceMemoryCreateInfo& Cre
     CreateDeviceMemoryImpl(ppMemory, CreateInfo);
 }
 
+void RenderDeviceD3D11Impl::CreatePlacedTexture(const TextureDesc& TexDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, ITexture** ppTexture)
+{
+    UNSUPPORTED("CreatePlacedTexture is not supported in Direct3D11");
+    *ppTexture = nullptr;
+}
+
+void RenderDeviceD3D11Impl::CreatePlacedBuffer(const BufferDesc& BuffDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, IBuffer** ppBuffer)
+{
+    UNSUPPORTED("CreatePlacedBuffer is not supported in Direct3D11");
+    *ppBuffer = nullptr;
+}
+
 void RenderDeviceD3D11Impl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                      IPipelineStateCache**               ppPSOCache)
 {
@@ -391,6 +436,17 @@ void RenderDeviceD3D11Impl::CreatePipelineStateCache(const PipelineStateCacheCre
 
 void RenderDeviceD3D11Impl::CreateDeferredContext(IDeviceContext** ppDeferredContext)
 {
+    D3D11_FEATURE_DATA_THREADING ThreadingCaps{};
+    if (SUCCEEDED(m_pd3d11Device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &ThreadingCaps, sizeof(ThreadingCaps))) &&
+        !ThreadingCaps.DriverCommandLists)
+    {
+        // When the driver does not support command lists, the runtime emulates them by recording
+        // and replaying every API call. Recording the engine commands is cheaper, as the replay
+        // skips redundant state changes and does not go through the runtime twice.
+        CreateRecordingDeferredContext(ppDeferredContext);
+        return;
+    }
+
     CComPtr<ID3D11DeviceContext> pd3d11DeferredCtx;
 
     HRESULT hr = m_pd3d11Device->CreateDeferredContext(0, &pd3d11DeferredCtx);
@@ -436,4 +492,15 @@ SparseTextureFormatInfo RenderDeviceD3D11Impl::GetSparseTextureFormatInfo(TEXTUR
     return TRenderDeviceBase::GetSparseTextureFormatInfo(TexFormat, Dimension, SampleCount);
 }
 
+ResourceMemoryRequirements RenderDeviceD3D11Impl::GetTextureMemoryRequirements(const TextureDesc& TexDesc) const
+{
+    // Placed resources are not supported in Direct3D11
+    return {};
+}
+
+ResourceMemoryRequirements RenderDeviceD3D11Impl::GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const
+{
+    return {};
+}
+
 } // namespace Diligent
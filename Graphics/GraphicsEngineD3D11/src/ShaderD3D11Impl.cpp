@@ -106,7 +106,7 @@ ShaderD3D11Impl::ShaderD3D11Impl(IReferenceCounters*     pRefCounters,
         D3D11ShaderCI,
         IsDeviceInternal,
         GetD3D11ShaderModel(D3D11ShaderCI.FeatureLevel, ShaderCI.HLSLVersion),
-        [LoadConstantBufferReflection = ShaderCI.LoadConstantBufferReflection](const ShaderDesc& Desc, IDataBlob* pShaderByteCode) {
+        [LoadConstantBufferReflection = ShaderCI.LoadConstantBufferReflection](const ShaderDesc& Desc, IDataBlob* pShaderByteCode, const D3DShaderArchiveData* pArchiveData) {
             IMemoryAllocator&     Allocator  = GetRawAllocator();
             ShaderResourcesD3D11* pRawMem    = ALLOCATE(Allocator, "Allocator for ShaderResources", ShaderResourcesD3D11, 1);
             ShaderResourcesD3D11* pResources = new (pRawMem) ShaderResourcesD3D11 //
@@ -115,6 +115,7 @@ ShaderD3D11Impl::ShaderD3D11Impl(IReferenceCounters*     pRefCounters,
                     Desc,
                     Desc.UseCombinedTextureSamplers ? Desc.CombinedSamplerSuffix : nullptr,
                     LoadConstantBufferReflection,
+                    pArchiveData,
                 };
             return std::shared_ptr<const ShaderResourcesD3D11>{pResources, STDDeleterRawMem<ShaderResourcesD3D11>(Allocator)};
         },
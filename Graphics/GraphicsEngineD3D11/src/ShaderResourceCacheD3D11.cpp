@@ -349,7 +349,7 @@ void ShaderResourceCacheD3D11::DbgVerifyDynamicBufferMasks() const
             const Uint32    BuffBit = 1u << i;
             const CachedCB& CB      = CBArrays.first[i];
 
-            const bool IsDynamicOffset = CB.AllowsDynamicOffset() && (m_DynamicCBSlotsMask[ShaderInd] & BuffBit) != 0;
+            const bool IsDynamicOffset = CB.IsDynamic() && (m_DynamicCBSlotsMask[ShaderInd] & BuffBit) != 0;
             VERIFY(IsDynamicOffset == ((m_DynamicCBOffsetsMask[ShaderInd] & BuffBit) != 0), "Bit ", i, " in m_DynamicCBOffsetsMask is not valid");
         }
     }
@@ -44,10 +44,11 @@ Uint32 GetRegisterSpace<>(const D3D11_SHADER_INPUT_BIND_DESC&)
     return 0;
 }
 
-ShaderResourcesD3D11::ShaderResourcesD3D11(const IDataBlob*  pShaderBytecode,
-                                           const ShaderDesc& ShdrDesc,
-                                           const char*       CombinedSamplerSuffix,
-                                           bool              LoadConstantBufferReflection) :
+ShaderResourcesD3D11::ShaderResourcesD3D11(const IDataBlob*            pShaderBytecode,
+                                           const ShaderDesc&           ShdrDesc,
+                                           const char*                 CombinedSamplerSuffix,
+                                           bool                        LoadConstantBufferReflection,
+                                           const D3DShaderArchiveData* pArchiveData) :
     ShaderResources{ShdrDesc.ShaderType}
 {
     class NewResourceHandler
@@ -118,6 +119,13 @@ ShaderResourcesD3D11::ShaderResourcesD3D11(const IDataBlob*  pShaderBytecode,
         ShaderResourcesD3D11& Resources;
     };
 
+    if (pArchiveData != nullptr)
+    {
+        VERIFY(!LoadConstantBufferReflection, "Constant buffer reflection is not stored in the archive");
+        Initialize(*pArchiveData, NewResourceHandler{ShdrDesc, CombinedSamplerSuffix, *this}, ShdrDesc.Name, CombinedSamplerSuffix);
+        return;
+    }
+
     CComPtr<ID3D11ShaderReflection> pShaderReflection;
     HRESULT                         hr = D3DReflect(pShaderBytecode->GetConstDataPtr(), pShaderBytecode->GetSize(), __uuidof(pShaderReflection), reinterpret_cast<void**>(&pShaderReflection));
     CHECK_D3D_RESULT_THROW(hr, "Failed to get the shader reflection");
@@ -148,11 +148,17 @@ void SwapChainD3D11Impl::Present(Uint32 SyncInterval)
     }
 
     // In contrast to MSDN sample, we wait for the frame as late as possible - right
-    // before presenting.
+    // before presenting. In low-latency mode, we wait right after presenting instead,
+    // so that the application samples input for the next frame after the wait.
     // https://docs.microsoft.com/en-us/windows/uwp/gaming/reduce-latency-with-dxgi-1-3-swap-chains#step-4-wait-before-rendering-each-frame
-    WaitForFrame();
+    const bool LowLatency = m_SwapChainDesc.LatencyMode == SWAP_CHAIN_LATENCY_MODE_LOW;
+    if (!LowLatency)
+        WaitForFrame();
 
     PresentInternal(SyncInterval);
+
+    if (LowLatency)
+        WaitForFrame();
 }
 
 void SwapChainD3D11Impl::UpdateSwapChain(bool CreateNew)
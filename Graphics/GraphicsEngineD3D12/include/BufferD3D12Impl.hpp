@@ -61,6 +61,14 @@ public:
                     const BufferDesc&          BuffDesc,
                     RESOURCE_STATE             InitialState,
                     ID3D12Resource*            pd3d12Buffer);
+
+    // Creates a new D3D12 resource placed in the device memory
+    BufferD3D12Impl(IReferenceCounters*        pRefCounters,
+                    FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                    RenderDeviceD3D12Impl*     pDeviceD3D12,
+                    const BufferDesc&          BuffDesc,
+                    IDeviceMemory*             pMemory,
+                    Uint64                     MemoryOffset);
     ~BufferD3D12Impl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_BufferD3D12, TBufferBase)
@@ -84,6 +92,12 @@ public:
     /// Implementation of IBufferD3D12::GetD3D12ResourceState().
     virtual D3D12_RESOURCE_STATES DILIGENT_CALL_TYPE GetD3D12ResourceState() const override final;
 
+    /// Implementation of IBufferD3D12::SetResidencyPriority().
+    virtual void DILIGENT_CALL_TYPE SetResidencyPriority(D3D12_RESIDENCY_PRIORITY Priority) override final;
+
+    /// Implementation of IBufferD3D12::CreateSharedHandle().
+    virtual HANDLE DILIGENT_CALL_TYPE CreateSharedHandle() const override final;
+
     /// Implementation of IBuffer::GetSparseProperties().
     virtual SparseBufferProperties DILIGENT_CALL_TYPE GetSparseProperties() const override final;
 
@@ -97,6 +111,13 @@ public:
 
     void CreateCBV(D3D12_CPU_DESCRIPTOR_HANDLE CBVDescriptor, Uint64 Offset = 0, Uint64 Size = 0) const;
 
+    /// Returns the size of the D3D12 resource for the given buffer description, in bytes.
+    static Uint64 GetD3D12BufferSize(const BufferDesc& BuffDesc);
+
+    /// Returns the D3D12 resource description for the given buffer description.
+    /// BuffDesc.Size must already be aligned with GetD3D12BufferSize().
+    static D3D12_RESOURCE_DESC GetD3D12BufferDesc(const BufferDesc& BuffDesc);
+
 private:
     virtual void CreateViewInternal(const struct BufferViewDesc& ViewDesc, IBufferView** ppView, bool bIsDefaultView) override;
 
@@ -104,6 +125,9 @@ private:
     void CreateSRV(struct BufferViewDesc& SRVDesc, D3D12_CPU_DESCRIPTOR_HANDLE SRVDescriptor) const;
 
     DescriptorHeapAllocation m_CBVDescriptorAllocation;
+
+    // Device memory that the placed buffer resides in
+    RefCntAutoPtr<IDeviceMemory> m_pPlacedMemory;
 };
 
 } // namespace Diligent
@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "DeviceContext.h"
+#include "IndexWrapper.hpp"
 #include "D3D12ResourceBase.hpp"
 #include "DescriptorHeap.hpp"
 
@@ -82,6 +83,19 @@ public:
     ID3D12GraphicsCommandList* Close(CComPtr<ID3D12CommandAllocator>& pAllocator);
     void                       Reset(CommandListManager& CmdListManager);
 
+    // Keeps the allocator that was used to record the command list submitted to the command queue
+    // with the given fence value. The context reuses the allocator when it is reset after the fence
+    // has completed, so that allocator memory stays resident and worker threads recording command
+    // lists do not contend for the shared allocator pool.
+    void RetireAllocator(CComPtr<ID3D12CommandAllocator>&& pAllocator,
+                         SoftwareQueueIndex                CmdQueue,
+                         Uint64                            FenceValue,
+                         CommandListManager&               CmdListManager);
+
+    // Returns all allocators kept by the context to their command list managers.
+    // The GPU must have finished using the allocators.
+    void ReleaseRetiredAllocators();
+
     class GraphicsContext&  AsGraphicsContext();
     class GraphicsContext1& AsGraphicsContext1();
     class GraphicsContext2& AsGraphicsContext2();
@@ -138,13 +152,33 @@ public:
 
     void FlushResourceBarriers()
     {
-        if (!m_PendingResourceBarriers.empty())
-        {
-            m_pCommandList->ResourceBarrier(static_cast<UINT>(m_PendingResourceBarriers.size()), m_PendingResourceBarriers.data());
-            m_PendingResourceBarriers.clear();
-        }
+        FlushLegacyBarriers();
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+        FlushEnhancedBarriers();
+#endif
     }
 
+    // Returns true if the context uses enhanced barriers (ID3D12GraphicsCommandList7::Barrier) for state transitions
+    bool UseEnhancedBarriers() const { return m_UseEnhancedBarriers; }
+
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    // Legacy and enhanced barriers are kept in separate lists. To preserve the order in which the barriers
+    // were added, pending barriers of one kind are flushed before a barrier of the other kind is added.
+    void TextureBarrier(const D3D12_TEXTURE_BARRIER& Barrier)
+    {
+        VERIFY_EXPR(m_UseEnhancedBarriers);
+        FlushLegacyBarriers();
+        m_PendingTextureBarriers.emplace_back(Barrier);
+    }
+
+    void BufferBarrier(const D3D12_BUFFER_BARRIER& Barrier)
+    {
+        VERIFY_EXPR(m_UseEnhancedBarriers);
+        FlushLegacyBarriers();
+        m_PendingBufferBarriers.emplace_back(Barrier);
+    }
+#endif
+
 
     struct ShaderDescriptorHeaps
     {
@@ -191,6 +225,9 @@ public:
 
     void ResourceBarrier(const D3D12_RESOURCE_BARRIER& Barrier)
     {
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+        FlushEnhancedBarriers();
+#endif
         m_PendingResourceBarriers.emplace_back(Barrier);
     }
 
@@ -252,14 +289,72 @@ public:
 protected:
     void InsertAliasBarrier(D3D12ResourceBase& Before, D3D12ResourceBase& After, bool FlushImmediate = false);
 
+    void FlushLegacyBarriers()
+    {
+        if (!m_PendingResourceBarriers.empty())
+        {
+            m_pCommandList->ResourceBarrier(static_cast<UINT>(m_PendingResourceBarriers.size()), m_PendingResourceBarriers.data());
+            m_PendingResourceBarriers.clear();
+        }
+    }
+
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    void FlushEnhancedBarriers()
+    {
+        D3D12_BARRIER_GROUP BarrierGroups[2];
+        UINT32              NumGroups = 0;
+        if (!m_PendingBufferBarriers.empty())
+        {
+            D3D12_BARRIER_GROUP& Group = BarrierGroups[NumGroups++];
+            Group.Type                 = D3D12_BARRIER_TYPE_BUFFER;
+            Group.NumBarriers          = static_cast<UINT32>(m_PendingBufferBarriers.size());
+            Group.pBufferBarriers      = m_PendingBufferBarriers.data();
+        }
+        if (!m_PendingTextureBarriers.empty())
+        {
+            D3D12_BARRIER_GROUP& Group = BarrierGroups[NumGroups++];
+            Group.Type                 = D3D12_BARRIER_TYPE_TEXTURE;
+            Group.NumBarriers          = static_cast<UINT32>(m_PendingTextureBarriers.size());
+            Group.pTextureBarriers     = m_PendingTextureBarriers.data();
+        }
+
+        if (NumGroups > 0)
+        {
+            static_cast<ID3D12GraphicsCommandList7*>(m_pCommandList.p)->Barrier(NumGroups, BarrierGroups);
+            m_PendingBufferBarriers.clear();
+            m_PendingTextureBarriers.clear();
+        }
+    }
+#endif
+
     CComPtr<ID3D12GraphicsCommandList> m_pCommandList;
     CComPtr<ID3D12CommandAllocator>    m_pCurrentAllocator;
 
+    struct RetiredAllocator
+    {
+        CComPtr<ID3D12CommandAllocator> pAllocator;
+        // Contexts of the same type may be used with different queues,
+        // so the allocator must be returned to the manager that created it.
+        CommandListManager*             pCmdListManager;
+        SoftwareQueueIndex              CmdQueue;
+        Uint64                          FenceValue;
+    };
+    // The maximum number of submitted allocators that the context keeps for reuse.
+    // Older allocators are returned to the command list manager.
+    static constexpr size_t MaxRetiredAllocators = 3;
+
+    // Allocators in the order they were submitted
+    std::vector<RetiredAllocator> m_RetiredAllocators;
+
     void*                m_pCurPipelineState         = nullptr;
     ID3D12RootSignature* m_pCurGraphicsRootSignature = nullptr;
     ID3D12RootSignature* m_pCurComputeRootSignature  = nullptr;
 
     std::vector<D3D12_RESOURCE_BARRIER, STDAllocatorRawMem<D3D12_RESOURCE_BARRIER>> m_PendingResourceBarriers;
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    std::vector<D3D12_TEXTURE_BARRIER, STDAllocatorRawMem<D3D12_TEXTURE_BARRIER>> m_PendingTextureBarriers;
+    std::vector<D3D12_BUFFER_BARRIER, STDAllocatorRawMem<D3D12_BUFFER_BARRIER>>   m_PendingBufferBarriers;
+#endif
 
     ShaderDescriptorHeaps m_BoundDescriptorHeaps;
 
@@ -270,6 +365,8 @@ protected:
     D3D12_PRIMITIVE_TOPOLOGY m_PrimitiveTopology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
 
     Uint32 m_MaxInterfaceVer = 0;
+
+    bool m_UseEnhancedBarriers = false;
 };
 
 class ComputeContext : public CommandContext
@@ -368,6 +465,11 @@ public:
 
 class GraphicsContext1 : public GraphicsContext
 {
+public:
+    void SetViewInstanceMask(UINT Mask)
+    {
+        static_cast<ID3D12GraphicsCommandList1*>(m_pCommandList.p)->SetViewInstanceMask(Mask);
+    }
 };
 
 class GraphicsContext2 : public GraphicsContext1
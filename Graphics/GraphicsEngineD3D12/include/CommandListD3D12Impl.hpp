@@ -45,7 +45,8 @@ public:
     CommandListD3D12Impl(IReferenceCounters*                           pRefCounters,
                          RenderDeviceD3D12Impl*                        pDevice,
                          DeviceContextD3D12Impl*                       pDeferredCtx,
-                         RenderDeviceD3D12Impl::PooledCommandContext&& pCmdContext) :
+                         RenderDeviceD3D12Impl::PooledCommandContext&& pCmdContext,
+                         SoftwareQueueIndex                            CmdQueueId) :
         // clang-format off
         TCommandListBase
         {
@@ -54,15 +55,25 @@ public:
             pDeferredCtx
         },
         m_pDeferredCtx{pDeferredCtx          },
-        m_pCmdContext {std::move(pCmdContext)}
+        m_pCmdContext {std::move(pCmdContext)},
+        m_CmdQueueId  {CmdQueueId            }
     // clang-format on
     {
         VERIFY_EXPR(m_pCmdContext);
+        if (IsReusable())
+        {
+            // Reusable command list is closed once and keeps its allocator until it is destroyed
+            m_pd3d12CmdList = m_pCmdContext->Close(m_pAllocator);
+        }
     }
 
     ~CommandListD3D12Impl()
     {
-        if (m_pCmdContext != nullptr)
+        if (IsReusable())
+        {
+            m_pDevice->DisposeReusableCommandContext(std::move(m_pCmdContext), std::move(m_pAllocator), m_CmdQueueId, m_LastSubmittedFenceValue);
+        }
+        else if (m_pCmdContext != nullptr)
         {
             LOG_WARNING_MESSAGE("Destroying command list that has not been executed");
             m_pDevice->DisposeCommandContext(std::move(m_pCmdContext));
@@ -75,13 +86,28 @@ public:
 
     RenderDeviceD3D12Impl::PooledCommandContext Close(RefCntAutoPtr<DeviceContextD3D12Impl>& pDeferredCtx)
     {
+        VERIFY(!IsReusable(), "Reusable command lists must not be closed");
         pDeferredCtx = std::move(m_pDeferredCtx);
         return std::move(m_pCmdContext);
     }
 
+    // Reusable command list accessors
+    ID3D12CommandList*      GetD3D12CommandList() const { return m_pd3d12CmdList; }
+    DeviceContextD3D12Impl* GetDeferredContext() const { return m_pDeferredCtx; }
+    SoftwareQueueIndex      GetCommandQueueId() const { return m_CmdQueueId; }
+
+    void SetLastSubmittedFenceValue(Uint64 FenceValue) { m_LastSubmittedFenceValue = FenceValue; }
+
 private:
     RefCntAutoPtr<DeviceContextD3D12Impl>       m_pDeferredCtx;
     RenderDeviceD3D12Impl::PooledCommandContext m_pCmdContext;
+
+    const SoftwareQueueIndex m_CmdQueueId;
+
+    // Closed command list and its allocator, only used by reusable command lists
+    ID3D12CommandList*              m_pd3d12CmdList = nullptr;
+    CComPtr<ID3D12CommandAllocator> m_pAllocator;
+    Uint64                          m_LastSubmittedFenceValue = 0;
 };
 
 } // namespace Diligent
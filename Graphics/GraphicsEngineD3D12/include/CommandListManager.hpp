@@ -73,6 +73,12 @@ public:
         return m_CmdListType;
     }
 
+    // Returns true if command lists created by this manager should use enhanced barriers
+    bool UseEnhancedBarriers() const;
+
+    // Returns the last completed fence value of the command queue
+    Uint64 GetCompletedFenceValue(SoftwareQueueIndex CmdQueue) const;
+
 private:
     std::mutex                                                                                        m_AllocatorMutex;
     std::vector<CComPtr<ID3D12CommandAllocator>, STDAllocatorRawMem<CComPtr<ID3D12CommandAllocator>>> m_FreeAllocators;
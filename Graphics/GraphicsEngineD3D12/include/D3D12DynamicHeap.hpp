@@ -76,7 +76,7 @@ struct D3D12DynamicAllocation
 class D3D12DynamicPage
 {
 public:
-    D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size);
+    D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size, bool UseGPUUploadHeap = false);
 
     // clang-format off
     D3D12DynamicPage            (const D3D12DynamicPage&)  = delete;
@@ -125,7 +125,8 @@ public:
     D3D12DynamicMemoryManager(IMemoryAllocator&      Allocator,
                               RenderDeviceD3D12Impl& DeviceD3D12Impl,
                               Uint32                 NumPagesToReserve,
-                              Uint64                 PageSize);
+                              Uint64                 PageSize,
+                              Uint64                 GPUUploadBudget);
     ~D3D12DynamicMemoryManager();
 
     // clang-format off
@@ -141,6 +142,10 @@ public:
 
     D3D12DynamicPage AllocatePage(Uint64 SizeInBytes);
 
+    // Returns the total size of the upload pages created by the manager, including the pages in use
+    Uint64 GetTotalPageSize() const { return m_TotalPageSize.load(); }
+    Uint64 GetPeakTotalPageSize() const { return m_PeakTotalPageSize.load(); }
+
 #ifdef DILIGENT_DEVELOPMENT
     Int32 GetAllocatedPageCounter() const
     {
@@ -149,8 +154,17 @@ public:
 #endif
 
 private:
+    D3D12DynamicPage CreatePage(Uint64 SizeInBytes);
+
     RenderDeviceD3D12Impl& m_DeviceD3D12Impl;
 
+    std::atomic<Uint64> m_TotalPageSize{0};
+    std::atomic<Uint64> m_PeakTotalPageSize{0};
+
+    // The maximum total size of the pages created in the GPU upload heap
+    const Uint64        m_GPUUploadBudget;
+    std::atomic<Uint64> m_GPUUploadPageSize{0};
+
     std::mutex m_AvailablePagesMtx;
     using AvailablePagesMapElemType = std::pair<const Uint64, D3D12DynamicPage>;
     std::multimap<Uint64, D3D12DynamicPage, std::less<Uint64>, STDAllocatorRawMem<AvailablePagesMapElemType>> m_AvailablePages;
@@ -30,6 +30,8 @@
 /// \file
 /// Implementation of the Diligent::D3D12ResourceBase class
 
+#include "ResidencyManagerD3D12.hpp"
+
 namespace Diligent
 {
 
@@ -42,8 +44,17 @@ public:
 
     ID3D12Resource* GetD3D12Resource() const { return m_pd3d12Resource; }
 
+    // Informs the residency manager that the resource is referenced by the command list being recorded
+    void MarkReferencedByCommandList() { m_ResidencyObject.MarkUsed(); }
+
+    ResidencyObjectD3D12& GetResidencyObject() { return m_ResidencyObject; }
+
 protected:
     CComPtr<ID3D12Resource> m_pd3d12Resource; ///< D3D12 resource object
+
+    // Residency state of m_pd3d12Resource. The resource is only tracked by the residency manager
+    // if residency management is enabled and the resource is a committed resource in the default heap.
+    ResidencyObjectD3D12 m_ResidencyObject;
 };
 
 } // namespace Diligent
@@ -81,6 +81,14 @@ D3D12_RESOURCE_STATES     ResourceStateFlagsToD3D12ResourceStates(RESOURCE_STATE
 RESOURCE_STATE            D3D12ResourceStatesToResourceStateFlags(D3D12_RESOURCE_STATES StateFlags);
 D3D12_RESOURCE_STATES     GetSupportedD3D12ResourceStatesForCommandList(D3D12_COMMAND_LIST_TYPE CmdListType);
 
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+// Enhanced barrier sync scope, access and texture layout that correspond to the legacy resource states.
+// The layout is compatible with the legacy state, so that enhanced and legacy barriers can be mixed for the same resource.
+D3D12_BARRIER_SYNC   D3D12ResourceStatesToD3D12BarrierSync(D3D12_RESOURCE_STATES States);
+D3D12_BARRIER_ACCESS D3D12ResourceStatesToD3D12BarrierAccess(D3D12_RESOURCE_STATES States);
+D3D12_BARRIER_LAYOUT D3D12ResourceStatesToD3D12BarrierLayout(D3D12_RESOURCE_STATES States);
+#endif
+
 D3D12_QUERY_HEAP_TYPE QueryTypeToD3D12QueryHeapType(QUERY_TYPE QueryType, HardwareQueueIndex QueueId);
 D3D12_QUERY_TYPE      QueryTypeToD3D12QueryType(QUERY_TYPE QueryType);
 
@@ -32,12 +32,13 @@
 
 #include <mutex>
 #include <vector>
+#include <array>
 #include <queue>
 #include <string>
 #include <unordered_set>
 #include <atomic>
 
-#include "VariableSizeAllocationsManager.hpp"
+#include "TLSFAllocationsManager.hpp"
 
 namespace Diligent
 {
@@ -240,7 +241,7 @@ private:
 
 
 // The class performs suballocations within one D3D12 descriptor heap.
-// It uses VariableSizeAllocationsManager to manage free space in the heap
+// It uses TLSFAllocationsManager to manage free space in the heap
 //
 // |  X  X  X  X  O  O  O  X  X  O  O  X  O  O  O  O  |  D3D12 descriptor heap
 //
@@ -342,8 +343,8 @@ private:
     Uint32 m_NumDescriptorsInAllocation = 0;
 
     // Allocations manager used to handle descriptor allocations within the heap
-    std::mutex                     m_FreeBlockManagerMutex;
-    VariableSizeAllocationsManager m_FreeBlockManager;
+    std::mutex             m_FreeBlockManagerMutex;
+    TLSFAllocationsManager m_FreeBlockManager;
 
     // Strong reference to D3D12 descriptor heap object
     CComPtr<ID3D12DescriptorHeap> m_pd3d12DescriptorHeap;
@@ -386,6 +387,11 @@ private:
 // Render device contains four CPUDescriptorHeap object instances (one for each D3D12 heap type). The heaps are accessed
 // when a texture or a buffer view is created.
 //
+// Single-descriptor requests (every texture view, buffer view and sampler) are served from a set of small caches
+// of free descriptors. Every thread uses the cache selected by its id, so threads that create views concurrently
+// rarely contend for the same lock. m_HeapPoolMutex is only taken when a cache needs to be refilled from
+// the managers or trimmed, and descriptors are moved in batches of SingleDescriptorBatchSize.
+//
 class CPUDescriptorHeap final : public IDescriptorAllocator
 {
 public:
@@ -416,6 +422,14 @@ public:
 private:
     void FreeAllocation(DescriptorHeapAllocation&& Allocation);
 
+    // The following methods must be called with m_HeapPoolMutex locked
+    DescriptorHeapAllocation AllocateFromPool(uint32_t Count);
+    void                     FreeToPool(DescriptorHeapAllocation&& Allocation);
+
+    struct SingleDescriptorCache;
+    SingleDescriptorCache& GetSingleDescriptorCache();
+    void                   ReleaseSingleDescriptorCaches();
+
     IMemoryAllocator&      m_MemAllocator;
     RenderDeviceD3D12Impl& m_DeviceD3D12Impl;
 
@@ -428,9 +442,22 @@ private:
     D3D12_DESCRIPTOR_HEAP_DESC m_HeapDesc;
     const UINT                 m_DescriptorSize = 0;
 
+    static constexpr size_t NumSingleDescriptorCaches = 16;
+    static constexpr size_t SingleDescriptorBatchSize = 32;
+
+    struct SingleDescriptorCache
+    {
+        std::mutex                            Mtx;
+        std::vector<DescriptorHeapAllocation> Allocations;
+    };
+    std::array<SingleDescriptorCache, NumSingleDescriptorCaches> m_SingleDescriptorCaches;
+
+    // The total number of descriptors held in the single-descriptor caches
+    std::atomic<Uint32> m_NumCachedDescriptors{0};
+
     // Maximum heap size during the application lifetime - for statistic purposes
-    Uint32 m_MaxSize     = 0;
-    Uint32 m_CurrentSize = 0;
+    std::atomic<Uint32> m_MaxSize{0};
+    std::atomic<Uint32> m_CurrentSize{0};
 };
 
 // GPU descriptor heap provides storage for shader-visible descriptors
@@ -573,6 +600,9 @@ public:
 
     size_t GetSuballocationCount() const { return m_Suballocations.size(); }
 
+    // Sets the counter that is incremented every time descriptors are allocated.
+    void SetAllocationCounter(Uint32* pCounter) { m_pAllocationCounter = pCounter; }
+
 private:
     // Parent GPU descriptor heap that is used to allocate chunks
     GPUDescriptorHeap& m_ParentGPUHeap;
@@ -589,6 +619,8 @@ private:
     Uint32 m_PeakDescriptorCount         = 0;
     Uint32 m_CurrSuballocationsTotalSize = 0;
     Uint32 m_PeakSuballocationsTotalSize = 0;
+
+    Uint32* m_pAllocationCounter = nullptr;
 };
 
 } // namespace Diligent
@@ -69,7 +69,7 @@ public:
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DeviceContextD3D12, TDeviceContextBase)
 
     /// Implementation of IDeviceContext::Begin() in Direct3D12 backend.
-    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::SetPipelineState() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
@@ -87,6 +87,17 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetCullMode() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode) override final;
+
+    /// Implementation of IDeviceContext::SetDepthState() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE SetDepthState(Bool                DepthEnable,
+                                                  Bool                DepthWriteEnable,
+                                                  COMPARISON_FUNCTION DepthFunc) override final;
+
+    /// Implementation of IDeviceContext::SetPrimitiveTopology() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -136,6 +147,8 @@ public:
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::ExecuteIndirectCommands() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawMesh() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE DrawMesh           (const DrawMeshAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawMeshIndirect() in Direct3D12 backend.
@@ -164,6 +177,9 @@ public:
                                                       const void*                    RGBA,
                                                       RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateRenderTargets() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                                  Uint64                         Offset,
@@ -246,6 +262,15 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::BeginPoolQuery() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::EndPoolQuery() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::ResolvePoolQueries() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs) override final;
+
     /// Implementation of IDeviceContext::Flush() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -294,6 +319,23 @@ public:
     /// Implementation of IDeviceContextD3D12::ID3D12GraphicsCommandList() in Direct3D12 backend.
     virtual ID3D12GraphicsCommandList* DILIGENT_CALL_TYPE GetD3D12CommandList() override final;
 
+    /// Implementation of IDeviceContextD3D12::BeginSubmissionBatch() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE BeginSubmissionBatch() override final;
+
+    /// Implementation of IDeviceContextD3D12::EndSubmissionBatch() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE EndSubmissionBatch() override final;
+
+    // Submits command lists accumulated by the active submission batch, if any.
+    // The batch remains active.
+    void SubmitBatchedCommandLists();
+
+    // Submits command contexts and reusable command lists in the order they are given in pContexts.
+    // Null entries in pContexts correspond to reusable command lists.
+    void ExecuteWithReusableCommandLists(Uint32                                      NumContexts,
+                                         RenderDeviceD3D12Impl::PooledCommandContext pContexts[],
+                                         Uint32                                      NumCommandLists,
+                                         ICommandList* const*                        ppCommandLists);
+
     /// Implementation of IDeviceContext::SetShadingRate() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetShadingRate(SHADING_RATE          BaseRate,
                                                    SHADING_RATE_COMBINER PrimitiveCombiner,
@@ -351,7 +393,7 @@ public:
                              const Box&                     DstBox,
                              RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode);
 
-    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView) override final;
+    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags) override final;
 
     D3D12DynamicAllocation AllocateDynamicSpace(Uint64 NumBytes, Uint32 Alignment);
 
@@ -422,6 +464,10 @@ private:
     struct RootTableInfo : CommittedShaderResources
     {
         ID3D12RootSignature* pd3d12RootSig = nullptr;
+
+        // Dynamic descriptor tables last committed for every resource signature.
+        // They are only valid until the command list is closed or the frame is finished.
+        std::array<PipelineResourceSignatureD3D12Impl::CommittedDynamicTables, MAX_RESOURCE_SIGNATURES> DynamicTables{};
     };
     __forceinline RootTableInfo& GetRootTableInfo(PIPELINE_TYPE PipelineType);
 
@@ -429,12 +475,16 @@ private:
     __forceinline void CommitRootTablesAndViews(RootTableInfo& RootInfo, Uint32 CommitSRBMask, CommandContext& CmdCtx) const;
 
 #ifdef DILIGENT_DEVELOPMENT
-    void DvpValidateCommittedShaderResources(RootTableInfo& RootInfo) const;
+    void DvpValidateCommittedShaderResources(RootTableInfo& RootInfo);
 #endif
 
     ID3D12CommandSignature* GetDrawIndirectSignature(Uint32 Stride);
     ID3D12CommandSignature* GetDrawIndexedIndirectSignature(Uint32 Stride);
 
+    // Returns the scratch buffer of the single-pass mip generator that is large enough
+    // to process NumArraySlices slices, or null if the buffer could not be created.
+    BufferD3D12Impl* GetMipsScratchBuffer(Uint32 NumArraySlices);
+
     struct TextureUploadSpace
     {
         D3D12DynamicAllocation Allocation;
@@ -478,6 +528,9 @@ private:
 
         // Indicates if shading rate map was bound in previous CommitRenderTargets() call
         bool bShadingRateMapBound = false;
+
+        // Indicates if extended dynamic states have changed since the pipeline variant was set
+        bool bDynamicStatePSODirty = false;
     } m_State;
 
     RootTableInfo m_GraphicsResources;
@@ -501,6 +554,17 @@ private:
     std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>> m_SignalFences;
     std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>> m_WaitFences;
 
+    struct SubmissionBatch
+    {
+        bool IsActive = false;
+
+        // Closed command contexts that will be submitted when the batch ends
+        std::vector<RenderDeviceD3D12Impl::PooledCommandContext> Contexts;
+
+        // Fences that must be signaled after the contexts are submitted
+        std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>> SignalFences;
+    } m_SubmissionBatch;
+
     struct MappedTextureKey
     {
         TextureD3D12Impl* const Texture;
@@ -540,6 +604,10 @@ private:
 
     // Null render targets require a null RTV. NULL descriptor causes an error.
     DescriptorHeapAllocation m_NullRTV;
+
+    // Atomic counters and intermediate values of the single-pass mip generator.
+    // Every context uses its own buffer as the counters are updated by the dispatches.
+    RefCntAutoPtr<BufferD3D12Impl> m_pMipsScratchBuffer;
 };
 
 __forceinline D3D12_GPU_VIRTUAL_ADDRESS DeviceContextD3D12Impl::GetBufferGPUAddress(const BufferD3D12Impl* pBuffer, bool VerifyDynamicAllocation) const
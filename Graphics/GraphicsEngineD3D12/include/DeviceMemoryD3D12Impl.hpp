@@ -64,6 +64,12 @@ public:
     /// Implementation of IDeviceMemoryD3D12::IsUsingNVApi().
     virtual Bool DILIGENT_CALL_TYPE IsUsingNVApi() const override final { return m_UseNVApi; }
 
+    /// Creates a D3D12 resource at the given offset in the memory of DEVICE_MEMORY_TYPE_PLACED type.
+    CComPtr<ID3D12Resource> CreatePlacedResource(const D3D12_RESOURCE_DESC& d3d12Desc,
+                                                 Uint64                     Offset,
+                                                 const D3D12_CLEAR_VALUE*   pClearValue,
+                                                 const char*                ResourceName) const noexcept(false);
+
 private:
     D3D12_HEAP_FLAGS m_d3d12HeapFlags = D3D12_HEAP_FLAG_NONE;
     bool             m_AllowMSAA      = false;
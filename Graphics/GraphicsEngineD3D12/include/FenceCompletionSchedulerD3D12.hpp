@@ -0,0 +1,60 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::FenceCompletionSchedulerD3D12 class
+
+#include "FenceCompletionScheduler.hpp"
+
+namespace Diligent
+{
+
+/// Fence completion scheduler that waits for all pending fences with
+/// ID3D12Device1::SetEventOnMultipleFenceCompletion() and WaitForMultipleObjects().
+class FenceCompletionSchedulerD3D12 final : public FenceCompletionScheduler
+{
+public:
+    explicit FenceCompletionSchedulerD3D12(ID3D12Device1* pd3d12Device1);
+    ~FenceCompletionSchedulerD3D12();
+
+private:
+    virtual void WaitForAny(const std::vector<FenceWaitInfo>& Fences) override final;
+    virtual void WakeUp() override final;
+
+    CComPtr<ID3D12Device1> m_pd3d12Device1;
+
+    // Auto-reset events signaled by the fences and by WakeUp()
+    HANDLE m_FenceEvent  = NULL;
+    HANDLE m_WakeUpEvent = NULL;
+
+    std::vector<ID3D12Fence*> m_d3d12Fences;
+    std::vector<UINT64>       m_Values;
+};
+
+} // namespace Diligent
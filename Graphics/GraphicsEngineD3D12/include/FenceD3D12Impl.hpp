@@ -61,6 +61,9 @@ public:
     /// Implementation of IFenceD3D12::GetD3D12Fence().
     virtual ID3D12Fence* DILIGENT_CALL_TYPE GetD3D12Fence() override final { return m_pd3d12Fence; }
 
+    /// Implementation of IFenceD3D12::CreateSharedHandle().
+    virtual HANDLE DILIGENT_CALL_TYPE CreateSharedHandle() override final;
+
 private:
     /// Access to the fence internal data is thread safe.
     CComPtr<ID3D12Fence> m_pd3d12Fence; ///< D3D12 Fence object
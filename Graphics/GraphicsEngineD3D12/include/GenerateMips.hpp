@@ -57,12 +57,33 @@ class GenerateMipsHelper
 public:
     GenerateMipsHelper(ID3D12Device* pd3d12Device);
 
-    void GenerateMips(ID3D12Device* pd3d12Device, class TextureViewD3D12Impl* pTexView, class CommandContext& Ctx) const;
+    /// Generates the mip chain for the texture view.
+
+    /// \param [in] pd3d12Device       - D3D12 device.
+    /// \param [in] pTexView           - Texture view to generate mips for.
+    /// \param [in] Ctx                - Command context to record the commands to.
+    /// \param [in] pSinglePassScratch - If not null, the single-pass downsampler is used, and this buffer
+    ///                                  holds the atomic counters and intermediate values. The buffer must be
+    ///                                  at least GetSinglePassScratchBufferSize() bytes large, and its
+    ///                                  counters must be initialized with zeros.
+    ///                                  The shader resets the counters at the end of every dispatch.
+    void GenerateMips(ID3D12Device*               pd3d12Device,
+                      class TextureViewD3D12Impl* pTexView,
+                      class CommandContext&       Ctx,
+                      class BufferD3D12Impl*      pSinglePassScratch = nullptr) const;
+
+    /// Returns the size of the scratch buffer required by the single-pass downsampler
+    /// to process the given number of array slices.
+    static Uint64 GetSinglePassScratchBufferSize(Uint32 NumArraySlices);
 
 private:
     CComPtr<ID3D12RootSignature> m_pGenerateMipsRS;
     CComPtr<ID3D12PipelineState> m_pGenerateMipsLinearPSO[4];
     CComPtr<ID3D12PipelineState> m_pGenerateMipsGammaPSO[4];
+
+    CComPtr<ID3D12RootSignature> m_pSinglePassRS;
+    CComPtr<ID3D12PipelineState> m_pSinglePassLinearPSO;
+    CComPtr<ID3D12PipelineState> m_pSinglePassGammaPSO;
 };
 
 } // namespace Diligent
@@ -144,6 +144,17 @@ public:
     // Make the base class method visible
     using TPipelineResourceSignatureBase::CopyStaticResources;
 
+    // Dynamic descriptor tables that were last committed by the device context for a resource cache.
+    // If the cache revision has not changed, the tables are reused instead of being copied again.
+    struct CommittedDynamicTables
+    {
+        Uint64 CacheRevision = 0;
+
+        std::array<ID3D12DescriptorHeap*, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1>       pHeaps{};
+        std::array<D3D12_GPU_DESCRIPTOR_HANDLE, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1> GPUHandles{};
+        std::array<Uint32, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1>                      DescriptorSizes{};
+    };
+
     struct CommitCacheResourcesAttribs
     {
         ID3D12Device* const             pd3d12Device;
@@ -152,6 +163,7 @@ public:
         const bool                      IsCompute;
         const ShaderResourceCacheD3D12* pResourceCache = nullptr;
         Uint32                          BaseRootIndex  = ~0u;
+        CommittedDynamicTables*         pDynamicTables = nullptr;
     };
     void CommitRootTables(const CommitCacheResourcesAttribs& CommitAttribs) const;
 
@@ -29,6 +29,8 @@
 /// \file
 /// Declaration of Diligent::PipelineStateCacheD3D12Impl class
 
+#include <vector>
+
 #include "EngineD3D12ImplTraits.hpp"
 #include "PipelineStateCacheBase.hpp"
 
@@ -54,10 +56,21 @@ public:
     CComPtr<ID3D12DeviceChild> LoadComputePipeline(const wchar_t* Name, const D3D12_COMPUTE_PIPELINE_STATE_DESC& Desc);
     CComPtr<ID3D12DeviceChild> LoadGraphicsPipeline(const wchar_t* Name, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& Desc);
 
+#ifdef D3D12_H_HAS_MESH_SHADER
+    /// Loads a pipeline described by the pipeline state stream (e.g. a mesh shader pipeline).
+    /// Requires ID3D12PipelineLibrary1 interface; returns null if it is not supported.
+    CComPtr<ID3D12DeviceChild> LoadPipeline(const wchar_t* Name, const D3D12_PIPELINE_STATE_STREAM_DESC& Desc);
+#endif
+
     bool StorePipeline(const wchar_t* Name, ID3D12DeviceChild* pPSO);
 
 private:
-    CComPtr<ID3D12PipelineLibrary> m_pLibrary;
+    CComPtr<ID3D12PipelineLibrary>  m_pLibrary;
+    CComPtr<ID3D12PipelineLibrary1> m_pLibrary1;
+
+    // D3D12 pipeline library references the serialized data it was created from
+    // rather than copying it, so the data must be kept alive for the library lifetime.
+    std::vector<Uint8> m_LibraryData;
 };
 
 } // namespace Diligent
@@ -31,6 +31,9 @@
 /// Declaration of Diligent::PipelineStateD3D12Impl class
 
 #include <vector>
+#include <mutex>
+#include <unordered_map>
+#include <memory>
 
 #include "EngineD3D12ImplTraits.hpp"
 #include "PipelineStateBase.hpp"
@@ -72,6 +75,11 @@ public:
 
     const RootSignatureD3D12& GetRootSignature() const { return *m_RootSig; }
 
+    /// Returns the D3D12 pipeline state that matches the given extended dynamic states.
+    /// The variant is created on first use. Only valid for pipelines created with
+    /// PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE.
+    ID3D12PipelineState* GetD3D12PipelineState(const ExtendedDynamicStates& States);
+
 #ifdef DILIGENT_DEVELOPMENT
     using ShaderResourceCacheArrayType = std::array<ShaderResourceCacheD3D12*, MAX_RESOURCE_SIGNATURES>;
     void DvpVerifySRBResources(const DeviceContextD3D12Impl*       pDeviceCtx,
@@ -89,6 +97,7 @@ public:
         SHADER_TYPE                           Type = SHADER_TYPE_UNKNOWN;
         std::vector<const ShaderD3D12Impl*>   Shaders;
         std::vector<RefCntAutoPtr<IDataBlob>> ByteCodes;
+        Uint32                                ViewMask = 0;
 
         friend SHADER_TYPE GetShaderStageType(const ShaderStageInfo& Stage) { return Stage.Type; }
     };
@@ -139,6 +148,22 @@ private:
     CComPtr<ID3D12DeviceChild>        m_pd3d12PSO;
     RefCntAutoPtr<RootSignatureD3D12> m_RootSig;
 
+    // Direct3D12 has no dynamic cull mode and depth states, so pipelines created with
+    // PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE keep the description they were created from
+    // and lazily create one pipeline variant per unique combination of dynamic states.
+    struct DynamicStateVariants
+    {
+        D3D12_GRAPHICS_PIPELINE_STATE_DESC    d3d12PSODesc = {};
+        std::vector<D3D12_INPUT_ELEMENT_DESC> InputElements;
+        std::vector<RefCntAutoPtr<IDataBlob>> ByteCodes;
+        Uint32                                ViewMask = 0;
+
+        std::mutex Mtx;
+
+        std::unordered_map<ExtendedDynamicStates, CComPtr<ID3D12PipelineState>, ExtendedDynamicStates::Hasher> Variants;
+    };
+    std::unique_ptr<DynamicStateVariants> m_pDynamicStateVariants;
+
     // NB:  Pipeline resource signatures used to create the PSO may NOT be the same as
     //      pipeline resource signatures in m_RootSig, because the latter may be used from the
     //      cache. While the two signatures may be compatible, they resource names may not be identical.
@@ -0,0 +1,63 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::QueryPoolD3D12Impl class
+
+#include "WinHPreface.h"
+#include <atlbase.h>
+#include "WinHPostface.h"
+
+#include "QueryPoolBase.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceD3D12Impl;
+
+/// Query pool implementation in Direct3D12 backend.
+class QueryPoolD3D12Impl final : public QueryPoolBase<RenderDeviceD3D12Impl>
+{
+public:
+    using TQueryPoolBase = QueryPoolBase<RenderDeviceD3D12Impl>;
+
+    QueryPoolD3D12Impl(IReferenceCounters*    pRefCounters,
+                       RenderDeviceD3D12Impl* pDevice,
+                       const QueryPoolDesc&   Desc);
+    ~QueryPoolD3D12Impl();
+
+    ID3D12QueryHeap* GetD3D12QueryHeap() const { return m_pd3d12QueryHeap; }
+    D3D12_QUERY_TYPE GetD3D12QueryType() const { return m_d3d12QueryType; }
+
+private:
+    CComPtr<ID3D12QueryHeap> m_pd3d12QueryHeap;
+    const D3D12_QUERY_TYPE   m_d3d12QueryType;
+};
+
+} // namespace Diligent
@@ -46,6 +46,7 @@
 #include "GenerateMips.hpp"
 #include "DXCompiler.hpp"
 #include "RootSignature.hpp"
+#include "ResidencyManagerD3D12.hpp"
 
 
 // The macros below are only defined in Win SDK 19041+ and are missing in 17763
@@ -129,6 +130,13 @@ public:
     /// Implementation of IRenderDevice::CreateQuery() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE CreateQuery(const QueryDesc& Desc, IQuery** ppQuery) override final;
 
+    /// Implementation of IRenderDevice::CreateQueryPool() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool) override final;
+
+    /// Implementation of IRenderDevice::CreateIndirectCommandSignature() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc,
+                                                                   IIndirectCommandSignature**         ppSignature) override final;
+
     /// Implementation of IRenderDevice::CreateRenderPass() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE CreateRenderPass(const RenderPassDesc& Desc,
                                                      IRenderPass**         ppRenderPass) override final;
@@ -166,6 +174,18 @@ public:
     virtual void DILIGENT_CALL_TYPE CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
                                                        IDeviceMemory**               ppMemory) override final;
 
+    /// Implementation of IRenderDevice::CreatePlacedTexture() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE CreatePlacedTexture(const TextureDesc& TexDesc,
+                                                        IDeviceMemory*     pMemory,
+                                                        Uint64             MemoryOffset,
+                                                        ITexture**         ppTexture) override final;
+
+    /// Implementation of IRenderDevice::CreatePlacedBuffer() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE CreatePlacedBuffer(const BufferDesc& BuffDesc,
+                                                       IDeviceMemory*    pMemory,
+                                                       Uint64            MemoryOffset,
+                                                       IBuffer**         ppBuffer) override final;
+
     /// Implementation of IRenderDevice::CreatePipelineStateCache() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                              IPipelineStateCache**               ppPSOCache) override final;
@@ -178,6 +198,12 @@ public:
                                                                                   RESOURCE_DIMENSION Dimension,
                                                                                   Uint32             SampleCount) const override final;
 
+    /// Implementation of IRenderDevice::GetTextureMemoryRequirements() in Direct3D12 backend.
+    virtual ResourceMemoryRequirements DILIGENT_CALL_TYPE GetTextureMemoryRequirements(const TextureDesc& TexDesc) const override final;
+
+    /// Implementation of IRenderDevice::GetBufferMemoryRequirements() in Direct3D12 backend.
+    virtual ResourceMemoryRequirements DILIGENT_CALL_TYPE GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const override final;
+
     /// Implementation of IRenderDeviceD3D12::GetD3D12Device().
     virtual ID3D12Device* DILIGENT_CALL_TYPE GetD3D12Device() const override final { return m_pd3d12Device; }
 
@@ -210,6 +236,13 @@ public:
         return m_pDxCompiler.get();
     }
 
+    /// Implementation of IRenderDeviceD3D12::CreateStorageQueue().
+    virtual void DILIGENT_CALL_TYPE CreateStorageQueue(const StorageQueueCreateInfoD3D12& CreateInfo,
+                                                       IStorageQueueD3D12**               ppStorageQueue) override final;
+
+    /// Implementation of IRenderDeviceD3D12::GetMemoryUsage().
+    virtual void DILIGENT_CALL_TYPE GetMemoryUsage(MemoryUsageD3D12& Usage) const override final;
+
     void CreateRootSignature(const RefCntAutoPtr<class PipelineResourceSignatureD3D12Impl>* ppSignatures, Uint32 SignatureCount, size_t Hash, RootSignatureD3D12** ppRootSig);
 
     RootSignatureCacheD3D12& GetRootSignatureCache() { return m_RootSignatureCache; }
@@ -243,6 +276,17 @@ public:
     // Disposes an unused command context
     void DisposeCommandContext(PooledCommandContext&& Ctx);
 
+    // Submits a command list that has already been closed by a reusable command list.
+    // Returns the fence value associated with the submission.
+    Uint64 ExecuteClosedCommandList(SoftwareQueueIndex CommandQueueId, ID3D12CommandList* pd3d12CmdList);
+
+    // Disposes the command context of a reusable command list. The allocator is released
+    // once the GPU reaches LastFenceValue (zero if the list has never been executed).
+    void DisposeReusableCommandContext(PooledCommandContext&&            Ctx,
+                                       CComPtr<ID3D12CommandAllocator>&& pAllocator,
+                                       SoftwareQueueIndex                CommandQueueId,
+                                       Uint64                            LastFenceValue);
+
     void FlushStaleResources(SoftwareQueueIndex CommandQueueId);
 
     /// Implementation of IRenderDevice::() in Direct3D12 backend.
@@ -294,8 +338,21 @@ public:
 
     const Properties& GetProperties() const { return m_Properties; }
 
+    // Returns true if resource state transitions should use enhanced barriers
+    bool AreEnhancedBarriersEnabled() const { return m_EnhancedBarriersEnabled; }
+
+    // Returns the residency manager, or null if residency management is disabled
+    ResidencyManagerD3D12* GetResidencyManager() const { return m_pResidencyMgr.get(); }
+
+    // Starts tracking the residency of the committed resource if residency management is enabled
+    void RegisterResidencyObject(D3D12ResourceBase& Resource, const D3D12_RESOURCE_DESC& d3d12Desc);
+
+    void SetResidencyPriority(D3D12ResourceBase& Resource, D3D12_RESIDENCY_PRIORITY Priority);
+
 private:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
+
+    virtual std::unique_ptr<FenceCompletionScheduler> CreateFenceCompletionScheduler() override final;
     void         FreeCommandContext(PooledCommandContext&& Ctx);
 
     CommandListManager& GetCmdListManager(SoftwareQueueIndex CommandQueueId);
@@ -306,6 +363,10 @@ private:
 
     CComPtr<ID3D12Device> m_pd3d12Device;
 
+    // The compiler library is loaded on a background thread while the remaining
+    // members are initialized, so the compiler must be created first.
+    std::unique_ptr<IDXCompiler> m_pDxCompiler;
+
     CPUDescriptorHeap m_CPUDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES];
     GPUDescriptorHeap m_GPUDescriptorHeaps[2]; // D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV == 0
                                                // D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER	 == 1
@@ -323,8 +384,6 @@ private:
     // Note: mips generator must be released after the device has been idled
     GenerateMipsHelper m_MipsGenerator;
 
-    std::unique_ptr<IDXCompiler> m_pDxCompiler;
-
     FixedBlockMemoryAllocator m_RootSignatureAllocator;
     RootSignatureCacheD3D12   m_RootSignatureCache;
 
@@ -334,7 +393,13 @@ private:
     // Dummy heap required by NvAPI_D3D12_CreateReservedResource.
     CComPtr<ID3D12Heap> m_pNVApiHeap;
 
+    // Adapter used to query video memory info. May be null on systems that do not support IDXGIAdapter3.
+    CComPtr<IDXGIAdapter3> m_pDXGIAdapter3;
+
+    std::unique_ptr<ResidencyManagerD3D12> m_pResidencyMgr;
+
     bool m_IsPSOCacheSupported = false;
+    bool m_EnhancedBarriersEnabled = false;
 
 #ifdef DILIGENT_DEVELOPMENT
     Uint32 m_MaxD3D12DeviceVersion = 0;
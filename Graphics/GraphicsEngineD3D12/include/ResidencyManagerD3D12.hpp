@@ -0,0 +1,164 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ResidencyManagerD3D12 class
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <deque>
+
+#include "WinHPreface.h"
+#include <dxgi1_4.h>
+#include "WinHPostface.h"
+
+#include "IndexWrapper.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceD3D12Impl;
+class ResidencyManagerD3D12;
+
+/// Residency state of a D3D12 pageable object tracked by the residency manager
+class ResidencyObjectD3D12
+{
+public:
+    ResidencyObjectD3D12() noexcept {}
+    ~ResidencyObjectD3D12();
+
+    // clang-format off
+    ResidencyObjectD3D12           (const ResidencyObjectD3D12&)  = delete;
+    ResidencyObjectD3D12           (      ResidencyObjectD3D12&&) = delete;
+    ResidencyObjectD3D12& operator=(const ResidencyObjectD3D12&)  = delete;
+    ResidencyObjectD3D12& operator=(      ResidencyObjectD3D12&&) = delete;
+    // clang-format on
+
+    // Marks the object as used by the command list that is currently being recorded
+    // and makes it resident if it has been evicted.
+    __forceinline void MarkUsed();
+
+    bool IsManaged() const { return m_pManager != nullptr; }
+
+private:
+    friend ResidencyManagerD3D12;
+
+    ResidencyManagerD3D12* m_pManager  = nullptr;
+    ID3D12Pageable*        m_pPageable = nullptr;
+    Uint64                 m_Size      = 0;
+
+    D3D12_RESIDENCY_PRIORITY m_Priority = D3D12_RESIDENCY_PRIORITY_NORMAL;
+
+    // Index of the object in the manager's list
+    size_t m_Index = ~size_t{0};
+
+    // The frame in which the object was last referenced by a command list
+    std::atomic<Uint64> m_LastUsedFrame{0};
+
+    std::atomic<bool> m_IsResident{true};
+};
+
+/// Implements residency management for D3D12 resources.
+
+/// The manager tracks committed resources and the frame in which every resource was last
+/// referenced by a command list. Once per frame, the manager queries the local video memory
+/// budget with IDXGIAdapter3::QueryVideoMemoryInfo. If the current usage exceeds the budget,
+/// the manager evicts resources that are no longer used by the GPU, starting with the ones
+/// with the lowest residency priority and the least recently used ones. Evicted resources are
+/// made resident again when they are referenced by a command list.
+class ResidencyManagerD3D12
+{
+public:
+    ResidencyManagerD3D12(RenderDeviceD3D12Impl& DeviceD3D12Impl, ID3D12Device1* pd3d12Device1, IDXGIAdapter3* pAdapter);
+    ~ResidencyManagerD3D12();
+
+    // clang-format off
+    ResidencyManagerD3D12           (const ResidencyManagerD3D12&)  = delete;
+    ResidencyManagerD3D12           (      ResidencyManagerD3D12&&) = delete;
+    ResidencyManagerD3D12& operator=(const ResidencyManagerD3D12&)  = delete;
+    ResidencyManagerD3D12& operator=(      ResidencyManagerD3D12&&) = delete;
+    // clang-format on
+
+    // Starts tracking the residency of the pageable object.
+    // The object remains tracked until Obj is destroyed.
+    void RegisterObject(ResidencyObjectD3D12& Obj, ID3D12Pageable* pPageable, Uint64 Size);
+
+    void SetPriority(ResidencyObjectD3D12& Obj, D3D12_RESIDENCY_PRIORITY Priority);
+
+    // Evicts least recently used objects if the video memory usage exceeds the budget.
+    // Must be called once per frame.
+    void Update();
+
+    Uint64 GetCurrentFrame() const { return m_CurrentFrame.load(); }
+
+private:
+    friend ResidencyObjectD3D12;
+
+    void UnregisterObject(ResidencyObjectD3D12& Obj);
+    void MakeResident(ResidencyObjectD3D12& Obj);
+
+    RenderDeviceD3D12Impl&  m_DeviceD3D12Impl;
+    CComPtr<IDXGIAdapter3>  m_pAdapter;
+    CComPtr<ID3D12Device1>  m_pd3d12Device1;
+    std::atomic<Uint64>     m_CurrentFrame{1};
+
+    std::mutex                         m_ObjectsMtx;
+    std::vector<ResidencyObjectD3D12*> m_Objects;
+
+    struct FrameFences
+    {
+        // The frame that ended
+        Uint64 Frame = 0;
+
+        // Last fence values submitted to every queue by the end of the frame
+        std::vector<Uint64> Fences;
+    };
+    // Fence values recorded at the end of the frames which objects may still be used by the GPU
+    std::deque<FrameFences> m_PendingFrames;
+
+    // Objects last used in this frame or earlier are no longer used by the GPU
+    Uint64 m_LastCompletedFrame = 0;
+};
+
+__forceinline void ResidencyObjectD3D12::MarkUsed()
+{
+    if (m_pManager == nullptr)
+        return;
+
+    // The manager sets m_IsResident to false before it reads m_LastUsedFrame when it evicts
+    // the object, while we write m_LastUsedFrame before reading m_IsResident. Since both
+    // operations are sequentially consistent, either the manager sees the new frame and keeps
+    // the object resident, or we see that the object is being evicted and make it resident again.
+    m_LastUsedFrame.store(m_pManager->GetCurrentFrame());
+    if (!m_IsResident.load())
+        m_pManager->MakeResident(*this);
+}
+
+} // namespace Diligent
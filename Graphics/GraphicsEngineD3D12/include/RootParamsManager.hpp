@@ -185,6 +185,7 @@ public:
     RootParamsBuilder();
 
     // Allocates root parameter slot for the given resource attributes.
+    // For D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS, ArraySize is the number of 32-bit constants.
     void AllocateResourceSlot(SHADER_TYPE                   ShaderStages,
                               SHADER_RESOURCE_VARIABLE_TYPE VariableType,
                               D3D12_ROOT_PARAMETER_TYPE     RootParameterType,
@@ -204,7 +205,8 @@ private:
                                UINT                      Register,
                                UINT                      RegisterSpace,
                                D3D12_SHADER_VISIBILITY   Visibility,
-                               ROOT_PARAMETER_GROUP      RootType);
+                               ROOT_PARAMETER_GROUP      RootType,
+                               UINT                      Num32BitValues = 0);
 
     struct RootTableData;
     // Adds a new root table parameter and returns the reference to it.
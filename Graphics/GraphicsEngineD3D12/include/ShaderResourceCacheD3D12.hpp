@@ -104,6 +104,7 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 
 #include "Shader.h"
 #include "DescriptorHeap.hpp"
@@ -121,7 +122,8 @@ class ShaderResourceCacheD3D12 : public ShaderResourceCacheBase
 {
 public:
     explicit ShaderResourceCacheD3D12(ResourceCacheContentType ContentType) noexcept :
-        m_ContentType{ContentType}
+        m_ContentType{ContentType},
+        m_Revision{GenerateRevision()}
     {
         for (auto& HeapIndex : m_AllocationIndex)
             HeapIndex.fill(-1);
@@ -159,6 +161,7 @@ public:
 
     static constexpr Uint32 InvalidDescriptorOffset = ~0u;
 
+    // sizeof(Resource) == 40 (x64, msvc, Release)
     struct Resource
     {
         Resource() noexcept {}
@@ -186,17 +189,21 @@ public:
             }
         }
 
-        SHADER_RESOURCE_TYPE Type = SHADER_RESOURCE_TYPE_UNKNOWN;
-
-        Uint64 BufferDynamicOffset = 0;
+        // clang-format off
+/* 0 */ SHADER_RESOURCE_TYPE Type = SHADER_RESOURCE_TYPE_UNKNOWN;
+/*1-3*/ // Unused
+        // Dynamic offsets are set through IShaderResourceVariable::SetBufferOffset() that takes 32-bit values
+/* 4 */ Uint32 BufferDynamicOffset = 0;
 
         // CPU descriptor handle of a cached resource in CPU-only descriptor heap.
         // This handle may be null for CBVs that address the buffer range.
-        D3D12_CPU_DESCRIPTOR_HANDLE  CPUDescriptorHandle = {};
-        RefCntAutoPtr<IDeviceObject> pObject;
+/* 8 */ D3D12_CPU_DESCRIPTOR_HANDLE  CPUDescriptorHandle = {};
+/*16 */ RefCntAutoPtr<IDeviceObject> pObject;
 
-        Uint64 BufferBaseOffset = 0;
-        Uint64 BufferRangeSize  = 0;
+/*24 */ Uint64 BufferBaseOffset = 0;
+/*32 */ Uint64 BufferRangeSize  = 0;
+/*40 */ // End of structure
+        // clang-format on
 
         bool IsNull() const { return pObject == nullptr; }
 
@@ -264,11 +271,33 @@ public:
                                 Uint32     OffsetFromTableStart,
                                 Resource&& SrcRes);
 
-    // Copies the resource to the given root index and offset from the table start
-    const Resource& CopyResource(ID3D12Device*   pd3d12Device,
-                                 Uint32          RootIndex,
-                                 Uint32          OffsetFromTableStart,
-                                 const Resource& SrcRes);
+    // Collects descriptor copies so that they can be performed with a single
+    // ID3D12Device::CopyDescriptors call per descriptor heap type.
+    class DescriptorCopyBatch
+    {
+    public:
+        void Add(D3D12_DESCRIPTOR_HEAP_TYPE HeapType, D3D12_CPU_DESCRIPTOR_HANDLE DstHandle, D3D12_CPU_DESCRIPTOR_HANDLE SrcHandle)
+        {
+            VERIFY_EXPR(HeapType == D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV || HeapType == D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+            m_DstHandles[HeapType].push_back(DstHandle);
+            m_SrcHandles[HeapType].push_back(SrcHandle);
+        }
+
+        // Performs all collected copies and clears the batch
+        void Flush(ID3D12Device* pd3d12Device);
+
+    private:
+        std::array<std::vector<D3D12_CPU_DESCRIPTOR_HANDLE>, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1> m_DstHandles;
+        std::array<std::vector<D3D12_CPU_DESCRIPTOR_HANDLE>, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1> m_SrcHandles;
+    };
+
+    // Copies the resource to the given root index and offset from the table start.
+    // If pCopyBatch is not null, the descriptor copy is deferred until the batch is flushed.
+    const Resource& CopyResource(ID3D12Device*        pd3d12Device,
+                                 Uint32               RootIndex,
+                                 Uint32               OffsetFromTableStart,
+                                 const Resource&      SrcRes,
+                                 DescriptorCopyBatch* pCopyBatch = nullptr);
 
     // Resets the resource at the given root index and offset from the table start to default state
     const Resource& ResetResource(Uint32 RootIndex,
@@ -331,6 +360,10 @@ public:
     // Transitions all resources in the cache
     void TransitionResourceStates(CommandContext& Ctx, StateTransitionMode Mode);
 
+    // Informs the residency manager that all buffers and textures in the cache are referenced
+    // by the command list being recorded
+    void MarkResourcesReferencedByCommandList();
+
     ResourceCacheContentType GetContentType() const { return m_ContentType; }
 
     // Returns the bitmask indicating root views with bound dynamic buffers (including buffer ranges)
@@ -339,6 +372,10 @@ public:
     // Returns the bitmask indicating root views with bound non-dynamic buffers
     Uint64 GetNonDynamicRootBuffersMask() const { return m_NonDynamicRootBuffersMask; }
 
+    // Returns the cache revision that changes every time a resource is set.
+    // Revisions are unique across all caches, so the revision alone identifies the cache contents.
+    Uint64 GetRevision() const { return m_Revision; }
+
     // Returns true if the cache contains at least one dynamic resource, i.e.
     // dynamic buffer or a buffer range.
     bool HasDynamicResources() const { return GetDynamicRootBuffersMask() != 0; }
@@ -362,6 +399,9 @@ private:
 
     size_t AllocateMemory(IMemoryAllocator& MemAllocator);
 
+    // Returns a new revision that is unique across all resource caches
+    static Uint64 GenerateRevision();
+
 private:
     static constexpr Uint32 MaxRootTables = 64;
 
@@ -392,6 +432,8 @@ private:
 
     // The bitmask indicating root views with bound non-dynamic buffers
     Uint64 m_NonDynamicRootBuffersMask = Uint64{0};
+
+    Uint64 m_Revision = Uint64{0};
 };
 
 } // namespace Diligent
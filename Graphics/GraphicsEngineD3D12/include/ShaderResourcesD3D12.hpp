@@ -39,12 +39,14 @@ namespace Diligent
 class ShaderResourcesD3D12 final : public ShaderResources
 {
 public:
-    // Loads shader resources from the compiled shader bytecode
-    ShaderResourcesD3D12(IDataBlob*          pShaderBytecode,
-                         const ShaderDesc&   ShdrDesc,
-                         const char*         CombinedSamplerSuffix,
-                         struct IDXCompiler* pDXCompiler,
-                         bool                LoadConstantBufferReflection);
+    // Loads shader resources from the compiled shader bytecode or, if pArchiveData is not null,
+    // from the reflection stored in the device object archive.
+    ShaderResourcesD3D12(IDataBlob*                  pShaderBytecode,
+                         const ShaderDesc&           ShdrDesc,
+                         const char*                 CombinedSamplerSuffix,
+                         struct IDXCompiler*         pDXCompiler,
+                         bool                        LoadConstantBufferReflection,
+                         const D3DShaderArchiveData* pArchiveData = nullptr);
 
     // clang-format off
     ShaderResourcesD3D12             (const ShaderResourcesD3D12&)  = delete;
@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::StorageQueueD3D12Impl class
+
+#include <mutex>
+#include <unordered_map>
+
+#include "WinHPreface.h"
+#include <dstorage.h>
+#include "WinHPostface.h"
+
+#include "StorageQueueD3D12.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceD3D12Impl;
+
+/// Implementation of the Diligent::IStorageQueueD3D12 interface
+class StorageQueueD3D12Impl final : public ObjectBase<IStorageQueueD3D12>
+{
+public:
+    using TBase = ObjectBase<IStorageQueueD3D12>;
+
+    StorageQueueD3D12Impl(IReferenceCounters*                pRefCounters,
+                          RenderDeviceD3D12Impl*             pDevice,
+                          const StorageQueueCreateInfoD3D12& CreateInfo);
+    ~StorageQueueD3D12Impl();
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_StorageQueueD3D12, TBase)
+
+    // Implementation of IStorageQueueD3D12::EnqueueRead().
+    virtual bool DILIGENT_CALL_TYPE EnqueueRead(const StorageReadRequestD3D12& Request) override final;
+
+    // Implementation of IStorageQueueD3D12::EnqueueSignal().
+    virtual void DILIGENT_CALL_TYPE EnqueueSignal(IFence* pFence, Uint64 Value) override final;
+
+    // Implementation of IStorageQueueD3D12::Submit().
+    virtual void DILIGENT_CALL_TYPE Submit() override final;
+
+    // Implementation of IStorageQueueD3D12::GetNumFailedRequests().
+    virtual Uint32 DILIGENT_CALL_TYPE GetNumFailedRequests() override final;
+
+    // Implementation of IStorageQueueD3D12::CloseFiles().
+    virtual void DILIGENT_CALL_TYPE CloseFiles() override final;
+
+    // Implementation of IStorageQueueD3D12::GetDStorageQueue().
+    virtual IDStorageQueue* DILIGENT_CALL_TYPE GetDStorageQueue() override final { return m_pDStorageQueue; }
+
+private:
+    // Returns the file opened by the queue, opening it if necessary.
+    IDStorageFile* GetFile(const Char* FilePath);
+
+    RefCntAutoPtr<RenderDeviceD3D12Impl> m_pDevice;
+
+    CComPtr<IDStorageFactory> m_pDStorageFactory;
+    CComPtr<IDStorageQueue>   m_pDStorageQueue;
+
+    std::mutex                                              m_FilesMtx;
+    std::unordered_map<std::string, CComPtr<IDStorageFile>> m_Files;
+};
+
+} // namespace Diligent
@@ -53,6 +53,14 @@ public:
                      const TextureDesc&         TexDesc,
                      const TextureData*         pInitData = nullptr);
 
+    // Creates a new D3D12 resource placed in the device memory
+    TextureD3D12Impl(IReferenceCounters*        pRefCounters,
+                     FixedBlockMemoryAllocator& TexViewObjAllocator,
+                     RenderDeviceD3D12Impl*     pDeviceD3D12,
+                     const TextureDesc&         TexDesc,
+                     IDeviceMemory*             pMemory,
+                     Uint64                     MemoryOffset);
+
     // Attaches to an existing D3D12 resource
     TextureD3D12Impl(IReferenceCounters*          pRefCounters,
                      FixedBlockMemoryAllocator&   TexViewObjAllocator,
@@ -76,7 +84,15 @@ public:
     /// Implementation of ITextureD3D12::GetD3D12ResourceState().
     virtual D3D12_RESOURCE_STATES DILIGENT_CALL_TYPE GetD3D12ResourceState() const override final;
 
-    D3D12_RESOURCE_DESC GetD3D12TextureDesc() const;
+    /// Implementation of ITextureD3D12::SetResidencyPriority().
+    virtual void DILIGENT_CALL_TYPE SetResidencyPriority(D3D12_RESIDENCY_PRIORITY Priority) override final;
+
+    /// Implementation of ITextureD3D12::CreateSharedHandle().
+    virtual HANDLE DILIGENT_CALL_TYPE CreateSharedHandle() const override final;
+
+    D3D12_RESOURCE_DESC GetD3D12TextureDesc() const { return GetD3D12TextureDesc(m_Desc); }
+
+    static D3D12_RESOURCE_DESC GetD3D12TextureDesc(const TextureDesc& TexDesc);
 
     const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& GetStagingFootprint(Uint32 Subresource)
     {
@@ -106,6 +122,9 @@ protected:
     void InitSparseProperties();
 
     D3D12_PLACED_SUBRESOURCE_FOOTPRINT* m_StagingFootprints = nullptr;
+
+    // Device memory that the placed texture resides in
+    RefCntAutoPtr<IDeviceMemory> m_pPlacedMemory;
 };
 
 } // namespace Diligent
@@ -76,6 +76,25 @@ DILIGENT_BEGIN_INTERFACE(IBufferD3D12, IBuffer)
     /// If the state is unknown to the engine (Diligent::RESOURCE_STATE_UNKNOWN),
     /// returns `D3D12_RESOURCE_STATE_COMMON` (0).
     VIRTUAL D3D12_RESOURCE_STATES METHOD(GetD3D12ResourceState)(THIS) CONST PURE;
+
+    /// Sets the residency priority of the buffer
+
+    /// \param [in] Priority - D3D12 residency priority of the buffer.
+    ///
+    /// The priority is passed to ID3D12Device1::SetResidencyPriority and is also used by the engine's
+    /// residency manager when it is enabled (see EngineD3D12CreateInfo::EnableResidencyManagement):
+    /// buffers with lower priority are evicted first, and buffers with D3D12_RESIDENCY_PRIORITY_MAXIMUM
+    /// priority are never evicted by the engine.
+    VIRTUAL void METHOD(SetResidencyPriority)(THIS_
+                                              D3D12_RESIDENCY_PRIORITY Priority) PURE;
+
+    /// Creates an NT handle to share the buffer with other APIs or processes.
+
+    /// \return    The handle that must be closed by the caller with CloseHandle,
+    ///            or NULL if the handle could not be created.
+    ///
+    /// \remarks   The buffer must be created with Diligent::MISC_BUFFER_FLAG_EXPORTABLE flag.
+    VIRTUAL HANDLE METHOD(CreateSharedHandle)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -86,6 +105,8 @@ DILIGENT_END_INTERFACE
 #    define IBufferD3D12_GetD3D12Buffer(This, ...)        CALL_IFACE_METHOD(BufferD3D12, GetD3D12Buffer,        This, __VA_ARGS__)
 #    define IBufferD3D12_SetD3D12ResourceState(This, ...) CALL_IFACE_METHOD(BufferD3D12, SetD3D12ResourceState, This, __VA_ARGS__)
 #    define IBufferD3D12_GetD3D12ResourceState(This)      CALL_IFACE_METHOD(BufferD3D12, GetD3D12ResourceState, This)
+#    define IBufferD3D12_SetResidencyPriority(This, ...)  CALL_IFACE_METHOD(BufferD3D12, SetResidencyPriority,  This, __VA_ARGS__)
+#    define IBufferD3D12_CreateSharedHandle(This)         CALL_IFACE_METHOD(BufferD3D12, CreateSharedHandle,    This)
 
 #endif
 
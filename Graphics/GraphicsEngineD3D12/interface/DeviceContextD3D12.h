@@ -85,6 +85,27 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextD3D12, IDeviceContext)
     /// calling IDeviceContext::InvalidateState() and then manually restore all required states via
     /// appropriate Diligent API calls.
     VIRTUAL ID3D12GraphicsCommandList* METHOD(GetD3D12CommandList)(THIS) PURE;
+
+    /// Begins a submission batch
+
+    /// While the batch is active, IDeviceContext::Flush() and IDeviceContext::ExecuteCommandLists()
+    /// close the command lists, but do not submit them to the command queue. Instead, the command lists
+    /// are accumulated and submitted by EndSubmissionBatch() with a single ID3D12CommandQueue::ExecuteCommandLists()
+    /// call and a single fence signal, which reduces the number of kernel transitions per frame.
+    ///
+    /// emarks    Fences enqueued for signal with IDeviceContext::EnqueueSignal() while the batch is active
+    ///             are signaled after the batch is submitted.
+    ///             If IDeviceContext::DeviceWaitForFence() is called while the batch is active, the command lists
+    ///             accumulated before the call are submitted when the context is flushed next time.
+    ///
+    ///             The batch is also submitted (but remains active) by IDeviceContext::WaitForIdle(),
+    ///             IDeviceContext::BindSparseResourceMemory() and ISwapChain::Present().
+    ///
+    ///             Only immediate contexts can begin submission batches. Batches can't be nested.
+    VIRTUAL void METHOD(BeginSubmissionBatch)(THIS) PURE;
+
+    /// Ends the submission batch and submits all accumulated command lists to the command queue.
+    VIRTUAL void METHOD(EndSubmissionBatch)(THIS) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -97,6 +118,8 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContextD3D12_TransitionTextureState(This, ...) CALL_IFACE_METHOD(DeviceContextD3D12, TransitionTextureState,This, __VA_ARGS__)
 #    define IDeviceContextD3D12_TransitionBufferState(This, ...)  CALL_IFACE_METHOD(DeviceContextD3D12, TransitionBufferState, This, __VA_ARGS__)
 #    define IDeviceContextD3D12_GetD3D12CommandList(This)         CALL_IFACE_METHOD(DeviceContextD3D12, GetD3D12CommandList,   This)
+#    define IDeviceContextD3D12_BeginSubmissionBatch(This)        CALL_IFACE_METHOD(DeviceContextD3D12, BeginSubmissionBatch,  This)
+#    define IDeviceContextD3D12_EndSubmissionBatch(This)          CALL_IFACE_METHOD(DeviceContextD3D12, EndSubmissionBatch,    This)
 
 // clang-format on
 
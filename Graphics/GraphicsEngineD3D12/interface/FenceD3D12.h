@@ -55,6 +55,14 @@ DILIGENT_BEGIN_INTERFACE(IFenceD3D12, IFence)
     /// The method does **NOT** increment the reference counter of the returned object,
     /// so Release() **must not** be called.
     VIRTUAL ID3D12Fence* METHOD(GetD3D12Fence)(THIS) PURE;
+
+    /// Creates an NT handle to share the fence with other APIs or processes.
+
+    /// \return    The handle that must be closed by the caller with CloseHandle,
+    ///            or NULL if the handle could not be created.
+    ///
+    /// \remarks   The fence must be created with Diligent::MISC_FENCE_FLAG_EXPORTABLE flag.
+    VIRTUAL HANDLE METHOD(CreateSharedHandle)(THIS) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -65,6 +73,7 @@ DILIGENT_END_INTERFACE
 // clang-format off
 
 #    define IFenceD3D12_GetD3D12Fence(This)          CALL_IFACE_METHOD(FenceD3D12, GetD3D12Fence,     This)
+#    define IFenceD3D12_CreateSharedHandle(This)     CALL_IFACE_METHOD(FenceD3D12, CreateSharedHandle, This)
 
 // clang-format on
 
@@ -31,6 +31,7 @@
 /// Definition of the Diligent::IRenderDeviceD3D12 interface
 
 #include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "StorageQueueD3D12.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
@@ -47,6 +48,30 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceD3D12 =
 
 // clang-format off
 
+/// This structure is returned by IRenderDeviceD3D12::GetMemoryUsage()
+struct MemoryUsageD3D12
+{
+    /// The amount of local (video) memory the process can use, in bytes, as reported by IDXGIAdapter3::QueryVideoMemoryInfo.
+    Uint64 LocalBudget           DEFAULT_INITIALIZER(0);
+
+    /// The amount of local (video) memory currently used by the process, in bytes.
+    Uint64 LocalUsage            DEFAULT_INITIALIZER(0);
+
+    /// The amount of non-local (system) memory the process can use, in bytes.
+    Uint64 NonLocalBudget        DEFAULT_INITIALIZER(0);
+
+    /// The amount of non-local (system) memory currently used by the process, in bytes.
+    Uint64 NonLocalUsage         DEFAULT_INITIALIZER(0);
+
+    /// The total size of the upload heap pages used for dynamic resources and
+    /// resource updates, including the pages that are currently available for reuse.
+    Uint64 DynamicHeapSize       DEFAULT_INITIALIZER(0);
+
+    /// The maximum value DynamicHeapSize has ever reached.
+    Uint64 PeakDynamicHeapSize   DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryUsageD3D12 MemoryUsageD3D12;
+
 /// Exposes Direct3D12-specific functionality of a render device.
 DILIGENT_BEGIN_INTERFACE(IRenderDeviceD3D12, IRenderDevice)
 {
@@ -122,6 +147,29 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceD3D12, IRenderDevice)
 
     /// Returns DX compiler interface, or null if the compiler is not loaded.
     VIRTUAL struct IDXCompiler* METHOD(GetDXCompiler)(THIS) CONST PURE;
+
+    /// Creates a DirectStorage queue that reads file data directly into Direct3D12 resources.
+
+    /// \param [in]  CreateInfo     - Queue create info, see Diligent::StorageQueueCreateInfoD3D12.
+    /// \param [out] ppStorageQueue - Address of the memory location where the pointer to the
+    ///                               queue interface will be stored.
+    ///                               The function calls AddRef(), so that the new object will contain
+    ///                               one reference.
+    ///
+    /// \remarks   DirectStorage support is optional. The engine must be built with the
+    ///            DirectStorage SDK (see DILIGENT_LOAD_DIRECT_STORAGE CMake option), and dstorage.dll
+    ///            must be available at run time. Otherwise, the method returns null.
+    VIRTUAL void METHOD(CreateStorageQueue)(THIS_
+                                            const StorageQueueCreateInfoD3D12 REF CreateInfo,
+                                            IStorageQueueD3D12**                  ppStorageQueue) PURE;
+
+    /// Returns the GPU memory usage of the device, see Diligent::MemoryUsageD3D12.
+
+    /// \param [out] Usage - Memory usage.
+    ///
+    /// \note  If IDXGIAdapter3 is not supported by the system, budget and usage members are zero.
+    VIRTUAL void METHOD(GetMemoryUsage)(THIS_
+                                        MemoryUsageD3D12 REF Usage) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -137,6 +185,8 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceD3D12_CreateBLASFromD3DResource(This, ...)    CALL_IFACE_METHOD(RenderDeviceD3D12, CreateBLASFromD3DResource,    This, __VA_ARGS__)
 #    define IRenderDeviceD3D12_CreateTLASFromD3DResource(This, ...)    CALL_IFACE_METHOD(RenderDeviceD3D12, CreateTLASFromD3DResource,    This, __VA_ARGS__)
 #    define IRenderDeviceD3D12_GetDXCompiler(This)                     CALL_IFACE_METHOD(RenderDeviceD3D12, GetDXCompiler,                This)
+#    define IRenderDeviceD3D12_CreateStorageQueue(This, ...)           CALL_IFACE_METHOD(RenderDeviceD3D12, CreateStorageQueue,           This, __VA_ARGS__)
+#    define IRenderDeviceD3D12_GetMemoryUsage(This, ...)               CALL_IFACE_METHOD(RenderDeviceD3D12, GetMemoryUsage,               This, __VA_ARGS__)
 // clang-format on
 
 #endif
@@ -0,0 +1,199 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::IStorageQueueD3D12 interface and related data structures
+
+#include "../../GraphicsEngine/interface/Buffer.h"
+#include "../../GraphicsEngine/interface/Texture.h"
+#include "../../GraphicsEngine/interface/Fence.h"
+
+#if DILIGENT_CPP_INTERFACE
+struct IDStorageQueue;
+#else
+typedef struct IDStorageQueue IDStorageQueue;
+#endif
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {5A0E6C0B-93E4-4E0D-B1A7-6F2C49D0C3B8}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_StorageQueueD3D12 =
+    {0x5a0e6c0b, 0x93e4, 0x4e0d, {0xb1, 0xa7, 0x6f, 0x2c, 0x49, 0xd0, 0xc3, 0xb8}};
+
+// clang-format off
+
+/// Compression format of the data read by the storage queue.
+DILIGENT_TYPED_ENUM(STORAGE_COMPRESSION_D3D12, Uint8)
+{
+    /// The data is not compressed.
+    STORAGE_COMPRESSION_D3D12_NONE = 0,
+
+    /// The data is compressed with GDeflate and is decompressed on the GPU.
+    STORAGE_COMPRESSION_D3D12_GDEFLATE,
+
+    STORAGE_COMPRESSION_D3D12_COUNT
+};
+
+
+/// Storage queue create info.
+struct StorageQueueCreateInfoD3D12
+{
+    /// Queue name.
+    const Char* Name DEFAULT_INITIALIZER(nullptr);
+
+    /// The maximum number of requests the queue can hold.
+
+    /// When zero, the default capacity is used. Otherwise, the value is clamped
+    /// to the range supported by DirectStorage.
+    Uint16 Capacity DEFAULT_INITIALIZER(0);
+
+    /// Queue priority, from -1 (low) to 2 (real-time). Zero is normal priority.
+    Int8 Priority DEFAULT_INITIALIZER(0);
+};
+typedef struct StorageQueueCreateInfoD3D12 StorageQueueCreateInfoD3D12;
+
+
+/// Describes a storage queue request that reads a range of a file
+/// into a buffer or a texture subresource.
+struct StorageReadRequestD3D12
+{
+    /// Path to the file to read the data from.
+
+    /// The queue keeps the files open until IStorageQueueD3D12::CloseFiles()
+    /// is called or the queue is destroyed.
+    const Char* FilePath DEFAULT_INITIALIZER(nullptr);
+
+    /// Offset of the data in the file, in bytes.
+    Uint64 FileOffset DEFAULT_INITIALIZER(0);
+
+    /// Size of the data in the file, in bytes.
+    Uint32 Size DEFAULT_INITIALIZER(0);
+
+    /// Size of the data after decompression, in bytes.
+
+    /// Must be zero or equal to Size when the data is not compressed.
+    /// When zero, Size is used.
+    Uint32 UncompressedSize DEFAULT_INITIALIZER(0);
+
+    /// Compression format of the data in the file, see Diligent::STORAGE_COMPRESSION_D3D12.
+    STORAGE_COMPRESSION_D3D12 Compression DEFAULT_INITIALIZER(STORAGE_COMPRESSION_D3D12_NONE);
+
+    /// Destination buffer. Exactly one of pDstBuffer and pDstTexture must not be null.
+    IBuffer* pDstBuffer DEFAULT_INITIALIZER(nullptr);
+
+    /// Offset in the destination buffer, in bytes.
+    Uint64 DstBufferOffset DEFAULT_INITIALIZER(0);
+
+    /// Destination texture. The whole subresource identified by DstMipLevel and DstSlice is written.
+
+    /// The data in the file must be laid out the way ID3D12Device::GetCopyableFootprints()
+    /// reports for the subresource.
+    ITexture* pDstTexture DEFAULT_INITIALIZER(nullptr);
+
+    /// Destination texture mip level.
+    Uint32 DstMipLevel DEFAULT_INITIALIZER(0);
+
+    /// Destination texture array slice.
+    Uint32 DstSlice DEFAULT_INITIALIZER(0);
+};
+typedef struct StorageReadRequestD3D12 StorageReadRequestD3D12;
+
+
+#define DILIGENT_INTERFACE_NAME IStorageQueueD3D12
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IStorageQueueD3D12InclusiveMethods \
+    IObjectInclusiveMethods;               \
+    IStorageQueueD3D12Methods StorageQueueD3D12
+
+/// DirectStorage queue that reads file data directly into Direct3D12 resources.
+
+/// The queue is created by IRenderDeviceD3D12::CreateStorageQueue().
+/// Requests are not executed until Submit() is called. Use EnqueueSignal() to find out
+/// when the requests are complete, and IDeviceContext::DeviceWaitForFence() to make
+/// a device context wait for them on the GPU.
+///
+/// Destination resources must be in RESOURCE_STATE_COMMON state (or not have a known state)
+/// and must not be accessed by device contexts until the requests are complete.
+///
+/// \remarks   All methods are thread-safe.
+DILIGENT_BEGIN_INTERFACE(IStorageQueueD3D12, IObject)
+{
+    /// Enqueues a read request.
+
+    /// \param [in] Request - Request description, see Diligent::StorageReadRequestD3D12.
+    /// \return     true if the request has been enqueued, and false if the request is invalid
+    ///             or the file could not be opened.
+    VIRTUAL bool METHOD(EnqueueRead)(THIS_
+                                     const StorageReadRequestD3D12 REF Request) PURE;
+
+    /// Enqueues a fence signal that is executed once all previously enqueued requests are complete.
+
+    /// \param [in] pFence - Fence to signal. The fence must have been created by the same device.
+    /// \param [in] Value  - The value to set the fence to.
+    VIRTUAL void METHOD(EnqueueSignal)(THIS_
+                                       IFence* pFence,
+                                       Uint64  Value) PURE;
+
+    /// Submits all enqueued requests and signals for execution.
+    VIRTUAL void METHOD(Submit)(THIS) PURE;
+
+    /// Returns the number of requests that have failed since the queue was created.
+    VIRTUAL Uint32 METHOD(GetNumFailedRequests)(THIS) PURE;
+
+    /// Closes all files opened by the queue.
+
+    /// The method must only be called when there are no pending requests that read the files.
+    VIRTUAL void METHOD(CloseFiles)(THIS) PURE;
+
+    /// Returns a pointer to the internal DirectStorage queue.
+
+    /// The method does **NOT** increment the reference counter of the returned object,
+    /// so Release() **must not** be called.
+    VIRTUAL IDStorageQueue* METHOD(GetDStorageQueue)(THIS) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define IStorageQueueD3D12_EnqueueRead(This, ...)     CALL_IFACE_METHOD(StorageQueueD3D12, EnqueueRead,          This, __VA_ARGS__)
+#    define IStorageQueueD3D12_EnqueueSignal(This, ...)   CALL_IFACE_METHOD(StorageQueueD3D12, EnqueueSignal,        This, __VA_ARGS__)
+#    define IStorageQueueD3D12_Submit(This)               CALL_IFACE_METHOD(StorageQueueD3D12, Submit,               This)
+#    define IStorageQueueD3D12_GetNumFailedRequests(This) CALL_IFACE_METHOD(StorageQueueD3D12, GetNumFailedRequests, This)
+#    define IStorageQueueD3D12_CloseFiles(This)           CALL_IFACE_METHOD(StorageQueueD3D12, CloseFiles,           This)
+#    define IStorageQueueD3D12_GetDStorageQueue(This)     CALL_IFACE_METHOD(StorageQueueD3D12, GetDStorageQueue,     This)
+
+// clang-format on
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
@@ -67,6 +67,27 @@ DILIGENT_BEGIN_INTERFACE(ITextureD3D12, ITexture)
     /// If the state is unknown to the engine (Diligent::RESOURCE_STATE_UNKNOWN),
     /// returns `D3D12_RESOURCE_STATE_COMMON` (0).
     VIRTUAL D3D12_RESOURCE_STATES METHOD(GetD3D12ResourceState)(THIS) CONST PURE;
+
+    /// Sets the residency priority of the texture
+
+    /// \param [in] Priority - D3D12 residency priority of the texture.
+    ///
+    /// The priority is passed to ID3D12Device1::SetResidencyPriority and is also used by the engine's
+    /// residency manager when it is enabled (see EngineD3D12CreateInfo::EnableResidencyManagement):
+    /// textures with lower priority are evicted first, and textures with D3D12_RESIDENCY_PRIORITY_MAXIMUM
+    /// priority are never evicted by the engine.
+    VIRTUAL void METHOD(SetResidencyPriority)(THIS_
+                                              D3D12_RESIDENCY_PRIORITY Priority) PURE;
+
+    /// Creates an NT handle to share the texture with other APIs or processes.
+
+    /// \return    The handle that must be closed by the caller with CloseHandle,
+    ///            or NULL if the handle could not be created.
+    ///
+    /// \remarks   The texture must be created with Diligent::MISC_TEXTURE_FLAG_EXPORTABLE flag.
+    ///            The handle can be opened with ID3D12Device::OpenSharedHandle, ID3D11Device1::OpenSharedResource1
+    ///            or imported as external memory in Vulkan and CUDA.
+    VIRTUAL HANDLE METHOD(CreateSharedHandle)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -79,6 +100,8 @@ DILIGENT_END_INTERFACE
 #    define ITextureD3D12_GetD3D12Texture(This)            CALL_IFACE_METHOD(TextureD3D12, GetD3D12Texture,       This)
 #    define ITextureD3D12_SetD3D12ResourceState(This, ...) CALL_IFACE_METHOD(TextureD3D12, SetD3D12ResourceState, This, __VA_ARGS__)
 #    define ITextureD3D12_GetD3D12ResourceState(This)      CALL_IFACE_METHOD(TextureD3D12, GetD3D12ResourceState, This)
+#    define ITextureD3D12_SetResidencyPriority(This, ...)  CALL_IFACE_METHOD(TextureD3D12, SetResidencyPriority,  This, __VA_ARGS__)
+#    define ITextureD3D12_CreateSharedHandle(This)         CALL_IFACE_METHOD(TextureD3D12, CreateSharedHandle,    This)
 
 // clang-format on
 
@@ -0,0 +1,195 @@
+// Single-pass mipmap downsampler.
+//
+// Every thread group reduces a 64x64 tile of the source mip level to a single texel, writing
+// up to 6 mip levels. When more levels are requested, every group stores its last value in
+// the scratch buffer and increments the per-slice atomic counter. The last group to finish
+// then reduces the 64x64 block of the scratch values to write up to 6 remaining levels.
+// This requires the source mip level to be no larger than 4096x4096 texels.
+
+#define RootSig \
+	"RootFlags(0), " \
+	"RootConstants(b0, num32BitConstants = 4), " \
+	"DescriptorTable(SRV(t0, numDescriptors = 1))," \
+	"DescriptorTable(UAV(u0, numDescriptors = 13))"
+
+#define MAX_MIPS_PER_TILE 6
+#define MAX_MIPS          12
+
+// Every array slice uses 16 bytes for the atomic counter followed by 64x64 float4 values
+#define SCRATCH_COUNTER_SIZE 16
+#define SCRATCH_SLICE_STRIDE (SCRATCH_COUNTER_SIZE + 64 * 64 * 16)
+
+Texture2DArray<float4>   SrcTex            : register(t0);
+RWTexture2DArray<float4> OutMips[MAX_MIPS] : register(u0);
+
+globallycoherent RWByteAddressBuffer Scratch : register(u12);
+
+cbuffer CB : register(b0)
+{
+	uint SrcMipLevel;  // Texture level of source mip
+	uint NumMipLevels; // Number of OutMips to write: [1, 12]
+	uint NumTiles;     // Number of 64x64 tiles in one array slice
+	uint Dummy;
+}
+
+groupshared float gs_R[256];
+groupshared float gs_G[256];
+groupshared float gs_B[256];
+groupshared float gs_A[256];
+groupshared uint  gs_IsLastTile;
+
+void StoreColor( uint Index, float4 Color )
+{
+	gs_R[Index] = Color.r;
+	gs_G[Index] = Color.g;
+	gs_B[Index] = Color.b;
+	gs_A[Index] = Color.a;
+}
+
+float4 LoadColor( uint Index )
+{
+	return float4( gs_R[Index], gs_G[Index], gs_B[Index], gs_A[Index]);
+}
+
+float3 LinearToSRGB(float3 x)
+{
+	// This is cheaper but nearly equivalent to the exact sRGB curve
+	return x < 0.0031308 ? 12.92 * x : 1.13005 * sqrt(abs(x - 0.00228)) - 0.13448 * x + 0.005719;
+}
+
+float4 PackColor(float4 Linear)
+{
+#ifdef CONVERT_TO_SRGB
+	return float4(LinearToSRGB(Linear.rgb), Linear.a);
+#else
+	return Linear;
+#endif
+}
+
+uint GetScratchOffset(uint2 Pos, uint Slice)
+{
+	return Slice * SCRATCH_SLICE_STRIDE + SCRATCH_COUNTER_SIZE + (Pos.y * 64 + Pos.x) * 16;
+}
+
+float4 LoadSource(uint2 Pos, uint2 SrcSize, uint Slice, bool FromScratch)
+{
+	// Clamp the coordinates so that the texels outside of the source level replicate the edge
+	Pos = min(Pos, SrcSize - 1);
+	if (FromScratch)
+		return asfloat(Scratch.Load4(GetScratchOffset(Pos, Slice)));
+	else
+		return SrcTex.Load(int4(Pos, Slice, SrcMipLevel));
+}
+
+void StoreMip(uint Mip, uint3 Pos, float4 Color)
+{
+	// Writes outside of the mip level are discarded
+	OutMips[Mip][Pos] = PackColor(Color);
+}
+
+// Reduces Size x Size block of values in the LDS to (Size/2) x (Size/2)
+void DownsampleLDS(uint GI, uint Size, uint2 Tile, uint Mip, uint Slice, bool IsActive)
+{
+	uint   HalfSize = Size / 2;
+	bool   IsValid  = IsActive && GI < HalfSize * HalfSize;
+	float4 Color    = 0;
+	if (IsValid)
+	{
+		uint2 Pos = uint2(GI % HalfSize, GI / HalfSize);
+		uint  Src = Pos.y * 2 * Size + Pos.x * 2;
+		Color = 0.25 * (LoadColor(Src) + LoadColor(Src + 1) + LoadColor(Src + Size) + LoadColor(Src + Size + 1));
+		StoreMip(Mip, uint3(Tile * HalfSize + Pos, Slice), Color);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	if (IsValid)
+		StoreColor(GI, Color);
+
+	GroupMemoryBarrierWithGroupSync();
+}
+
+// Reduces a 64x64 tile of the source to up to 6 mip levels starting with FirstMip.
+// The last level is left in LDS[0] when NumMips is MAX_MIPS_PER_TILE.
+void DownsampleTile(uint GI, uint2 Tile, uint Slice, uint FirstMip, uint NumMips, uint2 SrcSize, bool FromScratch, bool IsActive)
+{
+	// Every thread computes a 2x2 quad of the first level and one texel of the second level
+	uint2  Pos   = uint2(GI % 16, GI / 16);
+	float4 Color = 0;
+	if (IsActive)
+	{
+		[unroll]
+		for (uint i = 0; i < 4; ++i)
+		{
+			uint2  Dst = Tile * 32 + Pos * 2 + uint2(i & 1, i >> 1);
+			uint2  Src = Dst * 2;
+			float4 Src1 = 0.25 * (LoadSource(Src,               SrcSize, Slice, FromScratch) +
+			                      LoadSource(Src + uint2(1, 0), SrcSize, Slice, FromScratch) +
+			                      LoadSource(Src + uint2(0, 1), SrcSize, Slice, FromScratch) +
+			                      LoadSource(Src + uint2(1, 1), SrcSize, Slice, FromScratch));
+			StoreMip(FirstMip, uint3(Dst, Slice), Src1);
+			Color += Src1;
+		}
+		Color *= 0.25;
+
+		if (NumMips > 1)
+			StoreMip(FirstMip + 1, uint3(Tile * 16 + Pos, Slice), Color);
+	}
+
+	// A scalar (constant) branch can exit all threads coherently.
+	if (NumMips <= 2)
+		return;
+
+	if (IsActive)
+		StoreColor(GI, Color);
+
+	GroupMemoryBarrierWithGroupSync();
+
+	[unroll]
+	for (uint Mip = 2; Mip < MAX_MIPS_PER_TILE; ++Mip)
+	{
+		if (Mip < NumMips)
+			DownsampleLDS(GI, 64 >> Mip, Tile, FirstMip + Mip, Slice, IsActive);
+	}
+}
+
+[RootSignature(RootSig)]
+[numthreads( 256, 1, 1 )]
+void main( uint GI : SV_GroupIndex, uint3 Gid : SV_GroupID )
+{
+	uint2 SrcSize;
+	uint  Elements;
+	uint  Levels;
+	SrcTex.GetDimensions(SrcMipLevel, SrcSize.x, SrcSize.y, Elements, Levels);
+	uint Slice = Gid.z;
+
+	DownsampleTile(GI, Gid.xy, Slice, 0, min(NumMipLevels, MAX_MIPS_PER_TILE), SrcSize, false, true);
+
+	if (NumMipLevels <= MAX_MIPS_PER_TILE)
+		return;
+
+	if (GI == 0)
+	{
+		Scratch.Store4(GetScratchOffset(Gid.xy, Slice), asuint(LoadColor(0)));
+		// Make the value visible to all groups before incrementing the counter
+		DeviceMemoryBarrier();
+
+		uint PrevCount;
+		Scratch.InterlockedAdd(Slice * SCRATCH_SLICE_STRIDE, 1, PrevCount);
+		gs_IsLastTile = (PrevCount == NumTiles - 1) ? 1 : 0;
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	// The flag is in the LDS, so the compiler can't prove that the branch is uniform and all
+	// groups go through the barriers below. Only the last group loads and stores values.
+	bool IsLastTile = gs_IsLastTile != 0;
+	if (IsLastTile && GI == 0)
+	{
+		// Reset the counter for the next dispatch
+		Scratch.Store(Slice * SCRATCH_SLICE_STRIDE, 0);
+	}
+
+	uint2 Mip6Size = max(SrcSize >> MAX_MIPS_PER_TILE, 1);
+	DownsampleTile(GI, uint2(0, 0), Slice, MAX_MIPS_PER_TILE, NumMipLevels - MAX_MIPS_PER_TILE, Mip6Size, true, IsLastTile);
+}
@@ -0,0 +1,2 @@
+#define CONVERT_TO_SRGB
+#include "GenerateMipsSinglePassCS.hlsli"
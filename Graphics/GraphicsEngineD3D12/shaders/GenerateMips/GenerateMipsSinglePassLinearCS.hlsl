@@ -0,0 +1 @@
+#include "GenerateMipsSinglePassCS.hlsli"
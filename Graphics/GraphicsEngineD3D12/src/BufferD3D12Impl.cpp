@@ -31,6 +31,7 @@
 
 #include "RenderDeviceD3D12Impl.hpp"
 #include "DeviceContextD3D12Impl.hpp"
+#include "DeviceMemoryD3D12Impl.hpp"
 
 #include "D3D12TypeConversions.hpp"
 #include "GraphicsAccessories.hpp"
@@ -41,6 +42,42 @@
 namespace Diligent
 {
 
+Uint64 BufferD3D12Impl::GetD3D12BufferSize(const BufferDesc& BuffDesc)
+{
+    Uint32 BufferAlignment = 1;
+    if (BuffDesc.BindFlags & BIND_UNIFORM_BUFFER)
+        BufferAlignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT;
+
+    if (BuffDesc.Usage == USAGE_STAGING && BuffDesc.CPUAccessFlags == CPU_ACCESS_WRITE)
+        BufferAlignment = std::max(BufferAlignment, Uint32{D3D12_TEXTURE_DATA_PITCH_ALIGNMENT});
+
+    return AlignUp(BuffDesc.Size, BufferAlignment);
+}
+
+D3D12_RESOURCE_DESC BufferD3D12Impl::GetD3D12BufferDesc(const BufferDesc& BuffDesc)
+{
+    D3D12_RESOURCE_DESC d3d12BuffDesc{};
+    d3d12BuffDesc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
+    d3d12BuffDesc.Alignment          = 0;
+    d3d12BuffDesc.Width              = BuffDesc.Size;
+    d3d12BuffDesc.Height             = 1;
+    d3d12BuffDesc.DepthOrArraySize   = 1;
+    d3d12BuffDesc.MipLevels          = 1;
+    d3d12BuffDesc.Format             = DXGI_FORMAT_UNKNOWN;
+    d3d12BuffDesc.SampleDesc.Count   = 1;
+    d3d12BuffDesc.SampleDesc.Quality = 0;
+    // Layout must be D3D12_TEXTURE_LAYOUT_ROW_MAJOR, as buffer memory layouts are
+    // understood by applications and row-major texture data is commonly marshaled through buffers.
+    d3d12BuffDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    d3d12BuffDesc.Flags  = D3D12_RESOURCE_FLAG_NONE;
+    if ((BuffDesc.BindFlags & BIND_UNORDERED_ACCESS) || (BuffDesc.BindFlags & BIND_RAY_TRACING))
+        d3d12BuffDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+    if (!(BuffDesc.BindFlags & BIND_SHADER_RESOURCE) && !(BuffDesc.BindFlags & BIND_RAY_TRACING))
+        d3d12BuffDesc.Flags |= D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
+
+    return d3d12BuffDesc;
+}
+
 BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
                                  FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
                                  RenderDeviceD3D12Impl*     pRenderDeviceD3D12,
@@ -61,14 +98,7 @@ BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
         LOG_ERROR_AND_THROW("Unified resources are not supported in Direct3D12");
     }
 
-    Uint32 BufferAlignment = 1;
-    if (m_Desc.BindFlags & BIND_UNIFORM_BUFFER)
-        BufferAlignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT;
-
-    if (m_Desc.Usage == USAGE_STAGING && m_Desc.CPUAccessFlags == CPU_ACCESS_WRITE)
-        BufferAlignment = std::max(BufferAlignment, Uint32{D3D12_TEXTURE_DATA_PITCH_ALIGNMENT});
-
-    m_Desc.Size = AlignUp(m_Desc.Size, BufferAlignment);
+    m_Desc.Size = GetD3D12BufferSize(m_Desc);
 
     if ((m_Desc.Usage == USAGE_DYNAMIC) &&
         (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) == 0 &&
@@ -85,24 +115,7 @@ BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
         VERIFY(m_Desc.Usage != USAGE_DYNAMIC || PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) <= 1,
                "ImmediateContextMask must contain single set bit, this error should've been handled in ValidateBufferDesc()");
 
-        D3D12_RESOURCE_DESC d3d12BuffDesc{};
-        d3d12BuffDesc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
-        d3d12BuffDesc.Alignment          = 0;
-        d3d12BuffDesc.Width              = m_Desc.Size;
-        d3d12BuffDesc.Height             = 1;
-        d3d12BuffDesc.DepthOrArraySize   = 1;
-        d3d12BuffDesc.MipLevels          = 1;
-        d3d12BuffDesc.Format             = DXGI_FORMAT_UNKNOWN;
-        d3d12BuffDesc.SampleDesc.Count   = 1;
-        d3d12BuffDesc.SampleDesc.Quality = 0;
-        // Layout must be D3D12_TEXTURE_LAYOUT_ROW_MAJOR, as buffer memory layouts are
-        // understood by applications and row-major texture data is commonly marshaled through buffers.
-        d3d12BuffDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-        d3d12BuffDesc.Flags  = D3D12_RESOURCE_FLAG_NONE;
-        if ((m_Desc.BindFlags & BIND_UNORDERED_ACCESS) || (m_Desc.BindFlags & BIND_RAY_TRACING))
-            d3d12BuffDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
-        if (!(m_Desc.BindFlags & BIND_SHADER_RESOURCE) && !(m_Desc.BindFlags & BIND_RAY_TRACING))
-            d3d12BuffDesc.Flags |= D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
+        D3D12_RESOURCE_DESC d3d12BuffDesc = GetD3D12BufferDesc(m_Desc);
 
         ID3D12Device* pd3d12Device = pRenderDeviceD3D12->GetD3D12Device();
 
@@ -159,9 +172,12 @@ BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
             // By default, committed resources and heaps are almost always zeroed upon creation.
             // CREATE_NOT_ZEROED flag allows this to be elided in some scenarios to lower the overhead
             // of creating the heap. No need to zero the resource if we initialize it.
-            const D3D12_HEAP_FLAGS d3d12HeapFlags = InitialDataSize > 0 ?
+            D3D12_HEAP_FLAGS d3d12HeapFlags = InitialDataSize > 0 ?
                 D3D12_HEAP_FLAG_CREATE_NOT_ZEROED :
                 D3D12_HEAP_FLAG_NONE;
+            // Shared heaps allow creating NT handles for the resource (see CreateSharedHandle())
+            if (m_Desc.MiscFlags & MISC_BUFFER_FLAG_EXPORTABLE)
+                d3d12HeapFlags |= D3D12_HEAP_FLAG_SHARED;
 
             HRESULT hr = pd3d12Device->CreateCommittedResource(
                 &HeapProps, d3d12HeapFlags, &d3d12BuffDesc, d3d12State,
@@ -174,6 +190,15 @@ BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
             if (*m_Desc.Name != 0)
                 m_pd3d12Resource->SetName(WidenString(m_Desc.Name).c_str());
 
+            // Resources in upload and readback heaps reside in system memory
+            if (HeapProps.Type == D3D12_HEAP_TYPE_DEFAULT)
+            {
+                pRenderDeviceD3D12->RegisterResidencyObject(*this, d3d12BuffDesc);
+                // Exported memory may be accessed by other APIs at any time, so it must never be evicted
+                if (m_Desc.MiscFlags & MISC_BUFFER_FLAG_EXPORTABLE)
+                    pRenderDeviceD3D12->SetResidencyPriority(*this, D3D12_RESIDENCY_PRIORITY_MAXIMUM);
+            }
+
             if (InitialDataSize > 0)
             {
                 D3D12_HEAP_PROPERTIES UploadHeapProps{};
@@ -249,6 +274,46 @@ BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
     m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
 }
 
+BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
+                                 FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                                 RenderDeviceD3D12Impl*     pRenderDeviceD3D12,
+                                 const BufferDesc&          BuffDesc,
+                                 IDeviceMemory*             pMemory,
+                                 Uint64                     MemoryOffset) :
+    TBufferBase{
+        pRefCounters,
+        BuffViewObjMemAllocator,
+        pRenderDeviceD3D12,
+        BuffDesc,
+        false,
+    },
+    m_pPlacedMemory{pMemory}
+{
+    if (m_Desc.Usage != USAGE_DEFAULT)
+        LOG_ERROR_AND_THROW("Placed buffers must be created with USAGE_DEFAULT");
+
+    RefCntAutoPtr<IDeviceMemoryD3D12> pMemoryD3D12{pMemory, IID_DeviceMemoryD3D12};
+    if (!pMemoryD3D12)
+        LOG_ERROR_AND_THROW("Placed buffers require a valid Direct3D12 device memory object");
+
+    m_Desc.Size = GetD3D12BufferSize(m_Desc);
+
+    const D3D12_RESOURCE_DESC d3d12BuffDesc = GetD3D12BufferDesc(m_Desc);
+
+    // The resource residency is managed by the heap
+    m_pd3d12Resource = pMemoryD3D12.ConstPtr<DeviceMemoryD3D12Impl>()->CreatePlacedResource(d3d12BuffDesc, MemoryOffset, nullptr, m_Desc.Name);
+
+    SetState(RESOURCE_STATE_UNDEFINED);
+
+    if (m_Desc.BindFlags & BIND_UNIFORM_BUFFER)
+    {
+        m_CBVDescriptorAllocation = pRenderDeviceD3D12->AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        CreateCBV(m_CBVDescriptorAllocation.GetCpuHandle());
+    }
+
+    m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
+}
+
 static BufferDesc BufferDescFromD3D12Resource(BufferDesc BuffDesc, ID3D12Resource* pd3d12Buffer)
 {
     DEV_CHECK_ERR(BuffDesc.Usage != USAGE_DYNAMIC, "Dynamic buffers cannot be attached to native d3d12 resource");
@@ -426,6 +491,29 @@ void BufferD3D12Impl::SetD3D12ResourceState(D3D12_RESOURCE_STATES state)
     SetState(D3D12ResourceStatesToResourceStateFlags(state));
 }
 
+void BufferD3D12Impl::SetResidencyPriority(D3D12_RESIDENCY_PRIORITY Priority)
+{
+    GetDevice()->SetResidencyPriority(*this, Priority);
+}
+
+HANDLE BufferD3D12Impl::CreateSharedHandle() const
+{
+    if ((m_Desc.MiscFlags & MISC_BUFFER_FLAG_EXPORTABLE) == 0)
+    {
+        DEV_ERROR("Buffer '", m_Desc.Name, "' was not created with MISC_BUFFER_FLAG_EXPORTABLE flag");
+        return NULL;
+    }
+
+    HANDLE  Handle = NULL;
+    HRESULT hr     = GetDevice()->GetD3D12Device()->CreateSharedHandle(m_pd3d12Resource, nullptr, GENERIC_ALL, nullptr, &Handle);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create shared handle for buffer '", m_Desc.Name, "'");
+        return NULL;
+    }
+    return Handle;
+}
+
 D3D12_RESOURCE_STATES BufferD3D12Impl::GetD3D12ResourceState() const
 {
     return ResourceStateFlagsToD3D12ResourceStates(GetState());
@@ -39,6 +39,7 @@
 
 #include "CommandListManager.hpp"
 #include "D3D12TypeConversions.hpp"
+#include "GraphicsAccessories.hpp"
 
 #ifdef DILIGENT_USE_PIX
 
@@ -55,10 +56,25 @@ namespace Diligent
 {
 
 CommandContext::CommandContext(CommandListManager& CmdListManager) :
+    // clang-format off
     m_PendingResourceBarriers(STD_ALLOCATOR_RAW_MEM(D3D12_RESOURCE_BARRIER, GetRawAllocator(), "Allocator for vector<D3D12_RESOURCE_BARRIER>"))
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+  , m_PendingTextureBarriers (STD_ALLOCATOR_RAW_MEM(D3D12_TEXTURE_BARRIER,  GetRawAllocator(), "Allocator for vector<D3D12_TEXTURE_BARRIER>"))
+  , m_PendingBufferBarriers  (STD_ALLOCATOR_RAW_MEM(D3D12_BUFFER_BARRIER,   GetRawAllocator(), "Allocator for vector<D3D12_BUFFER_BARRIER>"))
+#endif
+// clang-format on
 {
     m_PendingResourceBarriers.reserve(32);
     CmdListManager.CreateNewCommandList(&m_pCommandList, &m_pCurrentAllocator, m_MaxInterfaceVer);
+
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    m_UseEnhancedBarriers = m_MaxInterfaceVer >= 7 && CmdListManager.UseEnhancedBarriers();
+    if (m_UseEnhancedBarriers)
+    {
+        m_PendingTextureBarriers.reserve(16);
+        m_PendingBufferBarriers.reserve(16);
+    }
+#endif
 }
 
 CommandContext::~CommandContext(void)
@@ -74,7 +90,34 @@ void CommandContext::Reset(CommandListManager& CmdListManager)
     VERIFY_EXPR(m_pCommandList->GetType() == CmdListManager.GetCommandListType());
     if (!m_pCurrentAllocator)
     {
-        CmdListManager.RequestAllocator(&m_pCurrentAllocator);
+        // Allocators are kept in submission order, so the first allocator whose fence has not completed
+        // stops the search. Completed allocators that can't be reused are returned to their managers
+        // so that an idle context does not hold more memory than it needs.
+        size_t NumCompleted = 0;
+        for (; NumCompleted < m_RetiredAllocators.size(); ++NumCompleted)
+        {
+            RetiredAllocator& Allocator = m_RetiredAllocators[NumCompleted];
+            if (Allocator.pCmdListManager->GetCompletedFenceValue(Allocator.CmdQueue) < Allocator.FenceValue)
+                break;
+
+            if (!m_pCurrentAllocator && Allocator.pCmdListManager == &CmdListManager)
+            {
+                // The allocator is still accounted as outstanding by the manager, and no other
+                // context can access it, so it can be reset without taking any locks.
+                m_pCurrentAllocator = std::move(Allocator.pAllocator);
+
+                HRESULT hr = m_pCurrentAllocator->Reset();
+                DEV_CHECK_ERR(SUCCEEDED(hr), "Failed to reset command allocator");
+            }
+            else
+            {
+                Allocator.pCmdListManager->FreeAllocator(std::move(Allocator.pAllocator));
+            }
+        }
+        m_RetiredAllocators.erase(m_RetiredAllocators.begin(), m_RetiredAllocators.begin() + NumCompleted);
+
+        if (!m_pCurrentAllocator)
+            CmdListManager.RequestAllocator(&m_pCurrentAllocator);
         // Unlike ID3D12CommandAllocator::Reset, ID3D12GraphicsCommandList::Reset can be called while the
         // command list is still being executed. A typical pattern is to submit a command list and then
         // immediately reset it to reuse the allocated memory for another command list.
@@ -85,6 +128,10 @@ void CommandContext::Reset(CommandListManager& CmdListManager)
     m_pCurGraphicsRootSignature = nullptr;
     m_pCurComputeRootSignature  = nullptr;
     m_PendingResourceBarriers.clear();
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    m_PendingTextureBarriers.clear();
+    m_PendingBufferBarriers.clear();
+#endif
     m_BoundDescriptorHeaps = ShaderDescriptorHeaps{};
 
     m_DynamicGPUDescriptorAllocators = nullptr;
@@ -134,6 +181,33 @@ void CommandContext::TransitionResource(TopLevelASD3D12Impl& TlasD3D12, RESOURCE
     TransitionResource(TlasD3D12, StateTransitionDesc{&TlasD3D12, RESOURCE_STATE_UNKNOWN, NewState, STATE_TRANSITION_FLAG_UPDATE_STATE});
 }
 
+void CommandContext::RetireAllocator(CComPtr<ID3D12CommandAllocator>&& pAllocator,
+                                     SoftwareQueueIndex                CmdQueue,
+                                     Uint64                            FenceValue,
+                                     CommandListManager&               CmdListManager)
+{
+    VERIFY_EXPR(pAllocator);
+    if (m_RetiredAllocators.size() >= MaxRetiredAllocators)
+    {
+        // Return the oldest allocator to the manager through the release queue
+        RetiredAllocator& Oldest = m_RetiredAllocators.front();
+        Oldest.pCmdListManager->ReleaseAllocator(std::move(Oldest.pAllocator), Oldest.CmdQueue, Oldest.FenceValue);
+        m_RetiredAllocators.erase(m_RetiredAllocators.begin());
+    }
+    m_RetiredAllocators.push_back({std::move(pAllocator), &CmdListManager, CmdQueue, FenceValue});
+}
+
+void CommandContext::ReleaseRetiredAllocators()
+{
+    for (RetiredAllocator& Allocator : m_RetiredAllocators)
+    {
+        VERIFY(Allocator.pCmdListManager->GetCompletedFenceValue(Allocator.CmdQueue) >= Allocator.FenceValue, "The allocator is still in use by the GPU");
+        Allocator.pCmdListManager->FreeAllocator(std::move(Allocator.pAllocator));
+    }
+    m_RetiredAllocators.clear();
+}
+
+
 namespace
 {
 
@@ -163,7 +237,9 @@ public:
                           CommandContext&            CmdCtx) :
         m_Barrier{Barrier},
         m_CmdCtx{CmdCtx},
-        m_ResStateMask{GetSupportedD3D12ResourceStatesForCommandList(m_CmdCtx.GetCommandListType())}
+        m_ResStateMask{GetSupportedD3D12ResourceStatesForCommandList(m_CmdCtx.GetCommandListType())},
+        // Enhanced barriers do not have split transitions, so split barriers always use legacy barriers
+        m_UseEnhancedBarriers{m_CmdCtx.UseEnhancedBarriers() && Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE}
     {
         DEV_CHECK_ERR(m_Barrier.NewState != RESOURCE_STATE_UNKNOWN, "New resource state can't be unknown");
     }
@@ -178,6 +254,25 @@ public:
     void AddD3D12ResourceBarriers(TopLevelASD3D12Impl& TLAS, D3D12_RESOURCE_BARRIER& d3d12Barrier);
     void AddD3D12ResourceBarriers(BottomLevelASD3D12Impl& BLAS, D3D12_RESOURCE_BARRIER& d3d12Barrier);
 
+    // Acceleration structures are always in D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE
+    // and always use legacy UAV barriers.
+    template <typename ResourceType>
+    void AddUAVBarrier(ResourceType& Resource) { AddLegacyUAVBarrier(); }
+    void AddUAVBarrier(TextureD3D12Impl& Tex);
+    void AddUAVBarrier(BufferD3D12Impl& Buff);
+    void AddLegacyUAVBarrier();
+
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    void AddD3D12TextureBarrier(const TextureDesc&            TexDesc,
+                                const D3D12_RESOURCE_BARRIER& d3d12Barrier,
+                                Uint32                        EndMip   = REMAINING_MIP_LEVELS,
+                                Uint32                        EndSlice = REMAINING_ARRAY_SLICES);
+    void AddD3D12BufferBarrier(const D3D12_RESOURCE_BARRIER& d3d12Barrier);
+
+    template <typename BarrierType>
+    void InitSyncAndAccess(BarrierType& Barrier, D3D12_RESOURCE_STATES StateBefore, D3D12_RESOURCE_STATES StateAfter) const;
+#endif
+
     template <typename ResourceType>
     void operator()(ResourceType& Resource);
 
@@ -197,6 +292,8 @@ private:
     bool m_RequireUAVBarrier = false;
 
     const D3D12_RESOURCE_STATES m_ResStateMask;
+
+    const bool m_UseEnhancedBarriers;
 };
 
 template <typename ResourceType>
@@ -316,7 +413,12 @@ void StateTransitionHelper::AddD3D12ResourceBarriers(TextureD3D12Impl& Tex, D3D1
         {
             DiscardIfAppropriate(TexDesc, d3d12Barrier.Transition.StateBefore);
             d3d12Barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-            m_CmdCtx.ResourceBarrier(d3d12Barrier);
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+            if (m_UseEnhancedBarriers)
+                AddD3D12TextureBarrier(TexDesc, d3d12Barrier);
+            else
+#endif
+                m_CmdCtx.ResourceBarrier(d3d12Barrier);
             DiscardIfAppropriate(TexDesc, d3d12Barrier.Transition.StateAfter);
         }
         else
@@ -324,12 +426,22 @@ void StateTransitionHelper::AddD3D12ResourceBarriers(TextureD3D12Impl& Tex, D3D1
             Uint32 EndMip   = m_Barrier.MipLevelsCount == REMAINING_MIP_LEVELS ? TexDesc.MipLevels : m_Barrier.FirstMipLevel + m_Barrier.MipLevelsCount;
             Uint32 EndSlice = m_Barrier.ArraySliceCount == REMAINING_ARRAY_SLICES ? TexDesc.GetArraySize() : m_Barrier.FirstArraySlice + m_Barrier.ArraySliceCount;
             DiscardIfAppropriate(TexDesc, d3d12Barrier.Transition.StateBefore, EndMip, EndSlice);
-            for (Uint32 mip = m_Barrier.FirstMipLevel; mip < EndMip; ++mip)
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+            if (m_UseEnhancedBarriers)
             {
-                for (Uint32 slice = m_Barrier.FirstArraySlice; slice < EndSlice; ++slice)
+                // Enhanced barriers transition the entire subresource range at once
+                AddD3D12TextureBarrier(TexDesc, d3d12Barrier, EndMip, EndSlice);
+            }
+            else
+#endif
+            {
+                for (Uint32 mip = m_Barrier.FirstMipLevel; mip < EndMip; ++mip)
                 {
-                    d3d12Barrier.Transition.Subresource = D3D12CalcSubresource(mip, slice, 0, TexDesc.MipLevels, TexDesc.GetArraySize());
-                    m_CmdCtx.ResourceBarrier(d3d12Barrier);
+                    for (Uint32 slice = m_Barrier.FirstArraySlice; slice < EndSlice; ++slice)
+                    {
+                        d3d12Barrier.Transition.Subresource = D3D12CalcSubresource(mip, slice, 0, TexDesc.MipLevels, TexDesc.GetArraySize());
+                        m_CmdCtx.ResourceBarrier(d3d12Barrier);
+                    }
                 }
             }
             DiscardIfAppropriate(TexDesc, d3d12Barrier.Transition.StateAfter, EndMip, EndSlice);
@@ -341,35 +453,120 @@ void StateTransitionHelper::AddD3D12ResourceBarriers(BufferD3D12Impl& Buff, D3D1
 {
     if (d3d12Barrier.Transition.StateBefore != d3d12Barrier.Transition.StateAfter)
     {
-        m_CmdCtx.ResourceBarrier(d3d12Barrier);
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+        if (m_UseEnhancedBarriers)
+            AddD3D12BufferBarrier(d3d12Barrier);
+        else
+#endif
+            m_CmdCtx.ResourceBarrier(d3d12Barrier);
     }
 }
 
-void StateTransitionHelper::AddD3D12ResourceBarriers(TopLevelASD3D12Impl& TLAS, D3D12_RESOURCE_BARRIER& /*d3d12Barrier*/)
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+template <typename BarrierType>
+void StateTransitionHelper::InitSyncAndAccess(BarrierType& Barrier, D3D12_RESOURCE_STATES StateBefore, D3D12_RESOURCE_STATES StateAfter) const
 {
-    // Acceleration structure is always in D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE,
-    // and requires UAV barrier instead of state transition.
-    // If either old or new state is a write state, we need to issue a UAV barrier to complete
-    // all previous read/write operations.
-    if (m_OldState == RESOURCE_STATE_BUILD_AS_WRITE || m_Barrier.NewState == RESOURCE_STATE_BUILD_AS_WRITE)
-        m_RequireUAVBarrier = true;
+    if (m_OldState == RESOURCE_STATE_UNDEFINED)
+    {
+        // Resource content is undefined, so there are no previous accesses to wait for
+        Barrier.SyncBefore   = D3D12_BARRIER_SYNC_NONE;
+        Barrier.AccessBefore = D3D12_BARRIER_ACCESS_NO_ACCESS;
+    }
+    else
+    {
+        Barrier.SyncBefore   = D3D12ResourceStatesToD3D12BarrierSync(StateBefore);
+        Barrier.AccessBefore = D3D12ResourceStatesToD3D12BarrierAccess(StateBefore);
+    }
+    Barrier.SyncAfter   = D3D12ResourceStatesToD3D12BarrierSync(StateAfter);
+    Barrier.AccessAfter = D3D12ResourceStatesToD3D12BarrierAccess(StateAfter);
+}
 
-#ifdef DILIGENT_DEVELOPMENT
-    if (m_Barrier.NewState & RESOURCE_STATE_RAY_TRACING)
+void StateTransitionHelper::AddD3D12TextureBarrier(const TextureDesc&            TexDesc,
+                                                   const D3D12_RESOURCE_BARRIER& d3d12Barrier,
+                                                   Uint32                        EndMip,
+                                                   Uint32                        EndSlice)
+{
+    const D3D12_RESOURCE_STATES StateBefore = d3d12Barrier.Transition.StateBefore;
+    const D3D12_RESOURCE_STATES StateAfter  = d3d12Barrier.Transition.StateAfter;
+
+    D3D12_TEXTURE_BARRIER TexBarrier{};
+    InitSyncAndAccess(TexBarrier, StateBefore, StateAfter);
+    // Layouts are derived from the legacy states, so that the texture layout always matches the
+    // state tracked by the engine, and legacy barriers can still be used for the same texture.
+    TexBarrier.LayoutBefore = D3D12ResourceStatesToD3D12BarrierLayout(StateBefore);
+    TexBarrier.LayoutAfter  = D3D12ResourceStatesToD3D12BarrierLayout(StateAfter);
+    TexBarrier.pResource    = m_pd3d12Resource;
+    TexBarrier.Flags        = D3D12_TEXTURE_BARRIER_FLAG_NONE;
+    if (EndMip == REMAINING_MIP_LEVELS && EndSlice == REMAINING_ARRAY_SLICES)
     {
-        TLAS.ValidateContent();
+        // All subresources
+        TexBarrier.Subresources.IndexOrFirstMipLevel = 0xFFFFFFFFu;
     }
+    else
+    {
+        const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(TexDesc.Format);
+
+        TexBarrier.Subresources.IndexOrFirstMipLevel = m_Barrier.FirstMipLevel;
+        TexBarrier.Subresources.NumMipLevels         = EndMip - m_Barrier.FirstMipLevel;
+        TexBarrier.Subresources.FirstArraySlice      = m_Barrier.FirstArraySlice;
+        TexBarrier.Subresources.NumArraySlices       = EndSlice - m_Barrier.FirstArraySlice;
+        TexBarrier.Subresources.FirstPlane           = 0;
+        TexBarrier.Subresources.NumPlanes            = FmtAttribs.ComponentType == COMPONENT_TYPE_DEPTH_STENCIL ? 2 : 1;
+    }
+    m_CmdCtx.TextureBarrier(TexBarrier);
+}
+
+void StateTransitionHelper::AddD3D12BufferBarrier(const D3D12_RESOURCE_BARRIER& d3d12Barrier)
+{
+    D3D12_BUFFER_BARRIER BuffBarrier{};
+    InitSyncAndAccess(BuffBarrier, d3d12Barrier.Transition.StateBefore, d3d12Barrier.Transition.StateAfter);
+    BuffBarrier.pResource = m_pd3d12Resource;
+    BuffBarrier.Offset    = 0;
+    BuffBarrier.Size      = UINT64_MAX;
+    m_CmdCtx.BufferBarrier(BuffBarrier);
+}
 #endif
+
+void StateTransitionHelper::AddLegacyUAVBarrier()
+{
+    // UAV barrier indicates that all UAV accesses (reads or writes) to a particular resource
+    // must complete before any future UAV accesses (reads or writes) can begin.
+
+    DEV_CHECK_ERR(m_Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE, "UAV barriers must not be split");
+    D3D12_RESOURCE_BARRIER d3d12Barrier{D3D12_RESOURCE_BARRIER_TYPE_UAV, D3D12_RESOURCE_BARRIER_FLAG_NONE, {}};
+    d3d12Barrier.UAV.pResource = m_pd3d12Resource;
+    m_CmdCtx.ResourceBarrier(d3d12Barrier);
 }
 
-void StateTransitionHelper::AddD3D12ResourceBarriers(BottomLevelASD3D12Impl& BLAS, D3D12_RESOURCE_BARRIER& /*d3d12Barrier*/)
+void StateTransitionHelper::AddUAVBarrier(TextureD3D12Impl& Tex)
 {
-    // Acceleration structure is always in D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE,
-    // and requires UAV barrier instead of state transition.
-    // If either old or new state is a write state, we need to issue a UAV barrier to complete
-    // all previous read/write operations.
-    if (m_OldState == RESOURCE_STATE_BUILD_AS_WRITE || m_Barrier.NewState == RESOURCE_STATE_BUILD_AS_WRITE)
-        m_RequireUAVBarrier = true;
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    if (m_UseEnhancedBarriers)
+    {
+        // With enhanced barriers, UAV barrier is a barrier that keeps the unordered access layout
+        D3D12_RESOURCE_BARRIER d3d12Barrier{};
+        d3d12Barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+        d3d12Barrier.Transition.StateAfter  = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+        AddD3D12TextureBarrier(Tex.GetDesc(), d3d12Barrier);
+        return;
+    }
+#endif
+    AddLegacyUAVBarrier();
+}
+
+void StateTransitionHelper::AddUAVBarrier(BufferD3D12Impl& Buff)
+{
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    if (m_UseEnhancedBarriers)
+    {
+        D3D12_RESOURCE_BARRIER d3d12Barrier{};
+        d3d12Barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+        d3d12Barrier.Transition.StateAfter  = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+        AddD3D12BufferBarrier(d3d12Barrier);
+        return;
+    }
+#endif
+    AddLegacyUAVBarrier();
 }
 
 template <typename ResourceType>
@@ -426,13 +623,7 @@ void StateTransitionHelper::operator()(ResourceType& Resource)
 
     if (m_RequireUAVBarrier)
     {
-        // UAV barrier indicates that all UAV accesses (reads or writes) to a particular resource
-        // must complete before any future UAV accesses (reads or writes) can begin.
-
-        DEV_CHECK_ERR(m_Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE, "UAV barriers must not be split");
-        D3D12_RESOURCE_BARRIER d3d12Barrier{D3D12_RESOURCE_BARRIER_TYPE_UAV, D3D12_RESOURCE_BARRIER_FLAG_NONE, {}};
-        d3d12Barrier.UAV.pResource = m_pd3d12Resource;
-        m_CmdCtx.ResourceBarrier(d3d12Barrier);
+        AddUAVBarrier(Resource);
     }
 }
 
@@ -440,12 +631,18 @@ void StateTransitionHelper::operator()(ResourceType& Resource)
 
 void CommandContext::TransitionResource(TextureD3D12Impl& Texture, const StateTransitionDesc& Barrier)
 {
+    // Resources referenced by barriers must be resident
+    Texture.MarkReferencedByCommandList();
+
     StateTransitionHelper Helper{Barrier, *this};
     Helper(Texture);
 }
 
 void CommandContext::TransitionResource(BufferD3D12Impl& Buffer, const StateTransitionDesc& Barrier)
 {
+    // Resources referenced by barriers must be resident
+    Buffer.MarkReferencedByCommandList();
+
     StateTransitionHelper Helper{Barrier, *this};
     Helper(Buffer);
 }
@@ -464,6 +661,9 @@ void CommandContext::TransitionResource(TopLevelASD3D12Impl& TLAS, const StateTr
 
 void CommandContext::InsertAliasBarrier(D3D12ResourceBase& Before, D3D12ResourceBase& After, bool FlushImmediate)
 {
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    FlushEnhancedBarriers();
+#endif
     m_PendingResourceBarriers.emplace_back();
     D3D12_RESOURCE_BARRIER& BarrierDesc = m_PendingResourceBarriers.back();
 
@@ -54,6 +54,9 @@ void CommandListManager::CreateNewCommandList(ID3D12GraphicsCommandList** List,
 
     const IID CmdListIIDs[] =
         {
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+            __uuidof(ID3D12GraphicsCommandList7),
+#endif
 #ifdef D3D12_H_HAS_MESH_SHADER
             __uuidof(ID3D12GraphicsCommandList6),
             __uuidof(ID3D12GraphicsCommandList5),
@@ -81,19 +84,37 @@ void CommandListManager::CreateNewCommandList(ID3D12GraphicsCommandList** List,
 }
 
 
-void CommandListManager::RequestAllocator(ID3D12CommandAllocator** ppAllocator)
+bool CommandListManager::UseEnhancedBarriers() const
 {
-    std::lock_guard<std::mutex> LockGuard{m_AllocatorMutex};
+    // Copy queues only support the common texture layout, so they always use legacy barriers
+    return m_DeviceD3D12Impl.AreEnhancedBarriersEnabled() &&
+        (m_CmdListType == D3D12_COMMAND_LIST_TYPE_DIRECT || m_CmdListType == D3D12_COMMAND_LIST_TYPE_COMPUTE);
+}
 
+Uint64 CommandListManager::GetCompletedFenceValue(SoftwareQueueIndex CmdQueue) const
+{
+    return m_DeviceD3D12Impl.GetCompletedFenceValue(CmdQueue);
+}
+
+void CommandListManager::RequestAllocator(ID3D12CommandAllocator** ppAllocator)
+{
     VERIFY((*ppAllocator) == nullptr, "Allocator pointer is not null");
     (*ppAllocator) = nullptr;
 
-    if (!m_FreeAllocators.empty())
     {
-        *ppAllocator = m_FreeAllocators.back().Detach();
-        HRESULT hr   = (*ppAllocator)->Reset();
+        std::lock_guard<std::mutex> LockGuard{m_AllocatorMutex};
+        if (!m_FreeAllocators.empty())
+        {
+            *ppAllocator = m_FreeAllocators.back().Detach();
+            m_FreeAllocators.pop_back();
+        }
+    }
+
+    if ((*ppAllocator) != nullptr)
+    {
+        // Reset the allocator outside of the lock
+        HRESULT hr = (*ppAllocator)->Reset();
         DEV_CHECK_ERR(SUCCEEDED(hr), "Failed to reset command allocator");
-        m_FreeAllocators.pop_back();
     }
 
     // If no allocators were ready to be reused, create a new one
@@ -32,7 +32,7 @@
 namespace Diligent
 {
 
-D3D12DynamicPage::D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size)
+D3D12DynamicPage::D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size, bool UseGPUUploadHeap)
 {
     D3D12_HEAP_PROPERTIES HeapProps;
     HeapProps.CPUPageProperty      = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
@@ -53,6 +53,12 @@ D3D12DynamicPage::D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size)
 
     D3D12_RESOURCE_STATES DefaultUsage = D3D12_RESOURCE_STATE_GENERIC_READ;
     HeapProps.Type                     = D3D12_HEAP_TYPE_UPLOAD;
+#ifdef D3D12_H_HAS_GPU_UPLOAD_HEAP
+    if (UseGPUUploadHeap)
+        HeapProps.Type = D3D12_HEAP_TYPE_GPU_UPLOAD;
+#else
+    VERIFY(!UseGPUUploadHeap, "GPU upload heaps are not supported by the D3D12 headers");
+#endif
     ResourceDesc.Flags                 = D3D12_RESOURCE_FLAG_NONE;
     DefaultUsage                       = D3D12_RESOURCE_STATE_GENERIC_READ;
     ResourceDesc.Width                 = Size;
@@ -72,19 +78,21 @@ D3D12DynamicPage::D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size)
 
     m_pd3d12Buffer->Map(0, nullptr, &m_CPUVirtualAddress);
 
-    LOG_INFO_MESSAGE("Created dynamic memory page. Size: ", FormatMemorySize(Size, 2), "; GPU virtual address 0x", std::hex, m_GPUVirtualAddress);
+    LOG_INFO_MESSAGE("Created dynamic memory page", (UseGPUUploadHeap ? " in GPU upload heap" : ""), ". Size: ", FormatMemorySize(Size, 2), "; GPU virtual address 0x", std::hex, m_GPUVirtualAddress);
 }
 
 D3D12DynamicMemoryManager::D3D12DynamicMemoryManager(IMemoryAllocator&      Allocator,
                                                      RenderDeviceD3D12Impl& DeviceD3D12Impl,
                                                      Uint32                 NumPagesToReserve,
-                                                     Uint64                 PageSize) :
+                                                     Uint64                 PageSize,
+                                                     Uint64                 GPUUploadBudget) :
     m_DeviceD3D12Impl{DeviceD3D12Impl},
+    m_GPUUploadBudget{GPUUploadBudget},
     m_AvailablePages(STD_ALLOCATOR_RAW_MEM(AvailablePagesMapElemType, Allocator, "Allocator for multimap<AvailablePagesMapElemType>"))
 {
     for (Uint32 i = 0; i < NumPagesToReserve; ++i)
     {
-        D3D12DynamicPage Page(m_DeviceD3D12Impl.GetD3D12Device(), PageSize);
+        D3D12DynamicPage Page = CreatePage(PageSize);
         Uint64           Size = Page.GetSize();
         m_AvailablePages.emplace(Size, std::move(Page));
     }
@@ -106,8 +114,43 @@ D3D12DynamicPage D3D12DynamicMemoryManager::AllocatePage(Uint64 SizeInBytes)
     }
     else
     {
+        return CreatePage(SizeInBytes);
+    }
+}
+
+D3D12DynamicPage D3D12DynamicMemoryManager::CreatePage(Uint64 SizeInBytes)
+{
+    // Reserve space in the GPU upload heap budget. Pages are never destroyed before the manager is,
+    // so the budget only needs to account for created pages.
+    bool UseGPUUploadHeap = false;
+    if (m_GPUUploadBudget != 0)
+    {
+        const Uint64 GPUUploadPageSize = m_GPUUploadPageSize.fetch_add(SizeInBytes) + SizeInBytes;
+        UseGPUUploadHeap               = GPUUploadPageSize <= m_GPUUploadBudget;
+        if (!UseGPUUploadHeap)
+            m_GPUUploadPageSize.fetch_sub(SizeInBytes);
+    }
+
+    D3D12DynamicPage Page = [&]() {
+        if (UseGPUUploadHeap)
+        {
+            D3D12DynamicPage GPUUploadPage{m_DeviceD3D12Impl.GetD3D12Device(), SizeInBytes, true};
+            if (GPUUploadPage.IsValid())
+                return GPUUploadPage;
+
+            // Video memory may be exhausted by other resources
+            m_GPUUploadPageSize.fetch_sub(SizeInBytes);
+        }
         return D3D12DynamicPage{m_DeviceD3D12Impl.GetD3D12Device(), SizeInBytes};
+    }();
+
+    const Uint64 TotalPageSize = m_TotalPageSize.fetch_add(Page.GetSize()) + Page.GetSize();
+    Uint64       PeakPageSize  = m_PeakTotalPageSize.load();
+    while (TotalPageSize > PeakPageSize && !m_PeakTotalPageSize.compare_exchange_weak(PeakPageSize, TotalPageSize))
+    {
     }
+
+    return Page;
 }
 
 void D3D12DynamicMemoryManager::ReleasePages(std::vector<D3D12DynamicPage>& Pages, Uint64 QueueMask)
@@ -167,6 +210,7 @@ void D3D12DynamicMemoryManager::Destroy()
                      FormatMemorySize(TotalAllocatedSize, 2));
 
     m_AvailablePages.clear();
+    m_TotalPageSize.store(0);
 }
 
 D3D12DynamicMemoryManager::~D3D12DynamicMemoryManager()
@@ -479,6 +479,119 @@ D3D12_RESOURCE_STATES GetSupportedD3D12ResourceStatesForCommandList(D3D12_COMMAN
     }
 }
 
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+D3D12_BARRIER_SYNC D3D12ResourceStatesToD3D12BarrierSync(D3D12_RESOURCE_STATES States)
+{
+    if (States == D3D12_RESOURCE_STATE_COMMON)
+        return D3D12_BARRIER_SYNC_ALL;
+
+    D3D12_BARRIER_SYNC Sync = D3D12_BARRIER_SYNC_NONE;
+    if (States & D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER)
+        Sync |= D3D12_BARRIER_SYNC_ALL_SHADING;
+    if (States & D3D12_RESOURCE_STATE_INDEX_BUFFER)
+        Sync |= D3D12_BARRIER_SYNC_INDEX_INPUT;
+    if (States & D3D12_RESOURCE_STATE_RENDER_TARGET)
+        Sync |= D3D12_BARRIER_SYNC_RENDER_TARGET;
+    if (States & D3D12_RESOURCE_STATE_UNORDERED_ACCESS)
+    {
+        // UAVs are also written by ClearUnorderedAccessView*() and by acceleration structure builds (scratch buffers)
+        Sync |= D3D12_BARRIER_SYNC_ALL_SHADING | D3D12_BARRIER_SYNC_CLEAR_UNORDERED_ACCESS_VIEW | D3D12_BARRIER_SYNC_BUILD_RAYTRACING_ACCELERATION_STRUCTURE;
+    }
+    if (States & (D3D12_RESOURCE_STATE_DEPTH_WRITE | D3D12_RESOURCE_STATE_DEPTH_READ))
+        Sync |= D3D12_BARRIER_SYNC_DEPTH_STENCIL;
+    if (States & D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE)
+        Sync |= D3D12_BARRIER_SYNC_NON_PIXEL_SHADING;
+    if (States & D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE)
+        Sync |= D3D12_BARRIER_SYNC_PIXEL_SHADING;
+    if (States & D3D12_RESOURCE_STATE_STREAM_OUT)
+        Sync |= D3D12_BARRIER_SYNC_VERTEX_SHADING;
+    if (States & D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT)
+        Sync |= D3D12_BARRIER_SYNC_EXECUTE_INDIRECT;
+    if (States & (D3D12_RESOURCE_STATE_COPY_DEST | D3D12_RESOURCE_STATE_COPY_SOURCE))
+        Sync |= D3D12_BARRIER_SYNC_COPY;
+    if (States & (D3D12_RESOURCE_STATE_RESOLVE_DEST | D3D12_RESOURCE_STATE_RESOLVE_SOURCE))
+        Sync |= D3D12_BARRIER_SYNC_RESOLVE;
+    if (States & D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE)
+        Sync |= D3D12_BARRIER_SYNC_RAYTRACING | D3D12_BARRIER_SYNC_BUILD_RAYTRACING_ACCELERATION_STRUCTURE;
+    if (States & D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE)
+        Sync |= D3D12_BARRIER_SYNC_PIXEL_SHADING;
+
+    return Sync;
+}
+
+D3D12_BARRIER_ACCESS D3D12ResourceStatesToD3D12BarrierAccess(D3D12_RESOURCE_STATES States)
+{
+    if (States == D3D12_RESOURCE_STATE_COMMON)
+        return D3D12_BARRIER_ACCESS_COMMON;
+
+    D3D12_BARRIER_ACCESS Access = static_cast<D3D12_BARRIER_ACCESS>(0);
+    if (States & D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER)
+        Access |= D3D12_BARRIER_ACCESS_VERTEX_BUFFER | D3D12_BARRIER_ACCESS_CONSTANT_BUFFER;
+    if (States & D3D12_RESOURCE_STATE_INDEX_BUFFER)
+        Access |= D3D12_BARRIER_ACCESS_INDEX_BUFFER;
+    if (States & D3D12_RESOURCE_STATE_RENDER_TARGET)
+        Access |= D3D12_BARRIER_ACCESS_RENDER_TARGET;
+    if (States & D3D12_RESOURCE_STATE_UNORDERED_ACCESS)
+        Access |= D3D12_BARRIER_ACCESS_UNORDERED_ACCESS;
+    if (States & D3D12_RESOURCE_STATE_DEPTH_WRITE)
+        Access |= D3D12_BARRIER_ACCESS_DEPTH_STENCIL_WRITE;
+    if (States & D3D12_RESOURCE_STATE_DEPTH_READ)
+        Access |= D3D12_BARRIER_ACCESS_DEPTH_STENCIL_READ;
+    if (States & (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE))
+        Access |= D3D12_BARRIER_ACCESS_SHADER_RESOURCE;
+    if (States & D3D12_RESOURCE_STATE_STREAM_OUT)
+        Access |= D3D12_BARRIER_ACCESS_STREAM_OUTPUT;
+    if (States & D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT)
+        Access |= D3D12_BARRIER_ACCESS_INDIRECT_ARGUMENT;
+    if (States & D3D12_RESOURCE_STATE_COPY_DEST)
+        Access |= D3D12_BARRIER_ACCESS_COPY_DEST;
+    if (States & D3D12_RESOURCE_STATE_COPY_SOURCE)
+        Access |= D3D12_BARRIER_ACCESS_COPY_SOURCE;
+    if (States & D3D12_RESOURCE_STATE_RESOLVE_DEST)
+        Access |= D3D12_BARRIER_ACCESS_RESOLVE_DEST;
+    if (States & D3D12_RESOURCE_STATE_RESOLVE_SOURCE)
+        Access |= D3D12_BARRIER_ACCESS_RESOLVE_SOURCE;
+    if (States & D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE)
+        Access |= D3D12_BARRIER_ACCESS_RAYTRACING_ACCELERATION_STRUCTURE_READ;
+    if (States & D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE)
+        Access |= D3D12_BARRIER_ACCESS_SHADING_RATE_SOURCE;
+
+    return Access;
+}
+
+D3D12_BARRIER_LAYOUT D3D12ResourceStatesToD3D12BarrierLayout(D3D12_RESOURCE_STATES States)
+{
+    // Note that D3D12_RESOURCE_STATE_PRESENT == D3D12_RESOURCE_STATE_COMMON and
+    // D3D12_BARRIER_LAYOUT_PRESENT == D3D12_BARRIER_LAYOUT_COMMON
+    switch (States)
+    {
+        // clang-format off
+        case D3D12_RESOURCE_STATE_COMMON:                     return D3D12_BARRIER_LAYOUT_COMMON;
+        case D3D12_RESOURCE_STATE_RENDER_TARGET:              return D3D12_BARRIER_LAYOUT_RENDER_TARGET;
+        case D3D12_RESOURCE_STATE_UNORDERED_ACCESS:           return D3D12_BARRIER_LAYOUT_UNORDERED_ACCESS;
+        case D3D12_RESOURCE_STATE_DEPTH_WRITE:                return D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_WRITE;
+        case D3D12_RESOURCE_STATE_COPY_DEST:                  return D3D12_BARRIER_LAYOUT_COPY_DEST;
+        case D3D12_RESOURCE_STATE_COPY_SOURCE:                return D3D12_BARRIER_LAYOUT_COPY_SOURCE;
+        case D3D12_RESOURCE_STATE_RESOLVE_DEST:               return D3D12_BARRIER_LAYOUT_RESOLVE_DEST;
+        case D3D12_RESOURCE_STATE_RESOLVE_SOURCE:             return D3D12_BARRIER_LAYOUT_RESOLVE_SOURCE;
+        case D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE:        return D3D12_BARRIER_LAYOUT_SHADING_RATE_SOURCE;
+        // clang-format on
+        default:
+            break;
+    }
+
+    if ((States & D3D12_RESOURCE_STATE_DEPTH_READ) != 0)
+        return D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_READ;
+
+    constexpr D3D12_RESOURCE_STATES ShaderResourceStates = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+    if ((States & ShaderResourceStates) == States)
+        return D3D12_BARRIER_LAYOUT_SHADER_RESOURCE;
+
+    // Any other combination of read-only states
+    return D3D12_BARRIER_LAYOUT_GENERIC_READ;
+}
+#endif
+
 static RESOURCE_STATE D3D12ResourceStateToResourceStateFlags(D3D12_RESOURCE_STATES state)
 {
     static_assert(RESOURCE_STATE_MAX_BIT == (1u << 21), "This function must be updated to handle new resource state flag");
@@ -27,8 +27,12 @@
 
 #include "pch.h"
 #include "DescriptorHeap.hpp"
+
+#include <thread>
+
 #include "RenderDeviceD3D12Impl.hpp"
 #include "D3D12Utils.h"
+#include "Trace.hpp"
 
 namespace Diligent
 {
@@ -193,10 +197,10 @@ DescriptorHeapAllocation DescriptorHeapAllocationManager::Allocate(uint32_t Coun
     VERIFY_EXPR(Count > 0);
 
     std::lock_guard<std::mutex> LockGuard(m_FreeBlockManagerMutex);
-    // Methods of VariableSizeAllocationsManager class are not thread safe!
+    // Methods of TLSFAllocationsManager class are not thread safe!
 
-    // Use variable-size GPU allocations manager to allocate the requested number of descriptors
-    VariableSizeAllocationsManager::Allocation Allocation = m_FreeBlockManager.Allocate(Count, 1);
+    // Use variable-size allocations manager to allocate the requested number of descriptors
+    TLSFAllocationsManager::Allocation Allocation = m_FreeBlockManager.Allocate(Count, 1);
     if (!Allocation.IsValid())
         return DescriptorHeapAllocation{};
 
@@ -242,7 +246,7 @@ void DescriptorHeapAllocationManager::FreeAllocation(DescriptorHeapAllocation&&
 
     std::lock_guard<std::mutex> LockGuard(m_FreeBlockManagerMutex);
     size_t                      DescriptorOffset = (Allocation.GetCpuHandle().ptr - m_FirstCPUHandle.ptr) / m_DescriptorSize;
-    // Methods of VariableSizeAllocationsManager class are not thread safe!
+    // Methods of TLSFAllocationsManager class are not thread safe!
     m_FreeBlockManager.Free(DescriptorOffset, Allocation.GetNumHandles());
 
     // Clear the allocation
@@ -280,12 +284,17 @@ CPUDescriptorHeap::CPUDescriptorHeap(IMemoryAllocator&           Allocator,
     // Create one pool
     m_HeapPool.emplace_back(m_MemAllocator, m_DeviceD3D12Impl, *this, 0, m_HeapDesc);
     m_AvailableHeaps.insert(0);
+
+    for (SingleDescriptorCache& Cache : m_SingleDescriptorCaches)
+        Cache.Allocations.reserve(SingleDescriptorBatchSize * 2);
 }
 
 CPUDescriptorHeap::~CPUDescriptorHeap()
 {
     DEV_CHECK_ERR(m_CurrentSize == 0, "Not all allocations released");
 
+    ReleaseSingleDescriptorCaches();
+
     DEV_CHECK_ERR(m_AvailableHeaps.size() == m_HeapPool.size(), "Not all descriptor heap pools are released");
     Uint32 TotalDescriptors = 0;
     for (DescriptorHeapAllocationManager& Heap : m_HeapPool)
@@ -294,9 +303,10 @@ CPUDescriptorHeap::~CPUDescriptorHeap()
         TotalDescriptors += Heap.GetMaxDescriptors();
     }
 
+    const Uint32 MaxSize = m_MaxSize.load();
     LOG_INFO_MESSAGE(std::setw(38), std::left, GetD3D12DescriptorHeapTypeLiteralName(m_HeapDesc.Type), " CPU heap allocated pool count: ", m_HeapPool.size(),
-                     ". Max descriptors: ", m_MaxSize, '/', TotalDescriptors,
-                     " (", std::fixed, std::setprecision(2), m_MaxSize * 100.0 / std::max(TotalDescriptors, 1u), "%).");
+                     ". Max descriptors: ", MaxSize, '/', TotalDescriptors,
+                     " (", std::fixed, std::setprecision(2), MaxSize * 100.0 / std::max(TotalDescriptors, 1u), "%).");
 }
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -307,13 +317,72 @@ int32_t CPUDescriptorHeap::DvpGetTotalAllocationCount()
     std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
     for (DescriptorHeapAllocationManager& Heap : m_HeapPool)
         AllocationCount += Heap.DvpGetAllocationsCounter();
+    // Descriptors in the single-descriptor caches are not used by the application
+    AllocationCount -= static_cast<int32_t>(m_NumCachedDescriptors.load());
     return AllocationCount;
 }
 #endif
 
-DescriptorHeapAllocation CPUDescriptorHeap::Allocate(uint32_t Count)
+CPUDescriptorHeap::SingleDescriptorCache& CPUDescriptorHeap::GetSingleDescriptorCache()
+{
+    const size_t ThreadHash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return m_SingleDescriptorCaches[ThreadHash % NumSingleDescriptorCaches];
+}
+
+void CPUDescriptorHeap::ReleaseSingleDescriptorCaches()
 {
     std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
+    for (SingleDescriptorCache& Cache : m_SingleDescriptorCaches)
+    {
+        std::lock_guard<std::mutex> CacheLock(Cache.Mtx);
+        for (DescriptorHeapAllocation& Allocation : Cache.Allocations)
+            FreeToPool(std::move(Allocation));
+        m_NumCachedDescriptors.fetch_sub(static_cast<Uint32>(Cache.Allocations.size()));
+        Cache.Allocations.clear();
+    }
+}
+
+DescriptorHeapAllocation CPUDescriptorHeap::Allocate(uint32_t Count)
+{
+    DILIGENT_TRACE_SCOPE("AllocateCPUDescriptors");
+
+    DescriptorHeapAllocation Allocation;
+    if (Count == 1)
+    {
+        SingleDescriptorCache&       Cache = GetSingleDescriptorCache();
+        std::unique_lock<std::mutex> CacheLock(Cache.Mtx);
+        if (Cache.Allocations.empty())
+        {
+            // Refill the cache with a batch of descriptors. Lock order is always
+            // cache mutex -> heap pool mutex
+            std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
+            for (size_t i = 0; i < SingleDescriptorBatchSize; ++i)
+                Cache.Allocations.emplace_back(AllocateFromPool(1));
+            m_NumCachedDescriptors.fetch_add(static_cast<Uint32>(SingleDescriptorBatchSize));
+        }
+        Allocation = std::move(Cache.Allocations.back());
+        Cache.Allocations.pop_back();
+        m_NumCachedDescriptors.fetch_sub(1);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
+        Allocation = AllocateFromPool(Count);
+    }
+
+    const Uint32 CurrentSize = m_CurrentSize.fetch_add(Allocation.GetNumHandles()) + Allocation.GetNumHandles();
+
+    Uint32 MaxSize = m_MaxSize.load();
+    while (!m_MaxSize.compare_exchange_weak(MaxSize, std::max(MaxSize, CurrentSize)))
+    {
+        // If exchange fails, MaxSize will hold the actual value of m_MaxSize
+    }
+
+    return Allocation;
+}
+
+DescriptorHeapAllocation CPUDescriptorHeap::AllocateFromPool(uint32_t Count)
+{
     // Note that every DescriptorHeapAllocationManager object instance is itself
     // thread-safe. Nested mutexes cannot cause a deadlock
 
@@ -357,9 +426,6 @@ DescriptorHeapAllocation CPUDescriptorHeap::Allocate(uint32_t Count)
         Allocation = m_HeapPool[*NewHeapIt.first].Allocate(Count);
     }
 
-    m_CurrentSize += static_cast<Uint32>(Allocation.GetNumHandles());
-    m_MaxSize = std::max(m_MaxSize, m_CurrentSize);
-
     return Allocation;
 }
 
@@ -401,9 +467,36 @@ void CPUDescriptorHeap::Free(DescriptorHeapAllocation&& Allocation, Uint64 CmdQu
 
 void CPUDescriptorHeap::FreeAllocation(DescriptorHeapAllocation&& Allocation)
 {
-    std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
-    size_t                      ManagerId = Allocation.GetAllocationManagerId();
-    m_CurrentSize -= static_cast<Uint32>(Allocation.GetNumHandles());
+    m_CurrentSize.fetch_sub(Allocation.GetNumHandles());
+
+    if (Allocation.GetNumHandles() == 1)
+    {
+        SingleDescriptorCache&      Cache = GetSingleDescriptorCache();
+        std::lock_guard<std::mutex> CacheLock(Cache.Mtx);
+        Cache.Allocations.emplace_back(std::move(Allocation));
+        m_NumCachedDescriptors.fetch_add(1);
+        if (Cache.Allocations.size() >= SingleDescriptorBatchSize * 2)
+        {
+            // Return a batch of descriptors to the managers
+            std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
+            for (size_t i = 0; i < SingleDescriptorBatchSize; ++i)
+            {
+                FreeToPool(std::move(Cache.Allocations.back()));
+                Cache.Allocations.pop_back();
+            }
+            m_NumCachedDescriptors.fetch_sub(static_cast<Uint32>(SingleDescriptorBatchSize));
+        }
+    }
+    else
+    {
+        std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
+        FreeToPool(std::move(Allocation));
+    }
+}
+
+void CPUDescriptorHeap::FreeToPool(DescriptorHeapAllocation&& Allocation)
+{
+    size_t ManagerId = Allocation.GetAllocationManagerId();
     m_HeapPool[ManagerId].FreeAllocation(std::move(Allocation));
     // Return the manager to the pool of available managers
     VERIFY_EXPR(m_HeapPool[ManagerId].GetNumAvailableDescriptors() > 0);
@@ -538,6 +631,8 @@ void DynamicSuballocationsManager::ReleaseAllocations(Uint64 CmdQueueMask)
 
 DescriptorHeapAllocation DynamicSuballocationsManager::Allocate(Uint32 Count)
 {
+    DILIGENT_TRACE_SCOPE("AllocateDynamicDescriptors");
+
     // This method is intentionally lock-free as it is expected to
     // be called through device context from single thread only
 
@@ -574,6 +669,8 @@ DescriptorHeapAllocation DynamicSuballocationsManager::Allocate(Uint32 Count)
     m_CurrentSuballocationOffset += Count;
     m_CurrDescriptorCount += Count;
     m_PeakDescriptorCount = std::max(m_PeakDescriptorCount, m_CurrDescriptorCount);
+    if (m_pAllocationCounter != nullptr)
+        ++(*m_pAllocationCounter);
 
     return Allocation;
 }
@@ -31,6 +31,7 @@
 
 #include <sstream>
 #include <array>
+#include <algorithm>
 
 #include "RenderDeviceD3D12Impl.hpp"
 #include "PipelineStateD3D12Impl.hpp"
@@ -48,9 +49,12 @@
 #include "d3dx12_win.h"
 #include "D3D12DynamicHeap.hpp"
 #include "QueryManagerD3D12.hpp"
+#include "QueryPoolD3D12Impl.hpp"
+#include "IndirectCommandSignatureD3D12Impl.hpp"
 #include "DXGITypeConversions.hpp"
 
 #include "D3D12TileMappingHelper.hpp"
+#include "Trace.hpp"
 
 namespace Diligent
 {
@@ -101,6 +105,9 @@ DeviceContextD3D12Impl::DeviceContextD3D12Impl(IReferenceCounters*      pRefCoun
     m_NullRTV{pDeviceD3D12Impl->AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_RTV, 1)}
 // clang-format on
 {
+    for (DynamicSuballocationsManager& Allocator : m_DynamicGPUDescriptorAllocator)
+        Allocator.SetAllocationCounter(&m_Stats.DescriptorAllocations);
+
     ID3D12Device* pd3d12Device = pDeviceD3D12Impl->GetD3D12Device();
     if (!IsDeferred())
     {
@@ -189,6 +196,12 @@ DeviceContextD3D12Impl::~DeviceContextD3D12Impl()
     }
     else
     {
+        if (m_SubmissionBatch.IsActive)
+        {
+            LOG_ERROR_MESSAGE("The immediate context is being destroyed while the submission batch is active. Call EndSubmissionBatch() to submit the batch.");
+            m_SubmissionBatch.IsActive = false;
+        }
+        // Flush() submits the command lists accumulated by the batch, if any
         Flush(false);
     }
 
@@ -253,21 +266,21 @@ ID3D12CommandSignature* DeviceContextD3D12Impl::GetDrawIndexedIndirectSignature(
     return Sig;
 }
 
-void DeviceContextD3D12Impl::Begin(Uint32 ImmediateContextId)
+void DeviceContextD3D12Impl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
 {
     DEV_CHECK_ERR(ImmediateContextId < m_pDevice->GetCommandQueueCount(), "ImmediateContextId is out of range");
     SoftwareQueueIndex            CommandQueueId{ImmediateContextId};
     const D3D12_COMMAND_LIST_TYPE d3d12CmdListType = m_pDevice->GetCommandQueueType(CommandQueueId);
     const COMMAND_QUEUE_TYPE      QueueType        = D3D12CommandListTypeToCmdQueueType(d3d12CmdListType);
-    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, QueueType);
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, QueueType, Flags);
     RequestCommandContext();
     m_QueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
 }
 
 void DeviceContextD3D12Impl::SetPipelineState(IPipelineState* pPipelineState)
 {
-    RefCntAutoPtr<PipelineStateD3D12Impl> pOldPipeline = m_pPipelineState;
-    if (!TDeviceContextBase::SetPipelineState(pPipelineState, PipelineStateD3D12Impl::IID_InternalImpl))
+    RefCntAutoPtr<PipelineStateD3D12Impl> pOldPipeline;
+    if (!TDeviceContextBase::SetPipelineState(pPipelineState, PipelineStateD3D12Impl::IID_InternalImpl, &pOldPipeline))
         return;
 
     const PipelineStateDesc& PSODesc = m_pPipelineState->GetDesc();
@@ -318,13 +331,17 @@ void DeviceContextD3D12Impl::SetPipelineState(IPipelineState* pPipelineState)
         {
             const GraphicsPipelineDesc& GraphicsPipeline = m_pPipelineState->GetGraphicsPipelineDesc();
             GraphicsContext&            GraphicsCtx      = CmdCtx.AsGraphicsContext();
-            ID3D12PipelineState*        pd3d12PSO        = m_pPipelineState->GetD3D12PipelineState();
+            const bool                  DynamicStates    = m_pPipelineState->HasExtendedDynamicState();
+            ID3D12PipelineState*        pd3d12PSO        = DynamicStates ?
+                               m_pPipelineState->GetD3D12PipelineState(m_DynamicStates) :
+                               m_pPipelineState->GetD3D12PipelineState();
             GraphicsCtx.SetPipelineState(pd3d12PSO);
             GraphicsCtx.SetGraphicsRootSignature(pd3d12RootSig);
+            m_State.bDynamicStatePSODirty = false;
 
             if (PSODesc.PipelineType == PIPELINE_TYPE_GRAPHICS)
             {
-                D3D12_PRIMITIVE_TOPOLOGY D3D12Topology = TopologyToD3D12Topology(GraphicsPipeline.PrimitiveTopology);
+                D3D12_PRIMITIVE_TOPOLOGY D3D12Topology = TopologyToD3D12Topology(DynamicStates ? m_DynamicStates.Topology : GraphicsPipeline.PrimitiveTopology);
                 GraphicsCtx.SetPrimitiveTopology(D3D12Topology);
             }
 
@@ -397,6 +414,7 @@ void DeviceContextD3D12Impl::CommitRootTablesAndViews(RootTableInfo& RootInfo, U
 
         CommitAttribs.pResourceCache = pResourceCache;
         CommitAttribs.BaseRootIndex  = RootSig.GetBaseRootIndex(sign);
+        CommitAttribs.pDynamicTables = &RootInfo.DynamicTables[sign];
         if ((RootInfo.StaleSRBMask & SignBit) != 0)
         {
             // Commit root tables for stale SRBs only
@@ -428,6 +446,8 @@ void DeviceContextD3D12Impl::TransitionShaderResources(IShaderResourceBinding* p
 {
     DEV_CHECK_ERR(!m_pActiveRenderPass, "State transitions are not allowed inside a render pass.");
 
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Barrier};
+
     CommandContext&                 CmdCtx               = GetCmdContext();
     ShaderResourceBindingD3D12Impl* pResBindingD3D12Impl = ClassPtrCast<ShaderResourceBindingD3D12Impl>(pShaderResourceBinding);
     ShaderResourceCacheD3D12&       ResourceCache        = pResBindingD3D12Impl->GetResourceCache();
@@ -437,6 +457,9 @@ void DeviceContextD3D12Impl::TransitionShaderResources(IShaderResourceBinding* p
 
 void DeviceContextD3D12Impl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_TRACE_SCOPE("CommitShaderResources");
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Commit};
+
     DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
 
     ShaderResourceBindingD3D12Impl*     pResBindingD3D12Impl = ClassPtrCast<ShaderResourceBindingD3D12Impl>(pShaderResourceBinding);
@@ -448,6 +471,9 @@ void DeviceContextD3D12Impl::CommitShaderResources(IShaderResourceBinding* pShad
     ResourceCache.DbgValidateDynamicBuffersMask();
 #endif
 
+    if (m_pDevice->GetResidencyManager() != nullptr)
+        ResourceCache.MarkResourcesReferencedByCommandList();
+
     if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
         ResourceCache.TransitionResourceStates(CmdCtx, ShaderResourceCacheD3D12::StateTransitionMode::Transition);
@@ -473,11 +499,14 @@ DeviceContextD3D12Impl::RootTableInfo& DeviceContextD3D12Impl::GetRootTableInfo(
 }
 
 #ifdef DILIGENT_DEVELOPMENT
-void DeviceContextD3D12Impl::DvpValidateCommittedShaderResources(RootTableInfo& RootInfo) const
+void DeviceContextD3D12Impl::DvpValidateCommittedShaderResources(RootTableInfo& RootInfo)
 {
     if (RootInfo.ResourcesValidated)
         return;
 
+    if (!DvpIsCommandValidationRequired(RootInfo))
+        return;
+
     DvpVerifySRBCompatibility(RootInfo,
                               [this](Uint32 idx) {
                                   // Use signature from the root signature
@@ -505,6 +534,35 @@ void DeviceContextD3D12Impl::SetBlendFactors(const float* pBlendFactors)
     }
 }
 
+void DeviceContextD3D12Impl::SetCullMode(CULL_MODE CullMode)
+{
+    if (TDeviceContextBase::SetCullMode(CullMode, 0))
+    {
+        // The pipeline variant matching the new state will be set by the next draw command
+        m_State.bDynamicStatePSODirty = true;
+    }
+}
+
+void DeviceContextD3D12Impl::SetDepthState(Bool                DepthEnable,
+                                           Bool                DepthWriteEnable,
+                                           COMPARISON_FUNCTION DepthFunc)
+{
+    if (TDeviceContextBase::SetDepthState(DepthEnable, DepthWriteEnable, DepthFunc, 0))
+    {
+        m_State.bDynamicStatePSODirty = true;
+    }
+}
+
+void DeviceContextD3D12Impl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    if (TDeviceContextBase::SetPrimitiveTopology(Topology, 0))
+    {
+        GetCmdContext().AsGraphicsContext().SetPrimitiveTopology(TopologyToD3D12Topology(m_DynamicStates.Topology));
+        // Index buffer strip cut value is part of the pipeline state
+        m_State.bDynamicStatePSODirty = true;
+    }
+}
+
 void DeviceContextD3D12Impl::CommitD3D12IndexBuffer(GraphicsContext& GraphCtx, VALUE_TYPE IndexType)
 {
     DEV_CHECK_ERR(m_pIndexBuffer != nullptr, "Index buffer is not set up for indexed draw command");
@@ -606,6 +664,12 @@ void DeviceContextD3D12Impl::PrepareForDraw(GraphicsContext& GraphCtx, DRAW_FLAG
     DvpVerifyRenderTargets();
 #endif
 
+    if (m_State.bDynamicStatePSODirty && m_pPipelineState->HasExtendedDynamicState())
+    {
+        GraphCtx.SetPipelineState(m_pPipelineState->GetD3D12PipelineState(m_DynamicStates));
+        m_State.bDynamicStatePSODirty = false;
+    }
+
     if (!m_State.bCommittedD3D12VBsUpToDate && m_pPipelineState->GetNumBufferSlotsUsed() > 0)
     {
         CommitD3D12VertexBuffers(GraphCtx);
@@ -824,6 +888,56 @@ void DeviceContextD3D12Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttrib
     ++m_State.NumCommands;
 }
 
+void DeviceContextD3D12Impl::ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs)
+{
+    TDeviceContextBase::ExecuteIndirectCommands(Attribs, 0);
+
+    const IndirectCommandSignatureD3D12Impl* pSignatureD3D12 = ClassPtrCast<const IndirectCommandSignatureD3D12Impl>(Attribs.pSignature);
+
+    GraphicsContext& GraphCtx = GetCmdContext().AsGraphicsContext();
+    if (pSignatureD3D12->GetDrawArgumentType() == INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW_INDEXED && !pSignatureD3D12->HasIndexBufferArgument())
+        PrepareForIndexedDraw(GraphCtx, Attribs.Flags, Attribs.IndexType);
+    else
+        PrepareForDraw(GraphCtx, Attribs.Flags);
+
+    ID3D12Resource* pd3d12ArgsBuff          = nullptr;
+    Uint64          BuffDataStartByteOffset = 0;
+    PrepareIndirectAttribsBuffer(GraphCtx, Attribs.pArgsBuffer, Attribs.ArgsBufferStateTransitionMode, pd3d12ArgsBuff, BuffDataStartByteOffset,
+                                 "Indirect commands (DeviceContextD3D12Impl::ExecuteIndirectCommands)");
+
+    ID3D12Resource* pd3d12CountBuff              = nullptr;
+    Uint64          CountBuffDataStartByteOffset = 0;
+    if (Attribs.pCounterBuffer != nullptr)
+    {
+        PrepareIndirectAttribsBuffer(GraphCtx, Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, pd3d12CountBuff, CountBuffDataStartByteOffset,
+                                     "Count buffer (DeviceContextD3D12Impl::ExecuteIndirectCommands)");
+    }
+
+    if (Attribs.MaxCommandCount > 0)
+    {
+        GraphCtx.ExecuteIndirect(pSignatureD3D12->GetD3D12CommandSignature(),
+                                 Attribs.MaxCommandCount,
+                                 pd3d12ArgsBuff,
+                                 Attribs.ArgsOffset + BuffDataStartByteOffset,
+                                 pd3d12CountBuff,
+                                 pd3d12CountBuff != nullptr ? Attribs.CounterOffset + CountBuffDataStartByteOffset : 0);
+    }
+
+    // Bindings changed by the commands persist in the command list, so the state
+    // set by the application must be committed again before the next draw.
+    if (pSignatureD3D12->ChangesInputBuffers())
+    {
+        m_State.bCommittedD3D12VBsUpToDate = false;
+        m_State.bCommittedD3D12IBUpToDate  = false;
+    }
+    if (pSignatureD3D12->ChangesConstantBuffers())
+    {
+        GetRootTableInfo(PIPELINE_TYPE_GRAPHICS).MakeAllStale();
+    }
+
+    ++m_State.NumCommands;
+}
+
 void DeviceContextD3D12Impl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
     TDeviceContextBase::DrawMesh(Attribs, 0);
@@ -983,6 +1097,52 @@ void DeviceContextD3D12Impl::ClearRenderTarget(ITextureView* pView, const void*
     ++m_State.NumCommands;
 }
 
+void DeviceContextD3D12Impl::InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil)
+{
+    TDeviceContextBase::InvalidateRenderTargets(RenderTargetMask, InvalidateDepthStencil);
+
+    CommandContext& CmdCtx = GetCmdContext();
+
+    // DiscardResource requires render targets to be in D3D12_RESOURCE_STATE_RENDER_TARGET state and
+    // depth-stencil buffers to be in D3D12_RESOURCE_STATE_DEPTH_WRITE state. Since invalidation is
+    // only a hint, views of textures in other or unknown states are skipped.
+    auto DiscardView = [&](TextureViewD3D12Impl& View, RESOURCE_STATE RequiredState) {
+        TextureD3D12Impl*  pTexD3D12 = View.GetTexture<TextureD3D12Impl>();
+        const TextureDesc& TexDesc   = pTexD3D12->GetDesc();
+        if (!pTexD3D12->IsInKnownState() || !pTexD3D12->CheckState(RequiredState))
+            return;
+
+        // Views of 3D textures may only cover a range of depth slices of a subresource
+        if (TexDesc.Is3D())
+            return;
+
+        const TextureViewDesc& ViewDesc   = View.GetDesc();
+        const Uint32           PlaneCount = GetTextureFormatAttribs(TexDesc.Format).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL ? 2 : 1;
+
+        CmdCtx.FlushResourceBarriers();
+        D3D12_DISCARD_REGION Region{};
+        Region.NumSubresources = 1;
+        for (Uint32 plane = 0; plane < PlaneCount; ++plane)
+        {
+            for (Uint32 slice = 0; slice < ViewDesc.NumArraySlices; ++slice)
+            {
+                Region.FirstSubresource = D3D12CalcSubresource(ViewDesc.MostDetailedMip, ViewDesc.FirstArraySlice + slice, plane, TexDesc.MipLevels, TexDesc.GetArraySize());
+                CmdCtx.DiscardResource(pTexD3D12->GetD3D12Resource(), &Region);
+            }
+        }
+        ++m_State.NumCommands;
+    };
+
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        if ((RenderTargetMask & (1u << rt)) != 0 && m_pBoundRenderTargets[rt])
+            DiscardView(*m_pBoundRenderTargets[rt], RESOURCE_STATE_RENDER_TARGET);
+    }
+
+    if (InvalidateDepthStencil && m_pBoundDepthStencil && m_pBoundDepthStencil->GetDesc().ViewType == TEXTURE_VIEW_DEPTH_STENCIL)
+        DiscardView(*m_pBoundDepthStencil, RESOURCE_STATE_DEPTH_WRITE);
+}
+
 void DeviceContextD3D12Impl::RequestCommandContext()
 {
     m_CurrCmdCtx = m_pDevice->AllocateCommandContext(GetCommandQueueId(), "Command list");
@@ -993,14 +1153,17 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
                                    Uint32               NumCommandLists,
                                    ICommandList* const* ppCommandLists)
 {
+    DILIGENT_TRACE_SCOPE("Flush");
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Submit};
+
     VERIFY(!IsDeferred() || NumCommandLists == 0 && ppCommandLists == nullptr, "Only immediate context can execute command lists");
 
     DEV_CHECK_ERR(m_ActiveQueriesCounter == 0,
                   "Flushing device context that has ", m_ActiveQueriesCounter,
                   " active queries. Direct3D12 requires that queries are begun and ended in the same command list");
 
-    // TODO: use small_vector
-    std::vector<RenderDeviceD3D12Impl::PooledCommandContext> Contexts;
+    FrameArena::Scope                                               Arena;
+    FrameArena::Vector<RenderDeviceD3D12Impl::PooledCommandContext> Contexts{Arena.MakeAllocator<RenderDeviceD3D12Impl::PooledCommandContext>()};
     Contexts.reserve(size_t{NumCommandLists} + 1);
 
     // First, execute current context
@@ -1014,9 +1177,17 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
     }
 
     // Next, add extra command lists from deferred contexts
+    bool HasReusableLists = false;
     for (Uint32 i = 0; i < NumCommandLists; ++i)
     {
         CommandListD3D12Impl* const pCmdListD3D12 = ClassPtrCast<CommandListD3D12Impl>(ppCommandLists[i]);
+        if (pCmdListD3D12->IsReusable())
+        {
+            // Null context marks the position of the reusable command list
+            Contexts.emplace_back();
+            HasReusableLists = true;
+            continue;
+        }
 
         RefCntAutoPtr<DeviceContextD3D12Impl> pDeferredCtx;
         Contexts.emplace_back(pCmdListD3D12->Close(pDeferredCtx));
@@ -1025,27 +1196,48 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
         pDeferredCtx->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
     }
 
-    if (!Contexts.empty())
+    if (m_SubmissionBatch.IsActive && m_WaitFences.empty() && !HasReusableLists)
     {
-        m_pDevice->CloseAndExecuteCommandContexts(GetCommandQueueId(), static_cast<Uint32>(Contexts.size()), Contexts.data(), true, &m_SignalFences, &m_WaitFences);
-
-#ifdef DILIGENT_DEBUG
-        for (const RenderDeviceD3D12Impl::PooledCommandContext& Ctx : Contexts)
-            VERIFY(!Ctx, "All contexts must be disposed by CloseAndExecuteCommandContexts");
-#endif
+        // Defer the submission until the batch ends. Signal fences are moved to the batch
+        // so that they are signaled after the command lists recorded before them.
+        for (RenderDeviceD3D12Impl::PooledCommandContext& Ctx : Contexts)
+            m_SubmissionBatch.Contexts.emplace_back(std::move(Ctx));
+        for (std::pair<Uint64, RefCntAutoPtr<IFence>>& SignalFence : m_SignalFences)
+            m_SubmissionBatch.SignalFences.emplace_back(std::move(SignalFence));
     }
     else
     {
-        // If there is no command list to submit, but there are pending fences, we need to process them now
+        // Command lists accumulated by the batch must not wait for the fences
+        // that were enqueued after they had been recorded.
+        SubmitBatchedCommandLists();
 
-        if (!m_WaitFences.empty())
+        if (HasReusableLists)
         {
-            m_pDevice->WaitFences(GetCommandQueueId(), m_WaitFences);
+            ExecuteWithReusableCommandLists(static_cast<Uint32>(Contexts.size()), Contexts.data(), NumCommandLists, ppCommandLists);
         }
+        else if (!Contexts.empty())
+        {
+            m_pDevice->CloseAndExecuteCommandContexts(GetCommandQueueId(), static_cast<Uint32>(Contexts.size()), Contexts.data(), true, &m_SignalFences, &m_WaitFences);
+            ++m_Stats.QueueSubmits;
 
-        if (!m_SignalFences.empty())
+#ifdef DILIGENT_DEBUG
+            for (const RenderDeviceD3D12Impl::PooledCommandContext& Ctx : Contexts)
+                VERIFY(!Ctx, "All contexts must be disposed by CloseAndExecuteCommandContexts");
+#endif
+        }
+        else
         {
-            m_pDevice->SignalFences(GetCommandQueueId(), m_SignalFences);
+            // If there is no command list to submit, but there are pending fences, we need to process them now
+
+            if (!m_WaitFences.empty())
+            {
+                m_pDevice->WaitFences(GetCommandQueueId(), m_WaitFences);
+            }
+
+            if (!m_SignalFences.empty())
+            {
+                m_pDevice->SignalFences(GetCommandQueueId(), m_SignalFences);
+            }
         }
     }
 
@@ -1064,14 +1256,92 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
     m_pPipelineState = nullptr;
 }
 
+void DeviceContextD3D12Impl::ExecuteWithReusableCommandLists(Uint32                                      NumContexts,
+                                                             RenderDeviceD3D12Impl::PooledCommandContext pContexts[],
+                                                             Uint32                                      NumCommandLists,
+                                                             ICommandList* const*                        ppCommandLists)
+{
+    // Reusable command lists are already closed and are not owned by command contexts, so
+    // the contexts are submitted in runs between them to preserve the execution order.
+    if (!m_WaitFences.empty())
+        m_pDevice->WaitFences(GetCommandQueueId(), m_WaitFences);
+
+    VERIFY_EXPR(NumContexts >= NumCommandLists);
+    const Uint32 FirstCmdListCtx = NumContexts - NumCommandLists;
+
+    Uint32 RunStart = 0;
+    for (Uint32 i = 0; i <= NumContexts; ++i)
+    {
+        if (i < NumContexts && pContexts[i])
+            continue;
+
+        if (i > RunStart)
+        {
+            m_pDevice->CloseAndExecuteCommandContexts(GetCommandQueueId(), i - RunStart, &pContexts[RunStart], true, nullptr, nullptr);
+            ++m_Stats.QueueSubmits;
+        }
+
+        if (i < NumContexts)
+        {
+            VERIFY_EXPR(i >= FirstCmdListCtx);
+            CommandListD3D12Impl* const pCmdListD3D12 = ClassPtrCast<CommandListD3D12Impl>(ppCommandLists[i - FirstCmdListCtx]);
+            VERIFY_EXPR(pCmdListD3D12->IsReusable());
+            DEV_CHECK_ERR(pCmdListD3D12->GetCommandQueueId() == GetCommandQueueId(), "Reusable command list must be executed in the immediate context it was recorded for.");
+
+            const Uint64 FenceValue = m_pDevice->ExecuteClosedCommandList(GetCommandQueueId(), pCmdListD3D12->GetD3D12CommandList());
+            ++m_Stats.QueueSubmits;
+            pCmdListD3D12->SetLastSubmittedFenceValue(FenceValue);
+            pCmdListD3D12->GetDeferredContext()->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+        }
+        RunStart = i + 1;
+    }
+
+    if (!m_SignalFences.empty())
+        m_pDevice->SignalFences(GetCommandQueueId(), m_SignalFences);
+}
+
 void DeviceContextD3D12Impl::Flush()
 {
     DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
 
+    UpdateGPUFrameTimer();
     Flush(true);
 }
 
+void DeviceContextD3D12Impl::SubmitBatchedCommandLists()
+{
+    if (!m_SubmissionBatch.Contexts.empty())
+    {
+        m_pDevice->CloseAndExecuteCommandContexts(GetCommandQueueId(), static_cast<Uint32>(m_SubmissionBatch.Contexts.size()), m_SubmissionBatch.Contexts.data(),
+                                                  true, &m_SubmissionBatch.SignalFences, nullptr);
+        ++m_Stats.QueueSubmits;
+    }
+    else if (!m_SubmissionBatch.SignalFences.empty())
+    {
+        m_pDevice->SignalFences(GetCommandQueueId(), m_SubmissionBatch.SignalFences);
+    }
+
+    m_SubmissionBatch.Contexts.clear();
+    m_SubmissionBatch.SignalFences.clear();
+}
+
+void DeviceContextD3D12Impl::BeginSubmissionBatch()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Submission batches are only supported by immediate contexts");
+    DEV_CHECK_ERR(!m_SubmissionBatch.IsActive, "Submission batch is already active. Nested batches are not allowed.");
+
+    m_SubmissionBatch.IsActive = true;
+}
+
+void DeviceContextD3D12Impl::EndSubmissionBatch()
+{
+    DEV_CHECK_ERR(m_SubmissionBatch.IsActive, "There is no active submission batch. Did you forget to call BeginSubmissionBatch()?");
+
+    m_SubmissionBatch.IsActive = false;
+    SubmitBatchedCommandLists();
+}
+
 void DeviceContextD3D12Impl::FinishFrame()
 {
 #ifdef DILIGENT_DEBUG
@@ -1121,7 +1391,9 @@ void DeviceContextD3D12Impl::FinishFrame()
     m_DynamicHeap.ReleaseAllocatedPages(QueueMask);
 
     // Dynamic GPU descriptor allocations are returned to the global GPU descriptor heap
-    // hosted by the render device.
+    // hosted by the render device, so the committed dynamic tables can't be reused anymore.
+    m_GraphicsResources.DynamicTables = {};
+    m_ComputeResources.DynamicTables  = {};
     for (size_t i = 0; i < _countof(m_DynamicGPUDescriptorAllocator); ++i)
         m_DynamicGPUDescriptorAllocator[i].ReleaseAllocations(QueueMask);
 
@@ -1135,7 +1407,7 @@ void DeviceContextD3D12Impl::SetVertexBuffers(Uint32                         Sta
                                               RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
                                               SET_VERTEX_BUFFERS_FLAGS       Flags)
 {
-    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+    const bool StreamsChanged = TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags, 0);
 
     CommandContext& CmdCtx = GetCmdContext();
     for (Uint32 Buff = 0; Buff < m_NumVertexStreams; ++Buff)
@@ -1145,7 +1417,8 @@ void DeviceContextD3D12Impl::SetVertexBuffers(Uint32                         Sta
             TransitionOrVerifyBufferState(CmdCtx, *pBufferD3D12, StateTransitionMode, RESOURCE_STATE_VERTEX_BUFFER, "Setting vertex buffers (DeviceContextD3D12Impl::SetVertexBuffers)");
     }
 
-    m_State.bCommittedD3D12VBsUpToDate = false;
+    if (StreamsChanged)
+        m_State.bCommittedD3D12VBsUpToDate = false;
 }
 
 void DeviceContextD3D12Impl::InvalidateState()
@@ -1161,13 +1434,14 @@ void DeviceContextD3D12Impl::InvalidateState()
 
 void DeviceContextD3D12Impl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
-    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+    const bool IndexBufferChanged = TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode, 0);
     if (m_pIndexBuffer)
     {
         CommandContext& CmdCtx = GetCmdContext();
         TransitionOrVerifyBufferState(CmdCtx, *m_pIndexBuffer, StateTransitionMode, RESOURCE_STATE_INDEX_BUFFER, "Setting index buffer (DeviceContextD3D12Impl::SetIndexBuffer)");
     }
-    m_State.bCommittedD3D12IBUpToDate = false;
+    if (IndexBufferChanged)
+        m_State.bCommittedD3D12IBUpToDate = false;
 }
 
 void DeviceContextD3D12Impl::CommitViewports()
@@ -1192,7 +1466,8 @@ void DeviceContextD3D12Impl::CommitViewports()
 void DeviceContextD3D12Impl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
 {
     static_assert(MAX_VIEWPORTS >= D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE, "MaxViewports constant must be greater than D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE");
-    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+    if (!TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight))
+        return;
     VERIFY(NumViewports == m_NumViewports, "Unexpected number of viewports");
 
     CommitViewports();
@@ -1255,7 +1530,8 @@ void DeviceContextD3D12Impl::SetScissorRects(Uint32 NumRects, const Rect* pRects
     VERIFY(NumRects < MaxScissorRects, "Too many scissor rects are being set");
     NumRects = std::min(NumRects, MaxScissorRects);
 
-    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+    if (!TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight))
+        return;
 
     // Only commit scissor rects if scissor test is enabled in the rasterizer state.
     // If scissor is currently disabled, or no PSO is bound, scissor rects will be committed by
@@ -1591,6 +1867,13 @@ void DeviceContextD3D12Impl::CommitSubpassRenderTargets()
     // Set the viewport to match the framebuffer size
     SetViewports(1, nullptr, 0, 0);
 
+    if (Subpass.ViewMask != 0)
+    {
+        // View instance i renders to array slice i (see ViewInstancingGraphicsPipelineStream),
+        // so the subpass view mask directly selects the enabled views.
+        CmdCtx.AsGraphicsContext1().SetViewInstanceMask(Subpass.ViewMask);
+    }
+
     if (m_pBoundShadingRateMap != nullptr)
     {
         TextureD3D12Impl* pTexD3D12 = ClassPtrCast<TextureD3D12Impl>(m_pBoundShadingRateMap->GetTexture());
@@ -1631,6 +1914,9 @@ void DeviceContextD3D12Impl::EndRenderPass()
 
 D3D12DynamicAllocation DeviceContextD3D12Impl::AllocateDynamicSpace(Uint64 NumBytes, Uint32 Alignment)
 {
+    DEV_CHECK_ERR((m_CommandListFlags & COMMAND_LIST_FLAG_REUSABLE) == 0,
+                  "Dynamic memory must not be used in reusable command lists as it is only valid in the current frame.");
+    m_Stats.DynamicUploadBytes += NumBytes;
     return m_DynamicHeap.Allocate(NumBytes, Alignment, GetFrameNumber());
 }
 
@@ -1664,6 +1950,7 @@ void DeviceContextD3D12Impl::UpdateBuffer(IBuffer*                       pBuffer
     VERIFY(pBuffD3D12->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers must be updated via Map()");
     constexpr size_t       DefaultAlignment = 16;
     D3D12DynamicAllocation TmpSpace         = m_DynamicHeap.Allocate(Size, DefaultAlignment, GetFrameNumber());
+    m_Stats.DynamicUploadBytes += Size;
     memcpy(TmpSpace.CPUAddress, pData, StaticCast<size_t>(Size));
     UpdateBufferRegion(pBuffD3D12, TmpSpace, Offset, Size, StateTransitionMode);
 }
@@ -2396,14 +2683,45 @@ void DeviceContextD3D12Impl::UnmapTextureSubresource(ITexture* pTexture, Uint32
 }
 
 
-void DeviceContextD3D12Impl::GenerateMips(ITextureView* pTexView)
+BufferD3D12Impl* DeviceContextD3D12Impl::GetMipsScratchBuffer(Uint32 NumArraySlices)
 {
-    TDeviceContextBase::GenerateMips(pTexView);
+    const Uint64 RequiredSize = GenerateMipsHelper::GetSinglePassScratchBufferSize(NumArraySlices);
+    if (m_pMipsScratchBuffer && m_pMipsScratchBuffer->GetDesc().Size >= RequiredSize)
+        return m_pMipsScratchBuffer;
+
+    BufferDesc ScratchDesc;
+    ScratchDesc.Name      = "Single-pass mip generation scratch buffer";
+    ScratchDesc.Size      = RequiredSize;
+    ScratchDesc.Usage     = USAGE_DEFAULT;
+    ScratchDesc.BindFlags = BIND_UNORDERED_ACCESS;
+    ScratchDesc.Mode      = BUFFER_MODE_RAW;
+
+    // The atomic counters must be zero-initialized. The shader resets them after use.
+    std::vector<Uint8> ZeroData(static_cast<size_t>(RequiredSize));
+    BufferData         InitData{ZeroData.data(), RequiredSize};
+
+    RefCntAutoPtr<IBuffer> pScratchBuffer;
+    m_pDevice->CreateBuffer(ScratchDesc, &InitData, &pScratchBuffer);
+    m_pMipsScratchBuffer = pScratchBuffer.RawPtr<BufferD3D12Impl>();
+    if (!m_pMipsScratchBuffer)
+        LOG_ERROR_MESSAGE("Failed to create the scratch buffer for single-pass mip generation. Falling back to the multi-pass generator.");
+
+    return m_pMipsScratchBuffer;
+}
+
+void DeviceContextD3D12Impl::GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags)
+{
+    TDeviceContextBase::GenerateMips(pTexView, Flags);
 
     CommandContext& Ctx = GetCmdContext();
 
+    TextureViewD3D12Impl* pTexViewD3D12      = ClassPtrCast<TextureViewD3D12Impl>(pTexView);
+    BufferD3D12Impl*      pSinglePassScratch = (Flags & GENERATE_MIPS_FLAG_SINGLE_PASS) != 0 ?
+        GetMipsScratchBuffer(pTexViewD3D12->GetDesc().NumArraySlices) :
+        nullptr;
+
     const GenerateMipsHelper& MipsGenerator = m_pDevice->GetMipsGenerator();
-    MipsGenerator.GenerateMips(m_pDevice->GetD3D12Device(), ClassPtrCast<TextureViewD3D12Impl>(pTexView), Ctx);
+    MipsGenerator.GenerateMips(m_pDevice->GetD3D12Device(), pTexViewD3D12, Ctx, pSinglePassScratch);
     ++m_State.NumCommands;
 
     // Invalidate compute resources as they were set by the mips generator
@@ -2418,7 +2736,9 @@ void DeviceContextD3D12Impl::GenerateMips(ITextureView* pTexView)
         {
             case PIPELINE_TYPE_GRAPHICS:
             {
-                Ctx.SetPipelineState(m_pPipelineState->GetD3D12PipelineState());
+                Ctx.SetPipelineState(m_pPipelineState->HasExtendedDynamicState() ?
+                                         m_pPipelineState->GetD3D12PipelineState(m_DynamicStates) :
+                                         m_pPipelineState->GetD3D12PipelineState());
                 // No need to restore graphics signature as it is not changed
             }
             break;
@@ -2453,7 +2773,7 @@ void DeviceContextD3D12Impl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
 
-    CommandListD3D12Impl* pCmdListD3D12(NEW_RC_OBJ(m_CmdListAllocator, "CommandListD3D12Impl instance", CommandListD3D12Impl)(m_pDevice, this, std::move(m_CurrCmdCtx)));
+    CommandListD3D12Impl* pCmdListD3D12(NEW_RC_OBJ(m_CmdListAllocator, "CommandListD3D12Impl instance", CommandListD3D12Impl)(m_pDevice, this, std::move(m_CurrCmdCtx), SoftwareQueueIndex{m_DstImmediateContextId}));
     pCmdListD3D12->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
     // We can't request new cmd context because we don't know the command queue type
@@ -2496,6 +2816,7 @@ void DeviceContextD3D12Impl::WaitForIdle()
 {
     DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can be idled");
     Flush();
+    SubmitBatchedCommandLists();
     m_pDevice->IdleCommandQueue(GetCommandQueueId(), true);
 }
 
@@ -2535,6 +2856,48 @@ void DeviceContextD3D12Impl::EndQuery(IQuery* pQuery)
     QueryMgr.EndQuery(Ctx, QueryType, Idx);
 }
 
+void DeviceContextD3D12Impl::BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    TDeviceContextBase::BeginPoolQuery(pQueryPool, Index, 0);
+
+    QueryPoolD3D12Impl* pQueryPoolD3D12 = ClassPtrCast<QueryPoolD3D12Impl>(pQueryPool);
+    ++m_ActiveQueriesCounter;
+    GetCmdContext().BeginQuery(pQueryPoolD3D12->GetD3D12QueryHeap(), pQueryPoolD3D12->GetD3D12QueryType(), Index);
+}
+
+void DeviceContextD3D12Impl::EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    TDeviceContextBase::EndPoolQuery(pQueryPool, Index, 0);
+
+    QueryPoolD3D12Impl* pQueryPoolD3D12 = ClassPtrCast<QueryPoolD3D12Impl>(pQueryPool);
+    if (pQueryPoolD3D12->GetDesc().Type != QUERY_TYPE_TIMESTAMP)
+    {
+        VERIFY(m_ActiveQueriesCounter > 0, "Active query counter is 0 which means there was a mismatch between BeginPoolQuery() / EndPoolQuery() calls");
+        --m_ActiveQueriesCounter;
+    }
+    GetCmdContext().EndQuery(pQueryPoolD3D12->GetD3D12QueryHeap(), pQueryPoolD3D12->GetD3D12QueryType(), Index);
+}
+
+void DeviceContextD3D12Impl::ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs)
+{
+    TDeviceContextBase::ResolvePoolQueries(Attribs, 0);
+
+    QueryPoolD3D12Impl* pQueryPoolD3D12 = ClassPtrCast<QueryPoolD3D12Impl>(Attribs.pQueryPool);
+    BufferD3D12Impl*    pDstBuffD3D12   = ClassPtrCast<BufferD3D12Impl>(Attribs.pDstBuffer);
+
+    CommandContext& CmdCtx = GetCmdContext();
+    // The destination buffer of a query resolve operation must be in the COPY_DEST state.
+    TransitionOrVerifyBufferState(CmdCtx, *pDstBuffD3D12, Attribs.DstBufferTransitionMode, RESOURCE_STATE_COPY_DEST, "Resolving pool queries (DeviceContextD3D12Impl::ResolvePoolQueries)");
+
+    Uint64          DstDataStartByteOffset = 0;
+    ID3D12Resource* pd3d12DstBuff          = pDstBuffD3D12->GetD3D12Buffer(DstDataStartByteOffset, this);
+    CmdCtx.FlushResourceBarriers();
+    // https://microsoft.github.io/DirectX-Specs/d3d/CountersAndQueries.html#resolvequerydata
+    CmdCtx.ResolveQueryData(pQueryPoolD3D12->GetD3D12QueryHeap(), pQueryPoolD3D12->GetD3D12QueryType(),
+                            Attribs.FirstQuery, Attribs.QueryCount, pd3d12DstBuff, Attribs.DstOffset + DstDataStartByteOffset);
+    ++m_State.NumCommands;
+}
+
 static void AliasingBarrier(CommandContext& CmdCtx, IDeviceObject* pResourceBefore, IDeviceObject* pResourceAfter)
 {
     bool UseNVApi         = false;
@@ -2580,6 +2943,8 @@ void DeviceContextD3D12Impl::TransitionResourceStates(Uint32 BarrierCount, const
 {
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
 
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Barrier};
+
     CommandContext& CmdCtx = GetCmdContext();
     for (Uint32 i = 0; i < BarrierCount; ++i)
     {
@@ -2613,6 +2978,8 @@ void DeviceContextD3D12Impl::TransitionOrVerifyBufferState(CommandContext&
                                                            RESOURCE_STATE                 RequiredState,
                                                            const char*                    OperationName)
 {
+    Buffer.MarkReferencedByCommandList();
+
     if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
         if (Buffer.IsInKnownState())
@@ -2632,6 +2999,15 @@ void DeviceContextD3D12Impl::TransitionOrVerifyTextureState(CommandContext&
                                                             RESOURCE_STATE                 RequiredState,
                                                             const char*                    OperationName)
 {
+    Texture.MarkReferencedByCommandList();
+
+    if (Texture.IsInConstantState())
+    {
+        DEV_CHECK_ERR(RequiredState == RESOURCE_STATE_SHADER_RESOURCE, OperationName, ": texture '", Texture.GetDesc().Name,
+                      "' was created with MISC_TEXTURE_FLAG_CONSTANT_STATE flag and can only be used in RESOURCE_STATE_SHADER_RESOURCE state.");
+        return;
+    }
+
     if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
         if (Texture.IsInKnownState())
@@ -2757,9 +3133,10 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
     TransitionOrVerifyBLASState(CmdCtx, *pBLASD3D12, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
     TransitionOrVerifyBufferState(CmdCtx, *pScratchD3D12, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
 
+    FrameArena::Scope                                     Arena;
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC    d3d12BuildASDesc   = {};
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& d3d12BuildASInputs = d3d12BuildASDesc.Inputs;
-    std::vector<D3D12_RAYTRACING_GEOMETRY_DESC>           Geometries;
+    FrameArena::Vector<D3D12_RAYTRACING_GEOMETRY_DESC>    Geometries{Arena.MakeAllocator<D3D12_RAYTRACING_GEOMETRY_DESC>()};
 
     if (Attribs.pTriangleData != nullptr)
     {
@@ -2910,7 +3287,17 @@ void DeviceContextD3D12Impl::BuildTLAS(const BuildTLASAttribs& Attribs)
     TransitionOrVerifyTLASState(CmdCtx, *pTLASD3D12, Attribs.TLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
     TransitionOrVerifyBufferState(CmdCtx, *pScratchD3D12, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
 
-    if (Attribs.Update)
+    if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_DIRTY)
+    {
+        if (!pTLASD3D12->UpdateDirtyInstances(Attribs.pInstances, Attribs.DirtyInstanceCount))
+            return;
+    }
+    else if (Attribs.pInstances == nullptr)
+    {
+        VERIFY_EXPR(Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_GPU);
+        // Instances of the previous build are reused
+    }
+    else if (Attribs.Update)
     {
         if (!pTLASD3D12->UpdateInstances(Attribs.pInstances, Attribs.InstanceCount, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
             return;
@@ -2921,37 +3308,91 @@ void DeviceContextD3D12Impl::BuildTLAS(const BuildTLASAttribs& Attribs)
             return;
     }
 
-    // copy instance data into instance buffer
+    auto WriteInstance = [&](const TLASBuildInstanceData& Inst, D3D12_RAYTRACING_INSTANCE_DESC& d3d12Inst, Uint32& InstanceIndex) {
+        const TLASInstanceDesc InstDesc = pTLASD3D12->GetInstanceDesc(Inst.InstanceName);
+        if (InstDesc.InstanceIndex >= Attribs.InstanceCount)
+        {
+            UNEXPECTED("Failed to find instance by name");
+            return false;
+        }
+        InstanceIndex = InstDesc.InstanceIndex;
+
+        BottomLevelASD3D12Impl* pBLASD3D12 = ClassPtrCast<BottomLevelASD3D12Impl>(Inst.pBLAS);
+
+        static_assert(sizeof(d3d12Inst.Transform) == sizeof(Inst.Transform), "size mismatch");
+        std::memcpy(&d3d12Inst.Transform, Inst.Transform.data, sizeof(d3d12Inst.Transform));
+
+        d3d12Inst.InstanceID                          = Inst.CustomId;
+        d3d12Inst.InstanceContributionToHitGroupIndex = InstDesc.ContributionToHitGroupIndex;
+        d3d12Inst.InstanceMask                        = Inst.Mask;
+        d3d12Inst.Flags                               = InstanceFlagsToD3D12RTInstanceFlags(Inst.Flags);
+        d3d12Inst.AccelerationStructure               = pBLASD3D12->GetGPUAddress();
+
+        TransitionOrVerifyBLASState(CmdCtx, *pBLASD3D12, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+        return true;
+    };
+
+    static_assert(TLAS_INSTANCE_UPLOAD_MODE_COUNT == 3, "Please handle the new instance upload mode below");
+    if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_ALL)
     {
+        // copy instance data into instance buffer
         size_t                 Size     = Attribs.InstanceCount * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
         D3D12DynamicAllocation TmpSpace = m_DynamicHeap.Allocate(Size, 16, m_FrameNumber);
+        m_Stats.DynamicUploadBytes += Size;
 
+        D3D12_RAYTRACING_INSTANCE_DESC* pDstInstances = static_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(TmpSpace.CPUAddress);
         for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
         {
-            const TLASBuildInstanceData& Inst     = Attribs.pInstances[i];
-            const TLASInstanceDesc       InstDesc = pTLASD3D12->GetInstanceDesc(Inst.InstanceName);
-
-            if (InstDesc.InstanceIndex >= Attribs.InstanceCount)
-            {
-                UNEXPECTED("Failed to find instance by name");
+            D3D12_RAYTRACING_INSTANCE_DESC d3d12Inst{};
+            Uint32                         InstanceIndex = 0;
+            if (!WriteInstance(Attribs.pInstances[i], d3d12Inst, InstanceIndex))
                 return;
-            }
-
-            D3D12_RAYTRACING_INSTANCE_DESC& d3d12Inst  = static_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(TmpSpace.CPUAddress)[InstDesc.InstanceIndex];
-            BottomLevelASD3D12Impl*         pBLASD3D12 = ClassPtrCast<BottomLevelASD3D12Impl>(Inst.pBLAS);
+            pDstInstances[InstanceIndex] = d3d12Inst;
+        }
+        UpdateBufferRegion(pInstancesD3D12, TmpSpace, Attribs.InstanceBufferOffset, Size, Attribs.InstanceBufferTransitionMode);
+    }
+    else if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_DIRTY && Attribs.DirtyInstanceCount > 0)
+    {
+        // Only the changed instances are uploaded. They are sorted by instance index
+        // so that every contiguous range is copied with a single command.
+        const Uint32           NumDirty = Attribs.DirtyInstanceCount;
+        const size_t           Size     = NumDirty * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+        D3D12DynamicAllocation TmpSpace = m_DynamicHeap.Allocate(Size, 16, m_FrameNumber);
+        m_Stats.DynamicUploadBytes += Size;
 
-            static_assert(sizeof(d3d12Inst.Transform) == sizeof(Inst.Transform), "size mismatch");
-            std::memcpy(&d3d12Inst.Transform, Inst.Transform.data, sizeof(d3d12Inst.Transform));
+        std::vector<std::pair<Uint32, D3D12_RAYTRACING_INSTANCE_DESC>> DirtyInstances(NumDirty);
+        for (Uint32 i = 0; i < NumDirty; ++i)
+        {
+            if (!WriteInstance(Attribs.pInstances[i], DirtyInstances[i].second, DirtyInstances[i].first))
+                return;
+        }
+        std::sort(DirtyInstances.begin(), DirtyInstances.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
 
-            d3d12Inst.InstanceID                          = Inst.CustomId;
-            d3d12Inst.InstanceContributionToHitGroupIndex = InstDesc.ContributionToHitGroupIndex;
-            d3d12Inst.InstanceMask                        = Inst.Mask;
-            d3d12Inst.Flags                               = InstanceFlagsToD3D12RTInstanceFlags(Inst.Flags);
-            d3d12Inst.AccelerationStructure               = pBLASD3D12->GetGPUAddress();
+        D3D12_RAYTRACING_INSTANCE_DESC* pDstInstances = static_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(TmpSpace.CPUAddress);
+        Uint32                          RangeStart    = 0;
+        for (Uint32 i = 0; i < NumDirty; ++i)
+        {
+            pDstInstances[i] = DirtyInstances[i].second;
+            if (i + 1 < NumDirty && DirtyInstances[i + 1].first == DirtyInstances[i].first + 1)
+                continue;
 
+            D3D12DynamicAllocation RangeSpace = TmpSpace;
+            RangeSpace.Offset += RangeStart * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+            UpdateBufferRegion(pInstancesD3D12, RangeSpace,
+                               Attribs.InstanceBufferOffset + Uint64{DirtyInstances[RangeStart].first} * sizeof(D3D12_RAYTRACING_INSTANCE_DESC),
+                               (i + 1 - RangeStart) * sizeof(D3D12_RAYTRACING_INSTANCE_DESC),
+                               Attribs.InstanceBufferTransitionMode);
+            RangeStart = i + 1;
+        }
+    }
+    else if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_GPU && Attribs.pInstances != nullptr)
+    {
+        for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
+        {
+            BottomLevelASD3D12Impl* pBLASD3D12 = ClassPtrCast<BottomLevelASD3D12Impl>(Attribs.pInstances[i].pBLAS);
             TransitionOrVerifyBLASState(CmdCtx, *pBLASD3D12, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
         }
-        UpdateBufferRegion(pInstancesD3D12, TmpSpace, Attribs.InstanceBufferOffset, Size, Attribs.InstanceBufferTransitionMode);
     }
     TransitionOrVerifyBufferState(CmdCtx, *pInstancesD3D12, Attribs.InstanceBufferTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
 
@@ -2968,7 +3409,7 @@ void DeviceContextD3D12Impl::BuildTLAS(const BuildTLASAttribs& Attribs)
     d3d12BuildASDesc.ScratchAccelerationStructureData = pScratchD3D12->GetGPUAddress() + Attribs.ScratchBufferOffset;
     d3d12BuildASDesc.SourceAccelerationStructureData  = 0;
 
-    if (Attribs.Update)
+    if (IsTLASUpdate(Attribs))
     {
         d3d12BuildASInputs.Flags |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE;
         d3d12BuildASDesc.SourceAccelerationStructureData = d3d12BuildASDesc.DestAccelerationStructureData;
@@ -3230,6 +3671,8 @@ void DeviceContextD3D12Impl::BindSparseResourceMemory(const BindSparseResourceMe
     VERIFY_EXPR(Attribs.NumBufferBinds != 0 || Attribs.NumTextureBinds != 0);
 
     Flush();
+    // Tile mappings are updated directly through the queue, so all previous commands must be submitted first
+    SubmitBatchedCommandLists();
 
     std::unordered_map<TileMappingKey, D3D12TileMappingHelper, TileMappingKey::Hasher> TileMappingMap;
 
@@ -35,6 +35,7 @@
 
 #include "D3D12TypeConversions.hpp"
 #include "GraphicsAccessories.hpp"
+#include "StringTools.hpp"
 
 namespace Diligent
 {
@@ -42,13 +43,15 @@ namespace Diligent
 namespace
 {
 
-D3D12_HEAP_FLAGS GetD3D12HeapFlags(ID3D12Device*   pd3d12Device,
-                                   IDeviceObject** ppResources,
-                                   Uint32          NumResources,
-                                   bool&           AllowMSAA,
-                                   bool&           UseNVApi) noexcept(false)
+D3D12_HEAP_FLAGS GetD3D12HeapFlags(ID3D12Device*      pd3d12Device,
+                                   DEVICE_MEMORY_TYPE MemoryType,
+                                   IDeviceObject**    ppResources,
+                                   Uint32             NumResources,
+                                   bool&              AllowMSAA,
+                                   bool&              UseNVApi) noexcept(false)
 {
-    AllowMSAA = false;
+    // Placed resources may be of any kind, so the heap always uses the MSAA placement alignment
+    AllowMSAA = MemoryType == DEVICE_MEMORY_TYPE_PLACED;
     UseNVApi  = false;
 
     // NB: D3D12_RESOURCE_HEAP_TIER_1 hardware requires exactly one of the
@@ -82,6 +85,9 @@ D3D12_HEAP_FLAGS GetD3D12HeapFlags(ID3D12Device*   pd3d12Device,
     if (NumResources == 0)
         return HeapFlags;
 
+    // Placed resources must not be sparse, and sparse memory only accepts sparse resources
+    const bool IsSparseMemory = MemoryType == DEVICE_MEMORY_TYPE_SPARSE;
+
     Uint32 UsingNVApiCount    = 0;
     Uint32 NotUsingNVApiCount = 0;
 
@@ -97,8 +103,8 @@ D3D12_HEAP_FLAGS GetD3D12HeapFlags(ID3D12Device*   pd3d12Device,
             const TextureD3D12Impl* pTexD3D12Impl = pTexture.ConstPtr<TextureD3D12Impl>();
             const TextureDesc&      TexDesc       = pTexD3D12Impl->GetDesc();
 
-            if (TexDesc.Usage != USAGE_SPARSE)
-                LOG_ERROR_AND_THROW("Resource must be created with USAGE_SPARSE");
+            if ((TexDesc.Usage == USAGE_SPARSE) != IsSparseMemory)
+                LOG_ERROR_AND_THROW(IsSparseMemory ? "Resource must be created with USAGE_SPARSE" : "Placed resources must not use USAGE_SPARSE");
 
             if (TexDesc.SampleCount > 1)
                 AllowMSAA = true;
@@ -121,8 +127,8 @@ D3D12_HEAP_FLAGS GetD3D12HeapFlags(ID3D12Device*   pd3d12Device,
         {
             const BufferDesc& BuffDesc = pBuffer.ConstPtr<BufferD3D12Impl>()->GetDesc();
 
-            if (BuffDesc.Usage != USAGE_SPARSE)
-                LOG_ERROR_AND_THROW("Resource must be created with USAGE_SPARSE");
+            if ((BuffDesc.Usage == USAGE_SPARSE) != IsSparseMemory)
+                LOG_ERROR_AND_THROW(IsSparseMemory ? "Resource must be created with USAGE_SPARSE" : "Placed resources must not use USAGE_SPARSE");
 
             HeapFlags &= ~D3D12_HEAP_FLAG_DENY_BUFFERS;
             if (BuffDesc.BindFlags & BIND_UNORDERED_ACCESS)
@@ -189,7 +195,7 @@ DeviceMemoryD3D12Impl::DeviceMemoryD3D12Impl(IReferenceCounters*           pRefC
                                              const DeviceMemoryCreateInfo& MemCI) :
     TDeviceMemoryBase{pRefCounters, pDeviceD3D11, MemCI}
 {
-    m_d3d12HeapFlags = GetD3D12HeapFlags(m_pDevice->GetD3D12Device(), MemCI.ppCompatibleResources, MemCI.NumResources, m_AllowMSAA, m_UseNVApi);
+    m_d3d12HeapFlags = GetD3D12HeapFlags(m_pDevice->GetD3D12Device(), m_Desc.Type, MemCI.ppCompatibleResources, MemCI.NumResources, m_AllowMSAA, m_UseNVApi);
 
     if (!Resize(MemCI.InitialSize))
         LOG_ERROR_AND_THROW("Failed to allocate device memory");
@@ -253,7 +259,7 @@ Bool DeviceMemoryD3D12Impl::IsCompatible(IDeviceObject* pResource) const
     {
         bool             AllowMSAA              = false;
         bool             UseNVApi               = false;
-        D3D12_HEAP_FLAGS d3d12RequiredHeapFlags = GetD3D12HeapFlags(m_pDevice->GetD3D12Device(), &pResource, 1, AllowMSAA, UseNVApi);
+        D3D12_HEAP_FLAGS d3d12RequiredHeapFlags = GetD3D12HeapFlags(m_pDevice->GetD3D12Device(), m_Desc.Type, &pResource, 1, AllowMSAA, UseNVApi);
         return ((m_d3d12HeapFlags & d3d12RequiredHeapFlags) == d3d12RequiredHeapFlags) && (!AllowMSAA || m_AllowMSAA) && (UseNVApi == m_UseNVApi);
     }
     catch (...)
@@ -287,4 +293,39 @@ DeviceMemoryRangeD3D12 DeviceMemoryD3D12Impl::GetRange(Uint64 Offset, Uint64 Siz
     return Range;
 }
 
+CComPtr<ID3D12Resource> DeviceMemoryD3D12Impl::CreatePlacedResource(const D3D12_RESOURCE_DESC& d3d12Desc,
+                                                                    Uint64                     Offset,
+                                                                    const D3D12_CLEAR_VALUE*   pClearValue,
+                                                                    const char*                ResourceName) const noexcept(false)
+{
+    if (m_Desc.Type != DEVICE_MEMORY_TYPE_PLACED)
+        LOG_ERROR_AND_THROW("Device memory '", m_Desc.Name, "' was not created with DEVICE_MEMORY_TYPE_PLACED type");
+
+    ID3D12Device* const pd3d12Device = m_pDevice->GetD3D12Device();
+
+    const D3D12_RESOURCE_ALLOCATION_INFO d3d12AllocInfo = pd3d12Device->GetResourceAllocationInfo(0, 1, &d3d12Desc);
+    if (d3d12AllocInfo.SizeInBytes == ~UINT64{0})
+        LOG_ERROR_AND_THROW("Failed to get allocation info for placed resource '", ResourceName, "'");
+
+    if ((Offset % d3d12AllocInfo.Alignment) != 0)
+        LOG_ERROR_AND_THROW("Offset (", Offset, ") of placed resource '", ResourceName, "' is not a multiple of the required alignment (", d3d12AllocInfo.Alignment, ")");
+
+    const DeviceMemoryRangeD3D12 Range = GetRange(Offset, d3d12AllocInfo.SizeInBytes);
+    if (Range.pHandle == nullptr || Range.Size < d3d12AllocInfo.SizeInBytes)
+        LOG_ERROR_AND_THROW("Placed resource '", ResourceName, "' (", d3d12AllocInfo.SizeInBytes, " bytes at offset ", Offset,
+                            ") does not fit into device memory '", m_Desc.Name, "' (", GetCapacity(), " bytes)");
+
+    // Placed resources are always created in COMMON state. Render targets and depth-stencil buffers
+    // must be cleared, discarded or copied to before they can be used after an aliasing barrier.
+    CComPtr<ID3D12Resource> pd3d12Resource;
+    if (FAILED(pd3d12Device->CreatePlacedResource(Range.pHandle, Range.Offset, &d3d12Desc, D3D12_RESOURCE_STATE_COMMON, pClearValue,
+                                                  __uuidof(pd3d12Resource), reinterpret_cast<void**>(static_cast<ID3D12Resource**>(&pd3d12Resource)))))
+        LOG_ERROR_AND_THROW("Failed to create placed resource '", ResourceName, "'");
+
+    if (ResourceName != nullptr && *ResourceName != 0)
+        pd3d12Resource->SetName(WidenString(ResourceName).c_str());
+
+    return pd3d12Resource;
+}
+
 } // namespace Diligent
@@ -164,6 +164,14 @@ public:
     }
 
 private:
+    void AttachToD3D12DeviceImpl(void*                        pd3d12NativeDevice,
+                                 Uint32                       CommandQueueCount,
+                                 ICommandQueueD3D12**         ppCommandQueues,
+                                 const EngineD3D12CreateInfo& EngineCI,
+                                 IRenderDevice**              ppDevice,
+                                 IDeviceContext**             ppContexts,
+                                 RenderDeviceStartupTimes     StartupTimes);
+
 #if USE_D3D12_LOADER
     HMODULE     m_hD3D12Dll = NULL;
     std::string m_DllName;
@@ -306,6 +314,8 @@ void EngineFactoryD3D12Impl::CreateDeviceAndContextsD3D12(const EngineD3D12Creat
     std::vector<RefCntAutoPtr<CommandQueueD3D12Impl>> CmdQueueD3D12Refs;
     CComPtr<ID3D12Device>                             d3d12Device;
     std::vector<ICommandQueueD3D12*>                  CmdQueues;
+    StartupStageTimer                                 StageTimer;
+    RenderDeviceStartupTimes                          StartupTimes;
     try
     {
         ValidateD3D12CreateInfo(EngineCI);
@@ -334,6 +344,7 @@ void EngineFactoryD3D12Impl::CreateDeviceAndContextsD3D12(const EngineD3D12Creat
 
         HRESULT hr = CreateDXGIFactory1(__uuidof(factory), reinterpret_cast<void**>(static_cast<IDXGIFactory4**>(&factory)));
         CHECK_D3D_RESULT_THROW(hr, "Failed to create DXGI factory");
+        StartupTimes.Instance = StageTimer.Lap();
 
         LUID AdapterLUID{};
         // Direct3D12 does not allow feature levels below 11.0 (D3D12CreateDevice fails to create a device).
@@ -375,6 +386,7 @@ void EngineFactoryD3D12Impl::CreateDeviceAndContextsD3D12(const EngineD3D12Creat
             hardwareAdapter->GetDesc1(&desc);
             LOG_INFO_MESSAGE("D3D12-capable adapter found: ", NarrowString(desc.Description), " (", desc.DedicatedVideoMemory >> 20, " MB)");
         }
+        StartupTimes.AdapterSelection = StageTimer.Lap();
 
         const Version FeatureLevelList[] = {{12, 1}, {12, 0}, {11, 1}, {11, 0}};
         for (Version FeatureLevel : FeatureLevelList)
@@ -515,7 +527,10 @@ void EngineFactoryD3D12Impl::CreateDeviceAndContextsD3D12(const EngineD3D12Creat
         return;
     }
 
-    AttachToD3D12Device(d3d12Device, static_cast<Uint32>(CmdQueues.size()), CmdQueues.data(), EngineCI, ppDevice, ppContexts);
+    StartupTimes.NativeDevice = StageTimer.Lap();
+    StartupTimes.Total        = StartupTimes.Instance + StartupTimes.AdapterSelection + StartupTimes.NativeDevice;
+
+    AttachToD3D12DeviceImpl(d3d12Device, static_cast<Uint32>(CmdQueues.size()), CmdQueues.data(), EngineCI, ppDevice, ppContexts, StartupTimes);
 }
 
 
@@ -553,6 +568,17 @@ void EngineFactoryD3D12Impl::AttachToD3D12Device(void*                        pd
                                                  const EngineD3D12CreateInfo& EngineCI,
                                                  IRenderDevice**              ppDevice,
                                                  IDeviceContext**             ppContexts)
+{
+    AttachToD3D12DeviceImpl(pd3d12NativeDevice, CommandQueueCount, ppCommandQueues, EngineCI, ppDevice, ppContexts, RenderDeviceStartupTimes{});
+}
+
+void EngineFactoryD3D12Impl::AttachToD3D12DeviceImpl(void*                        pd3d12NativeDevice,
+                                                     const Uint32                 CommandQueueCount,
+                                                     ICommandQueueD3D12**         ppCommandQueues,
+                                                     const EngineD3D12CreateInfo& EngineCI,
+                                                     IRenderDevice**              ppDevice,
+                                                     IDeviceContext**             ppContexts,
+                                                     RenderDeviceStartupTimes     StartupTimes)
 {
     if (EngineCI.EngineAPIVersion != DILIGENT_API_VERSION)
     {
@@ -600,6 +626,8 @@ void EngineFactoryD3D12Impl::AttachToD3D12Device(void*                        pd
 
     try
     {
+        StartupStageTimer StageTimer;
+
         IMemoryAllocator&      RawMemAllocator = GetRawAllocator();
         ID3D12Device*          d3d12Device     = reinterpret_cast<ID3D12Device*>(pd3d12NativeDevice);
         CComPtr<IDXGIAdapter1> pDXGIAdapter1   = DXGIAdapterFromD3D12Device(d3d12Device);
@@ -612,6 +640,7 @@ void EngineFactoryD3D12Impl::AttachToD3D12Device(void*                        pd
         RenderDeviceD3D12Impl* pRenderDeviceD3D12{
             NEW_RC_OBJ(RawMemAllocator, "RenderDeviceD3D12Impl instance", RenderDeviceD3D12Impl)(RawMemAllocator, this, EngineCI, AdapterInfo, d3d12Device, CommandQueueCount, ppCommandQueues)};
         pRenderDeviceD3D12->QueryInterface(IID_RenderDevice, reinterpret_cast<IObject**>(ppDevice));
+        StartupTimes.RenderDevice = StageTimer.Lap();
 
         for (Uint32 CtxInd = 0; CtxInd < NumImmediateContexts; ++CtxInd)
         {
@@ -638,6 +667,14 @@ void EngineFactoryD3D12Impl::AttachToD3D12Device(void*                        pd
         {
             pRenderDeviceD3D12->CreateDeferredContext(ppContexts + NumImmediateContexts + DeferredCtx);
         }
+
+        StartupTimes.Contexts = StageTimer.Lap();
+        StartupTimes.Total += StartupTimes.RenderDevice + StartupTimes.Contexts;
+        pRenderDeviceD3D12->SetStartupTimes(StartupTimes);
+
+        LOG_INFO_MESSAGE("Direct3D12 render device initialized in ", StartupTimes.Total / 1000000, " ms (DXGI factory: ", StartupTimes.Instance / 1000000,
+                         " ms, adapter: ", StartupTimes.AdapterSelection / 1000000, " ms, d3d12 device: ", StartupTimes.NativeDevice / 1000000,
+                         " ms, render device: ", StartupTimes.RenderDevice / 1000000, " ms, contexts: ", StartupTimes.Contexts / 1000000, " ms)");
     }
     catch (const std::runtime_error&)
     {
@@ -783,6 +820,10 @@ GraphicsAdapterInfo EngineFactoryD3D12Impl::GetGraphicsAdapterInfo(void*
         Features.VertexPipelineUAVWritesAndAtomics = DEVICE_FEATURE_STATE_ENABLED;
         Features.NativeFence                       = DEVICE_FEATURE_STATE_OPTIONAL; // can be disabled
         Features.TextureComponentSwizzle           = DEVICE_FEATURE_STATE_ENABLED;
+        // Primitive topology is set by the command list, other dynamic states use internal pipeline variants
+        Features.ExtendedDynamicState = DEVICE_FEATURE_STATE_ENABLED;
+        // Committed resources and fences can always be shared through NT handles
+        Features.ExternalMemory = DEVICE_FEATURE_STATE_OPTIONAL;
 
         // Check if mesh shader is supported.
         bool MeshShadersSupported = false;
@@ -818,6 +859,12 @@ GraphicsAdapterInfo EngineFactoryD3D12Impl::GetGraphicsAdapterInfo(void*
             D3D12_FEATURE_DATA_D3D12_OPTIONS d3d12Features = {};
             if (SUCCEEDED(d3d12Device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &d3d12Features, sizeof(d3d12Features))))
             {
+                // Placed resources of all types must be able to share a heap
+                if (d3d12Features.ResourceHeapTier >= D3D12_RESOURCE_HEAP_TIER_2)
+                {
+                    AdapterInfo.Memory.PlacedResources = True;
+                }
+
                 if (d3d12Features.MinPrecisionSupport & D3D12_SHADER_MIN_PRECISION_SUPPORT_16_BIT)
                 {
                     Features.ShaderFloat16 = DEVICE_FEATURE_STATE_ENABLED;
@@ -931,6 +978,11 @@ GraphicsAdapterInfo EngineFactoryD3D12Impl::GetGraphicsAdapterInfo(void*
             {
                 if (d3d12Features3.CopyQueueTimestampQueriesSupported)
                     Features.TransferQueueTimestampQueries = DEVICE_FEATURE_STATE_ENABLED;
+
+                // Tier 1 is emulated by the runtime by replaying draws for every view, which is
+                // still useful to run the same multiview code path on all devices.
+                if (d3d12Features3.ViewInstancingTier != D3D12_VIEW_INSTANCING_TIER_NOT_SUPPORTED)
+                    Features.Multiview = DEVICE_FEATURE_STATE_ENABLED;
             }
 
             D3D12_FEATURE_DATA_D3D12_OPTIONS4 d3d12Features4{};
@@ -1039,6 +1091,16 @@ GraphicsAdapterInfo EngineFactoryD3D12Impl::GetGraphicsAdapterInfo(void*
                 ASSERT_SIZEOF(ShadingRateProps, 52, "Did you add a new member to ShadingRateProperties? Please initialize it here.");
             }
 #endif // NTDDI_WIN10_19H1
+
+#ifdef D3D12_H_HAS_GPU_UPLOAD_HEAP
+            D3D12_FEATURE_DATA_D3D12_OPTIONS16 d3d12Features16{};
+            if (SUCCEEDED(d3d12Device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS16, &d3d12Features16, sizeof(d3d12Features16))))
+            {
+                // GPU upload heaps require resizable BAR to be enabled
+                if (d3d12Features16.GPUUploadHeapSupported != FALSE)
+                    Features.GPUUploadMemory = DEVICE_FEATURE_STATE_OPTIONAL;
+            }
+#endif
         }
 
         // Buffer properties
@@ -1102,11 +1164,12 @@ GraphicsAdapterInfo EngineFactoryD3D12Impl::GetGraphicsAdapterInfo(void*
         DrawCommandProps.CapFlags |=
             DRAW_COMMAND_CAP_FLAG_BASE_VERTEX |
             DRAW_COMMAND_CAP_FLAG_NATIVE_MULTI_DRAW_INDIRECT |
-            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER;
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER |
+            DRAW_COMMAND_CAP_FLAG_INDIRECT_COMMAND_SIGNATURE;
         ASSERT_SIZEOF(DrawCommandProps, 12, "Did you add a new member to DrawCommandProperties? Please initialize it here.");
     }
 
-    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+    ASSERT_SIZEOF(DeviceFeatures, 52, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
 
     return AdapterInfo;
 }
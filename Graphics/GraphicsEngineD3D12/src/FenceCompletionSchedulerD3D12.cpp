@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "FenceCompletionSchedulerD3D12.hpp"
+#include "FenceD3D12Impl.hpp"
+
+namespace Diligent
+{
+
+FenceCompletionSchedulerD3D12::FenceCompletionSchedulerD3D12(ID3D12Device1* pd3d12Device1) :
+    FenceCompletionScheduler{/*UseWorkerThread = */ true},
+    m_pd3d12Device1{pd3d12Device1},
+    m_FenceEvent{CreateEvent(nullptr, FALSE, FALSE, nullptr)},
+    m_WakeUpEvent{CreateEvent(nullptr, FALSE, FALSE, nullptr)}
+{
+    if (m_FenceEvent == NULL || m_WakeUpEvent == NULL)
+        LOG_ERROR_AND_THROW("Failed to create fence completion events");
+}
+
+FenceCompletionSchedulerD3D12::~FenceCompletionSchedulerD3D12()
+{
+    // The worker thread uses the events
+    StopWorkerThread();
+
+    // Fences may still signal the event for the registrations made by earlier waits,
+    // but every registration includes a fence whose callback has been executed, so
+    // all of them have completed by now.
+    if (m_FenceEvent != NULL)
+        CloseHandle(m_FenceEvent);
+    if (m_WakeUpEvent != NULL)
+        CloseHandle(m_WakeUpEvent);
+}
+
+void FenceCompletionSchedulerD3D12::WaitForAny(const std::vector<FenceWaitInfo>& Fences)
+{
+    m_d3d12Fences.clear();
+    m_Values.clear();
+    for (const FenceWaitInfo& Fence : Fences)
+    {
+        m_d3d12Fences.push_back(ClassPtrCast<FenceD3D12Impl>(Fence.pFence)->GetD3D12Fence());
+        m_Values.push_back(Fence.Value);
+    }
+
+    // The event may also be signaled by the registrations of the previous waits that were
+    // interrupted by WakeUp(). This only results in a spurious return.
+    HRESULT hr = m_pd3d12Device1->SetEventOnMultipleFenceCompletion(m_d3d12Fences.data(), m_Values.data(), static_cast<UINT>(m_d3d12Fences.size()),
+                                                                    D3D12_MULTIPLE_FENCE_WAIT_FLAG_ANY, m_FenceEvent);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to set event on multiple fence completion");
+        // Do not spin if the device was removed
+        Sleep(1);
+        return;
+    }
+
+    const HANDLE Events[] = {m_FenceEvent, m_WakeUpEvent};
+    WaitForMultipleObjects(_countof(Events), Events, FALSE, INFINITE);
+}
+
+void FenceCompletionSchedulerD3D12::WakeUp()
+{
+    SetEvent(m_WakeUpEvent);
+}
+
+} // namespace Diligent
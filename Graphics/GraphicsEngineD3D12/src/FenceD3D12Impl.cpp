@@ -55,7 +55,8 @@ FenceD3D12Impl::FenceD3D12Impl(IReferenceCounters*    pRefCounters,
 {
     VERIFY(m_FenceCompleteEvent != NULL, "Failed to create fence complete event");
 
-    const D3D12_FENCE_FLAGS Flags        = (m_Desc.Type == FENCE_TYPE_GENERAL && pDevice->GetNumImmediateContexts() > 1) ? D3D12_FENCE_FLAG_SHARED : D3D12_FENCE_FLAG_NONE;
+    const bool              IsShared     = (m_Desc.Type == FENCE_TYPE_GENERAL && pDevice->GetNumImmediateContexts() > 1) || (m_Desc.MiscFlags & MISC_FENCE_FLAG_EXPORTABLE) != 0;
+    const D3D12_FENCE_FLAGS Flags        = IsShared ? D3D12_FENCE_FLAG_SHARED : D3D12_FENCE_FLAG_NONE;
     ID3D12Device* const     pd3d12Device = pDevice->GetD3D12Device();
     HRESULT                 hr           = pd3d12Device->CreateFence(0, Flags, __uuidof(m_pd3d12Fence), reinterpret_cast<void**>(static_cast<ID3D12Fence**>(&m_pd3d12Fence)));
     CHECK_D3D_RESULT_THROW(hr, "Failed to create D3D12 fence");
@@ -63,6 +64,24 @@ FenceD3D12Impl::FenceD3D12Impl(IReferenceCounters*    pRefCounters,
         m_pd3d12Fence->SetName(WidenString(m_Desc.Name).c_str());
 }
 
+HANDLE FenceD3D12Impl::CreateSharedHandle()
+{
+    if ((m_Desc.MiscFlags & MISC_FENCE_FLAG_EXPORTABLE) == 0)
+    {
+        DEV_ERROR("Fence '", m_Desc.Name, "' was not created with MISC_FENCE_FLAG_EXPORTABLE flag");
+        return NULL;
+    }
+
+    HANDLE  Handle = NULL;
+    HRESULT hr     = GetDevice()->GetD3D12Device()->CreateSharedHandle(m_pd3d12Fence, nullptr, GENERIC_ALL, nullptr, &Handle);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create shared handle for fence '", m_Desc.Name, "'");
+        return NULL;
+    }
+    return Handle;
+}
+
 FenceD3D12Impl::~FenceD3D12Impl()
 {
     // D3D12 object can only be destroyed when it is no longer used by the GPU
@@ -52,6 +52,8 @@
 #include "CommandContext.hpp"
 #include "TextureViewD3D12Impl.hpp"
 #include "TextureD3D12Impl.hpp"
+#include "BufferD3D12Impl.hpp"
+#include "BufferViewD3D12Impl.hpp"
 
 #include "GenerateMips/GenerateMipsLinearCS.h"
 #include "GenerateMips/GenerateMipsLinearOddCS.h"
@@ -61,9 +63,18 @@
 #include "GenerateMips/GenerateMipsGammaOddCS.h"
 #include "GenerateMips/GenerateMipsGammaOddXCS.h"
 #include "GenerateMips/GenerateMipsGammaOddYCS.h"
+#include "GenerateMips/GenerateMipsSinglePassLinearCS.h"
+#include "GenerateMips/GenerateMipsSinglePassGammaCS.h"
 
 namespace Diligent
 {
+
+// The constants must match the definitions in GenerateMipsSinglePassCS.hlsli
+static constexpr Uint32 SinglePassMaxMips          = 12; // Max number of mip levels processed by one dispatch
+static constexpr Uint32 SinglePassMaxMipsPerTile   = 6;  // Max number of mip levels processed by one thread group
+static constexpr Uint32 SinglePassTileSize         = 64; // Size of the source tile processed by one thread group
+static constexpr Uint64 SinglePassScratchSliceSize = 16 + SinglePassTileSize * SinglePassTileSize * 16;
+
 GenerateMipsHelper::GenerateMipsHelper(ID3D12Device* pd3d12Device)
 {
     CD3DX12_ROOT_PARAMETER Params[3];
@@ -113,12 +124,46 @@ GenerateMipsHelper::GenerateMipsHelper(ID3D12Device* pd3d12Device)
     CreatePSO(m_pGenerateMipsGammaPSO[1], g_pGenerateMipsGammaOddXCS);
     CreatePSO(m_pGenerateMipsGammaPSO[2], g_pGenerateMipsGammaOddYCS);
     CreatePSO(m_pGenerateMipsGammaPSO[3], g_pGenerateMipsGammaOddCS);
+
+    // The single-pass downsampler uses the table of 12 output mip UAVs followed by the scratch buffer UAV
+    CD3DX12_ROOT_PARAMETER SinglePassParams[3];
+    SinglePassParams[0].InitAsConstants(4, 0);
+    SinglePassParams[1].InitAsDescriptorTable(1, &SRVRange);
+    CD3DX12_DESCRIPTOR_RANGE SinglePassUAVRange(D3D12_DESCRIPTOR_RANGE_TYPE_UAV, SinglePassMaxMips + 1, 0);
+    SinglePassParams[2].InitAsDescriptorTable(1, &SinglePassUAVRange);
+    CD3DX12_ROOT_SIGNATURE_DESC SinglePassRootSigDesc;
+    SinglePassRootSigDesc.NumParameters     = _countof(SinglePassParams);
+    SinglePassRootSigDesc.pParameters       = SinglePassParams;
+    SinglePassRootSigDesc.NumStaticSamplers = 0;
+    SinglePassRootSigDesc.pStaticSamplers   = nullptr;
+    SinglePassRootSigDesc.Flags             = D3D12_ROOT_SIGNATURE_FLAG_NONE;
+
+    CComPtr<ID3DBlob> SinglePassSignature;
+    CComPtr<ID3DBlob> SinglePassError;
+
+    hr = D3D12SerializeRootSignature(&SinglePassRootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1, &SinglePassSignature, &SinglePassError);
+    CHECK_D3D_RESULT_THROW(hr, "Failed to serialize root signature for single-pass mipmap generation");
+
+    hr = pd3d12Device->CreateRootSignature(0, SinglePassSignature->GetBufferPointer(), SinglePassSignature->GetBufferSize(), __uuidof(m_pSinglePassRS), reinterpret_cast<void**>(static_cast<ID3D12RootSignature**>(&m_pSinglePassRS)));
+    CHECK_D3D_RESULT_THROW(hr, "Failed to create root signature for single-pass mipmap generation");
+
+    PSODesc.pRootSignature = m_pSinglePassRS;
+    CreatePSO(m_pSinglePassLinearPSO, g_pGenerateMipsSinglePassLinearCS);
+    CreatePSO(m_pSinglePassGammaPSO, g_pGenerateMipsSinglePassGammaCS);
+}
+
+Uint64 GenerateMipsHelper::GetSinglePassScratchBufferSize(Uint32 NumArraySlices)
+{
+    return SinglePassScratchSliceSize * NumArraySlices;
 }
 
-void GenerateMipsHelper::GenerateMips(ID3D12Device* pd3d12Device, TextureViewD3D12Impl* pTexView, CommandContext& Ctx) const
+void GenerateMipsHelper::GenerateMips(ID3D12Device*         pd3d12Device,
+                                      TextureViewD3D12Impl* pTexView,
+                                      CommandContext&       Ctx,
+                                      BufferD3D12Impl*      pSinglePassScratch) const
 {
     ComputeContext& ComputeCtx = Ctx.AsComputeContext();
-    ComputeCtx.SetComputeRootSignature(m_pGenerateMipsRS);
+    ComputeCtx.SetComputeRootSignature(pSinglePassScratch != nullptr ? m_pSinglePassRS : m_pGenerateMipsRS);
     TextureD3D12Impl*      pTexD3D12 = pTexView->GetTexture<TextureD3D12Impl>();
     const TextureDesc&     TexDesc   = pTexD3D12->GetDesc();
     const TextureViewDesc& ViewDesc  = pTexView->GetDesc();
@@ -132,6 +177,9 @@ void GenerateMipsHelper::GenerateMips(ID3D12Device* pd3d12Device, TextureViewD3D
 
     D3D12_CPU_DESCRIPTOR_HANDLE SRVDescriptorHandle = pTexView->GetTexArraySRV();
 
+    VERIFY(pSinglePassScratch == nullptr || pSinglePassScratch->GetDesc().Size >= GetSinglePassScratchBufferSize(ViewDesc.NumArraySlices),
+           "The scratch buffer is too small to process ", ViewDesc.NumArraySlices, " array slices");
+
     if (!pTexD3D12->IsInKnownState())
     {
         LOG_ERROR_MESSAGE("Unable to generate mips for texture '", TexDesc.Name, "' because the texture state is unknown");
@@ -160,72 +208,130 @@ void GenerateMipsHelper::GenerateMips(ID3D12Device* pd3d12Device, TextureViewD3D
         uint32_t DstWidth  = std::max(SrcWidth >> 1, 1u);
         uint32_t DstHeight = std::max(SrcHeight >> 1, 1u);
 
-        // Determine if the first downsample is more than 2:1.  This happens whenever
-        // the source width or height is odd.
-        uint32_t NonPowerOfTwo = (SrcWidth & 1) | (SrcHeight & 1) << 1;
-        if (TexDesc.Format == TEX_FORMAT_RGBA8_UNORM_SRGB)
-            ComputeCtx.SetPipelineState(m_pGenerateMipsGammaPSO[NonPowerOfTwo]);
+        const bool IsGamma    = TexDesc.Format == TEX_FORMAT_RGBA8_UNORM_SRGB;
+        uint32_t   NumMips    = 0;
+        uint32_t   NumGroupsX = 0;
+        uint32_t   NumGroupsY = 0;
+        if (pSinglePassScratch != nullptr)
+        {
+            ComputeCtx.SetPipelineState(IsGamma ? m_pSinglePassGammaPSO : m_pSinglePassLinearPSO);
+
+            // Every thread group reduces a 64x64 tile of the source mip to up to 6 levels.
+            // The last group then reduces the 64x64 block of the intermediate values to up to 6 more levels,
+            // so larger sources are first reduced by a dispatch that only writes 6 levels.
+            NumGroupsX = (SrcWidth + SinglePassTileSize - 1) / SinglePassTileSize;
+            NumGroupsY = (SrcHeight + SinglePassTileSize - 1) / SinglePassTileSize;
+            NumMips    = (NumGroupsX <= SinglePassTileSize && NumGroupsY <= SinglePassTileSize) ? SinglePassMaxMips : SinglePassMaxMipsPerTile;
+            if (TopMip + NumMips > BottomMip)
+                NumMips = BottomMip - TopMip;
+
+            D3D12_DESCRIPTOR_HEAP_TYPE HeapType        = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+            DescriptorHeapAllocation   DescriptorAlloc = Ctx.AllocateDynamicGPUVisibleDescriptor(HeapType, 2 + SinglePassMaxMips);
+
+            CommandContext::ShaderDescriptorHeaps Heaps{DescriptorAlloc.GetDescriptorHeap(), nullptr};
+            ComputeCtx.SetDescriptorHeaps(Heaps);
+            Ctx.GetCommandList()->SetComputeRootDescriptorTable(1, DescriptorAlloc.GetGpuHandle(0));
+            Ctx.GetCommandList()->SetComputeRootDescriptorTable(2, DescriptorAlloc.GetGpuHandle(1));
+            struct RootCBData
+            {
+                Uint32 SrcMipLevel;  // Texture level of source mip
+                Uint32 NumMipLevels; // Number of OutMips to write: [1, 12]
+                Uint32 NumTiles;     // Number of 64x64 tiles in one array slice
+                Uint32 Dummy;
+            };
+            RootCBData CBData{
+                TopMip, // Mip levels are relateive to the view's most detailed mip
+                NumMips,
+                NumGroupsX * NumGroupsY,
+                0};
+
+            Ctx.GetCommandList()->SetComputeRoot32BitConstants(0, 4, &CBData, 0);
+
+            D3D12_CPU_DESCRIPTOR_HANDLE DstDescriptorRange                         = DescriptorAlloc.GetCpuHandle();
+            UINT                        DstRangeSize                               = 2 + SinglePassMaxMips;
+            D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptorRanges[2 + SinglePassMaxMips] = {};
+            UINT                        SrcRangeSizes[2 + SinglePassMaxMips]       = {};
+
+            SrcDescriptorRanges[0] = SRVDescriptorHandle;
+            // All descriptors in the table must be initialized on Resource Binding Tier 2 hardware,
+            // so copy the bottom mip level UAV descriptor handle to all unused slots
+            for (Uint32 u = 0; u < SinglePassMaxMips; ++u)
+                SrcDescriptorRanges[1 + u] = pTexView->GetMipLevelUAV(TopMip + std::min(u + 1, NumMips));
+            SrcDescriptorRanges[1 + SinglePassMaxMips] = ClassPtrCast<BufferViewD3D12Impl>(pSinglePassScratch->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS))->GetCPUDescriptorHandle();
+            for (Uint32 r = 0; r < _countof(SrcRangeSizes); ++r)
+                SrcRangeSizes[r] = 1;
+
+            pd3d12Device->CopyDescriptors(1, &DstDescriptorRange, &DstRangeSize, _countof(SrcDescriptorRanges), SrcDescriptorRanges, SrcRangeSizes, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        }
         else
-            ComputeCtx.SetPipelineState(m_pGenerateMipsLinearPSO[NonPowerOfTwo]);
-
-        // We can downsample up to four times, but if the ratio between levels is not
-        // exactly 2:1, we have to shift our blend weights, which gets complicated or
-        // expensive.  Maybe we can update the code later to compute sample weights for
-        // each successive downsample.  We use _BitScanForward to count number of zeros
-        // in the low bits.  Zeros indicate we can divide by two without truncating.
-        uint32_t AdditionalMips;
-        _BitScanForward((unsigned long*)&AdditionalMips, DstWidth | DstHeight);
-        uint32_t NumMips = 1 + (AdditionalMips > 3 ? 3 : AdditionalMips);
-        if (TopMip + NumMips > BottomMip)
-            NumMips = BottomMip - TopMip;
-
-        // These are clamped to 1 after computing additional mips because clamped
-        // dimensions should not limit us from downsampling multiple times.  (E.g.
-        // 16x1 -> 8x1 -> 4x1 -> 2x1 -> 1x1.)
-        if (DstWidth == 0)
-            DstWidth = 1;
-        if (DstHeight == 0)
-            DstHeight = 1;
-
-        D3D12_DESCRIPTOR_HEAP_TYPE HeapType        = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-        DescriptorHeapAllocation   DescriptorAlloc = Ctx.AllocateDynamicGPUVisibleDescriptor(HeapType, 5);
-
-        CommandContext::ShaderDescriptorHeaps Heaps{DescriptorAlloc.GetDescriptorHeap(), nullptr};
-        ComputeCtx.SetDescriptorHeaps(Heaps);
-        Ctx.GetCommandList()->SetComputeRootDescriptorTable(1, DescriptorAlloc.GetGpuHandle(0));
-        Ctx.GetCommandList()->SetComputeRootDescriptorTable(2, DescriptorAlloc.GetGpuHandle(1));
-        struct RootCBData
         {
-            Uint32 SrcMipLevel;  // Texture level of source mip
-            Uint32 NumMipLevels; // Number of OutMips to write: [1, 4]
-            Uint32 FirstArraySlice;
-            Uint32 Dummy;
-            float  TexelSize[2]; // 1.0 / OutMip1.Dimensions
-        };
-        RootCBData CBData{
-            TopMip, // Mip levels are relateive to the view's most detailed mip
-            NumMips,
-            0, // Array slices are relative to the view's first array slice
-            0,
-            {1.0f / static_cast<float>(DstWidth), 1.0f / static_cast<float>(DstHeight)}};
-
-        Ctx.GetCommandList()->SetComputeRoot32BitConstants(0, 6, &CBData, 0);
-
-        D3D12_CPU_DESCRIPTOR_HANDLE DstDescriptorRange     = DescriptorAlloc.GetCpuHandle();
-        const Uint32                MaxMipsHandledByCS     = 4; // Max number of mip levels processed by one CS shader invocation
-        UINT                        DstRangeSize           = 1 + MaxMipsHandledByCS;
-        D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptorRanges[5] = {};
-
-        SrcDescriptorRanges[0] = SRVDescriptorHandle;
-        UINT SrcRangeSizes[5]  = {1, 1, 1, 1, 1};
-        // On Resource Binding Tier 2 hardware, all descriptor tables of type CBV and UAV declared in the set
-        // Root Signature must be populated and initialized, even if the shaders do not need the descriptor.
-        // So we must populate all 4 slots even though we may actually process less than 4 mip levels
-        // Copy top mip level UAV descriptor handle to all unused slots
-        for (Uint32 u = 0; u < MaxMipsHandledByCS; ++u)
-            SrcDescriptorRanges[1 + u] = pTexView->GetMipLevelUAV(TopMip + std::min(u + 1, NumMips));
-
-        pd3d12Device->CopyDescriptors(1, &DstDescriptorRange, &DstRangeSize, 1 + MaxMipsHandledByCS, SrcDescriptorRanges, SrcRangeSizes, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+            // Determine if the first downsample is more than 2:1.  This happens whenever
+            // the source width or height is odd.
+            uint32_t NonPowerOfTwo = (SrcWidth & 1) | (SrcHeight & 1) << 1;
+            if (IsGamma)
+                ComputeCtx.SetPipelineState(m_pGenerateMipsGammaPSO[NonPowerOfTwo]);
+            else
+                ComputeCtx.SetPipelineState(m_pGenerateMipsLinearPSO[NonPowerOfTwo]);
+
+            // We can downsample up to four times, but if the ratio between levels is not
+            // exactly 2:1, we have to shift our blend weights, which gets complicated or
+            // expensive.  Maybe we can update the code later to compute sample weights for
+            // each successive downsample.  We use _BitScanForward to count number of zeros
+            // in the low bits.  Zeros indicate we can divide by two without truncating.
+            uint32_t AdditionalMips;
+            _BitScanForward((unsigned long*)&AdditionalMips, DstWidth | DstHeight);
+            NumMips = 1 + (AdditionalMips > 3 ? 3 : AdditionalMips);
+            if (TopMip + NumMips > BottomMip)
+                NumMips = BottomMip - TopMip;
+
+            // These are clamped to 1 after computing additional mips because clamped
+            // dimensions should not limit us from downsampling multiple times.  (E.g.
+            // 16x1 -> 8x1 -> 4x1 -> 2x1 -> 1x1.)
+            if (DstWidth == 0)
+                DstWidth = 1;
+            if (DstHeight == 0)
+                DstHeight = 1;
+
+            D3D12_DESCRIPTOR_HEAP_TYPE HeapType        = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+            DescriptorHeapAllocation   DescriptorAlloc = Ctx.AllocateDynamicGPUVisibleDescriptor(HeapType, 5);
+
+            CommandContext::ShaderDescriptorHeaps Heaps{DescriptorAlloc.GetDescriptorHeap(), nullptr};
+            ComputeCtx.SetDescriptorHeaps(Heaps);
+            Ctx.GetCommandList()->SetComputeRootDescriptorTable(1, DescriptorAlloc.GetGpuHandle(0));
+            Ctx.GetCommandList()->SetComputeRootDescriptorTable(2, DescriptorAlloc.GetGpuHandle(1));
+            struct RootCBData
+            {
+                Uint32 SrcMipLevel;  // Texture level of source mip
+                Uint32 NumMipLevels; // Number of OutMips to write: [1, 4]
+                Uint32 FirstArraySlice;
+                Uint32 Dummy;
+                float  TexelSize[2]; // 1.0 / OutMip1.Dimensions
+            };
+            RootCBData CBData{
+                TopMip, // Mip levels are relateive to the view's most detailed mip
+                NumMips,
+                0, // Array slices are relative to the view's first array slice
+                0,
+                {1.0f / static_cast<float>(DstWidth), 1.0f / static_cast<float>(DstHeight)}};
+
+            Ctx.GetCommandList()->SetComputeRoot32BitConstants(0, 6, &CBData, 0);
+
+            D3D12_CPU_DESCRIPTOR_HANDLE DstDescriptorRange     = DescriptorAlloc.GetCpuHandle();
+            const Uint32                MaxMipsHandledByCS     = 4; // Max number of mip levels processed by one CS shader invocation
+            UINT                        DstRangeSize           = 1 + MaxMipsHandledByCS;
+            D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptorRanges[5] = {};
+
+            SrcDescriptorRanges[0] = SRVDescriptorHandle;
+            UINT SrcRangeSizes[5]  = {1, 1, 1, 1, 1};
+            // On Resource Binding Tier 2 hardware, all descriptor tables of type CBV and UAV declared in the set
+            // Root Signature must be populated and initialized, even if the shaders do not need the descriptor.
+            // So we must populate all 4 slots even though we may actually process less than 4 mip levels
+            // Copy top mip level UAV descriptor handle to all unused slots
+            for (Uint32 u = 0; u < MaxMipsHandledByCS; ++u)
+                SrcDescriptorRanges[1 + u] = pTexView->GetMipLevelUAV(TopMip + std::min(u + 1, NumMips));
+
+            pd3d12Device->CopyDescriptors(1, &DstDescriptorRange, &DstRangeSize, 1 + MaxMipsHandledByCS, SrcDescriptorRanges, SrcRangeSizes, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        }
 
         // Transition top mip level to the shader resource state
         StateTransitionDesc SrcMipBarrier{pTexD3D12, TopMip == 0 ? OriginalState : RESOURCE_STATE_UNORDERED_ACCESS, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_NONE};
@@ -249,7 +355,17 @@ void GenerateMipsHelper::GenerateMips(ID3D12Device* pd3d12Device, TextureViewD3D
             Ctx.TransitionResource(*pTexD3D12, DstMipsBarrier);
         }
 
-        ComputeCtx.Dispatch((DstWidth + 7) / 8, (DstHeight + 7) / 8, ViewDesc.NumArraySlices);
+        if (pSinglePassScratch != nullptr)
+        {
+            // Transition the scratch buffer to UAV state or insert the UAV barrier so that
+            // the dispatch sees the counters reset by the previous one.
+            Ctx.TransitionResource(*pSinglePassScratch, RESOURCE_STATE_UNORDERED_ACCESS);
+            ComputeCtx.Dispatch(NumGroupsX, NumGroupsY, ViewDesc.NumArraySlices);
+        }
+        else
+        {
+            ComputeCtx.Dispatch((DstWidth + 7) / 8, (DstHeight + 7) / 8, ViewDesc.NumArraySlices);
+        }
 
         // Transition the lowest level back to original layout or leave it in RESOURCE_STATE_SHADER_RESOURCE
         // if all subresources are processed
@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "IndirectCommandSignatureD3D12Impl.hpp"
+
+#include "RenderDeviceD3D12Impl.hpp"
+#include "PipelineStateD3D12Impl.hpp"
+#include "PipelineResourceSignatureD3D12Impl.hpp"
+#include "StringTools.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+Uint32 FindConstantBufferRootIndex(const RootSignatureD3D12& RootSig, const IndirectCommandArgumentDesc& Arg, const char* PipelineName)
+{
+    for (Uint32 s = 0; s < RootSig.GetSignatureCount(); ++s)
+    {
+        const PipelineResourceSignatureD3D12Impl* pSignature = RootSig.GetResourceSignature(s);
+        if (pSignature == nullptr)
+            continue;
+
+        const Uint32 ResIndex = pSignature->FindResource(Arg.ShaderStages, Arg.Name);
+        if (ResIndex == InvalidPipelineResourceIndex)
+            continue;
+
+        const PipelineResourceDesc& ResDesc = pSignature->GetResourceDesc(ResIndex);
+        if (ResDesc.ResourceType != SHADER_RESOURCE_TYPE_CONSTANT_BUFFER)
+            LOG_ERROR_AND_THROW("Resource '", Arg.Name, "' in pipeline '", PipelineName, "' is not a constant buffer");
+
+        // Only root views can be changed by indirect commands. Constant buffers are allocated
+        // in descriptor tables when they are arrays or use PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS.
+        const PipelineResourceAttribsD3D12& Attribs = pSignature->GetResourceAttribs(ResIndex);
+        if (Attribs.GetD3D12RootParamType() != D3D12_ROOT_PARAMETER_TYPE_CBV)
+            LOG_ERROR_AND_THROW("Constant buffer '", Arg.Name, "' in pipeline '", PipelineName,
+                                "' is not bound as a root view and can't be changed by indirect commands. "
+                                "Make sure that the buffer is not an array and is not labeled with PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS flag.");
+
+        return RootSig.GetBaseRootIndex(s) + Attribs.RootIndex(ResourceCacheContentType::SRB);
+    }
+
+    LOG_ERROR_AND_THROW("Constant buffer '", Arg.Name, "' is not found in pipeline '", PipelineName, "'");
+    return ~0u;
+}
+
+} // namespace
+
+IndirectCommandSignatureD3D12Impl::IndirectCommandSignatureD3D12Impl(IReferenceCounters*                 pRefCounters,
+                                                                     RenderDeviceD3D12Impl*              pDevice,
+                                                                     const IndirectCommandSignatureDesc& Desc) :
+    TIndirectCommandSignatureBase{pRefCounters, pDevice, Desc}
+{
+    const PipelineStateD3D12Impl* pPipelineD3D12 = m_pPipeline.ConstPtr<PipelineStateD3D12Impl>();
+
+    std::vector<D3D12_INDIRECT_ARGUMENT_DESC> d3d12Args(m_Arguments.size());
+
+    bool UsesRootSignature = false;
+    for (size_t i = 0; i < m_Arguments.size(); ++i)
+    {
+        const IndirectCommandArgumentDesc& Arg      = m_Arguments[i];
+        D3D12_INDIRECT_ARGUMENT_DESC&      d3d12Arg = d3d12Args[i];
+        static_assert(INDIRECT_COMMAND_ARGUMENT_TYPE_COUNT == 6, "Please handle the new argument type below");
+        switch (Arg.Type)
+        {
+            case INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW:
+                static_assert(sizeof(D3D12_DRAW_ARGUMENTS) == sizeof(Uint32) * 4, "Unexpected D3D12_DRAW_ARGUMENTS size");
+                d3d12Arg.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW;
+                break;
+
+            case INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW_INDEXED:
+                static_assert(sizeof(D3D12_DRAW_INDEXED_ARGUMENTS) == sizeof(Uint32) * 5, "Unexpected D3D12_DRAW_INDEXED_ARGUMENTS size");
+                d3d12Arg.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+                break;
+
+            case INDIRECT_COMMAND_ARGUMENT_TYPE_CONSTANT_BUFFER:
+                static_assert(sizeof(D3D12_GPU_VIRTUAL_ADDRESS) == sizeof(Uint64), "Unexpected D3D12_GPU_VIRTUAL_ADDRESS size");
+                VERIFY_EXPR(pPipelineD3D12 != nullptr);
+                d3d12Arg.Type                                  = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT_BUFFER_VIEW;
+                d3d12Arg.ConstantBufferView.RootParameterIndex = FindConstantBufferRootIndex(pPipelineD3D12->GetRootSignature(), Arg, pPipelineD3D12->GetDesc().Name);
+                UsesRootSignature                              = true;
+                break;
+
+            case INDIRECT_COMMAND_ARGUMENT_TYPE_VERTEX_BUFFER:
+                static_assert(sizeof(D3D12_VERTEX_BUFFER_VIEW) == sizeof(Uint64) + sizeof(Uint32) * 2, "Unexpected D3D12_VERTEX_BUFFER_VIEW size");
+                d3d12Arg.Type              = D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW;
+                d3d12Arg.VertexBuffer.Slot = Arg.Slot;
+                break;
+
+            case INDIRECT_COMMAND_ARGUMENT_TYPE_INDEX_BUFFER:
+                static_assert(sizeof(D3D12_INDEX_BUFFER_VIEW) == sizeof(Uint64) + sizeof(Uint32) * 2, "Unexpected D3D12_INDEX_BUFFER_VIEW size");
+                d3d12Arg.Type = D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW;
+                break;
+
+            default:
+                UNEXPECTED("Unexpected indirect command argument type");
+        }
+    }
+
+    D3D12_COMMAND_SIGNATURE_DESC d3d12SignDesc{};
+    d3d12SignDesc.ByteStride       = m_Desc.ByteStride;
+    d3d12SignDesc.NumArgumentDescs = static_cast<UINT>(d3d12Args.size());
+    d3d12SignDesc.pArgumentDescs   = d3d12Args.data();
+    d3d12SignDesc.NodeMask         = 0;
+
+    // The root signature is required when the command signature changes root arguments.
+    ID3D12RootSignature* pd3d12RootSig = UsesRootSignature ? pPipelineD3D12->GetD3D12RootSignature() : nullptr;
+
+    HRESULT hr = pDevice->GetD3D12Device()->CreateCommandSignature(&d3d12SignDesc, pd3d12RootSig, __uuidof(m_pd3d12CmdSignature), reinterpret_cast<void**>(static_cast<ID3D12CommandSignature**>(&m_pd3d12CmdSignature)));
+    CHECK_D3D_RESULT_THROW(hr, "Failed to create D3D12 command signature");
+
+    if (m_Desc.Name != nullptr)
+        m_pd3d12CmdSignature->SetName(WidenString(m_Desc.Name).c_str());
+}
+
+IndirectCommandSignatureD3D12Impl::~IndirectCommandSignatureD3D12Impl()
+{
+    // The signature may still be referenced by command lists of any context
+    GetDevice()->SafeReleaseDeviceObject(std::move(m_pd3d12CmdSignature), ~Uint64{0});
+}
+
+} // namespace Diligent
@@ -253,7 +253,7 @@ void PipelineResourceSignatureD3D12Impl::AllocateRootParameters(const bool IsSer
                 // Samplers at root index D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER (3)
                 SigRootIndex            = d3d12DescriptorRangeType;
                 SigOffsetFromTableStart = StaticResCacheTblSizes[SigRootIndex];
-                StaticResCacheTblSizes[SigRootIndex] += ResDesc.ArraySize;
+                StaticResCacheTblSizes[SigRootIndex] += ResDesc.GetArraySize();
             }
 
             if (IsRTSizedArray)
@@ -267,7 +267,7 @@ void PipelineResourceSignatureD3D12Impl::AllocateRootParameters(const bool IsSer
                 // Normal resources go into space 0.
                 Space    = 0;
                 Register = NumResources[d3d12DescriptorRangeType];
-                NumResources[d3d12DescriptorRangeType] += ResDesc.ArraySize;
+                NumResources[d3d12DescriptorRangeType] += ResDesc.GetArraySize();
             }
 
             const PIPELINE_RESOURCE_FLAGS dbgValidResourceFlags = GetValidPipelineResourceFlags(ResDesc.ResourceType);
@@ -275,7 +275,8 @@ void PipelineResourceSignatureD3D12Impl::AllocateRootParameters(const bool IsSer
 
             const bool UseDynamicOffset  = (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS) == 0;
             const bool IsFormattedBuffer = (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER) != 0;
-            const bool IsArray           = ResDesc.ArraySize != 1;
+            const bool IsArray           = ResDesc.GetArraySize() != 1;
+            const bool IsInlineConstants = (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0;
 
             d3d12RootParamType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
             static_assert(SHADER_RESOURCE_TYPE_LAST == SHADER_RESOURCE_TYPE_ACCEL_STRUCT, "Please update the switch below to handle the new shader resource type");
@@ -283,7 +284,10 @@ void PipelineResourceSignatureD3D12Impl::AllocateRootParameters(const bool IsSer
             {
                 case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
                     VERIFY(!IsFormattedBuffer, "Constant buffers can't be labeled as formatted. This error should've been caught by ValidatePipelineResourceSignatureDesc().");
-                    d3d12RootParamType = UseDynamicOffset && !IsArray ? D3D12_ROOT_PARAMETER_TYPE_CBV : D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+                    if (IsInlineConstants)
+                        d3d12RootParamType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+                    else
+                        d3d12RootParamType = UseDynamicOffset && !IsArray ? D3D12_ROOT_PARAMETER_TYPE_CBV : D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
                     break;
 
                 case SHADER_RESOURCE_TYPE_BUFFER_SRV:
@@ -300,7 +304,7 @@ void PipelineResourceSignatureD3D12Impl::AllocateRootParameters(const bool IsSer
             }
 
             ParamsBuilder.AllocateResourceSlot(ResDesc.ShaderStages, ResDesc.VarType, d3d12RootParamType,
-                                               d3d12DescriptorRangeType, ResDesc.ArraySize, Register, Space,
+                                               d3d12DescriptorRangeType, ResDesc.ArraySize /*Number of constants for root constants*/, Register, Space,
                                                SRBRootIndex, SRBOffsetFromTableStart);
         }
         else
@@ -392,6 +396,9 @@ void PipelineResourceSignatureD3D12Impl::CopyStaticResources(ShaderResourceCache
     const ResourceCacheContentType  DstCacheType     = DstResourceCache.GetContentType();
     VERIFY_EXPR(SrcCacheType == ResourceCacheContentType::Signature);
 
+    // Descriptors of all static resources are copied with one CopyDescriptors call per heap type
+    ShaderResourceCacheD3D12::DescriptorCopyBatch CopyBatch;
+
     for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
     {
         const PipelineResourceDesc&        ResDesc   = GetResourceDesc(r);
@@ -430,7 +437,7 @@ void PipelineResourceSignatureD3D12Impl::CopyStaticResources(ShaderResourceCache
             if (DstRes.pObject != SrcRes.pObject)
             {
                 DEV_CHECK_ERR(DstRes.pObject == nullptr, "Static resource has already been initialized, and the new resource does not match previously assigned resource.");
-                DstResourceCache.CopyResource(d3d12Device, DstRootIndex, DstCacheOffset, SrcRes);
+                DstResourceCache.CopyResource(d3d12Device, DstRootIndex, DstCacheOffset, SrcRes, &CopyBatch);
             }
             else
             {
@@ -440,6 +447,8 @@ void PipelineResourceSignatureD3D12Impl::CopyStaticResources(ShaderResourceCache
             }
         }
     }
+
+    CopyBatch.Flush(d3d12Device);
 }
 
 void PipelineResourceSignatureD3D12Impl::CommitRootViews(const CommitCacheResourcesAttribs& CommitAttribs,
@@ -530,56 +539,69 @@ void PipelineResourceSignatureD3D12Impl::CommitRootTables(const CommitCacheResou
     CommandContext&                 CmdCtx        = CommitAttribs.CmdCtx;
     ID3D12Device* const             pd3d12Device  = CommitAttribs.pd3d12Device;
 
-    // Having an array of actual DescriptorHeapAllocation objects introduces unnecessary overhead when
-    // there are no dynamic variables as constructors and destructors are always called. To avoid this
-    // overhead we will construct DescriptorHeapAllocation in-place only when they are really needed.
-    std::array<DescriptorHeapAllocation*, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1> pDynamicDescriptorAllocations{};
-
-    // Reserve space for DescriptorHeapAllocation objects (do NOT zero-out!)
-    alignas(DescriptorHeapAllocation) uint8_t DynamicDescriptorAllocationsRawMem[sizeof(DescriptorHeapAllocation) * (D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1)];
+    // If the cache has not changed since the dynamic tables were last committed by this context,
+    // the descriptors in the GPU-visible heap are still valid and can be reused.
+    CommittedDynamicTables* const pDynamicTables     = CommitAttribs.pDynamicTables;
+    const bool                    ReuseDynamicTables = pDynamicTables != nullptr && pDynamicTables->CacheRevision == ResourceCache.GetRevision();
 
-    for (Uint32 heap_type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV; heap_type < D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1; ++heap_type)
+    CommittedDynamicTables DynamicTables;
+    if (ReuseDynamicTables)
     {
-        const D3D12_DESCRIPTOR_HEAP_TYPE d3d12HeapType = static_cast<D3D12_DESCRIPTOR_HEAP_TYPE>(heap_type);
+        DynamicTables = *pDynamicTables;
+    }
+    else
+    {
+        for (Uint32 heap_type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV; heap_type < D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1; ++heap_type)
+        {
+            const D3D12_DESCRIPTOR_HEAP_TYPE d3d12HeapType = static_cast<D3D12_DESCRIPTOR_HEAP_TYPE>(heap_type);
 
-        Uint32 NumDynamicDescriptors = m_RootParams.GetParameterGroupSize(d3d12HeapType, ROOT_PARAMETER_GROUP_DYNAMIC);
-        if (NumDynamicDescriptors > 0)
+            Uint32 NumDynamicDescriptors = m_RootParams.GetParameterGroupSize(d3d12HeapType, ROOT_PARAMETER_GROUP_DYNAMIC);
+            if (NumDynamicDescriptors > 0)
+            {
+                // The allocation is owned by the command context, so the descriptors remain valid until
+                // the context is disposed even though the DescriptorHeapAllocation object is destroyed.
+                DescriptorHeapAllocation Allocation = CmdCtx.AllocateDynamicGPUVisibleDescriptor(d3d12HeapType, NumDynamicDescriptors);
+
+                DEV_CHECK_ERR(!Allocation.IsNull(),
+                              "Failed to allocate ", NumDynamicDescriptors, " dynamic GPU-visible ",
+                              (d3d12HeapType == D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV ? "CBV/SRV/UAV" : "Sampler"),
+                              " descriptor(s). Consider increasing GPUDescriptorHeapDynamicSize[", heap_type,
+                              "] in EngineD3D12CreateInfo or optimizing dynamic resource utilization by using static "
+                              "or mutable shader resource variables instead.");
+
+                // Copy all dynamic descriptors from the CPU-only cache allocation
+                const DescriptorHeapAllocation& SrcDynamicAllocation = ResourceCache.GetDescriptorAllocation(d3d12HeapType, ROOT_PARAMETER_GROUP_DYNAMIC);
+                VERIFY_EXPR(SrcDynamicAllocation.GetNumHandles() == NumDynamicDescriptors);
+                pd3d12Device->CopyDescriptorsSimple(NumDynamicDescriptors, Allocation.GetCpuHandle(), SrcDynamicAllocation.GetCpuHandle(), d3d12HeapType);
+
+                DynamicTables.pHeaps[d3d12HeapType]          = Allocation.GetDescriptorHeap();
+                DynamicTables.GPUHandles[d3d12HeapType]      = Allocation.GetGpuHandle();
+                DynamicTables.DescriptorSizes[d3d12HeapType] = Allocation.GetDescriptorSize();
+            }
+        }
+
+        if (pDynamicTables != nullptr)
         {
-            DescriptorHeapAllocation*& pAllocation = pDynamicDescriptorAllocations[d3d12HeapType];
-
-            // Create new DescriptorHeapAllocation in-place
-            pAllocation = new (&DynamicDescriptorAllocationsRawMem[sizeof(DescriptorHeapAllocation) * heap_type])
-                DescriptorHeapAllocation{CmdCtx.AllocateDynamicGPUVisibleDescriptor(d3d12HeapType, NumDynamicDescriptors)};
-
-            DEV_CHECK_ERR(!pAllocation->IsNull(),
-                          "Failed to allocate ", NumDynamicDescriptors, " dynamic GPU-visible ",
-                          (d3d12HeapType == D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV ? "CBV/SRV/UAV" : "Sampler"),
-                          " descriptor(s). Consider increasing GPUDescriptorHeapDynamicSize[", heap_type,
-                          "] in EngineD3D12CreateInfo or optimizing dynamic resource utilization by using static "
-                          "or mutable shader resource variables instead.");
-
-            // Copy all dynamic descriptors from the CPU-only cache allocation
-            const DescriptorHeapAllocation& SrcDynamicAllocation = ResourceCache.GetDescriptorAllocation(d3d12HeapType, ROOT_PARAMETER_GROUP_DYNAMIC);
-            VERIFY_EXPR(SrcDynamicAllocation.GetNumHandles() == NumDynamicDescriptors);
-            pd3d12Device->CopyDescriptorsSimple(NumDynamicDescriptors, pAllocation->GetCpuHandle(), SrcDynamicAllocation.GetCpuHandle(), d3d12HeapType);
+            DynamicTables.CacheRevision = ResourceCache.GetRevision();
+            *pDynamicTables             = DynamicTables;
         }
     }
 
-    DescriptorHeapAllocation* const pSrvCbvUavDynamicAllocation = pDynamicDescriptorAllocations[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV];
-    DescriptorHeapAllocation* const pSamplerDynamicAllocation   = pDynamicDescriptorAllocations[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER];
+    ID3D12DescriptorHeap* const pSrvCbvUavDynamicHeap = DynamicTables.pHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV];
+    ID3D12DescriptorHeap* const pSamplerDynamicHeap   = DynamicTables.pHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER];
 
     CommandContext::ShaderDescriptorHeaps Heaps{
         ResourceCache.GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, ROOT_PARAMETER_GROUP_STATIC_MUTABLE),
         ResourceCache.GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, ROOT_PARAMETER_GROUP_STATIC_MUTABLE),
     };
-    if (Heaps.pSrvCbvUavHeap == nullptr && pSrvCbvUavDynamicAllocation != nullptr)
-        Heaps.pSrvCbvUavHeap = pSrvCbvUavDynamicAllocation->GetDescriptorHeap();
-    if (Heaps.pSamplerHeap == nullptr && pSamplerDynamicAllocation != nullptr)
-        Heaps.pSamplerHeap = pSamplerDynamicAllocation->GetDescriptorHeap();
+    if (Heaps.pSrvCbvUavHeap == nullptr && pSrvCbvUavDynamicHeap != nullptr)
+        Heaps.pSrvCbvUavHeap = pSrvCbvUavDynamicHeap;
+    if (Heaps.pSamplerHeap == nullptr && pSamplerDynamicHeap != nullptr)
+        Heaps.pSamplerHeap = pSamplerDynamicHeap;
 
-    VERIFY(pSrvCbvUavDynamicAllocation == nullptr || pSrvCbvUavDynamicAllocation->GetDescriptorHeap() == Heaps.pSrvCbvUavHeap,
+    VERIFY(pSrvCbvUavDynamicHeap == nullptr || pSrvCbvUavDynamicHeap == Heaps.pSrvCbvUavHeap,
            "Inconsistent CBV/SRV/UAV descriptor heaps");
-    VERIFY(pSamplerDynamicAllocation == nullptr || pSamplerDynamicAllocation->GetDescriptorHeap() == Heaps.pSamplerHeap,
+    VERIFY(pSamplerDynamicHeap == nullptr || pSamplerDynamicHeap == Heaps.pSamplerHeap,
            "Inconsistent Sampler descriptor heaps");
 
     if (Heaps)
@@ -604,8 +626,9 @@ void PipelineResourceSignatureD3D12Impl::CommitRootTables(const CommitCacheResou
         D3D12_GPU_DESCRIPTOR_HANDLE RootTableGPUDescriptorHandle{};
         if (RootTable.Group == ROOT_PARAMETER_GROUP_DYNAMIC)
         {
-            DescriptorHeapAllocation& DynamicAllocation{*pDynamicDescriptorAllocations[d3d12HeapType]};
-            RootTableGPUDescriptorHandle = DynamicAllocation.GetGpuHandle(TableOffsetInGroupAllocation);
+            VERIFY_EXPR(DynamicTables.GPUHandles[d3d12HeapType].ptr != 0);
+            RootTableGPUDescriptorHandle = DynamicTables.GPUHandles[d3d12HeapType];
+            RootTableGPUDescriptorHandle.ptr += SIZE_T{DynamicTables.DescriptorSizes[d3d12HeapType]} * SIZE_T{TableOffsetInGroupAllocation};
         }
         else
         {
@@ -626,11 +649,16 @@ void PipelineResourceSignatureD3D12Impl::CommitRootTables(const CommitCacheResou
         CommitRootViews(CommitAttribs, NonDynamicBuffersMask);
     }
 
-    // Manually destroy DescriptorHeapAllocation objects we created.
-    for (DescriptorHeapAllocation* pAllocation : pDynamicDescriptorAllocations)
+    // Commit inline constants
+    for (Uint32 i = 0; i < GetInlineConstantsCount(); ++i)
     {
-        if (pAllocation != nullptr)
-            pAllocation->~DescriptorHeapAllocation();
+        const InlineConstantsAttribs& InlineCB  = GetInlineConstantsAttribs(i);
+        const Uint32                  RootIndex = BaseRootIndex + GetResourceAttribs(InlineCB.ResIndex).RootIndex(ResourceCacheContentType::SRB);
+        const Uint32*                 pValues   = ResourceCache.GetInlineConstants(InlineCB.Offset);
+        if (CommitAttribs.IsCompute)
+            CmdCtx.GetCommandList()->SetComputeRoot32BitConstants(RootIndex, InlineCB.NumConstants, pValues, 0);
+        else
+            CmdCtx.GetCommandList()->SetGraphicsRoot32BitConstants(RootIndex, InlineCB.NumConstants, pValues, 0);
     }
 }
 
@@ -650,7 +678,7 @@ void PipelineResourceSignatureD3D12Impl::UpdateShaderResourceBindingMap(Resource
                 {
                     Attribs.Register,
                     Attribs.Space + BaseRegisterSpace,
-                    ResDesc.ArraySize,
+                    ResDesc.GetArraySize(),
                     ResDesc.ResourceType //
                 };
             bool IsUnique = ResourceMap.emplace(HashMapStringKey{ResDesc.Name}, BindInfo).second;
@@ -730,6 +758,10 @@ bool PipelineResourceSignatureD3D12Impl::DvpValidateCommittedResource(const Devi
     if ((ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER) && ResAttribs.IsImmutableSamplerAssigned())
         return true;
 
+    // Inline constants are always set through root constants
+    if ((ResDesc.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0)
+        return true;
+
     const ResourceCacheContentType CacheType = ResourceCache.GetContentType();
     VERIFY(CacheType == ResourceCacheContentType::SRB, "Only SRB resource cache can be committed");
     const Uint32                               RootIndex            = ResAttribs.RootIndex(CacheType);
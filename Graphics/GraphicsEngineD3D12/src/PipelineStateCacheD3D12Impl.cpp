@@ -46,14 +46,45 @@ PipelineStateCacheD3D12Impl::PipelineStateCacheD3D12Impl(IReferenceCounters*
     }
 // clang-format on
 {
-    HRESULT hr = pRenderDeviceD3D12->GetD3D12Device1()->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&m_pLibrary));
-    if (FAILED(hr))
-        LOG_ERROR_AND_THROW("Failed to create D3D12 pipeline library");
+    ID3D12Device1* const pd3d12Device1 = pRenderDeviceD3D12->GetD3D12Device1();
+
+    HRESULT hr = E_FAIL;
+    if (CreateInfo.pCacheData != nullptr && CreateInfo.CacheDataSize > 0)
+    {
+        const Uint8* pData = static_cast<const Uint8*>(CreateInfo.pCacheData);
+        m_LibraryData.assign(pData, pData + CreateInfo.CacheDataSize);
+
+        hr = pd3d12Device1->CreatePipelineLibrary(m_LibraryData.data(), m_LibraryData.size(), IID_PPV_ARGS(&m_pLibrary));
+        if (FAILED(hr))
+        {
+            // The data may have been created by a different adapter or driver version, or may be corrupted.
+            // In all these cases, start with an empty library.
+            const char* Reason =
+                hr == D3D12_ERROR_ADAPTER_NOT_FOUND          ? "the data was created on a different adapter" :
+                hr == D3D12_ERROR_DRIVER_VERSION_MISMATCH    ? "the data was created by a different driver version" :
+                hr == DXGI_ERROR_UNSUPPORTED                 ? "the OS or driver does not support pipeline libraries" :
+                                                               "the data is invalid";
+            if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+                LOG_WARNING_MESSAGE("Failed to create D3D12 pipeline library from the cache data because ", Reason, ". An empty library will be created.");
+            m_LibraryData.clear();
+        }
+    }
+
+    if (!m_pLibrary)
+    {
+        hr = pd3d12Device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&m_pLibrary));
+        if (FAILED(hr))
+            LOG_ERROR_AND_THROW("Failed to create D3D12 pipeline library");
+    }
+
+    // ID3D12PipelineLibrary1 is optional and is only used to load pipelines created from pipeline state streams
+    m_pLibrary->QueryInterface(IID_PPV_ARGS(&m_pLibrary1));
 }
 
 PipelineStateCacheD3D12Impl::~PipelineStateCacheD3D12Impl()
 {
     // D3D12 object can only be destroyed when it is no longer used by the GPU
+    m_pLibrary1.Release();
     GetDevice()->SafeReleaseDeviceObject(std::move(m_pLibrary), ~Uint64{0});
 }
 
@@ -93,6 +124,26 @@ CComPtr<ID3D12DeviceChild> PipelineStateCacheD3D12Impl::LoadGraphicsPipeline(con
     return d3d12PSO;
 }
 
+#ifdef D3D12_H_HAS_MESH_SHADER
+CComPtr<ID3D12DeviceChild> PipelineStateCacheD3D12Impl::LoadPipeline(const wchar_t* Name, const D3D12_PIPELINE_STATE_STREAM_DESC& Desc)
+{
+    if (Name == nullptr)
+    {
+        DEV_ERROR("Pipeline name must not be null");
+        return {};
+    }
+
+    CComPtr<ID3D12DeviceChild> d3d12PSO;
+    if ((m_Desc.Mode & PSO_CACHE_MODE_LOAD) != 0 && m_pLibrary1)
+    {
+        HRESULT hr = m_pLibrary1->LoadPipeline(Name, &Desc, IID_PPV_ARGS(&d3d12PSO));
+        if (FAILED(hr) && (m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_ERROR_MESSAGE("Failed to load pipeline '", NarrowString(Name), "' from the library");
+    }
+    return d3d12PSO;
+}
+#endif
+
 bool PipelineStateCacheD3D12Impl::StorePipeline(const wchar_t* Name, ID3D12DeviceChild* pPSO)
 {
     VERIFY_EXPR(Name != nullptr);
@@ -51,6 +51,8 @@
 #include "DynamicLinearAllocator.hpp"
 #include "D3DShaderResourceValidation.hpp"
 #include "DataBlobImpl.hpp"
+#include "PlatformMisc.hpp"
+#include "Timer.hpp"
 
 #include "DXBCUtils.hpp"
 #include "DXCompiler.hpp"
@@ -87,10 +89,121 @@ struct alignas(void*) PSS_SubObject
     InnerStructType& operator*() { return Obj; }
 };
 
+// Graphics pipeline description with view instancing enabled. D3D12_GRAPHICS_PIPELINE_STATE_DESC
+// does not have a view instancing member, so the pipeline must be created from the state stream.
+struct ViewInstancingGraphicsPipelineStream
+{
+    struct
+    {
+        PSS_SubObject<D3D12_PIPELINE_STATE_FLAGS, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_FLAGS>                      Flags;
+        PSS_SubObject<UINT, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_NODE_MASK>                                        NodeMask;
+        PSS_SubObject<ID3D12RootSignature*, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_ROOT_SIGNATURE>                   pRootSignature;
+        PSS_SubObject<D3D12_SHADER_BYTECODE, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VS>                              VS;
+        PSS_SubObject<D3D12_SHADER_BYTECODE, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PS>                              PS;
+        PSS_SubObject<D3D12_SHADER_BYTECODE, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DS>                              DS;
+        PSS_SubObject<D3D12_SHADER_BYTECODE, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_HS>                              HS;
+        PSS_SubObject<D3D12_SHADER_BYTECODE, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_GS>                              GS;
+        PSS_SubObject<D3D12_STREAM_OUTPUT_DESC, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_STREAM_OUTPUT>                StreamOutput;
+        PSS_SubObject<D3D12_BLEND_DESC, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_BLEND>                                BlendState;
+        PSS_SubObject<UINT, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_MASK>                                      SampleMask;
+        PSS_SubObject<D3D12_RASTERIZER_DESC, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RASTERIZER>                      RasterizerState;
+        PSS_SubObject<D3D12_DEPTH_STENCIL_DESC, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL>                DepthStencilState;
+        PSS_SubObject<D3D12_INPUT_LAYOUT_DESC, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_INPUT_LAYOUT>                  InputLayout;
+        PSS_SubObject<D3D12_INDEX_BUFFER_STRIP_CUT_VALUE, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_IB_STRIP_CUT_VALUE> IBStripCutValue;
+        PSS_SubObject<D3D12_PRIMITIVE_TOPOLOGY_TYPE, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PRIMITIVE_TOPOLOGY>      PrimitiveTopologyType;
+        PSS_SubObject<D3D12_RT_FORMAT_ARRAY, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RENDER_TARGET_FORMATS>           RTVFormatArray;
+        PSS_SubObject<DXGI_FORMAT, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL_FORMAT>                      DSVFormat;
+        PSS_SubObject<DXGI_SAMPLE_DESC, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_DESC>                          SampleDesc;
+        PSS_SubObject<D3D12_CACHED_PIPELINE_STATE, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_CACHED_PSO>                CachedPSO;
+        PSS_SubObject<D3D12_VIEW_INSTANCING_DESC, D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VIEW_INSTANCING>            ViewInstancing;
+    } Stream;
+
+    D3D12_VIEW_INSTANCE_LOCATION ViewInstanceLocations[D3D12_MAX_VIEW_INSTANCE_COUNT] = {};
+
+    ViewInstancingGraphicsPipelineStream(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& d3d12PSODesc, Uint32 ViewMask)
+    {
+        Stream.Flags                 = d3d12PSODesc.Flags;
+        Stream.NodeMask              = d3d12PSODesc.NodeMask;
+        Stream.pRootSignature        = d3d12PSODesc.pRootSignature;
+        Stream.VS                    = d3d12PSODesc.VS;
+        Stream.PS                    = d3d12PSODesc.PS;
+        Stream.DS                    = d3d12PSODesc.DS;
+        Stream.HS                    = d3d12PSODesc.HS;
+        Stream.GS                    = d3d12PSODesc.GS;
+        Stream.StreamOutput          = d3d12PSODesc.StreamOutput;
+        Stream.BlendState            = d3d12PSODesc.BlendState;
+        Stream.SampleMask            = d3d12PSODesc.SampleMask;
+        Stream.RasterizerState       = d3d12PSODesc.RasterizerState;
+        Stream.DepthStencilState     = d3d12PSODesc.DepthStencilState;
+        Stream.InputLayout           = d3d12PSODesc.InputLayout;
+        Stream.IBStripCutValue       = d3d12PSODesc.IBStripCutValue;
+        Stream.PrimitiveTopologyType = d3d12PSODesc.PrimitiveTopologyType;
+        Stream.DSVFormat             = d3d12PSODesc.DSVFormat;
+        Stream.SampleDesc            = d3d12PSODesc.SampleDesc;
+        Stream.CachedPSO             = d3d12PSODesc.CachedPSO;
+
+        Stream.RTVFormatArray->NumRenderTargets = d3d12PSODesc.NumRenderTargets;
+        for (Uint32 rt = 0; rt < _countof(d3d12PSODesc.RTVFormats); ++rt)
+            Stream.RTVFormatArray->RTFormats[rt] = d3d12PSODesc.RTVFormats[rt];
+
+        // View instance i renders to render target array slice i, and views that are not in the mask
+        // are disabled at draw time by SetViewInstanceMask. This way SV_ViewID equals the bit index in
+        // the subpass view mask, which matches gl_ViewIndex in Vulkan.
+        VERIFY_EXPR(ViewMask != 0 && ViewMask < (1u << D3D12_MAX_VIEW_INSTANCE_COUNT));
+        const Uint32 ViewCount = PlatformMisc::GetMSB(ViewMask) + 1;
+        for (Uint32 view = 0; view < ViewCount; ++view)
+        {
+            ViewInstanceLocations[view].ViewportArrayIndex     = 0;
+            ViewInstanceLocations[view].RenderTargetArrayIndex = view;
+        }
+        Stream.ViewInstancing->ViewInstanceCount       = ViewCount;
+        Stream.ViewInstancing->pViewInstanceLocations = ViewInstanceLocations;
+        Stream.ViewInstancing->Flags                   = D3D12_VIEW_INSTANCING_FLAG_NONE;
+    }
+
+    // The stream references ViewInstanceLocations and must not be copied
+    ViewInstancingGraphicsPipelineStream(const ViewInstancingGraphicsPipelineStream&) = delete;
+    ViewInstancingGraphicsPipelineStream& operator=(const ViewInstancingGraphicsPipelineStream&) = delete;
+
+    D3D12_PIPELINE_STATE_STREAM_DESC GetStreamDesc()
+    {
+        D3D12_PIPELINE_STATE_STREAM_DESC StreamDesc;
+        StreamDesc.SizeInBytes                   = sizeof(Stream);
+        StreamDesc.pPipelineStateSubobjectStream = &Stream;
+        return StreamDesc;
+    }
+};
+
 #ifdef _MSC_VER
 #    pragma warning(pop)
 #endif
 
+// Returns the multiview view mask of the render pass subpass the pipeline is used in,
+// or zero if the pipeline uses an implicit render pass.
+Uint32 GetPipelineViewMask(const GraphicsPipelineDesc& GraphicsPipeline)
+{
+    if (GraphicsPipeline.pRenderPass == nullptr)
+        return 0;
+
+    const RenderPassDesc& RPDesc = GraphicsPipeline.pRenderPass->GetDesc();
+    VERIFY_EXPR(GraphicsPipeline.SubpassIndex < RPDesc.SubpassCount);
+    return RPDesc.pSubpasses[GraphicsPipeline.SubpassIndex].ViewMask;
+}
+
+HRESULT CreateD3D12GraphicsPipeline(RenderDeviceD3D12Impl*                    pDevice,
+                                    const D3D12_GRAPHICS_PIPELINE_STATE_DESC& d3d12PSODesc,
+                                    Uint32                                    ViewMask,
+                                    CComPtr<ID3D12PipelineState>&             pd3d12PSO)
+{
+    // Note: renderdoc frame capture fails if any interface but IID_ID3D12PipelineState is requested
+    if (ViewMask == 0)
+        return pDevice->GetD3D12Device()->CreateGraphicsPipelineState(&d3d12PSODesc, __uuidof(ID3D12PipelineState), IID_PPV_ARGS_Helper(&pd3d12PSO));
+
+    ViewInstancingGraphicsPipelineStream   Stream{d3d12PSODesc, ViewMask};
+    const D3D12_PIPELINE_STATE_STREAM_DESC StreamDesc = Stream.GetStreamDesc();
+    return pDevice->GetD3D12Device2()->CreatePipelineState(&StreamDesc, __uuidof(ID3D12PipelineState), IID_PPV_ARGS_Helper(&pd3d12PSO));
+}
+
 
 class PrimitiveTopology_To_D3D12_PRIMITIVE_TOPOLOGY_TYPE
 {
@@ -118,6 +231,16 @@ private:
     std::array<D3D12_PRIMITIVE_TOPOLOGY_TYPE, PRIMITIVE_TOPOLOGY_NUM_TOPOLOGIES> m_Map;
 };
 
+D3D12_INDEX_BUFFER_STRIP_CUT_VALUE GetIBStripCutValue(PRIMITIVE_TOPOLOGY Topology)
+{
+    return (Topology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP ||
+            Topology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ ||
+            Topology == PRIMITIVE_TOPOLOGY_LINE_STRIP ||
+            Topology == PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ) ?
+        D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFFFFFF :
+        D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_DISABLED;
+}
+
 void BuildRTPipelineDescription(const RayTracingPipelineStateCreateInfo& CreateInfo,
                                 std::vector<D3D12_STATE_SUBOBJECT>&      Subobjects,
                                 DynamicLinearAllocator&                  TempPool,
@@ -680,7 +803,6 @@ void PipelineStateD3D12Impl::InitializePipeline(const GraphicsPipelineStateCreat
     TShaderStages ShaderStages;
     InitInternalObjects(CreateInfo, ShaderStages);
 
-    ID3D12Device* pd3d12Device = m_pDevice->GetD3D12Device();
     if (m_Desc.PipelineType == PIPELINE_TYPE_GRAPHICS)
     {
         const GraphicsPipelineDesc& GraphicsPipeline = m_pGraphicsPipelineData->Desc;
@@ -735,12 +857,7 @@ void PipelineStateD3D12Impl::InitializePipeline(const GraphicsPipelineStateCreat
             d3d12PSODesc.InputLayout.pInputElementDescs = nullptr;
         }
 
-        d3d12PSODesc.IBStripCutValue = (GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP ||
-                                        GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ ||
-                                        GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_LINE_STRIP ||
-                                        GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ) ?
-            D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFFFFFF :
-            D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_DISABLED;
+        d3d12PSODesc.IBStripCutValue = GetIBStripCutValue(GraphicsPipeline.PrimitiveTopology);
         static const PrimitiveTopology_To_D3D12_PRIMITIVE_TOPOLOGY_TYPE PrimTopologyToD3D12TopologyType;
         d3d12PSODesc.PrimitiveTopologyType = PrimTopologyToD3D12TopologyType[GraphicsPipeline.PrimitiveTopology];
 
@@ -765,21 +882,56 @@ void PipelineStateD3D12Impl::InitializePipeline(const GraphicsPipelineStateCreat
         // The only valid bit is D3D12_PIPELINE_STATE_FLAG_TOOL_DEBUG, which can only be set on WARP devices.
         d3d12PSODesc.Flags = D3D12_PIPELINE_STATE_FLAG_NONE;
 
+        const Uint32 ViewMask = GetPipelineViewMask(GraphicsPipeline);
+
+        const Timer CreateTimer;
+
         // Try to load from the cache
         PipelineStateCacheD3D12Impl* const pPSOCacheD3D12 = ClassPtrCast<PipelineStateCacheD3D12Impl>(CreateInfo.pPSOCache);
         if (pPSOCacheD3D12 != nullptr && !WName.empty())
-            m_pd3d12PSO = pPSOCacheD3D12->LoadGraphicsPipeline(WName.c_str(), d3d12PSODesc);
+        {
+            if (ViewMask == 0)
+            {
+                m_pd3d12PSO = pPSOCacheD3D12->LoadGraphicsPipeline(WName.c_str(), d3d12PSODesc);
+            }
+            else
+            {
+                ViewInstancingGraphicsPipelineStream   Stream{d3d12PSODesc, ViewMask};
+                const D3D12_PIPELINE_STATE_STREAM_DESC StreamDesc = Stream.GetStreamDesc();
+                m_pd3d12PSO                                       = pPSOCacheD3D12->LoadPipeline(WName.c_str(), StreamDesc);
+            }
+        }
+        const PIPELINE_CACHE_STATUS CacheStatus = m_pd3d12PSO ? PIPELINE_CACHE_STATUS_HIT : PIPELINE_CACHE_STATUS_MISS;
         if (!m_pd3d12PSO)
         {
-            // Note: renderdoc frame capture fails if any interface but IID_ID3D12PipelineState is requested
-            HRESULT hr = pd3d12Device->CreateGraphicsPipelineState(&d3d12PSODesc, __uuidof(ID3D12PipelineState), IID_PPV_ARGS_Helper(&m_pd3d12PSO));
+            CComPtr<ID3D12PipelineState> pd3d12PSO;
+            HRESULT                      hr = CreateD3D12GraphicsPipeline(m_pDevice, d3d12PSODesc, ViewMask, pd3d12PSO);
             if (FAILED(hr))
                 LOG_ERROR_AND_THROW("Failed to create pipeline state");
+            m_pd3d12PSO = pd3d12PSO.p;
 
             // Add to the cache
             if (pPSOCacheD3D12 != nullptr && !WName.empty())
                 pPSOCacheD3D12->StorePipeline(WName.c_str(), m_pd3d12PSO);
         }
+        SetCompileStats(CacheStatus, static_cast<Uint64>(CreateTimer.GetElapsedTime() * 1e+6));
+
+        if (HasExtendedDynamicState())
+        {
+            m_pDynamicStateVariants = std::make_unique<DynamicStateVariants>();
+
+            DynamicStateVariants& DSV = *m_pDynamicStateVariants;
+            // Keep the shader byte code and input layout alive so that the description
+            // can be used to create pipeline variants later.
+            for (const ShaderStageInfo& Stage : ShaderStages)
+                DSV.ByteCodes.emplace_back(Stage.ByteCodes[0]);
+            DSV.InputElements.assign(d312InputElements.begin(), d312InputElements.end());
+
+            DSV.d3d12PSODesc                                = d3d12PSODesc;
+            DSV.d3d12PSODesc.InputLayout.pInputElementDescs = !DSV.InputElements.empty() ? DSV.InputElements.data() : nullptr;
+            DSV.ViewMask                                    = ViewMask;
+            DSV.Variants.emplace(ExtendedDynamicStates{GraphicsPipeline}, static_cast<ID3D12PipelineState*>(m_pd3d12PSO.p));
+        }
     }
 #ifdef D3D12_H_HAS_MESH_SHADER
     else if (m_Desc.PipelineType == PIPELINE_TYPE_MESH)
@@ -858,11 +1010,26 @@ void PipelineStateD3D12Impl::InitializePipeline(const GraphicsPipelineStateCreat
         streamDesc.SizeInBytes                   = sizeof(d3d12PSODesc);
         streamDesc.pPipelineStateSubobjectStream = &d3d12PSODesc;
 
-        ID3D12Device2* pd3d12Device2 = m_pDevice->GetD3D12Device2();
-        // Note: renderdoc frame capture fails if any interface but IID_ID3D12PipelineState is requested
-        HRESULT hr = pd3d12Device2->CreatePipelineState(&streamDesc, __uuidof(ID3D12PipelineState), IID_PPV_ARGS_Helper(&m_pd3d12PSO));
-        if (FAILED(hr))
-            LOG_ERROR_AND_THROW("Failed to create pipeline state");
+        const Timer CreateTimer;
+
+        // Try to load from the cache
+        PipelineStateCacheD3D12Impl* const pPSOCacheD3D12 = ClassPtrCast<PipelineStateCacheD3D12Impl>(CreateInfo.pPSOCache);
+        if (pPSOCacheD3D12 != nullptr && !WName.empty())
+            m_pd3d12PSO = pPSOCacheD3D12->LoadPipeline(WName.c_str(), streamDesc);
+        const PIPELINE_CACHE_STATUS CacheStatus = m_pd3d12PSO ? PIPELINE_CACHE_STATUS_HIT : PIPELINE_CACHE_STATUS_MISS;
+        if (!m_pd3d12PSO)
+        {
+            ID3D12Device2* pd3d12Device2 = m_pDevice->GetD3D12Device2();
+            // Note: renderdoc frame capture fails if any interface but IID_ID3D12PipelineState is requested
+            HRESULT hr = pd3d12Device2->CreatePipelineState(&streamDesc, __uuidof(ID3D12PipelineState), IID_PPV_ARGS_Helper(&m_pd3d12PSO));
+            if (FAILED(hr))
+                LOG_ERROR_AND_THROW("Failed to create pipeline state");
+
+            // Add to the cache
+            if (pPSOCacheD3D12 != nullptr && !WName.empty())
+                pPSOCacheD3D12->StorePipeline(WName.c_str(), m_pd3d12PSO);
+        }
+        SetCompileStats(CacheStatus, static_cast<Uint64>(CreateTimer.GetElapsedTime() * 1e+6));
     }
 #endif // D3D12_H_HAS_MESH_SHADER
     else
@@ -904,11 +1071,14 @@ void PipelineStateD3D12Impl::InitializePipeline(const ComputePipelineStateCreate
 
     d3d12PSODesc.pRootSignature = m_RootSig->GetD3D12RootSignature();
 
+    const Timer CreateTimer;
+
     // Try to load from the cache
     const std::wstring                 WName          = WidenString(m_Desc.Name);
     PipelineStateCacheD3D12Impl* const pPSOCacheD3D12 = ClassPtrCast<PipelineStateCacheD3D12Impl>(CreateInfo.pPSOCache);
     if (pPSOCacheD3D12 != nullptr && !WName.empty())
         m_pd3d12PSO = pPSOCacheD3D12->LoadComputePipeline(WName.c_str(), d3d12PSODesc);
+    const PIPELINE_CACHE_STATUS CacheStatus = m_pd3d12PSO ? PIPELINE_CACHE_STATUS_HIT : PIPELINE_CACHE_STATUS_MISS;
     if (!m_pd3d12PSO)
     {
         // Note: renderdoc frame capture fails if any interface but IID_ID3D12PipelineState is requested
@@ -920,6 +1090,7 @@ void PipelineStateD3D12Impl::InitializePipeline(const ComputePipelineStateCreate
         if (pPSOCacheD3D12 != nullptr && !WName.empty())
             pPSOCacheD3D12->StorePipeline(WName.c_str(), m_pd3d12PSO);
     }
+    SetCompileStats(CacheStatus, static_cast<Uint64>(CreateTimer.GetElapsedTime() * 1e+6));
 
     if (!WName.empty())
     {
@@ -951,10 +1122,15 @@ void PipelineStateD3D12Impl::InitializePipeline(const RayTracingPipelineStateCre
     RTPipelineDesc.NumSubobjects           = static_cast<UINT>(Subobjects.size());
     RTPipelineDesc.pSubobjects             = Subobjects.data();
 
+    const Timer CreateTimer;
+
     HRESULT hr = pd3d12Device->CreateStateObject(&RTPipelineDesc, __uuidof(ID3D12StateObject), IID_PPV_ARGS_Helper(&m_pd3d12PSO));
     if (FAILED(hr))
         LOG_ERROR_AND_THROW("Failed to create ray tracing state object");
 
+    // State objects are not stored in the pipeline library
+    SetCompileStats(PIPELINE_CACHE_STATUS_MISS, static_cast<Uint64>(CreateTimer.GetElapsedTime() * 1e+6));
+
     // Extract shader identifiers from ray tracing pipeline and store them in ShaderHandles
     GetShaderIdentifiers(m_pd3d12PSO, CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex,
                          m_pRayTracingPipelineData->ShaderHandles, m_pRayTracingPipelineData->ShaderHandleSize);
@@ -1004,10 +1180,64 @@ PipelineStateD3D12Impl::~PipelineStateD3D12Impl()
     Destruct();
 }
 
+ID3D12PipelineState* PipelineStateD3D12Impl::GetD3D12PipelineState(const ExtendedDynamicStates& States)
+{
+    VERIFY(m_pDynamicStateVariants, "Pipeline '", m_Desc.Name, "' was not created with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE");
+    DynamicStateVariants& DSV = *m_pDynamicStateVariants;
+
+    std::lock_guard<std::mutex> Guard{DSV.Mtx};
+
+    auto it = DSV.Variants.find(States);
+    if (it != DSV.Variants.end())
+        return it->second;
+
+    const GraphicsPipelineDesc& GraphicsPipeline = m_pGraphicsPipelineData->Desc;
+
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC d3d12PSODesc = DSV.d3d12PSODesc;
+
+    RasterizerStateDesc RasterizerDesc = GraphicsPipeline.RasterizerDesc;
+    RasterizerDesc.CullMode            = States.CullMode;
+    RasterizerStateDesc_To_D3D12_RASTERIZER_DESC(RasterizerDesc, d3d12PSODesc.RasterizerState);
+
+    DepthStencilStateDesc DepthStencilDesc = GraphicsPipeline.DepthStencilDesc;
+    DepthStencilDesc.DepthEnable           = States.DepthEnable;
+    DepthStencilDesc.DepthWriteEnable      = States.DepthWriteEnable;
+    DepthStencilDesc.DepthFunc             = States.DepthFunc;
+    DepthStencilStateDesc_To_D3D12_DEPTH_STENCIL_DESC(DepthStencilDesc, d3d12PSODesc.DepthStencilState);
+
+    // Topology itself is set dynamically by IASetPrimitiveTopology, but the strip cut value is part of the pipeline.
+    VERIFY_EXPR(IsDynamicTopologyCompatible(States.Topology, GraphicsPipeline.PrimitiveTopology));
+    d3d12PSODesc.IBStripCutValue = GetIBStripCutValue(States.Topology);
+
+    CComPtr<ID3D12PipelineState> pd3d12PSO;
+
+    HRESULT hr = CreateD3D12GraphicsPipeline(m_pDevice, d3d12PSODesc, DSV.ViewMask, pd3d12PSO);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create dynamic state variant of pipeline '", m_Desc.Name, "'. The default pipeline will be used instead.");
+        return static_cast<ID3D12PipelineState*>(m_pd3d12PSO.p);
+    }
+    if (m_Desc.Name != nullptr)
+        pd3d12PSO->SetName(WidenString(m_Desc.Name).c_str());
+
+    return DSV.Variants.emplace(States, std::move(pd3d12PSO)).first->second;
+}
+
 void PipelineStateD3D12Impl::Destruct()
 {
     m_RootSig.Release();
 
+    if (m_pDynamicStateVariants)
+    {
+        for (auto& it : m_pDynamicStateVariants->Variants)
+        {
+            // The default variant is m_pd3d12PSO, which is released below
+            if (it.second.p != m_pd3d12PSO.p)
+                m_pDevice->SafeReleaseDeviceObject(std::move(it.second), m_Desc.ImmediateContextMask);
+        }
+        m_pDynamicStateVariants.reset();
+    }
+
     if (m_pd3d12PSO)
     {
         // D3D12 object can only be destroyed when it is no longer used by the GPU
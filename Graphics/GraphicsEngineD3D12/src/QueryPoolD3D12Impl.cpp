@@ -0,0 +1,64 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "QueryPoolD3D12Impl.hpp"
+
+#include "RenderDeviceD3D12Impl.hpp"
+#include "D3D12TypeConversions.hpp"
+#include "StringTools.hpp"
+
+namespace Diligent
+{
+
+QueryPoolD3D12Impl::QueryPoolD3D12Impl(IReferenceCounters*    pRefCounters,
+                                       RenderDeviceD3D12Impl* pDevice,
+                                       const QueryPoolDesc&   Desc) :
+    TQueryPoolBase{pRefCounters, pDevice, Desc},
+    m_d3d12QueryType{QueryTypeToD3D12QueryType(Desc.Type)}
+{
+    // Unlike the heaps of the query managers, pool heaps are shared by all contexts,
+    // so timestamp pools can't be used in copy queues that require a separate heap type.
+    D3D12_QUERY_HEAP_DESC d3d12HeapDesc{};
+    d3d12HeapDesc.Type  = QueryTypeToD3D12QueryHeapType(Desc.Type, D3D12HWQueueIndex_Graphics);
+    d3d12HeapDesc.Count = Desc.QueryCount;
+
+    HRESULT hr = pDevice->GetD3D12Device()->CreateQueryHeap(&d3d12HeapDesc, __uuidof(m_pd3d12QueryHeap), reinterpret_cast<void**>(&m_pd3d12QueryHeap));
+    CHECK_D3D_RESULT_THROW(hr, "Failed to create D3D12 query heap");
+
+    if (m_Desc.Name != nullptr)
+        m_pd3d12QueryHeap->SetName(WidenString(m_Desc.Name).c_str());
+}
+
+QueryPoolD3D12Impl::~QueryPoolD3D12Impl()
+{
+    // The heap may still be referenced by command lists of any context
+    GetDevice()->SafeReleaseDeviceObject(std::move(m_pd3d12QueryHeap), ~Uint64{0});
+}
+
+} // namespace Diligent
@@ -44,6 +44,8 @@
 #include "DeviceContextD3D12Impl.hpp"
 #include "FenceD3D12Impl.hpp"
 #include "QueryD3D12Impl.hpp"
+#include "QueryPoolD3D12Impl.hpp"
+#include "IndirectCommandSignatureD3D12Impl.hpp"
 #include "RenderPassD3D12Impl.hpp"
 #include "FramebufferD3D12Impl.hpp"
 #include "BottomLevelASD3D12Impl.hpp"
@@ -52,11 +54,17 @@
 #include "DeviceMemoryD3D12Impl.hpp"
 #include "PipelineStateCacheD3D12Impl.hpp"
 #include "PipelineResourceSignatureD3D12Impl.hpp"
+#ifdef DILIGENT_USE_DSTORAGE
+#    include "StorageQueueD3D12Impl.hpp"
+#endif
 
 #include "EngineMemory.h"
 #include "D3D12TypeConversions.hpp"
 #include "DXGITypeConversions.hpp"
+#include "GraphicsAccessories.hpp"
 #include "QueryManagerD3D12.hpp"
+#include "FenceCompletionSchedulerD3D12.hpp"
+#include "Trace.hpp"
 
 
 namespace Diligent
@@ -154,6 +162,7 @@ RenderDeviceD3D12Impl::RenderDeviceD3D12Impl(IReferenceCounters*          pRefCo
         }(EngineCI),
     },
     m_pd3d12Device{pd3d12Device},
+    m_pDxCompiler{CreateDXCompiler(DXCompilerTarget::Direct3D12, 0, EngineCI.pDxCompilerPath, EngineCI.pDxCompilerCachePath, /*LoadAsync = */ true)},
     m_CPUDescriptorHeaps
     {
         {RawMemAllocator, *this, EngineCI.CPUDescriptorHeapAllocationSize[0], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, D3D12_DESCRIPTOR_HEAP_FLAG_NONE},
@@ -172,9 +181,17 @@ RenderDeviceD3D12Impl::RenderDeviceD3D12Impl(IReferenceCounters*          pRefCo
         {*this, D3D12_COMMAND_LIST_TYPE_COMPUTE},
         {*this, D3D12_COMMAND_LIST_TYPE_COPY}
     },
-    m_DynamicMemoryManager  {GetRawAllocator(), *this, EngineCI.NumDynamicHeapPagesToReserve, EngineCI.DynamicHeapPageSize},
+    m_DynamicMemoryManager
+    {
+        GetCategoryAllocator(MEMORY_CATEGORY_STAGING),
+        *this,
+        EngineCI.NumDynamicHeapPagesToReserve,
+        EngineCI.DynamicHeapPageSize,
+        (EngineCI.Features.GPUUploadMemory != DEVICE_FEATURE_STATE_DISABLED && AdapterInfo.Features.GPUUploadMemory != DEVICE_FEATURE_STATE_DISABLED) ?
+            Uint64{EngineCI.GPUUploadMemoryBudget} :
+            Uint64{0}
+    },
     m_MipsGenerator         {pd3d12Device},
-    m_pDxCompiler           {CreateDXCompiler(DXCompilerTarget::Direct3D12, 0, EngineCI.pDxCompilerPath)},
     m_RootSignatureAllocator{GetRawAllocator(), sizeof(RootSignatureD3D12), 128},
     m_RootSignatureCache    {*this}
 // clang-format on
@@ -277,6 +294,38 @@ RenderDeviceD3D12Impl::RenderDeviceD3D12Impl(IReferenceCounters*          pRefCo
             }
         }
 
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+        if (EngineCI.EnableEnhancedBarriers)
+        {
+            D3D12_FEATURE_DATA_D3D12_OPTIONS12 d3d12Features12{};
+            if (SUCCEEDED(m_pd3d12Device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS12, &d3d12Features12, sizeof(d3d12Features12))))
+                m_EnhancedBarriersEnabled = d3d12Features12.EnhancedBarriersSupported != FALSE;
+
+            if (!m_EnhancedBarriersEnabled)
+                LOG_INFO_MESSAGE("Enhanced barriers are not supported by the D3D12 runtime or driver. Legacy resource barriers will be used.");
+        }
+#else
+        if (EngineCI.EnableEnhancedBarriers)
+            LOG_WARNING_MESSAGE("Enhanced barriers are requested, but the engine was built with Windows SDK that does not support them. Legacy resource barriers will be used.");
+#endif
+
+        {
+            CComPtr<IDXGIFactory4> pDXGIFactory;
+            if (SUCCEEDED(CreateDXGIFactory1(__uuidof(pDXGIFactory), reinterpret_cast<void**>(static_cast<IDXGIFactory4**>(&pDXGIFactory)))))
+            {
+                pDXGIFactory->EnumAdapterByLuid(m_pd3d12Device->GetAdapterLuid(), __uuidof(m_pDXGIAdapter3), reinterpret_cast<void**>(static_cast<IDXGIAdapter3**>(&m_pDXGIAdapter3)));
+            }
+        }
+
+        if (EngineCI.EnableResidencyManagement)
+        {
+            CComQIPtr<ID3D12Device1> pd3d12Device1{m_pd3d12Device};
+            if (pd3d12Device1 && m_pDXGIAdapter3)
+                m_pResidencyMgr = std::make_unique<ResidencyManagerD3D12>(*this, pd3d12Device1, m_pDXGIAdapter3);
+            else
+                LOG_WARNING_MESSAGE("Residency management requires ID3D12Device1 and IDXGIAdapter3 interfaces that are not supported by the system. Residency management will be disabled.");
+        }
+
         InitShaderCompilationThreadPool(EngineCI.pAsyncShaderCompilationThreadPool, EngineCI.NumAsyncShaderCompilationThreads);
     }
     catch (...)
@@ -298,6 +347,9 @@ CommandListManager& RenderDeviceD3D12Impl::GetCmdListManager(D3D12_COMMAND_LIST_
 
 RenderDeviceD3D12Impl::~RenderDeviceD3D12Impl()
 {
+    // Stop the thread that waits for the fence events
+    DestroyFenceCompletionScheduler();
+
     // Wait for the GPU to complete all its operations
     IdleGPU();
     ReleaseStaleResources(true);
@@ -316,6 +368,10 @@ RenderDeviceD3D12Impl::~RenderDeviceD3D12Impl()
     DEV_CHECK_ERR(m_DynamicMemoryManager.GetAllocatedPageCounter() == 0, "All allocated dynamic pages must have been returned to the manager at this point.");
     m_DynamicMemoryManager.Destroy();
 
+    // Return allocators kept by pooled contexts for reuse
+    for (auto& it : m_ContextPool)
+        it.second->ReleaseRetiredAllocators();
+
     for (CommandListManager& CmdListMngr : m_CmdListManagers)
         DEV_CHECK_ERR(CmdListMngr.GetAllocatorCounter() == 0, "All allocators must have been returned to the manager at this point.");
     DEV_CHECK_ERR(m_AllocatedCtxCounter == 0, "All contexts must have been released.");
@@ -335,6 +391,28 @@ void RenderDeviceD3D12Impl::DisposeCommandContext(PooledCommandContext&& Ctx)
     FreeCommandContext(std::move(Ctx));
 }
 
+void RenderDeviceD3D12Impl::DisposeReusableCommandContext(PooledCommandContext&&            Ctx,
+                                                          CComPtr<ID3D12CommandAllocator>&& pAllocator,
+                                                          SoftwareQueueIndex                CommandQueueId,
+                                                          Uint64                            LastFenceValue)
+{
+    CommandListManager& CmdListMngr = GetCmdListManager(CommandQueueId);
+    VERIFY_EXPR(CmdListMngr.GetCommandListType() == Ctx->GetCommandListType());
+    if (LastFenceValue != 0)
+        Ctx->RetireAllocator(std::move(pAllocator), CommandQueueId, LastFenceValue, CmdListMngr);
+    else
+        CmdListMngr.FreeAllocator(std::move(pAllocator));
+    FreeCommandContext(std::move(Ctx));
+}
+
+Uint64 RenderDeviceD3D12Impl::ExecuteClosedCommandList(SoftwareQueueIndex CommandQueueId, ID3D12CommandList* pd3d12CmdList)
+{
+    VERIFY_EXPR(pd3d12CmdList != nullptr);
+    const SubmittedCommandBufferInfo SubmittedCmdBuffInfo = TRenderDeviceBase::SubmitCommandBuffer(CommandQueueId, true, 1, &pd3d12CmdList);
+    PurgeReleaseQueue(CommandQueueId);
+    return SubmittedCmdBuffInfo.FenceValue;
+}
+
 void RenderDeviceD3D12Impl::FreeCommandContext(PooledCommandContext&& Ctx)
 {
     const D3D12_COMMAND_LIST_TYPE CmdListType = Ctx->GetCommandListType();
@@ -361,7 +439,7 @@ void RenderDeviceD3D12Impl::CloseAndExecuteTransientCommandContext(SoftwareQueue
                        {
                            FenceValue = pCmdQueue->Submit(1, &pCmdList);
                        });
-    CmdListMngr.ReleaseAllocator(std::move(pAllocator), CommandQueueId, FenceValue);
+    Ctx->RetireAllocator(std::move(pAllocator), CommandQueueId, FenceValue, CmdListMngr);
     FreeCommandContext(std::move(Ctx));
 }
 
@@ -421,7 +499,7 @@ Uint64 RenderDeviceD3D12Impl::CloseAndExecuteCommandContexts(SoftwareQueueIndex
 
     for (Uint32 i = 0; i < NumContexts; ++i)
     {
-        CmdListMngr.ReleaseAllocator(std::move(CmdAllocators[i]), CommandQueueId, FenceValue);
+        pContexts[i]->RetireAllocator(std::move(CmdAllocators[i]), CommandQueueId, FenceValue, CmdListMngr);
         FreeCommandContext(std::move(pContexts[i]));
     }
 
@@ -469,7 +547,46 @@ void RenderDeviceD3D12Impl::FlushStaleResources(SoftwareQueueIndex CommandQueueI
 
 void RenderDeviceD3D12Impl::ReleaseStaleResources(bool ForceRelease)
 {
-    PurgeReleaseQueues(ForceRelease);
+    DILIGENT_TRACE_SCOPE("ReleaseStaleResources");
+
+    if (ForceRelease)
+        PurgeReleaseQueues(/*ForceRelease = */ true);
+    else
+        PurgeReleaseQueuesWithBudget();
+
+    if (m_pResidencyMgr && !ForceRelease)
+        m_pResidencyMgr->Update();
+
+    DILIGENT_TRACE_COUNTER("D3D12 Dynamic Heap Size", m_DynamicMemoryManager.GetTotalPageSize());
+}
+
+void RenderDeviceD3D12Impl::SetResidencyPriority(D3D12ResourceBase& Resource, D3D12_RESIDENCY_PRIORITY Priority)
+{
+    ResidencyObjectD3D12& ResidencyObj = Resource.GetResidencyObject();
+    if (ResidencyObj.IsManaged())
+    {
+        VERIFY_EXPR(m_pResidencyMgr);
+        m_pResidencyMgr->SetPriority(ResidencyObj, Priority);
+    }
+    else if (ID3D12Resource* pd3d12Resource = Resource.GetD3D12Resource())
+    {
+        // Let the OS use the priority when it makes residency decisions
+        if (CComQIPtr<ID3D12Device1> pd3d12Device1{m_pd3d12Device})
+        {
+            ID3D12Pageable* pPageable = pd3d12Resource;
+            if (FAILED(pd3d12Device1->SetResidencyPriority(1, &pPageable, &Priority)))
+                LOG_ERROR_MESSAGE("Failed to set residency priority");
+        }
+    }
+}
+
+void RenderDeviceD3D12Impl::RegisterResidencyObject(D3D12ResourceBase& Resource, const D3D12_RESOURCE_DESC& d3d12Desc)
+{
+    if (!m_pResidencyMgr)
+        return;
+
+    const D3D12_RESOURCE_ALLOCATION_INFO AllocInfo = m_pd3d12Device->GetResourceAllocationInfo(0, 1, &d3d12Desc);
+    m_pResidencyMgr->RegisterObject(Resource.GetResidencyObject(), Resource.GetD3D12Resource(), AllocInfo.SizeInBytes);
 }
 
 
@@ -503,6 +620,16 @@ RenderDeviceD3D12Impl::PooledCommandContext RenderDeviceD3D12Impl::AllocateComma
     return PooledCommandContext(pCtx, CmdCtxAllocator);
 }
 
+std::unique_ptr<FenceCompletionScheduler> RenderDeviceD3D12Impl::CreateFenceCompletionScheduler()
+{
+    // All pending fences can be waited for at once (Windows 10 1709+)
+    if (CComQIPtr<ID3D12Device1> pd3d12Device1{m_pd3d12Device})
+        return std::make_unique<FenceCompletionSchedulerD3D12>(pd3d12Device1);
+
+    // Fences are thread-safe, so the worker thread can poll them
+    return std::make_unique<FenceCompletionScheduler>(/*UseWorkerThread = */ true);
+}
+
 void RenderDeviceD3D12Impl::TestTextureFormat(TEXTURE_FORMAT TexFormat)
 {
     TextureFormatInfoExt& TexFormatInfo = m_TextureFormatsInfo[TexFormat];
@@ -632,6 +759,26 @@ void RenderDeviceD3D12Impl::CreateQuery(const QueryDesc& Desc, IQuery** ppQuery)
     CreateQueryImpl(ppQuery, Desc);
 }
 
+void RenderDeviceD3D12Impl::CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool)
+{
+    CreateDeviceObject("Query Pool", Desc, ppQueryPool,
+                       [&]() //
+                       {
+                           QueryPoolD3D12Impl* pQueryPoolD3D12 = NEW_RC_OBJ(GetRawAllocator(), "QueryPoolD3D12Impl instance", QueryPoolD3D12Impl)(this, Desc);
+                           pQueryPoolD3D12->QueryInterface(IID_QueryPool, reinterpret_cast<IObject**>(ppQueryPool));
+                       });
+}
+
+void RenderDeviceD3D12Impl::CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc, IIndirectCommandSignature** ppSignature)
+{
+    CreateDeviceObject("Indirect Command Signature", Desc, ppSignature,
+                       [&]() //
+                       {
+                           IndirectCommandSignatureD3D12Impl* pSignatureD3D12 = NEW_RC_OBJ(GetRawAllocator(), "IndirectCommandSignatureD3D12Impl instance", IndirectCommandSignatureD3D12Impl)(this, Desc);
+                           pSignatureD3D12->QueryInterface(IID_IndirectCommandSignature, reinterpret_cast<IObject**>(ppSignature));
+                       });
+}
+
 void RenderDeviceD3D12Impl::CreateRenderPass(const RenderPassDesc& Desc, IRenderPass** ppRenderPass)
 {
     CreateRenderPassImpl(ppRenderPass, Desc);
@@ -664,6 +811,31 @@ void RenderDeviceD3D12Impl::CreateTLASFromD3DResource(ID3D12Resource*       pd3d
     CreateTLASImpl(ppTLAS, Desc, InitialState, pd3d12TLAS);
 }
 
+void RenderDeviceD3D12Impl::CreateStorageQueue(const StorageQueueCreateInfoD3D12& CreateInfo,
+                                               IStorageQueueD3D12**               ppStorageQueue)
+{
+    DEV_CHECK_ERR(ppStorageQueue != nullptr, "ppStorageQueue must not be null");
+    if (ppStorageQueue == nullptr)
+        return;
+
+    *ppStorageQueue = nullptr;
+#ifdef DILIGENT_USE_DSTORAGE
+    try
+    {
+        StorageQueueD3D12Impl* pStorageQueue = NEW_RC_OBJ(GetRawAllocator(), "StorageQueueD3D12Impl instance", StorageQueueD3D12Impl)(this, CreateInfo);
+        pStorageQueue->QueryInterface(IID_StorageQueueD3D12, reinterpret_cast<IObject**>(ppStorageQueue));
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to create storage queue '", (CreateInfo.Name != nullptr ? CreateInfo.Name : ""), "'");
+    }
+#else
+    (void)CreateInfo;
+    LOG_ERROR_MESSAGE("DirectStorage is not supported: the engine has been built without DirectStorage SDK. "
+                      "Enable DILIGENT_LOAD_DIRECT_STORAGE CMake option to add DirectStorage support.");
+#endif
+}
+
 void RenderDeviceD3D12Impl::CreateTLAS(const TopLevelASDesc& Desc,
                                        ITopLevelAS**         ppTLAS)
 {
@@ -721,6 +893,16 @@ void RenderDeviceD3D12Impl::CreateDeviceMemory(const DeviceMemoryCreateInfo& Cre
     CreateDeviceMemoryImpl(ppMemory, CreateInfo);
 }
 
+void RenderDeviceD3D12Impl::CreatePlacedTexture(const TextureDesc& TexDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, ITexture** ppTexture)
+{
+    CreateTextureImpl(ppTexture, TexDesc, pMemory, MemoryOffset);
+}
+
+void RenderDeviceD3D12Impl::CreatePlacedBuffer(const BufferDesc& BuffDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, IBuffer** ppBuffer)
+{
+    CreateBufferImpl(ppBuffer, BuffDesc, pMemory, MemoryOffset);
+}
+
 void RenderDeviceD3D12Impl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                      IPipelineStateCache**               ppPipelineStateCache)
 {
@@ -755,4 +937,64 @@ SparseTextureFormatInfo RenderDeviceD3D12Impl::GetSparseTextureFormatInfo(TEXTUR
     return TRenderDeviceBase::GetSparseTextureFormatInfo(TexFormat, Dimension, SampleCount);
 }
 
+ResourceMemoryRequirements RenderDeviceD3D12Impl::GetTextureMemoryRequirements(const TextureDesc& TexDesc) const
+{
+    if (!m_AdapterInfo.Memory.PlacedResources)
+        return {};
+
+    TextureDesc Desc = TexDesc;
+    if (Desc.MipLevels == 0)
+    {
+        Desc.MipLevels = Desc.Is3D() ?
+            ComputeMipLevelsCount(Desc.Width, Desc.Height, Desc.Depth) :
+            ComputeMipLevelsCount(Desc.Width, Desc.Is1D() ? 1 : Desc.Height);
+    }
+
+    const D3D12_RESOURCE_DESC            d3d12TexDesc   = TextureD3D12Impl::GetD3D12TextureDesc(Desc);
+    const D3D12_RESOURCE_ALLOCATION_INFO d3d12AllocInfo = m_pd3d12Device->GetResourceAllocationInfo(0, 1, &d3d12TexDesc);
+    if (d3d12AllocInfo.SizeInBytes == ~UINT64{0})
+        return {};
+
+    return {d3d12AllocInfo.SizeInBytes, d3d12AllocInfo.Alignment};
+}
+
+ResourceMemoryRequirements RenderDeviceD3D12Impl::GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const
+{
+    if (!m_AdapterInfo.Memory.PlacedResources)
+        return {};
+
+    BufferDesc Desc = BuffDesc;
+    Desc.Size       = BufferD3D12Impl::GetD3D12BufferSize(Desc);
+
+    const D3D12_RESOURCE_DESC            d3d12BuffDesc  = BufferD3D12Impl::GetD3D12BufferDesc(Desc);
+    const D3D12_RESOURCE_ALLOCATION_INFO d3d12AllocInfo = m_pd3d12Device->GetResourceAllocationInfo(0, 1, &d3d12BuffDesc);
+    if (d3d12AllocInfo.SizeInBytes == ~UINT64{0})
+        return {};
+
+    return {d3d12AllocInfo.SizeInBytes, d3d12AllocInfo.Alignment};
+}
+
+void RenderDeviceD3D12Impl::GetMemoryUsage(MemoryUsageD3D12& Usage) const
+{
+    Usage = {};
+
+    if (m_pDXGIAdapter3)
+    {
+        DXGI_QUERY_VIDEO_MEMORY_INFO MemInfo{};
+        if (SUCCEEDED(m_pDXGIAdapter3->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &MemInfo)))
+        {
+            Usage.LocalBudget = MemInfo.Budget;
+            Usage.LocalUsage  = MemInfo.CurrentUsage;
+        }
+        if (SUCCEEDED(m_pDXGIAdapter3->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL, &MemInfo)))
+        {
+            Usage.NonLocalBudget = MemInfo.Budget;
+            Usage.NonLocalUsage  = MemInfo.CurrentUsage;
+        }
+    }
+
+    Usage.DynamicHeapSize     = m_DynamicMemoryManager.GetTotalPageSize();
+    Usage.PeakDynamicHeapSize = m_DynamicMemoryManager.GetPeakTotalPageSize();
+}
+
 } // namespace Diligent
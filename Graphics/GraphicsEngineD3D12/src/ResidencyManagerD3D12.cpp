@@ -0,0 +1,211 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "ResidencyManagerD3D12.hpp"
+
+#include <algorithm>
+
+#include "RenderDeviceD3D12Impl.hpp"
+
+namespace Diligent
+{
+
+ResidencyObjectD3D12::~ResidencyObjectD3D12()
+{
+    if (m_pManager != nullptr)
+        m_pManager->UnregisterObject(*this);
+}
+
+ResidencyManagerD3D12::ResidencyManagerD3D12(RenderDeviceD3D12Impl& DeviceD3D12Impl, ID3D12Device1* pd3d12Device1, IDXGIAdapter3* pAdapter) :
+    m_DeviceD3D12Impl{DeviceD3D12Impl},
+    m_pAdapter{pAdapter},
+    m_pd3d12Device1{pd3d12Device1}
+{
+    VERIFY_EXPR(m_pAdapter != nullptr && m_pd3d12Device1 != nullptr);
+}
+
+ResidencyManagerD3D12::~ResidencyManagerD3D12()
+{
+    VERIFY(m_Objects.empty(), "All objects must be unregistered before the residency manager is destroyed");
+}
+
+void ResidencyManagerD3D12::RegisterObject(ResidencyObjectD3D12& Obj, ID3D12Pageable* pPageable, Uint64 Size)
+{
+    VERIFY(Obj.m_pManager == nullptr, "The object is already registered");
+    VERIFY_EXPR(pPageable != nullptr);
+
+    Obj.m_pPageable = pPageable;
+    Obj.m_Size      = Size;
+    Obj.m_LastUsedFrame.store(GetCurrentFrame());
+    Obj.m_IsResident.store(true);
+
+    std::lock_guard<std::mutex> Lock{m_ObjectsMtx};
+
+    Obj.m_pManager = this;
+    Obj.m_Index    = m_Objects.size();
+    m_Objects.push_back(&Obj);
+}
+
+void ResidencyManagerD3D12::UnregisterObject(ResidencyObjectD3D12& Obj)
+{
+    std::lock_guard<std::mutex> Lock{m_ObjectsMtx};
+
+    VERIFY_EXPR(Obj.m_Index < m_Objects.size() && m_Objects[Obj.m_Index] == &Obj);
+    // Move the last object to the place of the removed one
+    m_Objects[Obj.m_Index]          = m_Objects.back();
+    m_Objects[Obj.m_Index]->m_Index = Obj.m_Index;
+    m_Objects.pop_back();
+
+    // Note that the object may be released while it is evicted. This is not an error.
+    Obj.m_pManager  = nullptr;
+    Obj.m_pPageable = nullptr;
+    Obj.m_Index     = ~size_t{0};
+}
+
+void ResidencyManagerD3D12::SetPriority(ResidencyObjectD3D12& Obj, D3D12_RESIDENCY_PRIORITY Priority)
+{
+    std::lock_guard<std::mutex> Lock{m_ObjectsMtx};
+
+    Obj.m_Priority = Priority;
+
+    ID3D12Pageable* pPageable = Obj.m_pPageable;
+    if (FAILED(m_pd3d12Device1->SetResidencyPriority(1, &pPageable, &Priority)))
+        LOG_ERROR_MESSAGE("Failed to set residency priority");
+}
+
+void ResidencyManagerD3D12::MakeResident(ResidencyObjectD3D12& Obj)
+{
+    std::lock_guard<std::mutex> Lock{m_ObjectsMtx};
+
+    // Another thread may have already made the object resident,
+    // or the manager may have cancelled the eviction.
+    if (Obj.m_IsResident.load())
+        return;
+
+    // MakeResident blocks until the object is resident
+    ID3D12Pageable* pPageable = Obj.m_pPageable;
+    if (FAILED(m_pd3d12Device1->MakeResident(1, &pPageable)))
+    {
+        LOG_ERROR_MESSAGE("Failed to make the object resident. The application may be exceeding the video memory budget");
+        return;
+    }
+    Obj.m_IsResident.store(true);
+}
+
+void ResidencyManagerD3D12::Update()
+{
+    const Uint64 EndedFrame = m_CurrentFrame.fetch_add(1);
+
+    std::lock_guard<std::mutex> Lock{m_ObjectsMtx};
+
+    const Uint32 NumQueues = static_cast<Uint32>(m_DeviceD3D12Impl.GetCommandQueueCount());
+
+    // Command lists recorded in one frame may be submitted in the next one, so objects last used in
+    // frame N are no longer used by the GPU once the fences submitted by the end of frame N + 1 have completed.
+    {
+        FrameFences Fences;
+        Fences.Frame = EndedFrame;
+        Fences.Fences.resize(NumQueues);
+        for (Uint32 q = 0; q < NumQueues; ++q)
+            Fences.Fences[q] = m_DeviceD3D12Impl.GetNextFenceValue(SoftwareQueueIndex{q}) - 1;
+        m_PendingFrames.emplace_back(std::move(Fences));
+    }
+
+    while (!m_PendingFrames.empty())
+    {
+        const FrameFences& Oldest = m_PendingFrames.front();
+
+        bool Completed = true;
+        for (Uint32 q = 0; q < NumQueues && Completed; ++q)
+            Completed = m_DeviceD3D12Impl.GetCompletedFenceValue(SoftwareQueueIndex{q}) >= Oldest.Fences[q];
+        if (!Completed)
+            break;
+
+        m_LastCompletedFrame = Oldest.Frame - 1;
+        m_PendingFrames.pop_front();
+    }
+
+    DXGI_QUERY_VIDEO_MEMORY_INFO MemInfo{};
+    if (FAILED(m_pAdapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &MemInfo)))
+    {
+        LOG_ERROR_MESSAGE("Failed to query video memory info");
+        return;
+    }
+
+    if (MemInfo.CurrentUsage <= MemInfo.Budget)
+        return;
+
+    Uint64 BytesToEvict = MemInfo.CurrentUsage - MemInfo.Budget;
+
+    std::vector<ResidencyObjectD3D12*> Candidates;
+    for (ResidencyObjectD3D12* pObj : m_Objects)
+    {
+        if (pObj->m_IsResident.load() &&
+            pObj->m_LastUsedFrame.load() <= m_LastCompletedFrame &&
+            pObj->m_Priority < D3D12_RESIDENCY_PRIORITY_MAXIMUM)
+        {
+            Candidates.push_back(pObj);
+        }
+    }
+
+    // Evict objects with the lowest priority first, least recently used ones within the same priority
+    std::sort(Candidates.begin(), Candidates.end(),
+              [](const ResidencyObjectD3D12* pObj0, const ResidencyObjectD3D12* pObj1) {
+                  if (pObj0->m_Priority != pObj1->m_Priority)
+                      return pObj0->m_Priority < pObj1->m_Priority;
+                  return pObj0->m_LastUsedFrame.load() < pObj1->m_LastUsedFrame.load();
+              });
+
+    std::vector<ID3D12Pageable*> EvictedObjects;
+    for (ResidencyObjectD3D12* pObj : Candidates)
+    {
+        if (BytesToEvict == 0)
+            break;
+
+        // See ResidencyObjectD3D12::MarkUsed()
+        pObj->m_IsResident.store(false);
+        if (pObj->m_LastUsedFrame.load() > m_LastCompletedFrame)
+        {
+            // The object has just been referenced by a command list
+            pObj->m_IsResident.store(true);
+            continue;
+        }
+
+        EvictedObjects.push_back(pObj->m_pPageable);
+        BytesToEvict -= std::min(BytesToEvict, pObj->m_Size);
+    }
+
+    if (!EvictedObjects.empty())
+    {
+        if (FAILED(m_pd3d12Device1->Evict(static_cast<UINT>(EvictedObjects.size()), EvictedObjects.data())))
+            LOG_ERROR_MESSAGE("Failed to evict ", EvictedObjects.size(), " objects");
+    }
+}
+
+} // namespace Diligent
@@ -248,13 +248,17 @@ RootParameter& RootParamsBuilder::AddRootView(D3D12_ROOT_PARAMETER_TYPE Paramete
                                               UINT                      Register,
                                               UINT                      RegisterSpace,
                                               D3D12_SHADER_VISIBILITY   Visibility,
-                                              ROOT_PARAMETER_GROUP      Group)
+                                              ROOT_PARAMETER_GROUP      Group,
+                                              UINT                      Num32BitValues)
 {
 #ifdef DILIGENT_DEBUG
     VERIFY((ParameterType == D3D12_ROOT_PARAMETER_TYPE_CBV ||
             ParameterType == D3D12_ROOT_PARAMETER_TYPE_SRV ||
-            ParameterType == D3D12_ROOT_PARAMETER_TYPE_UAV),
-           "Unexpected parameter type SBV, SRV or UAV is expected");
+            ParameterType == D3D12_ROOT_PARAMETER_TYPE_UAV ||
+            ParameterType == D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS),
+           "Unexpected parameter type: CBV, SRV, UAV or 32-bit constants are expected");
+    VERIFY((ParameterType == D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS) == (Num32BitValues != 0),
+           "Number of 32-bit values must be non-zero only for root constants");
 
     for (const RootTableData& RootTbl : m_RootTables)
         VERIFY(RootTbl.RootIndex != RootIndex, "Index ", RootIndex, " is already used by another root table");
@@ -263,8 +267,17 @@ RootParameter& RootParamsBuilder::AddRootView(D3D12_ROOT_PARAMETER_TYPE Paramete
 #endif
 
     D3D12_ROOT_PARAMETER d3d12RootParam{ParameterType, {}, Visibility};
-    d3d12RootParam.Descriptor.ShaderRegister = Register;
-    d3d12RootParam.Descriptor.RegisterSpace  = RegisterSpace;
+    if (ParameterType == D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS)
+    {
+        d3d12RootParam.Constants.ShaderRegister = Register;
+        d3d12RootParam.Constants.RegisterSpace  = RegisterSpace;
+        d3d12RootParam.Constants.Num32BitValues = Num32BitValues;
+    }
+    else
+    {
+        d3d12RootParam.Descriptor.ShaderRegister = Register;
+        d3d12RootParam.Descriptor.RegisterSpace  = RegisterSpace;
+    }
     m_RootViews.emplace_back(RootIndex, Group, d3d12RootParam);
 
     return m_RootViews.back();
@@ -345,6 +358,15 @@ void RootParamsBuilder::AllocateResourceSlot(SHADER_TYPE                   Shade
         // Add new root view to existing root parameters
         AddRootView(RootParameterType, RootIndex, Register, Space, ShaderVisibility, ParameterGroup);
     }
+    else if (RootParameterType == D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS)
+    {
+        VERIFY(ArraySize > 0, "The number of root constants must not be zero");
+
+        // Root constants are stored directly in the root signature
+        OffsetFromTableStart = 0;
+
+        AddRootView(RootParameterType, RootIndex, Register, Space, ShaderVisibility, ParameterGroup, ArraySize);
+    }
     else if (RootParameterType == D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
     {
         const bool IsSampler = (RangeType == D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER);
@@ -480,8 +502,9 @@ void RootParamsBuilder::InitializeMgr(IMemoryAllocator& MemAllocator, RootParams
         const D3D12_ROOT_PARAMETER& d3d12RootParam = SrcView.d3d12RootParam;
         VERIFY((d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_CBV ||
                 d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_SRV ||
-                d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_UAV),
-               "Unexpected parameter type: SBV, SRV or UAV is expected");
+                d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_UAV ||
+                d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS),
+               "Unexpected parameter type: CBV, SRV, UAV or 32-bit constants are expected");
         new (pRootViews + rv) RootParameter{SrcView.RootIndex, SrcView.Group, d3d12RootParam};
     }
     ParamsMgr.m_pRootTables = NumRootTables != 0 ? pRootTables : nullptr;
@@ -116,8 +116,8 @@ ShaderD3D12Impl::ShaderD3D12Impl(IReferenceCounters*     pRefCounters,
         IsDeviceInternal,
         GetD3D12ShaderModel(ShaderCI, D3D12ShaderCI.pDXCompiler, D3D12ShaderCI.MaxShaderVersion),
         [pDXCompiler      = D3D12ShaderCI.pDXCompiler,
-         LoadCBReflection = ShaderCI.LoadConstantBufferReflection](const ShaderDesc& Desc, IDataBlob* pShaderByteCode) {
-            IMemoryAllocator&     Allocator  = GetRawAllocator();
+         LoadCBReflection = ShaderCI.LoadConstantBufferReflection](const ShaderDesc& Desc, IDataBlob* pShaderByteCode, const D3DShaderArchiveData* pArchiveData) {
+            IMemoryAllocator&     Allocator  = GetRawAllocator(MEMORY_CATEGORY_SHADER_CACHE);
             ShaderResourcesD3D12* pRawMem    = ALLOCATE(Allocator, "Allocator for ShaderResources", ShaderResourcesD3D12, 1);
             ShaderResourcesD3D12* pResources = new (pRawMem) ShaderResourcesD3D12 //
                 {
@@ -126,6 +126,7 @@ ShaderD3D12Impl::ShaderD3D12Impl(IReferenceCounters*     pRefCounters,
                     Desc.UseCombinedTextureSamplers ? Desc.CombinedSamplerSuffix : nullptr,
                     pDXCompiler,
                     LoadCBReflection,
+                    pArchiveData,
                 };
             return std::shared_ptr<const ShaderResourcesD3D12>{pResources, STDDeleterRawMem<ShaderResourcesD3D12>(Allocator)};
         },
@@ -207,7 +207,8 @@ void ShaderResourceCacheD3D12::Initialize(IMemoryAllocator&        MemAllocator,
         VERIFY_EXPR(RootView.TableOffsetInGroupAllocation == RootParameter::InvalidTableOffsetInGroupAllocation);
         VERIFY_EXPR((RootView.d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_CBV ||
                      RootView.d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_SRV ||
-                     RootView.d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_UAV));
+                     RootView.d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_UAV ||
+                     RootView.d3d12RootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS));
 
         new (&GetRootTable(RootView.RootIndex)) RootTable{
             1,
@@ -370,6 +371,8 @@ const ShaderResourceCacheD3D12::Resource& ShaderResourceCacheD3D12::SetResource(
     DstRes.BufferDynamicOffset = 0;
 
     UpdateRevision();
+    m_Revision                 = GenerateRevision();
+    m_StateTransitionsRequired = true;
 
     return DstRes;
 }
@@ -386,10 +389,11 @@ void ShaderResourceCacheD3D12::SetBufferDynamicOffset(Uint32 RootIndex,
     Res.BufferDynamicOffset = BufferDynamicOffset;
 }
 
-const ShaderResourceCacheD3D12::Resource& ShaderResourceCacheD3D12::CopyResource(ID3D12Device*   pd3d12Device,
-                                                                                 Uint32          RootIndex,
-                                                                                 Uint32          OffsetFromTableStart,
-                                                                                 const Resource& SrcRes)
+const ShaderResourceCacheD3D12::Resource& ShaderResourceCacheD3D12::CopyResource(ID3D12Device*        pd3d12Device,
+                                                                                 Uint32               RootIndex,
+                                                                                 Uint32               OffsetFromTableStart,
+                                                                                 const Resource&      SrcRes,
+                                                                                 DescriptorCopyBatch* pCopyBatch)
 {
     const Resource& DstRes = SetResource(RootIndex, OffsetFromTableStart, Resource{SrcRes});
 
@@ -404,7 +408,10 @@ const ShaderResourceCacheD3D12::Resource& ShaderResourceCacheD3D12::CopyResource
                 HeapType, ROOT_PARAMETER_GROUP_STATIC_MUTABLE, RootIndex, OffsetFromTableStart);
             if (DstRes.CPUDescriptorHandle.ptr != 0)
             {
-                pd3d12Device->CopyDescriptorsSimple(1, DstDescrHandle, SrcRes.CPUDescriptorHandle, HeapType);
+                if (pCopyBatch != nullptr)
+                    pCopyBatch->Add(HeapType, DstDescrHandle, SrcRes.CPUDescriptorHandle);
+                else
+                    pd3d12Device->CopyDescriptorsSimple(1, DstDescrHandle, SrcRes.CPUDescriptorHandle, HeapType);
             }
             else
             {
@@ -420,6 +427,32 @@ const ShaderResourceCacheD3D12::Resource& ShaderResourceCacheD3D12::CopyResource
     return DstRes;
 }
 
+void ShaderResourceCacheD3D12::DescriptorCopyBatch::Flush(ID3D12Device* pd3d12Device)
+{
+    for (Uint32 heap_type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV; heap_type < D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1; ++heap_type)
+    {
+        std::vector<D3D12_CPU_DESCRIPTOR_HANDLE>& DstHandles = m_DstHandles[heap_type];
+        std::vector<D3D12_CPU_DESCRIPTOR_HANDLE>& SrcHandles = m_SrcHandles[heap_type];
+        VERIFY_EXPR(DstHandles.size() == SrcHandles.size());
+        if (DstHandles.empty())
+            continue;
+
+        // Null range sizes indicate that every range contains exactly one descriptor
+        const UINT NumDescriptors = static_cast<UINT>(DstHandles.size());
+        pd3d12Device->CopyDescriptors(NumDescriptors, DstHandles.data(), nullptr,
+                                      NumDescriptors, SrcHandles.data(), nullptr,
+                                      static_cast<D3D12_DESCRIPTOR_HEAP_TYPE>(heap_type));
+        DstHandles.clear();
+        SrcHandles.clear();
+    }
+}
+
+Uint64 ShaderResourceCacheD3D12::GenerateRevision()
+{
+    static std::atomic<Uint64> RevisionCounter{0};
+    return RevisionCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
 
 #ifdef DILIGENT_DEBUG
 void ShaderResourceCacheD3D12::DbgValidateDynamicBuffersMask() const
@@ -524,7 +557,7 @@ void ShaderResourceCacheD3D12::Resource::TransitionResource(CommandContext& Ctx)
         {
             TextureViewD3D12Impl* pTexViewD3D12    = pObject.RawPtr<TextureViewD3D12Impl>();
             TextureD3D12Impl*     pTexToTransition = pTexViewD3D12->GetTexture<TextureD3D12Impl>();
-            if (pTexToTransition->IsInKnownState() && !pTexToTransition->CheckAnyState(RESOURCE_STATE_SHADER_RESOURCE | RESOURCE_STATE_INPUT_ATTACHMENT))
+            if (pTexToTransition->IsInKnownState() && !pTexToTransition->IsInConstantState() && !pTexToTransition->CheckAnyState(RESOURCE_STATE_SHADER_RESOURCE | RESOURCE_STATE_INPUT_ATTACHMENT))
                 Ctx.TransitionResource(*pTexToTransition, RESOURCE_STATE_SHADER_RESOURCE);
         }
         break;
@@ -684,6 +717,10 @@ void ShaderResourceCacheD3D12::Resource::DvpVerifyResourceState()
 
 void ShaderResourceCacheD3D12::TransitionResourceStates(CommandContext& Ctx, StateTransitionMode Mode)
 {
+    if (!m_StateTransitionsRequired)
+        return;
+
+    bool StateTransitionsRequired = false;
     for (Uint32 r = 0; r < m_TotalResourceCount; ++r)
     {
         Resource& Res = GetResource(r);
@@ -702,6 +739,47 @@ void ShaderResourceCacheD3D12::TransitionResourceStates(CommandContext& Ctx, Sta
             default:
                 UNEXPECTED("Unexpected mode");
         }
+
+        if (!StateTransitionsRequired && !Res.IsNull())
+        {
+            if (Res.Type == SHADER_RESOURCE_TYPE_TEXTURE_SRV)
+                StateTransitionsRequired = !Res.pObject.RawPtr<TextureViewD3D12Impl>()->GetTexture<TextureD3D12Impl>()->IsInConstantState();
+            else
+                StateTransitionsRequired = Res.Type != SHADER_RESOURCE_TYPE_SAMPLER;
+        }
+    }
+
+    // Skip the loop until a new resource is bound
+    m_StateTransitionsRequired = StateTransitionsRequired;
+}
+
+void ShaderResourceCacheD3D12::MarkResourcesReferencedByCommandList()
+{
+    static_assert(SHADER_RESOURCE_TYPE_LAST == 8, "Please update this function to handle the new resource type");
+    for (Uint32 r = 0; r < m_TotalResourceCount; ++r)
+    {
+        Resource& Res = GetResource(r);
+        switch (Res.Type)
+        {
+            case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+                Res.pObject.RawPtr<BufferD3D12Impl>()->MarkReferencedByCommandList();
+                break;
+
+            case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+            case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+                Res.pObject.RawPtr<BufferViewD3D12Impl>()->GetBuffer<BufferD3D12Impl>()->MarkReferencedByCommandList();
+                break;
+
+            case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+            case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT:
+            case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+                Res.pObject.RawPtr<TextureViewD3D12Impl>()->GetTexture<TextureD3D12Impl>()->MarkReferencedByCommandList();
+                break;
+
+            default:
+                // Samplers and acceleration structures are not managed by the residency manager
+                break;
+        }
     }
 }
 
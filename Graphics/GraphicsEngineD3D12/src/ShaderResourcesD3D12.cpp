@@ -48,13 +48,35 @@ Uint32 GetRegisterSpace<>(const D3D12_SHADER_INPUT_BIND_DESC& BindingDesc)
     return BindingDesc.Space;
 }
 
-ShaderResourcesD3D12::ShaderResourcesD3D12(IDataBlob*        pShaderBytecode,
-                                           const ShaderDesc& ShdrDesc,
-                                           const char*       CombinedSamplerSuffix,
-                                           IDXCompiler*      pDXCompiler,
-                                           bool              LoadConstantBufferReflection) :
+ShaderResourcesD3D12::ShaderResourcesD3D12(IDataBlob*                  pShaderBytecode,
+                                           const ShaderDesc&           ShdrDesc,
+                                           const char*                 CombinedSamplerSuffix,
+                                           IDXCompiler*                pDXCompiler,
+                                           bool                        LoadConstantBufferReflection,
+                                           const D3DShaderArchiveData* pArchiveData) :
     ShaderResources{ShdrDesc.ShaderType}
 {
+    class NewResourceHandler
+    {
+    public:
+        // clang-format off
+        void OnNewCB         (const D3DShaderResourceAttribs& CBAttribs)     {}
+        void OnNewTexUAV     (const D3DShaderResourceAttribs& TexUAV)        {}
+        void OnNewBuffUAV    (const D3DShaderResourceAttribs& BuffUAV)       {}
+        void OnNewBuffSRV    (const D3DShaderResourceAttribs& BuffSRV)       {}
+        void OnNewSampler    (const D3DShaderResourceAttribs& SamplerAttribs){}
+        void OnNewTexSRV     (const D3DShaderResourceAttribs& TexAttribs)    {}
+        void OnNewAccelStruct(const D3DShaderResourceAttribs& ASAttribs)     {}
+        // clang-format on
+    };
+
+    if (pArchiveData != nullptr)
+    {
+        VERIFY(!LoadConstantBufferReflection, "Constant buffer reflection is not stored in the archive");
+        Initialize(*pArchiveData, NewResourceHandler{}, ShdrDesc.Name, CombinedSamplerSuffix);
+        return;
+    }
+
     CComPtr<ID3D12ShaderReflection> pShaderReflection;
     if (IsDXILBytecode(pShaderBytecode->GetConstDataPtr(), pShaderBytecode->GetSize()))
     {
@@ -74,19 +96,6 @@ ShaderResourcesD3D12::ShaderResourcesD3D12(IDataBlob*        pShaderBytecode,
         CHECK_D3D_RESULT_THROW(hr, "Failed to get the shader reflection");
     }
 
-    class NewResourceHandler
-    {
-    public:
-        // clang-format off
-        void OnNewCB         (const D3DShaderResourceAttribs& CBAttribs)     {}
-        void OnNewTexUAV     (const D3DShaderResourceAttribs& TexUAV)        {}
-        void OnNewBuffUAV    (const D3DShaderResourceAttribs& BuffUAV)       {}
-        void OnNewBuffSRV    (const D3DShaderResourceAttribs& BuffSRV)       {}
-        void OnNewSampler    (const D3DShaderResourceAttribs& SamplerAttribs){}
-        void OnNewTexSRV     (const D3DShaderResourceAttribs& TexAttribs)    {}
-        void OnNewAccelStruct(const D3DShaderResourceAttribs& ASAttribs)     {}
-        // clang-format on
-    };
     struct D3D12ReflectionTraits
     {
         using D3D_SHADER_DESC            = D3D12_SHADER_DESC;
@@ -0,0 +1,233 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "StorageQueueD3D12Impl.hpp"
+
+#include "RenderDeviceD3D12Impl.hpp"
+#include "BufferD3D12Impl.hpp"
+#include "TextureD3D12Impl.hpp"
+#include "FenceD3D12Impl.hpp"
+#include "GraphicsAccessories.hpp"
+#include "StringTools.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+using DStorageGetFactoryProcType = HRESULT(WINAPI*)(REFIID riid, void** ppv);
+
+// dstorage.dll is loaded on demand so that the engine does not depend on it when
+// DirectStorage is not used. The library is never unloaded as the factory is a process-wide singleton.
+DStorageGetFactoryProcType LoadDStorageGetFactory()
+{
+    static const DStorageGetFactoryProcType DStorageGetFactoryProc = []() -> DStorageGetFactoryProcType {
+        HMODULE hModule = LoadLibraryA("dstorage.dll");
+        if (hModule == NULL)
+        {
+            LOG_WARNING_MESSAGE("Failed to load dstorage.dll. DirectStorage will not be available.");
+            return nullptr;
+        }
+
+        DStorageGetFactoryProcType Proc = reinterpret_cast<DStorageGetFactoryProcType>(GetProcAddress(hModule, "DStorageGetFactory"));
+        if (Proc == nullptr)
+            LOG_WARNING_MESSAGE("Failed to find DStorageGetFactory() in dstorage.dll. DirectStorage will not be available.");
+        return Proc;
+    }();
+    return DStorageGetFactoryProc;
+}
+
+bool IsValidResourceState(RESOURCE_STATE State)
+{
+    return State == RESOURCE_STATE_UNKNOWN || State == RESOURCE_STATE_UNDEFINED || State == RESOURCE_STATE_COMMON;
+}
+
+} // namespace
+
+StorageQueueD3D12Impl::StorageQueueD3D12Impl(IReferenceCounters*                pRefCounters,
+                                             RenderDeviceD3D12Impl*             pDevice,
+                                             const StorageQueueCreateInfoD3D12& CreateInfo) :
+    TBase{pRefCounters},
+    m_pDevice{pDevice}
+{
+    DStorageGetFactoryProcType pDStorageGetFactory = LoadDStorageGetFactory();
+    if (pDStorageGetFactory == nullptr)
+        LOG_ERROR_AND_THROW("DirectStorage runtime is not available");
+
+    HRESULT hr = pDStorageGetFactory(__uuidof(m_pDStorageFactory), reinterpret_cast<void**>(static_cast<IDStorageFactory**>(&m_pDStorageFactory)));
+    CHECK_D3D_RESULT_THROW(hr, "Failed to get DirectStorage factory");
+
+    DSTORAGE_QUEUE_DESC QueueDesc{};
+    QueueDesc.SourceType = DSTORAGE_REQUEST_SOURCE_FILE;
+    QueueDesc.Capacity   = CreateInfo.Capacity != 0 ?
+        std::min(std::max(CreateInfo.Capacity, Uint16{DSTORAGE_MIN_QUEUE_CAPACITY}), Uint16{DSTORAGE_MAX_QUEUE_CAPACITY}) :
+        Uint16{DSTORAGE_MAX_QUEUE_CAPACITY};
+    QueueDesc.Priority = static_cast<DSTORAGE_PRIORITY>(std::min(std::max(CreateInfo.Priority, Int8{DSTORAGE_PRIORITY_FIRST}), Int8{DSTORAGE_PRIORITY_LAST}));
+    QueueDesc.Name     = CreateInfo.Name;
+    QueueDesc.Device   = pDevice->GetD3D12Device();
+
+    hr = m_pDStorageFactory->CreateQueue(&QueueDesc, __uuidof(m_pDStorageQueue), reinterpret_cast<void**>(static_cast<IDStorageQueue**>(&m_pDStorageQueue)));
+    CHECK_D3D_RESULT_THROW(hr, "Failed to create DirectStorage queue");
+}
+
+StorageQueueD3D12Impl::~StorageQueueD3D12Impl()
+{
+    // Close() cancels pending requests that have not been submitted yet and
+    // waits for the submitted ones.
+    if (m_pDStorageQueue)
+        m_pDStorageQueue->Close();
+    CloseFiles();
+}
+
+IDStorageFile* StorageQueueD3D12Impl::GetFile(const Char* FilePath)
+{
+    std::lock_guard<std::mutex> Lock{m_FilesMtx};
+
+    auto it = m_Files.find(FilePath);
+    if (it != m_Files.end())
+        return it->second;
+
+    CComPtr<IDStorageFile> pFile;
+
+    const std::wstring WidePath = WidenString(FilePath);
+    const HRESULT      hr       = m_pDStorageFactory->OpenFile(WidePath.c_str(), __uuidof(pFile), reinterpret_cast<void**>(static_cast<IDStorageFile**>(&pFile)));
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", FilePath, "' for DirectStorage reads");
+        return nullptr;
+    }
+
+    return m_Files.emplace(FilePath, std::move(pFile)).first->second;
+}
+
+bool StorageQueueD3D12Impl::EnqueueRead(const StorageReadRequestD3D12& Request)
+{
+#define CHECK_READ_REQUEST(Expr, ...)                                           \
+    do                                                                          \
+    {                                                                           \
+        if (!(Expr))                                                            \
+        {                                                                       \
+            LOG_ERROR_MESSAGE("Invalid storage read request: ", ##__VA_ARGS__); \
+            return false;                                                       \
+        }                                                                       \
+    } while (false)
+
+    CHECK_READ_REQUEST(Request.FilePath != nullptr && Request.FilePath[0] != '\0', "file path must not be empty");
+    CHECK_READ_REQUEST(Request.Size != 0, "size must not be zero");
+    CHECK_READ_REQUEST((Request.pDstBuffer != nullptr) != (Request.pDstTexture != nullptr), "exactly one of pDstBuffer and pDstTexture must not be null");
+    CHECK_READ_REQUEST(Request.Compression < STORAGE_COMPRESSION_D3D12_COUNT, "invalid compression format");
+    CHECK_READ_REQUEST(Request.Compression != STORAGE_COMPRESSION_D3D12_NONE || Request.UncompressedSize == 0 || Request.UncompressedSize == Request.Size,
+                       "uncompressed size (", Request.UncompressedSize, ") must be zero or equal to size (", Request.Size, ") when the data is not compressed");
+
+    const Uint32 UncompressedSize = Request.UncompressedSize != 0 ? Request.UncompressedSize : Request.Size;
+
+    DSTORAGE_REQUEST d3dRequest{};
+    d3dRequest.Options.SourceType        = DSTORAGE_REQUEST_SOURCE_FILE;
+    d3dRequest.Options.CompressionFormat = Request.Compression == STORAGE_COMPRESSION_D3D12_GDEFLATE ? DSTORAGE_COMPRESSION_FORMAT_GDEFLATE : DSTORAGE_COMPRESSION_FORMAT_NONE;
+    d3dRequest.Source.File.Offset        = Request.FileOffset;
+    d3dRequest.Source.File.Size          = Request.Size;
+    d3dRequest.UncompressedSize          = UncompressedSize;
+
+    if (Request.pDstBuffer != nullptr)
+    {
+        BufferD3D12Impl*  pBufferD3D12 = ClassPtrCast<BufferD3D12Impl>(Request.pDstBuffer);
+        const BufferDesc& BuffDesc     = pBufferD3D12->GetDesc();
+        CHECK_READ_REQUEST(BuffDesc.Usage != USAGE_DYNAMIC && BuffDesc.Usage != USAGE_STAGING,
+                           "buffer '", BuffDesc.Name, "' must not be dynamic or staging");
+        CHECK_READ_REQUEST(Request.DstBufferOffset + UncompressedSize <= BuffDesc.Size,
+                           "the range [", Request.DstBufferOffset, ", ", Request.DstBufferOffset + UncompressedSize,
+                           ") is out of bounds of buffer '", BuffDesc.Name, "' of size ", BuffDesc.Size);
+        DEV_CHECK_ERR(IsValidResourceState(pBufferD3D12->GetState()),
+                      "Buffer '", BuffDesc.Name, "' must be in COMMON state to be written by the storage queue");
+
+        d3dRequest.Options.DestinationType     = DSTORAGE_REQUEST_DESTINATION_BUFFER;
+        d3dRequest.Destination.Buffer.Resource = pBufferD3D12->GetD3D12Resource();
+        d3dRequest.Destination.Buffer.Offset   = Request.DstBufferOffset;
+        d3dRequest.Destination.Buffer.Size     = UncompressedSize;
+    }
+    else
+    {
+        TextureD3D12Impl*  pTextureD3D12 = ClassPtrCast<TextureD3D12Impl>(Request.pDstTexture);
+        const TextureDesc& TexDesc       = pTextureD3D12->GetDesc();
+        CHECK_READ_REQUEST(TexDesc.Usage != USAGE_STAGING, "texture '", TexDesc.Name, "' must not be a staging texture");
+        CHECK_READ_REQUEST(Request.DstMipLevel < TexDesc.MipLevels,
+                           "mip level ", Request.DstMipLevel, " is out of range for texture '", TexDesc.Name, "'");
+        CHECK_READ_REQUEST(Request.DstSlice < TexDesc.GetArraySize(),
+                           "array slice ", Request.DstSlice, " is out of range for texture '", TexDesc.Name, "'");
+        DEV_CHECK_ERR(IsValidResourceState(pTextureD3D12->GetState()),
+                      "Texture '", TexDesc.Name, "' must be in COMMON state to be written by the storage queue");
+
+        const MipLevelProperties MipProps = GetMipLevelProperties(TexDesc, Request.DstMipLevel);
+
+        d3dRequest.Options.DestinationType              = DSTORAGE_REQUEST_DESTINATION_TEXTURE_REGION;
+        d3dRequest.Destination.Texture.Resource         = pTextureD3D12->GetD3D12Resource();
+        d3dRequest.Destination.Texture.SubresourceIndex = D3D12CalcSubresource(Request.DstMipLevel, Request.DstSlice, 0, TexDesc.MipLevels, TexDesc.GetArraySize());
+        d3dRequest.Destination.Texture.Region           = D3D12_BOX{0, 0, 0, MipProps.StorageWidth, MipProps.StorageHeight, MipProps.Depth};
+    }
+#undef CHECK_READ_REQUEST
+
+    d3dRequest.Source.File.Source = GetFile(Request.FilePath);
+    if (d3dRequest.Source.File.Source == nullptr)
+        return false;
+
+    m_pDStorageQueue->EnqueueRequest(&d3dRequest);
+    return true;
+}
+
+void StorageQueueD3D12Impl::EnqueueSignal(IFence* pFence, Uint64 Value)
+{
+    DEV_CHECK_ERR(pFence != nullptr, "Fence must not be null");
+    FenceD3D12Impl* pFenceD3D12 = ClassPtrCast<FenceD3D12Impl>(pFence);
+    DEV_CHECK_ERR(pFenceD3D12->GetDevice() == m_pDevice.RawPtr(), "Fence '", pFenceD3D12->GetDesc().Name, "' was created by a different device");
+    pFenceD3D12->DvpSignal(Value);
+
+    m_pDStorageQueue->EnqueueSignal(pFenceD3D12->GetD3D12Fence(), Value);
+}
+
+void StorageQueueD3D12Impl::Submit()
+{
+    m_pDStorageQueue->Submit();
+}
+
+Uint32 StorageQueueD3D12Impl::GetNumFailedRequests()
+{
+    DSTORAGE_ERROR_RECORD ErrorRecord{};
+    m_pDStorageQueue->RetrieveErrorRecord(&ErrorRecord);
+    return ErrorRecord.FailureCount;
+}
+
+void StorageQueueD3D12Impl::CloseFiles()
+{
+    std::lock_guard<std::mutex> Lock{m_FilesMtx};
+    for (auto& it : m_Files)
+        it.second->Close();
+    m_Files.clear();
+}
+
+} // namespace Diligent
@@ -148,11 +148,16 @@ void SwapChainD3D12Impl::Present(Uint32 SyncInterval)
     CmdCtx.TransitionResource(*pBackBuffer, RESOURCE_STATE_PRESENT);
 
     pImmediateCtxD3D12->Flush();
+    // All command lists must be submitted before presenting
+    pImmediateCtxD3D12->SubmitBatchedCommandLists();
 
     // In contrast to MSDN sample, we wait for the frame as late as possible - right
-    // before presenting.
+    // before presenting. In low-latency mode, we wait right after presenting instead,
+    // so that the application samples input for the next frame after the wait.
     // https://docs.microsoft.com/en-us/windows/uwp/gaming/reduce-latency-with-dxgi-1-3-swap-chains#step-4-wait-before-rendering-each-frame
-    WaitForFrame();
+    const bool LowLatency = m_SwapChainDesc.LatencyMode == SWAP_CHAIN_LATENCY_MODE_LOW;
+    if (!LowLatency)
+        WaitForFrame();
 
     HRESULT hr = PresentInternal(SyncInterval);
     VERIFY(SUCCEEDED(hr), "Present failed");
@@ -164,6 +169,9 @@ void SwapChainD3D12Impl::Present(Uint32 SyncInterval)
         pDeviceD3D12->ReleaseStaleResources();
     }
 
+    if (LowLatency)
+        WaitForFrame();
+
     // A successful Present call for DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL SwapChains unbinds
     // backbuffer 0 from all GPU writeable bind points.
 }
@@ -180,11 +188,12 @@ void SwapChainD3D12Impl::UpdateSwapChain(bool CreateNew)
     if (pDeviceContext)
     {
         RenderDeviceD3D12Impl* pDeviceD3D12 = m_pRenderDevice.RawPtr<RenderDeviceD3D12Impl>();
-        pDeviceContext->Flush();
+        DeviceContextD3D12Impl* pImmediateCtxD3D12 = pDeviceContext.RawPtr<DeviceContextD3D12Impl>();
+        pImmediateCtxD3D12->Flush();
+        pImmediateCtxD3D12->SubmitBatchedCommandLists();
 
         try
         {
-            DeviceContextD3D12Impl* pImmediateCtxD3D12 = pDeviceContext.RawPtr<DeviceContextD3D12Impl>();
             bool                    RenderTargetsReset = false;
             for (Uint32 i = 0; i < m_pBackBufferRTV.size() && !RenderTargetsReset; ++i)
             {
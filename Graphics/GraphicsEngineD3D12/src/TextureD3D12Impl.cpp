@@ -32,6 +32,7 @@
 #include "RenderDeviceD3D12Impl.hpp"
 #include "DeviceContextD3D12Impl.hpp"
 #include "TextureViewD3D12Impl.hpp"
+#include "DeviceMemoryD3D12Impl.hpp"
 
 #include "D3D12TypeConversions.hpp"
 #include "DXGITypeConversions.hpp"
@@ -82,23 +83,23 @@ static DXGI_FORMAT GetClearFormat(DXGI_FORMAT Fmt, D3D12_RESOURCE_FLAGS Flags)
     return Fmt;
 }
 
-D3D12_RESOURCE_DESC TextureD3D12Impl::GetD3D12TextureDesc() const
+D3D12_RESOURCE_DESC TextureD3D12Impl::GetD3D12TextureDesc(const TextureDesc& TexDesc)
 {
     D3D12_RESOURCE_DESC Desc = {};
 
     Desc.Alignment = 0;
-    if (m_Desc.IsArray())
-        Desc.DepthOrArraySize = StaticCast<UINT16>(m_Desc.ArraySize);
-    else if (m_Desc.Is3D())
-        Desc.DepthOrArraySize = StaticCast<UINT16>(m_Desc.Depth);
+    if (TexDesc.IsArray())
+        Desc.DepthOrArraySize = StaticCast<UINT16>(TexDesc.ArraySize);
+    else if (TexDesc.Is3D())
+        Desc.DepthOrArraySize = StaticCast<UINT16>(TexDesc.Depth);
     else
         Desc.DepthOrArraySize = 1;
 
-    if (m_Desc.Is1D())
+    if (TexDesc.Is1D())
         Desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE1D;
-    else if (m_Desc.Is2D())
+    else if (TexDesc.Is2D())
         Desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
-    else if (m_Desc.Is3D())
+    else if (TexDesc.Is3D())
         Desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE3D;
     else
     {
@@ -106,31 +107,58 @@ D3D12_RESOURCE_DESC TextureD3D12Impl::GetD3D12TextureDesc() const
     }
 
     Desc.Flags = D3D12_RESOURCE_FLAG_NONE;
-    if (m_Desc.BindFlags & BIND_RENDER_TARGET)
+    if (TexDesc.BindFlags & BIND_RENDER_TARGET)
         Desc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
-    if (m_Desc.BindFlags & BIND_DEPTH_STENCIL)
+    if (TexDesc.BindFlags & BIND_DEPTH_STENCIL)
         Desc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
-    if ((m_Desc.BindFlags & BIND_UNORDERED_ACCESS) || (m_Desc.MiscFlags & MISC_TEXTURE_FLAG_GENERATE_MIPS))
+    if ((TexDesc.BindFlags & BIND_UNORDERED_ACCESS) || (TexDesc.MiscFlags & MISC_TEXTURE_FLAG_GENERATE_MIPS))
         Desc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
-    if ((m_Desc.BindFlags & (BIND_SHADER_RESOURCE | BIND_INPUT_ATTACHMENT)) == 0 && (m_Desc.BindFlags & BIND_DEPTH_STENCIL) != 0)
+    if ((TexDesc.BindFlags & (BIND_SHADER_RESOURCE | BIND_INPUT_ATTACHMENT)) == 0 && (TexDesc.BindFlags & BIND_DEPTH_STENCIL) != 0)
         Desc.Flags |= D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
 
-    DXGI_FORMAT Format = TexFormatToDXGI_Format(m_Desc.Format, m_Desc.BindFlags);
+    DXGI_FORMAT Format = TexFormatToDXGI_Format(TexDesc.Format, TexDesc.BindFlags);
     if (Format == DXGI_FORMAT_R8G8B8A8_UNORM_SRGB && (Desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS))
         Desc.Format = DXGI_FORMAT_R8G8B8A8_TYPELESS;
     else
         Desc.Format = Format;
 
-    Desc.Height             = UINT{m_Desc.Height};
+    Desc.Height             = UINT{TexDesc.Height};
     Desc.Layout             = D3D12_TEXTURE_LAYOUT_UNKNOWN;
-    Desc.MipLevels          = StaticCast<UINT16>(m_Desc.MipLevels);
-    Desc.SampleDesc.Count   = m_Desc.SampleCount;
+    Desc.MipLevels          = StaticCast<UINT16>(TexDesc.MipLevels);
+    Desc.SampleDesc.Count   = TexDesc.SampleCount;
     Desc.SampleDesc.Quality = 0;
-    Desc.Width              = UINT64{m_Desc.Width};
+    Desc.Width              = UINT64{TexDesc.Width};
 
     return Desc;
 }
 
+// Returns the optimized clear value for render targets and depth-stencil buffers, or null for other textures
+static const D3D12_CLEAR_VALUE* GetD3D12ClearValue(const TextureDesc& TexDesc, D3D12_RESOURCE_FLAGS Flags, D3D12_CLEAR_VALUE& ClearValue)
+{
+    if ((Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) == 0)
+        return nullptr;
+
+    if (TexDesc.ClearValue.Format != TEX_FORMAT_UNKNOWN)
+        ClearValue.Format = TexFormatToDXGI_Format(TexDesc.ClearValue.Format);
+    else
+    {
+        DXGI_FORMAT Format = TexFormatToDXGI_Format(TexDesc.Format, TexDesc.BindFlags);
+        ClearValue.Format  = GetClearFormat(Format, Flags);
+    }
+
+    if (Flags & D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET)
+    {
+        for (int i = 0; i < 4; ++i)
+            ClearValue.Color[i] = TexDesc.ClearValue.Color[i];
+    }
+    else if (Flags & D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)
+    {
+        ClearValue.DepthStencil.Depth   = TexDesc.ClearValue.DepthStencil.Depth;
+        ClearValue.DepthStencil.Stencil = TexDesc.ClearValue.DepthStencil.Stencil;
+    }
+    return &ClearValue;
+}
+
 TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
                                    FixedBlockMemoryAllocator& TexViewObjAllocator,
                                    RenderDeviceD3D12Impl*     pRenderDeviceD3D12,
@@ -164,30 +192,8 @@ TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
         GetSupportedD3D12ResourceStatesForCommandList(pRenderDeviceD3D12->GetCommandQueueType(CmdQueueInd)) :
         static_cast<D3D12_RESOURCE_STATES>(~0u);
 
-    D3D12_CLEAR_VALUE  ClearValue  = {};
-    D3D12_CLEAR_VALUE* pClearValue = nullptr;
-    if (d3d12TexDesc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL))
-    {
-        if (m_Desc.ClearValue.Format != TEX_FORMAT_UNKNOWN)
-            ClearValue.Format = TexFormatToDXGI_Format(m_Desc.ClearValue.Format);
-        else
-        {
-            DXGI_FORMAT Format = TexFormatToDXGI_Format(m_Desc.Format, m_Desc.BindFlags);
-            ClearValue.Format  = GetClearFormat(Format, d3d12TexDesc.Flags);
-        }
-
-        if (d3d12TexDesc.Flags & D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET)
-        {
-            for (int i = 0; i < 4; ++i)
-                ClearValue.Color[i] = m_Desc.ClearValue.Color[i];
-        }
-        else if (d3d12TexDesc.Flags & D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)
-        {
-            ClearValue.DepthStencil.Depth   = m_Desc.ClearValue.DepthStencil.Depth;
-            ClearValue.DepthStencil.Stencil = m_Desc.ClearValue.DepthStencil.Stencil;
-        }
-        pClearValue = &ClearValue;
-    }
+    D3D12_CLEAR_VALUE        ClearValue  = {};
+    const D3D12_CLEAR_VALUE* pClearValue = GetD3D12ClearValue(m_Desc, d3d12TexDesc.Flags, ClearValue);
 
     if (m_Desc.Usage == USAGE_SPARSE)
     {
@@ -238,9 +244,12 @@ TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
         // By default, committed resources and heaps are almost always zeroed upon creation.
         // CREATE_NOT_ZEROED flag allows this to be elided in some scenarios to lower the overhead
         // of creating the heap. No need to zero the resource if we initialize it.
-        const D3D12_HEAP_FLAGS d3d12HeapFlags = bInitializeTexture ?
+        D3D12_HEAP_FLAGS d3d12HeapFlags = bInitializeTexture ?
             D3D12_HEAP_FLAG_CREATE_NOT_ZEROED :
             D3D12_HEAP_FLAG_NONE;
+        // Shared heaps allow creating NT handles for the resource (see CreateSharedHandle())
+        if (m_Desc.MiscFlags & MISC_TEXTURE_FLAG_EXPORTABLE)
+            d3d12HeapFlags |= D3D12_HEAP_FLAG_SHARED;
 
         HRESULT hr = pd3d12Device->CreateCommittedResource(
             &HeapProps, d3d12HeapFlags, &d3d12TexDesc, d3d12State, pClearValue, __uuidof(m_pd3d12Resource),
@@ -251,6 +260,11 @@ TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
         if (*m_Desc.Name != 0)
             m_pd3d12Resource->SetName(WidenString(m_Desc.Name).c_str());
 
+        pRenderDeviceD3D12->RegisterResidencyObject(*this, d3d12TexDesc);
+        // Exported memory may be accessed by other APIs at any time, so it must never be evicted
+        if (m_Desc.MiscFlags & MISC_TEXTURE_FLAG_EXPORTABLE)
+            pRenderDeviceD3D12->SetResidencyPriority(*this, D3D12_RESIDENCY_PRIORITY_MAXIMUM);
+
         if (bInitializeTexture)
         {
             Uint32 ExpectedNumSubresources = Uint32{d3d12TexDesc.MipLevels} * (d3d12TexDesc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? 1 : Uint32{d3d12TexDesc.DepthOrArraySize});
@@ -368,7 +382,7 @@ TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
 
         UINT64 stagingBufferSize = 0;
         Uint32 NumSubresources   = Uint32{d3d12TexDesc.MipLevels} * (d3d12TexDesc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? 1 : Uint32{d3d12TexDesc.DepthOrArraySize});
-        m_StagingFootprints      = ALLOCATE(GetRawAllocator(), "Memory for staging footprints", D3D12_PLACED_SUBRESOURCE_FOOTPRINT, size_t{NumSubresources} + 1);
+        m_StagingFootprints      = ALLOCATE(GetRawAllocator(MEMORY_CATEGORY_STAGING), "Memory for staging footprints", D3D12_PLACED_SUBRESOURCE_FOOTPRINT, size_t{NumSubresources} + 1);
         pd3d12Device->GetCopyableFootprints(&d3d12TexDesc, 0, NumSubresources, 0, m_StagingFootprints, nullptr, nullptr, &stagingBufferSize);
         m_StagingFootprints[NumSubresources] = D3D12_PLACED_SUBRESOURCE_FOOTPRINT{stagingBufferSize, {}};
 
@@ -437,6 +451,39 @@ TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
     }
 }
 
+TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
+                                   FixedBlockMemoryAllocator& TexViewObjAllocator,
+                                   RenderDeviceD3D12Impl*     pRenderDeviceD3D12,
+                                   const TextureDesc&         TexDesc,
+                                   IDeviceMemory*             pMemory,
+                                   Uint64                     MemoryOffset) :
+    TTextureBase{pRefCounters, TexViewObjAllocator, pRenderDeviceD3D12, TexDesc},
+    m_pPlacedMemory{pMemory}
+{
+    if (m_Desc.Usage != USAGE_DEFAULT)
+        LOG_ERROR_AND_THROW("Placed textures must be created with USAGE_DEFAULT");
+
+    if ((m_Desc.MiscFlags & MISC_TEXTURE_FLAG_GENERATE_MIPS) != 0 && !m_Desc.Is2D())
+        LOG_ERROR_AND_THROW("Mipmap generation is currently only supported for 2D and cube textures/texture arrays in d3d12 backend");
+
+    RefCntAutoPtr<IDeviceMemoryD3D12> pMemoryD3D12{pMemory, IID_DeviceMemoryD3D12};
+    if (!pMemoryD3D12)
+        LOG_ERROR_AND_THROW("Placed textures require a valid Direct3D12 device memory object");
+
+    const D3D12_RESOURCE_DESC d3d12TexDesc = GetD3D12TextureDesc();
+
+    if (UINT8 FormatPlaneCount = D3D12GetFormatPlaneCount(pRenderDeviceD3D12->GetD3D12Device(), d3d12TexDesc.Format))
+        m_FormatPlaneCount = FormatPlaneCount;
+
+    D3D12_CLEAR_VALUE        ClearValue  = {};
+    const D3D12_CLEAR_VALUE* pClearValue = GetD3D12ClearValue(m_Desc, d3d12TexDesc.Flags, ClearValue);
+
+    // The resource residency is managed by the heap
+    m_pd3d12Resource = pMemoryD3D12.ConstPtr<DeviceMemoryD3D12Impl>()->CreatePlacedResource(d3d12TexDesc, MemoryOffset, pClearValue, m_Desc.Name);
+
+    SetState(RESOURCE_STATE_UNDEFINED);
+}
+
 
 static TextureDesc InitTexDescFromD3D12Resource(ID3D12Resource* pTexture, const TextureDesc& SrcTexDesc)
 {
@@ -639,7 +686,7 @@ TextureD3D12Impl::~TextureD3D12Impl()
     GetDevice()->SafeReleaseDeviceObject(std::move(m_pd3d12Resource), m_Desc.ImmediateContextMask);
     if (m_StagingFootprints != nullptr)
     {
-        FREE(GetRawAllocator(), m_StagingFootprints);
+        FREE(GetRawAllocator(MEMORY_CATEGORY_STAGING), m_StagingFootprints);
     }
 }
 
@@ -696,6 +743,29 @@ void TextureD3D12Impl::SetD3D12ResourceState(D3D12_RESOURCE_STATES state)
     SetState(D3D12ResourceStatesToResourceStateFlags(state));
 }
 
+void TextureD3D12Impl::SetResidencyPriority(D3D12_RESIDENCY_PRIORITY Priority)
+{
+    GetDevice()->SetResidencyPriority(*this, Priority);
+}
+
+HANDLE TextureD3D12Impl::CreateSharedHandle() const
+{
+    if ((m_Desc.MiscFlags & MISC_TEXTURE_FLAG_EXPORTABLE) == 0)
+    {
+        DEV_ERROR("Texture '", m_Desc.Name, "' was not created with MISC_TEXTURE_FLAG_EXPORTABLE flag");
+        return NULL;
+    }
+
+    HANDLE  Handle = NULL;
+    HRESULT hr     = GetDevice()->GetD3D12Device()->CreateSharedHandle(m_pd3d12Resource, nullptr, GENERIC_ALL, nullptr, &Handle);
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create shared handle for texture '", m_Desc.Name, "'");
+        return NULL;
+    }
+    return Handle;
+}
+
 D3D12_RESOURCE_STATES TextureD3D12Impl::GetD3D12ResourceState() const
 {
     return ResourceStateFlagsToD3D12ResourceStates(GetState());
@@ -244,6 +244,11 @@ public:
             Features.NativeMultiDraw               = DEVICE_FEATURE_STATE_DISABLED;
             Features.AsyncShaderCompilation        = DEVICE_FEATURE_STATE_ENABLED;
             Features.FormattedBuffers              = DEVICE_FEATURE_STATE_ENABLED;
+            Features.SpecializationConstants       = DEVICE_FEATURE_STATE_DISABLED;
+            Features.ExtendedDynamicState          = DEVICE_FEATURE_STATE_DISABLED;
+            Features.GPUUploadMemory               = DEVICE_FEATURE_STATE_DISABLED;
+            Features.Multiview                     = DEVICE_FEATURE_STATE_DISABLED;
+            Features.ExternalMemory                = DEVICE_FEATURE_STATE_DISABLED;
         }
 
         // Set memory properties
@@ -39,6 +39,8 @@
 #include "ShaderBase.hpp"
 #include "ThreadPool.h"
 #include "RefCntAutoPtr.hpp"
+#include "ShaderResources.hpp"
+#include "DataBlobImpl.hpp"
 
 /// \file
 /// Base implementation of a D3D shader
@@ -54,6 +56,12 @@ RefCntAutoPtr<IDataBlob> CompileD3DBytecode(const ShaderCreateInfo& ShaderCI,
                                             IDXCompiler*            DxCompiler,
                                             IDataBlob**             ppCompilerOutput) noexcept(false);
 
+// Reads the bytecode and the resource reflection from ShaderCI.ByteCode if it contains
+// D3D shader archive data (see D3DShaderArchiveData). Returns false otherwise.
+bool ReadD3DShaderArchiveData(const ShaderCreateInfo& ShaderCI,
+                              D3DShaderArchiveData&   ArchiveData,
+                              DynamicLinearAllocator& Allocator) noexcept(false);
+
 /// Base implementation of a D3D shader
 template <typename EngineImplTraits, typename ShaderResourcesType>
 class ShaderD3DBase : public ShaderBase<EngineImplTraits>
@@ -70,7 +78,8 @@ public:
         IThreadPool* const         pShaderCompilationThreadPool;
     };
 
-    using InitResourcesFuncType = std::function<std::shared_ptr<const ShaderResourcesType>(const ShaderDesc&, IDataBlob*)>;
+    // pArchiveData is not null when the shader resource reflection is provided by the device object archive
+    using InitResourcesFuncType = std::function<std::shared_ptr<const ShaderResourcesType>(const ShaderDesc&, IDataBlob*, const D3DShaderArchiveData* pArchiveData)>;
 
     ShaderD3DBase(IReferenceCounters*     pRefCounters,
                   RenderDeviceImplType*   pDevice,
@@ -190,10 +199,23 @@ private:
                     IDataBlob**             ppCompilerOutput,
                     InitResourcesFuncType   InitResources) noexcept(false)
     {
-        m_pShaderByteCode = CompileD3DBytecode(ShaderCI, ShaderModel, pDxCompiler, ppCompilerOutput);
+        // Shaders packed into archive contain bytecode along with the resource reflection produced by the archiver
+        D3DShaderArchiveData   ArchiveData;
+        DynamicLinearAllocator ArchiveDataAllocator{GetRawAllocator()};
+        if (ReadD3DShaderArchiveData(ShaderCI, ArchiveData, ArchiveDataAllocator))
+        {
+            m_pShaderByteCode = DataBlobImpl::Create(ArchiveData.BytecodeSize, ArchiveData.pBytecode);
+        }
+        else
+        {
+            m_pShaderByteCode = CompileD3DBytecode(ShaderCI, ShaderModel, pDxCompiler, ppCompilerOutput);
+        }
+
         if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
         {
-            m_pShaderResources = InitResources(this->m_Desc, m_pShaderByteCode);
+            // Constant buffer reflection is not stored in the archive and requires reflecting the bytecode
+            const bool UseArchivedReflection = ArchiveData.pBytecode != nullptr && !ShaderCI.LoadConstantBufferReflection;
+            m_pShaderResources               = InitResources(this->m_Desc, m_pShaderByteCode, UseArchivedReflection ? &ArchiveData : nullptr);
         }
         this->m_Status.store(SHADER_STATUS_READY);
     }
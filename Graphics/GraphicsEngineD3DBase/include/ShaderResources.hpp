@@ -73,6 +73,7 @@
 #include "D3DShaderResourceLoader.hpp"
 #include "PipelineState.h"
 #include "D3DCommonTypeConversions.hpp"
+#include "Serializer.hpp"
 
 namespace Diligent
 {
@@ -278,6 +279,53 @@ private:
 static_assert(sizeof(D3DShaderResourceAttribs) == sizeof(void*) + sizeof(Uint32) * 4, "Unexpected sizeof(D3DShaderResourceAttribs)");
 
 
+class ShaderResources;
+
+/// D3D shader data stored in the device object archive.
+
+/// Along with the shader bytecode, the archive keeps the shader resource reflection produced
+/// offline by the archiver, so that the shader can be created without reflecting the bytecode.
+/// The data is stored in ShaderCreateInfo::ByteCode and is identified by the magic number
+/// that can't be the first four bytes of D3D bytecode ('DXBC').
+struct D3DShaderArchiveData
+{
+    static constexpr Uint32 MagicNumber = 0x4C465244; // 'DRFL'
+
+    struct Resource
+    {
+        const char* Name         = nullptr;
+        Uint32      BindPoint    = 0;
+        Uint32      BindCount    = 0;
+        Uint32      Space        = 0;
+        Uint32      SamplerId    = D3DShaderResourceAttribs::InvalidSamplerId; // Texture SRVs only
+        Uint8       InputType    = 0;                                          // D3D_SHADER_INPUT_TYPE
+        Uint8       SRVDimension = 0;                                          // D3D_SRV_DIMENSION
+    };
+
+    const void* pBytecode     = nullptr;
+    size_t      BytecodeSize  = 0;
+    Uint32      ShaderVersion = 0;
+
+    // Resources are stored in the same order as in ShaderResources:
+    // CBs, TexSRVs, TexUAVs, BufSRVs, BufUAVs, Samplers, AccelStructs
+    D3DShaderResourceCounters Counters;
+
+    const Resource* pResources   = nullptr;
+    Uint32          NumResources = 0;
+
+    /// Returns true if the data starts with the archive data magic number.
+    static bool IsArchiveData(const void* pData, size_t Size);
+
+    template <SerializerMode Mode>
+    static bool Serialize(Serializer<Mode>&                                                  Ser,
+                          typename Serializer<Mode>::template ConstQual<D3DShaderArchiveData>& Data,
+                          DynamicLinearAllocator*                                            Allocator);
+
+    /// Packs the shader bytecode and its resource reflection into the archive data.
+    static SerializedData Pack(const IDataBlob* pBytecode, const ShaderResources& Resources);
+};
+
+
 /// Diligent::ShaderResources class
 class ShaderResources
 {
@@ -432,6 +480,8 @@ public:
         Minor = (m_ShaderVersion & 0x0000000F);
     }
 
+    Uint32 GetShaderVersion() const { return m_ShaderVersion; }
+
 protected:
     template <typename TD3DReflectionTraits,
               typename TShaderReflection,
@@ -442,6 +492,12 @@ protected:
                     const Char*         SamplerSuffix,
                     bool                LoadConstantBufferReflection);
 
+    // Initializes resources from the reflection stored in the device object archive
+    template <typename TNewResourceHandler>
+    void Initialize(const D3DShaderArchiveData& ArchiveData,
+                    TNewResourceHandler         NewResHandler,
+                    const Char*                 ShaderName,
+                    const Char*                 SamplerSuffix);
 
     __forceinline D3DShaderResourceAttribs& GetResAttribs(Uint32 n, Uint32 NumResources, Uint32 Offset) noexcept
     {
@@ -536,7 +592,7 @@ void ShaderResources::Initialize(TShaderReflection*  pShaderReflection,
             if (CombinedSamplerSuffix != nullptr)
                 ResourceNamesPoolSize += strlen(CombinedSamplerSuffix) + 1;
 
-            AllocateMemory(GetRawAllocator(), ResCounters, ResourceNamesPoolSize, ResourceNamesPool);
+            AllocateMemory(GetRawAllocator(MEMORY_CATEGORY_SHADER_CACHE), ResCounters, ResourceNamesPoolSize, ResourceNamesPool);
         },
 
         [&](const D3DShaderResourceAttribs& CBAttribs, ShaderCodeBufferDescX&& CBReflection) //
@@ -630,10 +686,109 @@ void ShaderResources::Initialize(TShaderReflection*  pShaderReflection,
     {
         VERIFY_EXPR(LoadConstantBufferReflection);
         VERIFY_EXPR(CBReflections.size() == GetNumCBs());
-        m_CBReflectionBuffer = ShaderCodeBufferDescX::PackArray(CBReflections.cbegin(), CBReflections.cend(), GetRawAllocator());
+        m_CBReflectionBuffer = ShaderCodeBufferDescX::PackArray(CBReflections.cbegin(), CBReflections.cend(), GetRawAllocator(MEMORY_CATEGORY_SHADER_CACHE));
     }
 }
 
+
+template <typename TNewResourceHandler>
+void ShaderResources::Initialize(const D3DShaderArchiveData& ArchiveData,
+                                 TNewResourceHandler         NewResHandler,
+                                 const Char*                 ShaderName,
+                                 const Char*                 CombinedSamplerSuffix)
+{
+    const D3DShaderResourceCounters& ResCounters = ArchiveData.Counters;
+    // clang-format off
+    const Uint32 TotalResources =
+        ResCounters.NumCBs     +
+        ResCounters.NumTexSRVs +
+        ResCounters.NumTexUAVs +
+        ResCounters.NumBufSRVs +
+        ResCounters.NumBufUAVs +
+        ResCounters.NumSamplers +
+        ResCounters.NumAccelStructs;
+    // clang-format on
+    if (TotalResources != ArchiveData.NumResources)
+    {
+        LOG_ERROR_AND_THROW("The number of resources (", ArchiveData.NumResources, ") in the archived reflection of shader '", ShaderName,
+                            "' does not match the resource counters (", TotalResources, "). The archive may be corrupted.");
+    }
+
+    m_ShaderVersion = ArchiveData.ShaderVersion;
+
+    VERIFY_EXPR(ShaderName != nullptr);
+    size_t ResourceNamesPoolSize = strlen(ShaderName) + 1;
+    if (CombinedSamplerSuffix != nullptr)
+        ResourceNamesPoolSize += strlen(CombinedSamplerSuffix) + 1;
+    for (Uint32 i = 0; i < ArchiveData.NumResources; ++i)
+        ResourceNamesPoolSize += strlen(ArchiveData.pResources[i].Name != nullptr ? ArchiveData.pResources[i].Name : "") + 1;
+
+    StringPool ResourceNamesPool;
+    AllocateMemory(GetRawAllocator(MEMORY_CATEGORY_SHADER_CACHE), ResCounters, ResourceNamesPoolSize, ResourceNamesPool);
+
+    auto CreateAttribs = [&](Uint32 ResIdx, Uint32 SamplerId) {
+        const D3DShaderArchiveData::Resource& Res = ArchiveData.pResources[ResIdx];
+        return D3DShaderResourceAttribs{
+            ResourceNamesPool.CopyString(Res.Name != nullptr ? Res.Name : ""),
+            Res.BindPoint,
+            Res.BindCount,
+            Res.Space,
+            static_cast<D3D_SHADER_INPUT_TYPE>(Res.InputType),
+            static_cast<D3D_SRV_DIMENSION>(Res.SRVDimension),
+            SamplerId,
+        };
+    };
+
+    // Resources in the archive data are stored in the same order as in the memory buffer
+    Uint32 ResIdx = 0;
+    for (Uint32 n = 0; n < GetNumCBs(); ++n)
+        NewResHandler.OnNewCB(*new (&GetCB(n)) D3DShaderResourceAttribs{CreateAttribs(ResIdx++, D3DShaderResourceAttribs::InvalidSamplerId)});
+
+    const Uint32 TexSRVIdx = ResIdx;
+    ResIdx += GetNumTexSRV();
+
+    for (Uint32 n = 0; n < GetNumTexUAV(); ++n)
+        NewResHandler.OnNewTexUAV(*new (&GetTexUAV(n)) D3DShaderResourceAttribs{CreateAttribs(ResIdx++, D3DShaderResourceAttribs::InvalidSamplerId)});
+
+    for (Uint32 n = 0; n < GetNumBufSRV(); ++n)
+        NewResHandler.OnNewBuffSRV(*new (&GetBufSRV(n)) D3DShaderResourceAttribs{CreateAttribs(ResIdx++, D3DShaderResourceAttribs::InvalidSamplerId)});
+
+    for (Uint32 n = 0; n < GetNumBufUAV(); ++n)
+        NewResHandler.OnNewBuffUAV(*new (&GetBufUAV(n)) D3DShaderResourceAttribs{CreateAttribs(ResIdx++, D3DShaderResourceAttribs::InvalidSamplerId)});
+
+    // Samplers must be initialized before texture SRVs
+    for (Uint32 n = 0; n < GetNumSamplers(); ++n)
+        NewResHandler.OnNewSampler(*new (&GetSampler(n)) D3DShaderResourceAttribs{CreateAttribs(ResIdx++, D3DShaderResourceAttribs::InvalidSamplerId)});
+
+    for (Uint32 n = 0; n < GetNumAccelStructs(); ++n)
+        NewResHandler.OnNewAccelStruct(*new (&GetAccelStruct(n)) D3DShaderResourceAttribs{CreateAttribs(ResIdx++, D3DShaderResourceAttribs::InvalidSamplerId)});
+
+    VERIFY_EXPR(ResIdx == ArchiveData.NumResources);
+
+    for (Uint32 n = 0; n < GetNumTexSRV(); ++n)
+    {
+        Uint32 SamplerId = ArchiveData.pResources[TexSRVIdx + n].SamplerId;
+        if (SamplerId != D3DShaderResourceAttribs::InvalidSamplerId && SamplerId >= GetNumSamplers())
+        {
+            LOG_ERROR_AND_THROW("Sampler index (", SamplerId, ") of texture SRV '", ArchiveData.pResources[TexSRVIdx + n].Name,
+                                "' in the archived reflection of shader '", ShaderName, "' is out of range. The archive may be corrupted.");
+        }
+
+        D3DShaderResourceAttribs* pNewTexSRV = new (&GetTexSRV(n)) D3DShaderResourceAttribs{CreateAttribs(TexSRVIdx + n, SamplerId)};
+        if (SamplerId != D3DShaderResourceAttribs::InvalidSamplerId)
+        {
+            GetSampler(SamplerId).SetTexSRVId(n);
+        }
+        NewResHandler.OnNewTexSRV(*pNewTexSRV);
+    }
+
+    m_ShaderName = ResourceNamesPool.CopyString(ShaderName);
+    if (CombinedSamplerSuffix != nullptr)
+        m_SamplerSuffix = ResourceNamesPool.CopyString(CombinedSamplerSuffix);
+
+    VERIFY_EXPR(ResourceNamesPool.GetRemainingSize() == 0);
+}
+
 } // namespace Diligent
 
 namespace std
@@ -57,7 +57,7 @@ public:
         TBase{pRefCounters, pDevice, pDeviceContext, SCDesc},
         m_FSDesc           {FSDesc},
         m_Window           {Window},
-        m_MaxFrameLatency  {SCDesc.BufferCount}
+        m_MaxFrameLatency  {SCDesc.LatencyMode == SWAP_CHAIN_LATENCY_MODE_LOW ? 1 : SCDesc.BufferCount}
     // clang-format on
     {
         if (m_DesiredPreTransform != SURFACE_TRANSFORM_OPTIMAL &&
@@ -278,6 +278,13 @@ protected:
 
                 m_FrameLatencyWaitableObject = pSwapChain2->GetFrameLatencyWaitableObject();
                 VERIFY(m_FrameLatencyWaitableObject != NULL, "Waitable object must not be null");
+
+                if (m_SwapChainDesc.LatencyMode == SWAP_CHAIN_LATENCY_MODE_LOW)
+                {
+                    // In low-latency mode, we wait for the frame after presenting the previous one,
+                    // so the first frame has to be waited for here.
+                    WaitForFrame();
+                }
             }
         }
         else
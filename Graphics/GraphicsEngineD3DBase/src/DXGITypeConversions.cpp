@@ -289,142 +289,136 @@ DXGI_FORMAT CorrectDXGIFormat(DXGI_FORMAT DXGIFormat, Uint32 BindFlags)
     return DXGIFormat;
 }
 
-DXGI_FORMAT TexFormatToDXGI_Format(TEXTURE_FORMAT TexFormat, Uint32 BindFlags)
+namespace
 {
-    static Bool        bFormatMapInitialized                   = false;
-    static DXGI_FORMAT FmtToDXGIFmtMap[TEX_FORMAT_NUM_FORMATS] = {DXGI_FORMAT_UNKNOWN};
-    if (!bFormatMapInitialized)
-    {
-        // clang-format off
-        FmtToDXGIFmtMap[TEX_FORMAT_UNKNOWN]                = DXGI_FORMAT_UNKNOWN;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA32_TYPELESS]        = DXGI_FORMAT_R32G32B32A32_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA32_FLOAT]           = DXGI_FORMAT_R32G32B32A32_FLOAT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA32_UINT]            = DXGI_FORMAT_R32G32B32A32_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA32_SINT]            = DXGI_FORMAT_R32G32B32A32_SINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_RGB32_TYPELESS]         = DXGI_FORMAT_R32G32B32_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGB32_FLOAT]            = DXGI_FORMAT_R32G32B32_FLOAT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGB32_UINT]             = DXGI_FORMAT_R32G32B32_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGB32_SINT]             = DXGI_FORMAT_R32G32B32_SINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA16_TYPELESS]        = DXGI_FORMAT_R16G16B16A16_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA16_FLOAT]           = DXGI_FORMAT_R16G16B16A16_FLOAT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA16_UNORM]           = DXGI_FORMAT_R16G16B16A16_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA16_UINT]            = DXGI_FORMAT_R16G16B16A16_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA16_SNORM]           = DXGI_FORMAT_R16G16B16A16_SNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA16_SINT]            = DXGI_FORMAT_R16G16B16A16_SINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_RG32_TYPELESS]          = DXGI_FORMAT_R32G32_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG32_FLOAT]             = DXGI_FORMAT_R32G32_FLOAT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG32_UINT]              = DXGI_FORMAT_R32G32_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG32_SINT]              = DXGI_FORMAT_R32G32_SINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_R32G8X24_TYPELESS]      = DXGI_FORMAT_R32G8X24_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_D32_FLOAT_S8X24_UINT]   = DXGI_FORMAT_D32_FLOAT_S8X24_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_R32_FLOAT_X8X24_TYPELESS]= DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_X32_TYPELESS_G8X24_UINT]= DXGI_FORMAT_X32_TYPELESS_G8X24_UINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_RGB10A2_TYPELESS]       = DXGI_FORMAT_R10G10B10A2_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGB10A2_UNORM]          = DXGI_FORMAT_R10G10B10A2_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGB10A2_UINT]           = DXGI_FORMAT_R10G10B10A2_UINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_R11G11B10_FLOAT]        = DXGI_FORMAT_R11G11B10_FLOAT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA8_TYPELESS]         = DXGI_FORMAT_R8G8B8A8_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA8_UNORM]            = DXGI_FORMAT_R8G8B8A8_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA8_UNORM_SRGB]       = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA8_UINT]             = DXGI_FORMAT_R8G8B8A8_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA8_SNORM]            = DXGI_FORMAT_R8G8B8A8_SNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGBA8_SINT]             = DXGI_FORMAT_R8G8B8A8_SINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_RG16_TYPELESS]          = DXGI_FORMAT_R16G16_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG16_FLOAT]             = DXGI_FORMAT_R16G16_FLOAT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG16_UNORM]             = DXGI_FORMAT_R16G16_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG16_UINT]              = DXGI_FORMAT_R16G16_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG16_SNORM]             = DXGI_FORMAT_R16G16_SNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG16_SINT]              = DXGI_FORMAT_R16G16_SINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_R32_TYPELESS]           = DXGI_FORMAT_R32_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_D32_FLOAT]              = DXGI_FORMAT_D32_FLOAT;
-        FmtToDXGIFmtMap[TEX_FORMAT_R32_FLOAT]              = DXGI_FORMAT_R32_FLOAT;
-        FmtToDXGIFmtMap[TEX_FORMAT_R32_UINT]               = DXGI_FORMAT_R32_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_R32_SINT]               = DXGI_FORMAT_R32_SINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_R24G8_TYPELESS]         = DXGI_FORMAT_R24G8_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_D24_UNORM_S8_UINT]      = DXGI_FORMAT_D24_UNORM_S8_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_R24_UNORM_X8_TYPELESS]  = DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_X24_TYPELESS_G8_UINT]   = DXGI_FORMAT_X24_TYPELESS_G8_UINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_RG8_TYPELESS]           = DXGI_FORMAT_R8G8_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG8_UNORM]              = DXGI_FORMAT_R8G8_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG8_UINT]               = DXGI_FORMAT_R8G8_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG8_SNORM]              = DXGI_FORMAT_R8G8_SNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG8_SINT]               = DXGI_FORMAT_R8G8_SINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_R16_TYPELESS]           = DXGI_FORMAT_R16_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_R16_FLOAT]              = DXGI_FORMAT_R16_FLOAT;
-        FmtToDXGIFmtMap[TEX_FORMAT_D16_UNORM]              = DXGI_FORMAT_D16_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_R16_UNORM]              = DXGI_FORMAT_R16_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_R16_UINT]               = DXGI_FORMAT_R16_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_R16_SNORM]              = DXGI_FORMAT_R16_SNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_R16_SINT]               = DXGI_FORMAT_R16_SINT;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_R8_TYPELESS]            = DXGI_FORMAT_R8_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_R8_UNORM]               = DXGI_FORMAT_R8_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_R8_UINT]                = DXGI_FORMAT_R8_UINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_R8_SNORM]               = DXGI_FORMAT_R8_SNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_R8_SINT]                = DXGI_FORMAT_R8_SINT;
-        FmtToDXGIFmtMap[TEX_FORMAT_A8_UNORM]               = DXGI_FORMAT_A8_UNORM;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_R1_UNORM]               = DXGI_FORMAT_R1_UNORM ;
-        FmtToDXGIFmtMap[TEX_FORMAT_RGB9E5_SHAREDEXP]       = DXGI_FORMAT_R9G9B9E5_SHAREDEXP;
-        FmtToDXGIFmtMap[TEX_FORMAT_RG8_B8G8_UNORM]         = DXGI_FORMAT_R8G8_B8G8_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_G8R8_G8B8_UNORM]        = DXGI_FORMAT_G8R8_G8B8_UNORM;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_BC1_TYPELESS]           = DXGI_FORMAT_BC1_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC1_UNORM]              = DXGI_FORMAT_BC1_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC1_UNORM_SRGB]         = DXGI_FORMAT_BC1_UNORM_SRGB;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC2_TYPELESS]           = DXGI_FORMAT_BC2_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC2_UNORM]              = DXGI_FORMAT_BC2_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC2_UNORM_SRGB]         = DXGI_FORMAT_BC2_UNORM_SRGB;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC3_TYPELESS]           = DXGI_FORMAT_BC3_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC3_UNORM]              = DXGI_FORMAT_BC3_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC3_UNORM_SRGB]         = DXGI_FORMAT_BC3_UNORM_SRGB;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC4_TYPELESS]           = DXGI_FORMAT_BC4_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC4_UNORM]              = DXGI_FORMAT_BC4_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC4_SNORM]              = DXGI_FORMAT_BC4_SNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC5_TYPELESS]           = DXGI_FORMAT_BC5_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC5_UNORM]              = DXGI_FORMAT_BC5_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC5_SNORM]              = DXGI_FORMAT_BC5_SNORM;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_B5G6R5_UNORM]           = DXGI_FORMAT_B5G6R5_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_B5G5R5A1_UNORM]         = DXGI_FORMAT_B5G5R5A1_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_BGRA8_UNORM]            = DXGI_FORMAT_B8G8R8A8_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_BGRX8_UNORM]            = DXGI_FORMAT_B8G8R8X8_UNORM;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_R10G10B10_XR_BIAS_A2_UNORM]= DXGI_FORMAT_R10G10B10_XR_BIAS_A2_UNORM;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_BGRA8_TYPELESS]         = DXGI_FORMAT_B8G8R8A8_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_BGRA8_UNORM_SRGB]       = DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
-        FmtToDXGIFmtMap[TEX_FORMAT_BGRX8_TYPELESS]         = DXGI_FORMAT_B8G8R8X8_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_BGRX8_UNORM_SRGB]       = DXGI_FORMAT_B8G8R8X8_UNORM_SRGB;
-
-        FmtToDXGIFmtMap[TEX_FORMAT_BC6H_TYPELESS]          = DXGI_FORMAT_BC6H_TYPELESS;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC6H_UF16]              = DXGI_FORMAT_BC6H_UF16;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC6H_SF16]              = DXGI_FORMAT_BC6H_SF16;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC7_TYPELESS]           = DXGI_FORMAT_BC7_TYPELESS ;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC7_UNORM]              = DXGI_FORMAT_BC7_UNORM;
-        FmtToDXGIFmtMap[TEX_FORMAT_BC7_UNORM_SRGB]         = DXGI_FORMAT_BC7_UNORM_SRGB;
-        // clang-format on
-
-        static_assert(TEX_FORMAT_NUM_FORMATS == 106, "Please enter the new format information above");
-        bFormatMapInitialized = true;
-    }
 
+struct TexFormatToDXGIFormatMapping
+{
+    TEXTURE_FORMAT Format;
+    DXGI_FORMAT    DXGIFormat;
+};
+
+// clang-format off
+constexpr TexFormatToDXGIFormatMapping FmtToDXGIFmtMap[] =
+{
+    {TEX_FORMAT_UNKNOWN,                     DXGI_FORMAT_UNKNOWN},
+    {TEX_FORMAT_RGBA32_TYPELESS,             DXGI_FORMAT_R32G32B32A32_TYPELESS},
+    {TEX_FORMAT_RGBA32_FLOAT,                DXGI_FORMAT_R32G32B32A32_FLOAT},
+    {TEX_FORMAT_RGBA32_UINT,                 DXGI_FORMAT_R32G32B32A32_UINT},
+    {TEX_FORMAT_RGBA32_SINT,                 DXGI_FORMAT_R32G32B32A32_SINT},
+    {TEX_FORMAT_RGB32_TYPELESS,              DXGI_FORMAT_R32G32B32_TYPELESS},
+    {TEX_FORMAT_RGB32_FLOAT,                 DXGI_FORMAT_R32G32B32_FLOAT},
+    {TEX_FORMAT_RGB32_UINT,                  DXGI_FORMAT_R32G32B32_UINT},
+    {TEX_FORMAT_RGB32_SINT,                  DXGI_FORMAT_R32G32B32_SINT},
+    {TEX_FORMAT_RGBA16_TYPELESS,             DXGI_FORMAT_R16G16B16A16_TYPELESS},
+    {TEX_FORMAT_RGBA16_FLOAT,                DXGI_FORMAT_R16G16B16A16_FLOAT},
+    {TEX_FORMAT_RGBA16_UNORM,                DXGI_FORMAT_R16G16B16A16_UNORM},
+    {TEX_FORMAT_RGBA16_UINT,                 DXGI_FORMAT_R16G16B16A16_UINT},
+    {TEX_FORMAT_RGBA16_SNORM,                DXGI_FORMAT_R16G16B16A16_SNORM},
+    {TEX_FORMAT_RGBA16_SINT,                 DXGI_FORMAT_R16G16B16A16_SINT},
+    {TEX_FORMAT_RG32_TYPELESS,               DXGI_FORMAT_R32G32_TYPELESS},
+    {TEX_FORMAT_RG32_FLOAT,                  DXGI_FORMAT_R32G32_FLOAT},
+    {TEX_FORMAT_RG32_UINT,                   DXGI_FORMAT_R32G32_UINT},
+    {TEX_FORMAT_RG32_SINT,                   DXGI_FORMAT_R32G32_SINT},
+    {TEX_FORMAT_R32G8X24_TYPELESS,           DXGI_FORMAT_R32G8X24_TYPELESS},
+    {TEX_FORMAT_D32_FLOAT_S8X24_UINT,        DXGI_FORMAT_D32_FLOAT_S8X24_UINT},
+    {TEX_FORMAT_R32_FLOAT_X8X24_TYPELESS,    DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS},
+    {TEX_FORMAT_X32_TYPELESS_G8X24_UINT,     DXGI_FORMAT_X32_TYPELESS_G8X24_UINT},
+    {TEX_FORMAT_RGB10A2_TYPELESS,            DXGI_FORMAT_R10G10B10A2_TYPELESS},
+    {TEX_FORMAT_RGB10A2_UNORM,               DXGI_FORMAT_R10G10B10A2_UNORM},
+    {TEX_FORMAT_RGB10A2_UINT,                DXGI_FORMAT_R10G10B10A2_UINT},
+    {TEX_FORMAT_R11G11B10_FLOAT,             DXGI_FORMAT_R11G11B10_FLOAT},
+    {TEX_FORMAT_RGBA8_TYPELESS,              DXGI_FORMAT_R8G8B8A8_TYPELESS},
+    {TEX_FORMAT_RGBA8_UNORM,                 DXGI_FORMAT_R8G8B8A8_UNORM},
+    {TEX_FORMAT_RGBA8_UNORM_SRGB,            DXGI_FORMAT_R8G8B8A8_UNORM_SRGB},
+    {TEX_FORMAT_RGBA8_UINT,                  DXGI_FORMAT_R8G8B8A8_UINT},
+    {TEX_FORMAT_RGBA8_SNORM,                 DXGI_FORMAT_R8G8B8A8_SNORM},
+    {TEX_FORMAT_RGBA8_SINT,                  DXGI_FORMAT_R8G8B8A8_SINT},
+    {TEX_FORMAT_RG16_TYPELESS,               DXGI_FORMAT_R16G16_TYPELESS},
+    {TEX_FORMAT_RG16_FLOAT,                  DXGI_FORMAT_R16G16_FLOAT},
+    {TEX_FORMAT_RG16_UNORM,                  DXGI_FORMAT_R16G16_UNORM},
+    {TEX_FORMAT_RG16_UINT,                   DXGI_FORMAT_R16G16_UINT},
+    {TEX_FORMAT_RG16_SNORM,                  DXGI_FORMAT_R16G16_SNORM},
+    {TEX_FORMAT_RG16_SINT,                   DXGI_FORMAT_R16G16_SINT},
+    {TEX_FORMAT_R32_TYPELESS,                DXGI_FORMAT_R32_TYPELESS},
+    {TEX_FORMAT_D32_FLOAT,                   DXGI_FORMAT_D32_FLOAT},
+    {TEX_FORMAT_R32_FLOAT,                   DXGI_FORMAT_R32_FLOAT},
+    {TEX_FORMAT_R32_UINT,                    DXGI_FORMAT_R32_UINT},
+    {TEX_FORMAT_R32_SINT,                    DXGI_FORMAT_R32_SINT},
+    {TEX_FORMAT_R24G8_TYPELESS,              DXGI_FORMAT_R24G8_TYPELESS},
+    {TEX_FORMAT_D24_UNORM_S8_UINT,           DXGI_FORMAT_D24_UNORM_S8_UINT},
+    {TEX_FORMAT_R24_UNORM_X8_TYPELESS,       DXGI_FORMAT_R24_UNORM_X8_TYPELESS},
+    {TEX_FORMAT_X24_TYPELESS_G8_UINT,        DXGI_FORMAT_X24_TYPELESS_G8_UINT},
+    {TEX_FORMAT_RG8_TYPELESS,                DXGI_FORMAT_R8G8_TYPELESS},
+    {TEX_FORMAT_RG8_UNORM,                   DXGI_FORMAT_R8G8_UNORM},
+    {TEX_FORMAT_RG8_UINT,                    DXGI_FORMAT_R8G8_UINT},
+    {TEX_FORMAT_RG8_SNORM,                   DXGI_FORMAT_R8G8_SNORM},
+    {TEX_FORMAT_RG8_SINT,                    DXGI_FORMAT_R8G8_SINT},
+    {TEX_FORMAT_R16_TYPELESS,                DXGI_FORMAT_R16_TYPELESS},
+    {TEX_FORMAT_R16_FLOAT,                   DXGI_FORMAT_R16_FLOAT},
+    {TEX_FORMAT_D16_UNORM,                   DXGI_FORMAT_D16_UNORM},
+    {TEX_FORMAT_R16_UNORM,                   DXGI_FORMAT_R16_UNORM},
+    {TEX_FORMAT_R16_UINT,                    DXGI_FORMAT_R16_UINT},
+    {TEX_FORMAT_R16_SNORM,                   DXGI_FORMAT_R16_SNORM},
+    {TEX_FORMAT_R16_SINT,                    DXGI_FORMAT_R16_SINT},
+    {TEX_FORMAT_R8_TYPELESS,                 DXGI_FORMAT_R8_TYPELESS},
+    {TEX_FORMAT_R8_UNORM,                    DXGI_FORMAT_R8_UNORM},
+    {TEX_FORMAT_R8_UINT,                     DXGI_FORMAT_R8_UINT},
+    {TEX_FORMAT_R8_SNORM,                    DXGI_FORMAT_R8_SNORM},
+    {TEX_FORMAT_R8_SINT,                     DXGI_FORMAT_R8_SINT},
+    {TEX_FORMAT_A8_UNORM,                    DXGI_FORMAT_A8_UNORM},
+    {TEX_FORMAT_R1_UNORM,                    DXGI_FORMAT_R1_UNORM},
+    {TEX_FORMAT_RGB9E5_SHAREDEXP,            DXGI_FORMAT_R9G9B9E5_SHAREDEXP},
+    {TEX_FORMAT_RG8_B8G8_UNORM,              DXGI_FORMAT_R8G8_B8G8_UNORM},
+    {TEX_FORMAT_G8R8_G8B8_UNORM,             DXGI_FORMAT_G8R8_G8B8_UNORM},
+    {TEX_FORMAT_BC1_TYPELESS,                DXGI_FORMAT_BC1_TYPELESS},
+    {TEX_FORMAT_BC1_UNORM,                   DXGI_FORMAT_BC1_UNORM},
+    {TEX_FORMAT_BC1_UNORM_SRGB,              DXGI_FORMAT_BC1_UNORM_SRGB},
+    {TEX_FORMAT_BC2_TYPELESS,                DXGI_FORMAT_BC2_TYPELESS},
+    {TEX_FORMAT_BC2_UNORM,                   DXGI_FORMAT_BC2_UNORM},
+    {TEX_FORMAT_BC2_UNORM_SRGB,              DXGI_FORMAT_BC2_UNORM_SRGB},
+    {TEX_FORMAT_BC3_TYPELESS,                DXGI_FORMAT_BC3_TYPELESS},
+    {TEX_FORMAT_BC3_UNORM,                   DXGI_FORMAT_BC3_UNORM},
+    {TEX_FORMAT_BC3_UNORM_SRGB,              DXGI_FORMAT_BC3_UNORM_SRGB},
+    {TEX_FORMAT_BC4_TYPELESS,                DXGI_FORMAT_BC4_TYPELESS},
+    {TEX_FORMAT_BC4_UNORM,                   DXGI_FORMAT_BC4_UNORM},
+    {TEX_FORMAT_BC4_SNORM,                   DXGI_FORMAT_BC4_SNORM},
+    {TEX_FORMAT_BC5_TYPELESS,                DXGI_FORMAT_BC5_TYPELESS},
+    {TEX_FORMAT_BC5_UNORM,                   DXGI_FORMAT_BC5_UNORM},
+    {TEX_FORMAT_BC5_SNORM,                   DXGI_FORMAT_BC5_SNORM},
+    {TEX_FORMAT_B5G6R5_UNORM,                DXGI_FORMAT_B5G6R5_UNORM},
+    {TEX_FORMAT_B5G5R5A1_UNORM,              DXGI_FORMAT_B5G5R5A1_UNORM},
+    {TEX_FORMAT_BGRA8_UNORM,                 DXGI_FORMAT_B8G8R8A8_UNORM},
+    {TEX_FORMAT_BGRX8_UNORM,                 DXGI_FORMAT_B8G8R8X8_UNORM},
+    {TEX_FORMAT_R10G10B10_XR_BIAS_A2_UNORM,  DXGI_FORMAT_R10G10B10_XR_BIAS_A2_UNORM},
+    {TEX_FORMAT_BGRA8_TYPELESS,              DXGI_FORMAT_B8G8R8A8_TYPELESS},
+    {TEX_FORMAT_BGRA8_UNORM_SRGB,            DXGI_FORMAT_B8G8R8A8_UNORM_SRGB},
+    {TEX_FORMAT_BGRX8_TYPELESS,              DXGI_FORMAT_B8G8R8X8_TYPELESS},
+    {TEX_FORMAT_BGRX8_UNORM_SRGB,            DXGI_FORMAT_B8G8R8X8_UNORM_SRGB},
+    {TEX_FORMAT_BC6H_TYPELESS,               DXGI_FORMAT_BC6H_TYPELESS},
+    {TEX_FORMAT_BC6H_UF16,                   DXGI_FORMAT_BC6H_UF16},
+    {TEX_FORMAT_BC6H_SF16,                   DXGI_FORMAT_BC6H_SF16},
+    {TEX_FORMAT_BC7_TYPELESS,                DXGI_FORMAT_BC7_TYPELESS},
+    {TEX_FORMAT_BC7_UNORM,                   DXGI_FORMAT_BC7_UNORM},
+    {TEX_FORMAT_BC7_UNORM_SRGB,              DXGI_FORMAT_BC7_UNORM_SRGB},
+    {TEX_FORMAT_ETC2_RGB8_UNORM,             DXGI_FORMAT_UNKNOWN},
+    {TEX_FORMAT_ETC2_RGB8_UNORM_SRGB,        DXGI_FORMAT_UNKNOWN},
+    {TEX_FORMAT_ETC2_RGB8A1_UNORM,           DXGI_FORMAT_UNKNOWN},
+    {TEX_FORMAT_ETC2_RGB8A1_UNORM_SRGB,      DXGI_FORMAT_UNKNOWN},
+    {TEX_FORMAT_ETC2_RGBA8_UNORM,            DXGI_FORMAT_UNKNOWN},
+    {TEX_FORMAT_ETC2_RGBA8_UNORM_SRGB,       DXGI_FORMAT_UNKNOWN},
+};
+// clang-format on
+static_assert(_countof(FmtToDXGIFmtMap) == TEX_FORMAT_NUM_FORMATS, "Please enter the new format information above");
+static_assert(IsTextureFormatTableOrdered(FmtToDXGIFmtMap), "Texture formats in the table above must follow the TEXTURE_FORMAT order");
+
+} // namespace
+
+DXGI_FORMAT TexFormatToDXGI_Format(TEXTURE_FORMAT TexFormat, Uint32 BindFlags)
+{
     if (TexFormat >= TEX_FORMAT_UNKNOWN && TexFormat < TEX_FORMAT_NUM_FORMATS)
     {
-        DXGI_FORMAT DXGIFormat = FmtToDXGIFmtMap[TexFormat];
+        DXGI_FORMAT DXGIFormat = FmtToDXGIFmtMap[TexFormat].DXGIFormat;
         VERIFY(TexFormat == TEX_FORMAT_UNKNOWN || TexFormat > TEX_FORMAT_BC7_UNORM_SRGB || DXGIFormat != DXGI_FORMAT_UNKNOWN, "Unsupported texture format");
         if (BindFlags != 0)
             DXGIFormat = CorrectDXGIFormat(DXGIFormat, BindFlags);
@@ -437,29 +431,37 @@ DXGI_FORMAT TexFormatToDXGI_Format(TEXTURE_FORMAT TexFormat, Uint32 BindFlags)
     }
 }
 
-class DXGIFmtToFmtMapInitializer
+namespace
 {
-public:
-    DXGIFmtToFmtMapInitializer(TEXTURE_FORMAT DXGIFmtToFmtMap[])
+
+static_assert(DXGI_FORMAT_B4G4R4A4_UNORM == 115, "Unexpected DXGI format value");
+
+struct DXGIFmtToFmtMapType
+{
+    TEXTURE_FORMAT Formats[DXGI_FORMAT_B4G4R4A4_UNORM + 1];
+};
+
+constexpr DXGIFmtToFmtMapType CreateDXGIFmtToFmtMap()
+{
+    DXGIFmtToFmtMapType Map{};
+    for (size_t Fmt = TEX_FORMAT_UNKNOWN; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
     {
-        for (TEXTURE_FORMAT fmt = TEX_FORMAT_UNKNOWN; fmt < TEX_FORMAT_NUM_FORMATS; fmt = static_cast<TEXTURE_FORMAT>(fmt + 1))
-        {
-            DXGI_FORMAT DXGIFmt = TexFormatToDXGI_Format(fmt);
-            VERIFY_EXPR(DXGIFmt <= DXGI_FORMAT_B4G4R4A4_UNORM);
-            DXGIFmtToFmtMap[DXGIFmt] = fmt;
-        }
+        // Formats that have no DXGI counterpart must not overwrite the DXGI_FORMAT_UNKNOWN entry
+        if (FmtToDXGIFmtMap[Fmt].DXGIFormat != DXGI_FORMAT_UNKNOWN)
+            Map.Formats[FmtToDXGIFmtMap[Fmt].DXGIFormat] = static_cast<TEXTURE_FORMAT>(Fmt);
     }
-};
+    return Map;
+}
+
+constexpr DXGIFmtToFmtMapType DXGIFmtToFmtMap = CreateDXGIFmtToFmtMap();
+
+} // namespace
 
 TEXTURE_FORMAT DXGI_FormatToTexFormat(DXGI_FORMAT DXGIFormat)
 {
-    static_assert(DXGI_FORMAT_B4G4R4A4_UNORM == 115, "Unexpected DXGI format value");
-    static TEXTURE_FORMAT             DXGIFmtToFmtMap[DXGI_FORMAT_B4G4R4A4_UNORM + 1];
-    static DXGIFmtToFmtMapInitializer Initializer(DXGIFmtToFmtMap);
-
     if (DXGIFormat >= DXGI_FORMAT_UNKNOWN && DXGIFormat <= DXGI_FORMAT_BC7_UNORM_SRGB)
     {
-        TEXTURE_FORMAT Format = DXGIFmtToFmtMap[DXGIFormat];
+        TEXTURE_FORMAT Format = DXGIFmtToFmtMap.Formats[DXGIFormat];
         VERIFY(DXGIFormat == DXGI_FORMAT_UNKNOWN || Format != TEX_FORMAT_UNKNOWN, "Unsupported texture format");
         VERIFY_EXPR(DXGIFormat == TexFormatToDXGI_Format(Format));
         return Format;
@@ -42,7 +42,9 @@
 #include "DataBlobImpl.hpp"
 #include "DXCompiler.hpp"
 #include "HLSLUtils.hpp"
+#include "ShaderToolsCommon.hpp"
 #include "ThreadPool.hpp"
+#include "Trace.hpp"
 
 #ifndef D3DCOMPILE_ENABLE_UNBOUNDED_DESCRIPTOR_TABLES
 #    define D3DCOMPILE_ENABLE_UNBOUNDED_DESCRIPTOR_TABLES (1 << 20)
@@ -65,17 +67,14 @@ public:
     STDMETHOD(Open)
     (THIS_ D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID* ppData, UINT* pBytes)
     {
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pStreamFactory->CreateInputStream(pFileName, &pSourceStream);
-        if (pSourceStream == nullptr)
+        RefCntAutoPtr<IDataBlob> pFileData = LoadShaderSourceFile(m_pStreamFactory, pFileName);
+        if (pFileData == nullptr)
         {
             LOG_ERROR("Failed to open shader include file ", pFileName, ". Check that the file exists");
             return E_FAIL;
         }
 
-        RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
-        pSourceStream->ReadBlob(pFileData);
-        *ppData = pFileData->GetDataPtr();
+        *ppData = pFileData->GetConstDataPtr();
         *pBytes = StaticCast<UINT>(pFileData->GetSize());
 
         m_DataBlobs.insert(std::make_pair(*ppData, pFileData));
@@ -135,6 +134,8 @@ RefCntAutoPtr<IDataBlob> CompileD3DBytecode(const ShaderCreateInfo& ShaderCI,
                                             IDXCompiler*            DxCompiler,
                                             IDataBlob**             ppCompilerOutput) noexcept(false)
 {
+    DILIGENT_TRACE_SCOPE("CompileShader");
+
     if (ShaderCI.Source != nullptr || (ShaderCI.FilePath != nullptr && ShaderCI.SourceLanguage != SHADER_SOURCE_LANGUAGE_BYTECODE))
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "'ByteCode' must be null when shader is created from the source code or a file");
@@ -209,4 +210,22 @@ RefCntAutoPtr<IDataBlob> CompileD3DBytecode(const ShaderCreateInfo& ShaderCI,
     return {};
 }
 
+bool ReadD3DShaderArchiveData(const ShaderCreateInfo& ShaderCI,
+                              D3DShaderArchiveData&   ArchiveData,
+                              DynamicLinearAllocator& Allocator) noexcept(false)
+{
+    if (ShaderCI.ByteCode == nullptr || !D3DShaderArchiveData::IsArchiveData(ShaderCI.ByteCode, ShaderCI.ByteCodeSize))
+        return false;
+
+    Serializer<SerializerMode::Read> Ser{SerializedData{const_cast<void*>(ShaderCI.ByteCode), ShaderCI.ByteCodeSize}};
+    if (!D3DShaderArchiveData::Serialize(Ser, ArchiveData, &Allocator) || ArchiveData.pBytecode == nullptr)
+    {
+        LOG_ERROR_AND_THROW("Failed to read D3D archive data of shader '", (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""),
+                            "'. The archive may be corrupted or invalid.");
+    }
+    VERIFY_EXPR(Ser.IsEnded());
+
+    return true;
+}
+
 } // namespace Diligent
@@ -25,6 +25,9 @@
  *  of the possibility of such damages.
  */
 
+#include <cstring>
+#include <vector>
+
 #include "EngineMemory.h"
 #include "StringTools.hpp"
 #include "ShaderResources.hpp"
@@ -401,4 +404,122 @@ size_t ShaderResources::GetHash() const
     return hash;
 }
 
+bool D3DShaderArchiveData::IsArchiveData(const void* pData, size_t Size)
+{
+    if (pData == nullptr || Size < sizeof(Uint32))
+        return false;
+
+    Uint32 Magic = 0;
+    memcpy(&Magic, pData, sizeof(Magic));
+    return Magic == MagicNumber;
+}
+
+template <SerializerMode Mode>
+bool D3DShaderArchiveData::Serialize(Serializer<Mode>&                                                  Ser,
+                                     typename Serializer<Mode>::template ConstQual<D3DShaderArchiveData>& Data,
+                                     DynamicLinearAllocator*                                            Allocator)
+{
+    Uint32 Magic = MagicNumber;
+    if (!Ser(Magic) || Magic != MagicNumber)
+        return false;
+
+    if (!Ser.SerializeBytes(Data.pBytecode, Data.BytecodeSize))
+        return false;
+
+    // clang-format off
+    if (!Ser(Data.ShaderVersion,
+             Data.Counters.NumCBs,
+             Data.Counters.NumTexSRVs,
+             Data.Counters.NumTexUAVs,
+             Data.Counters.NumBufSRVs,
+             Data.Counters.NumBufUAVs,
+             Data.Counters.NumSamplers,
+             Data.Counters.NumAccelStructs))
+        return false;
+    // clang-format on
+
+    return Ser.SerializeArray(Allocator, Data.pResources, Data.NumResources,
+                              [](Serializer<Mode>& Ser, typename Serializer<Mode>::template ConstQual<Resource>& Res) //
+                              {
+                                  return Ser(Res.Name,
+                                             Res.BindPoint,
+                                             Res.BindCount,
+                                             Res.Space,
+                                             Res.SamplerId,
+                                             Res.InputType,
+                                             Res.SRVDimension);
+                              });
+
+    ASSERT_SIZEOF64(Resource, 32, "Did you add a new member to D3DShaderArchiveData::Resource? Please add serialization here.");
+}
+
+template bool D3DShaderArchiveData::Serialize<SerializerMode::Read>(Serializer<SerializerMode::Read>&, D3DShaderArchiveData&, DynamicLinearAllocator*);
+template bool D3DShaderArchiveData::Serialize<SerializerMode::Write>(Serializer<SerializerMode::Write>&, const D3DShaderArchiveData&, DynamicLinearAllocator*);
+template bool D3DShaderArchiveData::Serialize<SerializerMode::Measure>(Serializer<SerializerMode::Measure>&, const D3DShaderArchiveData&, DynamicLinearAllocator*);
+
+SerializedData D3DShaderArchiveData::Pack(const IDataBlob* pBytecode, const ShaderResources& Resources)
+{
+    VERIFY_EXPR(pBytecode != nullptr);
+
+    std::vector<Resource> ArchivedResources;
+    ArchivedResources.reserve(Resources.GetTotalResources());
+
+    auto AddResource = [&ArchivedResources](const D3DShaderResourceAttribs& Attribs) {
+        ArchivedResources.emplace_back();
+        Resource& Res = ArchivedResources.back();
+
+        Res.Name      = Attribs.Name;
+        Res.BindPoint = Attribs.BindPoint;
+        Res.BindCount = Attribs.BindCount;
+        Res.Space     = Attribs.Space;
+        if (Attribs.GetInputType() == D3D_SIT_TEXTURE && Attribs.GetSRVDimension() != D3D_SRV_DIMENSION_BUFFER)
+            Res.SamplerId = Attribs.GetCombinedSamplerId();
+        Res.InputType    = static_cast<Uint8>(Attribs.GetInputType());
+        Res.SRVDimension = static_cast<Uint8>(Attribs.GetSRVDimension());
+    };
+
+    // Keep the order of resources in the ShaderResources memory buffer (see ShaderResources::Initialize())
+    // clang-format off
+    for (Uint32 n = 0; n < Resources.GetNumCBs();          ++n) AddResource(Resources.GetCB(n));
+    for (Uint32 n = 0; n < Resources.GetNumTexSRV();       ++n) AddResource(Resources.GetTexSRV(n));
+    for (Uint32 n = 0; n < Resources.GetNumTexUAV();       ++n) AddResource(Resources.GetTexUAV(n));
+    for (Uint32 n = 0; n < Resources.GetNumBufSRV();       ++n) AddResource(Resources.GetBufSRV(n));
+    for (Uint32 n = 0; n < Resources.GetNumBufUAV();       ++n) AddResource(Resources.GetBufUAV(n));
+    for (Uint32 n = 0; n < Resources.GetNumSamplers();     ++n) AddResource(Resources.GetSampler(n));
+    for (Uint32 n = 0; n < Resources.GetNumAccelStructs(); ++n) AddResource(Resources.GetAccelStruct(n));
+    // clang-format on
+    VERIFY_EXPR(ArchivedResources.size() == Resources.GetTotalResources());
+
+    D3DShaderArchiveData ArchiveData;
+    ArchiveData.pBytecode     = pBytecode->GetConstDataPtr();
+    ArchiveData.BytecodeSize  = pBytecode->GetSize();
+    ArchiveData.ShaderVersion = Resources.GetShaderVersion();
+    ArchiveData.pResources    = !ArchivedResources.empty() ? ArchivedResources.data() : nullptr;
+    ArchiveData.NumResources  = static_cast<Uint32>(ArchivedResources.size());
+
+    D3DShaderResourceCounters& Counters = ArchiveData.Counters;
+    Counters.NumCBs                     = Resources.GetNumCBs();
+    Counters.NumTexSRVs                 = Resources.GetNumTexSRV();
+    Counters.NumTexUAVs                 = Resources.GetNumTexUAV();
+    Counters.NumBufSRVs                 = Resources.GetNumBufSRV();
+    Counters.NumBufUAVs                 = Resources.GetNumBufUAV();
+    Counters.NumSamplers                = Resources.GetNumSamplers();
+    Counters.NumAccelStructs            = Resources.GetNumAccelStructs();
+
+    SerializedData Data;
+    {
+        Serializer<SerializerMode::Measure> Ser;
+        Serialize(Ser, ArchiveData, nullptr);
+        Data = Ser.AllocateData(GetRawAllocator());
+    }
+
+    {
+        Serializer<SerializerMode::Write> Ser{Data};
+        Serialize(Ser, ArchiveData, nullptr);
+        VERIFY_EXPR(Ser.IsEnded());
+    }
+
+    return Data;
+}
+
 } // namespace Diligent
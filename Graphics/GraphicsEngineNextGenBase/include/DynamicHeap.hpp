@@ -34,6 +34,8 @@
 #include <deque>
 #include <vector>
 #include <atomic>
+#include <memory>
+#include <algorithm>
 #include "VariableSizeAllocationsManager.hpp"
 #include "RingBuffer.hpp"
 
@@ -120,20 +122,137 @@ public:
     ~MasterBlockListBasedManager()
     {
         DEV_CHECK_ERR(m_MasterBlockCounter == 0, m_MasterBlockCounter, " master block(s) have not been returned to the manager");
+        DEV_CHECK_ERR(m_Caches.empty(), m_Caches.size(), " master block cache(s) have not been destroyed");
+    }
+
+    // Per-context cache of free master blocks.
+    //
+    // When the GPU is done with the blocks released by a context, they are returned to the context's
+    // cache instead of the manager, so that the context can reuse them without taking the manager's lock,
+    // which is contended by all contexts. Only blocks of the cache's block size are kept, and no more
+    // than the cache limit; all other blocks are returned to the manager.
+    //
+    // The cache is shared between the context's dynamic heap and the stale blocks in the release queues,
+    // so that the blocks released after the heap has been destroyed find their way back to the manager.
+    class BlockCache
+    {
+    public:
+        explicit BlockCache(MasterBlockListBasedManager& Mgr) :
+            m_Mgr{Mgr}
+        {
+            std::lock_guard<std::mutex> Lock{m_Mgr.m_CachesMtx};
+            m_Mgr.m_Caches.push_back(this);
+        }
+
+        // clang-format off
+        BlockCache            (const BlockCache&)  = delete;
+        BlockCache            (      BlockCache&&) = delete;
+        BlockCache& operator= (const BlockCache&)  = delete;
+        BlockCache& operator= (      BlockCache&&) = delete;
+        // clang-format on
+
+        ~BlockCache()
+        {
+            std::lock_guard<std::mutex> Lock{m_Mgr.m_CachesMtx};
+            m_Mgr.m_Caches.erase(std::find(m_Mgr.m_Caches.begin(), m_Mgr.m_Caches.end(), this));
+            SetLimits(0, 0);
+        }
+
+        // Takes a block from the cache. Returns an invalid block if the cache is empty.
+        MasterBlock Pop()
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            if (m_Blocks.empty())
+                return MasterBlock{};
+
+            MasterBlock Block = std::move(m_Blocks.back());
+            m_Blocks.pop_back();
+            return Block;
+        }
+
+        // Puts the block into the cache. If the block can't be cached, it is returned to the manager.
+        void Push(MasterBlock&& Block)
+        {
+            {
+                std::lock_guard<std::mutex> Lock{m_Mtx};
+                if (IsMatchingSize(Block.Size, m_BlockSize) && m_Blocks.size() < m_MaxBlocks)
+                {
+                    m_Blocks.emplace_back(std::move(Block));
+                    return;
+                }
+            }
+            m_Mgr.FreeMasterBlock(std::move(Block));
+        }
+
+        // Sets the size of the blocks the cache keeps and the maximum number of blocks.
+        // Blocks that don't fit the new limits are returned to the manager.
+        void SetLimits(OffsetType BlockSize, size_t MaxBlocks)
+        {
+            std::vector<MasterBlock> Evicted;
+            {
+                std::lock_guard<std::mutex> Lock{m_Mtx};
+                if (BlockSize != m_BlockSize)
+                    Evicted.swap(m_Blocks);
+                m_BlockSize = BlockSize;
+                m_MaxBlocks = MaxBlocks;
+                while (m_Blocks.size() > m_MaxBlocks)
+                {
+                    Evicted.emplace_back(std::move(m_Blocks.back()));
+                    m_Blocks.pop_back();
+                }
+            }
+            for (MasterBlock& Block : Evicted)
+                m_Mgr.FreeMasterBlock(std::move(Block));
+        }
+
+        // Returns true if a block of the given size can be kept in a cache with the given block size.
+        // The allocated size may be slightly greater than the requested one due to alignment.
+        static bool IsMatchingSize(OffsetType Size, OffsetType BlockSize)
+        {
+            return BlockSize != 0 && Size >= BlockSize && Size < BlockSize * 2;
+        }
+
+        // Returns all cached blocks to the manager
+        void Flush()
+        {
+            std::vector<MasterBlock> Blocks;
+            {
+                std::lock_guard<std::mutex> Lock{m_Mtx};
+                Blocks.swap(m_Blocks);
+            }
+            for (MasterBlock& Block : Blocks)
+                m_Mgr.FreeMasterBlock(std::move(Block));
+        }
+
+    private:
+        MasterBlockListBasedManager& m_Mgr;
+
+        std::mutex               m_Mtx;
+        std::vector<MasterBlock> m_Blocks;
+        OffsetType               m_BlockSize = 0;
+        size_t                   m_MaxBlocks = 0;
+    };
+
+    // Creates a new master block cache for a dynamic heap.
+    std::shared_ptr<BlockCache> CreateBlockCache()
+    {
+        return std::make_shared<BlockCache>(*this);
     }
 
     template <typename RenderDeviceImplType>
-    void ReleaseMasterBlocks(std::vector<MasterBlock>& Blocks, RenderDeviceImplType& Device, Uint64 CmdQueueMask)
+    void ReleaseMasterBlocks(std::vector<MasterBlock>& Blocks, RenderDeviceImplType& Device, Uint64 CmdQueueMask, const std::shared_ptr<BlockCache>& pCache = {})
     {
         struct StaleMasterBlock
         {
             MasterBlock                  Block;
             MasterBlockListBasedManager* Mgr;
+            std::shared_ptr<BlockCache>  pCache;
 
             // clang-format off
-            StaleMasterBlock(MasterBlock&& _Block, MasterBlockListBasedManager* _Mgr)noexcept :
-                Block {std::move(_Block)},
-                Mgr   {_Mgr             }
+            StaleMasterBlock(MasterBlock&& _Block, MasterBlockListBasedManager* _Mgr, std::shared_ptr<BlockCache> _pCache)noexcept :
+                Block {std::move(_Block) },
+                Mgr   {_Mgr              },
+                pCache{std::move(_pCache)}
             {
             }
 
@@ -142,8 +261,9 @@ public:
             StaleMasterBlock& operator= (      StaleMasterBlock&&) = delete;
 
             StaleMasterBlock(StaleMasterBlock&& rhs)noexcept :
-                Block {std::move(rhs.Block)},
-                Mgr   {rhs.Mgr             }
+                Block {std::move(rhs.Block) },
+                Mgr   {rhs.Mgr              },
+                pCache{std::move(rhs.pCache)}
             {
                 rhs.Block = MasterBlock{};
                 rhs.Mgr   = nullptr;
@@ -154,21 +274,29 @@ public:
             {
                 if (Mgr != nullptr)
                 {
-                    std::lock_guard<std::mutex> Lock{Mgr->m_AllocationsMgrMtx};
-#ifdef DILIGENT_DEVELOPMENT
-                    --Mgr->m_MasterBlockCounter;
-#endif
-                    Mgr->m_AllocationsMgr.Free(std::move(Block));
+                    if (pCache)
+                        pCache->Push(std::move(Block));
+                    else
+                        Mgr->FreeMasterBlock(std::move(Block));
                 }
             }
         };
         for (MasterBlock& Block : Blocks)
         {
             DEV_CHECK_ERR(Block.IsValid(), "Attempting to release invalid master block");
-            Device.SafeReleaseDeviceObject(StaleMasterBlock{std::move(Block), this}, CmdQueueMask);
+            Device.SafeReleaseDeviceObject(StaleMasterBlock{std::move(Block), this, pCache}, CmdQueueMask);
         }
     }
 
+    // Returns the blocks kept in all caches to the manager.
+    // This is used as a last resort when the manager runs out of space.
+    void FlushBlockCaches()
+    {
+        std::lock_guard<std::mutex> Lock{m_CachesMtx};
+        for (BlockCache* pCache : m_Caches)
+            pCache->Flush();
+    }
+
     // clang-format off
     OffsetType GetSize()     const { return m_AllocationsMgr.GetMaxSize(); }
     OffsetType GetUsedSize() const { return m_AllocationsMgr.GetUsedSize();}
@@ -196,9 +324,22 @@ protected:
     }
 
 private:
+    void FreeMasterBlock(MasterBlock&& Block)
+    {
+        std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
+#ifdef DILIGENT_DEVELOPMENT
+        --m_MasterBlockCounter;
+#endif
+        m_AllocationsMgr.Free(std::move(Block));
+    }
+
     std::mutex                     m_AllocationsMgrMtx;
     VariableSizeAllocationsManager m_AllocationsMgr;
 
+    // Protects m_Caches. Lock order: m_CachesMtx -> BlockCache::m_Mtx -> m_AllocationsMgrMtx
+    std::mutex               m_CachesMtx;
+    std::vector<BlockCache*> m_Caches;
+
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_MasterBlockCounter;
 #endif
@@ -30,6 +30,9 @@
 #include <vector>
 #include <mutex>
 #include <atomic>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
 
 #include "PrivateConstants.h"
 #include "EngineFactory.h"
@@ -61,17 +64,23 @@ public:
                             const EngineCreateInfo&    EngineCI,
                             const GraphicsAdapterInfo& AdapterInfo) :
         TBase{pRefCounters, RawMemAllocator, pEngineFactory, EngineCI, AdapterInfo},
-        m_CmdQueueCount{CmdQueueCount}
+        m_CmdQueueCount{CmdQueueCount},
+        m_MaxStaleResourcesPerRelease{EngineCI.MaxStaleResourcesPerRelease},
+        m_StaleResourceReleaseTimeBudget{EngineCI.StaleResourceReleaseTimeBudget}
     {
         VERIFY(m_CmdQueueCount < MAX_COMMAND_QUEUES, "The number of command queue is greater than maximum allowed value (", MAX_COMMAND_QUEUES, ")");
 
         m_CommandQueues = ALLOCATE(this->m_RawMemAllocator, "Raw memory for the device command/release queues", CommandQueue, m_CmdQueueCount);
         for (size_t q = 0; q < m_CmdQueueCount; ++q)
             new (m_CommandQueues + q) CommandQueue{RefCntAutoPtr<CommandQueueType>(Queues[q]), this->m_RawMemAllocator};
+
+        if (EngineCI.AsyncStaleResourceRelease)
+            m_ReleaseThread = std::thread{[this]() { ReleaseThreadProc(); }};
     }
 
     ~RenderDeviceNextGenBase()
     {
+        StopReleaseThread();
         DestroyCommandQueues();
     }
 
@@ -144,10 +153,77 @@ public:
 
     void PurgeReleaseQueues(bool ForceRelease = false)
     {
+        if (ForceRelease)
+        {
+            // Resources handed over to the release thread must be destroyed before
+            // the caller can assume that all resources have been released.
+            WaitForReleaseThread();
+        }
+
         for (Uint32 q = 0; q < m_CmdQueueCount; ++q)
             PurgeReleaseQueue(SoftwareQueueIndex{q}, ForceRelease);
     }
 
+    /// Purges the release queues respecting the stale resource release budget and
+    /// hands the resources over to the release thread if it is enabled, see
+    /// EngineCreateInfo::MaxStaleResourcesPerRelease, EngineCreateInfo::StaleResourceReleaseTimeBudget
+    /// and EngineCreateInfo::AsyncStaleResourceRelease.
+    void PurgeReleaseQueuesWithBudget()
+    {
+        const bool UseReleaseThread = m_ReleaseThread.joinable();
+        if (!UseReleaseThread && m_MaxStaleResourcesPerRelease == 0 && m_StaleResourceReleaseTimeBudget == 0)
+        {
+            PurgeReleaseQueues();
+            return;
+        }
+
+        // The time is checked after every batch of resources
+        static constexpr size_t TimeCheckBatchSize = 64;
+
+        const auto                      StartTime = std::chrono::steady_clock::now();
+        const std::chrono::microseconds TimeBudget{m_StaleResourceReleaseTimeBudget};
+        size_t                          Remaining = m_MaxStaleResourcesPerRelease != 0 ? size_t{m_MaxStaleResourcesPerRelease} : ~size_t{0};
+        ReleaseBatch                    Resources;
+        for (Uint32 q = 0; q < m_CmdQueueCount && Remaining > 0; ++q)
+        {
+            ResourceReleaseQueue<DynamicStaleResourceWrapper>& ReleaseQueue = m_CommandQueues[q].ReleaseQueue;
+
+            const Uint64 CompletedFenceValue = m_CommandQueues[q].CmdQueue->GetCompletedFenceValue();
+            if (UseReleaseThread || m_StaleResourceReleaseTimeBudget == 0)
+            {
+                // Moving resources to the release thread is cheap, so only the count budget is applied
+                Remaining -= UseReleaseThread ?
+                    ReleaseQueue.ExtractCompletedResources(CompletedFenceValue, Resources, Remaining) :
+                    ReleaseQueue.Purge(CompletedFenceValue, Remaining);
+                continue;
+            }
+
+            bool OutOfTime = false;
+            while (Remaining > 0)
+            {
+                const size_t NumReleased = ReleaseQueue.Purge(CompletedFenceValue, std::min(Remaining, TimeCheckBatchSize));
+                Remaining -= NumReleased;
+                if (NumReleased < TimeCheckBatchSize)
+                    break;
+
+                OutOfTime = std::chrono::steady_clock::now() - StartTime >= TimeBudget;
+                if (OutOfTime)
+                    break;
+            }
+            if (OutOfTime)
+                break;
+        }
+
+        if (!Resources.empty())
+        {
+            {
+                std::lock_guard<std::mutex> Lock{m_ReleaseThreadMtx};
+                m_ReleaseThreadBatches.emplace_back(std::move(Resources));
+            }
+            m_ReleaseThreadCV.notify_one();
+        }
+    }
+
     void PurgeReleaseQueue(SoftwareQueueIndex QueueInd, bool ForceRelease = false)
     {
         VERIFY_EXPR(QueueInd < m_CmdQueueCount);
@@ -298,6 +374,58 @@ protected:
         }
     }
 
+    using ReleaseBatch = std::vector<DynamicStaleResourceWrapper>;
+
+    void ReleaseThreadProc()
+    {
+        std::unique_lock<std::mutex> Lock{m_ReleaseThreadMtx};
+        while (true)
+        {
+            m_ReleaseThreadCV.wait(Lock, [this]() { return m_StopReleaseThread || !m_ReleaseThreadBatches.empty(); });
+            if (m_ReleaseThreadBatches.empty())
+            {
+                VERIFY_EXPR(m_StopReleaseThread);
+                break;
+            }
+
+            std::vector<ReleaseBatch> Batches;
+            Batches.swap(m_ReleaseThreadBatches);
+            m_ReleaseThreadBusy = true;
+
+            Lock.unlock();
+            // Destroy the resources outside of the lock
+            Batches.clear();
+            Lock.lock();
+
+            m_ReleaseThreadBusy = false;
+            if (m_ReleaseThreadBatches.empty())
+                m_ReleaseThreadIdleCV.notify_all();
+        }
+    }
+
+    void WaitForReleaseThread()
+    {
+        if (!m_ReleaseThread.joinable())
+            return;
+
+        std::unique_lock<std::mutex> Lock{m_ReleaseThreadMtx};
+        m_ReleaseThreadIdleCV.wait(Lock, [this]() { return m_ReleaseThreadBatches.empty() && !m_ReleaseThreadBusy; });
+    }
+
+    void StopReleaseThread()
+    {
+        if (!m_ReleaseThread.joinable())
+            return;
+
+        {
+            std::lock_guard<std::mutex> Lock{m_ReleaseThreadMtx};
+            m_StopReleaseThread = true;
+        }
+        m_ReleaseThreadCV.notify_one();
+        // The thread destroys all remaining batches before exiting
+        m_ReleaseThread.join();
+    }
+
     struct CommandQueue
     {
         CommandQueue(RefCntAutoPtr<CommandQueueType> _CmdQueue, IMemoryAllocator& Allocator) noexcept :
@@ -321,6 +449,18 @@ protected:
     };
     const size_t  m_CmdQueueCount = 0;
     CommandQueue* m_CommandQueues = nullptr;
+
+    const Uint32 m_MaxStaleResourcesPerRelease    = 0;
+    const Uint32 m_StaleResourceReleaseTimeBudget = 0;
+
+    // Background thread that destroys stale resources when EngineCreateInfo::AsyncStaleResourceRelease is enabled
+    std::thread               m_ReleaseThread;
+    std::mutex                m_ReleaseThreadMtx;
+    std::condition_variable   m_ReleaseThreadCV;
+    std::condition_variable   m_ReleaseThreadIdleCV;
+    std::vector<ReleaseBatch> m_ReleaseThreadBatches;
+    bool                      m_ReleaseThreadBusy = false;
+    bool                      m_StopReleaseThread = false;
 };
 
 } // namespace Diligent
@@ -35,6 +35,7 @@
 #include "GLObjectWrapper.hpp"
 #include "AsyncWritableResource.hpp"
 #include "GLContextState.hpp"
+#include "DynamicUniformRingGL.hpp"
 
 namespace Diligent
 {
@@ -85,6 +86,32 @@ public:
     /// Implementation of IBuffer::GetSparseProperties().
     virtual SparseBufferProperties DILIGENT_CALL_TYPE GetSparseProperties() const override final;
 
+    /// Returns true if the buffer memory is suballocated from the dynamic uniform ring
+    /// every time the buffer is mapped (see Diligent::DynamicUniformRingGL).
+    bool UsesDynamicUniformRing() const { return m_UsesDynamicUniformRing; }
+
+    /// Returns the GL buffer object that holds the current buffer contents and adds the
+    /// offset of the contents in that object to Offset. This is the dynamic uniform ring
+    /// page if the buffer has been suballocated from the ring, and the buffer's own object otherwise.
+    const GLObjectWrappers::GLBufferObj& GetCurrentGLBuffer(Uint64& Offset) const
+    {
+        if (m_DynamicUniformRingAlloc)
+        {
+            Offset += m_DynamicUniformRingAlloc.Offset;
+            return m_DynamicUniformRingAlloc.pPage->Buffer;
+        }
+        return m_GlBuffer;
+    }
+
+    /// Inserts a fence after the GPU commands issued so far if the buffer can be read by the CPU.
+    /// This method should be called after every GPU command that writes to the buffer
+    /// (e.g. glCopyBufferSubData or glReadPixels). The fence is used to implement
+    /// MAP_FLAG_DO_NOT_WAIT for MAP_READ access.
+    void FenceGPUWrites();
+
+    /// Returns true if the GPU has completed the writes fenced by FenceGPUWrites().
+    bool AreGPUWritesComplete();
+
 private:
     virtual void CreateViewInternal(const struct BufferViewDesc& ViewDesc, IBufferView** ppView, bool bIsDefaultView) override;
 
@@ -95,6 +122,12 @@ private:
     const Uint32                  m_BindTarget;
     const GLenum                  m_GLUsageHint;
 
+    bool m_UsesDynamicUniformRing = false;
+
+    DynamicUniformRingGL::Allocation m_DynamicUniformRingAlloc;
+
+    GLObjectWrappers::GLSyncObj m_GPUWritesFence;
+
 #if PLATFORM_WEB
     struct MappedData
     {
@@ -28,6 +28,7 @@
 #pragma once
 
 #include <vector>
+#include <memory>
 
 #include "EngineGLImplTraits.hpp"
 #include "DeviceContextBase.hpp"
@@ -61,7 +62,7 @@ public:
     virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
 
     /// Implementation of IDeviceContext::Begin() in OpenGL backend.
-    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::SetPipelineState() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
@@ -79,6 +80,17 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetCullMode() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode) override final;
+
+    /// Implementation of IDeviceContext::SetDepthState() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE SetDepthState(Bool                DepthEnable,
+                                                  Bool                DepthWriteEnable,
+                                                  COMPARISON_FUNCTION DepthFunc) override final;
+
+    /// Implementation of IDeviceContext::SetPrimitiveTopology() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -129,6 +141,8 @@ public:
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::ExecuteIndirectCommands() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawMesh() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawMesh           (const DrawMeshAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawMeshIndirect() in OpenGL backend.
@@ -157,6 +171,9 @@ public:
                                                       const void*                    RGBA,
                                                       RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateRenderTargets() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                                  Uint64                         Offset,
@@ -204,7 +221,7 @@ public:
     virtual void DILIGENT_CALL_TYPE UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice) override final;
 
     /// Implementation of IDeviceContext::GenerateMips() in OpenGL backend.
-    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView) override;
+    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags) override;
 
     /// Implementation of IDeviceContext::FinishFrame() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE FinishFrame() override final;
@@ -239,6 +256,15 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::BeginPoolQuery() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::EndPoolQuery() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::ResolvePoolQueries() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs) override final;
+
     /// Implementation of IDeviceContext::Flush() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -324,6 +350,17 @@ private:
     __forceinline void PrepareForIndirectDrawCount(IBuffer* pCountBuffer);
     __forceinline void PostDraw();
 
+    // Uploads the dynamic uniform data staged since the last flush
+    void FlushDynamicUniformRing()
+    {
+        if (m_pDynamicUniformRing)
+            m_pDynamicUniformRing->Flush(m_ContextState);
+    }
+
+    bool IsNativeMultiDrawIndirectSupported() const;
+    // Uploads the commands to m_MultiDrawCommandsBuffer and binds it to GL_DRAW_INDIRECT_BUFFER
+    void CommitMultiDrawCommands(const void* pCommands, size_t DataSize);
+
     using TBindings = PipelineResourceSignatureGLImpl::TBindings;
     void BindProgramResources(Uint32 BindSRBMask);
 
@@ -365,6 +402,12 @@ private:
     GLObjectWrappers::GLFrameBufferObj m_DefaultFBO;
 
     std::vector<OptimizedClearValue> m_AttachmentClearValues;
+
+    // Null if the device does not support persistently mapped buffers.
+    std::unique_ptr<DynamicUniformRingGL> m_pDynamicUniformRing;
+
+    // Transient indirect buffer used to issue MultiDraw() and MultiDrawIndexed() with a single call
+    GLObjectWrappers::GLBufferObj m_MultiDrawCommandsBuffer{false};
 };
 
 } // namespace Diligent
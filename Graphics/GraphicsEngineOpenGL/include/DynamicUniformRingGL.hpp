@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::DynamicUniformRingGL class
+
+#include <memory>
+#include <vector>
+
+#include "BasicTypes.h"
+#include "GLObjectWrapper.hpp"
+
+namespace Diligent
+{
+
+class GLContextState;
+
+/// Ring of persistently mapped buffers that USAGE_DYNAMIC uniform buffers are suballocated from
+/// when they are mapped.
+
+/// Mapping a dynamic buffer with glMapBufferRange() and GL_MAP_INVALIDATE_BUFFER_BIT makes the driver
+/// orphan the buffer storage or synchronize with the GPU. Instead, the ring allocates its pages with
+/// glBufferStorage(), keeps them mapped with GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT, and hands out
+/// consecutive ranges that are bound with glBindBufferRange().
+///
+/// Allocations keep their page alive. When no buffer references a page anymore, the page is fenced
+/// with glFenceSync() at the end of the frame and is only reused once the GPU has passed the fence.
+///
+/// Persistent mapping requires OpenGL 4.4 or GL_ARB_buffer_storage extension. Without it (e.g. on WebGL
+/// and GLES), the ring keeps a CPU copy of every page and Flush() uploads all ranges written since the
+/// previous flush with a single glBufferSubData() call, so that consecutive updates do not each pay
+/// for a separate upload.
+class DynamicUniformRingGL final
+{
+public:
+    struct Page
+    {
+        GLObjectWrappers::GLBufferObj Buffer{false};
+
+        Uint8* pMappedData = nullptr;
+        Uint32 Size        = 0;
+
+        // CPU copy of the page contents if the page is not persistently mapped
+        std::vector<Uint8> StagingData;
+
+        // Range of StagingData that has been written since the last upload
+        Uint32 DirtyStart = 0;
+        Uint32 DirtyEnd   = 0;
+
+        // Fence that is signaled when the GPU has finished using the page.
+        // Null if the page is in use or has not been released yet.
+        std::shared_ptr<GLObjectWrappers::GLSyncObj> pFence;
+    };
+
+    struct Allocation
+    {
+        std::shared_ptr<Page> pPage;
+        Uint32                Offset = 0;
+
+        explicit operator bool() const
+        {
+            return pPage != nullptr;
+        }
+    };
+
+    DynamicUniformRingGL(Uint32 PageSize, Uint32 OffsetAlignment, bool PersistentlyMapped) noexcept;
+    ~DynamicUniformRingGL();
+
+    // clang-format off
+    DynamicUniformRingGL           (const DynamicUniformRingGL&)  = delete;
+    DynamicUniformRingGL           (      DynamicUniformRingGL&&) = delete;
+    DynamicUniformRingGL& operator=(const DynamicUniformRingGL&)  = delete;
+    DynamicUniformRingGL& operator=(      DynamicUniformRingGL&&) = delete;
+    // clang-format on
+
+    /// Releases the previous allocation and allocates Size bytes from the ring.
+    /// Returns the pointer to the mapped memory, or null if the allocation failed, in which case
+    /// Alloc is left empty.
+    void* Allocate(GLContextState& GLState, Uint32 Size, Allocation& Alloc);
+
+    /// Uploads the data written since the last call to the GPU if the ring is not persistently mapped.
+    /// This method must be called before any command that may read the allocated ranges.
+    void Flush(GLContextState& GLState)
+    {
+        if (m_pCurrPage && m_pCurrPage->DirtyEnd > m_pCurrPage->DirtyStart)
+            UploadStagingData(GLState, *m_pCurrPage);
+    }
+
+    /// Fences the pages that are no longer referenced by any buffer.
+    /// This method should be called at the end of every frame.
+    void FinishFrame();
+
+private:
+    std::shared_ptr<Page> FindOrCreatePage(GLContextState& GLState, Uint32 RequiredSize);
+    void                  UploadStagingData(GLContextState& GLState, Page& DirtyPage);
+
+    const Uint32 m_PageSize;
+    const Uint32 m_OffsetAlignment;
+    const bool   m_PersistentlyMapped;
+
+    std::vector<std::shared_ptr<Page>> m_Pages;
+
+    std::shared_ptr<Page> m_pCurrPage;
+    Uint32                m_CurrOffset = 0;
+};
+
+} // namespace Diligent
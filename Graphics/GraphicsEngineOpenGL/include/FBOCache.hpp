@@ -27,6 +27,9 @@
 
 #pragma once
 
+#include <vector>
+#include <unordered_map>
+
 #include "GraphicsTypes.h"
 #include "TextureView.h"
 #include "SpinLock.hpp"
@@ -58,7 +61,8 @@ public:
                                                         TextureViewGLImpl* ppRTVs[],
                                                         TextureViewGLImpl* pDSV,
                                                         Uint32             DefaultWidth  = 0,
-                                                        Uint32             DefaultHeight = 0);
+                                                        Uint32             DefaultHeight = 0,
+                                                        Uint32             NumViews      = 0);
 
     GLObjectWrappers::GLFrameBufferObj& GetFBO(Uint32             NumRenderTargets,
                                                TextureViewGLImpl* ppRTVs[],
@@ -103,6 +107,8 @@ private:
         std::size_t operator()(const FBOCacheKey& Key) const noexcept;
     };
 
+    // Deletes the FBOs that use textures released since the last call
+    void PurgeStaleEntries();
 
     friend class RenderDeviceGLImpl;
     Threading::SpinLock                                                                      m_CacheLock;
@@ -111,6 +117,10 @@ private:
     // Multimap that sets up correspondence between unique texture id and all
     // FBOs it is used in
     std::unordered_multimap<UniqueIdentifier, FBOCacheKey> m_TexIdToKey;
+
+    // IDs of the textures released since the last PurgeStaleEntries() call
+    Threading::SpinLock           m_StaleIdsLock;
+    std::vector<UniqueIdentifier> m_StaleTextureIds;
 };
 
 } // namespace Diligent
@@ -44,11 +44,13 @@ public:
 
     bool                Invalidate();
     void                Suspend();
+    void                SwapBuffers(int SwapInterval);
     NativeGLContextType GetCurrentNativeGLContext();
 
 private:
-    NativeGLContextType m_GLContext = {};
-    bool                m_IsCreated = false;
+    NativeGLContextType m_GLContext           = {};
+    bool                m_IsCreated           = false;
+    bool                m_ExplicitSwapControl = false;
 };
 
 } // namespace Diligent
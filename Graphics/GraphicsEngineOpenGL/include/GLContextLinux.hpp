@@ -33,7 +33,7 @@ namespace Diligent
 class GLContext
 {
 public:
-    using NativeGLContextType = GLXContext;
+    using NativeGLContextType = void*; // GLXContext or EGLContext
 
     GLContext(const struct EngineGLCreateInfo& InitAttribs,
               RENDER_DEVICE_TYPE&              DevType,
@@ -44,9 +44,21 @@ public:
 
     NativeGLContextType GetCurrentNativeGLContext();
 
+    /// Returns true if the context is a headless EGL context created by the engine.
+    bool IsHeadless() const { return m_EGLContext != nullptr; }
+
 private:
+#if DILIGENT_EGL_SUPPORTED
+    void InitHeadless(const struct EngineGLCreateInfo& InitAttribs);
+#endif
+    void DestroyHeadless();
+
     Uint32 m_WindowId = 0;
     void*  m_pDisplay = nullptr;
+
+    // EGLDisplay and EGLContext of the headless context
+    void* m_EGLDisplay = nullptr;
+    void* m_EGLContext = nullptr;
 };
 
 } // namespace Diligent
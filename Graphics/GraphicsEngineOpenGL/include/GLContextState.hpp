@@ -59,6 +59,15 @@ public:
     void BindImage         (Uint32 Index, class BufferViewGLImpl* pBuffView, GLenum Access, GLenum Format);
     void BindStorageBlock  (Int32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size);
 
+    // Range versions of the methods above that bind Count objects to consecutive slots starting with First.
+    // When GL_ARB_multi_bind is supported, the slots that need to be updated are committed with a single
+    // glBindTextures(), glBindSamplers() or glBindBuffersRange() call. Otherwise, every slot is bound individually.
+    // Null sampler pointers bind the default sampler.
+    void BindTextures      (Uint32 First, Uint32 Count, const GLObjectWrappers::GLTextureObj* const* ppTextures, const GLenum* BindTargets);
+    void BindSamplers      (Uint32 First, Uint32 Count, const GLObjectWrappers::GLSamplerObj* const* ppSamplers);
+    void BindUniformBuffers(Uint32 First, Uint32 Count, const GLObjectWrappers::GLBufferObj* const* ppBuffers, const GLintptr* Offsets, const GLsizeiptr* Sizes);
+    void BindStorageBlocks (Uint32 First, Uint32 Count, const GLObjectWrappers::GLBufferObj* const* ppBuffers, const GLintptr* Offsets, const GLsizeiptr* Sizes);
+
     void EnsureMemoryBarrier(MEMORY_BARRIER RequiredBarriers, class AsyncWritableResource *pRes = nullptr);
     void SetPendingMemoryBarriers(MEMORY_BARRIER PendingBarriers);
 
@@ -116,13 +125,15 @@ public:
 
     struct ContextCaps
     {
-        bool  IsFillModeSelectionSupported = true;
-        bool  IsProgramPipelineSupported   = true;
-        bool  IsDepthClampSupported        = true;
-        bool  IsFramebufferSRGBSupported   = false;
-        GLint MaxCombinedTexUnits          = 0;
-        GLint MaxDrawBuffers               = 0;
-        GLint MaxUniformBufferBindings     = 0;
+        bool  IsFillModeSelectionSupported   = true;
+        bool  IsProgramPipelineSupported     = true;
+        bool  IsDepthClampSupported          = true;
+        bool  IsFramebufferSRGBSupported     = false;
+        GLint MaxCombinedTexUnits            = 0;
+        GLint MaxDrawBuffers                 = 0;
+        GLint MaxUniformBufferBindings       = 0;
+        bool  IsMultiBindSupported           = false;
+        bool  IsVertexAttribBindingSupported = false;
     };
     const ContextCaps& GetContextCaps() { return m_Caps; }
 
@@ -241,6 +252,17 @@ private:
     std::vector<BoundImageInfo>   m_BoundImages;
     std::vector<BoundBufferInfo>  m_BoundStorageBlocks;
 
+    // Scratch space for the handles passed to multi-bind functions
+    std::vector<GLuint> m_MultiBindHandles;
+
+    void BindBuffersRange(GLenum                                     Target,
+                          std::vector<BoundBufferInfo>&              BoundBuffers,
+                          Uint32                                     First,
+                          Uint32                                     Count,
+                          const GLObjectWrappers::GLBufferObj* const* ppBuffers,
+                          const GLintptr*                            Offsets,
+                          const GLsizeiptr*                          Sizes);
+
     MEMORY_BARRIER m_PendingMemoryBarriers = MEMORY_BARRIER_NONE;
 
     class EnableStateHelper
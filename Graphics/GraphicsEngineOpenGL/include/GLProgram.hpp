@@ -32,19 +32,26 @@
 #include "GLObjectWrapper.hpp"
 #include "ShaderResourcesGL.hpp"
 #include "PipelineResourceSignatureGLImpl.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "Timer.hpp"
 
 namespace Diligent
 {
 
 class ShaderGLImpl;
 class GLContextState;
+class PipelineStateCacheGLImpl;
 
 class GLProgram
 {
 public:
-    GLProgram(ShaderGLImpl* const* ppShaders,
-              Uint32               NumShaders,
-              bool                 IsSeparableProgram) noexcept;
+    /// If pCache is not null, the program is first loaded from the binary stored in the cache.
+    /// If the binary is not found or is rejected by the driver, the program is linked from the
+    /// shaders and its binary is added to the cache.
+    GLProgram(ShaderGLImpl* const*      ppShaders,
+              Uint32                    NumShaders,
+              bool                      IsSeparableProgram,
+              PipelineStateCacheGLImpl* pCache = nullptr) noexcept;
     ~GLProgram();
 
     const GLObjectWrappers::GLProgramObj& GetGLHandle() const { return m_GLProg; }
@@ -60,6 +67,14 @@ public:
     };
     LinkStatus GetLinkStatus(bool WaitForCompletion = false) noexcept;
 
+    /// Returns true if the program was loaded from the program binary cache.
+    bool IsLoadedFromBinary() const { return m_LoadedFromBinary; }
+
+    /// Returns the time, in microseconds, from the program creation until the link was found to be complete.
+    /// When the program is linked in parallel (GL_KHR_parallel_shader_compile), this includes the time
+    /// until the link status was queried.
+    Uint64 GetLinkDuration() const { return m_LinkDuration; }
+
     std::shared_ptr<const ShaderResourcesGL>& LoadResources(SHADER_TYPE             ShaderStages,
                                                             PIPELINE_RESOURCE_FLAGS SamplerResourceFlag,
                                                             GLContextState&         State,
@@ -78,12 +93,25 @@ public:
     }
 
 private:
+    bool LoadFromBinary(bool IsSeparableProgram) noexcept;
+    void StoreBinary() noexcept;
+
+private:
+    const Timer m_LinkTimer;
+
     GLObjectWrappers::GLProgramObj   m_GLProg{true};
     std::vector<const ShaderGLImpl*> m_AttachedShaders;
     std::string                      m_InfoLog;
 
-    LinkStatus m_LinkStatus      = LinkStatus::Undefined;
-    bool       m_BindingsApplied = false;
+    // Program binary cache and the key of this program in the cache.
+    // The cache is released once the program is linked.
+    RefCntAutoPtr<PipelineStateCacheGLImpl> m_pCache;
+    Uint64                                  m_CacheKey = 0;
+
+    LinkStatus m_LinkStatus       = LinkStatus::Undefined;
+    bool       m_BindingsApplied  = false;
+    bool       m_LoadedFromBinary = false;
+    Uint64     m_LinkDuration     = 0;
 
     std::shared_ptr<const ShaderResourcesGL> m_pResources;
 
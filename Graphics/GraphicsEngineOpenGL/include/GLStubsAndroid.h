@@ -1474,4 +1474,9 @@ extern PFNGLMULTIDRAWELEMENTSPROC glMultiDrawElements;
 
 #define glMultiDrawElementsBaseVertex(...) UnsupportedGLFunctionStub("glMultiDrawElementsBaseVertex")
 
+// GL_OVR_multiview
+#define LOAD_GL_FRAMEBUFFER_TEXTURE_MULTIVIEW_OVR
+typedef void (GL_APIENTRY* PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC) (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews);
+extern PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC glFramebufferTextureMultiviewOVR;
+
 void LoadGLFunctions();
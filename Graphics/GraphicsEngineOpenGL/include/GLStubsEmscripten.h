@@ -698,6 +698,7 @@ static void (*glPolygonMode)(GLenum face, GLenum mode) = nullptr;
 #define glColorMaski(...)             UnsupportedGLFunctionStub("glColorMaski", __VA_ARGS__)
 #define glFramebufferTexture(...)     UnsupportedGLFunctionStub("glFramebufferTexture", __VA_ARGS__)
 #define glFramebufferTexture1D(...)   UnsupportedGLFunctionStub("glFramebufferTexture1D", __VA_ARGS__)
+#define glFramebufferTextureMultiviewOVR(...) UnsupportedGLFunctionStub("glFramebufferTextureMultiviewOVR", __VA_ARGS__)
 #define glCopyTexSubImage1D(...)      UnsupportedGLFunctionStub("glCopyTexSubImage1D", __VA_ARGS__)
 static void (*glGetQueryObjectui64v)(GLuint id, GLenum pname, GLuint64* params) = nullptr;
 #define glGenProgramPipelines(...)     UnsupportedGLFunctionStub("glGenProgramPipelines", __VA_ARGS__)
@@ -709,3 +710,5 @@ static void (*glGetQueryObjectui64v)(GLuint id, GLenum pname, GLuint64* params)
 #define glDispatchCompute(...)         UnsupportedGLFunctionStub("glDispatchCompute", __VA_ARGS__)
 #define glPatchParameteri(...)         UnsupportedGLFunctionStub("glPatchParameteri", __VA_ARGS__)
 #define glTexStorage2DMultisample(...) UnsupportedGLFunctionStub("glTexStorage2DMultisample", __VA_ARGS__)
+#define glProgramBinary(...)           UnsupportedGLFunctionStub("glProgramBinary", __VA_ARGS__)
+#define glGetProgramBinary(...)        UnsupportedGLFunctionStub("glGetProgramBinary", __VA_ARGS__)
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLWorkerContextPool class
+
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+class RenderDeviceGLImpl;
+class GLContextState;
+
+/// Pool of GL contexts that share objects with the main context of the render device.
+
+/// GL objects can only be created by a thread that has a current context. A thread that
+/// has no current context borrows a worker context from the pool to create a buffer or a
+/// texture with initial data. Before the context is returned, the thread inserts a fence
+/// and waits for it, so the objects are complete before the main context uses them.
+///
+/// \note Shared contexts are only created on Windows (WGL), Linux (GLX, or EGL for headless contexts) and Android (EGL).
+class GLWorkerContextPool final
+{
+public:
+    /// Creates the worker contexts. Must be called by the thread where the main context is current.
+    GLWorkerContextPool(RenderDeviceGLImpl* pDevice, Uint32 NumContexts);
+    ~GLWorkerContextPool();
+
+    // clang-format off
+    GLWorkerContextPool           (const GLWorkerContextPool&)  = delete;
+    GLWorkerContextPool           (      GLWorkerContextPool&&) = delete;
+    GLWorkerContextPool& operator=(const GLWorkerContextPool&)  = delete;
+    GLWorkerContextPool& operator=(      GLWorkerContextPool&&) = delete;
+    // clang-format on
+
+    /// Returns the number of worker contexts that were successfully created.
+    Uint32 GetNumContexts() const { return static_cast<Uint32>(m_Contexts.size()); }
+
+    struct WorkerContext;
+
+    /// Makes one of the worker contexts current on the calling thread for the lifetime of the object.
+
+    /// If all contexts are in use, the constructor waits until one is released.
+    class ScopedContext
+    {
+    public:
+        explicit ScopedContext(GLWorkerContextPool& Pool);
+        ~ScopedContext();
+
+        // clang-format off
+        ScopedContext           (const ScopedContext&)  = delete;
+        ScopedContext           (      ScopedContext&&) = delete;
+        ScopedContext& operator=(const ScopedContext&)  = delete;
+        ScopedContext& operator=(      ScopedContext&&) = delete;
+        // clang-format on
+
+        GLContextState& GetContextState();
+
+    private:
+        GLWorkerContextPool& m_Pool;
+        WorkerContext*       m_pContext = nullptr;
+    };
+
+    /// Returns the state of the worker context that is current on the calling thread,
+    /// or null if the thread does not use a worker context.
+    static GLContextState* GetCurrentContextState();
+
+private:
+    WorkerContext* Acquire();
+    void           Release(WorkerContext* pContext);
+
+    RenderDeviceGLImpl* const m_pDevice;
+
+    std::vector<std::unique_ptr<WorkerContext>> m_Contexts;
+
+    std::mutex                  m_FreeContextsMtx;
+    std::condition_variable     m_FreeContextCV;
+    std::vector<WorkerContext*> m_FreeContexts;
+};
+
+} // namespace Diligent
@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineStateCacheGLImpl class
+
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+#include "EngineGLImplTraits.hpp"
+#include "PipelineStateCacheBase.hpp"
+
+namespace Diligent
+{
+
+/// Pipeline state cache object implementation in OpenGL backend.
+
+/// The cache keeps linked program binaries retrieved with glGetProgramBinary, keyed by
+/// the hash of the program shader sources. Binaries are only valid for the driver that
+/// produced them, so the serialized data is tagged with the vendor, renderer and version
+/// strings and is ignored when loaded on a different driver.
+class PipelineStateCacheGLImpl final : public PipelineStateCacheBase<EngineGLImplTraits>
+{
+public:
+    using TPipelineStateCacheBase = PipelineStateCacheBase<EngineGLImplTraits>;
+
+    PipelineStateCacheGLImpl(IReferenceCounters*                 pRefCounters,
+                             RenderDeviceGLImpl*                 pDeviceGL,
+                             const PipelineStateCacheCreateInfo& CreateInfo);
+    ~PipelineStateCacheGLImpl();
+
+    /// Implementation of IPipelineStateCache::GetData().
+    virtual void DILIGENT_CALL_TYPE GetData(IDataBlob** ppBlob) override final;
+
+    struct ProgramBinary
+    {
+        Uint32             Format = 0;
+        std::vector<Uint8> Data;
+    };
+
+    /// Returns the program binary for the given key, or null if the binary is not found
+    /// or the cache was not created with PSO_CACHE_MODE_LOAD.
+    std::shared_ptr<const ProgramBinary> GetProgramBinary(Uint64 Key) const;
+
+    /// Adds the program binary to the cache. Does nothing if the cache was not created
+    /// with PSO_CACHE_MODE_STORE.
+    void StoreProgramBinary(Uint64 Key, ProgramBinary&& Binary);
+
+    /// Removes the program binary that was rejected by the driver.
+    void RemoveProgramBinary(Uint64 Key);
+
+    bool IsLoadEnabled() const { return (m_Desc.Mode & PSO_CACHE_MODE_LOAD) != 0; }
+    bool IsStoreEnabled() const { return (m_Desc.Mode & PSO_CACHE_MODE_STORE) != 0; }
+
+private:
+    void LoadData(const void* pData, size_t DataSize);
+
+private:
+    // Hash of the GL_VENDOR, GL_RENDERER and GL_VERSION strings.
+    const Uint64 m_DriverHash;
+
+    mutable std::mutex                                              m_BinariesMtx;
+    std::unordered_map<Uint64, std::shared_ptr<const ProgramBinary>> m_Binaries;
+};
+
+} // namespace Diligent
@@ -36,6 +36,7 @@
 #include "BaseInterfacesGL.h"
 #include "FBOCache.hpp"
 #include "GLProgramCache.hpp"
+#include "GLWorkerContextPool.hpp"
 
 namespace Diligent
 {
@@ -120,6 +121,13 @@ public:
     /// Implementation of IRenderDevice::CreateQuery() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE CreateQuery(const QueryDesc& Desc, IQuery** ppQuery) override final;
 
+    /// Implementation of IRenderDevice::CreateQueryPool() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool) override final;
+
+    /// Implementation of IRenderDevice::CreateIndirectCommandSignature() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc,
+                                                                   IIndirectCommandSignature**         ppSignature) override final;
+
     /// Implementation of IRenderDevice::CreateRenderPass() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE CreateRenderPass(const RenderPassDesc& Desc,
                                                      IRenderPass**         ppRenderPass) override final;
@@ -181,6 +189,18 @@ public:
     virtual void DILIGENT_CALL_TYPE CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
                                                        IDeviceMemory**               ppMemory) override final;
 
+    /// Implementation of IRenderDevice::CreatePlacedTexture() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE CreatePlacedTexture(const TextureDesc& TexDesc,
+                                                        IDeviceMemory*     pMemory,
+                                                        Uint64             MemoryOffset,
+                                                        ITexture**         ppTexture) override final;
+
+    /// Implementation of IRenderDevice::CreatePlacedBuffer() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE CreatePlacedBuffer(const BufferDesc& BuffDesc,
+                                                       IDeviceMemory*    pMemory,
+                                                       Uint64            MemoryOffset,
+                                                       IBuffer**         ppBuffer) override final;
+
     /// Implementation of IRenderDevice::CreatePipelineStateCache() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                              IPipelineStateCache**               ppPSOCache) override final;
@@ -193,6 +213,12 @@ public:
                                                                                   RESOURCE_DIMENSION Dimension,
                                                                                   Uint32             SampleCount) const override final;
 
+    /// Implementation of IRenderDevice::GetTextureMemoryRequirements() in OpenGL backend.
+    virtual ResourceMemoryRequirements DILIGENT_CALL_TYPE GetTextureMemoryRequirements(const TextureDesc& TexDesc) const override final;
+
+    /// Implementation of IRenderDevice::GetBufferMemoryRequirements() in OpenGL backend.
+    virtual ResourceMemoryRequirements DILIGENT_CALL_TYPE GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const override final;
+
 #if PLATFORM_WIN32 || PLATFORM_ANDROID
     virtual NativeGLContextAttribs DILIGENT_CALL_TYPE GetNativeGLContextAttribs() const override final;
 #endif
@@ -222,11 +248,21 @@ public:
 
     struct GLDeviceCaps
     {
-        bool FramebufferSRGB  = false;
-        bool SemalessCubemaps = false;
+        bool FramebufferSRGB     = false;
+        bool SemalessCubemaps    = false;
+        bool ProgramBinary       = false;
+        bool BufferStorage       = false;
+        bool MultiBind           = false;
+        bool VertexAttribBinding = false;
     };
     const GLDeviceCaps& GetGLCaps() const { return m_GLCaps; }
 
+    /// Returns the size of the dynamic uniform ring page, or 0 if the ring is disabled.
+    Uint32 GetDynamicUniformRingPageSize() const { return m_DynamicUniformRingPageSize; }
+
+    /// Returns the state of the worker context used by the calling thread, or the state of the immediate context.
+    GLContextState& GetCurrentContextState();
+
 protected:
     friend class DeviceContextGLImpl;
     friend class TextureBaseGL;
@@ -253,6 +289,10 @@ protected:
 private:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
     bool         CheckExtension(const Char* ExtensionString) const;
+
+    // Makes a worker context current if the calling thread has no current GL context.
+    // Returns null if the thread does not need a worker context or the pool is empty.
+    std::unique_ptr<GLWorkerContextPool::ScopedContext> AcquireWorkerContext();
     void         FlagSupportedTexFormats();
     void         InitAdapterInfo();
 
@@ -260,6 +300,11 @@ private:
 
     GLDeviceLimits m_DeviceLimits = {};
     GLDeviceCaps   m_GLCaps       = {};
+
+    Uint32 m_DynamicUniformRingPageSize = 0;
+
+    // Null if EngineGLCreateInfo::NumWorkerContexts is zero or worker contexts are not supported
+    std::unique_ptr<GLWorkerContextPool> m_pWorkerContextPool;
 };
 
 } // namespace Diligent
@@ -71,12 +71,25 @@ public:
         Uint32 RangeSize     = 0;
         Uint32 DynamicOffset = 0;
 
-        // In OpenGL dynamic buffers are only those that are not bound as a whole and
+        // In OpenGL dynamic buffers are those that are not bound as a whole and
         // can use a dynamic offset, irrespective of the variable type or whether the
-        // buffer is USAGE_DYNAMIC or not.
+        // buffer is USAGE_DYNAMIC or not, as well as the buffers that are suballocated
+        // from the dynamic uniform ring every time they are mapped
+        // (see BufferGLImpl::UsesDynamicUniformRing()).
         bool IsDynamic() const
         {
-            return pBuffer && RangeSize < pBuffer->GetDesc().Size;
+            return pBuffer && (RangeSize < pBuffer->GetDesc().Size || pBuffer->UsesDynamicUniformRing());
+        }
+
+        // Returns the GL buffer object to bind and the offset of the bound range in that object.
+        const GLObjectWrappers::GLBufferObj& GetGLBinding(GLintptr& Offset) const
+        {
+            Uint64 BufferOffset = Uint64{BaseOffset} + Uint64{DynamicOffset};
+
+            const GLObjectWrappers::GLBufferObj& GLBuffer = pBuffer->GetCurrentGLBuffer(BufferOffset);
+
+            Offset = static_cast<GLintptr>(BufferOffset);
+            return GLBuffer;
         }
     };
 
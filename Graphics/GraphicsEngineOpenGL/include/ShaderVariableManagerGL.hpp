@@ -100,6 +100,10 @@ public:
     const PipelineResourceDesc& GetResourceDesc(Uint32 Index) const;
     const ResourceAttribs&      GetResourceAttribs(Uint32 Index) const;
 
+    using TBase::GetResourceNameId;
+    using TBase::SetInlineConstants;
+    using TBase::GetInlineConstantsBuffer;
+
     template <typename ThisImplType>
     struct GLVariableBase : public ShaderVariableBase<ThisImplType, ShaderVariableManagerGL>
     {
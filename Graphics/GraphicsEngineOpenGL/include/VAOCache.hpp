@@ -29,6 +29,7 @@
 
 #include <cstring>
 #include <vector>
+#include <list>
 #include <unordered_map>
 
 #include "GraphicsTypes.h"
@@ -44,9 +45,23 @@ namespace Diligent
 class PipelineStateGLImpl;
 class BufferGLImpl;
 
+/// Cache of vertex array objects of one GL context.
+
+/// When the context supports separate attribute formats (GL4.3 or GL_ARB_vertex_attrib_binding),
+/// VAOs only depend on the pipeline state, and vertex and index buffers are rebound to the
+/// cached VAO with glBindVertexBuffer(). Otherwise, VAOs are created for every combination of
+/// the pipeline state, vertex buffers and offsets and the index buffer.
+///
+/// Buffers and pipeline states may be destroyed by any thread. They only record their IDs
+/// in a pending list, and the stale VAOs are deleted by the thread that owns the context
+/// next time the cache is used. The number of cached VAOs is bounded by MaxCacheSize;
+/// least recently used VAOs are released first.
 class VAOCache
 {
 public:
+    /// Maximum number of VAOs in the cache.
+    static constexpr size_t MaxCacheSize = 4096;
+
     VAOCache();
     ~VAOCache();
 
@@ -78,7 +93,7 @@ private:
     // This structure is used as the key to find VAO
     struct VAOHashKey
     {
-        VAOHashKey(const VAOAttribs& Attribs);
+        VAOHashKey(const VAOAttribs& Attribs, bool IncludeBuffers);
 
         // Note that using pointers is unsafe as they may (and will) be reused:
         // pBuffer->Release();
@@ -87,7 +102,9 @@ private:
         // VAO encapsulates both input layout and all bound buffers.
         // PSO uniquely defines the layout (attrib pointers, divisors, etc.),
         // so we do not need to add individual layout elements to the key.
-        // The key needs to contain all bound buffers.
+        // The key needs to contain all bound buffers unless the VAO uses
+        // vertex attrib bindings, in which case the buffers are rebound
+        // to the VAO and the key only contains the PSO.
         UniqueIdentifier PsoUId         = 0;
         UniqueIdentifier IndexBufferUId = 0;
 
@@ -120,15 +137,58 @@ private:
         };
     };
 
+    struct CacheEntry
+    {
+        GLObjectWrappers::GLVertexArrayObj VAO{true};
+
+        // Position of the entry in m_LRUList
+        std::list<const VAOHashKey*>::iterator LRUIt;
+
+        // Buffers currently bound to the VAO, for VAOs that use vertex attrib bindings
+        bool                      UsesAttribBinding   = false;
+        UniqueIdentifier          BoundIndexBufferUId = -1;
+        VAOHashKey::StreamAttribs BoundStreams[MAX_BUFFER_SLOTS];
+
+        CacheEntry()
+        {
+            for (VAOHashKey::StreamAttribs& Stream : BoundStreams)
+                Stream = {-1, 0};
+        }
+    };
+    using CacheType = std::unordered_map<VAOHashKey, CacheEntry, VAOHashKey::Hasher>;
+
+    void CreateVAO(const VAOAttribs& Attribs, GLContextState& GLState, CacheEntry& Entry);
+    void BindAttribBindingBuffers(const VAOAttribs& Attribs, GLContextState& GLState, CacheEntry& Entry);
+
+    // Removes the entry from m_Cache and m_LRUList. The caller must clear the stale keys.
+    void EraseEntry(CacheType::iterator It);
+
+    // Releases the VAOs that use buffers and PSOs destroyed since the last call
+    void PurgeStaleEntries();
+
+    // Releases the least recently used VAOs until there is room for a new one
+    void EvictEntries();
+
     // Clears stale entries from m_PSOToKey and m_BuffToKey when a VAO is removed from m_Cache
     void ClearStaleKeys(const std::vector<VAOHashKey>& StaleKeys);
 
-    Threading::SpinLock                                                                    m_CacheLock;
-    std::unordered_map<VAOHashKey, GLObjectWrappers::GLVertexArrayObj, VAOHashKey::Hasher> m_Cache;
+    Threading::SpinLock m_CacheLock;
+    CacheType           m_Cache;
+
+    // Most recently used entries are at the front
+    std::list<const VAOHashKey*> m_LRUList;
 
     std::unordered_map<UniqueIdentifier, std::vector<VAOHashKey>> m_PSOToKey;
     std::unordered_map<UniqueIdentifier, std::vector<VAOHashKey>> m_BuffToKey;
 
+    // IDs of the objects destroyed since the last PurgeStaleEntries() call
+    Threading::SpinLock           m_StaleIdsLock;
+    std::vector<UniqueIdentifier> m_StaleBufferIds;
+    std::vector<UniqueIdentifier> m_StalePSOIds;
+
+    // Number of entries that use vertex attrib bindings
+    size_t m_NumAttribBindingEntries = 0;
+
     // Any draw command fails if no VAO is bound. We will use this empty
     // VAO for draw commands with null input layout, such as these that
     // only use VertexID as input.
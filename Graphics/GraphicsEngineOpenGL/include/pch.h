@@ -65,6 +65,12 @@
 #    include "GL/glxew.h"
 #    include <GL/glx.h>
 
+#    if DILIGENT_EGL_SUPPORTED
+// Headless contexts are created through EGL
+#        include <EGL/egl.h>
+#        include <EGL/eglext.h>
+#    endif
+
 // Undefine beautiful defines from GL/glx.h -> X11/Xlib.h
 #    ifdef Bool
 #        undef Bool
@@ -80,6 +80,8 @@ DILIGENT_BEGIN_INTERFACE(IEngineFactoryOpenGL, IEngineFactory)
     /// \param [in]  SCDesc             - Swap chain description.
     /// \param [out] ppSwapChain        - Address of the memory location where pointer to
     ///                                   the created swap chain will be written.
+    ///                                   May be null if EngineCI.Headless is true, in which
+    ///                                   case no swap chain is created.
     VIRTUAL void METHOD(CreateDeviceAndSwapChainGL)(THIS_
                                                     const EngineGLCreateInfo REF EngineCI,
                                                     IRenderDevice**              ppDevice,
@@ -150,6 +150,12 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
 
     m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
 
+    // Only suballocate buffers that are never accessed through other bindings, as buffer views
+    // and vertex/index bindings (that are baked into VAOs) would reference the buffer's own object.
+    m_UsesDynamicUniformRing = (m_Desc.Usage == USAGE_DYNAMIC &&
+                                m_Desc.BindFlags == BIND_UNIFORM_BUFFER &&
+                                pDeviceGL->GetDynamicUniformRingPageSize() != 0);
+
     m_GlBuffer.SetName(m_Desc.Name);
 }
 
@@ -251,13 +257,46 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
     // Neither target is used for anything else by OpenGL, and so you can safely bind buffers to them for
     // the purposes of copying or staging data without disturbing OpenGL state or needing to keep track of
     // what was bound to the target before your copy.
+    // The contents of the source buffer are in the dynamic uniform ring page if the buffer has been mapped
+    const GLObjectWrappers::GLBufferObj& SrcGLBuffer = SrcBufferGL.GetCurrentGLBuffer(SrcOffset);
+
     constexpr bool ResetVAO = false; // No need to reset VAO for READ/WRITE targets
     CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GlBuffer, ResetVAO);
-    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.m_GlBuffer, ResetVAO);
+    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcGLBuffer, ResetVAO);
     glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, StaticCast<GLintptr>(SrcOffset), StaticCast<GLintptr>(DstOffset), StaticCast<GLsizeiptr>(Size));
     DEV_CHECK_GL_ERROR("glCopyBufferSubData() failed");
     CtxState.BindBuffer(GL_COPY_READ_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
     CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+
+    FenceGPUWrites();
+}
+
+void BufferGLImpl::FenceGPUWrites()
+{
+    if ((m_Desc.CPUAccessFlags & CPU_ACCESS_READ) == 0)
+        return;
+
+    m_GPUWritesFence = GLObjectWrappers::GLSyncObj{glFenceSync(
+        GL_SYNC_GPU_COMMANDS_COMPLETE, // Condition must always be GL_SYNC_GPU_COMMANDS_COMPLETE
+        0                              // Flags, must be 0
+        )};
+    DEV_CHECK_GL_ERROR("Failed to create gl fence");
+}
+
+bool BufferGLImpl::AreGPUWritesComplete()
+{
+    if (!m_GPUWritesFence)
+        return true;
+
+    const GLenum res = glClientWaitSync(m_GPUWritesFence,
+                                        GL_SYNC_FLUSH_COMMANDS_BIT, // Make sure the fence is eventually signaled
+                                        0                           // Timeout in nanoseconds
+    );
+    if (res != GL_ALREADY_SIGNALED && res != GL_CONDITION_SATISFIED)
+        return false;
+
+    m_GPUWritesFence.Release();
+    return true;
 }
 
 void BufferGLImpl::Map(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFlags, PVoid& pMappedData)
@@ -269,6 +308,12 @@ void BufferGLImpl::Map(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFla
 
 void BufferGLImpl::MapRange(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFlags, Uint64 Offset, Uint64 Length, PVoid& pMappedData)
 {
+    if (MapType == MAP_READ && (MapFlags & MAP_FLAG_DO_NOT_WAIT) != 0 && !AreGPUWritesComplete())
+    {
+        pMappedData = nullptr;
+        return;
+    }
+
     m_Mapped.Type   = MapType;
     m_Mapped.Offset = Offset;
     if (MapType == MAP_READ)
@@ -316,6 +361,13 @@ void BufferGLImpl::Unmap(GLContextState& CtxState)
 
 void BufferGLImpl::MapRange(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFlags, Uint64 Offset, Uint64 Length, PVoid& pMappedData)
 {
+    if (MapType == MAP_READ && (MapFlags & MAP_FLAG_DO_NOT_WAIT) != 0 && !AreGPUWritesComplete())
+    {
+        // The GPU has not finished writing the buffer yet
+        pMappedData = nullptr;
+        return;
+    }
+
     BufferMemoryBarrier(
         MEMORY_BARRIER_CLIENT_MAPPED_BUFFER, // Access by the client to persistent mapped regions of buffer
                                              // objects will reflect data written by shaders prior to the barrier.
@@ -412,9 +464,7 @@ void BufferGLImpl::CreateViewInternal(const BufferViewDesc& OrigViewDesc, IBuffe
         FixedBlockMemoryAllocator& BuffViewAllocator = pDeviceGLImpl->GetBuffViewObjAllocator();
         VERIFY(&BuffViewAllocator == &m_dbgBuffViewAllocator, "Buff view allocator does not match allocator provided at buffer initialization");
 
-        RefCntAutoPtr<DeviceContextGLImpl> pContext = pDeviceGLImpl->GetImmediateContext(0);
-        VERIFY(pContext, "Immediate context has been released");
-        GLContextState& CtxState = pContext->GetContextState();
+        GLContextState& CtxState = pDeviceGLImpl->GetCurrentContextState();
 
         *ppView = NEW_RC_OBJ(BuffViewAllocator, "BufferViewGLImpl instance", BufferViewGLImpl, bIsDefaultView ? this : nullptr)(pDeviceGLImpl, CtxState, ViewDesc, this, bIsDefaultView);
 
@@ -53,6 +53,8 @@
 #include "GLTypeConversions.hpp"
 #include "VAOCache.hpp"
 #include "GraphicsAccessories.hpp"
+#include "Trace.hpp"
+#include "RecordingDeviceContext.hpp"
 
 
 namespace Diligent
@@ -74,15 +76,24 @@ DeviceContextGLImpl::DeviceContextGLImpl(IReferenceCounters*      pRefCounters,
 {
     m_BoundWritableTextures.reserve(16);
     m_BoundWritableBuffers.reserve(16);
+
+    if (const Uint32 PageSize = pDeviceGL->GetDynamicUniformRingPageSize())
+    {
+        GLint OffsetAlignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &OffsetAlignment);
+        CHECK_GL_ERROR("glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT) failed");
+        m_pDynamicUniformRing = std::make_unique<DynamicUniformRingGL>(PageSize, std::max(static_cast<Uint32>(OffsetAlignment), Uint32{16}), pDeviceGL->GetGLCaps().BufferStorage);
+    }
 }
 
 IMPLEMENT_QUERY_INTERFACE(DeviceContextGLImpl, IID_DeviceContextGL, TDeviceContextBase)
 
 
-void DeviceContextGLImpl::Begin(Uint32 ImmediateContextId)
+void DeviceContextGLImpl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
 {
     UNEXPECTED("OpenGL does not support deferred contexts");
     (void)(ImmediateContextId);
+    (void)(Flags);
 }
 
 void DeviceContextGLImpl::SetPipelineState(IPipelineState* pPipelineState)
@@ -171,6 +182,9 @@ void DeviceContextGLImpl::TransitionShaderResources(IShaderResourceBinding* pSha
 
 void DeviceContextGLImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_TRACE_SCOPE("CommitShaderResources");
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Commit};
+
     DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0);
 
     ShaderResourceBindingGLImpl* const pShaderResBindingGL = ClassPtrCast<ShaderResourceBindingGLImpl>(pShaderResourceBinding);
@@ -207,8 +221,8 @@ void DeviceContextGLImpl::SetVertexBuffers(Uint32                         StartS
                                            RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
                                            SET_VERTEX_BUFFERS_FLAGS       Flags)
 {
-    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
-    m_ContextState.InvalidateVAO();
+    if (TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags, 0))
+        m_ContextState.InvalidateVAO();
 }
 
 void DeviceContextGLImpl::InvalidateState()
@@ -226,70 +240,73 @@ void DeviceContextGLImpl::InvalidateState()
 
 void DeviceContextGLImpl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
-    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
-    m_ContextState.InvalidateVAO();
+    if (TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode, 0))
+        m_ContextState.InvalidateVAO();
 }
 
 void DeviceContextGLImpl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
 {
-    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+    const bool ViewportsChanged = TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
 
     VERIFY(NumViewports == m_NumViewports, "Unexpected number of viewports");
-    if (NumViewports == 1)
+    if (ViewportsChanged)
     {
-        const Viewport& vp = m_Viewports[0];
-        // Note that OpenGL and DirectX use different origin of
-        // the viewport in window coordinates:
-        //
-        // DirectX (0,0)
-        //     \ ____________
-        //      |            |
-        //      |            |
-        //      |            |
-        //      |            |
-        //      |____________|
-        //     /
-        //  OpenGL (0,0)
-        //
-        float BottomLeftY = static_cast<float>(RTHeight) - (vp.TopLeftY + vp.Height);
-        float BottomLeftX = vp.TopLeftX;
-
-        Int32 x = static_cast<int>(BottomLeftX);
-        Int32 y = static_cast<int>(BottomLeftY);
-        Int32 w = static_cast<int>(vp.Width);
-        Int32 h = static_cast<int>(vp.Height);
-        if (static_cast<float>(x) == BottomLeftX &&
-            static_cast<float>(y) == BottomLeftY &&
-            static_cast<float>(w) == vp.Width &&
-            static_cast<float>(h) == vp.Height)
+        if (NumViewports == 1)
         {
-            // GL_INVALID_VALUE is generated if either width or height is negative
-            // https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glViewport.xml
-            glViewport(x, y, w, h);
+            const Viewport& vp = m_Viewports[0];
+            // Note that OpenGL and DirectX use different origin of
+            // the viewport in window coordinates:
+            //
+            // DirectX (0,0)
+            //     \ ____________
+            //      |            |
+            //      |            |
+            //      |            |
+            //      |            |
+            //      |____________|
+            //     /
+            //  OpenGL (0,0)
+            //
+            float BottomLeftY = static_cast<float>(RTHeight) - (vp.TopLeftY + vp.Height);
+            float BottomLeftX = vp.TopLeftX;
+
+            Int32 x = static_cast<int>(BottomLeftX);
+            Int32 y = static_cast<int>(BottomLeftY);
+            Int32 w = static_cast<int>(vp.Width);
+            Int32 h = static_cast<int>(vp.Height);
+            if (static_cast<float>(x) == BottomLeftX &&
+                static_cast<float>(y) == BottomLeftY &&
+                static_cast<float>(w) == vp.Width &&
+                static_cast<float>(h) == vp.Height)
+            {
+                // GL_INVALID_VALUE is generated if either width or height is negative
+                // https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glViewport.xml
+                glViewport(x, y, w, h);
+            }
+            else
+            {
+                // GL_INVALID_VALUE is generated if either width or height is negative
+                // https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glViewportIndexed.xhtml
+                glViewportIndexedf(0, BottomLeftX, BottomLeftY, vp.Width, vp.Height);
+            }
+            DEV_CHECK_GL_ERROR("Failed to set viewport");
+
+            glDepthRangef(vp.MinDepth, vp.MaxDepth);
+            DEV_CHECK_GL_ERROR("Failed to set depth range");
         }
         else
         {
-            // GL_INVALID_VALUE is generated if either width or height is negative
-            // https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glViewportIndexed.xhtml
-            glViewportIndexedf(0, BottomLeftX, BottomLeftY, vp.Width, vp.Height);
-        }
-        DEV_CHECK_GL_ERROR("Failed to set viewport");
-
-        glDepthRangef(vp.MinDepth, vp.MaxDepth);
-        DEV_CHECK_GL_ERROR("Failed to set depth range");
-    }
-    else
-    {
-        for (Uint32 i = 0; i < NumViewports; ++i)
-        {
-            const Viewport& vp = m_Viewports[i];
-
-            float BottomLeftY = static_cast<float>(RTHeight) - (vp.TopLeftY + vp.Height);
-            float BottomLeftX = vp.TopLeftX;
-            glViewportIndexedf(i, BottomLeftX, BottomLeftY, vp.Width, vp.Height);
-            DEV_CHECK_GL_ERROR("Failed to set viewport #", i);
-            glDepthRangeIndexed(i, vp.MinDepth, vp.MaxDepth);
-            DEV_CHECK_GL_ERROR("Failed to set depth range for viewport #", i);
+            for (Uint32 i = 0; i < NumViewports; ++i)
+            {
+                const Viewport& vp = m_Viewports[i];
+
+                float BottomLeftY = static_cast<float>(RTHeight) - (vp.TopLeftY + vp.Height);
+                float BottomLeftX = vp.TopLeftX;
+                glViewportIndexedf(i, BottomLeftX, BottomLeftY, vp.Width, vp.Height);
+                DEV_CHECK_GL_ERROR("Failed to set viewport #", i);
+                glDepthRangeIndexed(i, vp.MinDepth, vp.MaxDepth);
+                DEV_CHECK_GL_ERROR("Failed to set depth range for viewport #", i);
+            }
         }
     }
 
@@ -315,7 +332,8 @@ void DeviceContextGLImpl::SetViewports(Uint32 NumViewports, const Viewport* pVie
 
 void DeviceContextGLImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
 {
-    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+    if (!TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight))
+        return;
 
     VERIFY(NumRects == m_NumScissorRects, "Unexpected number of scissor rects");
     if (NumRects == 1)
@@ -694,6 +712,9 @@ void DeviceContextGLImpl::DvpValidateCommittedShaderResources()
     if (m_BindInfo.ResourcesValidated)
         return;
 
+    if (!DvpIsCommandValidationRequired(m_BindInfo))
+        return;
+
     DvpVerifySRBCompatibility(m_BindInfo);
 
     m_pPipelineState->DvpVerifySRBResources(m_BindInfo.ResourceCaches, m_BindInfo.BaseBindings);
@@ -800,6 +821,7 @@ void DeviceContextGLImpl::PrepareForDraw(DRAW_FLAGS Flags, bool IsIndexed, GLenu
     // The program might have changed since the last SetPipelineState call if a shader was
     // created after the call (ShaderResourcesGL needs to bind a program to load uniforms).
     m_pPipelineState->CommitProgram(m_ContextState);
+    FlushDynamicUniformRing();
     if (Uint32 BindSRBMask = m_BindInfo.GetCommitMask(Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT))
     {
         BindProgramResources(BindSRBMask);
@@ -915,22 +937,57 @@ void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
 inline void MultiDrawArrays(GLenum         GlTopology,
                             GLsizei        DrawCount,
                             const GLsizei* NumVertices,
-                            const GLint*   StartVertexLocation,
-                            GLsizei        NumInstances,
-                            GLuint         FirstInstanceLocation)
+                            const GLint*   StartVertexLocation)
 {
-    if (NumInstances > 1 || FirstInstanceLocation != 0)
-    {
-        UNSUPPORTED("Instanced multi-draw is not currently supported in OpenGL");
-    }
-    else
-    {
-        glMultiDrawArrays(GlTopology, StartVertexLocation, NumVertices, DrawCount);
-    }
-
+    glMultiDrawArrays(GlTopology, StartVertexLocation, NumVertices, DrawCount);
     DEV_CHECK_GL_ERROR("MultiDrawArrays failed");
 }
 
+// Command layouts consumed by glMultiDraw*Indirect
+struct DrawArraysIndirectCommand
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLuint baseInstance;
+};
+
+struct DrawElementsIndirectCommand
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint  baseVertex;
+    GLuint baseInstance;
+};
+
+bool DeviceContextGLImpl::IsNativeMultiDrawIndirectSupported() const
+{
+#if GL_ARB_multi_draw_indirect
+    return (m_pDevice->GetAdapterInfo().DrawCommand.CapFlags & DRAW_COMMAND_CAP_FLAG_NATIVE_MULTI_DRAW_INDIRECT) != 0;
+#else
+    return false;
+#endif
+}
+
+void DeviceContextGLImpl::CommitMultiDrawCommands(const void* pCommands, size_t DataSize)
+{
+#if GL_ARB_draw_indirect
+    if (!m_MultiDrawCommandsBuffer)
+        m_MultiDrawCommandsBuffer.Create();
+
+    constexpr bool ResetVAO = false; // GL_DRAW_INDIRECT_BUFFER does not affect VAO
+    m_ContextState.BindBuffer(GL_DRAW_INDIRECT_BUFFER, m_MultiDrawCommandsBuffer, ResetVAO);
+
+    // Reallocate the storage every time so that the driver does not have to wait
+    // for the previous multi-draw command to finish reading the buffer.
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, StaticCast<GLsizeiptr>(DataSize), pCommands, GL_STREAM_DRAW);
+    DEV_CHECK_GL_ERROR("Failed to upload multi-draw commands");
+#else
+    UNSUPPORTED("Indirect rendering is not supported");
+#endif
+}
+
 void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 {
     TDeviceContextBase::MultiDraw(Attribs, 0);
@@ -940,7 +997,40 @@ void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 
     if (Attribs.NumInstances > 0)
     {
-        if (m_NativeMultiDrawSupported)
+        const bool IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+        if (Attribs.DrawCount > 1 && IsNativeMultiDrawIndirectSupported())
+        {
+            // Pack the items into a transient indirect buffer and issue them with a single call
+            m_ScratchSpace.resize(sizeof(DrawArraysIndirectCommand) * Attribs.DrawCount);
+            DrawArraysIndirectCommand* Commands = reinterpret_cast<DrawArraysIndirectCommand*>(m_ScratchSpace.data());
+
+            GLsizei DrawCount = 0;
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+            {
+                const MultiDrawItem& DrawItem = Attribs.pDrawItems[i];
+                if (DrawItem.NumVertices > 0)
+                {
+                    DrawArraysIndirectCommand& Cmd{Commands[DrawCount++]};
+
+                    Cmd.count         = DrawItem.NumVertices;
+                    Cmd.instanceCount = Attribs.NumInstances;
+                    Cmd.first         = DrawItem.StartVertexLocation;
+                    Cmd.baseInstance  = Attribs.FirstInstanceLocation;
+                }
+            }
+            if (DrawCount > 0)
+            {
+#if GL_ARB_multi_draw_indirect
+                CommitMultiDrawCommands(Commands, sizeof(DrawArraysIndirectCommand) * DrawCount);
+                glMultiDrawArraysIndirect(GlTopology, nullptr, DrawCount, 0);
+                DEV_CHECK_GL_ERROR("glMultiDrawArraysIndirect() failed");
+
+                constexpr bool ResetVAO = false; // GL_DRAW_INDIRECT_BUFFER does not affect VAO
+                m_ContextState.BindBuffer(GL_DRAW_INDIRECT_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+#endif
+            }
+        }
+        else if (m_NativeMultiDrawSupported && !IsInstanced)
         {
             size_t NumVerticesDataSize = AlignUp(sizeof(GLsizei) * Attribs.DrawCount, sizeof(void*));
             size_t StartVertexDataSize = AlignUp(sizeof(GLint) * Attribs.DrawCount, sizeof(void*));
@@ -965,9 +1055,7 @@ void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
                 MultiDrawArrays(GlTopology,
                                 DrawCount,
                                 NumVertices,
-                                StartVertexLocation,
-                                Attribs.NumInstances,
-                                Attribs.FirstInstanceLocation);
+                                StartVertexLocation);
             }
         }
         else
@@ -1058,22 +1146,13 @@ inline void MultiDrawElements(GLenum   GlTopology,
                               GLsizei  DrawCount,
                               GLsizei* NumIndices,
                               GLenum   GLIndexType,
-                              GLsizei  NumInstances,
                               void**   FirstIndexByteOffset,
-                              GLint*   BaseVertex,
-                              GLuint   FirstInstanceLocation)
+                              GLint*   BaseVertex)
 {
-    if (NumInstances > 1 || FirstInstanceLocation != 0)
-    {
-        UNSUPPORTED("Instanced multi-draw is not currently supported in OpenGL");
-    }
+    if (BaseVertex != nullptr)
+        glMultiDrawElementsBaseVertex(GlTopology, NumIndices, GLIndexType, FirstIndexByteOffset, DrawCount, BaseVertex);
     else
-    {
-        if (BaseVertex != nullptr)
-            glMultiDrawElementsBaseVertex(GlTopology, NumIndices, GLIndexType, FirstIndexByteOffset, DrawCount, BaseVertex);
-        else
-            glMultiDrawElements(GlTopology, NumIndices, GLIndexType, FirstIndexByteOffset, DrawCount);
-    }
+        glMultiDrawElements(GlTopology, NumIndices, GLIndexType, FirstIndexByteOffset, DrawCount);
 
     DEV_CHECK_GL_ERROR("MultiDrawElements failed");
 }
@@ -1091,8 +1170,45 @@ void DeviceContextGLImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attrib
 
     if (Attribs.NumInstances > 0)
     {
-        const size_t IndexSize = GetValueSize(Attribs.IndexType);
-        if (m_NativeMultiDrawSupported)
+        const size_t IndexSize   = GetValueSize(Attribs.IndexType);
+        const bool   IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+        // Indirect commands specify the first index in elements rather than bytes
+        if (Attribs.DrawCount > 1 && IsNativeMultiDrawIndirectSupported() && (FirstIndexByteOffset % IndexSize) == 0)
+        {
+            // Pack the items into a transient indirect buffer and issue them with a single call
+            m_ScratchSpace.resize(sizeof(DrawElementsIndirectCommand) * Attribs.DrawCount);
+            DrawElementsIndirectCommand* Commands = reinterpret_cast<DrawElementsIndirectCommand*>(m_ScratchSpace.data());
+
+            const Uint32 FirstIndexBias = StaticCast<Uint32>(FirstIndexByteOffset / IndexSize);
+
+            GLsizei DrawCount = 0;
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+            {
+                const MultiDrawIndexedItem& DrawItem = Attribs.pDrawItems[i];
+                if (DrawItem.NumIndices > 0)
+                {
+                    DrawElementsIndirectCommand& Cmd{Commands[DrawCount++]};
+
+                    Cmd.count         = DrawItem.NumIndices;
+                    Cmd.instanceCount = Attribs.NumInstances;
+                    Cmd.firstIndex    = FirstIndexBias + DrawItem.FirstIndexLocation;
+                    Cmd.baseVertex    = DrawItem.BaseVertex;
+                    Cmd.baseInstance  = Attribs.FirstInstanceLocation;
+                }
+            }
+            if (DrawCount > 0)
+            {
+#if GL_ARB_multi_draw_indirect
+                CommitMultiDrawCommands(Commands, sizeof(DrawElementsIndirectCommand) * DrawCount);
+                glMultiDrawElementsIndirect(GlTopology, GLIndexType, nullptr, DrawCount, 0);
+                DEV_CHECK_GL_ERROR("glMultiDrawElementsIndirect() failed");
+
+                constexpr bool ResetVAO = false; // GL_DRAW_INDIRECT_BUFFER does not affect VAO
+                m_ContextState.BindBuffer(GL_DRAW_INDIRECT_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+#endif
+            }
+        }
+        else if (m_NativeMultiDrawSupported && !IsInstanced)
         {
             const size_t IndexDataSize      = AlignUp(sizeof(GLsizei) * Attribs.DrawCount, sizeof(void*));
             const size_t OffsetDataSize     = AlignUp(sizeof(void*) * Attribs.DrawCount, sizeof(void*));
@@ -1125,10 +1241,8 @@ void DeviceContextGLImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attrib
                                   DrawCount,
                                   NumIndices,
                                   GLIndexType,
-                                  Attribs.NumInstances,
                                   Offsets,
-                                  HasBaseVertex ? BaseVertex : nullptr,
-                                  Attribs.FirstInstanceLocation);
+                                  HasBaseVertex ? BaseVertex : nullptr);
             }
         }
         else
@@ -1346,6 +1460,11 @@ void DeviceContextGLImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
     PostDraw();
 }
 
+void DeviceContextGLImpl::ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs)
+{
+    UNSUPPORTED("ExecuteIndirectCommands is not supported in OpenGL");
+}
+
 void DeviceContextGLImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
     UNSUPPORTED("DrawMesh is not supported in OpenGL");
@@ -1365,6 +1484,7 @@ void DeviceContextGLImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
     // The program might have changed since the last SetPipelineState call if a shader was
     // created after the call (ShaderResourcesGL needs to bind a program to load uniforms).
     m_pPipelineState->CommitProgram(m_ContextState);
+    FlushDynamicUniformRing();
     if (Uint32 BindSRBMask = m_BindInfo.GetCommitMask())
     {
         BindProgramResources(BindSRBMask);
@@ -1395,6 +1515,7 @@ void DeviceContextGLImpl::DispatchComputeIndirect(const DispatchComputeIndirectA
     // The program might have changed since the last SetPipelineState call if a shader was
     // created after the call (ShaderResourcesGL needs to bind a program to load uniforms).
     m_pPipelineState->CommitProgram(m_ContextState);
+    FlushDynamicUniformRing();
     if (Uint32 BindSRBMask = m_BindInfo.GetCommitMask())
     {
         BindProgramResources(BindSRBMask);
@@ -1551,29 +1672,91 @@ void DeviceContextGLImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
     m_ContextState.EnableScissorTest(ScissorTestEnabled);
 }
 
+void DeviceContextGLImpl::InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil)
+{
+    TDeviceContextBase::InvalidateRenderTargets(RenderTargetMask, InvalidateDepthStencil);
+
+    if (glInvalidateFramebuffer == nullptr)
+        return;
+
+    // Render targets are committed by SetRenderTargets(), so the framebuffer is currently bound.
+    // Attachments of the window-system-provided framebuffer are identified by GL_COLOR, GL_DEPTH and GL_STENCIL.
+    const bool IsWindowFramebuffer = m_IsDefaultFBOBound && m_pSwapChain->GetDefaultFBO() == 0;
+
+    GLsizei                                    InvalidateAttachmentsCount = 0;
+    std::array<GLenum, MAX_RENDER_TARGETS + 2> InvalidateAttachments;
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        if ((RenderTargetMask & (1u << rt)) != 0 && m_pBoundRenderTargets[rt])
+            InvalidateAttachments[InvalidateAttachmentsCount++] = IsWindowFramebuffer ? GL_COLOR : GL_COLOR_ATTACHMENT0 + rt;
+    }
+
+    if (InvalidateDepthStencil && m_pBoundDepthStencil && m_pBoundDepthStencil->GetDesc().ViewType == TEXTURE_VIEW_DEPTH_STENCIL)
+    {
+        const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(m_pBoundDepthStencil->GetDesc().Format);
+        if (IsWindowFramebuffer)
+        {
+            InvalidateAttachments[InvalidateAttachmentsCount++] = GL_DEPTH;
+            if (FmtAttribs.ComponentType == COMPONENT_TYPE_DEPTH_STENCIL)
+                InvalidateAttachments[InvalidateAttachmentsCount++] = GL_STENCIL;
+        }
+        else
+        {
+            InvalidateAttachments[InvalidateAttachmentsCount++] = FmtAttribs.ComponentType == COMPONENT_TYPE_DEPTH ? GL_DEPTH_ATTACHMENT : GL_DEPTH_STENCIL_ATTACHMENT;
+        }
+    }
+
+    if (InvalidateAttachmentsCount > 0)
+    {
+        glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, InvalidateAttachmentsCount, InvalidateAttachments.data());
+        DEV_CHECK_GL_ERROR("glInvalidateFramebuffer() failed");
+    }
+}
+
 void DeviceContextGLImpl::Flush()
 {
+    DILIGENT_TRACE_SCOPE("Flush");
+
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
+    UpdateGPUFrameTimer();
 
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Submit};
     glFlush();
+    ++m_Stats.QueueSubmits;
 
     m_BindInfo = {};
 }
 
 void DeviceContextGLImpl::FinishFrame()
 {
+    if (m_pDynamicUniformRing)
+        m_pDynamicUniformRing->FinishFrame();
+
     TDeviceContextBase::EndFrame();
 }
 
 void DeviceContextGLImpl::FinishCommandList(ICommandList** ppCommandList)
 {
-    LOG_ERROR("Deferred contexts are not supported in OpenGL mode");
+    LOG_ERROR("Command lists can only be finished by deferred contexts");
 }
 
 void DeviceContextGLImpl::ExecuteCommandLists(Uint32               NumCommandLists,
                                               ICommandList* const* ppCommandLists)
 {
-    LOG_ERROR("Deferred contexts are not supported in OpenGL mode");
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        RefCntAutoPtr<RecordedCommandList> pRecordedCmdList{ppCommandLists[i], IID_RecordedCommandList};
+        if (!pRecordedCmdList)
+        {
+            DEV_ERROR("Command list ", i, " was not recorded by an OpenGL deferred context");
+            continue;
+        }
+        pRecordedCmdList->Execute(this);
+    }
 }
 
 void DeviceContextGLImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
@@ -1707,6 +1890,21 @@ void DeviceContextGLImpl::EndQuery(IQuery* pQuery)
     }
 }
 
+void DeviceContextGLImpl::BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    UNSUPPORTED("BeginPoolQuery is not supported in OpenGL");
+}
+
+void DeviceContextGLImpl::EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    UNSUPPORTED("EndPoolQuery is not supported in OpenGL");
+}
+
+void DeviceContextGLImpl::ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs)
+{
+    UNSUPPORTED("ResolvePoolQueries is not supported in OpenGL");
+}
+
 bool DeviceContextGLImpl::UpdateCurrentGLContext()
 {
     GLContext::NativeGLContextType NativeGLContext = m_pDevice->m_GLContext.GetCurrentNativeGLContext();
@@ -1748,6 +1946,8 @@ void DeviceContextGLImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
 
     BufferGLImpl* pSrcBufferGL = ClassPtrCast<BufferGLImpl>(pSrcBuffer);
     BufferGLImpl* pDstBufferGL = ClassPtrCast<BufferGLImpl>(pDstBuffer);
+    // The source may be suballocated from the dynamic uniform ring
+    FlushDynamicUniformRing();
     pDstBufferGL->CopyData(m_ContextState, *pSrcBufferGL, SrcOffset, DstOffset, Size);
 }
 
@@ -1755,6 +1955,26 @@ void DeviceContextGLImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAG
 {
     TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
     BufferGLImpl* pBufferGL = ClassPtrCast<BufferGLImpl>(pBuffer);
+
+    if (m_pDynamicUniformRing && MapType == MAP_WRITE && pBufferGL->UsesDynamicUniformRing())
+    {
+        DynamicUniformRingGL::Allocation& Alloc = pBufferGL->m_DynamicUniformRingAlloc;
+        if ((MapFlags & MAP_FLAG_NO_OVERWRITE) != 0)
+        {
+            // Ring pages stay mapped, so keep writing to the current allocation
+            if (Alloc)
+                pMappedData = Alloc.pPage->pMappedData + Alloc.Offset;
+        }
+        else
+        {
+            pMappedData = m_pDynamicUniformRing->Allocate(m_ContextState, StaticCast<Uint32>(pBufferGL->GetDesc().Size), Alloc);
+        }
+
+        if (Alloc)
+            return;
+        // Fall back to mapping the buffer's own storage
+    }
+
     pBufferGL->Map(m_ContextState, MapType, MapFlags, pMappedData);
 }
 
@@ -1762,6 +1982,11 @@ void DeviceContextGLImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
 {
     TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
     BufferGLImpl* pBufferGL = ClassPtrCast<BufferGLImpl>(pBuffer);
+
+    // Ring pages are coherently mapped, so there is nothing to flush
+    if (pBufferGL->m_DynamicUniformRingAlloc)
+        return;
+
     pBufferGL->Unmap(m_ContextState);
 }
 
@@ -1878,6 +2103,8 @@ void DeviceContextGLImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
         glReadPixels(pSrcBox->MinX, pSrcBox->MinY, pSrcBox->Width(), pSrcBox->Height(),
                      TransferAttribs.PixelFormat, TransferAttribs.DataType, reinterpret_cast<void*>(StaticCast<size_t>(DstOffset)));
         DEV_CHECK_GL_ERROR("Failed to read pixel from framebuffer to pixel pack buffer");
+        // Let MapTextureSubresource() with MAP_FLAG_DO_NOT_WAIT check if the read has completed
+        pDstBuffer->FenceGPUWrites();
 
         m_ContextState.BindBuffer(GL_PIXEL_PACK_BUFFER, GLObjectWrappers::GLBufferObj::Null(), true);
         // Restore original FBO
@@ -1909,6 +2136,12 @@ void DeviceContextGLImpl::MapTextureSubresource(ITexture*                 pTextu
         MipLevelProperties MipLevelAttribs = GetMipLevelProperties(TexDesc, MipLevel);
         BufferGLImpl*      pPBO            = ClassPtrCast<BufferGLImpl>(pTexGL->GetPBO());
         pPBO->MapRange(m_ContextState, MapType, MapFlags, PBOOffset, MipLevelAttribs.MipSize, MappedData.pData);
+        if (MappedData.pData == nullptr)
+        {
+            // MAP_FLAG_DO_NOT_WAIT is specified and the GPU has not finished writing the texture yet
+            MappedData = MappedTextureSubresource{};
+            return;
+        }
 
         MappedData.Stride      = MipLevelAttribs.RowSize;
         MappedData.DepthStride = MipLevelAttribs.MipSize;
@@ -1937,9 +2170,9 @@ void DeviceContextGLImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 Mip
     }
 }
 
-void DeviceContextGLImpl::GenerateMips(ITextureView* pTexView)
+void DeviceContextGLImpl::GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags)
 {
-    TDeviceContextBase::GenerateMips(pTexView);
+    TDeviceContextBase::GenerateMips(pTexView, Flags);
     TextureViewGLImpl* pTexViewGL = ClassPtrCast<TextureViewGLImpl>(pTexView);
     GLenum             BindTarget = pTexViewGL->GetBindTarget();
     m_ContextState.BindTexture(-1, BindTarget, pTexViewGL->GetHandle());
@@ -2082,6 +2315,21 @@ void DeviceContextGLImpl::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_COM
     UNSUPPORTED("SetShadingRate is not supported in OpenGL");
 }
 
+void DeviceContextGLImpl::SetCullMode(CULL_MODE CullMode)
+{
+    UNSUPPORTED("SetCullMode is not supported in OpenGL");
+}
+
+void DeviceContextGLImpl::SetDepthState(Bool DepthEnable, Bool DepthWriteEnable, COMPARISON_FUNCTION DepthFunc)
+{
+    UNSUPPORTED("SetDepthState is not supported in OpenGL");
+}
+
+void DeviceContextGLImpl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    UNSUPPORTED("SetPrimitiveTopology is not supported in OpenGL");
+}
+
 void DeviceContextGLImpl::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
 {
     UNSUPPORTED("BindSparseResourceMemory is not supported in OpenGL");
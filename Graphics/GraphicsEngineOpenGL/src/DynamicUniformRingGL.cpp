@@ -0,0 +1,194 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+
+#include "pch.h"
+
+#include "DynamicUniformRingGL.hpp"
+
+#include "GLContextState.hpp"
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+#include "FormatString.hpp"
+
+namespace Diligent
+{
+
+DynamicUniformRingGL::DynamicUniformRingGL(Uint32 PageSize, Uint32 OffsetAlignment, bool PersistentlyMapped) noexcept :
+    m_PageSize{AlignUp(PageSize, OffsetAlignment)},
+    m_OffsetAlignment{OffsetAlignment},
+    m_PersistentlyMapped{PersistentlyMapped}
+{
+    VERIFY(IsPowerOfTwo(OffsetAlignment), "Offset alignment (", OffsetAlignment, ") must be a power of two");
+}
+
+DynamicUniformRingGL::~DynamicUniformRingGL()
+{
+    Uint64 TotalSize = 0;
+    for (const std::shared_ptr<Page>& pPage : m_Pages)
+        TotalSize += pPage->Size;
+
+    LOG_INFO_MESSAGE("Dynamic uniform ring: created ", m_Pages.size(), (m_Pages.size() == 1 ? " page" : " pages"),
+                     " (", FormatMemorySize(TotalSize), ")");
+}
+
+void DynamicUniformRingGL::FinishFrame()
+{
+    // A page that is only referenced by the ring is not used by any buffer, but the GPU may still
+    // be reading its contents. All commands that use the page have been issued at this point,
+    // so one fence is enough for all such pages.
+    std::shared_ptr<GLObjectWrappers::GLSyncObj> pFence;
+    for (const std::shared_ptr<Page>& pPage : m_Pages)
+    {
+        if (pPage.use_count() != 1 || pPage->pFence)
+            continue;
+
+        if (!pFence)
+        {
+            pFence = std::make_shared<GLObjectWrappers::GLSyncObj>(glFenceSync(
+                GL_SYNC_GPU_COMMANDS_COMPLETE, // Condition must always be GL_SYNC_GPU_COMMANDS_COMPLETE
+                0                              // Flags, must be 0
+                ));
+            DEV_CHECK_GL_ERROR("Failed to create gl fence");
+        }
+        pPage->pFence = pFence;
+    }
+}
+
+std::shared_ptr<DynamicUniformRingGL::Page> DynamicUniformRingGL::FindOrCreatePage(GLContextState& GLState, Uint32 RequiredSize)
+{
+    for (const std::shared_ptr<Page>& pPage : m_Pages)
+    {
+        if (pPage.use_count() != 1 || !pPage->pFence || pPage->Size < RequiredSize)
+            continue;
+
+        const GLenum res = glClientWaitSync(*pPage->pFence,
+                                            0, // Can be SYNC_FLUSH_COMMANDS_BIT
+                                            0  // Timeout in nanoseconds
+        );
+        if (res == GL_ALREADY_SIGNALED || res == GL_CONDITION_SATISFIED)
+        {
+            pPage->pFence.reset();
+            return pPage;
+        }
+    }
+
+    std::shared_ptr<Page> pPage = std::make_shared<Page>();
+    pPage->Size                 = std::max(m_PageSize, AlignUp(RequiredSize, m_OffsetAlignment));
+    pPage->Buffer               = GLObjectWrappers::GLBufferObj{true};
+
+    // GL_COPY_WRITE_BUFFER target is not used for anything else, so there is no need to reset VAO
+    constexpr bool   ResetVAO = false;
+    constexpr GLenum Target   = GL_COPY_WRITE_BUFFER;
+    GLState.BindBuffer(Target, pPage->Buffer, ResetVAO);
+
+    if (m_PersistentlyMapped)
+    {
+#if GL_ARB_buffer_storage
+        constexpr GLbitfield StorageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(Target, StaticCast<GLsizeiptr>(pPage->Size), nullptr, StorageFlags);
+        if (glGetError() == GL_NO_ERROR)
+        {
+            pPage->pMappedData = static_cast<Uint8*>(glMapBufferRange(Target, 0, StaticCast<GLsizeiptr>(pPage->Size), StorageFlags));
+            DEV_CHECK_GL_ERROR("glMapBufferRange() failed");
+        }
+#else
+        UNEXPECTED("Persistently mapped dynamic uniform ring requires GL_ARB_buffer_storage");
+#endif
+    }
+    else
+    {
+        glBufferData(Target, StaticCast<GLsizeiptr>(pPage->Size), nullptr, GL_DYNAMIC_DRAW);
+        if (glGetError() == GL_NO_ERROR)
+        {
+            pPage->StagingData.resize(pPage->Size);
+            pPage->pMappedData = pPage->StagingData.data();
+        }
+    }
+    GLState.BindBuffer(Target, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+
+    if (pPage->pMappedData == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to create dynamic uniform ring page of size ", FormatMemorySize(pPage->Size));
+        return {};
+    }
+
+    pPage->Buffer.SetName("Dynamic uniform ring page");
+
+    m_Pages.emplace_back(pPage);
+    return pPage;
+}
+
+void DynamicUniformRingGL::UploadStagingData(GLContextState& GLState, Page& DirtyPage)
+{
+    VERIFY_EXPR(!m_PersistentlyMapped && DirtyPage.DirtyEnd > DirtyPage.DirtyStart && DirtyPage.DirtyEnd <= DirtyPage.Size);
+
+    constexpr bool   ResetVAO = false;
+    constexpr GLenum Target   = GL_COPY_WRITE_BUFFER;
+    GLState.BindBuffer(Target, DirtyPage.Buffer, ResetVAO);
+    glBufferSubData(Target, DirtyPage.DirtyStart, DirtyPage.DirtyEnd - DirtyPage.DirtyStart, DirtyPage.StagingData.data() + DirtyPage.DirtyStart);
+    DEV_CHECK_GL_ERROR("glBufferSubData() failed");
+    GLState.BindBuffer(Target, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+
+    DirtyPage.DirtyStart = 0;
+    DirtyPage.DirtyEnd   = 0;
+}
+
+void* DynamicUniformRingGL::Allocate(GLContextState& GLState, Uint32 Size, Allocation& Alloc)
+{
+    // Release the previous allocation first so that its page can be reused
+    Alloc = {};
+
+    const Uint32 AlignedSize = AlignUp(Size, m_OffsetAlignment);
+    if (!m_pCurrPage || m_CurrOffset + AlignedSize > m_pCurrPage->Size)
+    {
+        // Upload the remaining data before switching to another page
+        Flush(GLState);
+        m_pCurrPage.reset();
+        m_pCurrPage  = FindOrCreatePage(GLState, AlignedSize);
+        m_CurrOffset = 0;
+        if (!m_pCurrPage)
+            return nullptr;
+    }
+
+    Alloc.pPage  = m_pCurrPage;
+    Alloc.Offset = m_CurrOffset;
+    m_CurrOffset += AlignedSize;
+
+    if (!m_PersistentlyMapped)
+    {
+        // Allocations are consecutive, so the ranges written since the last upload are contiguous
+        Page& CurrPage = *m_pCurrPage;
+        if (CurrPage.DirtyEnd == CurrPage.DirtyStart)
+            CurrPage.DirtyStart = Alloc.Offset;
+        CurrPage.DirtyEnd = Alloc.Offset + Size;
+    }
+
+    return m_pCurrPage->pMappedData + Alloc.Offset;
+}
+
+} // namespace Diligent
@@ -209,13 +209,14 @@ void EngineFactoryOpenGLImpl::CreateDeviceAndSwapChainGL(const EngineGLCreateInf
         return;
     }
 
-    VERIFY(ppDevice && ppImmediateContext && ppSwapChain, "Null pointer provided");
-    if (!ppDevice || !ppImmediateContext || !ppSwapChain)
+    // Headless devices do not have a swap chain
+    VERIFY(ppDevice && ppImmediateContext && (ppSwapChain || EngineCI.Headless), "Null pointer provided");
+    if (!ppDevice || !ppImmediateContext || !(ppSwapChain || EngineCI.Headless))
         return;
 
     if (EngineCI.NumDeferredContexts > 0)
     {
-        LOG_ERROR_MESSAGE("OpenGL back-end does not support deferred contexts");
+        LOG_ERROR_MESSAGE("OpenGL back-end does not create deferred contexts at initialization. Use IRenderDevice::CreateDeferredContext() instead.");
         return;
     }
 
@@ -227,13 +228,18 @@ void EngineFactoryOpenGLImpl::CreateDeviceAndSwapChainGL(const EngineGLCreateInf
 
     *ppDevice           = nullptr;
     *ppImmediateContext = nullptr;
-    *ppSwapChain        = nullptr;
+    if (ppSwapChain != nullptr)
+        *ppSwapChain = nullptr;
 
     try
     {
         GraphicsAdapterInfo AdapterInfo;
         SetDefaultGraphicsAdapterInfo(AdapterInfo);
         VerifyEngineCreateInfo(EngineCI, AdapterInfo);
+#if !PLATFORM_LINUX
+        if (EngineCI.Headless)
+            LOG_ERROR_AND_THROW("Headless GL context is only supported on Linux");
+#endif
 
         IMemoryAllocator& RawMemAllocator = GetRawAllocator();
 
@@ -261,10 +267,13 @@ void EngineFactoryOpenGLImpl::CreateDeviceAndSwapChainGL(const EngineGLCreateInf
         pDeviceContextOpenGL->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppImmediateContext));
         pRenderDeviceOpenGL->SetImmediateContext(0, pDeviceContextOpenGL);
 
-        TSwapChain* pSwapChainGL = NEW_RC_OBJ(RawMemAllocator, "SwapChainGLImpl instance", TSwapChain)(EngineCI, SCDesc, pRenderDeviceOpenGL, pDeviceContextOpenGL);
-        pSwapChainGL->QueryInterface(IID_SwapChain, reinterpret_cast<IObject**>(ppSwapChain));
+        if (!EngineCI.Headless)
+        {
+            TSwapChain* pSwapChainGL = NEW_RC_OBJ(RawMemAllocator, "SwapChainGLImpl instance", TSwapChain)(EngineCI, SCDesc, pRenderDeviceOpenGL, pDeviceContextOpenGL);
+            pSwapChainGL->QueryInterface(IID_SwapChain, reinterpret_cast<IObject**>(ppSwapChain));
 
-        pDeviceContextOpenGL->SetSwapChain(pSwapChainGL);
+            pDeviceContextOpenGL->SetSwapChain(pSwapChainGL);
+        }
     }
     catch (const std::runtime_error&)
     {
@@ -280,7 +289,7 @@ void EngineFactoryOpenGLImpl::CreateDeviceAndSwapChainGL(const EngineGLCreateInf
             *ppImmediateContext = nullptr;
         }
 
-        if (*ppSwapChain)
+        if (ppSwapChain != nullptr && *ppSwapChain)
         {
             (*ppSwapChain)->Release();
             *ppSwapChain = nullptr;
@@ -314,7 +323,7 @@ void EngineFactoryOpenGLImpl::AttachToActiveGLContext(const EngineGLCreateInfo&
 
     if (EngineCI.NumDeferredContexts > 0)
     {
-        LOG_ERROR_MESSAGE("OpenGL back-end does not support deferred contexts");
+        LOG_ERROR_MESSAGE("OpenGL back-end does not create deferred contexts at initialization. Use IRenderDevice::CreateDeferredContext() instead.");
         return;
     }
 
@@ -324,6 +333,12 @@ void EngineFactoryOpenGLImpl::AttachToActiveGLContext(const EngineGLCreateInfo&
         return;
     }
 
+    if (EngineCI.Headless)
+    {
+        LOG_ERROR_MESSAGE("Headless GL context must be created by CreateDeviceAndSwapChainGL()");
+        return;
+    }
+
     *ppDevice           = nullptr;
     *ppImmediateContext = nullptr;
 
@@ -91,6 +91,8 @@ FBOCache::FBOCache()
 
 FBOCache::~FBOCache()
 {
+    PurgeStaleEntries();
+
 #ifdef DILIGENT_DEBUG
     for (const auto& fbo_it : m_Cache)
     {
@@ -103,16 +105,34 @@ FBOCache::~FBOCache()
 
 void FBOCache::OnReleaseTexture(ITexture* pTexture)
 {
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
-
+    // The texture may be released by any thread, while FBOs must be deleted by the thread
+    // that owns the context. Unique IDs are never reused, so stale FBOs can't be found by new keys.
     TextureBaseGL* pTexGL = ClassPtrCast<TextureBaseGL>(pTexture);
-    // Find all FBOs that this texture used in
-    auto EqualRange = m_TexIdToKey.equal_range(pTexGL->GetUniqueID());
-    for (auto It = EqualRange.first; It != EqualRange.second; ++It)
+
+    Threading::SpinLockGuard StaleIdsGuard{m_StaleIdsLock};
+    m_StaleTextureIds.push_back(pTexGL->GetUniqueID());
+}
+
+void FBOCache::PurgeStaleEntries()
+{
+    std::vector<UniqueIdentifier> StaleTextureIds;
     {
-        m_Cache.erase(It->second);
+        Threading::SpinLockGuard StaleIdsGuard{m_StaleIdsLock};
+        if (m_StaleTextureIds.empty())
+            return;
+        StaleTextureIds.swap(m_StaleTextureIds);
+    }
+
+    for (const UniqueIdentifier TexId : StaleTextureIds)
+    {
+        // Find all FBOs that this texture used in
+        auto EqualRange = m_TexIdToKey.equal_range(TexId);
+        for (auto It = EqualRange.first; It != EqualRange.second; ++It)
+        {
+            m_Cache.erase(It->second);
+        }
+        m_TexIdToKey.erase(EqualRange.first, EqualRange.second);
     }
-    m_TexIdToKey.erase(EqualRange.first, EqualRange.second);
 }
 
 void FBOCache::Clear()
@@ -121,6 +141,9 @@ void FBOCache::Clear()
 
     m_Cache.clear();
     m_TexIdToKey.clear();
+
+    Threading::SpinLockGuard StaleIdsGuard{m_StaleIdsLock};
+    m_StaleTextureIds.clear();
 }
 
 GLObjectWrappers::GLFrameBufferObj FBOCache::CreateFBO(GLContextState&    ContextState,
@@ -128,12 +151,21 @@ GLObjectWrappers::GLFrameBufferObj FBOCache::CreateFBO(GLContextState&    Contex
                                                        TextureViewGLImpl* ppRTVs[],
                                                        TextureViewGLImpl* pDSV,
                                                        Uint32             DefaultWidth,
-                                                       Uint32             DefaultHeight)
+                                                       Uint32             DefaultHeight,
+                                                       Uint32             NumViews)
 {
     GLObjectWrappers::GLFrameBufferObj FBO{true};
 
     ContextState.BindFBO(FBO);
 
+    // With GL_OVR_multiview, NumViews consecutive array slices starting from the first slice of the view
+    // are attached, and the draw is broadcast to all of them.
+    auto AttachMultiview = [NumViews](const TextureViewDesc& ViewDesc, TextureBaseGL* pTexGL, GLenum AttachmentPoint) {
+        DEV_CHECK_ERR(pTexGL->GetDesc().Type == RESOURCE_DIM_TEX_2D_ARRAY, "Multiview framebuffer attachments must be 2D texture arrays");
+        glFramebufferTextureMultiviewOVR(GL_DRAW_FRAMEBUFFER, AttachmentPoint, pTexGL->GetGLHandle(), ViewDesc.MostDetailedMip, ViewDesc.FirstArraySlice, NumViews);
+        DEV_CHECK_GL_ERROR("Failed to attach multiview texture to the framebuffer");
+    };
+
     // Initialize the FBO
     for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
     {
@@ -141,7 +173,10 @@ GLObjectWrappers::GLFrameBufferObj FBOCache::CreateFBO(GLContextState&    Contex
         {
             const TextureViewDesc& RTVDesc     = pRTView->GetDesc();
             TextureBaseGL*         pColorTexGL = pRTView->GetTexture<TextureBaseGL>();
-            pColorTexGL->AttachToFramebuffer(RTVDesc, GL_COLOR_ATTACHMENT0 + rt, TextureBaseGL::FRAMEBUFFER_TARGET_FLAG_READ_DRAW);
+            if (NumViews > 0)
+                AttachMultiview(RTVDesc, pColorTexGL, GL_COLOR_ATTACHMENT0 + rt);
+            else
+                pColorTexGL->AttachToFramebuffer(RTVDesc, GL_COLOR_ATTACHMENT0 + rt, TextureBaseGL::FRAMEBUFFER_TARGET_FLAG_READ_DRAW);
         }
     }
 
@@ -181,10 +216,17 @@ GLObjectWrappers::GLFrameBufferObj FBOCache::CreateFBO(GLContextState&    Contex
             UNEXPECTED(GetTextureFormatAttribs(DSVDesc.Format).Name, " is not valid depth-stencil view format");
         }
         VERIFY_EXPR(DSVDesc.ViewType == TEXTURE_VIEW_DEPTH_STENCIL || DSVDesc.ViewType == TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL);
-        pDepthTexGL->AttachToFramebuffer(DSVDesc, AttachmentPoint,
-                                         DSVDesc.ViewType == TEXTURE_VIEW_DEPTH_STENCIL ?
-                                             TextureBaseGL::FRAMEBUFFER_TARGET_FLAG_READ_DRAW :
-                                             TextureBaseGL::FRAMEBUFFER_TARGET_FLAG_READ);
+        if (NumViews > 0)
+        {
+            AttachMultiview(DSVDesc, pDepthTexGL, AttachmentPoint);
+        }
+        else
+        {
+            pDepthTexGL->AttachToFramebuffer(DSVDesc, AttachmentPoint,
+                                             DSVDesc.ViewType == TEXTURE_VIEW_DEPTH_STENCIL ?
+                                                 TextureBaseGL::FRAMEBUFFER_TARGET_FLAG_READ_DRAW :
+                                                 TextureBaseGL::FRAMEBUFFER_TARGET_FLAG_READ);
+        }
     }
 
     if (NumRenderTargets > 0)
@@ -270,6 +312,8 @@ GLObjectWrappers::GLFrameBufferObj& FBOCache::GetFBO(Uint32             NumRende
     // Lock the cache
     Threading::SpinLockGuard CacheGuard{m_CacheLock};
 
+    PurgeStaleEntries();
+
     // Try to find FBO in the map
     auto fbo_it = m_Cache.find(Key);
     if (fbo_it == m_Cache.end())
@@ -302,6 +346,8 @@ const GLObjectWrappers::GLFrameBufferObj& FBOCache::GetFBO(Uint32 Width, Uint32
     // Lock the cache
     Threading::SpinLockGuard CacheGuard{m_CacheLock};
 
+    PurgeStaleEntries();
+
     // Try to find FBO in the map
     auto fbo_it = m_Cache.find(Key);
     if (fbo_it == m_Cache.end())
@@ -356,6 +402,8 @@ const GLObjectWrappers::GLFrameBufferObj& FBOCache::GetFBO(TextureBaseGL*
     // Lock the cache
     Threading::SpinLockGuard CacheGuard{m_CacheLock};
 
+    PurgeStaleEntries();
+
     // Try to find FBO in the map
     auto fbo_it = m_Cache.find(Key);
     if (fbo_it == m_Cache.end())
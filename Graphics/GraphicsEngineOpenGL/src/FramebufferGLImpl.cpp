@@ -32,6 +32,7 @@
 #include "TextureViewGLImpl.hpp"
 #include "FBOCache.hpp"
 #include "GLContextState.hpp"
+#include "PlatformMisc.hpp"
 
 namespace Diligent
 {
@@ -110,7 +111,8 @@ FramebufferGLImpl::FramebufferGLImpl(IReferenceCounters*    pRefCounters,
         }
         GLObjectWrappers::GLFrameBufferObj RenderTargetFBO = UseDefaultFBO(SPDesc.RenderTargetAttachmentCount, ppRTVs, pDSV) ?
             GLObjectWrappers::GLFrameBufferObj{false} :
-            FBOCache::CreateFBO(CtxState, SPDesc.RenderTargetAttachmentCount, ppRTVs, pDSV, Desc.Width, Desc.Height);
+            FBOCache::CreateFBO(CtxState, SPDesc.RenderTargetAttachmentCount, ppRTVs, pDSV, Desc.Width, Desc.Height,
+                                PlatformMisc::CountOneBits(SPDesc.ViewMask)); // The view mask is contiguous from bit 0 (see ValidateRenderPassDesc)
 
         GLObjectWrappers::GLFrameBufferObj ResolveFBO{false};
         if (SPDesc.pResolveAttachments != nullptr)
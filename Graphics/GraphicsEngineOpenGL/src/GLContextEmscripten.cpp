@@ -30,6 +30,8 @@
 #include "GraphicsTypes.h"
 #include "GLTypeConversions.hpp"
 
+#include <emscripten/threading.h>
+
 namespace Diligent
 {
 
@@ -91,11 +93,30 @@ GLContext::GLContext(const EngineGLCreateInfo& InitAttribs, RENDER_DEVICE_TYPE&
             default: UNEXPECTED("Unknown power preference");
         }
 
+        switch (InitAttribs.WebGLAttribs.ProxyContextToMainThread)
+        {
+            // clang-format off
+            case WEBGL_CONTEXT_PROXY_MODE_DISALLOW: ContextAttributes.proxyContextToMainThread = EMSCRIPTEN_WEBGL_CONTEXT_PROXY_DISALLOW; break;
+            case WEBGL_CONTEXT_PROXY_MODE_FALLBACK: ContextAttributes.proxyContextToMainThread = EMSCRIPTEN_WEBGL_CONTEXT_PROXY_FALLBACK; break;
+            case WEBGL_CONTEXT_PROXY_MODE_ALWAYS:   ContextAttributes.proxyContextToMainThread = EMSCRIPTEN_WEBGL_CONTEXT_PROXY_ALWAYS;   break;
+            // clang-format on
+            default: UNEXPECTED("Unknown context proxy mode");
+        }
+        ContextAttributes.renderViaOffscreenBackBuffer = InitAttribs.WebGLAttribs.RenderViaOffscreenBackBuffer;
+        ContextAttributes.explicitSwapControl          = InitAttribs.WebGLAttribs.ExplicitSwapControl;
+
         m_GLContext = emscripten_webgl_create_context(InitAttribs.Window.pCanvasId, &ContextAttributes);
         if (m_GLContext == 0)
         {
+            if (!emscripten_is_main_browser_thread())
+            {
+                LOG_ERROR_AND_THROW("Failed to create GL context on a worker thread. Make sure that the canvas '", InitAttribs.Window.pCanvasId,
+                                    "' has been transferred to this thread as an OffscreenCanvas and that the application is linked with "
+                                    "-sOFFSCREENCANVAS_SUPPORT=1, or allow proxying the context to the main thread.");
+            }
             LOG_ERROR_AND_THROW("GL context isn't created");
         }
+        m_ExplicitSwapControl = InitAttribs.WebGLAttribs.ExplicitSwapControl;
 
         auto EmResult = emscripten_webgl_make_context_current(m_GLContext);
         if (EmResult != EMSCRIPTEN_RESULT_SUCCESS)
@@ -148,6 +169,23 @@ GLContext::~GLContext()
     }
 }
 
+void GLContext::SwapBuffers(int /*SwapInterval*/)
+{
+    if (m_ExplicitSwapControl)
+    {
+        auto EmResult = emscripten_webgl_commit_frame();
+        if (EmResult != EMSCRIPTEN_RESULT_SUCCESS)
+        {
+            LOG_ERROR_MESSAGE("Failed to commit the frame");
+        }
+    }
+    else
+    {
+        LOG_INFO_MESSAGE_ONCE("The frame is presented by the browser when the thread that owns the GL context returns to its event loop. "
+                              "Enable WebGLContextAttribs::ExplicitSwapControl to present frames in ISwapChain::Present().");
+    }
+}
+
 GLContext::NativeGLContextType GLContext::GetCurrentNativeGLContext()
 {
     auto CurrentContext = emscripten_webgl_get_current_context();
@@ -31,9 +31,157 @@
 #include "GraphicsTypes.h"
 #include "GLTypeConversions.hpp"
 
+#include <cstring>
+
 namespace Diligent
 {
 
+#if DILIGENT_EGL_SUPPORTED
+
+namespace
+{
+
+bool HasEGLExtension(const char* Extensions, const char* Name)
+{
+    if (Extensions == nullptr)
+        return false;
+
+    const size_t NameLen = strlen(Name);
+    for (const char* Ext = strstr(Extensions, Name); Ext != nullptr; Ext = strstr(Ext + NameLen, Name))
+    {
+        // Make sure that the name is not a prefix of another extension
+        if ((Ext == Extensions || Ext[-1] == ' ') && (Ext[NameLen] == ' ' || Ext[NameLen] == '\0'))
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
+void GLContext::InitHeadless(const EngineGLCreateInfo& InitAttribs)
+{
+    const char* ClientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (!HasEGLExtension(ClientExtensions, "EGL_EXT_platform_device") ||
+        !(HasEGLExtension(ClientExtensions, "EGL_EXT_device_enumeration") || HasEGLExtension(ClientExtensions, "EGL_EXT_device_base")))
+    {
+        LOG_ERROR_AND_THROW("Headless GL context requires EGL_EXT_device_enumeration and EGL_EXT_platform_device extensions");
+    }
+
+    auto eglQueryDevicesEXT       = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+    auto eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (eglQueryDevicesEXT == nullptr || eglGetPlatformDisplayEXT == nullptr)
+    {
+        LOG_ERROR_AND_THROW("Failed to load EGL device extension functions");
+    }
+
+    EGLint NumDevices = 0;
+    if (!eglQueryDevicesEXT(0, nullptr, &NumDevices) || NumDevices <= 0)
+    {
+        LOG_ERROR_AND_THROW("No EGL devices found");
+    }
+    std::vector<EGLDeviceEXT> Devices(static_cast<size_t>(NumDevices));
+    eglQueryDevicesEXT(NumDevices, Devices.data(), &NumDevices);
+
+    const Uint32 DeviceId = InitAttribs.AdapterId != DEFAULT_ADAPTER_ID ? InitAttribs.AdapterId : 0;
+    if (DeviceId >= static_cast<Uint32>(NumDevices))
+    {
+        LOG_ERROR_AND_THROW("Adapter id ", DeviceId, " is out of range: ", NumDevices, " EGL device(s) found");
+    }
+
+    EGLDisplay Display = eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, Devices[DeviceId], nullptr);
+    if (Display == EGL_NO_DISPLAY)
+    {
+        LOG_ERROR_AND_THROW("Failed to get EGL display for device ", DeviceId);
+    }
+
+    EGLint EGLMajorVersion = 0, EGLMinorVersion = 0;
+    if (!eglInitialize(Display, &EGLMajorVersion, &EGLMinorVersion))
+    {
+        LOG_ERROR_AND_THROW("Failed to initialize EGL display for device ", DeviceId);
+    }
+    m_EGLDisplay = Display;
+
+    const char* DisplayExtensions = eglQueryString(Display, EGL_EXTENSIONS);
+    if (!HasEGLExtension(DisplayExtensions, "EGL_KHR_surfaceless_context"))
+    {
+        LOG_ERROR_AND_THROW("Headless GL context requires EGL_KHR_surfaceless_context extension");
+    }
+    if (!HasEGLExtension(DisplayExtensions, "EGL_KHR_create_context") && (EGLMajorVersion == 1 && EGLMinorVersion < 5))
+    {
+        LOG_ERROR_AND_THROW("Headless GL context requires EGL 1.5 or EGL_KHR_create_context extension");
+    }
+
+    if (!eglBindAPI(EGL_OPENGL_API))
+    {
+        LOG_ERROR_AND_THROW("Failed to bind OpenGL API");
+    }
+
+    // The context never renders to the default framebuffer, so any config that supports OpenGL is suitable
+    const EGLint ConfigAttribs[] =
+        {
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_NONE //
+        };
+    EGLConfig Config     = nullptr;
+    EGLint    NumConfigs = 0;
+    if (!eglChooseConfig(Display, ConfigAttribs, &Config, 1, &NumConfigs) || NumConfigs == 0)
+    {
+        LOG_ERROR_AND_THROW("Failed to find EGL config that supports OpenGL");
+    }
+
+    EGLint ContextFlags = EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE_BIT_KHR;
+    if (InitAttribs.EnableValidation)
+    {
+        ContextFlags |= EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR;
+    }
+
+    EGLContext Context = EGL_NO_CONTEXT;
+
+    std::pair<EGLint, EGLint> GLVersions[] = {{4, 6}, {4, 5}, {4, 4}, {4, 3}, {4, 2}};
+    for (size_t i = 0; i < _countof(GLVersions) && Context == EGL_NO_CONTEXT; ++i)
+    {
+        const EGLint ContextAttribs[] =
+            {
+                EGL_CONTEXT_MAJOR_VERSION_KHR, GLVersions[i].first,
+                EGL_CONTEXT_MINOR_VERSION_KHR, GLVersions[i].second,
+                EGL_CONTEXT_FLAGS_KHR, ContextFlags,
+                EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+                EGL_NONE //
+            };
+        Context = eglCreateContext(Display, Config, EGL_NO_CONTEXT, ContextAttribs);
+    }
+    if (Context == EGL_NO_CONTEXT)
+    {
+        LOG_ERROR_AND_THROW("Failed to create headless OpenGL context");
+    }
+    m_EGLContext = Context;
+
+    if (!eglMakeCurrent(Display, EGL_NO_SURFACE, EGL_NO_SURFACE, Context))
+    {
+        LOG_ERROR_AND_THROW("Failed to make headless OpenGL context current");
+    }
+
+    LOG_INFO_MESSAGE("Initialized EGL ", EGLMajorVersion, '.', EGLMinorVersion, " on device ", DeviceId, " of ", NumDevices);
+}
+
+#endif
+
+void GLContext::DestroyHeadless()
+{
+#if DILIGENT_EGL_SUPPORTED
+    if (m_EGLContext != nullptr)
+    {
+        eglMakeCurrent(m_EGLDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(m_EGLDisplay, m_EGLContext);
+        m_EGLContext = nullptr;
+    }
+    // The display is not terminated: eglGetPlatformDisplayEXT returns the same display
+    // for all contexts created on the same device in the process.
+    m_EGLDisplay = nullptr;
+#endif
+}
+
 GLContext::GLContext(const EngineGLCreateInfo& InitAttribs,
                      RENDER_DEVICE_TYPE&       DevType,
                      struct Version&           APIVersion,
@@ -41,33 +189,63 @@ GLContext::GLContext(const EngineGLCreateInfo& InitAttribs,
     m_WindowId(InitAttribs.Window.WindowId),
     m_pDisplay(InitAttribs.Window.pDisplay)
 {
-    auto CurrentCtx = glXGetCurrentContext();
-    if (CurrentCtx == 0)
+    try
     {
-        LOG_ERROR_AND_THROW("No current GL context found!");
-    }
+        if (InitAttribs.Headless)
+        {
+#if DILIGENT_EGL_SUPPORTED
+            m_WindowId = 0;
+            m_pDisplay = nullptr;
+            InitHeadless(InitAttribs);
+#else
+            LOG_ERROR_AND_THROW("Headless GL context is not supported: the engine was built without EGL");
+#endif
+        }
+        else
+        {
+            auto CurrentCtx = glXGetCurrentContext();
+            if (CurrentCtx == 0)
+            {
+                LOG_ERROR_AND_THROW("No current GL context found!");
+            }
+        }
 
-    // Initialize GLEW
-    GLenum err = glewInit();
-    if (GLEW_OK != err)
-        LOG_ERROR_AND_THROW("Failed to initialize GLEW");
+        // Initialize GLEW
+        GLenum err = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+        // GLEW fails to initialize GLX extensions when there is no GLX display,
+        // but OpenGL entry points have already been loaded at this point.
+        if (err == GLEW_ERROR_NO_GLX_DISPLAY && IsHeadless())
+            err = GLEW_OK;
+#endif
+        if (GLEW_OK != err)
+            LOG_ERROR_AND_THROW("Failed to initialize GLEW");
 
-    //Checking GL version
-    const GLubyte* GLVersionString = glGetString(GL_VERSION);
-    const GLubyte* GLRenderer      = glGetString(GL_RENDERER);
+        //Checking GL version
+        const GLubyte* GLVersionString = glGetString(GL_VERSION);
+        const GLubyte* GLRenderer      = glGetString(GL_RENDERER);
 
-    Int32 MajorVersion = 0, MinorVersion = 0;
-    //Or better yet, use the GL3 way to get the version number
-    glGetIntegerv(GL_MAJOR_VERSION, &MajorVersion);
-    glGetIntegerv(GL_MINOR_VERSION, &MinorVersion);
-    LOG_INFO_MESSAGE(InitAttribs.Window.WindowId != 0 ? "Initialized OpenGL " : "Attached to OpenGL ", MajorVersion, '.', MinorVersion, " context (", GLVersionString, ", ", GLRenderer, ')');
+        Int32 MajorVersion = 0, MinorVersion = 0;
+        //Or better yet, use the GL3 way to get the version number
+        glGetIntegerv(GL_MAJOR_VERSION, &MajorVersion);
+        glGetIntegerv(GL_MINOR_VERSION, &MinorVersion);
+        LOG_INFO_MESSAGE(IsHeadless() ? "Initialized headless OpenGL " : (InitAttribs.Window.WindowId != 0 ? "Initialized OpenGL " : "Attached to OpenGL "),
+                         MajorVersion, '.', MinorVersion, " context (", GLVersionString, ", ", GLRenderer, ')');
 
-    DevType    = RENDER_DEVICE_TYPE_GL;
-    APIVersion = Version{static_cast<Uint32>(MajorVersion), static_cast<Uint32>(MinorVersion)};
+        DevType    = RENDER_DEVICE_TYPE_GL;
+        APIVersion = Version{static_cast<Uint32>(MajorVersion), static_cast<Uint32>(MinorVersion)};
+    }
+    catch (...)
+    {
+        // The destructor is not called if the constructor throws
+        DestroyHeadless();
+        throw;
+    }
 }
 
 GLContext::~GLContext()
 {
+    DestroyHeadless();
 }
 
 void GLContext::SwapBuffers(int SwapInterval)
@@ -98,6 +276,10 @@ void GLContext::SwapBuffers(int SwapInterval)
 
 GLContext::NativeGLContextType GLContext::GetCurrentNativeGLContext()
 {
+#if DILIGENT_EGL_SUPPORTED
+    if (IsHeadless())
+        return eglGetCurrentContext();
+#endif
     return glXGetCurrentContext();
 }
 
@@ -49,6 +49,8 @@ GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL)
     m_Caps.IsProgramPipelineSupported      = AdapterInfo.Features.SeparablePrograms;
     m_Caps.IsDepthClampSupported           = AdapterInfo.Features.DepthClamp;
     m_Caps.IsFramebufferSRGBSupported      = pDeviceGL->GetGLCaps().FramebufferSRGB;
+    m_Caps.IsMultiBindSupported            = pDeviceGL->GetGLCaps().MultiBind;
+    m_Caps.IsVertexAttribBindingSupported  = pDeviceGL->GetGLCaps().VertexAttribBinding;
 
     {
         m_Caps.MaxCombinedTexUnits = 0;
@@ -396,6 +398,163 @@ void GLContextState::BindStorageBlock(Int32 Index, const GLObjectWrappers::GLBuf
 #endif
 }
 
+void GLContextState::BindTextures(Uint32 First, Uint32 Count, const GLObjectWrappers::GLTextureObj* const* ppTextures, const GLenum* BindTargets)
+{
+#if GL_ARB_multi_bind
+    if (m_Caps.IsMultiBindSupported)
+    {
+        VERIFY(First + Count <= static_cast<Uint32>(m_Caps.MaxCombinedTexUnits), "Texture unit is out of range");
+
+        if (First + Count > m_BoundTextures.size())
+            m_BoundTextures.resize(size_t{First} + Count);
+        m_MultiBindHandles.resize(Count);
+
+        Uint32 FirstDirty = Count;
+        Uint32 LastDirty  = 0;
+        for (Uint32 i = 0; i < Count; ++i)
+        {
+            VERIFY_EXPR(BindTargets[i] != 0);
+            const GLTextureObj& TexObj = *ppTextures[i];
+
+            BoundTextureInfo  NewTex{TexObj ? TexObj.GetUniqueID() : 0, BindTargets[i]};
+            BoundTextureInfo& BoundTex = m_BoundTextures[First + i];
+            if (BoundTex != NewTex)
+            {
+                // Unbind texture from the previous target (see BindTexture()).
+                // Null texture array unbinds all targets of the unit.
+                if (BoundTex.BindTarget != 0 && BoundTex.BindTarget != NewTex.BindTarget && BoundTex.TexID != 0)
+                {
+                    glBindTextures(First + i, 1, nullptr);
+                    DEV_CHECK_GL_ERROR("Failed to unbind textures from slot ", First + i, ".");
+                }
+
+                BoundTex   = NewTex;
+                FirstDirty = std::min(FirstDirty, i);
+                LastDirty  = i;
+            }
+            m_MultiBindHandles[i] = TexObj;
+        }
+
+        if (FirstDirty < Count)
+        {
+            // Rebinding unchanged slots in the middle of the range is cheaper than splitting the call
+            glBindTextures(First + FirstDirty, LastDirty - FirstDirty + 1, &m_MultiBindHandles[FirstDirty]);
+            DEV_CHECK_GL_ERROR("Failed to bind textures to slots ", First + FirstDirty, "..", First + LastDirty, ".");
+        }
+        return;
+    }
+#endif
+
+    for (Uint32 i = 0; i < Count; ++i)
+        BindTexture(First + i, BindTargets[i], *ppTextures[i]);
+}
+
+void GLContextState::BindSamplers(Uint32 First, Uint32 Count, const GLObjectWrappers::GLSamplerObj* const* ppSamplers)
+{
+    static const GLSamplerObj NullSampler{false};
+
+#if GL_ARB_multi_bind
+    if (m_Caps.IsMultiBindSupported)
+    {
+        if (First + Count > m_BoundSamplers.size())
+            m_BoundSamplers.resize(size_t{First} + Count, -1);
+        m_MultiBindHandles.resize(Count);
+
+        Uint32 FirstDirty = Count;
+        Uint32 LastDirty  = 0;
+        for (Uint32 i = 0; i < Count; ++i)
+        {
+            const GLSamplerObj& SamplerObj = ppSamplers[i] != nullptr ? *ppSamplers[i] : NullSampler;
+            if (UpdateBoundObject(m_BoundSamplers[First + i], SamplerObj, m_MultiBindHandles[i]))
+            {
+                FirstDirty = std::min(FirstDirty, i);
+                LastDirty  = i;
+            }
+        }
+
+        if (FirstDirty < Count)
+        {
+            glBindSamplers(First + FirstDirty, LastDirty - FirstDirty + 1, &m_MultiBindHandles[FirstDirty]);
+            DEV_CHECK_GL_ERROR("Failed to bind samplers to slots ", First + FirstDirty, "..", First + LastDirty, ".");
+        }
+        return;
+    }
+#endif
+
+    for (Uint32 i = 0; i < Count; ++i)
+        BindSampler(First + i, ppSamplers[i] != nullptr ? *ppSamplers[i] : NullSampler);
+}
+
+void GLContextState::BindBuffersRange(GLenum                        Target,
+                                      std::vector<BoundBufferInfo>& BoundBuffers,
+                                      Uint32                        First,
+                                      Uint32                        Count,
+                                      const GLBufferObj* const*     ppBuffers,
+                                      const GLintptr*               Offsets,
+                                      const GLsizeiptr*             Sizes)
+{
+#if GL_ARB_multi_bind
+    VERIFY_EXPR(m_Caps.IsMultiBindSupported);
+
+    if (First + Count > BoundBuffers.size())
+        BoundBuffers.resize(size_t{First} + Count);
+    m_MultiBindHandles.resize(Count);
+
+    Uint32 FirstDirty = Count;
+    Uint32 LastDirty  = 0;
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        const GLBufferObj& Buff = *ppBuffers[i];
+
+        BoundBufferInfo NewBuffInfo{Buff.GetUniqueID(), Offsets[i], Sizes[i]};
+        if (BoundBuffers[First + i] != NewBuffInfo)
+        {
+            BoundBuffers[First + i] = NewBuffInfo;
+            FirstDirty              = std::min(FirstDirty, i);
+            LastDirty               = i;
+        }
+        m_MultiBindHandles[i] = Buff;
+    }
+
+    if (FirstDirty < Count)
+    {
+        // Unlike glBindBufferRange, glBindBuffersRange does not bind the buffers to the generic binding point
+        glBindBuffersRange(Target, First + FirstDirty, LastDirty - FirstDirty + 1, &m_MultiBindHandles[FirstDirty], &Offsets[FirstDirty], &Sizes[FirstDirty]);
+        DEV_CHECK_GL_ERROR("Failed to bind buffers to slots ", First + FirstDirty, "..", First + LastDirty, " of target ", Target, ".");
+    }
+#else
+    UNSUPPORTED("GL_ARB_multi_bind is not supported");
+#endif
+}
+
+void GLContextState::BindUniformBuffers(Uint32 First, Uint32 Count, const GLObjectWrappers::GLBufferObj* const* ppBuffers, const GLintptr* Offsets, const GLsizeiptr* Sizes)
+{
+    VERIFY(First + Count <= static_cast<Uint32>(m_Caps.MaxUniformBufferBindings), "Uniform buffer index is out of range");
+
+    if (m_Caps.IsMultiBindSupported)
+    {
+        BindBuffersRange(GL_UNIFORM_BUFFER, m_BoundUniformBuffers, First, Count, ppBuffers, Offsets, Sizes);
+        return;
+    }
+
+    for (Uint32 i = 0; i < Count; ++i)
+        BindUniformBuffer(First + i, *ppBuffers[i], Offsets[i], Sizes[i]);
+}
+
+void GLContextState::BindStorageBlocks(Uint32 First, Uint32 Count, const GLObjectWrappers::GLBufferObj* const* ppBuffers, const GLintptr* Offsets, const GLsizeiptr* Sizes)
+{
+#if GL_ARB_shader_storage_buffer_object
+    if (m_Caps.IsMultiBindSupported)
+    {
+        BindBuffersRange(GL_SHADER_STORAGE_BUFFER, m_BoundStorageBlocks, First, Count, ppBuffers, Offsets, Sizes);
+        return;
+    }
+#endif
+
+    for (Uint32 i = 0; i < Count; ++i)
+        BindStorageBlock(First + i, *ppBuffers[i], Offsets[i], Sizes[i]);
+}
+
 void GLContextState::BindBuffer(GLenum BindTarget, const GLObjectWrappers::GLBufferObj& Buff, bool ResetVAO)
 {
     // Binding ARRAY_BUFFER or ELEMENT_ARRAY_BUFFER affects currently bound VAO
@@ -29,17 +29,49 @@
 #include "GLProgram.hpp"
 #include "ShaderGLImpl.hpp"
 #include "RenderDeviceGLImpl.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
 
-GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
-                     Uint32               NumShaders,
-                     bool                 IsSeparableProgram) noexcept :
+namespace
+{
+
+// Unlike shader unique IDs, the key only depends on the shader sources and is stable across runs.
+Uint64 ComputeProgramBinaryKey(ShaderGLImpl* const* ppShaders,
+                               Uint32               NumShaders,
+                               bool                 IsSeparableProgram)
+{
+    size_t Hash = ComputeHash(IsSeparableProgram, NumShaders);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        const void* pSource    = nullptr;
+        size_t      SourceSize = 0;
+        ppShaders[i]->GetBytecode(&pSource, SourceSize);
+        HashCombine(Hash, static_cast<Uint32>(ppShaders[i]->GetDesc().ShaderType), SourceSize, ComputeHashRaw(pSource, SourceSize));
+    }
+    return Hash;
+}
+
+} // namespace
+
+GLProgram::GLProgram(ShaderGLImpl* const*      ppShaders,
+                     Uint32                    NumShaders,
+                     bool                      IsSeparableProgram,
+                     PipelineStateCacheGLImpl* pCache) noexcept :
     m_AttachedShaders{ppShaders, ppShaders + NumShaders}
 {
     VERIFY(!IsSeparableProgram || NumShaders == 1, "Number of shaders must be 1 when separable program is created");
 
+    if (pCache != nullptr && pCache->GetDevice()->GetGLCaps().ProgramBinary)
+    {
+        m_pCache   = pCache;
+        m_CacheKey = ComputeProgramBinaryKey(ppShaders, NumShaders, IsSeparableProgram);
+        if (LoadFromBinary(IsSeparableProgram))
+            return;
+    }
+
     // GL_PROGRAM_SEPARABLE parameter must be set before linking!
     if (IsSeparableProgram)
     {
@@ -47,6 +79,13 @@ GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
         DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_SEPARABLE) failed");
     }
 
+    if (m_pCache && m_pCache->IsStoreEnabled())
+    {
+        // The hint must be set before linking to let the driver know that the binary will be retrieved.
+        glProgramParameteri(m_GLProg, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_BINARY_RETRIEVABLE_HINT) failed");
+    }
+
     for (Uint32 i = 0; i < NumShaders; ++i)
     {
         ShaderGLImpl* pCurrShader = ppShaders[i];
@@ -79,6 +118,80 @@ GLProgram::~GLProgram()
 {
 }
 
+bool GLProgram::LoadFromBinary(bool IsSeparableProgram) noexcept
+{
+    VERIFY_EXPR(m_pCache);
+    std::shared_ptr<const PipelineStateCacheGLImpl::ProgramBinary> pBinary = m_pCache->GetProgramBinary(m_CacheKey);
+    if (!pBinary)
+        return false;
+
+    if (IsSeparableProgram)
+    {
+        glProgramParameteri(m_GLProg, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_SEPARABLE) failed");
+    }
+
+    glProgramBinary(m_GLProg, pBinary->Format, pBinary->Data.data(), static_cast<GLsizei>(pBinary->Data.size()));
+    // The driver may reject the binary (e.g. after a driver update) by generating GL_INVALID_ENUM
+    // or by failing the link status. Both cases are handled by falling back to linking from the shaders.
+    const bool BinaryAccepted = glGetError() == GL_NO_ERROR;
+
+    GLint IsLinked = GL_FALSE;
+    if (BinaryAccepted)
+    {
+        glGetProgramiv(m_GLProg, GL_LINK_STATUS, &IsLinked);
+        DEV_CHECK_GL_ERROR("glGetProgramiv(GL_LINK_STATUS) failed");
+    }
+
+    if (!IsLinked)
+    {
+        if ((m_pCache->GetDesc().Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_INFO_MESSAGE("Program binary was rejected by the driver. The program will be linked from the shaders.");
+        m_pCache->RemoveProgramBinary(m_CacheKey);
+
+        // Start with a clean program object as the failed binary may have left it in an undefined state
+        m_GLProg = GLObjectWrappers::GLProgramObj{true};
+        return false;
+    }
+
+    // The program does not need the shaders
+    std::vector<const ShaderGLImpl*> Null{};
+    m_AttachedShaders.swap(Null);
+
+    m_pCache.Release();
+    m_LinkStatus       = LinkStatus::Succeeded;
+    m_LoadedFromBinary = true;
+    m_LinkDuration     = static_cast<Uint64>(m_LinkTimer.GetElapsedTime() * 1e+6);
+    return true;
+}
+
+void GLProgram::StoreBinary() noexcept
+{
+    VERIFY_EXPR(m_pCache && m_LinkStatus == LinkStatus::Succeeded);
+
+    GLint BinaryLength = 0;
+    glGetProgramiv(m_GLProg, GL_PROGRAM_BINARY_LENGTH, &BinaryLength);
+    DEV_CHECK_GL_ERROR("glGetProgramiv(GL_PROGRAM_BINARY_LENGTH) failed");
+    if (BinaryLength <= 0)
+        return;
+
+    PipelineStateCacheGLImpl::ProgramBinary Binary;
+    Binary.Data.resize(static_cast<size_t>(BinaryLength));
+
+    GLsizei Length = 0;
+    GLenum  Format = 0;
+    glGetProgramBinary(m_GLProg, BinaryLength, &Length, &Format, Binary.Data.data());
+    if (glGetError() != GL_NO_ERROR || Length <= 0)
+    {
+        LOG_WARNING_MESSAGE("Failed to retrieve the program binary");
+        return;
+    }
+
+    Binary.Data.resize(static_cast<size_t>(Length));
+    Binary.Format = Format;
+    m_pCache->StoreProgramBinary(m_CacheKey, std::move(Binary));
+}
+
 GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
 {
     VERIFY_EXPR(m_LinkStatus != LinkStatus::Undefined);
@@ -97,6 +210,7 @@ GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
     int IsLinked = GL_FALSE;
     glGetProgramiv(m_GLProg, GL_LINK_STATUS, &IsLinked);
     DEV_CHECK_GL_ERROR("glGetProgramiv(GL_LINK_STATUS) failed");
+    m_LinkDuration = static_cast<Uint64>(m_LinkTimer.GetElapsedTime() * 1e+6);
 
     if (IsLinked)
     {
@@ -132,6 +246,13 @@ GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
     std::vector<const ShaderGLImpl*> Null{};
     m_AttachedShaders.swap(Null);
 
+    if (m_pCache)
+    {
+        if (m_LinkStatus == LinkStatus::Succeeded && m_pCache->IsStoreEnabled())
+            StoreBinary();
+        m_pCache.Release();
+    }
+
     return m_LinkStatus;
 }
 
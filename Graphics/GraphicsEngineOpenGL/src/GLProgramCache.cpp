@@ -30,7 +30,7 @@
 #include "ShaderGLImpl.hpp"
 #include "RenderDeviceGLImpl.hpp"
 #include "PipelineResourceSignatureGLImpl.hpp"
-#include "HashUtils.hpp"
+#include "XXH3Hasher.hpp"
 
 namespace Diligent
 {
@@ -46,15 +46,13 @@ GLProgramCache::~GLProgramCache()
 GLProgramCache::ProgramCacheKey::ProgramCacheKey(const GetProgramAttribs& Attribs) :
     IsSeparableProgram{Attribs.IsSeparableProgram}
 {
-    Hash = ComputeHash(Attribs.IsSeparableProgram, Attribs.NumShaders, Attribs.NumSignatures);
+    XXH3Hasher Hasher;
+    Hasher(Attribs.IsSeparableProgram, Attribs.NumShaders, Attribs.NumSignatures);
 
     ShaderUIDs.reserve(Attribs.NumShaders);
     for (Uint32 i = 0; i < Attribs.NumShaders; ++i)
-    {
-        Int32 ShaderUID = Attribs.ppShaders[i]->GetUniqueID();
-        HashCombine(Hash, ShaderUID);
-        ShaderUIDs.push_back(ShaderUID);
-    }
+        ShaderUIDs.push_back(Attribs.ppShaders[i]->GetUniqueID());
+    Hasher.UpdateSpan(ShaderUIDs.data(), ShaderUIDs.size());
 
     if (Attribs.NumSignatures != 0)
     {
@@ -62,19 +60,18 @@ GLProgramCache::ProgramCacheKey::ProgramCacheKey(const GetProgramAttribs& Attrib
         for (Uint32 i = 0; i < Attribs.NumSignatures; ++i)
         {
             if (PipelineResourceSignatureGLImpl* pSignature = ClassPtrCast<PipelineResourceSignatureGLImpl>(Attribs.ppSignatures[i]))
-            {
-                Int32 SignatureUID = pSignature->GetUniqueID();
-                HashCombine(Hash, SignatureUID);
-                SignatureUIDs.push_back(SignatureUID);
-            }
+                SignatureUIDs.push_back(pSignature->GetUniqueID());
         }
+        Hasher.UpdateSpan(SignatureUIDs.data(), SignatureUIDs.size());
     }
     else
     {
         VERIFY_EXPR(Attribs.pResourceLayout != nullptr);
         ResourceLayout = *Attribs.pResourceLayout;
-        HashCombine(Hash, static_cast<const PipelineResourceLayoutDesc&>(ResourceLayout));
+        Hasher(static_cast<const PipelineResourceLayoutDesc&>(ResourceLayout));
     }
+
+    Hash = Hasher.Get();
 }
 
 bool GLProgramCache::ProgramCacheKey::operator==(const ProgramCacheKey& Key) const noexcept
@@ -116,7 +113,7 @@ GLProgramCache::SharedGLProgramObjPtr GLProgramCache::GetProgram(const GetProgra
     // and the rest will be destroyed.
 
     // Linking the program may take a considerable amount of time.
-    std::shared_ptr<GLProgram> NewProgram = std::make_shared<GLProgram>(Attribs.ppShaders, Attribs.NumShaders, Attribs.IsSeparableProgram);
+    std::shared_ptr<GLProgram> NewProgram = std::make_shared<GLProgram>(Attribs.ppShaders, Attribs.NumShaders, Attribs.IsSeparableProgram, Attribs.pCache);
 
     std::lock_guard<std::mutex> Lock{m_CacheMtx};
 
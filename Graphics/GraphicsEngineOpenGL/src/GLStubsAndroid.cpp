@@ -277,6 +277,10 @@
 	DECLARE_GL_FUNCTION( glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
 #endif
 
+#ifdef LOAD_GL_FRAMEBUFFER_TEXTURE_MULTIVIEW_OVR
+    DECLARE_GL_FUNCTION( glFramebufferTextureMultiviewOVR, PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC, GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews)
+#endif
+
 void LoadGLFunctions()
 {
     Diligent::Version glesVer{3, 0};
@@ -535,4 +539,8 @@ void LoadGLFunctions()
 #ifdef LOAD_GL_MULTI_DRAW_ELEMENTS
 	LOAD_GL_FUNCTION_NO_STUB(glMultiDrawElements, {{"glMultiDrawElementsEXT", {3,0}}} );
 #endif
+
+#ifdef LOAD_GL_FRAMEBUFFER_TEXTURE_MULTIVIEW_OVR
+    LOAD_GL_FUNCTION2(glFramebufferTextureMultiviewOVR, {{"glFramebufferTextureMultiviewOVR", {3,0}}} );
+#endif
 }
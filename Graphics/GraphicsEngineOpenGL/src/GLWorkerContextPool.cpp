@@ -0,0 +1,506 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+
+#include "pch.h"
+
+#include "GLWorkerContextPool.hpp"
+
+#include "RenderDeviceGLImpl.hpp"
+#include "GLContextState.hpp"
+#include "GLObjectWrapper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// State of the worker context that is current on this thread
+static thread_local GLContextState* tl_pCurrentContextState = nullptr;
+
+// Attributes of the main context that worker contexts must match
+struct MainContextAttribs
+{
+    GLint MajorVersion = 0;
+    GLint MinorVersion = 0;
+    GLint Flags        = 0;
+    GLint ProfileMask  = 0;
+};
+
+} // namespace
+
+#if PLATFORM_WIN32
+
+struct GLWorkerContextPool::WorkerContext
+{
+    HDC   hDC   = NULL;
+    HGLRC hGLRC = NULL;
+
+    std::unique_ptr<GLContextState> pState;
+
+    static std::unique_ptr<WorkerContext> Create(const MainContextAttribs& Attribs)
+    {
+        if (wglCreateContextAttribsARB == nullptr)
+        {
+            LOG_WARNING_MESSAGE("WGL_ARB_create_context is not supported: worker contexts will not be created");
+            return {};
+        }
+
+        // The worker context uses the device context of the main window, so that it has the same pixel format
+        const HDC   hDC       = wglGetCurrentDC();
+        const HGLRC hShareCtx = wglGetCurrentContext();
+
+        int ContextFlags = 0;
+        if ((Attribs.Flags & GL_CONTEXT_FLAG_DEBUG_BIT) != 0)
+            ContextFlags |= WGL_CONTEXT_DEBUG_BIT_ARB;
+        if ((Attribs.Flags & GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT) != 0)
+            ContextFlags |= WGL_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB;
+
+        std::vector<int> ContextAttribs =
+            {
+                WGL_CONTEXT_MAJOR_VERSION_ARB, Attribs.MajorVersion,
+                WGL_CONTEXT_MINOR_VERSION_ARB, Attribs.MinorVersion,
+                WGL_CONTEXT_FLAGS_ARB, ContextFlags //
+            };
+        if (Attribs.ProfileMask != 0)
+        {
+            ContextAttribs.push_back(WGL_CONTEXT_PROFILE_MASK_ARB);
+            ContextAttribs.push_back(Attribs.ProfileMask);
+        }
+        ContextAttribs.push_back(0);
+
+        const HGLRC hGLRC = wglCreateContextAttribsARB(hDC, hShareCtx, ContextAttribs.data());
+        if (hGLRC == NULL)
+        {
+            LOG_ERROR_MESSAGE("Failed to create shared worker GL context");
+            return {};
+        }
+
+        std::unique_ptr<WorkerContext> pContext{new WorkerContext};
+        pContext->hDC   = hDC;
+        pContext->hGLRC = hGLRC;
+        return pContext;
+    }
+
+    bool MakeCurrent()
+    {
+        return wglMakeCurrent(hDC, hGLRC) != FALSE;
+    }
+
+    void ReleaseCurrent()
+    {
+        wglMakeCurrent(NULL, NULL);
+    }
+
+    ~WorkerContext()
+    {
+        if (hGLRC != NULL)
+            wglDeleteContext(hGLRC);
+    }
+};
+
+#elif PLATFORM_LINUX
+
+struct GLWorkerContextPool::WorkerContext
+{
+    Display*   pDisplay = nullptr;
+    GLXContext Context  = nullptr;
+    GLXPbuffer Pbuffer  = 0;
+
+#    if DILIGENT_EGL_SUPPORTED
+    // Headless main context (see EngineGLCreateInfo::Headless)
+    EGLDisplay HeadlessDisplay = EGL_NO_DISPLAY;
+    EGLContext HeadlessContext = EGL_NO_CONTEXT;
+#    endif
+
+    std::unique_ptr<GLContextState> pState;
+
+#    if DILIGENT_EGL_SUPPORTED
+    static std::unique_ptr<WorkerContext> CreateHeadless(const MainContextAttribs& Attribs)
+    {
+        const EGLDisplay Display  = eglGetCurrentDisplay();
+        const EGLContext ShareCtx = eglGetCurrentContext();
+
+        // Use the config of the main context
+        EGLint ConfigId = 0;
+        eglQueryContext(Display, ShareCtx, EGL_CONFIG_ID, &ConfigId);
+        const EGLint ConfigAttribs[] = {EGL_CONFIG_ID, ConfigId, EGL_NONE};
+
+        EGLConfig Config     = nullptr;
+        EGLint    NumConfigs = 0;
+        if (!eglChooseConfig(Display, ConfigAttribs, &Config, 1, &NumConfigs) || NumConfigs == 0)
+        {
+            LOG_ERROR_MESSAGE("Failed to find the config of the main EGL context");
+            return {};
+        }
+
+        EGLint ContextFlags = 0;
+        if ((Attribs.Flags & GL_CONTEXT_FLAG_DEBUG_BIT) != 0)
+            ContextFlags |= EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR;
+        if ((Attribs.Flags & GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT) != 0)
+            ContextFlags |= EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE_BIT_KHR;
+
+        std::vector<EGLint> ContextAttribs =
+            {
+                EGL_CONTEXT_MAJOR_VERSION_KHR, Attribs.MajorVersion,
+                EGL_CONTEXT_MINOR_VERSION_KHR, Attribs.MinorVersion,
+                EGL_CONTEXT_FLAGS_KHR, ContextFlags //
+            };
+        if (Attribs.ProfileMask != 0)
+        {
+            ContextAttribs.push_back(EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR);
+            ContextAttribs.push_back(Attribs.ProfileMask);
+        }
+        ContextAttribs.push_back(EGL_NONE);
+
+        // eglCreateContext uses the API bound to the calling thread
+        eglBindAPI(EGL_OPENGL_API);
+        const EGLContext Context = eglCreateContext(Display, Config, ShareCtx, ContextAttribs.data());
+        if (Context == EGL_NO_CONTEXT)
+        {
+            LOG_ERROR_MESSAGE("Failed to create shared worker EGL context");
+            return {};
+        }
+
+        std::unique_ptr<WorkerContext> pContext{new WorkerContext};
+        pContext->HeadlessDisplay = Display;
+        pContext->HeadlessContext = Context;
+        return pContext;
+    }
+#    endif
+
+    static std::unique_ptr<WorkerContext> Create(const MainContextAttribs& Attribs)
+    {
+#    if DILIGENT_EGL_SUPPORTED
+        if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+            return CreateHeadless(Attribs);
+#    endif
+
+        if (glXCreateContextAttribsARB == nullptr)
+        {
+            LOG_WARNING_MESSAGE("GLX_ARB_create_context is not supported: worker contexts will not be created");
+            return {};
+        }
+
+        Display* const   pDisplay  = glXGetCurrentDisplay();
+        const GLXContext ShareCtx  = glXGetCurrentContext();
+        int              ConfigId  = 0;
+        int              ScreenIdx = 0;
+        glXQueryContext(pDisplay, ShareCtx, GLX_FBCONFIG_ID, &ConfigId);
+        glXQueryContext(pDisplay, ShareCtx, GLX_SCREEN, &ScreenIdx);
+
+        // Use the framebuffer config of the main context
+        const int    ConfigAttribs[] = {GLX_FBCONFIG_ID, ConfigId, 0};
+        int          NumConfigs      = 0;
+        GLXFBConfig* pConfigs        = glXChooseFBConfig(pDisplay, ScreenIdx, ConfigAttribs, &NumConfigs);
+        if (pConfigs == nullptr || NumConfigs == 0)
+        {
+            LOG_ERROR_MESSAGE("Failed to find the framebuffer config of the main GL context");
+            return {};
+        }
+        const GLXFBConfig Config = pConfigs[0];
+        XFree(pConfigs);
+
+        int ContextFlags = 0;
+        if ((Attribs.Flags & GL_CONTEXT_FLAG_DEBUG_BIT) != 0)
+            ContextFlags |= GLX_CONTEXT_DEBUG_BIT_ARB;
+        if ((Attribs.Flags & GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT) != 0)
+            ContextFlags |= GLX_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB;
+
+        std::vector<int> ContextAttribs =
+            {
+                GLX_CONTEXT_MAJOR_VERSION_ARB, Attribs.MajorVersion,
+                GLX_CONTEXT_MINOR_VERSION_ARB, Attribs.MinorVersion,
+                GLX_CONTEXT_FLAGS_ARB, ContextFlags //
+            };
+        if (Attribs.ProfileMask != 0)
+        {
+            ContextAttribs.push_back(GLX_CONTEXT_PROFILE_MASK_ARB);
+            ContextAttribs.push_back(Attribs.ProfileMask);
+        }
+        ContextAttribs.push_back(0);
+
+        const GLXContext Context = glXCreateContextAttribsARB(pDisplay, Config, ShareCtx, /*direct = */ 1, ContextAttribs.data());
+        if (Context == nullptr)
+        {
+            LOG_ERROR_MESSAGE("Failed to create shared worker GL context");
+            return {};
+        }
+
+        std::unique_ptr<WorkerContext> pContext{new WorkerContext};
+        pContext->pDisplay = pDisplay;
+        pContext->Context  = Context;
+
+        // The context needs a drawable to be made current
+        const int PbufferAttribs[] = {GLX_PBUFFER_WIDTH, 1, GLX_PBUFFER_HEIGHT, 1, 0};
+        pContext->Pbuffer          = glXCreatePbuffer(pDisplay, Config, PbufferAttribs);
+        if (pContext->Pbuffer == 0)
+        {
+            LOG_ERROR_MESSAGE("Failed to create pbuffer for the worker GL context");
+            return {};
+        }
+
+        return pContext;
+    }
+
+    bool MakeCurrent()
+    {
+#    if DILIGENT_EGL_SUPPORTED
+        if (HeadlessContext != EGL_NO_CONTEXT)
+        {
+            // Headless contexts are always surfaceless
+            eglBindAPI(EGL_OPENGL_API);
+            return eglMakeCurrent(HeadlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, HeadlessContext) == EGL_TRUE;
+        }
+#    endif
+        return glXMakeCurrent(pDisplay, Pbuffer, Context) != 0;
+    }
+
+    void ReleaseCurrent()
+    {
+#    if DILIGENT_EGL_SUPPORTED
+        if (HeadlessContext != EGL_NO_CONTEXT)
+        {
+            eglMakeCurrent(HeadlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            return;
+        }
+#    endif
+        glXMakeCurrent(pDisplay, 0, nullptr);
+    }
+
+    ~WorkerContext()
+    {
+#    if DILIGENT_EGL_SUPPORTED
+        if (HeadlessContext != EGL_NO_CONTEXT)
+            eglDestroyContext(HeadlessDisplay, HeadlessContext);
+#    endif
+        if (Pbuffer != 0)
+            glXDestroyPbuffer(pDisplay, Pbuffer);
+        if (Context != nullptr)
+            glXDestroyContext(pDisplay, Context);
+    }
+};
+
+#elif PLATFORM_ANDROID
+
+struct GLWorkerContextPool::WorkerContext
+{
+    EGLDisplay Display = EGL_NO_DISPLAY;
+    EGLContext Context = EGL_NO_CONTEXT;
+    EGLSurface Surface = EGL_NO_SURFACE;
+
+    std::unique_ptr<GLContextState> pState;
+
+    static std::unique_ptr<WorkerContext> Create(const MainContextAttribs& Attribs)
+    {
+        const EGLDisplay Display  = eglGetCurrentDisplay();
+        const EGLContext ShareCtx = eglGetCurrentContext();
+
+        // Use the config of the main context
+        EGLint ConfigId = 0;
+        eglQueryContext(Display, ShareCtx, EGL_CONFIG_ID, &ConfigId);
+        const EGLint ConfigAttribs[] = {EGL_CONFIG_ID, ConfigId, EGL_NONE};
+
+        EGLConfig Config     = nullptr;
+        EGLint    NumConfigs = 0;
+        if (!eglChooseConfig(Display, ConfigAttribs, &Config, 1, &NumConfigs) || NumConfigs == 0)
+        {
+            LOG_ERROR_MESSAGE("Failed to find the config of the main EGL context");
+            return {};
+        }
+
+        const EGLint ContextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, Attribs.MajorVersion, EGL_NONE};
+
+        const EGLContext Context = eglCreateContext(Display, Config, ShareCtx, ContextAttribs);
+        if (Context == EGL_NO_CONTEXT)
+        {
+            LOG_ERROR_MESSAGE("Failed to create shared worker EGL context");
+            return {};
+        }
+
+        std::unique_ptr<WorkerContext> pContext{new WorkerContext};
+        pContext->Display = Display;
+        pContext->Context = Context;
+
+        // If the config does not support pbuffers, the context is made current without a surface,
+        // which requires EGL_KHR_surfaceless_context
+        const EGLint SurfaceAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+        pContext->Surface             = eglCreatePbufferSurface(Display, Config, SurfaceAttribs);
+
+        return pContext;
+    }
+
+    bool MakeCurrent()
+    {
+        return eglMakeCurrent(Display, Surface, Surface, Context) == EGL_TRUE;
+    }
+
+    void ReleaseCurrent()
+    {
+        eglMakeCurrent(Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+
+    ~WorkerContext()
+    {
+        if (Surface != EGL_NO_SURFACE)
+            eglDestroySurface(Display, Surface);
+        if (Context != EGL_NO_CONTEXT)
+            eglDestroyContext(Display, Context);
+    }
+};
+
+#else
+
+struct GLWorkerContextPool::WorkerContext
+{
+    std::unique_ptr<GLContextState> pState;
+
+    static std::unique_ptr<WorkerContext> Create(const MainContextAttribs& /*Attribs*/)
+    {
+        LOG_WARNING_MESSAGE("Shared worker GL contexts are not supported on this platform");
+        return {};
+    }
+
+    bool MakeCurrent()
+    {
+        return false;
+    }
+
+    void ReleaseCurrent()
+    {
+    }
+};
+
+#endif
+
+GLWorkerContextPool::GLWorkerContextPool(RenderDeviceGLImpl* pDevice, Uint32 NumContexts) :
+    m_pDevice{pDevice}
+{
+    MainContextAttribs Attribs;
+    glGetIntegerv(GL_MAJOR_VERSION, &Attribs.MajorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &Attribs.MinorVersion);
+#if GL_CONTEXT_PROFILE_MASK
+    if (pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_GL)
+    {
+        glGetIntegerv(GL_CONTEXT_FLAGS, &Attribs.Flags);
+        if (pDevice->GetDeviceInfo().APIVersion >= Version{3, 2})
+            glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &Attribs.ProfileMask);
+    }
+#endif
+    CHECK_GL_ERROR("Failed to query main context attributes");
+
+    m_Contexts.reserve(NumContexts);
+    for (Uint32 i = 0; i < NumContexts; ++i)
+    {
+        std::unique_ptr<WorkerContext> pContext = WorkerContext::Create(Attribs);
+        if (!pContext)
+            break;
+        m_FreeContexts.push_back(pContext.get());
+        m_Contexts.emplace_back(std::move(pContext));
+    }
+
+    if (!m_Contexts.empty())
+        LOG_INFO_MESSAGE("Created ", m_Contexts.size(), " shared worker GL context", (m_Contexts.size() > 1 ? "s" : ""));
+}
+
+GLWorkerContextPool::~GLWorkerContextPool()
+{
+    VERIFY(m_FreeContexts.size() == m_Contexts.size(), "Destroying worker context pool while some contexts are in use");
+}
+
+GLWorkerContextPool::WorkerContext* GLWorkerContextPool::Acquire()
+{
+    std::unique_lock<std::mutex> Lock{m_FreeContextsMtx};
+    m_FreeContextCV.wait(Lock, [this]() { return !m_FreeContexts.empty(); });
+
+    WorkerContext* pContext = m_FreeContexts.back();
+    m_FreeContexts.pop_back();
+    return pContext;
+}
+
+void GLWorkerContextPool::Release(WorkerContext* pContext)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_FreeContextsMtx};
+        m_FreeContexts.push_back(pContext);
+    }
+    m_FreeContextCV.notify_one();
+}
+
+GLContextState* GLWorkerContextPool::GetCurrentContextState()
+{
+    return tl_pCurrentContextState;
+}
+
+GLWorkerContextPool::ScopedContext::ScopedContext(GLWorkerContextPool& Pool) :
+    m_Pool{Pool}
+{
+    VERIFY(tl_pCurrentContextState == nullptr, "This thread already uses a worker context");
+    VERIFY(Pool.GetNumContexts() > 0, "The pool has no worker contexts");
+
+    m_pContext = m_Pool.Acquire();
+    if (!m_pContext->MakeCurrent())
+    {
+        m_Pool.Release(m_pContext);
+        LOG_ERROR_AND_THROW("Failed to make worker GL context current");
+    }
+
+    // The state is created once the context is current on a worker thread for the first time
+    if (!m_pContext->pState)
+        m_pContext->pState = std::make_unique<GLContextState>(m_Pool.m_pDevice);
+    tl_pCurrentContextState = m_pContext->pState.get();
+}
+
+GLWorkerContextPool::ScopedContext::~ScopedContext()
+{
+    {
+        // Objects created by the worker context may only be used by the main context
+        // after the commands that initialize them have completed.
+        GLObjectWrappers::GLSyncObj Fence{glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)};
+
+        GLenum Res = GL_WAIT_FAILED;
+        do
+        {
+            constexpr GLuint64 Timeout = 1000000000; // 1 second
+            Res                        = glClientWaitSync(Fence, GL_SYNC_FLUSH_COMMANDS_BIT, Timeout);
+        } while (Res == GL_TIMEOUT_EXPIRED);
+        DEV_CHECK_ERR(Res != GL_WAIT_FAILED, "Failed to wait for the worker context fence");
+    }
+
+    tl_pCurrentContextState = nullptr;
+    m_pContext->ReleaseCurrent();
+    m_Pool.Release(m_pContext);
+}
+
+GLContextState& GLWorkerContextPool::ScopedContext::GetContextState()
+{
+    VERIFY_EXPR(m_pContext != nullptr && m_pContext->pState);
+    return *m_pContext->pState;
+}
+
+} // namespace Diligent
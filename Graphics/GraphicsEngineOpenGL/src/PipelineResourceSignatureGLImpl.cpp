@@ -172,19 +172,19 @@ void PipelineResourceSignatureGLImpl::CreateLayout(const bool IsSerialized)
 
             if (Range == BINDING_RANGE_UNIFORM_BUFFER && (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS) == 0)
             {
-                DEV_CHECK_ERR(size_t{CacheOffset} + ResDesc.ArraySize < sizeof(m_DynamicUBOMask) * 8, "Dynamic UBO index exceeds maximum representable bit position in the mask");
-                for (Uint64 elem = 0; elem < ResDesc.ArraySize; ++elem)
+                DEV_CHECK_ERR(size_t{CacheOffset} + ResDesc.GetArraySize() < sizeof(m_DynamicUBOMask) * 8, "Dynamic UBO index exceeds maximum representable bit position in the mask");
+                for (Uint64 elem = 0; elem < ResDesc.GetArraySize(); ++elem)
                     m_DynamicUBOMask |= Uint64{1} << (Uint64{CacheOffset} + elem);
             }
             else if (Range == BINDING_RANGE_STORAGE_BUFFER && (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS) == 0)
             {
-                DEV_CHECK_ERR(size_t{CacheOffset} + ResDesc.ArraySize < sizeof(m_DynamicSSBOMask) * 8, "Dynamic SSBO index exceeds maximum representable bit position in the mask");
-                for (Uint64 elem = 0; elem < ResDesc.ArraySize; ++elem)
+                DEV_CHECK_ERR(size_t{CacheOffset} + ResDesc.GetArraySize() < sizeof(m_DynamicSSBOMask) * 8, "Dynamic SSBO index exceeds maximum representable bit position in the mask");
+                for (Uint64 elem = 0; elem < ResDesc.GetArraySize(); ++elem)
                     m_DynamicSSBOMask |= Uint64{1} << (Uint64{CacheOffset} + elem);
             }
 
-            VERIFY(CacheOffset + ResDesc.ArraySize <= std::numeric_limits<TBindings::value_type>::max(), "Cache offset exceeds representable range");
-            CacheOffset += static_cast<TBindings::value_type>(ResDesc.ArraySize);
+            VERIFY(CacheOffset + ResDesc.GetArraySize() <= std::numeric_limits<TBindings::value_type>::max(), "Cache offset exceeds representable range");
+            CacheOffset += static_cast<TBindings::value_type>(ResDesc.GetArraySize());
 
             if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
             {
@@ -333,7 +333,7 @@ void PipelineResourceSignatureGLImpl::ApplyBindings(GLObjectWrappers::GLProgramO
 
         VERIFY_EXPR(strcmp(ResDesc.Name, Attribs.Name) == 0);
         VERIFY_EXPR(ResDesc.ResourceType != SHADER_RESOURCE_TYPE_SAMPLER);
-        VERIFY_EXPR(Attribs.ArraySize <= ResDesc.ArraySize);
+        VERIFY_EXPR(Attribs.ArraySize <= ResDesc.GetArraySize());
 
         VERIFY_EXPR(Range == PipelineResourceToBindingRange(ResDesc));
         const Uint32 BindingIndex = BaseBindings[Range] + ResAttr.CacheOffset;
@@ -403,7 +403,7 @@ void PipelineResourceSignatureGLImpl::CopyStaticResources(ShaderResourceCacheGL&
         switch (PipelineResourceToBindingRange(ResDesc))
         {
             case BINDING_RANGE_UNIFORM_BUFFER:
-                for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                 {
                     const ShaderResourceCacheGL::CachedUB& SrcCachedRes = SrcResourceCache.GetConstUB(ResAttr.CacheOffset + ArrInd);
                     if (!SrcCachedRes.pBuffer)
@@ -419,7 +419,7 @@ void PipelineResourceSignatureGLImpl::CopyStaticResources(ShaderResourceCacheGL&
                 }
                 break;
             case BINDING_RANGE_STORAGE_BUFFER:
-                for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                 {
                     const ShaderResourceCacheGL::CachedSSBO& SrcCachedRes = SrcResourceCache.GetConstSSBO(ResAttr.CacheOffset + ArrInd);
                     if (!SrcCachedRes.pBufferView)
@@ -433,7 +433,7 @@ void PipelineResourceSignatureGLImpl::CopyStaticResources(ShaderResourceCacheGL&
                 }
                 break;
             case BINDING_RANGE_TEXTURE:
-                for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                 {
                     const ShaderResourceCacheGL::CachedResourceView& SrcCachedRes = SrcResourceCache.GetConstTexture(ResAttr.CacheOffset + ArrInd);
                     if (!SrcCachedRes.pView)
@@ -467,7 +467,7 @@ void PipelineResourceSignatureGLImpl::CopyStaticResources(ShaderResourceCacheGL&
                 }
                 break;
             case BINDING_RANGE_IMAGE:
-                for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                 {
                     const ShaderResourceCacheGL::CachedResourceView& SrcCachedRes = SrcResourceCache.GetConstImage(ResAttr.CacheOffset + ArrInd);
                     if (!SrcCachedRes.pView)
@@ -527,7 +527,7 @@ void PipelineResourceSignatureGLImpl::InitSRBResourceCache(ShaderResourceCacheGL
             ISampler* pSampler = m_pImmutableSamplers[ImtblSamplerIdx];
             VERIFY(pSampler != nullptr, "Immutable sampler is not initialized - this is a bug");
 
-            for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+            for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                 ResourceCache.SetSampler(ResAttr.CacheOffset + ArrInd, pSampler);
         }
     }
@@ -550,7 +550,7 @@ bool PipelineResourceSignatureGLImpl::DvpValidateCommittedResource(const ShaderR
     if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER)
         return true; // Skip separate samplers
 
-    VERIFY_EXPR(GLAttribs.ArraySize <= ResDesc.ArraySize);
+    VERIFY_EXPR(GLAttribs.ArraySize <= ResDesc.GetArraySize());
 
     bool BindingsOK = true;
 
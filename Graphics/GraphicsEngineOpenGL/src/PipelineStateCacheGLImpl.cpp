@@ -0,0 +1,220 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+
+#include "pch.h"
+#include "PipelineStateCacheGLImpl.hpp"
+#include "RenderDeviceGLImpl.hpp"
+#include "DataBlobImpl.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 ProgramBinaryCacheMagic   = 0x50474C44; // 'DLGP'
+constexpr Uint32 ProgramBinaryCacheVersion = 1;
+
+struct ProgramBinaryCacheHeader
+{
+    Uint32 Magic       = ProgramBinaryCacheMagic;
+    Uint32 Version     = ProgramBinaryCacheVersion;
+    Uint64 DriverHash  = 0;
+    Uint32 NumBinaries = 0;
+    Uint32 Padding     = 0;
+};
+static_assert(sizeof(ProgramBinaryCacheHeader) == 24, "Changing the header size breaks binary compatibility. Bump ProgramBinaryCacheVersion.");
+
+struct ProgramBinaryEntryHeader
+{
+    Uint64 Key    = 0;
+    Uint32 Format = 0;
+    Uint32 Size   = 0;
+};
+static_assert(sizeof(ProgramBinaryEntryHeader) == 16, "Changing the entry header size breaks binary compatibility. Bump ProgramBinaryCacheVersion.");
+
+Uint64 ComputeDriverHash()
+{
+    size_t Hash = 0;
+    for (GLenum Name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+    {
+        const char* Str = reinterpret_cast<const char*>(glGetString(Name));
+        // Note that std::hash is not guaranteed to produce the same results across runs,
+        // so ComputeHashRaw is used.
+        HashCombine(Hash, Str != nullptr ? ComputeHashRaw(Str, strlen(Str)) : size_t{0});
+    }
+    return Hash;
+}
+
+} // namespace
+
+PipelineStateCacheGLImpl::PipelineStateCacheGLImpl(IReferenceCounters*                 pRefCounters,
+                                                   RenderDeviceGLImpl*                 pRenderDeviceGL,
+                                                   const PipelineStateCacheCreateInfo& CreateInfo) :
+    // clang-format off
+    TPipelineStateCacheBase
+    {
+        pRefCounters,
+        pRenderDeviceGL,
+        CreateInfo,
+        false
+    },
+    m_DriverHash{ComputeDriverHash()}
+// clang-format on
+{
+    if (IsLoadEnabled() && CreateInfo.pCacheData != nullptr && CreateInfo.CacheDataSize > 0)
+        LoadData(CreateInfo.pCacheData, CreateInfo.CacheDataSize);
+}
+
+PipelineStateCacheGLImpl::~PipelineStateCacheGLImpl()
+{
+}
+
+void PipelineStateCacheGLImpl::LoadData(const void* pData, size_t DataSize)
+{
+    const Uint8*       pCurr = static_cast<const Uint8*>(pData);
+    const Uint8* const pEnd  = pCurr + DataSize;
+
+    ProgramBinaryCacheHeader Header;
+    if (DataSize < sizeof(Header))
+    {
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_WARNING_MESSAGE("The OpenGL program binary cache data is too small. An empty cache will be created.");
+        return;
+    }
+    memcpy(&Header, pCurr, sizeof(Header));
+    pCurr += sizeof(Header);
+
+    if (Header.Magic != ProgramBinaryCacheMagic || Header.Version != ProgramBinaryCacheVersion)
+    {
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_WARNING_MESSAGE("The OpenGL program binary cache data is invalid or was created by a different engine version. An empty cache will be created.");
+        return;
+    }
+
+    if (Header.DriverHash != m_DriverHash)
+    {
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_WARNING_MESSAGE("The OpenGL program binary cache data was created by a different GPU or driver version. An empty cache will be created.");
+        return;
+    }
+
+    for (Uint32 i = 0; i < Header.NumBinaries; ++i)
+    {
+        ProgramBinaryEntryHeader Entry;
+        if (pCurr + sizeof(Entry) > pEnd)
+            break;
+        memcpy(&Entry, pCurr, sizeof(Entry));
+        pCurr += sizeof(Entry);
+
+        if (pCurr + Entry.Size > pEnd)
+            break;
+
+        auto pBinary = std::make_shared<ProgramBinary>();
+
+        pBinary->Format = Entry.Format;
+        pBinary->Data.assign(pCurr, pCurr + Entry.Size);
+        pCurr += Entry.Size;
+
+        m_Binaries.emplace(Entry.Key, std::move(pBinary));
+    }
+
+    if (m_Binaries.size() != Header.NumBinaries && (m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+    {
+        LOG_WARNING_MESSAGE("The OpenGL program binary cache data is truncated: ", m_Binaries.size(), " out of ", Header.NumBinaries, " binaries were loaded.");
+    }
+}
+
+std::shared_ptr<const PipelineStateCacheGLImpl::ProgramBinary> PipelineStateCacheGLImpl::GetProgramBinary(Uint64 Key) const
+{
+    if (!IsLoadEnabled())
+        return {};
+
+    std::lock_guard<std::mutex> Lock{m_BinariesMtx};
+
+    auto it = m_Binaries.find(Key);
+    return it != m_Binaries.end() ? it->second : nullptr;
+}
+
+void PipelineStateCacheGLImpl::StoreProgramBinary(Uint64 Key, ProgramBinary&& Binary)
+{
+    if (!IsStoreEnabled() || Binary.Data.empty())
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_BinariesMtx};
+    m_Binaries[Key] = std::make_shared<ProgramBinary>(std::move(Binary));
+}
+
+void PipelineStateCacheGLImpl::RemoveProgramBinary(Uint64 Key)
+{
+    std::lock_guard<std::mutex> Lock{m_BinariesMtx};
+    m_Binaries.erase(Key);
+}
+
+void PipelineStateCacheGLImpl::GetData(IDataBlob** ppBlob)
+{
+    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
+    *ppBlob = nullptr;
+
+    std::lock_guard<std::mutex> Lock{m_BinariesMtx};
+
+    size_t DataSize = sizeof(ProgramBinaryCacheHeader);
+    for (const auto& it : m_Binaries)
+        DataSize += sizeof(ProgramBinaryEntryHeader) + it.second->Data.size();
+
+    RefCntAutoPtr<DataBlobImpl> pDataBlob = DataBlobImpl::Create(DataSize);
+
+    Uint8* pCurr = pDataBlob->GetDataPtr<Uint8>();
+
+    ProgramBinaryCacheHeader Header;
+    Header.DriverHash  = m_DriverHash;
+    Header.NumBinaries = static_cast<Uint32>(m_Binaries.size());
+    memcpy(pCurr, &Header, sizeof(Header));
+    pCurr += sizeof(Header);
+
+    for (const auto& it : m_Binaries)
+    {
+        const ProgramBinary& Binary = *it.second;
+
+        ProgramBinaryEntryHeader Entry;
+        Entry.Key    = it.first;
+        Entry.Format = Binary.Format;
+        Entry.Size   = static_cast<Uint32>(Binary.Data.size());
+        memcpy(pCurr, &Entry, sizeof(Entry));
+        pCurr += sizeof(Entry);
+
+        memcpy(pCurr, Binary.Data.data(), Binary.Data.size());
+        pCurr += Binary.Data.size();
+    }
+    VERIFY_EXPR(pCurr == pDataBlob->GetConstDataPtr<Uint8>() + DataSize);
+
+    *ppBlob = pDataBlob.Detach();
+}
+
+} // namespace Diligent
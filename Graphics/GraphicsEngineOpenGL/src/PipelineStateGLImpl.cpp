@@ -34,6 +34,7 @@
 #include "RenderDeviceGLImpl.hpp"
 #include "DeviceContextGLImpl.hpp"
 #include "ShaderResourceBindingGLImpl.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
 #include "GLTypeConversions.hpp"
 
 #include "EngineMemory.h"
@@ -399,6 +400,7 @@ private:
                         m_CreateInfo.ResourceSignaturesCount == 0 ? &m_CreateInfo.PSODesc.ResourceLayout : nullptr,
                         m_CreateInfo.ppResourceSignatures,
                         m_CreateInfo.ResourceSignaturesCount,
+                        ClassPtrCast<PipelineStateCacheGLImpl>(m_CreateInfo.pPSOCache),
                     };
                     m_Pipeline.m_GLPrograms[i]  = m_Pipeline.GetDevice()->GetProgramCache().GetProgram(ProgAttribs);
                     m_Pipeline.m_ShaderTypes[i] = m_Shaders[i]->GetDesc().ShaderType;
@@ -416,6 +418,7 @@ private:
                     m_CreateInfo.ResourceSignaturesCount == 0 ? &m_CreateInfo.PSODesc.ResourceLayout : nullptr,
                     m_CreateInfo.ppResourceSignatures,
                     m_CreateInfo.ResourceSignaturesCount,
+                    ClassPtrCast<PipelineStateCacheGLImpl>(m_CreateInfo.pPSOCache),
                 };
                 m_Pipeline.m_GLPrograms[0]  = m_Pipeline.GetDevice()->GetProgramCache().GetProgram(ProgAttribs);
                 m_Pipeline.m_ShaderTypes[0] = ActiveStages;
@@ -447,6 +450,27 @@ private:
             }
         }
 
+        // Programs shared with other pipelines through the program cache report the time it took to link them
+        Uint64                                 Duration            = 0;
+        bool                                   AllLoadedFromBinary = true;
+        std::vector<PipelineStageCompileStats> StageStats;
+        for (Uint32 i = 0; i < m_Pipeline.m_NumPrograms; ++i)
+        {
+            const GLProgram& Program = *m_Pipeline.m_GLPrograms[i];
+            Duration += Program.GetLinkDuration();
+            AllLoadedFromBinary = AllLoadedFromBinary && Program.IsLoadedFromBinary();
+            if (m_Pipeline.m_IsProgramPipelineSupported)
+            {
+                // Every separable program contains a single stage
+                PipelineStageCompileStats Stage;
+                Stage.ShaderType  = m_Pipeline.m_ShaderTypes[i];
+                Stage.CacheStatus = Program.IsLoadedFromBinary() ? PIPELINE_CACHE_STATUS_HIT : PIPELINE_CACHE_STATUS_MISS;
+                Stage.Duration    = Program.GetLinkDuration();
+                StageStats.push_back(Stage);
+            }
+        }
+        m_Pipeline.SetCompileStats(AllLoadedFromBinary ? PIPELINE_CACHE_STATUS_HIT : PIPELINE_CACHE_STATUS_MISS, Duration, std::move(StageStats));
+
         m_Pipeline.InitResourceLayout(GetInternalCreateFlags(m_CreateInfo), m_Shaders, ActiveStages);
         m_State = State::Complete;
     }
@@ -47,6 +47,7 @@
 #include "RenderPassGLImpl.hpp"
 #include "FramebufferGLImpl.hpp"
 #include "PipelineResourceSignatureGLImpl.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
 
 #include "GLTypeConversions.hpp"
 #include "VAOCache.hpp"
@@ -312,6 +313,16 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
     }
 #endif
 
+    // Without persistent mapping, the ring stages updates in CPU memory and uploads them in batches
+    m_DynamicUniformRingPageSize = EngineCI.DynamicUniformRingPageSize;
+
+    if (EngineCI.NumWorkerContexts > 0)
+    {
+        m_pWorkerContextPool = std::make_unique<GLWorkerContextPool>(this, EngineCI.NumWorkerContexts);
+        if (m_pWorkerContextPool->GetNumContexts() == 0)
+            m_pWorkerContextPool.reset();
+    }
+
     // get device limits
     {
         glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &m_DeviceLimits.MaxUniformBlocks);
@@ -345,7 +356,14 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
 #if GL_KHR_parallel_shader_compile
     if (m_DeviceInfo.Features.AsyncShaderCompilation)
     {
-        glMaxShaderCompilerThreadsKHR(EngineCI.NumAsyncShaderCompilationThreads);
+#    if GL_ARB_parallel_shader_compile
+        // Desktop drivers may only expose the ARB version of the extension. Since both versions
+        // use the same GL_COMPLETION_STATUS token, only the thread count function differs.
+        if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GL && !CheckExtension("GL_KHR_parallel_shader_compile"))
+            glMaxShaderCompilerThreadsARB(EngineCI.NumAsyncShaderCompilationThreads);
+        else
+#    endif
+            glMaxShaderCompilerThreadsKHR(EngineCI.NumAsyncShaderCompilationThreads);
     }
 #endif
 }
@@ -356,11 +374,39 @@ RenderDeviceGLImpl::~RenderDeviceGLImpl()
 
 IMPLEMENT_QUERY_INTERFACE(RenderDeviceGLImpl, IID_RenderDeviceGL, TRenderDeviceBase)
 
-void RenderDeviceGLImpl::CreateBuffer(const BufferDesc& BuffDesc, const BufferData* pBuffData, IBuffer** ppBuffer, bool bIsDeviceInternal)
+std::unique_ptr<GLWorkerContextPool::ScopedContext> RenderDeviceGLImpl::AcquireWorkerContext()
+{
+    if (!m_pWorkerContextPool || GLWorkerContextPool::GetCurrentContextState() != nullptr)
+        return {};
+
+    if (m_GLContext.GetCurrentNativeGLContext() != GLContext::NativeGLContextType{})
+        return {};
+
+    try
+    {
+        return std::make_unique<GLWorkerContextPool::ScopedContext>(*m_pWorkerContextPool);
+    }
+    catch (...)
+    {
+        return {};
+    }
+}
+
+GLContextState& RenderDeviceGLImpl::GetCurrentContextState()
 {
+    if (GLContextState* pWorkerState = GLWorkerContextPool::GetCurrentContextState())
+        return *pWorkerState;
+
     RefCntAutoPtr<DeviceContextGLImpl> pDeviceContext = GetImmediateContext(0);
     VERIFY(pDeviceContext, "Immediate device context has been destroyed");
-    CreateBufferImpl(ppBuffer, BuffDesc, std::ref(pDeviceContext->GetContextState()), pBuffData, bIsDeviceInternal);
+    return pDeviceContext->GetContextState();
+}
+
+void RenderDeviceGLImpl::CreateBuffer(const BufferDesc& BuffDesc, const BufferData* pBuffData, IBuffer** ppBuffer, bool bIsDeviceInternal)
+{
+    // Threads that have no current GL context create the buffer in a worker context
+    std::unique_ptr<GLWorkerContextPool::ScopedContext> pWorkerCtx = AcquireWorkerContext();
+    CreateBufferImpl(ppBuffer, BuffDesc, std::ref(GetCurrentContextState()), pBuffData, bIsDeviceInternal);
 }
 
 void RenderDeviceGLImpl::CreateBuffer(const BufferDesc& BuffDesc, const BufferData* BuffData, IBuffer** ppBuffer)
@@ -399,13 +445,14 @@ void RenderDeviceGLImpl::CreateShader(const ShaderCreateInfo& ShaderCreateInfo,
 
 void RenderDeviceGLImpl::CreateTexture(const TextureDesc& TexDesc, const TextureData* pData, ITexture** ppTexture, bool bIsDeviceInternal)
 {
+    // Threads that have no current GL context create the texture in a worker context
+    std::unique_ptr<GLWorkerContextPool::ScopedContext> pWorkerCtx = AcquireWorkerContext();
+
     CreateDeviceObject(
         "texture", TexDesc, ppTexture,
         [&]() //
         {
-            RefCntAutoPtr<DeviceContextGLImpl> pDeviceContext = GetImmediateContext(0);
-            VERIFY(pDeviceContext, "Immediate device context has been destroyed");
-            GLContextState& GLState = pDeviceContext->GetContextState();
+            GLContextState& GLState = GetCurrentContextState();
 
             const TextureFormatInfo& FmtInfo = GetTextureFormatInfo(TexDesc.Format);
             if (!FmtInfo.Supported)
@@ -581,6 +628,18 @@ void RenderDeviceGLImpl::CreateQuery(const QueryDesc& Desc, IQuery** ppQuery)
     CreateQueryImpl(ppQuery, Desc);
 }
 
+void RenderDeviceGLImpl::CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool)
+{
+    UNSUPPORTED("CreateQueryPool is not supported in OpenGL");
+    *ppQueryPool = nullptr;
+}
+
+void RenderDeviceGLImpl::CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc, IIndirectCommandSignature** ppSignature)
+{
+    UNSUPPORTED("CreateIndirectCommandSignature is not supported in OpenGL");
+    *ppSignature = nullptr;
+}
+
 void RenderDeviceGLImpl::CreateRenderPass(const RenderPassDesc& Desc, IRenderPass** ppRenderPass)
 {
     CreateRenderPassImpl(ppRenderPass, Desc);
@@ -643,16 +702,34 @@ void RenderDeviceGLImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& Create
     *ppMemory = nullptr;
 }
 
+void RenderDeviceGLImpl::CreatePlacedTexture(const TextureDesc& TexDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, ITexture** ppTexture)
+{
+    UNSUPPORTED("CreatePlacedTexture is not supported in OpenGL");
+    *ppTexture = nullptr;
+}
+
+void RenderDeviceGLImpl::CreatePlacedBuffer(const BufferDesc& BuffDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, IBuffer** ppBuffer)
+{
+    UNSUPPORTED("CreatePlacedBuffer is not supported in OpenGL");
+    *ppBuffer = nullptr;
+}
+
 void RenderDeviceGLImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                   IPipelineStateCache**               ppPSOCache)
 {
-    *ppPSOCache = nullptr;
+    if (!m_GLCaps.ProgramBinary)
+    {
+        *ppPSOCache = nullptr;
+        return;
+    }
+    CreatePipelineStateCacheImpl(ppPSOCache, CreateInfo);
 }
 
 void RenderDeviceGLImpl::CreateDeferredContext(IDeviceContext** ppContext)
 {
-    LOG_ERROR_MESSAGE("Deferred contexts are not supported in OpenGL backend.");
-    *ppContext = nullptr;
+    // OpenGL has no native command lists: deferred contexts record the commands
+    // into a command stream that is replayed by the immediate context.
+    CreateRecordingDeferredContext(ppContext);
 }
 
 SparseTextureFormatInfo RenderDeviceGLImpl::GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
@@ -663,6 +740,17 @@ SparseTextureFormatInfo RenderDeviceGLImpl::GetSparseTextureFormatInfo(TEXTURE_F
     return {};
 }
 
+ResourceMemoryRequirements RenderDeviceGLImpl::GetTextureMemoryRequirements(const TextureDesc& TexDesc) const
+{
+    // Placed resources are not supported in OpenGL
+    return {};
+}
+
+ResourceMemoryRequirements RenderDeviceGLImpl::GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const
+{
+    return {};
+}
+
 bool RenderDeviceGLImpl::CheckExtension(const Char* ExtensionString) const
 {
     return m_ExtensionStrings.find(ExtensionString) != m_ExtensionStrings.end();
@@ -873,8 +961,9 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             ENABLE_FEATURE(TextureComponentSwizzle,       IsGL46OrAbove || CheckExtension("GL_ARB_texture_swizzle"));
             ENABLE_FEATURE(TextureSubresourceViews,       IsGL43OrAbove || CheckExtension("GL_ARB_texture_view"));
             ENABLE_FEATURE(NativeMultiDraw,               IsGL46OrAbove || CheckExtension("GL_ARB_shader_draw_parameters")); // Requirements for gl_DrawID
-            ENABLE_FEATURE(AsyncShaderCompilation,        CheckExtension("GL_KHR_parallel_shader_compile"));
+            ENABLE_FEATURE(AsyncShaderCompilation,        CheckExtension("GL_KHR_parallel_shader_compile") || CheckExtension("GL_ARB_parallel_shader_compile"));
             ENABLE_FEATURE(FormattedBuffers,              IsGL40OrAbove);
+            ENABLE_FEATURE(Multiview,                     CheckExtension("GL_OVR_multiview2"));
             // clang-format on
 
             TexProps.MaxTexture1DDimension      = MaxTextureSize;
@@ -956,6 +1045,11 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             ENABLE_FEATURE(NativeMultiDraw,           strstr(Extensions, "multi_draw"));
             ENABLE_FEATURE(AsyncShaderCompilation,    strstr(Extensions, "parallel_shader_compile"));
             ENABLE_FEATURE(FormattedBuffers,          IsGLES32OrAbove);
+#if PLATFORM_ANDROID
+            ENABLE_FEATURE(Multiview,                 strstr(Extensions, "GL_OVR_multiview2"));
+#else
+            ENABLE_FEATURE(Multiview,                 false);
+#endif
             // clang-format on
 
             TexProps.MaxTexture1DDimension      = 0; // Not supported in GLES 3.2
@@ -986,6 +1080,32 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             m_GLCaps.SemalessCubemaps = false;
         }
 
+#if !PLATFORM_WEB
+        // Program binaries are core in GL4.1 and GLES3.0, but drivers are not required to support any format.
+        if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GLES || GLVersion >= Version{4, 1} || CheckExtension("GL_ARB_get_program_binary"))
+        {
+            GLint NumProgramBinaryFormats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &NumProgramBinaryFormats);
+            if (glGetError() == GL_NO_ERROR)
+                m_GLCaps.ProgramBinary = NumProgramBinaryFormats > 0;
+        }
+
+#    if GL_ARB_buffer_storage
+        // Persistently mapped buffers are core in GL4.4. GLES only exposes them through GL_EXT_buffer_storage.
+        if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GL)
+            m_GLCaps.BufferStorage = GLVersion >= Version{4, 4} || CheckExtension("GL_ARB_buffer_storage");
+#    endif
+#    if GL_ARB_multi_bind
+        if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GL)
+            m_GLCaps.MultiBind = GLVersion >= Version{4, 4} || CheckExtension("GL_ARB_multi_bind");
+#    endif
+#    if GL_ARB_vertex_attrib_binding
+        // Separate vertex attribute formats are core in GL4.3.
+        if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GL)
+            m_GLCaps.VertexAttribBinding = GLVersion >= Version{4, 3} || CheckExtension("GL_ARB_vertex_attrib_binding");
+#    endif
+#endif
+
 #ifdef GL_KHR_shader_subgroup
         if (CheckExtension("GL_KHR_shader_subgroup"))
         {
@@ -1131,7 +1251,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
         m_AdapterInfo.Queues[0].TextureCopyGranularity[2] = 1;
     }
 
-    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+    ASSERT_SIZEOF(DeviceFeatures, 52, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
 }
 
 void RenderDeviceGLImpl::FlagSupportedTexFormats()
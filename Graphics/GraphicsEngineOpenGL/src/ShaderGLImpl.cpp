@@ -38,6 +38,7 @@
 #include "ShaderToolsCommon.hpp"
 #include "GLTypeConversions.hpp"
 #include "GLProgram.hpp"
+#include "Trace.hpp"
 
 using namespace Diligent;
 
@@ -267,6 +268,8 @@ IMPLEMENT_QUERY_INTERFACE2(ShaderGLImpl, IID_ShaderGL, IID_InternalImpl, TShader
 
 void ShaderGLImpl::CompileShader() noexcept
 {
+    DILIGENT_TRACE_SCOPE("CompileShader");
+
     // Note: there is a simpler way to create the program:
     //m_uiShaderSeparateProg = glCreateShaderProgramv(GL_VERTEX_SHADER, _countof(ShaderStrings), ShaderStrings);
     // NOTE: glCreateShaderProgramv() is considered equivalent to both a shader compilation and a program linking
@@ -35,6 +35,90 @@
 namespace Diligent
 {
 
+namespace
+{
+
+constexpr Uint32 MaxBindingBatchSize = 32;
+
+// Collects bindings to consecutive slots and commits them with a single GLContextState range call
+template <typename BindingType>
+class BindingBatch
+{
+public:
+    BindingType& Add(GLContextState& GLState, Uint32 Slot)
+    {
+        if (m_Count > 0 && (Slot != m_First + m_Count || m_Count == MaxBindingBatchSize))
+            Flush(GLState);
+
+        if (m_Count == 0)
+            m_First = Slot;
+
+        m_Bindings[m_Count] = {};
+        return m_Bindings[m_Count++];
+    }
+
+    void Flush(GLContextState& GLState)
+    {
+        if (m_Count > 0)
+            BindingType::Commit(GLState, m_First, m_Bindings.data(), m_Count);
+        m_Count = 0;
+    }
+
+private:
+    std::array<BindingType, MaxBindingBatchSize> m_Bindings;
+
+    Uint32 m_First = 0;
+    Uint32 m_Count = 0;
+};
+
+struct TextureBinding
+{
+    const GLObjectWrappers::GLTextureObj* pTexture   = nullptr;
+    GLenum                                BindTarget = 0;
+    const GLObjectWrappers::GLSamplerObj* pSampler   = nullptr;
+
+    static void Commit(GLContextState& GLState, Uint32 First, const TextureBinding* Bindings, Uint32 Count)
+    {
+        std::array<const GLObjectWrappers::GLTextureObj*, MaxBindingBatchSize> ppTextures;
+        std::array<GLenum, MaxBindingBatchSize>                                BindTargets;
+        std::array<const GLObjectWrappers::GLSamplerObj*, MaxBindingBatchSize> ppSamplers;
+        for (Uint32 i = 0; i < Count; ++i)
+        {
+            ppTextures[i]  = Bindings[i].pTexture;
+            BindTargets[i] = Bindings[i].BindTarget;
+            ppSamplers[i]  = Bindings[i].pSampler;
+        }
+        GLState.BindTextures(First, Count, ppTextures.data(), BindTargets.data());
+        GLState.BindSamplers(First, Count, ppSamplers.data());
+    }
+};
+
+template <void (GLContextState::*BindBuffers)(Uint32, Uint32, const GLObjectWrappers::GLBufferObj* const*, const GLintptr*, const GLsizeiptr*)>
+struct BufferRangeBinding
+{
+    const GLObjectWrappers::GLBufferObj* pBuffer = nullptr;
+    GLintptr                             Offset  = 0;
+    GLsizeiptr                           Size    = 0;
+
+    static void Commit(GLContextState& GLState, Uint32 First, const BufferRangeBinding* Bindings, Uint32 Count)
+    {
+        std::array<const GLObjectWrappers::GLBufferObj*, MaxBindingBatchSize> ppBuffers;
+        std::array<GLintptr, MaxBindingBatchSize>                             Offsets;
+        std::array<GLsizeiptr, MaxBindingBatchSize>                           Sizes;
+        for (Uint32 i = 0; i < Count; ++i)
+        {
+            ppBuffers[i] = Bindings[i].pBuffer;
+            Offsets[i]   = Bindings[i].Offset;
+            Sizes[i]     = Bindings[i].Size;
+        }
+        (GLState.*BindBuffers)(First, Count, ppBuffers.data(), Offsets.data(), Sizes.data());
+    }
+};
+using UniformBufferBinding = BufferRangeBinding<&GLContextState::BindUniformBuffers>;
+using StorageBlockBinding  = BufferRangeBinding<&GLContextState::BindStorageBlocks>;
+
+} // namespace
+
 size_t ShaderResourceCacheGL::GetRequiredMemorySize(const TResourceCount& ResCount)
 {
     static_assert(std::is_same<TResourceCount, PipelineResourceSignatureGLImpl::TBindings>::value,
@@ -125,64 +209,77 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
                                           std::vector<TextureBaseGL*>& WritableTextures,
                                           std::vector<BufferGLImpl*>&  WritableBuffers) const
 {
-    for (Uint32 ub = 0, binding = BaseBindings[BINDING_RANGE_UNIFORM_BUFFER]; ub < GetUBCount(); ++ub, ++binding)
+    // Consecutive non-empty slots are committed with a single range call (see GLContextState::BindTextures()).
     {
-        const CachedUB& UB = GetConstUB(ub);
-        if (!UB.pBuffer)
-            continue;
+        BindingBatch<UniformBufferBinding> UBs;
+        for (Uint32 ub = 0, binding = BaseBindings[BINDING_RANGE_UNIFORM_BUFFER]; ub < GetUBCount(); ++ub, ++binding)
+        {
+            const CachedUB& UB = GetConstUB(ub);
+            if (!UB.pBuffer)
+            {
+                UBs.Flush(GLState);
+                continue;
+            }
 
-        UB.pBuffer->BufferMemoryBarrier(
-            MEMORY_BARRIER_UNIFORM_BUFFER, // Shader uniforms sourced from buffer objects after the barrier
-                                           // will reflect data written by shaders prior to the barrier
-            GLState);
+            UB.pBuffer->BufferMemoryBarrier(
+                MEMORY_BARRIER_UNIFORM_BUFFER, // Shader uniforms sourced from buffer objects after the barrier
+                                               // will reflect data written by shaders prior to the barrier
+                GLState);
 
-        GLState.BindUniformBuffer(binding, UB.pBuffer->GetGLHandle(), static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset), UB.RangeSize);
+            UniformBufferBinding& Binding = UBs.Add(GLState, binding);
+            Binding.pBuffer             = &UB.GetGLBinding(Binding.Offset);
+            Binding.Size                = UB.RangeSize;
+        }
+        UBs.Flush(GLState);
     }
 
-    for (Uint32 s = 0, binding = BaseBindings[BINDING_RANGE_TEXTURE]; s < GetTextureCount(); ++s, ++binding)
     {
-        const CachedResourceView& Tex = GetConstTexture(s);
-        if (!Tex.pView)
-            continue;
-
-        // We must check 'pTexture' first as 'pBuffer' is in union with 'pSampler'
-        if (Tex.pTexture != nullptr)
+        BindingBatch<TextureBinding> Textures;
+        for (Uint32 s = 0, binding = BaseBindings[BINDING_RANGE_TEXTURE]; s < GetTextureCount(); ++s, ++binding)
         {
-            TextureViewGLImpl* pTexViewGL = Tex.pView.RawPtr<TextureViewGLImpl>();
-            TextureBaseGL*     pTextureGL = Tex.pTexture;
-            VERIFY_EXPR(pTextureGL == pTexViewGL->GetTexture());
-            GLState.BindTexture(binding, pTexViewGL->GetBindTarget(), pTexViewGL->GetHandle());
+            const CachedResourceView& Tex = GetConstTexture(s);
 
-            pTextureGL->TextureMemoryBarrier(
-                MEMORY_BARRIER_TEXTURE_FETCH, // Texture fetches from shaders, including fetches from buffer object
-                                              // memory via buffer textures, after the barrier will reflect data
-                                              // written by shaders prior to the barrier
-                GLState);
+            // We must check 'pTexture' first as 'pBuffer' is in union with 'pSampler'
+            if (Tex.pView && Tex.pTexture != nullptr)
+            {
+                TextureViewGLImpl* pTexViewGL = Tex.pView.RawPtr<TextureViewGLImpl>();
+                TextureBaseGL*     pTextureGL = Tex.pTexture;
+                VERIFY_EXPR(pTextureGL == pTexViewGL->GetTexture());
 
-            if (Tex.pSampler)
+                TextureBinding& Binding = Textures.Add(GLState, binding);
+                Binding.pTexture        = &pTexViewGL->GetHandle();
+                Binding.BindTarget      = pTexViewGL->GetBindTarget();
+                Binding.pSampler        = Tex.pSampler ? &Tex.pSampler->GetHandle() : nullptr;
+
+                pTextureGL->TextureMemoryBarrier(
+                    MEMORY_BARRIER_TEXTURE_FETCH, // Texture fetches from shaders, including fetches from buffer object
+                                                  // memory via buffer textures, after the barrier will reflect data
+                                                  // written by shaders prior to the barrier
+                    GLState);
+            }
+            else if (Tex.pView && Tex.pBuffer != nullptr)
             {
-                GLState.BindSampler(binding, Tex.pSampler->GetHandle());
+                BufferViewGLImpl* pBufViewGL = Tex.pView.RawPtr<BufferViewGLImpl>();
+                BufferGLImpl*     pBufferGL  = Tex.pBuffer;
+                VERIFY_EXPR(pBufferGL == pBufViewGL->GetBuffer());
+
+                TextureBinding& Binding = Textures.Add(GLState, binding);
+                Binding.pTexture        = &pBufViewGL->GetTexBufferHandle();
+                Binding.BindTarget      = GL_TEXTURE_BUFFER;
+                Binding.pSampler        = nullptr; // Use default texture sampling parameters
+
+                pBufferGL->BufferMemoryBarrier(
+                    MEMORY_BARRIER_TEXEL_BUFFER, // Texture fetches from shaders, including fetches from buffer object
+                                                 // memory via buffer textures, after the barrier will reflect data
+                                                 // written by shaders prior to the barrier
+                    GLState);
             }
             else
             {
-                GLState.BindSampler(binding, GLObjectWrappers::GLSamplerObj{false});
+                Textures.Flush(GLState);
             }
         }
-        else if (Tex.pBuffer != nullptr)
-        {
-            BufferViewGLImpl* pBufViewGL = Tex.pView.RawPtr<BufferViewGLImpl>();
-            BufferGLImpl*     pBufferGL  = Tex.pBuffer;
-            VERIFY_EXPR(pBufferGL == pBufViewGL->GetBuffer());
-
-            GLState.BindTexture(binding, GL_TEXTURE_BUFFER, pBufViewGL->GetTexBufferHandle());
-            GLState.BindSampler(binding, GLObjectWrappers::GLSamplerObj{false}); // Use default texture sampling parameters
-
-            pBufferGL->BufferMemoryBarrier(
-                MEMORY_BARRIER_TEXEL_BUFFER, // Texture fetches from shaders, including fetches from buffer object
-                                             // memory via buffer textures, after the barrier will reflect data
-                                             // written by shaders prior to the barrier
-                GLState);
-        }
+        Textures.Flush(GLState);
     }
 
 #if GL_ARB_shader_image_load_store
@@ -274,29 +371,33 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
 
 
 #if GL_ARB_shader_storage_buffer_object
-    for (Uint32 ssbo = 0, binding = BaseBindings[BINDING_RANGE_STORAGE_BUFFER]; ssbo < GetSSBOCount(); ++ssbo, ++binding)
     {
-        const CachedSSBO& SSBO = GetConstSSBO(ssbo);
-        if (!SSBO.pBufferView)
-            return;
-
-        const BufferViewGLImpl* pBufferViewGL = SSBO.pBufferView.ConstPtr();
-        const BufferViewDesc&   ViewDesc      = pBufferViewGL->GetDesc();
-        VERIFY(ViewDesc.ViewType == BUFFER_VIEW_UNORDERED_ACCESS || ViewDesc.ViewType == BUFFER_VIEW_SHADER_RESOURCE, "Unexpected buffer view type");
-
-        BufferGLImpl* pBufferGL = pBufferViewGL->GetBuffer<BufferGLImpl>();
-        pBufferGL->BufferMemoryBarrier(
-            MEMORY_BARRIER_STORAGE_BUFFER, // Accesses to shader storage blocks after the barrier
-                                           // will reflect writes prior to the barrier
-            GLState);
-
-        GLState.BindStorageBlock(binding,
-                                 pBufferGL->GetGLHandle(),
-                                 StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
-                                 StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
-
-        if (ViewDesc.ViewType == BUFFER_VIEW_UNORDERED_ACCESS)
-            WritableBuffers.push_back(pBufferGL);
+        BindingBatch<StorageBlockBinding> SSBOs;
+        for (Uint32 ssbo = 0, binding = BaseBindings[BINDING_RANGE_STORAGE_BUFFER]; ssbo < GetSSBOCount(); ++ssbo, ++binding)
+        {
+            const CachedSSBO& SSBO = GetConstSSBO(ssbo);
+            if (!SSBO.pBufferView)
+                break;
+
+            const BufferViewGLImpl* pBufferViewGL = SSBO.pBufferView.ConstPtr();
+            const BufferViewDesc&   ViewDesc      = pBufferViewGL->GetDesc();
+            VERIFY(ViewDesc.ViewType == BUFFER_VIEW_UNORDERED_ACCESS || ViewDesc.ViewType == BUFFER_VIEW_SHADER_RESOURCE, "Unexpected buffer view type");
+
+            BufferGLImpl* pBufferGL = pBufferViewGL->GetBuffer<BufferGLImpl>();
+            pBufferGL->BufferMemoryBarrier(
+                MEMORY_BARRIER_STORAGE_BUFFER, // Accesses to shader storage blocks after the barrier
+                                               // will reflect writes prior to the barrier
+                GLState);
+
+            StorageBlockBinding& Binding = SSBOs.Add(GLState, binding);
+            Binding.pBuffer              = &pBufferGL->GetGLHandle();
+            Binding.Offset               = StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset);
+            Binding.Size                 = StaticCast<GLsizeiptr>(ViewDesc.ByteWidth);
+
+            if (ViewDesc.ViewType == BUFFER_VIEW_UNORDERED_ACCESS)
+                WritableBuffers.push_back(pBufferGL);
+        }
+        SSBOs.Flush(GLState);
     }
 #endif
 }
@@ -304,35 +405,45 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
 void ShaderResourceCacheGL::BindDynamicBuffers(GLContextState&              GLState,
                                                const std::array<Uint16, 4>& BaseBindings) const
 {
+    // Adjacent dynamic buffers are committed with a single range call
     const Uint16 BaseUBOBinding = BaseBindings[BINDING_RANGE_UNIFORM_BUFFER];
-    for (Uint64 DynamicUBOMask = m_DynamicUBOMask; DynamicUBOMask != 0;)
     {
-        const Uint64    UBOBit = ExtractLSB(DynamicUBOMask);
-        const Uint32    UBOIdx = PlatformMisc::GetLSB(UBOBit);
-        const CachedUB& UB     = GetConstUB(UBOIdx);
-        VERIFY_EXPR(UB.IsDynamic());
-        GLState.BindUniformBuffer(BaseUBOBinding + UBOIdx, UB.pBuffer->GetGLHandle(),
-                                  static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset),
-                                  UB.RangeSize);
+        BindingBatch<UniformBufferBinding> UBs;
+        for (Uint64 DynamicUBOMask = m_DynamicUBOMask; DynamicUBOMask != 0;)
+        {
+            const Uint64    UBOBit = ExtractLSB(DynamicUBOMask);
+            const Uint32    UBOIdx = PlatformMisc::GetLSB(UBOBit);
+            const CachedUB& UB     = GetConstUB(UBOIdx);
+            VERIFY_EXPR(UB.IsDynamic());
+
+            UniformBufferBinding& Binding = UBs.Add(GLState, BaseUBOBinding + UBOIdx);
+            Binding.pBuffer             = &UB.GetGLBinding(Binding.Offset);
+            Binding.Size                = UB.RangeSize;
+        }
+        UBs.Flush(GLState);
     }
 
 
     const Uint16 BaseSSBOBinding = BaseBindings[BINDING_RANGE_STORAGE_BUFFER];
-    for (Uint64 DynamicSSBOMask = m_DynamicSSBOMask; DynamicSSBOMask != 0;)
     {
-        const Uint64      SSBOBit = ExtractLSB(DynamicSSBOMask);
-        const Uint32      SSBOIdx = PlatformMisc::GetLSB(SSBOBit);
-        const CachedSSBO& SSBO    = GetConstSSBO(SSBOIdx);
-        VERIFY_EXPR(SSBO.IsDynamic());
-
-        const BufferViewGLImpl* pBufferViewGL = SSBO.pBufferView.ConstPtr<BufferViewGLImpl>();
-        const BufferGLImpl*     pBufferGL     = pBufferViewGL->GetBuffer<const BufferGLImpl>();
-        const BufferViewDesc&   ViewDesc      = pBufferViewGL->GetDesc();
-
-        GLState.BindStorageBlock(BaseSSBOBinding + SSBOIdx,
-                                 pBufferGL->GetGLHandle(),
-                                 StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
-                                 StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
+        BindingBatch<StorageBlockBinding> SSBOs;
+        for (Uint64 DynamicSSBOMask = m_DynamicSSBOMask; DynamicSSBOMask != 0;)
+        {
+            const Uint64      SSBOBit = ExtractLSB(DynamicSSBOMask);
+            const Uint32      SSBOIdx = PlatformMisc::GetLSB(SSBOBit);
+            const CachedSSBO& SSBO    = GetConstSSBO(SSBOIdx);
+            VERIFY_EXPR(SSBO.IsDynamic());
+
+            const BufferViewGLImpl* pBufferViewGL = SSBO.pBufferView.ConstPtr<BufferViewGLImpl>();
+            const BufferGLImpl*     pBufferGL     = pBufferViewGL->GetBuffer<const BufferGLImpl>();
+            const BufferViewDesc&   ViewDesc      = pBufferViewGL->GetDesc();
+
+            StorageBlockBinding& Binding = SSBOs.Add(GLState, BaseSSBOBinding + SSBOIdx);
+            Binding.pBuffer              = &pBufferGL->GetGLHandle();
+            Binding.Offset               = StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset);
+            Binding.Size                 = StaticCast<GLsizeiptr>(ViewDesc.ByteWidth);
+        }
+        SSBOs.Flush(GLState);
     }
 }
 
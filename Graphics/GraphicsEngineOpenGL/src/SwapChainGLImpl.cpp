@@ -115,14 +115,12 @@ IMPLEMENT_QUERY_INTERFACE(SwapChainGLImpl, IID_SwapChainGL, TSwapChainGLBase)
 
 void SwapChainGLImpl::Present(Uint32 SyncInterval)
 {
-#if PLATFORM_WIN32 || PLATFORM_LINUX || PLATFORM_ANDROID
+#if PLATFORM_WIN32 || PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_WEB
     RenderDeviceGLImpl* pDeviceGL = m_pRenderDevice.RawPtr<RenderDeviceGLImpl>();
     auto&               GLContext = pDeviceGL->m_GLContext;
     GLContext.SwapBuffers(static_cast<int>(SyncInterval));
 #elif PLATFORM_MACOS
     LOG_ERROR("Swap buffers operation must be performed by the app on MacOS");
-#elif PLATFORM_WEB
-    LOG_INFO_MESSAGE_ONCE("Swap buffers operation should be performed by the app on the Web");
 #else
 #    error Unsupported platform
 #endif
@@ -499,9 +499,7 @@ void TextureBaseGL::CreateViewInternal(const TextureViewDesc& OrigViewDesc, ITex
 
                     if (FmtInfo.Supported)
                     {
-                        RefCntAutoPtr<DeviceContextGLImpl> pDeviceContext = pDeviceGLImpl->GetImmediateContext(0);
-                        VERIFY(pDeviceContext, "Immediate device context has been destroyed");
-                        GLContextState& GLState = pDeviceContext->GetContextState();
+                        GLContextState& GLState = pDeviceGLImpl->GetCurrentContextState();
 
                         GLState.BindTexture(-1, GLViewTarget, pViewOGL->GetHandle());
                         glTexParameteri(GLViewTarget, GL_DEPTH_STENCIL_TEXTURE_MODE, GL_STENCIL_INDEX);
@@ -517,9 +515,7 @@ void TextureBaseGL::CreateViewInternal(const TextureViewDesc& OrigViewDesc, ITex
 
                 if (!IsIdentityComponentMapping(ViewDesc.Swizzle))
                 {
-                    RefCntAutoPtr<DeviceContextGLImpl> pDeviceContext = pDeviceGLImpl->GetImmediateContext(0);
-                    VERIFY(pDeviceContext, "Immediate device context has been destroyed");
-                    GLContextState& GLState = pDeviceContext->GetContextState();
+                    GLContextState& GLState = pDeviceGLImpl->GetCurrentContextState();
 
                     GLState.BindTexture(-1, GLViewTarget, pViewOGL->GetHandle());
                     glTexParameteri(GLViewTarget, GL_TEXTURE_SWIZZLE_R, TextureComponentSwizzleToGLTextureSwizzle(ViewDesc.Swizzle.R, GL_RED));
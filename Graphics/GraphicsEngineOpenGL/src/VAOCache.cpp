@@ -54,6 +54,8 @@ VAOCache::VAOCache() :
 
 VAOCache::~VAOCache()
 {
+    PurgeStaleEntries();
+
     VERIFY(m_Cache.empty(), "VAO cache is not empty. Are there any unreleased objects?");
     VERIFY(m_PSOToKey.empty(), "PSOToKey hash is not empty");
     VERIFY(m_BuffToKey.empty(), "BuffToKey hash is not empty");
@@ -61,43 +63,117 @@ VAOCache::~VAOCache()
 
 void VAOCache::OnDestroyBuffer(const BufferGLImpl& Buffer)
 {
-    // Collect all stale keys that use this buffer.
-    std::vector<VAOHashKey> StaleKeys;
+    // The buffer may be destroyed by any thread, so only record its ID.
+    // Unique IDs are never reused, so stale VAOs can't be found by new keys.
+    Threading::SpinLockGuard StaleIdsGuard{m_StaleIdsLock};
+    m_StaleBufferIds.push_back(Buffer.GetUniqueID());
+}
 
+void VAOCache::OnDestroyPSO(const PipelineStateGLImpl& PSO)
+{
+    Threading::SpinLockGuard StaleIdsGuard{m_StaleIdsLock};
+    m_StalePSOIds.push_back(PSO.GetUniqueID());
+}
+
+void VAOCache::Clear()
+{
     Threading::SpinLockGuard CacheGuard{m_CacheLock};
 
-    const auto it = m_BuffToKey.find(Buffer.GetUniqueID());
-    if (it != m_BuffToKey.end())
+    m_Cache.clear();
+    m_LRUList.clear();
+    m_PSOToKey.clear();
+    m_BuffToKey.clear();
+    m_NumAttribBindingEntries = 0;
+
+    Threading::SpinLockGuard StaleIdsGuard{m_StaleIdsLock};
+    m_StaleBufferIds.clear();
+    m_StalePSOIds.clear();
+}
+
+void VAOCache::EraseEntry(CacheType::iterator It)
+{
+    VERIFY_EXPR(It != m_Cache.end());
+    if (It->second.UsesAttribBinding)
     {
-        for (const VAOHashKey& Key : it->second)
-        {
-            StaleKeys.push_back(Key);
-            m_Cache.erase(Key);
-        }
-        m_BuffToKey.erase(it);
+        VERIFY_EXPR(m_NumAttribBindingEntries > 0);
+        --m_NumAttribBindingEntries;
     }
-
-    // Clear stale entries in m_PSOToKey and m_BuffToKey that refer to dead VAOs
-    // to avoid memory leaks.
-    ClearStaleKeys(StaleKeys);
+    m_LRUList.erase(It->second.LRUIt);
+    m_Cache.erase(It);
 }
 
-void VAOCache::OnDestroyPSO(const PipelineStateGLImpl& PSO)
+void VAOCache::PurgeStaleEntries()
 {
-    // Collect all stale keys that use this PSO.
+    std::vector<UniqueIdentifier> StaleBufferIds;
+    std::vector<UniqueIdentifier> StalePSOIds;
+    {
+        Threading::SpinLockGuard StaleIdsGuard{m_StaleIdsLock};
+        if (m_StaleBufferIds.empty() && m_StalePSOIds.empty())
+            return;
+        StaleBufferIds.swap(m_StaleBufferIds);
+        StalePSOIds.swap(m_StalePSOIds);
+    }
+
+    // Collect all stale keys that use the destroyed objects.
     std::vector<VAOHashKey> StaleKeys;
 
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    auto EraseKeys = [&](const std::vector<UniqueIdentifier>&                           Ids,
+                         std::unordered_map<UniqueIdentifier, std::vector<VAOHashKey>>& IdToKey) //
+    {
+        for (const UniqueIdentifier Id : Ids)
+        {
+            const auto it = IdToKey.find(Id);
+            if (it == IdToKey.end())
+                continue;
 
-    const auto it = m_PSOToKey.find(PSO.GetUniqueID());
-    if (it != m_PSOToKey.end())
+            for (const VAOHashKey& Key : it->second)
+            {
+                const auto cache_it = m_Cache.find(Key);
+                if (cache_it != m_Cache.end())
+                {
+                    StaleKeys.push_back(Key);
+                    EraseEntry(cache_it);
+                }
+            }
+            IdToKey.erase(it);
+        }
+    };
+    EraseKeys(StaleBufferIds, m_BuffToKey);
+    EraseKeys(StalePSOIds, m_PSOToKey);
+
+    if (m_NumAttribBindingEntries > 0 && !StaleBufferIds.empty())
     {
-        for (const VAOHashKey& Key : it->second)
+        // VAOs that use vertex attrib bindings are not tracked in m_BuffToKey as their buffers change
+        // all the time. Release the VAOs that still reference destroyed buffers, so that they don't keep
+        // the buffer storage alive.
+        const std::unordered_set<UniqueIdentifier> StaleBufferIdSet{StaleBufferIds.begin(), StaleBufferIds.end()};
+        for (auto it = m_Cache.begin(); it != m_Cache.end();)
         {
-            StaleKeys.push_back(Key);
-            m_Cache.erase(Key);
+            const CacheEntry& Entry = it->second;
+
+            bool IsStale = false;
+            if (Entry.UsesAttribBinding)
+            {
+                IsStale = StaleBufferIdSet.find(Entry.BoundIndexBufferUId) != StaleBufferIdSet.end();
+                for (Uint32 Slot = 0; Slot < MAX_BUFFER_SLOTS && !IsStale; ++Slot)
+                {
+                    const UniqueIdentifier BufferUId = Entry.BoundStreams[Slot].BufferUId;
+                    IsStale = BufferUId > 0 && StaleBufferIdSet.find(BufferUId) != StaleBufferIdSet.end();
+                }
+            }
+
+            if (IsStale)
+            {
+                StaleKeys.push_back(it->first);
+                auto next_it = std::next(it);
+                EraseEntry(it);
+                it = next_it;
+            }
+            else
+            {
+                ++it;
+            }
         }
-        m_PSOToKey.erase(it);
     }
 
     // Clear stale entries in m_PSOToKey and m_BuffToKey that refer to dead VAOs
@@ -105,13 +181,21 @@ void VAOCache::OnDestroyPSO(const PipelineStateGLImpl& PSO)
     ClearStaleKeys(StaleKeys);
 }
 
-void VAOCache::Clear()
+void VAOCache::EvictEntries()
 {
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    if (m_Cache.size() < MaxCacheSize)
+        return;
 
-    m_Cache.clear();
-    m_PSOToKey.clear();
-    m_BuffToKey.clear();
+    std::vector<VAOHashKey> StaleKeys;
+    while (m_Cache.size() >= MaxCacheSize)
+    {
+        VERIFY_EXPR(!m_LRUList.empty());
+        const auto it = m_Cache.find(*m_LRUList.back());
+        VERIFY_EXPR(it != m_Cache.end());
+        StaleKeys.push_back(it->first);
+        EraseEntry(it);
+    }
+    ClearStaleKeys(StaleKeys);
 }
 
 void VAOCache::ClearStaleKeys(const std::vector<VAOHashKey>& StaleKeys)
@@ -167,10 +251,10 @@ void VAOCache::ClearStaleKeys(const std::vector<VAOHashKey>& StaleKeys)
     RemoveStaleEntries(CandidateBuffers, m_BuffToKey);
 }
 
-VAOCache::VAOHashKey::VAOHashKey(const VAOAttribs& Attribs) :
+VAOCache::VAOHashKey::VAOHashKey(const VAOAttribs& Attribs, bool IncludeBuffers) :
     // clang-format off
     PsoUId         {Attribs.PSO.GetUniqueID()},
-    IndexBufferUId {Attribs.pIndexBuffer ? Attribs.pIndexBuffer->GetUniqueID() : 0}
+    IndexBufferUId {IncludeBuffers && Attribs.pIndexBuffer ? Attribs.pIndexBuffer->GetUniqueID() : 0}
 // clang-format on
 {
 #ifdef DILIGENT_DEBUG
@@ -182,7 +266,7 @@ VAOCache::VAOHashKey::VAOHashKey(const VAOAttribs& Attribs) :
     const LayoutElement*   LayoutElements = InputLayout.LayoutElements;
 
     Hash = ComputeHash(PsoUId, IndexBufferUId);
-    for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
+    for (Uint32 i = 0; i < InputLayout.NumElements && IncludeBuffers; ++i)
     {
         const LayoutElement& LayoutElem = LayoutElements[i];
         const Uint32         BufferSlot = LayoutElem.BufferSlot;
@@ -239,14 +323,167 @@ bool VAOCache::VAOHashKey::operator==(const VAOHashKey& Key) const noexcept
     return true;
 }
 
+static bool IsIntegerAttrib(const LayoutElement& LayoutElem)
+{
+    return (!LayoutElem.IsNormalized &&
+            (LayoutElem.ValueType == VT_INT8 ||
+             LayoutElem.ValueType == VT_INT16 ||
+             LayoutElem.ValueType == VT_INT32 ||
+             LayoutElem.ValueType == VT_UINT8 ||
+             LayoutElem.ValueType == VT_UINT16 ||
+             LayoutElem.ValueType == VT_UINT32));
+}
+
+static bool CanUseAttribBinding(const VAOCache::VAOAttribs& Attribs, GLContextState& GLState)
+{
+    if (!GLState.GetContextCaps().IsVertexAttribBindingSupported)
+        return false;
+
+    // glVertexAttribFormat only accepts relative offsets up to GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET,
+    // which is at least 2047.
+    constexpr Uint32 MinMaxRelativeOffset = 2047;
+
+    const InputLayoutDesc& InputLayout = Attribs.PSO.GetGraphicsPipelineDesc().InputLayout;
+    for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
+    {
+        if (InputLayout.LayoutElements[i].RelativeOffset > MinMaxRelativeOffset)
+            return false;
+    }
+    return true;
+}
+
+void VAOCache::CreateVAO(const VAOAttribs& Attribs, GLContextState& GLState, CacheEntry& Entry)
+{
+    // Initialize VAO
+    GLState.BindVAO(Entry.VAO);
+
+    const InputLayoutDesc& InputLayout = Attribs.PSO.GetGraphicsPipelineDesc().InputLayout;
+    const LayoutElement*   LayoutElems = InputLayout.LayoutElements;
+    for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
+    {
+        const LayoutElement& LayoutElem = LayoutElems[i];
+        const Uint32         BuffSlot   = LayoutElem.BufferSlot;
+        const GLenum         GlType     = TypeToGLType(LayoutElem.ValueType);
+
+#if GL_ARB_vertex_attrib_binding
+        if (Entry.UsesAttribBinding)
+        {
+            // The format of the attribute only depends on the PSO. Buffers are bound
+            // to the binding points by BindAttribBindingBuffers().
+            if (IsIntegerAttrib(LayoutElem))
+                glVertexAttribIFormat(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, LayoutElem.RelativeOffset);
+            else
+                glVertexAttribFormat(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, LayoutElem.IsNormalized, LayoutElem.RelativeOffset);
+            glVertexAttribBinding(LayoutElem.InputIndex, BuffSlot);
+
+            if (LayoutElem.Frequency == INPUT_ELEMENT_FREQUENCY_PER_INSTANCE)
+            {
+                // Divisor is a property of the binding point
+                glVertexBindingDivisor(BuffSlot, LayoutElem.InstanceDataStepRate);
+            }
+            glEnableVertexAttribArray(LayoutElem.InputIndex);
+            continue;
+        }
+#endif
+        VERIFY_EXPR(!Entry.UsesAttribBinding);
+        VERIFY_EXPR(BuffSlot < Attribs.NumVertexStreams);
+
+        // Get buffer through the strong reference. Note that we are not
+        // using pointers stored in the key for safety
+        const auto&   CurrStream = Attribs.VertexStreams[BuffSlot];
+        const Uint32  Stride     = Attribs.PSO.GetBufferStride(BuffSlot);
+        BufferGLImpl* pBuffer    = Attribs.VertexStreams[BuffSlot].pBuffer;
+
+        constexpr bool ResetVAO = false;
+        GLState.BindBuffer(GL_ARRAY_BUFFER, pBuffer->m_GlBuffer, ResetVAO);
+        GLvoid* DataStartOffset = reinterpret_cast<GLvoid*>(StaticCast<size_t>(CurrStream.Offset) + static_cast<size_t>(LayoutElem.RelativeOffset));
+
+        if (IsIntegerAttrib(LayoutElem))
+            glVertexAttribIPointer(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, Stride, DataStartOffset);
+        else
+            glVertexAttribPointer(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, LayoutElem.IsNormalized, Stride, DataStartOffset);
+
+        if (LayoutElem.Frequency == INPUT_ELEMENT_FREQUENCY_PER_INSTANCE)
+        {
+            // If divisor is zero, then the attribute acts like normal, being indexed by the array or index
+            // buffer. If divisor is non-zero, then the current instance is divided by this divisor, and
+            // the result of that is used to access the attribute array.
+            glVertexAttribDivisor(LayoutElem.InputIndex, LayoutElem.InstanceDataStepRate);
+        }
+        glEnableVertexAttribArray(LayoutElem.InputIndex);
+    }
+
+    if (!Entry.UsesAttribBinding && Attribs.pIndexBuffer)
+    {
+        constexpr bool ResetVAO = false;
+        GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, Attribs.pIndexBuffer->m_GlBuffer, ResetVAO);
+    }
+}
+
+void VAOCache::BindAttribBindingBuffers(const VAOAttribs& Attribs, GLContextState& GLState, CacheEntry& Entry)
+{
+    VERIFY_EXPR(Entry.UsesAttribBinding);
+    GLState.BindVAO(Entry.VAO);
+
+#if GL_ARB_vertex_attrib_binding
+    const InputLayoutDesc& InputLayout = Attribs.PSO.GetGraphicsPipelineDesc().InputLayout;
+    for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
+    {
+        const Uint32 BuffSlot = InputLayout.LayoutElements[i].BufferSlot;
+        VERIFY_EXPR(BuffSlot < MAX_BUFFER_SLOTS);
+        DEV_CHECK_ERR(BuffSlot < Attribs.NumVertexStreams, "Input layout requires at least ", BuffSlot + 1,
+                      " buffer", (BuffSlot > 0 ? "s" : ""), ", but only ", Attribs.NumVertexStreams, ' ',
+                      (Attribs.NumVertexStreams == 1 ? "is" : "are"), " bound.");
+
+        const auto&   CurrStream = Attribs.VertexStreams[BuffSlot];
+        BufferGLImpl* pBuffer    = CurrStream.pBuffer;
+        DEV_CHECK_ERR(pBuffer, "VAO requires buffer at slot ", BuffSlot, ", but none is bound in the context.");
+        if (pBuffer == nullptr)
+            continue;
+
+        const VAOHashKey::StreamAttribs NewStream{pBuffer->GetUniqueID(), CurrStream.Offset};
+        if (Entry.BoundStreams[BuffSlot] != NewStream)
+        {
+            glBindVertexBuffer(BuffSlot, pBuffer->m_GlBuffer, StaticCast<GLintptr>(CurrStream.Offset), Attribs.PSO.GetBufferStride(BuffSlot));
+            CHECK_GL_ERROR("Failed to bind vertex buffer to slot ", BuffSlot);
+            Entry.BoundStreams[BuffSlot] = NewStream;
+        }
+    }
+#endif
+
+    const UniqueIdentifier IndexBufferUId = Attribs.pIndexBuffer ? Attribs.pIndexBuffer->GetUniqueID() : 0;
+    if (Attribs.pIndexBuffer && Entry.BoundIndexBufferUId != IndexBufferUId)
+    {
+        // Element array buffer binding is part of the VAO state
+        constexpr bool ResetVAO = false;
+        GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, Attribs.pIndexBuffer->m_GlBuffer, ResetVAO);
+        Entry.BoundIndexBufferUId = IndexBufferUId;
+    }
+}
+
 const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Attribs,
                                                            GLContextState&   GLState)
 {
     // Lock the cache
     Threading::SpinLockGuard CacheGuard{m_CacheLock};
 
+    PurgeStaleEntries();
+
+    const bool UseAttribBinding = CanUseAttribBinding(Attribs, GLState);
+
     // Construct the key
-    VAOHashKey Key{Attribs};
+    VAOHashKey Key{Attribs, !UseAttribBinding};
+
+    if (UseAttribBinding)
+    {
+        const InputLayoutDesc& InputLayout = Attribs.PSO.GetGraphicsPipelineDesc().InputLayout;
+        for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
+        {
+            const Uint32 Slot = InputLayout.LayoutElements[i].BufferSlot;
+            if (Slot < Attribs.NumVertexStreams && Attribs.VertexStreams[Slot].pBuffer)
+                Attribs.VertexStreams[Slot].pBuffer->BufferMemoryBarrier(MEMORY_BARRIER_VERTEX_BUFFER, GLState);
+        }
+    }
 
     for (Uint32 SlotMask = Key.UsedSlotsMask; SlotMask != 0;)
     {
@@ -279,70 +516,32 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Att
     auto It = m_Cache.find(Key);
     if (It != m_Cache.end())
     {
-        return It->second;
+        // Move the entry to the front of the LRU list
+        m_LRUList.splice(m_LRUList.begin(), m_LRUList, It->second.LRUIt);
     }
     else
     {
-        // Create a new VAO
-        GLObjectWrappers::GLVertexArrayObj NewVAO{true};
+        EvictEntries();
 
-        // Initialize VAO
-        GLState.BindVAO(NewVAO);
+        auto NewElems = m_Cache.emplace(Key, CacheEntry{});
+        // New element must be actually inserted
+        VERIFY(NewElems.second, "New element was not inserted into the cache");
+        It = NewElems.first;
 
-        const InputLayoutDesc& InputLayout = Attribs.PSO.GetGraphicsPipelineDesc().InputLayout;
-        const LayoutElement*   LayoutElems = InputLayout.LayoutElements;
-        for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
-        {
-            const LayoutElement& LayoutElem = LayoutElems[i];
-            const Uint32         BuffSlot   = LayoutElem.BufferSlot;
-            VERIFY_EXPR(BuffSlot < Attribs.NumVertexStreams);
-
-            // Get buffer through the strong reference. Note that we are not
-            // using pointers stored in the key for safety
-            const auto&   CurrStream = Attribs.VertexStreams[BuffSlot];
-            const Uint32  Stride     = Attribs.PSO.GetBufferStride(BuffSlot);
-            BufferGLImpl* pBuffer    = Attribs.VertexStreams[BuffSlot].pBuffer;
-
-            constexpr bool ResetVAO = false;
-            GLState.BindBuffer(GL_ARRAY_BUFFER, pBuffer->m_GlBuffer, ResetVAO);
-            GLvoid* DataStartOffset = reinterpret_cast<GLvoid*>(StaticCast<size_t>(CurrStream.Offset) + static_cast<size_t>(LayoutElem.RelativeOffset));
-
-            const GLenum GlType = TypeToGLType(LayoutElem.ValueType);
-            if (!LayoutElem.IsNormalized &&
-                (LayoutElem.ValueType == VT_INT8 ||
-                 LayoutElem.ValueType == VT_INT16 ||
-                 LayoutElem.ValueType == VT_INT32 ||
-                 LayoutElem.ValueType == VT_UINT8 ||
-                 LayoutElem.ValueType == VT_UINT16 ||
-                 LayoutElem.ValueType == VT_UINT32))
-                glVertexAttribIPointer(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, Stride, DataStartOffset);
-            else
-                glVertexAttribPointer(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, LayoutElem.IsNormalized, Stride, DataStartOffset);
+        CacheEntry& Entry       = It->second;
+        Entry.UsesAttribBinding = UseAttribBinding;
+        Entry.LRUIt             = m_LRUList.insert(m_LRUList.begin(), &It->first);
+        if (UseAttribBinding)
+            ++m_NumAttribBindingEntries;
 
-            if (LayoutElem.Frequency == INPUT_ELEMENT_FREQUENCY_PER_INSTANCE)
-            {
-                // If divisor is zero, then the attribute acts like normal, being indexed by the array or index
-                // buffer. If divisor is non-zero, then the current instance is divided by this divisor, and
-                // the result of that is used to access the attribute array.
-                glVertexAttribDivisor(LayoutElem.InputIndex, LayoutElem.InstanceDataStepRate);
-            }
-            glEnableVertexAttribArray(LayoutElem.InputIndex);
-        }
-        if (Attribs.pIndexBuffer)
-        {
-            constexpr bool ResetVAO = false;
-            GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, Attribs.pIndexBuffer->m_GlBuffer, ResetVAO);
-        }
+        CreateVAO(Attribs, GLState, Entry);
 
-        auto NewElems = m_Cache.emplace(std::make_pair(Key, std::move(NewVAO)));
-        // New element must be actually inserted
-        VERIFY(NewElems.second, "New element was not inserted into the cache");
         VERIFY_EXPR(Key.PsoUId == Attribs.PSO.GetUniqueID());
         m_PSOToKey[Key.PsoUId].push_back(Key);
 
-        if (Attribs.pIndexBuffer)
+        if (Key.IndexBufferUId != 0)
         {
-            VERIFY_EXPR(Key.IndexBufferUId == Attribs.pIndexBuffer->GetUniqueID());
+            VERIFY_EXPR(Attribs.pIndexBuffer != nullptr && Key.IndexBufferUId == Attribs.pIndexBuffer->GetUniqueID());
             m_BuffToKey[Key.IndexBufferUId].push_back(Key);
         }
 
@@ -361,8 +560,12 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Att
 
             m_BuffToKey[Key.Streams[Slot].BufferUId].push_back(Key);
         }
-        return NewElems.first->second;
     }
+
+    if (It->second.UsesAttribBinding)
+        BindAttribBindingBuffers(Attribs, GLState, It->second);
+
+    return It->second.VAO;
 }
 
 const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetEmptyVAO()
@@ -60,6 +60,13 @@ public:
                  const BufferDesc&          BuffDesc,
                  RESOURCE_STATE             InitialState,
                  VkBuffer                   vkBuffer);
+
+    BufferVkImpl(IReferenceCounters*        pRefCounters,
+                 FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                 RenderDeviceVkImpl*        pDeviceVk,
+                 const BufferDesc&          BuffDesc,
+                 IDeviceMemory*             pMemory,
+                 Uint64                     MemoryOffset);
     ~BufferVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_BufferVk, TBufferBase)
@@ -90,6 +97,9 @@ public:
     /// Implementation of IBuffer::GetSparseProperties().
     virtual SparseBufferProperties DILIGENT_CALL_TYPE GetSparseProperties() const override final;
 
+    /// Implementation of IBufferVk::ExportMemoryHandle().
+    virtual Bool DILIGENT_CALL_TYPE ExportMemoryHandle(Uint64& Handle, Uint64& MemorySize) const override final;
+
     bool CheckAccessFlags(VkAccessFlags AccessFlags) const
     {
         return (GetAccessFlags() & AccessFlags) == AccessFlags;
@@ -101,9 +111,16 @@ public:
         return reinterpret_cast<Uint8*>(m_MemoryAllocation.Page->GetCPUMemory()) + m_BufferMemoryAlignedOffset;
     }
 
+    static ResourceMemoryRequirements GetPlacedMemoryRequirements(const BufferDesc& BuffDesc, const RenderDeviceVkImpl* pDevice);
+
 private:
     friend class DeviceContextVkImpl;
 
+    static VkBufferCreateInfo GetVkBufferCreateInfo(const BufferDesc&         BuffDesc,
+                                                    const RenderDeviceVkImpl* pDevice,
+                                                    Uint32&                   DynamicOffsetAlignment,
+                                                    bool&                     RequiresBackingBuffer);
+
     virtual void CreateViewInternal(const struct BufferViewDesc& ViewDesc, IBufferView** ppView, bool bIsDefaultView) override;
 
     VulkanUtilities::BufferViewWrapper CreateView(struct BufferViewDesc& ViewDesc);
@@ -113,6 +130,12 @@ private:
 
     VulkanUtilities::BufferWrapper    m_VulkanBuffer;
     VulkanUtilities::MemoryAllocation m_MemoryAllocation;
+
+    // Dedicated memory of exportable buffers (see MISC_BUFFER_FLAG_EXPORTABLE)
+    VulkanUtilities::DeviceMemoryWrapper m_DedicatedMemory;
+
+    // Device memory the placed buffer is bound to
+    RefCntAutoPtr<IDeviceMemory> m_pPlacedMemory;
 };
 
 } // namespace Diligent
@@ -34,6 +34,11 @@
 #include "VulkanUtilities/VulkanHeaders.h"
 #include "CommandListBase.hpp"
 
+namespace VulkanUtilities
+{
+class CommandBufferPool;
+}
+
 namespace Diligent
 {
 
@@ -43,33 +48,63 @@ class CommandListVkImpl final : public CommandListBase<EngineVkImplTraits>
 public:
     using TCommandListBase = CommandListBase<EngineVkImplTraits>;
 
-    CommandListVkImpl(IReferenceCounters*  pRefCounters,
-                      RenderDeviceVkImpl*  pDevice,
-                      DeviceContextVkImpl* pDeferredCtx,
-                      VkCommandBuffer      vkCmdBuff) :
+    CommandListVkImpl(IReferenceCounters*                 pRefCounters,
+                      RenderDeviceVkImpl*                 pDevice,
+                      DeviceContextVkImpl*                pDeferredCtx,
+                      VkCommandBuffer                     vkCmdBuff,
+                      VulkanUtilities::CommandBufferPool* pCmdPool,
+                      SoftwareQueueIndex                  CmdQueueId) :
         // clang-format off
         TCommandListBase {pRefCounters, pDevice, pDeferredCtx},
         m_pDeferredCtx   {pDeferredCtx},
-        m_vkCmdBuff      {vkCmdBuff   }
+        m_vkCmdBuff      {vkCmdBuff   },
+        m_pCmdPool       {pCmdPool    },
+        m_CmdQueueId     {CmdQueueId  }
     // clang-format on
     {
     }
 
-    ~CommandListVkImpl()
-    {
-        VERIFY(m_vkCmdBuff == VK_NULL_HANDLE && !m_pDeferredCtx, "Destroying command list that was never executed");
-    }
+    ~CommandListVkImpl();
 
-    void Close(RefCntAutoPtr<IDeviceContext>& outDeferredCtx, VkCommandBuffer& outVkCmdBuff)
+    void Close(RefCntAutoPtr<IDeviceContext>&       outDeferredCtx,
+               VkCommandBuffer&                     outVkCmdBuff,
+               VulkanUtilities::CommandBufferPool*& outCmdPool)
     {
+        VERIFY(!IsReusable(), "Reusable command lists must not be closed");
         outVkCmdBuff   = m_vkCmdBuff;
         outDeferredCtx = std::move(m_pDeferredCtx);
+        outCmdPool     = m_pCmdPool;
         m_vkCmdBuff    = VK_NULL_HANDLE;
+        m_pCmdPool     = nullptr;
+    }
+
+    // Reusable command lists keep the ownership of the command buffer and
+    // the deferred context until they are destroyed.
+    VkCommandBuffer GetVkCmdBuffer() const { return m_vkCmdBuff; }
+
+    IDeviceContext* GetDeferredContext() const { return m_pDeferredCtx; }
+
+    SoftwareQueueIndex GetCommandQueueId() const { return m_CmdQueueId; }
+
+    void SetLastSubmittedFenceValue(Uint64 FenceValue)
+    {
+        VERIFY_EXPR(IsReusable());
+        m_LastSubmittedFenceValue = FenceValue;
     }
 
 private:
     RefCntAutoPtr<IDeviceContext> m_pDeferredCtx;
     VkCommandBuffer               m_vkCmdBuff;
+
+    // The pool the command buffer was allocated from. The command buffer
+    // must be returned to this pool after it has been executed.
+    VulkanUtilities::CommandBufferPool* m_pCmdPool;
+
+    // The queue the command list is executed in
+    const SoftwareQueueIndex m_CmdQueueId;
+
+    // The fence value of the last submission of a reusable command list
+    Uint64 m_LastSubmittedFenceValue = 0;
 };
 
 } // namespace Diligent
@@ -145,10 +145,12 @@ public:
     void SetFence(RefCntAutoPtr<FenceVkImpl> pFence)
     {
         VERIFY_EXPR(pFence->GetDesc().Type == FENCE_TYPE_CPU_WAIT_ONLY);
-        VERIFY_EXPR(!pFence->IsTimelineSemaphore());
+        VERIFY_EXPR(pFence->IsTimelineSemaphore() == m_SupportedTimelineSemaphore);
         m_pFence = std::move(pFence);
     }
 
+    // Returns the sync point of the last submission.
+    // When timeline semaphores are supported, sync points are not used and null is returned.
     SyncPointVkPtr GetLastSyncPoint()
     {
         Threading::SpinLockGuard Guard{m_LastSyncPointLock};
@@ -160,6 +162,10 @@ private:
 
     void InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore, Uint64 Value);
 
+    // Adds the signal operation of the fence timeline semaphore to the submit or bind sparse info.
+    template <typename SubmitInfoType>
+    void AppendFenceSignal(SubmitInfoType& Info, VkTimelineSemaphoreSubmitInfo& TimelineInfo, Uint64 FenceValue);
+
     std::shared_ptr<VulkanUtilities::LogicalDevice> m_LogicalDevice;
 
     const VkQueue            m_VkQueue;
@@ -171,7 +177,9 @@ private:
     // Fence is signaled right after a command buffer has been
     // submitted to the command queue for execution.
     // All command buffers with fence value less than or equal to the signaled value
-    // are guaranteed to be finished by the GPU
+    // are guaranteed to be finished by the GPU.
+    // When timeline semaphores are supported, the fence is a timeline semaphore that is
+    // signaled by every submission. Otherwise, every submission signals the VkFence of a new sync point.
     RefCntAutoPtr<FenceVkImpl> m_pFence;
 
     // A value that will be signaled by the command queue next
@@ -182,6 +190,8 @@ private:
 
     // Array used to merge semaphores from SubmitInfo and from SyncPointVk
     std::vector<VkSemaphore> m_TempSignalSemaphores;
+    // Timeline semaphore signal values that correspond to m_TempSignalSemaphores
+    std::vector<uint64_t> m_TempSignalValues;
 
     // Protects access to the m_LastSyncPoint
     Threading::SpinLock m_LastSyncPointLock;
@@ -43,6 +43,7 @@
 #include "QueryVkImpl.hpp"
 #include "FramebufferVkImpl.hpp"
 #include "RenderPassVkImpl.hpp"
+#include "RenderPassCache.hpp"
 #include "BottomLevelASVkImpl.hpp"
 #include "TopLevelASVkImpl.hpp"
 #include "ShaderBindingTableVkImpl.hpp"
@@ -79,7 +80,7 @@ public:
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DeviceContextVk, TDeviceContextBase)
 
     /// Implementation of IDeviceContext::Begin() in Vulkan backend.
-    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::SetPipelineState() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
@@ -97,6 +98,17 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetCullMode() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode) override final;
+
+    /// Implementation of IDeviceContext::SetDepthState() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetDepthState(Bool                DepthEnable,
+                                                  Bool                DepthWriteEnable,
+                                                  COMPARISON_FUNCTION DepthFunc) override final;
+
+    /// Implementation of IDeviceContext::SetPrimitiveTopology() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -146,6 +158,8 @@ public:
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::ExecuteIndirectCommands() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawMesh() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawMesh           (const DrawMeshAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawMeshIndirect() in Vulkan backend.
@@ -176,6 +190,9 @@ public:
                                                       const void*                    RGBA,
                                                       RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateRenderTargets() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                                  Uint64                         Offset,
@@ -247,6 +264,15 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::BeginPoolQuery() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::EndPoolQuery() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::ResolvePoolQueries() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs) override final;
+
     /// Implementation of IDeviceContext::Flush() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -297,11 +323,14 @@ public:
     // Transitions texture subresources from OldState to NewState, and optionally updates
     // internal texture state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal texture state is used as old state.
+    // If vkWaitEvent is not null, the transition is performed when the event is signaled
+    // (end of a split barrier).
     void TransitionTextureState(TextureVkImpl&           TextureVk,
                                 RESOURCE_STATE           OldState,
                                 RESOURCE_STATE           NewState,
                                 STATE_TRANSITION_FLAGS   Flags,
-                                VkImageSubresourceRange* pSubresRange = nullptr);
+                                VkImageSubresourceRange* pSubresRange = nullptr,
+                                VkEvent                  vkWaitEvent  = VK_NULL_HANDLE);
 
     /// Implementation of IDeviceContextVk::TransitionImageLayout().
     virtual void DILIGENT_CALL_TYPE TransitionImageLayout(ITexture* pTexture, VkImageLayout NewLayout) override final;
@@ -310,10 +339,13 @@ public:
     // Transitions buffer state from OldState to NewState, and optionally updates
     // internal buffer state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal buffer state is used as old state.
+    // If vkWaitEvent is not null, the transition is performed when the event is signaled
+    // (end of a split barrier).
     void TransitionBufferState(BufferVkImpl&  BufferVk,
                                RESOURCE_STATE OldState,
                                RESOURCE_STATE NewState,
-                               bool           UpdateBufferState);
+                               bool           UpdateBufferState,
+                               VkEvent        vkWaitEvent = VK_NULL_HANDLE);
 
     /// Implementation of IDeviceContextVk::BufferMemoryBarrier().
     virtual void DILIGENT_CALL_TYPE BufferMemoryBarrier(IBuffer* pBuffer, VkAccessFlags NewAccessFlags) override final;
@@ -359,6 +391,8 @@ public:
                             Uint64                         SrcOffset,
                             RESOURCE_STATE_TRANSITION_MODE TransitionMode);
 
+    void FlushPendingBufferUpdates();
+
     void CopyTextureRegion(TextureVkImpl*                 pSrcTexture,
                            RESOURCE_STATE_TRANSITION_MODE SrcTextureTransitionMode,
                            TextureVkImpl*                 pDstTexture,
@@ -374,7 +408,7 @@ public:
                              const Box&                     DstBox,
                              RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode);
 
-    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView) override final;
+    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags) override final;
 
     size_t GetNumCommandsInCtx() const { return m_State.NumCommands; }
 
@@ -395,13 +429,19 @@ public:
 
     VkDescriptorSet AllocateDynamicDescriptorSet(VkDescriptorSetLayout SetLayout, const char* DebugName = "")
     {
+        DEV_CHECK_ERR((m_CommandListFlags & COMMAND_LIST_FLAG_REUSABLE) == 0,
+                      "Shader resource bindings with dynamic variables are not allowed in reusable command lists.");
         // Descriptor pools are externally synchronized, meaning that the application must not allocate
         // and/or free descriptor sets from the same pool in multiple threads simultaneously (13.2.3)
+        ++m_Stats.DescriptorAllocations;
         return m_DynamicDescrSetAllocator.Allocate(SetLayout, DebugName);
     }
 
     VulkanDynamicAllocation AllocateDynamicSpace(Uint64 SizeInBytes, Uint32 Alignment);
 
+    // Returns the command buffer to the pool once the GPU has reached FenceValue in the given queue.
+    void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, VulkanUtilities::CommandBufferPool& Pool, Uint64 FenceValue);
+
     virtual void ResetRenderTargets() override final;
 
     QueryManagerVk* GetQueryManager() { return m_pQueryMgr; }
@@ -413,12 +453,23 @@ public:
 #endif
 
 private:
+    // Signals an event that the matching end-split barrier will wait for.
+    // Barriers for which split barriers are not supported are ignored, and the
+    // transition is performed by the end-split barrier.
+    void BeginSplitBarrier(const StateTransitionDesc& Barrier);
+
     void               TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
     __forceinline void CommitRenderPassAndFramebuffer(bool VerifyStates);
+    bool               CanUseImplicitLoadOps() const;
+    void               PrepareDeferredAttachmentClear(RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
+    void               CommitPendingLoadOps();
+    void               BeginRenderPassWithPendingLoadOps();
     __forceinline void EndRenderScope();
     void               CommitVkVertexBuffers();
     void               CommitViewports();
     void               CommitScissorRects();
+    void               CommitExtendedDynamicStates();
+    void               CommitShaderObjectStates();
 
     void Flush(Uint32               NumCommandLists,
                ICommandList* const* ppCommandLists);
@@ -447,7 +498,10 @@ private:
 
     void AliasingBarrier(IDeviceObject* pResourceBefore, IDeviceObject* pResourceAfter);
 
-    __forceinline void EnsureVkCmdBuffer()
+    // Commands that only set the pipeline state keep pending implicit render pass load operations.
+    // All other commands begin the render pass first, so that the pending clears are performed
+    // before the command and the pending discards are not applied to the contents it writes.
+    __forceinline void EnsureVkCmdBuffer(bool KeepPendingLoadOps = false)
     {
         VERIFY_EXPR(m_CmdPool != nullptr);
 
@@ -456,12 +510,23 @@ private:
         m_State.NumCommands = m_State.NumCommands != 0 ? m_State.NumCommands : 1;
         if (m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE)
         {
-            VkCommandBuffer vkCmdBuff = m_CmdPool->GetCommandBuffer();
+            // Reusable command lists may be submitted again while the previous submission is pending
+            const VkCommandBufferUsageFlags UsageFlags = (m_CommandListFlags & COMMAND_LIST_FLAG_REUSABLE) != 0 ?
+                VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT :
+                VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+            VkCommandBuffer vkCmdBuff = m_CmdPool->GetCommandBuffer("", UsageFlags);
             m_CommandBuffer.SetVkCmdBuffer(vkCmdBuff, m_CmdPool->GetSupportedStagesMask(), m_CmdPool->GetSupportedAccessMask());
         }
+
+        // Any command may use the buffer that has pending updates
+        if (m_PendingBufferUpdates.IsPending())
+            FlushPendingBufferUpdates();
+
+        if (!KeepPendingLoadOps && m_PendingLoadOps.IsPending())
+            CommitPendingLoadOps();
     }
 
-    inline void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue);
     inline void DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue);
 
     void CopyBufferToTexture(VkBuffer                       vkSrcBuffer,
@@ -514,6 +579,10 @@ private:
         /// Current graphics PSO uses no depth/render targets.
         bool NullRenderTargets = false;
 
+        /// Flag indicating if the dynamic heap buffer is bound as the descriptor buffer
+        /// to the current command buffer (see RenderDeviceVkImpl::UseDescriptorBuffers()).
+        bool DescriptorBufferBound = false;
+
         Uint32 NumCommands = 0;
 
         VkPipelineBindPoint vkPipelineBindPoint = VK_PIPELINE_BIND_POINT_MAX_ENUM;
@@ -538,6 +607,20 @@ private:
             // Note that this is not the actual number of dynamic buffers in the resource cache.
             Uint32 DynamicOffsetCount = 0;
 
+            // When descriptor buffers are used, the number of descriptor sets in the committed SRB
+            // and their offsets in the dynamic heap buffer, written by the last CommitDescriptorSets() call.
+            Uint32                                                DescrBufferSetCount = 0;
+            std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE> DescrBufferOffsets  = {};
+
+            // Whether the pipeline layout pushes the dynamic set of this signature,
+            // given by Layout.IsDynamicSetPushed
+            bool PushDynamicSet = false;
+
+            // Whether writing the dynamic set was deferred to CommitDescriptorSets() because
+            // the signature supports push descriptors. The set is then either pushed or,
+            // if the current layout does not push it, allocated and written there.
+            bool DynamicSetDeferred = false;
+
 #ifdef DILIGENT_DEVELOPMENT
             // The descriptor set base index that was used in the last BindDescriptorSets() call
             Uint32 LastBoundBaseInd = ~0u;
@@ -555,6 +638,8 @@ private:
     __forceinline ResourceBindInfo& GetBindInfo(PIPELINE_TYPE Type);
 
     __forceinline void CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    void               CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    VkDescriptorSet    CommitDynamicDescriptorSet(const PipelineResourceSignatureVkImpl& Signature, const ShaderResourceCacheVk& ResourceCache);
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo);
 #endif
@@ -565,6 +650,9 @@ private:
     /// Memory to store dynamic buffer offsets for descriptor sets.
     std::vector<Uint32> m_DynamicBufferOffsets;
 
+    /// Scratch space for descriptor update template data of dynamic descriptor sets.
+    std::vector<ShaderResourceCacheVk::DescriptorUpdateInfo> m_DescriptorUpdateData;
+
     /// Temporary array used by CommitDescriptorSets
     std::array<VkDescriptorSet, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)> m_DescriptorSets = {};
 
@@ -579,6 +667,87 @@ private:
     /// Dynamic rendering info.
     std::unique_ptr<VulkanUtilities::RenderingInfoWrapper> m_DynamicRenderingInfo;
 
+    /// Key of the implicit render pass that matches currently bound render targets.
+    RenderPassCache::RenderPassCacheKey m_RenderPassKey;
+
+    /// Load operations of the implicit render pass inferred from the clears and invalidations
+    /// of the bound attachments issued before the render pass begins.
+    struct PendingLoadOps
+    {
+        Uint32 ClearMask   = 0; // RenderPassCacheKey attachment bits
+        Uint32 DiscardMask = 0;
+
+        // Clear values of the render targets followed by the depth-stencil clear value
+        std::array<VkClearValue, MAX_RENDER_TARGETS + 1> ClearValues = {};
+
+        bool IsPending() const
+        {
+            return ClearMask != 0 || DiscardMask != 0;
+        }
+
+        void Reset()
+        {
+            ClearMask   = 0;
+            DiscardMask = 0;
+        }
+    } m_PendingLoadOps;
+
+    /// Small UpdateBuffer() calls to the same buffer that have not been recorded yet.
+    /// The updates are recorded by a single command before any other command is recorded.
+    struct PendingBufferUpdates
+    {
+        VkBuffer vkDstBuffer = VK_NULL_HANDLE;
+
+        // Source offsets of the regions are offsets in the Data array
+        std::vector<VkBufferCopy> Regions;
+        std::vector<Uint8>        Data;
+
+        bool IsPending() const
+        {
+            return !Regions.empty();
+        }
+
+        bool Overlaps(Uint64 Offset, Uint64 Size) const
+        {
+            for (const VkBufferCopy& Region : Regions)
+            {
+                if (Offset < Region.dstOffset + Region.size && Region.dstOffset < Offset + Size)
+                    return true;
+            }
+            return false;
+        }
+    } m_PendingBufferUpdates;
+
+    // Updates larger than this size are recorded immediately
+    static constexpr Uint64 MaxPendingBufferUpdateSize = 1024;
+    // Bounds the cost of the overlap test
+    static constexpr size_t MaxPendingBufferUpdateRegions = 256;
+
+    /// Implicit render pass and framebuffer recently used with the set of bound views.
+    /// Views are identified by their unique IDs that are never reused, so an entry
+    /// can never match once any of its views has been destroyed.
+    struct RecentFramebufferInfo
+    {
+        std::array<UniqueIdentifier, MAX_RENDER_TARGETS + 2> ViewIDs = {}; // RTVs, DSV, shading rate map
+
+        Uint32 NumRenderTargets = 0;
+        Uint32 Width            = 0;
+        Uint32 Height           = 0;
+        Uint32 Slices           = 0;
+        Uint32 Samples          = 0;
+
+        VkRenderPass  vkRenderPass  = VK_NULL_HANDLE;
+        VkFramebuffer vkFramebuffer = VK_NULL_HANDLE;
+
+        RenderPassCache::RenderPassCacheKey RenderPassKey;
+
+        bool IsSameTargets(const RecentFramebufferInfo& rhs) const;
+    };
+    static constexpr size_t NumRecentFramebuffers = 4;
+
+    std::array<RecentFramebufferInfo, NumRecentFramebuffers> m_RecentFramebuffers;
+    Uint32                                                   m_NextRecentFramebuffer = 0;
+
     FixedBlockMemoryAllocator m_CmdListAllocator;
 
     // Semaphores are not owned by the command context
@@ -639,6 +808,10 @@ private:
     std::unique_ptr<std::unique_ptr<VulkanUtilities::CommandBufferPool>[]> m_QueueFamilyCmdPools;
     // Command pool for the family for which we are recording commands
     VulkanUtilities::CommandBufferPool* m_CmdPool = nullptr;
+    // Deferred context pools used in the previous frames. Every pool is reset and reused
+    // once all its command buffers have been executed, so the number of pools is roughly
+    // the number of frames in flight.
+    std::vector<std::unique_ptr<VulkanUtilities::CommandBufferPool>> m_RetiredCmdPools;
 
     VulkanUploadHeap              m_UploadHeap;
     VulkanDynamicHeap             m_DynamicHeap;
@@ -653,6 +826,26 @@ private:
     std::vector<VkClearValue> m_vkClearValues;
 
     VulkanUtilities::QueryPoolWrapper m_ASQueryPool;
+
+    // Begin-split barrier that waits for the matching end-split barrier
+    struct PendingSplitBarrier
+    {
+        RefCntAutoPtr<IDeviceObject> pResource;
+
+        Uint32 FirstMipLevel   = 0;
+        Uint32 MipLevelsCount  = 0;
+        Uint32 FirstArraySlice = 0;
+        Uint32 ArraySliceCount = 0;
+
+        RESOURCE_STATE OldState = RESOURCE_STATE_UNKNOWN;
+        RESOURCE_STATE NewState = RESOURCE_STATE_UNKNOWN;
+
+        VulkanUtilities::EventWrapper Event;
+    };
+    std::vector<PendingSplitBarrier> m_PendingSplitBarriers;
+
+    // Events of the completed split barriers that are released when the frame is finished
+    std::vector<VulkanUtilities::EventWrapper> m_UsedSplitBarrierEvents;
 };
 
 
@@ -63,7 +63,16 @@ public:
     /// Implementation of IDeviceMemoryVk::GetRange().
     virtual DeviceMemoryRangeVk DILIGENT_CALL_TYPE GetRange(Uint64 Offset, Uint64 Size) const override final;
 
+    /// Returns the memory range for a placed resource at the given offset in the memory
+    /// of DEVICE_MEMORY_TYPE_PLACED type. Throws an exception if the resource can't be placed.
+    DeviceMemoryRangeVk GetPlacedRange(Uint64                      Offset,
+                                       const VkMemoryRequirements& MemReqs,
+                                       VkDeviceSize                Alignment,
+                                       const char*                 ResourceName) const noexcept(false);
+
 private:
+    bool UseDeviceAddress() const;
+
     std::vector<VulkanUtilities::DeviceMemoryWrapper> m_Pages;
     uint32_t                                          m_MemoryTypeIndex = ~0u;
 };
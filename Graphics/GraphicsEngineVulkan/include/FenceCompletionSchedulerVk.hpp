@@ -0,0 +1,66 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::FenceCompletionSchedulerVk class
+
+#include "FenceCompletionScheduler.hpp"
+#include "VulkanUtilities/LogicalDevice.hpp"
+
+namespace Diligent
+{
+
+/// Fence completion scheduler that waits for the timeline semaphores of all pending
+/// fences with a single vkWaitSemaphores call. Requires DeviceFeatures::NativeFence.
+class FenceCompletionSchedulerVk final : public FenceCompletionScheduler
+{
+public:
+    explicit FenceCompletionSchedulerVk(const VulkanUtilities::LogicalDevice& LogicalDevice);
+    ~FenceCompletionSchedulerVk();
+
+private:
+    virtual void WaitForAny(const std::vector<FenceWaitInfo>& Fences) override final;
+    virtual void WakeUp() override final;
+
+    const VulkanUtilities::LogicalDevice& m_LogicalDevice;
+
+    // Timeline semaphore that is signaled from the CPU to interrupt the wait
+    VulkanUtilities::SemaphoreWrapper m_WakeUpSemaphore;
+
+    std::mutex m_WakeUpMtx;
+    Uint64     m_WakeUpValue = 0;
+
+    // The last wake-up semaphore value observed by the worker thread
+    Uint64 m_ObservedWakeUpValue = 0;
+
+    std::vector<VkSemaphore> m_Semaphores;
+    std::vector<Uint64>      m_Values;
+};
+
+} // namespace Diligent
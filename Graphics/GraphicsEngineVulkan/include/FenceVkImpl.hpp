@@ -73,6 +73,9 @@ public:
     /// Implementation of IFenceVk::GetVkSemaphore().
     virtual VkSemaphore DILIGENT_CALL_TYPE GetVkSemaphore() override final { return m_TimelineSemaphore; }
 
+    /// Implementation of IFenceVk::ExportSemaphoreHandle().
+    virtual Bool DILIGENT_CALL_TYPE ExportSemaphoreHandle(Uint64& Handle) override final;
+
     VulkanUtilities::RecycledSemaphore ExtractSignalSemaphore(SoftwareQueueIndex CommandQueueId, Uint64 Value);
 
     void Reset(Uint64 Value);
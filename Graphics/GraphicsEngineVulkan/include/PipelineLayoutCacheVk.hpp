@@ -0,0 +1,154 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineLayoutCacheVk class
+
+#include <unordered_map>
+#include <mutex>
+#include <vector>
+
+#include "VulkanUtilities/ObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+
+/// Device-level cache of descriptor set layouts and pipeline layouts.
+
+/// Identical layouts are shared between all resource signatures and pipelines
+/// that use them, which reduces the number of Vulkan objects.
+/// Every layout returned by the cache is reference-counted and must be returned
+/// back with the corresponding Release method.
+class PipelineLayoutCacheVk
+{
+public:
+    PipelineLayoutCacheVk(RenderDeviceVkImpl& DeviceVkImpl) :
+        m_DeviceVk{DeviceVkImpl}
+    {}
+
+    // clang-format off
+    PipelineLayoutCacheVk             (const PipelineLayoutCacheVk&) = delete;
+    PipelineLayoutCacheVk             (PipelineLayoutCacheVk&&)      = delete;
+    PipelineLayoutCacheVk& operator = (const PipelineLayoutCacheVk&) = delete;
+    PipelineLayoutCacheVk& operator = (PipelineLayoutCacheVk&&)      = delete;
+    // clang-format on
+
+    ~PipelineLayoutCacheVk();
+
+    VkDescriptorSetLayout GetDescriptorSetLayout(const VkDescriptorSetLayoutCreateInfo& SetLayoutCI);
+    void                  ReleaseDescriptorSetLayout(VkDescriptorSetLayout vkSetLayout);
+
+    VkPipelineLayout GetPipelineLayout(const VkDescriptorSetLayout* pSetLayouts, Uint32 SetLayoutCount);
+    void             ReleasePipelineLayout(VkPipelineLayout vkPipelineLayout);
+
+    struct SetLayoutKey
+    {
+        struct Binding
+        {
+            uint32_t           BindingIndex          = 0;
+            VkDescriptorType   DescriptorType        = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+            uint32_t           DescriptorCount       = 0;
+            VkShaderStageFlags StageFlags            = 0;
+            uint32_t           FirstImmutableSampler = ~0u; // Index in ImmutableSamplers, or ~0u if there are no immutable samplers
+        };
+
+        VkDescriptorSetLayoutCreateFlags Flags = 0;
+        std::vector<Binding>             Bindings;
+        // Immutable samplers are compared by handle
+        std::vector<VkSampler> ImmutableSamplers;
+
+        explicit SetLayoutKey(const VkDescriptorSetLayoutCreateInfo& SetLayoutCI);
+
+        bool   operator==(const SetLayoutKey& rhs) const;
+        size_t GetHash() const;
+
+    private:
+        mutable size_t Hash = 0;
+    };
+
+    struct PipelineLayoutKey
+    {
+        std::vector<VkDescriptorSetLayout> SetLayouts;
+
+        PipelineLayoutKey(const VkDescriptorSetLayout* pSetLayouts, Uint32 SetLayoutCount) :
+            SetLayouts{pSetLayouts, pSetLayouts + SetLayoutCount}
+        {}
+
+        bool   operator==(const PipelineLayoutKey& rhs) const;
+        size_t GetHash() const;
+
+    private:
+        mutable size_t Hash = 0;
+    };
+
+private:
+    template <typename KeyType, typename WrapperType>
+    class LayoutMap
+    {
+    public:
+        using VkObjectType = typename WrapperType::VkObjectType;
+
+        template <typename CreateLayoutType>
+        VkObjectType Get(KeyType&& Key, CreateLayoutType&& CreateLayout);
+
+        // Returns the layout that is no longer used, or null wrapper if the layout is still referenced
+        WrapperType Release(VkObjectType vkLayout);
+
+        bool IsEmpty() const { return m_Layouts.empty() && m_HandleToKey.empty(); }
+
+    private:
+        struct KeyHash
+        {
+            size_t operator()(const KeyType& Key) const
+            {
+                return Key.GetHash();
+            }
+        };
+
+        struct LayoutInfo
+        {
+            WrapperType Layout;
+            Uint32      RefCount = 0;
+        };
+
+        std::unordered_map<KeyType, LayoutInfo, KeyHash> m_Layouts;
+        // Pointers to the keys in m_Layouts are stable as long as the elements are not erased
+        std::unordered_map<VkObjectType, const KeyType*> m_HandleToKey;
+    };
+
+    RenderDeviceVkImpl& m_DeviceVk;
+
+    std::mutex m_Mutex;
+
+    LayoutMap<SetLayoutKey, VulkanUtilities::DescriptorSetLayoutWrapper> m_SetLayouts;
+    LayoutMap<PipelineLayoutKey, VulkanUtilities::PipelineLayoutWrapper> m_PipelineLayouts;
+};
+
+} // namespace Diligent
@@ -48,10 +48,15 @@ public:
     ~PipelineLayoutVk();
 
     void Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<PipelineResourceSignatureVkImpl> ppSignatures[], Uint32 SignatureCount) noexcept(false);
-    void Release(RenderDeviceVkImpl* pDeviceVkImpl, Uint64 CommandQueueMask);
+    void Release(RenderDeviceVkImpl* pDeviceVkImpl);
 
     VkPipelineLayout GetVkPipelineLayout() const { return m_VkPipelineLayout; }
 
+    // Writes the descriptor set layouts the pipeline layout was created with to pLayouts and returns their count.
+    // pLayouts must have room for MAX_RESOURCE_SIGNATURES * PipelineResourceSignatureVkImpl::MAX_DESCRIPTOR_SETS elements.
+    // Shader objects do not use pipeline layouts and are created with the set layouts directly.
+    Uint32 GetVkDescriptorSetLayouts(const RefCntAutoPtr<PipelineResourceSignatureVkImpl> ppSignatures[], Uint32 SignatureCount, VkDescriptorSetLayout* pLayouts) const;
+
     // Returns the index of the first descriptor set used by the resource signature at the given bind index
     Uint32 GetFirstDescrSetIndex(Uint32 Index) const
     {
@@ -59,8 +64,17 @@ public:
         return m_FirstDescrSetIndex[Index];
     }
 
+    // Returns true if the dynamic descriptor set of the resource signature at the given bind index
+    // uses the push descriptor layout and must be pushed to the command buffer instead of being bound.
+    bool IsDynamicSetPushed(Uint32 Index) const
+    {
+        VERIFY_EXPR(Index <= m_DbgMaxBindIndex);
+        return m_PushDescrSetBindIndex == Index;
+    }
+
 private:
-    VulkanUtilities::PipelineLayoutWrapper m_VkPipelineLayout;
+    // Pipeline layout shared through the device's pipeline layout cache
+    VkPipelineLayout m_VkPipelineLayout = VK_NULL_HANDLE;
 
     using FirstDescrSetIndexArrayType = std::array<Uint8, MAX_RESOURCE_SIGNATURES>;
     // Index of the first descriptor set, for every resource signature.
@@ -70,6 +84,10 @@ private:
     // (Maximum is MAX_RESOURCE_SIGNATURES * 2)
     Uint8 m_DescrSetCount = 0;
 
+    // Bind index of the resource signature whose dynamic set is pushed.
+    // Only one push descriptor set is allowed per pipeline layout.
+    Uint8 m_PushDescrSetBindIndex = 0xFF;
+
 #ifdef DILIGENT_DEBUG
     Uint32 m_DbgMaxBindIndex = 0;
 #endif
@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineLibraryCache class
+
+#include <unordered_map>
+#include <mutex>
+
+#include "DeviceObjectDigest.hpp"
+#include "VulkanUtilities/ObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+/// Caches graphics pipeline libraries (VK_EXT_graphics_pipeline_library) by the digest of
+/// the pipeline state subset they were created from, so that pipelines that share
+/// e.g. the vertex shader and the rasterizer state reuse the same pre-rasterization library.
+///
+/// Libraries are kept alive until the device is destroyed.
+class PipelineLibraryCache
+{
+public:
+    PipelineLibraryCache() noexcept {}
+
+    // clang-format off
+    PipelineLibraryCache             (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache             (PipelineLibraryCache&&)      = delete;
+    PipelineLibraryCache& operator = (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache& operator = (PipelineLibraryCache&&)      = delete;
+    // clang-format on
+
+    /// Returns the library with the given digest. If there is no such library in the cache,
+    /// creates it with CreateLibrary, which must return VulkanUtilities::PipelineWrapper.
+    ///
+    /// \remarks    The library is created outside of the lock, so two threads may create the same
+    ///             library simultaneously. In this case, only one of them is added to the cache.
+    template <typename CreateLibraryType>
+    VkPipeline GetLibrary(const DeviceObjectDigest& Digest, CreateLibraryType&& CreateLibrary) noexcept(false)
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mutex};
+
+            auto it = m_Libraries.find(Digest);
+            if (it != m_Libraries.end())
+                return it->second;
+        }
+
+        VulkanUtilities::PipelineWrapper Library = CreateLibrary();
+
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        return m_Libraries.emplace(Digest, std::move(Library)).first->second;
+    }
+
+private:
+    std::mutex                                                                                           m_Mutex;
+    std::unordered_map<DeviceObjectDigest, VulkanUtilities::PipelineWrapper, DeviceObjectDigest::Hasher> m_Libraries;
+};
+
+} // namespace Diligent
@@ -199,5 +199,22 @@ inline VkDescriptorType DescriptorTypeToVkDescriptorType(DescriptorType Type)
     }
 }
 
+// Descriptor buffers (VK_EXT_descriptor_buffer) do not support descriptors with dynamic offsets.
+// Buffers with dynamic offsets are written as regular uniform and storage buffers; the offset
+// is applied to the buffer address when the descriptor is written.
+inline VkDescriptorType DescriptorTypeToVkDescriptorBufferType(DescriptorType Type)
+{
+    const VkDescriptorType vkType = DescriptorTypeToVkDescriptorType(Type);
+    switch (vkType)
+    {
+        // clang-format off
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC: return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        // clang-format on
+        default:
+            return vkType;
+    }
+}
+
 
 } // namespace Diligent
@@ -45,6 +45,11 @@
 #include "VulkanUtilities/ObjectWrappers.hpp"
 #include "SRBMemoryAllocator.hpp"
 
+namespace VulkanUtilities
+{
+class CommandBuffer;
+}
+
 namespace Diligent
 {
 
@@ -120,9 +125,16 @@ public:
 
     VkDescriptorSetLayout GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId]; }
 
+    // Returns the push descriptor layout of the dynamic set, or VK_NULL_HANDLE if
+    // the dynamic resources of this signature can't be pushed (see PipelineLayoutVk).
+    VkDescriptorSetLayout GetVkPushDescriptorSetLayout() const { return m_VkPushDescrSetLayout; }
+
     bool   HasDescriptorSet(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId] != VK_NULL_HANDLE; }
     Uint32 GetDescriptorSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescriptorSetSizes[SetId]; }
 
+    // Only valid when descriptor buffers are used (see RenderDeviceVkImpl::UseDescriptorBuffers())
+    const ShaderResourceCacheVk::DescriptorBufferSetLayout& GetDescriptorBufferSetLayout(DESCRIPTOR_SET_ID SetId) const { return m_DescrBufferSetLayouts[SetId]; }
+
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
     // Copies static resources from the static resource cache to the destination cache
@@ -130,9 +142,23 @@ public:
     // Make the base class method visible
     using TPipelineResourceSignatureBase::CopyStaticResources;
 
-    // Commits dynamic resources from ResourceCache to vkDynamicDescriptorSet
-    void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                VkDescriptorSet              vkDynamicDescriptorSet) const;
+    // Commits dynamic resources from ResourceCache to vkDynamicDescriptorSet.
+    // UpdateData is the scratch space used when the set is updated with the descriptor update template.
+    void CommitDynamicResources(const ShaderResourceCacheVk&                              ResourceCache,
+                                VkDescriptorSet                                           vkDynamicDescriptorSet,
+                                std::vector<ShaderResourceCacheVk::DescriptorUpdateInfo>& UpdateData) const;
+
+    // Pushes dynamic resources from ResourceCache to the command buffer.
+    // The signature must have been created with the push descriptor layout.
+    void PushDynamicResources(const ShaderResourceCacheVk&    ResourceCache,
+                              VulkanUtilities::CommandBuffer& CmdBuffer,
+                              VkPipelineBindPoint             BindPoint,
+                              VkPipelineLayout                vkPipelineLayout,
+                              Uint32                          SetIndex) const;
+
+    // The maximum number of descriptors in the dynamic set that can be pushed.
+    // This is the minimum value of maxPushDescriptors guaranteed by the specification.
+    static constexpr Uint32 MaxPushDescriptorCount = 32;
 
 #ifdef DILIGENT_DEVELOPMENT
     /// Verifies committed resource using the SPIRV resource attributes from the PSO.
@@ -178,15 +204,47 @@ private:
 
     void CreateSetLayouts(bool IsSerialized);
 
+    struct ImmutableSamplerBinding
+    {
+        DESCRIPTOR_SET_ID SetId;
+        Uint32            BindingIndex;
+        VkSampler         vkSampler;
+    };
+    void InitDescriptorBufferSetLayouts(const std::vector<VkSampler>&               ResourceImmutableSamplers,
+                                        const std::vector<ImmutableSamplerBinding>& SeparateImmutableSamplers);
+
+    void CreateDynamicSetUpdateTemplate();
+
+    // Writes dynamic resources of the resource cache in batches defined by BatchSizesType
+    // and calls FlushWrites(Count, pWrites) for every batch.
+    template <typename BatchSizesType, typename FlushHandlerType>
+    void WriteDynamicDescriptors(const ShaderResourceCacheVk& ResourceCache,
+                                 VkDescriptorSet              vkDynamicDescriptorSet,
+                                 FlushHandlerType&&           FlushWrites) const;
+
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
 
 private:
-    std::array<VulkanUtilities::DescriptorSetLayoutWrapper, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrSetLayouts;
+    // Descriptor set layouts are shared through the device's pipeline layout cache
+    std::array<VkDescriptorSetLayout, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrSetLayouts = {};
+
+    // Layout of the dynamic set created with VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR
+    VkDescriptorSetLayout m_VkPushDescrSetLayout = VK_NULL_HANDLE;
+
+    // Descriptor update template that writes all dynamic resources to the dynamic set
+    VulkanUtilities::DescrUpdateTemplateWrapper m_DynamicSetUpdateTemplate;
+
+    // Descriptor buffer layouts of the static/mutable and dynamic sets, when descriptor buffers are used
+    std::array<ShaderResourceCacheVk::DescriptorBufferSetLayout, DESCRIPTOR_SET_ID_NUM_SETS> m_DescrBufferSetLayouts;
 
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
+    // The number of uniform and storage buffers in each descriptor set, accounting for array size.
+    // Indexed by the set index in the layout.
+    std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetBufferCounts = {};
+
     // The total number of uniform buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicUniformBufferCount = 0;
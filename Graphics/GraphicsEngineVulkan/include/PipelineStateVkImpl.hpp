@@ -32,6 +32,7 @@
 
 #include <array>
 #include <memory>
+#include <atomic>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineStateBase.hpp"
@@ -69,10 +70,52 @@ public:
     virtual IRenderPassVk* DILIGENT_CALL_TYPE GetRenderPass() const override final { return GetRenderPassPtr().RawPtr<IRenderPassVk>(); }
 
     /// Implementation of IPipelineStateVk::GetVkPipeline().
-    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final { return m_Pipeline; }
+    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final
+    {
+        return m_OptimizedPipelineReady.load(std::memory_order_acquire) ? static_cast<VkPipeline>(m_OptimizedPipeline) : static_cast<VkPipeline>(m_Pipeline);
+    }
 
     const PipelineLayoutVk& GetPipelineLayout() const { return m_PipelineLayout; }
 
+    // Graphics pipeline states that are set dynamically when the pipeline uses
+    // shader objects (VK_EXT_shader_object) instead of a Vulkan pipeline.
+    struct ShaderObjectData
+    {
+        std::vector<VulkanUtilities::ShaderObjectWrapper> Shaders;
+
+        // All graphics stages enabled on the device. Stages that are not used by the pipeline
+        // must be explicitly unbound, so their shaders are null.
+        std::vector<VkShaderStageFlagBits> vkStages;
+        std::vector<VkShaderEXT>           vkShaders;
+
+        VkPipelineRasterizationStateCreateInfo RasterizerCI{};
+        VkPipelineDepthStencilStateCreateInfo  DepthStencilCI{};
+
+        // Per-attachment color blend states
+        std::vector<VkBool32>                BlendEnables;
+        std::vector<VkColorBlendEquationEXT> BlendEquations;
+        std::vector<VkColorComponentFlags>   ColorWriteMasks;
+
+        std::vector<VkVertexInputBindingDescription2EXT>   VertexBindings;
+        std::vector<VkVertexInputAttributeDescription2EXT> VertexAttributes;
+
+        VkPrimitiveTopology   Topology               = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        uint32_t              PatchControlPoints     = 0;
+        VkBool32              PrimitiveRestartEnable = VK_FALSE;
+        VkSampleCountFlagBits SampleCount            = VK_SAMPLE_COUNT_1_BIT;
+        VkSampleMask          SampleMask             = ~0u;
+    };
+
+    // Returns true if the pipeline uses shader objects instead of a Vulkan pipeline.
+    // In this case, GetVkPipeline() returns VK_NULL_HANDLE.
+    bool UsesShaderObjects() const { return m_pShaderObjectData != nullptr; }
+
+    const ShaderObjectData& GetShaderObjectData() const
+    {
+        VERIFY_EXPR(m_pShaderObjectData);
+        return *m_pShaderObjectData;
+    }
+
     struct ShaderStageInfo
     {
         ShaderStageInfo() {}
@@ -91,6 +134,22 @@ public:
     };
     using TShaderStages = std::vector<ShaderStageInfo>;
 
+    // Specialization constant values of a single shader module.
+    struct SpecializationInfo
+    {
+        std::vector<VkSpecializationMapEntry> MapEntries;
+        std::vector<Uint8>                    Data;
+
+        // Returns null if there are no constants to specialize.
+        // The returned pointer is invalidated if the object is moved.
+        const VkSpecializationInfo* GetVkSpecializationInfo();
+
+    private:
+        VkSpecializationInfo vkSpecInfo{};
+    };
+    // Specialization infos for each shader module, in the same order as the modules
+    using TSpecializationInfos = std::vector<SpecializationInfo>;
+
 #ifdef DILIGENT_DEVELOPMENT
     // Performs validation of SRB resource parameters that are not possible to validate
     // when resource is bound.
@@ -124,7 +183,8 @@ private:
     template <typename PSOCreateInfoType>
     TShaderStages InitInternalObjects(const PSOCreateInfoType&                           CreateInfo,
                                       std::vector<VkPipelineShaderStageCreateInfo>&      vkShaderStages,
-                                      std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules) noexcept(false);
+                                      std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules,
+                                      TSpecializationInfos&                              SpecInfos) noexcept(false);
 
     void InitPipelineLayout(const PipelineStateCreateInfo& CreateInfo,
                             TShaderStages&                 ShaderStages) noexcept(false);
@@ -133,6 +193,17 @@ private:
     void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
     void InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo);
 
+    // Starts SPIR-V optimization of the pipeline shaders in the background if requested,
+    // see PSO_CREATE_FLAG_BACKGROUND_OPTIMIZATION.
+    void StartBackgroundOptimization(const PipelineStateCreateInfo& CreateInfo, TShaderStages& ShaderStages, const TSpecializationInfos& SpecInfos);
+
+    // Links the link-time optimized pipeline from the graphics pipeline libraries in the background.
+    void StartBackgroundLinkTimeOptimization(const PipelineStateCreateInfo& CreateInfo, std::vector<VkPipeline> Libraries, VkPipelineCreateFlags Flags);
+
+    // Creates shader objects for all stages of a graphics pipeline and initializes the states
+    // that are set dynamically when the pipeline is bound.
+    void InitializeShaderObjects(TShaderStages& ShaderStages, const TSpecializationInfos& SpecInfos);
+
     // TPipelineStateBase::Construct needs access to InitializePipeline
     friend TPipelineStateBase;
 
@@ -141,6 +212,16 @@ private:
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayoutVk                 m_PipelineLayout;
 
+    // Pipeline created from the shaders optimized in the background, or linked with
+    // link-time optimization from the graphics pipeline libraries.
+    // The unoptimized pipeline is kept alive as it may still be referenced by other threads.
+    VulkanUtilities::PipelineWrapper m_OptimizedPipeline;
+    std::atomic<bool>                m_OptimizedPipelineReady{false};
+    RefCntAutoPtr<IAsyncTask>        m_pOptimizationTask;
+
+    // Null unless the pipeline uses shader objects
+    std::unique_ptr<ShaderObjectData> m_pShaderObjectData;
+
 #ifdef DILIGENT_DEVELOPMENT
     // Shader resources for all shaders in all shader stages
     TShaderResources m_ShaderResources;
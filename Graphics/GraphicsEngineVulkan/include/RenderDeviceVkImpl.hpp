@@ -32,6 +32,9 @@
 #include <memory>
 #include <unordered_map>
 #include <vector>
+#include <mutex>
+#include <atomic>
+#include <functional>
 
 #include "EngineVkImplTraits.hpp"
 
@@ -51,6 +54,8 @@
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
 #include "RenderPassCache.hpp"
+#include "PipelineLibraryCache.hpp"
+#include "PipelineLayoutCacheVk.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
 
@@ -114,6 +119,13 @@ public:
     /// Implementation of IRenderDevice::CreateQuery() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE CreateQuery(const QueryDesc& Desc, IQuery** ppQuery) override final;
 
+    /// Implementation of IRenderDevice::CreateQueryPool() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool) override final;
+
+    /// Implementation of IRenderDevice::CreateIndirectCommandSignature() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc,
+                                                                   IIndirectCommandSignature**         ppSignature) override final;
+
     /// Implementation of IRenderDevice::CreateRenderPass() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE CreateRenderPass(const RenderPassDesc& Desc,
                                                      IRenderPass**         ppRenderPass) override final;
@@ -156,6 +168,18 @@ public:
     virtual void DILIGENT_CALL_TYPE CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
                                                        IDeviceMemory**               ppMemory) override final;
 
+    /// Implementation of IRenderDevice::CreatePlacedTexture() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE CreatePlacedTexture(const TextureDesc& TexDesc,
+                                                        IDeviceMemory*     pMemory,
+                                                        Uint64             MemoryOffset,
+                                                        ITexture**         ppTexture) override final;
+
+    /// Implementation of IRenderDevice::CreatePlacedBuffer() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE CreatePlacedBuffer(const BufferDesc& BuffDesc,
+                                                       IDeviceMemory*    pMemory,
+                                                       Uint64            MemoryOffset,
+                                                       IBuffer**         ppBuffer) override final;
+
     /// Implementation of IRenderDevice::CreatePipelineStateCache() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                              IPipelineStateCache**               ppPipelineStateCache) override final;
@@ -215,7 +239,21 @@ public:
                                   VulkanUtilities::CommandPoolWrapper& CmdPool,
                                   VulkanUtilities::CommandBuffer&      CmdBuffer,
                                   const Char*                          DebugPoolName = nullptr);
-    void ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex CommandQueueId, VkCommandBuffer vkCmdBuff, VulkanUtilities::CommandPoolWrapper&& CmdPool);
+    // Returns the fence value associated with the submitted command buffer
+    Uint64 ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex CommandQueueId, VkCommandBuffer vkCmdBuff, VulkanUtilities::CommandPoolWrapper&& CmdPool);
+
+    // Records the commands that copy the initial data of a buffer or a texture from the staging buffer
+    // into the shared transient command buffer of the queue, so that resources created in a row are
+    // uploaded with a single submission. The batch is submitted when its staging memory size or the
+    // number of uploads exceeds the threshold, or before the next command buffer is submitted to any queue.
+    // The staging buffer and memory are released when the batch is complete.
+    void EnqueueInitialDataUpload(SoftwareQueueIndex                                          CommandQueueId,
+                                  VulkanUtilities::BufferWrapper&&                            StagingBuffer,
+                                  VulkanUtilities::MemoryAllocation&&                         StagingMemory,
+                                  const std::function<void(VulkanUtilities::CommandBuffer&)>& RecordCommands);
+
+    // Submits the pending initial data uploads of all queues
+    void FlushInitialDataUploads();
 
     /// Implementation of IRenderDevice::ReleaseStaleResources() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final;
@@ -225,9 +263,21 @@ public:
                                                                                   RESOURCE_DIMENSION Dimension,
                                                                                   Uint32             SampleCount) const override final;
 
+    /// Implementation of IRenderDevice::GetTextureMemoryRequirements() in Vulkan backend.
+    virtual ResourceMemoryRequirements DILIGENT_CALL_TYPE GetTextureMemoryRequirements(const TextureDesc& TexDesc) const override final;
+
+    /// Implementation of IRenderDevice::GetBufferMemoryRequirements() in Vulkan backend.
+    virtual ResourceMemoryRequirements DILIGENT_CALL_TYPE GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const override final;
+
     /// Implementation of IRenderDeviceVk::GetDeviceFeaturesVk().
     virtual void DILIGENT_CALL_TYPE GetDeviceFeaturesVk(DeviceFeaturesVk& FeaturesVk) const override final;
 
+    /// Implementation of IRenderDeviceVk::GetMemoryHeapCount().
+    virtual Uint32 DILIGENT_CALL_TYPE GetMemoryHeapCount() const override final;
+
+    /// Implementation of IRenderDeviceVk::GetMemoryHeapUsage().
+    virtual void DILIGENT_CALL_TYPE GetMemoryHeapUsage(Uint32 HeapIndex, MemoryHeapUsageVk& Usage) const override final;
+
     /// Implementation of IRenderDeviceVk::GetDXCompiler().
     virtual IDXCompiler* DILIGENT_CALL_TYPE GetDXCompiler() const override final
     {
@@ -245,19 +295,30 @@ public:
     const VulkanUtilities::PhysicalDevice& GetPhysicalDevice() const { return *m_PhysicalDevice; }
     const VulkanUtilities::LogicalDevice&  GetLogicalDevice() const { return *m_LogicalDevice; }
 
+    // Returns true if shader resource bindings use VK_EXT_descriptor_buffer instead of descriptor sets
+    bool UseDescriptorBuffers() const { return m_LogicalDevice->GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE; }
+
+    // Returns true if graphics pipelines with implicit render passes use VK_EXT_shader_object instead of Vulkan pipelines
+    bool UseShaderObjects() const { return m_LogicalDevice->GetEnabledExtFeatures().ShaderObject.shaderObject != VK_FALSE; }
+
     FramebufferCache* GetFramebufferCache() { return m_FramebufferCache.get(); }
     RenderPassCache*  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache.get(); }
 
+    // Returns null if graphics pipeline libraries with fast linking are not supported
+    PipelineLibraryCache* GetPipelineLibraryCache() { return m_PipelineLibraryCache.get(); }
+
+    PipelineLayoutCacheVk& GetPipelineLayoutCache() { return *m_PipelineLayoutCache; }
+
     VulkanUtilities::MemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
     {
         return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags);
     }
-    VulkanUtilities::MemoryAllocation AllocateMemory(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, VkMemoryAllocateFlags AllocateFlags = 0)
+    VulkanUtilities::MemoryAllocation AllocateMemory(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, VkMemoryAllocateFlags AllocateFlags = 0, bool AllowSlab = false)
     {
         const auto& MemoryProps = m_PhysicalDevice->GetMemoryProperties();
         VERIFY_EXPR(MemoryTypeIndex < MemoryProps.memoryTypeCount);
         const auto MemoryFlags = MemoryProps.memoryTypes[MemoryTypeIndex].propertyFlags;
-        return m_MemoryMgr.Allocate(Size, Alignment, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags);
+        return m_MemoryMgr.Allocate(Size, Alignment, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags, AllowSlab);
     }
     VulkanUtilities::MemoryManager& GetGlobalMemoryManager() { return m_MemoryMgr; }
 
@@ -288,6 +349,8 @@ public:
 private:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
 
+    virtual std::unique_ptr<FenceCompletionScheduler> CreateFenceCompletionScheduler() override final;
+
     // Submits command buffer(s) for execution to the command queue and
     // returns the submitted command buffer(s) number and the fence value.
     // If SubmitInfo contains multiple command buffers, they all are treated
@@ -301,6 +364,9 @@ private:
                              Uint64&                                                     SubmittedFenceValue,
                              std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pFences);
 
+    // Submits the pending initial data uploads of the queue. m_InitialDataUploadsMtx must be locked.
+    void SubmitInitialDataUploads(SoftwareQueueIndex CommandQueueId);
+
 private:
     const Properties m_Properties;
 
@@ -308,9 +374,17 @@ private:
     std::unique_ptr<VulkanUtilities::PhysicalDevice> m_PhysicalDevice;
     std::shared_ptr<VulkanUtilities::LogicalDevice>  m_LogicalDevice;
 
+    // The compiler library is loaded on a background thread while the remaining
+    // members are initialized, so the compiler must be created first.
+    std::unique_ptr<IDXCompiler> m_pDxCompiler;
+
     std::unique_ptr<FramebufferCache> m_FramebufferCache;
     std::unique_ptr<RenderPassCache>  m_ImplicitRenderPassCache;
 
+    std::unique_ptr<PipelineLibraryCache> m_PipelineLibraryCache;
+
+    std::unique_ptr<PipelineLayoutCacheVk> m_PipelineLayoutCache;
+
     DescriptorSetAllocator m_DescriptorSetAllocator;
     DescriptorPoolManager  m_DynamicDescriptorPool;
 
@@ -319,14 +393,32 @@ private:
     // at a time, so every constructor must allocate command buffer from its own pool.
     std::unordered_map<HardwareQueueIndex, CommandPoolManager, HardwareQueueIndex::Hasher> m_TransientCmdPoolMgrs;
 
+    // Initial data uploads that have been recorded, but not yet submitted, one batch per command queue
+    struct InitialDataUploadBatch
+    {
+        VulkanUtilities::CommandPoolWrapper CmdPool;
+        VulkanUtilities::CommandBuffer      CmdBuffer;
+
+        // Staging resources are released together when the batch is complete
+        struct StagingResources
+        {
+            std::vector<VulkanUtilities::BufferWrapper>    Buffers;
+            std::vector<VulkanUtilities::MemoryAllocation> Memory;
+        };
+        StagingResources Staging;
+        VkDeviceSize     StagingSize = 0;
+    };
+    std::mutex                                m_InitialDataUploadsMtx;
+    std::unique_ptr<InitialDataUploadBatch[]> m_InitialDataUploads;
+    // The number of batches that have been recorded, but not yet submitted
+    std::atomic<Uint32> m_NumPendingInitialDataUploads{0};
+
     // Each command queue needs its own query manager to avoid race conditions.
     std::vector<std::unique_ptr<QueryManagerVk>> m_QueryMgrs;
 
     VulkanUtilities::MemoryManager m_MemoryMgr;
 
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
-
-    std::unique_ptr<IDXCompiler> m_pDxCompiler;
 };
 
 } // namespace Diligent
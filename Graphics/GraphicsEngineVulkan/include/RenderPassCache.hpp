@@ -35,7 +35,7 @@
 
 #include "GraphicsTypes.h"
 #include "Constants.h"
-#include "HashUtils.hpp"
+#include "XXH3Hasher.hpp"
 #include "VulkanUtilities/ObjectWrappers.hpp"
 #include "RefCntAutoPtr.hpp"
 
@@ -83,10 +83,27 @@ public:
             for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
                 RTVFormats[rt] = _RTVFormats[rt];
         }
+        // Attachment bits used by ClearMask and DiscardMask. Bit i corresponds to render target i.
+        static constexpr Uint32 DepthAttachmentBit   = 1u << MAX_RENDER_TARGETS;
+        static constexpr Uint32 StencilAttachmentBit = 1u << (MAX_RENDER_TARGETS + 1);
+
+        // Returns the key of the render pass that is compatible with this one, but uses
+        // ATTACHMENT_LOAD_OP_CLEAR or ATTACHMENT_LOAD_OP_DISCARD for the given attachments.
+        RenderPassCacheKey WithLoadOps(Uint32 _ClearMask, Uint32 _DiscardMask) const
+        {
+            RenderPassCacheKey Key{*this};
+            Key.ClearMask   = static_cast<decltype(ClearMask)>(_ClearMask);
+            Key.DiscardMask = static_cast<decltype(DiscardMask)>(_DiscardMask & ~_ClearMask);
+            Key.Hash        = 0;
+            return Key;
+        }
+
         Uint8          NumRenderTargets               = 0;
         Uint8          SampleCount                    = 0;
         bool           EnableVRS                      = false;
         bool           ReadOnlyDSV                    = false;
+        Uint16         ClearMask                      = 0;
+        Uint16         DiscardMask                    = 0;
         TEXTURE_FORMAT DSVFormat                      = TEX_FORMAT_UNKNOWN;
         TEXTURE_FORMAT RTVFormats[MAX_RENDER_TARGETS] = {};
 
@@ -98,7 +115,9 @@ public:
                 SampleCount      != rhs.SampleCount      ||
                 EnableVRS        != rhs.EnableVRS        ||
                 DSVFormat        != rhs.DSVFormat        ||
-                ReadOnlyDSV      != rhs.ReadOnlyDSV)
+                ReadOnlyDSV      != rhs.ReadOnlyDSV      ||
+                ClearMask        != rhs.ClearMask        ||
+                DiscardMask      != rhs.DiscardMask)
             {
                 return false;
             }
@@ -115,9 +134,10 @@ public:
         {
             if (Hash == 0)
             {
-                Hash = ComputeHash(NumRenderTargets, SampleCount, DSVFormat, EnableVRS, ReadOnlyDSV);
-                for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
-                    HashCombine(Hash, RTVFormats[rt]);
+                XXH3Hasher Hasher;
+                Hasher(NumRenderTargets, SampleCount, DSVFormat, EnableVRS, ReadOnlyDSV, ClearMask, DiscardMask);
+                Hasher.UpdateSpan(RTVFormats, NumRenderTargets);
+                Hash = Hasher.Get();
             }
             return Hash;
         }
@@ -37,18 +37,21 @@
 //  m_pMemory                                |   |              m_pResources, m_NumResources == m            |
 //  |               m_DescriptorSetAllocation|   |                                                           |
 //  V                                        |   |                                                           V
-//  |  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  |
-//         |    |                                                A \
-//         |    |                                                |  \
-//         |    |________________________________________________|   \RefCntAutoPtr
-//         |             m_pResources, m_NumResources == n            \_________
-//         |                                                          |  Object |
-//         | m_DescriptorSetAllocation                                 ---------
-//         V
-//  |Vulkan Descriptor Set|
+//  |  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  |  Buff[0]  | ... |  Buff[k-1]  | ...
+//         |    |                                                A \                                                        A
+//         |    |                                                |  \                                                       |
+//         |    |________________________________________________|   \RefCntAutoPtr                                         |
+//         |             m_pResources, m_NumResources == n            \_________                                            |
+//         |                                                          |  Object |                                           |
+//         | m_DescriptorSetAllocation                                 ---------                                            |
+//         V                                                                                                                |
+//  |Vulkan Descriptor Set|     m_pBuffers, m_NumBuffers == k ______________________________________________________________|
 //
 //  Ns = m_NumSets
 //
+// Resource records only keep the object and the descriptor type. Buffer ranges and dynamic offsets are only
+// required for uniform and storage buffers, and are kept in a separate array (Buff[]) after all resources.
+//
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
@@ -88,20 +91,48 @@ public:
 
     ~ShaderResourceCacheVk();
 
-    static size_t GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes);
+    // SetBufferCounts is the number of uniform and storage buffer descriptors in each set (see IsBufferDescriptor()).
+    static size_t GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes, const Uint32* SetBufferCounts);
 
-    void InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes);
+    void InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes, const Uint32* SetBufferCounts);
     void InitializeResources(Uint32 Set, Uint32 Offset, Uint32 ArraySize, DescriptorType Type, bool HasImmutableSampler);
 
-    // sizeof(Resource) == 32 (x64, msvc, Release)
+    // Returns true if the descriptor of the given type requires buffer range information.
+    static constexpr bool IsBufferDescriptor(DescriptorType Type)
+    {
+        return (Type == DescriptorType::UniformBuffer ||
+                Type == DescriptorType::UniformBufferDynamic ||
+                Type == DescriptorType::StorageBuffer ||
+                Type == DescriptorType::StorageBuffer_ReadOnly ||
+                Type == DescriptorType::StorageBufferDynamic ||
+                Type == DescriptorType::StorageBufferDynamic_ReadOnly);
+    }
+
+    // Range and dynamic offset of a uniform or storage buffer.
+    // sizeof(BufferInfo) == 16 (x64, msvc, Release)
+    struct BufferInfo
+    {
+/* 0 */ Uint64 BaseOffset    = 0;
+        // Buffer ranges are limited to 32 bits by Vulkan (maxUniformBufferRange, maxStorageBufferRange)
+/* 8 */ Uint32 RangeSize     = 0;
+/*12 */ Uint32 DynamicOffset = 0;
+/*16 */ // End of structure
+    };
+
+    // sizeof(Resource) == 16 (x64, msvc, Release)
     struct Resource
     {
-        explicit Resource(DescriptorType _Type, bool _HasImmutableSampler) noexcept :
+        static constexpr Uint32 InvalidBufferIndex = ~0u;
+
+        explicit Resource(DescriptorType _Type, bool _HasImmutableSampler, Uint32 _BufferIndex) noexcept :
             Type{_Type},
-            HasImmutableSampler{_HasImmutableSampler}
+            HasImmutableSampler{_HasImmutableSampler},
+            BufferIndex{_BufferIndex}
         {
             VERIFY(Type == DescriptorType::CombinedImageSampler || Type == DescriptorType::Sampler || !HasImmutableSampler,
                    "Immutable sampler can only be assigned to a combined image sampler or a separate sampler");
+            VERIFY(IsBufferDescriptor(Type) == (BufferIndex != InvalidBufferIndex),
+                   "Buffer index must be assigned to uniform and storage buffers only");
         }
 
         // clang-format off
@@ -113,15 +144,13 @@ public:
 /* 0 */ const DescriptorType         Type;
 /* 1 */ const bool                   HasImmutableSampler;
 /*2-3*/ // Unused
-/* 4 */ Uint32                       BufferDynamicOffset = 0;
+        // Index of the buffer info in the descriptor set, for uniform and storage buffers only
+/* 4 */ const Uint32                 BufferIndex;
 /* 8 */ RefCntAutoPtr<IDeviceObject> pObject;
+/*16 */ // End of structure
 
-        // For uniform and storage buffers only
-/*16 */ Uint64                       BufferBaseOffset = 0;
-/*24 */ Uint64                       BufferRangeSize  = 0;
-
-        VkDescriptorBufferInfo GetUniformBufferDescriptorWriteInfo()                     const;
-        VkDescriptorBufferInfo GetStorageBufferDescriptorWriteInfo()                     const;
+        VkDescriptorBufferInfo GetUniformBufferDescriptorWriteInfo(const BufferInfo& BuffInfo) const;
+        VkDescriptorBufferInfo GetStorageBufferDescriptorWriteInfo(const BufferInfo& BuffInfo) const;
         VkDescriptorImageInfo  GetImageDescriptorWriteInfo  ()                           const;
         VkBufferView           GetBufferViewWriteInfo       ()                           const;
         VkDescriptorImageInfo  GetSamplerDescriptorWriteInfo()                           const;
@@ -129,25 +158,23 @@ public:
         VkWriteDescriptorSetAccelerationStructureKHR GetAccelerationStructureWriteInfo() const;
         // clang-format on
 
-        template <DescriptorType DescrType>
-        auto GetDescriptorWriteInfo() const;
-
-        void SetUniformBuffer(RefCntAutoPtr<IDeviceObject>&& _pBuffer, Uint64 _RangeOffset, Uint64 _RangeSize);
-        void SetStorageBuffer(RefCntAutoPtr<IDeviceObject>&& _pBufferView);
+        void SetUniformBuffer(RefCntAutoPtr<IDeviceObject>&& _pBuffer, Uint64 _RangeOffset, Uint64 _RangeSize, BufferInfo& BuffInfo);
+        void SetStorageBuffer(RefCntAutoPtr<IDeviceObject>&& _pBufferView, BufferInfo& BuffInfo);
 
         bool IsNull() const { return pObject == nullptr; }
 
         explicit operator bool() const { return !IsNull(); }
     };
 
-    // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
+    // sizeof(DescriptorSet) == 56 (x64, msvc, Release)
     class DescriptorSet
     {
     public:
         // clang-format off
-        DescriptorSet(Uint32 NumResources, Resource *pResources) :
+        DescriptorSet(Uint32 NumResources, Resource *pResources, BufferInfo* pBuffers) :
             m_NumResources  {NumResources},
-            m_pResources    {pResources  }
+            m_pResources    {pResources  },
+            m_pBuffers      {pBuffers    }
         {}
 
         DescriptorSet             (const DescriptorSet&) = delete;
@@ -162,6 +189,12 @@ public:
             return m_pResources[CacheOffset];
         }
 
+        const BufferInfo& GetBufferInfo(const Resource& Res) const
+        {
+            VERIFY(Res.BufferIndex < m_NumBuffers, "Buffer index ", Res.BufferIndex, " is out of range");
+            return m_pBuffers[Res.BufferIndex];
+        }
+
         Uint32 GetSize() const { return m_NumResources; }
 
         VkDescriptorSet GetVkDescriptorSet() const
@@ -169,12 +202,18 @@ public:
             return m_DescriptorSetAllocation.GetVkDescriptorSet();
         }
 
+        template <DescriptorType DescrType>
+        auto GetDescriptorWriteInfo(Uint32 CacheOffset) const;
+
     private:
         // clang-format off
 /* 0 */ const Uint32            m_NumResources = 0;
+        // The number of buffer infos that have been assigned to resources
+/* 4 */ Uint32                  m_NumBuffers   = 0;
 /* 8 */ Resource* const         m_pResources   = nullptr;
-/*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
-/*48 */ // End of structure
+/*16 */ BufferInfo* const       m_pBuffers     = nullptr;
+/*24 */ DescriptorSetAllocation m_DescriptorSetAllocation;
+/*56 */ // End of structure
         // clang-format on
 
     private:
@@ -184,6 +223,12 @@ public:
             VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
             return m_pResources[CacheOffset];
         }
+
+        BufferInfo& GetBufferInfo(const Resource& Res)
+        {
+            VERIFY(Res.BufferIndex < m_NumBuffers, "Buffer index ", Res.BufferIndex, " is out of range");
+            return m_pBuffers[Res.BufferIndex];
+        }
     };
 
     const DescriptorSet& GetDescriptorSet(Uint32 Index) const
@@ -264,6 +309,50 @@ public:
                                    std::vector<uint32_t>& Offsets,
                                    Uint32                 StartInd) const;
 
+    // Descriptor info in the format expected by vkUpdateDescriptorSetWithTemplate.
+    // Descriptor update templates of the signature read one element per resource
+    // cache offset.
+    union DescriptorUpdateInfo
+    {
+        VkDescriptorImageInfo      ImageInfo;
+        VkDescriptorBufferInfo     BufferInfo;
+        VkBufferView               BufferView;
+        VkAccelerationStructureKHR AccelStruct;
+    };
+
+    // Writes descriptor infos of all resources in the descriptor set to pData, indexed by the
+    // resource cache offset. Returns false if any resource that is not an immutable sampler is null,
+    // in which case the set can't be updated with a template.
+    bool WriteDescriptorUpdateData(Uint32 DescrSetIndex, DescriptorUpdateInfo* pData) const;
+
+    // Descriptor set layout information that is required to write the set to a
+    // descriptor buffer (VK_EXT_descriptor_buffer)
+    struct DescriptorBufferSetLayout
+    {
+        // The size of the descriptor set data, in bytes
+        Uint32 DataSize = 0;
+
+        // Initial descriptor set data that contains descriptors of immutable
+        // samplers. All other descriptors are zero.
+        std::vector<Uint8> InitData;
+
+        // Offset of each descriptor in the set data, indexed by the resource cache offset
+        std::vector<Uint32> DescriptorOffsets;
+
+        // Immutable samplers of combined image samplers, indexed by the resource cache offset
+        std::vector<VkSampler> ImmutableSamplers;
+    };
+
+    // Writes descriptors of all resources in the descriptor set to pData that
+    // is the mapped memory of the descriptor buffer.
+    // Buffers with dynamic offsets are written with their current offsets.
+    void WriteDescriptorBufferData(Uint32                                               DescrSetIndex,
+                                   const DescriptorBufferSetLayout&                     Layout,
+                                   const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props,
+                                   const VulkanUtilities::LogicalDevice&                LogicalDevice,
+                                   DeviceContextVkImpl*                                 pCtx,
+                                   Uint8*                                               pData) const;
+
 private:
     Resource* GetFirstResourcePtr()
     {
@@ -295,25 +384,35 @@ private:
 #ifdef DILIGENT_DEBUG
     // Debug array that stores flags indicating if resources in the cache have been initialized
     std::vector<std::vector<bool>> m_DbgInitializedResources;
+    // The number of buffer infos allocated for each descriptor set
+    std::vector<Uint32> m_DbgSetBufferCounts;
 #endif
 };
 
 
 template <>
-__forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<DescriptorType::UniformBuffer>() const { return GetUniformBufferDescriptorWriteInfo(); }
+__forceinline auto ShaderResourceCacheVk::DescriptorSet::GetDescriptorWriteInfo<DescriptorType::UniformBuffer>(Uint32 CacheOffset) const
+{
+    const Resource& Res = GetResource(CacheOffset);
+    return Res.GetUniformBufferDescriptorWriteInfo(GetBufferInfo(Res));
+}
 template <>
-__forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<DescriptorType::StorageBuffer>() const { return GetStorageBufferDescriptorWriteInfo(); }
+__forceinline auto ShaderResourceCacheVk::DescriptorSet::GetDescriptorWriteInfo<DescriptorType::StorageBuffer>(Uint32 CacheOffset) const
+{
+    const Resource& Res = GetResource(CacheOffset);
+    return Res.GetStorageBufferDescriptorWriteInfo(GetBufferInfo(Res));
+}
 template <>
-__forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<DescriptorType::SeparateImage>() const { return GetImageDescriptorWriteInfo(); }
+__forceinline auto ShaderResourceCacheVk::DescriptorSet::GetDescriptorWriteInfo<DescriptorType::SeparateImage>(Uint32 CacheOffset) const { return GetResource(CacheOffset).GetImageDescriptorWriteInfo(); }
 template <>
-__forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<DescriptorType::UniformTexelBuffer>() const { return GetBufferViewWriteInfo(); }
+__forceinline auto ShaderResourceCacheVk::DescriptorSet::GetDescriptorWriteInfo<DescriptorType::UniformTexelBuffer>(Uint32 CacheOffset) const { return GetResource(CacheOffset).GetBufferViewWriteInfo(); }
 template <>
-__forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<DescriptorType::Sampler>() const { return GetSamplerDescriptorWriteInfo(); }
+__forceinline auto ShaderResourceCacheVk::DescriptorSet::GetDescriptorWriteInfo<DescriptorType::Sampler>(Uint32 CacheOffset) const { return GetResource(CacheOffset).GetSamplerDescriptorWriteInfo(); }
 template <>
-__forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<DescriptorType::InputAttachment>() const { return GetInputAttachmentDescriptorWriteInfo(); }
+__forceinline auto ShaderResourceCacheVk::DescriptorSet::GetDescriptorWriteInfo<DescriptorType::InputAttachment>(Uint32 CacheOffset) const { return GetResource(CacheOffset).GetInputAttachmentDescriptorWriteInfo(); }
 template <>
-__forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<DescriptorType::InputAttachment_General>() const { return GetInputAttachmentDescriptorWriteInfo(); }
+__forceinline auto ShaderResourceCacheVk::DescriptorSet::GetDescriptorWriteInfo<DescriptorType::InputAttachment_General>(Uint32 CacheOffset) const { return GetResource(CacheOffset).GetInputAttachmentDescriptorWriteInfo(); }
 template <>
-__forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<DescriptorType::AccelerationStructure>() const { return GetAccelerationStructureWriteInfo(); }
+__forceinline auto ShaderResourceCacheVk::DescriptorSet::GetDescriptorWriteInfo<DescriptorType::AccelerationStructure>(Uint32 CacheOffset) const { return GetResource(CacheOffset).GetAccelerationStructureWriteInfo(); }
 
 } // namespace Diligent
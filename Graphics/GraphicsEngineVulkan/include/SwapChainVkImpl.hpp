@@ -67,6 +67,9 @@ public:
     /// Implementation of ISwapChain::SetWindowedMode() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetWindowedMode() override final;
 
+    /// Implementation of ISwapChain::SetMaximumFrameLatency() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetMaximumFrameLatency(Uint32 MaxLatency) override final;
+
     /// Implementation of ISwapChainVk::GetVkSurface().
     virtual VkSurfaceKHR DILIGENT_CALL_TYPE GetVkSurface() override final { return m_VkSurface; }
 
@@ -91,12 +94,14 @@ private:
     void     RecreateVulkanSwapchain(DeviceContextVkImpl* pImmediateCtxVk);
     void     ReleaseSwapChainResources(DeviceContextVkImpl* pImmediateCtxVk, bool DestroyVkSwapChain);
     void     ThrottleFrameSubmission();
+    void     WaitForPresent(Uint64 PresentId);
 
     const NativeWindow m_Window;
 
     std::shared_ptr<const VulkanUtilities::Instance> m_Instance;
 
     Uint32 m_DesiredBufferCount = 0;
+    Uint32 m_MaxFrameLatency    = 0;
 
     VkSurfaceKHR   m_VkSurface     = VK_NULL_HANDLE;
     VkSwapchainKHR m_VkSwapChain   = VK_NULL_HANDLE;
@@ -128,6 +133,11 @@ private:
     bool     m_VSyncEnabled    = true;
     bool     m_ImageAcquired   = false;
     Uint32   m_FrameIndex      = 1;
+
+    // The first and the last present ids used with the current Vulkan swap chain, or 0 if no
+    // image has been presented with an id yet. Only ids in this range can be waited for.
+    Uint64 m_FirstPresentId = 0;
+    Uint64 m_LastPresentId  = 0;
 };
 
 } // namespace Diligent
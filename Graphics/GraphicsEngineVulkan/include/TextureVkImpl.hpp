@@ -30,6 +30,8 @@
 /// \file
 /// Declaration of Diligent::TextureVkImpl class
 
+#include <mutex>
+
 #include "EngineVkImplTraits.hpp"
 #include "TextureBase.hpp"
 #include "TextureViewVkImpl.hpp"
@@ -60,6 +62,14 @@ public:
                   RESOURCE_STATE             InitialState,
                   VkImage                    VkImageHandle);
 
+    // Creates a new Vk resource bound to the placed device memory
+    TextureVkImpl(IReferenceCounters*        pRefCounters,
+                  FixedBlockMemoryAllocator& TexViewObjAllocator,
+                  RenderDeviceVkImpl*        pDeviceVk,
+                  const TextureDesc&         TexDesc,
+                  IDeviceMemory*             pMemory,
+                  Uint64                     MemoryOffset);
+
     ~TextureVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_TextureVk, TTextureBase)
@@ -76,6 +86,15 @@ public:
     /// Implementation of ITextureVk::GetLayout().
     virtual VkImageLayout DILIGENT_CALL_TYPE GetLayout() const override final;
 
+    /// Implementation of ITextureVk::UpdateSubresourceOnHost().
+    virtual Bool DILIGENT_CALL_TYPE UpdateSubresourceOnHost(Uint32                   MipLevel,
+                                                            Uint32                   Slice,
+                                                            const Box&               DstBox,
+                                                            const TextureSubResData& SubresData) override final;
+
+    /// Implementation of ITextureVk::ExportMemoryHandle().
+    virtual Bool DILIGENT_CALL_TYPE ExportMemoryHandle(Uint64& Handle, Uint64& MemorySize) const override final;
+
     VkBuffer GetVkStagingBuffer() const
     {
         return m_StagingBuffer;
@@ -98,6 +117,8 @@ public:
     // ("Copying Data Between Buffers and Images")
     static constexpr Uint32 StagingBufferOffsetAlignment = 16; // max texel size - 16 bytes (RGBA32F), max texel block size - 16 bytes.
 
+    static ResourceMemoryRequirements GetPlacedMemoryRequirements(const TextureDesc& TexDesc, const RenderDeviceVkImpl* pDevice);
+
 protected:
     void CreateViewInternal(const struct TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView) override;
 
@@ -118,7 +139,17 @@ protected:
     VulkanUtilities::ImageWrapper     m_VulkanImage;
     VulkanUtilities::BufferWrapper    m_StagingBuffer;
     VulkanUtilities::MemoryAllocation m_MemoryAllocation;
-    VkDeviceSize                      m_StagingDataAlignedOffset = 0;
+    // Memory of the images for which the implementation prefers a dedicated allocation
+    VulkanUtilities::DeviceMemoryWrapper m_DedicatedMemory;
+    VkDeviceSize                         m_StagingDataAlignedOffset = 0;
+    // Device memory the placed texture is bound to
+    RefCntAutoPtr<IDeviceMemory> m_pPlacedMemory;
+
+    // Layout in which the texture can be updated on the host, or VK_IMAGE_LAYOUT_UNDEFINED
+    // if the texture was created without VK_IMAGE_USAGE_HOST_TRANSFER_BIT usage.
+    VkImageLayout m_HostCopyLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    // Protects the host layout transition of a new texture
+    std::mutex m_HostCopyMtx;
 };
 
 } // namespace Diligent
@@ -133,7 +133,8 @@ public:
     VulkanDynamicMemoryManager(IMemoryAllocator&         Allocator,
                                class RenderDeviceVkImpl& DeviceVk,
                                Uint32                    Size,
-                               Uint64                    CommandQueueMask);
+                               Uint64                    CommandQueueMask,
+                               bool                      UseDeviceLocalMemory);
     ~VulkanDynamicMemoryManager();
 
     // clang-format off
@@ -142,8 +143,10 @@ public:
     VulkanDynamicMemoryManager& operator= (const VulkanDynamicMemoryManager&)  = delete;
     VulkanDynamicMemoryManager& operator= (      VulkanDynamicMemoryManager&&) = delete;
 
-    VkBuffer GetVkBuffer()  const{return m_VkBuffer;}
-    Uint8*   GetCPUAddress()const{return m_CPUAddress;}
+    VkBuffer        GetVkBuffer()       const{return m_VkBuffer;}
+    Uint8*          GetCPUAddress()     const{return m_CPUAddress;}
+    // Only available when descriptor buffers are enabled
+    VkDeviceAddress GetVkDeviceAddress()const{return m_VkDeviceAddress;}
     // clang-format on
 
     void Destroy();
@@ -151,11 +154,14 @@ public:
     static constexpr const Uint32 MasterBlockAlignment = 1024;
     MasterBlock                   AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment);
 
+    using TBase::CreateBlockCache;
+
 private:
     RenderDeviceVkImpl&                  m_DeviceVk;
     VulkanUtilities::BufferWrapper       m_VkBuffer;
     VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
     Uint8*                               m_CPUAddress;
+    VkDeviceAddress                      m_VkDeviceAddress = 0;
     const VkDeviceSize                   m_DefaultAlignment;
     const Uint64                         m_CommandQueueMask;
     OffsetType                           m_TotalPeakSize = 0;
@@ -192,11 +198,16 @@ class VulkanDynamicHeap
 {
 public:
     // clang-format off
-    VulkanDynamicHeap(VulkanDynamicMemoryManager& DynamicMemMgr, std::string HeapName, Uint32 PageSize) :
+    VulkanDynamicHeap(VulkanDynamicMemoryManager& DynamicMemMgr, std::string HeapName, Uint32 PageSize, DeviceContextStats* pStats = nullptr) :
         m_GlobalDynamicMemMgr{DynamicMemMgr},
         m_HeapName           {std::move(HeapName)},
-        m_MasterBlockSize    (PageSize)
-    {}
+        m_pBlockCache        {DynamicMemMgr.CreateBlockCache()},
+        m_pStats             {pStats},
+        m_BaseMasterBlockSize{PageSize},
+        m_MasterBlockSize    {PageSize}
+    {
+        m_pBlockCache->SetLimits(m_MasterBlockSize, 0);
+    }
 
     VulkanDynamicHeap            (const VulkanDynamicHeap&) = delete;
     VulkanDynamicHeap            (VulkanDynamicHeap&&)      = delete;
@@ -222,15 +233,29 @@ public:
 
     size_t GetAllocatedMasterBlockCount() const { return m_MasterBlocks.size(); }
 
+    Uint32 GetMasterBlockSize() const { return m_MasterBlockSize; }
+
 private:
+    MasterBlock AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment);
+
+    void UpdateMasterBlockSize();
+
     VulkanDynamicMemoryManager& m_GlobalDynamicMemMgr;
     const std::string           m_HeapName;
 
+    // Free master blocks returned by the GPU that this heap can reuse without
+    // taking the global dynamic memory manager's lock.
+    const std::shared_ptr<VulkanDynamicMemoryManager::BlockCache> m_pBlockCache;
+
+    DeviceContextStats* const m_pStats;
+
     std::vector<MasterBlock> m_MasterBlocks;
 
     OffsetType   m_CurrOffset = InvalidOffset;
-    const Uint32 m_MasterBlockSize;
-    Uint32       m_AvailableSize = 0;
+    const Uint32 m_BaseMasterBlockSize;
+    // The master block size grows with the peak allocated size, see UpdateMasterBlockSize().
+    Uint32 m_MasterBlockSize;
+    Uint32 m_AvailableSize = 0;
 
     Uint32 m_CurrAlignedSize   = 0;
     Uint32 m_CurrUsedSize      = 0;
@@ -45,6 +45,7 @@ VkFormat    TypeToVkFormat(VALUE_TYPE ValType, Uint32 NumComponents, Bool bIsNor
 VkIndexType TypeToVkIndexType(VALUE_TYPE IndexType);
 
 VkPipelineRasterizationStateCreateInfo RasterizerStateDesc_To_VkRasterizationStateCI(const struct RasterizerStateDesc& RasterizerDesc);
+VkCullModeFlagBits                     CullModeToVkCullMode(CULL_MODE CullMode);
 VkPipelineDepthStencilStateCreateInfo  DepthStencilStateDesc_To_VkDepthStencilStateCI(const struct DepthStencilStateDesc& DepthStencilDesc);
 
 void BlendStateDesc_To_VkBlendStateCI(const struct BlendStateDesc&                      BSDesc,
@@ -131,4 +132,7 @@ VkPipelineRenderingCreateInfoKHR GraphicsPipelineDesc_To_VkPipelineRenderingCrea
 
 VkImageAspectFlags ComponentTypeToVkAspectMask(COMPONENT_TYPE ComponentType);
 
+// Returns the size of a descriptor of the given type in a descriptor buffer (VK_EXT_descriptor_buffer)
+size_t GetDescriptorBufferDescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props, VkDescriptorType Type);
+
 } // namespace Diligent
@@ -458,6 +458,172 @@ public:
         vkCmdSetBlendConstants(m_VkCmdBuffer, BlendConstants);
     }
 
+    // VK_EXT_extended_dynamic_state
+    __forceinline void SetCullMode(VkCullModeFlags CullMode)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetCullModeEXT(m_VkCmdBuffer, CullMode);
+#else
+        UNSUPPORTED("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthState(VkBool32 DepthTestEnable, VkBool32 DepthWriteEnable, VkCompareOp DepthCompareOp)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthTestEnableEXT(m_VkCmdBuffer, DepthTestEnable);
+        vkCmdSetDepthWriteEnableEXT(m_VkCmdBuffer, DepthWriteEnable);
+        vkCmdSetDepthCompareOpEXT(m_VkCmdBuffer, DepthCompareOp);
+#else
+        UNSUPPORTED("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPrimitiveTopology(VkPrimitiveTopology Topology)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPrimitiveTopologyEXT(m_VkCmdBuffer, Topology);
+#else
+        UNSUPPORTED("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    // VK_EXT_shader_object
+    __forceinline void BindShaders(uint32_t StageCount, const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdBindShadersEXT(m_VkCmdBuffer, StageCount, pStages, pShaders);
+        // Binding shader objects invalidates the graphics pipeline binding
+        m_State.GraphicsPipeline = VK_NULL_HANDLE;
+#else
+        UNSUPPORTED("Shader objects are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetViewportsWithCount(uint32_t ViewportCount, const VkViewport* pViewports)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetViewportWithCountEXT(m_VkCmdBuffer, ViewportCount, pViewports);
+#else
+        UNSUPPORTED("Shader objects are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetScissorRectsWithCount(uint32_t ScissorCount, const VkRect2D* pScissors)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetScissorWithCountEXT(m_VkCmdBuffer, ScissorCount, pScissors);
+#else
+        UNSUPPORTED("Shader objects are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    // Sets all rasterization states that are baked into the pipeline when shader objects are not used.
+    __forceinline void SetRasterizationState(const VkPipelineRasterizationStateCreateInfo& RasterizerCI, bool SetDepthClamp)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetRasterizerDiscardEnableEXT(m_VkCmdBuffer, RasterizerCI.rasterizerDiscardEnable);
+        vkCmdSetPolygonModeEXT(m_VkCmdBuffer, RasterizerCI.polygonMode);
+        vkCmdSetCullModeEXT(m_VkCmdBuffer, RasterizerCI.cullMode);
+        vkCmdSetFrontFaceEXT(m_VkCmdBuffer, RasterizerCI.frontFace);
+        vkCmdSetLineWidth(m_VkCmdBuffer, RasterizerCI.lineWidth);
+        vkCmdSetDepthBiasEnableEXT(m_VkCmdBuffer, RasterizerCI.depthBiasEnable);
+        vkCmdSetDepthBias(m_VkCmdBuffer, RasterizerCI.depthBiasConstantFactor, RasterizerCI.depthBiasClamp, RasterizerCI.depthBiasSlopeFactor);
+        if (SetDepthClamp)
+            vkCmdSetDepthClampEnableEXT(m_VkCmdBuffer, RasterizerCI.depthClampEnable);
+#else
+        UNSUPPORTED("Shader objects are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetMultisampleState(VkSampleCountFlagBits SampleCount, VkSampleMask SampleMask, VkBool32 AlphaToCoverageEnable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetRasterizationSamplesEXT(m_VkCmdBuffer, SampleCount);
+        vkCmdSetSampleMaskEXT(m_VkCmdBuffer, SampleCount, &SampleMask);
+        vkCmdSetAlphaToCoverageEnableEXT(m_VkCmdBuffer, AlphaToCoverageEnable);
+#else
+        UNSUPPORTED("Shader objects are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthStencilState(const VkPipelineDepthStencilStateCreateInfo& DepthStencilCI)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthTestEnableEXT(m_VkCmdBuffer, DepthStencilCI.depthTestEnable);
+        vkCmdSetDepthWriteEnableEXT(m_VkCmdBuffer, DepthStencilCI.depthWriteEnable);
+        vkCmdSetDepthCompareOpEXT(m_VkCmdBuffer, DepthStencilCI.depthCompareOp);
+        vkCmdSetDepthBoundsTestEnableEXT(m_VkCmdBuffer, DepthStencilCI.depthBoundsTestEnable);
+        vkCmdSetStencilTestEnableEXT(m_VkCmdBuffer, DepthStencilCI.stencilTestEnable);
+
+        const VkStencilOpState& Front = DepthStencilCI.front;
+        const VkStencilOpState& Back  = DepthStencilCI.back;
+        vkCmdSetStencilOpEXT(m_VkCmdBuffer, VK_STENCIL_FACE_FRONT_BIT, Front.failOp, Front.passOp, Front.depthFailOp, Front.compareOp);
+        vkCmdSetStencilOpEXT(m_VkCmdBuffer, VK_STENCIL_FACE_BACK_BIT, Back.failOp, Back.passOp, Back.depthFailOp, Back.compareOp);
+        vkCmdSetStencilCompareMask(m_VkCmdBuffer, VK_STENCIL_FACE_FRONT_BIT, Front.compareMask);
+        vkCmdSetStencilCompareMask(m_VkCmdBuffer, VK_STENCIL_FACE_BACK_BIT, Back.compareMask);
+        vkCmdSetStencilWriteMask(m_VkCmdBuffer, VK_STENCIL_FACE_FRONT_BIT, Front.writeMask);
+        vkCmdSetStencilWriteMask(m_VkCmdBuffer, VK_STENCIL_FACE_BACK_BIT, Back.writeMask);
+#else
+        UNSUPPORTED("Shader objects are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetColorBlendState(uint32_t                       AttachmentCount,
+                                          const VkBool32*                pBlendEnables,
+                                          const VkColorBlendEquationEXT* pBlendEquations,
+                                          const VkColorComponentFlags*   pWriteMasks)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        if (AttachmentCount == 0)
+            return;
+        vkCmdSetColorBlendEnableEXT(m_VkCmdBuffer, 0, AttachmentCount, pBlendEnables);
+        vkCmdSetColorBlendEquationEXT(m_VkCmdBuffer, 0, AttachmentCount, pBlendEquations);
+        vkCmdSetColorWriteMaskEXT(m_VkCmdBuffer, 0, AttachmentCount, pWriteMasks);
+#else
+        UNSUPPORTED("Shader objects are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetVertexInput(uint32_t                                   BindingCount,
+                                      const VkVertexInputBindingDescription2EXT*   pBindings,
+                                      uint32_t                                   AttributeCount,
+                                      const VkVertexInputAttributeDescription2EXT* pAttributes)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetVertexInputEXT(m_VkCmdBuffer, BindingCount, pBindings, AttributeCount, pAttributes);
+#else
+        UNSUPPORTED("Shader objects are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetInputAssemblyState(VkPrimitiveTopology Topology, VkBool32 PrimitiveRestartEnable, uint32_t PatchControlPoints)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPrimitiveTopologyEXT(m_VkCmdBuffer, Topology);
+        vkCmdSetPrimitiveRestartEnableEXT(m_VkCmdBuffer, PrimitiveRestartEnable);
+        if (Topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST)
+        {
+            vkCmdSetPatchControlPointsEXT(m_VkCmdBuffer, PatchControlPoints);
+            vkCmdSetTessellationDomainOriginEXT(m_VkCmdBuffer, VK_TESSELLATION_DOMAIN_ORIGIN_UPPER_LEFT);
+        }
+#else
+        UNSUPPORTED("Shader objects are not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void BindIndexBuffer(VkBuffer Buffer, VkDeviceSize Offset, VkIndexType IndexType)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
@@ -492,6 +658,28 @@ public:
                        VkPipelineStageFlags SrcStages,
                        VkPipelineStageFlags DestStages);
 
+    // Signals the event once all commands recorded so far complete the given stages.
+    // This is the first half of a split barrier.
+    void SetEvent(VkEvent Event, VkPipelineStageFlags StageMask);
+
+    // Waits for the event and performs the image layout transition.
+    // SrcStages must match the stage mask that was used to set the event.
+    void WaitEventImageLayout(VkEvent                        Event,
+                              VkImage                        Image,
+                              VkImageLayout                  OldLayout,
+                              VkImageLayout                  NewLayout,
+                              const VkImageSubresourceRange& SubresRange,
+                              VkPipelineStageFlags           SrcStages,
+                              VkPipelineStageFlags           DestStages);
+
+    // Waits for the event and executes the memory barrier.
+    // SrcStages must match the stage mask that was used to set the event.
+    void WaitEventMemoryBarrier(VkEvent              Event,
+                                VkAccessFlags        srcAccessMask,
+                                VkAccessFlags        dstAccessMask,
+                                VkPipelineStageFlags SrcStages,
+                                VkPipelineStageFlags DestStages);
+
     __forceinline void BindDescriptorSets(VkPipelineBindPoint    pipelineBindPoint,
                                           VkPipelineLayout       layout,
                                           uint32_t               firstSet,
@@ -504,6 +692,46 @@ public:
         vkCmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 
+    __forceinline void PushDescriptorSet(VkPipelineBindPoint         pipelineBindPoint,
+                                         VkPipelineLayout            layout,
+                                         uint32_t                    set,
+                                         uint32_t                    descriptorWriteCount,
+                                         const VkWriteDescriptorSet* pDescriptorWrites)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdPushDescriptorSetKHR(m_VkCmdBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+#else
+        UNSUPPORTED("PushDescriptorSet is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void BindDescriptorBuffers(uint32_t                                bufferCount,
+                                             const VkDescriptorBufferBindingInfoEXT* pBindingInfos)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdBindDescriptorBuffersEXT(m_VkCmdBuffer, bufferCount, pBindingInfos);
+#else
+        UNSUPPORTED("BindDescriptorBuffers is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDescriptorBufferOffsets(VkPipelineBindPoint pipelineBindPoint,
+                                                  VkPipelineLayout    layout,
+                                                  uint32_t            firstSet,
+                                                  uint32_t            setCount,
+                                                  const uint32_t*     pBufferIndices,
+                                                  const VkDeviceSize* pOffsets)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDescriptorBufferOffsetsEXT(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+#else
+        UNSUPPORTED("SetDescriptorBufferOffsets is not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void CopyBuffer(VkBuffer            srcBuffer,
                                   VkBuffer            dstBuffer,
                                   uint32_t            regionCount,
@@ -516,6 +744,20 @@ public:
         vkCmdCopyBuffer(m_VkCmdBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
 
+    __forceinline void UpdateBuffer(VkBuffer     dstBuffer,
+                                    VkDeviceSize dstOffset,
+                                    VkDeviceSize dataSize,
+                                    const void*  pData)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        // dstOffset and dataSize must be multiples of 4, dataSize must not exceed 65536
+        VERIFY_EXPR((dstOffset % 4) == 0 && (dataSize % 4) == 0 && dataSize <= 65536);
+        // Update buffer operation must be performed outside of render pass.
+        EndRenderScope();
+        FlushBarriers();
+        vkCmdUpdateBuffer(m_VkCmdBuffer, dstBuffer, dstOffset, dataSize, pData);
+    }
+
     __forceinline void CopyImage(VkImage            srcImage,
                                  VkImageLayout      srcImageLayout,
                                  VkImage            dstImage,
@@ -807,6 +1049,13 @@ public:
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_Barrier.SupportedStagesMask; }
     VkAccessFlags        GetSupportedAccessMask() const { return m_Barrier.SupportedAccessMask; }
 
+    // Makes FlushBarriers() use vkCmdPipelineBarrier2 (VK_KHR_synchronization2 must be enabled)
+    void SetUseSynchronization2(bool UseSync2) { m_UseSynchronization2 = UseSync2; }
+
+    // Sets the counter that is incremented every time a barrier batch is flushed.
+    // The counter is not affected by Reset().
+    void SetBarrierBatchCounter(uint32_t* pCounter) { m_pBarrierBatchCounter = pCounter; }
+
     struct StateCache
     {
         VkRenderPass  RenderPass           = VK_NULL_HANDLE;
@@ -829,6 +1078,8 @@ public:
     const StateCache& GetState() const { return m_State; }
 
 private:
+    void FlushBarriers2(VkPipelineStageFlags SrcStages, VkPipelineStageFlags DstStages, const VkMemoryBarrier* pMemBarrier);
+
     struct PipelineBarrier
     {
         VkPipelineStageFlags MemorySrcStages = 0;
@@ -848,6 +1099,12 @@ private:
     PipelineBarrier m_Barrier;
 
     std::vector<VkImageMemoryBarrier> m_ImageBarriers;
+
+    // Scratch space to convert image barriers when synchronization2 is used
+    std::vector<VkImageMemoryBarrier2KHR> m_ImageBarriers2;
+
+    bool      m_UseSynchronization2  = false;
+    uint32_t* m_pBarrierBatchCounter = nullptr;
 };
 
 } // namespace VulkanUtilities
@@ -38,6 +38,11 @@
 namespace VulkanUtilities
 {
 
+// If the pool is created with VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT flag, every
+// recycled command buffer is reset individually and may be reused right away.
+// Otherwise, recycled command buffers are only counted, and all buffers are reset at once
+// by ResetPool() when none of them is pending. In this mode, GetCommandBuffer() and ResetPool()
+// must be called from the same thread, while RecycleCommandBuffer() may be called from any thread.
 class CommandBufferPool
 {
 public:
@@ -54,10 +59,21 @@ public:
 
     ~CommandBufferPool();
 
-    VkCommandBuffer GetCommandBuffer(const char* DebugName = "");
+    // By default, command buffers are begun with VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT.
+    // Command buffers that are submitted multiple times should use VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT.
+    VkCommandBuffer GetCommandBuffer(const char* DebugName = "", VkCommandBufferUsageFlags UsageFlags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
     // The GPU must have finished with the command buffer being returned to the pool
     void RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer);
 
+    // Resets all command buffers with vkResetCommandPool if none of them is pending.
+    // Returns false if there are command buffers that have not been recycled.
+    bool ResetPool();
+
+    // Returns true if at least one command buffer has been requested since the last reset
+    bool IsInUse() const { return m_NumUsedCmdBuffers != 0; }
+
+    HardwareQueueIndex GetQueueFamilyIndex() const { return m_QueueFamilyIndex; }
+
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_SupportedStagesMask; }
     VkAccessFlags        GetSupportedAccessMask() const { return m_SupportedAccessMask; }
 
@@ -71,6 +87,16 @@ private:
     std::deque<VkCommandBuffer> m_CmdBuffers;
     const VkPipelineStageFlags  m_SupportedStagesMask;
     const VkAccessFlags         m_SupportedAccessMask;
+    const HardwareQueueIndex    m_QueueFamilyIndex;
+
+    // Whether the command buffers are reset all at once by ResetPool()
+    const bool m_ResetAsWhole;
+
+    // The number of command buffers from m_CmdBuffers handed out since the last reset (m_ResetAsWhole mode only)
+    size_t m_NumUsedCmdBuffers = 0;
+
+    // The number of command buffers that have not been recycled (m_ResetAsWhole mode only)
+    std::atomic<uint32_t> m_NumPendingCmdBuffers{0};
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<int32_t> m_BuffCounter{0};
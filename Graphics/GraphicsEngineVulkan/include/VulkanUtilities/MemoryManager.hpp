@@ -29,9 +29,11 @@
 
 #include <mutex>
 #include <array>
+#include <vector>
 #include <unordered_map>
 #include <atomic>
 #include <string>
+#include <algorithm>
 #include "MemoryAllocator.h"
 #include "VariableSizeAllocationsManager.hpp"
 #include "VulkanUtilities/PhysicalDevice.hpp"
@@ -101,6 +103,9 @@ struct MemoryAllocation
     VkDeviceSize Size            = 0;       // Reserved size of this allocation
 };
 
+// Memory page is either managed by the variable-size allocations manager, or, if SlabBlockSize
+// is not zero, is split into equal blocks of SlabBlockSize bytes (slab page).
+// Slab pages are used for small buffers to avoid the overhead of the variable-size allocations manager.
 class MemoryPage
 {
 public:
@@ -108,15 +113,19 @@ public:
                VkDeviceSize          PageSize,
                uint32_t              MemoryTypeIndex,
                bool                  IsHostVisible,
-               VkMemoryAllocateFlags AllocateFlags);
+               VkMemoryAllocateFlags AllocateFlags,
+               VkDeviceSize          SlabBlockSize = 0);
     ~MemoryPage();
 
     // clang-format off
     MemoryPage(MemoryPage&& rhs)noexcept :
-        m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
-        m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
-        m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
+        m_ParentMemoryMgr {rhs.m_ParentMemoryMgr           },
+        m_AllocationMgr   {std::move(rhs.m_AllocationMgr)  },
+        m_VkMemory        {std::move(rhs.m_VkMemory)       },
+        m_CPUMemory       {rhs.m_CPUMemory                 },
+        m_SlabBlockSize   {rhs.m_SlabBlockSize             },
+        m_NumSlabBlocks   {rhs.m_NumSlabBlocks             },
+        m_FreeSlabBlocks  {std::move(rhs.m_FreeSlabBlocks) }
     {
         rhs.m_CPUMemory = nullptr;
     }
@@ -125,10 +134,10 @@ public:
     MemoryPage& operator= (MemoryPage&)       = delete;
     MemoryPage& operator= (MemoryPage&& rhs)  = delete;
 
-    bool IsEmpty() const { return m_AllocationMgr.IsEmpty(); }
-    bool IsFull()  const { return m_AllocationMgr.IsFull();  }
+    bool IsEmpty() const { return m_SlabBlockSize != 0 ? m_FreeSlabBlocks.size() == m_NumSlabBlocks : m_AllocationMgr.IsEmpty(); }
+    bool IsFull()  const { return m_SlabBlockSize != 0 ? m_FreeSlabBlocks.empty() : m_AllocationMgr.IsFull();  }
     VkDeviceSize GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
-    VkDeviceSize GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
+    VkDeviceSize GetUsedSize() const { return m_SlabBlockSize != 0 ? (m_NumSlabBlocks - m_FreeSlabBlocks.size()) * m_SlabBlockSize : m_AllocationMgr.GetUsedSize(); }
 
     // clang-format on
 
@@ -150,6 +159,13 @@ private:
     Diligent::VariableSizeAllocationsManager m_AllocationMgr;
     VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
     void*                                    m_CPUMemory = nullptr;
+
+    // Slab page block size and the number of blocks, or zero if this is not a slab page
+    const VkDeviceSize m_SlabBlockSize;
+    const size_t       m_NumSlabBlocks;
+
+    // Indices of the free slab page blocks
+    std::vector<uint32_t> m_FreeSlabBlocks;
 };
 
 class MemoryManager
@@ -163,7 +179,8 @@ public:
                   VkDeviceSize                 DeviceLocalPageSize,
                   VkDeviceSize                 HostVisiblePageSize,
                   VkDeviceSize                 DeviceLocalReserveSize,
-                  VkDeviceSize                 HostVisibleReserveSize) :
+                  VkDeviceSize                 HostVisibleReserveSize,
+                  uint32_t                     BudgetUsageLimit = 0) :
         m_MgrName               {std::move(MgrName)    },
         m_LogicalDevice         {Device                },
         m_PhysicalDevice        {PhysDevice            },
@@ -171,7 +188,8 @@ public:
         m_DeviceLocalPageSize   {DeviceLocalPageSize   },
         m_HostVisiblePageSize   {HostVisiblePageSize   },
         m_DeviceLocalReserveSize{DeviceLocalReserveSize},
-        m_HostVisibleReserveSize{HostVisibleReserveSize}
+        m_HostVisibleReserveSize{HostVisibleReserveSize},
+        m_BudgetUsageLimit      {std::min(BudgetUsageLimit, 100u)}
     {}
 
 
@@ -189,6 +207,7 @@ public:
         m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
         m_DeviceLocalReserveSize {rhs.m_DeviceLocalReserveSize},
         m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
+        m_BudgetUsageLimit       {rhs.m_BudgetUsageLimit      },
 
         //m_CurrUsedSize      {rhs.m_CurrUsedSize},
         m_PeakUsedSize      {rhs.m_PeakUsedSize     },
@@ -208,10 +227,31 @@ public:
     MemoryManager& operator= (MemoryManager&&)      = delete;
     // clang-format on
 
-    MemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags);
+    // Small allocations are suballocated from slab pages if AllowSlab is true.
+    // Slab pages must only contain buffers to avoid bufferImageGranularity issues.
+    MemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, bool AllowSlab = false);
     MemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
     void             ShrinkMemory();
 
+    // Slab pages are split into blocks of power-of-two size in the [MinSlabBlockSize, MaxSlabBlockSize] range.
+    static constexpr VkDeviceSize MinSlabBlockSize = 256;
+    static constexpr VkDeviceSize MaxSlabBlockSize = 64 << 10;
+
+    struct HeapUsage
+    {
+        // Heap budget and usage reported by VK_EXT_memory_budget extension.
+        // If the extension is not enabled, the budget is the heap size, and the usage is AllocatedSize.
+        VkDeviceSize Budget = 0;
+        VkDeviceSize Usage  = 0;
+
+        // The total size of the pages allocated from the heap.
+        VkDeviceSize AllocatedSize = 0;
+
+        // The total size of the allocations in the pages.
+        VkDeviceSize UsedSize = 0;
+    };
+    HeapUsage GetHeapUsage(uint32_t HeapIndex) const;
+
 protected:
     friend class MemoryPage;
 
@@ -225,27 +265,31 @@ protected:
 
     Diligent::IMemoryAllocator& m_Allocator;
 
-    std::mutex m_PagesMtx;
+    mutable std::mutex m_PagesMtx;
     struct MemoryPageIndex
     {
         const uint32_t              MemoryTypeIndex;
         const VkMemoryAllocateFlags AllocateFlags;
         const bool                  IsHostVisible;
+        const VkDeviceSize          SlabBlockSize;
 
         // clang-format off
         MemoryPageIndex(uint32_t              _MemoryTypeIndex,
                         bool                  _IsHostVisible,
-                        VkMemoryAllocateFlags _AllocateFlags) :
+                        VkMemoryAllocateFlags _AllocateFlags,
+                        VkDeviceSize          _SlabBlockSize) :
             MemoryTypeIndex{_MemoryTypeIndex},
             AllocateFlags  {_AllocateFlags},
-            IsHostVisible  {_IsHostVisible}
+            IsHostVisible  {_IsHostVisible},
+            SlabBlockSize  {_SlabBlockSize}
         {}
 
         bool operator == (const MemoryPageIndex& rhs)const
         {
             return MemoryTypeIndex == rhs.MemoryTypeIndex &&
                    AllocateFlags   == rhs.AllocateFlags   &&
-                   IsHostVisible   == rhs.IsHostVisible;
+                   IsHostVisible   == rhs.IsHostVisible   &&
+                   SlabBlockSize   == rhs.SlabBlockSize;
         }
         // clang-format on
 
@@ -253,19 +297,28 @@ protected:
         {
             size_t operator()(const MemoryPageIndex& PageIndex) const
             {
-                return Diligent::ComputeHash(PageIndex.MemoryTypeIndex, PageIndex.AllocateFlags, PageIndex.IsHostVisible);
+                return Diligent::ComputeHash(PageIndex.MemoryTypeIndex, PageIndex.AllocateFlags, PageIndex.IsHostVisible, PageIndex.SlabBlockSize);
             }
         };
     };
-    std::unordered_multimap<MemoryPageIndex, MemoryPage, MemoryPageIndex::Hasher> m_Pages;
+    using PagesMapType = std::unordered_multimap<MemoryPageIndex, MemoryPage, MemoryPageIndex::Hasher>;
+    PagesMapType m_Pages;
 
     const VkDeviceSize m_DeviceLocalPageSize;
     const VkDeviceSize m_HostVisiblePageSize;
     const VkDeviceSize m_DeviceLocalReserveSize;
     const VkDeviceSize m_HostVisibleReserveSize;
 
+    // Percentage of the heap budget that the manager may use. 0 disables the budget check.
+    const uint32_t m_BudgetUsageLimit;
+
     void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible);
 
+    // The following methods must be called with m_PagesMtx locked
+    bool IsWithinBudget(uint32_t HeapIndex, VkDeviceSize NewPageSize) const;
+    void ReleaseFreePages(uint32_t HeapIndex);
+    void DestroyPage(PagesMapType::iterator page_it);
+
     // 0 == Device local, 1 == Host-visible
     std::array<std::atomic<int64_t>, 2> m_CurrUsedSize      = {};
     std::array<VkDeviceSize, 2>         m_PeakUsedSize      = {};
@@ -67,6 +67,19 @@ DILIGENT_BEGIN_INTERFACE(IBufferVk, IBuffer)
 
     /// Returns a Vulkan device address of the internal buffer object.
     VIRTUAL VkDeviceAddress METHOD(GetVkDeviceAddress)(THIS) CONST PURE;
+
+    /// Exports the buffer memory to other APIs or processes.
+
+    /// \param [out] Handle     - Memory handle: a POSIX file descriptor or an NT handle on Windows.
+    /// \param [out] MemorySize - Size of the memory allocation, in bytes.
+    ///
+    /// \return     True if the handle has been exported, and false otherwise.
+    ///
+    /// \remarks    The buffer must be created with Diligent::MISC_BUFFER_FLAG_EXPORTABLE flag.
+    ///             The caller owns the returned handle, see ITextureVk::ExportMemoryHandle().
+    VIRTUAL Bool METHOD(ExportMemoryHandle)(THIS_
+                                            Uint64 REF Handle,
+                                            Uint64 REF MemorySize) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -78,6 +91,7 @@ DILIGENT_END_INTERFACE
 #    define IBufferVk_SetAccessFlags(This, ...) CALL_IFACE_METHOD(BufferVk, SetAccessFlags, This, __VA_ARGS__)
 #    define IBufferVk_GetAccessFlags(This)      CALL_IFACE_METHOD(BufferVk, GetAccessFlags, This)
 #    define IBufferVk_GetVkDeviceAddress(This)  CALL_IFACE_METHOD(BufferVk, GetVkDeviceAddress, This)
+#    define IBufferVk_ExportMemoryHandle(This, ...) CALL_IFACE_METHOD(BufferVk, ExportMemoryHandle, This, __VA_ARGS__)
 
 #endif
 
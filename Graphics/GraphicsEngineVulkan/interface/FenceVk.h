@@ -52,6 +52,19 @@ DILIGENT_BEGIN_INTERFACE(IFenceVk, IFence)
 {
     /// If timeline semaphores are supported, returns the semaphore object; otherwise returns VK_NULL_HANDLE.
     VIRTUAL VkSemaphore METHOD(GetVkSemaphore)(THIS) PURE;
+
+    /// Exports the timeline semaphore to other APIs or processes.
+
+    /// \param [out] Handle - Semaphore handle: a POSIX file descriptor (VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT)
+    ///                       or an NT handle on Windows (VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_WIN32_BIT).
+    ///
+    /// \return     True if the handle has been exported, and false otherwise.
+    ///
+    /// \remarks    The fence must be created with Diligent::MISC_FENCE_FLAG_EXPORTABLE flag.
+    ///             The caller owns the returned handle. The imported semaphore shares the payload
+    ///             with the fence, so the external API may wait for or signal the fence values.
+    VIRTUAL Bool METHOD(ExportSemaphoreHandle)(THIS_
+                                               Uint64 REF Handle) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -61,7 +74,8 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IFenceVk_GetVkSemaphore(This)    CALL_IFACE_METHOD(FenceVk, GetVkSemaphore, This)
+#    define IFenceVk_GetVkSemaphore(This)           CALL_IFACE_METHOD(FenceVk, GetVkSemaphore, This)
+#    define IFenceVk_ExportSemaphoreHandle(This, ...) CALL_IFACE_METHOD(FenceVk, ExportSemaphoreHandle, This, __VA_ARGS__)
 
 // clang-format on
 
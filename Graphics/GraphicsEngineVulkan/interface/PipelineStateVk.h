@@ -53,6 +53,9 @@ DILIGENT_BEGIN_INTERFACE(IPipelineStateVk, IPipelineState)
     VIRTUAL IRenderPassVk* METHOD(GetRenderPass)(THIS) CONST PURE;
 
     /// Returns a Vulkan handle of the internal pipeline state object.
+
+    /// If the device uses shader objects (see DeviceFeaturesVk::ShaderObject), graphics pipelines
+    /// that do not use explicit render passes have no Vulkan pipeline, and the method returns VK_NULL_HANDLE.
     VIRTUAL VkPipeline METHOD(GetVkPipeline)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
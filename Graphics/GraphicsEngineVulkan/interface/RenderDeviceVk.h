@@ -47,6 +47,36 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceVk =
 
 // clang-format off
 
+/// This structure is returned by IRenderDeviceVk::GetMemoryHeapUsage()
+struct MemoryHeapUsageVk
+{
+    /// Memory heap flags, see VkMemoryHeapFlags.
+    VkMemoryHeapFlags Flags         DEFAULT_INITIALIZER(0);
+
+    /// Total size of the heap, in bytes.
+    VkDeviceSize      HeapSize      DEFAULT_INITIALIZER(0);
+
+    /// The amount of memory the process can use from the heap, in bytes.
+
+    /// If VK_EXT_memory_budget extension is not supported, this value is equal to HeapSize.
+    VkDeviceSize      Budget        DEFAULT_INITIALIZER(0);
+
+    /// The amount of memory currently used by the process from the heap, in bytes.
+
+    /// If VK_EXT_memory_budget extension is not supported, this value is equal to AllocatedSize.
+    VkDeviceSize      Usage         DEFAULT_INITIALIZER(0);
+
+    /// The size of the memory pages allocated by the engine from the heap, in bytes.
+    VkDeviceSize      AllocatedSize DEFAULT_INITIALIZER(0);
+
+    /// The size of the memory used by resources in the pages allocated by the engine, in bytes.
+
+    /// The difference between AllocatedSize and UsedSize is the amount of memory that
+    /// is either reserved or lost to fragmentation.
+    VkDeviceSize      UsedSize      DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryHeapUsageVk MemoryHeapUsageVk;
+
 /// Exposes Vulkan-specific functionality of a render device.
 DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
 {
@@ -169,6 +199,20 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
 
     /// Returns DX compiler interface, or null if the compiler is not loaded.
     VIRTUAL struct IDXCompiler* METHOD(GetDXCompiler)(THIS) CONST PURE;
+
+    /// Returns the number of Vulkan memory heaps of the physical device.
+    VIRTUAL Uint32 METHOD(GetMemoryHeapCount)(THIS) CONST PURE;
+
+    /// Returns the usage of the specified memory heap, see Diligent::MemoryHeapUsageVk.
+
+    /// \param [in]  HeapIndex - Memory heap index, must be less than the value returned by GetMemoryHeapCount().
+    /// \param [out] Usage     - Memory heap usage.
+    ///
+    /// \note  The usage is queried while other threads may be allocating or releasing memory,
+    ///        and is thus only approximate in this case.
+    VIRTUAL void METHOD(GetMemoryHeapUsage)(THIS_
+                                            Uint32                HeapIndex,
+                                            MemoryHeapUsageVk REF Usage) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -188,6 +232,8 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
 #    define IRenderDeviceVk_GetDeviceFeaturesVk(This, ...)            CALL_IFACE_METHOD(RenderDeviceVk, GetDeviceFeaturesVk,            This, __VA_ARGS__)
 #    define IRenderDeviceVk_GetDXCompiler(This)                       CALL_IFACE_METHOD(RenderDeviceVk, GetDXCompiler,                  This)
+#    define IRenderDeviceVk_GetMemoryHeapCount(This)                  CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryHeapCount,             This)
+#    define IRenderDeviceVk_GetMemoryHeapUsage(This, ...)             CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryHeapUsage,             This, __VA_ARGS__)
 
 // clang-format on
 
@@ -66,6 +66,47 @@ DILIGENT_BEGIN_INTERFACE(ITextureVk, ITexture)
 
     /// Returns current Vulkan image layout. If the state is unknown to the engine, returns VK_IMAGE_LAYOUT_UNDEFINED
     VIRTUAL VkImageLayout METHOD(GetLayout)(THIS) CONST PURE;
+
+    /// Copies data from host memory to a texture subresource using VK_EXT_host_image_copy,
+    /// without staging memory and command buffers.
+
+    /// \param [in] MipLevel   - Mip level of the subresource to update.
+    /// \param [in] Slice      - Array slice of the subresource to update. Must be 0 for non-array textures.
+    /// \param [in] DstBox     - Destination region in the subresource.
+    /// \param [in] SubresData - Source data in CPU memory; pSrcBuffer must be null.
+    ///
+    /// \return     True if the data has been copied, and false if the texture can't be updated on the host.
+    ///             In the latter case, the application should use IDeviceContext::UpdateTexture().
+    ///
+    /// \remarks    Host updates are available for textures with USAGE_DEFAULT usage and BIND_SHADER_RESOURCE bind flag
+    ///             when the HostImageCopy Vulkan feature is enabled and the device is either UMA or has the
+    ///             GPUUploadMemory feature enabled. The texture must be either new (in RESOURCE_STATE_UNDEFINED state)
+    ///             or in RESOURCE_STATE_SHADER_RESOURCE state.
+    ///
+    ///             The method may be called from any thread, for example to stream mip levels from worker threads.
+    ///             The data is copied immediately, so the application must make sure that the GPU does not access
+    ///             the updated region, and that no device context changes the texture state at the same time.
+    VIRTUAL Bool METHOD(UpdateSubresourceOnHost)(THIS_
+                                                 Uint32                       MipLevel,
+                                                 Uint32                       Slice,
+                                                 const Box REF                DstBox,
+                                                 const TextureSubResData REF  SubresData) PURE;
+
+    /// Exports the texture memory to other APIs or processes.
+
+    /// \param [out] Handle     - Memory handle: a POSIX file descriptor (VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT)
+    ///                           or an NT handle on Windows (VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_BIT).
+    /// \param [out] MemorySize - Size of the memory allocation, in bytes.
+    ///
+    /// \return     True if the handle has been exported, and false otherwise.
+    ///
+    /// \remarks    The texture must be created with Diligent::MISC_TEXTURE_FLAG_EXPORTABLE flag.
+    ///             Every call returns a new handle that is owned by the caller. The importing API
+    ///             (e.g. cudaImportExternalMemory) typically takes the ownership of the file descriptor;
+    ///             NT handles must be closed with CloseHandle.
+    VIRTUAL Bool METHOD(ExportMemoryHandle)(THIS_
+                                            Uint64 REF Handle,
+                                            Uint64 REF MemorySize) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -78,6 +119,8 @@ DILIGENT_END_INTERFACE
 #    define ITextureVk_GetVkImage(This)     CALL_IFACE_METHOD(TextureVk, GetVkImage,This)
 #    define ITextureVk_SetLayout(This, ...) CALL_IFACE_METHOD(TextureVk, SetLayout, This, __VA_ARGS__)
 #    define ITextureVk_GetLayout(This)      CALL_IFACE_METHOD(TextureVk, GetLayout, This)
+#    define ITextureVk_UpdateSubresourceOnHost(This, ...) CALL_IFACE_METHOD(TextureVk, UpdateSubresourceOnHost, This, __VA_ARGS__)
+#    define ITextureVk_ExportMemoryHandle(This, ...)      CALL_IFACE_METHOD(TextureVk, ExportMemoryHandle, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -29,6 +29,7 @@
 #include "BufferVkImpl.hpp"
 #include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
+#include "DeviceMemoryVkImpl.hpp"
 #include "VulkanTypeConversions.hpp"
 #include "BufferViewVkImpl.hpp"
 #include "GraphicsAccessories.hpp"
@@ -40,67 +41,55 @@
 namespace Diligent
 {
 
-BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
-                           FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
-                           RenderDeviceVkImpl*        pRenderDeviceVk,
-                           const BufferDesc&          BuffDesc,
-                           const BufferData*          pBuffData /*= nullptr*/) :
-    TBufferBase{
-        pRefCounters,
-        BuffViewObjMemAllocator,
-        pRenderDeviceVk,
-        BuffDesc,
-        false,
-    }
+VkBufferCreateInfo BufferVkImpl::GetVkBufferCreateInfo(const BufferDesc&         BuffDesc,
+                                                       const RenderDeviceVkImpl* pDevice,
+                                                       Uint32&                   DynamicOffsetAlignment,
+                                                       bool&                     RequiresBackingBuffer)
 {
-    ValidateBufferInitData(m_Desc, pBuffData);
-
-    const VulkanUtilities::LogicalDevice&  LogicalDevice  = pRenderDeviceVk->GetLogicalDevice();
-    const VulkanUtilities::PhysicalDevice& PhysicalDevice = pRenderDeviceVk->GetPhysicalDevice();
-    const VkPhysicalDeviceLimits&          DeviceLimits   = PhysicalDevice.GetProperties().limits;
+    const VkPhysicalDeviceLimits& DeviceLimits = pDevice->GetPhysicalDevice().GetProperties().limits;
 
-    m_DynamicOffsetAlignment = std::max(Uint32{4}, static_cast<Uint32>(DeviceLimits.optimalBufferCopyOffsetAlignment));
+    DynamicOffsetAlignment = std::max(Uint32{4}, static_cast<Uint32>(DeviceLimits.optimalBufferCopyOffsetAlignment));
 
     VkBufferCreateInfo VkBuffCI{};
     VkBuffCI.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     VkBuffCI.pNext = nullptr;
     VkBuffCI.flags = 0; // VK_BUFFER_CREATE_SPARSE_BINDING_BIT, VK_BUFFER_CREATE_SPARSE_RESIDENCY_BIT, VK_BUFFER_CREATE_SPARSE_ALIASED_BIT
-    VkBuffCI.size  = m_Desc.Size;
+    VkBuffCI.size  = BuffDesc.Size;
     VkBuffCI.usage =
         VK_BUFFER_USAGE_TRANSFER_SRC_BIT | // The buffer can be used as the source of a transfer command
         VK_BUFFER_USAGE_TRANSFER_DST_BIT;  // The buffer can be used as the destination of a transfer command
 
     static_assert(BIND_FLAG_LAST == 0x800, "Please update this function to handle the new bind flags");
 
-    for (BIND_FLAGS BindFlags = m_Desc.BindFlags; BindFlags != 0;)
+    for (BIND_FLAGS BindFlags = BuffDesc.BindFlags; BindFlags != 0;)
     {
         BIND_FLAGS BindFlag = ExtractLSB(BindFlags);
         switch (BindFlag)
         {
             case BIND_SHADER_RESOURCE:
             {
-                if (m_Desc.Mode == BUFFER_MODE_FORMATTED)
+                if (BuffDesc.Mode == BUFFER_MODE_FORMATTED)
                 {
                     // Formatted buffers are mapped to uniform texel buffers in Vulkan.
                     VkBuffCI.usage |= VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT;
-                    m_DynamicOffsetAlignment = std::max(m_DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minTexelBufferOffsetAlignment));
+                    DynamicOffsetAlignment = std::max(DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minTexelBufferOffsetAlignment));
                 }
                 else
                 {
                     // Structured and ByteAddress buffers are mapped to read-only storage buffers in Vulkan.
                     VkBuffCI.usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-                    m_DynamicOffsetAlignment = std::max(m_DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minStorageBufferOffsetAlignment));
+                    DynamicOffsetAlignment = std::max(DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minStorageBufferOffsetAlignment));
                 }
 
                 break;
             }
             case BIND_UNORDERED_ACCESS:
             {
-                if (m_Desc.Mode == BUFFER_MODE_FORMATTED)
+                if (BuffDesc.Mode == BUFFER_MODE_FORMATTED)
                 {
                     // RW formatted buffers are mapped to storage texel buffers in Vulkan.
                     VkBuffCI.usage |= VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
-                    m_DynamicOffsetAlignment = std::max(m_DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minTexelBufferOffsetAlignment));
+                    DynamicOffsetAlignment = std::max(DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minTexelBufferOffsetAlignment));
                 }
                 else
                 {
@@ -109,7 +98,7 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
                     // Each element of pDynamicOffsets of vkCmdBindDescriptorSets function which corresponds to a descriptor
                     // binding with type VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC must be a multiple of
                     // VkPhysicalDeviceLimits::minStorageBufferOffsetAlignment (13.2.5)
-                    m_DynamicOffsetAlignment = std::max(m_DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minStorageBufferOffsetAlignment));
+                    DynamicOffsetAlignment = std::max(DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minStorageBufferOffsetAlignment));
                 }
 
                 break;
@@ -136,7 +125,7 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
                 // Each element of pDynamicOffsets parameter of vkCmdBindDescriptorSets function which corresponds to a descriptor
                 // binding with type VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC must be a multiple of
                 // VkPhysicalDeviceLimits::minUniformBufferOffsetAlignment (13.2.5)
-                m_DynamicOffsetAlignment = std::max(m_DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minUniformBufferOffsetAlignment));
+                DynamicOffsetAlignment = std::max(DynamicOffsetAlignment, static_cast<Uint32>(DeviceLimits.minUniformBufferOffsetAlignment));
                 break;
             }
             case BIND_RAY_TRACING:
@@ -158,6 +147,82 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
     VkBuffCI.pQueueFamilyIndices   = nullptr;                   // The list of queue families that will access this buffer
                                                                 // (ignored if sharingMode is not VK_SHARING_MODE_CONCURRENT).
 
+    constexpr VkBufferUsageFlags UsageThatRequiresBackingBuffer =
+        VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT |
+        VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+        VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    RequiresBackingBuffer =
+        (VkBuffCI.usage & UsageThatRequiresBackingBuffer) != 0 ||
+        // We only need a backing buffer for the storage buffer if there is an unordered access bind flag (aka RW structured buffers).
+        // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
+        ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (BuffDesc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
+
+    constexpr VkBufferUsageFlags DescriptorUsage =
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+        VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT |
+        VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT;
+    if (pDevice->UseDescriptorBuffers() && (VkBuffCI.usage & DescriptorUsage) != 0)
+    {
+        // When descriptor buffers are used, buffer descriptors are created from the device addresses.
+        // Note that dynamic buffers without a backing buffer are suballocated from the dynamic heap
+        // that has its own device address.
+        VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
+    return VkBuffCI;
+}
+
+static VkDeviceSize GetPlacedBufferAlignment(const BufferDesc& BuffDesc, const VulkanUtilities::PhysicalDevice& PhysicalDevice, const VkMemoryRequirements& MemReqs)
+{
+    VkDeviceSize RequiredAlignment = MemReqs.alignment;
+    if ((BuffDesc.BindFlags & BIND_RAY_TRACING) != 0)
+    {
+        // See the comment in the BufferVkImpl constructor
+        const VkDeviceSize ReadOnlyRTBufferAlign = 16u;
+        const VkDeviceSize ScratchBufferAlign    = PhysicalDevice.GetExtProperties().AccelStruct.minAccelerationStructureScratchOffsetAlignment;
+        RequiredAlignment                        = std::max(RequiredAlignment, std::max(ScratchBufferAlign, ReadOnlyRTBufferAlign));
+    }
+    return RequiredAlignment;
+}
+
+ResourceMemoryRequirements BufferVkImpl::GetPlacedMemoryRequirements(const BufferDesc& BuffDesc, const RenderDeviceVkImpl* pDevice)
+{
+    Uint32                   DynamicOffsetAlignment = 0;
+    bool                     RequiresBackingBuffer  = false;
+    const VkBufferCreateInfo VkBuffCI               = GetVkBufferCreateInfo(BuffDesc, pDevice, DynamicOffsetAlignment, RequiresBackingBuffer);
+
+    // Memory requirements can't be queried without creating a buffer unless VK_KHR_maintenance4 is available
+    const VulkanUtilities::LogicalDevice& LogicalDevice = pDevice->GetLogicalDevice();
+    const VulkanUtilities::BufferWrapper  vkBuffer      = LogicalDevice.CreateBuffer(VkBuffCI, "Temporary buffer to query memory requirements");
+    const VkMemoryRequirements            MemReqs       = LogicalDevice.GetBufferMemoryRequirements(vkBuffer);
+
+    return {MemReqs.size, GetPlacedBufferAlignment(BuffDesc, pDevice->GetPhysicalDevice(), MemReqs)};
+}
+
+BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
+                           FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                           RenderDeviceVkImpl*        pRenderDeviceVk,
+                           const BufferDesc&          BuffDesc,
+                           const BufferData*          pBuffData /*= nullptr*/) :
+    TBufferBase{
+        pRefCounters,
+        BuffViewObjMemAllocator,
+        pRenderDeviceVk,
+        BuffDesc,
+        false,
+    }
+{
+    ValidateBufferInitData(m_Desc, pBuffData);
+
+    const VulkanUtilities::LogicalDevice&  LogicalDevice  = pRenderDeviceVk->GetLogicalDevice();
+    const VulkanUtilities::PhysicalDevice& PhysicalDevice = pRenderDeviceVk->GetPhysicalDevice();
+    const VkPhysicalDeviceLimits&          DeviceLimits   = PhysicalDevice.GetProperties().limits;
+
+    bool               RequiresBackingBuffer = false;
+    VkBufferCreateInfo VkBuffCI              = GetVkBufferCreateInfo(m_Desc, pRenderDeviceVk, m_DynamicOffsetAlignment, RequiresBackingBuffer);
+
     const std::vector<uint32_t> QueueFamilyIndices = PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) > 1 ?
         GetDevice()->ConvertCmdQueueIdsToQueueFamilies(m_Desc.ImmediateContextMask) :
         std::vector<uint32_t>{};
@@ -169,17 +234,6 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         VkBuffCI.queueFamilyIndexCount = static_cast<uint32_t>(QueueFamilyIndices.size());
     }
 
-    constexpr VkBufferUsageFlags UsageThatRequiresBackingBuffer =
-        VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT |
-        VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
-        VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
-
-    const bool RequiresBackingBuffer =
-        (VkBuffCI.usage & UsageThatRequiresBackingBuffer) != 0 ||
-        // We only need a backing buffer for the storage buffer if there is an unordered access bind flag (aka RW structured buffers).
-        // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
-        ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
-
     if (m_Desc.Usage == USAGE_SPARSE)
     {
         VkBuffCI.flags =
@@ -227,6 +281,18 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         VERIFY(m_Desc.Usage != USAGE_DYNAMIC || PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) <= 1,
                "ImmediateContextMask must contain single set bit, this error should've been handled in ValidateBufferDesc()");
 
+        const bool IsExportable = (m_Desc.MiscFlags & MISC_BUFFER_FLAG_EXPORTABLE) != 0;
+        VERIFY(!IsExportable || m_Desc.Usage == USAGE_DEFAULT, "Exportable buffers must use USAGE_DEFAULT, this error should've been handled in ValidateBufferDesc()");
+
+        VkExternalMemoryBufferCreateInfo ExternalMemoryCI{};
+        if (IsExportable)
+        {
+            ExternalMemoryCI.sType       = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+            ExternalMemoryCI.pNext       = VkBuffCI.pNext;
+            ExternalMemoryCI.handleTypes = VulkanUtilities::ExternalMemoryHandleType;
+            VkBuffCI.pNext               = &ExternalMemoryCI;
+        }
+
         m_VulkanBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
 
         VkMemoryRequirements MemReqs = LogicalDevice.GetBufferMemoryRequirements(m_VulkanBuffer);
@@ -307,14 +373,47 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         }
 
         VERIFY(IsPowerOfTwo(RequiredAlignment), "Alignment is not power of 2!");
-        m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags);
-        if (!m_MemoryAllocation)
-            LOG_ERROR_AND_THROW("Failed to allocate memory for buffer '", m_Desc.Name, "'.");
-
-        m_BufferMemoryAlignedOffset = AlignUp(VkDeviceSize{m_MemoryAllocation.UnalignedOffset}, RequiredAlignment);
-        VERIFY(m_MemoryAllocation.Size >= MemReqs.size + (m_BufferMemoryAlignedOffset - m_MemoryAllocation.UnalignedOffset), "Size of memory allocation is too small");
-        VkDeviceMemory Memory = m_MemoryAllocation.Page->GetVkMemory();
-        VkResult       err    = LogicalDevice.BindBufferMemory(m_VulkanBuffer, Memory, m_BufferMemoryAlignedOffset);
+        VkResult err = VK_SUCCESS;
+        if (IsExportable)
+        {
+            // Exported memory must not be shared with other resources, so the buffer gets its own allocation.
+            VkExportMemoryAllocateInfo ExportAllocInfo{};
+            ExportAllocInfo.sType       = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+            ExportAllocInfo.handleTypes = VulkanUtilities::ExternalMemoryHandleType;
+
+            VkMemoryDedicatedAllocateInfo DedicatedAllocInfo{};
+            DedicatedAllocInfo.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+            DedicatedAllocInfo.pNext  = &ExportAllocInfo;
+            DedicatedAllocInfo.buffer = m_VulkanBuffer;
+
+            VkMemoryAllocateFlagsInfo AllocFlagsInfo{};
+            AllocFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+            AllocFlagsInfo.pNext = &DedicatedAllocInfo;
+            AllocFlagsInfo.flags = AllocateFlags;
+
+            VkMemoryAllocateInfo MemAllocInfo{};
+            MemAllocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+            MemAllocInfo.pNext           = AllocateFlags != 0 ? static_cast<const void*>(&AllocFlagsInfo) : &DedicatedAllocInfo;
+            MemAllocInfo.allocationSize  = MemReqs.size;
+            MemAllocInfo.memoryTypeIndex = MemoryTypeIndex;
+
+            m_DedicatedMemory = LogicalDevice.AllocateDeviceMemory(MemAllocInfo, m_Desc.Name);
+
+            m_BufferMemoryAlignedOffset = 0;
+            err                         = LogicalDevice.BindBufferMemory(m_VulkanBuffer, m_DedicatedMemory, 0);
+        }
+        else
+        {
+            // Small buffers are suballocated from slab pages, see VulkanUtilities::MemoryManager::Allocate().
+            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags, /*AllowSlab = */ true);
+            if (!m_MemoryAllocation)
+                LOG_ERROR_AND_THROW("Failed to allocate memory for buffer '", m_Desc.Name, "'.");
+
+            m_BufferMemoryAlignedOffset = AlignUp(VkDeviceSize{m_MemoryAllocation.UnalignedOffset}, RequiredAlignment);
+            VERIFY(m_MemoryAllocation.Size >= MemReqs.size + (m_BufferMemoryAlignedOffset - m_MemoryAllocation.UnalignedOffset), "Size of memory allocation is too small");
+            VkDeviceMemory Memory = m_MemoryAllocation.Page->GetVkMemory();
+            err                   = LogicalDevice.BindBufferMemory(m_VulkanBuffer, Memory, m_BufferMemoryAlignedOffset);
+        }
         CHECK_VK_ERROR_AND_THROW(err, "Failed to bind buffer memory");
 
         VERIFY(!AlignToNonCoherentAtomSize || (m_BufferMemoryAlignedOffset + MemReqs.size) % DeviceLimits.nonCoherentAtomSize == 0, "End offset is not properly aligned");
@@ -340,7 +439,8 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
             const VkPhysicalDeviceMemoryProperties& MemoryProps = PhysicalDevice.GetMemoryProperties();
             VERIFY_EXPR(MemoryTypeIndex < MemoryProps.memoryTypeCount);
             const VkMemoryPropertyFlags MemoryPropFlags = MemoryProps.memoryTypes[MemoryTypeIndex].propertyFlags;
-            if ((MemoryPropFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0)
+            // Dedicated memory of exportable buffers is not mapped
+            if ((MemoryPropFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0 && !IsExportable)
             {
                 // Memory is directly accessible by CPU
                 uint8_t* pData = reinterpret_cast<uint8_t*>(m_MemoryAllocation.Page->GetCPUMemory());
@@ -389,53 +489,28 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
                     ClassPtrCast<DeviceContextVkImpl>(pBuffData->pContext)->GetCommandQueueId() :
                     SoftwareQueueIndex{PlatformMisc::GetLSB(m_Desc.ImmediateContextMask)};
 
-                VulkanUtilities::CommandPoolWrapper CmdPool;
-                VulkanUtilities::CommandBuffer      CmdBuffer;
-                pRenderDeviceVk->AllocateTransientCmdPool(CmdQueueInd, CmdPool, CmdBuffer, "Transient command pool to copy staging data to a device buffer");
-
-                CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-                InitialState              = RESOURCE_STATE_COPY_DEST;
-                VkAccessFlags AccessFlags = ResourceStateFlagsToVkAccessFlags(InitialState);
-                VERIFY_EXPR(AccessFlags == VK_ACCESS_TRANSFER_WRITE_BIT);
-                CmdBuffer.MemoryBarrier(0, AccessFlags, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-                // Copy commands MUST be recorded outside of a render pass instance. This is OK here
-                // as copy will be the only command in the cmd buffer
-                VkBufferCopy BuffCopy{};
-                BuffCopy.srcOffset = 0;
-                BuffCopy.dstOffset = 0;
-                BuffCopy.size      = VkBuffCI.size;
-                CmdBuffer.CopyBuffer(StagingBuffer, m_VulkanBuffer, 1, &BuffCopy);
-
-                pRenderDeviceVk->ExecuteAndDisposeTransientCmdBuff(CmdQueueInd, CmdBuffer.GetVkCmdBuffer(), std::move(CmdPool));
-
-
-                // After command buffer is submitted, safe-release staging resources. This strategy
-                // is little overconservative as the resources will only be released after the
-                // first command buffer submitted through the immediate context is complete
-
-                // Next Cmd Buff| Next Fence |               This Thread                      |           Immediate Context
-                //              |            |                                                |
-                //      N       |     F      |                                                |
-                //              |            |                                                |
-                //              |            |  ExecuteAndDisposeTransientCmdBuff(vkCmdBuff)  |
-                //              |            |  - SubmittedCmdBuffNumber = N                  |
-                //              |            |  - SubmittedFenceValue = F                     |
-                //     N+1 -  - | -  F+1  -  |                                                |
-                //              |            |  Release(StagingBuffer)                        |
-                //              |            |  - {N+1, StagingBuffer} -> Stale Objects       |
-                //              |            |                                                |
-                //              |            |                                                |
-                //              |            |                                                | ExecuteCommandBuffer()
-                //              |            |                                                | - SubmittedCmdBuffNumber = N+1
-                //              |            |                                                | - SubmittedFenceValue = F+1
-                //     N+2 -  - | -  F+2  -  |  -   -   -   -   -   -   -   -   -   -   -   - |
-                //              |            |                                                | - DiscardStaleVkObjects(N+1, F+1)
-                //              |            |                                                |   - {F+1, StagingBuffer} -> Release Queue
-                //              |            |                                                |
-
-                pRenderDeviceVk->SafeReleaseDeviceObject(std::move(StagingBuffer), Uint64{1} << Uint64{CmdQueueInd});
-                pRenderDeviceVk->SafeReleaseDeviceObject(std::move(StagingMemoryAllocation), Uint64{1} << Uint64{CmdQueueInd});
+                InitialState = RESOURCE_STATE_COPY_DEST;
+
+                const VkBuffer     vkStagingBuffer = StagingBuffer;
+                const VkDeviceSize CopySize        = VkBuffCI.size;
+
+                // The copy is recorded into the batch of initial data uploads that is submitted before
+                // the next command buffer, so creating many buffers does not result in many submissions.
+                // The staging buffer and memory are released when the batch is complete.
+                pRenderDeviceVk->EnqueueInitialDataUpload(
+                    CmdQueueInd, std::move(StagingBuffer), std::move(StagingMemoryAllocation),
+                    [&](VulkanUtilities::CommandBuffer& CmdBuffer) {
+                        CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+                        const VkAccessFlags AccessFlags = ResourceStateFlagsToVkAccessFlags(InitialState);
+                        VERIFY_EXPR(AccessFlags == VK_ACCESS_TRANSFER_WRITE_BIT);
+                        CmdBuffer.MemoryBarrier(0, AccessFlags, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+                        VkBufferCopy BuffCopy{};
+                        BuffCopy.srcOffset = 0;
+                        BuffCopy.dstOffset = 0;
+                        BuffCopy.size      = CopySize;
+                        CmdBuffer.CopyBuffer(vkStagingBuffer, m_VulkanBuffer, 1, &BuffCopy);
+                    });
             }
         }
 
@@ -464,6 +539,55 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
     SetState(InitialState);
 }
 
+BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
+                           FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                           RenderDeviceVkImpl*        pRenderDeviceVk,
+                           const BufferDesc&          BuffDesc,
+                           IDeviceMemory*             pMemory,
+                           Uint64                     MemoryOffset) :
+    TBufferBase{
+        pRefCounters,
+        BuffViewObjMemAllocator,
+        pRenderDeviceVk,
+        BuffDesc,
+        false,
+    },
+    m_pPlacedMemory{pMemory}
+{
+    if (m_Desc.Usage != USAGE_DEFAULT)
+        LOG_ERROR_AND_THROW("Placed buffer '", m_Desc.Name, "' must use USAGE_DEFAULT");
+
+    RefCntAutoPtr<IDeviceMemoryVk> pMemoryVk{pMemory, IID_DeviceMemoryVk};
+    if (!pMemoryVk)
+        LOG_ERROR_AND_THROW("Placed buffer '", m_Desc.Name, "' requires a valid Vulkan device memory object");
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = pRenderDeviceVk->GetLogicalDevice();
+
+    bool               RequiresBackingBuffer = false;
+    VkBufferCreateInfo VkBuffCI              = GetVkBufferCreateInfo(m_Desc, pRenderDeviceVk, m_DynamicOffsetAlignment, RequiresBackingBuffer);
+
+    const std::vector<uint32_t> QueueFamilyIndices = PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) > 1 ?
+        GetDevice()->ConvertCmdQueueIdsToQueueFamilies(m_Desc.ImmediateContextMask) :
+        std::vector<uint32_t>{};
+    if (QueueFamilyIndices.size() > 1)
+    {
+        VkBuffCI.sharingMode           = VK_SHARING_MODE_CONCURRENT;
+        VkBuffCI.pQueueFamilyIndices   = QueueFamilyIndices.data();
+        VkBuffCI.queueFamilyIndexCount = static_cast<uint32_t>(QueueFamilyIndices.size());
+    }
+
+    m_VulkanBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
+
+    const VkMemoryRequirements MemReqs   = LogicalDevice.GetBufferMemoryRequirements(m_VulkanBuffer);
+    const VkDeviceSize         Alignment = GetPlacedBufferAlignment(m_Desc, pRenderDeviceVk->GetPhysicalDevice(), MemReqs);
+    const DeviceMemoryRangeVk  Range     = pMemoryVk.ConstPtr<DeviceMemoryVkImpl>()->GetPlacedRange(MemoryOffset, MemReqs, Alignment, m_Desc.Name);
+
+    VkResult err = LogicalDevice.BindBufferMemory(m_VulkanBuffer, Range.Handle, Range.Offset);
+    CHECK_VK_ERROR_AND_THROW(err, "Failed to bind placed buffer memory");
+
+    SetState(RESOURCE_STATE_UNDEFINED);
+}
+
 BufferVkImpl::~BufferVkImpl()
 {
     // Vk object can only be destroyed when it is no longer used by the GPU
@@ -471,6 +595,8 @@ BufferVkImpl::~BufferVkImpl()
         m_pDevice->SafeReleaseDeviceObject(std::move(m_VulkanBuffer), m_Desc.ImmediateContextMask);
     if (m_MemoryAllocation.Page != nullptr)
         m_pDevice->SafeReleaseDeviceObject(std::move(m_MemoryAllocation), m_Desc.ImmediateContextMask);
+    if (m_DedicatedMemory)
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_DedicatedMemory), m_Desc.ImmediateContextMask);
 }
 
 void BufferVkImpl::CreateViewInternal(const BufferViewDesc& OrigViewDesc, IBufferView** ppView, bool bIsDefaultView)
@@ -555,22 +681,15 @@ VkAccessFlags BufferVkImpl::GetAccessFlags() const
 
 VkDeviceAddress BufferVkImpl::GetVkDeviceAddress() const
 {
-    constexpr BIND_FLAGS DeviceAddressFlags = BIND_RAY_TRACING;
+    BIND_FLAGS DeviceAddressFlags = BIND_RAY_TRACING;
+    if (m_pDevice->UseDescriptorBuffers())
+        DeviceAddressFlags |= BIND_UNIFORM_BUFFER | BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
 
     if (m_VulkanBuffer != VK_NULL_HANDLE && (m_Desc.BindFlags & DeviceAddressFlags) != 0)
     {
-#if DILIGENT_USE_VOLK
-        VkBufferDeviceAddressInfoKHR BufferInfo = {};
-
-        BufferInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
-        BufferInfo.buffer      = m_VulkanBuffer;
-        VkDeviceAddress Result = vkGetBufferDeviceAddressKHR(m_pDevice->GetLogicalDevice().GetVkDevice(), &BufferInfo);
+        VkDeviceAddress Result = m_pDevice->GetLogicalDevice().GetBufferDeviceAddress(m_VulkanBuffer);
         VERIFY_EXPR(Result > 0);
         return Result;
-#else
-        UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
-        return VkDeviceAddress{};
-#endif
     }
     else
     {
@@ -622,4 +741,24 @@ SparseBufferProperties BufferVkImpl::GetSparseProperties() const
     return Props;
 }
 
+Bool BufferVkImpl::ExportMemoryHandle(Uint64& Handle, Uint64& MemorySize) const
+{
+    if ((m_Desc.MiscFlags & MISC_BUFFER_FLAG_EXPORTABLE) == 0)
+    {
+        DEV_ERROR("Buffer '", m_Desc.Name, "' was not created with MISC_BUFFER_FLAG_EXPORTABLE flag");
+        return False;
+    }
+    VERIFY(m_DedicatedMemory, "Exportable buffers must use dedicated allocations");
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = m_pDevice->GetLogicalDevice();
+
+    VkResult err = LogicalDevice.GetMemoryHandle(m_DedicatedMemory, Handle);
+    CHECK_VK_ERROR(err, "Failed to export memory of buffer '", m_Desc.Name, "'");
+    if (err != VK_SUCCESS)
+        return False;
+
+    MemorySize = LogicalDevice.GetBufferMemoryRequirements(m_VulkanBuffer).size;
+    return True;
+}
+
 } // namespace Diligent
@@ -27,6 +27,7 @@
 
 #include "pch.h"
 #include <thread>
+#include <algorithm>
 
 #include "CommandQueueVkImpl.hpp"
 #include "RenderDeviceVkImpl.hpp"
@@ -61,6 +62,7 @@ CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*
         VulkanUtilities::SetQueueName(m_LogicalDevice->GetVkDevice(), m_VkQueue, CreateInfo.Name);
 
     m_TempSignalSemaphores.reserve(16);
+    m_TempSignalValues.reserve(16);
 }
 
 CommandQueueVkImpl::~CommandQueueVkImpl()
@@ -147,6 +149,60 @@ __forceinline SyncPointVkPtr CommandQueueVkImpl::CreateSyncPoint(Uint64 dbgValue
     return {new (ptr) SyncPointVk{m_CommandQueueId, m_NumCommandQueues, *m_SyncObjectManager, m_LogicalDevice->GetVkDevice(), dbgValue}, std::move(Deleter)};
 }
 
+template <typename SubmitInfoType>
+void CommandQueueVkImpl::AppendFenceSignal(SubmitInfoType& Info, VkTimelineSemaphoreSubmitInfo& TimelineInfo, Uint64 FenceValue)
+{
+    VERIFY_EXPR(m_pFence->IsTimelineSemaphore());
+
+    // If the info already references timeline semaphore values, the structure
+    // is expected to be the first one in the chain (see DeviceContextVkImpl::Flush).
+    const VkBaseInStructure*             pFirstStruct     = static_cast<const VkBaseInStructure*>(Info.pNext);
+    const VkTimelineSemaphoreSubmitInfo* pSrcTimelineInfo = nullptr;
+    if (pFirstStruct != nullptr && pFirstStruct->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+        pSrcTimelineInfo = reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(pFirstStruct);
+
+#ifdef DILIGENT_DEBUG
+    for (const VkBaseInStructure* pStruct = pFirstStruct != nullptr ? pFirstStruct->pNext : nullptr; pStruct != nullptr; pStruct = pStruct->pNext)
+    {
+        VERIFY(pStruct->sType != VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+               "VkTimelineSemaphoreSubmitInfo must be the first structure in the pNext chain");
+    }
+#endif
+
+    m_TempSignalSemaphores.assign(Info.pSignalSemaphores, Info.pSignalSemaphores + Info.signalSemaphoreCount);
+    m_TempSignalSemaphores.push_back(m_pFence->GetVkSemaphore());
+
+    // Values for binary semaphores are ignored
+    m_TempSignalValues.assign(Info.signalSemaphoreCount, 0);
+    if (pSrcTimelineInfo != nullptr && pSrcTimelineInfo->pSignalSemaphoreValues != nullptr)
+    {
+        const uint32_t NumValues = std::min(pSrcTimelineInfo->signalSemaphoreValueCount, Info.signalSemaphoreCount);
+        std::copy(pSrcTimelineInfo->pSignalSemaphoreValues, pSrcTimelineInfo->pSignalSemaphoreValues + NumValues, m_TempSignalValues.begin());
+    }
+    m_TempSignalValues.push_back(FenceValue);
+
+    if (pSrcTimelineInfo != nullptr)
+    {
+        TimelineInfo = *pSrcTimelineInfo;
+    }
+    else
+    {
+        TimelineInfo                         = {};
+        TimelineInfo.sType                   = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        TimelineInfo.pNext                   = Info.pNext;
+        TimelineInfo.waitSemaphoreValueCount = 0;
+        TimelineInfo.pWaitSemaphoreValues    = nullptr;
+    }
+    TimelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(m_TempSignalValues.size());
+    TimelineInfo.pSignalSemaphoreValues    = m_TempSignalValues.data();
+
+    Info.pNext                = &TimelineInfo;
+    Info.signalSemaphoreCount = static_cast<uint32_t>(m_TempSignalSemaphores.size());
+    Info.pSignalSemaphores    = m_TempSignalSemaphores.data();
+
+    m_pFence->DvpSignal(FenceValue);
+}
+
 Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
@@ -154,6 +210,22 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
     // Increment the value before submitting the buffer to be overly safe
     const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
 
+    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
+    if (m_pFence->IsTimelineSemaphore())
+    {
+        // The submission signals the fence timeline semaphore, so there is no need
+        // to allocate a sync point and a VkFence.
+        VkSubmitInfo                  SubmitInfo = InSubmitInfo;
+        VkTimelineSemaphoreSubmitInfo TimelineInfo{};
+        AppendFenceSignal(SubmitInfo, TimelineInfo, FenceValue);
+
+        VkResult err = vkQueueSubmit(m_VkQueue, 1, &SubmitInfo, VK_NULL_HANDLE);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
+        (void)err;
+
+        return FenceValue;
+    }
+
     SyncPointVkPtr NewSyncPoint = CreateSyncPoint(FenceValue);
 
     m_TempSignalSemaphores.clear();
@@ -190,7 +262,6 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
     (void)err;
 
-    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
     m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
 
     // Update the last sync point
@@ -228,6 +299,14 @@ Uint64 CommandQueueVkImpl::WaitForIdle()
     // Update last completed fence value to unlock all waiting events.
     const Uint64 FenceValue = m_NextFenceValue.fetch_add(1);
 
+    if (m_pFence->IsTimelineSemaphore())
+    {
+        InternalSignalSemaphore(m_pFence->GetVkSemaphore(), FenceValue);
+        m_pFence->DvpSignal(FenceValue);
+        vkQueueWaitIdle(m_VkQueue);
+        return FenceValue;
+    }
+
     vkQueueWaitIdle(m_VkQueue);
     // For some reason after idling the queue not all fences are signaled
     m_pFence->Wait(UINT64_MAX);
@@ -297,6 +376,20 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
     // Increment the value before submitting the buffer to be overly safe
     const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
 
+    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
+    if (m_pFence->IsTimelineSemaphore())
+    {
+        VkBindSparseInfo              BindInfo = InBindInfo;
+        VkTimelineSemaphoreSubmitInfo TimelineInfo{};
+        AppendFenceSignal(BindInfo, TimelineInfo, FenceValue);
+
+        VkResult err = vkQueueBindSparse(m_VkQueue, 1, &BindInfo, VK_NULL_HANDLE);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit sparse bind commands to the command queue");
+        (void)err;
+
+        return FenceValue;
+    }
+
     SyncPointVkPtr NewSyncPoint = CreateSyncPoint(FenceValue);
 
     m_TempSignalSemaphores.clear();
@@ -326,7 +419,6 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit sparse bind commands to the command queue");
     (void)err;
 
-    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
     m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
 
     // Update the last sync point
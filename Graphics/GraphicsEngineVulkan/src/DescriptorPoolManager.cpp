@@ -28,6 +28,7 @@
 #include "pch.h"
 #include "DescriptorPoolManager.hpp"
 #include "RenderDeviceVkImpl.hpp"
+#include "Trace.hpp"
 
 namespace Diligent
 {
@@ -197,6 +198,8 @@ DescriptorSetAllocator::~DescriptorSetAllocator()
 
 DescriptorSetAllocation DescriptorSetAllocator::Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName)
 {
+    DILIGENT_TRACE_SCOPE("AllocateDescriptorSet");
+
     // Descriptor pools are externally synchronized, meaning that the application must not allocate
     // and/or free descriptor sets from the same pool in multiple threads simultaneously (13.2.3)
     std::lock_guard<std::mutex> Lock{m_Mutex};
@@ -289,6 +292,8 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
 
 VkDescriptorSet DynamicDescriptorSetAllocator::Allocate(VkDescriptorSetLayout SetLayout, const char* DebugName)
 {
+    DILIGENT_TRACE_SCOPE("AllocateDynamicDescriptorSet");
+
     VkDescriptorSet                       set           = VK_NULL_HANDLE;
     const VulkanUtilities::LogicalDevice& LogicalDevice = m_GlobalPoolMgr.GetDeviceVkImpl().GetLogicalDevice();
     if (!m_AllocatedPools.empty())
@@ -31,6 +31,7 @@
 
 #include <sstream>
 #include <vector>
+#include <algorithm>
 
 #include "RenderDeviceVkImpl.hpp"
 #include "PipelineStateVkImpl.hpp"
@@ -45,7 +46,9 @@
 #include "GraphicsAccessories.hpp"
 #include "GenerateMipsVkHelper.hpp"
 #include "QueryManagerVk.hpp"
+#include "QueryPoolVkImpl.hpp"
 #include "CommandQueueVkImpl.hpp"
+#include "Trace.hpp"
 
 namespace Diligent
 {
@@ -91,7 +94,8 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*      pRefCounters,
     {
         pDeviceVkImpl->GetDynamicMemoryManager(),
         GetContextObjectName("Dynamic heap", Desc.IsDeferred, Desc.ContextId),
-        pDeviceVkImpl->GetProperties().DynamicHeapPageSize
+        pDeviceVkImpl->GetProperties().DynamicHeapPageSize,
+        &m_Stats
     },
     m_DynamicDescrSetAllocator
     {
@@ -100,6 +104,9 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*      pRefCounters,
     }
 // clang-format on
 {
+    m_CommandBuffer.SetUseSynchronization2(pDeviceVkImpl->GetLogicalDevice().GetEnabledExtFeatures().Synchronization2.synchronization2 != VK_FALSE);
+    m_CommandBuffer.SetBarrierBatchCounter(&m_Stats.BarrierBatches);
+
     if (!IsDeferred())
     {
         PrepareCommandPool(GetCommandQueueId());
@@ -165,8 +172,18 @@ DeviceContextVkImpl::~DeviceContextVkImpl()
     //     Also note that command buffers are disposed directly into the release queue, but
     //     the command pool goes into the stale objects queue and is moved into the release queue
     //     when the next command buffer is submitted.
+    if (!m_PendingSplitBarriers.empty())
+    {
+        LOG_WARNING_MESSAGE(m_PendingSplitBarriers.size(), " begin-split barrier(s) have not been ended when the context is destroyed.");
+        for (PendingSplitBarrier& Split : m_PendingSplitBarriers)
+            m_pDevice->SafeReleaseDeviceObject(std::move(Split.Event), ~Uint64{0});
+        m_PendingSplitBarriers.clear();
+    }
+
     if (m_QueueFamilyCmdPools)
         m_pDevice->SafeReleaseDeviceObject(std::move(m_QueueFamilyCmdPools), ~Uint64{0});
+    if (!m_RetiredCmdPools.empty())
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_RetiredCmdPools), ~Uint64{0});
 
     // NB: Upload heap, dynamic heap and dynamic descriptor manager return their resources to
     //     global managers and do not need to wait for GPU to idle.
@@ -181,14 +198,34 @@ void DeviceContextVkImpl::PrepareCommandPool(SoftwareQueueIndex CommandQueueId)
     DEV_CHECK_ERR(QueueFamilyIndex < QueueProps.size(), "QueueFamilyIndex is out of range");
 
     std::unique_ptr<VulkanUtilities::CommandBufferPool>& Pool = m_QueueFamilyCmdPools[QueueFamilyIndex];
+    if (!Pool && IsDeferred())
+    {
+        // Try to reuse the pool retired at the end of one of the previous frames.
+        // The pool can only be reset once all its command buffers have been recycled
+        // by the release queue, i.e. when the GPU has finished executing them.
+        for (auto it = m_RetiredCmdPools.begin(); it != m_RetiredCmdPools.end(); ++it)
+        {
+            if ((*it)->GetQueueFamilyIndex() == QueueFamilyIndex && (*it)->ResetPool())
+            {
+                Pool = std::move(*it);
+                m_RetiredCmdPools.erase(it);
+                break;
+            }
+        }
+    }
     if (!Pool)
     {
         // Command pools must be thread-safe because command buffers are returned into pools by release queues
-        // potentially running in another thread
+        // potentially running in another thread.
+        // Command buffers of deferred contexts are not reset individually - instead, the entire
+        // pool is reset with vkResetCommandPool when it is reused in one of the next frames.
+        VkCommandPoolCreateFlags Flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        if (!IsDeferred())
+            Flags |= VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
         Pool = std::make_unique<VulkanUtilities::CommandBufferPool>(
             m_pDevice->GetLogicalDevice().GetSharedPtr(),
             QueueFamilyIndex,
-            VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+            Flags);
     }
     m_CmdPool = Pool.get();
 
@@ -201,7 +238,7 @@ void DeviceContextVkImpl::PrepareCommandPool(SoftwareQueueIndex CommandQueueId)
     m_Desc.TextureCopyGranularity[2] = QueueInfo.minImageTransferGranularity.depth;
 }
 
-void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId)
+void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
 {
     DEV_CHECK_ERR(IsDeferred(), "Begin() should only be called for deferred contexts.");
     DEV_CHECK_ERR(!IsRecordingDeferredCommands(), "This context is already recording commands. Call FinishCommandList() before beginning new recording.");
@@ -209,13 +246,16 @@ void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId)
     PrepareCommandPool(CommandQueueId);
     m_DstImmediateContextId = static_cast<Uint8>(ImmediateContextId);
     VERIFY_EXPR(m_DstImmediateContextId == ImmediateContextId);
-    m_pQueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
+    m_CommandListFlags = Flags;
+    m_pQueryMgr        = &m_pDevice->GetQueryMgr(CommandQueueId);
 }
 
-void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue)
+void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex                  CmdQueue,
+                                             VkCommandBuffer                     vkCmdBuff,
+                                             VulkanUtilities::CommandBufferPool& Pool,
+                                             Uint64                              FenceValue)
 {
     VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
-    VERIFY_EXPR(m_CmdPool != nullptr);
     class CmdBufferRecycler
     {
     public:
@@ -257,7 +297,7 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
     // Discard command buffer directly to the release queue since we know exactly which queue it was submitted to
     // as well as the associated FenceValue.
     auto& ReleaseQueue = m_pDevice->GetReleaseQueue(CmdQueue);
-    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *m_CmdPool}, FenceValue);
+    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, Pool}, FenceValue);
 }
 
 inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue)
@@ -266,7 +306,8 @@ inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQ
     VkCommandBuffer vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
     if (vkCmdBuff != VK_NULL_HANDLE)
     {
-        DisposeVkCmdBuffer(CmdQueue, vkCmdBuff, FenceValue);
+        VERIFY_EXPR(m_CmdPool != nullptr);
+        DisposeVkCmdBuffer(CmdQueue, vkCmdBuff, *m_CmdPool, FenceValue);
         m_CommandBuffer.Reset();
     }
 }
@@ -274,8 +315,8 @@ inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQ
 
 void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
 {
-    RefCntAutoPtr<PipelineStateVkImpl> pOldPipeline = m_pPipelineState;
-    if (!TDeviceContextBase::SetPipelineState(pPipelineState, PipelineStateVkImpl::IID_InternalImpl))
+    RefCntAutoPtr<PipelineStateVkImpl> pOldPipeline;
+    if (!TDeviceContextBase::SetPipelineState(pPipelineState, PipelineStateVkImpl::IID_InternalImpl, &pOldPipeline))
         return;
 
     bool CommitStates  = false;
@@ -294,14 +335,16 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
         // This is necessary because if the command list had been flushed
         // and the first PSO set on the command list was a compute pipeline,
         // the states would otherwise never be committed (since m_pPipelineState != nullptr)
-        CommitStates = !OldPSODesc.IsAnyGraphicsPipeline();
+        // Viewports and scissor rects set for shader objects are not valid for pipelines either,
+        // so they also have to be committed when switching from a pipeline that uses shader objects.
+        CommitStates = !OldPSODesc.IsAnyGraphicsPipeline() || pOldPipeline->UsesShaderObjects();
         // We also need to update scissor rect if ScissorEnable state was disabled in previous pipeline
         if (OldPSODesc.IsAnyGraphicsPipeline())
             CommitScissor = !pOldPipeline->GetGraphicsPipelineDesc().RasterizerDesc.ScissorEnable;
         pOldPipeline.Release();
     }
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
 
     const VkPipeline         vkPipeline = m_pPipelineState->GetVkPipeline();
     const PipelineStateDesc& PSODesc    = m_pPipelineState->GetDesc();
@@ -313,19 +356,31 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
         case PIPELINE_TYPE_MESH:
         {
             const GraphicsPipelineDesc& GraphicsPipeline = m_pPipelineState->GetGraphicsPipelineDesc();
-            m_CommandBuffer.BindGraphicsPipeline(vkPipeline);
-
-            if (CommitStates)
+            if (m_pPipelineState->UsesShaderObjects())
             {
-                m_CommandBuffer.SetStencilReference(m_StencilRef);
-                m_CommandBuffer.SetBlendConstants(m_BlendFactors);
-                CommitViewports();
+                // All states are set dynamically every time shader objects are bound
+                CommitShaderObjectStates();
             }
-
-            if (GraphicsPipeline.RasterizerDesc.ScissorEnable && (CommitStates || CommitScissor))
+            else
             {
-                CommitScissorRects();
+                m_CommandBuffer.BindGraphicsPipeline(vkPipeline);
+
+                if (CommitStates)
+                {
+                    m_CommandBuffer.SetStencilReference(m_StencilRef);
+                    m_CommandBuffer.SetBlendConstants(m_BlendFactors);
+                    CommitViewports();
+                }
+
+                if (GraphicsPipeline.RasterizerDesc.ScissorEnable && (CommitStates || CommitScissor))
+                {
+                    CommitScissorRects();
+                }
+
+                if (m_pPipelineState->HasExtendedDynamicState())
+                    CommitExtendedDynamicStates();
             }
+
             m_State.vkPipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
 
             m_State.NullRenderTargets =
@@ -364,6 +419,8 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
     {
         // Do not clear DescriptorSetBaseInd and DynamicOffsetCount!
         BindInfo.SetInfo[sign].vkSets.fill(VK_NULL_HANDLE);
+        BindInfo.SetInfo[sign].DescrBufferSetCount = 0;
+        BindInfo.SetInfo[sign].DynamicSetDeferred  = false;
     }
 #endif
 
@@ -385,6 +442,7 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
 
         SetInfo.BaseInd            = Layout.GetFirstDescrSetIndex(pSignature->GetDesc().BindingIndex);
         SetInfo.DynamicOffsetCount = pSignature->GetDynamicOffsetCount();
+        SetInfo.PushDynamicSet     = Layout.IsDynamicSetPushed(pSignature->GetDesc().BindingIndex);
         TotalDynamicOffsetCount += SetInfo.DynamicOffsetCount;
     }
 
@@ -419,27 +477,62 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
 {
     VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
 
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        CommitDescriptorBuffers(BindInfo, CommitSRBMask);
+        return;
+    }
+
     const Uint32 FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
     const Uint32 LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
     VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
 
-    // Bind all descriptor sets in a single BindDescriptorSets call
-    uint32_t     DynamicOffsetCount = 0;
-    uint32_t     TotalSetCount      = 0;
-    const Uint32 FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+
+    // Bind all descriptor sets in a single BindDescriptorSets call, unless there is
+    // a pushed dynamic set in between.
+    uint32_t DynamicOffsetCount = 0;
+    uint32_t TotalSetCount      = 0;
+    Uint32   FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
+
+    auto BindPendingSets = [&]() {
+        // Note that there is one global dynamic buffer from which all dynamic resources are suballocated in Vulkan back-end,
+        // and this buffer is not resizable, so the buffer handle can never change.
+
+        // vkCmdBindDescriptorSets causes the sets numbered [firstSet .. firstSet+descriptorSetCount-1] to use the
+        // bindings stored in pDescriptorSets[0 .. descriptorSetCount-1] for subsequent rendering commands
+        // (either compute or graphics, according to the pipelineBindPoint). Any bindings that were previously
+        // applied via these sets are no longer valid.
+        // https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBindDescriptorSets.html
+        if (TotalSetCount > 0)
+        {
+            m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                               m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+        }
+        FirstSetToBind += TotalSetCount;
+
+        TotalSetCount      = 0;
+        DynamicOffsetCount = 0;
+    };
+
     for (Uint32 sign = FirstSign; sign <= LastSign; ++sign)
     {
         ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[sign];
-        VERIFY(SetInfo.vkSets[0] != VK_NULL_HANDLE || (CommitSRBMask & (1u << sign)) == 0,
+
+        const bool IsCommitted = SetInfo.vkSets[0] != VK_NULL_HANDLE || SetInfo.DynamicSetDeferred;
+        VERIFY(IsCommitted || (CommitSRBMask & (1u << sign)) == 0,
                "At least one descriptor set in the stale SRB must not be NULL. Empty SRBs should not be marked as stale by CommitShaderResources()");
 
-        VERIFY((BindInfo.ActiveSRBMask & (1u << sign)) != 0 || SetInfo.vkSets[0] == VK_NULL_HANDLE, "Descriptor sets must be null for inactive slots");
-        if (SetInfo.vkSets[0] == VK_NULL_HANDLE)
+        VERIFY((BindInfo.ActiveSRBMask & (1u << sign)) != 0 || !IsCommitted, "Descriptor sets must be null for inactive slots");
+        if (!IsCommitted)
         {
             VERIFY_EXPR(SetInfo.vkSets[1] == VK_NULL_HANDLE);
             continue;
         }
 
+        if (TotalSetCount == 0)
+            FirstSetToBind = SetInfo.BaseInd;
+
         VERIFY_EXPR(SetInfo.BaseInd >= FirstSetToBind + TotalSetCount);
         while (FirstSetToBind + TotalSetCount < SetInfo.BaseInd)
             m_DescriptorSets[TotalSetCount++] = VK_NULL_HANDLE;
@@ -447,9 +540,31 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
         const ShaderResourceCacheVk* pResourceCache = BindInfo.ResourceCaches[sign];
         DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null, but corresponding descriptor set is not");
 
-        m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[0];
-        if (SetInfo.vkSets[1] != VK_NULL_HANDLE)
-            m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[1];
+        // The dynamic set is always the last one
+        Uint32 SetCount = pResourceCache->GetNumDescriptorSets();
+        if (SetInfo.DynamicSetDeferred)
+        {
+            const PipelineResourceSignatureVkImpl* pSignature = m_pPipelineState->GetResourceSignature(sign);
+            VERIFY_EXPR(pSignature != nullptr && pSignature->GetVkPushDescriptorSetLayout() != VK_NULL_HANDLE);
+
+            const Uint32 DynSetIdx = pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>();
+            VERIFY_EXPR(DynSetIdx + 1 == SetCount);
+            if (SetInfo.PushDynamicSet)
+            {
+                --SetCount;
+            }
+            else if (SetInfo.vkSets[DynSetIdx] == VK_NULL_HANDLE)
+            {
+                // The pipeline layout does not push the dynamic set of this signature
+                SetInfo.vkSets[DynSetIdx] = CommitDynamicDescriptorSet(*pSignature, *pResourceCache);
+            }
+        }
+
+        for (Uint32 s = 0; s < SetCount; ++s)
+        {
+            VERIFY_EXPR(SetInfo.vkSets[s] != VK_NULL_HANDLE);
+            m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[s];
+        }
 
         if (SetInfo.DynamicOffsetCount > 0)
         {
@@ -461,22 +576,92 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
             DynamicOffsetCount += SetInfo.DynamicOffsetCount;
         }
 
+        if (SetInfo.DynamicSetDeferred && SetInfo.PushDynamicSet)
+        {
+            // Sets with lower indices must be bound first
+            BindPendingSets();
+            VERIFY_EXPR(FirstSetToBind == SetInfo.BaseInd + SetCount);
+            m_pPipelineState->GetResourceSignature(sign)->PushDynamicResources(*pResourceCache, m_CommandBuffer, m_State.vkPipelineBindPoint,
+                                                                                BindInfo.vkPipelineLayout, FirstSetToBind);
+            ++FirstSetToBind;
+        }
+
 #ifdef DILIGENT_DEVELOPMENT
         SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
 #endif
     }
 
-    // Note that there is one global dynamic buffer from which all dynamic resources are suballocated in Vulkan back-end,
-    // and this buffer is not resizable, so the buffer handle can never change.
+    BindPendingSets();
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+}
+
+void DeviceContextVkImpl::CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    const VulkanUtilities::LogicalDevice&                LogicalDevice = m_pDevice->GetLogicalDevice();
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props         = m_pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+    VulkanDynamicMemoryManager&                          DynMemMgr     = m_pDevice->GetDynamicMemoryManager();
+
+    if (!m_State.DescriptorBufferBound)
+    {
+        // All descriptor sets are suballocated from the global dynamic buffer. The buffer is not resizable,
+        // so it only needs to be bound once per command buffer.
+        VkDescriptorBufferBindingInfoEXT BindingInfo{};
+        BindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+        BindingInfo.address = DynMemMgr.GetVkDeviceAddress();
+        BindingInfo.usage   = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+        m_CommandBuffer.BindDescriptorBuffers(1, &BindingInfo);
+        m_State.DescriptorBufferBound = true;
+    }
+
+    const Uint32 FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
+    const Uint32 LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
+    VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
+
+    static constexpr uint32_t BufferIndices[MAX_DESCR_SET_PER_SIGNATURE] = {};
 
-    // vkCmdBindDescriptorSets causes the sets numbered [firstSet .. firstSet+descriptorSetCount-1] to use the
-    // bindings stored in pDescriptorSets[0 .. descriptorSetCount-1] for subsequent rendering commands
-    // (either compute or graphics, according to the pipelineBindPoint). Any bindings that were previously
-    // applied via these sets are no longer valid.
-    // https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBindDescriptorSets.html
     VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
-    m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
-                                       m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+    for (Uint32 sign = FirstSign; sign <= LastSign; ++sign)
+    {
+        ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[sign];
+        VERIFY(SetInfo.DescrBufferSetCount != 0 || (CommitSRBMask & (1u << sign)) == 0,
+               "Stale SRB must have at least one descriptor set. Empty SRBs should not be marked as stale by CommitShaderResources()");
+        if (SetInfo.DescrBufferSetCount == 0)
+            continue;
+
+        if (CommitSRBMask & (1u << sign))
+        {
+            const ShaderResourceCacheVk* pResourceCache = BindInfo.ResourceCaches[sign];
+            DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null, but corresponding descriptor set is not");
+
+            const PipelineResourceSignatureVkImpl* pSignature = m_pPipelineState->GetResourceSignature(sign);
+            VERIFY_EXPR(pSignature != nullptr && pSignature->GetNumDescriptorSets() == SetInfo.DescrBufferSetCount);
+
+            // Descriptors are always written anew, so that the current offsets of dynamic buffers are
+            // baked into the buffer addresses.
+            Uint32 DSIndex = 0;
+            for (PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID SetId : {PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE,
+                                                                             PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC})
+            {
+                if (!pSignature->HasDescriptorSet(SetId))
+                    continue;
+
+                const ShaderResourceCacheVk::DescriptorBufferSetLayout& Layout = pSignature->GetDescriptorBufferSetLayout(SetId);
+
+                VulkanDynamicAllocation Allocation = AllocateDynamicSpace(Layout.DataSize, StaticCast<Uint32>(Props.descriptorBufferOffsetAlignment));
+                pResourceCache->WriteDescriptorBufferData(DSIndex, Layout, Props, LogicalDevice, this, DynMemMgr.GetCPUAddress() + Allocation.AlignedOffset);
+                SetInfo.DescrBufferOffsets[DSIndex] = Allocation.AlignedOffset;
+                ++DSIndex;
+            }
+        }
+
+        m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd,
+                                                   SetInfo.DescrBufferSetCount, BufferIndices, SetInfo.DescrBufferOffsets.data());
+
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+    }
 
     BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
 }
@@ -487,6 +672,9 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
     if (BindInfo.ResourcesValidated)
         return;
 
+    if (!DvpIsCommandValidationRequired(BindInfo))
+        return;
+
     DvpVerifySRBCompatibility(BindInfo);
 
     const Uint32 SignCount = m_pPipelineState->GetResourceSignatureCount();
@@ -500,11 +688,21 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
 
         const ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[i];
         const Uint32                               DSCount = pSign->GetNumDescriptorSets();
-        for (Uint32 s = 0; s < DSCount; ++s)
+        if (m_pDevice->UseDescriptorBuffers())
         {
-            DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
-                          "descriptor set with index ", s, " is not bound for resource signature '",
-                          pSign->GetDesc().Name, "', binding index ", i, ".");
+            DEV_CHECK_ERR(SetInfo.DescrBufferSetCount == DSCount,
+                          "descriptor sets are not bound for resource signature '", pSign->GetDesc().Name, "', binding index ", i, ".");
+        }
+        else
+        {
+            // Deferred dynamic set is either pushed or allocated by CommitDescriptorSets()
+            const Uint32 BoundSetCount = (SetInfo.DynamicSetDeferred && SetInfo.PushDynamicSet) ? DSCount - 1 : DSCount;
+            for (Uint32 s = 0; s < BoundSetCount; ++s)
+            {
+                DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
+                              "descriptor set with index ", s, " is not bound for resource signature '",
+                              pSign->GetDesc().Name, "', binding index ", i, ".");
+            }
         }
 
         DEV_CHECK_ERR(SetInfo.LastBoundBaseInd == SetInfo.BaseInd,
@@ -524,6 +722,8 @@ void DeviceContextVkImpl::TransitionShaderResources(IShaderResourceBinding* pSha
     DEV_CHECK_ERR(!m_pActiveRenderPass, "State transitions are not allowed inside a render pass.");
     DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "pShaderResourceBinding must not be null");
 
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Barrier};
+
     ShaderResourceBindingVkImpl* pResBindingVkImpl = ClassPtrCast<ShaderResourceBindingVkImpl>(pShaderResourceBinding);
     ShaderResourceCacheVk&       ResourceCache     = pResBindingVkImpl->GetResourceCache();
 
@@ -532,6 +732,9 @@ void DeviceContextVkImpl::TransitionShaderResources(IShaderResourceBinding* pSha
 
 void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_TRACE_SCOPE("CommitShaderResources");
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Commit};
+
     TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
 
     ShaderResourceBindingVkImpl* pResBindingVkImpl = ClassPtrCast<ShaderResourceBindingVkImpl>(pShaderResourceBinding);
@@ -565,7 +768,15 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     BindInfo.Set(SRBIndex, pResBindingVkImpl);
     // We must not clear entire ResInfo as DescriptorSetBaseInd and DynamicOffsetCount
     // are set by SetPipelineState().
-    SetInfo.vkSets = {};
+    SetInfo.vkSets             = {};
+    SetInfo.DynamicSetDeferred = false;
+
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        // Descriptor sets are written to the dynamic heap by CommitDescriptorBuffers()
+        SetInfo.DescrBufferSetCount = ResourceCache.GetNumDescriptorSets();
+        return;
+    }
 
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
@@ -582,35 +793,48 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         VERIFY_EXPR(DSIndex == pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
         VERIFY_EXPR(const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(DSIndex).GetVkDescriptorSet() == VK_NULL_HANDLE);
 
-        const VkDescriptorSetLayout vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
+        if (pSignature->GetVkPushDescriptorSetLayout() != VK_NULL_HANDLE)
+        {
+            // Whether the set is pushed depends on the pipeline layout, so
+            // the descriptors are written by CommitDescriptorSets().
+            SetInfo.DynamicSetDeferred = true;
+        }
+        else
+        {
+            SetInfo.vkSets[DSIndex] = CommitDynamicDescriptorSet(*pSignature, ResourceCache);
+        }
+        ++DSIndex;
+    }
+
+    VERIFY_EXPR(DSIndex == ResourceCache.GetNumDescriptorSets());
+}
 
-        VkDescriptorSet vkDynamicDescrSet   = VK_NULL_HANDLE;
-        const char*     DynamicDescrSetName = "Dynamic Descriptor Set";
+VkDescriptorSet DeviceContextVkImpl::CommitDynamicDescriptorSet(const PipelineResourceSignatureVkImpl& Signature, const ShaderResourceCacheVk& ResourceCache)
+{
+    const VkDescriptorSetLayout vkLayout = Signature.GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
+
+    const char* DynamicDescrSetName = "Dynamic Descriptor Set";
 #ifdef DILIGENT_DEVELOPMENT
-        String _DynamicDescrSetName{DynamicDescrSetName};
-        _DynamicDescrSetName.append(" (");
-        _DynamicDescrSetName.append(pSignature->GetDesc().Name);
-        _DynamicDescrSetName += ')';
-        DynamicDescrSetName = _DynamicDescrSetName.c_str();
+    String _DynamicDescrSetName{DynamicDescrSetName};
+    _DynamicDescrSetName.append(" (");
+    _DynamicDescrSetName.append(Signature.GetDesc().Name);
+    _DynamicDescrSetName += ')';
+    DynamicDescrSetName = _DynamicDescrSetName.c_str();
 #endif
-        // Allocate vulkan descriptor set for dynamic resources
-        vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
+    // Allocate vulkan descriptor set for dynamic resources
+    VkDescriptorSet vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
 
-        // Write all dynamic resource descriptors
-        pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
+    // Write all dynamic resource descriptors
+    Signature.CommitDynamicResources(ResourceCache, vkDynamicDescrSet, m_DescriptorUpdateData);
 
-        SetInfo.vkSets[DSIndex] = vkDynamicDescrSet;
-        ++DSIndex;
-    }
-
-    VERIFY_EXPR(DSIndex == ResourceCache.GetNumDescriptorSets());
+    return vkDynamicDescrSet;
 }
 
 void DeviceContextVkImpl::SetStencilRef(Uint32 StencilRef)
 {
     if (TDeviceContextBase::SetStencilRef(StencilRef, 0))
     {
-        EnsureVkCmdBuffer();
+        EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
         m_CommandBuffer.SetStencilReference(m_StencilRef);
     }
 }
@@ -619,11 +843,97 @@ void DeviceContextVkImpl::SetBlendFactors(const float* pBlendFactors)
 {
     if (TDeviceContextBase::SetBlendFactors(pBlendFactors, 0))
     {
-        EnsureVkCmdBuffer();
+        EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
         m_CommandBuffer.SetBlendConstants(m_BlendFactors);
     }
 }
 
+void DeviceContextVkImpl::SetCullMode(CULL_MODE CullMode)
+{
+    if (TDeviceContextBase::SetCullMode(CullMode, 0))
+    {
+        EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
+        m_CommandBuffer.SetCullMode(CullModeToVkCullMode(m_DynamicStates.CullMode));
+    }
+}
+
+void DeviceContextVkImpl::SetDepthState(Bool                DepthEnable,
+                                        Bool                DepthWriteEnable,
+                                        COMPARISON_FUNCTION DepthFunc)
+{
+    if (TDeviceContextBase::SetDepthState(DepthEnable, DepthWriteEnable, DepthFunc, 0))
+    {
+        EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
+        m_CommandBuffer.SetDepthState(m_DynamicStates.DepthEnable ? VK_TRUE : VK_FALSE,
+                                      m_DynamicStates.DepthWriteEnable ? VK_TRUE : VK_FALSE,
+                                      ComparisonFuncToVkCompareOp(m_DynamicStates.DepthFunc));
+    }
+}
+
+void DeviceContextVkImpl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    if (TDeviceContextBase::SetPrimitiveTopology(Topology, 0))
+    {
+        EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
+
+        VkPrimitiveTopology vkTopology         = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        uint32_t            PatchControlPoints = 0;
+        PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(m_DynamicStates.Topology, vkTopology, PatchControlPoints);
+        m_CommandBuffer.SetPrimitiveTopology(vkTopology);
+    }
+}
+
+void DeviceContextVkImpl::CommitExtendedDynamicStates()
+{
+    VERIFY_EXPR(m_pPipelineState && m_pPipelineState->HasExtendedDynamicState());
+
+    // Dynamic states are not part of the pipeline, so they have to be set every time
+    // a pipeline with extended dynamic state is bound.
+    m_CommandBuffer.SetCullMode(CullModeToVkCullMode(m_DynamicStates.CullMode));
+    m_CommandBuffer.SetDepthState(m_DynamicStates.DepthEnable ? VK_TRUE : VK_FALSE,
+                                  m_DynamicStates.DepthWriteEnable ? VK_TRUE : VK_FALSE,
+                                  ComparisonFuncToVkCompareOp(m_DynamicStates.DepthFunc));
+
+    VkPrimitiveTopology vkTopology         = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    uint32_t            PatchControlPoints = 0;
+    PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(m_DynamicStates.Topology, vkTopology, PatchControlPoints);
+    m_CommandBuffer.SetPrimitiveTopology(vkTopology);
+}
+
+void DeviceContextVkImpl::CommitShaderObjectStates()
+{
+    VERIFY_EXPR(m_pPipelineState && m_pPipelineState->UsesShaderObjects());
+
+    const PipelineStateVkImpl::ShaderObjectData& SOData        = m_pPipelineState->GetShaderObjectData();
+    const VulkanUtilities::LogicalDevice&        LogicalDevice = m_pDevice->GetLogicalDevice();
+
+    m_CommandBuffer.BindShaders(static_cast<uint32_t>(SOData.vkStages.size()), SOData.vkStages.data(), SOData.vkShaders.data());
+
+    m_CommandBuffer.SetRasterizationState(SOData.RasterizerCI, /*SetDepthClamp = */ LogicalDevice.GetEnabledFeatures().depthClamp != VK_FALSE);
+    m_CommandBuffer.SetMultisampleState(SOData.SampleCount, SOData.SampleMask, /*AlphaToCoverageEnable = */ VK_FALSE);
+    m_CommandBuffer.SetDepthStencilState(SOData.DepthStencilCI);
+    m_CommandBuffer.SetColorBlendState(static_cast<uint32_t>(SOData.BlendEnables.size()), SOData.BlendEnables.data(), SOData.BlendEquations.data(), SOData.ColorWriteMasks.data());
+    m_CommandBuffer.SetVertexInput(static_cast<uint32_t>(SOData.VertexBindings.size()), SOData.VertexBindings.data(),
+                                   static_cast<uint32_t>(SOData.VertexAttributes.size()), SOData.VertexAttributes.data());
+    m_CommandBuffer.SetInputAssemblyState(SOData.Topology, SOData.PrimitiveRestartEnable, SOData.PatchControlPoints);
+
+    m_CommandBuffer.SetStencilReference(m_StencilRef);
+    m_CommandBuffer.SetBlendConstants(m_BlendFactors);
+    // Also commits scissor rects
+    CommitViewports();
+
+    // The fragment shading rate is not part of the pipeline and must always be set when the feature is enabled
+    if (!m_State.ShadingRateIsSet && LogicalDevice.GetEnabledExtFeatures().ShadingRate.attachmentFragmentShadingRate != VK_FALSE)
+    {
+        const VkFragmentShadingRateCombinerOpKHR CombinerOps[2] = {VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR, VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR};
+        m_CommandBuffer.SetFragmentShadingRate(VkExtent2D{1, 1}, CombinerOps);
+    }
+
+    // Extended dynamic states override the pipeline states set above
+    if (m_pPipelineState->HasExtendedDynamicState())
+        CommitExtendedDynamicStates();
+}
+
 void DeviceContextVkImpl::CommitVkVertexBuffers()
 {
 #ifdef DILIGENT_DEVELOPMENT
@@ -737,7 +1047,7 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     VERIFY((m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE) || m_DynamicRenderingInfo, "No render pass is active while executing draw command");
 #endif
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
 
     if (!m_State.CommittedVBsUpToDate && m_pPipelineState->GetNumBufferSlotsUsed() > 0)
     {
@@ -1002,6 +1312,11 @@ void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
     ++m_State.NumCommands;
 }
 
+void DeviceContextVkImpl::ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs)
+{
+    UNSUPPORTED("ExecuteIndirectCommands is not supported in Vulkan");
+}
+
 void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
     TDeviceContextBase::DrawMesh(Attribs, 0);
@@ -1147,7 +1462,7 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
 
     ITextureViewVk* pVkDSV = ClassPtrCast<ITextureViewVk>(pView);
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
 
     const TextureViewDesc& ViewDesc = pVkDSV->GetDesc();
     VERIFY(ViewDesc.TextureDim != RESOURCE_DIM_TEX_3D, "Depth-stencil view of a 3D texture should've been created as 2D texture array view");
@@ -1171,6 +1486,24 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
                 m_DynamicRenderingInfo->SetStencilAttachmentClearValue(Stencil);
             }
         }
+        else if (CanUseImplicitLoadOps() && !m_RenderPassKey.ReadOnlyDSV)
+        {
+            // Implicit render pass has not been started yet
+            PrepareDeferredAttachmentClear(StateTransitionMode);
+
+            VkClearDepthStencilValue& ClearValue = m_PendingLoadOps.ClearValues[MAX_RENDER_TARGETS].depthStencil;
+            if (ClearFlags & CLEAR_DEPTH_FLAG)
+            {
+                ClearValue.depth = fDepth;
+                m_PendingLoadOps.ClearMask |= RenderPassCache::RenderPassCacheKey::DepthAttachmentBit;
+            }
+            if (ClearFlags & CLEAR_STENCIL_FLAG)
+            {
+                ClearValue.stencil = Stencil;
+                m_PendingLoadOps.ClearMask |= RenderPassCache::RenderPassCacheKey::StencilAttachmentBit;
+            }
+            m_PendingLoadOps.DiscardMask &= ~m_PendingLoadOps.ClearMask;
+        }
         else
         {
             VERIFY_EXPR((m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE) || m_DynamicRenderingInfo);
@@ -1267,7 +1600,7 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
     if (RGBA == nullptr)
         RGBA = Zero;
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
 
     const TextureViewDesc& ViewDesc = pVkRTV->GetDesc();
     VERIFY(ViewDesc.TextureDim != RESOURCE_DIM_TEX_3D, "Render target view of a 3D texture should've been created as 2D texture array view");
@@ -1298,6 +1631,15 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
             // Dynamic render pass has not been started yet
             m_DynamicRenderingInfo->SetColorAttachmentClearValue(attachmentIndex, vkClearValue);
         }
+        else if (CanUseImplicitLoadOps())
+        {
+            // Implicit render pass has not been started yet
+            PrepareDeferredAttachmentClear(StateTransitionMode);
+
+            m_PendingLoadOps.ClearValues[attachmentIndex].color = vkClearValue;
+            m_PendingLoadOps.ClearMask |= 1u << attachmentIndex;
+            m_PendingLoadOps.DiscardMask &= ~(1u << attachmentIndex);
+        }
         else
         {
             if (m_pActiveRenderPass == nullptr)
@@ -1424,17 +1766,41 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    // Events of the completed split barriers. If a deferred context's command list
+    // has never been executed, the events are not used by the GPU.
+    for (VulkanUtilities::EventWrapper& Event : m_UsedSplitBarrierEvents)
+        m_pDevice->SafeReleaseDeviceObject(std::move(Event), QueueMask != 0 ? QueueMask : ~Uint64{0});
+    m_UsedSplitBarrierEvents.clear();
+
+    if (IsDeferred())
+    {
+        // Retire the command pools used during this frame. A retired pool is reset as a whole and
+        // reused once the GPU has finished executing all its command buffers. Note that m_CmdPool
+        // may still reference the retired pool, which is safe as the pool is kept alive.
+        const size_t NumQueueFamilies = m_pDevice->GetPhysicalDevice().GetQueueProperties().size();
+        for (size_t i = 0; i < NumQueueFamilies; ++i)
+        {
+            std::unique_ptr<VulkanUtilities::CommandBufferPool>& Pool = m_QueueFamilyCmdPools[i];
+            if (Pool && Pool->IsInUse())
+                m_RetiredCmdPools.emplace_back(std::move(Pool));
+        }
+    }
+
     EndFrame();
 }
 
 void DeviceContextVkImpl::Flush()
 {
+    UpdateGPUFrameTimer();
     Flush(0, nullptr);
 }
 
 void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
                                 ICommandList* const* ppCommandLists)
 {
+    DILIGENT_TRACE_SCOPE("Flush");
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Submit};
+
     DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
 
     DEV_CHECK_ERR(m_ActiveQueriesCounter == 0,
@@ -1444,15 +1810,20 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr,
                   "Flushing device context inside an active render pass.");
 
-    // TODO: replace with small_vector
-    std::vector<VkCommandBuffer>               vkCmdBuffs;
-    std::vector<RefCntAutoPtr<IDeviceContext>> DeferredCtxs;
+    FrameArena::Scope                                       Arena;
+    FrameArena::Vector<VkCommandBuffer>                     vkCmdBuffs{Arena.MakeAllocator<VkCommandBuffer>()};
+    FrameArena::Vector<RefCntAutoPtr<IDeviceContext>>       DeferredCtxs{Arena.MakeAllocator<RefCntAutoPtr<IDeviceContext>>()};
+    FrameArena::Vector<VulkanUtilities::CommandBufferPool*> DeferredCmdPools{Arena.MakeAllocator<VulkanUtilities::CommandBufferPool*>()};
     vkCmdBuffs.reserve(size_t{NumCommandLists} + 1);
     DeferredCtxs.reserve(size_t{NumCommandLists} + 1);
+    DeferredCmdPools.reserve(NumCommandLists);
 
     VkCommandBuffer vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
     if (vkCmdBuff != VK_NULL_HANDLE)
     {
+        if (m_PendingBufferUpdates.IsPending())
+            FlushPendingBufferUpdates();
+
         if (m_pQueryMgr != nullptr)
         {
             VERIFY_EXPR(!IsDeferred());
@@ -1485,7 +1856,19 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
         DeferredCtxs.emplace_back();
         vkCmdBuffs.emplace_back();
-        pCmdListVk->Close(DeferredCtxs.back(), vkCmdBuffs.back());
+        DeferredCmdPools.emplace_back();
+        if (pCmdListVk->IsReusable())
+        {
+            // Reusable command list keeps the ownership of the command buffer
+            DEV_CHECK_ERR(pCmdListVk->GetCommandQueueId() == GetCommandQueueId(), "Reusable command list must be executed in the immediate context it was recorded for.");
+            vkCmdBuffs.back()   = pCmdListVk->GetVkCmdBuffer();
+            DeferredCtxs.back() = pCmdListVk->GetDeferredContext();
+        }
+        else
+        {
+            pCmdListVk->Close(DeferredCtxs.back(), vkCmdBuffs.back(), DeferredCmdPools.back());
+            VERIFY_EXPR(DeferredCmdPools.back() != nullptr);
+        }
         VERIFY(vkCmdBuffs.back() != VK_NULL_HANDLE, "Trying to execute empty command buffer");
         VERIFY_EXPR(DeferredCtxs.back() != nullptr);
     }
@@ -1571,6 +1954,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
 
     // Submit command buffer even if there are no commands to release stale resources.
     Uint64 SubmittedFenceValue = m_pDevice->ExecuteCommandBuffer(GetCommandQueueId(), SubmitInfo, &m_SignalFences);
+    ++m_Stats.QueueSubmits;
 
     // Recycle semaphores
     {
@@ -1606,9 +1990,15 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         DeviceContextVkImpl* pDeferredCtxVkImpl = DeferredCtxs[i].RawPtr<DeviceContextVkImpl>();
         // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context
         pDeferredCtxVkImpl->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+        if (DeferredCmdPools[i] == nullptr)
+        {
+            // Reusable command list disposes the command buffer when it is destroyed
+            ClassPtrCast<CommandListVkImpl>(ppCommandLists[i])->SetLastSubmittedFenceValue(SubmittedFenceValue);
+            continue;
+        }
         // It is OK to dispose command buffer from another thread. We are not going to
         // record any commands and only need to add the buffer to the queue
-        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), std::move(vkCmdBuffs[buff_idx]), SubmittedFenceValue);
+        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), std::move(vkCmdBuffs[buff_idx]), *DeferredCmdPools[i], SubmittedFenceValue);
     }
     VERIFY_EXPR(buff_idx == vkCmdBuffs.size());
 
@@ -1627,7 +2017,7 @@ void DeviceContextVkImpl::SetVertexBuffers(Uint32                         StartS
                                            RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
                                            SET_VERTEX_BUFFERS_FLAGS       Flags)
 {
-    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+    const bool StreamsChanged = TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags, 0);
     for (Uint32 Buff = 0; Buff < m_NumVertexStreams; ++Buff)
     {
         VertexStreamInfo<BufferVkImpl>& CurrStream = m_VertexStreams[Buff];
@@ -1637,7 +2027,8 @@ void DeviceContextVkImpl::SetVertexBuffers(Uint32                         StartS
                                           "Setting vertex buffers (DeviceContextVkImpl::SetVertexBuffers)");
         }
     }
-    m_State.CommittedVBsUpToDate = false;
+    if (StreamsChanged)
+        m_State.CommittedVBsUpToDate = false;
 }
 
 void DeviceContextVkImpl::InvalidateState()
@@ -1650,6 +2041,8 @@ void DeviceContextVkImpl::InvalidateState()
     m_BindInfo      = {};
     m_vkRenderPass  = VK_NULL_HANDLE;
     m_vkFramebuffer = VK_NULL_HANDLE;
+    m_RenderPassKey = {};
+    m_PendingLoadOps.Reset();
     m_DynamicRenderingInfo.reset();
 
     VERIFY(!m_CommandBuffer.IsInRenderScope(), "Invalidating context with unfinished render pass");
@@ -1658,12 +2051,13 @@ void DeviceContextVkImpl::InvalidateState()
 
 void DeviceContextVkImpl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
-    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+    const bool IndexBufferChanged = TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode, 0);
     if (m_pIndexBuffer)
     {
         TransitionOrVerifyBufferState(*m_pIndexBuffer, StateTransitionMode, RESOURCE_STATE_INDEX_BUFFER, VK_ACCESS_INDEX_READ_BIT, "Binding buffer as index buffer  (DeviceContextVkImpl::SetIndexBuffer)");
     }
-    m_State.CommittedIBUpToDate = false;
+    if (IndexBufferChanged)
+        m_State.CommittedIBUpToDate = false;
 }
 
 
@@ -1709,14 +2103,22 @@ void DeviceContextVkImpl::CommitViewports()
         VkViewports[vp].y      = VkViewports[vp].y + VkViewports[vp].height;
         VkViewports[vp].height = -VkViewports[vp].height;
     }
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
+    if (m_pPipelineState && m_pPipelineState->UsesShaderObjects())
+    {
+        // The viewport count is not known in advance when shader objects are used,
+        // and the scissor count must always match it.
+        m_CommandBuffer.SetViewportsWithCount(m_NumViewports, VkViewports);
+        CommitScissorRects();
+        return;
+    }
     // TODO: reinterpret_cast m_Viewports to VkViewports?
     m_CommandBuffer.SetViewports(0, m_NumViewports, VkViewports);
 }
 
 void DeviceContextVkImpl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
 {
-    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+    const bool ViewportsChanged = TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
     VERIFY(NumViewports == m_NumViewports, "Unexpected number of viewports");
 
     if (m_State.NullRenderTargets)
@@ -1739,7 +2141,7 @@ void DeviceContextVkImpl::SetViewports(Uint32 NumViewports, const Viewport* pVie
 
     // If no graphics PSO is currently bound, viewports will be committed by
     // the SetPipelineState() when a graphics PSO is set.
-    if (m_pPipelineState && m_pPipelineState->GetDesc().IsAnyGraphicsPipeline())
+    if (ViewportsChanged && m_pPipelineState && m_pPipelineState->GetDesc().IsAnyGraphicsPipeline())
     {
         CommitViewports();
     }
@@ -1747,6 +2149,37 @@ void DeviceContextVkImpl::SetViewports(Uint32 NumViewports, const Viewport* pVie
 
 void DeviceContextVkImpl::CommitScissorRects()
 {
+    if (m_pPipelineState && m_pPipelineState->UsesShaderObjects())
+    {
+        if (m_NumViewports == 0)
+            return; // Viewports have not been set in the context yet
+
+        // Scissor test can't be disabled when shader objects are used, so
+        // full-size rects are set for the viewports that have no scissor rects.
+        const bool                    ScissorEnable = m_pPipelineState->GetGraphicsPipelineDesc().RasterizerDesc.ScissorEnable;
+        const VkPhysicalDeviceLimits& Limits        = m_pDevice->GetPhysicalDevice().GetProperties().limits;
+
+        VkRect2D VkScissorRects[MAX_VIEWPORTS]; // Do not waste time initializing array with zeroes
+        for (Uint32 sr = 0; sr < m_NumViewports; ++sr)
+        {
+            if (ScissorEnable && sr < m_NumScissorRects)
+            {
+                const Rect& SrcRect       = m_ScissorRects[sr];
+                VkScissorRects[sr].offset = {SrcRect.left, SrcRect.top};
+                VkScissorRects[sr].extent = {static_cast<uint32_t>(SrcRect.right - SrcRect.left), static_cast<uint32_t>(SrcRect.bottom - SrcRect.top)};
+            }
+            else
+            {
+                VkScissorRects[sr].offset = {0, 0};
+                VkScissorRects[sr].extent = {Limits.maxViewportDimensions[0], Limits.maxViewportDimensions[1]};
+            }
+        }
+
+        EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
+        m_CommandBuffer.SetScissorRectsWithCount(m_NumViewports, VkScissorRects);
+        return;
+    }
+
     VERIFY(m_pPipelineState && m_pPipelineState->GetGraphicsPipelineDesc().RasterizerDesc.ScissorEnable, "Scissor test must be enabled in the graphics pipeline");
 
     if (m_NumScissorRects == 0)
@@ -1760,7 +2193,7 @@ void DeviceContextVkImpl::CommitScissorRects()
         VkScissorRects[sr].extent = {static_cast<uint32_t>(SrcRect.right - SrcRect.left), static_cast<uint32_t>(SrcRect.bottom - SrcRect.top)};
     }
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
     // TODO: reinterpret_cast m_Viewports to m_Viewports?
     m_CommandBuffer.SetScissorRects(0, m_NumScissorRects, VkScissorRects);
 }
@@ -1768,7 +2201,8 @@ void DeviceContextVkImpl::CommitScissorRects()
 
 void DeviceContextVkImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
 {
-    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+    if (!TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight))
+        return;
 
     // Only commit scissor rects if scissor test is enabled in the rasterizer state.
     // If scissor is currently disabled, or no PSO is bound, scissor rects will be committed by
@@ -1851,7 +2285,10 @@ void DeviceContextVkImpl::CommitRenderPassAndFramebuffer(bool VerifyStates)
         if (m_vkFramebuffer != VK_NULL_HANDLE)
         {
             VERIFY_EXPR(m_vkRenderPass != VK_NULL_HANDLE);
-            m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+            if (!m_PendingLoadOps.IsPending())
+                m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+            else
+                BeginRenderPassWithPendingLoadOps();
         }
         else if (DynamicRenderingHash != 0)
         {
@@ -1861,8 +2298,154 @@ void DeviceContextVkImpl::CommitRenderPassAndFramebuffer(bool VerifyStates)
     }
 }
 
+bool DeviceContextVkImpl::CanUseImplicitLoadOps() const
+{
+    // Load operations can only be set for the implicit render pass that has not been started yet
+    return (m_pActiveRenderPass == nullptr &&
+            !m_DynamicRenderingInfo &&
+            m_vkFramebuffer != VK_NULL_HANDLE &&
+            m_CommandBuffer.GetState().Framebuffer != m_vkFramebuffer);
+}
+
+void DeviceContextVkImpl::PrepareDeferredAttachmentClear(RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    if (m_PendingLoadOps.ClearMask != 0)
+    {
+        // Render targets have been transitioned by the previous deferred clear
+        return;
+    }
+
+    // Transitions do not write attachment contents, so pending discards remain valid.
+    // Hide them from the EnsureVkCmdBuffer() call made by TransitionRenderTargets().
+    const Uint32 DiscardMask     = m_PendingLoadOps.DiscardMask;
+    m_PendingLoadOps.DiscardMask = 0;
+    TransitionRenderTargets(StateTransitionMode);
+    m_PendingLoadOps.DiscardMask = DiscardMask;
+}
+
+void DeviceContextVkImpl::CommitPendingLoadOps()
+{
+    if (m_PendingLoadOps.ClearMask != 0)
+    {
+        // Begin the render pass to perform the pending clears
+        CommitRenderPassAndFramebuffer(/*VerifyStates = */ false);
+    }
+    // Pending discards only apply if the render pass begins before any other command is recorded
+    m_PendingLoadOps.Reset();
+}
+
+void DeviceContextVkImpl::BeginRenderPassWithPendingLoadOps()
+{
+    const RenderPassCache::RenderPassCacheKey Key = m_RenderPassKey.WithLoadOps(m_PendingLoadOps.ClearMask, m_PendingLoadOps.DiscardMask);
+
+    // Render passes that only differ in load operations are compatible, so the
+    // render pass can be used with the framebuffer and pipelines created for m_vkRenderPass.
+    RenderPassCache*  RPCache     = m_pDevice->GetImplicitRenderPassCache();
+    RenderPassVkImpl* pRenderPass = RPCache != nullptr ? RPCache->GetRenderPass(Key) : nullptr;
+    if (pRenderPass == nullptr)
+    {
+        UNEXPECTED("Unable to get render pass with pending load operations for the currently bound render targets");
+        m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+        m_PendingLoadOps.Reset();
+        return;
+    }
+
+    // Attachments of the implicit render pass are the depth-stencil buffer followed by non-null render
+    // targets (see GetImplicitRenderPassDesc). Only attachments up to the last cleared one need clear values.
+    std::array<VkClearValue, MAX_RENDER_TARGETS + 1> ClearValues;
+
+    Uint32 AttachmentCount = 0;
+    Uint32 ClearValueCount = 0;
+    if (Key.DSVFormat != TEX_FORMAT_UNKNOWN)
+    {
+        ClearValues[AttachmentCount++] = m_PendingLoadOps.ClearValues[MAX_RENDER_TARGETS];
+        if ((Key.ClearMask & (RenderPassCache::RenderPassCacheKey::DepthAttachmentBit | RenderPassCache::RenderPassCacheKey::StencilAttachmentBit)) != 0)
+            ClearValueCount = AttachmentCount;
+    }
+    for (Uint32 rt = 0; rt < Key.NumRenderTargets; ++rt)
+    {
+        if (Key.RTVFormats[rt] == TEX_FORMAT_UNKNOWN)
+            continue;
+
+        ClearValues[AttachmentCount++] = m_PendingLoadOps.ClearValues[rt];
+        if ((Key.ClearMask & (1u << rt)) != 0)
+            ClearValueCount = AttachmentCount;
+    }
+
+    m_CommandBuffer.BeginRenderPass(pRenderPass->GetVkRenderPass(), m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight,
+                                    ClearValueCount, ClearValueCount > 0 ? ClearValues.data() : nullptr);
+    m_PendingLoadOps.Reset();
+}
+
+void DeviceContextVkImpl::InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil)
+{
+    TDeviceContextBase::InvalidateRenderTargets(RenderTargetMask, InvalidateDepthStencil);
+
+    // Load and store operations are fixed when the render pass begins, so invalidation
+    // only affects the implicit render pass that has not been started yet.
+    if (!CanUseImplicitLoadOps())
+        return;
+
+    Uint32 DiscardMask = 0;
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        if ((RenderTargetMask & (1u << rt)) != 0 && m_pBoundRenderTargets[rt])
+            DiscardMask |= 1u << rt;
+    }
+    if (InvalidateDepthStencil && m_pBoundDepthStencil && !m_RenderPassKey.ReadOnlyDSV)
+        DiscardMask |= RenderPassCache::RenderPassCacheKey::DepthAttachmentBit | RenderPassCache::RenderPassCacheKey::StencilAttachmentBit;
+
+    // Discarding the attachment supersedes its pending clear
+    m_PendingLoadOps.ClearMask &= ~DiscardMask;
+    m_PendingLoadOps.DiscardMask |= DiscardMask;
+}
+
+bool DeviceContextVkImpl::RecentFramebufferInfo::IsSameTargets(const RecentFramebufferInfo& rhs) const
+{
+    // clang-format off
+    return vkFramebuffer    != VK_NULL_HANDLE       &&
+           NumRenderTargets == rhs.NumRenderTargets &&
+           Width            == rhs.Width            &&
+           Height           == rhs.Height           &&
+           Slices           == rhs.Slices           &&
+           Samples          == rhs.Samples          &&
+           ViewIDs          == rhs.ViewIDs;
+    // clang-format on
+}
+
 void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
 {
+    FramebufferCache* FBCache = m_pDevice->GetFramebufferCache();
+    RenderPassCache*  RPCache = m_pDevice->GetImplicitRenderPassCache();
+
+    RecentFramebufferInfo BoundTargets;
+    if (FBCache != nullptr && RPCache != nullptr)
+    {
+        // Rebinding recently used targets only requires comparing view IDs
+        // and does not need to look up the render pass and framebuffer caches.
+        BoundTargets.NumRenderTargets = m_NumBoundRenderTargets;
+        for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+            BoundTargets.ViewIDs[rt] = m_pBoundRenderTargets[rt] ? m_pBoundRenderTargets[rt]->GetUniqueID() : 0;
+        BoundTargets.ViewIDs[MAX_RENDER_TARGETS]     = m_pBoundDepthStencil ? m_pBoundDepthStencil->GetUniqueID() : 0;
+        BoundTargets.ViewIDs[MAX_RENDER_TARGETS + 1] = m_pBoundShadingRateMap ? m_pBoundShadingRateMap->GetUniqueID() : 0;
+
+        BoundTargets.Width   = m_FramebufferWidth;
+        BoundTargets.Height  = m_FramebufferHeight;
+        BoundTargets.Slices  = m_FramebufferSlices;
+        BoundTargets.Samples = m_FramebufferSamples;
+
+        for (const RecentFramebufferInfo& Recent : m_RecentFramebuffers)
+        {
+            if (Recent.IsSameTargets(BoundTargets))
+            {
+                m_vkRenderPass  = Recent.vkRenderPass;
+                m_vkFramebuffer = Recent.vkFramebuffer;
+                m_RenderPassKey = Recent.RenderPassKey;
+                return;
+            }
+        }
+    }
+
     FramebufferCache::FramebufferCacheKey FBKey;
     RenderPassCache::RenderPassCacheKey   RenderPassKey;
     if (m_pBoundDepthStencil)
@@ -1915,8 +2498,6 @@ void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
         RenderPassKey.EnableVRS = false;
     }
 
-    FramebufferCache* FBCache = m_pDevice->GetFramebufferCache();
-    RenderPassCache*  RPCache = m_pDevice->GetImplicitRenderPassCache();
     if (FBCache != nullptr && RPCache != nullptr)
     {
         if (RenderPassVkImpl* pRenderPass = RPCache->GetRenderPass(RenderPassKey))
@@ -1925,6 +2506,17 @@ void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
             FBKey.Pass             = m_vkRenderPass;
             FBKey.CommandQueueMask = ~Uint64{0};
             m_vkFramebuffer        = FBCache->GetFramebuffer(FBKey, m_FramebufferWidth, m_FramebufferHeight, m_FramebufferSlices);
+            m_RenderPassKey        = RenderPassKey;
+
+            if (m_vkFramebuffer != VK_NULL_HANDLE)
+            {
+                BoundTargets.vkRenderPass  = m_vkRenderPass;
+                BoundTargets.vkFramebuffer = m_vkFramebuffer;
+                BoundTargets.RenderPassKey = RenderPassKey;
+
+                m_RecentFramebuffers[m_NextRecentFramebuffer] = BoundTargets;
+                m_NextRecentFramebuffer                       = (m_NextRecentFramebuffer + 1) % NumRecentFramebuffers;
+            }
         }
         else
         {
@@ -1973,6 +2565,11 @@ void DeviceContextVkImpl::EndRenderScope()
         // Apply clears
         CommitRenderPassAndFramebuffer(/*VerifyStates = */ false);
     }
+    else if (m_PendingLoadOps.IsPending())
+    {
+        // Apply clears of the implicit render pass
+        CommitPendingLoadOps();
+    }
 
     if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE)
     {
@@ -1991,6 +2588,11 @@ void DeviceContextVkImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Att
             // If there are pending clears, we must begin and end the render pass to apply the clears
             CommitRenderPassAndFramebuffer(/*VerifyStates = */ false);
         }
+        else if (m_PendingLoadOps.IsPending())
+        {
+            // Begin the implicit render pass for the previous render targets to apply the clears
+            CommitPendingLoadOps();
+        }
 
         ChooseRenderPassAndFramebuffer();
 
@@ -2011,6 +2613,8 @@ void DeviceContextVkImpl::ResetRenderTargets()
     EndRenderScope();
     m_vkRenderPass  = VK_NULL_HANDLE;
     m_vkFramebuffer = VK_NULL_HANDLE;
+    m_RenderPassKey = {};
+    m_PendingLoadOps.Reset();
     m_DynamicRenderingInfo.reset();
     m_State.ShadingRateIsSet = false;
 }
@@ -2115,6 +2719,47 @@ void DeviceContextVkImpl::UpdateBuffer(IBuffer*                       pBuffer,
 
     DEV_CHECK_ERR(pBuffVk->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers must be updated via Map()");
 
+    if (Size <= MaxPendingBufferUpdateSize)
+    {
+        VERIFY(pBuffVk->m_VulkanBuffer != VK_NULL_HANDLE, "Copy destination buffer must not be suballocated");
+        const VkBuffer vkDstBuffer = pBuffVk->GetVkBuffer();
+
+        PendingBufferUpdates& Pending = m_PendingBufferUpdates;
+        if (Pending.IsPending())
+        {
+            // No commands have been recorded since the first pending update, so the buffer
+            // is still in COPY_DEST state unless its state has been changed by the application.
+            const bool CanAppend =
+                Pending.vkDstBuffer == vkDstBuffer &&
+                Pending.Regions.size() < MaxPendingBufferUpdateRegions &&
+                !Pending.Overlaps(Offset, Size) &&
+                !(StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION && pBuffVk->IsInKnownState() && pBuffVk->GetState() != RESOURCE_STATE_COPY_DEST);
+            if (!CanAppend)
+                FlushPendingBufferUpdates();
+        }
+
+        if (!Pending.IsPending())
+        {
+            EnsureVkCmdBuffer();
+            TransitionOrVerifyBufferState(*pBuffVk, StateTransitionMode, RESOURCE_STATE_COPY_DEST, VK_ACCESS_TRANSFER_WRITE_BIT, "Updating buffer (DeviceContextVkImpl::UpdateBuffer)");
+            Pending.vkDstBuffer = vkDstBuffer;
+        }
+        else if (StateTransitionMode != RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+        {
+            // Only verifies the state
+            TransitionOrVerifyBufferState(*pBuffVk, StateTransitionMode, RESOURCE_STATE_COPY_DEST, VK_ACCESS_TRANSFER_WRITE_BIT, "Updating buffer (DeviceContextVkImpl::UpdateBuffer)");
+        }
+
+        VkBufferCopy Region;
+        Region.srcOffset = AlignUp(Pending.Data.size(), size_t{4});
+        Region.dstOffset = Offset;
+        Region.size      = Size;
+        Pending.Data.resize(StaticCast<size_t>(Region.srcOffset + Size));
+        memcpy(&Pending.Data[StaticCast<size_t>(Region.srcOffset)], pData, StaticCast<size_t>(Size));
+        Pending.Regions.push_back(Region);
+        return;
+    }
+
     constexpr size_t Alignment = 4;
     // Source buffer offset must be multiple of 4 (18.4)
     VulkanUploadAllocation TmpSpace = m_UploadHeap.Allocate(Size, Alignment);
@@ -2124,6 +2769,35 @@ void DeviceContextVkImpl::UpdateBuffer(IBuffer*                       pBuffer,
     // pages will be discarded
 }
 
+void DeviceContextVkImpl::FlushPendingBufferUpdates()
+{
+    PendingBufferUpdates& Pending = m_PendingBufferUpdates;
+    VERIFY_EXPR(Pending.IsPending() && Pending.vkDstBuffer != VK_NULL_HANDLE);
+    // The command buffer is created when the first update is added
+    VERIFY_EXPR(m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE);
+
+    const VkBufferCopy& FirstRegion = Pending.Regions[0];
+    if (Pending.Regions.size() == 1 && (FirstRegion.dstOffset % 4) == 0 && (FirstRegion.size % 4) == 0)
+    {
+        // A single small update is written inline into the command buffer and needs no upload space
+        m_CommandBuffer.UpdateBuffer(Pending.vkDstBuffer, FirstRegion.dstOffset, FirstRegion.size, Pending.Data.data());
+    }
+    else
+    {
+        // Source buffer offset must be multiple of 4 (18.4)
+        VulkanUploadAllocation TmpSpace = m_UploadHeap.Allocate(Pending.Data.size(), 4);
+        memcpy(TmpSpace.CPUAddress, Pending.Data.data(), Pending.Data.size());
+        for (VkBufferCopy& Region : Pending.Regions)
+            Region.srcOffset += TmpSpace.AlignedOffset;
+        m_CommandBuffer.CopyBuffer(TmpSpace.vkBuffer, Pending.vkDstBuffer, static_cast<uint32_t>(Pending.Regions.size()), Pending.Regions.data());
+    }
+    ++m_State.NumCommands;
+
+    Pending.vkDstBuffer = VK_NULL_HANDLE;
+    Pending.Regions.clear();
+    Pending.Data.clear();
+}
+
 void DeviceContextVkImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
                                      Uint64                         SrcOffset,
                                      RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
@@ -2332,7 +3006,54 @@ void DeviceContextVkImpl::UpdateTexture(ITexture*                      pTexture,
 
     if (SubresData.pSrcBuffer != nullptr)
     {
-        UNSUPPORTED("Copying buffer to texture is not implemented");
+        const TextureDesc& TexDesc = pTexVk->GetDesc();
+        VERIFY(TexDesc.SampleCount == 1, "Only single-sample textures can be updated with vkCmdCopyBufferToImage()");
+
+        BufferVkImpl* pSrcBuffVk = ClassPtrCast<BufferVkImpl>(SubresData.pSrcBuffer);
+
+        const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(TexDesc.Format);
+        // The stride is not aligned, so RowSize == RowStride
+        const BufferToTextureCopyInfo CopyInfo = GetBufferToTextureCopyInfo(TexDesc.Format, DstBox, 1);
+
+        DEV_CHECK_ERR(SubresData.Stride >= CopyInfo.RowSize, "Source buffer stride (", SubresData.Stride, ") is below the image row size (", CopyInfo.RowSize, ")");
+        // bufferImageHeight is always zero, so depth slices must be tightly packed (18.4)
+        DEV_CHECK_ERR(CopyInfo.Region.Depth() == 1 || SubresData.DepthStride == 0 || SubresData.DepthStride == SubresData.Stride * CopyInfo.RowCount,
+                      "Source buffer depth stride (", SubresData.DepthStride, ") must be equal to the stride multiplied by the number of rows (",
+                      SubresData.Stride * CopyInfo.RowCount, ")");
+
+        Uint32 RowStrideInTexels = 0;
+        if (FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED)
+        {
+            DEV_CHECK_ERR((SubresData.Stride % FmtAttribs.ComponentSize) == 0, "Source buffer stride (", SubresData.Stride,
+                          ") must be a multiple of the compressed block size (", Uint32{FmtAttribs.ComponentSize}, ")");
+            RowStrideInTexels = StaticCast<Uint32>(SubresData.Stride / Uint64{FmtAttribs.ComponentSize} * Uint64{FmtAttribs.BlockWidth});
+        }
+        else
+        {
+            const Uint32 TexelSize = Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+            DEV_CHECK_ERR((SubresData.Stride % TexelSize) == 0, "Source buffer stride (", SubresData.Stride,
+                          ") must be a multiple of the texel size (", TexelSize, ")");
+            RowStrideInTexels = StaticCast<Uint32>(SubresData.Stride / TexelSize);
+        }
+
+        const Uint64 SrcBufferOffset = SubresData.SrcOffset + GetDynamicBufferOffset(pSrcBuffVk);
+        // If the calling command's VkImage parameter is a compressed image, bufferOffset must be a multiple of
+        // the compressed texel block size in bytes (18.4)
+        DEV_CHECK_ERR((SrcBufferOffset % 4) == 0 && (FmtAttribs.ComponentType != COMPONENT_TYPE_COMPRESSED || (SrcBufferOffset % FmtAttribs.ComponentSize) == 0),
+                      "Source buffer offset (", SrcBufferOffset, ") must be a multiple of 4 and of the compressed block size");
+
+        EnsureVkCmdBuffer();
+        TransitionOrVerifyBufferState(*pSrcBuffVk, SrcBufferStateTransitionMode, RESOURCE_STATE_COPY_SOURCE, VK_ACCESS_TRANSFER_READ_BIT,
+                                      "Using buffer as copy source (DeviceContextVkImpl::UpdateTexture)");
+        CopyBufferToTexture(pSrcBuffVk->GetVkBuffer(),
+                            SrcBufferOffset,
+                            RowStrideInTexels,
+                            *pTexVk,
+                            CopyInfo.Region,
+                            MipLevel,
+                            Slice,
+                            TextureStateTransitionMode);
+        ++m_State.NumCommands;
     }
     else
     {
@@ -2552,9 +3273,9 @@ void DeviceContextVkImpl::UpdateTextureRegion(const void*                    pSr
                         TextureTransitionMode);
 }
 
-void DeviceContextVkImpl::GenerateMips(ITextureView* pTexView)
+void DeviceContextVkImpl::GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags)
 {
-    TDeviceContextBase::GenerateMips(pTexView);
+    TDeviceContextBase::GenerateMips(pTexView, Flags);
     GenerateMipsVkHelper::GenerateMips(*ClassPtrCast<TextureViewVkImpl>(pTexView), *this);
 }
 
@@ -2827,6 +3548,9 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
 
+    if (m_PendingBufferUpdates.IsPending())
+        FlushPendingBufferUpdates();
+
     EndRenderScope();
 
     VkCommandBuffer vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
@@ -2834,7 +3558,7 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to end command buffer");
     (void)err;
 
-    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff)};
+    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff, m_CmdPool, SoftwareQueueIndex{m_DstImmediateContextId})};
     pCmdListVk->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
     m_CommandBuffer.Reset();
@@ -2974,6 +3698,80 @@ void DeviceContextVkImpl::EndQuery(IQuery* pQuery)
     }
 }
 
+void DeviceContextVkImpl::BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    TDeviceContextBase::BeginPoolQuery(pQueryPool, Index, 0);
+
+    QueryPoolVkImpl* pQueryPoolVk = ClassPtrCast<QueryPoolVkImpl>(pQueryPool);
+    const QUERY_TYPE QueryType    = pQueryPoolVk->GetDesc().Type;
+
+    EnsureVkCmdBuffer();
+
+    const VulkanUtilities::CommandBuffer::StateCache& CmdBuffState = m_CommandBuffer.GetState();
+    if ((CmdBuffState.InsidePassQueries | CmdBuffState.OutsidePassQueries) & (1u << QueryType))
+    {
+        LOG_ERROR_MESSAGE("Another query of type ", GetQueryTypeString(QueryType),
+                          " is currently active. Overlapping queries do not work in Vulkan. "
+                          "End the first query before beginning another one.");
+        return;
+    }
+
+    ++m_ActiveQueriesCounter;
+    m_CommandBuffer.BeginQuery(pQueryPoolVk->GetVkQueryPool(),
+                               Index,
+                               // Without VK_QUERY_CONTROL_PRECISE_BIT, an implementation may generate
+                               // any non-zero result value if the count of passing samples is non-zero.
+                               QueryType == QUERY_TYPE_OCCLUSION ? VK_QUERY_CONTROL_PRECISE_BIT : 0,
+                               1u << QueryType);
+}
+
+void DeviceContextVkImpl::EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    TDeviceContextBase::EndPoolQuery(pQueryPool, Index, 0);
+
+    QueryPoolVkImpl* pQueryPoolVk = ClassPtrCast<QueryPoolVkImpl>(pQueryPool);
+    const QUERY_TYPE QueryType    = pQueryPoolVk->GetDesc().Type;
+
+    EnsureVkCmdBuffer();
+    if (QueryType == QUERY_TYPE_TIMESTAMP)
+    {
+        m_CommandBuffer.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pQueryPoolVk->GetVkQueryPool(), Index);
+        return;
+    }
+
+    VERIFY(m_ActiveQueriesCounter > 0, "Active query counter is 0 which means there was a mismatch between BeginPoolQuery() / EndPoolQuery() calls");
+
+    const VulkanUtilities::CommandBuffer::StateCache& CmdBuffState = m_CommandBuffer.GetState();
+    VERIFY((CmdBuffState.InsidePassQueries | CmdBuffState.OutsidePassQueries) & (1u << QueryType),
+           "No query flag is set which indicates there was no matching BeginPoolQuery call or there was an error while beginning the query.");
+    if (CmdBuffState.OutsidePassQueries & (1 << QueryType))
+        EndRenderScope();
+
+    --m_ActiveQueriesCounter;
+    m_CommandBuffer.EndQuery(pQueryPoolVk->GetVkQueryPool(), Index, 1u << QueryType);
+}
+
+void DeviceContextVkImpl::ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs)
+{
+    TDeviceContextBase::ResolvePoolQueries(Attribs, 0);
+
+    QueryPoolVkImpl* pQueryPoolVk = ClassPtrCast<QueryPoolVkImpl>(Attribs.pQueryPool);
+    BufferVkImpl*    pDstBuffVk   = ClassPtrCast<BufferVkImpl>(Attribs.pDstBuffer);
+
+    EnsureVkCmdBuffer();
+    TransitionOrVerifyBufferState(*pDstBuffVk, Attribs.DstBufferTransitionMode, RESOURCE_STATE_COPY_DEST, VK_ACCESS_TRANSFER_WRITE_BIT,
+                                  "Resolving pool queries (DeviceContextVkImpl::ResolvePoolQueries)");
+
+    const VkQueryPool vkQueryPool = pQueryPoolVk->GetVkQueryPool();
+    m_CommandBuffer.CopyQueryPoolResults(vkQueryPool, Attribs.FirstQuery, Attribs.QueryCount,
+                                         pDstBuffVk->GetVkBuffer(), Attribs.DstOffset, sizeof(Uint64),
+                                         VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+    // Query commands for the same query execute in submission order, so the reset
+    // does not affect the copy and makes the queries available for the next use.
+    m_CommandBuffer.ResetQueryPool(vkQueryPool, Attribs.FirstQuery, Attribs.QueryCount);
+    ++m_State.NumCommands;
+}
+
 
 void DeviceContextVkImpl::TransitionImageLayout(ITexture* pTexture, VkImageLayout NewLayout)
 {
@@ -3012,7 +3810,8 @@ void DeviceContextVkImpl::TransitionTextureState(TextureVkImpl&           Textur
                                                  RESOURCE_STATE           OldState,
                                                  RESOURCE_STATE           NewState,
                                                  STATE_TRANSITION_FLAGS   Flags,
-                                                 VkImageSubresourceRange* pSubresRange /* = nullptr*/)
+                                                 VkImageSubresourceRange* pSubresRange /* = nullptr*/,
+                                                 VkEvent                  vkWaitEvent /* = VK_NULL_HANDLE*/)
 {
     VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
     if (OldState == RESOURCE_STATE_UNKNOWN)
@@ -3082,7 +3881,10 @@ void DeviceContextVkImpl::TransitionTextureState(TextureVkImpl&           Textur
 
     if (((OldState & NewState) != NewState) || OldLayout != NewLayout || AfterWrite)
     {
-        m_CommandBuffer.TransitionImageLayout(vkImg, OldLayout, NewLayout, *pSubresRange, OldStages, NewStages);
+        if (vkWaitEvent != VK_NULL_HANDLE)
+            m_CommandBuffer.WaitEventImageLayout(vkWaitEvent, vkImg, OldLayout, NewLayout, *pSubresRange, OldStages, NewStages);
+        else
+            m_CommandBuffer.TransitionImageLayout(vkImg, OldLayout, NewLayout, *pSubresRange, OldStages, NewStages);
         if ((Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0)
         {
             TextureVk.SetState(NewState);
@@ -3097,6 +3899,13 @@ void DeviceContextVkImpl::TransitionOrVerifyTextureState(TextureVkImpl&
                                                          VkImageLayout                  ExpectedLayout,
                                                          const char*                    OperationName)
 {
+    if (Texture.IsInConstantState())
+    {
+        DEV_CHECK_ERR(RequiredState == RESOURCE_STATE_SHADER_RESOURCE, OperationName, ": texture '", Texture.GetDesc().Name,
+                      "' was created with MISC_TEXTURE_FLAG_CONSTANT_STATE flag and can only be used in RESOURCE_STATE_SHADER_RESOURCE state.");
+        return;
+    }
+
     if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
         VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
@@ -3137,7 +3946,11 @@ VkCommandBuffer DeviceContextVkImpl::GetVkCommandBuffer()
     return m_CommandBuffer.GetVkCmdBuffer();
 }
 
-void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateBufferState)
+void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl&  BufferVk,
+                                                RESOURCE_STATE OldState,
+                                                RESOURCE_STATE NewState,
+                                                bool           UpdateBufferState,
+                                                VkEvent        vkWaitEvent /* = VK_NULL_HANDLE*/)
 {
     VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
     if (OldState == RESOURCE_STATE_UNKNOWN)
@@ -3175,7 +3988,10 @@ void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE
         VkPipelineStageFlags NewAccessFlags = ResourceStateFlagsToVkAccessFlags(NewState);
         VkPipelineStageFlags OldStages      = ResourceStateFlagsToVkPipelineStageFlags(OldState);
         VkPipelineStageFlags NewStages      = ResourceStateFlagsToVkPipelineStageFlags(NewState);
-        m_CommandBuffer.MemoryBarrier(OldAccessFlags, NewAccessFlags, OldStages, NewStages);
+        if (vkWaitEvent != VK_NULL_HANDLE)
+            m_CommandBuffer.WaitEventMemoryBarrier(vkWaitEvent, OldAccessFlags, NewAccessFlags, OldStages, NewStages);
+        else
+            m_CommandBuffer.MemoryBarrier(OldAccessFlags, NewAccessFlags, OldStages, NewStages);
         if (UpdateBufferState)
         {
             BufferVk.SetState(NewState);
@@ -3349,6 +4165,10 @@ VulkanDynamicAllocation DeviceContextVkImpl::AllocateDynamicSpace(Uint64 SizeInB
 {
     DEV_CHECK_ERR(SizeInBytes < std::numeric_limits<Uint32>::max(),
                   "Dynamic allocation size must be less than 2^32");
+    DEV_CHECK_ERR((m_CommandListFlags & COMMAND_LIST_FLAG_REUSABLE) == 0,
+                  "Dynamic memory must not be used in reusable command lists as it is only valid in the current frame.");
+
+    m_Stats.DynamicUploadBytes += SizeInBytes;
 
     VulkanDynamicAllocation DynAlloc = m_DynamicHeap.Allocate(static_cast<Uint32>(SizeInBytes), Alignment);
 #ifdef DILIGENT_DEVELOPMENT
@@ -3364,6 +4184,8 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
     if (BarrierCount == 0)
         return;
 
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Barrier};
+
     EnsureVkCmdBuffer();
 
     for (Uint32 i = 0; i < BarrierCount; ++i)
@@ -3374,8 +4196,8 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
 #endif
         if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN)
         {
-            // Skip begin-split barriers
             VERIFY((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0, "Resource state can't be updated in begin-split barrier");
+            BeginSplitBarrier(Barrier);
             continue;
         }
         if (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING)
@@ -3386,6 +4208,29 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
         {
             VERIFY(Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE || Barrier.TransitionType == STATE_TRANSITION_TYPE_END, "Unexpected barrier type");
 
+            RESOURCE_STATE OldState    = Barrier.OldState;
+            VkEvent        vkWaitEvent = VK_NULL_HANDLE;
+            if (Barrier.TransitionType == STATE_TRANSITION_TYPE_END)
+            {
+                auto SplitIt = std::find_if(m_PendingSplitBarriers.begin(), m_PendingSplitBarriers.end(),
+                                            [&Barrier](const PendingSplitBarrier& Split) {
+                                                return (Split.pResource.RawPtr() == Barrier.pResource &&
+                                                        Split.FirstMipLevel == Barrier.FirstMipLevel &&
+                                                        Split.MipLevelsCount == Barrier.MipLevelsCount &&
+                                                        Split.FirstArraySlice == Barrier.FirstArraySlice &&
+                                                        Split.ArraySliceCount == Barrier.ArraySliceCount &&
+                                                        Split.NewState == Barrier.NewState);
+                                            });
+                if (SplitIt != m_PendingSplitBarriers.end())
+                {
+                    // The source stage mask of the wait must match the stage mask of the event
+                    OldState    = SplitIt->OldState;
+                    vkWaitEvent = SplitIt->Event;
+                    m_UsedSplitBarrierEvents.emplace_back(std::move(SplitIt->Event));
+                    m_PendingSplitBarriers.erase(SplitIt);
+                }
+            }
+
             if (RefCntAutoPtr<TextureVkImpl> pTexture{Barrier.pResource, IID_TextureVk})
             {
                 VkImageSubresourceRange SubResRange;
@@ -3394,11 +4239,11 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
                 SubResRange.levelCount     = (Barrier.MipLevelsCount == REMAINING_MIP_LEVELS) ? VK_REMAINING_MIP_LEVELS : Barrier.MipLevelsCount;
                 SubResRange.baseArrayLayer = Barrier.FirstArraySlice;
                 SubResRange.layerCount     = (Barrier.ArraySliceCount == REMAINING_ARRAY_SLICES) ? VK_REMAINING_ARRAY_LAYERS : Barrier.ArraySliceCount;
-                TransitionTextureState(*pTexture, Barrier.OldState, Barrier.NewState, Barrier.Flags, &SubResRange);
+                TransitionTextureState(*pTexture, OldState, Barrier.NewState, Barrier.Flags, &SubResRange, vkWaitEvent);
             }
             else if (RefCntAutoPtr<BufferVkImpl> pBuffer{Barrier.pResource, IID_BufferVk})
             {
-                TransitionBufferState(*pBuffer, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
+                TransitionBufferState(*pBuffer, OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0, vkWaitEvent);
             }
             else if (RefCntAutoPtr<BottomLevelASVkImpl> pBottomLevelAS{Barrier.pResource, IID_BottomLevelAS})
             {
@@ -3416,6 +4261,55 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
     }
 }
 
+void DeviceContextVkImpl::BeginSplitBarrier(const StateTransitionDesc& Barrier)
+{
+    // Events are not supported by transfer queues
+    if ((m_Desc.QueueType & COMMAND_QUEUE_TYPE_PRIMARY_MASK) == COMMAND_QUEUE_TYPE_TRANSFER)
+        return;
+
+    if (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING)
+        return;
+
+    RESOURCE_STATE OldState = Barrier.OldState;
+    if (RefCntAutoPtr<TextureVkImpl> pTexture{Barrier.pResource, IID_TextureVk})
+    {
+        if (OldState == RESOURCE_STATE_UNKNOWN && pTexture->IsInKnownState())
+            OldState = pTexture->GetState();
+    }
+    else if (RefCntAutoPtr<BufferVkImpl> pBuffer{Barrier.pResource, IID_BufferVk})
+    {
+        if (OldState == RESOURCE_STATE_UNKNOWN && pBuffer->IsInKnownState())
+            OldState = pBuffer->GetState();
+    }
+    else
+    {
+        // Acceleration structures are transitioned by the end-split barrier
+        return;
+    }
+
+    // If the state is unknown, the end-split barrier will report an error
+    if (OldState == RESOURCE_STATE_UNKNOWN)
+        return;
+
+    VkEventCreateInfo EventCI{};
+    EventCI.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+    EventCI.pNext = nullptr;
+    EventCI.flags = 0;
+
+    PendingSplitBarrier Split;
+    Split.pResource       = Barrier.pResource;
+    Split.FirstMipLevel   = Barrier.FirstMipLevel;
+    Split.MipLevelsCount  = Barrier.MipLevelsCount;
+    Split.FirstArraySlice = Barrier.FirstArraySlice;
+    Split.ArraySliceCount = Barrier.ArraySliceCount;
+    Split.OldState        = OldState;
+    Split.NewState        = Barrier.NewState;
+    Split.Event           = m_pDevice->GetLogicalDevice().CreateEvent(EventCI, "Split barrier event");
+
+    m_CommandBuffer.SetEvent(Split.Event, ResourceStateFlagsToVkPipelineStageFlags(OldState));
+    m_PendingSplitBarriers.emplace_back(std::move(Split));
+}
+
 void DeviceContextVkImpl::AliasingBarrier(IDeviceObject* pResourceBefore, IDeviceObject* pResourceAfter)
 {
     auto GetResourceBindFlags = [](IDeviceObject* pResource) //
@@ -3516,9 +4410,10 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
     TransitionOrVerifyBLASState(*pBLASVk, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
     TransitionOrVerifyBufferState(*pScratchVk, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, OpName);
 
-    VkAccelerationStructureBuildGeometryInfoKHR           vkASBuildInfo = {};
-    std::vector<VkAccelerationStructureBuildRangeInfoKHR> vkRanges;
-    std::vector<VkAccelerationStructureGeometryKHR>       vkGeometries;
+    FrameArena::Scope                                            Arena;
+    VkAccelerationStructureBuildGeometryInfoKHR                  vkASBuildInfo = {};
+    FrameArena::Vector<VkAccelerationStructureBuildRangeInfoKHR> vkRanges{Arena.MakeAllocator<VkAccelerationStructureBuildRangeInfoKHR>()};
+    FrameArena::Vector<VkAccelerationStructureGeometryKHR>       vkGeometries{Arena.MakeAllocator<VkAccelerationStructureGeometryKHR>()};
 
     if (Attribs.pTriangleData != nullptr)
     {
@@ -3694,7 +4589,17 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
     TransitionOrVerifyTLASState(*pTLASVk, Attribs.TLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
     TransitionOrVerifyBufferState(*pScratchVk, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, OpName);
 
-    if (Attribs.Update)
+    if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_DIRTY)
+    {
+        if (!pTLASVk->UpdateDirtyInstances(Attribs.pInstances, Attribs.DirtyInstanceCount))
+            return;
+    }
+    else if (Attribs.pInstances == nullptr)
+    {
+        VERIFY_EXPR(Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_GPU);
+        // Instances of the previous build are reused
+    }
+    else if (Attribs.Update)
     {
         if (!pTLASVk->UpdateInstances(Attribs.pInstances, Attribs.InstanceCount, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
             return;
@@ -3705,41 +4610,95 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
             return;
     }
 
-    // copy instance data into instance buffer
+    auto WriteInstance = [&](const TLASBuildInstanceData& Inst, VkAccelerationStructureInstanceKHR& vkASInst, Uint32& InstanceIndex) {
+        const TLASInstanceDesc InstDesc = pTLASVk->GetInstanceDesc(Inst.InstanceName);
+        if (InstDesc.InstanceIndex >= Attribs.InstanceCount)
+        {
+            UNEXPECTED("Failed to find instance by name");
+            return false;
+        }
+        InstanceIndex = InstDesc.InstanceIndex;
+
+        BottomLevelASVkImpl* pBLASVk = ClassPtrCast<BottomLevelASVkImpl>(Inst.pBLAS);
+
+        static_assert(sizeof(vkASInst.transform) == sizeof(Inst.Transform), "size mismatch");
+        std::memcpy(&vkASInst.transform, Inst.Transform.data, sizeof(vkASInst.transform));
+
+        vkASInst.instanceCustomIndex                    = Inst.CustomId;
+        vkASInst.instanceShaderBindingTableRecordOffset = InstDesc.ContributionToHitGroupIndex;
+        vkASInst.mask                                   = Inst.Mask;
+        vkASInst.flags                                  = InstanceFlagsToVkGeometryInstanceFlags(Inst.Flags);
+        vkASInst.accelerationStructureReference         = pBLASVk->GetVkDeviceAddress();
+
+        TransitionOrVerifyBLASState(*pBLASVk, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+        return true;
+    };
+
+    static_assert(TLAS_INSTANCE_UPLOAD_MODE_COUNT == 3, "Please handle the new instance upload mode below");
+    if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_ALL)
     {
+        // copy instance data into instance buffer
         size_t                 Size     = Attribs.InstanceCount * sizeof(VkAccelerationStructureInstanceKHR);
         VulkanUploadAllocation TmpSpace = m_UploadHeap.Allocate(Size, 16);
 
+        VkAccelerationStructureInstanceKHR* pDstInstances = static_cast<VkAccelerationStructureInstanceKHR*>(TmpSpace.CPUAddress);
         for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
         {
-            const TLASBuildInstanceData& Inst     = Attribs.pInstances[i];
-            const TLASInstanceDesc       InstDesc = pTLASVk->GetInstanceDesc(Inst.InstanceName);
-
-            if (InstDesc.InstanceIndex >= Attribs.InstanceCount)
-            {
-                UNEXPECTED("Failed to find instance by name");
+            VkAccelerationStructureInstanceKHR vkASInst{};
+            Uint32                             InstanceIndex = 0;
+            if (!WriteInstance(Attribs.pInstances[i], vkASInst, InstanceIndex))
                 return;
-            }
+            pDstInstances[InstanceIndex] = vkASInst;
+        }
 
-            VkAccelerationStructureInstanceKHR& vkASInst = static_cast<VkAccelerationStructureInstanceKHR*>(TmpSpace.CPUAddress)[InstDesc.InstanceIndex];
-            BottomLevelASVkImpl*                pBLASVk  = ClassPtrCast<BottomLevelASVkImpl>(Inst.pBLAS);
+        UpdateBufferRegion(pInstancesVk, Attribs.InstanceBufferOffset, Size, TmpSpace.vkBuffer, TmpSpace.AlignedOffset, Attribs.InstanceBufferTransitionMode);
+    }
+    else if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_DIRTY && Attribs.DirtyInstanceCount > 0)
+    {
+        // Only the changed instances are uploaded. They are sorted by instance index
+        // so that every contiguous range is copied with a single command.
+        const Uint32           NumDirty = Attribs.DirtyInstanceCount;
+        const size_t           Size     = NumDirty * sizeof(VkAccelerationStructureInstanceKHR);
+        VulkanUploadAllocation TmpSpace = m_UploadHeap.Allocate(Size, 16);
 
-            static_assert(sizeof(vkASInst.transform) == sizeof(Inst.Transform), "size mismatch");
-            std::memcpy(&vkASInst.transform, Inst.Transform.data, sizeof(vkASInst.transform));
+        std::vector<std::pair<Uint32, VkAccelerationStructureInstanceKHR>> DirtyInstances(NumDirty);
+        for (Uint32 i = 0; i < NumDirty; ++i)
+        {
+            if (!WriteInstance(Attribs.pInstances[i], DirtyInstances[i].second, DirtyInstances[i].first))
+                return;
+        }
+        std::sort(DirtyInstances.begin(), DirtyInstances.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
 
-            vkASInst.instanceCustomIndex                    = Inst.CustomId;
-            vkASInst.instanceShaderBindingTableRecordOffset = InstDesc.ContributionToHitGroupIndex;
-            vkASInst.mask                                   = Inst.Mask;
-            vkASInst.flags                                  = InstanceFlagsToVkGeometryInstanceFlags(Inst.Flags);
-            vkASInst.accelerationStructureReference         = pBLASVk->GetVkDeviceAddress();
+        VkAccelerationStructureInstanceKHR* pDstInstances = static_cast<VkAccelerationStructureInstanceKHR*>(TmpSpace.CPUAddress);
+        Uint32                              RangeStart    = 0;
+        for (Uint32 i = 0; i < NumDirty; ++i)
+        {
+            pDstInstances[i] = DirtyInstances[i].second;
+            if (i + 1 < NumDirty && DirtyInstances[i + 1].first == DirtyInstances[i].first + 1)
+                continue;
 
+            UpdateBufferRegion(pInstancesVk,
+                               Attribs.InstanceBufferOffset + Uint64{DirtyInstances[RangeStart].first} * sizeof(VkAccelerationStructureInstanceKHR),
+                               (i + 1 - RangeStart) * sizeof(VkAccelerationStructureInstanceKHR),
+                               TmpSpace.vkBuffer,
+                               TmpSpace.AlignedOffset + RangeStart * sizeof(VkAccelerationStructureInstanceKHR),
+                               Attribs.InstanceBufferTransitionMode);
+            RangeStart = i + 1;
+        }
+    }
+    else if (Attribs.InstanceUploadMode == TLAS_INSTANCE_UPLOAD_MODE_GPU && Attribs.pInstances != nullptr)
+    {
+        for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
+        {
+            BottomLevelASVkImpl* pBLASVk = ClassPtrCast<BottomLevelASVkImpl>(Attribs.pInstances[i].pBLAS);
             TransitionOrVerifyBLASState(*pBLASVk, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
         }
-
-        UpdateBufferRegion(pInstancesVk, Attribs.InstanceBufferOffset, Size, TmpSpace.vkBuffer, TmpSpace.AlignedOffset, Attribs.InstanceBufferTransitionMode);
     }
     TransitionOrVerifyBufferState(*pInstancesVk, Attribs.InstanceBufferTransitionMode, RESOURCE_STATE_BUILD_AS_READ, VK_ACCESS_SHADER_READ_BIT, OpName);
 
+    const bool Update = IsTLASUpdate(Attribs);
+
     VkAccelerationStructureBuildGeometryInfoKHR     vkASBuildInfo = {};
     VkAccelerationStructureBuildRangeInfoKHR        vkRange       = {};
     VkAccelerationStructureBuildRangeInfoKHR const* vkRangePtr    = &vkRange;
@@ -3764,8 +4723,8 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
     vkASBuildInfo.sType                     = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
     vkASBuildInfo.type                      = VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR;                    // type must be compatible with create info
     vkASBuildInfo.flags                     = BuildASFlagsToVkBuildAccelerationStructureFlags(TLASDesc.Flags); // flags must be compatible with create info
-    vkASBuildInfo.mode                      = Attribs.Update ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
-    vkASBuildInfo.srcAccelerationStructure  = Attribs.Update ? pTLASVk->GetVkTLAS() : VK_NULL_HANDLE;
+    vkASBuildInfo.mode                      = Update ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
+    vkASBuildInfo.srcAccelerationStructure  = Update ? pTLASVk->GetVkTLAS() : VK_NULL_HANDLE;
     vkASBuildInfo.dstAccelerationStructure  = pTLASVk->GetVkTLAS();
     vkASBuildInfo.geometryCount             = 1;
     vkASBuildInfo.pGeometries               = &vkASGeometry;
@@ -4017,7 +4976,7 @@ void DeviceContextVkImpl::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_COM
                 ShadingRateCombinerToVkFragmentShadingRateCombinerOp(TextureCombiner) //
             };
 
-        EnsureVkCmdBuffer();
+        EnsureVkCmdBuffer(/*KeepPendingLoadOps = */ true);
         m_CommandBuffer.SetFragmentShadingRate(ShadingRateToVkFragmentSize(BaseRate), CombinerOps);
         m_State.ShadingRateIsSet = true;
     }
@@ -4073,11 +5032,12 @@ void DeviceContextVkImpl::BindSparseResourceMemory(const BindSparseResourceMemor
             ++ImageBindCount;
     }
 
-    std::vector<VkSparseBufferMemoryBindInfo>      vkBufferBinds{Attribs.NumBufferBinds};
-    std::vector<VkSparseImageOpaqueMemoryBindInfo> vkImageOpaqueBinds{ImageOpqBindCount};
-    std::vector<VkSparseImageMemoryBindInfo>       vkImageBinds{ImageBindCount};
-    std::vector<VkSparseMemoryBind>                vkMemoryBinds{MemoryBindCount};
-    std::vector<VkSparseImageMemoryBind>           vkImageMemoryBinds{ImageMemoryBindCount};
+    FrameArena::Scope                                     Arena;
+    FrameArena::Vector<VkSparseBufferMemoryBindInfo>      vkBufferBinds(Attribs.NumBufferBinds, Arena.MakeAllocator<VkSparseBufferMemoryBindInfo>());
+    FrameArena::Vector<VkSparseImageOpaqueMemoryBindInfo> vkImageOpaqueBinds(ImageOpqBindCount, Arena.MakeAllocator<VkSparseImageOpaqueMemoryBindInfo>());
+    FrameArena::Vector<VkSparseImageMemoryBindInfo>       vkImageBinds(ImageBindCount, Arena.MakeAllocator<VkSparseImageMemoryBindInfo>());
+    FrameArena::Vector<VkSparseMemoryBind>                vkMemoryBinds(MemoryBindCount, Arena.MakeAllocator<VkSparseMemoryBind>());
+    FrameArena::Vector<VkSparseImageMemoryBind>           vkImageMemoryBinds(ImageMemoryBindCount, Arena.MakeAllocator<VkSparseImageMemoryBind>());
 
     MemoryBindCount      = 0;
     ImageMemoryBindCount = 0;
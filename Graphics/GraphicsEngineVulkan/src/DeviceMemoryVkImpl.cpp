@@ -48,10 +48,14 @@ DeviceMemoryVkImpl::DeviceMemoryVkImpl(IReferenceCounters*           pRefCounter
     const VulkanUtilities::PhysicalDevice& PhysicalDevice = m_pDevice->GetPhysicalDevice();
     const VulkanUtilities::LogicalDevice&  LogicalDevice  = m_pDevice->GetLogicalDevice();
 
-    if (MemCI.NumResources == 0)
+    // Placed memory may be created without compatible resources, in which case
+    // the first device-local memory type is used.
+    const bool IsSparseMemory = m_Desc.Type == DEVICE_MEMORY_TYPE_SPARSE;
+
+    if (MemCI.NumResources == 0 && IsSparseMemory)
         DEVMEM_CHECK_CREATE_INFO("Vulkan requires at least one resource to choose memory type");
 
-    if (MemCI.ppCompatibleResources == nullptr)
+    if (MemCI.NumResources != 0 && MemCI.ppCompatibleResources == nullptr)
         DEVMEM_CHECK_CREATE_INFO("ppCompatibleResources must not be null");
 
     uint32_t MemoryTypeBits = ~0u;
@@ -62,16 +66,26 @@ DeviceMemoryVkImpl::DeviceMemoryVkImpl(IReferenceCounters*           pRefCounter
         if (RefCntAutoPtr<ITextureVk> pTexture{pResource, IID_TextureVk})
         {
             const TextureVkImpl* pTexVk = pTexture.ConstPtr<TextureVkImpl>();
-            if (pTexVk->GetDesc().Usage != USAGE_SPARSE)
-                DEVMEM_CHECK_CREATE_INFO("ppCompatibleResources[", i, "] must be created with USAGE_SPARSE");
+            if ((pTexVk->GetDesc().Usage == USAGE_SPARSE) != IsSparseMemory)
+            {
+                if (IsSparseMemory)
+                    DEVMEM_CHECK_CREATE_INFO("ppCompatibleResources[", i, "] must be created with USAGE_SPARSE");
+                else
+                    DEVMEM_CHECK_CREATE_INFO("ppCompatibleResources[", i, "] must not be created with USAGE_SPARSE");
+            }
 
             MemoryTypeBits &= LogicalDevice.GetImageMemoryRequirements(pTexVk->GetVkImage()).memoryTypeBits;
         }
         else if (RefCntAutoPtr<IBufferVk> pBuffer{pResource, IID_BufferVk})
         {
             const BufferVkImpl* pBuffVk = pBuffer.ConstPtr<BufferVkImpl>();
-            if (pBuffVk->GetDesc().Usage != USAGE_SPARSE)
-                DEVMEM_CHECK_CREATE_INFO("ppCompatibleResources[", i, "] must be created with USAGE_SPARSE");
+            if ((pBuffVk->GetDesc().Usage == USAGE_SPARSE) != IsSparseMemory)
+            {
+                if (IsSparseMemory)
+                    DEVMEM_CHECK_CREATE_INFO("ppCompatibleResources[", i, "] must be created with USAGE_SPARSE");
+                else
+                    DEVMEM_CHECK_CREATE_INFO("ppCompatibleResources[", i, "] must not be created with USAGE_SPARSE");
+            }
 
             MemoryTypeBits &= LogicalDevice.GetBufferMemoryRequirements(pBuffVk->GetVkBuffer()).memoryTypeBits;
         }
@@ -93,8 +107,13 @@ DeviceMemoryVkImpl::DeviceMemoryVkImpl(IReferenceCounters*           pRefCounter
 
     m_MemoryTypeIndex = MemoryTypeIndex;
 
+    // Sparse and placed buffers that are used with descriptor buffers require device addresses
+    VkMemoryAllocateFlagsInfo AllocateFlags{};
+    AllocateFlags.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+    AllocateFlags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
     VkMemoryAllocateInfo MemAlloc{};
-    MemAlloc.pNext           = nullptr;
+    MemAlloc.pNext           = UseDeviceAddress() ? &AllocateFlags : nullptr;
     MemAlloc.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     MemAlloc.allocationSize  = m_Desc.PageSize;
     MemAlloc.memoryTypeIndex = m_MemoryTypeIndex;
@@ -113,6 +132,16 @@ DeviceMemoryVkImpl::~DeviceMemoryVkImpl()
 
 IMPLEMENT_QUERY_INTERFACE(DeviceMemoryVkImpl, IID_DeviceMemoryVk, TDeviceMemoryBase)
 
+bool DeviceMemoryVkImpl::UseDeviceAddress() const
+{
+    if (m_pDevice->UseDescriptorBuffers())
+        return true;
+
+    // Placed ray-tracing buffers require device addresses
+    return m_Desc.Type == DEVICE_MEMORY_TYPE_PLACED &&
+        m_pDevice->GetLogicalDevice().GetEnabledExtFeatures().BufferDeviceAddress.bufferDeviceAddress != VK_FALSE;
+}
+
 Bool DeviceMemoryVkImpl::Resize(Uint64 NewSize)
 {
     DvpVerifyResize(NewSize);
@@ -120,8 +149,12 @@ Bool DeviceMemoryVkImpl::Resize(Uint64 NewSize)
     const VulkanUtilities::LogicalDevice& LogicalDevice = m_pDevice->GetLogicalDevice();
     const size_t                          NewPageCount  = StaticCast<size_t>(NewSize / m_Desc.PageSize);
 
+    VkMemoryAllocateFlagsInfo AllocateFlags{};
+    AllocateFlags.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+    AllocateFlags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
     VkMemoryAllocateInfo MemAlloc{};
-    MemAlloc.pNext           = nullptr;
+    MemAlloc.pNext           = UseDeviceAddress() ? &AllocateFlags : nullptr;
     MemAlloc.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     MemAlloc.allocationSize  = m_Desc.PageSize;
     MemAlloc.memoryTypeIndex = m_MemoryTypeIndex;
@@ -201,4 +234,26 @@ DeviceMemoryRangeVk DeviceMemoryVkImpl::GetRange(Uint64 Offset, Uint64 Size) con
     return Range;
 }
 
+DeviceMemoryRangeVk DeviceMemoryVkImpl::GetPlacedRange(Uint64                      Offset,
+                                                       const VkMemoryRequirements& MemReqs,
+                                                       VkDeviceSize                Alignment,
+                                                       const char*                 ResourceName) const noexcept(false)
+{
+    if (m_Desc.Type != DEVICE_MEMORY_TYPE_PLACED)
+        LOG_ERROR_AND_THROW("Device memory '", m_Desc.Name, "' was not created with DEVICE_MEMORY_TYPE_PLACED type");
+
+    if ((MemReqs.memoryTypeBits & (1u << m_MemoryTypeIndex)) == 0)
+        LOG_ERROR_AND_THROW("Memory type of device memory '", m_Desc.Name, "' is not compatible with placed resource '", ResourceName, "'");
+
+    if ((Offset % Alignment) != 0)
+        LOG_ERROR_AND_THROW("Offset (", Offset, ") of placed resource '", ResourceName, "' is not a multiple of the required alignment (", Alignment, ")");
+
+    const DeviceMemoryRangeVk Range = GetRange(Offset, MemReqs.size);
+    if (Range.Handle == VK_NULL_HANDLE || Range.Size < MemReqs.size)
+        LOG_ERROR_AND_THROW("Placed resource '", ResourceName, "' (", MemReqs.size, " bytes at offset ", Offset,
+                            ") does not fit into device memory '", m_Desc.Name, "' (", GetCapacity(), " bytes)");
+
+    return Range;
+}
+
 } // namespace Diligent
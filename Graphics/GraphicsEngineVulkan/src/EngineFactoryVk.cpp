@@ -91,6 +91,9 @@ public:
     ///                                  the contexts will be written. Immediate context goes at
     ///                                  position 0. If EngineCI.NumDeferredContexts > 0,
     ///                                  pointers to the deferred contexts are written afterwards.
+    /// \param [in]  StartupTimes      - Times of the initialization stages that have been completed
+    ///                                  before this call. The method adds the render device and
+    ///                                  context creation times.
     void AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::Instance>       Instance,
                               std::unique_ptr<VulkanUtilities::PhysicalDevice> PhysicalDevice,
                               std::shared_ptr<VulkanUtilities::LogicalDevice>  LogicalDevice,
@@ -99,7 +102,8 @@ public:
                               const EngineVkCreateInfo&                        EngineCI,
                               const GraphicsAdapterInfo&                       AdapterInfo,
                               IRenderDevice**                                  ppDevice,
-                              IDeviceContext**                                 ppContexts);
+                              IDeviceContext**                                 ppContexts,
+                              RenderDeviceStartupTimes                         StartupTimes = {});
 
     virtual void DILIGENT_CALL_TYPE CreateSwapChainVk(IRenderDevice*       pDevice,
                                                       IDeviceContext*      pImmediateContext,
@@ -174,6 +178,14 @@ GraphicsAdapterInfo GetPhysicalDeviceGraphicsAdapterInfo(const VulkanUtilities::
     // Label all enabled features as optional
     AdapterInfo.Features = VkFeaturesToDeviceFeatures(vkVersion, vkFeatures, vkDeviceProps, vkExtFeatures, vkDeviceExtProps, DEVICE_FEATURE_STATE_OPTIONAL);
 
+    // Device-local host-visible memory is exposed by integrated GPUs and by discrete GPUs through the PCIe BAR
+    // (the entire video memory with resizable BAR enabled, a 256 MB window otherwise).
+    if (PhysicalDevice.GetMemoryTypeIndex(~uint32_t{0}, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) !=
+        VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex)
+    {
+        AdapterInfo.Features.GPUUploadMemory = DEVICE_FEATURE_STATE_OPTIONAL;
+    }
+
     // Buffer properties
     {
         BufferProperties& BufferProps{AdapterInfo.Buffer};
@@ -525,6 +537,7 @@ GraphicsAdapterInfo GetPhysicalDeviceGraphicsAdapterInfo(const VulkanUtilities::
         Mem.HostVisibleMemory   = 0;
         Mem.UnifiedMemory       = 0;
         Mem.MaxMemoryAllocation = vkDeviceExtProps.Maintenance3.maxMemoryAllocationSize;
+        Mem.PlacedResources     = True; // vkBindImageMemory/vkBindBufferMemory at an arbitrary offset is core functionality
 
         std::bitset<VK_MAX_MEMORY_HEAPS> DeviceLocalHeap;
         std::bitset<VK_MAX_MEMORY_HEAPS> HostVisibleHeap;
@@ -697,6 +710,9 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
 
     try
     {
+        StartupStageTimer        StageTimer;
+        RenderDeviceStartupTimes StartupTimes;
+
         const Version GraphicsAPIVersion = EngineCI.GraphicsAPIVersion == Version{0, 0} ?
             Version{0xFF, 0xFF} : // Instance will use the maximum available version
             EngineCI.GraphicsAPIVersion;
@@ -724,6 +740,7 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
 #endif
 
         std::shared_ptr<VulkanUtilities::Instance> Instance = VulkanUtilities::Instance::Create(InstanceCI);
+        StartupTimes.Instance                               = StageTimer.Lap();
 
         VkPhysicalDevice vkPhysDevice = VK_NULL_HANDLE;
 #if DILIGENT_USE_OPENXR
@@ -756,9 +773,31 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
         // Enable device features if they are supported and throw an error if not supported, but required by user.
         const GraphicsAdapterInfo AdapterInfo = GetPhysicalDeviceGraphicsAdapterInfo(*PhysicalDevice);
         VerifyEngineCreateInfo(EngineCI, AdapterInfo);
-        const DeviceFeatures   EnabledFeatures   = EnableDeviceFeatures(AdapterInfo.Features, EngineCI.Features);
-        const DeviceFeaturesVk AdapterFeaturesVk = PhysicalDeviceFeaturesToDeviceFeaturesVk(PhysicalDevice->GetExtFeatures(), DEVICE_FEATURE_STATE_OPTIONAL);
-        const DeviceFeaturesVk EnabledFeaturesVk = EnableDeviceFeaturesVk(AdapterFeaturesVk, EngineCI.FeaturesVk);
+        const DeviceFeatures EnabledFeatures = EnableDeviceFeatures(AdapterInfo.Features, EngineCI.Features);
+        StartupTimes.AdapterSelection        = StageTimer.Lap();
+
+        DeviceFeaturesVk AdapterFeaturesVk = PhysicalDeviceFeaturesToDeviceFeaturesVk(PhysicalDevice->GetExtFeatures(), DEVICE_FEATURE_STATE_OPTIONAL);
+        if (AdapterFeaturesVk.DescriptorBuffer)
+        {
+            // Descriptor buffers are suballocated from the dynamic heap, so the entire heap must be
+            // addressable through the descriptor buffer binding.
+            const VkPhysicalDeviceDescriptorBufferPropertiesEXT& DescrBuffProps = PhysicalDevice->GetExtProperties().DescriptorBuffer;
+            if (DescrBuffProps.maxResourceDescriptorBufferRange < EngineCI.DynamicHeapSize ||
+                DescrBuffProps.maxSamplerDescriptorBufferRange < EngineCI.DynamicHeapSize ||
+                DescrBuffProps.maxResourceDescriptorBufferBindings < 1 ||
+                DescrBuffProps.maxSamplerDescriptorBufferBindings < 1)
+            {
+                AdapterFeaturesVk.DescriptorBuffer = DEVICE_FEATURE_STATE_DISABLED;
+            }
+        }
+        DeviceFeaturesVk EnabledFeaturesVk = EnableDeviceFeaturesVk(AdapterFeaturesVk, EngineCI.FeaturesVk);
+        if (EnabledFeaturesVk.ShaderObject && !EnabledFeaturesVk.DynamicRendering)
+        {
+            // Shader objects can only be used with dynamic rendering
+            if (EngineCI.FeaturesVk.ShaderObject == DEVICE_FEATURE_STATE_ENABLED)
+                LOG_ERROR_AND_THROW("ShaderObject feature requires DynamicRendering feature to be enabled");
+            EnabledFeaturesVk.ShaderObject = DEVICE_FEATURE_STATE_DISABLED;
+        }
 
         std::vector<VkDeviceQueueGlobalPriorityCreateInfoEXT> QueueGlobalPriority;
         std::vector<VkDeviceQueueCreateInfo>                  QueueInfos;
@@ -1162,6 +1201,27 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.HostQueryReset.pNext;
             }
 
+            if (EnabledFeatures.ExternalMemory != DEVICE_FEATURE_STATE_DISABLED)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VulkanUtilities::ExternalMemoryExtensionName));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VulkanUtilities::ExternalSemaphoreExtensionName));
+                DeviceExtensions.push_back(VulkanUtilities::ExternalMemoryExtensionName);
+                DeviceExtensions.push_back(VulkanUtilities::ExternalSemaphoreExtensionName);
+
+                EnabledExtFeats.ExternalMemory = true;
+            }
+
+            if (EnabledFeatures.Multiview != DEVICE_FEATURE_STATE_DISABLED)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_MULTIVIEW_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_MULTIVIEW_EXTENSION_NAME);
+
+                EnabledExtFeats.Multiview = DeviceExtFeatures.Multiview;
+
+                *NextExt = &EnabledExtFeats.Multiview;
+                NextExt  = &EnabledExtFeats.Multiview.pNext;
+            }
+
             if (EnabledFeatures.VariableRateShading != DEVICE_FEATURE_STATE_DISABLED)
             {
                 if (DeviceExtFeatures.ShadingRate.pipelineFragmentShadingRate != VK_FALSE ||
@@ -1173,18 +1233,23 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                     VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME));
                     VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME));
 
-                    DeviceExtensions.push_back(VK_KHR_MAINTENANCE2_EXTENSION_NAME);        // Required for RenderPass2
-                    DeviceExtensions.push_back(VK_KHR_MULTIVIEW_EXTENSION_NAME);           // Required for RenderPass2
+                    DeviceExtensions.push_back(VK_KHR_MAINTENANCE2_EXTENSION_NAME); // Required for RenderPass2
+                    if (EnabledFeatures.Multiview == DEVICE_FEATURE_STATE_DISABLED)
+                    {
+                        // Required for RenderPass2; already enabled above when multiview is requested
+                        DeviceExtensions.push_back(VK_KHR_MULTIVIEW_EXTENSION_NAME);
+
+                        EnabledExtFeats.Multiview = DeviceExtFeatures.Multiview;
+
+                        *NextExt = &EnabledExtFeats.Multiview;
+                        NextExt  = &EnabledExtFeats.Multiview.pNext;
+                    }
                     DeviceExtensions.push_back(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME); // Required for ShadingRate
                     DeviceExtensions.push_back(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME);
 
-                    EnabledExtFeats.Multiview   = DeviceExtFeatures.Multiview;
                     EnabledExtFeats.RenderPass2 = DeviceExtFeatures.RenderPass2;
                     EnabledExtFeats.ShadingRate = DeviceExtFeatures.ShadingRate;
 
-                    *NextExt = &EnabledExtFeats.Multiview;
-                    NextExt  = &EnabledExtFeats.Multiview.pNext;
-
                     *NextExt = &EnabledExtFeats.ShadingRate;
                     NextExt  = &EnabledExtFeats.ShadingRate.pNext;
                 }
@@ -1241,6 +1306,17 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.ShaderDrawParameters.pNext;
             }
 
+            if (EnabledFeatures.ExtendedDynamicState != DEVICE_FEATURE_STATE_DISABLED)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+
+                EnabledExtFeats.ExtendedDynamicState = DeviceExtFeatures.ExtendedDynamicState;
+
+                *NextExt = &EnabledExtFeats.ExtendedDynamicState;
+                NextExt  = &EnabledExtFeats.ExtendedDynamicState.pNext;
+            }
+
             if (EnabledFeaturesVk.DynamicRendering)
             {
                 VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME));
@@ -1270,6 +1346,123 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.HostImageCopy.pNext;
             }
 
+            if (EnabledFeaturesVk.DescriptorBuffer)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+                EnabledExtFeats.DescriptorBuffer = DeviceExtFeatures.DescriptorBuffer;
+
+                // disable unused features
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferCaptureReplay      = VK_FALSE;
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferImageLayoutIgnored = VK_FALSE;
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferPushDescriptors    = VK_FALSE;
+
+                *NextExt = &EnabledExtFeats.DescriptorBuffer;
+                NextExt  = &EnabledExtFeats.DescriptorBuffer.pNext;
+
+                // Buffer device address may have already been enabled for ray tracing
+                if (EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddress == VK_FALSE)
+                {
+                    VERIFY(PhysicalDevice->IsExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME), "VK_KHR_buffer_device_address extension must be supported");
+                    DeviceExtensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME); // required for VK_EXT_descriptor_buffer
+
+                    EnabledExtFeats.BufferDeviceAddress = DeviceExtFeatures.BufferDeviceAddress;
+
+                    *NextExt = &EnabledExtFeats.BufferDeviceAddress;
+                    NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
+                }
+            }
+
+            if (EnabledFeaturesVk.ShaderObject)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_SHADER_OBJECT_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+
+                EnabledExtFeats.ShaderObject = DeviceExtFeatures.ShaderObject;
+
+                *NextExt = &EnabledExtFeats.ShaderObject;
+                NextExt  = &EnabledExtFeats.ShaderObject.pNext;
+            }
+
+#if DILIGENT_USE_VOLK
+            // Push descriptors are used for small dynamic descriptor sets (see PipelineLayoutVk).
+            // They are not needed when descriptor buffers are used.
+            if (DeviceExtFeatures.PushDescriptor && !EnabledFeaturesVk.DescriptorBuffer)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+
+                EnabledExtFeats.PushDescriptor = true;
+            }
+
+            // Synchronization2 is used to flush pipeline barrier batches (see VulkanUtilities::CommandBuffer::FlushBarriers)
+            if (DeviceExtFeatures.Synchronization2.synchronization2 != VK_FALSE)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+
+                EnabledExtFeats.Synchronization2 = DeviceExtFeatures.Synchronization2;
+
+                *NextExt = &EnabledExtFeats.Synchronization2;
+                NextExt  = &EnabledExtFeats.Synchronization2.pNext;
+            }
+
+            // Graphics pipeline libraries are used to fast-link graphics pipelines from cached
+            // state subsets (see PipelineLibraryCache)
+            if (DeviceExtFeatures.GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME); // required for VK_EXT_graphics_pipeline_library
+                DeviceExtensions.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
+                EnabledExtFeats.GraphicsPipelineLibrary = DeviceExtFeatures.GraphicsPipelineLibrary;
+
+                *NextExt = &EnabledExtFeats.GraphicsPipelineLibrary;
+                NextExt  = &EnabledExtFeats.GraphicsPipelineLibrary.pNext;
+            }
+
+            // Memory budget is used by the memory manager to limit the heap usage (see EngineVkCreateInfo::MemoryBudgetUsageLimit)
+            if (DeviceExtFeatures.MemoryBudget)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
+                EnabledExtFeats.MemoryBudget = true;
+            }
+
+            // Pipeline creation feedback is used to report pipeline compile statistics (see IPipelineState::GetCompileStats)
+            if (DeviceExtFeatures.PipelineCreationFeedback)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
+
+                EnabledExtFeats.PipelineCreationFeedback = true;
+            }
+
+            // Present wait is used by swap chains in low-latency mode (see SwapChainVkImpl::Present)
+            if (DeviceExtFeatures.PresentId.presentId != VK_FALSE && DeviceExtFeatures.PresentWait.presentWait != VK_FALSE)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PRESENT_ID_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PRESENT_WAIT_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME); // required for VK_KHR_present_wait
+                DeviceExtensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+
+                EnabledExtFeats.PresentId   = DeviceExtFeatures.PresentId;
+                EnabledExtFeats.PresentWait = DeviceExtFeatures.PresentWait;
+
+                *NextExt = &EnabledExtFeats.PresentId;
+                NextExt  = &EnabledExtFeats.PresentId.pNext;
+
+                *NextExt = &EnabledExtFeats.PresentWait;
+                NextExt  = &EnabledExtFeats.PresentWait.pNext;
+            }
+
+            // Dedicated allocations are used for images when the implementation prefers them (see TextureVkImpl)
+            EnabledExtFeats.DedicatedAllocation = DeviceExtFeatures.DedicatedAllocation;
+#endif
+
             // Append user-defined features
             *NextExt = EngineCI.pDeviceExtensionFeatures;
         }
@@ -1279,7 +1472,7 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 LOG_ERROR_MESSAGE("Can not enable extended device features when VK_KHR_get_physical_device_properties2 extension is not supported by device");
         }
 
-        ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+        ASSERT_SIZEOF(DeviceFeatures, 52, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
 
         for (Uint32 i = 0; i < EngineCI.DeviceExtensionCount; ++i)
         {
@@ -1377,7 +1570,10 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
             }
         };
 
-        AttachToVulkanDevice(Instance, std::move(PhysicalDevice), LogicalDevice, static_cast<Uint32>(CommandQueues.size()), CommandQueues.data(), EngineCI, AdapterInfo, ppDevice, ppContexts);
+        StartupTimes.NativeDevice = StageTimer.Lap();
+        StartupTimes.Total        = StartupTimes.Instance + StartupTimes.AdapterSelection + StartupTimes.NativeDevice;
+
+        AttachToVulkanDevice(Instance, std::move(PhysicalDevice), LogicalDevice, static_cast<Uint32>(CommandQueues.size()), CommandQueues.data(), EngineCI, AdapterInfo, ppDevice, ppContexts, StartupTimes);
 
         m_wpDevice = *ppDevice;
     }
@@ -1395,7 +1591,8 @@ void EngineFactoryVkImpl::AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::
                                                const EngineVkCreateInfo&                        EngineCI,
                                                const GraphicsAdapterInfo&                       AdapterInfo,
                                                IRenderDevice**                                  ppDevice,
-                                               IDeviceContext**                                 ppContexts)
+                                               IDeviceContext**                                 ppContexts,
+                                               RenderDeviceStartupTimes                         StartupTimes)
 {
     if (EngineCI.EngineAPIVersion != DILIGENT_API_VERSION)
     {
@@ -1419,6 +1616,8 @@ void EngineFactoryVkImpl::AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::
 
     try
     {
+        StartupStageTimer StageTimer;
+
         IMemoryAllocator& RawMemAllocator = GetRawAllocator();
 
         RenderDeviceVkImpl* pRenderDeviceVk{
@@ -1430,6 +1629,8 @@ void EngineFactoryVkImpl::AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::
         if (m_OnRenderDeviceCreated != nullptr)
             m_OnRenderDeviceCreated(pRenderDeviceVk);
 
+        StartupTimes.RenderDevice = StageTimer.Lap();
+
         for (Uint32 CtxInd = 0; CtxInd < NumImmediateContexts; ++CtxInd)
         {
             const uint32_t           QueueId    = ppCommandQueues[CtxInd]->GetQueueFamilyIndex();
@@ -1456,6 +1657,14 @@ void EngineFactoryVkImpl::AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::
         {
             pRenderDeviceVk->CreateDeferredContext(ppContexts + NumImmediateContexts + DeferredCtx);
         }
+
+        StartupTimes.Contexts = StageTimer.Lap();
+        StartupTimes.Total += StartupTimes.RenderDevice + StartupTimes.Contexts;
+        pRenderDeviceVk->SetStartupTimes(StartupTimes);
+
+        LOG_INFO_MESSAGE("Vulkan render device initialized in ", StartupTimes.Total / 1000000, " ms (instance: ", StartupTimes.Instance / 1000000,
+                         " ms, adapter: ", StartupTimes.AdapterSelection / 1000000, " ms, logical device: ", StartupTimes.NativeDevice / 1000000,
+                         " ms, render device: ", StartupTimes.RenderDevice / 1000000, " ms, contexts: ", StartupTimes.Contexts / 1000000, " ms)");
     }
     catch (const std::runtime_error&)
     {
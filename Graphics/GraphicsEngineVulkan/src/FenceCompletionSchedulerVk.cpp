@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "FenceCompletionSchedulerVk.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include "FenceVkImpl.hpp"
+
+namespace Diligent
+{
+
+FenceCompletionSchedulerVk::FenceCompletionSchedulerVk(const VulkanUtilities::LogicalDevice& LogicalDevice) :
+    FenceCompletionScheduler{/*UseWorkerThread = */ true},
+    m_LogicalDevice{LogicalDevice},
+    m_WakeUpSemaphore{LogicalDevice.CreateTimelineSemaphore(0, "Fence completion scheduler wake-up semaphore")}
+{
+}
+
+FenceCompletionSchedulerVk::~FenceCompletionSchedulerVk()
+{
+    // The worker thread uses the wake-up semaphore
+    StopWorkerThread();
+}
+
+void FenceCompletionSchedulerVk::WaitForAny(const std::vector<FenceWaitInfo>& Fences)
+{
+    m_Semaphores.clear();
+    m_Values.clear();
+    for (const FenceWaitInfo& Fence : Fences)
+    {
+        FenceVkImpl* pFenceVk = ClassPtrCast<FenceVkImpl>(Fence.pFence);
+        VERIFY(pFenceVk->IsTimelineSemaphore(), "Fences must use timeline semaphores when NativeFence feature is enabled");
+        m_Semaphores.push_back(pFenceVk->GetVkSemaphore());
+        m_Values.push_back(Fence.Value);
+    }
+    // If WakeUp() was called after the last wait, the semaphore value is already
+    // greater than the observed one and the wait returns immediately.
+    m_Semaphores.push_back(m_WakeUpSemaphore);
+    m_Values.push_back(m_ObservedWakeUpValue + 1);
+
+    VkSemaphoreWaitInfo WaitInfo{};
+    WaitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    WaitInfo.flags          = VK_SEMAPHORE_WAIT_ANY_BIT;
+    WaitInfo.semaphoreCount = static_cast<uint32_t>(m_Semaphores.size());
+    WaitInfo.pSemaphores    = m_Semaphores.data();
+    WaitInfo.pValues        = m_Values.data();
+
+    VkResult err = m_LogicalDevice.WaitSemaphores(WaitInfo, UINT64_MAX);
+    if (err != VK_SUCCESS)
+    {
+        CHECK_VK_ERROR(err, "Failed to wait for fence completion");
+        // Do not spin if the device was lost
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    err = m_LogicalDevice.GetSemaphoreCounter(m_WakeUpSemaphore, &m_ObservedWakeUpValue);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to get wake-up semaphore counter");
+}
+
+void FenceCompletionSchedulerVk::WakeUp()
+{
+    // Timeline semaphore values must strictly increase, so signals must be serialized
+    std::lock_guard<std::mutex> Guard{m_WakeUpMtx};
+
+    VkSemaphoreSignalInfo SignalInfo{};
+    SignalInfo.sType     = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+    SignalInfo.semaphore = m_WakeUpSemaphore;
+    SignalInfo.value     = ++m_WakeUpValue;
+
+    VkResult err = m_LogicalDevice.SignalSemaphore(SignalInfo);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to signal wake-up semaphore");
+    (void)err;
+}
+
+} // namespace Diligent
@@ -49,11 +49,12 @@ FenceVkImpl::FenceVkImpl(IReferenceCounters* pRefCounters,
     }
 // clang-format on
 {
-    if (m_Desc.Type == FENCE_TYPE_GENERAL &&
-        pRenderDeviceVkImpl->GetFeatures().NativeFence)
+    // When timeline semaphores are available, all fences including CPU-wait-only and
+    // command queue internal fences use them, so that submissions do not need VkFence objects.
+    if (pRenderDeviceVkImpl->GetFeatures().NativeFence)
     {
         const VulkanUtilities::LogicalDevice& LogicalDevice{pRenderDeviceVkImpl->GetLogicalDevice()};
-        m_TimelineSemaphore = LogicalDevice.CreateTimelineSemaphore(0, m_Desc.Name);
+        m_TimelineSemaphore = LogicalDevice.CreateTimelineSemaphore(0, m_Desc.Name, (m_Desc.MiscFlags & MISC_FENCE_FLAG_EXPORTABLE) != 0);
     }
 }
 
@@ -99,6 +100,20 @@ FenceVkImpl::~FenceVkImpl()
 #endif
 }
 
+Bool FenceVkImpl::ExportSemaphoreHandle(Uint64& Handle)
+{
+    if ((m_Desc.MiscFlags & MISC_FENCE_FLAG_EXPORTABLE) == 0)
+    {
+        DEV_ERROR("Fence '", m_Desc.Name, "' was not created with MISC_FENCE_FLAG_EXPORTABLE flag");
+        return False;
+    }
+    VERIFY_EXPR(IsTimelineSemaphore());
+
+    VkResult err = m_pDevice->GetLogicalDevice().GetSemaphoreHandle(m_TimelineSemaphore, Handle);
+    CHECK_VK_ERROR(err, "Failed to export semaphore of fence '", m_Desc.Name, "'");
+    return err == VK_SUCCESS;
+}
+
 void FenceVkImpl::ImmediatelyReleaseResources()
 {
     m_TimelineSemaphore.Release();
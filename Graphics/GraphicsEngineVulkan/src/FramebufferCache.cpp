@@ -29,9 +29,10 @@
 #include "FramebufferCache.hpp"
 
 #include <array>
+#include <vector>
 
 #include "RenderDeviceVkImpl.hpp"
-#include "HashUtils.hpp"
+#include "XXH3Hasher.hpp"
 
 namespace Diligent
 {
@@ -62,9 +63,10 @@ size_t FramebufferCache::FramebufferCacheKey::GetHash() const
 {
     if (Hash == 0)
     {
-        Hash = ComputeHash(Pass, NumRenderTargets, DSV, ShadingRate, CommandQueueMask);
-        for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
-            HashCombine(Hash, RTVs[rt]);
+        XXH3Hasher Hasher;
+        Hasher(Pass, NumRenderTargets, DSV, ShadingRate, CommandQueueMask);
+        Hasher.UpdateSpan(RTVs, NumRenderTargets);
+        Hash = Hasher.Get();
     }
     return Hash;
 }
@@ -195,37 +197,57 @@ FramebufferCache::~FramebufferCache()
     VERIFY(m_RenderPassToKeyMap.empty(), "All render passes must be released and the cache must be notified");
 }
 
+template <typename HandleType>
+static void EraseKeyReference(std::unordered_multimap<HandleType, FramebufferCache::FramebufferCacheKey>& Map,
+                              HandleType                                                                 Handle,
+                              const FramebufferCache::FramebufferCacheKey&                               Key)
+{
+    auto range = Map.equal_range(Handle);
+    for (auto it = range.first; it != range.second;)
+    {
+        if (it->second == Key)
+            it = Map.erase(it);
+        else
+            ++it;
+    }
+}
+
 void FramebufferCache::OnDestroyImageView(VkImageView ImgView)
 {
     std::lock_guard<std::mutex> Lock{m_Mutex};
 
     auto equal_range = m_ViewToKeyMap.equal_range(ImgView);
+
+    std::vector<FramebufferCacheKey> Keys;
     for (auto it = equal_range.first; it != equal_range.second; ++it)
-    {
-        const FramebufferCacheKey& Key = it->second;
+        Keys.push_back(it->second);
+    m_ViewToKeyMap.erase(equal_range.first, equal_range.second);
 
+    for (const FramebufferCacheKey& Key : Keys)
+    {
         auto fb_it = m_Cache.find(Key);
         // Multiple image views may be associated with the same key.
         // The framebuffer is deleted whenever any of the image views is deleted
         if (fb_it != m_Cache.end())
         {
-            m_DeviceVk.SafeReleaseDeviceObject(std::move(fb_it->second), it->second.CommandQueueMask);
+            m_DeviceVk.SafeReleaseDeviceObject(std::move(fb_it->second), Key.CommandQueueMask);
             m_Cache.erase(fb_it);
         }
 
-        // Remove all keys from m_RenderPassToKeyMap that use the image view
+        // Remove the key from the render pass and from the other image views used by the framebuffer.
+        // Otherwise, the maps would keep growing when long-lived views (e.g. a depth buffer) are
+        // used together with short-lived ones.
+        EraseKeyReference(m_RenderPassToKeyMap, Key.Pass, Key);
+        for (Uint32 rt = 0; rt < Key.NumRenderTargets; ++rt)
         {
-            auto rp_it_range = m_RenderPassToKeyMap.equal_range(Key.Pass);
-            for (auto rp_it = rp_it_range.first; rp_it != rp_it_range.second;)
-            {
-                if (Key.UsesImageView(ImgView))
-                    rp_it = m_RenderPassToKeyMap.erase(rp_it);
-                else
-                    ++rp_it;
-            }
+            if (Key.RTVs[rt] != VK_NULL_HANDLE && Key.RTVs[rt] != ImgView)
+                EraseKeyReference(m_ViewToKeyMap, Key.RTVs[rt], Key);
         }
+        if (Key.DSV != VK_NULL_HANDLE && Key.DSV != ImgView)
+            EraseKeyReference(m_ViewToKeyMap, Key.DSV, Key);
+        if (Key.ShadingRate != VK_NULL_HANDLE && Key.ShadingRate != ImgView)
+            EraseKeyReference(m_ViewToKeyMap, Key.ShadingRate, Key);
     }
-    m_ViewToKeyMap.erase(equal_range.first, equal_range.second);
 }
 
 void FramebufferCache::OnDestroyRenderPass(VkRenderPass Pass)
@@ -70,6 +70,14 @@ FramebufferVkImpl::FramebufferVkImpl(IReferenceCounters*    pRefCounters,
     FramebufferCI.height = m_Desc.Height;
     FramebufferCI.layers = m_Desc.NumArraySlices;
 
+    const RenderPassDesc& RPDesc = pRenderPassVkImpl->GetDesc();
+    if (RPDesc.SubpassCount > 0 && RPDesc.pSubpasses[0].ViewMask != 0)
+    {
+        // When multiview is enabled, the views are taken from the attachment array slices
+        // and the framebuffer must have a single layer (VUID-VkFramebufferCreateInfo-renderPass-02531).
+        FramebufferCI.layers = 1;
+    }
+
     const VulkanUtilities::LogicalDevice& LogicalDevice = pDevice->GetLogicalDevice();
 
     m_VkFramebuffer = LogicalDevice.CreateFramebuffer(FramebufferCI, m_Desc.Name);
@@ -0,0 +1,207 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "PipelineLayoutCacheVk.hpp"
+
+#include <cstring>
+
+#include "RenderDeviceVkImpl.hpp"
+#include "XXH3Hasher.hpp"
+
+namespace Diligent
+{
+
+PipelineLayoutCacheVk::SetLayoutKey::SetLayoutKey(const VkDescriptorSetLayoutCreateInfo& SetLayoutCI) :
+    Flags{SetLayoutCI.flags}
+{
+    VERIFY(SetLayoutCI.pNext == nullptr, "Extension structures are not taken into account by the cache");
+
+    Bindings.resize(SetLayoutCI.bindingCount);
+    for (uint32_t i = 0; i < SetLayoutCI.bindingCount; ++i)
+    {
+        const VkDescriptorSetLayoutBinding& SrcBinding = SetLayoutCI.pBindings[i];
+        Binding&                            DstBinding = Bindings[i];
+
+        DstBinding.BindingIndex    = SrcBinding.binding;
+        DstBinding.DescriptorType  = SrcBinding.descriptorType;
+        DstBinding.DescriptorCount = SrcBinding.descriptorCount;
+        DstBinding.StageFlags      = SrcBinding.stageFlags;
+        if (SrcBinding.pImmutableSamplers != nullptr)
+        {
+            DstBinding.FirstImmutableSampler = static_cast<uint32_t>(ImmutableSamplers.size());
+            ImmutableSamplers.insert(ImmutableSamplers.end(), SrcBinding.pImmutableSamplers, SrcBinding.pImmutableSamplers + SrcBinding.descriptorCount);
+        }
+    }
+}
+
+bool PipelineLayoutCacheVk::SetLayoutKey::operator==(const SetLayoutKey& rhs) const
+{
+    // clang-format off
+    if (GetHash()       != rhs.GetHash()       ||
+        Flags           != rhs.Flags           ||
+        Bindings.size() != rhs.Bindings.size() ||
+        ImmutableSamplers != rhs.ImmutableSamplers)
+    {
+        return false;
+    }
+    // clang-format on
+
+    return Bindings.empty() || memcmp(Bindings.data(), rhs.Bindings.data(), Bindings.size() * sizeof(Binding)) == 0;
+}
+
+size_t PipelineLayoutCacheVk::SetLayoutKey::GetHash() const
+{
+    if (Hash == 0)
+    {
+        static_assert(sizeof(Binding) == sizeof(uint32_t) * 5, "Binding must not have padding as it is hashed and compared as raw memory");
+
+        XXH3Hasher Hasher;
+        Hasher(Flags, static_cast<Uint32>(Bindings.size()));
+        Hasher.UpdateSpan(Bindings.data(), Bindings.size());
+        Hasher.UpdateSpan(ImmutableSamplers.data(), ImmutableSamplers.size());
+        Hash = Hasher.Get();
+    }
+    return Hash;
+}
+
+bool PipelineLayoutCacheVk::PipelineLayoutKey::operator==(const PipelineLayoutKey& rhs) const
+{
+    return GetHash() == rhs.GetHash() && SetLayouts == rhs.SetLayouts;
+}
+
+size_t PipelineLayoutCacheVk::PipelineLayoutKey::GetHash() const
+{
+    if (Hash == 0)
+    {
+        XXH3Hasher Hasher;
+        Hasher.UpdateSpan(SetLayouts.data(), SetLayouts.size());
+        Hash = Hasher.Get();
+    }
+    return Hash;
+}
+
+
+template <typename KeyType, typename WrapperType>
+template <typename CreateLayoutType>
+typename PipelineLayoutCacheVk::LayoutMap<KeyType, WrapperType>::VkObjectType
+PipelineLayoutCacheVk::LayoutMap<KeyType, WrapperType>::Get(KeyType&& Key, CreateLayoutType&& CreateLayout)
+{
+    auto it = m_Layouts.find(Key);
+    if (it == m_Layouts.end())
+    {
+        WrapperType Layout = CreateLayout();
+
+        it = m_Layouts.emplace(std::move(Key), LayoutInfo{std::move(Layout), 0}).first;
+
+        const bool Inserted = m_HandleToKey.emplace(static_cast<VkObjectType>(it->second.Layout), &it->first).second;
+        VERIFY(Inserted, "Layout handle is already in the cache");
+        (void)Inserted;
+    }
+
+    ++it->second.RefCount;
+    return it->second.Layout;
+}
+
+template <typename KeyType, typename WrapperType>
+WrapperType PipelineLayoutCacheVk::LayoutMap<KeyType, WrapperType>::Release(VkObjectType vkLayout)
+{
+    auto key_it = m_HandleToKey.find(vkLayout);
+    if (key_it == m_HandleToKey.end())
+    {
+        UNEXPECTED("Layout is not found in the cache");
+        return {};
+    }
+
+    auto it = m_Layouts.find(*key_it->second);
+    VERIFY_EXPR(it != m_Layouts.end() && it->second.RefCount > 0);
+    if (--it->second.RefCount > 0)
+        return {};
+
+    WrapperType Layout = std::move(it->second.Layout);
+    m_HandleToKey.erase(key_it);
+    m_Layouts.erase(it);
+    return Layout;
+}
+
+
+PipelineLayoutCacheVk::~PipelineLayoutCacheVk()
+{
+    VERIFY(m_SetLayouts.IsEmpty(), "All descriptor set layouts must be released");
+    VERIFY(m_PipelineLayouts.IsEmpty(), "All pipeline layouts must be released");
+}
+
+VkDescriptorSetLayout PipelineLayoutCacheVk::GetDescriptorSetLayout(const VkDescriptorSetLayoutCreateInfo& SetLayoutCI)
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    return m_SetLayouts.Get(SetLayoutKey{SetLayoutCI},
+                            [&]() {
+                                return m_DeviceVk.GetLogicalDevice().CreateDescriptorSetLayout(SetLayoutCI);
+                            });
+}
+
+void PipelineLayoutCacheVk::ReleaseDescriptorSetLayout(VkDescriptorSetLayout vkSetLayout)
+{
+    VulkanUtilities::DescriptorSetLayoutWrapper SetLayout;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        SetLayout = m_SetLayouts.Release(vkSetLayout);
+    }
+    // Shared layouts may have been used by any queue
+    if (SetLayout)
+        m_DeviceVk.SafeReleaseDeviceObject(std::move(SetLayout), ~Uint64{0});
+}
+
+VkPipelineLayout PipelineLayoutCacheVk::GetPipelineLayout(const VkDescriptorSetLayout* pSetLayouts, Uint32 SetLayoutCount)
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    return m_PipelineLayouts.Get(PipelineLayoutKey{pSetLayouts, SetLayoutCount},
+                                 [&]() {
+                                     VkPipelineLayoutCreateInfo PipelineLayoutCI = {};
+
+                                     PipelineLayoutCI.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+                                     PipelineLayoutCI.pNext                  = nullptr;
+                                     PipelineLayoutCI.flags                  = 0; // reserved for future use
+                                     PipelineLayoutCI.setLayoutCount         = SetLayoutCount;
+                                     PipelineLayoutCI.pSetLayouts            = SetLayoutCount != 0 ? pSetLayouts : nullptr;
+                                     PipelineLayoutCI.pushConstantRangeCount = 0;
+                                     PipelineLayoutCI.pPushConstantRanges    = nullptr;
+                                     return m_DeviceVk.GetLogicalDevice().CreatePipelineLayout(PipelineLayoutCI);
+                                 });
+}
+
+void PipelineLayoutCacheVk::ReleasePipelineLayout(VkPipelineLayout vkPipelineLayout)
+{
+    VulkanUtilities::PipelineLayoutWrapper PipelineLayout;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        PipelineLayout = m_PipelineLayouts.Release(vkPipelineLayout);
+    }
+    if (PipelineLayout)
+        m_DeviceVk.SafeReleaseDeviceObject(std::move(PipelineLayout), ~Uint64{0});
+}
+
+} // namespace Diligent
@@ -48,20 +48,21 @@ PipelineLayoutVk::PipelineLayoutVk()
 
 PipelineLayoutVk::~PipelineLayoutVk()
 {
-    VERIFY(!m_VkPipelineLayout, "Pipeline layout have not been released!");
+    VERIFY(m_VkPipelineLayout == VK_NULL_HANDLE, "Pipeline layout have not been released!");
 }
 
-void PipelineLayoutVk::Release(RenderDeviceVkImpl* pDeviceVk, Uint64 CommandQueueMask)
+void PipelineLayoutVk::Release(RenderDeviceVkImpl* pDeviceVk)
 {
-    if (m_VkPipelineLayout)
+    if (m_VkPipelineLayout != VK_NULL_HANDLE)
     {
-        pDeviceVk->SafeReleaseDeviceObject(std::move(m_VkPipelineLayout), CommandQueueMask);
+        pDeviceVk->GetPipelineLayoutCache().ReleasePipelineLayout(m_VkPipelineLayout);
+        m_VkPipelineLayout = VK_NULL_HANDLE;
     }
 }
 
 void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<PipelineResourceSignatureVkImpl> ppSignatures[], Uint32 SignatureCount) noexcept(false)
 {
-    VERIFY(m_DescrSetCount == 0 && !m_VkPipelineLayout, "This pipeline layout is already initialized");
+    VERIFY(m_DescrSetCount == 0 && m_VkPipelineLayout == VK_NULL_HANDLE, "This pipeline layout is already initialized");
 
     std::array<VkDescriptorSetLayout, MAX_RESOURCE_SIGNATURES * PipelineResourceSignatureVkImpl::MAX_DESCRIPTOR_SETS> DescSetLayouts;
 
@@ -83,8 +84,19 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
         for (PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID SetId : {PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE,
                                                                          PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC})
         {
-            if (pSignature->HasDescriptorSet(SetId))
-                DescSetLayouts[DescSetLayoutCount++] = pSignature->GetVkDescriptorSetLayout(SetId);
+            if (!pSignature->HasDescriptorSet(SetId))
+                continue;
+
+            VkDescriptorSetLayout vkSetLayout = pSignature->GetVkDescriptorSetLayout(SetId);
+            if (SetId == PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC &&
+                pSignature->GetVkPushDescriptorSetLayout() != VK_NULL_HANDLE &&
+                m_PushDescrSetBindIndex == 0xFF)
+            {
+                // The first signature that supports push descriptors gets the push descriptor set
+                vkSetLayout             = pSignature->GetVkPushDescriptorSetLayout();
+                m_PushDescrSetBindIndex = static_cast<Uint8>(BindInd);
+            }
+            DescSetLayouts[DescSetLayoutCount++] = vkSetLayout;
         }
 
         DynamicUniformBufferCount += pSignature->GetDynamicUniformBufferCount();
@@ -102,33 +114,56 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
                             ") used by the pipeline layout exceeds device limit (", Limits.maxBoundDescriptorSets, ")");
     }
 
-    if (DynamicUniformBufferCount > Limits.maxDescriptorSetUniformBuffersDynamic)
+    // Descriptor buffers have no dynamic descriptors: offsets are baked into buffer addresses
+    if (!pDeviceVk->UseDescriptorBuffers())
     {
-        LOG_ERROR_AND_THROW("The number of dynamic uniform buffers  (", DynamicUniformBufferCount,
-                            ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetUniformBuffersDynamic, ")");
-    }
+        if (DynamicUniformBufferCount > Limits.maxDescriptorSetUniformBuffersDynamic)
+        {
+            LOG_ERROR_AND_THROW("The number of dynamic uniform buffers  (", DynamicUniformBufferCount,
+                                ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetUniformBuffersDynamic, ")");
+        }
 
-    if (DynamicStorageBufferCount > Limits.maxDescriptorSetStorageBuffersDynamic)
-    {
-        LOG_ERROR_AND_THROW("The number of dynamic storage buffers (", DynamicStorageBufferCount,
-                            ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetStorageBuffersDynamic, ")");
+        if (DynamicStorageBufferCount > Limits.maxDescriptorSetStorageBuffersDynamic)
+        {
+            LOG_ERROR_AND_THROW("The number of dynamic storage buffers (", DynamicStorageBufferCount,
+                                ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetStorageBuffersDynamic, ")");
+        }
     }
 
     VERIFY(m_DescrSetCount <= std::numeric_limits<decltype(m_DescrSetCount)>::max(),
            "Descriptor set count (", DescSetLayoutCount, ") exceeds the maximum representable value");
 
-    VkPipelineLayoutCreateInfo PipelineLayoutCI = {};
-
-    PipelineLayoutCI.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    PipelineLayoutCI.pNext                  = nullptr;
-    PipelineLayoutCI.flags                  = 0; // reserved for future use
-    PipelineLayoutCI.setLayoutCount         = DescSetLayoutCount;
-    PipelineLayoutCI.pSetLayouts            = DescSetLayoutCount ? DescSetLayouts.data() : nullptr;
-    PipelineLayoutCI.pushConstantRangeCount = 0;
-    PipelineLayoutCI.pPushConstantRanges    = nullptr;
-    m_VkPipelineLayout                      = pDeviceVk->GetLogicalDevice().CreatePipelineLayout(PipelineLayoutCI);
+    m_VkPipelineLayout = pDeviceVk->GetPipelineLayoutCache().GetPipelineLayout(DescSetLayouts.data(), DescSetLayoutCount);
 
     m_DescrSetCount = static_cast<Uint8>(DescSetLayoutCount);
 }
 
+Uint32 PipelineLayoutVk::GetVkDescriptorSetLayouts(const RefCntAutoPtr<PipelineResourceSignatureVkImpl> ppSignatures[], Uint32 SignatureCount, VkDescriptorSetLayout* pLayouts) const
+{
+    VERIFY_EXPR(pLayouts != nullptr);
+
+    Uint32 DescSetLayoutCount = 0;
+    for (Uint32 BindInd = 0; BindInd < SignatureCount; ++BindInd)
+    {
+        const RefCntAutoPtr<PipelineResourceSignatureVkImpl>& pSignature = ppSignatures[BindInd];
+        if (pSignature == nullptr)
+            continue;
+
+        VERIFY_EXPR(m_FirstDescrSetIndex[BindInd] == DescSetLayoutCount);
+        for (PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID SetId : {PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE,
+                                                                         PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC})
+        {
+            if (!pSignature->HasDescriptorSet(SetId))
+                continue;
+
+            pLayouts[DescSetLayoutCount++] = (SetId == PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC && m_PushDescrSetBindIndex == BindInd) ?
+                pSignature->GetVkPushDescriptorSetLayout() :
+                pSignature->GetVkDescriptorSetLayout(SetId);
+        }
+    }
+    VERIFY_EXPR(DescSetLayoutCount == m_DescrSetCount);
+
+    return DescSetLayoutCount;
+}
+
 } // namespace Diligent
@@ -112,6 +112,35 @@ Uint32 FindImmutableSamplerVk(const PipelineResourceDesc&          Res,
     return FindImmutableSampler(Desc.ImmutableSamplers, Desc.NumImmutableSamplers, Res.ShaderStages, Res.Name, SamplerSuffix);
 }
 
+// Batch sizes used to update dynamic descriptor sets
+struct DescriptorUpdateBatchSizes
+{
+#ifdef DILIGENT_DEBUG
+    static constexpr size_t ImgUpdate          = 4;
+    static constexpr size_t BuffUpdate         = 2;
+    static constexpr size_t TexelBuffUpdate    = 2;
+    static constexpr size_t AccelStruct        = 2;
+    static constexpr size_t WriteDescriptorSet = 2;
+#else
+    static constexpr size_t ImgUpdate          = 64;
+    static constexpr size_t BuffUpdate         = 32;
+    static constexpr size_t TexelBuffUpdate    = 16;
+    static constexpr size_t AccelStruct        = 16;
+    static constexpr size_t WriteDescriptorSet = 32;
+#endif
+};
+
+// Push descriptors must be written in a single batch, so every array must be
+// large enough to hold all descriptors of the set.
+struct PushDescriptorBatchSizes
+{
+    static constexpr size_t ImgUpdate          = PipelineResourceSignatureVkImpl::MaxPushDescriptorCount;
+    static constexpr size_t BuffUpdate         = PipelineResourceSignatureVkImpl::MaxPushDescriptorCount;
+    static constexpr size_t TexelBuffUpdate    = PipelineResourceSignatureVkImpl::MaxPushDescriptorCount;
+    static constexpr size_t AccelStruct        = PipelineResourceSignatureVkImpl::MaxPushDescriptorCount;
+    static constexpr size_t WriteDescriptorSet = PipelineResourceSignatureVkImpl::MaxPushDescriptorCount;
+};
+
 } // namespace
 
 inline PipelineResourceSignatureVkImpl::CACHE_GROUP PipelineResourceSignatureVkImpl::GetResourceCacheGroup(const PipelineResourceDesc& Res)
@@ -156,7 +185,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data());
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_DescriptorSetBufferCounts.data());
             });
     }
     catch (...)
@@ -173,17 +202,25 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
     {
         Uint32 StaticResourceCount = 0; // The total number of static resources in all stages
                                         // accounting for array sizes.
+        Uint32 StaticBufferCount   = 0; // The total number of static uniform and storage buffers
         for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
         {
             const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
             if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
-                StaticResourceCount += ResDesc.ArraySize;
+            {
+                StaticResourceCount += ResDesc.GetArraySize();
+                if (ShaderResourceCacheVk::IsBufferDescriptor(GetDescriptorType(ResDesc)))
+                    StaticBufferCount += ResDesc.GetArraySize();
+            }
         }
-        m_pStaticResCache->InitializeSets(GetRawAllocator(), 1, &StaticResourceCount);
+        m_pStaticResCache->InitializeSets(GetRawAllocator(), 1, &StaticResourceCount, &StaticBufferCount);
     }
 
     CacheOffsetsType CacheGroupSizes = {}; // Required cache size for each cache group
     BindingCountType BindingCount    = {}; // Binding count in each cache group
+
+    // The number of uniform and storage buffers in each descriptor set (static/mutable (0) or dynamic (1))
+    std::array<Uint32, DESCRIPTOR_SET_ID_NUM_SETS> SetBufferCounts = {};
     for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
     {
         const PipelineResourceDesc& ResDesc    = m_Desc.Resources[i];
@@ -191,7 +228,10 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
         BindingCount[CacheGroup] += 1;
         // Note that we may reserve space for separate immutable samplers, which will never be used, but this is OK.
-        CacheGroupSizes[CacheGroup] += ResDesc.ArraySize;
+        CacheGroupSizes[CacheGroup] += ResDesc.GetArraySize();
+
+        if (ShaderResourceCacheVk::IsBufferDescriptor(GetDescriptorType(ResDesc)))
+            SetBufferCounts[VarTypeToDescriptorSetId(ResDesc.VarType)] += ResDesc.GetArraySize();
     }
 
     // Descriptor set mapping (static/mutable (0) or dynamic (1) -> set index)
@@ -249,6 +289,14 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     DynamicLinearAllocator TempAllocator{GetRawAllocator(), 256};
 
+    // Descriptor buffers require immutable sampler descriptors to be written explicitly
+    const bool UseDescriptorBuffers = HasDevice() && GetDevice()->UseDescriptorBuffers();
+
+    std::vector<VkSampler>               ResourceImmutableSamplers;
+    std::vector<ImmutableSamplerBinding> SeparateImmutableSamplers;
+    if (UseDescriptorBuffers)
+        ResourceImmutableSamplers.resize(m_Desc.NumResources, VK_NULL_HANDLE);
+
     std::vector<bool> ImmutableSamplerWithResource(m_Desc.NumImmutableSamplers, false);
     for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
     {
@@ -283,9 +331,11 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             {
                 const RefCntAutoPtr<SamplerVkImpl>& pSamplerVk = m_pImmutableSamplers[SrcImmutableSamplerInd];
 
-                pVkImmutableSamplers = TempAllocator.ConstructArray<VkSampler>(ResDesc.ArraySize, pSamplerVk ? pSamplerVk->GetVkSampler() : VK_NULL_HANDLE);
+                pVkImmutableSamplers = TempAllocator.ConstructArray<VkSampler>(ResDesc.GetArraySize(), pSamplerVk ? pSamplerVk->GetVkSampler() : VK_NULL_HANDLE);
 
                 ImmutableSamplerWithResource[SrcImmutableSamplerInd] = true;
+                if (UseDescriptorBuffers)
+                    ResourceImmutableSamplers[i] = pVkImmutableSamplers[0];
             }
         }
 
@@ -296,7 +346,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
                 {
                     BindingIndices[CacheGroup],
                     AssignedSamplerInd,
-                    ResDesc.ArraySize,
+                    ResDesc.GetArraySize(),
                     DescrType,
                     DSMapping[SetId],
                     pVkImmutableSamplers != nullptr,
@@ -310,8 +360,8 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
                           "Deserialized binding index (", pAttribs->BindingIndex, ") is invalid: ", BindingIndices[CacheGroup], " is expected.");
             DEV_CHECK_ERR(pAttribs->SamplerInd == AssignedSamplerInd,
                           "Deserialized sampler index (", pAttribs->SamplerInd, ") is invalid: ", AssignedSamplerInd, " is expected.");
-            DEV_CHECK_ERR(pAttribs->ArraySize == ResDesc.ArraySize,
-                          "Deserialized array size (", pAttribs->ArraySize, ") is invalid: ", ResDesc.ArraySize, " is expected.");
+            DEV_CHECK_ERR(pAttribs->ArraySize == ResDesc.GetArraySize(),
+                          "Deserialized array size (", pAttribs->ArraySize, ") is invalid: ", ResDesc.GetArraySize(), " is expected.");
             DEV_CHECK_ERR(pAttribs->GetDescriptorType() == DescrType, "Deserialized descriptor type is invalid");
             DEV_CHECK_ERR(pAttribs->DescrSet == DSMapping[SetId],
                           "Deserialized descriptor set (", pAttribs->DescrSet, ") is invalid: ", DSMapping[SetId], " is expected.");
@@ -323,22 +373,24 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         }
 
         BindingIndices[CacheGroup] += 1;
-        CacheGroupOffsets[CacheGroup] += ResDesc.ArraySize;
+        CacheGroupOffsets[CacheGroup] += ResDesc.GetArraySize();
 
         VkDescriptorSetLayoutBinding vkSetLayoutBinding{};
         vkSetLayoutBinding.binding            = pAttribs->BindingIndex;
-        vkSetLayoutBinding.descriptorCount    = ResDesc.ArraySize;
+        vkSetLayoutBinding.descriptorCount    = ResDesc.GetArraySize();
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(ResDesc.ShaderStages);
         vkSetLayoutBinding.pImmutableSamplers = pVkImmutableSamplers;
-        vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
+        vkSetLayoutBinding.descriptorType     = UseDescriptorBuffers ?
+            DescriptorTypeToVkDescriptorBufferType(pAttribs->GetDescriptorType()) :
+            DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
 
         if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
         {
             VERIFY(pAttribs->DescrSet == 0, "Static resources must always be allocated in descriptor set 0");
-            m_pStaticResCache->InitializeResources(pAttribs->DescrSet, StaticCacheOffset, ResDesc.ArraySize,
+            m_pStaticResCache->InitializeResources(pAttribs->DescrSet, StaticCacheOffset, ResDesc.GetArraySize(),
                                                    pAttribs->GetDescriptorType(), pAttribs->IsImmutableSamplerAssigned());
-            StaticCacheOffset += ResDesc.ArraySize;
+            StaticCacheOffset += ResDesc.GetArraySize();
         }
     }
 
@@ -425,6 +477,9 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_SAMPLER;
         vkSetLayoutBinding.pImmutableSamplers = TempAllocator.Construct<VkSampler>(pSamplerVk ? pSamplerVk->GetVkSampler() : VK_NULL_HANDLE);
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
+
+        if (UseDescriptorBuffers)
+            SeparateImmutableSamplers.push_back({SetId, ImtblSampAttribs.BindingIndex, *vkSetLayoutBinding.pImmutableSamplers});
     }
 
     Uint32 NumSets = 0;
@@ -434,6 +489,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR] +
             CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR] +
             CacheGroupSizes[CACHE_GROUP_OTHER_STAT_VAR];
+        m_DescriptorSetBufferCounts[DSMapping[DESCRIPTOR_SET_ID_STATIC_MUTABLE]] = SetBufferCounts[DESCRIPTOR_SET_ID_STATIC_MUTABLE];
         ++NumSets;
     }
 
@@ -443,6 +499,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR] +
             CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR] +
             CacheGroupSizes[CACHE_GROUP_OTHER_DYN_VAR];
+        m_DescriptorSetBufferCounts[DSMapping[DESCRIPTOR_SET_ID_DYNAMIC]] = SetBufferCounts[DESCRIPTOR_SET_ID_DYNAMIC];
         ++NumSets;
     }
 #ifdef DILIGENT_DEBUG
@@ -456,11 +513,12 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     SetLayoutCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     SetLayoutCI.pNext = nullptr;
-    SetLayoutCI.flags = 0;
+    SetLayoutCI.flags = UseDescriptorBuffers ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
 
     if (HasDevice())
     {
         const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+        PipelineLayoutCacheVk&                LayoutCache   = GetDevice()->GetPipelineLayoutCache();
 
         for (size_t i = 0; i < vkSetLayoutBindings.size(); ++i)
         {
@@ -470,9 +528,135 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
             SetLayoutCI.bindingCount = StaticCast<uint32_t>(vkSetLayoutBinding.size());
             SetLayoutCI.pBindings    = vkSetLayoutBinding.data();
-            m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
+            m_VkDescrSetLayouts[i]   = LayoutCache.GetDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        // Small dynamic sets without dynamic buffers can be pushed directly to the command buffer,
+        // which avoids allocating them from the dynamic descriptor pools every time the SRB is committed.
+        // Dynamic buffers are not allowed in push descriptor layouts.
+        if (!UseDescriptorBuffers && LogicalDevice.GetEnabledExtFeatures().PushDescriptor && m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC])
+        {
+            const Uint32 MaxPushDescriptors = std::min(Uint32{MaxPushDescriptorCount}, GetDevice()->GetPhysicalDevice().GetExtProperties().PushDescriptor.maxPushDescriptors);
+            if (CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR] + CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR] == 0 &&
+                m_DescriptorSetSizes[DSMapping[DESCRIPTOR_SET_ID_DYNAMIC]] <= MaxPushDescriptors)
+            {
+                const std::vector<VkDescriptorSetLayoutBinding>& vkDynSetBindings = vkSetLayoutBindings[DESCRIPTOR_SET_ID_DYNAMIC];
+
+                SetLayoutCI.flags        = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+                SetLayoutCI.bindingCount = StaticCast<uint32_t>(vkDynSetBindings.size());
+                SetLayoutCI.pBindings    = vkDynSetBindings.data();
+                m_VkPushDescrSetLayout   = LayoutCache.GetDescriptorSetLayout(SetLayoutCI);
+            }
+        }
+
+        if (UseDescriptorBuffers)
+            InitDescriptorBufferSetLayouts(ResourceImmutableSamplers, SeparateImmutableSamplers);
+        else if (m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC] && GetDevice()->GetPhysicalDevice().GetVkVersion() >= VK_API_VERSION_1_1)
+            CreateDynamicSetUpdateTemplate();
+    }
+}
+
+void PipelineResourceSignatureVkImpl::CreateDynamicSetUpdateTemplate()
+{
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries;
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        const ResourceAttribs&      Attr    = m_pResourceAttribs[i];
+        if (ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC)
+            continue;
+
+        // Immutable samplers are permanently bound into the set layout
+        if (Attr.GetDescriptorType() == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        // Descriptor infos are read from the array indexed by the resource cache offset,
+        // see ShaderResourceCacheVk::WriteDescriptorUpdateData()
+        VkDescriptorUpdateTemplateEntry Entry{};
+        Entry.dstBinding      = Attr.BindingIndex;
+        Entry.dstArrayElement = 0;
+        Entry.descriptorCount = ResDesc.GetArraySize();
+        Entry.descriptorType  = DescriptorTypeToVkDescriptorType(Attr.GetDescriptorType());
+        Entry.offset          = size_t{Attr.CacheOffset(ResourceCacheContentType::SRB)} * sizeof(ShaderResourceCacheVk::DescriptorUpdateInfo);
+        Entry.stride          = sizeof(ShaderResourceCacheVk::DescriptorUpdateInfo);
+        Entries.push_back(Entry);
+    }
+
+    if (Entries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(Entries.size());
+    TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    m_DynamicSetUpdateTemplate = GetDevice()->GetLogicalDevice().CreateDescriptorUpdateTemplate(TemplateCI, m_Desc.Name);
+}
+
+void PipelineResourceSignatureVkImpl::InitDescriptorBufferSetLayouts(const std::vector<VkSampler>&               ResourceImmutableSamplers,
+                                                                     const std::vector<ImmutableSamplerBinding>& SeparateImmutableSamplers)
+{
+    const VulkanUtilities::LogicalDevice&                LogicalDevice = GetDevice()->GetLogicalDevice();
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props         = GetDevice()->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+
+    auto WriteSamplerDescriptor = [&](ShaderResourceCacheVk::DescriptorBufferSetLayout& Layout, VkDeviceSize Offset, VkSampler vkSampler) {
+        VERIFY_EXPR(Offset + Props.samplerDescriptorSize <= Layout.InitData.size());
+
+        VkDescriptorGetInfoEXT DescrInfo{};
+        DescrInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        DescrInfo.type          = VK_DESCRIPTOR_TYPE_SAMPLER;
+        DescrInfo.data.pSampler = &vkSampler;
+        LogicalDevice.GetDescriptor(DescrInfo, Props.samplerDescriptorSize, &Layout.InitData[static_cast<size_t>(Offset)]);
+    };
+
+    for (DESCRIPTOR_SET_ID SetId : {DESCRIPTOR_SET_ID_STATIC_MUTABLE, DESCRIPTOR_SET_ID_DYNAMIC})
+    {
+        const VkDescriptorSetLayout vkLayout = m_VkDescrSetLayouts[SetId];
+        if (vkLayout == VK_NULL_HANDLE)
+            continue;
+
+        ShaderResourceCacheVk::DescriptorBufferSetLayout& Layout = m_DescrBufferSetLayouts[SetId];
+
+        Layout.DataSize = StaticCast<Uint32>(LogicalDevice.GetDescriptorSetLayoutSize(vkLayout));
+        Layout.InitData.resize(Layout.DataSize, Uint8{0});
+
+        const Uint32 SetSize = SetId == DESCRIPTOR_SET_ID_STATIC_MUTABLE ?
+            m_DescriptorSetSizes[GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>()] :
+            m_DescriptorSetSizes[GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>()];
+        Layout.DescriptorOffsets.resize(SetSize, 0);
+        Layout.ImmutableSamplers.resize(SetSize, VK_NULL_HANDLE);
+
+        for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+        {
+            const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+            if (VarTypeToDescriptorSetId(ResDesc.VarType) != SetId)
+                continue;
+
+            const ResourceAttribs& Attr          = m_pResourceAttribs[i];
+            const VkDeviceSize     BindingOffset = LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkLayout, Attr.BindingIndex);
+            const size_t           DescrSize     = GetDescriptorBufferDescriptorSize(Props, DescriptorTypeToVkDescriptorBufferType(Attr.GetDescriptorType()));
+            const VkSampler        vkImtblSam    = ResourceImmutableSamplers[i];
+            const Uint32           CacheOffset   = Attr.CacheOffset(ResourceCacheContentType::SRB);
+            for (Uint32 elem = 0; elem < ResDesc.GetArraySize(); ++elem)
+            {
+                const VkDeviceSize DescrOffset = BindingOffset + elem * DescrSize;
+
+                Layout.DescriptorOffsets[CacheOffset + elem] = StaticCast<Uint32>(DescrOffset);
+                if (Attr.GetDescriptorType() == DescriptorType::CombinedImageSampler)
+                    Layout.ImmutableSamplers[CacheOffset + elem] = vkImtblSam;
+                else if (Attr.GetDescriptorType() == DescriptorType::Sampler && vkImtblSam != VK_NULL_HANDLE)
+                    WriteSamplerDescriptor(Layout, DescrOffset, vkImtblSam);
+            }
+        }
+
+        for (const ImmutableSamplerBinding& Sampler : SeparateImmutableSamplers)
+        {
+            if (Sampler.SetId == SetId && Sampler.vkSampler != VK_NULL_HANDLE)
+                WriteSamplerDescriptor(Layout, LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkLayout, Sampler.BindingIndex), Sampler.vkSampler);
+        }
     }
 }
 
@@ -483,12 +667,24 @@ PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 
 void PipelineResourceSignatureVkImpl::Destruct()
 {
-    for (VulkanUtilities::DescriptorSetLayoutWrapper& Layout : m_VkDescrSetLayouts)
+    for (VkDescriptorSetLayout& Layout : m_VkDescrSetLayouts)
     {
-        if (Layout)
-            GetDevice()->SafeReleaseDeviceObject(std::move(Layout), ~0ull);
+        if (Layout != VK_NULL_HANDLE)
+        {
+            GetDevice()->GetPipelineLayoutCache().ReleaseDescriptorSetLayout(Layout);
+            Layout = VK_NULL_HANDLE;
+        }
+    }
+
+    if (m_VkPushDescrSetLayout != VK_NULL_HANDLE)
+    {
+        GetDevice()->GetPipelineLayoutCache().ReleaseDescriptorSetLayout(m_VkPushDescrSetLayout);
+        m_VkPushDescrSetLayout = VK_NULL_HANDLE;
     }
 
+    if (m_DynamicSetUpdateTemplate)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_DynamicSetUpdateTemplate), ~0ull);
+
     TPipelineResourceSignatureBase::Destruct();
 }
 
@@ -501,7 +697,7 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
 #endif
 
     IMemoryAllocator& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
-    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data());
+    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data(), m_DescriptorSetBufferCounts.data());
 
     const Uint32                   TotalResources = GetTotalResourceCount();
     const ResourceCacheContentType CacheType      = ResourceCache.GetContentType();
@@ -509,7 +705,7 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     {
         const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
         const ResourceAttribs&      Attr    = GetResourceAttribs(r);
-        ResourceCache.InitializeResources(Attr.DescrSet, Attr.CacheOffset(CacheType), ResDesc.ArraySize,
+        ResourceCache.InitializeResources(Attr.DescrSet, Attr.CacheOffset(CacheType), ResDesc.GetArraySize(),
                                           Attr.GetDescriptorType(), Attr.IsImmutableSamplerAssigned());
     }
 
@@ -517,7 +713,9 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     ResourceCache.DbgVerifyResourceInitialization();
 #endif
 
-    if (VkDescriptorSetLayout vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+    // When descriptor buffers are used, all descriptor sets are written to the dynamic heap at commit time
+    VkDescriptorSetLayout vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE);
+    if (vkLayout != VK_NULL_HANDLE && !GetDevice()->UseDescriptorBuffers())
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
 #ifdef DILIGENT_DEVELOPMENT
@@ -555,7 +753,7 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
         if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
             continue; // Skip immutable separate samplers
 
-        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
         {
             const Uint32                           SrcCacheOffset = Attr.CacheOffset(SrcCacheType) + ArrInd;
             const ShaderResourceCacheVk::Resource& SrcCachedRes   = SrcDescrSet.GetResource(SrcCacheOffset);
@@ -575,6 +773,17 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
             if (pCachedResource != pObject)
             {
                 DEV_CHECK_ERR(pCachedResource == nullptr, "Static resource has already been initialized, and the new resource does not match previously assigned resource");
+
+                // Only uniform buffers keep the range that was set by the application. For storage buffers,
+                // the range is defined by the buffer view and must not be passed to SetResource.
+                Uint64 BufferBaseOffset = 0;
+                Uint64 BufferRangeSize  = 0;
+                if (SrcCachedRes.Type == DescriptorType::UniformBuffer || SrcCachedRes.Type == DescriptorType::UniformBufferDynamic)
+                {
+                    const ShaderResourceCacheVk::BufferInfo& SrcBuffInfo = SrcDescrSet.GetBufferInfo(SrcCachedRes);
+                    BufferBaseOffset                                     = SrcBuffInfo.BaseOffset;
+                    BufferRangeSize                                      = SrcBuffInfo.RangeSize;
+                }
                 DstResourceCache.SetResource(&GetDevice()->GetLogicalDevice(),
                                              StaticSetIdx,
                                              DstCacheOffset,
@@ -582,8 +791,8 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
                                                  Attr.BindingIndex,
                                                  ArrInd,
                                                  RefCntAutoPtr<IDeviceObject>{SrcCachedRes.pObject},
-                                                 SrcCachedRes.BufferBaseOffset,
-                                                 SrcCachedRes.BufferRangeSize //
+                                                 BufferBaseOffset,
+                                                 BufferRangeSize //
                                              });
             }
         }
@@ -608,33 +817,17 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
-void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+template <typename BatchSizesType, typename FlushHandlerType>
+void PipelineResourceSignatureVkImpl::WriteDynamicDescriptors(const ShaderResourceCacheVk& ResourceCache,
+                                                              VkDescriptorSet              vkDynamicDescriptorSet,
+                                                              FlushHandlerType&&           FlushWrites) const
 {
-    VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
-    VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
-    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
-
-#ifdef DILIGENT_DEBUG
-    static constexpr size_t ImgUpdateBatchSize          = 4;
-    static constexpr size_t BuffUpdateBatchSize         = 2;
-    static constexpr size_t TexelBuffUpdateBatchSize    = 2;
-    static constexpr size_t AccelStructBatchSize        = 2;
-    static constexpr size_t WriteDescriptorSetBatchSize = 2;
-#else
-    static constexpr size_t ImgUpdateBatchSize          = 64;
-    static constexpr size_t BuffUpdateBatchSize         = 32;
-    static constexpr size_t TexelBuffUpdateBatchSize    = 16;
-    static constexpr size_t AccelStructBatchSize        = 16;
-    static constexpr size_t WriteDescriptorSetBatchSize = 32;
-#endif
-
     // Do not zero-initialize arrays!
-    std::array<VkDescriptorImageInfo, ImgUpdateBatchSize>                          DescrImgInfoArr;
-    std::array<VkDescriptorBufferInfo, BuffUpdateBatchSize>                        DescrBuffInfoArr;
-    std::array<VkBufferView, TexelBuffUpdateBatchSize>                             DescrBuffViewArr;
-    std::array<VkWriteDescriptorSetAccelerationStructureKHR, AccelStructBatchSize> DescrAccelStructArr;
-    std::array<VkWriteDescriptorSet, WriteDescriptorSetBatchSize>                  WriteDescrSetArr;
+    std::array<VkDescriptorImageInfo, BatchSizesType::ImgUpdate>                          DescrImgInfoArr;
+    std::array<VkDescriptorBufferInfo, BatchSizesType::BuffUpdate>                        DescrBuffInfoArr;
+    std::array<VkBufferView, BatchSizesType::TexelBuffUpdate>                             DescrBuffViewArr;
+    std::array<VkWriteDescriptorSetAccelerationStructureKHR, BatchSizesType::AccelStruct> DescrAccelStructArr;
+    std::array<VkWriteDescriptorSet, BatchSizesType::WriteDescriptorSet>                  WriteDescrSetArr;
 
     auto DescrImgIt      = DescrImgInfoArr.begin();
     auto DescrBuffIt     = DescrBuffInfoArr.begin();
@@ -644,7 +837,6 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     const Uint32                                DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
     const ShaderResourceCacheVk::DescriptorSet& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
-    const VulkanUtilities::LogicalDevice&       LogicalDevice  = GetDevice()->GetLogicalDevice();
     const std::pair<Uint32, Uint32>             DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
 
     constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
@@ -667,8 +859,8 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         WriteDescrSetIt->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         WriteDescrSetIt->pNext = nullptr;
         VERIFY(SetResources.GetVkDescriptorSet() == VK_NULL_HANDLE, "Dynamic descriptor set must not be assigned to the resource cache");
+        // dstSet is ignored when descriptors are pushed
         WriteDescrSetIt->dstSet = vkDynamicDescriptorSet;
-        VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE, "Vulkan descriptor set must not be null");
         WriteDescrSetIt->dstBinding      = Attr.BindingIndex;
         WriteDescrSetIt->dstArrayElement = ArrElem;
         // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
@@ -685,9 +877,10 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         {
             while (ArrElem < ArraySize && DescrIt != DescrArr.end())
             {
-                if (const ShaderResourceCacheVk::Resource& CachedRes = SetResources.GetResource(CacheOffset + (ArrElem++)))
+                const Uint32 ResCacheOffset = CacheOffset + (ArrElem++);
+                if (SetResources.GetResource(ResCacheOffset))
                 {
-                    *DescrIt = CachedRes.GetDescriptorWriteInfo<DescrType>();
+                    *DescrIt = SetResources.GetDescriptorWriteInfo<DescrType>(ResCacheOffset);
                     ++DescrIt;
                     ++WriteDescrSetIt->descriptorCount;
                 }
@@ -784,7 +977,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         {
             Uint32 DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
             if (DescrWriteCount > 0)
-                LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+                FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
 
             DescrImgIt      = DescrImgInfoArr.begin();
             DescrBuffIt     = DescrBuffInfoArr.begin();
@@ -796,7 +989,56 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     Uint32 DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
     if (DescrWriteCount > 0)
-        LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+        FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
+}
+
+void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk&                              ResourceCache,
+                                                             VkDescriptorSet                                           vkDynamicDescriptorSet,
+                                                             std::vector<ShaderResourceCacheVk::DescriptorUpdateInfo>& UpdateData) const
+{
+    VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
+    VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+
+    if (m_DynamicSetUpdateTemplate)
+    {
+        const Uint32 DynamicSetIdx = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
+        if (UpdateData.size() < m_DescriptorSetSizes[DynamicSetIdx])
+            UpdateData.resize(m_DescriptorSetSizes[DynamicSetIdx]);
+
+        // If all resources are bound, the set is written with a single call.
+        // Otherwise, fall back to writing individual descriptors and skip null resources.
+        if (ResourceCache.WriteDescriptorUpdateData(DynamicSetIdx, UpdateData.data()))
+        {
+            GetDevice()->GetLogicalDevice().UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, m_DynamicSetUpdateTemplate, UpdateData.data());
+            return;
+        }
+    }
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+    WriteDynamicDescriptors<DescriptorUpdateBatchSizes>(
+        ResourceCache, vkDynamicDescriptorSet,
+        [&LogicalDevice](Uint32 DescrWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) {
+            LogicalDevice.UpdateDescriptorSets(DescrWriteCount, pDescriptorWrites, 0, nullptr);
+        });
+}
+
+void PipelineResourceSignatureVkImpl::PushDynamicResources(const ShaderResourceCacheVk&    ResourceCache,
+                                                           VulkanUtilities::CommandBuffer& CmdBuffer,
+                                                           VkPipelineBindPoint             BindPoint,
+                                                           VkPipelineLayout                vkPipelineLayout,
+                                                           Uint32                          SetIndex) const
+{
+    VERIFY(m_VkPushDescrSetLayout, "This signature does not use push descriptors");
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+
+    // The dynamic set contains at most MaxPushDescriptorCount descriptors, so all
+    // writes fit into a single batch and are pushed with one command.
+    WriteDynamicDescriptors<PushDescriptorBatchSizes>(
+        ResourceCache, VK_NULL_HANDLE,
+        [&](Uint32 DescrWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) {
+            CmdBuffer.PushDescriptorSet(BindPoint, vkPipelineLayout, SetIndex, DescrWriteCount, pDescriptorWrites);
+        });
 }
 
 
@@ -839,7 +1081,7 @@ bool PipelineResourceSignatureVkImpl::DvpValidateCommittedResource(const DeviceC
             const PipelineResourceDesc& SamplerResDesc = GetResourceDesc(ResAttribs.SamplerInd);
             const ResourceAttribs&      SamplerAttribs = GetResourceAttribs(ResAttribs.SamplerInd);
             VERIFY_EXPR(SamplerResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER);
-            VERIFY_EXPR(SamplerResDesc.ArraySize == 1 || SamplerResDesc.ArraySize == ResDesc.ArraySize);
+            VERIFY_EXPR(SamplerResDesc.ArraySize == 1 || SamplerResDesc.ArraySize == ResDesc.GetArraySize());
             if (!SamplerAttribs.IsImmutableSamplerAssigned())
             {
                 if (ArrIndex < SamplerResDesc.ArraySize)
@@ -961,7 +1203,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data());
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_DescriptorSetBufferCounts.data());
             });
     }
     catch (...)
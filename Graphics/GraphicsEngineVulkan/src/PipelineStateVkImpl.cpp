@@ -42,6 +42,10 @@
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
 #include "StringTools.hpp"
+#include "SPIRVUtils.hpp"
+#include "DeviceObjectDigest.hpp"
+#include "PipelineLibraryCache.hpp"
+#include "Timer.hpp"
 
 #if !DILIGENT_NO_HLSL
 #    include "SPIRVTools.hpp"
@@ -55,9 +59,63 @@ constexpr INTERFACE_ID PipelineStateVkImpl::IID_InternalImpl;
 namespace
 {
 
+// Maps the specialization constants of the pipeline to the constants declared by the shader
+PipelineStateVkImpl::SpecializationInfo GetShaderSpecializationInfo(const PipelineStateCreateInfo& CreateInfo,
+                                                                    const ShaderVkImpl*            pShader) noexcept(false)
+{
+    PipelineStateVkImpl::SpecializationInfo SpecInfo;
+
+    const SHADER_TYPE ShaderType = pShader->GetDesc().ShaderType;
+
+    bool HasStageConstants = false;
+    for (Uint32 i = 0; i < CreateInfo.NumSpecializationConstants && !HasStageConstants; ++i)
+        HasStageConstants = (CreateInfo.pSpecializationConstants[i].ShaderStages & ShaderType) != 0;
+    if (!HasStageConstants)
+        return SpecInfo;
+
+    // Use the original byte code as the remapped one may be stripped of reflection information
+    const std::vector<SPIRVSpecializationConstantInfo> ShaderConstants = GetSPIRVSpecializationConstants(pShader->GetSPIRV());
+    for (Uint32 i = 0; i < CreateInfo.NumSpecializationConstants; ++i)
+    {
+        const SpecializationConstant& Const = CreateInfo.pSpecializationConstants[i];
+        if ((Const.ShaderStages & ShaderType) == 0)
+            continue;
+
+        auto ShaderConstIt = std::find_if(ShaderConstants.begin(), ShaderConstants.end(),
+                                          [&Const](const SPIRVSpecializationConstantInfo& Info) {
+                                              return Info.Name == Const.Name;
+                                          });
+        if (ShaderConstIt == ShaderConstants.end())
+        {
+            // The constant may be used by other shaders only
+            continue;
+        }
+
+        if (ShaderConstIt->Size != Const.Size)
+        {
+            LOG_ERROR_AND_THROW("The size (", Const.Size, ") of specialization constant '", Const.Name,
+                                "' does not match the size (", ShaderConstIt->Size, ") of the constant in shader '",
+                                pShader->GetDesc().Name, "'.");
+        }
+
+        VkSpecializationMapEntry MapEntry{};
+        MapEntry.constantID = ShaderConstIt->SpecId;
+        MapEntry.offset     = static_cast<uint32_t>(SpecInfo.Data.size());
+        MapEntry.size       = Const.Size;
+        SpecInfo.MapEntries.push_back(MapEntry);
+
+        const Uint8* pConstData = static_cast<const Uint8*>(Const.pData);
+        SpecInfo.Data.insert(SpecInfo.Data.end(), pConstData, pConstData + Const.Size);
+    }
+
+    return SpecInfo;
+}
+
 void InitPipelineShaderStages(const VulkanUtilities::LogicalDevice&              LogicalDevice,
+                              const PipelineStateCreateInfo&                     CreateInfo,
                               PipelineStateVkImpl::TShaderStages&                ShaderStages,
                               std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules,
+                              PipelineStateVkImpl::TSpecializationInfos&         SpecInfos,
                               std::vector<VkPipelineShaderStageCreateInfo>&      Stages)
 {
     for (size_t s = 0; s < ShaderStages.size(); ++s)
@@ -94,19 +152,98 @@ void InitPipelineShaderStages(const VulkanUtilities::LogicalDevice&
             StageCI.pSpecializationInfo = nullptr;
 
             Stages.push_back(StageCI);
+            SpecInfos.push_back(GetShaderSpecializationInfo(CreateInfo, pShader));
         }
     }
 
     VERIFY_EXPR(ShaderModules.size() == Stages.size());
+    VERIFY_EXPR(SpecInfos.size() == Stages.size());
+    // Set the pointers when all infos are in place as the vector may be reallocated
+    for (size_t i = 0; i < Stages.size(); ++i)
+        Stages[i].pSpecializationInfo = SpecInfos[i].GetVkSpecializationInfo();
 }
 
 
+// Pipeline creation feedback (VK_EXT_pipeline_creation_feedback) of the pipeline and its stages.
+// When the extension is not enabled, the wall clock time of the pipeline creation is used.
+struct PipelineCreationFeedback
+{
+    explicit PipelineCreationFeedback(const VulkanUtilities::LogicalDevice& LogicalDevice) :
+        Enabled{LogicalDevice.GetEnabledExtFeatures().PipelineCreationFeedback}
+    {}
+
+    // Inserts the feedback structure into the pNext chain of the pipeline create info.
+    // pStages must point to the shader stages of the same create info.
+    void Chain(const void*& pNext, const VkPipelineShaderStageCreateInfo* pStages, uint32_t StageCount)
+    {
+        if (!Enabled)
+            return;
+
+        StageFeedbacks.resize(StageCount);
+        StageTypes.resize(StageCount);
+        for (uint32_t i = 0; i < StageCount; ++i)
+            StageTypes[i] = VkShaderStageFlagsToShaderTypes(pStages[i].stage);
+
+        CreateInfo.sType                              = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT;
+        CreateInfo.pNext                              = pNext;
+        CreateInfo.pPipelineCreationFeedback          = &PipelineFeedback;
+        CreateInfo.pipelineStageCreationFeedbackCount = StageCount;
+        CreateInfo.pPipelineStageCreationFeedbacks    = StageCount > 0 ? StageFeedbacks.data() : nullptr;
+        pNext                                         = &CreateInfo;
+    }
+
+    // Returns the pipeline cache status, the pipeline creation duration in microseconds and the stage statistics
+    PIPELINE_CACHE_STATUS GetStats(Uint64& Duration, std::vector<PipelineStageCompileStats>& Stages) const
+    {
+        if ((PipelineFeedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT) == 0)
+        {
+            Duration = static_cast<Uint64>(CreateTimer.GetElapsedTime() * 1e+6);
+            return PIPELINE_CACHE_STATUS_UNKNOWN;
+        }
+
+        // The stage feedback is optional, and its valid bit is not set if the implementation does not provide it
+        for (size_t i = 0; i < StageFeedbacks.size(); ++i)
+        {
+            if ((StageFeedbacks[i].flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT) == 0)
+                continue;
+
+            PipelineStageCompileStats StageStats;
+            StageStats.ShaderType  = StageTypes[i];
+            StageStats.CacheStatus = GetCacheStatus(StageFeedbacks[i]);
+            StageStats.Duration    = StageFeedbacks[i].duration / 1000;
+            Stages.push_back(StageStats);
+        }
+
+        Duration = PipelineFeedback.duration / 1000;
+        return GetCacheStatus(PipelineFeedback);
+    }
+
+private:
+    static PIPELINE_CACHE_STATUS GetCacheStatus(const VkPipelineCreationFeedbackEXT& Feedback)
+    {
+        return (Feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT) != 0 ?
+            PIPELINE_CACHE_STATUS_HIT :
+            PIPELINE_CACHE_STATUS_MISS;
+    }
+
+    const bool Enabled;
+
+    const Timer CreateTimer;
+
+    VkPipelineCreationFeedbackCreateInfoEXT    CreateInfo{};
+    VkPipelineCreationFeedbackEXT              PipelineFeedback{};
+    std::vector<VkPipelineCreationFeedbackEXT> StageFeedbacks;
+    std::vector<SHADER_TYPE>                   StageTypes;
+};
+
+
 void CreateComputePipeline(RenderDeviceVkImpl*                           pDeviceVk,
                            std::vector<VkPipelineShaderStageCreateInfo>& Stages,
                            const PipelineLayoutVk&                       Layout,
                            const PipelineStateDesc&                      PSODesc,
                            VulkanUtilities::PipelineWrapper&             Pipeline,
-                           VkPipelineCache                               vkPSOCache)
+                           VkPipelineCache                               vkPSOCache,
+                           PipelineCreationFeedback*                     pFeedback = nullptr)
 {
     const VulkanUtilities::LogicalDevice& LogicalDevice = pDeviceVk->GetLogicalDevice();
 
@@ -116,16 +253,116 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
     PipelineCI.stage  = Stages[0];
     PipelineCI.layout = Layout.GetVkPipelineLayout();
 
+    if (pFeedback != nullptr)
+        pFeedback->Chain(PipelineCI.pNext, &PipelineCI.stage, 1);
+
     Pipeline = LogicalDevice.CreateComputePipeline(PipelineCI, vkPSOCache, PSODesc.Name);
 }
 
 
+// Graphics pipeline libraries (VK_EXT_graphics_pipeline_library) the pipeline is linked from
+struct GraphicsPipelineLibraries
+{
+    PipelineLibraryCache* pCache = nullptr;
+
+    // Digests of the pipeline state subsets, see GRAPHICS_PIPELINE_SUBSET
+    std::array<DeviceObjectDigest, GRAPHICS_PIPELINE_SUBSET_COUNT> Digests;
+
+    // Libraries and link flags initialized by CreateGraphicsPipeline()
+    std::vector<VkPipeline> Libraries;
+    VkPipelineCreateFlags   LinkFlags = 0;
+};
+
+VulkanUtilities::PipelineWrapper LinkGraphicsPipelineLibraries(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                                               const std::vector<VkPipeline>&        Libraries,
+                                                               VkPipelineLayout                      vkLayout,
+                                                               VkPipelineCreateFlags                 Flags,
+                                                               VkPipelineCache                       vkPSOCache,
+                                                               const char*                           Name,
+                                                               PipelineCreationFeedback*             pFeedback = nullptr)
+{
+    VkPipelineLibraryCreateInfoKHR LibraryCI{};
+    LibraryCI.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    LibraryCI.libraryCount = static_cast<uint32_t>(Libraries.size());
+    LibraryCI.pLibraries   = Libraries.data();
+
+    // All state is provided by the libraries
+    VkGraphicsPipelineCreateInfo PipelineCI{};
+    PipelineCI.sType             = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    PipelineCI.pNext             = &LibraryCI;
+    PipelineCI.flags             = Flags;
+    PipelineCI.layout            = vkLayout;
+    PipelineCI.basePipelineIndex = -1;
+
+    // The linked pipeline has no stages of its own
+    if (pFeedback != nullptr)
+        pFeedback->Chain(PipelineCI.pNext, nullptr, 0);
+
+    return LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, Name);
+}
+
+// Finds or creates the libraries for every state subset of the pipeline
+void CreateGraphicsPipelineLibraries(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                     const VkGraphicsPipelineCreateInfo&   PipelineCI,
+                                     VkPipelineCache                       vkPSOCache,
+                                     const char*                           Name,
+                                     GraphicsPipelineLibraries&            Libs)
+{
+    static constexpr VkGraphicsPipelineLibraryFlagsEXT SubsetFlags[] = {
+        VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,    // GRAPHICS_PIPELINE_SUBSET_VERTEX_INPUT
+        VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, // GRAPHICS_PIPELINE_SUBSET_PRE_RASTERIZATION
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,           // GRAPHICS_PIPELINE_SUBSET_FRAGMENT_SHADER
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, // GRAPHICS_PIPELINE_SUBSET_FRAGMENT_OUTPUT
+    };
+    static_assert(_countof(SubsetFlags) == GRAPHICS_PIPELINE_SUBSET_COUNT, "Please update the flags array");
+
+    constexpr VkShaderStageFlags PreRasterizationStages =
+        VK_SHADER_STAGE_VERTEX_BIT |
+        VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT |
+        VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT |
+        VK_SHADER_STAGE_GEOMETRY_BIT;
+
+    Libs.Libraries.resize(GRAPHICS_PIPELINE_SUBSET_COUNT);
+    for (Uint32 Subset = 0; Subset < GRAPHICS_PIPELINE_SUBSET_COUNT; ++Subset)
+    {
+        Libs.Libraries[Subset] = Libs.pCache->GetLibrary(
+            Libs.Digests[Subset],
+            [&]() {
+                VkGraphicsPipelineLibraryCreateInfoEXT SubsetCI{};
+                SubsetCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+                SubsetCI.pNext = PipelineCI.pNext;
+                SubsetCI.flags = SubsetFlags[Subset];
+
+                // The state that does not belong to the subset is ignored, but
+                // the shader stages must be filtered.
+                std::vector<VkPipelineShaderStageCreateInfo> SubsetStages;
+                for (uint32_t i = 0; i < PipelineCI.stageCount; ++i)
+                {
+                    const VkPipelineShaderStageCreateInfo& Stage = PipelineCI.pStages[i];
+                    if ((Subset == GRAPHICS_PIPELINE_SUBSET_PRE_RASTERIZATION && (Stage.stage & PreRasterizationStages) != 0) ||
+                        (Subset == GRAPHICS_PIPELINE_SUBSET_FRAGMENT_SHADER && Stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT))
+                        SubsetStages.push_back(Stage);
+                }
+
+                VkGraphicsPipelineCreateInfo LibraryCI = PipelineCI;
+                LibraryCI.pNext      = &SubsetCI;
+                LibraryCI.flags      = PipelineCI.flags | VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+                LibraryCI.stageCount = static_cast<uint32_t>(SubsetStages.size());
+                LibraryCI.pStages    = !SubsetStages.empty() ? SubsetStages.data() : nullptr;
+
+                return LogicalDevice.CreateGraphicsPipeline(LibraryCI, vkPSOCache, Name);
+            });
+    }
+}
+
 void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDeviceVk,
                             std::vector<VkPipelineShaderStageCreateInfo>& Stages,
                             const PipelineLayoutVk&                       Layout,
@@ -133,7 +370,10 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
                             const GraphicsPipelineDesc&                   GraphicsPipeline,
                             VulkanUtilities::PipelineWrapper&             Pipeline,
                             RefCntAutoPtr<IRenderPass>&                   pRenderPass,
-                            VkPipelineCache                               vkPSOCache)
+                            bool                                          HasExtendedDynamicState,
+                            VkPipelineCache                               vkPSOCache,
+                            GraphicsPipelineLibraries*                    pLibraries = nullptr,
+                            PipelineCreationFeedback*                     pFeedback  = nullptr)
 {
     const VulkanUtilities::LogicalDevice&  LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const VulkanUtilities::PhysicalDevice& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
@@ -144,6 +384,8 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     VkPipelineRenderingCreateInfoKHR PipelineRenderingCI{};
     std::vector<VkFormat>            ColorAttachmentFormats;
@@ -340,6 +582,20 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
         DynamicStates.push_back(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
     }
 
+    if (HasExtendedDynamicState)
+    {
+        // VK_EXT_extended_dynamic_state: the states are set with vkCmdSetCullModeEXT, vkCmdSetDepthTestEnableEXT etc.
+        // Only the topology class is taken from VkPipelineInputAssemblyStateCreateInfo::topology.
+        DynamicStates.insert(DynamicStates.end(),
+                             {
+                                 VK_DYNAMIC_STATE_CULL_MODE_EXT,
+                                 VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT,
+                                 VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT,
+                                 VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT,
+                                 VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT,
+                             });
+    }
+
     DynamicStateCI.dynamicStateCount = static_cast<uint32_t>(DynamicStates.size());
     DynamicStateCI.pDynamicStates    = DynamicStates.data();
     PipelineCI.pDynamicState         = &DynamicStateCI;
@@ -357,7 +613,19 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    if (pLibraries != nullptr)
+    {
+        // Fast-link the pipeline from the libraries. Libraries that were created for other pipelines are reused.
+        CreateGraphicsPipelineLibraries(LogicalDevice, PipelineCI, vkPSOCache, PSODesc.Name, *pLibraries);
+        pLibraries->LinkFlags = PipelineCI.flags;
+        Pipeline = LinkGraphicsPipelineLibraries(LogicalDevice, pLibraries->Libraries, PipelineCI.layout, PipelineCI.flags, vkPSOCache, PSODesc.Name, pFeedback);
+    }
+    else
+    {
+        if (pFeedback != nullptr)
+            pFeedback->Chain(PipelineCI.pNext, PipelineCI.pStages, PipelineCI.stageCount);
+        Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    }
 }
 
 
@@ -368,7 +636,8 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
                               const PipelineStateDesc&                                 PSODesc,
                               const RayTracingPipelineDesc&                            RayTracingPipeline,
                               VulkanUtilities::PipelineWrapper&                        Pipeline,
-                              VkPipelineCache                                          vkPSOCache)
+                              VkPipelineCache                                          vkPSOCache,
+                              PipelineCreationFeedback*                                pFeedback = nullptr)
 {
     const VulkanUtilities::LogicalDevice& LogicalDevice = pDeviceVk->GetLogicalDevice();
 
@@ -378,6 +647,8 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount                   = static_cast<Uint32>(vkStages.size());
     PipelineCI.pStages                      = vkStages.data();
@@ -391,6 +662,9 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
     PipelineCI.basePipelineHandle           = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex            = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
+    if (pFeedback != nullptr)
+        pFeedback->Chain(PipelineCI.pNext, PipelineCI.pStages, PipelineCI.stageCount);
+
     Pipeline = LogicalDevice.CreateRayTracingPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
 }
 
@@ -588,6 +862,18 @@ size_t PipelineStateVkImpl::ShaderStageInfo::Count() const
     return Shaders.size();
 }
 
+const VkSpecializationInfo* PipelineStateVkImpl::SpecializationInfo::GetVkSpecializationInfo()
+{
+    if (MapEntries.empty())
+        return nullptr;
+
+    vkSpecInfo.mapEntryCount = static_cast<uint32_t>(MapEntries.size());
+    vkSpecInfo.pMapEntries   = MapEntries.data();
+    vkSpecInfo.dataSize      = Data.size();
+    vkSpecInfo.pData         = Data.data();
+    return &vkSpecInfo;
+}
+
 PipelineResourceSignatureDescWrapper PipelineStateVkImpl::GetDefaultResourceSignatureDesc(
     const TShaderStages&              ShaderStages,
     const char*                       PSOName,
@@ -830,7 +1116,8 @@ template <typename PSOCreateInfoType>
 PipelineStateVkImpl::TShaderStages PipelineStateVkImpl::InitInternalObjects(
     const PSOCreateInfoType&                           CreateInfo,
     std::vector<VkPipelineShaderStageCreateInfo>&      vkShaderStages,
-    std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules) noexcept(false)
+    std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules,
+    TSpecializationInfos&                              SpecInfos) noexcept(false)
 {
     TShaderStages ShaderStages;
     ExtractShaders<ShaderVkImpl>(CreateInfo, ShaderStages, /*WaitUntilShadersReady = */ true);
@@ -848,7 +1135,7 @@ PipelineStateVkImpl::TShaderStages PipelineStateVkImpl::InitInternalObjects(
     InitPipelineLayout(CreateInfo, ShaderStages);
 
     // Create shader modules and initialize shader stages
-    InitPipelineShaderStages(LogicalDevice, ShaderStages, ShaderModules, vkShaderStages);
+    InitPipelineShaderStages(LogicalDevice, CreateInfo, ShaderStages, ShaderModules, SpecInfos, vkShaderStages);
 
     return ShaderStages;
 }
@@ -857,22 +1144,376 @@ void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateIn
 {
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+    TSpecializationInfos                              SpecInfos;
+
+    TShaderStages ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules, SpecInfos);
+
+    if (m_pDevice->UseShaderObjects() &&
+        m_Desc.PipelineType == PIPELINE_TYPE_GRAPHICS &&
+        m_pGraphicsPipelineData->Desc.pRenderPass == nullptr)
+    {
+        // Shader objects replace the pipeline, so pipeline libraries and background
+        // optimization are not used.
+        InitializeShaderObjects(ShaderStages, SpecInfos);
+        return;
+    }
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    // Use pipeline libraries when the optimized pipeline can be linked in the background
+    GraphicsPipelineLibraries Libraries;
+    Libraries.pCache = m_pDevice->GetPipelineLibraryCache();
+    if (Libraries.pCache != nullptr &&
+        (m_Desc.PipelineType != PIPELINE_TYPE_GRAPHICS || m_pDevice->GetShaderCompilationThreadPool() == nullptr))
+    {
+        Libraries.pCache = nullptr;
+    }
+    for (Uint32 Subset = 0; Subset < GRAPHICS_PIPELINE_SUBSET_COUNT && Libraries.pCache != nullptr; ++Subset)
+    {
+        if (!ComputeDeviceObjectDigest(CreateInfo, static_cast<GRAPHICS_PIPELINE_SUBSET>(Subset), Libraries.Digests[Subset]))
+            Libraries.pCache = nullptr;
+    }
 
     const VkPipelineCache vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+
+    PipelineCreationFeedback Feedback{m_pDevice->GetLogicalDevice()};
+    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), HasExtendedDynamicState(), vkSPOCache,
+                           Libraries.pCache != nullptr ? &Libraries : nullptr, &Feedback);
+
+    Uint64                                 Duration = 0;
+    std::vector<PipelineStageCompileStats> StageStats;
+    const PIPELINE_CACHE_STATUS            CacheStatus = Feedback.GetStats(Duration, StageStats);
+    SetCompileStats(CacheStatus, Duration, std::move(StageStats));
+
+    if (Libraries.pCache != nullptr && (CreateInfo.Flags & PSO_CREATE_FLAG_BACKGROUND_OPTIMIZATION) == 0)
+        StartBackgroundLinkTimeOptimization(CreateInfo, std::move(Libraries.Libraries), Libraries.LinkFlags);
+    else
+        StartBackgroundOptimization(CreateInfo, ShaderStages, SpecInfos);
+}
+
+void PipelineStateVkImpl::InitializeShaderObjects(TShaderStages& ShaderStages, const TSpecializationInfos& SpecInfos)
+{
+    const VulkanUtilities::LogicalDevice&                    LogicalDevice = m_pDevice->GetLogicalDevice();
+    const VulkanUtilities::LogicalDevice::ExtensionFeatures& ExtFeatures   = LogicalDevice.GetEnabledExtFeatures();
+    const GraphicsPipelineDesc&                              GraphicsPipeline = m_pGraphicsPipelineData->Desc;
+
+    std::unique_ptr<ShaderObjectData> pData = std::make_unique<ShaderObjectData>();
+
+    // Shader stages in the order they are executed by the pipeline
+    static constexpr SHADER_TYPE StageOrder[] = {
+        SHADER_TYPE_VERTEX,
+        SHADER_TYPE_HULL,
+        SHADER_TYPE_DOMAIN,
+        SHADER_TYPE_GEOMETRY,
+        SHADER_TYPE_PIXEL,
+    };
+
+    std::array<const ShaderStageInfo*, _countof(StageOrder)> Stages{};
+    // The index of the stage in ShaderStages, which is also the index of the specialization info
+    std::array<size_t, _countof(StageOrder)> StageIndices{};
+    for (size_t s = 0; s < ShaderStages.size(); ++s)
+    {
+        const ShaderStageInfo& Stage = ShaderStages[s];
+        VERIFY(Stage.Count() == 1, "Graphics pipeline stages must have exactly one shader");
+        for (size_t i = 0; i < _countof(StageOrder); ++i)
+        {
+            if (StageOrder[i] == Stage.Type)
+            {
+                Stages[i]       = &Stage;
+                StageIndices[i] = s;
+            }
+        }
+    }
+
+    std::array<VkDescriptorSetLayout, MAX_RESOURCE_SIGNATURES * PipelineResourceSignatureVkImpl::MAX_DESCRIPTOR_SETS> DescSetLayouts;
+
+    const Uint32 DescSetLayoutCount = m_PipelineLayout.GetVkDescriptorSetLayouts(m_Signatures, m_SignatureCount, DescSetLayouts.data());
+
+    std::vector<VkShaderCreateInfoEXT> ShaderCIs;
+    for (size_t i = 0; i < _countof(StageOrder); ++i)
+    {
+        if (Stages[i] == nullptr)
+            continue;
+
+        const ShaderStageInfo&       Stage = *Stages[i];
+        const std::vector<uint32_t>& SPIRV = Stage.SPIRVs[0];
+
+        VkShaderCreateInfoEXT ShaderCI{};
+        ShaderCI.sType = VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT;
+        ShaderCI.pNext = nullptr;
+        ShaderCI.flags = ShaderStages.size() > 1 ? VK_SHADER_CREATE_LINK_STAGE_BIT_EXT : 0;
+        if (Stage.Type == SHADER_TYPE_PIXEL && (GraphicsPipeline.ShadingRateFlags & PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED) != 0)
+            ShaderCI.flags |= VK_SHADER_CREATE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_EXT;
+        ShaderCI.stage = ShaderTypeToVkShaderStageFlagBit(Stage.Type);
+        // The next stage is the first stage used by the pipeline that follows this one
+        for (size_t j = i + 1; j < _countof(StageOrder) && ShaderCI.nextStage == 0; ++j)
+        {
+            if (Stages[j] != nullptr)
+                ShaderCI.nextStage = ShaderTypeToVkShaderStageFlagBit(Stages[j]->Type);
+        }
+        ShaderCI.codeType               = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+        ShaderCI.codeSize               = SPIRV.size() * sizeof(uint32_t);
+        ShaderCI.pCode                  = SPIRV.data();
+        ShaderCI.pName                  = Stage.Shaders[0]->GetEntryPoint();
+        ShaderCI.setLayoutCount         = DescSetLayoutCount;
+        ShaderCI.pSetLayouts            = DescSetLayoutCount != 0 ? DescSetLayouts.data() : nullptr;
+        ShaderCI.pushConstantRangeCount = 0;
+        ShaderCI.pPushConstantRanges    = nullptr;
+        ShaderCI.pSpecializationInfo    = SpecInfos[StageIndices[i]].GetVkSpecializationInfo();
+        ShaderCIs.push_back(ShaderCI);
+    }
+    VERIFY_EXPR(ShaderCIs.size() == ShaderStages.size());
+
+    pData->Shaders.resize(ShaderCIs.size());
+    LogicalDevice.CreateShaderObjects(static_cast<uint32_t>(ShaderCIs.size()), ShaderCIs.data(), pData->Shaders.data(), m_Desc.Name);
+
+    // All graphics stages enabled on the device must be bound, so unused stages are bound to null shaders
+    const VkPhysicalDeviceFeatures& Features = LogicalDevice.GetEnabledFeatures();
+    pData->vkStages.push_back(VK_SHADER_STAGE_VERTEX_BIT);
+    if (Features.tessellationShader != VK_FALSE)
+    {
+        pData->vkStages.push_back(VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT);
+        pData->vkStages.push_back(VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT);
+    }
+    if (Features.geometryShader != VK_FALSE)
+        pData->vkStages.push_back(VK_SHADER_STAGE_GEOMETRY_BIT);
+    pData->vkStages.push_back(VK_SHADER_STAGE_FRAGMENT_BIT);
+    if (ExtFeatures.MeshShader.taskShader != VK_FALSE)
+        pData->vkStages.push_back(VK_SHADER_STAGE_TASK_BIT_EXT);
+    if (ExtFeatures.MeshShader.meshShader != VK_FALSE)
+        pData->vkStages.push_back(VK_SHADER_STAGE_MESH_BIT_EXT);
+
+    pData->vkShaders.resize(pData->vkStages.size(), VK_NULL_HANDLE);
+    for (size_t i = 0; i < ShaderCIs.size(); ++i)
+    {
+        auto StageIt = std::find(pData->vkStages.begin(), pData->vkStages.end(), ShaderCIs[i].stage);
+        VERIFY(StageIt != pData->vkStages.end(), "Shader stage is not enabled on the device");
+        pData->vkShaders[StageIt - pData->vkStages.begin()] = pData->Shaders[i];
+    }
+
+    pData->RasterizerCI   = RasterizerStateDesc_To_VkRasterizationStateCI(GraphicsPipeline.RasterizerDesc);
+    pData->DepthStencilCI = DepthStencilStateDesc_To_VkDepthStencilStateCI(GraphicsPipeline.DepthStencilDesc);
+
+    {
+        std::vector<VkPipelineColorBlendAttachmentState> ColorBlendAttachmentStates(GraphicsPipeline.NumRenderTargets);
+
+        VkPipelineColorBlendStateCreateInfo BlendStateCI{};
+        BlendStateCI.pAttachments    = !ColorBlendAttachmentStates.empty() ? ColorBlendAttachmentStates.data() : nullptr;
+        BlendStateCI.attachmentCount = GraphicsPipeline.NumRenderTargets;
+        BlendStateDesc_To_VkBlendStateCI(GraphicsPipeline.BlendDesc, BlendStateCI, ColorBlendAttachmentStates);
+        if (BlendStateCI.logicOpEnable != VK_FALSE)
+            LOG_ERROR_AND_THROW("Logic operations are not supported when shader objects are used");
+
+        for (const VkPipelineColorBlendAttachmentState& AttachmentState : ColorBlendAttachmentStates)
+        {
+            pData->BlendEnables.push_back(AttachmentState.blendEnable);
+            pData->BlendEquations.push_back({
+                AttachmentState.srcColorBlendFactor,
+                AttachmentState.dstColorBlendFactor,
+                AttachmentState.colorBlendOp,
+                AttachmentState.srcAlphaBlendFactor,
+                AttachmentState.dstAlphaBlendFactor,
+                AttachmentState.alphaBlendOp,
+            });
+            pData->ColorWriteMasks.push_back(AttachmentState.colorWriteMask);
+        }
+    }
+
+    {
+        VkPipelineVertexInputStateCreateInfo           VertexInputStateCI   = {};
+        VkPipelineVertexInputDivisorStateCreateInfoEXT VertexInputDivisorCI = {};
+
+        std::array<VkVertexInputBindingDescription, MAX_LAYOUT_ELEMENTS>           BindingDescriptions;
+        std::array<VkVertexInputAttributeDescription, MAX_LAYOUT_ELEMENTS>         AttributeDescription;
+        std::array<VkVertexInputBindingDivisorDescriptionEXT, MAX_LAYOUT_ELEMENTS> VertexBindingDivisors;
+        InputLayoutDesc_To_VkVertexInputStateCI(GraphicsPipeline.InputLayout, VertexInputStateCI, VertexInputDivisorCI, BindingDescriptions, AttributeDescription, VertexBindingDivisors);
+
+        if (VertexInputDivisorCI.vertexBindingDivisorCount > 0 && !m_pDevice->GetFeatures().InstanceDataStepRate)
+            LOG_ERROR_MESSAGE("InstanceDataStepRate device feature is not enabled");
+
+        for (uint32_t i = 0; i < VertexInputStateCI.vertexBindingDescriptionCount; ++i)
+        {
+            const VkVertexInputBindingDescription& Binding = BindingDescriptions[i];
+
+            VkVertexInputBindingDescription2EXT Binding2{};
+            Binding2.sType     = VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT;
+            Binding2.binding   = Binding.binding;
+            Binding2.stride    = Binding.stride;
+            Binding2.inputRate = Binding.inputRate;
+            Binding2.divisor   = 1;
+            for (uint32_t d = 0; d < VertexInputDivisorCI.vertexBindingDivisorCount; ++d)
+            {
+                if (VertexBindingDivisors[d].binding == Binding.binding)
+                    Binding2.divisor = VertexBindingDivisors[d].divisor;
+            }
+            pData->VertexBindings.push_back(Binding2);
+        }
+
+        for (uint32_t i = 0; i < VertexInputStateCI.vertexAttributeDescriptionCount; ++i)
+        {
+            const VkVertexInputAttributeDescription& Attrib = AttributeDescription[i];
+
+            VkVertexInputAttributeDescription2EXT Attrib2{};
+            Attrib2.sType    = VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT;
+            Attrib2.location = Attrib.location;
+            Attrib2.binding  = Attrib.binding;
+            Attrib2.format   = Attrib.format;
+            Attrib2.offset   = Attrib.offset;
+            pData->VertexAttributes.push_back(Attrib2);
+        }
+    }
+
+    PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(GraphicsPipeline.PrimitiveTopology, pData->Topology, pData->PatchControlPoints);
+    pData->PrimitiveRestartEnable =
+        (GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP ||
+         GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ ||
+         GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_LINE_STRIP ||
+         GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ) ?
+        VK_TRUE :
+        VK_FALSE;
+    pData->SampleCount = static_cast<VkSampleCountFlagBits>(GraphicsPipeline.SmplDesc.Count);
+    pData->SampleMask  = GraphicsPipeline.SampleMask;
+
+    m_pShaderObjectData = std::move(pData);
 }
 
 void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
 {
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+    TSpecializationInfos                              SpecInfos;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    TShaderStages ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules, SpecInfos);
 
     const VkPipelineCache vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-    CreateComputePipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline, vkSPOCache);
+
+    PipelineCreationFeedback Feedback{m_pDevice->GetLogicalDevice()};
+    CreateComputePipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline, vkSPOCache, &Feedback);
+
+    Uint64                                 Duration = 0;
+    std::vector<PipelineStageCompileStats> StageStats;
+    const PIPELINE_CACHE_STATUS            CacheStatus = Feedback.GetStats(Duration, StageStats);
+    SetCompileStats(CacheStatus, Duration, std::move(StageStats));
+
+    StartBackgroundOptimization(CreateInfo, ShaderStages, SpecInfos);
+}
+
+void PipelineStateVkImpl::StartBackgroundLinkTimeOptimization(const PipelineStateCreateInfo& CreateInfo, std::vector<VkPipeline> Libraries, VkPipelineCreateFlags Flags)
+{
+    IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+    VERIFY_EXPR(pThreadPool != nullptr);
+
+    Flags |= VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+
+    // Libraries are owned by the device-level cache and outlive the pipeline.
+    // The task is waited for in the destructor, so it is safe to reference this object.
+    m_pOptimizationTask = EnqueueAsyncWork(
+        pThreadPool,
+        [this, Libraries = std::move(Libraries), Flags, pPSOCache = RefCntAutoPtr<IPipelineStateCache>{CreateInfo.pPSOCache}](Uint32 ThreadId) {
+            try
+            {
+                const VkPipelineCache vkSPOCache = pPSOCache ? pPSOCache.RawPtr<PipelineStateCacheVkImpl>()->GetVkPipelineCache() : VK_NULL_HANDLE;
+                m_OptimizedPipeline              = LinkGraphicsPipelineLibraries(m_pDevice->GetLogicalDevice(), Libraries, m_PipelineLayout.GetVkPipelineLayout(), Flags, vkSPOCache, m_Desc.Name);
+                m_OptimizedPipelineReady.store(true, std::memory_order_release);
+            }
+            catch (...)
+            {
+                LOG_WARNING_MESSAGE("Failed to link optimized pipeline '", m_Desc.Name, "'. The pipeline will keep using the fast-linked pipeline.");
+            }
+
+            return ASYNC_TASK_STATUS_COMPLETE;
+        });
+}
+
+void PipelineStateVkImpl::StartBackgroundOptimization(const PipelineStateCreateInfo& CreateInfo, TShaderStages& ShaderStages, const TSpecializationInfos& SpecInfos)
+{
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_BACKGROUND_OPTIMIZATION) == 0)
+        return;
+
+#if !DILIGENT_NO_HLSL
+    IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+    if (pThreadPool == nullptr)
+        return;
+
+    VERIFY_EXPR(m_Desc.IsAnyGraphicsPipeline() || m_Desc.IsComputePipeline());
+
+    // Shader objects may be released before the task is executed, so copy everything the task needs.
+    // Note that the byte code has already been remapped and stripped of reflection information.
+    struct OptimizationStage
+    {
+        SHADER_TYPE           Type;
+        std::string           ShaderName;
+        std::string           EntryPoint;
+        std::vector<uint32_t> SPIRV;
+        SpecializationInfo    SpecInfo;
+    };
+    std::vector<OptimizationStage> Stages;
+    for (ShaderStageInfo& Stage : ShaderStages)
+    {
+        for (size_t i = 0; i < Stage.Count(); ++i)
+        {
+            const ShaderVkImpl* pShader = Stage.Shaders[i];
+            // Specialization infos are in the same order as the shader modules
+            const SpecializationInfo& SpecInfo = SpecInfos[Stages.size()];
+            Stages.push_back({Stage.Type, pShader->GetDesc().Name, pShader->GetEntryPoint(), std::move(Stage.SPIRVs[i]), SpecInfo});
+        }
+    }
+    VERIFY_EXPR(Stages.size() == SpecInfos.size());
+
+    // The task is waited for in the destructor, so it is safe to reference this object
+    m_pOptimizationTask = EnqueueAsyncWork(
+        pThreadPool,
+        [this, Stages = std::move(Stages), pPSOCache = RefCntAutoPtr<IPipelineStateCache>{CreateInfo.pPSOCache}](Uint32 ThreadId) mutable {
+            for (OptimizationStage& Stage : Stages)
+            {
+                // Specialization constants are referenced by their IDs that are preserved by the optimizer
+                std::vector<uint32_t> OptimizedSPIRV = OptimizeSPIRV(Stage.SPIRV, SPV_ENV_MAX, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+                if (OptimizedSPIRV.empty())
+                {
+                    LOG_WARNING_MESSAGE("Failed to optimize shader '", Stage.ShaderName, "' of pipeline '", m_Desc.Name, "'. The pipeline will keep using the unoptimized byte code.");
+                    return ASYNC_TASK_STATUS_COMPLETE;
+                }
+                Stage.SPIRV = std::move(OptimizedSPIRV);
+            }
+
+            try
+            {
+                const VulkanUtilities::LogicalDevice& LogicalDevice = m_pDevice->GetLogicalDevice();
+
+                std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+                std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
+                for (OptimizationStage& Stage : Stages)
+                {
+                    VkShaderModuleCreateInfo ShaderModuleCI{};
+                    ShaderModuleCI.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+                    ShaderModuleCI.codeSize = Stage.SPIRV.size() * sizeof(uint32_t);
+                    ShaderModuleCI.pCode    = Stage.SPIRV.data();
+                    ShaderModules.push_back(LogicalDevice.CreateShaderModule(ShaderModuleCI, Stage.ShaderName.c_str()));
+
+                    VkPipelineShaderStageCreateInfo StageCI{};
+                    StageCI.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+                    StageCI.stage  = ShaderTypeToVkShaderStageFlagBit(Stage.Type);
+                    StageCI.module = ShaderModules.back();
+                    StageCI.pName  = Stage.EntryPoint.c_str();
+
+                    StageCI.pSpecializationInfo = Stage.SpecInfo.GetVkSpecializationInfo();
+                    vkShaderStages.push_back(StageCI);
+                }
+
+                const VkPipelineCache vkSPOCache = pPSOCache ? pPSOCache.RawPtr<PipelineStateCacheVkImpl>()->GetVkPipelineCache() : VK_NULL_HANDLE;
+                if (m_Desc.IsComputePipeline())
+                    CreateComputePipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_OptimizedPipeline, vkSPOCache);
+                else
+                    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_OptimizedPipeline, GetRenderPassPtr(), HasExtendedDynamicState(), vkSPOCache);
+
+                m_OptimizedPipelineReady.store(true, std::memory_order_release);
+            }
+            catch (...)
+            {
+                LOG_WARNING_MESSAGE("Failed to create optimized pipeline '", m_Desc.Name, "'. The pipeline will keep using the unoptimized byte code.");
+            }
+
+            return ASYNC_TASK_STATUS_COMPLETE;
+        });
+#endif
 }
 
 void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo)
@@ -881,12 +1522,19 @@ void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreate
 
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+    TSpecializationInfos                              SpecInfos;
 
-    const PipelineStateVkImpl::TShaderStages                ShaderStages   = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    const PipelineStateVkImpl::TShaderStages                ShaderStages   = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules, SpecInfos);
     const std::vector<VkRayTracingShaderGroupCreateInfoKHR> vkShaderGroups = BuildRTShaderGroupDescription(CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex, ShaderStages);
     const VkPipelineCache                                   vkSPOCache     = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
 
-    CreateRayTracingPipeline(m_pDevice, vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, m_pRayTracingPipelineData->Desc, m_Pipeline, vkSPOCache);
+    PipelineCreationFeedback Feedback{LogicalDevice};
+    CreateRayTracingPipeline(m_pDevice, vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, m_pRayTracingPipelineData->Desc, m_Pipeline, vkSPOCache, &Feedback);
+
+    Uint64                                 Duration = 0;
+    std::vector<PipelineStageCompileStats> StageStats;
+    const PIPELINE_CACHE_STATUS            CacheStatus = Feedback.GetStats(Duration, StageStats);
+    SetCompileStats(CacheStatus, Duration, std::move(StageStats));
 
     VERIFY(m_pRayTracingPipelineData->NameToGroupIndex.size() == vkShaderGroups.size(),
            "The size of NameToGroupIndex map does not match the actual number of groups in the pipeline. This is a bug.");
@@ -926,13 +1574,28 @@ PipelineStateVkImpl::~PipelineStateVkImpl()
     // This needs to be done in the final class before the destruction begins.
     GetStatus(/*WaitForCompletion =*/true);
 
+    // The background optimization task is started by the initialization task, so wait for it after.
+    if (m_pOptimizationTask)
+    {
+        m_pOptimizationTask->Cancel();
+        m_pOptimizationTask->WaitForCompletion();
+    }
+
     Destruct();
 }
 
 void PipelineStateVkImpl::Destruct()
 {
     m_pDevice->SafeReleaseDeviceObject(std::move(m_Pipeline), m_Desc.ImmediateContextMask);
-    m_PipelineLayout.Release(m_pDevice, m_Desc.ImmediateContextMask);
+    if (m_OptimizedPipeline)
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_OptimizedPipeline), m_Desc.ImmediateContextMask);
+    if (m_pShaderObjectData)
+    {
+        for (VulkanUtilities::ShaderObjectWrapper& Shader : m_pShaderObjectData->Shaders)
+            m_pDevice->SafeReleaseDeviceObject(std::move(Shader), m_Desc.ImmediateContextMask);
+        m_pShaderObjectData.reset();
+    }
+    m_PipelineLayout.Release(m_pDevice);
 
     TPipelineStateBase::Destruct();
 }
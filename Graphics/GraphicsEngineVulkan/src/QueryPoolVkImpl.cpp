@@ -0,0 +1,96 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "QueryPoolVkImpl.hpp"
+
+#include "RenderDeviceVkImpl.hpp"
+#include "VulkanUtilities/CommandBuffer.hpp"
+
+namespace Diligent
+{
+
+QueryPoolVkImpl::QueryPoolVkImpl(IReferenceCounters*  pRefCounters,
+                                 RenderDeviceVkImpl*  pDevice,
+                                 const QueryPoolDesc& Desc) :
+    TQueryPoolBase{pRefCounters, pDevice, Desc}
+{
+    const VulkanUtilities::LogicalDevice&  LogicalDevice  = pDevice->GetLogicalDevice();
+    const VulkanUtilities::PhysicalDevice& PhysicalDevice = pDevice->GetPhysicalDevice();
+
+    VkQueryPoolCreateInfo QueryPoolCI{};
+    QueryPoolCI.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    QueryPoolCI.pNext      = nullptr;
+    QueryPoolCI.flags      = 0;
+    QueryPoolCI.queryType  = m_Desc.Type == QUERY_TYPE_TIMESTAMP ? VK_QUERY_TYPE_TIMESTAMP : VK_QUERY_TYPE_OCCLUSION;
+    QueryPoolCI.queryCount = m_Desc.QueryCount;
+    m_vkQueryPool          = LogicalDevice.CreateQueryPool(QueryPoolCI, m_Desc.Name);
+
+    // After query pool creation, each query must be reset before it is used (17.2).
+    // Subsequent resets are performed by IDeviceContext::ResolvePoolQueries().
+    if (LogicalDevice.GetEnabledExtFeatures().HostQueryReset.hostQueryReset)
+    {
+        LogicalDevice.ResetQueryPool(m_vkQueryPool, 0, m_Desc.QueryCount);
+    }
+    else
+    {
+        // vkCmdResetQueryPool is not supported by transfer-only queues
+        SoftwareQueueIndex CmdQueueInd{0};
+        bool               QueueFound = false;
+        for (Uint32 q = 0; q < pDevice->GetCommandQueueCount() && !QueueFound; ++q)
+        {
+            const HardwareQueueIndex QueueFamilyIndex{pDevice->GetCommandQueue(SoftwareQueueIndex{q}).GetQueueFamilyIndex()};
+            const VkQueueFlags       QueueFlags = PhysicalDevice.GetQueueProperties()[QueueFamilyIndex].queueFlags;
+            if ((QueueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) != 0)
+            {
+                CmdQueueInd = SoftwareQueueIndex{q};
+                QueueFound  = true;
+            }
+        }
+        if (!QueueFound)
+            LOG_ERROR_AND_THROW("Unable to find a graphics or compute queue to reset the query pool");
+
+        VulkanUtilities::CommandPoolWrapper CmdPool;
+        VulkanUtilities::CommandBuffer      CmdBuffer;
+        pDevice->AllocateTransientCmdPool(CmdQueueInd, CmdPool, CmdBuffer, "Transient command pool to reset query pool");
+        CmdBuffer.ResetQueryPool(m_vkQueryPool, 0, m_Desc.QueryCount);
+        pDevice->ExecuteAndDisposeTransientCmdBuff(CmdQueueInd, CmdBuffer.GetVkCmdBuffer(), std::move(CmdPool));
+
+        // Other queues are not synchronized with the reset
+        if (pDevice->GetCommandQueueCount() > 1)
+            pDevice->IdleCommandQueue(CmdQueueInd, false);
+    }
+}
+
+QueryPoolVkImpl::~QueryPoolVkImpl()
+{
+    // The pool may still be referenced by command buffers of any context
+    m_pDevice->SafeReleaseDeviceObject(std::move(m_vkQueryPool), ~Uint64{0});
+}
+
+} // namespace Diligent
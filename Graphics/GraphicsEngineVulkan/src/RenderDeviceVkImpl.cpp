@@ -38,6 +38,7 @@
 #include "DeviceContextVkImpl.hpp"
 #include "FenceVkImpl.hpp"
 #include "QueryVkImpl.hpp"
+#include "QueryPoolVkImpl.hpp"
 #include "RenderPassVkImpl.hpp"
 #include "FramebufferVkImpl.hpp"
 #include "BottomLevelASVkImpl.hpp"
@@ -52,6 +53,8 @@
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
 #include "QueryManagerVk.hpp"
+#include "FenceCompletionSchedulerVk.hpp"
+#include "Trace.hpp"
 
 namespace Diligent
 {
@@ -85,6 +88,7 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     m_Instance         {Instance                 },
     m_PhysicalDevice         {std::move(PhysicalDevice)},
     m_LogicalDevice        {std::move(LogicalDevice) },
+    m_pDxCompiler{CreateDXCompiler(DXCompilerTarget::Vulkan, m_PhysicalDevice->GetVkVersion(), EngineCI.pDxCompilerPath, EngineCI.pDxCompilerCachePath, /*LoadAsync = */ true)},
     m_DescriptorSetAllocator
     {
         *this,
@@ -138,16 +142,19 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DeviceLocalMemoryPageSize,
         EngineCI.HostVisibleMemoryPageSize,
         EngineCI.DeviceLocalMemoryReserveSize,
-        EngineCI.HostVisibleMemoryReserveSize
+        EngineCI.HostVisibleMemoryReserveSize,
+        EngineCI.MemoryBudgetUsageLimit
     },
     m_DynamicMemoryManager
     {
-        GetRawAllocator(),
+        GetCategoryAllocator(MEMORY_CATEGORY_STAGING),
         *this,
         EngineCI.DynamicHeapSize,
-        ~Uint64{0}
-    },
-    m_pDxCompiler{CreateDXCompiler(DXCompilerTarget::Vulkan, m_PhysicalDevice->GetVkVersion(), EngineCI.pDxCompilerPath)}
+        ~Uint64{0},
+        EngineCI.Features.GPUUploadMemory != DEVICE_FEATURE_STATE_DISABLED &&
+            AdapterInfo.Features.GPUUploadMemory != DEVICE_FEATURE_STATE_DISABLED &&
+            EngineCI.DynamicHeapSize <= EngineCI.GPUUploadMemoryBudget
+    }
 // clang-format on
 {
     if (!m_LogicalDevice->GetEnabledExtFeatures().DynamicRendering.dynamicRendering)
@@ -156,6 +163,15 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         m_ImplicitRenderPassCache = std::make_unique<RenderPassCache>(*this);
     }
 
+    // Pipeline libraries are only beneficial when they can be linked fast
+    if (m_LogicalDevice->GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE &&
+        m_PhysicalDevice->GetExtProperties().GraphicsPipelineLibrary.graphicsPipelineLibraryFastLinking != VK_FALSE)
+    {
+        m_PipelineLibraryCache = std::make_unique<PipelineLibraryCache>();
+    }
+
+    m_PipelineLayoutCache = std::make_unique<PipelineLayoutCacheVk>(*this);
+
     static_assert(sizeof(VulkanDescriptorPoolSize) == sizeof(Uint32) * 11, "Please add new descriptors to m_DescriptorSetAllocator and m_DynamicDescriptorPool constructors");
 
     const uint32_t vkVersion = m_PhysicalDevice->GetVkVersion();
@@ -167,6 +183,10 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
                                                        m_PhysicalDevice->GetProperties(),
                                                        m_LogicalDevice->GetEnabledExtFeatures(),
                                                        m_PhysicalDevice->GetExtProperties());
+    // GPU upload memory does not require any Vulkan feature to be enabled
+    m_DeviceInfo.Features.GPUUploadMemory = (EngineCI.Features.GPUUploadMemory != DEVICE_FEATURE_STATE_DISABLED && AdapterInfo.Features.GPUUploadMemory != DEVICE_FEATURE_STATE_DISABLED) ?
+        DEVICE_FEATURE_STATE_ENABLED :
+        DEVICE_FEATURE_STATE_DISABLED;
 
     m_DeviceInfo.MaxShaderVersion.HLSL   = {5, 1};
     m_DeviceInfo.MaxShaderVersion.GLSL   = {4, 6};
@@ -200,6 +220,7 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
 
         m_QueryMgrs.emplace_back(std::make_unique<QueryManagerVk>(this, EngineCI.QueryPoolSizes, SoftwareQueueIndex{q}));
     }
+    m_InitialDataUploads = std::make_unique<InitialDataUploadBatch[]>(CommandQueueCount);
 
     for (Uint32 fmt = 1; fmt < m_TextureFormatsInfo.size(); ++fmt)
         m_TextureFormatsInfo[fmt].Supported = true; // We will test every format on a specific hardware device
@@ -209,6 +230,9 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
 
 RenderDeviceVkImpl::~RenderDeviceVkImpl()
 {
+    // Stop the thread that waits for the fence semaphores
+    DestroyFenceCompletionScheduler();
+
     // Explicitly destroy dynamic heap. This will move resources owned by
     // the heap into release queues
     m_DynamicMemoryManager.Destroy();
@@ -289,9 +313,9 @@ void RenderDeviceVkImpl::AllocateTransientCmdPool(SoftwareQueueIndex
 }
 
 
-void RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex                    CommandQueueId,
-                                                           VkCommandBuffer                       vkCmdBuff,
-                                                           VulkanUtilities::CommandPoolWrapper&& CmdPool)
+Uint64 RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex                    CommandQueueId,
+                                                             VkCommandBuffer                       vkCmdBuff,
+                                                             VulkanUtilities::CommandPoolWrapper&& CmdPool)
 {
     VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
 
@@ -401,6 +425,72 @@ void RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex
         },
         FenceValue);
     // clang-format on
+
+    return FenceValue;
+}
+
+void RenderDeviceVkImpl::EnqueueInitialDataUpload(SoftwareQueueIndex                                          CommandQueueId,
+                                                  VulkanUtilities::BufferWrapper&&                            StagingBuffer,
+                                                  VulkanUtilities::MemoryAllocation&&                         StagingMemory,
+                                                  const std::function<void(VulkanUtilities::CommandBuffer&)>& RecordCommands)
+{
+    // The batch is submitted when either limit is reached, so that the staging memory
+    // is not held for too long and the command buffer does not grow indefinitely.
+    constexpr VkDeviceSize MaxBatchStagingSize = VkDeviceSize{64} << 20;
+    constexpr size_t       MaxBatchUploadCount = 4096;
+
+    VERIFY_EXPR(CommandQueueId < GetCommandQueueCount());
+
+    std::lock_guard<std::mutex> Lock{m_InitialDataUploadsMtx};
+
+    InitialDataUploadBatch& Batch = m_InitialDataUploads[CommandQueueId];
+    if (Batch.CmdBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE)
+    {
+        // Transient command pools must not be used by multiple threads simultaneously,
+        // which is guaranteed by the mutex.
+        AllocateTransientCmdPool(CommandQueueId, Batch.CmdPool, Batch.CmdBuffer, "Transient command pool to upload initial resource data");
+        m_NumPendingInitialDataUploads.fetch_add(1);
+    }
+
+    // Copy commands must be recorded outside of a render pass instance. This is OK here
+    // as the command buffer only contains copy commands.
+    RecordCommands(Batch.CmdBuffer);
+
+    Batch.StagingSize += StagingMemory.Size;
+    Batch.Staging.Buffers.emplace_back(std::move(StagingBuffer));
+    Batch.Staging.Memory.emplace_back(std::move(StagingMemory));
+
+    if (Batch.StagingSize >= MaxBatchStagingSize || Batch.Staging.Buffers.size() >= MaxBatchUploadCount)
+        SubmitInitialDataUploads(CommandQueueId);
+}
+
+void RenderDeviceVkImpl::SubmitInitialDataUploads(SoftwareQueueIndex CommandQueueId)
+{
+    InitialDataUploadBatch& Batch = m_InitialDataUploads[CommandQueueId];
+    if (Batch.CmdBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE)
+        return;
+
+    Batch.CmdBuffer.FlushBarriers();
+    const Uint64 FenceValue = ExecuteAndDisposeTransientCmdBuff(CommandQueueId, Batch.CmdBuffer.GetVkCmdBuffer(), std::move(Batch.CmdPool));
+    Batch.CmdBuffer.Reset();
+
+    // All staging resources of the batch are tracked by the fence of the single submission
+    GetReleaseQueue(CommandQueueId).DiscardResource(std::move(Batch.Staging), FenceValue);
+    Batch.Staging     = {};
+    Batch.StagingSize = 0;
+
+    VERIFY_EXPR(m_NumPendingInitialDataUploads.load() > 0);
+    m_NumPendingInitialDataUploads.fetch_sub(1);
+}
+
+void RenderDeviceVkImpl::FlushInitialDataUploads()
+{
+    if (m_NumPendingInitialDataUploads.load() == 0)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_InitialDataUploadsMtx};
+    for (Uint32 q = 0; q < GetCommandQueueCount(); ++q)
+        SubmitInitialDataUploads(SoftwareQueueIndex{q});
 }
 
 void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex                                          CommandQueueId,
@@ -431,6 +521,10 @@ void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex
 
 Uint64 RenderDeviceVkImpl::ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueId, const VkSubmitInfo& SubmitInfo, std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences)
 {
+    // Resources created before this command buffer was recorded may be used by it, so their
+    // initial data must be uploaded first. Resources may be used by any queue, so all batches are submitted.
+    FlushInitialDataUploads();
+
     Uint64 SubmittedFenceValue    = 0;
     Uint64 SubmittedCmdBuffNumber = 0;
     SubmitCommandBuffer(CommandQueueId, SubmitInfo, SubmittedCmdBuffNumber, SubmittedFenceValue, pSignalFences);
@@ -444,6 +538,7 @@ Uint64 RenderDeviceVkImpl::ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueI
 
 void RenderDeviceVkImpl::IdleGPU()
 {
+    FlushInitialDataUploads();
     IdleAllCommandQueues(true);
     m_LogicalDevice->WaitIdle();
     ReleaseStaleResources();
@@ -451,6 +546,9 @@ void RenderDeviceVkImpl::IdleGPU()
 
 void RenderDeviceVkImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
 {
+    // Stale resources may be referenced by the pending uploads, which must be submitted first
+    FlushInitialDataUploads();
+
     // Submit empty command buffer to the queue. This will effectively signal the fence and
     // discard all resources
     VkSubmitInfo DummySubmitInfo{};
@@ -460,11 +558,27 @@ void RenderDeviceVkImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
 
 void RenderDeviceVkImpl::ReleaseStaleResources(bool ForceRelease)
 {
+    DILIGENT_TRACE_SCOPE("ReleaseStaleResources");
+
     m_MemoryMgr.ShrinkMemory();
-    PurgeReleaseQueues(ForceRelease);
+    if (ForceRelease)
+        PurgeReleaseQueues(/*ForceRelease = */ true);
+    else
+        PurgeReleaseQueuesWithBudget();
 }
 
 
+std::unique_ptr<FenceCompletionScheduler> RenderDeviceVkImpl::CreateFenceCompletionScheduler()
+{
+#if DILIGENT_USE_VOLK
+    // Timeline semaphores of all pending fences can be waited for at once
+    if (m_DeviceInfo.Features.NativeFence)
+        return std::make_unique<FenceCompletionSchedulerVk>(*m_LogicalDevice);
+#endif
+    // Fences are thread-safe, so the worker thread can poll them
+    return std::make_unique<FenceCompletionScheduler>(/*UseWorkerThread = */ true);
+}
+
 void RenderDeviceVkImpl::TestTextureFormat(TEXTURE_FORMAT TexFormat)
 {
     TextureFormatInfoExt& TexFormatInfo = m_TextureFormatsInfo[TexFormat];
@@ -659,6 +773,22 @@ void RenderDeviceVkImpl::CreateQuery(const QueryDesc& Desc, IQuery** ppQuery)
     CreateQueryImpl(ppQuery, Desc);
 }
 
+void RenderDeviceVkImpl::CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool)
+{
+    CreateDeviceObject("Query Pool", Desc, ppQueryPool,
+                       [&]() //
+                       {
+                           QueryPoolVkImpl* pQueryPoolVk = NEW_RC_OBJ(GetRawAllocator(), "QueryPoolVkImpl instance", QueryPoolVkImpl)(this, Desc);
+                           pQueryPoolVk->QueryInterface(IID_QueryPool, reinterpret_cast<IObject**>(ppQueryPool));
+                       });
+}
+
+void RenderDeviceVkImpl::CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc, IIndirectCommandSignature** ppSignature)
+{
+    UNSUPPORTED("CreateIndirectCommandSignature is not supported in Vulkan");
+    *ppSignature = nullptr;
+}
+
 void RenderDeviceVkImpl::CreateRenderPass(const RenderPassDesc& Desc,
                                           IRenderPass**         ppRenderPass,
                                           bool                  IsDeviceInternal)
@@ -743,6 +873,16 @@ void RenderDeviceVkImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& Create
     CreateDeviceMemoryImpl(ppMemory, CreateInfo);
 }
 
+void RenderDeviceVkImpl::CreatePlacedTexture(const TextureDesc& TexDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, ITexture** ppTexture)
+{
+    CreateTextureImpl(ppTexture, TexDesc, pMemory, MemoryOffset);
+}
+
+void RenderDeviceVkImpl::CreatePlacedBuffer(const BufferDesc& BuffDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, IBuffer** ppBuffer)
+{
+    CreateBufferImpl(ppBuffer, BuffDesc, pMemory, MemoryOffset);
+}
+
 void RenderDeviceVkImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo, IPipelineStateCache** ppPipelineStateCache)
 {
     CreatePipelineStateCacheImpl(ppPipelineStateCache, CreateInfo);
@@ -780,6 +920,36 @@ HardwareQueueIndex RenderDeviceVkImpl::GetQueueFamilyIndex(SoftwareQueueIndex Cm
     return HardwareQueueIndex{CmdQueue.GetQueueFamilyIndex()};
 }
 
+ResourceMemoryRequirements RenderDeviceVkImpl::GetTextureMemoryRequirements(const TextureDesc& TexDesc) const
+{
+    if (!m_AdapterInfo.Memory.PlacedResources)
+        return {};
+
+    try
+    {
+        return TextureVkImpl::GetPlacedMemoryRequirements(TexDesc, this);
+    }
+    catch (...)
+    {
+        return {};
+    }
+}
+
+ResourceMemoryRequirements RenderDeviceVkImpl::GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const
+{
+    if (!m_AdapterInfo.Memory.PlacedResources)
+        return {};
+
+    try
+    {
+        return BufferVkImpl::GetPlacedMemoryRequirements(BuffDesc, this);
+    }
+    catch (...)
+    {
+        return {};
+    }
+}
+
 SparseTextureFormatInfo RenderDeviceVkImpl::GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
                                                                        RESOURCE_DIMENSION Dimension,
                                                                        Uint32             SampleCount) const
@@ -837,4 +1007,30 @@ void RenderDeviceVkImpl::GetDeviceFeaturesVk(DeviceFeaturesVk& FeaturesVk) const
     FeaturesVk = PhysicalDeviceFeaturesToDeviceFeaturesVk(m_LogicalDevice->GetEnabledExtFeatures());
 }
 
+Uint32 RenderDeviceVkImpl::GetMemoryHeapCount() const
+{
+    return m_PhysicalDevice->GetMemoryProperties().memoryHeapCount;
+}
+
+void RenderDeviceVkImpl::GetMemoryHeapUsage(Uint32 HeapIndex, MemoryHeapUsageVk& Usage) const
+{
+    Usage = {};
+
+    const VkPhysicalDeviceMemoryProperties& MemProps = m_PhysicalDevice->GetMemoryProperties();
+    if (HeapIndex >= MemProps.memoryHeapCount)
+    {
+        DEV_ERROR("Heap index (", HeapIndex, ") is out of range. The device has ", MemProps.memoryHeapCount, " memory heaps.");
+        return;
+    }
+
+    const VulkanUtilities::MemoryManager::HeapUsage HeapUsage = m_MemoryMgr.GetHeapUsage(HeapIndex);
+
+    Usage.Flags         = MemProps.memoryHeaps[HeapIndex].flags;
+    Usage.HeapSize      = MemProps.memoryHeaps[HeapIndex].size;
+    Usage.Budget        = HeapUsage.Budget;
+    Usage.Usage         = HeapUsage.Usage;
+    Usage.AllocatedSize = HeapUsage.AllocatedSize;
+    Usage.UsedSize      = HeapUsage.UsedSize;
+}
+
 } // namespace Diligent
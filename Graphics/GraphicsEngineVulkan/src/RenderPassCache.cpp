@@ -67,6 +67,18 @@ void RenderPassCache::Destroy()
     m_Cache.clear();
 }
 
+// Returns the load operation of the implicit render pass attachment. Unless the attachment
+// is cleared or discarded, previous contents of the image within the render area are preserved.
+static ATTACHMENT_LOAD_OP GetImplicitLoadOp(Uint32 AttachmentBit, Uint32 ClearMask, Uint32 DiscardMask)
+{
+    if ((ClearMask & AttachmentBit) != 0)
+        return ATTACHMENT_LOAD_OP_CLEAR;
+    else if ((DiscardMask & AttachmentBit) != 0)
+        return ATTACHMENT_LOAD_OP_DISCARD;
+    else
+        return ATTACHMENT_LOAD_OP_LOAD;
+}
+
 static RenderPassDesc GetImplicitRenderPassDesc(
     Uint32                                                        NumRenderTargets,
     const TEXTURE_FORMAT                                          RTVFormats[],
@@ -75,6 +87,8 @@ static RenderPassDesc GetImplicitRenderPassDesc(
     Uint8                                                         SampleCount,
     TEXTURE_FORMAT                                                ShadingRateTexFormat,
     uint2                                                         ShadingRateTileSize,
+    Uint32                                                        ClearMask,
+    Uint32                                                        DiscardMask,
     std::array<RenderPassAttachmentDesc, MAX_RENDER_TARGETS + 2>& Attachments,
     std::array<AttachmentReference, MAX_RENDER_TARGETS + 2>&      AttachmentReferences,
     SubpassDesc&                                                  SubpassDesc,
@@ -95,13 +109,11 @@ static RenderPassDesc GetImplicitRenderPassDesc(
 
         DepthAttachment.Format      = DSVFormat;
         DepthAttachment.SampleCount = SampleCount;
-        DepthAttachment.LoadOp      = ATTACHMENT_LOAD_OP_LOAD; // previous contents of the image within the render area
-                                                               // will be preserved. For attachments with a depth/stencil format,
-                                                               // this uses the access type VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT.
-        DepthAttachment.StoreOp = ATTACHMENT_STORE_OP_STORE;   // the contents generated during the render pass and within the render
-                                                               // area are written to memory. For attachments with a depth/stencil format,
-                                                               // this uses the access type VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT.
-        DepthAttachment.StencilLoadOp  = ATTACHMENT_LOAD_OP_LOAD;
+        DepthAttachment.LoadOp      = GetImplicitLoadOp(RenderPassCache::RenderPassCacheKey::DepthAttachmentBit, ClearMask, DiscardMask);
+        DepthAttachment.StoreOp     = ATTACHMENT_STORE_OP_STORE; // the contents generated during the render pass and within the render
+                                                                 // area are written to memory. For attachments with a depth/stencil format,
+                                                                 // this uses the access type VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT.
+        DepthAttachment.StencilLoadOp  = GetImplicitLoadOp(RenderPassCache::RenderPassCacheKey::StencilAttachmentBit, ClearMask, DiscardMask);
         DepthAttachment.StencilStoreOp = ATTACHMENT_STORE_OP_STORE;
         DepthAttachment.InitialState   = DepthAttachmentState;
         DepthAttachment.FinalState     = DepthAttachmentState;
@@ -128,12 +140,10 @@ static RenderPassDesc GetImplicitRenderPassDesc(
 
         ColorAttachment.Format      = RTVFormats[rt];
         ColorAttachment.SampleCount = SampleCount;
-        ColorAttachment.LoadOp      = ATTACHMENT_LOAD_OP_LOAD; // previous contents of the image within the render area
-                                                               // will be preserved. For attachments with a depth/stencil format,
-                                                               // this uses the access type VK_ACCESS_COLOR_ATTACHMENT_READ_BIT.
-        ColorAttachment.StoreOp = ATTACHMENT_STORE_OP_STORE;   // the contents generated during the render pass and within the render
-                                                               // area are written to memory. For attachments with a color format,
-                                                               // this uses the access type VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT.
+        ColorAttachment.LoadOp      = GetImplicitLoadOp(1u << rt, ClearMask, DiscardMask);
+        ColorAttachment.StoreOp     = ATTACHMENT_STORE_OP_STORE; // the contents generated during the render pass and within the render
+                                                                 // area are written to memory. For attachments with a color format,
+                                                                 // this uses the access type VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT.
         ColorAttachment.StencilLoadOp  = ATTACHMENT_LOAD_OP_DISCARD;
         ColorAttachment.StencilStoreOp = ATTACHMENT_STORE_OP_DISCARD;
         ColorAttachment.InitialState   = RESOURCE_STATE_RENDER_TARGET;
@@ -218,7 +228,7 @@ RenderPassVkImpl* RenderPassCache::GetRenderPass(const RenderPassCacheKey& Key)
         ShadingRateAttachment ShadingRate;
 
         RenderPassDesc RPDesc = GetImplicitRenderPassDesc(Key.NumRenderTargets, Key.RTVFormats, Key.DSVFormat, Key.ReadOnlyDSV, Key.SampleCount,
-                                                          SRFormat, SRTileSize, Attachments, AttachmentReferences, Subpass, ShadingRate);
+                                                          SRFormat, SRTileSize, Key.ClearMask, Key.DiscardMask, Attachments, AttachmentReferences, Subpass, ShadingRate);
 
         std::stringstream PassNameSS;
         PassNameSS << "Implicit render pass: RT count: " << Uint32{Key.NumRenderTargets} << "; sample count: " << Uint32{Key.SampleCount}
@@ -233,6 +243,10 @@ RenderPassVkImpl* RenderPassCache::GetRenderPass(const RenderPassCacheKey& Key)
         }
         if (Key.EnableVRS)
             PassNameSS << "; VRS";
+        if (Key.ClearMask != 0)
+            PassNameSS << "; clear mask: 0x" << std::hex << Key.ClearMask << std::dec;
+        if (Key.DiscardMask != 0)
+            PassNameSS << "; discard mask: 0x" << std::hex << Key.DiscardMask << std::dec;
 
         const std::string PassName{PassNameSS.str()};
         RPDesc.Name = PassName.c_str();
@@ -98,6 +98,19 @@ inline void SetSubpassDescriptionNext(VkSubpassDescription2& Subpass, const void
     Subpass.pNext = pNext;
 }
 
+inline void SetSubpassViewMask(VkSubpassDescription&, uint32_t) {}
+inline void SetSubpassViewMask(VkSubpassDescription2& Subpass, uint32_t ViewMask)
+{
+    Subpass.viewMask = ViewMask;
+}
+
+inline void SetCorrelatedViewMask(VkRenderPassCreateInfo&, const uint32_t*) {}
+inline void SetCorrelatedViewMask(VkRenderPassCreateInfo2& RenderPassCI, const uint32_t* pCorrelationMask)
+{
+    RenderPassCI.correlatedViewMaskCount = pCorrelationMask != nullptr ? 1 : 0;
+    RenderPassCI.pCorrelatedViewMasks    = pCorrelationMask;
+}
+
 inline void InitSubpassDependency(VkSubpassDependency&) {}
 inline void InitSubpassDependency(VkSubpassDependency2& Dependency)
 {
@@ -177,6 +190,30 @@ void RenderPassVkImpl::CreateRenderPass() noexcept(false)
     // but also as input attachment in the same subpass. Such attachments need to use GENERAL layout.
     std::vector<RESOURCE_STATE> AttachmentStates(m_Desc.AttachmentCount);
 
+    // Multiview is enabled for all subpasses or for none (see ValidateRenderPassDesc)
+    const bool            MultiviewEnabled = m_Desc.SubpassCount > 0 && m_Desc.pSubpasses[0].ViewMask != 0;
+    std::vector<uint32_t> vkViewMasks;
+    uint32_t              vkCorrelationMask = 0;
+    if (MultiviewEnabled)
+    {
+        const uint32_t MaxViewCount = m_pDevice->GetPhysicalDevice().GetExtProperties().Multiview.maxMultiviewViewCount;
+
+        vkViewMasks.resize(m_Desc.SubpassCount);
+        for (Uint32 i = 0; i < m_Desc.SubpassCount; ++i)
+        {
+            const Uint32 ViewMask = m_Desc.pSubpasses[i].ViewMask;
+            if (PlatformMisc::GetMSB(ViewMask) >= MaxViewCount)
+            {
+                LOG_ERROR_AND_THROW("Description of render pass '", m_Desc.Name, "' is invalid: view mask ", ViewMask, " of subpass ", i,
+                                    " uses views beyond the maximum view count (", MaxViewCount, ") supported by the device.");
+            }
+            vkViewMasks[i] = ViewMask;
+            // All views of a subpass are assumed to be spatially correlated (e.g. the two eyes of a stereo pair),
+            // which lets the implementation render them concurrently.
+            vkCorrelationMask |= ViewMask;
+        }
+    }
+
     std::vector<SubpassDescriptionType> vkSubpasses(m_Desc.SubpassCount);
     for (Uint32 i = 0, SRInd = 0; i < m_Desc.SubpassCount; ++i)
     {
@@ -186,6 +223,7 @@ void RenderPassVkImpl::CreateRenderPass() noexcept(false)
         InitSubpassDescription(vkSubpass);
         vkSubpass.flags             = 0;
         vkSubpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        SetSubpassViewMask(vkSubpass, SubpassDesc.ViewMask);
 
         std::fill(AttachmentStates.begin(), AttachmentStates.end(), RESOURCE_STATE_UNKNOWN);
         auto UpdateAttachmentsStates = [&AttachmentStates](Uint32 NumAttachments, const AttachmentReference* pSrcAttachments) //
@@ -330,11 +368,36 @@ void RenderPassVkImpl::CreateRenderPass() noexcept(false)
     RenderPassCI.dependencyCount = m_Desc.DependencyCount;
     RenderPassCI.pDependencies   = vkDependencies.data();
 
+    const void** NextCI = &RenderPassCI.pNext;
+
+    // Enable multiview. Render pass 2 defines view masks in the subpass descriptions,
+    // the original render pass uses VkRenderPassMultiviewCreateInfo.
+    VkRenderPassMultiviewCreateInfo MultiviewCI{};
+    if (MultiviewEnabled)
+    {
+        SetCorrelatedViewMask(RenderPassCI, &vkCorrelationMask);
+        if (RPVersion == 1)
+        {
+            MultiviewCI.sType                = VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO;
+            MultiviewCI.pNext                = nullptr;
+            MultiviewCI.subpassCount         = m_Desc.SubpassCount;
+            MultiviewCI.pViewMasks           = vkViewMasks.data();
+            MultiviewCI.dependencyCount      = 0; // View offsets are zero
+            MultiviewCI.pViewOffsets         = nullptr;
+            MultiviewCI.correlationMaskCount = 1;
+            MultiviewCI.pCorrelationMasks    = &vkCorrelationMask;
+
+            *NextCI = &MultiviewCI;
+            NextCI  = &MultiviewCI.pNext;
+        }
+    }
+
     // Enable fragment density map
     VkRenderPassFragmentDensityMapCreateInfoEXT FragDensityMapCI{};
     if (FragDensityMapEnabled && pMainSRA != nullptr)
     {
-        RenderPassCI.pNext     = &FragDensityMapCI;
+        *NextCI                = &FragDensityMapCI;
+        NextCI                 = &FragDensityMapCI.pNext;
         FragDensityMapCI.sType = VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT;
         FragDensityMapCI.pNext = nullptr;
 
@@ -41,16 +41,20 @@
 namespace Diligent
 {
 
-size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes)
+size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes, const Uint32* SetBufferCounts)
 {
     Uint32 TotalResources = 0;
+    Uint32 TotalBuffers   = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
+    {
         TotalResources += SetSizes[t];
-    size_t MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource);
+        TotalBuffers += SetBufferCounts[t];
+    }
+    size_t MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource) + TotalBuffers * sizeof(BufferInfo);
     return MemorySize;
 }
 
-void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes)
+void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes, const Uint32* SetBufferCounts)
 {
     VERIFY(!m_pMemory, "Memory has already been allocated");
 
@@ -59,7 +63,7 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
     //  m_pMemory
     //  |
     //  V
-    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  ||
+    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  |  Buff[0]  | ... |  Buff[k-1]  |    ....     ||
     //
     //
     //  Ns = m_NumSets
@@ -67,17 +71,21 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
     m_NumSets = static_cast<Uint16>(NumSets);
     VERIFY(m_NumSets == NumSets, "NumSets (", NumSets, ") exceed maximum representable value");
 
-    m_TotalResources = 0;
+    m_TotalResources    = 0;
+    Uint32 TotalBuffers = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
     {
         VERIFY_EXPR(SetSizes[t] > 0);
+        VERIFY_EXPR(SetBufferCounts[t] <= SetSizes[t]);
         m_TotalResources += SetSizes[t];
+        TotalBuffers += SetBufferCounts[t];
     }
 
-    const size_t MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource);
-    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes));
+    const size_t MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource) + TotalBuffers * sizeof(BufferInfo);
+    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes, SetBufferCounts));
 #ifdef DILIGENT_DEBUG
     m_DbgInitializedResources.resize(m_NumSets);
+    m_DbgSetBufferCounts.assign(SetBufferCounts, SetBufferCounts + m_NumSets);
 #endif
     if (MemorySize > 0)
     {
@@ -86,17 +94,21 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
             STDDeleter<void, IMemoryAllocator>(MemAllocator) //
         };
 
-        DescriptorSet* pSets       = reinterpret_cast<DescriptorSet*>(m_pMemory.get());
-        Resource*      pCurrResPtr = reinterpret_cast<Resource*>(pSets + m_NumSets);
+        DescriptorSet* pSets        = reinterpret_cast<DescriptorSet*>(m_pMemory.get());
+        Resource*      pCurrResPtr  = reinterpret_cast<Resource*>(pSets + m_NumSets);
+        BufferInfo*    pCurrBuffPtr = reinterpret_cast<BufferInfo*>(pCurrResPtr + m_TotalResources);
         for (Uint32 t = 0; t < NumSets; ++t)
         {
-            new (&GetDescriptorSet(t)) DescriptorSet{SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr};
+            new (&GetDescriptorSet(t)) DescriptorSet{SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr, SetBufferCounts[t] > 0 ? pCurrBuffPtr : nullptr};
             pCurrResPtr += SetSizes[t];
+            for (Uint32 b = 0; b < SetBufferCounts[t]; ++b)
+                new (pCurrBuffPtr++) BufferInfo{};
 #ifdef DILIGENT_DEBUG
             m_DbgInitializedResources[t].resize(SetSizes[t]);
 #endif
         }
-        VERIFY_EXPR((char*)pCurrResPtr == (char*)m_pMemory.get() + MemorySize);
+        VERIFY_EXPR((char*)pCurrResPtr == (char*)m_pMemory.get() + NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource));
+        VERIFY_EXPR((char*)pCurrBuffPtr == (char*)m_pMemory.get() + MemorySize);
     }
 }
 
@@ -105,7 +117,11 @@ void ShaderResourceCacheVk::InitializeResources(Uint32 Set, Uint32 Offset, Uint3
     DescriptorSet& DescrSet = GetDescriptorSet(Set);
     for (Uint32 res = 0; res < ArraySize; ++res)
     {
-        new (&DescrSet.GetResource(Offset + res)) Resource{Type, HasImmutableSampler};
+        // Buffer infos are assigned in the order in which resources are initialized
+        const Uint32 BufferIndex = IsBufferDescriptor(Type) ? DescrSet.m_NumBuffers++ : Resource::InvalidBufferIndex;
+        VERIFY(BufferIndex == Resource::InvalidBufferIndex || BufferIndex < m_DbgSetBufferCounts[Set],
+               "Not enough buffer infos have been allocated for descriptor set ", Set, ". This is a bug.");
+        new (&DescrSet.GetResource(Offset + res)) Resource{Type, HasImmutableSampler, BufferIndex};
 #ifdef DILIGENT_DEBUG
         m_DbgInitializedResources[Set][size_t{Offset} + res] = true;
 #endif
@@ -119,7 +135,7 @@ inline bool IsDynamicDescriptorType(DescriptorType DescrType)
             DescrType == DescriptorType::StorageBufferDynamic_ReadOnly);
 }
 
-static bool IsDynamicBuffer(const ShaderResourceCacheVk::Resource& Res)
+static bool IsDynamicBuffer(const ShaderResourceCacheVk::DescriptorSet& DescrSet, const ShaderResourceCacheVk::Resource& Res)
 {
     if (!Res.pObject)
         return false;
@@ -140,7 +156,6 @@ static bool IsDynamicBuffer(const ShaderResourceCacheVk::Resource& Res)
             break;
 
         default:
-            VERIFY_EXPR(Res.BufferRangeSize == 0);
             // Do nothing
             break;
     }
@@ -151,10 +166,11 @@ static bool IsDynamicBuffer(const ShaderResourceCacheVk::Resource& Res)
     const BufferDesc& BuffDesc = pBuffer->GetDesc();
 
     bool IsDynamic = (BuffDesc.Usage == USAGE_DYNAMIC);
-    if (!IsDynamic)
+    if (!IsDynamic && IsDynamicDescriptorType(Res.Type))
     {
         // Buffers that are not bound as a whole to a dynamic descriptor are also counted as dynamic
-        IsDynamic = (IsDynamicDescriptorType(Res.Type) && Res.BufferRangeSize != 0 && Res.BufferRangeSize < BuffDesc.Size);
+        const Uint32 RangeSize = DescrSet.GetBufferInfo(Res).RangeSize;
+        IsDynamic              = (RangeSize != 0 && RangeSize < BuffDesc.Size);
     }
 
     DEV_CHECK_ERR(!IsDynamic || IsDynamicDescriptorType(Res.Type),
@@ -172,16 +188,25 @@ void ShaderResourceCacheVk::DbgVerifyResourceInitialization() const
         for (bool ResInitialized : SetFlags)
             VERIFY(ResInitialized, "Not all resources in the cache have been initialized. This is a bug.");
     }
+    for (Uint32 t = 0; t < m_NumSets; ++t)
+    {
+        VERIFY(GetDescriptorSet(t).m_NumBuffers == m_DbgSetBufferCounts[t],
+               "The number of buffers in descriptor set ", t, " (", GetDescriptorSet(t).m_NumBuffers,
+               ") does not match the number of allocated buffer infos (", m_DbgSetBufferCounts[t], "). This is a bug.");
+    }
 }
 
 void ShaderResourceCacheVk::DbgVerifyDynamicBuffersCounter() const
 {
-    const Resource* pResources        = GetFirstResourcePtr();
-    Uint32          NumDynamicBuffers = 0;
-    for (Uint32 res = 0; res < m_TotalResources; ++res)
+    Uint32 NumDynamicBuffers = 0;
+    for (Uint32 t = 0; t < m_NumSets; ++t)
     {
-        if (IsDynamicBuffer(pResources[res]))
-            ++NumDynamicBuffers;
+        const DescriptorSet& DescrSet = GetDescriptorSet(t);
+        for (Uint32 res = 0; res < DescrSet.GetSize(); ++res)
+        {
+            if (IsDynamicBuffer(DescrSet, DescrSet.GetResource(res)))
+                ++NumDynamicBuffers;
+        }
     }
     VERIFY(NumDynamicBuffers == m_NumDynamicBuffers, "The number of dynamic buffers (", m_NumDynamicBuffers, ") does not match the actual number (", NumDynamicBuffers, ")");
 }
@@ -199,7 +224,7 @@ ShaderResourceCacheVk::~ShaderResourceCacheVk()
     }
 }
 
-void ShaderResourceCacheVk::Resource::SetUniformBuffer(RefCntAutoPtr<IDeviceObject>&& _pBuffer, Uint64 _BaseOffset, Uint64 _RangeSize)
+void ShaderResourceCacheVk::Resource::SetUniformBuffer(RefCntAutoPtr<IDeviceObject>&& _pBuffer, Uint64 _BaseOffset, Uint64 _RangeSize, BufferInfo& BuffInfo)
 {
     VERIFY_EXPR(Type == DescriptorType::UniformBuffer ||
                 Type == DescriptorType::UniformBufferDynamic);
@@ -220,16 +245,17 @@ void ShaderResourceCacheVk::Resource::SetUniformBuffer(RefCntAutoPtr<IDeviceObje
 #endif
 
     VERIFY(_BaseOffset + _RangeSize <= (pBuffVk != nullptr ? pBuffVk->GetDesc().Size : 0), "Specified range is out of buffer bounds");
-    BufferBaseOffset = _BaseOffset;
-    BufferRangeSize  = _RangeSize;
-    if (BufferRangeSize == 0)
-        BufferRangeSize = pBuffVk != nullptr ? (pBuffVk->GetDesc().Size - BufferBaseOffset) : 0;
+    if (_RangeSize == 0)
+        _RangeSize = pBuffVk != nullptr ? (pBuffVk->GetDesc().Size - _BaseOffset) : 0;
+
+    BuffInfo.BaseOffset = _BaseOffset;
+    BuffInfo.RangeSize  = StaticCast<Uint32>(_RangeSize);
 
     // Reset dynamic offset
-    BufferDynamicOffset = 0;
+    BuffInfo.DynamicOffset = 0;
 }
 
-void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObject>&& _pBufferView)
+void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObject>&& _pBufferView, BufferInfo& BuffInfo)
 {
     VERIFY_EXPR(Type == DescriptorType::StorageBuffer ||
                 Type == DescriptorType::StorageBufferDynamic ||
@@ -238,9 +264,7 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
 
     pObject = std::move(_pBufferView);
 
-    BufferDynamicOffset = 0; // It is essential to reset dynamic offset
-    BufferBaseOffset    = 0;
-    BufferRangeSize     = 0;
+    BuffInfo = {}; // It is essential to reset dynamic offset
 
     if (!pObject)
         return;
@@ -248,8 +272,8 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
     const BufferViewVkImpl* pBuffViewVk = pObject.ConstPtr<BufferViewVkImpl>();
     const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
 
-    BufferBaseOffset = ViewDesc.ByteOffset;
-    BufferRangeSize  = ViewDesc.ByteWidth;
+    BuffInfo.BaseOffset = ViewDesc.ByteOffset;
+    BuffInfo.RangeSize  = StaticCast<Uint32>(ViewDesc.ByteWidth);
 
 #ifdef DILIGENT_DEBUG
     {
@@ -258,7 +282,7 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
         VERIFY(Type == DescriptorType::StorageBufferDynamic || Type == DescriptorType::StorageBufferDynamic_ReadOnly || BuffDesc.Usage != USAGE_DYNAMIC,
                "Dynamic buffer must be used with StorageBufferDynamic or StorageBufferDynamic_ReadOnly descriptor");
 
-        VERIFY(BufferBaseOffset + BufferRangeSize <= BuffDesc.Size,
+        VERIFY(BuffInfo.BaseOffset + BuffInfo.RangeSize <= BuffDesc.Size,
                "Specified view range is out of buffer bounds");
 
         // VK_DESCRIPTOR_TYPE_STORAGE_BUFFER or VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC descriptor type
@@ -297,7 +321,7 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     DescriptorSet& DescrSet = GetDescriptorSet(DescrSetIndex);
     Resource&      DstRes   = DescrSet.GetResource(CacheOffset);
 
-    if (IsDynamicBuffer(DstRes))
+    if (IsDynamicBuffer(DescrSet, DstRes))
     {
         VERIFY(m_NumDynamicBuffers > 0, "Dynamic buffers counter must be greater than zero when there is at least one dynamic buffer bound in the resource cache");
         --m_NumDynamicBuffers;
@@ -308,14 +332,14 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     {
         case DescriptorType::UniformBuffer:
         case DescriptorType::UniformBufferDynamic:
-            DstRes.SetUniformBuffer(std::move(SrcRes.pObject), SrcRes.BufferBaseOffset, SrcRes.BufferRangeSize);
+            DstRes.SetUniformBuffer(std::move(SrcRes.pObject), SrcRes.BufferBaseOffset, SrcRes.BufferRangeSize, DescrSet.GetBufferInfo(DstRes));
             break;
 
         case DescriptorType::StorageBuffer:
         case DescriptorType::StorageBuffer_ReadOnly:
         case DescriptorType::StorageBufferDynamic:
         case DescriptorType::StorageBufferDynamic_ReadOnly:
-            DstRes.SetStorageBuffer(std::move(SrcRes.pObject));
+            DstRes.SetStorageBuffer(std::move(SrcRes.pObject), DescrSet.GetBufferInfo(DstRes));
             break;
 
         default:
@@ -323,7 +347,7 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
             DstRes.pObject = std::move(SrcRes.pObject);
     }
 
-    if (IsDynamicBuffer(DstRes))
+    if (IsDynamicBuffer(DescrSet, DstRes))
     {
         ++m_NumDynamicBuffers;
     }
@@ -380,7 +404,7 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
 
             case DescriptorType::UniformBuffer:
             case DescriptorType::UniformBufferDynamic:
-                vkDescrBufferInfo         = DstRes.GetUniformBufferDescriptorWriteInfo();
+                vkDescrBufferInfo         = DstRes.GetUniformBufferDescriptorWriteInfo(DescrSet.GetBufferInfo(DstRes));
                 WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
                 break;
 
@@ -388,7 +412,7 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
             case DescriptorType::StorageBuffer_ReadOnly:
             case DescriptorType::StorageBufferDynamic:
             case DescriptorType::StorageBufferDynamic_ReadOnly:
-                vkDescrBufferInfo         = DstRes.GetStorageBufferDescriptorWriteInfo();
+                vkDescrBufferInfo         = DstRes.GetStorageBufferDescriptorWriteInfo(DescrSet.GetBufferInfo(DstRes));
                 WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
                 break;
 
@@ -411,6 +435,7 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     }
 
     UpdateRevision();
+    m_StateTransitionsRequired = true;
 
     return DstRes;
 }
@@ -427,10 +452,11 @@ void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
     const BufferVkImpl* pBufferVk = DstRes.Type == DescriptorType::UniformBufferDynamic ?
         DstRes.pObject.ConstPtr<BufferVkImpl>() :
         DstRes.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
-    DEV_CHECK_ERR(DstRes.BufferBaseOffset + DstRes.BufferRangeSize + DynamicBufferOffset <= pBufferVk->GetDesc().Size,
+    BufferInfo& BuffInfo = DescrSet.GetBufferInfo(DstRes);
+    DEV_CHECK_ERR(BuffInfo.BaseOffset + BuffInfo.RangeSize + DynamicBufferOffset <= pBufferVk->GetDesc().Size,
                   "Specified offset is out of buffer bounds");
 
-    DstRes.BufferDynamicOffset = DynamicBufferOffset;
+    BuffInfo.DynamicOffset = DynamicBufferOffset;
 }
 
 
@@ -554,7 +580,7 @@ inline void TransitionTextureView(DeviceContextVkImpl* pCtxVkImpl,
         return;
 
     TextureVkImpl* pTextureVk = pTextureViewVk->GetTexture<TextureVkImpl>();
-    if (!pTextureVk->IsInKnownState())
+    if (!pTextureVk->IsInKnownState() || pTextureVk->IsInConstantState())
         return;
 
     // The image subresources for a storage image must be in the VK_IMAGE_LAYOUT_GENERAL layout in
@@ -651,7 +677,11 @@ inline void TransitionAccelStruct(DeviceContextVkImpl* pCtxVkImpl,
 template <bool VerifyOnly>
 void ShaderResourceCacheVk::TransitionResources(DeviceContextVkImpl* pCtxVkImpl)
 {
-    Resource* pResources = GetFirstResourcePtr();
+    if (!m_StateTransitionsRequired)
+        return;
+
+    bool      StateTransitionsRequired = false;
+    Resource* pResources               = GetFirstResourcePtr();
     for (Uint32 res = 0; res < m_TotalResources; ++res)
     {
         Resource& Res = pResources[res];
@@ -662,6 +692,7 @@ void ShaderResourceCacheVk::TransitionResources(DeviceContextVkImpl* pCtxVkImpl)
             case DescriptorType::UniformBuffer:
             case DescriptorType::UniformBufferDynamic:
                 TransitionUniformBuffer<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<BufferVkImpl>(), Res.Type);
+                StateTransitionsRequired = StateTransitionsRequired || !Res.IsNull();
                 break;
 
             case DescriptorType::StorageBuffer:
@@ -672,13 +703,18 @@ void ShaderResourceCacheVk::TransitionResources(DeviceContextVkImpl* pCtxVkImpl)
             case DescriptorType::StorageTexelBuffer:
             case DescriptorType::StorageTexelBuffer_ReadOnly:
                 TransitionBufferView<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<BufferViewVkImpl>(), Res.Type);
+                StateTransitionsRequired = StateTransitionsRequired || !Res.IsNull();
                 break;
 
             case DescriptorType::CombinedImageSampler:
             case DescriptorType::SeparateImage:
             case DescriptorType::StorageImage:
-                TransitionTextureView<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<TextureViewVkImpl>(), Res.Type);
+            {
+                TextureViewVkImpl* pTexViewVk = Res.pObject.RawPtr<TextureViewVkImpl>();
+                TransitionTextureView<VerifyOnly>(pCtxVkImpl, pTexViewVk, Res.Type);
+                StateTransitionsRequired = StateTransitionsRequired || (pTexViewVk != nullptr && !pTexViewVk->GetTexture<TextureVkImpl>()->IsInConstantState());
                 break;
+            }
 
             case DescriptorType::Sampler:
                 // Nothing to do with samplers
@@ -693,18 +729,22 @@ void ShaderResourceCacheVk::TransitionResources(DeviceContextVkImpl* pCtxVkImpl)
 
             case DescriptorType::AccelerationStructure:
                 TransitionAccelStruct<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<TopLevelASVkImpl>(), Res.Type);
+                StateTransitionsRequired = StateTransitionsRequired || !Res.IsNull();
                 break;
 
             default: UNEXPECTED("Unexpected resource type");
         }
     }
+
+    // Skip the loop until a new resource is bound
+    m_StateTransitionsRequired = StateTransitionsRequired;
 }
 
 template void ShaderResourceCacheVk::TransitionResources<false>(DeviceContextVkImpl* pCtxVkImpl);
 template void ShaderResourceCacheVk::TransitionResources<true>(DeviceContextVkImpl* pCtxVkImpl);
 
 
-VkDescriptorBufferInfo ShaderResourceCacheVk::Resource::GetUniformBufferDescriptorWriteInfo() const
+VkDescriptorBufferInfo ShaderResourceCacheVk::Resource::GetUniformBufferDescriptorWriteInfo(const BufferInfo& BuffInfo) const
 {
     VERIFY((Type == DescriptorType::UniformBuffer ||
             Type == DescriptorType::UniformBufferDynamic),
@@ -721,13 +761,13 @@ VkDescriptorBufferInfo ShaderResourceCacheVk::Resource::GetUniformBufferDescript
     DescrBuffInfo.buffer = pBuffVk->GetVkBuffer();
     // If descriptorType is VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER or VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, the offset member
     // of each element of pBufferInfo must be a multiple of VkPhysicalDeviceLimits::minUniformBufferOffsetAlignment (13.2.4)
-    VERIFY_EXPR(BufferBaseOffset + BufferRangeSize <= pBuffVk->GetDesc().Size);
-    DescrBuffInfo.offset = BufferBaseOffset;
-    DescrBuffInfo.range  = BufferRangeSize;
+    VERIFY_EXPR(BuffInfo.BaseOffset + BuffInfo.RangeSize <= pBuffVk->GetDesc().Size);
+    DescrBuffInfo.offset = BuffInfo.BaseOffset;
+    DescrBuffInfo.range  = BuffInfo.RangeSize;
     return DescrBuffInfo;
 }
 
-VkDescriptorBufferInfo ShaderResourceCacheVk::Resource::GetStorageBufferDescriptorWriteInfo() const
+VkDescriptorBufferInfo ShaderResourceCacheVk::Resource::GetStorageBufferDescriptorWriteInfo(const BufferInfo& BuffInfo) const
 {
     VERIFY((Type == DescriptorType::StorageBuffer ||
             Type == DescriptorType::StorageBufferDynamic ||
@@ -745,8 +785,8 @@ VkDescriptorBufferInfo ShaderResourceCacheVk::Resource::GetStorageBufferDescript
     DescrBuffInfo.buffer = pBuffVk->GetVkBuffer();
     // If descriptorType is VK_DESCRIPTOR_TYPE_STORAGE_BUFFER or VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, the offset member
     // of each element of pBufferInfo must be a multiple of VkPhysicalDeviceLimits::minStorageBufferOffsetAlignment (13.2.4)
-    DescrBuffInfo.offset = BufferBaseOffset;
-    DescrBuffInfo.range  = BufferRangeSize;
+    DescrBuffInfo.offset = BuffInfo.BaseOffset;
+    DescrBuffInfo.range  = BuffInfo.RangeSize;
     return DescrBuffInfo;
 }
 
@@ -907,7 +947,7 @@ Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContextVkImpl*   pCt
                 // The effective offset used for dynamic uniform and storage buffer bindings is the sum of the relative
                 // offset taken from pDynamicOffsets, and the base address of the buffer plus base offset in the descriptor set.
                 // The range of the dynamic uniform and storage buffer bindings is the buffer range as specified in the descriptor set.
-                Offsets[OffsetInd++] = StaticCast<Uint32>(Res.BufferDynamicOffset + Offset);
+                Offsets[OffsetInd++] = StaticCast<Uint32>(DescrSet.GetBufferInfo(Res).DynamicOffset + Offset);
                 ++res;
             }
             else
@@ -929,7 +969,7 @@ Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContextVkImpl*   pCt
                 // The effective offset used for dynamic uniform and storage buffer bindings is the sum of the relative
                 // offset taken from pDynamicOffsets, and the base address of the buffer plus base offset in the descriptor set.
                 // The range of the dynamic uniform and storage buffer bindings is the buffer range as specified in the descriptor set.
-                Offsets[OffsetInd++] = StaticCast<Uint32>(Res.BufferDynamicOffset + Offset);
+                Offsets[OffsetInd++] = StaticCast<Uint32>(DescrSet.GetBufferInfo(Res).DynamicOffset + Offset);
                 ++res;
             }
             else
@@ -950,4 +990,213 @@ Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContextVkImpl*   pCt
     return OffsetInd - StartInd;
 }
 
+bool ShaderResourceCacheVk::WriteDescriptorUpdateData(Uint32 DescrSetIndex, DescriptorUpdateInfo* pData) const
+{
+    const DescriptorSet& DescrSet = GetDescriptorSet(DescrSetIndex);
+    for (Uint32 res = 0; res < DescrSet.GetSize(); ++res)
+    {
+        const Resource&       Res        = DescrSet.GetResource(res);
+        DescriptorUpdateInfo& UpdateInfo = pData[res];
+
+        if (Res.Type == DescriptorType::Sampler && Res.HasImmutableSampler)
+            continue; // Immutable samplers are not written to the set
+
+        // Template entries cover entire arrays, and null descriptors are not allowed
+        if (!Res)
+            return false;
+
+        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+        switch (Res.Type)
+        {
+            case DescriptorType::UniformBuffer:
+            case DescriptorType::UniformBufferDynamic:
+                UpdateInfo.BufferInfo = Res.GetUniformBufferDescriptorWriteInfo(DescrSet.GetBufferInfo(Res));
+                break;
+
+            case DescriptorType::StorageBuffer:
+            case DescriptorType::StorageBufferDynamic:
+            case DescriptorType::StorageBuffer_ReadOnly:
+            case DescriptorType::StorageBufferDynamic_ReadOnly:
+                UpdateInfo.BufferInfo = Res.GetStorageBufferDescriptorWriteInfo(DescrSet.GetBufferInfo(Res));
+                break;
+
+            case DescriptorType::UniformTexelBuffer:
+            case DescriptorType::StorageTexelBuffer:
+            case DescriptorType::StorageTexelBuffer_ReadOnly:
+                UpdateInfo.BufferView = Res.GetBufferViewWriteInfo();
+                break;
+
+            case DescriptorType::CombinedImageSampler:
+            case DescriptorType::SeparateImage:
+            case DescriptorType::StorageImage:
+                UpdateInfo.ImageInfo = Res.GetImageDescriptorWriteInfo();
+                break;
+
+            case DescriptorType::InputAttachment:
+            case DescriptorType::InputAttachment_General:
+                UpdateInfo.ImageInfo = Res.GetInputAttachmentDescriptorWriteInfo();
+                break;
+
+            case DescriptorType::Sampler:
+                UpdateInfo.ImageInfo = Res.GetSamplerDescriptorWriteInfo();
+                break;
+
+            case DescriptorType::AccelerationStructure:
+                UpdateInfo.AccelStruct = *Res.GetAccelerationStructureWriteInfo().pAccelerationStructures;
+                break;
+
+            default:
+                UNEXPECTED("Unexpected resource type");
+        }
+    }
+
+    return true;
+}
+
+
+// Returns the device address of the buffer data. Dynamic buffers without a backing buffer
+// are suballocated from the dynamic heap, so their address depends on the context.
+static VkDeviceAddress GetBufferDataAddress(const BufferVkImpl* pBuffVk, DeviceContextVkImpl* pCtx)
+{
+    const VulkanDynamicMemoryManager& DynamicMemMgr = pBuffVk->GetDevice()->GetDynamicMemoryManager();
+    if (pBuffVk->GetVkBuffer() == DynamicMemMgr.GetVkBuffer())
+    {
+        // Do not verify dynamic allocation here as there may be some buffers that are not used by the PSO.
+        // The allocations of the buffers that are actually used will be verified by
+        // PipelineResourceSignatureVkImpl::DvpValidateCommittedResource().
+        return DynamicMemMgr.GetVkDeviceAddress() + pCtx->GetDynamicBufferOffset(pBuffVk, /*VerifyAllocation = */ false);
+    }
+    else
+    {
+        return pBuffVk->GetVkDeviceAddress();
+    }
+}
+
+void ShaderResourceCacheVk::WriteDescriptorBufferData(Uint32                                               DescrSetIndex,
+                                                      const DescriptorBufferSetLayout&                     Layout,
+                                                      const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props,
+                                                      const VulkanUtilities::LogicalDevice&                LogicalDevice,
+                                                      DeviceContextVkImpl*                                 pCtx,
+                                                      Uint8*                                               pData) const
+{
+    const DescriptorSet& DescrSet = GetDescriptorSet(DescrSetIndex);
+    const Uint32         SetSize  = DescrSet.GetSize();
+    VERIFY_EXPR(Layout.DescriptorOffsets.size() == SetSize && Layout.ImmutableSamplers.size() == SetSize);
+    VERIFY_EXPR(Layout.InitData.size() == Layout.DataSize);
+
+    // Immutable sampler descriptors are written once when the signature is created
+    memcpy(pData, Layout.InitData.data(), Layout.DataSize);
+
+    for (Uint32 res = 0; res < SetSize; ++res)
+    {
+        const Resource& Res = DescrSet.GetResource(res);
+        if (!Res)
+            continue;
+
+        VkDescriptorGetInfoEXT DescrInfo{};
+        DescrInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        DescrInfo.type  = DescriptorTypeToVkDescriptorBufferType(Res.Type);
+
+        // Do not zero-initialize!
+        union
+        {
+            VkDescriptorImageInfo      vkImageInfo;
+            VkDescriptorAddressInfoEXT vkAddressInfo;
+            VkSampler                  vkSampler;
+        };
+
+        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+        switch (Res.Type)
+        {
+            case DescriptorType::Sampler:
+                if (Res.HasImmutableSampler)
+                    continue; // Immutable sampler descriptors are in the initial data
+
+                vkSampler               = Res.GetSamplerDescriptorWriteInfo().sampler;
+                DescrInfo.data.pSampler = &vkSampler;
+                break;
+
+            case DescriptorType::CombinedImageSampler:
+                vkImageInfo = Res.GetImageDescriptorWriteInfo();
+                if (Res.HasImmutableSampler)
+                    vkImageInfo.sampler = Layout.ImmutableSamplers[res];
+                DescrInfo.data.pCombinedImageSampler = &vkImageInfo;
+                break;
+
+            case DescriptorType::SeparateImage:
+                vkImageInfo                  = Res.GetImageDescriptorWriteInfo();
+                DescrInfo.data.pSampledImage = &vkImageInfo;
+                break;
+
+            case DescriptorType::StorageImage:
+                vkImageInfo                  = Res.GetImageDescriptorWriteInfo();
+                DescrInfo.data.pStorageImage = &vkImageInfo;
+                break;
+
+            case DescriptorType::InputAttachment:
+            case DescriptorType::InputAttachment_General:
+                vkImageInfo                          = Res.GetInputAttachmentDescriptorWriteInfo();
+                DescrInfo.data.pInputAttachmentImage = &vkImageInfo;
+                break;
+
+            case DescriptorType::UniformTexelBuffer:
+            case DescriptorType::StorageTexelBuffer:
+            case DescriptorType::StorageTexelBuffer_ReadOnly:
+            {
+                const BufferViewVkImpl* pBuffViewVk = Res.pObject.ConstPtr<BufferViewVkImpl>();
+                const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
+
+                vkAddressInfo       = {};
+                vkAddressInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+                // Formatted buffers always have a backing buffer
+                vkAddressInfo.address = pBuffViewVk->GetBuffer<const BufferVkImpl>()->GetVkDeviceAddress() + ViewDesc.ByteOffset;
+                vkAddressInfo.range   = ViewDesc.ByteWidth;
+                vkAddressInfo.format  = TypeToVkFormat(ViewDesc.Format.ValueType, ViewDesc.Format.NumComponents, ViewDesc.Format.IsNormalized);
+                if (Res.Type == DescriptorType::UniformTexelBuffer)
+                    DescrInfo.data.pUniformTexelBuffer = &vkAddressInfo;
+                else
+                    DescrInfo.data.pStorageTexelBuffer = &vkAddressInfo;
+                break;
+            }
+
+            case DescriptorType::UniformBuffer:
+            case DescriptorType::UniformBufferDynamic:
+            case DescriptorType::StorageBuffer:
+            case DescriptorType::StorageBuffer_ReadOnly:
+            case DescriptorType::StorageBufferDynamic:
+            case DescriptorType::StorageBufferDynamic_ReadOnly:
+            {
+                const bool          IsUniform = Res.Type == DescriptorType::UniformBuffer || Res.Type == DescriptorType::UniformBufferDynamic;
+                const BufferVkImpl* pBuffVk   = IsUniform ?
+                    Res.pObject.ConstPtr<BufferVkImpl>() :
+                    Res.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+
+                const BufferInfo& BuffInfo = DescrSet.GetBufferInfo(Res);
+
+                vkAddressInfo       = {};
+                vkAddressInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+                // Dynamic offsets are not supported by descriptor buffers, so we apply the offset to the address.
+                vkAddressInfo.address = GetBufferDataAddress(pBuffVk, pCtx) + BuffInfo.BaseOffset + BuffInfo.DynamicOffset;
+                vkAddressInfo.range   = BuffInfo.RangeSize;
+                vkAddressInfo.format  = VK_FORMAT_UNDEFINED;
+                if (IsUniform)
+                    DescrInfo.data.pUniformBuffer = &vkAddressInfo;
+                else
+                    DescrInfo.data.pStorageBuffer = &vkAddressInfo;
+                break;
+            }
+
+            case DescriptorType::AccelerationStructure:
+                DescrInfo.data.accelerationStructure = Res.pObject.ConstPtr<TopLevelASVkImpl>()->GetVkDeviceAddress();
+                break;
+
+            default:
+                UNEXPECTED("Unexpected descriptor type");
+                continue;
+        }
+
+        LogicalDevice.GetDescriptor(DescrInfo, GetDescriptorBufferDescriptorSize(Props, DescrInfo.type), pData + Layout.DescriptorOffsets[res]);
+    }
+}
+
 } // namespace Diligent
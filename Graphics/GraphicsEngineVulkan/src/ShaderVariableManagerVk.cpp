@@ -297,7 +297,8 @@ BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl& Si
             if (m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC ||
                 m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE)
             {
-                VERIFY(vkDescrSet != VK_NULL_HANDLE, "Static and mutable variables must have a valid Vulkan descriptor set assigned");
+                VERIFY(vkDescrSet != VK_NULL_HANDLE || Signature.GetDevice()->UseDescriptorBuffers(),
+                       "Static and mutable variables must have a valid Vulkan descriptor set assigned");
             }
             else
             {
@@ -433,8 +434,9 @@ void BindResourceHelper::CacheUniformBuffer(const BindResourceInfo& BindInfo) co
     // We cannot use ClassPtrCast<> here as the resource can have wrong type
     RefCntAutoPtr<BufferVkImpl> pBufferVk{BindInfo.pObject, IID_BufferVk};
 #ifdef DILIGENT_DEVELOPMENT
+    const ShaderResourceCacheVk::BufferInfo& DstBuffInfo = m_CachedSet.GetBufferInfo(m_DstRes);
     VerifyConstantBufferBinding(m_ResDesc, BindInfo, pBufferVk.RawPtr(), m_DstRes.pObject.RawPtr(),
-                                m_DstRes.BufferBaseOffset, m_DstRes.BufferRangeSize, m_Signature.GetDesc().Name);
+                                DstBuffInfo.BaseOffset, DstBuffInfo.RangeSize, m_Signature.GetDesc().Name);
 #endif
 
     UpdateCachedResource(std::move(pBufferVk), BindInfo.Flags, BindInfo.BufferBaseOffset, BindInfo.BufferRangeSize);
@@ -641,10 +643,11 @@ void ShaderVariableManagerVk::SetBufferDynamicOffset(Uint32 ResIndex,
     const Uint32                     DstResCacheOffset = Attribs.CacheOffset(m_ResourceCache.GetContentType()) + ArrayIndex;
 #ifdef DILIGENT_DEVELOPMENT
     {
-        const PipelineResourceDesc&                 ResDesc = m_pSignature->GetResourceDesc(ResIndex);
-        const ShaderResourceCacheVk::DescriptorSet& Set     = const_cast<const ShaderResourceCacheVk&>(m_ResourceCache).GetDescriptorSet(Attribs.DescrSet);
-        const ShaderResourceCacheVk::Resource&      DstRes  = Set.GetResource(DstResCacheOffset);
-        VerifyDynamicBufferOffset<BufferVkImpl, BufferViewVkImpl>(ResDesc, DstRes.pObject, DstRes.BufferBaseOffset, DstRes.BufferRangeSize, BufferDynamicOffset);
+        const PipelineResourceDesc&                 ResDesc  = m_pSignature->GetResourceDesc(ResIndex);
+        const ShaderResourceCacheVk::DescriptorSet& Set      = const_cast<const ShaderResourceCacheVk&>(m_ResourceCache).GetDescriptorSet(Attribs.DescrSet);
+        const ShaderResourceCacheVk::Resource&      DstRes   = Set.GetResource(DstResCacheOffset);
+        const ShaderResourceCacheVk::BufferInfo&    BuffInfo = Set.GetBufferInfo(DstRes);
+        VerifyDynamicBufferOffset<BufferVkImpl, BufferViewVkImpl>(ResDesc, DstRes.pObject, BuffInfo.BaseOffset, BuffInfo.RangeSize, BufferDynamicOffset);
     }
 #endif
     m_ResourceCache.SetDynamicBufferOffset(Attribs.DescrSet, DstResCacheOffset, BufferDynamicOffset);
@@ -37,6 +37,7 @@
 #include "GLSLUtils.hpp"
 #include "DXCompiler.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "Trace.hpp"
 
 #if !DILIGENT_NO_GLSLANG
 #    include "GLSLangUtils.hpp"
@@ -164,6 +165,8 @@ std::vector<uint32_t> CompileShaderGLSLang(const ShaderCreateInfo&         Shade
 void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
                               const CreateInfo&       VkShaderCI)
 {
+    DILIGENT_TRACE_SCOPE("CompileShader");
+
     if (ShaderCI.Source != nullptr || (ShaderCI.FilePath != nullptr && ShaderCI.SourceLanguage != SHADER_SOURCE_LANGUAGE_BYTECODE))
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "'ByteCode' must be null when shader is created from source code or a file");
@@ -235,7 +238,7 @@ void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
     {
         if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
         {
-            IMemoryAllocator& Allocator = GetRawAllocator();
+            IMemoryAllocator& Allocator = GetRawAllocator(MEMORY_CATEGORY_SHADER_CACHE);
 
             std::unique_ptr<void, STDDeleterRawMem<void>> pRawMem{
                 ALLOCATE(Allocator, "Memory for SPIRVShaderResources", SPIRVShaderResources, 1),
@@ -47,6 +47,7 @@ SwapChainVkImpl::SwapChainVkImpl(IReferenceCounters*  pRefCounters,
     m_Window                     {Window},
     m_Instance             {pRenderDeviceVk->GetInstance()},
     m_DesiredBufferCount         {SCDesc.BufferCount},
+    m_MaxFrameLatency            {SCDesc.LatencyMode == SWAP_CHAIN_LATENCY_MODE_LOW ? 1 : SCDesc.BufferCount},
     m_pBackBufferRTV             (STD_ALLOCATOR_RAW_MEM(RefCntAutoPtr<ITextureView>, GetRawAllocator(), "Allocator for vector<RefCntAutoPtr<ITextureView>>")),
     m_SwapChainImagesInitialized (STD_ALLOCATOR_RAW_MEM(bool, GetRawAllocator(), "Allocator for vector<bool>"))
 // clang-format on
@@ -467,6 +468,10 @@ void SwapChainVkImpl::CreateVulkanSwapChain()
     err = vkCreateSwapchainKHR(vkDevice, &swapchain_ci, NULL, &m_VkSwapChain);
     CHECK_VK_ERROR_AND_THROW(err, "Failed to create Vulkan swapchain");
 
+    // Present ids are tracked per swap chain
+    m_FirstPresentId = 0;
+    m_LastPresentId  = 0;
+
     if (oldSwapchain != VK_NULL_HANDLE)
     {
         vkDestroySwapchainKHR(vkDevice, oldSwapchain, NULL);
@@ -600,10 +605,38 @@ void SwapChainVkImpl::InitBuffersAndViews()
 
 void SwapChainVkImpl::ThrottleFrameSubmission()
 {
-    if (m_FrameIndex > m_SwapChainDesc.BufferCount)
+    // The number of frames in flight must never exceed the number of buffers
+    // as the image acquired semaphores are reused.
+    const Uint32 MaxFramesInFlight = std::max(std::min(m_MaxFrameLatency, m_SwapChainDesc.BufferCount), 1u);
+    if (m_FrameIndex > MaxFramesInFlight)
+    {
+        m_FrameCompleteFence->Wait(m_FrameIndex - MaxFramesInFlight);
+    }
+}
+
+void SwapChainVkImpl::WaitForPresent(Uint64 PresentId)
+{
+    // In low-latency mode, wait until no more than MaxFrameLatency - 1 frames are queued,
+    // so that the application samples input for the next frame as late as possible.
+    const Uint32 MaxLatency = std::max(m_MaxFrameLatency, 1u);
+    if (PresentId < MaxLatency)
+        return;
+
+    const Uint64 WaitPresentId = PresentId - (MaxLatency - 1);
+    if (m_FirstPresentId != 0 && WaitPresentId >= m_FirstPresentId && WaitPresentId <= m_LastPresentId)
     {
-        m_FrameCompleteFence->Wait(m_FrameIndex - m_SwapChainDesc.BufferCount);
+        const VulkanUtilities::LogicalDevice& LogicalDevice = m_pRenderDevice.RawPtr<RenderDeviceVkImpl>()->GetLogicalDevice();
+
+        // Use a timeout as the presentation engine is not guaranteed to ever display the image
+        // (e.g. when the window is occluded).
+        constexpr uint64_t Timeout = 500'000'000; // 0.5 seconds
+        VkResult           err     = LogicalDevice.WaitForPresent(m_VkSwapChain, WaitPresentId, Timeout);
+        if (err == VK_SUCCESS || err == VK_TIMEOUT)
+            return;
+        // The swap chain may be out of date - fall back to waiting for the GPU.
     }
+
+    m_FrameCompleteFence->Wait(WaitPresentId);
 }
 
 VkResult SwapChainVkImpl::AcquireNextImage(DeviceContextVkImpl* pDeviceCtxVk)
@@ -688,9 +721,13 @@ void SwapChainVkImpl::Present(Uint32 SyncInterval)
         pImmediateCtxVk->AddSignalSemaphore(DrawCompleteSemaphore);
     }
 
+    // Frame index is also used as the present id (VK_KHR_present_id)
+    const Uint64 PresentId = m_FrameIndex;
     pImmediateCtxVk->EnqueueSignal(m_FrameCompleteFence, m_FrameIndex++);
     pImmediateCtxVk->Flush();
 
+    const bool UsePresentWait = pDeviceVk->GetLogicalDevice().GetEnabledExtFeatures().PresentWait.presentWait != VK_FALSE;
+
     if (!m_IsMinimized)
     {
         VkResult Result = VK_ERROR_OUT_OF_DATE_KHR;
@@ -708,6 +745,19 @@ void SwapChainVkImpl::Present(Uint32 SyncInterval)
             PresentInfo.pSwapchains     = &m_VkSwapChain;
             PresentInfo.pImageIndices   = &m_BackBufferIndex;
             PresentInfo.pResults        = &Result;
+
+            VkPresentIdKHR PresentIdInfo{};
+            if (UsePresentWait)
+            {
+                PresentIdInfo.sType          = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+                PresentIdInfo.swapchainCount = 1;
+                PresentIdInfo.pPresentIds    = &PresentId;
+                PresentInfo.pNext            = &PresentIdInfo;
+
+                if (m_FirstPresentId == 0)
+                    m_FirstPresentId = PresentId;
+                m_LastPresentId = PresentId;
+            }
             pDeviceVk->LockCmdQueueAndRun(
                 pImmediateCtxVk->GetCommandQueueId(),
                 [&PresentInfo](ICommandQueueVk* pCmdQueueVk) //
@@ -770,6 +820,18 @@ void SwapChainVkImpl::Present(Uint32 SyncInterval)
         // https://github.com/DiligentGraphics/DiligentSamples/issues/234
         ThrottleFrameSubmission();
     }
+
+    if (m_SwapChainDesc.LatencyMode == SWAP_CHAIN_LATENCY_MODE_LOW && !m_IsMinimized)
+    {
+        // Recreating the swap chain above resets the present ids, so waiting
+        // falls back to the frame complete fence in this case.
+        WaitForPresent(PresentId);
+    }
+}
+
+void SwapChainVkImpl::SetMaximumFrameLatency(Uint32 MaxLatency)
+{
+    m_MaxFrameLatency = MaxLatency;
 }
 
 void SwapChainVkImpl::ReleaseSwapChainResources(DeviceContextVkImpl* pImmediateCtxVk, bool DestroyVkSwapChain)
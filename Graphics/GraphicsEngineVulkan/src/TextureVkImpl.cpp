@@ -29,6 +29,7 @@
 #include "TextureVkImpl.hpp"
 #include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
+#include "DeviceMemoryVkImpl.hpp"
 #include "TextureViewVkImpl.hpp"
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
@@ -171,17 +172,18 @@ VkImageLayout VkImageLayoutFromUsage(VkImageUsageFlags Usage)
     return VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
 }
 
-bool CheckHostImageInitialization(const VulkanUtilities::LogicalDevice&  LogicalDevice,
-                                  const VulkanUtilities::PhysicalDevice& PhysicalDevice,
-                                  const VkImageCreateInfo&               ImageCI)
+bool CheckHostImageCopy(const VulkanUtilities::LogicalDevice&  LogicalDevice,
+                        const VulkanUtilities::PhysicalDevice& PhysicalDevice,
+                        const VkImageCreateInfo&               ImageCI,
+                        bool                                   GPUUploadMemoryEnabled)
 {
     if (!LogicalDevice.GetEnabledExtFeatures().HostImageCopy.hostImageCopy)
         return false;
 
-    if (!PhysicalDevice.IsUMA())
+    if (!PhysicalDevice.IsUMA() && !GPUUploadMemoryEnabled)
     {
         // On discrete GPUs, textures with VK_IMAGE_USAGE_HOST_TRANSFER_BIT usage are allocated in a host-visible
-        // device-local memory that is very scarce.
+        // device-local memory that is very scarce unless resizable BAR is enabled.
         return false;
     }
 
@@ -207,6 +209,36 @@ bool CheckHostImageInitialization(const VulkanUtilities::LogicalDevice&  Logical
     return true;
 }
 
+// Sets the host memory layout of the copy region. Returns false if the layout can't be expressed in texels.
+bool SetHostMemoryLayout(VkMemoryToImageCopyEXT&     vkCopyRegion,
+                         const TextureFormatAttribs& FmtAttribs,
+                         const TextureSubResData&    SubResData)
+{
+    const Uint32 PixelSize = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ?
+        Uint32{FmtAttribs.ComponentSize} :
+        Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+    if ((SubResData.Stride % PixelSize) != 0)
+        return false;
+
+    vkCopyRegion.memoryRowLength = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ?
+        static_cast<uint32_t>(SubResData.Stride * FmtAttribs.BlockWidth / FmtAttribs.ComponentSize) :
+        static_cast<uint32_t>(SubResData.Stride / PixelSize);
+
+    if (SubResData.DepthStride != 0)
+    {
+        if ((SubResData.DepthStride % SubResData.Stride) != 0)
+            return false;
+        vkCopyRegion.memoryImageHeight = static_cast<uint32_t>(SubResData.DepthStride * FmtAttribs.BlockHeight / SubResData.Stride);
+    }
+    else
+    {
+        // Tightly packed rows
+        vkCopyRegion.memoryImageHeight = 0;
+    }
+
+    return true;
+}
+
 } // namespace
 
 TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
@@ -244,10 +276,18 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
 
         VkImageCreateInfo ImageCI = TextureDescToVkImageCreateInfo(m_Desc, pRenderDeviceVk);
 
-        const bool InitContent           = pInitData != nullptr && pInitData->pSubResources != nullptr && pInitData->NumSubresources > 0;
-        const bool UseHostInitialization = InitContent && CheckHostImageInitialization(LogicalDevice, pRenderDeviceVk->GetPhysicalDevice(), ImageCI);
-        if (UseHostInitialization)
+        const bool InitContent = pInitData != nullptr && pInitData->pSubResources != nullptr && pInitData->NumSubresources > 0;
+        // Shader resources with default usage are typically streamed, and host copies let
+        // worker threads update them without staging memory (see UpdateSubresourceOnHost()).
+        const bool AllowHostUpdates = m_Desc.Usage == USAGE_DEFAULT && m_Desc.BindFlags == BIND_SHADER_RESOURCE && !IsMemoryless;
+        const bool UseHostImageCopy = (InitContent || AllowHostUpdates) &&
+            CheckHostImageCopy(LogicalDevice, pRenderDeviceVk->GetPhysicalDevice(), ImageCI, pRenderDeviceVk->GetFeatures().GPUUploadMemory == DEVICE_FEATURE_STATE_ENABLED);
+        const bool UseHostInitialization = InitContent && UseHostImageCopy;
+        if (UseHostImageCopy)
+        {
             ImageCI.usage |= VK_IMAGE_USAGE_HOST_TRANSFER_BIT;
+            m_HostCopyLayout = VkImageLayoutFromUsage(ImageCI.usage);
+        }
 
         const std::vector<uint32_t> QueueFamilyIndices = PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) > 1 ?
             GetDevice()->ConvertCmdQueueIdsToQueueFamilies(m_Desc.ImmediateContextMask) :
@@ -260,6 +300,17 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
             ImageCI.queueFamilyIndexCount = static_cast<uint32_t>(QueueFamilyIndices.size());
         }
 
+        const bool IsExportable = (m_Desc.MiscFlags & MISC_TEXTURE_FLAG_EXPORTABLE) != 0;
+
+        VkExternalMemoryImageCreateInfo ExternalMemoryCI{};
+        if (IsExportable)
+        {
+            ExternalMemoryCI.sType       = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
+            ExternalMemoryCI.pNext       = ImageCI.pNext;
+            ExternalMemoryCI.handleTypes = VulkanUtilities::ExternalMemoryHandleType;
+            ImageCI.pNext                = &ExternalMemoryCI;
+        }
+
         // initialLayout must be either VK_IMAGE_LAYOUT_UNDEFINED or VK_IMAGE_LAYOUT_PREINITIALIZED (11.4)
         // If it is VK_IMAGE_LAYOUT_PREINITIALIZED, then the image data can be preinitialized by the host
         // while using this layout, and the transition away from this layout will preserve that data.
@@ -279,19 +330,75 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
         {
             m_VulkanImage = LogicalDevice.CreateImage(ImageCI, m_Desc.Name);
 
-            VkMemoryRequirements MemReqs = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage);
+            bool                 UseDedicatedAllocation = false;
+            VkMemoryRequirements MemReqs                = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage, UseDedicatedAllocation);
 
-            const VkMemoryPropertyFlags ImageMemoryFlags = IsMemoryless ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+            const VulkanUtilities::PhysicalDevice& PhysicalDevice = pRenderDeviceVk->GetPhysicalDevice();
+
+            VkMemoryPropertyFlags ImageMemoryFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+            if (IsMemoryless)
+            {
+                if (PhysicalDevice.GetMemoryTypeIndex(MemReqs.memoryTypeBits, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex)
+                {
+                    ImageMemoryFlags = VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+                }
+                else
+                {
+                    LOG_WARNING_MESSAGE("Lazily allocated memory is not compatible with memoryless texture '", m_Desc.Name,
+                                        "'. The texture will use device-local memory.");
+                }
+            }
             VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
-            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
-            if (!m_MemoryAllocation)
-                LOG_ERROR_AND_THROW("Failed to allocate memory for texture '", m_Desc.Name, "'.");
 
-            VkDeviceSize AlignedOffset = AlignUp(m_MemoryAllocation.UnalignedOffset, MemReqs.alignment);
-            VERIFY_EXPR(m_MemoryAllocation.Size >= MemReqs.size + (AlignedOffset - m_MemoryAllocation.UnalignedOffset));
-            VkDeviceMemory Memory = m_MemoryAllocation.Page->GetVkMemory();
-            VkResult       err    = LogicalDevice.BindImageMemory(m_VulkanImage, Memory, AlignedOffset);
-            CHECK_VK_ERROR_AND_THROW(err, "Failed to bind image memory");
+            // Exported memory must not be shared with other resources, so exportable textures always use a dedicated allocation.
+            // Memoryless textures also always use a dedicated allocation: lazily allocated memory is only committed
+            // when the tile memory spills, and suballocating it from the memory manager pages would reserve
+            // a whole page in the lazily allocated heap for every transient attachment.
+            const uint32_t DedicatedMemoryTypeIndex = (UseDedicatedAllocation || IsExportable || IsMemoryless) ?
+                PhysicalDevice.GetMemoryTypeIndex(MemReqs.memoryTypeBits, ImageMemoryFlags) :
+                VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex;
+            if (IsExportable && DedicatedMemoryTypeIndex == VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex)
+                LOG_ERROR_AND_THROW("Failed to find suitable memory type for exportable texture '", m_Desc.Name, "'.");
+
+            if (DedicatedMemoryTypeIndex != VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex)
+            {
+                // The implementation prefers a dedicated allocation for this image, which is typically
+                // the case for large render targets and depth buffers (e.g. to enable compression).
+                VkMemoryDedicatedAllocateInfo DedicatedAllocInfo{};
+                DedicatedAllocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+                DedicatedAllocInfo.image = m_VulkanImage;
+
+                VkExportMemoryAllocateInfo ExportAllocInfo{};
+                if (IsExportable)
+                {
+                    ExportAllocInfo.sType       = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+                    ExportAllocInfo.handleTypes = VulkanUtilities::ExternalMemoryHandleType;
+                    DedicatedAllocInfo.pNext    = &ExportAllocInfo;
+                }
+
+                VkMemoryAllocateInfo MemAllocInfo{};
+                MemAllocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+                MemAllocInfo.pNext           = &DedicatedAllocInfo;
+                MemAllocInfo.allocationSize  = MemReqs.size;
+                MemAllocInfo.memoryTypeIndex = DedicatedMemoryTypeIndex;
+
+                m_DedicatedMemory = LogicalDevice.AllocateDeviceMemory(MemAllocInfo, m_Desc.Name);
+
+                VkResult err = LogicalDevice.BindImageMemory(m_VulkanImage, m_DedicatedMemory, 0);
+                CHECK_VK_ERROR_AND_THROW(err, "Failed to bind image memory");
+            }
+            else
+            {
+                m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+                if (!m_MemoryAllocation)
+                    LOG_ERROR_AND_THROW("Failed to allocate memory for texture '", m_Desc.Name, "'.");
+
+                VkDeviceSize AlignedOffset = AlignUp(m_MemoryAllocation.UnalignedOffset, MemReqs.alignment);
+                VERIFY_EXPR(m_MemoryAllocation.Size >= MemReqs.size + (AlignedOffset - m_MemoryAllocation.UnalignedOffset));
+                VkDeviceMemory Memory = m_MemoryAllocation.Page->GetVkMemory();
+                VkResult       err    = LogicalDevice.BindImageMemory(m_VulkanImage, Memory, AlignedOffset);
+                CHECK_VK_ERROR_AND_THROW(err, "Failed to bind image memory");
+            }
 
             if (InitContent)
             {
@@ -353,26 +460,12 @@ bool TextureVkImpl::InitializeContentOnHost(const TextureData&          InitData
             vkCopyInfo.pNext        = nullptr;
             vkCopyInfo.pHostPointer = SubResData.pData;
 
-            const Uint32 PixelSize = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ?
-                Uint32{FmtAttribs.ComponentSize} :
-                Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
-            if ((SubResData.Stride % PixelSize) != 0)
+            if (!SetHostMemoryLayout(vkCopyInfo, FmtAttribs, SubResData))
             {
-                LOG_DVP_WARNING_MESSAGE("Unable to initialize texture '", m_Desc.Name, "' on host: subresource ", subres, " has stride ", SubResData.Stride,
-                                        " that is not multiple of pixel size ", PixelSize, ". The content will be initialized on device.");
+                LOG_DVP_WARNING_MESSAGE("Unable to initialize texture '", m_Desc.Name, "' on host: stride (", SubResData.Stride, ") or depth stride (", SubResData.DepthStride,
+                                        ") of subresource ", subres, " is not a multiple of the pixel size or row stride. The content will be initialized on device.");
                 return false;
             }
-            vkCopyInfo.memoryRowLength = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ?
-                static_cast<uint32_t>(SubResData.Stride * FmtAttribs.BlockWidth / FmtAttribs.ComponentSize) :
-                static_cast<uint32_t>(SubResData.Stride / PixelSize);
-
-            if ((SubResData.DepthStride % SubResData.Stride) != 0)
-            {
-                LOG_DVP_WARNING_MESSAGE("Unable to initialize texture '", m_Desc.Name, "' on host: subresource ", subres, " has depth stride ", SubResData.DepthStride,
-                                        " that is not multiple of row stride ", SubResData.Stride, ". The content will be initialized on device.");
-                return false;
-            }
-            vkCopyInfo.memoryImageHeight = static_cast<uint32_t>(SubResData.DepthStride * FmtAttribs.BlockHeight / SubResData.Stride);
 
             vkCopyInfo.imageSubresource.aspectMask     = aspectMask;
             vkCopyInfo.imageSubresource.mipLevel       = mip;
@@ -428,10 +521,6 @@ void TextureVkImpl::InitializeContentOnDevice(const TextureData&          InitDa
     // Vulkan validation layers do not like uninitialized memory, so if no initial data
     // is provided, we will clear the memory
 
-    VulkanUtilities::CommandPoolWrapper CmdPool;
-    VulkanUtilities::CommandBuffer      CmdBuffer;
-    GetDevice()->AllocateTransientCmdPool(CmdQueueInd, CmdPool, CmdBuffer, "Transient command pool to copy staging data to a device buffer");
-
     VERIFY(FmtAttribs.ComponentType != COMPONENT_TYPE_DEPTH_STENCIL, "Initializing depth-stencil texture is currently not supported.");
     const VkImageAspectFlags aspectMask = ComponentTypeToVkAspectMask(FmtAttribs.ComponentType);
 
@@ -442,7 +531,7 @@ void TextureVkImpl::InitializeContentOnDevice(const TextureData&          InitDa
     SubresRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
     SubresRange.baseMipLevel   = 0;
     SubresRange.levelCount     = VK_REMAINING_MIP_LEVELS;
-    CmdBuffer.TransitionImageLayout(m_VulkanImage, ImageCI.initialLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, SubresRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    // The transition is recorded together with the copy command below
     SetState(RESOURCE_STATE_COPY_DEST);
     const VkImageLayout CurrentLayout = GetLayout();
     VERIFY_EXPR(CurrentLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
@@ -564,21 +653,20 @@ void TextureVkImpl::InitializeContentOnDevice(const TextureData&          InitDa
     VkResult err = LogicalDevice.BindBufferMemory(StagingBuffer, StagingBufferMemory, AlignedStagingMemOffset);
     CHECK_VK_ERROR_AND_THROW(err, "Failed to bind staging buffer memory");
 
-    CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-    // Copy commands MUST be recorded outside of a render pass instance. This is OK here
-    // as copy will be the only command in the cmd buffer
-    CmdBuffer.CopyBufferToImage(StagingBuffer, m_VulkanImage,
-                                CurrentLayout, // dstImageLayout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL or VK_IMAGE_LAYOUT_GENERAL
-                                static_cast<uint32_t>(Regions.size()), Regions.data());
-
-    GetDevice()->ExecuteAndDisposeTransientCmdBuff(CmdQueueInd, CmdBuffer.GetVkCmdBuffer(), std::move(CmdPool));
-
-    // After command buffer is submitted, safe-release resources. This strategy
-    // is little overconservative as the resources will be released after the first
-    // command buffer submitted through the immediate context will be completed
-    GetDevice()->SafeReleaseDeviceObject(std::move(StagingBuffer), Uint64{1} << Uint64{CmdQueueInd});
-    GetDevice()->SafeReleaseDeviceObject(std::move(StagingMemoryAllocation), Uint64{1} << Uint64{CmdQueueInd});
+    const VkBuffer vkStagingBuffer = StagingBuffer;
+
+    // The commands are recorded into the batch of initial data uploads that is submitted before
+    // the next command buffer, so creating many textures does not result in many submissions.
+    // The staging buffer and memory are released when the batch is complete.
+    GetDevice()->EnqueueInitialDataUpload(
+        CmdQueueInd, std::move(StagingBuffer), std::move(StagingMemoryAllocation),
+        [&](VulkanUtilities::CommandBuffer& CmdBuffer) {
+            CmdBuffer.TransitionImageLayout(m_VulkanImage, ImageCI.initialLayout, CurrentLayout, SubresRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+            CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+            CmdBuffer.CopyBufferToImage(vkStagingBuffer, m_VulkanImage,
+                                        CurrentLayout, // dstImageLayout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL or VK_IMAGE_LAYOUT_GENERAL
+                                        static_cast<uint32_t>(Regions.size()), Regions.data());
+        });
 }
 
 void TextureVkImpl::CreateStagingTexture(const TextureData* pInitData, const TextureFormatAttribs& FmtAttribs)
@@ -693,6 +781,70 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
         InitSparseProperties();
 }
 
+TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
+                             FixedBlockMemoryAllocator& TexViewObjAllocator,
+                             RenderDeviceVkImpl*        pRenderDeviceVk,
+                             const TextureDesc&         TexDesc,
+                             IDeviceMemory*             pMemory,
+                             Uint64                     MemoryOffset) :
+    TTextureBase{pRefCounters, TexViewObjAllocator, pRenderDeviceVk, TexDesc},
+    m_pPlacedMemory{pMemory}
+{
+    if (m_Desc.Usage != USAGE_DEFAULT)
+        LOG_ERROR_AND_THROW("Placed texture '", m_Desc.Name, "' must use USAGE_DEFAULT");
+
+    if ((m_Desc.MiscFlags & MISC_TEXTURE_FLAG_MEMORYLESS) != 0)
+        LOG_ERROR_AND_THROW("Placed texture '", m_Desc.Name, "' can't be memoryless");
+
+    RefCntAutoPtr<IDeviceMemoryVk> pMemoryVk{pMemory, IID_DeviceMemoryVk};
+    if (!pMemoryVk)
+        LOG_ERROR_AND_THROW("Placed texture '", m_Desc.Name, "' requires a valid Vulkan device memory object");
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = pRenderDeviceVk->GetLogicalDevice();
+
+    VkImageCreateInfo ImageCI = TextureDescToVkImageCreateInfo(m_Desc, pRenderDeviceVk);
+
+    const std::vector<uint32_t> QueueFamilyIndices = PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) > 1 ?
+        GetDevice()->ConvertCmdQueueIdsToQueueFamilies(m_Desc.ImmediateContextMask) :
+        std::vector<uint32_t>{};
+    if (QueueFamilyIndices.size() > 1)
+    {
+        ImageCI.sharingMode           = VK_SHARING_MODE_CONCURRENT;
+        ImageCI.pQueueFamilyIndices   = QueueFamilyIndices.data();
+        ImageCI.queueFamilyIndexCount = static_cast<uint32_t>(QueueFamilyIndices.size());
+    }
+    ImageCI.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    m_VulkanImage = LogicalDevice.CreateImage(ImageCI, m_Desc.Name);
+
+    const VkMemoryRequirements MemReqs = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage);
+    const DeviceMemoryRangeVk  Range   = pMemoryVk.ConstPtr<DeviceMemoryVkImpl>()->GetPlacedRange(MemoryOffset, MemReqs, MemReqs.alignment, m_Desc.Name);
+
+    VkResult err = LogicalDevice.BindImageMemory(m_VulkanImage, Range.Handle, Range.Offset);
+    CHECK_VK_ERROR_AND_THROW(err, "Failed to bind placed image memory");
+
+    // The contents of a placed texture are undefined until it is initialized
+    SetState(RESOURCE_STATE_UNDEFINED);
+}
+
+ResourceMemoryRequirements TextureVkImpl::GetPlacedMemoryRequirements(const TextureDesc& TexDesc, const RenderDeviceVkImpl* pDevice)
+{
+    TextureDesc Desc = TexDesc;
+    if (Desc.MipLevels == 0)
+    {
+        Desc.MipLevels = Desc.Is3D() ?
+            ComputeMipLevelsCount(Desc.Width, Desc.Height, Desc.Depth) :
+            ComputeMipLevelsCount(Desc.Width, Desc.Is1D() ? 1 : Desc.Height);
+    }
+
+    // Memory requirements can't be queried without creating an image unless VK_KHR_maintenance4 is available
+    const VulkanUtilities::LogicalDevice& LogicalDevice = pDevice->GetLogicalDevice();
+    const VulkanUtilities::ImageWrapper   vkImage       = LogicalDevice.CreateImage(TextureDescToVkImageCreateInfo(Desc, pDevice), "Temporary image to query memory requirements");
+    const VkMemoryRequirements            MemReqs       = LogicalDevice.GetImageMemoryRequirements(vkImage);
+
+    return {MemReqs.size, MemReqs.alignment};
+}
+
 void TextureVkImpl::CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView)
 {
     VERIFY(ppView != nullptr, "View pointer address is null");
@@ -734,6 +886,8 @@ TextureVkImpl::~TextureVkImpl()
     if (m_StagingBuffer)
         m_pDevice->SafeReleaseDeviceObject(std::move(m_StagingBuffer), m_Desc.ImmediateContextMask);
     m_pDevice->SafeReleaseDeviceObject(std::move(m_MemoryAllocation), m_Desc.ImmediateContextMask);
+    if (m_DedicatedMemory)
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_DedicatedMemory), m_Desc.ImmediateContextMask);
 }
 
 VulkanUtilities::ImageViewWrapper TextureVkImpl::CreateImageView(TextureViewDesc& ViewDesc)
@@ -934,6 +1088,77 @@ VulkanUtilities::ImageViewWrapper TextureVkImpl::CreateImageView(TextureViewDesc
     return LogicalDevice.CreateImageView(ImageViewCI, ViewName.c_str());
 }
 
+Bool TextureVkImpl::UpdateSubresourceOnHost(Uint32                   MipLevel,
+                                             Uint32                   Slice,
+                                             const Box&               DstBox,
+                                             const TextureSubResData& SubresData)
+{
+    if (m_HostCopyLayout == VK_IMAGE_LAYOUT_UNDEFINED)
+        return False;
+
+    ValidateUpdateTextureParams(m_Desc, MipLevel, Slice, DstBox, SubresData);
+    DEV_CHECK_ERR(SubresData.pSrcBuffer == nullptr, "Host copies can only be performed from CPU memory");
+
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(m_Desc.Format);
+
+    VkMemoryToImageCopyEXT vkCopyRegion{};
+    vkCopyRegion.sType        = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT;
+    vkCopyRegion.pHostPointer = SubresData.pData;
+    if (!SetHostMemoryLayout(vkCopyRegion, FmtAttribs, SubresData))
+        return False;
+
+    vkCopyRegion.imageSubresource.aspectMask     = ComponentTypeToVkAspectMask(FmtAttribs.ComponentType);
+    vkCopyRegion.imageSubresource.mipLevel       = MipLevel;
+    vkCopyRegion.imageSubresource.baseArrayLayer = Slice;
+    vkCopyRegion.imageSubresource.layerCount     = 1;
+
+    vkCopyRegion.imageOffset = {static_cast<int32_t>(DstBox.MinX), static_cast<int32_t>(DstBox.MinY), static_cast<int32_t>(DstBox.MinZ)};
+    vkCopyRegion.imageExtent = {DstBox.Width(), std::max(DstBox.Height(), 1u), std::max(DstBox.Depth(), 1u)};
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+    {
+        std::lock_guard<std::mutex> Lock{m_HostCopyMtx};
+
+        const VkImageLayout Layout = GetLayout();
+        if (Layout == VK_IMAGE_LAYOUT_UNDEFINED)
+        {
+            if (GetState() != RESOURCE_STATE_UNDEFINED)
+                return False;
+
+            // The texture has never been used by the GPU, so the content of all subresources
+            // is undefined and the entire image can be transitioned on the host.
+            VkHostImageLayoutTransitionInfoEXT vkLayoutTransitionInfo{};
+            vkLayoutTransitionInfo.sType     = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT;
+            vkLayoutTransitionInfo.image     = m_VulkanImage;
+            vkLayoutTransitionInfo.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            vkLayoutTransitionInfo.newLayout = m_HostCopyLayout;
+
+            vkLayoutTransitionInfo.subresourceRange.aspectMask     = vkCopyRegion.imageSubresource.aspectMask;
+            vkLayoutTransitionInfo.subresourceRange.baseArrayLayer = 0;
+            vkLayoutTransitionInfo.subresourceRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
+            vkLayoutTransitionInfo.subresourceRange.baseMipLevel   = 0;
+            vkLayoutTransitionInfo.subresourceRange.levelCount     = VK_REMAINING_MIP_LEVELS;
+            LogicalDevice.HostTransitionImageLayout(vkLayoutTransitionInfo);
+
+            SetLayout(m_HostCopyLayout);
+        }
+        else if (Layout != m_HostCopyLayout)
+        {
+            // Host copies are only guaranteed to be supported in the layout checked at creation
+            return False;
+        }
+    }
+
+    VkCopyMemoryToImageInfoEXT vkCopyInfo{};
+    vkCopyInfo.sType          = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT;
+    vkCopyInfo.dstImage       = m_VulkanImage;
+    vkCopyInfo.dstImageLayout = m_HostCopyLayout;
+    vkCopyInfo.regionCount    = 1;
+    vkCopyInfo.pRegions       = &vkCopyRegion;
+
+    return LogicalDevice.CopyMemoryToImage(vkCopyInfo) == VK_SUCCESS;
+}
+
 void TextureVkImpl::SetLayout(VkImageLayout Layout)
 {
     SetState(VkImageLayoutToResourceState(Layout));
@@ -968,6 +1193,27 @@ void TextureVkImpl::InvalidateStagingRange(VkDeviceSize Offset, VkDeviceSize Siz
     (void)err;
 }
 
+Bool TextureVkImpl::ExportMemoryHandle(Uint64& Handle, Uint64& MemorySize) const
+{
+    if ((m_Desc.MiscFlags & MISC_TEXTURE_FLAG_EXPORTABLE) == 0)
+    {
+        DEV_ERROR("Texture '", m_Desc.Name, "' was not created with MISC_TEXTURE_FLAG_EXPORTABLE flag");
+        return False;
+    }
+    VERIFY(m_DedicatedMemory, "Exportable textures must use dedicated allocations");
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = m_pDevice->GetLogicalDevice();
+
+    VkResult err = LogicalDevice.GetMemoryHandle(m_DedicatedMemory, Handle);
+    CHECK_VK_ERROR(err, "Failed to export memory of texture '", m_Desc.Name, "'");
+    if (err != VK_SUCCESS)
+        return False;
+
+    // The dedicated allocation has exactly the size of the image memory requirements
+    MemorySize = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage).size;
+    return True;
+}
+
 void TextureVkImpl::InitSparseProperties() noexcept(false)
 {
     VERIFY_EXPR(m_Desc.Usage == USAGE_SPARSE);
@@ -47,7 +47,8 @@ static VkDeviceSize GetDefaultAlignment(const VulkanUtilities::PhysicalDevice& P
 VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Allocator,
                                                        RenderDeviceVkImpl& DeviceVk,
                                                        Uint32              Size,
-                                                       Uint64              CommandQueueMask) :
+                                                       Uint64              CommandQueueMask,
+                                                       bool                UseDeviceLocalMemory) :
     // clang-format off
     TBase             {Allocator, Size},
     m_DeviceVk        {DeviceVk},
@@ -69,6 +70,15 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
         VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
         VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    if (DeviceVk.UseDescriptorBuffers())
+    {
+        // Descriptor set data is suballocated from the dynamic heap and bound as a descriptor buffer.
+        // Dynamic buffers are also suballocated from the heap and need device addresses.
+        VkBuffCI.usage |=
+            VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
     VkBuffCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
     VkBuffCI.queueFamilyIndexCount = 0;
     VkBuffCI.pQueueFamilyIndices   = nullptr;
@@ -79,15 +89,28 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
 
     const VulkanUtilities::PhysicalDevice& PhysicalDevice = DeviceVk.GetPhysicalDevice();
 
+    VkMemoryAllocateFlagsInfo AllocateFlags{};
+    AllocateFlags.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+    AllocateFlags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
     VkMemoryAllocateInfo MemAlloc{};
-    MemAlloc.pNext          = nullptr;
+    MemAlloc.pNext          = (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) != 0 ? &AllocateFlags : nullptr;
     MemAlloc.sType          = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     MemAlloc.allocationSize = MemReqs.size;
 
     // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache management commands vkFlushMappedMemoryRanges
     // and vkInvalidateMappedMemoryRanges are NOT needed to flush host writes to the device or make device writes visible
     // to the host (10.2)
-    MemAlloc.memoryTypeIndex = PhysicalDevice.GetMemoryTypeIndex(MemReqs.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    MemAlloc.memoryTypeIndex = VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex;
+    if (UseDeviceLocalMemory)
+    {
+        // With resizable BAR, the GPU reads dynamic data from video memory rather than over PCIe
+        MemAlloc.memoryTypeIndex = PhysicalDevice.GetMemoryTypeIndex(MemReqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        if (MemAlloc.memoryTypeIndex == VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex)
+            LOG_WARNING_MESSAGE("Device-local host-visible memory type is not compatible with the dynamic heap buffer. Host memory will be used.");
+    }
+    if (MemAlloc.memoryTypeIndex == VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex)
+        MemAlloc.memoryTypeIndex = PhysicalDevice.GetMemoryTypeIndex(MemReqs.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
     VERIFY(MemAlloc.memoryTypeIndex != VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex,
            "Vulkan spec requires that for a VkBuffer not created with the "
@@ -111,7 +134,14 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
     err = LogicalDevice.BindBufferMemory(m_VkBuffer, m_BufferMemory, 0 /*offset*/);
     CHECK_VK_ERROR_AND_THROW(err, "Failed to bind buffer memory");
 
-    LOG_INFO_MESSAGE("GPU dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2));
+    if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+    {
+        m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VkBuffer);
+        VERIFY_EXPR(m_VkDeviceAddress != 0);
+    }
+
+    const bool IsDeviceLocal = (PhysicalDevice.GetMemoryProperties().memoryTypes[MemAlloc.memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) != 0;
+    LOG_INFO_MESSAGE("GPU dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2), (IsDeviceLocal ? " (device-local memory)" : ""));
 }
 
 void VulkanDynamicMemoryManager::Destroy()
@@ -153,6 +183,12 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
 
     MasterBlock Block = TBase::AllocateMasterBlock(SizeInBytes, Alignment);
     if (!Block.IsValid())
+    {
+        // Return the blocks kept by the device contexts for reuse to the manager
+        FlushBlockCaches();
+        Block = TBase::AllocateMasterBlock(SizeInBytes, Alignment);
+    }
+    if (!Block.IsValid())
     {
         // Allocation failed. Try to wait for GPU to finish pending frames to release some space
         auto                          StartIdleTime   = std::chrono::high_resolution_clock::now();
@@ -220,6 +256,26 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
 }
 
 
+VulkanDynamicHeap::MasterBlock VulkanDynamicHeap::AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment)
+{
+    if (SizeInBytes == m_MasterBlockSize && Alignment == 0)
+    {
+        // Try to reuse a block from the context's cache first to avoid locking the global manager
+        MasterBlock Block = m_pBlockCache->Pop();
+        if (Block.IsValid())
+        {
+            if (m_pStats != nullptr)
+                ++m_pStats->DynamicMasterBlockCacheHits;
+            return Block;
+        }
+    }
+
+    MasterBlock Block = m_GlobalDynamicMemMgr.AllocateMasterBlock(SizeInBytes, Alignment);
+    if (Block.IsValid() && m_pStats != nullptr)
+        ++m_pStats->DynamicMasterBlockAllocations;
+    return Block;
+}
+
 VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 Alignment)
 {
     VERIFY_EXPR(Alignment > 0);
@@ -230,7 +286,7 @@ VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 A
     if (SizeInBytes > m_MasterBlockSize / 2)
     {
         // Allocate directly from the memory manager
-        MasterBlock Block = m_GlobalDynamicMemMgr.AllocateMasterBlock(SizeInBytes, Alignment);
+        MasterBlock Block = AllocateMasterBlock(SizeInBytes, Alignment);
         if (Block.IsValid())
         {
             AlignedOffset = AlignUp(Block.UnalignedOffset, size_t{Alignment});
@@ -244,7 +300,7 @@ VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 A
     {
         if (m_CurrOffset == InvalidOffset || SizeInBytes + (AlignUp(m_CurrOffset, size_t{Alignment}) - m_CurrOffset) > m_AvailableSize)
         {
-            MasterBlock Block = m_GlobalDynamicMemMgr.AllocateMasterBlock(m_MasterBlockSize, 0);
+            MasterBlock Block = AllocateMasterBlock(m_MasterBlockSize, 0);
             if (Block.IsValid())
             {
                 m_CurrOffset = Block.UnalignedOffset;
@@ -284,9 +340,43 @@ VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 A
         return VulkanDynamicAllocation{};
 }
 
+void VulkanDynamicHeap::UpdateMasterBlockSize()
+{
+    // Grow the master block size so that the peak allocated size fits into a few blocks.
+    // This reduces the number of block requests for contexts that use a lot of dynamic memory.
+    static constexpr Uint32 TargetBlocksPerFrame = 4;
+    static constexpr Uint32 MaxBlockSizeScale    = 16;
+
+    const Uint32 MaxBlockSize = std::max(m_BaseMasterBlockSize,
+                                         std::min(m_BaseMasterBlockSize * MaxBlockSizeScale,
+                                                  static_cast<Uint32>(m_GlobalDynamicMemMgr.GetSize() / 16)));
+
+    Uint32 BlockSize = m_MasterBlockSize;
+    while (BlockSize * 2 <= MaxBlockSize && BlockSize * TargetBlocksPerFrame < m_PeakAllocatedSize)
+        BlockSize *= 2;
+
+    if (BlockSize != m_MasterBlockSize)
+    {
+        m_MasterBlockSize = BlockSize;
+        // Blocks of the previous size are returned to the manager by the cache
+        m_pBlockCache->SetLimits(m_MasterBlockSize, 0);
+    }
+}
+
 void VulkanDynamicHeap::ReleaseMasterBlocks(RenderDeviceVkImpl& DeviceVkImpl, Uint64 CmdQueueMask)
 {
-    m_GlobalDynamicMemMgr.ReleaseMasterBlocks(m_MasterBlocks, DeviceVkImpl, CmdQueueMask);
+    UpdateMasterBlockSize();
+
+    // Keep as many blocks in the cache as the heap has used in this frame
+    size_t NumBlocks = 0;
+    for (const MasterBlock& Block : m_MasterBlocks)
+    {
+        if (VulkanDynamicMemoryManager::BlockCache::IsMatchingSize(Block.Size, m_MasterBlockSize))
+            ++NumBlocks;
+    }
+    m_pBlockCache->SetLimits(m_MasterBlockSize, NumBlocks);
+
+    m_GlobalDynamicMemMgr.ReleaseMasterBlocks(m_MasterBlocks, DeviceVkImpl, CmdQueueMask, m_pBlockCache);
     m_MasterBlocks.clear();
 
     m_CurrOffset    = InvalidOffset;
@@ -301,7 +391,10 @@ VulkanDynamicHeap::~VulkanDynamicHeap()
 {
     DEV_CHECK_ERR(m_MasterBlocks.empty(), m_MasterBlocks.size(), " master block(s) have not been returned to dynamic memory manager");
 
-    Uint32 PeakAllocatedPages = m_PeakAllocatedSize / m_MasterBlockSize;
+    // Blocks that are still in the release queues will be returned directly to the manager
+    m_pBlockCache->SetLimits(0, 0);
+
+    Uint32 PeakAllocatedPages = m_PeakAllocatedSize / m_BaseMasterBlockSize;
     LOG_INFO_MESSAGE(m_HeapName,
                      " usage stats:\n"
                      "                       Peak used/aligned/allocated size: ",
@@ -28,6 +28,7 @@
 #include "pch.h"
 
 #include "VulkanTypeConversions.hpp"
+#include "GraphicsAccessories.hpp"
 
 #include <unordered_map>
 #include <array>
@@ -39,155 +40,137 @@
 namespace Diligent
 {
 
-class TexFormatToVkFormatMapper
+namespace
 {
-public:
-    TexFormatToVkFormatMapper()
-    {
-        // clang-format off
-        m_FmtToVkFmtMap[TEX_FORMAT_UNKNOWN] = VK_FORMAT_UNDEFINED;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA32_TYPELESS] = VK_FORMAT_R32G32B32A32_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA32_FLOAT]    = VK_FORMAT_R32G32B32A32_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA32_UINT]     = VK_FORMAT_R32G32B32A32_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA32_SINT]     = VK_FORMAT_R32G32B32A32_SINT;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_RGB32_TYPELESS] = VK_FORMAT_R32G32B32_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGB32_FLOAT]    = VK_FORMAT_R32G32B32_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGB32_UINT]     = VK_FORMAT_R32G32B32_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGB32_SINT]     = VK_FORMAT_R32G32B32_SINT;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA16_TYPELESS] = VK_FORMAT_R16G16B16A16_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA16_FLOAT]    = VK_FORMAT_R16G16B16A16_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA16_UNORM]    = VK_FORMAT_R16G16B16A16_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA16_UINT]     = VK_FORMAT_R16G16B16A16_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA16_SNORM]    = VK_FORMAT_R16G16B16A16_SNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA16_SINT]     = VK_FORMAT_R16G16B16A16_SINT;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_RG32_TYPELESS] = VK_FORMAT_R32G32_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG32_FLOAT]    = VK_FORMAT_R32G32_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG32_UINT]     = VK_FORMAT_R32G32_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG32_SINT]     = VK_FORMAT_R32G32_SINT;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_R32G8X24_TYPELESS]        = VK_FORMAT_D32_SFLOAT_S8_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_D32_FLOAT_S8X24_UINT]     = VK_FORMAT_D32_SFLOAT_S8_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_R32_FLOAT_X8X24_TYPELESS] = VK_FORMAT_D32_SFLOAT_S8_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_X32_TYPELESS_G8X24_UINT]  = VK_FORMAT_UNDEFINED;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_RGB10A2_TYPELESS] = VK_FORMAT_A2R10G10B10_UNORM_PACK32;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGB10A2_UNORM]    = VK_FORMAT_A2R10G10B10_UNORM_PACK32;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGB10A2_UINT]     = VK_FORMAT_A2R10G10B10_UINT_PACK32;
-        m_FmtToVkFmtMap[TEX_FORMAT_R11G11B10_FLOAT]  = VK_FORMAT_B10G11R11_UFLOAT_PACK32;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA8_TYPELESS]   = VK_FORMAT_R8G8B8A8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA8_UNORM]      = VK_FORMAT_R8G8B8A8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA8_UNORM_SRGB] = VK_FORMAT_R8G8B8A8_SRGB;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA8_UINT]       = VK_FORMAT_R8G8B8A8_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA8_SNORM]      = VK_FORMAT_R8G8B8A8_SNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RGBA8_SINT]       = VK_FORMAT_R8G8B8A8_SINT;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_RG16_TYPELESS] = VK_FORMAT_R16G16_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG16_FLOAT]    = VK_FORMAT_R16G16_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG16_UNORM]    = VK_FORMAT_R16G16_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG16_UINT]     = VK_FORMAT_R16G16_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG16_SNORM]    = VK_FORMAT_R16G16_SNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG16_SINT]     = VK_FORMAT_R16G16_SINT;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_R32_TYPELESS] = VK_FORMAT_R32_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_D32_FLOAT]    = VK_FORMAT_D32_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_R32_FLOAT]    = VK_FORMAT_R32_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_R32_UINT]     = VK_FORMAT_R32_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_R32_SINT]     = VK_FORMAT_R32_SINT;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_R24G8_TYPELESS]        = VK_FORMAT_D24_UNORM_S8_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_D24_UNORM_S8_UINT]     = VK_FORMAT_D24_UNORM_S8_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_R24_UNORM_X8_TYPELESS] = VK_FORMAT_D24_UNORM_S8_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_X24_TYPELESS_G8_UINT]  = VK_FORMAT_UNDEFINED;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_RG8_TYPELESS] = VK_FORMAT_R8G8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG8_UNORM]    = VK_FORMAT_R8G8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG8_UINT]     = VK_FORMAT_R8G8_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG8_SNORM]    = VK_FORMAT_R8G8_SNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG8_SINT]     = VK_FORMAT_R8G8_SINT;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_R16_TYPELESS] = VK_FORMAT_R16_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_R16_FLOAT]    = VK_FORMAT_R16_SFLOAT;
-        m_FmtToVkFmtMap[TEX_FORMAT_D16_UNORM]    = VK_FORMAT_D16_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_R16_UNORM]    = VK_FORMAT_R16_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_R16_UINT]     = VK_FORMAT_R16_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_R16_SNORM]    = VK_FORMAT_R16_SNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_R16_SINT]     = VK_FORMAT_R16_SINT;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_R8_TYPELESS] = VK_FORMAT_R8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_R8_UNORM]    = VK_FORMAT_R8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_R8_UINT]     = VK_FORMAT_R8_UINT;
-        m_FmtToVkFmtMap[TEX_FORMAT_R8_SNORM]    = VK_FORMAT_R8_SNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_R8_SINT]     = VK_FORMAT_R8_SINT;
-        // To get the same behaviour as expected for TEX_FORMAT_A8_UNORM we
-        // swizzle the components appropriately using the VkImageViewCreateInfo struct
-        m_FmtToVkFmtMap[TEX_FORMAT_A8_UNORM]    = VK_FORMAT_R8_UNORM;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_R1_UNORM]    = VK_FORMAT_UNDEFINED;
-
-        m_FmtToVkFmtMap[TEX_FORMAT_RGB9E5_SHAREDEXP] = VK_FORMAT_E5B9G9R9_UFLOAT_PACK32;
-        m_FmtToVkFmtMap[TEX_FORMAT_RG8_B8G8_UNORM]   = VK_FORMAT_UNDEFINED;
-        m_FmtToVkFmtMap[TEX_FORMAT_G8R8_G8B8_UNORM]  = VK_FORMAT_UNDEFINED;
-
-        // http://www.g-truc.net/post-0335.html
-        // http://renderingpipeline.com/2012/07/texture-compression/
-        m_FmtToVkFmtMap[TEX_FORMAT_BC1_TYPELESS]   = VK_FORMAT_BC1_RGB_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC1_UNORM]      = VK_FORMAT_BC1_RGB_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC1_UNORM_SRGB] = VK_FORMAT_BC1_RGB_SRGB_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC2_TYPELESS]   = VK_FORMAT_BC2_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC2_UNORM]      = VK_FORMAT_BC2_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC2_UNORM_SRGB] = VK_FORMAT_BC2_SRGB_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC3_TYPELESS]   = VK_FORMAT_BC3_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC3_UNORM]      = VK_FORMAT_BC3_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC3_UNORM_SRGB] = VK_FORMAT_BC3_SRGB_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC4_TYPELESS]   = VK_FORMAT_BC4_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC4_UNORM]      = VK_FORMAT_BC4_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC4_SNORM]      = VK_FORMAT_BC4_SNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC5_TYPELESS]   = VK_FORMAT_BC5_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC5_UNORM]      = VK_FORMAT_BC5_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC5_SNORM]      = VK_FORMAT_BC5_SNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_B5G6R5_UNORM]   = VK_FORMAT_B5G6R5_UNORM_PACK16;
-        m_FmtToVkFmtMap[TEX_FORMAT_B5G5R5A1_UNORM] = VK_FORMAT_B5G5R5A1_UNORM_PACK16;
-        m_FmtToVkFmtMap[TEX_FORMAT_BGRA8_UNORM]    = VK_FORMAT_B8G8R8A8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_BGRX8_UNORM]    = VK_FORMAT_B8G8R8A8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_R10G10B10_XR_BIAS_A2_UNORM] = VK_FORMAT_UNDEFINED;
-        m_FmtToVkFmtMap[TEX_FORMAT_BGRA8_TYPELESS]   = VK_FORMAT_B8G8R8A8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_BGRA8_UNORM_SRGB] = VK_FORMAT_B8G8R8A8_SRGB;
-        m_FmtToVkFmtMap[TEX_FORMAT_BGRX8_TYPELESS]   = VK_FORMAT_B8G8R8A8_UNORM;
-        m_FmtToVkFmtMap[TEX_FORMAT_BGRX8_UNORM_SRGB] = VK_FORMAT_B8G8R8A8_SRGB;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC6H_TYPELESS] = VK_FORMAT_BC6H_UFLOAT_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC6H_UF16]     = VK_FORMAT_BC6H_UFLOAT_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC6H_SF16]     = VK_FORMAT_BC6H_SFLOAT_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC7_TYPELESS]   = VK_FORMAT_BC7_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC7_UNORM]      = VK_FORMAT_BC7_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_BC7_UNORM_SRGB] = VK_FORMAT_BC7_SRGB_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_ETC2_RGB8_UNORM]        = VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_ETC2_RGB8_UNORM_SRGB]   = VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_ETC2_RGB8A1_UNORM]      = VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_ETC2_RGB8A1_UNORM_SRGB] = VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_ETC2_RGBA8_UNORM]       = VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
-        m_FmtToVkFmtMap[TEX_FORMAT_ETC2_RGBA8_UNORM_SRGB]  = VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK;
-        // clang-format on
-    }
 
-    VkFormat operator[](TEXTURE_FORMAT TexFmt) const
-    {
-        VERIFY_EXPR(TexFmt < _countof(m_FmtToVkFmtMap));
-        return m_FmtToVkFmtMap[TexFmt];
-    }
+struct TexFormatToVkFormatMapping
+{
+    TEXTURE_FORMAT Format;
+    VkFormat       VkFmt;
+};
 
-private:
-    VkFormat m_FmtToVkFmtMap[TEX_FORMAT_NUM_FORMATS] = {};
+// clang-format off
+constexpr TexFormatToVkFormatMapping FmtToVkFmtMap[] =
+{
+    {TEX_FORMAT_UNKNOWN,                     VK_FORMAT_UNDEFINED},
+    {TEX_FORMAT_RGBA32_TYPELESS,             VK_FORMAT_R32G32B32A32_SFLOAT},
+    {TEX_FORMAT_RGBA32_FLOAT,                VK_FORMAT_R32G32B32A32_SFLOAT},
+    {TEX_FORMAT_RGBA32_UINT,                 VK_FORMAT_R32G32B32A32_UINT},
+    {TEX_FORMAT_RGBA32_SINT,                 VK_FORMAT_R32G32B32A32_SINT},
+    {TEX_FORMAT_RGB32_TYPELESS,              VK_FORMAT_R32G32B32_SFLOAT},
+    {TEX_FORMAT_RGB32_FLOAT,                 VK_FORMAT_R32G32B32_SFLOAT},
+    {TEX_FORMAT_RGB32_UINT,                  VK_FORMAT_R32G32B32_UINT},
+    {TEX_FORMAT_RGB32_SINT,                  VK_FORMAT_R32G32B32_SINT},
+    {TEX_FORMAT_RGBA16_TYPELESS,             VK_FORMAT_R16G16B16A16_SFLOAT},
+    {TEX_FORMAT_RGBA16_FLOAT,                VK_FORMAT_R16G16B16A16_SFLOAT},
+    {TEX_FORMAT_RGBA16_UNORM,                VK_FORMAT_R16G16B16A16_UNORM},
+    {TEX_FORMAT_RGBA16_UINT,                 VK_FORMAT_R16G16B16A16_UINT},
+    {TEX_FORMAT_RGBA16_SNORM,                VK_FORMAT_R16G16B16A16_SNORM},
+    {TEX_FORMAT_RGBA16_SINT,                 VK_FORMAT_R16G16B16A16_SINT},
+    {TEX_FORMAT_RG32_TYPELESS,               VK_FORMAT_R32G32_SFLOAT},
+    {TEX_FORMAT_RG32_FLOAT,                  VK_FORMAT_R32G32_SFLOAT},
+    {TEX_FORMAT_RG32_UINT,                   VK_FORMAT_R32G32_UINT},
+    {TEX_FORMAT_RG32_SINT,                   VK_FORMAT_R32G32_SINT},
+    {TEX_FORMAT_R32G8X24_TYPELESS,           VK_FORMAT_D32_SFLOAT_S8_UINT},
+    {TEX_FORMAT_D32_FLOAT_S8X24_UINT,        VK_FORMAT_D32_SFLOAT_S8_UINT},
+    {TEX_FORMAT_R32_FLOAT_X8X24_TYPELESS,    VK_FORMAT_D32_SFLOAT_S8_UINT},
+    {TEX_FORMAT_X32_TYPELESS_G8X24_UINT,     VK_FORMAT_UNDEFINED},
+    {TEX_FORMAT_RGB10A2_TYPELESS,            VK_FORMAT_A2R10G10B10_UNORM_PACK32},
+    {TEX_FORMAT_RGB10A2_UNORM,               VK_FORMAT_A2R10G10B10_UNORM_PACK32},
+    {TEX_FORMAT_RGB10A2_UINT,                VK_FORMAT_A2R10G10B10_UINT_PACK32},
+    {TEX_FORMAT_R11G11B10_FLOAT,             VK_FORMAT_B10G11R11_UFLOAT_PACK32},
+    {TEX_FORMAT_RGBA8_TYPELESS,              VK_FORMAT_R8G8B8A8_UNORM},
+    {TEX_FORMAT_RGBA8_UNORM,                 VK_FORMAT_R8G8B8A8_UNORM},
+    {TEX_FORMAT_RGBA8_UNORM_SRGB,            VK_FORMAT_R8G8B8A8_SRGB},
+    {TEX_FORMAT_RGBA8_UINT,                  VK_FORMAT_R8G8B8A8_UINT},
+    {TEX_FORMAT_RGBA8_SNORM,                 VK_FORMAT_R8G8B8A8_SNORM},
+    {TEX_FORMAT_RGBA8_SINT,                  VK_FORMAT_R8G8B8A8_SINT},
+    {TEX_FORMAT_RG16_TYPELESS,               VK_FORMAT_R16G16_SFLOAT},
+    {TEX_FORMAT_RG16_FLOAT,                  VK_FORMAT_R16G16_SFLOAT},
+    {TEX_FORMAT_RG16_UNORM,                  VK_FORMAT_R16G16_UNORM},
+    {TEX_FORMAT_RG16_UINT,                   VK_FORMAT_R16G16_UINT},
+    {TEX_FORMAT_RG16_SNORM,                  VK_FORMAT_R16G16_SNORM},
+    {TEX_FORMAT_RG16_SINT,                   VK_FORMAT_R16G16_SINT},
+    {TEX_FORMAT_R32_TYPELESS,                VK_FORMAT_R32_SFLOAT},
+    {TEX_FORMAT_D32_FLOAT,                   VK_FORMAT_D32_SFLOAT},
+    {TEX_FORMAT_R32_FLOAT,                   VK_FORMAT_R32_SFLOAT},
+    {TEX_FORMAT_R32_UINT,                    VK_FORMAT_R32_UINT},
+    {TEX_FORMAT_R32_SINT,                    VK_FORMAT_R32_SINT},
+    {TEX_FORMAT_R24G8_TYPELESS,              VK_FORMAT_D24_UNORM_S8_UINT},
+    {TEX_FORMAT_D24_UNORM_S8_UINT,           VK_FORMAT_D24_UNORM_S8_UINT},
+    {TEX_FORMAT_R24_UNORM_X8_TYPELESS,       VK_FORMAT_D24_UNORM_S8_UINT},
+    {TEX_FORMAT_X24_TYPELESS_G8_UINT,        VK_FORMAT_UNDEFINED},
+    {TEX_FORMAT_RG8_TYPELESS,                VK_FORMAT_R8G8_UNORM},
+    {TEX_FORMAT_RG8_UNORM,                   VK_FORMAT_R8G8_UNORM},
+    {TEX_FORMAT_RG8_UINT,                    VK_FORMAT_R8G8_UINT},
+    {TEX_FORMAT_RG8_SNORM,                   VK_FORMAT_R8G8_SNORM},
+    {TEX_FORMAT_RG8_SINT,                    VK_FORMAT_R8G8_SINT},
+    {TEX_FORMAT_R16_TYPELESS,                VK_FORMAT_R16_SFLOAT},
+    {TEX_FORMAT_R16_FLOAT,                   VK_FORMAT_R16_SFLOAT},
+    {TEX_FORMAT_D16_UNORM,                   VK_FORMAT_D16_UNORM},
+    {TEX_FORMAT_R16_UNORM,                   VK_FORMAT_R16_UNORM},
+    {TEX_FORMAT_R16_UINT,                    VK_FORMAT_R16_UINT},
+    {TEX_FORMAT_R16_SNORM,                   VK_FORMAT_R16_SNORM},
+    {TEX_FORMAT_R16_SINT,                    VK_FORMAT_R16_SINT},
+    {TEX_FORMAT_R8_TYPELESS,                 VK_FORMAT_R8_UNORM},
+    {TEX_FORMAT_R8_UNORM,                    VK_FORMAT_R8_UNORM},
+    {TEX_FORMAT_R8_UINT,                     VK_FORMAT_R8_UINT},
+    {TEX_FORMAT_R8_SNORM,                    VK_FORMAT_R8_SNORM},
+    {TEX_FORMAT_R8_SINT,                     VK_FORMAT_R8_SINT},
+    // To get the same behaviour as expected for TEX_FORMAT_A8_UNORM we
+    // swizzle the components appropriately using the VkImageViewCreateInfo struct
+    {TEX_FORMAT_A8_UNORM,                    VK_FORMAT_R8_UNORM},
+    {TEX_FORMAT_R1_UNORM,                    VK_FORMAT_UNDEFINED},
+    {TEX_FORMAT_RGB9E5_SHAREDEXP,            VK_FORMAT_E5B9G9R9_UFLOAT_PACK32},
+    {TEX_FORMAT_RG8_B8G8_UNORM,              VK_FORMAT_UNDEFINED},
+    {TEX_FORMAT_G8R8_G8B8_UNORM,             VK_FORMAT_UNDEFINED},
+    {TEX_FORMAT_BC1_TYPELESS,                VK_FORMAT_BC1_RGB_UNORM_BLOCK},
+    {TEX_FORMAT_BC1_UNORM,                   VK_FORMAT_BC1_RGB_UNORM_BLOCK},
+    {TEX_FORMAT_BC1_UNORM_SRGB,              VK_FORMAT_BC1_RGB_SRGB_BLOCK},
+    {TEX_FORMAT_BC2_TYPELESS,                VK_FORMAT_BC2_UNORM_BLOCK},
+    {TEX_FORMAT_BC2_UNORM,                   VK_FORMAT_BC2_UNORM_BLOCK},
+    {TEX_FORMAT_BC2_UNORM_SRGB,              VK_FORMAT_BC2_SRGB_BLOCK},
+    {TEX_FORMAT_BC3_TYPELESS,                VK_FORMAT_BC3_UNORM_BLOCK},
+    {TEX_FORMAT_BC3_UNORM,                   VK_FORMAT_BC3_UNORM_BLOCK},
+    {TEX_FORMAT_BC3_UNORM_SRGB,              VK_FORMAT_BC3_SRGB_BLOCK},
+    {TEX_FORMAT_BC4_TYPELESS,                VK_FORMAT_BC4_UNORM_BLOCK},
+    {TEX_FORMAT_BC4_UNORM,                   VK_FORMAT_BC4_UNORM_BLOCK},
+    {TEX_FORMAT_BC4_SNORM,                   VK_FORMAT_BC4_SNORM_BLOCK},
+    {TEX_FORMAT_BC5_TYPELESS,                VK_FORMAT_BC5_UNORM_BLOCK},
+    {TEX_FORMAT_BC5_UNORM,                   VK_FORMAT_BC5_UNORM_BLOCK},
+    {TEX_FORMAT_BC5_SNORM,                   VK_FORMAT_BC5_SNORM_BLOCK},
+    {TEX_FORMAT_B5G6R5_UNORM,                VK_FORMAT_B5G6R5_UNORM_PACK16},
+    {TEX_FORMAT_B5G5R5A1_UNORM,              VK_FORMAT_B5G5R5A1_UNORM_PACK16},
+    {TEX_FORMAT_BGRA8_UNORM,                 VK_FORMAT_B8G8R8A8_UNORM},
+    {TEX_FORMAT_BGRX8_UNORM,                 VK_FORMAT_B8G8R8A8_UNORM},
+    {TEX_FORMAT_R10G10B10_XR_BIAS_A2_UNORM,  VK_FORMAT_UNDEFINED},
+    {TEX_FORMAT_BGRA8_TYPELESS,              VK_FORMAT_B8G8R8A8_UNORM},
+    {TEX_FORMAT_BGRA8_UNORM_SRGB,            VK_FORMAT_B8G8R8A8_SRGB},
+    {TEX_FORMAT_BGRX8_TYPELESS,              VK_FORMAT_B8G8R8A8_UNORM},
+    {TEX_FORMAT_BGRX8_UNORM_SRGB,            VK_FORMAT_B8G8R8A8_SRGB},
+    {TEX_FORMAT_BC6H_TYPELESS,               VK_FORMAT_BC6H_UFLOAT_BLOCK},
+    {TEX_FORMAT_BC6H_UF16,                   VK_FORMAT_BC6H_UFLOAT_BLOCK},
+    {TEX_FORMAT_BC6H_SF16,                   VK_FORMAT_BC6H_SFLOAT_BLOCK},
+    {TEX_FORMAT_BC7_TYPELESS,                VK_FORMAT_BC7_UNORM_BLOCK},
+    {TEX_FORMAT_BC7_UNORM,                   VK_FORMAT_BC7_UNORM_BLOCK},
+    {TEX_FORMAT_BC7_UNORM_SRGB,              VK_FORMAT_BC7_SRGB_BLOCK},
+    {TEX_FORMAT_ETC2_RGB8_UNORM,             VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK},
+    {TEX_FORMAT_ETC2_RGB8_UNORM_SRGB,        VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK},
+    {TEX_FORMAT_ETC2_RGB8A1_UNORM,           VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK},
+    {TEX_FORMAT_ETC2_RGB8A1_UNORM_SRGB,      VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK},
+    {TEX_FORMAT_ETC2_RGBA8_UNORM,            VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK},
+    {TEX_FORMAT_ETC2_RGBA8_UNORM_SRGB,       VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK},
 };
+// clang-format on
+static_assert(_countof(FmtToVkFmtMap) == TEX_FORMAT_NUM_FORMATS, "Please enter the new format information above");
+static_assert(IsTextureFormatTableOrdered(FmtToVkFmtMap), "Texture formats in the table above must follow the TEXTURE_FORMAT order");
+
+} // namespace
 
 VkFormat TexFormatToVkFormat(TEXTURE_FORMAT TexFmt)
 {
-    static const TexFormatToVkFormatMapper FmtMapper;
-    return FmtMapper[TexFmt];
+    VERIFY_EXPR(TexFmt < _countof(FmtToVkFmtMap));
+    return FmtToVkFmtMap[TexFmt].VkFmt;
 }
 
 
@@ -1968,6 +1951,7 @@ DeviceFeatures VkFeaturesToDeviceFeatures(uint32_t
     Features.TextureSubresourceViews       = DEVICE_FEATURE_STATE_ENABLED;
     Features.AsyncShaderCompilation        = DEVICE_FEATURE_STATE_ENABLED;
     Features.FormattedBuffers              = DEVICE_FEATURE_STATE_ENABLED;
+    Features.SpecializationConstants       = DEVICE_FEATURE_STATE_ENABLED;
 
     // Timestamps are not a feature and can't be disabled. They are either supported by the device, or not.
     Features.TimestampQueries = vkDeviceProps.limits.timestampComputeAndGraphics ? DEVICE_FEATURE_STATE_ENABLED : DEVICE_FEATURE_STATE_DISABLED;
@@ -2059,9 +2043,18 @@ DeviceFeatures VkFeaturesToDeviceFeatures(uint32_t
     INIT_FEATURE(NativeMultiDraw,
                  ExtFeatures.MultiDraw.multiDraw != VK_FALSE && ExtFeatures.ShaderDrawParameters.shaderDrawParameters != VK_FALSE);
 
+    INIT_FEATURE(ExtendedDynamicState,
+                 ExtFeatures.ExtendedDynamicState.extendedDynamicState != VK_FALSE);
+
+    INIT_FEATURE(Multiview,
+                 ExtFeatures.Multiview.multiview != VK_FALSE);
+
+    INIT_FEATURE(ExternalMemory,
+                 ExtFeatures.ExternalMemory);
+
 #undef INIT_FEATURE
 
-    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeatures, 52, "Did you add a new feature to DeviceFeatures? Please handle its status here (if necessary).");
 
     return Features;
 }
@@ -2078,10 +2071,14 @@ DeviceFeaturesVk PhysicalDeviceFeaturesToDeviceFeaturesVk(const VulkanUtilities:
 
     INIT_FEATURE(DynamicRendering, ExtFeatures.DynamicRendering.dynamicRendering != VK_FALSE);
     INIT_FEATURE(HostImageCopy, ExtFeatures.HostImageCopy.hostImageCopy != VK_FALSE);
+    // Buffer device address is required to get addresses of the descriptor buffer and the resources
+    INIT_FEATURE(DescriptorBuffer, ExtFeatures.DescriptorBuffer.descriptorBuffer != VK_FALSE && ExtFeatures.BufferDeviceAddress.bufferDeviceAddress != VK_FALSE);
+    // Shader objects can only be used with dynamic rendering
+    INIT_FEATURE(ShaderObject, ExtFeatures.ShaderObject.shaderObject != VK_FALSE && ExtFeatures.DynamicRendering.dynamicRendering != VK_FALSE);
 
 #undef INIT_FEATURE
 
-    ASSERT_SIZEOF(DeviceFeaturesVk, 2, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeaturesVk, 4, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
 
     return FeaturesVk;
 }
@@ -2283,4 +2280,26 @@ VkImageAspectFlags ComponentTypeToVkAspectMask(COMPONENT_TYPE ComponentType)
     }
 }
 
+size_t GetDescriptorBufferDescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props, VkDescriptorType Type)
+{
+    switch (Type)
+    {
+        // clang-format off
+        case VK_DESCRIPTOR_TYPE_SAMPLER:                    return Props.samplerDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     return Props.combinedImageSamplerDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              return Props.sampledImageDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:              return Props.storageImageDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       return Props.uniformTexelBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       return Props.storageTexelBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             return Props.uniformBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:             return Props.storageBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           return Props.inputAttachmentDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: return Props.accelerationStructureDescriptorSize;
+        // clang-format on
+        default:
+            UNEXPECTED("Descriptor type ", static_cast<int>(Type), " is not supported in descriptor buffers");
+            return 0;
+    }
+}
+
 } // namespace Diligent
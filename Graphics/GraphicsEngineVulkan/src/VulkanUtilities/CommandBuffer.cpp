@@ -237,6 +237,97 @@ void CommandBuffer::MemoryBarrier(VkAccessFlags        srcAccessMask,
     m_Barrier.MemoryDstAccess |= dstAccessMask;
 }
 
+void CommandBuffer::SetEvent(VkEvent Event, VkPipelineStageFlags StageMask)
+{
+    EndRenderScope();
+    // Barriers recorded before the event must execute before it is signaled
+    FlushBarriers();
+
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    VERIFY_EXPR((StageMask & m_Barrier.SupportedStagesMask) != 0);
+    vkCmdSetEvent(m_VkCmdBuffer, Event, StageMask & m_Barrier.SupportedStagesMask);
+}
+
+void CommandBuffer::WaitEventImageLayout(VkEvent                        Event,
+                                         VkImage                        Image,
+                                         VkImageLayout                  OldLayout,
+                                         VkImageLayout                  NewLayout,
+                                         const VkImageSubresourceRange& SubresRange,
+                                         VkPipelineStageFlags           SrcStages,
+                                         VkPipelineStageFlags           DstStages)
+{
+    EndRenderScope();
+    FlushBarriers();
+
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    VERIFY_EXPR((SrcStages & m_Barrier.SupportedStagesMask) != 0);
+    VERIFY_EXPR((DstStages & m_Barrier.SupportedStagesMask) != 0);
+
+    VkImageMemoryBarrier ImgBarrier{};
+    ImgBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    ImgBarrier.pNext               = nullptr;
+    ImgBarrier.oldLayout           = OldLayout;
+    ImgBarrier.newLayout           = NewLayout;
+    ImgBarrier.image               = Image;
+    ImgBarrier.subresourceRange    = SubresRange;
+    ImgBarrier.srcAccessMask       = AccessMaskFromImageLayout(OldLayout, false) & m_Barrier.SupportedAccessMask;
+    ImgBarrier.dstAccessMask       = AccessMaskFromImageLayout(NewLayout, true) & m_Barrier.SupportedAccessMask;
+    ImgBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    ImgBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+
+    vkCmdWaitEvents(m_VkCmdBuffer,
+                    1,
+                    &Event,
+                    SrcStages & m_Barrier.SupportedStagesMask,
+                    DstStages & m_Barrier.SupportedStagesMask,
+                    0,
+                    nullptr,
+                    0,
+                    nullptr,
+                    1,
+                    &ImgBarrier);
+
+    if (m_pBarrierBatchCounter != nullptr)
+        ++(*m_pBarrierBatchCounter);
+}
+
+void CommandBuffer::WaitEventMemoryBarrier(VkEvent              Event,
+                                           VkAccessFlags        srcAccessMask,
+                                           VkAccessFlags        dstAccessMask,
+                                           VkPipelineStageFlags SrcStages,
+                                           VkPipelineStageFlags DstStages)
+{
+    EndRenderScope();
+    FlushBarriers();
+
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    VERIFY_EXPR((SrcStages & m_Barrier.SupportedStagesMask) != 0);
+    VERIFY_EXPR((DstStages & m_Barrier.SupportedStagesMask) != 0);
+
+    VkMemoryBarrier vkMemBarrier{};
+    vkMemBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    vkMemBarrier.pNext         = nullptr;
+    vkMemBarrier.srcAccessMask = srcAccessMask & m_Barrier.SupportedAccessMask;
+    vkMemBarrier.dstAccessMask = dstAccessMask & m_Barrier.SupportedAccessMask;
+
+    const bool HasMemoryBarrier = vkMemBarrier.srcAccessMask != 0 && vkMemBarrier.dstAccessMask != 0;
+
+    vkCmdWaitEvents(m_VkCmdBuffer,
+                    1,
+                    &Event,
+                    SrcStages & m_Barrier.SupportedStagesMask,
+                    DstStages & m_Barrier.SupportedStagesMask,
+                    HasMemoryBarrier ? 1 : 0,
+                    HasMemoryBarrier ? &vkMemBarrier : nullptr,
+                    0,
+                    nullptr,
+                    0,
+                    nullptr);
+
+    if (m_pBarrierBatchCounter != nullptr)
+        ++(*m_pBarrierBatchCounter);
+}
+
 void CommandBuffer::FlushBarriers()
 {
     if (m_Barrier.MemorySrcStages == 0 && m_Barrier.MemoryDstStages == 0 && m_ImageBarriers.empty())
@@ -260,16 +351,26 @@ void CommandBuffer::FlushBarriers()
     const VkPipelineStageFlags DstStages = (m_Barrier.ImageDstStages | m_Barrier.MemoryDstStages) & m_Barrier.SupportedStagesMask;
     VERIFY_EXPR(SrcStages != 0 && DstStages != 0);
 
-    vkCmdPipelineBarrier(m_VkCmdBuffer,
-                         SrcStages,
-                         DstStages,
-                         0,
-                         HasMemoryBarrier ? 1 : 0,
-                         HasMemoryBarrier ? &vkMemBarrier : nullptr,
-                         0,
-                         nullptr,
-                         static_cast<uint32_t>(m_ImageBarriers.size()),
-                         m_ImageBarriers.empty() ? nullptr : m_ImageBarriers.data());
+    if (m_UseSynchronization2)
+    {
+        FlushBarriers2(SrcStages, DstStages, HasMemoryBarrier ? &vkMemBarrier : nullptr);
+    }
+    else
+    {
+        vkCmdPipelineBarrier(m_VkCmdBuffer,
+                             SrcStages,
+                             DstStages,
+                             0,
+                             HasMemoryBarrier ? 1 : 0,
+                             HasMemoryBarrier ? &vkMemBarrier : nullptr,
+                             0,
+                             nullptr,
+                             static_cast<uint32_t>(m_ImageBarriers.size()),
+                             m_ImageBarriers.empty() ? nullptr : m_ImageBarriers.data());
+    }
+
+    if (m_pBarrierBatchCounter != nullptr)
+        ++(*m_pBarrierBatchCounter);
 
     m_ImageBarriers.clear();
     m_Barrier.ImageSrcStages  = 0;
@@ -281,4 +382,55 @@ void CommandBuffer::FlushBarriers()
     // Do not clear SupportedStagesMask and SupportedAccessMask
 }
 
+void CommandBuffer::FlushBarriers2(VkPipelineStageFlags SrcStages, VkPipelineStageFlags DstStages, const VkMemoryBarrier* pMemBarrier)
+{
+#if DILIGENT_USE_VOLK
+    // Legacy stage and access flags have the same values as the corresponding synchronization2 flags.
+    // As with vkCmdPipelineBarrier, all barriers in the batch use the merged stage masks.
+    // If there are no image barriers, a memory barrier without access masks is used to
+    // define the execution dependency.
+    const bool HasMemBarrier2 = pMemBarrier != nullptr || m_ImageBarriers.empty();
+
+    VkMemoryBarrier2KHR vkMemBarrier2{};
+    vkMemBarrier2.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+    vkMemBarrier2.srcStageMask  = SrcStages;
+    vkMemBarrier2.srcAccessMask = pMemBarrier != nullptr ? pMemBarrier->srcAccessMask : 0;
+    vkMemBarrier2.dstStageMask  = DstStages;
+    vkMemBarrier2.dstAccessMask = pMemBarrier != nullptr ? pMemBarrier->dstAccessMask : 0;
+
+    m_ImageBarriers2.resize(m_ImageBarriers.size());
+    for (size_t i = 0; i < m_ImageBarriers.size(); ++i)
+    {
+        const VkImageMemoryBarrier& Src = m_ImageBarriers[i];
+        VkImageMemoryBarrier2KHR&   Dst = m_ImageBarriers2[i];
+
+        Dst.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+        Dst.pNext               = nullptr;
+        Dst.srcStageMask        = SrcStages;
+        Dst.srcAccessMask       = Src.srcAccessMask;
+        Dst.dstStageMask        = DstStages;
+        Dst.dstAccessMask       = Src.dstAccessMask;
+        Dst.oldLayout           = Src.oldLayout;
+        Dst.newLayout           = Src.newLayout;
+        Dst.srcQueueFamilyIndex = Src.srcQueueFamilyIndex;
+        Dst.dstQueueFamilyIndex = Src.dstQueueFamilyIndex;
+        Dst.image               = Src.image;
+        Dst.subresourceRange    = Src.subresourceRange;
+    }
+
+    VkDependencyInfoKHR DependencyInfo{};
+    DependencyInfo.sType                   = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+    DependencyInfo.memoryBarrierCount      = HasMemBarrier2 ? 1 : 0;
+    DependencyInfo.pMemoryBarriers         = HasMemBarrier2 ? &vkMemBarrier2 : nullptr;
+    DependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(m_ImageBarriers2.size());
+    DependencyInfo.pImageMemoryBarriers    = m_ImageBarriers2.empty() ? nullptr : m_ImageBarriers2.data();
+    vkCmdPipelineBarrier2KHR(m_VkCmdBuffer, &DependencyInfo);
+#else
+    (void)SrcStages;
+    (void)DstStages;
+    (void)pMemBarrier;
+    UNSUPPORTED("vkCmdPipelineBarrier2KHR is only available through Volk");
+#endif
+}
+
 } // namespace VulkanUtilities
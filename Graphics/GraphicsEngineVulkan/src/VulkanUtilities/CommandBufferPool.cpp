@@ -40,7 +40,9 @@ CommandBufferPool::CommandBufferPool(std::shared_ptr<const LogicalDevice> Device
                                      VkCommandPoolCreateFlags             flags) :
     m_Device{std::move(Device)},
     m_SupportedStagesMask{m_Device->GetSupportedStagesMask(queueFamilyIndex)},
-    m_SupportedAccessMask{m_Device->GetSupportedAccessMask(queueFamilyIndex)}
+    m_SupportedAccessMask{m_Device->GetSupportedAccessMask(queueFamilyIndex)},
+    m_QueueFamilyIndex{queueFamilyIndex},
+    m_ResetAsWhole{(flags & VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT) == 0}
 {
     VkCommandPoolCreateInfo CmdPoolCI{};
     CmdPoolCI.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
@@ -66,10 +68,18 @@ CommandBufferPool::~CommandBufferPool()
     m_CmdPool.Release();
 }
 
-VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName)
+VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName, VkCommandBufferUsageFlags UsageFlags)
 {
     VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
 
+    if (m_ResetAsWhole)
+    {
+        // All buffers in m_CmdBuffers have been reset by ResetPool(), and only
+        // this thread accesses the list.
+        if (m_NumUsedCmdBuffers < m_CmdBuffers.size())
+            CmdBuffer = m_CmdBuffers[m_NumUsedCmdBuffers];
+    }
+    else
     {
         std::lock_guard<std::mutex> Lock{m_Mutex};
 
@@ -100,16 +110,26 @@ VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName)
 
         CmdBuffer = m_Device->AllocateVkCommandBuffer(BuffAllocInfo);
         DEV_CHECK_ERR(CmdBuffer != VK_NULL_HANDLE, "Failed to allocate vulkan command buffer");
+
+        // In reset-as-whole mode, the pool keeps all allocated buffers
+        if (m_ResetAsWhole)
+            m_CmdBuffers.push_back(CmdBuffer);
+    }
+
+    if (m_ResetAsWhole)
+    {
+        ++m_NumUsedCmdBuffers;
+        m_NumPendingCmdBuffers.fetch_add(1);
     }
 
     VkCommandBufferBeginInfo CmdBuffBeginInfo = {};
 
     CmdBuffBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     CmdBuffBeginInfo.pNext = nullptr;
-    CmdBuffBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; // Each recording of the command buffer will only be
-                                                                          // submitted once, and the command buffer will be reset
-                                                                          // and recorded again between each submission.
-    CmdBuffBeginInfo.pInheritanceInfo = nullptr;                          // Ignored for a primary command buffer
+    CmdBuffBeginInfo.flags = UsageFlags; // VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT means that each recording of the command buffer
+                                         // will only be submitted once, and the command buffer will be reset
+                                         // and recorded again between each submission.
+    CmdBuffBeginInfo.pInheritanceInfo = nullptr; // Ignored for a primary command buffer
 
     VkResult err = vkBeginCommandBuffer(CmdBuffer, &CmdBuffBeginInfo);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to begin command buffer");
@@ -122,12 +142,38 @@ VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName)
 
 void CommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
-    m_CmdBuffers.emplace_back(CmdBuffer);
+    if (m_ResetAsWhole)
+    {
+        // The buffer is reset along with all other buffers by ResetPool()
+        VERIFY(m_NumPendingCmdBuffers.load() > 0, "There are no pending command buffers");
+        m_NumPendingCmdBuffers.fetch_sub(1);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        m_CmdBuffers.emplace_back(CmdBuffer);
+    }
     CmdBuffer = VK_NULL_HANDLE;
 #ifdef DILIGENT_DEVELOPMENT
     --m_BuffCounter;
 #endif
 }
 
+bool CommandBufferPool::ResetPool()
+{
+    VERIFY(m_ResetAsWhole, "Command pools created with VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT flag recycle command buffers individually");
+    if (m_NumPendingCmdBuffers.load() != 0)
+        return false;
+
+    if (m_NumUsedCmdBuffers != 0)
+    {
+        VkResult err = vkResetCommandPool(m_Device->GetVkDevice(), m_CmdPool, 0);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command pool");
+        (void)err;
+        m_NumUsedCmdBuffers = 0;
+    }
+
+    return true;
+}
+
 } // namespace VulkanUtilities
@@ -471,6 +471,16 @@ void SetPipelineCacheName(VkDevice device, VkPipelineCache pipeCache, const char
     SetObjectName(device, (uint64_t)pipeCache, VK_OBJECT_TYPE_PIPELINE_CACHE, name);
 }
 
+void SetDescriptorUpdateTemplateName(VkDevice device, VkDescriptorUpdateTemplate descrUpdateTemplate, const char* name)
+{
+    SetObjectName(device, (uint64_t)descrUpdateTemplate, VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE, name);
+}
+
+void SetShaderObjectName(VkDevice device, VkShaderEXT shaderObject, const char* name)
+{
+    SetObjectName(device, (uint64_t)shaderObject, VK_OBJECT_TYPE_SHADER_EXT, name);
+}
+
 
 template <>
 void SetVulkanObjectName<VkCommandPool, VulkanHandleTypeId::CommandPool>(VkDevice device, VkCommandPool cmdPool, const char* name)
@@ -610,6 +620,18 @@ void SetVulkanObjectName<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(VkD
     SetPipelineCacheName(device, pipeCache, name);
 }
 
+template <>
+void SetVulkanObjectName<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(VkDevice device, VkDescriptorUpdateTemplate descrUpdateTemplate, const char* name)
+{
+    SetDescriptorUpdateTemplateName(device, descrUpdateTemplate, name);
+}
+
+template <>
+void SetVulkanObjectName<VkShaderEXT, VulkanHandleTypeId::ShaderEXT>(VkDevice device, VkShaderEXT shaderObject, const char* name)
+{
+    SetShaderObjectName(device, shaderObject, name);
+}
+
 
 const char* VkResultToString(VkResult errorCode)
 {
@@ -26,6 +26,7 @@
  */
 
 #include <limits>
+#include <vector>
 #include "VulkanErrors.hpp"
 #include "VulkanUtilities/LogicalDevice.hpp"
 #include "VulkanUtilities/Debug.hpp"
@@ -360,12 +361,18 @@ SemaphoreWrapper LogicalDevice::CreateSemaphore(const VkSemaphoreCreateInfo& Sem
     return CreateVulkanObject<VkSemaphore, VulkanHandleTypeId::Semaphore>(vkCreateSemaphore, SemaphoreCI, DebugName, "semaphore");
 }
 
-SemaphoreWrapper LogicalDevice::CreateTimelineSemaphore(uint64_t InitialValue, const char* DebugName) const
+SemaphoreWrapper LogicalDevice::CreateTimelineSemaphore(uint64_t InitialValue, const char* DebugName, bool Exportable) const
 {
     VERIFY_EXPR(m_EnabledExtFeatures.TimelineSemaphore.timelineSemaphore == VK_TRUE);
+    VERIFY_EXPR(!Exportable || m_EnabledExtFeatures.ExternalMemory);
+
+    VkExportSemaphoreCreateInfo ExportCI{};
+    ExportCI.sType       = VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO;
+    ExportCI.handleTypes = ExternalSemaphoreHandleType;
 
     VkSemaphoreTypeCreateInfo TimelineCI{};
     TimelineCI.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    TimelineCI.pNext         = Exportable ? &ExportCI : nullptr;
     TimelineCI.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
     TimelineCI.initialValue  = InitialValue;
 
@@ -382,6 +389,12 @@ QueryPoolWrapper LogicalDevice::CreateQueryPool(const VkQueryPoolCreateInfo& Que
     return CreateVulkanObject<VkQueryPool, VulkanHandleTypeId::QueryPool>(vkCreateQueryPool, QueryPoolCI, DebugName, "query pool");
 }
 
+EventWrapper LogicalDevice::CreateEvent(const VkEventCreateInfo& EventCI, const char* DebugName) const
+{
+    VERIFY_EXPR(EventCI.sType == VK_STRUCTURE_TYPE_EVENT_CREATE_INFO);
+    return CreateVulkanObject<VkEvent, VulkanHandleTypeId::Event>(vkCreateEvent, EventCI, DebugName, "event");
+}
+
 AccelStructWrapper LogicalDevice::CreateAccelStruct(const VkAccelerationStructureCreateInfoKHR& CI, const char* DebugName) const
 {
 #if DILIGENT_USE_VOLK
@@ -438,6 +451,46 @@ PipelineCacheWrapper LogicalDevice::CreatePipelineCache(const VkPipelineCacheCre
     return CreateVulkanObject<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(vkCreatePipelineCache, CI, DebugName, "pipeline cache");
 }
 
+DescrUpdateTemplateWrapper LogicalDevice::CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& TemplateCI, const char* DebugName) const
+{
+    VERIFY_EXPR(TemplateCI.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO);
+    return CreateVulkanObject<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(vkCreateDescriptorUpdateTemplate, TemplateCI, DebugName, "descriptor update template");
+}
+
+void LogicalDevice::CreateShaderObjects(uint32_t Count, const VkShaderCreateInfoEXT* pShaderCIs, ShaderObjectWrapper* pShaders, const char* DebugName) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(Count > 0 && pShaderCIs != nullptr && pShaders != nullptr);
+
+    if (DebugName == nullptr)
+        DebugName = "";
+
+    std::vector<VkShaderEXT> vkShaders(Count, VK_NULL_HANDLE);
+
+    VkResult err = vkCreateShadersEXT(m_VkDevice, Count, pShaderCIs, m_VkAllocator, vkShaders.data());
+    if (err != VK_SUCCESS)
+    {
+        // Shaders that were successfully created must still be destroyed
+        for (VkShaderEXT vkShader : vkShaders)
+        {
+            if (vkShader != VK_NULL_HANDLE)
+                vkDestroyShaderEXT(m_VkDevice, vkShader, m_VkAllocator);
+        }
+    }
+    CHECK_VK_ERROR_AND_THROW(err, "Failed to create shader objects '", DebugName, '\'');
+
+    for (uint32_t i = 0; i < Count; ++i)
+    {
+        VERIFY_EXPR(pShaderCIs[i].sType == VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT);
+        if (*DebugName != 0)
+            SetVulkanObjectName<VkShaderEXT, VulkanHandleTypeId::ShaderEXT>(m_VkDevice, vkShaders[i], DebugName);
+        pShaders[i] = ShaderObjectWrapper{GetSharedPtr(), std::move(vkShaders[i])};
+    }
+#else
+    UNSUPPORTED("vkCreateShadersEXT is only available through Volk");
+#endif
+}
+
 void LogicalDevice::ReleaseVulkanObject(CommandPoolWrapper&& CmdPool) const
 {
     vkDestroyCommandPool(m_VkDevice, CmdPool.m_VkObject, m_VkAllocator);
@@ -540,6 +593,12 @@ void LogicalDevice::ReleaseVulkanObject(QueryPoolWrapper&& QueryPool) const
     QueryPool.m_VkObject = VK_NULL_HANDLE;
 }
 
+void LogicalDevice::ReleaseVulkanObject(EventWrapper&& Event) const
+{
+    vkDestroyEvent(m_VkDevice, Event.m_VkObject, m_VkAllocator);
+    Event.m_VkObject = VK_NULL_HANDLE;
+}
+
 void LogicalDevice::ReleaseVulkanObject(AccelStructWrapper&& AccelStruct) const
 {
 #if DILIGENT_USE_VOLK
@@ -556,6 +615,22 @@ void LogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipeCache) const
     PipeCache.m_VkObject = VK_NULL_HANDLE;
 }
 
+void LogicalDevice::ReleaseVulkanObject(DescrUpdateTemplateWrapper&& DescrUpdateTemplate) const
+{
+    vkDestroyDescriptorUpdateTemplate(m_VkDevice, DescrUpdateTemplate.m_VkObject, m_VkAllocator);
+    DescrUpdateTemplate.m_VkObject = VK_NULL_HANDLE;
+}
+
+void LogicalDevice::ReleaseVulkanObject(ShaderObjectWrapper&& ShaderObject) const
+{
+#if DILIGENT_USE_VOLK
+    vkDestroyShaderEXT(m_VkDevice, ShaderObject.m_VkObject, m_VkAllocator);
+    ShaderObject.m_VkObject = VK_NULL_HANDLE;
+#else
+    UNSUPPORTED("vkDestroyShaderEXT is only available through Volk");
+#endif
+}
+
 void LogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
 {
     VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
@@ -594,6 +669,32 @@ VkResult LogicalDevice::BindImageMemory(VkImage image, VkDeviceMemory memory, Vk
     return vkBindImageMemory(m_VkDevice, image, memory, memoryOffset);
 }
 
+VkMemoryRequirements LogicalDevice::GetImageMemoryRequirements(VkImage vkImage, bool& UseDedicatedAllocation) const
+{
+    UseDedicatedAllocation = false;
+#if DILIGENT_USE_VOLK
+    if (m_EnabledExtFeatures.DedicatedAllocation)
+    {
+        VkImageMemoryRequirementsInfo2 MemReqsInfo{};
+        MemReqsInfo.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2;
+        MemReqsInfo.image = vkImage;
+
+        VkMemoryDedicatedRequirements DedicatedReqs{};
+        DedicatedReqs.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+
+        VkMemoryRequirements2 MemReqs2{};
+        MemReqs2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+        MemReqs2.pNext = &DedicatedReqs;
+
+        vkGetImageMemoryRequirements2(m_VkDevice, &MemReqsInfo, &MemReqs2);
+
+        UseDedicatedAllocation = DedicatedReqs.prefersDedicatedAllocation != VK_FALSE || DedicatedReqs.requiresDedicatedAllocation != VK_FALSE;
+        return MemReqs2.memoryRequirements;
+    }
+#endif
+    return GetImageMemoryRequirements(vkImage);
+}
+
 VkDeviceAddress LogicalDevice::GetAccelerationStructureDeviceAddress(VkAccelerationStructureKHR AS) const
 {
 #if DILIGENT_USE_VOLK
@@ -618,6 +719,57 @@ void LogicalDevice::GetAccelerationStructureBuildSizes(const VkAccelerationStruc
 #endif
 }
 
+VkDeviceAddress LogicalDevice::GetBufferDeviceAddress(VkBuffer buffer) const
+{
+#if DILIGENT_USE_VOLK
+    VkBufferDeviceAddressInfoKHR BufferInfo = {};
+
+    BufferInfo.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+    BufferInfo.buffer = buffer;
+
+    return vkGetBufferDeviceAddressKHR(m_VkDevice, &BufferInfo);
+#else
+    UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
+    return 0;
+#endif
+}
+
+VkDeviceSize LogicalDevice::GetDescriptorSetLayoutSize(VkDescriptorSetLayout layout) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(m_EnabledExtFeatures.DescriptorBuffer.descriptorBuffer != VK_FALSE);
+    VkDeviceSize Size = 0;
+    vkGetDescriptorSetLayoutSizeEXT(m_VkDevice, layout, &Size);
+    return Size;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutSizeEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+VkDeviceSize LogicalDevice::GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout layout, uint32_t binding) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(m_EnabledExtFeatures.DescriptorBuffer.descriptorBuffer != VK_FALSE);
+    VkDeviceSize Offset = 0;
+    vkGetDescriptorSetLayoutBindingOffsetEXT(m_VkDevice, layout, binding, &Offset);
+    return Offset;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutBindingOffsetEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+void LogicalDevice::GetDescriptor(const VkDescriptorGetInfoEXT& DescriptorInfo, size_t dataSize, void* pDescriptor) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(DescriptorInfo.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT);
+    vkGetDescriptorEXT(m_VkDevice, &DescriptorInfo, dataSize, pDescriptor);
+#else
+    UNSUPPORTED("vkGetDescriptorEXT is only available through Volk");
+#endif
+}
+
 VkResult LogicalDevice::MapMemory(VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) const
 {
     return vkMapMemory(m_VkDevice, memory, offset, size, flags, ppData);
@@ -698,6 +850,13 @@ void LogicalDevice::UpdateDescriptorSets(uint32_t                    descriptorW
     vkUpdateDescriptorSets(m_VkDevice, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
+void LogicalDevice::UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                                    VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                    const void*                pData) const
+{
+    vkUpdateDescriptorSetWithTemplate(m_VkDevice, descriptorSet, descriptorUpdateTemplate, pData);
+}
+
 VkResult LogicalDevice::ResetCommandPool(VkCommandPool           vkCmdPool,
                                          VkCommandPoolResetFlags flags) const
 {
@@ -749,6 +908,77 @@ VkResult LogicalDevice::HostTransitionImageLayout(const VkHostImageLayoutTransit
 #endif
 }
 
+VkResult LogicalDevice::WaitForPresent(VkSwapchainKHR vkSwapchain, uint64_t PresentId, uint64_t Timeout) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(m_EnabledExtFeatures.PresentWait.presentWait != VK_FALSE);
+    return vkWaitForPresentKHR(m_VkDevice, vkSwapchain, PresentId, Timeout);
+#else
+    UNSUPPORTED("Present wait is not supported when vulkan library is linked statically");
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+#endif
+}
+
+VkResult LogicalDevice::GetMemoryHandle(VkDeviceMemory vkMemory, uint64_t& Handle) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(m_EnabledExtFeatures.ExternalMemory);
+#    if defined(VK_USE_PLATFORM_WIN32_KHR)
+    VkMemoryGetWin32HandleInfoKHR HandleInfo{};
+    HandleInfo.sType      = VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR;
+    HandleInfo.memory     = vkMemory;
+    HandleInfo.handleType = ExternalMemoryHandleType;
+
+    HANDLE   hMemory = NULL;
+    VkResult err     = vkGetMemoryWin32HandleKHR(m_VkDevice, &HandleInfo, &hMemory);
+    Handle           = reinterpret_cast<uint64_t>(hMemory);
+#    else
+    VkMemoryGetFdInfoKHR FdInfo{};
+    FdInfo.sType      = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+    FdInfo.memory     = vkMemory;
+    FdInfo.handleType = ExternalMemoryHandleType;
+
+    int      Fd  = -1;
+    VkResult err = vkGetMemoryFdKHR(m_VkDevice, &FdInfo, &Fd);
+    Handle       = static_cast<uint64_t>(Fd);
+#    endif
+    return err;
+#else
+    UNSUPPORTED("External memory is not supported when vulkan library is linked statically");
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+#endif
+}
+
+VkResult LogicalDevice::GetSemaphoreHandle(VkSemaphore vkSemaphore, uint64_t& Handle) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(m_EnabledExtFeatures.ExternalMemory);
+#    if defined(VK_USE_PLATFORM_WIN32_KHR)
+    VkSemaphoreGetWin32HandleInfoKHR HandleInfo{};
+    HandleInfo.sType      = VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR;
+    HandleInfo.semaphore  = vkSemaphore;
+    HandleInfo.handleType = ExternalSemaphoreHandleType;
+
+    HANDLE   hSemaphore = NULL;
+    VkResult err        = vkGetSemaphoreWin32HandleKHR(m_VkDevice, &HandleInfo, &hSemaphore);
+    Handle              = reinterpret_cast<uint64_t>(hSemaphore);
+#    else
+    VkSemaphoreGetFdInfoKHR FdInfo{};
+    FdInfo.sType      = VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR;
+    FdInfo.semaphore  = vkSemaphore;
+    FdInfo.handleType = ExternalSemaphoreHandleType;
+
+    int      Fd  = -1;
+    VkResult err = vkGetSemaphoreFdKHR(m_VkDevice, &FdInfo, &Fd);
+    Handle       = static_cast<uint64_t>(Fd);
+#    endif
+    return err;
+#else
+    UNSUPPORTED("External semaphores are not supported when vulkan library is linked statically");
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+#endif
+}
+
 VkResult LogicalDevice::GetRayTracingShaderGroupHandles(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const
 {
 #if DILIGENT_USE_VOLK
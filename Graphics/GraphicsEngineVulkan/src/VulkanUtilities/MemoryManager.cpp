@@ -44,16 +44,30 @@ MemoryPage::MemoryPage(MemoryManager&        ParentMemoryMgr,
                        VkDeviceSize          PageSize,
                        uint32_t              MemoryTypeIndex,
                        bool                  IsHostVisible,
-                       VkMemoryAllocateFlags AllocateFlags) :
+                       VkMemoryAllocateFlags AllocateFlags,
+                       VkDeviceSize          SlabBlockSize) :
     // clang-format off
     m_ParentMemoryMgr{ParentMemoryMgr},
-    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
+    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator},
+    m_SlabBlockSize  {SlabBlockSize},
+    m_NumSlabBlocks  {SlabBlockSize != 0 ? static_cast<size_t>(PageSize / SlabBlockSize) : 0}
 // clang-format on
 {
     VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "PageSize (", PageSize, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
 
+    if (m_SlabBlockSize != 0)
+    {
+        VERIFY(Diligent::IsPowerOfTwo(m_SlabBlockSize), "Slab block size must be a power of two");
+        VERIFY(PageSize % m_SlabBlockSize == 0, "Page size must be a multiple of the slab block size");
+        // Blocks are allocated from the back of the list. Store them in reverse order
+        // so that they are used from the start of the page.
+        m_FreeSlabBlocks.resize(m_NumSlabBlocks);
+        for (size_t i = 0; i < m_NumSlabBlocks; ++i)
+            m_FreeSlabBlocks[i] = static_cast<uint32_t>(m_NumSlabBlocks - 1 - i);
+    }
+
     VkMemoryAllocateInfo      MemAlloc    = {};
     VkMemoryAllocateFlagsInfo MemFlagInfo = {};
 
@@ -99,6 +113,19 @@ MemoryPage::~MemoryPage()
 MemoryAllocation MemoryPage::Allocate(VkDeviceSize size, VkDeviceSize alignment)
 {
     std::lock_guard<std::mutex> Lock{m_Mutex};
+    if (m_SlabBlockSize != 0)
+    {
+        // Device memory is always aligned to at least the largest slab block size, so
+        // every block is aligned to its size, which is a power of two.
+        VERIFY(size <= m_SlabBlockSize && alignment <= m_SlabBlockSize, "The allocation does not fit into the slab block");
+        if (m_FreeSlabBlocks.empty())
+            return MemoryAllocation{};
+
+        const uint32_t BlockIdx = m_FreeSlabBlocks.back();
+        m_FreeSlabBlocks.pop_back();
+        return MemoryAllocation{this, BlockIdx * m_SlabBlockSize, m_SlabBlockSize};
+    }
+
     VERIFY(size <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "Allocation size (", size, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
@@ -121,6 +148,14 @@ void MemoryPage::Free(MemoryAllocation&& Allocation)
 {
     m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size, m_CPUMemory != nullptr);
     std::lock_guard<std::mutex> Lock{m_Mutex};
+    if (m_SlabBlockSize != 0)
+    {
+        VERIFY_EXPR(Allocation.Size == m_SlabBlockSize && Allocation.UnalignedOffset % m_SlabBlockSize == 0);
+        m_FreeSlabBlocks.push_back(static_cast<uint32_t>(Allocation.UnalignedOffset / m_SlabBlockSize));
+        VERIFY_EXPR(m_FreeSlabBlocks.size() <= m_NumSlabBlocks);
+        Allocation = MemoryAllocation{};
+        return;
+    }
     VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
@@ -159,10 +194,20 @@ MemoryAllocation MemoryManager::Allocate(const VkMemoryRequirements& MemReqs, Vk
     return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags);
 }
 
-MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags)
+MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, bool AllowSlab)
 {
     MemoryAllocation Allocation;
 
+    // Small allocations are rounded up to the power-of-two block size and suballocated from slab pages
+    // that only contain blocks of this size. This is considerably cheaper than the variable-size
+    // allocations manager when there are many thousands of small buffers.
+    VkDeviceSize SlabBlockSize = 0;
+    if (AllowSlab && Size <= MaxSlabBlockSize && Alignment <= MaxSlabBlockSize)
+    {
+        SlabBlockSize = std::max(VkDeviceSize{MinSlabBlockSize}, Diligent::AlignUpToPowerOfTwo(std::max(Size, Alignment)));
+        VERIFY_EXPR(SlabBlockSize <= MaxSlabBlockSize);
+    }
+
     // On integrated GPUs, there is no difference between host-visible and GPU-only
     // memory, so MemoryTypeIndex is the same. As GPU-only pages do not have CPU address,
     // we need to use HostVisible flag to differentiate the two.
@@ -170,7 +215,7 @@ MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignme
     // even though on integrated GPUs same pages can be used for both GPU-only and staging
     // allocations. Staging allocations are short-living and will be released when upload is
     // complete, while GPU-only allocations are expected to be long-living.
-    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
+    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags, SlabBlockSize};
     std::lock_guard<std::mutex> Lock{m_PagesMtx};
 
     auto range = m_Pages.equal_range(PageIdx);
@@ -185,15 +230,35 @@ MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignme
     if (Allocation.Page == nullptr)
     {
         VkDeviceSize PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+        if (SlabBlockSize != 0)
+        {
+            // Use smaller pages for small blocks so that rarely used block sizes do not waste memory.
+            // 256 blocks of 64KB make up a 16MB page, while the smallest blocks use a 1MB page.
+            PageSize = std::min(std::max(SlabBlockSize * 256, VkDeviceSize{1} << 20), std::max(PageSize, SlabBlockSize));
+            PageSize = Diligent::AlignUp(PageSize, SlabBlockSize);
+        }
         while (PageSize < Size)
             PageSize *= 2;
 
+        const uint32_t HeapIndex = m_PhysicalDevice.GetMemoryProperties().memoryTypes[MemoryTypeIndex].heapIndex;
+        if (!IsWithinBudget(HeapIndex, PageSize))
+        {
+            // Release free pages that are kept in reserve and check the budget again
+            ReleaseFreePages(HeapIndex);
+            if (!IsWithinBudget(HeapIndex, PageSize))
+            {
+                LOG_WARNING_MESSAGE("MemoryManager '", m_MgrName, "': allocating new ", Diligent::FormatMemorySize(PageSize, 2),
+                                    " page exceeds ", m_BudgetUsageLimit, "% of the budget of memory heap ", HeapIndex,
+                                    ". This may result in poor performance or out-of-memory errors.");
+            }
+        }
+
         m_CurrAllocatedSize[stat_ind] += PageSize;
         m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
 
-        auto it = m_Pages.emplace(PageIdx, MemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
+        auto it = m_Pages.emplace(PageIdx, MemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags, SlabBlockSize});
         LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
-                         " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
+                         (SlabBlockSize != 0 ? " slab" : ""), " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
                          "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
         OnNewPageCreated(it->second);
         Allocation = it->second.Allocate(Size, Alignment);
@@ -227,18 +292,88 @@ void MemoryManager::ShrinkMemory()
         VkDeviceSize ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
         if (Page.IsEmpty() && m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize)
         {
-            VkDeviceSize PageSize = Page.GetPageSize();
-            m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
-            LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
-                             " page (", Diligent::FormatMemorySize(PageSize, 2),
-                             "). Current allocated size: ",
-                             Diligent::FormatMemorySize(m_CurrAllocatedSize[IsHostVisible ? 1 : 0], 2));
-            OnPageDestroy(Page);
-            m_Pages.erase(curr_it);
+            DestroyPage(curr_it);
         }
     }
 }
 
+void MemoryManager::DestroyPage(PagesMapType::iterator page_it)
+{
+    MemoryPage& Page = page_it->second;
+    VERIFY_EXPR(Page.IsEmpty());
+
+    bool         IsHostVisible = Page.GetCPUMemory() != nullptr;
+    VkDeviceSize PageSize      = Page.GetPageSize();
+    m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
+    LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
+                     " page (", Diligent::FormatMemorySize(PageSize, 2),
+                     "). Current allocated size: ",
+                     Diligent::FormatMemorySize(m_CurrAllocatedSize[IsHostVisible ? 1 : 0], 2));
+    OnPageDestroy(Page);
+    m_Pages.erase(page_it);
+}
+
+void MemoryManager::ReleaseFreePages(uint32_t HeapIndex)
+{
+    const VkPhysicalDeviceMemoryProperties& MemProps = m_PhysicalDevice.GetMemoryProperties();
+
+    auto it = m_Pages.begin();
+    while (it != m_Pages.end())
+    {
+        auto curr_it = it;
+        ++it;
+        if (curr_it->second.IsEmpty() && MemProps.memoryTypes[curr_it->first.MemoryTypeIndex].heapIndex == HeapIndex)
+            DestroyPage(curr_it);
+    }
+}
+
+bool MemoryManager::IsWithinBudget(uint32_t HeapIndex, VkDeviceSize NewPageSize) const
+{
+    if (m_BudgetUsageLimit == 0 || !m_LogicalDevice.GetEnabledExtFeatures().MemoryBudget)
+        return true;
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT Budget{};
+    if (!m_PhysicalDevice.GetMemoryBudget(Budget))
+        return true;
+
+    VERIFY_EXPR(HeapIndex < VK_MAX_MEMORY_HEAPS);
+    const VkDeviceSize MaxUsage = Budget.heapBudget[HeapIndex] / 100 * m_BudgetUsageLimit;
+    return Budget.heapUsage[HeapIndex] + NewPageSize <= MaxUsage;
+}
+
+MemoryManager::HeapUsage MemoryManager::GetHeapUsage(uint32_t HeapIndex) const
+{
+    const VkPhysicalDeviceMemoryProperties& MemProps = m_PhysicalDevice.GetMemoryProperties();
+    VERIFY_EXPR(HeapIndex < MemProps.memoryHeapCount);
+
+    HeapUsage Usage;
+    {
+        std::lock_guard<std::mutex> Lock{m_PagesMtx};
+        for (const auto& it : m_Pages)
+        {
+            if (MemProps.memoryTypes[it.first.MemoryTypeIndex].heapIndex != HeapIndex)
+                continue;
+
+            Usage.AllocatedSize += it.second.GetPageSize();
+            Usage.UsedSize += it.second.GetUsedSize();
+        }
+    }
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT Budget{};
+    if (m_LogicalDevice.GetEnabledExtFeatures().MemoryBudget && m_PhysicalDevice.GetMemoryBudget(Budget))
+    {
+        Usage.Budget = Budget.heapBudget[HeapIndex];
+        Usage.Usage  = Budget.heapUsage[HeapIndex];
+    }
+    else
+    {
+        Usage.Budget = MemProps.memoryHeaps[HeapIndex].size;
+        Usage.Usage  = Usage.AllocatedSize;
+    }
+
+    return Usage;
+}
+
 void MemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible)
 {
     m_CurrUsedSize[IsHostVisible ? 1 : 0].fetch_add(-static_cast<int64_t>(Size));
@@ -194,6 +194,10 @@ PhysicalDevice::PhysicalDevice(const CreateInfo& CI) :
         if (IsExtensionSupported(VK_KHR_SPIRV_1_4_EXTENSION_NAME))
             m_ExtFeatures.Spirv14 = true;
 
+        // VK_KHR_dedicated_allocation and VK_KHR_get_memory_requirements2 were promoted to the Vulkan 1.1 core.
+        if (m_vkVersion >= VK_API_VERSION_1_1)
+            m_ExtFeatures.DedicatedAllocation = true;
+
         // Some features require SPIRV 1.4 or 1.5 which was added to the Vulkan 1.2 core.
         if (m_vkVersion >= VK_API_VERSION_1_2)
         {
@@ -357,6 +361,96 @@ PhysicalDevice::PhysicalDevice(const CreateInfo& CI) :
             m_ExtProperties.HostImageCopy.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT;
         }
 
+        if (IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.DescriptorBuffer;
+            NextFeat  = &m_ExtFeatures.DescriptorBuffer.pNext;
+
+            m_ExtFeatures.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.DescriptorBuffer;
+            NextProp  = &m_ExtProperties.DescriptorBuffer.pNext;
+
+            m_ExtProperties.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_EXT_SHADER_OBJECT_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.ShaderObject;
+            NextFeat  = &m_ExtFeatures.ShaderObject.pNext;
+
+            m_ExtFeatures.ShaderObject.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.Synchronization2;
+            NextFeat  = &m_ExtFeatures.Synchronization2.pNext;
+
+            m_ExtFeatures.Synchronization2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        }
+
+        // VK_EXT_graphics_pipeline_library requires VK_KHR_pipeline_library
+        if (IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) && IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.GraphicsPipelineLibrary;
+            NextFeat  = &m_ExtFeatures.GraphicsPipelineLibrary.pNext;
+
+            m_ExtFeatures.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.GraphicsPipelineLibrary;
+            NextProp  = &m_ExtProperties.GraphicsPipelineLibrary.pNext;
+
+            m_ExtProperties.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.ExtendedDynamicState;
+            NextFeat  = &m_ExtFeatures.ExtendedDynamicState.pNext;
+
+            m_ExtFeatures.ExtendedDynamicState.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+        }
+
+        // VK_KHR_present_wait requires VK_KHR_present_id
+        if (IsExtensionSupported(VK_KHR_PRESENT_ID_EXTENSION_NAME) && IsExtensionSupported(VK_KHR_PRESENT_WAIT_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.PresentId;
+            NextFeat  = &m_ExtFeatures.PresentId.pNext;
+
+            m_ExtFeatures.PresentId.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+
+            *NextFeat = &m_ExtFeatures.PresentWait;
+            NextFeat  = &m_ExtFeatures.PresentWait.pNext;
+
+            m_ExtFeatures.PresentWait.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+        }
+
+        if (IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+        {
+            m_ExtFeatures.PushDescriptor = true;
+
+            *NextProp = &m_ExtProperties.PushDescriptor;
+            NextProp  = &m_ExtProperties.PushDescriptor.pNext;
+
+            m_ExtProperties.PushDescriptor.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+        }
+
+        // Memory budget is queried with vkGetPhysicalDeviceMemoryProperties2 (see GetMemoryBudget)
+        if (IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+            m_ExtFeatures.MemoryBudget = true;
+
+        // Pipeline creation feedback has no feature bits and is always available when the extension is supported
+        if (IsExtensionSupported(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME))
+            m_ExtFeatures.PipelineCreationFeedback = true;
+
+        // VK_KHR_external_memory and VK_KHR_external_semaphore were promoted to the Vulkan 1.1 core,
+        // platform-specific handle extensions are required to export the objects.
+        if (m_vkVersion >= VK_API_VERSION_1_1 &&
+            IsExtensionSupported(ExternalMemoryExtensionName) &&
+            IsExtensionSupported(ExternalSemaphoreExtensionName))
+            m_ExtFeatures.ExternalMemory = true;
+
         // make sure that last pNext is null
         *NextFeat = nullptr;
         *NextProp = nullptr;
@@ -411,6 +505,26 @@ PhysicalDevice::PhysicalDevice(const CreateInfo& CI) :
 #endif // DILIGENT_USE_VOLK
 }
 
+bool PhysicalDevice::GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const
+{
+    Budget = {};
+    if (!m_ExtFeatures.MemoryBudget)
+        return false;
+
+#if DILIGENT_USE_VOLK
+    Budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    VkPhysicalDeviceMemoryProperties2 MemProps2{};
+    MemProps2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    MemProps2.pNext = &Budget;
+    vkGetPhysicalDeviceMemoryProperties2KHR(m_vkDevice, &MemProps2);
+    Budget.pNext = nullptr;
+    return true;
+#else
+    return false;
+#endif
+}
+
 HardwareQueueIndex PhysicalDevice::FindQueueFamily(VkQueueFlags QueueFlags) const
 {
     // All commands that are allowed on a queue that supports transfer operations are also allowed on
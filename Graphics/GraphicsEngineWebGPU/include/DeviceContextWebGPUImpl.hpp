@@ -62,7 +62,7 @@ public:
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DeviceContextWebGPU, TDeviceContextBase)
 
     /// Implementation of IDeviceContext::Begin() in WebGPU backend.
-    void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+    void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::SetPipelineState() in WebGPU backend.
     void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
@@ -80,6 +80,17 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in WebGPU backend.
     void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetCullMode() in WebGPU backend.
+    void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode) override final;
+
+    /// Implementation of IDeviceContext::SetDepthState() in WebGPU backend.
+    void DILIGENT_CALL_TYPE SetDepthState(Bool                DepthEnable,
+                                          Bool                DepthWriteEnable,
+                                          COMPARISON_FUNCTION DepthFunc) override final;
+
+    /// Implementation of IDeviceContext::SetPrimitiveTopology() in WebGPU backend.
+    void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in WebGPU backend.
     void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                              Uint32                         NumBuffersSet,
@@ -132,6 +143,9 @@ public:
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in WebGPU backend.
     void DILIGENT_CALL_TYPE DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs) override final;
 
+    /// Implementation of IDeviceContext::ExecuteIndirectCommands() in WebGPU backend.
+    void DILIGENT_CALL_TYPE ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs) override final;
+
     /// Implementation of IDeviceContext::DrawMesh() in WebGPU backend.
     void DILIGENT_CALL_TYPE DrawMesh(const DrawMeshAttribs& Attribs) override final;
 
@@ -162,6 +176,9 @@ public:
                                               const void*                    RGBA,
                                               RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateRenderTargets() in WebGPU backend.
+    void DILIGENT_CALL_TYPE InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in WebGPU backend.
     void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                          Uint64                         Offset,
@@ -233,6 +250,15 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in WebGPU backend.
     void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::BeginPoolQuery() in WebGPU backend.
+    void DILIGENT_CALL_TYPE BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::EndPoolQuery() in WebGPU backend.
+    void DILIGENT_CALL_TYPE EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index) override final;
+
+    /// Implementation of IDeviceContext::ResolvePoolQueries() in WebGPU backend.
+    void DILIGENT_CALL_TYPE ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs) override final;
+
     /// Implementation of IDeviceContext::Flush() in WebGPU backend.
     void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -281,7 +307,7 @@ public:
     void DILIGENT_CALL_TYPE BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs) override final;
 
     /// Implementation of IDeviceContext::GenerateMips() in WebGPU backend.
-    void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView) override final;
+    void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::FinishFrame() in WebGPU backend.
     void DILIGENT_CALL_TYPE FinishFrame() override final;
@@ -536,6 +562,36 @@ private:
         Uint32 Flags = 0;
     } m_PendingClears;
 
+    // Attachments of the render pass started by CommitRenderTargets(). The references keep the views
+    // alive while the pass is open so that a view allocated at the same address cannot be mistaken
+    // for an attachment of the open pass.
+    struct RenderPassAttachments
+    {
+        bool Matches(Uint32 NumRTVs, ITextureView* const ppRTVs[], ITextureView* pDSV) const
+        {
+            if (NumRTVs != NumRenderTargets || pDSV != pDepthStencil)
+                return false;
+            for (Uint32 RTIndex = 0; RTIndex < NumRTVs; ++RTIndex)
+            {
+                if (ppRTVs[RTIndex] != pRenderTargets[RTIndex])
+                    return false;
+            }
+            return true;
+        }
+
+        void Clear()
+        {
+            for (Uint32 RTIndex = 0; RTIndex < NumRenderTargets; ++RTIndex)
+                pRenderTargets[RTIndex].Release();
+            pDepthStencil.Release();
+            NumRenderTargets = 0;
+        }
+
+        std::array<RefCntAutoPtr<TextureViewWebGPUImpl>, MAX_RENDER_TARGETS> pRenderTargets;
+        RefCntAutoPtr<TextureViewWebGPUImpl>                                 pDepthStencil;
+        Uint32                                                               NumRenderTargets = 0;
+    } m_RenderPassAttachments;
+
     struct PendingQuery
     {
         QueryWebGPUImpl* const pQuery;
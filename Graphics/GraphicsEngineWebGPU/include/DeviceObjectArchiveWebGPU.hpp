@@ -48,6 +48,43 @@ struct PRSSerializerWebGPU : PRSSerializer<Mode>
                                       DynamicLinearAllocator*      Allocator);
 };
 
+/// WGSL shader data stored in the device object archive.
+
+/// Along with the WGSL source, the archive keeps the shader resource reflection produced
+/// offline by the archiver, so that the shader can be created without parsing WGSL.
+/// The data is stored in ShaderCreateInfo::ByteCode with the WGSL source language.
+struct WGSLShaderArchiveData
+{
+    struct Resource
+    {
+        const char* Name             = nullptr;
+        Uint32      BufferStaticSize = 0;
+        Uint16      ArraySize        = 1;
+        Uint16      BindGroup        = 0;
+        Uint16      BindIndex        = 0;
+        Uint16      Format           = 0; // TEXTURE_FORMAT
+        Uint8       Type             = 0; // WGSLShaderResourceAttribs::ResourceType
+        Uint8       ResourceDim      = 0; // RESOURCE_DIMENSION
+        Uint8       SampleType       = 0; // WGSLShaderResourceAttribs::TextureSampleType
+    };
+
+    const char*     WGSL         = nullptr;
+    const char*     EntryPoint   = nullptr;
+    const Resource* pResources   = nullptr;
+    Uint32          NumResources = 0;
+};
+
+template <SerializerMode Mode>
+struct ShaderSerializerWebGPU
+{
+    template <typename T>
+    using ConstQual = typename Serializer<Mode>::template ConstQual<T>;
+
+    static bool SerializeArchiveData(Serializer<Mode>&                 Ser,
+                                     ConstQual<WGSLShaderArchiveData>& Data,
+                                     DynamicLinearAllocator*           Allocator);
+};
+
 DECL_TRIVIALLY_SERIALIZABLE(PipelineResourceAttribsWebGPU);
 DECL_TRIVIALLY_SERIALIZABLE(ImmutableSamplerAttribsWebGPU);
 
@@ -85,6 +85,12 @@ public:
         ShaderWebGPUImpl* const pShader;
         std::string             PatchedWGSL;
 
+        // Shader module used to create the pipeline, see InitShaderModules()
+        WGPUShaderModule wgpuShaderModule = nullptr;
+
+        // Shader module created from the patched WGSL, if any
+        WebGPUShaderModuleWrapper wgpuPatchedShaderModule;
+
         ShaderStageInfo(ShaderWebGPUImpl* _pShader) :
             Type{_pShader->GetDesc().ShaderType},
             pShader{_pShader}
@@ -139,6 +145,9 @@ private:
     void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo);
     void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
 
+    // Creates WebGPU shader modules for all stages ahead of the pipeline creation
+    void InitShaderModules(TShaderStages& ShaderStages);
+
     struct AsyncPipelineBuilder;
 
     void InitializeWebGPURenderPipeline(const TShaderStages&  ShaderStages,
@@ -30,6 +30,7 @@
 /// Declaration of Diligent::RenderDeviceWebGPUImpl class
 
 #include <memory>
+#include <thread>
 
 #include "EngineWebGPUImplTraits.hpp"
 #include "RenderDeviceBase.hpp"
@@ -108,6 +109,13 @@ public:
     void DILIGENT_CALL_TYPE CreateQuery(const QueryDesc& Desc,
                                         IQuery**         ppQuery) override final;
 
+    /// Implementation of IRenderDevice::CreateQueryPool() in WebGPU backend.
+    void DILIGENT_CALL_TYPE CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool) override final;
+
+    /// Implementation of IRenderDevice::CreateIndirectCommandSignature() in WebGPU backend.
+    void DILIGENT_CALL_TYPE CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc,
+                                                           IIndirectCommandSignature**         ppSignature) override final;
+
     /// Implementation of IRenderDevice::CreateRenderPass() in WebGPU backend.
     void DILIGENT_CALL_TYPE CreateRenderPass(const RenderPassDesc& Desc,
                                              IRenderPass**         ppRenderPass) override final;
@@ -136,6 +144,18 @@ public:
     void DILIGENT_CALL_TYPE CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
                                                IDeviceMemory**               ppMemory) override final;
 
+    /// Implementation of IRenderDevice::CreatePlacedTexture() in WebGPU backend.
+    void DILIGENT_CALL_TYPE CreatePlacedTexture(const TextureDesc& TexDesc,
+                                                IDeviceMemory*     pMemory,
+                                                Uint64             MemoryOffset,
+                                                ITexture**         ppTexture) override final;
+
+    /// Implementation of IRenderDevice::CreatePlacedBuffer() in WebGPU backend.
+    void DILIGENT_CALL_TYPE CreatePlacedBuffer(const BufferDesc& BuffDesc,
+                                               IDeviceMemory*    pMemory,
+                                               Uint64            MemoryOffset,
+                                               IBuffer**         ppBuffer) override final;
+
     /// Implementation of IRenderDevice::CreatePipelineStateCache() in WebGPU backend.
     void DILIGENT_CALL_TYPE CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                      IPipelineStateCache**               ppPSOCache) override final;
@@ -154,6 +174,12 @@ public:
                                                                           RESOURCE_DIMENSION Dimension,
                                                                           Uint32             SampleCount) const override final;
 
+    /// Implementation of IRenderDevice::GetTextureMemoryRequirements() in WebGPU backend.
+    ResourceMemoryRequirements DILIGENT_CALL_TYPE GetTextureMemoryRequirements(const TextureDesc& TexDesc) const override final;
+
+    /// Implementation of IRenderDevice::GetBufferMemoryRequirements() in WebGPU backend.
+    ResourceMemoryRequirements DILIGENT_CALL_TYPE GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const override final;
+
     /// Implementation of IRenderDeviceWebGPU::GetWebGPUInstance() in WebGPU backend.
     WGPUInstance DILIGENT_CALL_TYPE GetWebGPUInstance() const override final;
 
@@ -239,6 +265,12 @@ private:
     std::unique_ptr<AttachmentCleanerWebGPU>  m_pAttachmentCleaner;
     std::unique_ptr<GenerateMipsHelperWebGPU> m_pMipsGenerator;
     std::unique_ptr<QueryManagerWebGPU>       m_pQueryManager;
+
+#if PLATFORM_WEB
+    // On the Web, WebGPU objects are bound to the thread that created them, which may
+    // be the main browser thread or a pthread worker that owns an OffscreenCanvas.
+    const std::thread::id m_OwnerThreadId = std::this_thread::get_id();
+#endif
 };
 
 } // namespace Diligent
@@ -31,12 +31,14 @@
 
 #include <vector>
 #include <memory>
+#include <algorithm>
 
 #include "ShaderResourceCacheCommon.hpp"
 #include "PipelineResourceAttribsWebGPU.hpp"
 #include "STDAllocator.hpp"
 #include "WebGPUObjectWrappers.hpp"
 #include "IndexWrapper.hpp"
+#include "UniqueIdentifier.hpp"
 
 namespace Diligent
 {
@@ -128,13 +130,56 @@ public:
             return m_wgpuBindGroup;
         }
 
+        // The maximum number of bind groups that are kept alive for every group in the cache
+        static constexpr size_t MaxCachedBindGroups = 8;
+
     private:
-        /* 0 */ const Uint32              m_NumResources = 0;
-        /* 5*/ bool                       m_IsDirty      = true;
-        /* 8 */ Resource* const           m_pResources   = nullptr;
-        /*16 */ WGPUBindGroupEntry* const m_wgpuEntries  = nullptr;
-        /*24 */ WebGPUBindGroupWrapper    m_wgpuBindGroup;
-        /*40 */ // End of structure
+        // Identifies the resources referenced by the WebGPU bind group.
+        // Unique identifiers are never reused, so a key that references a released
+        // object can never match a new object, even if its WebGPU handle is recycled.
+        struct BindGroupKey
+        {
+            struct EntryAttribs
+            {
+                UniqueIdentifier ObjectUId = 0;
+                Uint64           Offset    = 0;
+                Uint64           Size      = 0;
+
+                bool operator==(const EntryAttribs& rhs) const
+                {
+                    return ObjectUId == rhs.ObjectUId && Offset == rhs.Offset && Size == rhs.Size;
+                }
+            };
+            std::vector<EntryAttribs> Entries;
+
+            size_t Hash = 0;
+
+            bool operator==(const BindGroupKey& rhs) const
+            {
+                return Hash == rhs.Hash && Entries == rhs.Entries;
+            }
+        };
+
+        struct CachedBindGroup
+        {
+            BindGroupKey           Key;
+            WebGPUBindGroupWrapper wgpuBindGroup;
+        };
+
+        void InitKey(BindGroupKey& Key) const;
+
+    private:
+        /* 0 */ const Uint32              m_NumResources  = 0;
+        /* 5*/ bool                       m_IsDirty       = true;
+        /* 8 */ Resource* const           m_pResources    = nullptr;
+        /*16 */ WGPUBindGroupEntry* const m_wgpuEntries   = nullptr;
+        /*24 */ WGPUBindGroup             m_wgpuBindGroup = nullptr;
+
+        // Bind groups that were previously created for this group, most recently used first.
+        // When resources change back and forth (which is typical for dynamic variables),
+        // the bind group is looked up here instead of being recreated.
+        /*32 */ std::vector<CachedBindGroup> m_CachedBindGroups;
+        /*56 */ // End of structure
 
     private:
         friend ShaderResourceCacheWebGPU;
@@ -192,6 +237,8 @@ public:
 #endif
 
 private:
+    static void SetBufferEntryRange(BindGroup& Group, WGPUBindGroupEntry& wgpuEntry, const Resource& Res);
+
 #ifdef DILIGENT_DEBUG
     const Resource* GetFirstResourcePtr() const
     {
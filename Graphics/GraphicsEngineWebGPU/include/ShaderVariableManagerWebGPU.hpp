@@ -97,6 +97,10 @@ private:
     const PipelineResourceDesc& GetResourceDesc(Uint32 Index) const;
     const ResourceAttribs&      GetResourceAttribs(Uint32 Index) const;
 
+    using TBase::GetResourceNameId;
+    using TBase::SetInlineConstants;
+    using TBase::GetInlineConstantsBuffer;
+
 private:
     Uint32 m_NumVariables = 0;
 };
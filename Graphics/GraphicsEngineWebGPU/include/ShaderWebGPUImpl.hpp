@@ -31,10 +31,12 @@
 
 #include <memory>
 #include <string>
+#include <mutex>
 
 #include "EngineWebGPUImplTraits.hpp"
 #include "ShaderBase.hpp"
 #include "WGSLShaderResources.hpp"
+#include "WebGPUObjectWrappers.hpp"
 
 namespace Diligent
 {
@@ -89,6 +91,11 @@ public:
 
     const char* GetEntryPoint() const;
 
+    /// Returns the WebGPU shader module created from the shader's WGSL.
+    /// The module is created once on first request and is shared by all pipelines that
+    /// use the shader without remapping its resource bindings.
+    WGPUShaderModule GetWebGPUShaderModule();
+
     const std::shared_ptr<const WGSLShaderResources>& GetShaderResources() const
     {
         DEV_CHECK_ERR(!IsCompiling(), "Shader resources are not available until the shader is compiled. Use GetStatus() to check the shader status.");
@@ -103,6 +110,9 @@ private:
     std::string m_EntryPoint;
 
     std::shared_ptr<const WGSLShaderResources> m_pShaderResources;
+
+    std::mutex                m_ShaderModuleMtx;
+    WebGPUShaderModuleWrapper m_wgpuShaderModule;
 };
 
 } // namespace Diligent
@@ -35,6 +35,8 @@
 
 #include "WebGPUObjectWrappers.hpp"
 #include "BasicTypes.h"
+#include "RefCntAutoPtr.hpp"
+#include "SyncPointWebGPU.hpp"
 
 namespace Diligent
 {
@@ -46,6 +48,13 @@ namespace Diligent
 //
 // The data is first written to the upload memory and the copy command is added to the command list.
 // Upload data is flushed to the GPU memory before the command list is submitted to the queue.
+//
+// By default, the data is staged in CPU memory and is written to the page buffer with wgpuQueueWriteBuffer().
+// When mapped pages are used, page buffers are created with MAP_WRITE | COPY_SRC usage and the data
+// is written directly to the mapped memory. The page is unmapped before the command list is submitted,
+// and is mapped again with wgpuBufferMapAsync() after it has been recycled. The page becomes available
+// for allocations when the map operation completes, which also indicates that the GPU has finished
+// reading the page.
 class UploadMemoryManagerWebGPU
 {
 public:
@@ -83,17 +92,28 @@ public:
 
         size_t GetSize() const
         {
-            return m_Data.size();
+            return m_Size;
         }
 
     private:
+        friend UploadMemoryManagerWebGPU;
+
         UploadMemoryManagerWebGPU* m_pMgr = nullptr;
         WebGPUBufferWrapper        m_wgpuBuffer;
-        std::vector<Uint8>         m_Data;
+        size_t                     m_Size       = 0;
         size_t                     m_CurrOffset = 0;
+
+        // CPU-side data. Not used by mapped pages.
+        std::vector<Uint8> m_Data;
+
+        // Pointer to the mapped memory of the page buffer, for mapped pages only.
+        Uint8* m_pMappedData = nullptr;
+
+        // Sync point that is triggered when the mapped page is mapped again after it has been recycled.
+        RefCntAutoPtr<SyncPointWebGPUImpl> m_pMapSyncPoint;
     };
 
-    UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize);
+    UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, bool UseMappedPages);
     ~UploadMemoryManagerWebGPU();
 
     Page GetPage(size_t Size);
@@ -101,13 +121,21 @@ public:
 private:
     void RecyclePage(Page&& page);
 
+    // Moves the pages whose map operations have completed to the list of available pages.
+    // Must be called with m_AvailablePagesMtx locked.
+    void ProcessPendingPages();
+
 private:
     const size_t m_PageSize;
+    const bool   m_UseMappedPages;
     WGPUDevice   m_wgpuDevice;
 
     std::mutex        m_AvailablePagesMtx;
     std::vector<Page> m_AvailablePages;
 
+    // Mapped pages that have been recycled and are waiting for wgpuBufferMapAsync() to complete
+    std::vector<Page> m_PendingPages;
+
 #if DILIGENT_DEBUG
     std::atomic<uint32_t> m_DbgPageCounter{0};
 #endif
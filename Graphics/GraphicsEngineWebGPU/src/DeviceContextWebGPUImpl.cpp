@@ -43,6 +43,7 @@
 #include "AttachmentCleanerWebGPU.hpp"
 #include "WebGPUTypeConversions.hpp"
 #include "SyncPointWebGPU.hpp"
+#include "Trace.hpp"
 
 namespace Diligent
 {
@@ -67,10 +68,10 @@ DeviceContextWebGPUImpl::DeviceContextWebGPUImpl(IReferenceCounters*      pRefCo
     m_MappedBuffers.reserve(16);
 }
 
-void DeviceContextWebGPUImpl::Begin(Uint32 ImmediateContextId)
+void DeviceContextWebGPUImpl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
 {
     DEV_CHECK_ERR(ImmediateContextId == 0, "WebGPU supports only one immediate context");
-    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS, Flags);
 }
 
 void DeviceContextWebGPUImpl::SetPipelineState(IPipelineState* pPipelineState)
@@ -140,6 +141,9 @@ void DeviceContextWebGPUImpl::DvpValidateCommittedShaderResources()
     if (m_BindInfo.ResourcesValidated)
         return;
 
+    if (!DvpIsCommandValidationRequired(m_BindInfo))
+        return;
+
     DvpVerifySRBCompatibility(m_BindInfo);
 
     const Uint32 SignCount = m_pPipelineState->GetResourceSignatureCount();
@@ -170,6 +174,9 @@ void DeviceContextWebGPUImpl::DvpValidateCommittedShaderResources()
 void DeviceContextWebGPUImpl::CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
                                                     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_TRACE_SCOPE("CommitShaderResources");
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Commit};
+
     TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
 
     ShaderResourceBindingWebGPUImpl* pResBindingWebGPU = ClassPtrCast<ShaderResourceBindingWebGPUImpl>(pShaderResourceBinding);
@@ -298,8 +305,8 @@ void DeviceContextWebGPUImpl::SetVertexBuffers(Uint32                         St
                                                RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
                                                SET_VERTEX_BUFFERS_FLAGS       Flags)
 {
-    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
-    m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_VERTEX_BUFFERS);
+    if (TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags, 0))
+        m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_VERTEX_BUFFERS);
 }
 
 
@@ -307,8 +314,8 @@ void DeviceContextWebGPUImpl::SetIndexBuffer(IBuffer*                       pInd
                                              Uint64                         ByteOffset,
                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
-    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
-    m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_INDEX_BUFFER);
+    if (TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode, 0))
+        m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_INDEX_BUFFER);
 }
 
 void DeviceContextWebGPUImpl::SetViewports(Uint32          NumViewports,
@@ -316,14 +323,14 @@ void DeviceContextWebGPUImpl::SetViewports(Uint32          NumViewports,
                                            Uint32          RTWidth,
                                            Uint32          RTHeight)
 {
-    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
-    m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_VIEWPORTS);
+    if (TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight))
+        m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_VIEWPORTS);
 }
 
 void DeviceContextWebGPUImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
 {
-    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
-    m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_SCISSOR_RECTS);
+    if (TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight))
+        m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_SCISSOR_RECTS);
 }
 
 void DeviceContextWebGPUImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
@@ -345,15 +352,25 @@ void DeviceContextWebGPUImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs&
         }
     }
 
-    if (TDeviceContextBase::SetRenderTargets(Attribs) || (Attribs.NumRenderTargets == 0 && Attribs.pDepthStencil == nullptr))
+    const bool ResetTargets = Attribs.NumRenderTargets == 0 && Attribs.pDepthStencil == nullptr;
+    if (TDeviceContextBase::SetRenderTargets(Attribs) || ResetTargets)
     {
-        EndCommandEncoders();
+        // Keep the render pass open when the targets are only unbound or are rebound to exactly the
+        // attachments of the open pass, so that consecutive passes with identical attachments are merged.
+        // Any other command that needs a different pass or works outside of a pass ends it.
+        const bool KeepRenderPass =
+            m_wgpuRenderPassEncoder &&
+            (ResetTargets || m_RenderPassAttachments.Matches(Attribs.NumRenderTargets, Attribs.ppRenderTargets, Attribs.pDepthStencil));
+        if (!KeepRenderPass)
+            EndCommandEncoders();
         SetViewports(1, nullptr, 0, 0);
     }
 }
 
 void DeviceContextWebGPUImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
 {
+    // The pass started for previously bound render targets may still be open
+    EndCommandEncoders();
     TDeviceContextBase::BeginRenderPass(Attribs);
     m_AttachmentClearValues.resize(Attribs.ClearValueCount);
     for (Uint32 RTIndex = 0; RTIndex < Attribs.ClearValueCount; ++RTIndex)
@@ -487,6 +504,11 @@ void DeviceContextWebGPUImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttri
     }
 }
 
+void DeviceContextWebGPUImpl::ExecuteIndirectCommands(const ExecuteIndirectCommandsAttribs& Attribs)
+{
+    UNSUPPORTED("ExecuteIndirectCommands is not supported in WebGPU");
+}
+
 void DeviceContextWebGPUImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
     UNSUPPORTED("DrawMesh is not supported in WebGPU");
@@ -587,6 +609,12 @@ void DeviceContextWebGPUImpl::ClearRenderTarget(ITextureView*                  p
         m_PendingClears.SetColor(RTIndex, static_cast<const float*>(RGBA));
 }
 
+void DeviceContextWebGPUImpl::InvalidateRenderTargets(Uint32 RenderTargetMask, Bool InvalidateDepthStencil)
+{
+    TDeviceContextBase::InvalidateRenderTargets(RenderTargetMask, InvalidateDepthStencil);
+    // WebGPU has no load operation that leaves the attachment contents undefined, so the hint is ignored.
+}
+
 void DeviceContextWebGPUImpl::UpdateBuffer(IBuffer*                       pBuffer,
                                            Uint64                         Offset,
                                            Uint64                         Size,
@@ -1449,8 +1477,29 @@ void DeviceContextWebGPUImpl::EndQuery(IQuery* pQuery)
     }
 }
 
+void DeviceContextWebGPUImpl::BeginPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    UNSUPPORTED("BeginPoolQuery is not supported in WebGPU");
+}
+
+void DeviceContextWebGPUImpl::EndPoolQuery(IQueryPool* pQueryPool, Uint32 Index)
+{
+    UNSUPPORTED("EndPoolQuery is not supported in WebGPU");
+}
+
+void DeviceContextWebGPUImpl::ResolvePoolQueries(const ResolvePoolQueriesAttribs& Attribs)
+{
+    UNSUPPORTED("ResolvePoolQueries is not supported in WebGPU");
+}
+
 void DeviceContextWebGPUImpl::Flush()
 {
+    DILIGENT_TRACE_SCOPE("Flush");
+
+    UpdateGPUFrameTimer();
+
+    ScopedCPUTimer CPUTimer{m_Stats.CPUTimes.Submit};
+
     EnqueueSignal(m_pFence, ++m_FenceValue);
     EndCommandEncoders();
 
@@ -1470,9 +1519,7 @@ void DeviceContextWebGPUImpl::Flush()
     for (UploadMemoryManagerWebGPU::Page& MemPage : m_UploadMemPages)
     {
         MemPage.FlushWrites(m_wgpuQueue);
-        MemPage.Recycle();
     }
-    m_UploadMemPages.clear();
 
     if (m_wgpuCommandEncoder || !m_SignaledFences.empty())
     {
@@ -1503,6 +1550,7 @@ void DeviceContextWebGPUImpl::Flush()
         DEV_CHECK_ERR(wgpuCmdBuffer != nullptr, "Failed to finish command encoder");
 
         wgpuQueueSubmit(m_wgpuQueue, 1, &wgpuCmdBuffer.Get());
+        ++m_Stats.QueueSubmits;
         wgpuQueueOnSubmittedWorkDone(m_wgpuQueue, WorkDoneCallback, pWorkDoneSyncPoint.Detach());
         m_wgpuCommandEncoder.Reset(nullptr);
 
@@ -1513,6 +1561,14 @@ void DeviceContextWebGPUImpl::Flush()
         m_PendingStagingReads.clear();
     }
 
+    // Upload pages must be recycled after the commands that read them have been submitted,
+    // since mapped pages are mapped again when they are recycled.
+    for (UploadMemoryManagerWebGPU::Page& MemPage : m_UploadMemPages)
+    {
+        MemPage.Recycle();
+    }
+    m_UploadMemPages.clear();
+
     // Without DeviceTick(), the work done callback is never called
     m_pDevice->DeviceTick();
 }
@@ -1570,6 +1626,21 @@ void DeviceContextWebGPUImpl::SetShadingRate(SHADING_RATE          BaseRate,
     UNSUPPORTED("SetShadingRate is not supported in WebGPU");
 }
 
+void DeviceContextWebGPUImpl::SetCullMode(CULL_MODE CullMode)
+{
+    UNSUPPORTED("SetCullMode is not supported in WebGPU");
+}
+
+void DeviceContextWebGPUImpl::SetDepthState(Bool DepthEnable, Bool DepthWriteEnable, COMPARISON_FUNCTION DepthFunc)
+{
+    UNSUPPORTED("SetDepthState is not supported in WebGPU");
+}
+
+void DeviceContextWebGPUImpl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    UNSUPPORTED("SetPrimitiveTopology is not supported in WebGPU");
+}
+
 void DeviceContextWebGPUImpl::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
 {
     UNSUPPORTED("BindSparseResourceMemory is not supported in WebGPU");
@@ -1647,9 +1718,9 @@ void DeviceContextWebGPUImpl::InsertDebugLabel(const Char* Label, const float* p
         wgpuCommandEncoderInsertDebugMarker(GetCommandEncoder(), GetWGPUStringView(Label));
 }
 
-void DeviceContextWebGPUImpl::GenerateMips(ITextureView* pTexView)
+void DeviceContextWebGPUImpl::GenerateMips(ITextureView* pTexView, GENERATE_MIPS_FLAGS Flags)
 {
-    TDeviceContextBase::GenerateMips(pTexView);
+    TDeviceContextBase::GenerateMips(pTexView, Flags);
 
     if (m_pPipelineState)
     {
@@ -1791,6 +1862,7 @@ void DeviceContextWebGPUImpl::EndCommandEncoders(Uint32 EncoderFlags)
 
             wgpuRenderPassEncoderEnd(m_wgpuRenderPassEncoder);
             m_wgpuRenderPassEncoder.Reset(nullptr);
+            m_RenderPassAttachments.Clear();
             ClearEncoderState();
         }
     }
@@ -1878,6 +1950,11 @@ void DeviceContextWebGPUImpl::CommitRenderTargets()
     DEV_CHECK_ERR(m_wgpuRenderPassEncoder != nullptr, "Failed to begin render pass");
     m_PendingClears.ResetFlags();
 
+    for (Uint32 RTIndex = 0; RTIndex < m_NumBoundRenderTargets; ++RTIndex)
+        m_RenderPassAttachments.pRenderTargets[RTIndex] = m_pBoundRenderTargets[RTIndex];
+    m_RenderPassAttachments.pDepthStencil    = m_pBoundDepthStencil;
+    m_RenderPassAttachments.NumRenderTargets = m_NumBoundRenderTargets;
+
     // Occlusion query can't be nested
     if (!m_OcclusionQueriesStack.empty() && (m_OcclusionQueriesStack.back().first == OCCLUSION_QUERY_TYPE_OUTER))
         wgpuRenderPassEncoderBeginOcclusionQuery(GetRenderPassCommandEncoder(), m_OcclusionQueriesStack.back().second);
@@ -47,4 +47,34 @@ template struct PRSSerializerWebGPU<SerializerMode::Read>;
 template struct PRSSerializerWebGPU<SerializerMode::Write>;
 template struct PRSSerializerWebGPU<SerializerMode::Measure>;
 
+template <SerializerMode Mode>
+bool ShaderSerializerWebGPU<Mode>::SerializeArchiveData(
+    Serializer<Mode>&                 Ser,
+    ConstQual<WGSLShaderArchiveData>& Data,
+    DynamicLinearAllocator*           Allocator)
+{
+    if (!Ser(Data.WGSL, Data.EntryPoint))
+        return false;
+
+    return Ser.SerializeArray(Allocator, Data.pResources, Data.NumResources,
+                              [](Serializer<Mode>& Ser, ConstQual<WGSLShaderArchiveData::Resource>& Res) //
+                              {
+                                  return Ser(Res.Name,
+                                             Res.BufferStaticSize,
+                                             Res.ArraySize,
+                                             Res.BindGroup,
+                                             Res.BindIndex,
+                                             Res.Format,
+                                             Res.Type,
+                                             Res.ResourceDim,
+                                             Res.SampleType);
+                              });
+
+    ASSERT_SIZEOF64(WGSLShaderArchiveData::Resource, 24, "Did you add a new member to WGSLShaderArchiveData::Resource? Please add serialization here.");
+}
+
+template struct ShaderSerializerWebGPU<SerializerMode::Read>;
+template struct ShaderSerializerWebGPU<SerializerMode::Write>;
+template struct ShaderSerializerWebGPU<SerializerMode::Measure>;
+
 } // namespace Diligent
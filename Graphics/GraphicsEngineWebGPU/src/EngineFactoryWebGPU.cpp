@@ -403,13 +403,18 @@ DeviceFeatures GetSupportedFeatures(WGPUAdapter wgpuAdapter, WGPUDevice wgpuDevi
     Features.NativeMultiDraw                   = DEVICE_FEATURE_STATE_DISABLED;
     Features.AsyncShaderCompilation            = DEVICE_FEATURE_STATE_ENABLED;
     Features.FormattedBuffers                  = DEVICE_FEATURE_STATE_DISABLED;
+    Features.SpecializationConstants           = DEVICE_FEATURE_STATE_DISABLED;
+    Features.ExtendedDynamicState              = DEVICE_FEATURE_STATE_DISABLED;
+    Features.GPUUploadMemory                   = DEVICE_FEATURE_STATE_DISABLED;
+    Features.Multiview                         = DEVICE_FEATURE_STATE_DISABLED;
+    Features.ExternalMemory                    = DEVICE_FEATURE_STATE_DISABLED;
 
     Features.TimestampQueries = CheckFeature(WGPUFeatureName_TimestampQuery);
     Features.DurationQueries  = Features.TimestampQueries ?
         CheckFeature(WGPUFeatureName_ChromiumExperimentalTimestampQueryInsidePasses) :
         DEVICE_FEATURE_STATE_DISABLED;
 
-    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+    ASSERT_SIZEOF(DeviceFeatures, 52, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
 
     return Features;
 }
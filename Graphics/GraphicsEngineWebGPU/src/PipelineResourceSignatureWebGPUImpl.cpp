@@ -391,7 +391,7 @@ void PipelineResourceSignatureWebGPUImpl::CreateBindGroupLayouts(const bool IsSe
                 // Set the immutable sampler array size to match the resource array size
                 ImmutableSamplerAttribsWebGPU& DstImtblSampAttribs = m_pImmutableSamplerAttribs[SrcImmutableSamplerInd];
                 // One immutable sampler may be used by different arrays in different shader stages - use the maximum array size
-                DstImtblSampAttribs.ArraySize = std::max(DstImtblSampAttribs.ArraySize, ResDesc.ArraySize);
+                DstImtblSampAttribs.ArraySize = std::max(DstImtblSampAttribs.ArraySize, ResDesc.GetArraySize());
 
                 IsImmutableSampler = true;
             }
@@ -400,9 +400,9 @@ void PipelineResourceSignatureWebGPUImpl::CreateBindGroupLayouts(const bool IsSe
         // We allocate bindings for immutable samplers separately
         if (!IsImmutableSampler)
         {
-            ReserveBindings(CacheGroup, ResDesc.ArraySize);
+            ReserveBindings(CacheGroup, ResDesc.GetArraySize());
             if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
-                StaticResourceCount += ResDesc.ArraySize;
+                StaticResourceCount += ResDesc.GetArraySize();
         }
     }
 
@@ -545,7 +545,7 @@ void PipelineResourceSignatureWebGPUImpl::CreateBindGroupLayouts(const bool IsSe
         else
         {
             const BIND_GROUP_ID GroupId = VarTypeToBindGroupId(ResDesc.VarType);
-            AllocateBindings(GroupId, GetResourceCacheGroup(ResDesc), ResDesc.ArraySize, BindGroupIndex, BindingIndex, CacheOffset);
+            AllocateBindings(GroupId, GetResourceCacheGroup(ResDesc), ResDesc.GetArraySize(), BindGroupIndex, BindingIndex, CacheOffset);
         }
         VERIFY_EXPR(BindGroupIndex != ~0u && BindingIndex != ~0u && CacheOffset != ~0u);
 
@@ -555,7 +555,7 @@ void PipelineResourceSignatureWebGPUImpl::CreateBindGroupLayouts(const bool IsSe
             new (pAttribs) ResourceAttribs{
                 BindingIndex,
                 AssignedSamplerInd,
-                ResDesc.ArraySize,
+                ResDesc.GetArraySize(),
                 EntryType,
                 BindGroupIndex,
                 SrcImmutableSamplerInd != InvalidImmutableSamplerIndex,
@@ -569,8 +569,8 @@ void PipelineResourceSignatureWebGPUImpl::CreateBindGroupLayouts(const bool IsSe
                           "Deserialized binding index (", pAttribs->BindingIndex, ") is invalid: ", BindingIndex, " is expected.");
             DEV_CHECK_ERR(pAttribs->SamplerInd == AssignedSamplerInd,
                           "Deserialized sampler index (", pAttribs->SamplerInd, ") is invalid: ", AssignedSamplerInd, " is expected.");
-            DEV_CHECK_ERR(pAttribs->ArraySize == ResDesc.ArraySize,
-                          "Deserialized array size (", pAttribs->ArraySize, ") is invalid: ", ResDesc.ArraySize, " is expected.");
+            DEV_CHECK_ERR(pAttribs->ArraySize == ResDesc.GetArraySize(),
+                          "Deserialized array size (", pAttribs->ArraySize, ") is invalid: ", ResDesc.GetArraySize(), " is expected.");
             DEV_CHECK_ERR(pAttribs->GetBindGroupEntryType() == EntryType, "Deserialized bind group entry type is invalid");
             DEV_CHECK_ERR(pAttribs->BindGroup == BindGroupIndex,
                           "Deserialized bind group index (", pAttribs->BindGroup, ") is invalid: ", BindGroupIndex, " is expected.");
@@ -583,7 +583,7 @@ void PipelineResourceSignatureWebGPUImpl::CreateBindGroupLayouts(const bool IsSe
 
         if (!IsImmutableSampler)
         {
-            for (Uint32 elem = 0; elem < ResDesc.ArraySize; ++elem)
+            for (Uint32 elem = 0; elem < ResDesc.GetArraySize(); ++elem)
             {
                 WGPUBindGroupLayoutEntry wgpuBGLayoutEntry = GetWGPUBindGroupLayoutEntry(*pAttribs, ResDesc, elem);
                 wgpuBGLayoutEntries[BindGroupIndex].push_back(wgpuBGLayoutEntry);
@@ -592,9 +592,9 @@ void PipelineResourceSignatureWebGPUImpl::CreateBindGroupLayouts(const bool IsSe
             if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
             {
                 VERIFY(pAttribs->BindGroup == 0, "Static resources must always be allocated in bind group 0");
-                m_pStaticResCache->InitializeResources(pAttribs->BindGroup, StaticCacheOffset, ResDesc.ArraySize,
+                m_pStaticResCache->InitializeResources(pAttribs->BindGroup, StaticCacheOffset, ResDesc.GetArraySize(),
                                                        pAttribs->GetBindGroupEntryType(), pAttribs->IsImmutableSamplerAssigned());
-                StaticCacheOffset += ResDesc.ArraySize;
+                StaticCacheOffset += ResDesc.GetArraySize();
             }
         }
     }
@@ -725,7 +725,7 @@ void PipelineResourceSignatureWebGPUImpl::InitSRBResourceCache(ShaderResourceCac
             continue;
         }
 
-        ResourceCache.InitializeResources(Attr.BindGroup, Attr.CacheOffset(CacheType), ResDesc.ArraySize,
+        ResourceCache.InitializeResources(Attr.BindGroup, Attr.CacheOffset(CacheType), ResDesc.GetArraySize(),
                                           Attr.GetBindGroupEntryType(), Attr.IsImmutableSamplerAssigned());
     }
 
@@ -779,7 +779,7 @@ void PipelineResourceSignatureWebGPUImpl::CopyStaticResources(ShaderResourceCach
             // Skip immutable samplers as they are initialized in InitSRBResourceCache()
             if (DstCacheType == ResourceCacheContentType::SRB)
             {
-                for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+                for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
                 {
                     VERIFY(DstBindGroup.GetResource(Attr.CacheOffset(DstCacheType) + ArrInd).pObject,
                            "Immutable sampler must have been initialized in InitSRBResourceCache(). This is likely a bug.");
@@ -788,7 +788,7 @@ void PipelineResourceSignatureWebGPUImpl::CopyStaticResources(ShaderResourceCach
             continue;
         }
 
-        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.GetArraySize(); ++ArrInd)
         {
             const Uint32                               SrcCacheOffset = Attr.CacheOffset(SrcCacheType) + ArrInd;
             const ShaderResourceCacheWebGPU::Resource& SrcCachedRes   = SrcBindGroup.GetResource(SrcCacheOffset);
@@ -898,7 +898,7 @@ bool PipelineResourceSignatureWebGPUImpl::DvpValidateCommittedResource(const Dev
             const PipelineResourceDesc& SamplerResDesc = GetResourceDesc(ResAttribs.SamplerInd);
             const ResourceAttribs&      SamplerAttribs = GetResourceAttribs(ResAttribs.SamplerInd);
             VERIFY_EXPR(SamplerResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER);
-            VERIFY_EXPR(SamplerResDesc.ArraySize == 1 || SamplerResDesc.ArraySize == ResDesc.ArraySize);
+            VERIFY_EXPR(SamplerResDesc.ArraySize == 1 || SamplerResDesc.ArraySize == ResDesc.GetArraySize());
             if (ArrIndex < SamplerResDesc.ArraySize)
             {
                 const ShaderResourceCacheWebGPU::BindGroup& SamBindGroupResources = ResourceCache.GetBindGroup(SamplerAttribs.BindGroup);
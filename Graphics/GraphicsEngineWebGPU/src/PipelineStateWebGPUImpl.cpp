@@ -339,9 +339,40 @@ struct PipelineStateWebGPUImpl::AsyncPipelineBuilder : public ObjectBase<IObject
     }
 };
 
+void PipelineStateWebGPUImpl::InitShaderModules(TShaderStages& ShaderStages)
+{
+    // Shader modules are created for all stages at once when the pipeline state is initialized,
+    // so that asynchronous pipelines only need to issue the pipeline creation command.
+    // Shaders whose resource bindings do not need to be remapped share the same module
+    // across all pipelines.
+    for (ShaderStageInfo& Stage : ShaderStages)
+    {
+        if (Stage.PatchedWGSL.empty())
+        {
+            Stage.wgpuShaderModule = Stage.pShader->GetWebGPUShaderModule();
+        }
+        else
+        {
+            WGPUShaderSourceWGSL wgpuShaderCodeDesc{};
+            wgpuShaderCodeDesc.chain.sType = WGPUSType_ShaderSourceWGSL;
+            wgpuShaderCodeDesc.code        = GetWGPUStringView(Stage.PatchedWGSL);
+
+            WGPUShaderModuleDescriptor wgpuShaderModuleDesc{};
+            wgpuShaderModuleDesc.nextInChain = reinterpret_cast<WGPUChainedStruct*>(&wgpuShaderCodeDesc);
+            wgpuShaderModuleDesc.label       = GetWGPUStringView(Stage.pShader->GetDesc().Name);
+            Stage.wgpuPatchedShaderModule.Reset(wgpuDeviceCreateShaderModule(m_pDevice->GetWebGPUDevice(), &wgpuShaderModuleDesc));
+            Stage.wgpuShaderModule = Stage.wgpuPatchedShaderModule;
+        }
+
+        if (!Stage.wgpuShaderModule)
+            LOG_ERROR_AND_THROW("Failed to create WGPU shader module for shader '", Stage.pShader->GetDesc().Name, "'.");
+    }
+}
+
 void PipelineStateWebGPUImpl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
 {
     TShaderStages ShaderStages = InitInternalObjects(CreateInfo);
+    InitShaderModules(ShaderStages);
     // NB: it is not safe to check m_AsyncInitializer here as, first, it is set after the async task is started,
     //     and second, it is not atomic or protected by mutex.
     if ((CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) == 0)
@@ -358,6 +389,7 @@ void PipelineStateWebGPUImpl::InitializePipeline(const GraphicsPipelineStateCrea
 void PipelineStateWebGPUImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
 {
     TShaderStages ShaderStages = InitInternalObjects(CreateInfo);
+    InitShaderModules(ShaderStages);
     // NB: it is not safe to check m_AsyncInitializer here as, first, it is set after the async task is started,
     //     and second, it is not atomic or protected by mutex.
     if ((CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) == 0)
@@ -383,32 +415,21 @@ void PipelineStateWebGPUImpl::InitializeWebGPURenderPipeline(const TShaderStages
 
     WGPUFragmentState wgpuFragmentState{};
 
-    std::vector<WebGPUShaderModuleWrapper> wgpuShaderModules{ShaderStages.size()};
-    for (size_t ShaderIdx = 0; ShaderIdx < ShaderStages.size(); ++ShaderIdx)
+    for (const ShaderStageInfo& Stage : ShaderStages)
     {
-        const ShaderStageInfo& Stage = ShaderStages[ShaderIdx];
-
-        WGPUShaderSourceWGSL wgpuShaderCodeDesc{};
-        wgpuShaderCodeDesc.chain.sType = WGPUSType_ShaderSourceWGSL;
-        wgpuShaderCodeDesc.code        = GetWGPUStringView(Stage.GetWGSL());
-
-        WGPUShaderModuleDescriptor wgpuShaderModuleDesc{};
-        wgpuShaderModuleDesc.nextInChain = reinterpret_cast<WGPUChainedStruct*>(&wgpuShaderCodeDesc);
-        wgpuShaderModuleDesc.label       = GetWGPUStringView(Stage.pShader->GetDesc().Name);
-        wgpuShaderModules[ShaderIdx].Reset(wgpuDeviceCreateShaderModule(m_pDevice->GetWebGPUDevice(), &wgpuShaderModuleDesc));
-        VERIFY(wgpuShaderModules[ShaderIdx], "Failed to create WGPU shader module for shader '", Stage.pShader->GetDesc().Name, "'.");
+        VERIFY(Stage.wgpuShaderModule, "Shader module for shader '", Stage.pShader->GetDesc().Name, "' has not been initialized.");
 
         switch (Stage.Type)
         {
             case SHADER_TYPE_VERTEX:
                 VERIFY(wgpuRenderPipelineDesc.vertex.module == nullptr, "Only one vertex shader is allowed");
-                wgpuRenderPipelineDesc.vertex.module     = wgpuShaderModules[ShaderIdx].Get();
+                wgpuRenderPipelineDesc.vertex.module     = Stage.wgpuShaderModule;
                 wgpuRenderPipelineDesc.vertex.entryPoint = GetWGPUStringView(Stage.pShader->GetEntryPoint());
                 break;
 
             case SHADER_TYPE_PIXEL:
                 VERIFY(wgpuFragmentState.module == nullptr, "Only one vertex shader is allowed");
-                wgpuFragmentState.module        = wgpuShaderModules[ShaderIdx].Get();
+                wgpuFragmentState.module        = Stage.wgpuShaderModule;
                 wgpuFragmentState.entryPoint    = GetWGPUStringView(Stage.pShader->GetEntryPoint());
                 wgpuRenderPipelineDesc.fragment = &wgpuFragmentState;
                 break;
@@ -597,21 +618,11 @@ void PipelineStateWebGPUImpl::InitializeWebGPUComputePipeline(const TShaderStage
 {
     VERIFY(ShaderStages[0].Type == SHADER_TYPE_COMPUTE, "Incorrect shader type: compute shader is expected");
     ShaderWebGPUImpl* pShaderWebGPU = ShaderStages[0].pShader;
-
-    WebGPUShaderModuleWrapper wgpuShaderModule{};
-
-    WGPUShaderSourceWGSL wgpuShaderCodeDesc{};
-    wgpuShaderCodeDesc.chain.sType = WGPUSType_ShaderSourceWGSL;
-    wgpuShaderCodeDesc.code        = GetWGPUStringView(ShaderStages[0].GetWGSL());
-
-    WGPUShaderModuleDescriptor wgpuShaderModuleDesc{};
-    wgpuShaderModuleDesc.nextInChain = reinterpret_cast<WGPUChainedStruct*>(&wgpuShaderCodeDesc);
-    wgpuShaderModuleDesc.label       = GetWGPUStringView(pShaderWebGPU->GetDesc().Name);
-    wgpuShaderModule.Reset(wgpuDeviceCreateShaderModule(m_pDevice->GetWebGPUDevice(), &wgpuShaderModuleDesc));
+    VERIFY(ShaderStages[0].wgpuShaderModule, "Shader module for shader '", pShaderWebGPU->GetDesc().Name, "' has not been initialized.");
 
     WGPUComputePipelineDescriptor wgpuComputePipelineDesc{};
     wgpuComputePipelineDesc.label              = GetWGPUStringView(m_Desc.Name);
-    wgpuComputePipelineDesc.compute.module     = wgpuShaderModule.Get();
+    wgpuComputePipelineDesc.compute.module     = ShaderStages[0].wgpuShaderModule;
     wgpuComputePipelineDesc.compute.entryPoint = GetWGPUStringView(pShaderWebGPU->GetEntryPoint());
     wgpuComputePipelineDesc.layout             = m_PipelineLayout.GetWebGPUPipelineLayout();
 
@@ -108,7 +108,7 @@ RenderDeviceWebGPUImpl::RenderDeviceWebGPUImpl(IReferenceCounters* pRefCounters,
 
     m_DeviceInfo.Features = EnableDeviceFeatures(CI.EnabledFeatures, EngineCI.Features);
 
-    m_pUploadMemoryManager  = std::make_unique<UploadMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.UploadHeapPageSize);
+    m_pUploadMemoryManager  = std::make_unique<UploadMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.UploadHeapPageSize, EngineCI.UseMappedUploadPages);
     m_pDynamicMemoryManager = std::make_unique<DynamicMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.DynamicHeapPageSize, EngineCI.DynamicHeapSize);
     m_pAttachmentCleaner    = std::make_unique<AttachmentCleanerWebGPU>(*this);
     m_pMipsGenerator        = std::make_unique<GenerateMipsHelperWebGPU>(*this);
@@ -224,6 +224,18 @@ void RenderDeviceWebGPUImpl::CreateQuery(const QueryDesc& Desc,
     CreateQueryImpl(ppQuery, Desc);
 }
 
+void RenderDeviceWebGPUImpl::CreateQueryPool(const QueryPoolDesc& Desc, IQueryPool** ppQueryPool)
+{
+    UNSUPPORTED("CreateQueryPool is not supported in WebGPU");
+    *ppQueryPool = nullptr;
+}
+
+void RenderDeviceWebGPUImpl::CreateIndirectCommandSignature(const IndirectCommandSignatureDesc& Desc, IIndirectCommandSignature** ppSignature)
+{
+    UNSUPPORTED("CreateIndirectCommandSignature is not supported in WebGPU");
+    *ppSignature = nullptr;
+}
+
 void RenderDeviceWebGPUImpl::CreateRenderPass(const RenderPassDesc& Desc,
                                               IRenderPass**         ppRenderPass)
 {
@@ -264,6 +276,18 @@ void RenderDeviceWebGPUImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& Cr
     *ppMemory = nullptr;
 }
 
+void RenderDeviceWebGPUImpl::CreatePlacedTexture(const TextureDesc& TexDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, ITexture** ppTexture)
+{
+    UNSUPPORTED("CreatePlacedTexture is not supported in WebGPU");
+    *ppTexture = nullptr;
+}
+
+void RenderDeviceWebGPUImpl::CreatePlacedBuffer(const BufferDesc& BuffDesc, IDeviceMemory* pMemory, Uint64 MemoryOffset, IBuffer** ppBuffer)
+{
+    UNSUPPORTED("CreatePlacedBuffer is not supported in WebGPU");
+    *ppBuffer = nullptr;
+}
+
 void RenderDeviceWebGPUImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                       IPipelineStateCache**               ppPSOCache)
 {
@@ -284,6 +308,17 @@ SparseTextureFormatInfo RenderDeviceWebGPUImpl::GetSparseTextureFormatInfo(TEXTU
     return {};
 }
 
+ResourceMemoryRequirements RenderDeviceWebGPUImpl::GetTextureMemoryRequirements(const TextureDesc& TexDesc) const
+{
+    // Placed resources are not supported in WebGPU
+    return {};
+}
+
+ResourceMemoryRequirements RenderDeviceWebGPUImpl::GetBufferMemoryRequirements(const BufferDesc& BuffDesc) const
+{
+    return {};
+}
+
 WGPUInstance RenderDeviceWebGPUImpl::GetWebGPUInstance() const
 {
     return m_wgpuInstance.Get();
@@ -364,7 +399,13 @@ DynamicMemoryManagerWebGPU::Page RenderDeviceWebGPUImpl::GetDynamicMemoryPage(si
 
 void RenderDeviceWebGPUImpl::DeviceTick()
 {
-#if !PLATFORM_WEB
+#if PLATFORM_WEB
+    // Queue callbacks that trigger sync points are delivered by the browser on the thread
+    // that created the device once it returns to its event loop.
+    DEV_CHECK_ERR(std::this_thread::get_id() == m_OwnerThreadId,
+                  "WebGPU device on the Web must only be used by the thread that created it. "
+                  "When rendering on a worker, create the device and the swap chain on that worker.");
+#else
     wgpuDeviceTick(m_wgpuDevice);
 #endif
 }
@@ -33,6 +33,7 @@
 #include "TextureWebGPUImpl.hpp"
 #include "SamplerWebGPUImpl.hpp"
 #include "DeviceContextWebGPUImpl.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
@@ -315,6 +316,20 @@ static bool IsDynamicBuffer(const ShaderResourceCacheWebGPU::Resource& Res)
     return IsDynamic;
 }
 
+void ShaderResourceCacheWebGPU::SetBufferEntryRange(BindGroup& Group, WGPUBindGroupEntry& wgpuEntry, const Resource& Res)
+{
+    // Buffers with dynamic offsets are bound at zero offset, and the base offset is passed
+    // to SetBindGroup() along with the dynamic offset (see GetDynamicBufferOffsets()).
+    // This way, binding a different range of the same buffer does not require a new bind group.
+    const Uint64 EntryOffset = IsDynamicGroupEntryType(Res.Type) ? 0 : Res.BufferBaseOffset;
+    if (wgpuEntry.offset != EntryOffset || wgpuEntry.size != Res.BufferRangeSize)
+    {
+        Group.m_IsDirty = true;
+    }
+    wgpuEntry.offset = EntryOffset;
+    wgpuEntry.size   = Res.BufferRangeSize;
+}
+
 const ShaderResourceCacheWebGPU::Resource& ShaderResourceCacheWebGPU::SetResource(
     Uint32                       BindGroupIdx,
     Uint32                       CacheOffset,
@@ -374,12 +389,7 @@ const ShaderResourceCacheWebGPU::Resource& ShaderResourceCacheWebGPU::SetResourc
 
                 wgpuEntry.buffer = pBuffWGPU->GetWebGPUBuffer();
                 VERIFY_EXPR(DstRes.BufferBaseOffset + DstRes.BufferRangeSize <= pBuffWGPU->GetDesc().Size);
-                if (wgpuEntry.offset != DstRes.BufferBaseOffset || wgpuEntry.size != DstRes.BufferRangeSize)
-                {
-                    Group.m_IsDirty = true;
-                }
-                wgpuEntry.offset = DstRes.BufferBaseOffset;
-                wgpuEntry.size   = DstRes.BufferRangeSize;
+                SetBufferEntryRange(Group, wgpuEntry, DstRes);
             }
             break;
 
@@ -393,13 +403,7 @@ const ShaderResourceCacheWebGPU::Resource& ShaderResourceCacheWebGPU::SetResourc
 
                 wgpuEntry.buffer = pBuffWGPU->GetWebGPUBuffer();
                 VERIFY_EXPR(DstRes.BufferBaseOffset + DstRes.BufferRangeSize <= pBuffWGPU->GetDesc().Size);
-                if (wgpuEntry.offset != DstRes.BufferBaseOffset ||
-                    wgpuEntry.size != DstRes.BufferRangeSize)
-                {
-                    Group.m_IsDirty = true;
-                }
-                wgpuEntry.offset = DstRes.BufferBaseOffset;
-                wgpuEntry.size   = DstRes.BufferRangeSize;
+                SetBufferEntryRange(Group, wgpuEntry, DstRes);
             }
             break;
 
@@ -462,20 +466,67 @@ WGPUBindGroup ShaderResourceCacheWebGPU::UpdateBindGroup(WGPUDevice wgpuDevice,
     BindGroup& Group = GetBindGroup(GroupIndex);
     if (!Group.m_wgpuBindGroup || Group.m_IsDirty)
     {
-        WGPUBindGroupDescriptor wgpuBindGroupDescriptor{};
-        wgpuBindGroupDescriptor.nextInChain = nullptr;
-        wgpuBindGroupDescriptor.label       = {};
-        wgpuBindGroupDescriptor.layout      = wgpuGroupLayout;
-        wgpuBindGroupDescriptor.entryCount  = Group.m_NumResources;
-        wgpuBindGroupDescriptor.entries     = Group.m_wgpuEntries;
-
-        Group.m_wgpuBindGroup.Reset(wgpuDeviceCreateBindGroup(wgpuDevice, &wgpuBindGroupDescriptor));
-        Group.m_IsDirty = false;
+        std::vector<BindGroup::CachedBindGroup>& CachedGroups = Group.m_CachedBindGroups;
+
+        BindGroup::BindGroupKey Key;
+        Group.InitKey(Key);
+
+        auto it = std::find_if(CachedGroups.begin(), CachedGroups.end(),
+                               [&Key](const BindGroup::CachedBindGroup& Cached) { return Cached.Key == Key; });
+        if (it != CachedGroups.end())
+        {
+            // Move the bind group to the front of the list
+            std::rotate(CachedGroups.begin(), it, it + 1);
+        }
+        else
+        {
+            WGPUBindGroupDescriptor wgpuBindGroupDescriptor{};
+            wgpuBindGroupDescriptor.nextInChain = nullptr;
+            wgpuBindGroupDescriptor.label       = {};
+            wgpuBindGroupDescriptor.layout      = wgpuGroupLayout;
+            wgpuBindGroupDescriptor.entryCount  = Group.m_NumResources;
+            wgpuBindGroupDescriptor.entries     = Group.m_wgpuEntries;
+
+            WebGPUBindGroupWrapper wgpuBindGroup{wgpuDeviceCreateBindGroup(wgpuDevice, &wgpuBindGroupDescriptor)};
+            if (!wgpuBindGroup)
+            {
+                LOG_ERROR_MESSAGE("Failed to create WebGPU bind group");
+                return nullptr;
+            }
+
+            // Release the least recently used bind group. Note that cached bind groups keep
+            // the WebGPU resources they reference alive, so the cache size must be small.
+            if (CachedGroups.size() >= BindGroup::MaxCachedBindGroups)
+                CachedGroups.pop_back();
+
+            CachedGroups.insert(CachedGroups.begin(), BindGroup::CachedBindGroup{std::move(Key), std::move(wgpuBindGroup)});
+        }
+
+        Group.m_wgpuBindGroup = CachedGroups.front().wgpuBindGroup;
+        Group.m_IsDirty       = false;
     }
 
     return Group.m_wgpuBindGroup;
 }
 
+void ShaderResourceCacheWebGPU::BindGroup::InitKey(BindGroupKey& Key) const
+{
+    Key.Entries.resize(m_NumResources);
+    Key.Hash = 0;
+    for (Uint32 res = 0; res < m_NumResources; ++res)
+    {
+        const Resource&           Res       = m_pResources[res];
+        const WGPUBindGroupEntry& wgpuEntry = m_wgpuEntries[res];
+
+        BindGroupKey::EntryAttribs& Entry = Key.Entries[res];
+
+        Entry.ObjectUId = Res.pObject ? Res.pObject->GetUniqueID() : 0;
+        Entry.Offset    = wgpuEntry.offset;
+        Entry.Size      = wgpuEntry.size;
+        HashCombine(Key.Hash, Entry.ObjectUId, Entry.Offset, Entry.Size);
+    }
+}
+
 bool ShaderResourceCacheWebGPU::GetDynamicBufferOffsets(const DeviceContextWebGPUImpl* pCtx,
                                                         std::vector<uint32_t>&         Offsets,
                                                         Uint32                         GroupIdx) const
@@ -496,7 +547,8 @@ bool ShaderResourceCacheWebGPU::GetDynamicBufferOffsets(const DeviceContextWebGP
         const Resource& Res = Group.GetResource(res);
         if (Res.Type == BindGroupEntryType::UniformBufferDynamic)
         {
-            const Uint32 Offset    = Res.GetDynamicBufferOffset<BufferWebGPUImpl>(pCtx);
+            // Note that dynamic buffers are bound at zero offset (see SetBufferEntryRange())
+            const Uint32 Offset    = StaticCast<Uint32>(Res.BufferBaseOffset) + Res.GetDynamicBufferOffset<BufferWebGPUImpl>(pCtx);
             Uint32&      DstOffset = Offsets[OffsetInd++];
             if (DstOffset != Offset)
                 OffsetsChanged = true;
@@ -513,7 +565,7 @@ bool ShaderResourceCacheWebGPU::GetDynamicBufferOffsets(const DeviceContextWebGP
         if (Res.Type == BindGroupEntryType::StorageBufferDynamic ||
             Res.Type == BindGroupEntryType::StorageBufferDynamic_ReadOnly)
         {
-            const Uint32 Offset    = Res.GetDynamicBufferOffset<BufferViewWebGPUImpl>(pCtx);
+            const Uint32 Offset    = StaticCast<Uint32>(Res.BufferBaseOffset) + Res.GetDynamicBufferOffset<BufferViewWebGPUImpl>(pCtx);
             Uint32&      DstOffset = Offsets[OffsetInd++];
             if (DstOffset != Offset)
                 OffsetsChanged = true;
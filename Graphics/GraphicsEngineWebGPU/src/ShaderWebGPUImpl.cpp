@@ -34,6 +34,8 @@
 #include "HLSLUtils.hpp"
 #include "HLSLParsingTools.hpp"
 #include "SPIRVUtils.hpp"
+#include "Trace.hpp"
+#include "DeviceObjectArchiveWebGPU.hpp"
 
 #if !DILIGENT_NO_GLSLANG
 #    include "GLSLangUtils.hpp"
@@ -159,10 +161,30 @@ std::vector<uint32_t> CompileShaderToSPIRV(const ShaderCreateInfo&             S
 void ShaderWebGPUImpl::Initialize(const ShaderCreateInfo& ShaderCI,
                                   const CreateInfo&       WebGPUShaderCI) noexcept(false)
 {
+    DILIGENT_TRACE_SCOPE("CompileShader");
+
     SHADER_SOURCE_LANGUAGE ParsedSourceLanguage = SHADER_SOURCE_LANGUAGE_DEFAULT;
     SHADER_SOURCE_LANGUAGE SourceLanguage       = ShaderCI.SourceLanguage;
-    if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_DEFAULT ||
-        ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_WGSL)
+
+    // Shaders packed into archive contain WGSL along with the resource reflection produced by the archiver
+    WGSLShaderArchiveData  ArchiveData;
+    DynamicLinearAllocator ArchiveDataAllocator{GetRawAllocator()};
+    if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_WGSL && ShaderCI.ByteCode != nullptr)
+    {
+        Serializer<SerializerMode::Read> Ser{SerializedData{const_cast<void*>(ShaderCI.ByteCode), ShaderCI.ByteCodeSize}};
+        if (!ShaderSerializerWebGPU<SerializerMode::Read>::SerializeArchiveData(Ser, ArchiveData, &ArchiveDataAllocator))
+        {
+            LOG_ERROR_AND_THROW("Failed to read WGSL archive data of shader '", m_Desc.Name, "'. The archive may be corrupted or invalid.");
+        }
+        VERIFY_EXPR(Ser.IsEnded());
+        m_WGSL = ArchiveData.WGSL;
+
+        ParsedSourceLanguage = ParseShaderSourceLanguageDefinition(m_WGSL);
+        if (ParsedSourceLanguage != SHADER_SOURCE_LANGUAGE_DEFAULT)
+            SourceLanguage = ParsedSourceLanguage;
+    }
+    else if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_DEFAULT ||
+             ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_WGSL)
     {
         if (ShaderCI.Macros)
         {
@@ -235,21 +257,59 @@ void ShaderWebGPUImpl::Initialize(const ShaderCreateInfo& ShaderCI,
             ALLOCATE(Allocator, "Memory for WGSLShaderResources", WGSLShaderResources, 1),
             STDDeleterRawMem<void>(Allocator),
         };
-        new (pRawMem.get()) WGSLShaderResources // May throw
+        // Uniform buffer reflection is not stored in the archive and requires parsing WGSL
+        if (ArchiveData.EntryPoint != nullptr && !ShaderCI.LoadConstantBufferReflection)
+        {
+            std::vector<WGSLShaderResourceAttribs> Resources;
+            Resources.reserve(ArchiveData.NumResources);
+            for (Uint32 i = 0; i < ArchiveData.NumResources; ++i)
             {
-                Allocator,
-                m_WGSL,
-                SourceLanguage,
-                m_Desc.Name,
-                m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr,
-                SourceLanguage == SHADER_SOURCE_LANGUAGE_WGSL ? ShaderCI.EntryPoint : nullptr,
-                ShaderCI.WebGPUEmulatedArrayIndexSuffix,
-                ShaderCI.LoadConstantBufferReflection,
-                WebGPUShaderCI.ppCompilerOutput,
-            };
+                const WGSLShaderArchiveData::Resource& Res = ArchiveData.pResources[i];
+                Resources.emplace_back(Res.Name,
+                                       static_cast<WGSLShaderResourceAttribs::ResourceType>(Res.Type),
+                                       Res.ArraySize,
+                                       static_cast<RESOURCE_DIMENSION>(Res.ResourceDim),
+                                       static_cast<TEXTURE_FORMAT>(Res.Format),
+                                       static_cast<WGSLShaderResourceAttribs::TextureSampleType>(Res.SampleType),
+                                       Res.BindGroup,
+                                       Res.BindIndex,
+                                       Res.BufferStaticSize);
+            }
+
+            new (pRawMem.get()) WGSLShaderResources // May throw
+                {
+                    Allocator,
+                    Resources.data(),
+                    StaticCast<Uint32>(Resources.size()),
+                    m_Desc.ShaderType,
+                    m_Desc.Name,
+                    m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr,
+                    ArchiveData.EntryPoint,
+                    ShaderCI.WebGPUEmulatedArrayIndexSuffix,
+                };
+        }
+        else
+        {
+            new (pRawMem.get()) WGSLShaderResources // May throw
+                {
+                    Allocator,
+                    m_WGSL,
+                    SourceLanguage,
+                    m_Desc.Name,
+                    m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr,
+                    SourceLanguage == SHADER_SOURCE_LANGUAGE_WGSL ? ShaderCI.EntryPoint : nullptr,
+                    ShaderCI.WebGPUEmulatedArrayIndexSuffix,
+                    ShaderCI.LoadConstantBufferReflection,
+                    WebGPUShaderCI.ppCompilerOutput,
+                };
+        }
         m_pShaderResources.reset(static_cast<WGSLShaderResources*>(pRawMem.release()), STDDeleterRawMem<WGSLShaderResources>(Allocator));
         m_EntryPoint = m_pShaderResources->GetEntryPoint();
     }
+    else if (ArchiveData.EntryPoint != nullptr)
+    {
+        m_EntryPoint = ArchiveData.EntryPoint;
+    }
 
     m_Status.store(SHADER_STATUS_READY);
 }
@@ -364,4 +424,25 @@ const char* ShaderWebGPUImpl::GetEntryPoint() const
     return m_EntryPoint.c_str();
 }
 
+WGPUShaderModule ShaderWebGPUImpl::GetWebGPUShaderModule()
+{
+    DEV_CHECK_ERR(!IsCompiling(), "Shader module is not available until the shader is compiled. Use GetStatus() to check the shader status.");
+
+    std::lock_guard<std::mutex> Lock{m_ShaderModuleMtx};
+    if (!m_wgpuShaderModule)
+    {
+        WGPUShaderSourceWGSL wgpuShaderCodeDesc{};
+        wgpuShaderCodeDesc.chain.sType = WGPUSType_ShaderSourceWGSL;
+        wgpuShaderCodeDesc.code        = GetWGPUStringView(m_WGSL);
+
+        WGPUShaderModuleDescriptor wgpuShaderModuleDesc{};
+        wgpuShaderModuleDesc.nextInChain = reinterpret_cast<WGPUChainedStruct*>(&wgpuShaderCodeDesc);
+        wgpuShaderModuleDesc.label       = GetWGPUStringView(m_Desc.Name);
+        m_wgpuShaderModule.Reset(wgpuDeviceCreateShaderModule(m_pDevice->GetWebGPUDevice(), &wgpuShaderModuleDesc));
+        if (!m_wgpuShaderModule)
+            LOG_ERROR_MESSAGE("Failed to create WebGPU shader module for shader '", m_Desc.Name, "'.");
+    }
+    return m_wgpuShaderModule;
+}
+
 } // namespace Diligent
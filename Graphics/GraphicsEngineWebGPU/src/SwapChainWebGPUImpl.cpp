@@ -39,6 +39,7 @@
 
 #if PLATFORM_WEB
 #    include <emscripten/html5.h>
+#    include <emscripten/threading.h>
 #endif
 
 namespace Diligent
@@ -328,7 +329,9 @@ public:
         wgpuQueueSubmit(pDeviceContext->GetWebGPUQueue(), 1, &wgpuCmdBuffer.Get());
 
 #if PLATFORM_WEB
-        emscripten_request_animation_frame([](double Time, void* pUserData) -> EM_BOOL { return EM_FALSE; }, nullptr);
+        // An OffscreenCanvas owned by a worker is presented when the worker returns to its event loop
+        if (emscripten_is_main_browser_thread())
+            emscripten_request_animation_frame([](double Time, void* pUserData) -> EM_BOOL { return EM_FALSE; }, nullptr);
 #else
         wgpuSurfacePresent(pSwapChain->GetWebGPUSurface());
 #endif
@@ -36,20 +36,40 @@ namespace Diligent
 
 UploadMemoryManagerWebGPU::Page::Page(UploadMemoryManagerWebGPU& Mgr, size_t Size) :
     m_pMgr{&Mgr},
-    m_Data(Size)
+    m_Size{Size}
 {
     WGPUBufferDescriptor wgpuBufferDesc{};
     wgpuBufferDesc.label = GetWGPUStringView("Upload memory page");
     wgpuBufferDesc.size  = Size;
-    wgpuBufferDesc.usage =
-        WGPUBufferUsage_CopyDst |
-        WGPUBufferUsage_CopySrc |
-        WGPUBufferUsage_Uniform |
-        WGPUBufferUsage_Storage |
-        WGPUBufferUsage_Vertex |
-        WGPUBufferUsage_Index |
-        WGPUBufferUsage_Indirect;
+    if (m_pMgr->m_UseMappedPages)
+    {
+        // Mappable buffers can only be used as the source of copy commands
+        wgpuBufferDesc.usage            = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+        wgpuBufferDesc.mappedAtCreation = true;
+    }
+    else
+    {
+        wgpuBufferDesc.usage =
+            WGPUBufferUsage_CopyDst |
+            WGPUBufferUsage_CopySrc |
+            WGPUBufferUsage_Uniform |
+            WGPUBufferUsage_Storage |
+            WGPUBufferUsage_Vertex |
+            WGPUBufferUsage_Index |
+            WGPUBufferUsage_Indirect;
+    }
     m_wgpuBuffer.Reset(wgpuDeviceCreateBuffer(m_pMgr->m_wgpuDevice, &wgpuBufferDesc));
+
+    if (m_pMgr->m_UseMappedPages)
+    {
+        if (m_wgpuBuffer)
+            m_pMappedData = static_cast<Uint8*>(wgpuBufferGetMappedRange(m_wgpuBuffer, 0, Size));
+        VERIFY(m_pMappedData != nullptr, "Failed to map upload memory page");
+    }
+    else
+    {
+        m_Data.resize(Size);
+    }
     LOG_INFO_MESSAGE("Created a new upload memory page, size: ", FormatMemorySize(Size));
 }
 
@@ -57,8 +77,11 @@ UploadMemoryManagerWebGPU::Page::Page(Page&& RHS) noexcept :
     //clang-format off
     m_pMgr{RHS.m_pMgr},
     m_wgpuBuffer{std::move(RHS.m_wgpuBuffer)},
+    m_Size{RHS.m_Size},
+    m_CurrOffset{RHS.m_CurrOffset},
     m_Data{std::move(RHS.m_Data)},
-    m_CurrOffset{RHS.m_CurrOffset}
+    m_pMappedData{RHS.m_pMappedData},
+    m_pMapSyncPoint{std::move(RHS.m_pMapSyncPoint)}
 // clang-format on
 {
     RHS = Page{};
@@ -69,13 +92,18 @@ UploadMemoryManagerWebGPU::Page& UploadMemoryManagerWebGPU::Page::operator=(Page
     if (&RHS == this)
         return *this;
 
-    m_pMgr       = RHS.m_pMgr;
-    m_wgpuBuffer = std::move(RHS.m_wgpuBuffer);
-    m_Data       = std::move(RHS.m_Data);
-    m_CurrOffset = RHS.m_CurrOffset;
+    m_pMgr          = RHS.m_pMgr;
+    m_wgpuBuffer    = std::move(RHS.m_wgpuBuffer);
+    m_Size          = RHS.m_Size;
+    m_CurrOffset    = RHS.m_CurrOffset;
+    m_Data          = std::move(RHS.m_Data);
+    m_pMappedData   = RHS.m_pMappedData;
+    m_pMapSyncPoint = std::move(RHS.m_pMapSyncPoint);
 
-    RHS.m_pMgr       = nullptr;
-    RHS.m_CurrOffset = 0;
+    RHS.m_pMgr        = nullptr;
+    RHS.m_Size        = 0;
+    RHS.m_CurrOffset  = 0;
+    RHS.m_pMappedData = nullptr;
 
     return *this;
 }
@@ -88,13 +116,17 @@ UploadMemoryManagerWebGPU::Page::~Page()
 UploadMemoryManagerWebGPU::Allocation UploadMemoryManagerWebGPU::Page::Allocate(size_t Size, size_t Alignment)
 {
     VERIFY(IsPowerOfTwo(Alignment), "Alignment size must be a power of two");
+    Uint8* pPageData = m_pMappedData != nullptr ? m_pMappedData : m_Data.data();
+    if (pPageData == nullptr)
+        return Allocation{};
+
     Allocation Alloc;
     Alloc.Offset = AlignUp(m_CurrOffset, Alignment);
     Alloc.Size   = AlignUp(Size, Alignment);
-    if (Alloc.Offset + Alloc.Size <= m_Data.size())
+    if (Alloc.Offset + Alloc.Size <= m_Size)
     {
         Alloc.wgpuBuffer = m_wgpuBuffer;
-        Alloc.pData      = &m_Data[Alloc.Offset];
+        Alloc.pData      = pPageData + Alloc.Offset;
         m_CurrOffset     = Alloc.Offset + Alloc.Size;
         return Alloc;
     }
@@ -103,7 +135,14 @@ UploadMemoryManagerWebGPU::Allocation UploadMemoryManagerWebGPU::Page::Allocate(
 
 void UploadMemoryManagerWebGPU::Page::FlushWrites(WGPUQueue wgpuQueue)
 {
-    if (m_CurrOffset > 0)
+    if (m_pMappedData != nullptr)
+    {
+        // The data has been written in place. The buffer must be unmapped before
+        // the commands that read it are submitted.
+        wgpuBufferUnmap(m_wgpuBuffer);
+        m_pMappedData = nullptr;
+    }
+    else if (m_CurrOffset > 0)
     {
         wgpuQueueWriteBuffer(wgpuQueue, m_wgpuBuffer, 0, m_Data.data(), m_CurrOffset);
     }
@@ -122,8 +161,9 @@ void UploadMemoryManagerWebGPU::Page::Recycle()
 }
 
 
-UploadMemoryManagerWebGPU::UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize) :
+UploadMemoryManagerWebGPU::UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, bool UseMappedPages) :
     m_PageSize{PageSize},
+    m_UseMappedPages{UseMappedPages},
     m_wgpuDevice{wgpuDevice}
 {
     VERIFY(IsPowerOfTwo(m_PageSize), "Page size must be power of two");
@@ -131,14 +171,46 @@ UploadMemoryManagerWebGPU::UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size
 
 UploadMemoryManagerWebGPU::~UploadMemoryManagerWebGPU()
 {
-    VERIFY(m_DbgPageCounter == m_AvailablePages.size(),
+    VERIFY(m_DbgPageCounter == m_AvailablePages.size() + m_PendingPages.size(),
            "Not all pages have been recycled. This may result in a crash if the page is recycled later.");
     size_t TotalSize = 0;
     for (const Page& page : m_AvailablePages)
         TotalSize += page.GetSize();
+    for (const Page& page : m_PendingPages)
+        TotalSize += page.GetSize();
     LOG_INFO_MESSAGE("SharedMemoryManagerWebGPU: total allocated memory: ", FormatMemorySize(TotalSize));
 }
 
+void UploadMemoryManagerWebGPU::ProcessPendingPages()
+{
+    auto Iter = m_PendingPages.begin();
+    while (Iter != m_PendingPages.end())
+    {
+        if (!Iter->m_pMapSyncPoint->IsTriggered())
+        {
+            ++Iter;
+            continue;
+        }
+
+        Iter->m_pMapSyncPoint.Release();
+        if (wgpuBufferGetMapState(Iter->m_wgpuBuffer) == WGPUBufferMapState_Mapped)
+            Iter->m_pMappedData = static_cast<Uint8*>(wgpuBufferGetMappedRange(Iter->m_wgpuBuffer, 0, Iter->m_Size));
+
+        if (Iter->m_pMappedData != nullptr)
+        {
+            m_AvailablePages.emplace_back(std::move(*Iter));
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to map upload memory page. The page will be released.");
+#if DILIGENT_DEBUG
+            m_DbgPageCounter.fetch_sub(1);
+#endif
+        }
+        Iter = m_PendingPages.erase(Iter);
+    }
+}
+
 UploadMemoryManagerWebGPU::Page UploadMemoryManagerWebGPU::GetPage(size_t Size)
 {
     size_t PageSize = m_PageSize;
@@ -148,6 +220,9 @@ UploadMemoryManagerWebGPU::Page UploadMemoryManagerWebGPU::GetPage(size_t Size)
     {
         std::lock_guard Lock{m_AvailablePagesMtx};
 
+        if (!m_PendingPages.empty())
+            ProcessPendingPages();
+
         auto Iter = m_AvailablePages.begin();
         while (Iter != m_AvailablePages.end())
         {
@@ -170,7 +245,28 @@ UploadMemoryManagerWebGPU::Page UploadMemoryManagerWebGPU::GetPage(size_t Size)
 void UploadMemoryManagerWebGPU::RecyclePage(Page&& Item)
 {
     std::lock_guard Lock{m_AvailablePagesMtx};
-    m_AvailablePages.emplace_back(std::move(Item));
+    if (Item.m_wgpuBuffer && m_UseMappedPages && Item.m_pMappedData == nullptr)
+    {
+        auto MapAsyncCallback = [](WGPUBufferMapAsyncStatus MapStatus, void* pUserData) {
+            VERIFY_EXPR(pUserData != nullptr);
+            SyncPointWebGPUImpl* pSyncPoint = static_cast<SyncPointWebGPUImpl*>(pUserData);
+            // The status is checked by ProcessPendingPages() through the buffer map state
+            pSyncPoint->Trigger();
+            pSyncPoint->Release();
+        };
+
+        // The page is recycled after the commands that read it have been submitted, so
+        // the map operation completes when the GPU has finished reading the page.
+        Item.m_pMapSyncPoint = MakeNewRCObj<SyncPointWebGPUImpl>()();
+        // The reference will be released from the callback
+        Item.m_pMapSyncPoint->AddRef();
+        wgpuBufferMapAsync(Item.m_wgpuBuffer, WGPUMapMode_Write, 0, Item.m_Size, MapAsyncCallback, Item.m_pMapSyncPoint.RawPtr());
+        m_PendingPages.emplace_back(std::move(Item));
+    }
+    else
+    {
+        m_AvailablePages.emplace_back(std::move(Item));
+    }
 }
 
 } // namespace Diligent
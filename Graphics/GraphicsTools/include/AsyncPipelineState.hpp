@@ -44,10 +44,12 @@ namespace Diligent
 class RenderStateCacheImpl;
 
 /// Async pipeline state waits until all shaders are loaded before initializing the internal pipeline state.
-class AsyncPipelineState final : public ProxyPipelineState<ObjectBase<IPipelineState>>
+
+/// Until the internal pipeline is ready, the device context binds the fallback pipeline, if one is set.
+class AsyncPipelineState final : public ProxyPipelineState<ObjectBase<IAsyncPipelineState>>
 {
 public:
-    using TBase = ProxyPipelineState<ObjectBase<IPipelineState>>;
+    using TBase = ProxyPipelineState<ObjectBase<IAsyncPipelineState>>;
 
     // {B6EFB3C0-0716-4997-86F1-E3DE8F7E0179}
     static constexpr INTERFACE_ID IID_InternalImpl =
@@ -67,6 +69,24 @@ public:
 
     virtual PIPELINE_STATE_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override;
 
+    virtual void DILIGENT_CALL_TYPE CreateShaderResourceBinding(IShaderResourceBinding** ppShaderResourceBinding, bool InitStaticResources) override;
+
+    virtual void DILIGENT_CALL_TYPE CreateShaderResourceBindings(Uint32 NumSRBs, IShaderResourceBinding** ppSRBs, bool InitStaticResources) override;
+
+    virtual void DILIGENT_CALL_TYPE SetFallback(IPipelineState* pFallback) override final;
+
+    virtual IPipelineState* DILIGENT_CALL_TYPE GetFallback() const override final
+    {
+        return m_pFallback;
+    }
+
+    virtual bool DILIGENT_CALL_TYPE IsUsingFallback() const override final
+    {
+        return m_pFallback && m_Status != PIPELINE_STATE_STATUS_READY;
+    }
+
+    virtual void DILIGENT_CALL_TYPE SetStatusCallback(AsyncPipelineStatusCallbackType Callback, void* pUserData) override final;
+
     static void Create(RenderStateCacheImpl*          pStateCache,
                        const PipelineStateCreateInfo& CreateInfo,
                        IPipelineState**               ppReloadablePipeline);
@@ -74,6 +94,14 @@ public:
 private:
     void InitInternalPipeline();
 
+    PIPELINE_STATE_STATUS UpdateStatus(bool WaitForCompletion);
+
+    // Returns the pipeline that shader resource bindings are created from
+    IPipelineState* GetSRBSourcePipeline() const
+    {
+        return m_pPipeline ? m_pPipeline.RawPtr() : m_pFallback.RawPtr();
+    }
+
 private:
     struct CreateInfoWrapperBase;
 
@@ -83,6 +111,14 @@ private:
     RefCntAutoPtr<RenderStateCacheImpl>    m_pStateCache;
     std::unique_ptr<CreateInfoWrapperBase> m_pCreateInfo;
     UniqueIdHelper<AsyncPipelineState>     m_UniqueID;
+
+    RefCntAutoPtr<IPipelineState> m_pFallback;
+
+    AsyncPipelineStatusCallbackType m_StatusCallback          = nullptr;
+    void*                           m_pStatusCallbackUserData = nullptr;
+
+    PIPELINE_STATE_STATUS m_Status         = PIPELINE_STATE_STATUS_COMPILING;
+    bool                  m_StatusReported = false;
 };
 
 } // namespace Diligent
@@ -132,6 +132,15 @@ public:
         }
     }
 
+    virtual void DILIGENT_CALL_TYPE CreateShaderResourceBindings(Uint32 NumSRBs, IShaderResourceBinding** ppSRBs, bool InitStaticResources) override
+    {
+        DEV_CHECK_ERR(m_pPipeline, "Internal pipeline is null");
+        if (m_pPipeline)
+        {
+            m_pPipeline->CreateShaderResourceBindings(NumSRBs, ppSRBs, InitStaticResources);
+        }
+    }
+
     virtual void DILIGENT_CALL_TYPE InitializeStaticSRBResources(IShaderResourceBinding* pShaderResourceBinding) const override
     {
         DEV_CHECK_ERR(m_pPipeline, "Internal pipeline is null");
@@ -174,6 +183,13 @@ public:
         return m_pPipeline ? m_pPipeline->GetStatus(WaitForCompletion) : PIPELINE_STATE_STATUS_UNINITIALIZED;
     }
 
+    virtual const PipelineStateCompileStats& DILIGENT_CALL_TYPE GetCompileStats() const override
+    {
+        DEV_CHECK_ERR(m_pPipeline, "Internal pipeline is null");
+        static constexpr PipelineStateCompileStats NullStats;
+        return m_pPipeline ? m_pPipeline->GetCompileStats() : NullStats;
+    }
+
 protected:
     const std::string       m_Name;
     const PipelineStateDesc m_Desc;
@@ -29,8 +29,12 @@
 /// \file
 /// Definition of the Diligent::ReloadableShader class
 
+#include <vector>
+#include <string>
+
 #include "Shader.h"
 #include "ShaderBase.hpp"
+#include "XXH128Hasher.hpp"
 
 namespace Diligent
 {
@@ -48,10 +52,11 @@ public:
     static constexpr INTERFACE_ID IID_InternalImpl =
         {0x6bfaaabd, 0xfe55, 0x4420, {0xb0, 0xc8, 0x5c, 0x4b, 0x4f, 0x5f, 0x8d, 0x65}};
 
-    ReloadableShader(IReferenceCounters*     pRefCounters,
-                     RenderStateCacheImpl*   pStateCache,
-                     IShader*                pShader,
-                     const ShaderCreateInfo& CreateInfo);
+    ReloadableShader(IReferenceCounters*              pRefCounters,
+                     RenderStateCacheImpl*            pStateCache,
+                     IShader*                         pShader,
+                     const ShaderCreateInfo&          CreateInfo,
+                     IShaderSourceInputStreamFactory* pShaderSourceFactory);
 
     ~ReloadableShader();
 
@@ -104,17 +109,41 @@ public:
         return m_pShader->GetStatus(WaitForCompletion);
     }
 
-    static void Create(RenderStateCacheImpl*   pStateCache,
-                       IShader*                pShader,
-                       const ShaderCreateInfo& CreateInfo,
-                       IShader**               ppReloadableShader);
+    /// \param [in] CreateInfo           - Shader create info that is used to reload the shader.
+    /// \param [in] pShaderSourceFactory - Shader source factory that pShader was created with.
+    ///                                    It may be different from the factory in CreateInfo
+    ///                                    when the render state cache uses a reload source.
+    static void Create(RenderStateCacheImpl*            pStateCache,
+                       IShader*                         pShader,
+                       const ShaderCreateInfo&          CreateInfo,
+                       IShaderSourceInputStreamFactory* pShaderSourceFactory,
+                       IShader**                        ppReloadableShader);
 
     bool Reload();
 
+    /// Returns true if any of the source files the shader was created from has
+    /// changed since the shader was created or last reloaded.
+    bool HasSourceChanges() const;
+
+private:
+    void UpdateSourceFiles(IShaderSourceInputStreamFactory* pShaderSourceFactory);
+
 private:
     RefCntAutoPtr<RenderStateCacheImpl> m_pStateCache;
     RefCntAutoPtr<IShader>              m_pShader;
     ShaderCreateInfoWrapper             m_CreateInfo;
+
+    struct SourceFileInfo
+    {
+        std::string Path;
+        XXH128Hash  Hash;
+    };
+    // The main source file and all files it includes
+    std::vector<SourceFileInfo> m_SourceFiles;
+
+    // False if the source files could not be determined,
+    // in which case the shader is always reloaded.
+    bool m_SourceFilesValid = false;
 };
 
 } // namespace Diligent
@@ -30,7 +30,11 @@
 /// Definition of the Diligent::RenderStateCacheImpl class
 
 #include <unordered_map>
+#include <memory>
 #include <mutex>
+#include <atomic>
+#include <vector>
+#include <string>
 
 #include "RenderStateCache.h"
 #include "SerializationDevice.h"
@@ -52,14 +56,13 @@ public:
     RenderStateCacheImpl(IReferenceCounters*               pRefCounters,
                          const RenderStateCacheCreateInfo& CreateInfo);
 
+    ~RenderStateCacheImpl();
+
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_RenderStateCache, TBase);
 
     virtual bool DILIGENT_CALL_TYPE Load(const IDataBlob* pArchive,
                                          Uint32           ContentVersion,
-                                         bool             MakeCopy) override final
-    {
-        return m_pDearchiver->LoadArchive(pArchive, ContentVersion, MakeCopy);
-    }
+                                         bool             MakeCopy) override final;
 
     virtual bool DILIGENT_CALL_TYPE CreateShader(const ShaderCreateInfo& ShaderCI,
                                                  IShader**               ppShader) override final;
@@ -96,6 +99,15 @@ public:
 
     virtual Bool DILIGENT_CALL_TYPE WriteToStream(Uint32 ContentVersion, IFileStream* pStream) override final;
 
+    virtual Bool DILIGENT_CALL_TYPE WriteDeltaToBlob(Uint32 ContentVersion, IDataBlob** ppBlob) override final;
+
+    virtual Bool DILIGENT_CALL_TYPE WriteDeltaToStream(Uint32 ContentVersion, IFileStream* pStream) override final;
+
+    virtual Bool DILIGENT_CALL_TYPE NeedsCompaction() const override final
+    {
+        return m_NeedsCompaction;
+    }
+
     virtual void DILIGENT_CALL_TYPE Reset() override final;
 
     virtual Uint32 DILIGENT_CALL_TYPE Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData) override final;
@@ -110,6 +122,12 @@ public:
         return m_ReloadVersion;
     }
 
+    virtual Uint32 DILIGENT_CALL_TYPE Prewarm(IAsyncTask** ppTask) override final;
+
+    virtual Uint32 DILIGENT_CALL_TYPE Precompile(IThreadPool* pThreadPool, Float32 Priority, IAsyncTask** ppTask) override final;
+
+    virtual void DILIGENT_CALL_TYPE GetPrecompileProgress(RenderStateCachePrecompileProgress& Progress) const override final;
+
     bool CreateShaderInternal(const ShaderCreateInfo& ShaderCI,
                               IShader**               ppShader);
 
@@ -120,10 +138,25 @@ public:
     RefCntAutoPtr<IShader> FindReloadableShader(IShader* pShader);
 
 private:
+    bool LoadArchiveData(const IDataBlob* pArchive, Uint32 ContentVersion, bool MakeCopy);
+    bool MergeNewStates(Uint32 ContentVersion, IDataBlob** ppNewData);
+
+    static RefCntAutoPtr<IDataBlob> MakeJournalSegment(const IDataBlob* pArchive);
+
     static std::string HashToStr(Uint64 Low, Uint64 High);
 
     static std::string MakeHashStr(const char* Name, const XXH128Hash& Hash);
 
+    struct ArchivedObjectInfo;
+    struct ArchivedPipelineInfo;
+    static bool ParseHashStr(const char* HashStr, ArchivedObjectInfo& Info);
+
+    Uint32 StartPrecompile(IThreadPool* pThreadPool, float Priority, bool IncludeShaders, IAsyncTask** ppTask);
+    void   PrecompileStates(const std::vector<ArchivedObjectInfo>& Shaders, const std::vector<ArchivedPipelineInfo>& Pipelines);
+    bool   PrecompileShader(const ArchivedObjectInfo& Info);
+    Uint32 PrewarmPipelines(const ArchivedPipelineInfo* pPipelines, size_t NumPipelines);
+    void   WaitForPrewarm();
+
     template <typename CreateInfoType>
     struct SerializedPsoCIWrapperBase;
 
@@ -134,6 +167,10 @@ private:
     bool CreatePipelineState(const CreateInfoType& PSOCreateInfo,
                              IPipelineState**      ppPipelineState);
 
+    RefCntAutoPtr<IShader> CreateShaderFromDeviceShader(IShader* pDeviceShader, const ShaderDesc& Desc);
+
+    bool IsCompatibleSharedCache(const RenderStateCacheImpl& SharedCache) const;
+
 private:
     RefCntAutoPtr<IRenderDevice>                   m_pDevice;
     const RENDER_DEVICE_TYPE                       m_DeviceType;
@@ -143,6 +180,26 @@ private:
     RefCntAutoPtr<IArchiver>                       m_pArchiver;
     RefCntAutoPtr<IDearchiver>                     m_pDearchiver;
 
+    // Data shared by the caches of different devices, see RenderStateCacheCreateInfo::pSharedCache.
+    // Dearchivers keep the unpacked device objects and are never shared.
+    struct SharedData
+    {
+        RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+        RefCntAutoPtr<IArchiver>            pArchiver;
+
+        // The number of shaders and pipelines added to the archiver since the last write
+        std::atomic<Uint32> NumUnsavedStates{0};
+
+        // All caches that share the data
+        std::mutex                         CachesMtx;
+        std::vector<RenderStateCacheImpl*> Caches;
+    };
+    std::shared_ptr<SharedData> m_pSharedData;
+
+    // Whether the device shaders of the serialized shaders are created by this cache's device.
+    // If false, the data is shared with a cache of another device.
+    bool m_OwnsSerializationDevice = true;
+
     std::mutex                                             m_ShadersMtx;
     std::unordered_map<XXH128Hash, RefCntWeakPtr<IShader>> m_Shaders;
 
@@ -155,6 +212,38 @@ private:
     std::mutex                                                          m_ReloadablePipelinesMtx;
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IPipelineState>> m_ReloadablePipelines;
 
+    struct ArchivedObjectInfo
+    {
+        std::string ArchiveName;
+        std::string Name;
+        bool        HasName = false;
+        XXH128Hash  Hash;
+    };
+    struct ArchivedPipelineInfo : ArchivedObjectInfo
+    {
+        PIPELINE_TYPE Type = PIPELINE_TYPE_INVALID;
+    };
+    // Shaders and pipelines in the data loaded by Load()
+    std::vector<ArchivedObjectInfo>   m_ArchivedShaders;
+    std::vector<ArchivedPipelineInfo> m_ArchivedPipelines;
+
+    // Strong references to the objects created by Prewarm() and Precompile()
+    std::mutex                                 m_PrewarmedPipelinesMtx;
+    std::vector<RefCntAutoPtr<IPipelineState>> m_PrewarmedPipelines;
+    std::mutex                                 m_PrecompiledShadersMtx;
+    std::vector<RefCntAutoPtr<IShader>>        m_PrecompiledShaders;
+
+    RefCntAutoPtr<IAsyncTask>  m_pPrewarmTask;
+    RefCntAutoPtr<IThreadPool> m_pPrewarmThreadPool;
+    std::atomic<bool>          m_AbortPrewarm{false};
+
+    std::atomic<Uint32> m_NumShadersToPrecompile{0};
+    std::atomic<Uint32> m_NumShadersPrecompiled{0};
+    std::atomic<Uint32> m_NumPipelinesToPrecompile{0};
+    std::atomic<Uint32> m_NumPipelinesPrecompiled{0};
+
+    bool m_NeedsCompaction = false;
+
     Uint32 m_ReloadVersion = 0;
 };
 
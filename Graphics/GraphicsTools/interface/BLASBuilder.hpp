@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::BLASBuilder class
+
+#include <vector>
+#include <functional>
+#include <memory>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/BottomLevelAS.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "ReadbackQueue.hpp"
+
+namespace Diligent
+{
+
+/// BLAS builder create information.
+struct BLASBuilderCreateInfo
+{
+    /// The maximum size of the shared scratch buffer.
+
+    /// All builds passed to BLASBuilder::Build() share one scratch buffer, every build
+    /// using its own region. If the total scratch size exceeds this value, the builds
+    /// are split into several batches that reuse the buffer.
+    /// Zero means that the size is not limited.
+    Uint64 MaxScratchBufferSize = 0;
+
+    /// Whether to compact the acceleration structures created with
+    /// Diligent::RAYTRACING_BUILD_AS_ALLOW_COMPACTION flag.
+    bool Compact = true;
+};
+
+
+/// Builds multiple bottom-level acceleration structures at once and compacts them.
+
+/// The builder sizes one scratch buffer for all builds so that they use disjoint regions
+/// and are not separated by barriers. When compaction is enabled, the builder then writes
+/// the compacted sizes of all BLASes that allow compaction, reads them back asynchronously
+/// and, once the sizes are available, creates the compacted BLASes and copies the original
+/// ones into them. The original BLAS can be used until the compaction callback is called.
+///
+/// Typical usage:
+///
+///     BLASBuilder Builder{pDevice};
+///     ...
+///     Builder.Build(pCtx, BuildInfos.data(), static_cast<Uint32>(BuildInfos.size()),
+///                   [&](IBottomLevelAS* pSrcBLAS, IBottomLevelAS* pCompactedBLAS) {
+///                       ReplaceBLAS(pSrcBLAS, pCompactedBLAS);
+///                   });
+///     ...
+///     Builder.Poll(pCtx); // Once per frame
+///
+/// \remarks    All methods must be called from the same thread that uses the immediate device context.
+///             The builder is not thread-safe.
+class BLASBuilder
+{
+public:
+    /// BLAS build information.
+    struct BuildInfo
+    {
+        /// The BLAS to build.
+        IBottomLevelAS* pBLAS = nullptr;
+
+        /// Triangle geometry data, see BuildBLASAttribs::pTriangleData.
+        const BLASBuildTriangleData* pTriangleData = nullptr;
+
+        /// The number of triangle geometries.
+        Uint32 TriangleDataCount = 0;
+
+        /// AABB geometry data, see BuildBLASAttribs::pBoxData.
+        const BLASBuildBoundingBoxData* pBoxData = nullptr;
+
+        /// The number of AABB geometries.
+        Uint32 BoxDataCount = 0;
+
+        /// Geometry source buffers state transition mode.
+        RESOURCE_STATE_TRANSITION_MODE GeometryTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    };
+
+    /// Compaction callback type.
+
+    /// The callback receives the original BLAS and its compacted copy. The copy command has been
+    /// recorded in the device context when the callback is called, so the compacted BLAS can be used
+    /// in subsequent commands, and the original BLAS can be released.
+    using CompactionCallbackType = std::function<void(IBottomLevelAS* pSrcBLAS, IBottomLevelAS* pCompactedBLAS)>;
+
+    BLASBuilder(IRenderDevice* pDevice, const BLASBuilderCreateInfo& CI = {});
+
+    // clang-format off
+    BLASBuilder           (const BLASBuilder&) = delete;
+    BLASBuilder& operator=(const BLASBuilder&) = delete;
+    BLASBuilder           (BLASBuilder&&)      = delete;
+    BLASBuilder& operator=(BLASBuilder&&)      = delete;
+    // clang-format on
+
+    /// Records the commands to build the acceleration structures.
+
+    /// \param [in] pCtx         - Immediate device context to record the commands.
+    /// \param [in] pBuildInfos  - Array of NumBuilds build infos.
+    /// \param [in] NumBuilds    - The number of elements in pBuildInfos.
+    /// \param [in] OnCompacted  - Optional callback that is called by Poll() for every compacted BLAS.
+    ///                            If the callback is null, or compaction is disabled, BLASes are not compacted.
+    ///
+    /// \return     true if all builds have been recorded, and false otherwise.
+    bool Build(IDeviceContext*        pCtx,
+               const BuildInfo*       pBuildInfos,
+               Uint32                 NumBuilds,
+               CompactionCallbackType OnCompacted = {});
+
+    /// Compacts the acceleration structures whose compacted sizes have been read back.
+
+    /// \param [in] pCtx - Immediate device context to record the copy commands.
+    ///
+    /// \return     The number of BLASes compacted by this call.
+    Uint32 Poll(IDeviceContext* pCtx);
+
+    /// Returns the number of BLASes that are waiting for compaction.
+    Uint32 GetNumPendingCompactions() const { return m_NumPendingCompactions; }
+
+private:
+    struct CompactionBatch
+    {
+        std::vector<RefCntAutoPtr<IBottomLevelAS>> BLASes;
+        std::vector<Uint64>                        CompactedSizes;
+        CompactionCallbackType                     Callback;
+        bool                                       SizesReady = false;
+    };
+
+    IBuffer* GetScratchBuffer(Uint64 Size);
+
+    void WriteCompactedSizes(IDeviceContext* pCtx, std::vector<RefCntAutoPtr<IBottomLevelAS>>&& BLASes, CompactionCallbackType&& Callback);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const Uint64 m_MaxScratchBufferSize;
+    const bool   m_Compact;
+    const Uint32 m_ScratchBufferAlignment;
+
+    RefCntAutoPtr<IBuffer> m_pScratchBuffer;
+
+    ReadbackQueue m_Readbacks;
+
+    // Batches are kept in the order they were submitted; readbacks complete in the same order.
+    std::vector<std::unique_ptr<CompactionBatch>> m_CompactionBatches;
+
+    Uint32 m_NumPendingCompactions = 0;
+};
+
+} // namespace Diligent
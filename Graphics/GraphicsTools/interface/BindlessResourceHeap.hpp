@@ -0,0 +1,218 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::BindlessResourceHeap class
+
+#include <array>
+#include <mutex>
+#include <vector>
+#include <deque>
+#include <utility>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/PipelineResourceSignature.h"
+#include "../../GraphicsEngine/interface/ShaderResourceBinding.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Bindless resource heap create information.
+struct BindlessResourceHeapCreateInfo
+{
+    /// Heap name. Used to name the resource signature and the SRB.
+    const char* Name = nullptr;
+
+    /// Shader stages that access the heap.
+    SHADER_TYPE ShaderStages = SHADER_TYPE_ALL_GRAPHICS | SHADER_TYPE_COMPUTE;
+
+    /// Binding index of the resource signature, see Diligent::PipelineResourceSignatureDesc::BindingIndex.
+    Uint8 BindingIndex = 0;
+
+    /// The maximum number of texture SRVs in the heap. Zero disables the array.
+    Uint32 NumTextureSRVs = 0;
+
+    /// The maximum number of texture UAVs in the heap. Zero disables the array.
+    Uint32 NumTextureUAVs = 0;
+
+    /// The maximum number of buffer SRVs in the heap. Zero disables the array.
+    Uint32 NumBufferSRVs = 0;
+
+    /// The maximum number of buffer UAVs in the heap. Zero disables the array.
+    Uint32 NumBufferUAVs = 0;
+
+    /// The maximum number of samplers in the heap. Zero disables the array.
+    Uint32 NumSamplers = 0;
+
+    /// Shader names of the resource arrays.
+    const char* TextureSRVsName = "g_Textures";
+    const char* TextureUAVsName = "g_RWTextures";
+    const char* BufferSRVsName  = "g_Buffers";
+    const char* BufferUAVsName  = "g_RWBuffers";
+    const char* SamplersName    = "g_Samplers";
+
+    /// Flags of buffer SRV and UAV arrays.
+
+    /// Use Diligent::PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER if the heap will hold formatted
+    /// buffer views.
+    PIPELINE_RESOURCE_FLAGS BufferFlags = PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS;
+
+    /// The number of FinishFrame() calls after which a released index may be reused.
+
+    /// This should be at least the number of frames the GPU may lag behind the CPU.
+    Uint32 NumFramesInFlight = 3;
+};
+
+/// Device-wide table of shader resources addressed by index.
+
+/// The heap creates a pipeline resource signature that contains a run-time sized array
+/// for every enabled resource type, and a single shader resource binding object
+/// for the signature. Every resource put into the heap gets an index that stays
+/// valid until the resource is released. Shaders access resources by this index,
+/// for example:
+///
+///     Texture2D    g_Textures[];
+///     SamplerState g_Samplers[];
+///     ...
+///     g_Textures[MaterialAttribs.AlbedoId].Sample(g_Samplers[MaterialAttribs.SamplerId], UV)
+///
+/// An application includes the signature in every pipeline that uses the heap and commits
+/// the SRB once. Per-draw resource selection then only requires passing the indices to the
+/// shader, e.g. through a constant buffer or a vertex attribute.
+///
+/// The heap requires Diligent::DeviceFeatures::BindlessResources and
+/// Diligent::DeviceFeatures::ShaderResourceRuntimeArrays features, and is thus
+/// only available in Direct3D12 and Vulkan backends.
+///
+/// Released indices are not reused until FinishFrame() has been called NumFramesInFlight
+/// times so that the GPU is not accessing the slot when it is rebound. Update() rebinds
+/// the slot immediately and follows the rules of Diligent::SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE:
+/// an application must make sure the GPU is not accessing the slot.
+/// Shaders must only access allocated indices.
+///
+/// All methods are thread-safe.
+class BindlessResourceHeap
+{
+public:
+    /// Invalid resource index.
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// Creates the heap.
+
+    /// \param[in] pDevice    - Render device that will be used to create the resource signature.
+    /// \param[in] CreateInfo - Heap create information, see Diligent::BindlessResourceHeapCreateInfo.
+    ///
+    /// The constructor throws an exception if the heap can't be created.
+    BindlessResourceHeap(IRenderDevice* pDevice, const BindlessResourceHeapCreateInfo& CreateInfo);
+
+    // clang-format off
+    BindlessResourceHeap           (const BindlessResourceHeap&)  = delete;
+    BindlessResourceHeap& operator=(const BindlessResourceHeap&)  = delete;
+    BindlessResourceHeap           (      BindlessResourceHeap&&) = delete;
+    BindlessResourceHeap& operator=(      BindlessResourceHeap&&) = delete;
+    // clang-format on
+
+    /// Puts the object into the heap and returns its index.
+
+    /// \param[in] Type    - Resource type: Diligent::SHADER_RESOURCE_TYPE_TEXTURE_SRV,
+    ///                      Diligent::SHADER_RESOURCE_TYPE_TEXTURE_UAV, Diligent::SHADER_RESOURCE_TYPE_BUFFER_SRV,
+    ///                      Diligent::SHADER_RESOURCE_TYPE_BUFFER_UAV, or Diligent::SHADER_RESOURCE_TYPE_SAMPLER.
+    /// \param[in] pObject - Texture view, buffer view or sampler to put into the heap.
+    ///
+    /// \return     The index of the object in the shader array of the given type,
+    ///             or InvalidIndex if the array is full.
+    Uint32 Allocate(SHADER_RESOURCE_TYPE Type, IDeviceObject* pObject);
+
+    /// Replaces the object at the given index.
+    void Update(SHADER_RESOURCE_TYPE Type, Uint32 Index, IDeviceObject* pObject);
+
+    /// Releases the index. The index will be reused after NumFramesInFlight calls to FinishFrame().
+    void Release(SHADER_RESOURCE_TYPE Type, Uint32 Index);
+
+    /// Ends the frame and makes the indices released NumFramesInFlight frames ago available.
+    void FinishFrame();
+
+    /// Returns the resource signature that must be included into pipelines that use the heap.
+    IPipelineResourceSignature* GetSignature() const
+    {
+        return m_pSignature;
+    }
+
+    /// Returns the shader resource binding object that holds the heap resources.
+    IShaderResourceBinding* GetSRB() const
+    {
+        return m_pSRB;
+    }
+
+    /// Returns the maximum number of resources of the given type.
+    Uint32 GetCapacity(SHADER_RESOURCE_TYPE Type) const;
+
+    /// Returns the number of allocated resources of the given type.
+    Uint32 GetAllocatedCount(SHADER_RESOURCE_TYPE Type) const;
+
+private:
+    enum RESOURCE_ARRAY : Uint32
+    {
+        RESOURCE_ARRAY_TEXTURE_SRV = 0,
+        RESOURCE_ARRAY_TEXTURE_UAV,
+        RESOURCE_ARRAY_BUFFER_SRV,
+        RESOURCE_ARRAY_BUFFER_UAV,
+        RESOURCE_ARRAY_SAMPLER,
+        RESOURCE_ARRAY_COUNT
+    };
+    static RESOURCE_ARRAY GetResourceArray(SHADER_RESOURCE_TYPE Type);
+
+    struct ResourceArray
+    {
+        IShaderResourceVariable* pVar = nullptr;
+
+        Uint32 Capacity     = 0;
+        Uint32 NextIndex    = 0;
+        Uint32 NumAllocated = 0;
+
+        std::vector<Uint32> FreeIndices;
+
+        // Indices released by the application and the frame number when they were released
+        std::deque<std::pair<Uint64, Uint32>> StaleIndices;
+    };
+
+    void SetObject(ResourceArray& Arr, Uint32 Index, IDeviceObject* pObject);
+
+    const Uint32 m_NumFramesInFlight;
+
+    RefCntAutoPtr<IPipelineResourceSignature> m_pSignature;
+    RefCntAutoPtr<IShaderResourceBinding>     m_pSRB;
+
+    mutable std::mutex                              m_Mtx;
+    Uint64                                          m_FrameNumber = 0;
+    std::array<ResourceArray, RESOURCE_ARRAY_COUNT> m_Arrays;
+};
+
+} // namespace Diligent
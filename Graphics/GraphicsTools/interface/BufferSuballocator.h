@@ -159,8 +159,28 @@ struct IBufferSuballocator : public IObject
 
     /// Returns the internal buffer version.
 
-    /// The version is incremented every time the buffer is expanded.
+    /// The version is incremented every time the buffer is expanded
+    /// and every time Defragment() moves suballocations.
     virtual Uint32 GetVersion() const = 0;
+
+
+    /// Incrementally compacts the suballocations towards the beginning of the buffer.
+
+    /// \param[in] pDevice          - Render device that is used to create the scratch buffer.
+    /// \param[in] pContext         - Device context that records the copy commands.
+    /// \param[in] MaxBytesPerFrame - Maximum number of bytes to move during this call.
+    ///
+    /// \return    The number of bytes moved.
+    ///
+    /// \remarks    Suballocations from the end of the buffer are moved to the lowest free
+    ///             regions that can hold them. Their offsets returned by
+    ///             IBufferSuballocation::GetOffset() change, and the allocator version
+    ///             is incremented if any data was moved, so the application must refresh any
+    ///             cached offsets (e.g. in draw commands) when the version changes.
+    ///
+    ///             The method is a no-op for dynamic and staging buffers.
+    ///             The buffer is not shrunk.
+    virtual Uint32 Defragment(IRenderDevice* pDevice, IDeviceContext* pContext, Uint32 MaxBytesPerFrame) = 0;
 };
 
 /// Buffer suballocator create information.
@@ -35,6 +35,23 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 struct BytecodeCacheCreateInfo
 {
     enum RENDER_DEVICE_TYPE DeviceType DEFAULT_INITIALIZER(RENDER_DEVICE_TYPE_UNDEFINED);
+
+    /// Path to the directory that backs the cache.
+
+    /// If not null, every cache entry is stored in a separate file in this directory
+    /// named after the hash of the shader create parameters. Entries are read from
+    /// the directory when they are requested and are not kept in memory. Files are
+    /// written atomically, so the directory may be shared by multiple processes.
+    /// The directory is created if it does not exist.
+    ///
+    /// If null, the cache is kept in memory.
+    const Char* Directory DEFAULT_INITIALIZER(nullptr);
+
+    /// The maximum total size of the entries in the cache directory, in bytes.
+
+    /// When the size is exceeded, the least recently used entries are removed.
+    /// Zero means no limit. This member is ignored if Directory is null.
+    Uint64 MaxDirectorySize DEFAULT_INITIALIZER(0);
 };
 typedef struct BytecodeCacheCreateInfo BytecodeCacheCreateInfo;
 
@@ -59,6 +76,8 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
 
     /// \param [in] pData - A pointer to the cache data.
     /// \return     true if the data was loaded successfully, and false otherwise.
+    ///
+    /// \remarks    If the cache is backed by a directory, the entries are written to the directory.
     VIRTUAL bool METHOD(Load)(THIS_
                               IDataBlob* pData) PURE;
 
@@ -98,11 +117,14 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
     ///                           one reference.
     ///
     /// \remarks    The data produced by this method is intended to be used by the Load method.
+    ///             If the cache is backed by a directory, all entries in the directory are read.
     VIRTUAL void METHOD(Store)(THIS_
                                IDataBlob** ppDataBlob) PURE;
 
 
     /// Clears the cache and resets it to default state.
+
+    /// \remarks    If the cache is backed by a directory, all entries are removed from the directory.
     VIRTUAL void METHOD(Clear)(THIS) PURE;
 };
 DILIGENT_END_INTERFACE
@@ -0,0 +1,281 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::DynamicResolutionScaler and Diligent::DynamicResolutionController classes
+
+#include <memory>
+#include <unordered_map>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/BasicMath.hpp"
+#include "DurationQueryHelper.hpp"
+
+namespace Diligent
+{
+
+/// Dynamic resolution scaler description.
+struct DynamicResolutionScalerDesc
+{
+    /// Target GPU frame time, in seconds.
+    double TargetFrameTime = 1.0 / 60.0;
+
+    /// Minimum render scale.
+    float MinScale = 0.5f;
+
+    /// Maximum render scale.
+    float MaxScale = 1.0f;
+
+    /// Scale quantization step.
+
+    /// The scale is always a multiple of the step (clamped to [MinScale, MaxScale]), so that small
+    /// timing fluctuations do not change the resolution every frame.
+    float ScaleStep = 0.05f;
+
+    /// The scale is decreased when the filtered frame time exceeds the target frame time
+    /// multiplied by this factor for NumFramesToDecrease consecutive frames.
+    float DecreaseThreshold = 0.95f;
+
+    /// The scale is increased when the filtered frame time is below the target frame time
+    /// multiplied by this factor for NumFramesToIncrease consecutive frames.
+
+    /// The gap between IncreaseThreshold and DecreaseThreshold is the hysteresis band
+    /// in which the scale does not change.
+    float IncreaseThreshold = 0.75f;
+
+    /// The number of consecutive over-budget frames required to decrease the scale.
+    Uint32 NumFramesToDecrease = 2;
+
+    /// The number of consecutive under-budget frames required to increase the scale.
+
+    /// The value is typically much larger than NumFramesToDecrease: a missed frame is visible
+    /// immediately, while a resolution increase can wait.
+    Uint32 NumFramesToIncrease = 30;
+
+    /// Exponential smoothing factor of the frame time, in the range (0, 1].
+
+    /// Larger values make the filter react faster, 1 disables the filtering.
+    float SmoothingFactor = 0.2f;
+};
+
+
+/// Selects the render scale from the measured GPU frame time.
+
+/// The scaler does not use the GPU and can be used with any timing source.
+/// The frame time is assumed to be proportional to the number of pixels, so the
+/// scale is changed by the square root of the ratio of the desired and the measured time.
+class DynamicResolutionScaler
+{
+public:
+    explicit DynamicResolutionScaler(const DynamicResolutionScalerDesc& Desc = {});
+
+    /// Processes the frame time and updates the scale.
+
+    /// \param [in] FrameTime - GPU frame time, in seconds.
+    /// \return     true if the scale has changed, and false otherwise.
+    bool Update(double FrameTime);
+
+    /// Sets the scale, which is clamped to [MinScale, MaxScale], and resets the frame time history.
+    void SetScale(float Scale);
+
+    /// Resets the frame time history without changing the scale.
+    void Reset();
+
+    /// Returns the current render scale.
+    float GetScale() const { return m_Scale; }
+
+    /// Returns the filtered frame time, in seconds, or zero if no frames have been processed since the last reset.
+    double GetFilteredFrameTime() const { return m_FilteredFrameTime; }
+
+    const DynamicResolutionScalerDesc& GetDesc() const { return m_Desc; }
+
+private:
+    float QuantizeScale(float Scale) const;
+
+private:
+    const DynamicResolutionScalerDesc m_Desc;
+
+    float  m_Scale             = 1;
+    double m_FilteredFrameTime = 0;
+    Uint32 m_NumOverBudget     = 0;
+    Uint32 m_NumUnderBudget    = 0;
+};
+
+
+/// Dynamic resolution controller create information.
+struct DynamicResolutionControllerCreateInfo
+{
+    /// Maximum render width, typically the swap chain width.
+    Uint32 MaxWidth = 0;
+
+    /// Maximum render height, typically the swap chain height.
+    Uint32 MaxHeight = 0;
+
+    /// Format of the color render target.
+    TEXTURE_FORMAT ColorFormat = TEX_FORMAT_RGBA8_UNORM;
+
+    /// Format of the depth render target, or Diligent::TEX_FORMAT_UNKNOWN if depth is not needed.
+    TEXTURE_FORMAT DepthFormat = TEX_FORMAT_D32_FLOAT;
+
+    /// Scaler description, see Diligent::DynamicResolutionScalerDesc.
+    DynamicResolutionScalerDesc Scaler;
+};
+
+
+/// Changes the render resolution to keep the GPU frame time within the budget.
+
+/// The render targets are allocated once at the maximum size, and the scene is rendered into the
+/// top-left sub-rectangle that matches the current scale, so changing the scale never reallocates
+/// the textures. The GPU frame time is measured with timestamp queries between BeginFrame() and
+/// EndFrame(), and the result becomes available a few frames later. Upscale() resolves the
+/// rendered sub-rectangle into a full-size render target with bilinear filtering.
+///
+/// Typical usage:
+///
+///     DynamicResolutionController DynRes{pDevice, {SCDesc.Width, SCDesc.Height, TEX_FORMAT_RGBA8_UNORM_SRGB}};
+///     ...
+///     DynRes.BeginFrame(pCtx);
+///     DynRes.SetRenderTargets(pCtx);
+///     // Render the scene; screen-space passes must use DynRes.GetViewport() and DynRes.GetUVScale()
+///     DynRes.Upscale(pCtx, pSwapChain->GetCurrentBackBufferRTV());
+///     // Render UI at full resolution
+///     DynRes.EndFrame(pCtx);
+///
+/// \remarks    Timing requires Diligent::DeviceFeatures::TimestampQueries. If the feature is not
+///             enabled, the scale only changes through SetScale(). The controller is not thread-safe.
+class DynamicResolutionController
+{
+public:
+    DynamicResolutionController(IRenderDevice* pDevice, const DynamicResolutionControllerCreateInfo& CI);
+
+    // clang-format off
+    DynamicResolutionController           (const DynamicResolutionController&) = delete;
+    DynamicResolutionController& operator=(const DynamicResolutionController&) = delete;
+    DynamicResolutionController           (DynamicResolutionController&&)      = delete;
+    DynamicResolutionController& operator=(DynamicResolutionController&&)      = delete;
+    // clang-format on
+
+    ~DynamicResolutionController();
+
+    /// Begins the GPU frame time measurement.
+    void BeginFrame(IDeviceContext* pCtx);
+
+    /// Ends the GPU frame time measurement and updates the scale when the timing of a previous frame is available.
+
+    /// \return     true if the scale has changed, and false otherwise.
+    ///
+    /// Frames that were in flight when the scale changed were rendered at the old resolution,
+    /// so their timings are discarded.
+    bool EndFrame(IDeviceContext* pCtx);
+
+    /// Binds the color and depth targets and sets the viewport and the scissor rectangle to the render area.
+    void SetRenderTargets(IDeviceContext* pCtx, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    /// Upscales the render area of the color target into the destination render target.
+
+    /// \param [in] pCtx    - Device context to record the commands.
+    /// \param [in] pDstRTV - Destination render target view. The whole target is covered.
+    ///
+    /// The render targets bound in the context are changed to pDstRTV.
+    void Upscale(IDeviceContext* pCtx, ITextureView* pDstRTV);
+
+    /// Sets the render scale manually, see DynamicResolutionScaler::SetScale().
+    void SetScale(float Scale);
+
+    /// Returns the current render scale.
+    float GetScale() const { return m_Scaler.GetScale(); }
+
+    /// Returns the render area width, in pixels.
+    Uint32 GetRenderWidth() const { return m_RenderWidth; }
+
+    /// Returns the render area height, in pixels.
+    Uint32 GetRenderHeight() const { return m_RenderHeight; }
+
+    /// Returns the viewport that covers the render area.
+    Viewport GetViewport() const { return Viewport{m_RenderWidth, m_RenderHeight}; }
+
+    /// Returns the factor that converts the render area UV coordinates, in the range [0, 1],
+    /// to the UV coordinates of the full-size color and depth textures.
+    float2 GetUVScale() const;
+
+    /// Returns the full-size color texture.
+    ITexture* GetColorTexture() const { return m_pColor; }
+
+    /// Returns the full-size depth texture, or null if the depth format is unknown.
+    ITexture* GetDepthTexture() const { return m_pDepth; }
+
+    /// Returns the most recent measured GPU frame time, in seconds, or zero if no timing is available.
+    double GetLastFrameTime() const { return m_LastFrameTime; }
+
+    const DynamicResolutionScaler& GetScaler() const { return m_Scaler; }
+
+private:
+    void UpdateRenderSize();
+
+    struct UpscalePipeline
+    {
+        RefCntAutoPtr<IPipelineState>         pPSO;
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    };
+    const UpscalePipeline* GetUpscalePipeline(TEXTURE_FORMAT RTVFormat);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const Uint32 m_MaxWidth;
+    const Uint32 m_MaxHeight;
+
+    DynamicResolutionScaler m_Scaler;
+
+    Uint32 m_RenderWidth  = 0;
+    Uint32 m_RenderHeight = 0;
+
+    std::unique_ptr<DurationQueryHelper> m_pDurationQueries;
+
+    // The number of frames whose timing has not been read back yet
+    Uint32 m_NumPendingFrames = 0;
+    // The number of pending frames that were rendered at the previous scale
+    Uint32 m_NumStaleFrames = 0;
+
+    double m_LastFrameTime = 0;
+
+    RefCntAutoPtr<ITexture> m_pColor;
+    RefCntAutoPtr<ITexture> m_pDepth;
+
+    RefCntAutoPtr<IBuffer> m_pConstants;
+    RefCntAutoPtr<IShader> m_pUpscaleVS;
+    RefCntAutoPtr<IShader> m_pUpscalePS;
+
+    // Upscale pipelines are created on demand for every destination format
+    std::unordered_map<TEXTURE_FORMAT, UpscalePipeline> m_UpscalePipelines;
+};
+
+} // namespace Diligent
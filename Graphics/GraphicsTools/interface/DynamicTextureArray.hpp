@@ -30,6 +30,8 @@
 /// Declaration of DynamicTextureArray class
 
 #include <atomic>
+#include <vector>
+#include <string>
 
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
@@ -56,6 +58,19 @@ struct DynamicTextureArrayCreateInfo
     /// This value is only relevant when Desc.Usage == Diligent::USAGE_SPARSE and
     /// defines the number of texture array slices in one memory page.
     Uint32 NumSlicesInMemoryPage = 1;
+
+    /// The number of slices in one texture page.
+
+    /// If this value is not zero and the texture is not sparse (or sparse textures
+    /// are not supported by the device), the array is backed by a set of texture arrays
+    /// (pages), each containing NumSlicesInTexturePage slices. Growing the array only creates
+    /// new pages and never copies existing slices, while shrinking releases unused pages.
+    /// Slice `s` of the dynamic array is slice `s % NumSlicesInTexturePage` of page
+    /// `s / NumSlicesInTexturePage`, see DynamicTextureArray::GetPage().
+    ///
+    /// If this value is zero, a single texture array is used, and all existing
+    /// slices are copied to the new texture when the array is resized.
+    Uint32 NumSlicesInTexturePage = 0;
 };
 
 /// Dynamically resizable texture 2D array
@@ -107,6 +122,9 @@ public:
     ///
     /// Typically `pContext` is null when the method is called from a worker thread.
     ///
+    /// In paged mode (see IsPaged()), `pContext` is never used as existing slices are not copied,
+    /// and `pDevice` is only required when new pages need to be created.
+    ///
     /// If `NewArraySize` is zero, internal buffer will be released.
     ITexture* Resize(IRenderDevice*  pDevice,
                      IDeviceContext* pContext,
@@ -139,11 +157,53 @@ public:
     ///
     /// If the texture may need to be updated (initialized or resized),
     /// use the Update() method.
+    ///
+    /// In paged mode, the method returns the first page, see GetPage().
     ITexture* GetTexture() const
     {
-        return m_pTexture;
+        return IsPaged() ? GetPage(0) : m_pTexture.RawPtr();
+    }
+
+    /// Returns true if the array is backed by a set of texture pages
+    /// (see DynamicTextureArrayCreateInfo::NumSlicesInTexturePage).
+    bool IsPaged() const
+    {
+        return m_NumSlicesInTexturePage != 0 && m_Desc.Usage != USAGE_SPARSE;
+    }
+
+    /// Returns the number of slices in one texture page.
+    Uint32 GetNumSlicesInTexturePage() const
+    {
+        return m_NumSlicesInTexturePage;
     }
 
+    /// Returns the number of texture pages.
+    Uint32 GetNumPages() const
+    {
+        return static_cast<Uint32>(m_Pages.size());
+    }
+
+    /// Returns the texture page with the given index, or null if the index is out of range.
+
+    /// Shaders should access the pages through an array of texture arrays, for example:
+    ///
+    ///     Texture2DArray g_Pages[MAX_PAGES];
+    ///     ...
+    ///     g_Pages[Slice / NUM_SLICES_IN_PAGE].Sample(g_Sampler, float3(UV, Slice % NUM_SLICES_IN_PAGE));
+    ///
+    /// where the shader array is bound with the views returned by GetPageViews().
+    ITexture* GetPage(Uint32 PageIndex) const
+    {
+        return PageIndex < m_Pages.size() ? m_Pages[PageIndex].RawPtr() : nullptr;
+    }
+
+    /// Appends the default views of the given type of all texture pages to the Views vector.
+
+    /// The views can be bound to a shader resource array with IShaderResourceVariable::SetArray().
+    /// The version (see GetVersion()) is incremented every time pages are added or released,
+    /// which indicates that the views must be rebound.
+    void GetPageViews(TEXTURE_VIEW_TYPE ViewType, std::vector<IDeviceObject*>& Views) const;
+
     /// Returns true if the texture must be updated before use (e.g. it has been resized,
     /// but internal texture has not been initialized or updated).
     /// When update is not pending, Update() may be called with null device and context.
@@ -176,6 +236,7 @@ private:
 
     void ResizeSparseTexture(IDeviceContext* pContext);
     void ResizeDefaultTexture(IDeviceContext* pContext);
+    void ResizePages(IRenderDevice* pDevice, bool AllowNull);
 
     void CreateSparseTexture(IRenderDevice* pDevice);
     void CreateResources(IRenderDevice* pDevice);
@@ -183,6 +244,7 @@ private:
     const std::string m_Name;
     TextureDesc       m_Desc;
     const Uint32      m_NumSlicesInPage;
+    const Uint32      m_NumSlicesInTexturePage;
 
     std::atomic<Uint32> m_Version{0};
 
@@ -192,6 +254,8 @@ private:
     RefCntAutoPtr<ITexture>      m_pStaleTexture;
     RefCntAutoPtr<IDeviceMemory> m_pMemory;
 
+    std::vector<RefCntAutoPtr<ITexture>> m_Pages;
+
     Uint64 m_MemoryPageSize = 0;
 
     Uint64 m_NextBeforeResizeFenceValue = 1;
@@ -179,6 +179,23 @@ struct IDynamicTextureAtlas : public IObject
 };
 
 
+/// Texture atlas region packing mode.
+enum TEXTURE_ATLAS_PACKING_MODE : Uint8
+{
+    /// Guillotine packing: the free space is recursively split into rectangles.
+    /// Handles regions of mixed sizes and frequent releases well.
+    TEXTURE_ATLAS_PACKING_MODE_GUILLOTINE = 0,
+
+    /// Skyline bottom-left packing: the atlas keeps the top edge of the allocated
+    /// space and places every region at the lowest position.
+    /// Allocation cost does not depend on the number of allocated regions, which makes
+    /// this mode preferable for append-heavy workloads such as glyph or thumbnail caches.
+    TEXTURE_ATLAS_PACKING_MODE_SKYLINE,
+
+    TEXTURE_ATLAS_PACKING_MODE_COUNT
+};
+
+
 /// Dynamic texture atlas create information.
 struct DynamicTextureAtlasCreateInfo
 {
@@ -238,6 +255,9 @@ struct DynamicTextureAtlasCreateInfo
     /// Maximum number of slices in texture array.
     Uint32 MaxSliceCount = 2048;
 
+    /// Region packing mode, see Diligent::TEXTURE_ATLAS_PACKING_MODE.
+    TEXTURE_ATLAS_PACKING_MODE PackingMode = TEXTURE_ATLAS_PACKING_MODE_GUILLOTINE;
+
     /// Silence allocation errors.
     bool Silent = false;
 };
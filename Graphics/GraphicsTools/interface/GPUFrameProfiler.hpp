@@ -0,0 +1,240 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::GPUFrameProfiler class
+
+#include <vector>
+#include <deque>
+#include <string>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Query.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/Timer.hpp"
+
+namespace Diligent
+{
+
+/// GPU frame profiler create information.
+struct GPUFrameProfilerCreateInfo
+{
+    /// The maximum number of scopes that can be recorded in one frame.
+    /// Scopes that exceed this limit are not timed.
+    Uint32 MaxScopesPerFrame = 256;
+
+    /// The number of frames whose queries may be in flight at the same time.
+    /// If the results of the oldest frame are not yet available when a new frame
+    /// begins, the new frame is not profiled, so the profiler never stalls the CPU.
+    Uint32 NumFramesInFlight = 4;
+
+    /// The number of resolved frames to keep for trace export.
+    Uint32 NumHistoryFrames = 64;
+
+    /// Whether to also enclose every scope in a debug group.
+    bool InsertDebugGroups = true;
+};
+
+
+/// Hierarchical CPU/GPU frame profiler.
+
+/// The profiler records a pair of timestamp queries for every scope and CPU time of
+/// scope boundaries. Query results are polled in bulk once per frame without waiting
+/// for the GPU, and GPU ranges are mapped to the CPU timeline.
+///
+/// Typical usage:
+///
+///     Profiler.BeginFrame(pCtx);
+///     {
+///         GPUFrameProfiler::Scope Scope{Profiler, pCtx, "Shadow pass"};
+///         ...
+///     }
+///     Profiler.EndFrame(pCtx);
+///
+/// \remarks    Scope names are not copied and must remain valid until the frame is resolved
+///             and removed from the history, which is why string literals should be used.
+///             The profiler is not thread-safe.
+class GPUFrameProfiler
+{
+public:
+    /// Resolved scope range. All times are in seconds on the CPU timeline
+    /// that starts when the profiler is created.
+    struct Range
+    {
+        const Char* Name  = nullptr;
+        Uint32      Depth = 0;
+
+        double CPUStart = 0;
+        double CPUEnd   = 0;
+        double GPUStart = 0;
+        double GPUEnd   = 0;
+    };
+
+    /// Resolved frame data.
+    struct FrameData
+    {
+        Uint64 FrameNumber = 0;
+
+        double CPUStart = 0;
+        double CPUEnd   = 0;
+        double GPUStart = 0;
+        double GPUEnd   = 0;
+
+        std::vector<Range> Ranges;
+    };
+
+    GPUFrameProfiler(IRenderDevice* pDevice, const GPUFrameProfilerCreateInfo& CI = {});
+
+    // clang-format off
+    GPUFrameProfiler           (const GPUFrameProfiler&) = delete;
+    GPUFrameProfiler& operator=(const GPUFrameProfiler&) = delete;
+    GPUFrameProfiler           (GPUFrameProfiler&&)      = delete;
+    GPUFrameProfiler& operator=(GPUFrameProfiler&&)      = delete;
+    // clang-format on
+
+    /// Resolves the frames whose query results are available and begins a new frame.
+    void BeginFrame(IDeviceContext* pCtx);
+
+    /// Ends the current frame.
+
+    /// \remarks    All scopes started in the frame must be ended before this call.
+    void EndFrame(IDeviceContext* pCtx);
+
+    /// Begins a new scope nested into the currently open scope, if any.
+
+    /// \param [in] pCtx   - Context to record the timestamp query.
+    /// \param [in] Name   - Scope name, see remarks for GPUFrameProfiler.
+    /// \param [in] pColor - Optional debug group color.
+    void BeginScope(IDeviceContext* pCtx, const Char* Name, const float* pColor = nullptr);
+
+    /// Ends the most recently started scope.
+    void EndScope(IDeviceContext* pCtx);
+
+    /// Returns the most recently resolved frame, or null if no frames have been resolved yet.
+    const FrameData* GetLastResolvedFrame() const
+    {
+        return !m_ResolvedFrames.empty() ? &m_ResolvedFrames.back() : nullptr;
+    }
+
+    /// Returns the number of frames that were not profiled because
+    /// the query results of previous frames were not available.
+    Uint64 GetNumSkippedFrames() const { return m_NumSkippedFrames; }
+
+    /// Writes resolved frames from the history in the Chrome trace event format
+    /// that can be loaded into chrome://tracing or Perfetto UI.
+    /// CPU ranges are written to thread 0, GPU ranges are written to thread 1.
+    void ExportChromeTrace(std::string& Json) const;
+
+    /// Helper class that begins a profiler scope in the constructor and ends it in the destructor.
+    class Scope
+    {
+    public:
+        Scope(GPUFrameProfiler& Profiler,
+              IDeviceContext*   pCtx,
+              const Char*       Name,
+              const float*      pColor = nullptr) :
+            m_Profiler{Profiler},
+            m_pCtx{pCtx}
+        {
+            m_Profiler.BeginScope(m_pCtx, Name, pColor);
+        }
+
+        ~Scope()
+        {
+            m_Profiler.EndScope(m_pCtx);
+        }
+
+        // clang-format off
+        Scope           (const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope           (Scope&&)      = delete;
+        Scope& operator=(Scope&&)      = delete;
+        // clang-format on
+
+    private:
+        GPUFrameProfiler& m_Profiler;
+        IDeviceContext*   m_pCtx;
+    };
+
+private:
+    struct ScopeRecord
+    {
+        const Char* Name  = nullptr;
+        Uint32      Depth = 0;
+
+        double CPUStart = 0;
+        double CPUEnd   = 0;
+    };
+
+    struct FrameSlot
+    {
+        // Query 2*i is the start of scope i, query 2*i+1 is its end.
+        // The last two queries are used for the frame itself.
+        std::vector<RefCntAutoPtr<IQuery>> Queries;
+        std::vector<ScopeRecord>           Scopes;
+
+        Uint64 FrameNumber = 0;
+        double CPUStart    = 0;
+        double CPUEnd      = 0;
+        bool   IsPending   = false;
+    };
+
+    IQuery* GetQuery(FrameSlot& Slot, size_t Idx);
+    bool    ResolveFrame(FrameSlot& Slot);
+
+private:
+    RefCntAutoPtr<IRenderDevice>     m_pDevice;
+    const GPUFrameProfilerCreateInfo m_CI;
+
+    Timer m_Timer;
+
+    std::vector<FrameSlot> m_FrameSlots;
+    Uint64                 m_FrameNumber        = 0;
+    Uint64                 m_OldestPendingFrame = 0;
+
+    // Current frame slot, or null if the frame is not profiled
+    FrameSlot* m_pCurrFrame = nullptr;
+
+    // Indices of open scopes in the current frame. Scopes that are not timed are marked with ~0u.
+    std::vector<Uint32> m_OpenScopes;
+
+    std::vector<QueryDataTimestamp> m_QueryData;
+    std::deque<FrameData>           m_ResolvedFrames;
+
+    // Difference between GPU and CPU clocks, in seconds. GPU timestamps are always
+    // taken after the CPU records the command, so the minimum observed difference
+    // is the best estimate of the offset.
+    double m_GPUToCPUOffset     = 0;
+    bool   m_GPUToCPUOffsetInit = false;
+
+    Uint64 m_NumSkippedFrames = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// C++20 coroutine awaitables for fences, pipeline states, shaders and texture uploads.
+
+// See Coroutines.hpp: the header is empty unless the application is compiled with C++20 coroutine support.
+
+#include "../../../Common/interface/Coroutines.hpp"
+
+#if DILIGENT_COROUTINES_SUPPORTED
+
+#    include "../../GraphicsEngine/interface/RenderDevice.h"
+#    include "../../GraphicsEngine/interface/Fence.h"
+#    include "../../GraphicsEngine/interface/PipelineState.h"
+#    include "../../GraphicsEngine/interface/Shader.h"
+#    include "TextureUploader.hpp"
+
+namespace Diligent
+{
+
+/// Awaitable that resumes the coroutine when the fence reaches the value, see WhenFenceReached().
+class FenceValueAwaiter
+{
+public:
+    FenceValueAwaiter(IRenderDevice* pDevice, IFence* pFence, Uint64 Value, IThreadPool* pThreadPool) noexcept :
+        m_pDevice{pDevice},
+        m_pFence{pFence},
+        m_Value{Value},
+        m_pThreadPool{pThreadPool}
+    {
+        DEV_CHECK_ERR(pDevice != nullptr && pFence != nullptr, "Device and fence must not be null");
+    }
+
+    // IFence::GetCompletedValue() is not thread-safe in all backends, so the completion
+    // is always reported by the device.
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> Handle)
+    {
+        m_Handle = Handle;
+        m_pDevice->EnqueueFenceCompletionCallback(m_pFence, m_Value, OnFenceCompleted, this);
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    static void DILIGENT_CALL_TYPE OnFenceCompleted(IFence* /*pFence*/, Uint64 /*Value*/, void* pUserData)
+    {
+        // The awaiter lives in the coroutine frame that may be destroyed once the coroutine is resumed
+        const FenceValueAwaiter* pThis = static_cast<const FenceValueAwaiter*>(pUserData);
+        ResumeCoroutine(pThis->m_Handle, pThis->m_pThreadPool);
+    }
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+    RefCntAutoPtr<IFence>        m_pFence;
+    const Uint64                 m_Value;
+    IThreadPool* const           m_pThreadPool;
+    std::coroutine_handle<>      m_Handle;
+};
+
+/// Suspends the coroutine until the fence reaches the value.
+
+/// The coroutine is resumed in the thread pool, or, if pThreadPool is null, by the thread that
+/// executes the fence completion callbacks, see IRenderDevice::EnqueueFenceCompletionCallback().
+/// No thread is blocked while the coroutine is waiting.
+inline FenceValueAwaiter WhenFenceReached(IRenderDevice* pDevice, IFence* pFence, Uint64 Value, IThreadPool* pThreadPool)
+{
+    return FenceValueAwaiter{pDevice, pFence, Value, pThreadPool};
+}
+
+
+/// Suspends the coroutine until the pipeline state is compiled and resumes it in the thread pool.
+
+/// Returns the status of the pipeline state: PIPELINE_STATE_STATUS_READY or PIPELINE_STATE_STATUS_FAILED.
+inline CoTask<PIPELINE_STATE_STATUS> WhenPipelineReady(IPipelineState* pPSO, IThreadPool* pThreadPool)
+{
+    const RefCntAutoPtr<IPipelineState> pPipeline{pPSO};
+    co_await ResumeWhen(pThreadPool, [pPSO]() {
+        return pPSO->GetStatus() != PIPELINE_STATE_STATUS_COMPILING;
+    });
+    co_return pPSO->GetStatus();
+}
+
+/// Suspends the coroutine until the shader is compiled and resumes it in the thread pool.
+
+/// Returns the status of the shader: SHADER_STATUS_READY or SHADER_STATUS_FAILED.
+inline CoTask<SHADER_STATUS> WhenShaderReady(IShader* pShader, IThreadPool* pThreadPool)
+{
+    const RefCntAutoPtr<IShader> pShaderRef{pShader};
+    co_await ResumeWhen(pThreadPool, [pShader]() {
+        return pShader->GetStatus() != SHADER_STATUS_COMPILING;
+    });
+    co_return pShader->GetStatus();
+}
+
+/// Suspends the coroutine until the GPU copy from the upload buffer has been scheduled
+/// by ITextureUploader::RenderThreadUpdate() and resumes it in the thread pool.
+
+/// Unlike IUploadBuffer::WaitForCopyScheduled(), this does not block the thread. After the coroutine
+/// is resumed, the buffer may be recycled with ITextureUploader::RecycleBuffer().
+inline CoTask<void> WhenCopyScheduled(IUploadBuffer* pUploadBuffer, IThreadPool* pThreadPool)
+{
+    const RefCntAutoPtr<IUploadBuffer> pBuffer{pUploadBuffer};
+    co_await ResumeWhen(pThreadPool, [pUploadBuffer]() {
+        return pUploadBuffer->IsCopyScheduled();
+    });
+}
+
+} // namespace Diligent
+
+#endif // DILIGENT_COROUTINES_SUPPORTED
@@ -109,6 +109,12 @@ struct ComputeMipLevelAttribs
     ///     A_new = max(A_old; 1/3 * A_old + 2/3 * AlphaCutoff)
     float AlphaCutoff          DEFAULT_INITIALIZER(0);
 
+    /// An optional thread pool to filter the coarse mip rows in parallel.
+
+    /// When the thread pool is null, the mip level is computed on the calling thread.
+    /// The function always waits for all rows to be processed before returning.
+    IThreadPool* pThreadPool   DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr ComputeMipLevelAttribs() noexcept {}
 
@@ -120,7 +126,8 @@ struct ComputeMipLevelAttribs
                                      void*            _pCoarseMipData,
                                      size_t           _CoarseMipStride,
                                      MIP_FILTER_TYPE _FilterType  = ComputeMipLevelAttribs{}.FilterType,
-                                     float            _AlphaCutoff = ComputeMipLevelAttribs{}.AlphaCutoff) noexcept :
+                                     float            _AlphaCutoff = ComputeMipLevelAttribs{}.AlphaCutoff,
+                                     IThreadPool*     _pThreadPool = ComputeMipLevelAttribs{}.pThreadPool) noexcept :
         Format          {_Format},
         FineMipWidth    {_FineMipWidth},
         FineMipHeight   {_FineMipHeight},
@@ -129,7 +136,8 @@ struct ComputeMipLevelAttribs
         pCoarseMipData  {_pCoarseMipData},
         CoarseMipStride {_CoarseMipStride},
         FilterType      {_FilterType},
-        AlphaCutoff     {_AlphaCutoff}
+        AlphaCutoff     {_AlphaCutoff},
+        pThreadPool     {_pThreadPool}
     {} 
 #endif
 };
@@ -0,0 +1,224 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::HiZOcclusionCuller class
+
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+/// Instance bounds and draw arguments consumed by HiZOcclusionCuller::Cull().
+
+/// The layout matches the structure used by the culling shader.
+struct HiZCullingInstance
+{
+    /// World-space bounding box minimum. The w component is ignored.
+    float4 BoundsMin;
+
+    /// World-space bounding box maximum. The w component is ignored.
+    float4 BoundsMax;
+
+    /// Indexed draw arguments written to the indirect arguments buffer when the instance is visible,
+    /// see Diligent::DrawIndexedIndirectAttribs.
+    Uint32 NumIndices            = 0;
+    Uint32 NumInstances          = 1;
+    Uint32 FirstIndexLocation    = 0;
+    Int32  BaseVertex            = 0;
+    Uint32 FirstInstanceLocation = 0;
+
+    Uint32 Padding0 = 0;
+    Uint32 Padding1 = 0;
+    Uint32 Padding2 = 0;
+};
+static_assert(sizeof(HiZCullingInstance) == 64, "The size of HiZCullingInstance must match the shader structure");
+
+
+/// Hi-Z pyramid layout in the pyramid buffer.
+struct HiZPyramidLayout
+{
+    /// The maximum number of pyramid levels.
+    static constexpr Uint32 MaxLevels = 16;
+
+    /// Level 0 width.
+    Uint32 Width = 0;
+
+    /// Level 0 height.
+    Uint32 Height = 0;
+
+    /// The number of levels in the pyramid. The last level is 1x1.
+    Uint32 NumLevels = 0;
+
+    /// Offsets of the levels in the pyramid buffer, in texels.
+    Uint32 LevelOffsets[MaxLevels] = {};
+
+    /// The total number of texels in all levels.
+    Uint32 NumTexels = 0;
+};
+
+/// Computes the Hi-Z pyramid layout for a depth buffer of the given size.
+
+/// Level 0 dimensions are the depth buffer dimensions rounded up to a power of two and halved
+/// (but at least 1), so that every level-0 texel covers one to two depth texels in each
+/// direction, and every next level is an exact 2x2 reduction of the previous one.
+HiZPyramidLayout ComputeHiZPyramidLayout(Uint32 DepthWidth, Uint32 DepthHeight);
+
+
+/// Hi-Z occlusion culler create information.
+struct HiZOcclusionCullerCreateInfo
+{
+    /// Whether the depth buffer uses reversed depth (near plane at 1, far plane at 0).
+    bool ReverseZ = false;
+
+    /// Whether to compact the visible instances' draw arguments.
+
+    /// When compaction is enabled, the culler appends the draw arguments of visible instances
+    /// and writes their count into the counter buffer, so the draws are issued with the
+    /// counter buffer (see Diligent::DrawIndexedIndirectAttribs::pCounterBuffer).
+    /// Otherwise, the arguments of every instance are written at the instance's index,
+    /// and culled instances get zero instance count; this works on devices that do not support
+    /// Diligent::DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER, such as OpenGL and WebGPU.
+    /// Compaction is disabled if the device does not support the counter buffer.
+    bool Compact = true;
+};
+
+
+/// Builds a min/max hierarchical depth pyramid and culls instance bounding boxes against it on the GPU.
+
+/// The pyramid is kept in a structured buffer of float2 (min depth, max depth) values, so the same
+/// shaders run on Direct3D12, Vulkan, OpenGL and WebGPU without reading and writing different
+/// mip levels of one texture. Each build dispatch reduces up to five pyramid levels in group-shared
+/// memory, so a 4K depth buffer is reduced in three dispatches.
+///
+/// The cull pass tests every instance's world-space bounding box against the view frustum and then
+/// against the pyramid level where the box covers at most 2x2 texels, and writes indexed indirect
+/// draw arguments for the visible instances.
+///
+/// Typical usage:
+///
+///     HiZOcclusionCuller Culler{pDevice};
+///     ...
+///     // After the depth pre-pass
+///     Culler.BuildPyramid(pCtx, pDepthSRV);
+///     Culler.Cull(pCtx, ViewProj, pInstancesBuffer, NumInstances);
+///     DrawIndexedIndirectAttribs DrawAttribs = Culler.GetDrawAttribs(VT_UINT32, NumInstances);
+///     pCtx->DrawIndexedIndirect(DrawAttribs);
+///
+/// \remarks    The instances buffer must be a structured buffer of HiZCullingInstance elements
+///             created with Diligent::BIND_SHADER_RESOURCE flag.
+///             The culler is not thread-safe.
+class HiZOcclusionCuller
+{
+public:
+    HiZOcclusionCuller(IRenderDevice* pDevice, const HiZOcclusionCullerCreateInfo& CI = {});
+
+    // clang-format off
+    HiZOcclusionCuller           (const HiZOcclusionCuller&) = delete;
+    HiZOcclusionCuller& operator=(const HiZOcclusionCuller&) = delete;
+    HiZOcclusionCuller           (HiZOcclusionCuller&&)      = delete;
+    HiZOcclusionCuller& operator=(HiZOcclusionCuller&&)      = delete;
+    // clang-format on
+
+    ~HiZOcclusionCuller();
+
+    /// Builds the Hi-Z pyramid from the depth buffer.
+
+    /// \param [in] pCtx      - Device context to record the commands.
+    /// \param [in] pDepthSRV - Shader resource view of the depth buffer.
+    ///
+    /// The depth buffer is transitioned to Diligent::RESOURCE_STATE_SHADER_RESOURCE state.
+    void BuildPyramid(IDeviceContext* pCtx, ITextureView* pDepthSRV);
+
+    /// Culls the instances against the view frustum and the Hi-Z pyramid.
+
+    /// \param [in] pCtx         - Device context to record the commands.
+    /// \param [in] ViewProj     - View-projection matrix that was used to render the depth buffer.
+    /// \param [in] pInstances   - Structured buffer of HiZCullingInstance elements.
+    /// \param [in] NumInstances - The number of instances to cull.
+    ///
+    /// If the pyramid has not been built, the instances are only culled against the frustum.
+    void Cull(IDeviceContext*  pCtx,
+              const float4x4&  ViewProj,
+              IBuffer*         pInstances,
+              Uint32           NumInstances);
+
+    /// Returns the draw attributes to issue the draws of the instances culled by the last Cull() call.
+
+    /// \param [in] IndexType    - Index type of the draws.
+    /// \param [in] NumInstances - The number of instances passed to Cull().
+    DrawIndexedIndirectAttribs GetDrawAttribs(VALUE_TYPE IndexType, Uint32 NumInstances) const;
+
+    /// Returns the indirect draw arguments buffer.
+    IBuffer* GetDrawArgsBuffer() const { return m_pDrawArgs; }
+
+    /// Returns the buffer that contains the number of visible instances when compaction is enabled.
+    IBuffer* GetDrawCountBuffer() const { return m_pDrawCount; }
+
+    /// Returns the pyramid buffer, see HiZPyramidLayout.
+    IBuffer* GetPyramidBuffer() const { return m_pPyramid; }
+
+    /// Returns the layout of the last built pyramid.
+    const HiZPyramidLayout& GetPyramidLayout() const { return m_Layout; }
+
+    /// Returns true if the draw arguments are compacted.
+    bool IsCompacting() const { return m_Compact; }
+
+private:
+    void CreatePipelines();
+    void PrepareOutputBuffers(Uint32 NumInstances);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const bool m_ReverseZ;
+    const bool m_Compact;
+
+    HiZPyramidLayout m_Layout;
+
+    RefCntAutoPtr<IPipelineState>         m_pBuildFromDepthPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pBuildFromDepthSRB;
+    RefCntAutoPtr<IPipelineState>         m_pBuildPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pBuildSRB;
+    RefCntAutoPtr<IPipelineState>         m_pCullPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pCullSRB;
+
+    RefCntAutoPtr<IBuffer> m_pBuildConstants;
+    RefCntAutoPtr<IBuffer> m_pCullConstants;
+    RefCntAutoPtr<IBuffer> m_pPyramid;
+    RefCntAutoPtr<IBuffer> m_pDrawArgs;
+    RefCntAutoPtr<IBuffer> m_pDrawCount;
+};
+
+} // namespace Diligent
@@ -0,0 +1,252 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Index reordering and vertex quantization utilities
+
+#include <vector>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Common/interface/BasicMath.hpp"
+#include "../../GraphicsEngine/interface/InputLayout.h"
+
+namespace Diligent
+{
+
+/// Reorders the triangles to improve the post-transform vertex cache utilization.
+
+/// \param [out] pDstIndices - Reordered indices. May be the same as pIndices.
+/// \param [in]  pIndices    - Triangle list indices.
+/// \param [in]  NumIndices  - The number of indices. Must be a multiple of 3.
+/// \param [in]  NumVertices - The number of vertices referenced by the indices.
+///
+/// The triangles are reordered with the linear-speed vertex cache optimization algorithm
+/// by T. Forsyth. The algorithm does not depend on the exact cache size of the hardware.
+/// The vertex order within every triangle is preserved, so the winding does not change.
+void OptimizeVertexCache(Uint32* pDstIndices, const Uint32* pIndices, Uint32 NumIndices, Uint32 NumVertices);
+
+
+/// Reorders the triangles to reduce overdraw while keeping the vertex cache efficiency.
+
+/// \param [out] pDstIndices    - Reordered indices. May be the same as pIndices.
+/// \param [in]  pIndices       - Triangle list indices, typically optimized with OptimizeVertexCache().
+/// \param [in]  NumIndices     - The number of indices. Must be a multiple of 3.
+/// \param [in]  pPositions     - Pointer to the vertex data. The first three floats of every
+///                               vertex must contain the vertex position.
+/// \param [in]  NumVertices    - The number of vertices.
+/// \param [in]  PositionStride - Vertex stride, in bytes. Must be at least 12.
+/// \param [in]  Threshold      - The maximum allowed increase of the vertex cache miss ratio
+///                               within a cluster, e.g. 1.05 allows 5% more cache misses.
+///                               Larger values produce smaller clusters and less overdraw.
+///
+/// The index buffer is split into clusters at the points where the vertex cache would be
+/// flushed anyway, and large clusters are split further as long as the cache miss ratio of
+/// every part does not exceed the ratio of the whole cluster multiplied by the threshold.
+/// The clusters are then sorted so that the clusters that face away from the mesh center
+/// are drawn first, as they are more likely to occlude other parts of the mesh (P. Sander,
+/// D. Nehab, J. Barczak, "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw").
+void OptimizeOverdraw(Uint32*       pDstIndices,
+                      const Uint32* pIndices,
+                      Uint32        NumIndices,
+                      const void*   pPositions,
+                      Uint32        NumVertices,
+                      Uint32        PositionStride,
+                      float         Threshold = 1.05f);
+
+
+/// Computes the average number of vertex cache misses per triangle for a FIFO cache of the given size.
+
+/// The ratio is in the range [0.5, 3] for meshes without degenerate triangles. Lower is better.
+float ComputeAverageCacheMissRatio(const Uint32* pIndices, Uint32 NumIndices, Uint32 NumVertices, Uint32 CacheSize = 16);
+
+
+/// Computes the vertex remap table that places the vertices in the order of their first use.
+
+/// \param [out] pRemap      - Remap table with NumVertices entries. pRemap[i] receives the new
+///                            index of the vertex i, or ~0u if the vertex is not referenced.
+/// \param [in]  pIndices    - Triangle list indices, typically optimized with OptimizeVertexCache()
+///                            and OptimizeOverdraw().
+/// \param [in]  NumIndices  - The number of indices.
+/// \param [in]  NumVertices - The number of vertices.
+/// \return     The number of referenced vertices.
+///
+/// Ordering the vertices by their first use improves the locality of the vertex fetch.
+/// The same remap table must be applied to the index buffer with RemapIndexBuffer() and
+/// to every vertex buffer with RemapVertexBuffer().
+Uint32 ComputeVertexFetchRemap(Uint32* pRemap, const Uint32* pIndices, Uint32 NumIndices, Uint32 NumVertices);
+
+
+/// Applies the remap table produced by ComputeVertexFetchRemap() to the index buffer.
+
+/// \param [out] pDstIndices - Remapped indices. May be the same as pIndices.
+/// \param [in]  pIndices    - Indices to remap.
+/// \param [in]  NumIndices  - The number of indices.
+/// \param [in]  pRemap      - Remap table.
+void RemapIndexBuffer(Uint32* pDstIndices, const Uint32* pIndices, Uint32 NumIndices, const Uint32* pRemap);
+
+
+/// Applies the remap table produced by ComputeVertexFetchRemap() to the vertex buffer.
+
+/// \param [out] pDstVertices - Remapped vertices. Must have room for the number of referenced vertices
+///                             returned by ComputeVertexFetchRemap(), and must not overlap pVertices.
+/// \param [in]  pVertices    - Vertices to remap.
+/// \param [in]  NumVertices  - The number of vertices in pVertices.
+/// \param [in]  VertexStride - Vertex stride, in bytes.
+/// \param [in]  pRemap       - Remap table.
+void RemapVertexBuffer(void* pDstVertices, const void* pVertices, Uint32 NumVertices, Uint32 VertexStride, const Uint32* pRemap);
+
+
+/// Vertex attribute quantization.
+enum VERTEX_ATTRIB_QUANTIZATION : Uint8
+{
+    /// The attribute is stored as 32-bit floats.
+    VERTEX_ATTRIB_QUANTIZATION_NONE = 0,
+
+    /// Every component is remapped to [-1, 1] using the bounding box of the attribute
+    /// and stored as a normalized 16-bit signed integer. Suitable for positions.
+    ///
+    /// The original value is `Quantized * DequantizationScale + DequantizationBias`.
+    /// For positions, the scale and the bias can be folded into the world matrix.
+    VERTEX_ATTRIB_QUANTIZATION_SNORM16,
+
+    /// Every component is stored as a 16-bit float. Suitable for texture coordinates.
+    VERTEX_ATTRIB_QUANTIZATION_FLOAT16,
+
+    /// The unit vector is encoded with the octahedral mapping into two normalized 16-bit
+    /// signed integers. Suitable for normals and tangents. The fourth component of a
+    /// four-component attribute (e.g. tangent handedness) is stored as the third
+    /// normalized 16-bit signed integer. The vector is decoded in the shader as follows:
+    ///
+    ///     float3 DecodeOctahedral(float2 e)
+    ///     {
+    ///         float3 n = float3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+    ///         float  t = saturate(-n.z);
+    ///         n.xy += float2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+    ///         return normalize(n);
+    ///     }
+    VERTEX_ATTRIB_QUANTIZATION_OCTAHEDRAL
+};
+
+
+/// Description of a vertex attribute to quantize.
+struct VertexAttribQuantizationDesc
+{
+    /// Pointer to the attribute of the first vertex.
+    const void* pData = nullptr;
+
+    /// Stride between the attributes of two consecutive vertices, in bytes.
+    /// If zero, the attributes are tightly packed.
+    Uint32 Stride = 0;
+
+    /// The number of 32-bit float components, from 1 to 4.
+    /// Octahedral quantization requires 3 or 4 components.
+    Uint32 NumComponents = 3;
+
+    /// Attribute quantization, see Diligent::VERTEX_ATTRIB_QUANTIZATION.
+    VERTEX_ATTRIB_QUANTIZATION Quantization = VERTEX_ATTRIB_QUANTIZATION_NONE;
+
+    /// Input index of the layout element.
+    Uint32 InputIndex = 0;
+};
+
+
+/// Vertex quantization information.
+struct VertexQuantizationInfo
+{
+    /// Attributes to quantize.
+    const VertexAttribQuantizationDesc* pAttribs = nullptr;
+
+    /// The number of attributes.
+    Uint32 NumAttribs = 0;
+
+    /// The number of vertices.
+    Uint32 NumVertices = 0;
+
+    /// Buffer slot of the generated layout elements.
+    Uint32 BufferSlot = 0;
+};
+
+
+/// Quantized vertex data produced by QuantizeVertices().
+struct QuantizedVertexData
+{
+    /// Interleaved quantized vertices.
+    std::vector<Uint8> Vertices;
+
+    /// Quantized vertex stride, in bytes. Always a multiple of 4.
+    Uint32 VertexStride = 0;
+
+    /// Layout elements of the quantized attributes, one for every attribute, with
+    /// explicit relative offsets and strides. Can be used directly in InputLayoutDesc.
+    std::vector<LayoutElement> Elements;
+
+    /// Dequantization scale of every attribute. The value is (1, 1, 1, 1) for all
+    /// attributes except those quantized with VERTEX_ATTRIB_QUANTIZATION_SNORM16.
+    std::vector<float4> DequantizationScale;
+
+    /// Dequantization bias of every attribute. The value is (0, 0, 0, 0) for all
+    /// attributes except those quantized with VERTEX_ATTRIB_QUANTIZATION_SNORM16.
+    std::vector<float4> DequantizationBias;
+};
+
+
+/// Quantizes the vertex attributes and interleaves them into a single vertex buffer.
+
+/// \param [in]  Info - Vertex quantization information, see Diligent::VertexQuantizationInfo.
+/// \param [out] Data - Quantized vertex data.
+/// \return     true if the vertices were quantized successfully, and false if the information is invalid.
+///
+/// Three-component SNORM16 and FLOAT16 attributes are padded to four components with 1.0, and
+/// one-component attributes are padded to two components with 0.0, because three- and
+/// one-component 16-bit vertex formats are not universally supported. For example, position,
+/// normal, and texture coordinates take 16 bytes per vertex instead of 32 when quantized as
+/// SNORM16, OCTAHEDRAL, and FLOAT16 respectively. The quantized vertex data can be uploaded
+/// into a buffer of a vertex pool with a single element of VertexStride size.
+bool QuantizeVertices(const VertexQuantizationInfo& Info, QuantizedVertexData& Data);
+
+
+/// Converts a 32-bit float to a 16-bit float with rounding to the nearest even value.
+Uint16 FloatToHalf(float Value);
+
+/// Converts a 16-bit float to a 32-bit float.
+float HalfToFloat(Uint16 Value);
+
+/// Converts a value in the range [-1, 1] to a normalized 16-bit signed integer.
+Int16 FloatToSnorm16(float Value);
+
+/// Converts a normalized 16-bit signed integer to a value in the range [-1, 1].
+float Snorm16ToFloat(Int16 Value);
+
+/// Encodes a unit vector with the octahedral mapping into two values in the range [-1, 1].
+float2 EncodeOctahedral(const float3& Dir);
+
+/// Decodes a unit vector encoded with EncodeOctahedral().
+float3 DecodeOctahedral(const float2& Enc);
+
+} // namespace Diligent
@@ -0,0 +1,219 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Meshlet generation utilities for the mesh shader pipeline
+
+#include <vector>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+/// Meshlet description.
+
+/// The layout matches the structure used by the shaders, see GetMeshletCullingShaderSource().
+struct Meshlet
+{
+    /// Offset of the first vertex in MeshletData::VertexIndices.
+    Uint32 VertexOffset = 0;
+
+    /// Offset of the first triangle in MeshletData::TriangleIndices.
+    Uint32 TriangleOffset = 0;
+
+    /// The number of unique vertices in the meshlet.
+    Uint32 VertexCount = 0;
+
+    /// The number of triangles in the meshlet.
+    Uint32 TriangleCount = 0;
+};
+static_assert(sizeof(Meshlet) == 16, "Meshlet size must match the shader structure");
+
+
+/// Meshlet bounds used for culling.
+
+/// The layout matches the structure used by the shaders, see GetMeshletCullingShaderSource().
+struct MeshletBounds
+{
+    /// Bounding sphere center.
+    float3 Center;
+
+    /// Bounding sphere radius.
+    float Radius = 0;
+
+    /// Normal cone apex.
+    float3 ConeApex;
+
+    /// Normal cone cutoff. The meshlet is back-facing and can be culled if
+    ///
+    ///     dot(normalize(ConeApex - CameraPosition), ConeAxis) >= ConeCutoff
+    ///
+    /// The cutoff is 1 when the triangle normals span too wide a cone to be useful,
+    /// in which case cone culling must be skipped.
+    float ConeCutoff = 1;
+
+    /// Normal cone axis.
+    float3 ConeAxis;
+
+    float Padding = 0;
+};
+static_assert(sizeof(MeshletBounds) == 48, "MeshletBounds size must match the shader structure");
+
+
+/// Meshlet build information.
+struct MeshletBuildInfo
+{
+    /// Pointer to the vertex data. The first three floats of every
+    /// vertex must contain the vertex position.
+    const void* pVertices = nullptr;
+
+    /// The number of vertices.
+    Uint32 NumVertices = 0;
+
+    /// Vertex stride, in bytes. Must be at least 12.
+    Uint32 VertexStride = sizeof(float3);
+
+    /// Pointer to the triangle list indices.
+    const Uint32* pIndices = nullptr;
+
+    /// The number of indices. Must be a multiple of 3.
+    Uint32 NumIndices = 0;
+
+    /// The maximum number of vertices in a meshlet, must not exceed 256.
+
+    /// 64 vertices and 124 triangles are the values recommended for most hardware.
+    Uint32 MaxVertices = 64;
+
+    /// The maximum number of triangles in a meshlet, must not exceed 256.
+    Uint32 MaxTriangles = 124;
+
+    /// The weight of the normal cone in the range [0, 1].
+
+    /// When the weight is zero, triangles are grouped only for vertex reuse and
+    /// spatial locality. Higher values produce meshlets with tighter normal cones
+    /// that are culled more often, at the cost of a slightly higher vertex count.
+    float ConeWeight = 0.25f;
+};
+
+
+/// Meshlet data produced by BuildMeshlets().
+struct MeshletData
+{
+    /// Meshlets.
+    std::vector<Meshlet> Meshlets;
+
+    /// Meshlet bounds, one for every meshlet.
+    std::vector<MeshletBounds> Bounds;
+
+    /// Vertex indices of all meshlets. The vertices of a meshlet start at Meshlet::VertexOffset.
+    std::vector<Uint32> VertexIndices;
+
+    /// Packed triangles of all meshlets. The triangles of a meshlet start at Meshlet::TriangleOffset.
+    /// Every triangle is packed into one Uint32 as three 8-bit indices into the meshlet vertices:
+    ///
+    ///     i0 | (i1 << 8) | (i2 << 16)
+    std::vector<Uint32> TriangleIndices;
+};
+
+
+/// Splits the triangle list into meshlets for the mesh shader pipeline.
+
+/// \param [in]  BuildInfo - Meshlet build information, see Diligent::MeshletBuildInfo.
+/// \param [out] Data      - Meshlet data.
+/// \return     true if the meshlets were built successfully, and false if the build info is invalid.
+///
+/// Meshlets are grown greedily from a seed triangle by adding the adjacent triangle that
+/// introduces the fewest new vertices, preferring triangles that are close to the meshlet and
+/// whose normals are aligned with the meshlet normal cone. Each next meshlet is seeded next to
+/// the previous one, so consecutive meshlets are spatially coherent. Degenerate triangles are skipped.
+bool BuildMeshlets(const MeshletBuildInfo& BuildInfo, MeshletData& Data);
+
+
+/// Computes the bounding sphere and the normal cone of the meshlet.
+
+/// \param [in] BuildInfo - Build information that provides the vertex positions.
+/// \param [in] Data      - Meshlet data.
+/// \param [in] MeshletId - Index of the meshlet in Data.Meshlets.
+MeshletBounds ComputeMeshletBounds(const MeshletBuildInfo& BuildInfo, const MeshletData& Data, Uint32 MeshletId);
+
+
+/// Constants of the reference meshlet culling shader, see GetMeshletCullingShaderSource().
+struct MeshletCullingConstants
+{
+    /// Frustum planes in the object space with unit normals pointing inside the frustum,
+    /// so that dot(Plane.xyz, Point) + Plane.w >= 0 for points inside.
+    /// The planes can be obtained with ExtractViewFrustumPlanesFromMatrix() and normalized.
+    float4 FrustumPlanes[6];
+
+    /// Camera position in the object space (xyz).
+    float4 CameraPosition;
+
+    /// The total number of meshlets.
+    Uint32 MeshletCount = 0;
+
+    /// Whether to perform normal cone culling.
+    Uint32 EnableConeCulling = 1;
+
+    Uint32 Padding0 = 0;
+    Uint32 Padding1 = 0;
+};
+static_assert(sizeof(MeshletCullingConstants) % 16 == 0, "MeshletCullingConstants size must be a multiple of 16");
+
+
+/// Returns the HLSL source of the reference meshlet culling amplification (task) shader.
+
+/// The shader tests one meshlet per thread against the view frustum and the normal cone,
+/// and dispatches mesh shader groups only for the visible meshlets. The entry point is `main`,
+/// and the thread group size is defined by the MESHLET_CULLING_GROUP_SIZE macro (32 by default).
+/// The application dispatches (MeshletCount + MESHLET_CULLING_GROUP_SIZE - 1) / MESHLET_CULLING_GROUP_SIZE
+/// amplification shader groups with IDeviceContext::DrawMesh().
+///
+/// The shader must be compiled with DXC for shader model 6.5 or higher and uses the following resources:
+///
+///     cbuffer cbMeshletCulling
+///     {
+///         MeshletCullingConstants g_Culling;
+///     };
+///     StructuredBuffer<MeshletBounds> g_MeshletBounds;
+///
+/// The amplification shader passes the following payload to the mesh shader, which reads
+/// the index of its meshlet as Payload.MeshletIndices[GroupId]:
+///
+///     struct MeshletCullingPayload
+///     {
+///         uint MeshletIndices[MESHLET_CULLING_GROUP_SIZE];
+///     };
+///
+/// The source also defines the Meshlet structure and UnpackMeshletTriangle() function,
+/// so it can be included into the mesh shader with MESHLET_CULLING_NO_ENTRY_POINT defined.
+const char* GetMeshletCullingShaderSource();
+
+} // namespace Diligent
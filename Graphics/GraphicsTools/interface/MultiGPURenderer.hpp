@@ -0,0 +1,346 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::MultiGPURenderer class
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/EngineFactory.h"
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/SwapChain.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "ReadbackQueue.hpp"
+
+namespace Diligent
+{
+
+struct IArchiverFactory;
+struct IRenderStateCache;
+
+/// Multi-GPU work distribution mode.
+enum MULTI_GPU_RENDER_MODE : Uint8
+{
+    /// Every frame is split into tiles that are rendered by all devices.
+    /// The tiles are gathered into one CPU image before the frame is delivered.
+    MULTI_GPU_RENDER_MODE_SPLIT_FRAME = 0,
+
+    /// Every frame is rendered entirely by one device (alternate frame rendering).
+    MULTI_GPU_RENDER_MODE_ALTERNATE_FRAME
+};
+
+
+/// Multi-GPU renderer job.
+struct MultiGPURenderJob
+{
+    /// Index of the device that renders the job.
+    Uint32 DeviceIndex = 0;
+
+    /// Render device and its immediate context.
+    IRenderDevice*  pDevice  = nullptr;
+    IDeviceContext* pContext = nullptr;
+
+    /// Off-screen swap chain of the device.
+
+    /// The job must be rendered into the top-left Region.right - Region.left by
+    /// Region.bottom - Region.top pixels of the current back buffer.
+    ISwapChain* pSwapChain = nullptr;
+
+    /// Render state cache of the device, or null if render state caches are not used.
+    IRenderStateCache* pStateCache = nullptr;
+
+    /// Index of the frame the job belongs to.
+    Uint64 FrameId = 0;
+
+    /// Region of the frame rendered by the job, in pixels.
+
+    /// In split-frame mode, this is the tile region. The application typically renders the tile
+    /// by offsetting and scaling the projection matrix so that the region maps onto the viewport.
+    /// In alternate-frame mode, the region covers the entire frame.
+    Rect Region;
+
+    /// Frame dimensions.
+    Uint32 FrameWidth  = 0;
+    Uint32 FrameHeight = 0;
+};
+
+
+/// Frame data delivered by the multi-GPU renderer.
+struct MultiGPUFrameData
+{
+    /// Frame pixels, or null if any part of the frame could not be read back.
+    /// The pointer is only valid until the callback returns.
+    const void* pData = nullptr;
+
+    /// Row stride in bytes.
+    Uint64 Stride = 0;
+
+    /// Frame dimensions.
+    Uint32 Width  = 0;
+    Uint32 Height = 0;
+
+    /// Pixel format.
+    TEXTURE_FORMAT Format = TEX_FORMAT_UNKNOWN;
+};
+
+
+/// Multi-GPU renderer create information.
+struct MultiGPURendererCreateInfo
+{
+    /// Engine factory used to enumerate the adapters.
+    IEngineFactory* pEngineFactory = nullptr;
+
+    /// Minimum graphics API version passed to IEngineFactory::EnumerateAdapters().
+    Version MinVersion;
+
+    /// Device creation callback type.
+
+    /// \param [in]  AdapterId   - Adapter index to pass to the backend-specific engine create info.
+    /// \param [in]  AdapterInfo - Adapter information.
+    /// \param [out] ppDevice    - Address of the pointer to the created device.
+    /// \param [out] ppContext   - Address of the pointer to the immediate context of the device.
+    using CreateDeviceCallbackType = std::function<void(Uint32 AdapterId, const GraphicsAdapterInfo& AdapterInfo, IRenderDevice** ppDevice, IDeviceContext** ppContext)>;
+
+    /// Callback that creates one device for every enumerated adapter, e.g. with
+    /// IEngineFactoryVk::CreateDeviceAndContextsVk() and EngineCI.AdapterId = AdapterId.
+
+    /// Device creation is backend-specific, so GraphicsTools leaves it to the application.
+    /// Adapters for which the callback does not create a device are skipped.
+    CreateDeviceCallbackType CreateDevice;
+
+    /// Whether to skip software adapters (e.g. WARP or SwiftShader).
+    bool SkipSoftwareAdapters = true;
+
+    /// The maximum number of devices to create. Zero means all adapters.
+    Uint32 MaxDevices = 0;
+
+    /// Work distribution mode, see Diligent::MULTI_GPU_RENDER_MODE.
+    MULTI_GPU_RENDER_MODE Mode = MULTI_GPU_RENDER_MODE_SPLIT_FRAME;
+
+    /// Frame dimensions.
+    Uint32 FrameWidth  = 0;
+    Uint32 FrameHeight = 0;
+
+    /// Tile dimensions in split-frame mode.
+
+    /// Smaller tiles balance the load between GPUs of different performance better,
+    /// but add per-tile overhead. Edge tiles are clipped by the frame bounds.
+    Uint32 TileWidth  = 512;
+    Uint32 TileHeight = 512;
+
+    /// Color and depth buffer formats of the per-device swap chains.
+    /// The color format must not be compressed.
+    TEXTURE_FORMAT ColorBufferFormat = TEX_FORMAT_RGBA8_UNORM;
+    TEXTURE_FORMAT DepthBufferFormat = TEX_FORMAT_D32_FLOAT;
+
+    /// The maximum number of readbacks that every device keeps in flight.
+
+    /// A device does not start a new job while this many readbacks are pending, which bounds the
+    /// staging memory and lets the GPU render the next job while the previous ones are copied.
+    Uint32 NumReadbacksInFlight = 3;
+
+    /// The maximum number of frames that may be in flight. RenderFrame() waits while this
+    /// many frames have not been delivered. Zero means twice the number of devices.
+    Uint32 MaxFramesInFlight = 0;
+
+    /// Optional archiver factory. If not null, the renderer creates one render state cache per
+    /// device, all sharing the serialization data of the first one (see RenderStateCacheCreateInfo::pSharedCache),
+    /// so that shaders are compiled once for all devices.
+    IArchiverFactory* pArchiverFactory = nullptr;
+
+    /// Device initialization callback type.
+    using InitDeviceCallbackType = std::function<void(Uint32 DeviceIndex, IRenderDevice* pDevice, IDeviceContext* pContext, IRenderStateCache* pStateCache)>;
+
+    /// Optional callback that is called once for every device by its worker thread before
+    /// the device renders its first job. The application typically uploads scene data and
+    /// creates pipeline states here. All devices are initialized in parallel.
+    InitDeviceCallbackType InitDevice;
+
+    /// Render callback type.
+    using RenderCallbackType = std::function<void(const MultiGPURenderJob& Job)>;
+
+    /// Callback that records the commands of a job. Called by the worker thread of the device.
+    /// The renderer reads back the job region and presents the swap chain when the callback returns.
+    RenderCallbackType Render;
+
+    /// Frame callback type.
+    using FrameCallbackType = std::function<void(Uint64 FrameId, const MultiGPUFrameData& Data)>;
+
+    /// Callback that receives every completed frame.
+
+    /// The callback is called by the worker thread of the device that completed the last job of the
+    /// frame. Callbacks of different frames may run concurrently and frames may complete out of order.
+    FrameCallbackType FrameCallback;
+};
+
+
+/// Renders frames on all GPUs of the system.
+
+/// The renderer creates one device per adapter, and one worker thread and one off-screen swap chain
+/// per device. Frames are split into jobs (tiles in split-frame mode, or whole frames in alternate-frame
+/// mode) that are put into a shared queue. Every worker takes the next job as soon as its device
+/// has room for it, so that faster GPUs render more jobs. Results are gathered with asynchronous
+/// readbacks that never stall the GPU.
+///
+/// Typical usage:
+///
+///     MultiGPURendererCreateInfo CI;
+///     CI.pEngineFactory = pFactoryVk;
+///     CI.CreateDevice   = [&](Uint32 AdapterId, const GraphicsAdapterInfo&, IRenderDevice** ppDevice, IDeviceContext** ppContext) {
+///         EngineVkCreateInfo EngineCI;
+///         EngineCI.AdapterId = AdapterId;
+///         pFactoryVk->CreateDeviceAndContextsVk(EngineCI, ppDevice, ppContext);
+///     };
+///     CI.FrameWidth    = 8192;
+///     CI.FrameHeight   = 8192;
+///     CI.InitDevice    = [&](Uint32 DeviceIndex, IRenderDevice* pDevice, IDeviceContext* pContext, IRenderStateCache*) { ... };
+///     CI.Render        = [&](const MultiGPURenderJob& Job) { ... };
+///     CI.FrameCallback = [&](Uint64 FrameId, const MultiGPUFrameData& Data) { SaveImage(FrameId, Data); };
+///
+///     MultiGPURenderer Renderer{CI};
+///     for (Uint32 i = 0; i < NumFrames; ++i)
+///         Renderer.RenderFrame();
+///     Renderer.WaitForFrames();
+///
+/// \remarks    GPU resources cannot be shared between devices of different adapters portably,
+///             so scene data is uploaded to every device by the InitDevice callback. Pipeline states
+///             and shaders are shared through the render state caches.
+class MultiGPURenderer
+{
+public:
+    explicit MultiGPURenderer(const MultiGPURendererCreateInfo& CI);
+    ~MultiGPURenderer();
+
+    // clang-format off
+    MultiGPURenderer           (const MultiGPURenderer&) = delete;
+    MultiGPURenderer& operator=(const MultiGPURenderer&) = delete;
+    MultiGPURenderer           (MultiGPURenderer&&)      = delete;
+    MultiGPURenderer& operator=(MultiGPURenderer&&)      = delete;
+    // clang-format on
+
+    /// Enqueues the jobs of a new frame and returns the frame index.
+
+    /// The method waits while MaxFramesInFlight frames have not been delivered.
+    /// It must not be called by the callbacks.
+    Uint64 RenderFrame();
+
+    /// Waits until all enqueued frames have been delivered to the frame callback.
+    void WaitForFrames();
+
+    /// Returns the number of devices.
+    Uint32 GetNumDevices() const { return static_cast<Uint32>(m_Devices.size()); }
+
+    /// Returns the device with the given index.
+    IRenderDevice* GetDevice(Uint32 DeviceIndex) const { return m_Devices[DeviceIndex]->pDevice; }
+
+    /// Returns the immediate context of the device with the given index.
+    IDeviceContext* GetContext(Uint32 DeviceIndex) const { return m_Devices[DeviceIndex]->pContext; }
+
+    /// Returns the render state cache of the device with the given index, or null if caches are not used.
+    IRenderStateCache* GetRenderStateCache(Uint32 DeviceIndex) const;
+
+    /// Returns the number of jobs rendered by the device with the given index.
+
+    /// Comparing the values of different devices shows how the load is balanced.
+    Uint64 GetNumJobsRendered(Uint32 DeviceIndex) const { return m_Devices[DeviceIndex]->NumJobsRendered.load(); }
+
+    /// Splits the frame into tiles in row-major order. Edge tiles are clipped by the frame bounds.
+    static std::vector<Rect> ComputeTiles(Uint32 FrameWidth, Uint32 FrameHeight, Uint32 TileWidth, Uint32 TileHeight);
+
+private:
+    struct Job
+    {
+        Uint64 FrameId = 0;
+        Rect   Region;
+    };
+
+    struct DeviceData
+    {
+        Uint32                         Index = 0;
+        RefCntAutoPtr<IRenderDevice>   pDevice;
+        RefCntAutoPtr<IDeviceContext>  pContext;
+        RefCntAutoPtr<ISwapChain>      pSwapChain;
+        RefCntAutoPtr<IObject>         pStateCache;
+        std::unique_ptr<ReadbackQueue> pReadbacks;
+        std::thread                    Worker;
+        std::atomic<Uint64>            NumJobsRendered{0};
+    };
+
+    struct PendingFrame
+    {
+        std::vector<Uint8> Pixels;
+        Uint32             NumJobsLeft = 0;
+        bool               Failed      = false;
+    };
+
+    void WorkerThread(DeviceData& Dev);
+    void RenderJob(DeviceData& Dev, const Job& J);
+    void OnJobComplete(Uint64 FrameId, const Rect& Region, const ReadbackQueue::ReadbackData& Data);
+    void OnFrameDelivered(std::vector<Uint8>&& Pixels);
+
+private:
+    const MULTI_GPU_RENDER_MODE m_Mode;
+    const Uint32                m_FrameWidth;
+    const Uint32                m_FrameHeight;
+    const TEXTURE_FORMAT        m_ColorFormat;
+    const Uint32                m_PixelSize;
+    const Uint32                m_NumReadbacksInFlight;
+    Uint32                      m_MaxFramesInFlight = 0;
+    std::vector<Rect>           m_Tiles;
+
+    const MultiGPURendererCreateInfo::InitDeviceCallbackType m_InitDevice;
+    const MultiGPURendererCreateInfo::RenderCallbackType     m_Render;
+    const MultiGPURendererCreateInfo::FrameCallbackType      m_FrameCallback;
+
+    std::vector<std::unique_ptr<DeviceData>> m_Devices;
+
+    // Job queue shared by all workers
+    std::mutex              m_JobsMtx;
+    std::condition_variable m_JobsCV;
+    std::deque<Job>         m_Jobs;
+    bool                    m_Stop = false;
+
+    // Frames that have not been delivered yet
+    std::mutex                               m_FramesMtx;
+    std::condition_variable                  m_FramesCV;
+    std::unordered_map<Uint64, PendingFrame> m_PendingFrames;
+    std::vector<std::vector<Uint8>>          m_FreePixelBuffers;
+    Uint64                                   m_NextFrameId       = 0;
+    Uint32                                   m_NumFramesInFlight = 0;
+};
+
+} // namespace Diligent
@@ -29,12 +29,49 @@
 /// \file
 /// Offscreen swap chain utilities.
 
+#include <functional>
+
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/SwapChain.h"
+#include "ReadbackQueue.hpp"
 
 namespace Diligent
 {
 
+/// Off-screen swap chain create information.
+struct OffScreenSwapChainCreateInfo
+{
+    /// Frame readback callback type.
+
+    /// \param [in] FrameId - Zero-based index of the presented frame.
+    /// \param [in] Data    - Frame pixels. Data.pData is null if the back buffer could not be read back.
+    ///                       The data is only valid until the callback returns.
+    using FrameCallbackType = std::function<void(Uint64 FrameId, const ReadbackQueue::ReadbackData& Data)>;
+
+    /// Callback that receives the contents of every presented frame.
+
+    /// If null, frames are not read back. Present() copies the back buffer into a staging
+    /// texture and never waits for the copy: the callback is called by a later Present()
+    /// once the GPU has finished it, or by a thread pool task if pThreadPool is not null.
+    /// Frames are delivered in the order they were presented.
+    FrameCallbackType FrameCallback;
+
+    /// Optional thread pool to run frame callbacks, e.g. to encode frames while the GPU
+    /// renders the next ones.
+    IThreadPool* pThreadPool = nullptr;
+
+    /// Present callback type.
+    using PresentCallbackType = std::function<void(ITexture* pBackBuffer, Uint64 FrameId)>;
+
+    /// Optional callback that Present() calls with the back buffer before the commands are flushed.
+
+    /// The application may use it to hand the back buffer to an external consumer, e.g. a hardware
+    /// video encoder, through the native texture interfaces (ITextureD3D12, ITextureVk, etc.)
+    /// instead of reading it back to the CPU. The back buffer is not rendered to again until
+    /// SwapChainDesc::BufferCount more frames have been presented.
+    PresentCallbackType PresentCallback;
+};
+
 /// Creates an off-screen swap chain.
 
 /// \param [in] pDevice      - Pointer to the render device.
@@ -43,4 +80,24 @@ namespace Diligent
 /// \param [out] ppSwapChain - Address of the pointer to the swap chain object.
 void CreateOffScreenSwapChain(IRenderDevice* pDevice, IDeviceContext* pContext, const SwapChainDesc& SCDesc, ISwapChain** ppSwapChain);
 
+/// Creates an off-screen swap chain that produces frames for a CPU or external consumer.
+
+/// If a frame or present callback is specified, the swap chain cycles through SCDesc.BufferCount
+/// color buffers, so that the GPU can render the next frames while the previous ones are read back
+/// and processed.
+///
+/// \param [in] pDevice      - Pointer to the render device.
+/// \param [in] pContext     - Pointer to the immediate device context.
+/// \param [in] SCDesc       - Swap chain description.
+/// \param [in] CI           - Off-screen swap chain create information.
+/// \param [out] ppSwapChain - Address of the pointer to the swap chain object.
+///
+/// \remarks   Present() must be called from the thread that uses the immediate context.
+///            Pending frames are delivered to the frame callback when the swap chain is destroyed.
+void CreateOffScreenSwapChain(IRenderDevice*                      pDevice,
+                              IDeviceContext*                     pContext,
+                              const SwapChainDesc&                SCDesc,
+                              const OffScreenSwapChainCreateInfo& CI,
+                              ISwapChain**                        ppSwapChain);
+
 } // namespace Diligent
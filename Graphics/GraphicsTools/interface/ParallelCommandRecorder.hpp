@@ -0,0 +1,201 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ParallelCommandRecorder class
+
+#include <vector>
+#include <functional>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/CommandList.h"
+#include "../../../Common/interface/ThreadPool.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Parallel command recorder create information.
+struct ParallelCommandRecorderCreateInfo
+{
+    /// Render device.
+    IRenderDevice* pDevice = nullptr;
+
+    /// Immediate context the recorded commands are submitted to.
+    IDeviceContext* pImmediateContext = nullptr;
+
+    /// Thread pool used to record the commands.
+
+    /// If null, all contexts are recorded by the calling thread.
+    IThreadPool* pThreadPool = nullptr;
+
+    /// The number of deferred contexts to create.
+    Uint32 NumContexts = 4;
+};
+
+
+/// Records draw batches in parallel using deferred contexts and submits them in order.
+
+/// The recorder owns a set of deferred contexts. Record() splits the batches into
+/// contiguous ranges, one per context, records the ranges on the thread pool and
+/// executes the resulting command lists in the immediate context in the range order,
+/// so the GPU sees the batches in the same order as if they were recorded sequentially.
+///
+/// Typical usage:
+///
+///     ParallelCommandRecorder Recorder{{pDevice, pImmediateCtx, pThreadPool, 8}};
+///     ...
+///     ParallelCommandRecorder::RecordAttribs Attribs;
+///     Attribs.NumBatches       = static_cast<Uint32>(Objects.size());
+///     Attribs.NumRenderTargets = 1;
+///     Attribs.ppRenderTargets  = &pRTV;
+///     Attribs.pDepthStencil    = pDSV;
+///     Attribs.RecordBatch      = [&](IDeviceContext* pCtx, Uint32 Batch) {
+///         Objects[Batch].Draw(pCtx);
+///     };
+///     Recorder.Record(Attribs);
+///
+/// \remarks    Every deferred context records into its own command list, and the render target
+///             state is re-established in each of them: the render targets are bound, and the
+///             BeginContext callback may set other state shared by all batches, such as the
+///             viewports or begin a render pass with LOAD operations. The batches in a context
+///             may rely on the state set by the previous batches in the same context only.
+///
+///             Record() transitions the render targets to the required states in the immediate
+///             context before recording. All other resources used by the batches must be transitioned
+///             beforehand, and the batches must use Diligent::RESOURCE_STATE_TRANSITION_MODE_VERIFY
+///             or Diligent::RESOURCE_STATE_TRANSITION_MODE_NONE.
+///
+///             If the device does not support deferred contexts (WebGPU), all batches are
+///             recorded by the calling thread directly into the immediate context.
+///             In OpenGL, the batches are recorded into command streams that the immediate context
+///             replays when the command lists are executed, see Diligent::RecordingDeviceContext.
+///
+///             After the command lists are executed, the immediate context state is reset as
+///             described in IDeviceContext::ExecuteCommandLists().
+///
+///             The recorder is not thread-safe: Record() must not be called simultaneously from
+///             multiple threads.
+class ParallelCommandRecorder
+{
+public:
+    /// The callback that records a single batch.
+
+    /// The callback is called concurrently from multiple threads for different contexts.
+    using RecordBatchCallbackType = std::function<void(IDeviceContext* pCtx, Uint32 BatchIndex)>;
+
+    /// The callback that is called for every context before the first and after the last batch.
+    using ContextCallbackType = std::function<void(IDeviceContext* pCtx)>;
+
+    /// Record attributes.
+    struct RecordAttribs
+    {
+        /// The number of batches to record.
+        Uint32 NumBatches = 0;
+
+        /// The callback that records a batch.
+        RecordBatchCallbackType RecordBatch;
+
+        /// The number of render targets to bind in every context.
+        Uint32 NumRenderTargets = 0;
+
+        /// Render targets to bind in every context.
+        ITextureView** ppRenderTargets = nullptr;
+
+        /// Depth-stencil view to bind in every context.
+        ITextureView* pDepthStencil = nullptr;
+
+        /// Optional callback called for every context after the render targets are bound
+        /// and before the first batch is recorded.
+        ContextCallbackType BeginContext;
+
+        /// Optional callback called for every context after the last batch is recorded.
+        ContextCallbackType EndContext;
+
+        /// The maximum number of contexts to use. If zero, all contexts are used.
+        Uint32 MaxContexts = 0;
+
+        /// The minimum number of batches recorded by one context.
+
+        /// Small amounts of work are not worth the overhead of an extra command list.
+        Uint32 MinBatchesPerContext = 1;
+    };
+
+    /// Record statistics.
+    struct Statistics
+    {
+        /// The number of contexts used by the last call to Record().
+        Uint32 NumContextsUsed = 0;
+
+        /// The total number of batches recorded.
+        Uint64 NumBatchesRecorded = 0;
+
+        /// The total number of command lists submitted.
+        Uint64 NumCommandListsSubmitted = 0;
+    };
+
+    explicit ParallelCommandRecorder(const ParallelCommandRecorderCreateInfo& CI);
+
+    // clang-format off
+    ParallelCommandRecorder           (const ParallelCommandRecorder&) = delete;
+    ParallelCommandRecorder& operator=(const ParallelCommandRecorder&) = delete;
+    ParallelCommandRecorder           (ParallelCommandRecorder&&)      = delete;
+    ParallelCommandRecorder& operator=(ParallelCommandRecorder&&)      = delete;
+    // clang-format on
+
+    /// Records the batches and submits them to the immediate context.
+
+    /// The method returns when the command lists have been submitted.
+    void Record(const RecordAttribs& Attribs);
+
+    /// Returns the number of deferred contexts.
+    Uint32 GetNumContexts() const { return static_cast<Uint32>(m_Contexts.size()); }
+
+    /// Returns true if the commands are recorded in parallel, and false if
+    /// the device does not support deferred contexts.
+    bool IsParallel() const { return !m_Contexts.empty(); }
+
+    /// Returns the record statistics.
+    const Statistics& GetStatistics() const { return m_Stats; }
+
+private:
+    void RecordContext(IDeviceContext* pCtx, const RecordAttribs& Attribs, Uint32 FirstBatch, Uint32 EndBatch) const;
+
+private:
+    RefCntAutoPtr<IDeviceContext> m_pImmediateContext;
+    RefCntAutoPtr<IThreadPool>    m_pThreadPool;
+
+    std::vector<RefCntAutoPtr<IDeviceContext>> m_Contexts;
+    std::vector<RefCntAutoPtr<ICommandList>>   m_CommandLists;
+
+    Statistics m_Stats;
+};
+
+} // namespace Diligent
@@ -0,0 +1,244 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::QueueScheduler class
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <unordered_map>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Fence.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Schedules work on multiple immediate contexts and synchronizes the queues.
+
+/// Work is submitted as (context, dependencies, resources) items in the order it should be
+/// recorded. When the work is executed, the scheduler
+/// - makes the context wait for the fences signaled after the work it depends on in other contexts,
+///   skipping waits that are already satisfied by previous waits;
+/// - adds implicit dependencies between the work items that access the same resource in different
+///   contexts when at least one access writes the resource or changes its state;
+/// - transitions the resources to the declared states. When a resource was last used by a graphics
+///   context and is next used by a compute or transfer context, the transition is recorded at the end
+///   of the last graphics work, because compute and transfer queues can't transition resources
+///   from graphics-only states such as Diligent::RESOURCE_STATE_RENDER_TARGET.
+///
+/// Typical usage that overlaps SSAO and light culling on a compute queue with shadow rendering:
+///
+///     QueueScheduler Scheduler{pDevice, Contexts, 2}; // 0 - graphics, 1 - compute
+///     ...
+///     QueueScheduler::WorkId DepthPrepass = Scheduler.AddWork({"Depth prepass", 0, {}, {{pDepth, RESOURCE_STATE_DEPTH_WRITE, true}}}, RenderDepth);
+///     QueueScheduler::WorkId Shadows      = Scheduler.AddWork({"Shadows", 0, {}, {{pShadowMap, RESOURCE_STATE_DEPTH_WRITE, true}}}, RenderShadows);
+///     QueueScheduler::WorkId SSAO         = Scheduler.AddWork({"SSAO", 1, {}, {{pDepth, RESOURCE_STATE_SHADER_RESOURCE}, {pAO, RESOURCE_STATE_UNORDERED_ACCESS, true}}}, ComputeSSAO);
+///     Scheduler.AddWork({"Lighting", 0, {SSAO, Shadows}, {{pAO, RESOURCE_STATE_SHADER_RESOURCE}, {pShadowMap, RESOURCE_STATE_SHADER_RESOURCE}}}, RenderLighting);
+///     Scheduler.Execute();
+///
+/// \remarks    Resources used by several contexts must be created with Diligent::BufferDesc::ImmediateContextMask
+///             or Diligent::TextureDesc::ImmediateContextMask that includes all of them. This lets
+///             the engine share them between queues (VK_SHARING_MODE_CONCURRENT in Vulkan), so no
+///             queue family ownership transfers are required.
+///
+///             The scheduler updates the states of the resources it transitions. Work callbacks should use
+///             Diligent::RESOURCE_STATE_TRANSITION_MODE_VERIFY or Diligent::RESOURCE_STATE_TRANSITION_MODE_NONE
+///             for these resources.
+///
+///             Resource tracking persists between calls to Execute(), so that a resource written by one context
+///             in a frame is synchronized with its use by another context in the next frame.
+///
+///             The scheduler is not thread-safe.
+class QueueScheduler
+{
+public:
+    /// Work identifier. Identifiers are only valid until the next call to Execute().
+    using WorkId = Uint32;
+
+    /// Invalid work identifier.
+    static constexpr WorkId InvalidWorkId = ~WorkId{0};
+
+    /// Resource accessed by a work item.
+    struct ResourceUsage
+    {
+        /// Texture or buffer.
+        IDeviceObject* pResource = nullptr;
+
+        /// The state the resource must be in when the work is executed.
+        RESOURCE_STATE State = RESOURCE_STATE_UNKNOWN;
+
+        /// Whether the work writes the resource.
+        bool Write = false;
+    };
+
+    /// Work item description.
+    struct WorkDesc
+    {
+        /// Work name used in debug groups.
+        const char* Name = nullptr;
+
+        /// Index of the context in the array passed to the constructor.
+        Uint32 ContextIndex = 0;
+
+        /// Work items that must complete before this work starts.
+        /// Only items added before this one may be referenced.
+        std::vector<WorkId> Dependencies;
+
+        /// Resources accessed by the work.
+        std::vector<ResourceUsage> Resources;
+    };
+
+    /// The callback that records the work commands.
+    using CallbackType = std::function<void(IDeviceContext* pCtx)>;
+
+    /// Scheduler statistics.
+    struct Statistics
+    {
+        /// The total number of fence waits inserted by the scheduler.
+        Uint32 NumFenceWaits = 0;
+
+        /// The total number of fence signals inserted by the scheduler.
+        Uint32 NumFenceSignals = 0;
+
+        /// The total number of resource state transitions.
+        Uint32 NumTransitions = 0;
+
+        /// The total number of dependencies between contexts added because of shared resources.
+        Uint32 NumImplicitDependencies = 0;
+    };
+
+    /// Creates the scheduler.
+
+    /// \param [in] pDevice     - Render device.
+    /// \param [in] ppContexts  - Immediate contexts to schedule the work on.
+    /// \param [in] NumContexts - The number of contexts.
+    QueueScheduler(IRenderDevice* pDevice, IDeviceContext* const* ppContexts, Uint32 NumContexts);
+    ~QueueScheduler();
+
+    // clang-format off
+    QueueScheduler           (const QueueScheduler&) = delete;
+    QueueScheduler& operator=(const QueueScheduler&) = delete;
+    QueueScheduler           (QueueScheduler&&)      = delete;
+    QueueScheduler& operator=(QueueScheduler&&)      = delete;
+    // clang-format on
+
+    /// Adds a work item.
+
+    /// \return     The work identifier that may be used as a dependency of the items added later,
+    ///             or InvalidWorkId if the description is invalid.
+    WorkId AddWork(const WorkDesc& Desc, CallbackType Callback);
+
+    /// Records and submits all work items added since the last call in the order they were added.
+    void Execute();
+
+    /// Returns the number of contexts.
+    Uint32 GetNumContexts() const { return static_cast<Uint32>(m_Contexts.size()); }
+
+    /// Returns the context with the given index.
+    IDeviceContext* GetContext(Uint32 Index) const { return m_Contexts[Index].pCtx; }
+
+    /// Returns the scheduler statistics.
+    const Statistics& GetStatistics() const { return m_Stats; }
+
+private:
+    // The point in a context's command stream that other contexts may wait for
+    struct SyncPoint
+    {
+        Uint32 ContextIndex = ~0u;
+
+        // Work in the current batch, or InvalidWorkId if the point is in a previous batch
+        WorkId Work = InvalidWorkId;
+
+        // Fence value of a point in a previous batch
+        Uint64 FenceValue = 0;
+
+        bool IsValid() const { return ContextIndex != ~0u; }
+    };
+
+    struct Work
+    {
+        std::string  Name;
+        Uint32       ContextIndex = 0;
+        CallbackType Callback;
+
+        std::vector<SyncPoint>           Waits;
+        std::vector<StateTransitionDesc> PreBarriers;
+        // Barriers recorded after the callback and before the signal, on behalf of the work in other contexts
+        std::vector<StateTransitionDesc> PostBarriers;
+
+        bool   Signal      = false;
+        Uint64 SignalValue = 0;
+    };
+
+    struct TrackedResource
+    {
+        RefCntAutoPtr<IDeviceObject> pResource;
+
+        RESOURCE_STATE State = RESOURCE_STATE_UNKNOWN;
+
+        // The last work that wrote the resource or changed its state
+        SyncPoint Writer;
+
+        // The last work that read the resource in every context since the last write
+        std::vector<SyncPoint> Readers;
+    };
+
+    struct Context
+    {
+        RefCntAutoPtr<IDeviceContext> pCtx;
+        RefCntAutoPtr<IFence>         pFence;
+
+        Uint64 NextFenceValue    = 1;
+        Uint64 LastSignaledValue = 0;
+
+        bool IsGraphics = false;
+        bool HasWork    = false;
+
+        // The last fence value of every context this context has waited for
+        std::vector<Uint64> LastWaitedValues;
+    };
+
+    TrackedResource* GetTrackedResource(IDeviceObject* pResource);
+    bool             AddDependency(Work& W, const SyncPoint& Sync);
+    void             AddTransition(Work& W, TrackedResource& Res, RESOURCE_STATE NewState);
+
+private:
+    std::vector<Context> m_Contexts;
+    std::vector<Work>    m_Works;
+
+    std::unordered_map<IDeviceObject*, TrackedResource> m_Resources;
+
+    Statistics m_Stats;
+};
+
+} // namespace Diligent
@@ -0,0 +1,227 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ReadbackQueue class
+
+#include <vector>
+#include <deque>
+#include <functional>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/ThreadPool.h"
+#include "GPUCompletionAwaitQueue.hpp"
+
+namespace Diligent
+{
+
+/// Readback queue create information.
+struct ReadbackQueueCreateInfo
+{
+    /// The number of frames in flight.
+
+    /// The queue keeps at most this many recycled staging resources of every size,
+    /// which is enough to read back the same resource every frame without creating
+    /// new staging resources.
+    Uint32 NumFramesInFlight = 3;
+
+    /// An optional thread pool to run completion callbacks.
+
+    /// If null, callbacks are executed by ReadbackQueue::Poll() in the calling thread.
+    /// Otherwise, the callbacks of the readbacks that completed by the time Poll() is
+    /// called are executed by one asynchronous task in the order the readbacks were
+    /// enqueued. Callbacks from different calls to Poll() may run concurrently.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+
+/// Asynchronous GPU readback queue.
+
+/// The queue copies buffer and texture data into recycled staging resources, signals a fence
+/// after every copy and delivers the data to a completion callback once the fence is reached.
+/// Poll() never waits for the GPU.
+///
+/// On backends where staging memory is persistently mapped by the engine (Direct3D12, Vulkan, Metal),
+/// callbacks executed by the thread pool receive the pointer to the staging memory, which stays mapped
+/// until the callback returns. On other backends, the data is copied to CPU memory before it is handed
+/// to the thread pool, and the staging resource is recycled immediately.
+///
+/// Typical usage:
+///
+///     ReadbackQueue Readbacks{pDevice, CI};
+///     ...
+///     Readbacks.ReadBuffer(pCtx, pPickingBuffer, 0, sizeof(PickingResult),
+///         [](const ReadbackQueue::ReadbackData& Data) {
+///             if (Data.pData != nullptr)
+///                 ProcessPickingResult(*static_cast<const PickingResult*>(Data.pData));
+///         });
+///     ...
+///     Readbacks.Poll(pCtx); // Once per frame
+///
+/// \remarks    All methods must be called from the same thread that uses the device context,
+///             and the same immediate context must be used for all readbacks.
+///             The queue is not thread-safe.
+class ReadbackQueue
+{
+public:
+    /// Readback data passed to the completion callback.
+    struct ReadbackData
+    {
+        /// Pointer to the data, or null if the staging resource could not be mapped.
+        /// The pointer is only valid until the callback returns.
+        const void* pData = nullptr;
+
+        /// Data size in bytes.
+        Uint64 DataSize = 0;
+
+        /// Texture row stride in bytes. For compressed formats, this is the stride of one row of blocks.
+        Uint64 Stride = 0;
+
+        /// Texture depth slice stride in bytes.
+        Uint64 DepthStride = 0;
+
+        /// Texture region dimensions.
+        Uint32 Width  = 0;
+        Uint32 Height = 0;
+        Uint32 Depth  = 0;
+
+        /// Texture format.
+        TEXTURE_FORMAT Format = TEX_FORMAT_UNKNOWN;
+    };
+
+    /// Completion callback type.
+    using CallbackType = std::function<void(const ReadbackData&)>;
+
+    ReadbackQueue(IRenderDevice* pDevice, const ReadbackQueueCreateInfo& CI = {});
+    ~ReadbackQueue();
+
+    // clang-format off
+    ReadbackQueue           (const ReadbackQueue&) = delete;
+    ReadbackQueue& operator=(const ReadbackQueue&) = delete;
+    ReadbackQueue           (ReadbackQueue&&)      = delete;
+    ReadbackQueue& operator=(ReadbackQueue&&)      = delete;
+    // clang-format on
+
+    /// Enqueues a buffer readback.
+
+    /// \param [in] pCtx     - Immediate device context to record the copy command.
+    /// \param [in] pBuffer  - Buffer to read back.
+    /// \param [in] Offset   - Offset of the data in the buffer.
+    /// \param [in] Size     - Size of the data.
+    /// \param [in] Callback - Callback to receive the data.
+    ///
+    /// \return     true if the readback has been enqueued, and false otherwise.
+    bool ReadBuffer(IDeviceContext* pCtx,
+                    IBuffer*        pBuffer,
+                    Uint64          Offset,
+                    Uint64          Size,
+                    CallbackType    Callback);
+
+    /// Enqueues a texture readback.
+
+    /// \param [in] pCtx        - Immediate device context to record the copy command.
+    /// \param [in] pTexture    - Texture to read back.
+    /// \param [in] MipLevel    - Mip level to read back.
+    /// \param [in] ArraySlice  - Array slice to read back.
+    /// \param [in] pRegion     - Optional region of the mip level. If null, the entire mip level is read back.
+    /// \param [in] Callback    - Callback to receive the data.
+    ///
+    /// \return     true if the readback has been enqueued, and false otherwise.
+    bool ReadTexture(IDeviceContext* pCtx,
+                     ITexture*       pTexture,
+                     Uint32          MipLevel,
+                     Uint32          ArraySlice,
+                     const Box*      pRegion,
+                     CallbackType    Callback);
+
+    /// Delivers the readbacks that have been completed by the GPU and recycles
+    /// the staging resources whose callbacks have finished.
+    void Poll(IDeviceContext* pCtx);
+
+    /// Waits until all callbacks running in the thread pool finish and recycles their staging resources.
+
+    /// \remarks    Readbacks that have not been completed by the GPU are not affected.
+    ///             This method must be called before the queue is destroyed if the thread pool is used.
+    void WaitForCallbacks(IDeviceContext* pCtx);
+
+    /// Returns the number of readbacks that have not been completed by the GPU yet.
+    Uint32 GetNumPendingReadbacks() const { return m_NumPendingReadbacks; }
+
+private:
+    struct Readback
+    {
+        RefCntAutoPtr<IBuffer>  pStagingBuffer;
+        RefCntAutoPtr<ITexture> pStagingTexture;
+
+        CallbackType Callback;
+        ReadbackData Data;
+
+        // CPU copy of the data for backends that do not keep staging memory mapped
+        std::vector<Uint8> CPUData;
+
+        bool IsMapped = false;
+
+        explicit operator bool() const
+        {
+            return pStagingBuffer || pStagingTexture;
+        }
+    };
+
+    struct CallbackBatch
+    {
+        std::vector<Readback>     Readbacks;
+        RefCntAutoPtr<IAsyncTask> pTask;
+    };
+
+    RefCntAutoPtr<IBuffer>  GetStagingBuffer(Uint64 Size);
+    RefCntAutoPtr<ITexture> GetStagingTexture(const TextureDesc& Desc);
+
+    void MapReadback(IDeviceContext* pCtx, Readback& RB);
+    void ReleaseReadback(IDeviceContext* pCtx, Readback& RB);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+    RefCntAutoPtr<IThreadPool>   m_pThreadPool;
+
+    const Uint32 m_NumFramesInFlight;
+    const bool   m_KeepStagingMapped;
+
+    GPUCompletionAwaitQueue<Readback> m_PendingReadbacks;
+    Uint32                            m_NumPendingReadbacks = 0;
+
+    // Callback batches in the order they were submitted to the thread pool.
+    // Deque keeps the references to batches valid while they are used by the tasks.
+    std::deque<CallbackBatch> m_CallbackBatches;
+
+    std::vector<RefCntAutoPtr<IBuffer>>  m_RecycledBuffers;
+    std::vector<RefCntAutoPtr<ITexture>> m_RecycledTextures;
+};
+
+} // namespace Diligent
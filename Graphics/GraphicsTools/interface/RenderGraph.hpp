@@ -0,0 +1,371 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::RenderGraph class
+
+#include <vector>
+#include <string>
+#include <functional>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Render graph create information.
+struct RenderGraphCreateInfo
+{
+    /// Whether to let transient resources with disjoint lifetimes share memory.
+
+    /// When enabled, transient textures and buffers that are supported by the device as aliased
+    /// sparse resources (see Diligent::SPARSE_RESOURCE_CAP_FLAG_ALIASED) are placed into shared
+    /// device memory objects at offsets computed from their lifetimes. All other transient
+    /// resources are only aliased by reusing the same resource object in passes whose
+    /// lifetimes do not overlap.
+    bool EnableMemoryAliasing = true;
+
+    /// The number of frames after which a pooled transient resource that has
+    /// not been used by the graph is released.
+    Uint32 MaxIdleFrames = 4;
+};
+
+
+/// Render graph that schedules state transitions and manages transient resources of a frame.
+
+/// Every frame, the application imports external resources, declares transient resources
+/// and adds passes that specify which resources they read and write. When the graph is
+/// executed, it
+/// - culls the passes whose results are not used by any pass that writes an imported resource
+///   or has side effects;
+/// - assigns memory to transient resources so that resources with disjoint lifetimes
+///   share memory;
+/// - executes the passes in the order they were added, issuing one batch of state transitions
+///   before every pass that skips redundant transitions.
+///
+/// Typical usage:
+///
+///     RenderGraph Graph{pDevice};
+///     ...
+///     Graph.Reset(); // Once per frame
+///
+///     RenderGraph::ResourceId BackBuffer = Graph.ImportTexture(pSwapChain->GetCurrentBackBufferRTV()->GetTexture(),
+///                                                              RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_PRESENT);
+///     RenderGraph::ResourceId GBuffer    = Graph.CreateTexture(GBufferDesc);
+///
+///     Graph.AddPass("GBuffer",
+///         [&](RenderGraph::PassBuilder& Builder) {
+///             Builder.Write(GBuffer, RESOURCE_STATE_RENDER_TARGET);
+///         },
+///         [&](IDeviceContext* pCtx, const RenderGraph& Graph) {
+///             ITextureView* pRTV = Graph.GetTexture(GBuffer)->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+///             pCtx->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+///             ...
+///         });
+///
+///     Graph.AddPass("Lighting",
+///         [&](RenderGraph::PassBuilder& Builder) {
+///             Builder.Read(GBuffer, RESOURCE_STATE_SHADER_RESOURCE);
+///             Builder.Write(BackBuffer, RESOURCE_STATE_RENDER_TARGET);
+///         },
+///         ...);
+///
+///     Graph.Execute(pCtx);
+///
+/// \remarks    The graph transitions all resources it manages to the states declared by the passes
+///             and updates their internal states. Pass callbacks should use
+///             Diligent::RESOURCE_STATE_TRANSITION_MODE_VERIFY or Diligent::RESOURCE_STATE_TRANSITION_MODE_NONE
+///             for these resources.
+///
+///             The contents of transient resources are undefined when they are first used in a frame.
+///
+///             The graph is not thread-safe.
+class RenderGraph
+{
+public:
+    /// Resource identifier.
+    using ResourceId = Uint32;
+
+    /// Invalid resource identifier.
+    static constexpr ResourceId InvalidResourceId = ~ResourceId{0};
+
+    /// Pass builder that is used by the setup callback to declare the resources the pass accesses.
+    class PassBuilder
+    {
+    public:
+        /// Declares that the pass reads the resource in the given state.
+        PassBuilder& Read(ResourceId Id, RESOURCE_STATE State);
+
+        /// Declares that the pass writes the resource in the given state.
+        PassBuilder& Write(ResourceId Id, RESOURCE_STATE State);
+
+        /// Declares that the pass has side effects and must never be culled.
+        PassBuilder& SetSideEffects();
+
+    private:
+        friend RenderGraph;
+        PassBuilder(RenderGraph& Graph, Uint32 PassIdx) :
+            m_Graph{Graph},
+            m_PassIdx{PassIdx}
+        {}
+
+        RenderGraph& m_Graph;
+        const Uint32 m_PassIdx;
+    };
+
+    /// Pass setup callback type.
+    using SetupCallbackType = std::function<void(PassBuilder& Builder)>;
+
+    /// Pass execute callback type.
+    using ExecuteCallbackType = std::function<void(IDeviceContext* pCtx, const RenderGraph& Graph)>;
+
+    /// Render graph statistics.
+    struct Statistics
+    {
+        /// The number of passes added to the graph.
+        Uint32 NumPasses = 0;
+
+        /// The number of passes that were culled.
+        Uint32 NumCulledPasses = 0;
+
+        /// The number of transient resources used by the executed passes.
+        Uint32 NumTransientResources = 0;
+
+        /// The number of resource objects that back the transient resources.
+        Uint32 NumPhysicalResources = 0;
+
+        /// The number of transient resources placed in shared device memory.
+        Uint32 NumMemoryAliasedResources = 0;
+
+        /// The number of state transition batches.
+        Uint32 NumBarrierBatches = 0;
+
+        /// The total number of state transitions, including aliasing transitions.
+        Uint32 NumBarriers = 0;
+
+        /// The memory required by the resources placed in shared device memory without aliasing.
+        Uint64 MemoryAliasedResourcesSize = 0;
+
+        /// The size of the shared device memory.
+        Uint64 AliasedMemorySize = 0;
+    };
+
+    RenderGraph(IRenderDevice* pDevice, const RenderGraphCreateInfo& CI = {});
+    ~RenderGraph();
+
+    // clang-format off
+    RenderGraph           (const RenderGraph&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+    RenderGraph           (RenderGraph&&)      = delete;
+    RenderGraph& operator=(RenderGraph&&)      = delete;
+    // clang-format on
+
+    /// Removes all passes and resources from the graph.
+
+    /// Transient resource objects and device memory are kept and reused by the next frame.
+    void Reset();
+
+    /// Imports an external texture into the graph.
+
+    /// \param [in] pTexture     - Texture to import.
+    /// \param [in] InitialState - The texture state at the beginning of the graph execution.
+    ///                            If Diligent::RESOURCE_STATE_UNKNOWN, the internal texture state is used,
+    ///                            which must be known in this case.
+    /// \param [in] FinalState   - The state to transition the texture to after all passes are executed.
+    ///                            If Diligent::RESOURCE_STATE_UNKNOWN, the texture is left in the
+    ///                            state required by the last pass that uses it.
+    ///
+    /// \return     The resource identifier.
+    ///
+    /// \remarks    Passes that write imported resources are never culled.
+    ResourceId ImportTexture(ITexture*      pTexture,
+                             RESOURCE_STATE InitialState = RESOURCE_STATE_UNKNOWN,
+                             RESOURCE_STATE FinalState   = RESOURCE_STATE_UNKNOWN);
+
+    /// Imports an external buffer into the graph, see ImportTexture().
+    ResourceId ImportBuffer(IBuffer*       pBuffer,
+                            RESOURCE_STATE InitialState = RESOURCE_STATE_UNKNOWN,
+                            RESOURCE_STATE FinalState   = RESOURCE_STATE_UNKNOWN);
+
+    /// Declares a transient texture.
+
+    /// The texture object is assigned when the graph is executed and is only valid
+    /// in the execute callbacks of the passes that access it.
+    ResourceId CreateTexture(const TextureDesc& Desc);
+
+    /// Declares a transient buffer, see CreateTexture().
+    ResourceId CreateBuffer(const BufferDesc& Desc);
+
+    /// Adds a pass to the graph.
+
+    /// \param [in] Name    - Pass name. It is used as the debug group name.
+    /// \param [in] Setup   - Callback that declares the resources the pass accesses.
+    ///                       It is called immediately.
+    /// \param [in] Execute - Callback that records the pass commands.
+    ///                       It is called by RenderGraph::Execute() unless the pass is culled.
+    void AddPass(const char*         Name,
+                 SetupCallbackType   Setup,
+                 ExecuteCallbackType Execute);
+
+    /// Executes the passes that are not culled.
+
+    /// \param [in] pCtx - Immediate device context to record the commands.
+    void Execute(IDeviceContext* pCtx);
+
+    /// Returns the texture object of the resource.
+
+    /// \remarks    For transient textures, the method must only be called by the execute callbacks.
+    ITexture* GetTexture(ResourceId Id) const;
+
+    /// Returns the buffer object of the resource, see GetTexture().
+    IBuffer* GetBuffer(ResourceId Id) const;
+
+    /// Returns true if the pass with the given index was culled by the last execution.
+    bool IsPassCulled(Uint32 PassIdx) const;
+
+    /// Returns the statistics of the last execution.
+    const Statistics& GetStatistics() const { return m_Stats; }
+
+private:
+    struct ResourceAccess
+    {
+        ResourceId     Id    = InvalidResourceId;
+        RESOURCE_STATE State = RESOURCE_STATE_UNKNOWN;
+        bool           Write = false;
+    };
+
+    struct Pass
+    {
+        std::string                 Name;
+        std::vector<ResourceAccess> Accesses;
+        ExecuteCallbackType         Execute;
+
+        bool SideEffects = false;
+        bool Culled      = false;
+    };
+
+    struct Resource
+    {
+        std::string Name;
+        TextureDesc TexDesc;
+        BufferDesc  BuffDesc;
+
+        RefCntAutoPtr<ITexture> pTexture;
+        RefCntAutoPtr<IBuffer>  pBuffer;
+
+        bool IsTexture = false;
+        bool Imported  = false;
+
+        RESOURCE_STATE InitialState = RESOURCE_STATE_UNKNOWN;
+        RESOURCE_STATE FinalState   = RESOURCE_STATE_UNKNOWN;
+
+        // The first and the last pass that use the resource
+        Uint32 FirstPass = ~0u;
+        Uint32 LastPass  = 0;
+
+        // Resource that must be passed to the aliasing transition at the first use
+        IDeviceObject* pAliasedBefore = nullptr;
+        bool           NeedsAliasing  = false;
+
+        IDeviceObject* GetObject() const;
+        bool           IsUsed() const { return FirstPass <= LastPass; }
+    };
+
+    // Transient resource object reused by resources with disjoint lifetimes
+    struct PooledObject
+    {
+        RefCntAutoPtr<ITexture> pTexture;
+        RefCntAutoPtr<IBuffer>  pBuffer;
+
+        Uint32 IdleFrames = 0;
+        // The last pass that uses the object in the current frame
+        Uint32 BusyUntil = 0;
+        bool   InUse     = false;
+    };
+
+    // Aliased sparse resources that share one device memory object
+    struct AliasedHeap
+    {
+        struct Placement
+        {
+            TextureDesc TexDesc;
+            BufferDesc  BuffDesc;
+            Uint32      FirstPass = 0;
+            Uint32      LastPass  = 0;
+
+            bool operator==(const Placement& RHS) const;
+        };
+        // Placements of the resources the heap was built for
+        std::vector<Placement> Layout;
+
+        std::vector<RefCntAutoPtr<ITexture>> Textures;
+        std::vector<RefCntAutoPtr<IBuffer>>  Buffers;
+        std::vector<Uint64>                  Offsets;
+        std::vector<Uint64>                  Sizes;
+
+        RefCntAutoPtr<IDeviceMemory> pMemory;
+
+        bool BindPending = false;
+
+        void Clear();
+    };
+
+    ResourceId AddResource(Resource&& Res);
+    void       AddAccess(Uint32 PassIdx, ResourceId Id, RESOURCE_STATE State, bool Write);
+
+    void CullPasses();
+    void ComputeLifetimes();
+    bool IsMemoryAliasingSupported(IDeviceContext* pCtx) const;
+    bool IsSparseAliasingSupported(const Resource& Res) const;
+    bool BuildAliasedHeap(AliasedHeap& Heap, const std::vector<ResourceId>& Ids, bool IsTexture);
+    void AssignAliasedHeap(AliasedHeap& Heap, const std::vector<ResourceId>& Ids);
+    void AssignPooledObjects();
+    void BindAliasedHeaps(IDeviceContext* pCtx);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    // Memory aliasing is disabled if aliased resources can't be created
+    bool         m_EnableMemoryAliasing;
+    const Uint32 m_MaxIdleFrames;
+
+    std::vector<Pass>     m_Passes;
+    std::vector<Resource> m_Resources;
+
+    std::vector<PooledObject> m_PooledObjects;
+
+    AliasedHeap m_TextureHeap;
+    AliasedHeap m_BufferHeap;
+
+    Statistics m_Stats;
+};
+
+} // namespace Diligent
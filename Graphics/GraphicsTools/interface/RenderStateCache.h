@@ -114,6 +114,25 @@ struct RenderStateCacheCreateInfo
     /// shaders. If null, original source factory will be used.
     IShaderSourceInputStreamFactory* pReloadSource DEFAULT_INITIALIZER(nullptr);
 
+    /// Optional render state cache of another device to share the device-independent data with.
+
+    /// When several devices are created in the same process, the caches of these devices can share
+    /// the serialization device and the archiver, so that every shader is compiled once, and only
+    /// the device objects are created by every device. The shared cache must have been created for
+    /// a device of the same type with the same shader compilation settings (API version, shader
+    /// version, NDC depth range and separable programs support). Otherwise, a warning is logged
+    /// and the new cache uses its own data.
+    ///
+    /// The render states that are added by any of the caches are written by WriteToBlob(),
+    /// WriteDeltaToBlob() and other write methods of any cache, and are merged into the loaded data
+    /// of every cache. Reset() discards the unsaved render states of all caches.
+    /// Load() only loads the data into the cache it is called on: to share the memory, load the same
+    /// data blob into every cache without making a copy.
+    ///
+    /// Shader compilation settings that are not listed above, e.g. OptimizeGLShaders, are defined
+    /// by the cache that created the shared data.
+    struct IRenderStateCache* pSharedCache DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr RenderStateCacheCreateInfo() noexcept
     {}
@@ -125,19 +144,42 @@ struct RenderStateCacheCreateInfo
         RENDER_STATE_CACHE_FILE_HASH_MODE _FileHashMode      = RenderStateCacheCreateInfo{}.FileHashMode,
         bool                              _EnableHotReload   = RenderStateCacheCreateInfo{}.EnableHotReload,
         bool                              _OptimizeGLShaders = RenderStateCacheCreateInfo{}.OptimizeGLShaders,
-        IShaderSourceInputStreamFactory*  _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource) noexcept :
+        IShaderSourceInputStreamFactory*  _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource,
+        struct IRenderStateCache*         _pSharedCache      = RenderStateCacheCreateInfo{}.pSharedCache) noexcept :
         pDevice{_pDevice},
         pArchiverFactory{_pArchiverFactory},
         LogLevel{_LogLevel},
         FileHashMode{_FileHashMode},
         EnableHotReload{_EnableHotReload},
         OptimizeGLShaders{_OptimizeGLShaders},
-        pReloadSource{_pReloadSource}
+        pReloadSource{_pReloadSource},
+        pSharedCache{_pSharedCache}
     {}
 #endif
 };
 typedef struct RenderStateCacheCreateInfo RenderStateCacheCreateInfo;
 
+/// Render state cache precompilation progress, see IRenderStateCache::GetPrecompileProgress().
+struct RenderStateCachePrecompileProgress
+{
+    /// The total number of shaders that are being precompiled.
+    Uint32 NumShaders DEFAULT_INITIALIZER(0);
+
+    /// The number of shaders that have been processed.
+    Uint32 NumShadersProcessed DEFAULT_INITIALIZER(0);
+
+    /// The total number of pipeline states that are being precompiled.
+    Uint32 NumPipelines DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline states that have been processed.
+
+    /// \note  Pipelines are unpacked in batches, so this value is
+    ///         updated in steps. Pipelines that were unpacked may
+    ///         still be compiling asynchronously.
+    Uint32 NumPipelinesProcessed DEFAULT_INITIALIZER(0);
+};
+typedef struct RenderStateCachePrecompileProgress RenderStateCachePrecompileProgress;
+
 #include "../../../Primitives/interface/DefineRefMacro.h"
 
 /// Type of the callback function called by the IRenderStateCache::Reload method.
@@ -179,6 +221,13 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     /// to the pCacheData data blob. It will be kept alive until the cache object
     /// is released or the Reset() method is called.
     ///
+    /// The cache data is a journal of segments written by WriteToBlob() (the entire
+    /// cache contents) and WriteDeltaToBlob() (render states added since the last write).
+    /// All segments are merged into a single archive. If the journal ends with a truncated
+    /// or damaged segment (e.g. because the application was terminated while writing it),
+    /// the segment and all data after it are ignored. Use NeedsCompaction() to check if the
+    /// data should be rewritten with WriteToBlob().
+    ///
     /// \warning    If the data were loaded without making a copy, the application
     ///             must not modify it while it is in use by the cache object.
     /// 
@@ -207,6 +256,10 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     ///                                pipeline state object will be written.
     ///
     /// \return     true if the pipeline state was loaded from the cache, and false otherwise.
+    ///
+    /// \remarks    If the shaders are still being compiled, the method returns an asynchronous pipeline
+    ///             that implements Diligent::IAsyncPipelineState. The interface can be used to set
+    ///             a fallback pipeline that is used until the pipeline is ready.
     VIRTUAL bool METHOD(CreateGraphicsPipelineState)(THIS_
                                                      const GraphicsPipelineStateCreateInfo REF PSOCreateInfo,
                                                      IPipelineState**                          ppPipelineState) PURE;
@@ -271,6 +324,45 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
                                        Uint32       ContentVersion, 
                                        IFileStream* pStream) PURE;
 
+    /// Writes render states that were added to the cache since the last write to a memory blob.
+
+    /// \param [in]   ContentVersion - The version of the content to write.
+    /// \param [out]  ppBlob         - Address of the memory location where a pointer to the created
+    ///                                data blob will be written. If there are no new render states,
+    ///                                null will be written.
+    ///
+    /// \return     true if the data was written successfully, and false otherwise.
+    ///
+    /// The data is a journal segment that should be appended to the data previously written by
+    /// WriteToBlob(), WriteToStream(), WriteDeltaToBlob() or WriteDeltaToStream(). Writing the delta
+    /// is proportional to the size of the new render states rather than the size of the entire cache,
+    /// so it can be used to save the cache periodically.
+    ///
+    /// \remarks    If ContentVersion is `~0u` (aka `0xFFFFFFFF`), the version of the
+    ///             previously loaded content will be used, or 0 if none was loaded.
+    VIRTUAL Bool METHOD(WriteDeltaToBlob)(THIS_
+                                          Uint32      ContentVersion, 
+                                          IDataBlob** ppBlob) PURE;
+
+    /// Appends render states that were added to the cache since the last write to a file stream.
+
+    /// \param [in]  ContentVersion - The version of the content to write.
+    /// \param [in]  pStream        - Pointer to the IFileStream interface to use for writing.
+    ///
+    /// \return     true if the data was written successfully, and false otherwise.
+    ///
+    /// See WriteDeltaToBlob() for details.
+    VIRTUAL Bool METHOD(WriteDeltaToStream)(THIS_
+                                            Uint32       ContentVersion, 
+                                            IFileStream* pStream) PURE;
+
+    /// Returns true if the data loaded by Load() should be compacted.
+
+    /// The data should be compacted by rewriting it with WriteToBlob() or WriteToStream()
+    /// if it consists of more than one journal segment, ends with a damaged segment,
+    /// or was written by an older version of the engine.
+    VIRTUAL Bool METHOD(NeedsCompaction)(THIS) CONST PURE;
+
 
     /// Resets the cache to default state.
     VIRTUAL void METHOD(Reset)(THIS) PURE;
@@ -286,6 +378,13 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     ///
     /// Reloading is only enabled if the cache was created with the `EnableHotReload` member of
     /// `Diligent::RenderStateCacheCreateInfo` struct set to true.
+    ///
+    /// The cache tracks the source files, including all include files, every shader was created from.
+    /// Only the shaders whose source files have changed since the last reload are recompiled, and only
+    /// the pipelines that use these shaders are re-created. Shaders and pipelines are reloaded in parallel
+    /// using the device's shader compilation thread pool, if there is one.
+    /// If ReloadGraphicsPipeline is not null, all graphics pipelines are re-created, and the callback
+    /// is always called from the thread that calls Reload().
     VIRTUAL Uint32 METHOD(Reload)(THIS_
                                   ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline DEFAULT_VALUE(nullptr), 
                                   void*                              pUserData              DEFAULT_VALUE(nullptr)) PURE;
@@ -300,6 +399,66 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
 
     /// The reload version is incremented every time the cache is reloaded.
     VIRTUAL Uint32 METHOD(GetReloadVersion)(THIS) CONST PURE;
+
+    /// Creates pipeline states stored in the loaded cache data ahead of time.
+
+    /// \param [out] ppTask - Optional address of the memory location where a pointer to the
+    ///                       task that creates the pipelines will be written.
+    ///                       If the pipelines are created before the method returns,
+    ///                       null will be written.
+    ///
+    /// \return     The number of pipeline states that will be created.
+    ///
+    /// The method creates all pipeline states from the data loaded by the Load() method that
+    /// have not been created yet. If the device has a shader compilation thread pool
+    /// (see IRenderDevice::GetShaderCompilationThreadPool()), the pipelines are unpacked by a
+    /// low-priority task in this pool and are compiled asynchronously. Otherwise, the pipelines
+    /// are created by the calling thread.
+    ///
+    /// The cache keeps strong references to the created pipelines until the Reset()
+    /// method is called, so that Create*PipelineState() methods called with the
+    /// matching create info return the existing objects without unpacking them again.
+    ///
+    /// \note       This method is not thread-safe and must not be called simultaneously
+    ///             with Load() or Reset().
+    VIRTUAL Uint32 METHOD(Prewarm)(THIS_
+                                   IAsyncTask** ppTask DEFAULT_VALUE(nullptr)) PURE;
+
+    /// Creates shaders and pipeline states stored in the loaded cache data in the background.
+
+    /// \param [in]  pThreadPool - Thread pool to run the precompilation task in.
+    ///                            If null, the device's shader compilation thread pool is used
+    ///                            (see IRenderDevice::GetShaderCompilationThreadPool()).
+    ///                            If the device does not have the pool either, the objects
+    ///                            are created by the calling thread.
+    /// \param [in]  Priority    - Priority of the precompilation task in the thread pool.
+    ///                            Use negative values to let the application's own shaders and
+    ///                            pipelines be compiled first.
+    /// \param [out] ppTask      - Optional address of the memory location where a pointer to the
+    ///                            precompilation task will be written. If the objects are created
+    ///                            before the method returns, null will be written.
+    ///
+    /// \return     The total number of shaders and pipeline states that will be created.
+    ///
+    /// Unlike Prewarm(), this method also creates all standalone shaders in the cache data,
+    /// so that CreateShader() calls with the matching create info do not need to unpack them.
+    /// The cache keeps strong references to the created objects until Reset() is called.
+    /// Use GetPrecompileProgress() to query the progress of the operation.
+    ///
+    /// \note       This method is not thread-safe and must not be called simultaneously
+    ///             with Load(), Prewarm() or Reset().
+    VIRTUAL Uint32 METHOD(Precompile)(THIS_
+                                      IThreadPool* pThreadPool DEFAULT_VALUE(nullptr),
+                                      Float32      Priority    DEFAULT_VALUE(-1.f),
+                                      IAsyncTask** ppTask      DEFAULT_VALUE(nullptr)) PURE;
+
+    /// Returns the progress of the last Precompile() or Prewarm() operation.
+
+    /// \param [out] Progress - Precompilation progress, see Diligent::RenderStateCachePrecompileProgress.
+    ///
+    /// \remarks    This method is thread-safe and may be called while the operation is running.
+    VIRTUAL void METHOD(GetPrecompileProgress)(THIS_
+                                               RenderStateCachePrecompileProgress REF Progress) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -316,10 +475,97 @@ DILIGENT_END_INTERFACE
 #    define IRenderStateCache_CreateTilePipelineState(This, ...)       CALL_IFACE_METHOD(RenderStateCache, CreateTilePipelineState,      This, __VA_ARGS__)
 #    define IRenderStateCache_WriteToBlob(This, ...)                   CALL_IFACE_METHOD(RenderStateCache, WriteToBlob,                  This, __VA_ARGS__)
 #    define IRenderStateCache_WriteToStream(This, ...)                 CALL_IFACE_METHOD(RenderStateCache, WriteToStream,                This, __VA_ARGS__)
+#    define IRenderStateCache_WriteDeltaToBlob(This, ...)              CALL_IFACE_METHOD(RenderStateCache, WriteDeltaToBlob,             This, __VA_ARGS__)
+#    define IRenderStateCache_WriteDeltaToStream(This, ...)            CALL_IFACE_METHOD(RenderStateCache, WriteDeltaToStream,           This, __VA_ARGS__)
+#    define IRenderStateCache_NeedsCompaction(This)                    CALL_IFACE_METHOD(RenderStateCache, NeedsCompaction,              This)
 #    define IRenderStateCache_Reset(This)                              CALL_IFACE_METHOD(RenderStateCache, Reset,                        This)
 #    define IRenderStateCache_Reload(This, ...)                        CALL_IFACE_METHOD(RenderStateCache, Reload,                       This, __VA_ARGS__)
 #    define IRenderStateCache_GetContentVersion(This)                  CALL_IFACE_METHOD(RenderStateCache, GetContentVersion,            This)
 #    define IRenderStateCache_GetReloadVersion(This)                   CALL_IFACE_METHOD(RenderStateCache, GetReloadVersion,             This)
+#    define IRenderStateCache_Prewarm(This, ...)                       CALL_IFACE_METHOD(RenderStateCache, Prewarm,                      This, __VA_ARGS__)
+#    define IRenderStateCache_Precompile(This, ...)                    CALL_IFACE_METHOD(RenderStateCache, Precompile,                   This, __VA_ARGS__)
+#    define IRenderStateCache_GetPrecompileProgress(This, ...)         CALL_IFACE_METHOD(RenderStateCache, GetPrecompileProgress,        This, __VA_ARGS__)
+// clang-format on
+
+#endif
+
+
+/// Type of the callback function called when the status of an asynchronous pipeline changes.
+
+/// \param [in] pPipeline - Asynchronous pipeline state whose status has changed.
+/// \param [in] Status    - New pipeline status: Diligent::PIPELINE_STATE_STATUS_READY or
+///                         Diligent::PIPELINE_STATE_STATUS_FAILED.
+/// \param [in] pUserData - User data passed to IAsyncPipelineState::SetStatusCallback().
+typedef void(DILIGENT_CALL_TYPE* AsyncPipelineStatusCallbackType)(IPipelineState* pPipeline, PIPELINE_STATE_STATUS Status, void* pUserData);
+
+// {3E4A1C5D-8F7B-4D62-9A0E-6B1F2C3D4E5F}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_AsyncPipelineState =
+    {0x3e4a1c5d, 0x8f7b, 0x4d62, {0x9a, 0xe, 0x6b, 0x1f, 0x2c, 0x3d, 0x4e, 0x5f}};
+
+#define DILIGENT_INTERFACE_NAME IAsyncPipelineState
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IAsyncPipelineStateInclusiveMethods \
+    IPipelineStateInclusiveMethods;         \
+    IAsyncPipelineStateMethods AsyncPipelineState
+
+// clang-format off
+
+/// Asynchronous pipeline state created by the render state cache while its shaders are compiling.
+
+/// Query this interface from the pipeline returned by the render state cache to make it
+/// usable before it is ready:
+///
+///     RefCntAutoPtr<IAsyncPipelineState> pAsyncPSO{pPSO, IID_AsyncPipelineState};
+///     if (pAsyncPSO)
+///         pAsyncPSO->SetFallback(pUberShaderPSO);
+///
+/// While the pipeline is compiling, IDeviceContext::SetPipelineState() binds the fallback
+/// pipeline instead, so that draw calls do not have to be skipped. The pipeline switches
+/// to the actual pipeline as soon as it is ready.
+DILIGENT_BEGIN_INTERFACE(IAsyncPipelineState, IPipelineState)
+{
+    /// Sets the pipeline that is used while this pipeline is compiling.
+
+    /// \param [in] pFallback - Fallback pipeline state, or null to remove the fallback.
+    ///                         The pipeline must be ready and compatible with this pipeline,
+    ///                         i.e. the shader resource bindings created by this pipeline must be usable
+    ///                         with the fallback (see IPipelineState::IsCompatibleWith()).
+    ///
+    /// \remarks    If the pipeline fails to compile, the fallback pipeline continues to be used.
+    VIRTUAL void METHOD(SetFallback)(THIS_
+                                     IPipelineState* pFallback) PURE;
+
+    /// Returns the fallback pipeline state, or null if it is not set.
+
+    /// The method does *NOT* increment the reference counter of the returned object,
+    /// so Release() must not be called.
+    VIRTUAL IPipelineState* METHOD(GetFallback)(THIS) CONST PURE;
+
+    /// Returns true if the fallback pipeline is used in place of this pipeline.
+    VIRTUAL bool METHOD(IsUsingFallback)(THIS) CONST PURE;
+
+    /// Sets the callback that is called once when the pipeline becomes ready or fails to compile.
+
+    /// The callback is called from the thread that checks the pipeline status,
+    /// i.e. calls IPipelineState::GetStatus() or IDeviceContext::SetPipelineState().
+    VIRTUAL void METHOD(SetStatusCallback)(THIS_
+                                           AsyncPipelineStatusCallbackType Callback,
+                                           void*                           pUserData) PURE;
+};
+DILIGENT_END_INTERFACE
+
+// clang-format on
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+#    define IAsyncPipelineState_SetFallback(This, ...)       CALL_IFACE_METHOD(AsyncPipelineState, SetFallback,       This, __VA_ARGS__)
+#    define IAsyncPipelineState_GetFallback(This)            CALL_IFACE_METHOD(AsyncPipelineState, GetFallback,       This)
+#    define IAsyncPipelineState_IsUsingFallback(This)        CALL_IFACE_METHOD(AsyncPipelineState, IsUsingFallback,   This)
+#    define IAsyncPipelineState_SetStatusCallback(This, ...) CALL_IFACE_METHOD(AsyncPipelineState, SetStatusCallback, This, __VA_ARGS__)
 // clang-format on
 
 #endif
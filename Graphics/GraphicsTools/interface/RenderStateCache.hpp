@@ -190,6 +190,13 @@ public:
             LOG_ERROR_MESSAGE("Failed to load render state cache data from file ", FilePath);
             return;
         }
+
+        // Merge the journal segments appended by AppendCache() into a single one
+        if (UpdateOnExit && m_pCache->NeedsCompaction())
+        {
+            CacheDataFile.Close();
+            SaveCache(FilePath);
+        }
     }
 
     void SaveCache(const char* FilePath = nullptr)
@@ -220,6 +227,35 @@ public:
         }
     }
 
+    // Appends render states added since the last save to the cache file.
+    // This is much faster than SaveCache() for large caches and may be called periodically.
+    void AppendCache(const char* FilePath = nullptr)
+    {
+        if (m_pCache == nullptr)
+            return;
+
+        if (FilePath == nullptr)
+            FilePath = m_CacheFilePath.c_str();
+
+        if (FilePath[0] == '\0')
+            return;
+
+        RefCntAutoPtr<IDataBlob> pDeltaData;
+        if (m_pCache->WriteDeltaToBlob(m_CacheContentVersion, &pDeltaData))
+        {
+            if (pDeltaData)
+            {
+                FileWrapper CacheDataFile{FilePath, EFileAccessMode::Append};
+                if (CacheDataFile->Write(pDeltaData->GetConstDataPtr(), pDeltaData->GetSize()))
+                    LOG_INFO_MESSAGE("Successfully appended ", FormatMemorySize(pDeltaData->GetSize()), " to state cache file ", FilePath, ".");
+            }
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to write cache data.");
+        }
+    }
+
     void SetCacheFilePath(const char* FilePath)
     {
         if (FilePath == nullptr)
@@ -39,6 +39,9 @@
 namespace Diligent
 {
 
+/// Captures swap chain back buffers into staging textures that the application maps itself.
+
+/// \remarks   To read back buffers or textures and receive the data in a callback, use ReadbackQueue.
 class ScreenCapture
 {
 public:
@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ShaderResourceBindingPool class
+
+#include <vector>
+#include <mutex>
+
+#include "../../GraphicsEngine/interface/PipelineState.h"
+#include "../../GraphicsEngine/interface/PipelineResourceSignature.h"
+#include "../../GraphicsEngine/interface/ShaderResourceBinding.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Shader resource binding pool create information.
+struct ShaderResourceBindingPoolCreateInfo
+{
+    /// Resource signature to create SRBs for.
+
+    /// If null, the implicit signature of pPSO is used.
+    IPipelineResourceSignature* pSignature = nullptr;
+
+    /// Pipeline state that uses an implicit resource signature.
+
+    /// Ignored if pSignature is not null.
+    IPipelineState* pPSO = nullptr;
+
+    /// Whether to initialize static resources in the SRBs.
+
+    /// Static resources are copied when an SRB is created and are not
+    /// affected by recycling.
+    bool InitStaticResources = true;
+
+    /// The number of SRBs to create up front.
+    Uint32 InitialSize = 0;
+
+    /// The number of SRBs to create at once when the pool runs out of free SRBs.
+    Uint32 GrowSize = 16;
+};
+
+
+/// Shader resource binding pool.
+
+/// The pool creates SRBs in batches using IPipelineResourceSignature::CreateShaderResourceBindings()
+/// and keeps a reference to every SRB it has created. When the application releases all its
+/// references to an SRB, the pool recycles it: all mutable and dynamic variables are unbound
+/// and the SRB is handed out again by the next call to Acquire().
+///
+/// Typical usage:
+///
+///     ShaderResourceBindingPool SRBPool{{pSignature}};
+///     ...
+///     RefCntAutoPtr<IShaderResourceBinding> pSRB = SRBPool.Acquire();
+///     pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(pTextureSRV);
+///     ...
+///     pSRB.Release(); // The SRB will be reused by the pool
+///
+/// \remarks    The pool is thread-safe. An SRB must not be recycled while it is referenced by
+///             commands that have not been executed by the GPU yet. Resource state transitions and
+///             descriptor lifetimes are handled by the engine in the same way as for regular SRBs.
+class ShaderResourceBindingPool
+{
+public:
+    explicit ShaderResourceBindingPool(const ShaderResourceBindingPoolCreateInfo& CI);
+
+    // clang-format off
+    ShaderResourceBindingPool           (const ShaderResourceBindingPool&) = delete;
+    ShaderResourceBindingPool& operator=(const ShaderResourceBindingPool&) = delete;
+    ShaderResourceBindingPool           (ShaderResourceBindingPool&&)      = delete;
+    ShaderResourceBindingPool& operator=(ShaderResourceBindingPool&&)      = delete;
+    // clang-format on
+
+    /// Returns an SRB with all mutable and dynamic variables unbound.
+
+    /// A recycled SRB is returned if available. Otherwise, the pool creates GrowSize new SRBs.
+    RefCntAutoPtr<IShaderResourceBinding> Acquire();
+
+    /// Recycles all SRBs that are no longer referenced outside of the pool.
+    void Collect();
+
+    /// Returns the total number of SRBs created by the pool.
+    size_t GetSize() const;
+
+    /// Returns the number of SRBs that are ready to be handed out.
+    size_t GetNumFreeSRBs() const;
+
+    /// Returns the resource signature of the SRBs in the pool.
+    IPipelineResourceSignature* GetSignature() const { return m_pSignature; }
+
+private:
+    void Grow(Uint32 Count);
+    void ResetSRB(IShaderResourceBinding* pSRB) const;
+    void CollectUnsafe();
+
+private:
+    RefCntAutoPtr<IPipelineResourceSignature> m_pSignature;
+
+    const bool   m_InitStaticResources;
+    const Uint32 m_GrowSize;
+
+    // All shader stages that have resources in the signature
+    SHADER_TYPE m_ShaderStages = SHADER_TYPE_UNKNOWN;
+
+    mutable std::mutex m_Mtx;
+
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> m_UsedSRBs;
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> m_FreeSRBs;
+};
+
+} // namespace Diligent
@@ -0,0 +1,188 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ShadingRateGenerator class
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+/// Shading rate generator create information.
+struct ShadingRateGeneratorCreateInfo
+{
+    /// Shading rate tile size, in pixels.
+
+    /// If zero, 16 is used. The size is clamped to the range supported by the device,
+    /// see Diligent::ShadingRateProperties::MinTileSize and Diligent::ShadingRateProperties::MaxTileSize.
+    Uint32 TileSize = 0;
+
+    /// Whether the motion vectors are used to reduce the shading rate of moving tiles.
+    bool UseMotionVectors = true;
+};
+
+
+/// Shading rate generation attributes, see ShadingRateGenerator::Generate().
+struct ShadingRateGenerationAttribs
+{
+    /// Shader resource view of the previous frame's color, typically after tone mapping.
+
+    /// The texture size defines the framebuffer size for which the rates are generated.
+    ITextureView* pColorSRV = nullptr;
+
+    /// Shader resource view of the motion vectors. Required if ShadingRateGeneratorCreateInfo::UseMotionVectors is true.
+
+    /// The first two channels of the texture are multiplied by MotionVectorScale to get the motion in pixels.
+    ITextureView* pMotionVectorsSRV = nullptr;
+
+    /// Scale that converts the motion vectors to pixels.
+
+    /// For example, if the motion vectors are in the normalized device coordinates,
+    /// the scale is (0.5 * Width, -0.5 * Height).
+    float2 MotionVectorScale = float2{1, 1};
+
+    /// Relative luminance contrast threshold.
+
+    /// The shading rate along an axis is halved when the mean absolute luminance difference between
+    /// neighboring pixels along this axis is below the threshold multiplied by the mean luminance of the tile.
+    /// Larger values reduce the shading rate more aggressively.
+    float ContrastThreshold = 0.1f;
+
+    /// Motion sensitivity.
+
+    /// The contrast threshold is multiplied by (1 + MotionSensitivity * Motion), where Motion is
+    /// the maximum motion within the tile in pixels, since the motion blur and temporal
+    /// accumulation hide the detail of moving objects.
+    float MotionSensitivity = 0.1f;
+};
+
+
+/// Generates the shading rate for variable rate shading from the image content on the GPU.
+
+/// The generator estimates for every tile how much detail would be lost if the tile was shaded at
+/// half or quarter rate along each axis, using the luminance contrast of the previous frame's color
+/// and the motion vectors, and writes the rates in the format used by the device
+/// (see Diligent::ShadingRateProperties::Format):
+/// - Diligent::SHADING_RATE_FORMAT_PALETTE (Direct3D12 tier 2, Vulkan VK_KHR_fragment_shading_rate):
+///   R8_UINT texture of Diligent::SHADING_RATE values. Rates that the device does not support are
+///   replaced with the closest finer rates.
+/// - Diligent::SHADING_RATE_FORMAT_UNORM8 (Vulkan VK_EXT_fragment_density_map):
+///   RG8_UNORM texture with the fragment density along each axis (1, 0.5 or 0.25).
+/// - Diligent::SHADING_RATE_FORMAT_COL_ROW_FP32 (Metal rasterization rate maps): buffer of floats that
+///   contains the horizontal rate of every tile column followed by the vertical rate of every tile row.
+///   Every rate is the finest rate of the tiles in the column or row. Metal rasterization rate maps are
+///   immutable and are created on the CPU, so the application reads the buffer back and uses the rates in
+///   Diligent::RasterizationRateLayerDesc.
+///
+/// Typical usage:
+///
+///     ShadingRateGenerator Generator{pDevice};
+///     ...
+///     ShadingRateGenerationAttribs Attribs;
+///     Attribs.pColorSRV         = pPrevFrameColorSRV;
+///     Attribs.pMotionVectorsSRV = pMotionVectorsSRV;
+///     Generator.Generate(pCtx, Attribs);
+///     ...
+///     pCtx->SetShadingRate(SHADING_RATE_1X1, SHADING_RATE_COMBINER_PASSTHROUGH, SHADING_RATE_COMBINER_OVERRIDE);
+///     // Use Generator.GetShadingRateTexture()->GetDefaultView(TEXTURE_VIEW_SHADING_RATE) with SetRenderTargetsEx()
+///
+/// \remarks    The generator requires compute shaders and variable rate shading, and for texture-based formats,
+///             shading rate textures that can be written by compute shaders (Diligent::BIND_UNORDERED_ACCESS
+///             in Diligent::ShadingRateProperties::BindFlags). The generator is not thread-safe.
+class ShadingRateGenerator
+{
+public:
+    ShadingRateGenerator(IRenderDevice* pDevice, const ShadingRateGeneratorCreateInfo& CI = {});
+
+    // clang-format off
+    ShadingRateGenerator           (const ShadingRateGenerator&) = delete;
+    ShadingRateGenerator& operator=(const ShadingRateGenerator&) = delete;
+    ShadingRateGenerator           (ShadingRateGenerator&&)      = delete;
+    ShadingRateGenerator& operator=(ShadingRateGenerator&&)      = delete;
+    // clang-format on
+
+    ~ShadingRateGenerator();
+
+    /// Generates the shading rates.
+
+    /// \param [in] pCtx    - Device context to record the commands.
+    /// \param [in] Attribs - Generation attributes, see Diligent::ShadingRateGenerationAttribs.
+    /// \return     true if the commands were recorded, and false otherwise.
+    ///
+    /// The shading rate texture or buffer is (re)created when the color texture size changes.
+    bool Generate(IDeviceContext* pCtx, const ShadingRateGenerationAttribs& Attribs);
+
+    /// Returns the shading rate texture, or null if the device uses Diligent::SHADING_RATE_FORMAT_COL_ROW_FP32 format.
+    ITexture* GetShadingRateTexture() const { return m_pShadingRateTex; }
+
+    /// Returns the buffer with column and row rates, or null if the device uses a texture-based format.
+    IBuffer* GetColumnRowRatesBuffer() const { return m_pColumnRowRates; }
+
+    /// Returns the tile size, in pixels.
+    Uint32 GetTileSize() const { return m_TileSize; }
+
+    /// Returns the number of tile columns.
+    Uint32 GetNumTilesX() const { return m_NumTilesX; }
+
+    /// Returns the number of tile rows.
+    Uint32 GetNumTilesY() const { return m_NumTilesY; }
+
+    /// Returns true if the device supports the generator.
+    static bool IsDeviceSupported(IRenderDevice* pDevice);
+
+private:
+    void CreatePipelines();
+    void PrepareOutputs(Uint32 Width, Uint32 Height);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const SHADING_RATE_FORMAT m_Format;
+    const Uint32              m_TileSize;
+    const bool                m_UseMotionVectors;
+
+    Uint32 m_NumTilesX = 0;
+    Uint32 m_NumTilesY = 0;
+
+    RefCntAutoPtr<IPipelineState>         m_pTileRatesPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pTileRatesSRB;
+    RefCntAutoPtr<IPipelineState>         m_pColumnRowPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pColumnRowSRB;
+
+    RefCntAutoPtr<IBuffer>  m_pConstants;
+    RefCntAutoPtr<ITexture> m_pShadingRateTex;
+    RefCntAutoPtr<IBuffer>  m_pTileRates;
+    RefCntAutoPtr<IBuffer>  m_pColumnRowRates;
+};
+
+} // namespace Diligent
@@ -0,0 +1,302 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::SparseTextureStreamer class
+
+#include <vector>
+#include <mutex>
+#include <functional>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/DeviceMemory.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "TextureUploader.hpp"
+#include "ReadbackQueue.hpp"
+
+namespace Diligent
+{
+
+/// Sparse texture tile location.
+struct SparseTileLocation
+{
+    /// Mip level. Always less than SparseTextureProperties::FirstMipInTail.
+    Uint32 MipLevel = 0;
+
+    /// Array slice.
+    Uint32 ArraySlice = 0;
+
+    /// Tile column in the mip level.
+    Uint32 X = 0;
+
+    /// Tile row in the mip level.
+    Uint32 Y = 0;
+};
+
+
+/// Sparse texture streamer create information.
+struct SparseTextureStreamerCreateInfo
+{
+    /// Tile request callback type.
+    using TileRequestCallbackType = std::function<void(const SparseTileLocation& Tile)>;
+
+    /// Sparse texture to stream.
+
+    /// The texture must be a 2D or 2D array texture created with Diligent::USAGE_SPARSE.
+    /// The streamer binds the packed mip tail when it is created and keeps it resident.
+    /// The application uploads the mip tail data itself, for example with ITextureUploader::ScheduleGPUCopy().
+    ITexture* pTexture = nullptr;
+
+    /// Texture uploader that is used to upload the tile data.
+
+    /// The uploader must not use a separate copy context (see TextureUploaderDesc::pCopyContext)
+    /// since the copies must be executed after the memory is bound to the tiles.
+    ITextureUploader* pUploader = nullptr;
+
+    /// An optional immediate context that executes sparse binding commands.
+
+    /// If null, the context passed to SparseTextureStreamer::Update() is used, and it must support
+    /// sparse binding. Otherwise, the update context waits for the binding commands with a fence.
+    IDeviceContext* pBindContext = nullptr;
+
+    /// The maximum number of tiles that may be resident at the same time, excluding the mip tail.
+
+    /// This defines the size of the tile memory pool, which is allocated when the streamer is created.
+    Uint32 MaxResidentTiles = 1024;
+
+    /// The maximum number of tiles that Update() requests and makes resident in one call.
+    Uint32 MaxTilesPerUpdate = 64;
+
+    /// The number of frames in flight, see ReadbackQueueCreateInfo::NumFramesInFlight.
+    Uint32 NumFramesInFlight = 3;
+
+    /// Tile request callback.
+
+    /// The callback is called by Update() for every tile that was requested by the feedback
+    /// and is not resident. The application is expected to load the tile data, possibly
+    /// asynchronously, and pass it to SparseTextureStreamer::SubmitTileData().
+    /// A tile is not requested again until its data is submitted.
+    TileRequestCallbackType TileRequestCallback;
+};
+
+
+/// Sparse texture streamer.
+
+/// The streamer keeps a fixed-size pool of tile memory and binds it to the tiles of a sparse texture
+/// that are requested by the GPU feedback, which allows keeping textures much larger than the memory
+/// budget addressable.
+///
+/// Shaders request tiles by writing a non-zero value to the feedback buffer (see GetFeedbackBufferView())
+/// at the index returned by GetTileIndex() for the tile they sample. Every Update() call reads back the
+/// feedback asynchronously, clears it, requests the data of the non-resident tiles from the application
+/// (coarser mip levels first, including the parent tiles of every requested tile), binds the memory
+/// to the tiles whose data has been submitted and uploads the data through the texture uploader.
+/// When the pool is full, the least recently requested tiles are evicted.
+///
+/// Tile index layout: the tiles of all mip levels before the mip tail are arranged slice by slice, and within a
+/// slice, mip by mip in row-major order:
+///
+///     TileIndex = ArraySlice * NumTilesPerSlice + MipFirstTile[MipLevel] + Y * NumTilesX[MipLevel] + X
+///
+/// \remarks    Only Direct3D12 and Vulkan backends are supported.
+///             All methods except for SubmitTileData() must be called from the render thread.
+class SparseTextureStreamer
+{
+public:
+    /// Streamer statistics.
+    struct Statistics
+    {
+        /// The number of resident tiles, excluding the mip tail.
+        Uint32 NumResidentTiles = 0;
+
+        /// The number of tiles whose data has been requested, but not uploaded yet.
+        Uint32 NumPendingTiles = 0;
+
+        /// The total number of evicted tiles.
+        Uint64 NumEvictedTiles = 0;
+    };
+
+    SparseTextureStreamer(IRenderDevice* pDevice, const SparseTextureStreamerCreateInfo& CI);
+    ~SparseTextureStreamer();
+
+    // clang-format off
+    SparseTextureStreamer           (const SparseTextureStreamer&) = delete;
+    SparseTextureStreamer& operator=(const SparseTextureStreamer&) = delete;
+    SparseTextureStreamer           (SparseTextureStreamer&&)      = delete;
+    SparseTextureStreamer& operator=(SparseTextureStreamer&&)      = delete;
+    // clang-format on
+
+    /// Processes the feedback, requests tile data and makes the submitted tiles resident.
+
+    /// \param [in] pContext - Immediate device context.
+    ///
+    /// The method should be called once per frame after the passes that write the feedback.
+    void Update(IDeviceContext* pContext);
+
+    /// Submits the tile data requested by the tile request callback.
+
+    /// \param [in] Tile   - Tile location.
+    /// \param [in] pData  - Tile data. If null, the request is canceled, and the tile may be requested again.
+    /// \param [in] Stride - Row stride of the tile data, in bytes. For compressed formats, the stride
+    ///                      of one row of blocks.
+    ///
+    /// The method copies the data, and can be called from any thread.
+    /// The tile size is given by GetTileRegion().
+    void SubmitTileData(const SparseTileLocation& Tile, const void* pData, Uint64 Stride);
+
+    /// Returns the feedback buffer unordered access view.
+
+    /// The buffer contains one Uint32 element for every tile, see GetTileIndex().
+    IBufferView* GetFeedbackBufferView() const { return m_pFeedbackBufferUAV; }
+
+    /// Returns the feedback buffer.
+    IBuffer* GetFeedbackBuffer() const { return m_pFeedbackBuffer; }
+
+    /// Returns the index of the tile in the feedback buffer.
+    Uint32 GetTileIndex(const SparseTileLocation& Tile) const;
+
+    /// Returns the total number of tiles, excluding the mip tail.
+    Uint32 GetNumTiles() const { return static_cast<Uint32>(m_Tiles.size()); }
+
+    /// Returns the tile region in the mip level, in pixels.
+    Box GetTileRegion(const SparseTileLocation& Tile) const;
+
+    /// Returns true if the tile is resident and its data has been uploaded.
+    bool IsTileResident(const SparseTileLocation& Tile) const;
+
+    /// Returns the streamer statistics.
+    Statistics GetStatistics() const;
+
+private:
+    enum class TileState : Uint8
+    {
+        NonResident,
+
+        // The tile has been requested by the feedback, but the request has not been passed to the application yet
+        Requested,
+
+        // Waiting for the tile data
+        Pending,
+
+        Resident
+    };
+
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    struct TileInfo
+    {
+        TileState State = TileState::NonResident;
+
+        // The frame when the tile was last requested by the feedback
+        Uint64 LastRequestFrame = 0;
+
+        // Memory slot of the resident tile
+        Uint32 Slot = InvalidIndex;
+
+        // Resident tiles in the least recently requested order
+        Uint32 LRUPrev = InvalidIndex;
+        Uint32 LRUNext = InvalidIndex;
+    };
+
+    struct MipTiles
+    {
+        Uint32 FirstTile = 0;
+        Uint32 NumTilesX = 0;
+        Uint32 NumTilesY = 0;
+    };
+
+    struct SubmittedTile
+    {
+        Uint32             TileIndex = 0;
+        std::vector<Uint8> Data;
+    };
+
+    SparseTileLocation GetTileLocation(Uint32 TileIndex) const;
+    void               GetTileDataLayout(const SparseTileLocation& Tile, Uint64& RowSize, Uint32& NumRows) const;
+
+    void   ProcessFeedback(const Uint32* pFeedback, size_t NumElements, Uint64 FeedbackFrame);
+    void   RequestTile(Uint32 TileIndex, Uint64 FeedbackFrame);
+    void   RequestTileData();
+    void   UploadSubmittedTiles(IDeviceContext* pContext);
+    Uint32 AllocateSlot(std::vector<SparseTextureMemoryBindRange>& Ranges);
+
+    void LRUPushFront(Uint32 TileIndex);
+    void LRURemove(Uint32 TileIndex);
+
+    void BindMipTail(IDeviceContext* pContext);
+    void BindMemory(IDeviceContext* pContext, const std::vector<SparseTextureMemoryBindRange>& Ranges);
+
+private:
+    RefCntAutoPtr<IRenderDevice>    m_pDevice;
+    RefCntAutoPtr<ITexture>         m_pTexture;
+    RefCntAutoPtr<ITextureUploader> m_pUploader;
+    RefCntAutoPtr<IDeviceContext>   m_pBindContext;
+
+    const Uint32 m_MaxResidentTiles;
+    const Uint32 m_MaxTilesPerUpdate;
+
+    SparseTextureStreamerCreateInfo::TileRequestCallbackType m_TileRequestCallback;
+
+    SparseTextureProperties m_SparseProps;
+
+    std::vector<MipTiles> m_MipTiles;
+    Uint32                m_NumTilesPerSlice = 0;
+    std::vector<TileInfo> m_Tiles;
+
+    RefCntAutoPtr<IBuffer>     m_pFeedbackBuffer;
+    RefCntAutoPtr<IBufferView> m_pFeedbackBufferUAV;
+    std::vector<Uint32>        m_ZeroFeedback;
+    ReadbackQueue              m_FeedbackReadbacks;
+
+    RefCntAutoPtr<IDeviceMemory> m_pTileMemory;
+    RefCntAutoPtr<IDeviceMemory> m_pMipTailMemory;
+    std::vector<Uint32>          m_FreeSlots;
+    bool                         m_MipTailBound = false;
+
+    RefCntAutoPtr<IFence> m_pBindFence;
+    Uint64                m_NextBindFenceValue = 1;
+
+    // Tiles requested by the feedback that have not been passed to the callback yet
+    std::vector<Uint32> m_RequestedTiles;
+
+    std::mutex                 m_SubmittedTilesMtx;
+    std::vector<SubmittedTile> m_SubmittedTiles;
+
+    // Frame 0 means that the tile has never been requested
+    Uint64 m_FrameIndex        = 1;
+    Uint64 m_LastFeedbackFrame = 0;
+    Uint32 m_LRUHead           = InvalidIndex;
+    Uint32 m_LRUTail           = InvalidIndex;
+    Uint32 m_NumResidentTiles  = 0;
+    Uint32 m_NumPendingTiles   = 0;
+    Uint64 m_NumEvictedTiles   = 0;
+};
+
+} // namespace Diligent
@@ -30,11 +30,14 @@
 #include <functional>
 #include <vector>
 #include <string>
+#include <atomic>
+#include <memory>
 
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
 #include "../../GraphicsEngine/interface/Buffer.h"
 #include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/Align.hpp"
 #include "MapHelper.hpp"
 
 namespace Diligent
@@ -52,6 +55,8 @@ struct StreamingBufferCreateInfo
 class StreamingBuffer
 {
 public:
+    static constexpr Uint32 InvalidOffset = ~0u;
+
     StreamingBuffer() noexcept
     {}
 
@@ -156,6 +161,8 @@ public:
 
     void Flush(size_t CtxNum = 0)
     {
+        VERIFY(!m_MapInfo[CtxNum].m_MultiProducer || !m_MapInfo[CtxNum].m_MultiProducer->Active,
+               "Flushing the buffer while multi-producer mode is active. Call EndMultiProducer() first.");
         m_MapInfo[CtxNum].m_MappedData.Unmap();
         m_MapInfo[CtxNum].m_CurrOffset = 0;
     }
@@ -166,6 +173,151 @@ public:
             Flush(ctx);
     }
 
+    /// Maps a chunk of ChunkSize bytes that multiple threads can then fill in parallel
+    /// using StreamingBuffer::Producer objects or AllocateMultiProducer().
+    /// The chunk stays mapped until EndMultiProducer() is called by the owning context.
+    ///
+    /// \return Offset of the chunk in the buffer.
+    Uint32 BeginMultiProducer(IDeviceContext* pCtx, IRenderDevice* pDevice, Uint32 ChunkSize, size_t CtxNum = 0)
+    {
+        auto& MapInfo = m_MapInfo[CtxNum];
+        if (!MapInfo.m_MultiProducer)
+            MapInfo.m_MultiProducer = std::make_unique<MultiProducerState>();
+
+        auto& State = *MapInfo.m_MultiProducer;
+        VERIFY(!State.Active, "Multi-producer mode is already active");
+
+        const auto ChunkOffset = Map(pCtx, pDevice, ChunkSize, CtxNum);
+
+        State.pData       = static_cast<Uint8*>(GetMappedCPUAddress(CtxNum));
+        State.ChunkOffset = ChunkOffset;
+        State.ChunkEnd    = ChunkOffset + ChunkSize;
+        State.CurrOffset.store(ChunkOffset, std::memory_order_relaxed);
+        State.Active = true;
+        ++State.Generation;
+
+        return ChunkOffset;
+    }
+
+    struct MultiProducerAllocation
+    {
+        /// Offset of the allocated range in the buffer, or InvalidOffset if the allocation failed.
+        Uint32 Offset = InvalidOffset;
+
+        /// CPU address of the allocated range.
+        void* pData = nullptr;
+
+        explicit operator bool() const { return Offset != InvalidOffset; }
+    };
+
+    /// Atomically reserves Size bytes in the current multi-producer chunk.
+    /// This method is thread-safe. Every call touches the shared offset, so threads that
+    /// make many small allocations should use StreamingBuffer::Producer instead.
+    ///
+    /// \return Allocation that is empty if the chunk is exhausted.
+    MultiProducerAllocation AllocateMultiProducer(Uint32 Size, Uint32 Alignment = 1, size_t CtxNum = 0)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of two");
+
+        auto& State = *m_MapInfo[CtxNum].m_MultiProducer;
+        VERIFY(State.Active, "Multi-producer mode is not active");
+
+        // Lock-free reservation: retry until no other thread moves the offset in between.
+        auto Offset = State.CurrOffset.load(std::memory_order_relaxed);
+        Uint32 AlignedOffset;
+        do
+        {
+            AlignedOffset = AlignUp(Offset, Alignment);
+            if (AlignedOffset >= State.ChunkEnd || State.ChunkEnd - AlignedOffset < Size)
+                return {};
+        } while (!State.CurrOffset.compare_exchange_weak(Offset, AlignedOffset + Size, std::memory_order_relaxed));
+
+        return {AlignedOffset, State.pData + AlignedOffset};
+    }
+
+    /// Finishes the multi-producer mode and unmaps the buffer.
+    /// All producers must have finished writing before this method is called.
+    /// The unused part of the chunk is returned to the buffer.
+    ///
+    /// \return The number of bytes used in the chunk.
+    Uint32 EndMultiProducer(size_t CtxNum = 0)
+    {
+        auto& MapInfo = m_MapInfo[CtxNum];
+        VERIFY(MapInfo.m_MultiProducer && MapInfo.m_MultiProducer->Active, "Multi-producer mode is not active");
+        auto& State = *MapInfo.m_MultiProducer;
+
+        const auto EndOffset = std::min(State.CurrOffset.load(std::memory_order_relaxed), State.ChunkEnd);
+        VERIFY_EXPR(MapInfo.m_CurrOffset == State.ChunkEnd);
+        MapInfo.m_CurrOffset = EndOffset;
+
+        State.Active = false;
+        State.pData  = nullptr;
+        Unmap(CtxNum);
+
+        return EndOffset - State.ChunkOffset;
+    }
+
+    /// Per-thread allocator that reserves sub-chunks of the multi-producer chunk through
+    /// the shared atomic offset and suballocates from them without synchronization.
+    ///
+    /// A producer must only be used by one thread at a time. It may be reused in the
+    /// subsequent multi-producer sessions: the stale sub-chunk is discarded automatically.
+    class Producer
+    {
+    public:
+        Producer(StreamingBuffer& Buffer, Uint32 SubChunkSize, size_t CtxNum = 0) noexcept :
+            m_pBuffer{&Buffer},
+            m_CtxNum{CtxNum},
+            m_SubChunkSize{SubChunkSize}
+        {}
+
+        /// Allocates Size bytes. Returns an empty allocation if the chunk is exhausted.
+        MultiProducerAllocation Allocate(Uint32 Size, Uint32 Alignment = 1)
+        {
+            VERIFY_EXPR(Size > 0);
+            VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of two");
+
+            const auto& State = *m_pBuffer->m_MapInfo[m_CtxNum].m_MultiProducer;
+            if (m_Generation != State.Generation)
+            {
+                m_Generation = State.Generation;
+                m_CurrOffset = 0;
+                m_EndOffset  = 0;
+            }
+
+            auto AlignedOffset = AlignUp(m_CurrOffset, Alignment);
+            if (AlignedOffset > m_EndOffset || m_EndOffset - AlignedOffset < Size)
+            {
+                // The rest of the current sub-chunk is wasted
+                auto SubChunk = m_pBuffer->AllocateMultiProducer(std::max(m_SubChunkSize, Size), Alignment, m_CtxNum);
+                if (!SubChunk)
+                {
+                    // Try to fit the allocation in the remaining part of the chunk
+                    SubChunk = m_pBuffer->AllocateMultiProducer(Size, Alignment, m_CtxNum);
+                    if (!SubChunk)
+                        return {};
+                    return SubChunk;
+                }
+                m_CurrOffset  = SubChunk.Offset;
+                m_EndOffset   = SubChunk.Offset + std::max(m_SubChunkSize, Size);
+                AlignedOffset = m_CurrOffset;
+            }
+
+            m_CurrOffset = AlignedOffset + Size;
+            return {AlignedOffset, State.pData + AlignedOffset};
+        }
+
+    private:
+        StreamingBuffer* const m_pBuffer;
+        const size_t           m_CtxNum;
+        const Uint32           m_SubChunkSize;
+
+        Uint32 m_Generation = 0;
+        Uint32 m_CurrOffset = 0;
+        Uint32 m_EndOffset  = 0;
+    };
+
     IBuffer* GetBuffer() const { return m_pBuffer; }
 
     void* GetMappedCPUAddress(size_t CtxNum = 0)
@@ -182,10 +334,23 @@ private:
 
     std::function<void(IBuffer*)> m_OnBufferResizeCallback;
 
+    struct MultiProducerState
+    {
+        Uint8*              pData       = nullptr;
+        Uint32              ChunkOffset = 0;
+        Uint32              ChunkEnd    = 0;
+        std::atomic<Uint32> CurrOffset{0};
+        Uint32              Generation = 0;
+        bool                Active     = false;
+    };
+
     struct MapInfo
     {
         MapHelper<Uint8> m_MappedData;
         Uint32           m_CurrOffset = 0;
+
+        // Allocated on first use to keep the class movable
+        std::unique_ptr<MultiProducerState> m_MultiProducer;
     };
     // We need to keep track of mapped data for every context
     std::vector<MapInfo> m_MapInfo;
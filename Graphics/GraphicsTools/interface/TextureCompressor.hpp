@@ -0,0 +1,171 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::TextureCompressor class
+
+#include <array>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Texture compression attributes, see TextureCompressor::Compress().
+struct TextureCompressAttribs
+{
+    /// Shader resource view of the source texture.
+
+    /// The view's most detailed mip level is compressed. If the destination format
+    /// is an sRGB format, the view must return linear values, which the encoder converts to sRGB.
+    ITextureView* pSrcSRV = nullptr;
+
+    /// Destination compressed texture.
+
+    /// The texture must be created with Diligent::USAGE_DEFAULT, and its format must be
+    /// supported by the compressor, see TextureCompressor::IsFormatSupported().
+    ITexture* pDstTexture = nullptr;
+
+    /// Destination mip level.
+    Uint32 DstMipLevel = 0;
+
+    /// Destination array slice.
+    Uint32 DstSlice = 0;
+
+    /// Destination region X offset. Must be a multiple of 4.
+    Uint32 DstX = 0;
+
+    /// Destination region Y offset. Must be a multiple of 4.
+    Uint32 DstY = 0;
+
+    /// Source region X offset, in texels of the source view's most detailed mip level.
+    Uint32 SrcX = 0;
+
+    /// Source region Y offset, in texels of the source view's most detailed mip level.
+    Uint32 SrcY = 0;
+
+    /// Region width. If zero, the region extends to the edge of the destination mip level.
+
+    /// The width must be a multiple of 4 unless the region extends to the edge of the mip level.
+    Uint32 Width = 0;
+
+    /// Region height. If zero, the region extends to the edge of the destination mip level.
+
+    /// The height must be a multiple of 4 unless the region extends to the edge of the mip level.
+    Uint32 Height = 0;
+
+    /// Destination texture state transition mode.
+    RESOURCE_STATE_TRANSITION_MODE DstTextureTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+};
+
+
+/// Compresses textures into BC1, BC3, BC4, BC5 and BC7 formats on the GPU.
+
+/// Every thread of the compute shader encodes one 4x4 block and writes it into a structured buffer,
+/// which is then copied into the compressed texture with IDeviceContext::UpdateTexture().
+/// This makes it practical to compress textures generated at run time, such as baked lightmaps,
+/// virtual texture pages or procedural terrain, and cuts their memory footprint and sampling
+/// bandwidth by 4-8x compared to RGBA8 and RGBA16F.
+///
+/// The encoder favors speed over quality:
+/// - BC1 and the color part of BC3 use the principal axis of the block colors as the endpoint
+///   line and always use the four-color mode, so BC1 alpha is ignored.
+/// - BC4, BC5 and the alpha part of BC3 use the block range as the endpoints and the eight-value mode.
+/// - BC7 only uses mode 6 (one subset, RGBA endpoints with p-bits and 4-bit indices).
+///
+/// Typical usage:
+///
+///     TextureCompressor Compressor{pDevice};
+///     ...
+///     TextureCompressAttribs Attribs;
+///     Attribs.pSrcSRV     = pLightmap->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+///     Attribs.pDstTexture = pCompressedLightmap;
+///     Compressor.Compress(pCtx, Attribs);
+///
+/// \remarks    The compressor requires compute shaders and copies from buffers to textures,
+///             which are supported by Direct3D12, Vulkan, OpenGL and WebGPU backends, but not by Direct3D11.
+///             The compressor is not thread-safe.
+class TextureCompressor
+{
+public:
+    TextureCompressor(IRenderDevice* pDevice);
+
+    // clang-format off
+    TextureCompressor           (const TextureCompressor&) = delete;
+    TextureCompressor& operator=(const TextureCompressor&) = delete;
+    TextureCompressor           (TextureCompressor&&)      = delete;
+    TextureCompressor& operator=(TextureCompressor&&)      = delete;
+    // clang-format on
+
+    ~TextureCompressor();
+
+    /// Compresses the source texture region into the destination texture.
+
+    /// \param [in] pCtx    - Device context to record the commands.
+    /// \param [in] Attribs - Compression attributes, see Diligent::TextureCompressAttribs.
+    /// \return     true if the compression commands were recorded, and false otherwise.
+    ///
+    /// The source texture is transitioned to Diligent::RESOURCE_STATE_SHADER_RESOURCE state.
+    bool Compress(IDeviceContext* pCtx, const TextureCompressAttribs& Attribs);
+
+    /// Returns true if the device supports the compressor.
+    static bool IsDeviceSupported(IRenderDevice* pDevice);
+
+    /// Returns true if the compressor can encode the format.
+
+    /// Supported formats are BC1_UNORM, BC1_UNORM_SRGB, BC3_UNORM, BC3_UNORM_SRGB, BC4_UNORM,
+    /// BC5_UNORM, BC7_UNORM and BC7_UNORM_SRGB.
+    static bool IsFormatSupported(TEXTURE_FORMAT Format);
+
+private:
+    struct EncoderPipeline
+    {
+        RefCntAutoPtr<IPipelineState>         pPSO;
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    };
+    EncoderPipeline* GetPipeline(TEXTURE_FORMAT Format);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    // Row stride alignment required by the buffer-to-texture copy
+    const Uint32 m_RowStrideAlignment;
+
+    // One pipeline per encoder and sRGB conversion mode, created on first use
+    std::array<EncoderPipeline, 8> m_Pipelines;
+
+    RefCntAutoPtr<IBuffer> m_pConstants;
+
+    // Block buffers with 8-byte and 16-byte elements
+    std::array<RefCntAutoPtr<IBuffer>, 2> m_pBlockBuffers;
+};
+
+} // namespace Diligent
@@ -27,12 +27,16 @@
 
 #pragma once
 
+#include <functional>
+
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
 
 namespace Diligent
 {
 
+class AsyncFile;
+
 // clang-format off
 
 /// Upload buffer description
@@ -61,18 +65,115 @@ public:
     virtual void                     WaitForCopyScheduled()                  = 0;
     virtual MappedTextureSubresource GetMappedData(Uint32 Mip, Uint32 Slice) = 0;
     virtual const UploadBufferDesc&  GetDesc() const                         = 0;
+
+    /// Returns true if the GPU copy from this buffer has been scheduled.
+    /// Unlike WaitForCopyScheduled(), the method does not block.
+    virtual bool IsCopyScheduled() const = 0;
+
+    /// Sets the upload priority.
+
+    /// When the copy budget is limited (see TextureUploaderDesc::MaxCopyBytesPerUpdate),
+    /// RenderThreadUpdate() executes pending copies of buffers with higher priority first.
+    /// Copies with equal priority are executed in the order they were scheduled.
+    /// The priority may be changed at any time from any thread, for example
+    /// when the distance to the object that uses the texture changes.
+    /// The priority is reset to zero when a recycled buffer is allocated again.
+    virtual void SetPriority(Int32 Priority) = 0;
+
+    /// Returns the upload priority, see SetPriority().
+    virtual Int32 GetPriority() const = 0;
 };
 
 /// Texture uploader description.
 struct TextureUploaderDesc
 {
+    /// An optional immediate context of a transfer queue that the uploader will use
+    /// to perform GPU copies (Direct3D12 and Vulkan only).
+
+    /// When the context is specified, the uploader executes all map and copy operations in this context,
+    /// so that texture streaming does not take time from the graphics queue. The render context passed to
+    /// RenderThreadUpdate() and ScheduleGPUCopy() waits for the copies with a fence before the destination
+    /// textures are used. The copies leave destination textures in RESOURCE_STATE_COMMON state.
+    ///
+    /// \remarks   Destination textures must be created with ImmediateContextMask that includes
+    ///             both the render context and the copy context.
+    ///             The uploader accesses the copy context from the render thread only (when
+    ///             RenderThreadUpdate() is called or when a non-null context is passed to
+    ///             other methods), and the application must not use it at the same time.
+    IDeviceContext* pCopyContext = nullptr;
+
+    /// The maximum number of bytes that RenderThreadUpdate() copies in one call (Direct3D12 and Vulkan only).
+
+    /// When zero, RenderThreadUpdate() executes all pending copies. Otherwise, pending copies
+    /// are executed in the order of upload buffer priorities (see IUploadBuffer::SetPriority())
+    /// until the budget is exhausted, and the remaining copies are deferred to the next calls.
+    /// Copies are split at subresource granularity starting with the coarsest mip level, so that
+    /// the mip tail of a large texture becomes available first. At least one subresource is copied
+    /// in every call. IUploadBuffer::WaitForCopyScheduled() returns only after all subresources of the
+    /// buffer have been copied.
+    ///
+    /// \note  Copies scheduled from the render thread (with non-null device context) are always
+    ///        executed immediately and are not affected by the budget.
+    Uint64 MaxCopyBytesPerUpdate = 0;
+
+    /// An optional Direct3D12 storage queue (see IStorageQueueD3D12) that the uploader uses to read
+    /// texture data from files directly into destination textures (Direct3D12 only).
+
+    /// See ITextureUploader::ScheduleFileRead().
+    IObject* pStorageQueue = nullptr;
+
+    /// Whether to encode uncompressed upload data into compressed destination textures on the GPU (Direct3D12 and Vulkan only).
+
+    /// When enabled, an upload buffer with an uncompressed format (e.g. TEX_FORMAT_RGBA8_UNORM) can be copied
+    /// into a destination texture with a block-compressed format supported by the TextureCompressor (BC1, BC3,
+    /// BC4, BC5 or BC7). The uploader copies every subresource into an intermediate texture and encodes it
+    /// directly into the destination mip level with a compute shader, so that loaders do not need to
+    /// transcode the data on the CPU. For sRGB destination formats, the upload buffer format must be an
+    /// sRGB format as well.
+    ///
+    /// \remarks   The compression is performed in the render context and is not available
+    ///             when pCopyContext is specified.
+    bool EnableGPUCompression = false;
+};
+
+
+/// Describes a read of texture subresource data from a file, see ITextureUploader::ScheduleFileRead().
+struct TextureFileReadInfo
+{
+    /// Path to the file to read the data from.
+    const Char* FilePath = nullptr;
+
+    /// Offset of the subresource data in the file, in bytes.
+    Uint64 FileOffset = 0;
+
+    /// Size of the data in the file, in bytes.
+    Uint32 Size = 0;
+
+    /// Size of the data after decompression, in bytes, or zero if the data is not compressed.
+    Uint32 UncompressedSize = 0;
+
+    /// Whether the data is compressed with GDeflate. The data is decompressed on the GPU.
+    bool GDeflateCompressed = false;
+
+    /// Destination texture.
+    ITexture* pDstTexture = nullptr;
+
+    /// Destination array slice.
+    Uint32 ArraySlice = 0;
+
+    /// Destination mip level.
+    Uint32 MipLevel = 0;
 };
 
 
 /// Texture uploader statistics.
 struct TextureUploaderStats
 {
+    /// The number of pending operations, including the copies deferred due to the copy budget.
     Uint32 NumPendingOperations = 0;
+
+    /// The total size of pending copies, in bytes (Direct3D12 and Vulkan only).
+    Uint64 PendingCopySize = 0;
 };
 
 /// Asynchronous texture uploader
@@ -80,6 +181,12 @@ class ITextureUploader : public IObject
 {
 public:
     /// Executes pending render-thread operations
+
+    /// \param [in] pContext - Render device context.
+    ///
+    /// If TextureUploaderDesc::MaxCopyBytesPerUpdate is not zero, the method copies at most
+    /// the specified number of bytes and defers the remaining copies to the next calls.
+    /// The method is intended to be called once per frame.
     virtual void RenderThreadUpdate(IDeviceContext* pContext) = 0;
 
 
@@ -134,6 +241,31 @@ public:
                                  IUploadBuffer*  pUploadBuffer) = 0;
 
 
+    /// Schedules a GPU copy to a region of the destination texture or executes the copy immediately.
+
+    /// \param [in] pContext      - Pointer to the device context when the method is executed by
+    ///                             render thread, or null when it is called from a worker thread.
+    /// \param [in] pDstTexture   - Destination texture for copy operation.
+    /// \param [in] ArraySlice    - Destination array slice. When multiple slices
+    ///                             are copied, the starting slice.
+    /// \param [in] MipLevel      - Destination mip level. When multiple mip levels are copied,
+    ///                             the starting mip level.
+    /// \param [in] DstX          - Destination region x offset in mip level MipLevel, in pixels.
+    /// \param [in] DstY          - Destination region y offset in mip level MipLevel, in pixels.
+    /// \param [in] pUploadBuffer - Upload buffer to copy data from.
+    ///
+    /// Mip level N of the upload buffer is copied to mip level MipLevel + N of the destination
+    /// texture at (DstX >> N, DstY >> N). For compressed formats, the offsets must be multiples
+    /// of the block size in every copied mip level. See ScheduleGPUCopy() for the threading remarks.
+    virtual void ScheduleGPUCopyToRegion(IDeviceContext* pContext,
+                                         ITexture*       pDstTexture,
+                                         Uint32          ArraySlice,
+                                         Uint32          MipLevel,
+                                         Uint32          DstX,
+                                         Uint32          DstY,
+                                         IUploadBuffer*  pUploadBuffer) = 0;
+
+
     /// Recycles upload buffer to make it available for future operations.
 
     /// \param [in] pUploadBuffer - Upload buffer to recycle.
@@ -142,8 +274,57 @@ public:
 
     /// Returns texture uploader statistics, see Diligent::TextureUploaderStats.
     virtual TextureUploaderStats GetStats() = 0;
+
+
+    /// Schedules a read of a texture subresource from a file directly into the destination texture.
+
+    /// \param [in] ReadInfo - Read description, see Diligent::TextureFileReadInfo.
+    /// \return    true if the read has been scheduled, and false otherwise.
+    ///
+    /// The method is only supported in Direct3D12 backend when a storage queue is
+    /// specified by TextureUploaderDesc::pStorageQueue. The subresource data in the file must
+    /// be laid out the way ID3D12Device::GetCopyableFootprints() reports for the subresource.
+    /// The destination texture must be in RESOURCE_STATE_COMMON state or not have a known state.
+    ///
+    /// The reads are submitted by the next RenderThreadUpdate() call, which also makes the render
+    /// context wait for them on the GPU and leaves the textures in RESOURCE_STATE_COMMON state.
+    /// The method can be safely called from multiple threads simultaneously.
+    virtual bool ScheduleFileRead(const TextureFileReadInfo& ReadInfo) = 0;
 };
 
 void CreateTextureUploader(IRenderDevice* pDevice, const TextureUploaderDesc& Desc, ITextureUploader** ppUploader);
 
+/// Asynchronously reads a subresource of the upload buffer from the file.
+
+/// \param [in] File            - File to read the data from, see FileSystem::OpenAsyncFile().
+/// \param [in] FileOffset      - Offset of the subresource data in the file, in bytes.
+/// \param [in] FileRowStride   - Row stride of the data in the file, in bytes. For compressed
+///                               formats, this is the stride of one row of blocks.
+/// \param [in] FileDepthStride - Depth slice stride of the data in the file, in bytes.
+/// \param [in] pUploadBuffer   - Upload buffer to read the data into.
+/// \param [in] MipLevel        - Upload buffer mip level.
+/// \param [in] ArraySlice      - Upload buffer array slice.
+/// \param [in] Callback        - Function that is called once all reads are complete. The argument
+///                               is true if the whole subresource has been read successfully.
+/// \return    true if the reads have been submitted, and false otherwise. In the latter case,
+///            the callback is not called.
+///
+/// When the strides in the file match the strides of the mapped upload buffer memory, the subresource
+/// is read with a single request. Otherwise, every row is read with a separate request.
+/// The upload buffer is kept alive until the callback is called. The callback is called from
+/// the file I/O completion thread, see AsyncFile::Read(), and may schedule the GPU copy
+/// with ITextureUploader::ScheduleGPUCopy() passing null context.
+///
+/// \note  For files opened with ASYNC_FILE_FLAG_UNBUFFERED, the offsets, sizes and
+///        addresses of the reads must satisfy AsyncFile::GetAlignment(), or the
+///        function fails.
+bool ReadUploadBufferFromFile(AsyncFile&                File,
+                              Uint64                    FileOffset,
+                              Uint64                    FileRowStride,
+                              Uint64                    FileDepthStride,
+                              IUploadBuffer*            pUploadBuffer,
+                              Uint32                    MipLevel,
+                              Uint32                    ArraySlice,
+                              std::function<void(bool)> Callback);
+
 } // namespace Diligent
@@ -28,6 +28,7 @@
 #pragma once
 
 #include <vector>
+#include <atomic>
 
 #include "TextureUploader.hpp"
 #include "../../../Common/interface/ObjectBase.hpp"
@@ -69,6 +70,9 @@ public:
     }
     virtual const UploadBufferDesc& GetDesc() const override final { return m_Desc; }
 
+    virtual void  SetPriority(Int32 Priority) override final { m_Priority.store(Priority); }
+    virtual Int32 GetPriority() const override final { return m_Priority.load(); }
+
     void SetMappedData(Uint32 Mip, Uint32 Slice, const MappedTextureSubresource& MappedData)
     {
         VERIFY_EXPR(Mip < m_Desc.MipLevels && Slice < m_Desc.ArraySize);
@@ -85,11 +89,13 @@ public:
     {
         for (auto& MappedData : m_MappedData)
             MappedData = MappedTextureSubresource{};
+        m_Priority.store(0);
     }
 
 protected:
     const UploadBufferDesc                m_Desc;
     std::vector<MappedTextureSubresource> m_MappedData;
+    std::atomic<Int32>                    m_Priority{0};
 };
 
 class TextureUploaderBase : public ObjectBase<ITextureUploader>
@@ -100,6 +106,21 @@ public:
         m_pDevice{pDevice}
     {}
 
+    virtual void ScheduleGPUCopy(IDeviceContext* pContext,
+                                 ITexture*       pDstTexture,
+                                 Uint32          ArraySlice,
+                                 Uint32          MipLevel,
+                                 IUploadBuffer*  pUploadBuffer) override final
+    {
+        ScheduleGPUCopyToRegion(pContext, pDstTexture, ArraySlice, MipLevel, 0, 0, pUploadBuffer);
+    }
+
+    virtual bool ScheduleFileRead(const TextureFileReadInfo& /*ReadInfo*/) override
+    {
+        LOG_ERROR_MESSAGE("File reads are not supported by this texture uploader");
+        return false;
+    }
+
 protected:
     RefCntAutoPtr<IRenderDevice> m_pDevice;
 };
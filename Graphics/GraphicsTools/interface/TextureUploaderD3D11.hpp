@@ -46,11 +46,13 @@ public:
                                       const UploadBufferDesc& Desc,
                                       IUploadBuffer**         ppBuffer) override final;
 
-    virtual void ScheduleGPUCopy(IDeviceContext* pContext,
-                                 ITexture*       pDstTexture,
-                                 Uint32          ArraySlice,
-                                 Uint32          MipLevel,
-                                 IUploadBuffer*  pUploadBuffer) override final;
+    virtual void ScheduleGPUCopyToRegion(IDeviceContext* pContext,
+                                         ITexture*       pDstTexture,
+                                         Uint32          ArraySlice,
+                                         Uint32          MipLevel,
+                                         Uint32          DstX,
+                                         Uint32          DstY,
+                                         IUploadBuffer*  pUploadBuffer) override final;
 
     virtual void RecycleBuffer(IUploadBuffer* pUploadBuffer) override final;
 
@@ -46,16 +46,20 @@ public:
                                       const UploadBufferDesc& Desc,
                                       IUploadBuffer**         ppBuffer) override final;
 
-    virtual void ScheduleGPUCopy(IDeviceContext* pContext,
-                                 ITexture*       pDstTexture,
-                                 Uint32          ArraySlice,
-                                 Uint32          MipLevel,
-                                 IUploadBuffer*  pUploadBuffer) override final;
+    virtual void ScheduleGPUCopyToRegion(IDeviceContext* pContext,
+                                         ITexture*       pDstTexture,
+                                         Uint32          ArraySlice,
+                                         Uint32          MipLevel,
+                                         Uint32          DstX,
+                                         Uint32          DstY,
+                                         IUploadBuffer*  pUploadBuffer) override final;
 
     virtual void RecycleBuffer(IUploadBuffer* pUploadBuffer) override final;
 
     virtual TextureUploaderStats GetStats() override final;
 
+    virtual bool ScheduleFileRead(const TextureFileReadInfo& ReadInfo) override final;
+
 private:
     struct InternalData;
     std::unique_ptr<InternalData> m_pInternalData;
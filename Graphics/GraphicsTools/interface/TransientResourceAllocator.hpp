@@ -0,0 +1,240 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::TransientResourceAllocator class
+
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "GPUCompletionAwaitQueue.hpp"
+
+namespace Diligent
+{
+
+/// Transient resource allocator create information.
+struct TransientResourceAllocatorCreateInfo
+{
+    /// The size of one device memory heap, in bytes.
+
+    /// Resources that do not fit into a heap of this size are placed into dedicated heaps.
+    Uint64 HeapSize = Uint64{64} << Uint64{20};
+
+    /// Immediate context mask of the device memory heaps.
+    Uint64 ImmediateContextMask = 1;
+};
+
+
+/// Allocator of transient textures and buffers whose lifetime does not exceed one frame.
+
+/// Resources are created as placed resources (see IRenderDevice::CreatePlacedTexture() and
+/// IRenderDevice::CreatePlacedBuffer()) at offsets in large device memory heaps. Every frame
+/// uses its own set of heaps that is recycled once the GPU has finished the frame.
+/// Resource objects are kept in the heaps and are reused by subsequent frames that request
+/// resources with the same description, so that a steady frame creates no objects and allocates
+/// no memory.
+///
+/// A resource may be released before the end of the frame by Release(), after which its memory
+/// may be reused by other resources allocated in the same frame. When a new resource overlaps
+/// memory that was used by other resources, the allocator records an aliasing barrier that must
+/// be committed by CommitAliasingBarriers() before the resource is used. Newly placed resources
+/// are in RESOURCE_STATE_UNDEFINED state, and their contents are undefined: a render target or
+/// a depth buffer must be cleared or fully overwritten before it is read.
+///
+/// If placed resources are not supported by the device (see AdapterMemoryInfo::PlacedResources),
+/// or the resource usage is not USAGE_DEFAULT, the allocator falls back to pooled committed resources.
+///
+/// Typical usage:
+///
+///     Allocator.BeginFrame();
+///     RefCntAutoPtr<ITexture> pGBuffer = Allocator.AllocateTexture(GBufferDesc);
+///     Allocator.CommitAliasingBarriers(pCtx);
+///     ...
+///     Allocator.Release(pGBuffer);
+///     RefCntAutoPtr<ITexture> pBloom = Allocator.AllocateTexture(BloomDesc); // May alias pGBuffer
+///     Allocator.CommitAliasingBarriers(pCtx);
+///     ...
+///     Allocator.EndFrame(pCtx);
+///
+/// \remarks    The allocator is not thread-safe. The same immediate context must be used for all frames.
+class TransientResourceAllocator
+{
+public:
+    /// Allocator statistics.
+    struct Statistics
+    {
+        /// The number of device memory heaps.
+        Uint32 NumHeaps = 0;
+
+        /// The total size of all device memory heaps, in bytes.
+        Uint64 HeapMemorySize = 0;
+
+        /// The total number of resource objects created by the allocator.
+        Uint32 NumCreatedResources = 0;
+
+        /// The total number of allocations that reused existing resource objects.
+        Uint32 NumReusedResources = 0;
+
+        /// The total number of recorded aliasing barriers.
+        Uint32 NumAliasingBarriers = 0;
+    };
+
+    TransientResourceAllocator(IRenderDevice* pDevice, const TransientResourceAllocatorCreateInfo& CI = {});
+    ~TransientResourceAllocator();
+
+    // clang-format off
+    TransientResourceAllocator           (const TransientResourceAllocator&) = delete;
+    TransientResourceAllocator& operator=(const TransientResourceAllocator&) = delete;
+    TransientResourceAllocator           (TransientResourceAllocator&&)      = delete;
+    TransientResourceAllocator& operator=(TransientResourceAllocator&&)      = delete;
+    // clang-format on
+
+    /// Begins a new frame and acquires the set of heaps of a frame completed by the GPU, if there is any.
+    void BeginFrame();
+
+    /// Allocates a transient texture.
+
+    /// \return     The texture, or null if it could not be created.
+    ///
+    /// \remarks    The texture must not be used after EndFrame() is called.
+    RefCntAutoPtr<ITexture> AllocateTexture(const TextureDesc& Desc);
+
+    /// Allocates a transient buffer.
+
+    /// \return     The buffer, or null if it could not be created.
+    ///
+    /// \remarks    The buffer must not be used after EndFrame() is called.
+    RefCntAutoPtr<IBuffer> AllocateBuffer(const BufferDesc& Desc);
+
+    /// Releases the resource before the end of the frame, so that its memory can be reused
+    /// by the resources allocated after it.
+
+    /// \remarks    Commands that use the resource must be recorded before any resource that is
+    ///             allocated after this call is used.
+    void Release(IDeviceObject* pResource);
+
+    /// Issues the aliasing barriers recorded since the last call in one batch.
+    void CommitAliasingBarriers(IDeviceContext* pCtx);
+
+    /// Ends the frame. The frame heaps are recycled once the GPU has finished all commands
+    /// submitted to the context so far.
+    void EndFrame(IDeviceContext* pCtx);
+
+    /// Returns true if the device supports placed resources.
+    bool IsPlacementSupported() const { return m_PlacementSupported; }
+
+    /// Returns the allocator statistics.
+    const Statistics& GetStatistics() const { return m_Stats; }
+
+    /// Returns the aliasing barrier between two resources that share the same memory.
+
+    /// \param [in] pBefore - The resource that used the memory before, or null if any resource could.
+    /// \param [in] pAfter  - The resource that uses the memory after the barrier.
+    static StateTransitionDesc GetAliasingBarrier(IDeviceObject* pBefore, IDeviceObject* pAfter);
+
+private:
+    struct Placement
+    {
+        Uint64 Offset = 0;
+        Uint64 Size   = 0;
+
+        RefCntAutoPtr<ITexture> pTexture;
+        RefCntAutoPtr<IBuffer>  pBuffer;
+
+        // Whether the resource is used by the current frame
+        bool InUse = false;
+
+        IDeviceObject* GetResource() const
+        {
+            return pTexture ? static_cast<IDeviceObject*>(pTexture) : static_cast<IDeviceObject*>(pBuffer);
+        }
+
+        bool Matches(const TextureDesc& Desc) const { return pTexture && pTexture->GetDesc() == Desc; }
+        bool Matches(const BufferDesc& Desc) const { return pBuffer && pBuffer->GetDesc() == Desc; }
+    };
+
+    struct Heap
+    {
+        RefCntAutoPtr<IDeviceMemory> pMemory;
+
+        Uint64 Size = 0;
+
+        // The memory above this offset has never been used by any resource
+        Uint64 HighWaterMark = 0;
+
+        // Resources placed in the heap, sorted by offset. The ranges never overlap:
+        // a resource that overlaps previous ones evicts them.
+        std::vector<Placement> Placements;
+    };
+
+    struct Frame
+    {
+        std::vector<Heap> Heaps;
+
+        // Committed resources used when placement is not possible
+        std::vector<Placement> Committed;
+    };
+
+    template <typename DescType>
+    Placement* FindReusable(std::vector<Placement>& Placements, const DescType& Desc);
+
+    template <typename DescType>
+    Placement* AllocatePlaced(const DescType& Desc, const ResourceMemoryRequirements& MemReqs);
+
+    template <typename DescType>
+    Placement* AllocateCommitted(const DescType& Desc);
+
+    bool FindRange(const Heap& H, const ResourceMemoryRequirements& MemReqs, Uint64& Offset) const;
+    bool CreateHeap(Uint64 Size);
+
+    void CreateResource(const TextureDesc& Desc, IDeviceMemory* pMemory, Uint64 Offset, Placement& P);
+    void CreateResource(const BufferDesc& Desc, IDeviceMemory* pMemory, Uint64 Offset, Placement& P);
+    ResourceMemoryRequirements GetMemoryRequirements(const TextureDesc& Desc) const;
+    ResourceMemoryRequirements GetMemoryRequirements(const BufferDesc& Desc) const;
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const Uint64 m_HeapSize;
+    const Uint64 m_ImmediateContextMask;
+    const bool   m_PlacementSupported;
+
+    Frame                          m_CurrentFrame;
+    GPUCompletionAwaitQueue<Frame> m_PendingFrames;
+
+    std::vector<StateTransitionDesc> m_PendingBarriers;
+    // Keeps the evicted resources referenced by the pending barriers alive
+    std::vector<RefCntAutoPtr<IDeviceObject>> m_BarrierResources;
+
+    Statistics m_Stats;
+};
+
+} // namespace Diligent
@@ -254,9 +254,28 @@ struct IVertexPool : public IObject
     virtual void GetUsageStats(VertexPoolUsageStats& UsageStats) = 0;
 
     /// Returns the internal buffer version. The version is incremented every time
-    /// any internal buffer is recreated.
+    /// any internal buffer is recreated and every time Defragment() moves allocations.
     virtual Uint32 GetVersion() const = 0;
 
+    /// Incrementally compacts the allocations towards the beginning of the pool.
+
+    /// \param[in] pDevice          - Render device that is used to create the scratch buffer.
+    /// \param[in] pContext         - Device context that records the copy commands.
+    /// \param[in] MaxBytesPerFrame - Maximum number of bytes to move during this call,
+    ///                               summed over all internal buffers.
+    ///
+    /// \return    The number of bytes moved.
+    ///
+    /// \remarks    Allocations from the end of the pool are moved to the lowest free
+    ///             ranges that can hold them. Their start vertices returned by
+    ///             IVertexPoolAllocation::GetStartVertex() change, and the pool version
+    ///             is incremented if any data was moved.
+    ///
+    ///             The method is a no-op if any internal buffer is dynamic or staging.
+    ///             The buffers are not shrunk.
+    ///             The method is not thread-safe with respect to Update().
+    virtual Uint32 Defragment(IRenderDevice* pDevice, IDeviceContext* pContext, Uint32 MaxBytesPerFrame) = 0;
+
     /// Returns the pool description.
     virtual const VertexPoolDesc& GetDesc() const = 0;
 };
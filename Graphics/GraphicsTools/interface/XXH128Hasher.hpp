@@ -47,6 +47,11 @@ struct XXH128Hash
     {
         return LowPart == RHS.LowPart && HighPart == RHS.HighPart;
     }
+
+    constexpr bool operator!=(const XXH128Hash& RHS) const noexcept
+    {
+        return !(*this == RHS);
+    }
 };
 
 struct XXH128State final
@@ -148,6 +153,7 @@ struct XXH128State final
                              std::is_same<typename std::remove_cv<T>::type, PipelineStateDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, PipelineResourceSignatureDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, Version>::value ||
+                             std::is_same<typename std::remove_cv<T>::type, SpecializationConstant>::value ||
                              std::is_same<typename std::remove_cv<T>::type, ShaderDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, TilePipelineDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, PipelineStateCreateInfo>::value ||
@@ -114,12 +114,28 @@ void AsyncPipelineState::QueryInterface(const INTERFACE_ID& IID, IObject** ppInt
     DEV_CHECK_ERR(*ppInterface == nullptr, "Overwriting reference to an existing object may result in memory leaks");
     *ppInterface = nullptr;
 
-    if (IID == IID_InternalImpl || IID == IID_PipelineState || IID == IID_DeviceObject || IID == IID_Unknown)
+    if (IID == IID_InternalImpl || IID == IID_AsyncPipelineState || IID == IID_PipelineState || IID == IID_DeviceObject || IID == IID_Unknown)
     {
         *ppInterface = this;
         (*ppInterface)->AddRef();
+        return;
     }
-    else if (m_pPipeline)
+
+    if (m_pFallback)
+    {
+        // Check the status so that the pipeline replaces the fallback as soon as it is ready
+        if (m_Status == PIPELINE_STATE_STATUS_COMPILING)
+            GetStatus(false);
+
+        if (m_Status != PIPELINE_STATE_STATUS_READY)
+        {
+            // Device contexts request the implementation interface in SetPipelineState()
+            m_pFallback->QueryInterface(IID, ppInterface);
+            return;
+        }
+    }
+
+    if (m_pPipeline)
     {
         // This will handle implementation-specific interfaces such as PipelineStateD3D11Impl::IID_InternalImpl,
         // PipelineStateD3D12Impl::IID_InternalImpl, etc. requested by e.g. device context implementations
@@ -160,6 +176,20 @@ void AsyncPipelineState::InitInternalPipeline()
 }
 
 PIPELINE_STATE_STATUS AsyncPipelineState::GetStatus(bool WaitForCompletion)
+{
+    m_Status = UpdateStatus(WaitForCompletion);
+
+    if (m_StatusCallback != nullptr && !m_StatusReported &&
+        (m_Status == PIPELINE_STATE_STATUS_READY || m_Status == PIPELINE_STATE_STATUS_FAILED))
+    {
+        m_StatusReported = true;
+        m_StatusCallback(this, m_Status, m_pStatusCallbackUserData);
+    }
+
+    return m_Status;
+}
+
+PIPELINE_STATE_STATUS AsyncPipelineState::UpdateStatus(bool WaitForCompletion)
 {
     if (m_pPipeline)
         return m_pPipeline->GetStatus(WaitForCompletion);
@@ -187,6 +217,40 @@ PIPELINE_STATE_STATUS AsyncPipelineState::GetStatus(bool WaitForCompletion)
     }
 }
 
+void AsyncPipelineState::CreateShaderResourceBinding(IShaderResourceBinding** ppShaderResourceBinding, bool InitStaticResources)
+{
+    IPipelineState* pPipeline = GetSRBSourcePipeline();
+    DEV_CHECK_ERR(pPipeline != nullptr, "Internal pipeline is null and no fallback pipeline is set");
+    if (pPipeline != nullptr)
+        pPipeline->CreateShaderResourceBinding(ppShaderResourceBinding, InitStaticResources);
+}
+
+void AsyncPipelineState::CreateShaderResourceBindings(Uint32 NumSRBs, IShaderResourceBinding** ppSRBs, bool InitStaticResources)
+{
+    IPipelineState* pPipeline = GetSRBSourcePipeline();
+    DEV_CHECK_ERR(pPipeline != nullptr, "Internal pipeline is null and no fallback pipeline is set");
+    if (pPipeline != nullptr)
+        pPipeline->CreateShaderResourceBindings(NumSRBs, ppSRBs, InitStaticResources);
+}
+
+void AsyncPipelineState::SetFallback(IPipelineState* pFallback)
+{
+    DEV_CHECK_ERR(pFallback == nullptr || pFallback->GetStatus() == PIPELINE_STATE_STATUS_READY,
+                  "Fallback pipeline '", pFallback->GetDesc().Name, "' of pipeline '", m_Name, "' is not ready");
+    DEV_CHECK_ERR(pFallback == nullptr || pFallback->GetDesc().PipelineType == m_Desc.PipelineType,
+                  "Fallback pipeline '", pFallback->GetDesc().Name, "' type does not match the type of pipeline '", m_Name, "'");
+    DEV_CHECK_ERR(pFallback != static_cast<IPipelineState*>(this), "Pipeline can't be its own fallback");
+
+    m_pFallback = pFallback;
+}
+
+void AsyncPipelineState::SetStatusCallback(AsyncPipelineStatusCallbackType Callback, void* pUserData)
+{
+    m_StatusCallback          = Callback;
+    m_pStatusCallbackUserData = pUserData;
+    m_StatusReported          = false;
+}
+
 void AsyncPipelineState::Create(RenderStateCacheImpl*          pStateCache,
                                 const PipelineStateCreateInfo& CreateInfo,
                                 IPipelineState**               ppReloadablePipeline)
@@ -0,0 +1,267 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BLASBuilder.hpp"
+
+#include <algorithm>
+
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// WriteBLASCompactedSize() writes 64-bit values on all backends except Metal, where it writes 32-bit values
+constexpr Uint64 CompactedSizeStride = sizeof(Uint64);
+
+} // namespace
+
+BLASBuilder::BLASBuilder(IRenderDevice* pDevice, const BLASBuilderCreateInfo& CI) :
+    m_pDevice{pDevice},
+    m_MaxScratchBufferSize{CI.MaxScratchBufferSize},
+    m_Compact{CI.Compact},
+    m_ScratchBufferAlignment{std::max(pDevice->GetAdapterInfo().RayTracing.ScratchBufferAlignment, 1u)},
+    m_Readbacks{pDevice}
+{
+}
+
+IBuffer* BLASBuilder::GetScratchBuffer(Uint64 Size)
+{
+    if (m_pScratchBuffer && m_pScratchBuffer->GetDesc().Size >= Size)
+        return m_pScratchBuffer;
+
+    // The old buffer may still be used by the GPU; the engine will release it once the commands complete
+    m_pScratchBuffer.Release();
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "BLAS builder scratch buffer";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.BindFlags = BIND_RAY_TRACING;
+    BuffDesc.Size      = Size;
+    m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pScratchBuffer);
+    return m_pScratchBuffer;
+}
+
+bool BLASBuilder::Build(IDeviceContext*        pCtx,
+                        const BuildInfo*       pBuildInfos,
+                        Uint32                 NumBuilds,
+                        CompactionCallbackType OnCompacted)
+{
+    DEV_CHECK_ERR(pCtx != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(NumBuilds == 0 || pBuildInfos != nullptr, "pBuildInfos must not be null when NumBuilds is not zero");
+    if (NumBuilds == 0)
+        return true;
+
+    // Compute the scratch regions. Builds are split into batches whose regions fit into the scratch buffer.
+    std::vector<Uint64> ScratchOffsets(NumBuilds);
+    std::vector<Uint32> BatchEnds;
+
+    Uint64 ScratchSize    = 0;
+    Uint64 MaxScratchSize = 0;
+    for (Uint32 i = 0; i < NumBuilds; ++i)
+    {
+        IBottomLevelAS* pBLAS = pBuildInfos[i].pBLAS;
+        DEV_CHECK_ERR(pBLAS != nullptr, "BLAS of build ", i, " must not be null");
+
+        const Uint64 Size = AlignUp(pBLAS->GetScratchBufferSizes().Build, Uint64{m_ScratchBufferAlignment});
+        if (m_MaxScratchBufferSize != 0 && ScratchSize != 0 && ScratchSize + Size > m_MaxScratchBufferSize)
+        {
+            BatchEnds.push_back(i);
+            ScratchSize = 0;
+        }
+        ScratchOffsets[i] = ScratchSize;
+        ScratchSize += Size;
+        MaxScratchSize = std::max(MaxScratchSize, ScratchSize);
+    }
+    BatchEnds.push_back(NumBuilds);
+
+    IBuffer* pScratch = GetScratchBuffer(MaxScratchSize);
+    if (pScratch == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to create BLAS builder scratch buffer of size ", MaxScratchSize);
+        return false;
+    }
+
+    std::vector<StateTransitionDesc> Barriers;
+    Barriers.reserve(NumBuilds + 1);
+
+    Uint32 BatchStart = 0;
+    for (Uint32 BatchEnd : BatchEnds)
+    {
+        // Transition all BLASes and the scratch buffer at once so that the builds in the batch
+        // are not separated by barriers. When the scratch buffer is reused by the next batch,
+        // the transition also waits for the previous builds to finish.
+        Barriers.clear();
+        for (Uint32 i = BatchStart; i < BatchEnd; ++i)
+            Barriers.emplace_back(pBuildInfos[i].pBLAS, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_BUILD_AS_WRITE, STATE_TRANSITION_FLAG_UPDATE_STATE);
+        Barriers.emplace_back(pScratch, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_BUILD_AS_WRITE, STATE_TRANSITION_FLAG_UPDATE_STATE);
+        pCtx->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+
+        for (Uint32 i = BatchStart; i < BatchEnd; ++i)
+        {
+            const BuildInfo& Info = pBuildInfos[i];
+
+            BuildBLASAttribs Attribs;
+            Attribs.pBLAS                       = Info.pBLAS;
+            Attribs.BLASTransitionMode          = RESOURCE_STATE_TRANSITION_MODE_NONE;
+            Attribs.GeometryTransitionMode      = Info.GeometryTransitionMode;
+            Attribs.pTriangleData               = Info.pTriangleData;
+            Attribs.TriangleDataCount           = Info.TriangleDataCount;
+            Attribs.pBoxData                    = Info.pBoxData;
+            Attribs.BoxDataCount                = Info.BoxDataCount;
+            Attribs.pScratchBuffer              = pScratch;
+            Attribs.ScratchBufferOffset         = ScratchOffsets[i];
+            Attribs.ScratchBufferTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
+            pCtx->BuildBLAS(Attribs);
+        }
+
+        BatchStart = BatchEnd;
+    }
+
+    if (m_Compact && OnCompacted)
+    {
+        std::vector<RefCntAutoPtr<IBottomLevelAS>> BLASes;
+        for (Uint32 i = 0; i < NumBuilds; ++i)
+        {
+            IBottomLevelAS* pBLAS = pBuildInfos[i].pBLAS;
+            if ((pBLAS->GetDesc().Flags & RAYTRACING_BUILD_AS_ALLOW_COMPACTION) != 0)
+                BLASes.emplace_back(pBLAS);
+        }
+        if (!BLASes.empty())
+            WriteCompactedSizes(pCtx, std::move(BLASes), std::move(OnCompacted));
+    }
+
+    return true;
+}
+
+void BLASBuilder::WriteCompactedSizes(IDeviceContext* pCtx, std::vector<RefCntAutoPtr<IBottomLevelAS>>&& BLASes, CompactionCallbackType&& Callback)
+{
+    const Uint32 NumBLASes = static_cast<Uint32>(BLASes.size());
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name              = "BLAS builder compacted sizes buffer";
+    BuffDesc.Usage             = USAGE_DEFAULT;
+    BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+    BuffDesc.Mode              = BUFFER_MODE_RAW;
+    BuffDesc.ElementByteStride = 4;
+    BuffDesc.Size              = NumBLASes * CompactedSizeStride;
+
+    RefCntAutoPtr<IBuffer> pSizesBuffer;
+    m_pDevice->CreateBuffer(BuffDesc, nullptr, &pSizesBuffer);
+    if (!pSizesBuffer)
+    {
+        LOG_ERROR_MESSAGE("Failed to create BLAS compacted sizes buffer. ", NumBLASes, " BLAS(es) will not be compacted.");
+        return;
+    }
+
+    for (Uint32 i = 0; i < NumBLASes; ++i)
+    {
+        WriteBLASCompactedSizeAttribs Attribs;
+        Attribs.pBLAS                = BLASes[i];
+        Attribs.pDestBuffer          = pSizesBuffer;
+        Attribs.DestBufferOffset     = i * CompactedSizeStride;
+        Attribs.BLASTransitionMode   = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        Attribs.BufferTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        pCtx->WriteBLASCompactedSize(Attribs);
+    }
+
+    m_CompactionBatches.emplace_back(new CompactionBatch{std::move(BLASes), {}, std::move(Callback)});
+    m_NumPendingCompactions += NumBLASes;
+
+    CompactionBatch* pBatch  = m_CompactionBatches.back().get();
+    const bool       Is32Bit = m_pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_METAL;
+
+    // The sizes buffer is released when this function returns; the engine keeps it alive until the copy completes
+    const bool Enqueued = m_Readbacks.ReadBuffer(
+        pCtx, pSizesBuffer, 0, BuffDesc.Size,
+        [pBatch, Is32Bit, NumBLASes](const ReadbackQueue::ReadbackData& Data) {
+            pBatch->CompactedSizes.resize(NumBLASes);
+            for (Uint32 i = 0; i < NumBLASes; ++i)
+            {
+                const Uint8* pSrc = static_cast<const Uint8*>(Data.pData) + i * CompactedSizeStride;
+                // Zero size means the data could not be read; such BLASes are not compacted
+                pBatch->CompactedSizes[i] = Data.pData == nullptr ? 0 : (Is32Bit ? Uint64{*reinterpret_cast<const Uint32*>(pSrc)} : *reinterpret_cast<const Uint64*>(pSrc));
+            }
+            pBatch->SizesReady = true;
+        });
+
+    if (!Enqueued)
+    {
+        m_NumPendingCompactions -= NumBLASes;
+        m_CompactionBatches.pop_back();
+    }
+}
+
+Uint32 BLASBuilder::Poll(IDeviceContext* pCtx)
+{
+    m_Readbacks.Poll(pCtx);
+
+    Uint32 NumCompacted = 0;
+    while (!m_CompactionBatches.empty() && m_CompactionBatches.front()->SizesReady)
+    {
+        CompactionBatch& Batch = *m_CompactionBatches.front();
+        for (size_t i = 0; i < Batch.BLASes.size(); ++i)
+        {
+            IBottomLevelAS*          pSrcBLAS = Batch.BLASes[i];
+            const BottomLevelASDesc& SrcDesc  = pSrcBLAS->GetDesc();
+
+            RefCntAutoPtr<IBottomLevelAS> pCompactedBLAS;
+            if (Batch.CompactedSizes[i] != 0)
+            {
+                BottomLevelASDesc Desc;
+                Desc.Name          = SrcDesc.Name;
+                Desc.CompactedSize = Batch.CompactedSizes[i];
+                m_pDevice->CreateBLAS(Desc, &pCompactedBLAS);
+            }
+            if (!pCompactedBLAS)
+            {
+                LOG_ERROR_MESSAGE("Failed to create compacted BLAS '", (SrcDesc.Name != nullptr ? SrcDesc.Name : ""), "'");
+                continue;
+            }
+
+            CopyBLASAttribs Attribs;
+            Attribs.pSrc              = pSrcBLAS;
+            Attribs.pDst              = pCompactedBLAS;
+            Attribs.Mode              = COPY_AS_MODE_COMPACT;
+            Attribs.SrcTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+            Attribs.DstTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+            pCtx->CopyBLAS(Attribs);
+
+            Batch.Callback(pSrcBLAS, pCompactedBLAS);
+            ++NumCompacted;
+        }
+
+        m_NumPendingCompactions -= static_cast<Uint32>(Batch.BLASes.size());
+        m_CompactionBatches.erase(m_CompactionBatches.begin());
+    }
+
+    return NumCompacted;
+}
+
+} // namespace Diligent
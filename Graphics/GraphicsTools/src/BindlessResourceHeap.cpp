@@ -0,0 +1,253 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BindlessResourceHeap.hpp"
+
+#include "DebugUtilities.hpp"
+#include "BasicMath.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+BindlessResourceHeap::BindlessResourceHeap(IRenderDevice* pDevice, const BindlessResourceHeapCreateInfo& CreateInfo) :
+    m_NumFramesInFlight{CreateInfo.NumFramesInFlight}
+{
+    if (pDevice == nullptr)
+        LOG_ERROR_AND_THROW("Render device must not be null");
+
+    const DeviceFeatures& Features = pDevice->GetDeviceInfo().Features;
+    if (!Features.BindlessResources || !Features.ShaderResourceRuntimeArrays)
+        LOG_ERROR_AND_THROW("Bindless resource heap requires BindlessResources and ShaderResourceRuntimeArrays device features");
+
+    if (CreateInfo.ShaderStages == SHADER_TYPE_UNKNOWN)
+        LOG_ERROR_AND_THROW("Shader stages must not be SHADER_TYPE_UNKNOWN");
+
+    struct ArrayInfo
+    {
+        const char*             Name;
+        Uint32                  Size;
+        SHADER_RESOURCE_TYPE    Type;
+        PIPELINE_RESOURCE_FLAGS Flags;
+    };
+    // clang-format off
+    const std::array<ArrayInfo, RESOURCE_ARRAY_COUNT> Arrays =
+    {
+        ArrayInfo{CreateInfo.TextureSRVsName, CreateInfo.NumTextureSRVs, SHADER_RESOURCE_TYPE_TEXTURE_SRV, PIPELINE_RESOURCE_FLAG_NONE},
+        ArrayInfo{CreateInfo.TextureUAVsName, CreateInfo.NumTextureUAVs, SHADER_RESOURCE_TYPE_TEXTURE_UAV, PIPELINE_RESOURCE_FLAG_NONE},
+        ArrayInfo{CreateInfo.BufferSRVsName,  CreateInfo.NumBufferSRVs,  SHADER_RESOURCE_TYPE_BUFFER_SRV,  CreateInfo.BufferFlags},
+        ArrayInfo{CreateInfo.BufferUAVsName,  CreateInfo.NumBufferUAVs,  SHADER_RESOURCE_TYPE_BUFFER_UAV,  CreateInfo.BufferFlags},
+        ArrayInfo{CreateInfo.SamplersName,    CreateInfo.NumSamplers,    SHADER_RESOURCE_TYPE_SAMPLER,     PIPELINE_RESOURCE_FLAG_NONE},
+    };
+    // clang-format on
+
+    std::vector<PipelineResourceDesc> Resources;
+    for (const ArrayInfo& Arr : Arrays)
+    {
+        if (Arr.Size == 0)
+            continue;
+
+        if (Arr.Name == nullptr || Arr.Name[0] == '\0')
+            LOG_ERROR_AND_THROW("The name of the ", GetShaderResourceTypeLiteralName(Arr.Type), " array must not be null or empty");
+
+        Resources.emplace_back(CreateInfo.ShaderStages, Arr.Name, Arr.Size, Arr.Type, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE,
+                               Arr.Flags | PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY);
+    }
+    if (Resources.empty())
+        LOG_ERROR_AND_THROW("At least one resource array size must not be zero");
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name                       = CreateInfo.Name != nullptr ? CreateInfo.Name : "Bindless resource heap";
+    PRSDesc.Resources                  = Resources.data();
+    PRSDesc.NumResources               = static_cast<Uint32>(Resources.size());
+    PRSDesc.BindingIndex               = CreateInfo.BindingIndex;
+    PRSDesc.UseCombinedTextureSamplers = false;
+
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &m_pSignature);
+    if (!m_pSignature)
+        LOG_ERROR_AND_THROW("Failed to create the resource signature for bindless resource heap '", PRSDesc.Name, "'");
+
+    m_pSignature->CreateShaderResourceBinding(&m_pSRB, true);
+    if (!m_pSRB)
+        LOG_ERROR_AND_THROW("Failed to create the SRB for bindless resource heap '", PRSDesc.Name, "'");
+
+    // All stages share the same resource, so any stage can be used to access the variable
+    SHADER_TYPE       Stages     = CreateInfo.ShaderStages;
+    const SHADER_TYPE FirstStage = ExtractLSB(Stages);
+    for (Uint32 i = 0; i < RESOURCE_ARRAY_COUNT; ++i)
+    {
+        if (Arrays[i].Size == 0)
+            continue;
+
+        ResourceArray& Arr = m_Arrays[i];
+        Arr.pVar           = m_pSRB->GetVariableByName(FirstStage, Arrays[i].Name);
+        if (Arr.pVar == nullptr)
+            LOG_ERROR_AND_THROW("Failed to find variable '", Arrays[i].Name, "' in bindless resource heap '", PRSDesc.Name, "'");
+        Arr.Capacity = Arrays[i].Size;
+    }
+}
+
+BindlessResourceHeap::RESOURCE_ARRAY BindlessResourceHeap::GetResourceArray(SHADER_RESOURCE_TYPE Type)
+{
+    switch (Type)
+    {
+        case SHADER_RESOURCE_TYPE_TEXTURE_SRV: return RESOURCE_ARRAY_TEXTURE_SRV;
+        case SHADER_RESOURCE_TYPE_TEXTURE_UAV: return RESOURCE_ARRAY_TEXTURE_UAV;
+        case SHADER_RESOURCE_TYPE_BUFFER_SRV: return RESOURCE_ARRAY_BUFFER_SRV;
+        case SHADER_RESOURCE_TYPE_BUFFER_UAV: return RESOURCE_ARRAY_BUFFER_UAV;
+        case SHADER_RESOURCE_TYPE_SAMPLER: return RESOURCE_ARRAY_SAMPLER;
+
+        default:
+            UNEXPECTED(GetShaderResourceTypeLiteralName(Type), " resources are not supported by the bindless resource heap");
+            return RESOURCE_ARRAY_COUNT;
+    }
+}
+
+void BindlessResourceHeap::SetObject(ResourceArray& Arr, Uint32 Index, IDeviceObject* pObject)
+{
+    VERIFY_EXPR(Arr.pVar != nullptr && Index < Arr.Capacity);
+    Arr.pVar->SetArray(&pObject, Index, 1, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+}
+
+Uint32 BindlessResourceHeap::Allocate(SHADER_RESOURCE_TYPE Type, IDeviceObject* pObject)
+{
+    const RESOURCE_ARRAY ArrIdx = GetResourceArray(Type);
+    if (ArrIdx == RESOURCE_ARRAY_COUNT)
+        return InvalidIndex;
+
+    DEV_CHECK_ERR(pObject != nullptr, "Object must not be null");
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    ResourceArray& Arr = m_Arrays[ArrIdx];
+    if (Arr.Capacity == 0)
+    {
+        DEV_ERROR(GetShaderResourceTypeLiteralName(Type), " array is disabled in this bindless resource heap");
+        return InvalidIndex;
+    }
+
+    Uint32 Index = InvalidIndex;
+    if (!Arr.FreeIndices.empty())
+    {
+        Index = Arr.FreeIndices.back();
+        Arr.FreeIndices.pop_back();
+    }
+    else if (Arr.NextIndex < Arr.Capacity)
+    {
+        Index = Arr.NextIndex++;
+    }
+    else
+    {
+        LOG_ERROR_MESSAGE("Bindless resource heap ", GetShaderResourceTypeLiteralName(Type), " array is full (", Arr.Capacity, " elements)");
+        return InvalidIndex;
+    }
+
+    SetObject(Arr, Index, pObject);
+    ++Arr.NumAllocated;
+
+    return Index;
+}
+
+void BindlessResourceHeap::Update(SHADER_RESOURCE_TYPE Type, Uint32 Index, IDeviceObject* pObject)
+{
+    const RESOURCE_ARRAY ArrIdx = GetResourceArray(Type);
+    if (ArrIdx == RESOURCE_ARRAY_COUNT)
+        return;
+
+    DEV_CHECK_ERR(pObject != nullptr, "Object must not be null. Use Release() to release the index");
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    ResourceArray& Arr = m_Arrays[ArrIdx];
+    if (Index >= Arr.NextIndex)
+    {
+        DEV_ERROR("Index ", Index, " has not been allocated");
+        return;
+    }
+
+    SetObject(Arr, Index, pObject);
+}
+
+void BindlessResourceHeap::Release(SHADER_RESOURCE_TYPE Type, Uint32 Index)
+{
+    if (Index == InvalidIndex)
+        return;
+
+    const RESOURCE_ARRAY ArrIdx = GetResourceArray(Type);
+    if (ArrIdx == RESOURCE_ARRAY_COUNT)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    ResourceArray& Arr = m_Arrays[ArrIdx];
+    if (Index >= Arr.NextIndex)
+    {
+        DEV_ERROR("Index ", Index, " has not been allocated");
+        return;
+    }
+    VERIFY(Arr.NumAllocated > 0, "There are no allocated indices");
+
+    // The GPU may still access the slot, so do not unbind the object until the index becomes available
+    Arr.StaleIndices.emplace_back(m_FrameNumber, Index);
+    --Arr.NumAllocated;
+}
+
+void BindlessResourceHeap::FinishFrame()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    ++m_FrameNumber;
+    for (ResourceArray& Arr : m_Arrays)
+    {
+        while (!Arr.StaleIndices.empty() && Arr.StaleIndices.front().first + m_NumFramesInFlight <= m_FrameNumber)
+        {
+            const Uint32 Index = Arr.StaleIndices.front().second;
+            // Release the reference to the object
+            SetObject(Arr, Index, nullptr);
+            Arr.FreeIndices.push_back(Index);
+            Arr.StaleIndices.pop_front();
+        }
+    }
+}
+
+Uint32 BindlessResourceHeap::GetCapacity(SHADER_RESOURCE_TYPE Type) const
+{
+    const RESOURCE_ARRAY ArrIdx = GetResourceArray(Type);
+    return ArrIdx != RESOURCE_ARRAY_COUNT ? m_Arrays[ArrIdx].Capacity : 0;
+}
+
+Uint32 BindlessResourceHeap::GetAllocatedCount(SHADER_RESOURCE_TYPE Type) const
+{
+    const RESOURCE_ARRAY ArrIdx = GetResourceArray(Type);
+    if (ArrIdx == RESOURCE_ARRAY_COUNT)
+        return 0;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return m_Arrays[ArrIdx].NumAllocated;
+}
+
+} // namespace Diligent
@@ -29,6 +29,9 @@
 
 #include <mutex>
 #include <atomic>
+#include <map>
+#include <vector>
+#include <string>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -52,13 +55,15 @@ public:
                             BufferSuballocatorImpl*                      pParentAllocator,
                             Uint32                                       Offset,
                             Uint32                                       Size,
+                            Uint32                                       Alignment,
                             VariableSizeAllocationsManager::Allocation&& Subregion) :
         // clang-format off
         TBase             {pRefCounters},
         m_pParentAllocator{pParentAllocator},
         m_Subregion       {std::move(Subregion)},
         m_Offset          {Offset},
-        m_Size            {Size}
+        m_Size            {Size},
+        m_Alignment       {Alignment}
     // clang-format on
     {
         VERIFY_EXPR(m_pParentAllocator);
@@ -83,7 +88,7 @@ public:
 
     virtual Uint32 GetOffset() const override final
     {
-        return m_Offset;
+        return m_Offset.load();
     }
 
     virtual Uint32 GetSize() const override final
@@ -107,13 +112,37 @@ public:
         return m_pUserData;
     }
 
+    // The following methods must only be called by the parent allocator while its mutex is locked.
+    const VariableSizeAllocationsManager::Allocation& GetSubregion() const
+    {
+        return m_Subregion;
+    }
+
+    Uint32 GetAlignment() const
+    {
+        return m_Alignment;
+    }
+
+    // Moves the suballocation to the new subregion and returns the old one.
+    VariableSizeAllocationsManager::Allocation Relocate(VariableSizeAllocationsManager::Allocation&& NewSubregion, Uint32 NewOffset)
+    {
+        VERIFY_EXPR(NewSubregion.IsValid());
+        VariableSizeAllocationsManager::Allocation OldSubregion = std::move(m_Subregion);
+        m_Subregion                                             = std::move(NewSubregion);
+        m_Offset.store(NewOffset);
+        return OldSubregion;
+    }
+
 private:
     RefCntAutoPtr<BufferSuballocatorImpl> m_pParentAllocator;
 
     VariableSizeAllocationsManager::Allocation m_Subregion;
 
-    const Uint32 m_Offset;
+    // The offset is changed by Defragment() and may be read by any thread
+    std::atomic<Uint32> m_Offset;
+
     const Uint32 m_Size;
+    const Uint32 m_Alignment;
 
     RefCntAutoPtr<IObject> m_pUserData;
 };
@@ -160,6 +189,7 @@ public:
             },
         },
         m_BufferSize{m_Buffer.GetDesc().Size},
+        m_Name{CreateInfo.Desc.Name != nullptr ? CreateInfo.Desc.Name : "Buffer suballocator"},
         m_SuballocationsAllocator{
             DefaultRawMemoryAllocator::GetAllocator(),
             sizeof(BufferSuballocationImpl),
@@ -217,65 +247,75 @@ public:
 
         DEV_CHECK_ERR(*ppSuballocation == nullptr, "Overwriting reference to existing object may cause memory leaks");
 
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
         VariableSizeAllocationsManager::Allocation Subregion;
-        {
-            std::lock_guard<std::mutex> Lock{m_MgrMtx};
 
+        {
+            // After the resize, the actual buffer size may be larger due to alignment
+            // requirements (for sparse buffers, the size is aligned by the memory page size).
+            const Uint64     BufferSize = m_BufferSize.load();
+            const OffsetType MgrSize    = m_Mgr.GetMaxSize();
+            if (BufferSize > MgrSize)
             {
-                // After the resize, the actual buffer size may be larger due to alignment
-                // requirements (for sparse buffers, the size is aligned by the memory page size).
-                const Uint64     BufferSize = m_BufferSize.load();
-                const OffsetType MgrSize    = m_Mgr.GetMaxSize();
-                if (BufferSize > MgrSize)
-                {
-                    m_Mgr.Extend(StaticCast<size_t>(BufferSize - MgrSize));
-                    VERIFY_EXPR(m_Mgr.GetMaxSize() == BufferSize);
-                    m_MgrSize.store(m_Mgr.GetMaxSize());
-                }
+                m_Mgr.Extend(StaticCast<size_t>(BufferSize - MgrSize));
+                VERIFY_EXPR(m_Mgr.GetMaxSize() == BufferSize);
+                m_MgrSize.store(m_Mgr.GetMaxSize());
             }
+        }
 
-            Subregion = m_Mgr.Allocate(Size, Alignment);
-
-            while (!Subregion.IsValid() && (m_MaxSize == 0 || m_MaxSize > m_Mgr.GetMaxSize()))
-            {
-                size_t ExtraSize = m_ExpansionSize != 0 ?
-                    std::max(m_ExpansionSize, AlignUp(Size, Alignment)) :
-                    m_Mgr.GetMaxSize();
+        Subregion = m_Mgr.Allocate(Size, Alignment);
 
-                if (m_MaxSize != 0)
-                    ExtraSize = std::min(ExtraSize, StaticCast<size_t>(m_MaxSize) - m_Mgr.GetMaxSize());
+        while (!Subregion.IsValid() && (m_MaxSize == 0 || m_MaxSize > m_Mgr.GetMaxSize()))
+        {
+            size_t ExtraSize = m_ExpansionSize != 0 ?
+                std::max(m_ExpansionSize, AlignUp(Size, Alignment)) :
+                m_Mgr.GetMaxSize();
 
-                m_Mgr.Extend(ExtraSize);
-                m_MgrSize.store(m_Mgr.GetMaxSize());
+            if (m_MaxSize != 0)
+                ExtraSize = std::min(ExtraSize, StaticCast<size_t>(m_MaxSize) - m_Mgr.GetMaxSize());
 
-                Subregion = m_Mgr.Allocate(Size, Alignment);
-            }
+            m_Mgr.Extend(ExtraSize);
+            m_MgrSize.store(m_Mgr.GetMaxSize());
 
-            UpdateUsageStats();
+            Subregion = m_Mgr.Allocate(Size, Alignment);
         }
 
+        UpdateUsageStats();
+
         if (Subregion.IsValid())
         {
+            const OffsetType UnalignedOffset = Subregion.UnalignedOffset;
             // clang-format off
             BufferSuballocationImpl* pSuballocation{
                 NEW_RC_OBJ(m_SuballocationsAllocator, "BufferSuballocationImpl instance", BufferSuballocationImpl)
                 (
                     this,
-                    AlignUp(static_cast<Uint32>(Subregion.UnalignedOffset), Alignment),
+                    AlignUp(static_cast<Uint32>(UnalignedOffset), Alignment),
                     Size,
+                    Alignment,
                     std::move(Subregion)
                 )
             };
             // clang-format on
 
+            // Keep track of live suballocations so that Defragment() can move them
+            m_Suballocations.emplace(UnalignedOffset, pSuballocation);
+
             pSuballocation->QueryInterface(IID_BufferSuballocation, reinterpret_cast<IObject**>(ppSuballocation));
             m_AllocationCount.fetch_add(1);
         }
     }
 
-    void Free(VariableSizeAllocationsManager::Allocation&& Subregion)
+    void Free(BufferSuballocationImpl& Suballocation)
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        // NB: the subregion may have been changed by Defragment(), so it must be read while the mutex is locked
+        VariableSizeAllocationsManager::Allocation Subregion = Suballocation.Relocate(VariableSizeAllocationsManager::Allocation::InvalidAllocation(), 0);
+        VERIFY_EXPR(m_Suballocations.find(Subregion.UnalignedOffset) != m_Suballocations.end() &&
+                    m_Suballocations.find(Subregion.UnalignedOffset)->second == &Suballocation);
+        m_Suballocations.erase(Subregion.UnalignedOffset);
         m_Mgr.Free(std::move(Subregion));
         m_AllocationCount.fetch_add(-1);
         UpdateUsageStats();
@@ -283,7 +323,121 @@ public:
 
     virtual Uint32 GetVersion() const override final
     {
-        return m_Buffer.GetVersion();
+        return m_Buffer.GetVersion() + m_DefragmentationVersion.load();
+    }
+
+    virtual Uint32 Defragment(IRenderDevice* pDevice, IDeviceContext* pContext, Uint32 MaxBytesPerFrame) override final
+    {
+        if (pContext == nullptr)
+        {
+            UNEXPECTED("pContext must not be null");
+            return 0;
+        }
+
+        if (MaxBytesPerFrame == 0)
+            return 0;
+
+        const USAGE Usage = m_Buffer.GetDesc().Usage;
+        if (Usage != USAGE_DEFAULT && Usage != USAGE_SPARSE)
+        {
+            // Dynamic and staging buffers can't be copy destinations
+            return 0;
+        }
+
+        IBuffer* pBuffer = Update(pDevice, pContext);
+        if (pBuffer == nullptr)
+            return 0;
+
+        // Data is copied through the scratch buffer because source and destination regions
+        // of the same buffer would require conflicting resource states.
+        if (!m_pScratchBuffer || m_pScratchBuffer->GetDesc().Size < MaxBytesPerFrame)
+        {
+            if (pDevice == nullptr)
+                return 0;
+
+            const std::string ScratchName = m_Name + " - defragmentation scratch";
+
+            BufferDesc ScratchDesc;
+            ScratchDesc.Name      = ScratchName.c_str();
+            ScratchDesc.Size      = MaxBytesPerFrame;
+            ScratchDesc.Usage     = USAGE_DEFAULT;
+            ScratchDesc.BindFlags = BIND_NONE;
+
+            m_pScratchBuffer.Release();
+            pDevice->CreateBuffer(ScratchDesc, nullptr, &m_pScratchBuffer);
+            if (!m_pScratchBuffer)
+            {
+                LOG_ERROR_MESSAGE("Failed to create defragmentation scratch buffer for '", m_Name, "'");
+                return 0;
+            }
+        }
+
+        m_DefragmentationMoves.clear();
+        Uint32 BytesMoved = 0;
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+            // Move suballocations from the end of the buffer to the lowest free regions
+            auto it = m_Suballocations.end();
+            while (it != m_Suballocations.begin() && BytesMoved < MaxBytesPerFrame)
+            {
+                --it;
+                // All suballocations below the first free block are already tightly packed
+                if (it->first < m_Mgr.GetFirstFreeBlockOffset())
+                    break;
+
+                BufferSuballocationImpl* const pSuballocation = it->second;
+
+                const Uint32 Size = pSuballocation->GetSize();
+                if (Size > MaxBytesPerFrame - BytesMoved)
+                    continue;
+
+                const Uint32 Alignment = pSuballocation->GetAlignment();
+
+                VariableSizeAllocationsManager::Allocation NewSubregion = m_Mgr.AllocateBelow(Size, Alignment, it->first);
+                if (!NewSubregion.IsValid())
+                    continue;
+
+                const OffsetType NewUnalignedOffset = NewSubregion.UnalignedOffset;
+                const Uint32     NewOffset          = AlignUp(static_cast<Uint32>(NewUnalignedOffset), Alignment);
+                const Uint32     OldOffset          = pSuballocation->GetOffset();
+
+                m_DefragmentationMoves.push_back({OldOffset, NewOffset, Size, BytesMoved});
+                m_Mgr.Free(pSuballocation->Relocate(std::move(NewSubregion), NewOffset));
+                BytesMoved += Size;
+
+                // NB: erase() returns the iterator to the next (higher) element, so the next
+                //     decrement in the loop moves to the element below the erased one.
+                it = m_Suballocations.erase(it);
+                m_RelocatedSuballocations.emplace_back(NewUnalignedOffset, pSuballocation);
+            }
+
+            // Insert relocated suballocations after the loop so that they are not moved again
+            m_Suballocations.insert(m_RelocatedSuballocations.begin(), m_RelocatedSuballocations.end());
+            m_RelocatedSuballocations.clear();
+
+            UpdateUsageStats();
+        }
+
+        if (m_DefragmentationMoves.empty())
+            return 0;
+
+        // First copy all source regions to the scratch buffer because destination
+        // of one move may overlap with the source of another move.
+        for (const DefragmentationMove& Move : m_DefragmentationMoves)
+        {
+            pContext->CopyBuffer(pBuffer, Move.SrcOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                 m_pScratchBuffer, Move.ScratchOffset, Move.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        }
+        for (const DefragmentationMove& Move : m_DefragmentationMoves)
+        {
+            pContext->CopyBuffer(m_pScratchBuffer, Move.ScratchOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                 pBuffer, Move.DstOffset, Move.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        }
+
+        m_DefragmentationVersion.fetch_add(1);
+
+        return BytesMoved;
     }
 
     virtual void GetUsageStats(BufferSuballocatorUsageStats& UsageStats) override final
@@ -315,17 +469,34 @@ private:
     DynamicBuffer       m_Buffer;
     std::atomic<Uint64> m_BufferSize{0};
 
+    const std::string m_Name;
+
     std::atomic<Int32>  m_AllocationCount{0};
     std::atomic<Uint64> m_UsedSize{0};
     std::atomic<Uint64> m_MaxFreeBlockSize{0};
 
     FixedBlockMemoryAllocator m_SuballocationsAllocator;
+
+    // Live suballocations ordered by their unaligned offset, protected by m_MgrMtx
+    std::map<OffsetType, BufferSuballocationImpl*> m_Suballocations;
+
+    struct DefragmentationMove
+    {
+        Uint32 SrcOffset;
+        Uint32 DstOffset;
+        Uint32 Size;
+        Uint32 ScratchOffset;
+    };
+    std::vector<DefragmentationMove>                             m_DefragmentationMoves;
+    std::vector<std::pair<OffsetType, BufferSuballocationImpl*>> m_RelocatedSuballocations;
+    RefCntAutoPtr<IBuffer>                                       m_pScratchBuffer;
+    std::atomic<Uint32>                                          m_DefragmentationVersion{0};
 };
 
 
 BufferSuballocationImpl::~BufferSuballocationImpl()
 {
-    m_pParentAllocator->Free(std::move(m_Subregion));
+    m_pParentAllocator->Free(*this);
 }
 
 IBufferSuballocator* BufferSuballocationImpl::GetAllocator()
@@ -25,6 +25,12 @@
  */
 
 #include <unordered_map>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <random>
+#include <algorithm>
 
 #include "RefCntAutoPtr.hpp"
 #include "DataBlobImpl.hpp"
@@ -33,10 +39,19 @@
 #include "BytecodeCache.h"
 #include "XXH128Hasher.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
 
 namespace Diligent
 {
 
+namespace
+{
+
+constexpr char BytecodeCacheEntryFileExtension[] = ".bytecode";
+
+} // namespace
+
 /// Implementation of IBytecodeCache
 class BytecodeCacheImpl final : public ObjectBase<IBytecodeCache>
 {
@@ -72,12 +87,49 @@ public:
         }
     };
 
+    // Header of the file that holds a single cache entry in the cache directory
+    struct BytecodeCacheFileHeader
+    {
+        static constexpr Uint32 HeaderMagic   = 0x7ADEF11E;
+        static constexpr Uint32 HeaderVersion = 1;
+
+        Uint32 Magic   = HeaderMagic;
+        Uint32 Version = HeaderVersion;
+
+        BytecodeCacheElementHeader Element;
+
+        template <typename SerType>
+        bool Serialize(SerType& Stream)
+        {
+            return Stream(Magic, Version, Element.Hash.LowPart, Element.Hash.HighPart, Element.DataSize);
+        }
+    };
+
+    // When the directory size limit is exceeded, the least recently used entries are removed
+    // until the size drops to this fraction of the limit, so that the directory is not scanned
+    // on every addition.
+    static constexpr Uint64 TrimTargetPercent = 90;
+
 public:
     BytecodeCacheImpl(IReferenceCounters*            pRefCounters,
                       const BytecodeCacheCreateInfo& CreateInfo) :
         TBase{pRefCounters},
-        m_DeviceType{CreateInfo.DeviceType}
+        m_DeviceType{CreateInfo.DeviceType},
+        m_Directory{CreateInfo.Directory != nullptr ? CreateInfo.Directory : ""},
+        m_MaxDirectorySize{CreateInfo.MaxDirectorySize}
     {
+        if (!m_Directory.empty())
+        {
+            if (!FileSystem::PathExists(m_Directory.c_str()))
+            {
+                if (!FileSystem::CreateDirectory(m_Directory.c_str()))
+                    LOG_ERROR_AND_THROW("Failed to create bytecode cache directory '", m_Directory, "'.");
+            }
+            if (!FileSystem::IsSlash(m_Directory.back()))
+                m_Directory.push_back(FileSystem::SlashSymbol);
+
+            m_TempFileId = std::random_device{}();
+        }
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_BytecodeCache, TBase);
@@ -113,7 +165,10 @@ public:
 
             RefCntAutoPtr<DataBlobImpl> pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
             Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
-            m_HashMap.emplace(ElementHeader.Hash, pBytecode);
+            if (IsDirectoryBacked())
+                WriteEntryFile(ElementHeader.Hash, pBytecode);
+            else
+                m_HashMap.emplace(ElementHeader.Hash, pBytecode);
         }
 
         return true;
@@ -125,6 +180,20 @@ public:
         DEV_CHECK_ERR(*ppByteCode == nullptr, "*ppByteCode is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
         const XXH128Hash Hash = ComputeHash(ShaderCI);
 
+        if (IsDirectoryBacked())
+        {
+            const std::string EntryPath = GetEntryFilePath(Hash);
+
+            RefCntAutoPtr<IDataBlob> pBytecode = ReadEntryFile(EntryPath.c_str(), &Hash);
+            if (pBytecode)
+            {
+                // Mark the entry as recently used
+                FileSystem::TouchFile(EntryPath.c_str());
+                *ppByteCode = pBytecode.Detach();
+            }
+            return;
+        }
+
         const auto Iter = m_HashMap.find(Hash);
         if (Iter != m_HashMap.end())
         {
@@ -138,6 +207,12 @@ public:
         DEV_CHECK_ERR(pByteCode != nullptr, "pByteCode must not be null.");
         const XXH128Hash Hash = ComputeHash(ShaderCI);
 
+        if (IsDirectoryBacked())
+        {
+            WriteEntryFile(Hash, pByteCode);
+            return;
+        }
+
         const auto Iter = m_HashMap.emplace(Hash, pByteCode);
         if (!Iter.second)
             Iter.first->second = pByteCode;
@@ -146,6 +221,15 @@ public:
     virtual void DILIGENT_CALL_TYPE RemoveBytecode(const ShaderCreateInfo& ShaderCI) override final
     {
         const XXH128Hash Hash = ComputeHash(ShaderCI);
+
+        if (IsDirectoryBacked())
+        {
+            const std::string EntryPath = GetEntryFilePath(Hash);
+            if (FileSystem::FileExists(EntryPath.c_str()))
+                FileSystem::DeleteFile(EntryPath.c_str());
+            return;
+        }
+
         m_HashMap.erase(Hash);
     }
 
@@ -154,13 +238,31 @@ public:
         DEV_CHECK_ERR(ppDataBlob != nullptr, "ppDataBlob must not be null.");
         DEV_CHECK_ERR(*ppDataBlob == nullptr, "*ppDataBlob is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
 
+        std::vector<std::pair<XXH128Hash, RefCntAutoPtr<IDataBlob>>> Entries;
+        if (IsDirectoryBacked())
+        {
+            for (const FindFileData& File : FileSystem::Search((m_Directory + '*' + BytecodeCacheEntryFileExtension).c_str()))
+            {
+                if (File.IsDirectory)
+                    continue;
+
+                XXH128Hash Hash;
+                if (RefCntAutoPtr<IDataBlob> pBytecode = ReadEntryFile((m_Directory + File.Name).c_str(), nullptr, &Hash))
+                    Entries.emplace_back(Hash, std::move(pBytecode));
+            }
+        }
+        else
+        {
+            Entries.assign(m_HashMap.begin(), m_HashMap.end());
+        }
+
         auto WriteData = [&](auto& Stream) //
         {
             BytecodeCacheHeader Header{};
-            Header.ElementCount = m_HashMap.size();
+            Header.ElementCount = Entries.size();
             Header.Serialize(Stream);
 
-            for (auto const& Pair : m_HashMap)
+            for (auto const& Pair : Entries)
             {
                 const RefCntAutoPtr<IDataBlob>& pBytecode = Pair.second;
 
@@ -187,6 +289,19 @@ public:
 
     virtual void DILIGENT_CALL_TYPE Clear() override final
     {
+        if (IsDirectoryBacked())
+        {
+            for (const FindFileData& File : FileSystem::Search((m_Directory + '*' + BytecodeCacheEntryFileExtension).c_str()))
+            {
+                if (!File.IsDirectory)
+                    FileSystem::DeleteFile((m_Directory + File.Name).c_str());
+            }
+
+            std::lock_guard<std::mutex> Lock{m_DirectorySizeMtx};
+            m_DirectorySize = ~Uint64{0};
+            return;
+        }
+
         m_HashMap.clear();
     }
 
@@ -198,10 +313,182 @@ private:
         return Hasher.Digest();
     }
 
+    bool IsDirectoryBacked() const
+    {
+        return !m_Directory.empty();
+    }
+
+    std::string GetEntryFilePath(const XXH128Hash& Hash) const
+    {
+        static constexpr char HexDigits[] = "0123456789abcdef";
+
+        std::string Path = m_Directory;
+        for (Uint64 Part : {Hash.HighPart, Hash.LowPart})
+        {
+            for (int Shift = 60; Shift >= 0; Shift -= 4)
+                Path.push_back(HexDigits[(Part >> Shift) & 0xF]);
+        }
+        Path += BytecodeCacheEntryFileExtension;
+        return Path;
+    }
+
+    // Reads the entry file. If pExpectedHash is not null, the hash stored in the file must match it.
+    RefCntAutoPtr<IDataBlob> ReadEntryFile(const char* Path, const XXH128Hash* pExpectedHash, XXH128Hash* pHash = nullptr) const
+    {
+        // The file may be removed by another process at any time, so a missing file is not an error
+        if (!FileSystem::FileExists(Path))
+            return {};
+
+        RefCntAutoPtr<IDataBlob> pFileData;
+        if (!FileWrapper::ReadWholeFile(Path, &pFileData, /*Silent = */ true))
+            return {};
+
+        Serializer<SerializerMode::Read> Stream{SerializedData{pFileData->GetDataPtr(), pFileData->GetSize()}};
+
+        BytecodeCacheFileHeader Header;
+        if (!Header.Serialize(Stream) ||
+            Header.Magic != BytecodeCacheFileHeader::HeaderMagic ||
+            Header.Version != BytecodeCacheFileHeader::HeaderVersion ||
+            (pExpectedHash != nullptr && Header.Element.Hash != *pExpectedHash))
+        {
+            LOG_WARNING_MESSAGE("Bytecode cache file '", Path, "' is invalid or was created by an incompatible version and will be ignored.");
+            return {};
+        }
+
+        if (Stream.GetRemainingSize() != Header.Element.DataSize)
+        {
+            LOG_WARNING_MESSAGE("Bytecode cache file '", Path, "' is truncated and will be ignored.");
+            return {};
+        }
+
+        if (pHash != nullptr)
+            *pHash = Header.Element.Hash;
+
+        const Uint8* pData = static_cast<const Uint8*>(pFileData->GetConstDataPtr()) + Stream.GetSize();
+        return RefCntAutoPtr<IDataBlob>{DataBlobImpl::Create(Header.Element.DataSize, pData)};
+    }
+
+    void WriteEntryFile(const XXH128Hash& Hash, const IDataBlob* pBytecode)
+    {
+        BytecodeCacheFileHeader Header;
+        Header.Element.Hash     = Hash;
+        Header.Element.DataSize = pBytecode->GetSize();
+
+        Serializer<SerializerMode::Measure> MeasureStream{};
+        Header.Serialize(MeasureStream);
+        const size_t HeaderSize = MeasureStream.GetSize();
+
+        std::vector<Uint8> FileData(HeaderSize + Header.Element.DataSize);
+        {
+            Serializer<SerializerMode::Write> WriteStream{SerializedData{FileData.data(), HeaderSize}};
+            Header.Serialize(WriteStream);
+            VERIFY_EXPR(WriteStream.IsEnded());
+        }
+        if (Header.Element.DataSize > 0)
+            memcpy(&FileData[HeaderSize], pBytecode->GetConstDataPtr(), Header.Element.DataSize);
+
+        // Write the data to a temporary file first and then rename it, so that other processes
+        // never read a partially written entry.
+        const std::string EntryPath = GetEntryFilePath(Hash);
+        const std::string TempPath  = EntryPath + '.' + std::to_string(m_TempFileId) + '.' + std::to_string(m_TempFileCounter.fetch_add(1)) + ".tmp";
+        if (!FileWrapper::WriteFile(TempPath.c_str(), FileData.data(), FileData.size(), /*Silent = */ true))
+        {
+            LOG_WARNING_MESSAGE("Failed to write bytecode cache file '", TempPath, "'.");
+            if (FileSystem::FileExists(TempPath.c_str()))
+                FileSystem::DeleteFile(TempPath.c_str());
+            return;
+        }
+
+        if (!FileSystem::RenameFile(TempPath.c_str(), EntryPath.c_str()))
+        {
+            // The entry may be open by another process. It was created for the same shader,
+            // so keeping the existing file is fine.
+            FileSystem::DeleteFile(TempPath.c_str());
+            return;
+        }
+
+        if (m_MaxDirectorySize != 0)
+            OnEntryAdded(EntryPath, FileData.size());
+    }
+
+    void OnEntryAdded(const std::string& EntryPath, Uint64 EntrySize)
+    {
+        std::lock_guard<std::mutex> Lock{m_DirectorySizeMtx};
+
+        // The directory is shared with other processes, so the size tracked by this instance is
+        // only an estimate. Rescan the directory when the estimate exceeds the limit.
+        if (m_DirectorySize != ~Uint64{0})
+            m_DirectorySize += EntrySize;
+
+        if (m_DirectorySize == ~Uint64{0} || m_DirectorySize > m_MaxDirectorySize)
+            m_DirectorySize = TrimDirectory(EntryPath);
+    }
+
+    // Removes the least recently used entries until the directory size drops below the target
+    // size and returns the resulting directory size. The entry at KeepPath that has just been
+    // written is never removed as file times may have coarse resolution.
+    Uint64 TrimDirectory(const std::string& KeepPath) const
+    {
+        struct EntryInfo
+        {
+            std::string Path;
+            FileInfo    Info;
+        };
+        std::vector<EntryInfo> Entries;
+
+        Uint64 TotalSize = 0;
+        for (const FindFileData& File : FileSystem::Search((m_Directory + '*' + BytecodeCacheEntryFileExtension).c_str()))
+        {
+            if (File.IsDirectory)
+                continue;
+
+            EntryInfo Entry{m_Directory + File.Name, {}};
+            if (!FileSystem::GetFileInfo(Entry.Path.c_str(), Entry.Info))
+                continue;
+
+            TotalSize += Entry.Info.Size;
+            Entries.emplace_back(std::move(Entry));
+        }
+
+        if (TotalSize <= m_MaxDirectorySize)
+            return TotalSize;
+
+        std::sort(Entries.begin(), Entries.end(),
+                  [](const EntryInfo& LHS, const EntryInfo& RHS) {
+                      return LHS.Info.LastWriteTime < RHS.Info.LastWriteTime;
+                  });
+
+        const Uint64 TargetSize = m_MaxDirectorySize / 100 * TrimTargetPercent;
+        for (const EntryInfo& Entry : Entries)
+        {
+            if (TotalSize <= TargetSize)
+                break;
+            if (Entry.Path == KeepPath)
+                continue;
+
+            // The entry may have already been removed by another process
+            if (FileSystem::FileExists(Entry.Path.c_str()))
+                FileSystem::DeleteFile(Entry.Path.c_str());
+            TotalSize -= Entry.Info.Size;
+        }
+
+        return TotalSize;
+    }
+
 private:
     RENDER_DEVICE_TYPE m_DeviceType;
 
     std::unordered_map<XXH128Hash, RefCntAutoPtr<IDataBlob>> m_HashMap;
+
+    // Cache directory with the trailing slash, or empty string if the cache is kept in memory
+    std::string  m_Directory;
+    const Uint64 m_MaxDirectorySize;
+
+    // Unique id of this instance used to name temporary files
+    Uint32               m_TempFileId = 0;
+    std::atomic<Uint32>  m_TempFileCounter{0};
+    std::mutex           m_DirectorySizeMtx;
+    Uint64               m_DirectorySize = ~Uint64{0}; // ~0 if unknown
 };
 
 void CreateBytecodeCache(const BytecodeCacheCreateInfo& CreateInfo,
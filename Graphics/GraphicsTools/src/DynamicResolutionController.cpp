@@ -0,0 +1,368 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "DynamicResolutionController.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "CommonlyUsedStates.h"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr char UpscaleVS[] = R"(
+void main(in  uint   VertID : SV_VertexID,
+          out float4 Pos    : SV_Position,
+          out float2 UV     : TEX_COORD)
+{
+    // Full-screen triangle
+    UV  = float2(float((VertID << 1u) & 2u), float(VertID & 2u));
+    Pos = float4(UV * float2(2.0, -2.0) + float2(-1.0, 1.0), 0.0, 1.0);
+}
+)";
+
+constexpr char UpscalePS[] = R"(
+cbuffer cbUpscaleAttribs
+{
+    float2 g_UVScale;
+    // Keeps the bilinear footprint inside the render area
+    float2 g_MaxUV;
+}
+
+Texture2D    g_Color;
+SamplerState g_Color_sampler;
+
+float4 main(in float4 Pos : SV_Position,
+            in float2 UV  : TEX_COORD) : SV_Target
+{
+    return g_Color.SampleLevel(g_Color_sampler, min(UV * g_UVScale, g_MaxUV), 0.0);
+}
+)";
+
+struct UpscaleAttribs
+{
+    float2 UVScale;
+    float2 MaxUV;
+};
+static_assert(sizeof(UpscaleAttribs) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+RefCntAutoPtr<IShader> CreateUpscaleShader(IRenderDevice* pDevice, const char* Name, SHADER_TYPE Type, const char* Source)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc           = {Name, Type, true};
+    ShaderCI.Source         = Source;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+
+    RefCntAutoPtr<IShader> pShader;
+    pDevice->CreateShader(ShaderCI, &pShader);
+    if (!pShader)
+        LOG_ERROR_MESSAGE("Failed to create shader '", Name, "'");
+    return pShader;
+}
+
+} // namespace
+
+DynamicResolutionScaler::DynamicResolutionScaler(const DynamicResolutionScalerDesc& Desc) :
+    m_Desc{Desc}
+{
+    DEV_CHECK_ERR(m_Desc.TargetFrameTime > 0, "Target frame time must be positive");
+    DEV_CHECK_ERR(m_Desc.MinScale > 0 && m_Desc.MinScale <= m_Desc.MaxScale, "Minimum scale must be positive and not greater than the maximum scale");
+    DEV_CHECK_ERR(m_Desc.IncreaseThreshold < m_Desc.DecreaseThreshold, "Increase threshold must be less than the decrease threshold");
+    DEV_CHECK_ERR(m_Desc.SmoothingFactor > 0 && m_Desc.SmoothingFactor <= 1, "Smoothing factor must be in the range (0, 1]");
+    m_Scale = m_Desc.MaxScale;
+}
+
+float DynamicResolutionScaler::QuantizeScale(float Scale) const
+{
+    if (m_Desc.ScaleStep > 0)
+        Scale = std::round(Scale / m_Desc.ScaleStep) * m_Desc.ScaleStep;
+    return std::min(std::max(Scale, m_Desc.MinScale), m_Desc.MaxScale);
+}
+
+void DynamicResolutionScaler::Reset()
+{
+    m_FilteredFrameTime = 0;
+    m_NumOverBudget     = 0;
+    m_NumUnderBudget    = 0;
+}
+
+void DynamicResolutionScaler::SetScale(float Scale)
+{
+    m_Scale = std::min(std::max(Scale, m_Desc.MinScale), m_Desc.MaxScale);
+    Reset();
+}
+
+bool DynamicResolutionScaler::Update(double FrameTime)
+{
+    if (!(FrameTime > 0))
+        return false;
+
+    m_FilteredFrameTime = m_FilteredFrameTime > 0 ?
+        m_FilteredFrameTime + (FrameTime - m_FilteredFrameTime) * m_Desc.SmoothingFactor :
+        FrameTime;
+
+    if (m_FilteredFrameTime > m_Desc.TargetFrameTime * m_Desc.DecreaseThreshold)
+    {
+        ++m_NumOverBudget;
+        m_NumUnderBudget = 0;
+    }
+    else if (m_FilteredFrameTime < m_Desc.TargetFrameTime * m_Desc.IncreaseThreshold)
+    {
+        ++m_NumUnderBudget;
+        m_NumOverBudget = 0;
+    }
+    else
+    {
+        // Inside the hysteresis band
+        m_NumOverBudget  = 0;
+        m_NumUnderBudget = 0;
+    }
+
+    float NewScale = m_Scale;
+    if (m_NumOverBudget >= std::max(m_Desc.NumFramesToDecrease, 1u))
+    {
+        // Aim at the middle of the hysteresis band, assuming that the frame time is proportional to the pixel count
+        const double GoalFrameTime = m_Desc.TargetFrameTime * (m_Desc.DecreaseThreshold + m_Desc.IncreaseThreshold) * 0.5;
+        const float  IdealScale    = static_cast<float>(m_Scale * std::sqrt(GoalFrameTime / m_FilteredFrameTime));
+        // Decrease by at least one step
+        NewScale = std::min(QuantizeScale(IdealScale), QuantizeScale(m_Scale - m_Desc.ScaleStep));
+        m_NumOverBudget = 0;
+    }
+    else if (m_NumUnderBudget >= std::max(m_Desc.NumFramesToIncrease, 1u))
+    {
+        // Increase by one step at a time, since overshooting the budget is worse than a slow recovery
+        NewScale         = QuantizeScale(m_Scale + m_Desc.ScaleStep);
+        m_NumUnderBudget = 0;
+    }
+
+    if (std::abs(NewScale - m_Scale) < 1e-6f)
+        return false;
+
+    m_Scale = NewScale;
+    // The filtered frame time was measured at the old scale
+    Reset();
+    return true;
+}
+
+
+DynamicResolutionController::DynamicResolutionController(IRenderDevice* pDevice, const DynamicResolutionControllerCreateInfo& CI) :
+    m_pDevice{pDevice},
+    m_MaxWidth{CI.MaxWidth},
+    m_MaxHeight{CI.MaxHeight},
+    m_Scaler{CI.Scaler}
+{
+    DEV_CHECK_ERR(m_MaxWidth > 0 && m_MaxHeight > 0, "Maximum render size must not be zero");
+    DEV_CHECK_ERR(CI.ColorFormat != TEX_FORMAT_UNKNOWN, "Color format must not be unknown");
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Dynamic resolution color";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = m_MaxWidth;
+    TexDesc.Height    = m_MaxHeight;
+    TexDesc.Format    = CI.ColorFormat;
+    TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    m_pDevice->CreateTexture(TexDesc, nullptr, &m_pColor);
+    DEV_CHECK_ERR(m_pColor, "Failed to create the color texture");
+
+    if (CI.DepthFormat != TEX_FORMAT_UNKNOWN)
+    {
+        TexDesc.Name      = "Dynamic resolution depth";
+        TexDesc.Format    = CI.DepthFormat;
+        TexDesc.BindFlags = BIND_DEPTH_STENCIL | BIND_SHADER_RESOURCE;
+        m_pDevice->CreateTexture(TexDesc, nullptr, &m_pDepth);
+        DEV_CHECK_ERR(m_pDepth, "Failed to create the depth texture");
+    }
+
+    if (m_pDevice->GetDeviceInfo().Features.TimestampQueries)
+        m_pDurationQueries = std::make_unique<DurationQueryHelper>(m_pDevice, 4);
+
+    CreateUniformBuffer(m_pDevice, sizeof(UpscaleAttribs), "Dynamic resolution upscale attribs", &m_pConstants);
+    m_pUpscaleVS = CreateUpscaleShader(m_pDevice, "Dynamic resolution upscale VS", SHADER_TYPE_VERTEX, UpscaleVS);
+    m_pUpscalePS = CreateUpscaleShader(m_pDevice, "Dynamic resolution upscale PS", SHADER_TYPE_PIXEL, UpscalePS);
+
+    UpdateRenderSize();
+}
+
+DynamicResolutionController::~DynamicResolutionController()
+{
+}
+
+void DynamicResolutionController::UpdateRenderSize()
+{
+    const float Scale = m_Scaler.GetScale();
+    m_RenderWidth     = std::min(std::max(static_cast<Uint32>(std::round(static_cast<float>(m_MaxWidth) * Scale)), 1u), m_MaxWidth);
+    m_RenderHeight    = std::min(std::max(static_cast<Uint32>(std::round(static_cast<float>(m_MaxHeight) * Scale)), 1u), m_MaxHeight);
+}
+
+float2 DynamicResolutionController::GetUVScale() const
+{
+    return float2{
+        static_cast<float>(m_RenderWidth) / static_cast<float>(m_MaxWidth),
+        static_cast<float>(m_RenderHeight) / static_cast<float>(m_MaxHeight),
+    };
+}
+
+void DynamicResolutionController::SetScale(float Scale)
+{
+    m_Scaler.SetScale(Scale);
+    m_NumStaleFrames = m_NumPendingFrames;
+    UpdateRenderSize();
+}
+
+void DynamicResolutionController::BeginFrame(IDeviceContext* pCtx)
+{
+    if (m_pDurationQueries)
+        m_pDurationQueries->Begin(pCtx);
+}
+
+bool DynamicResolutionController::EndFrame(IDeviceContext* pCtx)
+{
+    if (!m_pDurationQueries)
+        return false;
+
+    ++m_NumPendingFrames;
+
+    double FrameTime = 0;
+    if (!m_pDurationQueries->End(pCtx, FrameTime))
+        return false;
+
+    VERIFY_EXPR(m_NumPendingFrames > 0);
+    --m_NumPendingFrames;
+    m_LastFrameTime = FrameTime;
+
+    if (m_NumStaleFrames > 0)
+    {
+        // The frame was rendered at the previous scale
+        --m_NumStaleFrames;
+        return false;
+    }
+
+    if (!m_Scaler.Update(FrameTime))
+        return false;
+
+    m_NumStaleFrames = m_NumPendingFrames;
+    UpdateRenderSize();
+    return true;
+}
+
+void DynamicResolutionController::SetRenderTargets(IDeviceContext* pCtx, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    ITextureView* pRTV = m_pColor->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    ITextureView* pDSV = m_pDepth ? m_pDepth->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL) : nullptr;
+    pCtx->SetRenderTargets(1, &pRTV, pDSV, StateTransitionMode);
+
+    const Viewport VP = GetViewport();
+    pCtx->SetViewports(1, &VP, m_MaxWidth, m_MaxHeight);
+
+    const Rect Scissor{0, 0, static_cast<Int32>(m_RenderWidth), static_cast<Int32>(m_RenderHeight)};
+    pCtx->SetScissorRects(1, &Scissor, m_MaxWidth, m_MaxHeight);
+}
+
+const DynamicResolutionController::UpscalePipeline* DynamicResolutionController::GetUpscalePipeline(TEXTURE_FORMAT RTVFormat)
+{
+    auto it = m_UpscalePipelines.find(RTVFormat);
+    if (it != m_UpscalePipelines.end())
+        return it->second.pPSO ? &it->second : nullptr;
+
+    // Failed pipelines are also stored to not retry every frame
+    UpscalePipeline& Pipeline = m_UpscalePipelines[RTVFormat];
+    if (!m_pUpscaleVS || !m_pUpscalePS)
+        return nullptr;
+
+    const ImmutableSamplerDesc ImtblSamplers[] = {
+        {SHADER_TYPE_PIXEL, "g_Color", Sam_LinearClamp},
+    };
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                                = "Dynamic resolution upscale";
+    PSOCreateInfo.PSODesc.PipelineType                        = PIPELINE_TYPE_GRAPHICS;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType  = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+    PSOCreateInfo.PSODesc.ResourceLayout.ImmutableSamplers    = ImtblSamplers;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumImmutableSamplers = _countof(ImtblSamplers);
+
+    GraphicsPipelineDesc& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = RTVFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = false;
+
+    PSOCreateInfo.pVS = m_pUpscaleVS;
+    PSOCreateInfo.pPS = m_pUpscalePS;
+
+    m_pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &Pipeline.pPSO);
+    if (!Pipeline.pPSO)
+    {
+        LOG_ERROR_MESSAGE("Failed to create the dynamic resolution upscale pipeline for format ", GetTextureFormatAttribs(RTVFormat).Name);
+        return nullptr;
+    }
+
+    // The color texture never changes, so all resources are static
+    if (IShaderResourceVariable* pVar = Pipeline.pPSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbUpscaleAttribs"))
+        pVar->Set(m_pConstants);
+    if (IShaderResourceVariable* pVar = Pipeline.pPSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "g_Color"))
+        pVar->Set(m_pColor->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    Pipeline.pPSO->CreateShaderResourceBinding(&Pipeline.pSRB, true);
+
+    return &Pipeline;
+}
+
+void DynamicResolutionController::Upscale(IDeviceContext* pCtx, ITextureView* pDstRTV)
+{
+    DEV_CHECK_ERR(pDstRTV != nullptr, "Destination render target view must not be null");
+
+    const UpscalePipeline* pPipeline = GetUpscalePipeline(pDstRTV->GetDesc().Format);
+    if (pPipeline == nullptr || !pPipeline->pSRB)
+        return;
+
+    {
+        MapHelper<UpscaleAttribs> Attribs{pCtx, m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+        Attribs->UVScale = GetUVScale();
+        // Clamp to the center of the last rendered texel, so that the bilinear filter
+        // does not fetch the stale texels outside of the render area
+        Attribs->MaxUV = float2{
+            (static_cast<float>(m_RenderWidth) - 0.5f) / static_cast<float>(m_MaxWidth),
+            (static_cast<float>(m_RenderHeight) - 0.5f) / static_cast<float>(m_MaxHeight),
+        };
+    }
+
+    pCtx->SetRenderTargets(1, &pDstRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->SetPipelineState(pPipeline->pPSO);
+    pCtx->CommitShaderResources(pPipeline->pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+}
+
+} // namespace Diligent
@@ -73,7 +73,8 @@ bool VerifySparseTextureCompatibility(IRenderDevice* pDevice, const TextureDesc&
 DynamicTextureArray::DynamicTextureArray(IRenderDevice* pDevice, const DynamicTextureArrayCreateInfo& CreateInfo) :
     m_Name{CreateInfo.Desc.Name != nullptr ? CreateInfo.Desc.Name : "Dynamic Texture"},
     m_Desc{CreateInfo.Desc},
-    m_NumSlicesInPage{std::max(CreateInfo.NumSlicesInMemoryPage, 1u)}
+    m_NumSlicesInPage{std::max(CreateInfo.NumSlicesInMemoryPage, 1u)},
+    m_NumSlicesInTexturePage{CreateInfo.NumSlicesInTexturePage}
 {
     m_Desc.Name = m_Name.c_str();
 
@@ -232,6 +233,13 @@ void DynamicTextureArray::CreateResources(IRenderDevice* pDevice)
     }
 
     // NB: m_Desc.Usage may be changed by CreateSparseTexture()
+    if (IsPaged())
+    {
+        // Pages are created by ResizePages(), which also updates the version
+        ResizePages(pDevice, false /*AllowNull*/);
+        return;
+    }
+
     if (m_Desc.Usage == USAGE_DEFAULT && m_PendingSize > 0)
     {
         TextureDesc Desc = m_Desc;
@@ -408,11 +416,68 @@ void DynamicTextureArray::ResizeDefaultTexture(IDeviceContext* pContext)
     m_pStaleTexture.Release();
 }
 
+void DynamicTextureArray::ResizePages(IRenderDevice* pDevice, bool AllowNull)
+{
+    VERIFY_EXPR(IsPaged());
+
+    const size_t NumPages = (size_t{m_PendingSize} + m_NumSlicesInTexturePage - 1) / m_NumSlicesInTexturePage;
+    if (NumPages > m_Pages.size())
+    {
+        if (pDevice == nullptr)
+        {
+            DEV_CHECK_ERR(AllowNull, "Dynamic texture array must be expanded, but pDevice is null");
+            return;
+        }
+
+        // Existing pages are left intact, so no copies are needed
+        TextureDesc PageDesc = m_Desc;
+        PageDesc.ArraySize   = m_NumSlicesInTexturePage;
+        m_Pages.reserve(NumPages);
+        while (m_Pages.size() < NumPages)
+        {
+            const std::string PageName = m_Name + " - page " + std::to_string(m_Pages.size());
+            PageDesc.Name              = PageName.c_str();
+
+            RefCntAutoPtr<ITexture> pPage;
+            pDevice->CreateTexture(PageDesc, nullptr, &pPage);
+            if (!pPage)
+            {
+                DEV_ERROR("Failed to create page ", m_Pages.size(), " of dynamic texture array '", m_Name, "'");
+                break;
+            }
+            m_Pages.emplace_back(std::move(pPage));
+        }
+        m_Version.fetch_add(1);
+    }
+    else if (NumPages < m_Pages.size())
+    {
+        m_Pages.resize(NumPages);
+        m_Version.fetch_add(1);
+    }
+
+    const Uint32 NumSlices = std::min(m_PendingSize, static_cast<Uint32>(m_Pages.size()) * m_NumSlicesInTexturePage);
+    if (m_Desc.ArraySize != NumSlices)
+    {
+        m_Desc.ArraySize = NumSlices;
+        LOG_INFO_MESSAGE("Dynamic texture array: resizing paged texture '", m_Desc.Name,
+                         "' (", m_Desc.Width, " x ", m_Desc.Height, " ", m_Desc.MipLevels, "-mip ",
+                         GetTextureFormatAttribs(m_Desc.Format).Name, ") to ",
+                         m_Desc.ArraySize, " slices in ", m_Pages.size(), " pages. Version: ", GetVersion());
+    }
+}
+
+void DynamicTextureArray::GetPageViews(TEXTURE_VIEW_TYPE ViewType, std::vector<IDeviceObject*>& Views) const
+{
+    Views.reserve(Views.size() + m_Pages.size());
+    for (const RefCntAutoPtr<ITexture>& pPage : m_Pages)
+        Views.push_back(pPage->GetDefaultView(ViewType));
+}
+
 void DynamicTextureArray::CommitResize(IRenderDevice*  pDevice,
                                        IDeviceContext* pContext,
                                        bool            AllowNull)
 {
-    if (!m_pTexture && m_PendingSize > 0)
+    if (!m_pTexture && m_Pages.empty() && m_PendingSize > 0)
     {
         if (pDevice != nullptr)
             CreateResources(pDevice);
@@ -420,6 +485,14 @@ void DynamicTextureArray::CommitResize(IRenderDevice*  pDevice,
             DEV_CHECK_ERR(AllowNull, "Dynamic texture array must be initialized, but pDevice is null");
     }
 
+    if (IsPaged())
+    {
+        // Paged arrays never copy slices, so the device context is not needed
+        if (m_Desc.ArraySize != m_PendingSize)
+            ResizePages(pDevice, AllowNull);
+        return;
+    }
+
     if (m_pTexture && m_Desc.ArraySize != m_PendingSize)
     {
         if (pContext != nullptr)
@@ -452,7 +525,7 @@ ITexture* DynamicTextureArray::Resize(IRenderDevice*  pDevice,
     {
         m_PendingSize = NewArraySize;
 
-        if (m_Desc.Usage != USAGE_SPARSE)
+        if (m_Desc.Usage != USAGE_SPARSE && !IsPaged())
         {
             if (!m_pStaleTexture)
                 m_pStaleTexture = std::move(m_pTexture);
@@ -479,7 +552,7 @@ ITexture* DynamicTextureArray::Resize(IRenderDevice*  pDevice,
 
     CommitResize(pDevice, pContext, true /*AllowNull*/);
 
-    return m_pTexture;
+    return GetTexture();
 }
 
 ITexture* DynamicTextureArray::Update(IRenderDevice*  pDevice,
@@ -495,7 +568,7 @@ ITexture* DynamicTextureArray::Update(IRenderDevice*  pDevice,
         pContext->DeviceWaitForFence(m_pAfterResizeFence, m_LastAfterResizeFenceValue);
     }
 
-    return m_pTexture;
+    return GetTexture();
 }
 
 Uint64 DynamicTextureArray::GetMemoryUsage() const
@@ -510,7 +583,7 @@ Uint64 DynamicTextureArray::GetMemoryUsage() const
         for (Uint32 mip = 0; mip < m_Desc.MipLevels; ++mip)
             MemUsage += GetMipLevelProperties(m_Desc, mip).MipSize;
 
-        MemUsage *= m_Desc.ArraySize;
+        MemUsage *= IsPaged() ? Uint64{m_NumSlicesInTexturePage} * m_Pages.size() : m_Desc.ArraySize;
     }
     return MemUsage;
 }
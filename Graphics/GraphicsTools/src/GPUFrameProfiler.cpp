@@ -0,0 +1,292 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GPUFrameProfiler.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 InvalidScopeIdx = ~0u;
+
+double TimestampToSeconds(const QueryDataTimestamp& Data)
+{
+    return static_cast<double>(Data.Counter) / static_cast<double>(Data.Frequency);
+}
+
+void AppendJsonString(std::string& Json, const Char* Str)
+{
+    Json += '"';
+    for (const Char* c = Str; c != nullptr && *c != '\0'; ++c)
+    {
+        switch (*c)
+        {
+            case '"': Json += "\\\""; break;
+            case '\\': Json += "\\\\"; break;
+            case '\n': Json += "\\n"; break;
+            case '\t': Json += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) >= 0x20)
+                    Json += *c;
+        }
+    }
+    Json += '"';
+}
+
+} // namespace
+
+GPUFrameProfiler::GPUFrameProfiler(IRenderDevice* pDevice, const GPUFrameProfilerCreateInfo& CI) :
+    m_pDevice{pDevice},
+    m_CI{CI}
+{
+    VERIFY_EXPR(m_pDevice != nullptr);
+    m_FrameSlots.resize(std::max(m_CI.NumFramesInFlight, 1u));
+    for (FrameSlot& Slot : m_FrameSlots)
+    {
+        Slot.Queries.resize(2 * (size_t{m_CI.MaxScopesPerFrame} + 1));
+        Slot.Scopes.reserve(m_CI.MaxScopesPerFrame);
+    }
+    m_QueryData.resize(2 * (size_t{m_CI.MaxScopesPerFrame} + 1));
+    m_OpenScopes.reserve(32);
+}
+
+IQuery* GPUFrameProfiler::GetQuery(FrameSlot& Slot, size_t Idx)
+{
+    RefCntAutoPtr<IQuery>& pQuery = Slot.Queries[Idx];
+    if (!pQuery)
+    {
+        // Queries are created on first use so that the profiler does not
+        // allocate more queries than the application actually needs.
+        QueryDesc queryDesc{QUERY_TYPE_TIMESTAMP};
+        queryDesc.Name = "GPU frame profiler timestamp query";
+        m_pDevice->CreateQuery(queryDesc, &pQuery);
+        VERIFY(pQuery, "Failed to create timestamp query");
+    }
+    return pQuery;
+}
+
+void GPUFrameProfiler::BeginFrame(IDeviceContext* pCtx)
+{
+    DEV_CHECK_ERR(m_pCurrFrame == nullptr, "BeginFrame() must not be called twice without EndFrame()");
+
+    // Resolve frames in the order they were recorded and stop at the first
+    // frame whose results are not yet available.
+    while (m_OldestPendingFrame < m_FrameNumber)
+    {
+        FrameSlot& Slot = m_FrameSlots[m_OldestPendingFrame % m_FrameSlots.size()];
+        if (Slot.IsPending && Slot.FrameNumber == m_OldestPendingFrame)
+        {
+            if (!ResolveFrame(Slot))
+                break;
+        }
+        ++m_OldestPendingFrame;
+    }
+
+    FrameSlot& Slot = m_FrameSlots[m_FrameNumber % m_FrameSlots.size()];
+    if (!Slot.IsPending)
+    {
+        Slot.FrameNumber = m_FrameNumber;
+        Slot.CPUStart    = m_Timer.GetElapsedTime();
+        Slot.Scopes.clear();
+        pCtx->EndQuery(GetQuery(Slot, 0));
+        m_pCurrFrame = &Slot;
+    }
+    else
+    {
+        // Never wait for the GPU
+        ++m_NumSkippedFrames;
+    }
+
+    ++m_FrameNumber;
+}
+
+void GPUFrameProfiler::EndFrame(IDeviceContext* pCtx)
+{
+    if (!m_OpenScopes.empty())
+    {
+        LOG_ERROR_MESSAGE("There are ", m_OpenScopes.size(), " open scope(s) at the end of the frame, which indicates inconsistent BeginScope()/EndScope() calls");
+        for (size_t i = 0; i < m_OpenScopes.size(); ++i)
+        {
+            if (m_CI.InsertDebugGroups)
+                pCtx->EndDebugGroup();
+        }
+        m_OpenScopes.clear();
+
+        // The frame contains scopes without end queries and can't be resolved
+        m_pCurrFrame = nullptr;
+        return;
+    }
+
+    if (m_pCurrFrame == nullptr)
+        return;
+
+    pCtx->EndQuery(GetQuery(*m_pCurrFrame, 1));
+    m_pCurrFrame->CPUEnd    = m_Timer.GetElapsedTime();
+    m_pCurrFrame->IsPending = true;
+    m_pCurrFrame            = nullptr;
+}
+
+void GPUFrameProfiler::BeginScope(IDeviceContext* pCtx, const Char* Name, const float* pColor)
+{
+    VERIFY_EXPR(pCtx != nullptr && Name != nullptr);
+
+    if (m_CI.InsertDebugGroups)
+        pCtx->BeginDebugGroup(Name, pColor);
+
+    Uint32 ScopeIdx = InvalidScopeIdx;
+    if (m_pCurrFrame != nullptr && m_pCurrFrame->Scopes.size() < m_CI.MaxScopesPerFrame)
+    {
+        ScopeIdx = static_cast<Uint32>(m_pCurrFrame->Scopes.size());
+
+        m_pCurrFrame->Scopes.emplace_back();
+        ScopeRecord& Scope = m_pCurrFrame->Scopes.back();
+
+        Scope.Name     = Name;
+        Scope.Depth    = static_cast<Uint32>(m_OpenScopes.size());
+        Scope.CPUStart = m_Timer.GetElapsedTime();
+        pCtx->EndQuery(GetQuery(*m_pCurrFrame, 2 + 2 * size_t{ScopeIdx}));
+    }
+    m_OpenScopes.push_back(ScopeIdx);
+}
+
+void GPUFrameProfiler::EndScope(IDeviceContext* pCtx)
+{
+    if (m_OpenScopes.empty())
+    {
+        LOG_ERROR_MESSAGE("There are no open scopes, which likely indicates inconsistent BeginScope()/EndScope() calls");
+        return;
+    }
+
+    const Uint32 ScopeIdx = m_OpenScopes.back();
+    m_OpenScopes.pop_back();
+
+    if (ScopeIdx != InvalidScopeIdx && m_pCurrFrame != nullptr)
+    {
+        pCtx->EndQuery(GetQuery(*m_pCurrFrame, 3 + 2 * size_t{ScopeIdx}));
+        m_pCurrFrame->Scopes[ScopeIdx].CPUEnd = m_Timer.GetElapsedTime();
+    }
+
+    if (m_CI.InsertDebugGroups)
+        pCtx->EndDebugGroup();
+}
+
+bool GPUFrameProfiler::ResolveFrame(FrameSlot& Slot)
+{
+    VERIFY_EXPR(Slot.IsPending);
+
+    const size_t NumQueries = 2 + 2 * Slot.Scopes.size();
+    for (size_t i = 0; i < NumQueries; ++i)
+    {
+        // Do not invalidate the queries until all results are available
+        if (!Slot.Queries[i]->GetData(&m_QueryData[i], sizeof(QueryDataTimestamp), false))
+            return false;
+    }
+
+    for (size_t i = 0; i < NumQueries; ++i)
+        Slot.Queries[i]->Invalidate();
+    Slot.IsPending = false;
+
+    const double GPUFrameStart = TimestampToSeconds(m_QueryData[0]);
+    const double Offset        = GPUFrameStart - Slot.CPUStart;
+    if (!m_GPUToCPUOffsetInit || Offset < m_GPUToCPUOffset)
+    {
+        m_GPUToCPUOffset     = Offset;
+        m_GPUToCPUOffsetInit = true;
+    }
+
+    // Reuse the storage of the oldest frame in the history
+    FrameData Frame;
+    if (!m_ResolvedFrames.empty() && m_ResolvedFrames.size() >= std::max(m_CI.NumHistoryFrames, 1u))
+    {
+        Frame = std::move(m_ResolvedFrames.front());
+        m_ResolvedFrames.pop_front();
+    }
+
+    Frame.FrameNumber = Slot.FrameNumber;
+    Frame.CPUStart    = Slot.CPUStart;
+    Frame.CPUEnd      = Slot.CPUEnd;
+    Frame.GPUStart    = GPUFrameStart - m_GPUToCPUOffset;
+    Frame.GPUEnd      = TimestampToSeconds(m_QueryData[1]) - m_GPUToCPUOffset;
+
+    Frame.Ranges.resize(Slot.Scopes.size());
+    for (size_t i = 0; i < Slot.Scopes.size(); ++i)
+    {
+        const ScopeRecord& Scope = Slot.Scopes[i];
+        Range&             Dst   = Frame.Ranges[i];
+
+        Dst.Name     = Scope.Name;
+        Dst.Depth    = Scope.Depth;
+        Dst.CPUStart = Scope.CPUStart;
+        Dst.CPUEnd   = Scope.CPUEnd;
+        Dst.GPUStart = TimestampToSeconds(m_QueryData[2 + 2 * i]) - m_GPUToCPUOffset;
+        Dst.GPUEnd   = TimestampToSeconds(m_QueryData[3 + 2 * i]) - m_GPUToCPUOffset;
+    }
+    m_ResolvedFrames.emplace_back(std::move(Frame));
+
+    return true;
+}
+
+void GPUFrameProfiler::ExportChromeTrace(std::string& Json) const
+{
+    Json = "{\"traceEvents\":[";
+    Json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"CPU\"}},";
+    Json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,\"args\":{\"name\":\"GPU\"}}";
+
+    auto AddEvent = [&Json](const Char* Name, int Tid, double Start, double End) {
+        Json += ",{\"name\":";
+        AppendJsonString(Json, Name);
+        Json += ",\"ph\":\"X\",\"pid\":0,\"tid\":";
+        Json += std::to_string(Tid);
+        Json += ",\"ts\":";
+        Json += std::to_string(Start * 1e+6);
+        Json += ",\"dur\":";
+        Json += std::to_string(std::max(End - Start, 0.0) * 1e+6);
+        Json += '}';
+    };
+
+    for (const FrameData& Frame : m_ResolvedFrames)
+    {
+        const std::string FrameName = "Frame " + std::to_string(Frame.FrameNumber);
+        AddEvent(FrameName.c_str(), 0, Frame.CPUStart, Frame.CPUEnd);
+        AddEvent(FrameName.c_str(), 1, Frame.GPUStart, Frame.GPUEnd);
+        for (const Range& R : Frame.Ranges)
+        {
+            AddEvent(R.Name, 0, R.CPUStart, R.CPUEnd);
+            AddEvent(R.Name, 1, R.GPUStart, R.GPUEnd);
+        }
+    }
+
+    Json += "],\"displayTimeUnit\":\"ms\"}";
+}
+
+} // namespace Diligent
@@ -27,14 +27,27 @@
 
 #include <algorithm>
 #include <cmath>
-#include <limits>
 #include <atomic>
+#include <cstring>
 
 #include "GraphicsUtilities.h"
 #include "DebugUtilities.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ColorConversion.h"
 #include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_MIP_FILTER_NEON 1
+#elif DILIGENT_AVX2_SUPPORTED && (defined(_MSC_VER) || defined(__SSE2__))
+#    define DILIGENT_MIP_FILTER_SSE 1
+#endif
+
+#if DILIGENT_MIP_FILTER_SSE || DILIGENT_MIP_FILTER_NEON
+#    define DILIGENT_MIP_FILTER_SIMD 1
+#endif
 
 #define PI_F 3.1415926f
 
@@ -170,27 +183,90 @@ void GenerateCheckerBoardPattern(Uint32 Width, Uint32 Height, TEXTURE_FORMAT Fmt
 
 
 
-template <typename ChannelType>
-ChannelType SRGBAverage(ChannelType c0, ChannelType c1, ChannelType c2, ChannelType c3, Uint32 /*col*/, Uint32 /*row*/)
+Uint8 SRGBAverage(Uint8 c0, Uint8 c1, Uint8 c2, Uint8 c3, Uint32 /*col*/, Uint32 /*row*/)
+{
+    const float fLinearAverage = (GammaToLinear(c0) + GammaToLinear(c1) + GammaToLinear(c2) + GammaToLinear(c3)) * 0.25f;
+
+    Uint8 Gamma = 0;
+    LinearToGamma(&fLinearAverage, &Gamma, 1);
+    return Gamma;
+}
+
+float HalfToFloat(Uint16 h)
+{
+    static constexpr Uint32 ShiftedExp = 0x7C00u << 13;
+
+    Uint32       u   = (h & 0x7FFFu) << 13; // Exponent and mantissa
+    const Uint32 Exp = ShiftedExp & u;
+    u += (127 - 15) << 23; // Exponent adjustment
+
+    if (Exp == ShiftedExp)
+    {
+        // Inf/NaN
+        u += (128 - 16) << 23;
+    }
+    else if (Exp == 0)
+    {
+        // Zero/denormal
+        static constexpr Uint32 Magic = 113u << 23;
+
+        u += 1u << 23;
+        float f, fMagic;
+        memcpy(&f, &u, sizeof(f));
+        memcpy(&fMagic, &Magic, sizeof(fMagic));
+        f -= fMagic;
+        memcpy(&u, &f, sizeof(u));
+    }
+    u |= (h & 0x8000u) << 16; // Sign
+
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+Uint16 FloatToHalf(float f)
 {
-    static_assert(std::numeric_limits<ChannelType>::is_integer && !std::numeric_limits<ChannelType>::is_signed, "Unsigned integers are expected");
+    static constexpr Uint32 F32Infinity = 255u << 23;
+    static constexpr Uint32 F16Max      = (127u + 16u) << 23;
+    static constexpr Uint32 DenormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
 
-    static constexpr float MaxVal    = static_cast<float>(std::numeric_limits<ChannelType>::max());
-    static constexpr float MaxValInv = 1.f / MaxVal;
+    Uint32 u;
+    memcpy(&u, &f, sizeof(u));
 
-    float fc0 = static_cast<float>(c0) * MaxValInv;
-    float fc1 = static_cast<float>(c1) * MaxValInv;
-    float fc2 = static_cast<float>(c2) * MaxValInv;
-    float fc3 = static_cast<float>(c3) * MaxValInv;
+    const Uint32 Sign = u & 0x80000000u;
+    u ^= Sign;
 
-    float fLinearAverage = (FastGammaToLinear(fc0) + FastGammaToLinear(fc1) + FastGammaToLinear(fc2) + FastGammaToLinear(fc3)) * 0.25f;
-    float fSRGBAverage   = FastLinearToGamma(fLinearAverage) * MaxVal;
+    Uint32 h;
+    if (u >= F16Max)
+    {
+        // Overflows to Inf, NaN stays NaN
+        h = u > F32Infinity ? 0x7E00u : 0x7C00u;
+    }
+    else if (u < (113u << 23))
+    {
+        // Zero/denormal: let the FPU do the rounding by adding the magic value
+        float fMagic;
+        memcpy(&f, &u, sizeof(f));
+        memcpy(&fMagic, &DenormMagic, sizeof(fMagic));
+        f += fMagic;
+        memcpy(&u, &f, sizeof(u));
+        h = u - DenormMagic;
+    }
+    else
+    {
+        // Normal number: rebias the exponent and round to nearest even
+        const Uint32 MantOdd = (u >> 13) & 1u;
+        u += 0xC8000FFFu; // ((15 - 127) << 23) + 0xFFF
+        u += MantOdd;
+        h = u >> 13;
+    }
 
-    // Clamping on both ends is essential because fast SRGB math is imprecise
-    fSRGBAverage = std::max(fSRGBAverage, 0.f);
-    fSRGBAverage = std::min(fSRGBAverage, MaxVal);
+    return static_cast<Uint16>(h | (Sign >> 16));
+}
 
-    return static_cast<ChannelType>(fSRGBAverage);
+Uint16 HalfAverage(Uint16 c0, Uint16 c1, Uint16 c2, Uint16 c3, Uint32 /*col*/, Uint32 /*row*/)
+{
+    return FloatToHalf((HalfToFloat(c0) + HalfToFloat(c1) + HalfToFloat(c2) + HalfToFloat(c3)) * 0.25f);
 }
 
 template <typename ChannelType>
@@ -319,11 +395,221 @@ ChannelType MostFrequentSelector(ChannelType c0, ChannelType c1, ChannelType c2,
     }
 }
 
+// Filters the coarse row columns for which both fine columns are available and returns
+// the number of processed columns. The remaining columns are filtered by the generic code.
+// The kernels must produce results identical to the corresponding per-channel filter.
+template <typename ChannelType>
+using BoxFilterRowKernelType = Uint32 (*)(const ChannelType* pSrcRow0, const ChannelType* pSrcRow1, ChannelType* pDstRow, Uint32 NumCols);
+
+Uint32 BoxFilterRowSRGBA8(const Uint8* pSrcRow0, const Uint8* pSrcRow1, Uint8* pDstRow, Uint32 NumCols)
+{
+    // Convert the row in chunks to keep the temporary data on the stack
+    static constexpr Uint32 ChunkSize = 64;
+
+    float Fine0[ChunkSize * 8];
+    float Fine1[ChunkSize * 8];
+    float fLinearAverage[ChunkSize * 4];
+    for (Uint32 col = 0; col < NumCols; col += ChunkSize)
+    {
+        const Uint32 NumChunkCols = std::min(NumCols - col, Uint32{ChunkSize});
+        GammaToLinear(pSrcRow0 + col * 8, Fine0, NumChunkCols * 8);
+        GammaToLinear(pSrcRow1 + col * 8, Fine1, NumChunkCols * 8);
+        for (Uint32 i = 0; i < NumChunkCols * 4; ++i)
+        {
+            // Fine texel index is (i / 4) * 2, channel index is i % 4
+            const Uint32 Idx0 = (i & ~3u) * 2 + (i & 3u);
+            const Uint32 Idx1 = Idx0 + 4;
+
+            fLinearAverage[i] = (Fine0[Idx0] + Fine0[Idx1] + Fine1[Idx0] + Fine1[Idx1]) * 0.25f;
+        }
+        LinearToGamma(fLinearAverage, pDstRow + col * 4, NumChunkCols * 4);
+    }
+    return NumCols;
+}
+
+#if DILIGENT_MIP_FILTER_SSE
+
+Uint32 BoxFilterRowRGBA8(const Uint8* pSrcRow0, const Uint8* pSrcRow1, Uint8* pDstRow, Uint32 NumCols)
+{
+    const __m128i Zero = _mm_setzero_si128();
+
+    Uint32 col = 0;
+    for (; col + 4 <= NumCols; col += 4)
+    {
+        // 8 fine texels from each row produce 4 coarse texels
+        const __m128i r0a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcRow0 + col * 8));
+        const __m128i r0b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcRow0 + col * 8 + 16));
+        const __m128i r1a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcRow1 + col * 8));
+        const __m128i r1b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcRow1 + col * 8 + 16));
+
+        // Vertical sums of texels 0-1, 2-3, 4-5 and 6-7 as 16-bit values
+        const __m128i s01 = _mm_add_epi16(_mm_unpacklo_epi8(r0a, Zero), _mm_unpacklo_epi8(r1a, Zero));
+        const __m128i s23 = _mm_add_epi16(_mm_unpackhi_epi8(r0a, Zero), _mm_unpackhi_epi8(r1a, Zero));
+        const __m128i s45 = _mm_add_epi16(_mm_unpacklo_epi8(r0b, Zero), _mm_unpacklo_epi8(r1b, Zero));
+        const __m128i s67 = _mm_add_epi16(_mm_unpackhi_epi8(r0b, Zero), _mm_unpackhi_epi8(r1b, Zero));
+
+        // Add horizontally adjacent texels
+        const __m128i c01 = _mm_add_epi16(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23));
+        const __m128i c23 = _mm_add_epi16(_mm_unpacklo_epi64(s45, s67), _mm_unpackhi_epi64(s45, s67));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDstRow + col * 4), _mm_packus_epi16(_mm_srli_epi16(c01, 2), _mm_srli_epi16(c23, 2)));
+    }
+    return col;
+}
+
+Uint32 BoxFilterRowR32F(const float* pSrcRow0, const float* pSrcRow1, float* pDstRow, Uint32 NumCols)
+{
+    const __m128 Quarter = _mm_set1_ps(0.25f);
+
+    Uint32 col = 0;
+    for (; col + 4 <= NumCols; col += 4)
+    {
+        const __m128 r0a = _mm_loadu_ps(pSrcRow0 + col * 2);
+        const __m128 r0b = _mm_loadu_ps(pSrcRow0 + col * 2 + 4);
+        const __m128 r1a = _mm_loadu_ps(pSrcRow1 + col * 2);
+        const __m128 r1b = _mm_loadu_ps(pSrcRow1 + col * 2 + 4);
+
+        const __m128 c00 = _mm_shuffle_ps(r0a, r0b, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 c10 = _mm_shuffle_ps(r0a, r0b, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 c01 = _mm_shuffle_ps(r1a, r1b, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 c11 = _mm_shuffle_ps(r1a, r1b, _MM_SHUFFLE(3, 1, 3, 1));
+
+        // Use the same summation order as LinearAverage<float>
+        _mm_storeu_ps(pDstRow + col, _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(c00, c10), c01), c11), Quarter));
+    }
+    return col;
+}
+
+Uint32 BoxFilterRowRGBA32F(const float* pSrcRow0, const float* pSrcRow1, float* pDstRow, Uint32 NumCols)
+{
+    const __m128 Quarter = _mm_set1_ps(0.25f);
+    for (Uint32 col = 0; col < NumCols; ++col)
+    {
+        const __m128 c00 = _mm_loadu_ps(pSrcRow0 + col * 8);
+        const __m128 c10 = _mm_loadu_ps(pSrcRow0 + col * 8 + 4);
+        const __m128 c01 = _mm_loadu_ps(pSrcRow1 + col * 8);
+        const __m128 c11 = _mm_loadu_ps(pSrcRow1 + col * 8 + 4);
+        _mm_storeu_ps(pDstRow + col * 4, _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(c00, c10), c01), c11), Quarter));
+    }
+    return NumCols;
+}
+
+#elif DILIGENT_MIP_FILTER_NEON
+
+Uint32 BoxFilterRowRGBA8(const Uint8* pSrcRow0, const Uint8* pSrcRow1, Uint8* pDstRow, Uint32 NumCols)
+{
+    Uint32 col = 0;
+    for (; col + 4 <= NumCols; col += 4)
+    {
+        // 8 fine texels from each row produce 4 coarse texels
+        const uint8x16_t r0a = vld1q_u8(pSrcRow0 + col * 8);
+        const uint8x16_t r0b = vld1q_u8(pSrcRow0 + col * 8 + 16);
+        const uint8x16_t r1a = vld1q_u8(pSrcRow1 + col * 8);
+        const uint8x16_t r1b = vld1q_u8(pSrcRow1 + col * 8 + 16);
+
+        // Vertical sums of texels 0-1, 2-3, 4-5 and 6-7 as 16-bit values
+        const uint16x8_t s01 = vaddl_u8(vget_low_u8(r0a), vget_low_u8(r1a));
+        const uint16x8_t s23 = vaddl_u8(vget_high_u8(r0a), vget_high_u8(r1a));
+        const uint16x8_t s45 = vaddl_u8(vget_low_u8(r0b), vget_low_u8(r1b));
+        const uint16x8_t s67 = vaddl_u8(vget_high_u8(r0b), vget_high_u8(r1b));
+
+        // Add horizontally adjacent texels
+        const uint16x8_t c01 = vcombine_u16(vadd_u16(vget_low_u16(s01), vget_high_u16(s01)), vadd_u16(vget_low_u16(s23), vget_high_u16(s23)));
+        const uint16x8_t c23 = vcombine_u16(vadd_u16(vget_low_u16(s45), vget_high_u16(s45)), vadd_u16(vget_low_u16(s67), vget_high_u16(s67)));
+
+        vst1q_u8(pDstRow + col * 4, vcombine_u8(vshrn_n_u16(c01, 2), vshrn_n_u16(c23, 2)));
+    }
+    return col;
+}
+
+Uint32 BoxFilterRowR32F(const float* pSrcRow0, const float* pSrcRow1, float* pDstRow, Uint32 NumCols)
+{
+    const float32x4_t Quarter = vdupq_n_f32(0.25f);
+
+    Uint32 col = 0;
+    for (; col + 4 <= NumCols; col += 4)
+    {
+        // De-interleave even and odd fine columns
+        const float32x4x2_t r0 = vld2q_f32(pSrcRow0 + col * 2);
+        const float32x4x2_t r1 = vld2q_f32(pSrcRow1 + col * 2);
+
+        // Use the same summation order as LinearAverage<float>
+        vst1q_f32(pDstRow + col, vmulq_f32(vaddq_f32(vaddq_f32(vaddq_f32(r0.val[0], r0.val[1]), r1.val[0]), r1.val[1]), Quarter));
+    }
+    return col;
+}
+
+Uint32 BoxFilterRowRGBA32F(const float* pSrcRow0, const float* pSrcRow1, float* pDstRow, Uint32 NumCols)
+{
+    const float32x4_t Quarter = vdupq_n_f32(0.25f);
+    for (Uint32 col = 0; col < NumCols; ++col)
+    {
+        const float32x4_t c00 = vld1q_f32(pSrcRow0 + col * 8);
+        const float32x4_t c10 = vld1q_f32(pSrcRow0 + col * 8 + 4);
+        const float32x4_t c01 = vld1q_f32(pSrcRow1 + col * 8);
+        const float32x4_t c11 = vld1q_f32(pSrcRow1 + col * 8 + 4);
+        vst1q_f32(pDstRow + col * 4, vmulq_f32(vaddq_f32(vaddq_f32(vaddq_f32(c00, c10), c01), c11), Quarter));
+    }
+    return NumCols;
+}
+
+#endif
+
+template <typename ChannelType>
+BoxFilterRowKernelType<ChannelType> GetBoxFilterRowKernel(Uint32 /*NumChannels*/)
+{
+    return nullptr;
+}
+
+#if DILIGENT_MIP_FILTER_SIMD
+template <>
+BoxFilterRowKernelType<Uint8> GetBoxFilterRowKernel<Uint8>(Uint32 NumChannels)
+{
+    return NumChannels == 4 ? BoxFilterRowRGBA8 : nullptr;
+}
+
+template <>
+BoxFilterRowKernelType<float> GetBoxFilterRowKernel<float>(Uint32 NumChannels)
+{
+    switch (NumChannels)
+    {
+        case 1: return BoxFilterRowR32F;
+        case 4: return BoxFilterRowRGBA32F;
+        default: return nullptr;
+    }
+}
+#endif
+
+void RemapAlpha(const ComputeMipLevelAttribs& Attribs,
+                Uint32                        CoarseMipWidth,
+                Uint32                        NumChannels,
+                Uint32                        AlphaChannelInd,
+                Uint32                        row)
+{
+    Uint8* pDstRow = reinterpret_cast<Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride;
+    for (Uint32 col = 0; col < CoarseMipWidth; ++col)
+    {
+        Uint8& Alpha = pDstRow[col * NumChannels + AlphaChannelInd];
+
+        // Remap alpha channel using the following formula to improve mip maps:
+        //
+        //      A_new = max(A_old; 1/3 * A_old + 2/3 * CutoffThreshold)
+        //
+        // https://asawicki.info/articles/alpha_test.php5
+
+        float AlphaNew = std::min((static_cast<float>(Alpha) + 2.f * (Attribs.AlphaCutoff * 255.f)) / 3.f, 255.f);
+
+        Alpha = std::max(Alpha, static_cast<Uint8>(AlphaNew));
+    }
+}
+
 template <typename ChannelType,
           typename FilterType>
-void FilterMipLevel(const ComputeMipLevelAttribs& Attribs,
-                    Uint32                        NumChannels,
-                    FilterType                    Filter)
+void FilterMipLevel(const ComputeMipLevelAttribs&       Attribs,
+                    Uint32                              NumChannels,
+                    FilterType                          Filter,
+                    BoxFilterRowKernelType<ChannelType> RowKernel         = nullptr,
+                    bool                                RemapAlphaChannel = false)
 {
     VERIFY_EXPR(Attribs.FineMipWidth > 0 && Attribs.FineMipHeight > 0);
     DEV_CHECK_ERR(Attribs.FineMipHeight == 1 || Attribs.FineMipStride >= Attribs.FineMipWidth * sizeof(ChannelType) * NumChannels, "Fine mip level stride is too small");
@@ -333,15 +619,22 @@ void FilterMipLevel(const ComputeMipLevelAttribs& Attribs,
 
     VERIFY(CoarseMipHeight == 1 || Attribs.CoarseMipStride >= CoarseMipWidth * sizeof(ChannelType) * NumChannels, "Coarse mip level stride is too small");
 
-    for (Uint32 row = 0; row < CoarseMipHeight; ++row)
-    {
+    // Rows are independent and are distributed between the thread pool workers in
+    // ranges large enough to amortize the scheduling overhead.
+    static constexpr Uint32 MinTexelsPerTask = 16384;
+
+    const Uint32 RowsPerTask = std::max(MinTexelsPerTask / CoarseMipWidth, Uint32{1});
+    ParallelFor(Attribs.pThreadPool, 0, CoarseMipHeight, RowsPerTask, [&](Uint32 row) {
         Uint32 src_row0 = row * 2;
         Uint32 src_row1 = std::min(row * 2 + 1, Attribs.FineMipHeight - 1);
 
         const ChannelType* pSrcRow0 = reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(Attribs.pFineMipData) + src_row0 * Attribs.FineMipStride);
         const ChannelType* pSrcRow1 = reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(Attribs.pFineMipData) + src_row1 * Attribs.FineMipStride);
+        ChannelType*       pDstRow  = reinterpret_cast<ChannelType*>(reinterpret_cast<Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride);
 
-        for (Uint32 col = 0; col < CoarseMipWidth; ++col)
+        // Row kernels expect two fine columns for every coarse column
+        Uint32 col = (RowKernel != nullptr && Attribs.FineMipWidth > 1) ? RowKernel(pSrcRow0, pSrcRow1, pDstRow, CoarseMipWidth) : 0;
+        for (; col < CoarseMipWidth; ++col)
         {
             Uint32 src_col0 = col * 2;
             Uint32 src_col1 = std::min(col * 2 + 1, Attribs.FineMipWidth - 1);
@@ -353,42 +646,19 @@ void FilterMipLevel(const ComputeMipLevelAttribs& Attribs,
                 const ChannelType Chnl01 = pSrcRow1[src_col0 * NumChannels + c];
                 const ChannelType Chnl11 = pSrcRow1[src_col1 * NumChannels + c];
 
-                ChannelType& DstCol = reinterpret_cast<ChannelType*>(reinterpret_cast<Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride)[col * NumChannels + c];
-
-                DstCol = Filter(Chnl00, Chnl10, Chnl01, Chnl11, col, row);
+                pDstRow[col * NumChannels + c] = Filter(Chnl00, Chnl10, Chnl01, Chnl11, col, row);
             }
         }
-    }
-}
 
-void RemapAlpha(const ComputeMipLevelAttribs& Attribs,
-                Uint32                        NumChannels,
-                Uint32                        AlphaChannelInd)
-{
-    const Uint32 CoarseMipWidth  = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
-    const Uint32 CoarseMipHeight = std::max(Attribs.FineMipHeight / Uint32{2}, Uint32{1});
-    for (Uint32 row = 0; row < CoarseMipHeight; ++row)
-    {
-        for (Uint32 col = 0; col < CoarseMipWidth; ++col)
-        {
-            Uint8& Alpha = (reinterpret_cast<Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride)[col * NumChannels + AlphaChannelInd];
-
-            // Remap alpha channel using the following formula to improve mip maps:
-            //
-            //      A_new = max(A_old; 1/3 * A_old + 2/3 * CutoffThreshold)
-            //
-            // https://asawicki.info/articles/alpha_test.php5
-
-            float AlphaNew = std::min((static_cast<float>(Alpha) + 2.f * (Attribs.AlphaCutoff * 255.f)) / 3.f, 255.f);
-
-            Alpha = std::max(Alpha, static_cast<Uint8>(AlphaNew));
-        }
-    }
+        if (RemapAlphaChannel)
+            RemapAlpha(Attribs, CoarseMipWidth, NumChannels, NumChannels - 1, row);
+    });
 }
 
 template <typename ChannelType>
 void ComputeMipLevelInternal(const ComputeMipLevelAttribs& Attribs,
-                             const TextureFormatAttribs&   FmtAttribs)
+                             const TextureFormatAttribs&   FmtAttribs,
+                             bool                          RemapAlphaChannel = false)
 {
     MIP_FILTER_TYPE FilterType = Attribs.FilterType;
     if (FilterType == MIP_FILTER_TYPE_DEFAULT)
@@ -398,10 +668,16 @@ void ComputeMipLevelInternal(const ComputeMipLevelAttribs& Attribs,
             MIP_FILTER_TYPE_BOX_AVERAGE;
     }
 
-    FilterMipLevel<ChannelType>(Attribs, FmtAttribs.NumComponents,
-                                FilterType == MIP_FILTER_TYPE_BOX_AVERAGE ?
-                                    LinearAverage<ChannelType> :
-                                    MostFrequentSelector<ChannelType>);
+    if (FilterType == MIP_FILTER_TYPE_BOX_AVERAGE)
+    {
+        FilterMipLevel<ChannelType>(Attribs, FmtAttribs.NumComponents, LinearAverage<ChannelType>,
+                                    GetBoxFilterRowKernel<ChannelType>(FmtAttribs.NumComponents), RemapAlphaChannel);
+    }
+    else
+    {
+        FilterMipLevel<ChannelType>(Attribs, FmtAttribs.NumComponents, MostFrequentSelector<ChannelType>,
+                                    nullptr, RemapAlphaChannel);
+    }
 }
 
 void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
@@ -422,14 +698,11 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
     {
         case COMPONENT_TYPE_UNORM_SRGB:
             VERIFY(FmtAttribs.ComponentSize == 1, "Only 8-bit sRGB formats are expected");
-            FilterMipLevel<Uint8>(Attribs, FmtAttribs.NumComponents,
-                                  Attribs.FilterType == MIP_FILTER_TYPE_MOST_FREQUENT ?
-                                      MostFrequentSelector<Uint8> :
-                                      SRGBAverage<Uint8>);
-            if (Attribs.AlphaCutoff > 0)
-            {
-                RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1);
-            }
+            if (Attribs.FilterType == MIP_FILTER_TYPE_MOST_FREQUENT)
+                FilterMipLevel<Uint8>(Attribs, FmtAttribs.NumComponents, MostFrequentSelector<Uint8>, nullptr, Attribs.AlphaCutoff > 0);
+            else
+                FilterMipLevel<Uint8>(Attribs, FmtAttribs.NumComponents, SRGBAverage,
+                                      FmtAttribs.NumComponents == 4 ? BoxFilterRowSRGBA8 : nullptr, Attribs.AlphaCutoff > 0);
             break;
 
         case COMPONENT_TYPE_UNORM:
@@ -437,11 +710,7 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
             switch (FmtAttribs.ComponentSize)
             {
                 case 1:
-                    ComputeMipLevelInternal<Uint8>(Attribs, FmtAttribs);
-                    if (Attribs.AlphaCutoff > 0)
-                    {
-                        RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1);
-                    }
+                    ComputeMipLevelInternal<Uint8>(Attribs, FmtAttribs, Attribs.AlphaCutoff > 0);
                     break;
 
                 case 2:
@@ -479,8 +748,22 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
             break;
 
         case COMPONENT_TYPE_FLOAT:
-            VERIFY(FmtAttribs.ComponentSize == 4, "Only 32-bit float formats are currently supported");
-            ComputeMipLevelInternal<Float32>(Attribs, FmtAttribs);
+            switch (FmtAttribs.ComponentSize)
+            {
+                case 2:
+                    if (Attribs.FilterType == MIP_FILTER_TYPE_MOST_FREQUENT)
+                        FilterMipLevel<Uint16>(Attribs, FmtAttribs.NumComponents, MostFrequentSelector<Uint16>);
+                    else
+                        FilterMipLevel<Uint16>(Attribs, FmtAttribs.NumComponents, HalfAverage);
+                    break;
+
+                case 4:
+                    ComputeMipLevelInternal<Float32>(Attribs, FmtAttribs);
+                    break;
+
+                default:
+                    UNEXPECTED("Unexpected component size (", FmtAttribs.ComponentSize, ") for FLOAT texture format");
+            }
             break;
 
         default:
@@ -0,0 +1,602 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "HiZOcclusionCuller.hpp"
+
+#include <algorithm>
+
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Every build dispatch reduces a HiZBuildTileSize x HiZBuildTileSize tile of its first level
+// and all levels down to 1x1 in group-shared memory.
+constexpr Uint32 HiZBuildTileSize       = 16;
+constexpr Uint32 HiZLevelsPerDispatch   = 5; // 16, 8, 4, 2, 1
+constexpr Uint32 HiZCullThreadGroupSize = 64;
+constexpr Uint32 DrawArgsStride         = sizeof(Uint32) * 5;
+
+constexpr char HiZBuildCS[] = R"(
+#ifndef HIZ_TILE_SIZE
+#   define HIZ_TILE_SIZE 16
+#endif
+
+cbuffer cbHiZBuildAttribs
+{
+    uint2 g_SrcSize;
+    uint2 g_DstSize;
+    uint  g_SrcOffset;
+    uint  g_DstOffset;
+    uint  g_NumDstLevels;
+    uint  g_Padding;
+}
+
+#if HIZ_BUILD_FROM_DEPTH
+Texture2D<float> g_Depth;
+#endif
+RWStructuredBuffer<float2> g_HiZ;
+
+groupshared float2 g_Tile[HIZ_TILE_SIZE * HIZ_TILE_SIZE];
+
+float2 CombineMinMax(float2 MinMax0, float2 MinMax1)
+{
+    return float2(min(MinMax0.x, MinMax1.x), max(MinMax0.y, MinMax1.y));
+}
+
+float2 ReduceSource(uint2 DstCoord)
+{
+#if HIZ_BUILD_FROM_DEPTH
+    // Every level-0 texel covers one to two depth texels in each direction.
+    // Include all texels touched by the footprint to keep the reduction conservative.
+    uint2  Start  = (DstCoord * g_SrcSize) / g_DstSize;
+    uint2  End    = min(((DstCoord + 1u) * g_SrcSize + g_DstSize - 1u) / g_DstSize, g_SrcSize);
+    float2 MinMax = float2(1.0, 0.0);
+    for (uint y = Start.y; y < End.y; ++y)
+    {
+        for (uint x = Start.x; x < End.x; ++x)
+        {
+            float Depth = g_Depth.Load(int3(int(x), int(y), 0));
+            MinMax = CombineMinMax(MinMax, float2(Depth, Depth));
+        }
+    }
+    return MinMax;
+#else
+    uint2  Coord0 = min(DstCoord * 2u, g_SrcSize - 1u);
+    uint2  Coord1 = min(DstCoord * 2u + 1u, g_SrcSize - 1u);
+    float2 MinMax = g_HiZ[g_SrcOffset + Coord0.y * g_SrcSize.x + Coord0.x];
+    MinMax = CombineMinMax(MinMax, g_HiZ[g_SrcOffset + Coord0.y * g_SrcSize.x + Coord1.x]);
+    MinMax = CombineMinMax(MinMax, g_HiZ[g_SrcOffset + Coord1.y * g_SrcSize.x + Coord0.x]);
+    MinMax = CombineMinMax(MinMax, g_HiZ[g_SrcOffset + Coord1.y * g_SrcSize.x + Coord1.x]);
+    return MinMax;
+#endif
+}
+
+[numthreads(HIZ_TILE_SIZE, HIZ_TILE_SIZE, 1)]
+void main(uint3 Gid  : SV_GroupID,
+          uint3 GTid : SV_GroupThreadID)
+{
+    uint2 DstSize = g_DstSize;
+    uint  Offset  = g_DstOffset;
+    uint2 Coord   = Gid.xy * uint(HIZ_TILE_SIZE) + GTid.xy;
+
+    // Threads outside of the level replicate the edge texels, so that they
+    // do not affect the reduction of the levels below.
+    float2 MinMax = ReduceSource(min(Coord, DstSize - 1u));
+    if (Coord.x < DstSize.x && Coord.y < DstSize.y)
+        g_HiZ[Offset + Coord.y * DstSize.x + Coord.x] = MinMax;
+
+    uint TileSize = uint(HIZ_TILE_SIZE);
+    for (uint Level = 1u; Level < g_NumDstLevels; ++Level)
+    {
+        GroupMemoryBarrierWithGroupSync();
+        g_Tile[GTid.y * uint(HIZ_TILE_SIZE) + GTid.x] = MinMax;
+        GroupMemoryBarrierWithGroupSync();
+
+        Offset += DstSize.x * DstSize.y;
+        DstSize  = max(DstSize >> 1u, uint2(1u, 1u));
+        TileSize = TileSize >> 1u;
+        if (GTid.x < TileSize && GTid.y < TileSize)
+        {
+            uint Idx = GTid.y * 2u * uint(HIZ_TILE_SIZE) + GTid.x * 2u;
+            MinMax = CombineMinMax(CombineMinMax(g_Tile[Idx], g_Tile[Idx + 1u]),
+                                   CombineMinMax(g_Tile[Idx + uint(HIZ_TILE_SIZE)], g_Tile[Idx + uint(HIZ_TILE_SIZE) + 1u]));
+
+            uint2 LevelCoord = Gid.xy * TileSize + GTid.xy;
+            if (LevelCoord.x < DstSize.x && LevelCoord.y < DstSize.y)
+                g_HiZ[Offset + LevelCoord.y * DstSize.x + LevelCoord.x] = MinMax;
+        }
+    }
+}
+)";
+
+constexpr char HiZCullCS[] = R"(
+#ifndef HIZ_CULL_GROUP_SIZE
+#   define HIZ_CULL_GROUP_SIZE 64
+#endif
+
+struct HiZCullingInstance
+{
+    float4 BoundsMin;
+    float4 BoundsMax;
+    uint   NumIndices;
+    uint   NumInstances;
+    uint   FirstIndexLocation;
+    int    BaseVertex;
+    uint   FirstInstanceLocation;
+    uint   Padding0;
+    uint   Padding1;
+    uint   Padding2;
+};
+
+cbuffer cbHiZCullAttribs
+{
+    float4x4 g_ViewProj;
+    uint4    g_LevelOffsets[4];
+    uint2    g_HiZSize;
+    uint     g_NumLevels;
+    uint     g_NumInstances;
+    float    g_NDCMinZ;
+    float    g_ZtoDepthScale;
+    float    g_ZtoDepthBias;
+    float    g_YtoVScale;
+}
+
+StructuredBuffer<HiZCullingInstance> g_Instances;
+StructuredBuffer<float2>             g_HiZ;
+RWStructuredBuffer<uint>             g_DrawArgs;
+#if HIZ_COMPACT
+RWStructuredBuffer<uint>             g_DrawCount;
+#endif
+
+float2 LoadHiZ(uint Offset, uint Width, uint2 Coord)
+{
+    return g_HiZ[Offset + Coord.y * Width + Coord.x];
+}
+
+bool IsVisible(HiZCullingInstance Inst)
+{
+    float3 NDCMin = float3(+1e+30, +1e+30, +1e+30);
+    float3 NDCMax = float3(-1e+30, -1e+30, -1e+30);
+
+    uint OutsideMask        = 0x3Fu;
+    bool CrossesCameraPlane = false;
+    for (uint i = 0u; i < 8u; ++i)
+    {
+        float3 Corner = float3((i & 1u) != 0u ? Inst.BoundsMax.x : Inst.BoundsMin.x,
+                               (i & 2u) != 0u ? Inst.BoundsMax.y : Inst.BoundsMin.y,
+                               (i & 4u) != 0u ? Inst.BoundsMax.z : Inst.BoundsMin.z);
+        float4 Pos = mul(float4(Corner, 1.0), g_ViewProj);
+
+        uint Mask = 0u;
+        if (Pos.x < -Pos.w) Mask |= 1u;
+        if (Pos.x > +Pos.w) Mask |= 2u;
+        if (Pos.y < -Pos.w) Mask |= 4u;
+        if (Pos.y > +Pos.w) Mask |= 8u;
+        if (Pos.z < g_NDCMinZ * Pos.w) Mask |= 16u;
+        if (Pos.z > Pos.w) Mask |= 32u;
+        OutsideMask &= Mask;
+
+        if (Pos.w > 1e-6)
+        {
+            float3 NDC = Pos.xyz / Pos.w;
+            NDCMin = min(NDCMin, NDC);
+            NDCMax = max(NDCMax, NDC);
+        }
+        else
+        {
+            CrossesCameraPlane = true;
+        }
+    }
+
+    // All corners are outside of the same frustum plane
+    if (OutsideMask != 0u)
+        return false;
+
+    // The projection of a box that crosses the camera plane is unbounded
+    if (CrossesCameraPlane || g_NumLevels == 0u)
+        return true;
+
+    float2 UV0   = float2(NDCMin.x * 0.5 + 0.5, NDCMin.y * g_YtoVScale + 0.5);
+    float2 UV1   = float2(NDCMax.x * 0.5 + 0.5, NDCMax.y * g_YtoVScale + 0.5);
+    float2 UVMin = saturate(min(UV0, UV1));
+    float2 UVMax = saturate(max(UV0, UV1));
+
+    // Select the level where the box covers at most 2x2 texels
+    float2 Extent = (UVMax - UVMin) * float2(g_HiZSize);
+    uint   Level  = min(uint(ceil(log2(max(max(Extent.x, Extent.y), 1.0)))), g_NumLevels - 1u);
+
+    uint2 LevelSize = max(g_HiZSize >> Level, uint2(1u, 1u));
+    uint2 TexMin    = min(uint2(UVMin * float2(LevelSize)), LevelSize - 1u);
+    uint2 TexMax    = min(uint2(UVMax * float2(LevelSize)), LevelSize - 1u);
+    if ((TexMax.x - TexMin.x > 1u || TexMax.y - TexMin.y > 1u) && Level + 1u < g_NumLevels)
+    {
+        // Rounding may make the box touch three texels
+        ++Level;
+        LevelSize = max(g_HiZSize >> Level, uint2(1u, 1u));
+        TexMin    = min(uint2(UVMin * float2(LevelSize)), LevelSize - 1u);
+        TexMax    = min(uint2(UVMax * float2(LevelSize)), LevelSize - 1u);
+    }
+
+    uint   Offset = g_LevelOffsets[Level >> 2u][Level & 3u];
+    float2 MinMax = LoadHiZ(Offset, LevelSize.x, TexMin);
+    float2 MinMax1 = LoadHiZ(Offset, LevelSize.x, uint2(TexMax.x, TexMin.y));
+    float2 MinMax2 = LoadHiZ(Offset, LevelSize.x, uint2(TexMin.x, TexMax.y));
+    float2 MinMax3 = LoadHiZ(Offset, LevelSize.x, TexMax);
+    MinMax.x = min(min(MinMax.x, MinMax1.x), min(MinMax2.x, MinMax3.x));
+    MinMax.y = max(max(MinMax.y, MinMax1.y), max(MinMax2.y, MinMax3.y));
+
+#if HIZ_REVERSE_Z
+    // The nearest point of the box has the largest depth, and the farthest occluder has the smallest one
+    float BoxDepth = NDCMax.z * g_ZtoDepthScale + g_ZtoDepthBias;
+    return BoxDepth >= MinMax.x;
+#else
+    float BoxDepth = NDCMin.z * g_ZtoDepthScale + g_ZtoDepthBias;
+    return BoxDepth <= MinMax.y;
+#endif
+}
+
+[numthreads(HIZ_CULL_GROUP_SIZE, 1, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    uint InstanceId = DTid.x;
+    if (InstanceId >= g_NumInstances)
+        return;
+
+    HiZCullingInstance Inst = g_Instances[InstanceId];
+
+    bool Visible = IsVisible(Inst);
+#if HIZ_COMPACT
+    if (!Visible)
+        return;
+    uint ArgsIdx;
+    InterlockedAdd(g_DrawCount[0], 1u, ArgsIdx);
+#else
+    uint ArgsIdx = InstanceId;
+#endif
+
+    uint Base = ArgsIdx * 5u;
+    g_DrawArgs[Base + 0u] = Inst.NumIndices;
+    g_DrawArgs[Base + 1u] = Visible ? Inst.NumInstances : 0u;
+    g_DrawArgs[Base + 2u] = Inst.FirstIndexLocation;
+    g_DrawArgs[Base + 3u] = asuint(Inst.BaseVertex);
+    g_DrawArgs[Base + 4u] = Inst.FirstInstanceLocation;
+}
+)";
+
+struct HiZBuildAttribs
+{
+    Uint32 SrcWidth;
+    Uint32 SrcHeight;
+    Uint32 DstWidth;
+    Uint32 DstHeight;
+    Uint32 SrcOffset;
+    Uint32 DstOffset;
+    Uint32 NumDstLevels;
+    Uint32 Padding;
+};
+static_assert(sizeof(HiZBuildAttribs) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+struct HiZCullAttribs
+{
+    float4x4 ViewProj;
+    Uint32   LevelOffsets[HiZPyramidLayout::MaxLevels];
+    Uint32   HiZWidth;
+    Uint32   HiZHeight;
+    Uint32   NumLevels;
+    Uint32   NumInstances;
+    float    NDCMinZ;
+    float    ZtoDepthScale;
+    float    ZtoDepthBias;
+    float    YtoVScale;
+};
+static_assert(sizeof(HiZCullAttribs) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+RefCntAutoPtr<IPipelineState> CreateComputePSO(IRenderDevice*          pDevice,
+                                               const char*             Name,
+                                               const char*             Source,
+                                               const ShaderMacroArray& Macros,
+                                               const char*             CBName,
+                                               IBuffer*                pConstants)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc           = {Name, SHADER_TYPE_COMPUTE, true};
+    ShaderCI.Source         = Source;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    if (!pCS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create shader '", Name, "'");
+        return {};
+    }
+
+    const ShaderResourceVariableDesc Vars[] = {
+        {SHADER_TYPE_COMPUTE, CBName, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    };
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                               = Name;
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+    PSOCreateInfo.PSODesc.ResourceLayout.Variables           = Vars;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumVariables        = _countof(Vars);
+    PSOCreateInfo.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    if (!pPSO)
+    {
+        LOG_ERROR_MESSAGE("Failed to create pipeline state '", Name, "'");
+        return {};
+    }
+
+    if (IShaderResourceVariable* pVar = pPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, CBName))
+        pVar->Set(pConstants);
+
+    return pPSO;
+}
+
+RefCntAutoPtr<IBuffer> CreateStructuredBuffer(IRenderDevice* pDevice,
+                                              const char*    Name,
+                                              BIND_FLAGS     BindFlags,
+                                              Uint32         ElementSize,
+                                              Uint64         NumElements)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name              = Name;
+    BuffDesc.Usage             = USAGE_DEFAULT;
+    BuffDesc.BindFlags         = BindFlags;
+    BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+    BuffDesc.ElementByteStride = ElementSize;
+    BuffDesc.Size              = ElementSize * std::max(NumElements, Uint64{1});
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    return pBuffer;
+}
+
+} // namespace
+
+HiZPyramidLayout ComputeHiZPyramidLayout(Uint32 DepthWidth, Uint32 DepthHeight)
+{
+    HiZPyramidLayout Layout;
+    if (DepthWidth == 0 || DepthHeight == 0)
+        return Layout;
+
+    Layout.Width  = std::max(AlignUpToPowerOfTwo(DepthWidth) >> 1u, 1u);
+    Layout.Height = std::max(AlignUpToPowerOfTwo(DepthHeight) >> 1u, 1u);
+
+    Uint32 Width  = Layout.Width;
+    Uint32 Height = Layout.Height;
+    while (Layout.NumLevels < HiZPyramidLayout::MaxLevels)
+    {
+        Layout.LevelOffsets[Layout.NumLevels++] = Layout.NumTexels;
+        Layout.NumTexels += Width * Height;
+        if (Width == 1 && Height == 1)
+            break;
+        Width  = std::max(Width >> 1u, 1u);
+        Height = std::max(Height >> 1u, 1u);
+    }
+    DEV_CHECK_ERR(Width == 1 && Height == 1, "Depth buffer ", DepthWidth, "x", DepthHeight, " is too large for the Hi-Z pyramid");
+
+    return Layout;
+}
+
+HiZOcclusionCuller::HiZOcclusionCuller(IRenderDevice* pDevice, const HiZOcclusionCullerCreateInfo& CI) :
+    m_pDevice{pDevice},
+    m_ReverseZ{CI.ReverseZ},
+    m_Compact{CI.Compact && (pDevice->GetAdapterInfo().DrawCommand.CapFlags & DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER) != 0}
+{
+    DEV_CHECK_ERR(pDevice->GetDeviceInfo().Features.ComputeShaders, "Hi-Z occlusion culling requires compute shaders");
+    CreatePipelines();
+}
+
+HiZOcclusionCuller::~HiZOcclusionCuller()
+{
+}
+
+void HiZOcclusionCuller::CreatePipelines()
+{
+    CreateUniformBuffer(m_pDevice, sizeof(HiZBuildAttribs), "Hi-Z build attribs", &m_pBuildConstants);
+    CreateUniformBuffer(m_pDevice, sizeof(HiZCullAttribs), "Hi-Z cull attribs", &m_pCullConstants);
+
+    {
+        ShaderMacroHelper Macros;
+        Macros.Add("HIZ_TILE_SIZE", static_cast<Int32>(HiZBuildTileSize));
+        Macros.Add("HIZ_BUILD_FROM_DEPTH", 1);
+        m_pBuildFromDepthPSO = CreateComputePSO(m_pDevice, "Hi-Z build from depth", HiZBuildCS, Macros, "cbHiZBuildAttribs", m_pBuildConstants);
+    }
+    {
+        ShaderMacroHelper Macros;
+        Macros.Add("HIZ_TILE_SIZE", static_cast<Int32>(HiZBuildTileSize));
+        Macros.Add("HIZ_BUILD_FROM_DEPTH", 0);
+        m_pBuildPSO = CreateComputePSO(m_pDevice, "Hi-Z build", HiZBuildCS, Macros, "cbHiZBuildAttribs", m_pBuildConstants);
+    }
+    {
+        ShaderMacroHelper Macros;
+        Macros.Add("HIZ_CULL_GROUP_SIZE", static_cast<Int32>(HiZCullThreadGroupSize));
+        Macros.Add("HIZ_REVERSE_Z", m_ReverseZ);
+        Macros.Add("HIZ_COMPACT", m_Compact);
+        m_pCullPSO = CreateComputePSO(m_pDevice, "Hi-Z cull", HiZCullCS, Macros, "cbHiZCullAttribs", m_pCullConstants);
+    }
+
+    if (m_pBuildFromDepthPSO)
+        m_pBuildFromDepthPSO->CreateShaderResourceBinding(&m_pBuildFromDepthSRB, true);
+    if (m_pBuildPSO)
+        m_pBuildPSO->CreateShaderResourceBinding(&m_pBuildSRB, true);
+    if (m_pCullPSO)
+        m_pCullPSO->CreateShaderResourceBinding(&m_pCullSRB, true);
+
+    // The cull pass reads the pyramid even if it has not been built yet
+    m_pPyramid = CreateStructuredBuffer(m_pDevice, "Hi-Z pyramid", BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS, sizeof(float2), 1);
+}
+
+void HiZOcclusionCuller::BuildPyramid(IDeviceContext* pCtx, ITextureView* pDepthSRV)
+{
+    DEV_CHECK_ERR(pCtx != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(pDepthSRV != nullptr && pDepthSRV->GetDesc().ViewType == TEXTURE_VIEW_SHADER_RESOURCE,
+                  "Depth buffer shader resource view must not be null");
+    if (!m_pBuildFromDepthSRB || !m_pBuildSRB)
+        return;
+
+    const TextureDesc& DepthDesc = pDepthSRV->GetTexture()->GetDesc();
+
+    const Uint32 MipLevel    = pDepthSRV->GetDesc().MostDetailedMip;
+    const Uint32 DepthWidth  = std::max(DepthDesc.Width >> MipLevel, 1u);
+    const Uint32 DepthHeight = std::max(DepthDesc.Height >> MipLevel, 1u);
+
+    m_Layout = ComputeHiZPyramidLayout(DepthWidth, DepthHeight);
+    if (m_pPyramid->GetDesc().Size < Uint64{m_Layout.NumTexels} * sizeof(float2))
+    {
+        // The old buffer may still be used by the GPU; the engine will release it once the commands complete
+        m_pPyramid = CreateStructuredBuffer(m_pDevice, "Hi-Z pyramid", BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS, sizeof(float2), m_Layout.NumTexels);
+    }
+    IBufferView* pPyramidUAV = m_pPyramid->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS);
+
+    m_pBuildFromDepthSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Depth")->Set(pDepthSRV);
+    m_pBuildFromDepthSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_HiZ")->Set(pPyramidUAV);
+    m_pBuildSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_HiZ")->Set(pPyramidUAV);
+
+    Uint32 SrcWidth  = DepthWidth;
+    Uint32 SrcHeight = DepthHeight;
+    Uint32 SrcOffset = 0;
+    for (Uint32 Level = 0; Level < m_Layout.NumLevels;)
+    {
+        const Uint32 DstWidth     = std::max(m_Layout.Width >> Level, 1u);
+        const Uint32 DstHeight    = std::max(m_Layout.Height >> Level, 1u);
+        const Uint32 NumDstLevels = std::min(m_Layout.NumLevels - Level, HiZLevelsPerDispatch);
+        {
+            MapHelper<HiZBuildAttribs> Attribs{pCtx, m_pBuildConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+            Attribs->SrcWidth     = SrcWidth;
+            Attribs->SrcHeight    = SrcHeight;
+            Attribs->DstWidth     = DstWidth;
+            Attribs->DstHeight    = DstHeight;
+            Attribs->SrcOffset    = SrcOffset;
+            Attribs->DstOffset    = m_Layout.LevelOffsets[Level];
+            Attribs->NumDstLevels = NumDstLevels;
+            Attribs->Padding      = 0;
+        }
+
+        // Every dispatch reads the levels written by the previous one. The pyramid buffer
+        // stays in the unordered access state, and the engine inserts the UAV barrier.
+        pCtx->SetPipelineState(Level == 0 ? m_pBuildFromDepthPSO : m_pBuildPSO);
+        pCtx->CommitShaderResources(Level == 0 ? m_pBuildFromDepthSRB : m_pBuildSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->DispatchCompute({(DstWidth + HiZBuildTileSize - 1) / HiZBuildTileSize, (DstHeight + HiZBuildTileSize - 1) / HiZBuildTileSize});
+
+        Level += NumDstLevels;
+        SrcWidth  = std::max(m_Layout.Width >> (Level - 1), 1u);
+        SrcHeight = std::max(m_Layout.Height >> (Level - 1), 1u);
+        SrcOffset = m_Layout.LevelOffsets[Level - 1];
+    }
+}
+
+void HiZOcclusionCuller::PrepareOutputBuffers(Uint32 NumInstances)
+{
+    if (!m_pDrawArgs || m_pDrawArgs->GetDesc().Size < Uint64{NumInstances} * DrawArgsStride)
+    {
+        // Allocate whole draw argument records, so that the buffer can also be used with DrawArgsStride
+        m_pDrawArgs = CreateStructuredBuffer(m_pDevice, "Hi-Z culled draw args", BIND_INDIRECT_DRAW_ARGS | BIND_UNORDERED_ACCESS,
+                                             sizeof(Uint32), Uint64{NumInstances} * (DrawArgsStride / sizeof(Uint32)));
+    }
+
+    if (m_Compact && !m_pDrawCount)
+    {
+        m_pDrawCount = CreateStructuredBuffer(m_pDevice, "Hi-Z culled draw count", BIND_INDIRECT_DRAW_ARGS | BIND_UNORDERED_ACCESS,
+                                              sizeof(Uint32), 1);
+    }
+}
+
+void HiZOcclusionCuller::Cull(IDeviceContext*  pCtx,
+                              const float4x4&  ViewProj,
+                              IBuffer*         pInstances,
+                              Uint32           NumInstances)
+{
+    DEV_CHECK_ERR(pCtx != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(pInstances != nullptr || NumInstances == 0, "Instances buffer must not be null");
+    DEV_CHECK_ERR(pInstances == nullptr || pInstances->GetDesc().Size >= Uint64{NumInstances} * sizeof(HiZCullingInstance),
+                  "Instances buffer '", pInstances->GetDesc().Name, "' is too small for ", NumInstances, " instances");
+    if (!m_pCullSRB || NumInstances == 0)
+        return;
+
+    PrepareOutputBuffers(NumInstances);
+
+    if (m_Compact)
+    {
+        constexpr Uint32 Zero = 0;
+        pCtx->UpdateBuffer(m_pDrawCount, 0, sizeof(Zero), &Zero, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        m_pCullSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_DrawCount")->Set(m_pDrawCount->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+    }
+    m_pCullSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Instances")->Set(pInstances->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+    m_pCullSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_HiZ")->Set(m_pPyramid->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+    m_pCullSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_DrawArgs")->Set(m_pDrawArgs->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+
+    {
+        const NDCAttribs& NDC = m_pDevice->GetDeviceInfo().GetNDCAttribs();
+
+        MapHelper<HiZCullAttribs> Attribs{pCtx, m_pCullConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+        Attribs->ViewProj = ViewProj.Transpose();
+        for (Uint32 i = 0; i < HiZPyramidLayout::MaxLevels; ++i)
+            Attribs->LevelOffsets[i] = m_Layout.LevelOffsets[i];
+        Attribs->HiZWidth      = m_Layout.Width;
+        Attribs->HiZHeight     = m_Layout.Height;
+        Attribs->NumLevels     = m_Layout.NumLevels;
+        Attribs->NumInstances  = NumInstances;
+        Attribs->NDCMinZ       = NDC.MinZ;
+        Attribs->ZtoDepthScale = NDC.ZtoDepthScale;
+        Attribs->ZtoDepthBias  = NDC.GetZtoDepthBias();
+        Attribs->YtoVScale     = NDC.YtoVScale;
+    }
+
+    pCtx->SetPipelineState(m_pCullPSO);
+    pCtx->CommitShaderResources(m_pCullSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->DispatchCompute({(NumInstances + HiZCullThreadGroupSize - 1) / HiZCullThreadGroupSize, 1});
+}
+
+DrawIndexedIndirectAttribs HiZOcclusionCuller::GetDrawAttribs(VALUE_TYPE IndexType, Uint32 NumInstances) const
+{
+    DrawIndexedIndirectAttribs Attribs{IndexType, m_pDrawArgs, DRAW_FLAG_NONE, NumInstances};
+    Attribs.DrawArgsStride                   = DrawArgsStride;
+    Attribs.AttribsBufferStateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    if (m_Compact)
+    {
+        Attribs.pCounterBuffer                   = m_pDrawCount;
+        Attribs.CounterBufferStateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    }
+    return Attribs;
+}
+
+} // namespace Diligent
@@ -0,0 +1,788 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#include "DebugUtilities.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 InvalidIndex = ~0u;
+
+const float3& GetPosition(const void* pVertices, Uint32 Stride, Uint32 Index)
+{
+    return *reinterpret_cast<const float3*>(static_cast<const Uint8*>(pVertices) + size_t{Index} * Stride);
+}
+
+// T. Forsyth, "Linear-Speed Vertex Cache Optimisation"
+class VertexCacheOptimizer
+{
+public:
+    VertexCacheOptimizer(const Uint32* pIndices, Uint32 NumIndices, Uint32 NumVertices) :
+        m_pIndices{pIndices},
+        m_NumTriangles{NumIndices / 3},
+        m_NumVertices{NumVertices}
+    {
+    }
+
+    void Optimize(Uint32* pDstIndices)
+    {
+        InitAdjacency();
+
+        m_VertexCachePos.assign(m_NumVertices, -1);
+        m_VertexScore.resize(m_NumVertices);
+        for (Uint32 v = 0; v < m_NumVertices; ++v)
+            m_VertexScore[v] = ComputeVertexScore(-1, m_NumActiveTris[v]);
+
+        m_TriScore.resize(m_NumTriangles);
+        m_TriAdded.assign(m_NumTriangles, false);
+        for (Uint32 t = 0; t < m_NumTriangles; ++t)
+        {
+            const Uint32* Tri = &m_pIndices[t * 3];
+            m_TriScore[t]     = m_VertexScore[Tri[0]] + m_VertexScore[Tri[1]] + m_VertexScore[Tri[2]];
+        }
+
+        std::vector<Uint32> DstTris;
+        DstTris.reserve(m_NumTriangles);
+
+        Uint32 NextCandidate = 0;
+        Uint32 BestTri       = FindBestTriangle(NextCandidate);
+        while (BestTri != InvalidIndex)
+        {
+            DstTris.push_back(BestTri);
+            AddTriangle(BestTri);
+            BestTri = FindBestCachedTriangle();
+            if (BestTri == InvalidIndex)
+                BestTri = FindBestTriangle(NextCandidate);
+        }
+        VERIFY_EXPR(DstTris.size() == m_NumTriangles);
+
+        // pDstIndices may alias m_pIndices, so copy the source indices first
+        std::vector<Uint32> SrcIndices{m_pIndices, m_pIndices + size_t{m_NumTriangles} * 3};
+        for (size_t i = 0; i < DstTris.size(); ++i)
+        {
+            for (Uint32 c = 0; c < 3; ++c)
+                pDstIndices[i * 3 + c] = SrcIndices[size_t{DstTris[i]} * 3 + c];
+        }
+    }
+
+private:
+    static constexpr Uint32 CacheSize         = 32;
+    static constexpr float  CacheDecayPower   = 1.5f;
+    static constexpr float  LastTriScore      = 0.75f;
+    static constexpr float  ValenceBoostScale = 2.0f;
+    static constexpr float  ValenceBoostPower = 0.5f;
+
+    static float ComputeVertexScore(int CachePos, Uint32 NumActiveTris)
+    {
+        if (NumActiveTris == 0)
+            return -1.f;
+
+        float Score = 0;
+        if (CachePos >= 0)
+        {
+            if (CachePos < 3)
+            {
+                // The vertices of the last triangle get a fixed score, so that the algorithm
+                // does not prefer to use the same vertices in the next triangle
+                Score = LastTriScore;
+            }
+            else
+            {
+                VERIFY_EXPR(static_cast<Uint32>(CachePos) < CacheSize);
+                const float Scaler = 1.f / (CacheSize - 3);
+                Score              = std::pow(1.f - static_cast<float>(CachePos - 3) * Scaler, CacheDecayPower);
+            }
+        }
+
+        // Boost vertices with few remaining triangles to get rid of them quickly
+        Score += ValenceBoostScale * std::pow(static_cast<float>(NumActiveTris), -ValenceBoostPower);
+        return Score;
+    }
+
+    void InitAdjacency()
+    {
+        m_NumActiveTris.assign(m_NumVertices, 0);
+        for (Uint32 i = 0; i < m_NumTriangles * 3; ++i)
+            ++m_NumActiveTris[m_pIndices[i]];
+
+        m_AdjOffsets.resize(size_t{m_NumVertices} + 1);
+        m_AdjOffsets[0] = 0;
+        for (Uint32 v = 0; v < m_NumVertices; ++v)
+            m_AdjOffsets[v + 1] = m_AdjOffsets[v] + m_NumActiveTris[v];
+
+        m_AdjTris.resize(m_AdjOffsets[m_NumVertices]);
+        std::vector<Uint32> Fill{m_AdjOffsets.begin(), m_AdjOffsets.end() - 1};
+        for (Uint32 t = 0; t < m_NumTriangles; ++t)
+        {
+            for (Uint32 c = 0; c < 3; ++c)
+                m_AdjTris[Fill[m_pIndices[t * 3 + c]]++] = t;
+        }
+    }
+
+    void AddTriangle(Uint32 Tri)
+    {
+        m_TriAdded[Tri] = true;
+
+        const Uint32* TriVerts = &m_pIndices[Tri * 3];
+
+        // Remove the triangle from the active triangle lists of its vertices
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            const Uint32 v       = TriVerts[c];
+            Uint32*      AdjTris = &m_AdjTris[m_AdjOffsets[v]];
+            for (Uint32 i = 0; i < m_NumActiveTris[v]; ++i)
+            {
+                if (AdjTris[i] == Tri)
+                {
+                    AdjTris[i] = AdjTris[m_NumActiveTris[v] - 1];
+                    --m_NumActiveTris[v];
+                    break;
+                }
+            }
+        }
+
+        // Move the triangle vertices to the front of the LRU cache
+        Uint32 NewCache[CacheSize + 3];
+        Uint32 NewCacheSize = 0;
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            const Uint32 v = TriVerts[c];
+            if (std::find(NewCache, NewCache + NewCacheSize, v) == NewCache + NewCacheSize)
+                NewCache[NewCacheSize++] = v;
+        }
+        for (Uint32 i = 0; i < m_CacheSize; ++i)
+        {
+            const Uint32 v = m_Cache[i];
+            if (std::find(NewCache, NewCache + NewCacheSize, v) == NewCache + NewCacheSize)
+                NewCache[NewCacheSize++] = v;
+        }
+
+        // Vertices that fall out of the cache
+        for (Uint32 i = CacheSize; i < NewCacheSize; ++i)
+            m_VertexCachePos[NewCache[i]] = -1;
+
+        m_CacheSize = std::min(NewCacheSize, CacheSize);
+        for (Uint32 i = 0; i < m_CacheSize; ++i)
+        {
+            m_Cache[i]                    = NewCache[i];
+            m_VertexCachePos[NewCache[i]] = static_cast<int>(i);
+        }
+
+        // Update the scores of all vertices whose cache position has changed and of their triangles
+        for (Uint32 i = 0; i < NewCacheSize; ++i)
+        {
+            const Uint32 v        = NewCache[i];
+            const float  NewScore = ComputeVertexScore(m_VertexCachePos[v], m_NumActiveTris[v]);
+            const float  Delta    = NewScore - m_VertexScore[v];
+            m_VertexScore[v]      = NewScore;
+
+            const Uint32* AdjTris = &m_AdjTris[m_AdjOffsets[v]];
+            for (Uint32 j = 0; j < m_NumActiveTris[v]; ++j)
+                m_TriScore[AdjTris[j]] += Delta;
+        }
+    }
+
+    // Finds the best triangle that uses at least one vertex in the cache
+    Uint32 FindBestCachedTriangle() const
+    {
+        Uint32 BestTri   = InvalidIndex;
+        float  BestScore = -FLT_MAX;
+        for (Uint32 i = 0; i < m_CacheSize; ++i)
+        {
+            const Uint32  v       = m_Cache[i];
+            const Uint32* AdjTris = &m_AdjTris[m_AdjOffsets[v]];
+            for (Uint32 j = 0; j < m_NumActiveTris[v]; ++j)
+            {
+                const Uint32 t = AdjTris[j];
+                if (m_TriScore[t] > BestScore)
+                {
+                    BestScore = m_TriScore[t];
+                    BestTri   = t;
+                }
+            }
+        }
+        return BestTri;
+    }
+
+    // Falls back to the first remaining triangle in the input order when
+    // no triangle in the cache remains. This keeps the algorithm linear.
+    Uint32 FindBestTriangle(Uint32& NextCandidate) const
+    {
+        while (NextCandidate < m_NumTriangles && m_TriAdded[NextCandidate])
+            ++NextCandidate;
+        return NextCandidate < m_NumTriangles ? NextCandidate : InvalidIndex;
+    }
+
+private:
+    const Uint32* const m_pIndices;
+    const Uint32        m_NumTriangles;
+    const Uint32        m_NumVertices;
+
+    std::vector<Uint32> m_NumActiveTris;
+    std::vector<Uint32> m_AdjOffsets;
+    std::vector<Uint32> m_AdjTris;
+
+    std::vector<int>   m_VertexCachePos;
+    std::vector<float> m_VertexScore;
+    std::vector<float> m_TriScore;
+    std::vector<bool>  m_TriAdded;
+
+    Uint32 m_Cache[CacheSize] = {};
+    Uint32 m_CacheSize        = 0;
+};
+
+// FIFO cache simulation used to find the overdraw cluster boundaries
+class FIFOCache
+{
+public:
+    FIFOCache(Uint32 NumVertices, Uint32 CacheSize) :
+        m_Timestamps(NumVertices, 0),
+        m_CacheSize{CacheSize},
+        m_Time{CacheSize}
+    {}
+
+    // Returns the number of cache misses of the triangle
+    Uint32 AddTriangle(const Uint32* Tri)
+    {
+        Uint32 NumMisses = 0;
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            const Uint32 v = Tri[c];
+            // The vertex is in the cache if it was added after the last m_CacheSize insertions
+            if (m_Time - m_Timestamps[v] >= m_CacheSize)
+            {
+                m_Timestamps[v] = ++m_Time;
+                ++NumMisses;
+            }
+        }
+        return NumMisses;
+    }
+
+    void Reset()
+    {
+        // Move the time forward so that all vertices are out of the cache
+        m_Time += m_CacheSize;
+    }
+
+private:
+    std::vector<Uint32> m_Timestamps;
+    const Uint32        m_CacheSize;
+    Uint32              m_Time;
+};
+
+constexpr Uint32 OverdrawCacheSize = 16;
+
+} // namespace
+
+
+void OptimizeVertexCache(Uint32* pDstIndices, const Uint32* pIndices, Uint32 NumIndices, Uint32 NumVertices)
+{
+    if (NumIndices == 0)
+        return;
+
+    DEV_CHECK_ERR(pDstIndices != nullptr && pIndices != nullptr, "Indices must not be null");
+    DEV_CHECK_ERR(NumIndices % 3 == 0, "The number of indices (", NumIndices, ") must be a multiple of 3");
+
+    VertexCacheOptimizer{pIndices, NumIndices, NumVertices}.Optimize(pDstIndices);
+}
+
+
+void OptimizeOverdraw(Uint32*       pDstIndices,
+                      const Uint32* pIndices,
+                      Uint32        NumIndices,
+                      const void*   pPositions,
+                      Uint32        NumVertices,
+                      Uint32        PositionStride,
+                      float         Threshold)
+{
+    if (NumIndices == 0)
+        return;
+
+    DEV_CHECK_ERR(pDstIndices != nullptr && pIndices != nullptr, "Indices must not be null");
+    DEV_CHECK_ERR(pPositions != nullptr, "Vertex positions must not be null");
+    DEV_CHECK_ERR(PositionStride >= sizeof(float3), "Position stride (", PositionStride, ") must be at least ", sizeof(float3));
+    DEV_CHECK_ERR(NumIndices % 3 == 0, "The number of indices (", NumIndices, ") must be a multiple of 3");
+
+    const Uint32 NumTriangles = NumIndices / 3;
+
+    // Hard boundaries are the triangles that miss the cache entirely: the cache is
+    // effectively flushed at these points, so the clusters can be reordered freely.
+    std::vector<Uint32> HardClusters;
+    {
+        FIFOCache Cache{NumVertices, OverdrawCacheSize};
+        for (Uint32 t = 0; t < NumTriangles; ++t)
+        {
+            if (Cache.AddTriangle(&pIndices[t * 3]) == 3)
+                HardClusters.push_back(t);
+        }
+        if (HardClusters.empty() || HardClusters[0] != 0)
+            HardClusters.insert(HardClusters.begin(), 0);
+    }
+    HardClusters.push_back(NumTriangles);
+
+    // Split the hard clusters further as long as the cache miss ratio of every part
+    // does not exceed the ratio of the whole cluster multiplied by the threshold.
+    std::vector<Uint32> Clusters;
+    {
+        FIFOCache Cache{NumVertices, OverdrawCacheSize};
+        for (size_t i = 0; i + 1 < HardClusters.size(); ++i)
+        {
+            const Uint32 Start = HardClusters[i];
+            const Uint32 End   = HardClusters[i + 1];
+
+            Cache.Reset();
+            Uint32 ClusterMisses = 0;
+            for (Uint32 t = Start; t < End; ++t)
+                ClusterMisses += Cache.AddTriangle(&pIndices[t * 3]);
+            const float MaxRatio = static_cast<float>(ClusterMisses) / static_cast<float>(End - Start) * Threshold;
+
+            Clusters.push_back(Start);
+            Cache.Reset();
+            Uint32 SubStart  = Start;
+            Uint32 SubMisses = 0;
+            for (Uint32 t = Start; t < End; ++t)
+            {
+                SubMisses += Cache.AddTriangle(&pIndices[t * 3]);
+                // Do not create a tiny cluster at the end
+                if (t + 1 < End && static_cast<float>(SubMisses) <= MaxRatio * static_cast<float>(t + 1 - SubStart))
+                {
+                    SubStart  = t + 1;
+                    SubMisses = 0;
+                    Clusters.push_back(SubStart);
+                    Cache.Reset();
+                }
+            }
+        }
+    }
+    const size_t NumClusters = Clusters.size();
+    Clusters.push_back(NumTriangles);
+
+    // Compute the mesh centroid and the cluster centroids and normals
+    struct ClusterInfo
+    {
+        float3 Centroid;
+        float3 Normal;
+        float  SortKey = 0;
+        Uint32 Start   = 0;
+        Uint32 End     = 0;
+    };
+    std::vector<ClusterInfo> ClusterInfos(NumClusters);
+
+    float3 MeshCentroid;
+    float  MeshArea = 0;
+    for (size_t i = 0; i < NumClusters; ++i)
+    {
+        ClusterInfo& Info = ClusterInfos[i];
+        Info.Start        = Clusters[i];
+        Info.End          = Clusters[i + 1];
+
+        float ClusterArea = 0;
+        for (Uint32 t = Info.Start; t < Info.End; ++t)
+        {
+            const float3& P0 = GetPosition(pPositions, PositionStride, pIndices[t * 3 + 0]);
+            const float3& P1 = GetPosition(pPositions, PositionStride, pIndices[t * 3 + 1]);
+            const float3& P2 = GetPosition(pPositions, PositionStride, pIndices[t * 3 + 2]);
+
+            const float3 N    = cross(P1 - P0, P2 - P0); // Length is twice the area
+            const float  Area = length(N);
+
+            Info.Centroid += (P0 + P1 + P2) * (Area / 3.f);
+            Info.Normal += N;
+            ClusterArea += Area;
+        }
+
+        MeshCentroid += Info.Centroid;
+        MeshArea += ClusterArea;
+
+        if (ClusterArea > 0)
+            Info.Centroid /= ClusterArea;
+        const float NormalLen = length(Info.Normal);
+        if (NormalLen > 0)
+            Info.Normal /= NormalLen;
+    }
+    if (MeshArea > 0)
+        MeshCentroid /= MeshArea;
+
+    // Clusters that face away from the center are drawn first
+    for (ClusterInfo& Info : ClusterInfos)
+        Info.SortKey = dot(Info.Centroid - MeshCentroid, Info.Normal);
+    std::stable_sort(ClusterInfos.begin(), ClusterInfos.end(),
+                     [](const ClusterInfo& lhs, const ClusterInfo& rhs) {
+                         return lhs.SortKey > rhs.SortKey;
+                     });
+
+    // pDstIndices may alias pIndices, so copy the source indices first
+    std::vector<Uint32> SrcIndices{pIndices, pIndices + NumIndices};
+
+    Uint32* pDst = pDstIndices;
+    for (const ClusterInfo& Info : ClusterInfos)
+    {
+        const size_t Count = size_t{Info.End - Info.Start} * 3;
+        memcpy(pDst, &SrcIndices[size_t{Info.Start} * 3], Count * sizeof(Uint32));
+        pDst += Count;
+    }
+}
+
+
+float ComputeAverageCacheMissRatio(const Uint32* pIndices, Uint32 NumIndices, Uint32 NumVertices, Uint32 CacheSize)
+{
+    const Uint32 NumTriangles = NumIndices / 3;
+    if (NumTriangles == 0)
+        return 0;
+
+    DEV_CHECK_ERR(CacheSize > 0, "Cache size must not be zero");
+
+    FIFOCache Cache{NumVertices, CacheSize};
+    Uint32    NumMisses = 0;
+    for (Uint32 t = 0; t < NumTriangles; ++t)
+        NumMisses += Cache.AddTriangle(&pIndices[t * 3]);
+
+    return static_cast<float>(NumMisses) / static_cast<float>(NumTriangles);
+}
+
+
+Uint32 ComputeVertexFetchRemap(Uint32* pRemap, const Uint32* pIndices, Uint32 NumIndices, Uint32 NumVertices)
+{
+    DEV_CHECK_ERR(pRemap != nullptr, "Remap table must not be null");
+    DEV_CHECK_ERR(NumIndices == 0 || pIndices != nullptr, "Indices must not be null");
+
+    std::fill(pRemap, pRemap + NumVertices, InvalidIndex);
+
+    Uint32 NumUsedVertices = 0;
+    for (Uint32 i = 0; i < NumIndices; ++i)
+    {
+        const Uint32 v = pIndices[i];
+        DEV_CHECK_ERR(v < NumVertices, "Index ", v, " at position ", i, " is out of range [0, ", NumVertices, ")");
+        if (pRemap[v] == InvalidIndex)
+            pRemap[v] = NumUsedVertices++;
+    }
+
+    return NumUsedVertices;
+}
+
+
+void RemapIndexBuffer(Uint32* pDstIndices, const Uint32* pIndices, Uint32 NumIndices, const Uint32* pRemap)
+{
+    for (Uint32 i = 0; i < NumIndices; ++i)
+    {
+        VERIFY(pRemap[pIndices[i]] != InvalidIndex, "Vertex ", pIndices[i], " is referenced by the index buffer, but is not in the remap table");
+        pDstIndices[i] = pRemap[pIndices[i]];
+    }
+}
+
+
+void RemapVertexBuffer(void* pDstVertices, const void* pVertices, Uint32 NumVertices, Uint32 VertexStride, const Uint32* pRemap)
+{
+    DEV_CHECK_ERR(pDstVertices != pVertices, "Vertex buffer can't be remapped in place");
+
+    Uint8*       pDst = static_cast<Uint8*>(pDstVertices);
+    const Uint8* pSrc = static_cast<const Uint8*>(pVertices);
+    for (Uint32 v = 0; v < NumVertices; ++v)
+    {
+        if (pRemap[v] != InvalidIndex)
+            memcpy(pDst + size_t{pRemap[v]} * VertexStride, pSrc + size_t{v} * VertexStride, VertexStride);
+    }
+}
+
+
+bool QuantizeVertices(const VertexQuantizationInfo& Info, QuantizedVertexData& Data)
+{
+    Data = {};
+
+    DEV_CHECK_ERR(Info.NumAttribs == 0 || Info.pAttribs != nullptr, "Attributes must not be null");
+    if (Info.NumAttribs != 0 && Info.pAttribs == nullptr)
+        return false;
+
+    // Quantized size of every attribute, in bytes
+    std::vector<Uint32> AttribOffsets(Info.NumAttribs);
+    for (Uint32 i = 0; i < Info.NumAttribs; ++i)
+    {
+        const VertexAttribQuantizationDesc& Attrib = Info.pAttribs[i];
+        if (Attrib.pData == nullptr && Info.NumVertices != 0)
+        {
+            DEV_ERROR("Data of attribute ", i, " is null");
+            return false;
+        }
+        if (Attrib.NumComponents < 1 || Attrib.NumComponents > 4)
+        {
+            DEV_ERROR("The number of components (", Attrib.NumComponents, ") of attribute ", i, " must be in the range [1, 4]");
+            return false;
+        }
+
+        LayoutElement Elem{Attrib.InputIndex, Info.BufferSlot, Attrib.NumComponents, VT_FLOAT32, False};
+        switch (Attrib.Quantization)
+        {
+            case VERTEX_ATTRIB_QUANTIZATION_NONE:
+                break;
+
+            case VERTEX_ATTRIB_QUANTIZATION_SNORM16:
+            case VERTEX_ATTRIB_QUANTIZATION_FLOAT16:
+                // Three- and one-component 16-bit formats are not universally supported
+                Elem.NumComponents = AlignUp(Attrib.NumComponents, 2u);
+                Elem.ValueType     = Attrib.Quantization == VERTEX_ATTRIB_QUANTIZATION_SNORM16 ? VT_INT16 : VT_FLOAT16;
+                Elem.IsNormalized  = Attrib.Quantization == VERTEX_ATTRIB_QUANTIZATION_SNORM16;
+                break;
+
+            case VERTEX_ATTRIB_QUANTIZATION_OCTAHEDRAL:
+                if (Attrib.NumComponents < 3)
+                {
+                    DEV_ERROR("Octahedral quantization of attribute ", i, " requires 3 or 4 components");
+                    return false;
+                }
+                Elem.NumComponents = Attrib.NumComponents == 3 ? 2 : 4;
+                Elem.ValueType     = VT_INT16;
+                Elem.IsNormalized  = True;
+                break;
+
+            default:
+                DEV_ERROR("Unknown quantization of attribute ", i);
+                return false;
+        }
+
+        Elem.RelativeOffset = Data.VertexStride;
+        AttribOffsets[i]    = Data.VertexStride;
+        Data.VertexStride += Elem.NumComponents * (Elem.ValueType == VT_FLOAT32 ? 4 : 2);
+        Data.Elements.push_back(Elem);
+    }
+    VERIFY_EXPR(Data.VertexStride % 4 == 0);
+    for (LayoutElement& Elem : Data.Elements)
+        Elem.Stride = Data.VertexStride;
+
+    Data.DequantizationScale.assign(Info.NumAttribs, float4{1, 1, 1, 1});
+    Data.DequantizationBias.assign(Info.NumAttribs, float4{0, 0, 0, 0});
+    Data.Vertices.resize(size_t{Data.VertexStride} * Info.NumVertices);
+
+    for (Uint32 i = 0; i < Info.NumAttribs; ++i)
+    {
+        const VertexAttribQuantizationDesc& Attrib    = Info.pAttribs[i];
+        const Uint32                        SrcStride = Attrib.Stride != 0 ? Attrib.Stride : Attrib.NumComponents * static_cast<Uint32>(sizeof(float));
+        const Uint32                        NumComps  = Attrib.NumComponents;
+
+        auto GetSrc = [&](Uint32 v) {
+            float4 Value{0, 0, 0, 0};
+            memcpy(&Value, static_cast<const Uint8*>(Attrib.pData) + size_t{v} * SrcStride, NumComps * sizeof(float));
+            return Value;
+        };
+        auto GetDst = [&](Uint32 v) {
+            return &Data.Vertices[size_t{v} * Data.VertexStride + AttribOffsets[i]];
+        };
+
+        switch (Attrib.Quantization)
+        {
+            case VERTEX_ATTRIB_QUANTIZATION_NONE:
+                for (Uint32 v = 0; v < Info.NumVertices; ++v)
+                {
+                    const float4 Value = GetSrc(v);
+                    memcpy(GetDst(v), &Value, NumComps * sizeof(float));
+                }
+                break;
+
+            case VERTEX_ATTRIB_QUANTIZATION_SNORM16:
+            {
+                float4 MinVal{+FLT_MAX, +FLT_MAX, +FLT_MAX, +FLT_MAX};
+                float4 MaxVal{-FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX};
+                for (Uint32 v = 0; v < Info.NumVertices; ++v)
+                {
+                    const float4 Value = GetSrc(v);
+                    MinVal             = min(MinVal, Value);
+                    MaxVal             = max(MaxVal, Value);
+                }
+
+                float4& Scale = Data.DequantizationScale[i];
+                float4& Bias  = Data.DequantizationBias[i];
+                for (Uint32 c = 0; c < NumComps; ++c)
+                {
+                    Scale[c] = Info.NumVertices != 0 ? (MaxVal[c] - MinVal[c]) * 0.5f : 1.f;
+                    Bias[c]  = Info.NumVertices != 0 ? (MaxVal[c] + MinVal[c]) * 0.5f : 0.f;
+                }
+
+                const Uint32 NumDstComps = Data.Elements[i].NumComponents;
+                for (Uint32 v = 0; v < Info.NumVertices; ++v)
+                {
+                    const float4 Value = GetSrc(v);
+
+                    Int16 Dst[4] = {};
+                    for (Uint32 c = 0; c < NumComps; ++c)
+                        Dst[c] = FloatToSnorm16(Scale[c] > 0 ? (Value[c] - Bias[c]) / Scale[c] : 0.f);
+                    if (NumComps == 3)
+                        Dst[3] = FloatToSnorm16(1.f);
+                    memcpy(GetDst(v), Dst, NumDstComps * sizeof(Int16));
+                }
+                break;
+            }
+
+            case VERTEX_ATTRIB_QUANTIZATION_FLOAT16:
+            {
+                const Uint32 NumDstComps = Data.Elements[i].NumComponents;
+                for (Uint32 v = 0; v < Info.NumVertices; ++v)
+                {
+                    const float4 Value = GetSrc(v);
+
+                    Uint16 Dst[4] = {};
+                    for (Uint32 c = 0; c < NumComps; ++c)
+                        Dst[c] = FloatToHalf(Value[c]);
+                    if (NumComps == 3)
+                        Dst[3] = FloatToHalf(1.f);
+                    memcpy(GetDst(v), Dst, NumDstComps * sizeof(Uint16));
+                }
+                break;
+            }
+
+            case VERTEX_ATTRIB_QUANTIZATION_OCTAHEDRAL:
+            {
+                const Uint32 NumDstComps = Data.Elements[i].NumComponents;
+                for (Uint32 v = 0; v < Info.NumVertices; ++v)
+                {
+                    const float4 Value = GetSrc(v);
+                    const float2 Enc   = EncodeOctahedral(float3{Value.x, Value.y, Value.z});
+
+                    Int16 Dst[4] = {};
+                    Dst[0]       = FloatToSnorm16(Enc.x);
+                    Dst[1]       = FloatToSnorm16(Enc.y);
+                    if (NumComps == 4)
+                        Dst[2] = FloatToSnorm16(Value.w);
+                    memcpy(GetDst(v), Dst, NumDstComps * sizeof(Int16));
+                }
+                break;
+            }
+
+            default:
+                UNEXPECTED("Unknown quantization");
+        }
+    }
+
+    return true;
+}
+
+
+Uint16 FloatToHalf(float Value)
+{
+    Uint32 Bits;
+    memcpy(&Bits, &Value, sizeof(Bits));
+
+    const Uint32 Sign = (Bits >> 16) & 0x8000u;
+    const Uint32 Abs  = Bits & 0x7FFFFFFFu;
+
+    if (Abs >= 0x7F800000u)
+    {
+        // Inf or NaN
+        return static_cast<Uint16>(Sign | 0x7C00u | (Abs > 0x7F800000u ? 0x200u : 0u));
+    }
+
+    if (Abs >= 0x477FF000u)
+    {
+        // Values that round to a number greater than 65504 overflow to infinity
+        return static_cast<Uint16>(Sign | 0x7C00u);
+    }
+
+    if (Abs < 0x38800000u)
+    {
+        // Denormal or zero: the value is a multiple of 2^-24.
+        // Default rounding mode rounds to the nearest even value.
+        float AbsValue;
+        memcpy(&AbsValue, &Abs, sizeof(AbsValue));
+        return static_cast<Uint16>(Sign | static_cast<Uint32>(std::nearbyint(AbsValue * 16777216.f)));
+    }
+
+    // Rebias the exponent and round the mantissa to the nearest even value
+    Uint32 Half = Abs - ((127u - 15u) << 23u);
+    Half        = (Half + 0x0FFFu + ((Half >> 13u) & 1u)) >> 13u;
+    return static_cast<Uint16>(Sign | Half);
+}
+
+float HalfToFloat(Uint16 Value)
+{
+    const Uint32 Sign     = (Value & 0x8000u) << 16u;
+    const Uint32 Exponent = (Value >> 10u) & 0x1Fu;
+    const Uint32 Mantissa = Value & 0x3FFu;
+
+    if (Exponent == 0)
+    {
+        // Denormal or zero
+        const float AbsValue = static_cast<float>(Mantissa) / 16777216.f;
+        return Sign != 0 ? -AbsValue : AbsValue;
+    }
+
+    Uint32 Bits;
+    if (Exponent == 0x1F)
+        Bits = Sign | 0x7F800000u | (Mantissa << 13u); // Inf or NaN
+    else
+        Bits = Sign | ((Exponent + 127u - 15u) << 23u) | (Mantissa << 13u);
+
+    float Result;
+    memcpy(&Result, &Bits, sizeof(Result));
+    return Result;
+}
+
+Int16 FloatToSnorm16(float Value)
+{
+    return static_cast<Int16>(std::round(clamp(Value, -1.f, 1.f) * 32767.f));
+}
+
+float Snorm16ToFloat(Int16 Value)
+{
+    return std::max(static_cast<float>(Value) / 32767.f, -1.f);
+}
+
+float2 EncodeOctahedral(const float3& Dir)
+{
+    const float L1Norm = std::abs(Dir.x) + std::abs(Dir.y) + std::abs(Dir.z);
+    if (L1Norm == 0)
+        return float2{0, 0};
+
+    float2 Enc{Dir.x / L1Norm, Dir.y / L1Norm};
+    if (Dir.z < 0)
+    {
+        // Fold the lower hemisphere over the diagonals
+        Enc = float2{
+            (1.f - std::abs(Enc.y)) * (Enc.x >= 0 ? 1.f : -1.f),
+            (1.f - std::abs(Enc.x)) * (Enc.y >= 0 ? 1.f : -1.f),
+        };
+    }
+    return Enc;
+}
+
+float3 DecodeOctahedral(const float2& Enc)
+{
+    float3      Dir{Enc.x, Enc.y, 1.f - std::abs(Enc.x) - std::abs(Enc.y)};
+    const float t = std::max(-Dir.z, 0.f);
+    Dir.x += Dir.x >= 0 ? -t : t;
+    Dir.y += Dir.y >= 0 ? -t : t;
+    return normalize(Dir);
+}
+
+} // namespace Diligent
@@ -0,0 +1,543 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "MeshletBuilder.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 InvalidIndex = ~0u;
+
+class MeshletBuilderImpl
+{
+public:
+    MeshletBuilderImpl(const MeshletBuildInfo& BuildInfo, MeshletData& Data) :
+        m_BuildInfo{BuildInfo},
+        m_Data{Data},
+        m_NumTriangles{BuildInfo.NumIndices / 3}
+    {
+    }
+
+    void Build()
+    {
+        InitTriangles();
+        InitAdjacency();
+
+        m_VertexToLocal.assign(m_BuildInfo.NumVertices, InvalidIndex);
+        // Degenerate triangles are marked as used and are never added to meshlets
+        m_TriangleUsed = m_TriangleDegenerate;
+
+        Uint32 NextSeedScan = 0;
+        Uint32 Seed         = InvalidIndex;
+        while (true)
+        {
+            if (Seed == InvalidIndex)
+            {
+                // Continue from the first unused triangle
+                while (NextSeedScan < m_NumTriangles && m_TriangleUsed[NextSeedScan])
+                    ++NextSeedScan;
+                if (NextSeedScan == m_NumTriangles)
+                    break;
+                Seed = NextSeedScan;
+            }
+
+            BeginMeshlet();
+            AddTriangle(Seed);
+
+            Uint32 NextTri = InvalidIndex;
+            while ((NextTri = FindBestCandidate()) != InvalidIndex)
+                AddTriangle(NextTri);
+
+            // Seed the next meshlet with a triangle adjacent to this one to keep meshlets coherent
+            Seed = FindAdjacentSeed();
+            EndMeshlet();
+        }
+    }
+
+private:
+    const float3& GetPosition(Uint32 Vert) const
+    {
+        const Uint8* pVertices = static_cast<const Uint8*>(m_BuildInfo.pVertices);
+        return *reinterpret_cast<const float3*>(pVertices + size_t{Vert} * m_BuildInfo.VertexStride);
+    }
+
+    const Uint32* GetTriangle(Uint32 Tri) const
+    {
+        return m_BuildInfo.pIndices + size_t{Tri} * 3;
+    }
+
+    void InitTriangles()
+    {
+        m_TriangleNormals.resize(m_NumTriangles);
+        m_TriangleCentroids.resize(m_NumTriangles);
+        m_TriangleDegenerate.resize(m_NumTriangles);
+
+        double TotalEdgeLength = 0;
+        for (Uint32 Tri = 0; Tri < m_NumTriangles; ++Tri)
+        {
+            const Uint32* Idx = GetTriangle(Tri);
+            const float3& P0  = GetPosition(Idx[0]);
+            const float3& P1  = GetPosition(Idx[1]);
+            const float3& P2  = GetPosition(Idx[2]);
+
+            const float3 N   = cross(P1 - P0, P2 - P0);
+            const float  Len = length(N);
+
+            m_TriangleDegenerate[Tri] = Idx[0] == Idx[1] || Idx[1] == Idx[2] || Idx[0] == Idx[2] || Len == 0;
+            m_TriangleNormals[Tri]    = Len > 0 ? N / Len : float3{};
+            m_TriangleCentroids[Tri]  = (P0 + P1 + P2) / 3.f;
+
+            TotalEdgeLength += length(P1 - P0) + length(P2 - P1) + length(P0 - P2);
+        }
+
+        const float AvgEdgeLength = m_NumTriangles > 0 ? static_cast<float>(TotalEdgeLength / (m_NumTriangles * 3)) : 0.f;
+        m_InvDistanceScale        = AvgEdgeLength > 0 ? 1.f / AvgEdgeLength : 0.f;
+    }
+
+    void InitAdjacency()
+    {
+        // Compressed vertex -> triangle adjacency
+        m_AdjacencyOffsets.assign(size_t{m_BuildInfo.NumVertices} + 1, 0);
+        for (Uint32 Tri = 0; Tri < m_NumTriangles; ++Tri)
+        {
+            if (m_TriangleDegenerate[Tri])
+                continue;
+            const Uint32* Idx = GetTriangle(Tri);
+            for (Uint32 v = 0; v < 3; ++v)
+                ++m_AdjacencyOffsets[Idx[v] + 1];
+        }
+        for (size_t v = 1; v < m_AdjacencyOffsets.size(); ++v)
+            m_AdjacencyOffsets[v] += m_AdjacencyOffsets[v - 1];
+
+        m_Adjacency.resize(m_AdjacencyOffsets.back());
+        m_LiveTriangles.resize(m_BuildInfo.NumVertices);
+        for (Uint32 v = 0; v < m_BuildInfo.NumVertices; ++v)
+            m_LiveTriangles[v] = m_AdjacencyOffsets[v + 1] - m_AdjacencyOffsets[v];
+
+        std::vector<Uint32> Fill{m_AdjacencyOffsets.begin(), m_AdjacencyOffsets.end() - 1};
+        for (Uint32 Tri = 0; Tri < m_NumTriangles; ++Tri)
+        {
+            if (m_TriangleDegenerate[Tri])
+                continue;
+            const Uint32* Idx = GetTriangle(Tri);
+            for (Uint32 v = 0; v < 3; ++v)
+                m_Adjacency[Fill[Idx[v]]++] = Tri;
+        }
+    }
+
+    void BeginMeshlet()
+    {
+        Meshlet NewMeshlet;
+        NewMeshlet.VertexOffset   = static_cast<Uint32>(m_Data.VertexIndices.size());
+        NewMeshlet.TriangleOffset = static_cast<Uint32>(m_Data.TriangleIndices.size());
+        m_Data.Meshlets.push_back(NewMeshlet);
+
+        m_ConeSum     = float3{};
+        m_CentroidSum = float3{};
+    }
+
+    void EndMeshlet()
+    {
+        const Meshlet& CurrMeshlet = m_Data.Meshlets.back();
+        for (Uint32 v = 0; v < CurrMeshlet.VertexCount; ++v)
+            m_VertexToLocal[m_Data.VertexIndices[CurrMeshlet.VertexOffset + v]] = InvalidIndex;
+    }
+
+    Uint32 CountNewVertices(Uint32 Tri) const
+    {
+        const Uint32* Idx = GetTriangle(Tri);
+        return (m_VertexToLocal[Idx[0]] == InvalidIndex ? 1 : 0) +
+            (m_VertexToLocal[Idx[1]] == InvalidIndex ? 1 : 0) +
+            (m_VertexToLocal[Idx[2]] == InvalidIndex ? 1 : 0);
+    }
+
+    void AddTriangle(Uint32 Tri)
+    {
+        VERIFY_EXPR(!m_TriangleUsed[Tri]);
+        m_TriangleUsed[Tri] = true;
+
+        Meshlet& CurrMeshlet = m_Data.Meshlets.back();
+
+        const Uint32* Idx = GetTriangle(Tri);
+        Uint32        LocalIdx[3];
+        for (Uint32 v = 0; v < 3; ++v)
+        {
+            Uint32& Local = m_VertexToLocal[Idx[v]];
+            if (Local == InvalidIndex)
+            {
+                Local = CurrMeshlet.VertexCount++;
+                m_Data.VertexIndices.push_back(Idx[v]);
+            }
+            LocalIdx[v] = Local;
+
+            VERIFY_EXPR(m_LiveTriangles[Idx[v]] > 0);
+            --m_LiveTriangles[Idx[v]];
+        }
+        VERIFY_EXPR(CurrMeshlet.VertexCount <= m_BuildInfo.MaxVertices);
+
+        m_Data.TriangleIndices.push_back(LocalIdx[0] | (LocalIdx[1] << 8u) | (LocalIdx[2] << 16u));
+        ++CurrMeshlet.TriangleCount;
+
+        m_ConeSum += m_TriangleNormals[Tri];
+        m_CentroidSum += m_TriangleCentroids[Tri];
+    }
+
+    // Returns the unused triangle adjacent to the current meshlet that fits into
+    // the meshlet and adds the fewest new vertices, or InvalidIndex if there is none.
+    Uint32 FindBestCandidate() const
+    {
+        const Meshlet& CurrMeshlet = m_Data.Meshlets.back();
+        if (CurrMeshlet.TriangleCount >= m_BuildInfo.MaxTriangles)
+            return InvalidIndex;
+
+        const float3 Centroid = m_CentroidSum / static_cast<float>(CurrMeshlet.TriangleCount);
+        const float  ConeLen  = length(m_ConeSum);
+        const float3 ConeAxis = ConeLen > 0 ? m_ConeSum / ConeLen : float3{};
+
+        Uint32 BestTri         = InvalidIndex;
+        Uint32 BestNewVertices = 4;
+        float  BestScore       = FLT_MAX;
+        for (Uint32 v = 0; v < CurrMeshlet.VertexCount; ++v)
+        {
+            const Uint32 Vert = m_Data.VertexIndices[CurrMeshlet.VertexOffset + v];
+            if (m_LiveTriangles[Vert] == 0)
+                continue;
+
+            for (Uint32 a = m_AdjacencyOffsets[Vert]; a < m_AdjacencyOffsets[Vert + 1]; ++a)
+            {
+                const Uint32 Tri = m_Adjacency[a];
+                if (m_TriangleUsed[Tri])
+                    continue;
+
+                const Uint32 NewVertices = CountNewVertices(Tri);
+                if (CurrMeshlet.VertexCount + NewVertices > m_BuildInfo.MaxVertices || NewVertices > BestNewVertices)
+                    continue;
+
+                // Prefer triangles that are close to the meshlet and aligned with its normal cone
+                const float Distance = length(m_TriangleCentroids[Tri] - Centroid) * m_InvDistanceScale;
+                const float ConeDev  = 1.f - dot(m_TriangleNormals[Tri], ConeAxis);
+                const float Score    = Distance * (1.f - m_BuildInfo.ConeWeight) + ConeDev * m_BuildInfo.ConeWeight * 4.f;
+                if (NewVertices < BestNewVertices || Score < BestScore)
+                {
+                    BestTri         = Tri;
+                    BestNewVertices = NewVertices;
+                    BestScore       = Score;
+                }
+            }
+        }
+        return BestTri;
+    }
+
+    // Returns an unused triangle adjacent to the current meshlet with the fewest
+    // remaining neighbors, which keeps the boundary of the processed region short.
+    Uint32 FindAdjacentSeed() const
+    {
+        const Meshlet& CurrMeshlet = m_Data.Meshlets.back();
+
+        Uint32 BestTri   = InvalidIndex;
+        Uint32 BestScore = ~0u;
+        for (Uint32 v = 0; v < CurrMeshlet.VertexCount; ++v)
+        {
+            const Uint32 Vert = m_Data.VertexIndices[CurrMeshlet.VertexOffset + v];
+            if (m_LiveTriangles[Vert] == 0)
+                continue;
+
+            for (Uint32 a = m_AdjacencyOffsets[Vert]; a < m_AdjacencyOffsets[Vert + 1]; ++a)
+            {
+                const Uint32 Tri = m_Adjacency[a];
+                if (m_TriangleUsed[Tri])
+                    continue;
+
+                const Uint32* Idx   = GetTriangle(Tri);
+                const Uint32  Score = m_LiveTriangles[Idx[0]] + m_LiveTriangles[Idx[1]] + m_LiveTriangles[Idx[2]];
+                if (Score < BestScore)
+                {
+                    BestTri   = Tri;
+                    BestScore = Score;
+                }
+            }
+        }
+        return BestTri;
+    }
+
+private:
+    const MeshletBuildInfo& m_BuildInfo;
+    MeshletData&            m_Data;
+    const Uint32            m_NumTriangles;
+
+    std::vector<float3> m_TriangleNormals;
+    std::vector<float3> m_TriangleCentroids;
+    std::vector<bool>   m_TriangleDegenerate;
+    std::vector<bool>   m_TriangleUsed;
+    float               m_InvDistanceScale = 0;
+
+    std::vector<Uint32> m_AdjacencyOffsets;
+    std::vector<Uint32> m_Adjacency;
+    // The number of unused non-degenerate triangles that reference the vertex
+    std::vector<Uint32> m_LiveTriangles;
+    // Index of the vertex in the current meshlet, or InvalidIndex
+    std::vector<Uint32> m_VertexToLocal;
+
+    float3 m_ConeSum;
+    float3 m_CentroidSum;
+};
+
+} // namespace
+
+bool BuildMeshlets(const MeshletBuildInfo& BuildInfo, MeshletData& Data)
+{
+    Data = {};
+
+    if (BuildInfo.NumIndices == 0)
+        return true;
+
+    DEV_CHECK_ERR(BuildInfo.pVertices != nullptr, "Vertex data must not be null");
+    DEV_CHECK_ERR(BuildInfo.pIndices != nullptr, "Index data must not be null");
+    DEV_CHECK_ERR(BuildInfo.VertexStride >= sizeof(float3), "Vertex stride (", BuildInfo.VertexStride, ") must be at least ", sizeof(float3));
+    DEV_CHECK_ERR(BuildInfo.NumIndices % 3 == 0, "The number of indices (", BuildInfo.NumIndices, ") must be a multiple of 3");
+    DEV_CHECK_ERR(BuildInfo.MaxVertices >= 3 && BuildInfo.MaxVertices <= 256, "The maximum number of meshlet vertices (", BuildInfo.MaxVertices, ") must be in the range [3, 256]");
+    DEV_CHECK_ERR(BuildInfo.MaxTriangles >= 1 && BuildInfo.MaxTriangles <= 256, "The maximum number of meshlet triangles (", BuildInfo.MaxTriangles, ") must be in the range [1, 256]");
+    DEV_CHECK_ERR(BuildInfo.ConeWeight >= 0 && BuildInfo.ConeWeight <= 1, "Cone weight (", BuildInfo.ConeWeight, ") must be in the range [0, 1]");
+    if (BuildInfo.pVertices == nullptr ||
+        BuildInfo.pIndices == nullptr ||
+        BuildInfo.VertexStride < sizeof(float3) ||
+        BuildInfo.NumIndices % 3 != 0 ||
+        BuildInfo.MaxVertices < 3 || BuildInfo.MaxVertices > 256 ||
+        BuildInfo.MaxTriangles < 1 || BuildInfo.MaxTriangles > 256)
+        return false;
+
+    for (Uint32 i = 0; i < BuildInfo.NumIndices; ++i)
+    {
+        if (BuildInfo.pIndices[i] >= BuildInfo.NumVertices)
+        {
+            DEV_ERROR("Index ", BuildInfo.pIndices[i], " at position ", i, " is out of range [0, ", BuildInfo.NumVertices, ")");
+            return false;
+        }
+    }
+
+    MeshletBuilderImpl Builder{BuildInfo, Data};
+    Builder.Build();
+
+    Data.Bounds.resize(Data.Meshlets.size());
+    for (Uint32 i = 0; i < Data.Meshlets.size(); ++i)
+        Data.Bounds[i] = ComputeMeshletBounds(BuildInfo, Data, i);
+
+    return true;
+}
+
+MeshletBounds ComputeMeshletBounds(const MeshletBuildInfo& BuildInfo, const MeshletData& Data, Uint32 MeshletId)
+{
+    VERIFY_EXPR(MeshletId < Data.Meshlets.size());
+    const Meshlet& CurrMeshlet = Data.Meshlets[MeshletId];
+
+    const Uint8* pVertices   = static_cast<const Uint8*>(BuildInfo.pVertices);
+    auto         GetPosition = [&](Uint32 LocalIdx) -> const float3& {
+        const Uint32 Vert = Data.VertexIndices[CurrMeshlet.VertexOffset + LocalIdx];
+        return *reinterpret_cast<const float3*>(pVertices + size_t{Vert} * BuildInfo.VertexStride);
+    };
+
+    MeshletBounds Bounds;
+    if (CurrMeshlet.VertexCount == 0)
+        return Bounds;
+
+    // Bounding sphere centered at the bounding box center
+    float3 BoxMin = GetPosition(0);
+    float3 BoxMax = BoxMin;
+    for (Uint32 v = 1; v < CurrMeshlet.VertexCount; ++v)
+    {
+        BoxMin = (std::min)(BoxMin, GetPosition(v));
+        BoxMax = (std::max)(BoxMax, GetPosition(v));
+    }
+    Bounds.Center = (BoxMin + BoxMax) * 0.5f;
+    for (Uint32 v = 0; v < CurrMeshlet.VertexCount; ++v)
+        Bounds.Radius = (std::max)(Bounds.Radius, length(GetPosition(v) - Bounds.Center));
+
+    // Normal cone
+    std::vector<float3> Normals;
+    std::vector<float3> Corners;
+    Normals.reserve(CurrMeshlet.TriangleCount);
+    Corners.reserve(CurrMeshlet.TriangleCount);
+    float3 ConeSum;
+    for (Uint32 t = 0; t < CurrMeshlet.TriangleCount; ++t)
+    {
+        const Uint32  Packed = Data.TriangleIndices[CurrMeshlet.TriangleOffset + t];
+        const float3& P0     = GetPosition(Packed & 0xFFu);
+        const float3& P1     = GetPosition((Packed >> 8u) & 0xFFu);
+        const float3& P2     = GetPosition((Packed >> 16u) & 0xFFu);
+
+        const float3 N   = cross(P1 - P0, P2 - P0);
+        const float  Len = length(N);
+        if (Len == 0)
+            continue;
+
+        Normals.push_back(N / Len);
+        Corners.push_back(P0);
+        ConeSum += Normals.back();
+    }
+
+    const float ConeLen = length(ConeSum);
+    if (Normals.empty() || ConeLen == 0)
+        return Bounds;
+
+    Bounds.ConeAxis = ConeSum / ConeLen;
+
+    float MinDot = 1;
+    for (const float3& N : Normals)
+        MinDot = (std::min)(MinDot, dot(N, Bounds.ConeAxis));
+
+    // The cone is too wide to cull anything (the half-angle is close to 90 degrees)
+    if (MinDot <= 0.1f)
+    {
+        Bounds.ConeApex = Bounds.Center;
+        return Bounds;
+    }
+
+    // Move the apex back along the axis until all triangle planes are in front of it,
+    // so that the apex test is conservative for every triangle.
+    float MaxT = 0;
+    for (size_t t = 0; t < Normals.size(); ++t)
+    {
+        const float DC = dot(Bounds.Center - Corners[t], Normals[t]);
+        const float DN = dot(Bounds.ConeAxis, Normals[t]);
+        VERIFY_EXPR(DN > 0);
+        MaxT = (std::max)(MaxT, DC / DN);
+    }
+
+    Bounds.ConeApex   = Bounds.Center - Bounds.ConeAxis * MaxT;
+    Bounds.ConeCutoff = std::sqrt(1 - MinDot * MinDot);
+
+    return Bounds;
+}
+
+const char* GetMeshletCullingShaderSource()
+{
+    return R"(
+#ifndef MESHLET_CULLING_GROUP_SIZE
+#    define MESHLET_CULLING_GROUP_SIZE 32
+#endif
+
+struct Meshlet
+{
+    uint VertexOffset;
+    uint TriangleOffset;
+    uint VertexCount;
+    uint TriangleCount;
+};
+
+struct MeshletBounds
+{
+    float3 Center;
+    float  Radius;
+    float3 ConeApex;
+    float  ConeCutoff;
+    float3 ConeAxis;
+    float  Padding;
+};
+
+struct MeshletCullingConstants
+{
+    float4 FrustumPlanes[6];
+    float4 CameraPosition;
+    uint   MeshletCount;
+    uint   EnableConeCulling;
+    uint   Padding0;
+    uint   Padding1;
+};
+
+struct MeshletCullingPayload
+{
+    uint MeshletIndices[MESHLET_CULLING_GROUP_SIZE];
+};
+
+// Returns the indices of the triangle vertices in the meshlet
+uint3 UnpackMeshletTriangle(uint PackedTriangle)
+{
+    return uint3(PackedTriangle & 0xFFu, (PackedTriangle >> 8u) & 0xFFu, (PackedTriangle >> 16u) & 0xFFu);
+}
+
+#ifndef MESHLET_CULLING_NO_ENTRY_POINT
+
+cbuffer cbMeshletCulling
+{
+    MeshletCullingConstants g_Culling;
+}
+
+StructuredBuffer<MeshletBounds> g_MeshletBounds;
+
+groupshared MeshletCullingPayload s_Payload;
+groupshared uint                  s_NumVisibleMeshlets;
+
+bool IsMeshletVisible(MeshletBounds Bounds)
+{
+    for (uint i = 0; i < 6; ++i)
+    {
+        float4 Plane = g_Culling.FrustumPlanes[i];
+        if (dot(Plane.xyz, Bounds.Center) + Plane.w < -Bounds.Radius)
+            return false;
+    }
+
+    // All triangles of the meshlet face away from the camera
+    if (g_Culling.EnableConeCulling != 0u && Bounds.ConeCutoff < 1.0 &&
+        dot(normalize(Bounds.ConeApex - g_Culling.CameraPosition.xyz), Bounds.ConeAxis) >= Bounds.ConeCutoff)
+        return false;
+
+    return true;
+}
+
+[numthreads(MESHLET_CULLING_GROUP_SIZE, 1, 1)]
+void main(uint DTid : SV_DispatchThreadID,
+          uint GI   : SV_GroupIndex)
+{
+    if (GI == 0u)
+        s_NumVisibleMeshlets = 0u;
+    GroupMemoryBarrierWithGroupSync();
+
+    if (DTid < g_Culling.MeshletCount && IsMeshletVisible(g_MeshletBounds[DTid]))
+    {
+        uint Index;
+        InterlockedAdd(s_NumVisibleMeshlets, 1u, Index);
+        s_Payload.MeshletIndices[Index] = DTid;
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    DispatchMesh(s_NumVisibleMeshlets, 1, 1, s_Payload);
+}
+
+#endif
+)";
+}
+
+} // namespace Diligent
@@ -0,0 +1,405 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MultiGPURenderer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "OffScreenSwapChain.hpp"
+
+#if DILIGENT_RENDER_STATE_CACHE_SUPPORTED
+#    include "RenderStateCache.h"
+#endif
+
+namespace Diligent
+{
+
+std::vector<Rect> MultiGPURenderer::ComputeTiles(Uint32 FrameWidth, Uint32 FrameHeight, Uint32 TileWidth, Uint32 TileHeight)
+{
+    std::vector<Rect> Tiles;
+    if (FrameWidth == 0 || FrameHeight == 0 || TileWidth == 0 || TileHeight == 0)
+        return Tiles;
+
+    Tiles.reserve(size_t{(FrameWidth + TileWidth - 1) / TileWidth} * size_t{(FrameHeight + TileHeight - 1) / TileHeight});
+    for (Uint32 y = 0; y < FrameHeight; y += TileHeight)
+    {
+        for (Uint32 x = 0; x < FrameWidth; x += TileWidth)
+        {
+            Tiles.emplace_back(static_cast<Int32>(x),
+                               static_cast<Int32>(y),
+                               static_cast<Int32>(std::min(x + TileWidth, FrameWidth)),
+                               static_cast<Int32>(std::min(y + TileHeight, FrameHeight)));
+        }
+    }
+    return Tiles;
+}
+
+MultiGPURenderer::MultiGPURenderer(const MultiGPURendererCreateInfo& CI) :
+    m_Mode{CI.Mode},
+    m_FrameWidth{CI.FrameWidth},
+    m_FrameHeight{CI.FrameHeight},
+    m_ColorFormat{CI.ColorBufferFormat},
+    m_PixelSize{GetTextureFormatElementSize(CI.ColorBufferFormat)},
+    m_NumReadbacksInFlight{std::max(CI.NumReadbacksInFlight, 1u)},
+    m_InitDevice{CI.InitDevice},
+    m_Render{CI.Render},
+    m_FrameCallback{CI.FrameCallback}
+{
+    DEV_CHECK_ERR(CI.pEngineFactory != nullptr, "Engine factory must not be null");
+    DEV_CHECK_ERR(CI.CreateDevice, "Device creation callback must not be null");
+    DEV_CHECK_ERR(CI.Render, "Render callback must not be null");
+    DEV_CHECK_ERR(m_FrameWidth > 0 && m_FrameHeight > 0, "Frame size must not be zero");
+    DEV_CHECK_ERR(GetTextureFormatAttribs(m_ColorFormat).ComponentType != COMPONENT_TYPE_COMPRESSED && m_PixelSize > 0,
+                  "Color buffer format must not be compressed or unknown");
+
+    Uint32 SwapChainWidth  = m_FrameWidth;
+    Uint32 SwapChainHeight = m_FrameHeight;
+    if (m_Mode == MULTI_GPU_RENDER_MODE_SPLIT_FRAME)
+    {
+        DEV_CHECK_ERR(CI.TileWidth > 0 && CI.TileHeight > 0, "Tile size must not be zero");
+        m_Tiles         = ComputeTiles(m_FrameWidth, m_FrameHeight, CI.TileWidth, CI.TileHeight);
+        SwapChainWidth  = std::min(CI.TileWidth, m_FrameWidth);
+        SwapChainHeight = std::min(CI.TileHeight, m_FrameHeight);
+    }
+    else
+    {
+        m_Tiles.emplace_back(0, 0, static_cast<Int32>(m_FrameWidth), static_cast<Int32>(m_FrameHeight));
+    }
+
+    Uint32 NumAdapters = 0;
+    CI.pEngineFactory->EnumerateAdapters(CI.MinVersion, NumAdapters, nullptr);
+    std::vector<GraphicsAdapterInfo> Adapters(NumAdapters);
+    if (NumAdapters > 0)
+        CI.pEngineFactory->EnumerateAdapters(CI.MinVersion, NumAdapters, Adapters.data());
+
+    for (Uint32 AdapterId = 0; AdapterId < NumAdapters; ++AdapterId)
+    {
+        if (CI.MaxDevices != 0 && m_Devices.size() >= CI.MaxDevices)
+            break;
+
+        const GraphicsAdapterInfo& AdapterInfo = Adapters[AdapterId];
+        if (CI.SkipSoftwareAdapters && AdapterInfo.Type == ADAPTER_TYPE_SOFTWARE)
+            continue;
+
+        std::unique_ptr<DeviceData> pDev = std::make_unique<DeviceData>();
+        CI.CreateDevice(AdapterId, AdapterInfo, &pDev->pDevice, &pDev->pContext);
+        if (!pDev->pDevice || !pDev->pContext)
+        {
+            LOG_WARNING_MESSAGE("Skipping adapter ", AdapterId, " (", AdapterInfo.Description, "): device was not created");
+            continue;
+        }
+        pDev->Index = static_cast<Uint32>(m_Devices.size());
+
+        SwapChainDesc SCDesc;
+        SCDesc.Width             = SwapChainWidth;
+        SCDesc.Height            = SwapChainHeight;
+        SCDesc.ColorBufferFormat = m_ColorFormat;
+        SCDesc.DepthBufferFormat = CI.DepthBufferFormat;
+        SCDesc.BufferCount       = m_NumReadbacksInFlight;
+        CreateOffScreenSwapChain(pDev->pDevice, pDev->pContext, SCDesc, &pDev->pSwapChain);
+        if (!pDev->pSwapChain)
+        {
+            LOG_WARNING_MESSAGE("Skipping adapter ", AdapterId, " (", AdapterInfo.Description, "): failed to create off-screen swap chain");
+            continue;
+        }
+
+        ReadbackQueueCreateInfo ReadbackCI;
+        ReadbackCI.NumFramesInFlight = m_NumReadbacksInFlight;
+        pDev->pReadbacks             = std::make_unique<ReadbackQueue>(pDev->pDevice, ReadbackCI);
+
+#if DILIGENT_RENDER_STATE_CACHE_SUPPORTED
+        if (CI.pArchiverFactory != nullptr)
+        {
+            RenderStateCacheCreateInfo CacheCI;
+            CacheCI.pDevice          = pDev->pDevice;
+            CacheCI.pArchiverFactory = CI.pArchiverFactory;
+            CacheCI.pSharedCache     = !m_Devices.empty() ? GetRenderStateCache(0) : nullptr;
+
+            RefCntAutoPtr<IRenderStateCache> pCache;
+            CreateRenderStateCache(CacheCI, &pCache);
+            if (pCache)
+                pDev->pStateCache = pCache;
+            else
+                LOG_WARNING_MESSAGE("Failed to create render state cache for adapter ", AdapterId, " (", AdapterInfo.Description, ')');
+        }
+#else
+        if (CI.pArchiverFactory != nullptr)
+            LOG_WARNING_MESSAGE_ONCE("Render state cache is not supported: the archiver factory is ignored");
+#endif
+
+        m_Devices.emplace_back(std::move(pDev));
+    }
+
+    if (m_Devices.empty())
+    {
+        LOG_ERROR_MESSAGE("No devices have been created for multi-GPU rendering");
+        return;
+    }
+
+    m_MaxFramesInFlight = CI.MaxFramesInFlight != 0 ? CI.MaxFramesInFlight : GetNumDevices() * 2;
+
+    for (std::unique_ptr<DeviceData>& pDev : m_Devices)
+    {
+        pDev->Worker = std::thread{&MultiGPURenderer::WorkerThread, this, std::ref(*pDev)};
+    }
+}
+
+MultiGPURenderer::~MultiGPURenderer()
+{
+    WaitForFrames();
+
+    {
+        std::lock_guard<std::mutex> Lock{m_JobsMtx};
+        m_Stop = true;
+    }
+    m_JobsCV.notify_all();
+
+    for (std::unique_ptr<DeviceData>& pDev : m_Devices)
+    {
+        if (pDev->Worker.joinable())
+            pDev->Worker.join();
+    }
+}
+
+IRenderStateCache* MultiGPURenderer::GetRenderStateCache(Uint32 DeviceIndex) const
+{
+#if DILIGENT_RENDER_STATE_CACHE_SUPPORTED
+    return m_Devices[DeviceIndex]->pStateCache.RawPtr<IRenderStateCache>();
+#else
+    return nullptr;
+#endif
+}
+
+Uint64 MultiGPURenderer::RenderFrame()
+{
+    if (m_Devices.empty())
+    {
+        UNEXPECTED("No devices are available");
+        return m_NextFrameId++;
+    }
+
+    Uint64 FrameId = 0;
+    {
+        std::unique_lock<std::mutex> Lock{m_FramesMtx};
+        m_FramesCV.wait(Lock, [this] { return m_NumFramesInFlight < m_MaxFramesInFlight; });
+
+        FrameId = m_NextFrameId++;
+        ++m_NumFramesInFlight;
+
+        if (m_Mode == MULTI_GPU_RENDER_MODE_SPLIT_FRAME)
+        {
+            PendingFrame& Frame = m_PendingFrames[FrameId];
+            if (!m_FreePixelBuffers.empty())
+            {
+                Frame.Pixels = std::move(m_FreePixelBuffers.back());
+                m_FreePixelBuffers.pop_back();
+            }
+            Frame.Pixels.resize(size_t{m_FrameWidth} * size_t{m_FrameHeight} * size_t{m_PixelSize});
+            Frame.NumJobsLeft = static_cast<Uint32>(m_Tiles.size());
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_JobsMtx};
+        for (const Rect& Tile : m_Tiles)
+            m_Jobs.push_back({FrameId, Tile});
+    }
+    m_JobsCV.notify_all();
+
+    return FrameId;
+}
+
+void MultiGPURenderer::WaitForFrames()
+{
+    std::unique_lock<std::mutex> Lock{m_FramesMtx};
+    m_FramesCV.wait(Lock, [this] { return m_NumFramesInFlight == 0; });
+}
+
+void MultiGPURenderer::WorkerThread(DeviceData& Dev)
+{
+    if (m_InitDevice)
+        m_InitDevice(Dev.Index, Dev.pDevice, Dev.pContext, GetRenderStateCache(Dev.Index));
+
+    while (true)
+    {
+        Job  J;
+        bool HasJob = false;
+        {
+            // Only this thread changes the number of pending readbacks of the device
+            const bool CanTakeJob = Dev.pReadbacks->GetNumPendingReadbacks() < m_NumReadbacksInFlight;
+
+            std::unique_lock<std::mutex> Lock{m_JobsMtx};
+
+            auto IsReady = [&]() { return m_Stop || (CanTakeJob && !m_Jobs.empty()); };
+            if (Dev.pReadbacks->GetNumPendingReadbacks() > 0)
+            {
+                // Readbacks are delivered by polling, so do not sleep until the next job arrives
+                m_JobsCV.wait_for(Lock, std::chrono::milliseconds{1}, IsReady);
+            }
+            else
+            {
+                m_JobsCV.wait(Lock, IsReady);
+            }
+
+            if (m_Stop && Dev.pReadbacks->GetNumPendingReadbacks() == 0)
+                break;
+
+            if (CanTakeJob && !m_Jobs.empty())
+            {
+                J = m_Jobs.front();
+                m_Jobs.pop_front();
+                HasJob = true;
+            }
+        }
+
+        if (HasJob)
+            RenderJob(Dev, J);
+
+        Dev.pReadbacks->Poll(Dev.pContext);
+    }
+}
+
+void MultiGPURenderer::RenderJob(DeviceData& Dev, const Job& J)
+{
+    MultiGPURenderJob JobInfo;
+    JobInfo.DeviceIndex = Dev.Index;
+    JobInfo.pDevice     = Dev.pDevice;
+    JobInfo.pContext    = Dev.pContext;
+    JobInfo.pSwapChain  = Dev.pSwapChain;
+    JobInfo.pStateCache = GetRenderStateCache(Dev.Index);
+    JobInfo.FrameId     = J.FrameId;
+    JobInfo.Region      = J.Region;
+    JobInfo.FrameWidth  = m_FrameWidth;
+    JobInfo.FrameHeight = m_FrameHeight;
+    m_Render(JobInfo);
+
+    ITexture* pBackBuffer = Dev.pSwapChain->GetCurrentBackBufferRTV()->GetTexture();
+
+    Box ReadRegion;
+    ReadRegion.MaxX = static_cast<Uint32>(J.Region.right - J.Region.left);
+    ReadRegion.MaxY = static_cast<Uint32>(J.Region.bottom - J.Region.top);
+
+    const Uint64 FrameId = J.FrameId;
+    const Rect   Region  = J.Region;
+    if (!Dev.pReadbacks->ReadTexture(Dev.pContext, pBackBuffer, 0, 0, &ReadRegion,
+                                     [this, FrameId, Region](const ReadbackQueue::ReadbackData& Data) {
+                                         OnJobComplete(FrameId, Region, Data);
+                                     }))
+    {
+        OnJobComplete(FrameId, Region, ReadbackQueue::ReadbackData{});
+    }
+
+    Dev.pSwapChain->Present(0);
+    Dev.NumJobsRendered.fetch_add(1);
+}
+
+void MultiGPURenderer::OnJobComplete(Uint64 FrameId, const Rect& Region, const ReadbackQueue::ReadbackData& Data)
+{
+    if (m_Mode == MULTI_GPU_RENDER_MODE_ALTERNATE_FRAME)
+    {
+        if (m_FrameCallback)
+        {
+            MultiGPUFrameData FrameData;
+            FrameData.pData  = Data.pData;
+            FrameData.Stride = Data.Stride;
+            FrameData.Width  = m_FrameWidth;
+            FrameData.Height = m_FrameHeight;
+            FrameData.Format = m_ColorFormat;
+            m_FrameCallback(FrameId, FrameData);
+        }
+        OnFrameDelivered({});
+        return;
+    }
+
+    PendingFrame* pFrame = nullptr;
+    {
+        std::lock_guard<std::mutex> Lock{m_FramesMtx};
+        auto it = m_PendingFrames.find(FrameId);
+        if (it == m_PendingFrames.end())
+        {
+            UNEXPECTED("Frame ", FrameId, " is not pending");
+            return;
+        }
+        // References to unordered_map elements remain valid when other elements are inserted
+        pFrame = &it->second;
+    }
+
+    // Tiles do not overlap, so they are copied into the frame without holding the lock
+    if (Data.pData != nullptr)
+    {
+        const size_t FrameStride = size_t{m_FrameWidth} * m_PixelSize;
+        const size_t RowSize     = static_cast<size_t>(Region.right - Region.left) * m_PixelSize;
+        for (Int32 y = Region.top; y < Region.bottom; ++y)
+        {
+            const Uint8* pSrc = static_cast<const Uint8*>(Data.pData) + static_cast<size_t>(y - Region.top) * static_cast<size_t>(Data.Stride);
+            Uint8*       pDst = pFrame->Pixels.data() + static_cast<size_t>(y) * FrameStride + static_cast<size_t>(Region.left) * m_PixelSize;
+            memcpy(pDst, pSrc, RowSize);
+        }
+    }
+
+    PendingFrame CompletedFrame;
+    {
+        std::lock_guard<std::mutex> Lock{m_FramesMtx};
+        if (Data.pData == nullptr)
+            pFrame->Failed = true;
+        VERIFY_EXPR(pFrame->NumJobsLeft > 0);
+        if (--pFrame->NumJobsLeft > 0)
+            return;
+
+        CompletedFrame = std::move(*pFrame);
+        m_PendingFrames.erase(FrameId);
+    }
+
+    if (m_FrameCallback)
+    {
+        MultiGPUFrameData FrameData;
+        FrameData.pData  = !CompletedFrame.Failed ? CompletedFrame.Pixels.data() : nullptr;
+        FrameData.Stride = Uint64{m_FrameWidth} * m_PixelSize;
+        FrameData.Width  = m_FrameWidth;
+        FrameData.Height = m_FrameHeight;
+        FrameData.Format = m_ColorFormat;
+        m_FrameCallback(FrameId, FrameData);
+    }
+    OnFrameDelivered(std::move(CompletedFrame.Pixels));
+}
+
+void MultiGPURenderer::OnFrameDelivered(std::vector<Uint8>&& Pixels)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_FramesMtx};
+        if (!Pixels.empty() && m_FreePixelBuffers.size() < m_MaxFramesInFlight)
+            m_FreePixelBuffers.emplace_back(std::move(Pixels));
+        VERIFY_EXPR(m_NumFramesInFlight > 0);
+        --m_NumFramesInFlight;
+    }
+    m_FramesCV.notify_all();
+}
+
+} // namespace Diligent
@@ -33,6 +33,10 @@
 
 #include "OffScreenSwapChain.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 namespace Diligent
 {
 
@@ -41,11 +45,14 @@ class OffScreenSwapChain : public SwapChainBase<ISwapChain>
 public:
     using TSwapChainBase = SwapChainBase;
 
-    OffScreenSwapChain(IReferenceCounters*  pRefCounters,
-                       IRenderDevice*       pDevice,
-                       IDeviceContext*      pContext,
-                       const SwapChainDesc& SCDesc) :
-        SwapChainBase{pRefCounters, pDevice, pContext, SCDesc}
+    OffScreenSwapChain(IReferenceCounters*                 pRefCounters,
+                       IRenderDevice*                      pDevice,
+                       IDeviceContext*                     pContext,
+                       const SwapChainDesc&                SCDesc,
+                       const OffScreenSwapChainCreateInfo& CI = {}) :
+        SwapChainBase{pRefCounters, pDevice, pContext, SCDesc},
+        m_FrameCallback{CI.FrameCallback},
+        m_PresentCallback{CI.PresentCallback}
     {
         if (m_DesiredPreTransform != SURFACE_TRANSFORM_OPTIMAL && m_DesiredPreTransform != SURFACE_TRANSFORM_IDENTITY)
         {
@@ -70,9 +77,34 @@ public:
             pDevice->CreateFence(Desc, &m_FrameCompleteFence);
         }
 
+        if (m_FrameCallback)
+        {
+            ReadbackQueueCreateInfo ReadbackCI;
+            ReadbackCI.NumFramesInFlight = std::max(m_SwapChainDesc.BufferCount, 1u);
+            ReadbackCI.pThreadPool       = CI.pThreadPool;
+            m_pReadbackQueue             = std::make_unique<ReadbackQueue>(pDevice, ReadbackCI);
+        }
+
         Resize(m_SwapChainDesc.Width, m_SwapChainDesc.Height, m_SwapChainDesc.PreTransform);
     }
 
+    ~OffScreenSwapChain()
+    {
+        if (!m_pReadbackQueue)
+            return;
+
+        // Deliver the frames that are still being read back
+        if (RefCntAutoPtr<IDeviceContext> pDeviceContext = m_wpDeviceContext.Lock())
+        {
+            if (m_pReadbackQueue->GetNumPendingReadbacks() > 0)
+            {
+                pDeviceContext->WaitForIdle();
+                m_pReadbackQueue->Poll(pDeviceContext);
+            }
+            m_pReadbackQueue->WaitForCallbacks(pDeviceContext);
+        }
+    }
+
     virtual void DILIGENT_CALL_TYPE Present(Uint32 SyncInterval) override
     {
         RefCntAutoPtr<IDeviceContext> pDeviceContext = m_wpDeviceContext.Lock();
@@ -82,6 +114,20 @@ public:
             return;
         }
 
+        ITexture* const pBackBuffer = m_RenderTargets[m_BackBufferIndex];
+        if (m_PresentCallback)
+        {
+            m_PresentCallback(pBackBuffer, m_PresentedFrameCount);
+        }
+        if (m_pReadbackQueue)
+        {
+            const Uint64 FrameId = m_PresentedFrameCount;
+            m_pReadbackQueue->ReadTexture(pDeviceContext, pBackBuffer, 0, 0, nullptr,
+                                          [FrameId, Callback = m_FrameCallback](const ReadbackQueue::ReadbackData& Data) {
+                                              Callback(FrameId, Data);
+                                          });
+        }
+
         pDeviceContext->Flush();
 
         if (m_SwapChainDesc.IsPrimary)
@@ -100,17 +146,33 @@ public:
             }
             ++m_FrameNumber;
         }
+
+        if (m_pReadbackQueue)
+        {
+            // Deliver the frames whose copies have been completed by the GPU
+            m_pReadbackQueue->Poll(pDeviceContext);
+        }
+
+        ++m_PresentedFrameCount;
+        m_BackBufferIndex = (m_BackBufferIndex + 1) % static_cast<Uint32>(m_RenderTargets.size());
     }
 
     virtual void DILIGENT_CALL_TYPE Resize(Uint32 NewWidth, Uint32 NewHeight, SURFACE_TRANSFORM NewPreTransform) override final
     {
         if (TSwapChainBase::Resize(NewWidth, NewHeight, NewPreTransform))
         {
-            m_pRTV.Release();
+            m_RTVs.clear();
+            m_RenderTargets.clear();
             m_pDSV.Release();
-            m_pRenderTarget.Release();
             m_pDepthBuffer.Release();
+            m_BackBufferIndex = 0;
 
+            // When frames are consumed after Present(), use one color buffer per frame in flight,
+            // so that a frame can be read back while the next frames are rendered
+            const Uint32 NumBuffers = (m_FrameCallback || m_PresentCallback) ? std::max(m_SwapChainDesc.BufferCount, 1u) : 1u;
+            m_RenderTargets.resize(NumBuffers);
+            m_RTVs.resize(NumBuffers);
+            for (Uint32 i = 0; i < NumBuffers; ++i)
             {
                 TextureDesc RenderTargetDesc;
                 RenderTargetDesc.Name        = "Off screen color buffer";
@@ -121,10 +183,10 @@ public:
                 RenderTargetDesc.SampleCount = 1;
                 RenderTargetDesc.Usage       = USAGE_DEFAULT;
                 RenderTargetDesc.BindFlags   = BIND_RENDER_TARGET;
-                m_pRenderDevice->CreateTexture(RenderTargetDesc, nullptr, &m_pRenderTarget);
-                VERIFY_EXPR(m_pRenderTarget != nullptr);
-                m_pRTV = m_pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
-                VERIFY_EXPR(m_pRTV != nullptr);
+                m_pRenderDevice->CreateTexture(RenderTargetDesc, nullptr, &m_RenderTargets[i]);
+                VERIFY_EXPR(m_RenderTargets[i] != nullptr);
+                m_RTVs[i] = m_RenderTargets[i]->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+                VERIFY_EXPR(m_RTVs[i] != nullptr);
             }
 
             if (m_SwapChainDesc.DepthBufferFormat != TEX_FORMAT_UNKNOWN)
@@ -168,7 +230,7 @@ public:
 
     virtual ITextureView* DILIGENT_CALL_TYPE GetCurrentBackBufferRTV() override final
     {
-        return m_pRTV;
+        return !m_RTVs.empty() ? m_RTVs[m_BackBufferIndex].RawPtr() : nullptr;
     }
 
     virtual ITextureView* DILIGENT_CALL_TYPE GetDepthBufferDSV() override final
@@ -177,12 +239,19 @@ public:
     }
 
 protected:
-    RefCntAutoPtr<ITexture>     m_pRenderTarget;
-    RefCntAutoPtr<ITexture>     m_pDepthBuffer;
-    RefCntAutoPtr<ITextureView> m_pRTV;
-    RefCntAutoPtr<ITextureView> m_pDSV;
-    RefCntAutoPtr<IFence>       m_FrameCompleteFence;
-    Uint64                      m_FrameNumber = 1;
+    std::vector<RefCntAutoPtr<ITexture>>     m_RenderTargets;
+    std::vector<RefCntAutoPtr<ITextureView>> m_RTVs;
+    RefCntAutoPtr<ITexture>                  m_pDepthBuffer;
+    RefCntAutoPtr<ITextureView>              m_pDSV;
+    RefCntAutoPtr<IFence>                    m_FrameCompleteFence;
+    Uint64                                   m_FrameNumber     = 1;
+    Uint32                                   m_BackBufferIndex = 0;
+
+    const OffScreenSwapChainCreateInfo::FrameCallbackType   m_FrameCallback;
+    const OffScreenSwapChainCreateInfo::PresentCallbackType m_PresentCallback;
+
+    std::unique_ptr<ReadbackQueue> m_pReadbackQueue;
+    Uint64                         m_PresentedFrameCount = 0;
 };
 
 
@@ -200,4 +269,22 @@ void CreateOffScreenSwapChain(IRenderDevice* pDevice, IDeviceContext* pContext,
     }
 }
 
+void CreateOffScreenSwapChain(IRenderDevice*                      pDevice,
+                              IDeviceContext*                     pContext,
+                              const SwapChainDesc&                SCDesc,
+                              const OffScreenSwapChainCreateInfo& CI,
+                              ISwapChain**                        ppSwapChain)
+{
+    try
+    {
+        RefCntAutoPtr<ISwapChain> pSwapChain{MakeNewRCObj<OffScreenSwapChain>()(pDevice, pContext, SCDesc, CI)};
+        if (pSwapChain)
+            pSwapChain->QueryInterface(IID_SwapChain, reinterpret_cast<IObject**>(ppSwapChain));
+    }
+    catch (...)
+    {
+        LOG_ERROR("Failed to create off-screen swap chain");
+    }
+}
+
 } // namespace Diligent
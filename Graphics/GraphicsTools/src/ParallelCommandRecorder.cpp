@@ -0,0 +1,151 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ParallelCommandRecorder.hpp"
+
+#include <algorithm>
+
+#include "ThreadPool.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+ParallelCommandRecorder::ParallelCommandRecorder(const ParallelCommandRecorderCreateInfo& CI) :
+    m_pImmediateContext{CI.pImmediateContext},
+    m_pThreadPool{CI.pThreadPool}
+{
+    DEV_CHECK_ERR(CI.pDevice != nullptr, "Render device must not be null");
+    DEV_CHECK_ERR(m_pImmediateContext != nullptr, "Immediate context must not be null");
+    DEV_CHECK_ERR(!m_pImmediateContext->GetDesc().IsDeferred, "Commands must be submitted to an immediate context");
+
+    const RenderDeviceInfo& DeviceInfo = CI.pDevice->GetDeviceInfo();
+    if (DeviceInfo.IsWebGPUDevice())
+    {
+        // Deferred contexts are not supported, all batches will be recorded into the immediate context
+        return;
+    }
+
+    m_Contexts.reserve(CI.NumContexts);
+    for (Uint32 i = 0; i < CI.NumContexts; ++i)
+    {
+        RefCntAutoPtr<IDeviceContext> pCtx;
+        CI.pDevice->CreateDeferredContext(&pCtx);
+        if (!pCtx)
+        {
+            LOG_ERROR_MESSAGE("Failed to create deferred context ", i);
+            break;
+        }
+        m_Contexts.emplace_back(std::move(pCtx));
+    }
+    m_CommandLists.resize(m_Contexts.size());
+}
+
+void ParallelCommandRecorder::RecordContext(IDeviceContext* pCtx, const RecordAttribs& Attribs, Uint32 FirstBatch, Uint32 EndBatch) const
+{
+    if (Attribs.NumRenderTargets > 0 || Attribs.pDepthStencil != nullptr)
+    {
+        // The render targets have been transitioned by the immediate context
+        pCtx->SetRenderTargets(Attribs.NumRenderTargets, Attribs.ppRenderTargets, Attribs.pDepthStencil, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+    }
+
+    if (Attribs.BeginContext)
+        Attribs.BeginContext(pCtx);
+
+    for (Uint32 Batch = FirstBatch; Batch < EndBatch; ++Batch)
+        Attribs.RecordBatch(pCtx, Batch);
+
+    if (Attribs.EndContext)
+        Attribs.EndContext(pCtx);
+}
+
+void ParallelCommandRecorder::Record(const RecordAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.RecordBatch, "RecordBatch callback must not be null");
+    DEV_CHECK_ERR(Attribs.NumRenderTargets == 0 || Attribs.ppRenderTargets != nullptr, "ppRenderTargets must not be null when NumRenderTargets is not zero");
+
+    m_Stats.NumContextsUsed = 0;
+    if (Attribs.NumBatches == 0 || !Attribs.RecordBatch || !m_pImmediateContext)
+        return;
+
+    if (Attribs.NumRenderTargets > 0 || Attribs.pDepthStencil != nullptr)
+    {
+        // Transition the render targets once here since deferred contexts must not change resource states
+        // that other contexts may be using at the same time.
+        m_pImmediateContext->SetRenderTargets(Attribs.NumRenderTargets, Attribs.ppRenderTargets, Attribs.pDepthStencil, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    m_Stats.NumBatchesRecorded += Attribs.NumBatches;
+
+    if (m_Contexts.empty())
+    {
+        RecordContext(m_pImmediateContext, Attribs, 0, Attribs.NumBatches);
+        m_Stats.NumContextsUsed = 1;
+        return;
+    }
+
+    Uint32 NumContexts = GetNumContexts();
+    if (Attribs.MaxContexts != 0)
+        NumContexts = std::min(NumContexts, Attribs.MaxContexts);
+    const Uint32 MinBatchesPerContext = std::max(Attribs.MinBatchesPerContext, 1u);
+    NumContexts                       = std::max(std::min(NumContexts, (Attribs.NumBatches + MinBatchesPerContext - 1) / MinBatchesPerContext), 1u);
+
+    const Uint32 ImmediateContextId = m_pImmediateContext->GetDesc().ContextId;
+    // Context i records batches [NumBatches * i / NumContexts, NumBatches * (i + 1) / NumContexts),
+    // so that executing the command lists in the context order preserves the batch order.
+    ParallelFor(m_pThreadPool, 0, NumContexts, 1,
+                [&](Uint32 CtxIdx) {
+                    const Uint32 FirstBatch = static_cast<Uint32>(Uint64{Attribs.NumBatches} * CtxIdx / NumContexts);
+                    const Uint32 EndBatch   = static_cast<Uint32>(Uint64{Attribs.NumBatches} * (CtxIdx + 1) / NumContexts);
+
+                    IDeviceContext* pCtx = m_Contexts[CtxIdx];
+                    pCtx->Begin(ImmediateContextId);
+                    RecordContext(pCtx, Attribs, FirstBatch, EndBatch);
+                    pCtx->FinishCommandList(&m_CommandLists[CtxIdx]);
+                });
+
+    std::vector<ICommandList*> CmdListPtrs(NumContexts);
+    for (Uint32 i = 0; i < NumContexts; ++i)
+    {
+        CmdListPtrs[i] = m_CommandLists[i];
+        DEV_CHECK_ERR(CmdListPtrs[i] != nullptr, "Failed to finish command list in context ", i);
+    }
+    m_pImmediateContext->ExecuteCommandLists(NumContexts, CmdListPtrs.data());
+
+    for (Uint32 i = 0; i < NumContexts; ++i)
+    {
+        m_CommandLists[i].Release();
+        // Deferred contexts must be finished after their command lists have been submitted
+        // to release the stale resources.
+        m_Contexts[i]->FinishFrame();
+    }
+
+    m_Stats.NumContextsUsed = NumContexts;
+    m_Stats.NumCommandListsSubmitted += NumContexts;
+}
+
+} // namespace Diligent
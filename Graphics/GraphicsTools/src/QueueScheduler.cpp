@@ -0,0 +1,348 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+
+#include "QueueScheduler.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+QueueScheduler::QueueScheduler(IRenderDevice* pDevice, IDeviceContext* const* ppContexts, Uint32 NumContexts)
+{
+    m_Contexts.resize(NumContexts);
+    for (Uint32 i = 0; i < NumContexts; ++i)
+    {
+        Context& Ctx = m_Contexts[i];
+        Ctx.pCtx     = ppContexts[i];
+        DEV_CHECK_ERR(Ctx.pCtx, "Context ", i, " must not be null");
+        DEV_CHECK_ERR(!Ctx.pCtx->GetDesc().IsDeferred, "Only immediate contexts can be used by the queue scheduler");
+
+        const COMMAND_QUEUE_TYPE QueueType = Ctx.pCtx->GetDesc().QueueType;
+        Ctx.IsGraphics                     = (QueueType & COMMAND_QUEUE_TYPE_GRAPHICS) == COMMAND_QUEUE_TYPE_GRAPHICS;
+
+        const char*       CtxName = Ctx.pCtx->GetDesc().Name;
+        const std::string Name    = std::string{"Queue scheduler fence for context '"} + (CtxName != nullptr ? CtxName : "") + '\'';
+
+        FenceDesc Desc;
+        Desc.Name = Name.c_str();
+        Desc.Type = FENCE_TYPE_GENERAL;
+        pDevice->CreateFence(Desc, &Ctx.pFence);
+        DEV_CHECK_ERR(Ctx.pFence, "Failed to create fence");
+
+        Ctx.LastWaitedValues.resize(NumContexts);
+    }
+}
+
+QueueScheduler::~QueueScheduler()
+{
+    DEV_CHECK_ERR(m_Works.empty(), m_Works.size(), " work item(s) have been added, but never executed");
+}
+
+QueueScheduler::TrackedResource* QueueScheduler::GetTrackedResource(IDeviceObject* pResource)
+{
+    auto it = m_Resources.find(pResource);
+    if (it != m_Resources.end())
+        return &it->second;
+
+    RESOURCE_STATE State = RESOURCE_STATE_UNKNOWN;
+    if (RefCntAutoPtr<ITexture> pTexture{pResource, IID_Texture})
+        State = pTexture->GetState();
+    else if (RefCntAutoPtr<IBuffer> pBuffer{pResource, IID_Buffer})
+        State = pBuffer->GetState();
+    else
+    {
+        DEV_ERROR("Only textures and buffers can be tracked by the queue scheduler");
+        return nullptr;
+    }
+
+    TrackedResource& Res = m_Resources[pResource];
+    Res.pResource        = pResource;
+    Res.State            = State;
+    return &Res;
+}
+
+bool QueueScheduler::AddDependency(Work& W, const SyncPoint& Sync)
+{
+    // Commands in the same context are executed in order
+    if (!Sync.IsValid() || Sync.ContextIndex == W.ContextIndex)
+        return false;
+
+    for (const SyncPoint& Wait : W.Waits)
+    {
+        if (Wait.ContextIndex == Sync.ContextIndex && Wait.Work == Sync.Work && Wait.FenceValue == Sync.FenceValue)
+            return false;
+    }
+
+    if (Sync.Work != InvalidWorkId)
+        m_Works[Sync.Work].Signal = true;
+    else if (m_Contexts[Sync.ContextIndex].pFence->GetCompletedValue() >= Sync.FenceValue)
+        return false;
+
+    W.Waits.push_back(Sync);
+    return true;
+}
+
+void QueueScheduler::AddTransition(Work& W, TrackedResource& Res, RESOURCE_STATE NewState)
+{
+    StateTransitionDesc Barrier;
+    Barrier.pResource = Res.pResource;
+    Barrier.OldState  = RESOURCE_STATE_UNKNOWN;
+    Barrier.NewState  = NewState;
+    Barrier.Flags     = STATE_TRANSITION_FLAG_UPDATE_STATE;
+
+    // Compute and transfer queues can't transition resources from graphics-only states, so when
+    // all outstanding uses of the resource are by one graphics context, the transition is
+    // recorded there after its last use.
+    if (!m_Contexts[W.ContextIndex].IsGraphics)
+    {
+        Uint32 ProducerCtx = ~0u;
+        WorkId LastUse     = InvalidWorkId;
+        bool   SingleCtx   = true;
+
+        auto CheckUse = [&](const SyncPoint& Use) {
+            if (!Use.IsValid())
+                return;
+            if (Use.Work == InvalidWorkId || (ProducerCtx != ~0u && ProducerCtx != Use.ContextIndex))
+            {
+                SingleCtx = false;
+                return;
+            }
+            ProducerCtx = Use.ContextIndex;
+            LastUse     = LastUse == InvalidWorkId ? Use.Work : std::max(LastUse, Use.Work);
+        };
+        CheckUse(Res.Writer);
+        for (const SyncPoint& Reader : Res.Readers)
+            CheckUse(Reader);
+
+        if (SingleCtx && LastUse != InvalidWorkId && ProducerCtx != W.ContextIndex && m_Contexts[ProducerCtx].IsGraphics)
+        {
+            m_Works[LastUse].PostBarriers.push_back(Barrier);
+            ++m_Stats.NumTransitions;
+            return;
+        }
+    }
+
+    W.PreBarriers.push_back(Barrier);
+    ++m_Stats.NumTransitions;
+}
+
+QueueScheduler::WorkId QueueScheduler::AddWork(const WorkDesc& Desc, CallbackType Callback)
+{
+    if (Desc.ContextIndex >= m_Contexts.size())
+    {
+        DEV_ERROR("Context index (", Desc.ContextIndex, ") is out of range");
+        return InvalidWorkId;
+    }
+
+    const WorkId Id = static_cast<WorkId>(m_Works.size());
+    m_Works.emplace_back();
+
+    Work& W        = m_Works.back();
+    W.Name         = Desc.Name != nullptr ? Desc.Name : "";
+    W.ContextIndex = Desc.ContextIndex;
+    W.Callback     = std::move(Callback);
+
+    for (WorkId Dep : Desc.Dependencies)
+    {
+        if (Dep >= Id)
+        {
+            DEV_ERROR("Work '", W.Name, "' depends on work ", Dep, " that has not been added before it");
+            continue;
+        }
+        SyncPoint Sync;
+        Sync.ContextIndex = m_Works[Dep].ContextIndex;
+        Sync.Work         = Dep;
+        AddDependency(W, Sync);
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    const Uint64 ContextBit = Uint64{1} << Uint64{m_Contexts[W.ContextIndex].pCtx->GetDesc().ContextId};
+#endif
+
+    SyncPoint ThisWork;
+    ThisWork.ContextIndex = W.ContextIndex;
+    ThisWork.Work         = Id;
+    for (const ResourceUsage& Usage : Desc.Resources)
+    {
+        if (Usage.pResource == nullptr)
+            continue;
+
+        TrackedResource* pRes = GetTrackedResource(Usage.pResource);
+        if (pRes == nullptr)
+            continue;
+
+#ifdef DILIGENT_DEVELOPMENT
+        {
+            RefCntAutoPtr<ITexture> pTexture{Usage.pResource, IID_Texture};
+            RefCntAutoPtr<IBuffer>  pBuffer{Usage.pResource, IID_Buffer};
+
+            const Uint64 ResourceMask = pTexture ? pTexture->GetDesc().ImmediateContextMask : pBuffer->GetDesc().ImmediateContextMask;
+            DEV_CHECK_ERR((ResourceMask & ContextBit) != 0, "Resource '", Usage.pResource->GetDesc().Name, "' used by work '", W.Name,
+                          "' was not created with the immediate context mask that includes context '", m_Contexts[W.ContextIndex].pCtx->GetDesc().Name, "'");
+        }
+#endif
+
+        TrackedResource& Res = *pRes;
+
+        const bool NeedsTransition = Usage.State != RESOURCE_STATE_UNKNOWN && (Res.State & Usage.State) != Usage.State;
+        const bool IsHazard        = Usage.Write || NeedsTransition;
+
+        // Read after write
+        if (AddDependency(W, Res.Writer))
+            ++m_Stats.NumImplicitDependencies;
+
+        // Write after read
+        if (IsHazard)
+        {
+            for (const SyncPoint& Reader : Res.Readers)
+            {
+                if (AddDependency(W, Reader))
+                    ++m_Stats.NumImplicitDependencies;
+            }
+        }
+
+        if (NeedsTransition)
+        {
+            AddTransition(W, Res, Usage.State);
+            Res.State = Usage.State;
+        }
+
+        if (IsHazard)
+        {
+            Res.Writer = ThisWork;
+            Res.Readers.clear();
+        }
+        else
+        {
+            auto it = std::find_if(Res.Readers.begin(), Res.Readers.end(),
+                                   [&](const SyncPoint& Reader) { return Reader.ContextIndex == W.ContextIndex; });
+            if (it != Res.Readers.end())
+                *it = ThisWork;
+            else
+                Res.Readers.push_back(ThisWork);
+        }
+    }
+
+    return Id;
+}
+
+void QueueScheduler::Execute()
+{
+    for (Work& W : m_Works)
+    {
+        Context& Ctx = m_Contexts[W.ContextIndex];
+
+        for (const SyncPoint& Wait : W.Waits)
+        {
+            const Uint64 Value = Wait.Work != InvalidWorkId ? m_Works[Wait.Work].SignalValue : Wait.FenceValue;
+            VERIFY(Value != 0, "The work the context waits for has not been signaled. This is a bug.");
+
+            Uint64& LastWaited = Ctx.LastWaitedValues[Wait.ContextIndex];
+            if (Value > LastWaited)
+            {
+                Ctx.pCtx->DeviceWaitForFence(m_Contexts[Wait.ContextIndex].pFence, Value);
+                LastWaited = Value;
+                ++m_Stats.NumFenceWaits;
+            }
+        }
+
+        if (!W.Name.empty())
+            Ctx.pCtx->BeginDebugGroup(W.Name.c_str());
+
+        if (!W.PreBarriers.empty())
+            Ctx.pCtx->TransitionResourceStates(static_cast<Uint32>(W.PreBarriers.size()), W.PreBarriers.data());
+
+        if (W.Callback)
+            W.Callback(Ctx.pCtx);
+
+        if (!W.PostBarriers.empty())
+            Ctx.pCtx->TransitionResourceStates(static_cast<Uint32>(W.PostBarriers.size()), W.PostBarriers.data());
+
+        if (!W.Name.empty())
+            Ctx.pCtx->EndDebugGroup();
+
+        if (W.Signal)
+        {
+            W.SignalValue = Ctx.NextFenceValue++;
+            Ctx.pCtx->EnqueueSignal(Ctx.pFence, W.SignalValue);
+            Ctx.pCtx->Flush();
+            Ctx.LastSignaledValue = W.SignalValue;
+            ++m_Stats.NumFenceSignals;
+        }
+
+        Ctx.HasWork = true;
+    }
+
+    // Signal the end of the batch in every context, so that the work of the next batch
+    // can wait for the resources used by this one.
+    for (Context& Ctx : m_Contexts)
+    {
+        if (!Ctx.HasWork)
+            continue;
+
+        Ctx.LastSignaledValue = Ctx.NextFenceValue++;
+        Ctx.pCtx->EnqueueSignal(Ctx.pFence, Ctx.LastSignaledValue);
+        Ctx.pCtx->Flush();
+        Ctx.HasWork = false;
+        ++m_Stats.NumFenceSignals;
+    }
+
+    // Convert the sync points of this batch to fence values and stop tracking
+    // resources whose uses the GPU has completed.
+    auto ResolveSyncPoint = [this](SyncPoint& Sync) {
+        if (Sync.IsValid() && Sync.Work != InvalidWorkId)
+        {
+            Sync.FenceValue = m_Contexts[Sync.ContextIndex].LastSignaledValue;
+            Sync.Work       = InvalidWorkId;
+        }
+    };
+    auto IsCompleted = [this](const SyncPoint& Sync) {
+        return !Sync.IsValid() || m_Contexts[Sync.ContextIndex].pFence->GetCompletedValue() >= Sync.FenceValue;
+    };
+
+    for (auto it = m_Resources.begin(); it != m_Resources.end();)
+    {
+        TrackedResource& Res = it->second;
+
+        ResolveSyncPoint(Res.Writer);
+        for (SyncPoint& Reader : Res.Readers)
+            ResolveSyncPoint(Reader);
+
+        if (IsCompleted(Res.Writer) && std::all_of(Res.Readers.begin(), Res.Readers.end(), IsCompleted))
+            it = m_Resources.erase(it);
+        else
+            ++it;
+    }
+
+    m_Works.clear();
+}
+
+} // namespace Diligent
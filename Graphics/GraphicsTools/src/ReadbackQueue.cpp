@@ -0,0 +1,343 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ReadbackQueue.hpp"
+
+#include <algorithm>
+
+#include "ThreadPool.hpp"
+#include "GraphicsAccessories.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+bool IsStagingMemoryPersistentlyMapped(RENDER_DEVICE_TYPE DeviceType)
+{
+    return (DeviceType == RENDER_DEVICE_TYPE_D3D12 ||
+            DeviceType == RENDER_DEVICE_TYPE_VULKAN ||
+            DeviceType == RENDER_DEVICE_TYPE_METAL);
+}
+
+} // namespace
+
+ReadbackQueue::ReadbackQueue(IRenderDevice* pDevice, const ReadbackQueueCreateInfo& CI) :
+    m_pDevice{pDevice},
+    m_pThreadPool{CI.pThreadPool},
+    m_NumFramesInFlight{std::max(CI.NumFramesInFlight, 1u)},
+    m_KeepStagingMapped{IsStagingMemoryPersistentlyMapped(pDevice->GetDeviceInfo().Type)},
+    m_PendingReadbacks{pDevice}
+{
+}
+
+ReadbackQueue::~ReadbackQueue()
+{
+    // The tasks reference the batches, so they must finish before the batches are destroyed
+    for (CallbackBatch& Batch : m_CallbackBatches)
+        Batch.pTask->WaitForCompletion();
+
+    DEV_CHECK_ERR(m_CallbackBatches.empty(), "Readback queue is destroyed while the staging resources of ", m_CallbackBatches.size(),
+                  " callback batch(es) are mapped. Call WaitForCallbacks() before destroying the queue.");
+}
+
+RefCntAutoPtr<IBuffer> ReadbackQueue::GetStagingBuffer(Uint64 Size)
+{
+    for (auto it = m_RecycledBuffers.begin(); it != m_RecycledBuffers.end(); ++it)
+    {
+        if ((*it)->GetDesc().Size == Size)
+        {
+            RefCntAutoPtr<IBuffer> pBuffer = std::move(*it);
+            m_RecycledBuffers.erase(it);
+            return pBuffer;
+        }
+    }
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Readback queue staging buffer";
+    BuffDesc.Size           = Size;
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    m_pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    return pBuffer;
+}
+
+RefCntAutoPtr<ITexture> ReadbackQueue::GetStagingTexture(const TextureDesc& Desc)
+{
+    for (auto it = m_RecycledTextures.begin(); it != m_RecycledTextures.end(); ++it)
+    {
+        const TextureDesc& TexDesc = (*it)->GetDesc();
+        if (TexDesc.Type == Desc.Type &&
+            TexDesc.Width == Desc.Width &&
+            TexDesc.Height == Desc.Height &&
+            TexDesc.Depth == Desc.Depth &&
+            TexDesc.Format == Desc.Format)
+        {
+            RefCntAutoPtr<ITexture> pTexture = std::move(*it);
+            m_RecycledTextures.erase(it);
+            return pTexture;
+        }
+    }
+
+    RefCntAutoPtr<ITexture> pTexture;
+    m_pDevice->CreateTexture(Desc, nullptr, &pTexture);
+    return pTexture;
+}
+
+bool ReadbackQueue::ReadBuffer(IDeviceContext* pCtx,
+                               IBuffer*        pBuffer,
+                               Uint64          Offset,
+                               Uint64          Size,
+                               CallbackType    Callback)
+{
+    DEV_CHECK_ERR(pBuffer != nullptr, "Buffer must not be null");
+    DEV_CHECK_ERR(Size > 0, "Readback size must not be zero");
+    DEV_CHECK_ERR(Offset + Size <= pBuffer->GetDesc().Size, "Readback region [", Offset, ", ", Offset + Size,
+                  ") is out of bounds of buffer '", pBuffer->GetDesc().Name, "' of size ", pBuffer->GetDesc().Size);
+
+    Readback RB;
+    RB.pStagingBuffer = GetStagingBuffer(Size);
+    if (!RB.pStagingBuffer)
+    {
+        LOG_ERROR_MESSAGE("Failed to create staging buffer to read back buffer '", pBuffer->GetDesc().Name, "'");
+        return false;
+    }
+    RB.Callback      = std::move(Callback);
+    RB.Data.DataSize = Size;
+
+    pCtx->CopyBuffer(pBuffer, Offset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                     RB.pStagingBuffer, 0, Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    m_PendingReadbacks.Enqueue(pCtx, std::move(RB));
+    ++m_NumPendingReadbacks;
+
+    return true;
+}
+
+bool ReadbackQueue::ReadTexture(IDeviceContext* pCtx,
+                                ITexture*       pTexture,
+                                Uint32          MipLevel,
+                                Uint32          ArraySlice,
+                                const Box*      pRegion,
+                                CallbackType    Callback)
+{
+    DEV_CHECK_ERR(pTexture != nullptr, "Texture must not be null");
+
+    const TextureDesc&       SrcDesc  = pTexture->GetDesc();
+    const MipLevelProperties MipProps = GetMipLevelProperties(SrcDesc, MipLevel);
+
+    TextureDesc StagingDesc;
+    StagingDesc.Name           = "Readback queue staging texture";
+    StagingDesc.Type           = SrcDesc.Is1D() ? RESOURCE_DIM_TEX_1D : (SrcDesc.Is3D() ? RESOURCE_DIM_TEX_3D : RESOURCE_DIM_TEX_2D);
+    StagingDesc.Width          = pRegion != nullptr ? pRegion->Width() : MipProps.LogicalWidth;
+    StagingDesc.Height         = pRegion != nullptr ? pRegion->Height() : MipProps.LogicalHeight;
+    StagingDesc.Depth          = SrcDesc.Is3D() ? (pRegion != nullptr ? pRegion->Depth() : MipProps.Depth) : 1;
+    StagingDesc.Format         = SrcDesc.Format;
+    StagingDesc.MipLevels      = 1;
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    Readback RB;
+    RB.pStagingTexture = GetStagingTexture(StagingDesc);
+    if (!RB.pStagingTexture)
+    {
+        LOG_ERROR_MESSAGE("Failed to create staging texture to read back texture '", SrcDesc.Name, "'");
+        return false;
+    }
+    RB.Callback    = std::move(Callback);
+    RB.Data.Width  = StagingDesc.Width;
+    RB.Data.Height = StagingDesc.Height;
+    RB.Data.Depth  = StagingDesc.GetDepth();
+    RB.Data.Format = StagingDesc.Format;
+
+    CopyTextureAttribs CopyAttribs{pTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RB.pStagingTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+    CopyAttribs.SrcMipLevel = MipLevel;
+    CopyAttribs.SrcSlice    = ArraySlice;
+    CopyAttribs.pSrcBox     = pRegion;
+    pCtx->CopyTexture(CopyAttribs);
+
+    m_PendingReadbacks.Enqueue(pCtx, std::move(RB));
+    ++m_NumPendingReadbacks;
+
+    return true;
+}
+
+void ReadbackQueue::MapReadback(IDeviceContext* pCtx, Readback& RB)
+{
+    VERIFY_EXPR(!RB.IsMapped);
+
+    // The fence has been reached, so mapping never waits for the GPU
+    if (RB.pStagingBuffer)
+    {
+        PVoid pData = nullptr;
+        pCtx->MapBuffer(RB.pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        RB.Data.pData = pData;
+    }
+    else
+    {
+        MappedTextureSubresource MappedData;
+        pCtx->MapTextureSubresource(RB.pStagingTexture, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+        RB.Data.pData       = MappedData.pData;
+        RB.Data.Stride      = MappedData.Stride;
+        RB.Data.DepthStride = MappedData.DepthStride;
+
+        const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(RB.Data.Format);
+
+        const Uint32 BlockHeight = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ? FmtAttribs.BlockHeight : 1;
+        const Uint32 NumRows     = (RB.Data.Height + BlockHeight - 1) / BlockHeight;
+        const Uint64 RowSize     = GetMipLevelProperties(RB.pStagingTexture->GetDesc(), 0).RowSize;
+
+        RB.Data.DataSize = (RB.Data.Depth - 1) * RB.Data.DepthStride + (NumRows - 1) * RB.Data.Stride + RowSize;
+    }
+
+    RB.IsMapped = RB.Data.pData != nullptr;
+    if (!RB.IsMapped)
+    {
+        LOG_ERROR_MESSAGE("Failed to map readback staging resource");
+    }
+}
+
+void ReadbackQueue::ReleaseReadback(IDeviceContext* pCtx, Readback& RB)
+{
+    if (RB.IsMapped)
+    {
+        if (RB.pStagingBuffer)
+            pCtx->UnmapBuffer(RB.pStagingBuffer, MAP_READ);
+        else
+            pCtx->UnmapTextureSubresource(RB.pStagingTexture, 0, 0);
+        RB.IsMapped = false;
+    }
+
+    // Keep at most m_NumFramesInFlight recycled resources of every size
+    if (RB.pStagingBuffer)
+    {
+        const Uint64 Size = RB.pStagingBuffer->GetDesc().Size;
+
+        Uint32 NumRecycled = 0;
+        for (const RefCntAutoPtr<IBuffer>& pBuffer : m_RecycledBuffers)
+        {
+            if (pBuffer->GetDesc().Size == Size)
+                ++NumRecycled;
+        }
+        if (NumRecycled < m_NumFramesInFlight)
+            m_RecycledBuffers.emplace_back(std::move(RB.pStagingBuffer));
+        RB.pStagingBuffer.Release();
+    }
+    else if (RB.pStagingTexture)
+    {
+        const TextureDesc& Desc = RB.pStagingTexture->GetDesc();
+
+        Uint32 NumRecycled = 0;
+        for (const RefCntAutoPtr<ITexture>& pTexture : m_RecycledTextures)
+        {
+            const TextureDesc& TexDesc = pTexture->GetDesc();
+            if (TexDesc.Type == Desc.Type &&
+                TexDesc.Width == Desc.Width &&
+                TexDesc.Height == Desc.Height &&
+                TexDesc.Depth == Desc.Depth &&
+                TexDesc.Format == Desc.Format)
+                ++NumRecycled;
+        }
+        if (NumRecycled < m_NumFramesInFlight)
+            m_RecycledTextures.emplace_back(std::move(RB.pStagingTexture));
+        RB.pStagingTexture.Release();
+    }
+}
+
+void ReadbackQueue::Poll(IDeviceContext* pCtx)
+{
+    // Recycle the staging resources of the batches whose callbacks have finished.
+    // Batches are released in order so that the staging pool is refilled in a predictable way.
+    while (!m_CallbackBatches.empty() && m_CallbackBatches.front().pTask->IsFinished())
+    {
+        for (Readback& RB : m_CallbackBatches.front().Readbacks)
+            ReleaseReadback(pCtx, RB);
+        m_CallbackBatches.pop_front();
+    }
+
+    std::vector<Readback> Completed;
+    while (Readback RB = m_PendingReadbacks.GetFirstCompleted())
+    {
+        VERIFY_EXPR(m_NumPendingReadbacks > 0);
+        --m_NumPendingReadbacks;
+
+        MapReadback(pCtx, RB);
+        if (!m_pThreadPool)
+        {
+            if (RB.Callback)
+                RB.Callback(RB.Data);
+            ReleaseReadback(pCtx, RB);
+            continue;
+        }
+
+        if (!m_KeepStagingMapped && RB.IsMapped)
+        {
+            const Uint8* pSrcData = static_cast<const Uint8*>(RB.Data.pData);
+            RB.CPUData.assign(pSrcData, pSrcData + RB.Data.DataSize);
+            RB.Data.pData = RB.CPUData.data();
+            ReleaseReadback(pCtx, RB);
+        }
+        Completed.emplace_back(std::move(RB));
+    }
+
+    if (Completed.empty())
+        return;
+
+    m_CallbackBatches.emplace_back();
+    CallbackBatch& Batch = m_CallbackBatches.back();
+    Batch.Readbacks      = std::move(Completed);
+
+    std::vector<Readback>* pReadbacks = &Batch.Readbacks;
+
+    Batch.pTask = EnqueueAsyncWork(
+        m_pThreadPool,
+        [pReadbacks](Uint32 ThreadId) {
+            for (Readback& RB : *pReadbacks)
+            {
+                if (RB.Callback)
+                    RB.Callback(RB.Data);
+            }
+            return ASYNC_TASK_STATUS_COMPLETE;
+        });
+}
+
+void ReadbackQueue::WaitForCallbacks(IDeviceContext* pCtx)
+{
+    for (CallbackBatch& Batch : m_CallbackBatches)
+    {
+        Batch.pTask->WaitForCompletion();
+        for (Readback& RB : Batch.Readbacks)
+            ReleaseReadback(pCtx, RB);
+    }
+    m_CallbackBatches.clear();
+}
+
+} // namespace Diligent
@@ -26,16 +26,18 @@
 
 #include "ReloadableShader.hpp"
 #include "RenderStateCacheImpl.hpp"
+#include "ShaderToolsCommon.hpp"
 
 namespace Diligent
 {
 
 constexpr INTERFACE_ID ReloadableShader::IID_InternalImpl;
 
-ReloadableShader::ReloadableShader(IReferenceCounters*     pRefCounters,
-                                   RenderStateCacheImpl*   pStateCache,
-                                   IShader*                pShader,
-                                   const ShaderCreateInfo& CreateInfo) :
+ReloadableShader::ReloadableShader(IReferenceCounters*              pRefCounters,
+                                   RenderStateCacheImpl*            pStateCache,
+                                   IShader*                         pShader,
+                                   const ShaderCreateInfo&          CreateInfo,
+                                   IShaderSourceInputStreamFactory* pShaderSourceFactory) :
     TBase{pRefCounters},
     m_pStateCache{pStateCache},
     m_pShader{pShader},
@@ -45,6 +47,10 @@ ReloadableShader::ReloadableShader(IReferenceCounters*     pRefCounters,
     {
         LOG_ERROR_AND_THROW("Internal shader object must not be null");
     }
+
+    // Record the files the shader was actually compiled from, so that the first reload
+    // picks up the files that are different in the reload source.
+    UpdateSourceFiles(pShaderSourceFactory);
 }
 
 ReloadableShader::~ReloadableShader()
@@ -89,6 +95,7 @@ bool ReloadableShader::Reload()
     if (pNewShader)
     {
         m_pShader = pNewShader;
+        UpdateSourceFiles(m_CreateInfo.Get().pShaderSourceStreamFactory);
     }
     else
     {
@@ -98,15 +105,64 @@ bool ReloadableShader::Reload()
     return !FoundInCache;
 }
 
+static XXH128Hash ComputeSourceHash(const void* pData, size_t Size)
+{
+    XXH128State Hasher;
+    Hasher.UpdateRaw(pData, Size);
+    return Hasher.Digest();
+}
+
+void ReloadableShader::UpdateSourceFiles(IShaderSourceInputStreamFactory* pShaderSourceFactory)
+{
+    m_SourceFiles.clear();
+
+    ShaderCreateInfo ShaderCI           = m_CreateInfo;
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+    if (ShaderCI.Source == nullptr && ShaderCI.FilePath == nullptr)
+    {
+        // The shader is created from byte code that never changes
+        m_SourceFilesValid = true;
+        return;
+    }
+
+    m_SourceFilesValid = ProcessShaderIncludes(ShaderCI, [this](const ShaderIncludePreprocessInfo& FileInfo) {
+        // The path is empty for the source code that is not loaded from a file
+        if (!FileInfo.FilePath.empty())
+            m_SourceFiles.push_back({FileInfo.FilePath, ComputeSourceHash(FileInfo.Source, FileInfo.SourceLength)});
+    });
+}
+
+bool ReloadableShader::HasSourceChanges() const
+{
+    if (!m_SourceFilesValid)
+        return true;
+
+    IShaderSourceInputStreamFactory* pSourceFactory = m_CreateInfo.Get().pShaderSourceStreamFactory;
+    for (const SourceFileInfo& File : m_SourceFiles)
+    {
+        // Files are read through the shader source file cache, so that
+        // common headers included by many shaders are only read once.
+        RefCntAutoPtr<IDataBlob> pFileData = LoadShaderSourceFile(pSourceFactory, File.Path.c_str());
+        if (!pFileData)
+            return true;
+
+        if (ComputeSourceHash(pFileData->GetConstDataPtr(), pFileData->GetSize()) != File.Hash)
+            return true;
+    }
+
+    return false;
+}
+
 
-void ReloadableShader::Create(RenderStateCacheImpl*   pStateCache,
-                              IShader*                pShader,
-                              const ShaderCreateInfo& CreateInfo,
-                              IShader**               ppReloadableShader)
+void ReloadableShader::Create(RenderStateCacheImpl*            pStateCache,
+                              IShader*                         pShader,
+                              const ShaderCreateInfo&          CreateInfo,
+                              IShaderSourceInputStreamFactory* pShaderSourceFactory,
+                              IShader**                        ppReloadableShader)
 {
     try
     {
-        RefCntAutoPtr<ReloadableShader> pReloadableShader{MakeNewRCObj<ReloadableShader>()(pStateCache, pShader, CreateInfo)};
+        RefCntAutoPtr<ReloadableShader> pReloadableShader{MakeNewRCObj<ReloadableShader>()(pStateCache, pShader, CreateInfo, pShaderSourceFactory)};
         *ppReloadableShader = pReloadableShader.Detach();
     }
     catch (...)
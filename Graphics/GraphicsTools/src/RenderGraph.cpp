@@ -0,0 +1,898 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+
+#include "RenderGraph.hpp"
+
+#include <algorithm>
+
+#include "ScopedDebugGroup.hpp"
+#include "GraphicsAccessories.hpp"
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr RESOURCE_STATE ReadOnlyStates =
+    RESOURCE_STATE_GENERIC_READ |
+    RESOURCE_STATE_DEPTH_READ |
+    RESOURCE_STATE_RESOLVE_SOURCE |
+    RESOURCE_STATE_INPUT_ATTACHMENT |
+    RESOURCE_STATE_BUILD_AS_READ |
+    RESOURCE_STATE_SHADING_RATE;
+
+bool IsReadOnlyState(RESOURCE_STATE State)
+{
+    return State != RESOURCE_STATE_UNKNOWN && (State & ~ReadOnlyStates) == 0;
+}
+
+bool LifetimesOverlap(Uint32 First0, Uint32 Last0, Uint32 First1, Uint32 Last1)
+{
+    return First0 <= Last1 && First1 <= Last0;
+}
+
+bool MemoryRangesOverlap(Uint64 Offset0, Uint64 Size0, Uint64 Offset1, Uint64 Size1)
+{
+    return Offset0 < Offset1 + Size1 && Offset1 < Offset0 + Size0;
+}
+
+} // namespace
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::Read(ResourceId Id, RESOURCE_STATE State)
+{
+    m_Graph.AddAccess(m_PassIdx, Id, State, false);
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::Write(ResourceId Id, RESOURCE_STATE State)
+{
+    m_Graph.AddAccess(m_PassIdx, Id, State, true);
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::SetSideEffects()
+{
+    m_Graph.m_Passes[m_PassIdx].SideEffects = true;
+    return *this;
+}
+
+IDeviceObject* RenderGraph::Resource::GetObject() const
+{
+    return IsTexture ? static_cast<IDeviceObject*>(pTexture.RawPtr()) : static_cast<IDeviceObject*>(pBuffer.RawPtr());
+}
+
+bool RenderGraph::AliasedHeap::Placement::operator==(const Placement& RHS) const
+{
+    return TexDesc == RHS.TexDesc &&
+        BuffDesc == RHS.BuffDesc &&
+        BuffDesc.MiscFlags == RHS.BuffDesc.MiscFlags &&
+        FirstPass == RHS.FirstPass &&
+        LastPass == RHS.LastPass;
+}
+
+void RenderGraph::AliasedHeap::Clear()
+{
+    Layout.clear();
+    Textures.clear();
+    Buffers.clear();
+    Offsets.clear();
+    Sizes.clear();
+    pMemory.Release();
+    BindPending = false;
+}
+
+RenderGraph::RenderGraph(IRenderDevice* pDevice, const RenderGraphCreateInfo& CI) :
+    m_pDevice{pDevice},
+    m_EnableMemoryAliasing{CI.EnableMemoryAliasing},
+    m_MaxIdleFrames{CI.MaxIdleFrames}
+{
+    DEV_CHECK_ERR(m_pDevice, "Device must not be null");
+}
+
+RenderGraph::~RenderGraph()
+{
+}
+
+void RenderGraph::Reset()
+{
+    m_Passes.clear();
+    m_Resources.clear();
+}
+
+RenderGraph::ResourceId RenderGraph::AddResource(Resource&& Res)
+{
+    m_Resources.emplace_back(std::move(Res));
+    return static_cast<ResourceId>(m_Resources.size() - 1);
+}
+
+RenderGraph::ResourceId RenderGraph::ImportTexture(ITexture*      pTexture,
+                                                   RESOURCE_STATE InitialState,
+                                                   RESOURCE_STATE FinalState)
+{
+    DEV_CHECK_ERR(pTexture != nullptr, "Texture must not be null");
+    DEV_CHECK_ERR(InitialState != RESOURCE_STATE_UNKNOWN || pTexture->GetState() != RESOURCE_STATE_UNKNOWN,
+                  "The state of texture '", pTexture->GetDesc().Name, "' is unknown. Specify the initial state explicitly.");
+
+    Resource Res;
+    Res.Name         = pTexture->GetDesc().Name != nullptr ? pTexture->GetDesc().Name : "";
+    Res.TexDesc      = pTexture->GetDesc();
+    Res.pTexture     = pTexture;
+    Res.IsTexture    = true;
+    Res.Imported     = true;
+    Res.InitialState = InitialState;
+    Res.FinalState   = FinalState;
+    return AddResource(std::move(Res));
+}
+
+RenderGraph::ResourceId RenderGraph::ImportBuffer(IBuffer*       pBuffer,
+                                                  RESOURCE_STATE InitialState,
+                                                  RESOURCE_STATE FinalState)
+{
+    DEV_CHECK_ERR(pBuffer != nullptr, "Buffer must not be null");
+    DEV_CHECK_ERR(InitialState != RESOURCE_STATE_UNKNOWN || pBuffer->GetState() != RESOURCE_STATE_UNKNOWN,
+                  "The state of buffer '", pBuffer->GetDesc().Name, "' is unknown. Specify the initial state explicitly.");
+
+    Resource Res;
+    Res.Name         = pBuffer->GetDesc().Name != nullptr ? pBuffer->GetDesc().Name : "";
+    Res.BuffDesc     = pBuffer->GetDesc();
+    Res.pBuffer      = pBuffer;
+    Res.Imported     = true;
+    Res.InitialState = InitialState;
+    Res.FinalState   = FinalState;
+    return AddResource(std::move(Res));
+}
+
+RenderGraph::ResourceId RenderGraph::CreateTexture(const TextureDesc& Desc)
+{
+    DEV_CHECK_ERR(Desc.Usage == USAGE_DEFAULT, "Transient textures must use USAGE_DEFAULT");
+
+    Resource Res;
+    Res.Name      = Desc.Name != nullptr ? Desc.Name : "Render graph transient texture";
+    Res.TexDesc   = Desc;
+    Res.IsTexture = true;
+    if (Res.TexDesc.MipLevels == 0)
+    {
+        // Resolve the mip count so that the description matches the one of the created texture
+        Res.TexDesc.MipLevels = Desc.Is3D() ?
+            ComputeMipLevelsCount(Desc.Width, Desc.Height, Desc.Depth) :
+            ComputeMipLevelsCount(Desc.Width, Desc.Is1D() ? 1 : Desc.Height);
+    }
+    return AddResource(std::move(Res));
+}
+
+RenderGraph::ResourceId RenderGraph::CreateBuffer(const BufferDesc& Desc)
+{
+    DEV_CHECK_ERR(Desc.Usage == USAGE_DEFAULT, "Transient buffers must use USAGE_DEFAULT");
+
+    Resource Res;
+    Res.Name     = Desc.Name != nullptr ? Desc.Name : "Render graph transient buffer";
+    Res.BuffDesc = Desc;
+    return AddResource(std::move(Res));
+}
+
+void RenderGraph::AddPass(const char*         Name,
+                          SetupCallbackType   Setup,
+                          ExecuteCallbackType Execute)
+{
+    DEV_CHECK_ERR(Execute, "Execute callback must not be null");
+
+    Pass NewPass;
+    NewPass.Name    = Name != nullptr ? Name : "Render graph pass";
+    NewPass.Execute = std::move(Execute);
+    m_Passes.emplace_back(std::move(NewPass));
+
+    if (Setup)
+    {
+        PassBuilder Builder{*this, static_cast<Uint32>(m_Passes.size() - 1)};
+        Setup(Builder);
+    }
+}
+
+void RenderGraph::AddAccess(Uint32 PassIdx, ResourceId Id, RESOURCE_STATE State, bool Write)
+{
+    DEV_CHECK_ERR(Id < m_Resources.size(), "Resource id ", Id, " is out of range");
+    DEV_CHECK_ERR(State != RESOURCE_STATE_UNKNOWN && State != RESOURCE_STATE_UNDEFINED,
+                  "Pass '", m_Passes[PassIdx].Name, "' must specify the state of resource '", m_Resources[Id].Name, "'");
+    DEV_CHECK_ERR(Write || IsReadOnlyState(State),
+                  "Pass '", m_Passes[PassIdx].Name, "' reads resource '", m_Resources[Id].Name, "' in state ",
+                  GetResourceStateString(State), " that allows writes. Use PassBuilder::Write().");
+
+    m_Passes[PassIdx].Accesses.emplace_back(ResourceAccess{Id, State, Write});
+}
+
+void RenderGraph::CullPasses()
+{
+    // Walk the passes backwards and only keep the ones that produce results
+    // that are consumed by the passes that are kept.
+    std::vector<bool> IsConsumed(m_Resources.size(), false);
+    for (Uint32 PassIdx = static_cast<Uint32>(m_Passes.size()); PassIdx-- > 0;)
+    {
+        Pass& P  = m_Passes[PassIdx];
+        P.Culled = !P.SideEffects;
+        for (const ResourceAccess& Access : P.Accesses)
+        {
+            if (Access.Write && (m_Resources[Access.Id].Imported || IsConsumed[Access.Id]))
+                P.Culled = false;
+        }
+
+        if (P.Culled)
+        {
+            ++m_Stats.NumCulledPasses;
+            continue;
+        }
+
+        // A write may not overwrite the entire resource, so the passes that
+        // wrote the resource earlier are kept as well.
+        for (const ResourceAccess& Access : P.Accesses)
+            IsConsumed[Access.Id] = true;
+    }
+}
+
+void RenderGraph::ComputeLifetimes()
+{
+    for (Uint32 PassIdx = 0; PassIdx < m_Passes.size(); ++PassIdx)
+    {
+        const Pass& P = m_Passes[PassIdx];
+        if (P.Culled)
+            continue;
+
+        for (const ResourceAccess& Access : P.Accesses)
+        {
+            Resource& Res = m_Resources[Access.Id];
+            Res.FirstPass = std::min(Res.FirstPass, PassIdx);
+            Res.LastPass  = std::max(Res.LastPass, PassIdx);
+        }
+    }
+}
+
+bool RenderGraph::IsMemoryAliasingSupported(IDeviceContext* pCtx) const
+{
+    if (!m_EnableMemoryAliasing)
+        return false;
+
+    const RenderDeviceInfo& DeviceInfo = m_pDevice->GetDeviceInfo();
+    // Metal sparse textures must be created from the memory object, which is not known in advance
+    if (!DeviceInfo.Features.SparseResources || DeviceInfo.IsMetalDevice())
+        return false;
+
+    const SparseResourceProperties& SparseRes = m_pDevice->GetAdapterInfo().SparseResources;
+    if ((SparseRes.CapFlags & SPARSE_RESOURCE_CAP_FLAG_ALIASED) == 0 || SparseRes.StandardBlockSize == 0)
+        return false;
+
+    return (pCtx->GetDesc().QueueType & COMMAND_QUEUE_TYPE_SPARSE_BINDING) == COMMAND_QUEUE_TYPE_SPARSE_BINDING;
+}
+
+bool RenderGraph::IsSparseAliasingSupported(const Resource& Res) const
+{
+    const SparseResourceProperties& SparseRes = m_pDevice->GetAdapterInfo().SparseResources;
+    if (!Res.IsTexture)
+        return (SparseRes.CapFlags & SPARSE_RESOURCE_CAP_FLAG_BUFFER) != 0;
+
+    const TextureDesc& Desc = Res.TexDesc;
+    if (Desc.Type != RESOURCE_DIM_TEX_2D || Desc.SampleCount != 1 || (SparseRes.CapFlags & SPARSE_RESOURCE_CAP_FLAG_TEXTURE_2D) == 0)
+        return false;
+
+    const SparseTextureFormatInfo& SparseInfo = m_pDevice->GetSparseTextureFormatInfo(Desc.Format, Desc.Type, Desc.SampleCount);
+    return (SparseInfo.BindFlags & Desc.BindFlags) == Desc.BindFlags;
+}
+
+bool RenderGraph::BuildAliasedHeap(AliasedHeap& Heap, const std::vector<ResourceId>& Ids, bool IsTexture)
+{
+    Heap.Clear();
+
+    const Uint32 BlockSize = m_pDevice->GetAdapterInfo().SparseResources.StandardBlockSize;
+
+    std::vector<IDeviceObject*> Objects;
+    Objects.reserve(Ids.size());
+    for (ResourceId Id : Ids)
+    {
+        const Resource& Res = m_Resources[Id];
+
+        AliasedHeap::Placement Placement;
+        Placement.FirstPass = Res.FirstPass;
+        Placement.LastPass  = Res.LastPass;
+
+        Uint64 MemorySize = 0;
+        if (IsTexture)
+        {
+            Placement.TexDesc      = Res.TexDesc;
+            Placement.TexDesc.Name = nullptr;
+
+            TextureDesc Desc = Res.TexDesc;
+            Desc.Name        = Res.Name.c_str();
+            Desc.Usage       = USAGE_SPARSE;
+            Desc.MiscFlags |= MISC_TEXTURE_FLAG_SPARSE_ALIASING;
+
+            RefCntAutoPtr<ITexture> pTexture;
+            m_pDevice->CreateTexture(Desc, nullptr, &pTexture);
+            if (!pTexture)
+            {
+                LOG_WARNING_MESSAGE("Failed to create aliased sparse texture '", Res.Name, "'. Transient memory will not be aliased.");
+                Heap.Clear();
+                return false;
+            }
+
+            const TextureDesc&             TexDesc     = pTexture->GetDesc();
+            const SparseTextureProperties& SparseProps = pTexture->GetSparseProperties();
+            if (SparseProps.BlockSize != BlockSize)
+            {
+                LOG_WARNING_MESSAGE("Aliased sparse texture '", Res.Name, "' uses non-standard block size. Transient memory will not be aliased.");
+                Heap.Clear();
+                return false;
+            }
+
+            const Uint32 NumNormalMips = std::min(TexDesc.MipLevels, SparseProps.FirstMipInTail);
+            for (Uint32 Mip = 0; Mip < NumNormalMips; ++Mip)
+            {
+                const uint3 NumTilesInMip = GetNumSparseTilesInMipLevel(TexDesc, SparseProps.TileSize, Mip);
+                MemorySize += Uint64{NumTilesInMip.x} * NumTilesInMip.y * NumTilesInMip.z * SparseProps.BlockSize;
+            }
+            if (TexDesc.MipLevels > SparseProps.FirstMipInTail)
+                MemorySize += SparseProps.MipTailSize;
+
+            Objects.push_back(pTexture);
+            Heap.Textures.emplace_back(std::move(pTexture));
+        }
+        else
+        {
+            Placement.BuffDesc      = Res.BuffDesc;
+            Placement.BuffDesc.Name = nullptr;
+
+            BufferDesc Desc = Res.BuffDesc;
+            Desc.Name       = Res.Name.c_str();
+            Desc.Usage      = USAGE_SPARSE;
+            Desc.MiscFlags |= MISC_BUFFER_FLAG_SPARSE_ALIASING;
+
+            RefCntAutoPtr<IBuffer> pBuffer;
+            m_pDevice->CreateBuffer(Desc, nullptr, &pBuffer);
+            if (!pBuffer)
+            {
+                LOG_WARNING_MESSAGE("Failed to create aliased sparse buffer '", Res.Name, "'. Transient memory will not be aliased.");
+                Heap.Clear();
+                return false;
+            }
+
+            const SparseBufferProperties& SparseProps = pBuffer->GetSparseProperties();
+            if (SparseProps.BlockSize != BlockSize)
+            {
+                LOG_WARNING_MESSAGE("Aliased sparse buffer '", Res.Name, "' uses non-standard block size. Transient memory will not be aliased.");
+                Heap.Clear();
+                return false;
+            }
+            MemorySize = AlignUp(SparseProps.AddressSpaceSize, Uint64{BlockSize});
+
+            Objects.push_back(pBuffer);
+            Heap.Buffers.emplace_back(std::move(pBuffer));
+        }
+
+        Heap.Layout.push_back(Placement);
+        Heap.Sizes.push_back(MemorySize);
+    }
+
+    // Place every resource at the lowest offset that does not overlap the memory
+    // of the resources placed earlier whose lifetimes overlap.
+    Uint64 HeapSize = 0;
+    for (size_t i = 0; i < Heap.Layout.size(); ++i)
+    {
+        const AliasedHeap::Placement& Placement = Heap.Layout[i];
+
+        Uint64 Offset = 0;
+        for (bool Overlaps = true; Overlaps;)
+        {
+            Overlaps = false;
+            for (size_t j = 0; j < i; ++j)
+            {
+                if (LifetimesOverlap(Placement.FirstPass, Placement.LastPass, Heap.Layout[j].FirstPass, Heap.Layout[j].LastPass) &&
+                    MemoryRangesOverlap(Offset, Heap.Sizes[i], Heap.Offsets[j], Heap.Sizes[j]))
+                {
+                    Offset   = Heap.Offsets[j] + Heap.Sizes[j];
+                    Overlaps = true;
+                }
+            }
+        }
+        Heap.Offsets.push_back(Offset);
+        HeapSize = std::max(HeapSize, Offset + Heap.Sizes[i]);
+    }
+
+    if (HeapSize > 0)
+    {
+        // Use a single page so that any resource range fits into one page
+        DeviceMemoryCreateInfo MemCI;
+        MemCI.Desc.Name             = IsTexture ? "Render graph aliased texture memory" : "Render graph aliased buffer memory";
+        MemCI.Desc.Type             = DEVICE_MEMORY_TYPE_SPARSE;
+        MemCI.Desc.PageSize         = HeapSize;
+        MemCI.InitialSize           = HeapSize;
+        MemCI.ppCompatibleResources = Objects.data();
+        MemCI.NumResources          = static_cast<Uint32>(Objects.size());
+
+        m_pDevice->CreateDeviceMemory(MemCI, &Heap.pMemory);
+        if (!Heap.pMemory)
+        {
+            LOG_WARNING_MESSAGE("Failed to create render graph aliased memory. Transient memory will not be aliased.");
+            Heap.Clear();
+            return false;
+        }
+    }
+
+    Heap.BindPending = true;
+    return true;
+}
+
+void RenderGraph::AssignAliasedHeap(AliasedHeap& Heap, const std::vector<ResourceId>& Ids)
+{
+    VERIFY_EXPR(Heap.Layout.size() == Ids.size());
+    for (size_t i = 0; i < Ids.size(); ++i)
+    {
+        Resource& Res = m_Resources[Ids[i]];
+        if (Res.IsTexture)
+            Res.pTexture = Heap.Textures[i];
+        else
+            Res.pBuffer = Heap.Buffers[i];
+
+        // The resource must be activated by an aliasing transition if its memory is shared with
+        // any other resource. The previous resource is the one that used the memory last in this
+        // frame, or null if the memory was last used by a resource from the previous frame.
+        Uint32 LastPassBefore = 0;
+        for (size_t j = 0; j < Ids.size(); ++j)
+        {
+            if (j == i || !MemoryRangesOverlap(Heap.Offsets[i], Heap.Sizes[i], Heap.Offsets[j], Heap.Sizes[j]))
+                continue;
+
+            Res.NeedsAliasing = true;
+
+            const AliasedHeap::Placement& Other = Heap.Layout[j];
+            if (Other.LastPass < Res.FirstPass && (Res.pAliasedBefore == nullptr || Other.LastPass > LastPassBefore))
+            {
+                Res.pAliasedBefore = Res.IsTexture ? static_cast<IDeviceObject*>(Heap.Textures[j].RawPtr()) : static_cast<IDeviceObject*>(Heap.Buffers[j].RawPtr());
+                LastPassBefore     = Other.LastPass;
+            }
+        }
+
+        m_Stats.MemoryAliasedResourcesSize += Heap.Sizes[i];
+    }
+    m_Stats.NumMemoryAliasedResources += static_cast<Uint32>(Ids.size());
+    if (Heap.pMemory)
+        m_Stats.AliasedMemorySize += Heap.pMemory->GetCapacity();
+}
+
+void RenderGraph::AssignPooledObjects()
+{
+    for (PooledObject& Obj : m_PooledObjects)
+        Obj.InUse = false;
+
+    // Resources are processed in the order of their first use, so an object can be reused
+    // by any resource whose lifetime starts after the previous user of the object is done.
+    std::vector<ResourceId> Ids;
+    for (ResourceId Id = 0; Id < m_Resources.size(); ++Id)
+    {
+        const Resource& Res = m_Resources[Id];
+        if (!Res.Imported && Res.IsUsed() && Res.GetObject() == nullptr)
+            Ids.push_back(Id);
+    }
+    std::sort(Ids.begin(), Ids.end(), [this](ResourceId Id0, ResourceId Id1) {
+        return m_Resources[Id0].FirstPass < m_Resources[Id1].FirstPass;
+    });
+
+    for (ResourceId Id : Ids)
+    {
+        Resource& Res = m_Resources[Id];
+
+        PooledObject* pObj = nullptr;
+        for (PooledObject& Obj : m_PooledObjects)
+        {
+            if (Obj.InUse && Obj.BusyUntil >= Res.FirstPass)
+                continue;
+            if (Res.IsTexture ? (Obj.pTexture && Obj.pTexture->GetDesc() == Res.TexDesc) : (Obj.pBuffer && Obj.pBuffer->GetDesc() == Res.BuffDesc))
+            {
+                pObj = &Obj;
+                break;
+            }
+        }
+
+        if (pObj == nullptr)
+        {
+            PooledObject NewObj;
+            if (Res.IsTexture)
+            {
+                TextureDesc Desc = Res.TexDesc;
+                Desc.Name        = Res.Name.c_str();
+                m_pDevice->CreateTexture(Desc, nullptr, &NewObj.pTexture);
+                if (!NewObj.pTexture)
+                {
+                    LOG_ERROR_MESSAGE("Failed to create transient texture '", Res.Name, "'");
+                    continue;
+                }
+            }
+            else
+            {
+                BufferDesc Desc = Res.BuffDesc;
+                Desc.Name       = Res.Name.c_str();
+                m_pDevice->CreateBuffer(Desc, nullptr, &NewObj.pBuffer);
+                if (!NewObj.pBuffer)
+                {
+                    LOG_ERROR_MESSAGE("Failed to create transient buffer '", Res.Name, "'");
+                    continue;
+                }
+            }
+            m_PooledObjects.emplace_back(std::move(NewObj));
+            pObj = &m_PooledObjects.back();
+        }
+
+        if (!pObj->InUse)
+            ++m_Stats.NumPhysicalResources;
+
+        pObj->InUse      = true;
+        pObj->BusyUntil  = Res.LastPass;
+        pObj->IdleFrames = 0;
+
+        Res.pTexture = pObj->pTexture;
+        Res.pBuffer  = pObj->pBuffer;
+    }
+
+    // Release the objects that have not been used for too long
+    for (auto it = m_PooledObjects.begin(); it != m_PooledObjects.end();)
+    {
+        if (!it->InUse && ++it->IdleFrames > m_MaxIdleFrames)
+            it = m_PooledObjects.erase(it);
+        else
+            ++it;
+    }
+}
+
+void RenderGraph::BindAliasedHeaps(IDeviceContext* pCtx)
+{
+    std::vector<SparseTextureMemoryBindInfo>  TexBinds;
+    std::vector<SparseBufferMemoryBindInfo>   BuffBinds;
+    std::vector<SparseTextureMemoryBindRange> TexRanges;
+    std::vector<SparseBufferMemoryBindRange>  BuffRanges;
+
+    if (m_TextureHeap.BindPending)
+    {
+        // Reserve the ranges up front as the bind infos reference them
+        size_t NumRanges = 0;
+        for (const RefCntAutoPtr<ITexture>& pTexture : m_TextureHeap.Textures)
+            NumRanges += std::min(pTexture->GetDesc().MipLevels, pTexture->GetSparseProperties().FirstMipInTail) + 1;
+        TexRanges.reserve(NumRanges);
+
+        for (size_t i = 0; i < m_TextureHeap.Textures.size(); ++i)
+        {
+            ITexture*                      pTexture    = m_TextureHeap.Textures[i];
+            const TextureDesc&             Desc        = pTexture->GetDesc();
+            const SparseTextureProperties& SparseProps = pTexture->GetSparseProperties();
+
+            Uint64 MemOffset = m_TextureHeap.Offsets[i];
+
+            const Uint32 NumNormalMips = std::min(Desc.MipLevels, SparseProps.FirstMipInTail);
+            if (NumNormalMips > 0)
+            {
+                SparseTextureMemoryBindInfo NormalMipBindInfo;
+                NormalMipBindInfo.pTexture  = pTexture;
+                NormalMipBindInfo.pRanges   = TexRanges.data() + TexRanges.size();
+                NormalMipBindInfo.NumRanges = NumNormalMips;
+                for (Uint32 Mip = 0; Mip < NumNormalMips; ++Mip)
+                {
+                    const MipLevelProperties MipProps = GetMipLevelProperties(Desc, Mip);
+
+                    SparseTextureMemoryBindRange Range;
+                    Range.MipLevel = Mip;
+                    Range.Region   = Box{0, MipProps.StorageWidth, 0, MipProps.StorageHeight, 0, MipProps.Depth};
+
+                    const uint3 NumTilesInMip = GetNumSparseTilesInBox(Range.Region, SparseProps.TileSize);
+                    Range.pMemory             = m_TextureHeap.pMemory;
+                    Range.MemoryOffset        = MemOffset;
+                    Range.MemorySize          = Uint64{NumTilesInMip.x} * NumTilesInMip.y * NumTilesInMip.z * SparseProps.BlockSize;
+                    TexRanges.push_back(Range);
+
+                    MemOffset += Range.MemorySize;
+                }
+                TexBinds.push_back(NormalMipBindInfo);
+            }
+
+            if (Desc.MipLevels > SparseProps.FirstMipInTail)
+            {
+                SparseTextureMemoryBindInfo MipTailBindInfo;
+                MipTailBindInfo.pTexture  = pTexture;
+                MipTailBindInfo.pRanges   = TexRanges.data() + TexRanges.size();
+                MipTailBindInfo.NumRanges = 1;
+
+                SparseTextureMemoryBindRange Range;
+                Range.MipLevel     = SparseProps.FirstMipInTail;
+                Range.pMemory      = m_TextureHeap.pMemory;
+                Range.MemoryOffset = MemOffset;
+                Range.MemorySize   = SparseProps.MipTailSize;
+                TexRanges.push_back(Range);
+
+                TexBinds.push_back(MipTailBindInfo);
+            }
+        }
+        VERIFY_EXPR(TexRanges.size() <= NumRanges);
+        m_TextureHeap.BindPending = false;
+    }
+
+    if (m_BufferHeap.BindPending)
+    {
+        BuffRanges.reserve(m_BufferHeap.Buffers.size());
+        for (size_t i = 0; i < m_BufferHeap.Buffers.size(); ++i)
+        {
+            BuffRanges.emplace_back(0, m_BufferHeap.Offsets[i], m_BufferHeap.Sizes[i], m_BufferHeap.pMemory);
+
+            SparseBufferMemoryBindInfo BuffBindInfo;
+            BuffBindInfo.pBuffer   = m_BufferHeap.Buffers[i];
+            BuffBindInfo.pRanges   = &BuffRanges.back();
+            BuffBindInfo.NumRanges = 1;
+            BuffBinds.push_back(BuffBindInfo);
+        }
+        m_BufferHeap.BindPending = false;
+    }
+
+    if (TexBinds.empty() && BuffBinds.empty())
+        return;
+
+    BindSparseResourceMemoryAttribs BindMemAttribs;
+    BindMemAttribs.NumTextureBinds = static_cast<Uint32>(TexBinds.size());
+    BindMemAttribs.pTextureBinds   = TexBinds.data();
+    BindMemAttribs.NumBufferBinds  = static_cast<Uint32>(BuffBinds.size());
+    BindMemAttribs.pBufferBinds    = BuffBinds.data();
+    pCtx->BindSparseResourceMemory(BindMemAttribs);
+}
+
+void RenderGraph::Execute(IDeviceContext* pCtx)
+{
+    DEV_CHECK_ERR(pCtx != nullptr, "Device context must not be null");
+
+    m_Stats           = {};
+    m_Stats.NumPasses = static_cast<Uint32>(m_Passes.size());
+
+    for (Resource& Res : m_Resources)
+    {
+        Res.FirstPass      = ~0u;
+        Res.LastPass       = 0;
+        Res.pAliasedBefore = nullptr;
+        Res.NeedsAliasing  = false;
+        if (!Res.Imported)
+        {
+            Res.pTexture.Release();
+            Res.pBuffer.Release();
+        }
+    }
+
+    CullPasses();
+    ComputeLifetimes();
+
+    // Distribute the transient resources between the aliased heaps and the object pool.
+    // Heaps are only rebuilt when the set of resources or their lifetimes change, so that
+    // resources used by the frames in flight are never rebound.
+    std::vector<ResourceId> AliasedTextures;
+    std::vector<ResourceId> AliasedBuffers;
+    const bool              AliasMemory = IsMemoryAliasingSupported(pCtx);
+    for (ResourceId Id = 0; Id < m_Resources.size(); ++Id)
+    {
+        const Resource& Res = m_Resources[Id];
+        if (Res.Imported || !Res.IsUsed())
+            continue;
+
+        ++m_Stats.NumTransientResources;
+        if (AliasMemory && IsSparseAliasingSupported(Res))
+            (Res.IsTexture ? AliasedTextures : AliasedBuffers).push_back(Id);
+    }
+
+    auto SetupHeap = [this](AliasedHeap& Heap, std::vector<ResourceId>& Ids, bool IsTexture) {
+        std::stable_sort(Ids.begin(), Ids.end(), [this](ResourceId Id0, ResourceId Id1) {
+            return m_Resources[Id0].FirstPass < m_Resources[Id1].FirstPass;
+        });
+
+        std::vector<AliasedHeap::Placement> Layout;
+        Layout.reserve(Ids.size());
+        for (ResourceId Id : Ids)
+        {
+            const Resource& Res = m_Resources[Id];
+
+            AliasedHeap::Placement Placement;
+            Placement.FirstPass = Res.FirstPass;
+            Placement.LastPass  = Res.LastPass;
+            if (IsTexture)
+            {
+                Placement.TexDesc      = Res.TexDesc;
+                Placement.TexDesc.Name = nullptr;
+            }
+            else
+            {
+                Placement.BuffDesc      = Res.BuffDesc;
+                Placement.BuffDesc.Name = nullptr;
+            }
+            Layout.push_back(Placement);
+        }
+
+        if (Ids.empty())
+        {
+            Heap.Clear();
+            return;
+        }
+
+        if (Layout != Heap.Layout && !BuildAliasedHeap(Heap, Ids, IsTexture))
+        {
+            // Do not try again every frame. The resources will be allocated from the pool.
+            m_EnableMemoryAliasing = false;
+            Ids.clear();
+            return;
+        }
+
+        AssignAliasedHeap(Heap, Ids);
+    };
+    SetupHeap(m_TextureHeap, AliasedTextures, true);
+    SetupHeap(m_BufferHeap, AliasedBuffers, false);
+    m_Stats.NumPhysicalResources = m_Stats.NumMemoryAliasedResources;
+
+    AssignPooledObjects();
+    BindAliasedHeaps(pCtx);
+
+    struct ResourceState
+    {
+        RESOURCE_STATE State     = RESOURCE_STATE_UNKNOWN;
+        bool           LastWrite = false;
+        bool           Used      = false;
+    };
+    std::vector<ResourceState> States(m_Resources.size());
+    for (size_t i = 0; i < m_Resources.size(); ++i)
+    {
+        const Resource& Res = m_Resources[i];
+        if (Res.GetObject() != nullptr)
+        {
+            States[i].State = Res.InitialState != RESOURCE_STATE_UNKNOWN ?
+                Res.InitialState :
+                (Res.IsTexture ? Res.pTexture->GetState() : Res.pBuffer->GetState());
+        }
+    }
+
+    std::vector<StateTransitionDesc> Barriers;
+    std::vector<ResourceAccess>      Accesses;
+    for (Pass& P : m_Passes)
+    {
+        if (P.Culled)
+            continue;
+
+        // Merge the accesses to the same resource
+        Accesses.clear();
+        for (const ResourceAccess& Access : P.Accesses)
+        {
+            auto it = std::find_if(Accesses.begin(), Accesses.end(), [&Access](const ResourceAccess& A) { return A.Id == Access.Id; });
+            if (it != Accesses.end())
+            {
+                it->State |= Access.State;
+                it->Write = it->Write || Access.Write;
+            }
+            else
+            {
+                Accesses.push_back(Access);
+            }
+        }
+
+        Barriers.clear();
+        for (const ResourceAccess& Access : Accesses)
+        {
+            const Resource& Res = m_Resources[Access.Id];
+            IDeviceObject*  pObj = Res.GetObject();
+            if (pObj == nullptr)
+                continue;
+
+            ResourceState& State    = States[Access.Id];
+            const bool     FirstUse = !State.Used && !Res.Imported;
+            if (FirstUse && Res.NeedsAliasing)
+                Barriers.emplace_back(Res.pAliasedBefore, pObj);
+
+            bool NeedsTransition = true;
+            if (State.State == Access.State)
+            {
+                // Dependent unordered accesses must be separated by a UAV barrier
+                NeedsTransition = Access.State == RESOURCE_STATE_UNORDERED_ACCESS && (Access.Write || State.LastWrite);
+            }
+            else if (!Access.Write && IsReadOnlyState(State.State) && (State.State & Access.State) == Access.State)
+            {
+                // The resource is already in a read-only state that includes the requested one
+                NeedsTransition = false;
+            }
+
+            if (NeedsTransition)
+            {
+                RESOURCE_STATE NewState = Access.State;
+                // Keep buffers in all read-only states they have been used in so that
+                // alternating reads do not require transitions. Texture layouts cannot be combined
+                // in all backends, so textures are always transitioned to the requested state.
+                if (!Res.IsTexture && !Access.Write && IsReadOnlyState(State.State))
+                    NewState |= State.State;
+
+                STATE_TRANSITION_FLAGS Flags = STATE_TRANSITION_FLAG_UPDATE_STATE;
+                if (FirstUse)
+                    Flags |= STATE_TRANSITION_FLAG_DISCARD_CONTENT;
+
+                StateTransitionDesc Barrier = Res.IsTexture ?
+                    StateTransitionDesc{Res.pTexture, State.State, NewState, Flags} :
+                    StateTransitionDesc{Res.pBuffer, State.State, NewState, Flags};
+                Barriers.push_back(Barrier);
+
+                State.State = NewState;
+            }
+
+            State.LastWrite = Access.Write;
+            State.Used      = true;
+        }
+
+        if (!Barriers.empty())
+        {
+            pCtx->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+            ++m_Stats.NumBarrierBatches;
+            m_Stats.NumBarriers += static_cast<Uint32>(Barriers.size());
+        }
+
+        ScopedDebugGroup DebugGroup{pCtx, P.Name};
+        P.Execute(pCtx, *this);
+    }
+
+    // Transition imported resources to their final states
+    Barriers.clear();
+    for (size_t i = 0; i < m_Resources.size(); ++i)
+    {
+        const Resource& Res = m_Resources[i];
+        if (!Res.Imported || Res.FinalState == RESOURCE_STATE_UNKNOWN || States[i].State == Res.FinalState)
+            continue;
+
+        StateTransitionDesc Barrier = Res.IsTexture ?
+            StateTransitionDesc{Res.pTexture, States[i].State, Res.FinalState, STATE_TRANSITION_FLAG_UPDATE_STATE} :
+            StateTransitionDesc{Res.pBuffer, States[i].State, Res.FinalState, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        Barriers.push_back(Barrier);
+    }
+    if (!Barriers.empty())
+    {
+        pCtx->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+        ++m_Stats.NumBarrierBatches;
+        m_Stats.NumBarriers += static_cast<Uint32>(Barriers.size());
+    }
+}
+
+ITexture* RenderGraph::GetTexture(ResourceId Id) const
+{
+    DEV_CHECK_ERR(Id < m_Resources.size() && m_Resources[Id].IsTexture, "Resource ", Id, " is not a texture");
+    return m_Resources[Id].pTexture;
+}
+
+IBuffer* RenderGraph::GetBuffer(ResourceId Id) const
+{
+    DEV_CHECK_ERR(Id < m_Resources.size() && !m_Resources[Id].IsTexture, "Resource ", Id, " is not a buffer");
+    return m_Resources[Id].pBuffer;
+}
+
+bool RenderGraph::IsPassCulled(Uint32 PassIdx) const
+{
+    DEV_CHECK_ERR(PassIdx < m_Passes.size(), "Pass index ", PassIdx, " is out of range");
+    return m_Passes[PassIdx].Culled;
+}
+
+} // namespace Diligent
@@ -33,7 +33,10 @@
 #include "AsyncPipelineState.hpp"
 
 #include <array>
+#include <algorithm>
+#include <cstring>
 #include <mutex>
+#include <unordered_set>
 #include <vector>
 
 #include "Archiver.h"
@@ -41,6 +44,10 @@
 #include "ArchiverFactory.h"
 
 #include "PipelineStateBase.hpp"
+#include "DeviceObjectArchive.hpp"
+#include "ThreadPool.hpp"
+#include "DataBlobImpl.hpp"
+#include "ProxyDataBlob.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "SerializationDevice.h"
 #include "SerializedShader.h"
@@ -49,11 +56,191 @@
 #include "GraphicsUtilities.h"
 #include "ShaderSourceFactoryUtils.hpp"
 #include "DXCompiler.hpp"
+#include "ShaderToolsCommon.hpp"
 
 namespace Diligent
 {
 
-Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+namespace
+{
+
+// The render state cache data is a journal of segments. Every segment is a device object archive
+// preceded by this header. WriteToBlob() writes the entire cache contents as a single segment,
+// while WriteDeltaToBlob() writes the render states added since the last write, which the
+// application appends to the existing data.
+struct RenderStateCacheJournalSegmentHeader
+{
+    static constexpr Uint32 MagicNumber = 0x4A435352; // RSCJ
+    static constexpr Uint32 Version     = 1;
+
+    Uint32 Magic      = MagicNumber;
+    Uint32 SegVersion = Version;
+    Uint64 DataSize   = 0;
+    Uint64 HashLow    = 0;
+    Uint64 HashHigh   = 0;
+};
+static_assert(sizeof(RenderStateCacheJournalSegmentHeader) == 32, "Journal segment header size must not change");
+
+XXH128Hash ComputeSegmentHash(const void* pData, size_t Size)
+{
+    XXH128State Hasher;
+    Hasher.UpdateRaw(pData, Size);
+    return Hasher.Digest();
+}
+
+} // namespace
+
+bool RenderStateCacheImpl::Load(const IDataBlob* pCacheData,
+                                Uint32           ContentVersion,
+                                bool             MakeCopy)
+{
+    using SegmentHeader = RenderStateCacheJournalSegmentHeader;
+
+    m_NeedsCompaction = false;
+
+    const size_t DataSize = pCacheData != nullptr ? pCacheData->GetSize() : 0;
+    Uint32       Magic    = 0;
+    if (DataSize >= sizeof(SegmentHeader))
+        memcpy(&Magic, pCacheData->GetConstDataPtr(), sizeof(Magic));
+
+    if (Magic != SegmentHeader::MagicNumber)
+    {
+        // Data written by previous versions is a plain device object archive
+        if (!LoadArchiveData(pCacheData, ContentVersion, MakeCopy))
+            return false;
+
+        m_NeedsCompaction = true;
+        return true;
+    }
+
+    // Segments reference the journal data, so copy it once if requested
+    RefCntAutoPtr<IDataBlob> pJournal;
+    if (MakeCopy)
+        pJournal = DataBlobImpl::Create(DataSize, pCacheData->GetConstDataPtr());
+    else
+        pJournal = const_cast<IDataBlob*>(pCacheData);
+
+    const Uint8* const pData = static_cast<const Uint8*>(pJournal->GetConstDataPtr());
+
+    size_t Offset      = 0;
+    Uint32 NumSegments = 0;
+    while (Offset < DataSize)
+    {
+        SegmentHeader Header;
+        if (DataSize - Offset < sizeof(Header))
+            break;
+        memcpy(&Header, pData + Offset, sizeof(Header));
+        if (Header.Magic != SegmentHeader::MagicNumber ||
+            Header.SegVersion != SegmentHeader::Version ||
+            Header.DataSize > DataSize - Offset - sizeof(Header))
+            break;
+
+        const Uint8*     pSegmentData = pData + Offset + sizeof(Header);
+        const size_t     SegmentSize  = static_cast<size_t>(Header.DataSize);
+        const XXH128Hash Hash         = ComputeSegmentHash(pSegmentData, SegmentSize);
+        if (Hash.LowPart != Header.HashLow || Hash.HighPart != Header.HashHigh)
+            break;
+
+        RefCntAutoPtr<IDataBlob> pSegment{ProxyDataBlob::Create(static_cast<const void*>(pSegmentData), SegmentSize, pJournal.RawPtr<IObject>())};
+        if (!LoadArchiveData(pSegment, ContentVersion, /*MakeCopy = */ false))
+        {
+            // The first segment contains the bulk of the data. If it can't be loaded
+            // (e.g. because the content version does not match), fail.
+            if (NumSegments == 0)
+                return false;
+            break;
+        }
+
+        ++NumSegments;
+        Offset += sizeof(Header) + SegmentSize;
+    }
+
+    if (NumSegments == 0)
+    {
+        LOG_ERROR_MESSAGE("Render state cache data is damaged.");
+        return false;
+    }
+
+    if (Offset < DataSize)
+    {
+        LOG_WARNING_MESSAGE("Render state cache journal is damaged at offset ", Offset, ". The remaining ",
+                            DataSize - Offset, " bytes are ignored.");
+    }
+
+    m_NeedsCompaction = NumSegments > 1 || Offset < DataSize;
+
+    return true;
+}
+
+bool RenderStateCacheImpl::LoadArchiveData(const IDataBlob* pArchive,
+                                           Uint32           ContentVersion,
+                                           bool             MakeCopy)
+{
+    if (!m_pDearchiver->LoadArchive(pArchive, ContentVersion, MakeCopy))
+        return false;
+
+    // Remember the shaders and pipelines in the archive so that they can be created by Prewarm() and Precompile()
+    try
+    {
+        DeviceObjectArchive::CreateInfo ArchiveCI;
+        ArchiveCI.pData          = pArchive;
+        ArchiveCI.ContentVersion = ContentVersion;
+        DeviceObjectArchive Archive{ArchiveCI};
+
+        using ResourceType = DeviceObjectArchive::ResourceType;
+        Archive.ProcessResources(
+            [this](ResourceType Type, const char* Name, const DeviceObjectArchive::ResourceData&) {
+                if (Type == ResourceType::StandaloneShader)
+                {
+                    ArchivedObjectInfo Info;
+                    if (ParseHashStr(Name, Info))
+                        m_ArchivedShaders.emplace_back(std::move(Info));
+                    return;
+                }
+
+                ArchivedPipelineInfo Info;
+                switch (Type)
+                {
+                    // clang-format off
+                    case ResourceType::GraphicsPipeline:   Info.Type = PIPELINE_TYPE_GRAPHICS;    break;
+                    case ResourceType::ComputePipeline:    Info.Type = PIPELINE_TYPE_COMPUTE;     break;
+                    case ResourceType::RayTracingPipeline: Info.Type = PIPELINE_TYPE_RAY_TRACING; break;
+                    case ResourceType::TilePipeline:       Info.Type = PIPELINE_TYPE_TILE;        break;
+                    // clang-format on
+                    default: return;
+                }
+
+                if (ParseHashStr(Name, Info))
+                    m_ArchivedPipelines.emplace_back(std::move(Info));
+            });
+    }
+    catch (...)
+    {
+        LOG_WARNING_MESSAGE("Failed to read the list of archived objects. Objects from this data will not be prewarmed.");
+    }
+
+    return true;
+}
+
+RefCntAutoPtr<IDataBlob> RenderStateCacheImpl::MakeJournalSegment(const IDataBlob* pArchive)
+{
+    const size_t     ArchiveSize = pArchive->GetSize();
+    const XXH128Hash Hash        = ComputeSegmentHash(pArchive->GetConstDataPtr(), ArchiveSize);
+
+    RenderStateCacheJournalSegmentHeader Header;
+    Header.DataSize = ArchiveSize;
+    Header.HashLow  = Hash.LowPart;
+    Header.HashHigh = Hash.HighPart;
+
+    RefCntAutoPtr<DataBlobImpl> pSegment = DataBlobImpl::Create(sizeof(Header) + ArchiveSize);
+    memcpy(pSegment->GetDataPtr(), &Header, sizeof(Header));
+    if (ArchiveSize > 0)
+        memcpy(pSegment->GetDataPtr(sizeof(Header)), pArchive->GetConstDataPtr(), ArchiveSize);
+
+    return RefCntAutoPtr<IDataBlob>{pSegment};
+}
+
+bool RenderStateCacheImpl::MergeNewStates(Uint32 ContentVersion, IDataBlob** ppNewData)
 {
     if (ContentVersion == ~0u)
     {
@@ -72,15 +259,45 @@ Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob
         return false;
     }
 
-    if (!m_pDearchiver->LoadArchive(pNewData, ContentVersion))
     {
-        LOG_ERROR_MESSAGE("Failed to add new render state data to existing archive");
-        return false;
+        // The new render states may have been added by any of the caches that share the archiver
+        std::lock_guard<std::mutex> Guard{m_pSharedData->CachesMtx};
+        for (RenderStateCacheImpl* pCache : m_pSharedData->Caches)
+        {
+            if (!pCache->m_pDearchiver->LoadArchive(pNewData, ContentVersion))
+            {
+                LOG_ERROR_MESSAGE("Failed to add new render state data to existing archive");
+                return false;
+            }
+        }
     }
 
     m_pArchiver->Reset();
+    m_pSharedData->NumUnsavedStates.store(0);
+
+    if (ppNewData != nullptr)
+        *ppNewData = pNewData.Detach();
 
-    return m_pDearchiver->Store(ppBlob);
+    return true;
+}
+
+Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+{
+    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
+    if (ppBlob == nullptr)
+        return false;
+
+    if (!MergeNewStates(ContentVersion, nullptr))
+        return false;
+
+    RefCntAutoPtr<IDataBlob> pArchive;
+    if (!m_pDearchiver->Store(&pArchive))
+        return false;
+
+    *ppBlob           = MakeJournalSegment(pArchive).Detach();
+    m_NeedsCompaction = false;
+
+    return true;
 }
 
 Bool RenderStateCacheImpl::WriteToStream(Uint32 ContentVersion, IFileStream* pStream)
@@ -96,14 +313,57 @@ Bool RenderStateCacheImpl::WriteToStream(Uint32 ContentVersion, IFileStream* pSt
     return pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
 }
 
+Bool RenderStateCacheImpl::WriteDeltaToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+{
+    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
+    if (ppBlob == nullptr)
+        return false;
+
+    *ppBlob = nullptr;
+    if (m_pSharedData->NumUnsavedStates.load() == 0)
+        return true;
+
+    RefCntAutoPtr<IDataBlob> pNewData;
+    if (!MergeNewStates(ContentVersion, &pNewData))
+        return false;
+
+    *ppBlob = MakeJournalSegment(pNewData).Detach();
+
+    return true;
+}
+
+Bool RenderStateCacheImpl::WriteDeltaToStream(Uint32 ContentVersion, IFileStream* pStream)
+{
+    DEV_CHECK_ERR(pStream != nullptr, "pStream must not be null");
+    if (pStream == nullptr)
+        return false;
+
+    RefCntAutoPtr<IDataBlob> pDataBlob;
+    if (!WriteDeltaToBlob(ContentVersion, &pDataBlob))
+        return false;
+
+    if (!pDataBlob)
+        return true;
+
+    return pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
+}
+
 void RenderStateCacheImpl::Reset()
 {
+    WaitForPrewarm();
+    m_ArchivedShaders.clear();
+    m_ArchivedPipelines.clear();
+    m_PrewarmedPipelines.clear();
+    m_PrecompiledShaders.clear();
+
     m_pDearchiver->Reset();
     m_pArchiver->Reset();
     m_Shaders.clear();
     m_ReloadableShaders.clear();
     m_Pipelines.clear();
     m_ReloadablePipelines.clear();
+    m_pSharedData->NumUnsavedStates.store(0);
+    m_NeedsCompaction = false;
 }
 
 RefCntAutoPtr<IShader> RenderStateCacheImpl::FindReloadableShader(IShader* pShader)
@@ -143,6 +403,50 @@ std::string RenderStateCacheImpl::MakeHashStr(const char* Name, const XXH128Hash
     return HashStr;
 }
 
+bool RenderStateCacheImpl::ParseHashStr(const char* HashStr, ArchivedObjectInfo& Info)
+{
+    // Parse the string produced by MakeHashStr: "Name [HASH]" or "HASH"
+    Info.ArchiveName = HashStr;
+
+    const std::string& Str      = Info.ArchiveName;
+    size_t             HexStart = 0;
+    size_t             HexEnd   = Str.length();
+    if (!Str.empty() && Str.back() == ']')
+    {
+        const size_t Pos = Str.rfind(" [");
+        if (Pos == std::string::npos)
+            return false;
+
+        Info.Name    = Str.substr(0, Pos);
+        Info.HasName = true;
+        HexStart     = Pos + 2;
+        HexEnd       = Str.length() - 1;
+    }
+
+    if (HexEnd - HexStart != 32)
+        return false;
+
+    Uint64 Parts[2] = {}; // High, Low
+    for (size_t i = 0; i < 32; ++i)
+    {
+        const char c = Str[HexStart + i];
+
+        Uint64 Digit = 0;
+        if (c >= '0' && c <= '9')
+            Digit = static_cast<Uint64>(c - '0');
+        else if (c >= 'A' && c <= 'F')
+            Digit = static_cast<Uint64>(c - 'A' + 10);
+        else
+            return false;
+
+        Parts[i / 16] = (Parts[i / 16] << 4u) | Digit;
+    }
+    Info.Hash.HighPart = Parts[0];
+    Info.Hash.LowPart  = Parts[1];
+
+    return true;
+}
+
 
 static void ComputeDeviceAttribsHash(XXH128State& Hasher, IRenderDevice* pDevice)
 {
@@ -153,6 +457,33 @@ static void ComputeDeviceAttribsHash(XXH128State& Hasher, IRenderDevice* pDevice
     }
 }
 
+// Initializes the shader create info that recreates the shader from its compiled bytecode
+static void InitShaderCIFromBytecode(RENDER_DEVICE_TYPE DeviceType, IShader* pShader, ShaderCreateInfo& ShaderCI)
+{
+    ShaderCI.Desc = pShader->GetDesc();
+
+    Uint64 Size = 0;
+    pShader->GetBytecode(&ShaderCI.ByteCode, Size);
+    ShaderCI.ByteCodeSize = static_cast<size_t>(Size);
+    if (DeviceType == RENDER_DEVICE_TYPE_GL || DeviceType == RENDER_DEVICE_TYPE_GLES)
+    {
+        ShaderCI.Source         = static_cast<const char*>(ShaderCI.ByteCode);
+        ShaderCI.ByteCode       = nullptr;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM;
+    }
+    else if (DeviceType == RENDER_DEVICE_TYPE_METAL)
+    {
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_MSL_VERBATIM;
+    }
+    else if (DeviceType == RENDER_DEVICE_TYPE_WEBGPU)
+    {
+        ShaderCI.Source                         = static_cast<const char*>(ShaderCI.ByteCode);
+        ShaderCI.ByteCode                       = nullptr;
+        ShaderCI.SourceLanguage                 = SHADER_SOURCE_LANGUAGE_WGSL;
+        ShaderCI.WebGPUEmulatedArrayIndexSuffix = GetWebGPUEmulatedArrayIndexSuffix(pShader);
+    }
+}
+
 static const char* GetDXCompilerLibName(IRenderDevice* pDevice)
 {
     if (IDXCompiler* pDXCompiler = GetDeviceDXCompiler(pDevice))
@@ -227,20 +558,82 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
             UNEXPECTED("Unknown device type");
     }
 
-    CreateInfo.pArchiverFactory->CreateSerializationDevice(SerializationDeviceCI, &m_pSerializationDevice);
-    if (!m_pSerializationDevice)
-        LOG_ERROR_AND_THROW("Failed to create serialization device");
+    if (CreateInfo.pSharedCache != nullptr)
+    {
+        const RenderStateCacheImpl& SharedCache = *ClassPtrCast<RenderStateCacheImpl>(CreateInfo.pSharedCache);
+        if (IsCompatibleSharedCache(SharedCache))
+        {
+            m_pSharedData             = SharedCache.m_pSharedData;
+            m_OwnsSerializationDevice = false;
+        }
+    }
 
-    m_pSerializationDevice->AddRenderDevice(m_pDevice);
+    if (!m_pSharedData)
+    {
+        m_pSharedData = std::make_shared<SharedData>();
+
+        CreateInfo.pArchiverFactory->CreateSerializationDevice(SerializationDeviceCI, &m_pSharedData->pSerializationDevice);
+        if (!m_pSharedData->pSerializationDevice)
+            LOG_ERROR_AND_THROW("Failed to create serialization device");
 
-    CreateInfo.pArchiverFactory->CreateArchiver(m_pSerializationDevice, &m_pArchiver);
-    if (!m_pArchiver)
-        LOG_ERROR_AND_THROW("Failed to create archiver");
+        m_pSharedData->pSerializationDevice->AddRenderDevice(m_pDevice);
+
+        CreateInfo.pArchiverFactory->CreateArchiver(m_pSharedData->pSerializationDevice, &m_pSharedData->pArchiver);
+        if (!m_pSharedData->pArchiver)
+            LOG_ERROR_AND_THROW("Failed to create archiver");
+    }
+    m_pSerializationDevice = m_pSharedData->pSerializationDevice;
+    m_pArchiver            = m_pSharedData->pArchiver;
 
     DearchiverCreateInfo DearchiverCI;
+    DearchiverCI.pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
     m_pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &m_pDearchiver);
     if (!m_pDearchiver)
         LOG_ERROR_AND_THROW("Failed to create dearchiver");
+
+    std::lock_guard<std::mutex> Guard{m_pSharedData->CachesMtx};
+    m_pSharedData->Caches.push_back(this);
+}
+
+RenderStateCacheImpl::~RenderStateCacheImpl()
+{
+    WaitForPrewarm();
+
+    std::lock_guard<std::mutex> Guard{m_pSharedData->CachesMtx};
+    auto it = std::find(m_pSharedData->Caches.begin(), m_pSharedData->Caches.end(), this);
+    if (it != m_pSharedData->Caches.end())
+        m_pSharedData->Caches.erase(it);
+}
+
+bool RenderStateCacheImpl::IsCompatibleSharedCache(const RenderStateCacheImpl& SharedCache) const
+{
+    // The serialization device of the shared cache compiles the shaders for its device,
+    // so the bytecode can only be reused if the compilation settings match.
+    const RenderDeviceInfo& DeviceInfo       = m_pDevice->GetDeviceInfo();
+    const RenderDeviceInfo& SharedDeviceInfo = SharedCache.m_pDevice->GetDeviceInfo();
+
+    const char* Mismatch = nullptr;
+    if (DeviceInfo.Type != SharedDeviceInfo.Type)
+        Mismatch = "device type";
+    else if (DeviceInfo.APIVersion != SharedDeviceInfo.APIVersion)
+        Mismatch = "API version";
+    else if (DeviceInfo.MaxShaderVersion != SharedDeviceInfo.MaxShaderVersion)
+        Mismatch = "shader version";
+    else if (DeviceInfo.NDC.MinZ != SharedDeviceInfo.NDC.MinZ)
+        Mismatch = "NDC depth range";
+    else if (DeviceInfo.Features.SeparablePrograms != SharedDeviceInfo.Features.SeparablePrograms)
+        Mismatch = "separable programs support";
+    else if (m_CI.FileHashMode != SharedCache.m_CI.FileHashMode)
+        Mismatch = "file hash mode";
+
+    if (Mismatch != nullptr)
+    {
+        LOG_WARNING_MESSAGE("Render state cache can't share the data with the cache of another device because the ", Mismatch,
+                            " is different. The cache will use its own data.");
+        return false;
+    }
+
+    return true;
 }
 
 #define RENDER_STATE_CACHE_LOG(Level, ...)                         \
@@ -306,7 +699,7 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
                     _ShaderCI.pShaderSourceStreamFactory = m_pReloadSource;
                 }
             }
-            ReloadableShader::Create(this, pShader, _ShaderCI, ppShader);
+            ReloadableShader::Create(this, pShader, _ShaderCI, ShaderCI.pShaderSourceStreamFactory, ppShader);
 
             std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
             m_ReloadableShaders.emplace(pShader->GetUniqueID(), RefCntWeakPtr<IShader>{*ppShader});
@@ -457,7 +850,10 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
         if (pArchivedShader)
         {
             if (m_pArchiver->AddShader(pArchivedShader))
+            {
+                m_pSharedData->NumUnsavedStates.fetch_add(1);
                 RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Added shader '", HashStr, "'.");
+            }
             else
                 LOG_ERROR_MESSAGE("Failed to archive shader '", HashStr, "'.");
         }
@@ -471,7 +867,18 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
         {
             if (RefCntAutoPtr<IShader> pShader{pSerializedShader->GetDeviceShader(m_DeviceType)})
             {
-                if (pShader->GetDesc() == ShaderCI.Desc)
+                if (!m_OwnsSerializationDevice)
+                {
+                    // The device shader belongs to the device of the cache that created the shared data
+                    pShader = CreateShaderFromDeviceShader(pShader, ShaderCI.Desc);
+                }
+
+                if (!pShader)
+                {
+                    LOG_ERROR_MESSAGE("Failed to create shader '", (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : "<unnamed>"),
+                                      "' from the bytecode compiled for another device. The shader will be compiled again.");
+                }
+                else if (pShader->GetDesc() == ShaderCI.Desc)
                 {
                     *ppShader = pShader.Detach();
                     return FoundInArchive;
@@ -498,6 +905,22 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
     return false;
 }
 
+RefCntAutoPtr<IShader> RenderStateCacheImpl::CreateShaderFromDeviceShader(IShader* pDeviceShader, const ShaderDesc& Desc)
+{
+    // The shader may still be compiling for another device. Waiting for it
+    // is cheaper than compiling the shader again.
+    if (pDeviceShader->GetStatus(/*WaitForCompletion = */ true) != SHADER_STATUS_READY)
+        return {};
+
+    ShaderCreateInfo ShaderCI;
+    InitShaderCIFromBytecode(m_DeviceType, pDeviceShader, ShaderCI);
+    ShaderCI.Desc = Desc;
+
+    RefCntAutoPtr<IShader> pShader;
+    m_pDevice->CreateShader(ShaderCI, &pShader);
+    return pShader;
+}
+
 template <typename CreateInfoType>
 struct RenderStateCacheImpl::SerializedPsoCIWrapperBase
 {
@@ -588,28 +1011,7 @@ protected:
         if (!pSerializedShader)
         {
             ShaderCreateInfo ShaderCI;
-            ShaderCI.Desc = pShader->GetDesc();
-
-            Uint64 Size = 0;
-            pShader->GetBytecode(&ShaderCI.ByteCode, Size);
-            ShaderCI.ByteCodeSize = static_cast<size_t>(Size);
-            if (DeviceType == RENDER_DEVICE_TYPE_GL || DeviceType == RENDER_DEVICE_TYPE_GLES)
-            {
-                ShaderCI.Source         = static_cast<const char*>(ShaderCI.ByteCode);
-                ShaderCI.ByteCode       = nullptr;
-                ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM;
-            }
-            else if (DeviceType == RENDER_DEVICE_TYPE_METAL)
-            {
-                ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_MSL_VERBATIM;
-            }
-            else if (DeviceType == RENDER_DEVICE_TYPE_WEBGPU)
-            {
-                ShaderCI.Source                         = static_cast<const char*>(ShaderCI.ByteCode);
-                ShaderCI.ByteCode                       = nullptr;
-                ShaderCI.SourceLanguage                 = SHADER_SOURCE_LANGUAGE_WGSL;
-                ShaderCI.WebGPUEmulatedArrayIndexSuffix = GetWebGPUEmulatedArrayIndexSuffix(pShader);
-            }
+            InitShaderCIFromBytecode(DeviceType, pShader, ShaderCI);
             ShaderArchiveInfo ArchiveInfo;
             ArchiveInfo.DeviceFlags = RenderDeviceTypeToArchiveDataFlag(DeviceType);
             pSerializationDevice->CreateShader(ShaderCI, ArchiveInfo, &pSerializedShader);
@@ -920,7 +1322,10 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
         if (pSerializedPSO)
         {
             if (m_pArchiver->AddPipelineState(pSerializedPSO))
+            {
+                m_pSharedData->NumUnsavedStates.fetch_add(1);
                 RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Added pipeline '", HashStr, "'.");
+            }
             else
                 LOG_ERROR_MESSAGE("Failed to archive PSO '", HashStr, "'.");
         }
@@ -940,32 +1345,54 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         return 0;
     }
 
-    Uint32 NumStatesReloaded = 0;
+    std::atomic<Uint32> NumStatesReloaded{0};
+
+    // Shader source files may have changed since they were cached
+    ClearShaderSourceFileCache();
+
+    IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
 
-    // Reload all shaders first
+    std::vector<RefCntAutoPtr<ReloadableShader>> Shaders;
     {
         std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
+        Shaders.reserve(m_ReloadableShaders.size());
         for (auto shader_it : m_ReloadableShaders)
         {
             if (RefCntAutoPtr<IShader> pShader = shader_it.second.Lock())
             {
                 RefCntAutoPtr<ReloadableShader> pReloadableShader{pShader, ReloadableShader::IID_InternalImpl};
                 if (pReloadableShader)
-                {
-                    if (pReloadableShader->Reload())
-                        ++NumStatesReloaded;
-                }
+                    Shaders.emplace_back(std::move(pReloadableShader));
                 else
-                {
                     UNEXPECTED("Shader object is not a ReloadableShader");
-                }
             }
         }
     }
 
-    // Reload pipelines.
+    // Reload shaders whose source files have changed.
+    // Files are read through the shader source file cache, so that common headers are only read once.
+    std::vector<Uint8> ShaderChanged(Shaders.size(), 0);
+    ParallelFor(pThreadPool, 0, static_cast<Uint32>(Shaders.size()), 1, [&](Uint32 i) {
+        ReloadableShader* pShader = Shaders[i];
+        if (!pShader->HasSourceChanges())
+            return;
+
+        ShaderChanged[i] = 1;
+        if (pShader->Reload())
+            NumStatesReloaded.fetch_add(1);
+    });
+
+    std::unordered_set<const IShader*> ChangedShaders;
+    for (size_t i = 0; i < Shaders.size(); ++i)
+    {
+        if (ShaderChanged[i] != 0)
+            ChangedShaders.emplace(Shaders[i].RawPtr());
+    }
+
+    // Reload pipelines that use changed shaders.
     // Note that create info structs reference reloadable shaders, so that when pipelines
     // are re-created, they will automatically use reloaded shaders.
+    std::vector<RefCntAutoPtr<ReloadablePipelineState>> Pipelines;
     {
         std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
         for (auto pso_it : m_ReloadablePipelines)
@@ -973,10 +1400,12 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
             if (RefCntAutoPtr<IPipelineState> pPSO = pso_it.second.Lock())
             {
                 RefCntAutoPtr<ReloadablePipelineState> pReloadablePSO{pPSO, ReloadablePipelineState::IID_InternalImpl};
-                if (pPSO)
+                if (pReloadablePSO)
                 {
-                    if (pReloadablePSO->Reload(ReloadGraphicsPipeline, pUserData))
-                        ++NumStatesReloaded;
+                    // The callback may modify the description of any graphics pipeline
+                    const bool ModifiedByCallback = ReloadGraphicsPipeline != nullptr && pPSO->GetDesc().IsAnyGraphicsPipeline();
+                    if (ModifiedByCallback || pReloadablePSO->UsesAnyShader(ChangedShaders))
+                        Pipelines.emplace_back(std::move(pReloadablePSO));
                 }
                 else
                 {
@@ -986,9 +1415,250 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         }
     }
 
+    // The application callback is always called from this thread
+    ParallelFor(ReloadGraphicsPipeline == nullptr ? pThreadPool : nullptr, 0, static_cast<Uint32>(Pipelines.size()), 1, [&](Uint32 i) {
+        if (Pipelines[i]->Reload(ReloadGraphicsPipeline, pUserData))
+            NumStatesReloaded.fetch_add(1);
+    });
+
+    RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Reloaded ", ChangedShaders.size(), " of ", Shaders.size(),
+                           " shader(s) and ", Pipelines.size(), " pipeline(s).");
+
     ++m_ReloadVersion;
 
-    return NumStatesReloaded;
+    return NumStatesReloaded.load();
+}
+
+bool RenderStateCacheImpl::PrecompileShader(const ArchivedObjectInfo& Info)
+{
+    {
+        std::lock_guard<std::mutex> Guard{m_ShadersMtx};
+
+        // The shader may have been requested by the application while the cache was precompiling
+        auto it = m_Shaders.find(Info.Hash);
+        if (it != m_Shaders.end() && it->second.IsValid())
+            return false;
+    }
+
+    // Restore the original shader name, same as CreateShaderInternal() does
+    auto Callback = MakeCallback(
+        [&Info](ShaderDesc& Desc) {
+            Desc.Name = Info.HasName ? Info.Name.c_str() : nullptr;
+        });
+
+    ShaderUnpackInfo UnpackInfo;
+    UnpackInfo.Name             = Info.ArchiveName.c_str();
+    UnpackInfo.pDevice          = m_pDevice;
+    UnpackInfo.ModifyShaderDesc = Callback;
+    UnpackInfo.pUserData        = Callback;
+    RefCntAutoPtr<IShader> pShader;
+    m_pDearchiver->UnpackShader(UnpackInfo, &pShader);
+    if (!pShader)
+    {
+        RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Failed to precompile shader '", Info.ArchiveName, "'.");
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> Guard{m_ShadersMtx};
+
+        RefCntWeakPtr<IShader>& pWeakShader = m_Shaders[Info.Hash];
+        if (pWeakShader.IsValid())
+            return false;
+        pWeakShader = RefCntWeakPtr<IShader>{pShader};
+    }
+
+    {
+        std::lock_guard<std::mutex> Guard{m_PrecompiledShadersMtx};
+        m_PrecompiledShaders.emplace_back(std::move(pShader));
+    }
+
+    return true;
+}
+
+Uint32 RenderStateCacheImpl::PrewarmPipelines(const ArchivedPipelineInfo* pPipelines, size_t NumPipelines)
+{
+    std::vector<PipelineStateUnpackInfo> UnpackInfos(NumPipelines);
+    for (size_t i = 0; i < NumPipelines; ++i)
+    {
+        PipelineStateUnpackInfo& UnpackInfo = UnpackInfos[i];
+
+        UnpackInfo.PipelineType = pPipelines[i].Type;
+        UnpackInfo.Name         = pPipelines[i].ArchiveName.c_str();
+        UnpackInfo.pDevice      = m_pDevice;
+        // Restore the original pipeline name, same as CreatePipelineStateInternal() does
+        UnpackInfo.ModifyPipelineStateCreateInfo = [](PipelineStateCreateInfo& CI, void* pUserData) {
+            const ArchivedPipelineInfo& Info = *static_cast<const ArchivedPipelineInfo*>(pUserData);
+            CI.PSODesc.Name                  = Info.HasName ? Info.Name.c_str() : nullptr;
+        };
+        UnpackInfo.pUserData = const_cast<ArchivedPipelineInfo*>(&pPipelines[i]);
+    }
+
+    std::vector<IPipelineState*> PSOs(NumPipelines);
+    m_pDearchiver->UnpackPipelineStates(UnpackInfos.data(), static_cast<Uint32>(UnpackInfos.size()), PSOs.data());
+
+    Uint32 NumPrewarmed = 0;
+    for (size_t i = 0; i < NumPipelines; ++i)
+    {
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pPSO.Attach(PSOs[i]);
+        if (!pPSO)
+        {
+            RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Failed to prewarm pipeline '", pPipelines[i].ArchiveName, "'.");
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> Guard{m_PipelinesMtx};
+
+            // The pipeline may have been requested by the application while the cache was prewarming
+            RefCntWeakPtr<IPipelineState>& pWeakPSO = m_Pipelines[pPipelines[i].Hash];
+            if (pWeakPSO.IsValid())
+                continue;
+            pWeakPSO = RefCntWeakPtr<IPipelineState>{pPSO};
+        }
+
+        {
+            std::lock_guard<std::mutex> Guard{m_PrewarmedPipelinesMtx};
+            m_PrewarmedPipelines.emplace_back(std::move(pPSO));
+        }
+        ++NumPrewarmed;
+    }
+
+    return NumPrewarmed;
+}
+
+void RenderStateCacheImpl::PrecompileStates(const std::vector<ArchivedObjectInfo>& Shaders, const std::vector<ArchivedPipelineInfo>& Pipelines)
+{
+    Uint32 NumShaders   = 0;
+    Uint32 NumPipelines = 0;
+    for (const ArchivedObjectInfo& Info : Shaders)
+    {
+        if (m_AbortPrewarm.load())
+            return;
+
+        if (PrecompileShader(Info))
+            ++NumShaders;
+        m_NumShadersPrecompiled.fetch_add(1);
+    }
+
+    // Unpack pipelines in batches so that the progress can be reported and the operation can
+    // be aborted, while the dearchiver can still compile the pipelines of a batch in parallel.
+    constexpr size_t PipelineBatchSize = 16;
+    for (size_t Start = 0; Start < Pipelines.size(); Start += PipelineBatchSize)
+    {
+        if (m_AbortPrewarm.load())
+            return;
+
+        const size_t BatchSize = std::min(PipelineBatchSize, Pipelines.size() - Start);
+        NumPipelines += PrewarmPipelines(&Pipelines[Start], BatchSize);
+        m_NumPipelinesPrecompiled.fetch_add(static_cast<Uint32>(BatchSize));
+    }
+
+    RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Precompiled ", NumShaders, " of ", Shaders.size(), " shaders and ", NumPipelines, " of ", Pipelines.size(), " pipelines.");
+}
+
+Uint32 RenderStateCacheImpl::StartPrecompile(IThreadPool* pThreadPool, float Priority, bool IncludeShaders, IAsyncTask** ppTask)
+{
+    if (ppTask != nullptr)
+        *ppTask = nullptr;
+
+    WaitForPrewarm();
+
+    // Skip the objects that have already been created
+    std::vector<ArchivedObjectInfo> Shaders;
+    if (IncludeShaders)
+    {
+        std::lock_guard<std::mutex> Guard{m_ShadersMtx};
+        for (const ArchivedObjectInfo& Info : m_ArchivedShaders)
+        {
+            auto it = m_Shaders.find(Info.Hash);
+            if (it == m_Shaders.end() || !it->second.IsValid())
+                Shaders.push_back(Info);
+        }
+    }
+
+    std::vector<ArchivedPipelineInfo> Pipelines;
+    {
+        std::lock_guard<std::mutex> Guard{m_PipelinesMtx};
+        for (const ArchivedPipelineInfo& Info : m_ArchivedPipelines)
+        {
+            auto it = m_Pipelines.find(Info.Hash);
+            if (it == m_Pipelines.end() || !it->second.IsValid())
+                Pipelines.push_back(Info);
+        }
+    }
+
+    m_NumShadersToPrecompile.store(static_cast<Uint32>(Shaders.size()));
+    m_NumShadersPrecompiled.store(0);
+    m_NumPipelinesToPrecompile.store(static_cast<Uint32>(Pipelines.size()));
+    m_NumPipelinesPrecompiled.store(0);
+
+    const Uint32 NumObjects = static_cast<Uint32>(Shaders.size() + Pipelines.size());
+    if (NumObjects == 0)
+        return 0;
+
+    if (pThreadPool == nullptr)
+    {
+        PrecompileStates(Shaders, Pipelines);
+        return NumObjects;
+    }
+
+    m_pPrewarmThreadPool = pThreadPool;
+    m_pPrewarmTask       = EnqueueAsyncWork(
+        pThreadPool,
+        [this, Shaders = std::move(Shaders), Pipelines = std::move(Pipelines)](Uint32 ThreadId) {
+            PrecompileStates(Shaders, Pipelines);
+            return ASYNC_TASK_STATUS_COMPLETE;
+        },
+        Priority);
+
+    if (ppTask != nullptr)
+    {
+        *ppTask = m_pPrewarmTask;
+        (*ppTask)->AddRef();
+    }
+
+    return NumObjects;
+}
+
+Uint32 RenderStateCacheImpl::Prewarm(IAsyncTask** ppTask)
+{
+    // Use low priority so that the warm-up does not delay shaders and pipelines
+    // that are requested by the application
+    constexpr float PrewarmTaskPriority = -1.f;
+    return StartPrecompile(m_pDevice->GetShaderCompilationThreadPool(), PrewarmTaskPriority, /*IncludeShaders = */ false, ppTask);
+}
+
+Uint32 RenderStateCacheImpl::Precompile(IThreadPool* pThreadPool, Float32 Priority, IAsyncTask** ppTask)
+{
+    if (pThreadPool == nullptr)
+        pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+    return StartPrecompile(pThreadPool, Priority, /*IncludeShaders = */ true, ppTask);
+}
+
+void RenderStateCacheImpl::GetPrecompileProgress(RenderStateCachePrecompileProgress& Progress) const
+{
+    Progress.NumShaders            = m_NumShadersToPrecompile.load();
+    Progress.NumShadersProcessed   = m_NumShadersPrecompiled.load();
+    Progress.NumPipelines          = m_NumPipelinesToPrecompile.load();
+    Progress.NumPipelinesProcessed = m_NumPipelinesPrecompiled.load();
+}
+
+void RenderStateCacheImpl::WaitForPrewarm()
+{
+    if (!m_pPrewarmTask)
+        return;
+
+    // Remove the task from the queue if it has not started yet, otherwise
+    // let it stop after the current object.
+    m_AbortPrewarm.store(true);
+    if (!m_pPrewarmThreadPool->RemoveTask(m_pPrewarmTask))
+        m_pPrewarmTask->WaitForCompletion();
+    m_AbortPrewarm.store(false);
+
+    m_pPrewarmTask.Release();
+    m_pPrewarmThreadPool.Release();
 }
 
 static constexpr char RenderStateCacheFileExtension[] = ".diligentcache";
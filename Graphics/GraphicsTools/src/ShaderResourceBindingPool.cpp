@@ -0,0 +1,171 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ShaderResourceBindingPool.hpp"
+
+#include <algorithm>
+
+#include "BasicMath.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+ShaderResourceBindingPool::ShaderResourceBindingPool(const ShaderResourceBindingPoolCreateInfo& CI) :
+    m_pSignature{CI.pSignature},
+    m_InitStaticResources{CI.InitStaticResources},
+    m_GrowSize{std::max(CI.GrowSize, 1u)}
+{
+    if (!m_pSignature && CI.pPSO != nullptr)
+    {
+        DEV_CHECK_ERR(CI.pPSO->GetResourceSignatureCount() == 1,
+                      "Pipeline state '", CI.pPSO->GetDesc().Name, "' uses multiple resource signatures. Specify the signature explicitly.");
+        m_pSignature = CI.pPSO->GetResourceSignature(0);
+    }
+    if (!m_pSignature)
+    {
+        DEV_ERROR("Either pSignature or pPSO must not be null");
+        return;
+    }
+
+    const PipelineResourceSignatureDesc& Desc = m_pSignature->GetDesc();
+    for (Uint32 i = 0; i < Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& Res = Desc.Resources[i];
+        if (Res.VarType != SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+            m_ShaderStages |= Res.ShaderStages;
+    }
+
+    if (CI.InitialSize > 0)
+        Grow(CI.InitialSize);
+}
+
+void ShaderResourceBindingPool::Grow(Uint32 Count)
+{
+    std::vector<IShaderResourceBinding*> pSRBs(Count);
+    m_pSignature->CreateShaderResourceBindings(Count, pSRBs.data(), m_InitStaticResources);
+
+    m_FreeSRBs.reserve(m_FreeSRBs.size() + Count);
+    for (IShaderResourceBinding* pSRB : pSRBs)
+    {
+        if (pSRB == nullptr)
+        {
+            UNEXPECTED("Failed to create shader resource binding");
+            continue;
+        }
+        // Take ownership of the reference returned by CreateShaderResourceBindings
+        m_FreeSRBs.emplace_back();
+        m_FreeSRBs.back().Attach(pSRB);
+    }
+}
+
+void ShaderResourceBindingPool::ResetSRB(IShaderResourceBinding* pSRB) const
+{
+    IDeviceObject* const pNull = nullptr;
+
+    SHADER_TYPE Stages = m_ShaderStages;
+    while (Stages != SHADER_TYPE_UNKNOWN)
+    {
+        const SHADER_TYPE Stage   = ExtractLSB(Stages);
+        const Uint32      NumVars = pSRB->GetVariableCount(Stage);
+        for (Uint32 v = 0; v < NumVars; ++v)
+        {
+            IShaderResourceVariable* pVar = pSRB->GetVariableByIndex(Stage, v);
+            if (pVar == nullptr)
+                continue;
+
+            ShaderResourceDesc ResDesc;
+            pVar->GetResourceDesc(ResDesc);
+            for (Uint32 elem = 0; elem < ResDesc.ArraySize; ++elem)
+            {
+                // Variables shared by several stages are visited once per stage,
+                // so skip elements that have already been unbound.
+                if (pVar->Get(elem) != nullptr)
+                    pVar->SetArray(&pNull, elem, 1, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+            }
+        }
+    }
+}
+
+void ShaderResourceBindingPool::CollectUnsafe()
+{
+    for (size_t i = 0; i < m_UsedSRBs.size();)
+    {
+        RefCntAutoPtr<IShaderResourceBinding>& pSRB = m_UsedSRBs[i];
+        // The pool holds the only reference, so no one else can acquire a new one
+        if (pSRB->GetReferenceCounters()->GetNumStrongRefs() == 1)
+        {
+            ResetSRB(pSRB);
+            m_FreeSRBs.emplace_back(std::move(pSRB));
+            pSRB = std::move(m_UsedSRBs.back());
+            m_UsedSRBs.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+void ShaderResourceBindingPool::Collect()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    CollectUnsafe();
+}
+
+RefCntAutoPtr<IShaderResourceBinding> ShaderResourceBindingPool::Acquire()
+{
+    if (!m_pSignature)
+        return {};
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    if (m_FreeSRBs.empty())
+        CollectUnsafe();
+    if (m_FreeSRBs.empty())
+        Grow(m_GrowSize);
+    if (m_FreeSRBs.empty())
+        return {};
+
+    m_UsedSRBs.emplace_back(std::move(m_FreeSRBs.back()));
+    m_FreeSRBs.pop_back();
+    return m_UsedSRBs.back();
+}
+
+size_t ShaderResourceBindingPool::GetSize() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return m_UsedSRBs.size() + m_FreeSRBs.size();
+}
+
+size_t ShaderResourceBindingPool::GetNumFreeSRBs() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return m_FreeSRBs.size();
+}
+
+} // namespace Diligent
@@ -0,0 +1,498 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShadingRateGenerator.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Every tile is processed by one thread group
+constexpr Uint32 TileGroupSize      = 8;
+constexpr Uint32 ColumnRowGroupSize = 64;
+constexpr Uint32 DefaultTileSize    = 16;
+
+constexpr char ShadingRateTileCS[] = R"(
+#define OUTPUT_PALETTE 0
+#define OUTPUT_DENSITY 1
+#define OUTPUT_BUFFER  2
+
+#ifndef GROUP_SIZE
+#   define GROUP_SIZE 8
+#endif
+
+cbuffer cbShadingRateAttribs
+{
+    uint2  g_ColorSize;
+    uint2  g_NumTiles;
+    float2 g_MotionVectorScale;
+    float  g_ContrastThreshold;
+    float  g_MotionSensitivity;
+    uint   g_TileSize;
+    uint   g_Padding0;
+    uint   g_Padding1;
+    uint   g_Padding2;
+    // Maps the rate selected for the tile to a rate supported by the device
+    uint4  g_RateRemap[4];
+}
+
+Texture2D<float4> g_Color;
+#if USE_MOTION_VECTORS
+Texture2D<float4> g_MotionVectors;
+#endif
+
+#if OUTPUT_MODE == OUTPUT_PALETTE
+VK_IMAGE_FORMAT("r8ui") RWTexture2D<uint /*format=r8ui*/> g_ShadingRate;
+#elif OUTPUT_MODE == OUTPUT_DENSITY
+VK_IMAGE_FORMAT("rg8") RWTexture2D<unorm float4 /*format=rg8*/> g_ShadingRate;
+#else
+RWStructuredBuffer<uint> g_TileRates;
+#endif
+
+groupshared float4 g_Stats[GROUP_SIZE * GROUP_SIZE];
+
+float LoadLuminance(uint2 Coord)
+{
+    float3 Color = g_Color.Load(int3(min(Coord, g_ColorSize - uint2(1u, 1u)), 0)).rgb;
+    return dot(saturate(Color), float3(0.2126, 0.7152, 0.0722));
+}
+
+// Returns the log2 of the rate reduction along the axis
+uint SelectAxisRate(float Error, float Threshold)
+{
+    // The error of the quarter rate is estimated as 2.13 times the error of the half rate
+    // (K. Vaidyanathan et al., "Perceptually Driven Content Adaptive Shading")
+    if (Error * 2.13 < Threshold)
+        return 2u;
+    else if (Error < Threshold)
+        return 1u;
+    else
+        return 0u;
+}
+
+[numthreads(GROUP_SIZE, GROUP_SIZE, 1)]
+void main(uint3 Gid  : SV_GroupID,
+          uint3 GTid : SV_GroupThreadID,
+          uint  GI   : SV_GroupIndex)
+{
+    uint2 TileOrigin = Gid.xy * g_TileSize;
+
+    // x: sum of horizontal differences, y: sum of vertical differences, z: sum of luminance, w: max motion
+    float4 Stats      = float4(0.0, 0.0, 0.0, 0.0);
+    float  NumTexels  = 0.0;
+    for (uint y = GTid.y; y < g_TileSize; y += uint(GROUP_SIZE))
+    {
+        for (uint x = GTid.x; x < g_TileSize; x += uint(GROUP_SIZE))
+        {
+            uint2 Coord = TileOrigin + uint2(x, y);
+            if (Coord.x >= g_ColorSize.x || Coord.y >= g_ColorSize.y)
+                continue;
+
+            float L = LoadLuminance(Coord);
+            Stats.x += abs(LoadLuminance(Coord + uint2(1u, 0u)) - L);
+            Stats.y += abs(LoadLuminance(Coord + uint2(0u, 1u)) - L);
+            Stats.z += L;
+#if USE_MOTION_VECTORS
+            float2 Motion = g_MotionVectors.Load(int3(Coord, 0)).xy * g_MotionVectorScale;
+            Stats.w = max(Stats.w, length(Motion));
+#endif
+            NumTexels += 1.0;
+        }
+    }
+    // Normalize the sums, so that every thread contributes in proportion to the number of its texels
+    float TotalTexels = float(min(g_TileSize, g_ColorSize.x - min(TileOrigin.x, g_ColorSize.x)) *
+                              min(g_TileSize, g_ColorSize.y - min(TileOrigin.y, g_ColorSize.y)));
+    Stats.xyz /= max(TotalTexels, 1.0);
+    g_Stats[GI] = Stats;
+    GroupMemoryBarrierWithGroupSync();
+
+    for (uint Stride = uint(GROUP_SIZE * GROUP_SIZE) / 2u; Stride > 0u; Stride >>= 1u)
+    {
+        if (GI < Stride)
+        {
+            float4 Other = g_Stats[GI + Stride];
+            g_Stats[GI]  = float4(g_Stats[GI].xyz + Other.xyz, max(g_Stats[GI].w, Other.w));
+        }
+        GroupMemoryBarrierWithGroupSync();
+    }
+
+    if (GI != 0u)
+        return;
+
+    float4 TileStats = g_Stats[0];
+    float  Threshold = g_ContrastThreshold * TileStats.z * (1.0 + g_MotionSensitivity * TileStats.w);
+
+    uint RateX = SelectAxisRate(TileStats.x, Threshold);
+    uint RateY = SelectAxisRate(TileStats.y, Threshold);
+
+#if OUTPUT_MODE == OUTPUT_PALETTE
+    uint Rate = g_RateRemap[RateX][RateY];
+    g_ShadingRate[Gid.xy] = Rate;
+#elif OUTPUT_MODE == OUTPUT_DENSITY
+    g_ShadingRate[Gid.xy] = float4(1.0 / float(1u << RateX), 1.0 / float(1u << RateY), 0.0, 0.0);
+#else
+    g_TileRates[Gid.y * g_NumTiles.x + Gid.x] = (RateX << 2u) | RateY;
+#endif
+}
+)";
+
+constexpr char ShadingRateColumnRowCS[] = R"(
+#ifndef GROUP_SIZE
+#   define GROUP_SIZE 64
+#endif
+
+cbuffer cbShadingRateAttribs
+{
+    uint2  g_ColorSize;
+    uint2  g_NumTiles;
+    float2 g_MotionVectorScale;
+    float  g_ContrastThreshold;
+    float  g_MotionSensitivity;
+    uint   g_TileSize;
+    uint   g_Padding0;
+    uint   g_Padding1;
+    uint   g_Padding2;
+    uint4  g_RateRemap[4];
+}
+
+StructuredBuffer<uint>  g_TileRates;
+RWStructuredBuffer<float> g_ColumnRowRates;
+
+[numthreads(GROUP_SIZE, 1, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    uint Idx = DTid.x;
+    if (Idx >= g_NumTiles.x + g_NumTiles.y)
+        return;
+
+    // Every column or row uses the finest rate of its tiles
+    uint Rate = 2u;
+    if (Idx < g_NumTiles.x)
+    {
+        for (uint y = 0u; y < g_NumTiles.y; ++y)
+            Rate = min(Rate, g_TileRates[y * g_NumTiles.x + Idx] >> 2u);
+    }
+    else
+    {
+        uint Row = Idx - g_NumTiles.x;
+        for (uint x = 0u; x < g_NumTiles.x; ++x)
+            Rate = min(Rate, g_TileRates[Row * g_NumTiles.x + x] & 3u);
+    }
+    g_ColumnRowRates[Idx] = 1.0 / float(1u << Rate);
+}
+)";
+
+struct ShadingRateAttribs
+{
+    Uint32 ColorWidth;
+    Uint32 ColorHeight;
+    Uint32 NumTilesX;
+    Uint32 NumTilesY;
+    float2 MotionVectorScale;
+    float  ContrastThreshold;
+    float  MotionSensitivity;
+    Uint32 TileSize;
+    Uint32 Padding0;
+    Uint32 Padding1;
+    Uint32 Padding2;
+    Uint32 RateRemap[4][4];
+};
+static_assert(sizeof(ShadingRateAttribs) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+RefCntAutoPtr<IPipelineState> CreateComputePSO(IRenderDevice*          pDevice,
+                                               const char*             Name,
+                                               const char*             Source,
+                                               const ShaderMacroArray& Macros,
+                                               IBuffer*                pConstants)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc           = {Name, SHADER_TYPE_COMPUTE, true};
+    ShaderCI.Source         = Source;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    if (!pCS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create shader '", Name, "'");
+        return {};
+    }
+
+    const ShaderResourceVariableDesc Vars[] = {
+        {SHADER_TYPE_COMPUTE, "cbShadingRateAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    };
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                               = Name;
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+    PSOCreateInfo.PSODesc.ResourceLayout.Variables           = Vars;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumVariables        = _countof(Vars);
+    PSOCreateInfo.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    if (!pPSO)
+    {
+        LOG_ERROR_MESSAGE("Failed to create pipeline state '", Name, "'");
+        return {};
+    }
+
+    if (IShaderResourceVariable* pVar = pPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbShadingRateAttribs"))
+        pVar->Set(pConstants);
+
+    return pPSO;
+}
+
+Uint32 SelectTileSize(IRenderDevice* pDevice, Uint32 TileSize)
+{
+    const ShadingRateProperties& SRProps = pDevice->GetAdapterInfo().ShadingRate;
+
+    TileSize = TileSize != 0 ? TileSize : DefaultTileSize;
+    // Tiles are square, so use the range that is supported along both axes
+    const Uint32 MinTileSize = std::max(SRProps.MinTileSize[0], SRProps.MinTileSize[1]);
+    const Uint32 MaxTileSize = std::min(SRProps.MaxTileSize[0] != 0 ? SRProps.MaxTileSize[0] : ~0u,
+                                        SRProps.MaxTileSize[1] != 0 ? SRProps.MaxTileSize[1] : ~0u);
+    if (MinTileSize != 0)
+        TileSize = std::max(TileSize, MinTileSize);
+    TileSize = std::min(TileSize, MaxTileSize);
+    return std::max(TileSize, 1u);
+}
+
+} // namespace
+
+ShadingRateGenerator::ShadingRateGenerator(IRenderDevice* pDevice, const ShadingRateGeneratorCreateInfo& CI) :
+    m_pDevice{pDevice},
+    m_Format{pDevice->GetAdapterInfo().ShadingRate.Format},
+    m_TileSize{SelectTileSize(pDevice, CI.TileSize)},
+    m_UseMotionVectors{CI.UseMotionVectors}
+{
+    DEV_CHECK_ERR(IsDeviceSupported(pDevice), "Shading rate generation requires compute shaders and variable rate shading");
+    CreatePipelines();
+}
+
+ShadingRateGenerator::~ShadingRateGenerator()
+{
+}
+
+bool ShadingRateGenerator::IsDeviceSupported(IRenderDevice* pDevice)
+{
+    const RenderDeviceInfo&      DeviceInfo = pDevice->GetDeviceInfo();
+    const ShadingRateProperties& SRProps    = pDevice->GetAdapterInfo().ShadingRate;
+    if (!DeviceInfo.Features.ComputeShaders || !DeviceInfo.Features.VariableRateShading)
+        return false;
+
+    switch (SRProps.Format)
+    {
+        case SHADING_RATE_FORMAT_PALETTE:
+        case SHADING_RATE_FORMAT_UNORM8:
+            return (SRProps.CapFlags & SHADING_RATE_CAP_FLAG_TEXTURE_BASED) != 0 &&
+                (SRProps.BindFlags & BIND_UNORDERED_ACCESS) != 0;
+
+        case SHADING_RATE_FORMAT_COL_ROW_FP32:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void ShadingRateGenerator::CreatePipelines()
+{
+    CreateUniformBuffer(m_pDevice, sizeof(ShadingRateAttribs), "Shading rate generator attribs", &m_pConstants);
+
+    {
+        ShaderMacroHelper Macros;
+        Macros.Add("GROUP_SIZE", static_cast<Int32>(TileGroupSize));
+        Macros.Add("USE_MOTION_VECTORS", m_UseMotionVectors);
+        switch (m_Format)
+        {
+            case SHADING_RATE_FORMAT_PALETTE: Macros.Add("OUTPUT_MODE", 0); break;
+            case SHADING_RATE_FORMAT_UNORM8: Macros.Add("OUTPUT_MODE", 1); break;
+            default: Macros.Add("OUTPUT_MODE", 2); break;
+        }
+        m_pTileRatesPSO = CreateComputePSO(m_pDevice, "Shading rate generator - tile rates", ShadingRateTileCS, Macros, m_pConstants);
+    }
+    if (m_Format == SHADING_RATE_FORMAT_COL_ROW_FP32)
+    {
+        ShaderMacroHelper Macros;
+        Macros.Add("GROUP_SIZE", static_cast<Int32>(ColumnRowGroupSize));
+        m_pColumnRowPSO = CreateComputePSO(m_pDevice, "Shading rate generator - column and row rates", ShadingRateColumnRowCS, Macros, m_pConstants);
+    }
+
+    if (m_pTileRatesPSO)
+        m_pTileRatesPSO->CreateShaderResourceBinding(&m_pTileRatesSRB, true);
+    if (m_pColumnRowPSO)
+        m_pColumnRowPSO->CreateShaderResourceBinding(&m_pColumnRowSRB, true);
+}
+
+void ShadingRateGenerator::PrepareOutputs(Uint32 Width, Uint32 Height)
+{
+    const Uint32 NumTilesX = (Width + m_TileSize - 1) / m_TileSize;
+    const Uint32 NumTilesY = (Height + m_TileSize - 1) / m_TileSize;
+    if (NumTilesX == m_NumTilesX && NumTilesY == m_NumTilesY)
+        return;
+
+    m_NumTilesX = NumTilesX;
+    m_NumTilesY = NumTilesY;
+
+    // The old resources may still be used by the GPU; the engine will release them once the commands complete
+    m_pShadingRateTex.Release();
+    m_pTileRates.Release();
+    m_pColumnRowRates.Release();
+
+    if (m_Format == SHADING_RATE_FORMAT_PALETTE || m_Format == SHADING_RATE_FORMAT_UNORM8)
+    {
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Shading rate texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = NumTilesX;
+        TexDesc.Height    = NumTilesY;
+        TexDesc.Format    = m_Format == SHADING_RATE_FORMAT_PALETTE ? TEX_FORMAT_R8_UINT : TEX_FORMAT_RG8_UNORM;
+        TexDesc.BindFlags = BIND_SHADING_RATE | BIND_UNORDERED_ACCESS;
+        TexDesc.Usage     = USAGE_DEFAULT;
+        m_pDevice->CreateTexture(TexDesc, nullptr, &m_pShadingRateTex);
+        if (m_pTileRatesSRB && m_pShadingRateTex)
+            m_pTileRatesSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_ShadingRate")->Set(m_pShadingRateTex->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS));
+    }
+    else
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Shading rate generator tile rates";
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        BuffDesc.BindFlags         = BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+        BuffDesc.Size              = Uint64{NumTilesX} * NumTilesY * sizeof(Uint32);
+        m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pTileRates);
+
+        BuffDesc.Name              = "Shading rate column and row rates";
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+        BuffDesc.ElementByteStride = sizeof(float);
+        BuffDesc.Size              = Uint64{NumTilesX + NumTilesY} * sizeof(float);
+        m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pColumnRowRates);
+
+        if (m_pTileRatesSRB && m_pTileRates)
+            m_pTileRatesSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_TileRates")->Set(m_pTileRates->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        if (m_pColumnRowSRB && m_pTileRates && m_pColumnRowRates)
+        {
+            m_pColumnRowSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_TileRates")->Set(m_pTileRates->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+            m_pColumnRowSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_ColumnRowRates")->Set(m_pColumnRowRates->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        }
+    }
+}
+
+bool ShadingRateGenerator::Generate(IDeviceContext* pCtx, const ShadingRateGenerationAttribs& Attribs)
+{
+    DEV_CHECK_ERR(pCtx != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(Attribs.pColorSRV != nullptr && Attribs.pColorSRV->GetDesc().ViewType == TEXTURE_VIEW_SHADER_RESOURCE,
+                  "Color shader resource view must not be null");
+    DEV_CHECK_ERR(!m_UseMotionVectors || Attribs.pMotionVectorsSRV != nullptr,
+                  "Motion vectors must not be null when UseMotionVectors is true");
+    if (!m_pTileRatesSRB || (m_Format == SHADING_RATE_FORMAT_COL_ROW_FP32 && !m_pColumnRowSRB))
+        return false;
+
+    const TextureDesc& ColorDesc = Attribs.pColorSRV->GetTexture()->GetDesc();
+
+    const Uint32 MipLevel = Attribs.pColorSRV->GetDesc().MostDetailedMip;
+    const Uint32 Width    = std::max(ColorDesc.Width >> MipLevel, 1u);
+    const Uint32 Height   = std::max(ColorDesc.Height >> MipLevel, 1u);
+
+    PrepareOutputs(Width, Height);
+    if (!m_pShadingRateTex && !m_pColumnRowRates)
+        return false;
+
+    {
+        MapHelper<ShadingRateAttribs> CBData{pCtx, m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+        CBData->ColorWidth        = Width;
+        CBData->ColorHeight       = Height;
+        CBData->NumTilesX         = m_NumTilesX;
+        CBData->NumTilesY         = m_NumTilesY;
+        CBData->MotionVectorScale = Attribs.MotionVectorScale;
+        CBData->ContrastThreshold = Attribs.ContrastThreshold;
+        CBData->MotionSensitivity = Attribs.MotionSensitivity;
+        CBData->TileSize          = m_TileSize;
+        CBData->Padding0          = 0;
+        CBData->Padding1          = 0;
+        CBData->Padding2          = 0;
+
+        // Replace the rates that the device does not support with the coarsest supported rate that
+        // does not exceed the selected rate along either axis. 1x1 is always supported.
+        const ShadingRateProperties& SRProps = m_pDevice->GetAdapterInfo().ShadingRate;
+        for (Uint32 RateX = 0; RateX < 4; ++RateX)
+        {
+            for (Uint32 RateY = 0; RateY < 4; ++RateY)
+            {
+                Uint32 BestRate = SHADING_RATE_1X1;
+                Uint32 BestArea = 0;
+                for (Uint32 i = 0; i < SRProps.NumShadingRates; ++i)
+                {
+                    const ShadingRateMode& Mode = SRProps.ShadingRates[i];
+
+                    const Uint32 ModeX = Mode.Rate >> SHADING_RATE_X_SHIFT;
+                    const Uint32 ModeY = Mode.Rate & ((1u << SHADING_RATE_X_SHIFT) - 1u);
+                    if ((Mode.SampleBits & SAMPLE_COUNT_1) == 0 || ModeX > RateX || ModeY > RateY)
+                        continue;
+                    if (ModeX + ModeY >= BestArea)
+                    {
+                        BestRate = Mode.Rate;
+                        BestArea = ModeX + ModeY;
+                    }
+                }
+                CBData->RateRemap[RateX][RateY] = BestRate;
+            }
+        }
+    }
+
+    m_pTileRatesSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Color")->Set(Attribs.pColorSRV);
+    if (m_UseMotionVectors)
+        m_pTileRatesSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_MotionVectors")->Set(Attribs.pMotionVectorsSRV);
+
+    pCtx->SetPipelineState(m_pTileRatesPSO);
+    pCtx->CommitShaderResources(m_pTileRatesSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->DispatchCompute({m_NumTilesX, m_NumTilesY});
+
+    if (m_Format == SHADING_RATE_FORMAT_COL_ROW_FP32)
+    {
+        pCtx->SetPipelineState(m_pColumnRowPSO);
+        pCtx->CommitShaderResources(m_pColumnRowSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->DispatchCompute({(m_NumTilesX + m_NumTilesY + ColumnRowGroupSize - 1) / ColumnRowGroupSize, 1});
+    }
+
+    return true;
+}
+
+} // namespace Diligent
@@ -0,0 +1,628 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SparseTextureStreamer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "GraphicsAccessories.hpp"
+#include "DebugUtilities.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// The number of tiles in one page of the tile memory
+constexpr Uint32 TilesPerMemoryPage = 64;
+
+ReadbackQueueCreateInfo GetFeedbackReadbackQueueCI(Uint32 NumFramesInFlight)
+{
+    ReadbackQueueCreateInfo CI;
+    CI.NumFramesInFlight = NumFramesInFlight;
+    return CI;
+}
+
+} // namespace
+
+SparseTextureStreamer::SparseTextureStreamer(IRenderDevice* pDevice, const SparseTextureStreamerCreateInfo& CI) :
+    // clang-format off
+    m_pDevice            {pDevice},
+    m_pTexture           {CI.pTexture},
+    m_pUploader          {CI.pUploader},
+    m_pBindContext       {CI.pBindContext},
+    m_MaxResidentTiles   {std::max(CI.MaxResidentTiles, 1u)},
+    m_MaxTilesPerUpdate  {std::max(CI.MaxTilesPerUpdate, 1u)},
+    m_TileRequestCallback{CI.TileRequestCallback},
+    m_FeedbackReadbacks  {pDevice, GetFeedbackReadbackQueueCI(CI.NumFramesInFlight)}
+// clang-format on
+{
+    const RENDER_DEVICE_TYPE DevType = pDevice->GetDeviceInfo().Type;
+    if (DevType != RENDER_DEVICE_TYPE_D3D12 && DevType != RENDER_DEVICE_TYPE_VULKAN)
+        LOG_ERROR_AND_THROW("Sparse texture streamer is only supported in Direct3D12 and Vulkan");
+
+    if (!m_pTexture)
+        LOG_ERROR_AND_THROW("Sparse texture must not be null");
+    if (!m_pUploader)
+        LOG_ERROR_AND_THROW("Texture uploader must not be null");
+    if (!m_TileRequestCallback)
+        LOG_ERROR_AND_THROW("Tile request callback must not be null");
+
+    const TextureDesc& TexDesc = m_pTexture->GetDesc();
+    if (TexDesc.Usage != USAGE_SPARSE)
+        LOG_ERROR_AND_THROW("Texture '", TexDesc.Name, "' is not a sparse texture");
+    if (TexDesc.Type != RESOURCE_DIM_TEX_2D && TexDesc.Type != RESOURCE_DIM_TEX_2D_ARRAY)
+        LOG_ERROR_AND_THROW("Texture '", TexDesc.Name, "' is not a 2D or 2D array texture");
+
+    m_SparseProps = m_pTexture->GetSparseProperties();
+    VERIFY_EXPR(m_SparseProps.BlockSize != 0 && m_SparseProps.TileSize[0] != 0 && m_SparseProps.TileSize[1] != 0);
+
+    const Uint32 NumStreamedMips = std::min(m_SparseProps.FirstMipInTail, TexDesc.MipLevels);
+    m_MipTiles.resize(NumStreamedMips);
+    for (Uint32 Mip = 0; Mip < NumStreamedMips; ++Mip)
+    {
+        const MipLevelProperties MipProps = GetMipLevelProperties(TexDesc, Mip);
+
+        MipTiles& Tiles = m_MipTiles[Mip];
+        Tiles.FirstTile = m_NumTilesPerSlice;
+        Tiles.NumTilesX = (MipProps.LogicalWidth + m_SparseProps.TileSize[0] - 1) / m_SparseProps.TileSize[0];
+        Tiles.NumTilesY = (MipProps.LogicalHeight + m_SparseProps.TileSize[1] - 1) / m_SparseProps.TileSize[1];
+        m_NumTilesPerSlice += Tiles.NumTilesX * Tiles.NumTilesY;
+    }
+    m_Tiles.resize(size_t{m_NumTilesPerSlice} * size_t{TexDesc.ArraySize});
+
+    if (!m_Tiles.empty())
+    {
+        const std::string Name = std::string{TexDesc.Name != nullptr ? TexDesc.Name : ""} + " - feedback";
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = Name.c_str();
+        BuffDesc.Size              = m_Tiles.size() * sizeof(Uint32);
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+        BuffDesc.Mode              = BUFFER_MODE_FORMATTED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+
+        m_ZeroFeedback.resize(m_Tiles.size());
+        BufferData InitData{m_ZeroFeedback.data(), BuffDesc.Size};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &m_pFeedbackBuffer);
+        if (!m_pFeedbackBuffer)
+            LOG_ERROR_AND_THROW("Failed to create the feedback buffer");
+
+        BufferViewDesc ViewDesc;
+        ViewDesc.ViewType             = BUFFER_VIEW_UNORDERED_ACCESS;
+        ViewDesc.Format.ValueType     = VT_UINT32;
+        ViewDesc.Format.NumComponents = 1;
+        m_pFeedbackBuffer->CreateView(ViewDesc, &m_pFeedbackBufferUAV);
+        if (!m_pFeedbackBufferUAV)
+            LOG_ERROR_AND_THROW("Failed to create the feedback buffer view");
+
+        DeviceMemoryCreateInfo MemCI;
+        MemCI.Desc.Name                 = "Sparse texture tile memory";
+        MemCI.Desc.Type                 = DEVICE_MEMORY_TYPE_SPARSE;
+        MemCI.Desc.PageSize             = Uint64{m_SparseProps.BlockSize} * TilesPerMemoryPage;
+        MemCI.Desc.ImmediateContextMask = TexDesc.ImmediateContextMask;
+        MemCI.InitialSize               = AlignUp(Uint64{m_MaxResidentTiles}, Uint64{TilesPerMemoryPage}) * m_SparseProps.BlockSize;
+
+        IDeviceObject* pCompatibleResource = m_pTexture;
+        MemCI.ppCompatibleResources        = &pCompatibleResource;
+        MemCI.NumResources                 = 1;
+        pDevice->CreateDeviceMemory(MemCI, &m_pTileMemory);
+        if (!m_pTileMemory)
+            LOG_ERROR_AND_THROW("Failed to create the tile memory");
+
+        // Slots are taken from the back
+        m_FreeSlots.resize(m_MaxResidentTiles);
+        for (Uint32 i = 0; i < m_MaxResidentTiles; ++i)
+            m_FreeSlots[i] = m_MaxResidentTiles - 1 - i;
+    }
+
+    if (NumStreamedMips < TexDesc.MipLevels && m_SparseProps.MipTailSize != 0)
+    {
+        const Uint32 NumMipTails = (m_SparseProps.Flags & SPARSE_TEXTURE_FLAG_SINGLE_MIPTAIL) != 0 ? 1 : TexDesc.ArraySize;
+
+        IDeviceObject*         pCompatibleResource = m_pTexture;
+        DeviceMemoryCreateInfo MemCI;
+        MemCI.Desc.Name                 = "Sparse texture mip tail memory";
+        MemCI.Desc.Type                 = DEVICE_MEMORY_TYPE_SPARSE;
+        MemCI.Desc.PageSize             = m_SparseProps.MipTailSize;
+        MemCI.Desc.ImmediateContextMask = TexDesc.ImmediateContextMask;
+        MemCI.InitialSize               = m_SparseProps.MipTailSize * NumMipTails;
+        MemCI.ppCompatibleResources     = &pCompatibleResource;
+        MemCI.NumResources              = 1;
+        pDevice->CreateDeviceMemory(MemCI, &m_pMipTailMemory);
+        if (!m_pMipTailMemory)
+            LOG_ERROR_AND_THROW("Failed to create the mip tail memory");
+    }
+
+    if (m_pBindContext)
+    {
+        FenceDesc Desc;
+        Desc.Name = "Sparse texture streamer bind fence";
+        Desc.Type = FENCE_TYPE_GENERAL;
+        pDevice->CreateFence(Desc, &m_pBindFence);
+        if (!m_pBindFence)
+            LOG_ERROR_AND_THROW("Failed to create the bind fence");
+    }
+}
+
+SparseTextureStreamer::~SparseTextureStreamer()
+{
+}
+
+Uint32 SparseTextureStreamer::GetTileIndex(const SparseTileLocation& Tile) const
+{
+    VERIFY_EXPR(Tile.MipLevel < m_MipTiles.size());
+    const MipTiles& Tiles = m_MipTiles[Tile.MipLevel];
+    VERIFY_EXPR(Tile.X < Tiles.NumTilesX && Tile.Y < Tiles.NumTilesY);
+    return Tile.ArraySlice * m_NumTilesPerSlice + Tiles.FirstTile + Tile.Y * Tiles.NumTilesX + Tile.X;
+}
+
+SparseTileLocation SparseTextureStreamer::GetTileLocation(Uint32 TileIndex) const
+{
+    VERIFY_EXPR(TileIndex < m_Tiles.size());
+
+    SparseTileLocation Tile;
+    Tile.ArraySlice = TileIndex / m_NumTilesPerSlice;
+    TileIndex -= Tile.ArraySlice * m_NumTilesPerSlice;
+
+    // Find the last mip level whose first tile is not greater than the index
+    auto MipIt = std::upper_bound(m_MipTiles.begin(), m_MipTiles.end(), TileIndex,
+                                  [](Uint32 Index, const MipTiles& Tiles) {
+                                      return Index < Tiles.FirstTile;
+                                  });
+    VERIFY_EXPR(MipIt != m_MipTiles.begin());
+    --MipIt;
+    Tile.MipLevel = static_cast<Uint32>(MipIt - m_MipTiles.begin());
+    TileIndex -= MipIt->FirstTile;
+    Tile.X = TileIndex % MipIt->NumTilesX;
+    Tile.Y = TileIndex / MipIt->NumTilesX;
+    return Tile;
+}
+
+Box SparseTextureStreamer::GetTileRegion(const SparseTileLocation& Tile) const
+{
+    const MipLevelProperties MipProps = GetMipLevelProperties(m_pTexture->GetDesc(), Tile.MipLevel);
+
+    Box Region;
+    Region.MinX = Tile.X * m_SparseProps.TileSize[0];
+    Region.MinY = Tile.Y * m_SparseProps.TileSize[1];
+    Region.MaxX = std::min(Region.MinX + m_SparseProps.TileSize[0], MipProps.LogicalWidth);
+    Region.MaxY = std::min(Region.MinY + m_SparseProps.TileSize[1], MipProps.LogicalHeight);
+    return Region;
+}
+
+void SparseTextureStreamer::GetTileDataLayout(const SparseTileLocation& Tile, Uint64& RowSize, Uint32& NumRows) const
+{
+    const Box Region = GetTileRegion(Tile);
+
+    TextureDesc TileDesc;
+    TileDesc.Type   = RESOURCE_DIM_TEX_2D;
+    TileDesc.Width  = Region.Width();
+    TileDesc.Height = Region.Height();
+    TileDesc.Format = m_pTexture->GetDesc().Format;
+
+    const MipLevelProperties    MipProps = GetMipLevelProperties(TileDesc, 0);
+    const TextureFormatAttribs& FmtAttr  = GetTextureFormatAttribs(TileDesc.Format);
+
+    RowSize = MipProps.RowSize;
+    NumRows = FmtAttr.ComponentType == COMPONENT_TYPE_COMPRESSED ?
+        MipProps.StorageHeight / FmtAttr.BlockHeight :
+        MipProps.StorageHeight;
+}
+
+bool SparseTextureStreamer::IsTileResident(const SparseTileLocation& Tile) const
+{
+    return m_Tiles[GetTileIndex(Tile)].State == TileState::Resident;
+}
+
+SparseTextureStreamer::Statistics SparseTextureStreamer::GetStatistics() const
+{
+    Statistics Stats;
+    Stats.NumResidentTiles = m_NumResidentTiles;
+    Stats.NumPendingTiles  = m_NumPendingTiles;
+    Stats.NumEvictedTiles  = m_NumEvictedTiles;
+    return Stats;
+}
+
+void SparseTextureStreamer::LRUPushFront(Uint32 TileIndex)
+{
+    TileInfo& Tile = m_Tiles[TileIndex];
+    VERIFY_EXPR(Tile.LRUPrev == InvalidIndex && Tile.LRUNext == InvalidIndex);
+
+    Tile.LRUNext = m_LRUHead;
+    if (m_LRUHead != InvalidIndex)
+        m_Tiles[m_LRUHead].LRUPrev = TileIndex;
+    else
+        m_LRUTail = TileIndex;
+    m_LRUHead = TileIndex;
+}
+
+void SparseTextureStreamer::LRURemove(Uint32 TileIndex)
+{
+    TileInfo& Tile = m_Tiles[TileIndex];
+
+    if (Tile.LRUPrev != InvalidIndex)
+        m_Tiles[Tile.LRUPrev].LRUNext = Tile.LRUNext;
+    else
+        m_LRUHead = Tile.LRUNext;
+
+    if (Tile.LRUNext != InvalidIndex)
+        m_Tiles[Tile.LRUNext].LRUPrev = Tile.LRUPrev;
+    else
+        m_LRUTail = Tile.LRUPrev;
+
+    Tile.LRUPrev = InvalidIndex;
+    Tile.LRUNext = InvalidIndex;
+}
+
+void SparseTextureStreamer::RequestTile(Uint32 TileIndex, Uint64 FeedbackFrame)
+{
+    SparseTileLocation Loc = GetTileLocation(TileIndex);
+    // Walk up the mip chain so that coarser tiles are available as a fallback
+    while (true)
+    {
+        const Uint32 Idx  = GetTileIndex(Loc);
+        TileInfo&    Tile = m_Tiles[Idx];
+        if (Tile.LastRequestFrame == FeedbackFrame)
+        {
+            // The tile and all its parents have already been processed
+            break;
+        }
+        Tile.LastRequestFrame = FeedbackFrame;
+
+        if (Tile.State == TileState::Resident)
+        {
+            LRURemove(Idx);
+            LRUPushFront(Idx);
+        }
+        else if (Tile.State == TileState::NonResident)
+        {
+            Tile.State = TileState::Requested;
+            m_RequestedTiles.push_back(Idx);
+        }
+
+        if (Loc.MipLevel + 1 >= m_MipTiles.size())
+            break;
+
+        ++Loc.MipLevel;
+        Loc.X = std::min(Loc.X / 2, m_MipTiles[Loc.MipLevel].NumTilesX - 1);
+        Loc.Y = std::min(Loc.Y / 2, m_MipTiles[Loc.MipLevel].NumTilesY - 1);
+    }
+}
+
+void SparseTextureStreamer::ProcessFeedback(const Uint32* pFeedback, size_t NumElements, Uint64 FeedbackFrame)
+{
+    VERIFY_EXPR(NumElements == m_Tiles.size());
+    m_LastFeedbackFrame = std::max(m_LastFeedbackFrame, FeedbackFrame);
+    for (size_t i = 0; i < NumElements; ++i)
+    {
+        if (pFeedback[i] != 0)
+            RequestTile(static_cast<Uint32>(i), FeedbackFrame);
+    }
+}
+
+void SparseTextureStreamer::RequestTileData()
+{
+    if (m_RequestedTiles.empty())
+        return;
+
+    // Request coarser mip levels first since they are used as a fallback for finer levels.
+    std::vector<std::pair<Uint32, Uint32>> SortedTiles; // (Mip, TileIndex)
+    SortedTiles.reserve(m_RequestedTiles.size());
+    for (Uint32 TileIndex : m_RequestedTiles)
+        SortedTiles.emplace_back(GetTileLocation(TileIndex).MipLevel, TileIndex);
+    std::sort(SortedTiles.begin(), SortedTiles.end(),
+              [](const std::pair<Uint32, Uint32>& T1, const std::pair<Uint32, Uint32>& T2) {
+                  return T1.first != T2.first ? T1.first > T2.first : T1.second < T2.second;
+              });
+
+    const size_t NumRequests = std::min(SortedTiles.size(), size_t{m_MaxTilesPerUpdate});
+    for (size_t i = 0; i < SortedTiles.size(); ++i)
+    {
+        TileInfo& Tile = m_Tiles[SortedTiles[i].second];
+        VERIFY_EXPR(Tile.State == TileState::Requested);
+        if (i < NumRequests)
+        {
+            Tile.State = TileState::Pending;
+            ++m_NumPendingTiles;
+            m_TileRequestCallback(GetTileLocation(SortedTiles[i].second));
+        }
+        else
+        {
+            // The remaining tiles will be requested again by the feedback if they are still needed
+            Tile.State = TileState::NonResident;
+        }
+    }
+    m_RequestedTiles.clear();
+}
+
+void SparseTextureStreamer::SubmitTileData(const SparseTileLocation& Tile, const void* pData, Uint64 Stride)
+{
+    SubmittedTile Submitted;
+    Submitted.TileIndex = GetTileIndex(Tile);
+    if (pData != nullptr)
+    {
+        Uint64 RowSize = 0;
+        Uint32 NumRows = 0;
+        GetTileDataLayout(Tile, RowSize, NumRows);
+        DEV_CHECK_ERR(Stride >= RowSize, "Stride (", Stride, ") is smaller than the tile row size (", RowSize, ")");
+
+        Submitted.Data.resize(static_cast<size_t>(RowSize * NumRows));
+        for (Uint32 Row = 0; Row < NumRows; ++Row)
+        {
+            memcpy(&Submitted.Data[static_cast<size_t>(RowSize * Row)],
+                   static_cast<const Uint8*>(pData) + Stride * Row,
+                   static_cast<size_t>(RowSize));
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock{m_SubmittedTilesMtx};
+    m_SubmittedTiles.emplace_back(std::move(Submitted));
+}
+
+Uint32 SparseTextureStreamer::AllocateSlot(std::vector<SparseTextureMemoryBindRange>& Ranges)
+{
+    if (!m_FreeSlots.empty())
+    {
+        const Uint32 Slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+        return Slot;
+    }
+
+    // Evict the least recently requested tile unless it is used by the latest feedback
+    if (m_LRUTail == InvalidIndex)
+        return InvalidIndex;
+
+    const Uint32 EvictedIndex = m_LRUTail;
+    TileInfo&    Evicted      = m_Tiles[EvictedIndex];
+    VERIFY_EXPR(Evicted.State == TileState::Resident);
+    if (Evicted.LastRequestFrame >= m_LastFeedbackFrame)
+        return InvalidIndex;
+
+    const SparseTileLocation Loc = GetTileLocation(EvictedIndex);
+
+    SparseTextureMemoryBindRange Range;
+    Range.MipLevel     = Loc.MipLevel;
+    Range.ArraySlice   = Loc.ArraySlice;
+    Range.Region       = GetTileRegion(Loc);
+    Range.MemorySize   = m_SparseProps.BlockSize;
+    Range.MemoryOffset = 0;
+    Range.pMemory      = nullptr;
+    Ranges.push_back(Range);
+
+    LRURemove(EvictedIndex);
+    const Uint32 Slot = Evicted.Slot;
+    Evicted.Slot      = InvalidIndex;
+    Evicted.State     = TileState::NonResident;
+    --m_NumResidentTiles;
+    ++m_NumEvictedTiles;
+
+    return Slot;
+}
+
+void SparseTextureStreamer::BindMemory(IDeviceContext* pContext, const std::vector<SparseTextureMemoryBindRange>& Ranges)
+{
+    if (Ranges.empty())
+        return;
+
+    SparseTextureMemoryBindInfo TexBind;
+    TexBind.pTexture  = m_pTexture;
+    TexBind.pRanges   = Ranges.data();
+    TexBind.NumRanges = static_cast<Uint32>(Ranges.size());
+
+    BindSparseResourceMemoryAttribs BindAttribs;
+    BindAttribs.pTextureBinds   = &TexBind;
+    BindAttribs.NumTextureBinds = 1;
+
+    if (m_pBindContext)
+    {
+        // The update context must not use the tiles until the memory is bound
+        IFence*      pFence     = m_pBindFence;
+        const Uint64 FenceValue = m_NextBindFenceValue++;
+
+        BindAttribs.ppSignalFences     = &pFence;
+        BindAttribs.pSignalFenceValues = &FenceValue;
+        BindAttribs.NumSignalFences    = 1;
+        m_pBindContext->BindSparseResourceMemory(BindAttribs);
+        m_pBindContext->Flush();
+        pContext->DeviceWaitForFence(m_pBindFence, FenceValue);
+    }
+    else
+    {
+        pContext->BindSparseResourceMemory(BindAttribs);
+    }
+}
+
+void SparseTextureStreamer::BindMipTail(IDeviceContext* pContext)
+{
+    if (!m_pMipTailMemory)
+        return;
+
+    const TextureDesc& TexDesc = m_pTexture->GetDesc();
+
+    std::vector<SparseTextureMemoryBindRange> Ranges;
+
+    Uint64 MemOffset = 0;
+    for (Uint32 Slice = 0; Slice < TexDesc.ArraySize; ++Slice)
+    {
+        if (Slice > 0 && (m_SparseProps.Flags & SPARSE_TEXTURE_FLAG_SINGLE_MIPTAIL) != 0)
+            break;
+
+        for (Uint64 OffsetInMipTail = 0; OffsetInMipTail < m_SparseProps.MipTailSize; OffsetInMipTail += m_SparseProps.BlockSize)
+        {
+            SparseTextureMemoryBindRange Range;
+            Range.MipLevel        = m_SparseProps.FirstMipInTail;
+            Range.ArraySlice      = Slice;
+            Range.OffsetInMipTail = OffsetInMipTail;
+            Range.MemoryOffset    = MemOffset;
+            Range.MemorySize      = m_SparseProps.BlockSize;
+            Range.pMemory         = m_pMipTailMemory;
+            Ranges.push_back(Range);
+            MemOffset += Range.MemorySize;
+        }
+    }
+    VERIFY_EXPR(MemOffset <= m_pMipTailMemory->GetCapacity());
+
+    BindMemory(pContext, Ranges);
+}
+
+void SparseTextureStreamer::UploadSubmittedTiles(IDeviceContext* pContext)
+{
+    std::vector<SubmittedTile> Submitted;
+    {
+        std::lock_guard<std::mutex> Lock{m_SubmittedTilesMtx};
+        if (m_SubmittedTiles.size() <= m_MaxTilesPerUpdate)
+        {
+            Submitted.swap(m_SubmittedTiles);
+        }
+        else
+        {
+            Submitted.reserve(m_MaxTilesPerUpdate);
+            std::move(m_SubmittedTiles.begin(), m_SubmittedTiles.begin() + m_MaxTilesPerUpdate, std::back_inserter(Submitted));
+            m_SubmittedTiles.erase(m_SubmittedTiles.begin(), m_SubmittedTiles.begin() + m_MaxTilesPerUpdate);
+        }
+    }
+    if (Submitted.empty())
+        return;
+
+    std::vector<SparseTextureMemoryBindRange> Ranges;
+    std::vector<const SubmittedTile*>         Uploads;
+    for (const SubmittedTile& SubmTile : Submitted)
+    {
+        TileInfo& Tile = m_Tiles[SubmTile.TileIndex];
+        if (Tile.State != TileState::Pending)
+        {
+            UNEXPECTED("Tile data has been submitted for a tile that was not requested");
+            continue;
+        }
+        --m_NumPendingTiles;
+
+        Tile.State = TileState::NonResident;
+        if (SubmTile.Data.empty())
+            continue; // The request has been canceled
+
+        const Uint32 Slot = AllocateSlot(Ranges);
+        if (Slot == InvalidIndex)
+        {
+            // All resident tiles are used by the latest frame. The tile will be requested
+            // again when the memory becomes available.
+            continue;
+        }
+
+        Tile.State = TileState::Resident;
+        Tile.Slot  = Slot;
+        // Treat the upload as a use so that the tile is not evicted by the next tiles in this batch
+        Tile.LastRequestFrame = std::max(Tile.LastRequestFrame, m_LastFeedbackFrame);
+        LRUPushFront(SubmTile.TileIndex);
+        ++m_NumResidentTiles;
+
+        const SparseTileLocation Loc = GetTileLocation(SubmTile.TileIndex);
+
+        SparseTextureMemoryBindRange Range;
+        Range.MipLevel     = Loc.MipLevel;
+        Range.ArraySlice   = Loc.ArraySlice;
+        Range.Region       = GetTileRegion(Loc);
+        Range.MemorySize   = m_SparseProps.BlockSize;
+        Range.MemoryOffset = Uint64{Slot} * m_SparseProps.BlockSize;
+        Range.pMemory      = m_pTileMemory;
+        Ranges.push_back(Range);
+
+        Uploads.push_back(&SubmTile);
+    }
+
+    BindMemory(pContext, Ranges);
+
+    const TextureDesc& TexDesc = m_pTexture->GetDesc();
+    for (const SubmittedTile* pSubmTile : Uploads)
+    {
+        const SparseTileLocation Loc    = GetTileLocation(pSubmTile->TileIndex);
+        const Box                Region = GetTileRegion(Loc);
+
+        UploadBufferDesc UploadDesc;
+        UploadDesc.Width  = Region.Width();
+        UploadDesc.Height = Region.Height();
+        UploadDesc.Format = TexDesc.Format;
+
+        RefCntAutoPtr<IUploadBuffer> pUploadBuffer;
+        m_pUploader->AllocateUploadBuffer(pContext, UploadDesc, &pUploadBuffer);
+        if (!pUploadBuffer)
+        {
+            UNEXPECTED("Failed to allocate the upload buffer");
+            continue;
+        }
+
+        Uint64 RowSize = 0;
+        Uint32 NumRows = 0;
+        GetTileDataLayout(Loc, RowSize, NumRows);
+
+        const MappedTextureSubresource MappedData = pUploadBuffer->GetMappedData(0, 0);
+        for (Uint32 Row = 0; Row < NumRows; ++Row)
+        {
+            memcpy(static_cast<Uint8*>(MappedData.pData) + MappedData.Stride * Row,
+                   &pSubmTile->Data[static_cast<size_t>(RowSize * Row)],
+                   static_cast<size_t>(RowSize));
+        }
+
+        m_pUploader->ScheduleGPUCopyToRegion(pContext, m_pTexture, Loc.ArraySlice, Loc.MipLevel, Region.MinX, Region.MinY, pUploadBuffer);
+        m_pUploader->RecycleBuffer(pUploadBuffer);
+    }
+}
+
+void SparseTextureStreamer::Update(IDeviceContext* pContext)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+
+    if (!m_MipTailBound)
+    {
+        BindMipTail(pContext);
+        m_MipTailBound = true;
+    }
+
+    if (m_Tiles.empty())
+        return;
+
+    // Process the feedback from the previous frames
+    m_FeedbackReadbacks.Poll(pContext);
+
+    RequestTileData();
+    UploadSubmittedTiles(pContext);
+
+    // Read back the feedback written since the last update and clear it
+    const Uint64 FeedbackFrame = m_FrameIndex++;
+    const Uint64 FeedbackSize  = m_pFeedbackBuffer->GetDesc().Size;
+    m_FeedbackReadbacks.ReadBuffer(pContext, m_pFeedbackBuffer, 0, FeedbackSize,
+                                   [this, FeedbackFrame](const ReadbackQueue::ReadbackData& Data) {
+                                       if (Data.pData != nullptr)
+                                           ProcessFeedback(static_cast<const Uint32*>(Data.pData), static_cast<size_t>(Data.DataSize / sizeof(Uint32)), FeedbackFrame);
+                                   });
+    pContext->UpdateBuffer(m_pFeedbackBuffer, 0, FeedbackSize, m_ZeroFeedback.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+}
+
+} // namespace Diligent
@@ -0,0 +1,570 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureCompressor.hpp"
+
+#include <algorithm>
+
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Every thread encodes one 4x4 block
+constexpr Uint32 CompressorGroupSize = 8;
+
+constexpr char TextureCompressorCS[] = R"(
+#define FORMAT_BC1 1
+#define FORMAT_BC3 3
+#define FORMAT_BC4 4
+#define FORMAT_BC5 5
+#define FORMAT_BC7 7
+
+#ifndef GROUP_SIZE
+#   define GROUP_SIZE 8
+#endif
+
+cbuffer cbTextureCompressorAttribs
+{
+    uint2 g_SrcOffset;
+    uint2 g_SrcSize;
+    uint2 g_NumBlocks;
+    uint  g_DstRowStride;
+    uint  g_Padding;
+}
+
+Texture2D<float4> g_Source;
+
+#if COMPRESS_FORMAT == FORMAT_BC1 || COMPRESS_FORMAT == FORMAT_BC4
+RWStructuredBuffer<uint2> g_Blocks;
+#else
+RWStructuredBuffer<uint4> g_Blocks;
+#endif
+
+float3 LinearToSRGB(float3 Linear)
+{
+    float3 Lo = Linear * 12.92;
+    float3 Hi = 1.055 * pow(Linear, float3(1.0 / 2.4, 1.0 / 2.4, 1.0 / 2.4)) - 0.055;
+    return lerp(Hi, Lo, step(Linear, float3(0.0031308, 0.0031308, 0.0031308)));
+}
+
+float4 LoadTexel(uint2 BlockCoord, uint i)
+{
+    // Partial blocks at the region edge replicate the last row and column
+    uint2 Coord = min(BlockCoord * 4u + uint2(i & 3u, i >> 2u), g_SrcSize - uint2(1u, 1u));
+    float4 Color = saturate(g_Source.Load(int3(g_SrcOffset + Coord, 0)));
+#if COMPRESS_SRGB
+    Color.rgb = LinearToSRGB(Color.rgb);
+#endif
+    return Color;
+}
+
+void WriteBits(inout uint4 Block, inout uint Offset, uint Value, uint NumBits)
+{
+    uint Word = Offset >> 5u;
+    uint Bit  = Offset & 31u;
+    Block[Word] |= Value << Bit;
+    if (Bit + NumBits > 32u)
+        Block[Word + 1u] |= Value >> (32u - Bit);
+    Offset += NumBits;
+}
+
+// Finds the endpoints of the line that best fits the texels using the principal axis
+void FindEndpoints(float4 Texels[16], out float4 Endpoint0, out float4 Endpoint1)
+{
+    float4 Mean   = float4(0.0, 0.0, 0.0, 0.0);
+    float4 MinVal = float4(1.0, 1.0, 1.0, 1.0);
+    float4 MaxVal = float4(0.0, 0.0, 0.0, 0.0);
+    for (uint i = 0u; i < 16u; ++i)
+    {
+        Mean  += Texels[i];
+        MinVal = min(MinVal, Texels[i]);
+        MaxVal = max(MaxVal, Texels[i]);
+    }
+    Mean /= 16.0;
+
+    float4 Cov0 = float4(0.0, 0.0, 0.0, 0.0);
+    float4 Cov1 = float4(0.0, 0.0, 0.0, 0.0);
+    float4 Cov2 = float4(0.0, 0.0, 0.0, 0.0);
+    float4 Cov3 = float4(0.0, 0.0, 0.0, 0.0);
+    for (uint j = 0u; j < 16u; ++j)
+    {
+        float4 d = Texels[j] - Mean;
+        Cov0 += d * d.x;
+        Cov1 += d * d.y;
+        Cov2 += d * d.z;
+        Cov3 += d * d.w;
+    }
+
+    // Power iteration starting from the bounding box diagonal
+    float4 Axis = MaxVal - MinVal;
+    for (uint k = 0u; k < 4u; ++k)
+    {
+        float4 NewAxis = float4(dot(Cov0, Axis), dot(Cov1, Axis), dot(Cov2, Axis), dot(Cov3, Axis));
+        float  Len     = length(NewAxis);
+        if (Len < 1e-8)
+            break;
+        Axis = NewAxis / Len;
+    }
+
+    float AxisLenSq = dot(Axis, Axis);
+    if (AxisLenSq < 1e-8)
+    {
+        // All texels are the same
+        Endpoint0 = Mean;
+        Endpoint1 = Mean;
+        return;
+    }
+    Axis /= sqrt(AxisLenSq);
+
+    float MinT = 0.0;
+    float MaxT = 0.0;
+    for (uint l = 0u; l < 16u; ++l)
+    {
+        float t = dot(Texels[l] - Mean, Axis);
+        MinT = min(MinT, t);
+        MaxT = max(MaxT, t);
+    }
+    Endpoint0 = saturate(Mean + Axis * MinT);
+    Endpoint1 = saturate(Mean + Axis * MaxT);
+}
+
+uint PackRGB565(float3 Color)
+{
+    uint3 q = uint3(round(saturate(Color) * float3(31.0, 63.0, 31.0)));
+    return (q.r << 11u) | (q.g << 5u) | q.b;
+}
+
+float3 UnpackRGB565(uint Color)
+{
+    return float3(float((Color >> 11u) & 31u) / 31.0,
+                  float((Color >> 5u) & 63u) / 63.0,
+                  float(Color & 31u) / 31.0);
+}
+
+// Encodes the color block of BC1 and BC3 in the four-color mode. The alpha of the texels must be zero.
+uint2 EncodeColorBlock(float4 Texels[16])
+{
+    float4 Endpoint0;
+    float4 Endpoint1;
+    FindEndpoints(Texels, Endpoint0, Endpoint1);
+
+    uint Color0 = PackRGB565(Endpoint0.rgb);
+    uint Color1 = PackRGB565(Endpoint1.rgb);
+    // Color0 > Color1 selects the four-color mode
+    if (Color0 < Color1)
+    {
+        uint Tmp = Color0;
+        Color0   = Color1;
+        Color1   = Tmp;
+    }
+
+    uint Indices = 0u;
+    if (Color0 != Color1)
+    {
+        float3 C0    = UnpackRGB565(Color0);
+        float3 Dir   = UnpackRGB565(Color1) - C0;
+        float  Scale = 3.0 / dot(Dir, Dir);
+        for (uint i = 0u; i < 16u; ++i)
+        {
+            // Palette order: Color0, Color1, 2/3 Color0 + 1/3 Color1, 1/3 Color0 + 2/3 Color1
+            uint t     = uint(clamp(round(dot(Texels[i].rgb - C0, Dir) * Scale), 0.0, 3.0));
+            uint Index = t == 0u ? 0u : (t == 3u ? 1u : t + 1u);
+            Indices |= Index << (2u * i);
+        }
+    }
+    return uint2(Color0 | (Color1 << 16u), Indices);
+}
+
+// Encodes a single-channel block of BC3, BC4 and BC5 in the eight-value mode
+uint2 EncodeChannelBlock(float Values[16])
+{
+    float MinVal = 1.0;
+    float MaxVal = 0.0;
+    for (uint i = 0u; i < 16u; ++i)
+    {
+        MinVal = min(MinVal, Values[i]);
+        MaxVal = max(MaxVal, Values[i]);
+    }
+
+    uint Value0 = uint(round(MaxVal * 255.0));
+    uint Value1 = uint(round(MinVal * 255.0));
+
+    uint4 Block  = uint4(Value0 | (Value1 << 8u), 0u, 0u, 0u);
+    uint  Offset = 16u;
+    if (Value0 > Value1)
+    {
+        float Scale = 7.0 / (float(Value0) - float(Value1));
+        for (uint j = 0u; j < 16u; ++j)
+        {
+            // Palette order: Value0, Value1, then six values from Value0 to Value1
+            uint t     = uint(clamp(round((float(Value0) - Values[j] * 255.0) * Scale), 0.0, 7.0));
+            uint Index = t == 0u ? 0u : (t == 7u ? 1u : t + 1u);
+            WriteBits(Block, Offset, Index, 3u);
+        }
+    }
+    return Block.xy;
+}
+
+// Quantizes the endpoint to 7 bits per channel and selects the p-bit that minimizes the error
+uint4 QuantizeBC7Endpoint(float4 Endpoint, out uint PBit)
+{
+    float4 Value = Endpoint * 255.0;
+
+    uint4  q0   = uint4(clamp(round(Value * 0.5), 0.0, 127.0));
+    uint4  q1   = uint4(clamp(round((Value - 1.0) * 0.5), 0.0, 127.0));
+    float4 Err0 = float4(q0 * 2u) - Value;
+    float4 Err1 = float4(q1 * 2u + 1u) - Value;
+
+    bool UseP1 = dot(Err1, Err1) < dot(Err0, Err0);
+    PBit       = UseP1 ? 1u : 0u;
+    return UseP1 ? q1 : q0;
+}
+
+// Encodes the block in BC7 mode 6
+uint4 EncodeBC7Block(float4 Texels[16])
+{
+    float4 Endpoint0;
+    float4 Endpoint1;
+    FindEndpoints(Texels, Endpoint0, Endpoint1);
+
+    uint  PBit0;
+    uint  PBit1;
+    uint4 q0 = QuantizeBC7Endpoint(Endpoint0, PBit0);
+    uint4 q1 = QuantizeBC7Endpoint(Endpoint1, PBit1);
+
+    float4 E0  = float4(q0 * 2u + PBit0) / 255.0;
+    float4 E1  = float4(q1 * 2u + PBit1) / 255.0;
+    float4 Dir = E1 - E0;
+
+    float DirLenSq = dot(Dir, Dir);
+    float Scale    = DirLenSq > 0.0 ? 15.0 / DirLenSq : 0.0;
+
+    uint Indices[16];
+    for (uint i = 0u; i < 16u; ++i)
+    {
+        Indices[i] = uint(clamp(round(dot(Texels[i] - E0, Dir) * Scale), 0.0, 15.0));
+    }
+
+    // The most significant bit of the anchor index is implicitly zero
+    if (Indices[0] >= 8u)
+    {
+        uint4 Tmp   = q0;
+        q0          = q1;
+        q1          = Tmp;
+        uint TmpBit = PBit0;
+        PBit0       = PBit1;
+        PBit1       = TmpBit;
+        for (uint j = 0u; j < 16u; ++j)
+            Indices[j] = 15u - Indices[j];
+    }
+
+    uint4 Block  = uint4(0u, 0u, 0u, 0u);
+    uint  Offset = 0u;
+    WriteBits(Block, Offset, 1u << 6u, 7u); // Mode 6
+    for (uint c = 0u; c < 4u; ++c)
+    {
+        WriteBits(Block, Offset, q0[c], 7u);
+        WriteBits(Block, Offset, q1[c], 7u);
+    }
+    WriteBits(Block, Offset, PBit0, 1u);
+    WriteBits(Block, Offset, PBit1, 1u);
+    WriteBits(Block, Offset, Indices[0], 3u);
+    for (uint k = 1u; k < 16u; ++k)
+        WriteBits(Block, Offset, Indices[k], 4u);
+
+    return Block;
+}
+
+[numthreads(GROUP_SIZE, GROUP_SIZE, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    if (DTid.x >= g_NumBlocks.x || DTid.y >= g_NumBlocks.y)
+        return;
+
+    float4 Texels[16];
+    for (uint i = 0u; i < 16u; ++i)
+        Texels[i] = LoadTexel(DTid.xy, i);
+
+    uint DstIdx = DTid.y * g_DstRowStride + DTid.x;
+
+#if COMPRESS_FORMAT == FORMAT_BC1 || COMPRESS_FORMAT == FORMAT_BC3
+    float4 Colors[16];
+    for (uint j = 0u; j < 16u; ++j)
+        Colors[j] = float4(Texels[j].rgb, 0.0);
+#   if COMPRESS_FORMAT == FORMAT_BC1
+    g_Blocks[DstIdx] = EncodeColorBlock(Colors);
+#   else
+    float Alpha[16];
+    for (uint k = 0u; k < 16u; ++k)
+        Alpha[k] = Texels[k].a;
+    g_Blocks[DstIdx] = uint4(EncodeChannelBlock(Alpha), EncodeColorBlock(Colors));
+#   endif
+#elif COMPRESS_FORMAT == FORMAT_BC4 || COMPRESS_FORMAT == FORMAT_BC5
+    float Red[16];
+    float Green[16];
+    for (uint j = 0u; j < 16u; ++j)
+    {
+        Red[j]   = Texels[j].r;
+        Green[j] = Texels[j].g;
+    }
+#   if COMPRESS_FORMAT == FORMAT_BC4
+    g_Blocks[DstIdx] = EncodeChannelBlock(Red);
+#   else
+    g_Blocks[DstIdx] = uint4(EncodeChannelBlock(Red), EncodeChannelBlock(Green));
+#   endif
+#elif COMPRESS_FORMAT == FORMAT_BC7
+    g_Blocks[DstIdx] = EncodeBC7Block(Texels);
+#endif
+}
+)";
+
+struct TextureCompressorConstants
+{
+    Uint32 SrcOffsetX;
+    Uint32 SrcOffsetY;
+    Uint32 SrcWidth;
+    Uint32 SrcHeight;
+    Uint32 NumBlocksX;
+    Uint32 NumBlocksY;
+    Uint32 DstRowStride;
+    Uint32 Padding;
+};
+static_assert(sizeof(TextureCompressorConstants) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+struct EncoderInfo
+{
+    Uint32 PipelineIdx = ~0u;
+    Int32  Format      = 0;
+    bool   SRGB        = false;
+    Uint32 BlockSize   = 0;
+};
+
+EncoderInfo GetEncoderInfo(TEXTURE_FORMAT Format)
+{
+    // clang-format off
+    switch (Format)
+    {
+        case TEX_FORMAT_BC1_UNORM:      return {0, 1, false,  8};
+        case TEX_FORMAT_BC1_UNORM_SRGB: return {1, 1, true,   8};
+        case TEX_FORMAT_BC3_UNORM:      return {2, 3, false, 16};
+        case TEX_FORMAT_BC3_UNORM_SRGB: return {3, 3, true,  16};
+        case TEX_FORMAT_BC4_UNORM:      return {4, 4, false,  8};
+        case TEX_FORMAT_BC5_UNORM:      return {5, 5, false, 16};
+        case TEX_FORMAT_BC7_UNORM:      return {6, 7, false, 16};
+        case TEX_FORMAT_BC7_UNORM_SRGB: return {7, 7, true,  16};
+        default:                        return {};
+    }
+    // clang-format on
+}
+
+} // namespace
+
+TextureCompressor::TextureCompressor(IRenderDevice* pDevice) :
+    m_pDevice{pDevice},
+    // Direct3D12 and WebGPU require the row pitch of the buffer-to-texture copy to be 256-byte aligned,
+    // while OpenGL requires tightly packed rows.
+    m_RowStrideAlignment{pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_D3D12 || pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_WEBGPU ? 256u : 1u}
+{
+    DEV_CHECK_ERR(IsDeviceSupported(pDevice), "Texture compressor requires compute shaders and buffer-to-texture copies");
+    CreateUniformBuffer(m_pDevice, sizeof(TextureCompressorConstants), "Texture compressor attribs", &m_pConstants);
+}
+
+TextureCompressor::~TextureCompressor()
+{
+}
+
+bool TextureCompressor::IsDeviceSupported(IRenderDevice* pDevice)
+{
+    const RenderDeviceInfo& DeviceInfo = pDevice->GetDeviceInfo();
+    return DeviceInfo.Features.ComputeShaders && DeviceInfo.Type != RENDER_DEVICE_TYPE_D3D11;
+}
+
+bool TextureCompressor::IsFormatSupported(TEXTURE_FORMAT Format)
+{
+    return GetEncoderInfo(Format).PipelineIdx != ~0u;
+}
+
+TextureCompressor::EncoderPipeline* TextureCompressor::GetPipeline(TEXTURE_FORMAT Format)
+{
+    const EncoderInfo Info     = GetEncoderInfo(Format);
+    EncoderPipeline&  Pipeline = m_Pipelines[Info.PipelineIdx];
+    if (Pipeline.pSRB)
+        return &Pipeline;
+
+    ShaderMacroHelper Macros;
+    Macros.Add("GROUP_SIZE", static_cast<Int32>(CompressorGroupSize));
+    Macros.Add("COMPRESS_FORMAT", Info.Format);
+    Macros.Add("COMPRESS_SRGB", Info.SRGB);
+
+    const std::string Name = std::string{"Texture compressor - "} + GetTextureFormatAttribs(Format).Name;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc           = {Name.c_str(), SHADER_TYPE_COMPUTE, true};
+    ShaderCI.Source         = TextureCompressorCS;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pCS;
+    m_pDevice->CreateShader(ShaderCI, &pCS);
+    if (!pCS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create shader '", Name, "'");
+        return nullptr;
+    }
+
+    const ShaderResourceVariableDesc Vars[] = {
+        {SHADER_TYPE_COMPUTE, "cbTextureCompressorAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    };
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                               = Name.c_str();
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+    PSOCreateInfo.PSODesc.ResourceLayout.Variables           = Vars;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumVariables        = _countof(Vars);
+    PSOCreateInfo.pCS                                        = pCS;
+
+    m_pDevice->CreateComputePipelineState(PSOCreateInfo, &Pipeline.pPSO);
+    if (!Pipeline.pPSO)
+    {
+        LOG_ERROR_MESSAGE("Failed to create pipeline state '", Name, "'");
+        return nullptr;
+    }
+
+    Pipeline.pPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbTextureCompressorAttribs")->Set(m_pConstants);
+    Pipeline.pPSO->CreateShaderResourceBinding(&Pipeline.pSRB, true);
+
+    return &Pipeline;
+}
+
+bool TextureCompressor::Compress(IDeviceContext* pCtx, const TextureCompressAttribs& Attribs)
+{
+    DEV_CHECK_ERR(pCtx != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(Attribs.pSrcSRV != nullptr && Attribs.pSrcSRV->GetDesc().ViewType == TEXTURE_VIEW_SHADER_RESOURCE,
+                  "Source texture shader resource view must not be null");
+    DEV_CHECK_ERR(Attribs.pDstTexture != nullptr, "Destination texture must not be null");
+
+    if (!IsDeviceSupported(m_pDevice))
+    {
+        LOG_ERROR_MESSAGE("Texture compression is not supported by this device");
+        return false;
+    }
+
+    const TextureDesc& DstDesc = Attribs.pDstTexture->GetDesc();
+    if (!IsFormatSupported(DstDesc.Format))
+    {
+        LOG_ERROR_MESSAGE("Texture compressor does not support format ", GetTextureFormatAttribs(DstDesc.Format).Name,
+                          " of texture '", DstDesc.Name, "'");
+        return false;
+    }
+
+    const MipLevelProperties DstMipProps = GetMipLevelProperties(DstDesc, Attribs.DstMipLevel);
+    DEV_CHECK_ERR(Attribs.DstX % 4 == 0 && Attribs.DstY % 4 == 0, "Destination region offset must be a multiple of 4");
+    DEV_CHECK_ERR(Attribs.DstX < DstMipProps.LogicalWidth && Attribs.DstY < DstMipProps.LogicalHeight,
+                  "Destination region offset is out of the mip level bounds");
+
+    const Uint32 Width  = Attribs.Width != 0 ? Attribs.Width : DstMipProps.LogicalWidth - Attribs.DstX;
+    const Uint32 Height = Attribs.Height != 0 ? Attribs.Height : DstMipProps.LogicalHeight - Attribs.DstY;
+    DEV_CHECK_ERR(Attribs.DstX + Width <= DstMipProps.LogicalWidth && Attribs.DstY + Height <= DstMipProps.LogicalHeight,
+                  "Destination region is out of the mip level bounds");
+    DEV_CHECK_ERR((Width % 4 == 0 || Attribs.DstX + Width == DstMipProps.LogicalWidth) &&
+                      (Height % 4 == 0 || Attribs.DstY + Height == DstMipProps.LogicalHeight),
+                  "Destination region size must be a multiple of 4 unless the region extends to the edge of the mip level");
+
+    EncoderPipeline* pPipeline = GetPipeline(DstDesc.Format);
+    if (pPipeline == nullptr)
+        return false;
+
+    const EncoderInfo Info           = GetEncoderInfo(DstDesc.Format);
+    const Uint32      NumBlocksX     = AlignUp(Width, 4u) / 4;
+    const Uint32      NumBlocksY     = AlignUp(Height, 4u) / 4;
+    const Uint32      RowStride      = AlignUp(NumBlocksX * Info.BlockSize, m_RowStrideAlignment);
+    const Uint32      BlockBufferIdx = Info.BlockSize == 8 ? 0 : 1;
+
+    RefCntAutoPtr<IBuffer>& pBlocks = m_pBlockBuffers[BlockBufferIdx];
+    if (!pBlocks || pBlocks->GetDesc().Size < Uint64{RowStride} * NumBlocksY)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Texture compressor blocks";
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = Info.BlockSize;
+        BuffDesc.Size              = Uint64{RowStride} * NumBlocksY;
+
+        // The old buffer may still be used by the GPU; the engine will release it once the commands complete
+        pBlocks.Release();
+        m_pDevice->CreateBuffer(BuffDesc, nullptr, &pBlocks);
+        if (!pBlocks)
+        {
+            LOG_ERROR_MESSAGE("Failed to create the texture compressor block buffer");
+            return false;
+        }
+    }
+
+    {
+        MapHelper<TextureCompressorConstants> CBData{pCtx, m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+        CBData->SrcOffsetX   = Attribs.SrcX;
+        CBData->SrcOffsetY   = Attribs.SrcY;
+        CBData->SrcWidth     = Width;
+        CBData->SrcHeight    = Height;
+        CBData->NumBlocksX   = NumBlocksX;
+        CBData->NumBlocksY   = NumBlocksY;
+        CBData->DstRowStride = RowStride / Info.BlockSize;
+        CBData->Padding      = 0;
+    }
+
+    pPipeline->pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Source")->Set(Attribs.pSrcSRV);
+    pPipeline->pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Blocks")->Set(pBlocks->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+
+    pCtx->SetPipelineState(pPipeline->pPSO);
+    pCtx->CommitShaderResources(pPipeline->pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->DispatchCompute({(NumBlocksX + CompressorGroupSize - 1) / CompressorGroupSize, (NumBlocksY + CompressorGroupSize - 1) / CompressorGroupSize});
+
+    const Box DstBox{Attribs.DstX, Attribs.DstX + Width, Attribs.DstY, Attribs.DstY + Height};
+
+    TextureSubResData SubresData;
+    SubresData.pSrcBuffer  = pBlocks;
+    SubresData.SrcOffset   = 0;
+    SubresData.Stride      = RowStride;
+    SubresData.DepthStride = Uint64{RowStride} * NumBlocksY;
+    // The block buffer is transitioned from the unordered access state to the copy source state
+    pCtx->UpdateTexture(Attribs.pDstTexture, Attribs.DstMipLevel, Attribs.DstSlice, DstBox, SubresData,
+                        RESOURCE_STATE_TRANSITION_MODE_TRANSITION, Attribs.DstTextureTransitionMode);
+
+    return true;
+}
+
+} // namespace Diligent
@@ -26,7 +26,16 @@
  */
 
 #include "TextureUploader.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 #include "DebugUtilities.hpp"
+#include "FileSystem.hpp"
+#include "GraphicsAccessories.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "Cast.hpp"
 
 #if D3D11_SUPPORTED
 #    include "TextureUploaderD3D11.hpp"
@@ -50,7 +59,14 @@ namespace Diligent
 void CreateTextureUploader(IRenderDevice* pDevice, const TextureUploaderDesc& Desc, ITextureUploader** ppUploader)
 {
     *ppUploader = nullptr;
-    switch (pDevice->GetDeviceInfo().Type)
+
+    const RENDER_DEVICE_TYPE DevType = pDevice->GetDeviceInfo().Type;
+    if (Desc.pCopyContext != nullptr && DevType != RENDER_DEVICE_TYPE_D3D12 && DevType != RENDER_DEVICE_TYPE_VULKAN)
+        LOG_WARNING_MESSAGE("Copy context is only supported by Direct3D12 and Vulkan texture uploaders and will be ignored");
+    if (Desc.MaxCopyBytesPerUpdate != 0 && DevType != RENDER_DEVICE_TYPE_D3D12 && DevType != RENDER_DEVICE_TYPE_VULKAN)
+        LOG_WARNING_MESSAGE("Copy budget is only supported by Direct3D12 and Vulkan texture uploaders and will be ignored");
+
+    switch (DevType)
     {
 #if D3D11_SUPPORTED
         case RENDER_DEVICE_TYPE_D3D11:
@@ -84,4 +100,84 @@ void CreateTextureUploader(IRenderDevice* pDevice, const TextureUploaderDesc& De
         (*ppUploader)->AddRef();
 }
 
+bool ReadUploadBufferFromFile(AsyncFile&                File,
+                              Uint64                    FileOffset,
+                              Uint64                    FileRowStride,
+                              Uint64                    FileDepthStride,
+                              IUploadBuffer*            pUploadBuffer,
+                              Uint32                    MipLevel,
+                              Uint32                    ArraySlice,
+                              std::function<void(bool)> Callback)
+{
+    DEV_CHECK_ERR(pUploadBuffer != nullptr, "Upload buffer must not be null");
+
+    const UploadBufferDesc& BuffDesc = pUploadBuffer->GetDesc();
+    DEV_CHECK_ERR(MipLevel < BuffDesc.MipLevels, "Mip level (", MipLevel, ") is out of range");
+    DEV_CHECK_ERR(ArraySlice < BuffDesc.ArraySize, "Array slice (", ArraySlice, ") is out of range");
+
+    TextureDesc TexDesc;
+    TexDesc.Type      = BuffDesc.Depth > 1 ? RESOURCE_DIM_TEX_3D : RESOURCE_DIM_TEX_2D_ARRAY;
+    TexDesc.Width     = BuffDesc.Width;
+    TexDesc.Height    = BuffDesc.Height;
+    TexDesc.Depth     = BuffDesc.Depth > 1 ? BuffDesc.Depth : BuffDesc.ArraySize;
+    TexDesc.MipLevels = BuffDesc.MipLevels;
+    TexDesc.Format    = BuffDesc.Format;
+
+    const MipLevelProperties       MipProps = GetMipLevelProperties(TexDesc, MipLevel);
+    const MappedTextureSubresource DstData  = pUploadBuffer->GetMappedData(MipLevel, ArraySlice);
+    if (DstData.pData == nullptr)
+    {
+        DEV_ERROR("Upload buffer memory is not mapped");
+        return false;
+    }
+
+    const Uint32 NumRows = MipProps.StorageHeight / std::max(GetTextureFormatBlockHeight(BuffDesc.Format), 1u);
+    const Uint32 Depth   = BuffDesc.Depth > 1 ? MipProps.Depth : 1;
+
+    std::vector<AsyncFileReadRequest> Requests;
+    if (FileRowStride == DstData.Stride && (Depth == 1 || FileDepthStride == DstData.DepthStride))
+    {
+        AsyncFileReadRequest Req;
+        Req.Offset = FileOffset;
+        Req.Size   = StaticCast<size_t>((Depth - 1) * DstData.DepthStride + (NumRows - 1) * DstData.Stride + MipProps.RowSize);
+        Req.pDst   = DstData.pData;
+        Requests.push_back(Req);
+    }
+    else
+    {
+        Requests.reserve(size_t{Depth} * NumRows);
+        for (Uint32 z = 0; z < Depth; ++z)
+        {
+            for (Uint32 row = 0; row < NumRows; ++row)
+            {
+                AsyncFileReadRequest Req;
+                Req.Offset = FileOffset + z * FileDepthStride + row * FileRowStride;
+                Req.Size   = StaticCast<size_t>(MipProps.RowSize);
+                Req.pDst   = static_cast<Uint8*>(DstData.pData) + z * DstData.DepthStride + row * DstData.Stride;
+                Requests.push_back(Req);
+            }
+        }
+    }
+
+    struct ReadState
+    {
+        std::atomic<size_t>          NumRemaining{0};
+        std::atomic<bool>            Success{true};
+        RefCntAutoPtr<IUploadBuffer> pUploadBuffer;
+        std::function<void(bool)>    Callback;
+    };
+    auto pState = std::make_shared<ReadState>();
+    pState->NumRemaining.store(Requests.size());
+    pState->pUploadBuffer = pUploadBuffer;
+    pState->Callback      = std::move(Callback);
+
+    return File.Read(Requests.data(), static_cast<Uint32>(Requests.size()),
+                     [pState](const AsyncFileReadRequest& Req, size_t BytesRead, bool Success) {
+                         if (!Success || BytesRead != Req.Size)
+                             pState->Success.store(false);
+                         if (pState->NumRemaining.fetch_sub(1) == 1 && pState->Callback)
+                             pState->Callback(pState->Success.load());
+                     });
+}
+
 } // namespace Diligent
@@ -83,7 +83,7 @@ public:
         m_CopyScheduledSignal.Wait();
     }
 
-    bool DbgIsCopyScheduled()
+    virtual bool IsCopyScheduled() const override final
     {
         return m_CopyScheduledSignal.IsTriggered();
     }
@@ -125,19 +125,23 @@ struct TextureUploaderD3D11::InternalData
         Uint32                           DstMip       = 0;
         Uint32                           DstSlice     = 0;
         Uint32                           DstMipLevels = 0;
+        Uint32                           DstX         = 0;
+        Uint32                           DstY         = 0;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadBufferD3D11* pBuff) :
             operation    {op   },
             pUploadBuffer{pBuff}
         {}
-        PendingBufferOperation(Operation op, UploadBufferD3D11* pBuff, ID3D11Resource* pd3d11DstTex, Uint32 Mip, Uint32 Slice, Uint32 MipLevels) :
+        PendingBufferOperation(Operation op, UploadBufferD3D11* pBuff, ID3D11Resource* pd3d11DstTex, Uint32 Mip, Uint32 Slice, Uint32 MipLevels, Uint32 X, Uint32 Y) :
             operation             {op          },
             pUploadBuffer         {pBuff       },
             pd3d11NativeDstTexture{pd3d11DstTex},
             DstMip                {Mip         },
             DstSlice              {Slice       },
-            DstMipLevels          {MipLevels   }
+            DstMipLevels          {MipLevels   },
+            DstX                  {X           },
+            DstY                  {Y           }
         {}
         // clang-format on
     };
@@ -156,10 +160,10 @@ struct TextureUploaderD3D11::InternalData
         m_PendingOperations.swap(m_InWorkOperations);
     }
 
-    void EnqueueCopy(UploadBufferD3D11* pUploadBuffer, ID3D11Resource* pd3d11DstTex, Uint32 Mip, Uint32 Slice, Uint32 MipLevels)
+    void EnqueueCopy(UploadBufferD3D11* pUploadBuffer, ID3D11Resource* pd3d11DstTex, Uint32 Mip, Uint32 Slice, Uint32 MipLevels, Uint32 X, Uint32 Y)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pd3d11DstTex, Mip, Slice, MipLevels);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pd3d11DstTex, Mip, Slice, MipLevels, X, Y);
     }
 
     void EnqueueMap(UploadBufferD3D11* pUploadBuffer, PendingBufferOperation::Operation Op)
@@ -319,7 +323,7 @@ void TextureUploaderD3D11::InternalData::Execute(ID3D11DeviceContext*    pd3d11N
                         static_cast<UINT>(OperationInfo.DstSlice + Slice),
                         static_cast<UINT>(OperationInfo.DstMipLevels));
                     pd3d11NativeCtx->CopySubresourceRegion(OperationInfo.pd3d11NativeDstTexture, DstSubres,
-                                                           0, 0, 0, // DstX, DstY, DstZ
+                                                           OperationInfo.DstX >> Mip, OperationInfo.DstY >> Mip, 0, // DstX, DstY, DstZ
                                                            pBuffer->GetStagingTex(),
                                                            SrcSubres,
                                                            nullptr // pSrcBox
@@ -412,11 +416,13 @@ void TextureUploaderD3D11::AllocateUploadBuffer(IDeviceContext*         pContext
     *ppBuffer = pUploadBuffer.Detach();
 }
 
-void TextureUploaderD3D11::ScheduleGPUCopy(IDeviceContext* pContext,
-                                           ITexture*       pDstTexture,
-                                           Uint32          ArraySlice,
-                                           Uint32          MipLevel,
-                                           IUploadBuffer*  pUploadBuffer)
+void TextureUploaderD3D11::ScheduleGPUCopyToRegion(IDeviceContext* pContext,
+                                                   ITexture*       pDstTexture,
+                                                   Uint32          ArraySlice,
+                                                   Uint32          MipLevel,
+                                                   Uint32          DstX,
+                                                   Uint32          DstY,
+                                                   IUploadBuffer*  pUploadBuffer)
 {
     UploadBufferD3D11*           pUploadBufferD3D11 = ClassPtrCast<UploadBufferD3D11>(pUploadBuffer);
     RefCntAutoPtr<ITextureD3D11> pDstTexD3D11(pDstTexture, IID_TextureD3D11);
@@ -432,21 +438,23 @@ void TextureUploaderD3D11::ScheduleGPUCopy(IDeviceContext* pContext,
                 pd3d11NativeDstTex,
                 MipLevel,
                 ArraySlice,
-                DstTexDesc.MipLevels //
+                DstTexDesc.MipLevels,
+                DstX,
+                DstY //
             };
         m_pInternalData->ExecuteImmediately(pContext, CopyOp);
     }
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadBufferD3D11, pd3d11NativeDstTex, MipLevel, ArraySlice, DstTexDesc.MipLevels);
+        m_pInternalData->EnqueueCopy(pUploadBufferD3D11, pd3d11NativeDstTex, MipLevel, ArraySlice, DstTexDesc.MipLevels, DstX, DstY);
     }
 }
 
 void TextureUploaderD3D11::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
     UploadBufferD3D11* pUploadBufferD3D11 = ClassPtrCast<UploadBufferD3D11>(pUploadBuffer);
-    VERIFY(pUploadBufferD3D11->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+    VERIFY(pUploadBufferD3D11->IsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
     pUploadBufferD3D11->Reset();
 
     std::lock_guard<std::mutex> CacheLock(m_pInternalData->m_UploadBuffCacheMtx);
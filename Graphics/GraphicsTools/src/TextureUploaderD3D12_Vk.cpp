@@ -29,11 +29,23 @@
 #include <unordered_map>
 #include <deque>
 #include <vector>
+#include <algorithm>
+#include <atomic>
+#include <memory>
 
 #include "TextureUploaderD3D12_Vk.hpp"
+#include "TextureCompressor.hpp"
 #include "ThreadSignal.hpp"
 #include "GraphicsAccessories.hpp"
 
+#if D3D12_SUPPORTED
+#    include "StorageQueueD3D12.h"
+#endif
+#if VULKAN_SUPPORTED
+#    include "../../GraphicsEngineVulkan/include/VulkanUtilities/VulkanHeaders.h"
+#    include "TextureVk.h"
+#endif
+
 namespace Diligent
 {
 
@@ -110,7 +122,7 @@ public:
 
     ITexture* GetStagingTexture() { return m_pStagingTexture; }
 
-    bool DbgIsCopyScheduled() const
+    virtual bool IsCopyScheduled() const override final
     {
         return m_CopyScheduledSignal.IsTriggered();
     }
@@ -134,6 +146,101 @@ private:
     Uint64                  m_CopyScheduledFenceValue = 0;
 };
 
+// Multiple-producer single-consumer lock-free queue.
+// Any thread may add items, but only one thread at a time may take them.
+template <typename ItemType>
+class MPSCQueue
+{
+public:
+    MPSCQueue() = default;
+
+    // clang-format off
+    MPSCQueue           (const MPSCQueue&)  = delete;
+    MPSCQueue           (      MPSCQueue&&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&)  = delete;
+    MPSCQueue& operator=(      MPSCQueue&&) = delete;
+    // clang-format on
+
+    ~MPSCQueue()
+    {
+        Node* pNode = m_pHead.exchange(nullptr);
+        while (pNode != nullptr)
+        {
+            Node* pNext = pNode->pNext;
+            delete pNode;
+            pNode = pNext;
+        }
+    }
+
+    template <typename... ArgsType>
+    void Emplace(ArgsType&&... Args)
+    {
+        Node* pNode  = new Node{std::forward<ArgsType>(Args)...};
+        pNode->pNext = m_pHead.load(std::memory_order_relaxed);
+        while (!m_pHead.compare_exchange_weak(pNode->pNext, pNode, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        m_Size.fetch_add(1);
+    }
+
+    // Moves all items to the end of Items in the order they were added.
+    void PopAll(std::vector<ItemType>& Items)
+    {
+        // Items are pushed to the front of the list, so reverse it first.
+        Node* pReversed = nullptr;
+        for (Node* pNode = m_pHead.exchange(nullptr, std::memory_order_acquire); pNode != nullptr;)
+        {
+            Node* pNext  = pNode->pNext;
+            pNode->pNext = pReversed;
+            pReversed    = pNode;
+            pNode        = pNext;
+        }
+
+        Uint32 NumItems = 0;
+        while (pReversed != nullptr)
+        {
+            Items.emplace_back(std::move(pReversed->Item));
+            Node* pNext = pReversed->pNext;
+            delete pReversed;
+            pReversed = pNext;
+            ++NumItems;
+        }
+        m_Size.fetch_sub(NumItems);
+    }
+
+    Uint32 GetSize() const
+    {
+        return m_Size.load();
+    }
+
+private:
+    struct Node
+    {
+        template <typename... ArgsType>
+        explicit Node(ArgsType&&... Args) :
+            Item{std::forward<ArgsType>(Args)...}
+        {}
+
+        ItemType Item;
+        Node*    pNext = nullptr;
+    };
+
+    std::atomic<Node*>  m_pHead{nullptr};
+    std::atomic<Uint32> m_Size{0};
+};
+
+// Returns the size of the subresource copy, in bytes
+Uint64 GetSubresourceCopySize(const UploadBufferDesc& Desc, Uint32 Mip)
+{
+    TextureDesc TexDesc;
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = Desc.Width;
+    TexDesc.Height    = Desc.Height;
+    TexDesc.Format    = Desc.Format;
+    TexDesc.MipLevels = Desc.MipLevels;
+    return GetMipLevelProperties(TexDesc, Mip).MipSize;
+}
+
 } // namespace
 
 
@@ -150,27 +257,109 @@ struct TextureUploaderD3D12_Vk::InternalData
         RefCntAutoPtr<ITexture>      pDstTexture;
         Uint32                       DstSlice = 0;
         Uint32                       DstMip   = 0;
+        Uint32                       DstX     = 0;
+        Uint32                       DstY     = 0;
+
+        // Subresources are copied starting with the coarsest mip level.
+        Uint32 NumCopiedSubresources = 0;
+        // The number of subresources to copy by the next Execute() call.
+        Uint32 NumSubresourcesToCopy = 0;
+        // Whether the subresources are copied on the host (Vulkan only), see ITextureVk::UpdateSubresourceOnHost().
+        bool HostCopy = false;
+        // Whether the subresources are encoded into the compressed destination texture, see TextureUploaderDesc::EnableGPUCompression.
+        bool GPUCompress = false;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadTexture* pUploadTex) :
             operation     {op        },
             pUploadTexture{pUploadTex}
         {}
-        PendingBufferOperation(Operation op, UploadTexture* pUploadTex, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip) :
+        PendingBufferOperation(Operation op, UploadTexture* pUploadTex, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip, Uint32 dstX, Uint32 dstY) :
             operation      {op        },
             pUploadTexture {pUploadTex},
             pDstTexture    {pDstTex   },
             DstSlice       {dstSlice  },
-            DstMip         {dstMip    }
+            DstMip         {dstMip    },
+            DstX           {dstX      },
+            DstY           {dstY      }
         {}
         // clang-format on
+
+        Uint32 GetNumSubresources() const
+        {
+            const UploadBufferDesc& Desc = pUploadTexture->GetDesc();
+            return Desc.MipLevels * Desc.ArraySize;
+        }
+
+        bool IsComplete() const
+        {
+            return NumCopiedSubresources == GetNumSubresources();
+        }
+
+        // Returns the mip level of the subresource with the given copy index
+        Uint32 GetSubresourceMip(Uint32 Subres) const
+        {
+            const UploadBufferDesc& Desc = pUploadTexture->GetDesc();
+            return Desc.MipLevels - 1 - Subres / Desc.ArraySize;
+        }
+
+        // Returns the array slice of the subresource with the given copy index
+        Uint32 GetSubresourceSlice(Uint32 Subres) const
+        {
+            return Subres % pUploadTexture->GetDesc().ArraySize;
+        }
     };
 
-    InternalData(IRenderDevice* pDevice)
+    InternalData(IRenderDevice* pDevice, const TextureUploaderDesc& Desc) :
+        m_pDevice{pDevice},
+        m_MaxCopyBytesPerUpdate{Desc.MaxCopyBytesPerUpdate},
+        m_pCopyContext{Desc.pCopyContext}
     {
         FenceDesc fenceDesc;
         fenceDesc.Name = "Texture uploader sync fence";
+        // The render context waits for the copies on the GPU
+        if (m_pCopyContext)
+            fenceDesc.Type = FENCE_TYPE_GENERAL;
         pDevice->CreateFence(fenceDesc, &m_pFence);
+
+        if (m_pCopyContext)
+        {
+            fenceDesc.Name = "Texture uploader render context sync fence";
+            pDevice->CreateFence(fenceDesc, &m_pRenderCtxFence);
+        }
+
+        if (Desc.pStorageQueue != nullptr)
+        {
+#if D3D12_SUPPORTED
+            m_pStorageQueue = RefCntAutoPtr<IStorageQueueD3D12>{Desc.pStorageQueue, IID_StorageQueueD3D12};
+#endif
+            if (m_pStorageQueue)
+            {
+                fenceDesc.Name = "Texture uploader storage queue fence";
+                fenceDesc.Type = FENCE_TYPE_GENERAL;
+                pDevice->CreateFence(fenceDesc, &m_pStorageFence);
+            }
+            else
+            {
+                LOG_ERROR_MESSAGE("TextureUploaderDesc::pStorageQueue is not a Direct3D12 storage queue. File reads will not be available.");
+            }
+        }
+
+        if (Desc.EnableGPUCompression)
+        {
+            if (m_pCopyContext)
+            {
+                LOG_WARNING_MESSAGE("GPU compression is not available when TextureUploaderDesc::pCopyContext is specified.");
+            }
+            else if (!TextureCompressor::IsDeviceSupported(pDevice))
+            {
+                LOG_WARNING_MESSAGE("GPU compression is not supported by this device.");
+            }
+            else
+            {
+                m_pCompressor = std::make_unique<TextureCompressor>(pDevice);
+            }
+        }
     }
 
     ~InternalData()
@@ -188,23 +377,27 @@ struct TextureUploaderD3D12_Vk::InternalData
         }
     }
 
-    std::vector<PendingBufferOperation>& SwapMapQueues()
+    std::vector<PendingBufferOperation>& PopPendingOperations()
     {
-        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.swap(m_InWorkOperations);
+        m_PendingOperations.PopAll(m_InWorkOperations);
         return m_InWorkOperations;
     }
 
-    void EnqueueCopy(UploadTexture* pUploadBuffer, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip)
+    void EnqueueCopy(UploadTexture* pUploadBuffer, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip, Uint32 dstX, Uint32 dstY)
     {
-        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTex, dstSlice, dstMip);
+        const UploadBufferDesc& Desc = pUploadBuffer->GetDesc();
+
+        Uint64 CopySize = 0;
+        for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+            CopySize += GetSubresourceCopySize(Desc, Mip) * Desc.ArraySize;
+        m_PendingCopySize.fetch_add(CopySize);
+
+        m_PendingOperations.Emplace(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTex, dstSlice, dstMip, dstX, dstY);
     }
 
     void EnqueueMap(UploadTexture* pUploadBuffer)
     {
-        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Map, pUploadBuffer);
+        m_PendingOperations.Emplace(PendingBufferOperation::Operation::Map, pUploadBuffer);
     }
 
     Uint64 SignalFence(IDeviceContext* pContext)
@@ -253,30 +446,102 @@ struct TextureUploaderD3D12_Vk::InternalData
         Deque.emplace_back(pUploadTexture);
     }
 
-    Uint32 GetNumPendingOperations()
+    Uint32 GetNumPendingOperations() const
     {
-        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        return static_cast<Uint32>(m_PendingOperations.size());
+        return m_PendingOperations.GetSize() + m_NumDeferredCopies.load() + m_NumPendingStorageReads.load();
+    }
+
+    Uint64 GetPendingCopySize() const
+    {
+        return m_PendingCopySize.load();
+    }
+
+    // Returns the context that executes map and copy operations
+    IDeviceContext* GetCopyContext(IDeviceContext* pRenderContext) const
+    {
+        return m_pCopyContext ? m_pCopyContext.RawPtr() : pRenderContext;
+    }
+
+    Uint64 GetCopyContextMask() const
+    {
+        return m_pCopyContext ? Uint64{1} << Uint64{m_pCopyContext->GetDesc().ContextId} : Uint64{1};
     }
 
     void Execute(IDeviceContext* pContext, PendingBufferOperation& OperationInfo);
 
+    // Copies the upload texture subresource into an intermediate texture and encodes it into the destination texture.
+    void CompressSubresource(IDeviceContext* pContext, PendingBufferOperation& OperationInfo, Uint32 Mip, Uint32 Slice);
+
+    // Executes copy operations, makes the render context wait for them and signals the upload textures
+    // whose copies are complete.
+    void ScheduleCopies(IDeviceContext* pRenderContext, PendingBufferOperation* pCopyOps, size_t NumOps);
+
+    // Adds copy operations to the deferred copy list.
+    void DeferCopies(PendingBufferOperation* pCopyOps, size_t NumOps);
+
+    // Executes deferred copies within the copy budget.
+    void ExecuteDeferredCopies(IDeviceContext* pRenderContext);
+
+    // Enqueues a storage queue read of a texture subresource.
+    bool EnqueueStorageRead(const TextureFileReadInfo& ReadInfo);
+
+    // Submits pending storage queue reads and makes the render context wait for them.
+    void SubmitStorageReads(IDeviceContext* pRenderContext);
+
 private:
-    std::mutex                          m_PendingOperationsMtx;
-    std::vector<PendingBufferOperation> m_PendingOperations;
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const Uint64 m_MaxCopyBytesPerUpdate;
+
+    MPSCQueue<PendingBufferOperation>   m_PendingOperations;
     std::vector<PendingBufferOperation> m_InWorkOperations;
 
+    // Copies that have not been completed yet. Only accessed by the render thread.
+    std::vector<PendingBufferOperation> m_DeferredCopies;
+    std::atomic<Uint32>                 m_NumDeferredCopies{0};
+    std::atomic<Uint64>                 m_PendingCopySize{0};
+
     std::mutex                                                                     m_UploadTexturesCacheMtx;
     std::unordered_map<UploadBufferDesc, std::deque<RefCntAutoPtr<UploadTexture>>> m_UploadTexturesCache;
 
     RefCntAutoPtr<IFence> m_pFence;
     Uint64                m_NextFenceValue      = 1;
     Uint64                m_CompletedFenceValue = 0;
+
+    // Optional transfer queue context and the fence that makes it wait for the render context
+    RefCntAutoPtr<IDeviceContext> m_pCopyContext;
+    RefCntAutoPtr<IFence>         m_pRenderCtxFence;
+    Uint64                        m_NextRenderCtxFenceValue = 1;
+
+    // Optional storage queue that reads texture data from files directly into destination textures
+#if D3D12_SUPPORTED
+    RefCntAutoPtr<IStorageQueueD3D12> m_pStorageQueue;
+#else
+    RefCntAutoPtr<IObject> m_pStorageQueue;
+#endif
+    RefCntAutoPtr<IFence> m_pStorageFence;
+    Uint64                m_NextStorageFenceValue = 1;
+
+    std::mutex                           m_PendingStorageReadsMtx;
+    std::vector<RefCntAutoPtr<ITexture>> m_PendingStorageReadTextures;
+    std::atomic<Uint32>                  m_NumPendingStorageReads{0};
+
+    // Optional GPU encoder, see TextureUploaderDesc::EnableGPUCompression
+    std::unique_ptr<TextureCompressor> m_pCompressor;
+
+    // Intermediate textures with the full mip chain that hold the uncompressed data for the encoder.
+    // Only accessed by the render thread.
+    struct CompressionSource
+    {
+        RefCntAutoPtr<ITexture>                  pTexture;
+        std::vector<RefCntAutoPtr<ITextureView>> MipSRVs;
+    };
+    std::unordered_map<UploadBufferDesc, CompressionSource> m_CompressionSources;
 };
 
 TextureUploaderD3D12_Vk::TextureUploaderD3D12_Vk(IReferenceCounters* pRefCounters, IRenderDevice* pDevice, const TextureUploaderDesc Desc) :
     TextureUploaderBase{pRefCounters, pDevice, Desc},
-    m_pInternalData{new InternalData(pDevice)}
+    m_pInternalData{new InternalData(pDevice, Desc)}
 {
 }
 
@@ -294,37 +559,160 @@ TextureUploaderD3D12_Vk::~TextureUploaderD3D12_Vk()
 
 void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
 {
-    auto& InWorkOperations = m_pInternalData->SwapMapQueues();
+    auto& InWorkOperations = m_pInternalData->PopPendingOperations();
     if (!InWorkOperations.empty())
     {
-        Uint32 NumCopyOperations = 0;
-        for (InternalData::PendingBufferOperation& OperationInfo : InWorkOperations)
-        {
-            m_pInternalData->Execute(pContext, OperationInfo);
-            if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
-                ++NumCopyOperations;
-        }
+        // A texture is always mapped before its copy is enqueued, so map operations
+        // can be executed ahead of the copies.
+        auto FirstCopyIt = std::stable_partition(InWorkOperations.begin(), InWorkOperations.end(),
+                                                 [](const InternalData::PendingBufferOperation& OperationInfo) {
+                                                     return OperationInfo.operation == InternalData::PendingBufferOperation::Map;
+                                                 });
 
-        if (NumCopyOperations > 0)
-        {
-            // The buffer may be recycled immediately after the copy scheduled is signaled,
-            // so we must signal the fence first.
-            Uint64 SignaledFenceValue = m_pInternalData->SignalFence(pContext);
+        // Map operations are not limited by the copy budget since worker threads wait for them
+        IDeviceContext* pCopyContext = m_pInternalData->GetCopyContext(pContext);
+        for (auto it = InWorkOperations.begin(); it != FirstCopyIt; ++it)
+            m_pInternalData->Execute(pCopyContext, *it);
 
-            for (InternalData::PendingBufferOperation& OperationInfo : InWorkOperations)
-            {
-                if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
-                    OperationInfo.pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
-            }
-        }
+        const size_t FirstCopyIdx = static_cast<size_t>(FirstCopyIt - InWorkOperations.begin());
+        m_pInternalData->DeferCopies(InWorkOperations.data() + FirstCopyIdx, InWorkOperations.size() - FirstCopyIdx);
 
         InWorkOperations.clear();
     }
 
+    m_pInternalData->ExecuteDeferredCopies(pContext);
+
+    m_pInternalData->SubmitStorageReads(pContext);
+
     // This must be called by the same thread that signals the fence
     m_pInternalData->UpdatedCompletedFenceValue();
 }
 
+void TextureUploaderD3D12_Vk::InternalData::DeferCopies(PendingBufferOperation* pCopyOps, size_t NumOps)
+{
+    for (size_t i = 0; i < NumOps; ++i)
+    {
+        VERIFY_EXPR(pCopyOps[i].operation == PendingBufferOperation::Copy);
+        m_DeferredCopies.emplace_back(std::move(pCopyOps[i]));
+    }
+    m_NumDeferredCopies.store(static_cast<Uint32>(m_DeferredCopies.size()));
+}
+
+void TextureUploaderD3D12_Vk::InternalData::ExecuteDeferredCopies(IDeviceContext* pRenderContext)
+{
+    if (m_DeferredCopies.empty())
+        return;
+
+    if (m_MaxCopyBytesPerUpdate != 0)
+    {
+        // Priorities may change at any time, so sort the copies every time.
+        // Copies with equal priority keep the order in which they were scheduled.
+        std::stable_sort(m_DeferredCopies.begin(), m_DeferredCopies.end(),
+                         [](const PendingBufferOperation& Op1, const PendingBufferOperation& Op2) {
+                             return Op1.pUploadTexture->GetPriority() > Op2.pUploadTexture->GetPriority();
+                         });
+    }
+
+    // Distribute the budget between the copies in priority order. Always copy at least
+    // one subresource to guarantee progress.
+    Uint64 BudgetLeft   = m_MaxCopyBytesPerUpdate != 0 ? m_MaxCopyBytesPerUpdate : ~Uint64{0};
+    Uint64 CopySize     = 0;
+    size_t NumOpsToCopy = 0;
+    for (PendingBufferOperation& Op : m_DeferredCopies)
+    {
+        const UploadBufferDesc& Desc            = Op.pUploadTexture->GetDesc();
+        const Uint32            NumSubresources = Op.GetNumSubresources();
+        while (Op.NumCopiedSubresources + Op.NumSubresourcesToCopy < NumSubresources)
+        {
+            const Uint32 Mip        = Op.GetSubresourceMip(Op.NumCopiedSubresources + Op.NumSubresourcesToCopy);
+            const Uint64 SubresSize = GetSubresourceCopySize(Desc, Mip);
+            if (SubresSize > BudgetLeft && CopySize != 0)
+                break;
+
+            BudgetLeft -= std::min(SubresSize, BudgetLeft);
+            CopySize += SubresSize;
+            ++Op.NumSubresourcesToCopy;
+        }
+
+        if (Op.NumSubresourcesToCopy == 0)
+            break;
+
+        ++NumOpsToCopy;
+        if (Op.NumCopiedSubresources + Op.NumSubresourcesToCopy < NumSubresources)
+            break;
+    }
+
+    ScheduleCopies(pRenderContext, m_DeferredCopies.data(), NumOpsToCopy);
+    m_PendingCopySize.fetch_sub(CopySize);
+
+    m_DeferredCopies.erase(std::remove_if(m_DeferredCopies.begin(), m_DeferredCopies.begin() + NumOpsToCopy,
+                                          [](const PendingBufferOperation& Op) {
+                                              return Op.IsComplete();
+                                          }),
+                           m_DeferredCopies.begin() + NumOpsToCopy);
+    m_NumDeferredCopies.store(static_cast<Uint32>(m_DeferredCopies.size()));
+}
+
+
+bool TextureUploaderD3D12_Vk::InternalData::EnqueueStorageRead(const TextureFileReadInfo& ReadInfo)
+{
+    if (!m_pStorageQueue)
+    {
+        LOG_ERROR_MESSAGE("File reads require a Direct3D12 storage queue, see TextureUploaderDesc::pStorageQueue");
+        return false;
+    }
+
+#if D3D12_SUPPORTED
+    DEV_CHECK_ERR(ReadInfo.pDstTexture != nullptr, "Destination texture must not be null");
+
+    StorageReadRequestD3D12 Request;
+    Request.FilePath         = ReadInfo.FilePath;
+    Request.FileOffset       = ReadInfo.FileOffset;
+    Request.Size             = ReadInfo.Size;
+    Request.UncompressedSize = ReadInfo.UncompressedSize;
+    Request.Compression      = ReadInfo.GDeflateCompressed ? STORAGE_COMPRESSION_D3D12_GDEFLATE : STORAGE_COMPRESSION_D3D12_NONE;
+    Request.pDstTexture      = ReadInfo.pDstTexture;
+    Request.DstMipLevel      = ReadInfo.MipLevel;
+    Request.DstSlice         = ReadInfo.ArraySlice;
+    if (!m_pStorageQueue->EnqueueRead(Request))
+        return false;
+
+    std::lock_guard<std::mutex> Lock{m_PendingStorageReadsMtx};
+    m_PendingStorageReadTextures.emplace_back(ReadInfo.pDstTexture);
+    m_NumPendingStorageReads.fetch_add(1);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void TextureUploaderD3D12_Vk::InternalData::SubmitStorageReads(IDeviceContext* pRenderContext)
+{
+#if D3D12_SUPPORTED
+    if (!m_pStorageQueue)
+        return;
+
+    std::vector<RefCntAutoPtr<ITexture>> Textures;
+    {
+        std::lock_guard<std::mutex> Lock{m_PendingStorageReadsMtx};
+        if (m_PendingStorageReadTextures.empty())
+            return;
+        Textures.swap(m_PendingStorageReadTextures);
+        m_NumPendingStorageReads.store(0);
+    }
+
+    // Reads enqueued by other threads after the swap are covered by this signal as well
+    // and are accounted for by the next call.
+    const Uint64 FenceValue = m_NextStorageFenceValue++;
+    m_pStorageQueue->EnqueueSignal(m_pStorageFence, FenceValue);
+    m_pStorageQueue->Submit();
+
+    // The render context will not use the textures until the reads are complete
+    pRenderContext->DeviceWaitForFence(m_pStorageFence, FenceValue);
+    for (ITexture* pTexture : Textures)
+        pTexture->SetState(RESOURCE_STATE_COMMON);
+#endif
+}
 
 void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pContext,
                                                     PendingBufferOperation& OperationInfo)
@@ -350,31 +738,248 @@ void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pCon
         case InternalData::PendingBufferOperation::Copy:
         {
             VERIFY(pUploadTex->DbgIsMapped(), "Upload texture must be copied only after it has been mapped");
-            for (Uint32 Slice = 0; Slice < StagingTexDesc.ArraySize; ++Slice)
+            VERIFY_EXPR(OperationInfo.NumCopiedSubresources + OperationInfo.NumSubresourcesToCopy <= OperationInfo.GetNumSubresources());
+            if (OperationInfo.NumCopiedSubresources == 0)
             {
-                for (Uint32 Mip = 0; Mip < StagingTexDesc.MipLevels; ++Mip)
+                const TEXTURE_FORMAT DstFormat = OperationInfo.pDstTexture->GetDesc().Format;
+                OperationInfo.GPUCompress =
+                    m_pCompressor &&
+                    StagingTexDesc.Format != DstFormat &&
+                    GetTextureFormatAttribs(StagingTexDesc.Format).ComponentType != COMPONENT_TYPE_COMPRESSED &&
+                    TextureCompressor::IsFormatSupported(DstFormat);
+            }
+#if VULKAN_SUPPORTED
+            // A texture that has never been used by the GPU can be written on the host without
+            // recording copy commands. Copy contexts leave textures in COMMON state, so they are not used.
+            RefCntAutoPtr<ITextureVk> pDstTextureVk;
+            if (OperationInfo.NumCopiedSubresources == 0)
+            {
+                // Encoded subresources are always written by the GPU
+                OperationInfo.HostCopy = !m_pCopyContext && !OperationInfo.GPUCompress && OperationInfo.pDstTexture->GetState() == RESOURCE_STATE_UNDEFINED;
+            }
+            if (OperationInfo.HostCopy)
+            {
+                pDstTextureVk = RefCntAutoPtr<ITextureVk>{OperationInfo.pDstTexture, IID_TextureVk};
+            }
+#endif
+
+            // Copy the mip tail first so that coarse mip levels become available as early as possible
+            for (Uint32 i = 0; i < OperationInfo.NumSubresourcesToCopy; ++i)
+            {
+                const Uint32 Subres = OperationInfo.NumCopiedSubresources + i;
+                const Uint32 Mip    = OperationInfo.GetSubresourceMip(Subres);
+                const Uint32 Slice  = OperationInfo.GetSubresourceSlice(Subres);
+
+#if VULKAN_SUPPORTED
+                if (pDstTextureVk)
                 {
-                    pUploadTex->Unmap(pContext, Mip, Slice);
-
-                    CopyTextureAttribs CopyInfo //
-                        {
-                            pUploadTex->GetStagingTexture(),
-                            RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
-                            OperationInfo.pDstTexture,
-                            RESOURCE_STATE_TRANSITION_MODE_TRANSITION //
-                        };
-                    CopyInfo.SrcMipLevel = Mip;
-                    CopyInfo.SrcSlice    = Slice;
-                    CopyInfo.DstMipLevel = OperationInfo.DstMip + Mip;
-                    CopyInfo.DstSlice    = OperationInfo.DstSlice + Slice;
-                    pContext->CopyTexture(CopyInfo);
+                    const MappedTextureSubresource MappedData = pUploadTex->GetMappedData(Mip, Slice);
+
+                    TextureDesc StagingDesc;
+                    StagingDesc.Type      = RESOURCE_DIM_TEX_2D;
+                    StagingDesc.Width     = StagingTexDesc.Width;
+                    StagingDesc.Height    = StagingTexDesc.Height;
+                    StagingDesc.Format    = StagingTexDesc.Format;
+                    StagingDesc.MipLevels = StagingTexDesc.MipLevels;
+                    const MipLevelProperties MipProps = GetMipLevelProperties(StagingDesc, Mip);
+
+                    const Uint32 DstX = OperationInfo.DstX >> Mip;
+                    const Uint32 DstY = OperationInfo.DstY >> Mip;
+                    const Box    DstBox{DstX, DstX + MipProps.LogicalWidth, DstY, DstY + MipProps.LogicalHeight};
+
+                    const TextureSubResData SubresData{MappedData.pData, MappedData.Stride, MappedData.DepthStride};
+                    if (pDstTextureVk->UpdateSubresourceOnHost(OperationInfo.DstMip + Mip, OperationInfo.DstSlice + Slice, DstBox, SubresData))
+                    {
+                        pUploadTex->Unmap(pContext, Mip, Slice);
+                        continue;
+                    }
+                    // Fall back to the GPU copy for the remaining subresources
+                    pDstTextureVk.Release();
+                    OperationInfo.HostCopy = false;
+                }
+#endif
+
+                if (OperationInfo.GPUCompress)
+                {
+                    CompressSubresource(pContext, OperationInfo, Mip, Slice);
+                    continue;
                 }
+
+                pUploadTex->Unmap(pContext, Mip, Slice);
+
+                CopyTextureAttribs CopyInfo //
+                    {
+                        pUploadTex->GetStagingTexture(),
+                        RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                        OperationInfo.pDstTexture,
+                        RESOURCE_STATE_TRANSITION_MODE_TRANSITION //
+                    };
+                CopyInfo.SrcMipLevel = Mip;
+                CopyInfo.SrcSlice    = Slice;
+                CopyInfo.DstMipLevel = OperationInfo.DstMip + Mip;
+                CopyInfo.DstSlice    = OperationInfo.DstSlice + Slice;
+                CopyInfo.DstX        = OperationInfo.DstX >> Mip;
+                CopyInfo.DstY        = OperationInfo.DstY >> Mip;
+                pContext->CopyTexture(CopyInfo);
             }
+            OperationInfo.NumCopiedSubresources += OperationInfo.NumSubresourcesToCopy;
+            OperationInfo.NumSubresourcesToCopy = 0;
         }
         break;
     }
 }
 
+void TextureUploaderD3D12_Vk::InternalData::CompressSubresource(IDeviceContext*         pContext,
+                                                                PendingBufferOperation& OperationInfo,
+                                                                Uint32                  Mip,
+                                                                Uint32                  Slice)
+{
+    VERIFY_EXPR(m_pCompressor);
+    UploadTexture*          pUploadTex = OperationInfo.pUploadTexture;
+    const UploadBufferDesc& UploadDesc = pUploadTex->GetDesc();
+
+    UploadBufferDesc SourceKey = UploadDesc;
+    SourceKey.MipLevels        = 0;
+    SourceKey.ArraySize        = 1;
+
+    CompressionSource& Source = m_CompressionSources[SourceKey];
+    if (!Source.pTexture)
+    {
+        TextureDesc SourceDesc;
+        SourceDesc.Name      = "Texture uploader compression source";
+        SourceDesc.Type      = RESOURCE_DIM_TEX_2D;
+        SourceDesc.Width     = UploadDesc.Width;
+        SourceDesc.Height    = UploadDesc.Height;
+        SourceDesc.Format    = UploadDesc.Format;
+        SourceDesc.MipLevels = 0; // Full mip chain, so that the texture can be used with any number of upload mip levels
+        SourceDesc.Usage     = USAGE_DEFAULT;
+        SourceDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+        m_pDevice->CreateTexture(SourceDesc, nullptr, &Source.pTexture);
+        if (!Source.pTexture)
+        {
+            LOG_ERROR_MESSAGE("Failed to create the intermediate texture for GPU compression");
+            m_CompressionSources.erase(SourceKey);
+            pUploadTex->Unmap(pContext, Mip, Slice);
+            return;
+        }
+
+        const Uint32 NumMips = Source.pTexture->GetDesc().MipLevels;
+        Source.MipSRVs.resize(NumMips);
+        for (Uint32 SrcMip = 0; SrcMip < NumMips; ++SrcMip)
+        {
+            TextureViewDesc ViewDesc;
+            ViewDesc.ViewType        = TEXTURE_VIEW_SHADER_RESOURCE;
+            ViewDesc.MostDetailedMip = SrcMip;
+            ViewDesc.NumMipLevels    = 1;
+            Source.pTexture->CreateView(ViewDesc, &Source.MipSRVs[SrcMip]);
+        }
+    }
+
+    pUploadTex->Unmap(pContext, Mip, Slice);
+
+    CopyTextureAttribs CopyInfo //
+        {
+            pUploadTex->GetStagingTexture(),
+            RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+            Source.pTexture,
+            RESOURCE_STATE_TRANSITION_MODE_TRANSITION //
+        };
+    CopyInfo.SrcMipLevel = Mip;
+    CopyInfo.SrcSlice    = Slice;
+    CopyInfo.DstMipLevel = Mip;
+    pContext->CopyTexture(CopyInfo);
+
+    const MipLevelProperties MipProps = GetMipLevelProperties(Source.pTexture->GetDesc(), Mip);
+
+    TextureCompressAttribs CompressAttribs;
+    CompressAttribs.pSrcSRV     = Source.MipSRVs[Mip];
+    CompressAttribs.pDstTexture = OperationInfo.pDstTexture;
+    CompressAttribs.DstMipLevel = OperationInfo.DstMip + Mip;
+    CompressAttribs.DstSlice    = OperationInfo.DstSlice + Slice;
+    CompressAttribs.DstX        = OperationInfo.DstX >> Mip;
+    CompressAttribs.DstY        = OperationInfo.DstY >> Mip;
+    CompressAttribs.Width       = MipProps.LogicalWidth;
+    CompressAttribs.Height      = MipProps.LogicalHeight;
+    m_pCompressor->Compress(pContext, CompressAttribs);
+}
+
+void TextureUploaderD3D12_Vk::InternalData::ScheduleCopies(IDeviceContext*         pRenderContext,
+                                                           PendingBufferOperation* pCopyOps,
+                                                           size_t                  NumOps)
+{
+    if (NumOps == 0)
+        return;
+
+    if (m_pCopyContext)
+    {
+        // Transfer queues only support a limited set of resource states. Transition destination
+        // textures that are in other states to COMMON state in the render context and make the copy
+        // context wait until this is done. New textures are in UNDEFINED state and require no sync.
+        bool RenderCtxSyncRequired = false;
+        for (size_t i = 0; i < NumOps; ++i)
+        {
+            ITexture* pDstTexture = pCopyOps[i].pDstTexture;
+            DEV_CHECK_ERR((pDstTexture->GetDesc().ImmediateContextMask & GetCopyContextMask()) != 0,
+                          "Texture '", pDstTexture->GetDesc().Name, "' can't be used in the uploader copy context. "
+                          "Include the copy context in the texture's ImmediateContextMask.");
+
+            const RESOURCE_STATE State = pDstTexture->GetState();
+            if (State != RESOURCE_STATE_UNKNOWN && State != RESOURCE_STATE_UNDEFINED && State != RESOURCE_STATE_COMMON)
+            {
+                StateTransitionDesc Barrier{pDstTexture, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COMMON, STATE_TRANSITION_FLAG_UPDATE_STATE};
+                pRenderContext->TransitionResourceStates(1, &Barrier);
+                RenderCtxSyncRequired = true;
+            }
+        }
+
+        if (RenderCtxSyncRequired)
+        {
+            // Device context can only wait for a fence value that has been submitted
+            pRenderContext->EnqueueSignal(m_pRenderCtxFence, m_NextRenderCtxFenceValue);
+            pRenderContext->Flush();
+            m_pCopyContext->DeviceWaitForFence(m_pRenderCtxFence, m_NextRenderCtxFenceValue);
+            ++m_NextRenderCtxFenceValue;
+        }
+    }
+
+    IDeviceContext* pCopyContext = GetCopyContext(pRenderContext);
+    for (size_t i = 0; i < NumOps; ++i)
+    {
+        VERIFY_EXPR(pCopyOps[i].operation == PendingBufferOperation::Copy);
+        Execute(pCopyContext, pCopyOps[i]);
+    }
+
+    if (m_pCopyContext)
+    {
+        // Leave the textures in COMMON state, which hands them over to the render
+        // context queue (Vulkan resources shared between queues use concurrent sharing
+        // mode, so no explicit queue family ownership transfer is required).
+        for (size_t i = 0; i < NumOps; ++i)
+        {
+            StateTransitionDesc Barrier{pCopyOps[i].pDstTexture, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COMMON, STATE_TRANSITION_FLAG_UPDATE_STATE};
+            m_pCopyContext->TransitionResourceStates(1, &Barrier);
+        }
+    }
+
+    // The buffer may be recycled immediately after the copy scheduled is signaled,
+    // so we must signal the fence first.
+    Uint64 SignaledFenceValue = SignalFence(pCopyContext);
+
+    if (m_pCopyContext)
+    {
+        m_pCopyContext->Flush();
+        // The render context will not use the textures until the copies are complete
+        pRenderContext->DeviceWaitForFence(m_pFence, SignaledFenceValue);
+    }
+
+    for (size_t i = 0; i < NumOps; ++i)
+    {
+        if (pCopyOps[i].IsComplete())
+            pCopyOps[i].pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
+    }
+}
+
 void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pContext,
                                                    const UploadBufferDesc& Desc,
                                                    IUploadBuffer**         ppBuffer)
@@ -394,6 +999,8 @@ void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pCont
         StagingTexDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
         StagingTexDesc.Usage          = USAGE_STAGING;
 
+        StagingTexDesc.ImmediateContextMask = m_pInternalData->GetCopyContextMask();
+
         RefCntAutoPtr<ITexture> pStagingTexture;
         m_pDevice->CreateTexture(StagingTexDesc, nullptr, &pStagingTexture);
 
@@ -408,7 +1015,7 @@ void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pCont
     {
         // Render thread
         InternalData::PendingBufferOperation MapOp{InternalData::PendingBufferOperation::Operation::Map, pUploadTexture};
-        m_pInternalData->Execute(pContext, MapOp);
+        m_pInternalData->Execute(m_pInternalData->GetCopyContext(pContext), MapOp);
     }
     else
     {
@@ -419,11 +1026,13 @@ void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pCont
     *ppBuffer = pUploadTexture.Detach();
 }
 
-void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
-                                              ITexture*       pDstTexture,
-                                              Uint32          ArraySlice,
-                                              Uint32          MipLevel,
-                                              IUploadBuffer*  pUploadBuffer)
+void TextureUploaderD3D12_Vk::ScheduleGPUCopyToRegion(IDeviceContext* pContext,
+                                                      ITexture*       pDstTexture,
+                                                      Uint32          ArraySlice,
+                                                      Uint32          MipLevel,
+                                                      Uint32          DstX,
+                                                      Uint32          DstY,
+                                                      IUploadBuffer*  pUploadBuffer)
 {
     UploadTexture* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
     if (pContext != nullptr)
@@ -435,36 +1044,40 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
                 pUploadTexture,
                 pDstTexture,
                 ArraySlice,
-                MipLevel //
+                MipLevel,
+                DstX,
+                DstY //
             };
-        m_pInternalData->Execute(pContext, CopyOp);
-
-        // The buffer may be recycled immediately after the copy scheduled is signaled,
-        // so we must signal the fence first.
-        Uint64 SignaledFenceValue = m_pInternalData->SignalFence(pContext);
-        pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
+        CopyOp.NumSubresourcesToCopy = CopyOp.GetNumSubresources();
+        m_pInternalData->ScheduleCopies(pContext, &CopyOp, 1);
         // This must be called by the same thread that signals the fence
         m_pInternalData->UpdatedCompletedFenceValue();
     }
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadTexture, pDstTexture, ArraySlice, MipLevel);
+        m_pInternalData->EnqueueCopy(pUploadTexture, pDstTexture, ArraySlice, MipLevel, DstX, DstY);
     }
 }
 
 void TextureUploaderD3D12_Vk::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
     UploadTexture* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
-    VERIFY(pUploadTexture->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+    VERIFY(pUploadTexture->IsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
 
     m_pInternalData->RecycleUploadTexture(pUploadTexture);
 }
 
+bool TextureUploaderD3D12_Vk::ScheduleFileRead(const TextureFileReadInfo& ReadInfo)
+{
+    return m_pInternalData->EnqueueStorageRead(ReadInfo);
+}
+
 TextureUploaderStats TextureUploaderD3D12_Vk::GetStats()
 {
     TextureUploaderStats Stats;
-    Stats.NumPendingOperations = static_cast<Uint32>(m_pInternalData->GetNumPendingOperations());
+    Stats.NumPendingOperations = m_pInternalData->GetNumPendingOperations();
+    Stats.PendingCopySize      = m_pInternalData->GetPendingCopySize();
     return Stats;
 }
 
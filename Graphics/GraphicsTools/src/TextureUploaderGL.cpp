@@ -98,7 +98,7 @@ public:
         m_CopyScheduledSignal.Wait();
     }
 
-    bool DbgIsCopyScheduled() const { return m_CopyScheduledSignal.IsTriggered(); }
+    virtual bool IsCopyScheduled() const override final { return m_CopyScheduledSignal.IsTriggered(); }
 
     void SetDataPtr(Uint8* pBufferData)
     {
@@ -140,6 +140,9 @@ private:
     Threading::Signal      m_BufferMappedSignal;
     Threading::Signal      m_CopyScheduledSignal;
     RefCntAutoPtr<IBuffer> m_pStagingBuffer;
+    // Value of the uploader fence that is signaled when the GPU has finished
+    // copying the staging buffer contents. Only accessed by the render thread.
+    Uint64                 m_CopyFenceValue = 0;
     std::vector<Uint32>    m_SubresourceOffsets;
     std::vector<Uint32>    m_SubresourceStrides;
 };
@@ -155,10 +158,10 @@ struct TextureUploaderGL::InternalData
         m_PendingOperations.swap(m_InWorkOperations);
     }
 
-    void EnqueueCopy(UploadBufferGL* pUploadBuffer, ITexture* pDstTexture, Uint32 dstSlice, Uint32 dstMip)
+    void EnqueueCopy(UploadBufferGL* pUploadBuffer, ITexture* pDstTexture, Uint32 dstSlice, Uint32 dstMip, Uint32 dstX, Uint32 dstY)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTexture, dstSlice, dstMip);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTexture, dstSlice, dstMip, dstX, dstY);
     }
 
     void EnqueueMap(UploadBufferGL* pUploadBuffer)
@@ -179,18 +182,22 @@ struct TextureUploaderGL::InternalData
         RefCntAutoPtr<ITexture>       pDstTexture;
         Uint32                        DstSlice = 0;
         Uint32                        DstMip   = 0;
+        Uint32                        DstX     = 0;
+        Uint32                        DstY     = 0;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadBufferGL* pBuff) :
             operation    {op   },
             pUploadBuffer{pBuff}
         {}
-        PendingBufferOperation(Operation op, UploadBufferGL* pBuff, ITexture *pDstTex, Uint32 dstSlice, Uint32 dstMip) :
+        PendingBufferOperation(Operation op, UploadBufferGL* pBuff, ITexture *pDstTex, Uint32 dstSlice, Uint32 dstMip, Uint32 dstX, Uint32 dstY) :
             operation    {op      },
             pUploadBuffer{pBuff   },
             pDstTexture  {pDstTex },
             DstSlice     {dstSlice},
-            DstMip       {dstMip  }
+            DstMip       {dstMip  },
+            DstX         {dstX    },
+            DstY         {dstY    }
         {}
         // clang-format on
     };
@@ -203,6 +210,11 @@ struct TextureUploaderGL::InternalData
     std::vector<PendingBufferOperation> m_PendingOperations;
     std::vector<PendingBufferOperation> m_InWorkOperations;
 
+    // Fence that tracks the copies from the staging buffers, so that the buffers the GPU has finished
+    // reading can be mapped without orphaning. Only accessed by the render thread.
+    RefCntAutoPtr<IFence> m_pCopyFence;
+    Uint64                m_NextCopyFenceValue = 1;
+
     std::mutex                                                                      m_UploadBuffCacheMtx;
     std::unordered_map<UploadBufferDesc, std::deque<RefCntAutoPtr<UploadBufferGL>>> m_UploadBufferCache;
 };
@@ -271,8 +283,15 @@ void TextureUploaderGL::InternalData::Execute(IRenderDevice*          pDevice,
                 pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer->m_pStagingBuffer);
             }
 
+            // If the GPU has finished the previous copy from the buffer, map it without synchronization.
+            // Otherwise, discard the buffer contents to let the driver orphan the storage instead of stalling.
+            const bool IsBufferIdle =
+                pBuffer->m_CopyFenceValue != 0 &&
+                m_pCopyFence &&
+                m_pCopyFence->GetCompletedValue() >= pBuffer->m_CopyFenceValue;
+
             PVoid CpuAddress = nullptr;
-            pContext->MapBuffer(pBuffer->m_pStagingBuffer, MAP_WRITE, MAP_FLAG_DISCARD, CpuAddress);
+            pContext->MapBuffer(pBuffer->m_pStagingBuffer, MAP_WRITE, IsBufferIdle ? MAP_FLAG_NO_OVERWRITE : MAP_FLAG_DISCARD, CpuAddress);
             pBuffer->SetDataPtr(reinterpret_cast<Uint8*>(CpuAddress));
 
             pBuffer->SignalMapped();
@@ -294,12 +313,27 @@ void TextureUploaderGL::InternalData::Execute(IRenderDevice*          pDevice,
 
                     MipLevelProperties MipLevelProps = GetMipLevelProperties(TexDesc, OperationInfo.DstMip + Mip);
                     Box                DstBox;
-                    DstBox.MaxX = MipLevelProps.LogicalWidth;
-                    DstBox.MaxY = MipLevelProps.LogicalHeight;
+                    DstBox.MinX = OperationInfo.DstX >> Mip;
+                    DstBox.MinY = OperationInfo.DstY >> Mip;
+                    DstBox.MaxX = std::min(DstBox.MinX + std::max(UploadBuffDesc.Width >> Mip, 1u), MipLevelProps.LogicalWidth);
+                    DstBox.MaxY = std::min(DstBox.MinY + std::max(UploadBuffDesc.Height >> Mip, 1u), MipLevelProps.LogicalHeight);
                     pContext->UpdateTexture(OperationInfo.pDstTexture, OperationInfo.DstMip + Mip, OperationInfo.DstSlice + Slice, DstBox,
                                             SubResData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
                 }
             }
+
+            if (!m_pCopyFence)
+            {
+                FenceDesc Desc;
+                Desc.Name = "TextureUploaderGL copy fence";
+                pDevice->CreateFence(Desc, &m_pCopyFence);
+            }
+            if (m_pCopyFence)
+            {
+                pBuffer->m_CopyFenceValue = m_NextCopyFenceValue++;
+                pContext->EnqueueSignal(m_pCopyFence, pBuffer->m_CopyFenceValue);
+            }
+
             pBuffer->SignalCopyScheduled();
         }
         break;
@@ -354,11 +388,13 @@ void TextureUploaderGL::AllocateUploadBuffer(IDeviceContext*         pContext,
     *ppBuffer = pUploadBuffer.Detach();
 }
 
-void TextureUploaderGL::ScheduleGPUCopy(IDeviceContext* pContext,
-                                        ITexture*       pDstTexture,
-                                        Uint32          ArraySlice,
-                                        Uint32          MipLevel,
-                                        IUploadBuffer*  pUploadBuffer)
+void TextureUploaderGL::ScheduleGPUCopyToRegion(IDeviceContext* pContext,
+                                                ITexture*       pDstTexture,
+                                                Uint32          ArraySlice,
+                                                Uint32          MipLevel,
+                                                Uint32          DstX,
+                                                Uint32          DstY,
+                                                IUploadBuffer*  pUploadBuffer)
 {
     UploadBufferGL* pUploadBufferGL = ClassPtrCast<UploadBufferGL>(pUploadBuffer);
     if (pContext != nullptr)
@@ -370,21 +406,23 @@ void TextureUploaderGL::ScheduleGPUCopy(IDeviceContext* pContext,
                 pUploadBufferGL,
                 pDstTexture,
                 ArraySlice,
-                MipLevel //
+                MipLevel,
+                DstX,
+                DstY //
             };
         m_pInternalData->Execute(m_pDevice, pContext, CopyOp);
     }
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadBufferGL, pDstTexture, ArraySlice, MipLevel);
+        m_pInternalData->EnqueueCopy(pUploadBufferGL, pDstTexture, ArraySlice, MipLevel, DstX, DstY);
     }
 }
 
 void TextureUploaderGL::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
     UploadBufferGL* pUploadBufferGL = ClassPtrCast<UploadBufferGL>(pUploadBuffer);
-    VERIFY(pUploadBufferGL->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+    VERIFY(pUploadBufferGL->IsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
     pUploadBufferGL->Reset();
 
     std::lock_guard<std::mutex> CacheLock(m_pInternalData->m_UploadBuffCacheMtx);
@@ -27,6 +27,7 @@
 #include <mutex>
 #include <deque>
 #include <unordered_map>
+#include <algorithm>
 #include <webgpu/webgpu.h>
 
 #include "BufferWebGPU.h"
@@ -104,7 +105,7 @@ public:
         m_CopyScheduledSignal.Wait();
     }
 
-    bool DbgIsCopyScheduled() const
+    virtual bool IsCopyScheduled() const override final
     {
         return m_CopyScheduledSignal.IsTriggered();
     }
@@ -169,19 +170,22 @@ struct TextureUploaderWebGPU::InternalData
         RefCntAutoPtr<ITexture>           pDstTexture;
         Uint32                            DstSlice = 0;
         Uint32                            DstMip   = 0;
+        Uint32                            DstX     = 0;
+        Uint32                            DstY     = 0;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadBufferWebGPU* pBuff) :
             operation    {op   },
             pUploadBuffer{pBuff}
         {}
-        PendingBufferOperation(Operation op, UploadBufferWebGPU* pBuff, ITexture* pDstTex, Uint32 Slice, Uint32 Mip) :
+        PendingBufferOperation(Operation op, UploadBufferWebGPU* pBuff, ITexture* pDstTex, Uint32 Slice, Uint32 Mip, Uint32 X, Uint32 Y) :
             operation             {op          },
             pUploadBuffer         {pBuff       },
             pDstTexture           {pDstTex     },
             DstSlice              {Slice       },
-            DstMip                {Mip         }
-          
+            DstMip                {Mip         },
+            DstX                  {X           },
+            DstY                  {Y           }
         {}
         // clang-format on
     };
@@ -199,10 +203,10 @@ struct TextureUploaderWebGPU::InternalData
         m_PendingOperations.swap(m_InWorkOperations);
     }
 
-    void EnqueueCopy(UploadBufferWebGPU* pUploadBuffer, ITexture* pDstTexture, Uint32 Slice, Uint32 MipLevel)
+    void EnqueueCopy(UploadBufferWebGPU* pUploadBuffer, ITexture* pDstTexture, Uint32 Slice, Uint32 MipLevel, Uint32 DstX, Uint32 DstY)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTexture, Slice, MipLevel);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTexture, Slice, MipLevel, DstX, DstY);
     }
 
     void EnqueueMap(UploadBufferWebGPU* pUploadBuffer)
@@ -259,8 +263,10 @@ struct TextureUploaderWebGPU::InternalData
 
                         MipLevelProperties MipLevelProps = GetMipLevelProperties(TexDesc, OperationInfo.DstMip + Mip);
                         Box                DstBox;
-                        DstBox.MaxX = MipLevelProps.LogicalWidth;
-                        DstBox.MaxY = MipLevelProps.LogicalHeight;
+                        DstBox.MinX = OperationInfo.DstX >> Mip;
+                        DstBox.MinY = OperationInfo.DstY >> Mip;
+                        DstBox.MaxX = std::min(DstBox.MinX + std::max(UploadBuffDesc.Width >> Mip, 1u), MipLevelProps.LogicalWidth);
+                        DstBox.MaxY = std::min(DstBox.MinY + std::max(UploadBuffDesc.Height >> Mip, 1u), MipLevelProps.LogicalHeight);
                         pContext->UpdateTexture(OperationInfo.pDstTexture, OperationInfo.DstMip + Mip, OperationInfo.DstSlice + Slice, DstBox,
                                                 SubResData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
                     }
@@ -360,11 +366,13 @@ void TextureUploaderWebGPU::AllocateUploadBuffer(IDeviceContext*         pContex
     *ppBuffer = pUploadBuffer.Detach();
 }
 
-void TextureUploaderWebGPU::ScheduleGPUCopy(IDeviceContext* pContext,
-                                            ITexture*       pDstTexture,
-                                            Uint32          ArraySlice,
-                                            Uint32          MipLevel,
-                                            IUploadBuffer*  pUploadBuffer)
+void TextureUploaderWebGPU::ScheduleGPUCopyToRegion(IDeviceContext* pContext,
+                                                    ITexture*       pDstTexture,
+                                                    Uint32          ArraySlice,
+                                                    Uint32          MipLevel,
+                                                    Uint32          DstX,
+                                                    Uint32          DstY,
+                                                    IUploadBuffer*  pUploadBuffer)
 {
     UploadBufferWebGPU* pUploadBufferWebGPU = ClassPtrCast<UploadBufferWebGPU>(pUploadBuffer);
     if (pContext != nullptr)
@@ -376,21 +384,23 @@ void TextureUploaderWebGPU::ScheduleGPUCopy(IDeviceContext* pContext,
                 pUploadBufferWebGPU,
                 pDstTexture,
                 ArraySlice,
-                MipLevel //
+                MipLevel,
+                DstX,
+                DstY //
             };
         m_pInternalData->Execute(pContext, CopyOp);
     }
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadBufferWebGPU, pDstTexture, ArraySlice, MipLevel);
+        m_pInternalData->EnqueueCopy(pUploadBufferWebGPU, pDstTexture, ArraySlice, MipLevel, DstX, DstY);
     }
 }
 
 void TextureUploaderWebGPU::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
     UploadBufferWebGPU* pUploadBufferWebGPU = ClassPtrCast<UploadBufferWebGPU>(pUploadBuffer);
-    VERIFY(pUploadBufferWebGPU->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+    VERIFY(pUploadBufferWebGPU->IsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
     pUploadBufferWebGPU->Reset();
 
     std::lock_guard<std::mutex> CacheLock(m_pInternalData->m_UploadBuffCacheMtx);
@@ -0,0 +1,359 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+
+#include "TransientResourceAllocator.hpp"
+
+#include <algorithm>
+
+#include "GraphicsAccessories.hpp"
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+TransientResourceAllocator::TransientResourceAllocator(IRenderDevice* pDevice, const TransientResourceAllocatorCreateInfo& CI) :
+    m_pDevice{pDevice},
+    m_HeapSize{std::max(CI.HeapSize, Uint64{1})},
+    m_ImmediateContextMask{CI.ImmediateContextMask},
+    m_PlacementSupported{pDevice->GetAdapterInfo().Memory.PlacedResources != False},
+    m_PendingFrames{pDevice}
+{
+}
+
+TransientResourceAllocator::~TransientResourceAllocator()
+{
+    DEV_CHECK_ERR(m_PendingBarriers.empty(), "Transient resource allocator is destroyed with ", m_PendingBarriers.size(), " aliasing barrier(s) that have not been committed");
+}
+
+void TransientResourceAllocator::BeginFrame()
+{
+    if (!m_CurrentFrame.Heaps.empty() || !m_CurrentFrame.Committed.empty())
+    {
+        DEV_ERROR("BeginFrame() is called while the previous frame has not been ended with EndFrame()");
+        return;
+    }
+
+    // Take the heaps of the oldest frame completed by the GPU. If there is none, the frame
+    // starts with no heaps, and new heaps are created on demand.
+    m_CurrentFrame = m_PendingFrames.GetFirstCompleted();
+}
+
+StateTransitionDesc TransientResourceAllocator::GetAliasingBarrier(IDeviceObject* pBefore, IDeviceObject* pAfter)
+{
+    return StateTransitionDesc{pBefore, pAfter};
+}
+
+ResourceMemoryRequirements TransientResourceAllocator::GetMemoryRequirements(const TextureDesc& Desc) const
+{
+    return m_pDevice->GetTextureMemoryRequirements(Desc);
+}
+
+ResourceMemoryRequirements TransientResourceAllocator::GetMemoryRequirements(const BufferDesc& Desc) const
+{
+    return m_pDevice->GetBufferMemoryRequirements(Desc);
+}
+
+void TransientResourceAllocator::CreateResource(const TextureDesc& Desc, IDeviceMemory* pMemory, Uint64 Offset, Placement& P)
+{
+    if (pMemory != nullptr)
+        m_pDevice->CreatePlacedTexture(Desc, pMemory, Offset, &P.pTexture);
+    else
+        m_pDevice->CreateTexture(Desc, nullptr, &P.pTexture);
+}
+
+void TransientResourceAllocator::CreateResource(const BufferDesc& Desc, IDeviceMemory* pMemory, Uint64 Offset, Placement& P)
+{
+    if (pMemory != nullptr)
+        m_pDevice->CreatePlacedBuffer(Desc, pMemory, Offset, &P.pBuffer);
+    else
+        m_pDevice->CreateBuffer(Desc, nullptr, &P.pBuffer);
+}
+
+template <typename DescType>
+TransientResourceAllocator::Placement* TransientResourceAllocator::FindReusable(std::vector<Placement>& Placements, const DescType& Desc)
+{
+    for (Placement& P : Placements)
+    {
+        if (!P.InUse && P.Matches(Desc))
+        {
+            P.InUse = true;
+            ++m_Stats.NumReusedResources;
+            return &P;
+        }
+    }
+    return nullptr;
+}
+
+bool TransientResourceAllocator::FindRange(const Heap& H, const ResourceMemoryRequirements& MemReqs, Uint64& Offset) const
+{
+    const Uint64 Alignment = std::max(MemReqs.Alignment, Uint64{1});
+    VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") is not a power of two");
+
+    // First fit between the resources used by the current frame. Resources that are not
+    // in use may be evicted.
+    Uint64 Start = 0;
+    for (const Placement& P : H.Placements)
+    {
+        if (!P.InUse)
+            continue;
+
+        const Uint64 AlignedStart = AlignUp(Start, Alignment);
+        if (AlignedStart + MemReqs.Size <= P.Offset)
+        {
+            Offset = AlignedStart;
+            return true;
+        }
+        Start = std::max(Start, P.Offset + P.Size);
+    }
+
+    const Uint64 AlignedStart = AlignUp(Start, Alignment);
+    if (AlignedStart + MemReqs.Size <= H.Size)
+    {
+        Offset = AlignedStart;
+        return true;
+    }
+
+    return false;
+}
+
+bool TransientResourceAllocator::CreateHeap(Uint64 Size)
+{
+    DeviceMemoryCreateInfo MemCI;
+    MemCI.Desc.Name                 = "Transient resource heap";
+    MemCI.Desc.Type                 = DEVICE_MEMORY_TYPE_PLACED;
+    MemCI.Desc.PageSize             = Size;
+    MemCI.Desc.ImmediateContextMask = m_ImmediateContextMask;
+    MemCI.InitialSize               = Size;
+
+    RefCntAutoPtr<IDeviceMemory> pMemory;
+    m_pDevice->CreateDeviceMemory(MemCI, &pMemory);
+    if (!pMemory)
+    {
+        LOG_ERROR_MESSAGE("Failed to create transient resource heap of size ", Size);
+        return false;
+    }
+
+    Heap H;
+    H.pMemory = std::move(pMemory);
+    H.Size    = Size;
+    m_CurrentFrame.Heaps.emplace_back(std::move(H));
+
+    ++m_Stats.NumHeaps;
+    m_Stats.HeapMemorySize += Size;
+
+    return true;
+}
+
+template <typename DescType>
+TransientResourceAllocator::Placement* TransientResourceAllocator::AllocatePlaced(const DescType& Desc, const ResourceMemoryRequirements& MemReqs)
+{
+    std::vector<Heap>& Heaps = m_CurrentFrame.Heaps;
+
+    // Resource objects kept from the previous uses of the heaps need no memory and no barriers
+    for (Heap& H : Heaps)
+    {
+        if (Placement* pReused = FindReusable(H.Placements, Desc))
+            return pReused;
+    }
+
+    size_t HeapIdx = 0;
+    Uint64 Offset  = 0;
+    for (; HeapIdx < Heaps.size(); ++HeapIdx)
+    {
+        if (FindRange(Heaps[HeapIdx], MemReqs, Offset))
+            break;
+    }
+
+    if (HeapIdx == Heaps.size())
+    {
+        const Uint64 HeapSize = AlignUp(std::max(m_HeapSize, MemReqs.Size), std::max(MemReqs.Alignment, Uint64{1}));
+        if (!CreateHeap(HeapSize))
+            return nullptr;
+        Offset = 0;
+    }
+
+    Heap& H = Heaps[HeapIdx];
+
+    Placement NewP;
+    NewP.Offset = Offset;
+    NewP.Size   = MemReqs.Size;
+    NewP.InUse  = true;
+    CreateResource(Desc, H.pMemory, Offset, NewP);
+    if (NewP.GetResource() == nullptr)
+        return nullptr;
+    ++m_Stats.NumCreatedResources;
+
+    // Evict the resources that overlap the new one
+    const Uint64   End           = Offset + MemReqs.Size;
+    IDeviceObject* pBefore       = nullptr;
+    Uint32         NumOverlapped = 0;
+    for (auto it = H.Placements.begin(); it != H.Placements.end();)
+    {
+        if (it->Offset < End && Offset < it->Offset + it->Size)
+        {
+            VERIFY(!it->InUse, "Resources used by the current frame must never be evicted");
+            pBefore = it->GetResource();
+            m_BarrierResources.emplace_back(pBefore);
+            ++NumOverlapped;
+            it = H.Placements.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // The memory below the high-water mark has been used by other resources, possibly
+    // ones that have already been evicted.
+    if (NumOverlapped > 0 || Offset < H.HighWaterMark)
+    {
+        m_PendingBarriers.emplace_back(GetAliasingBarrier(NumOverlapped == 1 ? pBefore : nullptr, NewP.GetResource()));
+        ++m_Stats.NumAliasingBarriers;
+    }
+    H.HighWaterMark = std::max(H.HighWaterMark, End);
+
+    auto InsertPos = std::upper_bound(H.Placements.begin(), H.Placements.end(), Offset,
+                                      [](Uint64 Off, const Placement& P) { return Off < P.Offset; });
+    return &*H.Placements.insert(InsertPos, std::move(NewP));
+}
+
+template <typename DescType>
+TransientResourceAllocator::Placement* TransientResourceAllocator::AllocateCommitted(const DescType& Desc)
+{
+    if (Placement* pReused = FindReusable(m_CurrentFrame.Committed, Desc))
+        return pReused;
+
+    Placement NewP;
+    NewP.InUse = true;
+    CreateResource(Desc, nullptr, 0, NewP);
+    if (NewP.GetResource() == nullptr)
+        return nullptr;
+    ++m_Stats.NumCreatedResources;
+
+    m_CurrentFrame.Committed.emplace_back(std::move(NewP));
+    return &m_CurrentFrame.Committed.back();
+}
+
+RefCntAutoPtr<ITexture> TransientResourceAllocator::AllocateTexture(const TextureDesc& Desc)
+{
+    // Normalize the description so that it compares equal to the descriptions of the existing textures
+    TextureDesc TexDesc = Desc;
+    if (TexDesc.MipLevels == 0)
+    {
+        TexDesc.MipLevels = TexDesc.Is3D() ?
+            ComputeMipLevelsCount(TexDesc.Width, TexDesc.Height, TexDesc.Depth) :
+            ComputeMipLevelsCount(TexDesc.Width, TexDesc.Is1D() ? 1 : TexDesc.Height);
+    }
+
+    Placement* pPlacement = nullptr;
+    if (m_PlacementSupported && TexDesc.Usage == USAGE_DEFAULT)
+    {
+        const ResourceMemoryRequirements MemReqs = GetMemoryRequirements(TexDesc);
+        if (MemReqs.Size != 0)
+            pPlacement = AllocatePlaced(TexDesc, MemReqs);
+    }
+    if (pPlacement == nullptr)
+        pPlacement = AllocateCommitted(TexDesc);
+
+    return pPlacement != nullptr ? pPlacement->pTexture : RefCntAutoPtr<ITexture>{};
+}
+
+RefCntAutoPtr<IBuffer> TransientResourceAllocator::AllocateBuffer(const BufferDesc& Desc)
+{
+    Placement* pPlacement = nullptr;
+    if (m_PlacementSupported && Desc.Usage == USAGE_DEFAULT)
+    {
+        const ResourceMemoryRequirements MemReqs = GetMemoryRequirements(Desc);
+        if (MemReqs.Size != 0)
+            pPlacement = AllocatePlaced(Desc, MemReqs);
+    }
+    if (pPlacement == nullptr)
+        pPlacement = AllocateCommitted(Desc);
+
+    return pPlacement != nullptr ? pPlacement->pBuffer : RefCntAutoPtr<IBuffer>{};
+}
+
+void TransientResourceAllocator::Release(IDeviceObject* pResource)
+{
+    if (pResource == nullptr)
+        return;
+
+    auto ReleaseIn = [pResource](std::vector<Placement>& Placements) {
+        for (Placement& P : Placements)
+        {
+            if (P.GetResource() == pResource)
+            {
+                DEV_CHECK_ERR(P.InUse, "Resource '", pResource->GetDesc().Name, "' has already been released");
+                P.InUse = false;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (Heap& H : m_CurrentFrame.Heaps)
+    {
+        if (ReleaseIn(H.Placements))
+            return;
+    }
+    if (ReleaseIn(m_CurrentFrame.Committed))
+        return;
+
+    DEV_ERROR("Resource '", pResource->GetDesc().Name, "' was not allocated by this allocator in the current frame");
+}
+
+void TransientResourceAllocator::CommitAliasingBarriers(IDeviceContext* pCtx)
+{
+    if (m_PendingBarriers.empty())
+        return;
+
+    pCtx->TransitionResourceStates(static_cast<Uint32>(m_PendingBarriers.size()), m_PendingBarriers.data());
+    m_PendingBarriers.clear();
+    m_BarrierResources.clear();
+}
+
+void TransientResourceAllocator::EndFrame(IDeviceContext* pCtx)
+{
+    DEV_CHECK_ERR(m_PendingBarriers.empty(), m_PendingBarriers.size(), " aliasing barrier(s) have not been committed by the end of the frame");
+    m_PendingBarriers.clear();
+    m_BarrierResources.clear();
+
+    for (Heap& H : m_CurrentFrame.Heaps)
+    {
+        for (Placement& P : H.Placements)
+            P.InUse = false;
+    }
+    for (Placement& P : m_CurrentFrame.Committed)
+        P.InUse = false;
+
+    m_PendingFrames.Enqueue(pCtx, std::move(m_CurrentFrame));
+    m_CurrentFrame = {};
+}
+
+} // namespace Diligent
@@ -29,6 +29,8 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <map>
+#include <vector>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -83,7 +85,7 @@ public:
 
     virtual Uint32 GetStartVertex() const override final
     {
-        return m_StartVertex;
+        return m_StartVertex.load();
     }
 
     virtual Uint32 GetVertexCount() const override final
@@ -107,12 +109,24 @@ public:
         return m_pUserData;
     }
 
+    // Moves the allocation to the new region and returns the old one.
+    // Must only be called by the parent pool while its mutex is locked.
+    VariableSizeAllocationsManager::Allocation Relocate(VariableSizeAllocationsManager::Allocation&& NewRegion)
+    {
+        VariableSizeAllocationsManager::Allocation OldRegion = std::move(m_Region);
+        m_Region                                             = std::move(NewRegion);
+        m_StartVertex.store(m_Region.IsValid() ? static_cast<Uint32>(m_Region.UnalignedOffset) : 0);
+        return OldRegion;
+    }
+
 private:
     RefCntAutoPtr<VertexPoolImpl> m_pParentPool;
 
     VariableSizeAllocationsManager::Allocation m_Region;
 
-    const Uint32 m_StartVertex;
+    // The start vertex is changed by Defragment() and may be read by any thread
+    std::atomic<Uint32> m_StartVertex;
+
     const Uint32 m_VertexCount;
 
     RefCntAutoPtr<IObject> m_pUserData;
@@ -268,73 +282,82 @@ public:
 
         DEV_CHECK_ERR(*ppAllocation == nullptr, "Overwriting reference to existing object may cause memory leaks");
 
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
         VariableSizeAllocationsManager::Allocation Region;
-        {
-            std::lock_guard<std::mutex> Lock{m_MgrMtx};
 
+        {
+            Uint64 ActualCapacity = ~Uint64{0};
+            for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
             {
-                Uint64 ActualCapacity = ~Uint64{0};
-                for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
-                {
-                    const Uint64 BufferCapacity = m_BufferSizes[i].load() / m_Elements[i].Size;
-                    ActualCapacity              = std::min(ActualCapacity, BufferCapacity);
-                }
-
-                // After the resize, the actual buffer size may be larger due to alignment
-                // requirements (for sparse buffers, the size is aligned by the memory page size).
-                const VariableSizeAllocationsManager::OffsetType MgrSize = m_Mgr.GetMaxSize();
-                if (ActualCapacity > MgrSize)
-                {
-                    m_Mgr.Extend(StaticCast<size_t>(ActualCapacity - MgrSize));
-                    VERIFY_EXPR(m_Mgr.GetMaxSize() == ActualCapacity);
-                    m_MgrSize.store(m_Mgr.GetMaxSize());
-                    m_Desc.VertexCount = static_cast<Uint32>(ActualCapacity);
-                }
+                const Uint64 BufferCapacity = m_BufferSizes[i].load() / m_Elements[i].Size;
+                ActualCapacity              = std::min(ActualCapacity, BufferCapacity);
             }
 
-            Region = m_Mgr.Allocate(NumVertices, 1);
-
-            while (!Region.IsValid() && (m_MaxVertexCount == 0 || m_Mgr.GetMaxSize() < m_MaxVertexCount))
+            // After the resize, the actual buffer size may be larger due to alignment
+            // requirements (for sparse buffers, the size is aligned by the memory page size).
+            const VariableSizeAllocationsManager::OffsetType MgrSize = m_Mgr.GetMaxSize();
+            if (ActualCapacity > MgrSize)
             {
-                size_t ExtraSize = m_ExtraVertexCount != 0 ?
-                    std::max(m_ExtraVertexCount, NumVertices) :
-                    m_Mgr.GetMaxSize();
+                m_Mgr.Extend(StaticCast<size_t>(ActualCapacity - MgrSize));
+                VERIFY_EXPR(m_Mgr.GetMaxSize() == ActualCapacity);
+                m_MgrSize.store(m_Mgr.GetMaxSize());
+                m_Desc.VertexCount = static_cast<Uint32>(ActualCapacity);
+            }
+        }
 
-                if (m_MaxVertexCount != 0)
-                    ExtraSize = std::min(ExtraSize, size_t{m_MaxVertexCount} - m_Mgr.GetMaxSize());
+        Region = m_Mgr.Allocate(NumVertices, 1);
 
-                m_Mgr.Extend(ExtraSize);
-                m_MgrSize.store(m_Mgr.GetMaxSize());
-                m_Desc.VertexCount = static_cast<Uint32>(m_Mgr.GetMaxSize());
+        while (!Region.IsValid() && (m_MaxVertexCount == 0 || m_Mgr.GetMaxSize() < m_MaxVertexCount))
+        {
+            size_t ExtraSize = m_ExtraVertexCount != 0 ?
+                std::max(m_ExtraVertexCount, NumVertices) :
+                m_Mgr.GetMaxSize();
 
-                Region = m_Mgr.Allocate(NumVertices, 1);
-            }
+            if (m_MaxVertexCount != 0)
+                ExtraSize = std::min(ExtraSize, size_t{m_MaxVertexCount} - m_Mgr.GetMaxSize());
 
-            UpdateUsageStats();
+            m_Mgr.Extend(ExtraSize);
+            m_MgrSize.store(m_Mgr.GetMaxSize());
+            m_Desc.VertexCount = static_cast<Uint32>(m_Mgr.GetMaxSize());
+
+            Region = m_Mgr.Allocate(NumVertices, 1);
         }
 
+        UpdateUsageStats();
+
         if (Region.IsValid())
         {
+            const VariableSizeAllocationsManager::OffsetType StartVertex = Region.UnalignedOffset;
             // clang-format off
             VertexPoolAllocationImpl* pSuballocation{
                 NEW_RC_OBJ(m_AllocationObjAllocator, "VertexPoolAllocationImpl instance", VertexPoolAllocationImpl)
                 (
                     this,
-                    static_cast<Uint32>(Region.UnalignedOffset),
+                    static_cast<Uint32>(StartVertex),
                     NumVertices,
                     std::move(Region)
                 )
             };
             // clang-format on
 
+            // Keep track of live allocations so that Defragment() can move them
+            m_Allocations.emplace(StartVertex, pSuballocation);
+
             pSuballocation->QueryInterface(IID_VertexPoolAllocation, reinterpret_cast<IObject**>(ppAllocation));
             m_AllocationCount.fetch_add(1);
         }
     }
 
-    void Free(VariableSizeAllocationsManager::Allocation&& Region)
+    void Free(VertexPoolAllocationImpl& Allocation)
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        // NB: the region may have been changed by Defragment(), so it must be read while the mutex is locked
+        VariableSizeAllocationsManager::Allocation Region = Allocation.Relocate(VariableSizeAllocationsManager::Allocation::InvalidAllocation());
+        VERIFY_EXPR(m_Allocations.find(Region.UnalignedOffset) != m_Allocations.end() &&
+                    m_Allocations.find(Region.UnalignedOffset)->second == &Allocation);
+        m_Allocations.erase(Region.UnalignedOffset);
         m_Mgr.Free(std::move(Region));
         m_AllocationCount.fetch_add(-1);
         UpdateUsageStats();
@@ -342,12 +365,148 @@ public:
 
     virtual Uint32 GetVersion() const override final
     {
-        Uint32 Version = 0;
+        Uint32 Version = m_DefragmentationVersion.load();
         for (const std::unique_ptr<DynamicBuffer>& Buffer : m_Buffers)
             Version += Buffer->GetVersion();
         return Version;
     }
 
+    virtual Uint32 Defragment(IRenderDevice* pDevice, IDeviceContext* pContext, Uint32 MaxBytesPerFrame) override final
+    {
+        if (pContext == nullptr)
+        {
+            UNEXPECTED("pContext must not be null");
+            return 0;
+        }
+
+        Uint32 VertexSize = 0;
+        for (const VertexPoolElementDesc& Elem : m_Elements)
+        {
+            if (Elem.Usage != USAGE_DEFAULT && Elem.Usage != USAGE_SPARSE)
+            {
+                // Dynamic and staging buffers can't be copy destinations
+                return 0;
+            }
+            VertexSize += Elem.Size;
+        }
+
+        const Uint32 MaxVerticesToMove = MaxBytesPerFrame / VertexSize;
+        if (MaxVerticesToMove == 0)
+            return 0;
+
+        m_DefragmentationBuffers.resize(m_Buffers.size());
+        for (Uint32 i = 0; i < m_Buffers.size(); ++i)
+        {
+            m_DefragmentationBuffers[i] = Update(i, pDevice, pContext);
+            if (m_DefragmentationBuffers[i] == nullptr)
+                return 0;
+        }
+
+        // Data is copied through the scratch buffer because source and destination ranges
+        // of the same buffer would require conflicting resource states.
+        const Uint32 ScratchSize = MaxVerticesToMove * VertexSize;
+        if (!m_pScratchBuffer || m_pScratchBuffer->GetDesc().Size < ScratchSize)
+        {
+            if (pDevice == nullptr)
+                return 0;
+
+            const std::string ScratchName = m_Name + " - defragmentation scratch";
+
+            BufferDesc ScratchDesc;
+            ScratchDesc.Name      = ScratchName.c_str();
+            ScratchDesc.Size      = ScratchSize;
+            ScratchDesc.Usage     = USAGE_DEFAULT;
+            ScratchDesc.BindFlags = BIND_NONE;
+
+            m_pScratchBuffer.Release();
+            pDevice->CreateBuffer(ScratchDesc, nullptr, &m_pScratchBuffer);
+            if (!m_pScratchBuffer)
+            {
+                LOG_ERROR_MESSAGE("Failed to create defragmentation scratch buffer for '", m_Name, "'");
+                return 0;
+            }
+        }
+
+        m_DefragmentationMoves.clear();
+        Uint32 VerticesMoved = 0;
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+            // Move allocations from the end of the pool to the lowest free ranges
+            auto it = m_Allocations.end();
+            while (it != m_Allocations.begin() && VerticesMoved < MaxVerticesToMove)
+            {
+                --it;
+                // All allocations below the first free block are already tightly packed
+                if (it->first < m_Mgr.GetFirstFreeBlockOffset())
+                    break;
+
+                VertexPoolAllocationImpl* const pAllocation = it->second;
+
+                const Uint32 VertexCount = pAllocation->GetVertexCount();
+                if (VertexCount > MaxVerticesToMove - VerticesMoved)
+                    continue;
+
+                VariableSizeAllocationsManager::Allocation NewRegion = m_Mgr.AllocateBelow(VertexCount, 1, it->first);
+                if (!NewRegion.IsValid())
+                    continue;
+
+                const VariableSizeAllocationsManager::OffsetType NewStartVertex = NewRegion.UnalignedOffset;
+
+                m_DefragmentationMoves.push_back({pAllocation->GetStartVertex(), static_cast<Uint32>(NewStartVertex), VertexCount, VerticesMoved});
+                m_Mgr.Free(pAllocation->Relocate(std::move(NewRegion)));
+                VerticesMoved += VertexCount;
+
+                // NB: erase() returns the iterator to the next (higher) element, so the next
+                //     decrement in the loop moves to the element below the erased one.
+                it = m_Allocations.erase(it);
+                m_RelocatedAllocations.emplace_back(NewStartVertex, pAllocation);
+            }
+
+            // Insert relocated allocations after the loop so that they are not moved again
+            m_Allocations.insert(m_RelocatedAllocations.begin(), m_RelocatedAllocations.end());
+            m_RelocatedAllocations.clear();
+
+            UpdateUsageStats();
+        }
+
+        if (m_DefragmentationMoves.empty())
+            return 0;
+
+        // Scratch buffer layout: [element 0 of all moves][element 1 of all moves]...
+        // All source ranges are copied first because destination of one move may
+        // overlap with the source of another move.
+        Uint32 ScratchOffset = 0;
+        for (Uint32 i = 0; i < m_Buffers.size(); ++i)
+        {
+            const Uint32 ElemSize = m_Elements[i].Size;
+            for (const DefragmentationMove& Move : m_DefragmentationMoves)
+            {
+                pContext->CopyBuffer(m_DefragmentationBuffers[i], Uint64{Move.SrcVertex} * ElemSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                     m_pScratchBuffer, ScratchOffset + Uint64{Move.ScratchVertex} * ElemSize, Uint64{Move.VertexCount} * ElemSize,
+                                     RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+            ScratchOffset += VerticesMoved * ElemSize;
+        }
+
+        ScratchOffset = 0;
+        for (Uint32 i = 0; i < m_Buffers.size(); ++i)
+        {
+            const Uint32 ElemSize = m_Elements[i].Size;
+            for (const DefragmentationMove& Move : m_DefragmentationMoves)
+            {
+                pContext->CopyBuffer(m_pScratchBuffer, ScratchOffset + Uint64{Move.ScratchVertex} * ElemSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                     m_DefragmentationBuffers[i], Uint64{Move.DstVertex} * ElemSize, Uint64{Move.VertexCount} * ElemSize,
+                                     RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+            ScratchOffset += VerticesMoved * ElemSize;
+        }
+
+        m_DefragmentationVersion.fetch_add(1);
+
+        return VerticesMoved * VertexSize;
+    }
+
     virtual const VertexPoolDesc& GetDesc() const override final
     {
         return m_Desc;
@@ -406,12 +565,28 @@ private:
     std::atomic<Uint64> m_TotalVertexCount{0};
 
     FixedBlockMemoryAllocator m_AllocationObjAllocator;
+
+    // Live allocations ordered by their start vertex, protected by m_MgrMtx
+    std::map<VariableSizeAllocationsManager::OffsetType, VertexPoolAllocationImpl*> m_Allocations;
+
+    struct DefragmentationMove
+    {
+        Uint32 SrcVertex;
+        Uint32 DstVertex;
+        Uint32 VertexCount;
+        Uint32 ScratchVertex;
+    };
+    std::vector<DefragmentationMove>                                                              m_DefragmentationMoves;
+    std::vector<std::pair<VariableSizeAllocationsManager::OffsetType, VertexPoolAllocationImpl*>> m_RelocatedAllocations;
+    std::vector<IBuffer*>                                                                         m_DefragmentationBuffers;
+    RefCntAutoPtr<IBuffer>                                                                        m_pScratchBuffer;
+    std::atomic<Uint32>                                                                           m_DefragmentationVersion{0};
 };
 
 
 VertexPoolAllocationImpl::~VertexPoolAllocationImpl()
 {
-    m_pParentPool->Free(std::move(m_Region));
+    m_pParentPool->Free(*this);
 }
 
 IVertexPool* VertexPoolAllocationImpl::GetPool()
@@ -32,6 +32,8 @@
 #include <unordered_map>
 #include <vector>
 #include <array>
+#include <memory>
+#include <mutex>
 
 #include "HLSL2GLSLConverter.h"
 #include "ObjectBase.hpp"
@@ -40,6 +42,7 @@
 #include "Constants.h"
 #include "HLSLTokenizer.hpp"
 #include "STDAllocator.hpp"
+#include "LRUCache.hpp"
 
 namespace Diligent
 {
@@ -223,6 +226,33 @@ private:
     using TokenInfo     = Parsing::HLSLTokenInfo;
     using TokenListType = Parsing::HLSLTokenizer::TokenListType;
 
+    // Source code state after the conversion steps that do not depend on the entry point
+    struct ParsedSource
+    {
+        TokenListType Tokens;
+
+        // Names and positions in the token list of struct definitions and
+        // global-scope preprocessor macro definitions
+        std::vector<std::pair<String, size_t>> StructDefinitions;
+        std::vector<std::pair<String, size_t>> PreprocessorDefinitions;
+
+        // Matrix packing, which may be changed by #pragma pack_matrix
+        bool UseRowMajorMatrices = false;
+    };
+
+    // Tokenized source code shared by all conversion streams created for the same source.
+    // Entry-point independent conversion steps are performed once for every matrix packing mode.
+    struct TokenizedSource
+    {
+        TokenListType Tokens;
+
+        std::mutex                                         ParsedSourcesMtx;
+        std::array<std::shared_ptr<const ParsedSource>, 2> ParsedSources; // Indexed by UseRowMajorMatrices
+    };
+
+    // Returns the tokenized source from the cache, or tokenizes it if the source has not been seen before.
+    std::shared_ptr<TokenizedSource> GetTokenizedSource(const String& Source) const;
+
     class ConversionStream : public ObjectBase<IHLSL2GLSLConversionStream>
     {
     public:
@@ -241,15 +271,12 @@ private:
         /// \param [in] HLSLSource    - HLSL source code. If this parameter is null, the source will be loaded from
         ///                             the input stream factory using InputFileName.
         /// \param [in] NumSymbols    - Number of symbols in the HLSLSource string
-        /// \param [in] bPreserveTokens - Whether to preserve original tokens. This must be set to true if the stream
-        ///                               will be used for multiple conversions.
         ConversionStream(IReferenceCounters*              pRefCounters,
                          const HLSL2GLSLConverterImpl&    Converter,
                          const char*                      InputFileName,
                          IShaderSourceInputStreamFactory* pInputStreamFactory,
                          const Char*                      HLSLSource,
-                         size_t                           NumSymbols,
-                         bool                             bPreserveTokens);
+                         size_t                           NumSymbols);
 
         StringAlloc Convert(const Char* EntryPoint,
                             SHADER_TYPE ShaderType,
@@ -279,6 +306,15 @@ private:
 
         void ParseGlobalPreprocessorDefines();
 
+        // Initializes m_Tokens and the struct and macro definition tables from the parsed
+        // source for the given matrix packing, parsing the source if necessary.
+        void LoadParsedSource(bool UseRowMajorMatrices);
+
+        // Performs the conversion steps that do not depend on the entry point:
+        // processes constant and structured buffers, numeric constants, sampler
+        // registers, flow control attributes, and registers structs and macros.
+        void ProcessEntryPointIndependentConstructs();
+
         void ProcessShaderDeclaration(TokenListType::iterator EntryPointToken, SHADER_TYPE ShaderType);
 
         void ProcessObjectMethods(const TokenListType::iterator& ScopeStart, const TokenListType::iterator& ScopeEnd);
@@ -460,7 +496,10 @@ private:
 
         StringAlloc BuildGLSLSource();
 
-        // Tokenized source code
+        // Tokenized source code shared with other streams. It is never modified.
+        std::shared_ptr<TokenizedSource> m_pSource;
+
+        // Tokens being converted
         TokenListType m_Tokens;
 
         // List of tokens defining structs
@@ -477,9 +516,8 @@ private:
         //           defined as function arguments
         std::vector<ObjectsTypeHashType> m_Objects;
 
-        const bool m_bPreserveTokens;
-        bool       m_bUseInOutLocationQualifiers = true;
-        bool       m_bUseRowMajorMatrices        = false;
+        bool m_bUseInOutLocationQualifiers = true;
+        bool m_bUseRowMajorMatrices        = false;
 
         const HLSL2GLSLConverterImpl& m_Converter;
 
@@ -490,6 +528,11 @@ private:
 
     Parsing::HLSLTokenizer m_HLSLTokenizer;
 
+    // Tokenized sources keyed by the source code with all includes inserted.
+    // Shader permutations only differ by the macros that are added to the converted
+    // GLSL source, so they all share the same tokenized HLSL source.
+    mutable LRUCache<String, std::shared_ptr<TokenizedSource>> m_TokenizedSourceCache;
+
     // Set of all GLSL image types (image1D, uimage1D, iimage1D, image2D, ... )
     std::unordered_set<HashMapStringKey> m_ImageTypes;
 
@@ -380,6 +380,7 @@
 #include "ParsingTools.hpp"
 #include "EngineMemory.h"
 #include "GLSLParsingTools.hpp"
+#include "ShaderToolsCommon.hpp"
 
 using namespace std;
 
@@ -400,7 +401,11 @@ const HLSL2GLSLConverterImpl& HLSL2GLSLConverterImpl::GetInstance()
     return Converter;
 }
 
-HLSL2GLSLConverterImpl::HLSL2GLSLConverterImpl()
+// The cache size is estimated from the source length, and tokens take several times more memory
+static constexpr size_t TokenizedSourceCacheSize = size_t{16} << 20u;
+
+HLSL2GLSLConverterImpl::HLSL2GLSLConverterImpl() :
+    m_TokenizedSourceCache{TokenizedSourceCacheSize}
 {
     // Prepare texture function stubs
     //                          sampler  usampler  isampler sampler*Shadow
@@ -790,12 +795,9 @@ void HLSL2GLSLConverterImpl::ConversionStream::InsertIncludes(String& GLSLSource
             // replace the text with the file content
             if (It.second)
             {
-                RefCntAutoPtr<IFileStream> pIncludeDataStream;
-                pSourceStreamFactory->CreateInputStream(IncludeName.c_str(), &pIncludeDataStream);
-                if (!pIncludeDataStream)
+                RefCntAutoPtr<IDataBlob> pIncludeData = LoadShaderSourceFile(pSourceStreamFactory, IncludeName.c_str());
+                if (!pIncludeData)
                     LOG_ERROR_AND_THROW("Failed to open include file ", IncludeName);
-                auto pIncludeData = DataBlobImpl::Create();
-                pIncludeDataStream->ReadBlob(pIncludeData);
 
                 // Get include text
                 const Char* IncludeText = pIncludeData->GetConstDataPtr<Char>();
@@ -4423,13 +4425,11 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
                                                            const char*                      InputFileName,
                                                            IShaderSourceInputStreamFactory* pInputStreamFactory,
                                                            const Char*                      HLSLSource,
-                                                           size_t                           NumSymbols,
-                                                           bool                             bPreserveTokens) :
+                                                           size_t                           NumSymbols) :
     // clang-format off
-    TBase            {pRefCounters   },
-    m_bPreserveTokens{bPreserveTokens},
-    m_Converter      {Converter      },
-    m_InputFileName  {InputFileName != nullptr ? InputFileName : "<Unknown>"}
+    TBase          {pRefCounters},
+    m_Converter    {Converter   },
+    m_InputFileName{InputFileName != nullptr ? InputFileName : "<Unknown>"}
 // clang-format on
 {
     RefCntAutoPtr<IDataBlob> pFileData;
@@ -4456,7 +4456,18 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
 
     InsertIncludes(Source, pInputStreamFactory);
 
-    m_Tokens = m_Converter.m_HLSLTokenizer.Tokenize(Source);
+    m_pSource = m_Converter.GetTokenizedSource(Source);
+}
+
+std::shared_ptr<HLSL2GLSLConverterImpl::TokenizedSource> HLSL2GLSLConverterImpl::GetTokenizedSource(const String& Source) const
+{
+    return m_TokenizedSourceCache.Get(
+        Source,
+        [&](std::shared_ptr<TokenizedSource>& pSource, size_t& Size) {
+            pSource         = std::make_shared<TokenizedSource>();
+            pSource->Tokens = m_HLSLTokenizer.Tokenize(Source);
+            Size            = Source.length();
+        });
 }
 
 
@@ -4466,7 +4477,7 @@ StringAlloc HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
     {
         try
         {
-            ConversionStream Stream(nullptr, *this, Attribs.InputFileName, Attribs.pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols, false);
+            ConversionStream Stream(nullptr, *this, Attribs.InputFileName, Attribs.pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols);
             return Stream.Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions,
                                   Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers,
                                   Attribs.UseRowMajorMatrices);
@@ -4512,7 +4523,7 @@ void HLSL2GLSLConverterImpl::CreateStream(const Char*                      Input
 {
     try
     {
-        auto* pStream = NEW_RC_OBJ(GetRawAllocator(), "HLSL2GLSLConverterImpl::ConversionStream object instance", ConversionStream)(*this, InputFileName, pSourceStreamFactory, HLSLSource, NumSymbols, true);
+        auto* pStream = NEW_RC_OBJ(GetRawAllocator(), "HLSL2GLSLConverterImpl::ConversionStream object instance", ConversionStream)(*this, InputFileName, pSourceStreamFactory, HLSLSource, NumSymbols);
         pStream->QueryInterface(IID_HLSL2GLSLConversionStream, reinterpret_cast<IObject**>(ppStream));
     }
     catch (std::runtime_error&)
@@ -4521,41 +4532,9 @@ void HLSL2GLSLConverterImpl::CreateStream(const Char*                      Input
     }
 }
 
-void HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
-                                                       SHADER_TYPE ShaderType,
-                                                       bool        IncludeDefintions,
-                                                       const char* SamplerSuffix,
-                                                       bool        UseInOutLocationQualifiers,
-                                                       bool        UseRowMajorMatrices,
-                                                       IDataBlob** ppGLSLSource)
-{
-    try
-    {
-        StringAlloc         GLSLSource = Convert(EntryPoint, ShaderType, IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers, UseRowMajorMatrices);
-        StringDataBlobImpl* pDataBlob  = MakeNewRCObj<StringDataBlobImpl>()(std::move(GLSLSource));
-        pDataBlob->QueryInterface(IID_DataBlob, reinterpret_cast<IObject**>(ppGLSLSource));
-    }
-    catch (std::runtime_error&)
-    {
-        *ppGLSLSource = nullptr;
-    }
-}
-
-StringAlloc HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
-                                                              SHADER_TYPE ShaderType,
-                                                              bool        IncludeDefintions,
-                                                              const char* SamplerSuffix,
-                                                              bool        UseInOutLocationQualifiers,
-                                                              bool        UseRowMajorMatrices)
+void HLSL2GLSLConverterImpl::ConversionStream::ProcessEntryPointIndependentConstructs()
 {
-    m_bUseInOutLocationQualifiers = UseInOutLocationQualifiers;
-    m_bUseRowMajorMatrices        = UseRowMajorMatrices;
-    TokenListType TokensCopy(m_bPreserveTokens ? m_Tokens : TokenListType());
-
     Uint32 ShaderStorageBlockBinding = 0;
-    Uint32 ImageBinding              = 0;
-
-    std::unordered_map<String, bool> SamplersHash;
 
     auto Token = m_Tokens.begin();
     // Process constant buffers, fix floating point constants,
@@ -4607,6 +4586,106 @@ StringAlloc HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryP
     }
 
     ParseGlobalPreprocessorDefines();
+}
+
+void HLSL2GLSLConverterImpl::ConversionStream::LoadParsedSource(bool UseRowMajorMatrices)
+{
+    m_StructDefinitions.clear();
+    m_PreprocessorDefinitions.clear();
+    m_Objects.clear();
+
+    std::shared_ptr<const ParsedSource>& pSharedParsedSource = m_pSource->ParsedSources[UseRowMajorMatrices ? 1 : 0];
+
+    std::shared_ptr<const ParsedSource> pParsedSource;
+    {
+        std::lock_guard<std::mutex> Lock{m_pSource->ParsedSourcesMtx};
+        pParsedSource = pSharedParsedSource;
+    }
+
+    if (pParsedSource)
+    {
+        m_Tokens               = pParsedSource->Tokens;
+        m_bUseRowMajorMatrices = pParsedSource->UseRowMajorMatrices;
+
+        std::vector<TokenListType::iterator> TokenIterators;
+        TokenIterators.reserve(m_Tokens.size());
+        for (auto Token = m_Tokens.begin(); Token != m_Tokens.end(); ++Token)
+            TokenIterators.push_back(Token);
+
+        for (const auto& StructDef : pParsedSource->StructDefinitions)
+            m_StructDefinitions.emplace(HashMapStringKey{StructDef.first}, TokenIterators[StructDef.second]);
+        for (const auto& MacroDef : pParsedSource->PreprocessorDefinitions)
+            m_PreprocessorDefinitions.emplace(HashMapStringKey{MacroDef.first}, TokenIterators[MacroDef.second]);
+        return;
+    }
+
+    m_Tokens               = m_pSource->Tokens;
+    m_bUseRowMajorMatrices = UseRowMajorMatrices;
+    ProcessEntryPointIndependentConstructs();
+
+    // Save the state so that subsequent conversions of the same source can start from it
+    auto pNewParsedSource                 = std::make_shared<ParsedSource>();
+    pNewParsedSource->Tokens              = m_Tokens;
+    pNewParsedSource->UseRowMajorMatrices = m_bUseRowMajorMatrices;
+
+    std::unordered_map<const TokenInfo*, size_t> DefinitionPositions;
+    for (const auto& StructDef : m_StructDefinitions)
+        DefinitionPositions.emplace(&*StructDef.second, 0);
+    for (const auto& MacroDef : m_PreprocessorDefinitions)
+        DefinitionPositions.emplace(&*MacroDef.second, 0);
+
+    size_t TokenPos = 0;
+    for (const TokenInfo& Token : m_Tokens)
+    {
+        auto it = DefinitionPositions.find(&Token);
+        if (it != DefinitionPositions.end())
+            it->second = TokenPos;
+        ++TokenPos;
+    }
+
+    for (const auto& StructDef : m_StructDefinitions)
+        pNewParsedSource->StructDefinitions.emplace_back(StructDef.first.GetStr(), DefinitionPositions[&*StructDef.second]);
+    for (const auto& MacroDef : m_PreprocessorDefinitions)
+        pNewParsedSource->PreprocessorDefinitions.emplace_back(MacroDef.first.GetStr(), DefinitionPositions[&*MacroDef.second]);
+
+    std::lock_guard<std::mutex> Lock{m_pSource->ParsedSourcesMtx};
+    if (!pSharedParsedSource)
+        pSharedParsedSource = std::move(pNewParsedSource);
+}
+
+void HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
+                                                       SHADER_TYPE ShaderType,
+                                                       bool        IncludeDefintions,
+                                                       const char* SamplerSuffix,
+                                                       bool        UseInOutLocationQualifiers,
+                                                       bool        UseRowMajorMatrices,
+                                                       IDataBlob** ppGLSLSource)
+{
+    try
+    {
+        StringAlloc         GLSLSource = Convert(EntryPoint, ShaderType, IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers, UseRowMajorMatrices);
+        StringDataBlobImpl* pDataBlob  = MakeNewRCObj<StringDataBlobImpl>()(std::move(GLSLSource));
+        pDataBlob->QueryInterface(IID_DataBlob, reinterpret_cast<IObject**>(ppGLSLSource));
+    }
+    catch (std::runtime_error&)
+    {
+        *ppGLSLSource = nullptr;
+    }
+}
+
+StringAlloc HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
+                                                              SHADER_TYPE ShaderType,
+                                                              bool        IncludeDefintions,
+                                                              const char* SamplerSuffix,
+                                                              bool        UseInOutLocationQualifiers,
+                                                              bool        UseRowMajorMatrices)
+{
+    m_bUseInOutLocationQualifiers = UseInOutLocationQualifiers;
+    LoadParsedSource(UseRowMajorMatrices);
+
+    Uint32 ImageBinding = 0;
+
+    auto Token = m_Tokens.begin();
 
     auto ShaderEntryPointToken = m_Tokens.end();
     // Process textures and search for the shader entry point.
@@ -4790,13 +4869,10 @@ StringAlloc HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryP
 
     StringAlloc GLSLSource = BuildGLSLSource();
 
-    if (m_bPreserveTokens)
-    {
-        m_Tokens.swap(TokensCopy);
-        m_StructDefinitions.clear();
-        m_PreprocessorDefinitions.clear();
-        m_Objects.clear();
-    }
+    m_Tokens.clear();
+    m_StructDefinitions.clear();
+    m_PreprocessorDefinitions.clear();
+    m_Objects.clear();
 
     if (IncludeDefintions)
         GLSLSource.insert(0, g_GLSLDefinitions);
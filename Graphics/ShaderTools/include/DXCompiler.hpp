@@ -119,7 +119,10 @@ struct IDXCompiler
 // Use this function to load the DX Compiler library.
 // pLibraryName is an optional path to the library. If not provided, default
 // path is used.
-std::unique_ptr<IDXCompiler> CreateDXCompiler(DXCompilerTarget Target, Uint32 APIVersion, const char* pLibraryName);
+// pCachePath is an optional directory where compiled bytecode is stored between runs.
+// If LoadAsync is true, the library is loaded on a background thread right away instead of
+// on first use; methods that need the library block until the loading is complete.
+std::unique_ptr<IDXCompiler> CreateDXCompiler(DXCompilerTarget Target, Uint32 APIVersion, const char* pLibraryName, const char* pCachePath = nullptr, bool LoadAsync = false);
 
 bool IsDXILBytecode(const void* pBytecode, size_t Size);
 
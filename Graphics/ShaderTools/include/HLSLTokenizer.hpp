@@ -26,12 +26,11 @@
 
 #pragma once
 
-#include <unordered_map>
 #include <list>
+#include <vector>
 
 #include "ParsingTools.hpp"
 #include "HLSLKeywords.h"
-#include "HashUtils.hpp"
 
 namespace Diligent
 {
@@ -74,6 +73,20 @@ enum class HLSLTokenType
 };
 // clang-format on
 
+inline bool IsBuiltInType(HLSLTokenType Type)
+{
+    static_assert(static_cast<int>(HLSLTokenType::kw_bool) == 1 && static_cast<int>(HLSLTokenType::kw_void) == 191,
+                  "If you updated built-in types, double check that all types are defined between bool and void");
+    return Type >= HLSLTokenType::kw_bool && Type <= HLSLTokenType::kw_void;
+}
+
+inline bool IsFlowControl(HLSLTokenType Type)
+{
+    static_assert(static_cast<int>(HLSLTokenType::kw_break) == 192 && static_cast<int>(HLSLTokenType::kw_while) == 202,
+                  "If you updated control flow keywords, double check that all keywords are defined between break and while");
+    return Type >= HLSLTokenType::kw_break && Type <= HLSLTokenType::kw_while;
+}
+
 struct HLSLTokenInfo
 {
     using TokenType = HLSLTokenType;
@@ -107,41 +120,33 @@ struct HLSLTokenInfo
         return Literal == Str;
     }
 
-    bool CompareLiteral(const std::string::const_iterator& Start,
-                        const std::string::const_iterator& End)
+    bool CompareLiteral(const char* Start, const char* End)
     {
         const size_t Len = End - Start;
-        if (strncmp(Literal.c_str(), &*Start, Len) != 0)
-            return false;
-        return Literal.length() == Len;
+        return Literal.length() == Len && strncmp(Literal.c_str(), Start, Len) == 0;
     }
 
-    void ExtendLiteral(const std::string::const_iterator& Start,
-                       const std::string::const_iterator& End)
+    void ExtendLiteral(const char* Start, const char* End)
     {
         Literal.append(Start, End);
     }
 
     bool IsBuiltInType() const
     {
-        static_assert(static_cast<int>(TokenType::kw_bool) == 1 && static_cast<int>(TokenType::kw_void) == 191,
-                      "If you updated built-in types, double check that all types are defined between bool and void");
-        return Type >= TokenType::kw_bool && Type <= TokenType::kw_void;
+        return Parsing::IsBuiltInType(Type);
     }
 
     bool IsFlowControl() const
     {
-        static_assert(static_cast<int>(TokenType::kw_break) == 192 && static_cast<int>(TokenType::kw_while) == 202,
-                      "If you updated control flow keywords, double check that all keywords are defined between break and while");
-        return Type >= TokenType::kw_break && Type <= TokenType::kw_while;
+        return Parsing::IsFlowControl(Type);
     }
 
-    static HLSLTokenInfo Create(TokenType                          _Type,
-                                const std::string::const_iterator& DelimStart,
-                                const std::string::const_iterator& DelimEnd,
-                                const std::string::const_iterator& LiteralStart,
-                                const std::string::const_iterator& LiteralEnd,
-                                size_t                             Idx)
+    static HLSLTokenInfo Create(TokenType   _Type,
+                                const char* DelimStart,
+                                const char* DelimEnd,
+                                const char* LiteralStart,
+                                const char* LiteralEnd,
+                                size_t      Idx)
     {
         return HLSLTokenInfo{_Type, std::string{LiteralStart, LiteralEnd}, std::string{DelimStart, DelimEnd}, Idx};
     }
@@ -175,24 +180,135 @@ struct HLSLTokenInfo
     }
 };
 
+/// HLSL token that references the source string instead of holding copies of
+/// its literal and delimiter. The source string must outlive the token.
+struct HLSLTokenView
+{
+    using TokenType = HLSLTokenType;
+
+    TokenType   Type = TokenType::Undefined;
+    const char* LiteralStart   = nullptr;
+    const char* LiteralEnd     = nullptr;
+    const char* DelimiterStart = nullptr;
+    const char* DelimiterEnd   = nullptr;
+    size_t      Idx            = ~size_t{0};
+
+    HLSLTokenView() {}
+
+    HLSLTokenView(TokenType   _Type,
+                  const char* _DelimStart,
+                  const char* _DelimEnd,
+                  const char* _LiteralStart,
+                  const char* _LiteralEnd,
+                  size_t      _Idx) :
+        Type{_Type},
+        LiteralStart{_LiteralStart},
+        LiteralEnd{_LiteralEnd},
+        DelimiterStart{_DelimStart},
+        DelimiterEnd{_DelimEnd},
+        Idx{_Idx}
+    {}
+
+    void SetType(TokenType _Type)
+    {
+        Type = _Type;
+    }
+
+    TokenType GetType() const { return Type; }
+
+    bool CompareLiteral(const char* Str) const
+    {
+        const size_t Len = GetLiteralLen();
+        return strncmp(LiteralStart, Str, Len) == 0 && Str[Len] == '\0';
+    }
+
+    bool CompareLiteral(const char* Start, const char* End) const
+    {
+        const size_t Len = End - Start;
+        return GetLiteralLen() == Len && strncmp(LiteralStart, Start, Len) == 0;
+    }
+
+    void ExtendLiteral(const char* Start, const char* End)
+    {
+        VERIFY(Start == LiteralEnd, "Only adjacent characters can be added to the token literal");
+        LiteralEnd += End - Start;
+    }
+
+    bool IsBuiltInType() const
+    {
+        return Parsing::IsBuiltInType(Type);
+    }
+
+    bool IsFlowControl() const
+    {
+        return Parsing::IsFlowControl(Type);
+    }
+
+    static HLSLTokenView Create(TokenType   _Type,
+                                const char* DelimStart,
+                                const char* DelimEnd,
+                                const char* LiteralStart,
+                                const char* LiteralEnd,
+                                size_t      Idx)
+    {
+        return HLSLTokenView{_Type, DelimStart, DelimEnd, LiteralStart, LiteralEnd, Idx};
+    }
+
+    size_t GetDelimiterLen() const
+    {
+        return DelimiterEnd - DelimiterStart;
+    }
+    size_t GetLiteralLen() const
+    {
+        return LiteralEnd - LiteralStart;
+    }
+    const std::pair<const char*, const char*> GetDelimiter() const
+    {
+        return {DelimiterStart, DelimiterEnd};
+    }
+    const std::pair<const char*, const char*> GetLiteral() const
+    {
+        return {LiteralStart, LiteralEnd};
+    }
+    std::string GetLiteralStr() const
+    {
+        return {LiteralStart, LiteralEnd};
+    }
+
+    std::ostream& OutputDelimiter(std::ostream& os) const
+    {
+        os.write(DelimiterStart, GetDelimiterLen());
+        return os;
+    }
+    std::ostream& OutputLiteral(std::ostream& os) const
+    {
+        os.write(LiteralStart, GetLiteralLen());
+        return os;
+    }
+};
+
 class HLSLTokenizer
 {
 public:
-    HLSLTokenizer();
-
+    /// Returns the keyword token info for the given string, or null if the string is not a keyword.
     const HLSLTokenInfo* FindKeyword(const String& Keyword) const
     {
-        auto it = m_Keywords.find(HashMapStringKey{Keyword});
-        return it != m_Keywords.end() ? &it->second : nullptr;
+        return FindKeyword(Keyword.c_str(), Keyword.length());
     }
+    const HLSLTokenInfo* FindKeyword(const char* Keyword, size_t Length) const;
 
     using TokenListType = std::list<HLSLTokenInfo>;
     TokenListType Tokenize(const String& Source) const;
 
-private:
-    // HLSL keyword -> token info hash map
-    // Example: "Texture2D" -> TokenInfo{TokenType::Texture2D, "Texture2D"}
-    std::unordered_map<HashMapStringKey, HLSLTokenInfo> m_Keywords;
+    /// Tokenizes the source without allocating memory for the token strings.
+    /// The tokens reference the source string, which must not be modified or
+    /// destroyed while the tokens are in use.
+    using TokenViewListType = std::vector<HLSLTokenView>;
+    TokenViewListType TokenizeView(const char* Source, size_t Length) const;
+    TokenViewListType TokenizeView(const String& Source) const
+    {
+        return TokenizeView(Source.c_str(), Source.length());
+    }
 };
 
 } // namespace Parsing
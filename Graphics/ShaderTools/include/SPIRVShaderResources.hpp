@@ -111,6 +111,16 @@ struct SPIRVShaderResourceAttribs
                                Uint32                                _BufferStaticSize = 0,
                                Uint32                                _BufferStride     = 0) noexcept;
 
+    SPIRVShaderResourceAttribs(const char*        _Name,
+                               ResourceType       _Type,
+                               Uint16             _ArraySize,
+                               RESOURCE_DIMENSION _ResourceDim,
+                               bool               _IsMS,
+                               uint32_t           _BindingDecorationOffset,
+                               uint32_t           _DescriptorSetDecorationOffset,
+                               Uint32             _BufferStaticSize = 0,
+                               Uint32             _BufferStride     = 0) noexcept;
+
     ShaderResourceDesc GetResourceDesc() const
     {
         return ShaderResourceDesc{Name, GetShaderResourceType(Type), ArraySize};
@@ -337,6 +347,16 @@ public:
     void MapHLSLVertexShaderInputs(std::vector<uint32_t>& SPIRV) const;
 
 private:
+    // Loads resources using the lightweight SPIRV parser that does not require SPIRV-Cross.
+    // Returns false if the byte code uses constructs that the parser does not handle,
+    // in which case the object is left unmodified.
+    bool LoadResourcesFromBinary(IMemoryAllocator&            Allocator,
+                                 const std::vector<uint32_t>& SPIRV,
+                                 const ShaderDesc&            shaderDesc,
+                                 const char*                  CombinedSamplerSuffix,
+                                 bool                         LoadShaderStageInputs,
+                                 std::string&                 EntryPoint);
+
     void Initialize(IMemoryAllocator&       Allocator,
                     const ResourceCounters& Counters,
                     Uint32                  NumShaderStageInputs,
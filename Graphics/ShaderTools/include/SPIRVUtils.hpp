@@ -27,6 +27,7 @@
 #pragma once
 
 #include <vector>
+#include <string>
 #include <unordered_map>
 
 #include "GraphicsTypes.h"
@@ -44,4 +45,27 @@ namespace Diligent
 std::vector<uint32_t> PatchImageFormats(const std::vector<uint32_t>&                                SPIRV,
                                         const std::unordered_map<HashMapStringKey, TEXTURE_FORMAT>& ImageFormats);
 
+/// Specialization constant declared in the SPIRV code.
+struct SPIRVSpecializationConstantInfo
+{
+    /// Constant name.
+    std::string Name;
+
+    /// Constant ID (the value of the SpecId decoration).
+    uint32_t SpecId = 0;
+
+    /// Constant size, in bytes.
+    uint32_t Size = 0;
+};
+
+/// Returns the list of scalar specialization constants declared in the SPIRV code.
+///
+/// \param [in] SPIRV - SPIRV code.
+///
+/// eturn Specialization constants.
+///
+/// emarks    Constants without a name (e.g. those that were stripped by the optimizer)
+///             as well as composite constants are not returned.
+std::vector<SPIRVSpecializationConstantInfo> GetSPIRVSpecializationConstants(const std::vector<uint32_t>& SPIRV);
+
 } // namespace Diligent
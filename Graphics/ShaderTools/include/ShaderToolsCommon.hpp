@@ -100,6 +100,21 @@ struct ShaderSourceFileData
     Uint32                   SourceLength = 0;
 };
 
+/// Loads the shader source file through the stream factory.
+
+/// File contents are kept in a process-wide cache keyed by the stream factory and the file path,
+/// so that common headers included by many shaders are read once. The cache is shared by
+/// DXC, glslang, the HLSL-to-GLSL converter and the include preprocessing functions below.
+/// The returned blob must not be modified.
+/// Returns null if the file could not be opened.
+RefCntAutoPtr<IDataBlob> LoadShaderSourceFile(IShaderSourceInputStreamFactory*        pShaderSourceStreamFactory,
+                                              const char*                             FilePath,
+                                              CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags = CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE);
+
+/// Removes all files from the shader source file cache, so that subsequent
+/// shader compilations read them again. Must be called after the files change.
+void ClearShaderSourceFileCache();
+
 /// Reads shader source code from a file or uses the one from the shader create info
 ShaderSourceFileData ReadShaderSourceFile(const char*                      SourceCode,
                                           size_t                           SourceLength,
@@ -156,6 +156,18 @@ public:
                         bool                   LoadUniformBufferReflection,
                         IDataBlob**            ppTintOutput) noexcept(false);
 
+    /// Initializes shader resources from the reflection previously produced by the constructor above
+    /// (e.g. stored in a device object archive). Unlike the constructor above, this one does not parse WGSL.
+    /// Uniform buffer reflection is not available for resources created this way.
+    WGSLShaderResources(IMemoryAllocator&                Allocator,
+                        const WGSLShaderResourceAttribs* pResources,
+                        Uint32                           NumResources,
+                        SHADER_TYPE                      ShaderType,
+                        const char*                      ShaderName,
+                        const char*                      CombinedSamplerSuffix,
+                        const char*                      EntryPoint,
+                        const char*                      EmulatedArrayIndexSuffix) noexcept(false);
+
     // clang-format off
     WGSLShaderResources             (const WGSLShaderResources&)  = delete;
     WGSLShaderResources             (      WGSLShaderResources&&) = delete;
@@ -32,8 +32,10 @@
 #include <memory>
 #include <mutex>
 #include <atomic>
+#include <future>
 #include <array>
 #include <sstream>
+#include <iomanip>
 
 #if PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
 #    include "WinHPreface.h"
@@ -60,11 +62,15 @@
 #include "DataBlobImpl.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "FileWrapper.hpp"
+#include "FileSystem.hpp"
 
 #include "HLSLUtils.hpp"
 
 #include "dxc/DxilContainer/DxilContainer.h"
 
+#include "xxhash.h"
+
 namespace Diligent
 {
 
@@ -77,10 +83,33 @@ constexpr Uint32 VK_API_VERSION_1_2 = (1u << 22) | (2u << 12);
 class DXCompilerImpl final : public IDXCompiler
 {
 public:
-    DXCompilerImpl(DXCompilerTarget Target, Uint32 APIVersion, const char* LibName) :
+    DXCompilerImpl(DXCompilerTarget Target, Uint32 APIVersion, const char* LibName, const char* CachePath, bool LoadAsync) :
         m_Library{Target, LibName != nullptr && LibName[0] != '\0' ? LibName : (Target == DXCompilerTarget::Direct3D12 ? "dxcompiler" : "spv_dxcompiler")},
         m_APIVersion{APIVersion}
-    {}
+    {
+        if (CachePath != nullptr && CachePath[0] != '\0')
+        {
+            m_CacheDirectory = CachePath;
+            if (!FileSystem::PathExists(m_CacheDirectory.c_str()) && !FileSystem::CreateDirectory(m_CacheDirectory.c_str()))
+            {
+                LOG_WARNING_MESSAGE("Failed to create DXC cache directory '", m_CacheDirectory, "'. Compiled shaders will not be cached.");
+                m_CacheDirectory.clear();
+            }
+            else if (!FileSystem::IsSlash(m_CacheDirectory.back()))
+            {
+                m_CacheDirectory.push_back(FileSystem::SlashSymbol);
+            }
+        }
+
+        if (LoadAsync)
+        {
+            // Library loading is synchronized by DXCompilerLibrary, so any method
+            // called while the task is running will wait for it to finish.
+            m_AsyncLoad = std::async(std::launch::async, [this]() {
+                m_Library.GetDxcCreateInstance();
+            });
+        }
+    }
 
     ShaderVersion GetMaxShaderModel() override final
     {
@@ -125,6 +154,11 @@ public:
 private:
     bool ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcLibrary* pdxcLibrary, CComPtr<IDxcBlob>& pCompiled, IDxcBlob** ppOutput) const noexcept(false);
 
+    // Returns the path of the cache file for the given compilation, or an empty string
+    // if the includes could not be resolved.
+    std::string GetCacheFilePath(const CompileAttribs& Attribs, const ShaderCreateInfo& ShaderCI);
+    bool        LoadCachedBytecode(const std::string& FilePath, IDxcBlob** ppBlobOut) const;
+
     enum RES_TYPE : Uint32
     {
         RES_TYPE_CBV     = 0,
@@ -161,6 +195,11 @@ private:
 private:
     DXCompilerLibrary m_Library;
     const Uint32      m_APIVersion;
+    std::string       m_CacheDirectory;
+
+    // Must be declared after m_Library: the future returned by std::async
+    // waits for the task in its destructor.
+    std::future<void> m_AsyncLoad;
 };
 
 #define CHECK_D3D_RESULT(Expr, Message)   \
@@ -210,17 +249,13 @@ public:
         if (fileName.size() > 2 && fileName[0] == '.' && (fileName[1] == '\\' || fileName[1] == '/'))
             fileName.erase(0, 2);
 
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pStreamFactory->CreateInputStream(fileName.c_str(), &pSourceStream);
-        if (pSourceStream == nullptr)
+        RefCntAutoPtr<IDataBlob> pFileData = LoadShaderSourceFile(m_pStreamFactory, fileName.c_str());
+        if (pFileData == nullptr)
         {
             LOG_ERROR("Failed to open shader include file ", fileName, ". Check that the file exists");
             return E_FAIL;
         }
 
-        RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
-        pSourceStream->ReadBlob(pFileData);
-
         CComPtr<IDxcBlobEncoding> pSourceBlob;
 
         HRESULT hr = m_pdxcLibrary->CreateBlobWithEncodingFromPinned(pFileData->GetDataPtr(), static_cast<UINT32>(pFileData->GetSize()), CP_UTF8, &pSourceBlob);
@@ -326,9 +361,9 @@ private:
 } // namespace
 
 
-std::unique_ptr<IDXCompiler> CreateDXCompiler(DXCompilerTarget Target, Uint32 APIVersion, const char* pLibraryName)
+std::unique_ptr<IDXCompiler> CreateDXCompiler(DXCompilerTarget Target, Uint32 APIVersion, const char* pLibraryName, const char* pCachePath, bool LoadAsync)
 {
-    return std::make_unique<DXCompilerImpl>(Target, APIVersion, pLibraryName);
+    return std::make_unique<DXCompilerImpl>(Target, APIVersion, pLibraryName, pCachePath, LoadAsync);
 }
 
 bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
@@ -417,6 +452,94 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
     }
 }
 
+std::string DXCompilerImpl::GetCacheFilePath(const CompileAttribs& Attribs, const ShaderCreateInfo& ShaderCI)
+{
+    XXH3_state_t* pState = XXH3_createState();
+    VERIFY_EXPR(pState != nullptr);
+    XXH3_128bits_reset(pState);
+
+    const auto UpdateRaw = [pState](const void* pData, size_t Size) {
+        // Hash the size as well so that adjacent strings can't be shifted into each other
+        XXH3_128bits_update(pState, &Size, sizeof(Size));
+        if (Size != 0)
+            XXH3_128bits_update(pState, pData, Size);
+    };
+    const auto UpdateWStr = [&UpdateRaw](const wchar_t* Str) {
+        UpdateRaw(Str, Str != nullptr ? wcslen(Str) * sizeof(wchar_t) : 0);
+    };
+
+    // Hash the source together with the contents of every file it includes. DXC resolves
+    // the includes through the same stream factory, so a change in any header changes the key.
+    ShaderCreateInfo SourceCI{ShaderCI};
+    SourceCI.Source       = Attribs.Source;
+    SourceCI.SourceLength = Attribs.SourceLength;
+    SourceCI.FilePath     = nullptr;
+    SourceCI.Macros       = {};
+
+    const bool IncludesResolved = ProcessShaderIncludes(
+        SourceCI, [&](const ShaderIncludePreprocessInfo& ProcessInfo) {
+            UpdateRaw(ProcessInfo.FilePath.data(), ProcessInfo.FilePath.size());
+            UpdateRaw(ProcessInfo.Source, ProcessInfo.SourceLength);
+        });
+
+    std::string FilePath;
+    if (IncludesResolved)
+    {
+        UpdateWStr(Attribs.EntryPoint);
+        UpdateWStr(Attribs.Profile);
+        for (Uint32 i = 0; i < Attribs.DefinesCount; ++i)
+        {
+            UpdateWStr(Attribs.pDefines[i].Name);
+            UpdateWStr(Attribs.pDefines[i].Value);
+        }
+        for (Uint32 i = 0; i < Attribs.ArgsCount; ++i)
+            UpdateWStr(Attribs.pArgs[i]);
+
+        const DXCompilerTarget Target          = m_Library.GetTarget();
+        const Version          CompilerVersion = m_Library.GetVersion();
+        UpdateRaw(&Target, sizeof(Target));
+        UpdateRaw(&m_APIVersion, sizeof(m_APIVersion));
+        UpdateRaw(&CompilerVersion.Major, sizeof(CompilerVersion.Major));
+        UpdateRaw(&CompilerVersion.Minor, sizeof(CompilerVersion.Minor));
+
+        const XXH128_hash_t Hash = XXH3_128bits_digest(pState);
+
+        std::stringstream ss;
+        ss << m_CacheDirectory << std::hex << std::setfill('0') << std::setw(16) << Hash.high64 << std::setw(16) << Hash.low64
+           << (Target == DXCompilerTarget::Direct3D12 ? ".dxil" : ".spv");
+        FilePath = ss.str();
+    }
+
+    XXH3_freeState(pState);
+    return FilePath;
+}
+
+bool DXCompilerImpl::LoadCachedBytecode(const std::string& FilePath, IDxcBlob** ppBlobOut) const
+{
+    if (!FileSystem::FileExists(FilePath.c_str()))
+        return false;
+
+    RefCntAutoPtr<IDataBlob> pData;
+    if (!FileWrapper::ReadWholeFile(FilePath.c_str(), &pData, /*Silent = */ true))
+        return false;
+
+    const void*  pBytecode = pData->GetConstDataPtr();
+    const size_t Size      = pData->GetSize();
+
+    constexpr Uint32 SPIRVMagic = 0x07230203;
+    const bool       IsValid    = m_Library.GetTarget() == DXCompilerTarget::Direct3D12 ?
+        IsDXILBytecode(pBytecode, Size) :
+        (Size >= sizeof(Uint32) && Size % sizeof(Uint32) == 0 && *static_cast<const Uint32*>(pBytecode) == SPIRVMagic);
+    if (!IsValid)
+    {
+        LOG_WARNING_MESSAGE("DXC cache file '", FilePath, "' is corrupted and will be ignored.");
+        return false;
+    }
+
+    CreateDxcBlobWrapper(pData, ppBlobOut);
+    return *ppBlobOut != nullptr;
+}
+
 bool DXCompilerImpl::ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcLibrary* library, CComPtr<IDxcBlob>& compiled, IDxcBlob** ppBlobOut) const noexcept(false)
 {
     CComPtr<IDxcValidator> pdxcValidator;
@@ -803,8 +926,26 @@ void DXCompilerImpl::Compile(const ShaderCreateInfo& ShaderCI,
     CA.ppBlobOut                  = &pDXIL;
     CA.ppCompilerOutput           = &pDxcLog;
 
-    bool result = Compile(CA);
-    HandleHLSLCompilerResult(result, pDxcLog.p, Source, ShaderCI.Desc.Name, ppCompilerOutput);
+    std::string CacheFilePath;
+    if (!m_CacheDirectory.empty())
+        CacheFilePath = GetCacheFilePath(CA, ShaderCI);
+
+    bool result = false;
+    if (!CacheFilePath.empty() && LoadCachedBytecode(CacheFilePath, &pDXIL))
+    {
+        result = true;
+    }
+    else
+    {
+        result = Compile(CA);
+        HandleHLSLCompilerResult(result, pDxcLog.p, Source, ShaderCI.Desc.Name, ppCompilerOutput);
+
+        if (result && pDXIL && pDXIL->GetBufferSize() > 0 && !CacheFilePath.empty())
+        {
+            if (!FileWrapper::WriteFile(CacheFilePath.c_str(), pDXIL->GetBufferPointer(), pDXIL->GetBufferSize(), /*Silent = */ true))
+                LOG_WARNING_MESSAGE("Failed to write DXC cache file '", CacheFilePath, "'.");
+        }
+    }
 
     if (result && pDXIL && pDXIL->GetBufferSize() > 0)
     {
@@ -26,45 +26,273 @@
 
 #include "HLSLTokenizer.hpp"
 
+#include <algorithm>
+#include <numeric>
+
+#include "PlatformMisc.hpp"
+
+#if defined(__SSE2__) || (defined(_MSC_VER) && ((_M_IX86_FP >= 2) || defined(_M_X64)))
+#    include <emmintrin.h>
+#    define HLSL_TOKENIZER_USE_SSE2 1
+#else
+#    define HLSL_TOKENIZER_USE_SSE2 0
+#endif
+
 namespace Diligent
 {
 
 namespace Parsing
 {
 
-HLSLTokenizer::HLSLTokenizer()
+namespace
 {
-    // Populate HLSL keywords hash map
-#define DEFINE_KEYWORD(keyword) m_Keywords.insert(std::make_pair(#keyword, HLSLTokenInfo(HLSLTokenType::kw_##keyword, #keyword)));
-    ITERATE_HLSL_KEYWORDS(DEFINE_KEYWORD)
-#undef DEFINE_KEYWORD
-}
 
-HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
+constexpr Uint32 InvalidSlot = ~0u;
+
+// Minimal perfect hash table of HLSL keywords built with the hash-and-displace method:
+// keywords are distributed into buckets by the first hash, and every bucket then gets
+// a seed for the second hash that places all keywords of the bucket into free slots.
+// Looking up a string thus requires two hash evaluations and a single comparison.
+class HLSLKeywordTable
 {
-    try
+public:
+    HLSLKeywordTable()
     {
-        size_t TokenIdx = 0;
-        return Parsing::Tokenize<HLSLTokenInfo, TokenListType>(
-            Source.begin(), Source.end(),
-            [&TokenIdx](HLSLTokenType                      Type,
-                        const std::string::const_iterator& DelimStart,
-                        const std::string::const_iterator& DelimEnd,
-                        const std::string::const_iterator& LiteralStart,
-                        const std::string::const_iterator& LiteralEnd) //
+#define ADD_KEYWORD(keyword) m_Keywords.emplace_back(HLSLTokenType::kw_##keyword, #keyword);
+        ITERATE_HLSL_KEYWORDS(ADD_KEYWORD)
+#undef ADD_KEYWORD
+
+        const Uint32 NumKeywords = static_cast<Uint32>(m_Keywords.size());
+        m_Seeds.resize(NumKeywords);
+        m_Slots.resize(NumKeywords, InvalidSlot);
+
+        std::vector<std::vector<Uint32>> Buckets(NumKeywords);
+        for (Uint32 i = 0; i < NumKeywords; ++i)
+        {
+            const String& Literal = m_Keywords[i].Literal;
+            Buckets[Hash(0, Literal.c_str(), Literal.length()) % NumKeywords].push_back(i);
+
+            m_MinLength = std::min(m_MinLength, Literal.length());
+            m_MaxLength = std::max(m_MaxLength, Literal.length());
+        }
+
+        // Place the largest buckets first while there are many free slots
+        std::vector<Uint32> BucketOrder(NumKeywords);
+        std::iota(BucketOrder.begin(), BucketOrder.end(), 0u);
+        std::stable_sort(BucketOrder.begin(), BucketOrder.end(),
+                         [&Buckets](Uint32 b0, Uint32 b1) { return Buckets[b0].size() > Buckets[b1].size(); });
+
+        std::vector<Uint32> BucketSlots;
+        for (Uint32 BucketIdx : BucketOrder)
+        {
+            const std::vector<Uint32>& Bucket = Buckets[BucketIdx];
+            if (Bucket.empty())
+                break;
+
+            for (Uint32 Seed = 1;; ++Seed)
             {
-                return HLSLTokenInfo::Create(Type, DelimStart, DelimEnd, LiteralStart, LiteralEnd, TokenIdx++);
-            },
-            [&](const std::string::const_iterator& Start, const std::string::const_iterator& End) //
+                BucketSlots.clear();
+                for (Uint32 KeywordIdx : Bucket)
+                {
+                    const String& Literal = m_Keywords[KeywordIdx].Literal;
+                    const Uint32  Slot    = Hash(Seed, Literal.c_str(), Literal.length()) % NumKeywords;
+                    if (m_Slots[Slot] != InvalidSlot || std::find(BucketSlots.begin(), BucketSlots.end(), Slot) != BucketSlots.end())
+                        break;
+                    BucketSlots.push_back(Slot);
+                }
+
+                if (BucketSlots.size() == Bucket.size())
+                {
+                    for (size_t i = 0; i < Bucket.size(); ++i)
+                        m_Slots[BucketSlots[i]] = Bucket[i];
+                    m_Seeds[BucketIdx] = Seed;
+                    break;
+                }
+            }
+        }
+    }
+
+    const HLSLTokenInfo* Find(const char* Str, size_t Length) const
+    {
+        if (Length < m_MinLength || Length > m_MaxLength)
+            return nullptr;
+
+        const Uint32 NumKeywords = static_cast<Uint32>(m_Keywords.size());
+        const Uint32 Seed        = m_Seeds[Hash(0, Str, Length) % NumKeywords];
+        const Uint32 Slot        = Hash(Seed, Str, Length) % NumKeywords;
+        VERIFY_EXPR(m_Slots[Slot] != InvalidSlot);
+
+        const HLSLTokenInfo& Keyword = m_Keywords[m_Slots[Slot]];
+        return Keyword.Literal.length() == Length && memcmp(Keyword.Literal.c_str(), Str, Length) == 0 ? &Keyword : nullptr;
+    }
+
+    static const HLSLKeywordTable& Get()
+    {
+        static const HLSLKeywordTable Table;
+        return Table;
+    }
+
+private:
+    // Seeded FNV-1a
+    static Uint32 Hash(Uint32 Seed, const char* Str, size_t Length)
+    {
+        Uint32 Value = 2166136261u ^ (Seed * 0x9E3779B9u);
+        for (size_t i = 0; i < Length; ++i)
+        {
+            Value ^= static_cast<Uint8>(Str[i]);
+            Value *= 16777619u;
+        }
+        return Value;
+    }
+
+    std::vector<HLSLTokenInfo> m_Keywords;
+    std::vector<Uint32>        m_Seeds;
+    std::vector<Uint32>        m_Slots;
+
+    size_t m_MinLength = ~size_t{0};
+    size_t m_MaxLength = 0;
+};
+
+#if HLSL_TOKENIZER_USE_SSE2
+// Returns the mask of the characters in the 16-byte block that are equal to any of the given characters
+inline Uint32 FindCharsMask(const char* Pos, __m128i C0, __m128i C1, __m128i C2, __m128i C3)
+{
+    const __m128i Chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pos));
+    const __m128i Match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(Chars, C0), _mm_cmpeq_epi8(Chars, C1)),
+                                       _mm_or_si128(_mm_cmpeq_epi8(Chars, C2), _mm_cmpeq_epi8(Chars, C3)));
+    return static_cast<Uint32>(_mm_movemask_epi8(Match));
+}
+#endif
+
+// Returns the position of the first non-delimiter character in [Pos, End)
+inline const char* SkipDelimitersFast(const char* Pos, const char* End)
+{
+#if HLSL_TOKENIZER_USE_SSE2
+    const __m128i Space = _mm_set1_epi8(' ');
+    const __m128i Tab   = _mm_set1_epi8('\t');
+    const __m128i CR    = _mm_set1_epi8('\r');
+    const __m128i LF    = _mm_set1_epi8('\n');
+    while (End - Pos >= 16)
+    {
+        const Uint32 NonDelimMask = ~FindCharsMask(Pos, Space, Tab, CR, LF) & 0xFFFFu;
+        if (NonDelimMask != 0)
+            return Pos + PlatformMisc::GetLSB(NonDelimMask);
+        Pos += 16;
+    }
+#endif
+    while (Pos != End && IsDelimiter(*Pos))
+        ++Pos;
+    return Pos;
+}
+
+// Returns the position of the first occurrence of any of the given characters in [Pos, End), or End
+inline const char* FindAnyOf(const char* Pos, const char* End, char C0, char C1, char C2)
+{
+#if HLSL_TOKENIZER_USE_SSE2
+    const __m128i Chars0 = _mm_set1_epi8(C0);
+    const __m128i Chars1 = _mm_set1_epi8(C1);
+    const __m128i Chars2 = _mm_set1_epi8(C2);
+    while (End - Pos >= 16)
+    {
+        const Uint32 Mask = FindCharsMask(Pos, Chars0, Chars1, Chars2, Chars2);
+        if (Mask != 0)
+            return Pos + PlatformMisc::GetLSB(Mask);
+        Pos += 16;
+    }
+#endif
+    while (Pos != End && *Pos != C0 && *Pos != C1 && *Pos != C2)
+        ++Pos;
+    return Pos;
+}
+
+// Same as SkipDelimitersAndComments, but processes 16 characters at a time when possible
+const char* SkipDelimitersAndCommentsFast(const char* Start, const char* End) noexcept(false)
+{
+    const char* Pos = Start;
+    while (Pos != End && *Pos != '\0')
+    {
+        Pos = SkipDelimitersFast(Pos, End);
+        if (Pos == End || End - Pos < 2 || Pos[0] != '/')
+            break;
+
+        if (Pos[1] == '/')
+        {
+            // The new line character is skipped as a delimiter in the next iteration
+            Pos = FindAnyOf(Pos + 2, End, '\n', '\r', '\0');
+        }
+        else if (Pos[1] == '*')
+        {
+            const char* CommentStart = Pos;
+            Pos += 2;
+            while (true)
             {
-                auto KeywordIt = m_Keywords.find(HashMapStringKey{std::string{Start, End}});
-                if (KeywordIt != m_Keywords.end())
+                Pos = FindAnyOf(Pos, End, '*', '\0', '\0');
+                if (Pos == End || *Pos == '\0')
+                    throw std::pair<const char*, const char*>{CommentStart, "Unable to find the end of the multiline comment."};
+
+                ++Pos;
+                if (Pos != End && *Pos == '/')
                 {
-                    VERIFY(std::string(Start, End) == KeywordIt->second.Literal, "Inconsistent literal");
-                    return KeywordIt->second.Type;
+                    ++Pos;
+                    break;
                 }
-                return HLSLTokenType::Identifier;
-            });
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return Pos;
+}
+
+template <typename TokenClass, typename ContainerType>
+ContainerType TokenizeImpl(const char* Source, size_t Length) noexcept(false)
+{
+    size_t TokenIdx = 0;
+    return Parsing::Tokenize<TokenClass, ContainerType>(
+        Source, Source + Length,
+        [&TokenIdx](HLSLTokenType Type,
+                    const char*   DelimStart,
+                    const char*   DelimEnd,
+                    const char*   LiteralStart,
+                    const char*   LiteralEnd) //
+        {
+            return TokenClass::Create(Type, DelimStart, DelimEnd, LiteralStart, LiteralEnd, TokenIdx++);
+        },
+        [](const char* Start, const char* End) //
+        {
+            const HLSLTokenInfo* pKeyword = HLSLKeywordTable::Get().Find(Start, End - Start);
+            return pKeyword != nullptr ? pKeyword->Type : HLSLTokenType::Identifier;
+        },
+        SkipDelimitersAndCommentsFast);
+}
+
+} // namespace
+
+const HLSLTokenInfo* HLSLTokenizer::FindKeyword(const char* Keyword, size_t Length) const
+{
+    return HLSLKeywordTable::Get().Find(Keyword, Length);
+}
+
+HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
+{
+    try
+    {
+        return TokenizeImpl<HLSLTokenInfo, TokenListType>(Source.c_str(), Source.length());
+    }
+    catch (...)
+    {
+        return {};
+    }
+}
+
+HLSLTokenizer::TokenViewListType HLSLTokenizer::TokenizeView(const char* Source, size_t Length) const
+{
+    try
+    {
+        return TokenizeImpl<HLSLTokenView, TokenViewListType>(Source, Length);
     }
     catch (...)
     {
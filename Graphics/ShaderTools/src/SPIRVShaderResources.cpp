@@ -26,6 +26,12 @@
  */
 
 #include <iomanip>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "SPIRVShaderResources.hpp"
 #include "spirv_parser.hpp"
 #include "spirv_cross.hpp"
@@ -126,6 +132,28 @@ SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const diligent_spirv_cros
 // clang-format on
 {}
 
+SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const char*        _Name,
+                                                       ResourceType       _Type,
+                                                       Uint16             _ArraySize,
+                                                       RESOURCE_DIMENSION _ResourceDim,
+                                                       bool               _IsMS,
+                                                       uint32_t           _BindingDecorationOffset,
+                                                       uint32_t           _DescriptorSetDecorationOffset,
+                                                       Uint32             _BufferStaticSize,
+                                                       Uint32             _BufferStride) noexcept :
+    // clang-format off
+    Name                          {_Name},
+    ArraySize                     {_ArraySize},
+    Type                          {_Type},
+    ResourceDim                   {static_cast<Uint8>(_ResourceDim)},
+    IsMS                          {_IsMS ? Uint8{1} : Uint8{0}},
+    BindingDecorationOffset       {_BindingDecorationOffset},
+    DescriptorSetDecorationOffset {_DescriptorSetDecorationOffset},
+    BufferStaticSize              {_BufferStaticSize},
+    BufferStride                  {_BufferStride}
+// clang-format on
+{}
+
 
 SHADER_RESOURCE_TYPE SPIRVShaderResourceAttribs::GetShaderResourceType(ResourceType Type)
 {
@@ -375,6 +403,893 @@ ShaderCodeBufferDescX LoadUBReflection(const diligent_spirv_cross::Compiler& Com
     return UBDesc;
 }
 
+namespace
+{
+
+// Lightweight SPIRV parser that extracts the information required by SPIRVShaderResources
+// (entry points, names, decorations, descriptor types and buffer block layouts) in a single
+// pass over the module-level declarations, without building the SPIRV-Cross IR.
+// The parser follows the rules used by diligent_spirv_cross::Compiler::get_shader_resources()
+// and returns false for any construct it does not handle, in which case SPIRV-Cross must be used.
+class SPIRVResourceParser
+{
+public:
+    // Resource groups, in the order they are laid out in SPIRVShaderResources memory buffer
+    enum ResourceGroup : Uint32
+    {
+        UniformBuffers = 0,
+        StorageBuffers,
+        StorageImages,
+        SampledImages,
+        AtomicCounters,
+        SeparateSamplers,
+        SeparateImages,
+        InputAttachments,
+        AccelStructs,
+        NumResourceGroups
+    };
+
+    struct Resource
+    {
+        std::string                              Name;
+        SPIRVShaderResourceAttribs::ResourceType Type                = SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes;
+        Uint16                                   ArraySize           = 1;
+        RESOURCE_DIMENSION                       ResourceDim         = RESOURCE_DIM_UNDEFINED;
+        bool                                     IsMS                = false;
+        uint32_t                                 BindingOffset       = 0;
+        uint32_t                                 DescriptorSetOffset = 0;
+        Uint32                                   BufferStaticSize    = 0;
+        Uint32                                   BufferStride        = 0;
+    };
+
+    struct StageInput
+    {
+        const char* Name           = nullptr;
+        const char* Semantic       = nullptr;
+        uint32_t    LocationOffset = 0;
+    };
+
+    bool Parse(const std::vector<uint32_t>& SPIRV, spv::ExecutionModel ExecutionModel);
+
+    // clang-format off
+    const char*                  GetEntryPoint()           const { return m_pEntryPoint != nullptr ? m_pEntryPoint->Name : nullptr; }
+    bool                         IsHLSLSource()            const { return m_SourceLanguage == spv::SourceLanguageHLSL; }
+    bool                         HasHlslFunctionality1()   const { return m_HlslFunctionality1; }
+    const std::vector<Resource>& GetResources(Uint32 Group)const { return m_Resources[Group]; }
+    const std::vector<StageInput>& GetStageInputs()        const { return m_StageInputs; }
+    const std::array<Uint32, 3>& GetLocalSize()            const { return m_LocalSize; }
+    // clang-format on
+
+private:
+    struct Instruction
+    {
+        spv::Op         Op     = spv::OpNop;
+        const uint32_t* Ops    = nullptr;
+        uint32_t        NumOps = 0;
+    };
+
+    struct Decorations
+    {
+        uint32_t    BindingOffset       = 0;
+        uint32_t    DescriptorSetOffset = 0;
+        uint32_t    LocationOffset      = 0;
+        uint32_t    ArrayStride         = 0;
+        const char* HlslSemantic        = nullptr;
+        bool        Block               = false;
+        bool        BufferBlock         = false;
+        bool        NonWritable         = false;
+        bool        BuiltIn             = false;
+    };
+
+    struct MemberDecorations
+    {
+        uint32_t Offset       = 0;
+        uint32_t MatrixStride = 0;
+        bool     HasOffset    = false;
+        bool     RowMajor     = false;
+        bool     ColMajor     = false;
+        bool     NonWritable  = false;
+        bool     BuiltIn      = false;
+    };
+
+    struct EntryPointInfo
+    {
+        spv::ExecutionModel Model          = spv::ExecutionModelMax;
+        uint32_t            Function       = 0;
+        const char*         Name           = nullptr;
+        uint32_t            InterfaceStart = 0;
+        uint32_t            InterfaceEnd   = 0;
+    };
+
+    struct VariableInfo
+    {
+        uint32_t          Id      = 0;
+        uint32_t          TypeId  = 0;
+        spv::StorageClass Storage = spv::StorageClassMax;
+    };
+
+    // Type of a variable with the pointer and the array stripped off
+    struct VariableType
+    {
+        spv::StorageClass Storage   = spv::StorageClassMax;
+        uint32_t          BaseId    = 0;
+        Instruction       Base;
+        Instruction       Image; // OpTypeImage for image and sampled image types
+        Uint32            ArraySize = 1;
+    };
+
+    bool ParseInstruction(uint32_t Offset);
+    bool Reflect(spv::ExecutionModel ExecutionModel);
+
+    Instruction       GetInstruction(uint32_t Id) const;
+    const char*       GetName(uint32_t Id) const;
+    const Decorations* FindDecorations(uint32_t Id) const;
+    bool              GetConstantValue(uint32_t Id, Uint32& Value) const;
+    bool              GetVariableType(const VariableInfo& Var, VariableType& Type) const;
+    bool              IsBuiltInVariable(const VariableInfo& Var, const VariableType& Type) const;
+    bool              IsInEntryPointInterface(const VariableInfo& Var) const;
+    bool              IsSSBOInstanceNameSignificant() const;
+    std::string       GetBlockName(const VariableInfo& Var, const VariableType& Type, bool PreferInstanceName) const;
+    bool              GetDeclaredStructSize(uint32_t StructId, size_t& Size, Uint32 Depth = 0) const;
+    bool              GetDeclaredMemberSize(uint32_t MemberTypeId, const MemberDecorations& MemberDecor, size_t& Size, Uint32 Depth) const;
+    bool              AddResource(const VariableInfo& Var, const VariableType& Type, ResourceGroup Group, SPIRVShaderResourceAttribs::ResourceType ResType, std::string Name);
+
+    static const char* ReadString(const uint32_t* Words, uint32_t NumWords, uint32_t* pNumStringWords = nullptr);
+
+private:
+    const uint32_t* m_pSPIRV   = nullptr;
+    size_t          m_NumWords = 0;
+    uint32_t        m_Version  = 0;
+
+    // Offset of the instruction that defines the id (types, constants and variables only)
+    std::vector<uint32_t> m_IdOffsets;
+
+    std::unordered_map<uint32_t, const char*>                    m_Names;
+    std::unordered_map<uint32_t, Decorations>                    m_Decorations;
+    std::unordered_map<uint32_t, std::vector<MemberDecorations>> m_MemberDecorations;
+
+    std::vector<EntryPointInfo> m_EntryPoints;
+    std::vector<VariableInfo>   m_Variables;
+
+    struct LocalSizeInfo
+    {
+        uint32_t              Function = 0;
+        bool                  IsId     = false;
+        std::array<Uint32, 3> Size     = {};
+    };
+    std::vector<LocalSizeInfo> m_LocalSizes;
+
+    uint32_t m_SourceLanguage     = spv::SourceLanguageUnknown;
+    bool     m_HlslFunctionality1 = false;
+
+    const EntryPointInfo*                              m_pEntryPoint = nullptr;
+    std::array<std::vector<Resource>, NumResourceGroups> m_Resources;
+    std::vector<StageInput>                            m_StageInputs;
+    std::array<Uint32, 3>                              m_LocalSize = {};
+};
+
+const char* SPIRVResourceParser::ReadString(const uint32_t* Words, uint32_t NumWords, uint32_t* pNumStringWords)
+{
+    // SPIRV strings are nul-terminated and padded with zeros to the word boundary
+    const char* Str = reinterpret_cast<const char*>(Words);
+    for (size_t i = 0; i < NumWords * sizeof(uint32_t); ++i)
+    {
+        if (Str[i] == '\0')
+        {
+            if (pNumStringWords != nullptr)
+                *pNumStringWords = static_cast<uint32_t>(i / sizeof(uint32_t) + 1);
+            return Str;
+        }
+    }
+    return nullptr;
+}
+
+bool SPIRVResourceParser::Parse(const std::vector<uint32_t>& SPIRV, spv::ExecutionModel ExecutionModel)
+{
+    constexpr size_t HeaderSize = 5;
+    if (SPIRV.size() < HeaderSize || SPIRV[0] != spv::MagicNumber)
+        return false;
+
+    // Every id is defined by an instruction that takes at least two words
+    const uint32_t Bound = SPIRV[3];
+    if (Bound > SPIRV.size())
+        return false;
+
+    m_pSPIRV   = SPIRV.data();
+    m_NumWords = SPIRV.size();
+    m_Version  = SPIRV[1];
+    m_IdOffsets.resize(Bound);
+
+    for (size_t Offset = HeaderSize; Offset < SPIRV.size();)
+    {
+        const uint32_t WordCount = SPIRV[Offset] >> spv::WordCountShift;
+        if (WordCount == 0 || Offset + WordCount > SPIRV.size())
+            return false;
+
+        // All declarations we are interested in precede function definitions
+        if (static_cast<spv::Op>(SPIRV[Offset] & spv::OpCodeMask) == spv::OpFunction)
+            break;
+
+        if (!ParseInstruction(static_cast<uint32_t>(Offset)))
+            return false;
+
+        Offset += WordCount;
+    }
+
+    return Reflect(ExecutionModel);
+}
+
+bool SPIRVResourceParser::ParseInstruction(uint32_t Offset)
+{
+    const spv::Op   Op     = static_cast<spv::Op>(m_pSPIRV[Offset] & spv::OpCodeMask);
+    const uint32_t  NumOps = (m_pSPIRV[Offset] >> spv::WordCountShift) - 1;
+    const uint32_t* Ops    = m_pSPIRV + Offset + 1;
+
+    auto DefineId = [&](uint32_t Id, uint32_t MinOps) {
+        if (NumOps < MinOps || Id >= m_IdOffsets.size())
+            return false;
+        m_IdOffsets[Id] = Offset;
+        return true;
+    };
+
+    switch (Op)
+    {
+        case spv::OpSource:
+            if (NumOps < 1)
+                return false;
+            m_SourceLanguage = Ops[0];
+            break;
+
+        case spv::OpExtension:
+        {
+            const char* Extension = ReadString(Ops, NumOps);
+            if (Extension == nullptr)
+                return false;
+            if (strcmp(Extension, "SPV_GOOGLE_hlsl_functionality1") == 0)
+                m_HlslFunctionality1 = true;
+            break;
+        }
+
+        case spv::OpEntryPoint:
+        {
+            if (NumOps < 3)
+                return false;
+            EntryPointInfo EntryPoint;
+            EntryPoint.Model    = static_cast<spv::ExecutionModel>(Ops[0]);
+            EntryPoint.Function = Ops[1];
+
+            uint32_t NameWords = 0;
+            EntryPoint.Name    = ReadString(Ops + 2, NumOps - 2, &NameWords);
+            if (EntryPoint.Name == nullptr)
+                return false;
+            EntryPoint.InterfaceStart = Offset + 1 + 2 + NameWords;
+            EntryPoint.InterfaceEnd   = Offset + 1 + NumOps;
+            m_EntryPoints.push_back(EntryPoint);
+            break;
+        }
+
+        case spv::OpExecutionMode:
+        case spv::OpExecutionModeId:
+            if (NumOps < 2)
+                return false;
+            if (Ops[1] == spv::ExecutionModeLocalSize || Ops[1] == spv::ExecutionModeLocalSizeId)
+            {
+                if (NumOps < 5)
+                    return false;
+                m_LocalSizes.push_back({Ops[0], Ops[1] == spv::ExecutionModeLocalSizeId, {Ops[2], Ops[3], Ops[4]}});
+            }
+            break;
+
+        case spv::OpName:
+        {
+            if (NumOps < 2)
+                return false;
+            const char* Name = ReadString(Ops + 1, NumOps - 1);
+            if (Name == nullptr)
+                return false;
+            m_Names[Ops[0]] = Name;
+            break;
+        }
+
+        case spv::OpDecorate:
+        {
+            if (NumOps < 2)
+                return false;
+            // Offset of the first decoration literal
+            const uint32_t LiteralOffset = Offset + 3;
+            const bool     HasLiteral    = NumOps >= 3;
+
+            Decorations& Decor = m_Decorations[Ops[0]];
+            switch (Ops[1])
+            {
+                // clang-format off
+                case spv::DecorationBinding:       Decor.BindingOffset       = HasLiteral ? LiteralOffset : 0; break;
+                case spv::DecorationDescriptorSet: Decor.DescriptorSetOffset = HasLiteral ? LiteralOffset : 0; break;
+                case spv::DecorationLocation:      Decor.LocationOffset      = HasLiteral ? LiteralOffset : 0; break;
+                case spv::DecorationArrayStride:   Decor.ArrayStride         = HasLiteral ? Ops[2]        : 0; break;
+                case spv::DecorationBlock:         Decor.Block               = true; break;
+                case spv::DecorationBufferBlock:   Decor.BufferBlock         = true; break;
+                case spv::DecorationNonWritable:   Decor.NonWritable         = true; break;
+                case spv::DecorationBuiltIn:       Decor.BuiltIn             = true; break;
+                // clang-format on
+                default:
+                    break;
+            }
+            break;
+        }
+
+        case spv::OpDecorateString:
+        {
+            if (NumOps < 3)
+                return false;
+            if (Ops[1] == spv::DecorationHlslSemanticGOOGLE)
+            {
+                const char* Semantic = ReadString(Ops + 2, NumOps - 2);
+                if (Semantic == nullptr)
+                    return false;
+                m_Decorations[Ops[0]].HlslSemantic = Semantic;
+            }
+            break;
+        }
+
+        case spv::OpMemberDecorate:
+        {
+            if (NumOps < 3)
+                return false;
+            const uint32_t Member = Ops[1];
+            // Each struct member requires at least one word in OpTypeStruct
+            if (Member >= m_NumWords)
+                return false;
+
+            std::vector<MemberDecorations>& Members = m_MemberDecorations[Ops[0]];
+            if (Member >= Members.size())
+                Members.resize(Member + 1);
+
+            MemberDecorations& Decor = Members[Member];
+            switch (Ops[2])
+            {
+                case spv::DecorationOffset:
+                    if (NumOps < 4)
+                        return false;
+                    Decor.Offset    = Ops[3];
+                    Decor.HasOffset = true;
+                    break;
+
+                case spv::DecorationMatrixStride:
+                    if (NumOps < 4)
+                        return false;
+                    Decor.MatrixStride = Ops[3];
+                    break;
+
+                // clang-format off
+                case spv::DecorationRowMajor:    Decor.RowMajor    = true; break;
+                case spv::DecorationColMajor:    Decor.ColMajor    = true; break;
+                case spv::DecorationNonWritable: Decor.NonWritable = true; break;
+                case spv::DecorationBuiltIn:     Decor.BuiltIn     = true; break;
+                // clang-format on
+
+                default:
+                    break;
+            }
+            break;
+        }
+
+        case spv::OpDecorationGroup:
+        case spv::OpGroupDecorate:
+        case spv::OpGroupMemberDecorate:
+            // Decoration groups are deprecated and are not emitted by modern compilers
+            return false;
+
+        // clang-format off
+        case spv::OpTypeBool:                     return DefineId(Ops[0], 1);
+        case spv::OpTypeInt:                      return DefineId(Ops[0], 3);
+        case spv::OpTypeFloat:                    return DefineId(Ops[0], 2);
+        case spv::OpTypeVector:                   return DefineId(Ops[0], 3);
+        case spv::OpTypeMatrix:                   return DefineId(Ops[0], 3);
+        case spv::OpTypeImage:                    return DefineId(Ops[0], 8);
+        case spv::OpTypeSampler:                  return DefineId(Ops[0], 1);
+        case spv::OpTypeSampledImage:             return DefineId(Ops[0], 2);
+        case spv::OpTypeArray:                    return DefineId(Ops[0], 3);
+        case spv::OpTypeRuntimeArray:             return DefineId(Ops[0], 2);
+        case spv::OpTypeStruct:                   return DefineId(Ops[0], 1);
+        case spv::OpTypePointer:                  return DefineId(Ops[0], 3);
+        case spv::OpTypeAccelerationStructureKHR: return DefineId(Ops[0], 1);
+        // clang-format on
+
+        case spv::OpConstant:
+        case spv::OpSpecConstant:
+            return NumOps >= 2 && DefineId(Ops[1], 3);
+
+        case spv::OpVariable:
+            if (!DefineId(Ops[1], 3))
+                return false;
+            if (Ops[2] != spv::StorageClassFunction)
+                m_Variables.push_back({Ops[1], Ops[0], static_cast<spv::StorageClass>(Ops[2])});
+            break;
+
+        default:
+            break;
+    }
+
+    return true;
+}
+
+SPIRVResourceParser::Instruction SPIRVResourceParser::GetInstruction(uint32_t Id) const
+{
+    if (Id >= m_IdOffsets.size() || m_IdOffsets[Id] == 0)
+        return {};
+
+    const uint32_t Offset = m_IdOffsets[Id];
+    return {
+        static_cast<spv::Op>(m_pSPIRV[Offset] & spv::OpCodeMask),
+        m_pSPIRV + Offset + 1,
+        (m_pSPIRV[Offset] >> spv::WordCountShift) - 1,
+    };
+}
+
+const char* SPIRVResourceParser::GetName(uint32_t Id) const
+{
+    auto it = m_Names.find(Id);
+    return it != m_Names.end() ? it->second : "";
+}
+
+const SPIRVResourceParser::Decorations* SPIRVResourceParser::FindDecorations(uint32_t Id) const
+{
+    auto it = m_Decorations.find(Id);
+    return it != m_Decorations.end() ? &it->second : nullptr;
+}
+
+bool SPIRVResourceParser::GetConstantValue(uint32_t Id, Uint32& Value) const
+{
+    // Specialization constants can't be evaluated here
+    const Instruction Constant = GetInstruction(Id);
+    if (Constant.Op != spv::OpConstant)
+        return false;
+
+    if (GetInstruction(Constant.Ops[0]).Op != spv::OpTypeInt)
+        return false;
+
+    Value = Constant.Ops[2];
+    return true;
+}
+
+bool SPIRVResourceParser::GetVariableType(const VariableInfo& Var, VariableType& Type) const
+{
+    const Instruction Pointer = GetInstruction(Var.TypeId);
+    if (Pointer.Op != spv::OpTypePointer)
+        return false;
+
+    Type.Storage = static_cast<spv::StorageClass>(Pointer.Ops[1]);
+    Type.BaseId  = Pointer.Ops[2];
+    Type.Base    = GetInstruction(Type.BaseId);
+    if (Type.Base.Op == spv::OpTypeArray)
+    {
+        if (!GetConstantValue(Type.Base.Ops[2], Type.ArraySize))
+            return false;
+        Type.BaseId = Type.Base.Ops[1];
+        Type.Base   = GetInstruction(Type.BaseId);
+    }
+    else if (Type.Base.Op == spv::OpTypeRuntimeArray)
+    {
+        Type.ArraySize = 0;
+        Type.BaseId    = Type.Base.Ops[1];
+        Type.Base      = GetInstruction(Type.BaseId);
+    }
+
+    // Multi-dimensional arrays are not supported
+    if (Type.Base.Op == spv::OpNop || Type.Base.Op == spv::OpTypeArray || Type.Base.Op == spv::OpTypeRuntimeArray)
+        return false;
+
+    if (Type.Base.Op == spv::OpTypeImage)
+    {
+        Type.Image = Type.Base;
+    }
+    else if (Type.Base.Op == spv::OpTypeSampledImage)
+    {
+        Type.Image = GetInstruction(Type.Base.Ops[1]);
+        if (Type.Image.Op != spv::OpTypeImage)
+            return false;
+    }
+
+    return true;
+}
+
+bool SPIRVResourceParser::IsBuiltInVariable(const VariableInfo& Var, const VariableType& Type) const
+{
+    if (const Decorations* pDecor = FindDecorations(Var.Id))
+    {
+        if (pDecor->BuiltIn)
+            return true;
+    }
+
+    // If one member of a struct is a built-in, the struct is also a built-in
+    auto it = m_MemberDecorations.find(Type.BaseId);
+    if (it != m_MemberDecorations.end())
+    {
+        for (const MemberDecorations& Member : it->second)
+        {
+            if (Member.BuiltIn)
+                return true;
+        }
+    }
+
+    return false;
+}
+
+bool SPIRVResourceParser::IsInEntryPointInterface(const VariableInfo& Var) const
+{
+    VERIFY_EXPR(m_pEntryPoint != nullptr);
+
+    // Prior to SPIRV 1.4, only inputs and outputs are listed in the entry point interface
+    if (m_Version < 0x10400)
+    {
+        if (Var.Storage != spv::StorageClassInput && Var.Storage != spv::StorageClassOutput)
+            return true;
+
+        // Old glslang versions did not emit the interface properly for single entry point modules
+        if (m_EntryPoints.size() <= 1)
+            return true;
+    }
+
+    const uint32_t* InterfaceStart = m_pSPIRV + m_pEntryPoint->InterfaceStart;
+    const uint32_t* InterfaceEnd   = m_pSPIRV + m_pEntryPoint->InterfaceEnd;
+    return std::find(InterfaceStart, InterfaceEnd, Var.Id) != InterfaceEnd;
+}
+
+bool SPIRVResourceParser::IsSSBOInstanceNameSignificant() const
+{
+    // See diligent_spirv_cross::Compiler::reflection_ssbo_instance_name_is_significant()
+    if (m_SourceLanguage == spv::SourceLanguageESSL || m_SourceLanguage == spv::SourceLanguageGLSL)
+        return false;
+    if (m_SourceLanguage == spv::SourceLanguageHLSL)
+        return true;
+
+    // If there is no source language information, assume HLSL-style UAV declarations
+    // when the same block type is used by more than one storage buffer.
+    std::unordered_set<uint32_t> SSBOTypes;
+    for (const VariableInfo& Var : m_Variables)
+    {
+        VariableType Type;
+        if (!GetVariableType(Var, Type))
+            continue;
+
+        const Decorations* pDecor = FindDecorations(Type.BaseId);
+
+        const bool IsSSBO = Var.Storage == spv::StorageClassStorageBuffer || (Var.Storage == spv::StorageClassUniform && pDecor != nullptr && pDecor->BufferBlock);
+        if (IsSSBO && !SSBOTypes.insert(Type.BaseId).second)
+            return true;
+    }
+    return false;
+}
+
+std::string SPIRVResourceParser::GetBlockName(const VariableInfo& Var, const VariableType& Type, bool PreferInstanceName) const
+{
+    const char* InstanceName = GetName(Var.Id);
+    if (PreferInstanceName)
+        return InstanceName[0] != '\0' ? std::string{InstanceName} : "_" + std::to_string(Var.Id);
+
+    const char* BlockName = GetName(Type.BaseId);
+    if (BlockName[0] != '\0')
+        return BlockName;
+
+    return InstanceName[0] != '\0' ?
+        std::string{InstanceName} :
+        "_" + std::to_string(Type.BaseId) + "_" + std::to_string(Var.Id);
+}
+
+bool SPIRVResourceParser::GetDeclaredStructSize(uint32_t StructId, size_t& Size, Uint32 Depth) const
+{
+    constexpr Uint32 MaxStructDepth = 64;
+    if (Depth > MaxStructDepth)
+        return false;
+
+    const Instruction Struct = GetInstruction(StructId);
+    if (Struct.Op != spv::OpTypeStruct || Struct.NumOps < 2)
+        return false;
+
+    auto it = m_MemberDecorations.find(StructId);
+    if (it == m_MemberDecorations.end())
+        return false;
+
+    const uint32_t                        NumMembers = Struct.NumOps - 1;
+    const std::vector<MemberDecorations>& Members    = it->second;
+    if (Members.size() < NumMembers)
+        return false;
+
+    // Offsets can be declared out of order, so find the member with the highest offset
+    uint32_t LastMember    = 0;
+    uint32_t HighestOffset = 0;
+    for (uint32_t i = 0; i < NumMembers; ++i)
+    {
+        if (!Members[i].HasOffset)
+            return false;
+        if (Members[i].Offset > HighestOffset)
+        {
+            HighestOffset = Members[i].Offset;
+            LastMember    = i;
+        }
+    }
+
+    size_t MemberSize = 0;
+    if (!GetDeclaredMemberSize(Struct.Ops[1 + LastMember], Members[LastMember], MemberSize, Depth))
+        return false;
+
+    Size = HighestOffset + MemberSize;
+    return true;
+}
+
+bool SPIRVResourceParser::GetDeclaredMemberSize(uint32_t MemberTypeId, const MemberDecorations& MemberDecor, size_t& Size, Uint32 Depth) const
+{
+    const Instruction Type = GetInstruction(MemberTypeId);
+    switch (Type.Op)
+    {
+        case spv::OpTypeArray:
+        case spv::OpTypeRuntimeArray:
+        {
+            const Decorations* pDecor = FindDecorations(MemberTypeId);
+            if (pDecor == nullptr || pDecor->ArrayStride == 0)
+                return false;
+
+            Uint32 Length = 0;
+            if (Type.Op == spv::OpTypeArray && !GetConstantValue(Type.Ops[2], Length))
+                return false;
+
+            Size = size_t{pDecor->ArrayStride} * Length;
+            return true;
+        }
+
+        case spv::OpTypeStruct:
+            return GetDeclaredStructSize(MemberTypeId, Size, Depth + 1);
+
+        case spv::OpTypeInt:
+        case spv::OpTypeFloat:
+            Size = Type.Ops[1] / 8;
+            return true;
+
+        case spv::OpTypeVector:
+        {
+            const Instruction Component = GetInstruction(Type.Ops[1]);
+            if (Component.Op != spv::OpTypeInt && Component.Op != spv::OpTypeFloat)
+                return false;
+            Size = size_t{Type.Ops[2]} * (Component.Ops[1] / 8);
+            return true;
+        }
+
+        case spv::OpTypeMatrix:
+        {
+            const Instruction Column = GetInstruction(Type.Ops[1]);
+            if (Column.Op != spv::OpTypeVector || MemberDecor.MatrixStride == 0)
+                return false;
+
+            if (MemberDecor.RowMajor)
+                Size = size_t{MemberDecor.MatrixStride} * Column.Ops[2];
+            else if (MemberDecor.ColMajor)
+                Size = size_t{MemberDecor.MatrixStride} * Type.Ops[2];
+            else
+                return false;
+            return true;
+        }
+
+        default:
+            // Opaque types, booleans and pointers
+            return false;
+    }
+}
+
+bool SPIRVResourceParser::AddResource(const VariableInfo&                      Var,
+                                      const VariableType&                      Type,
+                                      ResourceGroup                            Group,
+                                      SPIRVShaderResourceAttribs::ResourceType ResType,
+                                      std::string                              Name)
+{
+    const Decorations* pDecor = FindDecorations(Var.Id);
+    if (pDecor == nullptr || pDecor->BindingOffset == 0 || pDecor->DescriptorSetOffset == 0)
+        return false;
+
+    if (Type.ArraySize > std::numeric_limits<Uint16>::max())
+        return false;
+
+    Resource Res;
+    Res.Name                = std::move(Name);
+    Res.Type                = ResType;
+    Res.ArraySize           = static_cast<Uint16>(Type.ArraySize);
+    Res.BindingOffset       = pDecor->BindingOffset;
+    Res.DescriptorSetOffset = pDecor->DescriptorSetOffset;
+    if (Type.Image.Op == spv::OpTypeImage)
+    {
+        // OpTypeImage operands: result id, sampled type, dim, depth, arrayed, MS, sampled, format
+        const bool IsArrayed = Type.Image.Ops[4] != 0;
+        switch (Type.Image.Ops[2])
+        {
+            // clang-format off
+            case spv::Dim1D:     Res.ResourceDim = IsArrayed ? RESOURCE_DIM_TEX_1D_ARRAY   : RESOURCE_DIM_TEX_1D;   break;
+            case spv::Dim2D:     Res.ResourceDim = IsArrayed ? RESOURCE_DIM_TEX_2D_ARRAY   : RESOURCE_DIM_TEX_2D;   break;
+            case spv::Dim3D:     Res.ResourceDim = RESOURCE_DIM_TEX_3D;                                             break;
+            case spv::DimCube:   Res.ResourceDim = IsArrayed ? RESOURCE_DIM_TEX_CUBE_ARRAY : RESOURCE_DIM_TEX_CUBE; break;
+            case spv::DimBuffer: Res.ResourceDim = RESOURCE_DIM_BUFFER;                                             break;
+            default:             Res.ResourceDim = RESOURCE_DIM_UNDEFINED;
+            // clang-format on
+        }
+        Res.IsMS = Type.Image.Ops[5] != 0;
+    }
+
+    if (Group == UniformBuffers || Group == StorageBuffers)
+    {
+        size_t Size = 0;
+        if (!GetDeclaredStructSize(Type.BaseId, Size))
+            return false;
+        Res.BufferStaticSize = static_cast<Uint32>(Size);
+
+        if (Group == StorageBuffers)
+        {
+            // The stride of the runtime array that is the last member of the block, if any
+            const Instruction Struct   = GetInstruction(Type.BaseId);
+            const uint32_t    LastType = Struct.Ops[Struct.NumOps - 1];
+            if (GetInstruction(LastType).Op == spv::OpTypeRuntimeArray)
+            {
+                const Decorations* pLastDecor = FindDecorations(LastType);
+                if (pLastDecor == nullptr || pLastDecor->ArrayStride == 0)
+                    return false;
+                Res.BufferStride = pLastDecor->ArrayStride;
+            }
+        }
+    }
+
+    m_Resources[Group].emplace_back(std::move(Res));
+    return true;
+}
+
+bool SPIRVResourceParser::Reflect(spv::ExecutionModel ExecutionModel)
+{
+    for (const EntryPointInfo& EntryPoint : m_EntryPoints)
+    {
+        if (EntryPoint.Model == ExecutionModel)
+        {
+            // Let SPIRV-Cross resolve ambiguous entry points
+            if (m_pEntryPoint != nullptr)
+                return false;
+            m_pEntryPoint = &EntryPoint;
+        }
+    }
+    if (m_pEntryPoint == nullptr)
+        return false;
+
+    for (const LocalSizeInfo& LocalSize : m_LocalSizes)
+    {
+        if (LocalSize.Function == m_pEntryPoint->Function)
+        {
+            // Local size defined by specialization constants
+            if (LocalSize.IsId)
+                return false;
+            m_LocalSize = LocalSize.Size;
+        }
+    }
+
+    const bool IsHLSLOrSlang           = m_SourceLanguage == spv::SourceLanguageHLSL || m_SourceLanguage == spv::SourceLanguageSlang;
+    const bool SSBOInstanceNameIsKnown = IsSSBOInstanceNameSignificant();
+
+    // See GetUBOrSBName()
+    auto GetUBOrSBName = [&](const VariableInfo& Var, const VariableType& Type, bool PreferInstanceName) {
+        const char* InstanceName = GetName(Var.Id);
+        return (IsHLSLOrSlang && InstanceName[0] != '\0') ? std::string{InstanceName} : GetBlockName(Var, Type, PreferInstanceName);
+    };
+
+    using ResourceType = SPIRVShaderResourceAttribs::ResourceType;
+    for (const VariableInfo& Var : m_Variables)
+    {
+        VariableType Type;
+        if (!GetVariableType(Var, Type))
+            return false;
+
+        if (!IsInEntryPointInterface(Var) || IsBuiltInVariable(Var, Type))
+            continue;
+
+        const Decorations* pBaseDecor   = FindDecorations(Type.BaseId);
+        const bool         IsBlock      = pBaseDecor != nullptr && pBaseDecor->Block;
+        const bool         IsBufferBlock = pBaseDecor != nullptr && pBaseDecor->BufferBlock;
+        const bool         IsImage      = Type.Base.Op == spv::OpTypeImage;
+        const uint32_t     ImageDim     = Type.Image.Op == spv::OpTypeImage ? Type.Image.Ops[2] : static_cast<uint32_t>(spv::DimMax);
+        const uint32_t     ImageSampled = IsImage ? Type.Image.Ops[6] : 0;
+
+        bool Added = true;
+        if (Var.Storage == spv::StorageClassInput)
+        {
+            StageInput Input;
+            Input.Name = GetName(Var.Id);
+            if (const Decorations* pDecor = FindDecorations(Var.Id))
+            {
+                Input.Semantic       = pDecor->HlslSemantic;
+                Input.LocationOffset = pDecor->LocationOffset;
+            }
+            if (Input.Semantic != nullptr && Input.LocationOffset == 0)
+                return false;
+            m_StageInputs.push_back(Input);
+        }
+        else if (Type.Storage == spv::StorageClassUniformConstant && ImageDim == spv::DimSubpassData)
+        {
+            Added = AddResource(Var, Type, InputAttachments, ResourceType::InputAttachment, GetName(Var.Id));
+        }
+        else if (Var.Storage == spv::StorageClassOutput || Type.Storage == spv::StorageClassPushConstant)
+        {
+            continue;
+        }
+        else if (Type.Storage == spv::StorageClassUniform && IsBlock)
+        {
+            Added = AddResource(Var, Type, UniformBuffers, ResourceType::UniformBuffer, GetUBOrSBName(Var, Type, false));
+        }
+        else if ((Type.Storage == spv::StorageClassUniform && IsBufferBlock) || Type.Storage == spv::StorageClassStorageBuffer)
+        {
+            // Read-only if the variable or all members of the block are non-writable
+            bool IsReadOnly = false;
+            if (const Decorations* pDecor = FindDecorations(Var.Id))
+                IsReadOnly = pDecor->NonWritable;
+            if (!IsReadOnly)
+            {
+                const Instruction Struct = GetInstruction(Type.BaseId);
+                auto              it     = m_MemberDecorations.find(Type.BaseId);
+                if (Struct.Op == spv::OpTypeStruct && Struct.NumOps > 1 && it != m_MemberDecorations.end() && it->second.size() >= Struct.NumOps - 1)
+                {
+                    IsReadOnly = true;
+                    for (uint32_t i = 0; i < Struct.NumOps - 1 && IsReadOnly; ++i)
+                        IsReadOnly = it->second[i].NonWritable;
+                }
+            }
+
+            Added = AddResource(Var, Type, StorageBuffers,
+                                IsReadOnly ? ResourceType::ROStorageBuffer : ResourceType::RWStorageBuffer,
+                                GetUBOrSBName(Var, Type, SSBOInstanceNameIsKnown));
+        }
+        else if (Type.Storage == spv::StorageClassUniformConstant && IsImage && ImageSampled == 2)
+        {
+            Added = AddResource(Var, Type, StorageImages,
+                                ImageDim == spv::DimBuffer ? ResourceType::StorageTexelBuffer : ResourceType::StorageImage,
+                                GetName(Var.Id));
+        }
+        else if (Type.Storage == spv::StorageClassUniformConstant && IsImage && ImageSampled == 1)
+        {
+            Added = AddResource(Var, Type, SeparateImages,
+                                ImageDim == spv::DimBuffer ? ResourceType::UniformTexelBuffer : ResourceType::SeparateImage,
+                                GetName(Var.Id));
+        }
+        else if (Type.Storage == spv::StorageClassUniformConstant && Type.Base.Op == spv::OpTypeSampler)
+        {
+            Added = AddResource(Var, Type, SeparateSamplers, ResourceType::SeparateSampler, GetName(Var.Id));
+        }
+        else if (Type.Storage == spv::StorageClassUniformConstant && Type.Base.Op == spv::OpTypeSampledImage)
+        {
+            Added = AddResource(Var, Type, SampledImages,
+                                ImageDim == spv::DimBuffer ? ResourceType::UniformTexelBuffer : ResourceType::SampledImage,
+                                GetName(Var.Id));
+        }
+        else if (Type.Storage == spv::StorageClassAtomicCounter)
+        {
+            Added = AddResource(Var, Type, AtomicCounters, ResourceType::AtomicCounter, GetName(Var.Id));
+        }
+        else if (Type.Storage == spv::StorageClassUniformConstant && Type.Base.Op == spv::OpTypeAccelerationStructureKHR)
+        {
+            Added = AddResource(Var, Type, AccelStructs, ResourceType::AccelerationStructure, GetName(Var.Id));
+        }
+
+        if (!Added)
+            return false;
+    }
+
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please handle the new resource type here, if needed");
+
+    return true;
+}
+
+} // namespace
+
+
+static void LogMissingHlslFunctionality1(const char* ShaderName)
+{
+    LOG_WARNING_MESSAGE("SPIRV byte code of shader '", ShaderName,
+                        "' does not use SPV_GOOGLE_hlsl_functionality1 extension. "
+                        "As a result, it is not possible to get semantics of shader inputs and map them to proper locations. "
+                        "The shader will still work correctly if all attributes are declared in ascending order without any gaps. "
+                        "Enable SPV_GOOGLE_hlsl_functionality1 in your compiler to allow proper mapping of vertex shader inputs.");
+}
 
 SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
                                            std::vector<uint32_t> spirv_binary,
@@ -385,6 +1300,15 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
                                            std::string&          EntryPoint) noexcept(false) :
     m_ShaderType{shaderDesc.ShaderType}
 {
+    // Uniform buffer reflection requires full type information, which is only provided by SPIRV-Cross.
+    // In all other cases, try the lightweight parser first and only fall back to SPIRV-Cross
+    // if the byte code uses constructs the parser does not handle.
+    if (!LoadUniformBufferReflection &&
+        LoadResourcesFromBinary(Allocator, spirv_binary, shaderDesc, CombinedSamplerSuffix, LoadShaderStageInputs, EntryPoint))
+    {
+        return;
+    }
+
     // https://github.com/KhronosGroup/SPIRV-Cross/wiki/Reflection-API-user-guide
     diligent_spirv_cross::Parser parser{std::move(spirv_binary)};
     parser.parse();
@@ -483,11 +1407,7 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
             LoadShaderStageInputs = false;
             if (m_IsHLSLSource)
             {
-                LOG_WARNING_MESSAGE("SPIRV byte code of shader '", shaderDesc.Name,
-                                    "' does not use SPV_GOOGLE_hlsl_functionality1 extension. "
-                                    "As a result, it is not possible to get semantics of shader inputs and map them to proper locations. "
-                                    "The shader will still work correctly if all attributes are declared in ascending order without any gaps. "
-                                    "Enable SPV_GOOGLE_hlsl_functionality1 in your compiler to allow proper mapping of vertex shader inputs.");
+                LogMissingHlslFunctionality1(shaderDesc.Name);
             }
         }
     }
@@ -731,6 +1651,140 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
     //LOG_INFO_MESSAGE(DumpResources());
 }
 
+bool SPIRVShaderResources::LoadResourcesFromBinary(IMemoryAllocator&            Allocator,
+                                                   const std::vector<uint32_t>& SPIRV,
+                                                   const ShaderDesc&            shaderDesc,
+                                                   const char*                  CombinedSamplerSuffix,
+                                                   bool                         LoadShaderStageInputs,
+                                                   std::string&                 EntryPoint)
+{
+    // Entry point overrides are handled by SPIRV-Cross
+    if (!EntryPoint.empty())
+        return false;
+
+    SPIRVResourceParser Parser;
+    if (!Parser.Parse(SPIRV, ShaderTypeToSpvExecutionModel(shaderDesc.ShaderType)))
+        return false;
+
+    m_IsHLSLSource = Parser.IsHLSLSource();
+
+    ResourceCounters ResCounters;
+    ResCounters.NumUBs          = static_cast<Uint32>(Parser.GetResources(SPIRVResourceParser::UniformBuffers).size());
+    ResCounters.NumSBs          = static_cast<Uint32>(Parser.GetResources(SPIRVResourceParser::StorageBuffers).size());
+    ResCounters.NumImgs         = static_cast<Uint32>(Parser.GetResources(SPIRVResourceParser::StorageImages).size());
+    ResCounters.NumSmpldImgs    = static_cast<Uint32>(Parser.GetResources(SPIRVResourceParser::SampledImages).size());
+    ResCounters.NumACs          = static_cast<Uint32>(Parser.GetResources(SPIRVResourceParser::AtomicCounters).size());
+    ResCounters.NumSepSmplrs    = static_cast<Uint32>(Parser.GetResources(SPIRVResourceParser::SeparateSamplers).size());
+    ResCounters.NumSepImgs      = static_cast<Uint32>(Parser.GetResources(SPIRVResourceParser::SeparateImages).size());
+    ResCounters.NumInptAtts     = static_cast<Uint32>(Parser.GetResources(SPIRVResourceParser::InputAttachments).size());
+    ResCounters.NumAccelStructs = static_cast<Uint32>(Parser.GetResources(SPIRVResourceParser::AccelStructs).size());
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please set the new resource type counter here");
+
+    size_t ResourceNamesPoolSize = 0;
+    for (Uint32 Group = 0; Group < SPIRVResourceParser::NumResourceGroups; ++Group)
+    {
+        for (const SPIRVResourceParser::Resource& Res : Parser.GetResources(Group))
+            ResourceNamesPoolSize += Res.Name.length() + 1;
+    }
+
+    if (CombinedSamplerSuffix != nullptr)
+    {
+        ResourceNamesPoolSize += strlen(CombinedSamplerSuffix) + 1;
+    }
+
+    VERIFY_EXPR(shaderDesc.Name != nullptr);
+    ResourceNamesPoolSize += strlen(shaderDesc.Name) + 1;
+
+    const std::vector<SPIRVResourceParser::StageInput>& StageInputs = Parser.GetStageInputs();
+
+    Uint32 NumShaderStageInputs = 0;
+    if (!m_IsHLSLSource || StageInputs.empty())
+        LoadShaderStageInputs = false;
+    if (LoadShaderStageInputs)
+    {
+        if (Parser.HasHlslFunctionality1())
+        {
+            for (const SPIRVResourceParser::StageInput& Input : StageInputs)
+            {
+                if (Input.Semantic != nullptr)
+                {
+                    ResourceNamesPoolSize += strlen(Input.Semantic) + 1;
+                    ++NumShaderStageInputs;
+                }
+                else
+                {
+                    LOG_ERROR_MESSAGE("Shader input '", Input.Name, "' does not have DecorationHlslSemanticGOOGLE decoration, which is unexpected as the shader declares SPV_GOOGLE_hlsl_functionality1 extension");
+                }
+            }
+        }
+        else
+        {
+            LoadShaderStageInputs = false;
+            LogMissingHlslFunctionality1(shaderDesc.Name);
+        }
+    }
+
+    StringPool ResourceNamesPool;
+    Initialize(Allocator, ResCounters, NumShaderStageInputs, ResourceNamesPoolSize, ResourceNamesPool);
+
+    // Resource groups are ordered the same way as resources in the memory buffer
+    Uint32 CurrResource = 0;
+    for (Uint32 Group = 0; Group < SPIRVResourceParser::NumResourceGroups; ++Group)
+    {
+        for (const SPIRVResourceParser::Resource& Res : Parser.GetResources(Group))
+        {
+            new (&GetResource(CurrResource++)) SPIRVShaderResourceAttribs //
+                {
+                    ResourceNamesPool.CopyString(Res.Name),
+                    Res.Type,
+                    Res.ArraySize,
+                    Res.ResourceDim,
+                    Res.IsMS,
+                    Res.BindingOffset,
+                    Res.DescriptorSetOffset,
+                    Res.BufferStaticSize,
+                    Res.BufferStride //
+                };
+        }
+    }
+    VERIFY_EXPR(CurrResource == GetTotalResources());
+
+    if (CombinedSamplerSuffix != nullptr)
+    {
+        m_CombinedSamplerSuffix = ResourceNamesPool.CopyString(CombinedSamplerSuffix);
+    }
+
+    m_ShaderName = ResourceNamesPool.CopyString(shaderDesc.Name);
+
+    if (LoadShaderStageInputs)
+    {
+        Uint32 CurrStageInput = 0;
+        for (const SPIRVResourceParser::StageInput& Input : StageInputs)
+        {
+            if (Input.Semantic != nullptr)
+            {
+                new (&GetShaderStageInputAttribs(CurrStageInput++)) SPIRVShaderStageInputAttribs //
+                    {
+                        ResourceNamesPool.CopyString(Input.Semantic),
+                        Input.LocationOffset //
+                    };
+            }
+        }
+        VERIFY_EXPR(CurrStageInput == GetNumShaderStageInputs());
+    }
+
+    VERIFY(ResourceNamesPool.GetRemainingSize() == 0, "Names pool must be empty");
+
+    if (shaderDesc.ShaderType == SHADER_TYPE_COMPUTE)
+    {
+        m_ComputeGroupSize = Parser.GetLocalSize();
+    }
+
+    EntryPoint = Parser.GetEntryPoint();
+
+    return true;
+}
+
 void SPIRVShaderResources::Initialize(IMemoryAllocator&       Allocator,
                                       const ResourceCounters& Counters,
                                       Uint32                  NumShaderStageInputs,
@@ -155,4 +155,31 @@ std::vector<uint32_t> PatchImageFormats(const std::vector<uint32_t>&
     return PatchedSPIRV;
 }
 
+std::vector<SPIRVSpecializationConstantInfo> GetSPIRVSpecializationConstants(const std::vector<uint32_t>& SPIRV)
+{
+    diligent_spirv_cross::Compiler Compiler{SPIRV};
+
+    std::vector<SPIRVSpecializationConstantInfo> SpecConstants;
+    for (const diligent_spirv_cross::SpecializationConstant& SpecConst : Compiler.get_specialization_constants())
+    {
+        const std::string& Name = Compiler.get_name(SpecConst.id);
+        if (Name.empty())
+            continue;
+
+        const diligent_spirv_cross::SPIRConstant& Const = Compiler.get_constant(SpecConst.id);
+        const diligent_spirv_cross::SPIRType&     Type  = Compiler.get_type(Const.constant_type);
+        if (Type.vecsize != 1 || Type.columns != 1)
+            continue;
+
+        SPIRVSpecializationConstantInfo Info;
+        Info.Name   = Name;
+        Info.SpecId = SpecConst.constant_id;
+        // Booleans are 32-bit values in VkSpecializationInfo (VkBool32)
+        Info.Size = Type.basetype == diligent_spirv_cross::SPIRType::Boolean ? 4 : Type.width / 8;
+        SpecConstants.emplace_back(std::move(Info));
+    }
+
+    return SpecConstants;
+}
+
 } // namespace Diligent
@@ -28,6 +28,8 @@
 #include "ShaderToolsCommon.hpp"
 
 #include <unordered_set>
+#include <unordered_map>
+#include <mutex>
 
 #include "BasicFileSystem.hpp"
 #include "DebugUtilities.hpp"
@@ -35,6 +37,7 @@
 #include "StringDataBlobImpl.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ParsingTools.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
@@ -219,6 +222,102 @@ SHADER_SOURCE_LANGUAGE ParseShaderSourceLanguageDefinition(const std::string& So
         SHADER_SOURCE_LANGUAGE_DEFAULT;
 }
 
+namespace
+{
+
+class ShaderSourceFileCache
+{
+public:
+    static ShaderSourceFileCache& GetInstance()
+    {
+        static ShaderSourceFileCache Cache;
+        return Cache;
+    }
+
+    RefCntAutoPtr<IDataBlob> Load(IShaderSourceInputStreamFactory*        pFactory,
+                                  const char*                             FilePath,
+                                  CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags)
+    {
+        Key FileKey{pFactory, FilePath};
+        {
+            std::lock_guard<std::mutex> Guard{m_Mtx};
+
+            auto it = m_Files.find(FileKey);
+            if (it != m_Files.end())
+            {
+                // A factory created at the address of a released one must not see its files
+                if (it->second.wpFactory.Lock() == pFactory)
+                    return it->second.pData;
+                m_Files.erase(it);
+            }
+        }
+
+        // Read the file without holding the lock
+        RefCntAutoPtr<IFileStream> pSourceStream;
+        pFactory->CreateInputStream2(FilePath, Flags, &pSourceStream);
+        if (pSourceStream == nullptr)
+            return {};
+
+        RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
+        pSourceStream->ReadBlob(pFileData);
+
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        // Another thread may have read the same file in the meantime; keep the first copy
+        const auto it = m_Files.emplace(std::move(FileKey), Entry{RefCntWeakPtr<IShaderSourceInputStreamFactory>{pFactory}, pFileData}).first;
+        return it->second.pData;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        m_Files.clear();
+    }
+
+private:
+    struct Key
+    {
+        const IShaderSourceInputStreamFactory* pFactory;
+        std::string                            Path;
+
+        bool operator==(const Key& RHS) const
+        {
+            return pFactory == RHS.pFactory && Path == RHS.Path;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const Key& K) const
+            {
+                return ComputeHash(K.pFactory, K.Path);
+            }
+        };
+    };
+
+    struct Entry
+    {
+        RefCntWeakPtr<IShaderSourceInputStreamFactory> wpFactory;
+        RefCntAutoPtr<IDataBlob>                       pData;
+    };
+
+    std::mutex                                  m_Mtx;
+    std::unordered_map<Key, Entry, Key::Hasher> m_Files;
+};
+
+} // namespace
+
+RefCntAutoPtr<IDataBlob> LoadShaderSourceFile(IShaderSourceInputStreamFactory*        pShaderSourceStreamFactory,
+                                              const char*                             FilePath,
+                                              CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags)
+{
+    VERIFY_EXPR(pShaderSourceStreamFactory != nullptr && FilePath != nullptr);
+    return ShaderSourceFileCache::GetInstance().Load(pShaderSourceStreamFactory, FilePath, Flags);
+}
+
+void ClearShaderSourceFileCache()
+{
+    ShaderSourceFileCache::GetInstance().Clear();
+}
+
 ShaderSourceFileData ReadShaderSourceFile(const char*                      SourceCode,
                                           size_t                           SourceLength,
                                           IShaderSourceInputStreamFactory* pShaderSourceStreamFactory,
@@ -237,13 +336,10 @@ ShaderSourceFileData ReadShaderSourceFile(const char*                      Sourc
         {
             if (FilePath != nullptr)
             {
-                RefCntAutoPtr<IFileStream> pSourceStream;
-                pShaderSourceStreamFactory->CreateInputStream(FilePath, &pSourceStream);
-                if (pSourceStream == nullptr)
+                SourceData.pFileData = LoadShaderSourceFile(pShaderSourceStreamFactory, FilePath);
+                if (SourceData.pFileData == nullptr)
                     LOG_ERROR_AND_THROW("Failed to load shader source file '", FilePath, '\'');
 
-                SourceData.pFileData = DataBlobImpl::Create();
-                pSourceStream->ReadBlob(SourceData.pFileData);
                 SourceData.Source       = SourceData.pFileData->GetConstDataPtr<char>();
                 SourceData.SourceLength = StaticCast<Uint32>(SourceData.pFileData->GetSize());
             }
@@ -1000,6 +1000,164 @@ WGSLShaderResources::WGSLShaderResources(IMemoryAllocator&      Allocator,
     }
 }
 
+WGSLShaderResources::WGSLShaderResources(IMemoryAllocator&                Allocator,
+                                         const WGSLShaderResourceAttribs* pResources,
+                                         Uint32                           NumResources,
+                                         SHADER_TYPE                      ShaderType,
+                                         const char*                      ShaderName,
+                                         const char*                      CombinedSamplerSuffix,
+                                         const char*                      EntryPoint,
+                                         const char*                      EmulatedArrayIndexSuffix) noexcept(false) :
+    m_ShaderType{ShaderType}
+{
+    VERIFY_EXPR(ShaderName != nullptr);
+    VERIFY_EXPR(pResources != nullptr || NumResources == 0);
+
+    if (EntryPoint == nullptr || EntryPoint[0] == '\0')
+    {
+        LOG_ERROR_AND_THROW("Entry point of shader '", ShaderName, "' must not be empty");
+    }
+
+    // Count resources
+    ResourceCounters ResCounters;
+    size_t           ResourceNamesPoolSize = 0;
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        const WGSLShaderResourceAttribs& Res = pResources[i];
+        switch (Res.Type)
+        {
+            case WGSLShaderResourceAttribs::ResourceType::UniformBuffer:
+                ++ResCounters.NumUBs;
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::ROStorageBuffer:
+            case WGSLShaderResourceAttribs::ResourceType::RWStorageBuffer:
+                ++ResCounters.NumSBs;
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::Sampler:
+            case WGSLShaderResourceAttribs::ResourceType::ComparisonSampler:
+                ++ResCounters.NumSamplers;
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::Texture:
+            case WGSLShaderResourceAttribs::ResourceType::TextureMS:
+            case WGSLShaderResourceAttribs::ResourceType::DepthTexture:
+            case WGSLShaderResourceAttribs::ResourceType::DepthTextureMS:
+                ++ResCounters.NumTextures;
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::WOStorageTexture:
+            case WGSLShaderResourceAttribs::ResourceType::ROStorageTexture:
+            case WGSLShaderResourceAttribs::ResourceType::RWStorageTexture:
+                ++ResCounters.NumStTextures;
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::ExternalTexture:
+                ++ResCounters.NumExtTextures;
+                break;
+
+            default:
+                LOG_ERROR_AND_THROW("Resource '", Res.Name, "' of shader '", ShaderName, "' has unexpected type (", Uint32{Res.Type}, ")");
+        }
+        static_assert(Uint32{WGSLShaderResourceAttribs::ResourceType::NumResourceTypes} == 13, "Please handle the new resource type here, if needed");
+
+        ResourceNamesPoolSize += strlen(Res.Name) + 1;
+    }
+
+    if (CombinedSamplerSuffix != nullptr)
+    {
+        ResourceNamesPoolSize += strlen(CombinedSamplerSuffix) + 1;
+    }
+    if (EmulatedArrayIndexSuffix != nullptr)
+    {
+        ResourceNamesPoolSize += strlen(EmulatedArrayIndexSuffix) + 1;
+    }
+
+    ResourceNamesPoolSize += strlen(ShaderName) + 1;
+    ResourceNamesPoolSize += strlen(EntryPoint) + 1;
+
+    StringPool ResourceNamesPool;
+    Initialize(Allocator, ResCounters, ResourceNamesPoolSize, ResourceNamesPool);
+
+    // Allocate resources
+    ResourceCounters CurrRes;
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        const WGSLShaderResourceAttribs& Res = pResources[i];
+
+        WGSLShaderResourceAttribs* pDstRes = nullptr;
+        switch (Res.Type)
+        {
+            case WGSLShaderResourceAttribs::ResourceType::UniformBuffer:
+                pDstRes = &GetUB(CurrRes.NumUBs++);
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::ROStorageBuffer:
+            case WGSLShaderResourceAttribs::ResourceType::RWStorageBuffer:
+                pDstRes = &GetSB(CurrRes.NumSBs++);
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::Sampler:
+            case WGSLShaderResourceAttribs::ResourceType::ComparisonSampler:
+                pDstRes = &GetSampler(CurrRes.NumSamplers++);
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::Texture:
+            case WGSLShaderResourceAttribs::ResourceType::TextureMS:
+            case WGSLShaderResourceAttribs::ResourceType::DepthTexture:
+            case WGSLShaderResourceAttribs::ResourceType::DepthTextureMS:
+                pDstRes = &GetTexture(CurrRes.NumTextures++);
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::WOStorageTexture:
+            case WGSLShaderResourceAttribs::ResourceType::ROStorageTexture:
+            case WGSLShaderResourceAttribs::ResourceType::RWStorageTexture:
+                pDstRes = &GetStTexture(CurrRes.NumStTextures++);
+                break;
+
+            case WGSLShaderResourceAttribs::ResourceType::ExternalTexture:
+                pDstRes = &GetExtTexture(CurrRes.NumExtTextures++);
+                break;
+
+            default:
+                UNEXPECTED("Unexpected resource type");
+        }
+
+        new (pDstRes) WGSLShaderResourceAttribs{
+            ResourceNamesPool.CopyString(Res.Name),
+            Res.Type,
+            Res.ArraySize,
+            Res.GetResourceDimension(),
+            Res.Format,
+            Res.SampleType,
+            Res.BindGroup,
+            Res.BindIndex,
+            Res.BufferStaticSize,
+        };
+    }
+
+    VERIFY_EXPR(CurrRes.NumUBs == GetNumUBs());
+    VERIFY_EXPR(CurrRes.NumSBs == GetNumSBs());
+    VERIFY_EXPR(CurrRes.NumTextures == GetNumTextures());
+    VERIFY_EXPR(CurrRes.NumStTextures == GetNumStTextures());
+    VERIFY_EXPR(CurrRes.NumSamplers == GetNumSamplers());
+    VERIFY_EXPR(CurrRes.NumExtTextures == GetNumExtTextures());
+
+    if (CombinedSamplerSuffix != nullptr)
+    {
+        m_CombinedSamplerSuffix = ResourceNamesPool.CopyString(CombinedSamplerSuffix);
+    }
+    if (EmulatedArrayIndexSuffix != nullptr)
+    {
+        m_EmulatedArrayIndexSuffix = ResourceNamesPool.CopyString(EmulatedArrayIndexSuffix);
+    }
+
+    m_ShaderName = ResourceNamesPool.CopyString(ShaderName);
+    m_EntryPoint = ResourceNamesPool.CopyString(EntryPoint);
+    VERIFY(ResourceNamesPool.GetRemainingSize() == 0, "Names pool must be empty");
+}
+
 void WGSLShaderResources::Initialize(IMemoryAllocator&       Allocator,
                                      const ResourceCounters& Counters,
                                      size_t                  ResourceNamesPoolSize,
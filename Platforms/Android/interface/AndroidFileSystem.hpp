@@ -89,6 +89,13 @@ public:
 
     static AndroidFile* OpenFile(const FileOpenAttribs& OpenAttribs);
 
+    /// Maps the file into memory for reading.
+
+    /// \remarks Files in the external files directory are mapped with mmap.
+    ///          Asset files are opened in AASSET_MODE_BUFFER mode, and the mapping
+    ///          references the buffer returned by AAsset_getBuffer.
+    static std::unique_ptr<MappedFile> MapFile(const Char* strFilePath);
+
     static bool FileExists(const Char* strFilePath);
 
     static std::string GetLocalAppDataDirectory(const char* AppName = nullptr, bool Create = true);
@@ -63,6 +63,25 @@ std::ios_base::openmode FileAccessModeToIosOpenMode(EFileAccessMode Mode)
     }
 }
 
+// Asset files opened in AASSET_MODE_BUFFER mode are either memory-mapped or
+// decompressed into a buffer that remains valid until the asset is closed.
+class AndroidAssetMappedFile final : public MappedFile
+{
+public:
+    AndroidAssetMappedFile(AAsset* AssetFile, const void* pData, size_t Size) :
+        MappedFile{pData, Size},
+        m_AssetFile{AssetFile}
+    {}
+
+    ~AndroidAssetMappedFile()
+    {
+        AAsset_close(m_AssetFile);
+    }
+
+private:
+    AAsset* const m_AssetFile;
+};
+
 struct AndroidFileSystemHelper
 {
     static AndroidFileSystemHelper& GetInstance()
@@ -141,6 +160,58 @@ struct AndroidFileSystemHelper
         }
     }
 
+    std::unique_ptr<MappedFile> MapFile(const char* fileName)
+    {
+        if (fileName == nullptr || fileName[0] == '\0')
+        {
+            return {};
+        }
+
+        const auto IsAbsolutePath = AndroidFileSystem::IsPathAbsolute(fileName);
+        if (!IsAbsolutePath && m_ExternalFilesDir.empty() && m_AssetManager == nullptr)
+        {
+            LOG_ERROR_MESSAGE("File system has not been initialized. Call AndroidFileSystem::Init().");
+            return {};
+        }
+
+        // First, try mapping the file from the external directory
+        if (IsAbsolutePath)
+        {
+            return LinuxFileSystem::MapFile(fileName);
+        }
+        else if (!m_ExternalFilesDir.empty())
+        {
+            auto ExternalFilesPath = m_ExternalFilesDir;
+            if (ExternalFilesPath.back() != '/')
+                ExternalFilesPath.append("/");
+            ExternalFilesPath.append(fileName);
+            if (std::unique_ptr<MappedFile> pMappedFile = LinuxFileSystem::MapFile(ExternalFilesPath.c_str()))
+                return pMappedFile;
+        }
+
+        if (m_AssetManager == nullptr)
+        {
+            return {};
+        }
+
+        // Fallback to assetManager
+        AAsset* AssetFile = AAssetManager_open(m_AssetManager, fileName, AASSET_MODE_BUFFER);
+        if (AssetFile == nullptr)
+        {
+            return {};
+        }
+
+        const void* pData = AAsset_getBuffer(AssetFile);
+        if (pData == nullptr)
+        {
+            AAsset_close(AssetFile);
+            LOG_ERROR_MESSAGE("Failed to get the buffer of asset: ", fileName);
+            return {};
+        }
+
+        return std::make_unique<AndroidAssetMappedFile>(AssetFile, pData, static_cast<size_t>(AAsset_getLength(AssetFile)));
+    }
+
     const std::string& GetExternalFilesDir() const
     {
         return m_ExternalFilesDir;
@@ -290,6 +361,15 @@ AndroidFile* AndroidFileSystem::OpenFile(const FileOpenAttribs& OpenAttribs)
     return pFile;
 }
 
+std::unique_ptr<MappedFile> AndroidFileSystem::MapFile(const Char* strFilePath)
+{
+    FileOpenAttribs OpenAttribs;
+    OpenAttribs.strFilePath = strFilePath;
+    BasicFile   DummyFile{OpenAttribs};
+    const auto& Path = DummyFile.GetPath(); // This is necessary to correct slashes
+    return AndroidFileSystemHelper::GetInstance().MapFile(Path.c_str());
+}
+
 bool AndroidFileSystem::FileExists(const Char* strFilePath)
 {
     std::fstream    FS;
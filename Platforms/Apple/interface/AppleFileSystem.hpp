@@ -49,6 +49,12 @@ struct AppleFileSystem : public LinuxFileSystem
 public:
     static AppleFile* OpenFile(const FileOpenAttribs& OpenAttribs);
 
+    /// Maps the file into memory for reading. Bundle resources are searched first.
+    static std::unique_ptr<MappedFile> MapFile(const Char* strFilePath);
+
+    /// Opens the file for asynchronous reading using dispatch I/O. Bundle resources are searched first.
+    static std::unique_ptr<AsyncFile> OpenAsyncFile(const Char* strFilePath, ASYNC_FILE_FLAGS Flags = ASYNC_FILE_FLAG_NONE);
+
     static bool FileExists(const Char* strFilePath);
 
     static std::string FindResource(const std::string& FilePath);
@@ -37,6 +37,28 @@ namespace Diligent
 struct AppleMisc : public LinuxMisc
 {
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+
+    /// Apple platforms do not support thread affinity, so this function always returns false.
+    static bool SetCurrentThreadProcessors(const std::vector<Uint32>& Processors);
+
+    static Uint32 GetCurrentProcessorIndex();
+
+    /// Returns the CPU topology built from the hw.perflevel* sysctl values.
+    ///
+    /// \note  Apple platforms do not expose the OS processor numbering, so the processor
+    ///        indices are synthetic: performance levels are enumerated from the fastest
+    ///        to the slowest.
+    static const CPUTopology& GetCPUTopology();
+
+    // Apple platforms do not expose huge pages or NUMA placement
+    using BasicPlatformMisc::AllocateVirtualMemory;
+    using BasicPlatformMisc::FreeVirtualMemory;
+    using BasicPlatformMisc::GetLargePageSize;
+
+    // Futexes are not available on Apple platforms
+    using BasicPlatformMisc::WaitOnAddress;
+    using BasicPlatformMisc::WakeByAddressAll;
+    using BasicPlatformMisc::WakeByAddressSingle;
 };
 
 } // namespace Diligent
@@ -30,6 +30,9 @@
 #include <cstdio>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <fcntl.h>
+#include <cstring>
+#include <dispatch/dispatch.h>
 
 #include <CoreFoundation/CoreFoundation.h>
 #include "CFObjectWrapper.hpp"
@@ -190,6 +193,124 @@ AppleFile* AppleFileSystem::OpenFile(const FileOpenAttribs& OpenAttribs)
     return pFile;
 }
 
+std::unique_ptr<MappedFile> AppleFileSystem::MapFile(const Char* strFilePath)
+{
+    if (strFilePath == nullptr || strFilePath[0] == '\0')
+        return {};
+
+    // Try to find the file in the bundle first
+    std::string path{strFilePath};
+    CorrectSlashes(path);
+    const auto resource_path = FindResource(path);
+    if (!resource_path.empty())
+    {
+        if (std::unique_ptr<MappedFile> pMappedFile = LinuxFileSystem::MapFile(resource_path.c_str()))
+            return pMappedFile;
+    }
+
+    return LinuxFileSystem::MapFile(strFilePath);
+}
+
+namespace
+{
+
+// Reads are scheduled by a dispatch I/O channel, and completion handlers run on a concurrent dispatch queue
+class AppleAsyncFile final : public AsyncFile
+{
+public:
+    AppleAsyncFile(int fd, Uint64 Size) :
+        AsyncFile{Size, 1}
+    {
+        m_Queue   = dispatch_queue_create("Diligent.AsyncFile", DISPATCH_QUEUE_CONCURRENT);
+        m_Channel = dispatch_io_create(DISPATCH_IO_RANDOM, fd, m_Queue, ^(int /*error*/) {
+          close(fd);
+        });
+    }
+
+    ~AppleAsyncFile()
+    {
+        WaitForAll();
+        dispatch_io_close(m_Channel, 0);
+        dispatch_release(m_Channel);
+        dispatch_release(m_Queue);
+    }
+
+    virtual bool Read(const AsyncFileReadRequest* pRequests, Uint32 NumRequests, const CompletionCallbackType& Callback) override final
+    {
+        if (!BeginReads(pRequests, NumRequests))
+            return false;
+
+        auto pCallback = std::make_shared<const CompletionCallbackType>(Callback);
+        for (Uint32 i = 0; i < NumRequests; ++i)
+        {
+            const AsyncFileReadRequest Req = pRequests[i];
+
+            // The handler is called one or more times as the data arrives
+            __block size_t BytesRead = 0;
+            dispatch_io_read(m_Channel, static_cast<off_t>(Req.Offset), Req.Size, m_Queue, ^(bool Done, dispatch_data_t Data, int Error) {
+              if (Data != nullptr)
+              {
+                  Uint8* pDst = static_cast<Uint8*>(Req.pDst) + BytesRead;
+                  dispatch_data_apply(Data, ^bool(dispatch_data_t /*Region*/, size_t Offset, const void* pBuffer, size_t Size) {
+                    memcpy(pDst + Offset, pBuffer, Size);
+                    return true;
+                  });
+                  BytesRead += dispatch_data_get_size(Data);
+              }
+
+              if (Done)
+                  CompleteRead(*pCallback, Req, BytesRead, Error == 0);
+            });
+        }
+
+        return true;
+    }
+
+private:
+    dispatch_queue_t m_Queue   = nullptr;
+    dispatch_io_t    m_Channel = nullptr;
+};
+
+std::unique_ptr<AsyncFile> OpenAppleAsyncFile(const std::string& Path, ASYNC_FILE_FLAGS Flags)
+{
+    const int fd = open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return {};
+
+    struct stat StatBuff;
+    if (fstat(fd, &StatBuff) != 0 || !S_ISREG(StatBuff.st_mode))
+    {
+        close(fd);
+        return {};
+    }
+
+    // F_NOCACHE has no alignment requirements
+    if (Flags & ASYNC_FILE_FLAG_UNBUFFERED)
+        fcntl(fd, F_NOCACHE, 1);
+
+    return std::make_unique<AppleAsyncFile>(fd, static_cast<Uint64>(StatBuff.st_size));
+}
+
+} // namespace
+
+std::unique_ptr<AsyncFile> AppleFileSystem::OpenAsyncFile(const Char* strFilePath, ASYNC_FILE_FLAGS Flags)
+{
+    if (strFilePath == nullptr || strFilePath[0] == '\0')
+        return {};
+
+    // Try to find the file in the bundle first
+    std::string path{strFilePath};
+    CorrectSlashes(path);
+    const auto resource_path = FindResource(path);
+    if (!resource_path.empty())
+    {
+        if (std::unique_ptr<AsyncFile> pFile = OpenAppleAsyncFile(resource_path, Flags))
+            return pFile;
+    }
+
+    return OpenAppleAsyncFile(path, Flags);
+}
+
 bool AppleFileSystem::FileExists(const Char* strFilePath)
 {
     if (LinuxFileSystem::FileExists(strFilePath))
@@ -26,6 +26,12 @@
 
 #include "ApplePlatformMisc.hpp"
 
+#include <string>
+#include <thread>
+#include <algorithm>
+
+#include <sys/sysctl.h>
+
 namespace Diligent
 {
 
@@ -35,4 +41,64 @@ Uint64 AppleMisc::SetCurrentThreadAffinity(Uint64 Mask)
     return 0;
 }
 
+bool AppleMisc::SetCurrentThreadProcessors(const std::vector<Uint32>& Processors)
+{
+    // MacOS does not support affinity setting
+    return false;
+}
+
+Uint32 AppleMisc::GetCurrentProcessorIndex()
+{
+    return CPUProcessorInfo::InvalidId;
+}
+
+static Uint32 GetSysCtlUint(const char* Name, Uint32 DefaultValue)
+{
+    int    Value = 0;
+    size_t Size  = sizeof(Value);
+    return sysctlbyname(Name, &Value, &Size, nullptr, 0) == 0 && Value > 0 ? static_cast<Uint32>(Value) : DefaultValue;
+}
+
+const CPUTopology& AppleMisc::GetCPUTopology()
+{
+    static const CPUTopology Topology = [] {
+        CPUTopology Topo;
+
+        const Uint32 NumLogical    = GetSysCtlUint("hw.logicalcpu", std::max(std::thread::hardware_concurrency(), 1u));
+        const Uint32 NumPhysical   = GetSysCtlUint("hw.physicalcpu", NumLogical);
+        // Performance levels are available since macOS 12 and iOS 15. Level 0 is the fastest.
+        const Uint32 NumPerfLevels = GetSysCtlUint("hw.nperflevels", 1);
+
+        Uint32 CoreId    = 0;
+        Uint32 L2GroupId = 0;
+        for (Uint32 Level = 0; Level < NumPerfLevels; ++Level)
+        {
+            const std::string Prefix = "hw.perflevel" + std::to_string(Level) + ".";
+
+            const Uint32 LevelLogical   = NumPerfLevels > 1 ? GetSysCtlUint((Prefix + "logicalcpu").c_str(), 0) : NumLogical;
+            const Uint32 LevelPhysical  = NumPerfLevels > 1 ? GetSysCtlUint((Prefix + "physicalcpu").c_str(), LevelLogical) : NumPhysical;
+            const Uint32 CPUsPerL2      = GetSysCtlUint((Prefix + "cpusperl2").c_str(), 0);
+            const Uint32 ThreadsPerCore = std::max(LevelLogical / std::max(LevelPhysical, 1u), 1u);
+
+            for (Uint32 i = 0; i < LevelLogical; ++i)
+            {
+                CPUProcessorInfo Proc;
+                Proc.Index     = static_cast<Uint32>(Topo.Processors.size());
+                Proc.CoreId    = CoreId + i / ThreadsPerCore;
+                Proc.L2GroupId = CPUsPerL2 != 0 ? L2GroupId + i / CPUsPerL2 : CPUProcessorInfo::InvalidId;
+                Proc.CoreType  = NumPerfLevels > 1 ? (Level == 0 ? CPUCoreType::Performance : CPUCoreType::Efficiency) : CPUCoreType::Unknown;
+                Topo.Processors.push_back(Proc);
+            }
+
+            CoreId += (LevelLogical + ThreadsPerCore - 1) / ThreadsPerCore;
+            if (CPUsPerL2 != 0)
+                L2GroupId += (LevelLogical + CPUsPerL2 - 1) / CPUsPerL2;
+        }
+
+        FinalizeCPUTopology(Topo);
+        return Topo;
+    }();
+    return Topology;
+}
+
 } // namespace Diligent
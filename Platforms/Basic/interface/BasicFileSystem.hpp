@@ -28,6 +28,10 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
 #include "../../../Primitives/interface/BasicTypes.h"
 #include "../../../Primitives/interface/FlagEnum.h"
 
@@ -77,6 +81,121 @@ protected:
     const FileOpenAttribs m_OpenAttribs;
 };
 
+/// Read-only view of a file mapped into the process address space
+class MappedFile
+{
+public:
+    virtual ~MappedFile() {}
+
+    /// Returns the pointer to the file data, or null if the file is empty
+    const void* GetData() const { return m_pData; }
+
+    /// Returns the file size, in bytes
+    size_t GetSize() const { return m_Size; }
+
+protected:
+    MappedFile(const void* pData, size_t Size) :
+        m_pData{pData},
+        m_Size{Size}
+    {}
+
+    const void* const m_pData;
+    const size_t      m_Size;
+};
+
+
+/// Asynchronous file flags, see BasicFileSystem::OpenAsyncFile().
+enum ASYNC_FILE_FLAGS : Uint32
+{
+    ASYNC_FILE_FLAG_NONE = 0u,
+
+    /// Bypass the OS page cache (O_DIRECT on Linux, FILE_FLAG_NO_BUFFERING on Windows,
+    /// F_NOCACHE on Apple platforms). Read offsets, sizes and destination addresses
+    /// must be multiples of AsyncFile::GetAlignment().
+    ASYNC_FILE_FLAG_UNBUFFERED = 1u << 0u
+};
+DEFINE_FLAG_ENUM_OPERATORS(ASYNC_FILE_FLAGS);
+
+/// Asynchronous read request, see AsyncFile::Read().
+struct AsyncFileReadRequest
+{
+    /// Offset in the file, in bytes.
+    Uint64 Offset = 0;
+
+    /// The maximum number of bytes that can be read by a single request.
+    static constexpr Uint64 MaxSize = 0xFFFFFFFFu;
+
+    /// The number of bytes to read, up to MaxSize.
+    size_t Size = 0;
+
+    /// Destination buffer. The buffer must remain valid until the completion callback is called.
+    void* pDst = nullptr;
+
+    /// User data that is passed to the completion callback with the request.
+    void* pUserData = nullptr;
+};
+
+/// File that is read asynchronously
+class AsyncFile
+{
+public:
+    /// Read completion callback.
+
+    /// BytesRead is less than the request size when the end of file is reached.
+    /// Success is false when the read failed, in which case BytesRead is zero.
+    using CompletionCallbackType = std::function<void(const AsyncFileReadRequest& Request, size_t BytesRead, bool Success)>;
+
+    virtual ~AsyncFile() {}
+
+    /// Submits a batch of reads.
+
+    /// \param [in] pRequests   - Read requests.
+    /// \param [in] NumRequests - The number of requests.
+    /// \param [in] Callback    - Callback that is called once for every request when the read is complete.
+    /// \return    true if the requests were submitted, and false if any request is invalid.
+    ///            In the latter case, the callback is not called for any request in the batch.
+    ///            I/O errors are reported through the callback.
+    ///
+    /// The callback is called from an I/O completion thread in unspecified order and should
+    /// return quickly. Use MakeThreadPoolCallback() to process the data in a thread pool.
+    /// The method may be called from multiple threads simultaneously.
+    virtual bool Read(const AsyncFileReadRequest* pRequests, Uint32 NumRequests, const CompletionCallbackType& Callback) = 0;
+
+    /// Blocks until all submitted reads are complete and their callbacks have returned.
+    void WaitForAll();
+
+    /// Returns the file size, in bytes.
+    Uint64 GetSize() const { return m_Size; }
+
+    /// Returns the required alignment of read offsets, sizes and destination addresses.
+    Uint32 GetAlignment() const { return m_Alignment; }
+
+protected:
+    AsyncFile(Uint64 Size, Uint32 Alignment) :
+        m_Size{Size},
+        m_Alignment{Alignment}
+    {}
+
+    /// Validates the requests and reserves them in the pending read counter.
+    bool BeginReads(const AsyncFileReadRequest* pRequests, Uint32 NumRequests);
+
+    /// Cancels the reservation made by BeginReads for the requests that were not submitted.
+    void CancelReads(Uint32 NumRequests);
+
+    /// Calls the callback and releases the request from the pending read counter.
+    void CompleteRead(const CompletionCallbackType& Callback, const AsyncFileReadRequest& Request, size_t BytesRead, bool Success);
+
+    const Uint64 m_Size;
+    const Uint32 m_Alignment;
+
+private:
+    void ReleasePendingReads(Uint32 NumRequests);
+
+    std::mutex              m_PendingMtx;
+    std::condition_variable m_PendingCV;
+    Uint32                  m_NumPendingReads = 0;
+};
+
 
 enum FILE_DIALOG_FLAGS : Uint32
 {
@@ -137,6 +256,16 @@ struct FindFileData
     bool   IsDirectory = false;
 };
 
+/// File information, see BasicFileSystem::GetFileInfo().
+struct FileInfo
+{
+    /// File size, in bytes.
+    Uint64 Size = 0;
+
+    /// Last modification time, in seconds since the Unix epoch.
+    Int64 LastWriteTime = 0;
+};
+
 /// Basic platform-specific file system functions
 struct BasicFileSystem
 {
@@ -152,8 +281,40 @@ public:
     static BasicFile* OpenFile(FileOpenAttribs& OpenAttribs);
     static void       ReleaseFile(BasicFile*);
 
+    /// Maps the file into memory for reading.
+
+    /// \param [in] strFilePath - Path to the file.
+    /// \return     The file mapping, or null if the file could not be mapped or if
+    ///             memory mapping is not supported by the platform.
+    static std::unique_ptr<MappedFile> MapFile(const Char* strFilePath);
+
+    /// Opens the file for asynchronous reading.
+
+    /// \param [in] strFilePath - Path to the file.
+    /// \param [in] Flags       - Flags, see ASYNC_FILE_FLAGS.
+    /// \return     The file, or null if the file could not be opened or if
+    ///             asynchronous reads are not supported by the platform.
+    static std::unique_ptr<AsyncFile> OpenAsyncFile(const Char* strFilePath, ASYNC_FILE_FLAGS Flags = ASYNC_FILE_FLAG_NONE);
+
     static bool FileExists(const Char* strFilePath);
 
+    /// Retrieves the size and the last modification time of the file.
+
+    /// \param [in]  strFilePath - Path to the file.
+    /// \param [out] Info        - File information.
+    /// \return      true if the information was retrieved, and false if the file does not
+    ///              exist or if the function is not supported by the platform.
+    static bool GetFileInfo(const Char* strFilePath, FileInfo& Info);
+
+    /// Sets the last modification time of the file to the current time.
+    static bool TouchFile(const Char* strFilePath);
+
+    /// Renames the file, replacing the destination file if it exists.
+    ///
+    /// \remarks On platforms that support it, the replacement is atomic: other processes
+    ///          open either the old or the new file, but never a partially written one.
+    static bool RenameFile(const Char* strSrcPath, const Char* strDstPath);
+
     static void SetWorkingDirectory(const Char* strWorkingDir) { m_strWorkingDirectory = strWorkingDir; }
 
     static const String& GetWorkingDirectory() { return m_strWorkingDirectory; }
@@ -27,7 +27,10 @@
 
 #pragma once
 
+#include <vector>
+
 #include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Primitives/interface/FlagEnum.h"
 
 namespace Diligent
 {
@@ -42,6 +45,81 @@ enum class ThreadPriority
     Highest
 };
 
+/// CPU core type on hybrid architectures
+enum class CPUCoreType : Uint8
+{
+    /// The core type is unknown, or the CPU is not hybrid
+    Unknown,
+
+    /// Performance core (Intel P-core, ARM big core, Apple P-cluster core)
+    Performance,
+
+    /// Efficiency core (Intel E-core, ARM LITTLE core, Apple E-cluster core)
+    Efficiency
+};
+
+/// Logical processor description, see CPUTopology.
+struct CPUProcessorInfo
+{
+    static constexpr Uint32 InvalidId = ~0u;
+
+    /// OS index of the logical processor that is used to set thread affinity.
+    ///
+    /// \note  On Windows, the index is Group * 64 + Number, so it may not be contiguous
+    ///        on systems with more than one processor group.
+    Uint32 Index = 0;
+
+    /// Physical core id. SMT siblings share the same id. The ids are in the range [0, CPUTopology::NumPhysicalCores).
+    Uint32 CoreId = 0;
+
+    /// Processor package (socket) id in the range [0, CPUTopology::NumPackages).
+    Uint32 PackageId = 0;
+
+    /// NUMA node id in the range [0, CPUTopology::NumNUMANodes).
+    Uint32 NUMANode = 0;
+
+    /// Id of the group of processors that share the L2 cache, or InvalidId if unknown.
+    Uint32 L2GroupId = InvalidId;
+
+    /// Id of the group of processors that share the L3 cache, or InvalidId if unknown.
+    Uint32 L3GroupId = InvalidId;
+
+    /// Core type.
+    CPUCoreType CoreType = CPUCoreType::Unknown;
+};
+
+/// CPU topology, see PlatformMisc::GetCPUTopology().
+struct CPUTopology
+{
+    /// Logical processors sorted by their OS index.
+    std::vector<CPUProcessorInfo> Processors;
+
+    Uint32 NumPhysicalCores = 0;
+    Uint32 NumPackages      = 0;
+    Uint32 NumNUMANodes     = 0;
+
+    /// OS ids of the NUMA nodes indexed by CPUProcessorInfo::NUMANode.
+    std::vector<Uint32> NUMANodeOSIds;
+
+    /// Whether the CPU has cores of different types.
+    bool IsHybrid = false;
+
+    /// Returns the description of the logical processor with the given OS index,
+    /// or null if there is no such processor.
+    const CPUProcessorInfo* GetProcessor(Uint32 Index) const;
+};
+
+/// Virtual memory allocation flags, see BasicPlatformMisc::AllocateVirtualMemory().
+enum VIRTUAL_MEMORY_FLAGS : Uint32
+{
+    VIRTUAL_MEMORY_FLAG_NONE = 0u,
+
+    /// Back the memory with large pages (huge pages on Linux, MEM_LARGE_PAGES on Windows).
+    /// The size must be a multiple of BasicPlatformMisc::GetLargePageSize().
+    VIRTUAL_MEMORY_FLAG_LARGE_PAGES = 1u << 0u
+};
+DEFINE_FLAG_ENUM_OPERATORS(VIRTUAL_MEMORY_FLAGS);
+
 /// Basic platform-specific miscellaneous functions
 struct BasicPlatformMisc
 {
@@ -111,6 +189,71 @@ struct BasicPlatformMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
 
+    /// Restricts the current thread to the given logical processors.
+    ///
+    /// \param [in] Processors - OS indices of the logical processors, see CPUProcessorInfo::Index.
+    ///                          Unlike SetCurrentThreadAffinity, the indices are not limited to 64.
+    /// \return    true if the affinity was set successfully, and false otherwise.
+    static bool SetCurrentThreadProcessors(const std::vector<Uint32>& Processors);
+
+    /// Returns the OS index of the logical processor the current thread is running on,
+    /// or CPUProcessorInfo::InvalidId if the platform does not provide this information.
+    static Uint32 GetCurrentProcessorIndex();
+
+    /// Returns the CPU topology. The topology is queried once and cached.
+    ///
+    /// On platforms that do not expose the topology, every logical processor reported
+    /// by std::thread::hardware_concurrency() is described as a separate physical core.
+    static const CPUTopology& GetCPUTopology();
+
+    /// Returns the size of the large page, or 0 if large pages are not available to the process.
+    static size_t GetLargePageSize();
+
+    /// Allocates page-aligned virtual memory.
+    ///
+    /// \param [in] Size     - Allocation size. Must be a multiple of the large page size
+    ///                        when VIRTUAL_MEMORY_FLAG_LARGE_PAGES is used.
+    /// \param [in] Flags    - Allocation flags, see VIRTUAL_MEMORY_FLAGS.
+    /// \param [in] NUMANode - NUMA node to allocate the memory on (see CPUProcessorInfo::NUMANode),
+    ///                        or CPUProcessorInfo::InvalidId to use the default OS policy.
+    /// \return    Pointer to the allocated memory, or null if the allocation failed, for example
+    ///            because no large pages are available. The memory must be released with
+    ///            FreeVirtualMemory().
+    ///
+    /// \note  Platforms that do not support large pages or NUMA placement ignore the
+    ///        corresponding parameters.
+    static void* AllocateVirtualMemory(size_t Size, VIRTUAL_MEMORY_FLAGS Flags = VIRTUAL_MEMORY_FLAG_NONE, Uint32 NUMANode = CPUProcessorInfo::InvalidId);
+
+    /// Releases the memory allocated by AllocateVirtualMemory().
+    ///
+    /// \param [in] Ptr  - Pointer returned by AllocateVirtualMemory().
+    /// \param [in] Size - Size that was passed to AllocateVirtualMemory().
+    static void FreeVirtualMemory(void* Ptr, size_t Size);
+
+    /// Blocks the calling thread while the 32-bit value at the given address is equal to CompareValue.
+
+    /// \param [in] pAddress     - Address of the value to wait on, typically the address of std::atomic<Uint32>.
+    /// \param [in] CompareValue - The value to compare with. If the value at the address is different,
+    ///                            the function returns immediately.
+    ///
+    /// The function returns when another thread calls WakeByAddressSingle() or WakeByAddressAll()
+    /// for the same address, but may also return spuriously, so the caller must re-check the value
+    /// in a loop. The thread that modifies the value must do so before waking the waiters.
+    ///
+    /// The basic implementation parks the thread on one of the mutex/condition variable pairs
+    /// selected by the address hash. Platforms that support futexes use them instead.
+    static void WaitOnAddress(const void* pAddress, Uint32 CompareValue);
+
+    /// Wakes up one thread waiting in WaitOnAddress() for the given address.
+    static void WakeByAddressSingle(const void* pAddress);
+
+    /// Wakes up all threads waiting in WaitOnAddress() for the given address.
+    static void WakeByAddressAll(const void* pAddress);
+
+protected:
+    /// Converts raw platform ids in the topology into dense ids and computes the totals.
+    static void FinalizeCPUTopology(CPUTopology& Topology);
+
 private:
     static void SwapBytes16(Uint16& Val)
     {
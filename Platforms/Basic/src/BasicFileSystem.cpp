@@ -88,11 +88,95 @@ void BasicFileSystem::ReleaseFile(BasicFile* pFile)
         delete pFile;
 }
 
+std::unique_ptr<MappedFile> BasicFileSystem::MapFile(const Char* strFilePath)
+{
+    // Memory mapping is not supported by default
+    return {};
+}
+
+std::unique_ptr<AsyncFile> BasicFileSystem::OpenAsyncFile(const Char* strFilePath, ASYNC_FILE_FLAGS Flags)
+{
+    // Asynchronous reads are not supported by default
+    return {};
+}
+
 bool BasicFileSystem::FileExists(const Char* strFilePath)
 {
     return false;
 }
 
+bool BasicFileSystem::GetFileInfo(const Char* strFilePath, FileInfo& Info)
+{
+    // File information is not supported by default
+    return false;
+}
+
+bool BasicFileSystem::TouchFile(const Char* strFilePath)
+{
+    return false;
+}
+
+bool BasicFileSystem::RenameFile(const Char* strSrcPath, const Char* strDstPath)
+{
+    return false;
+}
+
+bool AsyncFile::BeginReads(const AsyncFileReadRequest* pRequests, Uint32 NumRequests)
+{
+    for (Uint32 i = 0; i < NumRequests; ++i)
+    {
+        const AsyncFileReadRequest& Req = pRequests[i];
+        if (Req.pDst == nullptr && Req.Size != 0)
+        {
+            DEV_ERROR("Destination buffer of request ", i, " is null");
+            return false;
+        }
+        if (static_cast<Uint64>(Req.Size) > AsyncFileReadRequest::MaxSize)
+        {
+            DEV_ERROR("Size of request ", i, " exceeds the maximum allowed size");
+            return false;
+        }
+        if (m_Alignment > 1 &&
+            (Req.Offset % m_Alignment != 0 || Req.Size % m_Alignment != 0 || reinterpret_cast<size_t>(Req.pDst) % m_Alignment != 0))
+        {
+            DEV_ERROR("Offset, size and destination address of request ", i, " must be multiples of ", m_Alignment);
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock{m_PendingMtx};
+    m_NumPendingReads += NumRequests;
+    return true;
+}
+
+void AsyncFile::CancelReads(Uint32 NumRequests)
+{
+    ReleasePendingReads(NumRequests);
+}
+
+void AsyncFile::ReleasePendingReads(Uint32 NumRequests)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_PendingMtx};
+        VERIFY_EXPR(m_NumPendingReads >= NumRequests);
+        m_NumPendingReads -= NumRequests;
+    }
+    m_PendingCV.notify_all();
+}
+
+void AsyncFile::CompleteRead(const CompletionCallbackType& Callback, const AsyncFileReadRequest& Request, size_t BytesRead, bool Success)
+{
+    if (Callback)
+        Callback(Request, Success ? BytesRead : 0, Success);
+    ReleasePendingReads(1);
+}
+
+void AsyncFile::WaitForAll()
+{
+    std::unique_lock<std::mutex> Lock{m_PendingMtx};
+    m_PendingCV.wait(Lock, [this] { return m_NumPendingReads == 0; });
+}
+
 void BasicFileSystem::CorrectSlashes(String& Path, Char Slash)
 {
     if (Slash != 0)
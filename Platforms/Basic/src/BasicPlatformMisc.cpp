@@ -27,6 +27,18 @@
 #include "BasicPlatformMisc.hpp"
 #include "DebugUtilities.hpp"
 
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+#include <cstdlib>
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
+
+#ifdef _MSC_VER
+#    include <malloc.h>
+#endif
+
 namespace Diligent
 {
 
@@ -48,4 +60,165 @@ Uint64 BasicPlatformMisc::SetCurrentThreadAffinity(Uint64 Mask)
     return 0;
 }
 
+bool BasicPlatformMisc::SetCurrentThreadProcessors(const std::vector<Uint32>& Processors)
+{
+    LOG_WARNING_MESSAGE_ONCE("SetCurrentThreadProcessors is not implemented on this platform.");
+    return false;
+}
+
+Uint32 BasicPlatformMisc::GetCurrentProcessorIndex()
+{
+    return CPUProcessorInfo::InvalidId;
+}
+
+const CPUTopology& BasicPlatformMisc::GetCPUTopology()
+{
+    static const CPUTopology Topology = [] {
+        CPUTopology Topo;
+
+        const Uint32 NumProcessors = std::max(std::thread::hardware_concurrency(), 1u);
+        Topo.Processors.resize(NumProcessors);
+        for (Uint32 i = 0; i < NumProcessors; ++i)
+        {
+            Topo.Processors[i].Index  = i;
+            Topo.Processors[i].CoreId = i;
+        }
+        FinalizeCPUTopology(Topo);
+
+        return Topo;
+    }();
+    return Topology;
+}
+
+void BasicPlatformMisc::FinalizeCPUTopology(CPUTopology& Topology)
+{
+    auto& Processors = Topology.Processors;
+    std::sort(Processors.begin(), Processors.end(),
+              [](const CPUProcessorInfo& Lhs, const CPUProcessorInfo& Rhs) {
+                  return Lhs.Index < Rhs.Index;
+              });
+
+    // Remaps raw platform ids to dense ids in the order of first appearance
+    auto Compact = [&Processors](Uint32 CPUProcessorInfo::*Member, std::vector<Uint32>* pRawIds = nullptr) {
+        std::unordered_map<Uint32, Uint32> IdMap;
+        for (auto& Proc : Processors)
+        {
+            Uint32& Id = Proc.*Member;
+            if (Id == CPUProcessorInfo::InvalidId)
+                continue;
+            auto it = IdMap.emplace(Id, static_cast<Uint32>(IdMap.size()));
+            if (it.second && pRawIds != nullptr)
+                pRawIds->push_back(Id);
+            Id = it.first->second;
+        }
+        return static_cast<Uint32>(IdMap.size());
+    };
+
+    Topology.NumPhysicalCores = Compact(&CPUProcessorInfo::CoreId);
+    Topology.NumPackages      = std::max(Compact(&CPUProcessorInfo::PackageId), 1u);
+    Topology.NumNUMANodes     = std::max(Compact(&CPUProcessorInfo::NUMANode, &Topology.NUMANodeOSIds), 1u);
+    if (Topology.NUMANodeOSIds.empty())
+        Topology.NUMANodeOSIds.push_back(0);
+    Compact(&CPUProcessorInfo::L2GroupId);
+    Compact(&CPUProcessorInfo::L3GroupId);
+
+    bool HasPerformanceCores = false;
+    bool HasEfficiencyCores  = false;
+    for (const auto& Proc : Processors)
+    {
+        HasPerformanceCores = HasPerformanceCores || Proc.CoreType == CPUCoreType::Performance;
+        HasEfficiencyCores  = HasEfficiencyCores || Proc.CoreType == CPUCoreType::Efficiency;
+    }
+
+    Topology.IsHybrid = HasPerformanceCores && HasEfficiencyCores;
+    if (!Topology.IsHybrid)
+    {
+        for (auto& Proc : Processors)
+            Proc.CoreType = CPUCoreType::Unknown;
+    }
+}
+
+size_t BasicPlatformMisc::GetLargePageSize()
+{
+    return 0;
+}
+
+void* BasicPlatformMisc::AllocateVirtualMemory(size_t Size, VIRTUAL_MEMORY_FLAGS Flags, Uint32 NUMANode)
+{
+    VERIFY_EXPR(Size > 0);
+    if ((Flags & VIRTUAL_MEMORY_FLAG_LARGE_PAGES) != 0)
+        return nullptr;
+
+    constexpr size_t PageSize = 4096;
+#ifdef _MSC_VER
+    return _aligned_malloc(Size, PageSize);
+#else
+    void* Ptr = nullptr;
+    return posix_memalign(&Ptr, PageSize, Size) == 0 ? Ptr : nullptr;
+#endif
+}
+
+void BasicPlatformMisc::FreeVirtualMemory(void* Ptr, size_t Size)
+{
+#ifdef _MSC_VER
+    _aligned_free(Ptr);
+#else
+    free(Ptr);
+#endif
+}
+
+const CPUProcessorInfo* CPUTopology::GetProcessor(Uint32 Index) const
+{
+    auto It = std::lower_bound(Processors.begin(), Processors.end(), Index,
+                               [](const CPUProcessorInfo& Proc, Uint32 Idx) {
+                                   return Proc.Index < Idx;
+                               });
+    return It != Processors.end() && It->Index == Index ? &*It : nullptr;
+}
+
+namespace
+{
+
+struct AddressWaitBucket
+{
+    std::mutex              Mtx;
+    std::condition_variable CondVar;
+};
+
+AddressWaitBucket& GetAddressWaitBucket(const void* pAddress)
+{
+    constexpr size_t         NumBuckets = 64;
+    static AddressWaitBucket Buckets[NumBuckets];
+    // Atomics are at least 4-byte aligned, so drop the low bits
+    return Buckets[(reinterpret_cast<uintptr_t>(pAddress) >> 2) % NumBuckets];
+}
+
+} // namespace
+
+void BasicPlatformMisc::WaitOnAddress(const void* pAddress, Uint32 CompareValue)
+{
+    AddressWaitBucket& Bucket = GetAddressWaitBucket(pAddress);
+
+    std::unique_lock<std::mutex> Lock{Bucket.Mtx};
+    // The value is modified before WakeByAddress*() locks the same mutex, so either
+    // we see the new value here or the notification arrives after we start waiting.
+    if (*static_cast<const volatile Uint32*>(pAddress) == CompareValue)
+        Bucket.CondVar.wait(Lock);
+}
+
+void BasicPlatformMisc::WakeByAddressSingle(const void* pAddress)
+{
+    // Other addresses may share the bucket, so all waiters must be woken up
+    WakeByAddressAll(pAddress);
+}
+
+void BasicPlatformMisc::WakeByAddressAll(const void* pAddress)
+{
+    AddressWaitBucket& Bucket = GetAddressWaitBucket(pAddress);
+    {
+        std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+    }
+    Bucket.CondVar.notify_all();
+}
+
 } // namespace Diligent
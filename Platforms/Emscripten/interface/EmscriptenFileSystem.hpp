@@ -40,6 +40,9 @@ using EmscriptenFile = StandardFile;
 
 struct EmscriptenFileSystem : public LinuxFileSystem
 {
+    // Asynchronous reads require threads, which are not always available in the browser
+    using BasicFileSystem::OpenAsyncFile;
+
     static std::string GetLocalAppDataDirectory(const char* AppName = nullptr, bool Create = true);
 };
 
@@ -33,6 +33,19 @@ namespace Diligent
 {
 
 struct EmscriptenMisc : public LinuxMisc
-{};
+{
+    // Linux sysfs topology is not available in the browser
+    using BasicPlatformMisc::GetCPUTopology;
+    using BasicPlatformMisc::GetCurrentProcessorIndex;
+    using BasicPlatformMisc::SetCurrentThreadProcessors;
+
+    using BasicPlatformMisc::AllocateVirtualMemory;
+    using BasicPlatformMisc::FreeVirtualMemory;
+    using BasicPlatformMisc::GetLargePageSize;
+
+    using BasicPlatformMisc::WaitOnAddress;
+    using BasicPlatformMisc::WakeByAddressAll;
+    using BasicPlatformMisc::WakeByAddressSingle;
+};
 
 } // namespace Diligent
@@ -44,9 +44,22 @@ struct LinuxFileSystem : public BasicFileSystem
 public:
     static LinuxFile* OpenFile(const FileOpenAttribs& OpenAttribs);
 
+    /// Maps the file into memory for reading using mmap.
+    static std::unique_ptr<MappedFile> MapFile(const Char* strFilePath);
+
+    /// Opens the file for asynchronous reading. Reads are performed by io_uring when it is
+    /// available (Linux 5.6+), and by a worker thread with pread otherwise.
+    static std::unique_ptr<AsyncFile> OpenAsyncFile(const Char* strFilePath, ASYNC_FILE_FLAGS Flags = ASYNC_FILE_FLAG_NONE);
+
     static bool FileExists(const Char* strFilePath);
     static bool PathExists(const Char* strPath);
 
+    static bool GetFileInfo(const Char* strFilePath, FileInfo& Info);
+    static bool TouchFile(const Char* strFilePath);
+
+    /// Renames the file using rename(), which atomically replaces the destination file.
+    static bool RenameFile(const Char* strSrcPath, const Char* strDstPath);
+
     static bool CreateDirectory(const Char* strPath);
     static bool DeleteDirectory(const Char* strPath);
     static bool IsDirectory(const Char* strPath);
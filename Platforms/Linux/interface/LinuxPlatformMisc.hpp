@@ -111,6 +111,31 @@ struct LinuxMisc : public BasicPlatformMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     /// On failure, returns 0.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+
+    /// Restricts the current thread to the given logical processors, see BasicPlatformMisc::SetCurrentThreadProcessors.
+    static bool SetCurrentThreadProcessors(const std::vector<Uint32>& Processors);
+
+    static Uint32 GetCurrentProcessorIndex();
+
+    /// Returns the CPU topology read from sysfs, see BasicPlatformMisc::GetCPUTopology.
+    static const CPUTopology& GetCPUTopology();
+
+    /// Returns the default huge page size, or 0 if huge pages are not supported.
+    static size_t GetLargePageSize();
+
+    /// Allocates virtual memory with mmap, see BasicPlatformMisc::AllocateVirtualMemory.
+    ///
+    /// Large pages are allocated with MAP_HUGETLB from the reserved huge page pool. If the pool
+    /// is exhausted, the allocation fails. NUMA placement uses the preferred node memory policy.
+    static void* AllocateVirtualMemory(size_t Size, VIRTUAL_MEMORY_FLAGS Flags = VIRTUAL_MEMORY_FLAG_NONE, Uint32 NUMANode = CPUProcessorInfo::InvalidId);
+
+    static void FreeVirtualMemory(void* Ptr, size_t Size);
+
+    /// Waits on the address using the private futex, see BasicPlatformMisc::WaitOnAddress.
+    static void WaitOnAddress(const void* pAddress, Uint32 CompareValue);
+
+    static void WakeByAddressSingle(const void* pAddress);
+    static void WakeByAddressAll(const void* pAddress);
 };
 
 } // namespace Diligent
@@ -0,0 +1,467 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <cstring>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+
+#if PLATFORM_LINUX
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <linux/io_uring.h>
+#endif
+
+#include "../interface/LinuxFileSystem.hpp"
+#include "Errors.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Alignment required by O_DIRECT. Logical block sizes of all common devices divide it.
+constexpr Uint32 UnbufferedReadAlignment = 4096;
+
+struct PendingRead
+{
+    AsyncFileReadRequest Request;
+
+    std::shared_ptr<const AsyncFile::CompletionCallbackType> pCallback;
+};
+
+// Reads the requested range, retrying interrupted and partial reads.
+// Returns the number of bytes read, or -1 on error.
+ssize_t ReadFileRange(int fd, const AsyncFileReadRequest& Req)
+{
+    size_t BytesRead = 0;
+    while (BytesRead < Req.Size)
+    {
+        const ssize_t Res = pread(fd, static_cast<Uint8*>(Req.pDst) + BytesRead, Req.Size - BytesRead, static_cast<off_t>(Req.Offset + BytesRead));
+        if (Res < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        if (Res == 0)
+            break; // End of file
+        BytesRead += static_cast<size_t>(Res);
+    }
+    return static_cast<ssize_t>(BytesRead);
+}
+
+// Fallback implementation that performs blocking reads in a dedicated thread
+class PosixAsyncFile final : public AsyncFile
+{
+public:
+    PosixAsyncFile(int fd, Uint64 Size, Uint32 Alignment) :
+        AsyncFile{Size, Alignment},
+        m_fd{fd},
+        m_WorkerThread{&PosixAsyncFile::WorkerThread, this}
+    {}
+
+    ~PosixAsyncFile()
+    {
+        WaitForAll();
+        {
+            std::lock_guard<std::mutex> Lock{m_QueueMtx};
+            m_Stop = true;
+        }
+        m_QueueCV.notify_one();
+        m_WorkerThread.join();
+        close(m_fd);
+    }
+
+    virtual bool Read(const AsyncFileReadRequest* pRequests, Uint32 NumRequests, const CompletionCallbackType& Callback) override final
+    {
+        if (!BeginReads(pRequests, NumRequests))
+            return false;
+
+        auto pCallback = std::make_shared<const CompletionCallbackType>(Callback);
+        {
+            std::lock_guard<std::mutex> Lock{m_QueueMtx};
+            for (Uint32 i = 0; i < NumRequests; ++i)
+                m_Queue.push_back({pRequests[i], pCallback});
+        }
+        m_QueueCV.notify_one();
+
+        return true;
+    }
+
+private:
+    void WorkerThread()
+    {
+        for (;;)
+        {
+            PendingRead Read;
+            {
+                std::unique_lock<std::mutex> Lock{m_QueueMtx};
+                m_QueueCV.wait(Lock, [this] { return m_Stop || !m_Queue.empty(); });
+                if (m_Queue.empty())
+                    return;
+                Read = std::move(m_Queue.front());
+                m_Queue.pop_front();
+            }
+
+            const ssize_t BytesRead = ReadFileRange(m_fd, Read.Request);
+            CompleteRead(*Read.pCallback, Read.Request, BytesRead >= 0 ? static_cast<size_t>(BytesRead) : 0, BytesRead >= 0);
+        }
+    }
+
+private:
+    const int m_fd;
+
+    std::mutex              m_QueueMtx;
+    std::condition_variable m_QueueCV;
+    std::deque<PendingRead> m_Queue;
+    bool                    m_Stop = false;
+
+    // Must be the last member so that the thread starts after all other members are initialized
+    std::thread m_WorkerThread;
+};
+
+#if PLATFORM_LINUX
+
+// io_uring-based implementation. The system calls are used directly to avoid the liburing dependency.
+class IoUringAsyncFile final : public AsyncFile
+{
+public:
+    // Returns null if io_uring is not available, for example when it is disabled
+    // by the kernel configuration or by a seccomp policy.
+    static std::unique_ptr<AsyncFile> Create(int fd, Uint64 Size, Uint32 Alignment)
+    {
+        std::unique_ptr<IoUringAsyncFile> pFile{new IoUringAsyncFile{fd, Size, Alignment}};
+        if (!pFile->InitRing())
+        {
+            pFile->m_fd = -1; // The caller keeps the ownership of the descriptor
+            return {};
+        }
+        pFile->m_CompletionThread = std::thread{&IoUringAsyncFile::CompletionThread, pFile.get()};
+        return pFile;
+    }
+
+    ~IoUringAsyncFile()
+    {
+        if (m_CompletionThread.joinable())
+        {
+            WaitForAll();
+
+            // A no-op request with zero user data stops the completion thread
+            {
+                std::lock_guard<std::mutex> Lock{m_SubmitMtx};
+                io_uring_sqe& SQE = GetNextSQE();
+                SQE.opcode        = IORING_OP_NOP;
+                SQE.user_data     = 0;
+                SubmitQueued(1, nullptr);
+            }
+            m_CompletionThread.join();
+        }
+
+        if (m_pSQEs != nullptr)
+            munmap(m_pSQEs, m_SQEsSize);
+        if (m_pCQRing != nullptr && m_pCQRing != m_pSQRing)
+            munmap(m_pCQRing, m_CQRingSize);
+        if (m_pSQRing != nullptr)
+            munmap(m_pSQRing, m_SQRingSize);
+        if (m_RingFd >= 0)
+            close(m_RingFd);
+        if (m_fd >= 0)
+            close(m_fd);
+    }
+
+    virtual bool Read(const AsyncFileReadRequest* pRequests, Uint32 NumRequests, const CompletionCallbackType& Callback) override final
+    {
+        if (!BeginReads(pRequests, NumRequests))
+            return false;
+
+        auto pCallback = std::make_shared<const CompletionCallbackType>(Callback);
+
+        std::vector<PendingRead*> FailedReads;
+
+        std::unique_lock<std::mutex> Lock{m_SubmitMtx};
+        for (Uint32 i = 0; i < NumRequests;)
+        {
+            // Keep the number of requests in flight within the ring size so that
+            // the completion queue (which is twice as large) never overflows.
+            m_SlotCV.wait(Lock, [this] { return m_NumInFlight < m_NumEntries; });
+
+            Uint32 NumQueued = 0;
+            for (; i < NumRequests && m_NumInFlight < m_NumEntries; ++i, ++NumQueued, ++m_NumInFlight)
+            {
+                const AsyncFileReadRequest& Req = pRequests[i];
+
+                io_uring_sqe& SQE = GetNextSQE();
+                SQE.opcode        = IORING_OP_READ;
+                SQE.fd            = m_fd;
+                SQE.off           = Req.Offset;
+                SQE.addr          = reinterpret_cast<Uint64>(Req.pDst);
+                SQE.len           = static_cast<Uint32>(Req.Size);
+                SQE.user_data     = reinterpret_cast<Uint64>(new PendingRead{Req, pCallback});
+            }
+            SubmitQueued(NumQueued, &FailedReads);
+        }
+        Lock.unlock();
+
+        // Callbacks must not be called while the mutex is locked as they may submit new reads
+        for (PendingRead* pRead : FailedReads)
+        {
+            std::unique_ptr<PendingRead> Read{pRead};
+            CompleteRead(*Read->pCallback, Read->Request, 0, false);
+        }
+        if (!FailedReads.empty())
+            m_SlotCV.notify_all();
+
+        return true;
+    }
+
+private:
+    IoUringAsyncFile(int fd, Uint64 Size, Uint32 Alignment) :
+        AsyncFile{Size, Alignment},
+        m_fd{fd}
+    {}
+
+    bool InitRing()
+    {
+        io_uring_params Params;
+        memset(&Params, 0, sizeof(Params));
+        m_RingFd = static_cast<int>(syscall(__NR_io_uring_setup, 64, &Params));
+        if (m_RingFd < 0)
+            return false;
+
+        // IORING_OP_READ is available since the same kernel version (5.6) as IORING_FEAT_RW_CUR_POS
+        if ((Params.features & IORING_FEAT_RW_CUR_POS) == 0)
+            return false;
+
+        m_NumEntries = Params.sq_entries;
+        m_SQRingSize = Params.sq_off.array + Params.sq_entries * sizeof(Uint32);
+        m_CQRingSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+        if (Params.features & IORING_FEAT_SINGLE_MMAP)
+            m_SQRingSize = m_CQRingSize = std::max(m_SQRingSize, m_CQRingSize);
+
+        void* pSQRing = mmap(nullptr, m_SQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, IORING_OFF_SQ_RING);
+        if (pSQRing == MAP_FAILED)
+            return false;
+        m_pSQRing = static_cast<Uint8*>(pSQRing);
+
+        if (Params.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            m_pCQRing = m_pSQRing;
+        }
+        else
+        {
+            void* pCQRing = mmap(nullptr, m_CQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, IORING_OFF_CQ_RING);
+            if (pCQRing == MAP_FAILED)
+                return false;
+            m_pCQRing = static_cast<Uint8*>(pCQRing);
+        }
+
+        m_SQEsSize  = Params.sq_entries * sizeof(io_uring_sqe);
+        void* pSQEs = mmap(nullptr, m_SQEsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, IORING_OFF_SQES);
+        if (pSQEs == MAP_FAILED)
+            return false;
+        m_pSQEs = static_cast<io_uring_sqe*>(pSQEs);
+
+        m_pSQHead  = reinterpret_cast<Uint32*>(m_pSQRing + Params.sq_off.head);
+        m_pSQTail  = reinterpret_cast<Uint32*>(m_pSQRing + Params.sq_off.tail);
+        m_pSQArray = reinterpret_cast<Uint32*>(m_pSQRing + Params.sq_off.array);
+        m_SQMask   = *reinterpret_cast<Uint32*>(m_pSQRing + Params.sq_off.ring_mask);
+        m_pCQHead  = reinterpret_cast<Uint32*>(m_pCQRing + Params.cq_off.head);
+        m_pCQTail  = reinterpret_cast<Uint32*>(m_pCQRing + Params.cq_off.tail);
+        m_pCQEs    = reinterpret_cast<io_uring_cqe*>(m_pCQRing + Params.cq_off.cqes);
+        m_CQMask   = *reinterpret_cast<Uint32*>(m_pCQRing + Params.cq_off.ring_mask);
+
+        return true;
+    }
+
+    // Must be called with m_SubmitMtx locked
+    io_uring_sqe& GetNextSQE()
+    {
+        const Uint32 Tail  = *m_pSQTail + m_NumQueued++;
+        const Uint32 Index = Tail & m_SQMask;
+
+        m_pSQArray[Index] = Index;
+
+        io_uring_sqe& SQE = m_pSQEs[Index];
+        memset(&SQE, 0, sizeof(SQE));
+        return SQE;
+    }
+
+    // Must be called with m_SubmitMtx locked. The reads that could not be submitted
+    // are removed from the in-flight counter and added to FailedReads.
+    void SubmitQueued(Uint32 NumQueued, std::vector<PendingRead*>* pFailedReads)
+    {
+        VERIFY_EXPR(NumQueued == m_NumQueued);
+        m_NumQueued = 0;
+
+        const Uint32 Tail = *m_pSQTail + NumQueued;
+        __atomic_store_n(m_pSQTail, Tail, __ATOMIC_RELEASE);
+
+        while (__atomic_load_n(m_pSQHead, __ATOMIC_ACQUIRE) != Tail)
+        {
+            const Uint32 NumToSubmit = Tail - __atomic_load_n(m_pSQHead, __ATOMIC_ACQUIRE);
+            if (syscall(__NR_io_uring_enter, m_RingFd, NumToSubmit, 0, 0, nullptr, 0) < 0 && errno != EINTR && errno != EAGAIN)
+            {
+                LOG_ERROR_MESSAGE("Failed to submit asynchronous file reads: ", strerror(errno));
+
+                // Take back the requests that the kernel did not consume
+                const Uint32 Head = __atomic_load_n(m_pSQHead, __ATOMIC_ACQUIRE);
+                __atomic_store_n(m_pSQTail, Head, __ATOMIC_RELEASE);
+                for (Uint32 i = Head; i != Tail; ++i)
+                {
+                    const io_uring_sqe& SQE = m_pSQEs[m_pSQArray[i & m_SQMask]];
+                    if (SQE.user_data != 0 && pFailedReads != nullptr)
+                    {
+                        pFailedReads->push_back(reinterpret_cast<PendingRead*>(SQE.user_data));
+                        --m_NumInFlight;
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    void CompletionThread()
+    {
+        for (;;)
+        {
+            Uint32       Head = *m_pCQHead;
+            const Uint32 Tail = __atomic_load_n(m_pCQTail, __ATOMIC_ACQUIRE);
+            if (Head == Tail)
+            {
+                if (syscall(__NR_io_uring_enter, m_RingFd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR)
+                {
+                    LOG_ERROR_MESSAGE("Failed to wait for asynchronous file reads: ", strerror(errno));
+                    return;
+                }
+                continue;
+            }
+
+            for (; Head != Tail; ++Head)
+            {
+                const io_uring_cqe& CQE      = m_pCQEs[Head & m_CQMask];
+                const Uint64        UserData = CQE.user_data;
+                const Int32         Res      = CQE.res;
+                // Release the entry before running the callback
+                __atomic_store_n(m_pCQHead, Head + 1, __ATOMIC_RELEASE);
+
+                if (UserData == 0)
+                    return;
+
+                std::unique_ptr<PendingRead> Read{reinterpret_cast<PendingRead*>(UserData)};
+                if (Res < 0)
+                    LOG_ERROR_MESSAGE("Asynchronous file read failed: ", strerror(-Res));
+                CompleteRead(*Read->pCallback, Read->Request, Res >= 0 ? static_cast<size_t>(Res) : 0, Res >= 0);
+
+                {
+                    std::lock_guard<std::mutex> Lock{m_SubmitMtx};
+                    --m_NumInFlight;
+                }
+                m_SlotCV.notify_one();
+            }
+        }
+    }
+
+private:
+    int m_fd     = -1;
+    int m_RingFd = -1;
+
+    Uint8*        m_pSQRing    = nullptr;
+    size_t        m_SQRingSize = 0;
+    Uint8*        m_pCQRing    = nullptr;
+    size_t        m_CQRingSize = 0;
+    io_uring_sqe* m_pSQEs      = nullptr;
+    size_t        m_SQEsSize   = 0;
+
+    Uint32*       m_pSQHead  = nullptr;
+    Uint32*       m_pSQTail  = nullptr;
+    Uint32*       m_pSQArray = nullptr;
+    Uint32        m_SQMask   = 0;
+    Uint32*       m_pCQHead  = nullptr;
+    Uint32*       m_pCQTail  = nullptr;
+    io_uring_cqe* m_pCQEs    = nullptr;
+    Uint32        m_CQMask   = 0;
+
+    std::mutex              m_SubmitMtx;
+    std::condition_variable m_SlotCV;
+    Uint32                  m_NumEntries  = 0;
+    Uint32                  m_NumInFlight = 0;
+    Uint32                  m_NumQueued   = 0;
+
+    std::thread m_CompletionThread;
+};
+
+#endif
+
+} // namespace
+
+std::unique_ptr<AsyncFile> LinuxFileSystem::OpenAsyncFile(const Char* strFilePath, ASYNC_FILE_FLAGS Flags)
+{
+    if (strFilePath == nullptr || strFilePath[0] == '\0')
+        return {};
+
+    std::string path{strFilePath};
+    CorrectSlashes(path);
+
+    int OpenFlags = O_RDONLY | O_CLOEXEC;
+    if (Flags & ASYNC_FILE_FLAG_UNBUFFERED)
+        OpenFlags |= O_DIRECT;
+
+    const int fd = open(path.c_str(), OpenFlags);
+    if (fd < 0)
+        return {};
+
+    struct stat StatBuff;
+    if (fstat(fd, &StatBuff) != 0 || !S_ISREG(StatBuff.st_mode))
+    {
+        close(fd);
+        return {};
+    }
+
+    const Uint64 Size      = static_cast<Uint64>(StatBuff.st_size);
+    const Uint32 Alignment = (Flags & ASYNC_FILE_FLAG_UNBUFFERED) ? UnbufferedReadAlignment : 1;
+
+#if PLATFORM_LINUX
+    if (std::unique_ptr<AsyncFile> pFile = IoUringAsyncFile::Create(fd, Size, Alignment))
+        return pFile;
+#endif
+
+    return std::make_unique<PosixAsyncFile>(fd, Size, Alignment);
+}
+
+} // namespace Diligent
@@ -0,0 +1,291 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "LinuxPlatformMisc.hpp"
+
+#include <sched.h>
+#include <dirent.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <algorithm>
+#include <thread>
+
+namespace Diligent
+{
+
+namespace
+{
+
+bool ReadSysFile(const std::string& Path, std::string& Contents)
+{
+    FILE* pFile = fopen(Path.c_str(), "r");
+    if (pFile == nullptr)
+        return false;
+
+    char Buffer[512];
+    Contents.clear();
+    while (fgets(Buffer, sizeof(Buffer), pFile) != nullptr)
+        Contents += Buffer;
+    fclose(pFile);
+
+    while (!Contents.empty() && (Contents.back() == '\n' || Contents.back() == ' '))
+        Contents.pop_back();
+
+    return true;
+}
+
+bool ReadSysFileUint(const std::string& Path, Uint32& Value)
+{
+    std::string Contents;
+    if (!ReadSysFile(Path, Contents) || Contents.empty())
+        return false;
+
+    Value = static_cast<Uint32>(strtoul(Contents.c_str(), nullptr, 10));
+    return true;
+}
+
+// Parses the kernel CPU list format, e.g. "0-3,8,10-11"
+std::vector<Uint32> ParseCPUList(const std::string& List)
+{
+    std::vector<Uint32> CPUs;
+
+    const char* Pos = List.c_str();
+    while (*Pos != '\0')
+    {
+        char*        End   = nullptr;
+        const Uint32 First = static_cast<Uint32>(strtoul(Pos, &End, 10));
+        if (End == Pos)
+            break;
+
+        Uint32 Last = First;
+        Pos         = End;
+        if (*Pos == '-')
+        {
+            ++Pos;
+            Last = static_cast<Uint32>(strtoul(Pos, &End, 10));
+            if (End == Pos)
+                break;
+            Pos = End;
+        }
+
+        for (Uint32 cpu = First; cpu <= Last; ++cpu)
+            CPUs.push_back(cpu);
+
+        if (*Pos == ',')
+            ++Pos;
+    }
+
+    return CPUs;
+}
+
+std::vector<Uint32> ReadCPUList(const std::string& Path)
+{
+    std::string List;
+    return ReadSysFile(Path, List) ? ParseCPUList(List) : std::vector<Uint32>{};
+}
+
+// Sets the core type of every processor from the per-CPU metric (capacity or max frequency):
+// the processors with the lowest value are efficiency cores, the rest are performance cores.
+void SetCoreTypesFromMetric(std::vector<CPUProcessorInfo>& Processors, const std::vector<Uint32>& Metric)
+{
+    const auto MinMax = std::minmax_element(Metric.begin(), Metric.end());
+    if (*MinMax.first == *MinMax.second)
+        return;
+
+    for (size_t i = 0; i < Processors.size(); ++i)
+        Processors[i].CoreType = Metric[i] == *MinMax.first ? CPUCoreType::Efficiency : CPUCoreType::Performance;
+}
+
+void DetectCoreTypes(std::vector<CPUProcessorInfo>& Processors)
+{
+    // Intel hybrid CPUs expose separate PMUs for P-cores and E-cores
+    const std::vector<Uint32> AtomCPUs = ReadCPUList("/sys/devices/cpu_atom/cpus");
+    if (!AtomCPUs.empty())
+    {
+        const std::vector<Uint32> CoreCPUs = ReadCPUList("/sys/devices/cpu_core/cpus");
+        for (auto& Proc : Processors)
+        {
+            if (std::find(AtomCPUs.begin(), AtomCPUs.end(), Proc.Index) != AtomCPUs.end())
+                Proc.CoreType = CPUCoreType::Efficiency;
+            else if (std::find(CoreCPUs.begin(), CoreCPUs.end(), Proc.Index) != CoreCPUs.end())
+                Proc.CoreType = CPUCoreType::Performance;
+        }
+        return;
+    }
+
+    // ARM big.LITTLE and DynamIQ systems report the relative core capacity.
+    // Fall back to the maximum frequency when capacity is not available.
+    for (const char* MetricFile : {"cpu_capacity", "cpufreq/cpuinfo_max_freq"})
+    {
+        std::vector<Uint32> Metric(Processors.size());
+
+        bool AllRead = true;
+        for (size_t i = 0; i < Processors.size() && AllRead; ++i)
+            AllRead = ReadSysFileUint("/sys/devices/system/cpu/cpu" + std::to_string(Processors[i].Index) + "/" + MetricFile, Metric[i]);
+
+        if (AllRead)
+        {
+            SetCoreTypesFromMetric(Processors, Metric);
+            return;
+        }
+    }
+}
+
+void ReadNUMANodes(std::vector<CPUProcessorInfo>& Processors)
+{
+    DIR* pDir = opendir("/sys/devices/system/node");
+    if (pDir == nullptr)
+        return;
+
+    while (const dirent* pEntry = readdir(pDir))
+    {
+        if (strncmp(pEntry->d_name, "node", 4) != 0 || pEntry->d_name[4] < '0' || pEntry->d_name[4] > '9')
+            continue;
+
+        const Uint32 Node = static_cast<Uint32>(atoi(pEntry->d_name + 4));
+        for (Uint32 cpu : ReadCPUList(std::string{"/sys/devices/system/node/"} + pEntry->d_name + "/cpulist"))
+        {
+            for (auto& Proc : Processors)
+            {
+                if (Proc.Index == cpu)
+                    Proc.NUMANode = Node;
+            }
+        }
+    }
+    closedir(pDir);
+}
+
+void ReadCacheGroups(CPUProcessorInfo& Proc)
+{
+    const std::string CacheDir = "/sys/devices/system/cpu/cpu" + std::to_string(Proc.Index) + "/cache/index";
+    for (Uint32 i = 0;; ++i)
+    {
+        const std::string IndexDir = CacheDir + std::to_string(i);
+
+        Uint32 Level = 0;
+        if (!ReadSysFileUint(IndexDir + "/level", Level))
+            break;
+
+        std::string Type;
+        if (ReadSysFile(IndexDir + "/type", Type) && Type == "Instruction")
+            continue;
+
+        const std::vector<Uint32> SharedCPUs = ReadCPUList(IndexDir + "/shared_cpu_list");
+        if (SharedCPUs.empty())
+            continue;
+
+        // The lowest processor index in the sharing group identifies the cache instance
+        if (Level == 2)
+            Proc.L2GroupId = SharedCPUs.front();
+        else if (Level == 3)
+            Proc.L3GroupId = SharedCPUs.front();
+    }
+}
+
+CPUTopology QueryCPUTopology()
+{
+    CPUTopology Topology;
+
+    std::vector<Uint32> OnlineCPUs = ReadCPUList("/sys/devices/system/cpu/online");
+    if (OnlineCPUs.empty())
+    {
+        OnlineCPUs.resize(std::max(std::thread::hardware_concurrency(), 1u));
+        for (Uint32 i = 0; i < OnlineCPUs.size(); ++i)
+            OnlineCPUs[i] = i;
+    }
+
+    Topology.Processors.resize(OnlineCPUs.size());
+    for (size_t i = 0; i < OnlineCPUs.size(); ++i)
+    {
+        CPUProcessorInfo& Proc = Topology.Processors[i];
+
+        Proc.Index = OnlineCPUs[i];
+
+        const std::string TopologyDir = "/sys/devices/system/cpu/cpu" + std::to_string(Proc.Index) + "/topology/";
+
+        // SMT siblings share the core; the lowest sibling index identifies it
+        std::vector<Uint32> Siblings = ReadCPUList(TopologyDir + "core_cpus_list");
+        if (Siblings.empty())
+            Siblings = ReadCPUList(TopologyDir + "thread_siblings_list");
+        Proc.CoreId = !Siblings.empty() ? Siblings.front() : Proc.Index;
+
+        if (!ReadSysFileUint(TopologyDir + "physical_package_id", Proc.PackageId))
+            Proc.PackageId = 0;
+
+        ReadCacheGroups(Proc);
+    }
+
+    ReadNUMANodes(Topology.Processors);
+    DetectCoreTypes(Topology.Processors);
+
+    return Topology;
+}
+
+} // namespace
+
+const CPUTopology& LinuxMisc::GetCPUTopology()
+{
+    static const CPUTopology Topology = [] {
+        CPUTopology Topo = QueryCPUTopology();
+        FinalizeCPUTopology(Topo);
+        return Topo;
+    }();
+    return Topology;
+}
+
+bool LinuxMisc::SetCurrentThreadProcessors(const std::vector<Uint32>& Processors)
+{
+    if (Processors.empty())
+        return false;
+
+    const Uint32 NumCPUs = *std::max_element(Processors.begin(), Processors.end()) + 1;
+    cpu_set_t*   pCPUSet = CPU_ALLOC(NumCPUs);
+    if (pCPUSet == nullptr)
+        return false;
+
+    const size_t AllocSize = CPU_ALLOC_SIZE(NumCPUs);
+
+    CPU_ZERO_S(AllocSize, pCPUSet);
+    for (Uint32 cpu : Processors)
+        CPU_SET_S(cpu, AllocSize, pCPUSet);
+
+    // On Linux, zero pid refers to the calling thread
+    const bool Res = sched_setaffinity(0, AllocSize, pCPUSet) == 0;
+    CPU_FREE(pCPUSet);
+
+    return Res;
+}
+
+Uint32 LinuxMisc::GetCurrentProcessorIndex()
+{
+    const int CPU = sched_getcpu();
+    return CPU >= 0 ? static_cast<Uint32>(CPU) : CPUProcessorInfo::InvalidId;
+}
+
+} // namespace Diligent
@@ -31,6 +31,10 @@
 #include <cstdio>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <utime.h>
+#include <cstring>
 #include <ftw.h>
 #include <glob.h>
 #include <mutex>
@@ -60,6 +64,64 @@ LinuxFile* LinuxFileSystem::OpenFile(const FileOpenAttribs& OpenAttribs)
 }
 #endif
 
+namespace
+{
+
+class LinuxMappedFile final : public MappedFile
+{
+public:
+    LinuxMappedFile(void* pData, size_t Size) :
+        MappedFile{pData, Size}
+    {}
+
+    ~LinuxMappedFile()
+    {
+        if (m_pData != nullptr)
+            munmap(const_cast<void*>(m_pData), m_Size);
+    }
+};
+
+} // namespace
+
+std::unique_ptr<MappedFile> LinuxFileSystem::MapFile(const Char* strFilePath)
+{
+    if (strFilePath == nullptr || strFilePath[0] == '\0')
+        return {};
+
+    std::string path{strFilePath};
+    CorrectSlashes(path);
+
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return {};
+
+    struct stat StatBuff;
+    if (fstat(fd, &StatBuff) != 0 || !S_ISREG(StatBuff.st_mode))
+    {
+        close(fd);
+        return {};
+    }
+
+    const size_t Size  = static_cast<size_t>(StatBuff.st_size);
+    void*        pData = nullptr;
+    // Zero-length mappings are not allowed
+    if (Size > 0)
+    {
+        pData = mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (pData == MAP_FAILED)
+        {
+            LOG_ERROR_MESSAGE("Failed to map file '", path, "': ", strerror(errno));
+            close(fd);
+            return {};
+        }
+    }
+
+    // The mapping remains valid after the file descriptor is closed
+    close(fd);
+
+    return std::make_unique<LinuxMappedFile>(pData, Size);
+}
+
 bool LinuxFileSystem::FileExists(const Char* strFilePath)
 {
     std::string path{strFilePath};
@@ -81,6 +143,39 @@ bool LinuxFileSystem::PathExists(const Char* strPath)
     return (stat(path.c_str(), &StatBuff) == 0);
 }
 
+bool LinuxFileSystem::GetFileInfo(const Char* strFilePath, FileInfo& Info)
+{
+    std::string path{strFilePath};
+    CorrectSlashes(path);
+
+    struct stat StatBuff;
+    if (stat(path.c_str(), &StatBuff) != 0 || S_ISDIR(StatBuff.st_mode))
+        return false;
+
+    Info.Size          = static_cast<Uint64>(StatBuff.st_size);
+    Info.LastWriteTime = static_cast<Int64>(StatBuff.st_mtime);
+    return true;
+}
+
+bool LinuxFileSystem::TouchFile(const Char* strFilePath)
+{
+    std::string path{strFilePath};
+    CorrectSlashes(path);
+
+    // Null times set both the access and the modification time to the current time
+    return utime(path.c_str(), nullptr) == 0;
+}
+
+bool LinuxFileSystem::RenameFile(const Char* strSrcPath, const Char* strDstPath)
+{
+    std::string SrcPath{strSrcPath};
+    std::string DstPath{strDstPath};
+    CorrectSlashes(SrcPath);
+    CorrectSlashes(DstPath);
+
+    return rename(SrcPath.c_str(), DstPath.c_str()) == 0;
+}
+
 bool LinuxFileSystem::CreateDirectory(const Char* strPath)
 {
     if (strPath == nullptr || strPath[0] == '\0')
@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LinuxPlatformMisc.hpp"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "DebugUtilities.hpp"
+
+#ifndef MAP_HUGETLB
+#    define MAP_HUGETLB 0x40000
+#endif
+
+namespace Diligent
+{
+
+namespace
+{
+
+size_t ReadDefaultHugePageSize()
+{
+    FILE* pFile = fopen("/proc/meminfo", "r");
+    if (pFile == nullptr)
+        return 0;
+
+    size_t HugePageSize = 0;
+
+    char Line[256];
+    while (fgets(Line, sizeof(Line), pFile) != nullptr)
+    {
+        unsigned long SizeKB = 0;
+        if (sscanf(Line, "Hugepagesize: %lu kB", &SizeKB) == 1)
+        {
+            HugePageSize = static_cast<size_t>(SizeKB) * 1024;
+            break;
+        }
+    }
+    fclose(pFile);
+
+    return HugePageSize;
+}
+
+#if PLATFORM_LINUX && defined(SYS_mbind)
+// Sets the preferred NUMA node for the memory range. Must be called before the pages are touched.
+bool SetPreferredNUMANode(void* Ptr, size_t Size, Uint32 OSNode)
+{
+    constexpr int    MPOL_PREFERRED_ = 1;
+    constexpr size_t BitsPerWord     = sizeof(unsigned long) * 8;
+
+    std::vector<unsigned long> NodeMask(OSNode / BitsPerWord + 1);
+    NodeMask[OSNode / BitsPerWord] |= 1ul << (OSNode % BitsPerWord);
+    // The kernel ignores the last bit of maxnode
+    const unsigned long MaxNode = NodeMask.size() * BitsPerWord + 1;
+    return syscall(SYS_mbind, Ptr, Size, MPOL_PREFERRED_, NodeMask.data(), MaxNode, 0) == 0;
+}
+#endif
+
+} // namespace
+
+size_t LinuxMisc::GetLargePageSize()
+{
+    static const size_t LargePageSize = ReadDefaultHugePageSize();
+    return LargePageSize;
+}
+
+void* LinuxMisc::AllocateVirtualMemory(size_t Size, VIRTUAL_MEMORY_FLAGS Flags, Uint32 NUMANode)
+{
+    VERIFY_EXPR(Size > 0);
+
+    int MapFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if ((Flags & VIRTUAL_MEMORY_FLAG_LARGE_PAGES) != 0)
+    {
+        const size_t LargePageSize = GetLargePageSize();
+        if (LargePageSize == 0)
+            return nullptr;
+        DEV_CHECK_ERR(Size % LargePageSize == 0, "Size (", Size, ") must be a multiple of the large page size (", LargePageSize, ")");
+        MapFlags |= MAP_HUGETLB;
+    }
+
+    void* Ptr = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MapFlags, -1, 0);
+    if (Ptr == MAP_FAILED)
+        return nullptr;
+
+#if PLATFORM_LINUX && defined(SYS_mbind)
+    if (NUMANode != CPUProcessorInfo::InvalidId)
+    {
+        const CPUTopology& Topology = GetCPUTopology();
+        if (Topology.NumNUMANodes > 1 && NUMANode < Topology.NUMANodeOSIds.size())
+        {
+            if (!SetPreferredNUMANode(Ptr, Size, Topology.NUMANodeOSIds[NUMANode]))
+                LOG_WARNING_MESSAGE_ONCE("Failed to set the NUMA memory policy: ", strerror(errno));
+        }
+    }
+#endif
+
+    return Ptr;
+}
+
+void LinuxMisc::FreeVirtualMemory(void* Ptr, size_t Size)
+{
+    if (Ptr != nullptr)
+        munmap(Ptr, Size);
+}
+
+} // namespace Diligent
@@ -47,9 +47,22 @@ struct WindowsFileSystem : public BasicFileSystem
 public:
     static WindowsFile* OpenFile(const FileOpenAttribs& OpenAttribs);
 
+    /// Maps the file into memory for reading using MapViewOfFile.
+    static std::unique_ptr<MappedFile> MapFile(const Char* strFilePath);
+
+    /// Opens the file for asynchronous reading using overlapped I/O and an I/O completion port.
+    static std::unique_ptr<AsyncFile> OpenAsyncFile(const Char* strFilePath, ASYNC_FILE_FLAGS Flags = ASYNC_FILE_FLAG_NONE);
+
     static bool FileExists(const Char* strFilePath);
     static bool PathExists(const Char* strPath);
 
+    static bool GetFileInfo(const Char* strFilePath, FileInfo& Info);
+    static bool TouchFile(const Char* strFilePath);
+
+    /// Renames the file using MoveFileEx with MOVEFILE_REPLACE_EXISTING.
+    /// The function fails if the destination file is open by another process.
+    static bool RenameFile(const Char* strSrcPath, const Char* strDstPath);
+
     static void SetWorkingDirectory(const Char* strWorkingDir);
 
     static bool CreateDirectory(const Char* strPath);
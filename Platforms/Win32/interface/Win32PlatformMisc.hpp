@@ -173,6 +173,34 @@ struct WindowsMisc : public BasicPlatformMisc
     /// Sets the current thread priority and on success returns the previous priority.
     /// On failure, returns ThreadPriority::Unknown.
     static ThreadPriority SetCurrentThreadPriority(ThreadPriority Priority);
+
+    /// Restricts the current thread to the given logical processors, see BasicPlatformMisc::SetCurrentThreadProcessors.
+    ///
+    /// \note  On systems with more than 64 logical processors, all processors must belong
+    ///        to the same processor group.
+    static bool SetCurrentThreadProcessors(const std::vector<Uint32>& Processors);
+
+    static Uint32 GetCurrentProcessorIndex();
+
+    /// Returns the CPU topology reported by GetLogicalProcessorInformationEx, see BasicPlatformMisc::GetCPUTopology.
+    static const CPUTopology& GetCPUTopology();
+
+    /// Returns the large page size, or 0 if large pages are not available.
+    ///
+    /// \note  Large pages require the "Lock pages in memory" (SeLockMemoryPrivilege) user right.
+    ///        The function enables the privilege in the process token on the first call.
+    static size_t GetLargePageSize();
+
+    /// Allocates virtual memory with VirtualAllocExNuma, see BasicPlatformMisc::AllocateVirtualMemory.
+    static void* AllocateVirtualMemory(size_t Size, VIRTUAL_MEMORY_FLAGS Flags = VIRTUAL_MEMORY_FLAG_NONE, Uint32 NUMANode = CPUProcessorInfo::InvalidId);
+
+    static void FreeVirtualMemory(void* Ptr, size_t Size);
+
+    /// Waits on the address using WaitOnAddress, see BasicPlatformMisc::WaitOnAddress.
+    static void WaitOnAddress(const void* pAddress, Uint32 CompareValue);
+
+    static void WakeByAddressSingle(const void* pAddress);
+    static void WakeByAddressAll(const void* pAddress);
 #endif
 };
 
@@ -74,6 +74,8 @@ std::string WindowsFileSystem::GetLocalAppDataDirectory(const char* AppName, boo
 #pragma comment(lib, "Shlwapi.lib")
 #include <shlobj.h>
 
+#include <thread>
+
 #if !(defined(__MINGW64__) || defined(__MINGW32__))
 #    include <atlbase.h>
 #endif
@@ -141,6 +143,26 @@ public:
     {
         return CALL_WIN_FUNC(RemoveDirectory) != FALSE;
     }
+
+    HANDLE OpenFileForReading_(DWORD FlagsAndAttributes = FILE_ATTRIBUTE_NORMAL) const
+    {
+        return CALL_WIN_FUNC(CreateFile, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FlagsAndAttributes, nullptr);
+    }
+
+    bool GetFileAttributesEx_(WIN32_FILE_ATTRIBUTE_DATA& AttribData) const
+    {
+        return CALL_WIN_FUNC(GetFileAttributesEx, GetFileExInfoStandard, &AttribData) != FALSE;
+    }
+
+    HANDLE OpenFileForWritingAttributes_() const
+    {
+        return CALL_WIN_FUNC(CreateFile, FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    }
+
+    bool MoveFile_(const WindowsPathHelper& DstPath) const
+    {
+        return CALL_WIN_FUNC(MoveFileEx, DstPath.m_LongPathW.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+    }
 #undef CALL_WIN_FUNC
 
     static std::string GetCurrentDirectory_()
@@ -270,6 +292,208 @@ WindowsFile* WindowsFileSystem::OpenFile(const FileOpenAttribs& OpenAttribs)
     return pFile;
 }
 
+namespace
+{
+
+class WindowsMappedFile final : public MappedFile
+{
+public:
+    WindowsMappedFile(HANDLE hMapping, const void* pData, size_t Size) :
+        MappedFile{pData, Size},
+        m_hMapping{hMapping}
+    {}
+
+    ~WindowsMappedFile()
+    {
+        if (m_pData != nullptr)
+            UnmapViewOfFile(m_pData);
+        if (m_hMapping != NULL)
+            CloseHandle(m_hMapping);
+    }
+
+private:
+    const HANDLE m_hMapping;
+};
+
+// Alignment required by FILE_FLAG_NO_BUFFERING. Sector sizes of all common devices divide it.
+constexpr Uint32 UnbufferedReadAlignment = 4096;
+
+// Overlapped reads that complete through an I/O completion port serviced by a dedicated thread
+class WindowsAsyncFile final : public AsyncFile
+{
+public:
+    WindowsAsyncFile(HANDLE hFile, HANDLE hPort, Uint64 Size, Uint32 Alignment) :
+        AsyncFile{Size, Alignment},
+        m_hFile{hFile},
+        m_hPort{hPort},
+        m_CompletionThread{&WindowsAsyncFile::CompletionThread, this}
+    {}
+
+    ~WindowsAsyncFile()
+    {
+        WaitForAll();
+        // A packet without an OVERLAPPED structure stops the completion thread
+        PostQueuedCompletionStatus(m_hPort, 0, 0, nullptr);
+        m_CompletionThread.join();
+        CloseHandle(m_hFile);
+        CloseHandle(m_hPort);
+    }
+
+    virtual bool Read(const AsyncFileReadRequest* pRequests, Uint32 NumRequests, const CompletionCallbackType& Callback) override final
+    {
+        if (!BeginReads(pRequests, NumRequests))
+            return false;
+
+        auto pCallback = std::make_shared<const CompletionCallbackType>(Callback);
+        for (Uint32 i = 0; i < NumRequests; ++i)
+        {
+            const AsyncFileReadRequest& Req = pRequests[i];
+
+            PendingRead* pRead           = new PendingRead{};
+            pRead->Overlapped.Offset     = static_cast<DWORD>(Req.Offset & 0xFFFFFFFFu);
+            pRead->Overlapped.OffsetHigh = static_cast<DWORD>(Req.Offset >> 32u);
+            pRead->Request               = Req;
+            pRead->pCallback             = pCallback;
+
+            // The completion packet is queued even if the read completes synchronously
+            if (!ReadFile(m_hFile, Req.pDst, static_cast<DWORD>(Req.Size), nullptr, &pRead->Overlapped))
+            {
+                const DWORD Error = GetLastError();
+                if (Error != ERROR_IO_PENDING)
+                {
+                    std::unique_ptr<PendingRead> Read{pRead};
+                    // Reads that start past the end of the file fail with ERROR_HANDLE_EOF
+                    CompleteRead(*Read->pCallback, Read->Request, 0, Error == ERROR_HANDLE_EOF);
+                }
+            }
+        }
+
+        return true;
+    }
+
+private:
+    struct PendingRead
+    {
+        OVERLAPPED Overlapped = {};
+
+        AsyncFileReadRequest Request;
+
+        std::shared_ptr<const CompletionCallbackType> pCallback;
+    };
+
+    void CompletionThread()
+    {
+        for (;;)
+        {
+            DWORD       BytesTransferred = 0;
+            ULONG_PTR   CompletionKey    = 0;
+            OVERLAPPED* pOverlapped      = nullptr;
+
+            const BOOL Res = GetQueuedCompletionStatus(m_hPort, &BytesTransferred, &CompletionKey, &pOverlapped, INFINITE);
+            if (pOverlapped == nullptr)
+            {
+                if (!Res)
+                    LOG_ERROR_MESSAGE("Failed to wait for asynchronous file reads");
+                return;
+            }
+
+            std::unique_ptr<PendingRead> Read{CONTAINING_RECORD(pOverlapped, PendingRead, Overlapped)};
+
+            const bool Success = Res || GetLastError() == ERROR_HANDLE_EOF;
+            CompleteRead(*Read->pCallback, Read->Request, BytesTransferred, Success);
+        }
+    }
+
+private:
+    const HANDLE m_hFile;
+    const HANDLE m_hPort;
+
+    // Must be the last member so that the thread starts after all other members are initialized
+    std::thread m_CompletionThread;
+};
+
+} // namespace
+
+std::unique_ptr<MappedFile> WindowsFileSystem::MapFile(const Char* strFilePath)
+{
+    if (strFilePath == nullptr || strFilePath[0] == '\0')
+        return {};
+
+    const WindowsPathHelper WndPath{strFilePath};
+
+    HANDLE hFile = WndPath.OpenFileForReading_();
+    if (hFile == INVALID_HANDLE_VALUE)
+        return {};
+
+    LARGE_INTEGER FileSize = {};
+    if (!GetFileSizeEx(hFile, &FileSize))
+    {
+        CloseHandle(hFile);
+        return {};
+    }
+
+    const size_t Size = static_cast<size_t>(FileSize.QuadPart);
+    if (Size == 0)
+    {
+        // Empty files can't be mapped
+        CloseHandle(hFile);
+        return std::make_unique<WindowsMappedFile>(HANDLE{NULL}, nullptr, 0);
+    }
+
+    // The mapping object keeps the file open, so the file handle can be closed right away
+    HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(hFile);
+    if (hMapping == NULL)
+    {
+        LOG_ERROR_MESSAGE("Failed to create file mapping for '", strFilePath, "'");
+        return {};
+    }
+
+    const void* pData = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    if (pData == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to map view of file '", strFilePath, "'");
+        CloseHandle(hMapping);
+        return {};
+    }
+
+    return std::make_unique<WindowsMappedFile>(hMapping, pData, Size);
+}
+
+std::unique_ptr<AsyncFile> WindowsFileSystem::OpenAsyncFile(const Char* strFilePath, ASYNC_FILE_FLAGS Flags)
+{
+    if (strFilePath == nullptr || strFilePath[0] == '\0')
+        return {};
+
+    const WindowsPathHelper WndPath{strFilePath};
+
+    DWORD FlagsAndAttributes = FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED;
+    if (Flags & ASYNC_FILE_FLAG_UNBUFFERED)
+        FlagsAndAttributes |= FILE_FLAG_NO_BUFFERING;
+
+    HANDLE hFile = WndPath.OpenFileForReading_(FlagsAndAttributes);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return {};
+
+    LARGE_INTEGER FileSize = {};
+    if (!GetFileSizeEx(hFile, &FileSize))
+    {
+        CloseHandle(hFile);
+        return {};
+    }
+
+    HANDLE hPort = CreateIoCompletionPort(hFile, NULL, 0, 1);
+    if (hPort == NULL)
+    {
+        LOG_ERROR_MESSAGE("Failed to create I/O completion port for '", strFilePath, "'");
+        CloseHandle(hFile);
+        return {};
+    }
+
+    const Uint32 Alignment = (Flags & ASYNC_FILE_FLAG_UNBUFFERED) ? UnbufferedReadAlignment : 1;
+    return std::make_unique<WindowsAsyncFile>(hFile, hPort, static_cast<Uint64>(FileSize.QuadPart), Alignment);
+}
+
 bool WindowsFileSystem::FileExists(const Char* strFilePath)
 {
     const WindowsPathHelper WndPath{strFilePath};
@@ -416,6 +640,44 @@ bool WindowsFileSystem::PathExists(const Char* strPath)
     return WndPath.PathFileExists_();
 }
 
+bool WindowsFileSystem::GetFileInfo(const Char* strFilePath, FileInfo& Info)
+{
+    const WindowsPathHelper   WndPath{strFilePath};
+    WIN32_FILE_ATTRIBUTE_DATA AttribData{};
+    if (!WndPath.GetFileAttributesEx_(AttribData) || (AttribData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+        return false;
+
+    Info.Size = (Uint64{AttribData.nFileSizeHigh} << 32u) | Uint64{AttribData.nFileSizeLow};
+
+    // FILETIME is the number of 100-nanosecond intervals since January 1, 1601
+    constexpr Int64 UnixEpochOffset = 11644473600ll; // Seconds between 1601 and 1970
+    const Uint64    FileTime        = (Uint64{AttribData.ftLastWriteTime.dwHighDateTime} << 32u) | Uint64{AttribData.ftLastWriteTime.dwLowDateTime};
+    Info.LastWriteTime              = static_cast<Int64>(FileTime / 10000000ull) - UnixEpochOffset;
+    return true;
+}
+
+bool WindowsFileSystem::TouchFile(const Char* strFilePath)
+{
+    const WindowsPathHelper WndPath{strFilePath};
+
+    HANDLE hFile = WndPath.OpenFileForWritingAttributes_();
+    if (hFile == INVALID_HANDLE_VALUE)
+        return false;
+
+    FILETIME CurrTime{};
+    GetSystemTimeAsFileTime(&CurrTime);
+    const bool Res = SetFileTime(hFile, nullptr, &CurrTime, &CurrTime) != FALSE;
+    CloseHandle(hFile);
+    return Res;
+}
+
+bool WindowsFileSystem::RenameFile(const Char* strSrcPath, const Char* strDstPath)
+{
+    const WindowsPathHelper SrcPath{strSrcPath};
+    const WindowsPathHelper DstPath{strDstPath};
+    return SrcPath.MoveFile_(DstPath);
+}
+
 void WindowsFileSystem::SetWorkingDirectory(const Char* strWorkingDir)
 {
     WindowsPathHelper::SetWorkingDirectory(strWorkingDir);
@@ -30,6 +30,8 @@
 #include <Windows.h>
 #include "WinHPostface.h"
 
+#include <algorithm>
+
 namespace Diligent
 {
 
@@ -88,4 +90,266 @@ ThreadPriority WindowsMisc::SetCurrentThreadPriority(ThreadPriority Priority)
         return ThreadPriority::Unknown;
 }
 
+bool WindowsMisc::SetCurrentThreadProcessors(const std::vector<Uint32>& Processors)
+{
+    if (Processors.empty())
+        return false;
+
+    GROUP_AFFINITY Affinity = {};
+    Affinity.Group          = static_cast<WORD>(Processors.front() / 64);
+    for (Uint32 Proc : Processors)
+    {
+        if (Proc / 64 != Affinity.Group)
+        {
+            LOG_WARNING_MESSAGE("Thread affinity can't span multiple processor groups. Processor ", Proc, " is ignored.");
+            continue;
+        }
+        Affinity.Mask |= KAFFINITY{1} << (Proc % 64);
+    }
+
+    return SetThreadGroupAffinity(GetCurrentThread(), &Affinity, nullptr) != FALSE;
+}
+
+Uint32 WindowsMisc::GetCurrentProcessorIndex()
+{
+    PROCESSOR_NUMBER ProcNumber = {};
+    GetCurrentProcessorNumberEx(&ProcNumber);
+    return ProcNumber.Group * 64u + ProcNumber.Number;
+}
+
+template <typename HandlerType>
+static void ForEachProcessorInGroupMask(const GROUP_AFFINITY& GroupMask, HandlerType&& Handler)
+{
+    for (Uint32 Bit = 0; Bit < 64; ++Bit)
+    {
+        if (GroupMask.Mask & (KAFFINITY{1} << Bit))
+            Handler(GroupMask.Group * 64u + Bit);
+    }
+}
+
+static CPUTopology QueryCPUTopology()
+{
+    CPUTopology Topology;
+
+    DWORD BufferSize = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &BufferSize);
+    std::vector<Uint8> Buffer(BufferSize);
+    if (BufferSize == 0 ||
+        !GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(Buffer.data()), &BufferSize))
+    {
+        LOG_WARNING_MESSAGE("Failed to query logical processor information");
+        return Topology;
+    }
+
+    auto& Processors = Topology.Processors;
+
+    auto GetProcessor = [&Processors](Uint32 Index) -> CPUProcessorInfo& {
+        for (auto& Proc : Processors)
+        {
+            if (Proc.Index == Index)
+                return Proc;
+        }
+        Processors.emplace_back();
+        Processors.back().Index = Index;
+        return Processors.back();
+    };
+
+    // Cores are enumerated first so that every processor is known when other relations are processed
+    std::vector<Uint8> EfficiencyClasses;
+    for (int Pass = 0; Pass < 2; ++Pass)
+    {
+        Uint32 CoreId    = 0;
+        Uint32 PackageId = 0;
+        Uint32 CacheId   = 0;
+        for (DWORD Offset = 0; Offset < BufferSize;)
+        {
+            const auto& Info = *reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(Buffer.data() + Offset);
+            Offset += Info.Size;
+
+            if (Pass == 0)
+            {
+                if (Info.Relationship != RelationProcessorCore)
+                    continue;
+
+                for (WORD g = 0; g < Info.Processor.GroupCount; ++g)
+                {
+                    ForEachProcessorInGroupMask(Info.Processor.GroupMask[g], [&](Uint32 Index) {
+                        GetProcessor(Index).CoreId = CoreId;
+                    });
+                }
+                // Higher efficiency class means higher performance and lower efficiency
+                EfficiencyClasses.push_back(Info.Processor.EfficiencyClass);
+                ++CoreId;
+                continue;
+            }
+
+            switch (Info.Relationship)
+            {
+                case RelationProcessorPackage:
+                    for (WORD g = 0; g < Info.Processor.GroupCount; ++g)
+                    {
+                        ForEachProcessorInGroupMask(Info.Processor.GroupMask[g], [&](Uint32 Index) {
+                            GetProcessor(Index).PackageId = PackageId;
+                        });
+                    }
+                    ++PackageId;
+                    break;
+
+                case RelationNumaNode:
+                    ForEachProcessorInGroupMask(Info.NumaNode.GroupMask, [&](Uint32 Index) {
+                        GetProcessor(Index).NUMANode = Info.NumaNode.NodeNumber;
+                    });
+                    break;
+
+                case RelationCache:
+                    if (Info.Cache.Type != CacheInstruction && (Info.Cache.Level == 2 || Info.Cache.Level == 3))
+                    {
+                        ForEachProcessorInGroupMask(Info.Cache.GroupMask, [&](Uint32 Index) {
+                            CPUProcessorInfo& Proc = GetProcessor(Index);
+                            (Info.Cache.Level == 2 ? Proc.L2GroupId : Proc.L3GroupId) = CacheId;
+                        });
+                    }
+                    ++CacheId;
+                    break;
+
+                default:
+                    break;
+            }
+        }
+    }
+
+    // Processors of the least efficient class are efficiency cores, the rest are performance cores
+    if (!EfficiencyClasses.empty())
+    {
+        const Uint8 MinClass = *std::min_element(EfficiencyClasses.begin(), EfficiencyClasses.end());
+        for (auto& Proc : Processors)
+        {
+            VERIFY_EXPR(Proc.CoreId < EfficiencyClasses.size());
+            Proc.CoreType = EfficiencyClasses[Proc.CoreId] == MinClass ? CPUCoreType::Efficiency : CPUCoreType::Performance;
+        }
+    }
+
+    return Topology;
+}
+
+const CPUTopology& WindowsMisc::GetCPUTopology()
+{
+    static const CPUTopology Topology = [] {
+        CPUTopology Topo = QueryCPUTopology();
+        if (Topo.Processors.empty())
+            return BasicPlatformMisc::GetCPUTopology();
+
+        FinalizeCPUTopology(Topo);
+        return Topo;
+    }();
+    return Topology;
+}
+
+namespace
+{
+
+size_t QueryLargePageSize()
+{
+    const size_t LargePageMinimum = GetLargePageMinimum();
+    if (LargePageMinimum == 0)
+        return 0;
+
+    // Large page allocations require SeLockMemoryPrivilege to be enabled in the process token
+    HANDLE hToken = NULL;
+    if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &hToken))
+        return 0;
+
+    TOKEN_PRIVILEGES Privileges{};
+    Privileges.PrivilegeCount           = 1;
+    Privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+    bool Enabled = false;
+    if (LookupPrivilegeValueA(nullptr, "SeLockMemoryPrivilege", &Privileges.Privileges[0].Luid) &&
+        AdjustTokenPrivileges(hToken, FALSE, &Privileges, 0, nullptr, nullptr))
+    {
+        // AdjustTokenPrivileges succeeds even if the privilege has not been granted to the user
+        Enabled = GetLastError() == ERROR_SUCCESS;
+    }
+    CloseHandle(hToken);
+
+    if (!Enabled)
+        LOG_INFO_MESSAGE("Large pages are not available: the process does not have the 'Lock pages in memory' privilege.");
+
+    return Enabled ? LargePageMinimum : 0;
+}
+
+} // namespace
+
+size_t WindowsMisc::GetLargePageSize()
+{
+    static const size_t LargePageSize = QueryLargePageSize();
+    return LargePageSize;
+}
+
+void* WindowsMisc::AllocateVirtualMemory(size_t Size, VIRTUAL_MEMORY_FLAGS Flags, Uint32 NUMANode)
+{
+    VERIFY_EXPR(Size > 0);
+
+    DWORD AllocationType = MEM_RESERVE | MEM_COMMIT;
+    if ((Flags & VIRTUAL_MEMORY_FLAG_LARGE_PAGES) != 0)
+    {
+        const size_t LargePageSize = GetLargePageSize();
+        if (LargePageSize == 0)
+            return nullptr;
+        DEV_CHECK_ERR(Size % LargePageSize == 0, "Size (", Size, ") must be a multiple of the large page size (", LargePageSize, ")");
+        AllocationType |= MEM_LARGE_PAGES;
+    }
+
+    if (NUMANode != CPUProcessorInfo::InvalidId)
+    {
+        const CPUTopology& Topology = GetCPUTopology();
+        if (Topology.NumNUMANodes > 1 && NUMANode < Topology.NUMANodeOSIds.size())
+            return VirtualAllocExNuma(GetCurrentProcess(), nullptr, Size, AllocationType, PAGE_READWRITE, Topology.NUMANodeOSIds[NUMANode]);
+    }
+
+    return VirtualAlloc(nullptr, Size, AllocationType, PAGE_READWRITE);
+}
+
+void WindowsMisc::FreeVirtualMemory(void* Ptr, size_t Size)
+{
+    if (Ptr != nullptr)
+        VirtualFree(Ptr, 0, MEM_RELEASE);
+}
+
+#if _WIN32_WINNT >= 0x0602 // WaitOnAddress requires Windows 8
+
+void WindowsMisc::WaitOnAddress(const void* pAddress, Uint32 CompareValue)
+{
+    ::WaitOnAddress(const_cast<void*>(pAddress), &CompareValue, sizeof(CompareValue), INFINITE);
+}
+
+void WindowsMisc::WakeByAddressSingle(const void* pAddress)
+{
+    ::WakeByAddressSingle(const_cast<void*>(pAddress));
+}
+
+void WindowsMisc::WakeByAddressAll(const void* pAddress)
+{
+    ::WakeByAddressAll(const_cast<void*>(pAddress));
+}
+
+#else
+
+void WindowsMisc::WaitOnAddress(const void* pAddress, Uint32 CompareValue)
+{
+    BasicPlatformMisc::WaitOnAddress(pAddress, CompareValue);
+}
+
+void WindowsMisc::WakeByAddressSingle(const void* pAddress)
+{
+    BasicPlatformMisc::WakeByAddressSingle(pAddress);
+}
+
+void WindowsMisc::WakeByAddressAll(const void* pAddress)
+{
+    BasicPlatformMisc::WakeByAddressAll(pAddress);
+}
+
+#endif
+
 } // namespace Diligent
@@ -34,6 +34,56 @@
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
+// clang-format off
+
+/// Memory category that engine CPU allocations are accounted for, see Diligent::MemoryCategoryStats.
+
+/// Allocations that are made through the raw allocator directly are not accounted for any category.
+DILIGENT_TYPED_ENUM(MEMORY_CATEGORY, Uint8)
+{
+    /// Device objects (buffers, textures, views, pipeline states, etc.).
+    MEMORY_CATEGORY_DEVICE_OBJECTS = 0,
+
+    /// Shader bytecode, reflection data and shader create info copies kept by shader objects.
+    MEMORY_CATEGORY_SHADER_CACHE,
+
+    /// Shader resource binding caches and shader variables.
+    MEMORY_CATEGORY_SRB_CACHE,
+
+    /// CPU-side data of staging and upload resources.
+    MEMORY_CATEGORY_STAGING,
+
+    /// Device object archives and dearchiver data.
+    MEMORY_CATEGORY_ARCHIVE,
+
+    /// The number of memory categories.
+    MEMORY_CATEGORY_COUNT
+};
+// clang-format on
+
+/// Memory usage statistics of a single memory category.
+struct MemoryCategoryStats
+{
+    /// The number of bytes that are currently allocated.
+    Uint64 LiveBytes DEFAULT_INITIALIZER(0);
+
+    /// The maximum value LiveBytes has ever reached.
+    Uint64 PeakBytes DEFAULT_INITIALIZER(0);
+
+    /// The number of allocations that have not been released yet.
+    Uint64 LiveAllocations DEFAULT_INITIALIZER(0);
+
+    /// The total number of allocations made so far.
+
+    /// The allocation rate is the difference between two values of this
+    /// member queried at different times divided by the time interval.
+    Uint64 TotalAllocations DEFAULT_INITIALIZER(0);
+
+    /// The total number of bytes allocated so far.
+    Uint64 TotalAllocatedBytes DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryCategoryStats MemoryCategoryStats;
+
 
 #if DILIGENT_CPP_INTERFACE
 
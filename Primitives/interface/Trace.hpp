@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Engine CPU trace instrumentation macros
+///
+/// The macros report events to the trace sink set with Diligent::SetTraceSink().
+/// When no sink is set, every macro costs a single pointer check.
+/// Defining DILIGENT_NO_TRACE (see DILIGENT_NO_TRACE CMake option) removes
+/// the instrumentation completely.
+
+#include "TraceSink.h"
+
+#if !defined(DILIGENT_NO_TRACE) || !DILIGENT_NO_TRACE
+
+namespace Diligent
+{
+
+/// Reports the trace scope to the sink for the lifetime of the object
+class TraceScope
+{
+public:
+    explicit TraceScope(const TraceScopeInfo& Info) noexcept :
+        m_pSink{TraceSink},
+        m_Info{Info}
+    {
+        if (m_pSink != nullptr)
+            m_pSink->BeginScope(m_Info);
+    }
+
+    ~TraceScope()
+    {
+        // Use the sink the scope was started with, even if the sink has been changed since then
+        if (m_pSink != nullptr)
+            m_pSink->EndScope(m_Info);
+    }
+
+    // clang-format off
+    TraceScope           (const TraceScope&) = delete;
+    TraceScope           (TraceScope&&)      = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+    TraceScope& operator=(TraceScope&&)      = delete;
+    // clang-format on
+
+private:
+    ITraceSink* const     m_pSink;
+    const TraceScopeInfo& m_Info;
+};
+
+} // namespace Diligent
+
+#    define DILIGENT_TRACE_CONCAT_IMPL(a, b) a##b
+#    define DILIGENT_TRACE_CONCAT(a, b)      DILIGENT_TRACE_CONCAT_IMPL(a, b)
+
+/// Reports the enclosing C++ scope with the given name (a string literal)
+#    define DILIGENT_TRACE_SCOPE(Name)                                                         \
+        static const Diligent::TraceScopeInfo DILIGENT_TRACE_CONCAT(_TraceScopeInfo, __LINE__) \
+        {                                                                                      \
+            Name, __FUNCTION__, __FILE__, static_cast<Diligent::Uint32>(__LINE__)              \
+        };                                                                                     \
+        Diligent::TraceScope DILIGENT_TRACE_CONCAT(_TraceScope, __LINE__)                      \
+        {                                                                                      \
+            DILIGENT_TRACE_CONCAT(_TraceScopeInfo, __LINE__)                                   \
+        }
+
+/// Reports the value of the named counter
+#    define DILIGENT_TRACE_COUNTER(Name, Value)                          \
+        do                                                               \
+        {                                                                \
+            if (Diligent::ITraceSink* _pTraceSink = Diligent::TraceSink) \
+                _pTraceSink->Counter(Name, static_cast<double>(Value));  \
+        } while (false)
+
+/// Reports a flow event, see Diligent::ITraceSink::Flow()
+#    define DILIGENT_TRACE_FLOW(Name, Id, Phase)                                   \
+        do                                                                         \
+        {                                                                          \
+            if (Diligent::ITraceSink* _pTraceSink = Diligent::TraceSink)           \
+                _pTraceSink->Flow(Name, static_cast<Diligent::Uint64>(Id), Phase); \
+        } while (false)
+
+#else
+
+#    define DILIGENT_TRACE_SCOPE(Name)
+#    define DILIGENT_TRACE_COUNTER(Name, Value) \
+        do                                      \
+        {                                       \
+        } while (false)
+#    define DILIGENT_TRACE_FLOW(Name, Id, Phase) \
+        do                                       \
+        {                                        \
+        } while (false)
+
+#endif
+
+#define DILIGENT_TRACE_FLOW_BEGIN(Name, Id) DILIGENT_TRACE_FLOW(Name, Id, Diligent::TRACE_FLOW_PHASE_BEGIN)
+#define DILIGENT_TRACE_FLOW_STEP(Name, Id)  DILIGENT_TRACE_FLOW(Name, Id, Diligent::TRACE_FLOW_PHASE_STEP)
+#define DILIGENT_TRACE_FLOW_END(Name, Id)   DILIGENT_TRACE_FLOW(Name, Id, Diligent::TRACE_FLOW_PHASE_END)
@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::ITraceSink interface
+
+#include "BasicTypes.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+/// Static description of a trace scope.
+
+/// Every instrumented call site has its own instance with static storage duration,
+/// so a sink may use the pointer as a unique and persistent key (e.g. for Tracy source locations).
+struct TraceScopeInfo
+{
+    /// Scope name
+    const Char* Name;
+
+    /// Function name
+    const Char* Function;
+
+    /// Source file name
+    const Char* File;
+
+    /// Source line number
+    Uint32 Line;
+};
+typedef struct TraceScopeInfo TraceScopeInfo;
+
+/// Flow event phase, see ITraceSink::Flow().
+DILIGENT_TYPED_ENUM(TRACE_FLOW_PHASE, Uint8)
+{
+    /// The flow starts at this point.
+    TRACE_FLOW_PHASE_BEGIN = 0,
+
+    /// The flow passes through this point.
+    TRACE_FLOW_PHASE_STEP,
+
+    /// The flow ends at this point.
+    TRACE_FLOW_PHASE_END
+};
+
+
+#if DILIGENT_CPP_INTERFACE
+
+/// Trace sink interface.
+
+/// The engine reports CPU trace events to the sink set with SetTraceSink().
+/// An application implements the interface on top of a profiler such as
+/// Tracy, Perfetto, Superluminal, or ETW.
+///
+/// \remarks   All methods may be called simultaneously from multiple threads.
+///            BeginScope() and EndScope() calls are always paired on the same thread.
+struct ITraceSink
+{
+    /// Called when the thread enters the trace scope
+    virtual void BeginScope(const TraceScopeInfo& Info) = 0;
+
+    /// Called when the thread leaves the trace scope
+    virtual void EndScope(const TraceScopeInfo& Info) = 0;
+
+    /// Reports the value of the named counter. The name is a string literal.
+    virtual void Counter(const Char* Name, double Value) = 0;
+
+    /// Reports a flow event that connects the work of different threads or frames.
+
+    /// \param [in] Name  - Flow name. The name is a string literal.
+    /// \param [in] Id    - Flow id that is unique among the flows with the same name.
+    /// \param [in] Phase - Flow event phase.
+    virtual void Flow(const Char* Name, Uint64 Id, TRACE_FLOW_PHASE Phase) = 0;
+};
+
+#else
+
+struct ITraceSink;
+
+// clang-format off
+
+struct ITraceSinkMethods
+{
+    void (*BeginScope)(struct ITraceSink*, const TraceScopeInfo* Info);
+    void (*EndScope)  (struct ITraceSink*, const TraceScopeInfo* Info);
+    void (*Counter)   (struct ITraceSink*, const Char* Name, double Value);
+    void (*Flow)      (struct ITraceSink*, const Char* Name, Uint64 Id, TRACE_FLOW_PHASE Phase);
+};
+
+struct ITraceSinkVtbl
+{
+    struct ITraceSinkMethods TraceSink;
+};
+
+// clang-format on
+
+typedef struct ITraceSink
+{
+    struct ITraceSinkVtbl* pVtbl;
+} ITraceSink;
+
+// clang-format off
+
+#    define ITraceSink_BeginScope(This, ...) CALL_IFACE_METHOD(TraceSink, BeginScope, This, __VA_ARGS__)
+#    define ITraceSink_EndScope(This, ...)   CALL_IFACE_METHOD(TraceSink, EndScope,   This, __VA_ARGS__)
+#    define ITraceSink_Counter(This, ...)    CALL_IFACE_METHOD(TraceSink, Counter,    This, __VA_ARGS__)
+#    define ITraceSink_Flow(This, ...)       CALL_IFACE_METHOD(TraceSink, Flow,       This, __VA_ARGS__)
+
+// clang-format on
+
+#endif
+
+/// Trace sink of the module, or null if tracing is disabled
+extern ITraceSink* TraceSink;
+
+/// Sets the trace sink. Pass null to disable tracing.
+
+/// \note This function needs to be called for every executable module that
+///       wants to report trace events, see IEngineFactory::SetTraceSink().
+///       The sink must remain valid until it is reset or the module is unloaded.
+void SetTraceSink(ITraceSink* pSink);
+
+DILIGENT_END_NAMESPACE // namespace Diligent
@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "RenderDevice.h"
+#include "DeviceContext.h"
+#include "PipelineState.h"
+#include "RefCntAutoPtr.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+/// Compiles an HLSL shader with the default compiler of the testing environment.
+RefCntAutoPtr<IShader> CreateBenchmarkShader(const char*             Name,
+                                             const char*             Source,
+                                             SHADER_TYPE             Type,
+                                             const ShaderMacroArray& Macros = {});
+
+/// Returns the source of the vertex shader that draws a small procedural triangle
+/// without any vertex buffers.
+const char* GetBenchmarkVSSource();
+
+/// Returns the source of the pixel shader that reads the cbConstants constant buffer
+/// and the g_Texture texture.
+const char* GetBenchmarkPSSource();
+
+/// Creates a graphics pipeline that renders to the swap chain with the given shaders.
+/// All shader resources use the VarType variable type.
+RefCntAutoPtr<IPipelineState> CreateBenchmarkPSO(const char*                   Name,
+                                                 IShader*                      pVS,
+                                                 IShader*                      pPS,
+                                                 SHADER_RESOURCE_VARIABLE_TYPE VarType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+
+/// Creates a constant buffer suitable for the cbConstants block of the benchmark pixel shader.
+RefCntAutoPtr<IBuffer> CreateBenchmarkConstantBuffer(USAGE Usage = USAGE_DEFAULT);
+
+/// Creates a small texture for the g_Texture variable of the benchmark pixel shader.
+RefCntAutoPtr<ITexture> CreateBenchmarkTexture();
+
+/// Binds the swap chain render target to the immediate context.
+void SetBenchmarkRenderTarget(IDeviceContext* pContext);
+
+/// Submits the commands and lets the device release the resources of completed frames,
+/// so that a long-running benchmark does not accumulate memory.
+void EndBenchmarkFrame(IDeviceContext* pContext);
+
+} // namespace Testing
+
+} // namespace Diligent
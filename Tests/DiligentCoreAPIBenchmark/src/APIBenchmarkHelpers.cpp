@@ -0,0 +1,166 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "APIBenchmarkHelpers.hpp"
+
+#include <array>
+
+#include "GraphicsTypesX.hpp"
+#include "BasicMath.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+namespace
+{
+
+const char* const g_BenchmarkVS = R"(
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+};
+
+void main(in uint VertId : SV_VertexID, out PSInput PSIn)
+{
+    float2 Pos = float2(VertId == 2u ? 1.0 : -1.0, VertId == 1u ? 1.0 : -1.0);
+    PSIn.Pos   = float4(Pos * 0.01, 0.0, 1.0);
+}
+)";
+
+const char* const g_BenchmarkPS = R"(
+cbuffer cbConstants
+{
+    float4 g_Color;
+};
+
+Texture2D g_Texture;
+
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    return g_Color * g_Texture.Load(int3(0, 0, 0));
+}
+)";
+
+} // namespace
+
+RefCntAutoPtr<IShader> CreateBenchmarkShader(const char*             Name,
+                                             const char*             Source,
+                                             SHADER_TYPE             Type,
+                                             const ShaderMacroArray& Macros)
+{
+    GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.Desc           = {Name, Type, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = Source;
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pShader;
+    pEnv->GetDevice()->CreateShader(ShaderCI, &pShader);
+    return pShader;
+}
+
+const char* GetBenchmarkVSSource()
+{
+    return g_BenchmarkVS;
+}
+
+const char* GetBenchmarkPSSource()
+{
+    return g_BenchmarkPS;
+}
+
+RefCntAutoPtr<IPipelineState> CreateBenchmarkPSO(const char*                   Name,
+                                                 IShader*                      pVS,
+                                                 IShader*                      pPS,
+                                                 SHADER_RESOURCE_VARIABLE_TYPE VarType)
+{
+    GPUTestingEnvironment* pEnv   = GPUTestingEnvironment::GetInstance();
+    const SwapChainDesc&   SCDesc = pEnv->GetSwapChain()->GetDesc();
+
+    GraphicsPipelineStateCreateInfoX PSOCreateInfo{Name};
+    PSOCreateInfo
+        .AddRenderTarget(SCDesc.ColorBufferFormat)
+        .SetPrimitiveTopology(PRIMITIVE_TOPOLOGY_TRIANGLE_LIST)
+        .AddShader(pVS)
+        .AddShader(pPS);
+    PSOCreateInfo.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PSOCreateInfo.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType    = VarType;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pEnv->GetDevice()->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    return pPSO;
+}
+
+RefCntAutoPtr<IBuffer> CreateBenchmarkConstantBuffer(USAGE Usage)
+{
+    const float4 Color{1, 1, 1, 1};
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Benchmark constant buffer";
+    BuffDesc.Size           = sizeof(Color);
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.Usage          = Usage;
+    BuffDesc.CPUAccessFlags = Usage == USAGE_DYNAMIC ? CPU_ACCESS_WRITE : CPU_ACCESS_NONE;
+
+    return GPUTestingEnvironment::GetInstance()->CreateBuffer(BuffDesc, Usage == USAGE_DYNAMIC ? nullptr : &Color);
+}
+
+RefCntAutoPtr<ITexture> CreateBenchmarkTexture()
+{
+    std::array<Uint32, 4 * 4> Data;
+    Data.fill(0xFFFFFFFFu);
+    return GPUTestingEnvironment::GetInstance()->CreateTexture("Benchmark texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 4, 4, Data.data());
+}
+
+void SetBenchmarkRenderTarget(IDeviceContext* pContext)
+{
+    ITextureView* pRTV = GPUTestingEnvironment::GetInstance()->GetSwapChain()->GetCurrentBackBufferRTV();
+    pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+}
+
+void EndBenchmarkFrame(IDeviceContext* pContext)
+{
+    pContext->Flush();
+    pContext->FinishFrame();
+    GPUTestingEnvironment::GetInstance()->GetDevice()->ReleaseStaleResources();
+}
+
+} // namespace Testing
+
+} // namespace Diligent
@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "APIBenchmarkHelpers.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 NumUpdatesPerFrame = 8;
+
+RefCntAutoPtr<IBuffer> CreateBenchmarkBuffer(const char* Name, Uint64 Size, USAGE Usage)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = Name;
+    BuffDesc.Size           = Size;
+    BuffDesc.BindFlags      = BIND_VERTEX_BUFFER;
+    BuffDesc.Usage          = Usage;
+    BuffDesc.CPUAccessFlags = Usage == USAGE_DYNAMIC ? CPU_ACCESS_WRITE : CPU_ACCESS_NONE;
+    return GPUTestingEnvironment::GetInstance()->CreateBuffer(BuffDesc);
+}
+
+// Writes Arg(0) bytes to a dynamic buffer with MAP_WRITE/MAP_FLAG_DISCARD.
+// Arg(1) - 1 to wait for the GPU at the end of every frame.
+void BM_MapDynamicBuffer(benchmark::State& state)
+{
+    const size_t Size    = static_cast<size_t>(state.range(0));
+    const bool   WaitGPU = state.range(1) != 0;
+
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateBenchmarkBuffer("Map dynamic buffer benchmark", Size, USAGE_DYNAMIC);
+    if (!pBuffer)
+    {
+        state.SkipWithError("Failed to create the buffer");
+        return;
+    }
+
+    const std::vector<Uint8> Data(Size, Uint8{0x5A});
+    for (auto _ : state)
+    {
+        for (Uint32 i = 0; i < NumUpdatesPerFrame; ++i)
+        {
+            void* pMappedData = nullptr;
+            pContext->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pMappedData);
+            std::memcpy(pMappedData, Data.data(), Size);
+            pContext->UnmapBuffer(pBuffer, MAP_WRITE);
+        }
+        EndBenchmarkFrame(pContext);
+        if (WaitGPU)
+            pContext->WaitForIdle();
+    }
+    state.SetBytesProcessed(state.iterations() * NumUpdatesPerFrame * static_cast<int64_t>(Size));
+
+    pEnv->Reset();
+}
+BENCHMARK(BM_MapDynamicBuffer)
+    ->ArgsProduct({{256, 4 << 10, 64 << 10, 1 << 20, 4 << 20}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// Writes Arg(0) bytes to a default buffer with IDeviceContext::UpdateBuffer().
+// Arg(1) - 1 to wait for the GPU at the end of every frame.
+void BM_UpdateDefaultBuffer(benchmark::State& state)
+{
+    const size_t Size    = static_cast<size_t>(state.range(0));
+    const bool   WaitGPU = state.range(1) != 0;
+
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateBenchmarkBuffer("Update default buffer benchmark", Size, USAGE_DEFAULT);
+    if (!pBuffer)
+    {
+        state.SkipWithError("Failed to create the buffer");
+        return;
+    }
+
+    const std::vector<Uint8> Data(Size, Uint8{0x5A});
+    for (auto _ : state)
+    {
+        for (Uint32 i = 0; i < NumUpdatesPerFrame; ++i)
+            pContext->UpdateBuffer(pBuffer, 0, Size, Data.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        EndBenchmarkFrame(pContext);
+        if (WaitGPU)
+            pContext->WaitForIdle();
+    }
+    state.SetBytesProcessed(state.iterations() * NumUpdatesPerFrame * static_cast<int64_t>(Size));
+
+    pEnv->Reset();
+}
+BENCHMARK(BM_UpdateDefaultBuffer)
+    ->ArgsProduct({{256, 4 << 10, 64 << 10, 1 << 20, 16 << 20}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+} // namespace
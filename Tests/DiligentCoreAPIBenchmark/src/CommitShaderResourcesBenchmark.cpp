@@ -0,0 +1,101 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "APIBenchmarkHelpers.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Commits Arg(0) different SRBs per frame, each followed by a draw call.
+// Arg(1) - variable type: 0 - mutable, 1 - dynamic.
+// Arg(2) - state transition mode: 0 - none, 1 - transition.
+void BM_CommitShaderResources(benchmark::State& state)
+{
+    const Uint32                         NumSRBs        = static_cast<Uint32>(state.range(0));
+    const SHADER_RESOURCE_VARIABLE_TYPE  VarType        = state.range(1) != 0 ? SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC : SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+    const RESOURCE_STATE_TRANSITION_MODE TransitionMode = state.range(2) != 0 ? RESOURCE_STATE_TRANSITION_MODE_TRANSITION : RESOURCE_STATE_TRANSITION_MODE_NONE;
+
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IShader> pVS = CreateBenchmarkShader("Commit shader resources benchmark VS", GetBenchmarkVSSource(), SHADER_TYPE_VERTEX);
+    RefCntAutoPtr<IShader> pPS = CreateBenchmarkShader("Commit shader resources benchmark PS", GetBenchmarkPSSource(), SHADER_TYPE_PIXEL);
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreateBenchmarkPSO("Commit shader resources benchmark", pVS, pPS, VarType);
+    if (!pPSO)
+    {
+        state.SkipWithError("Failed to create the pipeline state");
+        return;
+    }
+
+    RefCntAutoPtr<ITexture> pTex = CreateBenchmarkTexture();
+
+    std::vector<RefCntAutoPtr<IBuffer>>                CBs(NumSRBs);
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> SRBs(NumSRBs);
+    for (Uint32 i = 0; i < NumSRBs; ++i)
+    {
+        CBs[i] = CreateBenchmarkConstantBuffer();
+        pPSO->CreateShaderResourceBinding(&SRBs[i], true);
+        SRBs[i]->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(CBs[i]);
+        SRBs[i]->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    }
+
+    // Transition all resources to the required states so that the benchmark
+    // may run without transitions.
+    SetBenchmarkRenderTarget(pContext);
+    pContext->SetPipelineState(pPSO);
+    for (IShaderResourceBinding* pSRB : SRBs)
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    EndBenchmarkFrame(pContext);
+
+    for (auto _ : state)
+    {
+        SetBenchmarkRenderTarget(pContext);
+        pContext->SetPipelineState(pPSO);
+        for (IShaderResourceBinding* pSRB : SRBs)
+        {
+            pContext->CommitShaderResources(pSRB, TransitionMode);
+            pContext->Draw({3, DRAW_FLAG_NONE});
+        }
+        EndBenchmarkFrame(pContext);
+    }
+    state.SetItemsProcessed(state.iterations() * NumSRBs);
+
+    pEnv->Reset();
+}
+BENCHMARK(BM_CommitShaderResources)
+    ->ArgsProduct({{64, 1024}, {0, 1}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+} // namespace
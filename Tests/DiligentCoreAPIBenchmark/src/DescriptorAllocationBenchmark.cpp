@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "APIBenchmarkHelpers.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Creates Arg(0) shader resource bindings, binds their resources and releases them.
+// SRB creation is where the backends allocate the descriptors for mutable variables.
+void BM_CreateShaderResourceBindings(benchmark::State& state)
+{
+    const Uint32 NumSRBs = static_cast<Uint32>(state.range(0));
+
+    GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+
+    RefCntAutoPtr<IShader> pVS = CreateBenchmarkShader("Descriptor allocation benchmark VS", GetBenchmarkVSSource(), SHADER_TYPE_VERTEX);
+    RefCntAutoPtr<IShader> pPS = CreateBenchmarkShader("Descriptor allocation benchmark PS", GetBenchmarkPSSource(), SHADER_TYPE_PIXEL);
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreateBenchmarkPSO("Descriptor allocation benchmark", pVS, pPS);
+    if (!pPSO)
+    {
+        state.SkipWithError("Failed to create the pipeline state");
+        return;
+    }
+
+    RefCntAutoPtr<IBuffer>  pCB     = CreateBenchmarkConstantBuffer();
+    RefCntAutoPtr<ITexture> pTex    = CreateBenchmarkTexture();
+    ITextureView*           pTexSRV = pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> SRBs(NumSRBs);
+    for (auto _ : state)
+    {
+        for (RefCntAutoPtr<IShaderResourceBinding>& pSRB : SRBs)
+        {
+            pPSO->CreateShaderResourceBinding(&pSRB, true);
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pCB);
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(pTexSRV);
+        }
+        for (RefCntAutoPtr<IShaderResourceBinding>& pSRB : SRBs)
+            pSRB.Release();
+
+        pEnv->GetDevice()->ReleaseStaleResources();
+    }
+    state.SetItemsProcessed(state.iterations() * NumSRBs);
+
+    pEnv->Reset();
+}
+BENCHMARK(BM_CreateShaderResourceBindings)
+    ->Arg(64)
+    ->Arg(1024)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+} // namespace
@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "APIBenchmarkHelpers.hpp"
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Records Arg(0) non-indexed draw calls per frame with the same pipeline and resources.
+// Arg(1) selects the draw flags: 0 - DRAW_FLAG_VERIFY_ALL, 1 - DRAW_FLAG_NONE.
+void BM_DrawCalls(benchmark::State& state)
+{
+    const Uint32     NumDraws  = static_cast<Uint32>(state.range(0));
+    const DRAW_FLAGS DrawFlags = state.range(1) != 0 ? DRAW_FLAG_NONE : DRAW_FLAG_VERIFY_ALL;
+
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IShader> pVS = CreateBenchmarkShader("Draw call benchmark VS", GetBenchmarkVSSource(), SHADER_TYPE_VERTEX);
+    RefCntAutoPtr<IShader> pPS = CreateBenchmarkShader("Draw call benchmark PS", GetBenchmarkPSSource(), SHADER_TYPE_PIXEL);
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreateBenchmarkPSO("Draw call benchmark", pVS, pPS);
+    if (!pPSO)
+    {
+        state.SkipWithError("Failed to create the pipeline state");
+        return;
+    }
+
+    RefCntAutoPtr<IBuffer>  pCB  = CreateBenchmarkConstantBuffer();
+    RefCntAutoPtr<ITexture> pTex = CreateBenchmarkTexture();
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pCB);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+
+    for (auto _ : state)
+    {
+        SetBenchmarkRenderTarget(pContext);
+        pContext->SetPipelineState(pPSO);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        const DrawAttribs DrawAttrs{3, DrawFlags};
+        for (Uint32 i = 0; i < NumDraws; ++i)
+            pContext->Draw(DrawAttrs);
+
+        EndBenchmarkFrame(pContext);
+    }
+    state.SetItemsProcessed(state.iterations() * NumDraws);
+
+    pEnv->Reset();
+}
+BENCHMARK(BM_DrawCalls)
+    ->ArgsProduct({{100, 1000, 10000}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+} // namespace
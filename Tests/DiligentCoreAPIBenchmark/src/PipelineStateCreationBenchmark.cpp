@@ -0,0 +1,114 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "APIBenchmarkHelpers.hpp"
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Measures the latency of creating a graphics pipeline from precompiled shaders.
+// Every pipeline uses a different depth bias so that it is never shared with
+// a previously created one.
+void BM_CreateGraphicsPipelineState(benchmark::State& state)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IShader> pVS = CreateBenchmarkShader("PSO creation benchmark VS", GetBenchmarkVSSource(), SHADER_TYPE_VERTEX);
+    RefCntAutoPtr<IShader> pPS = CreateBenchmarkShader("PSO creation benchmark PS", GetBenchmarkPSSource(), SHADER_TYPE_PIXEL);
+    if (!pVS || !pPS)
+    {
+        state.SkipWithError("Failed to create shaders");
+        return;
+    }
+
+    const SwapChainDesc& SCDesc = pEnv->GetSwapChain()->GetDesc();
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                                  = "PSO creation benchmark";
+    PSOCreateInfo.pVS                                           = pVS;
+    PSOCreateInfo.pPS                                           = pPS;
+    PSOCreateInfo.GraphicsPipeline.NumRenderTargets             = 1;
+    PSOCreateInfo.GraphicsPipeline.RTVFormats[0]                = SCDesc.ColorBufferFormat;
+    PSOCreateInfo.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PSOCreateInfo.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PSOCreateInfo.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    Int32 DepthBias = 0;
+    for (auto _ : state)
+    {
+        PSOCreateInfo.GraphicsPipeline.RasterizerDesc.DepthBias = ++DepthBias;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+        if (!pPSO)
+        {
+            state.SkipWithError("Failed to create the pipeline state");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    pEnv->Reset();
+}
+BENCHMARK(BM_CreateGraphicsPipelineState)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// Measures the latency of compiling both shaders and creating the pipeline.
+// A unique macro value defeats any shader caching.
+void BM_CompileShadersAndCreatePipelineState(benchmark::State& state)
+{
+    GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+
+    Uint32 Counter = 0;
+    for (auto _ : state)
+    {
+        const std::string UniqueValue = std::to_string(++Counter);
+        const ShaderMacro Macros[]    = {{"BENCHMARK_UNIQUE_ID", UniqueValue.c_str()}};
+
+        RefCntAutoPtr<IShader> pVS = CreateBenchmarkShader("PSO creation benchmark VS", GetBenchmarkVSSource(), SHADER_TYPE_VERTEX, {Macros, _countof(Macros)});
+        RefCntAutoPtr<IShader> pPS = CreateBenchmarkShader("PSO creation benchmark PS", GetBenchmarkPSSource(), SHADER_TYPE_PIXEL, {Macros, _countof(Macros)});
+
+        RefCntAutoPtr<IPipelineState> pPSO = CreateBenchmarkPSO("PSO creation benchmark", pVS, pPS);
+        if (!pPSO)
+        {
+            state.SkipWithError("Failed to create the pipeline state");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    pEnv->Reset();
+}
+BENCHMARK(BM_CompileShadersAndCreatePipelineState)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
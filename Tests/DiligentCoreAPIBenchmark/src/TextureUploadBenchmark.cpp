@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "APIBenchmarkHelpers.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Uploads a full Arg(0) x Arg(0) RGBA8 texture with IDeviceContext::UpdateTexture().
+// Arg(1) - 1 to wait for the GPU after every upload.
+void BM_UpdateTexture(benchmark::State& state)
+{
+    const Uint32 Dim     = static_cast<Uint32>(state.range(0));
+    const bool   WaitGPU = state.range(1) != 0;
+
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<ITexture> pTexture = pEnv->CreateTexture("Texture upload benchmark", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, Dim, Dim);
+    if (!pTexture)
+    {
+        state.SkipWithError("Failed to create the texture");
+        return;
+    }
+
+    const Uint64             Stride = Uint64{Dim} * 4;
+    const std::vector<Uint8> Data(static_cast<size_t>(Stride * Dim), Uint8{0x5A});
+
+    const Box               DstBox{0, Dim, 0, Dim};
+    const TextureSubResData SubResData{Data.data(), Stride};
+    for (auto _ : state)
+    {
+        pContext->UpdateTexture(pTexture, 0, 0, DstBox, SubResData, RESOURCE_STATE_TRANSITION_MODE_NONE, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        EndBenchmarkFrame(pContext);
+        if (WaitGPU)
+            pContext->WaitForIdle();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(Data.size()));
+
+    pEnv->Reset();
+}
+BENCHMARK(BM_UpdateTexture)
+    ->ArgsProduct({{64, 256, 1024, 2048}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+} // namespace
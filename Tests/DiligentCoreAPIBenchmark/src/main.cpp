@@ -0,0 +1,66 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <iostream>
+
+#include "GPUTestingEnvironment.hpp"
+#include "GraphicsAccessories.hpp"
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+// The benchmark accepts the same command line options as DiligentCoreAPITest (e.g. --mode=vk)
+// together with the google benchmark options (e.g. --benchmark_out=results.json --benchmark_out_format=json).
+int main(int argc, char** argv)
+{
+    // Removes the recognized benchmark options from the command line
+    benchmark::Initialize(&argc, argv);
+
+    GPUTestingEnvironment* pEnv = GPUTestingEnvironment::Initialize(argc, argv);
+    if (pEnv == nullptr)
+        return -1;
+
+    pEnv->SetUp();
+
+    // Record the backend and the adapter in the context section of the results,
+    // so that the results of different runs can be told apart.
+    IRenderDevice* const       pDevice     = pEnv->GetDevice();
+    const GraphicsAdapterInfo& AdapterInfo = pDevice->GetAdapterInfo();
+    benchmark::AddCustomContext("diligent_backend", GetRenderDeviceTypeShortString(pDevice->GetDeviceInfo().Type));
+    benchmark::AddCustomContext("diligent_adapter", AdapterInfo.Description);
+    benchmark::AddCustomContext("diligent_adapter_type", GetAdapterTypeString(AdapterInfo.Type));
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    pEnv->TearDown();
+    delete pEnv;
+
+    std::cout << "\n\n\n";
+    return 0;
+}
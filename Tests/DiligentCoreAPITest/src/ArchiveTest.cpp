@@ -43,6 +43,7 @@
 #include "RayTracingTestConstants.hpp"
 
 #include "Timer.hpp"
+#include "ThreadPool.hpp"
 
 using namespace Diligent;
 using namespace Diligent::Testing;
@@ -965,7 +966,9 @@ void TestGraphicsPipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = fa
                 RefCntAutoPtr<IPipelineState> pSerializedPSO;
                 pSerializationDevice->CreateGraphicsPipelineState(PSOCreateInfo, ArchiveInfo, &pSerializedPSO);
                 ASSERT_NE(pSerializedPSO, nullptr);
-                ASSERT_TRUE(pArchiver->AddPipelineState(pSerializedPSO));
+                // Use the batch method to test that it adds the render pass too
+                IPipelineState* ppSerializedPSOs[] = {pSerializedPSO};
+                ASSERT_TRUE(pArchiver->AddPipelineStates(ppSerializedPSOs, _countof(ppSerializedPSOs)));
                 EXPECT_EQ(pArchiver->GetPipelineState(PSOCreateInfo.PSODesc.PipelineType, PSOCreateInfo.PSODesc.Name), pSerializedPSO);
             }
 
@@ -1562,6 +1565,133 @@ TEST(ArchiveTest, ComputePipeline_SplitArchive_Async)
     TestComputePipeline(PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES, /*CompileAsync = */ true);
 }
 
+TEST(ArchiveTest, UnpackPipelineStates)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice          = pEnv->GetDevice();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    DearchiverCreateInfo       DearchiverCI{};
+    DearchiverCI.pThreadPool = pThreadPool;
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &pDearchiver);
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    {
+        SerializationDeviceCreateInfo SerDeviceCI;
+        SerDeviceCI.DeviceInfo.Features.SeparablePrograms = pDevice->GetDeviceInfo().Features.SeparablePrograms;
+        pArchiverFactory->CreateSerializationDevice(SerDeviceCI, &pSerializationDevice);
+        ASSERT_NE(pSerializationDevice, nullptr);
+    }
+
+    ARCHIVE_DEVICE_DATA_FLAGS DeviceBits = GetDeviceBits();
+#if PLATFORM_MACOS
+    // Compute shaders are not supported in OpenGL on MacOS
+    DeviceBits &= ~(ARCHIVE_DEVICE_DATA_FLAG_GL | ARCHIVE_DEVICE_DATA_FLAG_GLES);
+#endif
+
+    // All pipelines share the same signature and shader
+    constexpr Uint32 NumPSOs = 4;
+    std::array<std::string, NumPSOs> PSONames;
+    {
+        RefCntAutoPtr<IPipelineResourceSignature> pSerializedPRS;
+        {
+            constexpr PipelineResourceDesc Resources[] = {
+                {SHADER_TYPE_COMPUTE, "g_tex2DUAV", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC, PIPELINE_RESOURCE_FLAG_NONE, {WEB_GPU_BINDING_TYPE_WRITE_ONLY_TEXTURE_UAV, RESOURCE_DIM_TEX_2D, TEX_FORMAT_RGBA8_UNORM}},
+            };
+
+            PipelineResourceSignatureDesc PRSDesc;
+            PRSDesc.Name         = "ArchiveTest.UnpackPipelineStates - PRS";
+            PRSDesc.Resources    = Resources;
+            PRSDesc.NumResources = _countof(Resources);
+
+            pSerializationDevice->CreatePipelineResourceSignature(PRSDesc, ResourceSignatureArchiveInfo{DeviceBits}, &pSerializedPRS);
+            ASSERT_NE(pSerializedPRS, nullptr);
+        }
+
+        ShaderCreateInfo       ShaderCI;
+        RefCntAutoPtr<IShader> pSerializedCS;
+        CreateComputeShader(pDevice, pSerializationDevice, ShaderCI, nullptr, &pSerializedCS);
+        ASSERT_NE(pSerializedCS, nullptr);
+
+        RefCntAutoPtr<IArchiver> pArchiver;
+        pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+        ASSERT_NE(pArchiver, nullptr);
+
+        for (Uint32 i = 0; i < NumPSOs; ++i)
+        {
+            PSONames[i] = "ArchiveTest.UnpackPipelineStates - PSO " + std::to_string(i);
+
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            PSOCreateInfo.PSODesc.Name         = PSONames[i].c_str();
+            PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+            PSOCreateInfo.pCS                  = pSerializedCS;
+
+            IPipelineResourceSignature* Signatures[] = {pSerializedPRS};
+            PSOCreateInfo.ResourceSignaturesCount    = _countof(Signatures);
+            PSOCreateInfo.ppResourceSignatures       = Signatures;
+
+            PipelineStateArchiveInfo ArchiveInfo;
+            ArchiveInfo.DeviceFlags = DeviceBits;
+            RefCntAutoPtr<IPipelineState> pSerializedPSO;
+            pSerializationDevice->CreateComputePipelineState(PSOCreateInfo, ArchiveInfo, &pSerializedPSO);
+            ASSERT_NE(pSerializedPSO, nullptr);
+            ASSERT_TRUE(pArchiver->AddPipelineState(pSerializedPSO));
+        }
+
+        RefCntAutoPtr<IDataBlob> pArchive;
+        pArchiver->SerializeToBlob(ContentVersion, &pArchive);
+        ASSERT_NE(pArchive, nullptr);
+        ASSERT_TRUE(pDearchiver->LoadArchive(pArchive, ContentVersion));
+    }
+
+    // Every pipeline is requested twice; the last entry does not exist in the archive
+    std::vector<PipelineStateUnpackInfo> UnpackInfos(NumPSOs * 2 + 1);
+    for (size_t i = 0; i < UnpackInfos.size(); ++i)
+    {
+        PipelineStateUnpackInfo& UnpackInfo = UnpackInfos[i];
+        UnpackInfo.Name                     = i < NumPSOs * 2 ? PSONames[i % NumPSOs].c_str() : "Non-existing PSO name";
+        UnpackInfo.pDevice                  = pDevice;
+        UnpackInfo.PipelineType             = PIPELINE_TYPE_COMPUTE;
+    }
+
+    std::vector<IPipelineState*> pPSOs(UnpackInfos.size());
+    pDearchiver->UnpackPipelineStates(UnpackInfos.data(), static_cast<Uint32>(UnpackInfos.size()), pPSOs.data());
+
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        ASSERT_NE(pPSOs[i], nullptr) << PSONames[i];
+        EXPECT_STREQ(pPSOs[i]->GetDesc().Name, PSONames[i].c_str());
+        EXPECT_EQ(pPSOs[i], pPSOs[i + NumPSOs]);
+        EXPECT_EQ(pPSOs[i]->GetResourceSignature(0), pPSOs[0]->GetResourceSignature(0));
+        EXPECT_EQ(pPSOs[i]->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+    }
+    EXPECT_EQ(pPSOs.back(), nullptr);
+
+    // Pipelines that were already unpacked are returned from the cache
+    {
+        RefCntAutoPtr<IPipelineState> pUnpackedPSO;
+        pDearchiver->UnpackPipelineState(UnpackInfos[0], &pUnpackedPSO);
+        EXPECT_EQ(pUnpackedPSO, pPSOs[0]);
+    }
+
+    for (IPipelineState* pPSO : pPSOs)
+    {
+        if (pPSO != nullptr)
+            pPSO->Release();
+    }
+}
+
 void TestRayTracingPipeline(bool CompileAsync = false)
 {
     GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
@@ -2769,6 +2899,33 @@ TEST(ArchiveTest, MergeArchives)
         ASSERT_NE(pUnpackedPSO, nullptr);
         EXPECT_EQ(pUnpackedPSO->GetDesc(), PSOCreateInfo.PSODesc);
     }
+
+    // Objects must be unpacked from the compressed archive in the same way
+    {
+        RefCntAutoPtr<IDataBlob> pCompressedArchive;
+        ASSERT_TRUE(pArchiverFactory->CompressArchive(pArchive, ARCHIVE_COMPRESSION_MODE_LZ4, &pCompressedArchive));
+        ASSERT_NE(pCompressedArchive, nullptr);
+        EXPECT_TRUE(pArchiverFactory->PrintArchiveContent(pCompressedArchive));
+
+        RefCntAutoPtr<IDearchiver> pDearchiver2;
+        pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &pDearchiver2);
+        ASSERT_NE(pDearchiver2, nullptr);
+        pDearchiver2->LoadArchive(pCompressedArchive, ContentVersion);
+
+        UnpackShader(pDevice, pDearchiver2, VsCI);
+        UnpackShader(pDevice, pDearchiver2, PsCI);
+        UnpackShader(pDevice, pDearchiver2, CsCI);
+
+        PipelineStateUnpackInfo UnpackInfo;
+        UnpackInfo.Name         = PSOName;
+        UnpackInfo.pDevice      = pDevice;
+        UnpackInfo.PipelineType = PIPELINE_TYPE_GRAPHICS;
+
+        RefCntAutoPtr<IPipelineState> pUnpackedPSO;
+        pDearchiver2->UnpackPipelineState(UnpackInfo, &pUnpackedPSO);
+        ASSERT_NE(pUnpackedPSO, nullptr);
+        EXPECT_EQ(pUnpackedPSO->GetDesc(), PSOCreateInfo.PSODesc);
+    }
 }
 
 } // namespace
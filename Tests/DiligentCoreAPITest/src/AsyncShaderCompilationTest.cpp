@@ -126,6 +126,62 @@ TEST(Shader, AsyncCompilation)
     LOG_INFO_MESSAGE(Shaders.size(), " shaders were compiled after ", Iter, " iterations (", (T.GetElapsedTime() - StartTime) * 1000, " ms)");
 }
 
+TEST(Shader, CreateShadersBatch)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders", &pShaderSourceFactory);
+
+    ShaderMacroHelper Macros;
+    Macros.Add("SIMPLIFIED", 1);
+
+    constexpr Uint32              NumShaders = 8;
+    std::vector<ShaderCreateInfo> ShaderCIs(NumShaders);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        ShaderCreateInfo& ShaderCI          = ShaderCIs[i];
+        ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+        ShaderCI.EntryPoint                 = "main";
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.Macros                     = Macros;
+        if (i % 2 == 0)
+        {
+            ShaderCI.FilePath = "AsyncShaderCompilationTest.vsh";
+            ShaderCI.Desc     = {"Batch compilation test VS", SHADER_TYPE_VERTEX, true};
+        }
+        else
+        {
+            ShaderCI.FilePath = "AsyncShaderCompilationTest.psh";
+            ShaderCI.Desc     = {"Batch compilation test PS", SHADER_TYPE_PIXEL, true};
+        }
+        // Mix synchronous and asynchronous requests
+        if (i % 4 >= 2)
+            ShaderCI.CompileFlags = SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+    }
+
+    std::vector<IShader*> ppShaders(NumShaders);
+    pDevice->CreateShaders(ShaderCIs.data(), NumShaders, ppShaders.data());
+
+    std::vector<RefCntAutoPtr<IShader>> Shaders(NumShaders);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+        Shaders[i].Attach(ppShaders[i]);
+
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        const RefCntAutoPtr<IShader>& pShader = Shaders[i];
+        ASSERT_NE(pShader, nullptr) << "Shader " << i;
+        EXPECT_EQ(pShader->GetDesc().ShaderType, ShaderCIs[i].Desc.ShaderType);
+        if ((ShaderCIs[i].CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) == 0)
+            EXPECT_EQ(pShader->GetStatus(), SHADER_STATUS_READY);
+        EXPECT_EQ(pShader->GetStatus(/*WaitForCompletion = */ true), SHADER_STATUS_READY);
+    }
+}
+
 TEST(Shader, ReleaseWhileCompiling)
 {
     GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BLASBuilder.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include <array>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 NumTestBLASes = 4;
+
+struct BLASBuilderTestData
+{
+    RefCntAutoPtr<IBuffer>                     pVertexBuffer;
+    BLASBuildTriangleData                      Triangle;
+    std::vector<RefCntAutoPtr<IBottomLevelAS>> BLASes;
+    std::vector<BLASBuilder::BuildInfo>        BuildInfos;
+};
+
+void CreateTestData(IRenderDevice* pDevice, RAYTRACING_BUILD_AS_FLAGS Flags, BLASBuilderTestData& Data)
+{
+    static constexpr float Vertices[] = {
+        0.25f, 0.25f, 0.0f,
+        0.75f, 0.25f, 0.0f,
+        0.50f, 0.75f, 0.0f,
+    };
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "BLAS builder test vertices";
+    BuffDesc.BindFlags = BIND_RAY_TRACING;
+    BuffDesc.Size      = sizeof(Vertices);
+
+    BufferData InitData{Vertices, sizeof(Vertices)};
+    pDevice->CreateBuffer(BuffDesc, &InitData, &Data.pVertexBuffer);
+    ASSERT_NE(Data.pVertexBuffer, nullptr);
+
+    Data.Triangle.GeometryName         = "Triangle";
+    Data.Triangle.pVertexBuffer        = Data.pVertexBuffer;
+    Data.Triangle.VertexStride         = sizeof(float) * 3;
+    Data.Triangle.VertexCount          = 3;
+    Data.Triangle.VertexValueType      = VT_FLOAT32;
+    Data.Triangle.VertexComponentCount = 3;
+    Data.Triangle.PrimitiveCount       = 1;
+    Data.Triangle.Flags                = RAYTRACING_GEOMETRY_FLAG_OPAQUE;
+
+    BLASTriangleDesc TriangleDesc;
+    TriangleDesc.GeometryName         = Data.Triangle.GeometryName;
+    TriangleDesc.MaxVertexCount       = Data.Triangle.VertexCount;
+    TriangleDesc.VertexValueType      = Data.Triangle.VertexValueType;
+    TriangleDesc.VertexComponentCount = Data.Triangle.VertexComponentCount;
+    TriangleDesc.MaxPrimitiveCount    = Data.Triangle.PrimitiveCount;
+
+    for (Uint32 i = 0; i < NumTestBLASes; ++i)
+    {
+        BottomLevelASDesc ASDesc;
+        ASDesc.Name          = "BLAS builder test BLAS";
+        ASDesc.Flags         = Flags;
+        ASDesc.pTriangles    = &TriangleDesc;
+        ASDesc.TriangleCount = 1;
+
+        RefCntAutoPtr<IBottomLevelAS> pBLAS;
+        pDevice->CreateBLAS(ASDesc, &pBLAS);
+        ASSERT_NE(pBLAS, nullptr);
+
+        BLASBuilder::BuildInfo Info;
+        Info.pBLAS             = pBLAS;
+        Info.pTriangleData     = &Data.Triangle;
+        Info.TriangleDataCount = 1;
+        Data.BuildInfos.push_back(Info);
+        Data.BLASes.emplace_back(std::move(pBLAS));
+    }
+}
+
+TEST(BLASBuilderTest, BuildAndCompact)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!pEnv->SupportsRayTracing())
+        GTEST_SKIP() << "Ray tracing is not supported by this device";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    BLASBuilderTestData Data;
+    CreateTestData(pDevice, RAYTRACING_BUILD_AS_ALLOW_COMPACTION, Data);
+    ASSERT_EQ(Data.BuildInfos.size(), NumTestBLASes);
+
+    BLASBuilder Builder{pDevice};
+
+    std::vector<RefCntAutoPtr<IBottomLevelAS>> CompactedBLASes;
+    EXPECT_TRUE(Builder.Build(pContext, Data.BuildInfos.data(), NumTestBLASes,
+                              [&](IBottomLevelAS* pSrcBLAS, IBottomLevelAS* pCompactedBLAS) {
+                                  EXPECT_NE(pSrcBLAS, nullptr);
+                                  ASSERT_NE(pCompactedBLAS, nullptr);
+                                  EXPECT_NE(pCompactedBLAS->GetDesc().CompactedSize, Uint64{0});
+                                  CompactedBLASes.emplace_back(pCompactedBLAS);
+                              }));
+    EXPECT_EQ(Builder.GetNumPendingCompactions(), NumTestBLASes);
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+
+    EXPECT_EQ(Builder.Poll(pContext), NumTestBLASes);
+    EXPECT_EQ(Builder.GetNumPendingCompactions(), 0u);
+    EXPECT_EQ(CompactedBLASes.size(), size_t{NumTestBLASes});
+
+    pContext->WaitForIdle();
+}
+
+TEST(BLASBuilderTest, LimitedScratchBuffer)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!pEnv->SupportsRayTracing())
+        GTEST_SKIP() << "Ray tracing is not supported by this device";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // BLASes without ALLOW_COMPACTION flag are built, but not compacted
+    BLASBuilderTestData Data;
+    CreateTestData(pDevice, RAYTRACING_BUILD_AS_NONE, Data);
+    ASSERT_EQ(Data.BuildInfos.size(), NumTestBLASes);
+
+    // Every build gets its own batch
+    BLASBuilderCreateInfo CI;
+    CI.MaxScratchBufferSize = 1;
+
+    BLASBuilder Builder{pDevice, CI};
+
+    Uint32 NumCallbacks = 0;
+    EXPECT_TRUE(Builder.Build(pContext, Data.BuildInfos.data(), NumTestBLASes,
+                              [&](IBottomLevelAS*, IBottomLevelAS*) {
+                                  ++NumCallbacks;
+                              }));
+    EXPECT_EQ(Builder.GetNumPendingCompactions(), 0u);
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+
+    EXPECT_EQ(Builder.Poll(pContext), 0u);
+    EXPECT_EQ(NumCallbacks, 0u);
+}
+
+} // namespace
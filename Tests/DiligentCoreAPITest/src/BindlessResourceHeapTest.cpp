@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BindlessResourceHeap.hpp"
+
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(BindlessResourceHeapTest, AllocateRelease)
+{
+    auto* const pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice = pEnv->GetDevice();
+
+    const DeviceFeatures& Features = pDevice->GetDeviceInfo().Features;
+    if (!Features.BindlessResources || !Features.ShaderResourceRuntimeArrays)
+    {
+        GTEST_SKIP() << "Bindless resources are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumTextures = 8;
+
+    BindlessResourceHeapCreateInfo CI;
+    CI.Name              = "Bindless resource heap test";
+    CI.ShaderStages      = SHADER_TYPE_PIXEL;
+    CI.NumTextureSRVs    = NumTextures;
+    CI.NumSamplers       = 2;
+    CI.NumFramesInFlight = 2;
+    BindlessResourceHeap Heap{pDevice, CI};
+    ASSERT_NE(Heap.GetSignature(), nullptr);
+    ASSERT_NE(Heap.GetSRB(), nullptr);
+    EXPECT_EQ(Heap.GetCapacity(SHADER_RESOURCE_TYPE_TEXTURE_SRV), NumTextures);
+    EXPECT_EQ(Heap.GetCapacity(SHADER_RESOURCE_TYPE_SAMPLER), 2u);
+    EXPECT_EQ(Heap.GetCapacity(SHADER_RESOURCE_TYPE_BUFFER_SRV), 0u);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Bindless resource heap test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.Width     = 16;
+    TexDesc.Height    = 16;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    RefCntAutoPtr<ITexture> pTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTex);
+    ASSERT_NE(pTex, nullptr);
+    ITextureView* pSRV = pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    std::vector<Uint32> Indices;
+    for (Uint32 i = 0; i < NumTextures; ++i)
+    {
+        const Uint32 Index = Heap.Allocate(SHADER_RESOURCE_TYPE_TEXTURE_SRV, pSRV);
+        ASSERT_NE(Index, BindlessResourceHeap::InvalidIndex);
+        EXPECT_EQ(Index, i);
+        Indices.push_back(Index);
+    }
+    EXPECT_EQ(Heap.GetAllocatedCount(SHADER_RESOURCE_TYPE_TEXTURE_SRV), NumTextures);
+
+    pEnv->SetErrorAllowance(1);
+    EXPECT_EQ(Heap.Allocate(SHADER_RESOURCE_TYPE_TEXTURE_SRV, pSRV), BindlessResourceHeap::InvalidIndex);
+
+    Heap.Update(SHADER_RESOURCE_TYPE_TEXTURE_SRV, Indices[3], pSRV);
+
+    Heap.Release(SHADER_RESOURCE_TYPE_TEXTURE_SRV, Indices[5]);
+    EXPECT_EQ(Heap.GetAllocatedCount(SHADER_RESOURCE_TYPE_TEXTURE_SRV), NumTextures - 1);
+
+    // The released index must not be reused until NumFramesInFlight frames have been finished
+    Heap.FinishFrame();
+    pEnv->SetErrorAllowance(1);
+    EXPECT_EQ(Heap.Allocate(SHADER_RESOURCE_TYPE_TEXTURE_SRV, pSRV), BindlessResourceHeap::InvalidIndex);
+
+    Heap.FinishFrame();
+    EXPECT_EQ(Heap.Allocate(SHADER_RESOURCE_TYPE_TEXTURE_SRV, pSRV), Indices[5]);
+    EXPECT_EQ(Heap.GetAllocatedCount(SHADER_RESOURCE_TYPE_TEXTURE_SRV), NumTextures);
+
+    SamplerDesc SamDesc;
+    RefCntAutoPtr<ISampler> pSampler;
+    pDevice->CreateSampler(SamDesc, &pSampler);
+    ASSERT_NE(pSampler, nullptr);
+    EXPECT_EQ(Heap.Allocate(SHADER_RESOURCE_TYPE_SAMPLER, pSampler), 0u);
+    EXPECT_EQ(Heap.Allocate(SHADER_RESOURCE_TYPE_SAMPLER, pSampler), 1u);
+}
+
+} // namespace
@@ -153,4 +153,73 @@ TEST(BufferSuballocatorTest, Allocate)
     }
 }
 
+
+TEST(BufferSuballocatorTest, Defragment)
+{
+    auto* const pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice  = pEnv->GetDevice();
+    auto* const pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferSuballocatorCreateInfo CI;
+    CI.Desc.Name      = "Buffer Suballocator Defragment Test";
+    CI.Desc.BindFlags = BIND_VERTEX_BUFFER;
+    CI.Desc.Size      = 1024;
+
+    RefCntAutoPtr<IBufferSuballocator> pAllocator;
+    CreateBufferSuballocator(pDevice, CI, &pAllocator);
+    ASSERT_NE(pAllocator, nullptr);
+
+    RefCntAutoPtr<IBufferSuballocation> pAllocs[4];
+    for (auto& pAlloc : pAllocs)
+    {
+        pAllocator->Allocate(128, 16, &pAlloc);
+        ASSERT_NE(pAlloc, nullptr);
+    }
+    EXPECT_EQ(pAllocs[3]->GetOffset(), 384u);
+
+    pAllocator->Update(pDevice, pContext);
+
+    // Nothing to move
+    EXPECT_EQ(pAllocator->Defragment(pDevice, pContext, 1024), 0u);
+
+    // [0, 128) [free] [256, 384) [384, 512)
+    pAllocs[1].Release();
+
+    const Uint32 Version = pAllocator->GetVersion();
+
+    // Budget is too small to move anything
+    EXPECT_EQ(pAllocator->Defragment(pDevice, pContext, 64), 0u);
+    EXPECT_EQ(pAllocator->GetVersion(), Version);
+
+    // The last allocation is moved to the hole
+    EXPECT_EQ(pAllocator->Defragment(pDevice, pContext, 128), 128u);
+    EXPECT_EQ(pAllocs[3]->GetOffset(), 128u);
+    EXPECT_EQ(pAllocs[2]->GetOffset(), 256u);
+    EXPECT_NE(pAllocator->GetVersion(), Version);
+
+    // [0, 128) [128, 256) [256, 384) - tightly packed
+    EXPECT_EQ(pAllocator->Defragment(pDevice, pContext, 1024), 0u);
+
+    BufferSuballocatorUsageStats Stats;
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, 3u);
+    EXPECT_EQ(Stats.UsedSize, 384u);
+
+    // Free space at the beginning of the buffer
+    pAllocs[0].Release();
+    EXPECT_EQ(pAllocator->Defragment(pDevice, pContext, 1024), 128u);
+    EXPECT_EQ(pAllocs[2]->GetOffset(), 0u);
+    EXPECT_EQ(pAllocs[3]->GetOffset(), 128u);
+
+    RefCntAutoPtr<IBufferSuballocation> pAlloc;
+    pAllocator->Allocate(256, 16, &pAlloc);
+    ASSERT_NE(pAlloc, nullptr);
+    EXPECT_EQ(pAlloc->GetOffset(), 256u);
+
+    pContext->Flush();
+    pContext->FinishFrame();
+}
+
 } // namespace
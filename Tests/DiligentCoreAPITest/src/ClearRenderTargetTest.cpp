@@ -213,6 +213,27 @@ TEST(ClearRenderTargetTest, ClearAfterClear)
 
 
 
+TEST(ClearRenderTargetTest, ClearAfterInvalidate)
+{
+    GPUTestingEnvironment* pEnv       = GPUTestingEnvironment::GetInstance();
+    ISwapChain*            pSwapChain = pEnv->GetSwapChain();
+    IDeviceContext*        pContext   = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr float ClearColor[] = {0.375f, 0.625f, 0.125f, 1.0f};
+    ReferenceClear(ClearColor);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->InvalidateRenderTargets(1u << 0, false);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pSwapChain->Present();
+}
+
+
+
 TEST(ClearRenderTargetTest, UnboundClearAfterClear)
 {
     GPUTestingEnvironment*  pEnv       = GPUTestingEnvironment::GetInstance();
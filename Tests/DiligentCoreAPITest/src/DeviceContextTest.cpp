@@ -50,4 +50,79 @@ TEST(DeviceContextTest, DebugGroups)
     pCtx->EndDebugGroup();
 }
 
+TEST(DeviceContextTest, RedundantStateFiltering)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pCtx       = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pCtx->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const SwapChainDesc& SCDesc = pSwapChain->GetDesc();
+
+    const DeviceContextRedundantCommandCounters RefCounters = pCtx->GetStats().RedundantCommandCounters;
+
+    Viewport VP{0.f, 0.f, static_cast<float>(SCDesc.Width) / 2, static_cast<float>(SCDesc.Height) / 2};
+    pCtx->SetViewports(1, &VP, SCDesc.Width, SCDesc.Height);
+    pCtx->SetViewports(1, &VP, SCDesc.Width, SCDesc.Height);
+
+    Rect Scissor{0, 0, static_cast<Int32>(SCDesc.Width) / 2, static_cast<Int32>(SCDesc.Height) / 2};
+    pCtx->SetScissorRects(1, &Scissor, SCDesc.Width, SCDesc.Height);
+    pCtx->SetScissorRects(1, &Scissor, SCDesc.Width, SCDesc.Height);
+
+    constexpr float BlendFactors[] = {0.25, 0.5, 0.75, 1.0};
+    pCtx->SetBlendFactors(BlendFactors);
+    pCtx->SetBlendFactors(BlendFactors);
+
+    pCtx->SetStencilRef(7);
+    pCtx->SetStencilRef(7);
+
+    const DeviceContextRedundantCommandCounters& Counters = pCtx->GetStats().RedundantCommandCounters;
+    EXPECT_EQ(Counters.SetViewports, RefCounters.SetViewports + 1);
+    EXPECT_EQ(Counters.SetScissorRects, RefCounters.SetScissorRects + 1);
+    EXPECT_EQ(Counters.SetBlendFactors, RefCounters.SetBlendFactors + 1);
+    EXPECT_EQ(Counters.SetStencilRef, RefCounters.SetStencilRef + 1);
+
+    // Changing the render target size must not be filtered out
+    pCtx->SetViewports(1, &VP, SCDesc.Width, SCDesc.Height + 1);
+    EXPECT_EQ(pCtx->GetStats().RedundantCommandCounters.SetViewports, RefCounters.SetViewports + 1);
+}
+
+TEST(DeviceContextTest, TimingStats)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pCtx       = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+
+    constexpr float ClearColor[] = {0.25, 0.5, 0.75, 1.0};
+    for (Uint32 Frame = 0; Frame < 4; ++Frame)
+    {
+        pCtx->ClearStats();
+
+        pCtx->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->Flush();
+
+        const DeviceContextStats& Stats = pCtx->GetStats();
+        EXPECT_GE(Stats.QueueSubmits, 1u);
+        EXPECT_GT(Stats.CPUTimes.Submit, 0u);
+
+        pCtx->WaitForIdle();
+        pCtx->FinishFrame();
+    }
+
+    if (pDevice->GetDeviceInfo().Features.TimestampQueries)
+    {
+        EXPECT_GT(pCtx->GetStats().GPUFrameTime, 0u);
+    }
+}
+
 } // namespace
@@ -2252,6 +2252,85 @@ TEST_F(DrawCommandTest, MultiDrawIndexedIndirect)
     Present();
 }
 
+TEST_F(DrawCommandTest, ExecuteIndirectCommands)
+{
+    GPUTestingEnvironment* const pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice* const         pDevice  = pEnv->GetDevice();
+    const DRAW_COMMAND_CAP_FLAGS DrawCaps = pDevice->GetAdapterInfo().DrawCommand.CapFlags;
+    if ((DrawCaps & DRAW_COMMAND_CAP_FLAG_INDIRECT_COMMAND_SIGNATURE) == 0)
+    {
+        GTEST_SKIP() << "Indirect command signatures are not supported by this device";
+    }
+
+    IDeviceContext* pContext = pEnv->GetDeviceContext();
+    SetRenderTargets(sm_pDrawInstancedPSO);
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {}, {}, {}, {}, // Skip 4 vertices with VB offset
+        {}, {}, {},     // Skip 3 vertices with BaseVertex
+        {}, {},
+        VertInst[1], {}, VertInst[0], {}, {}, VertInst[2]
+    };
+    const Uint32 Indices[] = {0,0,0,0, 4, 2, 7};
+    const float4 InstancedData[] =
+    {
+        {}, {}, {}, {},     // Skip 4 instances with VB offset
+        {}, {}, {}, {}, {}, // Skip 5 instances with FirstInstance
+        float4{0.5f,  0.5f,  -0.5f, -0.5f},
+        float4{0.5f,  0.5f,  +0.5f, -0.5f}
+    };
+    // clang-format on
+
+    RefCntAutoPtr<IBuffer> pVB     = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    RefCntAutoPtr<IBuffer> pInstVB = CreateVertexBuffer(InstancedData, sizeof(InstancedData));
+    RefCntAutoPtr<IBuffer> pIB     = CreateIndexBuffer(Indices, _countof(Indices));
+
+    IBuffer*     pVBs[]    = {pVB, pInstVB};
+    const Uint64 Offsets[] = {4 * sizeof(Vertex), 4 * sizeof(float4)};
+    pContext->SetVertexBuffers(0, _countof(pVBs), pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    pContext->SetIndexBuffer(pIB, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const IndirectCommandArgumentDesc Args[] = {IndirectCommandArgumentDesc{INDIRECT_COMMAND_ARGUMENT_TYPE_DRAW_INDEXED}};
+
+    IndirectCommandSignatureDesc SignDesc{Args, _countof(Args), 7 * sizeof(Uint32)};
+    SignDesc.Name = "ExecuteIndirectCommands test signature";
+
+    RefCntAutoPtr<IIndirectCommandSignature> pSignature;
+    pDevice->CreateIndirectCommandSignature(SignDesc, &pSignature);
+    ASSERT_NE(pSignature, nullptr);
+    EXPECT_EQ(pSignature->GetCommandStride(), 7 * sizeof(Uint32));
+
+    const Uint32 IndirectDrawData[] =
+        {
+            0, 0, 0, 0, 0, // Offset
+
+            3, // NumIndices
+            1, // NumInstances
+            4, // FirstIndexLocation
+            3, // BaseVertex
+            5, // FirstInstanceLocation
+            0, // Test padding
+            0, // Test padding
+
+            3, // NumIndices
+            1, // NumInstances
+            4, // FirstIndexLocation
+            3, // BaseVertex
+            6, // FirstInstanceLocation
+            0, // Test padding
+            0, // Test padding
+        };
+    RefCntAutoPtr<IBuffer> pIndirectArgsBuff = CreateIndirectDrawArgsBuffer(IndirectDrawData, sizeof(IndirectDrawData));
+
+    ExecuteIndirectCommandsAttribs ExecAttribs{pSignature, pIndirectArgsBuff, 2, DRAW_FLAG_VERIFY_ALL, 5 * sizeof(Uint32), RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+    ExecAttribs.IndexType = VT_UINT32;
+    pContext->ExecuteIndirectCommands(ExecAttribs);
+
+    Present();
+}
+
 TEST_F(DrawCommandTest, MultiDrawIndirectCount)
 {
     GPUTestingEnvironment* const pEnv     = GPUTestingEnvironment::GetInstance();
@@ -2596,6 +2675,71 @@ TEST_F(DrawCommandTest, DeferredContexts)
 }
 
 
+TEST_F(DrawCommandTest, ReusableCommandList)
+{
+    GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+    if (pEnv->GetNumDeferredContexts() == 0)
+    {
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+    }
+
+    ISwapChain*     pSwapChain    = pEnv->GetSwapChain();
+    IDeviceContext* pImmediateCtx = pEnv->GetDeviceContext();
+
+    const float ClearColor[] = {sm_Rnd(), sm_Rnd(), sm_Rnd(), sm_Rnd()};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    const Uint32           Indices[] = {0, 1, 2, 3, 4, 5};
+    RefCntAutoPtr<IBuffer> pVB       = CreateVertexBuffer(Vert, sizeof(Vert));
+    RefCntAutoPtr<IBuffer> pIB       = CreateIndexBuffer(Indices, _countof(Indices));
+
+    StateTransitionDesc Barriers[] = //
+        {
+            {pVB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_VERTEX_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {pIB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_INDEX_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE} //
+        };
+    pImmediateCtx->TransitionResourceStates(_countof(Barriers), Barriers);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pImmediateCtx->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pImmediateCtx->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    IDeviceContext* pCtx = pEnv->GetDeferredContext(0);
+
+    RefCntAutoPtr<ICommandList> pCmdList;
+    {
+        pCtx->Begin(0, COMMAND_LIST_FLAG_REUSABLE);
+        pCtx->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        IBuffer*     pVBs[]    = {pVB};
+        const Uint64 Offsets[] = {0};
+        pCtx->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_VERIFY, SET_VERTEX_BUFFERS_FLAG_RESET);
+        pCtx->SetIndexBuffer(pIB, 0, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        pCtx->SetPipelineState(sm_pDrawPSO);
+
+        DrawIndexedAttribs drawAttrs{6, VT_UINT32, DRAW_FLAG_VERIFY_ALL};
+        pCtx->DrawIndexed(drawAttrs);
+
+        pCtx->FinishCommandList(&pCmdList);
+    }
+
+    // Execute the same command list in two separate submissions. Drawing the
+    // same triangles twice must produce the same image.
+    ICommandList* pCmdLists[] = {pCmdList};
+    pImmediateCtx->ExecuteCommandLists(1, pCmdLists);
+    pImmediateCtx->Flush();
+    pImmediateCtx->ExecuteCommandLists(1, pCmdLists);
+
+    pCtx->FinishFrame();
+
+    Present();
+
+    // The command list may be released while the GPU is still executing it
+    pCmdList.Release();
+    pImmediateCtx->WaitForIdle();
+}
+
 void DrawCommandTest::TestDynamicBufferUpdates(IShader*                      pVS,
                                                IShader*                      pPS,
                                                IBuffer*                      pDynamicCB0,
@@ -314,4 +314,79 @@ INSTANTIATE_TEST_SUITE_P(DynamicTextureArray,
                              testing::Values<TEXTURE_FORMAT>(TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_BC1_UNORM_SRGB)),
                          GetTestName); //
 
+
+TEST(DynamicTextureArrayTest, Paged)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    DynamicTextureArrayCreateInfo DynTexArrCI;
+    DynTexArrCI.NumSlicesInTexturePage = 4;
+
+    auto& Desc{DynTexArrCI.Desc};
+    Desc.Name      = "Paged dynamic texture array test";
+    Desc.Type      = RESOURCE_DIM_TEX_2D_ARRAY;
+    Desc.BindFlags = BIND_SHADER_RESOURCE;
+    Desc.Width     = 256;
+    Desc.Height    = 256;
+    Desc.MipLevels = 0;
+    Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    Desc.ArraySize = 3;
+
+    auto pDynTexArray = std::make_unique<DynamicTextureArray>(pDevice, DynTexArrCI);
+    ASSERT_NE(pDynTexArray, nullptr);
+    EXPECT_TRUE(pDynTexArray->IsPaged());
+    EXPECT_FALSE(pDynTexArray->PendingUpdate());
+    EXPECT_EQ(pDynTexArray->GetNumPages(), 1u);
+    EXPECT_EQ(pDynTexArray->GetDesc().ArraySize, 3u);
+
+    RefCntAutoPtr<ITexture> pPage0{pDynTexArray->GetPage(0)};
+    ASSERT_NE(pPage0, nullptr);
+    EXPECT_EQ(pPage0->GetDesc().ArraySize, 4u);
+    EXPECT_EQ(pDynTexArray->GetTexture(), pPage0);
+
+    // Growing the array creates new pages and does not require a device context
+    auto Version = pDynTexArray->GetVersion();
+    pDynTexArray->Resize(pDevice, nullptr, 10);
+    EXPECT_FALSE(pDynTexArray->PendingUpdate());
+    EXPECT_EQ(pDynTexArray->GetNumPages(), 3u);
+    EXPECT_EQ(pDynTexArray->GetDesc().ArraySize, 10u);
+    EXPECT_EQ(pDynTexArray->GetPage(0), pPage0);
+    EXPECT_GT(pDynTexArray->GetVersion(), Version);
+
+    std::vector<IDeviceObject*> Views;
+    pDynTexArray->GetPageViews(TEXTURE_VIEW_SHADER_RESOURCE, Views);
+    ASSERT_EQ(Views.size(), size_t{3});
+    for (Uint32 i = 0; i < 3; ++i)
+        EXPECT_EQ(Views[i], pDynTexArray->GetPage(i)->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+
+    // Deferred page creation
+    pDynTexArray->Resize(nullptr, nullptr, 13);
+    EXPECT_TRUE(pDynTexArray->PendingUpdate());
+    pDynTexArray->Update(pDevice, nullptr);
+    EXPECT_FALSE(pDynTexArray->PendingUpdate());
+    EXPECT_EQ(pDynTexArray->GetNumPages(), 4u);
+
+    // Shrinking releases unused pages
+    Version = pDynTexArray->GetVersion();
+    pDynTexArray->Resize(nullptr, nullptr, 5);
+    EXPECT_FALSE(pDynTexArray->PendingUpdate());
+    EXPECT_EQ(pDynTexArray->GetNumPages(), 2u);
+    EXPECT_EQ(pDynTexArray->GetPage(0), pPage0);
+    EXPECT_EQ(pDynTexArray->GetPage(2), nullptr);
+    EXPECT_GT(pDynTexArray->GetVersion(), Version);
+
+    const auto MemUsage = pDynTexArray->GetMemoryUsage();
+    Uint64     PageSize = 0;
+    for (Uint32 mip = 0; mip < pPage0->GetDesc().MipLevels; ++mip)
+        PageSize += GetMipLevelProperties(pPage0->GetDesc(), mip).MipSize * 4;
+    EXPECT_EQ(MemUsage, PageSize * 2);
+
+    pDynTexArray->Resize(nullptr, nullptr, 0);
+    EXPECT_EQ(pDynTexArray->GetNumPages(), 0u);
+    EXPECT_EQ(pDynTexArray->GetTexture(), nullptr);
+}
+
 } // namespace
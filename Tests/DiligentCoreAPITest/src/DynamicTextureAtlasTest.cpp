@@ -166,7 +166,7 @@ TEST(DynamicTextureAtlas, CreateArray)
     }
 }
 
-TEST(DynamicTextureAtlas, Allocate)
+static void TestAllocate(TEXTURE_ATLAS_PACKING_MODE PackingMode)
 {
     auto* const pEnv     = GPUTestingEnvironment::GetInstance();
     auto* const pDevice  = pEnv->GetDevice();
@@ -177,6 +177,7 @@ TEST(DynamicTextureAtlas, Allocate)
     DynamicTextureAtlasCreateInfo CI;
     CI.ExtraSliceCount = 2;
     CI.MinAlignment    = 16;
+    CI.PackingMode     = PackingMode;
     CI.Desc.Format     = TEX_FORMAT_RGBA8_UNORM;
     CI.Desc.Name       = "Dynamic Texture Atlas Test";
     CI.Desc.Type       = RESOURCE_DIM_TEX_2D_ARRAY;
@@ -187,6 +188,7 @@ TEST(DynamicTextureAtlas, Allocate)
 
     RefCntAutoPtr<IDynamicTextureAtlas> pAtlas;
     CreateDynamicTextureAtlas(pDevice, CI, &pAtlas);
+    ASSERT_NE(pAtlas, nullptr);
 
 #ifdef DILIGENT_DEBUG
     constexpr size_t NumIterations = 8;
@@ -256,6 +258,16 @@ TEST(DynamicTextureAtlas, Allocate)
     }
 }
 
+TEST(DynamicTextureAtlas, Allocate)
+{
+    TestAllocate(TEXTURE_ATLAS_PACKING_MODE_GUILLOTINE);
+}
+
+TEST(DynamicTextureAtlas, Allocate_Skyline)
+{
+    TestAllocate(TEXTURE_ATLAS_PACKING_MODE_SKYLINE);
+}
+
 
 // Allocate more regions than the atlas can hold
 TEST(DynamicTextureAtlas, Overflow)
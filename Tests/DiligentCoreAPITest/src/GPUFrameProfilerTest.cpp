@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GPUFrameProfiler.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(GPUFrameProfilerTest, NestedScopes)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetDeviceInfo().Features.TimestampQueries)
+    {
+        GTEST_SKIP() << "Timestamp queries are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    GPUFrameProfilerCreateInfo CI;
+    CI.MaxScopesPerFrame = 2;
+    CI.NumFramesInFlight = 2;
+    CI.NumHistoryFrames  = 2;
+
+    GPUFrameProfiler Profiler{pDevice, CI};
+
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    constexpr Uint32 NumFrames = 4;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        Profiler.BeginFrame(pContext);
+        {
+            GPUFrameProfiler::Scope OuterScope{Profiler, pContext, "Outer"};
+
+            const float   ClearColor[] = {0.25f, 0.5f, 0.75f, 1.0f};
+            ITextureView* pRTVs[]      = {pSwapChain->GetCurrentBackBufferRTV()};
+            {
+                GPUFrameProfiler::Scope InnerScope{Profiler, pContext, "Inner"};
+                pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+            {
+                // Exceeds MaxScopesPerFrame and is not timed
+                GPUFrameProfiler::Scope ExtraScope{Profiler, pContext, "Extra"};
+            }
+        }
+        Profiler.EndFrame(pContext);
+        pContext->WaitForIdle();
+    }
+
+    // Resolves the last frame
+    Profiler.BeginFrame(pContext);
+    Profiler.EndFrame(pContext);
+    pContext->WaitForIdle();
+
+    const GPUFrameProfiler::FrameData* pFrame = Profiler.GetLastResolvedFrame();
+    ASSERT_NE(pFrame, nullptr);
+    EXPECT_EQ(pFrame->FrameNumber, NumFrames - 1);
+    ASSERT_EQ(pFrame->Ranges.size(), size_t{2});
+
+    const GPUFrameProfiler::Range& Outer = pFrame->Ranges[0];
+    const GPUFrameProfiler::Range& Inner = pFrame->Ranges[1];
+    EXPECT_STREQ(Outer.Name, "Outer");
+    EXPECT_STREQ(Inner.Name, "Inner");
+    EXPECT_EQ(Outer.Depth, 0u);
+    EXPECT_EQ(Inner.Depth, 1u);
+    EXPECT_LE(Outer.CPUStart, Inner.CPUStart);
+    EXPECT_GE(Outer.CPUEnd, Inner.CPUEnd);
+    EXPECT_LE(Outer.GPUStart, Inner.GPUStart);
+    EXPECT_GE(Outer.GPUEnd, Inner.GPUEnd);
+    EXPECT_LE(pFrame->GPUStart, Outer.GPUStart);
+
+    std::string Json;
+    Profiler.ExportChromeTrace(Json);
+    EXPECT_NE(Json.find("\"Outer\""), std::string::npos);
+    EXPECT_NE(Json.find("\"Inner\""), std::string::npos);
+    EXPECT_EQ(Json.find("\"Extra\""), std::string::npos);
+}
+
+} // namespace
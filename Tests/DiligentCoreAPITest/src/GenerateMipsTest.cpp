@@ -35,7 +35,7 @@ using namespace Diligent::Testing;
 namespace
 {
 
-TEST(GenerateMipsTest, GenerateMips)
+void TestGenerateMips(GENERATE_MIPS_FLAGS Flags)
 {
     GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
 
@@ -83,7 +83,7 @@ TEST(GenerateMipsTest, GenerateMips)
             pDevice->CreateTexture(TexDesc, &InitData, &pTex);
             ASSERT_NE(pTex, nullptr) << "Failed to create texture: " << TexDesc;
 
-            pContext->GenerateMips(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+            pContext->GenerateMips(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE), Flags);
 
             TextureViewDesc ViewDesc{nullptr, TEXTURE_VIEW_SHADER_RESOURCE, RESOURCE_DIM_TEX_2D_ARRAY};
             ViewDesc.MostDetailedMip = 1;
@@ -92,7 +92,7 @@ TEST(GenerateMipsTest, GenerateMips)
             RefCntAutoPtr<ITextureView> pTexView;
             pTex->CreateView(ViewDesc, &pTexView);
             ASSERT_NE(pTexView, nullptr) << "Failed to create SRV for texture: " << TexDesc;
-            pContext->GenerateMips(pTexView);
+            pContext->GenerateMips(pTexView, Flags);
         }
 
         TexDesc.Name      = "Mips generation test texture array";
@@ -128,11 +128,21 @@ TEST(GenerateMipsTest, GenerateMips)
             RefCntAutoPtr<ITextureView> pTexView;
             pTex->CreateView(ViewDesc, &pTexView);
             ASSERT_NE(pTexView, nullptr) << "Failed to create SRV for texture array: " << TexDesc;
-            pContext->GenerateMips(pTexView);
+            pContext->GenerateMips(pTexView, Flags);
 
-            pContext->GenerateMips(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+            pContext->GenerateMips(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE), Flags);
         }
     }
 }
 
+TEST(GenerateMipsTest, GenerateMips)
+{
+    TestGenerateMips(GENERATE_MIPS_FLAG_NONE);
+}
+
+TEST(GenerateMipsTest, GenerateMipsSinglePass)
+{
+    TestGenerateMips(GENERATE_MIPS_FLAG_SINGLE_PASS);
+}
+
 } // namespace
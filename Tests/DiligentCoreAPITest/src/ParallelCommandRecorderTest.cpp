@@ -0,0 +1,200 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#include "ParallelCommandRecorder.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(ParallelCommandRecorderTest, BatchOrder)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{3});
+
+    ParallelCommandRecorder Recorder{{pEnv->GetDevice(), pEnv->GetDeviceContext(), pThreadPool, 4}};
+
+    constexpr Uint32 NumBatches = 37;
+
+    std::vector<IDeviceContext*> BatchContexts(NumBatches);
+    std::vector<std::atomic<Uint32>> BatchCounts(NumBatches);
+    for (std::atomic<Uint32>& Count : BatchCounts)
+        Count.store(0);
+
+    ParallelCommandRecorder::RecordAttribs Attribs;
+    Attribs.NumBatches  = NumBatches;
+    Attribs.RecordBatch = [&](IDeviceContext* pCtx, Uint32 Batch) {
+        BatchContexts[Batch] = pCtx;
+        BatchCounts[Batch].fetch_add(1);
+    };
+    Recorder.Record(Attribs);
+
+    const ParallelCommandRecorder::Statistics& Stats = Recorder.GetStatistics();
+    EXPECT_EQ(Stats.NumContextsUsed, Recorder.IsParallel() ? 4u : 1u);
+    EXPECT_EQ(Stats.NumBatchesRecorded, NumBatches);
+
+    // Every batch is recorded once, and every context records a contiguous range of batches
+    Uint32 NumRanges = 1;
+    for (Uint32 i = 0; i < NumBatches; ++i)
+    {
+        EXPECT_EQ(BatchCounts[i].load(), 1u) << "Batch " << i;
+        if (i > 0 && BatchContexts[i] != BatchContexts[i - 1])
+            ++NumRanges;
+    }
+    EXPECT_EQ(NumRanges, Stats.NumContextsUsed);
+
+    // Small amounts of work use fewer contexts
+    Attribs.MinBatchesPerContext = 16;
+    Recorder.Record(Attribs);
+    EXPECT_EQ(Recorder.GetStatistics().NumContextsUsed, Recorder.IsParallel() ? 3u : 1u);
+}
+
+// Records the same amount of draw commands with 1 to 16 threads and reports the recording time
+TEST(ParallelCommandRecorderTest, Scaling)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    if (pDevice->GetDeviceInfo().IsGLDevice() || pDevice->GetDeviceInfo().IsWebGPUDevice())
+    {
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    {
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+        PipelineStateDesc&    PSODesc          = PSOCreateInfo.PSODesc;
+        GraphicsPipelineDesc& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+        PSODesc.Name = "Parallel command recorder test";
+
+        GraphicsPipeline.NumRenderTargets             = 1;
+        GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+        GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.EntryPoint     = "main";
+
+        RefCntAutoPtr<IShader> pVS;
+        ShaderCI.Desc   = {"Parallel command recorder test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+
+        RefCntAutoPtr<IShader> pPS;
+        ShaderCI.Desc   = {"Parallel command recorder test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = HLSL::DrawTest_PS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+
+        PSOCreateInfo.pVS = pVS;
+        PSOCreateInfo.pPS = pPS;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+    }
+
+    constexpr Uint32 MaxThreads     = 16;
+    constexpr Uint32 NumBatches     = 1024;
+    constexpr Uint32 DrawsPerBatch  = 32;
+    constexpr Uint32 NumIterations  = 4;
+    ITextureView*    pRTVs[]        = {pSwapChain->GetCurrentBackBufferRTV()};
+    const float      ClearColor[4]  = {};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    ParallelCommandRecorder::RecordAttribs Attribs;
+    Attribs.NumBatches       = NumBatches;
+    Attribs.NumRenderTargets = 1;
+    Attribs.ppRenderTargets  = pRTVs;
+    Attribs.BeginContext     = [&](IDeviceContext* pCtx) {
+        pCtx->SetPipelineState(pPSO);
+    };
+    Attribs.RecordBatch = [&](IDeviceContext* pCtx, Uint32 Batch) {
+        for (Uint32 i = 0; i < DrawsPerBatch; ++i)
+            pCtx->Draw({3, DRAW_FLAG_VERIFY_ALL});
+    };
+
+    double SingleThreadTime = 0;
+    for (Uint32 NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+    {
+        // The calling thread participates in recording
+        RefCntAutoPtr<IThreadPool> pThreadPool;
+        if (NumThreads > 1)
+            pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads - 1});
+
+        ParallelCommandRecorder Recorder{{pDevice, pContext, pThreadPool, NumThreads}};
+        ASSERT_EQ(Recorder.GetNumContexts(), NumThreads);
+
+        // Warm up
+        Recorder.Record(Attribs);
+
+        Timer        T;
+        const double StartTime = T.GetElapsedTime();
+        for (Uint32 i = 0; i < NumIterations; ++i)
+            Recorder.Record(Attribs);
+        const double Time = (T.GetElapsedTime() - StartTime) / NumIterations;
+
+        EXPECT_EQ(Recorder.GetStatistics().NumContextsUsed, NumThreads);
+
+        if (NumThreads == 1)
+            SingleThreadTime = Time;
+        LOG_INFO_MESSAGE("Parallel command recording: ", NumThreads, (NumThreads > 1 ? " threads: " : " thread:  "),
+                         Time * 1000, " ms (", SingleThreadTime / std::max(Time, 1e-9), "x)");
+
+        pContext->Flush();
+        pContext->FinishFrame();
+    }
+
+    pContext->WaitForIdle();
+}
+
+} // namespace
@@ -2031,4 +2031,63 @@ TEST_F(PipelineResourceSignatureTest, UnusedNullResources)
     pSwapChain->Present();
 }
 
+TEST_F(PipelineResourceSignatureTest, SetVariables)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "SetVariables test";
+
+    // clang-format off
+    PipelineResourceDesc Resources[]
+    {
+        {SHADER_TYPE_VERTEX, "cbMutable", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VERTEX, "cbDynamic", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_PIXEL,  "cbArray",   3, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+    };
+    // clang-format on
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    RefCntAutoPtr<IBuffer> pBuffer[3];
+    for (auto& pBuff : pBuffer)
+    {
+        pBuff = pEnv->CreateBuffer({"SetVariables test buffer", 256, BIND_UNIFORM_BUFFER});
+        ASSERT_TRUE(pBuff);
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_TRUE(pSRB);
+
+    IShaderResourceVariable* pDynamicVar = pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbDynamic");
+    ASSERT_NE(pDynamicVar, nullptr);
+
+    IDeviceObject* ppArray[] = {pBuffer[0], pBuffer[1]};
+    IDeviceObject* pBuff2    = pBuffer[2];
+
+    const ShaderResourceVariableUpdate Updates[] = {
+        {SHADER_TYPE_VERTEX, "cbMutable", &pBuff2},
+        {SHADER_TYPE_VERTEX, pDynamicVar->GetIndex(), &pBuff2},
+        {SHADER_TYPE_PIXEL, "cbArray", ppArray, 1, 2},
+    };
+    pSRB->SetVariables(Updates, _countof(Updates));
+
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbMutable")->Get(), pBuffer[2]);
+    EXPECT_EQ(pDynamicVar->Get(), pBuffer[2]);
+
+    IShaderResourceVariable* pArrayVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbArray");
+    ASSERT_NE(pArrayVar, nullptr);
+    EXPECT_EQ(pArrayVar->Get(0), nullptr);
+    EXPECT_EQ(pArrayVar->Get(1), pBuffer[0]);
+    EXPECT_EQ(pArrayVar->Get(2), pBuffer[1]);
+}
+
 } // namespace Diligent
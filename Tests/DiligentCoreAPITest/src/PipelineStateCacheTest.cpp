@@ -0,0 +1,170 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const std::string PSOCacheTest_CS{R"(
+RWBuffer<uint> g_Output;
+
+[numthreads(64, 1, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    g_Output[DTid.x] = DTid.x;
+}
+)"};
+
+RefCntAutoPtr<IPipelineState> CreatePSO(IShader* pCS, IPipelineStateCache* pPSOCache)
+{
+    IRenderDevice* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name = "PSO cache test - compute PSO";
+    PSOCreateInfo.pCS          = pCS;
+    PSOCreateInfo.pPSOCache    = pPSOCache;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    return pPSO;
+}
+
+TEST(PipelineStateCacheTest, SaveLoad)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    PipelineStateCacheCreateInfo PSOCacheCI;
+    PSOCacheCI.Desc.Name  = "PSO cache test";
+    PSOCacheCI.Desc.Flags = PSO_CACHE_FLAG_VERBOSE;
+
+    RefCntAutoPtr<IPipelineStateCache> pPSOCache;
+    pDevice->CreatePipelineStateCache(PSOCacheCI, &pPSOCache);
+    if (!pPSOCache)
+        GTEST_SKIP() << "Pipeline state cache is not supported by this device";
+
+    RefCntAutoPtr<IShader> pCS;
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.CompileFlags   = SHADER_COMPILE_FLAG_HLSL_TO_SPIRV_VIA_GLSL;
+        ShaderCI.Desc           = {"PSO cache test - CS", SHADER_TYPE_COMPUTE, true};
+        ShaderCI.EntryPoint     = "main";
+        ShaderCI.Source         = PSOCacheTest_CS.c_str();
+        pDevice->CreateShader(ShaderCI, &pCS);
+        ASSERT_NE(pCS, nullptr);
+    }
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreatePSO(pCS, pPSOCache);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pCacheData;
+    pPSOCache->GetData(&pCacheData);
+    if (!pCacheData)
+        GTEST_SKIP() << "Pipeline state cache serialization is not supported by this device";
+    EXPECT_NE(pCacheData->GetSize(), 0u);
+
+    // Create the cache from the serialized data, and make sure the pipeline can be created from it
+    PSOCacheCI.pCacheData    = pCacheData->GetConstDataPtr();
+    PSOCacheCI.CacheDataSize = StaticCast<Uint32>(pCacheData->GetSize());
+
+    RefCntAutoPtr<IPipelineStateCache> pPSOCache2;
+    pDevice->CreatePipelineStateCache(PSOCacheCI, &pPSOCache2);
+    ASSERT_NE(pPSOCache2, nullptr);
+
+    // The cache must not depend on the data it was created from
+    pCacheData.Release();
+
+    RefCntAutoPtr<IPipelineState> pPSO2 = CreatePSO(pCS, pPSOCache2);
+    EXPECT_NE(pPSO2, nullptr);
+
+    // Corrupted data must be ignored
+    std::vector<Uint8> InvalidData(256, 0xCD);
+    PSOCacheCI.Desc.Flags    = PSO_CACHE_FLAG_NONE;
+    PSOCacheCI.pCacheData    = InvalidData.data();
+    PSOCacheCI.CacheDataSize = static_cast<Uint32>(InvalidData.size());
+
+    RefCntAutoPtr<IPipelineStateCache> pPSOCache3;
+    pDevice->CreatePipelineStateCache(PSOCacheCI, &pPSOCache3);
+    ASSERT_NE(pPSOCache3, nullptr);
+
+    RefCntAutoPtr<IPipelineState> pPSO3 = CreatePSO(pCS, pPSOCache3);
+    EXPECT_NE(pPSO3, nullptr);
+}
+
+TEST(PipelineStateCacheTest, CompileStats)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    RefCntAutoPtr<IShader> pCS;
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.CompileFlags   = SHADER_COMPILE_FLAG_HLSL_TO_SPIRV_VIA_GLSL;
+        ShaderCI.Desc           = {"PSO compile stats test - CS", SHADER_TYPE_COMPUTE, true};
+        ShaderCI.EntryPoint     = "main";
+        ShaderCI.Source         = PSOCacheTest_CS.c_str();
+        pDevice->CreateShader(ShaderCI, &pCS);
+        ASSERT_NE(pCS, nullptr);
+    }
+
+    DevicePipelineCompileStats DeviceStats0;
+    pDevice->GetPipelineCompileStats(DeviceStats0);
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreatePSO(pCS, nullptr);
+    ASSERT_NE(pPSO, nullptr);
+
+    const PipelineStateCompileStats& Stats = pPSO->GetCompileStats();
+    EXPECT_NE(Stats.CacheStatus, PIPELINE_CACHE_STATUS_HIT);
+    EXPECT_TRUE(Stats.NumStages == 0 || Stats.pStages != nullptr);
+    for (Uint32 i = 0; i < Stats.NumStages; ++i)
+        EXPECT_EQ(Stats.pStages[i].ShaderType, SHADER_TYPE_COMPUTE);
+
+    DevicePipelineCompileStats DeviceStats1;
+    pDevice->GetPipelineCompileStats(DeviceStats1);
+    EXPECT_EQ(DeviceStats1.NumPipelines, DeviceStats0.NumPipelines + 1);
+    EXPECT_EQ(DeviceStats1.TotalDuration, DeviceStats0.TotalDuration + Stats.Duration);
+    EXPECT_GE(DeviceStats1.MaxDuration, Stats.Duration);
+}
+
+} // namespace
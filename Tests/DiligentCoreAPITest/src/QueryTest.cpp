@@ -457,6 +457,69 @@ TEST_F(QueryTest, Timestamp)
 }
 
 
+TEST_F(QueryTest, PoolTimestamps)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    const auto& DeviceInfo = pDevice->GetDeviceInfo();
+    if (DeviceInfo.Type != RENDER_DEVICE_TYPE_D3D12 && !DeviceInfo.IsVulkanDevice())
+    {
+        GTEST_SKIP() << "Query pools are only supported in Direct3D12 and Vulkan";
+    }
+    if (!DeviceInfo.Features.TimestampQueries)
+    {
+        GTEST_SKIP() << "Timestamp queries are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumQueries = 8;
+
+    QueryPoolDesc PoolDesc{QUERY_TYPE_TIMESTAMP, NumQueries};
+    PoolDesc.Name = "Timestamp query pool";
+
+    RefCntAutoPtr<IQueryPool> pQueryPool;
+    pDevice->CreateQueryPool(PoolDesc, &pQueryPool);
+    ASSERT_NE(pQueryPool, nullptr) << "Failed to create timestamp query pool";
+    EXPECT_EQ(pQueryPool->GetDesc().QueryCount, NumQueries);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Query pool readback buffer";
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    BuffDesc.Size           = sizeof(Uint64) * NumQueries;
+
+    RefCntAutoPtr<IBuffer> pReadbackBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pReadbackBuffer);
+    ASSERT_NE(pReadbackBuffer, nullptr) << "Buffer desc:\n"
+                                        << BuffDesc;
+
+    auto* pContext = pEnv->GetDeviceContext();
+    for (Uint32 frame = 0; frame < sm_NumFrames; ++frame)
+    {
+        for (Uint32 i = 0; i < NumQueries; ++i)
+        {
+            pContext->EndPoolQuery(pQueryPool, i);
+            DrawQuad(pContext);
+        }
+
+        pContext->ResolvePoolQueries({pQueryPool, 0, NumQueries, pReadbackBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION});
+        pContext->WaitForIdle();
+
+        void* pData = nullptr;
+        pContext->MapBuffer(pReadbackBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        ASSERT_NE(pData, nullptr);
+        const Uint64* Timestamps = static_cast<const Uint64*>(pData);
+        for (Uint32 i = 1; i < NumQueries; ++i)
+        {
+            EXPECT_GE(Timestamps[i], Timestamps[i - 1]) << "Frame " << frame << ", query " << i;
+        }
+        pContext->UnmapBuffer(pReadbackBuffer, MAP_READ);
+    }
+}
+
+
 TEST_F(QueryTest, Duration)
 {
     const auto& DeviceInfo = GPUTestingEnvironment::GetInstance()->GetDevice()->GetDeviceInfo();
@@ -0,0 +1,129 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "QueueScheduler.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 TestData[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+TEST(QueueSchedulerTest, CrossQueueDependencies)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    if (pEnv->GetNumImmediateContexts() < 2)
+    {
+        GTEST_SKIP() << "At least two immediate contexts are required";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    IDeviceContext* Contexts[] = {pEnv->GetDeviceContext(0), pEnv->GetDeviceContext(1)};
+
+    const Uint64 QueueMask = (Uint64{1} << Contexts[0]->GetDesc().ContextId) | (Uint64{1} << Contexts[1]->GetDesc().ContextId);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name                 = "Queue scheduler test buffer";
+    BuffDesc.Size                 = sizeof(TestData);
+    BuffDesc.BindFlags            = BIND_SHADER_RESOURCE;
+    BuffDesc.Mode                 = BUFFER_MODE_RAW;
+    BuffDesc.Usage                = USAGE_DEFAULT;
+    BuffDesc.ImmediateContextMask = QueueMask;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    BuffDesc.Name                 = "Queue scheduler test staging buffer";
+    BuffDesc.BindFlags            = BIND_NONE;
+    BuffDesc.Mode                 = BUFFER_MODE_UNDEFINED;
+    BuffDesc.Usage                = USAGE_STAGING;
+    BuffDesc.CPUAccessFlags       = CPU_ACCESS_READ;
+    BuffDesc.ImmediateContextMask = Uint64{1} << Contexts[0]->GetDesc().ContextId;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    QueueScheduler Scheduler{pDevice, Contexts, _countof(Contexts)};
+
+    // Context 1 writes the buffer, context 0 copies it to the staging buffer.
+    // The dependency between the contexts is added automatically.
+    const QueueScheduler::WorkId Update = Scheduler.AddWork(
+        {"Update", 1, {}, {{pBuffer, RESOURCE_STATE_COPY_DEST, true}}},
+        [&](IDeviceContext* pCtx) {
+            pCtx->UpdateBuffer(pBuffer, 0, sizeof(TestData), TestData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        });
+    ASSERT_NE(Update, QueueScheduler::InvalidWorkId);
+
+    const QueueScheduler::WorkId Copy = Scheduler.AddWork(
+        {"Copy", 0, {}, {{pBuffer, RESOURCE_STATE_COPY_SOURCE}}},
+        [&](IDeviceContext* pCtx) {
+            pCtx->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_VERIFY,
+                             pStagingBuffer, 0, sizeof(TestData), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        });
+    ASSERT_NE(Copy, QueueScheduler::InvalidWorkId);
+
+    // The explicit dependency is already satisfied by the implicit one and must not add another wait
+    Scheduler.AddWork({"Explicit dependency", 0, {Update}, {}}, nullptr);
+
+    Scheduler.Execute();
+
+    const QueueScheduler::Statistics& Stats = Scheduler.GetStatistics();
+    EXPECT_EQ(Stats.NumImplicitDependencies, 1u);
+    EXPECT_EQ(Stats.NumFenceWaits, 1u);
+    EXPECT_EQ(Stats.NumTransitions, 2u);
+
+    Contexts[0]->WaitForIdle();
+    Contexts[1]->WaitForIdle();
+
+    void* pData = nullptr;
+    Contexts[0]->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    EXPECT_EQ(memcmp(pData, TestData, sizeof(TestData)), 0);
+    Contexts[0]->UnmapBuffer(pStagingBuffer, MAP_READ);
+
+    // The next batch reads the buffer in context 1 in the same state: no waits are needed
+    // as the GPU has completed the previous batch.
+    Scheduler.AddWork({"Read", 1, {}, {{pBuffer, RESOURCE_STATE_COPY_SOURCE}}}, nullptr);
+    Scheduler.Execute();
+    EXPECT_EQ(Scheduler.GetStatistics().NumFenceWaits, 1u);
+
+    Contexts[1]->WaitForIdle();
+}
+
+} // namespace
@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <random>
 #include <unordered_map>
+#include <string>
+#include <vector>
 
 #include "GPUTestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
@@ -1563,6 +1565,137 @@ TEST(RayTracingTest, ResourceBinding)
 }
 
 
+TEST(RayTracingTest, TLASInstanceUploadModes)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pEnv->SupportsRayTracing())
+    {
+        GTEST_SKIP() << "Ray tracing is not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReleaseResources EnvironmentAutoReset;
+
+    const auto& Vertices = TestingConstants::TriangleClosestHit::Vertices;
+
+    RefCntAutoPtr<IBuffer> pVertexBuffer;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Triangle vertices";
+        BuffDesc.BindFlags = BIND_RAY_TRACING;
+        BuffDesc.Size      = sizeof(Vertices);
+
+        BufferData InitData{Vertices, sizeof(Vertices)};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pVertexBuffer);
+        ASSERT_NE(pVertexBuffer, nullptr);
+    }
+
+    BLASBuildTriangleData Triangle;
+    Triangle.GeometryName         = "Triangle";
+    Triangle.pVertexBuffer        = pVertexBuffer;
+    Triangle.VertexStride         = sizeof(Vertices[0]);
+    Triangle.VertexCount          = _countof(Vertices);
+    Triangle.VertexValueType      = VT_FLOAT32;
+    Triangle.VertexComponentCount = 3;
+    Triangle.Flags                = RAYTRACING_GEOMETRY_FLAG_OPAQUE;
+
+    RefCntAutoPtr<IBottomLevelAS> pBLAS;
+    CreateBLAS(pDevice, pContext, &Triangle, 1, RAYTRACING_BUILD_AS_NONE, pBLAS);
+    ASSERT_NE(pBLAS, nullptr);
+
+    constexpr Uint32 InstanceCount = 16;
+
+    std::vector<std::string>           InstanceNames(InstanceCount);
+    std::vector<TLASBuildInstanceData> Instances(InstanceCount);
+    for (Uint32 i = 0; i < InstanceCount; ++i)
+    {
+        InstanceNames[i]          = "Instance " + std::to_string(i);
+        Instances[i].InstanceName = InstanceNames[i].c_str();
+        Instances[i].pBLAS        = pBLAS;
+        Instances[i].CustomId     = i;
+        Instances[i].Transform.SetTranslation(static_cast<float>(i), 0, 0);
+    }
+
+    TopLevelASDesc TLASDesc;
+    TLASDesc.Name             = "TLAS";
+    TLASDesc.MaxInstanceCount = InstanceCount;
+    TLASDesc.Flags            = RAYTRACING_BUILD_AS_ALLOW_UPDATE;
+
+    RefCntAutoPtr<ITopLevelAS> pTLAS;
+    pDevice->CreateTLAS(TLASDesc, &pTLAS);
+    ASSERT_NE(pTLAS, nullptr);
+
+    RefCntAutoPtr<IBuffer> pScratchBuffer;
+    RefCntAutoPtr<IBuffer> pInstanceBuffer;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "TLAS Scratch Buffer";
+        BuffDesc.BindFlags = BIND_RAY_TRACING;
+        BuffDesc.Size      = std::max(pTLAS->GetScratchBufferSizes().Build, pTLAS->GetScratchBufferSizes().Update);
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pScratchBuffer);
+        ASSERT_NE(pScratchBuffer, nullptr);
+
+        BuffDesc.Name = "TLAS Instance Buffer";
+        BuffDesc.Size = TLAS_INSTANCE_DATA_SIZE * InstanceCount;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pInstanceBuffer);
+        ASSERT_NE(pInstanceBuffer, nullptr);
+    }
+
+    BuildTLASAttribs Attribs;
+    Attribs.pTLAS                        = pTLAS;
+    Attribs.pInstances                   = Instances.data();
+    Attribs.InstanceCount                = InstanceCount;
+    Attribs.HitGroupStride               = 1;
+    Attribs.BindingMode                  = HIT_GROUP_BINDING_MODE_PER_INSTANCE;
+    Attribs.TLASTransitionMode           = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    Attribs.BLASTransitionMode           = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    Attribs.pInstanceBuffer              = pInstanceBuffer;
+    Attribs.InstanceBufferTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    Attribs.pScratchBuffer               = pScratchBuffer;
+    Attribs.ScratchBufferTransitionMode  = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    pContext->BuildTLAS(Attribs);
+
+    std::vector<TLASInstanceDesc> InitialDescs(InstanceCount);
+    for (Uint32 i = 0; i < InstanceCount; ++i)
+    {
+        InitialDescs[i] = pTLAS->GetInstanceDesc(InstanceNames[i].c_str());
+        ASSERT_NE(InitialDescs[i].InstanceIndex, INVALID_INDEX);
+    }
+
+    // Update a few instances, including two contiguous ones, in reverse order
+    const TLASBuildInstanceData DirtyInstances[] = {Instances[9], Instances[3], Instances[2]};
+
+    Attribs.InstanceUploadMode = TLAS_INSTANCE_UPLOAD_MODE_DIRTY;
+    Attribs.pInstances         = DirtyInstances;
+    Attribs.DirtyInstanceCount = _countof(DirtyInstances);
+    Attribs.Update             = true;
+    pContext->BuildTLAS(Attribs);
+
+    // The same update, but with the threshold that forces the TLAS to be rebuilt
+    Attribs.RebuildThreshold = 0.1f;
+    pContext->BuildTLAS(Attribs);
+
+    // Instance data written by the GPU
+    Attribs.InstanceUploadMode = TLAS_INSTANCE_UPLOAD_MODE_GPU;
+    Attribs.pInstances         = nullptr;
+    Attribs.DirtyInstanceCount = 0;
+    pContext->BuildTLAS(Attribs);
+
+    for (Uint32 i = 0; i < InstanceCount; ++i)
+    {
+        const TLASInstanceDesc Desc = pTLAS->GetInstanceDesc(InstanceNames[i].c_str());
+        EXPECT_EQ(Desc.InstanceIndex, InitialDescs[i].InstanceIndex);
+        EXPECT_EQ(Desc.ContributionToHitGroupIndex, InitialDescs[i].ContributionToHitGroupIndex);
+        EXPECT_EQ(Desc.pBLAS, pBLAS);
+    }
+    EXPECT_EQ(pTLAS->GetBuildInfo().InstanceCount, InstanceCount);
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+}
+
+
 class RT5 : public testing::TestWithParam<int>
 {};
 
@@ -0,0 +1,195 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ReadbackQueue.hpp"
+#include "ThreadPool.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include <atomic>
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr float TestData[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+RefCntAutoPtr<IBuffer> CreateTestBuffer(IRenderDevice* pDevice)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Readback queue test buffer";
+    BuffDesc.Size      = sizeof(TestData);
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+
+    BufferData InitData{TestData, sizeof(TestData)};
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, &InitData, &pBuffer);
+    return pBuffer;
+}
+
+TEST(ReadbackQueueTest, Buffer)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateTestBuffer(pDevice);
+    ASSERT_NE(pBuffer, nullptr);
+
+    ReadbackQueueCreateInfo CI;
+    CI.NumFramesInFlight = 2;
+
+    ReadbackQueue Readbacks{pDevice, CI};
+
+    constexpr Uint32 NumFrames = 3;
+    constexpr Uint32 Offset    = 4 * sizeof(float);
+    constexpr Uint32 Size      = 8 * sizeof(float);
+
+    Uint32 NumCompleted = 0;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        EXPECT_TRUE(Readbacks.ReadBuffer(pContext, pBuffer, Offset, Size,
+                                         [&](const ReadbackQueue::ReadbackData& Data) {
+                                             ASSERT_NE(Data.pData, nullptr);
+                                             EXPECT_EQ(Data.DataSize, Size);
+                                             EXPECT_EQ(memcmp(Data.pData, &TestData[4], Size), 0);
+                                             ++NumCompleted;
+                                         }));
+        EXPECT_EQ(Readbacks.GetNumPendingReadbacks(), 1u);
+
+        pContext->WaitForIdle();
+        Readbacks.Poll(pContext);
+        EXPECT_EQ(NumCompleted, frame + 1);
+        EXPECT_EQ(Readbacks.GetNumPendingReadbacks(), 0u);
+    }
+}
+
+TEST(ReadbackQueueTest, Texture)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 Width  = 16;
+    constexpr Uint32 Height = 8;
+
+    std::vector<Uint32> TexData(Width * Height);
+    for (Uint32 i = 0; i < TexData.size(); ++i)
+        TexData[i] = i * 0x01020304u;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Readback queue test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = Width;
+    TexDesc.Height    = Height;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Usage     = USAGE_DEFAULT;
+
+    TextureSubResData SubresData{TexData.data(), Width * sizeof(Uint32)};
+    TextureData       InitData{&SubresData, 1};
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, &InitData, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+
+    ReadbackQueue Readbacks{pDevice};
+
+    const Box Region{4, 12, 2, 6};
+
+    bool Completed = false;
+    EXPECT_TRUE(Readbacks.ReadTexture(pContext, pTexture, 0, 0, &Region,
+                                      [&](const ReadbackQueue::ReadbackData& Data) {
+                                          ASSERT_NE(Data.pData, nullptr);
+                                          EXPECT_EQ(Data.Width, Region.Width());
+                                          EXPECT_EQ(Data.Height, Region.Height());
+                                          EXPECT_EQ(Data.Format, TEX_FORMAT_RGBA8_UNORM);
+                                          for (Uint32 y = 0; y < Data.Height; ++y)
+                                          {
+                                              const Uint8* pRow = static_cast<const Uint8*>(Data.pData) + y * Data.Stride;
+                                              EXPECT_EQ(memcmp(pRow, &TexData[(Region.MinY + y) * Width + Region.MinX], Data.Width * sizeof(Uint32)), 0);
+                                          }
+                                          Completed = true;
+                                      }));
+
+    pContext->WaitForIdle();
+    Readbacks.Poll(pContext);
+    EXPECT_TRUE(Completed);
+}
+
+TEST(ReadbackQueueTest, ThreadPool)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateTestBuffer(pDevice);
+    ASSERT_NE(pBuffer, nullptr);
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    ReadbackQueueCreateInfo CI;
+    CI.pThreadPool = pThreadPool;
+
+    ReadbackQueue Readbacks{pDevice, CI};
+
+    constexpr Uint32 NumReadbacks = 4;
+
+    std::atomic<Uint32> NumCompleted{0};
+    for (Uint32 i = 0; i < NumReadbacks; ++i)
+    {
+        EXPECT_TRUE(Readbacks.ReadBuffer(pContext, pBuffer, 0, sizeof(TestData),
+                                         [&NumCompleted](const ReadbackQueue::ReadbackData& Data) {
+                                             EXPECT_NE(Data.pData, nullptr);
+                                             if (Data.pData != nullptr)
+                                                 EXPECT_EQ(memcmp(Data.pData, TestData, sizeof(TestData)), 0);
+                                             NumCompleted.fetch_add(1);
+                                         }));
+    }
+
+    pContext->WaitForIdle();
+    Readbacks.Poll(pContext);
+    EXPECT_EQ(Readbacks.GetNumPendingReadbacks(), 0u);
+
+    Readbacks.WaitForCallbacks(pContext);
+    EXPECT_EQ(NumCompleted.load(), NumReadbacks);
+}
+
+} // namespace
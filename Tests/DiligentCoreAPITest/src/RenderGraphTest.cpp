@@ -0,0 +1,217 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+
+#include "RenderGraph.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TextureDesc GetTestTextureDesc(const char* Name)
+{
+    TextureDesc TexDesc;
+    TexDesc.Name      = Name;
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 256;
+    TexDesc.Height    = 256;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.MipLevels = 1;
+    TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+    return TexDesc;
+}
+
+TEST(RenderGraphTest, PassCulling)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<ITexture> pOutput = pEnv->CreateTexture("Render graph test output", TEX_FORMAT_RGBA8_UNORM,
+                                                          BIND_RENDER_TARGET | BIND_SHADER_RESOURCE, 256, 256);
+    ASSERT_NE(pOutput, nullptr);
+
+    RenderGraph Graph{pDevice};
+
+    const RenderGraph::ResourceId Output = Graph.ImportTexture(pOutput, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE);
+    const RenderGraph::ResourceId Used   = Graph.CreateTexture(GetTestTextureDesc("Used transient texture"));
+    const RenderGraph::ResourceId Unused = Graph.CreateTexture(GetTestTextureDesc("Unused transient texture"));
+
+    Uint32 NumExecuted[4] = {};
+
+    Graph.AddPass(
+        "Write used",
+        [&](RenderGraph::PassBuilder& Builder) {
+            Builder.Write(Used, RESOURCE_STATE_RENDER_TARGET);
+        },
+        [&](IDeviceContext*, const RenderGraph& G) {
+            EXPECT_NE(G.GetTexture(Used), nullptr);
+            EXPECT_EQ(G.GetTexture(Used)->GetState(), RESOURCE_STATE_RENDER_TARGET);
+            ++NumExecuted[0];
+        });
+
+    Graph.AddPass(
+        "Write unused",
+        [&](RenderGraph::PassBuilder& Builder) {
+            Builder.Read(Used, RESOURCE_STATE_SHADER_RESOURCE);
+            Builder.Write(Unused, RESOURCE_STATE_RENDER_TARGET);
+        },
+        [&](IDeviceContext*, const RenderGraph&) {
+            ++NumExecuted[1];
+        });
+
+    Graph.AddPass(
+        "Write output",
+        [&](RenderGraph::PassBuilder& Builder) {
+            Builder.Read(Used, RESOURCE_STATE_SHADER_RESOURCE);
+            Builder.Write(Output, RESOURCE_STATE_RENDER_TARGET);
+        },
+        [&](IDeviceContext*, const RenderGraph& G) {
+            EXPECT_EQ(G.GetTexture(Used)->GetState(), RESOURCE_STATE_SHADER_RESOURCE);
+            EXPECT_EQ(G.GetTexture(Output)->GetState(), RESOURCE_STATE_RENDER_TARGET);
+            ++NumExecuted[2];
+        });
+
+    Graph.AddPass(
+        "Side effects",
+        [&](RenderGraph::PassBuilder& Builder) {
+            Builder.SetSideEffects();
+        },
+        [&](IDeviceContext*, const RenderGraph&) {
+            ++NumExecuted[3];
+        });
+
+    Graph.Execute(pContext);
+
+    EXPECT_FALSE(Graph.IsPassCulled(0));
+    EXPECT_TRUE(Graph.IsPassCulled(1));
+    EXPECT_FALSE(Graph.IsPassCulled(2));
+    EXPECT_FALSE(Graph.IsPassCulled(3));
+    EXPECT_EQ(NumExecuted[0], 1u);
+    EXPECT_EQ(NumExecuted[1], 0u);
+    EXPECT_EQ(NumExecuted[2], 1u);
+    EXPECT_EQ(NumExecuted[3], 1u);
+    EXPECT_EQ(pOutput->GetState(), RESOURCE_STATE_SHADER_RESOURCE);
+
+    const RenderGraph::Statistics& Stats = Graph.GetStatistics();
+    EXPECT_EQ(Stats.NumPasses, 4u);
+    EXPECT_EQ(Stats.NumCulledPasses, 1u);
+    EXPECT_EQ(Stats.NumTransientResources, 1u);
+    EXPECT_EQ(Stats.NumPhysicalResources, 1u);
+    // Used -> RT, Used -> SRV and Output -> RT, Output -> SRV
+    EXPECT_EQ(Stats.NumBarrierBatches, 3u);
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+}
+
+TEST(RenderGraphTest, TransientResourceAliasing)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<ITexture> pOutput = pEnv->CreateTexture("Render graph test output", TEX_FORMAT_RGBA8_UNORM,
+                                                          BIND_RENDER_TARGET | BIND_SHADER_RESOURCE, 256, 256);
+    ASSERT_NE(pOutput, nullptr);
+
+    for (bool EnableMemoryAliasing : {false, true})
+    {
+        RenderGraphCreateInfo CI;
+        CI.EnableMemoryAliasing = EnableMemoryAliasing;
+
+        RenderGraph Graph{pDevice, CI};
+
+        constexpr Uint32 NumTransients = 4;
+
+        ITexture* pTextures[2][NumTransients] = {};
+        for (Uint32 Frame = 0; Frame < 2; ++Frame)
+        {
+            Graph.Reset();
+
+            const RenderGraph::ResourceId Output = Graph.ImportTexture(pOutput, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE);
+
+            // A chain of passes where every pass reads the result of the previous one,
+            // so that only two transient textures are alive at any time.
+            RenderGraph::ResourceId Transients[NumTransients] = {};
+            for (Uint32 i = 0; i < NumTransients; ++i)
+                Transients[i] = Graph.CreateTexture(GetTestTextureDesc("Render graph transient texture"));
+
+            for (Uint32 i = 0; i <= NumTransients; ++i)
+            {
+                Graph.AddPass(
+                    "Chain pass",
+                    [&, i](RenderGraph::PassBuilder& Builder) {
+                        if (i > 0)
+                            Builder.Read(Transients[i - 1], RESOURCE_STATE_SHADER_RESOURCE);
+                        Builder.Write(i < NumTransients ? Transients[i] : Output, RESOURCE_STATE_RENDER_TARGET);
+                    },
+                    [&, i, Frame](IDeviceContext*, const RenderGraph& G) {
+                        if (i < NumTransients)
+                            pTextures[Frame][i] = G.GetTexture(Transients[i]);
+                    });
+            }
+
+            Graph.Execute(pContext);
+
+            const RenderGraph::Statistics& Stats = Graph.GetStatistics();
+            EXPECT_EQ(Stats.NumCulledPasses, 0u);
+            EXPECT_EQ(Stats.NumTransientResources, NumTransients);
+            if (Stats.NumMemoryAliasedResources > 0)
+            {
+                EXPECT_EQ(Stats.NumMemoryAliasedResources, NumTransients);
+                EXPECT_LE(Stats.AliasedMemorySize * 2, Stats.MemoryAliasedResourcesSize);
+            }
+            else
+            {
+                EXPECT_EQ(Stats.NumPhysicalResources, 2u);
+            }
+            EXPECT_EQ(pOutput->GetState(), RESOURCE_STATE_SHADER_RESOURCE);
+
+            for (Uint32 i = 0; i < NumTransients; ++i)
+                EXPECT_NE(pTextures[Frame][i], nullptr);
+        }
+
+        // Identical frames must reuse the same transient objects
+        for (Uint32 i = 0; i < NumTransients; ++i)
+            EXPECT_EQ(pTextures[0][i], pTextures[1][i]);
+
+        pContext->Flush();
+        pContext->WaitForIdle();
+    }
+}
+
+} // namespace
@@ -25,6 +25,7 @@
  */
 
 #include <functional>
+#include <vector>
 
 #include "GPUTestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
@@ -33,6 +34,7 @@
 #include "FastRand.hpp"
 #include "GraphicsTypesX.hpp"
 #include "CallbackWrapper.hpp"
+#include "ThreadPool.hpp"
 #include "ResourceLayoutTestCommon.hpp"
 
 #include "InlineShaders/RayTracingTestHLSL.h"
@@ -679,6 +681,68 @@ TEST(RenderStateCacheTest, CreateGraphicsPSO_RenderPass_Async)
     TestGraphicsPSO(/*UseRenderPass = */ true, /*CompileAsync = */ true);
 }
 
+TEST(RenderStateCacheTest, CreateGraphicsPSO_AsyncFallback)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    RefCntAutoPtr<IShader> pFallbackVS, pFallbackPS;
+    CreateGraphicsShaders(nullptr, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pFallbackVS, pFallbackPS, false, "VertexShader2.vsh", "PixelShader2.psh");
+    ASSERT_NE(pFallbackVS, nullptr);
+    ASSERT_NE(pFallbackPS, nullptr);
+
+    RefCntAutoPtr<IPipelineState> pFallbackPSO;
+    CreateGraphicsPSO(nullptr, false, pFallbackVS, pFallbackPS, /*UseRenderPass = */ false, /*CompileAsync = */ false, &pFallbackPSO);
+    ASSERT_NE(pFallbackPSO, nullptr);
+
+    auto pCache = CreateCache(pDevice, /*HotReload = */ false);
+    ASSERT_TRUE(pCache);
+
+    RefCntAutoPtr<IShader> pVS, pPS;
+    CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_ASYNCHRONOUS, pVS, pPS, false);
+    ASSERT_NE(pVS, nullptr);
+    ASSERT_NE(pPS, nullptr);
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    CreateGraphicsPSO(pCache, false, pVS, pPS, /*UseRenderPass = */ false, /*CompileAsync = */ true, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IAsyncPipelineState> pAsyncPSO{pPSO, IID_AsyncPipelineState};
+    if (!pAsyncPSO)
+    {
+        GTEST_SKIP() << "Shaders were compiled synchronously";
+    }
+
+    std::vector<PIPELINE_STATE_STATUS> ReportedStatuses;
+
+    auto OnStatusChanged = MakeCallback([&](IPipelineState* pPipeline, PIPELINE_STATE_STATUS Status) {
+        EXPECT_EQ(pPipeline, pAsyncPSO);
+        ReportedStatuses.push_back(Status);
+    });
+
+    pAsyncPSO->SetFallback(pFallbackPSO);
+    pAsyncPSO->SetStatusCallback(OnStatusChanged, OnStatusChanged);
+    EXPECT_EQ(pAsyncPSO->GetFallback(), pFallbackPSO);
+
+    ASSERT_EQ(pAsyncPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+    EXPECT_FALSE(pAsyncPSO->IsUsingFallback());
+    ASSERT_EQ(ReportedStatuses.size(), 1u);
+    EXPECT_EQ(ReportedStatuses[0], PIPELINE_STATE_STATUS_READY);
+
+    // The callback must only be invoked once
+    pAsyncPSO->GetStatus();
+    EXPECT_EQ(ReportedStatuses.size(), 1u);
+
+    auto pTexSRV = CreateWhiteTexture();
+    VerifyGraphicsPSO(pAsyncPSO, nullptr, pTexSRV, /*UseRenderPass = */ false);
+}
+
 void CreateComputePSO(IRenderStateCache* pCache, bool PresentInCache, IShader* pCS, bool UseSignature, bool CompileAsync, IPipelineState** ppPSO)
 {
     auto* pEnv    = GPUTestingEnvironment::GetInstance();
@@ -1158,6 +1222,317 @@ TEST(RenderStateCacheTest, AppendData)
     }
 }
 
+TEST(RenderStateCacheTest, Prewarm)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    constexpr bool UseSignature = false;
+
+    for (Uint32 HotReload = 0; HotReload < 2; ++HotReload)
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+        {
+            auto pCache = CreateCache(pDevice, HotReload);
+            EXPECT_EQ(pCache->Prewarm(), 0u);
+
+            RefCntAutoPtr<IShader> pCS;
+            CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, false);
+            ASSERT_NE(pCS, nullptr);
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            CreateComputePSO(pCache, /*PresentInCache = */ false, pCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+            ASSERT_NE(pPSO, nullptr);
+
+            pCache->WriteToBlob(ContentVersion, &pData);
+            ASSERT_NE(pData, nullptr);
+        }
+
+        auto pCache = CreateCache(pDevice, HotReload, pData);
+
+        RefCntAutoPtr<IAsyncTask> pTask;
+        EXPECT_EQ(pCache->Prewarm(&pTask), 1u);
+        if (pTask)
+            pTask->WaitForCompletion();
+
+        // All pipelines have been created
+        EXPECT_EQ(pCache->Prewarm(), 0u);
+
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, true);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache, /*PresentInCache = */ true, pCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+        ASSERT_EQ(pPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+
+        VerifyComputePSO(pPSO, /* UseSignature = */ true);
+
+        pCache->Reset();
+        EXPECT_EQ(pCache->Prewarm(), 0u);
+    }
+}
+
+TEST(RenderStateCacheTest, Precompile)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    constexpr bool UseSignature = false;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{1});
+    ASSERT_TRUE(pThreadPool);
+
+    for (Uint32 HotReload = 0; HotReload < 2; ++HotReload)
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+        {
+            auto pCache = CreateCache(pDevice, HotReload);
+            EXPECT_EQ(pCache->Precompile(pThreadPool), 0u);
+
+            RefCntAutoPtr<IShader> pCS;
+            CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, false);
+            ASSERT_NE(pCS, nullptr);
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            CreateComputePSO(pCache, /*PresentInCache = */ false, pCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+            ASSERT_NE(pPSO, nullptr);
+
+            pCache->WriteToBlob(ContentVersion, &pData);
+            ASSERT_NE(pData, nullptr);
+        }
+
+        auto pCache = CreateCache(pDevice, HotReload, pData);
+
+        RefCntAutoPtr<IAsyncTask> pTask;
+        EXPECT_EQ(pCache->Precompile(pThreadPool, 0.f, &pTask), 2u);
+        ASSERT_NE(pTask, nullptr);
+        pTask->WaitForCompletion();
+
+        RenderStateCachePrecompileProgress Progress;
+        pCache->GetPrecompileProgress(Progress);
+        EXPECT_EQ(Progress.NumShaders, 1u);
+        EXPECT_EQ(Progress.NumShadersProcessed, 1u);
+        EXPECT_EQ(Progress.NumPipelines, 1u);
+        EXPECT_EQ(Progress.NumPipelinesProcessed, 1u);
+
+        // All shaders and pipelines have been created
+        EXPECT_EQ(pCache->Precompile(pThreadPool), 0u);
+        EXPECT_EQ(pCache->Prewarm(), 0u);
+
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, true);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache, /*PresentInCache = */ true, pCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+        ASSERT_EQ(pPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+
+        VerifyComputePSO(pPSO, /* UseSignature = */ true);
+
+        pCache->Reset();
+        EXPECT_EQ(pCache->Precompile(pThreadPool), 0u);
+    }
+}
+
+TEST(RenderStateCacheTest, AppendDelta)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    constexpr bool UseSignature = false;
+
+    for (Uint32 HotReload = 0; HotReload < 2; ++HotReload)
+    {
+        // Journal: shader segment followed by the pipeline delta
+        std::vector<Uint8> Journal;
+        {
+            auto pCache = CreateCache(pDevice, HotReload);
+
+            RefCntAutoPtr<IShader> pCS;
+            CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, false);
+            ASSERT_NE(pCS, nullptr);
+
+            RefCntAutoPtr<IDataBlob> pData;
+            pCache->WriteToBlob(ContentVersion, &pData);
+            ASSERT_NE(pData, nullptr);
+            const Uint8* pBytes = static_cast<const Uint8*>(pData->GetConstDataPtr());
+            Journal.assign(pBytes, pBytes + pData->GetSize());
+
+            // No new states
+            RefCntAutoPtr<IDataBlob> pDelta;
+            EXPECT_TRUE(pCache->WriteDeltaToBlob(ContentVersion, &pDelta));
+            EXPECT_EQ(pDelta, nullptr);
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            CreateComputePSO(pCache, /*PresentInCache = */ false, pCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+            ASSERT_NE(pPSO, nullptr);
+
+            EXPECT_TRUE(pCache->WriteDeltaToBlob(ContentVersion, &pDelta));
+            ASSERT_NE(pDelta, nullptr);
+            pBytes = static_cast<const Uint8*>(pDelta->GetConstDataPtr());
+            Journal.insert(Journal.end(), pBytes, pBytes + pDelta->GetSize());
+        }
+
+        {
+            RefCntAutoPtr<IDataBlob> pJournal = DataBlobImpl::Create(Journal.size(), Journal.data());
+
+            auto pCache = CreateCache(pDevice, HotReload, pJournal);
+            EXPECT_TRUE(pCache->NeedsCompaction());
+
+            RefCntAutoPtr<IShader> pCS;
+            CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, true);
+            ASSERT_NE(pCS, nullptr);
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            CreateComputePSO(pCache, /*PresentInCache = */ true, pCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+            ASSERT_NE(pPSO, nullptr);
+            ASSERT_EQ(pPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+            VerifyComputePSO(pPSO, /* UseSignature = */ true);
+
+            // Compacted data is a single segment
+            RefCntAutoPtr<IDataBlob> pData;
+            pCache->WriteToBlob(ContentVersion, &pData);
+            ASSERT_NE(pData, nullptr);
+            EXPECT_FALSE(pCache->NeedsCompaction());
+
+            auto pCache2 = CreateCache(pDevice, HotReload, pData);
+            EXPECT_FALSE(pCache2->NeedsCompaction());
+        }
+
+        {
+            // Simulate the application terminated while appending the delta
+            Journal.resize(Journal.size() - 1);
+            RefCntAutoPtr<IDataBlob> pJournal = DataBlobImpl::Create(Journal.size(), Journal.data());
+
+            auto pCache = CreateCache(pDevice, HotReload);
+            EXPECT_TRUE(pCache->Load(pJournal, ContentVersion));
+            EXPECT_TRUE(pCache->NeedsCompaction());
+
+            // The shader segment is intact
+            RefCntAutoPtr<IShader> pCS;
+            CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, true);
+            ASSERT_NE(pCS, nullptr);
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            CreateComputePSO(pCache, /*PresentInCache = */ false, pCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+            ASSERT_NE(pPSO, nullptr);
+        }
+    }
+}
+
+TEST(RenderStateCacheTest, SharedCache)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    constexpr bool UseSignature = false;
+
+    for (Uint32 HotReload = 0; HotReload < 2; ++HotReload)
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+        {
+            auto pCache = CreateCache(pDevice, HotReload);
+            ASSERT_TRUE(pCache);
+
+            // The second cache would normally be created for another device
+            RenderStateCacheCreateInfo CacheCI{pDevice, pEnv->GetArchiverFactory(), RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE};
+            CacheCI.EnableHotReload = HotReload != 0;
+            CacheCI.pSharedCache    = pCache;
+            RefCntAutoPtr<IRenderStateCache> pSharedCache;
+            CreateRenderStateCache(CacheCI, &pSharedCache);
+            ASSERT_TRUE(pSharedCache);
+
+            RefCntAutoPtr<IShader> pCS;
+            CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ false);
+            ASSERT_NE(pCS, nullptr);
+
+            // The shader compiled by the first cache is reused
+            RefCntAutoPtr<IShader> pSharedCS;
+            CreateComputeShader(pSharedCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pSharedCS, /*PresentInCache = */ true);
+            ASSERT_NE(pSharedCS, nullptr);
+            EXPECT_NE(pSharedCS, pCS);
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            CreateComputePSO(pSharedCache, /*PresentInCache = */ false, pSharedCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+            ASSERT_NE(pPSO, nullptr);
+
+            RefCntAutoPtr<IPipelineState> pPSO2;
+            CreateComputePSO(pCache, /*PresentInCache = */ true, pCS, UseSignature, /*CompileAsync = */ false, &pPSO2);
+            ASSERT_NE(pPSO2, nullptr);
+            EXPECT_NE(pPSO, pPSO2);
+
+            // The states added by both caches are written by either of them
+            pSharedCache->WriteToBlob(ContentVersion, &pData);
+            ASSERT_NE(pData, nullptr);
+
+            RefCntAutoPtr<IDataBlob> pDelta;
+            EXPECT_TRUE(pCache->WriteDeltaToBlob(ContentVersion, &pDelta));
+            EXPECT_EQ(pDelta, nullptr);
+        }
+
+        {
+            auto pCache = CreateCache(pDevice, HotReload, pData);
+
+            RefCntAutoPtr<IShader> pCS;
+            CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ true);
+            ASSERT_NE(pCS, nullptr);
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            CreateComputePSO(pCache, /*PresentInCache = */ true, pCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+            ASSERT_NE(pPSO, nullptr);
+            ASSERT_EQ(pPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+            VerifyComputePSO(pPSO, /* UseSignature = */ true);
+
+            RefCntAutoPtr<IDataBlob> pDelta;
+            EXPECT_TRUE(pCache->WriteDeltaToBlob(ContentVersion, &pDelta));
+            EXPECT_EQ(pDelta, nullptr);
+        }
+    }
+}
+
 TEST(RenderStateCacheTest, RenderDeviceWithCache)
 {
     constexpr bool Execute = false;
@@ -1464,6 +1839,9 @@ void TestPipelineReload(TEST_PIPELINE_RELOAD_FLAGS Flags)
             EXPECT_EQ(NumStatesReloaded, pass == 0 ? 3u : 0u);
         ASSERT_EQ(pPSO->GetStatus(AsyncCompile), PIPELINE_STATE_STATUS_READY);
 
+        // Source files have not changed since the last reload
+        EXPECT_EQ(pCache->Reload(), 0u);
+
         if (!pSRB0)
         {
             // Init SRB after reloading the PSO
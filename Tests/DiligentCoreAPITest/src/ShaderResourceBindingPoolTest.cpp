@@ -0,0 +1,155 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderResourceBindingPool.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<IPipelineResourceSignature> CreateTestSignature(IRenderDevice* pDevice)
+{
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "SRB pool test";
+
+    // clang-format off
+    PipelineResourceDesc Resources[]
+    {
+        {SHADER_TYPE_PIXEL, "cbStatic",  1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+        {SHADER_TYPE_PIXEL, "cbMutable", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL, "cbDynamic", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    // clang-format on
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    return pPRS;
+}
+
+RefCntAutoPtr<IBuffer> CreateTestBuffer(IRenderDevice* pDevice)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "SRB pool test buffer";
+    BuffDesc.Size      = 256;
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    return pBuffer;
+}
+
+TEST(ShaderResourceBindingPoolTest, CreateShaderResourceBindings)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS = CreateTestSignature(pDevice);
+    ASSERT_NE(pPRS, nullptr);
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateTestBuffer(pDevice);
+    ASSERT_NE(pBuffer, nullptr);
+    pPRS->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbStatic")->Set(pBuffer);
+
+    constexpr Uint32        NumSRBs = 8;
+    IShaderResourceBinding* pSRBs[NumSRBs]{};
+    pPRS->CreateShaderResourceBindings(NumSRBs, pSRBs, true);
+    for (IShaderResourceBinding* pSRB : pSRBs)
+    {
+        ASSERT_NE(pSRB, nullptr);
+        EXPECT_TRUE(pSRB->StaticResourcesInitialized());
+        EXPECT_EQ(pSRB->GetPipelineResourceSignature(), pPRS);
+        pSRB->Release();
+    }
+}
+
+TEST(ShaderResourceBindingPoolTest, Recycle)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS = CreateTestSignature(pDevice);
+    ASSERT_NE(pPRS, nullptr);
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateTestBuffer(pDevice);
+    ASSERT_NE(pBuffer, nullptr);
+    pPRS->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbStatic")->Set(pBuffer);
+
+    ShaderResourceBindingPoolCreateInfo CI;
+    CI.pSignature  = pPRS;
+    CI.InitialSize = 2;
+    CI.GrowSize    = 4;
+
+    ShaderResourceBindingPool SRBPool{CI};
+    EXPECT_EQ(SRBPool.GetSize(), 2u);
+    EXPECT_EQ(SRBPool.GetNumFreeSRBs(), 2u);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB0 = SRBPool.Acquire();
+    RefCntAutoPtr<IShaderResourceBinding> pSRB1 = SRBPool.Acquire();
+    ASSERT_TRUE(pSRB0 && pSRB1);
+    EXPECT_NE(pSRB0, pSRB1);
+    EXPECT_EQ(SRBPool.GetNumFreeSRBs(), 0u);
+
+    pSRB0->GetVariableByName(SHADER_TYPE_PIXEL, "cbMutable")->Set(pBuffer);
+    pSRB0->GetVariableByName(SHADER_TYPE_PIXEL, "cbDynamic")->Set(pBuffer);
+
+    IShaderResourceBinding* const pRawSRB0 = pSRB0;
+    pSRB0.Release();
+
+    // The released SRB must be recycled instead of growing the pool
+    RefCntAutoPtr<IShaderResourceBinding> pSRB2 = SRBPool.Acquire();
+    EXPECT_EQ(pSRB2, pRawSRB0);
+    EXPECT_EQ(SRBPool.GetSize(), 2u);
+
+    EXPECT_EQ(pSRB2->GetVariableByName(SHADER_TYPE_PIXEL, "cbMutable")->Get(), nullptr);
+    EXPECT_EQ(pSRB2->GetVariableByName(SHADER_TYPE_PIXEL, "cbDynamic")->Get(), nullptr);
+    EXPECT_TRUE(pSRB2->StaticResourcesInitialized());
+
+    // No free SRBs left - the pool must grow
+    RefCntAutoPtr<IShaderResourceBinding> pSRB3 = SRBPool.Acquire();
+    ASSERT_NE(pSRB3, nullptr);
+    EXPECT_EQ(SRBPool.GetSize(), 6u);
+    EXPECT_EQ(SRBPool.GetNumFreeSRBs(), 3u);
+
+    pSRB1.Release();
+    pSRB2.Release();
+    pSRB3.Release();
+    SRBPool.Collect();
+    EXPECT_EQ(SRBPool.GetNumFreeSRBs(), 6u);
+}
+
+} // namespace
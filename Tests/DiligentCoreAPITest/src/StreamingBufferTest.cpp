@@ -25,6 +25,10 @@
  *  of the possibility of such damages.
  */
 
+#include <thread>
+#include <vector>
+#include <algorithm>
+
 #include "StreamingBuffer.hpp"
 #include "GPUTestingEnvironment.hpp"
 
@@ -101,4 +105,92 @@ TEST(StreamingBufferTest, MapUnmap)
     StreamBuff.Reset();
 }
 
+TEST(StreamingBufferTest, MultiProducer)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    StreamingBufferCreateInfo CI;
+    CI.pDevice = pDevice;
+
+    CI.BuffDesc.Name           = "Test multi-producer streaming buffer";
+    CI.BuffDesc.BindFlags      = BIND_VERTEX_BUFFER;
+    CI.BuffDesc.Usage          = USAGE_DYNAMIC;
+    CI.BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+    CI.BuffDesc.Size           = 4096;
+
+    StreamingBuffer StreamBuff{CI};
+    ASSERT_TRUE(StreamBuff.GetBuffer() != nullptr);
+
+    {
+        auto Offset = StreamBuff.Map(pContext, pDevice, 100);
+        EXPECT_EQ(Offset, Uint32{0});
+        StreamBuff.Unmap();
+    }
+
+    constexpr Uint32 ChunkSize      = 2048;
+    constexpr Uint32 NumThreads     = 4;
+    constexpr Uint32 NumAllocations = 16;
+    constexpr Uint32 AllocSize      = 12;
+
+    const auto ChunkOffset = StreamBuff.BeginMultiProducer(pContext, pDevice, ChunkSize);
+    EXPECT_EQ(ChunkOffset, Uint32{100});
+
+    std::vector<std::vector<Uint32>> Offsets(NumThreads);
+    std::vector<std::thread>         Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&StreamBuff, &Offsets, t]() {
+            StreamingBuffer::Producer Producer{StreamBuff, 64};
+            for (Uint32 i = 0; i < NumAllocations; ++i)
+            {
+                auto Alloc = Producer.Allocate(AllocSize, 4);
+                ASSERT_TRUE(Alloc);
+                EXPECT_EQ(Alloc.Offset % 4, Uint32{0});
+                memset(Alloc.pData, static_cast<int>(t), AllocSize);
+                Offsets[t].push_back(Alloc.Offset);
+            }
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    std::vector<Uint32> AllOffsets;
+    for (const auto& ThreadOffsets : Offsets)
+        AllOffsets.insert(AllOffsets.end(), ThreadOffsets.begin(), ThreadOffsets.end());
+    std::sort(AllOffsets.begin(), AllOffsets.end());
+    ASSERT_EQ(AllOffsets.size(), size_t{NumThreads * NumAllocations});
+    for (size_t i = 0; i < AllOffsets.size(); ++i)
+    {
+        EXPECT_GE(AllOffsets[i], ChunkOffset);
+        EXPECT_LE(AllOffsets[i] + AllocSize, ChunkOffset + ChunkSize);
+        if (i > 0)
+        {
+            EXPECT_GE(AllOffsets[i], AllOffsets[i - 1] + AllocSize);
+        }
+    }
+
+    {
+        // The chunk is too small for this allocation
+        auto Alloc = StreamBuff.AllocateMultiProducer(ChunkSize);
+        EXPECT_FALSE(Alloc);
+    }
+
+    const auto UsedSize = StreamBuff.EndMultiProducer();
+    EXPECT_GE(UsedSize, NumThreads * NumAllocations * AllocSize);
+    EXPECT_LE(UsedSize, ChunkSize);
+
+    {
+        // The unused part of the chunk is returned to the buffer
+        auto Offset = StreamBuff.Map(pContext, pDevice, 64);
+        EXPECT_EQ(Offset, ChunkOffset + UsedSize);
+        StreamBuff.Unmap();
+    }
+
+    StreamBuff.Reset();
+}
+
 } // namespace
@@ -869,6 +869,53 @@ const TextureTestAttribs TestList[] =
 // clang-format on
 
 
+TEST(TextureCreation, CachedViews)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Texture with cached views";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.MipLevels = 4;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET;
+    TexDesc.MiscFlags = MISC_TEXTURE_FLAG_CACHE_VIEWS;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+
+    TextureViewDesc ViewDesc;
+    ViewDesc.ViewType        = TEXTURE_VIEW_RENDER_TARGET;
+    ViewDesc.MostDetailedMip = 1;
+
+    RefCntAutoPtr<ITextureView> pRTV0;
+    ViewDesc.Name = "Mip 1 RTV";
+    pTexture->CreateView(ViewDesc, &pRTV0);
+    ASSERT_NE(pRTV0, nullptr);
+
+    RefCntAutoPtr<ITextureView> pRTV1;
+    ViewDesc.Name = "Mip 1 RTV - copy";
+    pTexture->CreateView(ViewDesc, &pRTV1);
+    EXPECT_EQ(pRTV0, pRTV1);
+
+    RefCntAutoPtr<ITextureView> pRTV2;
+    ViewDesc.MostDetailedMip = 2;
+    pTexture->CreateView(ViewDesc, &pRTV2);
+    ASSERT_NE(pRTV2, nullptr);
+    EXPECT_NE(pRTV0, pRTV2);
+
+    // Cached views keep the texture alive
+    ITextureView* pRawRTV = pRTV0;
+    pRTV1.Release();
+    pRTV2.Release();
+    pTexture.Release();
+    EXPECT_EQ(pRawRTV->GetTexture()->GetDesc().MiscFlags, MISC_TEXTURE_FLAG_CACHE_VIEWS);
+}
+
 INSTANTIATE_TEST_SUITE_P(TextureCreation,
                          TextureCreationTest,
                          testing::ValuesIn(std::begin(TestList), std::end(TestList)),
@@ -89,7 +89,7 @@ Uint32 WriteOrVerifyRGBAData(MappedTextureSubresource& MappedData,
     return NumInvalidPixels;
 }
 
-void TextureUploaderTest(bool IsRenderThread)
+void TextureUploaderTest(bool IsRenderThread, bool UseCopyContext = false, Uint64 MaxCopyBytesPerUpdate = 0)
 {
     auto* pEnv     = GPUTestingEnvironment::GetInstance();
     auto* pDevice  = pEnv->GetDevice();
@@ -100,9 +100,47 @@ void TextureUploaderTest(bool IsRenderThread)
         GTEST_SKIP() << "Texture uploader is not currently implemented in Metal";
     }
 
+    if (MaxCopyBytesPerUpdate != 0)
+    {
+        const RENDER_DEVICE_TYPE DevType = pDevice->GetDeviceInfo().Type;
+        if (DevType != RENDER_DEVICE_TYPE_D3D12 && DevType != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "Copy budget is only supported by Direct3D12 and Vulkan texture uploaders";
+        }
+    }
+
+    IDeviceContext* pCopyContext = nullptr;
+    if (UseCopyContext)
+    {
+        const RENDER_DEVICE_TYPE DevType = pDevice->GetDeviceInfo().Type;
+        if (DevType != RENDER_DEVICE_TYPE_D3D12 && DevType != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "Copy context is only supported by Direct3D12 and Vulkan texture uploaders";
+        }
+
+        constexpr auto QueueTypeMask = COMMAND_QUEUE_TYPE_GRAPHICS | COMMAND_QUEUE_TYPE_COMPUTE | COMMAND_QUEUE_TYPE_TRANSFER;
+        for (Uint32 CtxInd = 0; CtxInd < pEnv->GetNumImmediateContexts(); ++CtxInd)
+        {
+            auto* pCtx = pEnv->GetDeviceContext(CtxInd);
+            if ((pCtx->GetDesc().QueueType & QueueTypeMask) == COMMAND_QUEUE_TYPE_TRANSFER)
+            {
+                pCopyContext = pCtx;
+                break;
+            }
+        }
+
+        if (pCopyContext == nullptr)
+        {
+            GTEST_SKIP() << "Transfer queue is not available";
+        }
+    }
+
     GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
 
-    TextureUploaderDesc             UploaderDesc;
+    TextureUploaderDesc UploaderDesc;
+    UploaderDesc.pCopyContext          = pCopyContext;
+    UploaderDesc.MaxCopyBytesPerUpdate = MaxCopyBytesPerUpdate;
+
     RefCntAutoPtr<ITextureUploader> pTexUploader;
     CreateTextureUploader(pDevice, UploaderDesc, &pTexUploader);
     ASSERT_TRUE(pTexUploader);
@@ -116,6 +154,8 @@ void TextureUploaderTest(bool IsRenderThread)
     TexDesc.ArraySize = 8;
     TexDesc.BindFlags = BIND_SHADER_RESOURCE;
     TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    if (pCopyContext != nullptr)
+        TexDesc.ImmediateContextMask = (Uint64{1} << pContext->GetDesc().ContextId) | (Uint64{1} << pCopyContext->GetDesc().ContextId);
     RefCntAutoPtr<ITexture> pDstTexture;
     pDevice->CreateTexture(TexDesc, nullptr, &pDstTexture);
 
@@ -124,6 +164,8 @@ void TextureUploaderTest(bool IsRenderThread)
     TexDesc.Usage          = USAGE_STAGING;
     TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
     TexDesc.BindFlags      = BIND_NONE;
+
+    TexDesc.ImmediateContextMask = Uint64{1} << pContext->GetDesc().ContextId;
     RefCntAutoPtr<ITexture> pStagingTexture;
     pDevice->CreateTexture(TexDesc, nullptr, &pStagingTexture);
 
@@ -149,6 +191,8 @@ void TextureUploaderTest(bool IsRenderThread)
         {
             RefCntAutoPtr<IUploadBuffer> pUploadBuffer;
             pTexUploader->AllocateUploadBuffer(pCtx, UploadBuffDesc, &pUploadBuffer);
+            EXPECT_EQ(pUploadBuffer->GetPriority(), 0);
+            pUploadBuffer->SetPriority(static_cast<Int32>(i));
 
             for (Uint32 slice = 0; slice < UploadBuffDesc.ArraySize; ++slice)
             {
@@ -174,13 +218,25 @@ void TextureUploaderTest(bool IsRenderThread)
         else
         {
             std::thread WorkerThread{PopulateBuffer, nullptr};
+            Uint32      NumUpdates = 0;
             while (!BufferPopulated)
             {
                 pTexUploader->RenderThreadUpdate(pContext);
+                ++NumUpdates;
             }
             WorkerThread.join();
+
+            if (MaxCopyBytesPerUpdate != 0)
+            {
+                // Every update copies at most one subresource
+                EXPECT_GE(NumUpdates, UploadBuffDesc.MipLevels * UploadBuffDesc.ArraySize);
+            }
         }
 
+        const TextureUploaderStats Stats = pTexUploader->GetStats();
+        EXPECT_EQ(Stats.NumPendingOperations, 0u);
+        EXPECT_EQ(Stats.PendingCopySize, 0u);
+
 
         for (Uint32 slice = StartDstSlice; slice < StartDstSlice + UploadBuffDesc.ArraySize; ++slice)
         {
@@ -220,4 +276,24 @@ TEST(TextureUploaderTest, WorkerThread)
     TextureUploaderTest(false);
 }
 
+TEST(TextureUploaderTest, RenderThread_CopyContext)
+{
+    TextureUploaderTest(true, true);
+}
+
+TEST(TextureUploaderTest, WorkerThread_CopyContext)
+{
+    TextureUploaderTest(false, true);
+}
+
+TEST(TextureUploaderTest, WorkerThread_CopyBudget)
+{
+    TextureUploaderTest(false, false, 1);
+}
+
+TEST(TextureUploaderTest, WorkerThread_CopyContext_CopyBudget)
+{
+    TextureUploaderTest(false, true, 1);
+}
+
 } // namespace
@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "TransientResourceAllocator.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TextureDesc GetRenderTargetDesc(const char* Name, Uint32 Size)
+{
+    TextureDesc TexDesc;
+    TexDesc.Name      = Name;
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = Size;
+    TexDesc.Height    = Size;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    return TexDesc;
+}
+
+void ClearRenderTarget(IDeviceContext* pContext, ITexture* pTexture)
+{
+    ITextureView* pRTV = pTexture->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    constexpr float ClearColor[] = {1, 0, 0, 1};
+    pContext->ClearRenderTarget(pRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+}
+
+TEST(TransientResourceAllocatorTest, ReuseAcrossFrames)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    TransientResourceAllocatorCreateInfo CI;
+    CI.HeapSize = Uint64{16} << Uint64{20};
+
+    TransientResourceAllocator Allocator{pDevice, CI};
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Transient buffer";
+    BuffDesc.Size      = 4096;
+    BuffDesc.BindFlags = BIND_UNORDERED_ACCESS;
+    BuffDesc.Mode      = BUFFER_MODE_RAW;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+
+    constexpr Uint32 NumFrames = 4;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        Allocator.BeginFrame();
+
+        RefCntAutoPtr<ITexture> pRT = Allocator.AllocateTexture(GetRenderTargetDesc("Transient RT", 256));
+        ASSERT_NE(pRT, nullptr);
+        RefCntAutoPtr<IBuffer> pBuffer = Allocator.AllocateBuffer(BuffDesc);
+        ASSERT_NE(pBuffer, nullptr);
+        Allocator.CommitAliasingBarriers(pContext);
+
+        ClearRenderTarget(pContext, pRT);
+
+        Allocator.EndFrame(pContext);
+
+        // Make sure the frame is complete so that its resources are reused by the next one
+        pContext->WaitForIdle();
+    }
+
+    const TransientResourceAllocator::Statistics& Stats = Allocator.GetStatistics();
+    EXPECT_EQ(Stats.NumCreatedResources, 2u);
+    EXPECT_EQ(Stats.NumReusedResources, (NumFrames - 1) * 2u);
+    if (Allocator.IsPlacementSupported())
+    {
+        EXPECT_EQ(Stats.NumHeaps, 1u);
+        EXPECT_EQ(Stats.NumAliasingBarriers, 0u);
+    }
+}
+
+TEST(TransientResourceAllocatorTest, Aliasing)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetAdapterInfo().Memory.PlacedResources)
+    {
+        GTEST_SKIP() << "Placed resources are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    TransientResourceAllocator Allocator{pDevice};
+
+    Allocator.BeginFrame();
+
+    RefCntAutoPtr<ITexture> pRT0 = Allocator.AllocateTexture(GetRenderTargetDesc("Transient RT 0", 512));
+    ASSERT_NE(pRT0, nullptr);
+    Allocator.CommitAliasingBarriers(pContext);
+    ClearRenderTarget(pContext, pRT0);
+
+    // The second texture has a different size, so it can't reuse the first one,
+    // but it is placed into the memory released by the first texture.
+    Allocator.Release(pRT0);
+    RefCntAutoPtr<ITexture> pRT1 = Allocator.AllocateTexture(GetRenderTargetDesc("Transient RT 1", 256));
+    ASSERT_NE(pRT1, nullptr);
+    EXPECT_NE(pRT1, pRT0);
+    EXPECT_EQ(Allocator.GetStatistics().NumAliasingBarriers, 1u);
+    Allocator.CommitAliasingBarriers(pContext);
+
+    ClearRenderTarget(pContext, pRT1);
+
+    Allocator.EndFrame(pContext);
+    pContext->WaitForIdle();
+
+    const TransientResourceAllocator::Statistics& Stats = Allocator.GetStatistics();
+    EXPECT_EQ(Stats.NumHeaps, 1u);
+    EXPECT_EQ(Stats.NumCreatedResources, 2u);
+
+    EXPECT_EQ(TransientResourceAllocator::GetAliasingBarrier(pRT0, pRT1).Flags, STATE_TRANSITION_FLAG_ALIASING);
+}
+
+} // namespace
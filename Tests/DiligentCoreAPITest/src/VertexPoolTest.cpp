@@ -183,4 +183,64 @@ TEST(VertexPoolTest, Allocate)
     }
 }
 
+
+TEST(VertexPoolTest, Defragment)
+{
+    auto* const pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice  = pEnv->GetDevice();
+    auto* const pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr VertexPoolElementDesc Elements[] =
+        {
+            VertexPoolElementDesc{16},
+            VertexPoolElementDesc{24, BIND_SHADER_RESOURCE, USAGE_DEFAULT, BUFFER_MODE_STRUCTURED, CPU_ACCESS_NONE},
+        };
+    constexpr Uint32 VertexSize = 16 + 24;
+
+    VertexPoolCreateInfo CI;
+    CI.Desc.Name        = "Vertex pool defragment test";
+    CI.Desc.pElements   = Elements;
+    CI.Desc.NumElements = _countof(Elements);
+    CI.Desc.VertexCount = 1024;
+
+    RefCntAutoPtr<IVertexPool> pVtxPool;
+    CreateVertexPool(pDevice, CI, &pVtxPool);
+    ASSERT_NE(pVtxPool, nullptr);
+
+    RefCntAutoPtr<IVertexPoolAllocation> pAllocs[4];
+    for (auto& pAlloc : pAllocs)
+    {
+        pVtxPool->Allocate(64, &pAlloc);
+        ASSERT_NE(pAlloc, nullptr);
+    }
+    pVtxPool->UpdateAll(pDevice, pContext);
+
+    // [0, 64) [free] [128, 192) [free]
+    pAllocs[1].Release();
+    pAllocs[3].Release();
+
+    const Uint32 Version = pVtxPool->GetVersion();
+
+    // Budget is too small to move 64 vertices
+    EXPECT_EQ(pVtxPool->Defragment(pDevice, pContext, 63 * VertexSize), 0u);
+    EXPECT_EQ(pVtxPool->GetVersion(), Version);
+
+    EXPECT_EQ(pVtxPool->Defragment(pDevice, pContext, 1024 * VertexSize), 64 * VertexSize);
+    EXPECT_EQ(pAllocs[0]->GetStartVertex(), 0u);
+    EXPECT_EQ(pAllocs[2]->GetStartVertex(), 64u);
+    EXPECT_NE(pVtxPool->GetVersion(), Version);
+
+    EXPECT_EQ(pVtxPool->Defragment(pDevice, pContext, 1024 * VertexSize), 0u);
+
+    RefCntAutoPtr<IVertexPoolAllocation> pAlloc;
+    pVtxPool->Allocate(896, &pAlloc);
+    ASSERT_NE(pAlloc, nullptr);
+    EXPECT_EQ(pAlloc->GetStartVertex(), 128u);
+
+    pContext->Flush();
+    pContext->FinishFrame();
+}
+
 } // namespace
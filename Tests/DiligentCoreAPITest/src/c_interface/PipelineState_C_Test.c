@@ -43,8 +43,9 @@ int TestPipelineStateCInterface(struct IPipelineState* pPSO)
     Uint32 StaticVarCount = 0;
     bool   IsCompatible   = false;
 
-    IShaderResourceVariable* pVar = NULL;
-    IShaderResourceBinding*  pSRB = NULL;
+    IShaderResourceVariable* pVar     = NULL;
+    IShaderResourceBinding*  pSRB     = NULL;
+    IShaderResourceBinding*  pSRBs[2] = {NULL, NULL};
 
     int num_errors =
         TestObjectCInterface((struct IObject*)pPSO) +
@@ -95,6 +96,15 @@ int TestPipelineStateCInterface(struct IPipelineState* pPSO)
     else
         ++num_errors;
 
+    IPipelineState_CreateShaderResourceBindings(pPSO, 2, pSRBs, false);
+    if (pSRBs[0] != NULL && pSRBs[1] != NULL)
+    {
+        IObject_Release(pSRBs[0]);
+        IObject_Release(pSRBs[1]);
+    }
+    else
+        ++num_errors;
+
     IsCompatible = IPipelineState_IsCompatibleWith(pPSO, pPSO);
     if (!IsCompatible)
         ++num_errors;
@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BasicMath.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<float4x4> CreateMatrices(size_t Count)
+{
+    std::vector<float4x4> Matrices(Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float f = static_cast<float>(i);
+        Matrices[i]   = float4x4::RotationY(f * 0.1f) * float4x4::Scale(1.f + f * 0.01f) * float4x4::Translation(f, -f, f * 0.5f);
+    }
+    return Matrices;
+}
+
+// Arg(0) - the number of matrices.
+void BM_BasicMath_MatrixMultiply(benchmark::State& state)
+{
+    const size_t Count = static_cast<size_t>(state.range(0));
+
+    const std::vector<float4x4> Lhs = CreateMatrices(Count);
+    const std::vector<float4x4> Rhs = CreateMatrices(Count);
+    std::vector<float4x4>       Res(Count);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < Count; ++i)
+            Res[i] = Lhs[i] * Rhs[i];
+        benchmark::DoNotOptimize(Res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(Count));
+}
+BENCHMARK(BM_BasicMath_MatrixMultiply)->RangeMultiplier(8)->Range(8, 32768);
+
+// Arg(0) - the number of vectors.
+void BM_BasicMath_TransformVectors(benchmark::State& state)
+{
+    const size_t Count = static_cast<size_t>(state.range(0));
+
+    const float4x4 Transform = float4x4::RotationX(0.3f) * float4x4::Translation(1, 2, 3);
+
+    std::vector<float3> Src(Count);
+    for (size_t i = 0; i < Count; ++i)
+        Src[i] = float3{static_cast<float>(i), static_cast<float>(i) * 0.5f, 1.f};
+
+    std::vector<float4> Dst(Count);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < Count; ++i)
+            Dst[i] = float4{Src[i], 1.f} * Transform;
+        benchmark::DoNotOptimize(Dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(Count));
+}
+BENCHMARK(BM_BasicMath_TransformVectors)->RangeMultiplier(8)->Range(8, 32768);
+
+void BM_BasicMath_MatrixInverse(benchmark::State& state)
+{
+    const std::vector<float4x4> Matrices = CreateMatrices(64);
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        float4x4 Inv = Matrices[i].Inverse();
+        benchmark::DoNotOptimize(Inv);
+        i = (i + 1) % Matrices.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BasicMath_MatrixInverse);
+
+// Arg(0) - the number of vectors.
+void BM_BasicMath_Normalize(benchmark::State& state)
+{
+    const size_t Count = static_cast<size_t>(state.range(0));
+
+    std::vector<float3> Vectors(Count);
+    for (size_t i = 0; i < Count; ++i)
+        Vectors[i] = float3{static_cast<float>(i) + 1.f, 2.f, -static_cast<float>(i)};
+
+    std::vector<float3> Res(Count);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < Count; ++i)
+            Res[i] = normalize(Vectors[i]);
+        benchmark::DoNotOptimize(Res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(Count));
+}
+BENCHMARK(BM_BasicMath_Normalize)->RangeMultiplier(8)->Range(8, 32768);
+
+} // namespace
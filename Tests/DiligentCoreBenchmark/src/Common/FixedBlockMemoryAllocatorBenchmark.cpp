@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FixedBlockMemoryAllocator.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Allocates and releases batches of blocks from all threads.
+// Arg(0) - block size, Arg(1) - thread cache size (0 disables the per-thread cache).
+void BM_FixedBlockMemoryAllocator_AllocFree(benchmark::State& state)
+{
+    constexpr size_t BatchSize = 64;
+
+    const size_t BlockSize       = static_cast<size_t>(state.range(0));
+    const Uint32 ThreadCacheSize = static_cast<Uint32>(state.range(1));
+
+    static std::unique_ptr<FixedBlockMemoryAllocator> pAllocator;
+    if (state.thread_index() == 0)
+        pAllocator = std::make_unique<FixedBlockMemoryAllocator>(DefaultRawMemoryAllocator::GetAllocator(), BlockSize, 1024, ThreadCacheSize);
+
+    std::vector<void*> Blocks(BatchSize);
+    for (auto _ : state)
+    {
+        for (void*& Ptr : Blocks)
+            Ptr = pAllocator->Allocate(BlockSize, "Benchmark block", __FILE__, __LINE__);
+        benchmark::ClobberMemory();
+        for (void* Ptr : Blocks)
+            pAllocator->Free(Ptr);
+    }
+    state.SetItemsProcessed(state.iterations() * BatchSize);
+
+    if (state.thread_index() == 0)
+        pAllocator.reset();
+}
+BENCHMARK(BM_FixedBlockMemoryAllocator_AllocFree)
+    ->ArgsProduct({{16, 256, 4096}, {0, 64}})
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+// Baseline: the same pattern with the default raw allocator.
+void BM_DefaultRawMemoryAllocator_AllocFree(benchmark::State& state)
+{
+    constexpr size_t BatchSize = 64;
+
+    const size_t BlockSize = static_cast<size_t>(state.range(0));
+
+    IMemoryAllocator&  Allocator = DefaultRawMemoryAllocator::GetAllocator();
+    std::vector<void*> Blocks(BatchSize);
+    for (auto _ : state)
+    {
+        for (void*& Ptr : Blocks)
+            Ptr = Allocator.Allocate(BlockSize, "Benchmark block", __FILE__, __LINE__);
+        benchmark::ClobberMemory();
+        for (void* Ptr : Blocks)
+            Allocator.Free(Ptr);
+    }
+    state.SetItemsProcessed(state.iterations() * BatchSize);
+}
+BENCHMARK(BM_DefaultRawMemoryAllocator_AllocFree)->Arg(16)->Arg(256)->Arg(4096)->ThreadRange(1, 16)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "HashUtils.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Arg(0) - data size in bytes.
+void BM_HashUtils_ComputeHashRaw(benchmark::State& state)
+{
+    const size_t Size = static_cast<size_t>(state.range(0));
+
+    std::vector<Uint8> Data(Size);
+    for (size_t i = 0; i < Size; ++i)
+        Data[i] = static_cast<Uint8>(i * 31u);
+
+    for (auto _ : state)
+    {
+        size_t Hash = ComputeHashRaw(Data.data(), Data.size());
+        benchmark::DoNotOptimize(Hash);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(Size));
+}
+BENCHMARK(BM_HashUtils_ComputeHashRaw)->RangeMultiplier(4)->Range(16, 1 << 20);
+
+void BM_HashUtils_ComputeHashArgs(benchmark::State& state)
+{
+    Uint32 a = 1;
+    float  b = 2.5f;
+    Uint64 c = 0x123456789ABCDEFull;
+    for (auto _ : state)
+    {
+        size_t Hash = ComputeHash(a, b, c, a, b, c, a, b);
+        benchmark::DoNotOptimize(Hash);
+        ++a;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HashUtils_ComputeHashArgs);
+
+void BM_HashUtils_SamplerDesc(benchmark::State& state)
+{
+    SamplerDesc Desc;
+    Desc.MinFilter = FILTER_TYPE_ANISOTROPIC;
+    Desc.MagFilter = FILTER_TYPE_ANISOTROPIC;
+    Desc.MipFilter = FILTER_TYPE_ANISOTROPIC;
+
+    std::hash<SamplerDesc> Hasher;
+    for (auto _ : state)
+    {
+        size_t Hash = Hasher(Desc);
+        benchmark::DoNotOptimize(Hash);
+        Desc.MaxAnisotropy = (Desc.MaxAnisotropy + 1) & 15u;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HashUtils_SamplerDesc);
+
+} // namespace
@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LRUCache.hpp"
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct CacheData
+{
+    Uint32 Value = 0;
+};
+
+// Arg(0) - the number of keys that are looked up.
+// All keys fit into the cache, so after the first iteration every lookup is a hit.
+void BM_LRUCache_GetHit(benchmark::State& state)
+{
+    const Uint32 NumKeys = static_cast<Uint32>(state.range(0));
+
+    static LRUCache<Uint32, CacheData> Cache;
+    if (state.thread_index() == 0)
+        Cache.SetMaxSize(NumKeys);
+
+    Uint32 Key = static_cast<Uint32>(state.thread_index());
+    for (auto _ : state)
+    {
+        CacheData Data = Cache.Get(Key,
+                                   [Key](CacheData& Data, size_t& Size) //
+                                   {
+                                       Data.Value = Key;
+                                       Size       = 1;
+                                   });
+        benchmark::DoNotOptimize(Data);
+        Key = (Key + 1) % NumKeys;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LRUCache_GetHit)->RangeMultiplier(8)->Range(8, 4096)->ThreadRange(1, 16)->UseRealTime();
+
+// Arg(0) - the number of distinct keys; the cache only holds a quarter of them,
+// so most lookups miss and evict the least recently used entry.
+void BM_LRUCache_GetMiss(benchmark::State& state)
+{
+    const Uint32 NumKeys = static_cast<Uint32>(state.range(0));
+
+    static LRUCache<Uint32, CacheData> Cache;
+    if (state.thread_index() == 0)
+        Cache.SetMaxSize(NumKeys / 4);
+
+    Uint32 Key = static_cast<Uint32>(state.thread_index()) * 7919u;
+    for (auto _ : state)
+    {
+        CacheData Data = Cache.Get(Key % NumKeys,
+                                   [Key](CacheData& Data, size_t& Size) //
+                                   {
+                                       Data.Value = Key;
+                                       Size       = 1;
+                                   });
+        benchmark::DoNotOptimize(Data);
+        Key = Key * 1664525u + 1013904223u;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LRUCache_GetMiss)->RangeMultiplier(8)->Range(64, 32768)->ThreadRange(1, 16)->UseRealTime();
+
+} // namespace
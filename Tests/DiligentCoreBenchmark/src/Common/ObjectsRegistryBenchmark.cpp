@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ObjectsRegistry.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct RegistryData
+{
+    explicit RegistryData(Uint32 _Value) :
+        Value{_Value}
+    {}
+
+    Uint32 Value;
+};
+
+template <size_t NumShards>
+using RegistryType = ObjectsRegistry<Uint32, std::shared_ptr<RegistryData>, std::hash<Uint32>, std::equal_to<Uint32>, NumShards>;
+
+// Looks up objects that are alive in the registry, which only takes the shared lock.
+// Arg(0) - the number of objects in the registry.
+template <size_t NumShards>
+void BM_ObjectsRegistry_GetAlive(benchmark::State& state)
+{
+    const Uint32 NumKeys = static_cast<Uint32>(state.range(0));
+
+    static RegistryType<NumShards>                    Registry;
+    static std::vector<std::shared_ptr<RegistryData>> Objects;
+    if (state.thread_index() == 0)
+    {
+        Registry.Clear();
+        Objects.clear();
+        for (Uint32 i = 0; i < NumKeys; ++i)
+            Objects.emplace_back(Registry.Get(i, [i]() { return std::make_shared<RegistryData>(i); }));
+    }
+
+    Uint32 Key = static_cast<Uint32>(state.thread_index());
+    for (auto _ : state)
+    {
+        std::shared_ptr<RegistryData> pObj = Registry.Get(Key, [Key]() { return std::make_shared<RegistryData>(Key); });
+        benchmark::DoNotOptimize(pObj);
+        Key = (Key + 1) % NumKeys;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+        Objects.clear();
+}
+BENCHMARK_TEMPLATE(BM_ObjectsRegistry_GetAlive, 1)->RangeMultiplier(8)->Range(8, 4096)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ObjectsRegistry_GetAlive, 16)->RangeMultiplier(8)->Range(8, 4096)->ThreadRange(1, 16)->UseRealTime();
+
+// Every lookup creates a new object that expires immediately, which exercises
+// the exclusive lock and the periodic purge of expired entries.
+template <size_t NumShards>
+void BM_ObjectsRegistry_GetCreate(benchmark::State& state)
+{
+    static RegistryType<NumShards> Registry;
+
+    Uint32 Key = static_cast<Uint32>(state.thread_index()) << 24u;
+    for (auto _ : state)
+    {
+        std::shared_ptr<RegistryData> pObj = Registry.Get(Key, [Key]() { return std::make_shared<RegistryData>(Key); });
+        benchmark::DoNotOptimize(pObj);
+        ++Key;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_ObjectsRegistry_GetCreate, 1)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ObjectsRegistry_GetCreate, 16)->ThreadRange(1, 16)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Serializer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct Record
+{
+    Uint32      Id    = 0;
+    Uint64      Hash  = 0;
+    float       Value = 0;
+    const char* Name  = nullptr;
+};
+
+std::vector<Record> CreateRecords(size_t NumRecords, std::vector<std::string>& Names)
+{
+    std::vector<Record> Records(NumRecords);
+    Names.resize(NumRecords);
+    for (size_t i = 0; i < NumRecords; ++i)
+    {
+        Names[i]         = "Record " + std::to_string(i);
+        Records[i].Id    = static_cast<Uint32>(i);
+        Records[i].Hash  = i * 0x9E3779B97F4A7C15ull;
+        Records[i].Value = static_cast<float>(i) * 0.5f;
+        Records[i].Name  = Names[i].c_str();
+    }
+    return Records;
+}
+
+template <SerializerMode Mode, typename RecordType>
+bool SerializeRecords(Serializer<Mode>& Ser, RecordType* Records, size_t NumRecords)
+{
+    for (size_t i = 0; i < NumRecords; ++i)
+    {
+        RecordType& R = Records[i];
+        if (!Ser(R.Id, R.Hash, R.Value, R.Name))
+            return false;
+    }
+    return true;
+}
+
+// Arg(0) - the number of records.
+void BM_Serializer_Write(benchmark::State& state)
+{
+    const size_t NumRecords = static_cast<size_t>(state.range(0));
+
+    std::vector<std::string> Names;
+    std::vector<Record>      Records = CreateRecords(NumRecords, Names);
+
+    IMemoryAllocator& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    size_t DataSize = 0;
+    for (auto _ : state)
+    {
+        Serializer<SerializerMode::Measure> MSer;
+        SerializeRecords(MSer, Records.data(), NumRecords);
+
+        SerializedData Data = MSer.AllocateData(RawAllocator);
+
+        Serializer<SerializerMode::Write> WSer{Data};
+        SerializeRecords(WSer, Records.data(), NumRecords);
+        VERIFY_EXPR(WSer.IsEnded());
+
+        DataSize = Data.Size();
+        benchmark::DoNotOptimize(Data.Ptr());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NumRecords));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(DataSize));
+}
+BENCHMARK(BM_Serializer_Write)->RangeMultiplier(8)->Range(8, 32768);
+
+// Arg(0) - the number of records.
+void BM_Serializer_Read(benchmark::State& state)
+{
+    const size_t NumRecords = static_cast<size_t>(state.range(0));
+
+    std::vector<std::string> Names;
+    std::vector<Record>      Records = CreateRecords(NumRecords, Names);
+
+    Serializer<SerializerMode::Measure> MSer;
+    SerializeRecords(MSer, Records.data(), NumRecords);
+
+    SerializedData Data = MSer.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        SerializeRecords(WSer, Records.data(), NumRecords);
+    }
+
+    std::vector<Record> ReadRecords(NumRecords);
+    for (auto _ : state)
+    {
+        Serializer<SerializerMode::Read> RSer{Data};
+        SerializeRecords(RSer, ReadRecords.data(), NumRecords);
+        benchmark::DoNotOptimize(ReadRecords.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NumRecords));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(Data.Size()));
+}
+BENCHMARK(BM_Serializer_Read)->RangeMultiplier(8)->Range(8, 32768);
+
+} // namespace
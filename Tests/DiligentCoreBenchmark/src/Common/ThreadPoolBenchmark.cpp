@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Enqueues a batch of trivial tasks and waits for all of them.
+// Arg(0) - the number of worker threads, Arg(1) - work stealing (0/1).
+void BM_ThreadPool_EnqueueTasks(benchmark::State& state)
+{
+    constexpr Uint32 NumTasks = 1024;
+
+    ThreadPoolCreateInfo PoolCI;
+    PoolCI.NumThreads         = static_cast<size_t>(state.range(0));
+    PoolCI.EnableWorkStealing = state.range(1) != 0;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(PoolCI);
+
+    std::atomic<Uint32> Counter{0};
+    for (auto _ : state)
+    {
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            EnqueueAsyncWork(pThreadPool,
+                             [&Counter](Uint32 ThreadId) //
+                             {
+                                 Counter.fetch_add(1, std::memory_order_relaxed);
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+        pThreadPool->WaitForAllTasks();
+    }
+    benchmark::DoNotOptimize(Counter.load());
+    state.SetItemsProcessed(state.iterations() * NumTasks);
+}
+BENCHMARK(BM_ThreadPool_EnqueueTasks)
+    ->ArgsProduct({{1, 2, 4, 8, 16}, {0, 1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+// Runs ParallelFor over a range of items with a small amount of work per item.
+// Arg(0) - the number of worker threads, Arg(1) - the number of items.
+void BM_ThreadPool_ParallelFor(benchmark::State& state)
+{
+    const Uint32 NumItems = static_cast<Uint32>(state.range(1));
+
+    ThreadPoolCreateInfo PoolCI;
+    PoolCI.NumThreads = static_cast<size_t>(state.range(0));
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(PoolCI);
+
+    std::vector<float> Data(NumItems);
+    for (auto _ : state)
+    {
+        ParallelFor(pThreadPool, 0, NumItems, 64,
+                    [&Data](Uint32 i) //
+                    {
+                        float Val = static_cast<float>(i);
+                        for (Uint32 j = 0; j < 64; ++j)
+                            Val = Val * 0.999f + 1.f;
+                        Data[i] = Val;
+                    });
+        benchmark::DoNotOptimize(Data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NumItems));
+}
+BENCHMARK(BM_ThreadPool_ParallelFor)
+    ->ArgsProduct({{0, 1, 2, 4, 8, 16}, {1024, 65536, 1 << 20}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
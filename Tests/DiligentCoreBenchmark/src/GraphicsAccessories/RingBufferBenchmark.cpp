@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "RingBuffer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Simulates per-frame dynamic allocations: Arg(0) allocations of Arg(1) bytes are made
+// every frame, and frames are retired with a latency of two frames.
+void BM_RingBuffer_FrameAllocations(benchmark::State& state)
+{
+    const size_t NumAllocsPerFrame = static_cast<size_t>(state.range(0));
+    const size_t AllocSize         = static_cast<size_t>(state.range(1));
+
+    constexpr Uint64 FrameLatency = 2;
+
+    RingBuffer Ring{NumAllocsPerFrame * AllocSize * (FrameLatency + 1), DefaultRawMemoryAllocator::GetAllocator()};
+
+    Uint64 FrameNum = 0;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < NumAllocsPerFrame; ++i)
+        {
+            RingBuffer::OffsetType Offset = Ring.Allocate(AllocSize, 16);
+            benchmark::DoNotOptimize(Offset);
+        }
+        Ring.FinishCurrentFrame(FrameNum);
+        if (FrameNum >= FrameLatency)
+            Ring.ReleaseCompletedFrames(FrameNum - FrameLatency);
+        ++FrameNum;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NumAllocsPerFrame));
+}
+BENCHMARK(BM_RingBuffer_FrameAllocations)->ArgsProduct({{16, 256, 4096}, {64, 1024}});
+
+} // namespace
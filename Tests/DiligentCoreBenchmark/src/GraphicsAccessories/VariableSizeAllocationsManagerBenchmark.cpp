@@ -0,0 +1,76 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "VariableSizeAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FastRand.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Keeps Arg(0) live allocations of random sizes and replaces one of them at random
+// on every iteration, which fragments the free list over time.
+void BM_VariableSizeAllocationsManager_RandomAllocFree(benchmark::State& state)
+{
+    using Allocation = VariableSizeAllocationsManager::Allocation;
+
+    const size_t NumLiveAllocations = static_cast<size_t>(state.range(0));
+
+    VariableSizeAllocationsManager Mgr{NumLiveAllocations * 1024, DefaultRawMemoryAllocator::GetAllocator()};
+
+    FastRandInt SizeRnd{0, 1, 512};
+    FastRandInt IdxRnd{1, 0, static_cast<int>(NumLiveAllocations) - 1};
+
+    std::vector<Allocation> Allocations;
+    Allocations.reserve(NumLiveAllocations);
+    for (size_t i = 0; i < NumLiveAllocations; ++i)
+        Allocations.emplace_back(Mgr.Allocate(SizeRnd() * 16, 16));
+
+    for (auto _ : state)
+    {
+        Allocation& Alloc = Allocations[IdxRnd()];
+        if (Alloc.IsValid())
+            Mgr.Free(std::move(Alloc));
+        Alloc = Mgr.Allocate(SizeRnd() * 16, 16);
+        benchmark::DoNotOptimize(Alloc.UnalignedOffset);
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    for (Allocation& Alloc : Allocations)
+    {
+        if (Alloc.IsValid())
+            Mgr.Free(std::move(Alloc));
+    }
+}
+BENCHMARK(BM_VariableSizeAllocationsManager_RandomAllocFree)->RangeMultiplier(8)->Range(8, 32768);
+
+} // namespace
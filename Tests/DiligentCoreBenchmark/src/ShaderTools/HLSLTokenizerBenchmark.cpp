@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "HLSLTokenizer.hpp"
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+using namespace Diligent;
+using namespace Diligent::Parsing;
+
+namespace
+{
+
+static constexpr char g_HLSLChunk[] = R"(
+cbuffer cbLights : register(b0)
+{
+    float4 g_LightDir[4];
+    uint   g_NumLights;
+};
+
+Texture2D<float4> g_Albedo;
+SamplerState      g_Albedo_sampler;
+
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+    float2 UV  : TEX_COORD;
+};
+
+// Computes lighting
+float4 ComputeLighting(in PSInput PSIn)
+{
+    float4 Color = g_Albedo.Sample(g_Albedo_sampler, PSIn.UV);
+    [unroll]
+    for (int i = 0; i < 4 && i < int(g_NumLights); ++i)
+    {
+        Color.rgb *= saturate(dot(g_LightDir[i].xyz, float3(0.0, 1.0, 0.0)));
+    }
+    return Color;
+}
+)";
+
+// Arg(0) - the number of times the shader chunk is repeated in the source.
+std::string CreateSource(size_t NumChunks)
+{
+    std::string Source;
+    Source.reserve(NumChunks * sizeof(g_HLSLChunk));
+    for (size_t i = 0; i < NumChunks; ++i)
+        Source += g_HLSLChunk;
+    return Source;
+}
+
+void BM_HLSLTokenizer_Tokenize(benchmark::State& state)
+{
+    const std::string Source = CreateSource(static_cast<size_t>(state.range(0)));
+
+    HLSLTokenizer Tokenizer;
+    for (auto _ : state)
+    {
+        HLSLTokenizer::TokenListType Tokens = Tokenizer.Tokenize(Source);
+        benchmark::DoNotOptimize(Tokens);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(Source.size()));
+}
+BENCHMARK(BM_HLSLTokenizer_Tokenize)->RangeMultiplier(8)->Range(1, 512);
+
+void BM_HLSLTokenizer_TokenizeView(benchmark::State& state)
+{
+    const std::string Source = CreateSource(static_cast<size_t>(state.range(0)));
+
+    HLSLTokenizer Tokenizer;
+    for (auto _ : state)
+    {
+        HLSLTokenizer::TokenViewListType Tokens = Tokenizer.TokenizeView(Source);
+        benchmark::DoNotOptimize(Tokens);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(Source.size()));
+}
+BENCHMARK(BM_HLSLTokenizer_TokenizeView)->RangeMultiplier(8)->Range(1, 512);
+
+} // namespace
@@ -483,6 +483,7 @@ public class DiligentGraphicsEngineTests : IDisposable
 
         var variable = pipeline.GetStaticVariableByName(ShaderType.Vertex, "Constants");
         Assert.NotNull(variable);
+        Assert.Same(variable, pipeline.GetStaticVariableByName(ShaderType.Vertex, "Constants"));
 
         variable.Set(uniformBuffer, SetShaderResourceFlags.None);
 
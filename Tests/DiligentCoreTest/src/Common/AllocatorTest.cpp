@@ -26,11 +26,18 @@
  */
 
 #include <array>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 #include "DefaultRawMemoryAllocator.hpp"
+#include "CountingMemoryAllocator.hpp"
+#include "EngineMemory.h"
 #include "FixedBlockMemoryAllocator.hpp"
 #include "FixedLinearAllocator.hpp"
 #include "DynamicLinearAllocator.hpp"
+#include "FrameArena.hpp"
+#include "LargePageMemoryAllocator.hpp"
 
 #include "gtest/gtest.h"
 
@@ -124,6 +131,156 @@ TEST(Common_FixedBlockMemoryAllocator, UnalignedSize)
     }
 }
 
+TEST(Common_FixedBlockMemoryAllocator, Statistics)
+{
+    constexpr Uint32 AllocSize             = 16;
+    constexpr Uint32 NumAllocationsPerPage = 8;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage};
+
+    std::vector<void*> Allocations;
+    for (Uint32 i = 0; i < NumAllocationsPerPage + 1; ++i)
+        Allocations.push_back(TestAllocator.Allocate(AllocSize, "Fixed block allocator test", __FILE__, __LINE__));
+
+    auto Stats = TestAllocator.GetStatistics();
+    EXPECT_EQ(Stats.BlockSize, AllocSize);
+    EXPECT_EQ(Stats.NumBlocksInPage, NumAllocationsPerPage);
+    EXPECT_EQ(Stats.NumPages, size_t{2});
+    EXPECT_EQ(Stats.NumAllocatedBlocks, size_t{NumAllocationsPerPage + 1});
+    EXPECT_EQ(Stats.NumCachedBlocks, size_t{0});
+    EXPECT_EQ(Stats.PeakNumBlocks, size_t{NumAllocationsPerPage + 1});
+    EXPECT_EQ(Stats.NumThreadCaches, size_t{0});
+
+    for (void* Ptr : Allocations)
+        TestAllocator.Free(Ptr);
+
+    Stats = TestAllocator.GetStatistics();
+    EXPECT_EQ(Stats.NumPages, size_t{2});
+    EXPECT_EQ(Stats.NumAllocatedBlocks, size_t{0});
+    EXPECT_EQ(Stats.PeakNumBlocks, size_t{NumAllocationsPerPage + 1});
+}
+
+TEST(Common_FixedBlockMemoryAllocator, ThreadCache)
+{
+    constexpr Uint32 AllocSize             = 16;
+    constexpr Uint32 NumAllocationsPerPage = 8;
+    constexpr Uint32 ThreadCacheSize       = 4;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, ThreadCacheSize};
+
+    void* pRawMem0 = TestAllocator.Allocate(AllocSize, "Thread cache test", __FILE__, __LINE__);
+
+    // The cache is refilled with half of its size
+    auto Stats = TestAllocator.GetStatistics();
+    EXPECT_EQ(Stats.NumThreadCaches, size_t{1});
+    EXPECT_EQ(Stats.NumAllocatedBlocks, size_t{1});
+    EXPECT_EQ(Stats.NumCachedBlocks, size_t{ThreadCacheSize / 2 - 1});
+
+    // The most recently freed block is reused first
+    TestAllocator.Free(pRawMem0);
+    EXPECT_EQ(TestAllocator.Allocate(AllocSize, "Thread cache test", __FILE__, __LINE__), pRawMem0);
+
+    std::vector<void*> Allocations{pRawMem0};
+    for (Uint32 i = 1; i < NumAllocationsPerPage * 2; ++i)
+        Allocations.push_back(TestAllocator.Allocate(AllocSize, "Thread cache test", __FILE__, __LINE__));
+
+    Stats = TestAllocator.GetStatistics();
+    EXPECT_EQ(Stats.NumPages, size_t{2});
+    EXPECT_EQ(Stats.NumAllocatedBlocks, size_t{NumAllocationsPerPage * 2});
+
+    for (void* Ptr : Allocations)
+        TestAllocator.Free(Ptr);
+
+    // The cache never holds more than ThreadCacheSize blocks
+    Stats = TestAllocator.GetStatistics();
+    EXPECT_EQ(Stats.NumAllocatedBlocks, size_t{0});
+    EXPECT_LE(Stats.NumCachedBlocks, size_t{ThreadCacheSize});
+    EXPECT_GT(Stats.NumCachedBlocks, size_t{0});
+}
+
+TEST(Common_FixedBlockMemoryAllocator, ThreadCache_MultipleThreads)
+{
+    constexpr Uint32 AllocSize             = 32;
+    constexpr Uint32 NumAllocationsPerPage = 16;
+    constexpr Uint32 ThreadCacheSize       = 8;
+    constexpr Uint32 NumThreads            = 8;
+    constexpr Uint32 NumAllocations        = 64;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, ThreadCacheSize};
+
+    // Blocks allocated by one thread are released by another one
+    std::vector<std::vector<void*>> Allocations(NumThreads);
+    for (Uint32 pass = 0; pass < 2; ++pass)
+    {
+        std::vector<std::thread> Threads(NumThreads);
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads[t] = std::thread{
+                [&](Uint32 ThreadId) {
+                    for (Uint32 iter = 0; iter < 16; ++iter)
+                    {
+                        std::vector<void*> Blocks;
+                        for (Uint32 i = 0; i < NumAllocations; ++i)
+                        {
+                            Uint32* pData = static_cast<Uint32*>(TestAllocator.Allocate(AllocSize, "Thread cache test", __FILE__, __LINE__));
+                            *pData        = ThreadId;
+                            Blocks.push_back(pData);
+                        }
+                        for (void* Ptr : Blocks)
+                        {
+                            EXPECT_EQ(*static_cast<Uint32*>(Ptr), ThreadId);
+                            TestAllocator.Free(Ptr);
+                        }
+                    }
+
+                    Allocations[ThreadId].clear();
+                    for (Uint32 i = 0; i < NumAllocations; ++i)
+                        Allocations[ThreadId].push_back(TestAllocator.Allocate(AllocSize, "Thread cache test", __FILE__, __LINE__));
+
+                    // Release the blocks allocated by the previous thread
+                    auto& PrevAllocations = Allocations[(ThreadId + NumThreads - 1) % NumThreads];
+                    for (void* Ptr : PrevAllocations)
+                        TestAllocator.Free(Ptr);
+                    PrevAllocations.clear();
+                },
+                t};
+            // Make sure the blocks of the previous thread have been allocated
+            Threads[t].join();
+        }
+    }
+
+    for (void* Ptr : Allocations[NumThreads - 1])
+        TestAllocator.Free(Ptr);
+
+    // Caches of the threads that have exited are reclaimed when the cache of the
+    // current thread is refilled.
+    void* pRawMem = TestAllocator.Allocate(AllocSize, "Thread cache test", __FILE__, __LINE__);
+
+    auto Stats = TestAllocator.GetStatistics();
+    EXPECT_EQ(Stats.NumThreadCaches, size_t{1});
+    EXPECT_EQ(Stats.NumAllocatedBlocks, size_t{1});
+
+    TestAllocator.Free(pRawMem);
+}
+
+TEST(Common_FixedBlockMemoryAllocator, ThreadCache_ThreadOutlivesAllocator)
+{
+    constexpr Uint32 AllocSize             = 16;
+    constexpr Uint32 NumAllocationsPerPage = 8;
+    constexpr Uint32 ThreadCacheSize       = 4;
+
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, ThreadCacheSize};
+
+        void* pRawMem = TestAllocator.Allocate(AllocSize, "Thread cache test", __FILE__, __LINE__);
+        TestAllocator.Free(pRawMem);
+
+        // The allocator is destroyed while the thread's cache still holds the blocks
+        EXPECT_GT(TestAllocator.GetStatistics().NumCachedBlocks, size_t{0});
+    }
+}
+
 TEST(Common_FixedLinearAllocator, EmptyAllocator)
 {
     FixedLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
@@ -289,4 +446,144 @@ TEST(Common_DynamicLinearAllocator, ObjectConstruction)
     EXPECT_TRUE(reinterpret_cast<size_t>(Allocator.Allocate(200, 64)) % 64 == 0);
 }
 
+TEST(Common_FrameArena, Scope)
+{
+    const void* pFirstData = nullptr;
+    {
+        FrameArena::Scope       Arena;
+        FrameArena::Vector<int> Data{Arena.MakeAllocator<int>()};
+        Data.resize(100, 1);
+        pFirstData = Data.data();
+        EXPECT_EQ(reinterpret_cast<size_t>(pFirstData) % alignof(int), size_t{0});
+
+        {
+            // While the outer scope is alive, the arena is never recycled
+            FrameArena::FinishFrame();
+            FrameArena::Scope       NestedArena;
+            FrameArena::Vector<int> NestedData(100, 2, NestedArena.MakeAllocator<int>());
+            EXPECT_NE(static_cast<const void*>(NestedData.data()), pFirstData);
+            for (int Val : Data)
+                EXPECT_EQ(Val, 1);
+        }
+        EXPECT_EQ(&Arena.GetArena(), &FrameArena::Scope{}.GetArena());
+    }
+
+    {
+        // The frame has been finished - the memory is reused
+        FrameArena::Scope       Arena;
+        FrameArena::Vector<int> Data(100, 3, Arena.MakeAllocator<int>());
+        EXPECT_EQ(static_cast<const void*>(Data.data()), pFirstData);
+    }
+
+    {
+        // The frame has not been finished - the memory is not reused
+        FrameArena::Scope       Arena;
+        FrameArena::Vector<int> Data(100, 3, Arena.MakeAllocator<int>());
+        EXPECT_NE(static_cast<const void*>(Data.data()), pFirstData);
+    }
+}
+
+TEST(Common_FrameArena, Threads)
+{
+    FrameArena::Scope Arena;
+
+    const FrameArena* pThreadArena = nullptr;
+    std::thread       Thread{
+        [&]() {
+            FrameArena::Scope       ThreadArena;
+            FrameArena::Vector<int> Data(16, 1, ThreadArena.MakeAllocator<int>());
+            pThreadArena = &ThreadArena.GetArena();
+        }};
+    Thread.join();
+
+    EXPECT_NE(pThreadArena, &Arena.GetArena());
+}
+
+TEST(Common_LargePageMemoryAllocator, AllocDealloc)
+{
+    LargePageMemoryAllocatorCreateInfo CI;
+    CI.MinVirtualAllocationSize = 64 << 10;
+    LargePageMemoryAllocator Allocator{CI};
+
+    void* pSmall = Allocator.Allocate(256, "Small allocation", __FILE__, __LINE__);
+    ASSERT_NE(pSmall, nullptr);
+    EXPECT_EQ(Allocator.GetVirtualMemorySize(), size_t{0});
+
+    void* pLarge = Allocator.Allocate(100 << 10, "Large allocation", __FILE__, __LINE__);
+    ASSERT_NE(pLarge, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pLarge) % 4096, uintptr_t{0});
+    EXPECT_GE(Allocator.GetVirtualMemorySize(), size_t{100 << 10});
+    memset(pLarge, 0xCD, 100 << 10);
+
+    void* pAligned = Allocator.AllocateAligned(128 << 10, 256, "Large aligned allocation", __FILE__, __LINE__);
+    ASSERT_NE(pAligned, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pAligned) % 256, uintptr_t{0});
+
+    void* pSmallAligned = Allocator.AllocateAligned(1024, 4096, "Small aligned allocation", __FILE__, __LINE__);
+    ASSERT_NE(pSmallAligned, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pSmallAligned) % 4096, uintptr_t{0});
+
+    Allocator.Free(pSmall);
+    Allocator.Free(pLarge);
+    Allocator.FreeAligned(pAligned);
+    Allocator.FreeAligned(pSmallAligned);
+    EXPECT_EQ(Allocator.GetVirtualMemorySize(), size_t{0});
+    EXPECT_EQ(Allocator.GetLargePageMemorySize(), size_t{0});
+}
+
+TEST(Common_LargePageMemoryAllocator, DynamicLinearAllocator)
+{
+    LargePageMemoryAllocator Allocator;
+    {
+        DynamicLinearAllocator LinearAllocator{Allocator, 1 << 20};
+        for (size_t i = 0; i < 64; ++i)
+        {
+            Uint8* pData = LinearAllocator.Allocate<Uint8>(64 << 10);
+            ASSERT_NE(pData, nullptr);
+            pData[0] = static_cast<Uint8>(i);
+        }
+        EXPECT_GE(Allocator.GetVirtualMemorySize(), size_t{4 << 20});
+    }
+    EXPECT_EQ(Allocator.GetVirtualMemorySize(), size_t{0});
+}
+
+TEST(Common_CountingMemoryAllocator, Stats)
+{
+    const MemoryCategoryStats GlobalStats0 = GetMemoryCategoryStats(MEMORY_CATEGORY_STAGING);
+
+    CategoryMemoryAllocators Allocators{DefaultRawMemoryAllocator::GetAllocator()};
+    CountingMemoryAllocator& Allocator = Allocators[MEMORY_CATEGORY_STAGING];
+
+    void* Ptr0 = Allocator.Allocate(100, "Test allocation", __FILE__, __LINE__);
+    void* Ptr1 = Allocator.AllocateAligned(200, 64, "Test aligned allocation", __FILE__, __LINE__);
+    ASSERT_NE(Ptr0, nullptr);
+    ASSERT_NE(Ptr1, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(Ptr1) % 64, uintptr_t{0});
+    memset(Ptr0, 0xCD, 100);
+    memset(Ptr1, 0xCD, 200);
+
+    MemoryCategoryStats Stats = Allocator.GetStats();
+    EXPECT_EQ(Stats.LiveBytes, Uint64{300});
+    EXPECT_EQ(Stats.PeakBytes, Uint64{300});
+    EXPECT_EQ(Stats.LiveAllocations, Uint64{2});
+    EXPECT_EQ(Stats.TotalAllocations, Uint64{2});
+
+    MemoryCategoryStats GlobalStats = GetMemoryCategoryStats(MEMORY_CATEGORY_STAGING);
+    EXPECT_EQ(GlobalStats.LiveBytes, GlobalStats0.LiveBytes + 300);
+    EXPECT_EQ(GlobalStats.TotalAllocations, GlobalStats0.TotalAllocations + 2);
+
+    Allocator.Free(Ptr0);
+    Allocator.FreeAligned(Ptr1);
+
+    Stats = Allocator.GetStats();
+    EXPECT_EQ(Stats.LiveBytes, Uint64{0});
+    EXPECT_EQ(Stats.PeakBytes, Uint64{300});
+    EXPECT_EQ(Stats.LiveAllocations, Uint64{0});
+    EXPECT_EQ(Stats.TotalAllocatedBytes, Uint64{300});
+    EXPECT_EQ(Allocators[MEMORY_CATEGORY_ARCHIVE].GetStats().TotalAllocations, Uint64{0});
+
+    GlobalStats = GetMemoryCategoryStats(MEMORY_CATEGORY_STAGING);
+    EXPECT_EQ(GlobalStats.LiveBytes, GlobalStats0.LiveBytes);
+}
+
 } // namespace
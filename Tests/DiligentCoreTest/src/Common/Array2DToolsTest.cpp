@@ -111,4 +111,146 @@ TEST(Common_Array2DTools, GetArray2DMinMaxValue)
     }
 }
 
+TEST(Common_Array2DTools, GetArray2DSum)
+{
+    FastRandFloat Rnd{0, -100, +100};
+    for (Uint32 test = 0; test < 64; ++test)
+    {
+        const Uint32 Width  = 1 + test % 13;
+        const Uint32 Height = 1 + test / 4;
+        const size_t Stride = Width + test % 3;
+
+        std::vector<float> Data(Stride * Height);
+        for (auto& Val : Data)
+            Val = Rnd();
+
+        double RefSum = 0;
+        for (size_t row = 0; row < Height; ++row)
+        {
+            for (size_t col = 0; col < Width; ++col)
+                RefSum += Data[col + row * Stride];
+        }
+        EXPECT_NEAR(GetArray2DSum(Data.data(), Stride, Width, Height), RefSum, 1e-9);
+    }
+    EXPECT_EQ(GetArray2DSum(nullptr, 0, 0, 0), 0.0);
+}
+
+TEST(Common_Array2DTools, ComputeArray2DHistogram)
+{
+    FastRandFloat Rnd{0, -12, +12};
+    for (Uint32 NumBins : {1u, 7u, 16u})
+    {
+        const Uint32 Width  = 37;
+        const Uint32 Height = 11;
+        const size_t Stride = 40;
+
+        std::vector<float> Data(Stride * Height);
+        for (auto& Val : Data)
+            Val = Rnd();
+        Data[0] = -10;
+        Data[1] = 10;
+
+        constexpr float RangeMin = -10;
+        constexpr float RangeMax = 10;
+
+        std::vector<Uint32> RefBins(NumBins);
+        for (size_t row = 0; row < Height; ++row)
+        {
+            for (size_t col = 0; col < Width; ++col)
+            {
+                const float Val = Data[col + row * Stride];
+                const float Bin = (Val - RangeMin) * static_cast<float>(NumBins) / (RangeMax - RangeMin);
+                ++RefBins[std::min(static_cast<Uint32>(std::max(Bin, 0.f)), NumBins - 1)];
+            }
+        }
+
+        std::vector<Uint32> Bins(NumBins, 123);
+        ComputeArray2DHistogram(Data.data(), Stride, Width, Height, RangeMin, RangeMax, NumBins, Bins.data());
+        EXPECT_EQ(Bins, RefBins);
+    }
+}
+
+TEST(Common_Array2DTools, GetArray2DTileMinMaxValues)
+{
+    FastRandFloat Rnd{0, -100, +100};
+    for (Uint32 TileSize : {1u, 3u, 4u, 16u})
+    {
+        for (Uint32 test = 0; test < 16; ++test)
+        {
+            const Uint32 Width  = 13 + test * 3;
+            const Uint32 Height = 5 + test * 2;
+            const size_t Stride = Width + test % 4;
+
+            std::vector<float> Data(Stride * Height);
+            for (auto& Val : Data)
+                Val = Rnd();
+
+            const Uint32 NumTilesX = (Width + TileSize - 1) / TileSize;
+            const Uint32 NumTilesY = (Height + TileSize - 1) / TileSize;
+            const size_t DstStride = NumTilesX + 1;
+
+            std::vector<float> Min(DstStride * NumTilesY);
+            std::vector<float> Max(DstStride * NumTilesY);
+            GetArray2DTileMinMaxValues(Data.data(), Stride, Width, Height, TileSize, Min.data(), Max.data(), DstStride);
+
+            for (Uint32 ty = 0; ty < NumTilesY; ++ty)
+            {
+                for (Uint32 tx = 0; tx < NumTilesX; ++tx)
+                {
+                    const Uint32 TileW = std::min(TileSize, Width - tx * TileSize);
+                    const Uint32 TileH = std::min(TileSize, Height - ty * TileSize);
+
+                    float RefMin, RefMax;
+                    GetArray2DMinMaxValue(&Data[tx * TileSize + ty * TileSize * Stride], Stride, TileW, TileH, RefMin, RefMax);
+                    EXPECT_EQ(Min[tx + ty * DstStride], RefMin) << "tx=" << tx << " ty=" << ty;
+                    EXPECT_EQ(Max[tx + ty * DstStride], RefMax) << "tx=" << tx << " ty=" << ty;
+                }
+            }
+        }
+    }
+}
+
+TEST(Common_Array2DTools, ComputeArray2DMinMaxMip)
+{
+    FastRandFloat Rnd{0, -100, +100};
+    for (Uint32 FineWidth = 1; FineWidth <= 19; ++FineWidth)
+    {
+        for (Uint32 FineHeight : {1u, 2u, 5u, 8u})
+        {
+            const size_t FineStride = FineWidth + 2;
+
+            std::vector<float> FineMin(FineStride * FineHeight);
+            std::vector<float> FineMax(FineStride * FineHeight);
+            for (size_t i = 0; i < FineMin.size(); ++i)
+            {
+                FineMin[i] = Rnd();
+                FineMax[i] = FineMin[i] + 10;
+            }
+
+            const Uint32 CoarseWidth  = (FineWidth + 1) / 2;
+            const Uint32 CoarseHeight = (FineHeight + 1) / 2;
+            const size_t CoarseStride = CoarseWidth + 1;
+
+            std::vector<float> CoarseMin(CoarseStride * CoarseHeight);
+            std::vector<float> CoarseMax(CoarseStride * CoarseHeight);
+            ComputeArray2DMinMaxMip(FineMin.data(), FineMax.data(), FineStride, FineWidth, FineHeight, CoarseMin.data(), CoarseMax.data(), CoarseStride);
+
+            for (Uint32 y = 0; y < CoarseHeight; ++y)
+            {
+                for (Uint32 x = 0; x < CoarseWidth; ++x)
+                {
+                    const Uint32 BlockW = std::min(2u, FineWidth - x * 2);
+                    const Uint32 BlockH = std::min(2u, FineHeight - y * 2);
+
+                    float RefMin, RefMax, Unused;
+                    GetArray2DMinMaxValue(&FineMin[x * 2 + y * 2 * FineStride], FineStride, BlockW, BlockH, RefMin, Unused);
+                    GetArray2DMinMaxValue(&FineMax[x * 2 + y * 2 * FineStride], FineStride, BlockW, BlockH, Unused, RefMax);
+                    EXPECT_EQ(CoarseMin[x + y * CoarseStride], RefMin) << "x=" << x << " y=" << y;
+                    EXPECT_EQ(CoarseMax[x + y * CoarseStride], RefMax) << "x=" << x << " y=" << y;
+                }
+            }
+        }
+    }
+}
+
 } // namespace
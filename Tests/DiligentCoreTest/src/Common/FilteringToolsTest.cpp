@@ -27,6 +27,10 @@
 
 #include "FilteringTools.hpp"
 
+#include <vector>
+
+#include "FastRand.hpp"
+
 #include "gtest/gtest.h"
 
 using namespace Diligent;
@@ -292,4 +296,60 @@ TEST(Common_FilteringTools, FilterTexture2DBilinear)
     }
 }
 
+template <typename SrcType>
+void TestFilterTexture2DBilinearClampBatch(Uint32 Width, Uint32 Height, float MaxVal)
+{
+    const size_t Stride = Width + 3;
+
+    FastRandFloat RndVal{0, 0, MaxVal};
+
+    std::vector<SrcType> Data(Stride * Height);
+    for (SrcType& Val : Data)
+        Val = static_cast<SrcType>(RndVal());
+
+    // Include out-of-range coordinates to test clamping
+    FastRandFloat       RndUV{1, -0.25f, 1.25f};
+    std::vector<float2> UVs(103);
+    for (float2& UV : UVs)
+        UV = float2{RndUV(), RndUV()};
+    UVs[0] = float2{-3.f, 4.f};
+    UVs[1] = float2{0, 1};
+
+    std::vector<float2> UCs(UVs.size());
+    for (size_t i = 0; i < UVs.size(); ++i)
+        UCs[i] = UVs[i] * float2{static_cast<float>(Width), static_cast<float>(Height)};
+
+    std::vector<float> Res(UVs.size());
+    FilterTexture2DBilinearClamp(Width, Height, Data.data(), Stride, UVs.data(), Res.data(), UVs.size());
+    for (size_t i = 0; i < UVs.size(); ++i)
+    {
+        const float Ref = FilterTexture2DBilinearClamp<SrcType, float>(Width, Height, Data.data(), Stride, UVs[i].x, UVs[i].y);
+        EXPECT_NEAR(Res[i], Ref, MaxVal * 1e-5f) << "u=" << UVs[i].x << " v=" << UVs[i].y;
+    }
+
+    FilterTexture2DBilinearClampUC(Width, Height, Data.data(), Stride, UCs.data(), Res.data(), UCs.size());
+    for (size_t i = 0; i < UCs.size(); ++i)
+    {
+        const float Ref = FilterTexture2DBilinearClampUC<SrcType, float>(Width, Height, Data.data(), Stride, UCs[i].x, UCs[i].y);
+        EXPECT_NEAR(Res[i], Ref, MaxVal * 1e-5f) << "u=" << UCs[i].x << " v=" << UCs[i].y;
+    }
+
+    FilterTexture2DBilinear<SrcType, float, TEXTURE_ADDRESS_WRAP, TEXTURE_ADDRESS_MIRROR, true>(Width, Height, Data.data(), Stride, UVs.data(), Res.data(), UVs.size());
+    for (size_t i = 2; i < UVs.size(); ++i)
+    {
+        const float Ref = FilterTexture2DBilinear<SrcType, float, TEXTURE_ADDRESS_WRAP, TEXTURE_ADDRESS_MIRROR, true>(Width, Height, Data.data(), Stride, UVs[i].x, UVs[i].y);
+        EXPECT_EQ(Res[i], Ref) << "u=" << UVs[i].x << " v=" << UVs[i].y;
+    }
+}
+
+TEST(Common_FilteringTools, FilterTexture2DBilinearClampBatch)
+{
+    for (Uint32 Size : {1u, 2u, 7u, 64u})
+    {
+        TestFilterTexture2DBilinearClampBatch<Uint8>(Size, Size + 1, 255.f);
+        TestFilterTexture2DBilinearClampBatch<Uint16>(Size + 1, Size, 65535.f);
+        TestFilterTexture2DBilinearClampBatch<float>(Size, Size, 1000.f);
+    }
+}
+
 } // namespace
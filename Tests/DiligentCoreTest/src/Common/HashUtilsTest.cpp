@@ -775,7 +775,7 @@ TEST(Common_HashUtils, ShadingRateAttachmentXXH128Hash)
 template <template <typename T> class HelperType>
 void TestSubpassDescHasher()
 {
-    ASSERT_SIZEOF64(SubpassDesc, 72, "Did you add new members to SubpassDesc? Please update the tests.");
+    ASSERT_SIZEOF64(SubpassDesc, 80, "Did you add new members to SubpassDesc? Please update the tests.");
     DEFINE_HELPER(SubpassDesc);
 
     constexpr AttachmentReference Inputs[] =
@@ -822,6 +822,8 @@ void TestSubpassDescHasher()
 
     constexpr ShadingRateAttachment SRA{{5, RESOURCE_STATE_SHADING_RATE}, 32, 64};
     TEST_VALUE(pShadingRateAttachment, &SRA);
+
+    TEST_RANGE(ViewMask, 1u, 32u);
 }
 
 TEST(Common_HashUtils, SubpassDescStdHash)
@@ -1204,6 +1206,23 @@ void TestPipelineStateCIHasher()
     std::array<IPipelineResourceSignature*, MAX_RESOURCE_SIGNATURES> ppSignatures{};
     Helper.Get().ppResourceSignatures = ppSignatures.data();
     TEST_RANGE(ResourceSignaturesCount, 1u, MAX_RESOURCE_SIGNATURES);
+
+    const Uint32 SpecData[]  = {1, 2};
+    const Uint32 SpecData2[] = {1, 3};
+
+    const SpecializationConstant SpecConsts[] = {
+        {"Const0", SHADER_TYPE_VERTEX, sizeof(Uint32), &SpecData[0]},
+        {"Const1", SHADER_TYPE_PIXEL, sizeof(Uint32), &SpecData[1]},
+    };
+    const SpecializationConstant SpecConsts2[] = {
+        {"Const0", SHADER_TYPE_VERTEX, sizeof(Uint32), &SpecData2[0]},
+        {"Const1", SHADER_TYPE_PIXEL, sizeof(Uint32), &SpecData2[1]},
+    };
+    Helper.Get().pSpecializationConstants = SpecConsts;
+    TEST_RANGE(NumSpecializationConstants, 1u, Uint32{_countof(SpecConsts)});
+
+    Helper.Get().pSpecializationConstants = SpecConsts2;
+    Helper.Add("pSpecializationConstants[1].pData");
 }
 
 TEST(Common_HashUtils, PipelineStateCIStdHash)
@@ -27,6 +27,10 @@
 #include "ImageTools.h"
 
 #include <cmath>
+#include <vector>
+
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 #include <array>
@@ -243,4 +247,90 @@ TEST(Common_ImageTools, ComputeImageDifference)
     }
 }
 
+TEST(Common_ImageTools, ComputeImageDifferenceRGBA)
+{
+    constexpr Uint32 Width  = 1031;
+    constexpr Uint32 Height = 67;
+    constexpr Uint32 Stride = Width * 4 + 5;
+
+    std::vector<Uint8> Image1(Stride * Height);
+    std::vector<Uint8> Image2(Stride * Height);
+
+    FastRandInt rnd{0, 0, 255};
+    for (size_t i = 0; i < Image1.size(); ++i)
+    {
+        Image1[i] = static_cast<Uint8>(rnd());
+        // Keep about half of the pixels equal
+        Image2[i] = (i / 4) % 2 == 0 ? Image1[i] : static_cast<Uint8>(rnd());
+    }
+
+    constexpr Uint32 Threshold = 100;
+
+    ImageDiffInfo      RefDiff;
+    std::vector<Uint8> RefDiffImage(Width * Height * 4);
+    double             SumDiff   = 0;
+    double             SumSqDiff = 0;
+    for (Uint32 row = 0; row < Height; ++row)
+    {
+        for (Uint32 col = 0; col < Width; ++col)
+        {
+            Uint32 PixelDiff = 0;
+            for (Uint32 ch = 0; ch < 4; ++ch)
+            {
+                const size_t Offset      = row * Stride + col * 4 + ch;
+                const Uint32 ChannelDiff = static_cast<Uint32>(std::abs(int{Image1[Offset]} - int{Image2[Offset]}));
+                PixelDiff                = std::max(PixelDiff, ChannelDiff);
+
+                RefDiffImage[(row * Width + col) * 4 + ch] = static_cast<Uint8>(ChannelDiff);
+            }
+            if (PixelDiff != 0)
+            {
+                ++RefDiff.NumDiffPixels;
+                RefDiff.NumDiffPixelsAboveThreshold += PixelDiff > Threshold ? 1 : 0;
+                RefDiff.MaxDiff = std::max(RefDiff.MaxDiff, PixelDiff);
+                SumDiff += PixelDiff;
+                SumSqDiff += PixelDiff * PixelDiff;
+            }
+        }
+    }
+    RefDiff.AvgDiff = static_cast<float>(SumDiff / RefDiff.NumDiffPixels);
+    RefDiff.RmsDiff = static_cast<float>(std::sqrt(SumSqDiff / RefDiff.NumDiffPixels));
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        std::vector<Uint8> DiffImage(Width * Height * 4);
+
+        ComputeImageDifferenceAttribs Attribs;
+        Attribs.Width        = Width;
+        Attribs.Height       = Height;
+        Attribs.pImage1      = Image1.data();
+        Attribs.NumChannels1 = 4;
+        Attribs.Stride1      = Stride;
+        Attribs.pImage2      = Image2.data();
+        Attribs.NumChannels2 = 4;
+        Attribs.Stride2      = Stride;
+        Attribs.Threshold    = Threshold;
+        Attribs.pDiffImage   = DiffImage.data();
+        Attribs.DiffStride   = Width * 4;
+        Attribs.pThreadPool  = pPool;
+
+        ImageDiffInfo Diff;
+        ComputeImageDifference(Attribs, Diff);
+        EXPECT_EQ(Diff.NumDiffPixels, RefDiff.NumDiffPixels);
+        EXPECT_EQ(Diff.NumDiffPixelsAboveThreshold, RefDiff.NumDiffPixelsAboveThreshold);
+        EXPECT_EQ(Diff.MaxDiff, RefDiff.MaxDiff);
+        EXPECT_FLOAT_EQ(Diff.AvgDiff, RefDiff.AvgDiff);
+        EXPECT_FLOAT_EQ(Diff.RmsDiff, RefDiff.RmsDiff);
+        EXPECT_EQ(DiffImage, RefDiffImage);
+
+        // Early exit
+        Attribs.pDiffImage          = nullptr;
+        Attribs.EarlyExitPixelCount = 10;
+        ComputeImageDifference(Attribs, Diff);
+        EXPECT_GE(Diff.NumDiffPixelsAboveThreshold, 10u);
+        EXPECT_LT(Diff.NumDiffPixelsAboveThreshold, RefDiff.NumDiffPixelsAboveThreshold);
+    }
+}
+
 } // namespace
@@ -183,4 +183,83 @@ TEST(Common_LRUCache, Exceptions)
     }
 }
 
+
+TEST(Common_ShardedLRUCache, Get)
+{
+    ShardedLRUCache<int, CacheData, std::hash<int>, 8> Cache{64};
+
+    constexpr Uint32                    NumThreads = 16;
+    constexpr Uint32                    NumKeys    = 32;
+    std::vector<std::thread>            Threads(NumThreads);
+    std::vector<std::vector<CacheData>> ThreadsData(NumThreads);
+
+    Threading::Signal StartSignal;
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        ThreadsData[i].resize(NumKeys);
+
+        Threads[i] = std::thread(
+            [&](Uint32 ThreadId) {
+                StartSignal.Wait();
+
+                auto& Data = ThreadsData[ThreadId];
+                for (Uint32 key = 0; key < NumKeys; ++key)
+                {
+                    // Get data with the same keys from all threads
+                    Data[key] = Cache.Get(key,
+                                          [&](CacheData& Data, size_t& Size) //
+                                          {
+                                              Data.Value = ThreadId;
+                                              Size       = 1;
+                                          });
+                }
+            },
+            i);
+    }
+    StartSignal.Trigger(true);
+
+    for (auto& T : Threads)
+        T.join();
+
+    // All keys fit into the cache, so every key must have been initialized exactly once
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{NumKeys});
+    for (Uint32 key = 0; key < NumKeys; ++key)
+    {
+        for (size_t i = 1; i < ThreadsData.size(); ++i)
+        {
+            EXPECT_EQ(ThreadsData[0][key].Value, ThreadsData[i][key].Value) << "key=" << key;
+        }
+    }
+}
+
+
+TEST(Common_ShardedLRUCache, Eviction)
+{
+    constexpr size_t MaxSize = 16;
+
+    ShardedLRUCache<int, CacheData, std::hash<int>, 4> Cache{MaxSize};
+    static_assert(decltype(Cache)::GetNumShards() == 4, "Unexpected number of shards");
+
+    for (Uint32 i = 0; i < 1024; ++i)
+    {
+        auto Data = Cache.Get(i,
+                              [&](CacheData& Data, size_t& Size) //
+                              {
+                                  Data.Value = i;
+                                  Size       = 1;
+                              });
+        EXPECT_EQ(Data.Value, i);
+        EXPECT_LE(Cache.GetCurrSize(), MaxSize);
+    }
+
+    // The most recently used item must be in the cache
+    auto Data = Cache.Get(1023,
+                          [&](CacheData& Data, size_t& Size) //
+                          {
+                              Data.Value = ~0u;
+                              Size       = 1;
+                          });
+    EXPECT_EQ(Data.Value, 1023u);
+}
+
 } // namespace
@@ -0,0 +1,167 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "LZ4Compression.hpp"
+
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<Uint8> GenerateData(size_t Size, Uint32 Seed, Uint32 NumSymbols)
+{
+    std::mt19937                          Gen{Seed};
+    std::uniform_int_distribution<Uint32> Distr{0, NumSymbols - 1};
+
+    std::vector<Uint8> Data(Size);
+    for (auto& Byte : Data)
+        Byte = static_cast<Uint8>(Distr(Gen));
+    return Data;
+}
+
+void TestRoundTrip(const std::vector<Uint8>& Src, const std::vector<Uint8>& Dict = {})
+{
+    std::vector<Uint8> Compressed(LZ4GetMaxCompressedSize(Src.size()));
+
+    const size_t CompressedSize = LZ4CompressBlock(Src.data(), Src.size(), Compressed.data(), Compressed.size(), Dict.data(), Dict.size());
+    ASSERT_GT(CompressedSize, size_t{0});
+    ASSERT_LE(CompressedSize, Compressed.size());
+
+    std::vector<Uint8> Decompressed(Src.size());
+    EXPECT_TRUE(LZ4DecompressBlock(Compressed.data(), CompressedSize, Decompressed.data(), Decompressed.size(), Dict.data(), Dict.size()));
+    EXPECT_EQ(Decompressed, Src);
+}
+
+TEST(Common_LZ4Compression, RoundTrip)
+{
+    TestRoundTrip({});
+    for (size_t Size : {1, 4, 5, 11, 12, 13, 16, 64, 255, 256, 1000, 65535, 65536, 70000, 300000})
+    {
+        TestRoundTrip(GenerateData(Size, static_cast<Uint32>(Size), 256));
+        TestRoundTrip(GenerateData(Size, static_cast<Uint32>(Size), 4));
+        TestRoundTrip(std::vector<Uint8>(Size, 0x5A));
+    }
+}
+
+TEST(Common_LZ4Compression, CompressionRatio)
+{
+    std::string Text;
+    for (int i = 0; Text.size() < 16384; ++i)
+        Text += "float4 main(in PSInput PSIn) : SV_Target { return PSIn.Color * " + std::to_string(i % 7) + "; }\n";
+
+    std::vector<Uint8> Compressed(LZ4GetMaxCompressedSize(Text.size()));
+
+    const size_t CompressedSize = LZ4CompressBlock(Text.data(), Text.size(), Compressed.data(), Compressed.size());
+    ASSERT_GT(CompressedSize, size_t{0});
+    EXPECT_LT(CompressedSize, Text.size() / 4);
+
+    std::string Decompressed(Text.size(), '\0');
+    EXPECT_TRUE(LZ4DecompressBlock(Compressed.data(), CompressedSize, &Decompressed[0], Decompressed.size()));
+    EXPECT_EQ(Decompressed, Text);
+
+    // Destination buffer is too small
+    EXPECT_EQ(LZ4CompressBlock(Text.data(), Text.size(), Compressed.data(), CompressedSize - 1), size_t{0});
+}
+
+TEST(Common_LZ4Compression, Dictionary)
+{
+    const std::vector<Uint8> Common = GenerateData(2048, 0, 256);
+
+    std::vector<std::vector<Uint8>>              Samples;
+    std::vector<std::pair<const void*, size_t>> SamplePtrs;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        // Every sample contains the same block surrounded by unique data
+        std::vector<Uint8> Sample = GenerateData(512, 100 + i, 256);
+        Sample.insert(Sample.end(), Common.begin(), Common.end());
+        const auto Tail = GenerateData(512, 200 + i, 256);
+        Sample.insert(Sample.end(), Tail.begin(), Tail.end());
+        Samples.emplace_back(std::move(Sample));
+    }
+    for (const auto& Sample : Samples)
+        SamplePtrs.emplace_back(Sample.data(), Sample.size());
+
+    const std::vector<Uint8> Dict = LZ4TrainDictionary(SamplePtrs, 4096);
+    ASSERT_FALSE(Dict.empty());
+    EXPECT_LE(Dict.size(), size_t{4096});
+
+    for (const auto& Sample : Samples)
+    {
+        TestRoundTrip(Sample, Dict);
+
+        std::vector<Uint8> Compressed(LZ4GetMaxCompressedSize(Sample.size()));
+
+        const size_t SizeNoDict   = LZ4CompressBlock(Sample.data(), Sample.size(), Compressed.data(), Compressed.size());
+        const size_t SizeWithDict = LZ4CompressBlock(Sample.data(), Sample.size(), Compressed.data(), Compressed.size(), Dict.data(), Dict.size());
+        EXPECT_LT(SizeWithDict + Common.size() / 2, SizeNoDict);
+    }
+
+    // Dictionary larger than the maximum size
+    TestRoundTrip(Samples[0], GenerateData(LZ4MaxDictionarySize + 1000, 1, 16));
+
+    EXPECT_TRUE(LZ4TrainDictionary({}).empty());
+}
+
+TEST(Common_LZ4Compression, InvalidData)
+{
+    const std::vector<Uint8> Src = GenerateData(4096, 7, 8);
+    std::vector<Uint8>       Compressed(LZ4GetMaxCompressedSize(Src.size()));
+
+    const size_t CompressedSize = LZ4CompressBlock(Src.data(), Src.size(), Compressed.data(), Compressed.size());
+    ASSERT_GT(CompressedSize, size_t{0});
+    Compressed.resize(CompressedSize);
+
+    std::vector<Uint8> Dst(Src.size());
+
+    // Wrong decompressed size
+    EXPECT_FALSE(LZ4DecompressBlock(Compressed.data(), Compressed.size(), Dst.data(), Dst.size() - 1));
+    EXPECT_FALSE(LZ4DecompressBlock(Compressed.data(), Compressed.size(), Dst.data(), Dst.size() + 1));
+
+    // Truncated data
+    for (size_t Size = 0; Size < Compressed.size(); Size += 97)
+        EXPECT_FALSE(LZ4DecompressBlock(Compressed.data(), Size, Dst.data(), Dst.size()));
+
+    // Corrupted data must never result in out-of-bounds access
+    std::mt19937 Gen{0};
+    for (Uint32 i = 0; i < 1000; ++i)
+    {
+        std::vector<Uint8> Corrupted = Compressed;
+        Corrupted[Gen() % Corrupted.size()] ^= static_cast<Uint8>(1u + Gen() % 255u);
+        LZ4DecompressBlock(Corrupted.data(), Corrupted.size(), Dst.data(), Dst.size());
+    }
+
+    // Match that references non-existent dictionary data
+    const Uint8 BadOffset[] = {0x10, 'a', 0x10, 0x00, 0x00};
+    EXPECT_FALSE(LZ4DecompressBlock(BadOffset, sizeof(BadOffset), Dst.data(), 6));
+}
+
+} // namespace
@@ -27,9 +27,13 @@
 
 #include <climits>
 #include <sstream>
+#include <random>
 
 #include "BasicMath.hpp"
 #include "AdvancedMath.hpp"
+#include "Timer.hpp"
+#include "Errors.hpp"
+#include "ThreadPool.hpp"
 
 #include "gtest/gtest.h"
 
@@ -1676,6 +1680,166 @@ TEST(Common_BasicMath, MatrixOpeartorMinusEqual)
 }
 
 
+// Scalar reference implementations used to validate the SIMD code path (DILIGENT_MATH_SIMD)
+float4x4 RefMul(const float4x4& m1, const float4x4& m2)
+{
+    float4x4 r;
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            float s = 0;
+            for (int k = 0; k < 4; ++k)
+                s += m1.m[i][k] * m2.m[k][j];
+            r.m[i][j] = s;
+        }
+    }
+    return r;
+}
+
+float4 RefMul(const float4& v, const float4x4& m)
+{
+    float4 r;
+    for (int j = 0; j < 4; ++j)
+        r[j] = v.x * m.m[0][j] + v.y * m.m[1][j] + v.z * m.m[2][j] + v.w * m.m[3][j];
+    return r;
+}
+
+float4 RefMul(const float4x4& m, const float4& v)
+{
+    float4 r;
+    for (int i = 0; i < 4; ++i)
+        r[i] = m.m[i][0] * v.x + m.m[i][1] * v.y + m.m[i][2] * v.z + m.m[i][3] * v.w;
+    return r;
+}
+
+class RandomMathValues
+{
+public:
+    float operator()()
+    {
+        return m_Distr(m_Gen);
+    }
+
+    float4 Vector()
+    {
+        return float4{(*this)(), (*this)(), (*this)(), (*this)()};
+    }
+
+    float4x4 Matrix()
+    {
+        float4x4 m;
+        for (int i = 0; i < 16; ++i)
+            m.Data()[i] = (*this)();
+        return m;
+    }
+
+private:
+    std::mt19937                          m_Gen{0};
+    std::uniform_real_distribution<float> m_Distr{-10.f, 10.f};
+};
+
+TEST(Common_BasicMath, SIMDConformance)
+{
+    RandomMathValues Rnd;
+    for (int iter = 0; iter < 1000; ++iter)
+    {
+        const float4x4 m1 = Rnd.Matrix();
+        const float4x4 m2 = Rnd.Matrix();
+        const float4   v1 = Rnd.Vector();
+        const float4   v2 = Rnd.Vector() + float4{20, 20, 20, 20};
+        const float    s  = Rnd();
+
+        EXPECT_EQ(m1 * m2, RefMul(m1, m2));
+        EXPECT_EQ(v1 * m1, RefMul(v1, m1));
+        EXPECT_EQ(m1 * v1, RefMul(m1, v1));
+
+        EXPECT_EQ(v1 + v2, (float4{v1.x + v2.x, v1.y + v2.y, v1.z + v2.z, v1.w + v2.w}));
+        EXPECT_EQ(v1 - v2, (float4{v1.x - v2.x, v1.y - v2.y, v1.z - v2.z, v1.w - v2.w}));
+        EXPECT_EQ(v1 * v2, (float4{v1.x * v2.x, v1.y * v2.y, v1.z * v2.z, v1.w * v2.w}));
+        EXPECT_EQ(v1 / v2, (float4{v1.x / v2.x, v1.y / v2.y, v1.z / v2.z, v1.w / v2.w}));
+        EXPECT_EQ(v1 * s, (float4{v1.x * s, v1.y * s, v1.z * s, v1.w * s}));
+
+        const float4x4 t = m1.Transpose();
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+                EXPECT_EQ(t.m[i][j], m1.m[j][i]);
+        }
+
+        const float4 a = v1;
+        const float4 b = v2;
+        const float4 q{
+            +a.x * b.w + a.y * b.z - a.z * b.y + a.w * b.x,
+            -a.x * b.z + a.y * b.w + a.z * b.x + a.w * b.y,
+            +a.x * b.y - a.y * b.x + a.z * b.w + a.w * b.z,
+            -a.x * b.x - a.y * b.y - a.z * b.z + a.w * b.w,
+        };
+        EXPECT_EQ((QuaternionF{a} * QuaternionF{b}).q, q);
+
+        // Compare the inverse with the double-precision reference
+        const double4x4 RefInv = m1.Recast<double>().Inverse();
+        const float4x4  Inv    = m1.Inverse();
+        const double    Scale  = std::max(std::abs(RefInv.Data()[0]), 1.0);
+        for (int i = 0; i < 16; ++i)
+            EXPECT_NEAR(Inv.Data()[i], RefInv.Data()[i], Scale * 1e-3) << iter;
+    }
+}
+
+// Compares the performance of the float4x4 operations with the scalar reference
+TEST(Common_BasicMath, Benchmark)
+{
+    constexpr size_t NumMatrices   = 1024;
+    constexpr int    NumIterations = 256;
+
+    RandomMathValues      Rnd;
+    std::vector<float4x4> Matrices(NumMatrices);
+    std::vector<float4>   Vectors(NumMatrices);
+    for (size_t i = 0; i < NumMatrices; ++i)
+    {
+        Matrices[i] = Rnd.Matrix();
+        Vectors[i]  = Rnd.Vector();
+    }
+
+    float Checksum = 0;
+
+    auto Measure = [&](const auto& Op) {
+        Timer T;
+        for (int iter = 0; iter < NumIterations; ++iter)
+        {
+            for (size_t i = 0; i + 1 < NumMatrices; ++i)
+                Checksum += Op(i);
+        }
+        return T.GetElapsedTime() * 1e9 / (NumIterations * (NumMatrices - 1));
+    };
+
+    // clang-format off
+    const double RefMatMul = Measure([&](size_t i) { return RefMul(Matrices[i], Matrices[i + 1]).m[3][3]; });
+    const double MatMul    = Measure([&](size_t i) { return (Matrices[i] * Matrices[i + 1]).m[3][3]; });
+    const double RefVecMul = Measure([&](size_t i) { return RefMul(Vectors[i], Matrices[i + 1]).w; });
+    const double VecMul    = Measure([&](size_t i) { return (Vectors[i] * Matrices[i + 1]).w; });
+    const double Inverse   = Measure([&](size_t i) { return Matrices[i].Inverse().m[3][3]; });
+    // clang-format on
+
+    // Prevent the compiler from optimizing the computations away
+    volatile float Sink = Checksum;
+    (void)Sink;
+
+    LOG_INFO_MESSAGE("float4x4 operations (ns per op, SIMD ",
+#if DILIGENT_MATH_SIMD_ENABLED
+                     "enabled",
+#else
+                     "disabled",
+#endif
+                     "):",
+                     "\n    Reference Mul:     ", RefMatMul,
+                     "\n    Mul:               ", MatMul,
+                     "\n    Reference Vec*Mat: ", RefVecMul,
+                     "\n    Vec*Mat:           ", VecMul,
+                     "\n    Inverse:           ", Inverse);
+}
+
+
 TEST(Common_AdvancedMath, Planes)
 {
     Plane3D plane = {};
@@ -1933,6 +2097,88 @@ static void TestLineTrace(float2 Start, float2 End, const std::initializer_list<
     }
 }
 
+TEST(Common_AdvancedMath, IntersectRayPacket)
+{
+    std::mt19937                          Gen{0};
+    std::uniform_real_distribution<float> Distr{-10.f, 10.f};
+
+    auto RandomVector = [&]() {
+        return float3{Distr(Gen), Distr(Gen), Distr(Gen)};
+    };
+
+    for (Uint32 NumRays : {1u, 3u, 4u, 8u, 13u, 32u})
+    {
+        for (int iter = 0; iter < 100; ++iter)
+        {
+            std::vector<float3> Origins(NumRays);
+            std::vector<float3> Directions(NumRays);
+            for (Uint32 ray = 0; ray < NumRays; ++ray)
+            {
+                Origins[ray]    = RandomVector();
+                Directions[ray] = RandomVector();
+            }
+            // Rays parallel to the box faces
+            Directions[0].x = 0;
+            Directions[NumRays / 2].y = 0;
+
+            const float3 BoxMin = RandomVector();
+            const float3 BoxMax = BoxMin + abs(RandomVector());
+
+            std::vector<float> EnterDist(NumRays), ExitDist(NumRays);
+            const Uint32       HitMask = IntersectRayPacketAABB(Origins.data(), Directions.data(), NumRays, BoundBox{BoxMin, BoxMax}, EnterDist.data(), ExitDist.data());
+            for (Uint32 ray = 0; ray < NumRays; ++ray)
+            {
+                float      RefEnter = 0, RefExit = 0;
+                const bool RefHit   = IntersectRayBox3D(Origins[ray], Directions[ray], BoxMin, BoxMax, RefEnter, RefExit);
+                EXPECT_EQ((HitMask & (1u << ray)) != 0, RefHit);
+                EXPECT_EQ(EnterDist[ray], RefEnter);
+                EXPECT_EQ(ExitDist[ray], RefExit);
+            }
+
+            const float3 V0 = RandomVector();
+            const float3 V1 = RandomVector();
+            const float3 V2 = RandomVector();
+            for (bool CullBackFace : {false, true})
+            {
+                std::vector<float> Dist(NumRays);
+                IntersectRayPacketTriangle(V0, V1, V2, Origins.data(), Directions.data(), NumRays, Dist.data(), CullBackFace);
+                for (Uint32 ray = 0; ray < NumRays; ++ray)
+                    EXPECT_EQ(Dist[ray], IntersectRayTriangle(V0, V1, V2, Origins[ray], Directions[ray], CullBackFace));
+            }
+        }
+    }
+
+    for (Uint32 NumTriangles : {1u, 5u, 8u, 100u})
+    {
+        std::vector<float3> Verts(NumTriangles * 3);
+        for (float3& Vert : Verts)
+            Vert = RandomVector();
+
+        for (int iter = 0; iter < 100; ++iter)
+        {
+            const float3 Origin    = RandomVector();
+            const float3 Direction = RandomVector();
+
+            float  RefDist = FLT_MAX;
+            Uint32 RefTri  = ~0u;
+            for (Uint32 tri = 0; tri < NumTriangles; ++tri)
+            {
+                const float t = IntersectRayTriangle(Verts[tri * 3 + 0], Verts[tri * 3 + 1], Verts[tri * 3 + 2], Origin, Direction);
+                if (t >= 0 && t < RefDist)
+                {
+                    RefDist = t;
+                    RefTri  = tri;
+                }
+            }
+
+            float        Dist = FLT_MAX;
+            const Uint32 Tri  = IntersectRayTriangles(Origin, Direction, Verts.data(), NumTriangles, Dist);
+            EXPECT_EQ(Tri, RefTri);
+            EXPECT_EQ(Dist, RefDist);
+        }
+    }
+}
+
 TEST(Common_AdvancedMath, TraceLineThroughGrid)
 {
     // Horizontal direction
@@ -2904,6 +3150,55 @@ TEST(Common_AdvancedMath, GetOrientedBoxVisibilityAgainstPlane)
     }
 }
 
+TEST(Common_AdvancedMath, GetBoxesVisibility)
+{
+    ViewFrustumExt Frustum;
+    {
+        const float4x4 View = float4x4::RotationY(0.3f) * float4x4::Translation(1, -2, 15);
+        const float4x4 Proj = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 50.f, false);
+        ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+    }
+
+    constexpr size_t NumBoxes = 100003;
+
+    std::vector<float> MinX(NumBoxes), MinY(NumBoxes), MinZ(NumBoxes);
+    std::vector<float> MaxX(NumBoxes), MaxY(NumBoxes), MaxZ(NumBoxes);
+
+    std::mt19937                          Gen{0};
+    std::uniform_real_distribution<float> PosDistr{-60.f, 60.f};
+    std::uniform_real_distribution<float> SizeDistr{0.f, 10.f};
+    for (size_t i = 0; i < NumBoxes; ++i)
+    {
+        MinX[i] = PosDistr(Gen);
+        MinY[i] = PosDistr(Gen);
+        MinZ[i] = PosDistr(Gen);
+        MaxX[i] = MinX[i] + SizeDistr(Gen);
+        MaxY[i] = MinY[i] + SizeDistr(Gen);
+        MaxZ[i] = MinZ[i] + SizeDistr(Gen);
+    }
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    for (FRUSTUM_PLANE_FLAGS PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR, FRUSTUM_PLANE_FLAG_NONE})
+    {
+        std::vector<Uint8> RefVisibility(NumBoxes);
+        for (size_t i = 0; i < NumBoxes; ++i)
+        {
+            const BoundBox Box{{MinX[i], MinY[i], MinZ[i]}, {MaxX[i], MaxY[i], MaxZ[i]}};
+            RefVisibility[i] = static_cast<Uint8>(GetBoxVisibility(Frustum, Box, PlaneFlags));
+        }
+
+        for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+        {
+            std::vector<Uint8> Visibility(NumBoxes, 0xFF);
+            GetBoxesVisibility(Frustum, MinX.data(), MinY.data(), MinZ.data(), MaxX.data(), MaxY.data(), MaxZ.data(),
+                               NumBoxes, Visibility.data(), PlaneFlags, pPool);
+            EXPECT_EQ(Visibility, RefVisibility) << "PlaneFlags: " << PlaneFlags << ", thread pool: " << (pPool != nullptr);
+        }
+    }
+}
+
 TEST(Common_AdvancedMath, GetPointToBoxDistance)
 {
     BoundBox Box{float3{1, 2, 3}, float3{4, 5, 6}};
@@ -69,10 +69,10 @@ struct RegistryDataObj : public ObjectBase<IObject>
     }
 };
 
-template <template <typename T> class StrongPtrType, typename DataType>
+template <template <typename T> class StrongPtrType, typename DataType, size_t NumShards = 1>
 void TestObjectRegistryGet()
 {
-    ObjectsRegistry<int, StrongPtrType<DataType>> Registry;
+    ObjectsRegistry<int, StrongPtrType<DataType>, std::hash<int>, std::equal_to<int>, NumShards> Registry;
 
     {
         int    Key    = 999;
@@ -131,11 +131,21 @@ TEST(Common_ObjectsRegistry, Get_RefCntAutoPtr)
     TestObjectRegistryGet<RefCntAutoPtr, RegistryDataObj>();
 }
 
+TEST(Common_ObjectsRegistry, Get_Sharded_SharedPtr)
+{
+    TestObjectRegistryGet<std::shared_ptr, RegistryData, 8>();
+}
+
+TEST(Common_ObjectsRegistry, Get_Sharded_RefCntAutoPtr)
+{
+    TestObjectRegistryGet<RefCntAutoPtr, RegistryDataObj, 8>();
+}
 
-template <template <typename T> class StrongPtrType, typename DataType>
+
+template <template <typename T> class StrongPtrType, typename DataType, size_t NumShards = 1>
 void TestObjectRegistryCreateDestroyRace()
 {
-    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{64};
+    ObjectsRegistry<int, StrongPtrType<DataType>, std::hash<int>, std::equal_to<int>, NumShards> Registry{64};
 
     constexpr Uint32         NumThreads = 16;
     std::vector<std::thread> Threads(NumThreads);
@@ -168,11 +178,21 @@ TEST(Common_ObjectsRegistry, CreateDestroyRace_RefCntAutoPtr)
     TestObjectRegistryCreateDestroyRace<RefCntAutoPtr, RegistryDataObj>();
 }
 
+TEST(Common_ObjectsRegistry, CreateDestroyRace_Sharded_SharedPtr)
+{
+    TestObjectRegistryCreateDestroyRace<std::shared_ptr, RegistryData, 8>();
+}
+
+TEST(Common_ObjectsRegistry, CreateDestroyRace_Sharded_RefCntAutoPtr)
+{
+    TestObjectRegistryCreateDestroyRace<RefCntAutoPtr, RegistryDataObj, 8>();
+}
+
 
-template <template <typename T> class StrongPtrType, typename DataType>
+template <template <typename T> class StrongPtrType, typename DataType, size_t NumShards = 1>
 void TestObjectRegistryExceptions()
 {
-    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{128};
+    ObjectsRegistry<int, StrongPtrType<DataType>, std::hash<int>, std::equal_to<int>, NumShards> Registry{128};
 
     constexpr Uint32         NumThreads = 15; // Use odd number
     std::vector<std::thread> Threads(NumThreads);
@@ -244,4 +264,14 @@ TEST(Common_ObjectsRegistry, Exceptions_RefCntAutoPtr)
     TestObjectRegistryExceptions<RefCntAutoPtr, RegistryDataObj>();
 }
 
+TEST(Common_ObjectsRegistry, Exceptions_Sharded_SharedPtr)
+{
+    TestObjectRegistryExceptions<std::shared_ptr, RegistryData, 8>();
+}
+
+TEST(Common_ObjectsRegistry, Exceptions_Sharded_RefCntAutoPtr)
+{
+    TestObjectRegistryExceptions<RefCntAutoPtr, RegistryDataObj, 8>();
+}
+
 } // namespace
@@ -350,6 +350,53 @@ TEST(Common_RefCntWeakPtr, Lock)
     }
 }
 
+class SingleThreadedObject : public Object
+{
+public:
+    SingleThreadedObject(IReferenceCounters* pRefCounters) :
+        Object{pRefCounters}
+    {}
+};
+
+} // namespace
+
+namespace Diligent
+{
+
+template <>
+struct RefCountingModeTraits<SingleThreadedObject>
+{
+    static constexpr RefCountingMode Mode = RefCountingMode::SingleThreaded;
+};
+
+} // namespace Diligent
+
+namespace
+{
+
+TEST(Common_RefCntAutoPtr, SingleThreadedRefCounting)
+{
+    RefCntAutoPtr<SingleThreadedObject> SP0{MakeNewObj<SingleThreadedObject>()};
+    EXPECT_EQ(SP0->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    RefCntWeakPtr<SingleThreadedObject> WP0{SP0};
+    EXPECT_EQ(SP0->GetReferenceCounters()->GetNumWeakRefs(), 1);
+
+    {
+        RefCntAutoPtr<SingleThreadedObject> SP1{SP0};
+        EXPECT_EQ(SP0->GetReferenceCounters()->GetNumStrongRefs(), 2);
+
+        RefCntAutoPtr<SingleThreadedObject> SP2 = WP0.Lock();
+        EXPECT_EQ(SP2, SP0);
+        EXPECT_EQ(SP0->GetReferenceCounters()->GetNumStrongRefs(), 3);
+    }
+    EXPECT_EQ(SP0->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    SP0.Release();
+    EXPECT_FALSE(WP0.Lock());
+    EXPECT_FALSE(WP0.IsValid());
+}
+
 TEST(Common_RefCntAutoPtr, Misc)
 {
     {
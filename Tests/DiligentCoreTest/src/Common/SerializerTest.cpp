@@ -170,6 +170,97 @@ TEST(SerializerTest, SerializerTest)
         EXPECT_TRUE(WSer.IsEnded());
         EXPECT_TRUE(Data == Data2);
     }
+
+    for (size_t ChunkSize : {1, 8, 16, 1024})
+    {
+        DynamicLinearAllocator ChunkAllocator{RawAllocator};
+
+        Serializer<SerializerMode::WriteGrowable> GSer{ChunkAllocator, ChunkSize};
+        WriteData(GSer);
+        EXPECT_EQ(GSer.GetSize(), MSer.GetSize());
+
+        auto Data3 = GSer.GetData(RawAllocator);
+        EXPECT_TRUE(Data == Data3) << "ChunkSize: " << ChunkSize;
+    }
+}
+
+TEST(SerializerTest, SerializeArrayView)
+{
+    const Uint8  RefU8             = 0x31;
+    const Uint32 RefU32Count       = 3;
+    const Uint32 RefU32Array[]     = {0x1251, 0x620, 0x8816};
+    const Uint64 RefU64Count       = 2;
+    const Uint64 RefU64Array[]     = {0x12345678ABCDEF01ull, 0x7526109374629587ull};
+    const Uint32 RefEmptyCount     = 0;
+    const Uint16 RefU16            = 0x4172;
+    const Uint32 RefU32Array2Count = 1;
+    const Uint32 RefU32Array2[]    = {0x8612};
+
+    const Uint32* pRefU32Array  = RefU32Array;
+    const Uint64* pRefU64Array  = RefU64Array;
+    const Uint32* pRefEmpty     = nullptr;
+    const Uint32* pRefU32Array2 = RefU32Array2;
+
+    const auto WriteData = [&](auto& Ser) {
+        EXPECT_TRUE(Ser(RefU8));
+        EXPECT_TRUE(Ser.SerializeArrayView(pRefU32Array, RefU32Count));
+        EXPECT_TRUE(Ser.SerializeArrayView(pRefU64Array, RefU64Count));
+        EXPECT_TRUE(Ser.SerializeArrayView(pRefEmpty, RefEmptyCount));
+        EXPECT_TRUE(Ser(RefU16));
+        EXPECT_TRUE(Ser.SerializeArrayView(pRefU32Array2, RefU32Array2Count));
+    };
+
+    auto& RawAllocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    Serializer<SerializerMode::Measure> MSer;
+    WriteData(MSer);
+
+    auto Data = MSer.AllocateData(RawAllocator);
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        WriteData(WSer);
+        EXPECT_TRUE(WSer.IsEnded());
+    }
+
+    Serializer<SerializerMode::Read> RSer{Data};
+
+    Uint8 U8 = 0;
+    EXPECT_TRUE(RSer(U8));
+    EXPECT_EQ(U8, RefU8);
+
+    const Uint32* pU32Array = nullptr;
+    Uint32        U32Count  = 0;
+    EXPECT_TRUE(RSer.SerializeArrayView(pU32Array, U32Count));
+    ASSERT_EQ(U32Count, RefU32Count);
+    // The elements must not be copied
+    EXPECT_GE(reinterpret_cast<const Uint8*>(pU32Array), Data.Ptr<const Uint8>());
+    EXPECT_LE(reinterpret_cast<const Uint8*>(pU32Array + U32Count), Data.Ptr<const Uint8>() + Data.Size());
+    EXPECT_EQ(std::memcmp(pU32Array, RefU32Array, sizeof(RefU32Array)), 0);
+
+    const Uint64* pU64Array = nullptr;
+    Uint64        U64Count  = 0;
+    EXPECT_TRUE(RSer.SerializeArrayView(pU64Array, U64Count));
+    ASSERT_EQ(U64Count, RefU64Count);
+    EXPECT_EQ(reinterpret_cast<size_t>(pU64Array) % alignof(Uint64), 0u);
+    EXPECT_EQ(std::memcmp(pU64Array, RefU64Array, sizeof(RefU64Array)), 0);
+
+    const Uint32* pEmpty     = nullptr;
+    Uint32        EmptyCount = ~0u;
+    EXPECT_TRUE(RSer.SerializeArrayView(pEmpty, EmptyCount));
+    EXPECT_EQ(EmptyCount, 0u);
+    EXPECT_EQ(pEmpty, nullptr);
+
+    Uint16 U16 = 0;
+    EXPECT_TRUE(RSer(U16));
+    EXPECT_EQ(U16, RefU16);
+
+    const Uint32* pU32Array2 = nullptr;
+    Uint32        U32Count2  = 0;
+    EXPECT_TRUE(RSer.SerializeArrayView(pU32Array2, U32Count2));
+    ASSERT_EQ(U32Count2, RefU32Array2Count);
+    EXPECT_EQ(pU32Array2[0], RefU32Array2[0]);
+
+    EXPECT_TRUE(RSer.IsEnded());
 }
 
 } // namespace
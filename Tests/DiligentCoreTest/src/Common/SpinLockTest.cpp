@@ -28,6 +28,8 @@
 
 #include <vector>
 #include <thread>
+#include <atomic>
+#include <chrono>
 
 #include "gtest/gtest.h"
 
@@ -71,4 +73,37 @@ TEST(Common_SpinLock, ThreadContention)
     }
 }
 
+TEST(Common_SpinLock, LongHold)
+{
+    // Waiting threads exhaust the spin budget and park until the lock is released
+    Threading::SpinLock Lock;
+    Lock.lock();
+
+    constexpr size_t         NumThreads = 4;
+    std::atomic<size_t>      NumAcquired{0};
+    std::vector<std::thread> Workers;
+    for (size_t i = 0; i < NumThreads; ++i)
+    {
+        Workers.emplace_back(
+            [&Lock, &NumAcquired] //
+            {
+                Threading::SpinLockGuard Guard{Lock};
+                NumAcquired.fetch_add(1);
+            });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(NumAcquired.load(), size_t{0});
+    EXPECT_FALSE(Lock.try_lock());
+
+    Lock.unlock();
+    for (auto& Thread : Workers)
+        Thread.join();
+
+    EXPECT_EQ(NumAcquired.load(), NumThreads);
+    EXPECT_FALSE(Lock.is_locked());
+    EXPECT_TRUE(Lock.try_lock());
+    Lock.unlock();
+}
+
 } // namespace
@@ -25,6 +25,7 @@
  */
 
 #include "ThreadPool.hpp"
+#include "PlatformMisc.hpp"
 
 #include "gtest/gtest.h"
 
@@ -39,11 +40,12 @@ using namespace Diligent;
 namespace
 {
 
-TEST(Common_ThreadPool, EnqueueTask)
+void TestEnqueueTask(bool EnableWorkStealing)
 {
     constexpr Uint32     NumThreads = 4;
     constexpr Uint32     NumTasks   = 32;
     ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.EnableWorkStealing = EnableWorkStealing;
 
     std::array<std::atomic<bool>, NumThreads> ThreadStarted{};
 
@@ -100,13 +102,26 @@ TEST(Common_ThreadPool, EnqueueTask)
     EXPECT_EQ(NumThreadsFinished.load(), PoolCI.NumThreads);
 }
 
+TEST(Common_ThreadPool, EnqueueTask)
+{
+    TestEnqueueTask(false);
+}
 
-TEST(Common_ThreadPool, ProcessTask)
+TEST(Common_ThreadPool, EnqueueTask_WorkStealing)
+{
+    TestEnqueueTask(true);
+}
+
+
+void TestProcessTask(bool EnableWorkStealing)
 {
     constexpr Uint32 NumThreads = 4;
     constexpr Uint32 NumTasks   = 32;
 
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+    ThreadPoolCreateInfo PoolCI{0};
+    PoolCI.EnableWorkStealing = EnableWorkStealing;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
     ASSERT_NE(pThreadPool, nullptr);
 
     std::vector<std::thread> WorkerThreads(NumThreads);
@@ -164,6 +179,16 @@ TEST(Common_ThreadPool, ProcessTask)
     }
 }
 
+TEST(Common_ThreadPool, ProcessTask)
+{
+    TestProcessTask(false);
+}
+
+TEST(Common_ThreadPool, ProcessTask_WorkStealing)
+{
+    TestProcessTask(true);
+}
+
 class WaitTask : public AsyncTaskBase
 {
 public:
@@ -299,7 +324,7 @@ TEST(Common_ThreadPool, Reprioritize)
 }
 
 
-TEST(Common_ThreadPool, Priorities)
+void TestPriorities(bool EnableWorkStealing)
 {
     constexpr Uint32 NumThreads  = 1;
     constexpr Uint32 NumTasks    = 8;
@@ -307,7 +332,10 @@ TEST(Common_ThreadPool, Priorities)
 
     for (Uint32 k = 0; k < RepeatCount; ++k)
     {
-        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        ThreadPoolCreateInfo PoolCI{NumThreads};
+        PoolCI.EnableWorkStealing = EnableWorkStealing;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
         ASSERT_NE(pThreadPool, nullptr);
 
         Threading::Signal       Signal;
@@ -361,12 +389,25 @@ TEST(Common_ThreadPool, Priorities)
     }
 }
 
+TEST(Common_ThreadPool, Priorities)
+{
+    TestPriorities(false);
+}
+
+TEST(Common_ThreadPool, Priorities_WorkStealing)
+{
+    TestPriorities(true);
+}
 
-TEST(Common_ThreadPool, Prerequisites)
+
+void TestPrerequisites(bool EnableWorkStealing)
 {
     for (Uint32 NumThreads : {1, 8})
     {
-        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        ThreadPoolCreateInfo PoolCI{NumThreads};
+        PoolCI.EnableWorkStealing = EnableWorkStealing;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
         ASSERT_NE(pThreadPool, nullptr);
 
         constexpr Uint32               NumTasks = 16;
@@ -414,10 +455,23 @@ TEST(Common_ThreadPool, Prerequisites)
     }
 }
 
+TEST(Common_ThreadPool, Prerequisites)
+{
+    TestPrerequisites(false);
+}
 
-TEST(Common_ThreadPool, ReRunTasks)
+TEST(Common_ThreadPool, Prerequisites_WorkStealing)
 {
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    TestPrerequisites(true);
+}
+
+
+void TestReRunTasks(bool EnableWorkStealing)
+{
+    ThreadPoolCreateInfo PoolCI{4};
+    PoolCI.EnableWorkStealing = EnableWorkStealing;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
     ASSERT_NE(pThreadPool, nullptr);
 
     constexpr Uint32              NumTasks = 32;
@@ -442,4 +496,237 @@ TEST(Common_ThreadPool, ReRunTasks)
         EXPECT_EQ(ReRunCounters[i], 0) << i;
 }
 
+TEST(Common_ThreadPool, ReRunTasks)
+{
+    TestReRunTasks(false);
+}
+
+TEST(Common_ThreadPool, ReRunTasks_WorkStealing)
+{
+    TestReRunTasks(true);
+}
+
+
+TEST(Common_ThreadPool, WorkStealing)
+{
+    constexpr Uint32 NumThreads  = 4;
+    constexpr Uint32 NumSubtasks = 64;
+
+    ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.EnableWorkStealing = true;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    std::atomic<Uint32> NumSubtasksComplete{0};
+    std::atomic<Uint32> NumSubtasksOnParentThread{0};
+
+    RefCntAutoPtr<IAsyncTask> pParentTask =
+        EnqueueAsyncWork(pThreadPool,
+                         [&](Uint32 ParentThreadId) //
+                         {
+                             // Subtasks are placed into the queue of this thread, so other
+                             // threads must steal them while this thread is waiting.
+                             for (Uint32 i = 0; i < NumSubtasks; ++i)
+                             {
+                                 EnqueueAsyncWork(pThreadPool,
+                                                  [&, ParentThreadId](Uint32 ThreadId) //
+                                                  {
+                                                      if (ThreadId == ParentThreadId)
+                                                          NumSubtasksOnParentThread.fetch_add(1);
+                                                      NumSubtasksComplete.fetch_add(1);
+                                                      return ASYNC_TASK_STATUS_COMPLETE;
+                                                  });
+                             }
+
+                             while (NumSubtasksComplete.load() < NumSubtasks)
+                                 std::this_thread::yield();
+
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+
+    pThreadPool->WaitForAllTasks();
+
+    EXPECT_TRUE(pParentTask->IsFinished());
+    EXPECT_EQ(NumSubtasksComplete.load(), NumSubtasks);
+    EXPECT_EQ(NumSubtasksOnParentThread.load(), 0u);
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    EXPECT_EQ(pThreadPool->GetRunningTaskCount(), 0u);
+}
+
+
+TEST(Common_ThreadPool, ParallelFor)
+{
+    constexpr Uint32 NumItems = 1000;
+
+    auto TestParallelFor = [](IThreadPool* pThreadPool, Uint32 Begin, Uint32 End, Uint32 Grain) {
+        std::vector<std::atomic<Uint32>> Counters(NumItems);
+        ParallelFor(pThreadPool, Begin, End, Grain,
+                    [&Counters](Uint32 i) {
+                        Counters[i].fetch_add(1);
+                    });
+        for (Uint32 i = 0; i < NumItems; ++i)
+        {
+            EXPECT_EQ(Counters[i].load(), (i >= Begin && i < End) ? 1u : 0u) << "i=" << i << " Grain=" << Grain;
+        }
+    };
+
+    for (bool EnableWorkStealing : {false, true})
+    {
+        for (Uint32 NumThreads : {0, 1, 4})
+        {
+            ThreadPoolCreateInfo PoolCI{NumThreads};
+            PoolCI.EnableWorkStealing = EnableWorkStealing;
+
+            auto pThreadPool = CreateThreadPool(PoolCI);
+            ASSERT_NE(pThreadPool, nullptr);
+
+            for (Uint32 Grain : {0, 1, 7, 64, 2000})
+            {
+                TestParallelFor(pThreadPool, 0, NumItems, Grain);
+                TestParallelFor(pThreadPool, 13, 917, Grain);
+                TestParallelFor(pThreadPool, 10, 10, Grain);
+            }
+
+            pThreadPool->WaitForAllTasks();
+            EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+        }
+    }
+
+    TestParallelFor(nullptr, 0, NumItems, 16);
+}
+
+TEST(Common_ThreadPool, ParallelForFromWorkerThread)
+{
+    ThreadPoolCreateInfo PoolCI{2};
+    PoolCI.EnableWorkStealing = true;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    std::atomic<Uint32> Sum{0};
+    for (Uint32 task = 0; task < 4; ++task)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [&](Uint32 ThreadId) //
+                         {
+                             ParallelFor(pThreadPool, 0, 100, 4,
+                                         [&Sum](Uint32 i) {
+                                             Sum.fetch_add(i);
+                                         });
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(Sum.load(), 4u * 99u * 100u / 2u);
+}
+
+TEST(Common_ThreadPool, ThreadPlacement)
+{
+    const CPUTopology& Topology = PlatformMisc::GetCPUTopology();
+
+    const std::vector<Uint32> AllProcessors = GetThreadPlacementProcessors(THREAD_PLACEMENT_FLAG_NONE);
+    EXPECT_EQ(AllProcessors.size(), Topology.Processors.size());
+
+    const std::vector<Uint32> CoreProcessors = GetThreadPlacementProcessors(THREAD_PLACEMENT_FLAG_ONE_PER_PHYSICAL_CORE);
+    EXPECT_EQ(CoreProcessors.size(), Topology.NumPhysicalCores);
+
+    const std::vector<Uint32> PerfCoreProcessors = GetThreadPlacementProcessors(THREAD_PLACEMENT_FLAG_ONE_PER_PHYSICAL_CORE | THREAD_PLACEMENT_FLAG_PERFORMANCE_CORES);
+    EXPECT_LE(PerfCoreProcessors.size(), CoreProcessors.size());
+    for (Uint32 Index : PerfCoreProcessors)
+    {
+        const CPUProcessorInfo* pProc = Topology.GetProcessor(Index);
+        ASSERT_NE(pProc, nullptr);
+        EXPECT_NE(pProc->CoreType, CPUCoreType::Efficiency);
+    }
+
+    ThreadPoolCreateInfo PoolCI;
+    PoolCI.NumThreads     = std::max(CoreProcessors.size(), size_t{1});
+    PoolCI.PlacementFlags = THREAD_PLACEMENT_FLAG_ONE_PER_PHYSICAL_CORE;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    std::atomic<Uint32> NumTasksRun{0};
+    for (size_t i = 0; i < PoolCI.NumThreads * 4; ++i)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [&NumTasksRun](Uint32 ThreadId) //
+                         {
+                             NumTasksRun.fetch_add(1);
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(NumTasksRun.load(), PoolCI.NumThreads * 4);
+}
+
+TEST(Common_ThreadPool, TaskGraph)
+{
+    for (Uint32 NumThreads : {0, 1, 4})
+    {
+        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        ASSERT_NE(pThreadPool, nullptr);
+
+        // A -> {B, C, D}
+        // B -> E
+        // C -> {E, F}
+        // D -> F
+        // {E, F} -> G
+        constexpr Uint32                 NumTasks = 7;
+        std::vector<std::atomic<Uint32>> CompletionOrder(NumTasks);
+        std::atomic<Uint32>              CompletionCounter{0};
+
+        TaskGraph Graph;
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            const Uint32 Idx = Graph.AddTask([i, &CompletionOrder, &CompletionCounter]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(100 * (i % 3)));
+                CompletionOrder[i].store(CompletionCounter.fetch_add(1));
+            });
+            EXPECT_EQ(Idx, i);
+        }
+        EXPECT_EQ(Graph.GetTaskCount(), NumTasks);
+
+        const std::vector<std::pair<Uint32, Uint32>> Edges = {
+            {0, 1}, {0, 2}, {0, 3}, {1, 4}, {2, 4}, {2, 5}, {3, 5}, {4, 6}, {5, 6}};
+        for (const auto& Edge : Edges)
+            Graph.AddDependency(Edge.first, Edge.second);
+
+        // Execute the same graph several times
+        for (Uint32 Iter = 0; Iter < 3; ++Iter)
+        {
+            CompletionCounter.store(0);
+            Graph.Execute(pThreadPool);
+            EXPECT_EQ(CompletionCounter.load(), NumTasks);
+            for (const auto& Edge : Edges)
+            {
+                EXPECT_LT(CompletionOrder[Edge.first].load(), CompletionOrder[Edge.second].load())
+                    << Edge.first << " -> " << Edge.second << " NumThreads=" << NumThreads;
+            }
+        }
+
+        pThreadPool->WaitForAllTasks();
+        EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    }
+
+    // Wide graph without a thread pool
+    {
+        constexpr Uint32    NumTasks = 256;
+        std::atomic<Uint32> NumComplete{0};
+
+        TaskGraph Graph;
+        const Uint32 Root = Graph.AddTask([&NumComplete]() { NumComplete.fetch_add(1); });
+        for (Uint32 i = 1; i < NumTasks; ++i)
+            Graph.AddDependency(Root, Graph.AddTask([&NumComplete]() { NumComplete.fetch_add(1); }));
+
+        Graph.Execute(nullptr);
+        EXPECT_EQ(NumComplete.load(), NumTasks);
+
+        Graph.Clear();
+        EXPECT_EQ(Graph.GetTaskCount(), 0u);
+        Graph.Execute(nullptr);
+    }
+}
+
 } // namespace
@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ThreadSignal.hpp"
+
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include "gtest/gtest.h"
+
+namespace
+{
+
+TEST(Common_ThreadSignal, TriggerBeforeWait)
+{
+    Threading::Signal Signal;
+    EXPECT_FALSE(Signal.IsTriggered());
+
+    Signal.Trigger(false, 5);
+    EXPECT_TRUE(Signal.IsTriggered());
+    EXPECT_EQ(Signal.Wait(), 5);
+    EXPECT_TRUE(Signal.IsTriggered());
+
+    Signal.Reset();
+    EXPECT_FALSE(Signal.IsTriggered());
+}
+
+TEST(Common_ThreadSignal, NotifyAll)
+{
+    constexpr int NumThreads = 8;
+
+    Threading::Signal        Signal;
+    std::atomic<int>         NumAwaken{0};
+    std::vector<std::thread> Workers;
+    for (int i = 0; i < NumThreads; ++i)
+    {
+        Workers.emplace_back(
+            [&Signal, &NumAwaken] //
+            {
+                EXPECT_EQ(Signal.Wait(true, NumThreads), 3);
+                NumAwaken.fetch_add(1);
+            });
+    }
+
+    Signal.Trigger(true, 3);
+    for (auto& Thread : Workers)
+        Thread.join();
+
+    EXPECT_EQ(NumAwaken.load(), NumThreads);
+    // The last awaken thread resets the signal
+    EXPECT_FALSE(Signal.IsTriggered());
+}
+
+TEST(Common_ThreadSignal, PingPong)
+{
+    constexpr int NumIterations = 10000;
+
+    Threading::Signal Ping;
+    Threading::Signal Pong;
+
+    std::thread Worker{
+        [&] //
+        {
+            for (int i = 0; i < NumIterations; ++i)
+            {
+                const int Value = Ping.Wait(true, 1);
+                Pong.Trigger(false, Value + 1);
+            }
+        }};
+
+    for (int i = 0; i < NumIterations; ++i)
+    {
+        Ping.Trigger(false, i + 1);
+        EXPECT_EQ(Pong.Wait(true, 1), i + 2);
+    }
+
+    Worker.join();
+}
+
+} // namespace
@@ -0,0 +1,116 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "TriangleBVH.hpp"
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_TriangleBVH, Empty)
+{
+    TriangleBVH BVH;
+    BVH.Build(nullptr, 0);
+    EXPECT_TRUE(BVH.IsEmpty());
+    EXPECT_FALSE(BVH.CastRay(float3{0, 0, 0}, float3{0, 0, 1}));
+}
+
+TEST(Common_TriangleBVH, CastRay)
+{
+    std::mt19937                          Gen{0};
+    std::uniform_real_distribution<float> PosDistr{-100.f, 100.f};
+    std::uniform_real_distribution<float> SizeDistr{-2.f, 2.f};
+
+    auto RandomVector = [&](std::uniform_real_distribution<float>& Distr) {
+        return float3{Distr(Gen), Distr(Gen), Distr(Gen)};
+    };
+
+    constexpr Uint32    NumTriangles = 20000;
+    std::vector<float3> Verts(NumTriangles * 3);
+    for (Uint32 tri = 0; tri < NumTriangles; ++tri)
+    {
+        const float3 Center = RandomVector(PosDistr);
+        for (Uint32 v = 0; v < 3; ++v)
+            Verts[tri * 3 + v] = Center + RandomVector(SizeDistr);
+    }
+    // Add some degenerate and coincident triangles
+    for (Uint32 tri = 0; tri < 64; ++tri)
+    {
+        Verts[tri * 3 + 0] = float3{1, 2, 3};
+        Verts[tri * 3 + 1] = float3{1, 2, 3};
+        Verts[tri * 3 + 2] = float3{1, 2, 3};
+    }
+
+    for (Uint32 MaxLeafSize : {1u, 4u, 8u, 16u})
+    {
+        TriangleBVH BVH;
+        BVH.Build(Verts.data(), NumTriangles, MaxLeafSize);
+        EXPECT_EQ(BVH.GetTriangleCount(), NumTriangles);
+
+        const BoundBox Bounds = BVH.GetBounds();
+        for (const float3& Vert : Verts)
+        {
+            EXPECT_TRUE(Vert.x >= Bounds.Min.x && Vert.y >= Bounds.Min.y && Vert.z >= Bounds.Min.z);
+            EXPECT_TRUE(Vert.x <= Bounds.Max.x && Vert.y <= Bounds.Max.y && Vert.z <= Bounds.Max.z);
+        }
+
+        for (int iter = 0; iter < 200; ++iter)
+        {
+            const float3 Origin    = RandomVector(PosDistr);
+            const float3 Direction = RandomVector(PosDistr) - Origin;
+            const float  MaxDist   = iter % 2 == 0 ? FLT_MAX : 0.5f;
+
+            float        RefDist = MaxDist;
+            const Uint32 RefTri  = IntersectRayTriangles(Origin, Direction, Verts.data(), NumTriangles, RefDist);
+
+            const TriangleBVH::HitInfo Hit = BVH.CastRay(Origin, Direction, MaxDist);
+            if (RefTri != ~0u)
+            {
+                EXPECT_TRUE(Hit);
+                EXPECT_EQ(Hit.Distance, RefDist);
+                if (Hit.Triangle != RefTri)
+                {
+                    // Several triangles may be hit at exactly the same distance
+                    const Uint32 tri = Hit.Triangle;
+                    EXPECT_EQ(IntersectRayTriangle(Verts[tri * 3 + 0], Verts[tri * 3 + 1], Verts[tri * 3 + 2], Origin, Direction), RefDist);
+                }
+            }
+            else
+            {
+                EXPECT_FALSE(Hit);
+                EXPECT_EQ(Hit.Distance, FLT_MAX);
+            }
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ColorConversion.h"
+
+#include <vector>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<float> GetTestValues()
+{
+    std::vector<float> Values;
+    for (Uint32 i = 0; i <= 65536; ++i)
+        Values.push_back(static_cast<float>(i) / 65536.f);
+    return Values;
+}
+
+TEST(ColorConversion, GammaToLinear8)
+{
+    std::vector<Uint8> Src(256 + 7);
+    for (size_t i = 0; i < Src.size(); ++i)
+        Src[i] = static_cast<Uint8>(i);
+
+    std::vector<float> Dst(Src.size());
+    GammaToLinear(Src.data(), Dst.data(), Src.size());
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        EXPECT_EQ(Dst[i], GammaToLinear(Src[i]));
+        EXPECT_NEAR(Dst[i], GammaToLinear(static_cast<float>(Src[i]) / 255.f), 1e-6f);
+    }
+}
+
+TEST(ColorConversion, LinearToGamma8)
+{
+    const std::vector<float> Src = GetTestValues();
+
+    std::vector<Uint8> Dst(Src.size());
+    LinearToGamma(Src.data(), Dst.data(), Src.size());
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        // The linear value is quantized to 12 bits, which results in at most 1 code difference
+        const int Ref = static_cast<int>(LinearToGamma(Src[i]) * 255.f + 0.5f);
+        EXPECT_LE(std::abs(int{Dst[i]} - Ref), 1) << Src[i];
+    }
+
+    // Every 8-bit value must survive the round trip
+    for (Uint32 i = 0; i < 256; ++i)
+    {
+        const float Linear = GammaToLinear(static_cast<Uint8>(i));
+
+        Uint8 Gamma = 0;
+        LinearToGamma(&Linear, &Gamma, 1);
+        EXPECT_EQ(Gamma, i);
+    }
+
+    // Out-of-range values are clamped
+    const float OutOfRange[] = {-1.f, 2.f};
+    Uint8       Clamped[2]   = {};
+    LinearToGamma(OutOfRange, Clamped, 2);
+    EXPECT_EQ(Clamped[0], 0);
+    EXPECT_EQ(Clamped[1], 255);
+}
+
+TEST(ColorConversion, FastGammaToLinear)
+{
+    const std::vector<float> Src = GetTestValues();
+
+    std::vector<float> Dst(Src.size());
+    FastGammaToLinear(Src.data(), Dst.data(), Src.size());
+
+    float MaxError = 0;
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        EXPECT_EQ(Dst[i], FastGammaToLinear(Src[i]));
+        MaxError = std::max(MaxError, std::abs(Dst[i] - GammaToLinear(Src[i])));
+    }
+    // The polynomial approximation is within 0.002 of the exact conversion (about half of an 8-bit step)
+    EXPECT_LT(MaxError, 0.002f);
+}
+
+TEST(ColorConversion, FastLinearToGamma)
+{
+    const std::vector<float> Src = GetTestValues();
+
+    std::vector<float> Dst(Src.size());
+    FastLinearToGamma(Src.data(), Dst.data(), Src.size());
+
+    float MaxError = 0;
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        EXPECT_EQ(Dst[i], FastLinearToGamma(Src[i]));
+        MaxError = std::max(MaxError, std::abs(Dst[i] - LinearToGamma(Src[i])));
+    }
+    // The approximation is within 0.0045 of the exact conversion (about 1.15 8-bit steps)
+    EXPECT_LT(MaxError, 0.0045f);
+}
+
+} // namespace
@@ -465,4 +465,140 @@ TEST(GraphicsAccessories_DynamicAtlasManager, AllocateRandom)
     }
 }
 
+TEST(GraphicsAccessories_DynamicAtlasManager, Skyline_Allocate)
+{
+    DynamicAtlasManager Mgr{16, 8, DynamicAtlasManager::PackingMode::Skyline};
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetPackingMode(), DynamicAtlasManager::PackingMode::Skyline);
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 1U);
+
+    auto R0 = Mgr.Allocate(4, 4);
+    EXPECT_EQ(R0, Region(0, 0, 4, 4));
+
+    auto R1 = Mgr.Allocate(4, 2);
+    EXPECT_EQ(R1, Region(4, 0, 4, 2));
+
+    auto R2 = Mgr.Allocate(8, 8);
+    EXPECT_EQ(R2, Region(8, 0, 8, 8));
+
+    //   ________________
+    //  |        |       |
+    //  |        |       |
+    //  |____    |  R2   |
+    //  |    |_R3|       |
+    //  | R0 |   |       |
+    //  |____|R1_|_______|
+    //
+    auto R3 = Mgr.Allocate(4, 4);
+    EXPECT_EQ(R3, Region(4, 2, 4, 4));
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 2U);
+
+    auto R4 = Mgr.Allocate(8, 4);
+    EXPECT_TRUE(R4.IsEmpty());
+
+    // R1 is below the skyline and goes to the free list
+    Mgr.Free(std::move(R1));
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 3U);
+
+    // The free rectangle is reused
+    R1 = Mgr.Allocate(2, 2);
+    EXPECT_EQ(R1, Region(4, 0, 2, 2));
+
+    // R3 is on the skyline; after it is released, the skyline is lowered
+    // to the top of R0 and the free rectangle next to R1 is not exposed.
+    Mgr.Free(std::move(R3));
+    R4 = Mgr.Allocate(8, 4);
+    EXPECT_EQ(R4, Region(0, 4, 8, 4));
+
+    Mgr.Free(std::move(R4));
+    Mgr.Free(std::move(R0));
+    Mgr.Free(std::move(R2));
+    Mgr.Free(std::move(R1));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 1U);
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, Skyline_LowerFreeRects)
+{
+    DynamicAtlasManager Mgr{8, 8, DynamicAtlasManager::PackingMode::Skyline};
+
+    auto R0 = Mgr.Allocate(8, 4);
+    auto R1 = Mgr.Allocate(8, 4);
+    EXPECT_EQ(R0, Region(0, 0, 8, 4));
+    EXPECT_EQ(R1, Region(0, 4, 8, 4));
+    EXPECT_EQ(Mgr.GetTotalFreeArea(), 0U);
+
+    Mgr.Free(std::move(R0));
+    R0 = Mgr.Allocate(4, 4);
+    EXPECT_EQ(R0, Region(0, 0, 4, 4));
+
+    // Releasing R1 lowers the skyline to y=4 and then exposes the free rectangle
+    // [4, 8) x [0, 4), which lowers the skyline in these columns to zero.
+    Mgr.Free(std::move(R1));
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 2U);
+
+    R1 = Mgr.Allocate(4, 8);
+    EXPECT_EQ(R1, Region(4, 0, 4, 8));
+
+    Mgr.Free(std::move(R0));
+    Mgr.Free(std::move(R1));
+    EXPECT_TRUE(Mgr.IsEmpty());
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, AllocateBatch)
+{
+    for (auto Mode : {DynamicAtlasManager::PackingMode::Guillotine, DynamicAtlasManager::PackingMode::Skyline})
+    {
+        DynamicAtlasManager Mgr{16, 16, Mode};
+
+        // Allocating these regions one by one in the skyline mode fails to place the last one
+        Region Regions[] = {
+            Region{0, 0, 4, 8},
+            Region{0, 0, 8, 8},
+            Region{0, 0, 4, 8},
+            Region{0, 0, 8, 16},
+            Region{0, 0, 0, 0},
+        };
+        EXPECT_EQ(Mgr.AllocateBatch(Regions, _countof(Regions)), 4U);
+        EXPECT_EQ(Mgr.GetTotalFreeArea(), 0U);
+        EXPECT_EQ(Regions[0].width, 4U);
+        EXPECT_EQ(Regions[0].height, 8U);
+        EXPECT_EQ(Regions[3].width, 8U);
+        EXPECT_EQ(Regions[3].height, 16U);
+        EXPECT_TRUE(Regions[4].IsEmpty());
+
+        for (Uint32 i = 0; i < 4; ++i)
+            Mgr.Free(std::move(Regions[i]));
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, Skyline_AllocateRandom)
+{
+    DynamicAtlasManager Mgr{256, 256, DynamicAtlasManager::PackingMode::Skyline};
+    const Uint32        NumIterations = 10;
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        FastRandInt         rnd{static_cast<unsigned int>(i), 1, 16};
+        std::vector<Region> Regions(i * 64);
+        for (auto& R : Regions)
+        {
+            R = Mgr.Allocate(rnd(), rnd());
+        }
+        // Release every other region first to populate the free list
+        for (size_t r = 0; r < Regions.size(); r += 2)
+        {
+            if (!Regions[r].IsEmpty())
+                Mgr.Free(std::move(Regions[r]));
+            Regions[r] = Mgr.Allocate(rnd(), rnd());
+        }
+        for (auto& R : Regions)
+        {
+            if (!R.IsEmpty())
+                Mgr.Free(std::move(R));
+        }
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+}
+
 } // namespace
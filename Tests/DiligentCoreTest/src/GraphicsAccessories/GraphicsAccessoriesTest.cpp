@@ -32,6 +32,7 @@
 #include "GraphicsAccessories.hpp"
 #include "../../../../Graphics/GraphicsEngine/include/PrivateConstants.h"
 #include "GraphicsTypesOutputInserters.hpp"
+#include "ThreadPool.hpp"
 
 #include "gtest/gtest.h"
 
@@ -705,7 +706,7 @@ TEST(GraphicsAccessories_GraphicsAccessories, PipelineTypeFromShaderStages)
 
 TEST(GraphicsAccessories_GraphicsAccessories, GetPipelineResourceFlagsString)
 {
-    static_assert(PIPELINE_RESOURCE_FLAG_LAST == (1u << 4), "Please add a test for the new flag here");
+    static_assert(PIPELINE_RESOURCE_FLAG_LAST == (1u << 5), "Please add a test for the new flag here");
 
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_NONE, true).c_str(), "PIPELINE_RESOURCE_FLAG_NONE");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_NONE).c_str(), "UNKNOWN");
@@ -714,11 +715,13 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetPipelineResourceFlagsString)
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER, true).c_str(), "PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER, true).c_str(), "PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT, true).c_str(), "PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT");
+    EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS, true).c_str(), "PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS");
 
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS).c_str(), "NO_DYNAMIC_BUFFERS");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER).c_str(), "COMBINED_SAMPLER");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER).c_str(), "FORMATTED_BUFFER");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT).c_str(), "GENERAL_INPUT_ATTACHMENT");
+    EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS).c_str(), "INLINE_CONSTANTS");
 
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS | PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER, true).c_str(),
                  "PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS|PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER");
@@ -1568,4 +1571,161 @@ TEST(GraphicsAccessories_GraphicsAccessories, ComputeRenderTargetFormatsHash)
     EXPECT_EQ(Hashes.size(), size_t{3 * 9});
 }
 
+TEST(GraphicsAccessories_GraphicsAccessories, CopyTextureSubresource)
+{
+    constexpr Uint32 RowSize   = 37;
+    constexpr Uint32 NumRows   = 5;
+    constexpr Uint32 NumSlices = 3;
+
+    std::vector<Uint8> SrcData(64 * NumRows * NumSlices);
+    for (size_t i = 0; i < SrcData.size(); ++i)
+        SrcData[i] = static_cast<Uint8>(i * 7 + 3);
+
+    auto Test = [&](Uint32 SrcStride, Uint32 DstStride) {
+        TextureSubResData SrcSubres{SrcData.data(), SrcStride, SrcStride * NumRows};
+
+        std::vector<Uint8> DstData(DstStride * NumRows * NumSlices, 0xCD);
+        CopyTextureSubresource(SrcSubres, NumRows, NumSlices, RowSize, DstData.data(), DstStride, DstStride * NumRows);
+        for (Uint32 z = 0; z < NumSlices; ++z)
+        {
+            for (Uint32 y = 0; y < NumRows; ++y)
+            {
+                const Uint8* pSrcRow = &SrcData[(z * NumRows + y) * SrcStride];
+                const Uint8* pDstRow = &DstData[(z * NumRows + y) * DstStride];
+                EXPECT_EQ(memcmp(pSrcRow, pDstRow, RowSize), 0) << "z=" << z << " y=" << y;
+                for (Uint32 x = RowSize; x < DstStride; ++x)
+                    EXPECT_EQ(pDstRow[x], 0xCD);
+            }
+        }
+    };
+    Test(RowSize, RowSize);
+    Test(RowSize, 64);
+    Test(64, RowSize);
+    Test(64, 48);
+}
+
+TEST(GraphicsAccessories_GraphicsAccessories, ConvertTextureSubresource)
+{
+    constexpr TEXTURE_COMPONENT_SWIZZLE I = TEXTURE_COMPONENT_SWIZZLE_IDENTITY;
+    constexpr TEXTURE_COMPONENT_SWIZZLE Z = TEXTURE_COMPONENT_SWIZZLE_ZERO;
+    constexpr TEXTURE_COMPONENT_SWIZZLE O = TEXTURE_COMPONENT_SWIZZLE_ONE;
+    constexpr TEXTURE_COMPONENT_SWIZZLE R = TEXTURE_COMPONENT_SWIZZLE_R;
+    constexpr TEXTURE_COMPONENT_SWIZZLE G = TEXTURE_COMPONENT_SWIZZLE_G;
+    constexpr TEXTURE_COMPONENT_SWIZZLE B = TEXTURE_COMPONENT_SWIZZLE_B;
+    constexpr TEXTURE_COMPONENT_SWIZZLE A = TEXTURE_COMPONENT_SWIZZLE_A;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+
+    auto Test = [&](Uint32 SrcCount, Uint32 DstCount, const TextureComponentMapping& Swizzle, Uint32 Width, Uint32 NumRows, Uint32 RowPadding, IThreadPool* pPool) {
+        const Uint32 NumSlices = 2;
+        const Uint32 SrcStride = Width * SrcCount + RowPadding;
+        const Uint32 DstStride = Width * DstCount + RowPadding;
+
+        std::vector<Uint8> SrcData(SrcStride * NumRows * NumSlices);
+        for (size_t i = 0; i < SrcData.size(); ++i)
+            SrcData[i] = static_cast<Uint8>(i * 13 + 5);
+
+        std::vector<Uint8> DstData(DstStride * NumRows * NumSlices, 0xCD);
+
+        ConvertTextureSubresourceAttribs Attribs;
+        Attribs.SrcSubres         = TextureSubResData{SrcData.data(), SrcStride, SrcStride * NumRows};
+        Attribs.SrcComponentCount = SrcCount;
+        Attribs.Width             = Width;
+        Attribs.NumRows           = NumRows;
+        Attribs.NumDepthSlices    = NumSlices;
+        Attribs.pDstData          = DstData.data();
+        Attribs.DstRowStride      = DstStride;
+        Attribs.DstDepthStride    = DstStride * NumRows;
+        Attribs.DstComponentCount = DstCount;
+        Attribs.Swizzle           = Swizzle;
+        Attribs.pThreadPool       = pPool;
+        ConvertTextureSubresource(Attribs);
+
+        for (Uint32 z = 0; z < NumSlices; ++z)
+        {
+            for (Uint32 y = 0; y < NumRows; ++y)
+            {
+                const Uint8* pSrcRow = &SrcData[(z * NumRows + y) * SrcStride];
+                const Uint8* pDstRow = &DstData[(z * NumRows + y) * DstStride];
+                for (Uint32 x = 0; x < Width; ++x)
+                {
+                    for (Uint32 c = 0; c < DstCount; ++c)
+                    {
+                        Uint8 Expected = 0;
+                        switch (Swizzle[c])
+                        {
+                            case TEXTURE_COMPONENT_SWIZZLE_ZERO: Expected = 0; break;
+                            case TEXTURE_COMPONENT_SWIZZLE_ONE: Expected = 255; break;
+                            default:
+                            {
+                                const Uint32 SrcIdx = Swizzle[c] == TEXTURE_COMPONENT_SWIZZLE_IDENTITY ? c : Swizzle[c] - TEXTURE_COMPONENT_SWIZZLE_R;
+                                Expected            = SrcIdx < SrcCount ? pSrcRow[x * SrcCount + SrcIdx] : (SrcIdx == 3 ? 255 : 0);
+                            }
+                        }
+                        ASSERT_EQ(pDstRow[x * DstCount + c], Expected) << "Src=" << SrcCount << " Dst=" << DstCount << " x=" << x << " y=" << y << " z=" << z << " c=" << c;
+                    }
+                }
+                for (Uint32 x = Width * DstCount; x < DstStride; ++x)
+                    ASSERT_EQ(pDstRow[x], 0xCD);
+            }
+        }
+    };
+
+    for (Uint32 Width : {1u, 5u, 16u, 37u})
+    {
+        for (Uint32 RowPadding : {0u, 3u})
+        {
+            for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+            {
+                // RGB8 -> RGBA8
+                Test(3, 4, TextureComponentMapping{}, Width, 7, RowPadding, pPool);
+                // RGBA8 -> BGRA8
+                Test(4, 4, TextureComponentMapping{B, G, R, A}, Width, 7, RowPadding, pPool);
+                // BGR8 -> RGBA8
+                Test(3, 4, TextureComponentMapping{B, G, R, I}, Width, 7, RowPadding, pPool);
+                // RGBA8 -> RGB8
+                Test(4, 3, TextureComponentMapping{}, Width, 7, RowPadding, pPool);
+                // R8 -> RRR1
+                Test(1, 4, TextureComponentMapping{R, R, R, O}, Width, 7, RowPadding, pPool);
+                // RG8 -> RG01
+                Test(2, 4, TextureComponentMapping{I, I, Z, O}, Width, 7, RowPadding, pPool);
+                // RGBA8 -> A8
+                Test(4, 1, TextureComponentMapping{A, I, I, I}, Width, 7, RowPadding, pPool);
+                // Identity
+                Test(4, 4, TextureComponentMapping{}, Width, 7, RowPadding, pPool);
+            }
+        }
+    }
+}
+
+TEST(GraphicsAccessories_GraphicsAccessories, ConstexprTextureFormatAttribs)
+{
+    static_assert(GetTextureFormatElementSize(TEX_FORMAT_RGBA8_UNORM) == 4, "Unexpected element size");
+    static_assert(GetTextureFormatElementSize(TEX_FORMAT_RGBA32_FLOAT) == 16, "Unexpected element size");
+    static_assert(GetTextureFormatElementSize(TEX_FORMAT_BC1_UNORM) == 8, "Unexpected block size");
+    static_assert(GetTextureFormatElementSize(TEX_FORMAT_BC7_UNORM) == 16, "Unexpected block size");
+    static_assert(GetTextureFormatComponentCount(TEX_FORMAT_RG16_FLOAT) == 2, "Unexpected component count");
+    static_assert(GetTextureFormatBlockWidth(TEX_FORMAT_BC3_UNORM) == 4 && GetTextureFormatBlockHeight(TEX_FORMAT_BC3_UNORM) == 4, "Unexpected block dimensions");
+    static_assert(GetTextureFormatBlockWidth(TEX_FORMAT_R8_UNORM) == 1 && GetTextureFormatBlockHeight(TEX_FORMAT_R8_UNORM) == 1, "Unexpected block dimensions");
+
+    static_assert(IsTextureFormatCompatibleWithBindFlags(TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE | BIND_RENDER_TARGET | BIND_UNORDERED_ACCESS), "RGBA8 must support SRV, RTV and UAV");
+    static_assert(!IsTextureFormatCompatibleWithBindFlags(TEX_FORMAT_RGBA8_UNORM, BIND_DEPTH_STENCIL), "RGBA8 must not support DSV");
+    static_assert(IsTextureFormatCompatibleWithBindFlags(TEX_FORMAT_D32_FLOAT, BIND_SHADER_RESOURCE | BIND_DEPTH_STENCIL), "D32 must support SRV and DSV");
+    static_assert(!IsTextureFormatCompatibleWithBindFlags(TEX_FORMAT_D24_UNORM_S8_UINT, BIND_RENDER_TARGET), "D24S8 must not support RTV");
+    static_assert(IsTextureFormatCompatibleWithBindFlags(TEX_FORMAT_R32_TYPELESS, BIND_SHADER_RESOURCE | BIND_DEPTH_STENCIL), "R32_TYPELESS must support DSV");
+    static_assert(IsTextureFormatCompatibleWithBindFlags(TEX_FORMAT_BC1_UNORM, BIND_SHADER_RESOURCE), "BC1 must support SRV");
+    static_assert(!IsTextureFormatCompatibleWithBindFlags(TEX_FORMAT_BC1_UNORM, BIND_RENDER_TARGET), "BC1 must not support RTV");
+    static_assert(IsTextureFormatCompatibleWithBindFlags(TEX_FORMAT_R8_UINT, BIND_SHADING_RATE), "R8_UINT must support shading rate");
+    static_assert(GetTextureFormatCompatibleBindFlags(TEX_FORMAT_UNKNOWN) == BIND_NONE, "Unknown format must not support any bind flags");
+
+    for (Uint32 Fmt = TEX_FORMAT_UNKNOWN; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
+    {
+        const TEXTURE_FORMAT        Format     = static_cast<TEXTURE_FORMAT>(Fmt);
+        const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(Format);
+        EXPECT_EQ(FmtAttribs.Format, Format);
+        EXPECT_EQ(GetTextureFormatElementSize(Format), FmtAttribs.GetElementSize());
+        EXPECT_EQ(GetTextureFormatComponentCount(Format), Uint32{FmtAttribs.NumComponents});
+    }
+}
+
 } // namespace
@@ -28,6 +28,7 @@
 #include "GraphicsUtilities.h"
 #include "FastRand.hpp"
 #include "ColorConversion.h"
+#include "ThreadPool.hpp"
 
 #include <vector>
 #include <array>
@@ -557,22 +558,115 @@ TEST(GraphicsTools_CalculateMipLevel, sRGB_BOX_AVE)
             for (Uint32 c = 0; c < NumChannels; ++c)
             {
                 float fLinearAverage =
-                    (FastGammaToLinear(FineData[((x * 2 + 0) + (y * 2 + 0) * FineWidth) * NumChannels + c] / 255.f) +
-                     FastGammaToLinear(FineData[((x * 2 + 1) + (y * 2 + 0) * FineWidth) * NumChannels + c] / 255.f) +
-                     FastGammaToLinear(FineData[((x * 2 + 0) + (y * 2 + 1) * FineWidth) * NumChannels + c] / 255.f) +
-                     FastGammaToLinear(FineData[((x * 2 + 1) + (y * 2 + 1) * FineWidth) * NumChannels + c] / 255.f)) *
+                    (GammaToLinear(FineData[((x * 2 + 0) + (y * 2 + 0) * FineWidth) * NumChannels + c]) +
+                     GammaToLinear(FineData[((x * 2 + 1) + (y * 2 + 0) * FineWidth) * NumChannels + c]) +
+                     GammaToLinear(FineData[((x * 2 + 0) + (y * 2 + 1) * FineWidth) * NumChannels + c]) +
+                     GammaToLinear(FineData[((x * 2 + 1) + (y * 2 + 1) * FineWidth) * NumChannels + c])) *
                     0.25f;
-                fLinearAverage = std::min(std::max(fLinearAverage, 0.f), 255.f);
-                float fSRGB    = FastLinearToGamma(fLinearAverage);
+                float fSRGB = LinearToGamma(fLinearAverage);
 
-                RefCoarseData[(x + y * CoarseWidth) * NumChannels + c] = static_cast<Uint8>(fSRGB * 255.f);
+                RefCoarseData[(x + y * CoarseWidth) * NumChannels + c] = static_cast<Uint8>(std::min(fSRGB * 255.f + 0.5f, 255.f));
             }
         }
     }
 
     std::vector<Uint8> CoarseData(RefCoarseData.size());
     ComputeMipLevel({TEX_FORMAT_RGBA8_UNORM_SRGB, FineWidth, FineHeight, FineData.data(), FineWidth * NumChannels, CoarseData.data(), CoarseWidth * NumChannels});
-    EXPECT_TRUE(CoarseData == RefCoarseData);
+    for (size_t i = 0; i < CoarseData.size(); ++i)
+    {
+        // The linear value is quantized to 12 bits before the conversion to sRGB
+        EXPECT_LE(std::abs(int{CoarseData[i]} - int{RefCoarseData[i]}), 1) << "i=" << i;
+    }
+}
+
+TEST(GraphicsTools_CalculateMipLevel, FLOAT32_BOX_AVE)
+{
+    const Uint32 FineWidth  = 43;
+    const Uint32 FineHeight = 19;
+
+    for (Uint32 NumChannels : {1u, 2u, 4u})
+    {
+        std::vector<float> FineData(FineWidth * FineHeight * NumChannels);
+
+        FastRandFloat rnd(0, -100.f, 100.f);
+        for (float& c : FineData)
+            c = rnd();
+
+        const Uint32 CoarseWidth  = FineWidth / 2;
+        const Uint32 CoarseHeight = FineHeight / 2;
+
+        std::vector<float> RefCoarseData(CoarseWidth * CoarseHeight * NumChannels);
+        for (Uint32 y = 0; y < CoarseHeight; ++y)
+        {
+            for (Uint32 x = 0; x < CoarseWidth; ++x)
+            {
+                for (Uint32 c = 0; c < NumChannels; ++c)
+                {
+                    RefCoarseData[(x + y * CoarseWidth) * NumChannels + c] =
+                        (FineData[((x * 2 + 0) + (y * 2 + 0) * FineWidth) * NumChannels + c] +
+                         FineData[((x * 2 + 1) + (y * 2 + 0) * FineWidth) * NumChannels + c] +
+                         FineData[((x * 2 + 0) + (y * 2 + 1) * FineWidth) * NumChannels + c] +
+                         FineData[((x * 2 + 1) + (y * 2 + 1) * FineWidth) * NumChannels + c]) *
+                        0.25f;
+                }
+            }
+        }
+
+        const TEXTURE_FORMAT Formats[] = {TEX_FORMAT_R32_FLOAT, TEX_FORMAT_RG32_FLOAT, TEX_FORMAT_UNKNOWN, TEX_FORMAT_RGBA32_FLOAT};
+
+        std::vector<float> CoarseData(RefCoarseData.size());
+        ComputeMipLevel({Formats[NumChannels - 1], FineWidth, FineHeight, FineData.data(), FineWidth * NumChannels * sizeof(float), CoarseData.data(), CoarseWidth * NumChannels * sizeof(float)});
+        EXPECT_TRUE(CoarseData == RefCoarseData) << "NumChannels=" << NumChannels;
+    }
+}
+
+TEST(GraphicsTools_CalculateMipLevel, FLOAT16_BOX_AVE)
+{
+    // clang-format off
+    const Uint16 FineData[] =
+        {
+            0x0000, 0x3C00,   0x4000, 0x4200, // 0, 1,   2, 3
+            0x4400, 0x4500,   0xC000, 0xBC00, // 4, 5,  -2, -1
+        };
+    // clang-format on
+
+    Uint16 CoarseData[2] = {};
+    ComputeMipLevel({TEX_FORMAT_R16_FLOAT, 4, 2, FineData, 8, CoarseData, 4});
+    EXPECT_EQ(CoarseData[0], 0x4100); // (0 + 1 + 4 + 5) / 4 = 2.5
+    EXPECT_EQ(CoarseData[1], 0x3800); // (2 + 3 - 2 - 1) / 4 = 0.5
+}
+
+TEST(GraphicsTools_CalculateMipLevel, ThreadPool)
+{
+    const Uint32 FineWidth   = 1025;
+    const Uint32 FineHeight  = 517;
+    const Uint32 NumChannels = 4;
+
+    std::vector<Uint8> FineData(FineWidth * FineHeight * NumChannels);
+
+    FastRandInt rnd(0, 0, 255);
+    for (auto& c : FineData)
+        c = static_cast<Uint8>(rnd());
+
+    const Uint32 CoarseWidth  = FineWidth / 2;
+    const Uint32 CoarseHeight = FineHeight / 2;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    for (TEXTURE_FORMAT Fmt : {TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB})
+    {
+        ComputeMipLevelAttribs Attribs{Fmt, FineWidth, FineHeight, FineData.data(), FineWidth * NumChannels, nullptr, CoarseWidth * NumChannels};
+        Attribs.AlphaCutoff = 0.5f;
+
+        std::vector<Uint8> RefCoarseData(CoarseWidth * CoarseHeight * NumChannels);
+        Attribs.pCoarseMipData = RefCoarseData.data();
+        ComputeMipLevel(Attribs);
+
+        std::vector<Uint8> CoarseData(RefCoarseData.size());
+        Attribs.pCoarseMipData = CoarseData.data();
+        Attribs.pThreadPool    = pThreadPool;
+        ComputeMipLevel(Attribs);
+        EXPECT_TRUE(CoarseData == RefCoarseData);
+    }
 }
 
 } // namespace
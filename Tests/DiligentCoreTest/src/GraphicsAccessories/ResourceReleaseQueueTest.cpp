@@ -26,6 +26,9 @@
  */
 
 #include <memory>
+#include <thread>
+#include <vector>
+#include <atomic>
 
 #include "ResourceReleaseQueue.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
@@ -128,4 +131,98 @@ TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
     }
 }
 
+TEST(GraphicsAccessories_ResourceReleaseQueue, PurgeWithBudget)
+{
+    struct Resource
+    {
+        Resource(int& _Counter) :
+            Counter{_Counter}
+        {}
+        ~Resource()
+        {
+            ++Counter;
+        }
+        int& Counter;
+    };
+
+    int NumDestroyed = 0;
+
+    ResourceReleaseQueue<DynamicStaleResourceWrapper> Queue(DefaultRawMemoryAllocator::GetAllocator());
+    for (Uint64 i = 0; i < 8; ++i)
+        Queue.DiscardResource(std::unique_ptr<Resource>{new Resource{NumDestroyed}}, i < 6 ? 1 : 2);
+
+    EXPECT_EQ(Queue.Purge(1, 2), size_t{2});
+    EXPECT_EQ(NumDestroyed, 2);
+
+    std::vector<DynamicStaleResourceWrapper> Resources;
+    EXPECT_EQ(Queue.ExtractCompletedResources(1, Resources, 3), size_t{3});
+    EXPECT_EQ(Resources.size(), size_t{3});
+    EXPECT_EQ(NumDestroyed, 2);
+    Resources.clear();
+    EXPECT_EQ(NumDestroyed, 5);
+
+    // Only one resource with fence value 1 is left
+    EXPECT_EQ(Queue.ExtractCompletedResources(1, Resources), size_t{1});
+    Resources.clear();
+    EXPECT_EQ(NumDestroyed, 6);
+
+    EXPECT_EQ(Queue.Purge(2), size_t{2});
+    EXPECT_EQ(NumDestroyed, 8);
+    EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), size_t{0});
+}
+
+TEST(GraphicsAccessories_ResourceReleaseQueue, MultithreadedRelease)
+{
+    struct Resource
+    {
+        Resource(std::atomic<int>& _Counter) :
+            Counter{_Counter}
+        {}
+        ~Resource()
+        {
+            ++Counter;
+        }
+        std::atomic<int>& Counter;
+    };
+
+    constexpr int NumThreads            = 8;
+    constexpr int NumResourcesPerThread = 1000;
+
+    std::atomic<int> NumDestroyed{0};
+
+    ResourceReleaseQueue<DynamicStaleResourceWrapper> Queue(DefaultRawMemoryAllocator::GetAllocator());
+
+    std::vector<std::thread> Threads;
+    for (int t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&Queue, &NumDestroyed, t]() {
+            for (int i = 0; i < NumResourcesPerThread; ++i)
+            {
+                if ((t & 0x01) == 0)
+                    Queue.SafeReleaseResource(std::unique_ptr<Resource>{new Resource{NumDestroyed}}, 1);
+                else
+                    Queue.DiscardResource(std::unique_ptr<Resource>{new Resource{NumDestroyed}}, 1);
+            }
+        });
+    }
+
+    // Drain the queue while the worker threads are releasing the resources
+    Uint64 FenceValue = 1;
+    while (NumDestroyed < NumThreads * NumResourcesPerThread / 2)
+    {
+        Queue.DiscardStaleResources(1, FenceValue);
+        Queue.Purge(FenceValue);
+        std::this_thread::yield();
+    }
+
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    Queue.DiscardStaleResources(1, FenceValue);
+    EXPECT_EQ(Queue.GetStaleResourceCount(), size_t{0});
+    Queue.Purge(FenceValue);
+    EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), size_t{0});
+    EXPECT_EQ(NumDestroyed, NumThreads * NumResourcesPerThread);
+}
+
 } // namespace
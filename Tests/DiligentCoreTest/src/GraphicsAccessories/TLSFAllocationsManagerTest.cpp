@@ -0,0 +1,216 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "TLSFAllocationsManager.hpp"
+#include "VariableSizeGPUAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FastRand.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+using OffsetType = TLSFAllocationsManager::OffsetType;
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, AllocateFree)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    TLSFAllocationsManager Mgr(128, Allocator);
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetFreeSize(), OffsetType{128});
+    EXPECT_EQ(Mgr.GetUsedSize(), OffsetType{0});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{128});
+
+    auto a1 = Mgr.Allocate(17, 4);
+    EXPECT_EQ(a1.UnalignedOffset, OffsetType{0});
+    EXPECT_EQ(a1.Size, OffsetType{20});
+    EXPECT_EQ(Mgr.GetFreeSize(), OffsetType{128 - 20});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{128 - 20});
+
+    auto a2 = Mgr.Allocate(17, 8);
+    EXPECT_EQ(a2.UnalignedOffset, OffsetType{20});
+    EXPECT_EQ(a2.Size, OffsetType{28});
+
+    auto a3 = Mgr.Allocate(8, 1);
+    EXPECT_EQ(a3.UnalignedOffset, OffsetType{48});
+    EXPECT_EQ(a3.Size, OffsetType{8});
+
+    auto a4 = Mgr.Allocate(128, 1);
+    EXPECT_FALSE(a4.IsValid());
+
+    // [0, 56) used, [56, 128) free
+    a4 = Mgr.Allocate(72, 1);
+    EXPECT_EQ(a4.UnalignedOffset, OffsetType{56});
+    EXPECT_EQ(a4.Size, OffsetType{72});
+    EXPECT_TRUE(Mgr.IsFull());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{0});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{0});
+
+    Mgr.Free(std::move(a2));
+    EXPECT_FALSE(a2.IsValid());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+    Mgr.Free(a4.UnalignedOffset, a4.Size);
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{72});
+
+    // Merge with both neighbors
+    Mgr.Free(std::move(a3));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{128 - 20});
+
+    Mgr.Free(std::move(a1));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{128});
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, ExactFit)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    TLSFAllocationsManager Mgr(1024, Allocator);
+
+    // Leave the only free block of size 101 that is in the same bin as the request
+    auto a0 = Mgr.Allocate(101, 1);
+    auto a1 = Mgr.Allocate(1024 - 101, 1);
+    ASSERT_TRUE(a0.IsValid() && a1.IsValid());
+    Mgr.Free(std::move(a0));
+
+    a0 = Mgr.Allocate(101, 1);
+    EXPECT_EQ(a0.UnalignedOffset, OffsetType{0});
+    EXPECT_EQ(a0.Size, OffsetType{101});
+
+    Mgr.Free(std::move(a0));
+    Mgr.Free(std::move(a1));
+    EXPECT_TRUE(Mgr.IsEmpty());
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, Extend)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    TLSFAllocationsManager Mgr(64, Allocator);
+
+    auto a0 = Mgr.Allocate(32, 1);
+    auto a1 = Mgr.Allocate(32, 1);
+    EXPECT_TRUE(Mgr.IsFull());
+
+    Mgr.Extend(64);
+    EXPECT_EQ(Mgr.GetMaxSize(), OffsetType{128});
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+    Mgr.Free(std::move(a1));
+    // The freed block is merged with the new one
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{96});
+
+    Mgr.Extend(32);
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{128});
+
+    Mgr.Free(std::move(a0));
+    EXPECT_TRUE(Mgr.IsEmpty());
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, Random)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    constexpr OffsetType MaxSize = 1 << 20;
+    TLSFAllocationsManager Mgr{MaxSize, Allocator};
+
+    FastRandInt SizeRnd{0, 1, 4096};
+    FastRandInt AlignRnd{1, 0, 6};
+    FastRandInt IdxRnd{2, 0, 16383};
+
+    std::vector<TLSFAllocationsManager::Allocation> Allocations;
+    for (Uint32 iter = 0; iter < 16; ++iter)
+    {
+        for (Uint32 i = 0; i < 512; ++i)
+        {
+            auto Allocation = Mgr.Allocate(SizeRnd(), OffsetType{1} << AlignRnd());
+            if (Allocation.IsValid())
+            {
+                EXPECT_LE(Allocation.UnalignedOffset + Allocation.Size, MaxSize);
+                Allocations.emplace_back(Allocation);
+            }
+        }
+
+        // Release random half of the allocations
+        for (size_t i = 0; i < Allocations.size() / 2; ++i)
+        {
+            const size_t Idx = static_cast<size_t>(IdxRnd()) % Allocations.size();
+            Mgr.Free(std::move(Allocations[Idx]));
+            Allocations[Idx] = Allocations.back();
+            Allocations.pop_back();
+        }
+
+        OffsetType UsedSize = 0;
+        for (const auto& Allocation : Allocations)
+            UsedSize += Allocation.Size;
+        EXPECT_EQ(Mgr.GetUsedSize(), UsedSize);
+    }
+
+    for (auto& Allocation : Allocations)
+        Mgr.Free(std::move(Allocation));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), MaxSize);
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, GPUAllocationsManager)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    TLSFGPUAllocationsManager Mgr(128, Allocator);
+
+    auto a0 = Mgr.Allocate(64, 1);
+    auto a1 = Mgr.Allocate(64, 1);
+    EXPECT_TRUE(Mgr.IsFull());
+
+    Mgr.Free(std::move(a0), 1);
+    Mgr.Free(std::move(a1), 2);
+    EXPECT_EQ(Mgr.GetStaleAllocationsSize(), size_t{128});
+    EXPECT_TRUE(Mgr.IsFull());
+
+    Mgr.ReleaseStaleAllocations(1);
+    EXPECT_EQ(Mgr.GetStaleAllocationsSize(), size_t{64});
+    EXPECT_EQ(Mgr.GetFreeSize(), OffsetType{64});
+
+    Mgr.ReleaseStaleAllocations(2);
+    EXPECT_EQ(Mgr.GetStaleAllocationsSize(), size_t{0});
+    EXPECT_TRUE(Mgr.IsEmpty());
+}
+
+} // namespace
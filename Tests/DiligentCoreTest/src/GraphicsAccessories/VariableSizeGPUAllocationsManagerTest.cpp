@@ -249,4 +249,70 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, Free)
     }
 }
 
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateBelow)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+
+    VariableSizeAllocationsManager ListMgr(128, Allocator);
+
+    VariableSizeAllocationsManager::Allocation al[8];
+    for (size_t o = 0; o < _countof(al); ++o)
+        al[o] = ListMgr.Allocate(16, 1);
+    EXPECT_TRUE(ListMgr.IsFull());
+    EXPECT_EQ(ListMgr.GetFirstFreeBlockOffset(), OffsetType{128});
+
+    // Free blocks: [16, 32), [48, 80)
+    ListMgr.Free(std::move(al[1]));
+    ListMgr.Free(std::move(al[3]));
+    ListMgr.Free(std::move(al[4]));
+    EXPECT_EQ(ListMgr.GetFirstFreeBlockOffset(), OffsetType{16});
+
+    // Best fit picks the smallest block
+    {
+        auto a = ListMgr.Allocate(8, 1);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{16});
+        ListMgr.Free(std::move(a));
+    }
+
+    // The block must end at or before MaxEndOffset
+    EXPECT_FALSE(ListMgr.AllocateBelow(32, 1, 64).IsValid());
+    EXPECT_FALSE(ListMgr.AllocateBelow(8, 1, 16).IsValid());
+
+    // First fit picks the lowest block
+    {
+        auto a = ListMgr.AllocateBelow(24, 1, 128);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{48});
+        EXPECT_EQ(a.Size, OffsetType{24});
+        ListMgr.Free(std::move(a));
+    }
+    {
+        auto a = ListMgr.AllocateBelow(8, 1, 112);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{16});
+        EXPECT_EQ(a.Size, OffsetType{8});
+        EXPECT_EQ(ListMgr.GetFirstFreeBlockOffset(), OffsetType{24});
+        ListMgr.Free(std::move(a));
+    }
+
+    // Allocation size is aligned too, so 32 bytes at offset 64 do not fit into [48, 80)
+    EXPECT_FALSE(ListMgr.AllocateBelow(16, 32, 128).IsValid());
+
+    // Free blocks: [16, 32), [48, 96)
+    ListMgr.Free(std::move(al[5]));
+    {
+        auto a = ListMgr.AllocateBelow(16, 32, 128);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{48});
+        EXPECT_EQ(a.Size, OffsetType{48});
+        ListMgr.Free(std::move(a));
+    }
+
+    for (size_t o = 0; o < _countof(al); ++o)
+    {
+        if (al[o].IsValid())
+            ListMgr.Free(std::move(al[o]));
+    }
+    EXPECT_TRUE(ListMgr.IsEmpty());
+}
+
 } // namespace
@@ -0,0 +1,279 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "../../../../Graphics/GraphicsEngine/include/DeviceObjectArchive.hpp"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "EngineMemory.h"
+#include "DataBlobImpl.hpp"
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+using ResourceType = DeviceObjectArchive::ResourceType;
+using DeviceType   = DeviceObjectArchive::DeviceType;
+using ResourceData = DeviceObjectArchive::ResourceData;
+
+SerializedData MakeTestData(size_t Size, Uint8 Pattern)
+{
+    SerializedData Data{Size, GetRawAllocator()};
+    for (size_t i = 0; i < Size; ++i)
+        Data.Ptr<Uint8>()[i] = static_cast<Uint8>(Pattern + i);
+    return Data;
+}
+
+bool IsEqual(const SerializedData& Data1, const SerializedData& Data2)
+{
+    return Data1.Size() == Data2.Size() && (Data1.Size() == 0 || memcmp(Data1.Ptr(), Data2.Ptr(), Data1.Size()) == 0);
+}
+
+constexpr Uint32 NumTestResources = 64;
+constexpr Uint32 NumTestShaders   = 16;
+
+ResourceType GetTestResourceType(Uint32 Idx)
+{
+    return Idx % 2 == 0 ? ResourceType::RenderPass : ResourceType::ResourceSignature;
+}
+
+std::string GetTestResourceName(Uint32 Idx)
+{
+    // Reverse the order to make sure that the index is sorted when serialized
+    return "Resource " + std::to_string(NumTestResources - Idx);
+}
+
+void InitTestArchive(DeviceObjectArchive& Archive)
+{
+    for (Uint32 i = 0; i < NumTestResources; ++i)
+    {
+        ResourceData& Data = Archive.GetResourceData(GetTestResourceType(i), GetTestResourceName(i).c_str());
+
+        Data.Common = MakeTestData(16 + i, static_cast<Uint8>(i));
+
+        Data.DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)] = MakeTestData(4 + i % 7, static_cast<Uint8>(i + 1));
+        if (i % 3 == 0)
+            Data.DeviceSpecific[static_cast<size_t>(DeviceType::Direct3D12)] = MakeTestData(1 + i % 5, static_cast<Uint8>(i + 2));
+    }
+
+    for (Uint32 i = 0; i < NumTestShaders; ++i)
+    {
+        Archive.GetDeviceShaders(DeviceType::Vulkan).emplace_back(MakeTestData(100 + i * 3, static_cast<Uint8>(i)));
+        if (i % 2 == 0)
+            Archive.GetDeviceShaders(DeviceType::Direct3D12).emplace_back(MakeTestData(50 + i, static_cast<Uint8>(i + 3)));
+    }
+}
+
+void VerifyTestArchive(const DeviceObjectArchive& Archive)
+{
+    DeviceObjectArchive RefArchive;
+    InitTestArchive(RefArchive);
+
+    for (Uint32 i = 0; i < NumTestResources; ++i)
+    {
+        const ResourceType Type = GetTestResourceType(i);
+        const std::string  Name = GetTestResourceName(i);
+
+        ResourceData Data;
+        const char*  ArchivedName = Archive.FindResource(Type, Name.c_str(), Data);
+        ASSERT_NE(ArchivedName, nullptr) << Name;
+        EXPECT_STREQ(ArchivedName, Name.c_str());
+        EXPECT_TRUE(Archive.HasResource(Type, Name.c_str()));
+
+        const ResourceData& RefData = RefArchive.GetResourceData(Type, Name.c_str());
+        EXPECT_TRUE(IsEqual(Data.Common, RefData.Common));
+        for (size_t dev = 0; dev < Data.DeviceSpecific.size(); ++dev)
+        {
+            EXPECT_TRUE(IsEqual(Data.DeviceSpecific[dev], RefData.DeviceSpecific[dev]));
+            EXPECT_TRUE(IsEqual(Archive.GetDeviceSpecificData(Type, Name.c_str(), static_cast<DeviceType>(dev)), RefData.DeviceSpecific[dev]));
+        }
+
+        // Same name, different type
+        const ResourceType OtherType = Type == ResourceType::RenderPass ? ResourceType::ResourceSignature : ResourceType::RenderPass;
+        EXPECT_FALSE(Archive.HasResource(OtherType, Name.c_str()));
+    }
+    EXPECT_FALSE(Archive.HasResource(ResourceType::RenderPass, "Missing resource"));
+    EXPECT_FALSE(Archive.HasResource(ResourceType::GraphicsPipeline, GetTestResourceName(0).c_str()));
+
+    Uint32 NumResources = 0;
+    Archive.ProcessResources([&](ResourceType Type, const char* Name, const ResourceData& Data) {
+        EXPECT_TRUE(RefArchive.HasResource(Type, Name));
+        ++NumResources;
+    });
+    EXPECT_EQ(NumResources, NumTestResources);
+
+    for (size_t dev = 0; dev < static_cast<size_t>(DeviceType::Count); ++dev)
+    {
+        const DeviceType DevType = static_cast<DeviceType>(dev);
+        ASSERT_EQ(Archive.GetNumShaders(DevType), RefArchive.GetNumShaders(DevType));
+        for (size_t i = 0; i < Archive.GetNumShaders(DevType); ++i)
+        {
+            EXPECT_TRUE(IsEqual(Archive.GetSerializedShader(DevType, i), RefArchive.GetSerializedShader(DevType, i)));
+        }
+        EXPECT_FALSE(Archive.GetSerializedShader(DevType, Archive.GetNumShaders(DevType)));
+    }
+}
+
+TEST(DeviceObjectArchiveTest, SerializeDeserialize)
+{
+    DeviceObjectArchive Archive{123};
+    InitTestArchive(Archive);
+    VerifyTestArchive(Archive);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    for (bool MakeCopy : {false, true})
+    {
+        DeviceObjectArchive Archive2{DeviceObjectArchive::CreateInfo{pData, 123, MakeCopy}};
+        EXPECT_EQ(Archive2.GetContentVersion(), 123u);
+        VerifyTestArchive(Archive2);
+
+        // Serializing the loaded archive must produce the same data
+        RefCntAutoPtr<IDataBlob> pData2;
+        Archive2.Serialize(&pData2);
+        ASSERT_NE(pData2, nullptr);
+        ASSERT_EQ(pData2->GetSize(), pData->GetSize());
+        EXPECT_EQ(memcmp(pData2->GetConstDataPtr(), pData->GetConstDataPtr(), pData->GetSize()), 0);
+    }
+}
+
+TEST(DeviceObjectArchiveTest, Modify)
+{
+    RefCntAutoPtr<IDataBlob> pData;
+    {
+        DeviceObjectArchive Archive;
+        InitTestArchive(Archive);
+        Archive.Serialize(&pData);
+        ASSERT_NE(pData, nullptr);
+    }
+
+    {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+
+        DeviceObjectArchive MergedArchive;
+        MergedArchive.Merge(Archive);
+        VerifyTestArchive(MergedArchive);
+    }
+
+    {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+        Archive.RemoveDeviceData(DeviceType::Direct3D12);
+        EXPECT_EQ(Archive.GetNumShaders(DeviceType::Direct3D12), size_t{0});
+        EXPECT_EQ(Archive.GetNumShaders(DeviceType::Vulkan), size_t{NumTestShaders});
+
+        const std::string Name = GetTestResourceName(0);
+        EXPECT_FALSE(Archive.GetDeviceSpecificData(GetTestResourceType(0), Name.c_str(), DeviceType::Direct3D12));
+        EXPECT_TRUE(Archive.GetDeviceSpecificData(GetTestResourceType(0), Name.c_str(), DeviceType::Vulkan));
+
+        DeviceObjectArchive Archive2{DeviceObjectArchive::CreateInfo{pData}};
+        Archive.AppendDeviceData(Archive2, DeviceType::Direct3D12);
+        VerifyTestArchive(Archive);
+    }
+}
+
+TEST(DeviceObjectArchiveTest, Compression)
+{
+    RefCntAutoPtr<IDataBlob> pData;
+    RefCntAutoPtr<IDataBlob> pCompressedData;
+    {
+        DeviceObjectArchive Archive;
+        InitTestArchive(Archive);
+        Archive.Serialize(&pData);
+        ASSERT_NE(pData, nullptr);
+        Archive.Serialize(&pCompressedData, DeviceObjectArchive::ShaderCompression::LZ4);
+        ASSERT_NE(pCompressedData, nullptr);
+    }
+    EXPECT_LT(pCompressedData->GetSize(), pData->GetSize());
+
+    {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pCompressedData}};
+        VerifyTestArchive(Archive);
+
+        // Decompressing the archive must produce the original data
+        RefCntAutoPtr<IDataBlob> pDecompressedData;
+        Archive.Serialize(&pDecompressedData);
+        ASSERT_NE(pDecompressedData, nullptr);
+        ASSERT_EQ(pDecompressedData->GetSize(), pData->GetSize());
+        EXPECT_EQ(memcmp(pDecompressedData->GetConstDataPtr(), pData->GetConstDataPtr(), pData->GetSize()), 0);
+
+        // Compression must be deterministic
+        RefCntAutoPtr<IDataBlob> pCompressedData2;
+        Archive.Serialize(&pCompressedData2, DeviceObjectArchive::ShaderCompression::LZ4);
+        ASSERT_NE(pCompressedData2, nullptr);
+        ASSERT_EQ(pCompressedData2->GetSize(), pCompressedData->GetSize());
+        EXPECT_EQ(memcmp(pCompressedData2->GetConstDataPtr(), pCompressedData->GetConstDataPtr(), pCompressedData->GetSize()), 0);
+    }
+
+    {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pCompressedData}};
+
+        DeviceObjectArchive MergedArchive;
+        MergedArchive.Merge(Archive);
+        VerifyTestArchive(MergedArchive);
+
+        Archive.RemoveDeviceData(DeviceType::Direct3D12);
+        Archive.AppendDeviceData(DeviceObjectArchive{DeviceObjectArchive::CreateInfo{pCompressedData}}, DeviceType::Direct3D12);
+        VerifyTestArchive(Archive);
+    }
+}
+
+TEST(DeviceObjectArchiveTest, InvalidData)
+{
+    RefCntAutoPtr<IDataBlob> pData;
+    {
+        DeviceObjectArchive Archive;
+        InitTestArchive(Archive);
+        Archive.Serialize(&pData);
+        ASSERT_NE(pData, nullptr);
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Invalid archive content version"};
+
+        DeviceObjectArchive Archive;
+        EXPECT_FALSE(Archive.Deserialize(DeviceObjectArchive::CreateInfo{pData, 1}));
+    }
+
+    {
+        RefCntAutoPtr<DataBlobImpl> pTruncatedData = DataBlobImpl::Create(pData->GetSize() / 2, pData->GetConstDataPtr());
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"Invalid"};
+
+        DeviceObjectArchive Archive;
+        EXPECT_FALSE(Archive.Deserialize(DeviceObjectArchive::CreateInfo{pTruncatedData}));
+    }
+}
+
+} // namespace
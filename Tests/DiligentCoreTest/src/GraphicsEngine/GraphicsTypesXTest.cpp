@@ -1132,6 +1132,33 @@ TEST(GraphicsTypesXTest, ComputePipelineStateCreateInfoX)
         ComputePipelineStateCreateInfoX DescX{std::string{"Test "} + std::string{"Name"}};
         EXPECT_STREQ(DescX.PSODesc.Name, "Test Name");
     }
+
+    const Uint32 SpecData[] = {1, 2};
+
+    ComputePipelineStateCreateInfoX DescX;
+    DescX
+        .AddSpecializationConstant("Const0", SHADER_TYPE_COMPUTE, Uint32{sizeof(Uint32)}, &SpecData[0])
+        .AddSpecializationConstant("Const1", SHADER_TYPE_COMPUTE, Uint32{sizeof(Uint32)}, &SpecData[1]);
+
+    const SpecializationConstant RefConsts[] = {
+        {"Const0", SHADER_TYPE_COMPUTE, sizeof(Uint32), &SpecData[0]},
+        {"Const1", SHADER_TYPE_COMPUTE, sizeof(Uint32), &SpecData[1]},
+    };
+    ComputePipelineStateCreateInfo Ref;
+    Ref.NumSpecializationConstants = _countof(RefConsts);
+    Ref.pSpecializationConstants   = RefConsts;
+    EXPECT_EQ(DescX, Ref);
+    // Data must be copied
+    EXPECT_NE(DescX.pSpecializationConstants[0].pData, &SpecData[0]);
+
+    {
+        ComputePipelineStateCreateInfoX DescX2{Ref};
+        EXPECT_EQ(DescX2, Ref);
+        EXPECT_EQ(DescX2, DescX);
+    }
+
+    DescX.ClearSpecializationConstants();
+    EXPECT_EQ(DescX, ComputePipelineStateCreateInfo{});
 }
 
 
@@ -239,6 +239,16 @@ TEST(PSOSerializerTest, SerializePRSDesc)
             EXPECT_EQ(Data.Size(), WSer.GetSize());
         }
 
+        {
+            DynamicLinearAllocator ChunkAllocator{GetRawAllocator(), 64};
+
+            Serializer<SerializerMode::WriteGrowable> GSer{ChunkAllocator, 16};
+            EXPECT_TRUE(PRSSerializer<SerializerMode::WriteGrowable>::SerializeDesc(GSer, SrcPRSDesc, nullptr));
+            EXPECT_TRUE(PRSSerializer<SerializerMode::WriteGrowable>::SerializeInternalData<TestPRSInternalData>(GSer, SrcInternalData, nullptr));
+
+            EXPECT_EQ(Data, GSer.GetData(GetRawAllocator()));
+        }
+
         PipelineResourceSignatureDesc DstPRSDesc;
         TestPRSInternalData           DstInternalData;
         {
@@ -262,6 +272,16 @@ static void TestSerializePSOCreateInfo(HelperType&& Helper)
 {
     const String PRSNames[] = {"PRS-1", "Signature-2", "ResSign-3", "PRS-4", "Signature-5", "ResSign-6"};
 
+    const Uint32 SpecData0    = 0x12345678u;
+    const float  SpecData1[3] = {1.f, 2.f, 3.f};
+    const Uint8  SpecData2    = 7;
+
+    const std::array<SpecializationConstant, 3> SpecConsts{
+        SpecializationConstant{"SpecConst0", SHADER_TYPE_VERTEX, sizeof(SpecData0), &SpecData0},
+        SpecializationConstant{"SpecConst1", SHADER_TYPE_PIXEL | SHADER_TYPE_COMPUTE, sizeof(SpecData1), SpecData1},
+        SpecializationConstant{"SpecConst2", SHADER_TYPE_ALL_GRAPHICS, sizeof(SpecData2), &SpecData2},
+    };
+
     ValueIterator Val;
     do
     {
@@ -272,6 +292,9 @@ static void TestSerializePSOCreateInfo(HelperType&& Helper)
         SrcPSO.Flags                   = Val(PSO_CREATE_FLAG_NONE, (PSO_CREATE_FLAG_LAST << 1) - 1);
         SrcPSO.ResourceSignaturesCount = Val(1u, _countof(PRSNames));
 
+        SrcPSO.NumSpecializationConstants = Val(0u, static_cast<Uint32>(SpecConsts.size()));
+        SrcPSO.pSpecializationConstants   = SrcPSO.NumSpecializationConstants > 0 ? SpecConsts.data() : nullptr;
+
         for (Uint32 i = 0; i < SrcPSO.ResourceSignaturesCount; ++i)
             SrcPRSNames[i] = PRSNames[i].c_str();
 
@@ -433,7 +456,7 @@ TEST(PSOSerializerTest, SerializeGraphicsPSOCreateInfo)
             GraphicsPipeline.SmplDesc.Count   = Val(Uint8{0}, Uint8{64});
             GraphicsPipeline.SmplDesc.Quality = Val(Uint8{0}, Uint8{8});
 
-            ASSERT_SIZEOF64(GraphicsPipelineStateCreateInfo, 344, "Did you add a new member to GraphicsPipelineStateCreateInfo? Please add serialization test here.");
+            ASSERT_SIZEOF64(GraphicsPipelineStateCreateInfo, 360, "Did you add a new member to GraphicsPipelineStateCreateInfo? Please add serialization test here.");
         }
 
         void Measure(Serializer<SerializerMode::Measure>& Ser, const GraphicsPipelineStateCreateInfo& CI, const TPRSNames& PRSNames)
@@ -665,6 +688,7 @@ TEST(PSOSerializerTest, SerializeRenderPassDesc)
             Subpass.InputAttachmentCount        = Val(0u, 2u);
             Subpass.RenderTargetAttachmentCount = Val(0u, SrcRP.AttachmentCount);
             Subpass.PreserveAttachmentCount     = Val(0u, SrcRP.AttachmentCount);
+            Subpass.ViewMask                    = Val(0u, 3u);
 
             const auto HasDepthStencil       = Val.Bool();
             const auto HasShadingRate        = Val.Bool();
@@ -746,6 +770,14 @@ TEST(PSOSerializerTest, SerializeRenderPassDesc)
 
         EXPECT_EQ(Data.Size(), WSer.GetSize());
 
+        {
+            DynamicLinearAllocator ChunkAllocator{GetRawAllocator(), 64};
+
+            Serializer<SerializerMode::WriteGrowable> GSer{ChunkAllocator, 16};
+            EXPECT_TRUE(RPSerializer<SerializerMode::WriteGrowable>::SerializeDesc(GSer, SrcRP, nullptr));
+            EXPECT_EQ(Data, GSer.GetData(GetRawAllocator()));
+        }
+
         RenderPassDesc DstRP;
 
         Serializer<SerializerMode::Read> RSer{Data};
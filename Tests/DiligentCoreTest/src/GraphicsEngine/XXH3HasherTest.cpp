@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "XXH3Hasher.hpp"
+
+#include <array>
+#include <unordered_set>
+
+#include "CommonlyUsedStates.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+template <typename Type>
+size_t GetXXH3Hash(const Type& Val)
+{
+    return XXH3StdHasher<Type>{}(Val);
+}
+
+TEST(XXH3HasherTest, FundamentalTypes)
+{
+    auto Hash = [](auto... Args) {
+        XXH3Hasher Hasher;
+        Hasher(Args...);
+        return Hasher.Get();
+    };
+
+    EXPECT_EQ(Hash(Uint32{1}, 2.5f, TEX_FORMAT_RGBA8_UNORM), Hash(Uint32{1}, 2.5f, TEX_FORMAT_RGBA8_UNORM));
+    EXPECT_NE(Hash(Uint32{1}, 2.5f, TEX_FORMAT_RGBA8_UNORM), Hash(Uint32{1}, 2.5f, TEX_FORMAT_RGBA8_UNORM_SRGB));
+    EXPECT_NE(Hash(Uint32{1}, Uint32{2}), Hash(Uint32{2}, Uint32{1}));
+
+    // Null and empty strings must produce different hashes
+    EXPECT_NE(Hash(static_cast<const char*>(nullptr)), Hash(""));
+    EXPECT_EQ(Hash("Name"), Hash(std::string{"Name"}.c_str()));
+    EXPECT_NE(Hash("Name1", "Name2"), Hash("Name1Name2", ""));
+}
+
+TEST(XXH3HasherTest, Spans)
+{
+    std::vector<Uint32> Data(1024);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint32>(i * 7919u);
+
+    for (size_t Count : {size_t{1}, size_t{16}, size_t{63}, size_t{64}, size_t{65}, size_t{1024}})
+    {
+        XXH3Hasher Hasher1;
+        Hasher1(Uint32{1});
+        Hasher1.UpdateSpan(Data.data(), Count);
+        Hasher1(Uint32{2});
+
+        XXH3Hasher Hasher2;
+        Hasher2(Uint32{1});
+        Hasher2.UpdateSpan(Data.data(), Count);
+        Hasher2(Uint32{2});
+        EXPECT_EQ(Hasher1.Get(), Hasher2.Get()) << Count;
+
+        XXH3Hasher Hasher3;
+        Hasher3(Uint32{1});
+        Data[Count - 1] += 1;
+        Hasher3.UpdateSpan(Data.data(), Count);
+        Data[Count - 1] -= 1;
+        Hasher3(Uint32{2});
+        EXPECT_NE(Hasher1.Get(), Hasher3.Get()) << Count;
+    }
+}
+
+TEST(XXH3HasherTest, EngineStructs)
+{
+    EXPECT_EQ(GetXXH3Hash(Sam_LinearClamp), GetXXH3Hash(Sam_LinearClamp));
+    EXPECT_NE(GetXXH3Hash(Sam_LinearClamp), GetXXH3Hash(Sam_PointWrap));
+
+    EXPECT_EQ(GetXXH3Hash(BS_Default), GetXXH3Hash(BS_Default));
+    EXPECT_NE(GetXXH3Hash(BS_Default), GetXXH3Hash(BS_AlphaBlend));
+
+    constexpr LayoutElement Elems1[] = {
+        LayoutElement{0, 0, 3, VT_FLOAT32},
+        LayoutElement{1, 0, 2, VT_FLOAT32},
+    };
+    constexpr LayoutElement Elems2[] = {
+        LayoutElement{0, 0, 3, VT_FLOAT32},
+        LayoutElement{1, 0, 4, VT_FLOAT32},
+    };
+
+    GraphicsPipelineDesc GraphicsPipeline1;
+    GraphicsPipeline1.NumRenderTargets = 2;
+    GraphicsPipeline1.RTVFormats[0]    = TEX_FORMAT_RGBA8_UNORM;
+    GraphicsPipeline1.RTVFormats[1]    = TEX_FORMAT_RG16_FLOAT;
+    GraphicsPipeline1.DSVFormat        = TEX_FORMAT_D32_FLOAT;
+    GraphicsPipeline1.BlendDesc        = BS_AlphaBlend;
+    GraphicsPipeline1.InputLayout      = {Elems1, _countof(Elems1)};
+
+    GraphicsPipelineDesc GraphicsPipeline2 = GraphicsPipeline1;
+
+    EXPECT_EQ(GetXXH3Hash(GraphicsPipeline1), GetXXH3Hash(GraphicsPipeline2));
+
+    GraphicsPipeline2.InputLayout = {Elems2, _countof(Elems2)};
+    EXPECT_NE(GetXXH3Hash(GraphicsPipeline1), GetXXH3Hash(GraphicsPipeline2));
+
+    GraphicsPipeline2               = GraphicsPipeline1;
+    GraphicsPipeline2.RTVFormats[1] = TEX_FORMAT_RG16_UNORM;
+    EXPECT_NE(GetXXH3Hash(GraphicsPipeline1), GetXXH3Hash(GraphicsPipeline2));
+
+    std::unordered_set<GraphicsPipelineDesc, XXH3StdHasher<GraphicsPipelineDesc>> Descs;
+    Descs.emplace(GraphicsPipeline1);
+    Descs.emplace(GraphicsPipeline2);
+    Descs.emplace(GraphicsPipeline1);
+    EXPECT_EQ(Descs.size(), 2u);
+}
+
+} // namespace
@@ -27,9 +27,12 @@
 #include "BytecodeCache.h"
 #include "DataBlobImpl.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
+#include "FileSystem.hpp"
+#include "TempDirectory.hpp"
 #include "gtest/gtest.h"
 
 using namespace Diligent;
+using namespace Diligent::Testing;
 
 namespace
 {
@@ -186,4 +189,108 @@ TEST(BytecodeCacheTest, Include)
     }
 }
 
+TEST(BytecodeCacheTest, Directory)
+{
+    TempDirectory TmpDir;
+    const std::string CacheDir = TmpDir.Get() + FileSystem::SlashSymbol + "BytecodeCache";
+
+    BytecodeCacheCreateInfo CacheCI{RENDER_DEVICE_TYPE_VULKAN};
+    CacheCI.Directory = CacheDir.c_str();
+
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+    ShaderCI.Desc.Name       = "TestName";
+    ShaderCI.Source          = "SomeCode";
+
+    const std::string Data{"TestString"};
+    auto              pBytecodeSaved = DataBlobImpl::Create(Data.length(), Data.c_str());
+
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CacheCI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+        pCache->AddBytecode(ShaderCI, pBytecodeSaved);
+    }
+
+    // Entries must persist across cache instances
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache(CacheCI, &pCache);
+    ASSERT_NE(pCache, nullptr);
+    {
+        RefCntAutoPtr<IDataBlob> pBytecodeLoaded;
+        pCache->GetBytecode(ShaderCI, &pBytecodeLoaded);
+        ASSERT_NE(pBytecodeLoaded, nullptr);
+        EXPECT_EQ(pBytecodeSaved->GetSize(), pBytecodeLoaded->GetSize());
+        EXPECT_EQ(memcmp(pBytecodeSaved->GetConstDataPtr(), pBytecodeLoaded->GetConstDataPtr(), pBytecodeLoaded->GetSize()), 0);
+    }
+
+    {
+        RefCntAutoPtr<IDataBlob> pShaderDataBlob;
+        pCache->Store(&pShaderDataBlob);
+        ASSERT_NE(pShaderDataBlob, nullptr);
+        pCache->Clear();
+
+        RefCntAutoPtr<IDataBlob> pBytecodeLoaded;
+        pCache->GetBytecode(ShaderCI, &pBytecodeLoaded);
+        EXPECT_EQ(pBytecodeLoaded, nullptr);
+
+        EXPECT_TRUE(pCache->Load(pShaderDataBlob));
+        pCache->GetBytecode(ShaderCI, &pBytecodeLoaded);
+        EXPECT_NE(pBytecodeLoaded, nullptr);
+    }
+
+    pCache->RemoveBytecode(ShaderCI);
+    {
+        RefCntAutoPtr<IDataBlob> pBytecodeLoaded;
+        pCache->GetBytecode(ShaderCI, &pBytecodeLoaded);
+        EXPECT_EQ(pBytecodeLoaded, nullptr);
+    }
+}
+
+TEST(BytecodeCacheTest, DirectorySizeLimit)
+{
+    TempDirectory TmpDir;
+    const std::string CacheDir = TmpDir.Get() + FileSystem::SlashSymbol + "BytecodeCache";
+
+    constexpr size_t DataSize = 1024;
+
+    BytecodeCacheCreateInfo CacheCI{RENDER_DEVICE_TYPE_VULKAN};
+    CacheCI.Directory        = CacheDir.c_str();
+    CacheCI.MaxDirectorySize = DataSize * 3;
+
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache(CacheCI, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    const std::string Data(DataSize, 'x');
+    const char*       Sources[] = {"Code0", "Code1", "Code2", "Code3", "Code4", "Code5"};
+    for (const char* Source : Sources)
+    {
+        ShaderCreateInfo ShaderCI{};
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+        ShaderCI.Desc.Name       = "TestName";
+        ShaderCI.Source          = Source;
+        pCache->AddBytecode(ShaderCI, DataBlobImpl::Create(Data.length(), Data.c_str()));
+    }
+
+    Uint64 TotalSize = 0;
+    for (const auto& Entry : FileSystem::Search((CacheDir + FileSystem::SlashSymbol + "*").c_str()))
+    {
+        FileInfo Info;
+        ASSERT_TRUE(FileSystem::GetFileInfo((CacheDir + FileSystem::SlashSymbol + Entry.Name).c_str(), Info));
+        TotalSize += Info.Size;
+    }
+    EXPECT_LE(TotalSize, CacheCI.MaxDirectorySize);
+
+    // The most recently added entry must survive the trimming
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+    ShaderCI.Desc.Name       = "TestName";
+    ShaderCI.Source          = Sources[_countof(Sources) - 1];
+
+    RefCntAutoPtr<IDataBlob> pBytecode;
+    pCache->GetBytecode(ShaderCI, &pBytecode);
+    EXPECT_NE(pBytecode, nullptr);
+}
+
 } // namespace
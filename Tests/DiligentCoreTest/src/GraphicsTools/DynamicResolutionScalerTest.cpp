@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "DynamicResolutionController.hpp"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr double TargetFrameTime = 1.0 / 60.0;
+
+bool IsMultipleOfStep(float Scale, float Step)
+{
+    const float NumSteps = Scale / Step;
+    return std::abs(NumSteps - std::round(NumSteps)) < 1e-4f;
+}
+
+TEST(GraphicsTools_DynamicResolutionScaler, InitialScale)
+{
+    DynamicResolutionScalerDesc Desc;
+    Desc.MaxScale = 0.9f;
+
+    DynamicResolutionScaler Scaler{Desc};
+    EXPECT_FLOAT_EQ(Scaler.GetScale(), 0.9f);
+    EXPECT_EQ(Scaler.GetFilteredFrameTime(), 0.0);
+}
+
+TEST(GraphicsTools_DynamicResolutionScaler, Decrease)
+{
+    DynamicResolutionScaler Scaler;
+
+    // The first over-budget frame does not change the scale
+    EXPECT_FALSE(Scaler.Update(0.025));
+    EXPECT_FLOAT_EQ(Scaler.GetScale(), 1.f);
+
+    // The scale is reduced in proportion to the square root of the frame time excess
+    EXPECT_TRUE(Scaler.Update(0.025));
+    EXPECT_NEAR(Scaler.GetScale(), 0.75f, 1e-5f);
+    EXPECT_TRUE(IsMultipleOfStep(Scaler.GetScale(), Scaler.GetDesc().ScaleStep));
+
+    // The frame time history is reset after the scale change
+    EXPECT_EQ(Scaler.GetFilteredFrameTime(), 0.0);
+}
+
+TEST(GraphicsTools_DynamicResolutionScaler, DecreaseByAtLeastOneStep)
+{
+    DynamicResolutionScaler Scaler;
+
+    const double FrameTime = TargetFrameTime * 0.96;
+    EXPECT_FALSE(Scaler.Update(FrameTime));
+    EXPECT_TRUE(Scaler.Update(FrameTime));
+    EXPECT_NEAR(Scaler.GetScale(), 0.95f, 1e-5f);
+}
+
+TEST(GraphicsTools_DynamicResolutionScaler, Hysteresis)
+{
+    DynamicResolutionScaler Scaler;
+    Scaler.SetScale(0.75f);
+
+    // Frame times within the hysteresis band never change the scale
+    for (Uint32 i = 0; i < 200; ++i)
+    {
+        EXPECT_FALSE(Scaler.Update(TargetFrameTime * (i % 2 == 0 ? 0.8 : 0.9)));
+    }
+    EXPECT_NEAR(Scaler.GetScale(), 0.75f, 1e-5f);
+}
+
+TEST(GraphicsTools_DynamicResolutionScaler, Spike)
+{
+    DynamicResolutionScalerDesc Desc;
+    Desc.SmoothingFactor = 1;
+
+    DynamicResolutionScaler Scaler{Desc};
+    for (Uint32 i = 0; i < 10; ++i)
+    {
+        // A single slow frame does not change the scale
+        EXPECT_FALSE(Scaler.Update(TargetFrameTime * 0.85));
+        EXPECT_FALSE(Scaler.Update(TargetFrameTime * 2));
+    }
+    EXPECT_FLOAT_EQ(Scaler.GetScale(), 1.f);
+}
+
+TEST(GraphicsTools_DynamicResolutionScaler, SlowIncrease)
+{
+    DynamicResolutionScaler Scaler;
+    Scaler.SetScale(0.5f);
+
+    const DynamicResolutionScalerDesc& Desc = Scaler.GetDesc();
+    for (Uint32 i = 0; i + 1 < Desc.NumFramesToIncrease; ++i)
+    {
+        EXPECT_FALSE(Scaler.Update(TargetFrameTime * 0.25));
+    }
+    // Even a very fast frame raises the scale by a single step
+    EXPECT_TRUE(Scaler.Update(TargetFrameTime * 0.25));
+    EXPECT_NEAR(Scaler.GetScale(), 0.5f + Desc.ScaleStep, 1e-5f);
+
+    // Resetting the history also resets the increase counter
+    for (Uint32 i = 0; i + 1 < Desc.NumFramesToIncrease; ++i)
+    {
+        EXPECT_FALSE(Scaler.Update(TargetFrameTime * 0.25));
+    }
+    Scaler.Reset();
+    EXPECT_FALSE(Scaler.Update(TargetFrameTime * 0.25));
+    EXPECT_NEAR(Scaler.GetScale(), 0.5f + Desc.ScaleStep, 1e-5f);
+}
+
+TEST(GraphicsTools_DynamicResolutionScaler, Clamp)
+{
+    DynamicResolutionScaler Scaler;
+    const DynamicResolutionScalerDesc& Desc = Scaler.GetDesc();
+
+    for (Uint32 i = 0; i < 100; ++i)
+    {
+        Scaler.Update(TargetFrameTime * 10);
+        EXPECT_GE(Scaler.GetScale(), Desc.MinScale);
+    }
+    EXPECT_FLOAT_EQ(Scaler.GetScale(), Desc.MinScale);
+    EXPECT_FALSE(Scaler.Update(TargetFrameTime * 10));
+
+    for (Uint32 i = 0; i < 10000; ++i)
+    {
+        Scaler.Update(TargetFrameTime * 0.1);
+        EXPECT_LE(Scaler.GetScale(), Desc.MaxScale);
+        EXPECT_TRUE(IsMultipleOfStep(Scaler.GetScale(), Desc.ScaleStep));
+    }
+    EXPECT_FLOAT_EQ(Scaler.GetScale(), Desc.MaxScale);
+
+    Scaler.SetScale(2);
+    EXPECT_FLOAT_EQ(Scaler.GetScale(), Desc.MaxScale);
+    Scaler.SetScale(0);
+    EXPECT_FLOAT_EQ(Scaler.GetScale(), Desc.MinScale);
+}
+
+} // namespace
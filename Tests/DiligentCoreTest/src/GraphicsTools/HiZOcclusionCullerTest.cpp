@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "HiZOcclusionCuller.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(GraphicsTools_HiZOcclusionCuller, PyramidLayout)
+{
+    {
+        HiZPyramidLayout Layout = ComputeHiZPyramidLayout(1920, 1080);
+        EXPECT_EQ(Layout.Width, 1024u);
+        EXPECT_EQ(Layout.Height, 1024u);
+        EXPECT_EQ(Layout.NumLevels, 11u);
+        EXPECT_EQ(Layout.LevelOffsets[1], 1024u * 1024u);
+        EXPECT_EQ(Layout.NumTexels, (1u << 22u) / 3u);
+    }
+
+    {
+        HiZPyramidLayout Layout = ComputeHiZPyramidLayout(2048, 2048);
+        EXPECT_EQ(Layout.Width, 1024u);
+        EXPECT_EQ(Layout.Height, 1024u);
+        EXPECT_EQ(Layout.NumLevels, 11u);
+    }
+
+    {
+        HiZPyramidLayout Layout = ComputeHiZPyramidLayout(3, 5);
+        EXPECT_EQ(Layout.Width, 2u);
+        EXPECT_EQ(Layout.Height, 4u);
+        ASSERT_EQ(Layout.NumLevels, 3u);
+        EXPECT_EQ(Layout.LevelOffsets[0], 0u);
+        EXPECT_EQ(Layout.LevelOffsets[1], 8u);
+        EXPECT_EQ(Layout.LevelOffsets[2], 10u);
+        EXPECT_EQ(Layout.NumTexels, 11u);
+    }
+
+    {
+        HiZPyramidLayout Layout = ComputeHiZPyramidLayout(1, 1);
+        EXPECT_EQ(Layout.Width, 1u);
+        EXPECT_EQ(Layout.Height, 1u);
+        EXPECT_EQ(Layout.NumLevels, 1u);
+        EXPECT_EQ(Layout.NumTexels, 1u);
+    }
+
+    {
+        HiZPyramidLayout Layout = ComputeHiZPyramidLayout(0, 16);
+        EXPECT_EQ(Layout.NumLevels, 0u);
+        EXPECT_EQ(Layout.NumTexels, 0u);
+    }
+}
+
+} // namespace
@@ -0,0 +1,289 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct GridMesh
+{
+    std::vector<float3> Positions;
+    std::vector<Uint32> Indices;
+
+    // Creates a grid of quads in the XY plane with shuffled triangles
+    explicit GridMesh(Uint32 Size)
+    {
+        for (Uint32 y = 0; y <= Size; ++y)
+        {
+            for (Uint32 x = 0; x <= Size; ++x)
+                Positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.f);
+        }
+
+        std::vector<std::array<Uint32, 3>> Tris;
+        for (Uint32 y = 0; y < Size; ++y)
+        {
+            for (Uint32 x = 0; x < Size; ++x)
+            {
+                const Uint32 V0 = y * (Size + 1) + x;
+                const Uint32 V1 = V0 + 1;
+                const Uint32 V2 = V0 + Size + 1;
+                const Uint32 V3 = V2 + 1;
+                Tris.push_back({V0, V2, V1});
+                Tris.push_back({V1, V2, V3});
+            }
+        }
+
+        std::mt19937 Gen{0};
+        std::shuffle(Tris.begin(), Tris.end(), Gen);
+        for (const auto& Tri : Tris)
+            Indices.insert(Indices.end(), Tri.begin(), Tri.end());
+    }
+
+    Uint32 NumIndices() const { return static_cast<Uint32>(Indices.size()); }
+    Uint32 NumVertices() const { return static_cast<Uint32>(Positions.size()); }
+};
+
+// Returns the sorted list of triangles, each rotated so that the smallest index goes first
+std::vector<std::array<Uint32, 3>> GetCanonicalTriangles(const std::vector<Uint32>& Indices)
+{
+    std::vector<std::array<Uint32, 3>> Tris;
+    for (size_t i = 0; i < Indices.size(); i += 3)
+    {
+        std::array<Uint32, 3> Tri{Indices[i], Indices[i + 1], Indices[i + 2]};
+        std::rotate(Tri.begin(), std::min_element(Tri.begin(), Tri.end()), Tri.end());
+        Tris.push_back(Tri);
+    }
+    std::sort(Tris.begin(), Tris.end());
+    return Tris;
+}
+
+TEST(GraphicsTools_MeshOptimizer, OptimizeVertexCache)
+{
+    GridMesh Mesh{32};
+
+    const float SrcACMR = ComputeAverageCacheMissRatio(Mesh.Indices.data(), Mesh.NumIndices(), Mesh.NumVertices());
+
+    std::vector<Uint32> Indices = Mesh.Indices;
+    OptimizeVertexCache(Indices.data(), Indices.data(), Mesh.NumIndices(), Mesh.NumVertices());
+
+    // Triangles and their winding must be preserved
+    EXPECT_EQ(GetCanonicalTriangles(Indices), GetCanonicalTriangles(Mesh.Indices));
+
+    const float DstACMR = ComputeAverageCacheMissRatio(Indices.data(), Mesh.NumIndices(), Mesh.NumVertices());
+    EXPECT_GT(SrcACMR, 2.f);
+    EXPECT_LT(DstACMR, 0.8f);
+}
+
+TEST(GraphicsTools_MeshOptimizer, OptimizeOverdraw)
+{
+    GridMesh Mesh{32};
+
+    std::vector<Uint32> CacheOptimized(Mesh.Indices.size());
+    OptimizeVertexCache(CacheOptimized.data(), Mesh.Indices.data(), Mesh.NumIndices(), Mesh.NumVertices());
+
+    std::vector<Uint32> Indices = CacheOptimized;
+    OptimizeOverdraw(Indices.data(), Indices.data(), Mesh.NumIndices(), Mesh.Positions.data(), Mesh.NumVertices(), sizeof(float3));
+
+    EXPECT_EQ(GetCanonicalTriangles(Indices), GetCanonicalTriangles(Mesh.Indices));
+
+    const float CacheACMR    = ComputeAverageCacheMissRatio(CacheOptimized.data(), Mesh.NumIndices(), Mesh.NumVertices());
+    const float OverdrawACMR = ComputeAverageCacheMissRatio(Indices.data(), Mesh.NumIndices(), Mesh.NumVertices());
+    EXPECT_LT(OverdrawACMR, CacheACMR * 1.25f);
+}
+
+TEST(GraphicsTools_MeshOptimizer, VertexFetchRemap)
+{
+    const std::vector<float3> Positions = {
+        {0, 0, 0},
+        {1, 0, 0}, // Unused
+        {2, 0, 0},
+        {3, 0, 0},
+        {4, 0, 0},
+    };
+    const std::vector<Uint32> SrcIndices = {4, 2, 0, 0, 2, 3};
+
+    std::vector<Uint32> Remap(Positions.size());
+    const Uint32        NumUsed = ComputeVertexFetchRemap(Remap.data(), SrcIndices.data(), static_cast<Uint32>(SrcIndices.size()), static_cast<Uint32>(Positions.size()));
+    EXPECT_EQ(NumUsed, 4u);
+    EXPECT_EQ(Remap, (std::vector<Uint32>{2, ~0u, 1, 3, 0}));
+
+    std::vector<Uint32> Indices = SrcIndices;
+    RemapIndexBuffer(Indices.data(), Indices.data(), static_cast<Uint32>(Indices.size()), Remap.data());
+    EXPECT_EQ(Indices, (std::vector<Uint32>{0, 1, 2, 2, 1, 3}));
+
+    std::vector<float3> Vertices(NumUsed);
+    RemapVertexBuffer(Vertices.data(), Positions.data(), static_cast<Uint32>(Positions.size()), sizeof(float3), Remap.data());
+    for (size_t i = 0; i < SrcIndices.size(); ++i)
+        EXPECT_EQ(Vertices[Indices[i]], Positions[SrcIndices[i]]);
+}
+
+TEST(GraphicsTools_MeshOptimizer, HalfFloat)
+{
+    EXPECT_EQ(FloatToHalf(0.f), 0x0000);
+    EXPECT_EQ(FloatToHalf(-0.f), 0x8000);
+    EXPECT_EQ(FloatToHalf(1.f), 0x3C00);
+    EXPECT_EQ(FloatToHalf(-2.f), 0xC000);
+    EXPECT_EQ(FloatToHalf(0.333333f), 0x3555);
+    EXPECT_EQ(FloatToHalf(65504.f), 0x7BFF);
+    EXPECT_EQ(FloatToHalf(1e6f), 0x7C00);
+    EXPECT_EQ(FloatToHalf(5.9604645e-8f), 0x0001); // Smallest denormal
+    EXPECT_EQ(FloatToHalf(6.1035156e-5f), 0x0400); // Smallest normal
+    // 1 + 2^-11 is halfway between 1 and the next half, rounds to even
+    EXPECT_EQ(FloatToHalf(1.00048828125f), 0x3C00);
+    EXPECT_EQ(FloatToHalf(1.00146484375f), 0x3C02);
+
+    for (Uint32 h = 0; h < 0x7C00; ++h)
+    {
+        const Uint16 Half = static_cast<Uint16>(h);
+        ASSERT_EQ(FloatToHalf(HalfToFloat(Half)), Half);
+        ASSERT_EQ(FloatToHalf(HalfToFloat(Half | 0x8000)), Half | 0x8000);
+    }
+}
+
+TEST(GraphicsTools_MeshOptimizer, Octahedral)
+{
+    const float3 Axes[] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+    for (const float3& Axis : Axes)
+    {
+        const float2 Enc = EncodeOctahedral(Axis);
+        EXPECT_EQ(DecodeOctahedral(float2{Snorm16ToFloat(FloatToSnorm16(Enc.x)), Snorm16ToFloat(FloatToSnorm16(Enc.y))}), Axis);
+    }
+
+    std::mt19937                          Gen{0};
+    std::uniform_real_distribution<float> Dist{-1, 1};
+    for (Uint32 i = 0; i < 1000; ++i)
+    {
+        const float3 Dir = normalize(float3{Dist(Gen), Dist(Gen), Dist(Gen)});
+        const float2 Enc = EncodeOctahedral(Dir);
+        const float3 Dec = DecodeOctahedral(float2{Snorm16ToFloat(FloatToSnorm16(Enc.x)), Snorm16ToFloat(FloatToSnorm16(Enc.y))});
+        EXPECT_GT(dot(Dir, Dec), 0.99999f);
+    }
+}
+
+TEST(GraphicsTools_MeshOptimizer, QuantizeVertices)
+{
+    struct Vertex
+    {
+        float3 Pos;
+        float3 Normal;
+        float2 UV;
+        float4 Tangent;
+    };
+    const std::vector<Vertex> Vertices = {
+        {{-10, 5, 100}, {0, 0, 1}, {0.f, 0.5f}, {1, 0, 0, 1}},
+        {{30, 6, 120}, {0, 1, 0}, {0.25f, 1.f}, {0, 0, 1, -1}},
+        {{0, 7, 101}, normalize(float3{1, 1, -1}), {1.f, 0.75f}, {-1, 0, 0, 1}},
+    };
+
+    const VertexAttribQuantizationDesc Attribs[] = {
+        {&Vertices[0].Pos, sizeof(Vertex), 3, VERTEX_ATTRIB_QUANTIZATION_SNORM16, 0},
+        {&Vertices[0].Normal, sizeof(Vertex), 3, VERTEX_ATTRIB_QUANTIZATION_OCTAHEDRAL, 1},
+        {&Vertices[0].UV, sizeof(Vertex), 2, VERTEX_ATTRIB_QUANTIZATION_FLOAT16, 2},
+        {&Vertices[0].Tangent, sizeof(Vertex), 4, VERTEX_ATTRIB_QUANTIZATION_OCTAHEDRAL, 3},
+    };
+
+    VertexQuantizationInfo Info;
+    Info.pAttribs    = Attribs;
+    Info.NumAttribs  = _countof(Attribs);
+    Info.NumVertices = static_cast<Uint32>(Vertices.size());
+    Info.BufferSlot  = 1;
+
+    QuantizedVertexData Data;
+    ASSERT_TRUE(QuantizeVertices(Info, Data));
+
+    ASSERT_EQ(Data.VertexStride, 8u + 4u + 4u + 8u);
+    ASSERT_EQ(Data.Vertices.size(), size_t{Data.VertexStride} * Vertices.size());
+    ASSERT_EQ(Data.Elements.size(), 4u);
+
+    const LayoutElement ExpectedElements[] = {
+        {0, 1, 4, VT_INT16, True, 0, Data.VertexStride},
+        {1, 1, 2, VT_INT16, True, 8, Data.VertexStride},
+        {2, 1, 2, VT_FLOAT16, False, 12, Data.VertexStride},
+        {3, 1, 4, VT_INT16, True, 16, Data.VertexStride},
+    };
+    for (size_t i = 0; i < _countof(ExpectedElements); ++i)
+    {
+        const LayoutElement& Elem     = Data.Elements[i];
+        const LayoutElement& Expected = ExpectedElements[i];
+        EXPECT_EQ(Elem.InputIndex, Expected.InputIndex);
+        EXPECT_EQ(Elem.BufferSlot, Expected.BufferSlot);
+        EXPECT_EQ(Elem.NumComponents, Expected.NumComponents);
+        EXPECT_EQ(Elem.ValueType, Expected.ValueType);
+        EXPECT_EQ(Elem.RelativeOffset, Expected.RelativeOffset);
+        EXPECT_EQ(Elem.Stride, Expected.Stride);
+        if (Elem.ValueType == VT_INT16)
+        {
+            EXPECT_TRUE(Elem.IsNormalized);
+        }
+    }
+
+    EXPECT_EQ(Data.DequantizationScale[0], float4(20, 1, 10, 1));
+    EXPECT_EQ(Data.DequantizationBias[0], float4(10, 6, 110, 0));
+    EXPECT_EQ(Data.DequantizationScale[2], float4(1, 1, 1, 1));
+
+    for (size_t v = 0; v < Vertices.size(); ++v)
+    {
+        const Uint8* pVert = &Data.Vertices[v * Data.VertexStride];
+
+        Int16 Pos[4];
+        memcpy(Pos, pVert, sizeof(Pos));
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            const float Dequantized = Snorm16ToFloat(Pos[c]) * Data.DequantizationScale[0][c] + Data.DequantizationBias[0][c];
+            EXPECT_NEAR(Dequantized, Vertices[v].Pos[c], 1e-3f);
+        }
+        EXPECT_EQ(Pos[3], 32767);
+
+        Int16 Normal[2];
+        memcpy(Normal, pVert + 8, sizeof(Normal));
+        const float3 DecNormal = DecodeOctahedral(float2{Snorm16ToFloat(Normal[0]), Snorm16ToFloat(Normal[1])});
+        EXPECT_GT(dot(DecNormal, Vertices[v].Normal), 0.9999f);
+
+        Uint16 UV[2];
+        memcpy(UV, pVert + 12, sizeof(UV));
+        EXPECT_EQ(HalfToFloat(UV[0]), Vertices[v].UV.x);
+        EXPECT_EQ(HalfToFloat(UV[1]), Vertices[v].UV.y);
+
+        Int16 Tangent[4];
+        memcpy(Tangent, pVert + 16, sizeof(Tangent));
+        const float3 DecTangent = DecodeOctahedral(float2{Snorm16ToFloat(Tangent[0]), Snorm16ToFloat(Tangent[1])});
+        EXPECT_GT(dot(DecTangent, float3{Vertices[v].Tangent.x, Vertices[v].Tangent.y, Vertices[v].Tangent.z}), 0.9999f);
+        EXPECT_EQ(Snorm16ToFloat(Tangent[2]), Vertices[v].Tangent.w);
+    }
+}
+
+} // namespace
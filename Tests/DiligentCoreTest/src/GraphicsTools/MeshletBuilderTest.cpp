@@ -0,0 +1,222 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "MeshletBuilder.hpp"
+
+#include <set>
+#include <cstring>
+#include <array>
+#include <unordered_set>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct GridMesh
+{
+    std::vector<float3> Positions;
+    std::vector<Uint32> Indices;
+
+    // Creates a grid of quads in the XY plane facing the -Z direction
+    explicit GridMesh(Uint32 Size)
+    {
+        for (Uint32 y = 0; y <= Size; ++y)
+        {
+            for (Uint32 x = 0; x <= Size; ++x)
+                Positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.f);
+        }
+
+        for (Uint32 y = 0; y < Size; ++y)
+        {
+            for (Uint32 x = 0; x < Size; ++x)
+            {
+                const Uint32 V0 = y * (Size + 1) + x;
+                const Uint32 V1 = V0 + 1;
+                const Uint32 V2 = V0 + Size + 1;
+                const Uint32 V3 = V2 + 1;
+                Indices.insert(Indices.end(), {V0, V2, V1, V1, V2, V3});
+            }
+        }
+    }
+
+    MeshletBuildInfo GetBuildInfo() const
+    {
+        MeshletBuildInfo BuildInfo;
+        BuildInfo.pVertices   = Positions.data();
+        BuildInfo.NumVertices = static_cast<Uint32>(Positions.size());
+        BuildInfo.pIndices    = Indices.data();
+        BuildInfo.NumIndices  = static_cast<Uint32>(Indices.size());
+        return BuildInfo;
+    }
+};
+
+void VerifyMeshlets(const MeshletBuildInfo& BuildInfo, const MeshletData& Data)
+{
+    ASSERT_EQ(Data.Bounds.size(), Data.Meshlets.size());
+
+    std::multiset<std::array<Uint32, 3>> RefTriangles;
+    for (Uint32 i = 0; i < BuildInfo.NumIndices; i += 3)
+        RefTriangles.insert({BuildInfo.pIndices[i], BuildInfo.pIndices[i + 1], BuildInfo.pIndices[i + 2]});
+
+    std::multiset<std::array<Uint32, 3>> Triangles;
+    for (size_t m = 0; m < Data.Meshlets.size(); ++m)
+    {
+        const Meshlet&       CurrMeshlet = Data.Meshlets[m];
+        const MeshletBounds& Bounds      = Data.Bounds[m];
+
+        EXPECT_GT(CurrMeshlet.TriangleCount, 0u);
+        EXPECT_LE(CurrMeshlet.VertexCount, BuildInfo.MaxVertices);
+        EXPECT_LE(CurrMeshlet.TriangleCount, BuildInfo.MaxTriangles);
+        ASSERT_LE(CurrMeshlet.VertexOffset + CurrMeshlet.VertexCount, Data.VertexIndices.size());
+        ASSERT_LE(CurrMeshlet.TriangleOffset + CurrMeshlet.TriangleCount, Data.TriangleIndices.size());
+
+        std::unordered_set<Uint32> UniqueVertices;
+        for (Uint32 v = 0; v < CurrMeshlet.VertexCount; ++v)
+        {
+            const Uint32 Vert = Data.VertexIndices[CurrMeshlet.VertexOffset + v];
+            EXPECT_TRUE(UniqueVertices.insert(Vert).second);
+
+            const float3& Pos = static_cast<const float3*>(BuildInfo.pVertices)[Vert];
+            EXPECT_LE(length(Pos - Bounds.Center), Bounds.Radius * 1.0001f);
+        }
+
+        for (Uint32 t = 0; t < CurrMeshlet.TriangleCount; ++t)
+        {
+            const Uint32 Packed = Data.TriangleIndices[CurrMeshlet.TriangleOffset + t];
+            const Uint32 Local[] = {Packed & 0xFFu, (Packed >> 8u) & 0xFFu, (Packed >> 16u) & 0xFFu};
+            for (Uint32 Idx : Local)
+                ASSERT_LT(Idx, CurrMeshlet.VertexCount);
+
+            Triangles.insert({
+                Data.VertexIndices[CurrMeshlet.VertexOffset + Local[0]],
+                Data.VertexIndices[CurrMeshlet.VertexOffset + Local[1]],
+                Data.VertexIndices[CurrMeshlet.VertexOffset + Local[2]],
+            });
+        }
+    }
+
+    EXPECT_EQ(Triangles, RefTriangles);
+}
+
+TEST(MeshletBuilderTest, Grid)
+{
+    GridMesh         Mesh{64};
+    MeshletBuildInfo BuildInfo = Mesh.GetBuildInfo();
+
+    for (Uint32 MaxVertices : {3u, 16u, 64u, 256u})
+    {
+        for (Uint32 MaxTriangles : {1u, 32u, 124u, 256u})
+        {
+            BuildInfo.MaxVertices  = MaxVertices;
+            BuildInfo.MaxTriangles = MaxTriangles;
+
+            MeshletData Data;
+            ASSERT_TRUE(BuildMeshlets(BuildInfo, Data));
+            VerifyMeshlets(BuildInfo, Data);
+        }
+    }
+
+    BuildInfo.MaxVertices  = 64;
+    BuildInfo.MaxTriangles = 124;
+
+    MeshletData Data;
+    ASSERT_TRUE(BuildMeshlets(BuildInfo, Data));
+
+    // Meshlets of a regular grid must reuse vertices well. An 8x8 vertex patch holds
+    // 98 triangles, which gives 0.65 vertices per triangle.
+    const float VerticesPerTriangle = static_cast<float>(Data.VertexIndices.size()) / static_cast<float>(Data.TriangleIndices.size());
+    EXPECT_LT(VerticesPerTriangle, 0.85f);
+}
+
+TEST(MeshletBuilderTest, ConeCulling)
+{
+    GridMesh         Mesh{16};
+    MeshletBuildInfo BuildInfo = Mesh.GetBuildInfo();
+
+    MeshletData Data;
+    ASSERT_TRUE(BuildMeshlets(BuildInfo, Data));
+    ASSERT_FALSE(Data.Bounds.empty());
+
+    for (const MeshletBounds& Bounds : Data.Bounds)
+    {
+        // All triangles of a flat meshlet face the same direction
+        EXPECT_NEAR(Bounds.ConeAxis.z, -1.f, 1e-5f);
+        EXPECT_LT(Bounds.ConeCutoff, 1.f);
+
+        auto IsBackFacing = [&Bounds](const float3& CameraPos) {
+            return dot(normalize(Bounds.ConeApex - CameraPos), Bounds.ConeAxis) >= Bounds.ConeCutoff;
+        };
+        EXPECT_FALSE(IsBackFacing(float3{8, 8, -10}));
+        EXPECT_TRUE(IsBackFacing(float3{8, 8, +10}));
+    }
+}
+
+TEST(MeshletBuilderTest, DegenerateTriangles)
+{
+    const float3 Positions[] = {
+        {0, 0, 0},
+        {1, 0, 0},
+        {0, 1, 0},
+        {1, 1, 0},
+        {2, 0, 0},
+    };
+    const Uint32 Indices[] = {
+        0, 2, 1,
+        1, 1, 2, // Repeated index
+        1, 2, 3,
+        0, 1, 4, // Zero area
+    };
+    MeshletBuildInfo BuildInfo;
+    BuildInfo.pVertices   = Positions;
+    BuildInfo.NumVertices = _countof(Positions);
+    BuildInfo.pIndices    = Indices;
+    BuildInfo.NumIndices  = _countof(Indices);
+
+    MeshletData Data;
+    ASSERT_TRUE(BuildMeshlets(BuildInfo, Data));
+    ASSERT_EQ(Data.Meshlets.size(), 1u);
+    EXPECT_EQ(Data.Meshlets[0].TriangleCount, 2u);
+    EXPECT_EQ(Data.Meshlets[0].VertexCount, 4u);
+
+    MeshletData EmptyData;
+    BuildInfo.NumIndices = 0;
+    EXPECT_TRUE(BuildMeshlets(BuildInfo, EmptyData));
+    EXPECT_TRUE(EmptyData.Meshlets.empty());
+}
+
+TEST(MeshletBuilderTest, ShaderSource)
+{
+    const char* Source = GetMeshletCullingShaderSource();
+    ASSERT_NE(Source, nullptr);
+    EXPECT_NE(strstr(Source, "DispatchMesh"), nullptr);
+    EXPECT_NE(strstr(Source, "struct MeshletBounds"), nullptr);
+}
+
+} // namespace
@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MultiGPURenderer.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+void CheckRect(const Rect& R, Int32 Left, Int32 Top, Int32 Right, Int32 Bottom)
+{
+    EXPECT_EQ(R.left, Left);
+    EXPECT_EQ(R.top, Top);
+    EXPECT_EQ(R.right, Right);
+    EXPECT_EQ(R.bottom, Bottom);
+}
+
+TEST(GraphicsTools_MultiGPURenderer, ComputeTiles)
+{
+    const std::vector<Rect> Tiles = MultiGPURenderer::ComputeTiles(1000, 600, 512, 256);
+    ASSERT_EQ(Tiles.size(), 6u);
+
+    CheckRect(Tiles[0], 0, 0, 512, 256);
+    CheckRect(Tiles[1], 512, 0, 1000, 256);
+    CheckRect(Tiles[2], 0, 256, 512, 512);
+    CheckRect(Tiles[3], 512, 256, 1000, 512);
+    CheckRect(Tiles[4], 0, 512, 512, 600);
+    CheckRect(Tiles[5], 512, 512, 1000, 600);
+}
+
+TEST(GraphicsTools_MultiGPURenderer, ComputeTilesCoverFrame)
+{
+    constexpr Uint32 Width  = 777;
+    constexpr Uint32 Height = 333;
+
+    std::vector<Uint32> Coverage(Width * Height);
+    for (const Rect& Tile : MultiGPURenderer::ComputeTiles(Width, Height, 100, 64))
+    {
+        EXPECT_TRUE(Tile.IsValid());
+        for (Int32 y = Tile.top; y < Tile.bottom; ++y)
+        {
+            for (Int32 x = Tile.left; x < Tile.right; ++x)
+                ++Coverage[y * Width + x];
+        }
+    }
+
+    for (Uint32 Count : Coverage)
+        ASSERT_EQ(Count, 1u);
+}
+
+TEST(GraphicsTools_MultiGPURenderer, ComputeTilesLargerThanFrame)
+{
+    const std::vector<Rect> Tiles = MultiGPURenderer::ComputeTiles(300, 200, 512, 512);
+    ASSERT_EQ(Tiles.size(), 1u);
+    CheckRect(Tiles[0], 0, 0, 300, 200);
+
+    EXPECT_TRUE(MultiGPURenderer::ComputeTiles(0, 200, 512, 512).empty());
+    EXPECT_TRUE(MultiGPURenderer::ComputeTiles(300, 200, 0, 512).empty());
+}
+
+} // namespace
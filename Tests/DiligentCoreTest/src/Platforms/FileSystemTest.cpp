@@ -27,6 +27,8 @@
 #include "FileSystem.hpp"
 
 #include <vector>
+#include <atomic>
+#include <algorithm>
 #include <unordered_set>
 
 #include "gtest/gtest.h"
@@ -36,6 +38,8 @@
 #include "FileWrapper.hpp"
 #include "FastRand.hpp"
 #include "DataBlobImpl.hpp"
+#include "MappedFileStream.hpp"
+#include "TestingEnvironment.hpp"
 
 using namespace Diligent;
 using namespace Diligent::Testing;
@@ -467,6 +471,153 @@ TEST(Platforms_FileSystem, File)
     EXPECT_FALSE(FileSystem::FileExists(FilePath.c_str()));
 }
 
+TEST(Platforms_FileSystem, MapFile)
+{
+    TempDirectory TmpDir;
+    const auto&   TmpDirPath = TmpDir.Get();
+    ASSERT_TRUE(FileSystem::PathExists(TmpDirPath.c_str()));
+
+    std::vector<Int32> Data(512);
+
+    FastRandInt rnd{0, 0, static_cast<Int32>(FastRand::Max - 1)};
+    for (auto& Elem : Data)
+        Elem = rnd();
+    const auto FilePath = TmpDirPath + FileSystem::SlashSymbol + "MappedFile.ext";
+    {
+        FileWrapper File{FilePath.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+        EXPECT_TRUE(File->Write(Data.data(), Data.size() * sizeof(Data[0])));
+    }
+
+    {
+        auto pMappedFile = FileSystem::MapFile(FilePath.c_str());
+        ASSERT_NE(pMappedFile, nullptr);
+        ASSERT_EQ(pMappedFile->GetSize(), Data.size() * sizeof(Data[0]));
+        EXPECT_EQ(memcmp(pMappedFile->GetData(), Data.data(), pMappedFile->GetSize()), 0);
+    }
+
+    {
+        auto pStream = MappedFileStream::Create(FilePath.c_str());
+        ASSERT_NE(pStream, nullptr);
+        EXPECT_TRUE(pStream->IsValid());
+        EXPECT_EQ(pStream->GetSize(), Data.size() * sizeof(Data[0]));
+
+        std::vector<Int32> InData(Data.size());
+        EXPECT_TRUE(pStream->Read(InData.data(), InData.size() * sizeof(InData[0])));
+        EXPECT_EQ(InData, Data);
+        EXPECT_EQ(pStream->GetPos(), pStream->GetSize());
+        EXPECT_FALSE(pStream->Read(InData.data(), sizeof(InData[0])));
+
+        EXPECT_TRUE(pStream->SetPos(sizeof(Data[0]), static_cast<int>(FilePosOrigin::Start)));
+        Int32 Val = 0;
+        EXPECT_TRUE(pStream->Read(&Val, sizeof(Val)));
+        EXPECT_EQ(Val, Data[1]);
+
+        auto pBlob = pStream->GetDataBlob();
+        ASSERT_NE(pBlob, nullptr);
+        EXPECT_EQ(pBlob->GetConstDataPtr(), pStream->GetData());
+        EXPECT_EQ(pBlob->GetSize(), pStream->GetSize());
+
+        // The blob must keep the mapping alive
+        pStream.Release();
+        EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Data.data(), pBlob->GetSize()), 0);
+    }
+
+    const auto EmptyFilePath = TmpDirPath + FileSystem::SlashSymbol + "EmptyFile.ext";
+    {
+        FileWrapper File{EmptyFilePath.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+    }
+
+    {
+        auto pStream = MappedFileStream::Create(EmptyFilePath.c_str());
+        ASSERT_NE(pStream, nullptr);
+        EXPECT_EQ(pStream->GetSize(), size_t{0});
+        auto pBlob = pStream->GetDataBlob();
+        ASSERT_NE(pBlob, nullptr);
+        EXPECT_EQ(pBlob->GetSize(), size_t{0});
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to map file"};
+        EXPECT_EQ(MappedFileStream::Create((TmpDirPath + FileSystem::SlashSymbol + "MissingFile.ext").c_str()), nullptr);
+    }
+
+    FileSystem::DeleteFile(FilePath.c_str());
+    FileSystem::DeleteFile(EmptyFilePath.c_str());
+}
+
+TEST(Platforms_FileSystem, AsyncFile)
+{
+    TempDirectory TmpDir;
+    const auto&   TmpDirPath = TmpDir.Get();
+    ASSERT_TRUE(FileSystem::PathExists(TmpDirPath.c_str()));
+
+    std::vector<Int32> Data(4096);
+
+    FastRandInt rnd{0, 0, static_cast<Int32>(FastRand::Max - 1)};
+    for (auto& Elem : Data)
+        Elem = rnd();
+    const auto FilePath = TmpDirPath + FileSystem::SlashSymbol + "AsyncFile.ext";
+    {
+        FileWrapper File{FilePath.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+        EXPECT_TRUE(File->Write(Data.data(), Data.size() * sizeof(Data[0])));
+    }
+
+    {
+        auto pFile = FileSystem::OpenAsyncFile(FilePath.c_str());
+        if (!pFile)
+            GTEST_SKIP() << "Asynchronous file reads are not supported on this platform";
+        EXPECT_EQ(pFile->GetSize(), Data.size() * sizeof(Data[0]));
+        EXPECT_EQ(pFile->GetAlignment(), 1u);
+
+        // Read the file in chunks in reverse order
+        constexpr size_t                  NumChunks = 16;
+        const size_t                      ChunkSize = Data.size() / NumChunks;
+        std::vector<Int32>                InData(Data.size() + ChunkSize, 0);
+        std::vector<AsyncFileReadRequest> Requests;
+        for (size_t i = 0; i < NumChunks; ++i)
+        {
+            const size_t         Chunk = NumChunks - 1 - i;
+            AsyncFileReadRequest Req;
+            Req.Offset    = Chunk * ChunkSize * sizeof(Int32);
+            Req.Size      = ChunkSize * sizeof(Int32);
+            Req.pDst      = &InData[Chunk * ChunkSize];
+            Req.pUserData = reinterpret_cast<void*>(Chunk);
+            Requests.push_back(Req);
+        }
+        // The read that crosses the end of the file must only return the last element
+        {
+            AsyncFileReadRequest Req;
+            Req.Offset    = (Data.size() - 1) * sizeof(Int32);
+            Req.Size      = ChunkSize * sizeof(Int32);
+            Req.pDst      = &InData[Data.size()];
+            Req.pUserData = reinterpret_cast<void*>(NumChunks);
+            Requests.push_back(Req);
+        }
+
+        std::atomic<Uint32> NumCompleted{0};
+        std::atomic<Uint32> NumFailed{0};
+        EXPECT_TRUE(pFile->Read(Requests.data(), static_cast<Uint32>(Requests.size()),
+                                [&](const AsyncFileReadRequest& Req, size_t BytesRead, bool Success) {
+                                    const size_t Chunk = reinterpret_cast<size_t>(Req.pUserData);
+                                    if (!Success || BytesRead != (Chunk == NumChunks ? sizeof(Int32) : Req.Size))
+                                        NumFailed.fetch_add(1);
+                                    NumCompleted.fetch_add(1);
+                                }));
+        pFile->WaitForAll();
+        EXPECT_EQ(NumCompleted.load(), Requests.size());
+        EXPECT_EQ(NumFailed.load(), 0u);
+        EXPECT_TRUE(std::equal(Data.begin(), Data.end(), InData.begin()));
+        EXPECT_EQ(InData[Data.size()], Data.back());
+    }
+
+    EXPECT_EQ(FileSystem::OpenAsyncFile((TmpDirPath + FileSystem::SlashSymbol + "MissingFile.ext").c_str()), nullptr);
+
+    FileSystem::DeleteFile(FilePath.c_str());
+}
+
 TEST(Platforms_FileSystem, Directories)
 {
     TempDirectory TmpDir;
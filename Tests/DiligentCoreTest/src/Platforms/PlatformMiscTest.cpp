@@ -114,4 +114,36 @@ TEST(Platforms_PlatformMisc, SwapBytes)
     EXPECT_EQ(PlatformMisc::SwapBytes(fswap), f);
 }
 
+TEST(Platforms_PlatformMisc, CPUTopology)
+{
+    const CPUTopology& Topology = PlatformMisc::GetCPUTopology();
+    ASSERT_FALSE(Topology.Processors.empty());
+    EXPECT_GE(Topology.NumPhysicalCores, 1u);
+    EXPECT_LE(Topology.NumPhysicalCores, Topology.Processors.size());
+    EXPECT_GE(Topology.NumPackages, 1u);
+    EXPECT_GE(Topology.NumNUMANodes, 1u);
+
+    bool HasPerformanceCores = false;
+    bool HasEfficiencyCores  = false;
+    for (size_t i = 0; i < Topology.Processors.size(); ++i)
+    {
+        const CPUProcessorInfo& Proc = Topology.Processors[i];
+        if (i > 0)
+            EXPECT_LT(Topology.Processors[i - 1].Index, Proc.Index);
+        EXPECT_LT(Proc.CoreId, Topology.NumPhysicalCores);
+        EXPECT_LT(Proc.PackageId, Topology.NumPackages);
+        EXPECT_LT(Proc.NUMANode, Topology.NumNUMANodes);
+        EXPECT_EQ(Topology.GetProcessor(Proc.Index), &Proc);
+
+        HasPerformanceCores = HasPerformanceCores || Proc.CoreType == CPUCoreType::Performance;
+        HasEfficiencyCores  = HasEfficiencyCores || Proc.CoreType == CPUCoreType::Efficiency;
+    }
+    EXPECT_EQ(Topology.IsHybrid, HasPerformanceCores && HasEfficiencyCores);
+    EXPECT_EQ(Topology.GetProcessor(Topology.Processors.back().Index + 1), nullptr);
+
+    const Uint32 CurrProc = PlatformMisc::GetCurrentProcessorIndex();
+    if (CurrProc != CPUProcessorInfo::InvalidId)
+        EXPECT_NE(Topology.GetProcessor(CurrProc), nullptr);
+}
+
 } // namespace
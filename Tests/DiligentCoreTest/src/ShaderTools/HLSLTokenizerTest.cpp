@@ -0,0 +1,205 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <unordered_map>
+
+#include "HLSLTokenizer.hpp"
+#include "Timer.hpp"
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Parsing;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static constexpr char g_TestHLSL[] = R"(
+#include "Common.fxh"
+#define MAX_LIGHTS 4 // Max lights
+
+/* Constant buffer
+   with light attributes */
+cbuffer cbLights : register(b0)
+{
+    float4 g_LightDir[MAX_LIGHTS];
+    uint   g_NumLights;
+};
+
+Texture2D<float4>         g_Albedo;
+SamplerState              g_Albedo_sampler;
+RWTexture2D<unorm float4 /*format=rgba8*/> g_Output;
+
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+    float2 UV  : TEX_COORD;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    float4 Color = g_Albedo.Sample(g_Albedo_sampler, PSIn.UV);
+    int    i     = -1;
+    [unroll]
+    for (i = 0; i < MAX_LIGHTS && i < int(g_NumLights); ++i)
+    {
+        Color.rgb *= max(dot(g_LightDir[i].xyz, float3(0.0, 1.0, 0.0)), 0.25) + 1e-3;
+        Color.a   += (i >> 1) != 0 ? 0.5f : -.5f;
+    }
+    uint Mask = 0xFFu;
+    Mask <<= 2;
+    Mask |= (Mask & 0x3) ^ ~Mask;
+    if (Color.r >= 0.5 || Color.g <= 0.5) Color.b -= 0.1;
+    else if (!(Color.b == 0)) Color.b = 1;
+    return Color; // Done
+}
+)";
+
+// Tokenizes the source using the generic tokenizer and hash map keyword
+// lookup, which is how HLSLTokenizer was originally implemented.
+HLSLTokenizer::TokenListType TokenizeReference(const std::string& Source)
+{
+    static const std::unordered_map<std::string, HLSLTokenType> Keywords = [] {
+        std::unordered_map<std::string, HLSLTokenType> Map;
+#define ADD_KEYWORD(keyword) Map.emplace(#keyword, HLSLTokenType::kw_##keyword);
+        ITERATE_HLSL_KEYWORDS(ADD_KEYWORD)
+#undef ADD_KEYWORD
+        return Map;
+    }();
+
+    size_t TokenIdx = 0;
+    return Parsing::Tokenize<HLSLTokenInfo, HLSLTokenizer::TokenListType>(
+        Source.c_str(), Source.c_str() + Source.length(),
+        [&TokenIdx](HLSLTokenType Type, const char* DelimStart, const char* DelimEnd, const char* LiteralStart, const char* LiteralEnd) {
+            return HLSLTokenInfo::Create(Type, DelimStart, DelimEnd, LiteralStart, LiteralEnd, TokenIdx++);
+        },
+        [](const char* Start, const char* End) {
+            auto it = Keywords.find(std::string{Start, End});
+            return it != Keywords.end() ? it->second : HLSLTokenType::Identifier;
+        });
+}
+
+void CheckTokens(const std::string& Source)
+{
+    HLSLTokenizer Tokenizer;
+
+    const HLSLTokenizer::TokenListType     RefTokens  = TokenizeReference(Source);
+    const HLSLTokenizer::TokenListType     Tokens     = Tokenizer.Tokenize(Source);
+    const HLSLTokenizer::TokenViewListType TokenViews = Tokenizer.TokenizeView(Source);
+    ASSERT_EQ(Tokens.size(), RefTokens.size());
+    ASSERT_EQ(TokenViews.size(), RefTokens.size());
+
+    auto RefToken = RefTokens.begin();
+    auto Token    = Tokens.begin();
+    for (size_t i = 0; i < TokenViews.size(); ++i, ++RefToken, ++Token)
+    {
+        EXPECT_EQ(Token->Type, RefToken->Type) << RefToken->Literal;
+        EXPECT_EQ(Token->Literal, RefToken->Literal);
+        EXPECT_EQ(Token->Delimiter, RefToken->Delimiter);
+
+        const HLSLTokenView& View = TokenViews[i];
+        EXPECT_EQ(View.Type, RefToken->Type) << RefToken->Literal;
+        EXPECT_EQ(View.GetLiteralStr(), RefToken->Literal);
+        EXPECT_EQ(std::string(View.DelimiterStart, View.DelimiterEnd), RefToken->Delimiter);
+    }
+
+    EXPECT_EQ(BuildSource(Tokens), Source);
+    EXPECT_EQ(BuildSource(TokenViews), Source);
+}
+
+TEST(HLSLTokenizer, Tokenize)
+{
+    CheckTokens(g_TestHLSL);
+    CheckTokens("");
+    CheckTokens("float4");
+    CheckTokens("   \t\r\n  ");
+    CheckTokens("// Comment only");
+    CheckTokens("/**/");
+    CheckTokens("/* ** / */ a/**//**/b // c\r\nd");
+    CheckTokens("a                                                   /* long delimiter */                     b");
+    CheckTokens("a += b; c != d; e == f; g <<= 1; h && i || j; k::l");
+}
+
+TEST(HLSLTokenizer, TokenizeErrors)
+{
+    TestingEnvironment::ErrorScope ExpectedErrors{"Unable to tokenize string.", "Unable to find the end of the multiline comment."};
+
+    HLSLTokenizer Tokenizer;
+    EXPECT_TRUE(Tokenizer.TokenizeView("float4 /* Comment ").empty());
+}
+
+TEST(HLSLTokenizer, FindKeyword)
+{
+    HLSLTokenizer Tokenizer;
+#define CHECK_KEYWORD(keyword)                                                   \
+    {                                                                            \
+        const HLSLTokenInfo* pKeyword = Tokenizer.FindKeyword(#keyword);         \
+        ASSERT_NE(pKeyword, nullptr) << #keyword;                                \
+        EXPECT_EQ(pKeyword->Type, HLSLTokenType::kw_##keyword) << #keyword;      \
+        EXPECT_EQ(pKeyword->Literal, #keyword);                                  \
+    }
+    ITERATE_HLSL_KEYWORDS(CHECK_KEYWORD)
+#undef CHECK_KEYWORD
+
+    for (const char* Identifier : {"", "f", "float5", "Float4", "float4x", "Texture2d", "g_Texture", "MAX_LIGHTS", "whil", "while_"})
+    {
+        EXPECT_EQ(Tokenizer.FindKeyword(Identifier), nullptr) << Identifier;
+    }
+}
+
+// Compares the tokenizer performance with the original implementation
+TEST(HLSLTokenizer, Benchmark)
+{
+    std::string Source;
+    while (Source.length() < (4u << 20u))
+        Source += g_TestHLSL;
+
+    HLSLTokenizer Tokenizer;
+
+    constexpr int NumIterations = 4;
+
+    auto Measure = [&](const auto& Tokenize) {
+        size_t NumTokens = 0;
+        Timer  T;
+        for (int i = 0; i < NumIterations; ++i)
+            NumTokens += Tokenize().size();
+        EXPECT_GT(NumTokens, size_t{0});
+        return T.GetElapsedTime() * 1000.0 / NumIterations;
+    };
+
+    const double RefTime  = Measure([&]() { return TokenizeReference(Source); });
+    const double Time     = Measure([&]() { return Tokenizer.Tokenize(Source); });
+    const double ViewTime = Measure([&]() { return Tokenizer.TokenizeView(Source); });
+
+    LOG_INFO_MESSAGE("Tokenizing ", Source.length() / 1024, " KB of HLSL:",
+                     "\n    Reference:    ", RefTime, " ms",
+                     "\n    Tokenize:     ", Time, " ms",
+                     "\n    TokenizeView: ", ViewTime, " ms");
+}
+
+} // namespace
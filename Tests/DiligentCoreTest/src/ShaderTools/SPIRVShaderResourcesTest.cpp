@@ -0,0 +1,236 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SPIRVShaderResources.hpp"
+#include "GLSLangUtils.hpp"
+#include "EngineMemory.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<uint32_t> CompileHLSL(const char* Source, SHADER_TYPE ShaderType)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Source         = Source;
+    ShaderCI.Desc           = {"SPIRV resources test", ShaderType};
+    ShaderCI.EntryPoint     = "main";
+
+    GLSLangUtils::InitializeGlslang();
+    std::vector<uint32_t> SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+    GLSLangUtils::FinalizeGlslang();
+    return SPIRV;
+}
+
+std::vector<uint32_t> CompileGLSL(const char* Source, SHADER_TYPE ShaderType)
+{
+    GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+    Attribs.ShaderType   = ShaderType;
+    Attribs.ShaderSource = Source;
+    Attribs.Version      = GLSLangUtils::SpirvVersion::Vk100;
+
+    GLSLangUtils::InitializeGlslang();
+    std::vector<uint32_t> SPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+    GLSLangUtils::FinalizeGlslang();
+    return SPIRV;
+}
+
+// Loads resources with the lightweight parser and with SPIRV-Cross (which is always used when
+// uniform buffer reflection is requested) and checks that the results are identical.
+void TestResources(const std::vector<uint32_t>& SPIRV, SHADER_TYPE ShaderType, Uint32 RefTotalResources)
+{
+    ASSERT_FALSE(SPIRV.empty());
+
+    const ShaderDesc Desc{"SPIRV resources test", ShaderType};
+
+    std::string          EntryPoint;
+    SPIRVShaderResources Resources{GetRawAllocator(), SPIRV, Desc, "_sampler", true, false, EntryPoint};
+
+    std::string          RefEntryPoint;
+    SPIRVShaderResources RefResources{GetRawAllocator(), SPIRV, Desc, "_sampler", true, true, RefEntryPoint};
+
+    EXPECT_EQ(EntryPoint, RefEntryPoint);
+    EXPECT_EQ(Resources.IsHLSLSource(), RefResources.IsHLSLSource());
+    EXPECT_EQ(Resources.GetComputeGroupSize(), RefResources.GetComputeGroupSize());
+
+    EXPECT_EQ(Resources.GetTotalResources(), RefTotalResources);
+    ASSERT_EQ(Resources.GetTotalResources(), RefResources.GetTotalResources());
+    EXPECT_EQ(Resources.GetNumUBs(), RefResources.GetNumUBs());
+    EXPECT_EQ(Resources.GetNumSBs(), RefResources.GetNumSBs());
+    EXPECT_EQ(Resources.GetNumImgs(), RefResources.GetNumImgs());
+    EXPECT_EQ(Resources.GetNumSmpldImgs(), RefResources.GetNumSmpldImgs());
+    EXPECT_EQ(Resources.GetNumACs(), RefResources.GetNumACs());
+    EXPECT_EQ(Resources.GetNumSepSmplrs(), RefResources.GetNumSepSmplrs());
+    EXPECT_EQ(Resources.GetNumSepImgs(), RefResources.GetNumSepImgs());
+    EXPECT_EQ(Resources.GetNumInptAtts(), RefResources.GetNumInptAtts());
+    EXPECT_EQ(Resources.GetNumAccelStructs(), RefResources.GetNumAccelStructs());
+
+    for (Uint32 i = 0; i < Resources.GetTotalResources(); ++i)
+    {
+        const SPIRVShaderResourceAttribs& Res    = Resources.GetResource(i);
+        const SPIRVShaderResourceAttribs& RefRes = RefResources.GetResource(i);
+        EXPECT_STREQ(Res.Name, RefRes.Name);
+        EXPECT_EQ(Res.Type, RefRes.Type) << Res.Name;
+        EXPECT_EQ(Res.ArraySize, RefRes.ArraySize) << Res.Name;
+        EXPECT_EQ(Res.GetResourceDimension(), RefRes.GetResourceDimension()) << Res.Name;
+        EXPECT_EQ(Res.IsMultisample(), RefRes.IsMultisample()) << Res.Name;
+        EXPECT_EQ(Res.BindingDecorationOffset, RefRes.BindingDecorationOffset) << Res.Name;
+        EXPECT_EQ(Res.DescriptorSetDecorationOffset, RefRes.DescriptorSetDecorationOffset) << Res.Name;
+        EXPECT_EQ(Res.BufferStaticSize, RefRes.BufferStaticSize) << Res.Name;
+        EXPECT_EQ(Res.BufferStride, RefRes.BufferStride) << Res.Name;
+    }
+
+    ASSERT_EQ(Resources.GetNumShaderStageInputs(), RefResources.GetNumShaderStageInputs());
+    for (Uint32 i = 0; i < Resources.GetNumShaderStageInputs(); ++i)
+    {
+        const SPIRVShaderStageInputAttribs& Input    = Resources.GetShaderStageInputAttribs(i);
+        const SPIRVShaderStageInputAttribs& RefInput = RefResources.GetShaderStageInputAttribs(i);
+        EXPECT_STREQ(Input.Semantic, RefInput.Semantic);
+        EXPECT_EQ(Input.LocationDecorationOffset, RefInput.LocationDecorationOffset);
+    }
+}
+
+TEST(SPIRVShaderResources, HLSLPixelShader)
+{
+    constexpr char Source[] = R"(
+cbuffer Constants
+{
+    float4x4 g_Matrix;
+    float4   g_Vector;
+    float    g_Array[3];
+};
+
+struct BufferData
+{
+    float4   Data;
+    float3x3 Matrix;
+    uint     Flags;
+};
+
+StructuredBuffer<BufferData>   g_ROBuffer;
+RWStructuredBuffer<BufferData> g_RWBuffer;
+ByteAddressBuffer              g_RawBuffer;
+Buffer<float4>                 g_FormattedBuffer;
+RWBuffer<float4>               g_RWFormattedBuffer;
+
+Texture2D           g_Tex2D;
+Texture2DArray      g_Tex2DArr[4];
+Texture2DMS<float4> g_Tex2DMS;
+TextureCube         g_TexCube;
+Texture3D           g_Tex3D;
+RWTexture2D<float4> g_RWTex2D;
+SamplerState        g_Sampler;
+
+float4 main(float4 Pos : SV_Position, float2 UV : TEXCOORD0) : SV_Target
+{
+    float4 Color = g_Vector + mul(Pos, g_Matrix) * g_Array[2];
+    Color += g_ROBuffer[0].Data + g_RawBuffer.Load4(0) + g_FormattedBuffer.Load(0);
+    g_RWBuffer[0].Flags = 1;
+    g_RWFormattedBuffer[0] = Color;
+    Color += g_Tex2D.Sample(g_Sampler, UV) + g_Tex2DArr[1].Sample(g_Sampler, float3(UV, 0.0));
+    Color += g_Tex2DMS.Load(int2(0, 0), 0) + g_TexCube.Sample(g_Sampler, float3(UV, 1.0));
+    Color += g_Tex3D.Sample(g_Sampler, float3(UV, 0.0));
+    g_RWTex2D[int2(0, 0)] = Color;
+    return Color;
+}
+)";
+    TestResources(CompileHLSL(Source, SHADER_TYPE_PIXEL), SHADER_TYPE_PIXEL, 13);
+}
+
+TEST(SPIRVShaderResources, HLSLVertexShaderInputs)
+{
+    constexpr char Source[] = R"(
+cbuffer Constants
+{
+    float4x4 g_WorldViewProj;
+};
+
+struct VSInput
+{
+    float3 Pos    : ATTRIB0;
+    float3 Normal : ATTRIB1;
+    float2 UV     : ATTRIB3;
+};
+
+float4 main(VSInput Input) : SV_Position
+{
+    return mul(float4(Input.Pos + Input.Normal, Input.UV.x), g_WorldViewProj);
+}
+)";
+    TestResources(CompileHLSL(Source, SHADER_TYPE_VERTEX), SHADER_TYPE_VERTEX, 1);
+}
+
+TEST(SPIRVShaderResources, GLSLComputeShader)
+{
+    constexpr char Source[] = R"(
+#version 450
+
+layout(local_size_x = 8, local_size_y = 4, local_size_z = 2) in;
+
+layout(std140) uniform Constants
+{
+    mat4 g_Matrix;
+    vec4 g_Vector;
+};
+
+layout(std430) readonly buffer ROBuffer
+{
+    vec4 g_Header;
+    vec4 g_ROData[];
+};
+
+layout(std430) buffer RWBuffer
+{
+    uint g_RWData[];
+};
+
+uniform sampler2D        g_Tex2D;
+uniform sampler2DArray   g_Tex2DArr[2];
+uniform samplerBuffer    g_TexelBuffer;
+uniform texture2D        g_SepTex;
+uniform sampler          g_SepSampler;
+layout(rgba8) uniform image2D g_Image;
+layout(r32ui) uniform uimageBuffer g_ImageBuffer;
+
+void main()
+{
+    vec4 Color = g_Matrix * g_Vector + g_Header + g_ROData[gl_LocalInvocationIndex];
+    Color += texture(g_Tex2D, vec2(0.5)) + texture(g_Tex2DArr[1], vec3(0.5));
+    Color += texelFetch(g_TexelBuffer, 0) + texture(sampler2D(g_SepTex, g_SepSampler), vec2(0.5));
+    imageStore(g_Image, ivec2(0), Color);
+    imageStore(g_ImageBuffer, 0, uvec4(1));
+    g_RWData[gl_LocalInvocationIndex] = uint(Color.x);
+}
+)";
+    TestResources(CompileGLSL(Source, SHADER_TYPE_COMPUTE), SHADER_TYPE_COMPUTE, 10);
+}
+
+} // namespace
@@ -194,6 +194,35 @@ TEST(ShaderPreprocessTest, UnrollIncludes)
     }
 }
 
+TEST(ShaderPreprocessTest, SourceFileCache)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/ShaderPreprocessor", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pData0 = LoadShaderSourceFile(pShaderSourceFactory, "IncludeCommon0.hlsl");
+    ASSERT_NE(pData0, nullptr);
+    RefCntAutoPtr<IDataBlob> pData1 = LoadShaderSourceFile(pShaderSourceFactory, "IncludeCommon0.hlsl");
+    EXPECT_EQ(pData0, pData1);
+
+    // Files are cached per factory
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory2;
+    CreateDefaultShaderSourceStreamFactory("shaders/ShaderPreprocessor", &pShaderSourceFactory2);
+    ASSERT_NE(pShaderSourceFactory2, nullptr);
+    RefCntAutoPtr<IDataBlob> pData2 = LoadShaderSourceFile(pShaderSourceFactory2, "IncludeCommon0.hlsl");
+    ASSERT_NE(pData2, nullptr);
+    EXPECT_NE(pData0, pData2);
+    ASSERT_EQ(pData0->GetSize(), pData2->GetSize());
+    EXPECT_EQ(memcmp(pData0->GetConstDataPtr(), pData2->GetConstDataPtr(), pData0->GetSize()), 0);
+
+    ClearShaderSourceFileCache();
+    RefCntAutoPtr<IDataBlob> pData3 = LoadShaderSourceFile(pShaderSourceFactory, "IncludeCommon0.hlsl");
+    ASSERT_NE(pData3, nullptr);
+    EXPECT_NE(pData0, pData3);
+
+    EXPECT_EQ(LoadShaderSourceFile(pShaderSourceFactory, "NonExistingFile.hlsl", CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT), nullptr);
+}
+
 TEST(ShaderPreprocessTest, ShaderSourceLanguageDefiniton)
 {
     EXPECT_EQ(ParseShaderSourceLanguageDefinition(""), SHADER_SOURCE_LANGUAGE_DEFAULT);
@@ -354,11 +354,18 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
 
             EngineCI.Window   = Window;
             EngineCI.Features = EnvCI.Features;
-            NumDeferredCtx    = 0;
+            NumDeferredCtx    = EnvCI.NumDeferredContexts;
             ppContexts.resize(std::max(size_t{1}, ContextCI.size()) + NumDeferredCtx);
             RefCntAutoPtr<ISwapChain> pSwapChain; // We will use testing swap chain instead
             pFactoryOpenGL->CreateDeviceAndSwapChainGL(
                 EngineCI, &m_pDevice, ppContexts.data(), SCDesc, &pSwapChain);
+
+            // OpenGL does not create deferred contexts at initialization
+            for (Uint32 ctx = 0; ctx < NumDeferredCtx / 2; ++ctx)
+            {
+                if (m_pDevice)
+                    m_pDevice->CreateDeferredContext(&ppContexts[std::max(ContextCI.size(), size_t{1}) + ctx]);
+            }
         }
         break;
 #endif
@@ -604,6 +611,8 @@ GPUTestingEnvironment::~GPUTestingEnvironment()
         {
             const DeviceContextStats&           Stats       = pCtx->GetStats();
             const DeviceContextCommandCounters& CmdCounters = Stats.CommandCounters;
+
+            const DeviceContextRedundantCommandCounters& RedundantCounters = Stats.RedundantCommandCounters;
             LOG_INFO_MESSAGE(
                 "Device context stats"
                 "\n  Command counters",
@@ -648,6 +657,14 @@ GPUTestingEnvironment::~GPUTestingEnvironment()
                 "\n    GenerateMips              ", CmdCounters.GenerateMips,
                 "\n    ResolveTextureSubresource ", CmdCounters.ResolveTextureSubresource,
                 "\n    BindSparseResourceMemory  ", CmdCounters.BindSparseResourceMemory,
+                "\n  Redundant commands",
+                "\n    SetPipelineState          ", RedundantCounters.SetPipelineState,
+                "\n    SetVertexBuffers          ", RedundantCounters.SetVertexBuffers,
+                "\n    SetIndexBuffer            ", RedundantCounters.SetIndexBuffer,
+                "\n    SetBlendFactors           ", RedundantCounters.SetBlendFactors,
+                "\n    SetStencilRef             ", RedundantCounters.SetStencilRef,
+                "\n    SetViewports              ", RedundantCounters.SetViewports,
+                "\n    SetScissorRects           ", RedundantCounters.SetScissorRects,
                 "\n  Primitives",
                 "\n    TRIANGLE_LIST             ", Stats.PrimitiveCounts[PRIMITIVE_TOPOLOGY_TRIANGLE_LIST],
                 "\n    TRIANGLE_STRIP            ", Stats.PrimitiveCounts[PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP],
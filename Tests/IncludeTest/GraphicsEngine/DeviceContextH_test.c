@@ -35,7 +35,7 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     pDesc = IDeviceContext_GetDesc(pCtx);
     (void)(pDesc);
 
-    IDeviceContext_Begin(pCtx, 0u);
+    IDeviceContext_Begin(pCtx, 0u, COMMAND_LIST_FLAG_NONE);
 
     IDeviceContext_TransitionShaderResources(pCtx, (struct IShaderResourceBinding*)NULL);
     IDeviceContext_TransitionResourceStates(pCtx, 1u, (const struct StateTransitionDesc*)NULL);
@@ -44,6 +44,9 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     IDeviceContext_CommitShaderResources(pCtx, (struct IShaderResourceBinding*)NULL, RESOURCE_STATE_TRANSITION_MODE_NONE);
     IDeviceContext_SetStencilRef(pCtx, 1u);
     IDeviceContext_SetBlendFactors(pCtx, (const float*)NULL);
+    IDeviceContext_SetCullMode(pCtx, CULL_MODE_BACK);
+    IDeviceContext_SetDepthState(pCtx, true, true, COMPARISON_FUNC_LESS);
+    IDeviceContext_SetPrimitiveTopology(pCtx, PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
     IDeviceContext_SetVertexBuffers(pCtx, 0u, 1u, (struct IBuffer**)NULL, (const Uint64*)NULL, RESOURCE_STATE_TRANSITION_MODE_NONE, SET_VERTEX_BUFFERS_FLAG_RESET);
     IDeviceContext_InvalidateState(pCtx);
     IDeviceContext_SetIndexBuffer(pCtx, (struct IBuffer*)NULL, (Uint64)0, RESOURCE_STATE_TRANSITION_MODE_NONE);
@@ -56,6 +59,7 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     IDeviceContext_EndRenderPass(pCtx);
     IDeviceContext_ClearDepthStencil(pCtx, (struct ITextureView*)NULL, CLEAR_DEPTH_FLAG, 1.0f, (Uint8)0, RESOURCE_STATE_TRANSITION_MODE_NONE);
     IDeviceContext_ClearRenderTarget(pCtx, (struct ITextureView*)NULL, (const float*)NULL, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    IDeviceContext_InvalidateRenderTargets(pCtx, 1u, true);
 
     IDeviceContext_Draw(pCtx, (struct DrawAttribs*)NULL);
     IDeviceContext_DrawIndexed(pCtx, (struct DrawIndexedAttribs*)NULL);
@@ -90,7 +94,7 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     IDeviceContext_CopyTexture(pCtx, (const struct CopyTextureAttribs*)NULL);
     IDeviceContext_MapTextureSubresource(pCtx, (struct ITexture*)NULL, 0u, 0u, MAP_WRITE, MAP_FLAG_DISCARD, (const struct Box*)NULL, (struct MappedTextureSubresource*)NULL);
     IDeviceContext_UnmapTextureSubresource(pCtx, (struct ITexture*)NULL, 0u, 0u);
-    IDeviceContext_GenerateMips(pCtx, (struct ITextureView*)NULL);
+    IDeviceContext_GenerateMips(pCtx, (struct ITextureView*)NULL, GENERATE_MIPS_FLAG_NONE);
     IDeviceContext_ResolveTextureSubresource(pCtx, (struct ITexture*)NULL, (struct ITexture*)NULL, (const struct ResolveTextureSubresourceAttribs*)NULL);
 
     IDeviceContext_BuildBLAS(pCtx, (struct BuildBLASAttribs*)NULL);
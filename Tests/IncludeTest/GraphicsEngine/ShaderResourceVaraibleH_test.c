@@ -41,4 +41,6 @@ void TestShaderResourceVariable_CInterface(IShaderResourceVariable* pVar)
     (void)Idx;
     struct IDeviceObject* pObj = IShaderResourceVariable_Get(pVar, (Uint32)1);
     (void)pObj;
+    Uint32 Constants[4] = {0};
+    IShaderResourceVariable_SetInlineConstants(pVar, Constants, (Uint32)0, (Uint32)4);
 }
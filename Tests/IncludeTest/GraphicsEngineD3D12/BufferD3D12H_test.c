@@ -36,4 +36,5 @@ void TestBufferD3D12_CInterface(IBufferD3D12* pBuffer)
     IBufferD3D12_SetD3D12ResourceState(pBuffer, RESOURCE_STATE_CONSTANT_BUFFER);
     RESOURCE_STATE State = IBufferD3D12_GetD3D12ResourceState(pBuffer);
     (void)State;
+    IBufferD3D12_SetResidencyPriority(pBuffer, D3D12_RESIDENCY_PRIORITY_NORMAL);
 }
@@ -0,0 +1,48 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "DiligentCore/Graphics/GraphicsEngineD3D12/interface/StorageQueueD3D12.h"
+
+#include <string.h>
+
+void TestStorageQueueD3D12CInterface(IStorageQueueD3D12* pQueue)
+{
+    StorageReadRequestD3D12 Request;
+    memset(&Request, 0, sizeof(Request));
+    bool Res = IStorageQueueD3D12_EnqueueRead(pQueue, &Request);
+    (void)Res;
+
+    IStorageQueueD3D12_EnqueueSignal(pQueue, (IFence*)NULL, (Uint64)1);
+    IStorageQueueD3D12_Submit(pQueue);
+
+    Uint32 NumFailed = IStorageQueueD3D12_GetNumFailedRequests(pQueue);
+    (void)NumFailed;
+
+    IStorageQueueD3D12_CloseFiles(pQueue);
+
+    IDStorageQueue* pDStorageQueue = IStorageQueueD3D12_GetDStorageQueue(pQueue);
+    (void)pDStorageQueue;
+}
@@ -38,4 +38,6 @@ void TestTextureD3D12_CInterface(ITextureD3D12* pTexture)
 
     D3D12_RESOURCE_STATES State = ITextureD3D12_GetD3D12ResourceState(pTexture);
     (void)State;
+
+    ITextureD3D12_SetResidencyPriority(pTexture, D3D12_RESIDENCY_PRIORITY_NORMAL);
 }
@@ -37,4 +37,7 @@ void TestTextureVk_CInterface(ITextureVk* pTexture)
 
     VkImageLayout vkLayout = ITextureVk_GetLayout(pTexture);
     (void)vkLayout;
+
+    Bool Updated = ITextureVk_UpdateSubresourceOnHost(pTexture, 0u, 0u, (const struct Box*)NULL, (const struct TextureSubResData*)NULL);
+    (void)Updated;
 }
@@ -54,4 +54,12 @@ void TestRenderStateCacheCInterface()
     IRenderStateCache_Reload(pCache, NULL, NULL);
     Uint32 Ver = IRenderStateCache_GetContentVersion(pCache);
     (void)Ver;
+
+    IAsyncPipelineState* pAsyncPSO = NULL;
+    IAsyncPipelineState_SetFallback(pAsyncPSO, pPSO);
+    IPipelineState* pFallback = IAsyncPipelineState_GetFallback(pAsyncPSO);
+    (void)pFallback;
+    bool UsingFallback = IAsyncPipelineState_IsUsingFallback(pAsyncPSO);
+    (void)UsingFallback;
+    IAsyncPipelineState_SetStatusCallback(pAsyncPSO, NULL, NULL);
 }